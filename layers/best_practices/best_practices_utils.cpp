@@ -19,6 +19,9 @@
 
 #include "best_practices/best_practices_validation.h"
 #include "best_practices/best_practices_error_enums.h"
+#include "utils/hash_util.h"
+
+#include <algorithm>
 
 struct VendorSpecificInfo {
     EnableFlags vendor_id;
@@ -56,6 +59,27 @@ bp_state::CommandBuffer::CommandBuffer(BestPractices* bp, VkCommandBuffer cb, co
                                        const vvl::CommandPool* pool)
     : vvl::CommandBuffer(bp, cb, pCreateInfo, pool) {}
 
+void bp_state::CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_command_buffers) {
+    vvl::CommandBuffer::ExecuteCommands(secondary_command_buffers);
+    for (const VkCommandBuffer sub_command_buffer : secondary_command_buffers) {
+        auto sub_cb_state = dev_data->GetRead<bp_state::CommandBuffer>(sub_command_buffer);
+        queue_submit_image_uses.insert(queue_submit_image_uses.end(), sub_cb_state->queue_submit_image_uses.begin(),
+                                       sub_cb_state->queue_submit_image_uses.end());
+    }
+}
+
+void bp_state::CommandBuffer::Reset() {
+    vvl::CommandBuffer::Reset();
+    queue_submit_image_uses.clear();
+    queue_submit_image_uses_after_render_pass.clear();
+}
+
+void bp_state::CommandBuffer::CollectMemoryFootprint(vvl::MemoryFootprint& footprint) const {
+    vvl::CommandBuffer::CollectMemoryFootprint(footprint);
+    footprint.AddVector("Best practices queue_submit_image_uses", queue_submit_image_uses);
+    footprint.AddVector("Best practices queue_submit_image_uses_after_render_pass", queue_submit_image_uses_after_render_pass);
+}
+
 bool BestPractices::VendorCheckEnabled(BPVendorFlags vendors) const {
     for (const auto& vendor : kVendorInfo) {
         if (vendors & vendor.first && enabled[vendor.second.vendor_id]) {
@@ -117,3 +141,125 @@ void BestPractices::LogErrorCode(const RecordObject& record_obj) const {
         LogWarning(kVUID_BestPractices_Error_Result, instance, record_obj.location, "Returned error %s.", result_string);
     }
 }
+
+bool BestPractices::CountFrameMessage(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList& objlist,
+                                      const Location& loc) const {
+    // Only the device has frame boundaries
+    if (!enabled[best_practices_frame_summary] || device == VK_NULL_HANDLE) {
+        return false;
+    }
+    const uint32_t vuid_hash = hash_util::VuidHash(vuid_text);
+    if (!report_data->IsMessageEnabled(msg_flags, vuid_hash)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> guard(frame_messages_lock_);
+    FrameMessage& message = frame_messages_[vuid_hash];
+    if (message.count++ == 0) {
+        message.msg_flags = msg_flags;
+        message.vuid = vuid_text;
+        message.objects = objlist;
+        message.function = loc.function;
+    }
+    return true;
+}
+
+bool BestPractices::LogWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format,
+                               ...) const {
+    if (CountFrameMessage(kWarningBit, vuid_text, objlist, loc)) {
+        return false;
+    }
+    va_list argptr;
+    va_start(argptr, format);
+    const bool result = LogMsg(report_data, kWarningBit, objlist, &loc, vuid_text, format, argptr);
+    va_end(argptr);
+    return result;
+}
+
+bool BestPractices::LogPerformanceWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc,
+                                          const char* format, ...) const {
+    if (CountFrameMessage(kPerformanceWarningBit, vuid_text, objlist, loc)) {
+        return false;
+    }
+    va_list argptr;
+    va_start(argptr, format);
+    const bool result = LogMsg(report_data, kPerformanceWarningBit, objlist, &loc, vuid_text, format, argptr);
+    va_end(argptr);
+    return result;
+}
+
+bool BestPractices::LogInfo(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format,
+                            ...) const {
+    if (CountFrameMessage(kInformationBit, vuid_text, objlist, loc)) {
+        return false;
+    }
+    va_list argptr;
+    va_start(argptr, format);
+    const bool result = LogMsg(report_data, kInformationBit, objlist, &loc, vuid_text, format, argptr);
+    va_end(argptr);
+    return result;
+}
+
+void BestPractices::ReportFrameSummary(const Location& loc) {
+    std::vector<FrameMessage> messages;
+    {
+        std::lock_guard<std::mutex> guard(frame_messages_lock_);
+        if (frame_messages_.empty()) {
+            return;
+        }
+        messages.reserve(frame_messages_.size());
+        for (auto& entry : frame_messages_) {
+            messages.emplace_back(std::move(entry.second));
+        }
+        frame_messages_.clear();
+    }
+    // Most frequent first
+    std::sort(messages.begin(), messages.end(), [](const FrameMessage& a, const FrameMessage& b) { return a.count > b.count; });
+
+    for (const FrameMessage& message : messages) {
+        const std::string text = "Reported " + std::to_string(message.count) + " time(s) since the last frame boundary (" +
+                                 String(loc.function) + "), first from this call. Set validate_best_practices_frame_summary " +
+                                 "to false for the details of each occurrence.";
+        const Location first_loc(message.function);
+        switch (message.msg_flags) {
+            case kWarningBit:
+                ValidationStateTracker::LogWarning(message.vuid, message.objects, first_loc, "%s", text.c_str());
+                break;
+            case kPerformanceWarningBit:
+                ValidationStateTracker::LogPerformanceWarning(message.vuid, message.objects, first_loc, "%s", text.c_str());
+                break;
+            default:
+                ValidationStateTracker::LogInfo(message.vuid, message.objects, first_loc, "%s", text.c_str());
+                break;
+        }
+    }
+}
+
+bool BestPractices::CheckFrameBoundary(const void* pNext, const Location& loc) {
+    if (!vku::FindStructInPNextChain<VkFrameBoundaryEXT>(pNext)) {
+        return false;
+    }
+    MergeFrameThreadStates(loc);
+    if (enabled[best_practices_frame_summary]) {
+        ReportFrameSummary(loc);
+    }
+    return true;
+}
+
+BestPractices::FrameThreadState& BestPractices::GetFrameThreadState() const {
+    // The last lookup of the thread, which is almost always for the same device
+    struct CachedState {
+        uint64_t frame_tracking_id = 0;
+        FrameThreadState* state = nullptr;
+    };
+    thread_local CachedState cached;
+    if (cached.frame_tracking_id != frame_tracking_id_) {
+        std::lock_guard<std::mutex> guard(frame_thread_states_lock_);
+        auto& state = frame_thread_states_[std::this_thread::get_id()];
+        if (!state) {
+            state = std::make_unique<FrameThreadState>();
+        }
+        cached.frame_tracking_id = frame_tracking_id_;
+        cached.state = state.get();
+    }
+    return *cached.state;
+}
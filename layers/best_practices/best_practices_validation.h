@@ -23,8 +23,10 @@
 #include "state_tracker/state_tracker.h"
 #include "state_tracker/image_state.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "containers/range_vector.h"
 #include <string>
 #include <chrono>
+#include <thread>
 
 static const uint32_t kMemoryObjectWarningLimit = 250;
 
@@ -248,9 +250,33 @@ class DeviceMemory : public vvl::DeviceMemory {
     std::optional<float> dynamic_priority;  // VK_EXT_pageable_device_local_memory priority
 };
 
-struct AttachmentInfo {
-    uint32_t framebufferAttachment;
-    VkImageAspectFlags aspects;
+// The aspects accessed of each framebuffer attachment, indexed by attachment, so recording an access is a mask update with no
+// search and nothing appended
+class AttachmentAspects {
+  public:
+    // Returns the aspects that were not accessed before
+    VkImageAspectFlags Touch(uint32_t fb_attachment, VkImageAspectFlags aspects) {
+        if (fb_attachment >= aspects_.size()) {
+            aspects_.resize(fb_attachment + 1, 0);
+        }
+        const VkImageAspectFlags new_aspects = aspects & ~aspects_[fb_attachment];
+        aspects_[fb_attachment] |= aspects;
+        return new_aspects;
+    }
+    void Touch(const AttachmentAspects& other) {
+        for (uint32_t fb_attachment = 0; fb_attachment < other.aspects_.size(); fb_attachment++) {
+            if (other.aspects_[fb_attachment]) {
+                Touch(fb_attachment, other.aspects_[fb_attachment]);
+            }
+        }
+    }
+    VkImageAspectFlags Get(uint32_t fb_attachment) const {
+        return fb_attachment < aspects_.size() ? aspects_[fb_attachment] : 0;
+    }
+    void clear() { aspects_.clear(); }
+
+  private:
+    small_vector<VkImageAspectFlags, 8, uint32_t> aspects_;
 };
 
 // used to track state regarding render pass heuristic checks
@@ -271,8 +297,8 @@ struct RenderPassState {
     };
 
     std::vector<ClearInfo> earlyClearAttachments;
-    std::vector<AttachmentInfo> touchesAttachments;
-    std::vector<AttachmentInfo> nextDrawTouchesAttachments;
+    AttachmentAspects touchesAttachments;
+    AttachmentAspects nextDrawTouchesAttachments;
     bool drawTouchAttachments = false;
 };
 
@@ -298,15 +324,10 @@ struct CommandBufferStateNV {
         uint64_t num_less_draws = 0;
         uint64_t num_greater_draws = 0;
     };
-    struct ZcullTree {
-        std::vector<ZcullResourceState> states;
-        uint32_t mip_levels = 0;
-        uint32_t array_layers = 0;
-
-        const ZcullResourceState& GetState(uint32_t layer, uint32_t level) const { return states[layer * mip_levels + level]; }
-
-        ZcullResourceState& GetState(uint32_t layer, uint32_t level) { return states[layer * mip_levels + level]; }
-    };
+    // Indexed with the subresource_encoder of the depth image, so that the layers of a mip level are adjacent and an update
+    // costs the number of distinct states in the range instead of its number of subresources.
+    // The subresources that were never touched are absent and in the default state.
+    using ZcullTree = sparse_container::range_map<subresource_adapter::IndexType, ZcullResourceState>;
     struct ZcullScope {
         VkImage image = VK_NULL_HANDLE;
         VkImageSubresourceRange range{};
@@ -323,15 +344,43 @@ struct CommandBufferStateNV {
     bool depth_test_enable = false;
 };
 
+// A use of image subresources recorded in a command buffer, validated and tracked in the image when the command buffer is
+// submitted. Plain records rather than callbacks, as a command buffer can hold a lot of them and replays them at each submit.
+struct QueuedImageUse {
+    enum class Type : uint8_t {
+        Access,             // Validated with ValidateImageInQueue, then becomes the last usage
+        QueueFamilyAcquire  // Ownership transfer to the submitting queue family, the last usage is kept
+    };
+    std::shared_ptr<Image> image;
+    vvl::Func command;
+    Type type;
+    IMAGE_SUBRESOURCE_USAGE_BP usage;
+    // Already clamped to the image, VK_REMAINING_* are resolved
+    uint32_t base_array_layer;
+    uint32_t layer_count;
+    uint32_t base_mip_level;
+    uint32_t level_count;
+};
+using QueuedImageUses = std::vector<QueuedImageUse>;
+
 class CommandBuffer : public vvl::CommandBuffer {
   public:
     CommandBuffer(BestPractices* bp, VkCommandBuffer cb, const VkCommandBufferAllocateInfo* pCreateInfo,
                   const vvl::CommandPool* pool);
 
+    void ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_command_buffers) final;
+    void Reset() final;
+    void CollectMemoryFootprint(vvl::MemoryFootprint& footprint) const final;
+
     RenderPassState render_pass_state;
     CommandBufferStateNV nv;
     uint64_t num_submits = 0;
 
+    // Validated at primary command buffer queue submit time, in recording order
+    QueuedImageUses queue_submit_image_uses;
+    // The uses by the store ops of the render pass, appended to queue_submit_image_uses at vkCmdEndRenderPass time
+    QueuedImageUses queue_submit_image_uses_after_render_pass;
+
     std::vector<uint8_t> push_constant_data_set;
     void UnbindResources() { push_constant_data_set.clear(); }
 };
@@ -350,7 +399,7 @@ class Pipeline : public vvl::Pipeline {
              std::shared_ptr<const vvl::RenderPass>&& rpstate, std::shared_ptr<const vvl::PipelineLayout>&& layout,
              CreateShaderModuleStates* csm_states);
 
-    const std::vector<AttachmentInfo> access_framebuffer_attachments;
+    const AttachmentAspects access_framebuffer_attachments;
 };
 }  // namespace bp_state
 
@@ -368,7 +417,11 @@ class BestPractices : public ValidationStateTracker {
     using Struct = vvl::Struct;
     using Field = vvl::Field;
 
-    BestPractices() { container_type = LayerObjectTypeBestPractices; }
+    BestPractices() {
+        container_type = LayerObjectTypeBestPractices;
+        // None of the validation prepares state for the record phase, the budget can shed all of it
+        budget_family = vvl::CheckFamily::BestPractices;
+    }
 
     ReadLockGuard ReadLock() const override;
     WriteLockGuard WriteLock() override;
@@ -378,6 +431,17 @@ class BestPractices : public ValidationStateTracker {
     void LogPositiveSuccessCode(const RecordObject& record_obj) const;
     void LogErrorCode(const RecordObject& record_obj) const;
 
+    // These hide the ValidationObject ones for all the best practices checks. With validate_best_practices_frame_summary the
+    // message is only counted without being formatted, and reported once per frame by ReportFrameSummary.
+    bool DECORATE_PRINTF(5, 6)
+        LogWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const;
+    bool DECORATE_PRINTF(5, 6) LogPerformanceWarning(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc,
+                                                     const char* format, ...) const;
+    bool DECORATE_PRINTF(5, 6)
+        LogInfo(std::string_view vuid_text, const LogObjectList& objlist, const Location& loc, const char* format, ...) const;
+    // Reports each message counted since the last frame boundary once, with its count
+    void ReportFrameSummary(const Location& loc);
+
     bool ValidateCmdDrawType(VkCommandBuffer cmd_buffer, const Location& loc) const;
 
     bool ValidatePushConstants(VkCommandBuffer cmd_buffer, const Location& loc) const;
@@ -394,6 +458,7 @@ class BestPractices : public ValidationStateTracker {
     bool PreCallValidateCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo,
                                      const VkAllocationCallbacks* pAllocator, VkDevice* pDevice,
                                      const ErrorObject& error_obj) const override;
+    void CreateDevice(const VkDeviceCreateInfo* pCreateInfo) override;
     bool PreCallValidateCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo,
                                      const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer,
                                      const ErrorObject& error_obj) const override;
@@ -780,15 +845,14 @@ class BestPractices : public ValidationStateTracker {
     bool PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2* pResolveImageInfo,
                                          const ErrorObject& error_obj) const override;
 
-    using QueueCallbacks = std::vector<vvl::CommandBuffer::QueueCallback>;
+    using QueuedImageUses = bp_state::QueuedImageUses;
 
-    void QueueValidateImageView(QueueCallbacks& func, Func command, vvl::ImageView* view, IMAGE_SUBRESOURCE_USAGE_BP usage);
-    void QueueValidateImage(QueueCallbacks& func, Func command, std::shared_ptr<bp_state::Image>& state,
+    void QueueValidateImageView(QueuedImageUses& uses, Func command, vvl::ImageView* view, IMAGE_SUBRESOURCE_USAGE_BP usage);
+    void QueueValidateImage(QueuedImageUses& uses, Func command, std::shared_ptr<bp_state::Image>& state,
                             IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceRange& subresource_range);
-    void QueueValidateImage(QueueCallbacks& func, Func command, std::shared_ptr<bp_state::Image>& state,
+    void QueueValidateImage(QueuedImageUses& uses, Func command, std::shared_ptr<bp_state::Image>& state,
                             IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceLayers& range);
-    void QueueValidateImage(QueueCallbacks& func, Func command, std::shared_ptr<bp_state::Image>& state,
-                            IMAGE_SUBRESOURCE_USAGE_BP usage, uint32_t array_layer, uint32_t mip_level);
+    void ValidateQueuedImageUses(const vvl::Queue& qs, const bp_state::CommandBuffer& cbs);
     void ValidateImageInQueue(const vvl::Queue& qs, const vvl::CommandBuffer& cbs, Func command, bp_state::Image& state,
                               IMAGE_SUBRESOURCE_USAGE_BP usage, uint32_t array_layer, uint32_t mip_level);
     void ValidateImageInQueueArmImg(Func command, const bp_state::Image& image, IMAGE_SUBRESOURCE_USAGE_BP last_usage,
@@ -966,6 +1030,10 @@ class BestPractices : public ValidationStateTracker {
 
     void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
                                   const RecordObject& record_obj) override;
+    void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence,
+                                   const RecordObject& record_obj) override;
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
+                                    const RecordObject& record_obj) override;
 
     void PreCallRecordCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
                                           const VkClearAttachment* pClearAttachments, uint32_t rectCount, const VkClearRect* pRects,
@@ -1036,30 +1104,59 @@ class BestPractices : public ValidationStateTracker {
                                                                CreateShaderModuleStates* csm_states) const final;
 
   private:
-    // CacheEntry and PostTransformLRUCacheModel are used on the stack
-    struct CacheEntry {
-        uint32_t value;
-        uint32_t age;
-    };
-
+    // PostTransformLRUCacheModel is used on the stack
     class PostTransformLRUCacheModel {
       public:
-        typedef std::vector<CacheEntry>::iterator cache_iterator;
-
-        void resize(size_t size);
+        // The size of the cache being modelled positively correlates with how much behaviour it can capture about
+        // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
+        // target architecture.
+        // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
+        // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
+        static constexpr uint32_t kSize = 32;
 
         // Returns true if there was a cache hit - also models LRU behavior which will effect subsequent calls.
         bool query_cache(uint32_t value);
 
       private:
-        std::vector<CacheEntry> _entries = {};
+        // Kept as separate arrays so that the searches over all the entries are branchless loops the compiler can vectorize
+        std::array<uint32_t, kSize> values_ = {};
+        std::array<uint32_t, kSize> ages_ = {};
         uint32_t iteration = 0;
     };
 
+    // What ValidateIndexBufferArm learns from scanning a range of indices, which only depends on the index values
+    struct IndexScanResult {
+        uint32_t min_index;
+        uint32_t max_index;
+        uint32_t vertex_shade_count;
+        // Only counted when the range is dense enough for the utilization checks
+        uint32_t vertex_reference_count;
+    };
+    template <typename IndexType>
+    static IndexScanResult ScanIndicesArm(const IndexType* indices, uint32_t index_count, bool primitive_restart_enable);
+
     // Check that vendor-specific checks are enabled for at least one of the vendors
     bool VendorCheckEnabled(BPVendorFlags vendors) const;
+    // Best practices never logs errors, so the checks doing real work to find what to warn about are skipped while no message
+    // of msg_flags can be delivered
+    bool MessagesEnabled(VkFlags msg_flags = kWarningBit | kPerformanceWarningBit | kInformationBit) const {
+        return report_data->IsMessageEnabled(msg_flags);
+    }
     const char* VendorSpecificTag(BPVendorFlags vendors) const;
-
+    // Returns true if the message was counted for the frame summary instead of being logged
+    bool CountFrameMessage(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList& objlist, const Location& loc) const;
+    // Returns true if pNext has a VkFrameBoundaryEXT, after ending the frame
+    bool CheckFrameBoundary(const void* pNext, const Location& loc);
+
+    // The vendor specific part of RecordCmdDrawType is instantiated for each set of vendors, CreateDevice picks the one of
+    // the enabled vendors so that the draw record path doesn't test VendorCheckEnabled for every draw
+    template <BPVendorFlags kVendors>
+    void RecordCmdDrawTypeVendors(bp_state::CommandBuffer& cb_state, uint32_t draw_count);
+    using RecordCmdDrawTypeFn = void (BestPractices::*)(bp_state::CommandBuffer& cb_state, uint32_t draw_count);
+    static RecordCmdDrawTypeFn GetRecordCmdDrawTypeFn(BPVendorFlags vendors);
+    RecordCmdDrawTypeFn record_cmd_draw_type_vendors_ = nullptr;
+
+    template <bool kImgEnabled>
     void RecordCmdDrawTypeArm(bp_state::CommandBuffer& cb_state, uint32_t draw_count);
     void RecordCmdDrawTypeNVIDIA(bp_state::CommandBuffer& cb_state);
 
@@ -1111,20 +1208,21 @@ class BestPractices : public ValidationStateTracker {
                             const Location& loc) const;
 
     void PipelineUsedInFrame(VkPipeline pipeline) {
-        WriteLockGuard guard(pipeline_lock_);
-        pipelines_used_in_frame_.insert(pipeline);
-    }
-
-    void ClearPipelinesUsedInFrame() {
-        WriteLockGuard guard(pipeline_lock_);
-        pipelines_used_in_frame_.clear();
+        FrameThreadState& state = GetFrameThreadState();
+        std::lock_guard<std::mutex> guard(state.lock);
+        state.pipelines_used.insert(pipeline);
     }
 
+    // Only sees the binds of the calling thread, the binds of other threads are compared by MergeFrameThreadStates
     bool IsPipelineUsedInFrame(VkPipeline pipeline) const {
-        ReadLockGuard guard(pipeline_lock_);
-        return pipelines_used_in_frame_.count(pipeline) != 0;
+        FrameThreadState& state = GetFrameThreadState();
+        std::lock_guard<std::mutex> guard(state.lock);
+        return state.pipelines_used.count(pipeline) != 0;
     }
 
+    // Called at each frame boundary
+    void MergeFrameThreadStates(const Location& loc);
+
     // AMD tracked
     std::atomic<uint32_t> num_barriers_objects_{0};
     std::atomic<uint32_t> num_pso_{0};
@@ -1144,6 +1242,41 @@ class BestPractices : public ValidationStateTracker {
     std::set<std::array<uint32_t, 4>> clear_colors_;
     mutable std::shared_mutex clear_colors_lock_;
 
-    vvl::unordered_set<VkPipeline> pipelines_used_in_frame_;
-    mutable std::shared_mutex pipeline_lock_;
+    // The frame level tracking of the bound pipelines and of the freed memory is accumulated per recording thread, so that
+    // the recording hooks of several threads never update the same container. The mutex of a thread is only contended when a
+    // frame boundary merges the accumulators of all of them.
+    struct FrameThreadState {
+        std::mutex lock;
+        vvl::unordered_set<VkPipeline> pipelines_used;
+        // Moved to memory_free_events_ at the next frame boundary
+        std::vector<MemoryFreeEvent> memory_free_events;
+    };
+    FrameThreadState& GetFrameThreadState() const;
+
+    // A BestPractices object can be destroyed and another one allocated at the same address, the id tells them apart in the
+    // thread local cache of GetFrameThreadState
+    static inline std::atomic<uint64_t> next_frame_tracking_id_{1};
+    const uint64_t frame_tracking_id_ = next_frame_tracking_id_.fetch_add(1);
+    mutable vvl::unordered_map<std::thread::id, std::unique_ptr<FrameThreadState>> frame_thread_states_;
+    mutable std::mutex frame_thread_states_lock_;
+
+    // Arm tracked
+    // Keyed by a hash of the scanned index bytes, so a static mesh drawn many times is only scanned once. The indices live in
+    // mapped memory the application can write at any time without a call the layer sees, a content hash is the only key
+    // that can't go stale.
+    static constexpr size_t kMaxIndexScanCacheSize = 4096;
+    mutable vvl::unordered_map<uint64_t, IndexScanResult> index_scan_cache_;
+    mutable std::shared_mutex index_scan_cache_lock_;
+
+    // validate_best_practices_frame_summary, keyed by hash_util::VuidHash
+    struct FrameMessage {
+        VkFlags msg_flags = 0;
+        std::string vuid;
+        uint32_t count = 0;
+        // Of the first occurrence in the frame
+        LogObjectList objects;
+        Func function = Func::Empty;
+    };
+    mutable vvl::unordered_map<uint32_t, FrameMessage> frame_messages_;
+    mutable std::mutex frame_messages_lock_;
 };
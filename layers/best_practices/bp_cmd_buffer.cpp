@@ -249,9 +249,7 @@ void BestPractices::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffe
             }
         }
 
-        for (auto& touch : secondary->render_pass_state.touchesAttachments) {
-            RecordAttachmentAccess(*primary, touch.framebufferAttachment, touch.aspects);
-        }
+        primary->render_pass_state.touchesAttachments.Touch(secondary->render_pass_state.touchesAttachments);
 
         primary->render_pass_state.numDrawCallsDepthEqualCompare += secondary->render_pass_state.numDrawCallsDepthEqualCompare;
         primary->render_pass_state.numDrawCallsDepthOnly += secondary->render_pass_state.numDrawCallsDepthOnly;
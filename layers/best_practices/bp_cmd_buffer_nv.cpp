@@ -86,18 +86,7 @@ void BestPractices::RecordBindZcullScope(bp_state::CommandBuffer& cmd_state, VkI
 
     assert((subresource_range.aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT) != 0U);
 
-    auto image_state = Get<vvl::Image>(depth_attachment);
-    assert(image_state);
-
-    const uint32_t mip_levels = image_state->createInfo.mipLevels;
-    const uint32_t array_layers = image_state->createInfo.arrayLayers;
-
     auto& tree = cmd_state.nv.zcull_per_image[depth_attachment];
-    if (tree.states.empty()) {
-        tree.mip_levels = mip_levels;
-        tree.array_layers = array_layers;
-        tree.states.resize(array_layers * mip_levels);
-    }
 
     cmd_state.nv.zcull_scope.image = depth_attachment;
     cmd_state.nv.zcull_scope.range = subresource_range;
@@ -117,20 +106,41 @@ void BestPractices::RecordResetScopeZcullDirection(bp_state::CommandBuffer& cmd_
     RecordResetZcullDirection(cmd_state, scope.image, scope.range);
 }
 
+// Calls func with each index range of the depth subresources of range, in the space of the subresource_encoder of image
 template <typename Func>
-static void ForEachSubresource(const vvl::Image& image, const VkImageSubresourceRange& range, Func&& func) {
-    const uint32_t layerCount =
-        (range.layerCount == VK_REMAINING_ARRAY_LAYERS) ? (image.full_range.layerCount - range.baseArrayLayer) : range.layerCount;
-    const uint32_t levelCount =
-        (range.levelCount == VK_REMAINING_MIP_LEVELS) ? (image.full_range.levelCount - range.baseMipLevel) : range.levelCount;
-
-    for (uint32_t i = 0; i < layerCount; ++i) {
-        const uint32_t layer = range.baseArrayLayer + i;
-        for (uint32_t j = 0; j < levelCount; ++j) {
-            const uint32_t level = range.baseMipLevel + j;
-            func(layer, level);
-        }
+static void ForEachDepthRange(const vvl::Image& image, const VkImageSubresourceRange& range, Func&& func) {
+    if ((image.full_range.aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT) == 0) {
+        return;
     }
+    // The direction is tracked per mip level and layer, so a stencil only range resets the depth subresources too
+    VkImageSubresourceRange depth_range = image.NormalizeSubresourceRange(range);
+    depth_range.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+
+    for (subresource_adapter::RangeGenerator range_gen(image.subresource_encoder, depth_range); range_gen->non_empty();
+         ++range_gen) {
+        func(*range_gen);
+    }
+}
+
+// Applies update to the state of each depth subresource of range, the untouched subresources start from the default state
+template <typename Update>
+static void UpdateZcullStates(bp_state::CommandBufferStateNV::ZcullTree& tree, const vvl::Image& image,
+                              const VkImageSubresourceRange& range, const Update& update) {
+    using ZcullTree = bp_state::CommandBufferStateNV::ZcullTree;
+    struct ZcullInfillUpdateOps {
+        void infill(ZcullTree& map, const ZcullTree::iterator& pos, const ZcullTree::key_type& infill_range) const {
+            bp_state::CommandBufferStateNV::ZcullResourceState state;
+            update_state(state);
+            map.insert(pos, std::make_pair(infill_range, state));
+        }
+        void update(const ZcullTree::iterator& pos) const { update_state(pos->second); }
+        const Update& update_state;
+    };
+
+    const ZcullInfillUpdateOps ops{update};
+    ForEachDepthRange(image, range, [&tree, &ops](const subresource_adapter::IndexRange& index_range) {
+        sparse_container::infill_update_range(tree, index_range, ops);
+    });
 }
 
 void BestPractices::RecordResetZcullDirection(bp_state::CommandBuffer& cmd_state, VkImage depth_image,
@@ -148,10 +158,9 @@ void BestPractices::RecordResetZcullDirection(bp_state::CommandBuffer& cmd_state
     auto image = Get<vvl::Image>(depth_image);
     if (!image) return;
 
-    ForEachSubresource(*image, subresource_range, [&tree](uint32_t layer, uint32_t level) {
-        auto& subresource = tree.GetState(layer, level);
-        subresource.num_less_draws = 0;
-        subresource.num_greater_draws = 0;
+    UpdateZcullStates(tree, *image, subresource_range, [](bp_state::CommandBufferStateNV::ZcullResourceState& state) {
+        state.num_less_draws = 0;
+        state.num_greater_draws = 0;
     });
 }
 
@@ -177,9 +186,9 @@ void BestPractices::RecordSetZcullDirection(bp_state::CommandBuffer& cmd_state,
     auto image = Get<vvl::Image>(depth_image);
     if (!image) return;
 
-    ForEachSubresource(*image, subresource_range, [&tree, &cmd_state](uint32_t layer, uint32_t level) {
-        tree.GetState(layer, level).direction = cmd_state.nv.zcull_direction;
-    });
+    const auto direction = cmd_state.nv.zcull_direction;
+    UpdateZcullStates(tree, *image, subresource_range,
+                      [direction](bp_state::CommandBufferStateNV::ZcullResourceState& state) { state.direction = direction; });
 }
 
 void BestPractices::RecordZcullDraw(bp_state::CommandBuffer& cmd_state) {
@@ -191,19 +200,17 @@ void BestPractices::RecordZcullDraw(bp_state::CommandBuffer& cmd_state) {
     auto image = Get<vvl::Image>(scope.image);
     if (!image) return;
 
-    ForEachSubresource(*image, scope.range, [&scope](uint32_t layer, uint32_t level) {
-        auto& subresource = scope.tree->GetState(layer, level);
-
-        switch (subresource.direction) {
+    UpdateZcullStates(*scope.tree, *image, scope.range, [](bp_state::CommandBufferStateNV::ZcullResourceState& state) {
+        switch (state.direction) {
             case bp_state::CommandBufferStateNV::ZcullDirection::Unknown:
                 // Unreachable
                 assert(0);
                 break;
             case bp_state::CommandBufferStateNV::ZcullDirection::Less:
-                ++subresource.num_less_draws;
+                ++state.num_less_draws;
                 break;
             case bp_state::CommandBufferStateNV::ZcullDirection::Greater:
-                ++subresource.num_greater_draws;
+                ++state.num_greater_draws;
                 break;
         }
     });
@@ -241,28 +248,29 @@ bool BestPractices::ValidateZcull(const bp_state::CommandBuffer& cmd_state, VkIm
         return skip;
     }
 
-    ForEachSubresource(*image_state, subresource_range, [&](uint32_t layer, uint32_t level) {
-        if (is_balanced) {
-            return;
-        }
-        const auto& resource = tree.GetState(layer, level);
-        const uint64_t num_draws = resource.num_less_draws + resource.num_greater_draws;
-
-        if (num_draws == 0) {
-            return;
-        }
-        const uint64_t less_ratio = (resource.num_less_draws * 100) / num_draws;
-        const uint64_t greater_ratio = (resource.num_greater_draws * 100) / num_draws;
-
-        if ((less_ratio > kZcullDirectionBalanceRatioNVIDIA) && (greater_ratio > kZcullDirectionBalanceRatioNVIDIA)) {
-            is_balanced = true;
+    ForEachDepthRange(*image_state, subresource_range, [&](const subresource_adapter::IndexRange& index_range) {
+        // The untouched subresources between the recorded ranges have no draws
+        for (auto it = tree.lower_bound(index_range); !is_balanced && it != tree.end() && it->first.begin < index_range.end;
+             ++it) {
+            const auto& resource = it->second;
+            const uint64_t num_draws = resource.num_less_draws + resource.num_greater_draws;
 
-            if (greater_ratio > less_ratio) {
-                good_mode = "GREATER";
-                bad_mode = "LESS";
-            } else {
-                good_mode = "LESS";
-                bad_mode = "GREATER";
+            if (num_draws == 0) {
+                continue;
+            }
+            const uint64_t less_ratio = (resource.num_less_draws * 100) / num_draws;
+            const uint64_t greater_ratio = (resource.num_greater_draws * 100) / num_draws;
+
+            if ((less_ratio > kZcullDirectionBalanceRatioNVIDIA) && (greater_ratio > kZcullDirectionBalanceRatioNVIDIA)) {
+                is_balanced = true;
+
+                if (greater_ratio > less_ratio) {
+                    good_mode = "GREATER";
+                    bad_mode = "LESS";
+                } else {
+                    good_mode = "LESS";
+                    bad_mode = "GREATER";
+                }
             }
         }
     });
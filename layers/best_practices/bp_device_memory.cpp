@@ -20,18 +20,65 @@
 #include "best_practices/best_practices_validation.h"
 #include "best_practices/best_practices_error_enums.h"
 
+// Release old allocations to avoid overpopulating the container, the events are in time order
+template <typename Events>
+static void ReleaseOldMemoryFreeEvents(Events& events, std::chrono::high_resolution_clock::time_point now) {
+    const auto last_old = std::find_if(events.rbegin(), events.rend(), [now](const auto& event) {
+        return now - event.time > kAllocateMemoryReuseTimeThresholdNVIDIA;
+    });
+    events.erase(events.begin(), last_old.base());
+}
+
 void BestPractices::PreCallRecordAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
                                                 const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory,
                                                 const RecordObject& record_obj) {
     if (VendorCheckEnabled(kBPVendorNVIDIA)) {
+        // The events of other threads are released when they are merged at the next frame boundary
+        FrameThreadState& state = GetFrameThreadState();
+        std::lock_guard<std::mutex> guard(state.lock);
+        ReleaseOldMemoryFreeEvents(state.memory_free_events, std::chrono::high_resolution_clock::now());
+    }
+}
+
+void BestPractices::MergeFrameThreadStates(const Location& loc) {
+    // Number of threads that bound each pipeline during the frame
+    vvl::unordered_map<VkPipeline, uint32_t> pipeline_threads;
+    std::vector<MemoryFreeEvent> memory_free_events;
+    {
+        std::lock_guard<std::mutex> guard(frame_thread_states_lock_);
+        for (auto& entry : frame_thread_states_) {
+            FrameThreadState& state = *entry.second;
+            std::lock_guard<std::mutex> state_guard(state.lock);
+            for (const VkPipeline pipeline : state.pipelines_used) {
+                pipeline_threads[pipeline]++;
+            }
+            state.pipelines_used.clear();
+            memory_free_events.insert(memory_free_events.end(), state.memory_free_events.begin(),
+                                      state.memory_free_events.end());
+            state.memory_free_events.clear();
+        }
+    }
+
+    if (!memory_free_events.empty()) {
+        std::sort(memory_free_events.begin(), memory_free_events.end(),
+                  [](const MemoryFreeEvent& a, const MemoryFreeEvent& b) { return a.time < b.time; });
         WriteLockGuard guard{memory_free_events_lock_};
+        memory_free_events_.insert(memory_free_events_.end(), memory_free_events.begin(), memory_free_events.end());
+        ReleaseOldMemoryFreeEvents(memory_free_events_, std::chrono::high_resolution_clock::now());
+    }
 
-        // Release old allocations to avoid overpopulating the container
-        const auto now = std::chrono::high_resolution_clock::now();
-        const auto last_old = std::find_if(
-            memory_free_events_.rbegin(), memory_free_events_.rend(),
-            [now](const MemoryFreeEvent& event) { return now - event.time > kAllocateMemoryReuseTimeThresholdNVIDIA; });
-        memory_free_events_.erase(memory_free_events_.begin(), last_old.base());
+    // The binds of a single thread were already compared in PreCallValidateCmdBindPipeline
+    if (VendorCheckEnabled(kBPVendorAMD) || VendorCheckEnabled(kBPVendorNVIDIA)) {
+        for (const auto& [pipeline, threads] : pipeline_threads) {
+            if (threads > 1) {
+                LogPerformanceWarning(kVUID_BestPractices_Pipeline_SortAndBind, pipeline, loc,
+                                      "%s %s Pipeline %s was bound from %" PRIu32
+                                      " threads in the frame. Keep pipeline state changes to a minimum, for example, by sorting "
+                                      "draw calls by pipeline.",
+                                      VendorSpecificTag(kBPVendorAMD), VendorSpecificTag(kBPVendorNVIDIA),
+                                      FormatHandle(pipeline).c_str(), threads);
+            }
+        }
     }
 }
 
@@ -71,20 +118,36 @@ bool BestPractices::PreCallValidateAllocateMemory(VkDevice device, const VkMemor
             // Size in bytes for an allocation to be considered "compatible"
             static constexpr VkDeviceSize size_threshold = VkDeviceSize{1} << 20;
 
-            ReadLockGuard guard{memory_free_events_lock_};
-
             const auto now = std::chrono::high_resolution_clock::now();
             const VkDeviceSize alloc_size = pAllocateInfo->allocationSize;
             const uint32_t memory_type_index = pAllocateInfo->memoryTypeIndex;
-            const auto latest_event =
-                std::find_if(memory_free_events_.rbegin(), memory_free_events_.rend(), [&](const MemoryFreeEvent& event) {
-                    return (memory_type_index == event.memory_type_index) && (alloc_size <= event.allocation_size) &&
-                           (alloc_size - event.allocation_size <= size_threshold) &&
-                           (now - event.time < kAllocateMemoryReuseTimeThresholdNVIDIA);
-                });
-
-            if (latest_event != memory_free_events_.rend()) {
-                const auto time_delta = std::chrono::duration_cast<std::chrono::milliseconds>(now - latest_event->time);
+            auto is_compatible = [&](const MemoryFreeEvent& event) {
+                return (memory_type_index == event.memory_type_index) && (alloc_size <= event.allocation_size) &&
+                       (alloc_size - event.allocation_size <= size_threshold) &&
+                       (now - event.time < kAllocateMemoryReuseTimeThresholdNVIDIA);
+            };
+
+            // The frees of this thread since the last frame boundary are the most recent ones, the frees of the other threads
+            // are only seen once merged at a frame boundary
+            std::optional<std::chrono::high_resolution_clock::time_point> latest_time;
+            {
+                FrameThreadState& state = GetFrameThreadState();
+                std::lock_guard<std::mutex> state_guard(state.lock);
+                const auto it = std::find_if(state.memory_free_events.rbegin(), state.memory_free_events.rend(), is_compatible);
+                if (it != state.memory_free_events.rend()) {
+                    latest_time = it->time;
+                }
+            }
+            if (!latest_time) {
+                ReadLockGuard guard{memory_free_events_lock_};
+                const auto it = std::find_if(memory_free_events_.rbegin(), memory_free_events_.rend(), is_compatible);
+                if (it != memory_free_events_.rend()) {
+                    latest_time = it->time;
+                }
+            }
+
+            if (latest_time) {
+                const auto time_delta = std::chrono::duration_cast<std::chrono::milliseconds>(now - *latest_time);
                 if (time_delta < std::chrono::milliseconds{5}) {
                     skip |= LogPerformanceWarning(
                         kVUID_BestPractices_AllocateMemory_ReuseAllocations, device, error_obj.location,
@@ -122,8 +185,10 @@ void BestPractices::PreCallRecordFreeMemory(VkDevice device, VkDeviceMemory memo
             event.memory_type_index = mem_info->alloc_info.memoryTypeIndex;
             event.allocation_size = mem_info->alloc_info.allocationSize;
 
-            WriteLockGuard guard{memory_free_events_lock_};
-            memory_free_events_.push_back(event);
+            FrameThreadState& state = GetFrameThreadState();
+            std::lock_guard<std::mutex> guard(state.lock);
+            ReleaseOldMemoryFreeEvents(state.memory_free_events, event.time);
+            state.memory_free_events.push_back(event);
         }
     }
 
@@ -19,12 +19,18 @@
 
 #include "best_practices/best_practices_validation.h"
 #include "best_practices/best_practices_error_enums.h"
+#include "utils/hash_util.h"
 
 #include <bitset>
+#include <iterator>
+#include <limits>
 
 // Generic function to handle validation for all CmdDraw* type functions
 bool BestPractices::ValidateCmdDrawType(VkCommandBuffer cmd_buffer, const Location& loc) const {
     bool skip = false;
+    if (!MessagesEnabled(kWarningBit | kPerformanceWarningBit)) {
+        return skip;
+    }
     const auto cb_state = GetRead<bp_state::CommandBuffer>(cmd_buffer);
     if (cb_state) {
         const auto lv_bind_point = ConvertToLvlBindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS);
@@ -85,30 +91,51 @@ bool BestPractices::ValidatePushConstants(VkCommandBuffer cmd_buffer, const Loca
 void BestPractices::RecordCmdDrawType(VkCommandBuffer cmd_buffer, uint32_t draw_count) {
     auto cb_state = GetWrite<bp_state::CommandBuffer>(cmd_buffer);
     assert(cb_state);
-    if (VendorCheckEnabled(kBPVendorArm)) {
-        RecordCmdDrawTypeArm(*cb_state, draw_count);
-    }
-    if (VendorCheckEnabled(kBPVendorNVIDIA)) {
-        RecordCmdDrawTypeNVIDIA(*cb_state);
-    }
+    assert(record_cmd_draw_type_vendors_);
+    (this->*record_cmd_draw_type_vendors_)(*cb_state, draw_count);
 
     if (cb_state->render_pass_state.drawTouchAttachments) {
-        for (auto& touch : cb_state->render_pass_state.nextDrawTouchesAttachments) {
-            RecordAttachmentAccess(*cb_state, touch.framebufferAttachment, touch.aspects);
-        }
+        cb_state->render_pass_state.touchesAttachments.Touch(cb_state->render_pass_state.nextDrawTouchesAttachments);
         // No need to touch the same attachments over and over.
         cb_state->render_pass_state.drawTouchAttachments = false;
     }
 }
 
+template <BPVendorFlags kVendors>
+void BestPractices::RecordCmdDrawTypeVendors(bp_state::CommandBuffer& cb_state, uint32_t draw_count) {
+    if constexpr ((kVendors & kBPVendorArm) != 0) {
+        RecordCmdDrawTypeArm<(kVendors & kBPVendorIMG) != 0>(cb_state, draw_count);
+    }
+    if constexpr ((kVendors & kBPVendorNVIDIA) != 0) {
+        RecordCmdDrawTypeNVIDIA(cb_state);
+    }
+}
+
+BestPractices::RecordCmdDrawTypeFn BestPractices::GetRecordCmdDrawTypeFn(BPVendorFlags vendors) {
+    // Indexed by the BPVendorFlags of the enabled vendors
+    static constexpr RecordCmdDrawTypeFn kFunctions[] = {
+        &BestPractices::RecordCmdDrawTypeVendors<0x0>, &BestPractices::RecordCmdDrawTypeVendors<0x1>,
+        &BestPractices::RecordCmdDrawTypeVendors<0x2>, &BestPractices::RecordCmdDrawTypeVendors<0x3>,
+        &BestPractices::RecordCmdDrawTypeVendors<0x4>, &BestPractices::RecordCmdDrawTypeVendors<0x5>,
+        &BestPractices::RecordCmdDrawTypeVendors<0x6>, &BestPractices::RecordCmdDrawTypeVendors<0x7>,
+        &BestPractices::RecordCmdDrawTypeVendors<0x8>, &BestPractices::RecordCmdDrawTypeVendors<0x9>,
+        &BestPractices::RecordCmdDrawTypeVendors<0xA>, &BestPractices::RecordCmdDrawTypeVendors<0xB>,
+        &BestPractices::RecordCmdDrawTypeVendors<0xC>, &BestPractices::RecordCmdDrawTypeVendors<0xD>,
+        &BestPractices::RecordCmdDrawTypeVendors<0xE>, &BestPractices::RecordCmdDrawTypeVendors<0xF>,
+    };
+    static_assert(static_cast<size_t>(kBPVendorArm | kBPVendorAMD | kBPVendorIMG | kBPVendorNVIDIA) == std::size(kFunctions) - 1,
+                  "Every combination of vendors needs its RecordCmdDrawTypeVendors instance");
+    return kFunctions[vendors & (std::size(kFunctions) - 1)];
+}
+
+template <bool kImgEnabled>
 void BestPractices::RecordCmdDrawTypeArm(bp_state::CommandBuffer& cb_state, uint32_t draw_count) {
     auto& render_pass_state = cb_state.render_pass_state;
     // Each TBDR vendor requires a depth pre-pass draw call to have a minimum number of vertices/indices before it counts towards
     // depth prepass warnings First find the lowest enabled draw count
-    uint32_t lowestEnabledMinDrawCount = 0;
-    lowestEnabledMinDrawCount = VendorCheckEnabled(kBPVendorArm) * kDepthPrePassMinDrawCountArm;
-    if (VendorCheckEnabled(kBPVendorIMG) && kDepthPrePassMinDrawCountIMG < lowestEnabledMinDrawCount)
-        lowestEnabledMinDrawCount = kDepthPrePassMinDrawCountIMG;
+    constexpr uint32_t lowestEnabledMinDrawCount = (kImgEnabled && kDepthPrePassMinDrawCountIMG < kDepthPrePassMinDrawCountArm)
+                                                       ? kDepthPrePassMinDrawCountIMG
+                                                       : kDepthPrePassMinDrawCountArm;
 
     if (draw_count >= lowestEnabledMinDrawCount) {
         if (render_pass_state.depthOnly) render_pass_state.numDrawCallsDepthOnly++;
@@ -167,38 +194,105 @@ bool BestPractices::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer,
                                       kSmallIndexedDrawcallIndices);
     }
 
-    if (VendorCheckEnabled(kBPVendorArm)) {
+    // Reads the whole index range from the mapped buffer memory
+    if (VendorCheckEnabled(kBPVendorArm) && MessagesEnabled(kPerformanceWarningBit)) {
         ValidateIndexBufferArm(*cmd_state, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance, error_obj.location);
     }
 
     return skip;
 }
 
-void BestPractices::PostTransformLRUCacheModel::resize(size_t size) { _entries.resize(size); }
-
 bool BestPractices::PostTransformLRUCacheModel::query_cache(uint32_t value) {
-    // look for a cache hit
-    auto hit = std::find_if(_entries.begin(), _entries.end(), [value](const CacheEntry& entry) { return entry.value == value; });
-    if (hit != _entries.end()) {
+    // look for a cache hit, the first matching entry wins
+    uint32_t hit = kSize;
+    for (uint32_t i = kSize; i-- > 0;) {
+        hit = values_[i] == value ? i : hit;
+    }
+    if (hit != kSize) {
         // mark the cache hit as being most recently used
-        hit->age = iteration++;
+        ages_[hit] = iteration++;
         return true;
     }
 
     // if there's no cache hit, we need to model the entry being inserted into the cache
-    CacheEntry new_entry = {value, iteration};
-    if (iteration < static_cast<uint32_t>(std::distance(_entries.begin(), _entries.end()))) {
-        // if there is still space left in the cache, use the next available slot
-        *(_entries.begin() + iteration) = new_entry;
-    } else {
+    uint32_t slot = iteration;
+    if (iteration >= kSize) {
         // otherwise replace the least recently used cache entry
-        auto lru = std::min_element(_entries.begin(), hit, [](const CacheEntry& a, const CacheEntry& b) { return a.age < b.age; });
-        *lru = new_entry;
+        slot = 0;
+        for (uint32_t i = 1; i < kSize; i++) {
+            slot = ages_[i] < ages_[slot] ? i : slot;
+        }
     }
+    values_[slot] = value;
+    ages_[slot] = iteration;
     iteration++;
     return false;
 }
 
+template <typename IndexType>
+BestPractices::IndexScanResult BestPractices::ScanIndicesArm(const IndexType* indices, uint32_t index_count,
+                                                             bool primitive_restart_enable) {
+    // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
+    // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
+    // irrespective of whether or not they're part of the draw call.
+    // The loop has no branch depending on the index type or values, so it is vectorized.
+    IndexType min_value = std::numeric_limits<IndexType>::max();
+    IndexType max_value = 0;
+    for (uint32_t i = 0; i < index_count; i++) {
+        min_value = std::min(min_value, indices[i]);
+        max_value = std::max(max_value, indices[i]);
+    }
+
+    IndexScanResult result{};
+    result.min_index = min_value;
+    result.max_index = max_value;
+
+    // we're looking to simulate a model LRU post-transform cache, estimating the number of vertices shaded
+    // for the given index buffer
+    constexpr IndexType primitive_restart_value = std::numeric_limits<IndexType>::max();
+    PostTransformLRUCacheModel post_transform_cache;
+    for (uint32_t i = 0; i < index_count; i++) {
+        const IndexType scan_index = indices[i];
+        if (!primitive_restart_enable || scan_index != primitive_restart_value) {
+            const bool in_cache = post_transform_cache.query_cache(scan_index);
+            // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
+            if (!in_cache) result.vertex_shade_count++;
+        }
+    }
+
+    // The references are only needed when the index range is not obviously sparse, see ValidateIndexBufferArm
+    const uint32_t min_index = result.min_index;
+    const uint32_t max_index = result.max_index;
+    if (max_index <= min_index || max_index - min_index >= index_count) return result;
+
+    // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
+    // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
+    const size_t refs_per_bucket = 64;
+    std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
+
+    const uint32_t n_indices = max_index - min_index + 1;
+    const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
+                               ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
+
+    // there needs to be at least one bitset to store a set of indices smaller than n_buckets
+    vertex_reference_buckets.resize(std::max(1u, n_buckets));
+
+    // To avoid using too much memory, we run over the indices again.
+    // Knowing the size from the last scan allows us to record index usage with bitsets
+    for (uint32_t i = 0; i < index_count; i++) {
+        // keep track of the set of all indices used to reference vertices in the draw call
+        size_t index_offset = indices[i] - min_index;
+        size_t bitset_bucket_index = index_offset / refs_per_bucket;
+        uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
+        vertex_reference_buckets[bitset_bucket_index] |= used_indices;
+    }
+
+    for (const auto& bitset : vertex_reference_buckets) {
+        result.vertex_reference_count += static_cast<uint32_t>(bitset.count());
+    }
+    return result;
+}
+
 bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_state, uint32_t indexCount, uint32_t instanceCount,
                                            uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance,
                                            const Location& loc) const {
@@ -228,53 +322,36 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
     if (ib_mem && last_bound.IsUsing()) {
         const uint32_t scan_stride = GetIndexAlignment(ib_type);
         const uint8_t* scan_begin = static_cast<const uint8_t*>(ib_mem) + ib_mem_offset + firstIndex * scan_stride;
-        const uint8_t* scan_end = scan_begin + indexCount * scan_stride;
-
-        // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
-        // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
-        // irrespective of whether or not they're part of the draw call.
-
-        // start with minimum as 0xFFFFFFFF and adjust to indices in the buffer
-        uint32_t min_index = ~0u;
-        // start with maximum as 0 and adjust to indices in the buffer
-        uint32_t max_index = 0u;
-
-        // first scan-through, we're looking to simulate a model LRU post-transform cache, estimating the number of vertices shaded
-        // for the given index buffer
-        uint32_t vertex_shade_count = 0;
-
-        PostTransformLRUCacheModel post_transform_cache;
 
-        // The size of the cache being modelled positively correlates with how much behaviour it can capture about
-        // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
-        // target architecture.
-        // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
-        // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
-        post_transform_cache.resize(32);
-
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            uint32_t primitive_restart_value;
+        // The result only depends on the index values, the index type and primitive restart, which seed the hash
+        const uint64_t scan_key = hash_util::Hash64(scan_begin, size_t(indexCount) * scan_stride,
+                                                    (uint64_t(ib_type) << 1) | (primitive_restart_enable ? 1 : 0));
+        IndexScanResult scan;
+        bool cached = false;
+        {
+            ReadLockGuard guard{index_scan_cache_lock_};
+            auto it = index_scan_cache_.find(scan_key);
+            if (it != index_scan_cache_.end()) {
+                scan = it->second;
+                cached = true;
+            }
+        }
+        if (!cached) {
             if (ib_type == VK_INDEX_TYPE_UINT8_EXT) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-                primitive_restart_value = 0xFF;
+                scan = ScanIndicesArm(scan_begin, indexCount, primitive_restart_enable);
             } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFF;
+                scan = ScanIndicesArm(reinterpret_cast<const uint16_t*>(scan_begin), indexCount, primitive_restart_enable);
             } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFFFFFF;
+                scan = ScanIndicesArm(reinterpret_cast<const uint32_t*>(scan_begin), indexCount, primitive_restart_enable);
             }
-
-            max_index = std::max(max_index, scan_index);
-            min_index = std::min(min_index, scan_index);
-
-            if (!primitive_restart_enable || scan_index != primitive_restart_value) {
-                const bool in_cache = post_transform_cache.query_cache(scan_index);
-                // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
-                if (!in_cache) vertex_shade_count++;
+            WriteLockGuard guard{index_scan_cache_lock_};
+            if (index_scan_cache_.size() >= kMaxIndexScanCacheSize) {
+                index_scan_cache_.clear();
             }
+            index_scan_cache_[scan_key] = scan;
         }
+        const uint32_t min_index = scan.min_index;
+        const uint32_t max_index = scan.max_index;
 
         // if the max and min values were not set, then we either have no indices, or all primitive restarts, exit...
         // if the max and min are the same, then it implies all the indices are the same, then we don't need to do anything
@@ -292,40 +369,8 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
             return skip;
         }
 
-        // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
-        // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
-        const size_t refs_per_bucket = 64;
-        std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
-
-        const uint32_t n_indices = max_index - min_index + 1;
-        const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
-                                   ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
-
-        // there needs to be at least one bitset to store a set of indices smaller than n_buckets
-        vertex_reference_buckets.resize(std::max(1u, n_buckets));
-
-        // To avoid using too much memory, we run over the indices again.
-        // Knowing the size from the last scan allows us to record index usage with bitsets
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            if (ib_type == VK_INDEX_TYPE_UINT8_EXT) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-            }
-            // keep track of the set of all indices used to reference vertices in the draw call
-            size_t index_offset = scan_index - min_index;
-            size_t bitset_bucket_index = index_offset / refs_per_bucket;
-            uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
-            vertex_reference_buckets[bitset_bucket_index] |= used_indices;
-        }
-
-        uint32_t vertex_reference_count = 0;
-        for (const auto& bitset : vertex_reference_buckets) {
-            vertex_reference_count += static_cast<uint32_t>(bitset.count());
-        }
+        const uint32_t vertex_reference_count = scan.vertex_reference_count;
+        const uint32_t vertex_shade_count = scan.vertex_shade_count;
 
         // low index buffer utilization implies that: of the vertices available to the draw call, not all are utilized
         float utilization = static_cast<float>(vertex_reference_count) / static_cast<float>(max_index - min_index + 1);
@@ -656,7 +701,7 @@ void BestPractices::ValidateBoundDescriptorSets(bp_state::CommandBuffer& cb_stat
 
                 if (image_view) {
                     auto image_view_state = Get<vvl::ImageView>(image_view);
-                    QueueValidateImageView(cb_state.queue_submit_functions, command, image_view_state.get(),
+                    QueueValidateImageView(cb_state.queue_submit_image_uses, command, image_view_state.get(),
                                            IMAGE_SUBRESOURCE_USAGE_BP::DESCRIPTOR_ACCESS);
                 }
             }
@@ -134,15 +134,15 @@ bool BestPractices::PreCallValidateCreateImage(VkDevice device, const VkImageCre
     return skip;
 }
 
-void BestPractices::QueueValidateImageView(QueueCallbacks& funcs, Func command, vvl::ImageView* view,
+void BestPractices::QueueValidateImageView(QueuedImageUses& uses, Func command, vvl::ImageView* view,
                                            IMAGE_SUBRESOURCE_USAGE_BP usage) {
     if (view) {
         auto image_state = std::static_pointer_cast<bp_state::Image>(view->image_state);
-        QueueValidateImage(funcs, command, image_state, usage, view->normalized_subresource_range);
+        QueueValidateImage(uses, command, image_state, usage, view->normalized_subresource_range);
     }
 }
 
-void BestPractices::QueueValidateImage(QueueCallbacks& funcs, Func command, std::shared_ptr<bp_state::Image>& state,
+void BestPractices::QueueValidateImage(QueuedImageUses& uses, Func command, std::shared_ptr<bp_state::Image>& state,
                                        IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceRange& subresource_range) {
     // If we're viewing a 3D slice, ignore base array layer.
     // The entire 3D subresource is accessed as one atomic unit.
@@ -153,30 +153,36 @@ void BestPractices::QueueValidateImage(QueueCallbacks& funcs, Func command, std:
     const uint32_t max_levels = state->createInfo.mipLevels - subresource_range.baseMipLevel;
     const uint32_t mip_levels = std::min(state->createInfo.mipLevels, max_levels);
 
-    for (uint32_t layer = 0; layer < array_layers; layer++) {
-        for (uint32_t level = 0; level < mip_levels; level++) {
-            QueueValidateImage(funcs, command, state, usage, layer + base_array_layer, level + subresource_range.baseMipLevel);
-        }
-    }
+    uses.emplace_back(bp_state::QueuedImageUse{state, command, bp_state::QueuedImageUse::Type::Access, usage, base_array_layer,
+                                               array_layers, subresource_range.baseMipLevel, mip_levels});
 }
 
-void BestPractices::QueueValidateImage(QueueCallbacks& funcs, Func command, std::shared_ptr<bp_state::Image>& state,
+void BestPractices::QueueValidateImage(QueuedImageUses& uses, Func command, std::shared_ptr<bp_state::Image>& state,
                                        IMAGE_SUBRESOURCE_USAGE_BP usage, const VkImageSubresourceLayers& subresource_layers) {
     const uint32_t max_layers = state->createInfo.arrayLayers - subresource_layers.baseArrayLayer;
     const uint32_t array_layers = std::min(subresource_layers.layerCount, max_layers);
 
-    for (uint32_t layer = 0; layer < array_layers; layer++) {
-        QueueValidateImage(funcs, command, state, usage, layer + subresource_layers.baseArrayLayer, subresource_layers.mipLevel);
-    }
+    uses.emplace_back(bp_state::QueuedImageUse{state, command, bp_state::QueuedImageUse::Type::Access, usage,
+                                               subresource_layers.baseArrayLayer, array_layers, subresource_layers.mipLevel, 1});
 }
 
-void BestPractices::QueueValidateImage(QueueCallbacks& funcs, Func command, std::shared_ptr<bp_state::Image>& state,
-                                       IMAGE_SUBRESOURCE_USAGE_BP usage, uint32_t array_layer, uint32_t mip_level) {
-    funcs.push_back([this, command, state, usage, array_layer, mip_level](const ValidationStateTracker& vst, const vvl::Queue& qs,
-                                                                          const vvl::CommandBuffer& cbs) -> bool {
-        ValidateImageInQueue(qs, cbs, command, *state, usage, array_layer, mip_level);
-        return false;
-    });
+void BestPractices::ValidateQueuedImageUses(const vvl::Queue& qs, const bp_state::CommandBuffer& cbs) {
+    for (const auto& use : cbs.queue_submit_image_uses) {
+        auto& image = *use.image;
+        for (uint32_t layer = use.base_array_layer; layer < use.base_array_layer + use.layer_count; layer++) {
+            for (uint32_t level = use.base_mip_level; level < use.base_mip_level + use.level_count; level++) {
+                switch (use.type) {
+                    case bp_state::QueuedImageUse::Type::Access:
+                        ValidateImageInQueue(qs, cbs, use.command, image, use.usage, layer, level);
+                        break;
+                    case bp_state::QueuedImageUse::Type::QueueFamilyAcquire:
+                        // Update queue family index without changing usage, signifying a correct queue family transfer
+                        image.UpdateUsage(layer, level, image.GetUsageType(layer, level), qs.queueFamilyIndex);
+                        break;
+                }
+            }
+        }
+    }
 }
 
 void BestPractices::ValidateImageInQueueArmImg(Func command, const bp_state::Image& image, IMAGE_SUBRESOURCE_USAGE_BP last_usage,
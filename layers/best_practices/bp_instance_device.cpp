@@ -221,6 +221,18 @@ bool BestPractices::PreCallValidateCreateDevice(VkPhysicalDevice physicalDevice,
 }
 
 // Common function to handle validation for GetPhysicalDeviceQueueFamilyProperties & 2KHR version
+void BestPractices::CreateDevice(const VkDeviceCreateInfo* pCreateInfo) {
+    StateTracker::CreateDevice(pCreateInfo);
+
+    BPVendorFlags enabled_vendors = 0;
+    for (const BPVendorFlags vendor : {kBPVendorArm, kBPVendorAMD, kBPVendorIMG, kBPVendorNVIDIA}) {
+        if (VendorCheckEnabled(vendor)) {
+            enabled_vendors |= vendor;
+        }
+    }
+    record_cmd_draw_type_vendors_ = GetRecordCmdDrawTypeFn(enabled_vendors);
+}
+
 bool BestPractices::ValidateCommonGetPhysicalDeviceQueueFamilyProperties(const vvl::PhysicalDevice* bp_pd_state,
                                                                          uint32_t requested_queue_family_property_count,
                                                                          const CALL_STATE call_state, const Location& loc) const {
@@ -359,12 +371,32 @@ void BestPractices::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount
         const auto& submit_info = pSubmits[submit];
         for (uint32_t cb_index = 0; cb_index < submit_info.commandBufferCount; cb_index++) {
             auto cb = GetWrite<bp_state::CommandBuffer>(submit_info.pCommandBuffers[cb_index]);
-            for (auto& func : cb->queue_submit_functions) {
-                func(*this, *queue_state, *cb);
-            }
+            ValidateQueuedImageUses(*queue_state, *cb);
             cb->num_submits++;
         }
     }
+
+    for (uint32_t submit = 0; submit < submitCount; submit++) {
+        if (CheckFrameBoundary(pSubmits[submit].pNext, record_obj.location)) break;
+    }
+}
+
+void BestPractices::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence,
+                                              const RecordObject& record_obj) {
+    ValidationStateTracker::PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+
+    for (uint32_t submit = 0; submit < submitCount; submit++) {
+        if (CheckFrameBoundary(pSubmits[submit].pNext, record_obj.location)) break;
+    }
+}
+
+void BestPractices::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
+                                               const RecordObject& record_obj) {
+    // The messages of the last frame
+    if (enabled[best_practices_frame_summary]) {
+        ReportFrameSummary(record_obj.location);
+    }
+    ValidationStateTracker::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 }
 
 bool BestPractices::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
@@ -207,8 +207,8 @@ bool BestPractices::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPi
     return skip;
 }
 
-static std::vector<bp_state::AttachmentInfo> GetAttachmentAccess(bp_state::Pipeline& pipe_state) {
-    std::vector<bp_state::AttachmentInfo> result;
+static bp_state::AttachmentAspects GetAttachmentAccess(bp_state::Pipeline& pipe_state) {
+    bp_state::AttachmentAspects result;
     auto rp = pipe_state.RenderPassState();
     if (!rp || rp->UsesDynamicRendering()) {
         return result;
@@ -225,7 +225,7 @@ static std::vector<bp_state::AttachmentInfo> GetAttachmentAccess(bp_state::Pipel
             if (create_info.pColorBlendState->pAttachments[j].colorWriteMask != 0) {
                 uint32_t attachment = subpass.pColorAttachments[j].attachment;
                 if (attachment != VK_ATTACHMENT_UNUSED) {
-                    result.push_back({attachment, VK_IMAGE_ASPECT_COLOR_BIT});
+                    result.Touch(attachment, VK_IMAGE_ASPECT_COLOR_BIT);
                 }
             }
         }
@@ -243,7 +243,7 @@ static std::vector<bp_state::AttachmentInfo> GetAttachmentAccess(bp_state::Pipel
             if (create_info.pDepthStencilState->stencilTestEnable) {
                 aspects |= VK_IMAGE_ASPECT_STENCIL_BIT;
             }
-            result.push_back({attachment, aspects});
+            result.Touch(attachment, aspects);
         }
     }
     return result;
@@ -478,7 +478,9 @@ void BestPractices::PostCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer,
     StateTracker::PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, record_obj);
 
     // AMD best practice
-    PipelineUsedInFrame(pipeline);
+    if (VendorCheckEnabled(kBPVendorAMD) || VendorCheckEnabled(kBPVendorNVIDIA)) {
+        PipelineUsedInFrame(pipeline);
+    }
 
     if (pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS) {
         auto pipeline_state = Get<bp_state::Pipeline>(pipeline);
@@ -290,10 +290,10 @@ void BestPractices::PreCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer,
     auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
     if (cb_state) {
         // Add Deferred Queue
-        cb_state->queue_submit_functions.insert(cb_state->queue_submit_functions.end(),
-                                                cb_state->queue_submit_functions_after_render_pass.begin(),
-                                                cb_state->queue_submit_functions_after_render_pass.end());
-        cb_state->queue_submit_functions_after_render_pass.clear();
+        cb_state->queue_submit_image_uses.insert(cb_state->queue_submit_image_uses.end(),
+                                                 cb_state->queue_submit_image_uses_after_render_pass.begin(),
+                                                 cb_state->queue_submit_image_uses_after_render_pass.end());
+        cb_state->queue_submit_image_uses_after_render_pass.clear();
     }
 }
 
@@ -305,10 +305,10 @@ void BestPractices::PreCallRecordCmdEndRenderPass2(VkCommandBuffer commandBuffer
     auto cb_state = GetWrite<bp_state::CommandBuffer>(commandBuffer);
     if (cb_state) {
         // Add Deferred Queue
-        cb_state->queue_submit_functions.insert(cb_state->queue_submit_functions.end(),
-                                                cb_state->queue_submit_functions_after_render_pass.begin(),
-                                                cb_state->queue_submit_functions_after_render_pass.end());
-        cb_state->queue_submit_functions_after_render_pass.clear();
+        cb_state->queue_submit_image_uses.insert(cb_state->queue_submit_image_uses.end(),
+                                                 cb_state->queue_submit_image_uses_after_render_pass.begin(),
+                                                 cb_state->queue_submit_image_uses_after_render_pass.end());
+        cb_state->queue_submit_image_uses_after_render_pass.clear();
     }
 }
 
@@ -437,7 +437,7 @@ void BestPractices::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, cons
                 image_view = Get<vvl::ImageView>(framebuffer->createInfo.pAttachments[att]);
             }
 
-            QueueValidateImageView(cb->queue_submit_functions, Func::vkCmdBeginRenderPass, image_view.get(), usage);
+            QueueValidateImageView(cb->queue_submit_image_uses, Func::vkCmdBeginRenderPass, image_view.get(), usage);
         }
 
         // Check store ops
@@ -474,7 +474,8 @@ void BestPractices::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, cons
                 image_view = Get<vvl::ImageView>(framebuffer->createInfo.pAttachments[att]);
             }
 
-            QueueValidateImageView(cb->queue_submit_functions_after_render_pass, Func::vkCmdEndRenderPass, image_view.get(), usage);
+            QueueValidateImageView(cb->queue_submit_image_uses_after_render_pass, Func::vkCmdEndRenderPass, image_view.get(),
+                                   usage);
         }
     }
 }
@@ -840,12 +841,7 @@ bool BestPractices::ValidateCmdEndRenderPass(VkCommandBuffer commandBuffer, cons
                 continue;
             }
 
-            auto itr = std::find_if(render_pass_state.touchesAttachments.begin(), render_pass_state.touchesAttachments.end(),
-                                    [i](const bp_state::AttachmentInfo& info) { return info.framebufferAttachment == i; });
-            uint32_t untouched_aspects = bandwidth_aspects;
-            if (itr != render_pass_state.touchesAttachments.end()) {
-                untouched_aspects &= ~itr->aspects;
-            }
+            const uint32_t untouched_aspects = bandwidth_aspects & ~render_pass_state.touchesAttachments.Get(i);
 
             if (untouched_aspects) {
                 skip |= LogPerformanceWarning(
@@ -865,15 +861,7 @@ bool BestPractices::ValidateCmdEndRenderPass(VkCommandBuffer commandBuffer, cons
 void BestPractices::RecordAttachmentAccess(bp_state::CommandBuffer& cb_state, uint32_t fb_attachment, VkImageAspectFlags aspects) {
     auto& rp_state = cb_state.render_pass_state;
     // Called when we have a partial clear attachment, or a normal draw call which accesses an attachment.
-    auto itr =
-        std::find_if(rp_state.touchesAttachments.begin(), rp_state.touchesAttachments.end(),
-                     [fb_attachment](const bp_state::AttachmentInfo& info) { return info.framebufferAttachment == fb_attachment; });
-
-    if (itr != rp_state.touchesAttachments.end()) {
-        itr->aspects |= aspects;
-    } else {
-        rp_state.touchesAttachments.push_back({fb_attachment, aspects});
-    }
+    rp_state.touchesAttachments.Touch(fb_attachment, aspects);
 }
 
 void BestPractices::RecordAttachmentClearAttachments(bp_state::CommandBuffer& cmd_state, uint32_t fb_attachment,
@@ -882,17 +870,7 @@ void BestPractices::RecordAttachmentClearAttachments(bp_state::CommandBuffer& cm
     auto& rp_state = cmd_state.render_pass_state;
     // If we observe a full clear before any other access to a frame buffer attachment,
     // we have candidate for redundant clear attachments.
-    auto itr =
-        std::find_if(rp_state.touchesAttachments.begin(), rp_state.touchesAttachments.end(),
-                     [fb_attachment](const bp_state::AttachmentInfo& info) { return info.framebufferAttachment == fb_attachment; });
-
-    uint32_t new_aspects = aspects;
-    if (itr != rp_state.touchesAttachments.end()) {
-        new_aspects = aspects & ~itr->aspects;
-        itr->aspects |= aspects;
-    } else {
-        rp_state.touchesAttachments.push_back({fb_attachment, aspects});
-    }
+    const uint32_t new_aspects = rp_state.touchesAttachments.Touch(fb_attachment, aspects);
 
     if (new_aspects == 0) {
         return;
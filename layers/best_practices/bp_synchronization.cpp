@@ -265,6 +265,9 @@ bool BestPractices::PreCallValidateCmdPipelineBarrier(
     uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
     const VkImageMemoryBarrier* pImageMemoryBarriers, const ErrorObject& error_obj) const {
     bool skip = false;
+    if (!MessagesEnabled(kWarningBit | kPerformanceWarningBit)) {
+        return skip;
+    }
 
     skip |= CheckPipelineStageFlags(error_obj.location.dot(Field::srcStageMask), srcStageMask);
     skip |= CheckPipelineStageFlags(error_obj.location.dot(Field::dstStageMask), dstStageMask);
@@ -338,6 +341,9 @@ bool BestPractices::PreCallValidateCmdPipelineBarrier2KHR(VkCommandBuffer comman
 bool BestPractices::PreCallValidateCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo,
                                                        const ErrorObject& error_obj) const {
     bool skip = false;
+    if (!MessagesEnabled(kWarningBit | kPerformanceWarningBit)) {
+        return skip;
+    }
 
     const Location dep_info_loc = error_obj.location.dot(Field::pDependencyInfo);
     skip |= CheckDependencyInfo(dep_info_loc, *pDependencyInfo);
@@ -367,22 +373,6 @@ bool BestPractices::ValidateCmdPipelineBarrierImageBarrier(VkCommandBuffer comma
     return skip;
 }
 
-template <typename Func>
-static void ForEachSubresource(const vvl::Image& image, const VkImageSubresourceRange& range, Func&& func) {
-    const uint32_t layerCount =
-        (range.layerCount == VK_REMAINING_ARRAY_LAYERS) ? (image.full_range.layerCount - range.baseArrayLayer) : range.layerCount;
-    const uint32_t levelCount =
-        (range.levelCount == VK_REMAINING_MIP_LEVELS) ? (image.full_range.levelCount - range.baseMipLevel) : range.levelCount;
-
-    for (uint32_t i = 0; i < layerCount; ++i) {
-        const uint32_t layer = range.baseArrayLayer + i;
-        for (uint32_t j = 0; j < levelCount; ++j) {
-            const uint32_t level = range.baseMipLevel + j;
-            func(layer, level);
-        }
-    }
-}
-
 template <typename ImageMemoryBarrier>
 void BestPractices::RecordCmdPipelineBarrierImageBarrier(VkCommandBuffer commandBuffer, const ImageMemoryBarrier& barrier) {
     auto cb_state = Get<bp_state::CommandBuffer>(commandBuffer);
@@ -392,16 +382,11 @@ void BestPractices::RecordCmdPipelineBarrierImageBarrier(VkCommandBuffer command
     if (barrier.srcQueueFamilyIndex != barrier.dstQueueFamilyIndex &&
         barrier.dstQueueFamilyIndex == cb_state->command_pool->queueFamilyIndex) {
         auto image = Get<bp_state::Image>(barrier.image);
-        auto subresource_range = barrier.subresourceRange;
-        cb_state->queue_submit_functions.push_back([image, subresource_range](const ValidationStateTracker& vst,
-                                                                              const vvl::Queue& qs,
-                                                                              const vvl::CommandBuffer& cbs) -> bool {
-            ForEachSubresource(*image, subresource_range, [&](uint32_t layer, uint32_t level) {
-                // Update queue family index without changing usage, signifying a correct queue family transfer
-                image->UpdateUsage(layer, level, image->GetUsageType(layer, level), qs.queueFamilyIndex);
-            });
-            return false;
-        });
+        const VkImageSubresourceRange range = image->NormalizeSubresourceRange(barrier.subresourceRange);
+        cb_state->queue_submit_image_uses.emplace_back(
+            bp_state::QueuedImageUse{image, Func::Empty, bp_state::QueuedImageUse::Type::QueueFamilyAcquire,
+                                     IMAGE_SUBRESOURCE_USAGE_BP::UNDEFINED, range.baseArrayLayer, range.layerCount,
+                                     range.baseMipLevel, range.levelCount});
     }
 
     if (VendorCheckEnabled(kBPVendorNVIDIA)) {
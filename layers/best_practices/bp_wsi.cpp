@@ -200,7 +200,11 @@ void BestPractices::ManualPostCallRecordQueuePresentKHR(VkQueue queue, const VkP
     // end-of-frame cleanup
     num_queue_submissions_ = 0;
     num_barriers_objects_ = 0;
-    ClearPipelinesUsedInFrame();
+    MergeFrameThreadStates(record_obj.location);
+
+    if (enabled[best_practices_frame_summary]) {
+        ReportFrameSummary(record_obj.location);
+    }
 }
 
 bool BestPractices::PreCallValidateGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface,
@@ -0,0 +1,117 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace vvl {
+
+// Pointer sized value holder whose copies share one immutable T until one of them is modified.
+//
+// Meant for members of objects that are copied far more often than they change, such as the per range access state of
+// sync validation, which is duplicated by every range split and every copy of an access context. An empty holder
+// allocates nothing and reads as a default constructed T.
+//
+// Copies may be released from different threads, but a single holder is not thread safe, the same as a plain T.
+template <typename T>
+class CopyOnWrite {
+  public:
+    CopyOnWrite() = default;
+    CopyOnWrite(const CopyOnWrite &other) : node_(other.node_) { Acquire(); }
+    CopyOnWrite(CopyOnWrite &&other) noexcept : node_(std::exchange(other.node_, nullptr)) {}
+    ~CopyOnWrite() { Release(); }
+
+    CopyOnWrite &operator=(const CopyOnWrite &other) {
+        if (node_ != other.node_) {
+            Release();
+            node_ = other.node_;
+            Acquire();
+        }
+        return *this;
+    }
+    CopyOnWrite &operator=(CopyOnWrite &&other) noexcept {
+        if (this != &other) {
+            Release();
+            node_ = std::exchange(other.node_, nullptr);
+        }
+        return *this;
+    }
+    CopyOnWrite &operator=(T &&value) {
+        if (IsUnique()) {
+            node_->value = std::move(value);
+        } else {
+            Release();
+            node_ = new Node(std::move(value));
+        }
+        return *this;
+    }
+
+    const T &operator*() const { return node_ ? node_->value : Empty(); }
+    const T *operator->() const { return &**this; }
+
+    // Writable access, detaching from the other holders first if needed
+    T &Mutable() {
+        if (!node_) {
+            node_ = new Node(T());
+        } else if (!IsUnique()) {
+            Node *copy = new Node(node_->value);
+            Release();
+            node_ = copy;
+        }
+        return node_->value;
+    }
+
+    void Clear() {
+        Release();
+        node_ = nullptr;
+    }
+
+    // True when both hold the very same storage, so the values are equal without comparing them
+    bool SharesWith(const CopyOnWrite &other) const { return node_ == other.node_; }
+
+    bool operator==(const CopyOnWrite &other) const { return SharesWith(other) || (**this == *other); }
+    bool operator!=(const CopyOnWrite &other) const { return !(*this == other); }
+
+  private:
+    struct Node {
+        explicit Node(T &&v) : value(std::move(v)) {}
+        explicit Node(const T &v) : value(v) {}
+        std::atomic<uint32_t> refs{1};
+        T value;
+    };
+
+    static const T &Empty() {
+        static const T empty{};
+        return empty;
+    }
+    // The acquire pairs with the release decrement of other holders, so their last reads are done before we write
+    bool IsUnique() const { return node_ && node_->refs.load(std::memory_order_acquire) == 1; }
+    void Acquire() {
+        if (node_) node_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    void Release() {
+        if (node_ && node_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete node_;
+        }
+    }
+
+    Node *node_ = nullptr;
+};
+
+}  // namespace vvl
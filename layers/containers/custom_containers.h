@@ -283,7 +283,7 @@ class small_vector {
     void emplace_back(Args &&...args) {
         assert(size_ < kMaxCapacity);
         reserve(size_ + 1);
-        new (GetWorkingStore() + size_) value_type(args...);
+        new (GetWorkingStore() + size_) value_type(std::forward<Args>(args)...);
         size_++;
     }
 
@@ -668,6 +668,36 @@ class small_container {
 
     typename inner_container_type::size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
 
+    iterator find(const Key &key) {
+        iterator it = end();
+        for (int i = 0; i < N; ++i) {
+            if (small_data_allocated[i] && helper.compare_equal(small_data[i], key)) {
+                it.index = i;
+                return it;
+            }
+        }
+        // check size() first to avoid hashing key unnecessarily.
+        if (inner_cont.size() > 0) {
+            it.it = inner_cont.find(key);
+        }
+        return it;
+    }
+
+    const_iterator find(const Key &key) const {
+        const_iterator it = end();
+        for (int i = 0; i < N; ++i) {
+            if (small_data_allocated[i] && helper.compare_equal(small_data[i], key)) {
+                it.index = i;
+                return it;
+            }
+        }
+        // check size() first to avoid hashing key unnecessarily.
+        if (inner_cont.size() > 0) {
+            it.it = inner_cont.find(key);
+        }
+        return it;
+    }
+
     std::pair<iterator, bool> insert(const value_type &value) {
         for (int i = 0; i < N; ++i) {
             if (small_data_allocated[i] && helper.compare_equal(small_data[i], value)) {
@@ -804,25 +834,6 @@ class small_unordered_map : public small_container<Key, typename vvl::unordered_
 template <typename Key, int N = 1>
 class small_unordered_set : public small_container<Key, Key, vvl::unordered_set<Key>, value_type_helper_set<Key>, N> {};
 
-// For the given data key, look up the layer_data instance from given layer_data_map
-template <typename DATA_T>
-DATA_T *GetLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
-    /* TODO: We probably should lock here, or have caller lock */
-    DATA_T *&got = layer_data_map[data_key];
-
-    if (got == nullptr) {
-        got = new DATA_T;
-    }
-
-    return got;
-}
-
-template <typename DATA_T>
-void FreeLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
-    delete layer_data_map[data_key];
-    layer_data_map.erase(data_key);
-}
-
 // For the given data key, look up the layer_data instance from given layer_data_map
 template <typename DATA_T>
 DATA_T *GetLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
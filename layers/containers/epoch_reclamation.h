@@ -0,0 +1,234 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// Epoch based reclamation for objects that readers access through a borrowed (non-owning) pointer.
+//
+// A reader announces the global epoch while it holds an EpochGuard. A writer that removes an object from a shared structure
+// hands its last reference to Retire() instead of dropping it, and the object is only released once every reader that could
+// still see it has left its guard. Readers never touch the object's reference count, which is the point: a hot shared_ptr
+// copy makes the refcount cache line bounce between every core looking up the same object.
+class EpochDomain {
+  public:
+    static EpochDomain &Get() {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    ~EpochDomain() { retired_.clear(); }
+
+    // Keeps object alive until all readers active at this point have left their EpochGuard
+    void Retire(std::shared_ptr<void> &&object) {
+        if (!object) {
+            return;
+        }
+        std::vector<std::shared_ptr<void>> released;
+        {
+            std::lock_guard<std::mutex> lock(retired_lock_);
+            const uint64_t epoch = global_epoch_.fetch_add(1, std::memory_order_seq_cst);
+            retired_.push_back({epoch, std::move(object)});
+            if (retired_.size() >= collect_threshold_) {
+                CollectLocked(released);
+                // Don't rescan on every retire while a long running reader holds things back
+                collect_threshold_ = std::max(kReclaimThreshold, retired_.size() * 2);
+            }
+        }
+        // Destructors run outside of retired_lock_, they may retire objects themselves
+    }
+
+    // Releases everything that is no longer reachable by any reader
+    void Reclaim() {
+        std::vector<std::shared_ptr<void>> released;
+        std::lock_guard<std::mutex> lock(retired_lock_);
+        CollectLocked(released);
+    }
+
+    // Waits for the readers that are currently active, then releases everything retired so far, including what the
+    // released destructors retire in turn. Used where the owner of the objects is going away (e.g. vkDestroyDevice).
+    // If the calling thread is itself inside an EpochGuard it cannot wait for itself, so this only reclaims.
+    void Synchronize() {
+        if (LocalRecord().depth != 0) {
+            Reclaim();
+            return;
+        }
+        for (;;) {
+            uint64_t target;
+            {
+                std::lock_guard<std::mutex> lock(retired_lock_);
+                if (retired_.empty()) {
+                    return;
+                }
+                target = global_epoch_.fetch_add(1, std::memory_order_seq_cst);
+            }
+            while (MinActiveEpoch() <= target) {
+                std::this_thread::yield();
+            }
+            Reclaim();
+        }
+    }
+
+    size_t RetiredCount() const {
+        std::lock_guard<std::mutex> lock(retired_lock_);
+        return retired_.size();
+    }
+
+  private:
+    friend class EpochGuard;
+    static constexpr size_t kReclaimThreshold = 64;
+    static constexpr uint64_t kInactive = 0;
+
+    struct alignas(64) Record {
+        std::atomic<uint64_t> epoch{kInactive};
+        std::atomic<bool> in_use{false};
+    };
+
+    struct Retired {
+        uint64_t epoch;
+        std::shared_ptr<void> object;
+    };
+
+    // Thread local handle on a Record, returned to the domain when the thread exits
+    struct ThreadRecord {
+        Record *record = nullptr;
+        uint32_t depth = 0;
+        ~ThreadRecord() {
+            if (record) {
+                record->epoch.store(kInactive, std::memory_order_release);
+                record->in_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    static ThreadRecord &LocalRecord() {
+        thread_local ThreadRecord local;
+        if (!local.record) {
+            local.record = Get().AcquireRecord();
+        }
+        return local;
+    }
+
+    Record *AcquireRecord() {
+        std::lock_guard<std::mutex> lock(records_lock_);
+        for (auto &record : records_) {
+            bool expected = false;
+            if (record->in_use.compare_exchange_strong(expected, true)) {
+                return record.get();
+            }
+        }
+        records_.emplace_back(std::make_unique<Record>());
+        records_.back()->in_use.store(true, std::memory_order_relaxed);
+        return records_.back().get();
+    }
+
+    void Enter(Record &record) {
+        record.epoch.store(global_epoch_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        // The announcement must be visible before any borrowed pointer is read
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+    void Exit(Record &record) { record.epoch.store(kInactive, std::memory_order_release); }
+
+    uint64_t MinActiveEpoch() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        uint64_t min_epoch = UINT64_MAX;
+        std::lock_guard<std::mutex> lock(records_lock_);
+        for (const auto &record : records_) {
+            const uint64_t epoch = record->epoch.load(std::memory_order_acquire);
+            if (epoch != kInactive && epoch < min_epoch) {
+                min_epoch = epoch;
+            }
+        }
+        return min_epoch;
+    }
+
+    // Caller holds retired_lock_. Objects are moved to released so they are destroyed after the lock is dropped.
+    void CollectLocked(std::vector<std::shared_ptr<void>> &released) {
+        const uint64_t min_epoch = MinActiveEpoch();
+        auto keep = retired_.begin();
+        for (auto it = retired_.begin(); it != retired_.end(); ++it) {
+            if (it->epoch < min_epoch) {
+                released.emplace_back(std::move(it->object));
+            } else {
+                *keep++ = std::move(*it);
+            }
+        }
+        retired_.erase(keep, retired_.end());
+    }
+
+    // Starts at 1 so that kInactive is never a valid announcement
+    std::atomic<uint64_t> global_epoch_{1};
+    mutable std::mutex retired_lock_;
+    std::vector<Retired> retired_;
+    size_t collect_threshold_ = kReclaimThreshold;
+    std::mutex records_lock_;
+    std::vector<std::unique_ptr<Record>> records_;
+};
+
+// Marks the calling thread as a reader of borrowed pointers for its lifetime. Guards nest, only the outermost one announces.
+// A guard can be moved, but only within the thread that created it.
+class EpochGuard {
+  public:
+    EpochGuard() : local_(&EpochDomain::LocalRecord()) {
+        if (local_->depth++ == 0) {
+            EpochDomain::Get().Enter(*local_->record);
+        }
+    }
+    ~EpochGuard() {
+        if (local_ && --local_->depth == 0) {
+            EpochDomain::Get().Exit(*local_->record);
+        }
+    }
+    EpochGuard(EpochGuard &&other) noexcept : local_(std::exchange(other.local_, nullptr)) {}
+    EpochGuard(const EpochGuard &) = delete;
+    EpochGuard &operator=(const EpochGuard &) = delete;
+    EpochGuard &operator=(EpochGuard &&) = delete;
+
+  private:
+    EpochDomain::ThreadRecord *local_;
+};
+
+// Non-owning pointer that stays valid while it is alive, because it holds the EpochGuard that was taken before the lookup.
+// It must not outlive the current call or be handed to another thread, take a shared_ptr for that.
+template <typename T>
+class Borrowed {
+  public:
+    Borrowed(EpochGuard &&guard, T *ptr) : guard_(std::move(guard)), ptr_(ptr) {}
+
+    T *get() const { return ptr_; }
+    T *operator->() const { return ptr_; }
+    T &operator*() const { return *ptr_; }
+    explicit operator bool() const { return ptr_ != nullptr; }
+    bool operator==(std::nullptr_t) const { return ptr_ == nullptr; }
+    bool operator!=(std::nullptr_t) const { return ptr_ != nullptr; }
+
+  private:
+    EpochGuard guard_;
+    T *ptr_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,415 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// Concurrent uint64_t -> uint64_t map specialized for handle wrapping (unique id -> driver handle).
+//
+// The workload is almost entirely lookups (every Unwrap()), with inserts on object creation and erases on
+// destruction. Each shard is an open-addressing table of atomic slots:
+//   - find() never takes a lock. It probes the current table and validates against the shard generation,
+//     retrying only if a rehash recycled the table it was reading (seqlock style).
+//   - insert/erase take a per-shard mutex, so writers on different shards never contend.
+//   - Tables replaced by a rehash are kept and recycled by later rehashes instead of being freed, so a
+//     reader can never touch freed memory. Growth is geometric, so this costs at most ~2x the live table size.
+//
+// Key 0 is reserved (VK_NULL_HANDLE) and so is ~0 (tombstone).
+//
+// Each entry also has a tag, 0 until set_tag() is called, for other users of the handle to keep a word next to it
+// (ObjectLifetimes records which of its maps tracks the object) and share the lookup.
+//
+// The interface matches the subset of vl_concurrent_unordered_map used by the chassis and thread safety (find/end/pop/
+// erase/insert/insert_or_assign/contains), and GetStats() reports occupancy and probe lengths for tuning SHARDS_LOG2.
+template <int SHARDS_LOG2 = 4>
+class HandleTranslationMap {
+  public:
+    static constexpr uint64_t kEmptyKey = 0;
+    static constexpr uint64_t kTombstoneKey = ~uint64_t(0);
+
+    class FindResult {
+      public:
+        FindResult(bool a, uint64_t b) : result(a, b) {}
+
+        // == and != only support comparing against end()
+        bool operator==(const FindResult &other) const { return !result.first && !other.result.first; }
+        bool operator!=(const FindResult &other) const { return !(*this == other); }
+
+        std::pair<bool, uint64_t> *operator->() { return &result; }
+        const std::pair<bool, uint64_t> *operator->() const { return &result; }
+
+      private:
+        std::pair<bool, uint64_t> result;
+    };
+
+    struct Stats {
+        uint32_t shard_count = 0;
+        size_t size = 0;
+        size_t capacity = 0;
+        size_t tombstones = 0;
+        size_t max_probe_length = 0;
+        size_t retained_table_bytes = 0;  // memory held by recycled (non-current) tables
+        uint64_t rehashes = 0;
+    };
+
+    HandleTranslationMap() = default;
+    HandleTranslationMap(const HandleTranslationMap &) = delete;
+    HandleTranslationMap &operator=(const HandleTranslationMap &) = delete;
+
+    FindResult end() const { return FindResult(false, 0); }
+    FindResult cend() const { return end(); }
+
+    FindResult find(uint64_t key) const {
+        const uint64_t mixed = Mix(key);
+        const Shard &shard = shards_[ShardIndex(mixed)];
+        for (;;) {
+            const uint32_t generation = shard.generation.load(std::memory_order_acquire);
+            const Table *table = shard.table.load(std::memory_order_acquire);
+            if (!table) {
+                return end();
+            }
+            uint64_t value = 0;
+            const bool found = table->Find(key, mixed, value);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (shard.generation.load(std::memory_order_relaxed) == generation) {
+                return FindResult(found, value);
+            }
+        }
+    }
+
+    bool contains(uint64_t key) const { return find(key) != end(); }
+
+    // 0 if the key isn't there or its tag was never set
+    uint64_t find_tag(uint64_t key) const {
+        const uint64_t mixed = Mix(key);
+        const Shard &shard = shards_[ShardIndex(mixed)];
+        for (;;) {
+            const uint32_t generation = shard.generation.load(std::memory_order_acquire);
+            const Table *table = shard.table.load(std::memory_order_acquire);
+            if (!table) {
+                return 0;
+            }
+            uint64_t tag = 0;
+            table->FindTag(key, mixed, tag);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (shard.generation.load(std::memory_order_relaxed) == generation) {
+                return tag;
+            }
+        }
+    }
+
+    // Returns false if the key isn't there
+    bool set_tag(uint64_t key, uint64_t tag) {
+        const uint64_t mixed = Mix(key);
+        Shard &shard = shards_[ShardIndex(mixed)];
+        std::lock_guard<std::mutex> lock(shard.write_lock);
+
+        Table *table = shard.table.load(std::memory_order_relaxed);
+        Slot *slot = table ? table->FindSlot(key, mixed) : nullptr;
+        if (!slot) {
+            return false;
+        }
+        slot->tag.store(tag, std::memory_order_release);
+        return true;
+    }
+
+    void insert_or_assign(uint64_t key, uint64_t value) { Insert(key, value, true); }
+
+    // Leaves the value alone if the key is already there, returns false in that case
+    bool insert(uint64_t key, uint64_t value) { return Insert(key, value, false); }
+
+    size_t erase(uint64_t key) { return pop(key) != end() ? 1 : 0; }
+
+    // Same as erase() of each key, but only takes the lock of each shard once. Reorders keys.
+    size_t erase(std::vector<uint64_t> &keys) {
+        std::sort(keys.begin(), keys.end(), [](uint64_t a, uint64_t b) { return ShardIndex(Mix(a)) < ShardIndex(Mix(b)); });
+        size_t erased = 0;
+        for (size_t begin = 0; begin < keys.size();) {
+            const uint32_t shard_index = ShardIndex(Mix(keys[begin]));
+            Shard &shard = shards_[shard_index];
+            std::lock_guard<std::mutex> lock(shard.write_lock);
+            Table *table = shard.table.load(std::memory_order_relaxed);
+            size_t end = begin;
+            for (; end < keys.size() && ShardIndex(Mix(keys[end])) == shard_index; ++end) {
+                Slot *slot = table ? table->FindSlot(keys[end], Mix(keys[end])) : nullptr;
+                if (slot) {
+                    slot->key.store(kTombstoneKey, std::memory_order_release);
+                    shard.live--;
+                    erased++;
+                }
+            }
+            begin = end;
+        }
+        return erased;
+    }
+
+    FindResult pop(uint64_t key) {
+        const uint64_t mixed = Mix(key);
+        Shard &shard = shards_[ShardIndex(mixed)];
+        std::lock_guard<std::mutex> lock(shard.write_lock);
+
+        Table *table = shard.table.load(std::memory_order_relaxed);
+        Slot *slot = table ? table->FindSlot(key, mixed) : nullptr;
+        if (!slot) {
+            return end();
+        }
+        const uint64_t value = slot->value.load(std::memory_order_relaxed);
+        slot->key.store(kTombstoneKey, std::memory_order_release);
+        shard.live--;
+        return FindResult(true, value);
+    }
+
+    size_t size() const {
+        size_t result = 0;
+        for (const Shard &shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.write_lock);
+            result += shard.live;
+        }
+        return result;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    Stats GetStats() const {
+        Stats stats;
+        stats.shard_count = kShards;
+        for (const Shard &shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.write_lock);
+            stats.size += shard.live;
+            stats.tombstones += shard.used - shard.live;
+            stats.rehashes += shard.rehashes;
+            const Table *current = shard.table.load(std::memory_order_relaxed);
+            for (const auto &table : shard.tables) {
+                if (table.get() != current) {
+                    stats.retained_table_bytes += table->Capacity() * sizeof(Slot);
+                }
+            }
+            if (current) {
+                stats.capacity += current->Capacity();
+                stats.max_probe_length = std::max(stats.max_probe_length, current->MaxProbeLength());
+            }
+        }
+        return stats;
+    }
+
+  private:
+    static constexpr uint32_t kShards = 1u << SHARDS_LOG2;
+    static constexpr size_t kMinCapacity = 64;
+
+    struct Slot {
+        std::atomic<uint64_t> key{kEmptyKey};
+        std::atomic<uint64_t> value{0};
+        std::atomic<uint64_t> tag{0};
+    };
+
+    class Table {
+      public:
+        explicit Table(size_t capacity) : mask_(capacity - 1), slots_(new Slot[capacity]) { assert((capacity & mask_) == 0); }
+
+        size_t Capacity() const { return mask_ + 1; }
+
+        bool Find(uint64_t key, uint64_t mixed, uint64_t &value) const {
+            for (size_t i = Start(mixed), probes = 0; probes <= mask_; i = (i + 1) & mask_, ++probes) {
+                const uint64_t slot_key = slots_[i].key.load(std::memory_order_acquire);
+                if (slot_key == key) {
+                    value = slots_[i].value.load(std::memory_order_acquire);
+                    return true;
+                }
+                if (slot_key == kEmptyKey) {
+                    break;
+                }
+            }
+            return false;
+        }
+
+        void FindTag(uint64_t key, uint64_t mixed, uint64_t &tag) const {
+            for (size_t i = Start(mixed), probes = 0; probes <= mask_; i = (i + 1) & mask_, ++probes) {
+                const uint64_t slot_key = slots_[i].key.load(std::memory_order_acquire);
+                if (slot_key == key) {
+                    tag = slots_[i].tag.load(std::memory_order_acquire);
+                    return;
+                }
+                if (slot_key == kEmptyKey) {
+                    return;
+                }
+            }
+        }
+
+        // Writer side only (shard write_lock held)
+        Slot *FindSlot(uint64_t key, uint64_t mixed) {
+            for (size_t i = Start(mixed), probes = 0; probes <= mask_; i = (i + 1) & mask_, ++probes) {
+                const uint64_t slot_key = slots_[i].key.load(std::memory_order_relaxed);
+                if (slot_key == key) {
+                    return &slots_[i];
+                }
+                if (slot_key == kEmptyKey) {
+                    break;
+                }
+            }
+            return nullptr;
+        }
+
+        // Returns true if a never-used slot was consumed (as opposed to reusing a tombstone)
+        bool Insert(uint64_t key, uint64_t mixed, uint64_t value, uint64_t tag) {
+            for (size_t i = Start(mixed);; i = (i + 1) & mask_) {
+                const uint64_t slot_key = slots_[i].key.load(std::memory_order_relaxed);
+                if (slot_key == kEmptyKey || slot_key == kTombstoneKey) {
+                    // Publish the value before the key so a concurrent find() never sees a stale value
+                    slots_[i].value.store(value, std::memory_order_relaxed);
+                    slots_[i].tag.store(tag, std::memory_order_relaxed);
+                    slots_[i].key.store(key, std::memory_order_release);
+                    return slot_key == kEmptyKey;
+                }
+            }
+        }
+
+        void Reset() {
+            for (size_t i = 0; i <= mask_; ++i) {
+                slots_[i].key.store(kEmptyKey, std::memory_order_relaxed);
+                slots_[i].value.store(0, std::memory_order_relaxed);
+                slots_[i].tag.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        template <typename Fn>
+        void ForEachLive(Fn &&fn) const {
+            for (size_t i = 0; i <= mask_; ++i) {
+                const uint64_t slot_key = slots_[i].key.load(std::memory_order_relaxed);
+                if (slot_key != kEmptyKey && slot_key != kTombstoneKey) {
+                    fn(slot_key, slots_[i].value.load(std::memory_order_relaxed), slots_[i].tag.load(std::memory_order_relaxed));
+                }
+            }
+        }
+
+        size_t MaxProbeLength() const {
+            size_t result = 0;
+            for (size_t i = 0; i <= mask_; ++i) {
+                const uint64_t slot_key = slots_[i].key.load(std::memory_order_relaxed);
+                if (slot_key != kEmptyKey && slot_key != kTombstoneKey) {
+                    result = std::max(result, ((i - Start(Mix(slot_key))) & mask_) + 1);
+                }
+            }
+            return result;
+        }
+
+      private:
+        size_t Start(uint64_t mixed) const { return static_cast<size_t>(mixed >> 32) & mask_; }
+
+        const size_t mask_;
+        std::unique_ptr<Slot[]> slots_;
+    };
+
+    struct alignas(64) Shard {
+        mutable std::mutex write_lock;
+        std::atomic<uint32_t> generation{0};
+        std::atomic<Table *> table{nullptr};
+        // All tables ever allocated by this shard, including the current one. Never freed before the map,
+        // which is what makes lock-free readers safe.
+        std::vector<std::unique_ptr<Table>> tables;
+        size_t live = 0;  // keys present
+        size_t used = 0;  // slots that are not empty (live + tombstones)
+        uint64_t rehashes = 0;
+    };
+
+    // Fibonacci hashing: one multiply spreads the sequential unique ids over shards and slots.
+    static uint64_t Mix(uint64_t key) { return key * 0x9E3779B97F4A7C15ull; }
+    static uint32_t ShardIndex(uint64_t mixed) {
+        if constexpr (SHARDS_LOG2 == 0) {
+            return 0;
+        } else {
+            return static_cast<uint32_t>(mixed >> (64 - SHARDS_LOG2));
+        }
+    }
+
+    bool Insert(uint64_t key, uint64_t value, bool assign) {
+        assert(key != kEmptyKey && key != kTombstoneKey);
+        const uint64_t mixed = Mix(key);
+        Shard &shard = shards_[ShardIndex(mixed)];
+        std::lock_guard<std::mutex> lock(shard.write_lock);
+
+        Table *table = shard.table.load(std::memory_order_relaxed);
+        if (table) {
+            Slot *slot = table->FindSlot(key, mixed);
+            if (slot) {
+                if (assign) {
+                    slot->value.store(value, std::memory_order_release);
+                }
+                return false;
+            }
+        }
+        if (!table || (shard.used + 1) * 4 > table->Capacity() * 3) {
+            table = Rehash(shard);
+        }
+        if (table->Insert(key, mixed, value, 0)) {
+            shard.used++;
+        }
+        shard.live++;
+        return true;
+    }
+
+    // Caller holds shard.write_lock
+    Table *Rehash(Shard &shard) {
+        Table *old_table = shard.table.load(std::memory_order_relaxed);
+        size_t capacity = old_table ? old_table->Capacity() : kMinCapacity;
+        while ((shard.live + 1) * 2 > capacity) {
+            capacity *= 2;
+        }
+
+        Table *new_table = nullptr;
+        for (auto &table : shard.tables) {
+            if (table.get() != old_table && table->Capacity() == capacity) {
+                new_table = table.get();
+                break;
+            }
+        }
+        if (new_table) {
+            // Readers that may still be probing this recycled table from an earlier generation must retry
+            shard.generation.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            new_table->Reset();
+        } else {
+            shard.tables.emplace_back(std::make_unique<Table>(capacity));
+            new_table = shard.tables.back().get();
+        }
+
+        size_t used = 0;
+        if (old_table) {
+            old_table->ForEachLive([new_table, &used](uint64_t key, uint64_t value, uint64_t tag) {
+                new_table->Insert(key, Mix(key), value, tag);
+                used++;
+            });
+        }
+        shard.used = used;
+        shard.rehashes++;
+        shard.table.store(new_table, std::memory_order_release);
+        return new_table;
+    }
+
+    std::array<Shard, kShards> shards_;
+};
+
+}  // namespace vvl
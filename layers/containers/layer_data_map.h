@@ -0,0 +1,184 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include "utils/vk_layer_utils.h"
+
+namespace vvl {
+
+// The layer_data of each dispatch key, which is one per instance and one per device, looked up by every intercepted call.
+//
+// A fixed size open addressed table with atomic slots: lookups only load slots, so calls on different devices never take a
+// lock, and every slot has its own cache line so they don't share one either. Inserts and erases only happen when an instance
+// or a device is created or destroyed. They are serialized by a mutex, and go to a locked map once the table is full.
+// Erased slots become tombstones that the next insert reuses, so a slot that was never used ends every probe sequence.
+template <typename DATA_T, size_t N = 128>
+class LayerDataMap {
+    static_assert(N != 0 && (N & (N - 1)) == 0, "N must be a power of 2");
+
+  public:
+    LayerDataMap() = default;
+    LayerDataMap(const LayerDataMap &) = delete;
+    LayerDataMap &operator=(const LayerDataMap &) = delete;
+
+    DATA_T *Find(void *key) const {
+        size_t index = Hash(key);
+        for (size_t probe = 0; probe < N; ++probe, index = (index + 1) & (N - 1)) {
+            const void *slot_key = slots_[index].key.load(std::memory_order_acquire);
+            if (slot_key == key) {
+                return slots_[index].data.load(std::memory_order_relaxed);
+            }
+            if (slot_key == nullptr) {
+                return nullptr;  // the overflow is only used once no slot is empty
+            }
+        }
+        return FindOverflow(key);
+    }
+
+    // Creates the data of key the first time
+    DATA_T *GetOrCreate(void *key) {
+        if (DATA_T *data = Find(key)) {
+            return data;
+        }
+        std::lock_guard<std::mutex> guard(lock_);
+        // Look again now that no other insert can race, remembering the first slot that can be used
+        size_t free_index = N;
+        size_t index = Hash(key);
+        for (size_t probe = 0; probe < N; ++probe, index = (index + 1) & (N - 1)) {
+            const void *slot_key = slots_[index].key.load(std::memory_order_relaxed);
+            if (slot_key == key) {
+                return slots_[index].data.load(std::memory_order_relaxed);
+            }
+            if (slot_key == Tombstone() || slot_key == nullptr) {
+                if (free_index == N) {
+                    free_index = index;
+                }
+                if (slot_key == nullptr) {
+                    break;
+                }
+            }
+        }
+        auto overflow_it = overflow_.find(key);
+        if (overflow_it != overflow_.end()) {
+            return overflow_it->second;
+        }
+
+        DATA_T *data = new DATA_T;
+        if (free_index != N) {
+            // The data has to be visible before the key that makes lookups take it
+            slots_[free_index].data.store(data, std::memory_order_relaxed);
+            slots_[free_index].key.store(key, std::memory_order_release);
+        } else {
+            overflow_.emplace(key, data);
+            overflow_count_.fetch_add(1, std::memory_order_release);
+        }
+        return data;
+    }
+
+    // Also deletes the data
+    void Erase(void *key) {
+        std::lock_guard<std::mutex> guard(lock_);
+        size_t index = Hash(key);
+        for (size_t probe = 0; probe < N; ++probe, index = (index + 1) & (N - 1)) {
+            const void *slot_key = slots_[index].key.load(std::memory_order_relaxed);
+            if (slot_key == key) {
+                DATA_T *data = slots_[index].data.load(std::memory_order_relaxed);
+                slots_[index].key.store(Tombstone(), std::memory_order_release);
+                slots_[index].data.store(nullptr, std::memory_order_relaxed);
+                delete data;
+                return;
+            }
+            if (slot_key == nullptr) {
+                break;
+            }
+        }
+        auto overflow_it = overflow_.find(key);
+        if (overflow_it != overflow_.end()) {
+            delete overflow_it->second;
+            overflow_.erase(overflow_it);
+            overflow_count_.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    // Returns the first data pred is true for, or nullptr. Inserts and erases wait until it is done.
+    template <typename Pred>
+    DATA_T *FindIf(Pred &&pred) const {
+        std::lock_guard<std::mutex> guard(lock_);
+        for (const Slot &slot : slots_) {
+            const void *slot_key = slot.key.load(std::memory_order_relaxed);
+            if (slot_key != nullptr && slot_key != Tombstone()) {
+                DATA_T *data = slot.data.load(std::memory_order_relaxed);
+                if (pred(data)) {
+                    return data;
+                }
+            }
+        }
+        for (const auto &entry : overflow_) {
+            if (pred(entry.second)) {
+                return entry.second;
+            }
+        }
+        return nullptr;
+    }
+
+  private:
+    struct alignas(get_hardware_destructive_interference_size()) Slot {
+        std::atomic<void *> key{nullptr};
+        std::atomic<DATA_T *> data{nullptr};
+    };
+
+    // Dispatch keys are pointers to the loader's dispatch tables, so they are never 1
+    static void *Tombstone() { return reinterpret_cast<void *>(uintptr_t{1}); }
+
+    static size_t Hash(const void *key) {
+        // Fibonacci hashing, the low bits of a pointer are mostly alignment
+        const uint64_t value = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(value >> 32) & (N - 1);
+    }
+
+    DATA_T *FindOverflow(void *key) const {
+        if (overflow_count_.load(std::memory_order_acquire) == 0) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> guard(lock_);
+        auto it = overflow_.find(key);
+        return it != overflow_.end() ? it->second : nullptr;
+    }
+
+    Slot slots_[N];
+    mutable std::mutex lock_;
+    std::atomic<size_t> overflow_count_{0};
+    std::unordered_map<void *, DATA_T *> overflow_;
+};
+
+}  // namespace vvl
+
+template <typename DATA_T, size_t N>
+DATA_T *GetLayerDataPtr(void *data_key, vvl::LayerDataMap<DATA_T, N> &layer_data_map) {
+    return layer_data_map.GetOrCreate(data_key);
+}
+
+template <typename DATA_T, size_t N>
+void FreeLayerDataPtr(void *data_key, vvl::LayerDataMap<DATA_T, N> &layer_data_map) {
+    layer_data_map.Erase(data_key);
+}
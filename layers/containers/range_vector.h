@@ -21,12 +21,15 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <limits>
 #include <map>
+#include <new>
 #include <string>
 #include <sstream>
 #include <utility>
+#include <vector>
 #include <cstdint>
 #include "custom_containers.h"
 
@@ -1433,6 +1436,248 @@ class small_range_map {
     std::array<bool, N> in_use_;
 };
 
+// A sorted vector "ImplMap" for range_map, as a cache friendly alternative to std::map for range maps that are searched far
+// more often than they are modified, or that hold a few hundred entries at most (e.g. image layouts). Lookups are a binary
+// search over contiguous storage instead of a pointer chase through tree nodes.
+//
+// range_map and the algorithms built on it (infill_update_range, splice, cached_lower_bound_impl, ...) rely on std::map
+// iterator stability, i.e. that an iterator stays valid across insertion and erasure of *other* entries. A plain index into the
+// vector wouldn't, so iterators identify their entry by its range begin (unique, as ranges don't overlap) and cache the vector
+// position, which is only searched for again if the map was modified since. Like std::map, erasing an entry invalidates the
+// iterators to it.
+//
+// Insertion and erasure shift the following entries, so this is a poor fit for maps with many entries or large mapped values.
+template <typename RangeKey, typename T>
+class flat_range_map_impl {
+  public:
+    using mapped_type = T;
+    using key_type = RangeKey;
+    using value_type = std::pair<const key_type, mapped_type>;
+    using index_type = typename key_type::index_type;
+    using size_type = size_t;
+
+  private:
+    // value_type isn't assignable (const key), so entries are (re)constructed in place when the vector shifts them
+    class Entry {
+      public:
+        template <typename Value>
+        Entry(std::in_place_t, Value &&value) {
+            new (data_) value_type(std::forward<Value>(value));
+        }
+        Entry(const Entry &other) { new (data_) value_type(other.get()); }
+        Entry(Entry &&other) noexcept { new (data_) value_type(std::move(other.get())); }
+        Entry &operator=(const Entry &other) {
+            if (this != &other) {
+                get().~value_type();
+                new (data_) value_type(other.get());
+            }
+            return *this;
+        }
+        Entry &operator=(Entry &&other) noexcept {
+            if (this != &other) {
+                get().~value_type();
+                new (data_) value_type(std::move(other.get()));
+            }
+            return *this;
+        }
+        ~Entry() { get().~value_type(); }
+
+        value_type &get() { return *std::launder(reinterpret_cast<value_type *>(data_)); }
+        const value_type &get() const { return *std::launder(reinterpret_cast<const value_type *>(data_)); }
+
+      private:
+        alignas(value_type) unsigned char data_[sizeof(value_type)];
+    };
+    using Storage = std::vector<Entry>;
+
+  public:
+    template <typename Map_, typename Value_>
+    class IteratorImpl {
+      public:
+        using Map = Map_;
+        using Value = Value_;
+        friend flat_range_map_impl;
+
+        Value *operator->() const { return &map_->entries_[resolve()].get(); }
+        Value &operator*() const { return map_->entries_[resolve()].get(); }
+        IteratorImpl &operator++() {
+            RANGE_ASSERT(!at_end_);
+            set_pos(resolve() + 1);
+            return *this;
+        }
+        IteratorImpl &operator--() {
+            const size_t pos = at_end_ ? map_->entries_.size() : resolve();
+            RANGE_ASSERT(pos > 0);
+            set_pos(pos - 1);
+            return *this;
+        }
+        bool operator==(const IteratorImpl &other) const {
+            if (at_end_ || other.at_end_) {
+                return at_end_ == other.at_end_;  // all ends are equal
+            }
+            return (map_ == other.map_) && (begin_ == other.begin_);
+        }
+        bool operator!=(const IteratorImpl &other) const { return !(*this == other); }
+
+        // At end()
+        IteratorImpl() = default;
+
+        // Raw getters to allow for const_iterator conversion below
+        Map *get_map() const { return map_; }
+
+      protected:
+        IteratorImpl(Map *map, size_t pos) : map_(map) { set_pos(pos); }
+        template <typename OtherMap, typename OtherValue>
+        IteratorImpl(const IteratorImpl<OtherMap, OtherValue> &other)
+            : map_(other.map_), begin_(other.begin_), pos_(other.pos_), version_(other.version_), at_end_(other.at_end_) {}
+
+      private:
+        template <typename OtherMap, typename OtherValue>
+        friend class IteratorImpl;
+
+        void set_pos(size_t pos) {
+            pos_ = pos;
+            version_ = map_->version_;
+            at_end_ = pos >= map_->entries_.size();
+            if (!at_end_) {
+                begin_ = map_->entries_[pos].get().first.begin;
+            }
+        }
+        // Position of the entry in the vector, only searched for if the map changed since it was last known
+        size_t resolve() const {
+            RANGE_ASSERT(!at_end_);
+            if (version_ != map_->version_) {
+                pos_ = map_->position_of(begin_);
+                version_ = map_->version_;
+            }
+            return pos_;
+        }
+
+        Map *map_ = nullptr;
+        index_type begin_ = index_type();
+        mutable size_t pos_ = 0;
+        mutable uint64_t version_ = 0;
+        bool at_end_ = true;
+    };
+    using iterator = IteratorImpl<flat_range_map_impl, value_type>;
+
+    // The const iterator must be derived to allow the conversion from iterator, which iterator doesn't support
+    class const_iterator : public IteratorImpl<const flat_range_map_impl, const value_type> {
+        using Base = IteratorImpl<const flat_range_map_impl, const value_type>;
+        friend flat_range_map_impl;
+
+      public:
+        const_iterator(const iterator &it) : Base(it) {}
+        const_iterator() : Base() {}
+
+      private:
+        const_iterator(const flat_range_map_impl *map, size_t pos) : Base(map, pos) {}
+    };
+
+    iterator begin() { return iterator(this, 0); }
+    const_iterator cbegin() const { return const_iterator(this, 0); }
+    const_iterator begin() const { return cbegin(); }
+    iterator end() { return iterator(this, entries_.size()); }
+    const_iterator cend() const { return const_iterator(this, entries_.size()); }
+    const_iterator end() const { return cend(); }
+
+    size_type size() const { return entries_.size(); }
+    bool empty() const { return entries_.empty(); }
+    void reserve(size_type count) { entries_.reserve(count); }
+
+    void clear() {
+        entries_.clear();
+        ++version_;
+    }
+
+    iterator lower_bound(const key_type &key) { return iterator(this, lower_bound_pos(key)); }
+    const_iterator lower_bound(const key_type &key) const { return const_iterator(this, lower_bound_pos(key)); }
+    iterator upper_bound(const key_type &key) { return iterator(this, upper_bound_pos(key)); }
+    const_iterator upper_bound(const key_type &key) const { return const_iterator(this, upper_bound_pos(key)); }
+
+    // Find entry with an exact key match
+    iterator find(const key_type &key) { return iterator(this, find_pos(key)); }
+    const_iterator find(const key_type &key) const { return const_iterator(this, find_pos(key)); }
+
+    iterator erase(const const_iterator &pos) {
+        RANGE_ASSERT(pos.map_ == this);
+        const size_t erase_pos = pos.resolve();
+        entries_.erase(entries_.begin() + erase_pos);
+        ++version_;
+        return iterator(this, erase_pos);
+    }
+    iterator erase(const iterator &pos) { return erase(const_iterator(pos)); }
+
+    // Must be called with rvalue or lvalue of value_type. The hint is used if it is the insertion point, as for std::map
+    template <typename Value>
+    iterator emplace_hint(const const_iterator &hint, Value &&value) {
+        RANGE_ASSERT(hint.at_end_ || hint.map_ == this);
+        const auto &key = value.first;
+        size_t pos = hint.at_end_ ? entries_.size() : hint.resolve();
+        const bool hint_open = ((pos == 0) || (entries_[pos - 1].get().first < key)) &&
+                               ((pos == entries_.size()) || (key < entries_[pos].get().first));
+        if (!hint_open) {
+            pos = lower_bound_pos(key);
+            if ((pos != entries_.size()) && !(key < entries_[pos].get().first)) {
+                return iterator(this, pos);  // Already present, like std::map we don't replace
+            }
+        }
+        entries_.emplace(entries_.begin() + pos, std::in_place, std::forward<Value>(value));
+        ++version_;
+        return iterator(this, pos);
+    }
+    template <typename Value>
+    iterator emplace_hint(const iterator &hint, Value &&value) {
+        return emplace_hint(const_iterator(hint), std::forward<Value>(value));
+    }
+
+    iterator insert(const const_iterator &hint, const value_type &value) { return emplace_hint(hint, value); }
+    iterator insert(const iterator &hint, const value_type &value) { return emplace_hint(const_iterator(hint), value); }
+
+    std::pair<iterator, bool> insert(const value_type &value) {
+        const size_t pos = lower_bound_pos(value.first);
+        if ((pos != entries_.size()) && !(value.first < entries_[pos].get().first)) {
+            return std::make_pair(iterator(this, pos), false);
+        }
+        entries_.emplace(entries_.begin() + pos, std::in_place, value);
+        ++version_;
+        return std::make_pair(iterator(this, pos), true);
+    }
+
+  private:
+    size_t lower_bound_pos(const key_type &key) const {
+        auto it = std::lower_bound(entries_.begin(), entries_.end(), key,
+                                   [](const Entry &entry, const key_type &k) { return entry.get().first < k; });
+        return static_cast<size_t>(it - entries_.begin());
+    }
+    size_t upper_bound_pos(const key_type &key) const {
+        auto it = std::upper_bound(entries_.begin(), entries_.end(), key,
+                                   [](const key_type &k, const Entry &entry) { return k < entry.get().first; });
+        return static_cast<size_t>(it - entries_.begin());
+    }
+    size_t find_pos(const key_type &key) const {
+        const size_t pos = lower_bound_pos(key);
+        if ((pos != entries_.size()) && (entries_[pos].get().first == key)) {
+            return pos;
+        }
+        return entries_.size();
+    }
+    // Ranges don't overlap, so begin identifies an entry
+    size_t position_of(const index_type &begin) const {
+        auto it = std::lower_bound(entries_.begin(), entries_.end(), begin,
+                                   [](const Entry &entry, const index_type &b) { return entry.get().first.begin < b; });
+        RANGE_ASSERT(it != entries_.end() && it->get().first.begin == begin);
+        return static_cast<size_t>(it - entries_.begin());
+    }
+
+    Storage entries_;
+    // Bumped by every insertion or erasure, which is what may move entries within entries_
+    uint64_t version_ = 0;
+};
+
+template <typename Key, typename T, typename RangeKey = range<Key>>
+using flat_range_map = range_map<Key, T, RangeKey, flat_range_map_impl<RangeKey, T>>;
+
 // Forward index iterator, tracking an index value and the appropos lower bound
 // returns an index_type, lower_bound pair.  Supports ++,  offset, and seek affecting the index,
 // lower bound updates as needed. As the index may specify a range for which no entry exist, dereferenced
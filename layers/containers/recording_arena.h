@@ -0,0 +1,168 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// Bump allocator for memory that lives as long as one recording of a command buffer.
+//
+// Nothing is freed on its own, Reset() releases everything at once when the command buffer is reset or begun again.
+// Blocks are kept over Reset() up to kMaxRetainedBytes, so a command buffer that is recorded over and over stops going
+// to the heap after its first recording. Not thread safe, as the recording of a command buffer is externally synchronized.
+class RecordingArena {
+  public:
+    static constexpr size_t kDefaultBlockSize = 16 * 1024;
+    static constexpr size_t kMaxRetainedBytes = 1024 * 1024;
+
+    RecordingArena() = default;
+    RecordingArena(const RecordingArena &) = delete;
+    RecordingArena &operator=(const RecordingArena &) = delete;
+
+    void *Allocate(size_t size, size_t alignment) {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+        while (block_index_ < blocks_.size()) {
+            Block &block = blocks_[block_index_];
+            const size_t aligned = (offset_ + alignment - 1) & ~(alignment - 1);
+            if (aligned + size <= block.size) {
+                offset_ = aligned + size;
+                return block.data.get() + aligned;
+            }
+            ++block_index_;
+            offset_ = 0;
+        }
+        const size_t block_size = std::max(kDefaultBlockSize, size + alignment);
+        blocks_.push_back({std::make_unique<std::byte[]>(block_size), block_size});
+        block_index_ = blocks_.size() - 1;
+        offset_ = 0;
+        return Allocate(size, alignment);
+    }
+
+    // Everything allocated so far must be destroyed by now
+    void Reset() {
+        size_t retained = 0;
+        size_t count = 0;
+        while (count < blocks_.size() && retained + blocks_[count].size <= kMaxRetainedBytes) {
+            retained += blocks_[count++].size;
+        }
+        blocks_.resize(count);
+        block_index_ = 0;
+        offset_ = 0;
+    }
+
+    size_t ReservedBytes() const {
+        size_t result = 0;
+        for (const auto &block : blocks_) {
+            result += block.size;
+        }
+        return result;
+    }
+
+  private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks_;
+    size_t block_index_ = 0;
+    size_t offset_ = 0;
+};
+
+template <typename Signature>
+class RecordedFunctions;
+
+// Drop-in replacement for the std::vector<std::function<...>> of callbacks a command buffer gathers while it is recorded.
+// The callables are stored in the RecordingArena of the command buffer instead of one heap allocation for each
+// std::function that captures more than a few handles. clear() must be called before the arena is reset.
+template <typename R, typename... Args>
+class RecordedFunctions<R(Args...)> {
+  public:
+    class Function {
+      public:
+        R operator()(Args... args) const { return ops_->invoke(object_, std::forward<Args>(args)...); }
+
+      private:
+        friend class RecordedFunctions;
+        struct Ops {
+            R (*invoke)(void *object, Args... args);
+            void *(*clone)(const void *object, RecordingArena &arena);
+            void (*destroy)(void *object);
+        };
+        template <typename F>
+        static const Ops *OpsFor() {
+            static constexpr Ops ops = {
+                [](void *object, Args... args) -> R { return (*static_cast<F *>(object))(std::forward<Args>(args)...); },
+                [](const void *object, RecordingArena &arena) -> void * {
+                    return new (arena.Allocate(sizeof(F), alignof(F))) F(*static_cast<const F *>(object));
+                },
+                std::is_trivially_destructible_v<F> ? nullptr : +[](void *object) { static_cast<F *>(object)->~F(); },
+            };
+            return &ops;
+        }
+
+        Function(void *object, const Ops *ops) : object_(object), ops_(ops) {}
+        void *object_;
+        const Ops *ops_;
+    };
+
+    explicit RecordedFunctions(RecordingArena &arena) : arena_(arena) {}
+    RecordedFunctions(const RecordedFunctions &) = delete;
+    RecordedFunctions &operator=(const RecordedFunctions &) = delete;
+    ~RecordedFunctions() { clear(); }
+
+    template <typename F>
+    void emplace_back(F &&function) {
+        using Callable = std::decay_t<F>;
+        void *object = new (arena_.Allocate(sizeof(Callable), alignof(Callable))) Callable(std::forward<F>(function));
+        functions_.push_back(Function(object, Function::template OpsFor<Callable>()));
+    }
+    // Copies a function of another command buffer into this one, as done for the secondary command buffers executed
+    void push_back(const Function &function) {
+        functions_.push_back(Function(function.ops_->clone(function.object_, arena_), function.ops_));
+    }
+
+    void clear() {
+        for (const Function &function : functions_) {
+            if (function.ops_->destroy) {
+                function.ops_->destroy(function.object_);
+            }
+        }
+        functions_.clear();
+    }
+
+    auto begin() const { return functions_.begin(); }
+    auto end() const { return functions_.end(); }
+    size_t size() const { return functions_.size(); }
+    bool empty() const { return functions_.empty(); }
+    const std::vector<Function> &Functions() const { return functions_; }
+
+  private:
+    RecordingArena &arena_;
+    std::vector<Function> functions_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,115 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace vvl {
+
+// Thread-local bump allocator for memory that only lives for the duration of one API call, such as the
+// safe_Vk* arrays built to unwrap handles before calling down the chain.
+//
+// Blocks are kept once allocated, so after warm-up a thread never goes back to the heap for scratch memory.
+// Allocations are released in LIFO order by ScratchArena::Scope, which rewinds the arena when it goes out of scope.
+class ScratchArena {
+  public:
+    static constexpr size_t kDefaultBlockSize = 64 * 1024;
+
+    static ScratchArena &Get() {
+        thread_local ScratchArena arena;
+        return arena;
+    }
+
+    void *Allocate(size_t size, size_t alignment) {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+        while (block_index_ < blocks_.size()) {
+            Block &block = blocks_[block_index_];
+            const size_t aligned = (offset_ + alignment - 1) & ~(alignment - 1);
+            if (aligned + size <= block.size) {
+                offset_ = aligned + size;
+                return block.data.get() + aligned;
+            }
+            ++block_index_;
+            offset_ = 0;
+        }
+        const size_t block_size = std::max(kDefaultBlockSize, size + alignment);
+        blocks_.push_back({std::make_unique<std::byte[]>(block_size), block_size});
+        block_index_ = blocks_.size() - 1;
+        offset_ = 0;
+        return Allocate(size, alignment);
+    }
+
+    // Marks the current position on construction and rewinds to it on destruction.
+    // Objects created with NewArray() must be destroyed with DeleteArray() before the Scope ends.
+    class Scope {
+      public:
+        Scope() : arena_(ScratchArena::Get()), block_index_(arena_.block_index_), offset_(arena_.offset_) {}
+        ~Scope() {
+            arena_.block_index_ = block_index_;
+            arena_.offset_ = offset_;
+        }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+        template <typename T>
+        T *NewArray(size_t count) {
+            T *result = static_cast<T *>(arena_.Allocate(sizeof(T) * count, alignof(T)));
+            for (size_t i = 0; i < count; ++i) {
+                new (result + i) T();
+            }
+            return result;
+        }
+
+        template <typename T>
+        void DeleteArray(T *array, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                array[i].~T();
+            }
+        }
+
+      private:
+        ScratchArena &arena_;
+        const size_t block_index_;
+        const size_t offset_;
+    };
+
+    size_t ReservedBytes() const {
+        size_t result = 0;
+        for (const auto &block : blocks_) {
+            result += block.size;
+        }
+        return result;
+    }
+
+  private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks_;
+    size_t block_index_ = 0;
+    size_t offset_ = 0;
+};
+
+}  // namespace vvl
@@ -0,0 +1,141 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// Fixed size block allocator for objects that are created and destroyed at a high rate, such as the state objects of
+// transient buffers and image views.
+//
+// Blocks are carved out of slabs of kBlocksPerSlab and recycled through a free list, slabs are only released with the pool.
+// The block size is set by the first allocation. It is meant to be used through SlabAllocator with std::allocate_shared,
+// which always allocates the same control block + object type. Requests that don't fit fall back to the global allocator.
+class SlabPool {
+  public:
+    static constexpr size_t kBlocksPerSlab = 64;
+
+    struct Stats {
+        const char *name;
+        size_t live;       // blocks currently handed out
+        size_t peak;       // highest value of live
+        size_t slabs;      // slabs allocated
+        size_t fallbacks;  // allocations that did not fit a block
+    };
+
+    explicit SlabPool(const char *name) : name_(name) {}
+    SlabPool(const SlabPool &) = delete;
+    SlabPool &operator=(const SlabPool &) = delete;
+
+    void *Allocate(size_t size, size_t alignment) {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (block_size_ == 0) {
+            block_size_ = RoundUp(std::max(size, sizeof(FreeBlock)), alignof(std::max_align_t));
+        }
+        if (!Fits(size, alignment)) {
+            fallbacks_++;
+            return ::operator new(size);
+        }
+        void *result;
+        if (free_list_) {
+            result = std::exchange(free_list_, free_list_->next);
+        } else {
+            if (slabs_.empty() || slab_offset_ == block_size_ * kBlocksPerSlab) {
+                slabs_.emplace_back(std::make_unique<std::byte[]>(block_size_ * kBlocksPerSlab));
+                slab_offset_ = 0;
+            }
+            result = slabs_.back().get() + slab_offset_;
+            slab_offset_ += block_size_;
+        }
+        peak_ = std::max(peak_, ++live_);
+        return result;
+    }
+
+    void Deallocate(void *ptr, size_t size, size_t alignment) {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (!Fits(size, alignment)) {
+            ::operator delete(ptr);
+            return;
+        }
+        assert(live_ > 0);
+        live_--;
+        free_list_ = new (ptr) FreeBlock{free_list_};
+    }
+
+    Stats GetStats() const {
+        std::lock_guard<std::mutex> lock(lock_);
+        return {name_, live_, peak_, slabs_.size(), fallbacks_};
+    }
+
+  private:
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+
+    static size_t RoundUp(size_t value, size_t alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+    bool Fits(size_t size, size_t alignment) const { return size <= block_size_ && alignment <= alignof(std::max_align_t); }
+
+    const char *name_;
+    mutable std::mutex lock_;
+    size_t block_size_ = 0;
+    std::vector<std::unique_ptr<std::byte[]>> slabs_;
+    size_t slab_offset_ = 0;
+    FreeBlock *free_list_ = nullptr;
+    size_t live_ = 0;
+    size_t peak_ = 0;
+    size_t fallbacks_ = 0;
+};
+
+// Allocator for std::allocate_shared. Every copy, including the one kept in the shared_ptr control block, shares ownership
+// of the pool, so objects can safely outlive whoever created the pool.
+template <typename T>
+class SlabAllocator {
+  public:
+    using value_type = T;
+
+    explicit SlabAllocator(std::shared_ptr<SlabPool> pool) : pool_(std::move(pool)) {}
+    template <typename U>
+    SlabAllocator(const SlabAllocator<U> &other) : pool_(other.pool_) {}
+
+    T *allocate(size_t n) { return static_cast<T *>(pool_->Allocate(sizeof(T) * n, alignof(T))); }
+    void deallocate(T *ptr, size_t n) { pool_->Deallocate(ptr, sizeof(T) * n, alignof(T)); }
+
+    template <typename U>
+    bool operator==(const SlabAllocator<U> &other) const {
+        return pool_ == other.pool_;
+    }
+    template <typename U>
+    bool operator!=(const SlabAllocator<U> &other) const {
+        return pool_ != other.pool_;
+    }
+
+  private:
+    template <typename U>
+    friend class SlabAllocator;
+    std::shared_ptr<SlabPool> pool_;
+};
+
+}  // namespace vvl
@@ -484,22 +484,56 @@ void ImageRangeGenerator::SetInitialPosFullDepth(uint32_t layer, uint32_t aspect
     incr_state_.Set(1, 1, base, span, span, span);
 }
 
-void ImageRangeGenerator::SetInitialPosSomeLayers(uint32_t layer, uint32_t aspect_index) {
-    assert(!encoder_->Is3D() && (offset_.x == 0) && (offset_.y == 0) && (offset_.z == 0));
+// The layers [baseArrayLayer, baseArrayLayer + layerCount) of the current full extent 2D subresource are contiguous
+IndexRange ImageRangeGenerator::FastLayersRange() const {
     const auto& subres_layout = subres_info_->layout;
-    const IndexType base = base_address_ + subres_layout.offset + layer * subres_layout.arrayPitch;
-    const IndexType span = subres_layout.arrayPitch * subres_range_.layerCount;
-    const IndexType z_step = subres_layout.arrayPitch * encoder_->Limits().arrayLayer;
-    incr_state_.Set(1, 1, base, span, span, z_step);
+    const IndexType base = base_address_ + subres_layout.offset + subres_range_.baseArrayLayer * subres_layout.arrayPitch;
+    return {base, base + subres_range_.layerCount * subres_layout.arrayPitch};
+}
+
+// Steps to the next selected mip, then aspect. Returns false (with the position unchanged) at the end of the range.
+bool ImageRangeGenerator::NextFastLayersSubresource() {
+    if (mip_index_ + 1 < subres_range_.levelCount) {
+        ++mip_index_;
+        ++subres_index_;
+    } else {
+        const auto next_aspect_index = encoder_->LowerBoundFromMask(subres_range_.aspectMask, aspect_index_ + 1);
+        if (next_aspect_index >= encoder_->Limits().aspect_index) {
+            return false;
+        }
+        aspect_index_ = next_aspect_index;
+        mip_index_ = 0;
+        subres_index_ = encoder_->GetSubresourceIndex(aspect_index_, subres_range_.baseMipLevel);
+    }
+    subres_info_ = &encoder_->GetSubresourceInfo(subres_index_);
+    return true;
 }
 
-void ImageRangeGenerator::SetInitialPosAllLayers(uint32_t layer, uint32_t aspect_index) {
+void ImageRangeGenerator::SetInitialPosFastLayers(uint32_t layer, uint32_t aspect_index) {
     assert(!encoder_->Is3D() && (offset_.x == 0) && (offset_.y == 0) && (offset_.z == 0) &&
-           (layer == 0));
-    const auto& subres_layout = subres_info_->layout;
-    const IndexType base = base_address_ + subres_layout.offset;
-    const IndexType span = subres_layout.arrayPitch * subres_range_.layerCount;
-    incr_state_.Set(1, 1, base, span, span, span);
+           (layer == subres_range_.baseArrayLayer));
+    incr_state_.y_base = FastLayersRange();
+    // Absorb the following subresources as long as they continue the range (e.g. all layers of consecutive mips of a linear
+    // image), so that a single range is emitted where the general path would emit one per subresource
+    for (;;) {
+        const uint32_t saved_mip_index = mip_index_;
+        const uint32_t saved_aspect_index = aspect_index_;
+        const uint32_t saved_subres_index = subres_index_;
+        const auto* saved_subres_info = subres_info_;
+        if (!NextFastLayersSubresource()) {
+            break;
+        }
+        const IndexRange next = FastLayersRange();
+        if (next.begin != incr_state_.y_base.end) {
+            // Not contiguous, leave the position on the last merged subresource for operator++
+            mip_index_ = saved_mip_index;
+            aspect_index_ = saved_aspect_index;
+            subres_index_ = saved_subres_index;
+            subres_info_ = saved_subres_info;
+            break;
+        }
+        incr_state_.y_base.end = next.end;
+    }
 }
 
 void ImageRangeGenerator::SetInitialPosOneAspect(uint32_t layer, uint32_t aspect_index) {
@@ -644,24 +678,23 @@ void ImageRangeGenerator::SetUpSubresIncrementer() {
         } else {
             set_initial_pos_fn_ = &ImageRangeGenerator::SetInitialPosFullHeight;
         }
-    } else if (is_3d || CoversAllLayers(full_range, subres_range_)) {
-        if (!linear_image) {
-            // Linear images are defined by the implementation and so we can't assume the ordering we use here
-            const bool all_mips = (subres_range_.baseMipLevel == 0) && (subres_range_.levelCount == full_range.levelCount);
-            const bool all_aspects = subres_range_.aspectMask == full_range.aspectMask;
-            if (all_aspects && all_mips) {
-                set_initial_pos_fn_ = &ImageRangeGenerator::SetInitialPosAllSubres;
-            } else {
-                set_initial_pos_fn_ = &ImageRangeGenerator::SetInitialPosOneAspect;
-            }
-        } else if (is_3d) {
-            // 3D implies CoversAllLayers
-            set_initial_pos_fn_ = &ImageRangeGenerator::SetInitialPosFullDepth;
+    } else if (!linear_image && (is_3d || CoversAllLayers(full_range, subres_range_))) {
+        // Linear images are defined by the implementation and so we can't assume the ordering we use here
+        const bool all_mips = (subres_range_.baseMipLevel == 0) && (subres_range_.levelCount == full_range.levelCount);
+        const bool all_aspects = subres_range_.aspectMask == full_range.aspectMask;
+        if (all_aspects && all_mips) {
+            set_initial_pos_fn_ = &ImageRangeGenerator::SetInitialPosAllSubres;
         } else {
-            set_initial_pos_fn_ = &ImageRangeGenerator::SetInitialPosAllLayers;
+            set_initial_pos_fn_ = &ImageRangeGenerator::SetInitialPosOneAspect;
         }
+    } else if (is_3d) {
+        // 3D implies CoversAllLayers
+        set_initial_pos_fn_ = &ImageRangeGenerator::SetInitialPosFullDepth;
     } else {
-        set_initial_pos_fn_ = &ImageRangeGenerator::SetInitialPosSomeLayers;
+        // Some layers (or, for linear images, all layers) of 2D subresources, the most common barrier and copy case. Every
+        // selected subresource is a single range, so this needs none of the incrementer state.
+        fast_layers_ = true;
+        set_initial_pos_fn_ = &ImageRangeGenerator::SetInitialPosFastLayers;
     }
 }
 
@@ -687,6 +720,16 @@ ImageRangeGenerator& ImageRangeGenerator::operator++() {
         return *this;
     }
 
+    if (fast_layers_) {
+        if (NextFastLayersSubresource()) {
+            SetInitialPosFastLayers(subres_range_.baseArrayLayer, aspect_index_);
+            pos_ = incr_state_.y_base;
+        } else {
+            pos_ = {0, 0};
+        }
+        return *this;
+    }
+
     incr_state_.y_index += incr_state_.y_step;
     if (incr_state_.y_index < incr_state_.y_count) {
         incr_state_.y_base += incr_state_.incr_y;
@@ -412,6 +412,9 @@ class ImageRangeGenerator {
     using RangeType = IndexRange;
     ImageRangeGenerator(const ImageRangeGenerator&) = default;
     ImageRangeGenerator() : encoder_(nullptr), subres_range_(), offset_(), extent_(), base_address_(), pos_() {}
+    // Generates the single given range, for callers that track the image as a whole
+    explicit ImageRangeGenerator(const IndexRange& range)
+        : encoder_(nullptr), subres_range_(), offset_(), extent_(), base_address_(), pos_(range) {}
     ImageRangeGenerator(const ImageRangeEncoder& encoder, const VkImageSubresourceRange& subres_range, const VkOffset3D& offset,
                         const VkExtent3D& extent, VkDeviceSize base_address, bool is_depth_sliced);
     void SetInitialPosFullOffset(uint32_t layer, uint32_t aspect_index);
@@ -419,10 +422,9 @@ class ImageRangeGenerator {
     void SetInitialPosFullHeight(uint32_t layer, uint32_t aspect_index);
     void SetInitialPosSomeDepth(uint32_t layer, uint32_t aspect_index);
     void SetInitialPosFullDepth(uint32_t layer, uint32_t aspect_index);
-    void SetInitialPosAllLayers(uint32_t layer, uint32_t aspect_index);
     void SetInitialPosOneAspect(uint32_t layer, uint32_t aspect_index);
     void SetInitialPosAllSubres(uint32_t layer, uint32_t aspect_index);
-    void SetInitialPosSomeLayers(uint32_t layer, uint32_t aspect_index);
+    void SetInitialPosFastLayers(uint32_t layer, uint32_t aspect_index);
     ImageRangeGenerator(const ImageRangeEncoder& encoder, const VkImageSubresourceRange& subres_range, VkDeviceSize base_address,
                         bool is_depth_sliced);
     inline const IndexRange& operator*() const { return pos_; }
@@ -441,6 +443,8 @@ class ImageRangeGenerator {
 
     VkOffset3D GetOffset(uint32_t aspect_index) const;
     VkExtent3D GetExtent(uint32_t aspect_index) const;
+    IndexRange FastLayersRange() const;
+    bool NextFastLayersSubresource();
 
     const ImageRangeEncoder* encoder_;
     VkImageSubresourceRange subres_range_;
@@ -476,15 +480,18 @@ class ImageRangeGenerator {
     IncrementerState incr_state_;
     bool single_full_size_range_ = true;
     bool is_depth_sliced_ = false;
+    // Full extent 2D subresources, one range per mip and aspect (merged when contiguous) without the incrementer
+    bool fast_layers_ = false;
 };
 
 // double wrapped map variants.. to avoid needing to templatize on the range map type.  The underlying maps are available for
 // use in performance sensitive places that are *already* templatized (for example update_range_value).
 // In STL style.  Note that N must be < uint8_t max
+// BigMap_ selects the range_map used above N, e.g. sparse_container::flat_range_map for maps with few, small entries.
 enum BothRangeMapMode { kTristate, kSmall, kBig };
-template <typename T, size_t N>
+template <typename T, size_t N, typename BigMap_ = sparse_container::range_map<IndexType, T>>
 class BothRangeMap {
-    using BigMap = sparse_container::range_map<IndexType, T>;
+    using BigMap = BigMap_;
     using RangeType = sparse_container::range<IndexType>;
     using SmallMap = sparse_container::small_range_map<IndexType, T, RangeType, N>;
     using SmallMapIterator = typename SmallMap::iterator;
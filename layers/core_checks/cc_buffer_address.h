@@ -77,7 +77,12 @@ class BufferAddressValidation {
     };
 
     // Look for a buffer that satisfies all VUIDs
-    [[nodiscard]] bool HasValidBuffer(vvl::span<const ValidationStateTracker::BUFFER_STATE_PTR> buffer_list) const noexcept;
+    [[nodiscard]] bool HasValidBuffer(vvl::span<const ValidationStateTracker::BUFFER_STATE_PTR> buffer_list) const noexcept {
+        return FindValidBuffer(buffer_list) != nullptr;
+    }
+    // The first buffer that satisfies all VUIDs, nullptr if there is none
+    [[nodiscard]] ValidationStateTracker::BUFFER_STATE_PTR FindValidBuffer(
+        vvl::span<const ValidationStateTracker::BUFFER_STATE_PTR> buffer_list) const noexcept;
     // Look for a buffer that does not satisfy one of the VUIDs
     [[nodiscard]] bool HasInvalidBuffer(vvl::span<const ValidationStateTracker::BUFFER_STATE_PTR> buffer_list) const noexcept;
     // For every vuid, build an error mentioning every buffer from buffer_list that violates it, then log this error
@@ -150,7 +155,7 @@ class BufferAddressValidation {
 };
 
 template <size_t N>
-bool BufferAddressValidation<N>::HasValidBuffer(
+ValidationStateTracker::BUFFER_STATE_PTR BufferAddressValidation<N>::FindValidBuffer(
     vvl::span<const ValidationStateTracker::BUFFER_STATE_PTR> buffer_list) const noexcept {
     for (const auto& buffer : buffer_list) {
         assert(buffer);
@@ -162,10 +167,10 @@ bool BufferAddressValidation<N>::HasValidBuffer(
                 break;
             }
         }
-        if (valid_buffer_found) return true;
+        if (valid_buffer_found) return buffer;
     }
 
-    return false;
+    return nullptr;
 }
 
 template <size_t N>
@@ -26,6 +26,34 @@
 #include "core_validation.h"
 #include "generated/enum_flag_bits.h"
 
+void CORE_CMD_BUFFER_STATE::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_command_buffers) {
+    vvl::CommandBuffer::ExecuteCommands(secondary_command_buffers);
+    // The submit time checks only read state, running them once per secondary executed several times is enough
+    vvl::unordered_set<VkCommandBuffer> executed;
+    for (const VkCommandBuffer sub_command_buffer : secondary_command_buffers) {
+        if (!executed.insert(sub_command_buffer).second) {
+            continue;
+        }
+        auto sub_cb_state = dev_data->GetRead<vvl::CommandBuffer>(sub_command_buffer);
+        const auto &sub_checks = static_cast<const CORE_CMD_BUFFER_STATE &>(*sub_cb_state).submit_time_checks;
+        submit_time_checks.insert(submit_time_checks.end(), sub_checks.begin(), sub_checks.end());
+    }
+}
+
+void CORE_CMD_BUFFER_STATE::Reset() {
+    vvl::CommandBuffer::Reset();
+    submit_time_checks.clear();
+    image_layout_submits.clear();
+    initial_layout_images.clear();
+}
+
+void CORE_CMD_BUFFER_STATE::CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const {
+    vvl::CommandBuffer::CollectMemoryFootprint(footprint);
+    footprint.AddVector("CommandBuffer submit_time_checks", submit_time_checks);
+    footprint.AddNodes("CommandBuffer image_layout_submits", image_layout_submits);
+    footprint.AddVector("CommandBuffer initial_layout_images", initial_layout_images);
+}
+
 bool CoreChecks::ReportInvalidCommandBuffer(const vvl::CommandBuffer &cb_state, const Location &loc, const char *vuid) const {
     bool skip = false;
     for (const auto &entry : cb_state.broken_bindings) {
@@ -394,7 +422,7 @@ bool CoreChecks::ValidateCmdBindIndexBuffer(const vvl::CommandBuffer &cb_state,
         return skip;  // no buffer state to validate
     }
 
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    auto buffer_state = Borrow<vvl::Buffer>(buffer);
     const LogObjectList objlist(cb_state.commandBuffer(), buffer);
 
     vuid = is_2 ? "VUID-vkCmdBindIndexBuffer2KHR-buffer-08784" : "VUID-vkCmdBindIndexBuffer-buffer-08784";
@@ -435,7 +463,7 @@ bool CoreChecks::PreCallValidateCmdBindIndexBuffer2KHR(VkCommandBuffer commandBu
     skip |= ValidateCmdBindIndexBuffer(*cb_state, buffer, offset, indexType, error_obj.location);
 
     if (size != VK_WHOLE_SIZE && buffer != VK_NULL_HANDLE) {
-        auto buffer_state = Get<vvl::Buffer>(buffer);
+        auto buffer_state = Borrow<vvl::Buffer>(buffer);
         const VkDeviceSize offset_align = static_cast<VkDeviceSize>(GetIndexAlignment(indexType));
         if (!IsIntegerMultipleOf(size, offset_align)) {
             skip |= LogError("VUID-vkCmdBindIndexBuffer2KHR-size-08767", commandBuffer, error_obj.location.dot(Field::size),
@@ -460,7 +488,7 @@ bool CoreChecks::PreCallValidateCmdBindVertexBuffers(VkCommandBuffer commandBuff
     bool skip = false;
     skip |= ValidateCmd(*cb_state, error_obj.location);
     for (uint32_t i = 0; i < bindingCount; ++i) {
-        auto buffer_state = Get<vvl::Buffer>(pBuffers[i]);
+        auto buffer_state = Borrow<vvl::Buffer>(pBuffers[i]);
         if (!buffer_state) {
             continue;
         }
@@ -806,7 +834,9 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
                                                    const VkCommandBuffer *pCommandBuffers, const ErrorObject &error_obj) const {
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
     bool skip = false;
-    vvl::unordered_set<const vvl::CommandBuffer *> linked_command_buffers;
+    // A secondary executed several times is checked against the same primary state each time, so only the checks depending on
+    // its position in pCommandBuffers run again for it
+    vvl::unordered_set<const vvl::CommandBuffer *> checked_command_buffers;
     ViewportScissorInheritanceTracker viewport_scissor_inheritance{*this};
 
     if (enabled_features.inheritedViewportScissor2D) {
@@ -866,6 +896,17 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
             skip |= viewport_scissor_inheritance.VisitSecondary(i, cb_loc, sub_cb_state);
         }
 
+        if (!checked_command_buffers.insert(&sub_cb_state).second) {
+            if (!(sub_cb_state.beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)) {
+                const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
+                skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00093", objlist, cb_loc,
+                                 "Cannot duplicate %s in pCommandBuffers without "
+                                 "VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT set.",
+                                 FormatHandle(commandBuffer).c_str());
+            }
+            continue;
+        }
+
         if (VK_COMMAND_BUFFER_LEVEL_SECONDARY != sub_cb_state.createInfo.level) {
             const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
             skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00088", objlist, cb_loc,
@@ -1226,14 +1267,6 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
                                  FormatHandle(pCommandBuffers[i]).c_str(), FormatHandle(commandBuffer).c_str());
             }
 
-            const auto insert_pair = linked_command_buffers.insert(&sub_cb_state);
-            if (!insert_pair.second) {
-                const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
-                skip |= LogError("VUID-vkCmdExecuteCommands-pCommandBuffers-00093", objlist, cb_loc,
-                                 "Cannot duplicate %s in pCommandBuffers without "
-                                 "VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT set.",
-                                 FormatHandle(commandBuffer).c_str());
-            }
         }
         if (!cb_state.activeQueries.empty() && !enabled_features.inheritedQueries) {
             const LogObjectList objlist(commandBuffer, pCommandBuffers[i]);
@@ -1244,14 +1277,16 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
         // Validate initial layout uses vs. the primary cmd buffer state
         // Novel Valid usage: "UNASSIGNED-vkCmdExecuteCommands-commandBuffer-00001"
         // initial layout usage of secondary command buffers resources must match parent command buffer
-        for (const auto &sub_layout_map_entry : sub_cb_state.image_layout_map) {
-            const auto image = sub_layout_map_entry.first;
-
+        // Only the images the secondary expects in some layout, found at its vkEndCommandBuffer, can mismatch
+        const auto &sub_core_cb_state = static_cast<const CORE_CMD_BUFFER_STATE &>(sub_cb_state);
+        for (const VkImage image : sub_core_cb_state.initial_layout_images) {
             const auto *cb_subres_map = cb_state.GetImageSubresourceLayoutMap(image);
             // Const getter can be null in which case we have nothing to check against for this image...
             if (!cb_subres_map) continue;
+            const auto *sub_subres_map = sub_cb_state.GetImageSubresourceLayoutMap(image);
+            if (!sub_subres_map) continue;
 
-            const auto &sub_layout_map = sub_layout_map_entry.second->GetLayoutMap();
+            const auto &sub_layout_map = sub_subres_map->GetLayoutMap();
             const auto &cb_layout_map = cb_subres_map->GetLayoutMap();
             for (sparse_container::parallel_iterator<const ImageSubresourceLayoutMap::LayoutMap> iter(sub_layout_map, cb_layout_map,
                                                                                                       0);
@@ -17,6 +17,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <limits>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -40,6 +42,35 @@ static bool RangesIntersect(int64_t x, uint64_t x_size, int64_t y, uint64_t y_si
     return intersection.non_empty();
 }
 
+// Finds in O(log n) whether a range can intersect any of a set of ranges, instead of testing them all.
+// The test treats the ranges as closed, so it never misses what sparse_container::range::intersects() finds, empty ranges
+// included, but can report a range touching another one; callers confirm those with the exact test.
+class RangeSweep {
+  public:
+    using RangeType = sparse_container::range<VkDeviceSize>;
+
+    explicit RangeSweep(std::vector<RangeType> &&ranges) : ranges_(std::move(ranges)), max_ends_(ranges_.size()) {
+        std::sort(ranges_.begin(), ranges_.end(), [](const RangeType &a, const RangeType &b) { return a.begin < b.begin; });
+        VkDeviceSize max_end = 0;
+        for (size_t i = 0; i < ranges_.size(); ++i) {
+            max_end = std::max(max_end, ranges_[i].end);
+            max_ends_[i] = max_end;
+        }
+    }
+
+    bool MayIntersect(const RangeType &range) const {
+        // The ranges beginning at or before the end of range, of which one must end at or after its begin
+        const auto it = std::upper_bound(ranges_.begin(), ranges_.end(), range.end,
+                                         [](VkDeviceSize end, const RangeType &other) { return end < other.begin; });
+        const auto count = static_cast<size_t>(it - ranges_.begin());
+        return count > 0 && max_ends_[count - 1] >= range.begin;
+    }
+
+  private:
+    std::vector<RangeType> ranges_;
+    std::vector<VkDeviceSize> max_ends_;  // max_ends_[i] is the largest end of ranges_[0..i]
+};
+
 struct ImageRegionIntersection {
     VkImageSubresourceLayers subresource = {};
     VkOffset3D offset = {0, 0, 0};
@@ -170,8 +201,8 @@ VkExtent3D CoreChecks::GetScaledItg(const vvl::CommandBuffer &cb_state, const vv
     const auto pool = cb_state.command_pool;
     if (pool) {
         granularity = physical_device_state->queue_family_properties[pool->queueFamilyIndex].minImageTransferGranularity;
-        if (vkuFormatIsBlockedImage(image_format)) {
-            auto block_size = vkuFormatTexelBlockExtent(image_format);
+        if (GetFormatInfo(image_format).is_blocked_image) {
+            auto block_size = GetFormatInfo(image_format).texel_block_extent;
             granularity.width *= block_size.width;
             granularity.height *= block_size.height;
         }
@@ -742,7 +773,7 @@ bool CoreChecks::ValidateHeterogeneousCopyData(const HandleT handle, uint32_t re
                              string_VkImageAspectFlags(region_aspect_mask).c_str(), string_VkFormat(image_format));
         }
 
-        auto block_size = vkuFormatTexelBlockExtent(image_format);
+        auto block_size = GetFormatInfo(image_format).texel_block_extent;
         //  BufferRowLength must be a multiple of block width
         if (SafeModulo(row_length, block_size.width) != 0) {
             const LogObjectList objlist(handle, image_state.image());
@@ -838,7 +869,7 @@ bool CoreChecks::ValidateHeterogeneousCopyData(const HandleT handle, uint32_t re
         // *RowLength divided by the texel block extent width and then multiplied by the texel block size of the image must be
         // less than or equal to 2^31-1
         const uint32_t element_size =
-            vkuFormatIsDepthOrStencil(image_format)
+            GetFormatInfo(image_format).IsDepthOrStencil()
                 ? 0
                 : vkuFormatElementSizeWithAspect(image_format, static_cast<VkImageAspectFlagBits>(region_aspect_mask));
         double test_value = row_length / block_size.width;
@@ -856,7 +887,7 @@ bool CoreChecks::ValidateHeterogeneousCopyData(const HandleT handle, uint32_t re
         }
 
         // Checks that apply only to multi-planar format images
-        if (vkuFormatIsMultiplane(image_format) && !IsOnlyOneValidPlaneAspect(image_format, region_aspect_mask)) {
+        if (GetFormatInfo(image_format).IsMultiplane() && !IsOnlyOneValidPlaneAspect(image_format, region_aspect_mask)) {
             const LogObjectList objlist(handle, image_state.image());
             skip |= LogError(GetBufferMemoryImageCopyCommandVUID("07981", from_image, is_2, is_memory), objlist,
                              subresource_loc.dot(Field::aspectMask), "(%s) is invalid for multi-planar format %s.",
@@ -887,12 +918,12 @@ bool CoreChecks::ValidateBufferImageCopyData(const vvl::CommandBuffer &cb_state,
         // If the the calling command's VkImage parameter's format is not a depth/stencil format,
         // then bufferOffset must be a multiple of the calling command's VkImage parameter's element size
         const uint32_t element_size =
-            vkuFormatIsDepthOrStencil(image_format)
+            GetFormatInfo(image_format).IsDepthOrStencil()
                 ? 0
                 : vkuFormatElementSizeWithAspect(image_format, static_cast<VkImageAspectFlagBits>(region_aspect_mask));
         const VkDeviceSize bufferOffset = region.bufferOffset;
 
-        if (vkuFormatIsDepthOrStencil(image_format)) {
+        if (GetFormatInfo(image_format).IsDepthOrStencil()) {
             if (SafeModulo(bufferOffset, 4) != 0) {
                 const LogObjectList objlist(cb_state.commandBuffer(), image_state.image());
                 skip |= LogError(GetBufferMemoryImageCopyCommandVUID("07978", image_to_buffer, is_2), objlist,
@@ -902,7 +933,7 @@ bool CoreChecks::ValidateBufferImageCopyData(const vvl::CommandBuffer &cb_state,
             }
         } else {
             // If not depth/stencil and not multi-plane
-            if (!vkuFormatIsMultiplane(image_format) && (SafeModulo(bufferOffset, element_size) != 0)) {
+            if (!GetFormatInfo(image_format).IsMultiplane() && (SafeModulo(bufferOffset, element_size) != 0)) {
                 const LogObjectList objlist(cb_state.commandBuffer(), image_state.image());
                 skip |= LogError(GetBufferMemoryImageCopyCommandVUID("07975", image_to_buffer, is_2), objlist,
                                  region_loc.dot(Field::bufferOffset),
@@ -912,14 +943,14 @@ bool CoreChecks::ValidateBufferImageCopyData(const vvl::CommandBuffer &cb_state,
         }
 
         // Checks that apply only to multi-planar format images
-        if (vkuFormatIsMultiplane(image_format)) {
+        if (GetFormatInfo(image_format).IsMultiplane()) {
             // image subresource aspectMask must be VK_IMAGE_ASPECT_PLANE_*_BIT
             if (0 !=
                 (region_aspect_mask & (VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_1_BIT | VK_IMAGE_ASPECT_PLANE_2_BIT))) {
                 // Know aspect mask is valid
                 const VkFormat compatible_format =
                     vkuFindMultiplaneCompatibleFormat(image_format, static_cast<VkImageAspectFlagBits>(region_aspect_mask));
-                const uint32_t compatible_size = vkuFormatElementSize(compatible_format);
+                const uint32_t compatible_size = GetFormatInfo(compatible_format).element_size;
                 if (SafeModulo(bufferOffset, compatible_size) != 0) {
                     const LogObjectList objlist(cb_state.commandBuffer(), image_state.image());
                     skip |= LogError(GetBufferMemoryImageCopyCommandVUID("07976", image_to_buffer, is_2), objlist,
@@ -956,6 +987,23 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
     VkDeviceSize dst_buffer_size = dst_buffer_state.createInfo.size;
     const bool are_buffers_sparse = src_buffer_state.sparse || dst_buffer_state.sparse;
 
+    // Both buffers are bound to a single memory range, so their regions can only overlap when it is the same memory.
+    // Sweep the destination regions in memory order, rather than testing each source region against all of them.
+    std::optional<RangeSweep> dst_sweep;
+    const auto *src_binding = are_buffers_sparse ? nullptr : src_buffer_state.Binding();
+    const auto *dst_binding = are_buffers_sparse ? nullptr : dst_buffer_state.Binding();
+    if (src_binding && dst_binding && src_binding->memory_state == dst_binding->memory_state) {
+        std::vector<RangeSweep::RangeType> dst_memory_ranges;
+        dst_memory_ranges.reserve(regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            // Regions out of the buffer bounds are still tested against, keep their end past their begin
+            const VkDeviceSize begin = dst_binding->memory_offset + pRegions[i].dstOffset;
+            const VkDeviceSize end = begin + pRegions[i].size;
+            dst_memory_ranges.emplace_back(begin, end < begin ? std::numeric_limits<VkDeviceSize>::max() : end);
+        }
+        dst_sweep.emplace(std::move(dst_memory_ranges));
+    }
+
     const LogObjectList src_objlist(cb, dst_buffer_state.Handle());
     const LogObjectList dst_objlist(cb, dst_buffer_state.Handle());
     for (uint32_t i = 0; i < regionCount; i++) {
@@ -997,7 +1045,8 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer cb, const vvl::Buff
         }
 
         // The union of the source regions, and the union of the destination regions, must not overlap in memory
-        if (!skip && !are_buffers_sparse) {
+        const VkDeviceSize src_memory_begin = src_binding ? src_binding->memory_offset + region.srcOffset : 0;
+        if (!skip && dst_sweep && dst_sweep->MayIntersect({src_memory_begin, src_memory_begin + region.size})) {
             auto src_region = sparse_container::range<VkDeviceSize>{region.srcOffset, region.srcOffset + region.size};
             for (uint32_t j = 0; j < regionCount; j++) {
                 auto dst_region =
@@ -1412,7 +1461,7 @@ bool CoreChecks::ValidateImageCopyData(const HandleT handle, const uint32_t regi
         }
 
         {  // Used to be compressed checks, now apply to all
-            const VkExtent3D block_size = vkuFormatTexelBlockExtent(src_image_state.createInfo.format);
+            const VkExtent3D block_size = GetFormatInfo(src_image_state.createInfo.format).texel_block_extent;
             if (SafeModulo(region.srcOffset.x, block_size.width) != 0) {
                 const LogObjectList objlist(handle, src_image_state.image());
                 skip |= LogError(GetImageCopyVUID("07278", is_2, is_host), objlist, region_loc,
@@ -1561,7 +1610,7 @@ bool CoreChecks::ValidateImageCopyData(const HandleT handle, const uint32_t regi
         }
 
         {
-            const VkExtent3D block_size = vkuFormatTexelBlockExtent(dst_image_state.createInfo.format);
+            const VkExtent3D block_size = GetFormatInfo(dst_image_state.createInfo.format).texel_block_extent;
             //  image offsets x must be multiple of block width
             if (SafeModulo(region.dstOffset.x, block_size.width) != 0) {
                 const LogObjectList objlist(handle, src_image_state.image());
@@ -1840,6 +1889,8 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
     const vvl::CommandBuffer &cb_state = *cb_state_ptr;
     const VkFormat src_format = src_image_state->createInfo.format;
     const VkFormat dst_format = dst_image_state->createInfo.format;
+    const vvl::FormatInfo &src_format_info = GetFormatInfo(src_format);
+    const vvl::FormatInfo &dst_format_info = GetFormatInfo(dst_format);
     const VkImageType src_image_type = src_image_state->createInfo.imageType;
     const VkImageType dst_image_type = dst_image_state->createInfo.imageType;
     const bool src_is_2d = (VK_IMAGE_TYPE_2D == src_image_type);
@@ -1976,7 +2027,7 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
             }
         }
 
-        if ((!vkuFormatIsMultiplane(src_format)) && (!vkuFormatIsMultiplane(dst_format))) {
+        if ((!src_format_info.IsMultiplane()) && (!dst_format_info.IsMultiplane())) {
             // If neither image is multi-plane the aspectMask member of src and dst must match
             if (region.srcSubresource.aspectMask != region.dstSubresource.aspectMask) {
                 vuid = is_2 ? "VUID-VkCopyImageInfo2-srcImage-01551" : "VUID-vkCmdCopyImage-srcImage-01551";
@@ -1988,14 +2039,14 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         } else {
             // Source image multiplane checks
             VkImageAspectFlags aspect = region.srcSubresource.aspectMask;
-            if (vkuFormatIsMultiplane(src_format) && !IsOnlyOneValidPlaneAspect(src_format, aspect)) {
+            if (src_format_info.IsMultiplane() && !IsOnlyOneValidPlaneAspect(src_format, aspect)) {
                 vuid = is_2 ? "VUID-VkCopyImageInfo2-srcImage-08713" : "VUID-vkCmdCopyImage-srcImage-08713";
                 skip |= LogError(vuid, src_objlist, src_subresource_loc.dot(Field::aspectMask),
                                  "(%s) is invalid for multi-planar format %s.", string_VkImageAspectFlags(aspect).c_str(),
                                  string_VkFormat(src_format));
             }
             // Single-plane to multi-plane
-            if ((!vkuFormatIsMultiplane(src_format)) && (vkuFormatIsMultiplane(dst_format)) &&
+            if ((!src_format_info.IsMultiplane()) && (dst_format_info.IsMultiplane()) &&
                 (VK_IMAGE_ASPECT_COLOR_BIT != aspect)) {
                 vuid = is_2 ? "VUID-VkCopyImageInfo2-dstImage-01557" : "VUID-vkCmdCopyImage-dstImage-01557";
                 skip |=
@@ -2006,14 +2057,14 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
 
             // Dest image multiplane checks
             aspect = region.dstSubresource.aspectMask;
-            if (vkuFormatIsMultiplane(dst_format) && !IsOnlyOneValidPlaneAspect(dst_format, aspect)) {
+            if (dst_format_info.IsMultiplane() && !IsOnlyOneValidPlaneAspect(dst_format, aspect)) {
                 vuid = is_2 ? "VUID-VkCopyImageInfo2-dstImage-08714" : "VUID-vkCmdCopyImage-dstImage-08714";
                 skip |= LogError(vuid, dst_objlist, dst_subresource_loc.dot(Field::aspectMask),
                                  "(%s) is invalid for multi-planar format %s.", string_VkImageAspectFlags(aspect).c_str(),
                                  string_VkFormat(dst_format));
             }
             // Multi-plane to single-plane
-            if ((vkuFormatIsMultiplane(src_format)) && (!vkuFormatIsMultiplane(dst_format)) &&
+            if ((src_format_info.IsMultiplane()) && (!dst_format_info.IsMultiplane()) &&
                 (VK_IMAGE_ASPECT_COLOR_BIT != aspect)) {
                 vuid = is_2 ? "VUID-VkCopyImageInfo2-srcImage-01556" : "VUID-vkCmdCopyImage-srcImage-01556";
                 skip |=
@@ -2031,7 +2082,7 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         if (src_image_state->image() == dst_image_state->image()) {
             for (uint32_t j = 0; j < regionCount; j++) {
                 if (auto intersection =
-                        GetRegionIntersection(region, pRegions[j], src_image_type, vkuFormatIsMultiplane(src_format));
+                        GetRegionIntersection(region, pRegions[j], src_image_type, src_format_info.IsMultiplane());
                     intersection.has_instersection) {
                     vuid = is_2 ? "VUID-VkCopyImageInfo2-pRegions-00124" : "VUID-vkCmdCopyImage-pRegions-00124";
                     skip |= LogError(vuid, all_objlist, loc,
@@ -2043,19 +2094,19 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         }
 
         // Check for multi-plane format compatiblity
-        if (vkuFormatIsMultiplane(src_format) || vkuFormatIsMultiplane(dst_format)) {
+        if (src_format_info.IsMultiplane() || dst_format_info.IsMultiplane()) {
             const VkFormat src_plane_format =
-                vkuFormatIsMultiplane(src_format)
+                src_format_info.IsMultiplane()
                     ? vkuFindMultiplaneCompatibleFormat(src_format,
                                                         static_cast<VkImageAspectFlagBits>(region.srcSubresource.aspectMask))
                     : src_format;
             const VkFormat dst_plane_format =
-                vkuFormatIsMultiplane(dst_format)
+                dst_format_info.IsMultiplane()
                     ? vkuFindMultiplaneCompatibleFormat(dst_format,
                                                         static_cast<VkImageAspectFlagBits>(region.dstSubresource.aspectMask))
                     : dst_format;
-            const size_t src_format_size = vkuFormatElementSize(src_plane_format);
-            const size_t dst_format_size = vkuFormatElementSize(dst_plane_format);
+            const size_t src_format_size = GetFormatInfo(src_plane_format).element_size;
+            const size_t dst_format_size = GetFormatInfo(dst_plane_format).element_size;
 
             // If size is still zero, then format is invalid and will be caught in another VU
             if ((src_format_size != dst_format_size) && (src_format_size != 0) && (dst_format_size != 0)) {
@@ -2079,27 +2130,27 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
     // The formats of non-multiplane src_image and dst_image must be compatible. Formats are considered compatible if their texel
     // size in bytes is the same between both formats. For example, VK_FORMAT_R8G8B8A8_UNORM is compatible with VK_FORMAT_R32_UINT
     // because because both texels are 4 bytes in size.
-    if (!vkuFormatIsMultiplane(src_format) && !vkuFormatIsMultiplane(dst_format)) {
+    if (!src_format_info.IsMultiplane() && !dst_format_info.IsMultiplane()) {
         const char *compatible_vuid = is_2 ? "VUID-VkCopyImageInfo2-srcImage-01548" : "VUID-vkCmdCopyImage-srcImage-01548";
         // Depth/stencil formats must match exactly.
-        if (vkuFormatIsDepthOrStencil(src_format) || vkuFormatIsDepthOrStencil(dst_format)) {
+        if (src_format_info.IsDepthOrStencil() || dst_format_info.IsDepthOrStencil()) {
             if (src_format != dst_format) {
                 skip |= LogError(compatible_vuid, all_objlist, loc, "srcImage format (%s) is different from dstImage format (%s).",
                                  string_VkFormat(src_format), string_VkFormat(dst_format));
             }
         } else {
-            if (vkuFormatElementSize(src_format) != vkuFormatElementSize(dst_format)) {
+            if (src_format_info.element_size != dst_format_info.element_size) {
                 skip |= LogError(compatible_vuid, all_objlist, loc,
                                  "srcImage format %s has size of %" PRIu32 " and dstImage format %s has size of %" PRIu32 ".",
-                                 string_VkFormat(src_format), vkuFormatElementSize(src_format), string_VkFormat(dst_format),
-                                 vkuFormatElementSize(dst_format));
+                                 string_VkFormat(src_format), src_format_info.element_size, string_VkFormat(dst_format),
+                                 dst_format_info.element_size);
             }
         }
     }
 
-    if (vkuFormatIsCompressed(src_format) && vkuFormatIsCompressed(dst_format)) {
-        auto src_block_extent = vkuFormatTexelBlockExtent(src_format);
-        auto dst_block_extent = vkuFormatTexelBlockExtent(dst_format);
+    if (src_format_info.is_compressed && dst_format_info.is_compressed) {
+        auto src_block_extent = src_format_info.texel_block_extent;
+        auto dst_block_extent = dst_format_info.texel_block_extent;
         if (src_block_extent.width != dst_block_extent.width || src_block_extent.height != dst_block_extent.height ||
             src_block_extent.depth != dst_block_extent.depth) {
             const char *compatible_vuid = is_2 ? "VUID-VkCopyImageInfo2-srcImage-09247" : "VUID-vkCmdCopyImage-srcImage-09247";
@@ -2280,6 +2331,27 @@ void CoreChecks::PreCallRecordCmdCopyImage2(VkCommandBuffer commandBuffer, const
     RecordCmdCopyImage2(commandBuffer, pCopyImageInfo);
 }
 
+bool CoreChecks::ValidateCopyBufferOverlapAtSubmit(const CopyBufferOverlapCheck &check) const {
+    bool skip = false;
+    for (uint32_t i = 0; i < check.src_ranges.size(); ++i) {
+        const auto &src = check.src_ranges[i];
+        for (uint32_t j = 0; j < check.dst_ranges.size(); ++j) {
+            const auto &dst = check.dst_ranges[j];
+            if (const auto [memory, overlap_range] = check.src_buffer->GetResourceMemoryOverlap(src, check.dst_buffer.get(), dst);
+                memory != VK_NULL_HANDLE) {
+                const LogObjectList objlist(check.command_buffer, check.src_buffer->buffer(), check.dst_buffer->buffer(), memory);
+                skip |= LogError(check.vuid, objlist, check.loc.Get(),
+                                 "Memory (%s) has copy overlap on range %s. Source "
+                                 "buffer range is pRegions[%" PRIu32
+                                 "] (%s), destination buffer range is pRegions[%" PRIu32 "] (%s).",
+                                 FormatHandle(memory).c_str(), string_range(overlap_range).c_str(), i, string_range(src).c_str(), j,
+                                 string_range(dst).c_str());
+            }
+        }
+    }
+    return skip;
+}
+
 template <typename RegionType>
 void CoreChecks::RecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
                                      const RegionType *pRegions, const Location &loc) {
@@ -2300,33 +2372,11 @@ void CoreChecks::RecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer src
             dst_ranges.emplace_back(sparse_container::range<VkDeviceSize>{region.dstOffset, region.dstOffset + region.size});
         }
 
-        auto queue_submit_validation = [this, commandBuffer, src_buffer_state, dst_buffer_state, regionCount, src_ranges,
-                                        dst_ranges, loc,
-                                        vuid](const ValidationStateTracker &device_data, const class vvl::Queue &queue_state,
-                                              const vvl::CommandBuffer &cb_state) -> bool {
-            bool skip = false;
-            for (uint32_t i = 0; i < regionCount; ++i) {
-                const auto &src = src_ranges[i];
-                for (uint32_t j = 0; j < regionCount; ++j) {
-                    const auto &dst = dst_ranges[j];
-                    if (const auto [memory, overlap_range] =
-                            src_buffer_state->GetResourceMemoryOverlap(src, dst_buffer_state.get(), dst);
-                        memory != VK_NULL_HANDLE) {
-                        const LogObjectList objlist(commandBuffer, src_buffer_state->buffer(), dst_buffer_state->buffer(), memory);
-                        skip |= this->LogError(vuid, objlist, loc,
-                                               "Memory (%s) has copy overlap on range %s. Source "
-                                               "buffer range is pRegions[%" PRIu32
-                                               "] (%s), destination buffer range is pRegions[%" PRIu32 "] (%s).",
-                                               FormatHandle(memory).c_str(), string_range(overlap_range).c_str(), i,
-                                               string_range(src).c_str(), j, string_range(dst).c_str());
-                    }
-                }
-            }
-
-            return skip;
-        };
-
-        cb_state_ptr->queue_submit_functions.emplace_back(queue_submit_validation);
+        auto &core_cb_state = static_cast<CORE_CMD_BUFFER_STATE &>(*cb_state_ptr);
+        core_cb_state.submit_time_checks.emplace_back(CopyBufferOverlapCheck{vvl::LocationCapture(loc), vuid, commandBuffer,
+                                                                             std::move(src_buffer_state),
+                                                                             std::move(dst_buffer_state), std::move(src_ranges),
+                                                                             std::move(dst_ranges)});
     }
 }
 
@@ -2391,8 +2441,8 @@ bool CoreChecks::ValidateImageBounds(const HandleT handle, const vvl::Image &ima
 
         // If we're using a blocked image format, valid extent is rounded up to multiple of block size (per
         // vkspec.html#_common_operation)
-        if (vkuFormatIsBlockedImage(image_info->format)) {
-            auto block_extent = vkuFormatTexelBlockExtent(image_info->format);
+        if (GetFormatInfo(image_info->format).is_blocked_image) {
+            auto block_extent = GetFormatInfo(image_info->format).texel_block_extent;
             if (image_extent.width % block_extent.width) {
                 image_extent.width += (block_extent.width - (image_extent.width % block_extent.width));
             }
@@ -2902,6 +2952,11 @@ template <>
 VkImage GetImage<VkCopyImageToMemoryInfoEXT>(VkCopyImageToMemoryInfoEXT data) {
     return data.srcImage;
 }
+static bool IsSameSubresourceLayers(const VkImageSubresourceLayers &a, const VkImageSubresourceLayers &b) {
+    return a.aspectMask == b.aspectMask && a.mipLevel == b.mipLevel && a.baseArrayLayer == b.baseArrayLayer &&
+           a.layerCount == b.layerCount;
+}
+
 template <typename InfoPointer>
 bool CoreChecks::ValidateMemoryImageCopyCommon(VkDevice device, InfoPointer info_ptr, const Location &loc) const {
     bool skip = false;
@@ -2954,21 +3009,44 @@ bool CoreChecks::ValidateMemoryImageCopyCommon(VkDevice device, InfoPointer info
     bool check_memcpy = (info_ptr->flags & VK_HOST_IMAGE_COPY_MEMCPY_EXT);
     bool has_stencil = false;
     bool has_non_stencil = false;
+    // Host copies are streamed from many threads with many regions each, so the published layouts are read once per call
+    // instead of once per region, and consecutive regions of a subresource that already passed are not looked up again
+    GlobalImageLayoutState::Snapshot global_layouts;
+    if (!disabled[image_layout_validation] && image_state->layout_state) {
+        global_layouts = image_state->layout_state->Current();
+    }
+    const VkImageSubresourceLayers *clean_subresource = nullptr;
+    const Field layout_field = from_image ? Field::srcImageLayout : Field::dstImageLayout;
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
         const Location subresource_loc = region_loc.dot(Field::imageSubresource);
         const auto region = info_ptr->pRegions[i];
 
-        skip |= ValidateImageMipLevel(device, *image_state, region.imageSubresource.mipLevel, subresource_loc.dot(Field::mipLevel),
-                                      from_image ? "VUID-VkCopyImageToMemoryInfoEXT-imageSubresource-07967"
-                                                 : "VUID-VkCopyMemoryToImageInfoEXT-imageSubresource-07967");
-        skip |= ValidateImageArrayLayerRange(device, *image_state, region.imageSubresource.baseArrayLayer,
-                                             region.imageSubresource.layerCount, subresource_loc,
-                                             from_image ? "VUID-VkCopyImageToMemoryInfoEXT-imageSubresource-07968"
-                                                        : "VUID-VkCopyMemoryToImageInfoEXT-imageSubresource-07968");
-        skip |= ValidateImageSubresourceLayers(device, &region.imageSubresource, subresource_loc);
-        if (region.imageSubresource.aspectMask & VK_IMAGE_ASPECT_STENCIL_BIT) has_stencil = true;
-        if (region.imageSubresource.aspectMask & ~VK_IMAGE_ASPECT_STENCIL_BIT) has_non_stencil = true;
+        if (!clean_subresource || !IsSameSubresourceLayers(*clean_subresource, region.imageSubresource)) {
+            bool subresource_clean = false;
+            skip |= ValidateAndCheckClean(subresource_clean, [&]() {
+                const char *mip_vuid = from_image ? "VUID-VkCopyImageToMemoryInfoEXT-imageSubresource-07967"
+                                                  : "VUID-VkCopyMemoryToImageInfoEXT-imageSubresource-07967";
+                const char *layer_vuid = from_image ? "VUID-VkCopyImageToMemoryInfoEXT-imageSubresource-07968"
+                                                    : "VUID-VkCopyMemoryToImageInfoEXT-imageSubresource-07968";
+                bool subresource_skip = ValidateImageMipLevel(device, *image_state, region.imageSubresource.mipLevel,
+                                                              subresource_loc.dot(Field::mipLevel), mip_vuid);
+                subresource_skip |= ValidateImageArrayLayerRange(device, *image_state, region.imageSubresource.baseArrayLayer,
+                                                                 region.imageSubresource.layerCount, subresource_loc, layer_vuid);
+                subresource_skip |= ValidateImageSubresourceLayers(device, &region.imageSubresource, subresource_loc);
+                if (global_layouts) {
+                    subresource_skip |=
+                        ValidateHostCopyCurrentLayout(device, image_layout, RangeFromLayers(region.imageSubresource), i,
+                                                      *image_state, *global_layouts, region_loc.dot(layout_field),
+                                                      source_or_destination, image_layout_vuid);
+                }
+                return subresource_skip;
+            });
+            if (region.imageSubresource.aspectMask & VK_IMAGE_ASPECT_STENCIL_BIT) has_stencil = true;
+            if (region.imageSubresource.aspectMask & ~VK_IMAGE_ASPECT_STENCIL_BIT) has_non_stencil = true;
+            // Only a subresource that logged nothing is skipped, so every bad region is still reported
+            clean_subresource = subresource_clean ? &info_ptr->pRegions[i].imageSubresource : nullptr;
+        }
 
         if (check_memcpy) {
             if (region.imageOffset.x != 0 || region.imageOffset.y != 0 || region.imageOffset.z != 0) {
@@ -3005,10 +3083,6 @@ bool CoreChecks::ValidateMemoryImageCopyCommon(VkDevice device, InfoPointer info
                                  i, region.memoryRowLength, i, region.memoryImageHeight, info_type);
             }
         }
-
-        Field field = from_image ? Field::srcImageLayout : Field::dstImageLayout;
-        skip |= ValidateHostCopyCurrentLayout(device, image_layout, region.imageSubresource, i, *image_state, region_loc.dot(field),
-                                              source_or_destination, image_layout_vuid);
     }
 
     const char *vuid_09111 =
@@ -3027,9 +3101,9 @@ bool CoreChecks::ValidateMemoryImageCopyCommon(VkDevice device, InfoPointer info
                                              ? state->alloc_info.allocationSize
                                              : (state->mapped_range.offset + state->mapped_range.size);
             const void *mapped_end = static_cast<char *>(state->p_driver_data) + mapped_size;
+            const auto element_size = GetFormatInfo(image_state->createInfo.format).element_size;
             for (uint32_t i = 0; i < regionCount; i++) {
-                const auto region = info_ptr->pRegions[i];
-                auto element_size = vkuFormatElementSize(image_state->createInfo.format);
+                const auto &region = info_ptr->pRegions[i];
                 uint64_t copy_size;
                 if (region.memoryRowLength != 0 && region.memoryImageHeight != 0) {
                     copy_size = ((region.memoryRowLength * region.memoryImageHeight) * element_size);
@@ -3198,7 +3272,7 @@ bool CoreChecks::ValidateHostCopyMultiplane(VkDevice device, VkImageCopy2 region
                                             const Location &region_loc) const {
     bool skip = false;
     auto aspect_mask = is_src ? region.srcSubresource.aspectMask : region.dstSubresource.aspectMask;
-    if (vkuFormatPlaneCount(image_state.createInfo.format) == 2 &&
+    if (GetFormatInfo(image_state.createInfo.format).plane_count == 2 &&
         (aspect_mask != VK_IMAGE_ASPECT_PLANE_0_BIT && aspect_mask != VK_IMAGE_ASPECT_PLANE_1_BIT)) {
         const char *vuid =
             is_src ? "VUID-VkCopyImageToImageInfoEXT-srcImage-07981" : "VUID-VkCopyImageToImageInfoEXT-dstImage-07981";
@@ -3208,7 +3282,7 @@ bool CoreChecks::ValidateHostCopyMultiplane(VkDevice device, VkImageCopy2 region
                          string_VkImageAspectFlags(aspect_mask).c_str(), is_src ? "srcImage" : "dstImage",
                          string_VkFormat(image_state.createInfo.format));
     }
-    if (vkuFormatPlaneCount(image_state.createInfo.format) == 3 &&
+    if (GetFormatInfo(image_state.createInfo.format).plane_count == 3 &&
         (aspect_mask != VK_IMAGE_ASPECT_PLANE_0_BIT && aspect_mask != VK_IMAGE_ASPECT_PLANE_1_BIT &&
          aspect_mask != VK_IMAGE_ASPECT_PLANE_2_BIT)) {
         const char *vuid =
@@ -3230,8 +3304,8 @@ bool CoreChecks::PreCallValidateCopyImageToImageEXT(VkDevice device, const VkCop
     auto src_image_state = Get<vvl::Image>(info_ptr->srcImage);
     auto dst_image_state = Get<vvl::Image>(info_ptr->dstImage);
     // Formats are required to match, but check each image anyway
-    auto src_plane_count = vkuFormatPlaneCount(src_image_state->createInfo.format);
-    auto dst_plane_count = vkuFormatPlaneCount(dst_image_state->createInfo.format);
+    auto src_plane_count = GetFormatInfo(src_image_state->createInfo.format).plane_count;
+    auto dst_plane_count = GetFormatInfo(dst_image_state->createInfo.format).plane_count;
     bool check_multiplane = ((src_plane_count == 2 || src_plane_count == 3) || (dst_plane_count == 2 || dst_plane_count == 3));
     bool check_memcpy = (info_ptr->flags & VK_HOST_IMAGE_COPY_MEMCPY_EXT);
     auto regionCount = info_ptr->regionCount;
@@ -3367,6 +3441,8 @@ bool CoreChecks::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage src
 
     VkFormat src_format = src_image_state->createInfo.format;
     VkFormat dst_format = dst_image_state->createInfo.format;
+    const vvl::FormatInfo &src_format_info = GetFormatInfo(src_format);
+    const vvl::FormatInfo &dst_format_info = GetFormatInfo(dst_format);
     VkImageType src_type = src_image_state->createInfo.imageType;
     VkImageType dst_type = dst_image_state->createInfo.imageType;
 
@@ -3403,28 +3479,28 @@ bool CoreChecks::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage src
     }
 
     // Validate consistency for unsigned formats
-    if (vkuFormatIsUINT(src_format) != vkuFormatIsUINT(dst_format)) {
+    if (src_format_info.is_uint != dst_format_info.is_uint) {
         vuid = is_2 ? "VUID-VkBlitImageInfo2-srcImage-00230" : "VUID-vkCmdBlitImage-srcImage-00230";
         skip |= LogError(vuid, all_objlist, loc, "srcImage format %s is different than dstImage format %s.",
                          string_VkFormat(src_format), string_VkFormat(dst_format));
     }
 
     // Validate consistency for signed formats
-    if (vkuFormatIsSINT(src_format) != vkuFormatIsSINT(dst_format)) {
+    if (src_format_info.is_sint != dst_format_info.is_sint) {
         vuid = is_2 ? "VUID-VkBlitImageInfo2-srcImage-00229" : "VUID-vkCmdBlitImage-srcImage-00229";
         skip |= LogError(vuid, all_objlist, loc, "srcImage format %s is different than dstImage format %s.",
                          string_VkFormat(src_format), string_VkFormat(dst_format));
     }
 
     // Validate filter for Depth/Stencil formats
-    if (vkuFormatIsDepthOrStencil(src_format) && (filter != VK_FILTER_NEAREST)) {
+    if (src_format_info.IsDepthOrStencil() && (filter != VK_FILTER_NEAREST)) {
         vuid = is_2 ? "VUID-VkBlitImageInfo2-srcImage-00232" : "VUID-vkCmdBlitImage-srcImage-00232";
         skip |= LogError(vuid, src_objlist, src_image_loc, "has depth-stencil format %s but filter is %s.",
                          string_VkFormat(src_format), string_VkFilter(filter));
     }
 
     // Validate aspect bits and formats for depth/stencil images
-    if (vkuFormatIsDepthOrStencil(src_format) || vkuFormatIsDepthOrStencil(dst_format)) {
+    if (src_format_info.IsDepthOrStencil() || dst_format_info.IsDepthOrStencil()) {
         if (src_format != dst_format) {
             vuid = is_2 ? "VUID-VkBlitImageInfo2-srcImage-00231" : "VUID-vkCmdBlitImage-srcImage-00231";
             skip |= LogError(vuid, all_objlist, loc, "srcImage format %s is different than dstImage format %s.",
@@ -3669,7 +3745,7 @@ bool CoreChecks::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage src
         if (srcImage == dstImage) {
             for (uint32_t j = 0; j < regionCount; j++) {
                 if (RegionIntersectsBlit(&region, &pRegions[j], src_image_state->createInfo.imageType,
-                                         vkuFormatIsMultiplane(src_format))) {
+                                         src_format_info.IsMultiplane())) {
                     vuid = is_2 ? "VUID-VkBlitImageInfo2-pRegions-00217" : "VUID-vkCmdBlitImage-pRegions-00217";
                     skip |=
                         LogError(vuid, all_objlist, loc, "pRegion[%" PRIu32 "] src overlaps with pRegions[%" PRIu32 "] dst.", i, j);
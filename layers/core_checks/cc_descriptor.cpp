@@ -16,6 +16,7 @@
  * limitations under the License.
  */
 
+#include <optional>
 #include <valarray>
 
 #include "core_validation.h"
@@ -683,10 +684,18 @@ bool CoreChecks::PreCallValidateCreateDescriptorSetLayout(VkDevice device, const
         if ((binding_info.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER ||
              binding_info.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER) &&
             binding_info.pImmutableSamplers) {
+            // The same sampler is often repeated for the whole binding, as YCbCr samplers are, it is only looked up once
+            VkSampler checked_sampler = VK_NULL_HANDLE;
+            bool custom_border_color = false;
             for (uint32_t j = 0; j < binding_info.descriptorCount; j++) {
-                auto sampler_state = Get<vvl::Sampler>(binding_info.pImmutableSamplers[j]);
-                if (sampler_state && (sampler_state->createInfo.borderColor == VK_BORDER_COLOR_INT_CUSTOM_EXT ||
-                                      sampler_state->createInfo.borderColor == VK_BORDER_COLOR_FLOAT_CUSTOM_EXT)) {
+                if (j == 0 || binding_info.pImmutableSamplers[j] != checked_sampler) {
+                    checked_sampler = binding_info.pImmutableSamplers[j];
+                    auto sampler_state = Get<vvl::Sampler>(checked_sampler);
+                    custom_border_color =
+                        sampler_state && IsValueIn(sampler_state->createInfo.borderColor,
+                                                   {VK_BORDER_COLOR_INT_CUSTOM_EXT, VK_BORDER_COLOR_FLOAT_CUSTOM_EXT});
+                }
+                if (custom_border_color) {
                     skip |= LogError("VUID-VkDescriptorSetLayoutBinding-pImmutableSamplers-04009", device,
                                      binding_loc.dot(Field::pImmutableSamplers, j),
                                      "(%s) presented as immutable has a custom border color.",
@@ -760,9 +769,11 @@ bool CoreChecks::PreCallValidateCreateDescriptorSetLayout(VkDevice device, const
 //  This includes validating that all descriptors in the given bindings are updated,
 //  that any update buffers are valid, and that any dynamic offsets are within the bounds of their buffers.
 // Return true if state is acceptable, or false and write an error message into error string
-bool CoreChecks::ValidateDrawState(const DescriptorSet &descriptor_set, const BindingVariableMap &bindings,
+bool CoreChecks::ValidateDrawState(const DescriptorSet &descriptor_set, const BindingRequirementList &bindings,
                                    const std::vector<uint32_t> &dynamic_offsets, const vvl::CommandBuffer &cb_state,
-                                   const Location &loc, const vvl::DrawDispatchVuid &vuids) const {
+                                   const Location &loc, const vvl::DrawDispatchVuid &vuids,
+                                   std::optional<uint64_t> changed_since) const {
+    auto check_scope = ProfileCheck(vvl::ValidationCheck::ValidateDrawState);
     bool result = false;
     VkFramebuffer framebuffer = cb_state.activeFramebuffer ? cb_state.activeFramebuffer->framebuffer() : VK_NULL_HANDLE;
     // NOTE: GPU-AV needs non-const state objects to do lazy updates of descriptor state of only the dynamically used
@@ -771,22 +782,21 @@ bool CoreChecks::ValidateDrawState(const DescriptorSet &descriptor_set, const Bi
     const vvl::DescriptorValidator desc_val(const_cast<CoreChecks &>(*this), const_cast<vvl::CommandBuffer &>(cb_state),
                                             const_cast<DescriptorSet &>(descriptor_set), framebuffer, loc);
 
-    for (const auto &binding_pair : bindings) {
-        const auto *binding = descriptor_set.GetBinding(binding_pair.first);
+    for (const auto &binding_info : bindings) {
+        const auto *binding = descriptor_set.GetBinding(binding_info.first);
         if (!binding) {  //  End at construction is the condition for an invalid binding.
             auto set = descriptor_set.Handle();
             result |= LogError(vuids.descriptor_buffer_bit_set_08114, set, loc, "%s binding #%" PRIu32 " is invalid.",
-                               FormatHandle(set).c_str(), binding_pair.first);
+                               FormatHandle(set).c_str(), binding_info.first);
             return result;
         }
 
         if (descriptor_set.SkipBinding(*binding)) {
             continue;
         }
-        vvl::DescriptorBindingInfo binding_info;
-        binding_info.first = binding_pair.first;
-        binding_info.second.emplace_back(binding_pair.second);
-
+        if (changed_since && binding->change_count <= *changed_since) {
+            continue;
+        }
         result |= desc_val.ValidateBinding(binding_info, *binding);
     }
     return result;
@@ -1377,95 +1387,135 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t descriptorWriteCount, con
     return skip;
 }
 
-vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationStateTracker *device_data,
-                                                              VkDescriptorSet descriptorSet,
-                                                              const vvl::DescriptorUpdateTemplate *template_state,
-                                                              const void *pData, VkDescriptorSetLayout push_layout) {
+// Size of one descriptor in pData, 0 for the inline uniform blocks that are a single array of bytes
+static size_t TemplateDescriptorSize(VkDescriptorType type) {
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            return sizeof(VkDescriptorImageInfo);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return sizeof(VkDescriptorBufferInfo);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return sizeof(VkBufferView);
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            return sizeof(VkAccelerationStructureKHR);
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+            return sizeof(VkAccelerationStructureNV);
+        default:
+            return 0;
+    }
+}
+
+vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationStateTracker *device_data, VkDescriptorSet descriptorSet,
+                                                  const vvl::DescriptorUpdateTemplate *template_state, const void *pData,
+                                                  VkDescriptorSetLayout push_layout) {
     auto const &create_info = template_state->create_info;
-    inline_infos.resize(create_info.descriptorUpdateEntryCount);  // Make sure we have one if we need it
-    inline_infos_khr.resize(create_info.descriptorUpdateEntryCount);
-    inline_infos_nv.resize(create_info.descriptorUpdateEntryCount);
-    desc_writes.reserve(create_info.descriptorUpdateEntryCount);  // emplaced, so reserved without initialization
-    VkDescriptorSetLayout effective_dsl = create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
-                                              ? create_info.descriptorSetLayout
-                                              : push_layout;
-    auto layout_obj = device_data->Get<vvl::DescriptorSetLayout>(effective_dsl);
-
-    // Create a WriteDescriptorSet struct for each template update entry
-    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
-        auto binding_count = layout_obj->GetDescriptorCountFromBinding(create_info.pDescriptorUpdateEntries[i].dstBinding);
-        auto binding_being_updated = create_info.pDescriptorUpdateEntries[i].dstBinding;
-        auto dst_array_element = create_info.pDescriptorUpdateEntries[i].dstArrayElement;
-
-        desc_writes.reserve(desc_writes.size() + create_info.pDescriptorUpdateEntries[i].descriptorCount);
-        for (uint32_t j = 0; j < create_info.pDescriptorUpdateEntries[i].descriptorCount; j++) {
+    std::vector<TemplateUpdateChunk> push_chunks;
+    if (create_info.templateType != VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        if (auto layout_obj = device_data->Get<vvl::DescriptorSetLayout>(push_layout)) {
+            push_chunks = DecodeTemplateChunks(*create_info.ptr(), *layout_obj);
+        }
+    }
+    const auto &chunks = create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET ? template_state->chunks
+                                                                                                       : push_chunks;
+
+    // A chunk of tightly packed descriptors is a single write, interleaved descriptors need a write each
+    auto is_packed = [](const TemplateUpdateChunk &chunk) {
+        return chunk.descriptor_count == 1 || chunk.stride == TemplateDescriptorSize(chunk.type) ||
+               chunk.type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK;
+    };
+    size_t write_count = 0;
+    size_t inline_count = 0;
+    size_t khr_count = 0;
+    size_t nv_count = 0;
+    for (const auto &chunk : chunks) {
+        const size_t chunk_writes = is_packed(chunk) ? 1 : chunk.descriptor_count;
+        write_count += chunk_writes;
+        if (chunk.type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK) {
+            inline_count += chunk_writes;
+        } else if (chunk.type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR) {
+            khr_count += chunk_writes;
+        } else if (chunk.type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV) {
+            nv_count += chunk_writes;
+        }
+    }
+    // Sized up front, the writes point to their elements
+    inline_infos.resize(inline_count);
+    inline_infos_khr.resize(khr_count);
+    inline_infos_nv.resize(nv_count);
+    desc_writes.reserve(write_count);  // emplaced, so reserved without initialization
+    inline_count = khr_count = nv_count = 0;
+
+    for (const auto &chunk : chunks) {
+        const bool packed = is_packed(chunk);
+        const uint32_t descriptor_count = packed ? chunk.descriptor_count : 1;
+        const uint32_t chunk_writes = packed ? 1 : chunk.descriptor_count;
+        for (uint32_t j = 0; j < chunk_writes; j++) {
             desc_writes.emplace_back();
             auto &write_entry = desc_writes.back();
 
-            size_t offset = create_info.pDescriptorUpdateEntries[i].offset + j * create_info.pDescriptorUpdateEntries[i].stride;
-            char *update_entry = (char *)(pData) + offset;
-
-            if (dst_array_element >= binding_count) {
-                dst_array_element = 0;
-                binding_being_updated = layout_obj->GetNextValidBinding(binding_being_updated);
-            }
+            const char *update_entry = static_cast<const char *>(pData) + chunk.offset + j * chunk.stride;
 
             write_entry.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
             write_entry.pNext = NULL;
             write_entry.dstSet = descriptorSet;
-            write_entry.dstBinding = binding_being_updated;
-            write_entry.dstArrayElement = dst_array_element;
-            write_entry.descriptorCount = 1;
-            write_entry.descriptorType = create_info.pDescriptorUpdateEntries[i].descriptorType;
+            write_entry.dstBinding = chunk.dst_binding;
+            write_entry.dstArrayElement = chunk.dst_array_element + j;
+            // descriptorCount must match the dataSize member of the VkWriteDescriptorSetInlineUniformBlock structure
+            write_entry.descriptorCount = descriptor_count;
+            write_entry.descriptorType = chunk.type;
 
-            switch (create_info.pDescriptorUpdateEntries[i].descriptorType) {
+            switch (chunk.type) {
                 case VK_DESCRIPTOR_TYPE_SAMPLER:
                 case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
                 case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
                 case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
                 case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-                    write_entry.pImageInfo = reinterpret_cast<VkDescriptorImageInfo *>(update_entry);
+                    write_entry.pImageInfo = reinterpret_cast<const VkDescriptorImageInfo *>(update_entry);
                     break;
 
                 case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
                 case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
                 case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
                 case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-                    write_entry.pBufferInfo = reinterpret_cast<VkDescriptorBufferInfo *>(update_entry);
+                    write_entry.pBufferInfo = reinterpret_cast<const VkDescriptorBufferInfo *>(update_entry);
                     break;
 
                 case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
                 case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                    write_entry.pTexelBufferView = reinterpret_cast<VkBufferView *>(update_entry);
+                    write_entry.pTexelBufferView = reinterpret_cast<const VkBufferView *>(update_entry);
                     break;
                 case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT: {
-                    VkWriteDescriptorSetInlineUniformBlock *inline_info = &inline_infos[i];
+                    VkWriteDescriptorSetInlineUniformBlock *inline_info = &inline_infos[inline_count++];
                     inline_info->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT;
                     inline_info->pNext = nullptr;
-                    inline_info->dataSize = create_info.pDescriptorUpdateEntries[i].descriptorCount;
+                    inline_info->dataSize = chunk.descriptor_count;
                     inline_info->pData = update_entry;
                     write_entry.pNext = inline_info;
-                    // descriptorCount must match the dataSize member of the VkWriteDescriptorSetInlineUniformBlock structure
-                    write_entry.descriptorCount = inline_info->dataSize;
-                    // skip the rest of the array, they just represent bytes in the update
-                    j = create_info.pDescriptorUpdateEntries[i].descriptorCount;
                     break;
                 }
                 case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: {
-                    VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr = &inline_infos_khr[i];
+                    VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr = &inline_infos_khr[khr_count++];
                     inline_info_khr->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
                     inline_info_khr->pNext = nullptr;
-                    inline_info_khr->accelerationStructureCount = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                    inline_info_khr->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureKHR *>(update_entry);
+                    inline_info_khr->accelerationStructureCount = descriptor_count;
+                    inline_info_khr->pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureKHR *>(update_entry);
                     write_entry.pNext = inline_info_khr;
                     break;
                 }
                 case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV: {
-                    VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv = &inline_infos_nv[i];
+                    VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv = &inline_infos_nv[nv_count++];
                     inline_info_nv->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
                     inline_info_nv->pNext = nullptr;
-                    inline_info_nv->accelerationStructureCount = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                    inline_info_nv->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureNV *>(update_entry);
+                    inline_info_nv->accelerationStructureCount = descriptor_count;
+                    inline_info_nv->pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureNV *>(update_entry);
                     write_entry.pNext = inline_info_nv;
                     break;
                 }
@@ -1473,7 +1523,6 @@ vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationStateTracker *
                     assert(0);
                     break;
             }
-            dst_array_element++;
         }
     }
 }
@@ -1626,67 +1675,80 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet &update, con
         }
     }
 
+    // Copies of large ranges mostly repeat the same few resources, so a run of source descriptors that hold the same
+    // resource is only validated (and reported) once, for its first descriptor
     switch (src_set.GetBinding(update.srcBinding)->descriptor_class) {
         case DescriptorClass::PlainSampler: {
             auto src_iter = src_set.FindDescriptor(update.srcBinding, update.srcArrayElement);
-            for (uint32_t di = 0; di < update.descriptorCount; ++di) {
-                if (src_iter.updated()) {
-                    if (!src_iter->IsImmutableSampler()) {
-                        auto update_sampler = static_cast<const SamplerDescriptor &>(*src_iter).GetSampler();
-                        if (!ValidateSampler(update_sampler)) {
-                            const LogObjectList objlist(update.srcSet, update_sampler);
-                            skip |= LogError("VUID-VkWriteDescriptorSet-descriptorType-00325", objlist, copy_loc,
-                                             "Attempted copy update to sampler descriptor with invalid sampler (%s).",
-                                             FormatHandle(update_sampler).c_str());
-                        }
-                    }
+            std::optional<VkSampler> last_sampler;
+            for (uint32_t di = 0; di < update.descriptorCount; ++di, ++src_iter) {
+                if (!src_iter.updated() || src_iter->IsImmutableSampler()) continue;
+                auto update_sampler = static_cast<const SamplerDescriptor &>(*src_iter).GetSampler();
+                if (last_sampler == update_sampler) continue;
+                last_sampler = update_sampler;
+                if (!ValidateSampler(update_sampler)) {
+                    const LogObjectList objlist(update.srcSet, update_sampler);
+                    skip |= LogError("VUID-VkWriteDescriptorSet-descriptorType-00325", objlist, copy_loc,
+                                     "Attempted copy update to sampler descriptor with invalid sampler (%s).",
+                                     FormatHandle(update_sampler).c_str());
                 }
             }
             break;
         }
         case DescriptorClass::ImageSampler: {
             auto src_iter = src_set.FindDescriptor(update.srcBinding, update.srcArrayElement);
+            std::optional<VkSampler> last_sampler;
+            VkImageView last_image_view = VK_NULL_HANDLE;
+            VkImageLayout last_image_layout = VK_IMAGE_LAYOUT_UNDEFINED;
             for (uint32_t di = 0; di < update.descriptorCount; ++di, ++src_iter) {
                 if (!src_iter.updated()) continue;
-                auto img_samp_desc = static_cast<const ImageSamplerDescriptor &>(*src_iter);
+                const auto &img_samp_desc = static_cast<const ImageSamplerDescriptor &>(*src_iter);
                 // First validate sampler
                 if (!img_samp_desc.IsImmutableSampler()) {
                     auto update_sampler = img_samp_desc.GetSampler();
-                    if (!ValidateSampler(update_sampler)) {
+                    if (last_sampler != update_sampler && !ValidateSampler(update_sampler)) {
                         const LogObjectList objlist(update.srcSet);
                         skip |= LogError("VUID-VkWriteDescriptorSet-descriptorType-00325", objlist, copy_loc,
                                          "Attempted copy update to sampler descriptor with invalid sampler (%s).",
                                          FormatHandle(update_sampler).c_str());
                     }
+                    last_sampler = update_sampler;
                 }
                 // Validate image
                 auto image_view = img_samp_desc.GetImageView();
                 auto image_layout = img_samp_desc.GetImageLayout();
-                if (image_view) {
+                if (image_view && (image_view != last_image_view || image_layout != last_image_layout)) {
                     skip |= ValidateImageUpdate(image_view, image_layout, src_type, copy_loc);
                 }
+                last_image_view = image_view;
+                last_image_layout = image_layout;
             }
             break;
         }
         case DescriptorClass::Image: {
             auto src_iter = src_set.FindDescriptor(update.srcBinding, update.srcArrayElement);
+            VkImageView last_image_view = VK_NULL_HANDLE;
+            VkImageLayout last_image_layout = VK_IMAGE_LAYOUT_UNDEFINED;
             for (uint32_t di = 0; di < update.descriptorCount; ++di, ++src_iter) {
                 if (!src_iter.updated()) continue;
-                auto img_desc = static_cast<const ImageDescriptor &>(*src_iter);
+                const auto &img_desc = static_cast<const ImageDescriptor &>(*src_iter);
                 auto image_view = img_desc.GetImageView();
                 auto image_layout = img_desc.GetImageLayout();
-                if (image_view) {
+                if (image_view && (image_view != last_image_view || image_layout != last_image_layout)) {
                     skip |= ValidateImageUpdate(image_view, image_layout, src_type, copy_loc);
                 }
+                last_image_view = image_view;
+                last_image_layout = image_layout;
             }
             break;
         }
         case DescriptorClass::TexelBuffer: {
             auto src_iter = src_set.FindDescriptor(update.srcBinding, update.srcArrayElement);
+            VkBufferView last_buffer_view = VK_NULL_HANDLE;
             for (uint32_t di = 0; di < update.descriptorCount; ++di, ++src_iter) {
                 if (!src_iter.updated()) continue;
                 auto buffer_view = static_cast<const TexelDescriptor &>(*src_iter).GetBufferView();
-                if (buffer_view) {
+                if (buffer_view && buffer_view != last_buffer_view) {
                     auto bv_state = device_data->Get<vvl::BufferView>(buffer_view);
                     if (!bv_state) {
                         const LogObjectList objlist(update.srcSet);
@@ -1700,17 +1762,20 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet &update, con
                         }
                     }
                 }
+                last_buffer_view = buffer_view;
             }
             break;
         }
         case DescriptorClass::GeneralBuffer: {
             auto src_iter = src_set.FindDescriptor(update.srcBinding, update.srcArrayElement);
+            const vvl::Buffer *last_buffer_state = nullptr;
             for (uint32_t di = 0; di < update.descriptorCount; ++di, ++src_iter) {
                 if (!src_iter.updated()) continue;
                 auto buffer_state = static_cast<const BufferDescriptor &>(*src_iter).GetBufferState();
-                if (buffer_state) {
+                if (buffer_state && buffer_state != last_buffer_state) {
                     skip |= ValidateBufferUsage(*buffer_state, src_type, copy_loc);
                 }
+                last_buffer_state = buffer_state;
             }
             break;
         }
@@ -1904,7 +1969,8 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet &dst_set, const V
 
                 if (IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion)) {
                     if (desc.IsImmutableSampler()) {
-                        auto sampler_state = Get<vvl::Sampler>(desc.GetSampler());
+                        // The descriptor already holds the state of its immutable sampler
+                        const vvl::Sampler *sampler_state = desc.GetSamplerState();
                         if (iv_state && sampler_state) {
                             if (iv_state->samplerConversion != sampler_state->samplerConversion) {
                                 const LogObjectList objlist(update.dstSet, desc.GetSampler(), iv_state->image_view());
@@ -2885,24 +2951,15 @@ bool CoreChecks::ValidateGetDescriptorDataSize(const VkDescriptorGetInfoEXT &des
         if (combined_image_sampler->imageView != VK_NULL_HANDLE) {
             const auto image_view_state = Get<vvl::ImageView>(combined_image_sampler->imageView);
             if (image_view_state && image_view_state->samplerConversion != VK_NULL_HANDLE) {
-                auto image_info = image_view_state->image_state->createInfo;
-                VkPhysicalDeviceImageFormatInfo2 image_format_info = vku::InitStructHelper();
-                image_format_info.type = image_info.imageType;
-                image_format_info.format = image_info.format;
-                image_format_info.tiling = image_info.tiling;
-                image_format_info.usage = image_view_state->inherited_usage;
-                image_format_info.flags = image_info.flags;
-                VkSamplerYcbcrConversionImageFormatProperties sampler_ycbcr_image_format_info = vku::InitStructHelper();
-                VkImageFormatProperties2 image_format_properties = vku::InitStructHelper(&sampler_ycbcr_image_format_info);
-                DispatchGetPhysicalDeviceImageFormatProperties2(physical_device, &image_format_info, &image_format_properties);
-                size *= static_cast<size_t>(sampler_ycbcr_image_format_info.combinedImageSamplerDescriptorCount);
+                const uint32_t combined_image_sampler_descriptor_count = GetCombinedImageSamplerDescriptorCount(*image_view_state);
+                size *= static_cast<size_t>(combined_image_sampler_descriptor_count);
                 if (size != data_size) {
                     skip |= LogError("VUID-vkGetDescriptorEXT-descriptorType-09469", device, descriptor_info_loc.dot(Field::type),
                                      "(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER) has %s and descriptor size is %zu "
                                      "[combinedImageSamplerDescriptorCount (%" PRIu32
                                      ") times combinedImageSamplerDescriptorSize (%zu)], but dataSize is %zu",
                                      FormatHandle(image_view_state->samplerConversion).c_str(), size,
-                                     sampler_ycbcr_image_format_info.combinedImageSamplerDescriptorCount,
+                                     combined_image_sampler_descriptor_count,
                                      phys_dev_ext_props.descriptor_buffer_props.combinedImageSamplerDescriptorSize, data_size);
                 }
                 return skip;  // the 08125 VU doesn't apply if we are using a SamplerYcbcrConversion
@@ -2928,6 +2985,28 @@ bool CoreChecks::ValidateGetDescriptorDataSize(const VkDescriptorGetInfoEXT &des
     return skip;
 }
 
+uint32_t CoreChecks::GetCombinedImageSamplerDescriptorCount(const vvl::ImageView &image_view_state) const {
+    const auto &image_info = image_view_state.image_state->createInfo;
+    const YcbcrImageFormatKey key{image_info.format, image_info.tiling, image_info.imageType, image_view_state.inherited_usage,
+                                  image_info.flags};
+    const auto cached = combined_image_sampler_descriptor_counts.find(key);
+    if (cached != combined_image_sampler_descriptor_counts.end()) {
+        return cached->second;
+    }
+
+    VkPhysicalDeviceImageFormatInfo2 image_format_info = vku::InitStructHelper();
+    image_format_info.type = key.type;
+    image_format_info.format = key.format;
+    image_format_info.tiling = key.tiling;
+    image_format_info.usage = key.usage;
+    image_format_info.flags = key.flags;
+    VkSamplerYcbcrConversionImageFormatProperties sampler_ycbcr_image_format_info = vku::InitStructHelper();
+    VkImageFormatProperties2 image_format_properties = vku::InitStructHelper(&sampler_ycbcr_image_format_info);
+    DispatchGetPhysicalDeviceImageFormatProperties2(physical_device, &image_format_info, &image_format_properties);
+    combined_image_sampler_descriptor_counts.insert(key, sampler_ycbcr_image_format_info.combinedImageSamplerDescriptorCount);
+    return sampler_ycbcr_image_format_info.combinedImageSamplerDescriptorCount;
+}
+
 bool CoreChecks::PreCallValidateGetDescriptorEXT(VkDevice device, const VkDescriptorGetInfoEXT *pDescriptorInfo, size_t dataSize,
                                                  void *pDescriptor, const ErrorObject &error_obj) const {
     bool skip = false;
@@ -4389,10 +4468,17 @@ bool CoreChecks::PreCallValidateCreatePipelineLayout(VkDevice device, const VkPi
                 if (((binding->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER) ||
                      (binding->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER)) &&
                     (binding->pImmutableSamplers != nullptr)) {
+                    VkSampler checked_sampler = VK_NULL_HANDLE;
+                    bool subsampled = false;
                     for (uint32_t sampler_idx = 0; sampler_idx < binding->descriptorCount; sampler_idx++) {
-                        auto state = Get<vvl::Sampler>(binding->pImmutableSamplers[sampler_idx]);
-                        if (state && (state->createInfo.flags & (VK_SAMPLER_CREATE_SUBSAMPLED_BIT_EXT |
-                                                                 VK_SAMPLER_CREATE_SUBSAMPLED_COARSE_RECONSTRUCTION_BIT_EXT))) {
+                        if (sampler_idx == 0 || binding->pImmutableSamplers[sampler_idx] != checked_sampler) {
+                            checked_sampler = binding->pImmutableSamplers[sampler_idx];
+                            auto state = Get<vvl::Sampler>(checked_sampler);
+                            subsampled = state && (state->createInfo.flags &
+                                                   (VK_SAMPLER_CREATE_SUBSAMPLED_BIT_EXT |
+                                                    VK_SAMPLER_CREATE_SUBSAMPLED_COARSE_RECONSTRUCTION_BIT_EXT)) != 0;
+                        }
+                        if (subsampled) {
                             sum_subsampled_samplers++;
                         }
                     }
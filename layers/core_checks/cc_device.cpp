@@ -19,7 +19,6 @@
  * This file deals with anything related to Phyiscal Devices, Logical Devices, or Device Queues Families, Device Masks, etc
  */
 
-#include <fstream>
 #include <vector>
 
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
@@ -84,9 +83,9 @@ bool CoreChecks::GetPhysicalDeviceImageFormatProperties(vvl::Image &image_state,
     VkResult image_properties_result = VK_SUCCESS;
     Func command = Func::vkGetPhysicalDeviceImageFormatProperties;
     if (image_create_info.tiling != VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
-        image_properties_result = DispatchGetPhysicalDeviceImageFormatProperties(
-            physical_device, image_create_info.format, image_create_info.imageType, image_create_info.tiling,
-            image_create_info.usage, image_create_info.flags, &image_state.image_format_properties);
+        image_properties_result = physical_device_state->GetImageFormatProperties(
+            image_create_info.format, image_create_info.imageType, image_create_info.tiling, image_create_info.usage,
+            image_create_info.flags, &image_state.image_format_properties);
     } else {
         command = Func::vkGetPhysicalDeviceImageFormatProperties2;
         VkPhysicalDeviceImageFormatInfo2 image_format_info = vku::InitStructHelper();
@@ -119,8 +118,7 @@ bool CoreChecks::GetPhysicalDeviceImageFormatProperties(vvl::Image &image_state,
 bool CoreChecks::ValidateDeviceMaskToPhysicalDeviceCount(uint32_t deviceMask, const LogObjectList &objlist, const Location loc,
                                                          const char *vuid) const {
     bool skip = false;
-    uint32_t count = 1 << physical_device_count;
-    if (count <= deviceMask) {
+    if ((deviceMask & ~physical_device_mask) != 0) {
         skip |= LogError(vuid, objlist, loc, "(0x%" PRIx32 ") is invalid, Physical device count is %" PRIu32 ".", deviceMask,
                          physical_device_count);
     }
@@ -444,6 +442,16 @@ void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
             cb_state->SetImageViewInitialLayout(iv_state, layout);
         });
 
+    spirv_val_context = spvContextCreate(PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4)));
+    AdjustValidatorOptions(device_extensions, enabled_features, spirv_val_options);
+    if (enabled[async_shader_validation] && !disabled[shader_validation]) {
+        spirv_val_queue = std::make_unique<vvl::TaskQueue>(std::max(1u, vvl::WorkerPool::WorkerCount(0)));
+    }
+    const uint32_t worker_count = vvl::WorkerPool::WorkerCount(0);
+    if (worker_count > 0) {
+        pipeline_workers = std::make_unique<vvl::WorkerPool>(worker_count);
+    }
+
     // Allocate shader validation cache
     if (!disabled[shader_validation_caching] && !disabled[shader_validation] && !core_validation_cache) {
         auto tmp_path = GetTempFilePath();
@@ -453,23 +461,14 @@ void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
 #endif
         validation_cache_path += ".bin";
 
-        std::vector<char> validation_cache_data;
-        std::ifstream read_file(validation_cache_path.c_str(), std::ios::in | std::ios::binary);
-
-        if (read_file) {
-            std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(validation_cache_data));
-            read_file.close();
-        } else {
-            Location loc(Func::vkCreateDevice);
-            LogInfo("WARNING-cache-file-error", device, loc,
-                    "Cannot open shader validation cache at %s for reading (it may not exist yet)", validation_cache_path.c_str());
-        }
-
         VkValidationCacheCreateInfoEXT cacheCreateInfo = vku::InitStructHelper();
-        cacheCreateInfo.initialDataSize = validation_cache_data.size();
-        cacheCreateInfo.pInitialData = validation_cache_data.data();
-        cacheCreateInfo.flags = 0;
         CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
+        // Every shader that passes is appended to the file right away, so the cache survives an abnormal exit
+        if (!CastFromHandle<ValidationCache *>(core_validation_cache)->OpenFile(validation_cache_path)) {
+            Location loc(Func::vkCreateDevice);
+            LogInfo("WARNING-cache-file-error", device, loc, "Cannot open shader validation cache at %s, it is only kept in memory",
+                    validation_cache_path.c_str());
+        }
     }
 }
 
@@ -479,39 +478,17 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
 
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 
-    if (core_validation_cache) {
-        Location loc(Func::vkDestroyDevice);
-        size_t validation_cache_size = 0;
-        void *validation_cache_data = nullptr;
-
-        CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, nullptr);
-
-        validation_cache_data = (char *)malloc(sizeof(char) * validation_cache_size);
-        if (!validation_cache_data) {
-            LogInfo("WARNING-cache-memory-error", device, loc, "Validation Cache Memory Error");
-            return;
-        }
-
-        VkResult result =
-            CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, validation_cache_data);
-
-        if (result != VK_SUCCESS) {
-            LogInfo("WARNING-cache-retrieval-error", device, loc, "Validation Cache Retrieval Error");
-            free(validation_cache_data);
-            return;
-        }
+    // The background spirv-val still running uses the context
+    spirv_val_queue.reset();
+    pending_spirv_validation.clear();
+    pipeline_workers.reset();
+    if (spirv_val_context) {
+        spvContextDestroy(spirv_val_context);
+        spirv_val_context = nullptr;
+    }
 
-        if (validation_cache_path.size() > 0) {
-            std::ofstream write_file(validation_cache_path.c_str(), std::ios::out | std::ios::binary);
-            if (write_file) {
-                write_file.write(static_cast<char *>(validation_cache_data), validation_cache_size);
-                write_file.close();
-            } else {
-                LogInfo("WARNING-cache-write-error", device, loc, "Cannot open shader validation cache at %s for writing",
-                        validation_cache_path.c_str());
-            }
-        }
-        free(validation_cache_data);
+    if (core_validation_cache) {
+        // Already in the file, which was appended to as the cache was filled
         CoreLayerDestroyValidationCacheEXT(device, core_validation_cache, NULL);
     }
 }
@@ -635,22 +612,7 @@ bool CoreChecks::PreCallValidateGetPhysicalDeviceImageFormatProperties2KHR(VkPhy
 
 // Access helper functions for external modules
 VkFormatProperties3KHR CoreChecks::GetPDFormatProperties(const VkFormat format) const {
-    VkFormatProperties3KHR fmt_props_3 = vku::InitStructHelper();
-    VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
-
-    if (has_format_feature2) {
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
-        fmt_props_3.linearTilingFeatures |= fmt_props_2.formatProperties.linearTilingFeatures;
-        fmt_props_3.optimalTilingFeatures |= fmt_props_2.formatProperties.optimalTilingFeatures;
-        fmt_props_3.bufferFeatures |= fmt_props_2.formatProperties.bufferFeatures;
-    } else {
-        VkFormatProperties format_properties;
-        DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
-        fmt_props_3.linearTilingFeatures = format_properties.linearTilingFeatures;
-        fmt_props_3.optimalTilingFeatures = format_properties.optimalTilingFeatures;
-        fmt_props_3.bufferFeatures = format_properties.bufferFeatures;
-    }
-    return fmt_props_3;
+    return format_table.GetFormatProperties(format);
 }
 
 VkResult CoreChecks::CoreLayerCreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT *pCreateInfo,
@@ -677,6 +639,9 @@ VkResult CoreChecks::CoreLayerMergeValidationCachesEXT(VkDevice device, VkValida
     bool skip = false;
     auto dst = CastFromHandle<ValidationCache *>(dstCache);
     VkResult result = VK_SUCCESS;
+    // The sources before the first bad one are merged, all of them in a single pass
+    std::vector<const ValidationCache *> srcs;
+    srcs.reserve(srcCacheCount);
     for (uint32_t i = 0; i < srcCacheCount; i++) {
         auto src = CastFromHandle<const ValidationCache *>(pSrcCaches[i]);
         if (src == dst) {
@@ -686,9 +651,10 @@ VkResult CoreChecks::CoreLayerMergeValidationCachesEXT(VkDevice device, VkValida
             result = VK_ERROR_VALIDATION_FAILED_EXT;
         }
         if (!skip) {
-            dst->Merge(src);
+            srcs.push_back(src);
         }
     }
+    dst->Merge(srcs.data(), static_cast<uint32_t>(srcs.size()));
 
     return result;
 }
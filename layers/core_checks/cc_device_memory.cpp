@@ -1087,91 +1087,92 @@ bool CoreChecks::PreCallValidateUnmapMemory2KHR(VkDevice device, const VkMemoryU
     return skip;
 }
 
-bool CoreChecks::ValidateMemoryIsMapped(uint32_t memoryRangeCount, const VkMappedMemoryRange *pMemoryRanges,
-                                        const ErrorObject &error_obj) const {
+bool CoreChecks::ValidateMappedMemoryRanges(uint32_t memory_range_count, const VkMappedMemoryRange *memory_ranges,
+                                            const ErrorObject &error_obj) const {
     bool skip = false;
-    for (uint32_t i = 0; i < memoryRangeCount; ++i) {
-        const Location memory_range_loc = error_obj.location.dot(Field::pMemoryRanges, i);
-        auto mem_info = Get<vvl::DeviceMemory>(pMemoryRanges[i].memory);
-        if (!mem_info) {
-            continue;
-        }
-        // Makes sure the memory is already mapped
-        if (mem_info->mapped_range.size == 0) {
-            skip = LogError("VUID-VkMappedMemoryRange-memory-00684", pMemoryRanges[i].memory, memory_range_loc,
-                            "Attempting to use memory (%s) that is not currently host mapped.",
-                            FormatHandle(pMemoryRanges[i].memory).c_str());
-        }
+    const uint64_t atom_size = phys_dev_props.limits.nonCoherentAtomSize;
 
-        if (pMemoryRanges[i].size == VK_WHOLE_SIZE) {
-            if (mem_info->mapped_range.offset > pMemoryRanges[i].offset) {
-                skip |=
-                    LogError("VUID-VkMappedMemoryRange-size-00686", pMemoryRanges[i].memory, memory_range_loc.dot(Field::offset),
-                             "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is VK_WHOLE_SIZE).",
-                             pMemoryRanges[i].offset, mem_info->mapped_range.offset);
-            }
-        } else {
-            if (mem_info->mapped_range.offset > pMemoryRanges[i].offset) {
-                skip |=
-                    LogError("VUID-VkMappedMemoryRange-size-00685", pMemoryRanges[i].memory, memory_range_loc.dot(Field::offset),
-                             "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is not VK_WHOLE_SIZE).",
-                             pMemoryRanges[i].offset, mem_info->mapped_range.offset);
-            }
-            const uint64_t data_end = (mem_info->mapped_range.size == VK_WHOLE_SIZE)
-                                          ? mem_info->alloc_info.allocationSize
-                                          : (mem_info->mapped_range.offset + mem_info->mapped_range.size);
-            if ((data_end < (pMemoryRanges[i].offset + pMemoryRanges[i].size))) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-00685", pMemoryRanges[i].memory, memory_range_loc,
-                                 "size (%" PRIu64 ") plus offset (%" PRIu64
-                                 ") "
-                                 "exceed the Memory Object's upper-bound (%" PRIu64 ").",
-                                 pMemoryRanges[i].size, pMemoryRanges[i].offset, data_end);
-            }
-        }
+    // Streaming writes flush hundreds of ranges at once. nonCoherentAtomSize is a power of two, so all the offsets and sizes are
+    // checked for alignment in one pass, and each range is only checked on its own if one of them is not a multiple of it.
+    VkDeviceSize unaligned_bits = 0;
+    for (uint32_t i = 0; i < memory_range_count; ++i) {
+        unaligned_bits |= memory_ranges[i].offset | (memory_ranges[i].size == VK_WHOLE_SIZE ? 0 : memory_ranges[i].size);
     }
-    return skip;
-}
+    const bool all_aligned = IsPowerOfTwo(atom_size) && (unaligned_bits & (atom_size - 1)) == 0;
 
-bool CoreChecks::ValidateMappedMemoryRangeDeviceLimits(uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges,
-                                                       const ErrorObject &error_obj) const {
-    bool skip = false;
-    for (uint32_t i = 0; i < mem_range_count; ++i) {
+    // The ranges are usually all in the same memory, it is only looked up again when the memory changes
+    std::shared_ptr<const vvl::DeviceMemory> mem_info;
+    vvl::MemRange mapped_range;
+    for (uint32_t i = 0; i < memory_range_count; ++i) {
+        const VkMappedMemoryRange &memory_range = memory_ranges[i];
         const Location memory_range_loc = error_obj.location.dot(Field::pMemoryRanges, i);
-        const uint64_t atom_size = phys_dev_props.limits.nonCoherentAtomSize;
-        const VkDeviceSize offset = mem_ranges[i].offset;
-        const VkDeviceSize size = mem_ranges[i].size;
+        const VkDeviceSize offset = memory_range.offset;
+        const VkDeviceSize size = memory_range.size;
 
-        if (SafeModulo(offset, atom_size) != 0) {
-            skip |= LogError("VUID-VkMappedMemoryRange-offset-00687", mem_ranges->memory, memory_range_loc.dot(Field::offset),
+        if (!all_aligned && SafeModulo(offset, atom_size) != 0) {
+            skip |= LogError("VUID-VkMappedMemoryRange-offset-00687", memory_range.memory, memory_range_loc.dot(Field::offset),
                              "(%" PRIu64 ") is not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64 ").",
                              offset, atom_size);
         }
-        auto mem_info = Get<vvl::DeviceMemory>(mem_ranges[i].memory);
+        if (!mem_info || mem_info->deviceMemory() != memory_range.memory) {
+            mem_info = Get<vvl::DeviceMemory>(memory_range.memory);
+            if (mem_info) {
+                mapped_range = mem_info->mapped_range;
+            }
+        }
         if (!mem_info) {
             continue;
         }
+
         const auto allocation_size = mem_info->alloc_info.allocationSize;
+        const auto mapping_end =
+            (mapped_range.size == VK_WHOLE_SIZE) ? allocation_size : (mapped_range.offset + mapped_range.size);
         if (size == VK_WHOLE_SIZE) {
-            const auto mapping_offset = mem_info->mapped_range.offset;
-            const auto mapping_size = mem_info->mapped_range.size;
-            const auto mapping_end = ((mapping_size == VK_WHOLE_SIZE) ? allocation_size : mapping_offset + mapping_size);
             if (SafeModulo(mapping_end, atom_size) != 0 && mapping_end != allocation_size) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-01389", mem_ranges->memory, memory_range_loc.dot(Field::size),
+                skip |= LogError("VUID-VkMappedMemoryRange-size-01389", memory_range.memory, memory_range_loc.dot(Field::size),
                                  "is VK_WHOLE_SIZE and the mapping end (%" PRIu64 " = %" PRIu64 " + %" PRIu64
                                  ") not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64
                                  ") and not equal to the end of the memory object (%" PRIu64 ").",
-                                 mapping_end, mapping_offset, mapping_size, atom_size, allocation_size);
+                                 mapping_end, mapped_range.offset, mapped_range.size, atom_size, allocation_size);
             }
-        } else {
+        } else if (!all_aligned) {
             const auto range_end = size + offset;
             if (range_end != allocation_size && SafeModulo(size, atom_size) != 0) {
-                skip |= LogError("VUID-VkMappedMemoryRange-size-01390", mem_ranges->memory, memory_range_loc.dot(Field::size),
+                skip |= LogError("VUID-VkMappedMemoryRange-size-01390", memory_range.memory, memory_range_loc.dot(Field::size),
                                  "(%" PRIu64 ") is not a multiple of VkPhysicalDeviceLimits::nonCoherentAtomSize (%" PRIu64
                                  ") and offset + size (%" PRIu64 " + %" PRIu64 " = %" PRIu64
                                  ") not equal to the memory size (%" PRIu64 ").",
                                  size, atom_size, offset, size, range_end, allocation_size);
             }
         }
+
+        // Makes sure the memory is already mapped
+        if (mapped_range.size == 0) {
+            skip |= LogError("VUID-VkMappedMemoryRange-memory-00684", memory_range.memory, memory_range_loc,
+                             "Attempting to use memory (%s) that is not currently host mapped.",
+                             FormatHandle(memory_range.memory).c_str());
+        }
+
+        if (size == VK_WHOLE_SIZE) {
+            if (mapped_range.offset > offset) {
+                skip |= LogError("VUID-VkMappedMemoryRange-size-00686", memory_range.memory, memory_range_loc.dot(Field::offset),
+                                 "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64 ") (and size is VK_WHOLE_SIZE).",
+                                 offset, mapped_range.offset);
+            }
+        } else {
+            if (mapped_range.offset > offset) {
+                skip |= LogError("VUID-VkMappedMemoryRange-size-00685", memory_range.memory, memory_range_loc.dot(Field::offset),
+                                 "(%" PRIu64 ") is less than the mapped memory offset (%" PRIu64
+                                 ") (and size is not VK_WHOLE_SIZE).",
+                                 offset, mapped_range.offset);
+            }
+            if (mapping_end < (offset + size)) {
+                skip |= LogError("VUID-VkMappedMemoryRange-size-00685", memory_range.memory, memory_range_loc,
+                                 "size (%" PRIu64 ") plus offset (%" PRIu64 ") exceed the Memory Object's upper-bound (%" PRIu64
+                                 ").",
+                                 size, offset, mapping_end);
+            }
+        }
     }
     return skip;
 }
@@ -1180,8 +1181,7 @@ bool CoreChecks::PreCallValidateFlushMappedMemoryRanges(VkDevice device, uint32_
                                                         const VkMappedMemoryRange *pMemoryRanges,
                                                         const ErrorObject &error_obj) const {
     bool skip = false;
-    skip |= ValidateMappedMemoryRangeDeviceLimits(memoryRangeCount, pMemoryRanges, error_obj);
-    skip |= ValidateMemoryIsMapped(memoryRangeCount, pMemoryRanges, error_obj);
+    skip |= ValidateMappedMemoryRanges(memoryRangeCount, pMemoryRanges, error_obj);
     return skip;
 }
 
@@ -1189,8 +1189,7 @@ bool CoreChecks::PreCallValidateInvalidateMappedMemoryRanges(VkDevice device, ui
                                                              const VkMappedMemoryRange *pMemoryRanges,
                                                              const ErrorObject &error_obj) const {
     bool skip = false;
-    skip |= ValidateMappedMemoryRangeDeviceLimits(memoryRangeCount, pMemoryRanges, error_obj);
-    skip |= ValidateMemoryIsMapped(memoryRangeCount, pMemoryRanges, error_obj);
+    skip |= ValidateMappedMemoryRanges(memoryRangeCount, pMemoryRanges, error_obj);
     return skip;
 }
 
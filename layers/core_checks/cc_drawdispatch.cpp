@@ -1468,6 +1468,42 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer
 // This is the main logic shared by all action commands
 bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const VkPipelineBindPoint bind_point,
                                      const Location &loc) const {
+    auto check_scope = ProfileCheck(vvl::ValidationCheck::ValidateActionState);
+    if (!enabled[batch_draw_validation]) {
+        return ValidateActionStateUncached(cb_state, bind_point, loc);
+    }
+
+    // Back-to-back identical actions (ex. a stream of vkCmdDraw) all see the same bound state, so only the first one of the
+    // batch needs the full draw-time validation. Any other command recorded in between breaks the batch, and a batch is only
+    // reused if it logged no message so every error is still reported on the command that caused it.
+    const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
+    uint64_t descriptor_change_count = 0;
+    for (const auto &set_info : cb_state.lastBound[lv_bind_point].per_set) {
+        if (set_info.bound_descriptor_set) {
+            descriptor_change_count += set_info.bound_descriptor_set->GetChangeCount();
+        }
+    }
+    auto &validated = cb_state.validated_action_state[lv_bind_point];
+    if (validated.command == loc.function && validated.command_count == cb_state.command_count &&
+        validated.descriptor_change_count == descriptor_change_count &&
+        validated.image_layout_change_count == cb_state.image_layout_change_count) {
+        validated.command_count++;  // account for this action being recorded
+        return false;
+    }
+
+    bool clean = false;
+    const bool skip = ValidateAndCheckClean(clean, [&]() { return ValidateActionStateUncached(cb_state, bind_point, loc); });
+    if (!clean) {
+        validated = {};
+    } else {
+        // The action itself is recorded next, so expect command_count to have moved by one
+        validated = {loc.function, cb_state.command_count + 1, descriptor_change_count, cb_state.image_layout_change_count};
+    }
+    return skip;
+}
+
+bool CoreChecks::ValidateActionStateUncached(const vvl::CommandBuffer &cb_state, const VkPipelineBindPoint bind_point,
+                                             const Location &loc) const {
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(loc.function);
     const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
     const auto &last_bound_state = cb_state.lastBound[lv_bind_point];
@@ -1489,36 +1525,59 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
         }
     }
 
-    if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-        skip |= ValidateDrawDynamicState(last_bound_state, loc);
-        skip |= ValidatePipelineDrawtimeState(last_bound_state, loc);
+    // A group of checks is skipped if it logged nothing for the same command and none of the state it reads changed since
+    const uint32_t dirty = last_bound_state.action_state_dirty;
+    auto &validated_groups = last_bound_state.validated_check_groups;
+    const auto is_clean = [&](ActionCheckGroup group, uint32_t inputs) {
+        return (dirty & inputs) == 0 && validated_groups[group] == loc.function;
+    };
+    const auto validate_group = [&](ActionCheckGroup group, auto &&validate) {
+        bool clean = false;
+        const bool group_skip = ValidateAndCheckClean(clean, validate);
+        validated_groups[group] = clean ? loc.function : vvl::Func::Empty;
+        return group_skip;
+    };
 
-        if (enabled_features.shaderObject && !has_last_pipeline) {
-            skip |= ValidateShaderObjectDrawtimeState(last_bound_state, loc);
+    if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+        if (!is_clean(kActionCheckDrawtimeState, kActionStateDirtyPipeline | kActionStateDirtyDynamicState |
+                                                     kActionStateDirtyVertexInput | kActionStateDirtyRenderPass)) {
+            skip |= validate_group(kActionCheckDrawtimeState, [&]() {
+                bool group_skip = ValidateDrawDynamicState(last_bound_state, loc);
+                group_skip |= ValidatePipelineDrawtimeState(last_bound_state, loc);
+
+                if (enabled_features.shaderObject && !has_last_pipeline) {
+                    group_skip |= ValidateShaderObjectDrawtimeState(last_bound_state, loc);
+                }
+                return group_skip;
+            });
         }
 
-        if (cb_state.activeFramebuffer) {
-            // Verify attachments for unprotected/protected command buffer.
-            if (enabled_features.protectedMemory == VK_TRUE && cb_state.active_attachments) {
-                uint32_t i = 0;
-                for (const auto &view_state : *cb_state.active_attachments.get()) {
-                    const auto &subpass = cb_state.active_subpasses->at(i);
-                    if (subpass.used && view_state && !view_state->Destroyed()) {
-                        std::string image_desc = "Image is ";
-                        image_desc.append(string_VkImageUsageFlagBits(subpass.usage));
-                        // Because inputAttachment is read only, it doesn't need to care protected command buffer case.
-                        // Some Functions could not be protected. See VUID 02711.
-                        if (subpass.usage != VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT &&
-                            vuid.protected_command_buffer_02712 != kVUIDUndefined) {
-                            skip |= ValidateUnprotectedImage(cb_state, *view_state->image_state, loc,
-                                                             vuid.protected_command_buffer_02712, image_desc.c_str());
+        if (cb_state.activeFramebuffer && !is_clean(kActionCheckProtectedAttachments, kActionStateDirtyRenderPass)) {
+            skip |= validate_group(kActionCheckProtectedAttachments, [&]() {
+                bool group_skip = false;
+                // Verify attachments for unprotected/protected command buffer.
+                if (enabled_features.protectedMemory == VK_TRUE && cb_state.active_attachments) {
+                    uint32_t i = 0;
+                    for (const auto &view_state : *cb_state.active_attachments.get()) {
+                        const auto &subpass = cb_state.active_subpasses->at(i);
+                        if (subpass.used && view_state && !view_state->Destroyed()) {
+                            std::string image_desc = "Image is ";
+                            image_desc.append(string_VkImageUsageFlagBits(subpass.usage));
+                            // Because inputAttachment is read only, it doesn't need to care protected command buffer case.
+                            // Some Functions could not be protected. See VUID 02711.
+                            if (subpass.usage != VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT &&
+                                vuid.protected_command_buffer_02712 != kVUIDUndefined) {
+                                group_skip |= ValidateUnprotectedImage(cb_state, *view_state->image_state, loc,
+                                                                       vuid.protected_command_buffer_02712, image_desc.c_str());
+                            }
+                            group_skip |= ValidateProtectedImage(cb_state, *view_state->image_state, loc,
+                                                                 vuid.unprotected_command_buffer_02707, image_desc.c_str());
                         }
-                        skip |= ValidateProtectedImage(cb_state, *view_state->image_state, loc,
-                                                       vuid.unprotected_command_buffer_02707, image_desc.c_str());
+                        ++i;
                     }
-                    ++i;
                 }
-            }
+                return group_skip;
+            });
         }
     } else if (bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR || bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
         skip |= ValidateRayTracingDynamicStateSetStatus(last_bound_state, loc);
@@ -1529,6 +1588,80 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
     }
 
     const vvl::Pipeline *pipeline = last_pipeline;
+
+    // The descriptor set contents and the image layouts change without a command being recorded
+    uint64_t descriptor_change_count = 0;
+    bool has_dynamic_offsets = false;
+    for (const auto &set_info : last_bound_state.per_set) {
+        if (set_info.bound_descriptor_set) {
+            descriptor_change_count += set_info.bound_descriptor_set->GetChangeCount();
+        }
+        has_dynamic_offsets |= !set_info.dynamicOffsets.empty();
+    }
+    // Sets with dynamic offsets are always revalidated, same as in the per set ValidateDrawState cache
+    if (has_dynamic_offsets ||
+        !is_clean(kActionCheckDescriptors, kActionStateDirtyPipeline | kActionStateDirtyDynamicState |
+                                               kActionStateDirtyDescriptorSets | kActionStateDirtyRenderPass) ||
+        last_bound_state.validated_descriptor_change_count != descriptor_change_count ||
+        last_bound_state.validated_image_layout_change_count != cb_state.image_layout_change_count) {
+        skip |= validate_group(kActionCheckDescriptors,
+                               [&]() { return ValidateActionStateDescriptors(last_bound_state, bind_point, loc); });
+        last_bound_state.validated_descriptor_change_count = descriptor_change_count;
+        last_bound_state.validated_image_layout_change_count = cb_state.image_layout_change_count;
+    }
+
+    if (!is_clean(kActionCheckPushConstants, kActionStateDirtyPipeline | kActionStateDirtyPushConstants)) {
+        skip |= validate_group(kActionCheckPushConstants,
+                               [&]() { return ValidateActionStatePushConstants(last_bound_state, loc); });
+    }
+
+    if (pipeline) {
+        if ((pipeline->create_info_shaders & (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT |
+                                             VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT | VK_SHADER_STAGE_GEOMETRY_BIT)) != 0) {
+            for (const auto &query : cb_state.activeQueries) {
+                const auto query_pool_state = Get<vvl::QueryPool>(query.pool);
+                if (query_pool_state->createInfo.queryType == VK_QUERY_TYPE_MESH_PRIMITIVES_GENERATED_EXT) {
+                    const LogObjectList objlist(cb_state.commandBuffer(), query.pool);
+                    skip |= LogError(vuid.mesh_shader_queries_07073, objlist, loc,
+                                     "Query (slot %" PRIu32 ") with type VK_QUERY_TYPE_MESH_PRIMITIVES_GENERATED_EXT is active.",
+                                     query.slot);
+                }
+            }
+        }
+    }
+
+    if (!cb_state.unprotected) {
+        if (pipeline) {
+            for (const auto &stage : pipeline->stage_states) {
+                if (stage.spirv_state->HasCapability(spv::CapabilityRayQueryKHR)) {
+                    skip |= LogError(vuid.ray_query_04617, cb_state.GetObjectList(bind_point), loc,
+                                     "Shader in %s uses OpCapability RayQueryKHR but the command buffer is protected.",
+                                     string_VkShaderStageFlags(stage.GetStage()).c_str());
+                }
+            }
+        } else {
+            for (const auto &stage : last_bound_state.shader_object_states) {
+                if (stage && stage->spirv->HasCapability(spv::CapabilityRayQueryKHR)) {
+                    skip |= LogError(vuid.ray_query_04617, cb_state.GetObjectList(bind_point), loc,
+                                     "Shader in %s uses OpCapability RayQueryKHR but the command buffer is protected.",
+                                     string_VkShaderStageFlags(stage->create_info.stage).c_str());
+                }
+            }
+        }
+    }
+
+    last_bound_state.action_state_dirty = 0;
+    return skip;
+}
+
+// The kActionCheckDescriptors group of ValidateActionState
+bool CoreChecks::ValidateActionStateDescriptors(const LastBound &last_bound_state, const VkPipelineBindPoint bind_point,
+                                                const Location &loc) const {
+    const vvl::CommandBuffer &cb_state = last_bound_state.cb_state;
+    const DrawDispatchVuid &vuid = GetDrawDispatchVuid(loc.function);
+    const vvl::Pipeline *pipeline = last_bound_state.pipeline_state;
+    bool skip = false;
+
     // Now complete other state checks
     if (pipeline) {
         for (const auto &ds : last_bound_state.per_set) {
@@ -1583,7 +1716,7 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
                                  FormatHandle(last_bound_state.pipeline_layout).c_str());
             } else {
                 // if the bound set is not copmatible, the rest will just be extra redundant errors
-                for (const auto &set_binding_pair : pipeline->active_slots) {
+                for (const auto &set_binding_pair : pipeline->active_slot_requirements) {
                     uint32_t set_index = set_binding_pair.first;
                     const auto set_info = last_bound_state.per_set[set_index];
                     if (!set_info.bound_descriptor_set) {
@@ -1608,20 +1741,30 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
                         // Validate the draw-time state for this descriptor set
                         // We can skip validating the descriptor set if "nothing" has changed since the last validation.
                         // Same set, no image layout changes, and same "pipeline state" (binding_req_map). If there are
-                        // any dynamic descriptors, always revalidate rather than caching the values. We currently only
-                        // apply this optimization if IsManyDescriptors is true, to avoid the overhead of copying the
-                        // binding_req_map which could potentially be expensive.
+                        // any dynamic descriptors, always revalidate rather than caching the values. The binding_req_map
+                        // is the pipeline's own, so it is remembered by address instead of being copied.
+                        const bool image_layouts_changed =
+                            !disabled[image_layout_validation] &&
+                            set_info.validated_set_image_layout_change_count != cb_state.image_layout_change_count;
                         bool need_validate =
                             // Revalidate each time if the set has dynamic offsets
                             set_info.dynamicOffsets.size() > 0 ||
                             // Revalidate if descriptor set (or contents) has changed
                             set_info.validated_set != descriptor_set ||
-                            set_info.validated_set_change_count != descriptor_set->GetChangeCount() ||
-                            (!disabled[image_layout_validation] &&
-                             set_info.validated_set_image_layout_change_count != cb_state.image_layout_change_count);
+                            set_info.validated_set_change_count != descriptor_set->GetChangeCount() || image_layouts_changed ||
+                            // Revalidate if the pipeline requires other bindings than the ones validated
+                            set_info.validated_set_binding_reqs != &set_binding_pair.second;
 
                         if (need_validate) {
-                            skip |= ValidateDrawState(*descriptor_set, set_binding_pair.second, set_info.dynamicOffsets, cb_state, loc, vuid);
+                            // If only the contents of the set changed, the bindings that were not updated since are still valid,
+                            // as long as they were validated for the same binding requirements
+                            std::optional<uint64_t> changed_since;
+                            if (set_info.dynamicOffsets.empty()) {
+                                changed_since =
+                                    set_info.ValidatedChangeCount(descriptor_set, set_binding_pair.second, image_layouts_changed);
+                            }
+                            skip |= ValidateDrawState(*descriptor_set, set_binding_pair.second, set_info.dynamicOffsets, cb_state,
+                                                      loc, vuid, changed_since);
                         }
                     }
                 }
@@ -1657,7 +1800,7 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
                                  FormatHandle(shader_state->shader()).c_str(), shader_state->max_active_slot);
             } else {
                 // if the bound set is not copmatible, the rest will just be extra redundant errors
-                for (const auto &set_binding_pair : shader_state->active_slots) {
+                for (const auto &set_binding_pair : shader_state->active_slot_requirements) {
                     uint32_t set_index = set_binding_pair.first;
                     const auto set_info = last_bound_state.per_set[set_index];
                     if (!set_info.bound_descriptor_set) {
@@ -1682,24 +1825,41 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
                         // We can skip validating the descriptor set if "nothing" has changed since the last validation.
                         // Same set, no image layout changes, and same "pipeline state" (binding_req_map). If there are
                         // any dynamic descriptors, always revalidate rather than caching the values.
+                        const bool image_layouts_changed =
+                            !disabled[image_layout_validation] &&
+                            set_info.validated_set_image_layout_change_count != cb_state.image_layout_change_count;
                         bool need_validate =
                             // Revalidate each time if the set has dynamic offsets
                             set_info.dynamicOffsets.size() > 0 ||
                             // Revalidate if descriptor set (or contents) has changed
                             set_info.validated_set != descriptor_set ||
-                            set_info.validated_set_change_count != descriptor_set->GetChangeCount() ||
-                            (!disabled[image_layout_validation] &&
-                             set_info.validated_set_image_layout_change_count != cb_state.image_layout_change_count);
+                            set_info.validated_set_change_count != descriptor_set->GetChangeCount() || image_layouts_changed;
 
                         if (need_validate) {
-                            skip |=
-                                ValidateDrawState(*descriptor_set, set_binding_pair.second, set_info.dynamicOffsets, cb_state, loc, vuid);
+                            // If only the contents of the set changed, the bindings that were not updated since are still valid,
+                            // as long as they were validated for the same binding requirements
+                            std::optional<uint64_t> changed_since;
+                            if (set_info.dynamicOffsets.empty()) {
+                                changed_since =
+                                    set_info.ValidatedChangeCount(descriptor_set, set_binding_pair.second, image_layouts_changed);
+                            }
+                            skip |= ValidateDrawState(*descriptor_set, set_binding_pair.second, set_info.dynamicOffsets, cb_state,
+                                                      loc, vuid, changed_since);
                         }
                     }
                 }
             }
         }
     }
+    return skip;
+}
+
+// The kActionCheckPushConstants group of ValidateActionState
+bool CoreChecks::ValidateActionStatePushConstants(const LastBound &last_bound_state, const Location &loc) const {
+    const vvl::CommandBuffer &cb_state = last_bound_state.cb_state;
+    const DrawDispatchVuid &vuid = GetDrawDispatchVuid(loc.function);
+    const vvl::Pipeline *pipeline = last_bound_state.pipeline_state;
+    bool skip = false;
 
     // Verify if push constants have been set
     // NOTE: Currently not checking whether active push constants are compatible with the active pipeline, nor whether the
@@ -1740,42 +1900,6 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
             }
         }
     }
-
-    if (pipeline) {
-        if ((pipeline->create_info_shaders & (VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT |
-                                             VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT | VK_SHADER_STAGE_GEOMETRY_BIT)) != 0) {
-            for (const auto &query : cb_state.activeQueries) {
-                const auto query_pool_state = Get<vvl::QueryPool>(query.pool);
-                if (query_pool_state->createInfo.queryType == VK_QUERY_TYPE_MESH_PRIMITIVES_GENERATED_EXT) {
-                    const LogObjectList objlist(cb_state.commandBuffer(), query.pool);
-                    skip |= LogError(vuid.mesh_shader_queries_07073, objlist, loc,
-                                     "Query (slot %" PRIu32 ") with type VK_QUERY_TYPE_MESH_PRIMITIVES_GENERATED_EXT is active.",
-                                     query.slot);
-                }
-            }
-        }
-    }
-
-    if (!cb_state.unprotected) {
-        if (pipeline) {
-            for (const auto &stage : pipeline->stage_states) {
-                if (stage.spirv_state->HasCapability(spv::CapabilityRayQueryKHR)) {
-                    skip |= LogError(vuid.ray_query_04617, cb_state.GetObjectList(bind_point), loc,
-                                     "Shader in %s uses OpCapability RayQueryKHR but the command buffer is protected.",
-                                     string_VkShaderStageFlags(stage.GetStage()).c_str());
-                }
-            }
-        } else {
-            for (const auto &stage : last_bound_state.shader_object_states) {
-                if (stage && stage->spirv->HasCapability(spv::CapabilityRayQueryKHR)) {
-                    skip |= LogError(vuid.ray_query_04617, cb_state.GetObjectList(bind_point), loc,
-                                     "Shader in %s uses OpCapability RayQueryKHR but the command buffer is protected.",
-                                     string_VkShaderStageFlags(stage->create_info.stage).c_str());
-                }
-            }
-        }
-    }
-
     return skip;
 }
 
@@ -1800,15 +1924,21 @@ bool CoreChecks::ValidateIndirectCmd(const vvl::CommandBuffer &cb_state, const v
                                      const Location &loc) const {
     bool skip = false;
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(loc.function);
-    LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_GRAPHICS);
-    objlist.add(buffer_state.Handle());
+    // Gathering the bound pipeline or shaders is only done once there is an error to report
+    const auto objlist = [&cb_state, &buffer_state]() {
+        LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_GRAPHICS);
+        objlist.add(buffer_state.Handle());
+        return objlist;
+    };
 
     skip |= ValidateMemoryIsBoundToBuffer(cb_state.commandBuffer(), buffer_state, loc.dot(Field::buffer),
                                           vuid.indirect_contiguous_memory_02708);
-    skip |= ValidateBufferUsageFlags(objlist, buffer_state, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, true,
-                                     vuid.indirect_buffer_bit_02290, loc.dot(Field::buffer));
+    if ((buffer_state.usage & VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT) == 0) {
+        skip |= ValidateBufferUsageFlags(objlist(), buffer_state, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, true,
+                                         vuid.indirect_buffer_bit_02290, loc.dot(Field::buffer));
+    }
     if (cb_state.unprotected == false) {
-        skip |= LogError(vuid.indirect_protected_cb_02711, objlist, loc,
+        skip |= LogError(vuid.indirect_protected_cb_02711, objlist(), loc,
                          "Indirect commands can't be used in protected command buffers.");
     }
     return skip;
@@ -1818,15 +1948,20 @@ bool CoreChecks::ValidateIndirectCountCmd(const vvl::CommandBuffer &cb_state, co
                                           VkDeviceSize count_buffer_offset, const Location &loc) const {
     bool skip = false;
     const DrawDispatchVuid &vuid = GetDrawDispatchVuid(loc.function);
-    LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_GRAPHICS);
-    objlist.add(count_buffer_state.Handle());
+    const auto objlist = [&cb_state, &count_buffer_state]() {
+        LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_GRAPHICS);
+        objlist.add(count_buffer_state.Handle());
+        return objlist;
+    };
 
     skip |= ValidateMemoryIsBoundToBuffer(cb_state.commandBuffer(), count_buffer_state, loc.dot(Field::countBuffer),
                                           vuid.indirect_count_contiguous_memory_02714);
-    skip |= ValidateBufferUsageFlags(objlist, count_buffer_state, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, true,
-                                     vuid.indirect_count_buffer_bit_02715, loc.dot(Field::countBuffer));
+    if ((count_buffer_state.usage & VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT) == 0) {
+        skip |= ValidateBufferUsageFlags(objlist(), count_buffer_state, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, true,
+                                         vuid.indirect_count_buffer_bit_02715, loc.dot(Field::countBuffer));
+    }
     if (count_buffer_offset + sizeof(uint32_t) > count_buffer_state.createInfo.size) {
-        skip |= LogError(vuid.indirect_count_offset_04129, objlist, loc,
+        skip |= LogError(vuid.indirect_count_offset_04129, objlist(), loc,
                          "countBufferOffset (%" PRIu64 ") + sizeof(uint32_t) is greater than the buffer size of %" PRIu64 ".",
                          count_buffer_offset, count_buffer_state.createInfo.size);
     }
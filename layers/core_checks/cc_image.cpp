@@ -98,7 +98,7 @@ bool CoreChecks::ValidateImageFormatFeatures(const VkImageCreateInfo *pCreateInf
     }
 
     // Lack of disjoint format feature support while using the flag
-    if (vkuFormatIsMultiplane(image_format) && ((pCreateInfo->flags & VK_IMAGE_CREATE_DISJOINT_BIT) != 0) &&
+    if (GetFormatInfo(image_format).IsMultiplane() && ((pCreateInfo->flags & VK_IMAGE_CREATE_DISJOINT_BIT) != 0) &&
         ((tiling_features & VK_FORMAT_FEATURE_2_DISJOINT_BIT_KHR) == 0)) {
         skip |= LogError("VUID-VkImageCreateInfo-imageCreateFormatFeatures-02260", device, loc.dot(Field::usage),
                          "includes VK_IMAGE_CREATE_DISJOINT_BIT, but %s doesn't support "
@@ -204,12 +204,13 @@ bool CoreChecks::PreCallValidateCreateImage(VkDevice device, const VkImageCreate
     // Exit early if any thing is not succesful
     VkResult result = VK_SUCCESS;
     if (pCreateInfo->tiling != VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
-        if (IsExtEnabled(device_extensions.vk_khr_get_physical_device_properties2)) {
+        // Without structures to chain, both queries return the same, and the result is cached
+        if (image_format_info.pNext && IsExtEnabled(device_extensions.vk_khr_get_physical_device_properties2)) {
             result = DispatchGetPhysicalDeviceImageFormatProperties2(physical_device, &image_format_info, &image_format_properties);
         } else {
-            result = DispatchGetPhysicalDeviceImageFormatProperties(physical_device, pCreateInfo->format, pCreateInfo->imageType,
-                                                                    pCreateInfo->tiling, pCreateInfo->usage, pCreateInfo->flags,
-                                                                    &image_format_properties.imageFormatProperties);
+            result = physical_device_state->GetImageFormatProperties(pCreateInfo->format, pCreateInfo->imageType,
+                                                                     pCreateInfo->tiling, pCreateInfo->usage, pCreateInfo->flags,
+                                                                     &image_format_properties.imageFormatProperties);
         }
 
         // 1. vkGetPhysicalDeviceImageFormatProperties[2] only success code is VK_SUCCESS
@@ -372,7 +373,7 @@ bool CoreChecks::PreCallValidateCreateImage(VkDevice device, const VkImageCreate
 
     if (IsExtEnabled(device_extensions.vk_khr_maintenance2)) {
         if (pCreateInfo->flags & VK_IMAGE_CREATE_BLOCK_TEXEL_VIEW_COMPATIBLE_BIT) {
-            if (!vkuFormatIsCompressed(pCreateInfo->format)) {
+            if (!GetFormatInfo(pCreateInfo->format).is_compressed) {
                 skip |= LogError(
                     "VUID-VkImageCreateInfo-flags-01572", device, create_info_loc.dot(Field::flags),
                     "contains VK_IMAGE_CREATE_BLOCK_TEXEL_VIEW_COMPATIBLE_BIT, but format (%s) must be a compressed image format.",
@@ -391,7 +392,7 @@ bool CoreChecks::PreCallValidateCreateImage(VkDevice device, const VkImageCreate
                                                     create_info_loc, "VUID-VkImageCreateInfo-sharingMode-01420");
     }
 
-    if (!vkuFormatIsMultiplane(pCreateInfo->format) && !(pCreateInfo->flags & VK_IMAGE_CREATE_ALIAS_BIT) &&
+    if (!GetFormatInfo(pCreateInfo->format).IsMultiplane() && !(pCreateInfo->flags & VK_IMAGE_CREATE_ALIAS_BIT) &&
         (pCreateInfo->flags & VK_IMAGE_CREATE_DISJOINT_BIT)) {
         skip |= LogError("VUID-VkImageCreateInfo-format-01577", device, create_info_loc,
                          "format is %s and flags are %s. The flags should not include VK_IMAGE_CREATE_DISJOINT_BIT.",
@@ -742,14 +743,14 @@ bool CoreChecks::PreCallValidateCreateImage(VkDevice device, const VkImageCreate
 
     const auto image_compression_control = vku::FindStructInPNextChain<VkImageCompressionControlEXT>(pCreateInfo->pNext);
     if (image_compression_control && (image_compression_control->flags & VK_IMAGE_COMPRESSION_FIXED_RATE_EXPLICIT_EXT) != 0) {
-        if (vkuFormatIsMultiplane(pCreateInfo->format)) {
-            if (image_compression_control->compressionControlPlaneCount != vkuFormatPlaneCount(pCreateInfo->format)) {
+        if (GetFormatInfo(pCreateInfo->format).IsMultiplane()) {
+            if (image_compression_control->compressionControlPlaneCount != GetFormatInfo(pCreateInfo->format).plane_count) {
                 skip |= LogError("VUID-VkImageCreateInfo-pNext-06743", device, create_info_loc,
                                  "VkImageCompressionControlEXT::flags contain VK_IMAGE_COMPRESSION_FIXED_RATE_EXPLICIT_EXT, but "
                                  "VkImageCompressionControlEXT::compressionControlPlaneCount (%" PRIu32
                                  ") is not equal to the number of planes in the multi-planar format %s (%" PRIu32 ")",
                                  image_compression_control->compressionControlPlaneCount, string_VkFormat(pCreateInfo->format),
-                                 vkuFormatPlaneCount(pCreateInfo->format));
+                                 GetFormatInfo(pCreateInfo->format).plane_count);
             }
         } else {
             if (image_compression_control->compressionControlPlaneCount != 1) {
@@ -846,12 +847,12 @@ bool CoreChecks::PreCallValidateCmdClearColorImage(VkCommandBuffer commandBuffer
     }
 
     const VkFormat format = image_state.createInfo.format;
-    if (vkuFormatIsDepthOrStencil(format)) {
+    if (GetFormatInfo(format).IsDepthOrStencil()) {
         LogObjectList objlist(commandBuffer, image);
         skip |=
             LogError("VUID-vkCmdClearColorImage-image-00007", objlist, image_loc,
                      "(%s) was created with a depth/stencil format (%s).", FormatHandle(image).c_str(), string_VkFormat(format));
-    } else if (vkuFormatIsCompressed(format)) {
+    } else if (GetFormatInfo(format).is_compressed) {
         LogObjectList objlist(commandBuffer, image);
         skip |= LogError("VUID-vkCmdClearColorImage-image-00007", objlist, image_loc,
                          "(%s) was created with a compressed format (%s).", FormatHandle(image).c_str(), string_VkFormat(format));
@@ -945,7 +946,7 @@ bool CoreChecks::PreCallValidateCmdClearDepthStencilImage(VkCommandBuffer comman
                          "is %s (can only be DEPTH_BIT or STENCIL_BIT).", string_VkImageAspectFlags(pRanges[i].aspectMask).c_str());
         }
         if ((pRanges[i].aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT) != 0) {
-            if (vkuFormatHasDepth(image_format) == false) {
+            if (GetFormatInfo(image_format).has_depth == false) {
                 LogObjectList objlist(cb_state.commandBuffer(), image);
                 skip |= LogError("VUID-vkCmdClearDepthStencilImage-image-02826", objlist, range_loc.dot(Field::aspectMask),
                                  "has a VK_IMAGE_ASPECT_DEPTH_BIT but %s "
@@ -960,7 +961,7 @@ bool CoreChecks::PreCallValidateCmdClearDepthStencilImage(VkCommandBuffer comman
             }
         }
         if ((pRanges[i].aspectMask & VK_IMAGE_ASPECT_STENCIL_BIT) != 0) {
-            if (vkuFormatHasStencil(image_format) == false) {
+            if (GetFormatInfo(image_format).has_stencil == false) {
                 LogObjectList objlist(cb_state.commandBuffer(), image);
                 skip |= LogError("VUID-vkCmdClearDepthStencilImage-image-02825", objlist, range_loc.dot(Field::aspectMask),
                                  "has a VK_IMAGE_ASPECT_STENCIL_BIT but "
@@ -986,7 +987,7 @@ bool CoreChecks::PreCallValidateCmdClearDepthStencilImage(VkCommandBuffer comman
         }
     }
 
-    if (!vkuFormatIsDepthOrStencil(image_format)) {
+    if (!GetFormatInfo(image_format).IsDepthOrStencil()) {
         LogObjectList objlist(cb_state.commandBuffer(), image);
         skip |=
             LogError("VUID-vkCmdClearDepthStencilImage-image-00014", objlist, image_loc,
@@ -1147,7 +1148,7 @@ bool CoreChecks::PreCallValidateCmdClearAttachments(VkCommandBuffer commandBuffe
                     stencil_view_state = depth_view_state;
 
                     const VkFormat image_view_format = depth_view_state->safe_create_info.format;
-                    if ((aspect_mask & VK_IMAGE_ASPECT_DEPTH_BIT) && !vkuFormatHasDepth(image_view_format)) {
+                    if ((aspect_mask & VK_IMAGE_ASPECT_DEPTH_BIT) && !GetFormatInfo(image_view_format).has_depth) {
                         const LogObjectList objlist(commandBuffer, cb_state.activeRenderPass->renderPass(),
                                                     depth_view_state->image_view());
                         skip |= LogError("VUID-vkCmdClearAttachments-aspectMask-07884", objlist, attachment_loc,
@@ -1156,7 +1157,7 @@ bool CoreChecks::PreCallValidateCmdClearAttachments(VkCommandBuffer commandBuffe
                                          cb_state.GetActiveSubpass(), string_VkFormat(image_view_format));
                     }
 
-                    if ((aspect_mask & VK_IMAGE_ASPECT_STENCIL_BIT) && !vkuFormatHasStencil(image_view_format)) {
+                    if ((aspect_mask & VK_IMAGE_ASPECT_STENCIL_BIT) && !GetFormatInfo(image_view_format).has_stencil) {
                         const LogObjectList objlist(commandBuffer, cb_state.activeRenderPass->renderPass(),
                                                     stencil_view_state->image_view());
                         skip |= LogError("VUID-vkCmdClearAttachments-aspectMask-07885", objlist, attachment_loc,
@@ -1387,7 +1388,7 @@ bool CoreChecks::ValidateImageAspectMask(VkImage image, VkFormat format, VkImage
     bool skip = false;
     // checks color format and (single-plane or non-disjoint)
     // if ycbcr extension is not supported then single-plane and non-disjoint are always both true
-    if ((vkuFormatIsColor(format)) && ((vkuFormatIsMultiplane(format) == false) || (is_image_disjoint == false))) {
+    if ((GetFormatInfo(format).is_color) && ((GetFormatInfo(format).IsMultiplane() == false) || (is_image_disjoint == false))) {
         if ((aspect_mask & VK_IMAGE_ASPECT_COLOR_BIT) != VK_IMAGE_ASPECT_COLOR_BIT) {
             skip |= LogError(
                 vuid, image, loc,
@@ -1435,9 +1436,9 @@ bool CoreChecks::ValidateImageAspectMask(VkImage image, VkFormat format, VkImage
                              "VK_IMAGE_ASPECT_STENCIL_BIT set.",
                              string_VkFormat(format), string_VkImageAspectFlags(aspect_mask).c_str());
         }
-    } else if (vkuFormatIsMultiplane(format)) {
+    } else if (GetFormatInfo(format).IsMultiplane()) {
         VkImageAspectFlags valid_flags = VK_IMAGE_ASPECT_COLOR_BIT | VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_1_BIT;
-        if (3 == vkuFormatPlaneCount(format)) {
+        if (3 == GetFormatInfo(format).plane_count) {
             valid_flags = valid_flags | VK_IMAGE_ASPECT_PLANE_2_BIT;
         }
         if ((aspect_mask & valid_flags) != aspect_mask) {
@@ -1907,7 +1908,7 @@ bool CoreChecks::PreCallValidateCreateImageView(VkDevice device, const VkImageVi
         }
     }
 
-    const bool multiplane_image = vkuFormatIsMultiplane(image_format);
+    const bool multiplane_image = GetFormatInfo(image_format).IsMultiplane();
     if (multiplane_image && IsMultiplePlaneAspect(aspect_mask)) {
         skip |= LogError("VUID-VkImageViewCreateInfo-subresourceRange-07818", pCreateInfo->image,
                          create_info_loc.dot(Field::subresourceRange).dot(Field::aspectMask), "(%s) is invalid for %s.",
@@ -1916,10 +1917,10 @@ bool CoreChecks::PreCallValidateCreateImageView(VkDevice device, const VkImageVi
 
     // Validate VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT state, if view/image formats differ
     if ((image_flags & VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT) && (image_format != view_format)) {
-        const auto view_class = vkuFormatCompatibilityClass(view_format);
+        const auto view_class = GetFormatInfo(view_format).compatibility_class;
         if (multiplane_image) {
             const VkFormat compat_format = vkuFindMultiplaneCompatibleFormat(image_format, static_cast<VkImageAspectFlagBits>(aspect_mask));
-            const auto image_class = vkuFormatCompatibilityClass(compat_format);
+            const auto image_class = GetFormatInfo(compat_format).compatibility_class;
             // Need valid aspect mask otherwise will throw extra error when getting compatible format
             // Also this can be VK_IMAGE_ASPECT_COLOR_BIT
             const bool has_valid_aspect = IsOnlyOneValidPlaneAspect(image_format, aspect_mask);
@@ -1933,7 +1934,7 @@ bool CoreChecks::PreCallValidateCreateImageView(VkDevice device, const VkImageVi
             }
         } else if (!(image_flags & VK_IMAGE_CREATE_BLOCK_TEXEL_VIEW_COMPATIBLE_BIT)) {
             // Format MUST be compatible (in the same format compatibility class) as the format the image was created with
-            const auto image_class = vkuFormatCompatibilityClass(image_format);
+            const auto image_class = GetFormatInfo(image_format).compatibility_class;
             // Need to only check if one is NONE to handle edge case both are NONE
             if ((image_class != view_class) || (image_class == VKU_FORMAT_COMPATIBILITY_CLASS_NONE)) {
                 skip |=
@@ -2154,7 +2155,7 @@ bool CoreChecks::PreCallValidateCreateImageView(VkDevice device, const VkImageVi
     }
 
     if (image_flags & VK_IMAGE_CREATE_BLOCK_TEXEL_VIEW_COMPATIBLE_BIT) {
-        if (!vkuFormatIsCompressed(view_format)) {
+        if (!GetFormatInfo(view_format).is_compressed) {
             if (pCreateInfo->subresourceRange.levelCount != 1) {
                 skip |= LogError("VUID-VkImageViewCreateInfo-image-07072", pCreateInfo->image, create_info_loc.dot(Field::image),
                                  "was created with VK_IMAGE_CREATE_BLOCK_TEXEL_VIEW_COMPATIBLE_BIT bit, "
@@ -2171,10 +2172,12 @@ bool CoreChecks::PreCallValidateCreateImageView(VkDevice device, const VkImageVi
             }
         }
 
-        const bool class_compatible = vkuFormatCompatibilityClass(view_format) == vkuFormatCompatibilityClass(image_format);
+        const vvl::FormatInfo &view_format_info = GetFormatInfo(view_format);
+        const vvl::FormatInfo &image_format_info = GetFormatInfo(image_format);
+        const bool class_compatible = view_format_info.compatibility_class == image_format_info.compatibility_class;
         // "uncompressed format that is size-compatible" so if compressed, same as not being compatible
         const bool size_compatible =
-            vkuFormatIsCompressed(view_format) ? false : vkuFormatElementSize(view_format) == vkuFormatElementSize(image_format);
+            view_format_info.is_compressed ? false : view_format_info.element_size == image_format_info.element_size;
         if (!class_compatible && !size_compatible) {
             skip |= LogError("VUID-VkImageViewCreateInfo-image-01583", pCreateInfo->image, create_info_loc.dot(Field::image),
                              "was created with VK_IMAGE_CREATE_BLOCK_TEXEL_VIEW_COMPATIBLE_BIT bit and "
@@ -2365,9 +2368,10 @@ bool CoreChecks::ValidateGetImageSubresourceLayout(const vvl::Image &image_state
     }
 
     const VkFormat image_format = image_state.createInfo.format;
+    const vvl::FormatInfo &image_format_info = GetFormatInfo(image_format);
     const bool tiling_linear_optimal =
         image_state.createInfo.tiling == VK_IMAGE_TILING_LINEAR || image_state.createInfo.tiling == VK_IMAGE_TILING_OPTIMAL;
-    if (vkuFormatIsColor(image_format) && !vkuFormatIsMultiplane(image_format) && (aspect_mask != VK_IMAGE_ASPECT_COLOR_BIT) &&
+    if (image_format_info.is_color && !image_format_info.IsMultiplane() && (aspect_mask != VK_IMAGE_ASPECT_COLOR_BIT) &&
         tiling_linear_optimal) {
         const char *vuid =
             is_2 ? "VUID-vkGetImageSubresourceLayout2KHR-format-08886" : "VUID-vkGetImageSubresourceLayout-format-08886";
@@ -2376,7 +2380,7 @@ bool CoreChecks::ValidateGetImageSubresourceLayout(const vvl::Image &image_state
                          string_VkFormat(image_format));
     }
 
-    if (vkuFormatHasDepth(image_format) && ((aspect_mask & VK_IMAGE_ASPECT_DEPTH_BIT) == 0)) {
+    if (image_format_info.has_depth && ((aspect_mask & VK_IMAGE_ASPECT_DEPTH_BIT) == 0)) {
         const char *vuid =
             is_2 ? "VUID-vkGetImageSubresourceLayout2KHR-format-04462" : "VUID-vkGetImageSubresourceLayout-format-04462";
         skip |= LogError(vuid, image_state.image(), subresource_loc.dot(Field::aspectMask),
@@ -2384,7 +2388,7 @@ bool CoreChecks::ValidateGetImageSubresourceLayout(const vvl::Image &image_state
                          string_VkFormat(image_format));
     }
 
-    if (vkuFormatHasStencil(image_format) && ((aspect_mask & VK_IMAGE_ASPECT_STENCIL_BIT) == 0)) {
+    if (image_format_info.has_stencil && ((aspect_mask & VK_IMAGE_ASPECT_STENCIL_BIT) == 0)) {
         const char *vuid =
             is_2 ? "VUID-vkGetImageSubresourceLayout2KHR-format-04463" : "VUID-vkGetImageSubresourceLayout-format-04463";
         skip |= LogError(vuid, image_state.image(), subresource_loc.dot(Field::aspectMask),
@@ -2392,7 +2396,7 @@ bool CoreChecks::ValidateGetImageSubresourceLayout(const vvl::Image &image_state
                          string_VkFormat(image_format));
     }
 
-    if (!vkuFormatHasDepth(image_format) && !vkuFormatHasStencil(image_format)) {
+    if (!image_format_info.has_depth && !image_format_info.has_stencil) {
         if ((aspect_mask & (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) != 0) {
             const char *vuid =
                 is_2 ? "VUID-vkGetImageSubresourceLayout2KHR-format-04464" : "VUID-vkGetImageSubresourceLayout-format-04464";
@@ -2404,7 +2408,7 @@ bool CoreChecks::ValidateGetImageSubresourceLayout(const vvl::Image &image_state
 
     // subresource's aspect must be compatible with image's format.
     if (image_state.createInfo.tiling == VK_IMAGE_TILING_LINEAR) {
-        if (vkuFormatIsMultiplane(image_format) && !IsOnlyOneValidPlaneAspect(image_format, aspect_mask)) {
+        if (image_format_info.IsMultiplane() && !IsOnlyOneValidPlaneAspect(image_format, aspect_mask)) {
             const char *vuid =
                 is_2 ? "VUID-vkGetImageSubresourceLayout2KHR-tiling-08717" : "VUID-vkGetImageSubresourceLayout-tiling-08717";
             skip |= LogError(vuid, image_state.image(), subresource_loc.dot(Field::aspectMask), "(%s) is invalid for format %s.",
@@ -2562,8 +2566,8 @@ bool CoreChecks::PreCallValidateTransitionImageLayoutEXT(VkDevice device, uint32
             ValidateMemoryIsBoundToImage(LogObjectList(device, transition.image), *image_state, transition_loc.dot(Field::image),
                                          "VUID-VkHostImageLayoutTransitionInfoEXT-image-01932");
 
-        if (vkuFormatIsColor(image_format) && (aspect_mask != VK_IMAGE_ASPECT_COLOR_BIT)) {
-            if (!vkuFormatIsMultiplane(image_format)) {
+        if (GetFormatInfo(image_format).is_color && (aspect_mask != VK_IMAGE_ASPECT_COLOR_BIT)) {
+            if (!GetFormatInfo(image_format).IsMultiplane()) {
                 const LogObjectList objlist(device, image_state->Handle());
                 skip |= LogError("VUID-VkHostImageLayoutTransitionInfoEXT-image-09241", objlist,
                                  transition_loc.dot(Field::subresourceRange).dot(Field::aspectMask),
@@ -2577,7 +2581,7 @@ bool CoreChecks::PreCallValidateTransitionImageLayoutEXT(VkDevice device, uint32
                                  string_VkImageAspectFlags(aspect_mask).c_str(), string_VkFormat(image_format));
             }
         }
-        if ((vkuFormatIsMultiplane(image_format)) && (image_state->disjoint)) {
+        if ((GetFormatInfo(image_format).IsMultiplane()) && (image_state->disjoint)) {
             if (!IsValidPlaneAspect(image_format, aspect_mask) && ((aspect_mask & VK_IMAGE_ASPECT_COLOR_BIT) == 0)) {
                 const LogObjectList objlist(device, image_state->Handle());
                 skip |= LogError("VUID-VkHostImageLayoutTransitionInfoEXT-image-01672", objlist,
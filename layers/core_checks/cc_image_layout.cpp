@@ -186,11 +186,43 @@ struct GlobalLayoutUpdater {
     }
 };
 
+void CORE_CMD_BUFFER_STATE::End(VkResult result) {
+    vvl::CommandBuffer::End(result);
+    image_layout_submits.clear();
+    initial_layout_images.clear();
+    for (const auto &layout_map_entry : image_layout_map) {
+        const auto &subres_map = layout_map_entry.second;
+        if (!subres_map) {
+            continue;
+        }
+        const bool reentrant = !subres_map->AnyLayout([&subres_map](const auto &range, const auto &entry) {
+            if (entry.initial_layout == image_layout_map::kInvalidLayout || entry.initial_layout == VK_IMAGE_LAYOUT_UNDEFINED ||
+                entry.current_layout == image_layout_map::kInvalidLayout || entry.current_layout == entry.initial_layout) {
+                return false;
+            }
+            // Be conservative with the ranges over several aspects, the layouts can only match for some of them
+            const auto aspect_mask = subres_map->Decode(range.begin).aspectMask;
+            return aspect_mask != subres_map->Decode(range.end - 1).aspectMask ||
+                   !ImageLayoutMatches(aspect_mask, entry.current_layout, entry.initial_layout);
+        });
+        image_layout_submits[layout_map_entry.first].reentrant = reentrant;
+        const bool expects_layout = subres_map->AnyLayout([](const auto &, const auto &entry) {
+            return entry.initial_layout != image_layout_map::kInvalidLayout && entry.initial_layout != VK_IMAGE_LAYOUT_UNDEFINED;
+        });
+        if (expects_layout) {
+            initial_layout_images.emplace_back(layout_map_entry.first);
+        }
+    }
+}
+
 // This validates that the initial layout specified in the command buffer for the IMAGE is the same as the global IMAGE layout
 bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::CommandBuffer &cb_state,
                                             GlobalImageLayoutMap &overlayLayoutMap) const {
     if (disabled[image_layout_validation]) return false;
+    auto check_scope = ProfileCheck(vvl::ValidationCheck::ValidateCmdBufImageLayouts);
     bool skip = false;
+    const auto &core_cb_state = static_cast<const CORE_CMD_BUFFER_STATE &>(cb_state);
+    std::lock_guard<std::mutex> submit_state_guard(core_cb_state.image_layout_submit_lock);
     // Iterate over the layout maps for each referenced image
     GlobalImageLayoutRangeMap empty_map(1);
     for (const auto &layout_map_entry : cb_state.image_layout_map) {
@@ -200,14 +232,31 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
             continue;
         }
         const auto &subres_map = layout_map_entry.second;
-        const auto &layout_map = subres_map->GetLayoutMap();
         // Validate the initial_uses for each subresource referenced
-        if (layout_map.empty()) continue;
-
+        if (subres_map->Empty()) continue;
+
+        auto submit_state_it = core_cb_state.image_layout_submits.find(image);
+        auto *submit_state = submit_state_it != core_cb_state.image_layout_submits.end() ? &submit_state_it->second : nullptr;
+        const bool in_overlay = overlayLayoutMap.find(image_state.get()) != overlayLayoutMap.end();
+        assert(image_state->layout_state);
+        const auto global_layouts = image_state->layout_state->Current();
+        const auto *global_map = &global_layouts->map;
+
+        // Resubmitted with nothing else having changed the layouts of the image since its last error free submit: the
+        // result would be the same, and the global layouts are already the ones this command buffer leaves the image in,
+        // so later command buffers of the submit don't need an overlay either.
+        if (submit_state) {
+            submit_state->validated_generation = global_layouts->generation;
+            if (submit_state->reentrant && !in_overlay && submit_state->global_generation != 0 &&
+                submit_state->global_generation == global_layouts->generation) {
+                submit_state->validated = true;
+                continue;
+            }
+            submit_state->validated = false;
+        }
+        bool layout_mismatch = false;
         auto *overlay_map = GetLayoutRangeMap(overlayLayoutMap, *image_state);
-        const auto *global_map = image_state->layout_range_map.get();
-        assert(global_map);
-        auto global_map_guard = global_map->ReadLock();
+        const auto &layout_map = subres_map->GetLayoutMap();
 
         // Note: don't know if it would matter
         // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
@@ -238,6 +287,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
                 const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
                 const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
                 if (!matches) {
+                    layout_mismatch = true;
                     // We can report all the errors for the intersected range directly
                     for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
                         const auto subresource = image_state->subresource_encoder.Decode(index);
@@ -262,19 +312,44 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
         }
         // Update all layout set operations (which will be a subset of the initial_layouts)
         sparse_container::splice(*overlay_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+
+        if (submit_state) {
+            submit_state->validated = !in_overlay && !layout_mismatch;
+        }
     }
 
     return skip;
 }
 
 void CoreChecks::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_state) {
+    const auto &core_cb_state = static_cast<const CORE_CMD_BUFFER_STATE &>(cb_state);
+    std::lock_guard<std::mutex> submit_state_guard(core_cb_state.image_layout_submit_lock);
     for (const auto &layout_map_entry : cb_state.image_layout_map) {
         const auto image = layout_map_entry.first;
         const auto &subres_map = layout_map_entry.second;
         const auto image_state = Get<vvl::Image>(image);
         if (image_state) {
-            auto guard = image_state->layout_range_map->WriteLock();
-            sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+            auto submit_state_it = core_cb_state.image_layout_submits.find(image);
+            auto *submit_state = submit_state_it != core_cb_state.image_layout_submits.end() ? &submit_state_it->second : nullptr;
+            if (submit_state && submit_state->global_generation != 0 &&
+                submit_state->global_generation == image_state->layout_state->Current()->generation) {
+                // Nothing changed the global layouts since this command buffer last set them, they already are its final ones
+                submit_state->validated = false;
+                continue;
+            }
+            uint64_t previous_generation = 0;
+            const auto global_layouts = image_state->layout_state->Update(
+                [&subres_map](const GlobalImageLayoutRangeMap &global_map) { return global_map.ChangedBy(*subres_map); },
+                [&subres_map](GlobalImageLayoutRangeMap &global_map) {
+                    return sparse_container::splice(global_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+                },
+                &previous_generation);
+            if (submit_state) {
+                // Another submit could have changed the layouts since the validation, which then says nothing of these ones
+                const bool validated = submit_state->validated && submit_state->validated_generation == previous_generation;
+                submit_state->global_generation = validated ? global_layouts->generation : 0;
+                submit_state->validated = false;
+            }
         }
     }
 }
@@ -871,11 +946,10 @@ bool CoreChecks::UpdateCommandBufferImageLayoutMap(const vvl::CommandBuffer *cb_
     return skip;
 }
 
-bool CoreChecks::FindLayouts(const vvl::Image &image_state, std::vector<VkImageLayout> &layouts) const {
-    const auto *layout_range_map = image_state.layout_range_map.get();
-    if (!layout_range_map) return false;
-
-    auto guard = layout_range_map->ReadLock();
+GlobalImageLayoutState::Snapshot CoreChecks::FindLayouts(const vvl::Image &image_state) const {
+    if (!image_state.layout_state) return nullptr;
+    const auto global_layouts = image_state.layout_state->Current();
+    const auto *layout_range_map = &global_layouts->map;
     // TODO: FindLayouts function should mutate into a ValidatePresentableLayout with the loop wrapping the LogError
     //       from the caller. You can then use decode to add the subresource of the range::begin to the error message.
 
@@ -883,13 +957,9 @@ bool CoreChecks::FindLayouts(const vvl::Image &image_state, std::vector<VkImageL
 
     // TODO: Make this robust for >1 aspect mask. Now it will just say ignore potential errors in this case.
     if (layout_range_map->size() >= (image_state.createInfo.arrayLayers * image_state.createInfo.mipLevels + 1)) {
-        return false;
-    }
-
-    for (const auto &entry : *layout_range_map) {
-        layouts.push_back(entry.second);
+        return nullptr;
     }
-    return true;
+    return global_layouts;
 }
 
 void CoreChecks::RecordTransitionImageLayout(vvl::CommandBuffer *cb_state, const ImageBarrier &mem_barrier) {
@@ -977,10 +1047,18 @@ bool CoreChecks::ValidateHostCopyCurrentLayout(VkDevice device, const VkImageLay
                                                const VkImageSubresourceRange &validate_range, uint32_t region_index,
                                                const vvl::Image &image_state, const Location &loc, const char *image_label,
                                                const char *vuid) const {
+    if (disabled[image_layout_validation]) return false;
+    if (!(image_state.layout_state)) return false;
+    return ValidateHostCopyCurrentLayout(device, expected_layout, validate_range, region_index, image_state,
+                                         *image_state.layout_state->Current(), loc, image_label, vuid);
+}
+
+bool CoreChecks::ValidateHostCopyCurrentLayout(VkDevice device, const VkImageLayout expected_layout,
+                                               const VkImageSubresourceRange &validate_range, uint32_t region_index,
+                                               const vvl::Image &image_state, const GlobalImageLayoutState::Version &global_layouts,
+                                               const Location &loc, const char *image_label, const char *vuid) const {
     using Map = GlobalImageLayoutRangeMap;
     bool skip = false;
-    if (disabled[image_layout_validation]) return false;
-    if (!(image_state.layout_range_map)) return false;
     const VkImageSubresourceRange subres_range = image_state.NormalizeSubresourceRange(validate_range);
     // RangeGenerator doesn't tolerate degenerate or invalid ranges. The error will be found and logged elsewhere
     if (!IsCompliantSubresourceRange(subres_range, image_state)) return false;
@@ -1001,8 +1079,7 @@ bool CoreChecks::ValidateHostCopyCurrentLayout(VkDevice device, const VkImageLay
 
     CheckState check_state(expected_layout, subres_range.aspectMask);
 
-    auto guard = image_state.layout_range_map->ReadLock();
-    image_state.layout_range_map->AnyInRange(range_gen, [&check_state](const Map::key_type &range, const VkImageLayout &layout) {
+    global_layouts.map.AnyInRange(range_gen, [&check_state](const Map::key_type &range, const VkImageLayout &layout) {
         bool mismatch = false;
         if (!ImageLayoutMatches(check_state.aspect_mask, layout, check_state.expected_layout)) {
             check_state.found_range = range;
@@ -26,6 +26,63 @@
 #include "core_validation.h"
 #include "generated/enum_flag_bits.h"
 #include "drawdispatch/drawdispatch_vuids.h"
+#include "utils/hash_util.h"
+
+// Below this many pipelines the hand off to the workers costs more than the validation
+static constexpr uint32_t kMinParallelPipelines = 4;
+
+// Content hashes of the state blocks with self contained checks, over everything these checks read.
+// Seeded by the kind of block, so blocks of different kinds can't collide.
+enum class PipelineStateKind : uint64_t { kVertexDivisors = 1, kColorBlendAttachments };
+
+template <typename T>
+static uint64_t HashArray(const T *values, size_t count, uint64_t seed) {
+    return count ? hash_util::Hash64(values, count * sizeof(T), seed) : hash_util::Hash64(&count, sizeof(count), seed);
+}
+
+static uint64_t HashVertexDivisors(const safe_VkPipelineVertexInputStateCreateInfo &input_state,
+                                   const std::vector<VkVertexInputBindingDescription> &binding_descriptions) {
+    uint64_t hash = HashArray(binding_descriptions.data(), binding_descriptions.size(),
+                              static_cast<uint64_t>(PipelineStateKind::kVertexDivisors));
+    const auto *divisor_state = vku::FindStructInPNextChain<VkPipelineVertexInputDivisorStateCreateInfoEXT>(input_state.pNext);
+    if (divisor_state) {
+        hash = HashArray(divisor_state->pVertexBindingDivisors, divisor_state->vertexBindingDivisorCount, hash);
+    }
+    return hash;
+}
+
+static uint64_t HashColorBlendAttachments(const safe_VkPipelineColorBlendStateCreateInfo &color_blend_state,
+                                          const std::vector<VkPipelineColorBlendAttachmentState> &attachments) {
+    uint64_t hash = HashArray(attachments.data(), attachments.size(),
+                              static_cast<uint64_t>(PipelineStateKind::kColorBlendAttachments));
+    hash = HashArray(&color_blend_state.logicOpEnable, 1, hash);
+    if (const auto *color_write = vku::FindStructInPNextChain<VkPipelineColorWriteCreateInfoEXT>(color_blend_state.pNext)) {
+        hash = HashArray(color_write->pColorWriteEnables, color_write->attachmentCount, hash);
+    }
+    const auto *advanced = vku::FindStructInPNextChain<VkPipelineColorBlendAdvancedStateCreateInfoEXT>(color_blend_state.pNext);
+    if (advanced) {
+        const VkBool32 advanced_state[3] = {advanced->srcPremultiplied, advanced->dstPremultiplied,
+                                            static_cast<VkBool32>(advanced->blendOverlap)};
+        hash = HashArray(advanced_state, 3, hash);
+    }
+    return hash;
+}
+
+// The device features and limits never change, so checks that only read a state block give the same result for the same
+// content. Create calls with many pipelines mostly repeat the same blocks, only the novel ones need the checks.
+// Only clean results are kept, blocks that logged anything are validated (and reported) every time. That includes messages
+// no callback wanted yet, so a messenger created later still sees them.
+bool CoreChecks::ValidatePipelineStateOnce(uint64_t state_hash, const std::function<bool()> &validate) const {
+    if (clean_pipeline_states.contains(state_hash)) {
+        return false;
+    }
+    bool clean = false;
+    const bool skip = ValidateAndCheckClean(clean, validate);
+    if (clean) {
+        clean_pipeline_states.insert(state_hash, true);
+    }
+    return skip;
+}
 
 bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                         const VkGraphicsPipelineCreateInfo *pCreateInfos,
@@ -35,10 +92,33 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
                                                                      pPipelines, error_obj, cgpl_state_data);
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
 
-    for (uint32_t i = 0; i < count; i++) {
+    auto validate_pipeline = [&](uint32_t i) {
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
-        skip |= ValidateGraphicsPipeline(*cgpl_state->pipe_state[i].get(), create_info_loc);
-        skip |= ValidateGraphicsPipelineDerivatives(cgpl_state->pipe_state, i, create_info_loc);
+        bool pipeline_skip = ValidateGraphicsPipeline(*cgpl_state->pipe_state[i].get(), create_info_loc);
+        pipeline_skip |= ValidateGraphicsPipelineDerivatives(cgpl_state->pipe_state, i, create_info_loc);
+        return pipeline_skip;
+    };
+
+    // The pipelines only read the (already created) state, so they can be validated independently. The messages of each are
+    // held and reported in pipeline order, so the output is the same as validating them one by one.
+    // With async_shader_validation the first pipeline to use a module reports its spirv-val result, and the rest of the checks
+    // rely on knowing which pipeline that is, so those calls stay serial.
+    if (pipeline_workers && !spirv_val_queue && count >= kMinParallelPipelines) {
+        std::vector<DeferredMessages> messages(count);
+        std::vector<uint8_t> pipeline_skips(count, 0);
+        pipeline_workers->ParallelFor(count, [&](size_t i) {
+            DeferMessagesScope defer(messages[i]);
+            pipeline_skips[i] = validate_pipeline(static_cast<uint32_t>(i));
+        });
+        for (uint32_t i = 0; i < count; i++) {
+            skip |= pipeline_skips[i] != 0;
+            skip |= messages[i].Report();
+        }
+        return skip;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        skip |= validate_pipeline(i);
     }
     return skip;
 }
@@ -118,7 +198,9 @@ bool CoreChecks::ValidateGraphicsPipeline(const vvl::Pipeline &pipeline, const L
             } else {
                 const auto *binding_descriptions = pipeline.BindingDescriptions();
                 if (binding_descriptions) {
-                    skip |= ValidatePipelineVertexDivisors(*input_state, *binding_descriptions, create_info_loc);
+                    skip |= ValidatePipelineStateOnce(HashVertexDivisors(*input_state, *binding_descriptions), [&]() {
+                        return ValidatePipelineVertexDivisors(*input_state, *binding_descriptions, create_info_loc);
+                    });
                 }
             }
         }
@@ -1292,6 +1374,18 @@ bool CoreChecks::ValidateGraphicsPipelineColorBlendState(const vvl::Pipeline &pi
                          subpass_desc->colorAttachmentCount);
     }
     const auto &pipe_attachments = pipeline.Attachments();
+    const uint64_t state_hash = HashColorBlendAttachments(*color_blend_state, pipe_attachments);
+    skip |= ValidatePipelineStateOnce(state_hash, [&]() {
+        return ValidateGraphicsPipelineColorBlendAttachments(*color_blend_state, pipe_attachments, color_loc);
+    });
+    return skip;
+}
+
+// Only depends on the color blend state and the device
+bool CoreChecks::ValidateGraphicsPipelineColorBlendAttachments(
+    const safe_VkPipelineColorBlendStateCreateInfo &color_blend_state,
+    const std::vector<VkPipelineColorBlendAttachmentState> &pipe_attachments, const Location &color_loc) const {
+    bool skip = false;
     if (!enabled_features.independentBlend) {
         if (pipe_attachments.size() > 1) {
             const auto *const attachments = &pipe_attachments[0];
@@ -1309,7 +1403,7 @@ bool CoreChecks::ValidateGraphicsPipelineColorBlendState(const vvl::Pipeline &pi
             }
         }
     }
-    if (!enabled_features.logicOp && (color_blend_state->logicOpEnable != VK_FALSE)) {
+    if (!enabled_features.logicOp && (color_blend_state.logicOpEnable != VK_FALSE)) {
         skip |= LogError("VUID-VkPipelineColorBlendStateCreateInfo-logicOpEnable-00606", device,
                          color_loc.dot(Field::logicOpEnable), "is VK_TRUE, but the logicOp feature was not enabled.");
     }
@@ -1348,7 +1442,7 @@ bool CoreChecks::ValidateGraphicsPipelineColorBlendState(const vvl::Pipeline &pi
             }
         }
     }
-    auto color_write = vku::FindStructInPNextChain<VkPipelineColorWriteCreateInfoEXT>(color_blend_state->pNext);
+    auto color_write = vku::FindStructInPNextChain<VkPipelineColorWriteCreateInfoEXT>(color_blend_state.pNext);
     if (color_write) {
         if (color_write->attachmentCount > phys_dev_props.limits.maxColorAttachments) {
             skip |= LogError("VUID-VkPipelineColorWriteCreateInfoEXT-attachmentCount-06655", device,
@@ -1366,7 +1460,8 @@ bool CoreChecks::ValidateGraphicsPipelineColorBlendState(const vvl::Pipeline &pi
             }
         }
     }
-    const auto *color_blend_advanced = vku::FindStructInPNextChain<VkPipelineColorBlendAdvancedStateCreateInfoEXT>(color_blend_state->pNext);
+    const auto *color_blend_advanced =
+        vku::FindStructInPNextChain<VkPipelineColorBlendAdvancedStateCreateInfoEXT>(color_blend_state.pNext);
     if (color_blend_advanced) {
         if (!phys_dev_ext_props.blend_operation_advanced_props.advancedBlendCorrelatedOverlap &&
             color_blend_advanced->blendOverlap != VK_BLEND_OVERLAP_UNCORRELATED_EXT) {
@@ -2452,13 +2547,12 @@ bool CoreChecks::ValidateGraphicsPipelineFragmentShadingRateState(const vvl::Pip
 
     const auto combiner_ops = fragment_shading_rate_state->combinerOps;
     if (pipeline.pre_raster_state || pipeline.fragment_shader_state) {
-        const auto enums = ValidParamValues<VkFragmentShadingRateCombinerOpKHR>();
-        if (std::find(enums.begin(), enums.end(), combiner_ops[0]) == enums.end()) {
+        if (!IsValidEnumValue(combiner_ops[0])) {
             skip |= LogError("VUID-VkGraphicsPipelineCreateInfo-pDynamicState-06567", device,
                              create_info_loc.pNext(Struct::VkPipelineFragmentShadingRateStateCreateInfoKHR, Field::combinerOps, 0),
                              "(0x%" PRIx32 ") is invalid.", combiner_ops[0]);
         }
-        if (std::find(enums.begin(), enums.end(), combiner_ops[1]) == enums.end()) {
+        if (!IsValidEnumValue(combiner_ops[1])) {
             skip |= LogError("VUID-VkGraphicsPipelineCreateInfo-pDynamicState-06568", device,
                              create_info_loc.pNext(Struct::VkPipelineFragmentShadingRateStateCreateInfoKHR, Field::combinerOps, 1),
                              "(0x%" PRIx32 ") is invalid.", combiner_ops[1]);
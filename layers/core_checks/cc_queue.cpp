@@ -28,6 +28,8 @@
 struct CommandBufferSubmitState {
     const CoreChecks *core;
     const vvl::Queue *queue_state;
+    // Read once per submission, the overlay layouts are only right when no command buffer or all of them are validated
+    const bool validate_image_layouts;
     QFOTransferCBScoreboards<QFOImageTransferBarrier> qfo_image_scoreboards;
     QFOTransferCBScoreboards<QFOBufferTransferBarrier> qfo_buffer_scoreboards;
     std::vector<VkCommandBuffer> current_cmds;
@@ -43,7 +45,8 @@ struct CommandBufferSubmitState {
     EventToStageMap local_event_signal_info;
     vvl::unordered_map<VkVideoSessionKHR, vvl::VideoSessionDeviceState> local_video_session_state{};
 
-    CommandBufferSubmitState(const CoreChecks *c, const vvl::Queue *q) : core(c), queue_state(q) {
+    CommandBufferSubmitState(const CoreChecks *c, const vvl::Queue *q)
+        : core(c), queue_state(q), validate_image_layouts(!c->IsCheckShed(vvl::CheckFamily::ImageLayoutValidation)) {
         // Queue label state is updated during PostRecord phase.
         // Copy state to be able to track labels during validation.
         cmdbuf_label_stack_depth = queue_state->cmdbuf_label_stack_depth;
@@ -53,7 +56,9 @@ struct CommandBufferSubmitState {
 
     bool Validate(const Location &loc, const vvl::CommandBuffer &cb_state, uint32_t perf_pass) {
         bool skip = false;
-        skip |= core->ValidateCmdBufImageLayouts(loc, cb_state, overlay_image_layout_map);
+        if (validate_image_layouts && core->IsQueueFamilyValidated(queue_state->queueFamilyIndex)) {
+            skip |= core->ValidateCmdBufImageLayouts(loc, cb_state, overlay_image_layout_map);
+        }
         auto cmd = cb_state.commandBuffer();
         current_cmds.push_back(cmd);
         skip |= core->ValidatePrimaryCommandBufferState(
@@ -68,8 +73,9 @@ struct CommandBufferSubmitState {
         }
 
         // Call submit-time functions to validate or update local mirrors of state (to preserve const-ness at validate time)
-        for (auto &function : cb_state.queue_submit_functions) {
-            skip |= function(*core, *queue_state, cb_state);
+        // With async_submit_validation they are run by CORE_QUEUE_STATE::Retire() instead.
+        if (!core->enabled[async_submit_validation]) {
+            skip |= core->ValidateSubmitTimeChecks(*queue_state, cb_state);
         }
         for (auto &function : cb_state.eventUpdates) {
             skip |= function(const_cast<vvl::CommandBuffer &>(cb_state), /*do_validate*/ true, local_event_signal_info,
@@ -133,6 +139,33 @@ private:
     }
 };
 
+CORE_QUEUE_STATE::CORE_QUEUE_STATE(CoreChecks &core, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
+                                   const VkQueueFamilyProperties &queueFamilyProperties)
+    : vvl::Queue(core, q, index, flags, queueFamilyProperties), core_(core) {}
+
+bool CoreChecks::ValidateSubmitTimeChecks(const vvl::Queue &queue_state, const vvl::CommandBuffer &cb_state) const {
+    bool skip = false;
+    for (const auto &check : static_cast<const CORE_CMD_BUFFER_STATE &>(cb_state).submit_time_checks) {
+        if (const auto *barrier = std::get_if<ConcurrentBarrierCheck>(&check)) {
+            skip |= ValidateConcurrentBarrierAtSubmit(barrier->loc.Get(), *this, queue_state, cb_state, barrier->typed_handle,
+                                                      barrier->src_queue_family, barrier->dst_queue_family);
+        } else if (const auto *copy = std::get_if<CopyBufferOverlapCheck>(&check)) {
+            skip |= ValidateCopyBufferOverlapAtSubmit(*copy);
+        }
+    }
+    return skip;
+}
+
+void CORE_QUEUE_STATE::Retire(vvl::QueueSubmission &submission) {
+    if (core_.enabled[async_submit_validation]) {
+        for (const auto &cb_state : submission.cbs) {
+            auto cb_guard = cb_state->ReadLock();
+            core_.ValidateSubmitTimeChecks(*this, *cb_state);
+        }
+    }
+    vvl::Queue::Retire(submission);
+}
+
 bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                             const ErrorObject &error_obj) const {
     bool skip = false;
@@ -21,6 +21,7 @@
 #include <assert.h>
 #include <sstream>
 #include <string>
+#include <tuple>
 
 #include <vulkan/vk_enum_string_helper.h>
 #include "generated/chassis.h"
@@ -28,6 +29,9 @@
 #include "cc_buffer_address.h"
 #include "utils/ray_tracing_utils.h"
 
+// Below this many build infos, validating them on the calling thread is faster than splitting them on the workers
+static constexpr uint32_t kMinParallelBuildInfos = 64;
+
 bool CoreChecks::ValidateInsertAccelerationStructureMemoryRange(VkAccelerationStructureNV as, const vvl::DeviceMemory *mem_info,
                                                                 VkDeviceSize mem_offset, const Location &loc) const {
     return ValidateInsertMemoryRange(VulkanTypedHandle(as, kVulkanObjectTypeAccelerationStructureNV), mem_info, mem_offset, loc);
@@ -153,14 +157,10 @@ bool CoreChecks::PreCallValidateGetAccelerationStructureHandleNV(VkDevice device
 
 bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(VkCommandBuffer commandBuffer, uint32_t infoCount,
                                                                const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
-                                                               uint32_t info_i, const ErrorObject &error_obj) const {
+                                                               const ErrorObject &error_obj) const {
     using sparse_container::range;
 
     bool skip = false;
-    const VkAccelerationStructureBuildGeometryInfoKHR &info = pInfos[info_i];
-    const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
-    const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
-    const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
 
     auto validate_no_as_buffer_memory_overlap =
         [this, commandBuffer, error_obj](const vvl::AccelerationStructureKHR &accel_struct_a, const Location &location_a,
@@ -188,11 +188,21 @@ bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(VkCommandBuffer c
             return skip;
         };
 
-    if (info.srcAccelerationStructure != info.dstAccelerationStructure && src_as_state && dst_as_state) {
+    std::vector<std::shared_ptr<const vvl::AccelerationStructureKHR>> src_as_states(infoCount);
+    std::vector<std::shared_ptr<const vvl::AccelerationStructureKHR>> dst_as_states(infoCount);
+    for (const auto [info_i, info] : vvl::enumerate(pInfos, infoCount)) {
+        src_as_states[info_i] = Get<vvl::AccelerationStructureKHR>(info->srcAccelerationStructure);
+        dst_as_states[info_i] = Get<vvl::AccelerationStructureKHR>(info->dstAccelerationStructure);
+        const auto &src_as_state = src_as_states[info_i];
+        const auto &dst_as_state = dst_as_states[info_i];
+        if (info->srcAccelerationStructure == info->dstAccelerationStructure || !src_as_state || !dst_as_state) {
+            continue;
+        }
         const std::shared_ptr<vvl::Buffer> src_as_buffer = src_as_state->buffer_state;
         const std::shared_ptr<vvl::Buffer> dst_as_buffer = dst_as_state->buffer_state;
 
         if (src_as_buffer && dst_as_buffer) {
+            const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
             const range<VkDeviceSize> src_as_range(src_as_state->create_infoKHR.offset, src_as_state->create_infoKHR.size);
             const range<VkDeviceSize> dst_as_range(dst_as_state->create_infoKHR.offset, dst_as_state->create_infoKHR.size);
 
@@ -203,16 +213,111 @@ bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(VkCommandBuffer c
         }
     }
 
-    for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i, infoCount - info_i)) {
-        // Validate that scratch buffer's memory does not overlap destination acceleration structure's memory, or source
-        // acceleration structure's memory if build mode is update, or other scratch buffers' memory.
-        // Here validation is pessimistic: if one buffer associated to pInfos[other_info_j].scratchData.deviceAddress has an
-        // overlap, an error will be logged.
+    auto as_buffer_range = [](const vvl::AccelerationStructureKHR &as_state) {
+        return range<VkDeviceSize>(as_state.create_infoKHR.offset, as_state.create_infoKHR.offset + as_state.create_infoKHR.size);
+    };
+
+    // Instead of comparing every destination with the destinations and updated sources of all the other infos, the device memory
+    // ranges backing them are sorted, and only the pairs of infos found overlapping in the sweep below are checked (and reported)
+    // with GetResourceMemoryOverlap.
+    struct BoundRange {
+        VkDeviceMemory memory;
+        range<VkDeviceSize> memory_range;
+        uint32_t info_i;
+        bool is_src;
+    };
+    std::vector<BoundRange> bound_ranges;
+    auto add_bound_ranges = [&bound_ranges, &as_buffer_range](const vvl::AccelerationStructureKHR &as_state, uint32_t info_i,
+                                                              bool is_src) {
+        for (const auto &[memory, memory_ranges] : as_state.buffer_state->GetBoundMemoryRange(as_buffer_range(as_state))) {
+            for (const auto &memory_range : memory_ranges) {
+                bound_ranges.emplace_back(BoundRange{memory, memory_range, info_i, is_src});
+            }
+        }
+    };
+    for (const auto [info_i, info] : vvl::enumerate(pInfos, infoCount)) {
+        if (dst_as_states[info_i] && dst_as_states[info_i]->buffer_state) {
+            add_bound_ranges(*dst_as_states[info_i], info_i, false);
+        }
+        if (info->mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR && src_as_states[info_i] &&
+            src_as_states[info_i]->buffer_state) {
+            add_bound_ranges(*src_as_states[info_i], info_i, true);
+        }
+    }
+    std::sort(bound_ranges.begin(), bound_ranges.end(), [](const BoundRange &a, const BoundRange &b) {
+        return std::tie(a.memory, a.memory_range.begin) < std::tie(b.memory, b.memory_range.begin);
+    });
 
-        other_info_j += info_i;
+    // (dst info, other info, is_src of the other info): pInfos[dst info].dstAccelerationStructure overlaps the destination, or the
+    // updated source, of pInfos[other info]
+    std::vector<std::tuple<uint32_t, uint32_t, bool>> overlapping_infos;
+    std::vector<const BoundRange *> open_ranges;
+    for (const BoundRange &bound_range : bound_ranges) {
+        if (!open_ranges.empty() && open_ranges.front()->memory != bound_range.memory) {
+            open_ranges.clear();
+        }
+        // The ranges that start before this one and end before it can't overlap it, nor any of the ranges after it
+        open_ranges.erase(std::remove_if(open_ranges.begin(), open_ranges.end(),
+                                         [&bound_range](const BoundRange *open_range) {
+                                             return open_range->memory_range.begin < bound_range.memory_range.begin &&
+                                                    open_range->memory_range.end <= bound_range.memory_range.begin;
+                                         }),
+                          open_ranges.end());
+        for (const BoundRange *open_range : open_ranges) {
+            if (open_range->info_i == bound_range.info_i || (open_range->is_src && bound_range.is_src) ||
+                !open_range->memory_range.intersects(bound_range.memory_range)) {
+                continue;
+            }
+            const BoundRange &a = open_range->info_i < bound_range.info_i ? *open_range : bound_range;
+            const BoundRange &b = open_range->info_i < bound_range.info_i ? bound_range : *open_range;
+            // A source only overlaps the destinations of the infos before it (VUID 03701)
+            if (!a.is_src) {
+                overlapping_infos.emplace_back(a.info_i, b.info_i, b.is_src);
+            }
+        }
+        open_ranges.emplace_back(&bound_range);
+    }
+    // Report in the order of the infos, the same as checking each pair one after the other. Sparse buffers can add a pair twice.
+    std::sort(overlapping_infos.begin(), overlapping_infos.end(), [](const auto &a, const auto &b) {
+        // For a pair of infos VUID 03701 (updated source) comes before 03702 (destination)
+        return std::make_tuple(std::get<0>(a), std::get<1>(a), !std::get<2>(a)) <
+               std::make_tuple(std::get<0>(b), std::get<1>(b), !std::get<2>(b));
+    });
+    overlapping_infos.erase(std::unique(overlapping_infos.begin(), overlapping_infos.end()), overlapping_infos.end());
+
+    for (const auto &[info_i, other_info_j, is_src] : overlapping_infos) {
+        const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
         const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
+        const vvl::AccelerationStructureKHR &dst_as_state = *dst_as_states[info_i];
+        const vvl::AccelerationStructureKHR &other_as_state = is_src ? *src_as_states[other_info_j] : *dst_as_states[other_info_j];
+
+        if (is_src) {
+            // Validate destination acceleration structure's memory is not overlapped by another source acceleration structure's
+            // memory that is going to be updated by this cmd
+            skip |= validate_no_as_buffer_memory_overlap(
+                dst_as_state, info_i_loc.dot(Field::dstAccelerationStructure), *dst_as_state.buffer_state,
+                as_buffer_range(dst_as_state), other_as_state, other_info_j_loc.dot(Field::srcAccelerationStructure),
+                *other_as_state.buffer_state, as_buffer_range(other_as_state),
+                "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701");
+        } else {
+            // Validate that there is no destination acceleration structures' memory overlaps
+            skip |= validate_no_as_buffer_memory_overlap(
+                dst_as_state, info_i_loc.dot(Field::dstAccelerationStructure), *dst_as_state.buffer_state,
+                as_buffer_range(dst_as_state), other_as_state, other_info_j_loc.dot(Field::dstAccelerationStructure),
+                *other_as_state.buffer_state, as_buffer_range(other_as_state),
+                "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702");
+        }
+    }
+
+    // Validate that scratch buffer's memory does not overlap destination acceleration structure's memory, or source
+    // acceleration structure's memory if build mode is update, or other scratch buffers' memory.
+    // Here validation is pessimistic: if one buffer associated to pInfos[other_info_j].scratchData.deviceAddress has an
+    // overlap, an error will be logged.
 // https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/6040
 #if 0
+    for (uint32_t info_i = 0; info_i < infoCount; ++info_i) {
+        const VkAccelerationStructureBuildGeometryInfoKHR *info = &pInfos[info_i];
+        for (uint32_t other_info_j = info_i; other_info_j < infoCount; ++other_info_j) {
             if (auto other_scratches = GetBuffersByAddress(pInfos[other_info_j].scratchData.deviceAddress);
                 !other_scratches.empty()) {
                 using BUFFER_STATE_PTR = ValidationStateTracker::BUFFER_STATE_PTR;
@@ -441,50 +546,9 @@ bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(VkCommandBuffer c
                     *this, other_scratches, "vkCmdBuildAccelerationStructuresKHR()", address_name_ss.str(),
                     pInfos[other_info_j].scratchData.deviceAddress);
             }
-#endif
-        // skip comparing to self info
-        if (other_info_j != info_i) {
-            const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(pInfos[other_info_j].dstAccelerationStructure);
-            const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(pInfos[other_info_j].srcAccelerationStructure);
-
-            // Validate destination acceleration structure's memory is not overlapped by another source acceleration structure's
-            // memory that is going to be updated by this cmd
-            if (dst_as_state && dst_as_state->buffer_state && other_src_as_state && other_src_as_state->buffer_state) {
-                if (pInfos[other_info_j].mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR) {
-                    const vvl::Buffer &buffer_a = *dst_as_state->buffer_state;
-                    const range<VkDeviceSize> range_a(dst_as_state->create_infoKHR.offset,
-                                                      dst_as_state->create_infoKHR.offset + dst_as_state->create_infoKHR.size);
-
-                    const vvl::Buffer &buffer_b = *other_src_as_state->buffer_state;
-                    const range<VkDeviceSize> range_b(
-                        other_src_as_state->create_infoKHR.offset,
-                        other_src_as_state->create_infoKHR.offset + other_src_as_state->create_infoKHR.size);
-
-                    skip |= validate_no_as_buffer_memory_overlap(
-                        *dst_as_state, info_i_loc.dot(Field::dstAccelerationStructure), buffer_a, range_a, *other_src_as_state,
-                        other_info_j_loc.dot(Field::srcAccelerationStructure), buffer_b, range_b,
-                        "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701");
-                }
-            }
-
-            // Validate that there is no destination acceleration structures' memory overlaps
-            if (dst_as_state && dst_as_state->buffer_state && other_dst_as_state && other_dst_as_state->buffer_state) {
-                const vvl::Buffer &buffer_a = *dst_as_state->buffer_state;
-                const range<VkDeviceSize> range_a(dst_as_state->create_infoKHR.offset,
-                                                  dst_as_state->create_infoKHR.offset + dst_as_state->create_infoKHR.size);
-
-                const vvl::Buffer &buffer_b = *other_dst_as_state->buffer_state;
-                const range<VkDeviceSize> range_b(
-                    other_dst_as_state->create_infoKHR.offset,
-                    other_dst_as_state->create_infoKHR.offset + other_dst_as_state->create_infoKHR.size);
-
-                skip |= validate_no_as_buffer_memory_overlap(
-                    *dst_as_state, info_i_loc.dot(Field::dstAccelerationStructure), buffer_a, range_a, *other_dst_as_state,
-                    other_info_j_loc.dot(Field::dstAccelerationStructure), buffer_b, range_b,
-                    "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702");
-            }
         }
     }
+#endif
 
     return skip;
 }
@@ -499,8 +563,7 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
     const auto *p_geometries = info.pGeometries;
     const auto *const *const pp_geometries = info.ppGeometries;
 
-    auto buffer_check = [this](uint32_t gi, const VkDeviceOrHostAddressConstKHR address, const Location &geom_loc) -> bool {
-        const auto buffer_states = GetBuffersByAddress(address.deviceAddress);
+    auto buffer_check = [this](vvl::span<const BUFFER_STATE_PTR> buffer_states, const Location &geom_loc) -> bool {
         const bool no_valid_buffer_found =
             !buffer_states.empty() &&
             std::none_of(buffer_states.begin(), buffer_states.end(),
@@ -533,6 +596,30 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
     }
 
     if (geom_accessor) {
+        // Builds can have thousands of geometries, resolve all of their addresses at once
+        constexpr uint32_t kAddressesPerGeometry = 3;
+        std::vector<VkDeviceAddress> addresses(geometry_count * kAddressesPerGeometry, 0);
+        for (uint32_t geom_i = 0; geom_i < geometry_count; ++geom_i) {
+            const auto &geom_data = geom_accessor(geom_i);
+            VkDeviceAddress *geom_addresses = &addresses[geom_i * kAddressesPerGeometry];
+            switch (geom_data.geometryType) {
+                case VK_GEOMETRY_TYPE_TRIANGLES_KHR:
+                    geom_addresses[0] = geom_data.geometry.triangles.vertexData.deviceAddress;
+                    geom_addresses[1] = geom_data.geometry.triangles.indexData.deviceAddress;
+                    geom_addresses[2] = geom_data.geometry.triangles.transformData.deviceAddress;
+                    break;
+                case VK_GEOMETRY_TYPE_INSTANCES_KHR:
+                    geom_addresses[0] = geom_data.geometry.instances.data.deviceAddress;
+                    break;
+                case VK_GEOMETRY_TYPE_AABBS_KHR:
+                    geom_addresses[0] = geom_data.geometry.aabbs.data.deviceAddress;
+                    break;
+                default:
+                    break;
+            }
+        }
+        const auto geom_buffers = GetBuffersByAddresses(addresses);
+
         const Location pp_build_range_info_loc(info_loc.function, Field::ppBuildRangeInfos, info_i);
         for (uint32_t geom_i = 0; geom_i < geometry_count; ++geom_i) {
             const Location p_geom_loc = info_loc.dot(pp_geometries ? Field::pGeometries : Field::ppGeometries, geom_i);
@@ -542,14 +629,13 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
             switch (geom_data.geometryType) {
                 case VK_GEOMETRY_TYPE_TRIANGLES_KHR:  // == VK_GEOMETRY_TYPE_TRIANGLES_NV
                 {
-                    skip |= buffer_check(geom_i, geom_data.geometry.triangles.vertexData,
-                                         p_geom_geom_triangles_loc.dot(Field::vertexData));
-                    skip |= buffer_check(geom_i, geom_data.geometry.triangles.indexData,
-                                         p_geom_geom_triangles_loc.dot(Field::indexData));
-                    skip |= buffer_check(geom_i, geom_data.geometry.triangles.transformData,
-                                         p_geom_geom_triangles_loc.dot(Field::transformData));
-
-                    auto vertex_buffer_states = GetBuffersByAddress(geom_data.geometry.triangles.vertexData.deviceAddress);
+                    const auto vertex_buffer_states = geom_buffers[geom_i * kAddressesPerGeometry];
+                    const auto index_buffer_states = geom_buffers[geom_i * kAddressesPerGeometry + 1];
+                    const auto tranform_buffer_states = geom_buffers[geom_i * kAddressesPerGeometry + 2];
+                    skip |= buffer_check(vertex_buffer_states, p_geom_geom_triangles_loc.dot(Field::vertexData));
+                    skip |= buffer_check(index_buffer_states, p_geom_geom_triangles_loc.dot(Field::indexData));
+                    skip |= buffer_check(tranform_buffer_states, p_geom_geom_triangles_loc.dot(Field::transformData));
+
                     if (vertex_buffer_states.empty()) {
                         skip |= LogError("VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03804", cmd_buffer,
                                          p_geom_geom_triangles_loc.dot(Field::vertexData).dot(Field::deviceAddress),
@@ -571,7 +657,6 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
                     }
 
                     if (geom_data.geometry.triangles.indexType != VK_INDEX_TYPE_NONE_KHR) {
-                        auto index_buffer_states = GetBuffersByAddress(geom_data.geometry.triangles.indexData.deviceAddress);
                         if (index_buffer_states.empty()) {
                             skip |= LogError("VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03806", cmd_buffer,
                                              p_geom_geom_triangles_loc.dot(Field::indexData).dot(Field::deviceAddress),
@@ -674,7 +759,6 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
                         }
                     }
                     if (geom_data.geometry.triangles.transformData.deviceAddress != 0) {
-                        auto tranform_buffer_states = GetBuffersByAddress(geom_data.geometry.triangles.transformData.deviceAddress);
                         if (tranform_buffer_states.empty()) {
                             skip |= LogError("VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03808", cmd_buffer,
                                              p_geom_geom_triangles_loc.dot(Field::transformData).dot(Field::deviceAddress),
@@ -702,8 +786,8 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
                     const Location instances_loc = p_geom_geom_loc.dot(Field::instances);
                     const Location instances_data_loc = instances_loc.dot(Field::data);
 
-                    skip |= buffer_check(geom_i, geom_data.geometry.instances.data, instances_data_loc);
-                    auto buffer_states = GetBuffersByAddress(geom_data.geometry.instances.data.deviceAddress);
+                    const auto buffer_states = geom_buffers[geom_i * kAddressesPerGeometry];
+                    skip |= buffer_check(buffer_states, instances_data_loc);
                     if (buffer_states.empty()) {
                         skip |= LogError("VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03813", cmd_buffer,
                                          instances_data_loc.dot(Field::deviceAddress),
@@ -728,9 +812,8 @@ bool CoreChecks::ValidateAccelerationBuffers(VkCommandBuffer cmd_buffer, uint32_
                 }
                 case VK_GEOMETRY_TYPE_AABBS_KHR:  // == VK_GEOMETRY_TYPE_AABBS_NV
                 {
-                    skip |= buffer_check(geom_i, geom_data.geometry.aabbs.data, p_geom_geom_loc.dot(Field::aabbs).dot(Field::data));
-
-                    auto aabb_buffer_states = GetBuffersByAddress(geom_data.geometry.aabbs.data.deviceAddress);
+                    const auto aabb_buffer_states = geom_buffers[geom_i * kAddressesPerGeometry];
+                    skip |= buffer_check(aabb_buffer_states, p_geom_geom_loc.dot(Field::aabbs).dot(Field::data));
                     if (aabb_buffer_states.empty()) {
                         skip |= LogError("VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03811", cmd_buffer,
                                          p_geom_geom_loc.dot(Field::aabbs).dot(Field::data).dot(Field::deviceAddress),
@@ -849,7 +932,9 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresKHR(
         return skip;
     }
 
-    for (const auto [info_i, info] : vvl::enumerate(pInfos, infoCount)) {
+    auto validate_info = [&](uint32_t info_i) {
+        bool skip = false;
+        const VkAccelerationStructureBuildGeometryInfoKHR *info = &pInfos[info_i];
         const Location info_loc = error_obj.location.dot(Field::pInfos, info_i);
 
         const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info->srcAccelerationStructure);
@@ -1016,10 +1101,30 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresKHR(
         }
 
         skip |= ValidateAccelerationBuffers(commandBuffer, info_i, *info, ppBuildRangeInfos[info_i], info_loc);
+        return skip;
+    };
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i, error_obj);
+    // Each info only reads the state of its acceleration structures and buffers, so large batches are split on the workers.
+    // The messages of each info are held and reported in info order, the same output as validating them one by one.
+    if (pipeline_workers && infoCount >= kMinParallelBuildInfos) {
+        std::vector<DeferredMessages> messages(infoCount);
+        std::vector<uint8_t> info_skips(infoCount, 0);
+        pipeline_workers->ParallelFor(infoCount, [&](size_t info_i) {
+            DeferMessagesScope defer(messages[info_i]);
+            info_skips[info_i] = validate_info(static_cast<uint32_t>(info_i));
+        });
+        for (uint32_t info_i = 0; info_i < infoCount; ++info_i) {
+            skip |= info_skips[info_i] != 0;
+            skip |= messages[info_i].Report();
+        }
+    } else {
+        for (uint32_t info_i = 0; info_i < infoCount; ++info_i) {
+            skip |= validate_info(info_i);
+        }
     }
 
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, error_obj);
+
     return skip;
 }
 
@@ -1887,6 +1992,21 @@ bool CoreChecks::ValidateRaytracingShaderBindingTable(VkCommandBuffer commandBuf
         return skip;
     }
 
+    // Trace calls mostly reuse the same regions. While the buffer address snapshot is unchanged, the buffers at the address and
+    // their usage, size and address range are too, only the memory binding of the buffer can have changed since.
+    const SbtRegionKey region_key{binding_table.deviceAddress, binding_table.stride, binding_table.size};
+    const auto snapshot = GetBufferAddressSnapshot();
+    {
+        ReadLockGuard guard(sbt_region_lock);
+        if (sbt_region_snapshot == snapshot) {
+            const auto cached = sbt_region_buffers.find(region_key);
+            if (cached != sbt_region_buffers.end() &&
+                BufferAddressValidation<1>::ValidateMemoryBoundToBuffer(*this, cached->second, nullptr)) {
+                return skip;
+            }
+        }
+    }
+
     const auto buffer_states = GetBuffersByAddress(binding_table.deviceAddress);
     if (buffer_states.empty()) {
         skip |= LogError("VUID-VkStridedDeviceAddressRegionKHR-size-04631", commandBuffer, table_loc.dot(Field::deviceAddress),
@@ -1952,8 +2072,18 @@ bool CoreChecks::ValidateRaytracingShaderBindingTable(VkCommandBuffer commandBuf
              }},
         }}};
 
-        skip |= buffer_address_validator.LogErrorsIfNoValidBuffer(*this, buffer_states, table_loc.dot(Field::deviceAddress),
-                                                                  binding_table.deviceAddress);
+        if (const auto valid_buffer = buffer_address_validator.FindValidBuffer(buffer_states)) {
+            WriteLockGuard guard(sbt_region_lock);
+            if (sbt_region_snapshot != snapshot) {
+                sbt_region_buffers.clear();
+                sbt_region_snapshot = snapshot;
+            }
+            // buffer_states may come from a newer snapshot, its entries are then never used and dropped with the next update
+            sbt_region_buffers[region_key] = valid_buffer;
+        } else {
+            skip |= buffer_address_validator.LogInvalidBuffers(*this, buffer_states, table_loc.dot(Field::deviceAddress),
+                                                               binding_table.deviceAddress);
+        }
     }
 
     return skip;
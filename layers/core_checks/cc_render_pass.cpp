@@ -293,6 +293,11 @@ bool CoreChecks::ValidateRenderPassCompatibility(const char *type1_string, const
                                                  const char *type2_string, const vvl::RenderPass &rp2_state, const Location &loc,
                                                  const char *vuid) const {
     bool skip = false;
+    // Secondaries executed in the render pass they were recorded for are the common case, the structural comparison below is
+    // only needed to report what differs
+    if (&rp1_state == &rp2_state || rp1_state.compatibility_hash == rp2_state.compatibility_hash) {
+        return skip;
+    }
 
     // createInfo flags must be identical for the renderpasses to be compatible.
     if (rp1_state.createInfo.flags != rp2_state.createInfo.flags) {
@@ -17,7 +17,9 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -449,11 +451,43 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
     if (producer_entrypoint.has_passthrough) {
         return skip;  // PassthroughNV doesn't have to do Location matching
     }
+    if (producer_entrypoint.has_unmatched_output_slots || consumer_entrypoint.has_unmatched_input_slots) {
+        return skip;  // TODO workaround
+    }
+
+    // The result only depends on the two entry points (and the device), the same pairs are repeated by many pipelines
+    const uint64_t interface_key =
+        (static_cast<uint64_t>(producer_entrypoint.unique_id) << 32) | static_cast<uint64_t>(consumer_entrypoint.unique_id);
+    if (clean_stage_interfaces.contains(interface_key)) {
+        return skip;
+    }
+
+    // Only a match that logged nothing is cached, so every pipeline still gets its own errors and warnings. The callback
+    // can return VK_FALSE for an error, so this is decided from the messages and not from skip.
+    bool clean = false;
+    skip |= ValidateAndCheckClean(clean, [&]() {
+        bool interface_skip =
+            ValidateInterfaceSlotsBetweenStages(producer, producer_entrypoint, consumer, consumer_entrypoint, create_info_loc);
+        // Need to check the BuiltIn interface (if not going into Fragment)
+        if (consumer_entrypoint.stage != VK_SHADER_STAGE_FRAGMENT_BIT) {
+            interface_skip |=
+                ValidateBuiltinBlocksBetweenStages(producer, producer_entrypoint, consumer, consumer_entrypoint, create_info_loc);
+        }
+        return interface_skip;
+    });
+    if (clean) {
+        clean_stage_interfaces.insert(interface_key, true);
+    }
+    return skip;
+}
 
+bool CoreChecks::ValidateInterfaceSlotsBetweenStages(const spirv::Module &producer, const spirv::EntryPoint &producer_entrypoint,
+                                                     const spirv::Module &consumer, const spirv::EntryPoint &consumer_entrypoint,
+                                                     const Location &create_info_loc) const {
+    bool skip = false;
     const VkShaderStageFlagBits producer_stage = producer_entrypoint.stage;
     const VkShaderStageFlagBits consumer_stage = consumer_entrypoint.stage;
 
-    // build up a mapping of which slots are used and then go through it and look for gaps
     struct ComponentInfo {
         const spirv::StageInteraceVariable *output = nullptr;
         uint32_t output_type = 0;
@@ -462,35 +496,41 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
         uint32_t input_type = 0;
         uint32_t input_width = 0;
     };
-    // <Location, Components[4]> (only 4 components in a Location)
-    vvl::unordered_map<uint32_t, std::array<ComponentInfo, 4>> slot_map;
-
-    for (const auto &interface_slot : producer_entrypoint.output_interface_slots) {
-        auto &slot = slot_map[interface_slot.first.Location()][interface_slot.first.Component()];
-        if (interface_slot.second->nested_struct || interface_slot.second->physical_storage_buffer) {
-            return skip;  // TODO workaround
-        }
-        slot.output = interface_slot.second;
-        slot.output_type = interface_slot.first.type;
-        slot.output_width = interface_slot.first.bit_width;
-    }
-    for (const auto &interface_slot : consumer_entrypoint.input_interface_slots) {
-        auto &slot = slot_map[interface_slot.first.Location()][interface_slot.first.Component()];
-        if (interface_slot.second->nested_struct || interface_slot.second->physical_storage_buffer) {
-            return skip;  // TODO workaround
-        }
-        slot.input = interface_slot.second;
-        slot.input_type = interface_slot.first.type;
-        slot.input_width = interface_slot.first.bit_width;
-    }
 
-    for (const auto &slot : slot_map) {
+    // Both slot lists are sorted, so walk them together one Location (4 Components) at a time
+    const std::vector<spirv::InterfaceSlotVariable> &outputs = producer_entrypoint.output_interface_slots;
+    const std::vector<spirv::InterfaceSlotVariable> &inputs = consumer_entrypoint.input_interface_slots;
+    size_t output_index = 0;
+    size_t input_index = 0;
+    while (output_index < outputs.size() || input_index < inputs.size()) {
         // Found that sometimes there is a big mismatch and printing out EVERY slot adds a lot of noise
         if (skip) break;
 
-        const uint32_t location = slot.first;
+        uint32_t location = std::numeric_limits<uint32_t>::max();
+        if (output_index < outputs.size()) {
+            location = outputs[output_index].slot->Location();
+        }
+        if (input_index < inputs.size()) {
+            location = std::min(location, inputs[input_index].slot->Location());
+        }
+        std::array<ComponentInfo, 4> components{};
+        for (; output_index < outputs.size() && outputs[output_index].slot->Location() == location; output_index++) {
+            const spirv::InterfaceSlotVariable &output = outputs[output_index];
+            auto &component_info = components[output.slot->Component()];
+            component_info.output = output.variable;
+            component_info.output_type = output.slot->type;
+            component_info.output_width = output.slot->bit_width;
+        }
+        for (; input_index < inputs.size() && inputs[input_index].slot->Location() == location; input_index++) {
+            const spirv::InterfaceSlotVariable &input = inputs[input_index];
+            auto &component_info = components[input.slot->Component()];
+            component_info.input = input.variable;
+            component_info.input_type = input.slot->type;
+            component_info.input_width = input.slot->bit_width;
+        }
+
         for (uint32_t component = 0; component < 4; component++) {
-            const auto &component_info = slot.second[component];
+            const auto &component_info = components[component];
             const auto *input_var = component_info.input;
             const auto *output_var = component_info.output;
 
@@ -572,10 +612,15 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const spirv::Module &producer, c
         }
     }
 
-    // Need to check the BuiltIn interface (if not going into Fragment)
-    if (consumer_stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
-        return skip;
-    }
+    return skip;
+}
+
+bool CoreChecks::ValidateBuiltinBlocksBetweenStages(const spirv::Module &producer, const spirv::EntryPoint &producer_entrypoint,
+                                                    const spirv::Module &consumer, const spirv::EntryPoint &consumer_entrypoint,
+                                                    const Location &create_info_loc) const {
+    bool skip = false;
+    const VkShaderStageFlagBits producer_stage = producer_entrypoint.stage;
+    const VkShaderStageFlagBits consumer_stage = consumer_entrypoint.stage;
 
     std::vector<uint32_t> input_builtins_block;
     std::vector<uint32_t> output_builtins_block;
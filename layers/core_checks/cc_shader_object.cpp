@@ -279,8 +279,8 @@ bool CoreChecks::PreCallValidateCreateShadersEXT(VkDevice device, uint32_t creat
             skip |= RunSpirvValidation(binary, create_info_loc);
 
             const StageCreateInfo stage_create_info(pCreateInfos[i]);
-            const auto spirv =
-                std::make_shared<spirv::Module>(pCreateInfos[i].codeSize, static_cast<const uint32_t*>(pCreateInfos[i].pCode));
+            const auto spirv = spirv::Module::Create(pCreateInfos[i].codeSize, static_cast<const uint32_t*>(pCreateInfos[i].pCode),
+                                                     spirv_parsed_cache_);
             safe_VkShaderCreateInfoEXT safe_create_info = safe_VkShaderCreateInfoEXT(&pCreateInfos[i]);
             const PipelineStageState stage_state(nullptr, &safe_create_info, nullptr, spirv);
             skip |= ValidatePipelineShaderStage(stage_create_info, stage_state, create_info_loc);
@@ -19,6 +19,7 @@
 
 #include <cassert>
 #include <cinttypes>
+#include <future>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -2042,6 +2043,7 @@ bool CoreChecks::ValidateShaderTileImage(const spirv::Module &module_state, cons
 // Function to get the VkPipelineShaderStageCreateInfo from the various pipeline types
 bool CoreChecks::ValidatePipelineShaderStage(const StageCreateInfo &stage_create_info, const PipelineStageState &stage_state,
                                              const Location &loc) const {
+    auto check_scope = ProfileCheck(vvl::ValidationCheck::ValidatePipelineShaderStage);
     bool skip = false;
     const VkShaderStageFlagBits stage = stage_state.GetStage();
 
@@ -2056,6 +2058,13 @@ bool CoreChecks::ValidatePipelineShaderStage(const StageCreateInfo &stage_create
         skip |= ValidatePipelineRobustnessCreateInfo(*stage_create_info.pipeline, *pipeline_robustness_info, loc);
     }
 
+    if (spirv_val_queue && stage_state.module_state) {
+        // The rest assumes valid SPIR-V, which is only known now with async_shader_validation
+        if (ReportPendingSpirvValidation(stage_state.module_state->Handle().Cast<VkShaderModule>(), loc.dot(Field::module))) {
+            return true;
+        }
+    }
+
     if ((stage_create_info.pipeline && stage_create_info.pipeline->uses_shader_module_id) || !stage_state.spirv_state) {
         return skip;  // these edge cases should be validated already
     }
@@ -2069,172 +2078,201 @@ bool CoreChecks::ValidatePipelineShaderStage(const StageCreateInfo &stage_create
     const spirv::Module &module_state = *stage_state.spirv_state.get();
     const spirv::EntryPoint &entrypoint = *stage_state.entrypoint;
 
+    // spirv-opt and spirv-val use the same flags, in spirv_val_options
+    const spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+
     // to prevent const_cast on pipeline object, just store here as not needed outside function anyway
     uint32_t local_size_x = 0;
     uint32_t local_size_y = 0;
     uint32_t local_size_z = 0;
     uint32_t total_workgroup_shared_memory = 0;
 
+    // Applying the specialization runs spirv-opt and spirv-val on the whole module, so the result for the same module, entry
+    // point and specialization is kept in the default validation cache
+    ValidationCache *specialization_cache = nullptr;
+    uint64_t specialization_key = 0;
+    bool specialization_cached = false;
+    if (module_state.static_data_.has_specialization_constants && core_validation_cache) {
+        specialization_cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+        specialization_key =
+            SpecializationCacheKey(module_state, entrypoint, stage_state.GetSpecializationInfo(), spirv_environment,
+                                   ValidatorOptionsMask(device_extensions, enabled_features));
+        ValidationCache::SpecializationResult cached;
+        if (specialization_cache->FindSpecialization(specialization_key, cached)) {
+            local_size_x = cached.local_size_x;
+            local_size_y = cached.local_size_y;
+            local_size_z = cached.local_size_z;
+            total_workgroup_shared_memory = cached.workgroup_shared_memory;
+            specialization_cached = true;
+        }
+    }
+
     // If specialization-constant instructions are present in the shader, the specializations should be applied.
-    if (module_state.static_data_.has_specialization_constants) {
-        // both spirv-opt and spirv-val will use the same flags
-        spvtools::ValidatorOptions options;
-        AdjustValidatorOptions(device_extensions, enabled_features, options);
-
-        // setup the call back if the optimizer fails
-        spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
-        spvtools::Optimizer optimizer(spirv_environment);
-        spvtools::MessageConsumer consumer = [&skip, &module_state, &stage, loc, this](
-                                                 spv_message_level_t level, const char *source, const spv_position_t &position,
-                                                 const char *message) {
-            skip |= LogError("VUID-VkPipelineShaderStageCreateInfo-module-parameter", device, loc,
-                             "%s failed in spirv-opt because it does not contain valid spirv for stage %s. %s",
-                             FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage), message);
-        };
-        optimizer.SetMessageConsumer(consumer);
-
-        // The app might be using the default spec constant values, but if they pass values at runtime to the pipeline then need to
-        // use those values to apply to the spec constants
-        auto const &specialization_info = stage_state.GetSpecializationInfo();
-        if (specialization_info != nullptr && specialization_info->mapEntryCount > 0 &&
-            specialization_info->pMapEntries != nullptr) {
-            // Gather the specialization-constant values.
-            auto const &specialization_data = reinterpret_cast<uint8_t const *>(specialization_info->pData);
-            std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;  // note: this must be std:: to work with spvtools
-            id_value_map.reserve(specialization_info->mapEntryCount);
-
-            // spirv-val makes sure every OpSpecConstant has a OpDecoration.
-            for (const auto &itr : module_state.static_data_.id_to_spec_id) {
-                const uint32_t spec_id = itr.second;
-                VkSpecializationMapEntry map_entry = {spirv::kInvalidValue, 0, 0};
-                for (uint32_t i = 0; i < specialization_info->mapEntryCount; i++) {
-                    if (specialization_info->pMapEntries[i].constantID == spec_id) {
-                        map_entry = specialization_info->pMapEntries[i];
-                        break;
+    if (module_state.static_data_.has_specialization_constants && !specialization_cached) {
+        // Only a specialization that logged nothing is cached, even if nothing was reported (such as a filtered message), so
+        // no error path can let its result into the cache
+        bool specialization_clean = false;
+        skip |= ValidateAndCheckClean(specialization_clean, [&]() {
+            bool spec_skip = false;
+
+            // setup the call back if the optimizer fails
+            spvtools::Optimizer optimizer(spirv_environment);
+            spvtools::MessageConsumer consumer = [&spec_skip, &module_state, &stage, loc, this](
+                                                     spv_message_level_t level, const char *source, const spv_position_t &position,
+                                                     const char *message) {
+                spec_skip |= LogError("VUID-VkPipelineShaderStageCreateInfo-module-parameter", device, loc,
+                                      "%s failed in spirv-opt because it does not contain valid spirv for stage %s. %s",
+                                      FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage), message);
+            };
+            optimizer.SetMessageConsumer(consumer);
+
+            // The app might be using the default spec constant values, but if they pass values at runtime to the pipeline then need
+            // to use those values to apply to the spec constants
+            auto const &specialization_info = stage_state.GetSpecializationInfo();
+            if (specialization_info != nullptr && specialization_info->mapEntryCount > 0 &&
+                specialization_info->pMapEntries != nullptr) {
+                // Gather the specialization-constant values.
+                auto const &specialization_data = reinterpret_cast<uint8_t const *>(specialization_info->pData);
+                std::unordered_map<uint32_t, std::vector<uint32_t>> id_value_map;  // note: this must be std:: to work with spvtools
+                id_value_map.reserve(specialization_info->mapEntryCount);
+
+                // spirv-val makes sure every OpSpecConstant has a OpDecoration.
+                for (const auto &itr : module_state.static_data_.id_to_spec_id) {
+                    const uint32_t spec_id = itr.second;
+                    VkSpecializationMapEntry map_entry = {spirv::kInvalidValue, 0, 0};
+                    for (uint32_t i = 0; i < specialization_info->mapEntryCount; i++) {
+                        if (specialization_info->pMapEntries[i].constantID == spec_id) {
+                            map_entry = specialization_info->pMapEntries[i];
+                            break;
+                        }
                     }
-                }
 
-                // "If a constantID value is not a specialization constant ID used in the shader, that map entry does not affect the
-                // behavior of the pipeline."
-                if (map_entry.constantID == spirv::kInvalidValue) {
-                    continue;
-                }
+                    // "If a constantID value is not a specialization constant ID used in the shader, that map entry does not affect
+                    // the behavior of the pipeline."
+                    if (map_entry.constantID == spirv::kInvalidValue) {
+                        continue;
+                    }
 
-                uint32_t spec_const_size = spirv::kInvalidValue;
-                const spirv::Instruction *def_insn = module_state.FindDef(itr.first);
-                const spirv::Instruction *type_insn = module_state.FindDef(def_insn->Word(1));
+                    uint32_t spec_const_size = spirv::kInvalidValue;
+                    const spirv::Instruction *def_insn = module_state.FindDef(itr.first);
+                    const spirv::Instruction *type_insn = module_state.FindDef(def_insn->Word(1));
 
-                // Specialization constants can only be of type bool, scalar integer, or scalar floating point
-                switch (type_insn->Opcode()) {
-                    case spv::OpTypeBool:
-                        // "If the specialization constant is of type boolean, size must be the byte size of VkBool32"
-                        spec_const_size = sizeof(VkBool32);
-                        break;
-                    case spv::OpTypeInt:
-                    case spv::OpTypeFloat:
-                        spec_const_size = type_insn->Word(2) / 8;
-                        break;
-                    default:
-                        // spirv-val should catch if SpecId is not used on a
-                        // OpSpecConstantTrue/OpSpecConstantFalse/OpSpecConstant and OpSpecConstant is validated to be a
-                        // OpTypeInt or OpTypeFloat
-                        break;
-                }
+                    // Specialization constants can only be of type bool, scalar integer, or scalar floating point
+                    switch (type_insn->Opcode()) {
+                        case spv::OpTypeBool:
+                            // "If the specialization constant is of type boolean, size must be the byte size of VkBool32"
+                            spec_const_size = sizeof(VkBool32);
+                            break;
+                        case spv::OpTypeInt:
+                        case spv::OpTypeFloat:
+                            spec_const_size = type_insn->Word(2) / 8;
+                            break;
+                        default:
+                            // spirv-val should catch if SpecId is not used on a
+                            // OpSpecConstantTrue/OpSpecConstantFalse/OpSpecConstant and OpSpecConstant is validated to be a
+                            // OpTypeInt or OpTypeFloat
+                            break;
+                    }
 
-                if (map_entry.size != spec_const_size) {
-                    std::stringstream name;
-                    if (module_state.handle()) {
-                        name << "shader module " << module_state.handle();
-                    } else {
-                        name << "shader object";
+                    if (map_entry.size != spec_const_size) {
+                        std::stringstream name;
+                        if (module_state.handle()) {
+                            name << "shader module " << module_state.handle();
+                        } else {
+                            name << "shader object";
+                        }
+                        spec_skip |= LogError("VUID-VkSpecializationMapEntry-constantID-00776", device, loc,
+                                              "specialization constant (ID = %" PRIu32 ", entry = %" PRIu32
+                                              ") has invalid size %zu in %s. Expected size is %" PRIu32 " from shader definition.",
+                                              map_entry.constantID, spec_id, map_entry.size,
+                                              FormatHandle(module_state.handle()).c_str(), spec_const_size);
                     }
-                    skip |= LogError("VUID-VkSpecializationMapEntry-constantID-00776", device, loc,
-                                     "specialization constant (ID = %" PRIu32 ", entry = %" PRIu32
-                                     ") has invalid size %zu in %s. Expected size is %" PRIu32 " from shader definition.",
-                                     map_entry.constantID, spec_id, map_entry.size, FormatHandle(module_state.handle()).c_str(),
-                                     spec_const_size);
-                }
 
-                if ((map_entry.offset + map_entry.size) <= specialization_info->dataSize) {
-                    // Allocate enough room for ceil(map_entry.size / 4) to store entries
-                    std::vector<uint32_t> entry_data((map_entry.size + 4 - 1) / 4, 0);
-                    uint8_t *out_p = reinterpret_cast<uint8_t *>(entry_data.data());
-                    const uint8_t *const start_in_p = specialization_data + map_entry.offset;
-                    const uint8_t *const end_in_p = start_in_p + map_entry.size;
+                    if ((map_entry.offset + map_entry.size) <= specialization_info->dataSize) {
+                        // Allocate enough room for ceil(map_entry.size / 4) to store entries
+                        std::vector<uint32_t> entry_data((map_entry.size + 4 - 1) / 4, 0);
+                        uint8_t *out_p = reinterpret_cast<uint8_t *>(entry_data.data());
+                        const uint8_t *const start_in_p = specialization_data + map_entry.offset;
+                        const uint8_t *const end_in_p = start_in_p + map_entry.size;
 
-                    std::copy(start_in_p, end_in_p, out_p);
-                    id_value_map.emplace(map_entry.constantID, std::move(entry_data));
+                        std::copy(start_in_p, end_in_p, out_p);
+                        id_value_map.emplace(map_entry.constantID, std::move(entry_data));
+                    }
                 }
-            }
-
-            // This pass takes the runtime spec const values and applies it into the SPIR-V
-            // will turn a spec constant like
-            //     OpSpecConstant %uint 1
-            // to a use the value passed in instead (for example if the value is 32) so now it looks like
-            //     OpSpecConstant %uint 32
-            optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
-        }
 
-        // This pass will turn OpSpecConstant into a OpConstant (also OpSpecConstantTrue/OpSpecConstantFalse)
-        optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
-        // Using the new frozen OpConstant all OpSpecConstantComposite can be resolved turning them into OpConstantComposite
-        // This is need incase a shdaer looks like:
-        //
-        //     layout(constant_id = 0) const uint x = 64;
-        //     shared uint arr[x > 64 ? 64 : x];
-        //
-        // this will generate branch/switch statements that we want to leverage spirv-opt to apply to make parsing easier
-        optimizer.RegisterPass(spvtools::CreateFoldSpecConstantOpAndCompositePass());
-
-        // Apply the specialization-constant values and revalidate the shader module is valid.
-        std::vector<uint32_t> specialized_spirv;
-        auto const optimized =
-            optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, options, true);
-        if (optimized) {
-            spv_context ctx = spvContextCreate(spirv_environment);
-            spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
-            spv_diagnostic diag = nullptr;
-            auto const spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
-            if (spv_valid != SPV_SUCCESS) {
-                const char *vuid = stage_create_info.pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
-                                                              : "VUID-VkShaderCreateInfoEXT-pCode-08460";
-                std::string name = stage_create_info.pipeline ? FormatHandle(module_state.handle()) : "shader object";
-                skip |= LogError(vuid, device, loc,
-                                 "After specialization was applied, %s produces a spirv-val error (stage %s):\n%s", name.c_str(),
-                                 string_VkShaderStageFlagBits(stage), diag && diag->error ? diag->error : "(no error text)");
+                // This pass takes the runtime spec const values and applies it into the SPIR-V
+                // will turn a spec constant like
+                //     OpSpecConstant %uint 1
+                // to a use the value passed in instead (for example if the value is 32) so now it looks like
+                //     OpSpecConstant %uint 32
+                optimizer.RegisterPass(spvtools::CreateSetSpecConstantDefaultValuePass(id_value_map));
             }
 
-            // The new optimized SPIR-V will NOT match the original spirv::Module object parsing, so a new spirv::Module
-            // object is needed. This an issue due to each pipeline being able to reuse the same shader module but with different
-            // spec constant values.
-            spirv::Module spec_mod(vvl::make_span<const uint32_t>(specialized_spirv.data(), specialized_spirv.size()));
+            // This pass will turn OpSpecConstant into a OpConstant (also OpSpecConstantTrue/OpSpecConstantFalse)
+            optimizer.RegisterPass(spvtools::CreateFreezeSpecConstantValuePass());
+            // Using the new frozen OpConstant all OpSpecConstantComposite can be resolved turning them into OpConstantComposite
+            // This is need incase a shdaer looks like:
+            //
+            //     layout(constant_id = 0) const uint x = 64;
+            //     shared uint arr[x > 64 ? 64 : x];
+            //
+            // this will generate branch/switch statements that we want to leverage spirv-opt to apply to make parsing easier
+            optimizer.RegisterPass(spvtools::CreateFoldSpecConstantOpAndCompositePass());
+
+            // Apply the specialization-constant values and revalidate the shader module is valid.
+            std::vector<uint32_t> specialized_spirv;
+            auto const optimized =
+                optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, spirv_val_options, true);
+            if (optimized) {
+                spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
+                spv_diagnostic diag = nullptr;
+                auto const spv_valid = spvValidateWithOptions(spirv_val_context, spirv_val_options, &binary, &diag);
+                if (spv_valid != SPV_SUCCESS) {
+                    const char *vuid = stage_create_info.pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
+                                                                  : "VUID-VkShaderCreateInfoEXT-pCode-08460";
+                    std::string name = stage_create_info.pipeline ? FormatHandle(module_state.handle()) : "shader object";
+                    spec_skip |= LogError(vuid, device, loc,
+                                          "After specialization was applied, %s produces a spirv-val error (stage %s):\n%s",
+                                          name.c_str(), string_VkShaderStageFlagBits(stage),
+                                          diag && diag->error ? diag->error : "(no error text)");
+                }
 
-            // According to https://github.com/KhronosGroup/Vulkan-Docs/issues/1671 anything labeled as "static use" (such as if an
-            // input is used or not) don't have to be checked post spec constants freezing since the device compiler is not
-            // guaranteed to run things such as dead-code elimination. The following checks are things that don't follow under
-            // "static use" rules and need to be validated still.
+                // The new optimized SPIR-V will NOT match the original spirv::Module object parsing, so a new spirv::Module
+                // object is needed. This an issue due to each pipeline being able to reuse the same shader module but with
+                // different spec constant values.
+                spirv::Module spec_mod(vvl::make_span<const uint32_t>(specialized_spirv.data(), specialized_spirv.size()));
 
-            const auto spec_entrypoint = spec_mod.FindEntrypoint(entrypoint.name.c_str(), entrypoint.stage);
-            assert(spec_entrypoint);  // spirv-opt won't change Entrypoint Name/stage
+                // According to https://github.com/KhronosGroup/Vulkan-Docs/issues/1671 anything labeled as "static use" (such as if
+                // an input is used or not) don't have to be checked post spec constants freezing since the device compiler is not
+                // guaranteed to run things such as dead-code elimination. The following checks are things that don't follow
+                // under "static use" rules and need to be validated still.
 
-            spec_mod.FindLocalSize(*spec_entrypoint, local_size_x, local_size_y, local_size_z);
+                const auto spec_entrypoint = spec_mod.FindEntrypoint(entrypoint.name.c_str(), entrypoint.stage);
+                assert(spec_entrypoint);  // spirv-opt won't change Entrypoint Name/stage
 
-            total_workgroup_shared_memory = spec_mod.CalculateWorkgroupSharedMemory();
+                spec_mod.FindLocalSize(*spec_entrypoint, local_size_x, local_size_y, local_size_z);
 
-            spvDiagnosticDestroy(diag);
-            spvContextDestroy(ctx);
-        } else {
-            // Should never get here, but better then asserting
-            const char *vuid = stage_create_info.pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
-                                                          : "VUID-VkShaderCreateInfoEXT-pCode-08460";
-            skip |= LogError(vuid, device, loc,
-                             "%s shader (stage %s) attempted to apply specialization constants with spirv-opt but failed.",
-                             FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage));
-        }
+                total_workgroup_shared_memory = spec_mod.CalculateWorkgroupSharedMemory();
+
+                spvDiagnosticDestroy(diag);
+            } else {
+                // Should never get here, but better then asserting
+                const char *vuid = stage_create_info.pipeline ? "VUID-VkPipelineShaderStageCreateInfo-pSpecializationInfo-06849"
+                                                              : "VUID-VkShaderCreateInfoEXT-pCode-08460";
+                spec_skip |= LogError(vuid, device, loc,
+                                      "%s shader (stage %s) attempted to apply specialization constants with spirv-opt but failed.",
+                                      FormatHandle(module_state.handle()).c_str(), string_VkShaderStageFlagBits(stage));
+            }
+            return spec_skip;
+        });
 
         if (skip) {
             return skip;  // if spec constants have errors, can produce false positives later
         }
+        if (specialization_cache && specialization_clean) {
+            specialization_cache->InsertSpecialization(
+                specialization_key, {local_size_x, local_size_y, local_size_z, total_workgroup_shared_memory});
+        }
     }
 
     // Validate descriptor set layout against what the entrypoint actually uses
@@ -2407,15 +2445,12 @@ void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createI
 }
 
 bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &loc) const {
+    auto check_scope = ProfileCheck(vvl::ValidationCheck::RunSpirvValidation);
     bool skip = false;
     // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
     // the default values will be used during validation.
-    spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
-    spv_context ctx = spvContextCreate(spirv_environment);
     spv_diagnostic diag = nullptr;
-    spvtools::ValidatorOptions options;
-    AdjustValidatorOptions(device_extensions, enabled_features, options);
-    const spv_result_t spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
+    const spv_result_t spv_valid = spvValidateWithOptions(spirv_val_context, spirv_val_options, &binary, &diag);
     if (spv_valid != SPV_SUCCESS) {
         const char *vuid = loc.function == Func::vkCreateShaderModule ? "VUID-VkShaderModuleCreateInfo-pCode-08737"
                                                                       : "VUID-VkShaderCreateInfoEXT-pCode-08737";
@@ -2429,7 +2464,6 @@ bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &
     }
 
     spvDiagnosticDestroy(diag);
-    spvContextDestroy(ctx);
 
     return skip;
 }
@@ -2458,15 +2492,18 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
     if (skip) {
         return skip;  // if pCode is garbage, don't pass along to spirv-val
     }
+    if (spirv_val_queue) {
+        return skip;  // spirv-val is started by PostCallRecordCreateShaderModule
+    }
 
     ValidationCache *cache = GetValidationCacheInfo(pCreateInfo);
-    uint32_t hash = 0;
+    uint64_t hash = 0;
     // If app isn't using a shader validation cache, use the default one from CoreChecks
     if (!cache) {
         cache = CastFromHandle<ValidationCache *>(core_validation_cache);
     }
     if (cache) {
-        hash = hash_util::ShaderHash(pCreateInfo->pCode, pCreateInfo->codeSize);
+        hash = hash_util::Hash64(pCreateInfo->pCode, pCreateInfo->codeSize);
         if (cache->Contains(hash)) {
             return false;
         }
@@ -2481,6 +2518,73 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
     return skip;
 }
 
+void CoreChecks::PostCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
+                                                  const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
+                                                  const RecordObject &record_obj, void *csm_state_data) {
+    StateTracker::PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, csm_state_data);
+    if (!spirv_val_queue || VK_SUCCESS != record_obj.result || pCreateInfo->pCode[0] != spv::MagicNumber) {
+        return;
+    }
+
+    ValidationCache *cache = GetValidationCacheInfo(pCreateInfo);
+    if (!cache) {
+        cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+    }
+    const uint64_t hash = hash_util::Hash64(pCreateInfo->pCode, pCreateInfo->codeSize);
+    if (cache && cache->Contains(hash)) {
+        return;
+    }
+
+    // The application may destroy its own cache before spirv-val is done, so only the one of CoreChecks is filled.
+    // The code is copied because the module state may hold the flattened code instead of the one the application passed.
+    ValidationCache *result_cache = CastFromHandle<ValidationCache *>(core_validation_cache);
+    std::vector<uint32_t> code(pCreateInfo->pCode, pCreateInfo->pCode + pCreateInfo->codeSize / sizeof(uint32_t));
+    auto task = std::make_shared<std::packaged_task<SpirvValidationResult()>>(
+        [this, code = std::move(code), result_cache, hash]() {
+            SpirvValidationResult result;
+            spv_const_binary_t binary{code.data(), code.size()};
+            spv_diagnostic diag = nullptr;
+            result.result = spvValidateWithOptions(spirv_val_context, spirv_val_options, &binary, &diag);
+            if (result.result != SPV_SUCCESS) {
+                result.message = diag && diag->error ? diag->error : "(no error text)";
+            } else if (result_cache) {
+                result_cache->Insert(hash);
+            }
+            spvDiagnosticDestroy(diag);
+            return result;
+        });
+    pending_spirv_validation.insert(*pShaderModule, task->get_future().share());
+    spirv_val_queue->Push([task]() { (*task)(); });
+}
+
+void CoreChecks::PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
+                                                  const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
+    // Not used by any pipeline, the result still has to be reported once
+    ReportPendingSpirvValidation(shaderModule, record_obj.location);
+    StateTracker::PreCallRecordDestroyShaderModule(device, shaderModule, pAllocator, record_obj);
+}
+
+// Waits for the background spirv-val of the module if it was not reported yet
+bool CoreChecks::ReportPendingSpirvValidation(VkShaderModule shader_module, const Location &loc) const {
+    bool skip = false;
+    auto pending = pending_spirv_validation.pop(shader_module);
+    if (pending == pending_spirv_validation.end()) {
+        return skip;
+    }
+
+    const SpirvValidationResult &result = pending->second.get();
+    if (result.result == SPV_WARNING) {
+        skip |= LogWarning("VUID-VkShaderModuleCreateInfo-pCode-08737", shader_module, loc,
+                           "(spirv-val produced a warning when %s was created):\n%s", FormatHandle(shader_module).c_str(),
+                           result.message.c_str());
+    } else if (result.result != SPV_SUCCESS) {
+        skip |= LogError("VUID-VkShaderModuleCreateInfo-pCode-08737", shader_module, loc,
+                         "(spirv-val produced an error when %s was created):\n%s", FormatHandle(shader_module).c_str(),
+                         result.message.c_str());
+    }
+    return skip;
+}
+
 bool CoreChecks::PreCallValidateGetShaderModuleIdentifierEXT(VkDevice device, VkShaderModule shaderModule,
                                                              VkShaderModuleIdentifierEXT *pIdentifier,
                                                              const ErrorObject &error_obj) const {
@@ -1420,14 +1420,15 @@ bool CoreChecks::ValidateSubpassDependency(const ErrorObject &error_obj, const L
         converted_barrier.srcAccessMask = dependency.srcAccessMask;
         converted_barrier.dstAccessMask = dependency.dstAccessMask;
     }
+    const LogObjectList objlist(error_obj.handle);
     auto src_queue_flags = SubpassToQueueFlags(dependency.srcSubpass);
-    skip |= ValidatePipelineStage(error_obj.objlist, loc.dot(Field::srcStageMask), src_queue_flags, converted_barrier.srcStageMask);
-    skip |= ValidateAccessMask(error_obj.objlist, loc.dot(Field::srcAccessMask), loc.dot(Field::srcStageMask), src_queue_flags,
+    skip |= ValidatePipelineStage(objlist, loc.dot(Field::srcStageMask), src_queue_flags, converted_barrier.srcStageMask);
+    skip |= ValidateAccessMask(objlist, loc.dot(Field::srcAccessMask), loc.dot(Field::srcStageMask), src_queue_flags,
                                converted_barrier.srcAccessMask, converted_barrier.srcStageMask);
 
     auto dst_queue_flags = SubpassToQueueFlags(dependency.dstSubpass);
-    skip |= ValidatePipelineStage(error_obj.objlist, loc.dot(Field::dstStageMask), dst_queue_flags, converted_barrier.dstStageMask);
-    skip |= ValidateAccessMask(error_obj.objlist, loc.dot(Field::dstAccessMask), loc.dot(Field::dstStageMask), dst_queue_flags,
+    skip |= ValidatePipelineStage(objlist, loc.dot(Field::dstStageMask), dst_queue_flags, converted_barrier.dstStageMask);
+    skip |= ValidateAccessMask(objlist, loc.dot(Field::dstAccessMask), loc.dot(Field::dstStageMask), dst_queue_flags,
                                converted_barrier.dstAccessMask, converted_barrier.dstStageMask);
     return skip;
 }
@@ -1769,14 +1770,9 @@ void CoreChecks::RecordBarrierValidationInfo(const Location &loc, vvl::CommandBu
         auto handle_state = barrier.GetResourceState(*this);
         const bool mode_concurrent = handle_state && handle_state->createInfo.sharingMode == VK_SHARING_MODE_CONCURRENT;
         if (!mode_concurrent) {
-            const auto typed_handle = barrier.GetTypedHandle();
-            vvl::LocationCapture loc_capture(loc);
-            cb_state->queue_submit_functions.emplace_back(
-                [loc_capture, typed_handle, src_queue_family, dst_queue_family](
-                    const ValidationStateTracker &device_data, const vvl::Queue &queue_state, const vvl::CommandBuffer &cb_state) {
-                    return ValidateConcurrentBarrierAtSubmit(loc_capture.Get(), device_data, queue_state, cb_state, typed_handle,
-                                                             src_queue_family, dst_queue_family);
-                });
+            auto &core_cb_state = static_cast<CORE_CMD_BUFFER_STATE &>(*cb_state);
+            core_cb_state.submit_time_checks.emplace_back(
+                ConcurrentBarrierCheck{vvl::LocationCapture(loc), barrier.GetTypedHandle(), src_queue_family, dst_queue_family});
         }
     }
 }
@@ -2216,6 +2212,7 @@ bool CoreChecks::ValidateBufferBarrier(const LogObjectList &objects, const Locat
 
 bool CoreChecks::ValidateImageBarrier(const LogObjectList &objects, const Location &barrier_loc, const vvl::CommandBuffer *cb_state,
                                       const ImageBarrier &mem_barrier) const {
+    auto check_scope = ProfileCheck(vvl::ValidationCheck::ValidateImageBarrier);
     bool skip = false;
 
     skip |= ValidateQFOTransferBarrierUniqueness(barrier_loc, cb_state, mem_barrier, cb_state->qfo_transfer_image_barriers);
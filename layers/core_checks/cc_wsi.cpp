@@ -657,8 +657,8 @@ bool CoreChecks::ValidateCreateSwapchain(VkSwapchainCreateInfoKHR const *pCreate
 
     const VkImageCreateInfo image_create_info = GetSwapchainImpliedImageCreateInfo(pCreateInfo);
     VkImageFormatProperties image_properties = {};
-    const VkResult image_properties_result = DispatchGetPhysicalDeviceImageFormatProperties(
-        physical_device, image_create_info.format, image_create_info.imageType, image_create_info.tiling, image_create_info.usage,
+    const VkResult image_properties_result = physical_device_state->GetImageFormatProperties(
+        image_create_info.format, image_create_info.imageType, image_create_info.tiling, image_create_info.usage,
         image_create_info.flags, &image_properties);
 
     if (image_properties_result != VK_SUCCESS) {
@@ -873,9 +873,9 @@ bool CoreChecks::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentIn
                 const auto *image_state = swapchain_data->images[pPresentInfo->pImageIndices[i]].image_state;
                 assert(image_state);
 
-                std::vector<VkImageLayout> layouts;
-                if (FindLayouts(*image_state, layouts)) {
-                    for (auto layout : layouts) {
+                if (const auto layouts = FindLayouts(*image_state)) {
+                    for (const auto &entry : layouts->map) {
+                        const VkImageLayout layout = entry.second;
                         if ((layout != VK_IMAGE_LAYOUT_PRESENT_SRC_KHR) &&
                             (!IsExtEnabled(device_extensions.vk_khr_shared_presentable_image) ||
                              (layout != VK_IMAGE_LAYOUT_SHARED_PRESENT_KHR))) {
@@ -911,9 +911,8 @@ bool CoreChecks::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentIn
             }
 
             // All physical devices and queue families are required to be able to present to any native window on Android
-            if (!instance_extensions.vk_khr_android_surface) {
-                auto surface_state = Get<vvl::Surface>(swapchain_data->createInfo.surface);
-                if (!surface_state->GetQueueSupport(physical_device, queue_state->queueFamilyIndex)) {
+            if (!instance_extensions.vk_khr_android_surface && swapchain_data->surface) {
+                if (!swapchain_data->surface->GetQueueSupport(physical_device, queue_state->queueFamilyIndex)) {
                     skip |= LogError("VUID-vkQueuePresentKHR-pSwapchains-01292", pPresentInfo->pSwapchains[i], swapchain_loc,
                                      "image on queue that cannot present to this surface.");
                 }
@@ -1165,18 +1164,19 @@ bool CoreChecks::ValidateAcquireNextImage(VkDevice device, VkSwapchainKHR swapch
         const uint32_t acquired_images = swapchain_data->acquired_images;
         const uint32_t swapchain_image_count = static_cast<uint32_t>(swapchain_data->images.size());
 
-        safe_VkSurfaceCapabilities2KHR surface_caps2{};
+        uint32_t min_image_count = 0;
         if (swapchain_data->surface) {
-            surface_caps2 = swapchain_data->surface->GetCapabilities(
-                IsExtEnabled(device_extensions.vk_khr_get_surface_capabilities2), physical_device, nullptr, loc, this);
+            min_image_count = swapchain_data->surface
+                                  ->GetSurfaceCapabilities(IsExtEnabled(device_extensions.vk_khr_get_surface_capabilities2),
+                                                           physical_device, loc, this)
+                                  .minImageCount;
         } else if (IsExtEnabled(instance_extensions.vk_google_surfaceless_query)) {
-            surface_caps2 = physical_device_state->surfaceless_query_state.capabilities;
+            min_image_count = physical_device_state->surfaceless_query_state.capabilities.surfaceCapabilities.minImageCount;
         }
-        auto min_image_count = surface_caps2.surfaceCapabilities.minImageCount;
         const VkSwapchainPresentModesCreateInfoEXT *present_modes_ci =
             vku::FindStructInPNextChain<VkSwapchainPresentModesCreateInfoEXT>(swapchain_data->createInfo.pNext);
-        if (present_modes_ci) {
-            auto surface_state = Get<vvl::Surface>(swapchain_data->createInfo.surface);
+        if (present_modes_ci && swapchain_data->surface) {
+            const auto &surface_state = swapchain_data->surface;
             // If a SwapchainPresentModesCreateInfo struct was included, min_image_count becomes the max of the
             // minImageCount values returned via VkSurfaceCapabilitiesKHR for each of the present modes in
             // SwapchainPresentModesCreateInfo
@@ -20,6 +20,9 @@
 
 #pragma once
 
+#include <future>
+#include <variant>
+
 #include "state_tracker/state_tracker.h"
 #include "state_tracker/image_layout_map.h"
 #include "gpu_validation/gpu_validation.h"
@@ -33,6 +36,7 @@
 #include "state_tracker/shader_object_state.h"
 #include "sync/sync_utils.h"
 #include "sync/sync_vuid_maps.h"
+#include "utils/worker_pool.h"
 
 struct ValidateBeginQueryVuids {
     const char* vuid_queue_feedback = kVUIDUndefined;
@@ -80,6 +84,27 @@ typedef vvl::unordered_map<const vvl::Image*, std::optional<GlobalImageLayoutRan
 // this to all happen completely while the state tracker is holding the lock.
 // Eventually we'll probably want to move all of the core state into this derived
 // class.
+
+// Checks that need the queue a command buffer is submitted to, recorded as plain data and run for each submission.
+// Ownership transfer barrier of a resource without concurrent sharing
+struct ConcurrentBarrierCheck {
+    vvl::LocationCapture loc;
+    VulkanTypedHandle typed_handle;
+    uint32_t src_queue_family;
+    uint32_t dst_queue_family;
+};
+// Copy between sparse buffers, whose regions can only be known to overlap in memory once the buffers are bound
+struct CopyBufferOverlapCheck {
+    vvl::LocationCapture loc;
+    const char* vuid;
+    VkCommandBuffer command_buffer;  // the one recording the copy, which can be a secondary
+    std::shared_ptr<const vvl::Buffer> src_buffer;
+    std::shared_ptr<const vvl::Buffer> dst_buffer;
+    std::vector<sparse_container::range<VkDeviceSize>> src_ranges;
+    std::vector<sparse_container::range<VkDeviceSize>> dst_ranges;
+};
+using SubmitTimeCheck = std::variant<ConcurrentBarrierCheck, CopyBufferOverlapCheck>;
+
 class CORE_CMD_BUFFER_STATE : public vvl::CommandBuffer {
   public:
     CORE_CMD_BUFFER_STATE(ValidationStateTracker* dev_data, VkCommandBuffer cb, const VkCommandBufferAllocateInfo* pCreateInfo,
@@ -88,6 +113,51 @@ class CORE_CMD_BUFFER_STATE : public vvl::CommandBuffer {
 
     void RecordWaitEvents(vvl::Func command, uint32_t eventCount, const VkEvent* pEvents,
                           VkPipelineStageFlags2KHR src_stage_mask) override;
+    void End(VkResult result) override;
+    void ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_command_buffers) override;
+    void Reset() override;
+    void CollectMemoryFootprint(vvl::MemoryFootprint& footprint) const override;
+
+    // Run at primary command buffer queue submit time, in recording order, the ones of the executed secondaries included
+    std::vector<SubmitTimeCheck> submit_time_checks;
+
+    // What lets ValidateCmdBufImageLayouts skip an image of image_layout_map when the command buffer is submitted again
+    struct ImageLayoutSubmitState {
+        // The command buffer leaves every subresource it expects in a layout in that layout, so validating it against the
+        // layouts of an error free submit of itself can't find a mismatch. Set by End().
+        bool reentrant = false;
+        // The last validation found no error, against the global layouts alone (no earlier command buffer of that submit
+        // used the image)
+        bool validated = false;
+        // Generation of the global layouts the last validation saw, the update only trusts validated if it is still current
+        uint64_t validated_generation = 0;
+        // Generation of the global layouts once the last validated submit updated them, 0 if there is none
+        uint64_t global_generation = 0;
+    };
+    // Filled at End(), then updated at each submit; the command buffer is only read locked at validation time
+    mutable std::mutex image_layout_submit_lock;
+    mutable vvl::unordered_map<VkImage, ImageLayoutSubmitState> image_layout_submits;
+    // The images of image_layout_map with a subresource expected in a layout other than UNDEFINED, the only ones
+    // vkCmdExecuteCommands checks against the layouts of the primary. Filled at End().
+    std::vector<VkImage> initial_layout_images;
+};
+
+class CoreChecks;
+// Only differs from vvl::Queue when async_submit_validation is enabled, in which case the command buffer submit-time
+// checks (submit_time_checks) are run here on the queue thread when the submission retires, instead of in
+// PreCallValidateQueueSubmit. Errors are reported late, at the latest when the application waits on a fence, a semaphore
+// or for the queue/device to go idle.
+class CORE_QUEUE_STATE : public vvl::Queue {
+  public:
+    CORE_QUEUE_STATE(CoreChecks& core, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
+                     const VkQueueFamilyProperties& queueFamilyProperties);
+    ~CORE_QUEUE_STATE() { Destroy(); }
+
+  protected:
+    void Retire(vvl::QueueSubmission& submission) override;
+
+  private:
+    const CoreChecks& core_;
 };
 
 struct TimelineMaxDiffCheck {
@@ -112,11 +182,12 @@ struct SemaphoreSubmitState {
     // Before the first wait or signal no map entry for the semaphore is defined, which means that
     // semaphore's state is defined by the previous submissions on this queue or by the submissions on other queues.
     // After the first wait/signal the map starts tracking binary payload value: true - signaled, false - unsignaled.
-    vvl::unordered_map<VkSemaphore, bool> binary_signaling_state;
+    // Submits and presents rarely use more than a few semaphores, those are kept inline so that validating them doesn't allocate.
+    small_unordered_map<VkSemaphore, bool, 4> binary_signaling_state;
 
-    vvl::unordered_set<VkSemaphore> internal_semaphores;
-    vvl::unordered_map<VkSemaphore, uint64_t> timeline_signals;
-    vvl::unordered_map<VkSemaphore, uint64_t> timeline_waits;
+    small_unordered_set<VkSemaphore, 4> internal_semaphores;
+    small_unordered_map<VkSemaphore, uint64_t, 4> timeline_signals;
+    small_unordered_map<VkSemaphore, uint64_t, 4> timeline_waits;
 
     SemaphoreSubmitState(const CoreChecks* core_, VkQueue q_, VkQueueFlags queue_flags_)
         : core(core_), queue(q_), queue_flags(queue_flags_) {}
@@ -233,6 +304,72 @@ class CoreChecks : public ValidationStateTracker {
     GlobalQFOTransferBarrierMap<QFOBufferTransferBarrier> qfo_release_buffer_barrier_map;
     VkValidationCacheEXT core_validation_cache = VK_NULL_HANDLE;
     std::string validation_cache_path;
+    // Only depend on the device, so they are created with it. spirv-val only reads them, and copies the context before setting
+    // its diagnostic, so they can be shared by all threads.
+    spv_context spirv_val_context = nullptr;
+    spvtools::ValidatorOptions spirv_val_options;
+
+    // With async_shader_validation, spirv-val of the shader modules runs on spirv_val_queue. The result stays in
+    // pending_spirv_validation until it is reported, by the first pipeline using the module or when the module is destroyed.
+    struct SpirvValidationResult {
+        spv_result_t result = SPV_SUCCESS;
+        std::string message;
+    };
+    std::unique_ptr<vvl::TaskQueue> spirv_val_queue;
+    mutable vl_concurrent_unordered_map<VkShaderModule, std::shared_future<SpirvValidationResult>> pending_spirv_validation;
+
+    // Validates the pipelines of one vkCreateGraphicsPipelines call in parallel, see PreCallValidateCreateGraphicsPipelines
+    std::unique_ptr<vvl::WorkerPool> pipeline_workers;
+    // Content hashes of the pipeline state blocks whose self contained checks found nothing, see ValidatePipelineStateOnce
+    mutable vl_concurrent_unordered_map<uint64_t, bool> clean_pipeline_states;
+    // Producer and consumer entry point pairs, keyed by their EntryPoint::unique_id, whose interfaces matched without reporting
+    // anything. The ids are never reused, so an entry can't be hit by the entry points of a later shader module.
+    mutable vl_concurrent_unordered_map<uint64_t, bool> clean_stage_interfaces;
+
+    // The shader binding table regions that passed ValidateRaytracingShaderBindingTable, with the buffer that satisfied every
+    // check. The shared pointers keep the buffer states alive, but not the buffers themselves, so the entries are only valid
+    // for sbt_region_snapshot, during which none of the buffers was destroyed. They are dropped when a region is validated
+    // against a newer buffer address snapshot.
+    struct SbtRegionKey {
+        VkDeviceAddress address;
+        VkDeviceSize stride;
+        VkDeviceSize size;
+        bool operator==(const SbtRegionKey& rhs) const {
+            return address == rhs.address && stride == rhs.stride && size == rhs.size;
+        }
+        struct hash {
+            size_t operator()(const SbtRegionKey& key) const {
+                hash_util::HashCombiner hc;
+                hc << key.address << key.stride << key.size;
+                return hc.Value();
+            }
+        };
+    };
+    mutable std::shared_mutex sbt_region_lock;
+    mutable std::shared_ptr<const BufferAddressSnapshot> sbt_region_snapshot;
+    mutable vvl::unordered_map<SbtRegionKey, BUFFER_STATE_PTR, SbtRegionKey::hash> sbt_region_buffers;
+
+    // What vkGetPhysicalDeviceImageFormatProperties2 reports as combinedImageSamplerDescriptorCount for the images that have
+    // views with a YCbCr conversion, which only depends on the image and view parameters of the query
+    struct YcbcrImageFormatKey {
+        VkFormat format;
+        VkImageTiling tiling;
+        VkImageType type;
+        VkImageUsageFlags usage;
+        VkImageCreateFlags flags;
+        bool operator==(const YcbcrImageFormatKey& rhs) const {
+            return format == rhs.format && tiling == rhs.tiling && type == rhs.type && usage == rhs.usage && flags == rhs.flags;
+        }
+        struct hash {
+            size_t operator()(const YcbcrImageFormatKey& key) const {
+                hash_util::HashCombiner hc;
+                hc << key.format << key.tiling << key.type << key.usage << key.flags;
+                return hc.Value();
+            }
+        };
+    };
+    mutable vl_concurrent_unordered_map<YcbcrImageFormatKey, uint32_t, 2, YcbcrImageFormatKey::hash>
+        combined_image_sampler_descriptor_counts;
 
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
@@ -326,6 +463,8 @@ class CoreChecks : public ValidationStateTracker {
                                                   const vvl::Queue& queue_data, const vvl::CommandBuffer& cb_state,
                                                   const VulkanTypedHandle& typed_handle, uint32_t src_queue_family,
                                                   uint32_t dst_queue_family);
+    bool ValidateCopyBufferOverlapAtSubmit(const CopyBufferOverlapCheck& check) const;
+    bool ValidateSubmitTimeChecks(const vvl::Queue& queue_state, const vvl::CommandBuffer& cb_state) const;
     bool ValidateCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
                                     const ErrorObject& error_obj) const;
     bool ValidateDependencies(const vvl::Framebuffer& framebuffer_state, const vvl::RenderPass& render_pass_state,
@@ -387,10 +526,9 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateGraphicsPipelineBindPoint(const vvl::CommandBuffer* cb_state, const vvl::Pipeline& pipeline,
                                            const Location& loc) const;
     bool ValidatePipelineBindPoint(const vvl::CommandBuffer* cb_state, VkPipelineBindPoint bind_point, const Location& loc) const;
-    bool ValidateMemoryIsMapped(uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges,
-                                const ErrorObject& error_obj) const;
-    bool ValidateMappedMemoryRangeDeviceLimits(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges,
-                                               const ErrorObject& error_obj) const;
+    // The nonCoherentAtomSize limits and that each range is within the mapping of its memory
+    bool ValidateMappedMemoryRanges(uint32_t memory_range_count, const VkMappedMemoryRange* memory_ranges,
+                                    const ErrorObject& error_obj) const;
     bool ValidateSecondaryCommandBufferState(const vvl::CommandBuffer& cb_state, const vvl::CommandBuffer& sub_cb_state,
                                              const Location& cb_loc) const;
     bool ValidateInheritanceInfoFramebuffer(VkCommandBuffer primaryBuffer, const vvl::CommandBuffer& cb_state,
@@ -648,6 +786,11 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateShaderObjectDrawtimeState(const LastBound& last_bound_state, const Location& loc) const;
     bool ValidateShaderObjectGraphicsDrawtimeState(const LastBound& last_bound_state, const Location& loc) const;
     bool ValidateActionState(const vvl::CommandBuffer& cb_state, const VkPipelineBindPoint bind_point, const Location& loc) const;
+    bool ValidateActionStateUncached(const vvl::CommandBuffer& cb_state, const VkPipelineBindPoint bind_point,
+                                     const Location& loc) const;
+    bool ValidateActionStateDescriptors(const LastBound& last_bound_state, const VkPipelineBindPoint bind_point,
+                                        const Location& loc) const;
+    bool ValidateActionStatePushConstants(const LastBound& last_bound_state, const Location& loc) const;
     static bool ValidateWaitEventsAtSubmit(vvl::Func command, const vvl::CommandBuffer& cb_state, size_t eventCount,
                                            size_t firstEventIndex, VkPipelineStageFlags2 sourceStageMask,
                                            const EventToStageMap& local_event_signal_info, VkQueue waiting_queue,
@@ -662,9 +805,10 @@ class CoreChecks : public ValidationStateTracker {
     VkResult CoreLayerGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize,
                                                 void* pData) override;
     // For given bindings validate state at time of draw is correct, returning false on error and writing error details into string*
-    bool ValidateDrawState(const vvl::DescriptorSet& descriptor_set, const BindingVariableMap& bindings,
+    // If changed_since is set, only the bindings updated after that change count of the set are validated
+    bool ValidateDrawState(const vvl::DescriptorSet& descriptor_set, const BindingRequirementList& bindings,
                            const std::vector<uint32_t>& dynamic_offsets, const vvl::CommandBuffer& cb_state, const Location& loc,
-                           const vvl::DrawDispatchVuid& vuids) const;
+                           const vvl::DrawDispatchVuid& vuids, std::optional<uint64_t> changed_since = std::nullopt) const;
 
     bool VerifySetLayoutCompatibility(const vvl::DescriptorSetLayout& layout_dsl,
                                       const vvl::DescriptorSetLayout& bound_dsl, std::string& error_msg) const;
@@ -718,6 +862,10 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateGraphicsPipelineTessellationState(const vvl::Pipeline& pipeline, const Location& create_info_loc) const;
     bool ValidateGraphicsPipelineColorBlendState(const vvl::Pipeline& pipeline, const safe_VkSubpassDescription2* subpass_desc,
                                                  const Location& create_info_loc) const;
+    bool ValidateGraphicsPipelineColorBlendAttachments(const safe_VkPipelineColorBlendStateCreateInfo& color_blend_state,
+                                                       const std::vector<VkPipelineColorBlendAttachmentState>& attachments,
+                                                       const Location& color_loc) const;
+    bool ValidatePipelineStateOnce(uint64_t state_hash, const std::function<bool()>& validate) const;
     bool ValidateGraphicsPipelineRasterizationState(const vvl::Pipeline& pipeline, const safe_VkSubpassDescription2* subpass_desc,
                                                     const Location& create_info_loc) const;
     bool ValidateGraphicsPipelineMultisampleState(const vvl::Pipeline& pipeline, const safe_VkSubpassDescription2* subpass_desc,
@@ -749,6 +897,12 @@ class CoreChecks : public ValidationStateTracker {
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, void* csm_state_data) override;
     bool RunSpirvValidation(spv_const_binary_t& binary, const Location& loc) const;
+    bool ReportPendingSpirvValidation(VkShaderModule shader_module, const Location& loc) const;
+    void PostCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
+                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
+                                          const RecordObject& record_obj, void* csm_state_data) override;
+    void PreCallRecordDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator,
+                                          const RecordObject& record_obj) override;
     bool PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                            const ErrorObject& error_obj) const override;
@@ -806,6 +960,12 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateInterfaceBetweenStages(const spirv::Module& producer, const spirv::EntryPoint& producer_entrypoint,
                                         const spirv::Module& consumer, const spirv::EntryPoint& consumer_entrypoint,
                                         const Location& create_info_loc) const;
+    bool ValidateInterfaceSlotsBetweenStages(const spirv::Module& producer, const spirv::EntryPoint& producer_entrypoint,
+                                             const spirv::Module& consumer, const spirv::EntryPoint& consumer_entrypoint,
+                                             const Location& create_info_loc) const;
+    bool ValidateBuiltinBlocksBetweenStages(const spirv::Module& producer, const spirv::EntryPoint& producer_entrypoint,
+                                            const spirv::Module& consumer, const spirv::EntryPoint& consumer_entrypoint,
+                                            const Location& create_info_loc) const;
     bool ValidateFsOutputsAgainstRenderPass(const spirv::Module& module_state, const spirv::EntryPoint& entrypoint,
                                             const vvl::Pipeline& pipeline, uint32_t subpass_index,
                                             const Location& create_info_loc) const;
@@ -868,6 +1028,11 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateHostCopyCurrentLayout(VkDevice device, VkImageLayout expected_layout, const VkImageSubresourceRange& subres_range,
                                        uint32_t region, const vvl::Image& image_state, const Location& loc, const char* image_label,
                                        const char* vuid) const;
+    // Checks against an already taken layout snapshot, so multi region calls read the published layouts only once
+    bool ValidateHostCopyCurrentLayout(VkDevice device, VkImageLayout expected_layout, const VkImageSubresourceRange& subres_range,
+                                       uint32_t region, const vvl::Image& image_state,
+                                       const GlobalImageLayoutState::Version& global_layouts, const Location& loc,
+                                       const char* image_label, const char* vuid) const;
     bool ValidateHostCopyMultiplane(VkDevice device, VkImageCopy2 region, const vvl::Image& image_state, bool is_src,
                                     const Location& region_loc) const;
     bool ValidateBufferViewRange(const vvl::Buffer& buffer_state, const VkBufferViewCreateInfo* pCreateInfo,
@@ -949,7 +1114,8 @@ class CoreChecks : public ValidationStateTracker {
                                                 const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount,
                                                 const VkImageSubresourceRange* pRanges, const RecordObject& record_obj) override;
 
-    bool FindLayouts(const vvl::Image& image_state, std::vector<VkImageLayout>& layouts) const;
+    // The current layouts of the image, or nullptr if they can't be checked as a whole
+    GlobalImageLayoutState::Snapshot FindLayouts(const vvl::Image& image_state) const;
 
     bool VerifyFramebufferAndRenderPassLayouts(const vvl::CommandBuffer& cb_state, const VkRenderPassBeginInfo* pRenderPassBegin,
                                                const vvl::Framebuffer& framebuffer_state, const Location& rp_begin_loc) const;
@@ -1553,7 +1719,7 @@ class CoreChecks : public ValidationStateTracker {
                                      const VkAccelerationStructureBuildRangeInfoKHR* geometry_build_ranges,
                                      const Location& info_loc) const;
     bool ValidateAccelerationStructuresMemoryAlisasing(VkCommandBuffer commandBuffer, uint32_t infoCount,
-                                                       const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, uint32_t info_i,
+                                                       const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
                                                        const ErrorObject& error_obj) const;
     bool PreCallValidateCmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t infoCount,
                                                           const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
@@ -2500,6 +2666,7 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateDescriptorAddressInfoEXT(const VkDescriptorAddressInfoEXT* address_info, const Location& address_loc) const;
     bool ValidateGetDescriptorDataSize(const VkDescriptorGetInfoEXT& descriptor_info, const size_t data_size,
                                        const Location& descriptor_info_loc) const;
+    uint32_t GetCombinedImageSamplerDescriptorCount(const vvl::ImageView& image_view_state) const;
     bool PreCallValidateGetDescriptorEXT(VkDevice device, const VkDescriptorGetInfoEXT* pDescriptorInfo, size_t dataSize,
                                          void* pDescriptor, const ErrorObject& error_obj) const override;
     bool PreCallValidateGetCalibratedTimestampsEXT(VkDevice device, uint32_t timestampCount,
@@ -2557,4 +2724,8 @@ class CoreChecks : public ValidationStateTracker {
                                                              const vvl::CommandPool* pool) override {
         return std::static_pointer_cast<vvl::CommandBuffer>(std::make_shared<CORE_CMD_BUFFER_STATE>(this, cb, create_info, pool));
     }
+    std::shared_ptr<vvl::Queue> CreateQueue(VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
+                                            const VkQueueFamilyProperties& queueFamilyProperties) override {
+        return std::static_pointer_cast<vvl::Queue>(std::make_shared<CORE_QUEUE_STATE>(*this, q, index, flags, queueFamilyProperties));
+    }
 };  // Class CoreChecks
@@ -38,6 +38,8 @@ bool vvl::DescriptorValidator::ValidateDescriptors(const DescriptorBindingInfo &
 }
 
 bool vvl::DescriptorValidator::ValidateBinding(const DescriptorBindingInfo &binding_info, const vvl::DescriptorBinding &binding) const {
+    if (dev_state.IsCheckShed(vvl::CheckFamily::DescriptorValidation)) return false;
+    auto check_scope = dev_state.ProfileCheck(vvl::ValidationCheck::DescriptorValidateBinding);
     using DescriptorClass = vvl::DescriptorClass;
     bool skip = false;
     switch (binding.descriptor_class) {
@@ -71,7 +73,7 @@ bool vvl::DescriptorValidator::ValidateBinding(const DescriptorBindingInfo &bind
 
 template <typename T>
 bool vvl::DescriptorValidator::ValidateDescriptors(const DescriptorBindingInfo &binding_info, const T &binding,
-                                                    const std::vector<uint32_t> &indices) {
+                                                    vvl::span<const uint32_t> indices) const {
     bool skip = false;
     for (auto index : indices) {
         const auto &descriptor = binding.descriptors[index];
@@ -89,34 +91,57 @@ bool vvl::DescriptorValidator::ValidateDescriptors(const DescriptorBindingInfo &
 }
 
 bool vvl::DescriptorValidator::ValidateBinding(const DescriptorBindingInfo &binding_info, const std::vector<uint32_t> &indices) {
+    UpdateDrawState(binding_info.first, indices);
+    return ValidateBindingIndices(binding_info, indices);
+}
+
+void vvl::DescriptorValidator::UpdateDrawState(uint32_t binding, vvl::span<const uint32_t> indices) {
     using DescriptorClass = vvl::DescriptorClass;
-    auto &binding = *descriptor_set.GetBinding(binding_info.first);
-    bool skip = false;
-    switch (binding.descriptor_class) {
-        case DescriptorClass::InlineUniform:
-            // Can't validate the descriptor because it may not have been updated.
-            break;
-        case DescriptorClass::GeneralBuffer:
-            skip = ValidateDescriptors(binding_info, static_cast<const vvl::BufferBinding &>(binding), indices);
-            break;
+    auto &binding_state = *descriptor_set.GetBinding(binding);
+    switch (binding_state.descriptor_class) {
         case DescriptorClass::ImageSampler: {
-            auto &imgs_binding = static_cast<vvl::ImageSamplerBinding &>(binding);
+            auto &imgs_binding = static_cast<vvl::ImageSamplerBinding &>(binding_state);
             for (auto index : indices) {
-                auto &descriptor = imgs_binding.descriptors[index];
-                descriptor.UpdateDrawState(&dev_state, &cb_state);
+                if (auto *descriptor = imgs_binding.descriptors.Find(index)) {
+                    descriptor->UpdateDrawState(&dev_state, &cb_state);
+                }
             }
-            skip = ValidateDescriptors(binding_info, imgs_binding, indices);
             break;
         }
         case DescriptorClass::Image: {
-            auto &img_binding = static_cast<vvl::ImageBinding &>(binding);
+            auto &img_binding = static_cast<vvl::ImageBinding &>(binding_state);
             for (auto index : indices) {
-                auto &descriptor = img_binding.descriptors[index];
-                descriptor.UpdateDrawState(&dev_state, &cb_state);
+                if (auto *descriptor = img_binding.descriptors.Find(index)) {
+                    descriptor->UpdateDrawState(&dev_state, &cb_state);
+                }
             }
-            skip = ValidateDescriptors(binding_info, img_binding, indices);
             break;
         }
+        default:
+            break;
+    }
+}
+
+bool vvl::DescriptorValidator::ValidateBindingIndices(const DescriptorBindingInfo &binding_info,
+                                                      vvl::span<const uint32_t> indices) const {
+    if (dev_state.IsCheckShed(vvl::CheckFamily::DescriptorValidation)) return false;
+    auto check_scope = dev_state.ProfileCheck(vvl::ValidationCheck::DescriptorValidateBinding);
+    using DescriptorClass = vvl::DescriptorClass;
+    const auto &binding = *descriptor_set.GetBinding(binding_info.first);
+    bool skip = false;
+    switch (binding.descriptor_class) {
+        case DescriptorClass::InlineUniform:
+            // Can't validate the descriptor because it may not have been updated.
+            break;
+        case DescriptorClass::GeneralBuffer:
+            skip = ValidateDescriptors(binding_info, static_cast<const vvl::BufferBinding &>(binding), indices);
+            break;
+        case DescriptorClass::ImageSampler:
+            skip = ValidateDescriptors(binding_info, static_cast<const vvl::ImageSamplerBinding &>(binding), indices);
+            break;
+        case DescriptorClass::Image:
+            skip = ValidateDescriptors(binding_info, static_cast<const vvl::ImageBinding &>(binding), indices);
+            break;
         case DescriptorClass::PlainSampler:
             skip = ValidateDescriptors(binding_info, static_cast<const vvl::SamplerBinding &>(binding), indices);
             break;
@@ -381,7 +406,7 @@ bool vvl::DescriptorValidator::ValidateDescriptor(const DescriptorBindingInfo &b
         }
     }
 
-    if (!dev_state.disabled[image_layout_validation]) {
+    if (!dev_state.disabled[image_layout_validation] && !dev_state.IsCheckShed(vvl::CheckFamily::ImageLayoutValidation)) {
         VkImageLayout image_layout = image_descriptor.GetImageLayout();
         // Verify Image Layout
         // No "invalid layout" VUID required for this call, since the optimal_layout parameter is UNDEFINED.
@@ -23,7 +23,8 @@
 #include "drawdispatch/drawdispatch_vuids.h"
 
 namespace vvl {
-using DescriptorBindingInfo = std::pair<uint32_t, std::vector<DescriptorRequirement>>;
+// Same as the entries of BindingRequirementList, so the ones built at pipeline creation are validated as is
+using DescriptorBindingInfo = BindingRequirementList::value_type;
 
 class DescriptorValidator {
  public:
@@ -39,12 +40,18 @@ class DescriptorValidator {
     bool ValidateBinding(const DescriptorBindingInfo& binding_info, const vvl::DescriptorBinding& binding) const;
     bool ValidateBinding(const DescriptorBindingInfo& binding_info, const std::vector<uint32_t> &indices);
 
+    // The two halves of ValidateBinding(binding_info, indices). UpdateDrawState records in the command buffer the image
+    // layouts the descriptors are used with and must be done first, ValidateBindingIndices only reads the state so different
+    // chunks of the indices can be validated on different threads.
+    void UpdateDrawState(uint32_t binding, vvl::span<const uint32_t> indices);
+    bool ValidateBindingIndices(const DescriptorBindingInfo& binding_info, vvl::span<const uint32_t> indices) const;
+
  private:
     template <typename T>
     bool ValidateDescriptors(const DescriptorBindingInfo& binding_info, const T& binding) const;
 
     template <typename T>
-    bool ValidateDescriptors(const DescriptorBindingInfo& binding_info, const T& binding, const std::vector<uint32_t>& indices);
+    bool ValidateDescriptors(const DescriptorBindingInfo& binding_info, const T& binding, vvl::span<const uint32_t> indices) const;
 
 
     bool ValidateDescriptor(const DescriptorBindingInfo& binding_info, uint32_t index,
@@ -0,0 +1,194 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "error_message/binary_log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "error_message/error_location.h"
+#include "error_message/logging.h"
+#include "utils/hash_util.h"
+
+static_assert(sizeof(BinaryMessageLog::FileHeader) == 24, "The binary log layout is shared with render_binary_log.py");
+static_assert(sizeof(BinaryMessageLog::RecordHeader) == 32, "The binary log layout is shared with render_binary_log.py");
+static_assert(sizeof(BinaryMessageLog::ObjectEntry) == 16, "The binary log layout is shared with render_binary_log.py");
+static_assert(sizeof(BinaryMessageLog::LocationEntry) == 8, "The binary log layout is shared with render_binary_log.py");
+
+static uint64_t SteadyNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t ThreadId() {
+    static std::atomic<uint32_t> next_thread_id{1};
+    thread_local const uint32_t thread_id = next_thread_id.fetch_add(1, std::memory_order_relaxed);
+    return thread_id;
+}
+
+template <typename T>
+static void AppendBytes(std::vector<uint8_t> &out, const T &value) {
+    const size_t offset = out.size();
+    out.resize(offset + sizeof(T));
+    std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+void BinaryMessageLog::Encode(VkFlags msg_flags, std::string_view vuid, const Location *loc, const LogObjectList &objects,
+                              std::vector<uint8_t> &out) const {
+    const size_t start = out.size();
+    const uint16_t vuid_length = static_cast<uint16_t>(std::min<size_t>(vuid.size(), UINT16_MAX));
+
+    uint16_t location_count = 0;
+    for (const Location *current = loc; current; current = current->prev) {
+        location_count++;
+    }
+
+    RecordHeader header{};
+    header.msg_flags = msg_flags;
+    header.vuid_hash = vuid.empty() ? 0 : hash_util::VuidHash(vuid);
+    header.thread_id = ThreadId();
+    header.timestamp = SteadyNanoseconds() - start_time_;
+    header.function = loc ? static_cast<uint16_t>(loc->function) : 0;
+    header.vuid_length = vuid_length;
+    header.object_count = static_cast<uint16_t>(objects.size());
+    header.location_count = location_count;
+    AppendBytes(out, header);
+
+    for (const VulkanTypedHandle &object : objects) {
+        ObjectEntry entry{};
+        entry.handle = object.handle;
+        entry.type = static_cast<uint32_t>(object.type);
+        AppendBytes(out, entry);
+    }
+
+    // The chain is walked from the innermost member, so the entries are filled in from the last one
+    const size_t locations_start = out.size();
+    out.resize(locations_start + location_count * sizeof(LocationEntry));
+    size_t offset = out.size();
+    for (const Location *current = loc; current; current = current->prev) {
+        LocationEntry entry{};
+        entry.structure = static_cast<uint16_t>(current->structure) | (current->isPNext ? kPNextBit : 0);
+        entry.field = static_cast<uint16_t>(current->field);
+        entry.index = current->index;
+        offset -= sizeof(LocationEntry);
+        std::memcpy(out.data() + offset, &entry, sizeof(entry));
+    }
+
+    out.insert(out.end(), vuid.begin(), vuid.begin() + vuid_length);
+    out.resize(start + ((out.size() - start + 7) & ~size_t(7)), 0);
+
+    const uint32_t size = static_cast<uint32_t>(out.size() - start);
+    std::memcpy(out.data() + start + offsetof(RecordHeader, size), &size, sizeof(size));
+}
+
+std::unique_ptr<BinaryMessageLog> BinaryMessageLog::Open(const char *filename) {
+    std::unique_ptr<BinaryMessageLog> log(new BinaryMessageLog());
+    log->start_time_ = SteadyNanoseconds();
+
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.format_version = kFormatVersion;
+    header.vk_header_version = VK_HEADER_VERSION_COMPLETE;
+    header.start_time =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+#if defined(_WIN32)
+    if (fopen_s(&log->file_, filename, "wb") != 0 || !log->file_) {
+        return nullptr;
+    }
+    fwrite(&header, sizeof(header), 1, log->file_);
+#else
+    log->fd_ = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (log->fd_ < 0 || !log->Reserve(sizeof(header))) {
+        return nullptr;
+    }
+    std::memcpy(log->mapping_, &header, sizeof(header));
+    log->used_ = sizeof(header);
+#endif
+    return log;
+}
+
+BinaryMessageLog::~BinaryMessageLog() {
+#if defined(_WIN32)
+    if (file_) {
+        fclose(file_);
+    }
+#else
+    if (mapping_) {
+        munmap(mapping_, mapped_size_);
+    }
+    if (fd_ >= 0) {
+        // Drop the unused end of the last chunk
+        [[maybe_unused]] const int result = ftruncate(fd_, static_cast<off_t>(used_));
+        close(fd_);
+    }
+#endif
+}
+
+#if !defined(_WIN32)
+// Grows the file and its mapping so that size more bytes fit after used_
+bool BinaryMessageLog::Reserve(size_t size) {
+    if (used_ + size <= mapped_size_) {
+        return true;
+    }
+    // Doubles up to 64 MiB chunks, the zeroes past used_ read as the end of the log
+    constexpr size_t kMinSize = 1 << 20;
+    constexpr size_t kMaxGrowth = 64 << 20;
+    size_t new_size = std::max(kMinSize, mapped_size_ + std::min(std::max(mapped_size_, size), kMaxGrowth));
+    while (new_size < used_ + size) {
+        new_size += kMaxGrowth;
+    }
+    if (mapping_) {
+        munmap(mapping_, mapped_size_);
+        mapping_ = nullptr;
+        mapped_size_ = 0;
+    }
+    if (ftruncate(fd_, static_cast<off_t>(new_size)) != 0) {
+        return false;
+    }
+    void *mapping = mmap(nullptr, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    mapping_ = static_cast<uint8_t *>(mapping);
+    mapped_size_ = new_size;
+    return true;
+}
+#endif
+
+void BinaryMessageLog::Write(const std::vector<uint8_t> &record) {
+    if (record.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(lock_);
+#if defined(_WIN32)
+    fwrite(record.data(), record.size(), 1, file_);
+#else
+    if (!Reserve(record.size())) {
+        return;
+    }
+    std::memcpy(mapping_ + used_, record.data(), record.size());
+    used_ += record.size();
+#endif
+}
@@ -0,0 +1,113 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+struct Location;
+struct LogObjectList;
+
+// With VK_DBG_LAYER_ACTION_LOG_BINARY, messages are written to binary_log_filename as fixed layout records instead of text.
+// Nothing is formatted: the record holds the enums of the Location chain and the objects, and
+// scripts/render_binary_log.py turns the file back into text offline. The message body of the check is not recorded.
+//
+// All values are in the byte order of the machine writing the log:
+//
+//   FileHeader
+//   repeated until a record size of 0 or the end of the file:
+//     RecordHeader
+//     ObjectEntry[object_count]
+//     LocationEntry[location_count], from the function parameter down to the member the message is about
+//     char vuid[vuid_length], not null terminated
+//     padding up to the next multiple of 8 bytes, which RecordHeader::size includes
+//
+// On POSIX systems the file is memory mapped and grown in chunks, so the records written before a crash are still there.
+class BinaryMessageLog {
+  public:
+    static constexpr char kMagic[8] = {'V', 'V', 'L', 'B', 'L', 'O', 'G', '\0'};
+    static constexpr uint32_t kFormatVersion = 1;
+
+    struct FileHeader {
+        char magic[8];
+        uint32_t format_version;
+        // The enums of error_location_helper.h are those of this header version
+        uint32_t vk_header_version;
+        // Nanoseconds since the epoch of the system clock when the log was opened, RecordHeader::timestamp is relative to it
+        uint64_t start_time;
+    };
+
+    struct RecordHeader {
+        uint32_t size;
+        uint32_t msg_flags;   // LogMessageTypeBits
+        uint32_t vuid_hash;   // MessageID of the text messages
+        uint32_t thread_id;   // 1 for the first thread that logged a message, 2 for the next one...
+        uint64_t timestamp;   // nanoseconds since FileHeader::start_time
+        uint16_t function;    // vvl::Func, 0 when the message has no Location
+        uint16_t vuid_length;
+        uint16_t object_count;
+        uint16_t location_count;
+    };
+
+    struct ObjectEntry {
+        uint64_t handle;
+        uint32_t type;  // VulkanObjectType
+        uint32_t reserved;
+    };
+
+    // The rendering tool applies the same rules as Location::AppendFields to join the entries
+    static constexpr uint16_t kPNextBit = 0x8000;
+    struct LocationEntry {
+        uint16_t structure;  // vvl::Struct, with kPNextBit set for a structure of a pNext chain
+        uint16_t field;      // vvl::Field
+        uint32_t index;      // Location::kNoIndex when not indexing an array
+    };
+
+    // nullptr if the file can't be created
+    static std::unique_ptr<BinaryMessageLog> Open(const char *filename);
+    BinaryMessageLog(const BinaryMessageLog &) = delete;
+    BinaryMessageLog &operator=(const BinaryMessageLog &) = delete;
+    ~BinaryMessageLog();
+
+    // Appends the record of a message to out, so that it can be built without holding any lock
+    void Encode(VkFlags msg_flags, std::string_view vuid, const Location *loc, const LogObjectList &objects,
+                std::vector<uint8_t> &out) const;
+    void Write(const std::vector<uint8_t> &record);
+
+  private:
+    BinaryMessageLog() = default;
+
+    std::mutex lock_;
+    uint64_t start_time_ = 0;  // steady clock
+#if defined(_WIN32)
+    FILE *file_ = nullptr;
+#else
+    bool Reserve(size_t size);
+
+    int fd_ = -1;
+    uint8_t *mapping_ = nullptr;
+    size_t mapped_size_ = 0;
+    size_t used_ = 0;
+#endif
+};
@@ -17,9 +17,10 @@
  */
 #include "error_location.h"
 #include "utils/vk_layer_utils.h"
+#include <charconv>
 #include <map>
 
-void Location::AppendFields(std::ostream& out) const {
+void Location::AppendFields(std::string& out) const {
     if (prev) {
         // When apply a .dot(sub_index) we duplicate the field item
         // Instead of dealing with partial non-const Location, just do the check here
@@ -30,36 +31,55 @@ void Location::AppendFields(std::ostream& out) const {
 
         // check if need connector from last item
         if (prev_loc.structure != vvl::Struct::Empty || prev_loc.field != vvl::Field::Empty) {
-            out << ((prev_loc.index == kNoIndex && IsFieldPointer(prev_loc.field)) ? "->" : ".");
+            out += (prev_loc.index == kNoIndex && IsFieldPointer(prev_loc.field)) ? "->" : ".";
         }
     }
     if (isPNext && structure != vvl::Struct::Empty) {
-        out << "pNext<" << vvl::String(structure) << (field != vvl::Field::Empty ? ">." : ">");
+        out += "pNext<";
+        out += vvl::String(structure);
+        out += (field != vvl::Field::Empty) ? ">." : ">";
     }
     if (field != vvl::Field::Empty) {
-        out << vvl::String(field);
+        out += vvl::String(field);
         if (index != kNoIndex) {
-            out << "[" << index << "]";
+            char digits[16];
+            const auto result = std::to_chars(digits, digits + sizeof(digits), index);
+            out += '[';
+            out.append(digits, result.ptr);
+            out += ']';
         }
     }
 }
 
+void Location::AppendMessage(std::string& out) const {
+    out += StringFunc();
+    out += "(): ";
+    AppendFields(out);
+}
+
 std::string Location::Fields() const {
-    std::stringstream out;
+    std::string out;
     AppendFields(out);
-    return out.str();
+    return out;
 }
 
 std::string Location::Message() const {
-    std::stringstream out;
-    out << StringFunc() << "(): ";
-    AppendFields(out);
-    return out.str();
+    std::string out;
+    AppendMessage(out);
+    return out;
 }
 
 namespace vvl {
 LocationCapture::LocationCapture(const Location& loc) { Capture(loc, 1); }
 
+LocationCapture& LocationCapture::operator=(const LocationCapture& other) {
+    if (this != &other) {
+        capture.clear();
+        Capture(other.Get(), 1);
+    }
+    return *this;
+}
+
 const Location* LocationCapture::Capture(const Location& loc, CaptureStore::size_type depth) {
     const Location* prev_capture = nullptr;
     if (loc.prev) {
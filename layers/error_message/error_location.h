@@ -47,7 +47,9 @@ struct Location {
     Location(const Location& prev_loc, vvl::Struct s, vvl::Field f, uint32_t i, bool p)
         : function(prev_loc.function), structure(s), field(f), index(i), isPNext(p), prev(&prev_loc) {}
 
-    void AppendFields(std::ostream &out) const;
+    // The Append versions add to out, so that a message can be built in a buffer reused from one message to the next
+    void AppendFields(std::string &out) const;
+    void AppendMessage(std::string &out) const;
     std::string Fields() const;
     std::string Message() const;
 
@@ -79,11 +81,13 @@ struct Location {
 
 // Contains the base information needed for errors to be logged out
 // Created for each function as a starting point to build off of
+//
+// This is built on the stack for every API call, so it only holds trivially copyable data. A LogObjectList for the
+// dispatchable handle is only created when something is actually logged (LogError(..., error_obj.handle, ...)).
 struct ErrorObject {
     const Location location;   // starting location (Always the function entrypoint)
     const VulkanTypedHandle handle;  // dispatchable handle is always first parameter of the function call
-    const LogObjectList objlist;
-    ErrorObject(vvl::Func command_, VulkanTypedHandle handle_) : location(Location(command_)), handle(handle_), objlist(handle) {}
+    ErrorObject(vvl::Func command_, VulkanTypedHandle handle_) : location(Location(command_)), handle(handle_) {}
 };
 
 namespace vvl {
@@ -107,6 +111,10 @@ struct LocationVuidAdapter {
 
 struct LocationCapture {
     LocationCapture(const Location& loc);
+    // The captured locations point to each other, so a copy has to capture them again.
+    // Also used instead of moving, as moving the inline storage would leave the pointers to the old one.
+    LocationCapture(const LocationCapture& other) : LocationCapture(other.Get()) {}
+    LocationCapture& operator=(const LocationCapture& other);
     const Location& Get() const { return capture.back(); }
 
   protected:
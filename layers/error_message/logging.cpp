@@ -16,8 +16,12 @@
  */
 #include "logging.h"
 
+#include <algorithm>
+#include <charconv>
+#include <chrono>
 #include <csignal>
 #include <cstring>
+#include <optional>
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 #include <debugapi.h>
 #endif
@@ -44,6 +48,30 @@ VKAPI_ATTR void SetDebugUtilsSeverityFlags(std::vector<VkLayerDbgFunctionState>
             debug_data->active_types |= types;
         }
     }
+    debug_data->UpdateEnabledMessageFlags();
+}
+
+void debug_report_data::UpdateEnabledMessageFlags() {
+    VkFlags enabled = 0;
+    for (VkFlags msg_flag : {kInformationBit, kWarningBit, kPerformanceWarningBit, kErrorBit, kVerboseBit}) {
+        VkDebugUtilsMessageSeverityFlagsEXT severity;
+        VkDebugUtilsMessageTypeFlagsEXT type;
+        DebugReportFlagsToAnnotFlags(msg_flag, &severity, &type);
+        const bool text = (active_severities.load(std::memory_order_relaxed) & severity) &&
+                          (active_types.load(std::memory_order_relaxed) & type);
+        const bool binary = binary_log && (binary_log_severities & severity) && (binary_log_types & type);
+        if (text || binary) {
+            enabled |= msg_flag;
+        }
+    }
+    enabled_message_flags.store(enabled, std::memory_order_relaxed);
+}
+
+bool debug_report_data::IsMessageEnabled(VkFlags msg_flags, uint32_t vuid_hash) const {
+    if (!IsMessageEnabled(msg_flags) || filter_message_ids.find(vuid_hash) != filter_message_ids.end()) {
+        return false;
+    }
+    return (duplicate_message_limit == 0) || (duplicate_message_counts.Count(vuid_hash) < duplicate_message_limit);
 }
 
 VKAPI_ATTR void RemoveDebugUtilsCallback(debug_report_data *debug_data, std::vector<VkLayerDbgFunctionState> &callbacks,
@@ -62,27 +90,306 @@ VKAPI_ATTR void RemoveDebugUtilsCallback(debug_report_data *debug_data, std::vec
     SetDebugUtilsSeverityFlags(callbacks, debug_data);
 }
 
-// Returns TRUE if the number of times this message has been logged is over the set limit
-static bool UpdateLogMsgCounts(const debug_report_data *debug_data, int32_t vuid_hash) {
-    auto vuid_count_it = debug_data->duplicate_message_count_map.find(vuid_hash);
-    if (vuid_count_it == debug_data->duplicate_message_count_map.end()) {
-        debug_data->duplicate_message_count_map.emplace(vuid_hash, 1);
-        return false;
-    } else {
-        if (vuid_count_it->second >= debug_data->duplicate_message_limit) {
-            return true;
-        } else {
-            vuid_count_it->second++;
+std::atomic<uint64_t> *MessageCounts::FindOrInsert(uint32_t message_id) {
+    // Message ids are hashes already
+    for (size_t i = 0; i < kSlotCount; i++) {
+        auto &slot = slots_[(message_id + i) & (kSlotCount - 1)];
+        uint64_t value = slot.load(std::memory_order_acquire);
+        if (value == 0 && slot.compare_exchange_strong(value, Pack(message_id, 0), std::memory_order_acq_rel)) {
+            return &slot;
+        }
+        // On a failed exchange value is what the other thread stored, possibly the same message id
+        if (UnpackMessageId(value) == message_id) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+bool MessageCounts::Increment(uint32_t message_id, uint32_t limit) {
+    // The count plus one has to fit in 32 bits
+    const uint32_t max_count = limit < UINT32_MAX ? limit : UINT32_MAX - 1;
+    std::atomic<uint64_t> *slot = FindOrInsert(message_id);
+    if (!slot) {
+        std::lock_guard<std::mutex> guard(overflow_lock_);
+        uint32_t &count = overflow_[message_id];
+        if (count >= max_count) {
+            return false;
+        }
+        count++;
+        return true;
+    }
+    uint64_t value = slot->load(std::memory_order_relaxed);
+    do {
+        if (UnpackCount(value) >= max_count) {
             return false;
         }
+    } while (!slot->compare_exchange_weak(value, value + 1, std::memory_order_relaxed));
+    return true;
+}
+
+uint32_t MessageCounts::Count(uint32_t message_id) const {
+    for (size_t i = 0; i < kSlotCount; i++) {
+        const uint64_t value = slots_[(message_id + i) & (kSlotCount - 1)].load(std::memory_order_acquire);
+        if (value == 0) {
+            return 0;
+        }
+        if (UnpackMessageId(value) == message_id) {
+            return UnpackCount(value);
+        }
     }
+    std::lock_guard<std::mutex> guard(overflow_lock_);
+    auto it = overflow_.find(message_id);
+    return it != overflow_.end() ? it->second : 0;
 }
 
-static bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
-                                 const char *layer_prefix, const char *message, const char *text_vuid) {
+static bool SameObjects(const LogObjectList &a, const LogObjectList &b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](const auto &lhs, const auto &rhs) {
+               return lhs.handle == rhs.handle && lhs.type == rhs.type;
+           });
+}
+
+bool MessageAggregator::Admit(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, uint32_t window_ms,
+                              uint32_t &aggregated) {
+    const uint32_t message_id = hash_util::VuidHash(vuid_text);
+    uint64_t key = message_id;
+    for (const VulkanTypedHandle &object : objects) {
+        key = (key ^ object.handle) * 0x9e3779b97f4a7c15ull;
+    }
+    const uint64_t now =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    Shard &shard = shards_[key >> (64 - kShardBits)];
+    std::lock_guard<std::mutex> lock(shard.lock);
+    auto iter = shard.entries.find(key);
+    if (iter == shard.entries.end()) {
+        shard.entries[key] = Entry{now, 0, message_id, msg_flags, std::string(vuid_text), objects};
+        aggregated = 0;
+        return true;
+    }
+    Entry &entry = iter->second;
+    // Another message with the same key is reported fully
+    if (entry.message_id != message_id || !SameObjects(entry.objects, objects)) {
+        aggregated = 0;
+        return true;
+    }
+    if (now - entry.window_start < static_cast<uint64_t>(window_ms) * 1000000) {
+        entry.count++;
+        return false;
+    }
+    aggregated = entry.count;
+    entry.window_start = now;
+    entry.count = 0;
+    return true;
+}
+
+std::vector<MessageAggregator::Summary> MessageAggregator::TakeSummaries() {
+    std::vector<Summary> summaries;
+    for (Shard &shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.lock);
+        for (auto &[key, entry] : shard.entries) {
+            if (entry.count > 0) {
+                summaries.push_back({entry.msg_flags, std::move(entry.vuid), std::move(entry.objects), entry.count});
+            }
+        }
+        shard.entries.clear();
+    }
+    return summaries;
+}
+
+void ObjectNameMap::Set(uint64_t handle, const char *name) {
+    Shard &shard = shards_[ShardIndex(handle)];
+    std::unique_lock<std::shared_mutex> lock(shard.lock);
+    if (name) {
+        auto result = shard.names.insert_or_assign(handle, name);
+        if (result.second) {
+            count_.fetch_add(1, std::memory_order_relaxed);
+        }
+    } else if (shard.names.erase(handle)) {
+        count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+std::string ObjectNameMap::Get(uint64_t handle) const {
+    std::string name;
+    Append(handle, name);
+    return name;
+}
+
+bool ObjectNameMap::Append(uint64_t handle, std::string &out) const {
+    if (count_.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    const Shard &shard = shards_[ShardIndex(handle)];
+    std::shared_lock<std::shared_mutex> lock(shard.lock);
+    const auto it = shard.names.find(handle);
+    if (it == shard.names.end()) {
+        return false;
+    }
+    out += it->second;
+    return true;
+}
+
+std::string debug_report_data::FormatHandle(const char *handle_type_name, uint64_t handle) const {
+    // Room for the type, the handle and a short name, so that usually nothing is reallocated
+    std::string str;
+    str.reserve(std::strlen(handle_type_name) + 64);
+    str += handle_type_name;
+    str += " 0x";
+    char hex[16];
+    const auto result = std::to_chars(hex, hex + sizeof(hex), handle, 16);
+    str.append(hex, result.ptr);
+    str += '[';
+    if (!debugUtilsObjectNameMap.Append(handle, str)) {
+        debugObjectNameMap.Append(handle, str);
+    }
+    str += ']';
+    return str;
+}
+
+static VkDebugUtilsMessengerCallbackDataEXT MakeCallbackData(const char *text_vuid, uint32_t message_id_number,
+                                                            std::vector<VkDebugUtilsLabelEXT> &queue_labels,
+                                                            std::vector<VkDebugUtilsLabelEXT> &cmd_buf_labels,
+                                                            std::vector<VkDebugUtilsObjectNameInfoEXT> &object_name_infos) {
+    VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
+    callback_data.flags = 0;
+    callback_data.pMessageIdName = text_vuid;
+    callback_data.messageIdNumber = vvl_bit_cast<int32_t>(message_id_number);
+    callback_data.pMessage = nullptr;
+    callback_data.queueLabelCount = static_cast<uint32_t>(queue_labels.size());
+    callback_data.pQueueLabels = queue_labels.empty() ? nullptr : queue_labels.data();
+    callback_data.cmdBufLabelCount = static_cast<uint32_t>(cmd_buf_labels.size());
+    callback_data.pCmdBufLabels = cmd_buf_labels.empty() ? nullptr : cmd_buf_labels.data();
+    callback_data.objectCount = static_cast<uint32_t>(object_name_infos.size());
+    callback_data.pObjects = object_name_infos.data();
+    return callback_data;
+}
+
+static bool InvokeCallbacks(const std::vector<VkLayerDbgFunctionState> &callback_list, bool force_default_callbacks,
+                            VkFlags msg_flags, VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT types,
+                            VkDebugUtilsMessengerCallbackDataEXT &callback_data,
+                            std::vector<VkDebugUtilsObjectNameInfoEXT> &object_name_infos, uint32_t message_id_number,
+                            const char *layer_prefix, const std::string &composite) {
     bool bail = false;
+    // We only output to default callbacks if there are no non-default callbacks
+    bool use_default_callbacks = true;
+    for (const auto &current_callback : callback_list) {
+        use_default_callbacks &= current_callback.IsDefault();
+    }
+    if (force_default_callbacks) {
+        use_default_callbacks = true;
+    }
+
+    for (const auto &current_callback : callback_list) {
+        // Skip callback if it's a default callback and there are non-default callbacks present
+        if (current_callback.IsDefault() && !use_default_callbacks) continue;
+
+        // VK_EXT_debug_utils callback
+        if (current_callback.IsUtils() && (current_callback.debug_utils_msg_flags & severity) &&
+            (current_callback.debug_utils_msg_type & types)) {
+            callback_data.pMessage = composite.c_str();
+            if (current_callback.debug_utils_callback_function_ptr(static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(severity),
+                                                                   types, &callback_data, current_callback.pUserData)) {
+                bail = true;
+            }
+        } else if (!current_callback.IsUtils() && (current_callback.debug_report_msg_flags & msg_flags)) {
+            // VK_EXT_debug_report callback (deprecated)
+            if (object_name_infos.empty()) {
+                VkDebugUtilsObjectNameInfoEXT null_object_name = {VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT, nullptr,
+                                                                  VK_OBJECT_TYPE_UNKNOWN, 0, nullptr};
+                // need to have at least one object
+                object_name_infos.emplace_back(null_object_name);
+            }
+            if (current_callback.debug_report_callback_function_ptr(
+                    msg_flags, ConvertCoreObjectToDebugReportObject(object_name_infos[0].objectType),
+                    object_name_infos[0].objectHandle, message_id_number, 0, layer_prefix, composite.c_str(),
+                    current_callback.pUserData)) {
+                bail = true;
+            }
+        }
+    }
+    return bail;
+}
+
+namespace {
+
+// With async_message_delivery, a message waiting for the message_delivery_queue. It owns everything its callback data points
+// to, the names are only pointed to once the vectors holding them won't move anymore.
+struct AsyncMessage {
+    std::vector<VkLayerDbgFunctionState> callbacks;
+    bool force_default_callbacks = false;
+    VkFlags msg_flags = 0;
+    VkDebugUtilsMessageSeverityFlagsEXT severity = 0;
+    VkDebugUtilsMessageTypeFlagsEXT types = 0;
+    uint32_t message_id_number = 0;
+    std::string layer_prefix;
+    std::optional<std::string> vuid;
+    std::string composite;
+    std::vector<VkDebugUtilsObjectNameInfoEXT> objects;
+    std::vector<std::string> object_names;
     std::vector<VkDebugUtilsLabelEXT> queue_labels;
+    std::vector<std::string> queue_label_names;
     std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
+    std::vector<std::string> cmd_buf_label_names;
+
+    void Deliver(const debug_report_data &debug_data);
+};
+
+}  // namespace
+
+static void CopyLabels(const std::vector<VkDebugUtilsLabelEXT> &labels, std::vector<VkDebugUtilsLabelEXT> &copies,
+                       std::vector<std::string> &names) {
+    copies = labels;
+    names.reserve(labels.size());
+    for (const auto &label : labels) {
+        names.emplace_back(label.pLabelName ? label.pLabelName : "");
+    }
+}
+
+void AsyncMessage::Deliver(const debug_report_data &debug_data) {
+    for (size_t i = 0; i < objects.size(); i++) {
+        if (objects[i].pObjectName) {
+            objects[i].pObjectName = object_names[i].c_str();
+        }
+    }
+    for (size_t i = 0; i < queue_labels.size(); i++) {
+        queue_labels[i].pLabelName = queue_label_names[i].c_str();
+    }
+    for (size_t i = 0; i < cmd_buf_labels.size(); i++) {
+        cmd_buf_labels[i].pLabelName = cmd_buf_label_names[i].c_str();
+    }
+    VkDebugUtilsMessengerCallbackDataEXT callback_data =
+        MakeCallbackData(vuid ? vuid->c_str() : nullptr, message_id_number, queue_labels, cmd_buf_labels, objects);
+    std::lock_guard<std::mutex> delivery_lock(debug_data.message_delivery_mutex);
+    InvokeCallbacks(callbacks, force_default_callbacks, msg_flags, severity, types, callback_data, objects, message_id_number,
+                    layer_prefix.c_str(), composite);
+}
+
+VKAPI_ATTR void StartAsyncMessageDelivery(debug_report_data *debug_data, bool async_errors) {
+    debug_data->async_error_messages = async_errors;
+    debug_data->message_delivery_queue = std::make_unique<vvl::TaskQueue>(1);
+}
+
+VKAPI_ATTR void FlushLogMessages(const debug_report_data *debug_data) {
+    if (debug_data->message_delivery_queue) {
+        debug_data->message_delivery_queue->Wait();
+    }
+}
+
+// The registry lock is released before the labels are copied, the shared_ptr keeps the stack alive
+template <typename Map>
+static std::shared_ptr<LoggingLabelState> FindLoggingLabelState(const Map &map, const debug_report_data *debug_data,
+                                                                const VulkanTypedHandle &object) {
+    std::shared_lock<std::shared_mutex> lock(debug_data->label_registry_mutex);
+    auto iter = map.find(reinterpret_cast<typename Map::key_type>(object.handle));
+    return iter != map.end() ? iter->second : nullptr;
+}
+
+static bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
+                                 const char *layer_prefix, const char *message, const char *text_vuid) {
+    // Copies, since the label stacks can change while the callbacks run
+    std::vector<LoggingLabel> queue_label_copies;
+    std::vector<LoggingLabel> cmd_buf_label_copies;
 
     // Convert the info to the VK_EXT_debug_utils format
     VkDebugUtilsMessageTypeFlagsEXT types;
@@ -111,124 +418,123 @@ static bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags
 
         std::string object_label = {};
         // Look for any debug utils or marker names to use for this object
-        // NOTE: the lock (debug_output_mutex) is held by the caller (LogMsg)
-        object_label = debug_data->DebugReportGetUtilsObjectNameNoLock(objects.object_list[i].handle);
+        object_label = debug_data->DebugReportGetUtilsObjectName(objects.object_list[i].handle);
         if (object_label.empty()) {
-            object_label = debug_data->DebugReportGetMarkerObjectNameNoLock(objects.object_list[i].handle);
+            object_label = debug_data->DebugReportGetMarkerObjectName(objects.object_list[i].handle);
         }
         if (!object_label.empty()) {
             object_labels.push_back(std::move(object_label));
             object_name_info.pObjectName = object_labels.back().c_str();
         }
 
-        // If this is a queue, add any queue labels to the callback data.
+        // If this is a queue or a command buffer, add its labels to the callback data.
         if (VK_OBJECT_TYPE_QUEUE == object_name_info.objectType) {
-            auto label_iter = debug_data->debugUtilsQueueLabels.find(reinterpret_cast<VkQueue>(object_name_info.objectHandle));
-            if (label_iter != debug_data->debugUtilsQueueLabels.end()) {
-                auto found_queue_labels = label_iter->second->Export();
-                queue_labels.insert(queue_labels.end(), found_queue_labels.begin(), found_queue_labels.end());
+            if (auto label_state = FindLoggingLabelState(debug_data->debugUtilsQueueLabels, debug_data, objects.object_list[i])) {
+                label_state->Export(queue_label_copies);
             }
-            // If this is a command buffer, add any command buffer labels to the callback data.
         } else if (VK_OBJECT_TYPE_COMMAND_BUFFER == object_name_info.objectType) {
-            auto label_iter =
-                debug_data->debugUtilsCmdBufLabels.find(reinterpret_cast<VkCommandBuffer>(object_name_info.objectHandle));
-            if (label_iter != debug_data->debugUtilsCmdBufLabels.end()) {
-                auto found_cmd_buf_labels = label_iter->second->Export();
-                cmd_buf_labels.insert(cmd_buf_labels.end(), found_cmd_buf_labels.begin(), found_cmd_buf_labels.end());
+            if (auto label_state = FindLoggingLabelState(debug_data->debugUtilsCmdBufLabels, debug_data, objects.object_list[i])) {
+                label_state->Export(cmd_buf_label_copies);
             }
         }
 
         object_name_infos.push_back(object_name_info);
     }
 
-    const uint32_t message_id_number = text_vuid ? hash_util::VuidHash(text_vuid) : 0U;
+    std::vector<VkDebugUtilsLabelEXT> queue_labels;
+    std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
+    for (const auto &label : queue_label_copies) {
+        queue_labels.emplace_back(label.Export());
+    }
+    for (const auto &label : cmd_buf_label_copies) {
+        cmd_buf_labels.emplace_back(label.Export());
+    }
 
-    VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
-    callback_data.flags = 0;
-    callback_data.pMessageIdName = text_vuid;
-    callback_data.messageIdNumber = vvl_bit_cast<int32_t>(message_id_number);
-    callback_data.pMessage = nullptr;
-    callback_data.queueLabelCount = static_cast<uint32_t>(queue_labels.size());
-    callback_data.pQueueLabels = queue_labels.empty() ? nullptr : queue_labels.data();
-    callback_data.cmdBufLabelCount = static_cast<uint32_t>(cmd_buf_labels.size());
-    callback_data.pCmdBufLabels = cmd_buf_labels.empty() ? nullptr : cmd_buf_labels.data();
-    callback_data.objectCount = static_cast<uint32_t>(object_name_infos.size());
-    callback_data.pObjects = object_name_infos.data();
+    const uint32_t message_id_number = text_vuid ? hash_util::VuidHash(text_vuid) : 0U;
 
-    std::ostringstream oss;
+    std::string composite;
+    composite.reserve(std::strlen(message) + 256);
     if (msg_flags & kErrorBit) {
-        oss << "Validation Error: ";
+        composite += "Validation Error: ";
     } else if (msg_flags & kWarningBit) {
-        oss << "Validation Warning: ";
+        composite += "Validation Warning: ";
     } else if (msg_flags & kPerformanceWarningBit) {
-        oss << "Validation Performance Warning: ";
+        composite += "Validation Performance Warning: ";
     } else if (msg_flags & kInformationBit) {
-        oss << "Validation Information: ";
+        composite += "Validation Information: ";
     } else if (msg_flags & kVerboseBit) {
-        oss << "Verbose Information: ";
+        composite += "Verbose Information: ";
     }
     if (text_vuid != nullptr) {
-        oss << "[ " << text_vuid << " ] ";
+        composite += "[ ";
+        composite += text_vuid;
+        composite += " ] ";
     }
+    char hex[16];
     uint32_t index = 0;
     for (const auto &src_object : object_name_infos) {
+        composite += "Object ";
+        composite += std::to_string(index++);
         if (0 != src_object.objectHandle) {
-            oss << "Object " << index++ << ": handle = 0x" << std::hex << src_object.objectHandle;
+            composite += ": handle = 0x";
+            composite.append(hex, std::to_chars(hex, hex + sizeof(hex), src_object.objectHandle, 16).ptr);
             if (src_object.pObjectName) {
-                oss << ", name = " << src_object.pObjectName << ", type = ";
-            } else {
-                oss << ", type = ";
+                composite += ", name = ";
+                composite += src_object.pObjectName;
             }
-            oss << string_VkObjectType(src_object.objectType) << "; ";
+            composite += ", type = ";
         } else {
-            oss << "Object " << index++ << ": VK_NULL_HANDLE, type = " << string_VkObjectType(src_object.objectType) << "; ";
+            composite += ": VK_NULL_HANDLE, type = ";
         }
+        composite += string_VkObjectType(src_object.objectType);
+        composite += "; ";
     }
-    oss << "| MessageID = 0x" << std::hex << message_id_number << " | " << message;
-    std::string composite = oss.str();
-
-    const auto callback_list = &debug_data->debug_callback_list;
-    // We only output to default callbacks if there are no non-default callbacks
-    bool use_default_callbacks = true;
-    for (const auto &current_callback : *callback_list) {
-        use_default_callbacks &= current_callback.IsDefault();
-    }
+    composite += "| MessageID = 0x";
+    composite.append(hex, std::to_chars(hex, hex + sizeof(hex), message_id_number, 16).ptr);
+    composite += " | ";
+    composite += message;
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-    if (debug_data->forceDefaultLogCallback) {
-        use_default_callbacks = true;
-    }
+    const bool force_default_callbacks = debug_data->forceDefaultLogCallback;
+#else
+    const bool force_default_callbacks = false;
 #endif
 
-    for (const auto &current_callback : *callback_list) {
-        // Skip callback if it's a default callback and there are non-default callbacks present
-        if (current_callback.IsDefault() && !use_default_callbacks) continue;
-
-        // VK_EXT_debug_utils callback
-        if (current_callback.IsUtils() && (current_callback.debug_utils_msg_flags & severity) &&
-            (current_callback.debug_utils_msg_type & types)) {
-            callback_data.pMessage = composite.c_str();
-            if (current_callback.debug_utils_callback_function_ptr(static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(severity),
-                                                                   types, &callback_data, current_callback.pUserData)) {
-                bail = true;
-            }
-        } else if (!current_callback.IsUtils() && (current_callback.debug_report_msg_flags & msg_flags)) {
-            // VK_EXT_debug_report callback (deprecated)
-            if (object_name_infos.empty()) {
-                VkDebugUtilsObjectNameInfoEXT null_object_name = {VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT, nullptr,
-                                                                  VK_OBJECT_TYPE_UNKNOWN, 0, nullptr};
-                // need to have at least one object
-                object_name_infos.emplace_back(null_object_name);
-            }
-            if (current_callback.debug_report_callback_function_ptr(
-                    msg_flags, ConvertCoreObjectToDebugReportObject(object_name_infos[0].objectType),
-                    object_name_infos[0].objectHandle, message_id_number, 0, layer_prefix, composite.c_str(),
-                    current_callback.pUserData)) {
-                bail = true;
-            }
+    if (debug_data->message_delivery_queue && (debug_data->async_error_messages || !(msg_flags & kErrorBit))) {
+        auto async_message = std::make_shared<AsyncMessage>();
+        async_message->callbacks = debug_data->debug_callback_list;
+        async_message->force_default_callbacks = force_default_callbacks;
+        async_message->msg_flags = msg_flags;
+        async_message->severity = severity;
+        async_message->types = types;
+        async_message->message_id_number = message_id_number;
+        async_message->layer_prefix = layer_prefix;
+        if (text_vuid) {
+            async_message->vuid = text_vuid;
+        }
+        async_message->composite = std::move(composite);
+        async_message->objects = object_name_infos;
+        for (const auto &object : object_name_infos) {
+            async_message->object_names.emplace_back(object.pObjectName ? object.pObjectName : "");
         }
+        CopyLabels(queue_labels, async_message->queue_labels, async_message->queue_label_names);
+        CopyLabels(cmd_buf_labels, async_message->cmd_buf_labels, async_message->cmd_buf_label_names);
+        debug_data->message_delivery_queue->Push([debug_data, async_message]() { async_message->Deliver(*debug_data); });
+        // The callbacks can't make the call fail anymore
+        return false;
     }
-    return bail;
+
+    VkDebugUtilsMessengerCallbackDataEXT callback_data =
+        MakeCallbackData(text_vuid, message_id_number, queue_labels, cmd_buf_labels, object_name_infos);
+    // Callbacks are never called from two threads at once
+    std::unique_lock<std::mutex> delivery_lock(debug_data->message_delivery_mutex, std::defer_lock);
+    if (debug_data->message_delivery_queue) {
+        // Deliver the messages queued before this one first, so the application sees them in the order they were logged
+        debug_data->message_delivery_queue->Wait();
+        delivery_lock.lock();
+    }
+    return InvokeCallbacks(debug_data->debug_callback_list, force_default_callbacks, msg_flags, severity, types, callback_data,
+                           object_name_infos, message_id_number, layer_prefix, composite);
 }
 
 VKAPI_ATTR void LayerDebugUtilsDestroyInstance(debug_report_data *debug_data) { delete debug_data; }
@@ -334,11 +640,27 @@ VKAPI_ATTR void DeactivateInstanceDebugCallbacks(debug_report_data *debug_data)
     }
 }
 
+// Whether the callbacks take messages of this severity and type
+static bool TextMessageEnabled(const debug_report_data *debug_data, VkDebugUtilsMessageSeverityFlagsEXT severity,
+                               VkDebugUtilsMessageTypeFlagsEXT type) {
+    return (debug_data->active_severities.load(std::memory_order_relaxed) & severity) &&
+           (debug_data->active_types.load(std::memory_order_relaxed) & type);
+}
+
+static bool BinaryMessageEnabled(const debug_report_data *debug_data, VkDebugUtilsMessageSeverityFlagsEXT severity,
+                                 VkDebugUtilsMessageTypeFlagsEXT type) {
+    return debug_data->binary_log && (debug_data->binary_log_severities & severity) && (debug_data->binary_log_types & type);
+}
+
 // helper for VUID based filtering. This needs to be separate so it can be called before incurring
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
-static bool LogMsgEnabled(const debug_report_data *debug_data, std::string_view vuid_text,
-                          VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type) {
-    if (!(debug_data->active_severities & severity) || !(debug_data->active_types & type)) {
+// Doesn't need debug_output_mutex, so that muted messages don't serialize the threads logging them.
+// aggregated is set to the number of identical messages message_aggregation_window counted since this one was last reported.
+static bool LogMsgEnabled(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
+                          std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
+                          VkDebugUtilsMessageTypeFlagsEXT type, uint32_t &aggregated) {
+    aggregated = 0;
+    if (!TextMessageEnabled(debug_data, severity, type) && !BinaryMessageEnabled(debug_data, severity, type)) {
         return false;
     }
     // If message is in filter list, bail out very early
@@ -346,94 +668,147 @@ static bool LogMsgEnabled(const debug_report_data *debug_data, std::string_view
     if (debug_data->filter_message_ids.find(message_id) != debug_data->filter_message_ids.end()) {
         return false;
     }
-    if ((debug_data->duplicate_message_limit > 0) && UpdateLogMsgCounts(debug_data, static_cast<int32_t>(message_id))) {
+    // Counted before the duplicate limit, so that the aggregated messages don't use it up
+    if ((debug_data->message_aggregation_window > 0) &&
+        !debug_data->aggregated_messages.Admit(msg_flags, vuid_text, objects, debug_data->message_aggregation_window, aggregated)) {
+        return false;
+    }
+    if ((debug_data->duplicate_message_limit > 0) &&
+        !debug_data->duplicate_message_counts.Increment(message_id, debug_data->duplicate_message_limit)) {
         // Count for this particular message is over the limit, ignore it
         return false;
     }
     return true;
 }
 
-VKAPI_ATTR bool LogMsg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects, const Location *loc,
-                       std::string_view vuid_text, const char *format, va_list argptr) {
-    assert(*(vuid_text.data() + vuid_text.size()) == '\0');
-
+VKAPI_ATTR bool LogMsgIsEnabled(const debug_report_data *debug_data, VkFlags msg_flags, std::string_view vuid_text) {
     VkDebugUtilsMessageSeverityFlagsEXT severity;
     VkDebugUtilsMessageTypeFlagsEXT type;
 
     DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
-    std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
-    // Avoid logging cost if msg is to be ignored
-    if (!LogMsgEnabled(debug_data, vuid_text, severity, type)) {
+    if (!TextMessageEnabled(debug_data, severity, type) && !BinaryMessageEnabled(debug_data, severity, type)) {
+        return false;
+    }
+    const uint32_t message_id = hash_util::VuidHash(vuid_text);
+    if (debug_data->filter_message_ids.find(message_id) != debug_data->filter_message_ids.end()) {
         return false;
     }
+    // Same test as LogMsgEnabled, without counting the message
+    if ((debug_data->duplicate_message_limit > 0) &&
+        debug_data->duplicate_message_counts.Count(message_id) >= debug_data->duplicate_message_limit) {
+        return false;
+    }
+    return true;
+}
+
+// Set while the checks running on this thread defer their messages
+static thread_local DeferredMessages *deferred_messages = nullptr;
+
+// Appends "<location> <formatted message>" to out
+static void FormatLogMessage(const Location *loc, const char *format, va_list argptr, std::string &out) {
+    // TODO - make Location a reference once old LogError is gone
+    if (loc) {
+        loc->AppendMessage(out);
+        out += ' ';
+    }
 
-    // Best guess at an upper bound for message length. At least some of the extra space
-    // should get used to store the VUID URL and text in the common case, without additional allocations.
-    std::string str_plus_spec_text(1024, '\0');
+    // Best guess at an upper bound for message length, the buffer usually has that much capacity already
+    const size_t start = out.size();
+    const size_t room = std::max<size_t>(1024, out.capacity() - start);
+    out.resize(start + room);
 
     // vsnprintf() returns the number of characters that *would* have been printed, if there was
-    // enough space. If we have a huge message, reallocate the string and try again.
-    int result;
-    size_t old_size = str_plus_spec_text.size();
+    // enough space. If we have a huge message, grow the string and try again.
     // The va_list will be destroyed by the call to vsnprintf(), so use a copy in case we need
     // to try again.
     va_list arg_copy;
     va_copy(arg_copy, argptr);
-    result = vsnprintf(str_plus_spec_text.data(), str_plus_spec_text.size(), format, arg_copy);
+    int result = vsnprintf(out.data() + start, room, format, arg_copy);
     va_end(arg_copy);
 
     assert(result >= 0);
     if (result < 0) {
-        str_plus_spec_text = "Message generation failure";
-    } else if (static_cast<size_t>(result) <= old_size) {
+        out.resize(start);
+        out += "Message generation failure";
+    } else if (static_cast<size_t>(result) < room) {
         // Shrink the string to exactly fit the successfully printed string
-        str_plus_spec_text.resize(result);
+        out.resize(start + result);
     } else {
-        // Grow buffer to fit needed size. Note that the input size to vsnprintf() must
-        // include space for the trailing '\0' character, but the return value DOES NOT
-        // include the `\0' character.
-        str_plus_spec_text.resize(result + 1);
+        // Note that the input size to vsnprintf() must include space for the trailing '\0' character,
+        // but the return value DOES NOT include the `\0' character.
+        out.resize(start + result + 1);
         // consume the va_list passed to us by the caller
-        result = vsnprintf(str_plus_spec_text.data(), str_plus_spec_text.size(), format, argptr);
+        result = vsnprintf(out.data() + start, result + 1, format, argptr);
         // remove the `\0' character from the string
-        str_plus_spec_text.resize(result);
+        out.resize(start + result);
     }
+}
 
-    // TODO - make Location a reference once old LogError is gone
-    if (loc) {
-        str_plus_spec_text = loc->Message() + " " + str_plus_spec_text;
-    }
+static std::string FormatLogMessage(const Location *loc, const char *format, va_list argptr) {
+    std::string message;
+    FormatLogMessage(loc, format, argptr, message);
+    return message;
+}
+
+// Messages logged on this thread are built here, so that their capacity is reused from one message to the next
+static thread_local std::string message_buffer;
+// A debug callback calling back into the layer while message_buffer is in use gets a buffer of its own
+static thread_local bool message_buffer_in_use = false;
+
+// The string table is sorted by VUID
+static const vuid_spec_text_pair *FindVuidSpecText(std::string_view vuid_text) {
+    const auto end = std::end(vuid_spec_text);
+    const auto it = std::lower_bound(
+        std::begin(vuid_spec_text), end, vuid_text,
+        [](const vuid_spec_text_pair &entry, std::string_view vuid) { return std::string_view(entry.vuid) < vuid; });
+    return (it != end && std::string_view(it->vuid) == vuid_text) ? it : nullptr;
+}
+
+// Appends the link to the spec the VUIDs of spec_type are in, without the VUID anchor
+static void AppendSpecLink(std::string &out, std::string_view spec_type) {
+#ifdef ANNOTATED_SPEC_LINK
+    static const std::string_view spec_link = ANNOTATED_SPEC_LINK;
+#else
+    static const std::string_view spec_link =
+        "https://www.khronos.org/registry/vulkan/specs/_MAGIC_KHRONOS_SPEC_TYPE_/html/vkspec.html";
+#endif
+    static const std::string major_version = std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE));
+    static const std::string minor_version = std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE));
+    static const std::string patch_version = std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+    static const std::string header_version = major_version + "." + minor_version + "." + patch_version;
+    static const std::string annotated_spec_type = major_version + "." + minor_version + "-extensions";
+    constexpr std::string_view kAtToken = "_MAGIC_ANNOTATED_SPEC_TYPE_";
+    constexpr std::string_view kKtToken = "_MAGIC_KHRONOS_SPEC_TYPE_";
+    constexpr std::string_view kVeToken = "_MAGIC_VERSION_ID_";
+
+    // Each token is replaced at most once, and only inside the link
+    const size_t link_start = out.size();
+    out.append(spec_link);
+    auto Replace = [&out, link_start](std::string_view to_replace, std::string_view replace_with) {
+        const size_t pos = out.find(to_replace.data(), link_start, to_replace.size());
+        if (pos != std::string::npos) {
+            out.replace(pos, to_replace.size(), replace_with.data(), replace_with.size());
+        }
+    };
+    Replace(kKtToken, spec_type);
+    Replace(kAtToken, annotated_spec_type);
+    Replace(kVeToken, header_version);
+}
 
+// The caller holds the lock (debug_output_mutex) and checked that the message is enabled
+static bool LogFormattedMsgLocked(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
+                                  std::string_view vuid_text, std::string &str_plus_spec_text) {
     // Append the spec error text to the error message, unless it contains a word treated as special
     if ((vuid_text.find("VUID-") != std::string::npos)) {
-        // Linear search makes no assumptions about the layout of the string table. This is not fast, but it does not need to be at
-        // this point in the error reporting path
-        uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
         const char *spec_text = nullptr;
-        std::string spec_type;
-        for (uint32_t i = 0; i < num_vuids; i++) {
-            if (0 == strncmp(vuid_text.data(), vuid_spec_text[i].vuid, vuid_text.size())) {
-                spec_text = vuid_spec_text[i].spec_text;
-                spec_type = vuid_spec_text[i].url_id;
-                break;
-            }
+        std::string_view spec_type;
+        if (const vuid_spec_text_pair *entry = FindVuidSpecText(vuid_text)) {
+            spec_text = entry->spec_text;
+            spec_type = entry->url_id;
         }
 
         // Construct and append the specification text and link to the appropriate version of the spec
         if (nullptr != spec_text) {
-            std::string spec_link = "https://www.khronos.org/registry/vulkan/specs/_MAGIC_KHRONOS_SPEC_TYPE_/html/vkspec.html";
-#ifdef ANNOTATED_SPEC_LINK
-            spec_link = ANNOTATED_SPEC_LINK;
-#endif
-            static std::string kAtToken = "_MAGIC_ANNOTATED_SPEC_TYPE_";
-            static std::string kKtToken = "_MAGIC_KHRONOS_SPEC_TYPE_";
-            static std::string kVeToken = "_MAGIC_VERSION_ID_";
-            auto Replace = [](std::string &dest_string, const std::string &to_replace, const std::string &replace_with) {
-                if (dest_string.find(to_replace) != std::string::npos) {
-                    dest_string.replace(dest_string.find(to_replace), to_replace.size(), replace_with);
-                }
-            };
-
             // Add period at end if forgotten
             // This provides better seperation between error message and spec text
             if (str_plus_spec_text.back() != '.') {
@@ -446,15 +821,7 @@ VKAPI_ATTR bool LogMsg(const debug_report_data *debug_data, VkFlags msg_flags, c
                 str_plus_spec_text.append(" (https://github.com/KhronosGroup/Vulkan-Docs/search?q=)");
             } else {
                 str_plus_spec_text.append(" (");
-                str_plus_spec_text.append(spec_link);
-                std::string major_version = std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE));
-                std::string minor_version = std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE));
-                std::string patch_version = std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
-                std::string header_version = major_version + "." + minor_version + "." + patch_version;
-                std::string annotated_spec_type = major_version + "." + minor_version + "-extensions";
-                Replace(str_plus_spec_text, kKtToken, spec_type);
-                Replace(str_plus_spec_text, kAtToken, annotated_spec_type);
-                Replace(str_plus_spec_text, kVeToken, header_version);
+                AppendSpecLink(str_plus_spec_text, spec_type);
                 str_plus_spec_text.append("#");  // CMake hates hashes
             }
             str_plus_spec_text.append(vuid_text);
@@ -465,6 +832,144 @@ VKAPI_ATTR bool LogMsg(const debug_report_data *debug_data, VkFlags msg_flags, c
     return debug_log_msg(debug_data, msg_flags, objects, "Validation", str_plus_spec_text.c_str(), vuid_text.data());
 }
 
+static void AppendAggregatedCountText(std::string &text, uint32_t aggregated) {
+    char digits[16];
+    text.append(digits, std::to_chars(digits, digits + sizeof(digits), aggregated).ptr);
+    text += aggregated == 1 ? " identical message was" : " identical messages were";
+    text += " aggregated since the last report";
+}
+
+static void AppendAggregatedCount(std::string &text, uint32_t aggregated) {
+    if (aggregated > 0) {
+        text += " [";
+        AppendAggregatedCountText(text, aggregated);
+        text += ']';
+    }
+}
+
+VKAPI_ATTR void ReportAggregatedMessages(const debug_report_data *debug_data) {
+    if (debug_data->message_aggregation_window == 0) {
+        return;
+    }
+    for (auto &summary : debug_data->aggregated_messages.TakeSummaries()) {
+        std::string text;
+        AppendAggregatedCountText(text, summary.count);
+        std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+        LogFormattedMsgLocked(debug_data, summary.msg_flags, summary.objects, summary.vuid, text);
+    }
+}
+
+VKAPI_ATTR bool LogMsg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects, const Location *loc,
+                       std::string_view vuid_text, const char *format, va_list argptr) {
+    assert(*(vuid_text.data() + vuid_text.size()) == '\0');
+
+    if (deferred_messages) {
+        // The duplicate count is left to Report(), which sees the messages in order
+        if (LogMsgIsEnabled(debug_data, msg_flags, vuid_text)) {
+            VkDebugUtilsMessageSeverityFlagsEXT severity;
+            VkDebugUtilsMessageTypeFlagsEXT type;
+            DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
+
+            DeferredMessages::Message message{debug_data, msg_flags, objects, std::string(vuid_text), {}, {}};
+            if (TextMessageEnabled(debug_data, severity, type)) {
+                message.text = FormatLogMessage(loc, format, argptr);
+            }
+            if (BinaryMessageEnabled(debug_data, severity, type)) {
+                debug_data->binary_log->Encode(msg_flags, vuid_text, loc, objects, message.binary_record);
+            }
+            deferred_messages->Add(std::move(message));
+        } else {
+            deferred_messages->AddSuppressed();
+        }
+        // The callbacks haven't run, whether to skip is known when the messages are reported (see DeferMessagesScope)
+        return false;
+    }
+
+    VkDebugUtilsMessageSeverityFlagsEXT severity;
+    VkDebugUtilsMessageTypeFlagsEXT type;
+
+    DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
+    // Avoid logging cost if msg is to be ignored
+    uint32_t aggregated;
+    if (!LogMsgEnabled(debug_data, msg_flags, objects, vuid_text, severity, type, aggregated)) {
+        return false;
+    }
+
+    if (BinaryMessageEnabled(debug_data, severity, type)) {
+        thread_local std::vector<uint8_t> binary_record;
+        binary_record.clear();
+        debug_data->binary_log->Encode(msg_flags, vuid_text, loc, objects, binary_record);
+        debug_data->binary_log->Write(binary_record);
+    }
+    // The text of messages only written to the binary log is never formatted
+    if (!TextMessageEnabled(debug_data, severity, type)) {
+        return false;
+    }
+
+    if (message_buffer_in_use) {
+        std::string str_plus_spec_text = FormatLogMessage(loc, format, argptr);
+        AppendAggregatedCount(str_plus_spec_text, aggregated);
+        std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+        return LogFormattedMsgLocked(debug_data, msg_flags, objects, vuid_text, str_plus_spec_text);
+    }
+    message_buffer_in_use = true;
+    message_buffer.clear();
+    FormatLogMessage(loc, format, argptr, message_buffer);
+    AppendAggregatedCount(message_buffer, aggregated);
+    bool skip;
+    {
+        std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+        skip = LogFormattedMsgLocked(debug_data, msg_flags, objects, vuid_text, message_buffer);
+    }
+    // Don't keep the memory of an unusually long message for the lifetime of the thread
+    if (message_buffer.capacity() > 64 * 1024) {
+        message_buffer = std::string();
+    }
+    message_buffer_in_use = false;
+    return skip;
+}
+
+bool DeferredMessages::Report() {
+    bool skip = false;
+    for (auto &message : messages_) {
+        VkDebugUtilsMessageSeverityFlagsEXT severity;
+        VkDebugUtilsMessageTypeFlagsEXT type;
+
+        DebugReportFlagsToAnnotFlags(message.msg_flags, &severity, &type);
+        uint32_t aggregated;
+        if (LogMsgEnabled(message.debug_data, message.msg_flags, message.objects, message.vuid, severity, type, aggregated)) {
+            if (!message.binary_record.empty()) {
+                message.debug_data->binary_log->Write(message.binary_record);
+            }
+            if (!message.text.empty()) {
+                AppendAggregatedCount(message.text, aggregated);
+                std::unique_lock<std::mutex> lock(message.debug_data->debug_output_mutex);
+                skip |= LogFormattedMsgLocked(message.debug_data, message.msg_flags, message.objects, message.vuid, message.text);
+            }
+        }
+    }
+    messages_.clear();
+    return skip;
+}
+
+bool DeferredMessages::Forward() {
+    if (!deferred_messages) {
+        return Report();
+    }
+    for (auto &message : messages_) {
+        deferred_messages->Add(std::move(message));
+    }
+    if (suppressed_) {
+        deferred_messages->AddSuppressed();
+    }
+    messages_.clear();
+    return false;
+}
+
+DeferMessagesScope::DeferMessagesScope(DeferredMessages &deferred) : previous_(deferred_messages) { deferred_messages = &deferred; }
+
+DeferMessagesScope::~DeferMessagesScope() { deferred_messages = previous_; }
+
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerBreakCallback([[maybe_unused]] VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
                                                       [[maybe_unused]] VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                       [[maybe_unused]] const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
@@ -511,6 +1016,13 @@ VKAPI_ATTR VkBool32 VKAPI_CALL MessengerLogCallback(VkDebugUtilsMessageSeverityF
     return false;
 }
 
+VKAPI_ATTR VkBool32 VKAPI_CALL MessengerRingCallback(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                                     const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data) {
+    // pMessage already names the severity, the VUID and the objects
+    static_cast<MessageRing *>(user_data)->Write(callback_data->pMessage);
+    return false;
+}
+
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerWin32DebugOutputMsg(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
                                                             VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                             const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
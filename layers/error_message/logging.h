@@ -18,8 +18,11 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdarg>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -30,8 +33,11 @@
 
 #include "vk_layer_config.h"
 #include "containers/custom_containers.h"
+#include "error_message/binary_log.h"
+#include "error_message/message_ring.h"
 #include "generated/vk_layer_dispatch_table.h"
 #include "generated/vk_object_types.h"
+#include "utils/worker_pool.h"
 
 #if defined __ANDROID__
 #include <android/log.h>
@@ -49,7 +55,10 @@ typedef enum DebugCallbackStatusBits {
 typedef VkFlags DebugCallbackStatusFlags;
 
 struct LogObjectList {
-    small_vector<VulkanTypedHandle, 4, uint32_t> object_list;
+    // Up to 4 objects, which covers the command buffer, its bound pipeline and the resources of almost every error, are stored
+    // inline. Lists that take lookups to gather (ex. vvl::CommandBuffer::GetObjectList) should only be built on the error path.
+    static constexpr uint32_t kInlineCount = 4;
+    small_vector<VulkanTypedHandle, kInlineCount, uint32_t> object_list;
 
     template <typename HANDLE_T>
     void add(HANDLE_T object) {
@@ -139,26 +148,57 @@ struct LoggingLabel {
     LoggingLabel(Name &&name_, Vec &&vec_) : name(std::forward<Name>(name_)), color(std::forward<Vec>(vec_)) {}
 };
 
-struct LoggingLabelState {
-    std::vector<LoggingLabel> labels;
-    LoggingLabel insert_label;
-
-    // Export the labels, but in reverse order since we want the most recent at the top.
-    std::vector<VkDebugUtilsLabelEXT> Export() const {
-        size_t count = labels.size() + (insert_label.Empty() ? 0 : 1);
-        std::vector<VkDebugUtilsLabelEXT> out(count);
+// The label stack of a queue or command buffer. It has its own lock, so labeling never waits for messages being logged
+// about other objects, and the labels are copied out when logging since they can change once the lock is released.
+class LoggingLabelState {
+  public:
+    void Begin(const VkDebugUtilsLabelEXT *label_info) {
+        if (nullptr == label_info || nullptr == label_info->pLabelName) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(lock_);
+        labels_.emplace_back(label_info);
 
-        if (!count) return out;
+        // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
+        insert_label_.Reset();
+    }
 
-        size_t index = count - 1;
-        if (!insert_label.Empty()) {
-            out[index--] = insert_label.Export();
+    void End() {
+        std::lock_guard<std::mutex> lock(lock_);
+        // Pop the normal item
+        if (!labels_.empty()) {
+            labels_.pop_back();
         }
-        for (const auto &label : labels) {
-            out[index--] = label.Export();
+
+        // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
+        insert_label_.Reset();
+    }
+
+    void Insert(const VkDebugUtilsLabelEXT *label_info) {
+        std::lock_guard<std::mutex> lock(lock_);
+        // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
+        insert_label_ = LoggingLabel(label_info);
+    }
+
+    void Reset() {
+        std::lock_guard<std::mutex> lock(lock_);
+        labels_.clear();
+        insert_label_.Reset();
+    }
+
+    // Copy the labels, but in reverse order since we want the most recent at the top.
+    void Export(std::vector<LoggingLabel> &out) const {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (!insert_label_.Empty()) {
+            out.emplace_back(insert_label_);
         }
-        return out;
+        out.insert(out.end(), labels_.rbegin(), labels_.rend());
     }
+
+  private:
+    mutable std::mutex lock_;
+    std::vector<LoggingLabel> labels_;
+    LoggingLabel insert_label_;
 };
 
 class TypedHandleWrapper {
@@ -173,76 +213,169 @@ class TypedHandleWrapper {
     VulkanTypedHandle handle_;
 };
 
+// Number of times each message id was logged, for duplicate_message_limit. Lock free so that messages already over the limit
+// are dropped without taking debug_output_mutex: each slot packs a message id (upper 32 bits) and its count plus one (lower
+// 32 bits, so that a used slot is never 0). Message ids take a slot the first time they are counted and keep it.
+class MessageCounts {
+  public:
+    // Counts the message unless it was already counted limit times, returns false in that case
+    bool Increment(uint32_t message_id, uint32_t limit);
+    uint32_t Count(uint32_t message_id) const;
+
+  private:
+    static constexpr size_t kSlotCount = 4096;
+    static constexpr uint64_t Pack(uint32_t message_id, uint32_t count) {
+        return (static_cast<uint64_t>(message_id) << 32) | (static_cast<uint64_t>(count) + 1);
+    }
+    static constexpr uint32_t UnpackMessageId(uint64_t slot) { return static_cast<uint32_t>(slot >> 32); }
+    static constexpr uint32_t UnpackCount(uint64_t slot) { return static_cast<uint32_t>(slot) - 1; }
+
+    // nullptr if all the slots are taken by other message ids
+    std::atomic<uint64_t> *FindOrInsert(uint32_t message_id);
+
+    std::array<std::atomic<uint64_t>, kSlotCount> slots_{};
+    // For the message ids logged once all the slots are taken
+    mutable std::mutex overflow_lock_;
+    vvl::unordered_map<uint32_t, uint32_t> overflow_;
+};
+
+// For message_aggregation_window: after a message is reported, the identical ones (same VUID and objects) logged within the
+// window are only counted, without being formatted. The count is reported with the first message of a later window, or by
+// ReportAggregatedMessages for the windows no message came after.
+class MessageAggregator {
+  public:
+    // Returns false if the message only has to be counted, else aggregated is set to the count since the last report
+    bool Admit(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, uint32_t window_ms,
+               uint32_t &aggregated);
+
+    struct Summary {
+        VkFlags msg_flags;
+        std::string vuid;
+        LogObjectList objects;
+        uint32_t count;
+    };
+    // Takes the counts not reported yet, the next messages start new windows
+    std::vector<Summary> TakeSummaries();
+
+  private:
+    static constexpr uint32_t kShardBits = 4;
+
+    struct Entry {
+        uint64_t window_start;  // steady clock nanoseconds
+        uint32_t count;
+        uint32_t message_id;
+        VkFlags msg_flags;
+        std::string vuid;
+        LogObjectList objects;
+    };
+
+    struct alignas(64) Shard {
+        std::mutex lock;
+        vvl::unordered_map<uint64_t, Entry> entries;
+    };
+
+    std::array<Shard, 1 << kShardBits> shards_;
+};
+
+// Debug names of the objects, written by vkSetDebugUtilsObjectNameEXT/vkDebugMarkerSetObjectNameEXT and read for every
+// handle in a message. Split in shards with a reader-writer lock each instead of sharing debug_output_mutex, so that formatting
+// handles doesn't serialize the threads logging messages, and naming an object only blocks the readers of its shard.
+class ObjectNameMap {
+  public:
+    // A null name removes the name of the object
+    void Set(uint64_t handle, const char *name);
+    // Empty if the object has no name
+    std::string Get(uint64_t handle) const;
+    // Appends the name of the object to out, returns false if it has none
+    bool Append(uint64_t handle, std::string &out) const;
+
+  private:
+    static constexpr uint32_t kShardBits = 4;
+
+    struct alignas(64) Shard {
+        mutable std::shared_mutex lock;
+        vvl::unordered_map<uint64_t, std::string> names;
+    };
+
+    // Handles are often aligned pointers, the multiplication spreads their high entropy bits over the top ones
+    static constexpr size_t ShardIndex(uint64_t handle) {
+        return static_cast<size_t>((handle * 0x9e3779b97f4a7c15ull) >> (64 - kShardBits));
+    }
+
+    std::array<Shard, 1 << kShardBits> shards_;
+    // Most applications name few objects or none, the readers skip the lookup while nothing is named
+    std::atomic<size_t> count_{0};
+};
+
 typedef struct _debug_report_data {
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
-    VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
-    VkDebugUtilsMessageTypeFlagsEXT active_types{0};
-    vvl::unordered_map<uint64_t, std::string> debugObjectNameMap;
-    vvl::unordered_map<uint64_t, std::string> debugUtilsObjectNameMap;
-    vvl::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debugUtilsQueueLabels;
-    vvl::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debugUtilsCmdBufLabels;
+    // Read without debug_output_mutex by the checks deciding whether to log a message
+    std::atomic<VkDebugUtilsMessageSeverityFlagsEXT> active_severities{0};
+    std::atomic<VkDebugUtilsMessageTypeFlagsEXT> active_types{0};
+    // The LogMessageTypeBits a callback or the binary log takes, derived from the above by UpdateEnabledMessageFlags
+    std::atomic<VkFlags> enabled_message_flags{0};
+    // Not guarded by debug_output_mutex
+    ObjectNameMap debugObjectNameMap;
+    ObjectNameMap debugUtilsObjectNameMap;
+    // The command buffer label stacks are owned by vvl::CommandBuffer, and the queue ones are added when first labeled.
+    // label_registry_mutex is only held to find a stack, the stacks are changed under their own lock.
+    mutable std::shared_mutex label_registry_mutex;
+    vvl::unordered_map<VkQueue, std::shared_ptr<LoggingLabelState>> debugUtilsQueueLabels;
+    vvl::unordered_map<VkCommandBuffer, std::shared_ptr<LoggingLabelState>> debugUtilsCmdBufLabels;
     // We use std::unordered_set to use trivial hashing for filter_message_ids as we already store hashed values
+    // Only set while creating the instance, so it is read without debug_output_mutex
     std::unordered_set<uint32_t> filter_message_ids{};
     // This mutex is defined as mutable since the normal usage for a debug report object is as 'const'. The mutable keyword allows
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
     mutable std::mutex debug_output_mutex;
     uint32_t duplicate_message_limit = 0;
-    mutable vvl::unordered_map<uint32_t, uint32_t> duplicate_message_count_map{};
+    mutable MessageCounts duplicate_message_counts;
+    // Milliseconds, 0 reports every message
+    uint32_t message_aggregation_window = 0;
+    mutable MessageAggregator aggregated_messages;
     const void *instance_pnext_chain{};
     bool forceDefaultLogCallback{false};
     uint32_t device_created = 0;
+    // With VK_DBG_LAYER_ACTION_LOG_BINARY, the messages of these severities and types are written to binary_log.
+    // Only set while creating the instance, like filter_message_ids.
+    std::unique_ptr<BinaryMessageLog> binary_log;
+    VkDebugUtilsMessageSeverityFlagsEXT binary_log_severities{0};
+    VkDebugUtilsMessageTypeFlagsEXT binary_log_types{0};
+    // With VK_DBG_LAYER_ACTION_LOG_RING, the ring the messenger calling MessengerRingCallback writes to. It outlives
+    // message_delivery_queue, which can still be delivering messages to that messenger.
+    std::unique_ptr<MessageRing> message_ring;
+    // Held while invoking the callbacks once message_delivery_queue exists, as they are then called from two threads
+    mutable std::mutex message_delivery_mutex;
+    // With async_error_messages, errors are delivered by message_delivery_queue too
+    bool async_error_messages{false};
+    // With async_message_delivery, the thread invoking the callbacks instead of the one logging the message.
+    // Declared last so that the messages still queued are delivered before anything else is destroyed.
+    std::unique_ptr<vvl::TaskQueue> message_delivery_queue;
 
     void DebugReportSetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
-        std::unique_lock<std::mutex> lock(debug_output_mutex);
-        if (pNameInfo->pObjectName) {
-            debugUtilsObjectNameMap[pNameInfo->objectHandle] = pNameInfo->pObjectName;
-        } else {
-            debugUtilsObjectNameMap.erase(pNameInfo->objectHandle);
-        }
+        debugUtilsObjectNameMap.Set(pNameInfo->objectHandle, pNameInfo->pObjectName);
     }
 
     void DebugReportSetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
-        std::unique_lock<std::mutex> lock(debug_output_mutex);
-        if (pNameInfo->pObjectName) {
-            debugObjectNameMap[pNameInfo->object] = pNameInfo->pObjectName;
-        } else {
-            debugObjectNameMap.erase(pNameInfo->object);
-        }
+        debugObjectNameMap.Set(pNameInfo->object, pNameInfo->pObjectName);
     }
 
-    // NoLock suffix means that the function itself does not hold debug_output_mutex lock,
-    // and it's **mandatory responsibility** of the caller to hold this lock.
-    std::string DebugReportGetUtilsObjectNameNoLock(const uint64_t object) const {
-        std::string label = "";
-        const auto utils_name_iter = debugUtilsObjectNameMap.find(object);
-        if (utils_name_iter != debugUtilsObjectNameMap.end()) {
-            label = utils_name_iter->second;
-        }
-        return label;
-    }
+    std::string DebugReportGetUtilsObjectName(const uint64_t object) const { return debugUtilsObjectNameMap.Get(object); }
 
-    // NoLock suffix means that the function itself does not hold debug_output_mutex lock,
-    // and it's **mandatory responsibility** of the caller to hold this lock.
-    std::string DebugReportGetMarkerObjectNameNoLock(const uint64_t object) const {
-        std::string label = "";
-        const auto marker_name_iter = debugObjectNameMap.find(object);
-        if (marker_name_iter != debugObjectNameMap.end()) {
-            label = marker_name_iter->second;
-        }
-        return label;
-    }
+    std::string DebugReportGetMarkerObjectName(const uint64_t object) const { return debugObjectNameMap.Get(object); }
 
-    std::string FormatHandle(const char *handle_type_name, uint64_t handle) const {
-        std::unique_lock<std::mutex> lock(debug_output_mutex);
-        std::string handle_name = DebugReportGetUtilsObjectNameNoLock(handle);
-        if (handle_name.empty()) {
-            handle_name = DebugReportGetMarkerObjectNameNoLock(handle);
-        }
+    // "<type> 0x<handle>[<name>]", the debug utils name is used over the debug marker one
+    std::string FormatHandle(const char *handle_type_name, uint64_t handle) const;
 
-        std::ostringstream str;
-        str << handle_type_name << " 0x" << std::hex << handle << "[" << handle_name.c_str() << "]";
-        return str.str();
+    // Whether messages of any of the msg_flags (LogMessageTypeBits) can be delivered at all, a single load. Lets the checks
+    // that only log warnings skip their work while nothing takes warnings.
+    bool IsMessageEnabled(VkFlags msg_flags) const {
+        return (enabled_message_flags.load(std::memory_order_relaxed) & msg_flags) != 0;
     }
+    // Also false for a message id (hash_util::VuidHash) muted by message_id_filter or already over duplicate_message_limit
+    bool IsMessageEnabled(VkFlags msg_flags, uint32_t vuid_hash) const;
+    // To call once the callbacks or the binary log changed
+    void UpdateEnabledMessageFlags();
 
     std::string FormatHandle(const VulkanTypedHandle &handle) const {
         return FormatHandle(object_string[handle.type], handle.handle);
@@ -288,9 +421,80 @@ static inline void DebugReportFlagsToAnnotFlags(VkDebugReportFlagsEXT dr_flags,
     }
 }
 
+// Messages are then delivered to the callbacks by a layer thread, the logging thread only formats them. They can't make the
+// call they are logged for fail. Unless async_errors is set, errors are still delivered right away.
+VKAPI_ATTR void StartAsyncMessageDelivery(debug_report_data *debug_data, bool async_errors);
+// Returns once the callbacks got the messages logged so far
+VKAPI_ATTR void FlushLogMessages(const debug_report_data *debug_data);
+// Logs the counts of the messages aggregated by message_aggregation_window that were not reported yet
+VKAPI_ATTR void ReportAggregatedMessages(const debug_report_data *debug_data);
+
 struct Location;
 VKAPI_ATTR bool LogMsg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects, const Location *loc,
                        std::string_view vuid_text, const char *format, va_list argptr);
+// True if LogMsg would currently report a message with this VUID: lets callers skip building costly message arguments for
+// messages muted by severity, message_id_filter or duplicate_message_limit. Doesn't count towards the duplicate limit.
+VKAPI_ATTR bool LogMsgIsEnabled(const debug_report_data *debug_data, VkFlags msg_flags, std::string_view vuid_text);
+
+// Messages logged by checks running on other threads, kept to be reported in a deterministic order once they are all done.
+// They are formatted when logged (the Location doesn't outlive the check), the duplicate_message_limit is only counted when
+// they are reported.
+class DeferredMessages {
+  public:
+    struct Message {
+        const debug_report_data *debug_data;
+        VkFlags msg_flags;
+        LogObjectList objects;
+        std::string vuid;
+        std::string text;  // with the Location, empty if only the binary log wants the message
+        std::vector<uint8_t> binary_record;
+    };
+
+    void Add(Message &&message) { messages_.emplace_back(std::move(message)); }
+    // Reports the messages in the order they were logged. Returns true if a callback asked for the call to be skipped.
+    bool Report();
+    // Adds the messages to the enclosing DeferMessagesScope of the thread, or reports them if there is none
+    bool Forward();
+    [[nodiscard]] bool empty() const { return messages_.empty(); }
+    // Messages that weren't going to be reported (no callback wants them yet, or their VUID is muted) are dropped, but noted
+    void AddSuppressed() { suppressed_ = true; }
+    // True if anything was logged, reported or not
+    [[nodiscard]] bool AnyLogged() const { return !messages_.empty() || suppressed_; }
+
+  private:
+    std::vector<Message> messages_;
+    bool suppressed_ = false;
+};
+
+// While alive, LogMsg on this thread adds to deferred instead of reporting, and returns false: the callbacks only run once the
+// messages are reported, so a callback asking for the call to be skipped is seen in what Report(), Forward() or
+// ValidateAndCheckClean return, not by the check that logged. Until then the check can't stop early on such a message, and
+// may log a few more than it would have logging directly. The call is skipped all the same.
+class DeferMessagesScope {
+  public:
+    explicit DeferMessagesScope(DeferredMessages &deferred);
+    DeferMessagesScope(const DeferMessagesScope &) = delete;
+    DeferMessagesScope &operator=(const DeferMessagesScope &) = delete;
+    ~DeferMessagesScope();
+
+  private:
+    DeferredMessages *previous_;
+};
+
+// Runs validate with its messages held, then forwards them as if they had been logged directly. clean is set if validate
+// logged nothing at all, for the callers that cache clean results: what validate returns can't tell (callbacks rarely ask to
+// skip, and deferred messages never do), and a message that wasn't reported still counts, a callback added later wants it.
+template <typename Validate>
+bool ValidateAndCheckClean(bool &clean, Validate &&validate) {
+    DeferredMessages messages;
+    bool skip = false;
+    {
+        DeferMessagesScope defer(messages);
+        skip = validate();
+    }
+    clean = !messages.AnyLogged();
+    return messages.Forward() || skip;
+}
 
 VKAPI_ATTR VkResult LayerCreateMessengerCallback(debug_report_data *debug_data, bool default_callback,
                                                  const VkDebugUtilsMessengerCreateInfoEXT *create_info,
@@ -302,8 +506,12 @@ VKAPI_ATTR VkResult LayerCreateReportCallback(debug_report_data *debug_data, boo
 
 template <typename T>
 static inline void LayerDestroyCallback(debug_report_data *debug_data, T callback) {
-    std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
-    RemoveDebugUtilsCallback(debug_data, debug_data->debug_callback_list, CastToUint64(callback));
+    {
+        std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+        RemoveDebugUtilsCallback(debug_data, debug_data->debug_callback_list, CastToUint64(callback));
+    }
+    // The messages logged before the removal can still be on their way to this callback
+    FlushLogMessages(debug_data);
 }
 
 VKAPI_ATTR void ActivateInstanceDebugCallbacks(debug_report_data *debug_data);
@@ -325,113 +533,62 @@ VKAPI_ATTR VkBool32 VKAPI_CALL MessengerLogCallback(VkDebugUtilsMessageSeverityF
                                                     VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                     const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data);
 
+// user_data is the MessageRing
+VKAPI_ATTR VkBool32 VKAPI_CALL MessengerRingCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                     VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                                     const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data);
+
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerWin32DebugOutputMsg(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
                                                             VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                             const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
                                                             void *user_data);
 
-template <typename Map>
-static LoggingLabelState *GetLoggingLabelState(Map *map, typename Map::key_type key, bool insert) {
-    auto iter = map->find(key);
-    LoggingLabelState *label_state = nullptr;
-    if (iter == map->end()) {
-        if (insert) {
-            // Add a label state if not present
-            auto inserted = map->emplace(key, std::unique_ptr<LoggingLabelState>(new LoggingLabelState()));
-            assert(inserted.second);
-            iter = inserted.first;
-            label_state = iter->second.get();
+static inline std::shared_ptr<LoggingLabelState> GetQueueLoggingLabelState(debug_report_data *report_data, VkQueue queue) {
+    {
+        std::shared_lock<std::shared_mutex> lock(report_data->label_registry_mutex);
+        auto iter = report_data->debugUtilsQueueLabels.find(queue);
+        if (iter != report_data->debugUtilsQueueLabels.end()) {
+            return iter->second;
         }
-    } else {
-        label_state = iter->second.get();
+    }
+    // Add a label state if not present
+    std::unique_lock<std::shared_mutex> lock(report_data->label_registry_mutex);
+    auto &label_state = report_data->debugUtilsQueueLabels[queue];
+    if (!label_state) {
+        label_state = std::make_shared<LoggingLabelState>();
     }
     return label_state;
 }
 
 static inline void BeginQueueDebugUtilsLabel(debug_report_data *report_data, VkQueue queue,
                                              const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
     if (nullptr != label_info && nullptr != label_info->pLabelName) {
-        auto *label_state = GetLoggingLabelState(&report_data->debugUtilsQueueLabels, queue, /* insert */ true);
-        assert(label_state);
-        label_state->labels.emplace_back(label_info);
-
-        // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
-        label_state->insert_label.Reset();
+        GetQueueLoggingLabelState(report_data, queue)->Begin(label_info);
     }
 }
 
 static inline void EndQueueDebugUtilsLabel(debug_report_data *report_data, VkQueue queue) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    auto *label_state = GetLoggingLabelState(&report_data->debugUtilsQueueLabels, queue, /* insert */ false);
-    if (label_state) {
-        // Pop the normal item
-        if (!label_state->labels.empty()) {
-            label_state->labels.pop_back();
-        }
-
-        // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
-        label_state->insert_label.Reset();
-    }
+    GetQueueLoggingLabelState(report_data, queue)->End();
 }
 
 static inline void InsertQueueDebugUtilsLabel(debug_report_data *report_data, VkQueue queue,
                                               const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    auto *label_state = GetLoggingLabelState(&report_data->debugUtilsQueueLabels, queue, /* insert */ true);
-
-    // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
-    label_state->insert_label = LoggingLabel(label_info);
+    GetQueueLoggingLabelState(report_data, queue)->Insert(label_info);
 }
 
-static inline void BeginCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer,
-                                           const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    if (nullptr != label_info && nullptr != label_info->pLabelName) {
-        auto *label_state = GetLoggingLabelState(&report_data->debugUtilsCmdBufLabels, command_buffer, /* insert */ true);
-        assert(label_state);
-        label_state->labels.push_back(LoggingLabel(label_info));
-
-        // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
-        label_state->insert_label.Reset();
-    }
+// The label stack of a command buffer lives as long as its vvl::CommandBuffer, which labels it directly
+static inline void RegisterCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer,
+                                              std::shared_ptr<LoggingLabelState> label_state) {
+    std::unique_lock<std::shared_mutex> lock(report_data->label_registry_mutex);
+    report_data->debugUtilsCmdBufLabels[command_buffer] = std::move(label_state);
 }
 
-static inline void EndCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    auto *label_state = GetLoggingLabelState(&report_data->debugUtilsCmdBufLabels, command_buffer, /* insert */ false);
-    if (label_state) {
-        // Pop the normal item
-        if (!label_state->labels.empty()) {
-            label_state->labels.pop_back();
-        }
-
-        // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
-        label_state->insert_label.Reset();
-    }
-}
-
-static inline void InsertCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer,
-                                            const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    auto *label_state = GetLoggingLabelState(&report_data->debugUtilsCmdBufLabels, command_buffer, /* insert */ true);
-    assert(label_state);
-
-    // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
-    label_state->insert_label = LoggingLabel(label_info);
-}
-
-// Current tracking beyond a single command buffer scope is incorrect, and even when it is we need to be able to clean up
-static inline void ResetCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    auto *label_state = GetLoggingLabelState(&report_data->debugUtilsCmdBufLabels, command_buffer, /* insert */ false);
-    if (label_state) {
-        label_state->labels.clear();
-        label_state->insert_label.Reset();
+// Only erases label_state, the handle may already be registered again by a new command buffer
+static inline void EraseCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer,
+                                           const LoggingLabelState *label_state) {
+    std::unique_lock<std::shared_mutex> lock(report_data->label_registry_mutex);
+    auto iter = report_data->debugUtilsCmdBufLabels.find(command_buffer);
+    if (iter != report_data->debugUtilsCmdBufLabels.end() && iter->second.get() == label_state) {
+        report_data->debugUtilsCmdBufLabels.erase(iter);
     }
 }
-
-static inline void EraseCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    report_data->debugUtilsCmdBufLabels.erase(command_buffer);
-}
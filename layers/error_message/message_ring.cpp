@@ -0,0 +1,115 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "error_message/message_ring.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(MessageRing::Header) == 32, "The message ring layout is shared with read_message_ring.py");
+
+std::unique_ptr<MessageRing> MessageRing::Open(const char *filename, size_t capacity) {
+    if (capacity == 0) {
+        return nullptr;
+    }
+    std::unique_ptr<MessageRing> ring(new MessageRing());
+    ring->mapped_size_ = sizeof(Header) + capacity;
+    void *mapping = nullptr;
+#if defined(_WIN32)
+    ring->file_ = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (ring->file_ == INVALID_HANDLE_VALUE) {
+        ring->file_ = nullptr;
+        return nullptr;
+    }
+    const uint64_t size = ring->mapped_size_;
+    ring->mapping_ = CreateFileMappingA(ring->file_, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32),
+                                        static_cast<DWORD>(size), nullptr);
+    if (!ring->mapping_) {
+        return nullptr;
+    }
+    mapping = MapViewOfFile(ring->mapping_, FILE_MAP_WRITE, 0, 0, ring->mapped_size_);
+    if (!mapping) {
+        return nullptr;
+    }
+#else
+    ring->fd_ = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (ring->fd_ < 0 || ftruncate(ring->fd_, static_cast<off_t>(ring->mapped_size_)) != 0) {
+        return nullptr;
+    }
+    mapping = mmap(nullptr, ring->mapped_size_, PROT_READ | PROT_WRITE, MAP_SHARED, ring->fd_, 0);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+#endif
+    ring->header_ = static_cast<Header *>(mapping);
+    ring->data_ = static_cast<uint8_t *>(mapping) + sizeof(Header);
+    // The file is zero filled, the magic is written last so that a reader never sees a half written header
+    ring->header_->format_version = kFormatVersion;
+    ring->header_->capacity = capacity;
+    std::memcpy(ring->header_->magic, kMagic, sizeof(kMagic));
+    return ring;
+}
+
+MessageRing::~MessageRing() {
+#if defined(_WIN32)
+    if (header_) {
+        UnmapViewOfFile(header_);
+    }
+    if (mapping_) {
+        CloseHandle(mapping_);
+    }
+    if (file_) {
+        CloseHandle(file_);
+    }
+#else
+    if (header_) {
+        munmap(header_, mapped_size_);
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+#endif
+}
+
+void MessageRing::Write(std::string_view message) {
+    std::lock_guard<std::mutex> lock(lock_);
+    const size_t capacity = static_cast<size_t>(header_->capacity);
+    // One byte is left for the separator
+    if (message.size() >= capacity) {
+        message.remove_prefix(message.size() - (capacity - 1));
+    }
+    const uint64_t written = header_->written;
+    size_t position = static_cast<size_t>(written % capacity);
+    auto Copy = [this, capacity, &position](const void *bytes, size_t size) {
+        const size_t first = std::min(size, capacity - position);
+        std::memcpy(data_ + position, bytes, first);
+        std::memcpy(data_, static_cast<const uint8_t *>(bytes) + first, size - first);
+        position = (position + size) % capacity;
+    };
+    Copy("", 1);
+    Copy(message.data(), message.size());
+    header_->written = written + message.size() + 1;
+}
@@ -0,0 +1,69 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+// With VK_DBG_LAYER_ACTION_LOG_RING, the text of every reported message is copied into a memory mapped file of a fixed size,
+// overwriting the oldest messages once it is full. Nothing is flushed: the pages of a shared mapping belong to the system,
+// so the last messages survive the process crashing or being killed on a device loss, for the cost of a memcpy each.
+// scripts/read_message_ring.py prints them back in order.
+//
+//   Header
+//   uint8_t data[Header::capacity]: byte Header::written % capacity is the next one written. Each message is preceded by a
+//   null byte, so the text before the first null byte of the ring is the end of a message partly overwritten.
+class MessageRing {
+  public:
+    static constexpr char kMagic[8] = {'V', 'V', 'L', 'R', 'I', 'N', 'G', '\0'};
+    static constexpr uint32_t kFormatVersion = 1;
+
+    struct Header {
+        char magic[8];
+        uint32_t format_version;
+        uint32_t reserved;
+        uint64_t capacity;
+        // Total number of bytes ever written, only updated once the message bytes are in place
+        uint64_t written;
+    };
+
+    // nullptr if the file can't be created or mapped
+    static std::unique_ptr<MessageRing> Open(const char *filename, size_t capacity);
+    MessageRing(const MessageRing &) = delete;
+    MessageRing &operator=(const MessageRing &) = delete;
+    ~MessageRing();
+
+    // Only the end of a message that doesn't fit in the ring with its null byte is kept
+    void Write(std::string_view message);
+
+  private:
+    MessageRing() = default;
+
+    std::mutex lock_;
+    Header *header_ = nullptr;
+    uint8_t *data_ = nullptr;
+    size_t mapped_size_ = 0;
+#if defined(_WIN32)
+    void *file_ = nullptr;
+    void *mapping_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+};
@@ -59,10 +59,13 @@ layout(push_constant) uniform UniformInfo {
 } u_info;
 
 
+// One vertex is drawn for each indirect draw, so the draws are checked in parallel instead of looping in a single
+// invocation. The count buffer is only read once, by the first vertex.
 void main() {
-    if (gl_VertexIndex == 0) {
-        if (u_info.validation_select == pre_draw_select_count_buffer ||
-            u_info.validation_select == pre_draw_select_mesh_count_buffer) {
+    const uint draw_index = uint(gl_VertexIndex);
+    if (u_info.validation_select == pre_draw_select_count_buffer ||
+        u_info.validation_select == pre_draw_select_mesh_count_buffer) {
+        if (draw_index == 0) {
             // Validate count buffer
             uint count_in = count_buffer[u_info.count_offset];
             if (count_in > u_info.max_writes) {
@@ -71,46 +74,41 @@ void main() {
             else if (count_in > u_info.count_limit) {
                 gpuavLogError(kInstErrorPreDrawValidate, pre_draw_count_exceeds_limit_error, count_in, 0);
             }
-        } else if (u_info.validation_select == pre_draw_select_draw_buffer) {
-            // Validate firstInstances
-            uint fi_index = u_info.first_instance_offset;
-            for (uint i = 0; i < u_info.draw_count; i++) {
-                if (draws_buffer[fi_index] != 0) {
-                    gpuavLogError(kInstErrorPreDrawValidate, pre_draw_first_instance_error, i, i);
-                    break;
-				}
-                fi_index += u_info.draw_stride;
+        }
+    } else if (u_info.validation_select == pre_draw_select_draw_buffer) {
+        // Validate firstInstance
+        if (draw_index < u_info.draw_count) {
+            uint fi_index = u_info.first_instance_offset + draw_index * u_info.draw_stride;
+            if (draws_buffer[fi_index] != 0) {
+                gpuavLogError(kInstErrorPreDrawValidate, pre_draw_first_instance_error, draw_index, draw_index);
             }
         }
+    }
 
-        if (u_info.validation_select == pre_draw_select_mesh_count_buffer ||
-            u_info.validation_select == pre_draw_select_mesh_no_count) {
-            // Validate mesh draw buffer
-            uint draw_buffer_index = u_info.mesh_draw_buffer_offset;
-            uint stride = u_info.mesh_draw_buffer_stride;
-            uint draw_count;
-            if (u_info.validation_select == pre_draw_select_mesh_count_buffer)
-                draw_count = count_buffer[u_info.count_offset];
-            else
-                draw_count = u_info.mesh_draw_buffer_num_draws;
-            for (uint i = 0; i < draw_count; i++){
-                uint count_x_in = draws_buffer[draw_buffer_index];
-                uint count_y_in = draws_buffer[draw_buffer_index + 1];
-                uint count_z_in = draws_buffer[draw_buffer_index + 2];
-                if (count_x_in > u_info.max_workgroup_count_x) {
-                    gpuavLogError(kInstErrorPreDrawValidate, pre_draw_group_count_exceeds_limit_x_error, count_x_in, i);
-                }
-                if (count_y_in > u_info.max_workgroup_count_y) {
-                    gpuavLogError(kInstErrorPreDrawValidate, pre_draw_group_count_exceeds_limit_y_error, count_y_in, i);
-                }
-                if (count_z_in > u_info.max_workgroup_count_z) {
-                    gpuavLogError(kInstErrorPreDrawValidate, pre_draw_group_count_exceeds_limit_z_error, count_z_in, i);
-                }
-                uint total = count_x_in * count_y_in * count_z_in;
-                if (total > u_info.max_workgroup_total_count) {
-                    gpuavLogError(kInstErrorPreDrawValidate, pre_draw_group_count_exceeds_total_error, total, i);
-                }
-                draw_buffer_index += stride;
+    if (u_info.validation_select == pre_draw_select_mesh_count_buffer ||
+        u_info.validation_select == pre_draw_select_mesh_no_count) {
+        // Validate mesh draw buffer, mesh_draw_buffer_num_draws is maxDrawCount for the count calls
+        uint draw_count = u_info.mesh_draw_buffer_num_draws;
+        if (u_info.validation_select == pre_draw_select_mesh_count_buffer) {
+            draw_count = min(count_buffer[u_info.count_offset], draw_count);
+        }
+        if (draw_index < draw_count) {
+            uint draw_buffer_index = u_info.mesh_draw_buffer_offset + draw_index * u_info.mesh_draw_buffer_stride;
+            uint count_x_in = draws_buffer[draw_buffer_index];
+            uint count_y_in = draws_buffer[draw_buffer_index + 1];
+            uint count_z_in = draws_buffer[draw_buffer_index + 2];
+            if (count_x_in > u_info.max_workgroup_count_x) {
+                gpuavLogError(kInstErrorPreDrawValidate, pre_draw_group_count_exceeds_limit_x_error, count_x_in, draw_index);
+            }
+            if (count_y_in > u_info.max_workgroup_count_y) {
+                gpuavLogError(kInstErrorPreDrawValidate, pre_draw_group_count_exceeds_limit_y_error, count_y_in, draw_index);
+            }
+            if (count_z_in > u_info.max_workgroup_count_z) {
+                gpuavLogError(kInstErrorPreDrawValidate, pre_draw_group_count_exceeds_limit_z_error, count_z_in, draw_index);
+            }
+            uint total = count_x_in * count_y_in * count_z_in;
+            if (total > u_info.max_workgroup_total_count) {
+                gpuavLogError(kInstErrorPreDrawValidate, pre_draw_group_count_exceeds_total_error, total, draw_index);
             }
         }
     }
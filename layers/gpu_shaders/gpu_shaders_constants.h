@@ -221,6 +221,11 @@ const int kDebugInputBuffAddrPtrOffset = 1;
 // The length associated with the 0xffffffffffffffff address is zero. If
 // not a valid buffer, the length associated with the 0x0 address is zero.
 const int kDebugInputBuffAddrLengthOffset = 0;
+//
+// The length data is followed by a single uint64 with the number of
+// addresses in the list, including the 0x0 and 0xffffffffffffffff ones:
+//
+// Data[ 2 * Data[ kDebugInputBuffAddrLengthOffset ] - 1 ]
 
 // These values all share the byte at (_kPreValidateSubError + 1) location since only
 // one will be used at a time. Also equivalent to (kInstStageOutCnt + 1)
@@ -239,6 +244,17 @@ const int pre_draw_group_count_exceeds_limit_y_error = 5;
 const int pre_draw_group_count_exceeds_limit_z_error = 6;
 const int pre_draw_group_count_exceeds_total_error = 7;
 
+// The instrumentation writes each (shader id, instruction, error code) once per submission. The buffer at binding 3 of the
+// instrumentation set holds, after the word set with every record, a table of kInstReportedErrorsSize hashes of the already
+// reported ones, each looked up in at most kInstReportedErrorsProbes consecutive slots.
+const uint kInstReportedErrorsSize = 64;
+const uint kInstReportedErrorsProbes = 4;
+
+// gpu_as_inspection.comp checks one instance per invocation. Its dispatch is split in rows of at most
+// kAsInspectionMaxWorkgroupsX workgroups, the minimum maxComputeWorkGroupCount[0], for large instance counts.
+const uint kAsInspectionWorkgroupSize = 64;
+const uint kAsInspectionMaxWorkgroupsX = 65535;
+
 // These values select which pre-draw validation will be performed
 const int pre_draw_select_count_buffer = 1;
 const int pre_draw_select_draw_buffer = 2;
@@ -66,14 +66,8 @@ void debug_printf::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo
         aborted = true;
         return;
     }
-}
 
-// Free the device memory and descriptor set associated with a command buffer.
-void debug_printf::Validator::DestroyBuffer(BufferInfo &buffer_info) {
-    vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
-    if (buffer_info.desc_set != VK_NULL_HANDLE) {
-        desc_set_manager->PutBackDescriptorSet(buffer_info.desc_pool, buffer_info.desc_set);
-    }
+    output_chunks.Init(vmaAllocator, VK_NULL_HANDLE, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, OutputChunkSize());
 }
 
 // Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
@@ -116,6 +110,9 @@ bool debug_printf::Validator::InstrumentShader(const vvl::span<const uint32_t> &
     const bool pass = optimizer.Run(new_pgm.data(), new_pgm.size(), &new_pgm, opt_options);
     if (!pass) {
         ReportSetupProblem(device, "Failure to instrument shader in spirv-opt. Proceeding with non-instrumented shader.");
+    } else {
+        // The records refer to the OpString ids of the original code, which is what shader_map keeps
+        format_strings_map.insert_or_assign(unique_shader_id, ParseFormatStrings(input));
     }
     return pass;
 }
@@ -147,10 +144,16 @@ void debug_printf::Validator::PreCallRecordCreateShadersEXT(VkDevice device, uin
     create_shader_object_api_state *csm_state = static_cast<create_shader_object_api_state *>(csm_state_data);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         csm_state->unique_shader_ids[i] = unique_shader_module_id++;
-        const bool pass = InstrumentShader(
+    }
+    // Not a vector<bool>, the workers write neighbouring elements
+    std::vector<uint8_t> passed(createInfoCount, 0);
+    ParallelInstrument(createInfoCount, [&](size_t i) {
+        passed[i] = InstrumentShader(
             vvl::make_span(static_cast<const uint32_t *>(pCreateInfos[i].pCode), pCreateInfos[i].codeSize / sizeof(uint32_t)),
             csm_state->instrumented_spirv[i], csm_state->unique_shader_ids[i], record_obj.location);
-        if (pass) {
+    });
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        if (passed[i]) {
             csm_state->instrumented_create_info[i].pCode = csm_state->instrumented_spirv[i].data();
             csm_state->instrumented_create_info[i].codeSize = csm_state->instrumented_spirv[i].size() * sizeof(uint32_t);
         }
@@ -256,24 +259,50 @@ std::vector<debug_printf::Substring> debug_printf::Validator::ParseFormatString(
             begin = pos + 1;
         }
     }
-    return parsed_strings;
-}
 
-std::string debug_printf::Validator::FindFormatString(vvl::span<const uint32_t> pgm, uint32_t string_id) {
-    std::string format_string;
-    spirv::Module module_state(pgm);
-    if (module_state.words_.empty()) {
-        return {};
+    // Rewrite the 64 bit specifiers once here instead of for every value printed with them
+    for (auto &substring : parsed_strings) {
+        for (const char *ul_string : {"%ul", "%lu", "%lx"}) {
+            const size_t ul_pos = substring.string.find(ul_string);
+            if (ul_pos != std::string::npos) {
+                substring.string.replace(ul_pos + 1, 2, (ul_string[2] == 'u') ? PRIu64 : PRIx64);
+                substring.is_64_bit = true;
+                break;
+            }
+        }
     }
+    return parsed_strings;
+}
 
-    for (const spirv::Instruction *insn : module_state.static_data_.debug_string_inst) {
-        if (insn->Word(1) == string_id) {
-            format_string = insn->GetAsString(2);
+std::shared_ptr<const debug_printf::FormatStrings> debug_printf::Validator::ParseFormatStrings(vvl::span<const uint32_t> pgm) {
+    // Only the OpString instructions are needed, which all come before the function definitions, so walk the words directly
+    // instead of building a full spirv::Module
+    auto format_strings = std::make_shared<FormatStrings>();
+    uint32_t offset = 5;  // skip the header
+    while (offset < pgm.size()) {
+        const spirv::Instruction insn(&pgm[offset]);
+        if (insn.Length() == 0 || offset + insn.Length() > pgm.size() || insn.Opcode() == spv::OpFunction) {
             break;
         }
+        if (insn.Opcode() == spv::OpString) {
+            (*format_strings)[insn.Word(1)] = ParseFormatString(insn.GetAsString(2));
+        }
+        offset += insn.Length();
+    }
+    return format_strings;
+}
+
+std::shared_ptr<const debug_printf::FormatStrings> debug_printf::Validator::GetFormatStrings(uint32_t shader_id,
+                                                                                           vvl::span<const uint32_t> pgm) {
+    auto it = format_strings_map.find(shader_id);
+    if (it != format_strings_map.end()) {
+        return it->second;
     }
 
-    return format_string;
+    auto format_strings = ParseFormatStrings(pgm);
+    // If another thread built the same map first, either copy is fine to use
+    format_strings_map.insert(shader_id, format_strings);
+    return format_strings;
 }
 
 // GCC and clang don't like using variables as format strings in sprintf.
@@ -299,8 +328,14 @@ void debug_printf::Validator::AnalyzeAndGenerateMessages(VkCommandBuffer command
     // TODO - have Loc passed in correctly
     Location loc(vvl::Func::vkQueueSubmit);
 
+    // The instrumentation keeps adding to the size word when a record doesn't fit, so it holds the size that would have been
+    // needed, while only the records that fit were written
+    const uint32_t buffer_words = output_buffer_size / sizeof(uint32_t);
+    std::shared_ptr<const FormatStrings> format_strings;
+    uint32_t format_strings_shader_id = 0;
+
     uint32_t index = spvtools::kDebugOutputDataOffset;
-    while (debug_output_buffer[index]) {
+    while (index < buffer_words && debug_output_buffer[index]) {
         std::stringstream shader_message;
         VkShaderModule shader_module_handle = VK_NULL_HANDLE;
         VkPipeline pipeline_handle = VK_NULL_HANDLE;
@@ -308,6 +343,9 @@ void debug_printf::Validator::AnalyzeAndGenerateMessages(VkCommandBuffer command
         vvl::span<const uint32_t> pgm;
 
         OutputRecord *debug_record = reinterpret_cast<OutputRecord *>(&debug_output_buffer[index]);
+        if (debug_record->size > buffer_words - index) {
+            break;
+        }
         // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
         // by the instrumented shader.
         auto it = shader_map.find(debug_record->shader_id);
@@ -318,38 +356,29 @@ void debug_printf::Validator::AnalyzeAndGenerateMessages(VkCommandBuffer command
             pgm = it->second.pgm;
         }
         assert(pgm.size() != 0);
-        // Search through the shader source for the printf format string for this invocation
-        const auto format_string = FindFormatString(pgm, debug_record->format_string_id);
-        // Break the format string into strings with 1 or 0 value
-        auto format_substrings = ParseFormatString(format_string);
+        // Records of the same shader usually come in runs, only go back to the map when the shader changes
+        if (!format_strings || format_strings_shader_id != debug_record->shader_id) {
+            format_strings = GetFormatStrings(debug_record->shader_id, pgm);
+            format_strings_shader_id = debug_record->shader_id;
+        }
+        // The format string for this invocation, already broken into strings with 1 or 0 value
+        static const std::vector<Substring> no_substrings;
+        auto format_it = format_strings->find(debug_record->format_string_id);
+        const std::vector<Substring> &format_substrings =
+            (format_it != format_strings->end()) ? format_it->second : no_substrings;
         void *values = static_cast<void *>(&debug_record->values);
         // Sprintf each format substring into a temporary string then add that to the message
-        for (auto &substring : format_substrings) {
+        for (const auto &substring : format_substrings) {
             std::string temp_string;
             size_t needed = 0;
-            std::vector<std::string> format_strings = {"%ul", "%lu", "%lx"};
-            size_t ul_pos = 0;
-            bool print_hex = true;
-            for (const auto &ul_string : format_strings) {
-                ul_pos = substring.string.find(ul_string);
-                if (ul_pos != std::string::npos) {
-                    if (ul_string == "%lu") print_hex = false;
-                    break;
-                }
-            }
-            if (ul_pos != std::string::npos) {
+            if (substring.is_64_bit) {
                 // Unsigned 64 bit value
-                substring.longval = *static_cast<uint64_t *>(values);
+                const uint64_t longval = *static_cast<uint64_t *>(values);
                 values = static_cast<uint64_t *>(values) + 1;
-                if (print_hex) {
-                    substring.string.replace(ul_pos + 1, 2, PRIx64);
-                } else {
-                    substring.string.replace(ul_pos + 1, 2, PRIu64);
-                }
                 // +1 for null terminator
-                needed = std::snprintf(nullptr, 0, substring.string.c_str(), substring.longval) + 1;
+                needed = std::snprintf(nullptr, 0, substring.string.c_str(), longval) + 1;
                 temp_string.resize(needed);
-                std::snprintf(&temp_string[0], needed, substring.string.c_str(), substring.longval);
+                std::snprintf(&temp_string[0], needed, substring.string.c_str(), longval);
             } else {
                 if (substring.needs_value) {
                     switch (substring.type) {
@@ -407,10 +436,17 @@ void debug_printf::Validator::AnalyzeAndGenerateMessages(VkCommandBuffer command
         index += debug_record->size;
     }
     if ((index - spvtools::kDebugOutputDataOffset) != expect) {
+        const uint64_t needed_bytes = sizeof(uint32_t) * (uint64_t(expect) + spvtools::kDebugOutputDataOffset);
         LogWarning("WARNING-DEBUG-PRINTF", device, loc,
-                   "WARNING - Debug Printf message was truncated, likely due to a buffer size that was too small for the message");
+                   "WARNING - Debug Printf message was truncated, likely due to a buffer size that was too small for the message. "
+                   "Only %" PRIu32 " of %" PRIu32 " bytes of output fit, set printf_buffer_size to at least %" PRIu64
+                   " to see all of it.",
+                   static_cast<uint32_t>(sizeof(uint32_t) * (index - spvtools::kDebugOutputDataOffset)),
+                   static_cast<uint32_t>(sizeof(uint32_t) * expect), needed_bytes);
     }
-    memset(debug_output_buffer, 0, 4 * (debug_output_buffer[spvtools::kDebugOutputSizeOffset] + spvtools::kDebugOutputDataOffset));
+    // The size word can be larger than the buffer after a truncation, only clear what was mapped
+    const uint32_t words_to_clear = std::min(expect + spvtools::kDebugOutputDataOffset, buffer_words);
+    memset(debug_output_buffer, 0, sizeof(uint32_t) * words_to_clear);
 }
 
 // For the given command buffer, map its debug data buffers and read their contents for analysis.
@@ -423,8 +459,6 @@ void debug_printf::CommandBuffer::Process(VkQueue queue, const Location &loc) {
         uint32_t ray_trace_index = 0;
 
         for (auto &buffer_info : gpu_buffer_list) {
-            char *data;
-
             uint32_t operation_index = 0;
             if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 operation_index = draw_index;
@@ -439,11 +473,8 @@ void debug_printf::CommandBuffer::Process(VkQueue queue, const Location &loc) {
                 assert(false);
             }
 
-            VkResult result = vmaMapMemory(device_state->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&data);
-            if (result == VK_SUCCESS) {
-                device_state->AnalyzeAndGenerateMessages(commandBuffer(), queue, buffer_info, operation_index, (uint32_t *)data);
-                vmaUnmapMemory(device_state->vmaAllocator, buffer_info.output_mem_block.allocation);
-            }
+            device_state->AnalyzeAndGenerateMessages(commandBuffer(), queue, buffer_info, operation_index,
+                                                     static_cast<uint32_t *>(buffer_info.output_range.mapped));
         }
     }
 }
@@ -638,26 +669,18 @@ void debug_printf::Validator::AllocateDebugPrintfResources(const VkCommandBuffer
         bind_point != VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR) {
         return;
     }
-    VkResult result;
-
     if (aborted) return;
 
-    std::vector<VkDescriptorSet> desc_sets;
-    VkDescriptorPool desc_pool = VK_NULL_HANDLE;
-    result = desc_set_manager->GetDescriptorSets(1, &desc_pool, debug_desc_layout, &desc_sets);
-    assert(result == VK_SUCCESS);
-    if (result != VK_SUCCESS) {
-        ReportSetupProblem(device, "Unable to allocate descriptor sets.  Device could become unstable.");
+    auto cb_node = GetWrite<debug_printf::CommandBuffer>(cmd_buffer);
+    if (!cb_node) {
+        ReportSetupProblem(device, "Unrecognized command buffer");
         aborted = true;
         return;
     }
 
-    VkDescriptorBufferInfo output_desc_buffer_info = {};
-    output_desc_buffer_info.range = output_buffer_size;
-
-    auto cb_node = GetWrite<debug_printf::CommandBuffer>(cmd_buffer);
-    if (!cb_node) {
-        ReportSetupProblem(device, "Unrecognized command buffer");
+    const VkDescriptorSet desc_set = cb_node->instrumentation_desc_sets.Get();
+    if (desc_set == VK_NULL_HANDLE) {
+        ReportSetupProblem(device, "Unable to allocate descriptor sets.  Device could become unstable.");
         aborted = true;
         return;
     }
@@ -672,41 +695,24 @@ void debug_printf::Validator::AllocateDebugPrintfResources(const VkCommandBuffer
         return;
     }
 
-    // Allocate memory for the output block that the gpu will use to return values for printf
-    DeviceMemoryBlock output_block = {};
-    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-    buffer_info.size = output_buffer_size;
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &output_block.buffer, &output_block.allocation, nullptr);
-    if (result != VK_SUCCESS) {
+    // Sub allocate the output block that the gpu will use to return values for printf
+    gpu_tracker::BufferRange output_range;
+    if (!cb_node->output_arena.Allocate(output_buffer_size, phys_dev_props.limits.minStorageBufferOffsetAlignment,
+                                        output_range)) {
         ReportSetupProblem(device, "Unable to allocate device memory.  Device could become unstable.");
         aborted = true;
         return;
     }
 
     // Clear the output block to zeros so that only printf values from the gpu will be present
-    uint32_t *data;
-    result = vmaMapMemory(vmaAllocator, output_block.allocation, reinterpret_cast<void **>(&data));
-    if (result == VK_SUCCESS) {
-        memset(data, 0, output_buffer_size);
-        vmaUnmapMemory(vmaAllocator, output_block.allocation);
-    }
+    memset(output_range.mapped, 0, output_buffer_size);
 
-    VkWriteDescriptorSet desc_writes = vku::InitStructHelper();
-    const uint32_t desc_count = 1;
-
-    // Write the descriptor
-    output_desc_buffer_info.buffer = output_block.buffer;
-    output_desc_buffer_info.offset = 0;
-
-    desc_writes.descriptorCount = 1;
-    desc_writes.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    desc_writes.pBufferInfo = &output_desc_buffer_info;
-    desc_writes.dstSet = desc_sets[0];
-    desc_writes.dstBinding = 3;
-    DispatchUpdateDescriptorSets(device, desc_count, &desc_writes, 0, NULL);
+    // Write the descriptor, unless the set already holds it from a previous recording of the command buffer
+    std::array<VkDescriptorBufferInfo, gpu_tracker::DescriptorSetCache::kMaxBindings> desc_buffer_infos = {};
+    desc_buffer_infos[3].buffer = output_range.buffer;
+    desc_buffer_infos[3].offset = output_range.offset;
+    desc_buffer_infos[3].range = output_buffer_size;
+    cb_node->instrumentation_desc_sets.WriteStorageBuffers(device, desc_buffer_infos);
 
     const auto pipeline_layout =
         pipeline_state ? pipeline_state->PipelineLayoutState() : Get<vvl::PipelineLayout>(last_bound.pipeline_layout);
@@ -719,17 +725,17 @@ void debug_printf::Validator::AllocateDebugPrintfResources(const VkCommandBuffer
         const auto pipeline_layout_handle =
             (last_bound.pipeline_layout) ? last_bound.pipeline_layout : pipeline_state->PreRasterPipelineLayoutState()->layout();
         if (pipeline_layout->set_layouts.size() <= desc_set_bind_index) {
-            DispatchCmdBindDescriptorSets(cmd_buffer, bind_point, pipeline_layout_handle, desc_set_bind_index, 1, desc_sets.data(),
-                                          0, nullptr);
+            DispatchCmdBindDescriptorSets(cmd_buffer, bind_point, pipeline_layout_handle, desc_set_bind_index, 1, &desc_set, 0,
+                                          nullptr);
         }
     } else {
         // If no pipeline layout was bound when using shader objects that don't use any descriptor set, bind the debug pipeline
         // layout
-        DispatchCmdBindDescriptorSets(cmd_buffer, bind_point, debug_pipeline_layout, desc_set_bind_index, 1, desc_sets.data(), 0,
+        DispatchCmdBindDescriptorSets(cmd_buffer, bind_point, debug_pipeline_layout, desc_set_bind_index, 1, &desc_set, 0,
                                       nullptr);
     }
     // Record buffer and memory info in CB state tracking
-    cb_node->buffer_infos.emplace_back(output_block, desc_sets[0], desc_pool, bind_point);
+    cb_node->buffer_infos.emplace_back(output_range, bind_point);
 }
 
 std::shared_ptr<vvl::CommandBuffer> debug_printf::Validator::CreateCmdBufferState(VkCommandBuffer cb,
@@ -746,6 +752,7 @@ debug_printf::CommandBuffer::~CommandBuffer() { Destroy(); }
 
 void debug_printf::CommandBuffer::Destroy() {
     ResetCBState();
+    instrumentation_desc_sets.Release();
     vvl::CommandBuffer::Destroy();
 }
 
@@ -755,13 +762,8 @@ void debug_printf::CommandBuffer::Reset() {
 }
 
 void debug_printf::CommandBuffer::ResetCBState() {
-    auto debug_printf = static_cast<debug_printf::Validator *>(dev_data);
-    // Free the device memory and descriptor set(s) associated with a command buffer.
-    if (debug_printf->aborted) {
-        return;
-    }
-    for (auto &buffer_info : buffer_infos) {
-        debug_printf->DestroyBuffer(buffer_info);
-    }
+    // Give back the output buffers, the descriptor sets are kept for the next recording
+    output_arena.Reset();
+    instrumentation_desc_sets.Reset();
     buffer_infos.clear();
 }
@@ -24,19 +24,11 @@ namespace debug_printf {
 
 class Validator;
 
-struct DeviceMemoryBlock {
-    VkBuffer buffer;
-    VmaAllocation allocation;
-};
-
 struct BufferInfo {
-    DeviceMemoryBlock output_mem_block;
-    VkDescriptorSet desc_set;
-    VkDescriptorPool desc_pool;
+    gpu_tracker::BufferRange output_range;  // in the output_arena of the command buffer
     VkPipelineBindPoint pipeline_bind_point;
-    BufferInfo(DeviceMemoryBlock output_mem_block, VkDescriptorSet desc_set, VkDescriptorPool desc_pool,
-               VkPipelineBindPoint pipeline_bind_point)
-        : output_mem_block(output_mem_block), desc_set(desc_set), desc_pool(desc_pool), pipeline_bind_point(pipeline_bind_point){};
+    BufferInfo(const gpu_tracker::BufferRange &output_range, VkPipelineBindPoint pipeline_bind_point)
+        : output_range(output_range), pipeline_bind_point(pipeline_bind_point){};
 };
 
 enum vartype { varsigned, varunsigned, varfloat };
@@ -44,7 +36,7 @@ struct Substring {
     std::string string;
     bool needs_value;
     vartype type;
-    uint64_t longval = 0;
+    bool is_64_bit = false;  // %ul, %lu or %lx, already rewritten to the matching PRI*64 macro
 };
 
 struct OutputRecord {
@@ -55,6 +47,10 @@ struct OutputRecord {
     uint32_t values;
 };
 
+// The printf format strings of one instrumented shader, keyed by the OpString id the instrumentation writes into the record,
+// already broken into substrings by ParseFormatString.
+using FormatStrings = vvl::unordered_map<uint32_t, std::vector<Substring>>;
+
 class CommandBuffer : public gpu_tracker::CommandBuffer {
   public:
     std::vector<BufferInfo> buffer_infos;
@@ -96,7 +92,8 @@ class Validator : public gpu_tracker::Validator {
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, void* csm_state_data) override;
     std::vector<Substring> ParseFormatString(const std::string& format_string);
-    std::string FindFormatString(vvl::span<const uint32_t> pgm, uint32_t string_id);
+    std::shared_ptr<const FormatStrings> ParseFormatStrings(vvl::span<const uint32_t> pgm);
+    std::shared_ptr<const FormatStrings> GetFormatStrings(uint32_t shader_id, vvl::span<const uint32_t> pgm);
     void AnalyzeAndGenerateMessages(VkCommandBuffer command_buffer, VkQueue queue, BufferInfo& buffer_info,
                                     uint32_t operation_index, uint32_t* const debug_output_buffer);
     void PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
@@ -180,10 +177,12 @@ class Validator : public gpu_tracker::Validator {
     std::shared_ptr<vvl::CommandBuffer> CreateCmdBufferState(VkCommandBuffer cb, const VkCommandBufferAllocateInfo* create_info,
                                                              const vvl::CommandPool* pool) final;
 
-    void DestroyBuffer(BufferInfo& buffer_info);
 
   private:
     bool verbose = false;
     bool use_stdout = false;
+    // Filled when a shader is instrumented (or the first time its output is read back, for shaders that were not), so each
+    // record is a lookup instead of a parse of the SPIR-V and its format string
+    vl_concurrent_unordered_map<uint32_t, std::shared_ptr<const FormatStrings>> format_strings_map;
 };
 }  // namespace debug_printf
@@ -0,0 +1,96 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_validation/gpu_buffer_pool.h"
+
+#include <cassert>
+
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+void gpu_tracker::BufferChunkPool::Init(VmaAllocator allocator, VmaPool pool, VkBufferUsageFlags usage, VkDeviceSize chunk_size) {
+    allocator_ = allocator;
+    pool_ = pool;
+    usage_ = usage;
+    chunk_size_ = chunk_size;
+}
+
+void gpu_tracker::BufferChunkPool::Destroy() {
+    std::lock_guard<std::mutex> lock(lock_);
+    for (auto &chunk : free_chunks_) {
+        vmaDestroyBuffer(allocator_, chunk.buffer, chunk.allocation);
+    }
+    free_chunks_.clear();
+}
+
+bool gpu_tracker::BufferChunkPool::Acquire(Chunk &chunk) {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (!free_chunks_.empty()) {
+            chunk = free_chunks_.back();
+            free_chunks_.pop_back();
+            return true;
+        }
+    }
+
+    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+    buffer_info.size = chunk_size_;
+    buffer_info.usage = usage_;
+    VmaAllocationCreateInfo alloc_info = {};
+    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    alloc_info.flags = VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    alloc_info.pool = pool_;
+    VmaAllocationInfo allocation_info = {};
+    VkResult result = vmaCreateBuffer(allocator_, &buffer_info, &alloc_info, &chunk.buffer, &chunk.allocation, &allocation_info);
+    if (result != VK_SUCCESS) {
+        return false;
+    }
+    chunk.mapped = static_cast<uint8_t *>(allocation_info.pMappedData);
+    return true;
+}
+
+void gpu_tracker::BufferChunkPool::Release(std::vector<Chunk> &chunks) {
+    std::lock_guard<std::mutex> lock(lock_);
+    free_chunks_.insert(free_chunks_.end(), chunks.begin(), chunks.end());
+    chunks.clear();
+}
+
+bool gpu_tracker::BufferArena::Allocate(VkDeviceSize size, VkDeviceSize alignment, BufferRange &range) {
+    assert(size <= pool_.ChunkSize());
+    VkDeviceSize offset = alignment > 1 ? ((used_ + alignment - 1) / alignment) * alignment : used_;
+    if (chunks_.empty() || offset + size > pool_.ChunkSize()) {
+        BufferChunkPool::Chunk chunk;
+        if (!pool_.Acquire(chunk)) {
+            return false;
+        }
+        chunks_.emplace_back(chunk);
+        offset = 0;
+    }
+    used_ = offset + size;
+
+    const auto &chunk = chunks_.back();
+    range.buffer = chunk.buffer;
+    range.offset = offset;
+    range.mapped = chunk.mapped + offset;
+    return true;
+}
+
+void gpu_tracker::BufferArena::Reset() {
+    if (!chunks_.empty()) {
+        pool_.Release(chunks_);
+    }
+    used_ = 0;
+}
@@ -0,0 +1,83 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "vma/vma.h"
+
+namespace gpu_tracker {
+
+// Host visible, persistently mapped buffers all of the same size, kept for reuse instead of being destroyed.
+// Command buffers recorded on different threads take chunks from the same pool, so it is thread safe.
+class BufferChunkPool {
+  public:
+    struct Chunk {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VmaAllocation allocation = VK_NULL_HANDLE;
+        uint8_t *mapped = nullptr;
+    };
+
+    // pool can be VK_NULL_HANDLE to use the default VMA pools
+    void Init(VmaAllocator allocator, VmaPool pool, VkBufferUsageFlags usage, VkDeviceSize chunk_size);
+    // Only destroys the free chunks, the ones still owned by a BufferArena must have been released before
+    void Destroy();
+
+    bool Acquire(Chunk &chunk);
+    void Release(std::vector<Chunk> &chunks);
+
+    VkDeviceSize ChunkSize() const { return chunk_size_; }
+
+  private:
+    VmaAllocator allocator_ = VK_NULL_HANDLE;
+    VmaPool pool_ = VK_NULL_HANDLE;
+    VkBufferUsageFlags usage_ = 0;
+    VkDeviceSize chunk_size_ = 0;
+    std::mutex lock_;
+    std::vector<Chunk> free_chunks_;
+};
+
+struct BufferRange {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    void *mapped = nullptr;  // already offset
+};
+
+// Linear sub allocator over the chunks of a BufferChunkPool, owned by one command buffer.
+// Everything is handed back at once when the command buffer is reset or destroyed, which the application can only do once
+// the GPU is done with it, and after its output was read back (see ResultReadback).
+class BufferArena {
+  public:
+    explicit BufferArena(BufferChunkPool &pool) : pool_(pool) {}
+    BufferArena(const BufferArena &) = delete;
+    BufferArena &operator=(const BufferArena &) = delete;
+    ~BufferArena() { Reset(); }
+
+    // size can't be more than the chunk size of the pool
+    bool Allocate(VkDeviceSize size, VkDeviceSize alignment, BufferRange &range);
+    void Reset();
+
+    size_t ChunkCount() const { return chunks_.size(); }
+
+  private:
+    BufferChunkPool &pool_;
+    std::vector<BufferChunkPool::Chunk> chunks_;
+    VkDeviceSize used_ = 0;  // bytes used in chunks_.back()
+};
+
+}  // namespace gpu_tracker
@@ -273,6 +273,37 @@ template <>
 void FillBindingInData(const vvl::InlineUniformBinding &binding, glsl::DescriptorState *data, uint32_t &index) {
     data[index++] = glsl::DescriptorState(DescriptorClass::InlineUniform, glsl::kDebugInputBindlessSkipId, vvl::kU32Max);
 }
+
+static void FillInData(const vvl::DescriptorBinding &binding, glsl::DescriptorState *data, uint32_t &index) {
+    switch (binding.descriptor_class) {
+        case DescriptorClass::InlineUniform:
+            FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(binding), data, index);
+            break;
+        case DescriptorClass::GeneralBuffer:
+            FillBindingInData(static_cast<const vvl::BufferBinding &>(binding), data, index);
+            break;
+        case DescriptorClass::TexelBuffer:
+            FillBindingInData(static_cast<const vvl::TexelBinding &>(binding), data, index);
+            break;
+        case DescriptorClass::Mutable:
+            FillBindingInData(static_cast<const vvl::MutableBinding &>(binding), data, index);
+            break;
+        case DescriptorClass::PlainSampler:
+            FillBindingInData(static_cast<const vvl::SamplerBinding &>(binding), data, index);
+            break;
+        case DescriptorClass::ImageSampler:
+            FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(binding), data, index);
+            break;
+        case DescriptorClass::Image:
+            FillBindingInData(static_cast<const vvl::ImageBinding &>(binding), data, index);
+            break;
+        case DescriptorClass::AccelerationStructure:
+            FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(binding), data, index);
+            break;
+        default:
+            assert(false);
+    }
+}
 }  // namespace gpuav
 
 std::shared_ptr<gpuav::DescriptorSet::State> gpuav::DescriptorSet::GetCurrentState() {
@@ -282,9 +313,60 @@ std::shared_ptr<gpuav::DescriptorSet::State> gpuav::DescriptorSet::GetCurrentSta
     if (last_used_state_ && last_used_state_->version == cur_version) {
         return last_used_state_;
     }
+    // Read before the descriptors, so that an update racing with this one is written again next time
+    const uint64_t change_count = GetChangeCount();
+
+    // Descriptors only change through updates, which stamp the bindings they write with the change count of the set. A state
+    // that no command buffer holds anymore is brought up to date in place, only rewriting the bindings changed since it was
+    // written. A set updated between submissions alternates between its two newest states, while the GPU reads the other one.
+    std::shared_ptr<State> reused_state;
+    if (last_used_state_ && last_used_state_->allocation && last_used_state_.use_count() == 1) {
+        reused_state = last_used_state_;
+    } else if (spare_state_ && spare_state_.use_count() == 1) {
+        reused_state = spare_state_;
+    }
+    if (reused_state) {
+        glsl::DescriptorState *data{nullptr};
+        VkResult result = vmaMapMemory(reused_state->allocator, reused_state->allocation, reinterpret_cast<void **>(&data));
+        assert(result == VK_SUCCESS);
+        uint32_t index = 0;
+        uint32_t first_written = vvl::kU32Max;
+        uint32_t end_written = 0;
+        for (uint32_t i = 0; i < bindings_.size(); i++) {
+            const auto &binding = *bindings_[i];
+            const uint32_t binding_end =
+                index + ((binding.type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) ? 1 : binding.count);
+            if (binding.change_count > reused_state->change_count) {
+                first_written = std::min(first_written, index);
+                end_written = binding_end;
+                FillInData(binding, data, index);
+                assert(index == binding_end);
+            }
+            index = binding_end;
+        }
+        if (first_written < end_written) {
+            const VkDeviceSize offset = first_written * sizeof(glsl::DescriptorState);
+            const VkDeviceSize size = (end_written - first_written) * sizeof(glsl::DescriptorState);
+            result = vmaFlushAllocation(reused_state->allocator, reused_state->allocation, offset, size);
+            assert(result == VK_SUCCESS);
+            gv_dev->descriptor_state_stats.incremental_uploads++;
+            gv_dev->descriptor_state_stats.incremental_bytes += size;
+        }
+        vmaUnmapMemory(reused_state->allocator, reused_state->allocation);
+
+        reused_state->version = cur_version;
+        reused_state->change_count = change_count;
+        if (reused_state != last_used_state_) {
+            spare_state_ = std::move(last_used_state_);
+            last_used_state_ = reused_state;
+        }
+        return reused_state;
+    }
+
     auto next_state = std::make_shared<State>();
     next_state->set = VkHandle();
     next_state->version = cur_version;
+    next_state->change_count = change_count;
     next_state->allocator = gv_dev->vmaAllocator;
 
     uint32_t descriptor_count = 0;  // Number of descriptors, including all array elements
@@ -323,35 +405,7 @@ std::shared_ptr<gpuav::DescriptorSet::State> gpuav::DescriptorSet::GetCurrentSta
     assert(result == VK_SUCCESS);
     uint32_t index = 0;
     for (uint32_t i = 0; i < bindings_.size(); i++) {
-        const auto &binding = *bindings_[i];
-        switch (binding.descriptor_class) {
-            case DescriptorClass::InlineUniform:
-                FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::GeneralBuffer:
-                FillBindingInData(static_cast<const vvl::BufferBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::TexelBuffer:
-                FillBindingInData(static_cast<const vvl::TexelBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::Mutable:
-                FillBindingInData(static_cast<const vvl::MutableBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::PlainSampler:
-                FillBindingInData(static_cast<const vvl::SamplerBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::ImageSampler:
-                FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::Image:
-                FillBindingInData(static_cast<const vvl::ImageBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::AccelerationStructure:
-                FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(binding), data, index);
-                break;
-            default:
-                assert(false);
-        }
+        FillInData(*bindings_[i], data, index);
     }
     VkBufferDeviceAddressInfo buffer_device_address_info = vku::InitStructHelper();
     buffer_device_address_info.buffer = next_state->buffer;
@@ -370,7 +424,12 @@ std::shared_ptr<gpuav::DescriptorSet::State> gpuav::DescriptorSet::GetCurrentSta
     // No good way to handle this error, we should still try to unmap.
     assert(result == VK_SUCCESS);
     vmaUnmapMemory(next_state->allocator, next_state->allocation);
+    gv_dev->descriptor_state_stats.full_uploads++;
+    gv_dev->descriptor_state_stats.full_bytes += buffer_info.size;
 
+    if (last_used_state_ && last_used_state_->allocation) {
+        spare_state_ = std::move(last_used_state_);
+    }
     last_used_state_ = next_state;
     return next_state;
 }
@@ -32,12 +32,16 @@ class DescriptorSet : public vvl::DescriptorSet {
                   const std::shared_ptr<vvl::DescriptorSetLayout const> &layout, uint32_t variable_count,
                   ValidationStateTracker *state_data);
     virtual ~DescriptorSet();
-    void Destroy() override { last_used_state_.reset(); };
+    void Destroy() override {
+        last_used_state_.reset();
+        spare_state_.reset();
+    };
     struct State {
         ~State();
 
         VkDescriptorSet set{VK_NULL_HANDLE};
         uint32_t version{0};
+        uint64_t change_count{0};  // GetChangeCount() of the set when the buffer was last written
         VmaAllocator allocator{nullptr};
         VmaAllocation allocation{nullptr};
         VkBuffer buffer{VK_NULL_HANDLE};
@@ -66,6 +70,8 @@ class DescriptorSet : public vvl::DescriptorSet {
     Layout layout_;
     std::atomic<uint32_t> current_version_{0};
     std::shared_ptr<State> last_used_state_;
+    // The state last_used_state_ replaced, brought up to date in place once no command buffer uses it anymore
+    std::shared_ptr<State> spare_state_;
     std::shared_ptr<State> output_state_;
     mutable std::mutex state_lock_;
 };
@@ -0,0 +1,82 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_validation/gpu_descriptor_set_cache.h"
+
+#include <cassert>
+
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+#include "gpu_validation/gpu_state_tracker.h"
+#include "generated/layer_chassis_dispatch.h"
+
+VkDescriptorSet gpu_tracker::DescriptorSetCache::Get() {
+    if (used_ == sets_.size()) {
+        if (!manager_) {
+            return VK_NULL_HANDLE;
+        }
+        std::vector<PooledDescriptorSet> new_sets;
+        if (manager_->GetDescriptorSets(kGrowCount, layout_, new_sets) != VK_SUCCESS) {
+            return VK_NULL_HANDLE;
+        }
+        for (const auto &pooled : new_sets) {
+            sets_.emplace_back(Entry{pooled, {}});
+        }
+    }
+    return sets_[used_++].pooled.set;
+}
+
+void gpu_tracker::DescriptorSetCache::WriteStorageBuffers(VkDevice device,
+                                                          const std::array<VkDescriptorBufferInfo, kMaxBindings> &infos) {
+    assert(used_ > 0);
+    Entry &entry = sets_[used_ - 1];
+    std::array<VkWriteDescriptorSet, kMaxBindings> desc_writes;
+    uint32_t desc_count = 0;
+    for (uint32_t binding = 0; binding < kMaxBindings; ++binding) {
+        const VkDescriptorBufferInfo &info = infos[binding];
+        VkDescriptorBufferInfo &written = entry.written[binding];
+        if (info.buffer == VK_NULL_HANDLE ||
+            (info.buffer == written.buffer && info.offset == written.offset && info.range == written.range)) {
+            continue;
+        }
+        written = info;
+
+        VkWriteDescriptorSet &desc_write = desc_writes[desc_count++];
+        desc_write = vku::InitStructHelper();
+        desc_write.dstSet = entry.pooled.set;
+        desc_write.dstBinding = binding;
+        desc_write.descriptorCount = 1;
+        desc_write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        desc_write.pBufferInfo = &info;
+    }
+    if (desc_count > 0) {
+        DispatchUpdateDescriptorSets(device, desc_count, desc_writes.data(), 0, nullptr);
+    }
+}
+
+void gpu_tracker::DescriptorSetCache::Release() {
+    if (!sets_.empty() && manager_) {
+        std::vector<PooledDescriptorSet> pooled_sets;
+        pooled_sets.reserve(sets_.size());
+        for (const auto &entry : sets_) {
+            pooled_sets.emplace_back(entry.pooled);
+        }
+        manager_->PutBackDescriptorSets(pooled_sets);
+    }
+    sets_.clear();
+    used_ = 0;
+}
@@ -0,0 +1,72 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace gpu_tracker {
+
+class DescriptorSetManager;
+
+struct PooledDescriptorSet {
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    VkDescriptorSet set = VK_NULL_HANDLE;
+};
+
+// Descriptor sets of one layout kept by a command buffer when it is reset, so recording it again doesn't go through the
+// DescriptorSetManager lock, and writes of what a set already holds are skipped.
+// Only the thread recording the command buffer uses it, so it is not thread safe.
+// The written buffers must outlive the cache, since a destroyed handle could come back as a new buffer.
+class DescriptorSetCache {
+  public:
+    static constexpr uint32_t kMaxBindings = 4;
+
+    DescriptorSetCache(DescriptorSetManager *manager, VkDescriptorSetLayout layout) : manager_(manager), layout_(layout) {}
+    DescriptorSetCache(const DescriptorSetCache &) = delete;
+    DescriptorSetCache &operator=(const DescriptorSetCache &) = delete;
+    ~DescriptorSetCache() { Release(); }
+
+    // Returns VK_NULL_HANDLE if no set could be allocated
+    VkDescriptorSet Get();
+    // Writes storage buffer descriptors to the bindings of the set last returned by Get(), skipping the ones that already
+    // hold the same range. Bindings with a VK_NULL_HANDLE buffer are left as they are.
+    void WriteStorageBuffers(VkDevice device, const std::array<VkDescriptorBufferInfo, kMaxBindings> &infos);
+    // Once the command buffer is not in use anymore, all the sets can be handed out again
+    void Reset() { used_ = 0; }
+    // Gives the sets back to the DescriptorSetManager
+    void Release();
+
+    size_t Size() const { return sets_.size(); }
+
+  private:
+    struct Entry {
+        PooledDescriptorSet pooled;
+        std::array<VkDescriptorBufferInfo, kMaxBindings> written{};
+    };
+    // Sets taken from the DescriptorSetManager at once when the cache runs out
+    static constexpr uint32_t kGrowCount = 16;
+
+    DescriptorSetManager *manager_;
+    VkDescriptorSetLayout layout_;
+    std::vector<Entry> sets_;
+    size_t used_ = 0;
+};
+
+}  // namespace gpu_tracker
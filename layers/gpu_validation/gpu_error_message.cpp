@@ -95,11 +95,8 @@ static void GenerateStageMessage(const uint32_t *debug_record, std::string &msg)
     msg = strm.str();
 }
 
-// The lock (debug_output_mutex) is held by the caller (UtilGenerateCommonMessage),
-// because the latter has code paths that make multiple calls of this function,
-// and all such calls have to access the same debug reporting state to ensure consistency of output information.
-static std::string LookupDebugUtilsNameNoLock(const debug_report_data *report_data, const uint64_t object) {
-    auto object_label = report_data->DebugReportGetUtilsObjectNameNoLock(object);
+static std::string LookupDebugUtilsName(const debug_report_data *report_data, const uint64_t object) {
+    auto object_label = report_data->DebugReportGetUtilsObjectName(object);
     if (object_label != "") {
         object_label = "(" + object_label + ")";
     }
@@ -114,15 +111,13 @@ void UtilGenerateCommonMessage(const debug_report_data *report_data, const VkCom
     using namespace spvtools;
     std::ostringstream strm;
     if (shader_module_handle == VK_NULL_HANDLE && shader_object_handle == VK_NULL_HANDLE) {
-        std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
         strm << std::hex << std::showbase << "Internal Error: Unable to locate information for shader used in command buffer "
-             << LookupDebugUtilsNameNoLock(report_data, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
+             << LookupDebugUtilsName(report_data, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
              << "). ";
         assert(true);
     } else {
-        std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
         strm << std::hex << std::showbase << "Command buffer "
-             << LookupDebugUtilsNameNoLock(report_data, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
+             << LookupDebugUtilsName(report_data, HandleToUint64(commandBuffer)) << "(" << HandleToUint64(commandBuffer)
              << "). ";
         if (pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
             strm << "Draw ";
@@ -136,13 +131,13 @@ void UtilGenerateCommonMessage(const debug_report_data *report_data, const VkCom
         }
         if (shader_module_handle) {
             strm << "Index " << operation_index << ". "
-                 << "Pipeline " << LookupDebugUtilsNameNoLock(report_data, HandleToUint64(pipeline_handle)) << "("
+                 << "Pipeline " << LookupDebugUtilsName(report_data, HandleToUint64(pipeline_handle)) << "("
                  << HandleToUint64(pipeline_handle) << "). "
-                 << "Shader Module " << LookupDebugUtilsNameNoLock(report_data, HandleToUint64(shader_module_handle)) << "("
+                 << "Shader Module " << LookupDebugUtilsName(report_data, HandleToUint64(shader_module_handle)) << "("
                  << HandleToUint64(shader_module_handle) << "). ";
         } else {
             strm << "Index " << operation_index << ". "
-                 << "Shader Object " << LookupDebugUtilsNameNoLock(report_data, HandleToUint64(shader_object_handle)) << "("
+                 << "Shader Object " << LookupDebugUtilsName(report_data, HandleToUint64(shader_object_handle)) << "("
                  << HandleToUint64(shader_object_handle) << "). ";
         }
     }
@@ -525,41 +520,28 @@ bool gpuav::Validator::AnalyzeAndGenerateMessages(VkCommandBuffer cmd_buffer, Vk
     return error_found;
 }
 
-void gpuav::CommandResources::LogErrorIfAny(gpuav::Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer,
+bool gpuav::CommandResources::LogErrorIfAny(gpuav::Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer,
                                             const uint32_t operation_index) {
-    uint32_t *debug_output_buffer = nullptr;
-    VkResult result =
-        vmaMapMemory(validator.vmaAllocator, output_mem_block.allocation, reinterpret_cast<void **>(&debug_output_buffer));
-    if (result == VK_SUCCESS) {
-        const uint32_t total_words = debug_output_buffer[spvtools::kDebugOutputSizeOffset];
-        // A zero here means that the shader instrumentation didn't write anything.
-        if (total_words != 0) {
-            uint32_t *debug_record = &debug_output_buffer[spvtools::kDebugOutputDataOffset];
-            const LogObjectList objlist(queue, cmd_buffer);
-            LogValidationMessage(validator, queue, cmd_buffer, debug_record, operation_index, objlist);
-        }
-        debug_output_buffer[spvtools::kDebugOutputSizeOffset] = 0;
-        vmaUnmapMemory(validator.vmaAllocator, output_mem_block.allocation);
+    uint32_t *debug_output_buffer = static_cast<uint32_t *>(output_range.mapped);
+    const uint32_t total_words = debug_output_buffer[spvtools::kDebugOutputSizeOffset];
+    // A zero here means that the shader instrumentation didn't write anything.
+    if (total_words != 0) {
+        uint32_t *debug_record = &debug_output_buffer[spvtools::kDebugOutputDataOffset];
+        const LogObjectList objlist(queue, cmd_buffer);
+        LogValidationMessage(validator, queue, cmd_buffer, debug_record, operation_index, objlist);
     }
+    debug_output_buffer[spvtools::kDebugOutputSizeOffset] = 0;
+    return total_words != 0;
 }
 
 bool gpuav::CommandResources::LogValidationMessage(gpuav::Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer,
                                                    const uint32_t *debug_record, const uint32_t operation_index,
                                                    const LogObjectList &objlist) {
-    bool error_logged = false;
-    uint32_t *data = nullptr;
-    VkResult result = vmaMapMemory(validator.vmaAllocator, output_mem_block.allocation, reinterpret_cast<void **>(&data));
-    if (result == VK_SUCCESS) {
-        const DescBindingInfo *di_info = desc_binding_index != vvl::kU32Max ? &(*desc_binding_list)[desc_binding_index] : nullptr;
-        const Location loc(command);
-        error_logged =
-            validator.AnalyzeAndGenerateMessages(cmd_buffer, queue, *this, operation_index, data,
-                                                 di_info ? di_info->descriptor_set_buffers : std::vector<DescSetState>(), loc);
-        vmaUnmapMemory(validator.vmaAllocator, output_mem_block.allocation);
-        return error_logged;
-    }
-
-    return error_logged;
+    uint32_t *data = static_cast<uint32_t *>(output_range.mapped);
+    const DescBindingInfo *di_info = desc_binding_index != vvl::kU32Max ? &(*desc_binding_list)[desc_binding_index] : nullptr;
+    const Location loc(command);
+    return validator.AnalyzeAndGenerateMessages(cmd_buffer, queue, *this, operation_index, data,
+                                                di_info ? di_info->descriptor_set_buffers : std::vector<DescSetState>(), loc);
 }
 
 bool gpuav::PreDrawResources::LogValidationMessage(gpuav::Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer,
@@ -81,8 +81,11 @@ void gpuav::Validator::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_sta
         const auto &subres_map = layout_map_entry.second;
         auto image_state = Get<vvl::Image>(image);
         if (image_state && subres_map) {
-            auto guard = image_state->layout_range_map->WriteLock();
-            sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+            image_state->layout_state->Update(
+                [&subres_map](const GlobalImageLayoutRangeMap &global_map) { return global_map.ChangedBy(*subres_map); },
+                [&subres_map](GlobalImageLayoutRangeMap &global_map) {
+                    return sparse_container::splice(global_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+                });
         }
     }
 }
@@ -472,6 +475,7 @@ void gpuav::Validator::PreCallRecordCmdWaitEvents(
     VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
     uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
     const VkImageMemoryBarrier *pImageMemoryBarriers, const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
     BaseClass::PreCallRecordCmdWaitEvents(commandBuffer, eventCount, pEvents, sourceStageMask, dstStageMask, memoryBarrierCount,
                                           pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount,
                                           pImageMemoryBarriers, record_obj);
@@ -491,12 +495,14 @@ void gpuav::Validator::RecordCmdWaitEvents2(VkCommandBuffer commandBuffer, uint3
 
 void gpuav::Validator::PreCallRecordCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
                                                       const VkDependencyInfoKHR *pDependencyInfos, const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
     BaseClass::PreCallRecordCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
     RecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, Func::vkCmdWaitEvents2KHR);
 }
 
 void gpuav::Validator::PreCallRecordCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
                                                    const VkDependencyInfo *pDependencyInfos, const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
     BaseClass::PreCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
     RecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, Func::vkCmdWaitEvents2);
 }
@@ -506,6 +512,7 @@ void gpuav::Validator::PreCallRecordCmdPipelineBarrier(
     VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
     uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
     const VkImageMemoryBarrier *pImageMemoryBarriers, const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
     BaseClass::PreCallRecordCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount,
                                                pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers,
                                                imageMemoryBarrierCount, pImageMemoryBarriers, record_obj);
@@ -517,6 +524,7 @@ void gpuav::Validator::PreCallRecordCmdPipelineBarrier(
 void gpuav::Validator::PreCallRecordCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer,
                                                            const VkDependencyInfoKHR *pDependencyInfo,
                                                            const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
     BaseClass::PreCallRecordCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo, record_obj);
 
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
@@ -525,6 +533,7 @@ void gpuav::Validator::PreCallRecordCmdPipelineBarrier2KHR(VkCommandBuffer comma
 
 void gpuav::Validator::PreCallRecordCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo,
                                                         const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
     BaseClass::PreCallRecordCmdPipelineBarrier2(commandBuffer, pDependencyInfo, record_obj);
 
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
@@ -678,10 +687,10 @@ bool gpuav::Validator::VerifyImageLayoutRange(const vvl::CommandBuffer &cb_state
         return skip;
     }
     const auto &layout_map = subresource_map->GetLayoutMap();
-    const auto *global_map = image_state.layout_range_map.get();
+    assert(image_state.layout_state);
+    const auto global_layouts = image_state.layout_state->Current();
+    const auto *global_map = &global_layouts->map;
     GlobalImageLayoutRangeMap empty_map(1);
-    assert(global_map);
-    auto global_map_guard = global_map->ReadLock();
 
     auto pos = layout_map.begin();
     const auto end = layout_map.end();
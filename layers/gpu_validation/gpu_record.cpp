@@ -15,8 +15,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
-#include <fstream>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
 #include <unistd.h>
 #endif
@@ -28,9 +28,6 @@
 #include "spirv-tools/linker.hpp"
 #include "generated/layer_chassis_dispatch.h"
 
-// Generated shaders
-#include "generated/gpu_inst_shader_hash.h"
-
 void gpuav::Validator::PreCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
                                                  const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer,
                                                  const RecordObject &record_obj, void *cb_state_data) {
@@ -84,6 +81,11 @@ void gpuav::Validator::PreCallRecordCmdBuildAccelerationStructureNV(VkCommandBuf
             current_valid_handles.push_back(as_state.opaque_handle);
         }
     });
+    // The inspection shader looks the handles up with a binary search. Sorting the 64 bit values orders them by
+    // (bits_1, bits_0), the order the shader compares the two halves in.
+    std::sort(current_valid_handles.begin(), current_valid_handles.end());
+    current_valid_handles.erase(std::unique(current_valid_handles.begin(), current_valid_handles.end()),
+                                current_valid_handles.end());
 
     AccelerationStructureBuildValidationInfo as_validation_info = {};
     as_validation_info.acceleration_structure = dst;
@@ -198,7 +200,14 @@ void gpuav::Validator::PreCallRecordCmdBuildAccelerationStructureNV(VkCommandBuf
     DispatchCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, as_validation_state.pipeline);
     DispatchCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, as_validation_state.pipeline_layout, 0, 1,
                                   &as_validation_info.descriptor_set, 0, nullptr);
-    DispatchCmdDispatch(commandBuffer, 1, 1, 1);
+    {
+        // One invocation per instance, in rows of at most kAsInspectionMaxWorkgroupsX workgroups
+        const uint32_t group_count =
+            (pInfo->instanceCount + glsl::kAsInspectionWorkgroupSize - 1) / glsl::kAsInspectionWorkgroupSize;
+        const uint32_t group_count_x = std::min(group_count, glsl::kAsInspectionMaxWorkgroupsX);
+        const uint32_t group_count_y = (group_count + glsl::kAsInspectionMaxWorkgroupsX - 1) / glsl::kAsInspectionMaxWorkgroupsX;
+        DispatchCmdDispatch(commandBuffer, group_count_x, group_count_y, 1);
+    }
 
     // Issue a buffer memory barrier to make sure that any invalid bottom level acceleration structure handles
     // have been replaced by the validation compute shader before any builds take place.
@@ -286,6 +295,135 @@ void gpuav::Validator::PreCallRecordDestroyRenderPass(VkDevice device, VkRenderP
     BaseClass::PreCallRecordDestroyRenderPass(device, renderPass, pAllocator, record_obj);
 }
 
+static VkResult DispatchCreatePipeline(VkDevice device, VkPipelineCache pipeline_cache, const VkGraphicsPipelineCreateInfo &ci,
+                                       VkPipeline *pipeline) {
+    return DispatchCreateGraphicsPipelines(device, pipeline_cache, 1, &ci, nullptr, pipeline);
+}
+
+static VkResult DispatchCreatePipeline(VkDevice device, VkPipelineCache pipeline_cache, const VkComputePipelineCreateInfo &ci,
+                                       VkPipeline *pipeline) {
+    return DispatchCreateComputePipelines(device, pipeline_cache, 1, &ci, nullptr, pipeline);
+}
+
+static uint32_t GetStageCount(const safe_VkGraphicsPipelineCreateInfo &ci) { return ci.stageCount; }
+static uint32_t GetStageCount(const safe_VkComputePipelineCreateInfo &) { return 1; }
+
+static safe_VkPipelineShaderStageCreateInfo &GetStage(safe_VkGraphicsPipelineCreateInfo &ci, uint32_t index) {
+    return ci.pStages[index];
+}
+static safe_VkPipelineShaderStageCreateInfo &GetStage(safe_VkComputePipelineCreateInfo &ci, uint32_t) { return ci.stage; }
+
+// With gpuav_adaptive_instrumentation, also create each pipeline from the original shaders, so it can be bound instead of the
+// instrumented one once it has validated clean long enough.
+template <typename CreateInfo>
+void gpuav::Validator::CreateUninstrumentedPipelines(VkPipelineCache pipeline_cache, uint32_t count,
+                                                     const CreateInfo *pCreateInfos, const VkPipeline *pPipelines,
+                                                     const std::vector<std::shared_ptr<vvl::Pipeline>> &pipe_state) {
+    if (aborted || gpuav_settings.gpuav_adaptive_instrumentation == 0) return;
+    if (pipeline_cache == VK_NULL_HANDLE) {
+        pipeline_cache = validation_pipeline_cache;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        // Libraries are not bound on their own, and the linked pipelines would need uninstrumented libraries
+        if (pPipelines[i] == VK_NULL_HANDLE || !pipe_state[i] || (pCreateInfos[i].flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR) ||
+            vku::FindStructInPNextChain<VkPipelineLibraryCreateInfoKHR>(pCreateInfos[i].pNext)) {
+            continue;
+        }
+        // NOTE: since these are "safe" CreateInfos, this will create a deep copy via the safe copy constructor
+        auto create_info = pipe_state[i]->GetCreateInfo<CreateInfo>();
+        // Created one at a time, so a base pipeline index into the create infos of the call can't be used
+        create_info.flags &= ~VK_PIPELINE_CREATE_DERIVATIVE_BIT;
+        create_info.basePipelineHandle = VK_NULL_HANDLE;
+        create_info.basePipelineIndex = -1;
+
+        // The shader modules of the application already hold the instrumented SPIR-V, so the stages using one get a temporary
+        // module with the original code instead. Stages with their code in the pNext chain still have the original code.
+        std::vector<VkShaderModule> shader_modules;
+        bool stages_replaced = true;
+        for (uint32_t stage_index = 0; stage_index < GetStageCount(create_info); ++stage_index) {
+            auto &stage = GetStage(create_info, stage_index);
+            if (stage.module == VK_NULL_HANDLE) continue;
+            const auto module_state = Get<vvl::ShaderModule>(stage.module);
+            if (!module_state || !module_state->spirv) {
+                stages_replaced = false;
+                break;
+            }
+            VkShaderModuleCreateInfo module_ci = vku::InitStructHelper();
+            module_ci.pCode = module_state->spirv->words_.data();
+            module_ci.codeSize = module_state->spirv->words_.size() * sizeof(uint32_t);
+            VkShaderModule shader_module = VK_NULL_HANDLE;
+            if (DispatchCreateShaderModule(device, &module_ci, nullptr, &shader_module) != VK_SUCCESS) {
+                stages_replaced = false;
+                break;
+            }
+            shader_modules.push_back(shader_module);
+            stage.module = shader_module;
+        }
+
+        auto adaptive = std::make_shared<AdaptivePipeline>();
+        if (stages_replaced &&
+            DispatchCreatePipeline(device, pipeline_cache, *create_info.ptr(), &adaptive->uninstrumented) == VK_SUCCESS) {
+            adaptive_pipelines.insert(pPipelines[i], std::move(adaptive));
+        }
+        // The pipeline doesn't need its shader modules once created
+        for (VkShaderModule shader_module : shader_modules) {
+            DispatchDestroyShaderModule(device, shader_module, nullptr);
+        }
+    }
+}
+
+// The uninstrumented copies are created first, so the creation feedback the application gets is the one of the instrumented
+// pipelines, which BaseClass copies over
+void gpuav::Validator::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
+                                                             const VkGraphicsPipelineCreateInfo *pCreateInfos,
+                                                             const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
+                                                             const RecordObject &record_obj, void *cgpl_state_data) {
+    auto *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
+    CreateUninstrumentedPipelines(pipelineCache, count, pCreateInfos, pPipelines, cgpl_state->pipe_state);
+    BaseClass::PostCallRecordCreateGraphicsPipelines(device, pipelineCache, count, pCreateInfos, pAllocator, pPipelines, record_obj,
+                                                     cgpl_state_data);
+}
+
+void gpuav::Validator::PostCallRecordCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
+                                                            const VkComputePipelineCreateInfo *pCreateInfos,
+                                                            const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
+                                                            const RecordObject &record_obj, void *ccpl_state_data) {
+    auto *ccpl_state = reinterpret_cast<create_compute_pipeline_api_state *>(ccpl_state_data);
+    CreateUninstrumentedPipelines(pipelineCache, count, pCreateInfos, pPipelines, ccpl_state->pipe_state);
+    BaseClass::PostCallRecordCreateComputePipelines(device, pipelineCache, count, pCreateInfos, pAllocator, pPipelines, record_obj,
+                                                    ccpl_state_data);
+}
+
+void gpuav::Validator::PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks *pAllocator,
+                                                    const RecordObject &record_obj) {
+    auto adaptive = adaptive_pipelines.pop(pipeline);
+    if (adaptive != adaptive_pipelines.end()) {
+        DispatchDestroyPipeline(device, adaptive->second->uninstrumented, nullptr);
+    }
+    BaseClass::PreCallRecordDestroyPipeline(device, pipeline, pAllocator, record_obj);
+}
+
+void gpuav::Validator::PostCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                                     VkPipeline pipeline, const RecordObject &record_obj) {
+    BaseClass::PostCallRecordCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline, record_obj);
+    if (gpuav_settings.gpuav_adaptive_instrumentation == 0) return;
+    auto cb_node = GetWrite<CommandBuffer>(commandBuffer);
+    if (!cb_node) return;
+    const auto lv_bind_point = ConvertToLvlBindPoint(pipelineBindPoint);
+    cb_node->adaptive_bound[lv_bind_point].reset();
+    cb_node->uninstrumented_bound[lv_bind_point] = VK_NULL_HANDLE;
+
+    auto adaptive = adaptive_pipelines.find(pipeline);
+    if (adaptive == adaptive_pipelines.end()) return;
+    if (adaptive->second->UseInstrumented(gpuav_settings.gpuav_adaptive_instrumentation)) {
+        cb_node->adaptive_bound[lv_bind_point] = adaptive->second;
+    } else {
+        // Replaces the instrumented pipeline the application just bound
+        DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, adaptive->second->uninstrumented);
+        cb_node->uninstrumented_bound[lv_bind_point] = adaptive->second->uninstrumented;
+    }
+}
+
 // Create the instrumented shader data to provide to the driver.
 void gpuav::Validator::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                        const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
@@ -294,12 +432,13 @@ void gpuav::Validator::PreCallRecordCreateShaderModule(VkDevice device, const Vk
     create_shader_module_api_state *csm_state = static_cast<create_shader_module_api_state *>(csm_state_data);
     if (gpuav_settings.select_instrumented_shaders && !CheckForGpuAvEnabled(pCreateInfo->pNext)) return;
     uint32_t shader_id;
+    uint64_t cache_key = 0;
     if (gpuav_settings.cache_instrumented_shaders) {
-        const uint32_t shader_hash = hash_util::ShaderHash(pCreateInfo->pCode, pCreateInfo->codeSize);
-        if (gpuav_settings.cache_instrumented_shaders && CheckForCachedInstrumentedShader(shader_hash, csm_state)) {
+        cache_key = InstrumentedShaderKey(pCreateInfo->pCode, pCreateInfo->codeSize);
+        if (CheckForCachedInstrumentedShader(cache_key, csm_state)) {
             return;
         }
-        shader_id = shader_hash;
+        shader_id = hash_util::ShaderHash(pCreateInfo->pCode, pCreateInfo->codeSize);
     } else {
         shader_id = unique_shader_module_id++;
     }
@@ -310,8 +449,7 @@ void gpuav::Validator::PreCallRecordCreateShaderModule(VkDevice device, const Vk
         csm_state->instrumented_create_info.codeSize = csm_state->instrumented_spirv.size() * sizeof(uint32_t);
         csm_state->unique_shader_id = shader_id;
         if (gpuav_settings.cache_instrumented_shaders) {
-            instrumented_shaders.emplace(shader_id,
-                                         std::make_pair(csm_state->instrumented_spirv.size(), csm_state->instrumented_spirv));
+            instrumented_shaders.Add(cache_key, shader_id, csm_state->instrumented_spirv);
         }
     }
 }
@@ -323,28 +461,38 @@ void gpuav::Validator::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t c
     BaseClass::PreCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                              csm_state_data);
     create_shader_object_api_state *csm_state = static_cast<create_shader_object_api_state *>(csm_state_data);
+    std::vector<uint32_t> to_instrument;
+    std::vector<uint64_t> cache_keys(createInfoCount, 0);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         if (gpuav_settings.select_instrumented_shaders && !CheckForGpuAvEnabled(pCreateInfos[i].pNext)) continue;
         if (gpuav_settings.cache_instrumented_shaders) {
-            const uint32_t shader_hash = hash_util::ShaderHash(pCreateInfos[i].pCode, pCreateInfos[i].codeSize);
-            if (CheckForCachedInstrumentedShader(i, csm_state->unique_shader_ids[i], csm_state)) {
+            cache_keys[i] = InstrumentedShaderKey(pCreateInfos[i].pCode, pCreateInfos[i].codeSize);
+            if (CheckForCachedInstrumentedShader(i, cache_keys[i], csm_state)) {
                 continue;
             }
-            csm_state->unique_shader_ids[i] = shader_hash;
+            csm_state->unique_shader_ids[i] = hash_util::ShaderHash(pCreateInfos[i].pCode, pCreateInfos[i].codeSize);
         } else {
             csm_state->unique_shader_ids[i] = unique_shader_module_id++;
         }
-        const bool pass = InstrumentShader(
+        to_instrument.push_back(i);
+    }
+
+    // Not a vector<bool>, the workers write neighbouring elements
+    std::vector<uint8_t> passed(to_instrument.size(), 0);
+    ParallelInstrument(to_instrument.size(), [&](size_t index) {
+        const uint32_t i = to_instrument[index];
+        passed[index] = InstrumentShader(
             vvl::make_span(static_cast<const uint32_t *>(pCreateInfos[i].pCode), pCreateInfos[i].codeSize / sizeof(uint32_t)),
             csm_state->instrumented_spirv[i], csm_state->unique_shader_ids[i], record_obj.location);
-        if (pass) {
-            csm_state->instrumented_create_info[i].pCode = csm_state->instrumented_spirv[i].data();
-            csm_state->instrumented_create_info[i].codeSize = csm_state->instrumented_spirv[i].size() * sizeof(uint32_t);
-            if (gpuav_settings.cache_instrumented_shaders) {
-                instrumented_shaders.emplace(
-                    csm_state->unique_shader_ids[i],
-                    std::make_pair(csm_state->instrumented_spirv[i].size(), csm_state->instrumented_spirv[i]));
-            }
+    });
+
+    for (size_t index = 0; index < to_instrument.size(); ++index) {
+        if (!passed[index]) continue;
+        const uint32_t i = to_instrument[index];
+        csm_state->instrumented_create_info[i].pCode = csm_state->instrumented_spirv[i].data();
+        csm_state->instrumented_create_info[i].codeSize = csm_state->instrumented_spirv[i].size() * sizeof(uint32_t);
+        if (gpuav_settings.cache_instrumented_shaders) {
+            instrumented_shaders.Add(cache_keys[i], csm_state->unique_shader_ids[i], csm_state->instrumented_spirv[i]);
         }
     }
 }
@@ -352,32 +500,24 @@ void gpuav::Validator::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t c
 // Clean up device-related resources
 void gpuav::Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                                   const RecordObject &record_obj) {
+    // Pending submissions still read back from the resources destroyed below
+    if (result_readback) {
+        result_readback->WaitForAll();
+    }
     desc_heap.reset();
     acceleration_structure_validation_state.Destroy(device, vmaAllocator);
     common_draw_resources.Destroy(device);
     common_dispatch_resources.Destroy(device);
     common_trace_rays_resources.Destroy(device, vmaAllocator);
-    if (app_buffer_device_addresses.buffer) {
-        vmaDestroyBuffer(vmaAllocator, app_buffer_device_addresses.buffer, app_buffer_device_addresses.allocation);
-    }
-    if (gpuav_settings.cache_instrumented_shaders && !instrumented_shaders.empty()) {
-        std::ofstream file_stream(instrumented_shader_cache_path, std::ofstream::out | std::ofstream::binary);
-        if (file_stream) {
-            file_stream.write(INST_SHADER_GIT_HASH, sizeof(INST_SHADER_GIT_HASH));
-            uint32_t datasize = static_cast<uint32_t>(instrumented_shaders.size());
-            file_stream.write(reinterpret_cast<char *>(&datasize), sizeof(uint32_t));
-            for (auto &record : instrumented_shaders) {
-                // Hash of shader
-                file_stream.write(reinterpret_cast<const char *>(&record.first), sizeof(uint32_t));
-                // Size of vector of code
-                auto vector_size = record.second.first;
-                file_stream.write(reinterpret_cast<const char *>(&vector_size), sizeof(uint32_t));
-                // Vector contents
-                file_stream.write(reinterpret_cast<const char *>(record.second.second.data()), vector_size * sizeof(uint32_t));
-            }
-            file_stream.close();
-        }
+    for (auto &table : bda_tables) {
+        vmaDestroyBuffer(vmaAllocator, table.block.buffer, table.block.allocation);
     }
+    bda_tables.clear();
+    adaptive_pipelines.for_each([device](const VkPipeline &, const std::shared_ptr<AdaptivePipeline> &adaptive) {
+        DispatchDestroyPipeline(device, adaptive->uninstrumented, nullptr);
+    });
+    adaptive_pipelines.clear();
+    DestroyValidationPipelineCache();
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 }
 
@@ -396,6 +536,7 @@ void gpuav::Validator::RecordCmdBeginRenderPassLayouts(VkCommandBuffer commandBu
 
 void gpuav::Validator::PreCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                                        VkSubpassContents contents, const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
     BaseClass::PreCallRecordCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents, record_obj);
     RecordCmdBeginRenderPassLayouts(commandBuffer, pRenderPassBegin, contents);
 }
@@ -411,10 +552,47 @@ void gpuav::Validator::PreCallRecordCmdBeginRenderPass2(VkCommandBuffer commandB
                                                         const VkRenderPassBeginInfo *pRenderPassBegin,
                                                         const VkSubpassBeginInfo *pSubpassBeginInfo,
                                                         const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
     BaseClass::PreCallRecordCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo, record_obj);
     RecordCmdBeginRenderPassLayouts(commandBuffer, pRenderPassBegin, pSubpassBeginInfo->contents);
 }
 
+void gpuav::Validator::PreCallRecordCmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfo *pRenderingInfo,
+                                                         const RecordObject &record_obj) {
+    PreCallRecordCmdBeginRendering(commandBuffer, pRenderingInfo, record_obj);
+}
+
+void gpuav::Validator::PreCallRecordCmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo *pRenderingInfo,
+                                                      const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
+    BaseClass::PreCallRecordCmdBeginRendering(commandBuffer, pRenderingInfo, record_obj);
+}
+
+void gpuav::Validator::PreCallRecordCmdEndRenderingKHR(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    PreCallRecordCmdEndRendering(commandBuffer, record_obj);
+}
+
+void gpuav::Validator::PreCallRecordCmdEndRendering(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
+    BaseClass::PreCallRecordCmdEndRendering(commandBuffer, record_obj);
+}
+
+void gpuav::Validator::PreCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
+    BaseClass::PreCallRecordCmdEndRenderPass(commandBuffer, record_obj);
+}
+
+void gpuav::Validator::PreCallRecordCmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo,
+                                                         const RecordObject &record_obj) {
+    PreCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo, record_obj);
+}
+
+void gpuav::Validator::PreCallRecordCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo,
+                                                      const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
+    BaseClass::PreCallRecordCmdEndRenderPass2(commandBuffer, pSubpassEndInfo, record_obj);
+}
+
 void gpuav::Validator::RecordCmdEndRenderPassLayouts(VkCommandBuffer commandBuffer) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     if (cb_state) {
@@ -444,6 +622,34 @@ void gpuav::Validator::RecordCmdNextSubpassLayouts(VkCommandBuffer commandBuffer
     TransitionSubpassLayouts(cb_state.get(), *cb_state->activeRenderPass, cb_state->GetActiveSubpass());
 }
 
+void gpuav::Validator::PreCallRecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents,
+                                                   const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
+    BaseClass::PreCallRecordCmdNextSubpass(commandBuffer, contents, record_obj);
+}
+
+void gpuav::Validator::PreCallRecordCmdNextSubpass2KHR(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo *pSubpassBeginInfo,
+                                                       const VkSubpassEndInfo *pSubpassEndInfo, const RecordObject &record_obj) {
+    PreCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, record_obj);
+}
+
+void gpuav::Validator::PreCallRecordCmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo *pSubpassBeginInfo,
+                                                    const VkSubpassEndInfo *pSubpassEndInfo, const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
+    BaseClass::PreCallRecordCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo, record_obj);
+}
+
+void gpuav::Validator::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
+                                                       const VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
+    BaseClass::PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, record_obj);
+}
+
+void gpuav::Validator::PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    RecordPendingPreActionValidation(commandBuffer);
+    BaseClass::PreCallRecordEndCommandBuffer(commandBuffer, record_obj);
+}
+
 void gpuav::Validator::PostCallRecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents,
                                                     const RecordObject &record_obj) {
     BaseClass::PostCallRecordCmdNextSubpass(commandBuffer, contents, record_obj);
@@ -528,7 +734,8 @@ void gpuav::Validator::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCo
             PreRecordCommandBuffer(submit->pCommandBuffers[i]);
         }
     }
-    UpdateBDABuffer(app_buffer_device_addresses);
+    UpdateBDABuffer();
+    descriptor_state_stats.submits++;
 }
 
 void gpuav::Validator::PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
@@ -545,7 +752,8 @@ void gpuav::Validator::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitC
             PreRecordCommandBuffer(submit->pCommandBufferInfos[i].commandBuffer);
         }
     }
-    UpdateBDABuffer(app_buffer_device_addresses);
+    UpdateBDABuffer();
+    descriptor_state_stats.submits++;
 }
 
 void gpuav::Validator::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
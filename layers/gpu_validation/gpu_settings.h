@@ -19,9 +19,13 @@
 typedef struct {
     bool validate_descriptors;
     bool validate_indirect_buffer;
+    bool validate_buffer_device_address;
+    // Validate the descriptors the shaders accessed after the submission, not only their indices on the GPU
+    bool validate_used_descriptors;
     bool vma_linear_output;
     bool warn_on_robust_oob;
     bool cache_instrumented_shaders;
     bool select_instrumented_shaders;
     uint32_t gpuav_max_buffer_device_addresses;
+    uint32_t gpuav_adaptive_instrumentation;
 } GpuAVSettings;
\ No newline at end of file
@@ -16,7 +16,9 @@
  */
 
 #include <cmath>
-#include <fstream>
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
 #include <unistd.h>
 #endif
@@ -98,7 +100,7 @@ void gpuav::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     // Set up a stub implementation of the descriptor heap in case we abort.
     desc_heap.emplace(*this, 0);
     bindings_.push_back(binding);
-    for (auto i = 1; i < 3; i++) {
+    for (auto i = 1; i < 4; i++) {
         binding.binding = i;
         bindings_.push_back(binding);
     }
@@ -123,32 +125,21 @@ void gpuav::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     }
 
     shaderInt64 = supported_features.shaderInt64;
-    if ((IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
+    if (gpuav_settings.validate_buffer_device_address &&
+        (IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
          IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
         !shaderInt64) {
         LogWarning("WARNING-GPU-Assisted-Validation", device, loc,
                    "shaderInt64 feature is not available.  No buffer device address checking will be attempted");
     }
-    buffer_device_address_enabled = ((IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
+    buffer_device_address_enabled = gpuav_settings.validate_buffer_device_address &&
+                                    ((IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
                                       IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
                                      shaderInt64 && enabled_features.bufferDeviceAddress);
 
     if (buffer_device_address_enabled) {
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        // We need 2 words per address (address and size), 1 word for the start of sizes index, 2 words for the address section
-        // bounds, and 2 more words for the size section bounds
-        app_bda_buffer_size =
-            (1 + (gpuav_settings.gpuav_max_buffer_device_addresses + 2) + (gpuav_settings.gpuav_max_buffer_device_addresses + 2)) *
-            8;  // 64 bit words
-        buffer_info.size = app_bda_buffer_size;
-        // This buffer could be very large if an application uses many buffers. Allocating it as HOST_CACHED
-        // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-        VkResult result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &app_buffer_device_addresses.buffer,
-                                          &app_buffer_device_addresses.allocation, nullptr);
-        if (result != VK_SUCCESS) {
+        // The table starts with room for gpuav_max_buffer_device_addresses buffers and grows when more are in use
+        if (!CreateBDATable(std::max(gpuav_settings.gpuav_max_buffer_device_addresses, 1u))) {
             ReportSetupProblem(
                 device, "Unable to allocate device memory for buffer device address data. Device could become unstable.", true);
             aborted = true;
@@ -208,40 +199,102 @@ void gpuav::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
             ReportSetupProblem(device, "Unable to create VMA memory pool");
         }
     }
+    // The bindless state buffers of the command buffers are sub allocated from the same chunks
+    output_chunks.Init(vmaAllocator, output_buffer_pool,
+                       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT, OutputChunkSize());
 
     if (gpuav_settings.cache_instrumented_shaders) {
         auto tmp_path = GetTempFilePath();
-        instrumented_shader_cache_path = tmp_path + "/instrumented_shader_cache";
+        std::string user_suffix;
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
-        instrumented_shader_cache_path += "-" + std::to_string(getuid());
+        user_suffix = "-" + std::to_string(getuid());
 #endif
-        instrumented_shader_cache_path += ".bin";
-
-        std::ifstream file_stream(instrumented_shader_cache_path, std::ifstream::in | std::ifstream::binary);
-        if (file_stream) {
-            char inst_shader_hash[sizeof(INST_SHADER_GIT_HASH)];
-            file_stream.read(inst_shader_hash, sizeof(inst_shader_hash));
-            if (!strncmp(inst_shader_hash, INST_SHADER_GIT_HASH, sizeof(INST_SHADER_GIT_HASH))) {
-                uint32_t num_shaders = 0;
-                file_stream.read(reinterpret_cast<char *>(&num_shaders), sizeof(uint32_t));
-                for (uint32_t i = 0; i < num_shaders; ++i) {
-                    uint32_t hash;
-                    uint32_t shader_length;
-                    std::vector<uint32_t> shader_code;
-                    file_stream.read(reinterpret_cast<char *>(&hash), sizeof(uint32_t));
-                    file_stream.read(reinterpret_cast<char *>(&shader_length), sizeof(uint32_t));
-                    shader_code.resize(shader_length);
-                    file_stream.read(reinterpret_cast<char *>(shader_code.data()), 4 * shader_length);
-                    instrumented_shaders.emplace(hash, std::make_pair(shader_length, std::move(shader_code)));
-                }
-            }
-            file_stream.close();
+        instrumented_shader_cache_path = tmp_path + "/instrumented_shader_cache" + user_suffix + ".bin";
+        CreateValidationPipelineCache(tmp_path + "/gpuav_pipeline_cache" + user_suffix + ".bin");
+
+        // Everything besides the input SPIR-V that InstrumentShader builds the instrumented code from
+        const uint32_t instrumentation_config[] = {api_version,
+                                                   IsExtEnabled(device_extensions.vk_khr_spirv_1_4) ? 1u : 0u,
+                                                   desc_set_bind_index,
+                                                   gpuav_settings.validate_descriptors ? 1u : 0u,
+                                                   buffer_device_address_enabled ? 1u : 0u};
+        instrumented_shader_seed = hash_util::Hash64(instrumentation_config, sizeof(instrumentation_config));
+
+        if (!instrumented_shaders.Open(instrumented_shader_cache_path, INST_SHADER_GIT_HASH)) {
+            ReportSetupProblem(device, "Unable to open the instrumented shader cache file, shaders are only cached in memory.");
         }
     }
 
     CreateAccelerationStructureBuildValidationState(pCreateInfo);
 }
 
+// The pipelines of the validation shaders, and the uninstrumented copies of the application pipelines created without a cache,
+// are created with a pipeline cache saved to path when the device is destroyed, so the driver doesn't compile them again on
+// every run.
+void gpuav::Validator::CreateValidationPipelineCache(const std::string &path) {
+    validation_pipeline_cache_path = path;
+    std::vector<uint8_t> initial_data;
+    std::error_code error;
+    const uint64_t file_size = std::filesystem::exists(path, error) ? std::filesystem::file_size(path, error) : 0;
+    if (!error && file_size >= sizeof(VkPipelineCacheHeaderVersionOne)) {
+        if (std::FILE *file = std::fopen(path.c_str(), "rb")) {
+            initial_data.resize(static_cast<size_t>(file_size));
+            if (std::fread(initial_data.data(), initial_data.size(), 1, file) != 1) {
+                initial_data.clear();
+            }
+            std::fclose(file);
+        }
+    }
+    // Drivers are supposed to ignore data from another device, but a file left by another GPU or driver is not worth the risk
+    if (!initial_data.empty()) {
+        VkPipelineCacheHeaderVersionOne header;
+        memcpy(&header, initial_data.data(), sizeof(header));
+        if (header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE || header.vendorID != phys_dev_props.vendorID ||
+            header.deviceID != phys_dev_props.deviceID ||
+            memcmp(header.pipelineCacheUUID, phys_dev_props.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+            initial_data.clear();
+        }
+    }
+
+    VkPipelineCacheCreateInfo cache_ci = vku::InitStructHelper();
+    cache_ci.initialDataSize = initial_data.size();
+    cache_ci.pInitialData = initial_data.empty() ? nullptr : initial_data.data();
+    if (DispatchCreatePipelineCache(device, &cache_ci, nullptr, &validation_pipeline_cache) != VK_SUCCESS) {
+        validation_pipeline_cache = VK_NULL_HANDLE;
+    }
+}
+
+void gpuav::Validator::DestroyValidationPipelineCache() {
+    if (validation_pipeline_cache == VK_NULL_HANDLE) {
+        return;
+    }
+    size_t data_size = 0;
+    std::vector<uint8_t> data;
+    if (DispatchGetPipelineCacheData(device, validation_pipeline_cache, &data_size, nullptr) == VK_SUCCESS && data_size > 0) {
+        data.resize(data_size);
+        if (DispatchGetPipelineCacheData(device, validation_pipeline_cache, &data_size, data.data()) != VK_SUCCESS) {
+            data.clear();
+        }
+    }
+    DispatchDestroyPipelineCache(device, validation_pipeline_cache, nullptr);
+    validation_pipeline_cache = VK_NULL_HANDLE;
+
+    if (!data.empty()) {
+        // Replaced at once, so another process starting meanwhile never reads a partially written file
+        const std::string tmp_path = validation_pipeline_cache_path + ".tmp";
+        if (std::FILE *file = std::fopen(tmp_path.c_str(), "wb")) {
+            const bool written = std::fwrite(data.data(), data_size, 1, file) == 1;
+            std::fclose(file);
+            std::error_code error;
+            if (written) {
+                std::filesystem::rename(tmp_path, validation_pipeline_cache_path, error);
+            } else {
+                std::filesystem::remove(tmp_path, error);
+            }
+        }
+    }
+}
+
 void gpuav::Validator::CreateAccelerationStructureBuildValidationState(const VkDeviceCreateInfo *pCreateInfo) {
     if (aborted) {
         return;
@@ -562,7 +615,8 @@ void gpuav::Validator::CreateAccelerationStructureBuildValidationState(const VkD
         pipeline_ci.stage = pipeline_stage_ci;
         pipeline_ci.layout = as_validation_state.pipeline_layout;
 
-        result = DispatchCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &as_validation_state.pipeline);
+        result = DispatchCreateComputePipelines(device, validation_pipeline_cache, 1, &pipeline_ci, nullptr,
+                                                &as_validation_state.pipeline);
         if (result != VK_SUCCESS) {
             ReportSetupProblem(device, "Failed to create compute pipeline for acceleration structure build validation.");
         }
@@ -688,77 +742,77 @@ void gpuav::AccelerationStructureBuildValidationState::Destroy(VkDevice device,
     initialized = false;
 }
 
-void gpuav::RestorablePipelineState::Create(vvl::CommandBuffer *cb_state, VkPipelineBindPoint bind_point) {
-    pipeline_bind_point = bind_point;
-    const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
-
-    LastBound &last_bound = cb_state->lastBound[lv_bind_point];
-    if (last_bound.pipeline_state) {
-        pipeline = last_bound.pipeline_state->pipeline();
-        pipeline_layout = last_bound.pipeline_layout;
-        descriptor_sets.reserve(last_bound.per_set.size());
-        for (std::size_t i = 0; i < last_bound.per_set.size(); i++) {
-            const auto &bound_descriptor_set = last_bound.per_set[i].bound_descriptor_set;
-            if (bound_descriptor_set) {
-                descriptor_sets.push_back(std::make_pair(bound_descriptor_set->VkHandle(), static_cast<uint32_t>(i)));
-                if (bound_descriptor_set->IsPushDescriptor()) {
-                    push_descriptor_set_index = static_cast<uint32_t>(i);
-                }
-                dynamic_offsets.push_back(last_bound.per_set[i].dynamicOffsets);
-            }
-        }
-
-        if (last_bound.push_descriptor_set) {
-            push_descriptor_set_writes = last_bound.push_descriptor_set->GetWrites();
-        }
-        const auto &pipeline_layout = last_bound.pipeline_state->PipelineLayoutState();
-        if (pipeline_layout->push_constant_ranges == cb_state->push_constant_data_ranges) {
-            push_constants_data = cb_state->push_constant_data;
-            push_constants_ranges = pipeline_layout->push_constant_ranges;
-        }
+void gpuav::RestorablePipelineState::Restore(VkCommandBuffer command_buffer) const {
+    const auto lv_bind_point = ConvertToLvlBindPoint(pipeline_bind_point);
+    const LastBound &last_bound = cb_state.lastBound[lv_bind_point];
+    if (!last_bound.pipeline_state) {
+        return;
     }
-}
 
-void gpuav::RestorablePipelineState::Restore(VkCommandBuffer command_buffer) const {
-    if (pipeline != VK_NULL_HANDLE) {
-        DispatchCmdBindPipeline(command_buffer, pipeline_bind_point, pipeline);
-        if (!descriptor_sets.empty()) {
-            for (std::size_t i = 0; i < descriptor_sets.size(); i++) {
-                VkDescriptorSet descriptor_set = descriptor_sets[i].first;
-                if (descriptor_set != VK_NULL_HANDLE) {
-                    DispatchCmdBindDescriptorSets(command_buffer, pipeline_bind_point, pipeline_layout, descriptor_sets[i].second,
-                                                  1, &descriptor_set, static_cast<uint32_t>(dynamic_offsets[i].size()),
-                                                  dynamic_offsets[i].data());
+    const VkPipeline uninstrumented = static_cast<const CommandBuffer &>(cb_state).uninstrumented_bound[lv_bind_point];
+    const VkPipeline pipeline = uninstrumented != VK_NULL_HANDLE ? uninstrumented : last_bound.pipeline_state->pipeline();
+    DispatchCmdBindPipeline(command_buffer, pipeline_bind_point, pipeline);
+
+    // Sets bound next to each other are rebound with a single call
+    small_vector<VkDescriptorSet, 8, uint32_t> descriptor_sets;
+    small_vector<uint32_t, 16, uint32_t> dynamic_offsets;
+    uint32_t push_descriptor_set_index = 0;
+    const uint32_t set_count = static_cast<uint32_t>(last_bound.per_set.size());
+    for (uint32_t first_set = 0; first_set < set_count;) {
+        uint32_t end_set = first_set;
+        for (; end_set < set_count; end_set++) {
+            const auto &bound_descriptor_set = last_bound.per_set[end_set].bound_descriptor_set;
+            if (!bound_descriptor_set || bound_descriptor_set->IsPushDescriptor()) {
+                if (bound_descriptor_set) {
+                    push_descriptor_set_index = end_set;
                 }
+                break;
             }
         }
-        if (!push_descriptor_set_writes.empty()) {
-            DispatchCmdPushDescriptorSetKHR(command_buffer, pipeline_bind_point, pipeline_layout, push_descriptor_set_index,
-                                            static_cast<uint32_t>(push_descriptor_set_writes.size()),
-                                            reinterpret_cast<const VkWriteDescriptorSet *>(push_descriptor_set_writes.data()));
-        }
-        if (!push_constants_data.empty()) {
-            for (const auto &push_constant_range : *push_constants_ranges) {
-                if (push_constant_range.size == 0) continue;
-                DispatchCmdPushConstants(command_buffer, pipeline_layout, push_constant_range.stageFlags,
-                                         push_constant_range.offset, push_constant_range.size, push_constants_data.data());
+        if (end_set == first_set + 1) {
+            const auto &per_set = last_bound.per_set[first_set];
+            const VkDescriptorSet descriptor_set = per_set.bound_descriptor_set->VkHandle();
+            DispatchCmdBindDescriptorSets(command_buffer, pipeline_bind_point, last_bound.pipeline_layout, first_set, 1,
+                                          &descriptor_set, static_cast<uint32_t>(per_set.dynamicOffsets.size()),
+                                          per_set.dynamicOffsets.data());
+        } else if (end_set > first_set) {
+            descriptor_sets.clear();
+            dynamic_offsets.clear();
+            for (uint32_t set = first_set; set < end_set; set++) {
+                const auto &per_set = last_bound.per_set[set];
+                descriptor_sets.emplace_back(per_set.bound_descriptor_set->VkHandle());
+                for (const uint32_t dynamic_offset : per_set.dynamicOffsets) {
+                    dynamic_offsets.emplace_back(dynamic_offset);
+                }
             }
+            DispatchCmdBindDescriptorSets(command_buffer, pipeline_bind_point, last_bound.pipeline_layout, first_set,
+                                          descriptor_sets.size(), descriptor_sets.data(), dynamic_offsets.size(),
+                                          dynamic_offsets.data());
         }
+        first_set = end_set + 1;
     }
-}
 
-void gpuav::CommandResources::Destroy(gpuav::Validator &validator) {
-    if (output_mem_block.buffer != VK_NULL_HANDLE) {
-        vmaDestroyBuffer(validator.vmaAllocator, output_mem_block.buffer, output_mem_block.allocation);
+    if (last_bound.push_descriptor_set && !last_bound.push_descriptor_set->GetWrites().empty()) {
+        const auto &writes = last_bound.push_descriptor_set->GetWrites();
+        DispatchCmdPushDescriptorSetKHR(command_buffer, pipeline_bind_point, last_bound.pipeline_layout, push_descriptor_set_index,
+                                        static_cast<uint32_t>(writes.size()),
+                                        reinterpret_cast<const VkWriteDescriptorSet *>(writes.data()));
     }
-    if (output_buffer_desc_set != VK_NULL_HANDLE) {
-        validator.desc_set_manager->PutBackDescriptorSet(output_buffer_desc_pool, output_buffer_desc_set);
+
+    const auto &push_constant_ranges = last_bound.pipeline_state->PipelineLayoutState()->push_constant_ranges;
+    if (push_constant_ranges == cb_state.push_constant_data_ranges && !cb_state.push_constant_data.empty()) {
+        for (const auto &push_constant_range : *push_constant_ranges) {
+            if (push_constant_range.size == 0) continue;
+            // The data is kept at the offsets it was pushed to
+            DispatchCmdPushConstants(command_buffer, last_bound.pipeline_layout, push_constant_range.stageFlags,
+                                     push_constant_range.offset, push_constant_range.size,
+                                     cb_state.push_constant_data.data() + push_constant_range.offset);
+        }
     }
-    output_mem_block.buffer = VK_NULL_HANDLE;
-    output_mem_block.allocation = VK_NULL_HANDLE;
-    output_buffer_desc_set = VK_NULL_HANDLE;
 }
 
+void gpuav::CommandResources::Destroy(gpuav::Validator &validator) { output_range = {}; }
+
 void gpuav::PreDrawResources::Destroy(gpuav::Validator &validator) {
     if (buffer_desc_set != VK_NULL_HANDLE) {
         validator.desc_set_manager->PutBackDescriptorSet(desc_pool, buffer_desc_set);
@@ -33,89 +33,92 @@ gpu_tracker::DescriptorSetManager::~DescriptorSetManager() {
 
 VkResult gpu_tracker::DescriptorSetManager::GetDescriptorSet(VkDescriptorPool *out_desc_pool, VkDescriptorSetLayout ds_layout,
                                                              VkDescriptorSet *out_desc_sets) {
-    std::vector<VkDescriptorSet> desc_sets;
-    VkResult result = GetDescriptorSets(1, out_desc_pool, ds_layout, &desc_sets);
+    std::vector<PooledDescriptorSet> desc_sets;
+    VkResult result = GetDescriptorSets(1, ds_layout, desc_sets);
     assert(result == VK_SUCCESS);
     if (result == VK_SUCCESS) {
-        *out_desc_sets = desc_sets[0];
+        *out_desc_pool = desc_sets[0].pool;
+        *out_desc_sets = desc_sets[0].set;
     }
     return result;
 }
 
-VkResult gpu_tracker::DescriptorSetManager::GetDescriptorSets(uint32_t count, VkDescriptorPool *out_pool,
-                                                              VkDescriptorSetLayout ds_layout,
-                                                              std::vector<VkDescriptorSet> *out_desc_sets) {
+VkResult gpu_tracker::DescriptorSetManager::GetDescriptorSets(uint32_t count, VkDescriptorSetLayout ds_layout,
+                                                              std::vector<PooledDescriptorSet> &out_desc_sets) {
     auto guard = Lock();
-    const uint32_t default_pool_size = kItemsPerChunk;
-    VkResult result = VK_SUCCESS;
-    VkDescriptorPool pool_to_use = VK_NULL_HANDLE;
-
     assert(count > 0);
-    if (0 == count) {
-        return result;
-    }
-    out_desc_sets->clear();
-    out_desc_sets->resize(count);
-
-    for (auto &pool : desc_pool_map_) {
-        if (pool.second.used + count < pool.second.size) {
-            pool_to_use = pool.first;
-            break;
+    while (count > 0) {
+        // Prefer the sets that were put back, then the room left in the pools
+        auto pool_to_use = std::find_if(desc_pool_map_.begin(), desc_pool_map_.end(), [ds_layout](const auto &pool) {
+            return pool.second.layout == ds_layout && !pool.second.free_sets.empty();
+        });
+        if (pool_to_use == desc_pool_map_.end()) {
+            pool_to_use = std::find_if(desc_pool_map_.begin(), desc_pool_map_.end(), [ds_layout](const auto &pool) {
+                return pool.second.layout == ds_layout && pool.second.allocated < pool.second.size;
+            });
         }
-    }
-    if (VK_NULL_HANDLE == pool_to_use) {
-        uint32_t pool_count = default_pool_size;
-        if (count > default_pool_size) {
-            pool_count = count;
-        }
-        const VkDescriptorPoolSize size_counts = {
-            VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
-            pool_count * num_bindings_in_set,
-        };
-        VkDescriptorPoolCreateInfo desc_pool_info = vku::InitStructHelper();
-        desc_pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
-        desc_pool_info.maxSets = pool_count;
-        desc_pool_info.poolSizeCount = 1;
-        desc_pool_info.pPoolSizes = &size_counts;
-        result = DispatchCreateDescriptorPool(device, &desc_pool_info, NULL, &pool_to_use);
-        assert(result == VK_SUCCESS);
-        if (result != VK_SUCCESS) {
-            return result;
+        if (pool_to_use == desc_pool_map_.end()) {
+            const uint32_t pool_count = std::max(kItemsPerChunk, count);
+            const VkDescriptorPoolSize size_counts = {
+                VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                pool_count * num_bindings_in_set,
+            };
+            VkDescriptorPoolCreateInfo desc_pool_info = vku::InitStructHelper();
+            desc_pool_info.maxSets = pool_count;
+            desc_pool_info.poolSizeCount = 1;
+            desc_pool_info.pPoolSizes = &size_counts;
+            VkDescriptorPool desc_pool = VK_NULL_HANDLE;
+            VkResult result = DispatchCreateDescriptorPool(device, &desc_pool_info, NULL, &desc_pool);
+            assert(result == VK_SUCCESS);
+            if (result != VK_SUCCESS) {
+                return result;
+            }
+            pool_to_use = desc_pool_map_.emplace(desc_pool, PoolTracker{ds_layout, pool_count, 0, {}}).first;
         }
-        desc_pool_map_[pool_to_use].size = desc_pool_info.maxSets;
-        desc_pool_map_[pool_to_use].used = 0;
-    }
-    std::vector<VkDescriptorSetLayout> desc_layouts(count, ds_layout);
 
-    VkDescriptorSetAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO, NULL, pool_to_use, count,
-                                              desc_layouts.data()};
+        const VkDescriptorPool desc_pool = pool_to_use->first;
+        PoolTracker &tracker = pool_to_use->second;
+        if (tracker.free_sets.empty()) {
+            const uint32_t batch = std::min(tracker.size - tracker.allocated, std::max(count, kAllocationBatch));
+            std::vector<VkDescriptorSetLayout> desc_layouts(batch, ds_layout);
+            VkDescriptorSetAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO, NULL, desc_pool, batch,
+                                                      desc_layouts.data()};
+            tracker.free_sets.resize(batch);
+            VkResult result = DispatchAllocateDescriptorSets(device, &alloc_info, tracker.free_sets.data());
+            assert(result == VK_SUCCESS);
+            if (result != VK_SUCCESS) {
+                tracker.free_sets.clear();
+                return result;
+            }
+            tracker.allocated += batch;
+        }
 
-    result = DispatchAllocateDescriptorSets(device, &alloc_info, out_desc_sets->data());
-    assert(result == VK_SUCCESS);
-    if (result != VK_SUCCESS) {
-        return result;
+        const uint32_t taken = std::min(count, static_cast<uint32_t>(tracker.free_sets.size()));
+        for (uint32_t i = 0; i < taken; ++i) {
+            out_desc_sets.emplace_back(PooledDescriptorSet{desc_pool, tracker.free_sets.back()});
+            tracker.free_sets.pop_back();
+        }
+        count -= taken;
     }
-    *out_pool = pool_to_use;
-    desc_pool_map_[pool_to_use].used += count;
-    return result;
+    return VK_SUCCESS;
 }
 
 void gpu_tracker::DescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set) {
     auto guard = Lock();
     auto iter = desc_pool_map_.find(desc_pool);
     if (iter != desc_pool_map_.end()) {
-        VkResult result = DispatchFreeDescriptorSets(device, desc_pool, 1, &desc_set);
-        assert(result == VK_SUCCESS);
-        if (result != VK_SUCCESS) {
-            return;
-        }
-        desc_pool_map_[desc_pool].used--;
-        if (0 == desc_pool_map_[desc_pool].used) {
-            DispatchDestroyDescriptorPool(device, desc_pool, NULL);
-            desc_pool_map_.erase(desc_pool);
+        iter->second.free_sets.emplace_back(desc_set);
+    }
+}
+
+void gpu_tracker::DescriptorSetManager::PutBackDescriptorSets(const std::vector<PooledDescriptorSet> &desc_sets) {
+    auto guard = Lock();
+    for (const auto &desc_set : desc_sets) {
+        auto iter = desc_pool_map_.find(desc_set.pool);
+        if (iter != desc_pool_map_.end()) {
+            iter->second.free_sets.emplace_back(desc_set.set);
         }
     }
-    return;
 }
 
 // Trampolines to make VMA call Dispatch for Vulkan calls
@@ -227,7 +230,9 @@ VkResult UtilInitializeVma(VkInstance instance, VkPhysicalDevice physical_device
 
 gpu_tracker::CommandBuffer::CommandBuffer(gpu_tracker::Validator *ga, VkCommandBuffer cb,
                                           const VkCommandBufferAllocateInfo *pCreateInfo, const vvl::CommandPool *pool)
-    : vvl::CommandBuffer(ga, cb, pCreateInfo, pool) {}
+    : vvl::CommandBuffer(ga, cb, pCreateInfo, pool),
+      output_arena(ga->output_chunks),
+      instrumentation_desc_sets(ga->desc_set_manager.get(), ga->debug_desc_layout) {}
 
 ReadLockGuard gpu_tracker::Validator::ReadLock() const {
     if (fine_grained_locking) {
@@ -413,10 +418,17 @@ void gpu_tracker::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
         aborted = true;
         return;
     }
+    result_readback = std::make_unique<ResultReadback>(*this);
+    // The instrumentation workers are started by the first pipeline that has more than one shader to instrument
 }
 
 void gpu_tracker::Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                                         const RecordObject &record_obj) {
+    if (result_readback) {
+        result_readback->WaitForAll();
+        result_readback.reset();
+    }
+    instrumentation_workers.reset();
     if (debug_desc_layout) {
         DispatchDestroyDescriptorSetLayout(device, debug_desc_layout, NULL);
         debug_desc_layout = VK_NULL_HANDLE;
@@ -430,6 +442,7 @@ void gpu_tracker::Validator::PreCallRecordDestroyDevice(VkDevice device, const V
     }
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
     // State Tracker can end up making vma calls through callbacks - don't destroy allocator until ST is done
+    output_chunks.Destroy();
     if (output_buffer_pool) {
         vmaDestroyPool(vmaAllocator, output_buffer_pool);
     }
@@ -439,6 +452,27 @@ void gpu_tracker::Validator::PreCallRecordDestroyDevice(VkDevice device, const V
     desc_set_manager.reset();
 }
 
+void gpu_tracker::Validator::CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const {
+    BaseClass::CollectMemoryFootprint(footprint);
+    // A copy of every instrumented shader is kept to map error records back to the original SPIR-V
+    size_t tracked_bytes = 0;
+    size_t tracked_count = 0;
+    shader_map.for_each([&](const uint32_t &, const GpuAssistedShaderTracker &tracker) {
+        tracked_count++;
+        tracked_bytes += vvl::MemoryFootprint::NodeBytes<GpuAssistedShaderTracker>(1) + tracker.pgm.capacity() * sizeof(uint32_t);
+    });
+    footprint.Add("GPU-AV shader tracking", tracked_count, tracked_bytes);
+
+    // Shaders are added to the cache while pipelines are created on other threads, it is walked under its bucket locks
+    size_t cached_count = 0;
+    size_t cache_bytes = 0;
+    instrumented_shaders.ForEachResident([&](uint64_t, const vvl::ShaderCache::Shader &shader) {
+        cached_count++;
+        cache_bytes += vvl::MemoryFootprint::NodeBytes<vvl::ShaderCache::Shader>(1) + shader.code.capacity() * sizeof(uint32_t);
+    });
+    footprint.Add("GPU-AV instrumented shader cache", cached_count, cache_bytes);
+}
+
 gpu_tracker::Queue::Queue(gpu_tracker::Validator &state, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
                           const VkQueueFamilyProperties &queueFamilyProperties)
     : vvl::Queue(state, q, index, flags, queueFamilyProperties), state_(state) {}
@@ -454,55 +488,346 @@ gpu_tracker::Queue::~Queue() {
     }
 }
 
-// Submit a memory barrier on graphics queues.
-// Lazy-create and record the needed command buffer.
-void gpu_tracker::Queue::SubmitBarrier() {
+// Lazy-create and record the command buffer holding the barrier.
+void gpu_tracker::Queue::CreateBarrierCommandBuffer() {
+    VkResult result = VK_SUCCESS;
+
+    VkCommandPoolCreateInfo pool_create_info = vku::InitStructHelper();
+    pool_create_info.queueFamilyIndex = queueFamilyIndex;
+    result = DispatchCreateCommandPool(state_.device, &pool_create_info, nullptr, &barrier_command_pool_);
+    if (result != VK_SUCCESS) {
+        state_.ReportSetupProblem(state_.device, "Unable to create command pool for barrier CB.");
+        barrier_command_pool_ = VK_NULL_HANDLE;
+        return;
+    }
+
+    VkCommandBufferAllocateInfo buffer_alloc_info = vku::InitStructHelper();
+    buffer_alloc_info.commandPool = barrier_command_pool_;
+    buffer_alloc_info.commandBufferCount = 1;
+    buffer_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    result = DispatchAllocateCommandBuffers(state_.device, &buffer_alloc_info, &barrier_command_buffer_);
+    if (result != VK_SUCCESS) {
+        state_.ReportSetupProblem(state_.device, "Unable to create barrier command buffer.");
+        DispatchDestroyCommandPool(state_.device, barrier_command_pool_, nullptr);
+        barrier_command_pool_ = VK_NULL_HANDLE;
+        barrier_command_buffer_ = VK_NULL_HANDLE;
+        return;
+    }
+
+    // Hook up command buffer dispatch
+    state_.vkSetDeviceLoaderData(state_.device, barrier_command_buffer_);
+
+    // Record a global memory barrier to force availability of device memory operations to the host domain.
+    // The readback is asynchronous, so the barrier can be pending in several submissions at once.
+    VkCommandBufferBeginInfo command_buffer_begin_info = vku::InitStructHelper();
+    command_buffer_begin_info.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+    result = DispatchBeginCommandBuffer(barrier_command_buffer_, &command_buffer_begin_info);
+    if (result == VK_SUCCESS) {
+        VkMemoryBarrier memory_barrier = vku::InitStructHelper();
+        memory_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        memory_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        DispatchCmdPipelineBarrier(barrier_command_buffer_, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1,
+                                   &memory_barrier, 0, nullptr, 0, nullptr);
+        DispatchEndCommandBuffer(barrier_command_buffer_);
+    }
+}
+
+VkCommandBuffer gpu_tracker::Queue::BarrierCommandBuffer() {
     if (barrier_command_pool_ == VK_NULL_HANDLE) {
-        VkResult result = VK_SUCCESS;
-
-        VkCommandPoolCreateInfo pool_create_info = vku::InitStructHelper();
-        pool_create_info.queueFamilyIndex = queueFamilyIndex;
-        result = DispatchCreateCommandPool(state_.device, &pool_create_info, nullptr, &barrier_command_pool_);
-        if (result != VK_SUCCESS) {
-            state_.ReportSetupProblem(state_.device, "Unable to create command pool for barrier CB.");
-            barrier_command_pool_ = VK_NULL_HANDLE;
-            return;
+        CreateBarrierCommandBuffer();
+    }
+    return barrier_command_buffer_;
+}
+
+// Submit a memory barrier on graphics queues, followed by the signal of fence.
+// Only used when the barrier can't be appended to the application's submission.
+VkResult gpu_tracker::Queue::SubmitBarrier(VkFence fence) {
+    BarrierCommandBuffer();
+    VkSubmitInfo submit_info = vku::InitStructHelper();
+    if (barrier_command_buffer_ != VK_NULL_HANDLE) {
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &barrier_command_buffer_;
+    }
+    // The fence has to signal even without the barrier, the readback of the submission waits for it
+    return DispatchQueueSubmit(vvl::Queue::VkHandle(), 1, &submit_info, fence);
+}
+
+gpu_tracker::ResultReadback::ResultReadback(Validator &validator) : validator_(validator), thread_(&ResultReadback::Run, this) {}
+
+gpu_tracker::ResultReadback::~ResultReadback() {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        exit_ = true;
+    }
+    work_cv_.notify_all();
+    thread_.join();
+
+    for (auto &submission : pending_) {
+        if (submission.OwnsFence()) {
+            DispatchDestroyFence(validator_.device, submission.fence, nullptr);
+        }
+    }
+    for (VkFence fence : retired_fences_) {
+        DispatchDestroyFence(validator_.device, fence, nullptr);
+    }
+    for (VkFence fence : free_fences_) {
+        DispatchDestroyFence(validator_.device, fence, nullptr);
+    }
+}
+
+VkFence gpu_tracker::ResultReadback::GetFence() {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (!free_fences_.empty()) {
+            VkFence fence = free_fences_.back();
+            free_fences_.pop_back();
+            return fence;
         }
+    }
+    VkFenceCreateInfo fence_create_info = vku::InitStructHelper();
+    VkFence fence = VK_NULL_HANDLE;
+    if (DispatchCreateFence(validator_.device, &fence_create_info, nullptr, &fence) != VK_SUCCESS) {
+        validator_.ReportSetupProblem(validator_.device, "Unable to create fence for result readback.");
+        return VK_NULL_HANDLE;
+    }
+    return fence;
+}
 
-        VkCommandBufferAllocateInfo buffer_alloc_info = vku::InitStructHelper();
-        buffer_alloc_info.commandPool = barrier_command_pool_;
-        buffer_alloc_info.commandBufferCount = 1;
-        buffer_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        result = DispatchAllocateCommandBuffers(state_.device, &buffer_alloc_info, &barrier_command_buffer_);
-        if (result != VK_SUCCESS) {
-            state_.ReportSetupProblem(state_.device, "Unable to create barrier command buffer.");
-            DispatchDestroyCommandPool(state_.device, barrier_command_pool_, nullptr);
-            barrier_command_pool_ = VK_NULL_HANDLE;
-            barrier_command_buffer_ = VK_NULL_HANDLE;
+void gpu_tracker::ResultReadback::RecycleFence(VkFence fence) {
+    std::lock_guard<std::mutex> lock(lock_);
+    free_fences_.push_back(fence);
+}
+
+void gpu_tracker::ResultReadback::Push(VkQueue queue, VkFence fence, VkFence app_fence,
+                                       std::vector<CommandBufferEntry> &&command_buffers,
+                                       std::vector<SemaphoreSignal> &&timeline_signals) {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        pending_.emplace_back(
+            Submission{next_seq_++, queue, fence, app_fence, std::move(command_buffers), std::move(timeline_signals)});
+    }
+    work_cv_.notify_one();
+}
+
+void gpu_tracker::ResultReadback::MarkAppFence(VkQueue queue, VkFence app_fence) {
+    std::lock_guard<std::mutex> lock(lock_);
+    app_fence_marks_[app_fence] = AppFenceMark{queue, next_seq_};
+}
+
+void gpu_tracker::ResultReadback::ForgetAppFence(VkFence app_fence) {
+    std::lock_guard<std::mutex> lock(lock_);
+    app_fence_marks_.erase(app_fence);
+}
+
+// Processes, in submission order, every pending submission matching pred. Submissions already claimed by another thread
+// have a signaled fence, so they are only waited for until that thread is done with them.
+// Blocking on an application fence is fine here: the application can't reset or destroy it before the submission is retired.
+template <typename Predicate>
+void gpu_tracker::ResultReadback::WaitFor(Predicate &&pred) {
+    std::unique_lock<std::mutex> lock(lock_);
+    while (true) {
+        auto it = std::find_if(pending_.begin(), pending_.end(), pred);
+        if (it == pending_.end()) {
             return;
         }
+        if (it->claimed) {
+            done_cv_.wait(lock);
+            continue;
+        }
+        it->claimed = true;
+        lock.unlock();
+        if (DispatchWaitForFences(validator_.device, 1, &it->fence, VK_TRUE, UINT64_MAX) == VK_SUCCESS) {
+            Process(*it);
+        }
+        lock.lock();
+        Retire(it);
+    }
+}
+
+void gpu_tracker::ResultReadback::WaitForAll() {
+    WaitFor([](const Submission &) { return true; });
+}
+
+void gpu_tracker::ResultReadback::WaitForQueue(VkQueue queue) {
+    WaitFor([queue](const Submission &submission) { return submission.queue == queue; });
+}
 
-        // Hook up command buffer dispatch
-        state_.vkSetDeviceLoaderData(state_.device, barrier_command_buffer_);
-
-        // Record a global memory barrier to force availability of device memory operations to the host domain.
-        VkCommandBufferBeginInfo command_buffer_begin_info = vku::InitStructHelper();
-        result = DispatchBeginCommandBuffer(barrier_command_buffer_, &command_buffer_begin_info);
-        if (result == VK_SUCCESS) {
-            VkMemoryBarrier memory_barrier = vku::InitStructHelper();
-            memory_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
-            memory_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
-            DispatchCmdPipelineBarrier(barrier_command_buffer_, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0,
-                                       1, &memory_barrier, 0, nullptr, 0, nullptr);
-            DispatchEndCommandBuffer(barrier_command_buffer_);
+void gpu_tracker::ResultReadback::WaitForAppFence(VkFence app_fence) {
+    uint64_t end_seq = 0;
+    VkQueue queue = VK_NULL_HANDLE;
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        for (const auto &submission : pending_) {
+            if (submission.app_fence == app_fence) {
+                end_seq = submission.seq + 1;
+                queue = submission.queue;
+            }
+        }
+        // The fence was last submitted without anything to read back, it still covers the submissions before it
+        auto mark = app_fence_marks_.find(app_fence);
+        if (mark != app_fence_marks_.end() && mark->second.end_seq > end_seq) {
+            end_seq = mark->second.end_seq;
+            queue = mark->second.queue;
         }
     }
-    if (barrier_command_buffer_ != VK_NULL_HANDLE) {
-        VkSubmitInfo submit_info = vku::InitStructHelper();
-        submit_info.commandBufferCount = 1;
-        submit_info.pCommandBuffers = &barrier_command_buffer_;
-        DispatchQueueSubmit(vvl::Queue::VkHandle(), 1, &submit_info, VK_NULL_HANDLE);
+    if (queue == VK_NULL_HANDLE) {
+        return;
+    }
+    WaitFor([queue, end_seq](const Submission &submission) {
+        return submission.queue == queue && submission.seq < end_seq;
+    });
+}
+
+void gpu_tracker::ResultReadback::WaitForSemaphore(VkSemaphore semaphore, uint64_t value) {
+    // The submissions reaching value can be on several queues
+    std::vector<std::pair<VkQueue, uint64_t>> end_seqs;
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        for (const auto &submission : pending_) {
+            const bool signals = std::any_of(
+                submission.timeline_signals.begin(), submission.timeline_signals.end(),
+                [&](const SemaphoreSignal &signal) { return signal.semaphore == semaphore && signal.value <= value; });
+            if (!signals) continue;
+            auto end_seq = std::find_if(end_seqs.begin(), end_seqs.end(),
+                                        [&](const std::pair<VkQueue, uint64_t> &entry) { return entry.first == submission.queue; });
+            if (end_seq == end_seqs.end()) {
+                end_seqs.emplace_back(submission.queue, submission.seq + 1);
+            } else {
+                end_seq->second = submission.seq + 1;
+            }
+        }
     }
+    for (const auto &[queue, end_seq] : end_seqs) {
+        WaitFor([queue = queue, end_seq = end_seq](const Submission &submission) {
+            return submission.queue == queue && submission.seq < end_seq;
+        });
+    }
+}
+
+// The predicate polls the fences with lock_ held, as Run() does
+void gpu_tracker::ResultReadback::WaitForCompleted() {
+    const VkDevice device = validator_.device;
+    WaitFor([device](const Submission &submission) { return DispatchGetFenceStatus(device, submission.fence) == VK_SUCCESS; });
+}
+
+template <typename Match>
+static bool UsesCommandBuffer(const gpu_tracker::ResultReadback::CommandBufferEntry &entry, const Match &match) {
+    if (match(*entry.cb_state)) {
+        return true;
+    }
+    return std::any_of(entry.cb_state->linkedCommandBuffers.begin(), entry.cb_state->linkedCommandBuffers.end(),
+                       [&match](const vvl::CommandBuffer *secondary) { return match(*secondary); });
+}
+
+void gpu_tracker::ResultReadback::WaitForCommandBuffer(VkCommandBuffer command_buffer) {
+    const auto match = [command_buffer](const vvl::CommandBuffer &cb) { return cb.commandBuffer() == command_buffer; };
+    WaitFor([&match](const Submission &submission) {
+        return std::any_of(submission.command_buffers.begin(), submission.command_buffers.end(),
+                           [&match](const CommandBufferEntry &entry) { return UsesCommandBuffer(entry, match); });
+    });
+}
+
+void gpu_tracker::ResultReadback::WaitForCommandPool(VkCommandPool command_pool) {
+    const auto match = [command_pool](const vvl::CommandBuffer &cb) {
+        return cb.command_pool && cb.command_pool->commandPool() == command_pool;
+    };
+    WaitFor([&match](const Submission &submission) {
+        return std::any_of(submission.command_buffers.begin(), submission.command_buffers.end(),
+                           [&match](const CommandBufferEntry &entry) { return UsesCommandBuffer(entry, match); });
+    });
+}
+
+// Layer fences are waited on here. Application fences are only polled, with lock_ held, as the application may
+// reset or destroy them as soon as the submissions using them are retired; the application threads waiting in
+// WaitForAppFence block on them instead.
+void gpu_tracker::ResultReadback::Run() {
+    std::unique_lock<std::mutex> lock(lock_);
+    std::vector<VkFence> fences;
+    while (!exit_) {
+        // Nobody else waits on retired fences, so they can be reset here
+        if (!retired_fences_.empty()) {
+            DispatchResetFences(validator_.device, static_cast<uint32_t>(retired_fences_.size()), retired_fences_.data());
+            free_fences_.insert(free_fences_.end(), retired_fences_.begin(), retired_fences_.end());
+            retired_fences_.clear();
+        }
+
+        fences.clear();
+        bool polling = false;
+        for (const auto &submission : pending_) {
+            if (!submission.claimed) {
+                if (submission.OwnsFence()) {
+                    fences.push_back(submission.fence);
+                } else {
+                    polling = true;
+                }
+            }
+        }
+        if (fences.empty()) {
+            if (polling) {
+                work_cv_.wait_for(lock, std::chrono::nanoseconds(kWaitTimeout));
+            } else {
+                work_cv_.wait(lock);
+                continue;
+            }
+        } else {
+            lock.unlock();
+            DispatchWaitForFences(validator_.device, static_cast<uint32_t>(fences.size()), fences.data(), VK_FALSE, kWaitTimeout);
+            lock.lock();
+        }
+
+        // Process one signaled submission, the list can change while the lock is released so it is searched again after
+        for (auto it = pending_.begin(); it != pending_.end(); ++it) {
+            if (it->claimed) {
+                continue;
+            }
+            const VkResult status = DispatchGetFenceStatus(validator_.device, it->fence);
+            if (status == VK_SUCCESS) {
+                it->claimed = true;
+                lock.unlock();
+                Process(*it);
+                lock.lock();
+                Retire(it);
+                break;
+            } else if (status != VK_NOT_READY) {
+                // On device loss the output can't be trusted anymore, the submission is dropped
+                Retire(it);
+                break;
+            }
+        }
+    }
+}
+
+void gpu_tracker::ResultReadback::Process(Submission &submission) {
+    // Taken before the command buffer locks, the descriptor set updates can lock the command buffers they invalidate
+    std::unique_lock<std::shared_mutex> descriptors_lock(validator_.descriptor_readback_lock);
+    for (auto &entry : submission.command_buffers) {
+        auto guard = entry.cb_state->WriteLock();
+        entry.cb_state->Process(submission.queue, entry.loc.Get());
+        for (auto *secondary_cmd_base : entry.cb_state->linkedCommandBuffers) {
+            auto *secondary_cb_state = static_cast<CommandBuffer *>(secondary_cmd_base);
+            auto secondary_guard = secondary_cb_state->WriteLock();
+            secondary_cb_state->Process(submission.queue, entry.loc.Get());
+        }
+    }
+}
+
+// Called with lock_ held
+void gpu_tracker::ResultReadback::Retire(SubmissionList::iterator it) {
+    if (it->OwnsFence()) {
+        retired_fences_.push_back(it->fence);
+    }
+    pending_.erase(it);
+    done_cv_.notify_all();
+}
+
+// The output of the command buffers submitted to queues excluded by validated_queue_families is never read back. Command
+// buffers can only be submitted to the queue family of their pool, so their output isn't read by another queue either.
+bool gpu_tracker::Validator::IsQueueValidated(VkQueue queue) const {
+    if (validated_queue_families.empty()) {
+        return true;
+    }
+    auto queue_state = Get<Queue>(queue);
+    return queue_state && IsQueueFamilyValidated(queue_state->queueFamilyIndex);
 }
 
 bool gpu_tracker::Validator::CommandBufferNeedsProcessing(VkCommandBuffer command_buffer) const {
@@ -520,87 +845,456 @@ bool gpu_tracker::Validator::CommandBufferNeedsProcessing(VkCommandBuffer comman
     return false;
 }
 
-void gpu_tracker::Validator::ProcessCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer, const Location &loc) {
-    auto cb_node = GetWrite<gpu_tracker::CommandBuffer>(command_buffer);
+// The barrier command buffer is unprotected and has no device mask, so it can't be added to protected or device group
+// batches
+static bool CanAppendBarrier(const VkSubmitInfo &submit) {
+    if (vku::FindStructInPNextChain<VkDeviceGroupSubmitInfo>(submit.pNext)) {
+        return false;
+    }
+    const auto *protected_submit_info = vku::FindStructInPNextChain<VkProtectedSubmitInfo>(submit.pNext);
+    return !protected_submit_info || !protected_submit_info->protectedSubmit;
+}
+
+static bool CanAppendBarrier(const VkSubmitInfo2 &submit) { return (submit.flags & VK_SUBMIT_PROTECTED_BIT) == 0; }
+
+VkCommandBuffer gpu_tracker::Validator::GetBarrierCommandBuffer(VkQueue queue) {
+    auto queue_state = Get<Queue>(queue);
+    return queue_state ? queue_state->BarrierCommandBuffer() : VK_NULL_HANDLE;
+}
 
-    cb_node->Process(queue, loc);
-    for (auto *secondary_cmd_base : cb_node->linkedCommandBuffers) {
-        auto *secondary_cb_node = static_cast<gpu_tracker::CommandBuffer *>(secondary_cmd_base);
-        auto guard = secondary_cb_node->WriteLock();
-        secondary_cb_node->Process(queue, loc);
+// submitted_fence is the fence the submission was dispatched with, a layer owned one if the application didn't give any.
+// Without barrier_appended, the barrier is submitted on its own with a layer owned fence.
+void gpu_tracker::Validator::PushReadback(VkQueue queue, VkFence app_fence, VkFence submitted_fence, bool barrier_appended,
+                                          std::vector<ResultReadback::CommandBufferEntry> &&command_buffers,
+                                          std::vector<ResultReadback::SemaphoreSignal> &&timeline_signals) {
+    if (!result_readback) {
+        return;
+    }
+    if (command_buffers.empty()) {
+        if (submitted_fence != app_fence) {
+            // The submission failed, so the layer fence was never used
+            result_readback->RecycleFence(submitted_fence);
+        } else if (app_fence != VK_NULL_HANDLE) {
+            // Nothing to read back, but waiting for the fence still means the earlier submissions are done
+            result_readback->MarkAppFence(queue, app_fence);
+        }
+        return;
+    }
+    if (barrier_appended) {
+        if (submitted_fence != VK_NULL_HANDLE) {
+            result_readback->Push(queue, submitted_fence, app_fence, std::move(command_buffers), std::move(timeline_signals));
+        }
+        return;
+    }
+
+    auto queue_state = Get<Queue>(queue);
+    if (!queue_state) {
+        return;
+    }
+    VkFence fence = result_readback->GetFence();
+    if (fence == VK_NULL_HANDLE) {
+        return;
+    }
+    if (queue_state->SubmitBarrier(fence) != VK_SUCCESS) {
+        ReportSetupProblem(queue, "Unable to submit the result readback fence.");
+        DispatchDestroyFence(device, fence, nullptr);
+        return;
+    }
+    // The signals of the submission may come before the separate barrier
+    result_readback->Push(queue, fence, app_fence, std::move(command_buffers), {});
+}
+
+// The output of a command buffer is overwritten by its next submission, make sure it was read back
+void gpu_tracker::Validator::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                                      VkFence fence, const RecordObject &record_obj) {
+    if (result_readback) {
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const VkSubmitInfo *submit = &pSubmits[submit_idx];
+            for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
+                result_readback->WaitForCommandBuffer(submit->pCommandBuffers[i]);
+            }
+        }
     }
+    BaseClass::PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
 }
 
-// Issue a memory barrier to make GPU-written data available to host.
-// Wait for the queue to complete execution.
-// Check the debug buffers for all the command buffers that were submitted.
-void gpu_tracker::Validator::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
-                                                       VkFence fence, const RecordObject &record_obj) {
-    BaseClass::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
+// Append the barrier to the last batch instead of submitting it separately, the signal semaphores of the batch and the
+// fence are signaled after it. If the application has no fence, a layer owned one is used to track the submission.
+void gpu_tracker::Validator::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                                      VkFence fence, const RecordObject &record_obj, void *qs_state) {
+    PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
+    if (aborted || !result_readback || submitCount == 0 || !CanAppendBarrier(pSubmits[submitCount - 1])) return;
+    if (!IsQueueValidated(queue)) return;
 
-    if (aborted || (record_obj.result != VK_SUCCESS)) return;
     bool buffers_present = false;
-    // Don't QueueWaitIdle if there's nothing to process
-    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+    for (uint32_t submit_idx = 0; submit_idx < submitCount && !buffers_present; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
-        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
-            buffers_present |= CommandBufferNeedsProcessing(submit->pCommandBuffers[i]);
+        for (uint32_t i = 0; i < submit->commandBufferCount && !buffers_present; i++) {
+            buffers_present = CommandBufferNeedsProcessing(submit->pCommandBuffers[i]);
         }
     }
     if (!buffers_present) return;
+    VkCommandBuffer barrier_command_buffer = GetBarrierCommandBuffer(queue);
+    if (barrier_command_buffer == VK_NULL_HANDLE) return;
+
+    // Without a fence to track it, the submission is left unchanged and the barrier is submitted on its own
+    VkFence readback_fence = fence;
+    if (readback_fence == VK_NULL_HANDLE) {
+        readback_fence = result_readback->GetFence();
+        if (readback_fence == VK_NULL_HANDLE) return;
+    }
+
+    auto *state = static_cast<queue_submit_api_state *>(qs_state);
+    state->modified_fence = readback_fence;
+    const VkSubmitInfo &last_submit = pSubmits[submitCount - 1];
+    state->modified_command_buffers.assign(last_submit.pCommandBuffers,
+                                           last_submit.pCommandBuffers + last_submit.commandBufferCount);
+    state->modified_command_buffers.push_back(barrier_command_buffer);
+    state->modified_submits.assign(pSubmits, pSubmits + submitCount);
+    state->modified_submits.back().commandBufferCount = static_cast<uint32_t>(state->modified_command_buffers.size());
+    state->modified_submits.back().pCommandBuffers = state->modified_command_buffers.data();
+}
 
-    SubmitBarrier(queue);
+void gpu_tracker::Validator::PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                                          VkFence fence, const RecordObject &record_obj) {
+    PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+}
 
-    DispatchQueueWaitIdle(queue);
+void gpu_tracker::Validator::PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
+                                                          VkFence fence, const RecordObject &record_obj, void *qs_state) {
+    PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj, qs_state);
+}
 
-    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
-        const Location submit_loc = record_obj.location.dot(vvl::Struct::VkSubmitInfo, vvl::Field::pSubmits, submit_idx);
-        const VkSubmitInfo *submit = &pSubmits[submit_idx];
-        for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
-            ProcessCommandBuffer(queue, submit->pCommandBuffers[i], submit_loc.dot(vvl::Field::pCommandBuffers, i));
+void gpu_tracker::Validator::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
+                                                       VkFence fence, const RecordObject &record_obj) {
+    if (result_readback) {
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
+            for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
+                result_readback->WaitForCommandBuffer(submit->pCommandBufferInfos[i].commandBuffer);
+            }
         }
     }
+    BaseClass::PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
 }
 
-void gpu_tracker::Validator::RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
-                                                const RecordObject &record_obj) {
-    if (aborted || (record_obj.result != VK_SUCCESS)) return;
+void gpu_tracker::Validator::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
+                                                       VkFence fence, const RecordObject &record_obj, void *qs_state) {
+    PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+    if (aborted || !result_readback || submitCount == 0 || !CanAppendBarrier(pSubmits[submitCount - 1])) return;
+    if (!IsQueueValidated(queue)) return;
+
     bool buffers_present = false;
-    // Don't QueueWaitIdle if there's nothing to process
-    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+    for (uint32_t submit_idx = 0; submit_idx < submitCount && !buffers_present; submit_idx++) {
         const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
-        for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
-            buffers_present |= CommandBufferNeedsProcessing(submit->pCommandBufferInfos[i].commandBuffer);
+        for (uint32_t i = 0; i < submit->commandBufferInfoCount && !buffers_present; i++) {
+            buffers_present = CommandBufferNeedsProcessing(submit->pCommandBufferInfos[i].commandBuffer);
         }
     }
     if (!buffers_present) return;
+    VkCommandBuffer barrier_command_buffer = GetBarrierCommandBuffer(queue);
+    if (barrier_command_buffer == VK_NULL_HANDLE) return;
+
+    // Without a fence to track it, the submission is left unchanged and the barrier is submitted on its own
+    VkFence readback_fence = fence;
+    if (readback_fence == VK_NULL_HANDLE) {
+        readback_fence = result_readback->GetFence();
+        if (readback_fence == VK_NULL_HANDLE) return;
+    }
 
-    SubmitBarrier(queue);
+    auto *state = static_cast<queue_submit2_api_state *>(qs_state);
+    state->modified_fence = readback_fence;
+    const VkSubmitInfo2 &last_submit = pSubmits[submitCount - 1];
+    state->modified_command_buffers.assign(last_submit.pCommandBufferInfos,
+                                           last_submit.pCommandBufferInfos + last_submit.commandBufferInfoCount);
+    VkCommandBufferSubmitInfo barrier_info = vku::InitStructHelper();
+    barrier_info.commandBuffer = barrier_command_buffer;
+    state->modified_command_buffers.push_back(barrier_info);
+    state->modified_submits.assign(pSubmits, pSubmits + submitCount);
+    state->modified_submits.back().commandBufferInfoCount = static_cast<uint32_t>(state->modified_command_buffers.size());
+    state->modified_submits.back().pCommandBufferInfos = state->modified_command_buffers.data();
+}
+
+static bool IsTimelineSemaphore(const ValidationStateTracker &state, VkSemaphore semaphore) {
+    auto semaphore_state = state.Get<vvl::Semaphore>(semaphore);
+    return semaphore_state && semaphore_state->type == VK_SEMAPHORE_TYPE_TIMELINE;
+}
+
+// The timeline semaphores signaled by the batch the barrier was appended to, they signal after the barrier
+static std::vector<gpu_tracker::ResultReadback::SemaphoreSignal> GetTimelineSignals(const ValidationStateTracker &state,
+                                                                                    const VkSubmitInfo &submit) {
+    std::vector<gpu_tracker::ResultReadback::SemaphoreSignal> signals;
+    const auto *timeline_info = vku::FindStructInPNextChain<VkTimelineSemaphoreSubmitInfo>(submit.pNext);
+    if (!timeline_info || !timeline_info->pSignalSemaphoreValues) {
+        return signals;
+    }
+    const uint32_t count = std::min(submit.signalSemaphoreCount, timeline_info->signalSemaphoreValueCount);
+    for (uint32_t i = 0; i < count; i++) {
+        if (IsTimelineSemaphore(state, submit.pSignalSemaphores[i])) {
+            signals.push_back({submit.pSignalSemaphores[i], timeline_info->pSignalSemaphoreValues[i]});
+        }
+    }
+    return signals;
+}
 
-    DispatchQueueWaitIdle(queue);
+static std::vector<gpu_tracker::ResultReadback::SemaphoreSignal> GetTimelineSignals(const ValidationStateTracker &state,
+                                                                                    const VkSubmitInfo2 &submit) {
+    std::vector<gpu_tracker::ResultReadback::SemaphoreSignal> signals;
+    for (uint32_t i = 0; i < submit.signalSemaphoreInfoCount; i++) {
+        const VkSemaphoreSubmitInfo &signal = submit.pSignalSemaphoreInfos[i];
+        if (IsTimelineSemaphore(state, signal.semaphore)) {
+            signals.push_back({signal.semaphore, signal.value});
+        }
+    }
+    return signals;
+}
 
-    for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
-        const Location submit_loc = record_obj.location.dot(vvl::Struct::VkSubmitInfo2, vvl::Field::pSubmits, submit_idx);
-        const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
-        for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
-            ProcessCommandBuffer(queue, submit->pCommandBufferInfos[i].commandBuffer,
-                                 submit_loc.dot(vvl::Struct::VkCommandBufferSubmitInfo, vvl::Field::pCommandBufferInfos, i));
+// The debug buffers of the submitted command buffers are checked once the fence following the barrier signals.
+void gpu_tracker::Validator::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                                       VkFence fence, const RecordObject &record_obj, void *qs_state) {
+    PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
+    const auto *state = static_cast<const queue_submit_api_state *>(qs_state);
+
+    // Don't submit the barrier if there's nothing to process
+    std::vector<ResultReadback::CommandBufferEntry> command_buffers;
+    if (!aborted && record_obj.result == VK_SUCCESS && IsQueueValidated(queue)) {
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const Location submit_loc = record_obj.location.dot(vvl::Struct::VkSubmitInfo, vvl::Field::pSubmits, submit_idx);
+            const VkSubmitInfo *submit = &pSubmits[submit_idx];
+            for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
+                if (CommandBufferNeedsProcessing(submit->pCommandBuffers[i])) {
+                    command_buffers.push_back({Get<CommandBuffer>(submit->pCommandBuffers[i]),
+                                               LocationCapture(submit_loc.dot(vvl::Field::pCommandBuffers, i))});
+                }
+            }
         }
     }
+    const bool barrier_appended = !state->modified_submits.empty();
+    PushReadback(queue, fence, state->modified_fence, barrier_appended, std::move(command_buffers),
+                 barrier_appended ? GetTimelineSignals(*this, pSubmits[submitCount - 1])
+                                  : std::vector<ResultReadback::SemaphoreSignal>());
 }
 
 void gpu_tracker::Validator::PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
-                                                           VkFence fence, const RecordObject &record_obj) {
-    PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+                                                           VkFence fence, const RecordObject &record_obj, void *qs_state) {
+    PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj, qs_state);
 }
 
 void gpu_tracker::Validator::PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
-                                                        VkFence fence, const RecordObject &record_obj) {
-    BaseClass::PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
-    RecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+                                                        VkFence fence, const RecordObject &record_obj, void *qs_state) {
+    PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+    const auto *state = static_cast<const queue_submit2_api_state *>(qs_state);
+
+    // Don't submit the barrier if there's nothing to process
+    std::vector<ResultReadback::CommandBufferEntry> command_buffers;
+    if (!aborted && record_obj.result == VK_SUCCESS && IsQueueValidated(queue)) {
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const Location submit_loc = record_obj.location.dot(vvl::Struct::VkSubmitInfo2, vvl::Field::pSubmits, submit_idx);
+            const VkSubmitInfo2 *submit = &pSubmits[submit_idx];
+            for (uint32_t i = 0; i < submit->commandBufferInfoCount; i++) {
+                const VkCommandBuffer command_buffer = submit->pCommandBufferInfos[i].commandBuffer;
+                if (CommandBufferNeedsProcessing(command_buffer)) {
+                    command_buffers.push_back({Get<CommandBuffer>(command_buffer),
+                                               LocationCapture(submit_loc.dot(vvl::Struct::VkCommandBufferSubmitInfo,
+                                                                              vvl::Field::pCommandBufferInfos, i))});
+                }
+            }
+        }
+    }
+    const bool barrier_appended = !state->modified_submits.empty();
+    PushReadback(queue, fence, state->modified_fence, barrier_appended, std::move(command_buffers),
+                 barrier_appended ? GetTimelineSignals(*this, pSubmits[submitCount - 1])
+                                  : std::vector<ResultReadback::SemaphoreSignal>());
+}
+
+// Errors of the finished submissions are reported before the host wait returns to the application
+void gpu_tracker::Validator::PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObject &record_obj) {
+    BaseClass::PostCallRecordQueueWaitIdle(queue, record_obj);
+    if (result_readback && record_obj.result == VK_SUCCESS) {
+        result_readback->WaitForQueue(queue);
+    }
+}
+
+void gpu_tracker::Validator::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObject &record_obj) {
+    BaseClass::PostCallRecordDeviceWaitIdle(device, record_obj);
+    if (result_readback && record_obj.result == VK_SUCCESS) {
+        result_readback->WaitForAll();
+    }
+}
+
+void gpu_tracker::Validator::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences,
+                                                         VkBool32 waitAll, uint64_t timeout, const RecordObject &record_obj) {
+    BaseClass::PostCallRecordWaitForFences(device, fenceCount, pFences, waitAll, timeout, record_obj);
+    if (!result_readback || record_obj.result != VK_SUCCESS) return;
+    for (uint32_t i = 0; i < fenceCount; i++) {
+        // With waitAll == VK_FALSE only the signaled fences are known to be done
+        if (waitAll || DispatchGetFenceStatus(device, pFences[i]) == VK_SUCCESS) {
+            result_readback->WaitForAppFence(pFences[i]);
+        }
+    }
+}
+
+void gpu_tracker::Validator::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, const RecordObject &record_obj) {
+    BaseClass::PostCallRecordGetFenceStatus(device, fence, record_obj);
+    if (result_readback && record_obj.result == VK_SUCCESS) {
+        result_readback->WaitForAppFence(fence);
+    }
+}
+
+// Submissions tracked with an application fence must be retired before the fence can be reused
+void gpu_tracker::Validator::PreCallRecordResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences,
+                                                      const RecordObject &record_obj) {
+    if (result_readback) {
+        for (uint32_t i = 0; i < fenceCount; i++) {
+            result_readback->WaitForAppFence(pFences[i]);
+        }
+    }
+    BaseClass::PreCallRecordResetFences(device, fenceCount, pFences, record_obj);
+}
+
+void gpu_tracker::Validator::PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator,
+                                                       const RecordObject &record_obj) {
+    if (result_readback) {
+        result_readback->WaitForAppFence(fence);
+        result_readback->ForgetAppFence(fence);
+    }
+    BaseClass::PreCallRecordDestroyFence(device, fence, pAllocator, record_obj);
+}
+
+// The timeline semaphores observed by the host are as good as a fence for the submissions that signal them
+void gpu_tracker::Validator::PostCallRecordWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
+                                                          const RecordObject &record_obj) {
+    BaseClass::PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, record_obj);
+    if (!result_readback || record_obj.result != VK_SUCCESS) return;
+    const bool wait_any = (pWaitInfo->flags & VK_SEMAPHORE_WAIT_ANY_BIT) != 0;
+    for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; i++) {
+        // With VK_SEMAPHORE_WAIT_ANY_BIT only the ones that reached their value are known to be done
+        uint64_t value = pWaitInfo->pValues[i];
+        if (wait_any && DispatchGetSemaphoreCounterValue(device, pWaitInfo->pSemaphores[i], &value) != VK_SUCCESS) {
+            continue;
+        }
+        result_readback->WaitForSemaphore(pWaitInfo->pSemaphores[i], value);
+    }
+    result_readback->WaitForCompleted();
+}
+
+void gpu_tracker::Validator::PostCallRecordWaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo,
+                                                             uint64_t timeout, const RecordObject &record_obj) {
+    PostCallRecordWaitSemaphores(device, pWaitInfo, timeout, record_obj);
+}
+
+void gpu_tracker::Validator::PostCallRecordGetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t *pValue,
+                                                                    const RecordObject &record_obj) {
+    BaseClass::PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, record_obj);
+    if (!result_readback || record_obj.result != VK_SUCCESS) return;
+    result_readback->WaitForSemaphore(semaphore, *pValue);
+    result_readback->WaitForCompleted();
+}
+
+void gpu_tracker::Validator::PostCallRecordGetSemaphoreCounterValueKHR(VkDevice device, VkSemaphore semaphore, uint64_t *pValue,
+                                                                       const RecordObject &record_obj) {
+    PostCallRecordGetSemaphoreCounterValue(device, semaphore, pValue, record_obj);
+}
+
+// An event set by a command buffer can't be tied to a fence, and the rest of the submission may still wait on the host, so
+// only the submissions that are already done are processed
+void gpu_tracker::Validator::PostCallRecordGetEventStatus(VkDevice device, VkEvent event, const RecordObject &record_obj) {
+    BaseClass::PostCallRecordGetEventStatus(device, event, record_obj);
+    if (result_readback && record_obj.result == VK_EVENT_SET) {
+        result_readback->WaitForCompleted();
+    }
+}
+
+// The readback thread may be reading the descriptor sets of a submission that is done, see descriptor_readback_lock
+void gpu_tracker::Validator::PreCallRecordUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
+                                                               const VkWriteDescriptorSet *pDescriptorWrites,
+                                                               uint32_t descriptorCopyCount,
+                                                               const VkCopyDescriptorSet *pDescriptorCopies,
+                                                               const RecordObject &record_obj) {
+    ReadLockGuard guard(descriptor_readback_lock);
+    BaseClass::PreCallRecordUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
+                                                 pDescriptorCopies, record_obj);
+}
+
+void gpu_tracker::Validator::PreCallRecordUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet,
+                                                                          VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                                          const void *pData, const RecordObject &record_obj) {
+    ReadLockGuard guard(descriptor_readback_lock);
+    BaseClass::PreCallRecordUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData, record_obj);
+}
+
+void gpu_tracker::Validator::PreCallRecordUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet,
+                                                                             VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                                             const void *pData, const RecordObject &record_obj) {
+    ReadLockGuard guard(descriptor_readback_lock);
+    BaseClass::PreCallRecordUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData, record_obj);
+}
+
+void gpu_tracker::Validator::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t count,
+                                                             const VkDescriptorSet *pDescriptorSets,
+                                                             const RecordObject &record_obj) {
+    ReadLockGuard guard(descriptor_readback_lock);
+    BaseClass::PreCallRecordFreeDescriptorSets(device, descriptorPool, count, pDescriptorSets, record_obj);
+}
+
+void gpu_tracker::Validator::PostCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                                               VkDescriptorPoolResetFlags flags, const RecordObject &record_obj) {
+    ReadLockGuard guard(descriptor_readback_lock);
+    BaseClass::PostCallRecordResetDescriptorPool(device, descriptorPool, flags, record_obj);
+}
+
+void gpu_tracker::Validator::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                                                const VkAllocationCallbacks *pAllocator,
+                                                                const RecordObject &record_obj) {
+    ReadLockGuard guard(descriptor_readback_lock);
+    BaseClass::PreCallRecordDestroyDescriptorPool(device, descriptorPool, pAllocator, record_obj);
+}
+
+void gpu_tracker::Validator::PreCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer,
+                                                             const VkCommandBufferBeginInfo *pBeginInfo,
+                                                             const RecordObject &record_obj) {
+    if (result_readback) {
+        result_readback->WaitForCommandBuffer(commandBuffer);
+    }
+    BaseClass::PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
+}
+
+void gpu_tracker::Validator::PreCallRecordResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags,
+                                                             const RecordObject &record_obj) {
+    if (result_readback) {
+        result_readback->WaitForCommandBuffer(commandBuffer);
+    }
+    BaseClass::PreCallRecordResetCommandBuffer(commandBuffer, flags, record_obj);
+}
+
+void gpu_tracker::Validator::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool,
+                                                             uint32_t commandBufferCount, const VkCommandBuffer *pCommandBuffers,
+                                                             const RecordObject &record_obj) {
+    if (result_readback) {
+        for (uint32_t i = 0; i < commandBufferCount; i++) {
+            result_readback->WaitForCommandBuffer(pCommandBuffers[i]);
+        }
+    }
+    BaseClass::PreCallRecordFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers, record_obj);
+}
+
+void gpu_tracker::Validator::PreCallRecordResetCommandPool(VkDevice device, VkCommandPool commandPool,
+                                                           VkCommandPoolResetFlags flags, const RecordObject &record_obj) {
+    if (result_readback) {
+        result_readback->WaitForCommandPool(commandPool);
+    }
+    BaseClass::PreCallRecordResetCommandPool(device, commandPool, flags, record_obj);
+}
+
+void gpu_tracker::Validator::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
+                                                             const VkAllocationCallbacks *pAllocator,
+                                                             const RecordObject &record_obj) {
+    if (result_readback) {
+        result_readback->WaitForCommandPool(commandPool);
+    }
+    BaseClass::PreCallRecordDestroyCommandPool(device, commandPool, pAllocator, record_obj);
 }
 
-// Just gives a warning about a possible deadlock.
 bool gpu_tracker::Validator::ValidateCmdWaitEvents(VkCommandBuffer command_buffer, VkPipelineStageFlags2 src_stage_mask,
                                                    const Location &loc) const {
     if (src_stage_mask & VK_PIPELINE_STAGE_2_HOST_BIT) {
@@ -934,6 +1628,25 @@ bool gpu_tracker::Validator::CheckForGpuAvEnabled(const void *pNext) {
     return false;
 }
 
+void gpu_tracker::Validator::ParallelInstrument(size_t count, const std::function<void(size_t)> &instrument) {
+    if (count > 1) {
+        // Devices that never instrument more than one shader at once don't pay for the threads
+        std::call_once(instrumentation_workers_once, [this]() {
+            const uint32_t worker_count = vvl::WorkerPool::WorkerCount(0);
+            if (worker_count > 0) {
+                instrumentation_workers = std::make_unique<vvl::WorkerPool>(worker_count);
+            }
+        });
+    }
+    if (count > 1 && instrumentation_workers) {
+        instrumentation_workers->ParallelFor(count, instrument);
+    } else {
+        for (size_t index = 0; index < count; ++index) {
+            instrument(index);
+        }
+    }
+}
+
 // Examine the pipelines to see if they use the debug descriptor set binding index.
 // If any do, create new non-instrumented shader modules and use them to replace the instrumented
 // shaders in the pipeline.  Return the (possibly) modified create infos to the caller.
@@ -949,6 +1662,19 @@ void gpu_tracker::Validator::PreCallRecordPipelineCreations(uint32_t count, cons
         return;
     }
 
+    // Shaders of pipeline libraries that are defined at pipeline creation time and still need to be instrumented
+    struct PendingStage {
+        uint32_t pipeline;
+        VkShaderStageFlagBits stage;
+        std::shared_ptr<vvl::ShaderModule> module_state;
+        create_shader_module_api_state *csm_state = nullptr;
+        uint64_t cache_key = 0;
+        bool cached = false;
+        bool pass = false;
+    };
+    std::vector<PendingStage> pending_stages;
+    const size_t first_new_create_info = new_pipeline_create_infos->size();
+
     // Walk through all the pipelines, make a copy of each and flag each pipeline that contains a shader that uses the debug
     // descriptor set index.
     for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
@@ -994,56 +1720,71 @@ void gpu_tracker::Validator::PreCallRecordPipelineCreations(uint32_t count, cons
                     if (!module_state->Handle()) {
                         // If the shader module's handle is non-null, then it was defined with CreateShaderModule and covered by the
                         // case above. Otherwise, it is being defined during CGPL time
-                        if (cgpl_state.shader_states.size() <= pipeline) {
-                            cgpl_state.shader_states.resize(pipeline + 1);
-                        }
                         const VkShaderStageFlagBits stage = stage_state.GetStage();
-                        // Now find the corresponding VkShaderModuleCreateInfo
                         auto &stage_ci =
                             GetShaderStageCI<SafeCreateInfo, safe_VkPipelineShaderStageCreateInfo>(new_pipeline_ci, stage);
-                        // We're modifying the copied, safe create info, which is ok to be non-const
-                        auto sm_ci =
-                            const_cast<safe_VkShaderModuleCreateInfo *>(reinterpret_cast<const safe_VkShaderModuleCreateInfo *>(
-                                vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext)));
+                        auto sm_ci = vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext);
                         if (gpuav_settings.select_instrumented_shaders && sm_ci && !CheckForGpuAvEnabled(sm_ci->pNext)) continue;
-                        auto &csm_state = cgpl_state.shader_states[pipeline][stage];
-                        bool cached = false;
-                        bool pass = false;
-                        if (gpuav_settings.cache_instrumented_shaders) {
-                            csm_state.unique_shader_id =
-                                hash_util::ShaderHash(module_state->spirv->words_.data(), module_state->spirv->words_.size());
-                            auto it = instrumented_shaders.find(csm_state.unique_shader_id);
-                            if (it != instrumented_shaders.end()) {
-                                csm_state.instrumented_spirv = it->second.second;
-                                cached = true;
-                            }
-                        } else {
-                            csm_state.unique_shader_id = unique_shader_module_id++;
-                        }
-                        if (!cached) {
-                            pass = InstrumentShader(module_state->spirv->words_, csm_state.instrumented_spirv,
-                                                    csm_state.unique_shader_id, record_obj.location);
-                        }
-                        if (cached || pass) {
-                            module_state->gpu_validation_shader_id = csm_state.unique_shader_id;
-                            // Now we need to update the shader code in VkShaderModuleCreateInfo
-                            // module_state->Handle() == VK_NULL_HANDLE should imply sm_ci != nullptr, but checking here anyway
-                            if (sm_ci) {
-                                sm_ci->SetCode(csm_state.instrumented_spirv);
-                            }
-                            if (gpuav_settings.cache_instrumented_shaders && !cached) {
-                                instrumented_shaders.emplace(
-                                    csm_state.unique_shader_id,
-                                    std::make_pair(csm_state.instrumented_spirv.size(), csm_state.instrumented_spirv));
-                            }
-                        }
+                        pending_stages.push_back({pipeline, stage, std::move(module_state)});
                     }
                 }
             }
         }
         new_pipeline_create_infos->push_back(std::move(new_pipeline_ci));
     }
+    if (pending_stages.empty()) {
+        return;
+    }
+
+    // The shader states are only resized once, so the pointers taken below stay valid
+    if (cgpl_state.shader_states.size() < count) {
+        cgpl_state.shader_states.resize(count);
+    }
+    for (auto &pending : pending_stages) {
+        pending.csm_state = &cgpl_state.shader_states[pending.pipeline][pending.stage];
+        const auto &words = pending.module_state->spirv->words_;
+        if (gpuav_settings.cache_instrumented_shaders) {
+            pending.csm_state->unique_shader_id = hash_util::ShaderHash(words.data(), words.size());
+            pending.cache_key = InstrumentedShaderKey(words.data(), words.size() * sizeof(uint32_t));
+            if (auto shader = instrumented_shaders.Find(pending.cache_key)) {
+                pending.csm_state->unique_shader_id = shader->shader_id;
+                pending.csm_state->instrumented_spirv = shader->code;
+                pending.cached = true;
+            }
+        } else {
+            pending.csm_state->unique_shader_id = unique_shader_module_id++;
+        }
+    }
+
+    // Every stage of every pipeline in the batch is instrumented independently
+    ParallelInstrument(pending_stages.size(), [&](size_t index) {
+        auto &pending = pending_stages[index];
+        if (!pending.cached) {
+            pending.pass = InstrumentShader(pending.module_state->spirv->words_, pending.csm_state->instrumented_spirv,
+                                            pending.csm_state->unique_shader_id, record_obj.location);
+        }
+    });
+
+    for (auto &pending : pending_stages) {
+        if (!pending.cached && !pending.pass) continue;
+        auto &csm_state = *pending.csm_state;
+        pending.module_state->gpu_validation_shader_id = csm_state.unique_shader_id;
+        // Now we need to update the shader code in VkShaderModuleCreateInfo
+        auto &stage_ci = GetShaderStageCI<SafeCreateInfo, safe_VkPipelineShaderStageCreateInfo>(
+            (*new_pipeline_create_infos)[first_new_create_info + pending.pipeline], pending.stage);
+        // We're modifying the copied, safe create info, which is ok to be non-const
+        auto sm_ci = const_cast<safe_VkShaderModuleCreateInfo *>(reinterpret_cast<const safe_VkShaderModuleCreateInfo *>(
+            vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext)));
+        // module_state->Handle() == VK_NULL_HANDLE should imply sm_ci != nullptr, but checking here anyway
+        if (sm_ci) {
+            sm_ci->SetCode(csm_state.instrumented_spirv);
+        }
+        if (gpuav_settings.cache_instrumented_shaders && !pending.cached) {
+            instrumented_shaders.Add(pending.cache_key, csm_state.unique_shader_id, csm_state.instrumented_spirv);
+        }
+    }
 }
+
 // For every pipeline:
 // - For every shader in a pipeline:
 //   - If the shader had to be replaced in PreCallRecord (because the pipeline is using the debug desc set index):
@@ -15,8 +15,20 @@
  * limitations under the License.
  */
 #pragma once
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+
 #include "generated/chassis.h"
+#include "gpu_validation/gpu_buffer_pool.h"
+#include "gpu_validation/gpu_descriptor_set_cache.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "utils/hash_util.h"
+#include "utils/shader_cache.h"
+#include "utils/worker_pool.h"
 #include "vma/vma.h"
 
 namespace gpu_tracker {
@@ -28,9 +40,13 @@ class Queue : public vvl::Queue {
     Queue(Validator &state, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
           const VkQueueFamilyProperties &queueFamilyProperties);
     virtual ~Queue();
-    void SubmitBarrier();
+    // Primary command buffer with the host availability barrier, VK_NULL_HANDLE if it couldn't be created
+    VkCommandBuffer BarrierCommandBuffer();
+    VkResult SubmitBarrier(VkFence fence);
 
   private:
+    void CreateBarrierCommandBuffer();
+
     Validator &state_;
     VkCommandPool barrier_command_pool_{VK_NULL_HANDLE};
     VkCommandBuffer barrier_command_buffer_{VK_NULL_HANDLE};
@@ -42,6 +58,100 @@ class CommandBuffer : public vvl::CommandBuffer {
 
     virtual bool NeedsProcessing() const = 0;
     virtual void Process(VkQueue queue, const Location &loc) = 0;
+
+    // Per command output buffers, given back when the command buffer is reset or destroyed
+    BufferArena output_arena;
+    // Per command sets of debug_desc_layout, kept when the command buffer is reset and given back when it is destroyed
+    DescriptorSetCache instrumentation_desc_sets;
+};
+
+// Reads back the instrumentation output of submitted command buffers once the GPU is done with them, so a submission
+// doesn't have to wait for the queue to go idle.
+//
+// Every submission that needs processing ends with the host availability barrier and is tracked with a fence, the
+// application's one or a layer owned one. A background thread processes the submissions whose fence has signaled.
+// Whoever is about to reuse or destroy the output of a pending submission calls one of the WaitFor functions first, which
+// processes the matching submissions on the calling thread. So do the calls through which the application can observe that
+// a submission is done, so its errors are reported first.
+// The caller must not hold the lock of any of the command buffers involved, nor Validator::descriptor_readback_lock.
+class ResultReadback {
+  public:
+    struct CommandBufferEntry {
+        std::shared_ptr<CommandBuffer> cb_state;
+        LocationCapture loc;
+    };
+    struct SemaphoreSignal {
+        VkSemaphore semaphore;
+        uint64_t value;
+    };
+
+    explicit ResultReadback(Validator &validator);
+    ~ResultReadback();
+
+    // Returns VK_NULL_HANDLE if no fence could be created
+    VkFence GetFence();
+    // For a fence from GetFence that was never submitted
+    void RecycleFence(VkFence fence);
+    // fence signals after the barrier that follows the command buffers, app_fence is the one given to the submission.
+    // They are the same when the application's fence is used to track the submission.
+    // timeline_signals are the timeline semaphore signals that come after the barrier.
+    void Push(VkQueue queue, VkFence fence, VkFence app_fence, std::vector<CommandBufferEntry> &&command_buffers,
+              std::vector<SemaphoreSignal> &&timeline_signals);
+    // For a submission of app_fence with nothing to read back, the fence still covers what was submitted to queue before it
+    void MarkAppFence(VkQueue queue, VkFence app_fence);
+    void ForgetAppFence(VkFence app_fence);
+
+    void WaitForAll();
+    void WaitForQueue(VkQueue queue);
+    // Everything submitted to the queue of app_fence up to the submission that signals it
+    void WaitForAppFence(VkFence app_fence);
+    // Everything submitted to a queue up to the last submission signaling semaphore with at most value
+    void WaitForSemaphore(VkSemaphore semaphore, uint64_t value);
+    // The submissions whose fence has already signaled, without blocking
+    void WaitForCompleted();
+    // Includes submissions where command_buffer is executed as a secondary
+    void WaitForCommandBuffer(VkCommandBuffer command_buffer);
+    void WaitForCommandPool(VkCommandPool command_pool);
+
+  private:
+    struct Submission {
+        uint64_t seq;
+        VkQueue queue;
+        VkFence fence;
+        VkFence app_fence;
+        std::vector<CommandBufferEntry> command_buffers;
+        std::vector<SemaphoreSignal> timeline_signals;
+        bool claimed = false;  // being processed, only the claiming thread touches it
+
+        bool OwnsFence() const { return fence != app_fence; }
+    };
+    using SubmissionList = std::list<Submission>;
+
+    template <typename Predicate>
+    void WaitFor(Predicate &&pred);
+    void Run();
+    void Process(Submission &submission);
+    void Retire(SubmissionList::iterator it);
+
+    // Poll interval of the background thread, so submissions pushed while it waits are picked up
+    static constexpr uint64_t kWaitTimeout = 10 * 1000 * 1000;
+
+    Validator &validator_;
+    std::mutex lock_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    SubmissionList pending_;
+    uint64_t next_seq_ = 0;
+    struct AppFenceMark {
+        VkQueue queue;
+        uint64_t end_seq;  // the submissions of queue before it
+    };
+    vvl::unordered_map<VkFence, AppFenceMark> app_fence_marks_;
+    // Signaled fences can only be reset while the background thread isn't waiting on them
+    std::vector<VkFence> retired_fences_;
+    std::vector<VkFence> free_fences_;
+    bool exit_ = false;
+    std::thread thread_;
 };
 }  // namespace gpu_tracker
 
@@ -54,23 +164,32 @@ static const VkShaderStageFlags kShaderStageAllRayTracing =
     VK_SHADER_STAGE_ANY_HIT_BIT_KHR | VK_SHADER_STAGE_CALLABLE_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR |
     VK_SHADER_STAGE_INTERSECTION_BIT_KHR | VK_SHADER_STAGE_MISS_BIT_KHR | VK_SHADER_STAGE_RAYGEN_BIT_KHR;
 
+// Put back descriptor sets are kept to be handed out again, instead of being freed, and sets are allocated a batch at a time,
+// which keeps the vkAllocateDescriptorSets calls and the time spent holding the lock down.
+// The pools are only destroyed with the manager.
 class DescriptorSetManager {
   public:
     DescriptorSetManager(VkDevice device, uint32_t num_bindings_in_set);
     ~DescriptorSetManager();
 
     VkResult GetDescriptorSet(VkDescriptorPool *out_desc_pool, VkDescriptorSetLayout ds_layout, VkDescriptorSet *out_desc_sets);
-    VkResult GetDescriptorSets(uint32_t count, VkDescriptorPool *out_pool, VkDescriptorSetLayout ds_layout,
-                               std::vector<VkDescriptorSet> *out_desc_sets);
+    // Appends count sets to out_desc_sets, they can come from different pools
+    VkResult GetDescriptorSets(uint32_t count, VkDescriptorSetLayout ds_layout, std::vector<PooledDescriptorSet> &out_desc_sets);
     void PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set);
+    void PutBackDescriptorSets(const std::vector<PooledDescriptorSet> &desc_sets);
 
   private:
     std::unique_lock<std::mutex> Lock() const { return std::unique_lock<std::mutex>(lock_); }
 
     static const uint32_t kItemsPerChunk = 512;
+    // Sets allocated at once when none were put back
+    static const uint32_t kAllocationBatch = 32;
     struct PoolTracker {
+        // A pool only holds sets of one layout, so put back sets can be handed out again without being reallocated
+        VkDescriptorSetLayout layout;
         uint32_t size;
-        uint32_t used;
+        uint32_t allocated;
+        std::vector<VkDescriptorSet> free_sets;
     };
     VkDevice device;
     uint32_t num_bindings_in_set;
@@ -98,17 +217,74 @@ class Validator : public ValidationStateTracker {
                                    const VkAllocationCallbacks *pAllocator, VkDevice *pDevice, const RecordObject &record_obj,
                                    void *modified_create_info) override;
     void CreateDevice(const VkDeviceCreateInfo *pCreateInfo) override;
+    void CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const override;
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                     const RecordObject &record_obj) override;
 
-    void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
+    // The plain overloads are still the ones derived validators override
+    using BaseClass::PostCallRecordQueueSubmit;
+    using BaseClass::PostCallRecordQueueSubmit2;
+    void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
+                                  const RecordObject &record_obj) override;
+    void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
+                                  const RecordObject &record_obj, void *qs_state) override;
+    void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits, VkFence fence,
+                                      const RecordObject &record_obj) override;
+    void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits, VkFence fence,
+                                      const RecordObject &record_obj, void *qs_state) override;
+    void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
                                    const RecordObject &record_obj) override;
-    void RecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits, VkFence fence,
-                            const RecordObject &record_obj);
+    void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
+                                   const RecordObject &record_obj, void *qs_state) override;
+    void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
+                                   const RecordObject &record_obj, void *qs_state) override;
     void PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits, VkFence fence,
-                                       const RecordObject &record_obj) override;
+                                       const RecordObject &record_obj, void *qs_state) override;
     void PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
-                                    const RecordObject &record_obj) override;
+                                    const RecordObject &record_obj, void *qs_state) override;
+    void PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObject &record_obj) override;
+    void PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObject &record_obj) override;
+    void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
+                                     uint64_t timeout, const RecordObject &record_obj) override;
+    void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, const RecordObject &record_obj) override;
+    void PreCallRecordResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences,
+                                  const RecordObject &record_obj) override;
+    void PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator,
+                                   const RecordObject &record_obj) override;
+    void PostCallRecordWaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
+                                      const RecordObject &record_obj) override;
+    void PostCallRecordWaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout,
+                                         const RecordObject &record_obj) override;
+    void PostCallRecordGetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t *pValue,
+                                                const RecordObject &record_obj) override;
+    void PostCallRecordGetSemaphoreCounterValueKHR(VkDevice device, VkSemaphore semaphore, uint64_t *pValue,
+                                                   const RecordObject &record_obj) override;
+    void PostCallRecordGetEventStatus(VkDevice device, VkEvent event, const RecordObject &record_obj) override;
+    void PreCallRecordUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
+                                           const VkWriteDescriptorSet *pDescriptorWrites, uint32_t descriptorCopyCount,
+                                           const VkCopyDescriptorSet *pDescriptorCopies, const RecordObject &record_obj) override;
+    void PreCallRecordUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet,
+                                                      VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void *pData,
+                                                      const RecordObject &record_obj) override;
+    void PreCallRecordUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet,
+                                                         VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void *pData,
+                                                         const RecordObject &record_obj) override;
+    void PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t count,
+                                         const VkDescriptorSet *pDescriptorSets, const RecordObject &record_obj) override;
+    void PostCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags,
+                                           const RecordObject &record_obj) override;
+    void PreCallRecordDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                            const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) override;
+    void PreCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo,
+                                         const RecordObject &record_obj) override;
+    void PreCallRecordResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags,
+                                         const RecordObject &record_obj) override;
+    void PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
+                                         const VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) override;
+    void PreCallRecordResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags,
+                                       const RecordObject &record_obj) override;
+    void PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks *pAllocator,
+                                         const RecordObject &record_obj) override;
     bool ValidateCmdWaitEvents(VkCommandBuffer command_buffer, VkPipelineStageFlags2 src_stage_mask, const Location &loc) const;
     bool PreCallValidateCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
                                       VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
@@ -188,15 +364,12 @@ class Validator : public ValidationStateTracker {
     bool CheckForGpuAvEnabled(const void *pNext);
 
   protected:
+    bool IsQueueValidated(VkQueue queue) const;
     bool CommandBufferNeedsProcessing(VkCommandBuffer command_buffer) const;
-    void ProcessCommandBuffer(VkQueue queue, VkCommandBuffer command_buffer, const Location &loc);
-
-    void SubmitBarrier(VkQueue queue) {
-        auto queue_state = Get<Queue>(queue);
-        if (queue_state) {
-            queue_state->SubmitBarrier();
-        }
-    }
+    VkCommandBuffer GetBarrierCommandBuffer(VkQueue queue);
+    void PushReadback(VkQueue queue, VkFence app_fence, VkFence submitted_fence, bool barrier_appended,
+                      std::vector<ResultReadback::CommandBufferEntry> &&command_buffers,
+                      std::vector<ResultReadback::SemaphoreSignal> &&timeline_signals);
 
     std::shared_ptr<vvl::Queue> CreateQueue(VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
                                             const VkQueueFamilyProperties &queueFamilyProperties) override {
@@ -214,13 +387,26 @@ class Validator : public ValidationStateTracker {
                                          const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                          const VkPipelineBindPoint bind_point, const SafeCreateInfo &modified_create_infos);
 
+    // Called concurrently for the shaders of one create call, and from any thread creating shaders or pipelines, so it must
+    // only read the device wide state
     virtual bool InstrumentShader(const vvl::span<const uint32_t> &input, std::vector<uint32_t> &new_pgm, uint32_t unique_shader_id,
                                   const Location &loc) = 0;
+    uint64_t InstrumentedShaderKey(const void *code, size_t code_size) const {
+        return hash_util::Hash64(code, code_size, instrumented_shader_seed);
+    }
+    // Calls instrument(index) for each of the count independent tasks on the instrumentation workers, like the shaders of one
+    // create call or the chunks of descriptors validated after a submission
+    void ParallelInstrument(size_t count, const std::function<void(size_t)> &instrument);
+    // Room for a good number of per command output buffers, so most command buffers only ever use a single chunk
+    VkDeviceSize OutputChunkSize() const { return std::max<VkDeviceSize>(256 * 1024, output_buffer_size); }
 
   public:
     mutable bool aborted = false;
     bool force_buffer_device_address;
-    vvl::unordered_map<uint32_t, std::pair<size_t, std::vector<uint32_t>>> instrumented_shaders;
+    // Shared by all the threads creating shaders and pipelines, see InstrumentedShaderKey
+    vvl::ShaderCache instrumented_shaders;
+    // Covers the device state that changes the instrumented code, so differently configured devices don't share entries
+    uint64_t instrumented_shader_seed = 0;
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
     const char *setup_vuid;
     VkPhysicalDeviceFeatures supported_features{};
@@ -234,7 +420,16 @@ class Validator : public ValidationStateTracker {
     uint32_t desc_set_bind_index = 0;
     VmaAllocator vmaAllocator = {};
     VmaPool output_buffer_pool = VK_NULL_HANDLE;
+    // Sub allocated into the per command output buffers, so recording a command doesn't allocate or map memory
+    BufferChunkPool output_chunks;
     std::unique_ptr<DescriptorSetManager> desc_set_manager;
+    std::unique_ptr<ResultReadback> result_readback;
+    // Processing a submission reads the descriptor sets it used, on the readback thread, after the application may already
+    // know it is done. It holds this exclusively, the descriptor set updates and frees hold it shared.
+    mutable std::shared_mutex descriptor_readback_lock;
+    // Created on first use by ParallelInstrument()
+    std::once_flag instrumentation_workers_once;
+    std::unique_ptr<vvl::WorkerPool> instrumentation_workers;
     vl_concurrent_unordered_map<uint32_t, GpuAssistedShaderTracker> shader_map;
     std::vector<VkDescriptorSetLayoutBinding> bindings_;
 };
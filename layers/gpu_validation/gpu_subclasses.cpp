@@ -115,6 +115,22 @@ void gpuav::AccelerationStructureNV::NotifyInvalidate(const NodeList &invalid_no
     vvl::AccelerationStructureNV::NotifyInvalidate(invalid_nodes, unlink);
 }
 
+bool gpuav::DescBindingInfo::SameDescriptors(const DescBindingInfo &other) const {
+    if (pipeline_state != other.pipeline_state || descriptor_set_buffers.size() != other.descriptor_set_buffers.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < descriptor_set_buffers.size(); i++) {
+        const DescSetState &set = descriptor_set_buffers[i];
+        const DescSetState &other_set = other.descriptor_set_buffers[i];
+        // An update after bind set has no gpu_state yet in either, the one picked at submission is used for both
+        if (set.num != other_set.num || set.state != other_set.state || set.gpu_state != other_set.gpu_state ||
+            set.output_state != other_set.output_state) {
+            return false;
+        }
+    }
+    return true;
+}
+
 gpuav::CommandBuffer::CommandBuffer(gpuav::Validator *ga, VkCommandBuffer cb, const VkCommandBufferAllocateInfo *pCreateInfo,
                                     const vvl::CommandPool *pool)
     : gpu_tracker::CommandBuffer(ga, cb, pCreateInfo, pool) {}
@@ -123,6 +139,7 @@ gpuav::CommandBuffer::~CommandBuffer() { Destroy(); }
 
 void gpuav::CommandBuffer::Destroy() {
     ResetCBState();
+    instrumentation_desc_sets.Release();
     vvl::CommandBuffer::Destroy();
 }
 
@@ -131,6 +148,22 @@ void gpuav::CommandBuffer::Reset() {
     ResetCBState();
 }
 
+void gpuav::CommandBuffer::CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const {
+    vvl::CommandBuffer::CollectMemoryFootprint(footprint);
+    constexpr size_t kCommandResourcesSize =
+        std::max({sizeof(PreDrawResources), sizeof(PreDispatchResources), sizeof(PreTraceRaysResources)});
+    footprint.Add("GPU-AV per command resources", per_command_resources.size(),
+                  per_command_resources.capacity() * sizeof(std::unique_ptr<CommandResources>) +
+                      per_command_resources.size() * kCommandResourcesSize);
+
+    size_t binding_bytes = di_input_buffer_list.capacity() * sizeof(DescBindingInfo);
+    for (const auto &binding_info : di_input_buffer_list) {
+        binding_bytes += binding_info.descriptor_set_buffers.capacity() * sizeof(DescSetState);
+    }
+    footprint.Add("GPU-AV descriptor binding state", di_input_buffer_list.size(), binding_bytes);
+    footprint.AddVector("GPU-AV acceleration structure validation", as_validation_buffers);
+}
+
 void gpuav::CommandBuffer::ResetCBState() {
     auto gpuav = static_cast<Validator *>(dev_data);
     // Free the device memory and descriptor set(s) associated with a command buffer.
@@ -139,12 +172,17 @@ void gpuav::CommandBuffer::ResetCBState() {
         cmd_info->Destroy(*gpuav);
     }
     per_command_resources.clear();
+    pending_pre_draw_validations.clear();
+    pending_pre_dispatch_validations.clear();
 
-    for (auto &buffer_info : di_input_buffer_list) {
-        vmaDestroyBuffer(gpuav->vmaAllocator, buffer_info.bindless_state_buffer, buffer_info.bindless_state_buffer_allocation);
-    }
     di_input_buffer_list.clear();
-    current_bindless_buffer = VK_NULL_HANDLE;
+    current_bindless_state = {};
+    errors_logged = {};
+    adaptive_bound = {};
+    uninstrumented_bound = {};
+    // Only now that nothing refers to them anymore
+    output_arena.Reset();
+    instrumentation_desc_sets.Reset();
 
     for (auto &as_validation_buffer_info : as_validation_buffers) {
         gpuav->Destroy(as_validation_buffer_info);
@@ -160,6 +198,10 @@ void gpuav::CommandBuffer::Process(VkQueue queue, const Location &loc) {
         uint32_t compute_index = 0;
         uint32_t ray_trace_index = 0;
 
+        uint32_t *errors_logged_word = static_cast<uint32_t *>(errors_logged.mapped);
+        const bool any_error_logged = !errors_logged_word || *errors_logged_word != 0;
+        // Each adaptive pipeline counts once per submission, however many commands used it
+        vvl::unordered_map<AdaptivePipeline *, bool> adaptive_errors;
         for (auto &cmd_info : per_command_resources) {
             uint32_t operation_index = 0;
             if (cmd_info->pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
@@ -171,27 +213,47 @@ void gpuav::CommandBuffer::Process(VkQueue queue, const Location &loc) {
             } else {
                 assert(false);
             }
-            cmd_info->LogErrorIfAny(*device_state, queue, commandBuffer(), operation_index);
+            bool error_logged = false;
+            if (any_error_logged || cmd_info->AlwaysReadBack()) {
+                error_logged = cmd_info->LogErrorIfAny(*device_state, queue, commandBuffer(), operation_index);
+            }
+            if (cmd_info->adaptive_pipeline) {
+                adaptive_errors[cmd_info->adaptive_pipeline.get()] |= error_logged;
+            }
+        }
+        if (errors_logged_word && *errors_logged_word != 0) {
+            // Also forget the reported errors, so the next submission reports them again
+            memset(errors_logged_word, 0, sizeof(uint32_t) * errors_logged_words);
+        }
+        for (const auto &adaptive : adaptive_errors) {
+            adaptive.first->RecordSubmission(adaptive.second);
         }
 
         // For each vkCmdBindDescriptorSets()...
         // Some applications repeatedly call vkCmdBindDescriptorSets() with the same descriptor sets, avoid
         // checking them multiple times.
+        struct UsedBinding {
+            vvl::DescriptorSet *set;
+            vvl::DescriptorBindingInfo binding_info;
+            std::vector<uint32_t> indices;
+        };
+        std::vector<UsedBinding> used_bindings;
         vvl::unordered_set<VkDescriptorSet> validated_desc_sets;
         for (auto &di_info : di_input_buffer_list) {
-            Location draw_loc(vvl::Func::vkCmdDraw);
             // For each descriptor set ...
             for (auto &set : di_info.descriptor_set_buffers) {
                 if (validated_desc_sets.count(set.state->VkHandle()) > 0) {
                     continue;
                 }
                 validated_desc_sets.emplace(set.state->VkHandle());
-                assert(set.output_state);
+                // Not tracked when validate_used_descriptors is off
+                if (!set.output_state) {
+                    continue;
+                }
 
-                vvl::DescriptorValidator context(*device_state, *this, *set.state, VK_NULL_HANDLE /*framebuffer*/, draw_loc);
                 auto used_descs = set.output_state->UsedDescriptors(*set.state);
                 // For each used binding ...
-                for (const auto &u : used_descs) {
+                for (auto &u : used_descs) {
                     auto iter = set.binding_req.find(u.first);
                     vvl::DescriptorBindingInfo binding_info;
                     binding_info.first = u.first;
@@ -199,10 +261,44 @@ void gpuav::CommandBuffer::Process(VkQueue queue, const Location &loc) {
                         binding_info.second.emplace_back(iter->second);
                         ++iter;
                     }
-                    context.ValidateBinding(binding_info, u.second);
+                    used_bindings.emplace_back(UsedBinding{set.state.get(), std::move(binding_info), std::move(u.second)});
                 }
             }
         }
+
+        Location draw_loc(vvl::Func::vkCmdDraw);
+        // Recording the image layouts changes the command buffer, do it for all the bindings before validating any of them
+        for (const auto &used : used_bindings) {
+            vvl::DescriptorValidator context(*device_state, *this, *used.set, VK_NULL_HANDLE /*framebuffer*/, draw_loc);
+            context.UpdateDrawState(used.binding_info.first, used.indices);
+        }
+
+        // A bindless binding can have hundreds of thousands of used descriptors, split them so they are validated on all the
+        // workers. The messages are reported in the same order as if it was all done on this thread.
+        constexpr size_t kDescriptorsPerChunk = 256;
+        struct Chunk {
+            const UsedBinding *used;
+            size_t first;
+            size_t count;
+        };
+        std::vector<Chunk> chunks;
+        for (const auto &used : used_bindings) {
+            for (size_t first = 0; first < used.indices.size(); first += kDescriptorsPerChunk) {
+                chunks.emplace_back(Chunk{&used, first, std::min(kDescriptorsPerChunk, used.indices.size() - first)});
+            }
+        }
+        std::vector<DeferredMessages> messages(chunks.size());
+        device_state->ParallelInstrument(chunks.size(), [&](size_t chunk_index) {
+            const Chunk &chunk = chunks[chunk_index];
+            DeferMessagesScope defer(messages[chunk_index]);
+            const vvl::DescriptorValidator context(*device_state, *this, *chunk.used->set, VK_NULL_HANDLE /*framebuffer*/,
+                                                   draw_loc);
+            context.ValidateBindingIndices(chunk.used->binding_info,
+                                           vvl::make_span(chunk.used->indices.data() + chunk.first, chunk.count));
+        });
+        for (auto &chunk_messages : messages) {
+            chunk_messages.Report();
+        }
     }
     ProcessAccelerationStructure(queue);
 }
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <vector>
 #include <mutex>
 
@@ -46,9 +48,36 @@ struct DeviceMemoryBlock {
 };
 
 struct DescBindingInfo {
-    VkBuffer bindless_state_buffer;
-    VmaAllocation bindless_state_buffer_allocation;
+    gpu_tracker::BufferRange bindless_state;  // glsl::BindlessStateBuffer in the output_arena of the command buffer
     std::vector<DescSetState> descriptor_set_buffers;
+    const vvl::Pipeline *pipeline_state = nullptr;  // where the binding_req of the sets came from, only compared
+
+    // True if the bindless state built for other can be used as is for these sets
+    bool SameDescriptors(const DescBindingInfo &other) const;
+};
+
+// With gpuav_adaptive_instrumentation, a pipeline that validated clean in enough submissions in a row is bound without
+// instrumentation, except for sampled binds that keep checking it.
+struct AdaptivePipeline {
+    VkPipeline uninstrumented = VK_NULL_HANDLE;  // created from the original create info, owned by the Validator
+    std::atomic<uint32_t> clean_submissions{0};
+    std::atomic<uint32_t> uninstrumented_binds{0};
+
+    // Called when the pipeline gets bound, and decides which copy gets bound
+    bool UseInstrumented(uint32_t threshold) {
+        if (clean_submissions.load(std::memory_order_relaxed) < threshold) {
+            return true;
+        }
+        return uninstrumented_binds.fetch_add(1, std::memory_order_relaxed) % threshold == threshold - 1;
+    }
+    // Called once per submission that ran the instrumented copy
+    void RecordSubmission(bool error_logged) {
+        if (error_logged) {
+            clean_submissions.store(0, std::memory_order_relaxed);
+        } else {
+            clean_submissions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
 };
 
 struct CommonDrawResources {
@@ -146,20 +175,22 @@ class CommandResources {
     CommandResources(const CommandResources &) = default;
     CommandResources &operator=(const CommandResources &) = default;
 
-    void LogErrorIfAny(gpuav::Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer, const uint32_t operation_index);
+    // Returns true if the instrumentation wrote anything
+    bool LogErrorIfAny(gpuav::Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer, const uint32_t operation_index);
+    // The pre action validation shaders write to the output buffer without setting CommandBuffer::errors_logged
+    virtual bool AlwaysReadBack() const { return false; }
     // Return true iff an error has been logged
     virtual bool LogValidationMessage(gpuav::Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer,
                                       const uint32_t *debug_record, const uint32_t operation_index, const LogObjectList &objlist);
 
-    DeviceMemoryBlock output_mem_block;
+    gpu_tracker::BufferRange output_range;  // in the output_arena of the command buffer
 
-    VkDescriptorSet output_buffer_desc_set = VK_NULL_HANDLE;
-    VkDescriptorPool output_buffer_desc_pool = VK_NULL_HANDLE;
     VkPipelineBindPoint pipeline_bind_point = VK_PIPELINE_BIND_POINT_MAX_ENUM;
     bool uses_robustness = false;  // Only used in AnalyseAndeGenerateMessages, to output using LogWarning instead of LogError. It needs to be removed
     vvl::Func command = vvl::Func::Empty;  // Should probably use Location instead
     uint32_t desc_binding_index = vvl::kU32Max;// desc_binding is only used to help generate an error message
     std::vector<DescBindingInfo> *desc_binding_list = nullptr;
+    std::shared_ptr<AdaptivePipeline> adaptive_pipeline;  // set when the command ran the instrumented copy of one
 };
 
 class PreDrawResources : public CommandResources {
@@ -175,8 +206,12 @@ class PreDrawResources : public CommandResources {
     VkDeviceSize indirect_buffer_size = 0;
     static constexpr uint32_t push_constant_words = 11;
     bool emit_task_error = false;  // Used to decide between mesh error and task error
+    // The validation draw, recorded by Validator::RecordPendingPreActionValidation
+    uint32_t push_constants[push_constant_words] = {};
+    uint32_t vertex_count = 0;
 
     void Destroy(gpuav::Validator &validator) final;
+    bool AlwaysReadBack() const final { return true; }
     bool LogValidationMessage(gpuav::Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer, const uint32_t *debug_record,
                               const uint32_t operation_index, const LogObjectList &objlist);
 };
@@ -190,8 +225,11 @@ class PreDispatchResources : public CommandResources {
     VkBuffer indirect_buffer = VK_NULL_HANDLE;
     VkDeviceSize indirect_buffer_offset = 0;
     static constexpr uint32_t push_constant_words = 4;
+    // The validation dispatch, recorded by Validator::RecordPendingPreActionValidation
+    uint32_t push_constants[push_constant_words] = {};
 
     void Destroy(gpuav::Validator &validator) final;
+    bool AlwaysReadBack() const final { return true; }
     bool LogValidationMessage(gpuav::Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer, const uint32_t *debug_record,
                               const uint32_t operation_index, const LogObjectList &objlist);
 };
@@ -206,6 +244,7 @@ class PreTraceRaysResources : public CommandResources {
     static constexpr uint32_t push_constant_words = 5;
 
     void Destroy(gpuav::Validator &validator) final;
+    bool AlwaysReadBack() const final { return true; }
     bool LogValidationMessage(gpuav::Validator &validator, VkQueue queue, VkCommandBuffer cmd_buffer, const uint32_t *debug_record,
                               const uint32_t operation_index, const LogObjectList &objlist);
 };
@@ -214,10 +253,21 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
   public:
     // per validated command state
     std::vector<std::unique_ptr<CommandResources>> per_command_resources;
+    // Entries of per_command_resources whose validation is recorded at the next synchronization command
+    std::vector<const PreDrawResources *> pending_pre_draw_validations;
+    std::vector<const PreDispatchResources *> pending_pre_dispatch_validations;
     // per vkCmdBindDescriptorSet() state
     std::vector<DescBindingInfo> di_input_buffer_list;
     std::vector<AccelerationStructureBuildValidationInfo> as_validation_buffers;
-    VkBuffer current_bindless_buffer = VK_NULL_HANDLE;
+    gpu_tracker::BufferRange current_bindless_state;
+    // Word the instrumentation sets when it writes a record to the output buffer of any of the commands, so most readbacks
+    // don't have to look at each of them, followed by the table of errors already reported during the submission
+    gpu_tracker::BufferRange errors_logged;
+    static constexpr uint32_t errors_logged_words = 1 + glsl::kInstReportedErrorsSize;
+    // The bound pipeline when it is tracked by gpuav_adaptive_instrumentation and bound instrumented, index is LvlBindPoint
+    std::array<std::shared_ptr<AdaptivePipeline>, BindPoint_Count> adaptive_bound;
+    // The uninstrumented copy actually bound in place of the last bound pipeline, index is LvlBindPoint
+    std::array<VkPipeline, BindPoint_Count> uninstrumented_bound{};
 
     CommandBuffer(Validator *ga, VkCommandBuffer cb, const VkCommandBufferAllocateInfo *pCreateInfo, const vvl::CommandPool *pool);
     ~CommandBuffer();
@@ -227,6 +277,7 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
 
     void Destroy() final;
     void Reset() final;
+    void CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const final;
 
   private:
     void ResetCBState();
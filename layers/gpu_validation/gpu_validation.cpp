@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
@@ -101,6 +102,8 @@ bool gpuav::Validator::InstrumentShader(const vvl::span<const uint32_t> &input,
                                         const uint32_t unique_shader_id, const Location &loc) {
     if (aborted) return false;
     if (input[0] != spv::MagicNumber) return false;
+    // Nothing is checked in the shaders, e.g. with the indirect-only preset, they run as the application wrote them
+    if (!gpuav_settings.validate_descriptors && !buffer_device_address_enabled) return false;
 
     const spvtools::MessageConsumer gpu_console_message_consumer =
         [this, loc](spv_message_level_t level, const char *, const spv_position_t &position, const char *message) -> void {
@@ -140,9 +143,7 @@ bool gpuav::Validator::InstrumentShader(const vvl::span<const uint32_t> &input,
             inst_passes.RegisterPass(CreateInstBindlessCheckPass(unique_shader_id));
         }
 
-        if ((IsExtEnabled(device_extensions.vk_ext_buffer_device_address) ||
-             IsExtEnabled(device_extensions.vk_khr_buffer_device_address)) &&
-            shaderInt64 && enabled_features.bufferDeviceAddress) {
+        if (buffer_device_address_enabled) {
             inst_passes.RegisterPass(CreateInstBuffAddrCheckPass(unique_shader_id));
         }
         if (!inst_passes.Run(binaries[0].data(), binaries[0].size(), &binaries[0], opt_options)) {
@@ -221,36 +222,36 @@ bool gpuav::Validator::InstrumentShader(const vvl::span<const uint32_t> &input,
     return true;
 }
 
-bool gpuav::Validator::CheckForCachedInstrumentedShader(uint32_t shader_hash, create_shader_module_api_state *csm_state) {
-    auto it = instrumented_shaders.find(shader_hash);
-    if (it != instrumented_shaders.end()) {
-        csm_state->instrumented_create_info.codeSize = it->second.first * sizeof(uint32_t);
-        csm_state->instrumented_create_info.pCode = it->second.second.data();
-        csm_state->instrumented_spirv = it->second.second;
-        csm_state->unique_shader_id = shader_hash;
+bool gpuav::Validator::CheckForCachedInstrumentedShader(uint64_t cache_key, create_shader_module_api_state *csm_state) {
+    auto cached = instrumented_shaders.Find(cache_key);
+    if (cached) {
+        // Keep a copy in the api state for the down-chain call
+        csm_state->instrumented_spirv = cached->code;
+        csm_state->instrumented_create_info.codeSize = csm_state->instrumented_spirv.size() * sizeof(uint32_t);
+        csm_state->instrumented_create_info.pCode = csm_state->instrumented_spirv.data();
+        csm_state->unique_shader_id = cached->shader_id;
         return true;
     }
     return false;
 }
 
-bool gpuav::Validator::CheckForCachedInstrumentedShader(uint32_t index, uint32_t shader_hash,
+bool gpuav::Validator::CheckForCachedInstrumentedShader(uint32_t index, uint64_t cache_key,
                                                         create_shader_object_api_state *cso_state) {
-    auto it = instrumented_shaders.find(shader_hash);
-    if (it != instrumented_shaders.end()) {
-        cso_state->instrumented_create_info[index].codeSize = it->second.first * sizeof(uint32_t);
-        cso_state->instrumented_create_info[index].pCode = it->second.second.data();
+    auto cached = instrumented_shaders.Find(cache_key);
+    if (cached) {
+        cso_state->instrumented_spirv[index] = cached->code;
+        cso_state->instrumented_create_info[index].codeSize = cso_state->instrumented_spirv[index].size() * sizeof(uint32_t);
+        cso_state->instrumented_create_info[index].pCode = cso_state->instrumented_spirv[index].data();
+        cso_state->unique_shader_ids[index] = cached->shader_id;
         return true;
     }
     return false;
 }
 
-// For the given command buffer, map its debug data buffers and update the status of any update after bind descriptors
+// For the given command buffer, update the status of any update after bind descriptors in its persistently mapped debug data
 void gpuav::Validator::UpdateInstrumentationBuffer(CommandBuffer *cb_node) {
     for (auto &cmd_info : cb_node->di_input_buffer_list) {
-        glsl::BindlessStateBuffer *bindless_state{nullptr};
-        [[maybe_unused]] VkResult result;
-        result = vmaMapMemory(vmaAllocator, cmd_info.bindless_state_buffer_allocation, reinterpret_cast<void **>(&bindless_state));
-        assert(result == VK_SUCCESS);
+        auto *bindless_state = static_cast<glsl::BindlessStateBuffer *>(cmd_info.bindless_state.mapped);
         assert(bindless_state->global_state == desc_heap->GetDeviceAddress());
         for (size_t i = 0; i < cmd_info.descriptor_set_buffers.size(); i++) {
             auto &set_buffer = cmd_info.descriptor_set_buffers[i];
@@ -259,67 +260,153 @@ void gpuav::Validator::UpdateInstrumentationBuffer(CommandBuffer *cb_node) {
                 set_buffer.gpu_state = set_buffer.state->GetCurrentState();
                 bindless_state->desc_sets[i].in_data = set_buffer.gpu_state->device_addr;
             }
-            if (!set_buffer.output_state) {
+            if (!set_buffer.output_state && gpuav_settings.validate_used_descriptors) {
                 set_buffer.output_state = set_buffer.state->GetOutputState();
                 bindless_state->desc_sets[i].out_data = set_buffer.output_state->device_addr;
             }
         }
-        vmaUnmapMemory(vmaAllocator, cmd_info.bindless_state_buffer_allocation);
     }
 }
 
-void gpuav::Validator::UpdateBDABuffer(DeviceMemoryBlock device_address_buffer) {
-    if (gpuav_bda_buffer_version == buffer_device_address_ranges_version) {
-        return;
+void gpuav::Validator::CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const {
+    BaseClass::CollectMemoryFootprint(footprint);
+    // Not memory the layer holds, but reported along with it to see how much descriptor state each submission writes
+    const uint64_t submits = descriptor_state_stats.submits.load();
+    const uint64_t full_bytes = descriptor_state_stats.full_bytes.load();
+    const uint64_t incremental_bytes = descriptor_state_stats.incremental_bytes.load();
+    footprint.Add("GPU-AV descriptor state full uploads", static_cast<size_t>(descriptor_state_stats.full_uploads.load()),
+                  static_cast<size_t>(full_bytes));
+    footprint.Add("GPU-AV descriptor state incremental uploads",
+                  static_cast<size_t>(descriptor_state_stats.incremental_uploads.load()), static_cast<size_t>(incremental_bytes));
+    if (submits > 0) {
+        footprint.Add("GPU-AV descriptor state uploaded per submission", static_cast<size_t>(submits),
+                      static_cast<size_t>((full_bytes + incremental_bytes) / submits));
+    }
+}
+
+// Example BDA input buffer assuming 2 buffers using BDA, and room for N:
+// Word 0          | Index of start of buffer sizes (N + 3)
+// Word 1          | 0x0000000000000000
+// Word 2          | Device Address of first buffer  (Addresses sorted in ascending order)
+// Word 3          | Device Address of second buffer
+// Word 4          | 0xffffffffffffffff
+// Word N + 3      | 0 (size of pretend buffer at word 1)
+// Word N + 4      | Size in bytes of first buffer
+// Word N + 5      | Size in bytes of second buffer
+// Word N + 6      | 0 (size of pretend buffer in word 4)
+// Word 2 * N + 5  | Number of addresses, including the NULL address and the terminator (4)
+//
+// The sizes start at a fixed index, so the entries before the first changed one stay in place and an update only rewrites
+// the entries from there to the end of the list. The instrumentation binary searches the addresses using the count.
+VkDeviceSize gpuav::Validator::BDATableSize(uint32_t capacity) {
+    return (1 + (VkDeviceSize(capacity) + 2) + (VkDeviceSize(capacity) + 2) + 1) * sizeof(uint64_t);
+}
+
+bool gpuav::Validator::CreateBDATable(uint32_t capacity) {
+    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    buffer_info.size = BDATableSize(capacity);
+    VmaAllocationCreateInfo alloc_info = {};
+    // This buffer could be very large if an application uses many buffers. Allocating it as HOST_CACHED
+    // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
+    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    BDATable table{};
+    table.capacity = capacity;
+    VkResult result =
+        vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &table.block.buffer, &table.block.allocation, nullptr);
+    if (result != VK_SUCCESS) {
+        return false;
+    }
+    bda_tables.emplace_back(std::move(table));
+    return true;
+}
+
+void gpuav::Validator::WriteBDATable(BDATable &table, const std::vector<BufferAddressRange> &address_ranges) {
+    const size_t count = std::min(address_ranges.size(), static_cast<size_t>(table.capacity));
+    size_t first_changed = 0;
+    if (table.initialized) {
+        const size_t common = std::min(count, table.ranges.size());
+        while (first_changed < common && address_ranges[first_changed] == table.ranges[first_changed]) {
+            first_changed++;
+        }
+        if (first_changed == count && first_changed == table.ranges.size()) {
+            // None of the entries the table holds changed
+            return;
+        }
     }
-    auto address_ranges = GetBufferAddressRanges();
-    auto address_ranges_num_addresses = address_ranges.size();
-    if (address_ranges_num_addresses == 0) return;
-
-    // Example BDA input buffer assuming 2 buffers using BDA:
-    // Word 0 | Index of start of buffer sizes (in this case 5)
-    // Word 1 | 0x0000000000000000
-    // Word 2 | Device Address of first buffer  (Addresses sorted in ascending order)
-    // Word 3 | Device Address of second buffer
-    // Word 4 | 0xffffffffffffffff
-    // Word 5 | 0 (size of pretend buffer at word 1)
-    // Word 6 | Size in bytes of first buffer
-    // Word 7 | Size in bytes of second buffer
-    // Word 8 | 0 (size of pretend buffer in word 4)
 
+    const size_t size_index = 3 + table.capacity;
+    const size_t count_index = size_index + table.capacity + 2;
     uint64_t *bda_data;
-    // Make sure to limit writes to size of the buffer
     [[maybe_unused]] VkResult result;
-    result = vmaMapMemory(vmaAllocator, device_address_buffer.allocation, reinterpret_cast<void **>(&bda_data));
+    result = vmaMapMemory(vmaAllocator, table.block.allocation, reinterpret_cast<void **>(&bda_data));
     assert(result == VK_SUCCESS);
-    uint32_t address_index = 1;
-    size_t size_index = 3 + address_ranges.size();
-    memset(bda_data, 0, static_cast<size_t>(app_bda_buffer_size));
-    bda_data[0] = size_index;       // Start of buffer sizes
-    bda_data[address_index++] = 0;  // NULL address
-    bda_data[size_index++] = 0;
-    if (address_ranges_num_addresses > gpuav_settings.gpuav_max_buffer_device_addresses) {
-        std::ostringstream problem_string;
-        problem_string << "Number of buffer device addresses in use (" << address_ranges_num_addresses
-                       << ") is greater than khronos_validation.gpuav_max_buffer_device_addresses ("
-                       << gpuav_settings.gpuav_max_buffer_device_addresses
-                       << "). Truncating BDA table which could result in invalid validation";
-        ReportSetupProblem(device, problem_string.str().c_str());
+    if (!table.initialized) {
+        bda_data[0] = size_index;  // Start of buffer sizes
+        bda_data[1] = 0;           // NULL address
+        bda_data[size_index] = 0;
     }
-    size_t num_addresses =
-        std::min(static_cast<uint32_t>(address_ranges_num_addresses), gpuav_settings.gpuav_max_buffer_device_addresses);
-    for (size_t i = 0; i < num_addresses; i++) {
-        bda_data[address_index++] = address_ranges[i].begin;
-        bda_data[size_index++] = address_ranges[i].end - address_ranges[i].begin;
+    for (size_t i = first_changed; i < count; i++) {
+        bda_data[2 + i] = address_ranges[i].begin;
+        bda_data[size_index + 1 + i] = address_ranges[i].end - address_ranges[i].begin;
     }
-    bda_data[address_index] = std::numeric_limits<uintptr_t>::max();
-    bda_data[size_index] = 0;
-    // Flush the BDA buffer before unmapping so that the new state is visible to the GPU
-    result = vmaFlushAllocation(vmaAllocator, device_address_buffer.allocation, 0, VK_WHOLE_SIZE);
+    // Entries past the terminator of a shorter list are never read
+    bda_data[2 + count] = std::numeric_limits<uint64_t>::max();
+    bda_data[size_index + 1 + count] = 0;
+    bda_data[count_index] = count + 2;
+
+    // Flush the rewritten words before unmapping so that the new state is visible to the GPU
+    const auto flush_words = [&](size_t first_word, size_t end_word) {
+        return vmaFlushAllocation(vmaAllocator, table.block.allocation, first_word * sizeof(uint64_t),
+                                  (end_word - first_word) * sizeof(uint64_t));
+    };
+    const size_t first_address = table.initialized ? 2 + first_changed : 0;
+    const size_t first_size = table.initialized ? size_index + 1 + first_changed : size_index;
+    result = flush_words(first_address, 2 + count + 1);
     // No good way to handle this error, we should still try to unmap.
     assert(result == VK_SUCCESS);
-    vmaUnmapMemory(vmaAllocator, device_address_buffer.allocation);
-    gpuav_bda_buffer_version = buffer_device_address_ranges_version;
+    result = flush_words(first_size, size_index + 1 + count + 1);
+    assert(result == VK_SUCCESS);
+    result = flush_words(count_index, count_index + 1);
+    assert(result == VK_SUCCESS);
+    vmaUnmapMemory(vmaAllocator, table.block.allocation);
+
+    table.ranges.assign(address_ranges.begin(), address_ranges.begin() + count);
+    table.initialized = true;
+}
+
+void gpuav::Validator::UpdateBDABuffer() {
+    std::lock_guard<std::mutex> lock(bda_table_lock);
+    if (bda_tables.empty() || gpuav_bda_buffer_version == buffer_device_address_ranges_version) {
+        return;
+    }
+    const uint32_t ranges_version = buffer_device_address_ranges_version;
+    const auto address_snapshot = GetBufferAddressSnapshot();
+    const auto &address_ranges = address_snapshot->ranges;
+
+    if (address_ranges.size() > bda_tables.back().capacity) {
+        // Command buffers recorded from now on bind the bigger table
+        uint64_t capacity = bda_tables.back().capacity;
+        while (capacity < address_ranges.size()) {
+            capacity *= 2;
+        }
+        capacity = std::min(capacity, uint64_t(std::numeric_limits<uint32_t>::max() / 4));
+        if (capacity <= bda_tables.back().capacity || !CreateBDATable(static_cast<uint32_t>(capacity))) {
+            std::ostringstream problem_string;
+            problem_string << "Number of buffer device addresses in use (" << address_ranges.size()
+                           << ") is greater than the BDA table can hold (" << bda_tables.back().capacity
+                           << ") and a bigger table could not be allocated. Truncating BDA table which could result in "
+                              "invalid validation";
+            ReportSetupProblem(device, problem_string.str().c_str(), true);
+        }
+    }
+
+    // The tables are shared by all the submissions. They are rewritten in place without waiting for the ones still in flight,
+    // which would stall every submission behind the GPU while holding bda_table_lock.
+    for (auto &table : bda_tables) {
+        WriteBDATable(table, address_ranges);
+    }
+    gpuav_bda_buffer_version = ranges_version;
 }
 
 void gpuav::Validator::UpdateBoundDescriptors(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint) {
@@ -337,64 +424,62 @@ void gpuav::Validator::UpdateBoundDescriptors(VkCommandBuffer commandBuffer, VkP
     // Figure out how much memory we need for the input block based on how many sets and bindings there are
     // and how big each of the bindings is
     if (number_of_sets > 0 && gpuav_settings.validate_descriptors && force_buffer_device_address) {
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
         assert(number_of_sets <= glsl::kDebugInputBindlessMaxDescSets);
-        buffer_info.size = sizeof(glsl::BindlessStateBuffer);
-        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        alloc_info.pool = VK_NULL_HANDLE;
         DescBindingInfo di_buffers = {};
+        di_buffers.pipeline_state = last_bound.pipeline_state;
 
-        // Allocate buffer for device addresses of the input buffer for each descriptor set.  This is the buffer written to each
-        // draw's descriptor set.
-        VkResult result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &di_buffers.bindless_state_buffer,
-                                          &di_buffers.bindless_state_buffer_allocation, nullptr);
-        if (result != VK_SUCCESS) {
-            ReportSetupProblem(device, "Unable to allocate device memory. Device could become unstable.", true);
-            aborted = true;
-            return;
-        }
-        glsl::BindlessStateBuffer *bindless_state{nullptr};
-        result =
-            vmaMapMemory(vmaAllocator, di_buffers.bindless_state_buffer_allocation, reinterpret_cast<void **>(&bindless_state));
-        if (result != VK_SUCCESS) {
-            ReportSetupProblem(device, "Unable to map device memory. Device could become unstable.", true);
-            aborted = true;
-            return;
-        }
-        memset(bindless_state, 0, static_cast<size_t>(buffer_info.size));
-        cb_node->current_bindless_buffer = di_buffers.bindless_state_buffer;
-
-        bindless_state->global_state = desc_heap->GetDeviceAddress();
         for (uint32_t i = 0; i < last_bound.per_set.size(); i++) {
             const auto &s = last_bound.per_set[i];
             auto set = s.bound_descriptor_set;
             if (!set) {
                 continue;
             }
-            if (gpuav_settings.validate_descriptors) {
-                DescSetState desc_set_state;
-                desc_set_state.num = i;
-                desc_set_state.state = std::static_pointer_cast<DescriptorSet>(set);
-                bindless_state->desc_sets[i].layout_data = desc_set_state.state->GetLayoutState();
-                if (last_bound.pipeline_state) {
-                    auto slot = last_bound.pipeline_state->active_slots.find(i);
-                    if (slot != last_bound.pipeline_state->active_slots.end()) {
-                        desc_set_state.binding_req = slot->second;
-                    }
+            DescSetState desc_set_state;
+            desc_set_state.num = i;
+            desc_set_state.state = std::static_pointer_cast<DescriptorSet>(set);
+            if (last_bound.pipeline_state) {
+                auto slot = last_bound.pipeline_state->active_slots.find(i);
+                if (slot != last_bound.pipeline_state->active_slots.end()) {
+                    desc_set_state.binding_req = slot->second;
                 }
-                if (!desc_set_state.state->IsUpdateAfterBind()) {
-                    desc_set_state.gpu_state = desc_set_state.state->GetCurrentState();
-                    bindless_state->desc_sets[i].in_data = desc_set_state.gpu_state->device_addr;
+            }
+            if (!desc_set_state.state->IsUpdateAfterBind()) {
+                desc_set_state.gpu_state = desc_set_state.state->GetCurrentState();
+                if (gpuav_settings.validate_used_descriptors) {
                     desc_set_state.output_state = desc_set_state.state->GetOutputState();
-                    bindless_state->desc_sets[i].out_data = desc_set_state.output_state->device_addr;
                 }
-                di_buffers.descriptor_set_buffers.emplace_back(std::move(desc_set_state));
+            }
+            di_buffers.descriptor_set_buffers.emplace_back(std::move(desc_set_state));
+        }
+
+        // Applications often bind the same sets again before each draw, the commands can keep using the last bindless state
+        if (!cb_node->di_input_buffer_list.empty() && di_buffers.SameDescriptors(cb_node->di_input_buffer_list.back())) {
+            return;
+        }
+
+        // Sub allocate the device addresses of the input buffer for each descriptor set.  This is the buffer written to each
+        // draw's descriptor set.
+        if (!cb_node->output_arena.Allocate(sizeof(glsl::BindlessStateBuffer),
+                                            phys_dev_props.limits.minStorageBufferOffsetAlignment, di_buffers.bindless_state)) {
+            ReportSetupProblem(device, "Unable to allocate device memory. Device could become unstable.", true);
+            aborted = true;
+            return;
+        }
+        auto *bindless_state = static_cast<glsl::BindlessStateBuffer *>(di_buffers.bindless_state.mapped);
+        memset(bindless_state, 0, sizeof(glsl::BindlessStateBuffer));
+        cb_node->current_bindless_state = di_buffers.bindless_state;
+
+        bindless_state->global_state = desc_heap->GetDeviceAddress();
+        for (const auto &desc_set_state : di_buffers.descriptor_set_buffers) {
+            bindless_state->desc_sets[desc_set_state.num].layout_data = desc_set_state.state->GetLayoutState();
+            if (desc_set_state.gpu_state) {
+                bindless_state->desc_sets[desc_set_state.num].in_data = desc_set_state.gpu_state->device_addr;
+                if (desc_set_state.output_state) {
+                    bindless_state->desc_sets[desc_set_state.num].out_data = desc_set_state.output_state->device_addr;
+                }
             }
         }
         cb_node->di_input_buffer_list.emplace_back(di_buffers);
-        vmaUnmapMemory(vmaAllocator, di_buffers.bindless_state_buffer_allocation);
     }
 }
 
@@ -434,7 +519,8 @@ VkPipeline gpuav::Validator::GetDrawValidationPipeline(VkRenderPass render_pass)
     pipeline_ci.stageCount = 1;
     pipeline_ci.pStages = &pipeline_stage_ci;
 
-    VkResult result = DispatchCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &validation_pipeline);
+    VkResult result =
+        DispatchCreateGraphicsPipelines(device, validation_pipeline_cache, 1, &pipeline_ci, nullptr, &validation_pipeline);
     if (result != VK_SUCCESS) {
         ReportSetupProblem(device, "Unable to create graphics pipeline. Aborting GPU-AV");
         aborted = true;
@@ -452,7 +538,6 @@ gpuav::CommandResources gpuav::Validator::AllocateCommandResources(const VkComma
         bind_point != VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR) {
         return CommandResources();
     }
-    VkResult result;
 
     if (aborted) return CommandResources();
 
@@ -472,96 +557,67 @@ gpuav::CommandResources gpuav::Validator::AllocateCommandResources(const VkComma
         return CommandResources();
     }
 
-    std::vector<VkDescriptorSet> output_buffer_desc_set;
-    VkDescriptorPool output_buffer_desc_pool = VK_NULL_HANDLE;
-    result = desc_set_manager->GetDescriptorSets(1, &output_buffer_desc_pool, debug_desc_layout, &output_buffer_desc_set);
-    assert(result == VK_SUCCESS);
-    if (result != VK_SUCCESS) {
+    const VkDescriptorSet output_buffer_desc_set = cb_node->instrumentation_desc_sets.Get();
+    if (output_buffer_desc_set == VK_NULL_HANDLE) {
         ReportSetupProblem(device, "Unable to allocate descriptor sets. Device could become unstable.");
         aborted = true;
         return CommandResources();
     }
 
-    // Allocate memory for the output block that the gpu will use to return any error information
-    DeviceMemoryBlock output_block = {};
-    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-    buffer_info.size = output_buffer_size;
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    alloc_info.pool = output_buffer_pool;
-    result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &output_block.buffer, &output_block.allocation, nullptr);
-    if (result != VK_SUCCESS) {
+    // Sub allocate the output block that the gpu will use to return any error information
+    gpu_tracker::BufferRange output_range;
+    if (!cb_node->output_arena.Allocate(output_buffer_size, phys_dev_props.limits.minStorageBufferOffsetAlignment,
+                                        output_range)) {
         ReportSetupProblem(device, "Unable to allocate device memory. Device could become unstable.", true);
         aborted = true;
         return CommandResources();
     }
 
-    uint32_t *output_buffer_ptr;
-    result = vmaMapMemory(vmaAllocator, output_block.allocation, reinterpret_cast<void **>(&output_buffer_ptr));
-    bool uses_robustness = false;
-    if (result == VK_SUCCESS) {
-        memset(output_buffer_ptr, 0, output_buffer_size);
-        if (gpuav_settings.validate_descriptors) {
-            uses_robustness = (enabled_features.robustBufferAccess || enabled_features.robustBufferAccess2 ||
-                               (pipeline_state && pipeline_state->uses_pipeline_robustness));
-            output_buffer_ptr[spvtools::kDebugOutputFlagsOffset] = spvtools::kInstBufferOOBEnable;
+    if (!cb_node->errors_logged.mapped) {
+        if (!cb_node->output_arena.Allocate(sizeof(uint32_t) * gpuav::CommandBuffer::errors_logged_words,
+                                            phys_dev_props.limits.minStorageBufferOffsetAlignment, cb_node->errors_logged)) {
+            ReportSetupProblem(device, "Unable to allocate device memory. Device could become unstable.", true);
+            aborted = true;
+            return CommandResources();
         }
-        vmaUnmapMemory(vmaAllocator, output_block.allocation);
-    } else {
-        ReportSetupProblem(device, "Unable to map device memory allocated for output buffer. Device could become unstable.", true);
-        aborted = true;
-        return CommandResources();
+        memset(cb_node->errors_logged.mapped, 0, sizeof(uint32_t) * gpuav::CommandBuffer::errors_logged_words);
+    }
+
+    uint32_t *output_buffer_ptr = static_cast<uint32_t *>(output_range.mapped);
+    bool uses_robustness = false;
+    memset(output_buffer_ptr, 0, output_buffer_size);
+    if (gpuav_settings.validate_descriptors) {
+        uses_robustness = (enabled_features.robustBufferAccess || enabled_features.robustBufferAccess2 ||
+                           (pipeline_state && pipeline_state->uses_pipeline_robustness));
+        output_buffer_ptr[spvtools::kDebugOutputFlagsOffset] = spvtools::kInstBufferOOBEnable;
     }
 
-    // Write the descriptor that will be used to check for OOB accesses
+    // Write the descriptors that will be used to check for OOB accesses, the set may already hold some of them from a previous
+    // recording of the command buffer
     {
-        VkDescriptorBufferInfo output_desc_buffer_info = {};
-        output_desc_buffer_info.range = output_buffer_size;
-        output_desc_buffer_info.buffer = output_block.buffer;
-        output_desc_buffer_info.offset = 0;
-
-        std::array<VkWriteDescriptorSet, 3> desc_writes = {};
-        VkDescriptorBufferInfo di_input_desc_buffer_info = {};
-        VkDescriptorBufferInfo bda_input_desc_buffer_info = {};
-
-        desc_writes[0] = vku::InitStructHelper();
-        desc_writes[0].descriptorCount = 1;
-        desc_writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-        desc_writes[0].pBufferInfo = &output_desc_buffer_info;
-        desc_writes[0].dstSet = output_buffer_desc_set[0];
-
-        uint32_t desc_count = 1;
-
-        if (cb_node->current_bindless_buffer != VK_NULL_HANDLE) {
-            di_input_desc_buffer_info.range = VK_WHOLE_SIZE;
-            di_input_desc_buffer_info.buffer = cb_node->current_bindless_buffer;
-            di_input_desc_buffer_info.offset = 0;
-
-            desc_writes[desc_count] = vku::InitStructHelper();
-            desc_writes[desc_count].dstBinding = 1;
-            desc_writes[desc_count].descriptorCount = 1;
-            desc_writes[desc_count].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            desc_writes[desc_count].pBufferInfo = &di_input_desc_buffer_info;
-            desc_writes[desc_count].dstSet = output_buffer_desc_set[0];
-            desc_count++;
+        std::array<VkDescriptorBufferInfo, gpu_tracker::DescriptorSetCache::kMaxBindings> desc_buffer_infos = {};
+        desc_buffer_infos[0].buffer = output_range.buffer;
+        desc_buffer_infos[0].offset = output_range.offset;
+        desc_buffer_infos[0].range = output_buffer_size;
+
+        if (cb_node->current_bindless_state.buffer != VK_NULL_HANDLE) {
+            desc_buffer_infos[1].buffer = cb_node->current_bindless_state.buffer;
+            desc_buffer_infos[1].offset = cb_node->current_bindless_state.offset;
+            desc_buffer_infos[1].range = sizeof(glsl::BindlessStateBuffer);
         }
 
         if (buffer_device_address_enabled) {
-            bda_input_desc_buffer_info.range = app_bda_buffer_size;
-            bda_input_desc_buffer_info.buffer = app_buffer_device_addresses.buffer;
-            bda_input_desc_buffer_info.offset = 0;
-
-            desc_writes[desc_count] = vku::InitStructHelper();
-            desc_writes[desc_count].dstBinding = 2;
-            desc_writes[desc_count].descriptorCount = 1;
-            desc_writes[desc_count].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            desc_writes[desc_count].pBufferInfo = &bda_input_desc_buffer_info;
-            desc_writes[desc_count].dstSet = output_buffer_desc_set[0];
-            desc_count++;
+            std::lock_guard<std::mutex> lock(bda_table_lock);
+            desc_buffer_infos[2].buffer = bda_tables.back().block.buffer;
+            desc_buffer_infos[2].offset = 0;
+            desc_buffer_infos[2].range = BDATableSize(bda_tables.back().capacity);
         }
 
-        DispatchUpdateDescriptorSets(device, desc_count, desc_writes.data(), 0, NULL);
+        desc_buffer_infos[3].buffer = cb_node->errors_logged.buffer;
+        desc_buffer_infos[3].offset = cb_node->errors_logged.offset;
+        desc_buffer_infos[3].range = sizeof(uint32_t) * gpuav::CommandBuffer::errors_logged_words;
+
+        cb_node->instrumentation_desc_sets.WriteStorageBuffers(device, desc_buffer_infos);
     }
 
     const auto pipeline_layout =
@@ -580,18 +636,17 @@ gpuav::CommandResources gpuav::Validator::AllocateCommandResources(const VkComma
     if ((pipeline_layout && pipeline_layout->set_layouts.size() <= desc_set_bind_index) &&
         pipeline_layout_handle != VK_NULL_HANDLE) {
         DispatchCmdBindDescriptorSets(cmd_buffer, bind_point, pipeline_layout_handle, desc_set_bind_index, 1,
-                                      output_buffer_desc_set.data(), 0, nullptr);
+                                      &output_buffer_desc_set, 0, nullptr);
     } else {
         // If no pipeline layout was bound when using shader objects that don't use any descriptor set, bind the debug pipeline
         // layout
         DispatchCmdBindDescriptorSets(cmd_buffer, bind_point, debug_pipeline_layout, desc_set_bind_index, 1,
-                                      output_buffer_desc_set.data(), 0, nullptr);
+                                      &output_buffer_desc_set, 0, nullptr);
     }
 
     if (pipeline_state && pipeline_layout_handle == VK_NULL_HANDLE) {
         ReportSetupProblem(device, "Unable to find pipeline layout to bind debug descriptor set. Aborting GPU-AV");
         aborted = true;
-        vmaDestroyBuffer(vmaAllocator, output_block.buffer, output_block.allocation);
     }
 
     // It is possible to have no descriptor sets bound, for example if using push constants.
@@ -599,14 +654,15 @@ gpuav::CommandResources gpuav::Validator::AllocateCommandResources(const VkComma
         cb_node->di_input_buffer_list.size() > 0 ? uint32_t(cb_node->di_input_buffer_list.size()) - 1 : vvl::kU32Max;
 
     CommandResources cmd_resources;
-    cmd_resources.output_mem_block = output_block;
-    cmd_resources.output_buffer_desc_set = output_buffer_desc_set[0];
-    cmd_resources.output_buffer_desc_pool = output_buffer_desc_pool;
+    cmd_resources.output_range = output_range;
     cmd_resources.pipeline_bind_point = bind_point;
     cmd_resources.uses_robustness = uses_robustness;
     cmd_resources.command = command;
     cmd_resources.desc_binding_index = di_buf_index;
     cmd_resources.desc_binding_list = &cb_node->di_input_buffer_list;
+    if (pipeline_state) {
+        cmd_resources.adaptive_pipeline = cb_node->adaptive_bound[lv_bind_point];
+    }
     return cmd_resources;
 }
 
@@ -640,15 +696,6 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDrawIndire
     draw_resources->indirect_buffer_offset = indirect_offset;
     draw_resources->indirect_buffer_stride = stride;
 
-    VkPipeline validation_pipeline = VK_NULL_HANDLE;
-    if (!use_shader_objects) {
-        validation_pipeline = GetDrawValidationPipeline(cb_node->activeRenderPass.get()->renderPass());
-        if (validation_pipeline == VK_NULL_HANDLE) {
-            ReportSetupProblem(device, "Could not find or create a pipeline. Aborting GPU-AV");
-            aborted = true;
-            return std::make_unique<PreDrawResources>();
-        }
-    }
     VkResult result = VK_SUCCESS;
     result = desc_set_manager->GetDescriptorSet(&draw_resources->desc_pool, common_draw_resources.ds_layout,
                                                 &draw_resources->buffer_desc_set);
@@ -661,9 +708,9 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDrawIndire
     const uint32_t buffer_count = 3;
     VkDescriptorBufferInfo buffer_infos[buffer_count] = {};
     // Error output buffer
-    buffer_infos[0].buffer = draw_resources->output_mem_block.buffer;
-    buffer_infos[0].offset = 0;
-    buffer_infos[0].range = VK_WHOLE_SIZE;
+    buffer_infos[0].buffer = draw_resources->output_range.buffer;
+    buffer_infos[0].offset = draw_resources->output_range.offset;
+    buffer_infos[0].range = output_buffer_size;
     buffer_infos[1].buffer = count_buffer;
     buffer_infos[1].offset = 0;
     buffer_infos[1].range = VK_WHOLE_SIZE;
@@ -682,13 +729,11 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDrawIndire
     }
     DispatchUpdateDescriptorSets(device, buffer_count, desc_writes, 0, NULL);
 
-    // Insert a draw that can examine some device memory right before the draw we're validating (Pre Draw Validation)
+    // The draw that examines the indirect buffer (Pre Draw Validation) is inserted with the other ones of the same
+    // synchronization scope, see RecordPendingPreActionValidation
     //
     // NOTE that this validation does not attempt to abort invalid api calls as most other validation does. A crash
     // or DEVICE_LOST resulting from the invalid call will prevent preceeding validation errors from being reported.
-
-    // Save current graphics pipeline state
-    RestorablePipelineState restorable_state(cb_node.get(), VK_PIPELINE_BIND_POINT_GRAPHICS);
     const bool is_mesh_call =
         (command == Func::vkCmdDrawMeshTasksIndirectCountEXT || command == Func::vkCmdDrawMeshTasksIndirectCountNV ||
          command == Func::vkCmdDrawMeshTasksIndirectEXT || command == Func::vkCmdDrawMeshTasksIndirectNV);
@@ -698,7 +743,9 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDrawIndire
          command == Func::vkCmdDrawIndexedIndirectCount || command == Func::vkCmdDrawIndexedIndirectCountKHR ||
          command == Func::vkCmdDrawMeshTasksIndirectCountEXT || command == Func::vkCmdDrawMeshTasksIndirectCountNV);
 
-    uint32_t push_constants[PreDrawResources::push_constant_words] = {};
+    auto &push_constants = draw_resources->push_constants;
+    // One vertex of the validation draw checks one indirect draw, the count buffer only needs the first one
+    uint32_t validated_draws = 1;
     if (is_count_call) {
         // Validate count buffer
         if (count_buffer_offset > std::numeric_limits<uint32_t>::max()) {
@@ -748,6 +795,7 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDrawIndire
                 (indirect_offset + offsetof(struct VkDrawIndexedIndirectCommand, firstInstance)) / sizeof(uint32_t));
         }
         push_constants[3] = stride / sizeof(uint32_t);
+        validated_draws = draw_count;
     }
 
     if (is_mesh_call && phys_dev_props.limits.maxPushConstantsSize >= PreDrawResources::push_constant_words * sizeof(uint32_t)) {
@@ -757,8 +805,10 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDrawIndire
         }
         const VkShaderStageFlags stages = pipeline_state->create_info_shaders;
         push_constants[4] = static_cast<uint32_t>(indirect_offset / sizeof(uint32_t));
-        push_constants[5] = is_count_call ? 0 : draw_count;
+        // For the count calls this is maxDrawCount, the shader reads the actual count from the count buffer
+        push_constants[5] = draw_count;
         push_constants[6] = stride / sizeof(uint32_t);
+        validated_draws = draw_count;
         if (stages & VK_SHADER_STAGE_TASK_BIT_EXT) {
             draw_resources->emit_task_error = true;
             push_constants[7] = phys_dev_ext_props.mesh_shader_props_ext.maxTaskWorkGroupCount[0];
@@ -772,23 +822,13 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDrawIndire
             push_constants[10] = phys_dev_ext_props.mesh_shader_props_ext.maxMeshWorkGroupTotalCount;
         }
     }
-    // Insert diagnostic draw
-    if (use_shader_objects) {
-        VkShaderStageFlagBits stage = VK_SHADER_STAGE_VERTEX_BIT;
-        DispatchCmdBindShadersEXT(cmd_buffer, 1u, &stage, &common_draw_resources.shader_object);
-    } else {
-        DispatchCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, validation_pipeline);
-    }
-    DispatchCmdPushConstants(cmd_buffer, common_draw_resources.pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0,
-                             static_cast<uint32_t>(std::min(static_cast<uint32_t>(sizeof(push_constants)),
-                                                            (phys_dev_props.limits.maxPushConstantsSize))),
-                             push_constants);
-    DispatchCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, common_draw_resources.pipeline_layout, 0, 1,
-                                  &draw_resources->buffer_desc_set, 0, nullptr);
-    DispatchCmdDraw(cmd_buffer, 3, 1, 0, 0);
-
-    // Restore the previous graphics pipeline state.
-    restorable_state.Restore(cmd_buffer);
+    // Rounded up to whole primitives, so that no vertex is dropped with the list topologies the shader objects may have set
+    constexpr uint64_t vertices_per_primitive = 6;
+    const uint64_t vertex_count = std::min<uint64_t>(
+        (std::max(validated_draws, 1u) + vertices_per_primitive - 1) / vertices_per_primitive * vertices_per_primitive,
+        UINT32_MAX - UINT32_MAX % vertices_per_primitive);
+    draw_resources->vertex_count = static_cast<uint32_t>(vertex_count);
+    cb_node->pending_pre_draw_validations.emplace_back(draw_resources.get());
 
     return draw_resources;
 }
@@ -801,7 +841,8 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDispatchIn
         return cmd_resources_ptr;
     }
 
-    // Insert a dispatch that can examine some device memory right before the dispatch we're validating
+    // The dispatch that examines the indirect buffer is inserted with the other ones of the same synchronization scope,
+    // see RecordPendingPreActionValidation
     //
     // NOTE that this validation does not attempt to abort invalid api calls as most other validation does. A crash
     // or DEVICE_LOST resulting from the invalid call will prevent preceding validation errors from being reported.
@@ -838,9 +879,9 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDispatchIn
     const uint32_t buffer_count = 2;
     VkDescriptorBufferInfo buffer_infos[buffer_count] = {};
     // Error output buffer
-    buffer_infos[0].buffer = dispatch_resources->output_mem_block.buffer;
-    buffer_infos[0].offset = 0;
-    buffer_infos[0].range = VK_WHOLE_SIZE;
+    buffer_infos[0].buffer = dispatch_resources->output_range.buffer;
+    buffer_infos[0].offset = dispatch_resources->output_range.offset;
+    buffer_infos[0].range = output_buffer_size;
     buffer_infos[1].buffer = indirect_buffer;
     buffer_infos[1].offset = 0;
     buffer_infos[1].range = VK_WHOLE_SIZE;
@@ -856,32 +897,77 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDispatchIn
     }
     DispatchUpdateDescriptorSets(device, buffer_count, desc_writes, 0, nullptr);
 
-    // Save current graphics pipeline state
-    RestorablePipelineState restorable_state(cb_node.get(), VK_PIPELINE_BIND_POINT_COMPUTE);
-
-    uint32_t push_constants[PreDispatchResources::push_constant_words] = {};
+    auto &push_constants = dispatch_resources->push_constants;
     push_constants[0] = phys_dev_props.limits.maxComputeWorkGroupCount[0];
     push_constants[1] = phys_dev_props.limits.maxComputeWorkGroupCount[1];
     push_constants[2] = phys_dev_props.limits.maxComputeWorkGroupCount[2];
     push_constants[3] = static_cast<uint32_t>((indirect_offset / sizeof(uint32_t)));
+    cb_node->pending_pre_dispatch_validations.emplace_back(dispatch_resources.get());
 
-    // Insert diagnostic dispatch
-    if (use_shader_objects) {
-        VkShaderStageFlagBits stage = VK_SHADER_STAGE_COMPUTE_BIT;
-        DispatchCmdBindShadersEXT(cmd_buffer, 1u, &stage, &common_dispatch_resources.shader_object);
-    } else {
-        DispatchCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, common_dispatch_resources.pipeline);
+    return dispatch_resources;
+}
+
+// The indirect buffers can't be written between two synchronization commands without a data race with the action
+// command reading them, so the pre action checks recorded since the last one see the same parameters when they are
+// inserted together right before the next one. This binds the validation pipeline and restores the state of the
+// application once for all of them instead of around each indirect command.
+void gpuav::Validator::RecordPendingPreActionValidation(VkCommandBuffer cmd_buffer) {
+    auto cb_node = GetWrite<CommandBuffer>(cmd_buffer);
+    if (!cb_node || (cb_node->pending_pre_draw_validations.empty() && cb_node->pending_pre_dispatch_validations.empty())) {
+        return;
     }
-    DispatchCmdPushConstants(cmd_buffer, common_dispatch_resources.pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
-                             sizeof(push_constants), push_constants);
-    DispatchCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, common_dispatch_resources.pipeline_layout, 0, 1,
-                                  &dispatch_resources->indirect_buffer_desc_set, 0, nullptr);
-    DispatchCmdDispatch(cmd_buffer, 1, 1, 1);
 
-    // Restore the previous compute pipeline state.
-    restorable_state.Restore(cmd_buffer);
+    if (!cb_node->pending_pre_draw_validations.empty()) {
+        const auto lv_bind_point = ConvertToLvlBindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS);
+        const bool use_shader_objects = cb_node->lastBound[lv_bind_point].pipeline_state == nullptr;
+        RestorablePipelineState restorable_state(cb_node.get(), VK_PIPELINE_BIND_POINT_GRAPHICS);
+        if (use_shader_objects) {
+            VkShaderStageFlagBits stage = VK_SHADER_STAGE_VERTEX_BIT;
+            DispatchCmdBindShadersEXT(cmd_buffer, 1u, &stage, &common_draw_resources.shader_object);
+        } else {
+            const VkPipeline validation_pipeline = GetDrawValidationPipeline(cb_node->activeRenderPass.get()->renderPass());
+            if (validation_pipeline == VK_NULL_HANDLE) {
+                ReportSetupProblem(device, "Could not find or create a pipeline. Aborting GPU-AV");
+                aborted = true;
+                cb_node->pending_pre_draw_validations.clear();
+                cb_node->pending_pre_dispatch_validations.clear();
+                return;
+            }
+            DispatchCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, validation_pipeline);
+        }
+        const uint32_t push_constants_size = std::min(static_cast<uint32_t>(sizeof(PreDrawResources::push_constants)),
+                                                      phys_dev_props.limits.maxPushConstantsSize);
+        for (const PreDrawResources *draw_resources : cb_node->pending_pre_draw_validations) {
+            DispatchCmdPushConstants(cmd_buffer, common_draw_resources.pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                                     push_constants_size, draw_resources->push_constants);
+            DispatchCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, common_draw_resources.pipeline_layout, 0,
+                                          1, &draw_resources->buffer_desc_set, 0, nullptr);
+            DispatchCmdDraw(cmd_buffer, draw_resources->vertex_count, 1, 0, 0);
+        }
+        cb_node->pending_pre_draw_validations.clear();
+        restorable_state.Restore(cmd_buffer);
+    }
 
-    return dispatch_resources;
+    if (!cb_node->pending_pre_dispatch_validations.empty()) {
+        const auto lv_bind_point = ConvertToLvlBindPoint(VK_PIPELINE_BIND_POINT_COMPUTE);
+        const bool use_shader_objects = cb_node->lastBound[lv_bind_point].pipeline_state == nullptr;
+        RestorablePipelineState restorable_state(cb_node.get(), VK_PIPELINE_BIND_POINT_COMPUTE);
+        if (use_shader_objects) {
+            VkShaderStageFlagBits stage = VK_SHADER_STAGE_COMPUTE_BIT;
+            DispatchCmdBindShadersEXT(cmd_buffer, 1u, &stage, &common_dispatch_resources.shader_object);
+        } else {
+            DispatchCmdBindPipeline(cmd_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, common_dispatch_resources.pipeline);
+        }
+        for (const PreDispatchResources *dispatch_resources : cb_node->pending_pre_dispatch_validations) {
+            DispatchCmdPushConstants(cmd_buffer, common_dispatch_resources.pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                                     sizeof(dispatch_resources->push_constants), dispatch_resources->push_constants);
+            DispatchCmdBindDescriptorSets(cmd_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, common_dispatch_resources.pipeline_layout, 0,
+                                          1, &dispatch_resources->indirect_buffer_desc_set, 0, nullptr);
+            DispatchCmdDispatch(cmd_buffer, 1, 1, 1);
+        }
+        cb_node->pending_pre_dispatch_validations.clear();
+        restorable_state.Restore(cmd_buffer);
+    }
 }
 
 std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreTraceRaysValidationResources(
@@ -913,9 +999,9 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreTraceRaysV
     constexpr uint32_t buffer_count = 1;
     VkDescriptorBufferInfo buffer_infos[buffer_count] = {};
     // Error output buffer
-    buffer_infos[0].buffer = trace_rays_resources->output_mem_block.buffer;
-    buffer_infos[0].offset = 0;
-    buffer_infos[0].range = VK_WHOLE_SIZE;
+    buffer_infos[0].buffer = trace_rays_resources->output_range.buffer;
+    buffer_infos[0].offset = trace_rays_resources->output_range.offset;
+    buffer_infos[0].range = output_buffer_size;
 
     VkWriteDescriptorSet desc_writes[buffer_count] = {};
     for (uint32_t i = 0; i < buffer_count; i++) {
@@ -1039,8 +1125,8 @@ void gpuav::Validator::AllocateSharedTraceRaysValidationResources() {
         rt_pipeline_create_info.pGroups = &raygen_group_ci;
         rt_pipeline_create_info.maxPipelineRayRecursionDepth = 1;
         rt_pipeline_create_info.layout = common_trace_rays_resources.pipeline_layout;
-        result = DispatchCreateRayTracingPipelinesKHR(device, VK_NULL_HANDLE, VK_NULL_HANDLE, 1, &rt_pipeline_create_info, nullptr,
-                                                      &common_trace_rays_resources.pipeline);
+        result = DispatchCreateRayTracingPipelinesKHR(device, VK_NULL_HANDLE, validation_pipeline_cache, 1,
+                                                      &rt_pipeline_create_info, nullptr, &common_trace_rays_resources.pipeline);
 
         if (result != VK_SUCCESS) {
             ReportSetupProblem(device, "Failed to create ray tracing pipeline for pre trace rays validation. Aborting GPU-AV");
@@ -1266,7 +1352,7 @@ void gpuav::Validator::AllocateSharedDispatchIndirectValidationResources(bool us
             pipeline_ci.stage = pipeline_stage_ci;
             pipeline_ci.layout = common_dispatch_resources.pipeline_layout;
 
-            result = DispatchCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr,
+            result = DispatchCreateComputePipelines(device, validation_pipeline_cache, 1, &pipeline_ci, nullptr,
                                                     &common_dispatch_resources.pipeline);
             if (result != VK_SUCCESS) {
                 ReportSetupProblem(device, "Failed to create compute pipeline for pre dispatch validation.");
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "gpu_validation/gpu_state_tracker.h"
 #include "gpu_validation/gpu_error_message.h"
 #include "gpu_validation/gpu_descriptor_set.h"
@@ -87,14 +89,24 @@ class Validator : public gpu_tracker::Validator {
     bool CheckForDescriptorIndexing(DeviceFeatures enabled_features) const;
     bool InstrumentShader(const vvl::span<const uint32_t>& input, std::vector<uint32_t>& new_pgm, uint32_t unique_shader_id,
                           const Location& loc) override;
-    bool CheckForCachedInstrumentedShader(const uint32_t shader_hash, create_shader_module_api_state* csm_state);
-    bool CheckForCachedInstrumentedShader(const uint32_t index, const uint32_t shader_hash,
+    bool CheckForCachedInstrumentedShader(const uint64_t cache_key, create_shader_module_api_state* csm_state);
+    bool CheckForCachedInstrumentedShader(const uint32_t index, const uint64_t cache_key,
                                           create_shader_object_api_state* cso_state);
     void UpdateInstrumentationBuffer(CommandBuffer* cb_node);
-    void UpdateBDABuffer(DeviceMemoryBlock buffer_device_addresses);
+    void UpdateBDABuffer();
 
     void UpdateBoundDescriptors(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint);
 
+    // The descriptor state written for the GPU by DescriptorSet::GetCurrentState(), reported with the memory footprint
+    struct DescriptorStateStats {
+        std::atomic<uint64_t> submits{0};
+        std::atomic<uint64_t> full_uploads{0};
+        std::atomic<uint64_t> full_bytes{0};
+        std::atomic<uint64_t> incremental_uploads{0};
+        std::atomic<uint64_t> incremental_bytes{0};
+    } descriptor_state_stats;
+    void CollectMemoryFootprint(vvl::MemoryFootprint& footprint) const override;
+
     // Allocate per command validation resources
     [[nodiscard]] CommandResources AllocateCommandResources(const VkCommandBuffer cmd_buffer, const VkPipelineBindPoint bind_point,
                                                             Func command, const CmdIndirectState* indirect_state = nullptr);
@@ -108,6 +120,8 @@ class Validator : public gpu_tracker::Validator {
     [[nodiscard]] std::unique_ptr<CommandResources> AllocatePreTraceRaysValidationResources(vvl::Func command,
                                                                                             VkCommandBuffer cmd_buffer,
                                                                                             VkDeviceAddress indirect_data_address);
+    // Records the pre draw and pre dispatch validation of the indirect commands since the last synchronization command
+    void RecordPendingPreActionValidation(VkCommandBuffer cmd_buffer);
 
   private:
     void AllocateSharedTraceRaysValidationResources();
@@ -174,6 +188,21 @@ class Validator : public gpu_tracker::Validator {
                                                       const RecordObject& record_obj) override;
     void PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator,
                                         const RecordObject& record_obj) override;
+    void PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
+                                               const VkGraphicsPipelineCreateInfo* pCreateInfos,
+                                               const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
+                                               const RecordObject& record_obj, void* cgpl_state_data) override;
+    void PostCallRecordCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
+                                              const VkComputePipelineCreateInfo* pCreateInfos,
+                                              const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
+                                              const RecordObject& record_obj, void* ccpl_state_data) override;
+    void PreCallRecordDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator,
+                                      const RecordObject& record_obj) override;
+    void PostCallRecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline,
+                                       const RecordObject& record_obj) override;
+    template <typename CreateInfo>
+    void CreateUninstrumentedPipelines(VkPipelineCache pipeline_cache, uint32_t count, const CreateInfo* pCreateInfos,
+                                       const VkPipeline* pPipelines, const std::vector<std::shared_ptr<vvl::Pipeline>>& pipe_state);
 
     void PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
@@ -190,6 +219,26 @@ class Validator : public gpu_tracker::Validator {
                                              const VkSubpassBeginInfo* pSubpassBeginInfo, const RecordObject&) override;
     void PreCallRecordCmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
                                           const VkSubpassBeginInfo* pSubpassBeginInfo, const RecordObject&) override;
+    void PreCallRecordCmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo,
+                                           const RecordObject& record_obj) override;
+    void PreCallRecordCmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo,
+                                        const RecordObject& record_obj) override;
+    void PreCallRecordCmdEndRenderingKHR(VkCommandBuffer commandBuffer, const RecordObject& record_obj) override;
+    void PreCallRecordCmdEndRendering(VkCommandBuffer commandBuffer, const RecordObject& record_obj) override;
+    void PreCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer, const RecordObject& record_obj) override;
+    void PreCallRecordCmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo,
+                                           const RecordObject& record_obj) override;
+    void PreCallRecordCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo,
+                                        const RecordObject& record_obj) override;
+    void PreCallRecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents,
+                                     const RecordObject& record_obj) override;
+    void PreCallRecordCmdNextSubpass2KHR(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo,
+                                         const VkSubpassEndInfo* pSubpassEndInfo, const RecordObject& record_obj) override;
+    void PreCallRecordCmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo,
+                                      const VkSubpassEndInfo* pSubpassEndInfo, const RecordObject& record_obj) override;
+    void PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
+                                         const VkCommandBuffer* pCommandBuffers, const RecordObject& record_obj) override;
+    void PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject& record_obj) override;
 
     void RecordCmdNextSubpassLayouts(VkCommandBuffer commandBuffer, VkSubpassContents contents);
     void PostCallRecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents,
@@ -456,33 +505,50 @@ class Validator : public gpu_tracker::Validator {
     VkBool32 shaderInt64 = false;
     bool validate_instrumented_shaders = false;
     std::string instrumented_shader_cache_path{};
+    void CreateValidationPipelineCache(const std::string& path);
+    void DestroyValidationPipelineCache();
+    std::string validation_pipeline_cache_path{};
+    VkPipelineCache validation_pipeline_cache = VK_NULL_HANDLE;
     AccelerationStructureBuildValidationState acceleration_structure_validation_state{};
     CommonDrawResources common_draw_resources{};
     CommonDispatchResources common_dispatch_resources{};
     CommonTraceRaysResources common_trace_rays_resources{};
-    DeviceMemoryBlock app_buffer_device_addresses{};
-    size_t app_bda_buffer_size{};
+    struct BDATable {
+        DeviceMemoryBlock block;
+        uint32_t capacity;                       // buffers it has room for
+        std::vector<BufferAddressRange> ranges;  // currently written, so an update only rewrites the entries that changed
+        bool initialized = false;
+    };
+    static VkDeviceSize BDATableSize(uint32_t capacity);
+    bool CreateBDATable(uint32_t capacity);
+    void WriteBDATable(BDATable &table, const std::vector<BufferAddressRange> &address_ranges);
+
+    // Guards the BDA tables, which are updated from whichever queue submits first after a change and read when recording
+    std::mutex bda_table_lock;
     uint32_t gpuav_bda_buffer_version = 0;
+    // The last table is bound by new command buffers and grows when more buffers are in use than it has room for. The
+    // outgrown ones are still bound by the command buffers recorded before, so they are kept up to date (truncated to their
+    // capacity) until the device is destroyed.
+    std::vector<BDATable> bda_tables;
 
     bool buffer_device_address_enabled = false;
 
     std::optional<DescriptorHeap> desc_heap{};  // optional only to defer construction
+
+    // Keyed by the instrumented pipeline the application knows, see gpuav_adaptive_instrumentation
+    vl_concurrent_unordered_map<VkPipeline, std::shared_ptr<AdaptivePipeline>> adaptive_pipelines;
 };
 
+// Rebinds the application state that the validation commands GPU-AV inserts before an action command replace. Nothing is
+// recorded through the state tracker in between, so the state is read from the command buffer when restoring instead of
+// being copied when saving.
 struct RestorablePipelineState {
-    VkPipelineBindPoint pipeline_bind_point = VK_PIPELINE_BIND_POINT_MAX_ENUM;
-    VkPipeline pipeline = VK_NULL_HANDLE;
-    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
-    std::vector<std::pair<VkDescriptorSet, uint32_t>> descriptor_sets;
-    std::vector<std::vector<uint32_t>> dynamic_offsets;
-    uint32_t push_descriptor_set_index = 0;
-    std::vector<safe_VkWriteDescriptorSet> push_descriptor_set_writes;
-    std::vector<uint8_t> push_constants_data;
-    PushConstantRangesId push_constants_ranges;
-
-    RestorablePipelineState(vvl::CommandBuffer* cb_state, VkPipelineBindPoint bind_point) { Create(cb_state, bind_point); }
-
-    void Create(vvl::CommandBuffer* cb_state, VkPipelineBindPoint bind_point);
+    const vvl::CommandBuffer &cb_state;
+    VkPipelineBindPoint pipeline_bind_point;
+
+    RestorablePipelineState(vvl::CommandBuffer *cb_state, VkPipelineBindPoint bind_point)
+        : cb_state(*cb_state), pipeline_bind_point(bind_point) {}
+
     void Restore(VkCommandBuffer command_buffer) const;
 };
 
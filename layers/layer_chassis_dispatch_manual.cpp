@@ -21,6 +21,7 @@
 #include "generated/layer_chassis_dispatch.h"
 #include "generated/vk_safe_struct.h"
 #include "state_tracker/pipeline_state.h"
+#include "containers/scratch_arena.h"
 
 std::shared_mutex dispatch_lock;
 
@@ -130,9 +131,10 @@ VkResult DispatchCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateGraphicsPipelines(device, pipelineCache, createInfoCount,
                                                                                            pCreateInfos, pAllocator, pPipelines);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkGraphicsPipelineCreateInfo *local_pCreateInfos = nullptr;
     if (pCreateInfos) {
-        local_pCreateInfos = new safe_VkGraphicsPipelineCreateInfo[createInfoCount];
+        local_pCreateInfos = dispatch_scratch.NewArray<safe_VkGraphicsPipelineCreateInfo>(createInfoCount);
         ReadLockGuard lock(dispatch_lock);
         for (uint32_t idx0 = 0; idx0 < createInfoCount; ++idx0) {
             bool uses_color_attachment = false;
@@ -220,7 +222,9 @@ VkResult DispatchCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
         }
     }
 
-    delete[] local_pCreateInfos;
+    if (local_pCreateInfos) {
+        dispatch_scratch.DeleteArray(local_pCreateInfos, createInfoCount);
+    }
     {
         for (uint32_t i = 0; i < createInfoCount; ++i) {
             if (pPipelines[i] != VK_NULL_HANDLE) {
@@ -477,15 +481,23 @@ VkResult DispatchQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresent
     return result;
 }
 
+// Erases the unique ids of all the descriptor sets of a pool at once
+static void EraseDescriptorSetIds(const vvl::unordered_set<VkDescriptorSet> &descriptor_sets) {
+    std::vector<uint64_t> unique_ids;
+    unique_ids.reserve(descriptor_sets.size());
+    for (auto descriptor_set : descriptor_sets) {
+        unique_ids.emplace_back(CastToUint64(descriptor_set));
+    }
+    unique_id_mapping.erase(unique_ids);
+}
+
 void DispatchDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks *pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyDescriptorPool(device, descriptorPool, pAllocator);
     WriteLockGuard lock(dispatch_lock);
 
     // remove references to implicitly freed descriptor sets
-    for(auto descriptor_set : layer_data->pool_descriptor_sets_map[descriptorPool]) {
-        unique_id_mapping.erase(CastToUint64(descriptor_set));
-    }
+    EraseDescriptorSetIds(layer_data->pool_descriptor_sets_map[descriptorPool]);
     layer_data->pool_descriptor_sets_map.erase(descriptorPool);
     lock.unlock();
 
@@ -512,9 +524,7 @@ VkResult DispatchResetDescriptorPool(VkDevice device, VkDescriptorPool descripto
     if (VK_SUCCESS == result) {
         WriteLockGuard lock(dispatch_lock);
         // remove references to implicitly freed descriptor sets
-        for(auto descriptor_set : layer_data->pool_descriptor_sets_map[descriptorPool]) {
-            unique_id_mapping.erase(CastToUint64(descriptor_set));
-        }
+        EraseDescriptorSetIds(layer_data->pool_descriptor_sets_map[descriptorPool]);
         layer_data->pool_descriptor_sets_map[descriptorPool].clear();
     }
 
@@ -1615,11 +1625,12 @@ VkResult DispatchCreateComputePipelines(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkComputePipelineCreateInfo *local_pCreateInfos = nullptr;
     {
         pipelineCache = layer_data->Unwrap(pipelineCache);
         if (pCreateInfos) {
-            local_pCreateInfos = new safe_VkComputePipelineCreateInfo[createInfoCount];
+            local_pCreateInfos = dispatch_scratch.NewArray<safe_VkComputePipelineCreateInfo>(createInfoCount);
             for (uint32_t index0 = 0; index0 < createInfoCount; ++index0) {
                 local_pCreateInfos[index0].initialize(&pCreateInfos[index0]);
                 WrapPnextChainHandles(layer_data, local_pCreateInfos[index0].pNext);
@@ -1644,7 +1655,7 @@ VkResult DispatchCreateComputePipelines(
     }
 
     if (local_pCreateInfos) {
-        delete[] local_pCreateInfos;
+        dispatch_scratch.DeleteArray(local_pCreateInfos, createInfoCount);
     }
     {
         for (uint32_t index0 = 0; index0 < createInfoCount; index0++) {
@@ -1666,11 +1677,12 @@ VkResult DispatchCreateRayTracingPipelinesNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkRayTracingPipelineCreateInfoNV *local_pCreateInfos = nullptr;
     {
         pipelineCache = layer_data->Unwrap(pipelineCache);
         if (pCreateInfos) {
-            local_pCreateInfos = new safe_VkRayTracingPipelineCreateInfoNV[createInfoCount];
+            local_pCreateInfos = dispatch_scratch.NewArray<safe_VkRayTracingPipelineCreateInfoNV>(createInfoCount);
             for (uint32_t index0 = 0; index0 < createInfoCount; ++index0) {
                 local_pCreateInfos[index0].initialize(&pCreateInfos[index0]);
                 if (local_pCreateInfos[index0].pStages) {
@@ -1697,7 +1709,7 @@ VkResult DispatchCreateRayTracingPipelinesNV(
     }
 
     if (local_pCreateInfos) {
-        delete[] local_pCreateInfos;
+        dispatch_scratch.DeleteArray(local_pCreateInfos, createInfoCount);
     }
     {
         for (uint32_t index0 = 0; index0 < createInfoCount; index0++) {
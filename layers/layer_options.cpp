@@ -18,8 +18,23 @@
 
 #include "layer_options.h"
 #include "utils/hash_util.h"
+#include "state_tracker/descriptor_sets.h"
 #include <vulkan/layer/vk_layer_settings.hpp>
 
+#include <cstring>
+#include <mutex>
+#include <optional>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__APPLE__)
+#include <crt_externs.h>
+#elif !defined(_WIN32)
+extern char **environ;
+#endif
+
 // Include new / delete overrides if using mimalloc. This needs to be include exactly once in a file that is
 // part of the VVL but not the layer utils library.
 #if defined(USE_MIMALLOC) && defined(_WIN64)
@@ -32,6 +47,7 @@ const char *SETTING_VALIDATE_BEST_PRACTICES_ARM = "validate_best_practices_arm";
 const char *SETTING_VALIDATE_BEST_PRACTICES_AMD = "validate_best_practices_amd";
 const char *SETTING_VALIDATE_BEST_PRACTICES_IMG = "validate_best_practices_img";
 const char *SETTING_VALIDATE_BEST_PRACTICES_NVIDIA = "validate_best_practices_nvidia";
+const char *SETTING_VALIDATE_BEST_PRACTICES_FRAME_SUMMARY = "validate_best_practices_frame_summary";
 const char *SETTING_VALIDATE_SYNC = "validate_sync";
 const char *SETTING_VALIDATE_GPU_BASED = "validate_gpu_based";
 const char *SETTING_RESERVE_BINDING_SLOT = "reserve_binding_slot";
@@ -49,11 +65,35 @@ const char *SETTING_OBJECT_LIFETIME = "object_lifetime";
 const char *SETTING_CHECK_SHADERS = "check_shaders";
 const char *SETTING_CHECK_SHADERS_CACHING = "check_shaders_caching";
 const char *SETTING_VALIDATE_SYNC_QUEUE_SUBMIT = "sync_queue_submit";
+const char *SETTING_SYNCVAL_COALESCE_THRESHOLD = "syncval_coalesce_threshold";
+const char *SETTING_SYNCVAL_SUBMIT_REPLAY_THREADS = "syncval_submit_replay_threads";
+const char *SETTING_SYNCVAL_ACCESS_LOG_DETAIL_LIMIT = "syncval_access_log_detail_limit";
+const char *SETTING_SYNCVAL_WHOLE_RESOURCE_TRACKING = "syncval_whole_resource_tracking";
 
 const char *SETTING_MESSAGE_ID_FILTER = "message_id_filter";
 const char *SETTING_CUSTOM_STYPE_LIST = "custom_stype_list";
 const char *SETTING_DUPLICATE_MESSAGE_LIMIT = "duplicate_message_limit";
+const char *SETTING_MESSAGE_AGGREGATION_WINDOW = "message_aggregation_window";
 const char *SETTING_FINE_GRAINED_LOCKING = "fine_grained_locking";
+const char *SETTING_BATCH_DRAW_VALIDATION = "batch_draw_validation";
+const char *SETTING_ASYNC_SUBMIT_VALIDATION = "async_submit_validation";
+const char *SETTING_ASYNC_SHADER_VALIDATION = "async_shader_validation";
+const char *SETTING_SHARED_QUEUE_RETIREMENT = "shared_queue_retirement";
+const char *SETTING_DEFERRED_STATE_DESTRUCTION = "deferred_state_destruction";
+const char *SETTING_CREATE_INFO_CACHE = "create_info_cache";
+const char *SETTING_ASYNC_MESSAGE_DELIVERY = "async_message_delivery";
+const char *SETTING_ASYNC_ERROR_MESSAGES = "async_error_messages";
+const char *SETTING_PROFILE_LAYER = "profile_layer";
+const char *SETTING_PROFILE_LAYER_FILE = "profile_layer_file";
+const char *SETTING_PROFILE_VALIDATION_CHECKS = "profile_validation_checks";
+const char *SETTING_VALIDATION_BUDGET = "validation_budget";
+const char *SETTING_VALIDATION_BUDGET_SAMPLE_PERIOD = "validation_budget_sample_period";
+const char *SETTING_CONCURRENT_MAP_SHARDS = "concurrent_map_shards";
+const char *SETTING_THREAD_SAFETY_SAMPLE_RATE = "thread_safety_sample_rate";
+const char *SETTING_VALIDATED_QUEUE_FAMILIES = "validated_queue_families";
+const char *SETTING_MEMORY_REPORT = "memory_report";
+const char *SETTING_MEMORY_REPORT_INTERVAL = "memory_report_interval";
+const char *SETTING_DESCRIPTOR_PAGING_THRESHOLD = "descriptor_paging_threshold";
 
 const char *SETTING_GPUAV_VALIDATE_DESCRIPTORS = "gpuav_descriptor_checks";
 const char *SETTING_GPUAV_VALIDATE_INDIRECT_BUFFER = "validate_indirect_buffer";
@@ -62,6 +102,8 @@ const char *SETTING_GPUAV_WARN_ON_ROBUST_OOB = "warn_on_robust_oob";
 const char *SETTING_GPUAV_USE_INSTRUMENTED_SHADER_CACHE = "use_instrumented_shader_cache";
 const char *SETTING_GPUAV_SELECT_INSTRUMENTED_SHADERS = "select_instrumented_shaders";
 const char *SETTING_GPUAV_MAX_BUFFER_DEVICE_ADDRESS_BUFFERS = "gpuav_max_buffer_device_addresses";
+const char *SETTING_GPUAV_ADAPTIVE_INSTRUMENTATION = "gpuav_adaptive_instrumentation";
+const char *SETTING_GPUAV_INSTRUMENTATION_PRESET = "gpuav_instrumentation_preset";
 
 // Set the local disable flag for the appropriate VALIDATION_CHECK_DISABLE enum
 void SetValidationDisable(CHECK_DISABLED &disable_data, const ValidationCheckDisables disable_id) {
@@ -206,6 +248,26 @@ void SetValidationFeatures(CHECK_DISABLED &disable_data, CHECK_ENABLED &enable_d
     }
 }
 
+// Restrict GPU-AV to one kind of check, the others are turned off whatever their own settings are. "full" and unknown presets
+// leave the settings as they are.
+static void ApplyGpuAVInstrumentationPreset(const std::string &preset, GpuAVSettings &settings) {
+    if (preset == "indirect-only") {
+        settings.validate_descriptors = false;
+        settings.validate_indirect_buffer = true;
+        settings.validate_buffer_device_address = false;
+    } else if (preset == "descriptors-only" || preset == "descriptor-indices-only") {
+        settings.validate_descriptors = true;
+        settings.validate_indirect_buffer = false;
+        settings.validate_buffer_device_address = false;
+        // Only the checks done by the instrumented shaders, the descriptors they accessed are not validated afterwards
+        settings.validate_used_descriptors = preset == "descriptors-only";
+    } else if (preset == "bda-only") {
+        settings.validate_descriptors = false;
+        settings.validate_indirect_buffer = false;
+        settings.validate_buffer_device_address = true;
+    }
+}
+
 std::string GetNextToken(std::string *token_list, const std::string &delimiter, size_t *pos) {
     std::string token;
     *pos = token_list->find(delimiter);
@@ -339,11 +401,22 @@ static const char *GetDefaultPrefix() {
 #endif
 }
 
-// Process enables and disables set though the vk_layer_settings.txt config file or through an environment variable
-void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
-    // If not cleared, garbage has been seen in some Android run effecting the error message
-    custom_stype_info.clear();
+// Settings that are applied to process wide state instead of ConfigAndEnvSettings
+struct ProcessSettings {
+    std::optional<uint32_t> concurrent_map_shards;
+    std::optional<uint32_t> descriptor_paging_threshold;
+};
+
+static void ApplyProcessSettings(const ProcessSettings &process_settings) {
+    if (process_settings.concurrent_map_shards) {
+        SetConcurrentMapShardCount(*process_settings.concurrent_map_shards);
+    }
+    if (process_settings.descriptor_paging_threshold) {
+        vvl::SetDescriptorPagingThreshold(*process_settings.descriptor_paging_threshold);
+    }
+}
 
+static void ResolveConfigAndEnvSettings(ConfigAndEnvSettings *settings_data, ProcessSettings &process_settings) {
     VkuLayerSettingSet layer_setting_set = VK_NULL_HANDLE;
     vkuCreateLayerSettingSet(OBJECT_LAYER_NAME, vkuFindLayerSettingsCreateInfo(settings_data->create_info), nullptr, nullptr,
                              &layer_setting_set);
@@ -372,6 +445,92 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, SETTING_FINE_GRAINED_LOCKING, *settings_data->fine_grained_locking);
     }
 
+    // Batched draw validation, off by default
+    SetValidationSetting(layer_setting_set, settings_data->enables, batch_draw_validation, SETTING_BATCH_DRAW_VALIDATION);
+
+    // Asynchronous submit-time validation, off by default
+    SetValidationSetting(layer_setting_set, settings_data->enables, async_submit_validation, SETTING_ASYNC_SUBMIT_VALIDATION);
+
+    // Background spirv-val of shader modules, off by default
+    SetValidationSetting(layer_setting_set, settings_data->enables, async_shader_validation, SETTING_ASYNC_SHADER_VALIDATION);
+
+    // One retirement thread for all the queues of the device, off by default
+    SetValidationSetting(layer_setting_set, settings_data->enables, shared_queue_retirement, SETTING_SHARED_QUEUE_RETIREMENT);
+
+    // Destroyed state objects freed on a layer thread, off by default
+    SetValidationSetting(layer_setting_set, settings_data->enables, deferred_state_destruction,
+                         SETTING_DEFERRED_STATE_DESTRUCTION);
+
+    // Skip stateless validation of create infos that already passed it, off by default
+    SetValidationSetting(layer_setting_set, settings_data->enables, create_info_cache, SETTING_CREATE_INFO_CACHE);
+
+    // Debug callbacks invoked from a layer thread, off by default
+    SetValidationSetting(layer_setting_set, settings_data->enables, async_message_delivery, SETTING_ASYNC_MESSAGE_DELIVERY);
+
+    // Errors delivered from that thread too, off by default
+    SetValidationSetting(layer_setting_set, settings_data->enables, async_error_messages, SETTING_ASYNC_ERROR_MESSAGES);
+
+    // Best practices messages counted and reported once per frame, off by default
+    SetValidationSetting(layer_setting_set, settings_data->enables, best_practices_frame_summary,
+                         SETTING_VALIDATE_BEST_PRACTICES_FRAME_SUMMARY);
+
+    // Layer overhead profiling, off by default
+    SetValidationSetting(layer_setting_set, settings_data->enables, layer_profiling, SETTING_PROFILE_LAYER);
+
+    // Profile also appended as CSV to this file, for comparing runs with scripts/compare_layer_profiles.py
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_PROFILE_LAYER_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_PROFILE_LAYER_FILE, *settings_data->profile_layer_file);
+    }
+
+    // Time spent in the major validation functions, reported at vkDestroyDevice, off by default
+    SetValidationSetting(layer_setting_set, settings_data->enables, check_profiling, SETTING_PROFILE_VALIDATION_CHECKS);
+
+    // Microseconds of the expensive check families allowed per presented frame, 0 (the default) never sheds them
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_VALIDATION_BUDGET)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_VALIDATION_BUDGET,
+                                settings_data->validation_budget_settings->frame_budget_us);
+    }
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_VALIDATION_BUDGET_SAMPLE_PERIOD)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_VALIDATION_BUDGET_SAMPLE_PERIOD,
+                                settings_data->validation_budget_settings->sample_period);
+        if (settings_data->validation_budget_settings->sample_period == 0) {
+            settings_data->validation_budget_settings->sample_period = 1;
+        }
+    }
+
+    // Shard count of the concurrent maps created from here on, 0 scales with the hardware thread count
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_CONCURRENT_MAP_SHARDS)) {
+        uint32_t shard_count = 0;
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_CONCURRENT_MAP_SHARDS, shard_count);
+        process_settings.concurrent_map_shards = shard_count;
+    }
+
+    // Descriptor bindings larger than this are allocated one page at a time as they are written, 0 allocates them up front
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_DESCRIPTOR_PAGING_THRESHOLD)) {
+        uint32_t threshold = 0;
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_DESCRIPTOR_PAGING_THRESHOLD, threshold);
+        process_settings.descriptor_paging_threshold = threshold;
+    }
+
+    // Thread safety tracks 1 in N objects, 1 (the default) tracks all of them
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_THREAD_SAFETY_SAMPLE_RATE)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_THREAD_SAFETY_SAMPLE_RATE, *settings_data->thread_safety_sample_rate);
+        if (*settings_data->thread_safety_sample_rate == 0) {
+            *settings_data->thread_safety_sample_rate = 1;
+        }
+    }
+
+    // Submit time validation is limited to the queues of these families, all queues are validated when the list is empty
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_VALIDATED_QUEUE_FAMILIES)) {
+        vkuGetLayerSettingValues(layer_setting_set, SETTING_VALIDATED_QUEUE_FAMILIES, *settings_data->validated_queue_families);
+    }
+
+    // Memory footprint report, off by default. The interval is counted in queue submissions, 0 only reports on demand.
+    SetValidationSetting(layer_setting_set, settings_data->enables, memory_report, SETTING_MEMORY_REPORT);
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_MEMORY_REPORT_INTERVAL)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_MEMORY_REPORT_INTERVAL, *settings_data->memory_report_interval);
+    }
+
     // Message ID Filtering
     std::vector<std::string> message_id_filter;
     if (vkuHasLayerSetting(layer_setting_set, SETTING_MESSAGE_ID_FILTER)) {
@@ -389,6 +548,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         }
     }
 
+    // Identical messages within the window are counted instead of reported
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_MESSAGE_AGGREGATION_WINDOW)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_MESSAGE_AGGREGATION_WINDOW, *settings_data->message_aggregation_window);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, SETTING_CUSTOM_STYPE_LIST)) {
         vkuGetLayerSettingValues(layer_setting_set, SETTING_CUSTOM_STYPE_LIST, custom_stype_info);
     }
@@ -428,6 +592,43 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                                 settings_data->gpuav_settings->gpuav_max_buffer_device_addresses);
     }
 
+    // Clean submissions after which a pipeline runs uninstrumented, except for sampled binds. 0 always instruments.
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_GPUAV_ADAPTIVE_INSTRUMENTATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_GPUAV_ADAPTIVE_INSTRUMENTATION,
+                                settings_data->gpuav_settings->gpuav_adaptive_instrumentation);
+    }
+
+    // Applied last, a preset overrides the individual GPU-AV checks above
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_GPUAV_INSTRUMENTATION_PRESET)) {
+        std::string preset;
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_GPUAV_INSTRUMENTATION_PRESET, preset);
+        ApplyGpuAVInstrumentationPreset(preset, *settings_data->gpuav_settings);
+    }
+
+    // Growth of an access map, in ranges, between two merges of its equal neighbours after barriers. 0 disables the merging.
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_SYNCVAL_COALESCE_THRESHOLD)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_SYNCVAL_COALESCE_THRESHOLD,
+                                settings_data->syncval_settings->access_map_coalesce_threshold);
+    }
+
+    // Threads checking submitted command buffers against the queue state, 0 scales with the hardware thread count
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_SYNCVAL_SUBMIT_REPLAY_THREADS)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_SYNCVAL_SUBMIT_REPLAY_THREADS,
+                                settings_data->syncval_settings->submit_replay_threads);
+    }
+
+    // Most recent access log records of a command buffer keeping the handles used in error messages, 0 keeps all of them
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_SYNCVAL_ACCESS_LOG_DETAIL_LIMIT)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_SYNCVAL_ACCESS_LOG_DETAIL_LIMIT,
+                                settings_data->syncval_settings->access_log_detail_limit);
+    }
+
+    // Track each buffer and image as a single range, trading hazard precision for map size and check time
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_SYNCVAL_WHOLE_RESOURCE_TRACKING)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_SYNCVAL_WHOLE_RESOURCE_TRACKING,
+                                settings_data->syncval_settings->whole_resource_tracking);
+    }
+
     const auto *validation_features_ext = vku::FindStructInPNextChain<VkValidationFeaturesEXT>(settings_data->create_info);
     if (validation_features_ext) {
         SetValidationFeatures(settings_data->disables, settings_data->enables, validation_features_ext);
@@ -481,3 +682,201 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
 
     vkuDestroyLayerSettingSet(layer_setting_set, nullptr);
 }
+
+#if !defined(_WIN32) && !defined(__ANDROID__)
+// The settings of an instance only depend on its pNext chain, the environment and the settings file, so test suites creating
+// thousands of instances resolve them once instead of having the settings file parsed and the environment read every time.
+// On Windows and Android part of the settings come from the registry and system properties, which are not part of the
+// key, so nothing is cached there.
+struct ResolvedSettings {
+    CHECK_ENABLED enables;
+    CHECK_DISABLED disables;
+    std::unordered_set<uint32_t> message_filter_list;
+    uint32_t duplicate_message_limit;
+    uint32_t message_aggregation_window;
+    bool fine_grained_locking;
+    GpuAVSettings gpuav_settings;
+    SyncValSettings syncval_settings;
+    uint32_t memory_report_interval;
+    uint32_t thread_safety_sample_rate;
+    std::vector<uint32_t> validated_queue_families;
+    std::string profile_layer_file;
+    vvl::ValidationBudgetSettings validation_budget_settings;
+    std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info;
+    ProcessSettings process_settings;
+};
+
+template <typename T>
+static void AppendKey(std::string &key, const T &value) {
+    key.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+static void AppendKey(std::string &key, const char *value) {
+    if (value) {
+        key.append(value);
+    }
+    key.push_back('\0');
+}
+
+static void AppendSettingValues(std::string &key, const VkLayerSettingEXT &setting) {
+    size_t value_size = 0;
+    switch (setting.type) {
+        case VK_LAYER_SETTING_TYPE_BOOL32_EXT:
+        case VK_LAYER_SETTING_TYPE_INT32_EXT:
+        case VK_LAYER_SETTING_TYPE_UINT32_EXT:
+        case VK_LAYER_SETTING_TYPE_FLOAT32_EXT:
+            value_size = 4;
+            break;
+        case VK_LAYER_SETTING_TYPE_INT64_EXT:
+        case VK_LAYER_SETTING_TYPE_UINT64_EXT:
+        case VK_LAYER_SETTING_TYPE_FLOAT64_EXT:
+            value_size = 8;
+            break;
+        case VK_LAYER_SETTING_TYPE_STRING_EXT:
+            for (uint32_t i = 0; i < setting.valueCount; ++i) {
+                AppendKey(key, static_cast<const char *const *>(setting.pValues)[i]);
+            }
+            return;
+        default:
+            break;
+    }
+    if (setting.pValues) {
+        key.append(static_cast<const char *>(setting.pValues), value_size * setting.valueCount);
+    }
+}
+
+// The settings file is looked up in the same places as ConfigFile::FindSettings(), by the utility library as well
+static void AppendFileKey(std::string &key, const std::string &path) {
+    AppendKey(key, path.c_str());
+    struct stat info;
+    if (stat(path.c_str(), &info) == 0) {
+        AppendKey(key, info.st_ino);
+        AppendKey(key, info.st_size);
+        AppendKey(key, info.st_mtime);
+    }
+}
+
+static std::string SettingsCacheKey(const VkInstanceCreateInfo *create_info) {
+    std::string key;
+    for (auto *current = static_cast<const VkBaseInStructure *>(create_info->pNext); current; current = current->pNext) {
+        if (current->sType == VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT) {
+            const auto *settings_ci = reinterpret_cast<const VkLayerSettingsCreateInfoEXT *>(current);
+            AppendKey(key, current->sType);
+            for (uint32_t i = 0; i < settings_ci->settingCount; ++i) {
+                const VkLayerSettingEXT &setting = settings_ci->pSettings[i];
+                AppendKey(key, setting.pLayerName);
+                AppendKey(key, setting.pSettingName);
+                AppendKey(key, setting.type);
+                AppendKey(key, setting.valueCount);
+                AppendSettingValues(key, setting);
+            }
+        } else if (current->sType == VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT) {
+            const auto *features = reinterpret_cast<const VkValidationFeaturesEXT *>(current);
+            AppendKey(key, current->sType);
+            AppendKey(key, features->enabledValidationFeatureCount);
+            key.append(reinterpret_cast<const char *>(features->pEnabledValidationFeatures),
+                       features->enabledValidationFeatureCount * sizeof(VkValidationFeatureEnableEXT));
+            AppendKey(key, features->disabledValidationFeatureCount);
+            key.append(reinterpret_cast<const char *>(features->pDisabledValidationFeatures),
+                       features->disabledValidationFeatureCount * sizeof(VkValidationFeatureDisableEXT));
+        } else if (current->sType == VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT) {
+            const auto *flags = reinterpret_cast<const VkValidationFlagsEXT *>(current);
+            AppendKey(key, current->sType);
+            AppendKey(key, flags->disabledValidationCheckCount);
+            key.append(reinterpret_cast<const char *>(flags->pDisabledValidationChecks),
+                       flags->disabledValidationCheckCount * sizeof(VkValidationCheckEXT));
+        }
+    }
+
+    // Every setting can be overridden by a VK_KHRONOS_VALIDATION_* or VK_LAYER_* environment variable
+#if defined(__APPLE__)
+    char **environment = *_NSGetEnviron();
+#else
+    char **environment = environ;
+#endif
+    for (char **variable = environment; variable && *variable; ++variable) {
+        if (strncmp(*variable, "VK_", 3) == 0) {
+            AppendKey(key, static_cast<const char *>(*variable));
+        }
+    }
+    key.push_back('\0');
+
+    std::string search_path = GetEnvironment("XDG_DATA_HOME");
+    if (search_path.empty()) {
+        search_path = GetEnvironment("HOME");
+        if (!search_path.empty()) {
+            search_path += "/.local/share";
+        }
+    }
+    if (!search_path.empty()) {
+        AppendFileKey(key, search_path + "/vulkan/settings.d/vk_layer_settings.txt");
+    }
+    const std::string env_path = GetEnvironment("VK_LAYER_SETTINGS_PATH");
+    if (!env_path.empty()) {
+        AppendFileKey(key, env_path);
+        AppendFileKey(key, env_path + "/vk_layer_settings.txt");
+    }
+    char cwd[4096];
+    if (getcwd(cwd, sizeof(cwd))) {
+        AppendFileKey(key, std::string(cwd) + "/vk_layer_settings.txt");
+    }
+    return key;
+}
+
+static std::mutex resolved_settings_lock;
+static vvl::unordered_map<std::string, ResolvedSettings> resolved_settings_cache;
+// Instances with ever changing settings don't grow the cache without bounds
+static constexpr size_t kMaxResolvedSettings = 64;
+#endif
+
+// Process enables and disables set though the vk_layer_settings.txt config file or through an environment variable
+void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
+    // If not cleared, garbage has been seen in some Android run effecting the error message
+    custom_stype_info.clear();
+
+    ProcessSettings process_settings;
+#if !defined(_WIN32) && !defined(__ANDROID__)
+    const std::string key = SettingsCacheKey(settings_data->create_info);
+    {
+        std::lock_guard<std::mutex> guard(resolved_settings_lock);
+        auto it = resolved_settings_cache.find(key);
+        if (it != resolved_settings_cache.end()) {
+            const ResolvedSettings &resolved = it->second;
+            settings_data->enables = resolved.enables;
+            settings_data->disables = resolved.disables;
+            settings_data->message_filter_list = resolved.message_filter_list;
+            *settings_data->duplicate_message_limit = resolved.duplicate_message_limit;
+            *settings_data->message_aggregation_window = resolved.message_aggregation_window;
+            *settings_data->fine_grained_locking = resolved.fine_grained_locking;
+            *settings_data->gpuav_settings = resolved.gpuav_settings;
+            *settings_data->syncval_settings = resolved.syncval_settings;
+            *settings_data->memory_report_interval = resolved.memory_report_interval;
+            *settings_data->thread_safety_sample_rate = resolved.thread_safety_sample_rate;
+            *settings_data->validated_queue_families = resolved.validated_queue_families;
+            *settings_data->profile_layer_file = resolved.profile_layer_file;
+            *settings_data->validation_budget_settings = resolved.validation_budget_settings;
+            custom_stype_info = resolved.custom_stype_info;
+            ApplyProcessSettings(resolved.process_settings);
+            return;
+        }
+    }
+#endif
+
+    ResolveConfigAndEnvSettings(settings_data, process_settings);
+    ApplyProcessSettings(process_settings);
+
+#if !defined(_WIN32) && !defined(__ANDROID__)
+    std::lock_guard<std::mutex> guard(resolved_settings_lock);
+    if (resolved_settings_cache.size() >= kMaxResolvedSettings) {
+        resolved_settings_cache.clear();
+    }
+    resolved_settings_cache.emplace(
+        key, ResolvedSettings{settings_data->enables, settings_data->disables, settings_data->message_filter_list,
+                              *settings_data->duplicate_message_limit, *settings_data->message_aggregation_window,
+                              *settings_data->fine_grained_locking, *settings_data->gpuav_settings,
+                              *settings_data->syncval_settings, *settings_data->memory_report_interval,
+                              *settings_data->thread_safety_sample_rate, *settings_data->validated_queue_families,
+                              *settings_data->profile_layer_file, *settings_data->validation_budget_settings,
+                              custom_stype_info, process_settings});
+#endif
+}
@@ -33,8 +33,15 @@ typedef struct {
     CHECK_DISABLED &disables;
     std::unordered_set<uint32_t> &message_filter_list;
     uint32_t *duplicate_message_limit;
+    uint32_t *message_aggregation_window;
     bool *fine_grained_locking;
     GpuAVSettings *gpuav_settings;
+    SyncValSettings *syncval_settings;
+    uint32_t *memory_report_interval;
+    uint32_t *thread_safety_sample_rate;
+    std::vector<uint32_t> *validated_queue_families;
+    std::string *profile_layer_file;
+    vvl::ValidationBudgetSettings *validation_budget_settings;
 } ConfigAndEnvSettings;
 
 static const vvl::unordered_map<std::string, VkValidationFeatureDisableEXT> VkValFeatureDisableLookup = {
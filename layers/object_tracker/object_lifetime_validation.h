@@ -32,7 +32,7 @@ struct ObjTrackState {
     VulkanObjectType object_type;                                  // Object type identifier
     ObjectStatusFlags status;                                      // Object state
     uint64_t parent_object;                                        // Parent object
-    std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+    std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (VkDescriptorPool and VkCommandPool only)
 };
 
 typedef vl_concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
@@ -73,12 +73,19 @@ class ObjectLifetimes : public ValidationObject {
         }
     }
 
+    // With handle wrapping, the unique id entry of a tracked object is tagged with the map tracking it, so that validating a
+    // handle is a lock free lookup in the table that also unwraps it. Dispatchable handles, and all of them when wrapping is
+    // disabled, have no unique id entry and are only looked up in object_map.
+    static uint64_t TrackingTag(const object_map_type &map) { return reinterpret_cast<uint64_t>(&map); }
+
     template <typename T1>
     void InsertObject(object_map_type &map, T1 object, VulkanObjectType object_type, const Location &loc,
                       std::shared_ptr<ObjTrackState> pNode) {
         uint64_t object_handle = HandleToUint64(object);
         const bool inserted = map.insert(object_handle, pNode);
-        if (!inserted) {
+        if (inserted) {
+            unique_id_mapping.set_tag(object_handle, TrackingTag(map));
+        } else {
             // The object should not already exist. If we couldn't add it to the map, there was probably
             // a race condition in the app. Report an error and move on.
             // TODO should this be an error? https://gitlab.khronos.org/vulkan/vulkan/-/issues/3616
@@ -146,7 +153,7 @@ class ObjectLifetimes : public ValidationObject {
             num_objects[object_type]++;
             num_total_objects++;
 
-            if (object_type == kVulkanObjectTypeDescriptorPool) {
+            if (object_type == kVulkanObjectTypeDescriptorPool || object_type == kVulkanObjectTypeCommandPool) {
                 pNewObjNode->child_objects.reset(new vvl::unordered_set<uint64_t>);
             }
         }
@@ -32,6 +32,9 @@ VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
 }
 
 bool ObjectLifetimes::TracksObject(uint64_t object_handle, VulkanObjectType object_type) const {
+    if (unique_id_mapping.find_tag(object_handle) == TrackingTag(object_map[object_type])) {
+        return true;
+    }
     // Look for object in object map
     if (object_map[object_type].contains(object_handle)) {
         return true;
@@ -53,21 +56,21 @@ bool ObjectLifetimes::CheckObjectValidity(uint64_t object_handle, VulkanObjectTy
     }
     // Object not found, look for it in other device object maps
     const ObjectLifetimes *other_lifetimes = nullptr;
-    for (const auto &other_device_data : layer_data_map) {
-        const auto lifetimes = other_device_data.second->GetValidationObject<ObjectLifetimes>();
+    layer_data_map.FindIf([&](ValidationObject *other_device_data) {
+        const auto lifetimes = other_device_data->GetValidationObject<ObjectLifetimes>();
         if (lifetimes && lifetimes != this && lifetimes->TracksObject(object_handle, object_type)) {
             other_lifetimes = lifetimes;
-
-            // Sometimes (calls such as vkRegisterDisplayEventEXT) interact with both the device and physical device
-            if (parent_type == kVulkanObjectTypePhysicalDevice) {
-                auto iter = other_lifetimes->object_map[object_type].find(object_handle);
-                if (iter != other_lifetimes->object_map[object_type].end()) {
-                    if (iter->second->parent_object == HandleToUint64(physical_device)) {
-                        return skip;
-                    }
-                }
+            return true;
+        }
+        return false;
+    });
+    if (other_lifetimes && parent_type == kVulkanObjectTypePhysicalDevice) {
+        // Sometimes (calls such as vkRegisterDisplayEventEXT) interact with both the device and physical device
+        auto iter = other_lifetimes->object_map[object_type].find(object_handle);
+        if (iter != other_lifetimes->object_map[object_type].end()) {
+            if (iter->second->parent_object == HandleToUint64(physical_device)) {
+                return skip;
             }
-            break;
         }
     }
 
@@ -123,6 +126,7 @@ void ObjectLifetimes::DestroyObjectSilently(uint64_t object, VulkanObjectType ob
 
         return;
     }
+    unique_id_mapping.set_tag(object, 0);
     assert(num_total_objects > 0);
 
     num_total_objects--;
@@ -173,6 +177,11 @@ void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, co
     InsertObject(object_map[kVulkanObjectTypeCommandBuffer], command_buffer, kVulkanObjectTypeCommandBuffer, loc, new_obj_node);
     num_objects[kVulkanObjectTypeCommandBuffer]++;
     num_total_objects++;
+
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(command_pool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        itr->second->child_objects->insert(HandleToUint64(command_buffer));
+    }
 }
 
 bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer command_buffer, const Location &loc) const {
@@ -800,6 +809,7 @@ bool ObjectLifetimes::PreCallValidateAllocateCommandBuffers(VkDevice device, con
 void ObjectLifetimes::PostCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo,
                                                            VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
     if (record_obj.result != VK_SUCCESS) return;
+    auto lock = WriteSharedLock();
     for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++) {
         AllocateCommandBuffer(pAllocateInfo->commandPool, pCommandBuffers[i], pAllocateInfo->level,
                               record_obj.location.dot(Field::pCommandBuffers, i));
@@ -855,8 +865,17 @@ bool ObjectLifetimes::PreCallValidateFreeCommandBuffers(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                                       const VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
+    auto lock = WriteSharedLock();
+    std::shared_ptr<ObjTrackState> pool_node = nullptr;
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        pool_node = itr->second;
+    }
     for (uint32_t i = 0; i < commandBufferCount; i++) {
         RecordDestroyObject(pCommandBuffers[i], kVulkanObjectTypeCommandBuffer);
+        if (pool_node) {
+            pool_node->child_objects->erase(HandleToUint64(pCommandBuffers[i]));
+        }
     }
 }
 
@@ -881,6 +900,7 @@ void ObjectLifetimes::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapch
     auto snapshot = swapchain_image_map.snapshot(
         [swapchain](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(swapchain); });
     for (const auto &itr : snapshot) {
+        unique_id_mapping.set_tag(itr.first, 0);
         swapchain_image_map.erase(itr.first);
     }
 }
@@ -970,13 +990,15 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
     skip |= ValidateObject(commandPool, kVulkanObjectTypeCommandPool, true, "VUID-vkDestroyCommandPool-commandPool-parameter",
                            "VUID-vkDestroyCommandPool-commandPool-parent", command_pool_loc);
 
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
-    for (const auto &itr : snapshot) {
-        auto node = itr.second;
-        skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(itr.first), command_pool_loc);
-        skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer, nullptr,
-                                      kVUIDUndefined, kVUIDUndefined, error_obj.location);
+    auto lock = ReadSharedLock();
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        auto pool_node = itr->second;
+        for (auto command_buffer : *pool_node->child_objects) {
+            skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(command_buffer), command_pool_loc);
+            skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(command_buffer), kVulkanObjectTypeCommandBuffer,
+                                          nullptr, kVUIDUndefined, kVUIDUndefined, error_obj.location);
+        }
     }
     skip |=
         ValidateDestroyObject(commandPool, kVulkanObjectTypeCommandPool, pAllocator, "VUID-vkDestroyCommandPool-commandPool-00042",
@@ -986,11 +1008,15 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                       const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
+    auto lock = WriteSharedLock();
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
-    for (const auto &itr : snapshot) {
-        RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        auto pool_node = itr->second;
+        for (auto command_buffer : *pool_node->child_objects) {
+            RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(command_buffer), kVulkanObjectTypeCommandBuffer);
+        }
+        pool_node->child_objects->clear();
     }
     RecordDestroyObject(commandPool, kVulkanObjectTypeCommandPool);
 }
@@ -51,8 +51,12 @@ void CommandPool::Free(uint32_t count, const VkCommandBuffer *command_buffers) {
 }
 
 void CommandPool::Reset() {
+    // Every child link of every command buffer in the pool goes stale here, before any of them is reset. The resources
+    // find out lazily, so the per command buffer reset below never visits them.
+    child_link_generation->fetch_add(1, std::memory_order_release);
     for (auto &entry : commandBuffers) {
         auto guard = entry.second->WriteLock();
+        entry.second->pool_unlinked_children_ = true;
         entry.second->Reset();
     }
 }
@@ -78,8 +82,13 @@ CommandBuffer::CommandBuffer(ValidationStateTracker *dev, VkCommandBuffer cb, co
       command_pool(pool),
       dev_data(dev),
       unprotected(pool->unprotected),
-      lastBound({*this, *this, *this}) {
+      lastBound({*this, *this, *this}),
+      cmd_execute_commands_functions(recording_arena),
+      eventUpdates(recording_arena),
+      queryUpdates(recording_arena),
+      pool_link_generation_(pool->child_link_generation) {
     ResetCBState();
+    RegisterCmdDebugUtilsLabel(dev_data->report_data, cb, debug_label_state);
 }
 
 // Get the image viewstate for a given framebuffer attachment
@@ -112,10 +121,11 @@ void CommandBuffer::RemoveChild(std::shared_ptr<StateObject> &child_node) {
 // Reset the command buffer state
 // Maintain the createInfo and set state to CB_NEW, but clear all other state
 void CommandBuffer::ResetCBState() {
-    // Remove object bindings
-    for (const auto &obj : object_bindings) {
-        obj->RemoveParent(this);
+    // Remove object bindings, the children prune their stale links to this command buffer lazily
+    if (!pool_unlinked_children_) {
+        UnlinkChildren();
     }
+    pool_unlinked_children_ = false;
     object_bindings.clear();
     broken_bindings.clear();
 
@@ -133,6 +143,7 @@ void CommandBuffer::ResetCBState() {
     command_count = 0;
     submitCount = 0;
     image_layout_change_count = 1;  // Start at 1. 0 is insert value for validation cache versions, s.t. new == dirty
+    validated_action_state.fill({});
     dynamic_state_status.cb.reset();
     dynamic_state_status.pipeline.reset();
     dynamic_state_value.reset();
@@ -172,11 +183,10 @@ void CommandBuffer::ResetCBState() {
     vertex_buffer_used = false;
     primaryCommandBuffer = VK_NULL_HANDLE;
     linkedCommandBuffers.clear();
-    queue_submit_functions.clear();
-    queue_submit_functions_after_render_pass.clear();
     cmd_execute_commands_functions.clear();
     eventUpdates.clear();
     queryUpdates.clear();
+    recording_arena.Reset();
 
     for (auto &item : lastBound) {
         item.Reset();
@@ -205,7 +215,7 @@ void CommandBuffer::ResetCBState() {
     transform_feedback_active = false;
 
     // Clean up the label data
-    ResetCmdDebugUtilsLabel(dev_data->report_data, commandBuffer());
+    debug_label_state->Reset();
 }
 
 void CommandBuffer::Reset() {
@@ -254,7 +264,7 @@ void CommandBuffer::ResetPushConstantDataIfIncompatible(const vvl::PipelineLayou
 
 void CommandBuffer::Destroy() {
     // Remove the cb debug labels
-    EraseCmdDebugUtilsLabel(dev_data->report_data, commandBuffer());
+    EraseCmdDebugUtilsLabel(dev_data->report_data, commandBuffer(), debug_label_state.get());
     {
         auto guard = WriteLock();
         ResetCBState();
@@ -310,6 +320,24 @@ void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes,
 
 const CommandBufferImageLayoutMap &CommandBuffer::GetImageSubresourceLayoutMap() const { return image_layout_map; }
 
+void CommandBuffer::CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const {
+    using LayoutEntry = ImageSubresourceLayoutMap::LayoutMap::value_type;
+    size_t layout_bytes = vvl::MemoryFootprint::NodeBytes<CommandBufferImageLayoutMap::value_type>(image_layout_map.size());
+    for (const auto &entry : image_layout_map) {
+        if (entry.second) {
+            layout_bytes += sizeof(ImageSubresourceLayoutMap) + entry.second->EntryCount() * sizeof(LayoutEntry);
+        }
+    }
+    footprint.Add("CommandBuffer image_layout_map", image_layout_map.size(), layout_bytes);
+    // The aliased layout maps are shared with image_layout_map, only count the lookup table
+    footprint.AddNodes("CommandBuffer aliased_image_layout_map", aliased_image_layout_map);
+    footprint.AddVector("CommandBuffer cmd_execute_commands_functions", cmd_execute_commands_functions.Functions());
+    footprint.AddVector("CommandBuffer eventUpdates", eventUpdates.Functions());
+    footprint.AddVector("CommandBuffer queryUpdates", queryUpdates.Functions());
+    footprint.Add("CommandBuffer recording_arena", 1, recording_arena.ReservedBytes());
+    footprint.AddNodes("CommandBuffer object_bindings", object_bindings);
+}
+
 // The const variant only need the image as it is the key for the map
 const ImageSubresourceLayoutMap *CommandBuffer::GetImageSubresourceLayoutMap(VkImage image) const {
     auto it = image_layout_map.find(image);
@@ -324,24 +352,24 @@ ImageSubresourceLayoutMap *CommandBuffer::GetImageSubresourceLayoutMap(const vvl
     auto &layout_map = image_layout_map[image_state.image()];
     if (!layout_map) {
         // Make sure we don't create a nullptr keyed entry for a zombie Image
-        if (image_state.Destroyed() || !image_state.layout_range_map) {
+        if (image_state.Destroyed() || !image_state.layout_state) {
             return nullptr;
         }
         // Was an empty slot... fill it in.
         if (image_state.CanAlias()) {
             // Aliasing images need to share the same local layout map.
             // Since they use the same global layout state, use it as a key
-            // for the local state. We don't need a lock on the global range
-            // map to do a lookup based on its pointer.
-            const auto *global_layout_map = image_state.layout_range_map.get();
+            // for the local state. We don't need a snapshot of the global
+            // layouts to do a lookup based on its pointer.
+            const auto *global_layout_map = image_state.layout_state.get();
             auto iter = aliased_image_layout_map.find(global_layout_map);
             if (iter != aliased_image_layout_map.end()) {
                 layout_map = iter->second;
             } else {
                 layout_map = std::make_shared<ImageSubresourceLayoutMap>(image_state);
                 // Save the local layout map for the next aliased image.
-                // The global layout map pointer is only used as a key into the local lookup
-                // table so it doesn't need to be locked.
+                // The global layout state pointer is only used as a key into the local lookup
+                // table so no snapshot of it is needed.
                 aliased_image_layout_map.emplace(global_layout_map, layout_map);
             }
 
@@ -353,7 +381,7 @@ ImageSubresourceLayoutMap *CommandBuffer::GetImageSubresourceLayoutMap(const vvl
 }
 
 static bool SetQueryState(const QueryObject &object, QueryState value, QueryMap *localQueryToStateMap) {
-    (*localQueryToStateMap)[object] = value;
+    localQueryToStateMap->Set(object, value);
     return false;
 }
 
@@ -398,10 +426,7 @@ bool CommandBuffer::UpdatesQuery(const QueryObject &query_obj) const {
 
 static bool SetQueryStateMulti(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, uint32_t perfPass, QueryState value,
                                QueryMap *localQueryToStateMap) {
-    for (uint32_t i = 0; i < queryCount; i++) {
-        QueryObject query_obj = {queryPool, firstQuery + i, perfPass};
-        (*localQueryToStateMap)[query_obj] = value;
-    }
+    localQueryToStateMap->SetRange(queryPool, perfPass, firstQuery, queryCount, value);
     return false;
 }
 
@@ -493,7 +518,7 @@ void CommandBuffer::UpdateAttachmentsView(const VkRenderPassBeginInfo *pRenderPa
 }
 
 void CommandBuffer::BeginRenderPass(Func command, const VkRenderPassBeginInfo *pRenderPassBegin, const VkSubpassContents contents) {
-    RecordCmd(command);
+    RecordCmd(command, kActionStateDirtyRenderPass);
     activeFramebuffer = dev_data->Get<vvl::Framebuffer>(pRenderPassBegin->framebuffer);
     activeRenderPass = dev_data->Get<vvl::RenderPass>(pRenderPassBegin->renderPass);
     active_render_pass_begin_info = safe_VkRenderPassBeginInfo(pRenderPassBegin);
@@ -559,7 +584,7 @@ void CommandBuffer::NextSubpass(Func command, VkSubpassContents contents) {
 }
 
 void CommandBuffer::EndRenderPass(Func command) {
-    RecordCmd(command);
+    RecordCmd(command, kActionStateDirtyRenderPass);
     activeRenderPass = nullptr;
     active_attachments = nullptr;
     active_subpasses = nullptr;
@@ -569,7 +594,7 @@ void CommandBuffer::EndRenderPass(Func command) {
 }
 
 void CommandBuffer::BeginRendering(Func command, const VkRenderingInfo *pRenderingInfo) {
-    RecordCmd(command);
+    RecordCmd(command, kActionStateDirtyRenderPass);
     activeRenderPass = std::make_shared<vvl::RenderPass>(pRenderingInfo, true);
     renderPassQueries.clear();
 
@@ -649,7 +674,7 @@ void CommandBuffer::BeginRendering(Func command, const VkRenderingInfo *pRenderi
 }
 
 void CommandBuffer::EndRendering(Func command) {
-    RecordCmd(command);
+    RecordCmd(command, kActionStateDirtyRenderPass);
     activeRenderPass = nullptr;
     active_color_attachments_index.clear();
 }
@@ -779,9 +804,7 @@ void CommandBuffer::ControlVideoCoding(const VkVideoCodingControlInfoKHR *pContr
 void vvl::CommandBuffer::EnqueueUpdateVideoInlineQueries(const VkVideoInlineQueryInfoKHR &query_info) {
     queryUpdates.emplace_back([query_info](vvl::CommandBuffer &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
                                            uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
-        for (uint32_t i = 0; i < query_info.queryCount; i++) {
-            SetQueryState(QueryObject(query_info.queryPool, query_info.firstQuery + i), QUERYSTATE_ENDED, localQueryToStateMap);
-        }
+        localQueryToStateMap->SetRange(query_info.queryPool, 0, query_info.firstQuery, query_info.queryCount, QUERYSTATE_ENDED);
         return false;
     });
     for (uint32_t i = 0; i < query_info.queryCount; i++) {
@@ -933,7 +956,7 @@ void CommandBuffer::Begin(const VkCommandBufferBeginInfo *pBeginInfo) {
     if (chained_device_group_struct) {
         initial_device_mask = chained_device_group_struct->deviceMask;
     } else {
-        initial_device_mask = (1 << dev_data->physical_device_count) - 1;
+        initial_device_mask = dev_data->physical_device_mask;
     }
     performance_lock_acquired = dev_data->performance_lock_acquired;
     updatedQueries.clear();
@@ -947,9 +970,19 @@ void CommandBuffer::End(VkResult result) {
 
 void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_command_buffers) {
     RecordCmd(Func::vkCmdExecuteCommands);
-    for (const VkCommandBuffer sub_command_buffer : secondary_command_buffers) {
+    // A secondary executed several times only needs its image layouts merged at its first execution, which sets the initial
+    // layouts, and at its last one, which sets the current layouts. What the executions in between would merge is overwritten.
+    vvl::unordered_map<VkCommandBuffer, size_t> last_executions;
+    for (size_t i = 0; i < secondary_command_buffers.size(); i++) {
+        last_executions[secondary_command_buffers[i]] = i;
+    }
+    vvl::unordered_set<VkCommandBuffer> executed;
+    for (size_t i = 0; i < secondary_command_buffers.size(); i++) {
+        const VkCommandBuffer sub_command_buffer = secondary_command_buffers[i];
         auto sub_cb_state = dev_data->GetWrite<CommandBuffer>(sub_command_buffer);
         assert(sub_cb_state);
+        const bool first_execution = executed.insert(sub_command_buffer).second;
+        const bool last_execution = last_executions[sub_command_buffer] == i;
         if (!(sub_cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)) {
             if (beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT) {
                 // TODO: Because this is a state change, clearing the VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT needs to be moved
@@ -962,21 +995,25 @@ void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_c
         // NOTE: The update/population of the image_layout_map is done in CoreChecks, but for other classes derived from
         // ValidationStateTracker these maps will be empty, so leaving the propagation in the the state tracker should be a no-op
         // for those other classes.
-        for (const auto &sub_layout_map_entry : sub_cb_state->image_layout_map) {
-            const auto image_state = dev_data->Get<vvl::Image>(sub_layout_map_entry.first);
-            if (!image_state || image_state->Destroyed()) {
-                continue;
-            }
-            auto *cb_subres_map = GetImageSubresourceLayoutMap(*image_state);
-            if (cb_subres_map) {
-                const auto &sub_cb_subres_map = sub_layout_map_entry.second;
-                cb_subres_map->UpdateFrom(*sub_cb_subres_map);
+        if (first_execution || last_execution) {
+            for (const auto &sub_layout_map_entry : sub_cb_state->image_layout_map) {
+                const auto image_state = dev_data->Get<vvl::Image>(sub_layout_map_entry.first);
+                if (!image_state || image_state->Destroyed()) {
+                    continue;
+                }
+                auto *cb_subres_map = GetImageSubresourceLayoutMap(*image_state);
+                if (cb_subres_map) {
+                    const auto &sub_cb_subres_map = sub_layout_map_entry.second;
+                    cb_subres_map->UpdateFrom(*sub_cb_subres_map);
+                }
             }
         }
 
-        sub_cb_state->primaryCommandBuffer = commandBuffer();
-        linkedCommandBuffers.insert(sub_cb_state.get());
-        AddChild(sub_cb_state);
+        if (first_execution) {
+            sub_cb_state->primaryCommandBuffer = commandBuffer();
+            linkedCommandBuffers.insert(sub_cb_state.get());
+            AddChild(sub_cb_state);
+        }
         // Add a query update that runs all the query updates that happen in the sub command buffer.
         // This avoids locking ambiguity because primary command buffers are locked when these
         // callbacks run, but secondary command buffers are not.
@@ -996,9 +1033,6 @@ void CommandBuffer::ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_c
         for (auto &event : sub_cb_state->events) {
             events.push_back(event);
         }
-        for (auto &function : sub_cb_state->queue_submit_functions) {
-            queue_submit_functions.push_back(function);
-        }
 
         // State is trashed after executing secondary command buffers.
         // Importantly, this function runs after CoreChecks::PreCallValidateCmdExecuteCommands.
@@ -1070,7 +1104,8 @@ void CommandBuffer::UpdateTraceRayCmd(Func command) {
 
 // Generic function to handle state update for all Provoking functions calls (draw/dispatch/traceray/etc)
 void CommandBuffer::UpdatePipelineState(Func command, const VkPipelineBindPoint bind_point) {
-    RecordCmd(command);
+    // The action commands only read the bound state
+    RecordCmd(command, 0);
 
     const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
     auto &last_bound = lastBound[lv_bind_point];
@@ -1092,10 +1127,11 @@ void CommandBuffer::UpdatePipelineState(Func command, const VkPipelineBindPoint
     if (pipe->IsDynamic(VK_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT) &&
         dynamic_state_status.cb[CB_DYNAMIC_STATE_RASTERIZATION_SAMPLES_EXT]) {
         SetActiveSubpassRasterizationSampleCount(dynamic_state_value.rasterization_samples);
+        last_bound.action_state_dirty |= kActionStateDirtyDynamicState;
     }
 
     if (last_bound.pipeline_layout != VK_NULL_HANDLE) {
-        for (const auto &set_binding_pair : pipe->active_slots) {
+        for (const auto &set_binding_pair : pipe->active_slot_requirements) {
             uint32_t set_index = set_binding_pair.first;
             if (set_index >= last_bound.per_set.size()) {
                 continue;
@@ -1111,23 +1147,29 @@ void CommandBuffer::UpdatePipelineState(Func command, const VkPipelineBindPoint
 
             // We can skip updating the state if "nothing" has changed since the last validation.
             // See CoreChecks::ValidateActionState for more details.
+            const bool image_layouts_changed = !dev_data->disabled[image_layout_validation] &&
+                                               set_info.validated_set_image_layout_change_count != image_layout_change_count;
             const bool need_update = // Update if descriptor set (or contents) has changed
                                      set_info.validated_set != descriptor_set.get() ||
                                      set_info.validated_set_change_count != descriptor_set->GetChangeCount() ||
-                                     (!dev_data->disabled[image_layout_validation] &&
-                                     set_info.validated_set_image_layout_change_count != image_layout_change_count);
+                                     image_layouts_changed ||
+                                     // or the pipeline requires other bindings
+                                     set_info.validated_set_binding_reqs != &set_binding_pair.second;
             if (need_update) {
                 if (!dev_data->disabled[command_buffer_state] && !descriptor_set->IsPushDescriptor()) {
                     AddChild(descriptor_set);
                 }
 
-                // Bind this set and its active descriptor resources to the command buffer
-                descriptor_set->UpdateDrawState(dev_data, this, command, pipe, set_binding_pair.second);
+                // Bind this set and its active descriptor resources to the command buffer, if only the contents of the set
+                // changed since the last time, the bindings that were not updated are already bound
+                descriptor_set->UpdateDrawState(dev_data, this, command, pipe, set_binding_pair.second,
+                                                set_info.ValidatedChangeCount(descriptor_set.get(), set_binding_pair.second,
+                                                                              image_layouts_changed));
 
                 set_info.validated_set = descriptor_set.get();
                 set_info.validated_set_change_count = descriptor_set->GetChangeCount();
                 set_info.validated_set_image_layout_change_count = image_layout_change_count;
-                set_info.validated_set_binding_req_map = BindingVariableMap();
+                set_info.validated_set_binding_reqs = &set_binding_pair.second;
             }
         }
     }
@@ -1164,6 +1206,8 @@ void CommandBuffer::UpdateLastBoundDescriptorSets(VkPipelineBindPoint pipeline_b
     // Some useful shorthand
     const auto lv_bind_point = ConvertToLvlBindPoint(pipeline_bind_point);
     auto &last_bound = lastBound[lv_bind_point];
+    // Also reached by vkCmdPushDescriptorSetKHR, which doesn't go through RecordCmd
+    last_bound.action_state_dirty |= kActionStateDirtyDescriptorSets;
     last_bound.pipeline_layout = pipeline_layout.layout();
     auto &pipe_compat_ids = pipeline_layout.set_compat_ids;
     // Resize binding arrays
@@ -1357,7 +1401,14 @@ void CommandBuffer::SetImageViewLayout(const vvl::ImageView &view_state, VkImage
     }
 }
 
-void CommandBuffer::RecordCmd(Func command) { command_count++; }
+void CommandBuffer::RecordCmd(Func command, uint32_t action_state_dirty) {
+    command_count++;
+    if (action_state_dirty != 0) {
+        for (auto &last_bound : lastBound) {
+            last_bound.action_state_dirty |= action_state_dirty;
+        }
+    }
+}
 
 void CommandBuffer::RecordStateCmd(Func command, CBDynamicState state) {
     CBDynamicFlags state_bits;
@@ -1370,7 +1421,7 @@ void CommandBuffer::RecordStateCmd(Func command, CBDynamicState state) {
 }
 
 void CommandBuffer::RecordStateCmd(Func command, CBDynamicFlags const &state_bits) {
-    RecordCmd(command);
+    RecordCmd(command, kActionStateDirtyDynamicState);
     dynamic_state_status.cb |= state_bits;
     dynamic_state_status.pipeline |= state_bits;
 }
@@ -1504,10 +1555,10 @@ void CommandBuffer::Submit(VkQueue queue, uint32_t perf_submit_pass, const Locat
         for (auto &function : queryUpdates) {
             function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
         }
-        for (const auto &query_state_pair : local_query_to_state_map) {
-            auto query_pool_state = dev_data->Get<vvl::QueryPool>(query_state_pair.first.pool);
-            query_pool_state->SetQueryState(query_state_pair.first.slot, query_state_pair.first.perf_pass, query_state_pair.second);
-        }
+        local_query_to_state_map.ForEachRange([this](VkQueryPool pool, uint32_t perf_pass, const auto &queries, QueryState state) {
+            auto query_pool_state = dev_data->Get<vvl::QueryPool>(pool);
+            query_pool_state->SetQueryStates(queries.begin, queries.distance(), perf_pass, state);
+        });
     }
 
     // Update vvl::Event with src_stage from the last recorded SetEvent.
@@ -1548,15 +1599,26 @@ void CommandBuffer::Retire(uint32_t perf_submit_pass, const std::function<bool(c
         function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
     }
 
-    for (const auto &query_state_pair : local_query_to_state_map) {
-        if (query_state_pair.second == QUERYSTATE_ENDED && !is_query_updated_after(query_state_pair.first)) {
-            auto query_pool_state = dev_data->Get<vvl::QueryPool>(query_state_pair.first.pool);
-            if (query_pool_state) {
-                query_pool_state->SetQueryState(query_state_pair.first.slot, query_state_pair.first.perf_pass,
-                                                QUERYSTATE_AVAILABLE);
+    local_query_to_state_map.ForEachRange([this, &is_query_updated_after](VkQueryPool pool, uint32_t perf_pass,
+                                                                           const auto &queries, QueryState state) {
+        if (state != QUERYSTATE_ENDED) {
+            return;
+        }
+        auto query_pool_state = dev_data->Get<vvl::QueryPool>(pool);
+        if (!query_pool_state) {
+            return;
+        }
+        // Make available the runs of queries no later submission updates
+        uint32_t run_begin = queries.begin;
+        for (uint32_t slot = queries.begin; slot <= queries.end; ++slot) {
+            if (slot == queries.end || is_query_updated_after(QueryObject(pool, slot, 0, perf_pass))) {
+                if (slot > run_begin) {
+                    query_pool_state->SetQueryStates(run_begin, slot - run_begin, perf_pass, QUERYSTATE_AVAILABLE);
+                }
+                run_begin = slot + 1;
             }
         }
-    }
+    });
 }
 
 void CommandBuffer::UnbindResources() {
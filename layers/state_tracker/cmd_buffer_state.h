@@ -30,6 +30,8 @@
 #include "state_tracker/descriptor_sets.h"
 #include "containers/qfo_transfer.h"
 #include "containers/custom_containers.h"
+#include "containers/recording_arena.h"
+#include "utils/memory_footprint.h"
 
 struct SubpassInfo;
 class CoreChecks;
@@ -103,6 +105,9 @@ class CommandPool : public StateObject {
     const bool unprotected;  // can't be used for protected memory
     // Cmd buffers allocated from this pool
     vvl::unordered_map<VkCommandBuffer, CommandBuffer *> commandBuffers;
+    // Part of the link generation of every command buffer from this pool, Reset() bumps it to drop all their child links
+    // at once. Shared because command buffers can outlive the pool object.
+    const std::shared_ptr<std::atomic<uint32_t>> child_link_generation = std::make_shared<std::atomic<uint32_t>>(0);
 
     CommandPool(ValidationStateTracker *dev, VkCommandPool cp, const VkCommandPoolCreateInfo *pCreateInfo, VkQueueFlags flags);
     virtual ~CommandPool() { Destroy(); }
@@ -164,7 +169,7 @@ struct CBVertexBufferBindingInfo {
 
 typedef vvl::unordered_map<VkImage, std::shared_ptr<ImageSubresourceLayoutMap>> CommandBufferImageLayoutMap;
 
-typedef vvl::unordered_map<const GlobalImageLayoutRangeMap *, std::shared_ptr<ImageSubresourceLayoutMap>>
+typedef vvl::unordered_map<const GlobalImageLayoutState *, std::shared_ptr<ImageSubresourceLayoutMap>>
     CommandBufferAliasedLayoutMap;
 
 namespace vvl {
@@ -276,12 +281,18 @@ class CommandBuffer : public RefcountedStateObject {
         std::bitset<32> color_write_mask_attachments;                // VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT
         std::bitset<32> color_blend_advanced_attachments;            // VK_DYNAMIC_STATE_COLOR_BLEND_ADVANCED_EXT
         std::bitset<32> color_write_enabled;                         // VK_DYNAMIC_STATE_COLOR_WRITE_ENABLE_EXT
-        std::vector<VkColorBlendEquationEXT> color_blend_equations;  // VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT
-        std::vector<VkColorComponentFlags> color_write_masks;        // VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT
+        // The arrays set with vkCmdSet* are stored inline up to the count most implementations allow (maxColorAttachments,
+        // maxViewports, maxVertexInputBindings), so recording with a lot of dynamic state doesn't allocate. A device with
+        // larger limits still works, the vectors just move to the heap once, and keep that capacity over reset() after that.
+        static constexpr uint32_t kInlineColorAttachments = 8;
+        static constexpr uint32_t kInlineViewports = 16;
+        static constexpr uint32_t kInlineVertexInputs = 16;
+        small_vector<VkColorBlendEquationEXT, kInlineColorAttachments> color_blend_equations;  // COLOR_BLEND_EQUATION_EXT
+        small_vector<VkColorComponentFlags, kInlineColorAttachments> color_write_masks;        // COLOR_WRITE_MASK_EXT
 
         // VK_DYNAMIC_STATE_VERTEX_INPUT_EXT
-        std::vector<VkVertexInputBindingDescription2EXT> vertex_binding_descriptions;
-        std::vector<VkVertexInputAttributeDescription2EXT> vertex_attribute_descriptions;
+        small_vector<VkVertexInputBindingDescription2EXT, kInlineVertexInputs> vertex_binding_descriptions;
+        small_vector<VkVertexInputAttributeDescription2EXT, kInlineVertexInputs> vertex_attribute_descriptions;
 
         // VK_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT
         VkConservativeRasterizationModeEXT conservative_rasterization_mode;
@@ -291,7 +302,7 @@ class CommandBuffer : public RefcountedStateObject {
         VkImageAspectFlags attachment_feedback_loop_enable;
 
         // VK_DYNAMIC_STATE_VIEWPORT
-        std::vector<VkViewport> viewports;
+        small_vector<VkViewport, kInlineViewports> viewports;
         // and VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT
         uint32_t viewport_count;
         // VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT
@@ -348,6 +359,17 @@ class CommandBuffer : public RefcountedStateObject {
     // Store last bound state for Gfx & Compute pipeline bind points
     std::array<LastBound, BindPoint_Count> lastBound;  // index is LvlBindPoint.
 
+    // The last action command per bind point whose draw-time state validated cleanly, used when batch_draw_validation is
+    // enabled. If nothing has been recorded since (command_count) and no bound descriptor set changed, the next identical
+    // action sees exactly the same state and its draw-time validation can be skipped.
+    struct ValidatedActionState {
+        Func command = Func::Empty;
+        uint64_t command_count = 0;
+        uint64_t descriptor_change_count = 0;
+        ImageLayoutUpdateCount image_layout_change_count = 0;
+    };
+    mutable std::array<ValidatedActionState, BindPoint_Count> validated_action_state;
+
     // Use the casting boilerplate from StateObject to implement the derived shared_from_this
     std::shared_ptr<const CommandBuffer> shared_from_this() const { return SharedFromThisImpl(this); }
     std::shared_ptr<CommandBuffer> shared_from_this() { return SharedFromThisImpl(this); }
@@ -428,23 +450,18 @@ class CommandBuffer : public RefcountedStateObject {
     VkCommandBuffer primaryCommandBuffer;
     // If primary, the secondary command buffers we will call.
     vvl::unordered_set<CommandBuffer *> linkedCommandBuffers;
-    // Validation functions run at primary CB queue submit time
-    using QueueCallback = std::function<bool(const ValidationStateTracker &device_data, const class vvl::Queue &queue_state,
-                                             const CommandBuffer &cb_state)>;
-    std::vector<QueueCallback> queue_submit_functions;
-    // Used by some layers to defer actions until vkCmdEndRenderPass time.
-    // Layers using this are responsible for inserting the callbacks into queue_submit_functions.
-    std::vector<QueueCallback> queue_submit_functions_after_render_pass;
+    // Holds the callbacks below, reset with the command buffer once they are cleared
+    vvl::RecordingArena recording_arena;
     // Validation functions run when secondary CB is executed in primary
-    std::vector<std::function<bool(const CommandBuffer &secondary, const CommandBuffer *primary, const vvl::Framebuffer *)>>
+    vvl::RecordedFunctions<bool(const CommandBuffer &secondary, const CommandBuffer *primary, const vvl::Framebuffer *)>
         cmd_execute_commands_functions;
 
-    using EventCallback = std::function<bool(CommandBuffer &cb_state, bool do_validate, EventToStageMap &local_event_signal_info,
-                                             VkQueue waiting_queue, const Location &loc)>;
-    std::vector<EventCallback> eventUpdates;
+    vvl::RecordedFunctions<bool(CommandBuffer &cb_state, bool do_validate, EventToStageMap &local_event_signal_info,
+                                VkQueue waiting_queue, const Location &loc)>
+        eventUpdates;
 
-    std::vector<std::function<bool(CommandBuffer &cb_state, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                   uint32_t perfQueryPass, QueryMap *localQueryToStateMap)>>
+    vvl::RecordedFunctions<bool(CommandBuffer &cb_state, bool do_validate, VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
+                                QueryMap *localQueryToStateMap)>
         queryUpdates;
     IndexBufferBinding index_buffer_binding;
     bool performance_lock_acquired = false;
@@ -452,6 +469,8 @@ class CommandBuffer : public RefcountedStateObject {
 
     // Cache of current insert label...
     LoggingLabel debug_label;
+    // Label stack reported in the messages about this command buffer, changed without any global lock
+    const std::shared_ptr<LoggingLabelState> debug_label_state = std::make_shared<LoggingLabelState>();
 
     std::vector<uint8_t> push_constant_data;
     PushConstantRangesId push_constant_data_ranges;
@@ -484,6 +503,10 @@ class CommandBuffer : public RefcountedStateObject {
 
     void Destroy() override;
 
+    uint32_t LinkGeneration() const override {
+        return StateObject::LinkGeneration() + pool_link_generation_->load(std::memory_order_acquire);
+    }
+
     VkCommandBuffer commandBuffer() const { return handle_.Cast<VkCommandBuffer>(); }
 
     vvl::ImageView *GetActiveAttachmentImageViewState(uint32_t index);
@@ -504,6 +527,8 @@ class CommandBuffer : public RefcountedStateObject {
     }
 
     virtual void Reset();
+    // Adds the containers that grow with the recorded commands, the caller holds ReadLock()
+    virtual void CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const;
 
     void IncrementResources();
 
@@ -541,7 +566,7 @@ class CommandBuffer : public RefcountedStateObject {
     }
 
     void Begin(const VkCommandBufferBeginInfo *pBeginInfo);
-    void End(VkResult result);
+    virtual void End(VkResult result);
 
     void BeginQuery(const QueryObject &query_obj);
     void EndQuery(const QueryObject &query_obj);
@@ -563,7 +588,7 @@ class CommandBuffer : public RefcountedStateObject {
     void DecodeVideo(const VkVideoDecodeInfoKHR *pDecodeInfo);
     void EncodeVideo(const VkVideoEncodeInfoKHR *pEncodeInfo);
 
-    void ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_command_buffers);
+    virtual void ExecuteCommands(vvl::span<const VkCommandBuffer> secondary_command_buffers);
 
     void UpdateLastBoundDescriptorSets(VkPipelineBindPoint pipeline_bind_point, const vvl::PipelineLayout &pipeline_layout,
                                        uint32_t first_set, uint32_t set_count, const VkDescriptorSet *pDescriptorSets,
@@ -582,7 +607,8 @@ class CommandBuffer : public RefcountedStateObject {
     void UpdateTraceRayCmd(Func command);
     void UpdatePipelineState(Func command, const VkPipelineBindPoint bind_point);
 
-    virtual void RecordCmd(Func command);
+    // action_state_dirty is the part of the bound state (ActionStateDirtyBits) the command can change
+    virtual void RecordCmd(Func command, uint32_t action_state_dirty = kActionStateDirtyAll);
     void RecordStateCmd(Func command, CBDynamicState dynamic_state);
     void RecordStateCmd(Func command, CBDynamicFlags const &state_bits);
     void RecordTransferCmd(Func command, std::shared_ptr<Bindable> &&buf1, std::shared_ptr<Bindable> &&buf2 = nullptr);
@@ -697,7 +723,10 @@ class CommandBuffer : public RefcountedStateObject {
     const std::vector<DebugLabelCommand> &GetDebugLabelCommands() const { return debug_label_commands_; }
 
   private:
+    friend class CommandPool;
     void ResetCBState();
+    // Set by CommandPool::Reset(), whose generation bump already dropped the child links of this command buffer
+    bool pool_unlinked_children_ = false;
 
     // Keep track of how many CmdBeginDebugUtilsLabelEXT calls have been made without a matching CmdEndDebugUtilsLabelEXT.
     // Negative value for a secondary command buffer indicates invalid state.
@@ -714,6 +743,8 @@ class CommandBuffer : public RefcountedStateObject {
   protected:
     void NotifyInvalidate(const StateObject::NodeList &invalid_nodes, bool unlink) override;
     void UpdateAttachmentsView(const VkRenderPassBeginInfo *pRenderPassBegin);
+
+    const std::shared_ptr<const std::atomic<uint32_t>> pool_link_generation_;
     void EnqueueUpdateVideoInlineQueries(const VkVideoInlineQueryInfoKHR &query_info);
     void UnbindResources();
 };
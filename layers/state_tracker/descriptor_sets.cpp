@@ -19,6 +19,19 @@
 #include "state_tracker/descriptor_sets.h"
 #include "state_tracker/cmd_buffer_state.h"
 
+#include <atomic>
+
+static std::atomic<uint32_t> &DescriptorPagingThreshold() {
+    static std::atomic<uint32_t> threshold{4096};
+    return threshold;
+}
+
+void vvl::SetDescriptorPagingThreshold(uint32_t threshold) {
+    DescriptorPagingThreshold().store(threshold, std::memory_order_relaxed);
+}
+
+uint32_t vvl::GetDescriptorPagingThreshold() { return DescriptorPagingThreshold().load(std::memory_order_relaxed); }
+
 static vvl::DescriptorPool::TypeCountMap GetMaxTypeCounts(const VkDescriptorPoolCreateInfo *create_info) {
     vvl::DescriptorPool::TypeCountMap counts;
     // Collect maximums per descriptor type.
@@ -372,6 +385,50 @@ vvl::DescriptorSetLayout::DescriptorSetLayout(const VkDescriptorSetLayoutCreateI
 
 void vvl::AllocateDescriptorSetsData::Init(uint32_t count) { layout_nodes.resize(count); }
 
+std::vector<vvl::TemplateUpdateChunk> vvl::DecodeTemplateChunks(const VkDescriptorUpdateTemplateCreateInfo &create_info,
+                                                                const DescriptorSetLayout &layout) {
+    std::vector<TemplateUpdateChunk> chunks;
+    chunks.reserve(create_info.descriptorUpdateEntryCount);
+    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+        const auto &entry = create_info.pDescriptorUpdateEntries[i];
+        // The descriptorCount of an inline uniform block is its size in bytes, and it does not roll over
+        if (entry.descriptorType == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK) {
+            chunks.emplace_back(
+                TemplateUpdateChunk{entry.dstBinding, entry.dstArrayElement, entry.descriptorCount, entry.descriptorType,
+                                    entry.offset, entry.stride});
+            continue;
+        }
+        uint32_t binding = entry.dstBinding;
+        uint32_t array_element = entry.dstArrayElement;
+        uint32_t binding_count = layout.GetDescriptorCountFromBinding(binding);
+        size_t offset = entry.offset;
+        uint32_t remaining = entry.descriptorCount;
+        while (remaining > 0) {
+            if (array_element >= binding_count) {
+                binding = layout.GetNextValidBinding(binding);
+                binding_count = layout.GetDescriptorCountFromBinding(binding);
+                array_element = 0;
+            }
+            // Past the last binding the rest goes to a binding that doesn't exist, which the write validation reports
+            const uint32_t count = binding_count > array_element ? std::min(remaining, binding_count - array_element) : remaining;
+            chunks.emplace_back(TemplateUpdateChunk{binding, array_element, count, entry.descriptorType, offset, entry.stride});
+            array_element += count;
+            offset += count * entry.stride;
+            remaining -= count;
+        }
+    }
+    return chunks;
+}
+
+vvl::DescriptorUpdateTemplate::DescriptorUpdateTemplate(VkDescriptorUpdateTemplate update_template,
+                                                        const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                                                        const DescriptorSetLayout *layout)
+    : StateObject(update_template, kVulkanObjectTypeDescriptorUpdateTemplate),
+      create_info(pCreateInfo),
+      chunks(layout && pCreateInfo->templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
+                 ? DecodeTemplateChunks(*pCreateInfo, *layout)
+                 : std::vector<TemplateUpdateChunk>()) {}
+
 vvl::DescriptorSet::DescriptorSet(const VkDescriptorSet set, vvl::DescriptorPool *pool_state,
                                               const std::shared_ptr<DescriptorSetLayout const> &layout, uint32_t variable_count,
                                               vvl::DescriptorSet::StateTracker *state_data)
@@ -489,12 +546,42 @@ void vvl::DescriptorSet::Destroy() {
     }
     StateObject::Destroy();
 }
+void vvl::DescriptorSet::FlushParentLinks() {
+    if (pending_parent_links_.empty()) {
+        return;
+    }
+    // The links are not counted, so only the last operation queued for an object matters. Grouping the operations by
+    // object turns the writes of a few resources into many descriptors into a few locked parent list updates.
+    std::stable_sort(pending_parent_links_.begin(), pending_parent_links_.end(),
+                     [](const auto &a, const auto &b) { return std::less<StateObject *>()(a.first.get(), b.first.get()); });
+    const size_t count = pending_parent_links_.size();
+    for (size_t i = 0; i < count; ++i) {
+        if (i + 1 < count && pending_parent_links_[i + 1].first == pending_parent_links_[i].first) {
+            continue;
+        }
+        auto &[child, link] = pending_parent_links_[i];
+        if (link) {
+            child->AddParent(this);
+        } else {
+            child->RemoveParent(this);
+        }
+    }
+    // Don't hold on to the memory of a large update
+    constexpr size_t kMaxKeptLinks = 1024;
+    if (pending_parent_links_.capacity() > kMaxKeptLinks) {
+        std::vector<std::pair<std::shared_ptr<StateObject>, bool>>().swap(pending_parent_links_);
+    } else {
+        pending_parent_links_.clear();
+    }
+}
+
 // Loop through the write updates to do for a push descriptor set, ignoring dstSet
 void vvl::DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) {
     assert(IsPushDescriptor());
     for (uint32_t i = 0; i < write_count; i++) {
         PerformWriteUpdate(write_descs[i]);
     }
+    FlushParentLinks();
 
     push_descriptor_set_writes.clear();
     push_descriptor_set_writes.reserve(static_cast<std::size_t>(write_count));
@@ -510,6 +597,7 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
     auto iter = FindDescriptor(update.dstBinding, update.dstArrayElement);
     assert(!iter.AtEnd());
     auto &orig_binding = iter.CurrentBinding();
+    const uint64_t change_count = change_count_ + 1;
 
     // Verify next consecutive binding matches type, stage flags & immutable sampler use and if AtEnd
     for (uint32_t i = 0; i < descriptors_remaining; ++i, ++iter) {
@@ -518,6 +606,7 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
         }
         iter->WriteUpdate(*this, *state_data_, update, i, iter.CurrentBinding().IsBindless());
         iter.updated(true);
+        iter.CurrentBinding().change_count = change_count;
     }
     if (update.descriptorCount) {
         some_update_ = true;
@@ -529,8 +618,82 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
         Invalidate(false);
     }
 }
+
+// Copies the descriptors of a copy update within one binding into one binding of the same class, without going through
+// the descriptor iterators.
+// Returns true if any of the destination descriptors changed: copied from an updated descriptor, or no longer updated.
+template <typename Binding>
+static bool CopyBindingRange(vvl::DescriptorSet &dst_set, const ValidationStateTracker &dev_data, const VkCopyDescriptorSet &update,
+                             vvl::DescriptorBinding &dst_binding, const vvl::DescriptorBinding &src_binding) {
+    auto &dst = static_cast<Binding &>(dst_binding);
+    const auto &src = static_cast<const Binding &>(src_binding);
+    const bool is_bindless = src.IsBindless();
+    bool any_changed = false;
+    for (uint32_t i = 0; i < update.descriptorCount; ++i) {
+        const uint32_t src_index = update.srcArrayElement + i;
+        const uint32_t dst_index = update.dstArrayElement + i;
+        if (src.updated[src_index]) {
+            dst.descriptors[dst_index].CopyUpdate(dst_set, dev_data, src.descriptors[src_index], is_bindless, src.type);
+            dst.updated[dst_index] = true;
+            any_changed = true;
+        } else if (dst.updated[dst_index]) {
+            dst.updated[dst_index] = false;
+            any_changed = true;
+        }
+    }
+    return any_changed;
+}
+
 // Perform Copy update
 void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, const DescriptorSet &src_set) {
+    const auto *src_binding = src_set.GetBinding(update.srcBinding);
+    auto *dst_binding = GetBinding(update.dstBinding);
+    // Large copies are mostly a range of one binding into another binding of the same type, which is copied in one go.
+    // Copies that roll over to the next bindings, or involve mutable descriptors, go one descriptor at a time.
+    if (src_binding && dst_binding && src_binding->descriptor_class == dst_binding->descriptor_class &&
+        src_binding->descriptor_class != DescriptorClass::Mutable &&
+        update.srcArrayElement + update.descriptorCount <= src_binding->count &&
+        update.dstArrayElement + update.descriptorCount <= dst_binding->count) {
+        auto &dst = *dst_binding;
+        const auto &src = *src_binding;
+        bool any_changed = false;
+        switch (src_binding->descriptor_class) {
+            case DescriptorClass::PlainSampler:
+                any_changed = CopyBindingRange<SamplerBinding>(*this, *state_data_, update, dst, src);
+                break;
+            case DescriptorClass::ImageSampler:
+                any_changed = CopyBindingRange<ImageSamplerBinding>(*this, *state_data_, update, dst, src);
+                break;
+            case DescriptorClass::Image:
+                any_changed = CopyBindingRange<ImageBinding>(*this, *state_data_, update, dst, src);
+                break;
+            case DescriptorClass::TexelBuffer:
+                any_changed = CopyBindingRange<TexelBinding>(*this, *state_data_, update, dst, src);
+                break;
+            case DescriptorClass::GeneralBuffer:
+                any_changed = CopyBindingRange<BufferBinding>(*this, *state_data_, update, dst, src);
+                break;
+            case DescriptorClass::InlineUniform:
+                any_changed = CopyBindingRange<InlineUniformBinding>(*this, *state_data_, update, dst, src);
+                break;
+            case DescriptorClass::AccelerationStructure:
+                any_changed = CopyBindingRange<AccelerationStructureBinding>(*this, *state_data_, update, dst, src);
+                break;
+            default:
+                assert(false);
+                break;
+        }
+        if (any_changed) {
+            some_update_ = true;
+            dst_binding->change_count = ++change_count_;
+        }
+        if (!(dst_binding->binding_flags &
+              (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT))) {
+            Invalidate(false);
+        }
+        return;
+    }
+
     auto src_iter = src_set.FindDescriptor(update.srcBinding, update.srcArrayElement);
     auto dst_iter = FindDescriptor(update.dstBinding, update.dstArrayElement);
     // Update parameters all look good so perform update
@@ -545,10 +708,12 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, co
             }
             dst.CopyUpdate(*this, *state_data_, src, src_iter.CurrentBinding().IsBindless(), type);
             some_update_ = true;
-            ++change_count_;
+            dst_iter.CurrentBinding().change_count = ++change_count_;
             dst_iter.updated(true);
-        } else {
+        } else if (dst_iter.updated()) {
+            // The descriptor is no longer valid, which the next draw has to see as well
             dst_iter.updated(false);
+            dst_iter.CurrentBinding().change_count = ++change_count_;
         }
     }
 
@@ -566,7 +731,8 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, co
 // Prereq: This should be called for a set that has been confirmed to be active for the given cb_state, meaning it's going
 //   to be used in a draw by the given cb_state
 void vvl::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, vvl::CommandBuffer *cb_state, vvl::Func command,
-                                         const vvl::Pipeline *pipe, const BindingVariableMap &binding_req_map) {
+                                         const vvl::Pipeline *pipe, const BindingRequirementList &binding_req_map,
+                                         std::optional<uint64_t> changed_since) {
     // Descriptor UpdateDrawState only call image layout validation callbacks. If it is disabled, skip the entire loop.
     if (device_data->disabled[image_layout_validation]) {
         return;
@@ -582,25 +748,34 @@ void vvl::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, vv
         if (SkipBinding(*binding)) {
             continue;
         }
+        if (changed_since && binding->change_count <= *changed_since) {
+            continue;
+        }
         switch (binding->descriptor_class) {
             case DescriptorClass::Image: {
                 auto *image_binding = static_cast<ImageBinding *>(binding);
                 for (uint32_t i = 0; i < image_binding->count; ++i) {
-                    image_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
+                    if (auto *descriptor = image_binding->descriptors.Find(i)) {
+                        descriptor->UpdateDrawState(device_data, cb_state);
+                    }
                 }
                 break;
             }
             case DescriptorClass::ImageSampler: {
                 auto *image_binding = static_cast<ImageSamplerBinding *>(binding);
                 for (uint32_t i = 0; i < image_binding->count; ++i) {
-                    image_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
+                    if (auto *descriptor = image_binding->descriptors.Find(i)) {
+                        descriptor->UpdateDrawState(device_data, cb_state);
+                    }
                 }
                 break;
             }
             case DescriptorClass::Mutable: {
                 auto *mutable_binding = static_cast<MutableBinding *>(binding);
                 for (uint32_t i = 0; i < mutable_binding->count; ++i) {
-                    mutable_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
+                    if (auto *descriptor = mutable_binding->descriptors.Find(i)) {
+                        descriptor->UpdateDrawState(device_data, cb_state);
+                    }
                 }
                 break;
             }
@@ -613,16 +788,17 @@ void vvl::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, vv
 // Helper template to change shared pointer members of a Descriptor, while
 // correctly managing links to the parent DescriptorSet.
 // src and dst are shared pointers.
+// The links are queued on the set, see DescriptorSet::FlushParentLinks().
 template <typename T>
 static void ReplaceStatePtr(DescriptorSet &set_state, T &dst, const T &src, bool is_bindless) {
     if (dst && !is_bindless) {
-        dst->RemoveParent(&set_state);
+        set_state.QueueParentLink(dst, false);
     }
     dst = src;
     // For descriptor bindings with UPDATE_AFTER_BIND or PARTIALLY_BOUND only set the object as a child, but not the descriptor as a
     // parent, so that destroying the object wont invalidate the descriptor
     if (dst && !is_bindless) {
-        dst->AddParent(&set_state);
+        set_state.QueueParentLink(dst, true);
     }
 }
 
@@ -30,6 +30,7 @@
 #include "generated/vk_safe_struct.h"
 #include "vulkan/vk_layer.h"
 #include "generated/vk_object_types.h"
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <set>
@@ -94,12 +95,32 @@ class DescriptorPool : public StateObject {
     mutable std::shared_mutex lock_;
 };
 
+class DescriptorSetLayout;
+
+// The descriptors of an update template entry that land in one binding. An entry whose descriptorCount goes past the end
+// of its binding rolls over to the next bindings, and is split in one chunk per binding.
+struct TemplateUpdateChunk {
+    uint32_t dst_binding;
+    uint32_t dst_array_element;
+    uint32_t descriptor_count;  // bytes for inline uniform blocks
+    VkDescriptorType type;
+    size_t offset;  // in pData of the first descriptor
+    size_t stride;
+};
+
+// Returns the chunks of all the entries of an update template, when applied to a set with the given layout
+std::vector<TemplateUpdateChunk> DecodeTemplateChunks(const VkDescriptorUpdateTemplateCreateInfo &create_info,
+                                                      const DescriptorSetLayout &layout);
+
 class DescriptorUpdateTemplate : public StateObject {
   public:
     const safe_VkDescriptorUpdateTemplateCreateInfo create_info;
+    // Decoded at creation for VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET templates, as their layout is known.
+    // Push descriptor templates are decoded against the layout of each push.
+    const std::vector<TemplateUpdateChunk> chunks;
 
-    DescriptorUpdateTemplate(VkDescriptorUpdateTemplate update_template, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
-        : StateObject(update_template, kVulkanObjectTypeDescriptorUpdateTemplate), create_info(pCreateInfo) {}
+    DescriptorUpdateTemplate(VkDescriptorUpdateTemplate update_template, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                             const DescriptorSetLayout *layout);
 
     VkDescriptorUpdateTemplate VkHandle() const { return handle_.Cast<VkDescriptorUpdateTemplate>(); };
 };
@@ -781,6 +802,76 @@ class DescriptorBinding {
     const uint32_t count;
     const bool has_immutable_samplers;
     small_vector<bool, 1, uint32_t> updated;
+    // The change count of the set after the last update of this binding, so a set whose contents changed can be
+    // revalidated one binding at a time
+    uint64_t change_count{0};
+};
+
+// Bindings with more descriptors than this are stored in pages that are only constructed when one of their descriptors
+// is written, 0 constructs all descriptors up front. Set from the khronos_validation.descriptor_paging_threshold setting.
+void SetDescriptorPagingThreshold(uint32_t threshold);
+uint32_t GetDescriptorPagingThreshold();
+
+// Descriptors of a binding. Large (bindless) arrays are mostly never written, so above GetDescriptorPagingThreshold() the
+// array is split in pages of kPageSize descriptors that are allocated by the first non-const access to one of them.
+// The const accessors never allocate: a descriptor of a missing page reads as a default constructed one.
+template <typename T>
+class DescriptorStorage {
+  public:
+    static constexpr uint32_t kPageSize = 256;
+
+    explicit DescriptorStorage(uint32_t count) : count_(count) {
+        const uint32_t threshold = GetDescriptorPagingThreshold();
+        if (threshold != 0 && count > threshold) {
+            pages_.resize((count + kPageSize - 1) / kPageSize);
+        } else {
+            dense_.resize(count);
+        }
+    }
+
+    uint32_t size() const { return count_; }
+
+    const T &operator[](uint32_t index) const {
+        assert(index < count_);
+        if (pages_.empty()) {
+            return dense_[index];
+        }
+        const auto &page = pages_[index / kPageSize];
+        return page ? page[index % kPageSize] : Unwritten();
+    }
+
+    T &operator[](uint32_t index) {
+        assert(index < count_);
+        if (pages_.empty()) {
+            return dense_[index];
+        }
+        const uint32_t page_index = index / kPageSize;
+        auto &page = pages_[page_index];
+        if (!page) {
+            page = std::make_unique<T[]>(std::min(kPageSize, count_ - page_index * kPageSize));
+        }
+        return page[index % kPageSize];
+    }
+
+    // nullptr for the descriptors that still read as Unwritten(), without allocating their page
+    T *Find(uint32_t index) {
+        assert(index < count_);
+        if (pages_.empty()) {
+            return &dense_[index];
+        }
+        auto &page = pages_[index / kPageSize];
+        return page ? &page[index % kPageSize] : nullptr;
+    }
+
+  private:
+    static const T &Unwritten() {
+        static const T unwritten;
+        return unwritten;
+    }
+
+    uint32_t count_;
+    small_vector<T, 1, uint32_t> dense_;
+    std::vector<std::unique_ptr<T[]>> pages_;
 };
 
 template <typename T>
@@ -824,7 +915,7 @@ class DescriptorBindingImpl : public DescriptorBinding {
         }
     }
 
-    small_vector<T, 1, uint32_t> descriptors;
+    DescriptorStorage<T> descriptors;
 };
 
 using SamplerBinding = DescriptorBindingImpl<SamplerDescriptor>;
@@ -836,7 +927,9 @@ using InlineUniformBinding = DescriptorBindingImpl<InlineUniformDescriptor>;
 using AccelerationStructureBinding = DescriptorBindingImpl<AccelerationStructureDescriptor>;
 using MutableBinding = DescriptorBindingImpl<MutableDescriptor>;
 
-// Helper class to encapsulate the descriptor update template decoding logic
+// Helper class to encapsulate the descriptor update template decoding logic.
+// Each chunk of the template becomes a single write pointing into pData when its stride is the size of the descriptor info,
+// only the chunks of interleaved data are split in one write per descriptor.
 struct DecodedTemplateUpdate {
     std::vector<VkWriteDescriptorSet> desc_writes;
     std::vector<VkWriteDescriptorSetInlineUniformBlockEXT> inline_infos;
@@ -902,14 +995,22 @@ class DescriptorSet : public StateObject {
     virtual void PerformWriteUpdate(const VkWriteDescriptorSet &);
     // Perform a CopyUpdate whose contents were just validated using ValidateCopyUpdate
     virtual void PerformCopyUpdate(const VkCopyDescriptorSet &, const DescriptorSet &src_set);
+    // The write and copy updates only queue the parent links between this set and the objects of its descriptors.
+    // FlushParentLinks() applies them with a single AddParent or RemoveParent per object, and must be called before the
+    // end of the API call that updated the set.
+    void QueueParentLink(std::shared_ptr<StateObject> child, bool link) {
+        pending_parent_links_.emplace_back(std::move(child), link);
+    }
+    void FlushParentLinks();
 
     const std::shared_ptr<DescriptorSetLayout const> &GetLayout() const { return layout_; };
     VkDescriptorSetLayout GetDescriptorSetLayout() const { return layout_->VkHandle(); }
     VkDescriptorSet VkHandle() const { return handle_.Cast<VkDescriptorSet>(); };
     // Bind given cmd_buffer to this descriptor set and
     // update CB image layout map with image/imagesampler descriptor image layouts
+    // If changed_since is set, only the bindings updated after that change count are visited
     void UpdateDrawState(ValidationStateTracker *, vvl::CommandBuffer *cb_state, vvl::Func command, const vvl::Pipeline *,
-                         const BindingVariableMap &);
+                         const BindingRequirementList &, std::optional<uint64_t> changed_since = std::nullopt);
 
     // For a particular binding, get the global index
     const IndexRange GetGlobalIndexRangeFromBinding(const uint32_t binding, bool actual_length = false) const {
@@ -1102,6 +1203,9 @@ class DescriptorSet : public StateObject {
     // If this descriptor set is a push descriptor set, the descriptor
     // set writes that were last pushed.
     std::vector<safe_VkWriteDescriptorSet> push_descriptor_set_writes;
+
+    // true to link the object, false to unlink it, in the order of the updates
+    std::vector<std::pair<std::shared_ptr<StateObject>, bool>> pending_parent_links_;
 };
 
 }  // namespace vvl
@@ -17,6 +17,10 @@
  * limitations under the License.
  */
 #include "state_tracker/device_memory_state.h"
+
+#include <algorithm>
+#include <limits>
+
 #include "state_tracker/image_state.h"
 
 using MemoryRange = vvl::BindableMemoryTracker::MemoryRange;
@@ -103,6 +107,23 @@ DeviceMemory::DeviceMemory(VkDeviceMemory memory, const VkMemoryAllocateInfo *p_
       p_driver_data(nullptr),
       fake_base_address(fake_address) {
 }
+
+void DeviceMemory::AddBoundRange(StateObject &resource, VkDeviceSize offset, VkDeviceSize size) {
+    auto guard = WriteLockGuard{bound_ranges_lock_};
+    bound_ranges_.emplace(offset, BoundRange{offset + size, &resource, resource.shared_from_this()});
+    max_bound_size_ = std::max(max_bound_size_, size);
+}
+
+void DeviceMemory::RemoveBoundRange(const StateObject &resource, VkDeviceSize offset) {
+    auto guard = WriteLockGuard{bound_ranges_lock_};
+    auto range = bound_ranges_.equal_range(offset);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.key == &resource) {
+            bound_ranges_.erase(it);
+            return;
+        }
+    }
+}
 }  // namespace vvl
 
 void vvl::BindableLinearMemoryTracker::BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state,
@@ -110,9 +131,16 @@ void vvl::BindableLinearMemoryTracker::BindMemory(StateObject *parent, std::shar
     if (!mem_state) return;
 
     mem_state->AddParent(parent);
+    mem_state->AddBoundRange(*parent, memory_offset, size);
     binding_ = {mem_state, memory_offset, 0u};
 }
 
+void vvl::BindableLinearMemoryTracker::RemoveBoundRanges(const StateObject &resource) {
+    if (binding_.memory_state) {
+        binding_.memory_state->RemoveBoundRange(resource, binding_.memory_offset);
+    }
+}
+
 DeviceMemoryState vvl::BindableLinearMemoryTracker::GetBoundMemoryStates() const {
     return binding_.memory_state ? DeviceMemoryState{binding_.memory_state} : DeviceMemoryState{};
 }
@@ -155,19 +183,48 @@ bool vvl::BindableSparseMemoryTracker::HasFullRangeBound() const {
 
 void vvl::BindableSparseMemoryTracker::BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state,
                                              VkDeviceSize memory_offset, VkDeviceSize resource_offset, VkDeviceSize size) {
-    MEM_BINDING memory_data{mem_state, memory_offset, resource_offset};
-    BindingMap::value_type item{{resource_offset, resource_offset + size}, memory_data};
+    const SparseBind bind{mem_state, memory_offset, resource_offset, size};
+    BindSparseMemory(parent, vvl::make_span(&bind, 1));
+}
 
+void vvl::BindableSparseMemoryTracker::CountMemoryUses(const MemoryRange &range, int64_t delta, MemoryCountDeltas &deltas) const {
+    const auto range_bounds = binding_map_.bounds(range);
+    for (auto it = range_bounds.begin; it != range_bounds.end; ++it) {
+        if (it->second.memory_state) {
+            deltas[it->second.memory_state] += delta;
+        }
+    }
+}
+
+void vvl::BindableSparseMemoryTracker::BindSparseMemory(StateObject *parent, vvl::span<const SparseBind> binds) {
     auto guard = WriteLockGuard{binding_lock_};
 
-    // Since we don't know which ranges will be removed, we need to unbind everything and rebind later
-    for (auto &value_pair : binding_map_) {
-        if (value_pair.second.memory_state) value_pair.second.memory_state->RemoveParent(parent);
+    MemoryCountDeltas deltas;
+    for (const auto &bind : binds) {
+        const MemoryRange range{bind.resource_offset, bind.resource_offset + bind.size};
+        // What is left of the bindings the new one splits is right next to it, so counting the bindings touching the range
+        // before and after the overwrite accounts for all the changes
+        const MemoryRange touching{range.begin > 0 ? range.begin - 1 : 0,
+                                   range.end < std::numeric_limits<VkDeviceSize>::max() ? range.end + 1 : range.end};
+        CountMemoryUses(touching, -1, deltas);
+        binding_map_.overwrite_range(
+            BindingMap::value_type{range, MEM_BINDING{bind.memory_state, bind.memory_offset, bind.resource_offset}});
+        CountMemoryUses(touching, 1, deltas);
     }
-    binding_map_.overwrite_range(item);
 
-    for (auto &value_pair : binding_map_) {
-        if (value_pair.second.memory_state) value_pair.second.memory_state->AddParent(parent);
+    for (const auto &[memory_state, delta] : deltas) {
+        if (delta == 0) {
+            continue;
+        }
+        auto &count = memory_use_counts_[memory_state.get()];
+        const uint64_t old_count = count;
+        count = static_cast<uint64_t>(static_cast<int64_t>(count) + delta);
+        if (old_count == 0) {
+            memory_state->AddParent(parent);
+        } else if (count == 0) {
+            memory_state->RemoveParent(parent);
+            memory_use_counts_.erase(memory_state.get());
+        }
     }
 }
 
@@ -238,9 +295,18 @@ void vvl::BindableMultiplanarMemoryTracker::BindMemory(StateObject *parent, std:
 
     assert(resource_offset < planes_.size());
     mem_state->AddParent(parent);
+    mem_state->AddBoundRange(*parent, memory_offset, size);
     planes_[static_cast<size_t>(resource_offset)].binding = {mem_state, memory_offset, 0u};
 }
 
+void vvl::BindableMultiplanarMemoryTracker::RemoveBoundRanges(const StateObject &resource) {
+    for (const auto &plane : planes_) {
+        if (plane.binding.memory_state) {
+            plane.binding.memory_state->RemoveBoundRange(resource, plane.binding.memory_offset);
+        }
+    }
+}
+
 // range needs to be between [0, planes_[0].size + planes_[1].size + planes_[2].size)
 // To access plane 0 range must be [0, planes_[0].size)
 // To access plane 1 range must be [planes_[0].size, planes_[1].size)
@@ -17,6 +17,8 @@
  * limitations under the License.
  */
 #pragma once
+#include <map>
+#include <shared_mutex>
 #include "state_tracker/state_object.h"
 #include "containers/range_vector.h"
 #include "generated/vk_safe_struct.h"
@@ -82,6 +84,44 @@ class DeviceMemory : public StateObject {
     bool IsDedicatedImage() const { return GetDedicatedImage() != VK_NULL_HANDLE; }
 
     VkDeviceMemory deviceMemory() const { return handle_.Cast<VkDeviceMemory>(); }
+
+    // Sub-allocators bind thousands of resources to a single allocation, so the non sparse bindings are also kept sorted by
+    // memory offset. Finding the resources over a range only visits the ones starting within the largest bound size before it,
+    // instead of every object bound to the memory.
+    void AddBoundRange(StateObject &resource, VkDeviceSize offset, VkDeviceSize size);
+    void RemoveBoundRange(const StateObject &resource, VkDeviceSize offset);
+
+    // Calls fn(StateObject &) on the live resources bound to any part of [begin, end), until it returns true
+    template <typename Fn>
+    bool AnyBoundInRange(VkDeviceSize begin, VkDeviceSize end, Fn &&fn) const {
+        small_vector<std::shared_ptr<StateObject>, 4, uint32_t> resources;
+        {
+            auto guard = ReadLockGuard{bound_ranges_lock_};
+            auto it = bound_ranges_.lower_bound(begin > max_bound_size_ ? begin - max_bound_size_ : 0);
+            for (; it != bound_ranges_.end() && it->first < end; ++it) {
+                if (it->second.end > begin) {
+                    if (auto resource = it->second.resource.lock()) {
+                        resources.emplace_back(std::move(resource));
+                    }
+                }
+            }
+        }
+        // Called without the lock held, the resource could be looking up this memory
+        for (const auto &resource : resources) {
+            if (fn(*resource)) return true;
+        }
+        return false;
+    }
+
+  private:
+    struct BoundRange {
+        VkDeviceSize end;
+        const StateObject *key;  // To remove it, the weak_ptr is already expired when a resource is destroyed
+        std::weak_ptr<StateObject> resource;
+    };
+    std::multimap<VkDeviceSize, BoundRange> bound_ranges_;
+    VkDeviceSize max_bound_size_ = 0;
+    mutable std::shared_mutex bound_ranges_lock_;
 };
 
 // Generic memory binding struct to track objects bound to objects
@@ -110,8 +150,25 @@ class BindableMemoryTracker {
 
     virtual void BindMemory(StateObject *, std::shared_ptr<vvl::DeviceMemory> &, VkDeviceSize, VkDeviceSize, VkDeviceSize) = 0;
 
+    // A VkSparseMemoryBind with its memory resolved
+    struct SparseBind {
+        std::shared_ptr<vvl::DeviceMemory> memory_state;
+        VkDeviceSize memory_offset;
+        VkDeviceSize resource_offset;
+        VkDeviceSize size;
+    };
+    // Applies the binds in order, as as many BindMemory calls would
+    virtual void BindSparseMemory(StateObject *parent, vvl::span<const SparseBind> binds) {
+        for (const auto &bind : binds) {
+            auto mem_state = bind.memory_state;
+            BindMemory(parent, mem_state, bind.memory_offset, bind.resource_offset, bind.size);
+        }
+    }
+
     virtual BoundMemoryRange GetBoundMemoryRange(const MemoryRange &) const = 0;
     virtual DeviceMemoryState GetBoundMemoryStates() const = 0;
+    // Removes the bindings of resource from the bound ranges of its memories, when it is destroyed
+    virtual void RemoveBoundRanges(const StateObject &resource) {}
 };
 
 // Dummy memory tracker for swapchains
@@ -148,6 +205,7 @@ class BindableLinearMemoryTracker : public BindableMemoryTracker {
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
     DeviceMemoryState GetBoundMemoryStates() const override;
+    void RemoveBoundRanges(const StateObject &resource) override;
 
   private:
     MEM_BINDING binding_;
@@ -168,15 +226,23 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
 
     void BindMemory(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &mem_state, VkDeviceSize memory_offset,
                     VkDeviceSize resource_offset, VkDeviceSize size) override;
+    // Takes the lock once for all the binds, virtual texturing binds and unbinds thousands of pages of a resource at once
+    void BindSparseMemory(StateObject *parent, vvl::span<const SparseBind> binds) override;
 
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
 
     DeviceMemoryState GetBoundMemoryStates() const override;
 
   private:
+    using MemoryCountDeltas = vvl::unordered_map<std::shared_ptr<vvl::DeviceMemory>, int64_t>;
+    void CountMemoryUses(const MemoryRange &range, int64_t delta, MemoryCountDeltas &deltas) const;
+
     // This range map uses the range in resource space to know the size of the bound memory
     using BindingMap = sparse_container::range_map<VkDeviceSize, MEM_BINDING>;
     BindingMap binding_map_;
+    // Number of entries of binding_map_ using each memory, the resource is a parent of the memories used at least once.
+    // Lets a bind only update the parents of the memories it adds or removes instead of the ones of every binding.
+    vvl::unordered_map<const vvl::DeviceMemory *, uint64_t> memory_use_counts_;
     mutable std::shared_mutex binding_lock_;
     VkDeviceSize resource_size_;
     bool is_resident_;
@@ -199,6 +265,7 @@ class BindableMultiplanarMemoryTracker : public BindableMemoryTracker {
     BoundMemoryRange GetBoundMemoryRange(const MemoryRange &range) const override;
 
     DeviceMemoryState GetBoundMemoryStates() const override;
+    void RemoveBoundRanges(const StateObject &resource) override;
 
   private:
     struct Plane {
@@ -223,6 +290,7 @@ class Bindable : public StateObject {
     }
 
     void Destroy() override {
+        memory_tracker_->RemoveBoundRanges(*this);
         for (auto &state : memory_tracker_->GetBoundMemoryStates()) {
             state->RemoveParent(this);
         }
@@ -273,6 +341,10 @@ class Bindable : public StateObject {
         memory_tracker_->BindMemory(parent, mem, memory_offset, resource_offset, mem_size);
     }
 
+    void BindSparseMemory(StateObject *parent, vvl::span<const BindableMemoryTracker::SparseBind> binds) {
+        memory_tracker_->BindSparseMemory(parent, binds);
+    }
+
     bool HasFullRangeBound() const { return memory_tracker_->HasFullRangeBound(); }
 
     std::pair<VkDeviceMemory, BindableMemoryTracker::MemoryRange> GetResourceMemoryOverlap(
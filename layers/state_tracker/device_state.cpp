@@ -0,0 +1,65 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "state_tracker/device_state.h"
+
+// Two threads missing the same entry both query the driver, they get the same result so either insert is fine
+VkFormatProperties vvl::PhysicalDevice::GetFormatProperties(VkFormat format) const {
+    auto it = format_properties_.find(format);
+    if (it != format_properties_.end()) {
+        return it->second;
+    }
+    VkFormatProperties format_properties;
+    DispatchGetPhysicalDeviceFormatProperties(PhysDev(), format, &format_properties);
+    format_properties_.insert(format, format_properties);
+    return format_properties;
+}
+
+VkFormatProperties3KHR vvl::PhysicalDevice::GetFormatProperties3(VkFormat format) const {
+    auto it = format_properties3_.find(format);
+    if (it != format_properties3_.end()) {
+        return it->second;
+    }
+    VkFormatProperties3KHR fmt_props_3 = vku::InitStructHelper();
+    VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
+    DispatchGetPhysicalDeviceFormatProperties2(PhysDev(), format, &fmt_props_2);
+    fmt_props_3.linearTilingFeatures |= fmt_props_2.formatProperties.linearTilingFeatures;
+    fmt_props_3.optimalTilingFeatures |= fmt_props_2.formatProperties.optimalTilingFeatures;
+    fmt_props_3.bufferFeatures |= fmt_props_2.formatProperties.bufferFeatures;
+    fmt_props_3.pNext = nullptr;
+    format_properties3_.insert(format, fmt_props_3);
+    return fmt_props_3;
+}
+
+VkResult vvl::PhysicalDevice::GetImageFormatProperties(VkFormat format, VkImageType type, VkImageTiling tiling,
+                                                       VkImageUsageFlags usage, VkImageCreateFlags flags,
+                                                       VkImageFormatProperties *properties) const {
+    const ImageFormatKey key{format, type, tiling, usage, flags};
+    auto it = image_format_properties_.find(key);
+    if (it == image_format_properties_.end()) {
+        ImageFormatResult result;
+        result.result =
+            DispatchGetPhysicalDeviceImageFormatProperties(PhysDev(), format, type, tiling, usage, flags, &result.properties);
+        // Running out of memory is not a property of the format
+        if (result.result == VK_SUCCESS || result.result == VK_ERROR_FORMAT_NOT_SUPPORTED) {
+            image_format_properties_.insert(key, result);
+        }
+        *properties = result.properties;
+        return result.result;
+    }
+    *properties = it->second.properties;
+    return it->second.result;
+}
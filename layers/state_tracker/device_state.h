@@ -20,6 +20,8 @@
 #include "state_tracker/state_object.h"
 #include "generated/layer_chassis_dispatch.h"
 #include "generated/vk_safe_struct.h"
+#include "utils/hash_util.h"
+#include "utils/vk_layer_utils.h"
 #include <vector>
 
 class QueueFamilyPerfCounters {
@@ -55,7 +57,39 @@ class PhysicalDevice : public StateObject {
 
     VkPhysicalDevice PhysDev() const { return handle_.Cast<VkPhysicalDevice>(); }
 
+    // The format and image format properties of a physical device never change, so validation only queries the driver once
+    // for each of them. GetFormatProperties3 also has the VkFormatFeatureFlags2 only bits, it is for devices that enabled
+    // VK_KHR_format_feature_flags2.
+    VkFormatProperties GetFormatProperties(VkFormat format) const;
+    VkFormatProperties3KHR GetFormatProperties3(VkFormat format) const;
+    // Same as vkGetPhysicalDeviceImageFormatProperties, or vkGetPhysicalDeviceImageFormatProperties2 without a pNext chain
+    VkResult GetImageFormatProperties(VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage,
+                                      VkImageCreateFlags flags, VkImageFormatProperties *properties) const;
+
   private:
+    struct ImageFormatKey {
+        VkFormat format;
+        VkImageType type;
+        VkImageTiling tiling;
+        VkImageUsageFlags usage;
+        VkImageCreateFlags flags;
+
+        bool operator==(const ImageFormatKey &other) const {
+            return format == other.format && type == other.type && tiling == other.tiling && usage == other.usage &&
+                   flags == other.flags;
+        }
+        size_t hash() const { return (hash_util::HashCombiner() << format << type << tiling << usage << flags).Value(); }
+    };
+    struct ImageFormatResult {
+        VkResult result = VK_SUCCESS;
+        VkImageFormatProperties properties = {};
+    };
+
+    mutable vl_concurrent_unordered_map<VkFormat, VkFormatProperties> format_properties_;
+    mutable vl_concurrent_unordered_map<VkFormat, VkFormatProperties3KHR> format_properties3_;
+    mutable vl_concurrent_unordered_map<ImageFormatKey, ImageFormatResult, 2, hash_util::HasHashMember<ImageFormatKey>>
+        image_format_properties_;
+
     const std::vector<VkQueueFamilyProperties> GetQueueFamilyProps(VkPhysicalDevice phys_dev) {
         std::vector<VkQueueFamilyProperties> result;
         uint32_t count;
@@ -77,6 +77,13 @@ void vvl::Fence::NotifyAndWait(const Location &loc) {
     }
 }
 
+void vvl::Fence::Notify() const {
+    auto guard = ReadLock();
+    if (state_ == kInflight && queue_) {
+        queue_->Notify(seq_);
+    }
+}
+
 // Retire from a queue operation
 void vvl::Fence::Retire() {
     auto guard = WriteLock();
@@ -75,6 +75,9 @@ class Fence : public RefcountedStateObject {
     // Notify the queue that the fence has signalled and then wait for the queue
     // to update state.
     void NotifyAndWait(const Location &loc);
+    // Only notify the queue, so a wait on several fences lets each of their queues retire at the same time before
+    // NotifyAndWait() is called on them one by one.
+    void Notify() const;
 
     // Update state of the completed fence. This should only be called by Queue.
     void Retire();
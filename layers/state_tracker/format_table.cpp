@@ -0,0 +1,127 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "state_tracker/format_table.h"
+#include "state_tracker/device_state.h"
+
+#include <algorithm>
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+// The extension formats, as ranges of consecutive values
+static const std::pair<VkFormat, VkFormat> kExtensionFormatRanges[] = {
+    {VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG, VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG},
+    {VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK, VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK},
+    {VK_FORMAT_G8B8G8R8_422_UNORM, VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM},
+    {VK_FORMAT_G8_B8R8_2PLANE_444_UNORM, VK_FORMAT_G16_B16R16_2PLANE_444_UNORM},
+    {VK_FORMAT_A4R4G4B4_UNORM_PACK16, VK_FORMAT_A4B4G4R4_UNORM_PACK16},
+    {VK_FORMAT_R16G16_S10_5_NV, VK_FORMAT_R16G16_S10_5_NV},
+    {VK_FORMAT_A1B5G5R5_UNORM_PACK16_KHR, VK_FORMAT_A8_UNORM_KHR},
+};
+
+static VkFormatProperties3KHR QueryFormatProperties(const vvl::PhysicalDevice &physical_device_state, bool has_format_feature2,
+                                                    VkFormat format) {
+    if (has_format_feature2) {
+        return physical_device_state.GetFormatProperties3(format);
+    }
+    const VkFormatProperties format_properties = physical_device_state.GetFormatProperties(format);
+    VkFormatProperties3KHR fmt_props_3 = vku::InitStructHelper();
+    fmt_props_3.linearTilingFeatures = format_properties.linearTilingFeatures;
+    fmt_props_3.optimalTilingFeatures = format_properties.optimalTilingFeatures;
+    fmt_props_3.bufferFeatures = format_properties.bufferFeatures;
+    return fmt_props_3;
+}
+
+static vvl::FormatInfo MakeFormatInfo(const vvl::PhysicalDevice &physical_device_state, bool has_format_feature2,
+                                      bool query_features, VkFormat format) {
+    vvl::FormatInfo info;
+    if (query_features) {
+        const VkFormatProperties3KHR fmt_props_3 = QueryFormatProperties(physical_device_state, has_format_feature2, format);
+        info.has_features = true;
+        info.linear_tiling_features = fmt_props_3.linearTilingFeatures;
+        info.optimal_tiling_features = fmt_props_3.optimalTilingFeatures;
+        info.buffer_features = fmt_props_3.bufferFeatures;
+    }
+    info.compatibility_class = vkuFormatCompatibilityClass(format);
+    info.texel_block_extent = vkuFormatTexelBlockExtent(format);
+    info.element_size = vkuFormatElementSize(format);
+    info.plane_count = vkuFormatPlaneCount(format);
+    info.is_color = vkuFormatIsColor(format);
+    info.has_depth = vkuFormatHasDepth(format);
+    info.has_stencil = vkuFormatHasStencil(format);
+    info.is_compressed = vkuFormatIsCompressed(format);
+    info.is_blocked_image = vkuFormatIsBlockedImage(format);
+    info.is_uint = vkuFormatIsUINT(format);
+    info.is_sint = vkuFormatIsSINT(format);
+    return info;
+}
+
+void vvl::FormatTable::Init(const PhysicalDevice &physical_device_state, bool has_format_feature2,
+                            const std::function<bool(VkFormat)> &is_valid_format) {
+    physical_device_state_ = &physical_device_state;
+    has_format_feature2_ = has_format_feature2;
+
+    core_formats_.clear();
+    core_formats_.reserve(VK_FORMAT_ASTC_12x12_SRGB_BLOCK + 1);
+    for (uint32_t value = VK_FORMAT_UNDEFINED; value <= VK_FORMAT_ASTC_12x12_SRGB_BLOCK; ++value) {
+        const VkFormat format = static_cast<VkFormat>(value);
+        // VK_FORMAT_UNDEFINED has no features to query
+        core_formats_.emplace_back(
+            MakeFormatInfo(physical_device_state, has_format_feature2, format != VK_FORMAT_UNDEFINED, format));
+    }
+
+    extension_formats_.clear();
+    for (const auto &range : kExtensionFormatRanges) {
+        for (uint32_t value = range.first; value <= static_cast<uint32_t>(range.second); ++value) {
+            const VkFormat format = static_cast<VkFormat>(value);
+            extension_formats_.emplace_back(
+                format, MakeFormatInfo(physical_device_state, has_format_feature2, is_valid_format(format), format));
+        }
+    }
+    std::sort(extension_formats_.begin(), extension_formats_.end(),
+              [](const auto &a, const auto &b) { return a.first < b.first; });
+}
+
+const vvl::FormatInfo &vvl::FormatTable::GetExtensionFormat(VkFormat format) const {
+    static const FormatInfo kUndefined;
+    auto it = std::lower_bound(extension_formats_.begin(), extension_formats_.end(), format,
+                               [](const auto &entry, VkFormat value) { return entry.first < value; });
+    if (it != extension_formats_.end() && it->first == format) {
+        return it->second;
+    }
+    return core_formats_.empty() ? kUndefined : core_formats_[VK_FORMAT_UNDEFINED];
+}
+
+VkFormatProperties3KHR vvl::FormatTable::GetFormatProperties(VkFormat format) const {
+    const FormatInfo &info = Get(format);
+    if (!info.has_features && physical_device_state_) {
+        // Formats of extensions that are not enabled, and the ones the table doesn't know of
+        return QueryFormatProperties(*physical_device_state_, has_format_feature2_, format);
+    }
+    VkFormatProperties3KHR fmt_props_3 = vku::InitStructHelper();
+    fmt_props_3.linearTilingFeatures = info.linear_tiling_features;
+    fmt_props_3.optimalTilingFeatures = info.optimal_tiling_features;
+    fmt_props_3.bufferFeatures = info.buffer_features;
+    return fmt_props_3;
+}
+
+VkFormatFeatureFlags2KHR vvl::FormatTable::GetTilingFeatures(VkFormat format, VkImageTiling tiling) const {
+    const FormatInfo &info = Get(format);
+    if (!info.has_features) {
+        const VkFormatProperties3KHR fmt_props_3 = GetFormatProperties(format);
+        return tiling == VK_IMAGE_TILING_LINEAR ? fmt_props_3.linearTilingFeatures : fmt_props_3.optimalTilingFeatures;
+    }
+    return tiling == VK_IMAGE_TILING_LINEAR ? info.linear_tiling_features : info.optimal_tiling_features;
+}
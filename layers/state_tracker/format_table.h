@@ -0,0 +1,81 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <vulkan/vulkan.h>
+#include <vulkan/utility/vk_format_utils.h>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+class PhysicalDevice;
+
+// What format validation derives from a VkFormat, the vkuFormat* results and the features of the device
+struct FormatInfo {
+    // With the VkFormatFeatureFlags2 only bits when the device has VK_KHR_format_feature_flags2, only queried when
+    // has_features is set
+    bool has_features = false;
+    VkFormatFeatureFlags2KHR linear_tiling_features = 0;
+    VkFormatFeatureFlags2KHR optimal_tiling_features = 0;
+    VkFormatFeatureFlags2KHR buffer_features = 0;
+
+    VKU_FORMAT_COMPATIBILITY_CLASS compatibility_class = VKU_FORMAT_COMPATIBILITY_CLASS_NONE;
+    VkExtent3D texel_block_extent = {1, 1, 1};
+    uint32_t element_size = 0;
+    uint32_t plane_count = 1;
+    bool is_color = false;
+    bool has_depth = false;
+    bool has_stencil = false;
+    bool is_compressed = false;
+    bool is_blocked_image = false;
+    bool is_uint = false;
+    bool is_sint = false;
+
+    bool IsDepthOrStencil() const { return has_depth || has_stencil; }
+    bool IsMultiplane() const { return plane_count > 1; }
+};
+
+// Built when the device is created, so the format checks of image, view and copy validation are table loads. The core
+// formats are indexed by their value, the few extension formats are in a sorted side table.
+class FormatTable {
+  public:
+    // The features of the formats for which is_valid_format is false, as their extension isn't enabled, are not queried
+    void Init(const PhysicalDevice &physical_device_state, bool has_format_feature2,
+              const std::function<bool(VkFormat)> &is_valid_format);
+
+    // Unknown formats get the properties of VK_FORMAT_UNDEFINED
+    const FormatInfo &Get(VkFormat format) const {
+        const auto index = static_cast<size_t>(format);
+        return index < core_formats_.size() ? core_formats_[index] : GetExtensionFormat(format);
+    }
+
+    // The features from the table, or from the physical device for the formats the table has none for
+    VkFormatProperties3KHR GetFormatProperties(VkFormat format) const;
+    VkFormatFeatureFlags2KHR GetTilingFeatures(VkFormat format, VkImageTiling tiling) const;
+
+  private:
+    const FormatInfo &GetExtensionFormat(VkFormat format) const;
+
+    const PhysicalDevice *physical_device_state_ = nullptr;
+    bool has_format_feature2_ = false;
+
+    std::vector<FormatInfo> core_formats_;
+    std::vector<std::pair<VkFormat, FormatInfo>> extension_formats_;
+};
+
+}  // namespace vvl
@@ -91,9 +91,56 @@ bool ImageSubresourceLayoutMap::SubresourceLayout::operator==(const ImageSubreso
 ImageSubresourceLayoutMap::ImageSubresourceLayoutMap(const vvl::Image& image_state)
     : image_state_(image_state),
       encoder_(image_state.subresource_encoder),
-      layouts_(encoder_.SubresourceCount()),
       initial_layout_states_() {}
 
+const ImageSubresourceLayoutMap::LayoutMap& ImageSubresourceLayoutMap::GetLayoutMap() const {
+    if (ranged_) {
+        return *layouts_;
+    }
+    std::lock_guard<std::mutex> guard(expand_lock_);
+    if (!layouts_) {
+        auto layouts = std::make_unique<LayoutMap>(encoder_.SubresourceCount());
+        if (uniform_) {
+            layouts->insert(layouts->end(), std::make_pair(FullRange(), *uniform_));
+        }
+        layouts_ = std::move(layouts);
+    }
+    return *layouts_;
+}
+
+ImageSubresourceLayoutMap::LayoutMap& ImageSubresourceLayoutMap::Ranged() {
+    if (!ranged_) {
+        auto layouts = std::make_unique<LayoutMap>(encoder_.SubresourceCount());
+        if (uniform_) {
+            layouts->insert(layouts->end(), std::make_pair(FullRange(), *uniform_));
+            uniform_.reset();
+        }
+        layouts_ = std::move(layouts);
+        ranged_ = true;
+    }
+    return *layouts_;
+}
+
+// What UpdateLayoutStateImpl does for a range covering the whole image, when there are no ranges yet
+bool ImageSubresourceLayoutMap::UpdateUniform(LayoutEntry& new_entry, const vvl::CommandBuffer& cb_state,
+                                              const vvl::ImageView* view_state) {
+    if (uniform_) {
+        if (!uniform_->CurrentWillChange(new_entry.current_layout)) {
+            return false;
+        }
+        uniform_->Update(new_entry);
+    } else {
+        if (new_entry.state == nullptr) {
+            initial_layout_states_.emplace_back(cb_state, view_state);
+            new_entry.state = &initial_layout_states_.back();
+        }
+        uniform_.emplace(new_entry);
+    }
+    // Only built for GetLayoutMap(), which can't be in use while the command buffer is recorded
+    layouts_.reset();
+    return true;
+}
+
 // Use the unwrapped maps from the BothMap in the actual implementation
 template <typename LayoutMap>
 static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states, RangeGenerator& range_gen,
@@ -115,12 +162,17 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const vvl::CommandBuff
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
 
     RangeGenerator range_gen(encoder_, range);
-    if (layouts_.SmallMode()) {
-        return SetSubresourceRangeLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
+    if (!ranged_ && *range_gen == FullRange()) {
+        LayoutEntry entry(expected_layout, layout);
+        return UpdateUniform(entry, cb_state, nullptr);
+    }
+    auto& layouts = Ranged();
+    if (layouts.SmallMode()) {
+        return SetSubresourceRangeLayoutImpl(layouts.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
                                              expected_layout);
     } else {
-        assert(!layouts_.Tristate());
-        return SetSubresourceRangeLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout,
+        assert(!layouts.Tristate());
+        return SetSubresourceRangeLayoutImpl(layouts.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout,
                                              expected_layout);
     }
 }
@@ -142,11 +194,17 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::Comm
     if (!InRange(range)) return;  // Don't even try to track bogus subreources
 
     RangeGenerator range_gen(encoder_, range);
-    if (layouts_.SmallMode()) {
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
+    if (!ranged_ && *range_gen == FullRange()) {
+        LayoutEntry entry(layout);
+        UpdateUniform(entry, cb_state, nullptr);
+        return;
+    }
+    auto& layouts = Ranged();
+    if (layouts.SmallMode()) {
+        SetSubresourceRangeInitialLayoutImpl(layouts.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
     } else {
-        assert(!layouts_.Tristate());
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
+        assert(!layouts.Tristate());
+        SetSubresourceRangeInitialLayoutImpl(layouts.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
     }
 }
 
@@ -154,12 +212,18 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::Comm
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::CommandBuffer& cb_state, VkImageLayout layout,
                                                                  const vvl::ImageView& view_state) {
     RangeGenerator range_gen(view_state.range_generator);
-    if (layouts_.SmallMode()) {
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
+    if (!ranged_ && *range_gen == FullRange()) {
+        LayoutEntry entry(layout);
+        UpdateUniform(entry, cb_state, &view_state);
+        return;
+    }
+    auto& layouts = Ranged();
+    if (layouts.SmallMode()) {
+        SetSubresourceRangeInitialLayoutImpl(layouts.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
                                              &view_state);
     } else {
-        assert(!layouts_.Tristate());
-        SetSubresourceRangeInitialLayoutImpl(layouts_.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout,
+        assert(!layouts.Tristate());
+        SetSubresourceRangeInitialLayoutImpl(layouts.GetBigMap(), initial_layout_states_, range_gen, cb_state, layout,
                                              &view_state);
     }
 }
@@ -178,7 +242,18 @@ bool ImageSubresourceLayoutMap::UpdateFrom(const ImageSubresourceLayoutMap& othe
     //         currently this function is only used to import from secondary command buffers, destruction of which
     //         invalidate the referencing primary command buffer, meaning that the dangling pointer will either be
     //         cleaned up in invalidation, on not referenced by validation code.
-    return sparse_container::splice(layouts_, other.layouts_, LayoutEntry::Updater());
+    if (!ranged_ && !other.ranged_) {
+        if (!other.uniform_) {
+            return false;
+        }
+        layouts_.reset();
+        if (!uniform_) {
+            uniform_ = other.uniform_;
+            return true;
+        }
+        return uniform_->Update(*other.uniform_);
+    }
+    return sparse_container::splice(Ranged(), other.GetLayoutMap(), LayoutEntry::Updater());
 }
 
 }  // namespace image_layout_map
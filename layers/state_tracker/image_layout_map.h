@@ -22,6 +22,8 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <vector>
 
 #include "containers/range_vector.h"
@@ -110,7 +112,9 @@ class ImageSubresourceLayoutMap {
         };
     };
     using InitialLayoutStates = small_vector<InitialLayoutState, 2, uint32_t>;
-    using LayoutMap = subresource_adapter::BothRangeMap<LayoutEntry, 16>;
+    // Layout maps are read on every layout check but only hold a few entries per distinct layout, so use the flat map
+    using LayoutMap =
+        subresource_adapter::BothRangeMap<LayoutEntry, 16, sparse_container::flat_range_map<subresource_adapter::IndexType, LayoutEntry>>;
     using RangeType = LayoutMap::key_type;
 
     bool SetSubresourceRangeLayout(const vvl::CommandBuffer& cb_state, const VkImageSubresourceRange& range, VkImageLayout layout,
@@ -121,7 +125,10 @@ class ImageSubresourceLayoutMap {
                                           const vvl::ImageView& view_state);
     bool UpdateFrom(const ImageSubresourceLayoutMap& from);
     uintptr_t CompatibilityKey() const;
-    const LayoutMap& GetLayoutMap() const { return layouts_; }
+    // Expands a uniform map, prefer AnyInRange() or AnyLayout() where they are enough
+    const LayoutMap& GetLayoutMap() const;
+    bool Empty() const { return ranged_ ? layouts_->empty() : !uniform_; }
+    size_t EntryCount() const { return ranged_ ? layouts_->size() : (uniform_ ? 1 : 0); }
     ImageSubresourceLayoutMap(const vvl::Image& image_state);
     ~ImageSubresourceLayoutMap() {}
     const vvl::Image* GetImageView() const { return &image_state_; };
@@ -150,8 +157,11 @@ class ImageSubresourceLayoutMap {
     }
 
     bool AnyInRange(RangeGenerator&& gen, std::function<bool(const RangeType& range, const LayoutEntry& state)>&& func) const {
+        if (!ranged_) {
+            return uniform_ && gen->non_empty() && func(FullRange(), *uniform_);
+        }
         for (; gen->non_empty(); ++gen) {
-            for (auto pos = layouts_.lower_bound(*gen); (pos != layouts_.end()) && (gen->intersects(pos->first)); ++pos) {
+            for (auto pos = layouts_->lower_bound(*gen); (pos != layouts_->end()) && (gen->intersects(pos->first)); ++pos) {
                 if (func(pos->first, pos->second)) {
                     return true;
                 }
@@ -160,14 +170,37 @@ class ImageSubresourceLayoutMap {
         return false;
     }
 
+    bool AnyLayout(std::function<bool(const RangeType& range, const LayoutEntry& state)>&& func) const {
+        if (!ranged_) {
+            return uniform_ && func(FullRange(), *uniform_);
+        }
+        for (const auto& [range, entry] : *layouts_) {
+            if (func(range, entry)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
   protected:
     bool InRange(const VkImageSubresource& subres) const { return encoder_.InRange(subres); }
     bool InRange(const VkImageSubresourceRange& range) const { return encoder_.InRange(range); }
 
   private:
+    RangeType FullRange() const { return RangeType(0, encoder_.SubresourceCount()); }
+    LayoutMap& Ranged();
+    bool UpdateUniform(LayoutEntry& new_entry, const vvl::CommandBuffer& cb_state, const vvl::ImageView* view_state);
+
     const vvl::Image& image_state_;
     const Encoder& encoder_;
-    LayoutMap layouts_;
+    // Until a part of the image gets a layout of its own, the whole image is in uniform_ (or untouched when it is empty) and
+    // only GetLayoutMap() needs the range map, built on demand in layouts_. Once ranged_, layouts_ is the only state.
+    // Images used as a whole are by far the most common, and this keeps their barriers away from the range map.
+    bool ranged_ = false;
+    std::optional<LayoutEntry> uniform_;
+    mutable std::unique_ptr<LayoutMap> layouts_;
+    // Command buffers are only changed while recorded, but can be read by the submits of several queues at once
+    mutable std::mutex expand_lock_;
     InitialLayoutStates initial_layout_states_;
 };
 }  // namespace image_layout_map
@@ -20,6 +20,9 @@
 #include "state_tracker/image_state.h"
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/descriptor_sets.h"
+#include "utils/hash_util.h"
+#include <algorithm>
+#include <atomic>
 #include <limits>
 #include <string_view>
 
@@ -169,13 +172,123 @@ static bool GetMetalExport(const VkImageCreateInfo *info, VkExportMetalObjectTyp
 }
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
+// The pNext structures that are compared when sharing image create infos, the images chaining any other structure get their
+// own copy
+static bool IsShareableImageChain(const void *pNext) {
+    for (auto *chain = static_cast<const VkBaseInStructure *>(pNext); chain; chain = chain->pNext) {
+        switch (chain->sType) {
+            case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+            case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO:
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+namespace {
+struct ImageCreateInfoHash {
+    size_t operator()(const safe_VkImageCreateInfo &value) const {
+        const VkImageCreateInfo &ci = *value.ptr();
+        hash_util::HashCombiner hc;
+        hc << ci.flags << ci.imageType << ci.format << ci.extent.width << ci.extent.height << ci.extent.depth << ci.mipLevels
+           << ci.arrayLayers << ci.samples << ci.tiling << ci.usage << ci.sharingMode << ci.queueFamilyIndexCount
+           << ci.initialLayout;
+        if (ci.sharingMode == VK_SHARING_MODE_CONCURRENT && ci.pQueueFamilyIndices) {
+            hc.Combine(ci.pQueueFamilyIndices, ci.pQueueFamilyIndices + ci.queueFamilyIndexCount);
+        }
+        for (auto *chain = static_cast<const VkBaseInStructure *>(ci.pNext); chain; chain = chain->pNext) {
+            hc << chain->sType;
+            if (chain->sType == VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO) {
+                const auto *format_list = reinterpret_cast<const VkImageFormatListCreateInfo *>(chain);
+                hc.Combine(format_list->pViewFormats, format_list->pViewFormats + format_list->viewFormatCount);
+            } else if (chain->sType == VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO) {
+                hc << reinterpret_cast<const VkExternalMemoryImageCreateInfo *>(chain)->handleTypes;
+            } else if (chain->sType == VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO) {
+                hc << reinterpret_cast<const VkImageStencilUsageCreateInfo *>(chain)->stencilUsage;
+            }
+        }
+        return hc.Value();
+    }
+};
+
+struct ImageCreateInfoEqual {
+    bool operator()(const safe_VkImageCreateInfo &lhs_value, const safe_VkImageCreateInfo &rhs_value) const {
+        const VkImageCreateInfo &lhs = *lhs_value.ptr();
+        const VkImageCreateInfo &rhs = *rhs_value.ptr();
+        if (lhs.flags != rhs.flags || lhs.imageType != rhs.imageType || lhs.format != rhs.format ||
+            lhs.extent.width != rhs.extent.width || lhs.extent.height != rhs.extent.height ||
+            lhs.extent.depth != rhs.extent.depth || lhs.mipLevels != rhs.mipLevels || lhs.arrayLayers != rhs.arrayLayers ||
+            lhs.samples != rhs.samples || lhs.tiling != rhs.tiling || lhs.usage != rhs.usage ||
+            lhs.sharingMode != rhs.sharingMode || lhs.queueFamilyIndexCount != rhs.queueFamilyIndexCount ||
+            lhs.initialLayout != rhs.initialLayout) {
+            return false;
+        }
+        if (lhs.sharingMode == VK_SHARING_MODE_CONCURRENT) {
+            const uint32_t *lhs_indices = lhs.pQueueFamilyIndices;
+            if (!hash_util::SimilarForNullity(lhs_indices, rhs.pQueueFamilyIndices) ||
+                (lhs_indices && !std::equal(lhs_indices, lhs_indices + lhs.queueFamilyIndexCount, rhs.pQueueFamilyIndices))) {
+                return false;
+            }
+        }
+        auto *lhs_chain = static_cast<const VkBaseInStructure *>(lhs.pNext);
+        auto *rhs_chain = static_cast<const VkBaseInStructure *>(rhs.pNext);
+        for (; lhs_chain && rhs_chain; lhs_chain = lhs_chain->pNext, rhs_chain = rhs_chain->pNext) {
+            if (lhs_chain->sType != rhs_chain->sType) {
+                return false;
+            }
+            if (lhs_chain->sType == VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO) {
+                const auto *lhs_list = reinterpret_cast<const VkImageFormatListCreateInfo *>(lhs_chain);
+                const auto *rhs_list = reinterpret_cast<const VkImageFormatListCreateInfo *>(rhs_chain);
+                const VkFormat *lhs_formats = lhs_list->pViewFormats;
+                if (lhs_list->viewFormatCount != rhs_list->viewFormatCount ||
+                    !std::equal(lhs_formats, lhs_formats + lhs_list->viewFormatCount, rhs_list->pViewFormats)) {
+                    return false;
+                }
+            } else if (lhs_chain->sType == VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO) {
+                if (reinterpret_cast<const VkExternalMemoryImageCreateInfo *>(lhs_chain)->handleTypes !=
+                    reinterpret_cast<const VkExternalMemoryImageCreateInfo *>(rhs_chain)->handleTypes) {
+                    return false;
+                }
+            } else if (lhs_chain->sType == VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO) {
+                if (reinterpret_cast<const VkImageStencilUsageCreateInfo *>(lhs_chain)->stencilUsage !=
+                    reinterpret_cast<const VkImageStencilUsageCreateInfo *>(rhs_chain)->stencilUsage) {
+                    return false;
+                }
+            }
+        }
+        return !lhs_chain && !rhs_chain;
+    }
+};
+}  // namespace
+
+using ImageCreateInfoDict = hash_util::Dictionary<safe_VkImageCreateInfo, ImageCreateInfoHash, ImageCreateInfoEqual>;
+static ImageCreateInfoDict image_create_info_dict;
+
+// Applications create many images with the same description, such as the textures or render targets of a frame, and each
+// of them used to hold its own deep copy of the create info
+static std::shared_ptr<const safe_VkImageCreateInfo> GetSharedCreateInfo(const VkImageCreateInfo *pCreateInfo) {
+    if (!IsShareableImageChain(pCreateInfo->pNext)) {
+        return std::make_shared<const safe_VkImageCreateInfo>(pCreateInfo);
+    }
+    // Drop the descriptions of the destroyed images every so often
+    constexpr uint32_t kTrimInterval = 4096;
+    static std::atomic<uint32_t> lookup_count{0};
+    if (lookup_count.fetch_add(1, std::memory_order_relaxed) % kTrimInterval == kTrimInterval - 1) {
+        image_create_info_dict.Trim();
+    }
+    return image_create_info_dict.LookUp(pCreateInfo);
+}
+
 namespace vvl {
 
 Image::Image(const ValidationStateTracker *dev_data, VkImage img, const VkImageCreateInfo *pCreateInfo, VkFormatFeatureFlags2KHR ff)
     : Bindable(img, kVulkanObjectTypeImage, (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) != 0,
                (pCreateInfo->flags & VK_IMAGE_CREATE_PROTECTED_BIT) == 0, GetExternalHandleTypes(pCreateInfo)),
-      safe_create_info(pCreateInfo),
-      createInfo(*safe_create_info.ptr()),
+      safe_create_info(GetSharedCreateInfo(pCreateInfo)),
+      createInfo(*safe_create_info->ptr()),
       shared_presentable(false),
       layout_locked(false),
       ahb_format(GetExternalFormat(pCreateInfo->pNext)),
@@ -217,8 +330,8 @@ Image::Image(const ValidationStateTracker *dev_data, VkImage img, const VkImageC
              uint32_t swapchain_index, VkFormatFeatureFlags2KHR ff)
     : Bindable(img, kVulkanObjectTypeImage, (pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) != 0,
                (pCreateInfo->flags & VK_IMAGE_CREATE_PROTECTED_BIT) == 0, GetExternalHandleTypes(pCreateInfo)),
-      safe_create_info(pCreateInfo),
-      createInfo(*safe_create_info.ptr()),
+      safe_create_info(GetSharedCreateInfo(pCreateInfo)),
+      createInfo(*safe_create_info->ptr()),
       shared_presentable(false),
       layout_locked(false),
       ahb_format(GetExternalFormat(pCreateInfo->pNext)),
@@ -251,9 +364,9 @@ Image::Image(const ValidationStateTracker *dev_data, VkImage img, const VkImageC
 }
 
 void Image::Destroy() {
-    // NOTE: due to corner cases in aliased images, the layout_range_map MUST not be cleaned up here.
+    // NOTE: due to corner cases in aliased images, the layout_state MUST not be cleaned up here.
     // If it is, bad local entries could be created by vvl::CommandBuffer::GetImageSubresourceLayoutMap()
-    // If an aliasing image was being destroyed (and layout_range_map was reset()), a nullptr keyed
+    // If an aliasing image was being destroyed (and layout_state was reset()), a nullptr keyed
     // entry could get put into vvl::CommandBuffer::aliased_image_layout_map.
     //
     // NOTE: the fragment_encoder should not be cleaned-up in case a semaphore to an acquired image is being processed
@@ -321,13 +434,13 @@ bool Image::IsCompatibleAliasing(const Image *other_image_state) const {
 }
 
 void Image::SetInitialLayoutMap() {
-    if (layout_range_map) {
+    if (layout_state) {
         return;
     }
 
-    std::shared_ptr<GlobalImageLayoutRangeMap> layout_map;
+    std::shared_ptr<GlobalImageLayoutState> layout_map;
     auto get_layout_map = [&layout_map](const Image &other_image) {
-        layout_map = other_image.layout_range_map;
+        layout_map = other_image.layout_state;
         return true;
     };
 
@@ -343,24 +456,41 @@ void Image::SetInitialLayoutMap() {
     if (!layout_map) {
         // otherwise set up a new map.
         // set up the new map completely before making it available
-        layout_map = std::make_shared<GlobalImageLayoutRangeMap>(subresource_encoder.SubresourceCount());
-        auto range_gen = subresource_adapter::RangeGenerator(subresource_encoder);
-        for (; range_gen->non_empty(); ++range_gen) {
-            layout_map->insert(layout_map->end(), std::make_pair(*range_gen, createInfo.initialLayout));
-        }
+        layout_map = std::make_shared<GlobalImageLayoutState>(subresource_encoder.SubresourceCount());
+        layout_map->Update([this](GlobalImageLayoutRangeMap &map) {
+            auto range_gen = subresource_adapter::RangeGenerator(subresource_encoder);
+            for (; range_gen->non_empty(); ++range_gen) {
+                map.insert(map.end(), std::make_pair(*range_gen, createInfo.initialLayout));
+            }
+            return true;
+        });
     }
     // And store in the object
-    layout_range_map = std::move(layout_map);
+    layout_state = std::move(layout_map);
 }
 
 void Image::SetImageLayout(const VkImageSubresourceRange &range, VkImageLayout layout) {
     using sparse_container::update_range_value;
     using sparse_container::value_precedence;
-    GlobalImageLayoutRangeMap::RangeGenerator range_gen(subresource_encoder, NormalizeSubresourceRange(range));
-    auto guard = layout_range_map->WriteLock();
-    for (; range_gen->non_empty(); ++range_gen) {
-        update_range_value(*layout_range_map, *range_gen, layout, value_precedence::prefer_source);
-    }
+    const auto normalized_range = NormalizeSubresourceRange(range);
+    layout_state->Update(
+        [this, &normalized_range, layout](const GlobalImageLayoutRangeMap &map) {
+            GlobalImageLayoutRangeMap::RangeGenerator range_gen(subresource_encoder, normalized_range);
+            for (; range_gen->non_empty(); ++range_gen) {
+                if (!map.AllInLayout(*range_gen, layout)) {
+                    return true;
+                }
+            }
+            return false;
+        },
+        [this, &normalized_range, layout](GlobalImageLayoutRangeMap &map) {
+            GlobalImageLayoutRangeMap::RangeGenerator range_gen(subresource_encoder, normalized_range);
+            bool updated = false;
+            for (; range_gen->non_empty(); ++range_gen) {
+                updated |= update_range_value(map, *range_gen, layout, value_precedence::prefer_source);
+            }
+            return updated;
+        });
 }
 
 void Image::SetSwapchain(std::shared_ptr<vvl::Swapchain> &swapchain, uint32_t swapchain_index) {
@@ -691,6 +821,10 @@ std::vector<VkPresentModeKHR> Surface::GetPresentModes(VkPhysicalDevice phys_dev
         log_internal_error(err, phys_dev, surface());
         return result;
     }
+    auto &present_modes = present_modes_data_[phys_dev];
+    for (const VkPresentModeKHR present_mode : result) {
+        present_modes[present_mode] = std::nullopt;
+    }
     return result;
 }
 
@@ -707,7 +841,7 @@ vvl::span<const safe_VkSurfaceFormat2KHR> Surface::GetFormats(bool get_surface_c
     assert(phys_dev);
 
     if (const auto search = formats_.find(phys_dev); search != formats_.end()) {
-        vvl::span<const safe_VkSurfaceFormat2KHR>(search->second);
+        return vvl::span<const safe_VkSurfaceFormat2KHR>(search->second);
     }
 
     std::vector<safe_VkSurfaceFormat2KHR> result;
@@ -733,7 +867,7 @@ vvl::span<const safe_VkSurfaceFormat2KHR> Surface::GetFormats(bool get_surface_c
             log_internal_error(err, phys_dev, surface_info2.surface);
             result.clear();
         } else {
-            result.resize(count);
+            result.reserve(count);
             for (uint32_t surface_format_index = 0; surface_format_index < count; ++surface_format_index) {
                 result.emplace_back(safe_VkSurfaceFormat2KHR(&formats2[surface_format_index]));
             }
@@ -783,6 +917,29 @@ safe_VkSurfaceCapabilities2KHR Surface::GetCapabilities(bool get_surface_capabil
                                                         const void *surface_info2_pnext, const Location &loc,
                                                         const ValidationObject *validation_obj) const {
     auto guard = Lock();
+    return CachedCapabilities(get_surface_capabilities2, phys_dev, surface_info2_pnext, loc, validation_obj);
+}
+
+VkSurfaceCapabilitiesKHR Surface::GetSurfaceCapabilities(bool get_surface_capabilities2, VkPhysicalDevice phys_dev,
+                                                         const Location &loc, const ValidationObject *validation_obj) const {
+    auto guard = Lock();
+    return CachedCapabilities(get_surface_capabilities2, phys_dev, nullptr, loc, validation_obj).surfaceCapabilities;
+}
+
+void Surface::InvalidateCapabilities() {
+    auto guard = Lock();
+    capabilities_.clear();
+    formats_.clear();
+    for (auto &[phys_dev, present_modes] : present_modes_data_) {
+        for (auto &[present_mode, present_mode_state] : present_modes) {
+            present_mode_state = std::nullopt;
+        }
+    }
+}
+
+const safe_VkSurfaceCapabilities2KHR &Surface::CachedCapabilities(bool get_surface_capabilities2, VkPhysicalDevice phys_dev,
+                                                                  const void *surface_info2_pnext, const Location &loc,
+                                                                  const ValidationObject *validation_obj) const {
     assert(phys_dev);
 
     if (auto search = capabilities_.find(phys_dev); search != capabilities_.end()) {
@@ -810,9 +967,9 @@ safe_VkSurfaceCapabilities2KHR Surface::GetCapabilities(bool get_surface_capabil
         }
         surface_caps2.surfaceCapabilities = caps;
     }
-    safe_VkSurfaceCapabilities2KHR safe_surface_caps2(&surface_caps2);
-    capabilities_[phys_dev] = safe_surface_caps2;
-    return safe_surface_caps2;
+    auto &cached_caps2 = capabilities_[phys_dev];
+    cached_caps2.initialize(&surface_caps2);
+    return cached_caps2;
 }
 
 void Surface::SetCompatibleModes(VkPhysicalDevice phys_dev, const VkPresentModeKHR present_mode,
@@ -838,12 +995,12 @@ void Surface::SetCompatibleModes(VkPhysicalDevice phys_dev, const VkPresentModeK
 std::vector<VkPresentModeKHR> Surface::GetCompatibleModes(VkPhysicalDevice phys_dev, const VkPresentModeKHR present_mode) const {
     auto guard = Lock();
     assert(phys_dev);
-    auto iter = present_modes_data_.find(phys_dev);
-    if ((iter != present_modes_data_.end()) && (iter->second.find(present_mode) != iter->second.end())) {
-        if (((iter->second)[present_mode]).has_value()) {
-            auto &compatible_modes = *(iter->second)[present_mode];
-            if (compatible_modes->compatible_present_modes_.empty()) {
-                return compatible_modes->compatible_present_modes_;
+    std::optional<std::shared_ptr<PresentModeState>> *cached_state = nullptr;
+    if (auto iter = present_modes_data_.find(phys_dev); iter != present_modes_data_.end()) {
+        if (auto mode_iter = iter->second.find(present_mode); mode_iter != iter->second.end()) {
+            cached_state = &mode_iter->second;
+            if (cached_state->has_value() && !(**cached_state)->compatible_present_modes_.empty()) {
+                return (**cached_state)->compatible_present_modes_;
             }
         }
     }
@@ -862,6 +1019,14 @@ std::vector<VkPresentModeKHR> Surface::GetCompatibleModes(VkPhysicalDevice phys_
     result.resize(present_mode_compatibility.presentModeCount);
     present_mode_compatibility.pPresentModes = result.data();
     DispatchGetPhysicalDeviceSurfaceCapabilities2KHR(phys_dev, &surface_info, &surface_capabilities);
+
+    // Only modes known to be supported are cached, adding one would make GetPresentModes() report it
+    if (cached_state) {
+        if (!cached_state->has_value()) {
+            *cached_state = std::make_shared<PresentModeState>();
+        }
+        (**cached_state)->compatible_present_modes_ = result;
+    }
     return result;
 }
 
@@ -877,57 +1042,98 @@ void Surface::SetPresentModeCapabilities(VkPhysicalDevice phys_dev, const VkPres
     auto &present_mode_state = present_modes_data_[phys_dev][present_mode].value();
     present_mode_state->scaling_capabilities_ = scaling_caps;
     present_mode_state->surface_capabilities_ = caps;
+    present_mode_state->has_capabilities_ = true;
 }
 
-// Get the surface caps this particular present mode
-VkSurfaceCapabilitiesKHR Surface::GetPresentModeSurfaceCapabilities(VkPhysicalDevice phys_dev,
-                                                                    const VkPresentModeKHR present_mode) const {
-    auto iter = present_modes_data_.find(phys_dev);
-    if ((iter != present_modes_data_.end()) && (iter->second.find(present_mode) != iter->second.end())) {
-        auto const caps = (iter->second)[present_mode];
-        if (caps.has_value()) {
-            auto &surface_caps = *caps;
-            return surface_caps->surface_capabilities_;
+std::pair<VkSurfaceCapabilitiesKHR, VkSurfacePresentScalingCapabilitiesEXT> Surface::CachedPresentModeCapabilities(
+    VkPhysicalDevice phys_dev, VkPresentModeKHR present_mode) const {
+    std::optional<std::shared_ptr<PresentModeState>> *cached_state = nullptr;
+    if (auto iter = present_modes_data_.find(phys_dev); iter != present_modes_data_.end()) {
+        if (auto mode_iter = iter->second.find(present_mode); mode_iter != iter->second.end()) {
+            cached_state = &mode_iter->second;
+            if (cached_state->has_value() && (**cached_state)->has_capabilities_) {
+                return {(**cached_state)->surface_capabilities_, (**cached_state)->scaling_capabilities_};
+            }
         }
     }
 
-    // Present mode surface capabilties not in state tracker, call to get surface capabilities
+    // Present mode capabilities not in state tracker, query both the surface and scaling capabilities at once
     VkPhysicalDeviceSurfaceInfo2KHR surface_info = vku::InitStructHelper();
     surface_info.surface = surface();
     VkSurfacePresentModeEXT surface_present_mode = vku::InitStructHelper();
     surface_present_mode.presentMode = present_mode;
     surface_info.pNext = &surface_present_mode;
+    VkSurfacePresentScalingCapabilitiesEXT scaling_caps = vku::InitStructHelper();
     VkSurfaceCapabilities2KHR surface_capabilities = vku::InitStructHelper();
+    surface_capabilities.pNext = &scaling_caps;
     DispatchGetPhysicalDeviceSurfaceCapabilities2KHR(phys_dev, &surface_info, &surface_capabilities);
-    return surface_capabilities.surfaceCapabilities;
+    surface_capabilities.pNext = nullptr;
+    scaling_caps.pNext = nullptr;
+
+    // Only modes known to be supported are cached, adding one would make GetPresentModes() report it.
+    // A state shared with the compatible modes is replaced by one of this mode only, the capabilities differ between them.
+    if (cached_state) {
+        auto present_mode_state = std::make_shared<PresentModeState>();
+        if (cached_state->has_value()) {
+            present_mode_state->compatible_present_modes_ = (**cached_state)->compatible_present_modes_;
+        }
+        present_mode_state->surface_capabilities_ = surface_capabilities.surfaceCapabilities;
+        present_mode_state->scaling_capabilities_ = scaling_caps;
+        present_mode_state->has_capabilities_ = true;
+        *cached_state = std::move(present_mode_state);
+    }
+    return {surface_capabilities.surfaceCapabilities, scaling_caps};
+}
+
+// Get the surface caps this particular present mode
+VkSurfaceCapabilitiesKHR Surface::GetPresentModeSurfaceCapabilities(VkPhysicalDevice phys_dev,
+                                                                    const VkPresentModeKHR present_mode) const {
+    auto guard = Lock();
+    assert(phys_dev);
+    return CachedPresentModeCapabilities(phys_dev, present_mode).first;
 }
 
 // Get the scaling capabilities for this particular present mode
 VkSurfacePresentScalingCapabilitiesEXT Surface::GetPresentModeScalingCapabilities(VkPhysicalDevice phys_dev,
                                                                                   const VkPresentModeKHR present_mode) const {
-    auto iter = present_modes_data_.find(phys_dev);
-    if ((iter != present_modes_data_.end()) && (iter->second.find(present_mode) != iter->second.end())) {
-        auto const &caps = (iter->second)[present_mode];
-        if (caps.has_value()) {
-            auto &scaling_caps = *caps;
-            return scaling_caps->scaling_capabilities_;
-        }
+    auto guard = Lock();
+    assert(phys_dev);
+    return CachedPresentModeCapabilities(phys_dev, present_mode).second;
+}
+
+}  // namespace vvl
+
+std::shared_ptr<GlobalImageLayoutState::Version> GlobalImageLayoutState::CopyCurrent() const {
+    // The range maps can't be copied as a whole, rebuild it entry by entry
+    auto copy = std::make_shared<Version>(index_);
+    for (const auto &entry : current_->map) {
+        copy->map.insert(copy->map.end(), entry);
     }
+    copy->generation = current_->generation;
+    return copy;
+}
 
-    // Present mode scaling capabilties not in state tracker, call to get scaling capabilities
-    VkPhysicalDeviceSurfaceInfo2KHR surface_info = vku::InitStructHelper();
-    surface_info.surface = surface();
-    VkSurfacePresentModeEXT surface_present_mode = vku::InitStructHelper();
-    surface_present_mode.presentMode = present_mode;
-    surface_info.pNext = &surface_present_mode;
-    VkSurfacePresentScalingCapabilitiesEXT scaling_caps = vku::InitStructHelper();
-    VkSurfaceCapabilities2KHR surface_capabilities = vku::InitStructHelper();
-    surface_capabilities.pNext = &scaling_caps;
-    DispatchGetPhysicalDeviceSurfaceCapabilities2KHR(phys_dev, &surface_info, &surface_capabilities);
-    return scaling_caps;
+uint64_t GlobalImageLayoutState::NextGeneration() {
+    static std::atomic<uint64_t> generation{0};
+    return ++generation;
 }
 
-}  // namespace vvl
+bool GlobalImageLayoutRangeMap::AllInLayout(const key_type &range, VkImageLayout layout) const {
+    auto covered = range.begin;
+    for (auto pos = lower_bound(range); (pos != end()) && (pos->first.begin < range.end); ++pos) {
+        if (pos->first.begin > covered || pos->second != layout) {
+            return false;
+        }
+        covered = pos->first.end;
+    }
+    return covered >= range.end;
+}
+
+bool GlobalImageLayoutRangeMap::ChangedBy(const image_layout_map::ImageSubresourceLayoutMap &layouts) const {
+    return layouts.AnyLayout([this](const auto &range, const auto &entry) {
+        return entry.current_layout != image_layout_map::kInvalidLayout && !AllInLayout(range, entry.current_layout);
+    });
+}
 
 bool GlobalImageLayoutRangeMap::AnyInRange(RangeGenerator &gen,
                                            std::function<bool(const key_type &range, const mapped_type &state)> &&func) const {
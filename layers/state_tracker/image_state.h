@@ -19,6 +19,8 @@
  */
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <utility>
 #include <variant>
 
@@ -67,19 +69,75 @@ static inline VkImageSubresourceRange RangeFromLayers(const VkImageSubresourceLa
     return subresource_range;
 }
 
-class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkImageLayout, 16> {
+class GlobalImageLayoutRangeMap
+    : public subresource_adapter::BothRangeMap<VkImageLayout, 16,
+                                               sparse_container::flat_range_map<subresource_adapter::IndexType, VkImageLayout>> {
   public:
     using RangeGenerator = image_layout_map::RangeGenerator;
     using RangeType = key_type;
 
-    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index) {}
-    ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
-    WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
+    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap(index) {}
 
     bool AnyInRange(RangeGenerator &gen, std::function<bool(const key_type &range, const mapped_type &state)> &&func) const;
+    // True if every subresource of range is in layout
+    bool AllInLayout(const key_type &range, VkImageLayout layout) const;
+    // True if setting the current layouts of layouts (where they have one) would change the map
+    bool ChangedBy(const image_layout_map::ImageSubresourceLayoutMap &layouts) const;
+};
+
+// The layouts of an image, as seen by the submits of every queue. Aliasing images share it.
+// Copy on write, so the submits validating against the layouts never wait for the one changing them: readers take a snapshot
+// of the current version, a writer changes a copy and publishes it as the next version. Writers still go one at a time.
+class GlobalImageLayoutState {
+  public:
+    struct Version {
+        explicit Version(GlobalImageLayoutRangeMap::index_type index) : map(index) {}
+        GlobalImageLayoutRangeMap map;
+        // Taken from a counter shared by all the images, so a value is never seen twice even across images
+        uint64_t generation = 0;
+    };
+    using Snapshot = std::shared_ptr<const Version>;
+
+    explicit GlobalImageLayoutState(GlobalImageLayoutRangeMap::index_type index)
+        : index_(index), current_(std::make_shared<Version>(index)) {}
+
+    Snapshot Current() const { return std::atomic_load(&current_); }
+
+    // update gets a copy of the current map and returns if it changed it. Only then is the copy published.
+    // Returns the version current once done.
+    template <typename Func>
+    Snapshot Update(Func &&update) {
+        return Update([](const GlobalImageLayoutRangeMap &) { return true; }, std::forward<Func>(update));
+    }
+    // Same, but changes first tells from the current map whether update would change it, so that a no-op update doesn't
+    // copy the map. Sets previous_generation to the generation of the version current before the update.
+    template <typename Changes, typename Func>
+    Snapshot Update(Changes &&changes, Func &&update, uint64_t *previous_generation = nullptr) {
+        std::lock_guard<std::mutex> guard(write_lock_);
+        if (previous_generation) {
+            *previous_generation = current_->generation;
+        }
+        if (!changes(current_->map)) {
+            return current_;
+        }
+        auto next = CopyCurrent();
+        if (!update(next->map)) {
+            return current_;
+        }
+        next->generation = NextGeneration();
+        Snapshot published(std::move(next));
+        std::atomic_store(&current_, published);
+        return published;
+    }
 
   private:
-    mutable std::shared_mutex lock_;
+    std::shared_ptr<Version> CopyCurrent() const;
+    static uint64_t NextGeneration();
+
+    const GlobalImageLayoutRangeMap::index_type index_;
+    // Only written under write_lock_, which is why Update() can read it directly
+    Snapshot current_;
+    std::mutex write_lock_;
 };
 
 namespace vvl {
@@ -104,7 +162,8 @@ namespace vvl {
 //
 class Image : public Bindable {
   public:
-    const safe_VkImageCreateInfo safe_create_info;
+    // Shared by the images created with the same description, see GetSharedCreateInfo()
+    const std::shared_ptr<const safe_VkImageCreateInfo> safe_create_info;
     const VkImageCreateInfo &createInfo;
     bool shared_presentable;                   // True for a front-buffered swapchain image
     bool layout_locked;                        // A front-buffered image that has been presented can never have layout transitioned
@@ -139,7 +198,7 @@ class Image : public Bindable {
     std::unique_ptr<const subresource_adapter::ImageRangeEncoder> fragment_encoder;  // Fragment resolution encoder
     const VkDevice store_device_as_workaround;                                       // TODO REMOVE WHEN encoder can be const
 
-    std::shared_ptr<GlobalImageLayoutRangeMap> layout_range_map;
+    std::shared_ptr<GlobalImageLayoutState> layout_state;
 
     vvl::unordered_set<std::shared_ptr<const vvl::VideoProfileDesc>> supported_video_profiles;
 
@@ -255,14 +314,20 @@ class Image : public Bindable {
 
     template <typename UnaryPredicate>
     bool AnyImageAliasOf(const UnaryPredicate &pred) const {
-        // Look for another aliasing image and
-        // ObjectBindings() is thread safe since returns by value, and once
-        // the weak_ptr is successfully locked, the other image state won't
-        // be freed out from under us.
-        for (auto const &memory_state : GetBoundMemoryStates()) {
-            if (AnyAliasBindingOf(memory_state->ObjectBindings(), pred)) return true;
+        // Only an image bound at the same offset of the same memory can alias, so rather than every object bound to the memory
+        // only the ones over that offset are looked at. AnyBoundInRange() holds a reference to each of them while pred runs.
+        const auto *binding = Binding();
+        if (!binding) {
+            return false;
         }
-        return false;
+        return binding->memory_state->AnyBoundInRange(
+            binding->memory_offset, binding->memory_offset + 1, [this, &pred](StateObject &resource) {
+                if (resource.Handle().type != kVulkanObjectTypeImage) {
+                    return false;
+                }
+                auto &other_image = static_cast<Image &>(resource);
+                return (&other_image != this) && other_image.IsCompatibleAliasing(this) && pred(other_image);
+            });
     }
 
   private:
@@ -401,6 +466,8 @@ struct PresentModeState {
     VkSurfaceCapabilitiesKHR surface_capabilities_;
     VkSurfacePresentScalingCapabilitiesEXT scaling_capabilities_;
     std::vector<VkPresentModeKHR> compatible_present_modes_;
+    // False for a state only created to hold the compatible modes
+    bool has_capabilities_ = false;
 };
 
 namespace vvl {
@@ -445,6 +512,12 @@ class Surface : public StateObject {
     safe_VkSurfaceCapabilities2KHR GetCapabilities(bool get_surface_capabilities2, VkPhysicalDevice phys_dev,
                                                    const void *surface_info2_pnext, const Location &loc,
                                                    const ValidationObject *validation_obj) const;
+    // Same as GetCapabilities, without copying the pNext chain of the cached capabilities
+    VkSurfaceCapabilitiesKHR GetSurfaceCapabilities(bool get_surface_capabilities2, VkPhysicalDevice phys_dev, const Location &loc,
+                                                    const ValidationObject *validation_obj) const;
+    // The queries are cached until the presentation engine reports the surface changed (VK_ERROR_OUT_OF_DATE_KHR) or its
+    // swapchain is recreated. The queue support and the list of present modes don't change, and are kept.
+    void InvalidateCapabilities();
 
     void SetCompatibleModes(VkPhysicalDevice phys_dev, const VkPresentModeKHR present_mode,
                             vvl::span<const VkPresentModeKHR> compatible_modes);
@@ -460,6 +533,13 @@ class Surface : public StateObject {
 
   private:
     std::unique_lock<std::mutex> Lock() const { return std::unique_lock<std::mutex>(lock_); }
+    // The functions below expect lock_ to be held
+    const safe_VkSurfaceCapabilities2KHR &CachedCapabilities(bool get_surface_capabilities2, VkPhysicalDevice phys_dev,
+                                                             const void *surface_info2_pnext, const Location &loc,
+                                                             const ValidationObject *validation_obj) const;
+    std::pair<VkSurfaceCapabilitiesKHR, VkSurfacePresentScalingCapabilitiesEXT> CachedPresentModeCapabilities(
+        VkPhysicalDevice phys_dev, VkPresentModeKHR present_mode) const;
+
     mutable std::mutex lock_;
     mutable vvl::unordered_map<GpuQueue, bool> gpu_queue_support_;
     mutable vvl::unordered_map<VkPhysicalDevice, std::vector<safe_VkSurfaceFormat2KHR>> formats_;
@@ -59,7 +59,8 @@ StageStateVec Pipeline::GetStageStates(const ValidationStateTracker &state_data,
                     const uint32_t unique_shader_id = (csm_states) ? (*csm_states)[stage].unique_shader_id : 0;
                     if (shader_ci) {
                         // don't need to worry about GroupDecoration in GPL
-                        auto spirv_module = std::make_shared<spirv::Module>(shader_ci->codeSize, shader_ci->pCode);
+                        auto spirv_module =
+                            spirv::Module::Create(shader_ci->codeSize, shader_ci->pCode, state_data.spirv_parsed_cache_);
                         module_state = std::make_shared<vvl::ShaderModule>(VK_NULL_HANDLE, spirv_module, unique_shader_id);
                     } else {
                         // VK_EXT_shader_module_identifier could legally provide a null module handle
@@ -444,8 +445,8 @@ static VkPipelineCreateFlags2KHR GetPipelineCreateFlags(const void *pNext, VkPip
 }
 
 // static
-std::shared_ptr<VertexInputState> Pipeline::CreateVertexInputState(const Pipeline &p, const ValidationStateTracker &state,
-                                                                   const safe_VkGraphicsPipelineCreateInfo &create_info) {
+std::shared_ptr<const VertexInputState> Pipeline::CreateVertexInputState(const Pipeline &p, const ValidationStateTracker &state,
+                                                                         const safe_VkGraphicsPipelineCreateInfo &create_info) {
     const auto lib_type = GetGraphicsLibType(create_info);
     if (lib_type & VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT) {  // Vertex input graphics library
         return std::make_shared<VertexInputState>(p, create_info);
@@ -467,9 +468,9 @@ std::shared_ptr<VertexInputState> Pipeline::CreateVertexInputState(const Pipelin
 }
 
 // static
-std::shared_ptr<PreRasterState> Pipeline::CreatePreRasterState(const Pipeline &p, const ValidationStateTracker &state,
-                                                               const safe_VkGraphicsPipelineCreateInfo &create_info,
-                                                               const std::shared_ptr<const vvl::RenderPass> &rp) {
+std::shared_ptr<const PreRasterState> Pipeline::CreatePreRasterState(const Pipeline &p, const ValidationStateTracker &state,
+                                                                     const safe_VkGraphicsPipelineCreateInfo &create_info,
+                                                                     const std::shared_ptr<const vvl::RenderPass> &rp) {
     const auto lib_type = GetGraphicsLibType(create_info);
     if (lib_type & VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT) {  // Pre-raster graphics library
         return std::make_shared<PreRasterState>(p, state, create_info, rp);
@@ -491,10 +492,9 @@ std::shared_ptr<PreRasterState> Pipeline::CreatePreRasterState(const Pipeline &p
 }
 
 // static
-std::shared_ptr<FragmentShaderState> Pipeline::CreateFragmentShaderState(const Pipeline &p, const ValidationStateTracker &state,
-                                                                         const VkGraphicsPipelineCreateInfo &create_info,
-                                                                         const safe_VkGraphicsPipelineCreateInfo &safe_create_info,
-                                                                         const std::shared_ptr<const vvl::RenderPass> &rp) {
+std::shared_ptr<const FragmentShaderState> Pipeline::CreateFragmentShaderState(
+    const Pipeline &p, const ValidationStateTracker &state, const VkGraphicsPipelineCreateInfo &create_info,
+    const safe_VkGraphicsPipelineCreateInfo &safe_create_info, const std::shared_ptr<const vvl::RenderPass> &rp) {
     const auto lib_type = GetGraphicsLibType(create_info);
 
     if (lib_type & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT) {  // Fragment shader graphics library
@@ -523,10 +523,9 @@ std::shared_ptr<FragmentShaderState> Pipeline::CreateFragmentShaderState(const P
 // static
 // Pointers that should be ignored have been set to null in safe_create_info, but if this is a graphics library we need the "raw"
 // create_info.
-std::shared_ptr<FragmentOutputState> Pipeline::CreateFragmentOutputState(const Pipeline &p, const ValidationStateTracker &state,
-                                                                         const VkGraphicsPipelineCreateInfo &create_info,
-                                                                         const safe_VkGraphicsPipelineCreateInfo &safe_create_info,
-                                                                         const std::shared_ptr<const vvl::RenderPass> &rp) {
+std::shared_ptr<const FragmentOutputState> Pipeline::CreateFragmentOutputState(
+    const Pipeline &p, const ValidationStateTracker &state, const VkGraphicsPipelineCreateInfo &create_info,
+    const safe_VkGraphicsPipelineCreateInfo &safe_create_info, const std::shared_ptr<const vvl::RenderPass> &rp) {
     // If this pipeline is being created a non-executable (i.e., does not contain complete state) pipeline with FO state, then
     // unconditionally set this pipeline's FO state.
     const auto lib_type = GetGraphicsLibType(create_info);
@@ -637,6 +636,7 @@ Pipeline::Pipeline(const ValidationStateTracker *state_data, const VkGraphicsPip
       fragmentShader_writable_output_location_list(GetFSOutputLocations(stage_states)),
       active_slots(GetActiveSlots(stage_states)),
       max_active_slot(GetMaxActiveSlot(active_slots)),
+      active_slot_requirements(GetActiveSlotRequirements(active_slots)),
       dynamic_state(GetGraphicsDynamicState(*this)),
       topology_at_rasterizer(GetTopologyAtRasterizer(*this)),
       descriptor_buffer_mode((create_info.graphics.flags & VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
@@ -644,18 +644,12 @@ Pipeline::Pipeline(const ValidationStateTracker *state_data, const VkGraphicsPip
       ignore_color_attachments(IgnoreColorAttachments(state_data, *this)),
       csm_states(csm_states) {
     if (library_create_info) {
-        const auto &exe_layout_state = state_data->Get<vvl::PipelineLayout>(create_info.graphics.layout);
-        const auto *exe_layout = exe_layout_state.get();
-        const auto *pre_raster_layout =
-            (pre_raster_state && pre_raster_state->pipeline_layout) ? pre_raster_state->pipeline_layout.get() : nullptr;
-        const auto *fragment_shader_layout = (fragment_shader_state && fragment_shader_state->pipeline_layout)
-                                                 ? fragment_shader_state->pipeline_layout.get()
-                                                 : nullptr;
-        std::array<decltype(exe_layout), 3> layouts;
-        layouts[0] = exe_layout;
-        layouts[1] = fragment_shader_layout;
-        layouts[2] = pre_raster_layout;
-        merged_graphics_layout = std::make_shared<vvl::PipelineLayout>(layouts);
+        std::array<std::shared_ptr<const vvl::PipelineLayout>, 3> layouts;
+        layouts[0] = state_data->Get<vvl::PipelineLayout>(create_info.graphics.layout);
+        layouts[1] = fragment_shader_state ? fragment_shader_state->pipeline_layout : nullptr;
+        layouts[2] = pre_raster_state ? pre_raster_state->pipeline_layout : nullptr;
+        // Pipelines linked from the same libraries and layout share the merged layout, like they share the sub-states
+        merged_graphics_layout = state_data->GetMergedPipelineLayout(layouts);
 
         // TODO Could store the graphics_lib_type in the sub-state rather than searching for it again here.
         //      Or, could store a pointer back to the owning Pipeline.
@@ -681,6 +675,7 @@ Pipeline::Pipeline(const ValidationStateTracker *state_data, const VkComputePipe
       active_shaders(create_info_shaders),  // compute has no linking shaders
       active_slots(GetActiveSlots(stage_states)),
       max_active_slot(GetMaxActiveSlot(active_slots)),
+      active_slot_requirements(GetActiveSlotRequirements(active_slots)),
       dynamic_state(0),  // compute has no dynamic state
       descriptor_buffer_mode((create_info.compute.flags & VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
       uses_pipeline_robustness(UsesPipelineRobustness(PNext(), *this)),
@@ -704,6 +699,7 @@ Pipeline::Pipeline(const ValidationStateTracker *state_data, const VkRayTracingP
       active_shaders(create_info_shaders),  // RTX has no linking shaders
       active_slots(GetActiveSlots(stage_states)),
       max_active_slot(GetMaxActiveSlot(active_slots)),
+      active_slot_requirements(GetActiveSlotRequirements(active_slots)),
       dynamic_state(GetRayTracingDynamicState(*this)),
       descriptor_buffer_mode((create_info.raytracing.flags & VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
       uses_pipeline_robustness(UsesPipelineRobustness(PNext(), *this)),
@@ -729,6 +725,7 @@ Pipeline::Pipeline(const ValidationStateTracker *state_data, const VkRayTracingP
       active_shaders(create_info_shaders),  // RTX has no linking shaders
       active_slots(GetActiveSlots(stage_states)),
       max_active_slot(GetMaxActiveSlot(active_slots)),
+      active_slot_requirements(GetActiveSlotRequirements(active_slots)),
       dynamic_state(GetRayTracingDynamicState(*this)),
       descriptor_buffer_mode((create_info.graphics.flags & VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) != 0),
       uses_pipeline_robustness(UsesPipelineRobustness(PNext(), *this)),
@@ -764,6 +761,8 @@ void LastBound::Reset() {
     }
     push_descriptor_set.reset();
     per_set.clear();
+    action_state_dirty = kActionStateDirtyAll;
+    validated_check_groups.fill(vvl::Func::Empty);
 }
 
 bool LastBound::IsDepthTestEnable() const {
@@ -17,6 +17,7 @@
  * limitations under the License.
  */
 #pragma once
+#include <array>
 #include "utils/hash_vk_types.h"
 #include "state_tracker/state_object.h"
 #include "state_tracker/sampler_state.h"
@@ -26,6 +27,7 @@
 #include "state_tracker/pipeline_layout_state.h"
 #include "state_tracker/pipeline_sub_state.h"
 #include "generated/dynamic_state_helper.h"
+#include "generated/error_location_helper.h"
 #include "utils/shader_utils.h"
 
 // Fwd declarations -- including descriptor_set.h creates an ugly include loop
@@ -142,10 +144,12 @@ class Pipeline : public StateObject {
     const bool uses_shader_module_id;
 
     // State split up based on library types
-    const std::shared_ptr<VertexInputState> vertex_input_state;  // VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT
-    const std::shared_ptr<PreRasterState> pre_raster_state;      // VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT
-    const std::shared_ptr<FragmentShaderState> fragment_shader_state;  // VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT
-    const std::shared_ptr<FragmentOutputState>
+    const std::shared_ptr<const VertexInputState>
+        vertex_input_state;  // VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT
+    const std::shared_ptr<const PreRasterState>
+        pre_raster_state;  // VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT
+    const std::shared_ptr<const FragmentShaderState> fragment_shader_state;  // VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT
+    const std::shared_ptr<const FragmentOutputState>
         fragment_output_state;  // VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT
 
     // Additional metadata needed by pipeline_state initialization and validation
@@ -167,6 +171,7 @@ class Pipeline : public StateObject {
     // are updated at various times. Locking requirements are TBD.
     const ActiveSlotMap active_slots;
     const uint32_t max_active_slot = 0;  // the highest set number in active_slots for pipeline layout compatibility checks
+    const ActiveSlotRequirements active_slot_requirements;
 
     // Which state is dynamic from pipeline creation
     CBDynamicFlags dynamic_state;
@@ -251,7 +256,9 @@ class Pipeline : public StateObject {
 
     // Used to know if the pipeline substate is being created (as opposed to being linked)
     // Important as some pipeline checks need pipeline state that won't be there if the substate is from linking
-    bool OwnsSubState(const std::shared_ptr<PipelineSubState> sub_state) const { return sub_state && (&sub_state->parent == this); }
+    bool OwnsSubState(const std::shared_ptr<const PipelineSubState> sub_state) const {
+        return sub_state && (&sub_state->parent == this);
+    }
 
     const std::shared_ptr<const vvl::RenderPass> RenderPassState() const {
         // TODO A render pass object is required for all of these sub-states. Which one should be used for an "executable pipeline"?
@@ -563,19 +570,17 @@ class Pipeline : public StateObject {
     }
 
   protected:
-    static std::shared_ptr<VertexInputState> CreateVertexInputState(const Pipeline &p, const ValidationStateTracker &state,
-                                                                    const safe_VkGraphicsPipelineCreateInfo &create_info);
-    static std::shared_ptr<PreRasterState> CreatePreRasterState(const Pipeline &p, const ValidationStateTracker &state,
-                                                                const safe_VkGraphicsPipelineCreateInfo &create_info,
-                                                                const std::shared_ptr<const vvl::RenderPass> &rp);
-    static std::shared_ptr<FragmentShaderState> CreateFragmentShaderState(const Pipeline &p, const ValidationStateTracker &state,
-                                                                          const VkGraphicsPipelineCreateInfo &create_info,
-                                                                          const safe_VkGraphicsPipelineCreateInfo &safe_create_info,
-                                                                          const std::shared_ptr<const vvl::RenderPass> &rp);
-    static std::shared_ptr<FragmentOutputState> CreateFragmentOutputState(const Pipeline &p, const ValidationStateTracker &state,
-                                                                          const VkGraphicsPipelineCreateInfo &create_info,
-                                                                          const safe_VkGraphicsPipelineCreateInfo &safe_create_info,
-                                                                          const std::shared_ptr<const vvl::RenderPass> &rp);
+    static std::shared_ptr<const VertexInputState> CreateVertexInputState(const Pipeline &p, const ValidationStateTracker &state,
+                                                                          const safe_VkGraphicsPipelineCreateInfo &create_info);
+    static std::shared_ptr<const PreRasterState> CreatePreRasterState(const Pipeline &p, const ValidationStateTracker &state,
+                                                                      const safe_VkGraphicsPipelineCreateInfo &create_info,
+                                                                      const std::shared_ptr<const vvl::RenderPass> &rp);
+    static std::shared_ptr<const FragmentShaderState> CreateFragmentShaderState(
+        const Pipeline &p, const ValidationStateTracker &state, const VkGraphicsPipelineCreateInfo &create_info,
+        const safe_VkGraphicsPipelineCreateInfo &safe_create_info, const std::shared_ptr<const vvl::RenderPass> &rp);
+    static std::shared_ptr<const FragmentOutputState> CreateFragmentOutputState(
+        const Pipeline &p, const ValidationStateTracker &state, const VkGraphicsPipelineCreateInfo &create_info,
+        const safe_VkGraphicsPipelineCreateInfo &safe_create_info, const std::shared_ptr<const vvl::RenderPass> &rp);
 
     template <typename CreateInfo>
     static bool EnablesRasterizationStates(const CreateInfo &create_info) {
@@ -600,7 +605,7 @@ class Pipeline : public StateObject {
         return true;
     }
 
-    static bool EnablesRasterizationStates(const std::shared_ptr<PreRasterState> pre_raster_state) {
+    static bool EnablesRasterizationStates(const std::shared_ptr<const PreRasterState> pre_raster_state) {
         if (!pre_raster_state) {
             // Assume rasterization is enabled if we don't know for sure that it is disabled
             return true;
@@ -614,7 +619,7 @@ class Pipeline : public StateObject {
 
 template <>
 struct Pipeline::SubStateTraits<VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT> {
-    using type = std::shared_ptr<VertexInputState>;
+    using type = std::shared_ptr<const VertexInputState>;
 };
 
 // static
@@ -626,7 +631,7 @@ Pipeline::GetSubState<VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EX
 
 template <>
 struct Pipeline::SubStateTraits<VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT> {
-    using type = std::shared_ptr<PreRasterState>;
+    using type = std::shared_ptr<const PreRasterState>;
 };
 
 // static
@@ -638,7 +643,7 @@ Pipeline::GetSubState<VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT
 
 template <>
 struct Pipeline::SubStateTraits<VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT> {
-    using type = std::shared_ptr<FragmentShaderState>;
+    using type = std::shared_ptr<const FragmentShaderState>;
 };
 
 // static
@@ -650,7 +655,7 @@ Pipeline::GetSubState<VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT>(cons
 
 template <>
 struct Pipeline::SubStateTraits<VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT> {
-    using type = std::shared_ptr<FragmentOutputState>;
+    using type = std::shared_ptr<const FragmentOutputState>;
 };
 
 // static
@@ -698,6 +703,27 @@ struct Pipeline::CreateInfo::Traits<VkRayTracingPipelineCreateInfoNV> {
 
 }  // namespace vvl
 
+// The bound state the draw-time validation (CoreChecks::ValidateActionState) depends on. The commands known to only change
+// some of it mark just those, any other command marks all of it.
+enum ActionStateDirtyBits : uint32_t {
+    kActionStateDirtyPipeline = 1 << 0,
+    kActionStateDirtyDynamicState = 1 << 1,
+    kActionStateDirtyVertexInput = 1 << 2,  // vertex and index buffers
+    kActionStateDirtyDescriptorSets = 1 << 3,
+    kActionStateDirtyRenderPass = 1 << 4,
+    kActionStateDirtyPushConstants = 1 << 5,
+    kActionStateDirtyAll = (1 << 6) - 1,
+};
+
+// The groups of draw-time checks that are skipped while the state they depend on is not dirty
+enum ActionCheckGroup {
+    kActionCheckDrawtimeState = 0,       // dynamic state and pipeline/shader object draw-time state
+    kActionCheckProtectedAttachments,    // protected memory of the render pass attachments
+    kActionCheckDescriptors,             // layout compatibility and contents of the bound descriptor sets
+    kActionCheckPushConstants,
+    kActionCheckGroupCount,
+};
+
 // Track last states that are bound per pipeline bind point (Gfx & Compute)
 struct LastBound {
     LastBound(vvl::CommandBuffer &cb) : cb_state(cb) {}
@@ -728,7 +754,18 @@ struct LastBound {
         const vvl::DescriptorSet *validated_set{nullptr};
         uint64_t validated_set_change_count{~0ULL};
         uint64_t validated_set_image_layout_change_count{~0ULL};
-        BindingVariableMap validated_set_binding_req_map;
+        // The binding requirements (of the pipeline) validated_set was validated for, the bindings it didn't require weren't
+        const BindingVariableMap *validated_set_binding_reqs{nullptr};
+
+        // If set is validated_set for the same binding requirements and only its contents changed since, the change count after
+        // which its updated bindings need to be validated again. Otherwise the whole set does.
+        std::optional<uint64_t> ValidatedChangeCount(const vvl::DescriptorSet *set, const BindingVariableMap &binding_reqs,
+                                                     bool image_layouts_changed) const {
+            if (set != validated_set || &binding_reqs != validated_set_binding_reqs || image_layouts_changed) {
+                return std::nullopt;
+            }
+            return validated_set_change_count;
+        }
 
         void Reset() {
             bound_descriptor_set.reset();
@@ -739,6 +776,14 @@ struct LastBound {
 
     std::vector<PER_SET> per_set;
 
+    // Set by the commands changing the state, cleared by each draw-time validation of this bind point
+    mutable uint32_t action_state_dirty{kActionStateDirtyAll};
+    // Per ActionCheckGroup, the command the group last passed for, Func::Empty if it did not
+    mutable std::array<vvl::Func, kActionCheckGroupCount> validated_check_groups{};
+    // What the descriptor check group saw, the descriptor updates and image layout changes don't go through commands
+    mutable uint64_t validated_descriptor_change_count{0};
+    mutable uint64_t validated_image_layout_change_count{0};
+
     void Reset();
 
     void UnbindAndResetPushDescriptorSet(std::shared_ptr<vvl::DescriptorSet> &&ds);
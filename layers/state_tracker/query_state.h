@@ -18,6 +18,11 @@
  * limitations under the License.
  */
 #pragma once
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include "containers/range_vector.h"
 #include "state_tracker/state_object.h"
 #include "utils/hash_vk_types.h"
 #include "utils/vk_layer_utils.h"
@@ -48,35 +53,33 @@ class QueryPool : public StateObject {
           perf_counter_queue_family_index(perf_queue_family_index),
           supported_video_profile(std::move(supp_video_profile)),
           video_encode_feedback_flags(enabled_video_encode_feedback_flags),
-          query_states_(pCreateInfo->queryCount) {
-        for (uint32_t i = 0; i < pCreateInfo->queryCount; ++i) {
-            auto perf_size = n_perf_pass > 0 ? n_perf_pass : 1;
-            query_states_[i].reserve(perf_size);
-            for (uint32_t p = 0; p < perf_size; p++) {
-                query_states_[i].emplace_back(QUERYSTATE_UNKNOWN);
-            }
-        }
-    }
+          pass_count_(n_perf_pass > 0 ? n_perf_pass : 1),
+          query_states_(size_t(pCreateInfo->queryCount) * pass_count_, QUERYSTATE_UNKNOWN) {}
 
     VkQueryPool pool() const { return handle_.Cast<VkQueryPool>(); }
 
-    void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) {
+    void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) { SetQueryStates(query, 1, perf_pass, state); }
+    // Commands update contiguous ranges of queries, so ranges are set under a single lock
+    void SetQueryStates(uint32_t first_query, uint32_t query_count, uint32_t perf_pass, QueryState state) {
         auto guard = WriteLock();
-        assert(query < query_states_.size());
+        assert(size_t(first_query) + query_count <= createInfo.queryCount);
         assert((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes));
+        auto *states = &query_states_[size_t(first_query) * pass_count_];
         if (state == QUERYSTATE_RESET) {
-            for (auto &state : query_states_[query]) {
-                state = QUERYSTATE_RESET;
-            }
+            // Resets all the passes
+            std::fill_n(states, size_t(query_count) * pass_count_, static_cast<uint8_t>(QUERYSTATE_RESET));
         } else {
-            query_states_[query][perf_pass] = state;
+            for (uint32_t i = 0; i < query_count; ++i) {
+                states[size_t(i) * pass_count_ + perf_pass] = static_cast<uint8_t>(state);
+            }
         }
     }
     QueryState GetQueryState(uint32_t query, uint32_t perf_pass) const {
         auto guard = ReadLock();
         // this method can get called with invalid arguments during validation
-        if (query < query_states_.size() && ((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes))) {
-            return query_states_[query][perf_pass];
+        if (query < createInfo.queryCount &&
+            ((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes))) {
+            return static_cast<QueryState>(query_states_[size_t(query) * pass_count_ + perf_pass]);
         }
         return QUERYSTATE_UNKNOWN;
     }
@@ -96,7 +99,9 @@ class QueryPool : public StateObject {
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
-    std::vector<small_vector<QueryState, 1, uint32_t>> query_states_;
+    const uint32_t pass_count_;
+    // One byte per query and performance pass, the passes of a query next to each other
+    std::vector<uint8_t> query_states_;
     mutable std::shared_mutex lock_;
 };
 }  // namespace vvl
@@ -154,7 +159,48 @@ inline bool operator==(const QueryObject &query1, const QueryObject &query2) {
     return ((query1.pool == query2.pool) && (query1.slot == query2.slot) && (query1.perf_pass == query2.perf_pass));
 }
 
-typedef std::map<QueryObject, QueryState> QueryMap;
+// The query states left by the commands of a command buffer, built by running its queryUpdates.
+// Commands reset, begin and end contiguous ranges of queries, so the states are kept as ranges of each pool and performance
+// pass; setting a range and applying them to the QueryPool cost the number of ranges, not of queries.
+class QueryMap {
+  public:
+    using RangeMap = sparse_container::range_map<uint32_t, QueryState>;
+    using Key = std::pair<VkQueryPool, uint32_t>;  // pool, perf_pass
+
+    void Set(const QueryObject &query_obj, QueryState state) {
+        SetRange(query_obj.pool, query_obj.perf_pass, query_obj.slot, 1, state);
+    }
+    void SetRange(VkQueryPool pool, uint32_t perf_pass, uint32_t first_query, uint32_t query_count, QueryState state) {
+        if (query_count == 0) {
+            return;
+        }
+        ranges_[Key(pool, perf_pass)].overwrite_range(
+            RangeMap::value_type{RangeMap::key_type(first_query, first_query + query_count), state});
+    }
+    // QUERYSTATE_UNKNOWN if no command of the command buffer changed the state of the query
+    QueryState Get(const QueryObject &query_obj) const {
+        auto pool_it = ranges_.find(Key(query_obj.pool, query_obj.perf_pass));
+        if (pool_it == ranges_.end()) {
+            return QUERYSTATE_UNKNOWN;
+        }
+        auto it = pool_it->second.find(query_obj.slot);
+        return it != pool_it->second.end() ? it->second : QUERYSTATE_UNKNOWN;
+    }
+    bool Empty() const { return ranges_.empty(); }
+
+    // func(VkQueryPool pool, uint32_t perf_pass, const RangeMap::key_type &queries, QueryState state)
+    template <typename Func>
+    void ForEachRange(Func &&func) const {
+        for (const auto &[key, range_map] : ranges_) {
+            for (const auto &[queries, state] : range_map) {
+                func(key.first, key.second, queries, state);
+            }
+        }
+    }
+
+  private:
+    std::map<Key, RangeMap> ranges_;
+};
 
 enum QueryResultType {
     QUERYRESULT_UNKNOWN,
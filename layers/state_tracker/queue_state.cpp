@@ -18,6 +18,9 @@
  */
 #include "state_tracker/queue_state.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "state_tracker/state_tracker.h"
+
+#include <algorithm>
 
 void vvl::QueueSubmission::BeginUse() {
     for (auto &wait : wait_semaphores) {
@@ -49,6 +52,22 @@ void vvl::QueueSubmission::EndUse() {
     }
 }
 
+void vvl::QueueSubmission::ReleaseStateObjects() {
+    cbs.clear();
+    wait_semaphores.clear();
+    signal_semaphores.clear();
+    fence.reset();
+}
+
+vvl::Queue::Queue(ValidationStateTracker &dev_data, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
+                  const VkQueueFamilyProperties &queueFamilyProperties)
+    : StateObject(q, kVulkanObjectTypeQueue),
+      queueFamilyIndex(index),
+      flags(flags),
+      queueFamilyProperties(queueFamilyProperties),
+      dev_data_(dev_data),
+      retire_worker_(dev_data.queue_retire_worker.get()) {}
+
 uint64_t vvl::Queue::Submit(vvl::QueueSubmission &&submission) {
     for (auto &cb_state : submission.cbs) {
         auto cb_guard = cb_state->WriteLock();
@@ -80,8 +99,14 @@ uint64_t vvl::Queue::Submit(vvl::QueueSubmission &&submission) {
     }
     {
         auto guard = Lock();
-        submissions_.emplace_back(std::move(submission));
-        if (!thread_) {
+        if (free_submissions_.empty()) {
+            submissions_.emplace_back(std::make_unique<QueueSubmission>(std::move(submission)));
+        } else {
+            submissions_.emplace_back(std::move(free_submissions_.back()));
+            free_submissions_.pop_back();
+            *submissions_.back() = std::move(submission);
+        }
+        if (!thread_ && !retire_worker_) {
             thread_ = std::make_unique<std::thread>(&Queue::ThreadFunc, this);
         }
     }
@@ -93,17 +118,17 @@ std::shared_future<void> vvl::Queue::Wait(uint64_t until_seq) {
     if (until_seq == kU64Max) {
         until_seq = seq_;
     }
-    if (submissions_.empty() || until_seq < submissions_.begin()->seq) {
+    if (submissions_.empty() || until_seq < submissions_.front()->seq) {
         std::promise<void> already_done;
         auto result = already_done.get_future();
         already_done.set_value();
         return result;
     }
-    auto index = until_seq - submissions_.begin()->seq;
+    auto index = until_seq - submissions_.front()->seq;
     assert(index < submissions_.size());
     // Make sure we don't overflow if size_t is 32 bit
     assert(index < std::numeric_limits<size_t>::max());
-    return submissions_[static_cast<size_t>(index)].waiter;
+    return submissions_[static_cast<size_t>(index)]->waiter;
 }
 
 void vvl::Queue::NotifyAndWait(const Location &loc, uint64_t until_seq) {
@@ -127,17 +152,29 @@ uint64_t vvl::Queue::Notify(uint64_t until_seq) {
     if (request_seq_ < until_seq) {
         request_seq_ = until_seq;
     }
-    cond_.notify_one();
+    if (retire_worker_) {
+        // Under the queue lock so that it can't race with Destroy(), the worker never holds its own lock while
+        // taking a queue lock
+        retire_worker_->Schedule(*this);
+    } else {
+        cond_.notify_one();
+    }
     return until_seq;
 }
 
 void vvl::Queue::Destroy() {
     std::unique_ptr<std::thread> dead_thread;
+    QueueRetireWorker *retire_worker = nullptr;
     {
         auto guard = Lock();
         exit_thread_ = true;
         cond_.notify_all();
         dead_thread = std::move(thread_);
+        std::swap(retire_worker, retire_worker_);
+    }
+    // Destroy() is called again by the destructor, possibly after the worker is gone
+    if (retire_worker) {
+        retire_worker->Unschedule(*this);
     }
     if (dead_thread && dead_thread->joinable()) {
         dead_thread->join();
@@ -151,21 +188,19 @@ vvl::QueueSubmission *vvl::Queue::NextSubmission() {
     // Find if the next submission is ready so that the thread function doesn't need to worry
     // about locking.
     auto guard = Lock();
-    while (!exit_thread_ && (submissions_.empty() || request_seq_ < submissions_.front().seq)) {
+    while (!exit_thread_ && (submissions_.empty() || request_seq_ < submissions_.front()->seq)) {
         // The queue thread must wait forever if nothing is happening, until we tell it to exit
         cond_.wait(guard);
     }
     if (!exit_thread_) {
-        result = &submissions_.front();
+        result = submissions_.front().get();
         // NOTE: the submission must remain on the dequeue until we're done processing it so that
         // anyone waiting for it can find the correct waiter
     }
     return result;
 }
 
-void vvl::Queue::ThreadFunc() {
-    QueueSubmission *submission = nullptr;
-
+void vvl::Queue::Retire(QueueSubmission &submission) {
     auto is_query_updated_after = [this](const QueryObject &query_object) {
         auto guard = this->Lock();
         bool first = true;
@@ -175,8 +210,8 @@ void vvl::Queue::ThreadFunc() {
                 first = false;
                 continue;
             }
-            for (const auto &next_cb_state : submission.cbs) {
-                if (query_object.perf_pass != submission.perf_submit_pass) {
+            for (const auto &next_cb_state : submission->cbs) {
+                if (query_object.perf_pass != submission->perf_submit_pass) {
                     continue;
                 }
                 if (next_cb_state->UpdatesQuery(query_object)) {
@@ -187,6 +222,29 @@ void vvl::Queue::ThreadFunc() {
         return false;
     };
 
+    submission.EndUse();
+    for (auto &wait : submission.wait_semaphores) {
+        wait.semaphore->Retire(this, submission.loc.Get(), wait.payload);
+    }
+    for (auto &cb_state : submission.cbs) {
+        auto cb_guard = cb_state->WriteLock();
+        for (auto *secondary_cmd_buffer : cb_state->linkedCommandBuffers) {
+            auto secondary_guard = secondary_cmd_buffer->WriteLock();
+            secondary_cmd_buffer->Retire(submission.perf_submit_pass, is_query_updated_after);
+        }
+        cb_state->Retire(submission.perf_submit_pass, is_query_updated_after);
+    }
+    for (auto &signal : submission.signal_semaphores) {
+        signal.semaphore->Retire(this, submission.loc.Get(), signal.payload);
+    }
+    if (submission.fence) {
+        submission.fence->Retire();
+    }
+}
+
+void vvl::Queue::ThreadFunc() {
+    QueueSubmission *submission = nullptr;
+
     // Roll this queue forward, one submission at a time.
     while (true) {
         submission = NextSubmission();
@@ -194,34 +252,91 @@ void vvl::Queue::ThreadFunc() {
             break;
         }
 
-        submission->EndUse();
-        for (auto &wait : submission->wait_semaphores) {
-            wait.semaphore->Retire(this, submission->loc.Get(), wait.payload);
-        }
-        for (auto &cb_state : submission->cbs) {
-            auto cb_guard = cb_state->WriteLock();
-            for (auto *secondary_cmd_buffer : cb_state->linkedCommandBuffers) {
-                auto secondary_guard = secondary_cmd_buffer->WriteLock();
-                secondary_cmd_buffer->Retire(submission->perf_submit_pass, is_query_updated_after);
+        RetireFront(*submission);
+    }
+}
+
+void vvl::Queue::RetireFront(QueueSubmission &submission) {
+    Retire(submission);
+    // Only the queue thread looks at the contents of the submission, the others only at its seq and waiter
+    submission.ReleaseStateObjects();
+    // wake up anyone waiting for this submission to be retired
+    std::promise<void> completed;
+    {
+        auto guard = Lock();
+        completed = std::move(submission.completed);
+        free_submissions_.emplace_back(std::move(submissions_.front()));
+        submissions_.pop_front();
+    }
+    completed.set_value();
+}
+
+void vvl::Queue::RetireNotified() {
+    while (true) {
+        QueueSubmission *submission = nullptr;
+        {
+            auto guard = Lock();
+            if (exit_thread_ || submissions_.empty() || request_seq_ < submissions_.front()->seq) {
+                return;
             }
-            cb_state->Retire(submission->perf_submit_pass, is_query_updated_after);
+            submission = submissions_.front().get();
         }
-        for (auto &signal : submission->signal_semaphores) {
-            signal.semaphore->Retire(this, submission->loc.Get(), signal.payload);
-        }
-        if (submission->fence) {
-            submission->fence->Retire();
-        }
-        // wake up anyone waiting for this submission to be retired
-        {
-            std::promise<void> completed;
-            {
-                auto guard = Lock();
-                completed = std::move(submission->completed);
-                submissions_.pop_front();
+        // A queue thread would block in Semaphore::Retire() until the signal is retired by another queue, which the
+        // worker can't do while it is blocked. Leave this queue for now, retiring the signal notifies it again.
+        for (auto &wait : submission->wait_semaphores) {
+            if (!wait.semaphore->CanRetireWithoutWaiting(this, wait.payload)) {
+                wait.semaphore->Notify(wait.payload);
+                return;
             }
-            completed.set_value();
         }
+        RetireFront(*submission);
+    }
+}
+
+vvl::QueueRetireWorker::QueueRetireWorker() : thread_(&QueueRetireWorker::ThreadFunc, this) {}
+
+vvl::QueueRetireWorker::~QueueRetireWorker() {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        exit_thread_ = true;
+        cond_.notify_all();
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void vvl::QueueRetireWorker::Schedule(Queue &queue) {
+    std::unique_lock<std::mutex> guard(lock_);
+    // Notifications for a queue that is already scheduled are folded into the pending one. The one being retired
+    // right now is rescheduled, it may have stopped short of the new notification.
+    if (std::find(scheduled_.begin(), scheduled_.end(), &queue) == scheduled_.end()) {
+        scheduled_.emplace_back(&queue);
+        cond_.notify_one();
+    }
+}
+
+void vvl::QueueRetireWorker::Unschedule(Queue &queue) {
+    std::unique_lock<std::mutex> guard(lock_);
+    scheduled_.erase(std::remove(scheduled_.begin(), scheduled_.end(), &queue), scheduled_.end());
+    idle_cond_.wait(guard, [this, &queue] { return current_ != &queue; });
+}
+
+void vvl::QueueRetireWorker::ThreadFunc() {
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        cond_.wait(guard, [this] { return exit_thread_ || !scheduled_.empty(); });
+        if (exit_thread_) {
+            break;
+        }
+        Queue *queue = scheduled_.front();
+        scheduled_.erase(scheduled_.begin());
+        current_ = queue;
+        guard.unlock();
+        queue->RetireNotified();
+        guard.lock();
+        current_ = nullptr;
+        idle_cond_.notify_all();
     }
 }
 
@@ -26,6 +26,7 @@
 #include <thread>
 #include <vector>
 #include "error_message/error_location.h"
+#include "containers/custom_containers.h"
 
 class ValidationStateTracker;
 
@@ -42,9 +43,10 @@ struct QueueSubmission {
     };
     QueueSubmission(const Location &loc_) : loc(loc_), completed(), waiter(completed.get_future()) {}
 
-    std::vector<std::shared_ptr<vvl::CommandBuffer>> cbs;
-    std::vector<SemaphoreInfo> wait_semaphores;
-    std::vector<SemaphoreInfo> signal_semaphores;
+    // Most submits have at most one command buffer and one semaphore of each kind, keep those inline
+    small_vector<std::shared_ptr<vvl::CommandBuffer>, 1, uint32_t> cbs;
+    small_vector<SemaphoreInfo, 1, uint32_t> wait_semaphores;
+    small_vector<SemaphoreInfo, 1, uint32_t> signal_semaphores;
     std::shared_ptr<Fence> fence;
     LocationCapture loc;
     uint64_t seq{0};
@@ -66,6 +68,8 @@ struct QueueSubmission {
 
     void EndUse();
     void BeginUse();
+    // Once retired, so that the state objects don't stay alive until the submission is reused
+    void ReleaseStateObjects();
 };
 
 // This timeout is for all queue threads to update their state after we know
@@ -75,15 +79,36 @@ static inline std::chrono::time_point<std::chrono::steady_clock> GetCondWaitTime
     return std::chrono::steady_clock::now() + std::chrono::seconds(10);
 }
 
+// With shared_queue_retirement, a single thread retires the submissions of all the queues of the device instead of
+// each queue having its own thread. A queue is scheduled once no matter how many times it is notified before the
+// worker gets to it.
+class QueueRetireWorker {
+  public:
+    QueueRetireWorker();
+    ~QueueRetireWorker();
+
+    void Schedule(Queue &queue);
+    // Returns once the worker is done with the queue and won't touch it anymore
+    void Unschedule(Queue &queue);
+
+  private:
+    void ThreadFunc();
+
+    std::mutex lock_;
+    // condition to wake up the worker
+    std::condition_variable cond_;
+    // condition to wake up Unschedule() when the worker is done with current_
+    std::condition_variable idle_cond_;
+    std::vector<Queue *> scheduled_;
+    Queue *current_{nullptr};
+    bool exit_thread_{false};
+    std::thread thread_;
+};
+
 class Queue: public StateObject {
   public:
     Queue(ValidationStateTracker &dev_data, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags,
-                const VkQueueFamilyProperties &queueFamilyProperties)
-        : StateObject(q, kVulkanObjectTypeQueue),
-          queueFamilyIndex(index),
-          flags(flags),
-          queueFamilyProperties(queueFamilyProperties),
-          dev_data_(dev_data) {}
+          const VkQueueFamilyProperties &queueFamilyProperties);
 
     ~Queue() { Destroy(); }
     void Destroy() override;
@@ -114,18 +139,31 @@ class Queue: public StateObject {
     std::vector<std::string> cmdbuf_label_names;
     std::string last_closed_cmdbuf_label;
 
+  protected:
+    // Called on the queue thread once the submission is known to have completed, before any waiter is woken up
+    virtual void Retire(QueueSubmission &submission);
+
   private:
+    friend class QueueRetireWorker;
+
     using LockGuard = std::unique_lock<std::mutex>;
     void ThreadFunc();
     QueueSubmission *NextSubmission();
+    void RetireFront(QueueSubmission &submission);
+    // Called by the QueueRetireWorker, stops at the first submission that would block the worker.
+    void RetireNotified();
     LockGuard Lock() const { return LockGuard(lock_); }
 
     ValidationStateTracker &dev_data_;
+    // null unless shared_queue_retirement is enabled, in which case there is no thread_
+    QueueRetireWorker *retire_worker_;
 
     // state related to submitting to the queue, all data members must
     // be accessed with lock_ held
     std::unique_ptr<std::thread> thread_;
-    std::deque<QueueSubmission> submissions_;
+    // The submissions are pooled, a steady stream of submits reuses the ones retired before instead of allocating
+    std::deque<std::unique_ptr<QueueSubmission>> submissions_;
+    std::vector<std::unique_ptr<QueueSubmission>> free_submissions_;
     std::atomic<uint64_t> seq_{0};
     uint64_t request_seq_{0};
     bool exit_thread_{false};
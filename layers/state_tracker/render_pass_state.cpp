@@ -20,6 +20,7 @@
 #include "state_tracker/render_pass_state.h"
 #include "utils/convert_utils.h"
 #include "state_tracker/image_state.h"
+#include "utils/hash_util.h"
 
 static const VkImageLayout kInvalidLayout = VK_IMAGE_LAYOUT_MAX_ENUM;
 
@@ -269,6 +270,68 @@ static void InitRenderPassState(vvl::RenderPass *render_pass) {
 
 namespace vvl {
 
+// Follows what CoreChecks::ValidateRenderPassCompatibility compares. Attachments are described by what is compared of them, not by
+// their index, and the counts go in so that the sequences can't be confused with each other.
+uint64_t RenderPass::ComputeCompatibilityHash(const safe_VkRenderPassCreateInfo2 &create_info) {
+    std::vector<uint64_t> words;
+    auto add_attachment = [&create_info, &words](uint32_t attachment) {
+        if (attachment >= create_info.attachmentCount) {
+            words.push_back(VK_ATTACHMENT_UNUSED);
+            return;
+        }
+        const auto &description = create_info.pAttachments[attachment];
+        words.insert(words.end(), {uint64_t(description.format), uint64_t(description.samples), uint64_t(description.flags)});
+    };
+
+    words.insert(words.end(), {create_info.flags, create_info.subpassCount, create_info.dependencyCount});
+    for (uint32_t i = 0; i < create_info.subpassCount; ++i) {
+        const auto &subpass = create_info.pSubpasses[i];
+        words.push_back(subpass.inputAttachmentCount);
+        for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
+            add_attachment(subpass.pInputAttachments[j].attachment);
+        }
+        words.push_back(subpass.colorAttachmentCount);
+        for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
+            add_attachment(subpass.pColorAttachments[j].attachment);
+            add_attachment(subpass.pResolveAttachments ? subpass.pResolveAttachments[j].attachment : VK_ATTACHMENT_UNUSED);
+        }
+        add_attachment(subpass.pDepthStencilAttachment ? subpass.pDepthStencilAttachment->attachment : VK_ATTACHMENT_UNUSED);
+        words.insert(words.end(), {subpass.flags, subpass.viewMask});
+        if (const auto fsr = vku::FindStructInPNextChain<VkFragmentShadingRateAttachmentInfoKHR>(subpass.pNext)) {
+            words.insert(words.end(), {1, fsr->shadingRateAttachmentTexelSize.width, fsr->shadingRateAttachmentTexelSize.height});
+        } else {
+            words.push_back(0);
+        }
+    }
+
+    // The barrier is looked for in the render pass, as the compatibility check does
+    const auto barrier = vku::FindStructInPNextChain<VkMemoryBarrier2KHR>(create_info.pNext);
+    for (uint32_t i = 0; i < create_info.dependencyCount; ++i) {
+        const auto &dependency = create_info.pDependencies[i];
+        words.insert(words.end(), {dependency.srcSubpass, dependency.dstSubpass, dependency.dependencyFlags,
+                                   uint64_t(int64_t(dependency.viewOffset))});
+        if (barrier) {
+            words.insert(words.end(),
+                         {barrier->srcStageMask, barrier->dstStageMask, barrier->srcAccessMask, barrier->dstAccessMask});
+        } else {
+            words.insert(words.end(), {dependency.srcStageMask, dependency.dstStageMask, dependency.srcAccessMask,
+                                       dependency.dstAccessMask});
+        }
+    }
+
+    words.push_back(create_info.correlatedViewMaskCount);
+    words.insert(words.end(), create_info.pCorrelatedViewMasks,
+                 create_info.pCorrelatedViewMasks + create_info.correlatedViewMaskCount);
+
+    if (const auto fdm = vku::FindStructInPNextChain<VkRenderPassFragmentDensityMapCreateInfoEXT>(create_info.pNext)) {
+        words.push_back(1);
+        add_attachment(fdm->fragmentDensityMapAttachment.attachment);
+    } else {
+        words.push_back(0);
+    }
+    return hash_util::Hash64(words.data(), words.size() * sizeof(uint64_t));
+}
+
 RenderPass::RenderPass(VkRenderPass rp, VkRenderPassCreateInfo2 const *pCreateInfo)
     : StateObject(rp, kVulkanObjectTypeRenderPass),
       use_dynamic_rendering(false),
@@ -88,6 +88,8 @@ class RenderPass : public StateObject {
     const safe_VkPipelineRenderingCreateInfo dynamic_rendering_pipeline_create_info;
     const safe_VkCommandBufferInheritanceRenderingInfo inheritance_rendering_info;
     const safe_VkRenderPassCreateInfo2 createInfo;
+    // Covers only what render pass compatibility compares, two render passes with the same hash are compatible
+    const uint64_t compatibility_hash = ComputeCompatibilityHash(createInfo);
     using SubpassVec = std::vector<uint32_t>;
     using SelfDepVec = std::vector<SubpassVec>;
     const std::vector<SubpassVec> self_dependencies;
@@ -121,6 +123,8 @@ class RenderPass : public StateObject {
     uint32_t GetDynamicRenderingViewMask() const;
     uint32_t GetViewMaskBits(uint32_t subpass) const;
     const VkMultisampledRenderToSingleSampledInfoEXT *GetMSRTSSInfo(uint32_t subpass) const;
+
+    static uint64_t ComputeCompatibilityHash(const safe_VkRenderPassCreateInfo2 &create_info);
 };
 
 class Framebuffer : public StateObject {
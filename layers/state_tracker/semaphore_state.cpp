@@ -20,7 +20,64 @@
 #include "state_tracker/queue_state.h"
 #include "state_tracker/state_tracker.h"
 
+#include <algorithm>
+
 using SemOp = vvl::Semaphore::SemOp;
+using TimePoint = vvl::Semaphore::TimePoint;
+
+std::vector<TimePoint>::iterator vvl::Semaphore::Timeline::LowerBound(uint64_t payload) {
+    return std::lower_bound(points_.begin() + begin_, points_.end(), payload,
+                            [](const TimePoint &timepoint, uint64_t value) { return timepoint.payload < value; });
+}
+
+TimePoint *vvl::Semaphore::Timeline::Find(uint64_t payload) {
+    auto pos = LowerBound(payload);
+    return (pos != points_.end() && pos->payload == payload) ? &*pos : nullptr;
+}
+
+const TimePoint *vvl::Semaphore::Timeline::Find(uint64_t payload) const {
+    return const_cast<Timeline *>(this)->Find(payload);
+}
+
+std::pair<TimePoint *, bool> vvl::Semaphore::Timeline::Emplace(const SemOp &op) {
+    // The usual case, a payload higher than all the pending ones
+    if (empty() || points_.back().payload < op.payload) {
+        points_.emplace_back(op);
+        return {&points_.back(), true};
+    }
+    auto pos = LowerBound(op.payload);
+    if (pos != points_.end() && pos->payload == op.payload) {
+        return {&*pos, false};
+    }
+    pos = points_.emplace(pos, op);
+    return {&*pos, true};
+}
+
+void vvl::Semaphore::Timeline::PopFront() {
+    assert(!empty());
+    ++begin_;
+    if (begin_ == points_.size()) {
+        points_.clear();
+        begin_ = 0;
+    } else if (begin_ >= kMinRetiredToDrop && begin_ * 2 >= points_.size()) {
+        points_.erase(points_.begin(), points_.begin() + begin_);
+        begin_ = 0;
+    }
+}
+
+std::shared_future<void> TimePoint::GetWaiter() {
+    if (!completed) {
+        completed.emplace();
+        waiter = completed->get_future();
+    }
+    return waiter;
+}
+
+void TimePoint::Complete() {
+    if (completed) {
+        completed->set_value();
+    }
+}
 
 void vvl::Semaphore::EnqueueSignal(vvl::Queue *queue, uint64_t queue_seq, uint64_t &payload) {
     auto guard = WriteLock();
@@ -28,10 +85,10 @@ void vvl::Semaphore::EnqueueSignal(vvl::Queue *queue, uint64_t queue_seq, uint64
         payload = next_payload_++;
     }
     SemOp sig_op(kSignal, queue, queue_seq, payload);
-    auto result = timeline_.emplace(payload, sig_op);
+    auto result = timeline_.Emplace(sig_op);
     if (!result.second) {
         // timeline semaphore wait before signal
-        result.first->second.signal_op.emplace(sig_op);
+        result.first->signal_op.emplace(sig_op);
     }
 }
 
@@ -43,16 +100,16 @@ void vvl::Semaphore::EnqueueWait(vvl::Queue *queue, uint64_t queue_seq, uint64_t
             completed_ = wait_op;
             return;
         }
-        payload = timeline_.rbegin()->first;
+        payload = timeline_.back().payload;
         wait_op.payload = payload;
     } else {
         if (payload <= completed_.payload) {
             return;
         }
     }
-    auto result = timeline_.emplace(payload, TimePoint(wait_op));
+    auto result = timeline_.Emplace(wait_op);
     if (!result.second) {
-        result.first->second.AddWaitOp(wait_op);
+        result.first->AddWaitOp(wait_op);
     }
 }
 
@@ -61,7 +118,7 @@ void vvl::Semaphore::EnqueueAcquire(vvl::Func command) {
     assert(type == VK_SEMAPHORE_TYPE_BINARY);
     auto payload = next_payload_++;
     SemOp acquire(kBinaryAcquire, nullptr, 0, payload, command);
-    timeline_.emplace(payload, acquire);
+    timeline_.Emplace(acquire);
 }
 
 std::optional<SemOp> vvl::Semaphore::LastOp(const std::function<bool(const SemOp &, bool)> &filter) const {
@@ -69,7 +126,7 @@ std::optional<SemOp> vvl::Semaphore::LastOp(const std::function<bool(const SemOp
     std::optional<SemOp> result;
 
     for (auto pos = timeline_.rbegin(); pos != timeline_.rend(); ++pos) {
-        auto &timepoint = pos->second;
+        auto &timepoint = *pos;
         for (auto &op : timepoint.wait_ops) {
             assert(op.payload == timepoint.wait_ops[0].payload);
             if (!filter || filter(op, true)) {
@@ -94,7 +151,7 @@ std::optional<vvl::SubmissionLocator> vvl::Semaphore::GetLastBinarySignalSubmiss
     if (timeline_.empty()) {
         return {};
     }
-    const auto &timepoint = timeline_.rbegin()->second;
+    const auto &timepoint = timeline_.back();
     const auto &signal_op = timepoint.signal_op;
     // Binary wait without a signal is not a valid semaphore state (part of binary semaphore validation).
     // Return an empty locator in this case.
@@ -114,7 +171,7 @@ bool vvl::Semaphore::CanBinaryBeSignaled() const {
     if (timeline_.empty()) {
         return CanSignalBinarySemaphoreAfterOperation(completed_.op_type);
     }
-    return timeline_.rbegin()->second.HasWaiters();
+    return timeline_.back().HasWaiters();
 }
 
 bool vvl::Semaphore::CanBinaryBeWaited() const {
@@ -123,7 +180,7 @@ bool vvl::Semaphore::CanBinaryBeWaited() const {
     if (timeline_.empty()) {
         return CanWaitBinarySemaphoreAfterOperation(completed_.op_type);
     }
-    return !timeline_.rbegin()->second.HasWaiters();
+    return !timeline_.back().HasWaiters();
 }
 
 void vvl::Semaphore::SemOp::Notify() const {
@@ -144,9 +201,8 @@ void vvl::Semaphore::TimePoint::Notify() const {
 
 void vvl::Semaphore::Notify(uint64_t payload) {
     auto guard = ReadLock();
-    auto pos = timeline_.find(payload);
-    if (pos != timeline_.end()) {
-        pos->second.Notify();
+    if (const auto *timepoint = timeline_.Find(payload)) {
+        timepoint->Notify();
     }
 }
 
@@ -155,9 +211,9 @@ void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint
     if (payload <= completed_.payload) {
         return;
     }
-    auto pos = timeline_.find(payload);
-    assert(pos != timeline_.end());
-    auto &timepoint = pos->second;
+    auto *pos = timeline_.Find(payload);
+    assert(pos);
+    auto &timepoint = *pos;
     timepoint.Notify();
 
     bool retire_here = false;
@@ -184,17 +240,16 @@ void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint
             assert(wait.payload == timepoint.wait_ops[0].payload);
             completed_ = wait;
         }
-        timepoint.completed.set_value();
-        timeline_.erase(timeline_.begin());
+        timepoint.Complete();
+        timeline_.PopFront();
         if (scope_ == kExternalTemporary) {
             scope_ = kInternal;
             imported_handle_type_.reset();
         }
     } else {
         // Wait for some other queue or a host operation to retire
-        assert(timepoint.waiter.valid());
         // the current timepoint should get destroyed while we're waiting, so copy out the waiter.
-        auto waiter = timepoint.waiter;
+        auto waiter = timepoint.GetWaiter();
         guard.unlock();
         auto result = waiter.wait_until(GetCondWaitTimeout());
         if (result != std::future_status::ready) {
@@ -208,6 +263,23 @@ void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint
     }
 }
 
+bool vvl::Semaphore::CanRetireWithoutWaiting(const vvl::Queue *current_queue, uint64_t payload) const {
+    auto guard = ReadLock();
+    if (payload <= completed_.payload) {
+        return true;
+    }
+    const auto *pos = timeline_.Find(payload);
+    if (!pos) {
+        return true;
+    }
+    // Same conditions as retire_here in Retire()
+    const auto &timepoint = *pos;
+    if (timepoint.signal_op) {
+        return timepoint.signal_op->queue == current_queue || timepoint.signal_op->IsAcquire();
+    }
+    return scope_ != kInternal;
+}
+
 std::shared_future<void> vvl::Semaphore::Wait(uint64_t payload) {
     auto guard = WriteLock();
     if (payload <= completed_.payload) {
@@ -217,12 +289,12 @@ std::shared_future<void> vvl::Semaphore::Wait(uint64_t payload) {
         return result;
     }
     SemOp wait_op(kWait, nullptr, 0, payload);
-    auto result = timeline_.emplace(payload, TimePoint(wait_op));
-    auto &timepoint = result.first->second;
+    auto result = timeline_.Emplace(wait_op);
+    auto &timepoint = *result.first;
     if (!result.second) {
         timepoint.AddWaitOp(wait_op);
     }
-    return timepoint.waiter;
+    return timepoint.GetWaiter();
 }
 
 void vvl::Semaphore::NotifyAndWait(const Location &loc, uint64_t payload) {
@@ -247,8 +319,8 @@ void vvl::Semaphore::NotifyAndWait(const Location &loc, uint64_t payload) {
         // it was imported. The queue's semaphore signal should not be overwritten by a potentially
         // external signal. Otherwise, queue information (queue/seq) can be lost, which may prevent the
         // advancement of the queue simulation.
-        const auto it = timeline_.find(payload);
-        const bool already_signaled = it != timeline_.end() && it->second.signal_op.has_value();
+        const auto *timepoint = timeline_.Find(payload);
+        const bool already_signaled = timepoint && timepoint->signal_op.has_value();
         if (!already_signaled) {
             EnqueueSignal(nullptr, 0, payload);
         }
@@ -19,8 +19,8 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include <future>
-#include <map>
 #include <mutex>
+#include <vector>
 #include "containers/custom_containers.h"
 #include "error_message/error_location.h"
 
@@ -80,7 +80,7 @@ class Semaphore : public RefcountedStateObject {
     };
 
     struct TimePoint {
-        TimePoint(SemOp &op) : signal_op(), completed(), waiter(completed.get_future()) {
+        TimePoint(const SemOp &op) : payload(op.payload) {
             if (op.op_type == kWait) {
                 AddWaitOp(op);
             } else {
@@ -92,14 +92,49 @@ class Semaphore : public RefcountedStateObject {
             assert(wait_ops.empty() || wait_ops[0].payload == op.payload);
             wait_ops.emplace_back(op);
         }
+        uint64_t payload;
         std::optional<SemOp> signal_op;
         small_vector<SemOp, 1, uint32_t> wait_ops;
-        std::promise<void> completed;
+        // Created by the first waiter only, most timepoints are retired by the queue signaling them without anyone waiting
+        std::optional<std::promise<void>> completed;
         std::shared_future<void> waiter;
 
         bool HasSignaler() const { return signal_op.has_value(); }
         bool HasWaiters() const { return !wait_ops.empty(); }
         void Notify() const;
+        std::shared_future<void> GetWaiter();
+        void Complete();
+    };
+
+    // Pending timepoints sorted by payload. Payloads are mostly enqueued in increasing order and retired from the front, so
+    // new timepoints are appended and retired ones only skipped until enough of them are dropped at once, reusing the storage.
+    class Timeline {
+      public:
+        using const_iterator = std::vector<TimePoint>::const_iterator;
+        using const_reverse_iterator = std::vector<TimePoint>::const_reverse_iterator;
+
+        bool empty() const { return begin_ == points_.size(); }
+        TimePoint &front() { return points_[begin_]; }
+        const TimePoint &back() const { return points_.back(); }
+        const_iterator begin() const { return points_.begin() + begin_; }
+        const_iterator end() const { return points_.end(); }
+        const_reverse_iterator rbegin() const { return points_.rbegin(); }
+        const_reverse_iterator rend() const { return points_.rend() - begin_; }
+
+        TimePoint *Find(uint64_t payload);
+        const TimePoint *Find(uint64_t payload) const;
+        // Returns the timepoint of the op payload and true if it was created for op, false if it already existed
+        std::pair<TimePoint *, bool> Emplace(const SemOp &op);
+        void PopFront();
+
+      private:
+        // The retired timepoints are dropped once there are this many and they are at least half of the storage
+        static constexpr size_t kMinRetiredToDrop = 16;
+
+        std::vector<TimePoint>::iterator LowerBound(uint64_t payload);
+
+        std::vector<TimePoint> points_;
+        size_t begin_ = 0;
     };
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
@@ -175,6 +210,9 @@ class Semaphore : public RefcountedStateObject {
     // Remove completed operations and signal any waiters. This should only be called by Queue
     void Retire(Queue *current_queue, const Location &loc, uint64_t payload);
 
+    // False if Retire() would have to wait for another queue or a host operation to retire the payload first
+    bool CanRetireWithoutWaiting(const Queue *current_queue, uint64_t payload) const;
+
     // look for most recent / highest payload operation that matches
     std::optional<SemOp> LastOp(const std::function<bool(const SemOp &, bool is_pending)> &filter = nullptr) const;
 
@@ -212,7 +250,7 @@ class Semaphore : public RefcountedStateObject {
     // Set of pending operations ordered by payload.
     // Timeline operations can be added in any order and multiple wait operations
     // can use the same payload value.
-    std::map<uint64_t, TimePoint> timeline_;
+    Timeline timeline_;
     mutable std::shared_mutex lock_;
     ValidationStateTracker &dev_data_;
 };
@@ -17,24 +17,43 @@
 #include "state_tracker/shader_module.h"
 #include "generated/spirv_grammar_helper.h"
 
+#include <array>
+
 namespace spirv {
 
-Instruction::Instruction(std::vector<uint32_t>::const_iterator it) {
-    words_.emplace_back(*it++);
-    words_.reserve(Length());
-    for (uint32_t i = 1; i < Length(); i++) {
-        words_.emplace_back(*it++);
+namespace {
+
+struct OperandIndices {
+    uint8_t result_id;
+    uint8_t type_id;
+};
+
+constexpr OperandIndices GetOperandIndices(uint32_t opcode) {
+    const bool has_result = OpcodeHasResult(opcode);
+    if (OpcodeHasType(opcode)) {
+        return {uint8_t(has_result ? 2 : 0), 1};
     }
+    return {uint8_t(has_result ? 1 : 0), 0};
+}
 
-    const bool has_result = OpcodeHasResult(Opcode());
-    if (OpcodeHasType(Opcode())) {
-        type_id_index_ = 1;
-        if (has_result) {
-            result_id_index_ = 2;
-        }
-    } else if (has_result) {
-        result_id_index_ = 1;
+// The core opcodes are below this, they make up nearly all the instructions of a module and are looked up once each when
+// parsing. The extension opcodes (in the thousands) are rare enough to fall back to the switches of the grammar helpers.
+constexpr uint32_t kOperandIndicesTableSize = 1024;
+constexpr auto kOperandIndicesTable = []() {
+    std::array<OperandIndices, kOperandIndicesTableSize> table{};
+    for (uint32_t opcode = 0; opcode < kOperandIndicesTableSize; ++opcode) {
+        table[opcode] = GetOperandIndices(opcode);
     }
+    return table;
+}();
+
+}  // namespace
+
+Instruction::Instruction(const uint32_t *words) : words_(words) {
+    const uint32_t opcode = Opcode();
+    const OperandIndices indices = opcode < kOperandIndicesTableSize ? kOperandIndicesTable[opcode] : GetOperandIndices(opcode);
+    result_id_index_ = indices.result_id;
+    type_id_index_ = indices.type_id;
 
 #ifndef NDEBUG
     d_opcode_ = std::string(string_SpvOpcode(Opcode()));
@@ -16,6 +16,7 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -32,9 +33,11 @@ namespace spirv {
 //
 // For more information of the physical module layout to help understand this struct:
 // https://github.com/KhronosGroup/SPIRV-Guide/blob/main/chapters/parsing_instructions.md
+//
+// The words are not copied, the instruction points into the code of the spirv::Module that parsed it, which outlives it.
 class Instruction {
   public:
-    Instruction(std::vector<uint32_t>::const_iterator it);
+    explicit Instruction(const uint32_t* words);
     ~Instruction() = default;
 
     // The word used to define the Instruction
@@ -74,19 +77,13 @@ class Instruction {
     // Auto-generated helper functions
     spv::StorageClass StorageClass() const;
 
-    bool operator==(Instruction const& other) const { return words_ == other.words_; }
-    bool operator!=(Instruction const& other) const { return words_ != other.words_; }
+    bool operator==(Instruction const& other) const {
+        return Length() == other.Length() && std::equal(words_, words_ + Length(), other.words_);
+    }
+    bool operator!=(Instruction const& other) const { return !(*this == other); }
 
   private:
-    // When this class was created, for SPIR-V Instructions that could be used in Vulkan,
-    //   414 of 423 had 6 or less operands
-    //   361 of 423 had 5 or less operands
-    //   287 of 423 had 4 or less operands
-    // An extra word is still needed because each insturction has one word prior to the operands
-    static constexpr uint32_t word_vector_length = 7;
-
-    // Max capacity needs to be uint32_t because an instruction can have a string operand that is (2^16)-1 bytes long
-    small_vector<uint32_t, word_vector_length, uint32_t> words_;
+    const uint32_t* words_;
     uint32_t result_id_index_ = 0;
     uint32_t type_id_index_ = 0;
 
@@ -15,6 +15,8 @@
 
 #include "state_tracker/shader_module.h"
 
+#include <algorithm>
+#include <atomic>
 #include <sstream>
 #include <string>
 #include <queue>
@@ -23,6 +25,7 @@
 #include "state_tracker/descriptor_sets.h"
 #include "generated/spirv_grammar_helper.h"
 #include "spirv/1.2/GLSL.std.450.h"
+#include "utils/hash_util.h"
 
 namespace spirv {
 
@@ -700,6 +703,11 @@ ImageAccess::ImageAccess(const Module& module_state, const Instruction& image_in
     }
 }
 
+static uint32_t NextUniqueId() {
+    static std::atomic<uint32_t> unique_id{0};
+    return ++unique_id;
+}
+
 EntryPoint::EntryPoint(const Module& module_state, const Instruction& entrypoint_insn, const ImageAccessMap& image_access_map)
     : entrypoint_insn(entrypoint_insn),
       execution_model(spv::ExecutionModel(entrypoint_insn.Word(1))),
@@ -707,6 +715,7 @@ EntryPoint::EntryPoint(const Module& module_state, const Instruction& entrypoint
       id(entrypoint_insn.Word(2)),
       name(entrypoint_insn.GetAsString(3)),
       execution_mode(module_state.GetExecutionModeSet(id)),
+      unique_id(NextUniqueId()),
       emit_vertex_geometry(false),
       accessible_ids(GetAccessibleIds(module_state, *this)),
       resource_interface_variables(GetResourceInterfaceVariables(module_state, *this, image_access_map)),
@@ -734,15 +743,18 @@ EntryPoint::EntryPoint(const Module& module_state, const Instruction& entrypoint
             if (variable.interface_slots.empty()) {
                 continue;
             }
+            const bool unmatched = variable.nested_struct || variable.physical_storage_buffer;
             for (const auto& slot : variable.interface_slots) {
                 if (variable.storage_class == spv::StorageClassInput) {
-                    input_interface_slots[slot] = &variable;
+                    input_interface_slots.push_back({&slot, &variable});
+                    has_unmatched_input_slots |= unmatched;
                     if (!max_input_slot || slot.slot > max_input_slot->slot) {
                         max_input_slot = &slot;
                         max_input_slot_variable = &variable;
                     }
                 } else if (variable.storage_class == spv::StorageClassOutput) {
-                    output_interface_slots[slot] = &variable;
+                    output_interface_slots.push_back({&slot, &variable});
+                    has_unmatched_output_slots |= unmatched;
                     if (!max_output_slot || slot.slot > max_output_slot->slot) {
                         max_output_slot = &slot;
                         max_output_slot_variable = &variable;
@@ -754,6 +766,9 @@ EntryPoint::EntryPoint(const Module& module_state, const Instruction& entrypoint
             }
         }
     }
+    const auto by_slot = [](const InterfaceSlotVariable& a, const InterfaceSlotVariable& b) { return a.slot->slot < b.slot->slot; };
+    std::stable_sort(input_interface_slots.begin(), input_interface_slots.end(), by_slot);
+    std::stable_sort(output_interface_slots.begin(), output_interface_slots.end(), by_slot);
 
     for (const Instruction* decoration_inst : module_state.static_data_.builtin_decoration_inst) {
         if ((decoration_inst->GetBuiltIn() == spv::BuiltInPointSize) && module_state.IsBuiltInWritten(decoration_inst, *this)) {
@@ -786,27 +801,41 @@ std::optional<VkPrimitiveTopology> Module::GetTopology(const EntryPoint& entrypo
     return result;
 }
 
-Module::StaticData::StaticData(const Module& module_state) {
-    // Parse the words first so we have instruction class objects to use
-    {
-        std::vector<uint32_t>::const_iterator it = module_state.words_.cbegin();
-        it += 5;  // skip first 5 word of header
-        while (it != module_state.words_.cend()) {
-            Instruction insn(it);
-            const uint32_t opcode = insn.Opcode();
-
-            // Check for opcodes that would require reparsing of the words
-            if (opcode == spv::OpGroupDecorate || opcode == spv::OpDecorationGroup || opcode == spv::OpGroupMemberDecorate) {
-                assert(has_group_decoration == false);  // if assert, spirv-opt didn't flatten it
-                has_group_decoration = true;
-                return;  // no need to continue parsing
-            }
+void Module::StaticData::Parse(const Module& module_state) {
+    const uint32_t *const begin = module_state.words_.data();
+    const size_t word_count = module_state.words_.size();
+    constexpr size_t kHeaderWords = 5;
+    if (word_count < kHeaderWords) {
+        return;
+    }
 
-            instructions.push_back(insn);
-            it += insn.Length();
+    // Find the instruction boundaries first, so the instructions are allocated once (which also keeps the pointers to them
+    // stable while they are added below). Each length gives where the next instruction starts, so this only reads one word
+    // per instruction. Stops at the first length that can't be right, the module is not valid SPIR-V then and spirv-val
+    // reports it.
+    size_t instruction_count = 0;
+    size_t parsed_words = kHeaderWords;
+    for (size_t offset = kHeaderWords; offset < word_count;) {
+        const uint32_t length = begin[offset] >> 16;
+        if (length == 0 || length > word_count - offset) {
+            break;
+        }
+        const uint32_t opcode = begin[offset] & 0x0ffffu;
+        // Check for opcodes that would require reparsing of the words
+        if (opcode == spv::OpGroupDecorate || opcode == spv::OpDecorationGroup || opcode == spv::OpGroupMemberDecorate) {
+            assert(has_group_decoration == false);  // if assert, spirv-opt didn't flatten it
+            has_group_decoration = true;
+            return;  // no need to continue parsing
         }
-        instructions.shrink_to_fit();
+        instruction_count++;
+        offset += length;
+        parsed_words = offset;
     }
+    instructions.reserve(instruction_count);
+
+    // Ids are below the bound of the header. It is not checked yet, so a bound beyond the word count (no valid module
+    // gets close to that) only has the ids that fit in the dense array, the others go to a map.
+    definitions.resize(std::min<size_t>(begin[3], word_count), nullptr);
 
     // These have their own object class, but need entire module parsed first
     std::vector<const Instruction*> entry_point_instructions;
@@ -818,13 +847,19 @@ Module::StaticData::StaticData(const Module& module_state) {
     // < Function ID, OpFunctionParameter Ids >
     std::unordered_map<uint32_t, std::vector<uint32_t>> func_parameter_list;
 
-    // Loop through once and build up the static data
+    // Create the instructions and build up the static data in the same pass over the words
     // Also process the entry points
-    for (const Instruction& insn : instructions) {
+    for (size_t offset = kHeaderWords; offset < parsed_words; offset += instructions.back().Length()) {
+        const Instruction& insn = instructions.emplace_back(begin + offset);
+
         // Build definition list
         const uint32_t result_id = insn.ResultId();
         if (result_id != 0) {
-            definitions[result_id] = &insn;
+            if (result_id < definitions.size()) {
+                definitions[result_id] = &insn;
+            } else {
+                definitions_beyond_bound[result_id] = &insn;
+            }
         }
 
         switch (insn.Opcode()) {
@@ -1063,22 +1098,19 @@ Module::StaticData::StaticData(const Module& module_state) {
         type_struct_map[new_struct->id] = new_struct;
     }
 
-    // Need to get ImageAccesses as EntryPoint's variables depend on it
-    std::vector<std::shared_ptr<ImageAccess>> image_accesses;
-    ImageAccessMap image_access_map;
-
-    for (const auto& insn : image_instructions) {
-        auto new_access = image_accesses.emplace_back(std::make_shared<ImageAccess>(module_state, *insn));
-        if (!new_access->variable_image_insn.empty() && new_access->valid_access) {
-            for (const Instruction* image_insn : new_access->variable_image_insn) {
-                image_access_map[image_insn->ResultId()].push_back(new_access);
-            }
-        }
+    // The ImageAccesses that EntryPoint's variables depend on, and the EntryPoints themselves are only built when used
+    image_accesses = std::make_unique<LazyImageAccesses>();
+    image_accesses->image_instructions = std::move(image_instructions);
+    entry_points.reserve(entry_point_instructions.size());
+    for (const auto& insn : entry_point_instructions) {
+        auto& entry_point = entry_points.emplace_back(std::make_unique<LazyEntryPoint>());
+        entry_point->insn = insn;
+        entry_point->stage =
+            static_cast<VkShaderStageFlagBits>(ExecutionModelToShaderStageFlagBits(spv::ExecutionModel(insn->Word(1))));
     }
 
-    // Need to build the definitions table for FindDef before looking for which instructions each entry point uses
-    for (const auto& insn : entry_point_instructions) {
-        entry_points.emplace_back(std::make_shared<EntryPoint>(module_state, *insn, image_access_map));
+    if (has_specialization_constants) {
+        code_hash = hash_util::Hash64(module_state.words_.data(), module_state.words_.size() * sizeof(uint32_t));
     }
 }
 
@@ -1158,11 +1190,70 @@ std::string Module::DescribeType(uint32_t type) const {
     return ss.str();
 }
 
+std::shared_ptr<Module> Module::Create(size_t codeSize, const uint32_t* pCode, ParsedCache& cache) {
+    const vvl::span<const uint32_t> code(pCode, codeSize / sizeof(uint32_t));
+    const uint64_t hash = hash_util::Hash64(code.data(), code.size() * sizeof(uint32_t));
+    if (auto parsed = cache.Find(hash, code)) {
+        return std::make_shared<Module>(std::move(parsed));
+    }
+    auto module = std::make_shared<Module>(code);
+    cache.Add(hash, module->parsed_);
+    return module;
+}
+
+std::shared_ptr<Module::Parsed> ParsedCache::Find(uint64_t hash, vvl::span<const uint32_t> code) {
+    std::shared_ptr<Module::Parsed> parsed;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto it = parsed_.find(hash);
+        if (it != parsed_.end()) {
+            parsed = it->second.lock();
+        }
+    }
+    // Compared outside the lock, the words never change
+    if (parsed && (parsed->words.size() != code.size() ||
+                   std::memcmp(parsed->words.data(), code.data(), code.size() * sizeof(uint32_t)) != 0)) {
+        return nullptr;  // hash collision, the other code keeps the entry
+    }
+    return parsed;
+}
+
+void ParsedCache::Add(uint64_t hash, const std::shared_ptr<Module::Parsed>& parsed) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto& entry = parsed_[hash];
+    if (entry.expired()) {
+        entry = parsed;
+    }
+    if (++adds_since_prune_ >= kPruneInterval) {
+        adds_since_prune_ = 0;
+        for (auto it = parsed_.begin(); it != parsed_.end();) {
+            it = it->second.expired() ? parsed_.erase(it) : std::next(it);
+        }
+    }
+}
+
 std::shared_ptr<const EntryPoint> Module::FindEntrypoint(char const* name, VkShaderStageFlagBits stageBits) const {
-    for (const auto& entry_point : static_data_.entry_points) {
-        if (entry_point->name.compare(name) == 0 && entry_point->stage == stageBits) {
-            return entry_point;
+    for (const auto& lazy_entry_point : static_data_.entry_points) {
+        if (lazy_entry_point->stage != stageBits || strcmp(lazy_entry_point->insn->GetAsString(3), name) != 0) {
+            continue;
         }
+        // Several threads can create pipelines with the same module at once
+        auto& image_accesses = *static_data_.image_accesses;
+        std::call_once(image_accesses.once, [&]() {
+            for (const Instruction* insn : image_accesses.image_instructions) {
+                auto new_access = std::make_shared<ImageAccess>(*this, *insn);
+                if (!new_access->variable_image_insn.empty() && new_access->valid_access) {
+                    for (const Instruction* image_insn : new_access->variable_image_insn) {
+                        image_accesses.map[image_insn->ResultId()].push_back(new_access);
+                    }
+                }
+            }
+            image_accesses.image_instructions = {};
+        });
+        std::call_once(lazy_entry_point->once, [&]() {
+            lazy_entry_point->entry_point = std::make_shared<EntryPoint>(*this, *lazy_entry_point->insn, image_accesses.map);
+        });
+        return lazy_entry_point->entry_point;
     }
     return nullptr;
 }
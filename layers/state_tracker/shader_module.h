@@ -20,6 +20,8 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -407,6 +409,12 @@ struct PushConstantVariable : public VariableBase {
     PushConstantVariable(const Module &module_state, const Instruction &insn, VkShaderStageFlagBits stage);
 };
 
+// An interface slot and the variable that is in it
+struct InterfaceSlotVariable {
+    const InterfaceSlot *slot;
+    const StageInteraceVariable *variable;
+};
+
 // Represents a single Entrypoint into a Shader Module
 struct EntryPoint {
     // "A module must not have two OpEntryPoint instructions with the same Execution Model and the same Name string."
@@ -418,6 +426,8 @@ struct EntryPoint {
     const uint32_t id;
     const std::string name;
     const ExecutionModeSet &execution_mode;
+    // Unique for the life of the process, unlike the address, so it can key results cached across pipelines
+    const uint32_t unique_id;
 
     // Values found while gather the Accessible Ids
     bool emit_vertex_geometry;
@@ -436,10 +446,13 @@ struct EntryPoint {
     // "User-defined Variable Interface" - vkspec.html#interfaces-iointerfaces-user
     std::vector<const StageInteraceVariable *> user_defined_interface_variables;
 
-    // Lookup map from Interface slot to the variable in that spot
-    // spirv-val guarantees no overlap so 2 variables won't have same slot
-    std::unordered_map<InterfaceSlot, const StageInteraceVariable *, InterfaceSlot::Hash> input_interface_slots;
-    std::unordered_map<InterfaceSlot, const StageInteraceVariable *, InterfaceSlot::Hash> output_interface_slots;
+    // Every user defined interface slot with the variable in that spot, sorted by slot so matching a producer against a consumer
+    // is a single walk over both. spirv-val guarantees no overlap so 2 variables won't have same slot
+    std::vector<InterfaceSlotVariable> input_interface_slots;
+    std::vector<InterfaceSlotVariable> output_interface_slots;
+    // A nested struct or physical storage buffer variable has slots, they are not matched between stages yet
+    bool has_unmatched_input_slots{false};
+    bool has_unmatched_output_slots{false};
     // Uesd for limit check
     const StageInteraceVariable *max_input_slot_variable = nullptr;
     const StageInteraceVariable *max_output_slot_variable = nullptr;
@@ -466,6 +479,8 @@ struct EntryPoint {
                                                                                 const ImageAccessMap &image_access_map);
 };
 
+class ParsedCache;
+
 // Represents a SPIR-V Module
 // This holds the SPIR-V source and parse it
 struct Module {
@@ -473,16 +488,17 @@ struct Module {
     // The goal of this struct is to move everything that is ready only into here
     struct StaticData {
         StaticData() = default;
-        StaticData(const Module &module_state);
-        StaticData &operator=(StaticData &&) = default;
-        StaticData(StaticData &&) = default;
+        // Fills it in place, the parse looks things up through module_state.static_data_ as it goes
+        void Parse(const Module &module_state);
 
-        // List of all instructions in the order they appear in the binary
+        // List of all instructions in the order they appear in the binary, they point into Module::words_
         std::vector<Instruction> instructions;
         // Instructions that can be referenced by Ids
-        // A mapping of <id> to the first word of its def. this is useful because walking type
+        // Indexed by <id>, nullptr if nothing defines it. this is useful because walking type
         // trees, constant expressions, etc requires jumping all over the instruction stream.
-        vvl::unordered_map<uint32_t, const Instruction *> definitions;
+        std::vector<const Instruction *> definitions;
+        // Ids that don't fit in definitions, only with a header bound larger than the module itself
+        vvl::unordered_map<uint32_t, const Instruction *> definitions_beyond_bound;
 
         vvl::unordered_map<uint32_t, DecorationSet> decorations;
         DecorationSet empty_decoration;  // all zero values, allows use to return a reference and not a copy each time
@@ -525,11 +541,28 @@ struct Module {
         bool has_capability_runtime_descriptor_array{false};
 
         bool has_specialization_constants{false};
+        // Hash64 of the words, only computed with specialization constants, to key the results of applying them
+        uint64_t code_hash{0};
         bool has_invocation_repack_instruction{false};
         bool uses_interpolate_at_sample{false};
 
-        // EntryPoint has pointer references inside it that need to be preserved
-        std::vector<std::shared_ptr<EntryPoint>> entry_points;
+        // Reflecting an entry point walks everything it can access, and most pipelines use a single entry point of a module,
+        // so each one is only reflected the first time FindEntrypoint() returns it.
+        struct LazyEntryPoint {
+            const Instruction *insn;  // OpEntryPoint
+            VkShaderStageFlagBits stage;
+            std::once_flag once;
+            // EntryPoint has pointer references inside it that need to be preserved
+            std::shared_ptr<const EntryPoint> entry_point;
+        };
+        std::vector<std::unique_ptr<LazyEntryPoint>> entry_points;
+        // The image accesses of the whole module, built with the first entry point and then shared by all of them
+        struct LazyImageAccesses {
+            std::vector<const Instruction *> image_instructions;
+            std::once_flag once;
+            ImageAccessMap map;
+        };
+        std::unique_ptr<LazyImageAccesses> image_accesses;
 
         std::vector<std::shared_ptr<TypeStructInfo>> type_structs;  // All OpTypeStruct objects
         // <OpTypeStruct ID, info> - used for faster lookup as there can many structs
@@ -557,23 +590,44 @@ struct Module {
         vvl::unordered_map<uint32_t, std::vector<uint32_t>> func_parameter_map;
     };
 
+    // The code and what is parsed from it never change once built, so the Modules made from the same code can share them
+    // (see ParsedCache). Only the handle is per Module.
+    struct Parsed {
+        std::vector<uint32_t> words;
+        StaticData static_data;
+    };
+
+  private:
+    std::shared_ptr<Parsed> parsed_;
+
+  public:
     // This is the SPIR-V module data content
-    const std::vector<uint32_t> words_;
+    const std::vector<uint32_t> &words_;
 
-    const StaticData static_data_;
+    const StaticData &static_data_;
 
     // Hold a handle so error message can know where the SPIR-V was from (VkShaderModule or VkShaderEXT)
     VulkanTypedHandle handle_;                            // Will be updated once its known its valid SPIR-V
     VulkanTypedHandle handle() const { return handle_; }  // matches normal convention to get handle
 
     // Used for when modifying the SPIR-V (spirv-opt, GPU-AV instrumentation, etc) and need reparse it for VVL validaiton
-    Module(vvl::span<const uint32_t> code) : words_(code.begin(), code.end()), static_data_(*this) {}
+    Module(vvl::span<const uint32_t> code) : Module(std::make_shared<Parsed>(Parsed{{code.begin(), code.end()}, {}})) {
+        parsed_->static_data.Parse(*this);
+    }
+
+    Module(size_t codeSize, const uint32_t *pCode) : Module(vvl::span<const uint32_t>(pCode, codeSize / sizeof(uint32_t))) {}
+
+    // Shares the code and static data of a Module that was already parsed
+    explicit Module(std::shared_ptr<Parsed> parsed)
+        : parsed_(std::move(parsed)), words_(parsed_->words), static_data_(parsed_->static_data) {}
 
-    Module(size_t codeSize, const uint32_t *pCode) : words_(pCode, pCode + codeSize / sizeof(uint32_t)), static_data_(*this) {}
+    // Reuses the parse of a live Module made from the same code, if any
+    static std::shared_ptr<Module> Create(size_t codeSize, const uint32_t *pCode, ParsedCache &cache);
 
     const Instruction *FindDef(uint32_t id) const {
-        auto it = static_data_.definitions.find(id);
-        if (it == static_data_.definitions.end()) return nullptr;
+        if (id < static_data_.definitions.size()) return static_data_.definitions[id];
+        auto it = static_data_.definitions_beyond_bound.find(id);
+        if (it == static_data_.definitions_beyond_bound.end()) return nullptr;
         return it->second;
     }
 
@@ -622,6 +676,7 @@ struct Module {
 
     std::optional<VkPrimitiveTopology> GetTopology(const EntryPoint &entrypoint) const;
 
+    // Reflects the entry point the first time it is found
     std::shared_ptr<const EntryPoint> FindEntrypoint(char const *name, VkShaderStageFlagBits stageBits) const;
     bool FindLocalSize(const EntryPoint &entrypoint, uint32_t &local_size_x, uint32_t &local_size_y, uint32_t &local_size_z) const;
 
@@ -652,6 +707,25 @@ struct Module {
     }
 };
 
+// The parsed code of the live Modules by content, so engines creating the same shader many times (per thread, per material,
+// as a module and as a shader object) only parse it once. Only holds weak references, the parse goes away with the last Module
+// using it.
+class ParsedCache {
+  public:
+    // nullptr if no live Module has this code
+    std::shared_ptr<Module::Parsed> Find(uint64_t hash, vvl::span<const uint32_t> code);
+    // Keeps an entry that is still alive, another thread may have parsed the same code meanwhile
+    void Add(uint64_t hash, const std::shared_ptr<Module::Parsed> &parsed);
+
+  private:
+    // Expired entries are swept every so often instead of on each Module destruction
+    static constexpr uint32_t kPruneInterval = 256;
+
+    std::mutex lock_;
+    vvl::unordered_map<uint64_t, std::weak_ptr<Module::Parsed>> parsed_;
+    uint32_t adds_since_prune_ = 0;
+};
+
 }  // namespace spirv
 
 // Represents a VkShaderModule handle
@@ -17,6 +17,7 @@
  * limitations under the License.
  */
 #include "state_tracker/state_object.h"
+#include "containers/epoch_reclamation.h"
 
 vvl::StateObject::~StateObject() { Destroy(); }
 
@@ -26,14 +27,18 @@ void vvl::StateObject::Destroy() {
 }
 
 const VulkanTypedHandle* vvl::StateObject::InUse() const {
-    // NOTE: for performance reasons, this method calls up the tree
-    // with the read lock held.
-    auto guard = ReadLockTree();
-    for (auto& item : parent_nodes_) {
-        auto node = item.second.lock();
-        if (!node) {
-            continue;
-        }
+    // Copy the parents and walk up the tree with the lock released. TreeLock is a spin lock, so
+    // holding it across the recursion would stall other threads and could self deadlock if a
+    // parent reference dropped here destroyed an object that unlinks from this one.
+    NodeList parents;
+    {
+        auto guard = LockTree();
+        parent_nodes_.AnyOf([&parents](const std::shared_ptr<StateObject>& node) {
+            parents.emplace_back(node);
+            return false;
+        });
+    }
+    for (const auto& node : parents) {
         if (node->InUse()) {
             return &node->Handle();
         }
@@ -42,35 +47,42 @@ const VulkanTypedHandle* vvl::StateObject::InUse() const {
 }
 
 bool vvl::StateObject::AddParent(StateObject* parent_node) {
-    auto guard = WriteLockTree();
-    auto result = parent_nodes_.emplace(parent_node->Handle(), std::weak_ptr<StateObject>(parent_node->shared_from_this()));
-    return result.second;
+    std::vector<std::shared_ptr<StateObject>> released;
+    auto guard = LockTree();
+    const bool result = parent_nodes_.Add(*parent_node, released);
+    guard.unlock();
+    return result;
 }
 
 void vvl::StateObject::RemoveParent(StateObject* parent_node) {
     assert(parent_node);
-    auto guard = WriteLockTree();
-    parent_nodes_.erase(parent_node->Handle());
+    auto guard = LockTree();
+    parent_nodes_.Remove(*parent_node);
 }
 
 // copy the current set of parents so that we don't need to hold the lock
 // while calling NotifyInvalidate on them, as that would lead to recursive locking.
-vvl::StateObject::NodeMap vvl::StateObject::GetParentsForInvalidate(bool unlink) {
-    NodeMap result;
+vvl::StateObject::NodeList vvl::StateObject::GetParentsForInvalidate(bool unlink) {
+    NodeList result;
+    auto guard = LockTree();
+    parent_nodes_.AnyOf([&result](const std::shared_ptr<StateObject>& node) {
+        result.emplace_back(node);
+        return false;
+    });
     if (unlink) {
-        auto guard = WriteLockTree();
-        result = std::move(parent_nodes_);
         parent_nodes_.clear();
-    } else {
-        auto guard = ReadLockTree();
-        result = parent_nodes_;
     }
     return result;
 }
 
 vvl::StateObject::NodeMap vvl::StateObject::ObjectBindings() const {
-    auto guard = ReadLockTree();
-    return parent_nodes_;
+    NodeMap result;
+    auto guard = LockTree();
+    parent_nodes_.AnyOf([&result](const std::shared_ptr<StateObject>& node) {
+        result.emplace(node->Handle(), node);
+        return false;
+    });
+    return result;
 }
 
 void vvl::StateObject::Invalidate(bool unlink) {
@@ -90,10 +102,136 @@ void vvl::StateObject::NotifyInvalidate(const NodeList& invalid_nodes, bool unli
 
     NodeList up_nodes = invalid_nodes;
     up_nodes.emplace_back(shared_from_this());
-    for (auto& item : current_parents) {
-        auto node = item.second.lock();
-        if (node && !node->Destroyed()) {
+    for (auto& node : current_parents) {
+        if (!node->Destroyed()) {
             node->NotifyInvalidate(up_nodes, unlink);
         }
     }
 }
+
+std::shared_ptr<vvl::StateObject> vvl::ParentList::LockIfLinked(const Link& link) {
+    auto node = link.node.lock();
+    if (node && node->LinkGeneration() != link.generation) {
+        // The parent dropped its children since this link was made
+        node.reset();
+    }
+    return node;
+}
+
+uint32_t vvl::ParentList::Find(const StateObject& parent) const {
+    if (index_) {
+        auto it = index_->find(&parent);
+        return it != index_->end() ? it->second : links_.size();
+    }
+    for (uint32_t pos = 0; pos < links_.size(); ++pos) {
+        if (links_[pos].key == &parent) {
+            return pos;
+        }
+    }
+    return links_.size();
+}
+
+bool vvl::ParentList::Add(StateObject& parent, std::vector<std::shared_ptr<StateObject>>& released) {
+    std::weak_ptr<StateObject> node = parent.shared_from_this();
+    const uint32_t generation = parent.LinkGeneration();
+    const uint32_t pos = Find(parent);
+    if (pos < links_.size()) {
+        Link& link = links_[pos];
+        // The address may belong to a new object that was allocated where a dead parent used to be
+        const bool same_object = !link.node.owner_before(node) && !node.owner_before(link.node);
+        if (same_object && link.generation == generation) {
+            return false;
+        }
+        link.node = std::move(node);
+        link.generation = generation;
+        return true;
+    }
+
+    if (links_.size() >= prune_threshold_) {
+        Prune(released);
+        prune_threshold_ = std::max(kMinPruneThreshold, links_.size() * 2);
+    }
+    links_.emplace_back(Link{&parent, std::move(node), generation});
+    if (index_) {
+        index_->emplace(&parent, links_.size() - 1);
+    } else if (links_.size() > kIndexThreshold) {
+        RebuildIndex();
+    }
+    return true;
+}
+
+void vvl::ParentList::Remove(const StateObject& parent) {
+    const uint32_t pos = Find(parent);
+    if (pos < links_.size()) {
+        RemoveAt(pos);
+    }
+}
+
+void vvl::ParentList::RemoveAt(uint32_t pos) {
+    const uint32_t last = links_.size() - 1;
+    if (index_) {
+        index_->erase(links_[pos].key);
+    }
+    if (pos != last) {
+        links_[pos] = std::move(links_[last]);
+        if (index_) {
+            (*index_)[links_[pos].key] = pos;
+        }
+    }
+    links_.resize(last);
+}
+
+// Drops links to parents that are gone or have unlinked their children
+void vvl::ParentList::Prune(std::vector<std::shared_ptr<StateObject>>& released) {
+    uint32_t keep = 0;
+    for (uint32_t pos = 0; pos < links_.size(); ++pos) {
+        auto node = links_[pos].node.lock();
+        if (node && node->LinkGeneration() == links_[pos].generation) {
+            if (keep != pos) {
+                links_[keep] = std::move(links_[pos]);
+            }
+            keep++;
+        }
+        if (node) {
+            released.emplace_back(std::move(node));
+        }
+    }
+    links_.resize(keep);
+    if (links_.size() > kIndexThreshold) {
+        RebuildIndex();
+    } else {
+        index_.reset();
+    }
+}
+
+void vvl::ParentList::RebuildIndex() {
+    index_ = std::make_unique<unordered_map<const StateObject*, uint32_t>>();
+    index_->reserve(links_.size());
+    for (uint32_t pos = 0; pos < links_.size(); ++pos) {
+        index_->emplace(links_[pos].key, pos);
+    }
+}
+
+void vvl::StateReclaimer::Retire(std::shared_ptr<StateObject> &&state) {
+    bool schedule = false;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        // A single reclaim is queued at a time, it takes everything retired until it runs
+        schedule = pending_.empty();
+        pending_.emplace_back(std::move(state));
+    }
+    if (schedule) {
+        thread_.Push([this]() { Reclaim(); });
+    }
+}
+
+void vvl::StateReclaimer::Reclaim() {
+    std::vector<std::shared_ptr<StateObject>> batch;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        batch.swap(pending_);
+    }
+    // The references the state maps retired to the epoch domain go first, then the batch holds the last ones
+    EpochDomain::Get().Synchronize();
+    batch.clear();
+}
@@ -23,8 +23,13 @@
 #include "containers/custom_containers.h"
 #include "error_message/logging.h"
 #include "utils/vk_layer_utils.h"
+#include "utils/worker_pool.h"
 
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 // Intentionally ignore VulkanTypedHandle::node, it is optional
 inline bool operator==(const VulkanTypedHandle &a, const VulkanTypedHandle &b) noexcept {
@@ -38,6 +43,54 @@ struct hash<VulkanTypedHandle> {
 }  // namespace std
 
 namespace vvl {
+class StateObject;
+
+// Parent links of a StateObject, guarded by the owner's tree lock.
+//
+// Most objects have a handful of parents, so links are kept in a flat array and looked up by address. Only objects with
+// many parents (e.g. a buffer referenced by thousands of descriptor sets) also build an index.
+// Every link records the parent's link generation when it was made. A parent can drop all its child links at once by
+// bumping its generation (see StateObject::UnlinkChildren()). The stale links are skipped when walking the parents and
+// pruned lazily, or reused when the same parent links the object again.
+class ParentList {
+  public:
+    // Returns false if parent is already linked. Links pruned to make room are moved to released, so that the caller can
+    // drop them after releasing the tree lock (dropping the last reference to a parent may need it).
+    bool Add(StateObject &parent, std::vector<std::shared_ptr<StateObject>> &released);
+    void Remove(const StateObject &parent);
+
+    // Calls fn(const std::shared_ptr<StateObject> &) for every live parent until it returns true
+    template <typename Fn>
+    bool AnyOf(Fn &&fn) const;
+
+    bool empty() const { return links_.empty(); }
+    void clear() {
+        links_.clear();
+        index_.reset();
+        prune_threshold_ = kMinPruneThreshold;
+    }
+
+  private:
+    static constexpr uint32_t kIndexThreshold = 16;
+    static constexpr uint32_t kMinPruneThreshold = 8;
+
+    struct Link {
+        const StateObject *key;  // identity only, never dereferenced
+        std::weak_ptr<StateObject> node;
+        uint32_t generation;
+    };
+
+    static std::shared_ptr<StateObject> LockIfLinked(const Link &link);
+    uint32_t Find(const StateObject &parent) const;
+    void RemoveAt(uint32_t pos);
+    void Prune(std::vector<std::shared_ptr<StateObject>> &released);
+    void RebuildIndex();
+
+    small_vector<Link, 2, uint32_t> links_;
+    std::unique_ptr<unordered_map<const StateObject *, uint32_t>> index_;
+    uint32_t prune_threshold_ = kMinPruneThreshold;
+};
+
 // inheriting from enable_shared_from_this<> adds a method, shared_from_this(), which
 // returns a shared_ptr version of the current object. It requires the object to
 // be created with std::make_shared<> and it MUST NOT be used from the constructor
@@ -91,6 +144,13 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     // Helper to let objects examine their immediate parents without holding the tree lock.
     NodeMap ObjectBindings() const;
 
+    // Drops every link where this object is the parent in O(1), by invalidating them instead of visiting each child.
+    // For objects that remove all their children at once, e.g. a command buffer being reset.
+    void UnlinkChildren() { link_generation_.fetch_add(1, std::memory_order_release); }
+    // Links made by this object as a parent are live while this is unchanged. Objects whose children can also be
+    // unlinked from outside (command buffers by their pool) fold that generation in.
+    virtual uint32_t LinkGeneration() const { return link_generation_.load(std::memory_order_acquire); }
+
   protected:
     template <typename Derived, typename Shared = std::shared_ptr<Derived>>
     static Shared SharedFromThisImpl(Derived *derived) {
@@ -104,23 +164,49 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
 
     // returns a copy of the current set of parents so that they can be walked
     // without the tree lock held. If unlink == true, parent_nodes_ is also cleared.
-    NodeMap GetParentsForInvalidate(bool unlink);
+    NodeList GetParentsForInvalidate(bool unlink);
 
     // Set to true when the API-level object is destroyed, but this object may
     // hang around until its shared_ptr refcount goes to zero.
     std::atomic<bool> destroyed_;
 
   private:
-    ReadLockGuard ReadLockTree() const { return ReadLockGuard(tree_lock_); }
-    WriteLockGuard WriteLockTree() { return WriteLockGuard(tree_lock_); }
+    // The critical sections are a few array operations, so a spin lock is cheaper in space and time than a shared_mutex
+    class TreeLock {
+      public:
+        void lock() {
+            while (locked_.exchange(true, std::memory_order_acquire)) {
+                while (locked_.load(std::memory_order_relaxed)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+        void unlock() { locked_.store(false, std::memory_order_release); }
+
+      private:
+        std::atomic<bool> locked_{false};
+    };
+    std::unique_lock<TreeLock> LockTree() const { return std::unique_lock<TreeLock>(tree_lock_); }
 
     // Set of immediate parent nodes for this object. For an in-use object, the
     // parent nodes should form a tree with the root being a command buffer.
-    NodeMap parent_nodes_;
+    ParentList parent_nodes_;
     // Lock guarding parent_nodes_, this lock MUST NOT be used for other purposes.
-    mutable std::shared_mutex tree_lock_;
+    mutable TreeLock tree_lock_;
+    std::atomic<uint32_t> link_generation_{0};
 };
 
+template <typename Fn>
+bool ParentList::AnyOf(Fn &&fn) const {
+    for (const Link &link : links_) {
+        auto node = LockIfLinked(link);
+        if (node && fn(node)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 class RefcountedStateObject : public StateObject {
   private:
     // Track if command buffer is in-flight
@@ -136,4 +222,27 @@ class RefcountedStateObject : public StateObject {
 
     const VulkanTypedHandle* InUse() const override { return ((in_use_.load() > 0) || StateObject::InUse()) ? &Handle() : nullptr; }
 };
+
+// With deferred_state_destruction, the state objects destroyed by vkDestroy* are released on a background thread. They are
+// already destroyed and unlinked from their parents and children, only freeing them (image layout maps, descriptor
+// storage, create infos) is moved off the application thread. The reclaimer waits for readers of borrowed pointers to the
+// objects before letting go of them, so the last reference is normally dropped on its thread.
+class StateReclaimer {
+  public:
+    StateReclaimer() : thread_(1) {}
+    StateReclaimer(const StateReclaimer&) = delete;
+    StateReclaimer& operator=(const StateReclaimer&) = delete;
+
+    void Retire(std::shared_ptr<StateObject>&& state);
+    // Returns once everything retired so far is released
+    void Flush() { thread_.Wait(); }
+
+  private:
+    void Reclaim();
+
+    std::mutex lock_;
+    std::vector<std::shared_ptr<StateObject>> pending_;
+    // Last, so that the queued reclaims run before pending_ goes away
+    TaskQueue thread_;
+};
 } // namespace vvl
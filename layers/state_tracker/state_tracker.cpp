@@ -19,11 +19,13 @@
  */
 
 #include <algorithm>
+#include <numeric>
 
 #include <vulkan/utility/vk_format_utils.h>
 #include <vulkan/utility/vk_struct_helper.hpp>
 
 #include "containers/custom_containers.h"
+#include "utils/hash_util.h"
 #include "utils/vk_layer_utils.h"
 
 #include "generated/chassis.h"
@@ -136,58 +138,49 @@ VkFormatFeatureFlags2KHR ValidationStateTracker::GetExternalFormatFeaturesANDROI
 
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
-VkFormatFeatureFlags2KHR GetImageFormatFeatures(VkPhysicalDevice physical_device, bool has_format_feature2, bool has_drm_modifiers,
-                                                VkDevice device, VkImage image, VkFormat format, VkImageTiling tiling) {
-    VkFormatFeatureFlags2KHR format_features = 0;
-
+VkFormatFeatureFlags2KHR GetImageFormatFeatures(const vvl::PhysicalDevice &physical_device_state,
+                                                const vvl::FormatTable &format_table, bool has_format_feature2,
+                                                bool has_drm_modifiers, VkDevice device, VkImage image, VkFormat format,
+                                                VkImageTiling tiling) {
     // Add feature support according to Image Format Features (vkspec.html#resources-image-format-features)
     // if format is AHB external format then the features are already set
+    if (tiling != VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
+        return format_table.GetTilingFeatures(format, tiling);
+    }
+
+    // The features of the modifier the image was created with
+    const VkPhysicalDevice physical_device = physical_device_state.PhysDev();
+    VkFormatFeatureFlags2KHR format_features = 0;
+    VkImageDrmFormatModifierPropertiesEXT drm_format_properties = vku::InitStructHelper();
+    DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, &drm_format_properties);
     if (has_format_feature2) {
         VkDrmFormatModifierPropertiesList2EXT fmt_drm_props = vku::InitStructHelper();
         auto fmt_props_3 = vku::InitStruct<VkFormatProperties3KHR>(has_drm_modifiers ? &fmt_drm_props : nullptr);
         VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
-
         DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
 
-        fmt_props_3.linearTilingFeatures |= fmt_props_2.formatProperties.linearTilingFeatures;
-        fmt_props_3.optimalTilingFeatures |= fmt_props_2.formatProperties.optimalTilingFeatures;
-        fmt_props_3.bufferFeatures |= fmt_props_2.formatProperties.bufferFeatures;
-
-        if (tiling == VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
-            VkImageDrmFormatModifierPropertiesEXT drm_format_props = vku::InitStructHelper();
-
-            // Find the image modifier
-            DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, &drm_format_props);
+        std::vector<VkDrmFormatModifierProperties2EXT> drm_mod_props;
+        drm_mod_props.resize(fmt_drm_props.drmFormatModifierCount);
+        fmt_drm_props.pDrmFormatModifierProperties = drm_mod_props.data();
 
-            std::vector<VkDrmFormatModifierProperties2EXT> drm_mod_props;
-            drm_mod_props.resize(fmt_drm_props.drmFormatModifierCount);
-            fmt_drm_props.pDrmFormatModifierProperties = &drm_mod_props[0];
-
-            // Second query to have all the modifiers filled
-            DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
+        // Second query to have all the modifiers filled
+        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
 
-            // Look for the image modifier in the list
-            for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
-                if (fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifier == drm_format_props.drmFormatModifier) {
-                    format_features = fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                    break;
-                }
+        // Look for the image modifier in the list
+        for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
+            if (fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifier == drm_format_properties.drmFormatModifier) {
+                format_features = fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
+                break;
             }
-        } else {
-            format_features =
-                (tiling == VK_IMAGE_TILING_LINEAR) ? fmt_props_3.linearTilingFeatures : fmt_props_3.optimalTilingFeatures;
         }
-    } else if (tiling == VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT) {
-        VkImageDrmFormatModifierPropertiesEXT drm_format_properties = vku::InitStructHelper();
-        DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, &drm_format_properties);
-
+    } else {
         VkFormatProperties2 format_properties_2 = vku::InitStructHelper();
         VkDrmFormatModifierPropertiesListEXT drm_properties_list = vku::InitStructHelper();
         format_properties_2.pNext = (void *)&drm_properties_list;
         DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &format_properties_2);
         std::vector<VkDrmFormatModifierPropertiesEXT> drm_properties;
         drm_properties.resize(drm_properties_list.drmFormatModifierCount);
-        drm_properties_list.pDrmFormatModifierProperties = &drm_properties[0];
+        drm_properties_list.pDrmFormatModifierProperties = drm_properties.data();
         DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &format_properties_2);
 
         for (uint32_t i = 0; i < drm_properties_list.drmFormatModifierCount; i++) {
@@ -196,11 +189,6 @@ VkFormatFeatureFlags2KHR GetImageFormatFeatures(VkPhysicalDevice physical_device
                 break;
             }
         }
-    } else {
-        VkFormatProperties format_properties;
-        DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
-        format_features =
-            (tiling == VK_IMAGE_TILING_LINEAR) ? format_properties.linearTilingFeatures : format_properties.optimalTilingFeatures;
     }
     return format_features;
 }
@@ -225,7 +213,7 @@ void ValidationStateTracker::PostCallRecordCreateImage(VkDevice device, const Vk
         format_features = GetExternalFormatFeaturesANDROID(pCreateInfo->pNext);
     }
     if (format_features == 0) {
-        format_features = GetImageFormatFeatures(physical_device, has_format_feature2,
+        format_features = GetImageFormatFeatures(*physical_device_state, format_table, has_format_feature2,
                                                  IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier), device, *pImage,
                                                  pCreateInfo->format, pCreateInfo->tiling);
     }
@@ -359,8 +347,76 @@ struct BufferAddressInfillUpdateOps {
     const Mapped &insert_value;
 };
 
+std::shared_ptr<const ValidationStateTracker::BufferAddressSnapshot> ValidationStateTracker::GetBufferAddressSnapshot() const {
+    auto snapshot = std::atomic_load(&buffer_address_snapshot_);
+    if (snapshot) {
+        return snapshot;
+    }
+
+    WriteLockGuard guard(buffer_address_lock_);
+    // Another thread may have built it while this one was waiting for the lock
+    snapshot = std::atomic_load(&buffer_address_snapshot_);
+    if (snapshot) {
+        return snapshot;
+    }
+    auto built = std::make_shared<BufferAddressSnapshot>();
+    built->ranges.reserve(buffer_address_map_.size());
+    built->first_buffer.reserve(buffer_address_map_.size() + 1);
+    for (const auto &entry : buffer_address_map_) {
+        built->ranges.push_back(entry.first);
+        built->first_buffer.push_back(static_cast<uint32_t>(built->buffers.size()));
+        built->buffers.insert(built->buffers.end(), entry.second.begin(), entry.second.end());
+    }
+    built->first_buffer.push_back(static_cast<uint32_t>(built->buffers.size()));
+    snapshot = std::move(built);
+    std::atomic_store(&buffer_address_snapshot_, snapshot);
+    return snapshot;
+}
+
+ValidationStateTracker::BufferAddressLookup ValidationStateTracker::GetBuffersByAddress(VkDeviceAddress address) const {
+    auto snapshot = GetBufferAddressSnapshot();
+    const auto &ranges = snapshot->ranges;
+    // Only the last range starting at or before the address can contain it
+    auto range_it = std::upper_bound(ranges.begin(), ranges.end(), address,
+                                     [](VkDeviceAddress addr, const BufferAddressRange &range) { return addr < range.begin; });
+    if (range_it == ranges.begin() || !std::prev(range_it)->includes(address)) {
+        return {};
+    }
+    const size_t index = std::distance(ranges.begin(), std::prev(range_it));
+    const uint32_t first = snapshot->first_buffer[index];
+    const uint32_t count = snapshot->first_buffer[index + 1] - first;
+    const auto buffers = vvl::make_span(snapshot->buffers.data() + first, count);
+    return BufferAddressLookup(std::move(snapshot), buffers);
+}
+
+ValidationStateTracker::BufferAddressBatch ValidationStateTracker::GetBuffersByAddresses(
+    vvl::span<const VkDeviceAddress> addresses) const {
+    BufferAddressBatch batch;
+    batch.snapshot_ = GetBufferAddressSnapshot();
+    batch.buffers_.resize(addresses.size());
+    const auto &snapshot = *batch.snapshot_;
+
+    std::vector<uint32_t> order(addresses.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&addresses](uint32_t a, uint32_t b) { return addresses[a] < addresses[b]; });
+
+    // The addresses only go up, so each search starts where the last one ended
+    auto range_it = snapshot.ranges.begin();
+    for (const uint32_t i : order) {
+        const VkDeviceAddress address = addresses[i];
+        range_it = std::upper_bound(range_it, snapshot.ranges.end(), address,
+                                    [](VkDeviceAddress addr, const BufferAddressRange &range) { return addr < range.begin; });
+        if (range_it != snapshot.ranges.begin() && std::prev(range_it)->includes(address)) {
+            const size_t index = std::distance(snapshot.ranges.begin(), std::prev(range_it));
+            const uint32_t first = snapshot.first_buffer[index];
+            batch.buffers_[i] = vvl::make_span(snapshot.buffers.data() + first, snapshot.first_buffer[index + 1] - first);
+        }
+    }
+    return batch;
+}
+
 std::shared_ptr<vvl::Buffer> ValidationStateTracker::CreateBufferState(VkBuffer buf, const VkBufferCreateInfo *pCreateInfo) {
-    return std::make_shared<vvl::Buffer>(this, buf, pCreateInfo);
+    return MakePooledState<vvl::Buffer>(state_pools_.buffer, this, buf, pCreateInfo);
 }
 
 void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
@@ -380,6 +436,8 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
 
             BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
             sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
+            // Lookups build a new snapshot with this buffer
+            std::atomic_store(&buffer_address_snapshot_, std::shared_ptr<const BufferAddressSnapshot>());
         }
 
         const VkBufferUsageFlags descriptor_buffer_usages =
@@ -401,7 +459,7 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
 std::shared_ptr<vvl::BufferView> ValidationStateTracker::CreateBufferViewState(const std::shared_ptr<vvl::Buffer> &bf,
                                                                                VkBufferView bv, const VkBufferViewCreateInfo *ci,
                                                                                VkFormatFeatureFlags2KHR buf_ff) {
-    return std::make_shared<vvl::BufferView>(bf, bv, ci, buf_ff);
+    return MakePooledState<vvl::BufferView>(state_pools_.buffer_view, bf, bv, ci, buf_ff);
 }
 
 void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo,
@@ -411,17 +469,7 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
 
     auto buffer_state = Get<vvl::Buffer>(pCreateInfo->buffer);
 
-    VkFormatFeatureFlags2KHR buffer_features;
-    if (has_format_feature2) {
-        VkFormatProperties3KHR fmt_props_3 = vku::InitStructHelper();
-        VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
-        DispatchGetPhysicalDeviceFormatProperties2(physical_device, pCreateInfo->format, &fmt_props_2);
-        buffer_features = fmt_props_3.bufferFeatures | fmt_props_2.formatProperties.bufferFeatures;
-    } else {
-        VkFormatProperties format_properties;
-        DispatchGetPhysicalDeviceFormatProperties(physical_device, pCreateInfo->format, &format_properties);
-        buffer_features = format_properties.bufferFeatures;
-    }
+    const VkFormatFeatureFlags2KHR buffer_features = format_table.GetFormatProperties(pCreateInfo->format).bufferFeatures;
 
     Add(CreateBufferViewState(buffer_state, *pView, pCreateInfo, buffer_features));
 }
@@ -429,7 +477,7 @@ void ValidationStateTracker::PostCallRecordCreateBufferView(VkDevice device, con
 std::shared_ptr<vvl::ImageView> ValidationStateTracker::CreateImageViewState(
     const std::shared_ptr<vvl::Image> &image_state, VkImageView iv, const VkImageViewCreateInfo *ci, VkFormatFeatureFlags2KHR ff,
     const VkFilterCubicImageViewImageFormatPropertiesEXT &cubic_props) {
-    return std::make_shared<vvl::ImageView>(image_state, iv, ci, ff, cubic_props);
+    return MakePooledState<vvl::ImageView>(state_pools_.image_view, image_state, iv, ci, ff, cubic_props);
 }
 
 void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo,
@@ -443,7 +491,7 @@ void ValidationStateTracker::PostCallRecordCreateImageView(VkDevice device, cons
         // The ImageView uses same Image's format feature since they share same AHB
         format_features = image_state->format_features;
     } else {
-        format_features = GetImageFormatFeatures(physical_device, has_format_feature2,
+        format_features = GetImageFormatFeatures(*physical_device_state, format_table, has_format_feature2,
                                                  IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier), device,
                                                  image_state->image(), pCreateInfo->format, image_state->createInfo.tiling);
     }
@@ -542,6 +590,7 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
 
                 return false;
             });
+            std::atomic_store(&buffer_address_snapshot_, std::shared_ptr<const BufferAddressSnapshot>());
         }
     }
     Destroy<vvl::Buffer>(buffer);
@@ -619,54 +668,57 @@ VkFormatFeatureFlags2KHR ValidationStateTracker::GetPotentialFormatFeatures(VkFo
     VkFormatFeatureFlags2KHR format_features = 0;
 
     if (format != VK_FORMAT_UNDEFINED) {
-        if (has_format_feature2) {
-            VkDrmFormatModifierPropertiesList2EXT fmt_drm_props = vku::InitStructHelper();
-            auto fmt_props_3 = vku::InitStruct<VkFormatProperties3KHR>(
-                IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier) ? &fmt_drm_props : nullptr);
-            VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_props_3);
+        const VkFormatProperties3KHR fmt_props_3 = format_table.GetFormatProperties(format);
+        format_features |= fmt_props_3.linearTilingFeatures;
+        format_features |= fmt_props_3.optimalTilingFeatures;
 
-            DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
+        if (IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
+            format_features |= GetDrmFormatModifierTilingFeatures(format);
+        }
+    }
+
+    return format_features;
+}
 
-            format_features |= fmt_props_2.formatProperties.linearTilingFeatures;
-            format_features |= fmt_props_2.formatProperties.optimalTilingFeatures;
+// Each format takes two queries of the driver, and YCbCr conversion and attachment validation ask for the same few formats
+// again and again, so the union is only computed once per format
+VkFormatFeatureFlags2KHR ValidationStateTracker::GetDrmFormatModifierTilingFeatures(VkFormat format) const {
+    const auto cached = drm_format_modifier_features_.find(static_cast<uint32_t>(format));
+    if (cached != drm_format_modifier_features_.end()) {
+        return cached->second;
+    }
 
-            format_features |= fmt_props_3.linearTilingFeatures;
-            format_features |= fmt_props_3.optimalTilingFeatures;
+    VkFormatFeatureFlags2KHR format_features = 0;
+    if (has_format_feature2) {
+        VkDrmFormatModifierPropertiesList2EXT fmt_drm_props = vku::InitStructHelper();
+        VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_drm_props);
 
-            if (IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
-                std::vector<VkDrmFormatModifierProperties2EXT> drm_properties;
-                drm_properties.resize(fmt_drm_props.drmFormatModifierCount);
-                fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
-                DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
+        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
 
-                for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
-                    format_features |= fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                }
-            }
-        } else {
-            VkFormatProperties format_properties;
-            DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
-            format_features |= format_properties.linearTilingFeatures;
-            format_features |= format_properties.optimalTilingFeatures;
+        std::vector<VkDrmFormatModifierProperties2EXT> drm_properties;
+        drm_properties.resize(fmt_drm_props.drmFormatModifierCount);
+        fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
+        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
 
-            if (IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier)) {
-                VkDrmFormatModifierPropertiesListEXT fmt_drm_props = vku::InitStructHelper();
-                VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_drm_props);
+        for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
+            format_features |= fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
+        }
+    } else {
+        VkDrmFormatModifierPropertiesListEXT fmt_drm_props = vku::InitStructHelper();
+        VkFormatProperties2 fmt_props_2 = vku::InitStructHelper(&fmt_drm_props);
 
-                DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
+        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
 
-                std::vector<VkDrmFormatModifierPropertiesEXT> drm_properties;
-                drm_properties.resize(fmt_drm_props.drmFormatModifierCount);
-                fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
-                DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
+        std::vector<VkDrmFormatModifierPropertiesEXT> drm_properties;
+        drm_properties.resize(fmt_drm_props.drmFormatModifierCount);
+        fmt_drm_props.pDrmFormatModifierProperties = drm_properties.data();
+        DispatchGetPhysicalDeviceFormatProperties2(physical_device, format, &fmt_props_2);
 
-                for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
-                    format_features |= fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
-                }
-            }
+        for (uint32_t i = 0; i < fmt_drm_props.drmFormatModifierCount; i++) {
+            format_features |= fmt_drm_props.pDrmFormatModifierProperties[i].drmFormatModifierTilingFeatures;
         }
     }
-
+    drm_format_modifier_features_.insert(static_cast<uint32_t>(format), format_features);
     return format_features;
 }
 
@@ -695,6 +747,17 @@ std::shared_ptr<vvl::Queue> ValidationStateTracker::CreateQueue(VkQueue q, uint3
 void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     GetEnabledDeviceFeatures(pCreateInfo, &enabled_features, api_version);
 
+    // The queues created below pick it up
+    if (enabled[shared_queue_retirement]) {
+        queue_retire_worker = std::make_unique<vvl::QueueRetireWorker>();
+    }
+
+    // The GPU-AV and debug printf state objects free device resources when they go away, they stay on the destroying thread
+    if (enabled[deferred_state_destruction] && container_type != LayerObjectTypeGpuAssisted &&
+        container_type != LayerObjectTypeDebugPrintf) {
+        state_reclaimer = std::make_unique<vvl::StateReclaimer>();
+    }
+
     const auto *device_group_ci = vku::FindStructInPNextChain<VkDeviceGroupDeviceCreateInfo>(pCreateInfo->pNext);
     if (device_group_ci) {
         physical_device_count = device_group_ci->physicalDeviceCount;
@@ -703,12 +766,19 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
                 1;  // see https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/VkDeviceGroupDeviceCreateInfo.html
         }
         device_group_create_info = *device_group_ci;
+        // The application's array only has to live through vkCreateDevice, keep a copy for the device group surface checks
+        device_group_physical_devices.assign(device_group_ci->pPhysicalDevices,
+                                             device_group_ci->pPhysicalDevices + device_group_ci->physicalDeviceCount);
+        device_group_create_info.pPhysicalDevices = device_group_physical_devices.data();
+        device_group_create_info.pNext = nullptr;
     } else {
         device_group_create_info = vku::InitStructHelper();
         device_group_create_info.physicalDeviceCount = 1;  // see previous VkDeviceGroupDeviceCreateInfo link
         device_group_create_info.pPhysicalDevices = &physical_device;
         physical_device_count = 1;
     }
+    // A group has at most VK_MAX_DEVICE_GROUP_SIZE (32) physical devices, which 1 << 32 would not cover
+    physical_device_mask = physical_device_count >= 32 ? ~0u : (1u << physical_device_count) - 1;
 
     // Store physical device properties and physical device mem limits into CoreChecks structs
     DispatchGetPhysicalDeviceMemoryProperties(physical_device, &phys_dev_mem_props);
@@ -739,6 +809,9 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
             phys_dev_extensions.find(VK_EXT_IMAGE_ROBUSTNESS_EXTENSION_NAME) != phys_dev_extensions.end();
     }
 
+    format_table.Init(*physical_device_state, has_format_feature2,
+                      [this](VkFormat format) { return IsValidEnumValue(format); });
+
     const auto &dev_ext = device_extensions;
     auto *phys_dev_props = &phys_dev_ext_props;
 
@@ -1060,10 +1133,65 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
     }
 }
 
+// Map node, shared_ptr control block and the state object. Objects of a derived state class are counted at the base class size.
+template <typename Map>
+static void AddStateMapFootprint(vvl::MemoryFootprint &footprint, const char *name, const Map &map) {
+    using State = typename Map::element_type;
+    constexpr size_t kControlBlock = 2 * sizeof(void *) + 2 * sizeof(uint32_t);
+    constexpr size_t kObjectBytes = sizeof(State) + kControlBlock + vvl::MemoryFootprint::NodeBytes<std::pair<uint64_t, void *>>(1);
+    const size_t count = map.size();
+    if (count != 0) {
+        footprint.Add(name, count, count * kObjectBytes);
+    }
+}
+
+void ValidationStateTracker::CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const {
+    AddStateMapFootprint(footprint, "VkQueue", queue_map_);
+    AddStateMapFootprint(footprint, "VkAccelerationStructureNV", acceleration_structure_nv_map_);
+    AddStateMapFootprint(footprint, "VkRenderPass", render_pass_map_);
+    AddStateMapFootprint(footprint, "VkDescriptorSetLayout", descriptor_set_layout_map_);
+    AddStateMapFootprint(footprint, "VkSampler", sampler_map_);
+    AddStateMapFootprint(footprint, "VkImageView", image_view_map_);
+    AddStateMapFootprint(footprint, "VkImage", image_map_);
+    AddStateMapFootprint(footprint, "VkBufferView", buffer_view_map_);
+    AddStateMapFootprint(footprint, "VkBuffer", buffer_map_);
+    AddStateMapFootprint(footprint, "VkPipelineCache", pipeline_cache_map_);
+    AddStateMapFootprint(footprint, "VkPipeline", pipeline_map_);
+    AddStateMapFootprint(footprint, "VkShaderEXT", shader_object_map_);
+    AddStateMapFootprint(footprint, "VkDeviceMemory", mem_obj_map_);
+    AddStateMapFootprint(footprint, "VkFramebuffer", frame_buffer_map_);
+    AddStateMapFootprint(footprint, "VkShaderModule", shader_module_map_);
+    AddStateMapFootprint(footprint, "VkDescriptorUpdateTemplate", desc_template_map_);
+    AddStateMapFootprint(footprint, "VkSwapchainKHR", swapchain_map_);
+    AddStateMapFootprint(footprint, "VkDescriptorPool", descriptor_pool_map_);
+    AddStateMapFootprint(footprint, "VkDescriptorSet", descriptor_set_map_);
+    AddStateMapFootprint(footprint, "VkCommandBuffer", command_buffer_map_);
+    AddStateMapFootprint(footprint, "VkCommandPool", command_pool_map_);
+    AddStateMapFootprint(footprint, "VkPipelineLayout", pipeline_layout_map_);
+    AddStateMapFootprint(footprint, "VkFence", fence_map_);
+    AddStateMapFootprint(footprint, "VkQueryPool", query_pool_map_);
+    AddStateMapFootprint(footprint, "VkSemaphore", semaphore_map_);
+    AddStateMapFootprint(footprint, "VkEvent", event_map_);
+    AddStateMapFootprint(footprint, "VkSamplerYcbcrConversion", sampler_ycbcr_conversion_map_);
+    AddStateMapFootprint(footprint, "VkVideoSessionKHR", video_session_map_);
+    AddStateMapFootprint(footprint, "VkVideoSessionParametersKHR", video_session_parameters_map_);
+    AddStateMapFootprint(footprint, "VkAccelerationStructureKHR", acceleration_structure_khr_map_);
+
+    // Other threads may be recording, so each command buffer is read under its own lock. The map is copied first, a
+    // recording thread holding its command buffer lock may be waiting for a bucket lock of the map.
+    for (const auto &entry : command_buffer_map_.snapshot()) {
+        auto guard = entry.second->ReadLock();
+        entry.second->CollectMemoryFootprint(footprint);
+    }
+}
+
 void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                                         const RecordObject &record_obj) {
     if (!device) return;
 
+    // Everything destroyed before is released before the device state goes away
+    state_reclaimer.reset();
+
     command_pool_map_.clear();
     assert(command_buffer_map_.empty());
     pipeline_map_.clear();
@@ -1092,6 +1220,7 @@ void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const V
         entry.second->Destroy();
     }
     queue_map_.clear();
+    queue_retire_worker.reset();
 }
 
 void ValidationStateTracker::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
@@ -1251,35 +1380,44 @@ void ValidationStateTracker::PreCallRecordQueueBindSparse(VkQueue queue, uint32_
 
     uint64_t early_retire_seq = 0;
 
+    // The binds to one resource are applied together, they usually come from a handful of memory objects
+    std::vector<vvl::BindableMemoryTracker::SparseBind> sparse_binds;
+    auto gather_binds = [this, &sparse_binds](const VkSparseMemoryBind *binds, uint32_t bind_count) {
+        sparse_binds.clear();
+        sparse_binds.reserve(bind_count);
+        VkDeviceMemory last_memory = VK_NULL_HANDLE;
+        std::shared_ptr<vvl::DeviceMemory> last_mem_state;
+        for (uint32_t k = 0; k < bind_count; k++) {
+            const VkSparseMemoryBind &sparse_binding = binds[k];
+            if (sparse_binding.memory != last_memory) {
+                last_memory = sparse_binding.memory;
+                last_mem_state = Get<vvl::DeviceMemory>(last_memory);
+            }
+            sparse_binds.push_back(
+                {last_mem_state, sparse_binding.memoryOffset, sparse_binding.resourceOffset, sparse_binding.size});
+        }
+    };
+
     for (uint32_t bind_idx = 0; bind_idx < bindInfoCount; ++bind_idx) {
         const VkBindSparseInfo &bind_info = pBindInfo[bind_idx];
         // Track objects tied to memory
         for (uint32_t j = 0; j < bind_info.bufferBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pBufferBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pBufferBinds[j].pBinds[k];
-                auto buffer_state = Get<vvl::Buffer>(bind_info.pBufferBinds[j].buffer);
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (buffer_state) {
-                    buffer_state->BindMemory(buffer_state.get(), mem_state, sparse_binding.memoryOffset,
-                                             sparse_binding.resourceOffset, sparse_binding.size);
-                }
+            auto buffer_state = Get<vvl::Buffer>(bind_info.pBufferBinds[j].buffer);
+            if (buffer_state) {
+                gather_binds(bind_info.pBufferBinds[j].pBinds, bind_info.pBufferBinds[j].bindCount);
+                buffer_state->BindSparseMemory(buffer_state.get(), sparse_binds);
             }
         }
         for (uint32_t j = 0; j < bind_info.imageOpaqueBindCount; j++) {
-            for (uint32_t k = 0; k < bind_info.pImageOpaqueBinds[j].bindCount; k++) {
-                auto sparse_binding = bind_info.pImageOpaqueBinds[j].pBinds[k];
-                auto image_state = Get<vvl::Image>(bind_info.pImageOpaqueBinds[j].image);
-                auto mem_state = Get<vvl::DeviceMemory>(sparse_binding.memory);
-                if (image_state) {
-                    // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
-                    // See: VUID-vkGetImageSubresourceLayout-image-09432
-                    if (!image_state->fragment_encoder) {
-                        image_state->fragment_encoder =
-                            std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
-                    }
-                    image_state->BindMemory(image_state.get(), mem_state, sparse_binding.memoryOffset,
-                                            sparse_binding.resourceOffset, sparse_binding.size);
+            auto image_state = Get<vvl::Image>(bind_info.pImageOpaqueBinds[j].image);
+            if (image_state) {
+                // An Android special image cannot get VkSubresourceLayout until the image binds a memory.
+                // See: VUID-vkGetImageSubresourceLayout-image-09432
+                if (!image_state->fragment_encoder) {
+                    image_state->fragment_encoder = std::make_unique<const subresource_adapter::ImageRangeEncoder>(*image_state);
                 }
+                gather_binds(bind_info.pImageOpaqueBinds[j].pBinds, bind_info.pImageOpaqueBinds[j].bindCount);
+                image_state->BindSparseMemory(image_state.get(), sparse_binds);
             }
         }
         for (uint32_t j = 0; j < bind_info.imageBindCount; j++) {
@@ -1389,10 +1527,17 @@ void ValidationStateTracker::PostCallRecordWaitForFences(VkDevice device, uint32
 
     // When we know that all fences are complete we can clean/remove their CBs
     if ((VK_TRUE == waitAll) || (1 == fenceCount)) {
+        // Notify all the queues before waiting on any, so they retire in parallel rather than one after the other
+        small_vector<std::shared_ptr<vvl::Fence>, 8, uint32_t> fence_states(fenceCount);
+        for (uint32_t i = 0; i < fenceCount; i++) {
+            fence_states[i] = Get<vvl::Fence>(pFences[i]);
+            if (fence_states[i]) {
+                fence_states[i]->Notify();
+            }
+        }
         for (uint32_t i = 0; i < fenceCount; i++) {
-            auto fence_state = Get<vvl::Fence>(pFences[i]);
-            if (fence_state) {
-                fence_state->NotifyAndWait(record_obj.location.dot(vvl::Field::pFences, i));
+            if (fence_states[i]) {
+                fence_states[i]->NotifyAndWait(record_obj.location.dot(vvl::Field::pFences, i));
             }
         }
     }
@@ -1425,10 +1570,17 @@ void ValidationStateTracker::PostCallRecordWaitSemaphores(VkDevice device, const
     // the application calls vkGetSemaphoreCounterValue() on each of them.
     if ((pWaitInfo->flags & VK_SEMAPHORE_WAIT_ANY_BIT) == 0 || pWaitInfo->semaphoreCount == 1) {
         const Location wait_info_loc = record_obj.location.dot(vvl::Field::pWaitInfo);
+        // Notify all the signaling queues before waiting on any, so they retire in parallel rather than one after the other
+        small_vector<std::shared_ptr<vvl::Semaphore>, 8, uint32_t> semaphore_states(pWaitInfo->semaphoreCount);
         for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; i++) {
-            auto semaphore_state = Get<vvl::Semaphore>(pWaitInfo->pSemaphores[i]);
-            if (semaphore_state) {
-                semaphore_state->NotifyAndWait(wait_info_loc.dot(vvl::Field::pValues, i), pWaitInfo->pValues[i]);
+            semaphore_states[i] = Get<vvl::Semaphore>(pWaitInfo->pSemaphores[i]);
+            if (semaphore_states[i]) {
+                semaphore_states[i]->Notify(pWaitInfo->pValues[i]);
+            }
+        }
+        for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; i++) {
+            if (semaphore_states[i]) {
+                semaphore_states[i]->NotifyAndWait(wait_info_loc.dot(vvl::Field::pValues, i), pWaitInfo->pValues[i]);
             }
         }
     }
@@ -1634,6 +1786,7 @@ void ValidationStateTracker::PostCallRecordCmdBindShadersEXT(VkCommandBuffer com
                                                              const VkShaderStageFlagBits *pStages, const VkShaderEXT *pShaders,
                                                              const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyPipeline);
     for (uint32_t i = 0; i < stageCount; ++i) {
         vvl::ShaderObject *shader_object_state = nullptr;
         if (pShaders && pShaders[i] != VK_NULL_HANDLE) {
@@ -1812,6 +1965,38 @@ std::shared_ptr<vvl::Pipeline> ValidationStateTracker::CreateGraphicsPipelineSta
     return std::make_shared<vvl::Pipeline>(this, pCreateInfo, std::move(render_pass), std::move(layout), csm_states);
 }
 
+std::shared_ptr<const vvl::PipelineLayout> ValidationStateTracker::GetMergedPipelineLayout(
+    const std::array<std::shared_ptr<const vvl::PipelineLayout>, 3> &layouts) const {
+    const std::array<const vvl::PipelineLayout *, 3> key_data = {layouts[0].get(), layouts[1].get(), layouts[2].get()};
+    const uint64_t key = hash_util::Hash64(key_data.data(), sizeof(key_data));
+
+    auto &cache = merged_pipeline_layouts_;
+    std::lock_guard<std::mutex> guard(cache.lock);
+    auto &entry = cache.entries[key];
+    // The sources are alive, so a weak reference that still locks to the same address is the same layout
+    bool same_sources = true;
+    for (size_t i = 0; i < layouts.size(); ++i) {
+        same_sources &= entry.sources[i].lock().get() == key_data[i];
+    }
+    if (same_sources) {
+        if (auto merged = entry.merged.lock()) {
+            return merged;
+        }
+    }
+
+    // Merging only copies pointers to the set layouts, so it is cheap enough to do under the lock
+    auto merged = std::make_shared<vvl::PipelineLayout>(key_data);
+    entry.sources = {layouts[0], layouts[1], layouts[2]};
+    entry.merged = merged;
+    if (++cache.adds_since_prune >= MergedPipelineLayouts::kPruneInterval) {
+        cache.adds_since_prune = 0;
+        for (auto it = cache.entries.begin(); it != cache.entries.end();) {
+            it = it->second.merged.expired() ? cache.entries.erase(it) : std::next(it);
+        }
+    }
+    return merged;
+}
+
 bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                                     const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                                     const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
@@ -1993,7 +2178,7 @@ void ValidationStateTracker::PostCallRecordCreateRayTracingPipelinesKHR(VkDevice
 }
 
 std::shared_ptr<vvl::Sampler> ValidationStateTracker::CreateSamplerState(VkSampler s, const VkSamplerCreateInfo *ci) {
-    return std::make_shared<vvl::Sampler>(s, ci);
+    return MakePooledState<vvl::Sampler>(state_pools_.sampler, s, ci);
 }
 
 void ValidationStateTracker::PostCallRecordCreateSampler(VkDevice device, const VkSamplerCreateInfo *pCreateInfo,
@@ -2038,7 +2223,7 @@ std::shared_ptr<vvl::DescriptorPool> ValidationStateTracker::CreateDescriptorPoo
 std::shared_ptr<vvl::DescriptorSet> ValidationStateTracker::CreateDescriptorSet(
     VkDescriptorSet set, vvl::DescriptorPool *pool, const std::shared_ptr<vvl::DescriptorSetLayout const> &layout,
     uint32_t variable_count) {
-    return std::make_shared<vvl::DescriptorSet>(set, pool, layout, variable_count, this);
+    return MakePooledState<vvl::DescriptorSet>(state_pools_.descriptor_set, set, pool, layout, variable_count, this);
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateInfo,
@@ -2094,6 +2279,13 @@ void ValidationStateTracker::PreCallRecordFreeDescriptorSets(VkDevice device, Vk
 
 void ValidationStateTracker::PerformUpdateDescriptorSets(uint32_t write_count, const VkWriteDescriptorSet *p_wds,
                                                          uint32_t copy_count, const VkCopyDescriptorSet *p_cds) {
+    // The sets updated, in order to apply the parent links queued by their descriptors once all the updates are done
+    small_vector<std::shared_ptr<vvl::DescriptorSet>, 4, uint32_t> updated_sets;
+    auto add_updated_set = [&updated_sets](std::shared_ptr<vvl::DescriptorSet> &&set_node) {
+        if (updated_sets.empty() || updated_sets.back() != set_node) {
+            updated_sets.emplace_back(std::move(set_node));
+        }
+    };
     // Write updates first
     uint32_t i = 0;
     for (i = 0; i < write_count; ++i) {
@@ -2101,6 +2293,7 @@ void ValidationStateTracker::PerformUpdateDescriptorSets(uint32_t write_count, c
         auto set_node = Get<vvl::DescriptorSet>(dest_set);
         if (set_node) {
             set_node->PerformWriteUpdate(p_wds[i]);
+            add_updated_set(std::move(set_node));
         }
     }
     // Now copy updates
@@ -2111,8 +2304,14 @@ void ValidationStateTracker::PerformUpdateDescriptorSets(uint32_t write_count, c
         auto dst_node = Get<vvl::DescriptorSet>(dst_set);
         if (src_node && dst_node) {
             dst_node->PerformCopyUpdate(p_cds[i], *src_node);
+            add_updated_set(std::move(dst_node));
         }
     }
+    // A set that is not consecutive in the updates is in the list more than once, and has nothing left to flush after the
+    // first time
+    for (auto &set_node : updated_sets) {
+        set_node->FlushParentLinks();
+    }
 }
 
 void ValidationStateTracker::PreCallRecordUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
@@ -2166,7 +2365,7 @@ void ValidationStateTracker::PreCallRecordCmdBindPipeline(VkCommandBuffer comman
                                                           VkPipeline pipeline, const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     assert(cb_state);
-    cb_state->RecordCmd(record_obj.location.function);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyPipeline);
 
     auto pipe_state = Get<vvl::Pipeline>(pipeline);
     if (VK_PIPELINE_BIND_POINT_GRAPHICS == pipelineBindPoint) {
@@ -2639,7 +2838,7 @@ void ValidationStateTracker::PreCallRecordCmdBindDescriptorSets(VkCommandBuffer
     if (!cb_state || !pipeline_layout) {
         return;
     }
-    cb_state->RecordCmd(record_obj.location.function);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyDescriptorSets);
 
     std::shared_ptr<vvl::DescriptorSet> no_push_desc;
 
@@ -2655,7 +2854,7 @@ void ValidationStateTracker::PreCallRecordCmdBindDescriptorSets2KHR(VkCommandBuf
     if (!cb_state || !pipeline_layout) {
         return;
     }
-    cb_state->RecordCmd(record_obj.location.function);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyDescriptorSets);
 
     std::shared_ptr<vvl::DescriptorSet> no_push_desc;
 
@@ -2712,6 +2911,7 @@ void ValidationStateTracker::PreCallRecordCmdBindDescriptorBuffersEXT(VkCommandB
                                                                       const VkDescriptorBufferBindingInfoEXT *pBindingInfos,
                                                                       const RecordObject &record_obj) {
     auto cb_state = Get<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyDescriptorSets);
 
     cb_state->descriptor_buffer_binding_info.resize(bufferCount);
 
@@ -2722,6 +2922,7 @@ void ValidationStateTracker::PreCallRecordCmdSetDescriptorBufferOffsetsEXT(
     VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet,
     uint32_t setCount, const uint32_t *pBufferIndices, const VkDeviceSize *pOffsets, const RecordObject &record_obj) {
     auto cb_state = Get<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyDescriptorSets);
     auto pipeline_layout = Get<vvl::PipelineLayout>(layout);
 
     cb_state->UpdateLastBoundDescriptorBuffers(pipelineBindPoint, *pipeline_layout, firstSet, setCount, pBufferIndices, pOffsets);
@@ -2731,6 +2932,7 @@ void ValidationStateTracker::PreCallRecordCmdSetDescriptorBufferOffsets2EXT(
     VkCommandBuffer commandBuffer, const VkSetDescriptorBufferOffsetsInfoEXT *pSetDescriptorBufferOffsetsInfo,
     const RecordObject &record_obj) {
     auto cb_state = Get<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyDescriptorSets);
     auto pipeline_layout = Get<vvl::PipelineLayout>(pSetDescriptorBufferOffsetsInfo->layout);
 
     if (IsStageInPipelineBindPoint(pSetDescriptorBufferOffsetsInfo->stageFlags, VK_PIPELINE_BIND_POINT_GRAPHICS)) {
@@ -2758,7 +2960,7 @@ void ValidationStateTracker::PostCallRecordCmdPushConstants(VkCommandBuffer comm
                                                             const void *pValues, const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     if (cb_state) {
-        cb_state->RecordCmd(record_obj.location.function);
+        cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyPushConstants);
         auto layout_state = Get<vvl::PipelineLayout>(layout);
         cb_state->ResetPushConstantDataIfIncompatible(layout_state.get());
 
@@ -2773,7 +2975,7 @@ void ValidationStateTracker::PostCallRecordCmdPushConstants2KHR(VkCommandBuffer
                                                                 const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
     if (cb_state) {
-        cb_state->RecordCmd(record_obj.location.function);
+        cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyPushConstants);
         auto layout_state = Get<vvl::PipelineLayout>(pPushConstantsInfo->layout);
         cb_state->ResetPushConstantDataIfIncompatible(layout_state.get());
 
@@ -2786,10 +2988,11 @@ void ValidationStateTracker::PostCallRecordCmdPushConstants2KHR(VkCommandBuffer
 
 void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                              VkIndexType indexType, const RecordObject &record_obj) {
+    auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyVertexInput);
     if (buffer == VK_NULL_HANDLE) {
         return;  // allowed in maintenance6
     }
-    auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
 
     cb_state->index_buffer_binding = IndexBufferBinding(Get<vvl::Buffer>(buffer), offset, indexType);
 
@@ -2802,10 +3005,11 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer(VkCommandBuffer com
 void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                                                  VkDeviceSize offset, VkDeviceSize size, VkIndexType indexType,
                                                                  const RecordObject &record_obj) {
+    auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyVertexInput);
     if (buffer == VK_NULL_HANDLE) {
         return;  // allowed in maintenance6
     }
-    auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
 
     cb_state->index_buffer_binding = IndexBufferBinding(Get<vvl::Buffer>(buffer), size, offset, indexType);
 
@@ -2819,7 +3023,7 @@ void ValidationStateTracker::PreCallRecordCmdBindVertexBuffers(VkCommandBuffer c
                                                                uint32_t bindingCount, const VkBuffer *pBuffers,
                                                                const VkDeviceSize *pOffsets, const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
-    cb_state->RecordCmd(record_obj.location.function);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyVertexInput);
 
     uint32_t end = firstBinding + bindingCount;
     if (cb_state->current_vertex_buffer_binding_info.vertex_buffer_bindings.size() < end) {
@@ -3559,6 +3763,10 @@ void ValidationStateTracker::PostCallRecordCreateEvent(VkDevice device, const Vk
 void ValidationStateTracker::RecordCreateSwapchainState(VkResult result, const VkSwapchainCreateInfoKHR *pCreateInfo,
                                                         VkSwapchainKHR *pSwapchain, std::shared_ptr<vvl::Surface> &&surface_state,
                                                         vvl::Swapchain *old_swapchain_state) {
+    // A swapchain is recreated when the surface changed, what was cached from the queries may not hold anymore
+    if (old_swapchain_state && surface_state) {
+        surface_state->InvalidateCapabilities();
+    }
     if (VK_SUCCESS == result) {
         if (surface_state->swapchain) {
             surface_state->RemoveParent(surface_state->swapchain);
@@ -3651,6 +3859,9 @@ void ValidationStateTracker::PostCallRecordQueuePresentKHR(VkQueue queue, const
         // Note: this is imperfect, in that we can get confused about what did or didn't succeed-- but if the app does that, it's
         // confused itself just as much.
         auto local_result = pPresentInfo->pResults ? pPresentInfo->pResults[i] : record_obj.result;
+        if (local_result == VK_ERROR_OUT_OF_DATE_KHR) {
+            InvalidateSurfaceCapabilities(pPresentInfo->pSwapchains[i]);
+        }
         if (local_result != VK_SUCCESS && local_result != VK_SUBOPTIMAL_KHR) continue;  // this present didn't actually happen.
         // Mark the image as having been released to the WSI
         auto swapchain_data = Get<vvl::Swapchain>(pPresentInfo->pSwapchains[i]);
@@ -3684,6 +3895,13 @@ void ValidationStateTracker::PostCallRecordCreateSharedSwapchainsKHR(VkDevice de
     }
 }
 
+void ValidationStateTracker::InvalidateSurfaceCapabilities(VkSwapchainKHR swapchain) {
+    auto swapchain_data = Get<vvl::Swapchain>(swapchain);
+    if (swapchain_data && swapchain_data->surface) {
+        swapchain_data->surface->InvalidateCapabilities();
+    }
+}
+
 void ValidationStateTracker::RecordAcquireNextImageState(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
                                                          VkSemaphore semaphore, VkFence fence, uint32_t *pImageIndex,
                                                          vvl::Func command) {
@@ -3715,12 +3933,18 @@ void ValidationStateTracker::RecordAcquireNextImageState(VkDevice device, VkSwap
 void ValidationStateTracker::PostCallRecordAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
                                                                VkSemaphore semaphore, VkFence fence, uint32_t *pImageIndex,
                                                                const RecordObject &record_obj) {
+    if (record_obj.result == VK_ERROR_OUT_OF_DATE_KHR) {
+        InvalidateSurfaceCapabilities(swapchain);
+    }
     if ((VK_SUCCESS != record_obj.result) && (VK_SUBOPTIMAL_KHR != record_obj.result)) return;
     RecordAcquireNextImageState(device, swapchain, timeout, semaphore, fence, pImageIndex, record_obj.location.function);
 }
 
 void ValidationStateTracker::PostCallRecordAcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR *pAcquireInfo,
                                                                 uint32_t *pImageIndex, const RecordObject &record_obj) {
+    if (record_obj.result == VK_ERROR_OUT_OF_DATE_KHR) {
+        InvalidateSurfaceCapabilities(pAcquireInfo->swapchain);
+    }
     if ((VK_SUCCESS != record_obj.result) && (VK_SUBOPTIMAL_KHR != record_obj.result)) return;
     RecordAcquireNextImageState(device, pAcquireInfo->swapchain, pAcquireInfo->timeout, pAcquireInfo->semaphore,
                                 pAcquireInfo->fence, pImageIndex, record_obj.location.function);
@@ -4059,23 +4283,22 @@ void ValidationStateTracker::PreCallRecordCmdBeginDebugUtilsLabelEXT(VkCommandBu
                                                                      const VkDebugUtilsLabelEXT *pLabelInfo,
                                                                      const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
-    cb_state->RecordCmd(record_obj.location.function);
-    BeginCmdDebugUtilsLabel(report_data, commandBuffer, pLabelInfo);
+    cb_state->RecordCmd(record_obj.location.function, 0);
+    cb_state->debug_label_state->Begin(pLabelInfo);
 }
 
 void ValidationStateTracker::PostCallRecordCmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
-    cb_state->RecordCmd(record_obj.location.function);
-    EndCmdDebugUtilsLabel(report_data, commandBuffer);
+    cb_state->RecordCmd(record_obj.location.function, 0);
+    cb_state->debug_label_state->End();
 }
 
 void ValidationStateTracker::PreCallRecordCmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer,
                                                                       const VkDebugUtilsLabelEXT *pLabelInfo,
                                                                       const RecordObject &record_obj) {
-    InsertCmdDebugUtilsLabel(report_data, commandBuffer, pLabelInfo);
-
     auto cb_state = GetWrite<vvl::CommandBuffer>(commandBuffer);
-    cb_state->RecordCmd(record_obj.location.function);
+    cb_state->RecordCmd(record_obj.location.function, 0);
+    cb_state->debug_label_state->Insert(pLabelInfo);
     // Squirrel away an easily accessible copy.
     cb_state->debug_label = LoggingLabel(pLabelInfo);
 }
@@ -4110,9 +4333,9 @@ void ValidationStateTracker::PostCallRecordAcquireProfilingLockKHR(VkDevice devi
 
 void ValidationStateTracker::PostCallRecordReleaseProfilingLockKHR(VkDevice device, const RecordObject &record_obj) {
     performance_lock_acquired = false;
-    for (auto &cmd_buffer : command_buffer_map_.snapshot()) {
-        cmd_buffer.second->performance_lock_released = true;
-    }
+    command_buffer_map_.for_each([](const VkCommandBuffer &, const std::shared_ptr<vvl::CommandBuffer> &cb_state) {
+        cb_state->performance_lock_released = true;
+    });
 }
 
 void ValidationStateTracker::PreCallRecordDestroyDescriptorUpdateTemplate(VkDevice device,
@@ -4135,7 +4358,8 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplate(VkDevi
                                                                           VkDescriptorUpdateTemplate *pDescriptorUpdateTemplate,
                                                                           const RecordObject &record_obj) {
     if (VK_SUCCESS != record_obj.result) return;
-    Add(std::make_shared<vvl::DescriptorUpdateTemplate>(*pDescriptorUpdateTemplate, pCreateInfo));
+    auto layout_state = Get<vvl::DescriptorSetLayout>(pCreateInfo->descriptorSetLayout);
+    Add(std::make_shared<vvl::DescriptorUpdateTemplate>(*pDescriptorUpdateTemplate, pCreateInfo, layout_state.get()));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplateKHR(
@@ -4174,7 +4398,7 @@ void ValidationStateTracker::PreCallRecordCmdPushDescriptorSetWithTemplateKHR(Vk
         return;
     }
 
-    cb_state->RecordCmd(record_obj.location.function);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyDescriptorSets);
     auto dsl = layout_data->GetDsl(set);
     const auto &template_ci = template_state->create_info;
     // Decode the template into a set of write updates
@@ -4195,7 +4419,7 @@ void ValidationStateTracker::PreCallRecordCmdPushDescriptorSetWithTemplate2KHR(
         return;
     }
 
-    cb_state->RecordCmd(record_obj.location.function);
+    cb_state->RecordCmd(record_obj.location.function, kActionStateDirtyDescriptorSets);
     auto dsl = layout_data->GetDsl(pPushDescriptorSetWithTemplateInfo->set);
     const auto &template_ci = template_state->create_info;
     // Decode the template into a set of write updates
@@ -4343,17 +4567,9 @@ void ValidationStateTracker::PostCallRecordResetQueryPool(VkDevice device, VkQue
     auto query_pool_state = Get<vvl::QueryPool>(queryPool);
     if (!query_pool_state) return;
 
-    // Reset the state of existing entries.
+    // Reset the state of existing entries, of all the performance passes.
     const uint32_t max_query_count = std::min(queryCount, query_pool_state->createInfo.queryCount - firstQuery);
-    for (uint32_t i = 0; i < max_query_count; ++i) {
-        auto query_index = firstQuery + i;
-        query_pool_state->SetQueryState(query_index, 0, QUERYSTATE_RESET);
-        if (query_pool_state->createInfo.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
-            for (uint32_t pass_index = 0; pass_index < query_pool_state->n_performance_passes; pass_index++) {
-                query_pool_state->SetQueryState(query_index, pass_index, QUERYSTATE_RESET);
-            }
-        }
-    }
+    query_pool_state->SetQueryStates(firstQuery, max_query_count, 0, QUERYSTATE_RESET);
 }
 
 void ValidationStateTracker::PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet,
@@ -4627,7 +4843,7 @@ void ValidationStateTracker::PreCallRecordCreateShaderModule(VkDevice device, co
     }
 
     create_shader_module_api_state *csm_state = static_cast<create_shader_module_api_state *>(csm_state_data);
-    csm_state->module_state = std::make_shared<spirv::Module>(pCreateInfo->codeSize, pCreateInfo->pCode);
+    csm_state->module_state = spirv::Module::Create(pCreateInfo->codeSize, pCreateInfo->pCode, spirv_parsed_cache_);
     if (csm_state->module_state && csm_state->module_state->static_data_.has_group_decoration) {
         spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
         spvtools::Optimizer optimizer(spirv_environment);
@@ -4642,7 +4858,7 @@ void ValidationStateTracker::PreCallRecordCreateShaderModule(VkDevice device, co
             // It is really rare this will get here as Group Decorations have been deprecated and before this was added no one ever
             // raised an issue for a bug that would crash the layers that was around for many releases
             csm_state->module_state =
-                std::make_shared<spirv::Module>(optimized_binary.size() * sizeof(uint32_t), optimized_binary.data());
+                spirv::Module::Create(optimized_binary.size() * sizeof(uint32_t), optimized_binary.data(), spirv_parsed_cache_);
         }
     }
 }
@@ -4659,7 +4875,8 @@ void ValidationStateTracker::PreCallRecordCreateShadersEXT(VkDevice device, uint
         // don't need to worry about GroupDecoration with VK_EXT_shader_object
         if (pCreateInfos[i].codeType == VK_SHADER_CODE_TYPE_SPIRV_EXT) {
             csm_state->module_states[i] =
-                std::make_shared<spirv::Module>(pCreateInfos[i].codeSize, static_cast<const uint32_t *>(pCreateInfos[i].pCode));
+                spirv::Module::Create(pCreateInfos[i].codeSize, static_cast<const uint32_t *>(pCreateInfos[i].pCode),
+                                      spirv_parsed_cache_);
         }
     }
 }
@@ -4700,9 +4917,10 @@ void ValidationStateTracker::PostCallRecordGetSwapchainImagesKHR(VkDevice device
             vvl::SwapchainImage &swapchain_image = swapchain_state->images[i];
             if (swapchain_image.image_state) continue;  // Already retrieved this.
 
-            auto format_features = GetImageFormatFeatures(
-                physical_device, has_format_feature2, IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier), device,
-                pSwapchainImages[i], swapchain_state->image_create_info.format, swapchain_state->image_create_info.tiling);
+            auto format_features = GetImageFormatFeatures(*physical_device_state, format_table, has_format_feature2,
+                                                          IsExtEnabled(device_extensions.vk_ext_image_drm_format_modifier), device,
+                                                          pSwapchainImages[i], swapchain_state->image_create_info.format,
+                                                          swapchain_state->image_create_info.tiling);
 
             auto image_state =
                 CreateImageState(pSwapchainImages[i], swapchain_state->image_create_info.ptr(), swapchain, i, format_features);
@@ -5462,6 +5680,7 @@ void ValidationStateTracker::PostCallRecordGetBufferDeviceAddress(VkDevice devic
 
         BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
         sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
+        std::atomic_store(&buffer_address_snapshot_, std::shared_ptr<const BufferAddressSnapshot>());
         buffer_device_address_ranges_version++;
     }
 }
@@ -21,10 +21,12 @@
 #pragma once
 #include "generated/chassis.h"
 #include "state_tracker/device_state.h"
+#include "state_tracker/format_table.h"
 #include "state_tracker/queue_state.h"
 #include "state_tracker/query_state.h"
 #include "state_tracker/ray_tracing_state.h"
 #include "state_tracker/video_session_state.h"
+#include "state_tracker/shader_module.h"
 #include "generated/layer_chassis_dispatch.h"
 #include "generated/state_tracker_helper.h"
 #include "error_message/logging.h"
@@ -32,10 +34,13 @@
 #include "containers/custom_containers.h"
 #include "utils/android_ndk_types.h"
 #include "containers/range_vector.h"
+#include "containers/slab_pool.h"
 #include <vulkan/utility/vk_struct_helper.hpp>
+#include <array>
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace vvl {
@@ -154,13 +159,27 @@ struct create_buffer_api_state {
     VkBufferCreateInfo modified_create_info;
 };
 
-#define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope)        \
-    vl_concurrent_unordered_map<handle_type, std::shared_ptr<state_type>> map_member;                 \
-    template <typename Dummy>                                                                         \
-    struct MapTraits<state_type, Dummy> {                                                             \
-        static constexpr bool kInstanceScope = instance_scope;                                        \
-        using MapType = decltype(map_member);                                                         \
-        static MapType ValidationStateTracker::*Map() { return &ValidationStateTracker::map_member; } \
+// This structure is used modify parameters for the QueueSubmit down-chain API call
+struct queue_submit_api_state {
+    std::vector<VkSubmitInfo> modified_submits;  // empty if pSubmits is used as is
+    std::vector<VkCommandBuffer> modified_command_buffers;
+    VkFence modified_fence;
+};
+
+// This structure is used modify parameters for the QueueSubmit2 down-chain API call
+struct queue_submit2_api_state {
+    std::vector<VkSubmitInfo2> modified_submits;  // empty if pSubmits is used as is
+    std::vector<VkCommandBufferSubmitInfo> modified_command_buffers;
+    VkFence modified_fence;
+};
+
+#define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope)                          \
+    vl_borrowable_concurrent_unordered_map<handle_type, std::shared_ptr<state_type>, kConcurrentMapSharded> map_member; \
+    template <typename Dummy>                                                                                           \
+    struct MapTraits<state_type, Dummy> {                                                                               \
+        static constexpr bool kInstanceScope = instance_scope;                                                          \
+        using MapType = decltype(map_member);                                                                           \
+        static MapType ValidationStateTracker::*Map() { return &ValidationStateTracker::map_member; }                   \
     };
 
 #define VALSTATETRACK_MAP_AND_TRAITS(handle_type, state_type, map_member) \
@@ -365,6 +384,9 @@ class ValidationStateTracker : public ValidationObject {
         auto iter = map.pop(handle);
         if (iter != map.end()) {
             iter->second->Destroy();
+            if (state_reclaimer) {
+                state_reclaimer->Retire(std::move(iter->second));
+            }
         }
     }
 
@@ -373,39 +395,39 @@ class ValidationStateTracker : public ValidationObject {
         return GetStateMap<State>().size();
     }
 
+    // State object maps and the command buffer internals, derived trackers add their own subsystems
+    void CollectMemoryFootprint(vvl::MemoryFootprint& footprint) const override;
+
+    // Live/peak object counts of the pooled state types
+    std::vector<vvl::SlabPool::Stats> GetStatePoolStats() const {
+        return {state_pools_.buffer->GetStats(), state_pools_.buffer_view->GetStats(), state_pools_.image_view->GetStats(),
+                state_pools_.sampler->GetStats(), state_pools_.descriptor_set->GetStats()};
+    }
+
+    // ForEachShared(), ForEach() and AnyOf() visit the map in place, holding one bucket read lock at a time.
+    // fn must not create or destroy objects of the same State type, or look them up with Get<State>().
     template <typename State, typename Fn>
     void ForEachShared(Fn&& fn) const {
         const auto& map = GetStateMap<State>();
-        for (const auto& entry : map.snapshot()) {
-            fn(entry.second);
-        }
+        map.for_each([&fn](const auto&, const auto& state) { fn(state); });
     }
 
     template <typename State, typename Fn>
     void ForEachShared(Fn&& fn) {
         auto& map = GetStateMap<State>();
-        for (const auto& entry : map.snapshot()) {
-            fn(entry.second);
-        }
+        map.for_each([&fn](const auto&, const auto& state) { fn(state); });
     }
 
-    template <typename State>
-    void ForEach(std::function<void(const State& s)> fn) const {
+    template <typename State, typename Fn>
+    void ForEach(Fn&& fn) const {
         const auto& map = GetStateMap<State>();
-        for (const auto& entry : map.snapshot()) {
-            fn(*entry.second);
-        }
+        map.for_each([&fn](const auto&, const auto& state) { fn(static_cast<const State&>(*state)); });
     }
 
-    template <typename State>
-    bool AnyOf(std::function<bool(const State& s)> fn) const {
+    template <typename State, typename Fn>
+    bool AnyOf(Fn&& fn) const {
         const auto& map = GetStateMap<State>();
-        for (const auto& entry : map.snapshot()) {
-            if (fn(*entry.second)) {
-                return true;
-            }
-        }
-        return false;
+        return map.any_of([&fn](const auto&, const auto& state) { return fn(static_cast<const State&>(*state)); });
     }
 
     template <typename State, typename Traits = typename state_object::Traits<State>>
@@ -430,6 +452,17 @@ class ValidationStateTracker : public ValidationObject {
         return std::static_pointer_cast<State>(std::move(found_it->second));
     }
 
+    // Borrow() is Get() without the shared_ptr copy, for lookups that only use the state object inside the current call.
+    // The returned pointer is kept alive by epoch reclamation instead of a reference count, so it must not be stored or
+    // passed on to anything that keeps it past the call. Use Get() when ownership is needed.
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    vvl::Borrowed<const State> Borrow(typename Traits::HandleType handle) const {
+        vvl::EpochGuard guard;
+        const auto& map = GetStateMap<State>();
+        const State* state = static_cast<const State*>(map.find_borrowed(handle));
+        return vvl::Borrowed<const State>(std::move(guard), state);
+    }
+
     // GetRead() and GetWrite() return an already locked state object. Currently this is only supported by
     // vvl::CommandBuffer, because it has public ReadLock() and WriteLock() methods.
     // NOTE: Calling base class hook methods with a vvl::CommandBuffer lock held will lead to deadlock. Instead,
@@ -481,34 +514,47 @@ class ValidationStateTracker : public ValidationObject {
     // from shared ones created when the buffer is first recorded, and they are removed from buffer_address_map_ at BufferDestroy
     // time
     using BUFFER_STATE_PTR = vvl::Buffer*;
-    vvl::span<BUFFER_STATE_PTR> GetBuffersByAddress(VkDeviceAddress address) {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<BUFFER_STATE_PTR>(nullptr, static_cast<size_t>(0));
-        }
-        return found_it->second;
-    }
+    using BufferAddressRange = sparse_container::range<VkDeviceAddress>;
+    // Copy of buffer_address_map_ as sorted arrays, that lookups from any number of threads only binary search. It is never
+    // modified, the first lookup after buffers were added to or removed from the map builds a new one.
+    struct BufferAddressSnapshot {
+        std::vector<BufferAddressRange> ranges;  // sorted and disjoint, one per entry of the map
+        std::vector<uint32_t> first_buffer;      // the buffers of ranges[i] are buffers[first_buffer[i]..first_buffer[i + 1]]
+        std::vector<BUFFER_STATE_PTR> buffers;
+    };
+    // The buffers found at an address, keeps the snapshot they were found in alive
+    class BufferAddressLookup {
+      public:
+        BufferAddressLookup() = default;
+        BufferAddressLookup(std::shared_ptr<const BufferAddressSnapshot>&& snapshot, vvl::span<const BUFFER_STATE_PTR> buffers)
+            : snapshot_(std::move(snapshot)), buffers_(buffers) {}
 
-    vvl::span<const BUFFER_STATE_PTR> GetBuffersByAddress(VkDeviceAddress address) const {
-        ReadLockGuard guard(buffer_address_lock_);
-        auto found_it = buffer_address_map_.find(address);
-        if (found_it == buffer_address_map_.end()) {
-            return vvl::make_span<const BUFFER_STATE_PTR>(nullptr, static_cast<size_t>(0));
-        }
-        return found_it->second;
-    }
+        const BUFFER_STATE_PTR* begin() const { return buffers_.data(); }
+        const BUFFER_STATE_PTR* end() const { return buffers_.data() + buffers_.size(); }
+        const BUFFER_STATE_PTR* data() const { return buffers_.data(); }
+        const BUFFER_STATE_PTR& operator[](size_t i) const { return buffers_.data()[i]; }
+        size_t size() const { return buffers_.size(); }
+        bool empty() const { return buffers_.empty(); }
 
-    using BufferAddressRange = sparse_container::range<VkDeviceAddress>;
-    std::vector<BufferAddressRange> GetBufferAddressRanges() const {
-        ReadLockGuard guard(buffer_address_lock_);
-        std::vector<BufferAddressRange> result;
-        result.reserve(buffer_address_map_.size());
-        for (const auto& entry : buffer_address_map_) {
-            result.push_back(entry.first);
-        }
-        return result;
-    }
+      private:
+        std::shared_ptr<const BufferAddressSnapshot> snapshot_;
+        vvl::span<const BUFFER_STATE_PTR> buffers_;
+    };
+    BufferAddressLookup GetBuffersByAddress(VkDeviceAddress address) const;
+    // The buffers at many addresses, all resolved against the same snapshot in a single sweep over its ranges
+    class BufferAddressBatch {
+      public:
+        // In the order of the addresses given to GetBuffersByAddresses
+        vvl::span<const BUFFER_STATE_PTR> operator[](size_t i) const { return buffers_[i]; }
+        size_t size() const { return buffers_.size(); }
+
+      private:
+        friend class ValidationStateTracker;
+        std::shared_ptr<const BufferAddressSnapshot> snapshot_;
+        std::vector<vvl::span<const BUFFER_STATE_PTR>> buffers_;
+    };
+    BufferAddressBatch GetBuffersByAddresses(vvl::span<const VkDeviceAddress> addresses) const;
+    std::shared_ptr<const BufferAddressSnapshot> GetBufferAddressSnapshot() const;
 
     using SetImageViewInitialLayoutCallback = std::function<void(vvl::CommandBuffer*, const vvl::ImageView&, VkImageLayout)>;
     template <typename Fn>
@@ -822,6 +868,9 @@ class ValidationStateTracker : public ValidationObject {
                                                                        std::shared_ptr<const vvl::RenderPass>&& render_pass,
                                                                        std::shared_ptr<const vvl::PipelineLayout>&& layout,
                                                                        CreateShaderModuleStates* csm_states) const;
+    // Layout of a pipeline linked from libraries, the exe, fragment shader and pre-raster layouts merged, any can be null
+    std::shared_ptr<const vvl::PipelineLayout> GetMergedPipelineLayout(
+        const std::array<std::shared_ptr<const vvl::PipelineLayout>, 3>& layouts) const;
     bool PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                 const VkGraphicsPipelineCreateInfo* pCreateInfos,
                                                 const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
@@ -1501,10 +1550,13 @@ class ValidationStateTracker : public ValidationObject {
                                                                           const vvl::Framebuffer& fb_state) const;
 
     VkFormatFeatureFlags2KHR GetPotentialFormatFeatures(VkFormat format) const;
+    VkFormatFeatureFlags2KHR GetDrmFormatModifierTilingFeatures(VkFormat format) const;
     void PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet,
                                                     const vvl::DescriptorUpdateTemplate* template_state, const void* pData);
     void RecordAcquireNextImageState(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore,
                                      VkFence fence, uint32_t* pImageIndex, vvl::Func command);
+    // After VK_ERROR_OUT_OF_DATE_KHR, the next validation using the surface of the swapchain queries it again
+    void InvalidateSurfaceCapabilities(VkSwapchainKHR swapchain);
     virtual std::shared_ptr<vvl::Swapchain> CreateSwapchainState(const VkSwapchainCreateInfoKHR* create_info,
                                                                  VkSwapchainKHR swapchain);
     void RecordCreateSwapchainState(VkResult result, const VkSwapchainCreateInfoKHR* pCreateInfo, VkSwapchainKHR* pSwapchain,
@@ -1800,6 +1852,8 @@ class ValidationStateTracker : public ValidationObject {
         return false;
     }
 
+    const vvl::FormatInfo& GetFormatInfo(VkFormat format) const { return format_table.Get(format); }
+
     // Link to the device's physical-device data
     vvl::PhysicalDevice* physical_device_state;
 
@@ -1808,6 +1862,12 @@ class ValidationStateTracker : public ValidationObject {
 
     std::unique_ptr<SetImageViewInitialLayoutCallback> set_image_view_initial_layout_callback;
 
+    // Only with shared_queue_retirement, must outlive the queues
+    std::unique_ptr<vvl::QueueRetireWorker> queue_retire_worker;
+
+    // Only with deferred_state_destruction, frees the state objects destroyed by Destroy<>()
+    std::unique_ptr<vvl::StateReclaimer> state_reclaimer;
+
     DeviceFeatures enabled_features = {};
     // Device specific data
     std::set<std::string> phys_dev_extensions;
@@ -1817,7 +1877,9 @@ class ValidationStateTracker : public ValidationObject {
     VkPhysicalDeviceVulkan12Properties phys_dev_props_core12 = {};
     VkPhysicalDeviceVulkan13Properties phys_dev_props_core13 = {};
     VkDeviceGroupDeviceCreateInfo device_group_create_info = {};
+    std::vector<VkPhysicalDevice> device_group_physical_devices;  // pPhysicalDevices of device_group_create_info
     uint32_t physical_device_count;
+    uint32_t physical_device_mask;  // one bit per physical device of the group, what a device mask can at most contain
     uint32_t custom_border_color_sampler_count = 0;
 #ifdef VK_USE_PLATFORM_METAL_EXT
     std::vector<VkExportMetalObjectTypeFlagBitsEXT> export_metal_flags;
@@ -1826,6 +1888,10 @@ class ValidationStateTracker : public ValidationObject {
     // Some extensions/features changes the behavior of the app/layers/spec if present.
     // So it needs its own special boolean unlike the enabled_fatures.
     bool has_format_feature2;  // VK_KHR_format_feature_flags2
+    // Built in CreateDevice, after has_format_feature2
+    vvl::FormatTable format_table;
+    // Union of the tiling features of the DRM format modifiers of each format, see GetDrmFormatModifierTilingFeatures()
+    mutable vl_concurrent_unordered_map<uint32_t, VkFormatFeatureFlags2KHR> drm_format_modifier_features_;
     // VK_EXT_pipeline_robustness was designed to be a subset of robustness extensions
     // Enabling the other robustness features can reduce performance on GPU, so just the
     // support is needed to check
@@ -1894,6 +1960,23 @@ class ValidationStateTracker : public ValidationObject {
     uint32_t buffer_device_address_ranges_version = 0;
 
     mutable vvl::VideoProfileDesc::Cache video_profile_cache_;
+    // Identical SPIR-V given to several shader modules, shader objects or pipeline libraries is only parsed once
+    mutable spirv::ParsedCache spirv_parsed_cache_;
+    // Engines link thousands of pipelines from a few hundred libraries, the ones linked from the same layouts share the
+    // merged layout. Only holds weak references, checked against the source layouts still being the same objects.
+    struct MergedPipelineLayouts {
+        struct Entry {
+            std::array<std::weak_ptr<const vvl::PipelineLayout>, 3> sources;
+            std::weak_ptr<const vvl::PipelineLayout> merged;
+        };
+        // Expired entries are swept every so often instead of on each pipeline destruction
+        static constexpr uint32_t kPruneInterval = 256;
+
+        std::mutex lock;
+        vvl::unordered_map<uint64_t, Entry> entries;
+        uint32_t adds_since_prune = 0;
+    };
+    mutable MergedPipelineLayouts merged_pipeline_layouts_;
 
     using BufferAddressMapStore = small_vector<BUFFER_STATE_PTR, 1, size_t>;
     using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
@@ -1912,6 +1995,8 @@ class ValidationStateTracker : public ValidationObject {
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
     BufferAddressRangeMap buffer_address_map_;
     mutable std::shared_mutex buffer_address_lock_;
+    // Null when buffer_address_map_ changed since it was built, only accessed with std::atomic_load/std::atomic_store
+    mutable std::shared_ptr<const BufferAddressSnapshot> buffer_address_snapshot_;
 
     // < external format, features >
     vl_concurrent_unordered_map<uint64_t, VkFormatFeatureFlags2KHR> ahb_ext_formats_map;
@@ -1936,6 +2021,21 @@ class ValidationStateTracker : public ValidationObject {
     mutable std::shared_mutex win32_handle_map_lock_;
 #endif
 
+    // Applications can create and destroy tens of thousands of these per frame, so their state objects come from slab pools
+    // instead of the global allocator. Derived classes that create their own subclasses of these types don't use them.
+    struct StatePools {
+        std::shared_ptr<vvl::SlabPool> buffer = std::make_shared<vvl::SlabPool>("vvl::Buffer");
+        std::shared_ptr<vvl::SlabPool> buffer_view = std::make_shared<vvl::SlabPool>("vvl::BufferView");
+        std::shared_ptr<vvl::SlabPool> image_view = std::make_shared<vvl::SlabPool>("vvl::ImageView");
+        std::shared_ptr<vvl::SlabPool> sampler = std::make_shared<vvl::SlabPool>("vvl::Sampler");
+        std::shared_ptr<vvl::SlabPool> descriptor_set = std::make_shared<vvl::SlabPool>("vvl::DescriptorSet");
+    } state_pools_;
+
+    template <typename State, typename... Args>
+    static std::shared_ptr<State> MakePooledState(const std::shared_ptr<vvl::SlabPool>& pool, Args&&... args) {
+        return std::allocate_shared<State>(vvl::SlabAllocator<State>(pool), std::forward<Args>(args)...);
+    }
+
   private:
     VALSTATETRACK_MAP_AND_TRAITS(VkQueue, vvl::Queue, queue_map_)
     VALSTATETRACK_MAP_AND_TRAITS(VkAccelerationStructureNV, vvl::AccelerationStructureNV, acceleration_structure_nv_map_)
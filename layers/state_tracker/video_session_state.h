@@ -18,6 +18,8 @@
 #include "state_tracker/state_object.h"
 #include "utils/hash_util.h"
 #include "generated/vk_safe_struct.h"
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -258,32 +260,27 @@ class VideoPictureResource {
 
     operator bool() const { return image_view_state != nullptr; }
 
+    // The hash of the identity is computed once, so that mismatching resources are usually told apart by a single compare
     bool operator==(VideoPictureResource const &rhs) const {
-        return image_state == rhs.image_state && range.baseMipLevel == rhs.range.baseMipLevel &&
+        return identity_hash_ == rhs.identity_hash_ && image_state == rhs.image_state &&
+               range.baseMipLevel == rhs.range.baseMipLevel &&
                range.baseArrayLayer == rhs.range.baseArrayLayer && coded_offset.x == rhs.coded_offset.x &&
                coded_offset.y == rhs.coded_offset.y && coded_extent.width == rhs.coded_extent.width &&
                coded_extent.height == rhs.coded_extent.height;
     }
 
-    bool operator!=(VideoPictureResource const &rhs) const {
-        return image_state != rhs.image_state || range.baseMipLevel != rhs.range.baseMipLevel ||
-               range.baseArrayLayer != rhs.range.baseArrayLayer || coded_offset.x != rhs.coded_offset.x ||
-               coded_offset.y != rhs.coded_offset.y || coded_extent.width != rhs.coded_extent.width ||
-               coded_extent.height != rhs.coded_extent.height;
-    }
+    bool operator!=(VideoPictureResource const &rhs) const { return !(*this == rhs); }
 
     struct hash {
       public:
-        std::size_t operator()(VideoPictureResource const &res) const {
-            hash_util::HashCombiner hc;
-            hc << res.image_state.get() << res.range.baseMipLevel << res.range.baseArrayLayer << res.coded_offset.x
-               << res.coded_offset.y << res.coded_extent.width << res.coded_extent.height;
-            return hc.Value();
-        }
+        std::size_t operator()(VideoPictureResource const &res) const { return res.identity_hash_; }
     };
 
   private:
     VkImageSubresourceRange GetImageSubresourceRange(ImageView const *image_view_state, uint32_t layer);
+    std::size_t ComputeIdentityHash() const;
+
+    std::size_t identity_hash_;
 };
 
 using VideoPictureResources = unordered_set<VideoPictureResource, VideoPictureResource::hash>;
@@ -430,23 +427,23 @@ struct VideoEncodeRateControlState {
 
 class VideoSessionDeviceState {
   public:
-    VideoSessionDeviceState(uint32_t reference_slot_count = 0)
-        : initialized_(false),
-          is_active_(reference_slot_count, false),
-          all_pictures_(reference_slot_count),
-          pictures_per_id_(reference_slot_count),
-          encode_() {}
+    VideoSessionDeviceState(uint32_t reference_slot_count = 0) : initialized_(false), slots_(reference_slot_count), encode_() {}
 
     bool IsInitialized() const { return initialized_; }
-    bool IsSlotActive(int32_t slot_index) const { return is_active_[slot_index]; }
+    bool IsSlotActive(int32_t slot_index) const { return slots_[slot_index].is_active; }
 
     bool IsSlotPicture(int32_t slot_index, const VideoPictureResource &res) const {
-        return all_pictures_[slot_index].find(res) != all_pictures_[slot_index].end();
+        for (const auto &picture : slots_[slot_index].pictures) {
+            if (picture && picture == res) {
+                return true;
+            }
+        }
+        return false;
     }
 
     bool IsSlotPicture(int32_t slot_index, const VideoPictureID &picture_id, const VideoPictureResource &res) const {
-        auto it = pictures_per_id_[slot_index].find(picture_id);
-        return it != pictures_per_id_[slot_index].end() && it->second == res;
+        const auto &picture = slots_[slot_index].pictures[SlotState::PictureIndex(picture_id)];
+        return picture && picture == res;
     }
 
     uint32_t GetEncodeQualityLevel() const { return encode_.quality_level; }
@@ -466,10 +463,27 @@ class VideoSessionDeviceState {
                                   const safe_VkVideoBeginCodingInfoKHR &begin_info, const Location &loc) const;
 
   private:
+    // A DPB slot holds either a frame or up to one picture per field, all lookups of a slot are a direct index
+    struct SlotState {
+        static constexpr size_t kFrame = 0;
+        static constexpr size_t kTopField = 1;
+        static constexpr size_t kBottomField = 2;
+        static size_t PictureIndex(const VideoPictureID &picture_id) {
+            return picture_id.IsTopField() ? kTopField : (picture_id.IsBottomField() ? kBottomField : kFrame);
+        }
+
+        bool HasPictures() const {
+            return std::any_of(pictures.begin(), pictures.end(), [](const VideoPictureResource &res) { return bool(res); });
+        }
+        void Clear() { pictures.fill(VideoPictureResource()); }
+
+        bool is_active = false;
+        // Indexed by PictureIndex, an empty resource when the slot holds no such picture
+        std::array<VideoPictureResource, 3> pictures{};
+    };
+
     bool initialized_;
-    std::vector<bool> is_active_;
-    std::vector<VideoPictureResources> all_pictures_;
-    std::vector<unordered_map<VideoPictureID, VideoPictureResource, VideoPictureID::hash>> pictures_per_id_;
+    std::vector<SlotState> slots_;
 
     struct {
         uint32_t quality_level{0};
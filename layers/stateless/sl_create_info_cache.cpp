@@ -0,0 +1,175 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stateless/sl_create_info_cache.h"
+
+#include <cstddef>
+#include <mutex>
+
+#include "utils/hash_util.h"
+
+namespace stateless {
+
+namespace {
+
+// Different for each kind of create info, so that their keys can't collide
+enum Seed : uint64_t {
+    kSamplerSeed = 1,
+    kImageViewSeed,
+    kDescriptorSetLayoutSeed,
+};
+
+uint64_t HashBytes(uint64_t hash, const void *data, size_t size) { return hash_util::Hash64(data, size, hash); }
+
+// sType and the members after pNext, up to end, which is where the last member ends so that trailing padding isn't hashed
+uint64_t HashStruct(uint64_t hash, const void *structure, size_t end) {
+    const auto *header = static_cast<const VkBaseInStructure *>(structure);
+    hash = HashBytes(hash, &header->sType, sizeof(header->sType));
+    return HashBytes(hash, static_cast<const uint8_t *>(structure) + sizeof(VkBaseInStructure), end - sizeof(VkBaseInStructure));
+}
+
+// End of the last member of the structures of the chain that are plain data without padding between their members,
+// 0 for anything else
+size_t PlainStructEnd(VkStructureType stype) {
+    switch (stype) {
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+            return offsetof(VkSamplerYcbcrConversionInfo, conversion) + sizeof(VkSamplerYcbcrConversion);
+        case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO:
+            return offsetof(VkSamplerReductionModeCreateInfo, reductionMode) + sizeof(VkSamplerReductionMode);
+        case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT:
+            return offsetof(VkSamplerCustomBorderColorCreateInfoEXT, format) + sizeof(VkFormat);
+        case VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT:
+            return offsetof(VkSamplerBorderColorComponentMappingCreateInfoEXT, srgb) + sizeof(VkBool32);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO:
+            return offsetof(VkImageViewUsageCreateInfo, usage) + sizeof(VkImageUsageFlags);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT:
+            return offsetof(VkImageViewASTCDecodeModeEXT, decodeMode) + sizeof(VkFormat);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT:
+            return offsetof(VkImageViewMinLodCreateInfoEXT, minLod) + sizeof(float);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_SLICED_CREATE_INFO_EXT:
+            return offsetof(VkImageViewSlicedCreateInfoEXT, sliceCount) + sizeof(uint32_t);
+        default:
+            return 0;
+    }
+}
+
+// Returns false if the chain has a structure that can't be hashed
+bool HashPlainChain(uint64_t &hash, const void *next) {
+    for (auto *current = static_cast<const VkBaseInStructure *>(next); current; current = current->pNext) {
+        const size_t end = PlainStructEnd(current->sType);
+        if (end == 0) {
+            return false;
+        }
+        hash = HashStruct(hash, current, end);
+    }
+    return true;
+}
+
+uint64_t HashCallParameters(uint64_t hash, const VkAllocationCallbacks *allocator, const void *output) {
+    const bool has_allocator = allocator != nullptr;
+    const bool has_output = output != nullptr;
+    hash = HashBytes(hash, &has_allocator, sizeof(has_allocator));
+    hash = HashBytes(hash, &has_output, sizeof(has_output));
+    if (allocator) {
+        hash = HashBytes(hash, allocator, sizeof(VkAllocationCallbacks));
+    }
+    // 0 is kept for "no key"
+    return hash ? hash : 1;
+}
+
+}  // namespace
+
+uint64_t CreateInfoCache::Key(const VkSamplerCreateInfo *create_info, const VkAllocationCallbacks *allocator,
+                              const void *output) {
+    if (!create_info) {
+        return 0;
+    }
+    uint64_t hash = HashStruct(kSamplerSeed, create_info,
+                               offsetof(VkSamplerCreateInfo, unnormalizedCoordinates) + sizeof(VkBool32));
+    if (!HashPlainChain(hash, create_info->pNext)) {
+        return 0;
+    }
+    return HashCallParameters(hash, allocator, output);
+}
+
+uint64_t CreateInfoCache::Key(const VkImageViewCreateInfo *create_info, const VkAllocationCallbacks *allocator,
+                              const void *output) {
+    if (!create_info) {
+        return 0;
+    }
+    // There is padding between flags and image
+    uint64_t hash = HashBytes(kImageViewSeed, &create_info->sType, sizeof(create_info->sType));
+    hash = HashBytes(hash, &create_info->flags, sizeof(create_info->flags));
+    const size_t image_offset = offsetof(VkImageViewCreateInfo, image);
+    const size_t end = offsetof(VkImageViewCreateInfo, subresourceRange) + sizeof(VkImageSubresourceRange);
+    hash = HashBytes(hash, &create_info->image, end - image_offset);
+    if (!HashPlainChain(hash, create_info->pNext)) {
+        return 0;
+    }
+    return HashCallParameters(hash, allocator, output);
+}
+
+uint64_t CreateInfoCache::Key(const VkDescriptorSetLayoutCreateInfo *create_info, const VkAllocationCallbacks *allocator,
+                              const void *output) {
+    if (!create_info || (create_info->bindingCount && !create_info->pBindings)) {
+        return 0;
+    }
+    uint64_t hash = HashBytes(kDescriptorSetLayoutSeed, &create_info->sType, sizeof(create_info->sType));
+    hash = HashBytes(hash, &create_info->flags, sizeof(create_info->flags));
+    hash = HashBytes(hash, &create_info->bindingCount, sizeof(create_info->bindingCount));
+    for (uint32_t i = 0; i < create_info->bindingCount; i++) {
+        const VkDescriptorSetLayoutBinding &binding = create_info->pBindings[i];
+        hash = HashBytes(hash, &binding.binding, sizeof(binding.binding));
+        hash = HashBytes(hash, &binding.descriptorType, sizeof(binding.descriptorType));
+        hash = HashBytes(hash, &binding.descriptorCount, sizeof(binding.descriptorCount));
+        hash = HashBytes(hash, &binding.stageFlags, sizeof(binding.stageFlags));
+        const bool has_immutable_samplers = binding.pImmutableSamplers != nullptr;
+        hash = HashBytes(hash, &has_immutable_samplers, sizeof(has_immutable_samplers));
+        if (has_immutable_samplers && (binding.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER ||
+                                       binding.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)) {
+            hash = HashBytes(hash, binding.pImmutableSamplers, binding.descriptorCount * sizeof(VkSampler));
+        }
+    }
+    for (auto *current = static_cast<const VkBaseInStructure *>(create_info->pNext); current; current = current->pNext) {
+        if (current->sType != VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO) {
+            return 0;
+        }
+        const auto *binding_flags = reinterpret_cast<const VkDescriptorSetLayoutBindingFlagsCreateInfo *>(current);
+        if (binding_flags->bindingCount && !binding_flags->pBindingFlags) {
+            return 0;
+        }
+        hash = HashBytes(hash, &binding_flags->sType, sizeof(binding_flags->sType));
+        hash = HashBytes(hash, &binding_flags->bindingCount, sizeof(binding_flags->bindingCount));
+        hash = HashBytes(hash, binding_flags->pBindingFlags, binding_flags->bindingCount * sizeof(VkDescriptorBindingFlags));
+    }
+    return HashCallParameters(hash, allocator, output);
+}
+
+bool CreateInfoCache::Contains(uint64_t key) const {
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    return keys_.find(key) != keys_.end();
+}
+
+void CreateInfoCache::Add(uint64_t key) {
+    std::unique_lock<std::shared_mutex> guard(lock_);
+    if (keys_.size() >= kMaxKeys) {
+        keys_.clear();
+    }
+    keys_.insert(key);
+}
+
+}  // namespace stateless
@@ -0,0 +1,54 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <shared_mutex>
+
+#include <vulkan/vulkan.h>
+
+#include "containers/custom_containers.h"
+
+namespace stateless {
+
+// With create_info_cache, the keys of the create infos that passed stateless validation, so that applications creating the
+// same sampler, image view or descriptor set layout over and over only have it validated once.
+//
+// Keys are 64 bit hashes of the whole create info including its pNext chain and the other parameters of the call. Create
+// infos with a structure in the chain that isn't known to be plain data (no pointers other than pNext) get no key at all
+// and are always validated.
+class CreateInfoCache {
+  public:
+    // 0 means the call can't be cached
+    static uint64_t Key(const VkSamplerCreateInfo *create_info, const VkAllocationCallbacks *allocator, const void *output);
+    static uint64_t Key(const VkImageViewCreateInfo *create_info, const VkAllocationCallbacks *allocator, const void *output);
+    static uint64_t Key(const VkDescriptorSetLayoutCreateInfo *create_info, const VkAllocationCallbacks *allocator,
+                        const void *output);
+
+    bool Contains(uint64_t key) const;
+    void Add(uint64_t key);
+
+  private:
+    // Starts over rather than tracking which keys are still in use, applications with that many distinct create infos are
+    // not the ones this is for
+    static constexpr size_t kMaxKeys = 4096;
+
+    mutable std::shared_mutex lock_;
+    vvl::unordered_set<uint64_t> keys_;
+};
+
+}  // namespace stateless
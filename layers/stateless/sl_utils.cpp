@@ -49,9 +49,9 @@ bool StatelessValidation::CheckPromotedApiAgainstVulkanVersion(VkPhysicalDevice
     return skip;
 }
 
-bool StatelessValidation::OutputExtensionError(const Location &loc, const std::string &extension_name) const {
+bool StatelessValidation::OutputExtensionError(const Location &loc, const char *extension_name) const {
     return LogError(kVUID_PVError_ExtensionNotEnabled, instance, loc,
-                    "function required extension %s which has not been enabled.\n", extension_name.c_str());
+                    "function required extension %s which has not been enabled.\n", extension_name);
 }
 
 bool StatelessValidation::SupportedByPdev(const VkPhysicalDevice physical_device, const std::string &ext_name) const {
@@ -68,7 +68,7 @@ bool StatelessValidation::SupportedByPdev(const VkPhysicalDevice physical_device
 }
 
 static const int kMaxParamCheckerStringLength = 256;
-bool StatelessValidation::ValidateString(const Location &loc, const std::string &vuid, const char *validateString) const {
+bool StatelessValidation::ValidateString(const Location &loc, std::string_view vuid, const char *validateString) const {
     bool skip = false;
 
     VkStringErrorFlags result = vk_string_validate(kMaxParamCheckerStringLength, validateString);
@@ -83,7 +83,7 @@ bool StatelessValidation::ValidateString(const Location &loc, const std::string
     return skip;
 }
 
-bool StatelessValidation::ValidateNotZero(bool is_zero, const std::string &vuid, const Location &loc) const {
+bool StatelessValidation::ValidateNotZero(bool is_zero, std::string_view vuid, const Location &loc) const {
     bool skip = false;
     if (is_zero) {
         skip |= LogError(vuid, device, loc, "is zero.");
@@ -100,7 +100,7 @@ bool StatelessValidation::ValidateNotZero(bool is_zero, const std::string &vuid,
  * @param value Pointer to validate.
  * @return Boolean value indicating that the call should be skipped.
  */
-bool StatelessValidation::ValidateRequiredPointer(const Location &loc, const void *value, const std::string &vuid) const {
+bool StatelessValidation::ValidateRequiredPointer(const Location &loc, const void *value, std::string_view vuid) const {
     bool skip = false;
 
     if (value == nullptr) {
@@ -166,11 +166,8 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                                               const char *stype_vuid, const bool is_physdev_api, const bool is_const_param) const {
     bool skip = false;
     const Location pNext_loc = loc.dot(Field::pNext);
-    const char *api_name = loc.StringFunc();
 
     if (next != nullptr) {
-        vvl::unordered_set<const void *> cycle_check;
-        vvl::unordered_set<VkStructureType, vvl::hash<int>> unique_stype_check;
         const char *disclaimer =
             "This error is based on the Valid Usage documentation for version %" PRIu32
             " of the Vulkan header.  It is possible that "
@@ -185,19 +182,27 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
             const VkStructureType *start = allowed_types;
             const VkStructureType *end = allowed_types + allowed_type_count;
             const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
+            // The loader chains its own structure to the create infos of the instance and device
+            VkStructureType loader_stype = VK_STRUCTURE_TYPE_MAX_ENUM;
+            if (loc.function == vvl::Func::vkCreateInstance) {
+                loader_stype = VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO;
+            } else if (loc.function == vvl::Func::vkCreateDevice) {
+                loader_stype = VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO;
+            }
+            // Chains are short, a linear search of the types seen so far beats hashing them
+            small_vector<VkStructureType, 16, uint32_t> seen_stypes;
 
             while (current != nullptr) {
-                if (((strncmp(api_name, "vkCreateInstance", strlen(api_name)) != 0) ||
-                     (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
-                    ((strncmp(api_name, "vkCreateDevice", strlen(api_name)) != 0) ||
-                     (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                    std::string type_name = string_VkStructureType(current->sType);
-                    if (unique_stype_check.find(current->sType) != unique_stype_check.end() && !IsDuplicatePnext(current->sType)) {
-                        // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
-                        skip |= LogError(stype_vuid, device, pNext_loc,
-                                         "chain contains duplicate structure types: %s appears multiple times.", type_name.c_str());
+                if (current->sType != loader_stype) {
+                    if (std::find(seen_stypes.begin(), seen_stypes.end(), current->sType) != seen_stypes.end()) {
+                        if (!IsDuplicatePnext(current->sType)) {
+                            // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
+                            skip |= LogError(stype_vuid, device, pNext_loc,
+                                             "chain contains duplicate structure types: %s appears multiple times.",
+                                             string_VkStructureType(current->sType));
+                        }
                     } else {
-                        unique_stype_check.insert(current->sType);
+                        seen_stypes.emplace_back(current->sType);
                     }
 
                     // Search custom stype list -- if sType found, skip this entirely
@@ -210,7 +215,8 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                     }
                     if (!custom) {
                         if (std::find(start, end, current->sType) == end) {
-                            if (type_name.compare(UnsupportedStructureTypeString) == 0) {
+                            const char *type_name = string_VkStructureType(current->sType);
+                            if (UnsupportedStructureTypeString == type_name) {
                                 std::string message = "chain includes a structure with unknown VkStructureType (%" PRIu32 "). ";
                                 message += disclaimer;
                                 skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), current->sType, header_version,
@@ -218,7 +224,7 @@ bool StatelessValidation::ValidateStructPnext(const Location &loc, const void *n
                             } else {
                                 std::string message = "chain includes a structure with unexpected VkStructureType %s. ";
                                 message += disclaimer;
-                                skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), type_name.c_str(), header_version,
+                                skip |= LogError(pnext_vuid, device, pNext_loc, message.c_str(), type_name, header_version,
                                                  pNext_loc.Fields().c_str());
                             }
                         }
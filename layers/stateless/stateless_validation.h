@@ -21,6 +21,7 @@
 #include <vulkan/utility/vk_struct_helper.hpp>
 #include "sync/sync_utils.h"
 #include "state_tracker/cmd_buffer_state.h"
+#include "stateless/sl_create_info_cache.h"
 
 [[maybe_unused]] static const char *kVUID_PVError_ExtensionNotEnabled = "UNASSIGNED-GeneralParameterError-ExtensionNotEnabled";
 [[maybe_unused]] static const char *kVUID_PVError_ApiVersionViolation = "UNASSIGNED-API-Version-Violation";
@@ -84,6 +85,9 @@ class StatelessValidation : public ValidationObject {
     mutable std::mutex renderpass_map_mutex;
     vvl::unordered_map<VkRenderPass, SubpassesUsageStates> renderpasses_states;
 
+    // Only used with create_info_cache, filled from the const PreCallValidate functions
+    mutable stateless::CreateInfoCache validated_create_infos;
+
     // Constructor for stateles validation tracking
     StatelessValidation() : device_createinfo_pnext(nullptr) { container_type = LayerObjectTypeParameterValidation; }
     ~StatelessValidation() {
@@ -92,9 +96,9 @@ class StatelessValidation : public ValidationObject {
         }
     }
 
-    bool ValidateNotZero(bool is_zero, const std::string &vuid, const Location &loc) const;
+    bool ValidateNotZero(bool is_zero, std::string_view vuid, const Location &loc) const;
 
-    bool ValidateRequiredPointer(const Location &loc, const void *value, const std::string &vuid) const;
+    bool ValidateRequiredPointer(const Location &loc, const void *value, std::string_view vuid) const;
 
     template <typename T1, typename T2>
     bool ValidateArray(const Location &count_loc, const Location &array_loc, T1 count, const T2 *array, bool countRequired,
@@ -393,16 +397,14 @@ class StatelessValidation : public ValidationObject {
      *
      * @param loc Name of API call being validated.
      * @param enumName Name of the enumeration being validated.
-     * @param valid_values The list of valid values for the enumeration.
      * @param value Enumeration value to validate.
      * @return Boolean value indicating that the call should be skipped.
      */
     template <typename T>
     bool ValidateRangedEnum(const Location &loc, const char *enumName, T value, const char *vuid) const {
         bool skip = false;
-        const auto valid_values = ValidParamValues<T>();
 
-        if (std::find(valid_values.begin(), valid_values.end(), value) == valid_values.end()) {
+        if (!IsValidEnumValue(value)) {
             skip |= LogError(vuid, device, loc,
                              "(%" PRIu32
                              ") does not fall within the begin..end range of the core %s enumeration tokens and is "
@@ -439,14 +441,13 @@ class StatelessValidation : public ValidationObject {
                                  const T *array, bool countRequired, bool arrayRequired, const char *count_required_vuid,
                                  const char *array_required_vuid) const {
         bool skip = false;
-        const auto valid_values = ValidParamValues<T>();
 
         if ((count == 0) || (array == nullptr)) {
             skip |= ValidateArray(count_loc, array_loc, count, &array, countRequired, arrayRequired, count_required_vuid,
                                   array_required_vuid);
         } else {
             for (uint32_t i = 0; i < count; ++i) {
-                if (std::find(valid_values.begin(), valid_values.end(), array[i]) == valid_values.end()) {
+                if (!IsValidEnumValue(array[i])) {
                     skip |= LogError(array_required_vuid, device, array_loc.dot(i),
                                      "(%" PRIu32
                                      ") does not fall within the begin..end range of the core %s "
@@ -521,7 +522,7 @@ class StatelessValidation : public ValidationObject {
                                                      VkPhysicalDeviceGroupProperties *pPhysicalDeviceGroupProperties,
                                                      const RecordObject &record_obj) override;
 
-    bool ValidateString(const Location &loc, const std::string &vuid, const char *validateString) const;
+    bool ValidateString(const Location &loc, std::string_view vuid, const char *validateString) const;
 
     bool ValidateCoarseSampleOrderCustomNV(const VkCoarseSampleOrderCustomNV *order, const Location &order_loc) const;
 
@@ -534,7 +535,7 @@ class StatelessValidation : public ValidationObject {
                                              const Location &loc) const;
     bool ValidateSwapchainCreateInfo(VkSwapchainCreateInfoKHR const *pCreateInfo, const Location &loc) const;
 
-    bool OutputExtensionError(const Location &loc, const std::string &extension_name) const;
+    bool OutputExtensionError(const Location &loc, const char *extension_name) const;
 
     void PreCallRecordDestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator,
                                       const RecordObject &record_obj) override;
@@ -19,9 +19,15 @@
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/video_session_state.h"
 #include "sync/sync_access_context.h"
+#include "utils/layer_profiler.h"
+#include "utils/worker_pool.h"
 
 bool SimpleBinding(const vvl::Bindable &bindable) { return !bindable.sparse && bindable.Binding(); }
 VkDeviceSize ResourceBaseAddress(const vvl::Buffer &buffer) { return buffer.GetFakeBaseAddress(); }
+ResourceAccessRange BufferMemoryRange(const vvl::Buffer &buffer, const ResourceAccessRange &range) {
+    // Every buffer known to sync validation is created by SyncValidator::CreateBufferState
+    return static_cast<const syncval_state::BufferState &>(buffer).MakeMemoryRange(range);
+}
 
 class HazardDetector {
     const SyncStageAccessInfoType &usage_info_;
@@ -88,6 +94,10 @@ AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
         async_.emplace_back(contexts[async_subpass], kInvalidTag);
     }
 
+    if (external_context) {
+        validation_budget_ = external_context->validation_budget_;
+        check_profiler_ = external_context->check_profiler_;
+    }
     if (has_barrier_from_external) {
         // Store the barrier from external with the reat, but save pointer for "by subpass" lookups.
         prev_.emplace_back(external_context, queue_flags, subpass_dep.barrier_from_external);
@@ -102,6 +112,8 @@ template <typename NormalizeOp>
 void AccessContext::Trim(NormalizeOp &&normalize) {
     ForAll(std::forward<NormalizeOp>(normalize));
     sparse_container::consolidate(access_state_map_);
+    coalesced_size_ = access_state_map_.size();
+    first_use_index_.Clear();
 }
 
 void AccessContext::Trim() {
@@ -109,6 +121,15 @@ void AccessContext::Trim() {
     Trim(normalize);
 }
 
+void AccessContext::Coalesce(size_t growth_threshold) {
+    if (growth_threshold == 0 || access_state_map_.size() < coalesced_size_ + growth_threshold) {
+        return;
+    }
+    sparse_container::consolidate(access_state_map_);
+    coalesced_size_ = access_state_map_.size();
+    first_use_index_.Clear();
+}
+
 void AccessContext::TrimAndClearFirstAccess() {
     auto normalize = [](ResourceAccessRangeMap::value_type &access) {
         access.second.Normalize();
@@ -124,6 +145,7 @@ void AccessContext::AddReferencedTags(ResourceUsageTagSet &used) const {
 
 template <typename Action>
 void AccessContext::ForAll(Action &&action) {
+    first_use_index_.Clear();
     for (auto &access : access_state_map_) {
         action(access);
     }
@@ -138,7 +160,7 @@ void AccessContext::ConstForAll(Action &&action) const {
 
 void AccessContext::ResolveFromContext(const AccessContext &from) {
     const NoopBarrierAction noop_barrier;
-    from.ResolveAccessRange(kFullRange, noop_barrier, &access_state_map_, nullptr);
+    ResolveFromContext(noop_barrier, from);
 }
 
 void AccessContext::ResolvePreviousAccess(const ResourceAccessRange &range, ResourceAccessRangeMap *descent_map,
@@ -171,15 +193,17 @@ void AccessContext::ResolvePreviousAccesses() {
     ResourceAccessState default_state;
     if (!prev_.size()) return;  // If no previous contexts, nothing to do
 
+    first_use_index_.Clear();
     ResolvePreviousAccess(kFullRange, &access_state_map_, &default_state);
 }
 
 void AccessContext::UpdateAccessState(const vvl::Buffer &buffer, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                                       const ResourceAccessRange &range, const ResourceUsageTag tag) {
-    if (!SimpleBinding(buffer)) return;
-    const auto base_address = ResourceBaseAddress(buffer);
+    const ResourceAccessRange memory_range = BufferMemoryRange(buffer, range);
+    if (memory_range.empty()) return;
     UpdateMemoryAccessStateFunctor action(*this, current_usage, ordering_rule, tag);
-    UpdateMemoryAccessRangeState(access_state_map_, action, range + base_address);
+    first_use_index_.Clear();
+    UpdateMemoryAccessRangeState(access_state_map_, action, memory_range);
 }
 
 void AccessContext::UpdateAccessState(const ImageState &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -242,6 +266,7 @@ void AccessContext::UpdateAccessState(const ImageRangeGen &range_gen, SyncStageA
 }
 
 void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &contexts) {
+    first_use_index_.Clear();
     for (uint32_t subpass_index = 0; subpass_index < contexts.size(); subpass_index++) {
         auto &context = contexts[subpass_index];
         ApplyTrackbackStackAction barrier_action(context.GetDstExternalTrackBack().barriers);
@@ -282,10 +307,12 @@ void AccessContext::AddAsyncContext(const AccessContext *context, ResourceUsageT
 
 HazardResult AccessContext::DetectHazard(const vvl::Buffer &buffer, SyncStageAccessIndex usage_index,
                                          const ResourceAccessRange &range) const {
-    if (!SimpleBinding(buffer)) return HazardResult();
-    const auto base_address = ResourceBaseAddress(buffer);
+    if (validation_budget_ && validation_budget_->IsShed(vvl::CheckFamily::SyncValidation)) return HazardResult();
+    vvl::CheckScope check_scope(check_profiler_, vvl::ValidationCheck::SyncDetectHazard, validation_budget_);
+    const ResourceAccessRange memory_range = BufferMemoryRange(buffer, range);
+    if (memory_range.empty()) return HazardResult();
     HazardDetector detector(usage_index);
-    return DetectHazardRange(detector, (range + base_address), DetectOptions::kDetectAll);
+    return DetectHazardRange(detector, memory_range, DetectOptions::kDetectAll);
 }
 
 template <typename Detector>
@@ -318,11 +345,15 @@ HazardResult AccessContext::DetectHazard(Detector &detector, const ImageState &i
 
 HazardResult AccessContext::DetectHazard(const ImageState &image, SyncStageAccessIndex current_usage,
                                          const VkImageSubresourceRange &subresource_range, bool is_depth_sliced) const {
+    if (validation_budget_ && validation_budget_->IsShed(vvl::CheckFamily::SyncValidation)) return HazardResult();
+    vvl::CheckScope check_scope(check_profiler_, vvl::ValidationCheck::SyncDetectHazard, validation_budget_);
     HazardDetector detector(current_usage);
     return DetectHazard(detector, image, subresource_range, is_depth_sliced, DetectOptions::kDetectAll);
 }
 
 HazardResult AccessContext::DetectHazard(const ImageViewState &image_view, SyncStageAccessIndex current_usage) const {
+    if (validation_budget_ && validation_budget_->IsShed(vvl::CheckFamily::SyncValidation)) return HazardResult();
+    vvl::CheckScope check_scope(check_profiler_, vvl::ValidationCheck::SyncDetectHazard, validation_budget_);
     // Get is const, but callee will copy
     HazardDetector detector(current_usage);
     return DetectHazardGeneratedRanges(detector, image_view.GetFullViewImageRangeGen(), DetectOptions::kDetectAll);
@@ -330,6 +361,8 @@ HazardResult AccessContext::DetectHazard(const ImageViewState &image_view, SyncS
 
 HazardResult AccessContext::DetectHazard(const ImageRangeGen &ref_range_gen, SyncStageAccessIndex current_usage,
                                          const SyncOrdering ordering_rule) const {
+    if (validation_budget_ && validation_budget_->IsShed(vvl::CheckFamily::SyncValidation)) return HazardResult();
+    vvl::CheckScope check_scope(check_profiler_, vvl::ValidationCheck::SyncDetectHazard, validation_budget_);
     if (ordering_rule == SyncOrdering::kOrderingNone) {
         HazardDetector detector(current_usage);
         return DetectHazardGeneratedRanges(detector, ref_range_gen, DetectOptions::kDetectAll);
@@ -341,6 +374,8 @@ HazardResult AccessContext::DetectHazard(const ImageRangeGen &ref_range_gen, Syn
 
 HazardResult AccessContext::DetectHazard(const ImageViewState &image_view, const VkOffset3D &offset, const VkExtent3D &extent,
                                          SyncStageAccessIndex current_usage, SyncOrdering ordering_rule) const {
+    if (validation_budget_ && validation_budget_->IsShed(vvl::CheckFamily::SyncValidation)) return HazardResult();
+    vvl::CheckScope check_scope(check_profiler_, vvl::ValidationCheck::SyncDetectHazard, validation_budget_);
     // range_gen is non-temporary to avoid an additional copy
     ImageRangeGen range_gen(image_view.MakeImageRangeGen(offset, extent));
     HazardDetectorWithOrdering detector(current_usage, ordering_rule);
@@ -349,12 +384,16 @@ HazardResult AccessContext::DetectHazard(const ImageViewState &image_view, const
 
 HazardResult AccessContext::DetectHazard(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type,
                                          SyncStageAccessIndex current_usage, SyncOrdering ordering_rule) const {
+    if (validation_budget_ && validation_budget_->IsShed(vvl::CheckFamily::SyncValidation)) return HazardResult();
+    vvl::CheckScope check_scope(check_profiler_, vvl::ValidationCheck::SyncDetectHazard, validation_budget_);
     HazardDetectorWithOrdering detector(current_usage, ordering_rule);
     return DetectHazard(detector, view_gen, gen_type, DetectOptions::kDetectAll);
 }
 
 HazardResult AccessContext::DetectHazard(const vvl::VideoSession &vs_state, const vvl::VideoPictureResource &resource,
                                          SyncStageAccessIndex current_usage) const {
+    if (validation_budget_ && validation_budget_->IsShed(vvl::CheckFamily::SyncValidation)) return HazardResult();
+    vvl::CheckScope check_scope(check_profiler_, vvl::ValidationCheck::SyncDetectHazard, validation_budget_);
     const auto image = static_cast<const ImageState *>(resource.image_state.get());
     const auto offset = vs_state.profile->GetEffectiveImageOffset(resource.coded_offset);
     const auto extent = vs_state.profile->GetEffectiveImageExtent(resource.coded_extent);
@@ -366,6 +405,8 @@ HazardResult AccessContext::DetectHazard(const vvl::VideoSession &vs_state, cons
 HazardResult AccessContext::DetectHazard(const ImageState &image, const VkImageSubresourceRange &subresource_range,
                                          const VkOffset3D &offset, const VkExtent3D &extent, bool is_depth_sliced,
                                          SyncStageAccessIndex current_usage, SyncOrdering ordering_rule) const {
+    if (validation_budget_ && validation_budget_->IsShed(vvl::CheckFamily::SyncValidation)) return HazardResult();
+    vvl::CheckScope check_scope(check_profiler_, vvl::ValidationCheck::SyncDetectHazard, validation_budget_);
     if (ordering_rule == SyncOrdering::kOrderingNone) {
         HazardDetector detector(current_usage);
         return DetectHazard(detector, image, subresource_range, offset, extent, is_depth_sliced, DetectOptions::kDetectAll);
@@ -521,20 +562,119 @@ void AccessContext::UpdateMemoryAccessStateFunctor::operator()(const ResourceAcc
 
 // This is called with the *recorded* command buffers access context, with the *active* access context pass in, againsts which
 // hazards will be detected
+// Below this many recorded ranges per chunk the hand off to the workers costs more than the detection
+static constexpr size_t kMinFirstUseRangesPerChunk = 64;
+
 HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                                 const AccessContext &access_context) const {
+                                                 const AccessContext &access_context, vvl::WorkerPool *workers) const {
     HazardResult hazard;
-    for (const auto &recorded_access : access_state_map_) {
-        // Cull any entries not in the current tag range
-        if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
+    auto detect = [queue_id, &tag_range, &access_context](const ResourceAccessRangeMap::value_type &recorded_access) {
         HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
-        hazard = access_context.DetectHazardRange(detector, recorded_access.first, DetectOptions::kDetectAll);
-        if (hazard.IsHazard()) break;
+        return access_context.DetectHazardRange(detector, recorded_access.first, DetectOptions::kDetectAll);
+    };
+
+    const bool indexed = first_use_index_.IsBuilt();
+    const bool parallel =
+        workers && workers->Parallelism() > 1 && access_state_map_.size() >= 2 * kMinFirstUseRangesPerChunk;
+    if (!indexed && !parallel) {
+        for (const auto &recorded_access : access_state_map_) {
+            // Cull any entries not in the current tag range
+            if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
+            hazard = detect(recorded_access);
+            if (hazard.IsHazard()) break;
+        }
+        return hazard;
+    }
+
+    // The recorded ranges with first accesses in the tag range, in address order
+    std::vector<const ResourceAccessRangeMap::value_type *> candidates;
+    if (indexed) {
+        first_use_index_.Gather(tag_range, candidates);
+    } else {
+        candidates.reserve(access_state_map_.size());
+        for (const auto &recorded_access : access_state_map_) {
+            if (recorded_access.second.FirstAccessInTagRange(tag_range)) {
+                candidates.push_back(&recorded_access);
+            }
+        }
+    }
+
+    const size_t chunk_count =
+        parallel ? std::min<size_t>(candidates.size() / kMinFirstUseRangesPerChunk, size_t(workers->Parallelism()) * 4) : 0;
+    if (chunk_count < 2) {
+        for (const auto *recorded_access : candidates) {
+            hazard = detect(*recorded_access);
+            if (hazard.IsHazard()) break;
+        }
+        return hazard;
     }
 
+    // Partition the candidates into chunks of consecutive addresses. The detection only reads from both contexts, so the
+    // chunks are independent. Each chunk stops at its first hazard, and chunks after the earliest one known to have a
+    // hazard stop early, as only the first hazard in address order is reported (same as the serial loop, so error ordering
+    // is stable).
+    std::vector<HazardResult> chunk_hazards(chunk_count);
+    std::atomic<size_t> first_hazard_chunk{chunk_count};
+    workers->ParallelFor(chunk_count, [&](size_t chunk) {
+        const size_t begin = candidates.size() * chunk / chunk_count;
+        const size_t end = candidates.size() * (chunk + 1) / chunk_count;
+        for (size_t i = begin; i < end; ++i) {
+            if (first_hazard_chunk.load(std::memory_order_relaxed) < chunk) return;
+            HazardResult chunk_hazard = detect(*candidates[i]);
+            if (chunk_hazard.IsHazard()) {
+                chunk_hazards[chunk] = std::move(chunk_hazard);
+                size_t current = first_hazard_chunk.load(std::memory_order_relaxed);
+                while (chunk < current && !first_hazard_chunk.compare_exchange_weak(current, chunk)) {
+                }
+                return;
+            }
+        }
+    });
+
+    const size_t first_chunk = first_hazard_chunk.load();
+    if (first_chunk < chunk_count) {
+        hazard = std::move(chunk_hazards[first_chunk]);
+    }
     return hazard;
 }
 
+void AccessContext::BuildFirstUseIndex() { first_use_index_.Build(access_state_map_); }
+
+void FirstUseIndex::Build(const ResourceAccessRangeMap &map) {
+    Clear();
+    for (const auto &access : map) {
+        const auto &first_accesses = access.second.GetFirstAccesses();
+        for (size_t i = 0; i < first_accesses.size(); ++i) {
+            // Several first accesses of a range can share a tag (e.g. the stages of one command)
+            if (i == 0 || first_accesses[i].tag != first_accesses[i - 1].tag) {
+                entries_.push_back({first_accesses[i].tag, &access});
+            }
+        }
+    }
+    // Map iteration is in address order, so a stable sort keeps it within each tag
+    std::stable_sort(entries_.begin(), entries_.end(), [](const Entry &a, const Entry &b) { return a.tag < b.tag; });
+    entries_.shrink_to_fit();
+    built_ = true;
+}
+
+void FirstUseIndex::Clear() {
+    entries_.clear();
+    built_ = false;
+}
+
+void FirstUseIndex::Gather(const ResourceUsageRange &tag_range, std::vector<const Access *> &accesses) const {
+    const size_t gather_begin = accesses.size();
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), tag_range.begin,
+                               [](const Entry &entry, ResourceUsageTag tag) { return entry.tag < tag; });
+    for (; it != entries_.end() && it->tag < tag_range.end; ++it) {
+        accesses.push_back(it->access);
+    }
+    // A range with first accesses at several tags in the range is found once per tag
+    auto by_address = [](const Access *a, const Access *b) { return a->first.begin < b->first.begin; };
+    std::sort(accesses.begin() + gather_begin, accesses.end(), by_address);
+    accesses.erase(std::unique(accesses.begin() + gather_begin, accesses.end()), accesses.end());
+}
+
 // For RenderPass time validation this is "start tag", for QueueSubmit, this is the earliest
 // unsynchronized tag for the Queue being tested against (max synchrononous + 1, perhaps)
 ResourceUsageTag AccessContext::AsyncReference::StartTag() const { return (tag_ == kInvalidTag) ? context_->StartTag() : tag_; }
@@ -25,6 +25,9 @@ namespace vvl {
 class Buffer;
 class VideoSession;
 class VideoPictureResource;
+class CheckProfiler;
+class ValidationBudget;
+class WorkerPool;
 }  // namespace vvl
 
 namespace syncval_state {
@@ -33,6 +36,8 @@ class ImageViewState;
 }  // namespace syncval_state
 bool SimpleBinding(const vvl::Bindable &bindable);
 VkDeviceSize ResourceBaseAddress(const vvl::Buffer &buffer);
+// Address range of the buffer memory an access to range covers, empty when the buffer accesses aren't tracked
+ResourceAccessRange BufferMemoryRange(const vvl::Buffer &buffer, const ResourceAccessRange &range);
 
 // ForEachEntryInRangesUntil -- Execute Action for each map entry in the generated ranges until it returns true
 //
@@ -241,6 +246,36 @@ class AttachmentViewGen {
 
 using AttachmentViewGenVector = std::vector<AttachmentViewGen>;
 
+// Access state map entries by the tags of their first accesses, built once a recording is complete so that validating it
+// against a queue or a primary command buffer only visits the entries with first accesses in each tag range.
+// It points into the indexed map, so copies start out empty, and the context clears it whenever it changes the map.
+class FirstUseIndex {
+  public:
+    using Access = ResourceAccessRangeMap::value_type;
+
+    FirstUseIndex() = default;
+    FirstUseIndex(const FirstUseIndex &) {}
+    FirstUseIndex &operator=(const FirstUseIndex &) {
+        Clear();
+        return *this;
+    }
+
+    void Build(const ResourceAccessRangeMap &map);
+    void Clear();
+    bool IsBuilt() const { return built_; }
+    // Appends the entries with a first access in tag_range, in address order
+    void Gather(const ResourceUsageRange &tag_range, std::vector<const Access *> &accesses) const;
+    size_t Size() const { return entries_.size(); }
+
+  private:
+    struct Entry {
+        ResourceUsageTag tag;
+        const Access *access;
+    };
+    std::vector<Entry> entries_;  // sorted by tag, then address
+    bool built_ = false;
+};
+
 class AccessContext {
   public:
     using ImageState = syncval_state::ImageState;
@@ -281,8 +316,9 @@ class AccessContext {
                                           const VkImageSubresourceRange &subresource_range, DetectOptions options) const;
     HazardResult DetectSubpassTransitionHazard(const TrackBack &track_back, const AttachmentViewGen &attach_view) const;
 
-    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                      const AccessContext &access_context) const;
+    // With workers, large maps are checked in parallel. The reported hazard is still the first one in address order.
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+                                      vvl::WorkerPool *workers = nullptr) const;
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
@@ -293,6 +329,8 @@ class AccessContext {
         dst_external_ = TrackBack();
         start_tag_ = ResourceUsageTag();
         access_state_map_.clear();
+        coalesced_size_ = 0;
+        first_use_index_.Clear();
     }
 
     void ResolvePreviousAccesses();
@@ -340,9 +378,19 @@ class AccessContext {
     AccessContext(const AccessContext &copy_from) = default;
     void Trim();
     void TrimAndClearFirstAccess();
+    // Called once the context is complete (e.g. at vkEndCommandBuffer), to speed up the DetectFirstUseHazard of later replays.
+    void BuildFirstUseIndex();
+    const FirstUseIndex &GetFirstUseIndex() const { return first_use_index_; }
+    // Merge adjacent ranges with equal state once the map has grown by growth_threshold ranges since the last pass.
+    // Unlike Trim, the states are not normalized, so this is safe while recording. A threshold of 0 disables it.
+    void Coalesce(size_t growth_threshold);
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
 
-    ResourceAccessRangeMap &GetAccessStateMap() { return access_state_map_; }
+    // The caller may change the map, which invalidates the first use index
+    ResourceAccessRangeMap &GetAccessStateMap() {
+        first_use_index_.Clear();
+        return access_state_map_;
+    }
     const ResourceAccessRangeMap &GetAccessStateMap() const { return access_state_map_; }
     const TrackBack *GetTrackBackFromSubpass(uint32_t subpass) const {
         if (subpass == VK_SUBPASS_EXTERNAL) {
@@ -354,6 +402,13 @@ class AccessContext {
     }
 
     void SetStartTag(ResourceUsageTag tag) { start_tag_ = tag; }
+    // The budget of the device owning the context, hazard detection is skipped while it sheds sync validation. Subpass
+    // contexts take it from their external context. Null (contexts not owned by a device) never sheds.
+    void SetValidationBudget(vvl::ValidationBudget *budget) { validation_budget_ = budget; }
+    vvl::ValidationBudget *GetValidationBudget() const { return validation_budget_; }
+    // The profiler of the device owning the context, which times hazard detection. Inherited and kept like the budget.
+    void SetCheckProfiler(vvl::CheckProfiler *profiler) { check_profiler_ = profiler; }
+    vvl::CheckProfiler *GetCheckProfiler() const { return check_profiler_; }
     ResourceUsageTag StartTag() const { return start_tag_; }
 
     template <typename Action>
@@ -456,6 +511,10 @@ class AccessContext {
     TrackBack *src_external_;
     TrackBack dst_external_;
     ResourceUsageTag start_tag_;
+    size_t coalesced_size_ = 0;  // access map size after the last Coalesce
+    FirstUseIndex first_use_index_;
+    vvl::ValidationBudget *validation_budget_ = nullptr;  // not cleared by Reset(), it belongs to the owner
+    vvl::CheckProfiler *check_profiler_ = nullptr;        // same
 };
 
 // The semantics of the InfillUpdateOps of infill_update_range are slightly different than for the UpdateMemoryAccessState Action
@@ -486,6 +545,7 @@ struct ActionToOpsAdapter {
 template <typename Action>
 void AccessContext::ApplyToContext(const Action &barrier_action) {
     // Note: Barriers do *not* cross context boundaries, applying to accessess within.... (at least for renderpass subpasses)
+    first_use_index_.Clear();
     UpdateMemoryAccessRangeState(access_state_map_, barrier_action, kFullRange);
 }
 
@@ -499,6 +559,7 @@ void AccessContext::UpdateMemoryAccessRangeState(ResourceAccessRangeMap &accesse
 template <typename Action, typename RangeGen>
 void AccessContext::UpdateMemoryAccessState(const Action &action, RangeGen &range_gen) {
     ActionToOpsAdapter<Action> ops{action};
+    first_use_index_.Clear();
     infill_update_rangegen(access_state_map_, range_gen, ops);
 }
 
@@ -690,18 +751,30 @@ HazardResult AccessContext::DetectPreviousHazard(Detector &detector, const Resou
 template <typename Predicate>
 void AccessContext::EraseIf(Predicate &&pred) {
     // Note: Don't forward, we don't want r-values moved, since we're going to make multiple calls.
+    first_use_index_.Clear();
     vvl::EraseIf(access_state_map_, pred);
 }
 
 template <typename ResolveOp>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
+    first_use_index_.Clear();
+    if (access_state_map_.empty() && !infill_state && !recur_to_infill) {
+        // Typically the first batch a queue batch imports. With nothing to merge into, the resolve is a copy of the source map
+        // with the barriers applied, and the copied states share their read and first access storage with the source ones.
+        access_state_map_ = from_context.access_state_map_;
+        for (auto &entry : access_state_map_) {
+            resolve_op(&entry.second);
+        }
+        return;
+    }
     from_context.ResolveAccessRange(kFullRange, resolve_op, &access_state_map_, infill_state, recur_to_infill);
 }
 
 template <typename ResolveOp, typename RangeGenerator>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context, RangeGenerator range_gen,
                                        const ResourceAccessState *infill_state, bool recur_to_infill) {
+    first_use_index_.Clear();
     for (; range_gen->non_empty(); ++range_gen) {
         from_context.ResolveAccessRange(*range_gen, resolve_op, &access_state_map_, infill_state, recur_to_infill);
     }
@@ -59,8 +59,8 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
         // Otherwise test against last_write
         //
         // Look for casus belli for WAR
-        if (last_reads.size()) {
-            for (const auto &read_access : last_reads) {
+        if (last_reads->size()) {
+            for (const auto &read_access : *last_reads) {
                 if (IsReadHazard(usage_stage, read_access)) {
                     hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.tag);
                     break;
@@ -84,7 +84,6 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
                                                QueueId queue_id) const {
     // The ordering guarantees act as barriers to the last accesses, independent of synchronization operations
     HazardResult hazard;
-    const auto &usage_bit = usage_info.stage_access_bit;
     const auto &usage_stage = usage_info.stage_mask;
     const auto &usage_index = usage_info.stage_access_index;
     const bool input_attachment_ordering = ordering.access_scope[SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ];
@@ -114,8 +113,9 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
         return DetectBarrierHazard(usage_info, queue_id, ordering.exec_scope, ordering.access_scope);
     } else {
         // Only check for WAW if there are no reads since last_write
-        const bool usage_write_is_ordered = (usage_bit & ordering.access_scope).any();
-        if (last_reads.size()) {
+        // The usage is a single stage/access bit, so test it in place rather than building the intersection of the masks
+        const bool usage_write_is_ordered = ordering.access_scope[usage_index];
+        if (last_reads->size()) {
             // Look for any WAR hazards outside the ordered set of stages
             VkPipelineStageFlags2KHR ordered_stages = VK_PIPELINE_STAGE_2_NONE;
             if (usage_write_is_ordered) {
@@ -124,7 +124,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
             }
             // If we're tracking any reads that aren't ordered against the current write, got to check 'em all.
             if ((ordered_stages & last_read_stages) != last_read_stages) {
-                for (const auto &read_access : last_reads) {
+                for (const auto &read_access : *last_reads) {
                     if (read_access.stage & ordered_stages) continue;  // but we can skip the ordered ones
                     if (IsReadHazard(usage_stage, read_access)) {
                         hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.tag);
@@ -151,7 +151,7 @@ HazardResult ResourceAccessState::DetectHazard(const ResourceAccessState &record
                                                const ResourceUsageRange &tag_range) const {
     HazardResult hazard;
     using Size = FirstAccesses::size_type;
-    const auto &recorded_accesses = recorded_use.first_accesses_;
+    const auto &recorded_accesses = *recorded_use.first_accesses_;
     Size count = recorded_accesses.size();
     if (count) {
         // First access is only closed if the last is a write
@@ -223,9 +223,9 @@ HazardResult ResourceAccessState::DetectAsyncHazard(const SyncStageAccessInfoTyp
     } else {
         if (last_write.has_value() && (last_write->tag_ >= start_tag)) {
             hazard.Set(this, usage_info, WRITE_RACING_WRITE, *last_write);
-        } else if (last_reads.size() > 0) {
+        } else if (last_reads->size() > 0) {
             // Any reads during the other subpass will conflict with this write, so we need to check them all.
-            for (const auto &read_access : last_reads) {
+            for (const auto &read_access : *last_reads) {
                 if (read_access.tag >= start_tag) {
                     hazard.Set(this, usage_info, WRITE_RACING_READ, read_access.access, read_access.tag);
                     break;
@@ -239,7 +239,7 @@ HazardResult ResourceAccessState::DetectAsyncHazard(const SyncStageAccessInfoTyp
 HazardResult ResourceAccessState::DetectAsyncHazard(const ResourceAccessState &recorded_use, const ResourceUsageRange &tag_range,
                                                     ResourceUsageTag start_tag) const {
     HazardResult hazard;
-    for (const auto &first : recorded_use.first_accesses_) {
+    for (const auto &first : *recorded_use.first_accesses_) {
         // Skip and quit logic
         if (first.tag < tag_range.begin) continue;
         if (first.tag >= tag_range.end) break;
@@ -261,9 +261,9 @@ HazardResult ResourceAccessState::DetectBarrierHazard(const SyncStageAccessInfoT
     HazardResult hazard;
     // only test for WAW if there no intervening read operations.
     // See DetectHazard(SyncStagetAccessIndex) above for more details.
-    if (last_reads.size()) {
+    if (last_reads->size()) {
         // Look at the reads if any
-        for (const auto &read_access : last_reads) {
+        for (const auto &read_access : *last_reads) {
             if (read_access.IsReadBarrierHazard(queue_id, src_exec_scope)) {
                 hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.tag);
                 break;
@@ -291,18 +291,18 @@ HazardResult ResourceAccessState::DetectBarrierHazard(const SyncStageAccessInfoT
     } else {
         // only test for WAW if there no intervening read operations.
         // See DetectHazard(SyncStagetAccessIndex) above for more details.
-        if (last_reads.size()) {
+        if (last_reads->size()) {
             // Look at the reads if any... if reads exist, they are either the reason the access is in the event
             // first scope, or they are a hazard.
-            const ReadStates &scope_reads = scope_state.last_reads;
+            const ReadStates &scope_reads = *scope_state.last_reads;
             const ReadStates::size_type scope_read_count = scope_reads.size();
             // Since the hasn't been a write:
             //  * The current read state is a superset of the scoped one
             //  * The stage order is the same.
-            assert(last_reads.size() >= scope_read_count);
+            assert(last_reads->size() >= scope_read_count);
             for (ReadStates::size_type read_idx = 0; read_idx < scope_read_count; ++read_idx) {
                 const ReadState &scope_read = scope_reads[read_idx];
-                const ReadState &current_read = last_reads[read_idx];
+                const ReadState &current_read = (*last_reads)[read_idx];
                 assert(scope_read.stage == current_read.stage);
                 if (current_read.tag > event_tag) {
                     // The read is more recent than the set event scope, thus no barrier from the wait/ILT.
@@ -318,8 +318,8 @@ HazardResult ResourceAccessState::DetectBarrierHazard(const SyncStageAccessInfoT
                     }
                 }
             }
-            if (!hazard.IsHazard() && (last_reads.size() > scope_read_count)) {
-                const ReadState &current_read = last_reads[scope_read_count];
+            if (!hazard.IsHazard() && (last_reads->size() > scope_read_count)) {
+                const ReadState &current_read = (*last_reads)[scope_read_count];
                 hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.access, current_read.tag);
             }
         } else if (last_write.has_value()) {
@@ -339,17 +339,25 @@ void ResourceAccessState::MergePending(const ResourceAccessState &other) {
 }
 
 void ResourceAccessState::MergeReads(const ResourceAccessState &other) {
+    read_execution_barriers |= other.read_execution_barriers;
+    // Merging a read set with itself leaves it unchanged, which is the common case for states copied from the same source
+    if (other.last_reads->empty() || last_reads.SharesWith(other.last_reads)) {
+        return;
+    }
+
     // Merge the read states
-    const auto pre_merge_count = last_reads.size();
+    ReadStates &reads = last_reads.Mutable();
+    const ReadStates &other_reads = *other.last_reads;
+    const auto pre_merge_count = reads.size();
     const auto pre_merge_stages = last_read_stages;
-    for (uint32_t other_read_index = 0; other_read_index < other.last_reads.size(); other_read_index++) {
-        auto &other_read = other.last_reads[other_read_index];
+    for (uint32_t other_read_index = 0; other_read_index < other_reads.size(); other_read_index++) {
+        auto &other_read = other_reads[other_read_index];
         if (pre_merge_stages & other_read.stage) {
             // Merge in the barriers for read stages that exist in *both* this and other
             // TODO: This is N^2 with stages... perhaps the ReadStates should be sorted by stage index.
             //       but we should wait on profiling data for that.
             for (uint32_t my_read_index = 0; my_read_index < pre_merge_count; my_read_index++) {
-                auto &my_read = last_reads[my_read_index];
+                auto &my_read = reads[my_read_index];
                 if (other_read.stage == my_read.stage) {
                     if (my_read.tag < other_read.tag) {
                         // Other is more recent, copy in the state
@@ -378,14 +386,13 @@ void ResourceAccessState::MergeReads(const ResourceAccessState &other) {
             }
         } else {
             // The other read stage doesn't exist in this, so add it.
-            last_reads.emplace_back(other_read);
+            reads.emplace_back(other_read);
             last_read_stages |= other_read.stage;
             if (other_read.stage == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR) {
                 input_attachment_read = other.input_attachment_read;
             }
         }
     }
-    read_execution_barriers |= other.read_execution_barriers;
 }
 
 // The logic behind resolves is the same as update, we assume that earlier hazards have be reported, and that no
@@ -434,12 +441,12 @@ void ResourceAccessState::Resolve(const ResourceAccessState &other) {
     // of the copy and other into this using the update first logic.
     // NOTE: All sorts of additional cleverness could be put into short circuts.  (for example back is write and is before front
     //       of the other first_accesses... )
-    if (!skip_first && !(first_accesses_ == other.first_accesses_) && !other.first_accesses_.empty()) {
-        FirstAccesses firsts(std::move(first_accesses_));
+    if (!skip_first && !(first_accesses_ == other.first_accesses_) && !other.first_accesses_->empty()) {
+        const vvl::CopyOnWrite<FirstAccesses> firsts(std::move(first_accesses_));
         ClearFirstUse();
-        auto a = firsts.begin();
-        auto a_end = firsts.end();
-        for (auto &b : other.first_accesses_) {
+        auto a = firsts->begin();
+        auto a_end = firsts->end();
+        for (auto &b : *other.first_accesses_) {
             // TODO: Determine whether some tag offset will be needed for PHASE II
             while ((a != a_end) && (a->tag < b.tag)) {
                 UpdateFirst(a->tag, *a->usage_info, a->ordering_rule);
@@ -463,7 +470,7 @@ void ResourceAccessState::Update(const SyncStageAccessInfoType &usage_info, Sync
         // However, for purposes of barrier tracking, only one read per pipeline stage matters
         if (usage_stage & last_read_stages) {
             const auto not_usage_stage = ~usage_stage;
-            for (auto &read_access : last_reads) {
+            for (auto &read_access : last_reads.Mutable()) {
                 if (read_access.stage == usage_stage) {
                     read_access.Set(usage_stage, usage_bit, 0, tag);
                 } else if (read_access.barriers & usage_stage) {
@@ -477,19 +484,20 @@ void ResourceAccessState::Update(const SyncStageAccessInfoType &usage_info, Sync
                 }
             }
         } else {
-            for (auto &read_access : last_reads) {
+            ReadStates &reads = last_reads.Mutable();
+            for (auto &read_access : reads) {
                 if (read_access.barriers & usage_stage) {
                     read_access.sync_stages |= usage_stage;
                 }
             }
-            last_reads.emplace_back(usage_stage, usage_bit, 0, tag);
+            reads.emplace_back(usage_stage, usage_bit, 0, tag);
             last_read_stages |= usage_stage;
         }
 
         // Fragment shader reads come in two flavors, and we need to track if the one we're tracking is the special one.
         if (usage_stage == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR) {
             // TODO Revisit re: multiple reads for a given stage
-            input_attachment_read = (usage_bit == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT);
+            input_attachment_read = (usage_info.stage_access_index == SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ);
         }
     } else {
         // Assume write
@@ -535,7 +543,7 @@ void ResourceAccessState::SetWrite(const SyncStageAccessInfoType &usage_info, co
 void ResourceAccessState::ClearWrite() { last_write.reset(); }
 
 void ResourceAccessState::ClearRead() {
-    last_reads.clear();
+    last_reads.Clear();
     last_read_stages = VK_PIPELINE_STAGE_2_NONE;
     read_execution_barriers = VK_PIPELINE_STAGE_2_NONE;
     input_attachment_read = false;  // Denotes no outstanding input attachment read after the last write.
@@ -547,7 +555,7 @@ void ResourceAccessState::ClearPending() {
 }
 
 void ResourceAccessState::ClearFirstUse() {
-    first_accesses_.clear();
+    first_accesses_.Clear();
     first_read_stages_ = VK_PIPELINE_STAGE_2_NONE;
     first_write_layout_ordering_ = OrderingBarrier();
     first_access_closed_ = false;
@@ -567,8 +575,10 @@ void ResourceAccessState::ApplyPendingBarriers(const ResourceUsageTag tag) {
     } else {
         // Apply the accumulate execution barriers (and thus update chaining information)
         // for layout transition, last_reads is reset by SetWrite, so this will be skipped.
-        for (auto &read_access : last_reads) {
-            read_execution_barriers |= read_access.ApplyPendingBarriers();
+        if (!last_reads->empty()) {
+            for (auto &read_access : last_reads.Mutable()) {
+                read_execution_barriers |= read_access.ApplyPendingBarriers();
+            }
         }
 
         // We OR in the accumulated write chain and barriers even in the case of a layout transition as SetWrite zeros them.
@@ -584,13 +594,15 @@ void ResourceAccessState::ApplySemaphore(const SemaphoreScope &signal, const Sem
     // Semaphores only guarantee the first scope of the signal is before the second scope of the wait.
     // If any access isn't in the first scope, there are no guarantees, thus those barriers are cleared
     assert(signal.queue != wait.queue);
-    for (auto &read_access : last_reads) {
-        if (read_access.ReadInQueueScopeOrChain(signal.queue, signal.exec_scope)) {
-            // Deflects WAR on wait queue
-            read_access.barriers = wait.exec_scope;
-        } else {
-            // Leave sync stages alone. Update method will clear unsynchronized stages on subsequent reads as needed.
-            read_access.barriers = VK_PIPELINE_STAGE_2_NONE;
+    if (!last_reads->empty()) {
+        for (auto &read_access : last_reads.Mutable()) {
+            if (read_access.ReadInQueueScopeOrChain(signal.queue, signal.exec_scope)) {
+                // Deflects WAR on wait queue
+                read_access.barriers = wait.exec_scope;
+            } else {
+                // Leave sync stages alone. Update method will clear unsynchronized stages on subsequent reads as needed.
+                read_access.barriers = VK_PIPELINE_STAGE_2_NONE;
+            }
         }
     }
     if (WriteInQueueSourceScopeOrChain(signal.queue, signal.exec_scope, signal.valid_accesses)) {
@@ -638,18 +650,22 @@ bool ResourceAccessState::WaitAcquirePredicate::operator()(const ResourceAccessS
 }
 
 bool ResourceAccessState::FirstAccessInTagRange(const ResourceUsageRange &tag_range) const {
-    if (!first_accesses_.size()) return false;
-    const ResourceUsageRange first_access_range = {first_accesses_.front().tag, first_accesses_.back().tag + 1};
+    if (!first_accesses_->size()) return false;
+    const ResourceUsageRange first_access_range = {first_accesses_->front().tag, first_accesses_->back().tag + 1};
     return tag_range.intersects(first_access_range);
 }
 
 void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
     if (last_write.has_value()) last_write->OffsetTag(offset);
-    for (auto &read_access : last_reads) {
-        read_access.tag += offset;
+    if (!last_reads->empty()) {
+        for (auto &read_access : last_reads.Mutable()) {
+            read_access.tag += offset;
+        }
     }
-    for (auto &first : first_accesses_) {
-        first.tag += offset;
+    if (!first_accesses_->empty()) {
+        for (auto &first : first_accesses_.Mutable()) {
+            first.tag += offset;
+        }
     }
 }
 
@@ -670,7 +686,7 @@ ResourceAccessState::ResourceAccessState()
 VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAccessFlags &usage_bit) const {
     VkPipelineStageFlags2KHR barriers = VK_PIPELINE_STAGE_2_NONE;
 
-    for (const auto &read_access : last_reads) {
+    for (const auto &read_access : *last_reads) {
         if ((read_access.access & usage_bit).any()) {
             barriers = read_access.barriers;
             break;
@@ -681,9 +697,15 @@ VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAcc
 }
 
 void ResourceAccessState::SetQueueId(QueueId id) {
-    for (auto &read_access : last_reads) {
+    for (const auto &read_access : *last_reads) {
         if (read_access.queue == kQueueIdInvalid) {
-            read_access.queue = id;
+            // Only detach the shared read states when one of them actually changes
+            for (auto &mutable_read : last_reads.Mutable()) {
+                if (mutable_read.queue == kQueueIdInvalid) {
+                    mutable_read.queue = id;
+                }
+            }
+            break;
         }
     }
     if (last_write.has_value()) last_write->SetQueueId(id);
@@ -695,7 +717,7 @@ bool ResourceAccessState::IsWriteBarrierHazard(QueueId queue_id, VkPipelineStage
 }
 
 bool ResourceAccessState::WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope,
-                                                    SyncStageAccessFlags src_access_scope) const {
+                                                    const SyncStageAccessFlags &src_access_scope) const {
     return last_write.has_value() && last_write->WriteInSourceScopeOrChain(src_exec_scope, src_access_scope);
 }
 
@@ -715,7 +737,10 @@ bool operator<(const ResourceAccessState::ReadState &lhs, const ResourceAccessSt
 }
 
 void ResourceAccessState::Normalize() {
-    std::sort(last_reads.begin(), last_reads.end());
+    if (!std::is_sorted(last_reads->begin(), last_reads->end())) {
+        ReadStates &reads = last_reads.Mutable();
+        std::sort(reads.begin(), reads.end());
+    }
     ClearFirstUse();
 }
 
@@ -724,7 +749,7 @@ void ResourceAccessState::GatherReferencedTags(ResourceUsageTagSet &used) const
         used.CachedInsert(last_write->Tag());
     }
 
-    for (const auto &read_access : last_reads) {
+    for (const auto &read_access : *last_reads) {
         used.CachedInsert(read_access.tag);
     }
 }
@@ -744,7 +769,7 @@ VkPipelineStageFlags2 ResourceAccessState::GetOrderedStages(QueueId queue_id, co
     // At apply queue submission order limits on the effect of ordering
     VkPipelineStageFlags2 non_qso_stages = VK_PIPELINE_STAGE_2_NONE;
     if (queue_id != kQueueIdInvalid) {
-        for (const auto &read_access : last_reads) {
+        for (const auto &read_access : *last_reads) {
             if (read_access.queue != queue_id) {
                 non_qso_stages |= read_access.stage;
             }
@@ -775,7 +800,7 @@ void ResourceAccessState::UpdateFirst(const ResourceUsageTag tag, const SyncStag
             first_read_stages_ |= usage_stage;
             if (0 == (read_execution_barriers & usage_stage)) {
                 // If this stage isn't masked then we add it (since writes map to usage_stage 0, this also records writes)
-                first_accesses_.emplace_back(tag, usage_info, ordering_rule);
+                first_accesses_.Mutable().emplace_back(tag, usage_info, ordering_rule);
                 first_access_closed_ = !is_read;
             }
         }
@@ -784,10 +809,10 @@ void ResourceAccessState::UpdateFirst(const ResourceUsageTag tag, const SyncStag
 
 void ResourceAccessState::TouchupFirstForLayoutTransition(ResourceUsageTag tag, const OrderingBarrier &layout_ordering) {
     // Only call this after recording an image layout transition
-    assert(first_accesses_.size());
-    if (first_accesses_.back().tag == tag) {
+    assert(first_accesses_->size());
+    if (first_accesses_->back().tag == tag) {
         // If this layout transition is the the first write, add the additional ordering rules that guard the ILT
-        assert(first_accesses_.back().usage_info->stage_access_index == SyncStageAccessIndex::SYNC_IMAGE_LAYOUT_TRANSITION);
+        assert(first_accesses_->back().usage_info->stage_access_index == SyncStageAccessIndex::SYNC_IMAGE_LAYOUT_TRANSITION);
         first_write_layout_ordering_ = layout_ordering;
     }
 }
@@ -919,7 +944,7 @@ bool ResourceAccessWriteState::WriteInScope(const SyncStageAccessFlags &src_acce
 }
 
 bool ResourceAccessWriteState::WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope,
-                                                         SyncStageAccessFlags src_access_scope) const {
+                                                         const SyncStageAccessFlags &src_access_scope) const {
     assert(access_);
     return WriteInChain(src_exec_scope) || WriteInScope(src_access_scope);
 }
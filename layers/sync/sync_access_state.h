@@ -17,6 +17,7 @@
 
 #pragma once
 #include "sync/sync_common.h"
+#include "containers/copy_on_write.h"
 
 class ResourceAccessState;
 class ResourceAccessWriteState;
@@ -208,7 +209,7 @@ class ResourceAccessWriteState {
     }
     bool WriteInChain(VkPipelineStageFlags2KHR src_exec_scope) const;
     bool WriteInScope(const SyncStageAccessFlags &src_access_scope) const;
-    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const;
+    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInQueueSourceScopeOrChain(QueueId queue, VkPipelineStageFlags2KHR src_exec_scope,
                                         const SyncStageAccessFlags &src_access_scope) const;
 
@@ -376,6 +377,7 @@ class ResourceAccessState : public SyncStageAccess {
     bool ApplyPredicatedWait(Predicate &predicate);
 
     bool FirstAccessInTagRange(const ResourceUsageRange &tag_range) const;
+    const FirstAccesses &GetFirstAccesses() const { return *first_accesses_; }
 
     void OffsetTag(ResourceUsageTag offset);
     ResourceAccessState();
@@ -391,9 +393,10 @@ class ResourceAccessState : public SyncStageAccess {
 
         const bool read_write_same = write_same && (last_read_stages == rhs.last_read_stages) && (last_reads == rhs.last_reads);
 
-        const bool same = read_write_same && (first_accesses_ == rhs.first_accesses_) &&
-                          (first_read_stages_ == rhs.first_read_stages_) &&
-                          (first_write_layout_ordering_ == rhs.first_write_layout_ordering_);
+        const bool same = read_write_same && (pending_layout_transition == rhs.pending_layout_transition) &&
+                          (first_accesses_ == rhs.first_accesses_) && (first_read_stages_ == rhs.first_read_stages_) &&
+                          (first_write_layout_ordering_ == rhs.first_write_layout_ordering_) &&
+                          (first_access_closed_ == rhs.first_access_closed_);
 
         return same;
     }
@@ -406,7 +409,7 @@ class ResourceAccessState : public SyncStageAccess {
 
     bool IsWriteBarrierHazard(QueueId queue_id, VkPipelineStageFlags2KHR src_exec_scope,
                               const SyncStageAccessFlags &src_access_scope) const;
-    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, SyncStageAccessFlags src_access_scope) const;
+    bool WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInQueueSourceScopeOrChain(QueueId queue, VkPipelineStageFlags2KHR src_exec_scope,
                                         const SyncStageAccessFlags &src_access_scope) const;
     bool WriteInEventScope(VkPipelineStageFlags2KHR src_exec_scope, const SyncStageAccessFlags &src_access_scope,
@@ -489,7 +492,8 @@ class ResourceAccessState : public SyncStageAccess {
     VkPipelineStageFlags2KHR last_read_stages;
     VkPipelineStageFlags2KHR read_execution_barriers;
     using ReadStates = small_vector<ReadState, 3, uint32_t>;
-    ReadStates last_reads;
+    // Shared between the copies made by range splits and context copies until one of them changes
+    vvl::CopyOnWrite<ReadStates> last_reads;
 
     // TODO Input Attachment cleanup for multiple reads in a given stage
     // Tracks whether the fragment shader read is input attachment read
@@ -499,7 +503,7 @@ class ResourceAccessState : public SyncStageAccess {
     // Pending execution state to support independent parallel barriers
     bool pending_layout_transition;
 
-    FirstAccesses first_accesses_;
+    vvl::CopyOnWrite<FirstAccesses> first_accesses_;
     VkPipelineStageFlags2KHR first_read_stages_;
     OrderingBarrier first_write_layout_ordering_;
     bool first_access_closed_;
@@ -539,7 +543,7 @@ void ResourceAccessState::ApplyBarrier(ScopeOps &&scope, const SyncBarrier &barr
             // don't need to be tracked as we're just going to clear them.
             VkPipelineStageFlags2 stages_in_scope = VK_PIPELINE_STAGE_2_NONE;
 
-            for (auto &read_access : last_reads) {
+            for (const auto &read_access : *last_reads) {
                 // The | implements the "dependency chain" logic for this access, as the barriers field stores the second sync
                 // scope
                 if (scope.ReadInScope(barrier, read_access)) {
@@ -548,7 +552,10 @@ void ResourceAccessState::ApplyBarrier(ScopeOps &&scope, const SyncBarrier &barr
                 }
             }
 
-            for (auto &read_access : last_reads) {
+            if (stages_in_scope == VK_PIPELINE_STAGE_2_NONE) {
+                return;
+            }
+            for (auto &read_access : last_reads.Mutable()) {
                 if (0 != ((read_access.stage | read_access.sync_stages) & stages_in_scope)) {
                     // If this stage, or any stage known to be synchronized after it are in scope, apply the barrier to this
                     // read NOTE: Forwarding barriers to known prior stages changes the sync_stages from shallow to deep,
@@ -568,7 +575,7 @@ bool ResourceAccessState::ApplyPredicatedWait(Predicate &predicate) {
 
     // Use the predicate to build a mask of the read stages we are synchronizing
     // Use the sync_stages to also detect reads known to be before any synchronized reads (first pass)
-    for (auto &read_access : last_reads) {
+    for (const auto &read_access : *last_reads) {
         if (predicate(read_access)) {
             // If we know this stage is before any stage we syncing, or if the predicate tells us that we are waited for..
             sync_reads |= read_access.stage;
@@ -578,7 +585,7 @@ bool ResourceAccessState::ApplyPredicatedWait(Predicate &predicate) {
     // Now that we know the reads directly in scopejust need to go over the list again to pick up the "known earlier" stages.
     // NOTE: sync_stages is "deep" catching all stages synchronized after it because we forward barriers
     uint32_t unsync_count = 0;
-    for (auto &read_access : last_reads) {
+    for (const auto &read_access : *last_reads) {
         if (0 != ((read_access.stage | read_access.sync_stages) & sync_reads)) {
             // This is redundant in the "stage" case, but avoids a second branch to get an accurate count
             sync_reads |= read_access.stage;
@@ -593,7 +600,7 @@ bool ResourceAccessState::ApplyPredicatedWait(Predicate &predicate) {
             ReadStates unsync_reads;
             unsync_reads.reserve(unsync_count);
             VkPipelineStageFlags2KHR unsync_read_stages = VK_PIPELINE_STAGE_2_NONE;
-            for (auto &read_access : last_reads) {
+            for (const auto &read_access : *last_reads) {
                 if (0 == (read_access.stage & sync_reads)) {
                     unsync_reads.emplace_back(read_access);
                     unsync_read_stages |= read_access.stage;
@@ -607,7 +614,7 @@ bool ResourceAccessState::ApplyPredicatedWait(Predicate &predicate) {
         ClearRead();
     }
 
-    bool all_clear = last_reads.size() == 0;
+    bool all_clear = last_reads->size() == 0;
     if (last_write.has_value()) {
         if (predicate(*this) || sync_reads) {
             // Clear any predicated write, or any the write from any any access with synchronized reads.
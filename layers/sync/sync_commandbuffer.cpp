@@ -81,7 +81,12 @@ CommandBufferAccessContext::CommandBufferAccessContext(const SyncValidator *sync
       events_context_(),
       render_pass_contexts_(),
       current_renderpass_context_(),
-      sync_ops_() {}
+      sync_ops_() {
+    if (sync_validator) {
+        cb_access_context_.SetValidationBudget(sync_validator->validation_budget.get());
+        cb_access_context_.SetCheckProfiler(sync_validator->check_profiler.get());
+    }
+}
 
 // NOTE: Make sure the proxy doesn't outlive from, as the proxy is pointing directly to access contexts owned by from.
 CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccessContext &from, AsProxyContext dummy)
@@ -107,6 +112,46 @@ CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccess
     // We don't want to copy the full render_pass_context_ history just for the proxy.
 }
 
+void DescriptorReadMemo::Stage(ResourceUsageTag tag, const Key &key, const ResourceAccessRange &memory) const {
+    if (tag != staged_tag_) {
+        staged_.clear();
+        staged_tag_ = tag;
+    }
+    staged_.emplace_back(key, memory);
+}
+
+void DescriptorReadMemo::BeginCommand(ResourceUsageTag tag) {
+    // Some other command was recorded since the previous draw or dispatch
+    if (tag != valid_tag_) {
+        entries_.clear();
+    }
+    if (tag == staged_tag_) {
+        for (const auto &staged : staged_) {
+            entries_.insert_or_assign(staged.first, staged.second);
+        }
+    }
+    staged_.clear();
+    staged_tag_ = kInvalidTag;
+    valid_tag_ = tag + 1;
+}
+
+void DescriptorReadMemo::Invalidate(const ResourceAccessRange &written_memory) {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.intersects(written_memory)) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void DescriptorReadMemo::Clear() {
+    entries_.clear();
+    valid_tag_ = kInvalidTag;
+    staged_.clear();
+    staged_tag_ = kInvalidTag;
+}
+
 void CommandBufferAccessContext::Reset() {
     access_log_ = std::make_shared<AccessLog>();
     cbs_referenced_ = std::make_shared<CommandBufferSet>();
@@ -117,16 +162,37 @@ void CommandBufferAccessContext::Reset() {
     command_number_ = 0;
     subcommand_number_ = 0;
     reset_count_++;
-    command_handles_.clear();
+    command_handles_.Clear();
     cb_access_context_.Reset();
     render_pass_contexts_.clear();
     current_context_ = &cb_access_context_;
     current_renderpass_context_ = nullptr;
     events_context_.Clear();
+    descriptor_read_memo_.Clear();
     dynamic_rendering_info_.reset();
     debug_regions_ = DebugRegions{};
 }
 
+void CommandBufferAccessContext::CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const {
+    footprint.AddNodes("SyncVal command buffer access states", cb_access_context_.GetAccessStateMap());
+    for (const auto &rp_context : render_pass_contexts_) {
+        for (const AccessContext &subpass_context : rp_context->GetContexts()) {
+            footprint.AddNodes("SyncVal command buffer access states", subpass_context.GetAccessStateMap());
+        }
+    }
+    // The access log is shared with the batches this command buffer was submitted in, it is only counted here
+    if (access_log_) {
+        footprint.AddVector("SyncVal command buffer access log", *access_log_);
+    }
+    footprint.AddVector("SyncVal command buffer sync ops", sync_ops_);
+    const FirstUseIndex &first_use_index = cb_access_context_.GetFirstUseIndex();
+    using MemoEntry = std::pair<DescriptorReadMemo::Key, ResourceAccessRange>;
+    footprint.Add("SyncVal command buffer descriptor read memo", descriptor_read_memo_.Size(),
+                  vvl::MemoryFootprint::NodeBytes<MemoEntry>(descriptor_read_memo_.Size()));
+    footprint.Add("SyncVal command buffer first use index", first_use_index.Size(),
+                  first_use_index.Size() * (sizeof(ResourceUsageTag) + sizeof(void *)));
+}
+
 std::string CommandBufferAccessContext::FormatUsage(const ResourceUsageTag tag) const {
     if (tag >= access_log_->size()) return std::string();
 
@@ -292,6 +358,9 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
     using ImageDescriptor = vvl::ImageDescriptor;
     using TexelDescriptor = vvl::TexelDescriptor;
 
+    // The tag the draw or dispatch will be recorded with
+    const ResourceUsageTag memo_tag = access_log_->size();
+
     for (const auto &stage_state : pipe->stage_states) {
         const auto raster_state = pipe->RasterizationState();
         if (stage_state.GetStage() == VK_SHADER_STAGE_FRAGMENT_BIT && raster_state && raster_state->rasterizerDiscardEnable) {
@@ -310,6 +379,7 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
             const auto descriptor_type = binding->type;
             SyncStageAccessIndex sync_index =
                 GetSyncStageAccessIndexsByDescriptorSet(descriptor_type, variable, stage_state.GetStage());
+            const bool is_read = SyncStageAccess::IsRead(sync_index);
 
             // Currently, validation of memory accesses based on declared descriptors can produce false-positives.
             // The shader can decide not to do such accesses, it can perform accesses with more narrow scope
@@ -352,7 +422,15 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                             hazard =
                                 current_context_->DetectHazard(*img_view_state, offset, extent, sync_index, SyncOrdering::kRaster);
                         } else {
+                            const DescriptorReadMemo::Key memo_key{img_view_state, ResourceAccessRange(), sync_index};
+                            if (is_read && descriptor_read_memo_.Contains(memo_tag, memo_key)) {
+                                break;
+                            }
                             hazard = current_context_->DetectHazard(*img_view_state, sync_index);
+                            if (is_read && !hazard.IsHazard()) {
+                                const ResourceAccessRange memory = img_view_state->GetImageState()->GetFullMemoryRange();
+                                descriptor_read_memo_.Stage(memo_tag, memo_key, memory);
+                            }
                         }
 
                         if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
@@ -377,7 +455,14 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                         const auto *buf_view_state = texel_descriptor->GetBufferViewState();
                         const auto *buf_state = buf_view_state->buffer_state.get();
                         const ResourceAccessRange range = MakeRange(*buf_view_state);
+                        const DescriptorReadMemo::Key memo_key{buf_state, range, sync_index};
+                        if (is_read && descriptor_read_memo_.Contains(memo_tag, memo_key)) {
+                            break;
+                        }
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                        if (is_read && !hazard.IsHazard()) {
+                            descriptor_read_memo_.Stage(memo_tag, memo_key, BufferMemoryRange(*buf_state, range));
+                        }
                         if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
                             skip |= sync_state_->LogError(
                                 string_SyncHazardVUID(hazard.Hazard()), buf_view_state->buffer_view(), loc,
@@ -400,7 +485,14 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                         const auto *buf_state = buffer_descriptor->GetBufferState();
                         const ResourceAccessRange range =
                             MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
+                        const DescriptorReadMemo::Key memo_key{buf_state, range, sync_index};
+                        if (is_read && descriptor_read_memo_.Contains(memo_tag, memo_key)) {
+                            break;
+                        }
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
+                        if (is_read && !hazard.IsHazard()) {
+                            descriptor_read_memo_.Stage(memo_tag, memo_key, BufferMemoryRange(*buf_state, range));
+                        }
                         if (hazard.IsHazard() && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
                             skip |= sync_state_->LogError(
                                 string_SyncHazardVUID(hazard.Hazard()), buf_state->buffer(), loc,
@@ -426,6 +518,8 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
 
 void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint,
                                                                  const ResourceUsageTag tag) {
+    descriptor_read_memo_.BeginCommand(tag);
+
     const vvl::Pipeline *pipe = nullptr;
     const std::vector<LastBound::PER_SET> *per_sets = nullptr;
     cb_state_->GetCurrentPipelineAndDesriptorSets(pipelineBindPoint, &pipe, &per_sets);
@@ -488,6 +582,9 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
                         } else {
                             current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kNonAttachment, tag);
                         }
+                        if (SyncStageAccess::IsWrite(sync_index)) {
+                            descriptor_read_memo_.Invalidate(img_view_state->GetImageState()->GetFullMemoryRange());
+                        }
                         break;
                     }
                     case DescriptorClass::TexelBuffer: {
@@ -499,6 +596,9 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
                         const auto *buf_state = buf_view_state->buffer_state.get();
                         const ResourceAccessRange range = MakeRange(*buf_view_state);
                         current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag);
+                        if (SyncStageAccess::IsWrite(sync_index)) {
+                            descriptor_read_memo_.Invalidate(BufferMemoryRange(*buf_state, range));
+                        }
                         break;
                     }
                     case DescriptorClass::GeneralBuffer: {
@@ -510,6 +610,9 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
                         const ResourceAccessRange range =
                             MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
                         current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag);
+                        if (SyncStageAccess::IsWrite(sync_index)) {
+                            descriptor_read_memo_.Invalidate(BufferMemoryRange(*buf_state, range));
+                        }
                         break;
                     }
                     // TODO: INLINE_UNIFORM_BLOCK_EXT, ACCELERATION_STRUCTURE_KHR
@@ -694,8 +797,21 @@ bool CommandBufferAccessContext::ValidateDrawDynamicRenderingAttachment(const Lo
 void CommandBufferAccessContext::RecordDrawAttachment(const ResourceUsageTag tag) {
     if (current_renderpass_context_) {
         current_renderpass_context_->RecordDrawSubpassAttachment(*cb_state_, tag);
+        for (const AttachmentViewGen &view_gen : current_renderpass_context_->GetAttachmentViews()) {
+            InvalidateDescriptorReadMemo(view_gen.GetViewState());
+        }
     } else if (dynamic_rendering_info_) {
         RecordDrawDynamicRenderingAttachment(tag);
+        for (const auto &attachment : dynamic_rendering_info_->attachments) {
+            InvalidateDescriptorReadMemo(attachment.view.get());
+        }
+    }
+}
+
+void CommandBufferAccessContext::InvalidateDescriptorReadMemo(const syncval_state::ImageViewState *attachment_view) {
+    // Any attachment of the pass, written by this draw or not, as that is cheaper to tell than the subresources written
+    if (attachment_view && descriptor_read_memo_.Size()) {
+        descriptor_read_memo_.Invalidate(attachment_view->GetImageState()->GetFullMemoryRange());
     }
 }
 
@@ -776,13 +892,14 @@ QueueId CommandBufferAccessContext::GetQueueId() const { return kQueueIdInvalid;
 
 ResourceUsageTag CommandBufferAccessContext::RecordBeginRenderPass(
     vvl::Func command, const vvl::RenderPass &rp_state, const VkRect2D &render_area,
-    const std::vector<const syncval_state::ImageViewState *> &attachment_views) {
+    std::shared_ptr<const AttachmentViewGenVector> attachment_views) {
     // Create an access context the current renderpass.
     const auto barrier_tag = NextCommandTag(command, NamedHandle("renderpass", rp_state.Handle()),
                                             ResourceUsageRecord::SubcommandType::kSubpassTransition);
     const auto load_tag = NextSubcommandTag(command, ResourceUsageRecord::SubcommandType::kLoadOp);
     render_pass_contexts_.emplace_back(
-        std::make_unique<RenderPassAccessContext>(rp_state, render_area, GetQueueFlags(), attachment_views, &cb_access_context_));
+        std::make_unique<RenderPassAccessContext>(rp_state, render_area, GetQueueFlags(), std::move(attachment_views),
+                                                  &cb_access_context_));
     current_renderpass_context_ = render_pass_contexts_.back().get();
     current_renderpass_context_->RecordBeginRenderPass(barrier_tag, load_tag);
     current_context_ = &current_renderpass_context_->CurrentContext();
@@ -803,6 +920,14 @@ ResourceUsageTag CommandBufferAccessContext::RecordNextSubpass(vvl::Func command
     return barrier_tag;
 }
 
+void CommandBufferAccessContext::RecordEndCommandBuffer() {
+    // Every submission and every vkCmdExecuteCommands of this command buffer replays the final access map against the
+    // target context. Merge the equal neighbouring ranges left over by the recording once, and index the first accesses
+    // by tag so that each replayed sync op only visits the ranges it can hazard with.
+    cb_access_context_.Coalesce(1);
+    cb_access_context_.BuildFirstUseIndex();
+}
+
 ResourceUsageTag CommandBufferAccessContext::RecordEndRenderPass(vvl::Func command) {
     assert(current_renderpass_context_);
     if (!current_renderpass_context_) return NextCommandTag(command);
@@ -853,8 +978,9 @@ ResourceUsageTag CommandBufferAccessContext::NextSubcommandTag(vvl::Func command
                                                                ResourceUsageRecord::SubcommandType subcommand) {
     ResourceUsageTag next = access_log_->size();
     access_log_->emplace_back(command, command_number_, subcommand, ++subcommand_number_, cb_state_, reset_count_);
-    if (command_handles_.size()) {
-        // This is a duplication, but it keeps tags->log information flat (i.e not depending on some "command tag" entry
+    if (command_handles_->size()) {
+        // This is shared with the command record, and keeps tags->log information flat (i.e not depending on some "command tag"
+        // entry
         access_log_->back().handles = command_handles_;
     }
     if (handle) {
@@ -863,6 +989,7 @@ ResourceUsageTag CommandBufferAccessContext::NextSubcommandTag(vvl::Func command
     if (!debug_regions_.commands.empty()) {
         access_log_->back().debug_region_command_index = static_cast<uint32_t>(debug_regions_.commands.size() - 1);
     }
+    LimitAccessLogDetail();
     return next;
 }
 
@@ -873,21 +1000,31 @@ ResourceUsageTag CommandBufferAccessContext::NextCommandTag(vvl::Func command, R
 ResourceUsageTag CommandBufferAccessContext::NextCommandTag(vvl::Func command, NamedHandle &&handle,
                                                             ResourceUsageRecord::SubcommandType subcommand) {
     command_number_++;
-    command_handles_.clear();
+    command_handles_.Clear();
     subcommand_number_ = 0;
     ResourceUsageTag next = access_log_->size();
     access_log_->emplace_back(command, command_number_, subcommand, subcommand_number_, cb_state_, reset_count_);
     if (handle) {
-        access_log_->back().AddHandle(handle);
-        command_handles_.emplace_back(std::move(handle));
+        command_handles_.Mutable().emplace_back(std::move(handle));
+        access_log_->back().handles = command_handles_;
     }
     if (!debug_regions_.commands.empty()) {
         access_log_->back().debug_region_command_index = static_cast<uint32_t>(debug_regions_.commands.size() - 1);
     }
+    LimitAccessLogDetail();
     CheckCommandTagDebugCheckpoint();
     return next;
 }
 
+// Large command buffers re-recorded or re-executed every frame keep their whole access log alive for hazard reporting,
+// with this only the most recent records name the resources (and the other records keep command, seq_no and region)
+void CommandBufferAccessContext::LimitAccessLogDetail() {
+    const uint32_t detail_limit = sync_state_->syncval_settings.access_log_detail_limit;
+    if (detail_limit != 0 && access_log_->size() > detail_limit) {
+        (*access_log_)[access_log_->size() - detail_limit - 1].handles.Clear();
+    }
+}
+
 ResourceUsageTag CommandBufferAccessContext::NextIndexedCommandTag(vvl::Func command, uint32_t index) {
     if (index == 0) {
         return NextCommandTag(command, ResourceUsageRecord::SubcommandType::kIndex);
@@ -1023,10 +1160,9 @@ void CommandBufferAccessContext::RecordClearAttachment(ResourceUsageTag tag, con
 // VK_SYNCVAL_DEBUG_CMDBUF_PATTERN: (optional, empty string by default) pattern to match command buffer debug name
 void CommandBufferAccessContext::CheckCommandTagDebugCheckpoint() {
     auto get_cmdbuf_name = [](const debug_report_data &debug_report, uint64_t cmdbuf_handle) {
-        std::unique_lock<std::mutex> lock(debug_report.debug_output_mutex);
-        std::string object_name = debug_report.DebugReportGetUtilsObjectNameNoLock(cmdbuf_handle);
+        std::string object_name = debug_report.DebugReportGetUtilsObjectName(cmdbuf_handle);
         if (object_name.empty()) {
-            object_name = debug_report.DebugReportGetMarkerObjectNameNoLock(cmdbuf_handle);
+            object_name = debug_report.DebugReportGetMarkerObjectName(cmdbuf_handle);
         }
         vvl::ToLower(object_name);
         return object_name;
@@ -1142,7 +1278,7 @@ std::ostream &operator<<(std::ostream &out, const ResourceUsageRecord::Formatter
         if (record.sub_command != 0) {
             out << ", subcmd: " << record.sub_command;
         }
-        for (const auto &named_handle : record.handles) {
+        for (const auto &named_handle : *record.handles) {
             out << ", " << named_handle.Formatter(formatter.sync_state);
         }
         out << ", reset_no: " << std::to_string(record.reset_count);
@@ -1194,8 +1330,12 @@ SyncNodeFormatter::SyncNodeFormatter(const SyncValidator &sync_state, const vvl:
     : report_data(sync_state.report_data), node(state_object), label(label_) {}
 
 std::string SyncValidationInfo::FormatHazard(const HazardResult &hazard) const {
-    std::stringstream out;
     assert(hazard.IsHazard());
+    // Filtered hazards are still detected, and would otherwise format their usage records only for the message to be dropped
+    if (!GetSyncState().IsHazardReported(hazard)) {
+        return std::string();
+    }
+    std::stringstream out;
     out << hazard.State();
     out << ", " << FormatUsage(hazard.Tag()) << ")";
     return out.str();
@@ -1215,6 +1355,11 @@ void syncval_state::CommandBuffer::Reset() {
     access_context.Reset();
 }
 
+void syncval_state::CommandBuffer::CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const {
+    vvl::CommandBuffer::CollectMemoryFootprint(footprint);
+    access_context.CollectMemoryFootprint(footprint);
+}
+
 void syncval_state::CommandBuffer::NotifyInvalidate(const vvl::StateObject::NodeList &invalid_nodes, bool unlink) {
     for (auto &obj : invalid_nodes) {
         switch (obj->Type()) {
@@ -17,6 +17,8 @@
 #pragma once
 
 #include "sync/sync_renderpass.h"
+#include "containers/copy_on_write.h"
+#include "utils/hash_util.h"
 
 class SyncValidator;
 
@@ -126,7 +128,7 @@ struct ResourceCmdUsageRecord {
     // NamedHandle must be constructable from args
     template <class... Args>
     void AddHandle(Args &&...args) {
-        handles.emplace_back(std::forward<Args>(args)...);
+        handles.Mutable().emplace_back(std::forward<Args>(args)...);
     }
 
     vvl::Func command = vvl::Func::Empty;
@@ -139,7 +141,9 @@ struct ResourceCmdUsageRecord {
     // plain pointer as a shared pointer is held by the context storing this record
     const vvl::CommandBuffer *cb_state = nullptr;
     Count reset_count;
-    NamedHandleVector handles;
+    // Shared by the subcommands of a command and by the copies made when logs are imported into other contexts.
+    // Empty for the records older than the access_log_detail_limit setting.
+    vvl::CopyOnWrite<NamedHandleVector> handles;
 
     // Indexes CommandBufferAccessContext::DebugRegions::commands.
     // Allows to derive fully qualified name (i.e. including parent scopes)
@@ -230,6 +234,42 @@ class CommandExecutionContext : public SyncValidationInfo {
     bool ValidForSyncOps() const;
 };
 
+// Bound descriptor reads found hazard free by the draws and dispatches just recorded, so the following draws can skip them.
+//
+// The hazards of a read only depend on the last write of its memory: reads don't change it and barriers only add to its
+// scope. A repeated read of the same range and stage/access thus stays hazard free until something writes memory it
+// overlaps. Every other command takes a tag between two draws, which drops the whole memo, and the writes made by the
+// draws themselves (storage descriptors and attachments) drop the entries they overlap.
+class DescriptorReadMemo {
+  public:
+    struct Key {
+        const void *resource;  // buffer, buffer view or image view state
+        ResourceAccessRange range;
+        SyncStageAccessIndex usage;
+        bool operator==(const Key &rhs) const { return resource == rhs.resource && range == rhs.range && usage == rhs.usage; }
+        size_t hash() const { return (hash_util::HashCombiner() << resource << range.begin << range.end << usage).Value(); }
+    };
+
+    // Validation of the command that will get the given tag
+    bool Contains(ResourceUsageTag tag, const Key &key) const { return tag == valid_tag_ && entries_.find(key) != entries_.end(); }
+    // The memory is the address range covering the read, for Invalidate
+    void Stage(ResourceUsageTag tag, const Key &key, const ResourceAccessRange &memory) const;
+
+    // Recording of the command with the given tag, before any of its writes are invalidated
+    void BeginCommand(ResourceUsageTag tag);
+    void Invalidate(const ResourceAccessRange &written_memory);
+    void Clear();
+    size_t Size() const { return entries_.size(); }
+
+  private:
+    using Entries = vvl::unordered_map<Key, ResourceAccessRange, hash_util::HasHashMember<Key>>;
+    Entries entries_;
+    ResourceUsageTag valid_tag_ = kInvalidTag;
+    // Reads found hazard free while validating the command tagged staged_tag_, added when that command is recorded
+    mutable std::vector<std::pair<Key, ResourceAccessRange>> staged_;
+    mutable ResourceUsageTag staged_tag_ = kInvalidTag;
+};
+
 class CommandBufferAccessContext : public CommandExecutionContext {
   public:
     using SyncOpPointer = std::shared_ptr<SyncOpBase>;
@@ -282,7 +322,7 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     RenderPassAccessContext *GetCurrentRenderPassContext() { return current_renderpass_context_; }
     const RenderPassAccessContext *GetCurrentRenderPassContext() const { return current_renderpass_context_; }
     ResourceUsageTag RecordBeginRenderPass(vvl::Func command, const vvl::RenderPass &rp_state, const VkRect2D &render_area,
-                                           const std::vector<const syncval_state::ImageViewState *> &attachment_views);
+                                           std::shared_ptr<const AttachmentViewGenVector> attachment_views);
 
     bool ValidateBeginRendering(const ErrorObject &error_obj, syncval_state::BeginRenderingCmdState &cmd_state) const;
     void RecordBeginRendering(syncval_state::BeginRenderingCmdState &cmd_state, const RecordObject &record_obj);
@@ -304,6 +344,8 @@ class CommandBufferAccessContext : public CommandExecutionContext {
 
     ResourceUsageTag RecordNextSubpass(vvl::Func command);
     ResourceUsageTag RecordEndRenderPass(vvl::Func command);
+    // Compacts the recorded accesses for the submit (and execute) time validation of this command buffer
+    void RecordEndCommandBuffer();
     void RecordDestroyEvent(vvl::Event *event_state);
 
     void RecordExecutedCommandBuffer(const CommandBufferAccessContext &recorded_context);
@@ -356,6 +398,7 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     std::shared_ptr<CommandBufferSet> GetCBReferencesShared() const { return cbs_referenced_; }
     void InsertRecordedAccessLogEntries(const CommandBufferAccessContext &cb_context) override;
     const std::vector<SyncOpEntry> &GetSyncOps() const { return sync_ops_; };
+    void CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const;
 
     void PushDebugRegion(const char *region_name);
     void PopDebugRegion();
@@ -369,6 +412,10 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     void RecordClearAttachment(ResourceUsageTag tag, const ClearAttachmentInfo &clear_info);
 
     void CheckCommandTagDebugCheckpoint();
+    // Drops the handles of the record falling out of the access_log_detail_limit window
+    void LimitAccessLogDetail();
+    // Drops the memoized descriptor reads overlapping an attachment the current draw may write
+    void InvalidateDescriptorReadMemo(const syncval_state::ImageViewState *attachment_view);
 
     // Note: since every CommandBufferAccessContext is encapsulated in its CommandBuffer object,
     // a reference count is not needed here.
@@ -379,11 +426,12 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     uint32_t command_number_;
     uint32_t subcommand_number_;
     uint32_t reset_count_;
-    NamedHandleVector command_handles_;
+    vvl::CopyOnWrite<NamedHandleVector> command_handles_;
 
     AccessContext cb_access_context_;
     AccessContext *current_context_;
     SyncEventsContext events_context_;
+    DescriptorReadMemo descriptor_read_memo_;
 
     // Don't need the following for an active proxy cb context
     std::vector<std::unique_ptr<RenderPassAccessContext>> render_pass_contexts_;
@@ -424,6 +472,7 @@ class CommandBuffer : public vvl::CommandBuffer {
 
     void Destroy() override;
     void Reset() override;
+    void CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const override;
 };
 }  // namespace syncval_state
 
@@ -19,6 +19,7 @@
 #include "containers/subresource_adapter.h"
 #include "containers/range_vector.h"
 #include "generated/sync_validation_types.h"
+#include "state_tracker/buffer_state.h"
 #include "state_tracker/image_state.h"
 
 namespace vvl {
@@ -162,15 +163,25 @@ namespace syncval_state {
 class CommandBuffer;
 class Swapchain;
 
+class BufferState : public vvl::Buffer {
+  public:
+    BufferState(ValidationStateTracker *dev_data, VkBuffer buffer, const VkBufferCreateInfo *pCreateInfo);
+
+    // Address range of the memory an access to range covers, empty when the buffer accesses aren't tracked.
+    // With whole resource tracking any non empty access covers the whole buffer.
+    ResourceAccessRange MakeMemoryRange(const ResourceAccessRange &range) const;
+
+  protected:
+    const bool whole_resource_tracking_;
+};
+
 class ImageState : public vvl::Image {
   public:
     ImageState(const ValidationStateTracker *dev_data, VkImage img, const VkImageCreateInfo *pCreateInfo,
-               VkFormatFeatureFlags2KHR features)
-        : vvl::Image(dev_data, img, pCreateInfo, features), opaque_base_address_(0U) {}
+               VkFormatFeatureFlags2KHR features);
 
     ImageState(const ValidationStateTracker *dev_data, VkImage img, const VkImageCreateInfo *pCreateInfo, VkSwapchainKHR swapchain,
-               uint32_t swapchain_index, VkFormatFeatureFlags2KHR features)
-        : vvl::Image(dev_data, img, pCreateInfo, swapchain, swapchain_index, features), opaque_base_address_(0U) {}
+               uint32_t swapchain_index, VkFormatFeatureFlags2KHR features);
     bool IsLinear() const { return fragment_encoder->IsLinearImage(); }
     bool IsTiled() const { return !IsLinear(); }
     bool IsSimplyBound() const;
@@ -180,12 +191,16 @@ class ImageState : public vvl::Image {
     VkDeviceSize GetOpaqueBaseAddress() const { return opaque_base_address_; }
     bool HasOpaqueMapping() const { return 0U != opaque_base_address_; }
     VkDeviceSize GetResourceBaseAddress() const;
+    // Address range of all the memory the image accesses can cover, empty when they aren't tracked
+    ResourceAccessRange GetFullMemoryRange() const;
     ImageRangeGen MakeImageRangeGen(const VkImageSubresourceRange &subresource_range, bool is_depth_sliced) const;
     ImageRangeGen MakeImageRangeGen(const VkImageSubresourceRange &subresource_range, const VkOffset3D &offset,
                                     const VkExtent3D &extent, bool is_depth_sliced) const;
 
   protected:
     VkDeviceSize opaque_base_address_ = 0U;
+    // Every range generator covers the full memory range, see SyncValSettings::whole_resource_tracking
+    const bool whole_resource_tracking_;
 };
 
 class ImageViewState : public vvl::ImageView {
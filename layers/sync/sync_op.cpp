@@ -22,6 +22,8 @@
 
 #include "sync/sync_validation.h"
 
+#include <algorithm>
+
 // Range generators for to allow event scope filtration to be limited to the top of the resource access traversal pipeline
 //
 // Note: there is no "begin/end" or reset facility.  These are each written as "one time through" generators.
@@ -298,9 +300,7 @@ struct SyncOpPipelineBarrierFunctorFactory {
     }
 
     BufferRange MakeRangeGen(const vvl::Buffer &buffer, const ResourceAccessRange &range) const {
-        if (!SimpleBinding(buffer)) return ResourceAccessRange();
-        const auto base_address = ResourceBaseAddress(buffer);
-        return (range + base_address);
+        return BufferMemoryRange(buffer, range);
     }
     ImageRange MakeRangeGen(const ImageState &image, const VkImageSubresourceRange &subresource_range) const {
         return image.MakeImageRangeGen(subresource_range, false);
@@ -332,6 +332,136 @@ void SyncOpBarriers::ApplyGlobalBarriers(const Barriers &barriers, const Functor
     access_context->UpdateMemoryAccessState(barriers_functor, range_gen);
 }
 
+// The ranges of the buffer and image barriers of a barrier set, cut at every barrier boundary so that each segment is covered
+// by a fixed set of barriers. Segments are disjoint and sorted by address.
+struct BarrierSegments {
+    struct Segment {
+        ResourceAccessRange range;
+        // Indices into ops, in barrier order (buffer barriers first, as ApplyBarriers applies them)
+        small_vector<uint32_t, 2> ops;
+        bool layout_transition = false;
+    };
+    std::vector<PipelineBarrierOp> ops;
+    std::vector<Segment> segments;
+
+    template <typename Barriers, typename FunctorFactory>
+    void AddBarriers(const Barriers &barriers, const FunctorFactory &factory, QueueId queue_id) {
+        for (const auto &barrier : barriers) {
+            const auto *state = barrier.GetState();
+            if (!state) continue;
+            const uint32_t op_index = static_cast<uint32_t>(ops.size());
+            ops.emplace_back(queue_id, barrier.barrier, barrier.IsLayoutTransition());
+            for (auto range_gen = factory.MakeRangeGen(*state, barrier.Range()); range_gen->non_empty(); ++range_gen) {
+                bounds_.push_back({range_gen->begin, op_index, true});
+                bounds_.push_back({range_gen->end, op_index, false});
+            }
+        }
+    }
+
+    // Sweeps the sorted range bounds, keeping the barriers covering the current address
+    void Build() {
+        std::sort(bounds_.begin(), bounds_.end(), [](const Bound &a, const Bound &b) { return a.address < b.address; });
+        std::vector<uint32_t> active;
+        for (size_t i = 0; i < bounds_.size();) {
+            const ResourceAccessRange::index_type address = bounds_[i].address;
+            for (; i < bounds_.size() && bounds_[i].address == address; ++i) {
+                const Bound &bound = bounds_[i];
+                if (bound.begin) {
+                    active.insert(std::upper_bound(active.begin(), active.end(), bound.op), bound.op);
+                } else {
+                    active.erase(std::find(active.begin(), active.end(), bound.op));
+                }
+            }
+            if (!active.empty() && i < bounds_.size()) {
+                Segment segment;
+                segment.range = ResourceAccessRange(address, bounds_[i].address);
+                for (uint32_t op : active) {
+                    segment.ops.emplace_back(op);
+                    segment.layout_transition |= ops[op].layout_transition;
+                }
+                segments.emplace_back(std::move(segment));
+            }
+        }
+    }
+
+  private:
+    struct Bound {
+        ResourceAccessRange::index_type address;
+        uint32_t op;
+        bool begin;
+    };
+    std::vector<Bound> bounds_;
+};
+
+// Applies the barriers covering one segment, then the global barriers and the pending state resolve of global_functor
+template <typename GlobalFunctor>
+class BarrierSegmentFunctor {
+  public:
+    using Iterator = ResourceAccessRangeMap::iterator;
+    BarrierSegmentFunctor(const BarrierSegments &segments, const GlobalFunctor &global_functor)
+        : segments_(segments), global_functor_(global_functor) {}
+    void SetSegment(const BarrierSegments::Segment &segment) { segment_ = &segment; }
+
+    Iterator Infill(ResourceAccessRangeMap *accesses, const Iterator &pos, const ResourceAccessRange &range) const {
+        // As for ApplyBarrierOpsFunctor, only layout transitions write to the ranges without accesses. The other barriers of the
+        // segment then also see the inserted state, where they have nothing in their scope, as when applied one at a time.
+        if (!segment_->layout_transition) {
+            return pos;
+        }
+        return accesses->insert(pos, std::make_pair(range, ResourceAccessState()));
+    }
+    void operator()(const Iterator &pos) const {
+        for (uint32_t op : segment_->ops) {
+            segments_.ops[op](&pos->second);
+        }
+        global_functor_(pos);
+    }
+
+  private:
+    const BarrierSegments &segments_;
+    const GlobalFunctor &global_functor_;
+    const BarrierSegments::Segment *segment_ = nullptr;
+};
+
+template <typename FunctorFactory>
+void SyncOpBarriers::ApplyBarrierSet(const BarrierSet &barrier_set, const FunctorFactory &factory, const QueueId queue_id,
+                                     const ResourceUsageTag tag, AccessContext *access_context) {
+    BarrierSegments segments;
+    segments.AddBarriers(barrier_set.buffer_memory_barriers, factory, queue_id);
+    segments.AddBarriers(barrier_set.image_memory_barriers, factory, queue_id);
+    segments.Build();
+
+    auto global_functor = factory.MakeGlobalApplyFunctor(barrier_set.memory_barriers.size(), tag);
+    for (const auto &barrier : barrier_set.memory_barriers) {
+        global_functor.EmplaceBack(factory.MakeGlobalBarrierOpFunctor(queue_id, barrier));
+    }
+    BarrierSegmentFunctor<decltype(global_functor)> segment_functor(segments, global_functor);
+    const ActionToOpsAdapter<decltype(global_functor)> global_ops{global_functor};
+    const ActionToOpsAdapter<decltype(segment_functor)> segment_ops{segment_functor};
+
+    // Without global barriers the ranges between the segments have nothing to do: every barrier operation resolves the
+    // pending state it leaves before returning, so there is none to resolve there
+    const bool walk_gaps = !barrier_set.memory_barriers.empty();
+    auto &access_map = access_context->GetAccessStateMap();
+    auto pos = access_map.begin();
+    if (!walk_gaps && !segments.segments.empty()) {
+        pos = access_map.lower_bound(segments.segments.front().range);
+    }
+    // Each call returns the first entry past its range, which is the lower bound (or close to it) of the next range
+    ResourceAccessRange::index_type current = kFullRange.begin;
+    for (const auto &segment : segments.segments) {
+        if (walk_gaps && current < segment.range.begin) {
+            pos = infill_update_range(access_map, pos, ResourceAccessRange(current, segment.range.begin), global_ops);
+        }
+        segment_functor.SetSegment(segment);
+        pos = infill_update_range(access_map, pos, segment.range, segment_ops);
+        current = segment.range.end;
+    }
+    if (walk_gaps && current < kFullRange.end) {
+        infill_update_range(access_map, pos, ResourceAccessRange(current, kFullRange.end), global_ops);
+    }
+}
+
 ResourceUsageTag SyncOpPipelineBarrier::Record(CommandBufferAccessContext *cb_context) {
     const auto tag = cb_context->NextCommandTag(command_);
     for (const auto &barrier_set : barriers_) {
@@ -356,9 +486,9 @@ void SyncOpPipelineBarrier::ReplayRecord(CommandExecutionContext &exec_context,
     SyncEventsContext *events_context = exec_context.GetCurrentEventsContext();
     AccessContext *access_context = exec_context.GetCurrentAccessContext();
     const auto queue_id = exec_context.GetQueueId();
-    ApplyBarriers(barrier_set.buffer_memory_barriers, factory, queue_id, exec_tag, access_context);
-    ApplyBarriers(barrier_set.image_memory_barriers, factory, queue_id, exec_tag, access_context);
-    ApplyGlobalBarriers(barrier_set.memory_barriers, factory, queue_id, exec_tag, access_context);
+    ApplyBarrierSet(barrier_set, factory, queue_id, exec_tag, access_context);
+    // Barriers tend to leave neighbouring ranges with the same state, merge them before the next hazard walks
+    access_context->Coalesce(exec_context.GetSyncState().syncval_settings.access_map_coalesce_threshold);
     if (barrier_set.single_exec_scope) {
         events_context->ApplyBarrier(barrier_set.src_exec_scope, barrier_set.dst_exec_scope, exec_tag);
     } else {
@@ -503,8 +633,9 @@ bool SyncOpWaitEvents::Validate(const CommandBufferAccessContext &cb_context) co
     const auto &sync_state = cb_context.GetSyncState();
     const auto command_buffer_handle = cb_context.GetCBState().commandBuffer();
 
-    // This is only interesting at record and not replay (Execute/Submit) time.
-    for (size_t barrier_set_index = 0; barrier_set_index < barriers_.size(); barrier_set_index++) {
+    // This is only interesting at record and not replay (Execute/Submit) time, and only logs information messages.
+    const size_t info_barrier_sets = sync_state.report_data->IsMessageEnabled(kInformationBit) ? barriers_.size() : 0;
+    for (size_t barrier_set_index = 0; barrier_set_index < info_barrier_sets; barrier_set_index++) {
         const auto &barrier_set = barriers_[barrier_set_index];
         if (barrier_set.single_exec_scope) {
             const Location loc(command_);
@@ -709,9 +840,7 @@ struct SyncOpWaitEventsFunctorFactory {
     }
 
     BufferRange MakeRangeGen(const vvl::Buffer &buffer, const ResourceAccessRange &range_arg) const {
-        const auto base_address = ResourceBaseAddress(buffer);
-        ResourceAccessRange range = SimpleBinding(buffer) ? (range_arg + base_address) : ResourceAccessRange();
-        EventSimpleRangeGenerator filtered_range_gen(sync_event->FirstScope(), range);
+        EventSimpleRangeGenerator filtered_range_gen(sync_event->FirstScope(), BufferMemoryRange(buffer, range_arg));
         return filtered_range_gen;
     }
     ImageRange MakeRangeGen(const ImageState &image, const VkImageSubresourceRange &subresource_range) const {
@@ -778,6 +907,7 @@ void SyncOpWaitEvents::ReplayRecord(CommandExecutionContext &exec_context, Resou
     // Apply the pending barriers
     ResolvePendingBarrierFunctor apply_pending_action(exec_tag);
     access_context->ApplyToContext(apply_pending_action);
+    access_context->Coalesce(exec_context.GetSyncState().syncval_settings.access_map_coalesce_threshold);
 }
 
 bool SyncOpWaitEvents::ReplayValidate(ReplayState &replay, ResourceUsageTag recorded_tag) const {
@@ -848,6 +978,12 @@ bool SyncOpResetEvent::DoValidate(const CommandExecutionContext &exec_context, c
 
 ResourceUsageTag SyncOpResetEvent::Record(CommandBufferAccessContext *cb_context) {
     const auto tag = cb_context->NextCommandTag(command_);
+    // The scope of a set recorded earlier in this command buffer ends here, so only the waits in between can use it
+    if (const SyncEventState *sync_event = cb_context->GetCurrentEventsContext()->Get(event_)) {
+        if (sync_event->first_scope_set_op) {
+            sync_event->first_scope_set_op->SetScopeEndsInCommandBuffer();
+        }
+    }
     ReplayRecord(*cb_context, tag);
     return tag;
 }
@@ -975,11 +1111,24 @@ ResourceUsageTag SyncOpSetEvent::Record(CommandBufferAccessContext *cb_context)
     const QueueId queue_id = cb_context->GetQueueId();
     assert(recorded_context_);
     if (recorded_context_ && events_context) {
-        DoRecord(queue_id, tag, recorded_context_, events_context);
+        SyncEventState *sync_event = DoRecord(queue_id, tag, recorded_context_, events_context);
+        if (sync_event && sync_event->first_scope == recorded_context_) {
+            sync_event->first_scope_set_op = this;
+        }
     }
     return tag;
 }
 
+// A first scope covering the whole address space, the waits limit what they apply to by the scope tag alone
+static const std::shared_ptr<const AccessContext> &UnfilteredEventScope() {
+    static const std::shared_ptr<const AccessContext> scope = [] {
+        auto context = std::make_shared<AccessContext>();
+        context->GetAccessStateMap().insert(std::make_pair(kFullRange, ResourceAccessState()));
+        return context;
+    }();
+    return scope;
+}
+
 void SyncOpSetEvent::ReplayRecord(CommandExecutionContext &exec_context, ResourceUsageTag exec_tag) const {
     // Create a copy of the current context, and merge in the state snapshot at record set event time
     // Note: we mustn't change the recorded context copy, as a given CB could be submitted more than once (in generaL)
@@ -988,6 +1137,14 @@ void SyncOpSetEvent::ReplayRecord(CommandExecutionContext &exec_context, Resourc
     AccessContext *access_context = exec_context.GetCurrentAccessContext();
     const QueueId queue_id = exec_context.GetQueueId();
 
+    if (scope_ends_in_command_buffer_ && queue_id != kQueueIdInvalid) {
+        // Replayed in a queue batch, the only waits using this scope come before the reset in this command buffer. In between
+        // the batch context gains no accesses older than the set, and the waits skip the newer ones by tag and don't apply
+        // layout transitions, so filtering by the accesses present at set time changes nothing and the merge can be skipped.
+        DoRecord(queue_id, exec_tag, UnfilteredEventScope(), events_context);
+        return;
+    }
+
     // Note: merged_context is a copy of the access_context, combined with the recorded context
     auto merged_context = std::make_shared<AccessContext>(*access_context);
     merged_context->ResolveFromContext(QueueTagOffsetBarrierAction(queue_id, exec_tag), *recorded_context_);
@@ -995,10 +1152,11 @@ void SyncOpSetEvent::ReplayRecord(CommandExecutionContext &exec_context, Resourc
     DoRecord(queue_id, exec_tag, merged_context, events_context);
 }
 
-void SyncOpSetEvent::DoRecord(QueueId queue_id, ResourceUsageTag tag, const std::shared_ptr<const AccessContext> &access_context,
-                              SyncEventsContext *events_context) const {
+SyncEventState *SyncOpSetEvent::DoRecord(QueueId queue_id, ResourceUsageTag tag,
+                                         const std::shared_ptr<const AccessContext> &access_context,
+                                         SyncEventsContext *events_context) const {
     auto *sync_event = events_context->GetFromShared(event_);
-    if (!sync_event) return;  // Core, Lifetimes, or Param check needs to catch invalid events.
+    if (!sync_event) return nullptr;  // Core, Lifetimes, or Param check needs to catch invalid events.
 
     // NOTE: We're going to simply record the sync scope here, as anything else would be implementation defined/undefined
     //       and we're issuing errors re: missing barriers between event commands, which if the user fixes would fix
@@ -1018,6 +1176,7 @@ void SyncOpSetEvent::DoRecord(QueueId queue_id, ResourceUsageTag tag, const std:
 
         // Save the shared_ptr to copy of the access_context present at set time (sent us by the caller)
         sync_event->first_scope = access_context;
+        sync_event->first_scope_set_op = nullptr;
         sync_event->unsynchronized_set = vvl::Func::Empty;
         sync_event->first_scope_tag = tag;
     }
@@ -1025,24 +1184,22 @@ void SyncOpSetEvent::DoRecord(QueueId queue_id, ResourceUsageTag tag, const std:
     sync_event->last_command = command_;
     sync_event->last_command_tag = tag;
     sync_event->barriers = 0U;
+    return sync_event;
 }
 
 SyncOpBeginRenderPass::SyncOpBeginRenderPass(vvl::Func command, const SyncValidator &sync_state,
                                              const VkRenderPassBeginInfo *pRenderPassBegin,
                                              const VkSubpassBeginInfo *pSubpassBeginInfo)
-    : SyncOpBase(command), rp_context_(nullptr) {
+    : SyncOpBase(command), attachment_view_gens_(std::make_shared<const AttachmentViewGenVector>()), rp_context_(nullptr) {
     if (pRenderPassBegin) {
         rp_state_ = sync_state.Get<vvl::RenderPass>(pRenderPassBegin->renderPass);
         renderpass_begin_info_ = safe_VkRenderPassBeginInfo(pRenderPassBegin);
         auto fb_state = sync_state.Get<vvl::Framebuffer>(pRenderPassBegin->framebuffer);
         if (fb_state) {
             shared_attachments_ = sync_state.GetAttachmentViews(*renderpass_begin_info_.ptr(), *fb_state);
-            // TODO: Revisit this when all attachment validation is through SyncOps to see if we can discard the plain pointer copy
-            // Note that this a safe to presist as long as shared_attachments is not cleared
-            attachments_.reserve(shared_attachments_.size());
-            for (const auto &attachment : shared_attachments_) {
-                attachments_.emplace_back(static_cast<const syncval_state::ImageViewState *>(attachment.get()));
-            }
+            // The Validate and Record phase ops of this command, and the later instances with the same views, share these
+            attachment_view_gens_ =
+                sync_state.attachment_view_gen_cache_.Get(renderpass_begin_info_.renderArea, shared_attachments_);
         }
         if (pSubpassBeginInfo) {
             subpass_begin_info_ = safe_VkSubpassBeginInfo(pSubpassBeginInfo);
@@ -1067,14 +1224,10 @@ bool SyncOpBeginRenderPass::Validate(const CommandBufferAccessContext &cb_contex
                                cb_context.GetCurrentAccessContext());
 
     // Validate attachment operations
-    if (attachments_.size() == 0) return skip;
+    if (attachment_view_gens_->empty()) return skip;
     const auto &render_area = renderpass_begin_info_.renderArea;
-
-    // Since the isn't a valid RenderPassAccessContext until Record, needs to create the view/generator list... we could limit this
-    // by predicating on whether subpass 0 uses the attachment if it is too expensive to create the full list redundantly here.
-    // More broadly we could look at thread specific state shared between Validate and Record as is done for other heavyweight
-    // operations (though it's currently a messy approach)
-    AttachmentViewGenVector view_gens = RenderPassAccessContext::CreateAttachmentViewGen(render_area, attachments_);
+    // There isn't a RenderPassAccessContext until Record, the view/generator list is the one Record builds it from
+    const AttachmentViewGenVector &view_gens = *attachment_view_gens_;
     skip |= RenderPassAccessContext::ValidateLayoutTransitions(cb_context, temp_context, rp_state, render_area, subpass, view_gens,
                                                                command_);
 
@@ -1092,7 +1245,7 @@ ResourceUsageTag SyncOpBeginRenderPass::Record(CommandBufferAccessContext *cb_co
     assert(rp_state_.get());
     if (nullptr == rp_state_.get()) return cb_context->NextCommandTag(command_);
     const ResourceUsageTag begin_tag =
-        cb_context->RecordBeginRenderPass(command_, *rp_state_.get(), renderpass_begin_info_.renderArea, attachments_);
+        cb_context->RecordBeginRenderPass(command_, *rp_state_.get(), renderpass_begin_info_.renderArea, attachment_view_gens_);
 
     // Note: this state update must be after RecordBeginRenderPass as there is no current render pass until that function runs
     rp_context_ = cb_context->GetCurrentRenderPassContext();
@@ -1219,15 +1372,16 @@ const AccessContext *ReplayState::GetRecordedAccessContext() const {
 
 bool ReplayState::DetectFirstUseHazard(const ResourceUsageRange &first_use_range) const {
     bool skip = false;
-    if (first_use_range.non_empty()) {
+    if (detect_hazards_ && first_use_range.non_empty()) {
         HazardResult hazard;
         // We're allowing for the Replay(Validate|Record) to modify the exec_context (e.g. for Renderpass operations), so
         // we need to fetch the current access context each time
         hazard = GetRecordedAccessContext()->DetectFirstUseHazard(exec_context_.GetQueueId(), first_use_range,
-                                                                  *exec_context_.GetCurrentAccessContext());
+                                                                  *exec_context_.GetCurrentAccessContext(),
+                                                                  exec_context_.GetSyncState().GetReplayWorkers());
 
-        if (hazard.IsHazard()) {
-            const SyncValidator &sync_state = exec_context_.GetSyncState();
+        const SyncValidator &sync_state = exec_context_.GetSyncState();
+        if (hazard.IsHazard() && sync_state.IsHazardReported(hazard)) {
             const auto handle = exec_context_.Handle();
             const auto recorded_handle = recorded_context_.GetCBState().commandBuffer();
             skip = sync_state.LogError(
@@ -1303,9 +1457,50 @@ void ReplayState::RenderPassReplayState::End(AccessContext &external_context) {
     Reset();
 }
 
+size_t SyncEventsContext::Find(const vvl::Event *event_state) const {
+    if (index_.empty()) {
+        for (size_t index = 0; index < table_.size(); ++index) {
+            if (table_[index].first == event_state) return index;
+        }
+        return table_.size();
+    }
+    const auto find_it = index_.find(event_state);
+    return (find_it == index_.end()) ? table_.size() : find_it->second;
+}
+
+SyncEventState *SyncEventsContext::Insert(const vvl::Event *event_state, std::shared_ptr<SyncEventState> &&sync_event) {
+    table_.emplace_back(event_state, std::move(sync_event));
+    if (!index_.empty()) {
+        index_.emplace(event_state, table_.size() - 1);
+    } else if (table_.size() > kMaxLinearEvents) {
+        for (size_t index = 0; index < table_.size(); ++index) {
+            index_.emplace(table_[index].first, index);
+        }
+    }
+    return table_.back().second.get();
+}
+
+void SyncEventsContext::Destroy(const vvl::Event *event_state) {
+    const size_t index = Find(event_state);
+    if (index == table_.size()) return;
+
+    table_[index].second->destroyed = true;
+    if (!index_.empty()) {
+        index_.erase(event_state);
+    }
+    // The order of the table doesn't matter, move the last entry into the hole
+    if (index != table_.size() - 1) {
+        table_[index] = std::move(table_.back());
+        if (!index_.empty()) {
+            index_[table_[index].first] = index;
+        }
+    }
+    table_.pop_back();
+}
+
 void SyncEventsContext::ApplyBarrier(const SyncExecScope &src, const SyncExecScope &dst, ResourceUsageTag tag) {
     const bool all_commands_bit = 0 != (src.mask_param & VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
-    for (auto &event_pair : map_) {
+    for (auto &event_pair : table_) {
         assert(event_pair.second);  // Shouldn't be storing empty
         auto &sync_event = *event_pair.second;
         // Events don't happen at a stage, so we need to check and store the unexpanded ALL_COMMANDS if set for inter-event-calls
@@ -1326,14 +1521,19 @@ void SyncEventsContext::ApplyTaggedWait(VkQueueFlags queue_flags, ResourceUsageT
 
 SyncEventsContext &SyncEventsContext::DeepCopy(const SyncEventsContext &from) {
     // We need a deep copy of the const context to update during validation phase
-    for (const auto &event : from.map_) {
-        map_.emplace(event.first, std::make_shared<SyncEventState>(*event.second));
+    table_.reserve(table_.size() + from.table_.size());
+    for (const auto &event : from.table_) {
+        if (Find(event.first) != table_.size()) continue;
+        auto sync_event = std::make_shared<SyncEventState>(*event.second);
+        // The set op belongs to the command buffer the scope was recorded in
+        sync_event->first_scope_set_op = nullptr;
+        Insert(event.first, std::move(sync_event));
     }
     return *this;
 }
 
 void SyncEventsContext::AddReferencedTags(ResourceUsageTagSet &referenced) const {
-    for (const auto &event : map_) {
+    for (const auto &event : table_) {
         const std::shared_ptr<const SyncEventState> &event_state = event.second;
         if (event_state) {
             event_state->AddReferencedTags(referenced);
@@ -1342,6 +1542,7 @@ void SyncEventsContext::AddReferencedTags(ResourceUsageTagSet &referenced) const
 }
 void SyncEventState::ResetFirstScope() {
     first_scope.reset();
+    first_scope_set_op = nullptr;
     scope = SyncExecScope();
     first_scope_tag = 0;
 }
@@ -25,6 +25,7 @@ class CommandBufferAccessContext;
 class CommandExecutionContext;
 class RenderPassAccessContext;
 class ReplayState;
+class SyncOpSetEvent;
 
 using SyncMemoryBarrier = SyncBarrier;
 
@@ -40,6 +41,8 @@ struct SyncEventState {
     ResourceUsageTag first_scope_tag;
     bool destroyed;
     std::shared_ptr<const AccessContext> first_scope;
+    // The SetEvent recorded in this command buffer that set first_scope, if the scope hasn't been reset since
+    SyncOpSetEvent *first_scope_set_op = nullptr;
 
     SyncEventState()
         : event(),
@@ -66,51 +69,49 @@ struct SyncEventState {
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
 };
 
+// Command buffers and queue batches use a handful of events each, so they are kept in a dense table searched linearly. The
+// table gets a hash index only once there are more than kMaxLinearEvents of them.
 class SyncEventsContext {
   public:
-    using Map = vvl::unordered_map<const vvl::Event *, std::shared_ptr<SyncEventState>>;
-    using iterator = Map::iterator;
-    using const_iterator = Map::const_iterator;
+    using Entry = std::pair<const vvl::Event *, std::shared_ptr<SyncEventState>>;
+    using Table = std::vector<Entry>;
 
     SyncEventState *GetFromShared(const SyncEventState::EventPointer &event_state) {
-        const auto find_it = map_.find(event_state.get());
-        if (find_it == map_.end()) {
+        const size_t index = Find(event_state.get());
+        if (index == table_.size()) {
             if (!event_state.get()) return nullptr;
-
-            const auto *event_plain_ptr = event_state.get();
-            auto sync_state = std::make_shared<SyncEventState>(event_state);
-            auto insert_pair = map_.emplace(event_plain_ptr, sync_state);
-            return insert_pair.first->second.get();
+            return Insert(event_state.get(), std::make_shared<SyncEventState>(event_state));
         }
-        return find_it->second.get();
+        return table_[index].second.get();
     }
 
     const SyncEventState *Get(const vvl::Event *event_state) const {
-        const auto find_it = map_.find(event_state);
-        if (find_it == map_.end()) {
-            return nullptr;
-        }
-        return find_it->second.get();
+        const size_t index = Find(event_state);
+        return (index == table_.size()) ? nullptr : table_[index].second.get();
     }
     const SyncEventState *Get(const SyncEventState::EventPointer &event_state) const { return Get(event_state.get()); }
 
     void ApplyBarrier(const SyncExecScope &src, const SyncExecScope &dst, ResourceUsageTag tag);
     void ApplyTaggedWait(VkQueueFlags queue_flags, ResourceUsageTag tag);
 
-    void Destroy(const vvl::Event *event_state) {
-        auto sync_it = map_.find(event_state);
-        if (sync_it != map_.end()) {
-            sync_it->second->destroyed = true;
-            map_.erase(sync_it);
-        }
+    void Destroy(const vvl::Event *event_state);
+    void Clear() {
+        table_.clear();
+        index_.clear();
     }
-    void Clear() { map_.clear(); }
 
     SyncEventsContext &DeepCopy(const SyncEventsContext &from);
     void AddReferencedTags(ResourceUsageTagSet &referenced) const;
 
   private:
-    Map map_;
+    static constexpr size_t kMaxLinearEvents = 16;
+
+    // Returns table_.size() if the event isn't tracked
+    size_t Find(const vvl::Event *event_state) const;
+    SyncEventState *Insert(const vvl::Event *event_state, std::shared_ptr<SyncEventState> &&sync_event);
+
+    Table table_;
+    vvl::unordered_map<const vvl::Event *, size_t> index_;  // Empty until the table outgrows kMaxLinearEvents
 };
 
 struct SyncBufferMemoryBarrier {
@@ -215,6 +216,14 @@ class SyncOpBarriers : public SyncOpBase {
         void MakeImageMemoryBarriers(const SyncValidator &sync_state, VkQueueFlags queue_flags, VkDependencyFlags dependency_flags,
                                      uint32_t barrier_count, const VkImageMemoryBarrier2 *barriers);
     };
+    // Applies the buffer and image barriers, then the global barriers, in a single forward walk of the access map over the
+    // address sorted barrier segments instead of one walk per barrier. Each access state gets the barriers covering its segment
+    // and the global barriers as pending, and resolves them once per segment entry. ApplyBarriers followed by
+    // ApplyGlobalBarriers instead resolves every entry in the final walk over the whole range. Without global barriers the
+    // ranges between the segments are not walked, so this relies on no pending state being left there.
+    template <typename FunctorFactory>
+    static void ApplyBarrierSet(const BarrierSet &barrier_set, const FunctorFactory &factory, QueueId queue_id,
+                                ResourceUsageTag tag, AccessContext *access_context);
     std::vector<BarrierSet> barriers_;
 };
 
@@ -292,16 +301,21 @@ class SyncOpSetEvent : public SyncOpBase {
     bool ReplayValidate(ReplayState &replay, ResourceUsageTag recorded_tag) const override;
     void ReplayRecord(CommandExecutionContext &exec_context, ResourceUsageTag exec_tag) const override;
 
+    // Called when the command buffer resets the event after this set, before anything outside of it could wait on the event
+    void SetScopeEndsInCommandBuffer() { scope_ends_in_command_buffer_ = true; }
+
   private:
     bool DoValidate(const CommandExecutionContext &ex_context, const ResourceUsageTag base_tag) const;
-    void DoRecord(QueueId queue_id, ResourceUsageTag recorded_tag, const std::shared_ptr<const AccessContext> &access_context,
-                  SyncEventsContext *events_context) const;
+    SyncEventState *DoRecord(QueueId queue_id, ResourceUsageTag recorded_tag,
+                             const std::shared_ptr<const AccessContext> &access_context, SyncEventsContext *events_context) const;
     std::shared_ptr<const vvl::Event> event_;
     // The Access context of the command buffer at record set event time.
     std::shared_ptr<const AccessContext> recorded_context_;
     SyncExecScope src_exec_scope_;
     // Note that the dep info is *not* dehandled, but retained for comparison with a future WaitEvents2
     std::shared_ptr<safe_VkDependencyInfo> dep_info_;
+    // Only waits in the same command buffer can see the first scope of this set, see ReplayRecord
+    bool scope_ends_in_command_buffer_ = false;
 };
 
 class SyncOpBeginRenderPass : public SyncOpBase {
@@ -319,8 +333,9 @@ class SyncOpBeginRenderPass : public SyncOpBase {
   protected:
     safe_VkRenderPassBeginInfo renderpass_begin_info_;
     safe_VkSubpassBeginInfo subpass_begin_info_;
+    // Keep the views of attachment_view_gens_ alive, the cache can drop its entry
     std::vector<std::shared_ptr<const vvl::ImageView>> shared_attachments_;
-    std::vector<const syncval_state::ImageViewState *> attachments_;
+    std::shared_ptr<const AttachmentViewGenVector> attachment_view_gens_;
     std::shared_ptr<const vvl::RenderPass> rp_state_;
     const RenderPassAccessContext *rp_context_;
 };
@@ -430,6 +445,9 @@ class ReplayState {
     ReplayState(CommandExecutionContext &exec_context, const CommandBufferAccessContext &recorded_context,
                 const ErrorObject &error_object, uint32_t index);
 
+    // The sync operations are still replayed, so that the execution context state stays correct
+    void SkipHazardDetection() { detect_hazards_ = false; }
+
     CommandExecutionContext &GetExecutionContext() const { return exec_context_; }
     ResourceUsageTag GetBaseTag() const { return base_tag_; }
 
@@ -451,4 +469,5 @@ class ReplayState {
     const uint32_t index_;
     const ResourceUsageTag base_tag_;
     RenderPassReplayState rp_replay_;
+    bool detect_hazards_ = true;
 };
@@ -18,6 +18,8 @@
 #include "sync/sync_renderpass.h"
 #include "sync/sync_validation.h"
 #include "sync/sync_op.h"
+#include "utils/hash_util.h"
+#include "utils/memory_footprint.h"
 
 // Action for validating resolve operations
 class ValidateResolveAction {
@@ -882,14 +884,84 @@ AttachmentViewGenVector RenderPassAccessContext::CreateAttachmentViewGen(
     }
     return view_gens;
 }
+RenderPassAccessContext::RenderPassAccessContext()
+    : rp_state_(nullptr),
+      render_area_(VkRect2D()),
+      current_subpass_(0),
+      attachment_views_storage_(std::make_shared<const AttachmentViewGenVector>()),
+      attachment_views_(*attachment_views_storage_) {}
+
 RenderPassAccessContext::RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area,
                                                  VkQueueFlags queue_flags,
-                                                 const std::vector<const syncval_state::ImageViewState *> &attachment_views,
+                                                 std::shared_ptr<const AttachmentViewGenVector> attachment_views,
                                                  const AccessContext *external_context)
-    : rp_state_(&rp_state), render_area_(render_area), current_subpass_(0U), attachment_views_() {
+    : rp_state_(&rp_state),
+      render_area_(render_area),
+      current_subpass_(0U),
+      attachment_views_storage_(std::move(attachment_views)),
+      attachment_views_(*attachment_views_storage_) {
     // Add this for all subpasses here so that they exist during next subpass validation
     InitSubpassContexts(queue_flags, rp_state, external_context, subpass_contexts_);
-    attachment_views_ = CreateAttachmentViewGen(render_area, attachment_views);
+}
+
+size_t AttachmentViewGenCache::KeyHash::operator()(const Key &key) const {
+    hash_util::HashCombiner hc;
+    hc << key.render_area.offset.x << key.render_area.offset.y << key.render_area.extent.width << key.render_area.extent.height;
+    hc.Combine(key.views);
+    return hc.Value();
+}
+
+bool AttachmentViewGenCache::IsStale(const Key &key, const Entry &entry) {
+    for (size_t i = 0; i < key.views.size(); ++i) {
+        const auto view = entry.views[i].lock();
+        if (view.get() != key.views[i] || (view && view->Destroyed())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<const AttachmentViewGenVector> AttachmentViewGenCache::Get(
+    const VkRect2D &render_area, const std::vector<std::shared_ptr<const vvl::ImageView>> &views) {
+    Key key{render_area, {}};
+    key.views.reserve(views.size());
+    for (const auto &view : views) {
+        key.views.emplace_back(view.get());
+    }
+
+    std::lock_guard<std::mutex> guard(lock_);
+    auto found = entries_.find(key);
+    if (found != entries_.end()) {
+        if (!IsStale(found->first, found->second)) {
+            return found->second.view_gens;
+        }
+        entries_.erase(found);
+    }
+
+    if (entries_.size() >= kMaxEntries) {
+        vvl::EraseIf(entries_, [](const auto &entry) { return IsStale(entry.first, entry.second); });
+        if (entries_.size() >= kMaxEntries) {
+            entries_.clear();
+        }
+    }
+
+    std::vector<const syncval_state::ImageViewState *> view_states;
+    view_states.reserve(views.size());
+    for (const auto &view : views) {
+        view_states.emplace_back(static_cast<const syncval_state::ImageViewState *>(view.get()));
+    }
+    auto view_gens =
+        std::make_shared<const AttachmentViewGenVector>(RenderPassAccessContext::CreateAttachmentViewGen(render_area, view_states));
+    entries_.emplace(std::move(key), Entry{view_gens, {views.begin(), views.end()}});
+    return view_gens;
+}
+
+void AttachmentViewGenCache::CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    footprint.AddNodes("SyncVal attachment range cache", entries_);
+    for (const auto &entry : entries_) {
+        footprint.AddVector("SyncVal attachment range cache", *entry.second.view_gens);
+    }
 }
 void RenderPassAccessContext::RecordBeginRenderPass(const ResourceUsageTag barrier_tag, const ResourceUsageTag load_tag) {
     assert(0 == current_subpass_);
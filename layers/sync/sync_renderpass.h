@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <vulkan/vulkan.h>
 
 #include "sync/sync_common.h"
@@ -28,6 +30,7 @@ struct ClearAttachmentInfo;
 
 namespace vvl {
 struct LastBound;
+class MemoryFootprint;
 }  // namespace vvl
 
 namespace syncval_state {
@@ -105,10 +108,10 @@ class RenderPassAccessContext {
   public:
     static AttachmentViewGenVector CreateAttachmentViewGen(
         const VkRect2D &render_area, const std::vector<const syncval_state::ImageViewState *> &attachment_views);
-    RenderPassAccessContext() : rp_state_(nullptr), render_area_(VkRect2D()), current_subpass_(0) {}
+    RenderPassAccessContext();
+    // attachment_views usually come from the AttachmentViewGenCache, shared with the other instances of the same views
     RenderPassAccessContext(const vvl::RenderPass &rp_state, const VkRect2D &render_area, VkQueueFlags queue_flags,
-                            const std::vector<const syncval_state::ImageViewState *> &attachment_views,
-                            const AccessContext *external_context);
+                            std::shared_ptr<const AttachmentViewGenVector> attachment_views, const AccessContext *external_context);
 
     static bool ValidateLayoutTransitions(const SyncValidationInfo &val_info, const AccessContext &access_context,
                                           const vvl::RenderPass &rp_state, const VkRect2D &render_area, uint32_t subpass,
@@ -151,6 +154,7 @@ class RenderPassAccessContext {
     AccessContext &CurrentContext() { return subpass_contexts_[current_subpass_]; }
     const AccessContext &CurrentContext() const { return subpass_contexts_[current_subpass_]; }
     const std::vector<AccessContext> &GetContexts() const { return subpass_contexts_; }
+    const AttachmentViewGenVector &GetAttachmentViews() const { return attachment_views_; }
     uint32_t GetCurrentSubpass() const { return current_subpass_; }
     const vvl::RenderPass *GetRenderPassState() const { return rp_state_; }
     AccessContext *CreateStoreResolveProxy() const;
@@ -160,5 +164,44 @@ class RenderPassAccessContext {
     const VkRect2D render_area_;
     uint32_t current_subpass_;
     std::vector<AccessContext> subpass_contexts_;
-    AttachmentViewGenVector attachment_views_;
+    std::shared_ptr<const AttachmentViewGenVector> attachment_views_storage_;
+    const AttachmentViewGenVector &attachment_views_;
+};
+
+// The attachment range generators of render pass instances, by attachment views and render area. Building them encodes the
+// view and render area subresource ranges of every attachment, which applications redo with the same framebuffer for many
+// render pass instances each frame. The render pass begin validation, its record, and every later instance using the same
+// views and render area share one set.
+class AttachmentViewGenCache {
+  public:
+    std::shared_ptr<const AttachmentViewGenVector> Get(const VkRect2D &render_area,
+                                                       const std::vector<std::shared_ptr<const vvl::ImageView>> &views);
+    void CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const;
+
+  private:
+    // Past this many entries the stale ones are dropped, and if that isn't enough the whole cache
+    static constexpr size_t kMaxEntries = 256;
+
+    struct Key {
+        VkRect2D render_area;
+        std::vector<const vvl::ImageView *> views;
+        bool operator==(const Key &rhs) const {
+            return render_area.offset.x == rhs.render_area.offset.x && render_area.offset.y == rhs.render_area.offset.y &&
+                   render_area.extent.width == rhs.render_area.extent.width &&
+                   render_area.extent.height == rhs.render_area.extent.height && views == rhs.views;
+        }
+    };
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+    struct Entry {
+        std::shared_ptr<const AttachmentViewGenVector> view_gens;
+        // Only weak references, so the cache doesn't keep destroyed views and their images alive. An entry whose views
+        // expired, or were destroyed, is stale: a new view could have the address of one in the key.
+        std::vector<std::weak_ptr<const vvl::ImageView>> views;
+    };
+    static bool IsStale(const Key &key, const Entry &entry);
+
+    mutable std::mutex lock_;
+    vvl::unordered_map<Key, Entry, KeyHash> entries_;
 };
@@ -238,7 +238,10 @@ QueueBatchContext::QueueBatchContext(const SyncValidator& sync_state, const Queu
       current_access_context_(&access_context_),
       batch_log_(),
       queue_sync_tag_(sync_state.GetQueueIdLimit(), ResourceUsageTag(0)),
-      batch_(queue_state, submit_index, batch_index) {}
+      batch_(queue_state, submit_index, batch_index) {
+    access_context_.SetValidationBudget(sync_state.validation_budget.get());
+    access_context_.SetCheckProfiler(sync_state.check_profiler.get());
+}
 
 QueueBatchContext::QueueBatchContext(const SyncValidator& sync_state)
     : CommandExecutionContext(&sync_state),
@@ -247,7 +250,10 @@ QueueBatchContext::QueueBatchContext(const SyncValidator& sync_state)
       current_access_context_(&access_context_),
       batch_log_(),
       queue_sync_tag_(sync_state.GetQueueIdLimit(), ResourceUsageTag(0)),
-      batch_() {}
+      batch_() {
+    access_context_.SetValidationBudget(sync_state.validation_budget.get());
+    access_context_.SetCheckProfiler(sync_state.check_profiler.get());
+}
 
 void QueueBatchContext::Trim() {
     // Clean up unneeded access context contents and log information
@@ -263,6 +269,14 @@ void QueueBatchContext::Trim() {
     batch_log_.Trim(used_tags);
 }
 
+void QueueBatchContext::CollectMemoryFootprint(vvl::MemoryFootprint& footprint) const {
+    footprint.AddNodes("SyncVal queue batch access states", access_context_.GetAccessStateMap());
+    // The logs themselves are owned by the submitted command buffers
+    const size_t log_count = batch_log_.Size();
+    footprint.Add("SyncVal queue batch log references", log_count,
+                  vvl::MemoryFootprint::NodeBytes<std::pair<ResourceUsageRange, BatchAccessLog::CBSubmitLog>>(log_count));
+}
+
 void QueueBatchContext::ResolveSubmittedCommandBuffer(const AccessContext& recorded_context, ResourceUsageTag offset) {
     GetCurrentAccessContext()->ResolveFromContext(QueueTagOffsetBarrierAction(GetQueueId(), offset), recorded_context);
 }
@@ -637,6 +651,10 @@ void QueueBatchContext::SetTagBias(ResourceUsageTag bias) {
 bool QueueBatchContext::DoQueueSubmitValidate(const SyncValidator& sync_state, QueueSubmitCmdState& cmd_state,
                                               const VkSubmitInfo2& batch_info) {
     bool skip = false;
+    // Queues excluded by validated_queue_families, and batches submitted while the budget sheds sync-val, only update the access
+    // state, for the batches waiting on them
+    const bool detect_hazards = sync_state.IsQueueFamilyValidated(queue_state_->GetQueueState()->queueFamilyIndex) &&
+                                !sync_state.IsCheckShed(vvl::CheckFamily::SyncValidation);
 
     //  For each submit in the batch...
     for (const auto& cb : command_buffers_) {
@@ -645,7 +663,11 @@ bool QueueBatchContext::DoQueueSubmitValidate(const SyncValidator& sync_state, Q
             batch_.cb_index++;
             continue;  // Skip empty CB's but also skip the unused index for correct reporting
         }
-        skip |= ReplayState(*this, cb_access_context, cmd_state.error_obj, cb.index).ValidateFirstUse();
+        ReplayState replay(*this, cb_access_context, cmd_state.error_obj, cb.index);
+        if (!detect_hazards) {
+            replay.SkipHazardDetection();
+        }
+        skip |= replay.ValidateFirstUse();
 
         // The barriers have already been applied in ValidatFirstUse
         ResourceUsageRange tag_range = ImportRecordedAccessLog(cb_access_context);
@@ -746,6 +768,26 @@ QueueBatchContext::BatchSet SyncValidator::GetQueueBatchSnapshot() {
     return snapshot;
 }
 
+void SyncValidator::CollectMemoryFootprint(vvl::MemoryFootprint& footprint) const {
+    StateTracker::CollectMemoryFootprint(footprint);
+
+    ReadLockGuard guard(queue_state_lock_);
+    // Same set of batches as GetQueueBatchSnapshot(), the ones still held by a queue or a signaled semaphore
+    QueueBatchContext::ConstBatchSet batches = GetQueueLastBatchSnapshot();
+    auto append = [&batches](const std::shared_ptr<const QueueBatchContext>& batch) {
+        if (batch && !vvl::Contains(batches, batch)) {
+            batches.emplace(batch);
+        }
+        return false;
+    };
+    GetQueueBatchSnapshotImpl<QueueBatchContext::ConstBatchSet>(signaled_semaphores_, append);
+    for (const auto& batch : batches) {
+        batch->CollectMemoryFootprint(footprint);
+    }
+    footprint.AddNodes("SyncVal waitable fences", waitable_fences_);
+    attachment_view_gen_cache_.CollectMemoryFootprint(footprint);
+}
+
 // Note that function is const, but updates mutable submit_index to allow Validate to create correct tagging for command invocation
 // scope state.
 // Given that queue submits are supposed to be externally synchronized for the same queue, this should safe without being
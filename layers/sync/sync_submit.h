@@ -192,6 +192,7 @@ class BatchAccessLog {
                 std::shared_ptr<const CommandExecutionContext::AccessLog> log);
 
     void Trim(const ResourceUsageTagSet &used);
+    size_t Size() const { return log_map_.size(); }
     // AccessRecord lookup is based on global tags
     AccessRecord operator[](ResourceUsageTag tag) const;
     BatchAccessLog() {}
@@ -296,6 +297,7 @@ class QueueBatchContext : public CommandExecutionContext {
     void EndRenderPassReplayCleanup(ReplayState &replay) override;
 
     void Cleanup();
+    void CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const;
 
   private:
     void CommonSetupAccessContext(const std::shared_ptr<const QueueBatchContext> &prev,
@@ -22,6 +22,22 @@
 
 #include "sync/sync_validation.h"
 
+ReadLockGuard SyncValidator::ReadLock() const {
+    if (fine_grained_locking) {
+        return ReadLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return ReadLockGuard(validation_object_mutex);
+    }
+}
+
+WriteLockGuard SyncValidator::WriteLock() {
+    if (fine_grained_locking) {
+        return WriteLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return WriteLockGuard(validation_object_mutex);
+    }
+}
+
 ResourceUsageRange SyncValidator::ReserveGlobalTagRange(size_t tag_count) const {
     ResourceUsageRange reserve;
     reserve.begin = tag_limit_.fetch_add(tag_count);
@@ -132,6 +148,10 @@ std::shared_ptr<vvl::Swapchain> SyncValidator::CreateSwapchainState(const VkSwap
     return std::static_pointer_cast<vvl::Swapchain>(std::make_shared<syncval_state::Swapchain>(this, create_info, swapchain));
 }
 
+std::shared_ptr<vvl::Buffer> SyncValidator::CreateBufferState(VkBuffer buf, const VkBufferCreateInfo *pCreateInfo) {
+    return std::make_shared<syncval_state::BufferState>(this, buf, pCreateInfo);
+}
+
 std::shared_ptr<vvl::Image> SyncValidator::CreateImageState(VkImage img, const VkImageCreateInfo *pCreateInfo,
                                                             VkFormatFeatureFlags2KHR features) {
     return std::make_shared<ImageState>(this, img, pCreateInfo, features);
@@ -152,7 +172,7 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer,
                                                  uint32_t regionCount, const VkBufferCopy *pRegions,
                                                  const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -191,7 +211,7 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer,
 
 void SyncValidator::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                                uint32_t regionCount, const VkBufferCopy *pRegions, const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -217,7 +237,7 @@ void SyncValidator::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, Vk
 bool SyncValidator::PreCallValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfo,
                                                   const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -261,7 +281,7 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer2KHR(VkCommandBuffer commandBuff
 }
 
 void SyncValidator::RecordCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR *pCopyBufferInfo, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -298,7 +318,7 @@ bool SyncValidator::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, V
                                                 VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                                 const VkImageCopy *pRegions, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -341,7 +361,7 @@ bool SyncValidator::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, V
 void SyncValidator::PreCallRecordCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
                                               VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                               const VkImageCopy *pRegions, const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -368,7 +388,7 @@ void SyncValidator::PreCallRecordCmdCopyImage(VkCommandBuffer commandBuffer, VkI
 bool SyncValidator::PreCallValidateCmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2 *pCopyImageInfo,
                                                  const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -415,7 +435,7 @@ bool SyncValidator::PreCallValidateCmdCopyImage2KHR(VkCommandBuffer commandBuffe
 }
 
 void SyncValidator::RecordCmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2KHR *pCopyImageInfo, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -455,7 +475,7 @@ bool SyncValidator::PreCallValidateCmdPipelineBarrier(
     uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
     const VkImageMemoryBarrier *pImageMemoryBarriers, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -473,7 +493,7 @@ void SyncValidator::PreCallRecordCmdPipelineBarrier(
     VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
     uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
     const VkImageMemoryBarrier *pImageMemoryBarriers, const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -492,7 +512,7 @@ bool SyncValidator::PreCallValidateCmdPipelineBarrier2KHR(VkCommandBuffer comman
 bool SyncValidator::PreCallValidateCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo,
                                                        const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -505,7 +525,7 @@ bool SyncValidator::PreCallValidateCmdPipelineBarrier2(VkCommandBuffer commandBu
 
 void SyncValidator::PreCallRecordCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR *pDependencyInfo,
                                                         const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -516,7 +536,7 @@ void SyncValidator::PreCallRecordCmdPipelineBarrier2KHR(VkCommandBuffer commandB
 
 void SyncValidator::PreCallRecordCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo,
                                                      const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -536,6 +556,13 @@ void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
         queue_sync_states_.emplace(std::make_pair(queue_state->VkHandle(), std::move(queue_sync_state)));
     });
 
+    if (!disabled[sync_validation_queue_submit]) {
+        const uint32_t worker_count = vvl::WorkerPool::WorkerCount(syncval_settings.submit_replay_threads);
+        if (worker_count > 0) {
+            replay_workers_ = std::make_unique<vvl::WorkerPool>(worker_count);
+        }
+    }
+
     const auto env_debug_command_number = GetEnvironment("VK_SYNCVAL_DEBUG_COMMAND_NUMBER");
     if (!env_debug_command_number.empty()) {
         debug_command_number = static_cast<uint32_t>(std::stoul(env_debug_command_number));
@@ -551,7 +578,7 @@ void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                             const VkSubpassBeginInfo *pSubpassBeginInfo, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     if (cb_state) {
         SyncOpBeginRenderPass sync_op(error_obj.location.function, *this, pRenderPassBegin, pSubpassBeginInfo);
         skip = sync_op.Validate(cb_state->access_context);
@@ -589,14 +616,24 @@ void SyncValidator::PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuff
     StateTracker::PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
 
     // Create/initialize the structure that trackers accesses at the command buffer scope.
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     cb_state->access_context.Reset();
 }
 
+void SyncValidator::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    StateTracker::PostCallRecordEndCommandBuffer(commandBuffer, record_obj);
+    if (record_obj.result != VK_SUCCESS) return;
+
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
+    if (cb_state) {
+        cb_state->access_context.RecordEndCommandBuffer();
+    }
+}
+
 void SyncValidator::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                              const VkSubpassBeginInfo *pSubpassBeginInfo, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     if (cb_state) {
         cb_state->access_context.RecordSyncOp<SyncOpBeginRenderPass>(command, *this, pRenderPassBegin, pSubpassBeginInfo);
     }
@@ -627,7 +664,7 @@ bool SyncValidator::ValidateCmdNextSubpass(VkCommandBuffer commandBuffer, const
                                            const VkSubpassEndInfo *pSubpassEndInfo, const ErrorObject &error_obj) const {
     bool skip = false;
 
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -660,7 +697,7 @@ bool SyncValidator::PreCallValidateCmdNextSubpass2(VkCommandBuffer commandBuffer
 
 void SyncValidator::RecordCmdNextSubpass(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo *pSubpassBeginInfo,
                                          const VkSubpassEndInfo *pSubpassEndInfo, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -691,7 +728,7 @@ bool SyncValidator::ValidateCmdEndRenderPass(VkCommandBuffer commandBuffer, cons
                                              const ErrorObject &error_obj) const {
     bool skip = false;
 
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     auto *cb_context = &cb_state->access_context;
@@ -721,7 +758,7 @@ bool SyncValidator::PreCallValidateCmdEndRenderPass2KHR(VkCommandBuffer commandB
 
 void SyncValidator::RecordCmdEndRenderPass(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo, Func command) {
     // Resolve the all subpass contexts to the command buffer contexts
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -762,7 +799,7 @@ bool SyncValidator::PreCallValidateCmdBeginRenderingKHR(VkCommandBuffer commandB
 bool SyncValidator::PreCallValidateCmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo *pRenderingInfo,
                                                      const ErrorObject &error_obj) const {
     bool skip = false;
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state || !pRenderingInfo) return skip;
 
@@ -785,8 +822,8 @@ void SyncValidator::PreCallRecordCmdBeginRendering(VkCommandBuffer commandBuffer
     vvl::TlsGuard<syncval_state::BeginRenderingCmdState> cmd_state;
 
     assert(cmd_state && cmd_state->cb_state && (cmd_state->cb_state->commandBuffer() == commandBuffer));
-    // Note: for fine grain locking need to to something other than cast.
-    auto cb_state = std::const_pointer_cast<syncval_state::CommandBuffer>(cmd_state->cb_state);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
+    assert(cb_state.get() == cmd_state->cb_state.get());
     cb_state->access_context.RecordBeginRendering(*cmd_state, record_obj);
 }
 
@@ -796,7 +833,7 @@ bool SyncValidator::PreCallValidateCmdEndRenderingKHR(VkCommandBuffer commandBuf
 
 bool SyncValidator::PreCallValidateCmdEndRendering(VkCommandBuffer commandBuffer, const ErrorObject &error_obj) const {
     bool skip = false;
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
 
@@ -810,7 +847,7 @@ void SyncValidator::PreCallRecordCmdEndRenderingKHR(VkCommandBuffer commandBuffe
 
 void SyncValidator::PreCallRecordCmdEndRendering(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdEndRendering(commandBuffer, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
 
@@ -822,7 +859,7 @@ bool SyncValidator::ValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer,
                                                  VkImageLayout dstImageLayout, uint32_t regionCount, const RegionType *pRegions,
                                                  const Location &loc) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -892,7 +929,7 @@ template <typename RegionType>
 void SyncValidator::RecordCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage,
                                                VkImageLayout dstImageLayout, uint32_t regionCount, const RegionType *pRegions,
                                                Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -949,7 +986,7 @@ bool SyncValidator::ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer,
                                                  VkBuffer dstBuffer, uint32_t regionCount, const RegionType *pRegions,
                                                  const Location &loc) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1014,7 +1051,7 @@ bool SyncValidator::PreCallValidateCmdCopyImageToBuffer2(VkCommandBuffer command
 template <typename RegionType>
 void SyncValidator::RecordCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
                                                VkBuffer dstBuffer, uint32_t regionCount, const RegionType *pRegions, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1073,7 +1110,7 @@ bool SyncValidator::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage
                                          VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                          const RegionType *pRegions, VkFilter filter, const Location &loc) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1149,7 +1186,7 @@ template <typename RegionType>
 void SyncValidator::RecordCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
                                        VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                        const RegionType *pRegions, VkFilter filter, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     const auto tag = cb_state->access_context.NextCommandTag(command);
     auto *context = cb_state->access_context.GetCurrentAccessContext();
@@ -1284,7 +1321,7 @@ void SyncValidator::RecordCountBuffer(AccessContext &context, const ResourceUsag
 bool SyncValidator::PreCallValidateCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z,
                                                const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
 
@@ -1295,7 +1332,7 @@ bool SyncValidator::PreCallValidateCmdDispatch(VkCommandBuffer commandBuffer, ui
 void SyncValidator::PreCallRecordCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z,
                                              const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDispatch(commandBuffer, x, y, z, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     auto *cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
@@ -1306,7 +1343,7 @@ void SyncValidator::PreCallRecordCmdDispatch(VkCommandBuffer commandBuffer, uint
 bool SyncValidator::PreCallValidateCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                        const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
 
@@ -1323,7 +1360,7 @@ bool SyncValidator::PreCallValidateCmdDispatchIndirect(VkCommandBuffer commandBu
 void SyncValidator::PreCallRecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                      const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     auto *cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
@@ -1337,7 +1374,7 @@ void SyncValidator::PreCallRecordCmdDispatchIndirect(VkCommandBuffer commandBuff
 bool SyncValidator::PreCallValidateCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
                                            uint32_t firstVertex, uint32_t firstInstance, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1351,7 +1388,7 @@ bool SyncValidator::PreCallValidateCmdDraw(VkCommandBuffer commandBuffer, uint32
 void SyncValidator::PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
                                          uint32_t firstVertex, uint32_t firstInstance, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     auto *cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
@@ -1365,7 +1402,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer,
                                                   uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance,
                                                   const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1381,7 +1418,7 @@ void SyncValidator::PreCallRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, u
                                                 const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance,
                                               record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     auto *cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
@@ -1396,7 +1433,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndirect(VkCommandBuffer commandBuffer
     bool skip = false;
     if (drawCount == 0) return skip;
 
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1421,7 +1458,7 @@ void SyncValidator::PreCallRecordCmdDrawIndirect(VkCommandBuffer commandBuffer,
                                                  uint32_t drawCount, uint32_t stride, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
     if (drawCount == 0) return;
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     auto *cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
@@ -1442,7 +1479,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer comman
                                                           uint32_t drawCount, uint32_t stride, const ErrorObject &error_obj) const {
     bool skip = false;
     if (drawCount == 0) return skip;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1466,7 +1503,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer comman
 void SyncValidator::PreCallRecordCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                         uint32_t drawCount, uint32_t stride, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1488,7 +1525,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndirectCount(VkCommandBuffer commandB
                                                         VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                         uint32_t stride, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1513,7 +1550,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndirectCount(VkCommandBuffer commandB
 void SyncValidator::RecordCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                uint32_t stride, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1575,7 +1612,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer c
                                                                uint32_t maxDrawCount, uint32_t stride,
                                                                const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1600,7 +1637,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer c
 void SyncValidator::RecordCmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                       VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                       uint32_t stride, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1665,7 +1702,7 @@ bool SyncValidator::PreCallValidateCmdClearColorImage(VkCommandBuffer commandBuf
                                                       const VkClearColorValue *pColor, uint32_t rangeCount,
                                                       const VkImageSubresourceRange *pRanges, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1694,7 +1731,7 @@ void SyncValidator::PreCallRecordCmdClearColorImage(VkCommandBuffer commandBuffe
                                                     const VkClearColorValue *pColor, uint32_t rangeCount,
                                                     const VkImageSubresourceRange *pRanges, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1718,7 +1755,7 @@ bool SyncValidator::PreCallValidateCmdClearDepthStencilImage(VkCommandBuffer com
                                                              const VkImageSubresourceRange *pRanges,
                                                              const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1748,7 +1785,7 @@ void SyncValidator::PreCallRecordCmdClearDepthStencilImage(VkCommandBuffer comma
                                                            const VkImageSubresourceRange *pRanges, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges,
                                                          record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1771,7 +1808,7 @@ bool SyncValidator::PreCallValidateCmdClearAttachments(VkCommandBuffer commandBu
                                                        const VkClearRect *pRects, const ErrorObject &error_obj) const {
     bool skip = false;
 
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
 
@@ -1788,7 +1825,7 @@ bool SyncValidator::PreCallValidateCmdClearAttachments(VkCommandBuffer commandBu
 void SyncValidator::PreCallRecordCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
                                                      const VkClearAttachment *pAttachments, uint32_t rectCount,
                                                      const VkClearRect *pRects, const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     auto cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
 
@@ -1804,7 +1841,7 @@ bool SyncValidator::PreCallValidateCmdCopyQueryPoolResults(VkCommandBuffer comma
                                                            VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags,
                                                            const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1835,7 +1872,7 @@ void SyncValidator::PreCallRecordCmdCopyQueryPoolResults(VkCommandBuffer command
                                                          const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset,
                                                        stride, flags, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1856,7 +1893,7 @@ void SyncValidator::PreCallRecordCmdCopyQueryPoolResults(VkCommandBuffer command
 bool SyncValidator::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                  VkDeviceSize size, uint32_t data, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1882,7 +1919,7 @@ bool SyncValidator::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer,
 void SyncValidator::PreCallRecordCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                VkDeviceSize size, uint32_t data, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1902,7 +1939,7 @@ bool SyncValidator::PreCallValidateCmdResolveImage(VkCommandBuffer commandBuffer
                                                    VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                                    const VkImageResolve *pRegions, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1949,7 +1986,7 @@ void SyncValidator::PreCallRecordCmdResolveImage(VkCommandBuffer commandBuffer,
                                                  const VkImageResolve *pRegions, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
                                                pRegions, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1978,7 +2015,7 @@ void SyncValidator::PreCallRecordCmdResolveImage(VkCommandBuffer commandBuffer,
 bool SyncValidator::PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2KHR *pResolveImageInfo,
                                                     const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2031,7 +2068,7 @@ bool SyncValidator::PreCallValidateCmdResolveImage2KHR(VkCommandBuffer commandBu
 void SyncValidator::PreCallRecordCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2KHR *pResolveImageInfo,
                                                   const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdResolveImage2(commandBuffer, pResolveImageInfo, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2065,7 +2102,7 @@ void SyncValidator::PreCallRecordCmdResolveImage2KHR(VkCommandBuffer commandBuff
 bool SyncValidator::PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                    VkDeviceSize dataSize, const void *pData, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2092,7 +2129,7 @@ bool SyncValidator::PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer
 void SyncValidator::PreCallRecordCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                  VkDeviceSize dataSize, const void *pData, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2113,7 +2150,7 @@ bool SyncValidator::PreCallValidateCmdWriteBufferMarkerAMD(VkCommandBuffer comma
                                                            VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker,
                                                            const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2140,7 +2177,7 @@ void SyncValidator::PreCallRecordCmdWriteBufferMarkerAMD(VkCommandBuffer command
                                                          VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker,
                                                          const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2159,7 +2196,7 @@ void SyncValidator::PreCallRecordCmdWriteBufferMarkerAMD(VkCommandBuffer command
 bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR *pDecodeInfo,
                                                      const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2228,7 +2265,7 @@ bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuff
 
 void SyncValidator::PreCallRecordCmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR *pDecodeInfo,
                                                    const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2271,7 +2308,7 @@ void SyncValidator::PreCallRecordCmdDecodeVideoKHR(VkCommandBuffer commandBuffer
 bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR *pEncodeInfo,
                                                      const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2340,7 +2377,7 @@ bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuff
 
 void SyncValidator::PreCallRecordCmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR *pEncodeInfo,
                                                    const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2383,7 +2420,7 @@ void SyncValidator::PreCallRecordCmdEncodeVideoKHR(VkCommandBuffer commandBuffer
 bool SyncValidator::PreCallValidateCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask,
                                                const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2398,7 +2435,7 @@ bool SyncValidator::PreCallValidateCmdSetEvent(VkCommandBuffer commandBuffer, Vk
 void SyncValidator::PostCallRecordCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask,
                                               const RecordObject &record_obj) {
     StateTracker::PostCallRecordCmdSetEvent(commandBuffer, event, stageMask, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2415,7 +2452,7 @@ bool SyncValidator::PreCallValidateCmdSetEvent2KHR(VkCommandBuffer commandBuffer
 bool SyncValidator::PreCallValidateCmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event,
                                                 const VkDependencyInfo *pDependencyInfo, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2437,7 +2474,7 @@ void SyncValidator::PostCallRecordCmdSetEvent2KHR(VkCommandBuffer commandBuffer,
 void SyncValidator::PostCallRecordCmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event,
                                                const VkDependencyInfo *pDependencyInfo, const RecordObject &record_obj) {
     StateTracker::PostCallRecordCmdSetEvent2(commandBuffer, event, pDependencyInfo, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2450,7 +2487,7 @@ void SyncValidator::PostCallRecordCmdSetEvent2(VkCommandBuffer commandBuffer, Vk
 bool SyncValidator::PreCallValidateCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask,
                                                  const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2462,7 +2499,7 @@ bool SyncValidator::PreCallValidateCmdResetEvent(VkCommandBuffer commandBuffer,
 void SyncValidator::PostCallRecordCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask,
                                                 const RecordObject &record_obj) {
     StateTracker::PostCallRecordCmdResetEvent(commandBuffer, event, stageMask, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2473,7 +2510,7 @@ void SyncValidator::PostCallRecordCmdResetEvent(VkCommandBuffer commandBuffer, V
 bool SyncValidator::PreCallValidateCmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask,
                                                   const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2496,7 +2533,7 @@ void SyncValidator::PostCallRecordCmdResetEvent2KHR(VkCommandBuffer commandBuffe
 void SyncValidator::PostCallRecordCmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask,
                                                  const RecordObject &record_obj) {
     StateTracker::PostCallRecordCmdResetEvent2(commandBuffer, event, stageMask, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2512,7 +2549,7 @@ bool SyncValidator::PreCallValidateCmdWaitEvents(VkCommandBuffer commandBuffer,
                                                  uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers,
                                                  const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2534,7 +2571,7 @@ void SyncValidator::PostCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, u
                                               pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers,
                                               imageMemoryBarrierCount, pImageMemoryBarriers, record_obj);
 
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2559,7 +2596,7 @@ void SyncValidator::PostCallRecordCmdWaitEvents2KHR(VkCommandBuffer commandBuffe
 bool SyncValidator::PreCallValidateCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
                                                   const VkDependencyInfo *pDependencyInfos, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2574,7 +2611,7 @@ void SyncValidator::PostCallRecordCmdWaitEvents2(VkCommandBuffer commandBuffer,
                                                  const VkDependencyInfo *pDependencyInfos, const RecordObject &record_obj) {
     StateTracker::PostCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
 
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2587,7 +2624,7 @@ bool SyncValidator::PreCallValidateCmdWriteBufferMarker2AMD(VkCommandBuffer comm
                                                             VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker,
                                                             const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2614,7 +2651,7 @@ void SyncValidator::PreCallRecordCmdWriteBufferMarker2AMD(VkCommandBuffer comman
                                                           VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker,
                                                           const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdWriteBufferMarker2AMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2633,7 +2670,7 @@ void SyncValidator::PreCallRecordCmdWriteBufferMarker2AMD(VkCommandBuffer comman
 bool SyncValidator::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                                       const VkCommandBuffer *pCommandBuffers, const ErrorObject &error_obj) const {
     bool skip = StateTracker::PreCallValidateCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, error_obj);
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2663,7 +2700,7 @@ bool SyncValidator::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuf
 void SyncValidator::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                                     const VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2701,6 +2738,7 @@ void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObjec
     StateTracker::PostCallRecordQueueWaitIdle(queue, record_obj);
     if ((record_obj.result != VK_SUCCESS) || (disabled[sync_validation_queue_submit]) || (queue == VK_NULL_HANDLE)) return;
 
+    WriteLockGuard guard(queue_state_lock_);
     const auto queue_state = GetQueueSyncStateShared(queue);
     if (!queue_state) return;  // Invalid queue
     QueueId waited_queue = queue_state->GetQueueId();
@@ -2712,6 +2750,7 @@ void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObjec
 
 void SyncValidator::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObject &record_obj) {
     StateTracker::PostCallRecordDeviceWaitIdle(device, record_obj);
+    WriteLockGuard guard(queue_state_lock_);
 
     // We need to treat this a fence waits for all queues... noting that present engine ops will be preserved.
     ForAllQueueBatchContexts(
@@ -2736,6 +2775,7 @@ bool SyncValidator::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresen
     // Since this early return is above the TlsGuard, the Record phase must also be.
     if (disabled[sync_validation_queue_submit]) return skip;
 
+    ReadLockGuard guard(queue_state_lock_);
     vvl::TlsGuard<QueuePresentCmdState> cmd_state(&skip, signaled_semaphores_);
     cmd_state->queue = GetQueueSyncStateShared(queue);
     if (!cmd_state->queue) return skip;  // Invalid Queue
@@ -2801,6 +2841,7 @@ void SyncValidator::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresent
         return;
     }
 
+    WriteLockGuard guard(queue_state_lock_);
     // Update the state with the data from the validate phase
     cmd_state->signaled.Resolve(signaled_semaphores_, cmd_state->present_batch);
     std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state->queue));
@@ -2834,6 +2875,7 @@ void SyncValidator::RecordAcquireNextImageState(VkDevice device, VkSwapchainKHR
     auto swapchain_state = Get<syncval_state::Swapchain>(swapchain);
     if (vvl::StateObject::Invalid(swapchain_state)) return;  // Invalid acquire calls to be caught in CoreCheck/Parameter validation
 
+    WriteLockGuard guard(queue_state_lock_);
     PresentedImage presented = swapchain_state->MovePresentedImage(*pImageIndex);
     if (presented.Invalid()) return;
 
@@ -2883,7 +2925,9 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
 
     // Since this early return is above the TlsGuard, the Record phase must also be.
     if (disabled[sync_validation_queue_submit]) return skip;
+    auto check_scope = ProfileCheck(vvl::ValidationCheck::SyncValidateQueueSubmit);
 
+    ReadLockGuard guard(queue_state_lock_);
     vvl::TlsGuard<QueueSubmitCmdState> cmd_state(&skip, error_obj, signaled_semaphores_);
     cmd_state->queue = GetQueueSyncStateShared(queue);
     if (!cmd_state->queue) return skip;  // Invalid Queue
@@ -2951,6 +2995,7 @@ void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, const Record
     // Don't need to look up the queue state again, but we need a non-const version
     std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state->queue));
 
+    WriteLockGuard guard(queue_state_lock_);
     cmd_state->signaled.Resolve(signaled_semaphores_, cmd_state->last_batch);
     queue_state->UpdateLastBatch(std::move(cmd_state->last_batch));
 
@@ -2983,6 +3028,7 @@ void SyncValidator::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence,
     if (disabled[sync_validation_queue_submit]) return;
     if (record_obj.result == VK_SUCCESS) {
         // fence is signalled, mark it as waited for
+        WriteLockGuard guard(queue_state_lock_);
         WaitForFence(fence);
     }
 }
@@ -2993,6 +3039,7 @@ void SyncValidator::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceC
     if (disabled[sync_validation_queue_submit]) return;
     if ((record_obj.result == VK_SUCCESS) && ((VK_TRUE == waitAll) || (1 == fenceCount))) {
         // We can only know the pFences have signal if we waited for all of them, or there was only one of them
+        WriteLockGuard guard(queue_state_lock_);
         for (uint32_t i = 0; i < fenceCount; i++) {
             WaitForFence(pFences[i]);
         }
@@ -3020,18 +3067,44 @@ void SyncValidator::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapc
 void SyncValidator::PreCallRecordCmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT *pLabelInfo,
                                                             const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo, record_obj);
-    if (auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer)) {
+    if (auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer)) {
         cb_state->access_context.PushDebugRegion(pLabelInfo ? pLabelInfo->pLabelName : nullptr);
     }
 }
 
 void SyncValidator::PreCallRecordCmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdEndDebugUtilsLabelEXT(commandBuffer, record_obj);
-    if (auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer)) {
+    if (auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer)) {
         cb_state->access_context.PopDebugRegion();
     }
 }
 
+syncval_state::BufferState::BufferState(ValidationStateTracker *dev_data, VkBuffer buffer, const VkBufferCreateInfo *pCreateInfo)
+    : vvl::Buffer(dev_data, buffer, pCreateInfo), whole_resource_tracking_(dev_data->syncval_settings.whole_resource_tracking) {}
+
+ResourceAccessRange syncval_state::BufferState::MakeMemoryRange(const ResourceAccessRange &range) const {
+    if (!SimpleBinding(*this)) {
+        return ResourceAccessRange();
+    }
+    const VkDeviceSize base_address = ResourceBaseAddress(*this);
+    if (whole_resource_tracking_ && range.non_empty()) {
+        return ResourceAccessRange(base_address, base_address + createInfo.size);
+    }
+    return range + base_address;
+}
+
+syncval_state::ImageState::ImageState(const ValidationStateTracker *dev_data, VkImage img, const VkImageCreateInfo *pCreateInfo,
+                                      VkFormatFeatureFlags2KHR features)
+    : vvl::Image(dev_data, img, pCreateInfo, features),
+      opaque_base_address_(0U),
+      whole_resource_tracking_(dev_data->syncval_settings.whole_resource_tracking) {}
+
+syncval_state::ImageState::ImageState(const ValidationStateTracker *dev_data, VkImage img, const VkImageCreateInfo *pCreateInfo,
+                                      VkSwapchainKHR swapchain, uint32_t swapchain_index, VkFormatFeatureFlags2KHR features)
+    : vvl::Image(dev_data, img, pCreateInfo, swapchain, swapchain_index, features),
+      opaque_base_address_(0U),
+      whole_resource_tracking_(dev_data->syncval_settings.whole_resource_tracking) {}
+
 bool syncval_state::ImageState::IsSimplyBound() const {
     bool simple = SimpleBinding(static_cast<const vvl::Bindable &>(*this)) || IsSwapchainImage() || bind_swapchain;
 
@@ -3073,11 +3146,22 @@ VkDeviceSize syncval_state::ImageState::GetResourceBaseAddress() const {
     return GetFakeBaseAddress();
 }
 
+ResourceAccessRange syncval_state::ImageState::GetFullMemoryRange() const {
+    if (!fragment_encoder || !IsSimplyBound()) {
+        return ResourceAccessRange();
+    }
+    const auto base_address = GetResourceBaseAddress();
+    return ResourceAccessRange(base_address, base_address + fragment_encoder->TotalSize());
+}
+
 ImageRangeGen syncval_state::ImageState::MakeImageRangeGen(const VkImageSubresourceRange &subresource_range,
                                                            bool is_depth_sliced) const {
     if (!fragment_encoder || !IsSimplyBound()) {
         return ImageRangeGen();  // default range generators have an empty position (generator "end")
     }
+    if (whole_resource_tracking_) {
+        return ImageRangeGen(GetFullMemoryRange());
+    }
 
     const auto base_address = GetResourceBaseAddress();
     ImageRangeGen range_gen(*fragment_encoder.get(), subresource_range, base_address, is_depth_sliced);
@@ -3090,6 +3174,9 @@ ImageRangeGen syncval_state::ImageState::MakeImageRangeGen(const VkImageSubresou
     if (!fragment_encoder || !IsSimplyBound()) {
         return ImageRangeGen();  // default range generators have an empty position (generator "end")
     }
+    if (whole_resource_tracking_) {
+        return ImageRangeGen(GetFullMemoryRange());
+    }
 
     const auto base_address = GetResourceBaseAddress();
     subresource_adapter::ImageRangeGenerator range_gen(*fragment_encoder.get(), subresource_range, offset, extent, base_address,
@@ -20,6 +20,7 @@
 #include <limits>
 #include <memory>
 #include <set>
+#include <shared_mutex>
 #include <vulkan/vulkan.h>
 
 #include "state_tracker/state_tracker.h"
@@ -32,6 +33,7 @@
 #include "sync/sync_renderpass.h"
 #include "sync/sync_commandbuffer.h"
 #include "sync/sync_submit.h"
+#include "utils/worker_pool.h"
 
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImage, syncval_state::ImageState, vvl::Image)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImageView, syncval_state::ImageViewState, vvl::ImageView)
@@ -49,11 +51,17 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     SyncValidator() { container_type = LayerObjectTypeSyncValidation; }
 
+    ReadLockGuard ReadLock() const override;
+    WriteLockGuard WriteLock() override;
+
     // Global tag range for submitted command buffers resource usage logs
     // Started the global tag count at 1 s.t. zero are invalid and ResourceUsageTag normalization can just zero them.
     mutable std::atomic<ResourceUsageTag> tag_limit_{1};  // This is reserved in Validation phase, thus mutable and atomic
     ResourceUsageRange ReserveGlobalTagRange(size_t tag_count) const;  // Note that the tag_limit_ is mutable this has side effects
 
+    // With fine grained locking the command buffer hooks only lock the command buffer being recorded. The queue level state
+    // below is shared by every queue, so the queue, fence and swapchain hooks using it take queue_state_lock_ instead.
+    mutable std::shared_mutex queue_state_lock_;
     vvl::unordered_map<VkQueue, std::shared_ptr<QueueSyncState>> queue_sync_states_;
     QueueId queue_id_limit_ = kQueueIdBase;
     SignaledSemaphores signaled_semaphores_;
@@ -62,6 +70,10 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     using SignaledFence = SignaledFences::value_type;
     SignaledFences waitable_fences_;
 
+    std::unique_ptr<vvl::WorkerPool> replay_workers_;
+    // Filled from the Validate phase of vkCmdBeginRenderPass too, so mutable like tag_limit_
+    mutable AttachmentViewGenCache attachment_view_gen_cache_;
+
     uint32_t debug_command_number = vvl::kU32Max;
     uint32_t debug_reset_count = 1;
     std::string debug_cmdbuf_pattern;
@@ -84,8 +96,12 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     std::shared_ptr<const QueueSyncState> GetQueueSyncStateShared(VkQueue queue) const;
     std::shared_ptr<QueueSyncState> GetQueueSyncStateShared(VkQueue queue);
     QueueId GetQueueIdLimit() const { return queue_id_limit_; }
+    // Shared by the submit time replays of all queues, null when replay runs on the submitting thread only
+    vvl::WorkerPool *GetReplayWorkers() const { return replay_workers_.get(); }
 
     QueueBatchContext::BatchSet GetQueueBatchSnapshot();
+    // Command buffer access contexts come from CollectMemoryFootprint() of the command buffer state itself
+    void CollectMemoryFootprint(vvl::MemoryFootprint &footprint) const override;
 
     template <typename Predicate>
     QueueBatchContext::ConstBatchSet GetQueueLastBatchSnapshot(Predicate &&pred) const;
@@ -101,6 +117,7 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
                                                              const vvl::CommandPool *cmd_pool) override;
     std::shared_ptr<vvl::Swapchain> CreateSwapchainState(const VkSwapchainCreateInfoKHR *create_info,
                                                          VkSwapchainKHR swapchain) final;
+    std::shared_ptr<vvl::Buffer> CreateBufferState(VkBuffer buf, const VkBufferCreateInfo *pCreateInfo) final;
     std::shared_ptr<vvl::Image> CreateImageState(VkImage img, const VkImageCreateInfo *pCreateInfo,
                                                  VkFormatFeatureFlags2KHR features) final;
 
@@ -116,6 +133,10 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
                               const VkSubpassEndInfo *pSubpassEndInfo, Func command);
     void RecordCmdEndRenderPass(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo, Func command);
     bool SupressedBoundDescriptorWAW(const HazardResult &hazard) const;
+    // Whether an error for this hazard would be reported, checked before building the costly parts of the message
+    bool IsHazardReported(const HazardResult &hazard) const {
+        return LogMsgIsEnabled(report_data, kErrorBit, string_SyncHazardVUID(hazard.Hazard()));
+    }
 
     void CreateDevice(const VkDeviceCreateInfo *pCreateInfo) override;
 
@@ -193,6 +214,7 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     void PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo,
                                           const RecordObject &record_obj) override;
+    void PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) override;
 
     void PostCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                           VkSubpassContents contents, const RecordObject &record_obj) override;
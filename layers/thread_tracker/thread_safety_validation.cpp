@@ -23,6 +23,16 @@ ReadLockGuard ThreadSafety::ReadLock() const { return ReadLockGuard(validation_o
 
 WriteLockGuard ThreadSafety::WriteLock() { return WriteLockGuard(validation_object_mutex, std::defer_lock); }
 
+std::shared_ptr<ThreadSafety::PoolCommandBuffers> ThreadSafety::GetPoolCommandBuffers(VkCommandPool command_pool) {
+    auto iter = pool_command_buffers_map.find(command_pool);
+    if (iter != pool_command_buffers_map.end()) {
+        return iter->second;
+    }
+    // Only if the pool was created before this object existed, insert won't replace one added by another thread meanwhile
+    pool_command_buffers_map.insert(command_pool, std::make_shared<PoolCommandBuffers>());
+    return pool_command_buffers_map.find(command_pool)->second;
+}
+
 void ThreadSafety::PreCallRecordAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo,
                                                        VkCommandBuffer* pCommandBuffers, const RecordObject& record_obj) {
     StartReadObjectParentInstance(device, record_obj.location);
@@ -36,12 +46,12 @@ void ThreadSafety::PostCallRecordAllocateCommandBuffers(VkDevice device, const V
 
     // Record mapping from command buffer to command pool
     if (pCommandBuffers) {
-        auto lock = WriteLockGuard(thread_safety_lock);
-        auto& pool_command_buffers = pool_command_buffers_map[pAllocateInfo->commandPool];
+        auto pool_command_buffers = GetPoolCommandBuffers(pAllocateInfo->commandPool);
+        std::lock_guard<std::mutex> lock(pool_command_buffers->lock);
         for (uint32_t index = 0; index < pAllocateInfo->commandBufferCount; index++) {
             command_pool_map.insert_or_assign(pCommandBuffers[index], pAllocateInfo->commandPool);
             CreateObject(pCommandBuffers[index]);
-            pool_command_buffers.insert(pCommandBuffers[index]);
+            pool_command_buffers->command_buffers.insert(pCommandBuffers[index]);
         }
     }
 }
@@ -351,13 +361,13 @@ void ThreadSafety::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPoo
         // so this isn't a no-op
         // The driver may immediately reuse command buffers in another thread.
         // These updates need to be done before calling down to the driver.
-        auto lock = WriteLockGuard(thread_safety_lock);
-        auto& pool_command_buffers = pool_command_buffers_map[commandPool];
+        auto pool_command_buffers = GetPoolCommandBuffers(commandPool);
+        std::lock_guard<std::mutex> lock(pool_command_buffers->lock);
         for (uint32_t index = 0; index < commandBufferCount; index++) {
             StartWriteObject(pCommandBuffers[index], record_obj.location, lockCommandPool);
             FinishWriteObject(pCommandBuffers[index], record_obj.location, lockCommandPool);
             DestroyObject(pCommandBuffers[index]);
-            pool_command_buffers.erase(pCommandBuffers[index]);
+            pool_command_buffers->command_buffers.erase(pCommandBuffers[index]);
             command_pool_map.erase(pCommandBuffers[index]);
         }
     }
@@ -382,6 +392,7 @@ void ThreadSafety::PostCallRecordCreateCommandPool(VkDevice device, const VkComm
     if (record_obj.result == VK_SUCCESS) {
         CreateObject(*pCommandPool);
         c_VkCommandPoolContents.CreateObject(*pCommandPool);
+        pool_command_buffers_map.insert(*pCommandPool, std::make_shared<PoolCommandBuffers>());
     }
 }
 
@@ -410,15 +421,16 @@ void ThreadSafety::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPoo
     c_VkCommandPoolContents.StartWrite(commandPool, record_obj.location);
     // Host access to commandPool must be externally synchronized
 
-    auto lock = WriteLockGuard(thread_safety_lock);
     // The driver may immediately reuse command buffers in another thread.
     // These updates need to be done before calling down to the driver.
     // remove references to implicitly freed command pools
-    for (auto command_buffer : pool_command_buffers_map[commandPool]) {
-        DestroyObject(command_buffer);
+    auto iter = pool_command_buffers_map.pop(commandPool);
+    if (iter != pool_command_buffers_map.end()) {
+        std::lock_guard<std::mutex> lock(iter->second->lock);
+        for (auto command_buffer : iter->second->command_buffers) {
+            DestroyObject(command_buffer);
+        }
     }
-    pool_command_buffers_map[commandPool].clear();
-    pool_command_buffers_map.erase(commandPool);
 }
 
 void ThreadSafety::PostCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
@@ -20,10 +20,12 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
+#include "containers/handle_translation_map.h"
 #include "utils/vk_layer_utils.h"
 
 VK_DEFINE_NON_DISPATCHABLE_HANDLE(DISTINCT_NONDISPATCHABLE_PHONY_HANDLE)
@@ -95,27 +97,68 @@ class alignas(kObjectUserDataAlignment) ObjectUseData {
     std::atomic<int64_t> writer_reader_count{};
 };
 
+// Owns the ObjectUseData of a counter. Lookups hand out plain pointers, so the use data of a destroyed object is kept for
+// the next created one instead of being freed, in case another thread is still (unsafely) using the old object.
+class ObjectUseDataPool {
+  public:
+    ObjectUseData *Acquire() {
+        std::lock_guard<std::mutex> guard(lock_);
+        // Still in use means its destruction raced with another thread, don't hand out the counts of that use
+        if (!free_.empty()) {
+            const ObjectUseData::WriteReadCount count = free_.back()->GetCount();
+            if (count.GetReadCount() == 0 && count.GetWriteCount() == 0) {
+                ObjectUseData *use_data = free_.back();
+                free_.pop_back();
+                return use_data;
+            }
+        }
+        all_.emplace_back(std::make_unique<ObjectUseData>());
+        return all_.back().get();
+    }
+
+    void Release(ObjectUseData *use_data) {
+        std::lock_guard<std::mutex> guard(lock_);
+        free_.emplace_back(use_data);
+    }
+
+  private:
+    std::mutex lock_;
+    std::vector<std::unique_ptr<ObjectUseData>> all_;
+    std::vector<ObjectUseData *> free_;
+};
+
 template <typename T>
 class counter {
   public:
     VulkanObjectType object_type;
     ValidationObject *object_data;
 
-    vl_concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
+    // Handle -> ObjectUseData pointer. Lookups don't take a lock, which matters as every handle parameter of every call
+    // is looked up twice. Shards only split the locks of creation and destruction, so the default count is enough.
+    vvl::HandleTranslationMap<> object_table;
+    ObjectUseDataPool use_data_pool;
 
-    void CreateObject(T object) { object_table.insert(object, std::make_shared<ObjectUseData>()); }
+    void CreateObject(T object) {
+        ObjectUseData *use_data = use_data_pool.Acquire();
+        if (!object_table.insert(CastToUint64(object), reinterpret_cast<uint64_t>(use_data))) {
+            use_data_pool.Release(use_data);
+        }
+    }
 
     void DestroyObject(T object) {
         if (object) {
-            object_table.erase(object);
+            auto iter = object_table.pop(CastToUint64(object));
+            if (iter != object_table.end()) {
+                use_data_pool.Release(reinterpret_cast<ObjectUseData *>(iter->second));
+            }
         }
     }
 
-    std::shared_ptr<ObjectUseData> FindObject(T object, const Location& loc) {
-        assert(object_table.contains(object));
-        auto iter = object_table.find(object);
+    ObjectUseData *FindObject(T object, const Location& loc) {
+        auto iter = object_table.find(CastToUint64(object));
+        assert(iter != object_table.end());
         if (iter != object_table.end()) {
-            return iter->second;
+            return reinterpret_cast<ObjectUseData *>(iter->second);
         } else {
             object_data->LogError("UNASSIGNED-Threading-Info", object, loc,
                                   "Couldn't find %s Object 0x%" PRIxLEAST64
@@ -126,7 +169,7 @@ class counter {
     }
 
     void StartWrite(T object, const Location& loc) {
-        if (object == VK_NULL_HANDLE) {
+        if (object == VK_NULL_HANDLE || !IsSampled(object)) {
             return;
         }
         auto use_data = FindObject(object, loc);
@@ -164,7 +207,7 @@ class counter {
     }
 
     void FinishWrite(T object, const Location& loc) {
-        if (object == VK_NULL_HANDLE) {
+        if (object == VK_NULL_HANDLE || !IsSampled(object)) {
             return;
         }
         auto use_data = FindObject(object, loc);
@@ -175,7 +218,7 @@ class counter {
     }
 
     void StartRead(T object, const Location& loc) {
-        if (object == VK_NULL_HANDLE) {
+        if (object == VK_NULL_HANDLE || !IsSampled(object)) {
             return;
         }
         auto use_data = FindObject(object, loc);
@@ -199,7 +242,7 @@ class counter {
     }
 
     void FinishRead(T object, const Location& loc) {
-        if (object == VK_NULL_HANDLE) {
+        if (object == VK_NULL_HANDLE || !IsSampled(object)) {
             return;
         }
         auto use_data = FindObject(object, loc);
@@ -215,6 +258,18 @@ class counter {
     }
 
   private:
+    // With thread_safety_sample_rate, which objects are tracked only depends on their handle so that the start and finish of
+    // each use agree
+    bool IsSampled(T object) const {
+        const uint32_t sample_rate = object_data->thread_safety_sample_rate;
+        if (sample_rate <= 1) {
+            return true;
+        }
+        // Fibonacci hashing, handles can be aligned pointers or sequential ids
+        const uint64_t hash = CastToUint64(object) * 0x9E3779B97F4A7C15ull;
+        return (hash >> 32) % sample_rate == 0;
+    }
+
     std::string GetErrorMessage(std::thread::id tid, std::thread::id other_tid) const {
         std::stringstream err_str;
         err_str << "THREADING ERROR : object of type " << object_string[object_type]
@@ -222,7 +277,7 @@ class counter {
         return err_str.str();
     }
 
-    void HandleErrorOnWrite(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnWrite(ObjectUseData *use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
         const std::string error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
         const bool skip =
@@ -238,7 +293,7 @@ class counter {
         }
     }
 
-    void HandleErrorOnRead(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnRead(ObjectUseData *use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
         // There is a writer of the object.
         const auto error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
@@ -262,7 +317,15 @@ class ThreadSafety : public ValidationObject {
     WriteLockGuard WriteLock() override;
 
     vl_concurrent_unordered_map<VkCommandBuffer, VkCommandPool, 6> command_pool_map;
-    vvl::unordered_map<VkCommandPool, vvl::unordered_set<VkCommandBuffer>> pool_command_buffers_map;
+
+    // The command buffers allocated from a pool, which vkDestroyCommandPool implicitly frees. Each pool has its own lock, so
+    // threads allocating and freeing command buffers from their own pools never wait on each other.
+    struct PoolCommandBuffers {
+        std::mutex lock;
+        vvl::unordered_set<VkCommandBuffer> command_buffers;
+    };
+    vl_concurrent_unordered_map<VkCommandPool, std::shared_ptr<PoolCommandBuffers>, 6> pool_command_buffers_map;
+    std::shared_ptr<PoolCommandBuffers> GetPoolCommandBuffers(VkCommandPool command_pool);
     vvl::unordered_map<VkDevice, vvl::unordered_set<VkQueue>> device_queues_map;
 
     // Track per-descriptorsetlayout and per-descriptorset whether read_only is used.
@@ -47,4 +47,6 @@ uint64_t DescriptorVariableHash(const void *info, const size_t info_size) {
     return XXH64(info, info_size, seed);
 }
 
+uint64_t Hash64(const void *data, const size_t size, const uint64_t seed) { return XXH3_64bits_withSeed(data, size, seed); }
+
 }  // namespace hash_util
\ No newline at end of file
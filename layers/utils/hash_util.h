@@ -144,6 +144,20 @@ class Dictionary {
         return *dict.insert(from_input).first;
     }
 
+    // Drops the entries that nothing but the dictionary references anymore, for dictionaries of short lived values.
+    // New references are only handed out by LookUp under the lock, so an entry seen unreferenced here stays unreferenced.
+    size_t Trim() {
+        Guard g(lock);
+        for (auto it = dict.begin(); it != dict.end();) {
+            if (it->use_count() == 1) {
+                it = dict.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return dict.size();
+    }
+
   private:
     struct HashKeyValue {
         size_t operator()(const Id &value) const { return Hasher()(*value); }
@@ -164,4 +178,7 @@ uint32_t ShaderHash(const void *pCode, const size_t codeSize);
 
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size);
 
+// 64 bit content hash (XXH3) for keys that must not collide in practice, such as persistent cache keys
+uint64_t Hash64(const void *data, const size_t size, const uint64_t seed = 0);
+
 }  // namespace hash_util
@@ -0,0 +1,403 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "layer_profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <cstdio>
+#include <utility>
+
+namespace vvl {
+
+static const char *PhaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::Validate:
+            return "validate";
+        case ProfilePhase::PreRecord:
+            return "pre-record";
+        case ProfilePhase::Dispatch:
+            return "dispatch";
+        case ProfilePhase::PostRecord:
+            return "post-record";
+        default:
+            return "unknown";
+    }
+}
+
+LayerProfiler::LayerProfiler(std::vector<std::string> object_names)
+    : object_names_(std::move(object_names)),
+      object_count_(static_cast<uint32_t>(object_names_.size())),
+      entries_(new Entry[static_cast<size_t>(kFuncCount) * object_count_ * static_cast<size_t>(ProfilePhase::Count)]),
+      start_ticks_(Now()),
+      start_time_(std::chrono::steady_clock::now()) {}
+
+double LayerProfiler::NanosecondsPerTick() const {
+#if defined(VVL_PROFILER_HAS_RDTSC)
+    const uint64_t ticks = Now() - start_ticks_;
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time_);
+    if (ticks == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(elapsed.count()) / static_cast<double>(ticks);
+#else
+    return 1.0;
+#endif
+}
+
+std::vector<LayerProfiler::ReportLine> LayerProfiler::Collect() const {
+    const double ns_per_tick = NanosecondsPerTick();
+    std::vector<ReportLine> lines;
+    for (uint32_t func_index = 0; func_index < kFuncCount; ++func_index) {
+        for (uint32_t object_slot = 0; object_slot < object_count_; ++object_slot) {
+            for (uint32_t phase = 0; phase < static_cast<uint32_t>(ProfilePhase::Count); ++phase) {
+                const Entry &entry = entries_[Index(func_index, object_slot, static_cast<ProfilePhase>(phase))];
+                const uint64_t calls = entry.calls.load(std::memory_order_relaxed);
+                if (calls == 0) {
+                    continue;
+                }
+                const double ns = static_cast<double>(entry.ticks.load(std::memory_order_relaxed)) * ns_per_tick;
+                lines.push_back({static_cast<Func>(func_index), object_slot, static_cast<ProfilePhase>(phase), calls, ns});
+            }
+        }
+    }
+    std::sort(lines.begin(), lines.end(), [](const ReportLine &a, const ReportLine &b) { return a.nanoseconds > b.nanoseconds; });
+    return lines;
+}
+
+std::string LayerProfiler::Report(uint32_t max_lines) const {
+    const auto lines = Collect();
+
+    double total_ns = 0.0;
+    std::vector<double> object_ns(object_count_, 0.0);
+    std::array<double, static_cast<size_t>(ProfilePhase::Count)> phase_ns{};
+    for (const auto &line : lines) {
+        total_ns += line.nanoseconds;
+        phase_ns[static_cast<size_t>(line.phase)] += line.nanoseconds;
+        if (line.phase != ProfilePhase::Dispatch) {
+            object_ns[line.object_slot] += line.nanoseconds;
+        }
+    }
+
+    std::string report;
+    char buffer[256];
+    const auto append = [&](const char *format, auto... args) {
+        std::snprintf(buffer, sizeof(buffer), format, args...);
+        report += buffer;
+    };
+
+    append("Layer overhead profile, %.3f ms total\n", total_ns / 1e6);
+    report += "By phase:\n";
+    for (size_t phase = 0; phase < phase_ns.size(); ++phase) {
+        append("  %-12s %12.3f ms\n", PhaseName(static_cast<ProfilePhase>(phase)), phase_ns[phase] / 1e6);
+    }
+    report += "By validation object (excluding dispatch):\n";
+    for (uint32_t object_slot = 0; object_slot < object_count_; ++object_slot) {
+        if (object_ns[object_slot] > 0.0) {
+            append("  %-24s %12.3f ms\n", object_names_[object_slot].c_str(), object_ns[object_slot] / 1e6);
+        }
+    }
+    report += "Top entries:\n";
+    append("  %12s %12s %10s  %-48s %-24s %s\n", "total ms", "calls", "avg ns", "function", "object", "phase");
+    for (size_t i = 0; i < lines.size() && i < max_lines; ++i) {
+        const auto &line = lines[i];
+        const char *object_name = line.phase == ProfilePhase::Dispatch ? "-" : object_names_[line.object_slot].c_str();
+        append("  %12.3f %12" PRIu64 " %10.0f  %-48s %-24s %s\n", line.nanoseconds / 1e6, line.calls,
+               line.nanoseconds / static_cast<double>(line.calls), String(line.func), object_name, PhaseName(line.phase));
+    }
+    return report;
+}
+
+bool LayerProfiler::AppendCsv(const std::string &path, const char *scope) const {
+    FILE *file = std::fopen(path.c_str(), "ab");
+    if (!file) {
+        return false;
+    }
+    std::fseek(file, 0, SEEK_END);
+    if (std::ftell(file) == 0) {
+        std::fputs("scope,function,object,phase,calls,nanoseconds\n", file);
+    }
+    for (const auto &line : Collect()) {
+        const char *object_name = line.phase == ProfilePhase::Dispatch ? "-" : object_names_[line.object_slot].c_str();
+        std::fprintf(file, "%s,%s,%s,%s,%" PRIu64 ",%.0f\n", scope, String(line.func), object_name, PhaseName(line.phase),
+                     line.calls, line.nanoseconds);
+    }
+    const bool ok = std::ferror(file) == 0;
+    return std::fclose(file) == 0 && ok;
+}
+
+void LayerProfiler::Reset() {
+    const size_t count = static_cast<size_t>(kFuncCount) * object_count_ * static_cast<size_t>(ProfilePhase::Count);
+    for (size_t i = 0; i < count; ++i) {
+        entries_[i].ticks.store(0, std::memory_order_relaxed);
+        entries_[i].calls.store(0, std::memory_order_relaxed);
+    }
+}
+
+const char *String(ValidationCheck check) {
+    switch (check) {
+        case ValidationCheck::ValidateActionState:
+            return "ValidateActionState";
+        case ValidationCheck::ValidateDrawState:
+            return "ValidateDrawState";
+        case ValidationCheck::DescriptorValidateBinding:
+            return "DescriptorValidator::ValidateBinding";
+        case ValidationCheck::ValidateCmdBufImageLayouts:
+            return "ValidateCmdBufImageLayouts";
+        case ValidationCheck::ValidateImageBarrier:
+            return "ValidateImageBarrier";
+        case ValidationCheck::ValidatePipelineShaderStage:
+            return "ValidatePipelineShaderStage";
+        case ValidationCheck::RunSpirvValidation:
+            return "RunSpirvValidation";
+        case ValidationCheck::SyncDetectHazard:
+            return "SyncVal DetectHazard";
+        case ValidationCheck::SyncValidateQueueSubmit:
+            return "SyncVal ValidateQueueSubmit";
+        default:
+            return "unknown";
+    }
+}
+
+CheckProfiler::CheckProfiler() : start_ticks_(LayerProfiler::Now()), start_time_(std::chrono::steady_clock::now()) {}
+
+std::vector<CheckProfiler::ReportLine> CheckProfiler::Collect() const {
+    double ns_per_tick = 1.0;
+#if defined(VVL_PROFILER_HAS_RDTSC)
+    const uint64_t ticks = LayerProfiler::Now() - start_ticks_;
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time_);
+    ns_per_tick = ticks == 0 ? 0.0 : static_cast<double>(elapsed.count()) / static_cast<double>(ticks);
+#endif
+    std::vector<ReportLine> lines;
+    for (uint32_t check = 0; check < static_cast<uint32_t>(ValidationCheck::Count); ++check) {
+        const Entry &entry = entries_[check];
+        const uint64_t calls = entry.calls.load(std::memory_order_relaxed);
+        if (calls == 0) {
+            continue;
+        }
+        const double ns = static_cast<double>(entry.ticks.load(std::memory_order_relaxed)) * ns_per_tick;
+        lines.push_back({static_cast<ValidationCheck>(check), calls, ns});
+    }
+    std::sort(lines.begin(), lines.end(), [](const ReportLine &a, const ReportLine &b) { return a.nanoseconds > b.nanoseconds; });
+    return lines;
+}
+
+std::string CheckProfiler::Report(uint32_t max_lines) const {
+    std::string report = "Validation check profile (inclusive times, checks nest)\n";
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer), "  %12s %12s %10s  %s\n", "total ms", "calls", "avg ns", "check");
+    report += buffer;
+    const auto lines = Collect();
+    for (size_t i = 0; i < lines.size() && i < max_lines; ++i) {
+        const auto &line = lines[i];
+        std::snprintf(buffer, sizeof(buffer), "  %12.3f %12" PRIu64 " %10.0f  %s\n", line.nanoseconds / 1e6, line.calls,
+                      line.nanoseconds / static_cast<double>(line.calls), String(line.check));
+        report += buffer;
+    }
+    return report;
+}
+
+void CheckProfiler::Reset() {
+    for (Entry &entry : entries_) {
+        entry.ticks.store(0, std::memory_order_relaxed);
+        entry.calls.store(0, std::memory_order_relaxed);
+    }
+}
+
+const char *String(CheckFamily family) {
+    switch (family) {
+        case CheckFamily::SyncValidation:
+            return "sync validation";
+        case CheckFamily::BestPractices:
+            return "best practices";
+        case CheckFamily::DescriptorValidation:
+            return "descriptor validation";
+        case CheckFamily::ImageLayoutValidation:
+            return "image layout validation";
+        default:
+            return "unknown";
+    }
+}
+
+static void AppendFamilies(std::string &out, uint32_t mask, const double *family_ns) {
+    char buffer[128];
+    bool first = true;
+    for (uint32_t family = 0; family < static_cast<uint32_t>(CheckFamily::Count); ++family) {
+        if ((mask & (1u << family)) == 0) {
+            continue;
+        }
+        if (family_ns) {
+            std::snprintf(buffer, sizeof(buffer), "%s%s (%.3f ms)", first ? "" : ", ", String(static_cast<CheckFamily>(family)),
+                          family_ns[family] / 1e6);
+        } else {
+            std::snprintf(buffer, sizeof(buffer), "%s%s", first ? "" : ", ", String(static_cast<CheckFamily>(family)));
+        }
+        out += buffer;
+        first = false;
+    }
+}
+
+ValidationBudget::ValidationBudget(const ValidationBudgetSettings &settings)
+    : budget_ns_(static_cast<double>(settings.frame_budget_us) * 1e3),
+      sample_period_(settings.sample_period),
+      last_ticks_(LayerProfiler::Now()),
+      last_time_(std::chrono::steady_clock::now()) {}
+
+ValidationBudget::FrameResult ValidationBudget::EndFrame() {
+    std::lock_guard<std::mutex> guard(frame_lock_);
+    const uint64_t now_ticks = LayerProfiler::Now();
+    const auto now_time = std::chrono::steady_clock::now();
+    double ns_per_tick = 1.0;
+#if defined(VVL_PROFILER_HAS_RDTSC)
+    const uint64_t ticks = now_ticks - last_ticks_;
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now_time - last_time_);
+    ns_per_tick = ticks == 0 ? 0.0 : static_cast<double>(elapsed.count()) / static_cast<double>(ticks);
+#endif
+    last_ticks_ = now_ticks;
+    last_time_ = now_time;
+    return EndFrameLocked(ns_per_tick);
+}
+
+ValidationBudget::FrameResult ValidationBudget::EndFrame(double ns_per_tick) {
+    std::lock_guard<std::mutex> guard(frame_lock_);
+    return EndFrameLocked(ns_per_tick);
+}
+
+ValidationBudget::FrameResult ValidationBudget::EndFrameLocked(double ns_per_tick) {
+    // A family comes back only once it fits in this part of the budget, or it would be shed again the next frame
+    constexpr double kRestoreFraction = 0.75;
+    constexpr uint32_t kFamilyCount = static_cast<uint32_t>(CheckFamily::Count);
+
+    FrameResult result{};
+    result.frame = frame_++;
+    result.budget_ns = budget_ns_;
+
+    const uint32_t active_shed_mask = active_shed_mask_.load(std::memory_order_relaxed);
+    const uint32_t sampled_mask = shed_mask_ & ~active_shed_mask;
+    double kept_ns = 0.0;
+    for (uint32_t family = 0; family < kFamilyCount; ++family) {
+        const uint64_t ticks = costs_[family].ticks.exchange(0, std::memory_order_relaxed);
+        result.family_ns[family] = static_cast<double>(ticks) * ns_per_tick;
+        total_ns_[family] += result.family_ns[family];
+        if (active_shed_mask & (1u << family)) {
+            ++frames_shed_[family];
+        }
+        if ((shed_mask_ & (1u << family)) == 0) {
+            kept_ns += result.family_ns[family];
+        }
+    }
+
+    if (kept_ns > budget_ns_) {
+        ++frames_over_budget_;
+        // Shed the most expensive families still running until the others fit
+        while (kept_ns > budget_ns_) {
+            uint32_t most_expensive = kFamilyCount;
+            for (uint32_t family = 0; family < kFamilyCount; ++family) {
+                if ((shed_mask_ & (1u << family)) == 0 && result.family_ns[family] > 0.0 &&
+                    (most_expensive == kFamilyCount || result.family_ns[family] > result.family_ns[most_expensive])) {
+                    most_expensive = family;
+                }
+            }
+            if (most_expensive == kFamilyCount) {
+                break;
+            }
+            shed_mask_ |= 1u << most_expensive;
+            result.newly_shed_mask |= 1u << most_expensive;
+            kept_ns -= result.family_ns[most_expensive];
+        }
+    } else {
+        // The families sampled this frame were measured, bring back the cheapest ones while they fit
+        uint32_t candidates = sampled_mask;
+        while (candidates != 0) {
+            uint32_t cheapest = kFamilyCount;
+            for (uint32_t family = 0; family < kFamilyCount; ++family) {
+                if ((candidates & (1u << family)) != 0 &&
+                    (cheapest == kFamilyCount || result.family_ns[family] < result.family_ns[cheapest])) {
+                    cheapest = family;
+                }
+            }
+            if (kept_ns + result.family_ns[cheapest] > budget_ns_ * kRestoreFraction) {
+                break;
+            }
+            candidates &= ~(1u << cheapest);
+            shed_mask_ &= ~(1u << cheapest);
+            result.restored_mask |= 1u << cheapest;
+            kept_ns += result.family_ns[cheapest];
+        }
+    }
+    result.shed_mask = shed_mask_;
+
+    // Every sample_period frames the shed families run for one frame
+    const bool sampling = sample_period_ != 0 && frame_ % sample_period_ == 0;
+    active_shed_mask_.store(sampling ? 0 : shed_mask_, std::memory_order_relaxed);
+    return result;
+}
+
+std::string ValidationBudget::FrameResult::Describe() const {
+    std::string message;
+    char buffer[128];
+    double total_ns = 0.0;
+    for (double ns : family_ns) {
+        total_ns += ns;
+    }
+    std::snprintf(buffer, sizeof(buffer), "Frame %" PRIu64 ", %.3f ms of budgeted checks for a budget of %.3f ms.", frame,
+                  total_ns / 1e6, budget_ns / 1e6);
+    message += buffer;
+    if (newly_shed_mask != 0) {
+        message += " Shedding ";
+        AppendFamilies(message, newly_shed_mask, family_ns);
+        message += ".";
+    }
+    if (restored_mask != 0) {
+        message += " Restoring ";
+        AppendFamilies(message, restored_mask, family_ns);
+        message += ".";
+    }
+    message += " Shed: ";
+    if (shed_mask != 0) {
+        AppendFamilies(message, shed_mask, nullptr);
+    } else {
+        message += "none";
+    }
+    message += ".";
+    return message;
+}
+
+std::string ValidationBudget::Report() const {
+    std::lock_guard<std::mutex> guard(frame_lock_);
+    std::string report;
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer), "Validation budget of %.3f ms per frame, %" PRIu64 " frames, %" PRIu64 " over budget\n",
+                  budget_ns_ / 1e6, frame_, frames_over_budget_);
+    report += buffer;
+    std::snprintf(buffer, sizeof(buffer), "  %12s %12s  %s\n", "total ms", "frames shed", "family");
+    report += buffer;
+    for (uint32_t family = 0; family < static_cast<uint32_t>(CheckFamily::Count); ++family) {
+        std::snprintf(buffer, sizeof(buffer), "  %12.3f %12" PRIu64 "  %s\n", total_ns_[family] / 1e6, frames_shed_[family],
+                      String(static_cast<CheckFamily>(family)));
+        report += buffer;
+    }
+    if (shed_mask_ != 0) {
+        report += "Still shed: ";
+        AppendFamilies(report, shed_mask_, nullptr);
+        report += "\n";
+    }
+    return report;
+}
+
+}  // namespace vvl
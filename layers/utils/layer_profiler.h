@@ -0,0 +1,351 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define VVL_PROFILER_HAS_RDTSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define VVL_PROFILER_HAS_RDTSC 1
+#endif
+
+#include "generated/error_location_helper.h"
+#include "utils/vk_layer_utils.h"
+
+namespace vvl {
+
+enum class ProfilePhase : uint32_t {
+    Validate = 0,
+    PreRecord,
+    Dispatch,  // time spent down the chain (next layer or driver)
+    PostRecord,
+    Count,
+};
+
+// Accumulates wall time and call counts per (vvl::Func, validation object, phase) for the khronos_validation.profile_layer
+// setting. Recording is lock free, each entry is a pair of relaxed atomics.
+//
+// Time is taken with the TSC where available and converted to nanoseconds only when a report is built.
+class LayerProfiler {
+  public:
+    // object_names is indexed by the object slot passed to Record() (the LayerObjectTypeId of the validation object)
+    explicit LayerProfiler(std::vector<std::string> object_names);
+
+    static uint64_t Now() {
+#if defined(VVL_PROFILER_HAS_RDTSC)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    void Record(Func func, uint32_t object_slot, ProfilePhase phase, uint64_t ticks) {
+        const uint32_t func_index = static_cast<uint32_t>(func);
+        if (func_index >= kFuncCount || object_slot >= object_count_) {
+            return;
+        }
+        Entry &entry = entries_[Index(func_index, object_slot, phase)];
+        entry.ticks.fetch_add(ticks, std::memory_order_relaxed);
+        entry.calls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    struct ReportLine {
+        Func func;
+        uint32_t object_slot;
+        ProfilePhase phase;
+        uint64_t calls;
+        double nanoseconds;
+    };
+    // Every non-empty entry, most expensive first
+    std::vector<ReportLine> Collect() const;
+    // Human readable summary of Collect(), limited to max_lines entries plus per-object and per-phase totals
+    std::string Report(uint32_t max_lines = 50) const;
+    // Appends every Collect() entry to a CSV file as scope,function,object,phase,calls,nanoseconds, writing the header first if
+    // the file is empty. Several runs, or the instance and device of one run, can share a file.
+    bool AppendCsv(const std::string &path, const char *scope) const;
+    void Reset();
+
+    uint32_t ObjectCount() const { return object_count_; }
+
+  private:
+    struct Entry {
+        std::atomic<uint64_t> ticks{0};
+        std::atomic<uint64_t> calls{0};
+    };
+
+    size_t Index(uint32_t func_index, uint32_t object_slot, ProfilePhase phase) const {
+        return (static_cast<size_t>(func_index) * object_count_ + object_slot) * static_cast<size_t>(ProfilePhase::Count) +
+               static_cast<size_t>(phase);
+    }
+    double NanosecondsPerTick() const;
+
+    const std::vector<std::string> object_names_;
+    const uint32_t object_count_;
+    std::unique_ptr<Entry[]> entries_;
+    // Reference points used to calibrate ticks against the steady clock
+    const uint64_t start_ticks_;
+    const std::chrono::steady_clock::time_point start_time_;
+};
+
+// The groups of checks the khronos_validation.validation_budget setting can shed, each costed by the timed checks or the
+// validation object that belong to it
+enum class CheckFamily : uint32_t {
+    SyncValidation = 0,
+    BestPractices,
+    DescriptorValidation,
+    ImageLayoutValidation,
+    Count,
+};
+const char *String(CheckFamily family);
+
+struct ValidationBudgetSettings {
+    // Layer time allowed to the check families per presented frame, 0 disables the budget
+    uint32_t frame_budget_us{0};
+    // A shed family still runs one frame in sample_period, to measure whether it fits again
+    uint32_t sample_period{60};
+};
+
+// Keeps the time spent in the check families under a per-frame budget. The time of each family is accumulated with a relaxed
+// atomic, and at every present EndFrame() sheds the most expensive families until the rest fits in the budget. A shed family
+// is skipped by its checks (IsShed() is a single relaxed load), except on sampling frames where it runs to be measured again,
+// and returns once it fits. Only checks that never prepare state for the record phase are shed, so skipping them can miss
+// errors but never causes false ones.
+class ValidationBudget {
+  public:
+    explicit ValidationBudget(const ValidationBudgetSettings &settings);
+
+    void Record(CheckFamily family, uint64_t ticks) {
+        costs_[static_cast<size_t>(family)].ticks.fetch_add(ticks, std::memory_order_relaxed);
+    }
+    bool IsShed(CheckFamily family) const {
+        return (active_shed_mask_.load(std::memory_order_relaxed) & FamilyBit(family)) != 0;
+    }
+
+    struct FrameResult {
+        uint64_t frame;
+        double budget_ns;
+        // Time of the families that ran this frame, shed ones are only measured on sampling frames
+        double family_ns[static_cast<size_t>(CheckFamily::Count)];
+        uint32_t newly_shed_mask;
+        uint32_t restored_mask;
+        uint32_t shed_mask;  // shed from the next frame on
+
+        bool Changed() const { return newly_shed_mask != 0 || restored_mask != 0; }
+        std::string Describe() const;
+    };
+    // Called at every present, attributes the time recorded since the previous call to the frame and decides which
+    // families the next frames shed
+    FrameResult EndFrame();
+    // Same with an explicit tick length, for the tests
+    FrameResult EndFrame(double ns_per_tick);
+    // Totals of the whole run
+    std::string Report() const;
+
+  private:
+    FrameResult EndFrameLocked(double ns_per_tick);
+
+    static uint32_t FamilyBit(CheckFamily family) { return (1u << static_cast<uint32_t>(family)) & kAllFamilies; }
+    static constexpr uint32_t kAllFamilies = (1u << static_cast<uint32_t>(CheckFamily::Count)) - 1;
+
+    struct alignas(get_hardware_destructive_interference_size()) Cost {
+        std::atomic<uint64_t> ticks{0};
+    };
+    Cost costs_[static_cast<size_t>(CheckFamily::Count)];
+    // What IsShed() reads, shed_mask_ without the families sampled in the current frame
+    std::atomic<uint32_t> active_shed_mask_{0};
+
+    const double budget_ns_;
+    const uint32_t sample_period_;
+
+    // Presents can come from several queues
+    mutable std::mutex frame_lock_;
+    uint32_t shed_mask_{0};
+    uint64_t frame_{0};
+    uint64_t frames_over_budget_{0};
+    uint64_t frames_shed_[static_cast<size_t>(CheckFamily::Count)] = {};
+    double total_ns_[static_cast<size_t>(CheckFamily::Count)] = {};
+    uint64_t last_ticks_;
+    std::chrono::steady_clock::time_point last_time_;
+};
+
+// Times the enclosing scope against family, a no-op with a null budget. Families nest (a queue submit of sync-val detects
+// hazards), only the outermost scope of a family on a thread is timed so nothing is counted twice.
+class BudgetScope {
+  public:
+    BudgetScope(ValidationBudget *budget, CheckFamily family)
+        : budget_(Enter(budget, family)), family_(family), start_(budget_ ? LayerProfiler::Now() : 0) {}
+    ~BudgetScope() {
+        if (budget_) {
+            budget_->Record(family_, LayerProfiler::Now() - start_);
+            active_families_ &= ~(1u << static_cast<uint32_t>(family_));
+        }
+    }
+    BudgetScope(const BudgetScope &) = delete;
+    BudgetScope &operator=(const BudgetScope &) = delete;
+
+  private:
+    static ValidationBudget *Enter(ValidationBudget *budget, CheckFamily family) {
+        if (!budget || family == CheckFamily::Count) {
+            return nullptr;
+        }
+        const uint32_t bit = 1u << static_cast<uint32_t>(family);
+        if (active_families_ & bit) {
+            return nullptr;
+        }
+        active_families_ |= bit;
+        return budget;
+    }
+
+    inline thread_local static uint32_t active_families_ = 0;
+
+    ValidationBudget *const budget_;
+    const CheckFamily family_;
+    const uint64_t start_;
+};
+
+// Times the enclosing scope, or until Stop(). A null profiler makes this a no-op, which is the
+// cost the chassis pays on every intercepted call when profiling is disabled.
+// The validation of the objects the budget sheds as a whole is also timed against their family.
+class ProfileScope {
+  public:
+    ProfileScope(LayerProfiler *profiler, Func func, uint32_t object_slot, ProfilePhase phase, ValidationBudget *budget = nullptr,
+                 CheckFamily family = CheckFamily::Count)
+        : profiler_(profiler),
+          func_(func),
+          object_slot_(object_slot),
+          phase_(phase),
+          start_(profiler ? LayerProfiler::Now() : 0),
+          budget_scope_(budget, family) {}
+    ~ProfileScope() { Stop(); }
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+    void Stop() {
+        if (profiler_) {
+            profiler_->Record(func_, object_slot_, phase_, LayerProfiler::Now() - start_);
+            profiler_ = nullptr;
+        }
+    }
+
+  private:
+    LayerProfiler *profiler_;
+    const Func func_;
+    const uint32_t object_slot_;
+    const ProfilePhase phase_;
+    const uint64_t start_;
+    BudgetScope budget_scope_;
+};
+
+// The validation functions timed by the khronos_validation.profile_validation_checks setting. Times are inclusive, the
+// checks nest (ValidateActionState contains ValidateDrawState, which contains DescriptorValidateBinding).
+enum class ValidationCheck : uint32_t {
+    ValidateActionState = 0,
+    ValidateDrawState,
+    DescriptorValidateBinding,
+    ValidateCmdBufImageLayouts,
+    ValidateImageBarrier,
+    ValidatePipelineShaderStage,
+    RunSpirvValidation,
+    SyncDetectHazard,
+    SyncValidateQueueSubmit,
+    Count,
+};
+const char *String(ValidationCheck check);
+// The family the budget counts a check in, Count for the checks it doesn't shed
+inline CheckFamily GetCheckFamily(ValidationCheck check) {
+    switch (check) {
+        case ValidationCheck::DescriptorValidateBinding:
+            return CheckFamily::DescriptorValidation;
+        case ValidationCheck::ValidateCmdBufImageLayouts:
+            return CheckFamily::ImageLayoutValidation;
+        case ValidationCheck::SyncDetectHazard:
+        case ValidationCheck::SyncValidateQueueSubmit:
+            return CheckFamily::SyncValidation;
+        default:
+            return CheckFamily::Count;
+    }
+}
+
+// Accumulates the time spent in a fixed set of the expensive validation functions, for field diagnostics of where the
+// validation time of an application goes. Owned by the device interceptor and shared with every validation object of the
+// device, recording is a pair of relaxed atomics per check.
+class CheckProfiler {
+  public:
+    CheckProfiler();
+
+    void Record(ValidationCheck check, uint64_t ticks) {
+        Entry &entry = entries_[static_cast<size_t>(check)];
+        entry.ticks.fetch_add(ticks, std::memory_order_relaxed);
+        entry.calls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    struct ReportLine {
+        ValidationCheck check;
+        uint64_t calls;
+        double nanoseconds;
+    };
+    // Every check that ran, most expensive first
+    std::vector<ReportLine> Collect() const;
+    // Human readable summary of Collect(), limited to max_lines checks
+    std::string Report(uint32_t max_lines = static_cast<uint32_t>(ValidationCheck::Count)) const;
+    void Reset();
+
+  private:
+    struct Entry {
+        std::atomic<uint64_t> ticks{0};
+        std::atomic<uint64_t> calls{0};
+    };
+
+    Entry entries_[static_cast<size_t>(ValidationCheck::Count)];
+    const uint64_t start_ticks_;
+    const std::chrono::steady_clock::time_point start_time_;
+};
+
+// Times the enclosing scope as one call of check, and against its family of the budget. A no-op with a null profiler and budget.
+class CheckScope {
+  public:
+    CheckScope(CheckProfiler *profiler, ValidationCheck check, ValidationBudget *budget = nullptr)
+        : profiler_(profiler),
+          check_(check),
+          start_(profiler ? LayerProfiler::Now() : 0),
+          budget_scope_(budget, GetCheckFamily(check)) {}
+    ~CheckScope() {
+        if (profiler_) {
+            profiler_->Record(check_, LayerProfiler::Now() - start_);
+        }
+    }
+    CheckScope(const CheckScope &) = delete;
+    CheckScope &operator=(const CheckScope &) = delete;
+
+  private:
+    CheckProfiler *const profiler_;
+    const ValidationCheck check_;
+    const uint64_t start_;
+    BudgetScope budget_scope_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,66 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "memory_footprint.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace vvl {
+
+void MemoryFootprint::Add(const char *name, size_t count, size_t bytes) {
+    auto it = std::find_if(entries_.begin(), entries_.end(), [name](const Entry &entry) { return entry.name == name; });
+    if (it != entries_.end()) {
+        it->count += count;
+        it->bytes += bytes;
+    } else {
+        entries_.push_back({name, count, bytes});
+    }
+}
+
+size_t MemoryFootprint::TotalBytes() const {
+    size_t total = 0;
+    for (const auto &entry : entries_) {
+        total += entry.bytes;
+    }
+    return total;
+}
+
+std::string MemoryFootprint::Report(const char *title) const {
+    std::vector<const Entry *> sorted;
+    sorted.reserve(entries_.size());
+    for (const auto &entry : entries_) {
+        sorted.push_back(&entry);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const Entry *a, const Entry *b) { return a->bytes > b->bytes; });
+
+    std::string report;
+    char buffer[256];
+    const auto append = [&](const char *format, auto... args) {
+        std::snprintf(buffer, sizeof(buffer), format, args...);
+        report += buffer;
+    };
+
+    append("%s memory footprint, %.1f KiB total (estimated)\n", title, static_cast<double>(TotalBytes()) / 1024.0);
+    append("  %12s %12s  %s\n", "KiB", "count", "subsystem");
+    for (const Entry *entry : sorted) {
+        append("  %12.1f %12zu  %s\n", static_cast<double>(entry->bytes) / 1024.0, entry->count, entry->name.c_str());
+    }
+    return report;
+}
+
+}  // namespace vvl
@@ -0,0 +1,90 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vvl {
+
+// Host memory held by the validation objects, grouped by subsystem, for the khronos_validation.memory_report setting.
+//
+// The numbers are estimates built from container sizes and element strides: they do not include allocator overhead or
+// memory owned by the elements themselves (such as the captures of a std::function), and are meant to show which
+// subsystem grows over a long run rather than to match the process heap exactly.
+class MemoryFootprint {
+  public:
+    // Rough bookkeeping cost of one element of a node based container (links and hash or color)
+    static constexpr size_t kNodeOverhead = 2 * sizeof(void *);
+
+    struct Entry {
+        std::string name;
+        size_t count;  // objects or container elements
+        size_t bytes;
+    };
+
+    // Entries with the same name are merged, so per-object contributions can be added one at a time
+    void Add(const char *name, size_t count, size_t bytes);
+
+    // Elements of a node based map or set holding value_type
+    template <typename Container>
+    void AddNodes(const char *name, const Container &container) {
+        Add(name, container.size(), NodeBytes<typename Container::value_type>(container.size()));
+    }
+    // Live elements and spare capacity of a vector
+    template <typename T, typename Alloc>
+    void AddVector(const char *name, const std::vector<T, Alloc> &vector) {
+        Add(name, vector.size(), vector.capacity() * sizeof(T));
+    }
+
+    template <typename T>
+    static constexpr size_t NodeBytes(size_t count) {
+        return count * (sizeof(T) + kNodeOverhead);
+    }
+
+    const std::vector<Entry> &Entries() const { return entries_; }
+    bool Empty() const { return entries_.empty(); }
+    size_t TotalBytes() const;
+    // Human readable table, largest subsystem first
+    std::string Report(const char *title) const;
+
+  private:
+    std::vector<Entry> entries_;
+};
+
+// Decides when the periodic memory report is due, an interval of 0 only reports on demand
+class MemoryReportTrigger {
+  public:
+    explicit MemoryReportTrigger(uint32_t submit_interval) : submit_interval_(submit_interval) {}
+
+    // Called once per queue submission, returns true every submit_interval submissions
+    bool CountSubmit() {
+        if (submit_interval_ == 0) {
+            return false;
+        }
+        return (submit_count_.fetch_add(1, std::memory_order_relaxed) + 1) % submit_interval_ == 0;
+    }
+
+  private:
+    const uint32_t submit_interval_;
+    std::atomic<uint64_t> submit_count_{0};
+};
+
+}  // namespace vvl
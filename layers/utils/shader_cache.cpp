@@ -0,0 +1,180 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shader_cache.h"
+
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#include "utils/hash_util.h"
+
+namespace vvl {
+
+namespace {
+
+constexpr char kMagic[8] = {'V', 'V', 'L', 'S', 'H', 'C', '0', '1'};
+
+struct FileHeader {
+    char magic[8];
+    uint64_t version_hash;
+};
+
+struct RecordHeader {
+    uint64_t key;
+    uint64_t checksum;
+    uint32_t shader_id;
+    uint32_t word_count;
+};
+
+// Seeded with the key so a record whose header and code don't belong together is rejected too
+uint64_t Checksum(uint64_t key, const uint32_t *code, size_t word_count) {
+    return hash_util::Hash64(code, word_count * sizeof(uint32_t), key);
+}
+
+bool Seek(std::FILE *file, uint64_t offset) {
+#if defined(_WIN32)
+    return _fseeki64(file, static_cast<int64_t>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+}  // namespace
+
+ShaderCache::~ShaderCache() {
+    if (file_) {
+        std::fclose(file_);
+    }
+}
+
+bool ShaderCache::Open(const std::string &path, std::string_view version) {
+    std::lock_guard<std::mutex> lock(file_lock_);
+    if (file_) {
+        return true;
+    }
+
+    FileHeader expected{};
+    std::memcpy(expected.magic, kMagic, sizeof(kMagic));
+    expected.version_hash = hash_util::Hash64(version.data(), version.size());
+
+    // Index the existing records, up to the first one that was not completely written
+    std::error_code error;
+    const uint64_t file_size = std::filesystem::exists(path, error) ? std::filesystem::file_size(path, error) : 0;
+    uint64_t valid_end = 0;
+    if (!error && file_size >= sizeof(FileHeader)) {
+        if (std::FILE *file = std::fopen(path.c_str(), "rb")) {
+            FileHeader header;
+            if (std::fread(&header, sizeof(header), 1, file) == 1 && std::memcmp(&header, &expected, sizeof(header)) == 0) {
+                valid_end = sizeof(FileHeader);
+                RecordHeader record;
+                while (Seek(file, valid_end) && std::fread(&record, sizeof(record), 1, file) == 1) {
+                    const uint64_t code_offset = valid_end + sizeof(RecordHeader);
+                    const uint64_t record_end = code_offset + uint64_t(record.word_count) * sizeof(uint32_t);
+                    if (record_end > file_size) {
+                        break;
+                    }
+                    on_disk_.insert(record.key, FileRecord{code_offset, record.checksum, record.shader_id, record.word_count});
+                    valid_end = record_end;
+                }
+            }
+            std::fclose(file);
+        }
+    }
+
+    if (valid_end == 0) {
+        // Missing, empty, from another version or not a cache file at all
+        on_disk_.clear();
+        std::FILE *file = std::fopen(path.c_str(), "wb");
+        if (!file) {
+            return false;
+        }
+        const bool written = std::fwrite(&expected, sizeof(expected), 1, file) == 1;
+        std::fclose(file);
+        if (!written) {
+            return false;
+        }
+    } else if (valid_end < file_size) {
+        // Drop the torn record left by a crash, so new records are appended right after the last complete one
+        std::filesystem::resize_file(path, valid_end, error);
+    }
+
+    file_ = std::fopen(path.c_str(), "a+b");
+    if (!file_) {
+        on_disk_.clear();
+        return false;
+    }
+    // Unbuffered, so each record reaches the file with a single write and a crash can only tear the last one
+    std::setvbuf(file_, nullptr, _IONBF, 0);
+    return true;
+}
+
+bool ShaderCache::ReadCode(const FileRecord &record, std::vector<uint32_t> &code) {
+    code.resize(record.word_count);
+    std::lock_guard<std::mutex> lock(file_lock_);
+    if (!file_ || !Seek(file_, record.code_offset)) {
+        return false;
+    }
+    return std::fread(code.data(), sizeof(uint32_t), code.size(), file_) == code.size();
+}
+
+std::shared_ptr<const ShaderCache::Shader> ShaderCache::Find(uint64_t key) {
+    auto resident = resident_.find(key);
+    if (resident != resident_.end()) {
+        return resident->second;
+    }
+    auto record = on_disk_.find(key);
+    if (record == on_disk_.end()) {
+        return nullptr;
+    }
+
+    auto shader = std::make_shared<Shader>();
+    shader->shader_id = record->second.shader_id;
+    if (!ReadCode(record->second, shader->code) ||
+        Checksum(key, shader->code.data(), shader->code.size()) != record->second.checksum) {
+        on_disk_.erase(key);
+        return nullptr;
+    }
+    // Another thread may have loaded it meanwhile, both copies are the same
+    resident_.insert(key, shader);
+    return shader;
+}
+
+void ShaderCache::Add(uint64_t key, uint32_t shader_id, const std::vector<uint32_t> &code) {
+    if (!resident_.insert(key, std::make_shared<const Shader>(Shader{shader_id, code})) || on_disk_.contains(key)) {
+        return;
+    }
+
+    const RecordHeader header{key, Checksum(key, code.data(), code.size()), shader_id, static_cast<uint32_t>(code.size())};
+    std::vector<uint8_t> record(sizeof(header) + code.size() * sizeof(uint32_t));
+    std::memcpy(record.data(), &header, sizeof(header));
+    std::memcpy(record.data() + sizeof(header), code.data(), code.size() * sizeof(uint32_t));
+
+    std::lock_guard<std::mutex> lock(file_lock_);
+    if (!file_) {
+        return;
+    }
+    // Switching from reading to writing needs a seek, the append mode then writes at the end anyway
+    std::fseek(file_, 0, SEEK_END);
+    if (std::fwrite(record.data(), record.size(), 1, file_) != 1) {
+        // Out of disk space or similar, keep going with the in memory cache only
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+}  // namespace vvl
@@ -0,0 +1,85 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils/vk_layer_utils.h"
+
+namespace vvl {
+
+// Content addressed cache of processed shader code (such as the GPU-AV instrumented shaders), optionally backed by a file.
+//
+// The file is append-only: every Add() writes one self contained record, so a crash loses at most the record being
+// written, which the next Open() cuts off. The file is meant for one process at a time, as that cut would also drop a
+// record another process is still writing. Open() only indexes the records, the code is read from the file the first
+// time it is looked up.
+//
+// Keys are 64 bit content hashes (hash_util::Hash64) of the input code, seeded with whatever else changes the output.
+class ShaderCache {
+  public:
+    struct Shader {
+        uint32_t shader_id;
+        std::vector<uint32_t> code;
+    };
+
+    ShaderCache() = default;
+    ShaderCache(const ShaderCache &) = delete;
+    ShaderCache &operator=(const ShaderCache &) = delete;
+    ~ShaderCache();
+
+    // Uses path as backing storage. A file written by a different version is started over. Returns false if the file can't
+    // be used, the cache then only lives in memory.
+    bool Open(const std::string &path, std::string_view version);
+
+    // nullptr if the key is not cached
+    std::shared_ptr<const Shader> Find(uint64_t key);
+    // Keeps the first code added for a key
+    void Add(uint64_t key, uint32_t shader_id, const std::vector<uint32_t> &code);
+
+    // Shaders in the file that were not looked up yet are not resident
+    size_t IndexedCount() const { return on_disk_.size(); }
+    // fn(uint64_t key, const Shader &), called with the lock of the map bucket holding the shader, so Add() and Find() can
+    // run meanwhile. fn must not call them itself.
+    template <typename Fn>
+    void ForEachResident(Fn &&fn) const {
+        resident_.for_each([&fn](const uint64_t &key, const std::shared_ptr<const Shader> &shader) { fn(key, *shader); });
+    }
+
+  private:
+    struct FileRecord {
+        uint64_t code_offset;
+        uint64_t checksum;
+        uint32_t shader_id;
+        uint32_t word_count;
+    };
+
+    bool ReadCode(const FileRecord &record, std::vector<uint32_t> &code);
+
+    vl_concurrent_unordered_map<uint64_t, std::shared_ptr<const Shader>> resident_;
+    vl_concurrent_unordered_map<uint64_t, FileRecord> on_disk_;
+    std::mutex file_lock_;
+    std::FILE *file_ = nullptr;  // opened for append, reads go anywhere but writes always go to the end
+};
+
+}  // namespace vvl
@@ -19,11 +19,17 @@
 
 #include "shader_utils.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <system_error>
+
 #include "state_tracker/device_state.h"
 #include "generated/state_tracker_helper.h"
 #include "generated/vk_extension_helper.h"
 #include "state_tracker/shader_module.h"
 #include "state_tracker/shader_instruction.h"
+#include "utils/hash_util.h"
 
 spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4) {
     if (api_version >= VK_API_VERSION_1_3) {
@@ -41,39 +47,79 @@ spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4) {
 }
 
 // Some Vulkan extensions/features are just all done in spirv-val behind optional settings
-void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
-                            spvtools::ValidatorOptions &options) {
+enum ValidatorOptionBits : uint32_t {
+    kRelaxBlockLayout = 1 << 0,
+    kUniformBufferStandardLayout = 1 << 1,
+    kScalarBlockLayout = 1 << 2,
+    kWorkgroupScalarBlockLayout = 1 << 3,
+    kAllowLocalSizeId = 1 << 4,
+};
+
+uint32_t ValidatorOptionsMask(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features) {
+    uint32_t mask = 0;
     // VK_KHR_relaxed_block_layout never had a feature bit so just enabling the extension allows relaxed layout
     // Was promotoed in Vulkan 1.1 so anyone using Vulkan 1.1 also gets this for free
     if (IsExtEnabled(device_extensions.vk_khr_relaxed_block_layout)) {
-        // --relax-block-layout
-        options.SetRelaxBlockLayout(true);
+        mask |= kRelaxBlockLayout;
     }
 
     // The rest of the settings are controlled from a feature bit, which are set correctly in the state tracking. Regardless of
     // Vulkan version used, the feature bit is needed (also described in the spec).
 
     if (enabled_features.uniformBufferStandardLayout == VK_TRUE) {
-        // --uniform-buffer-standard-layout
-        options.SetUniformBufferStandardLayout(true);
+        mask |= kUniformBufferStandardLayout;
     }
     if (enabled_features.scalarBlockLayout == VK_TRUE) {
-        // --scalar-block-layout
-        options.SetScalarBlockLayout(true);
+        mask |= kScalarBlockLayout;
     }
     if (enabled_features.workgroupMemoryExplicitLayoutScalarBlockLayout) {
-        // --workgroup-scalar-block-layout
-        options.SetWorkgroupScalarBlockLayout(true);
+        mask |= kWorkgroupScalarBlockLayout;
     }
     if (enabled_features.maintenance4) {
-        // --allow-localsizeid
-        options.SetAllowLocalSizeId(true);
+        mask |= kAllowLocalSizeId;
     }
+    return mask;
+}
+
+void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
+                            spvtools::ValidatorOptions &options) {
+    const uint32_t mask = ValidatorOptionsMask(device_extensions, enabled_features);
+    // --relax-block-layout
+    options.SetRelaxBlockLayout((mask & kRelaxBlockLayout) != 0);
+    // --uniform-buffer-standard-layout
+    options.SetUniformBufferStandardLayout((mask & kUniformBufferStandardLayout) != 0);
+    // --scalar-block-layout
+    options.SetScalarBlockLayout((mask & kScalarBlockLayout) != 0);
+    // --workgroup-scalar-block-layout
+    options.SetWorkgroupScalarBlockLayout((mask & kWorkgroupScalarBlockLayout) != 0);
+    // --allow-localsizeid
+    options.SetAllowLocalSizeId((mask & kAllowLocalSizeId) != 0);
 
     // Faster validation without friendly names.
     options.SetFriendlyNames(false);
 }
 
+uint64_t SpecializationCacheKey(const spirv::Module &module_state, const spirv::EntryPoint &entrypoint,
+                                const safe_VkSpecializationInfo *specialization_info, spv_target_env spirv_environment,
+                                uint32_t validator_options_mask) {
+    const uint32_t settings[] = {static_cast<uint32_t>(spirv_environment), validator_options_mask,
+                                 static_cast<uint32_t>(entrypoint.stage)};
+    uint64_t key = hash_util::Hash64(settings, sizeof(settings), module_state.static_data_.code_hash);
+    key = hash_util::Hash64(entrypoint.name.data(), entrypoint.name.size(), key);
+    if (specialization_info) {
+        // Field by field, VkSpecializationMapEntry has padding on 64 bit
+        for (uint32_t i = 0; specialization_info->pMapEntries && i < specialization_info->mapEntryCount; ++i) {
+            const VkSpecializationMapEntry &map_entry = specialization_info->pMapEntries[i];
+            const uint64_t entry[] = {map_entry.constantID, map_entry.offset, map_entry.size};
+            key = hash_util::Hash64(entry, sizeof(entry), key);
+        }
+        if (specialization_info->pData) {
+            key = hash_util::Hash64(specialization_info->pData, specialization_info->dataSize, key);
+        }
+    }
+    return key;
+}
+
 void GetActiveSlots(ActiveSlotMap &active_slots, const std::shared_ptr<const spirv::EntryPoint> &entrypoint) {
     if (!entrypoint) {
         return;
@@ -111,6 +157,26 @@ uint32_t GetMaxActiveSlot(const ActiveSlotMap &active_slots) {
     return max_active_slot;
 }
 
+ActiveSlotRequirements GetActiveSlotRequirements(const ActiveSlotMap &active_slots) {
+    ActiveSlotRequirements slot_requirements;
+    slot_requirements.reserve(active_slots.size());
+    for (const auto &slot : active_slots) {
+        BindingRequirementList bindings;
+        // The entries of a multimap with the same key are next to each other
+        for (const auto &binding_req : slot.second) {
+            if (bindings.empty() || bindings.back().first != binding_req.first) {
+                bindings.emplace_back(binding_req.first, std::vector<DescriptorRequirement>());
+            }
+            bindings.back().second.emplace_back(binding_req.second);
+        }
+        std::sort(bindings.begin(), bindings.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+        slot_requirements.emplace_back(slot.first, std::move(bindings));
+    }
+    std::sort(slot_requirements.begin(), slot_requirements.end(),
+              [](const auto &a, const auto &b) { return a.first < b.first; });
+    return slot_requirements;
+}
+
 const char *PipelineStageState::GetPName() const {
     return (pipeline_create_info) ? pipeline_create_info->pName : shader_object_create_info->pName;
 }
@@ -160,3 +226,340 @@ PipelineStageState::PipelineStageState(const safe_VkPipelineShaderStageCreateInf
       pipeline_create_info(pipeline_create_info),
       shader_object_create_info(shader_object_create_info),
       entrypoint(spirv_state ? spirv_state->FindEntrypoint(GetPName(), GetStage()) : nullptr) {}
+
+namespace {
+constexpr char kValidationCacheFileMagic[8] = {'V', 'V', 'L', 'V', 'C', 'F', '0', '1'};
+
+bool ReadAt(std::FILE *file, uint64_t offset, void *data, size_t size) {
+#if defined(_WIN32)
+    const bool seeked = _fseeki64(file, static_cast<int64_t>(offset), SEEK_SET) == 0;
+#else
+    const bool seeked = fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+    return seeked && std::fread(data, size, 1, file) == 1;
+}
+
+template <typename T>
+struct SortedRun {
+    const T *begin;
+    const T *end;
+    bool known;  // from the cache being merged into
+};
+
+// Merges runs that are each sorted by key and free of duplicates into out, keeping the first of equal keys.
+// on_new is called for the entries that no known run had.
+template <typename T, typename Key, typename OnNew>
+void MergeSortedRuns(std::vector<SortedRun<T>> &runs, Key key, std::vector<T> &out, OnNew on_new) {
+    size_t total = 0;
+    std::vector<size_t> heap;
+    for (size_t i = 0; i < runs.size(); ++i) {
+        if (runs[i].begin != runs[i].end) {
+            total += runs[i].end - runs[i].begin;
+            heap.push_back(i);
+        }
+    }
+    out.clear();
+    out.reserve(total);
+
+    const auto greater = [&runs, &key](size_t a, size_t b) { return key(*runs[a].begin) > key(*runs[b].begin); };
+    std::make_heap(heap.begin(), heap.end(), greater);
+    bool last_known = true;
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), greater);
+        SortedRun<T> &run = runs[heap.back()];
+        if (out.empty() || key(out.back()) != key(*run.begin)) {
+            if (!last_known) {
+                on_new(out.back());
+            }
+            out.push_back(*run.begin);
+            last_known = run.known;
+        } else {
+            last_known |= run.known;
+        }
+        if (++run.begin != run.end) {
+            std::push_heap(heap.begin(), heap.end(), greater);
+        } else {
+            heap.pop_back();
+        }
+    }
+    if (!last_known) {
+        on_new(out.back());
+    }
+}
+
+template <typename T, typename Key>
+void SortUnique(std::vector<T> &values, Key key) {
+    const auto less = [&key](const T &a, const T &b) { return key(a) < key(b); };
+    const auto equal = [&key](const T &a, const T &b) { return key(a) == key(b); };
+    std::stable_sort(values.begin(), values.end(), less);
+    values.erase(std::unique(values.begin(), values.end(), equal), values.end());
+}
+
+template <typename T, typename Key>
+bool IsSortedUnique(const std::vector<T> &values, Key key) {
+    return std::adjacent_find(values.begin(), values.end(),
+                              [&key](const T &a, const T &b) { return key(a) >= key(b); }) == values.end();
+}
+
+uint64_t HashKey(uint64_t hash) { return hash; }
+}  // namespace
+
+ValidationCache::~ValidationCache() {
+    if (file_) {
+        std::fclose(file_);
+    }
+}
+
+uint64_t ValidationCache::PayloadChecksum(const uint8_t *payload, size_t size) { return hash_util::Hash64(payload, size); }
+
+void ValidationCache::Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
+    if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < kHeaderSize) return;
+
+    uint8_t const *data = static_cast<uint8_t const *>(pCreateInfo->pInitialData);
+    uint32_t header[2];
+    memcpy(header, data, sizeof(header));
+    if (header[0] != kHeaderSize) return;  // also rejects the data of older versions, which had 32 bit hashes
+    if (header[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
+    uint8_t expected_uuid[VK_UUID_SIZE];
+    Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected_uuid);
+    if (memcmp(data + sizeof(header), expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
+
+    data += sizeof(header) + VK_UUID_SIZE;
+    uint32_t counts[2];
+    uint64_t checksum;
+    memcpy(counts, data, sizeof(counts));
+    memcpy(&checksum, data + sizeof(counts), sizeof(checksum));
+    const size_t hashes_size = counts[0] * sizeof(uint64_t);
+    const size_t payload_size = hashes_size + counts[1] * sizeof(SpecializationRecord);
+    if (kHeaderSize + payload_size > pCreateInfo->initialDataSize) {
+        return;
+    }
+    data += sizeof(counts) + sizeof(checksum);
+    if (PayloadChecksum(data, payload_size) != checksum) {
+        return;  // corrupted, start over rather than skip the validation of a shader that was never validated
+    }
+
+    const auto record_key = [](const SpecializationRecord &record) { return record.key; };
+    auto guard = WriteLock();
+    sorted_shader_hashes_.resize(counts[0]);
+    memcpy(sorted_shader_hashes_.data(), data, hashes_size);
+    sorted_specializations_.resize(counts[1]);
+    memcpy(sorted_specializations_.data(), data + hashes_size, payload_size - hashes_size);
+    // Data written before the arrays were kept sorted has the same header, it only has to be sorted once here
+    if (!IsSortedUnique(sorted_shader_hashes_, HashKey)) {
+        SortUnique(sorted_shader_hashes_, HashKey);
+    }
+    if (!IsSortedUnique(sorted_specializations_, record_key)) {
+        SortUnique(sorted_specializations_, record_key);
+    }
+}
+
+void ValidationCache::Write(size_t *pDataSize, void *pData) {
+    auto guard = WriteLock();
+    Compact();
+    if (!pData) {
+        *pDataSize = kHeaderSize + sorted_shader_hashes_.size() * sizeof(uint64_t) +
+                     sorted_specializations_.size() * sizeof(SpecializationRecord);
+        return;
+    }
+
+    if (*pDataSize < kHeaderSize) {
+        *pDataSize = 0;
+        return;  // Too small for even the header!
+    }
+
+    // Write the header
+    uint8_t *out = static_cast<uint8_t *>(pData);
+    const uint32_t header[2] = {kHeaderSize, VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT};
+    memcpy(out, header, sizeof(header));
+    Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, out + sizeof(header));
+    uint8_t *const payload = out + kHeaderSize;
+
+    // Keep what fits, a prefix of each array is still sorted
+    size_t available = *pDataSize - kHeaderSize;
+    uint32_t counts[2];
+    counts[0] = static_cast<uint32_t>(std::min(sorted_shader_hashes_.size(), available / sizeof(uint64_t)));
+    const size_t hashes_size = counts[0] * sizeof(uint64_t);
+    memcpy(payload, sorted_shader_hashes_.data(), hashes_size);
+    available -= hashes_size;
+    counts[1] = static_cast<uint32_t>(std::min(sorted_specializations_.size(), available / sizeof(SpecializationRecord)));
+    const size_t payload_size = hashes_size + counts[1] * sizeof(SpecializationRecord);
+    memcpy(payload + hashes_size, sorted_specializations_.data(), payload_size - hashes_size);
+
+    const uint64_t checksum = PayloadChecksum(payload, payload_size);
+    uint8_t *counts_out = out + sizeof(header) + VK_UUID_SIZE;
+    memcpy(counts_out, counts, sizeof(counts));
+    memcpy(counts_out + sizeof(counts), &checksum, sizeof(checksum));
+
+    *pDataSize = kHeaderSize + payload_size;
+}
+
+void ValidationCache::Merge(ValidationCache const *const *others, uint32_t other_count) {
+    std::vector<const ValidationCache *> sources;
+    sources.reserve(other_count);
+    for (uint32_t i = 0; i < other_count; ++i) {
+        // self-merging is invalid, but avoid deadlock below just in case. A source listed twice is only locked once.
+        if (others[i] != this && std::find(sources.begin(), sources.end(), others[i]) == sources.end()) {
+            sources.push_back(others[i]);
+        }
+    }
+    std::vector<ReadLockGuard> source_guards;
+    source_guards.reserve(sources.size());
+    for (const ValidationCache *source : sources) {
+        source_guards.emplace_back(source->ReadLock());
+    }
+    auto guard = WriteLock();
+    Compact();
+
+    // The recent insertions of the others are not sorted, they are sorted into copies here so every run is sorted
+    const auto record_key = [](const SpecializationRecord &record) { return record.key; };
+    std::vector<SortedRun<uint64_t>> hash_runs;
+    std::vector<SortedRun<SpecializationRecord>> specialization_runs;
+    std::vector<std::vector<uint64_t>> recent_hashes;
+    std::vector<std::vector<SpecializationRecord>> recent_specializations;
+    recent_hashes.reserve(sources.size());
+    recent_specializations.reserve(sources.size());
+    const auto add_runs = [&](const ValidationCache &cache, bool known) {
+        hash_runs.push_back({cache.sorted_shader_hashes_.data(),
+                             cache.sorted_shader_hashes_.data() + cache.sorted_shader_hashes_.size(), known});
+        specialization_runs.push_back({cache.sorted_specializations_.data(),
+                                       cache.sorted_specializations_.data() + cache.sorted_specializations_.size(), known});
+        if (!cache.good_shader_hashes_.empty()) {
+            auto &hashes = recent_hashes.emplace_back(cache.good_shader_hashes_.begin(), cache.good_shader_hashes_.end());
+            std::sort(hashes.begin(), hashes.end());
+            hash_runs.push_back({hashes.data(), hashes.data() + hashes.size(), known});
+        }
+        if (!cache.good_specializations_.empty()) {
+            auto &records = recent_specializations.emplace_back();
+            records.reserve(cache.good_specializations_.size());
+            for (const auto &specialization : cache.good_specializations_) {
+                records.push_back({specialization.first, specialization.second});
+            }
+            std::sort(records.begin(), records.end(),
+                      [](const SpecializationRecord &a, const SpecializationRecord &b) { return a.key < b.key; });
+            specialization_runs.push_back({records.data(), records.data() + records.size(), known});
+        }
+    };
+    add_runs(*this, true);
+    for (const ValidationCache *source : sources) {
+        add_runs(*source, false);
+    }
+
+    std::vector<uint64_t> merged_hashes;
+    MergeSortedRuns(hash_runs, HashKey, merged_hashes,
+                    [this](uint64_t hash) { AppendRecord(FileRecord{hash, {}, kShaderRecord, 0, 0}); });
+    std::vector<SpecializationRecord> merged_specializations;
+    MergeSortedRuns(specialization_runs, record_key, merged_specializations, [this](const SpecializationRecord &record) {
+        AppendRecord(FileRecord{record.key, record.result, kSpecializationRecord, 0, 0});
+    });
+    sorted_shader_hashes_ = std::move(merged_hashes);
+    sorted_specializations_ = std::move(merged_specializations);
+}
+
+const ValidationCache::SpecializationResult *ValidationCache::FindSpecialization(uint64_t key) const {
+    auto it = std::lower_bound(sorted_specializations_.begin(), sorted_specializations_.end(), key,
+                               [](const SpecializationRecord &record, uint64_t key) { return record.key < key; });
+    if (it != sorted_specializations_.end() && it->key == key) {
+        return &it->result;
+    }
+    auto recent = good_specializations_.find(key);
+    return recent != good_specializations_.end() ? &recent->second : nullptr;
+}
+
+void ValidationCache::Compact() {
+    if (!good_shader_hashes_.empty()) {
+        const auto old_end = static_cast<std::ptrdiff_t>(sorted_shader_hashes_.size());
+        sorted_shader_hashes_.insert(sorted_shader_hashes_.end(), good_shader_hashes_.begin(), good_shader_hashes_.end());
+        std::sort(sorted_shader_hashes_.begin() + old_end, sorted_shader_hashes_.end());
+        std::inplace_merge(sorted_shader_hashes_.begin(), sorted_shader_hashes_.begin() + old_end, sorted_shader_hashes_.end());
+        good_shader_hashes_.clear();
+    }
+    if (!good_specializations_.empty()) {
+        const auto less = [](const SpecializationRecord &a, const SpecializationRecord &b) { return a.key < b.key; };
+        const auto old_end = static_cast<std::ptrdiff_t>(sorted_specializations_.size());
+        for (const auto &specialization : good_specializations_) {
+            sorted_specializations_.push_back({specialization.first, specialization.second});
+        }
+        std::sort(sorted_specializations_.begin() + old_end, sorted_specializations_.end(), less);
+        std::inplace_merge(sorted_specializations_.begin(), sorted_specializations_.begin() + old_end,
+                           sorted_specializations_.end(), less);
+        good_specializations_.clear();
+    }
+}
+
+bool ValidationCache::OpenFile(const std::string &path) {
+    auto guard = WriteLock();
+    if (file_) {
+        return true;
+    }
+
+    uint8_t expected[sizeof(kValidationCacheFileMagic) + VK_UUID_SIZE];
+    memcpy(expected, kValidationCacheFileMagic, sizeof(kValidationCacheFileMagic));
+    Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected + sizeof(kValidationCacheFileMagic));
+
+    // Read the records back, up to the first one that was not completely written
+    std::error_code error;
+    const uint64_t file_size = std::filesystem::exists(path, error) ? std::filesystem::file_size(path, error) : 0;
+    uint64_t valid_end = 0;
+    if (!error && file_size >= sizeof(expected)) {
+        if (std::FILE *file = std::fopen(path.c_str(), "rb")) {
+            uint8_t header[sizeof(expected)];
+            if (ReadAt(file, 0, header, sizeof(header)) && memcmp(header, expected, sizeof(header)) == 0) {
+                valid_end = sizeof(expected);
+                FileRecord record;
+                while (ReadAt(file, valid_end, &record, sizeof(record)) &&
+                       record.checksum == hash_util::Hash64(&record, offsetof(FileRecord, checksum))) {
+                    if (record.type == kShaderRecord) {
+                        if (!ContainsShader(record.key)) {
+                            good_shader_hashes_.insert(record.key);
+                        }
+                    } else if (record.type == kSpecializationRecord) {
+                        if (!FindSpecialization(record.key)) {
+                            good_specializations_.emplace(record.key, record.result);
+                        }
+                    }
+                    valid_end += sizeof(record);
+                }
+            }
+            std::fclose(file);
+            Compact();
+        }
+    }
+
+    if (valid_end == 0) {
+        // Missing, from another version or not a cache file at all
+        std::FILE *file = std::fopen(path.c_str(), "wb");
+        if (!file) {
+            return false;
+        }
+        const bool written = std::fwrite(expected, sizeof(expected), 1, file) == 1;
+        std::fclose(file);
+        if (!written) {
+            return false;
+        }
+    } else if (valid_end < file_size) {
+        // Drop the torn record left by a crash, so new records are appended right after the last complete one
+        std::filesystem::resize_file(path, valid_end, error);
+    }
+
+    file_ = std::fopen(path.c_str(), "ab");
+    if (!file_) {
+        return false;
+    }
+    // Unbuffered, so each record reaches the file with a single write and concurrent appends don't interleave
+    std::setvbuf(file_, nullptr, _IONBF, 0);
+    return true;
+}
+
+void ValidationCache::AppendRecord(FileRecord record) {
+    if (!file_) {
+        return;
+    }
+    record.padding = 0;
+    record.checksum = hash_util::Hash64(&record, offsetof(FileRecord, checksum));
+    if (std::fwrite(&record, sizeof(record), 1, file_) != 1) {
+        // Out of disk space or similar, keep going with the in memory cache only
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
@@ -24,6 +24,11 @@
 #include "utils/vk_layer_utils.h"
 #include "generated/spirv_tools_commit_id.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
 #include <spirv/unified1/spirv.hpp>
 #include <spirv-tools/libspirv.h>
 #include <spirv-tools/optimizer.hpp>
@@ -95,6 +100,11 @@ typedef std::unordered_multimap<uint32_t, DescriptorRequirement> BindingVariable
 // Capture which slots (set#->bindings) are actually used by the shaders of this pipeline
 using ActiveSlotMap = vvl::unordered_map<uint32_t, BindingVariableMap>;
 
+// < binding index : requirements of all the variables using it >, sorted by binding index
+using BindingRequirementList = std::vector<std::pair<uint32_t, std::vector<DescriptorRequirement>>>;
+// ActiveSlotMap flattened once at creation, sorted by set#, so the draw time validation doesn't walk the multimaps
+using ActiveSlotRequirements = std::vector<std::pair<uint32_t, BindingRequirementList>>;
+
 struct safe_VkPipelineShaderStageCreateInfo;
 struct safe_VkShaderCreateInfoEXT;
 struct safe_VkSpecializationInfo;
@@ -133,90 +143,106 @@ using StageStateVec = std::vector<PipelineStageState>;
 
 class ValidationCache {
   public:
+    // What CoreChecks::ValidatePipelineShaderStage gets out of a module once its specialization constants are applied
+    struct SpecializationResult {
+        uint32_t local_size_x;
+        uint32_t local_size_y;
+        uint32_t local_size_z;
+        uint32_t workgroup_shared_memory;
+    };
+
     static VkValidationCacheEXT Create(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
         auto cache = new ValidationCache();
         cache->Load(pCreateInfo);
         return VkValidationCacheEXT(cache);
     }
 
-    void Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
-        const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
-        auto size = headerSize;
-        if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
-
-        uint32_t const *data = (uint32_t const *)pCreateInfo->pInitialData;
-        if (data[0] != size) return;
-        if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
-        uint8_t expected_uuid[VK_UUID_SIZE];
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, expected_uuid);
-        if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
-
-        data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
+    ~ValidationCache();
 
-        auto guard = WriteLock();
-        for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-            good_shader_hashes_.insert(*data);
-        }
-    }
+    // Also keeps the cache in the file at path, which is read back here and then appended to by every insertion, so nothing
+    // is lost if the process exits without destroying the device. Returns false if the file can't be used.
+    bool OpenFile(const std::string &path);
 
-    void Write(size_t *pDataSize, void *pData) {
-        const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
-        if (!pData) {
-            *pDataSize = headerSize + good_shader_hashes_.size() * sizeof(uint32_t);
-            return;
-        }
+    // The data is the header, followed by the good shader hashes and then the specialization records, whose counts and
+    // checksum are in the header. Both arrays are sorted by key and 8 byte aligned, so the data can be searched in place and
+    // loading it is a copy instead of one hash set insertion per entry.
+    void Load(VkValidationCacheCreateInfoEXT const *pCreateInfo);
 
-        if (*pDataSize < headerSize) {
-            *pDataSize = 0;
-            return;  // Too small for even the header!
-        }
+    void Write(size_t *pDataSize, void *pData);
 
-        uint32_t *out = (uint32_t *)pData;
-        size_t actualSize = headerSize;
-
-        // Write the header
-        *out++ = headerSize;
-        *out++ = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
-        Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, reinterpret_cast<uint8_t *>(out));
-        out = (uint32_t *)(reinterpret_cast<uint8_t *>(out) + VK_UUID_SIZE);
-
-        {
-            auto guard = ReadLock();
-            for (auto it = good_shader_hashes_.begin(); it != good_shader_hashes_.end() && actualSize < *pDataSize;
-                 it++, out++, actualSize += sizeof(uint32_t)) {
-                *out = *it;
-            }
-        }
+    // A single k-way merge of the sorted contents of this cache and all the others
+    void Merge(ValidationCache const *const *others, uint32_t other_count);
+    void Merge(ValidationCache const *other) { Merge(&other, 1); }
 
-        *pDataSize = actualSize;
+    // hash is hash_util::Hash64 of the module code
+    bool Contains(uint64_t hash) {
+        auto guard = ReadLock();
+        return ContainsShader(hash);
     }
 
-    void Merge(ValidationCache const *other) {
-        // self-merging is invalid, but avoid deadlock below just in case.
-        if (other == this) {
-            return;
-        }
-        auto other_guard = other->ReadLock();
+    void Insert(uint64_t hash) {
         auto guard = WriteLock();
-        good_shader_hashes_.reserve(good_shader_hashes_.size() + other->good_shader_hashes_.size());
-        for (auto h : other->good_shader_hashes_) good_shader_hashes_.insert(h);
+        if (!ContainsShader(hash)) {
+            good_shader_hashes_.insert(hash);
+            AppendRecord(FileRecord{hash, {}, kShaderRecord, 0, 0});
+        }
     }
 
-    bool Contains(uint32_t hash) {
+    // key is from SpecializationCacheKey()
+    bool FindSpecialization(uint64_t key, SpecializationResult &result) const {
         auto guard = ReadLock();
-        return good_shader_hashes_.count(hash) != 0;
+        if (const SpecializationResult *found = FindSpecialization(key)) {
+            result = *found;
+            return true;
+        }
+        return false;
     }
 
-    void Insert(uint32_t hash) {
+    void InsertSpecialization(uint64_t key, const SpecializationResult &result) {
         auto guard = WriteLock();
-        good_shader_hashes_.insert(hash);
+        if (!FindSpecialization(key)) {
+            good_specializations_.emplace(key, result);
+            AppendRecord(FileRecord{key, result, kSpecializationRecord, 0, 0});
+        }
     }
 
   private:
+    struct SpecializationRecord {
+        uint64_t key;
+        SpecializationResult result;
+    };
+    static_assert(sizeof(SpecializationRecord) % sizeof(uint32_t) == 0);
+    // 4 bytes for header size + 4 bytes for version number + UUID + 4 bytes for each of the hash and specialization counts
+    // + 8 bytes for the checksum of the rest of the data
+    static constexpr uint32_t kHeaderSize = 4 * sizeof(uint32_t) + VK_UUID_SIZE + sizeof(uint64_t);
+
+    // The file is a FileHeader followed by FileRecords, all of the same size so a record cut short by a crash is easy to drop
+    static constexpr uint32_t kShaderRecord = 1;
+    static constexpr uint32_t kSpecializationRecord = 2;
+    struct FileRecord {
+        uint64_t key;
+        SpecializationResult result;  // zero for kShaderRecord
+        uint32_t type;
+        uint32_t padding;
+        uint64_t checksum;  // of the bytes before it
+    };
+
     ValidationCache() {}
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
+    static uint64_t PayloadChecksum(const uint8_t *payload, size_t size);
+    // Both called with a lock held, they look in the sorted arrays and then in the recent insertions
+    bool ContainsShader(uint64_t hash) const {
+        return std::binary_search(sorted_shader_hashes_.begin(), sorted_shader_hashes_.end(), hash) ||
+               good_shader_hashes_.count(hash) != 0;
+    }
+    const SpecializationResult *FindSpecialization(uint64_t key) const;
+    // Called with the write lock held, moves the recent insertions into the sorted arrays
+    void Compact();
+    // Called with the write lock held, only does something once OpenFile() succeeded
+    void AppendRecord(FileRecord record);
+
     void Sha1ToVkUuid(const char *sha1_str, uint8_t *uuid) {
         // Convert sha1_str from a hex string to binary. We only need VK_UUID_SIZE bytes of
         // output, so pad with zeroes if the input string is shorter than that, and truncate
@@ -240,17 +266,32 @@ class ValidationCache {
     // we don't store negative results, as we would have to also store what was
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
-    vvl::unordered_set<uint32_t> good_shader_hashes_;
+    // Kept sorted and without duplicates, as they are written out, so loading, merging and writing are all linear.
+    std::vector<uint64_t> sorted_shader_hashes_;
+    // Same idea for the specializations of modules that passed spirv-val and spirv-opt once specialized, sorted by key
+    std::vector<SpecializationRecord> sorted_specializations_;
+    // Insertions since the last Compact(), never already in the sorted arrays
+    vvl::unordered_set<uint64_t> good_shader_hashes_;
+    vvl::unordered_map<uint64_t, SpecializationResult> good_specializations_;
     mutable std::shared_mutex lock_;
+    std::FILE *file_ = nullptr;  // opened for append by OpenFile()
 };
 
 spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4);
 
 void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
                             spvtools::ValidatorOptions &options);
+// Bit mask of the spirv-val settings AdjustValidatorOptions enables, so results cached for other settings are not used
+uint32_t ValidatorOptionsMask(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features);
+
+// Key of ValidationCache::SpecializationResult, covers everything that changes what applying the specialization does
+uint64_t SpecializationCacheKey(const spirv::Module &module_state, const spirv::EntryPoint &entrypoint,
+                                const safe_VkSpecializationInfo *specialization_info, spv_target_env spirv_environment,
+                                uint32_t validator_options_mask);
 
 void GetActiveSlots(ActiveSlotMap &active_slots, const std::shared_ptr<const spirv::EntryPoint> &entrypoint);
 ActiveSlotMap GetActiveSlots(const StageStateVec &stage_states);
 ActiveSlotMap GetActiveSlots(const std::shared_ptr<const spirv::EntryPoint> &entrypoint);
 
 uint32_t GetMaxActiveSlot(const ActiveSlotMap &active_slots);
+ActiveSlotRequirements GetActiveSlotRequirements(const ActiveSlotMap &active_slots);
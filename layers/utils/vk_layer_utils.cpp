@@ -18,7 +18,10 @@
 #include "vk_layer_utils.h"
 
 #include <string.h>
+#include <cstdlib>
+#include <iostream>
 #include <sys/stat.h>
+#include <thread>
 
 #include "vulkan/vulkan.h"
 
@@ -91,9 +94,15 @@ void layer_debug_messenger_actions(debug_report_data *report_data, const char *l
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
     std::string log_filename_key = layer_identifier;
+    std::string binary_log_filename_key = layer_identifier;
+    std::string message_ring_filename_key = layer_identifier;
+    std::string message_ring_size_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
+    binary_log_filename_key.append(".binary_log_filename");
+    message_ring_filename_key.append(".message_ring_filename");
+    message_ring_size_key.append(".message_ring_size");
 
     const vvl::unordered_map<std::string, VkFlags> debug_actions_option_definitions = {
         {std::string("VK_DBG_LAYER_ACTION_IGNORE"), VK_DBG_LAYER_ACTION_IGNORE},
@@ -101,6 +110,8 @@ void layer_debug_messenger_actions(debug_report_data *report_data, const char *l
         {std::string("VK_DBG_LAYER_ACTION_LOG_MSG"), VK_DBG_LAYER_ACTION_LOG_MSG},
         {std::string("VK_DBG_LAYER_ACTION_BREAK"), VK_DBG_LAYER_ACTION_BREAK},
         {std::string("VK_DBG_LAYER_ACTION_DEBUG_OUTPUT"), VK_DBG_LAYER_ACTION_DEBUG_OUTPUT},
+        {std::string("VK_DBG_LAYER_ACTION_LOG_BINARY"), VK_DBG_LAYER_ACTION_LOG_BINARY},
+        {std::string("VK_DBG_LAYER_ACTION_LOG_RING"), VK_DBG_LAYER_ACTION_LOG_RING},
         {std::string("VK_DBG_LAYER_ACTION_DEFAULT"), VK_DBG_LAYER_ACTION_DEFAULT}};
 
     const vvl::unordered_map<std::string, VkFlags> log_msg_type_option_definitions = {{std::string("warn"), kWarningBit},
@@ -142,6 +153,36 @@ void layer_debug_messenger_actions(debug_report_data *report_data, const char *l
         LayerCreateMessengerCallback(report_data, default_layer_callback, &dbg_create_info, &messenger);
     }
 
+    // Not a messenger: the records are written by LogMsg, before any text is formatted
+    if ((debug_action & VK_DBG_LAYER_ACTION_LOG_BINARY) && !report_data->binary_log) {
+        const char *binary_log_filename = getLayerOption(binary_log_filename_key.c_str());
+        report_data->binary_log = BinaryMessageLog::Open(binary_log_filename);
+        if (report_data->binary_log) {
+            report_data->binary_log_severities = dbg_create_info.messageSeverity;
+            report_data->binary_log_types = dbg_create_info.messageType;
+            report_data->UpdateEnabledMessageFlags();
+        } else {
+            std::cout << layer_identifier << " ERROR: Bad binary log filename specified: " << binary_log_filename << std::endl;
+        }
+    }
+
+    messenger = VK_NULL_HANDLE;
+
+    if ((debug_action & VK_DBG_LAYER_ACTION_LOG_RING) && !report_data->message_ring) {
+        const char *message_ring_filename = getLayerOption(message_ring_filename_key.c_str());
+        // In KiB
+        const size_t message_ring_size = std::strtoul(getLayerOption(message_ring_size_key.c_str()), nullptr, 10);
+        report_data->message_ring = MessageRing::Open(message_ring_filename, message_ring_size * 1024);
+        if (report_data->message_ring) {
+            dbg_create_info.pfnUserCallback = MessengerRingCallback;
+            dbg_create_info.pUserData = report_data->message_ring.get();
+            LayerCreateMessengerCallback(report_data, default_layer_callback, &dbg_create_info, &messenger);
+        } else {
+            std::cout << layer_identifier << " ERROR: Bad message ring filename or size specified: " << message_ring_filename
+                      << std::endl;
+        }
+    }
+
     messenger = VK_NULL_HANDLE;
 
     if (debug_action & VK_DBG_LAYER_ACTION_DEBUG_OUTPUT) {
@@ -193,4 +234,25 @@ std::string GetTempFilePath() {
     if (!tmp_path.size()) tmp_path = GetEnvironment("TEMP");
     if (!tmp_path.size()) tmp_path = "/tmp";
     return tmp_path;
-}
\ No newline at end of file
+}
+static std::atomic<uint32_t> &ConcurrentMapShardSetting() {
+    // Function local so maps constructed during static initialization see a valid value
+    static std::atomic<uint32_t> shard_count{0};
+    return shard_count;
+}
+
+void SetConcurrentMapShardCount(uint32_t shard_count) { ConcurrentMapShardSetting().store(shard_count, std::memory_order_relaxed); }
+
+uint32_t GetConcurrentMapShardCount() {
+    constexpr uint32_t kMaxShards = 256;
+    uint32_t requested = ConcurrentMapShardSetting().load(std::memory_order_relaxed);
+    if (requested == 0) {
+        // Twice the thread count, so threads recording in parallel rarely land on the same lock
+        requested = std::max(1u, std::thread::hardware_concurrency()) * 2;
+    }
+    uint32_t shard_count = 1;
+    while (shard_count < requested && shard_count < kMaxShards) {
+        shard_count <<= 1;
+    }
+    return shard_count;
+}
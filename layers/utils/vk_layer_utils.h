@@ -18,10 +18,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstring>
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 #include <bitset>
@@ -32,6 +35,7 @@
 #include "cast_utils.h"
 #include "generated/vk_extension_helper.h"
 #include "error_message/logging.h"
+#include "containers/epoch_reclamation.h"
 
 #ifndef WIN32
 #include <strings.h>  // For ffs()
@@ -606,6 +610,16 @@ class LockedSharedPtr : public std::shared_ptr<T> {
 // TODO use C++20 to check for std::hardware_destructive_interference_size feature support.
 constexpr std::size_t get_hardware_destructive_interference_size() { return 64; }
 
+// Shard count used for the vl_concurrent_unordered_map objects declared with BUCKETSLOG2 = kConcurrentMapSharded and
+// constructed from now on. 0 means scale with std::thread::hardware_concurrency().
+// Set from the khronos_validation.concurrent_map_shards setting.
+void SetConcurrentMapShardCount(uint32_t shard_count);
+uint32_t GetConcurrentMapShardCount();
+
+// BUCKETSLOG2 of the maps every recording thread hits (the state tracker object maps), sized by
+// GetConcurrentMapShardCount() instead of a fixed bucket count. The other maps are not worth the memory.
+constexpr int kConcurrentMapSharded = -1;
+
 // Limited concurrent_unordered_map that supports internally-synchronized
 // insert/erase/access. Splits locking across N buckets and uses shared_mutex
 // for read/write locking. Iterators are not supported. The following
@@ -630,35 +644,51 @@ constexpr std::size_t get_hardware_destructive_interference_size() { return 64;
 //
 // snapshot: Return an array of elements (key, value pairs) that satisfy an optional
 // predicate. This can be used as a substitute for iterators in exceptional cases.
+//
+// for_each/any_of: Visit the elements in place, one bucket at a time under its read lock, without copying them.
+// The visitor must not modify the map or look anything up in it (the bucket lock is not recursive).
+//
+// The bucket count is 1 << BUCKETSLOG2, or picked at construction for kConcurrentMapSharded: at least 4, raised to
+// GetConcurrentMapShardCount().
+// GetBucketStats() reports how often each bucket lock was taken and how often that had to wait, to find maps that
+// need more buckets.
 template <typename Key, typename T, int BUCKETSLOG2 = 2, typename Hash = vvl::hash<Key>>
 class vl_concurrent_unordered_map {
   public:
+    vl_concurrent_unordered_map() : bucket_count_(ChooseBucketCount()), buckets_(new Bucket[bucket_count_]) {
+        uint32_t log2 = 0;
+        while ((1u << log2) < bucket_count_) {
+            ++log2;
+        }
+        hash_shift_ = 64 - log2;
+    }
+
     template <typename... Args>
     void insert_or_assign(const Key &key, Args &&...args) {
-        uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
-        maps[h][key] = {std::forward<Args>(args)...};
+        Bucket &bucket = GetBucket(key);
+        WriteLockGuard lock = bucket.WriteLock();
+        bucket.map[key] = {std::forward<Args>(args)...};
     }
 
     template <typename... Args>
     bool insert(const Key &key, Args &&...args) {
-        uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
-        auto ret = maps[h].emplace(key, std::forward<Args>(args)...);
+        Bucket &bucket = GetBucket(key);
+        WriteLockGuard lock = bucket.WriteLock();
+        auto ret = bucket.map.emplace(key, std::forward<Args>(args)...);
         return ret.second;
     }
 
     // returns size_type
     size_t erase(const Key &key) {
-        uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
-        return maps[h].erase(key);
+        Bucket &bucket = GetBucket(key);
+        WriteLockGuard lock = bucket.WriteLock();
+        return bucket.map.erase(key);
     }
 
     bool contains(const Key &key) const {
-        uint32_t h = ConcurrentMapHashObject(key);
-        ReadLockGuard lock(locks[h].lock);
-        return maps[h].count(key) != 0;
+        const Bucket &bucket = GetBucket(key);
+        ReadLockGuard lock = bucket.ReadLock();
+        return bucket.map.count(key) != 0;
     }
 
     // type returned by find() and end().
@@ -690,11 +720,11 @@ class vl_concurrent_unordered_map {
     FindResult cend() const { return end(); }
 
     FindResult find(const Key &key) const {
-        uint32_t h = ConcurrentMapHashObject(key);
-        ReadLockGuard lock(locks[h].lock);
+        const Bucket &bucket = GetBucket(key);
+        ReadLockGuard lock = bucket.ReadLock();
 
-        auto itr = maps[h].find(key);
-        const bool found = itr != maps[h].end();
+        auto itr = bucket.map.find(key);
+        const bool found = itr != bucket.map.end();
 
         if (found) {
             return FindResult(true, itr->second);
@@ -704,15 +734,15 @@ class vl_concurrent_unordered_map {
     }
 
     FindResult pop(const Key &key) {
-        uint32_t h = ConcurrentMapHashObject(key);
-        WriteLockGuard lock(locks[h].lock);
+        Bucket &bucket = GetBucket(key);
+        WriteLockGuard lock = bucket.WriteLock();
 
-        auto itr = maps[h].find(key);
-        const bool found = itr != maps[h].end();
+        auto itr = bucket.map.find(key);
+        const bool found = itr != bucket.map.end();
 
         if (found) {
             auto ret = FindResult(true, itr->second);
-            maps[h].erase(itr);
+            bucket.map.erase(itr);
             return ret;
         } else {
             return end();
@@ -721,9 +751,9 @@ class vl_concurrent_unordered_map {
 
     std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> f = nullptr) const {
         std::vector<std::pair<const Key, T>> ret;
-        for (int h = 0; h < BUCKETS; ++h) {
-            ReadLockGuard lock(locks[h].lock);
-            for (const auto &j : maps[h]) {
+        for (uint32_t h = 0; h < bucket_count_; ++h) {
+            ReadLockGuard lock = buckets_[h].ReadLock();
+            for (const auto &j : buckets_[h].map) {
                 if (!f || f(j.second)) {
                     ret.emplace_back(j.first, j.second);
                 }
@@ -732,46 +762,198 @@ class vl_concurrent_unordered_map {
         return ret;
     }
 
+    // fn(const Key &, const T &)
+    template <typename Fn>
+    void for_each(Fn &&fn) const {
+        for (uint32_t h = 0; h < bucket_count_; ++h) {
+            ReadLockGuard lock = buckets_[h].ReadLock();
+            for (const auto &j : buckets_[h].map) {
+                fn(j.first, j.second);
+            }
+        }
+    }
+
+    // Stops at the first element for which fn(const Key &, const T &) returns true
+    template <typename Fn>
+    bool any_of(Fn &&fn) const {
+        for (uint32_t h = 0; h < bucket_count_; ++h) {
+            ReadLockGuard lock = buckets_[h].ReadLock();
+            for (const auto &j : buckets_[h].map) {
+                if (fn(j.first, j.second)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
     void clear() {
-        for (int h = 0; h < BUCKETS; ++h) {
-            WriteLockGuard lock(locks[h].lock);
-            maps[h].clear();
+        for (uint32_t h = 0; h < bucket_count_; ++h) {
+            WriteLockGuard lock = buckets_[h].WriteLock();
+            buckets_[h].map.clear();
         }
     }
 
     size_t size() const {
         size_t result = 0;
-        for (int h = 0; h < BUCKETS; ++h) {
-            ReadLockGuard lock(locks[h].lock);
-            result += maps[h].size();
+        for (uint32_t h = 0; h < bucket_count_; ++h) {
+            ReadLockGuard lock = buckets_[h].ReadLock();
+            result += buckets_[h].map.size();
         }
         return result;
     }
 
     bool empty() const {
-        bool result = 0;
-        for (int h = 0; h < BUCKETS; ++h) {
-            ReadLockGuard lock(locks[h].lock);
-            result |= maps[h].empty();
+        for (uint32_t h = 0; h < bucket_count_; ++h) {
+            ReadLockGuard lock = buckets_[h].ReadLock();
+            if (!buckets_[h].map.empty()) {
+                return false;
+            }
         }
-        return result;
+        return true;
     }
 
-  private:
-    static const int BUCKETS = (1 << BUCKETSLOG2);
-
-    vvl::unordered_map<Key, T, Hash> maps[BUCKETS];
-    struct alignas(get_hardware_destructive_interference_size()) AlignedSharedMutex {
-        std::shared_mutex lock;
+    struct BucketStats {
+        size_t size;
+        uint64_t lock_count;       // times the bucket lock was taken
+        uint64_t contended_count;  // times taking it had to wait for another thread
     };
-    mutable std::array<AlignedSharedMutex, BUCKETS> locks;
+    uint32_t bucket_count() const { return bucket_count_; }
+    std::vector<BucketStats> GetBucketStats() const {
+        std::vector<BucketStats> stats(bucket_count_);
+        for (uint32_t h = 0; h < bucket_count_; ++h) {
+            const Bucket &bucket = buckets_[h];
+            {
+                std::shared_lock<std::shared_mutex> lock(bucket.lock);
+                stats[h].size = bucket.map.size();
+            }
+            stats[h].lock_count = bucket.lock_count.load(std::memory_order_relaxed);
+            stats[h].contended_count = bucket.contended_count.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+  protected:
+    struct alignas(get_hardware_destructive_interference_size()) Bucket {
+        mutable std::shared_mutex lock;
+        vvl::unordered_map<Key, T, Hash> map;
+        // Share the cache line the lock already bounces on, so counting adds no extra transfers
+        mutable std::atomic<uint64_t> lock_count{0};
+        mutable std::atomic<uint64_t> contended_count{0};
+
+        ReadLockGuard ReadLock() const {
+            ReadLockGuard guard(lock, std::try_to_lock);
+            if (!guard.owns_lock()) {
+                contended_count.fetch_add(1, std::memory_order_relaxed);
+                guard.lock();
+            }
+            lock_count.fetch_add(1, std::memory_order_relaxed);
+            return guard;
+        }
+        WriteLockGuard WriteLock() const {
+            WriteLockGuard guard(lock, std::try_to_lock);
+            if (!guard.owns_lock()) {
+                contended_count.fetch_add(1, std::memory_order_relaxed);
+                guard.lock();
+            }
+            lock_count.fetch_add(1, std::memory_order_relaxed);
+            return guard;
+        }
+    };
+
+    static uint32_t ChooseBucketCount() {
+        if constexpr (BUCKETSLOG2 == kConcurrentMapSharded) {
+            return std::max(1u << 2, GetConcurrentMapShardCount());
+        } else {
+            return 1u << BUCKETSLOG2;
+        }
+    }
 
+    // Fibonacci hashing: handles are often sequential or share their low bits (pointer alignment),
+    // the multiply spreads every input bit into the top bits used to pick the bucket.
     uint32_t ConcurrentMapHashObject(const Key &object) const {
-        uint64_t u64 = (uint64_t)(uintptr_t)object;
-        uint32_t hash = (uint32_t)(u64 >> 32) + (uint32_t)u64;
-        hash ^= (hash >> BUCKETSLOG2) ^ (hash >> (2 * BUCKETSLOG2));
-        hash &= (BUCKETS - 1);
-        return hash;
+        if (bucket_count_ == 1) {
+            return 0;
+        }
+        const uint64_t u64 = (uint64_t)(uintptr_t)object;
+        return static_cast<uint32_t>((u64 * 0x9E3779B97F4A7C15ull) >> hash_shift_);
+    }
+    Bucket &GetBucket(const Key &key) { return buckets_[ConcurrentMapHashObject(key)]; }
+    const Bucket &GetBucket(const Key &key) const { return buckets_[ConcurrentMapHashObject(key)]; }
+
+    const uint32_t bucket_count_;
+    uint32_t hash_shift_;
+    std::unique_ptr<Bucket[]> buckets_;
+};
+
+// vl_concurrent_unordered_map of shared_ptr values that can also hand out borrowed pointers.
+//
+// find_borrowed() returns the stored pointer without copying the shared_ptr, so lookups never touch the reference count.
+// To keep those pointers valid, every value removed or replaced by erase/pop/insert_or_assign/clear is retired through
+// vvl::EpochDomain and only released once no EpochGuard that was active at removal time remains.
+template <typename Key, typename T, int BUCKETSLOG2 = 2, typename Hash = vvl::hash<Key>>
+class vl_borrowable_concurrent_unordered_map : public vl_concurrent_unordered_map<Key, T, BUCKETSLOG2, Hash> {
+    using Base = vl_concurrent_unordered_map<Key, T, BUCKETSLOG2, Hash>;
+    using typename Base::Bucket;
+    using Base::bucket_count_;
+    using Base::buckets_;
+    using Base::GetBucket;
+
+  public:
+    using element_type = typename T::element_type;
+
+    ~vl_borrowable_concurrent_unordered_map() { clear(); }
+
+    template <typename... Args>
+    void insert_or_assign(const Key &key, Args &&...args) {
+        T old;
+        {
+            Bucket &bucket = GetBucket(key);
+            WriteLockGuard lock = bucket.WriteLock();
+            auto &value = bucket.map[key];
+            old = std::move(value);
+            value = {std::forward<Args>(args)...};
+        }
+        vvl::EpochDomain::Get().Retire(std::move(old));
+    }
+
+    size_t erase(const Key &key) { return pop(key) != Base::end() ? 1 : 0; }
+
+    typename Base::FindResult pop(const Key &key) {
+        auto result = Base::pop(key);
+        if (result != Base::end()) {
+            // The caller gets its own reference, the one the map held is retired
+            vvl::EpochDomain::Get().Retire(T(result->second));
+        }
+        return result;
+    }
+
+    // The caller must hold a vvl::EpochGuard, taken before this call, for as long as it uses the returned pointer
+    element_type *find_borrowed(const Key &key) const {
+        const Bucket &bucket = GetBucket(key);
+        ReadLockGuard lock = bucket.ReadLock();
+        auto itr = bucket.map.find(key);
+        return itr != bucket.map.end() ? itr->second.get() : nullptr;
+    }
+
+    void clear() {
+        for (uint32_t h = 0; h < bucket_count_; ++h) {
+            std::vector<T> removed;
+            {
+                WriteLockGuard lock = buckets_[h].WriteLock();
+                removed.reserve(buckets_[h].map.size());
+                for (auto &entry : buckets_[h].map) {
+                    removed.emplace_back(std::move(entry.second));
+                }
+                buckets_[h].map.clear();
+            }
+            for (auto &value : removed) {
+                vvl::EpochDomain::Get().Retire(std::move(value));
+            }
+        }
+        // Callers rely on clear() destroying the values (e.g. vkDestroyDevice tearing down the state objects before the
+        // tracker itself), so wait out the readers instead of leaving them to a later reclaim.
+        vvl::EpochDomain::Get().Synchronize();
     }
 };
 
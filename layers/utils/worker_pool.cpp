@@ -0,0 +1,174 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "worker_pool.h"
+
+#include <algorithm>
+
+namespace vvl {
+
+// Beyond this the loops we split are limited by memory bandwidth rather than by threads
+static constexpr uint32_t kMaxDefaultThreads = 8;
+
+uint32_t WorkerPool::WorkerCount(uint32_t requested_threads) {
+    uint32_t threads = requested_threads;
+    if (threads == 0) {
+        threads = std::clamp(std::thread::hardware_concurrency(), 1u, kMaxDefaultThreads);
+    }
+    return threads - 1;
+}
+
+WorkerPool::WorkerPool(uint32_t worker_count) {
+    workers_.reserve(worker_count);
+    for (uint32_t i = 0; i < worker_count; ++i) {
+        workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void WorkerPool::Run(Job &job) {
+    for (size_t index = job.next.fetch_add(1); index < job.count; index = job.next.fetch_add(1)) {
+        (*job.task)(index);
+    }
+}
+
+void WorkerPool::WorkerLoop() {
+    uint64_t seen_generation = 0;
+    std::unique_lock<std::mutex> lock(lock_);
+    while (true) {
+        work_cv_.wait(lock, [&]() { return stop_ || (job_ && generation_ != seen_generation); });
+        if (stop_) {
+            return;
+        }
+        seen_generation = generation_;
+        Job *job = job_;
+        busy_++;
+        lock.unlock();
+        Run(*job);
+        lock.lock();
+        if (--busy_ == 0) {
+            done_cv_.notify_all();
+        }
+    }
+}
+
+void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)> &task) {
+    bool was_running = false;
+    if (workers_.empty() || count < 2 || !running_.compare_exchange_strong(was_running, true, std::memory_order_acquire)) {
+        for (size_t index = 0; index < count; ++index) {
+            task(index);
+        }
+        return;
+    }
+
+    Job job;
+    job.task = &task;
+    job.count = count;
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        job_ = &job;
+        generation_++;
+    }
+    work_cv_.notify_all();
+    Run(job);
+
+    // All indices are taken, keep late workers from picking up the job and wait for the ones still running it
+    {
+        std::unique_lock<std::mutex> lock(lock_);
+        job_ = nullptr;
+        done_cv_.wait(lock, [&]() { return busy_ == 0; });
+    }
+    running_.store(false, std::memory_order_release);
+}
+
+TaskQueue::TaskQueue(uint32_t thread_count) {
+    threads_.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        threads_.emplace_back([this]() { ThreadLoop(); });
+    }
+}
+
+TaskQueue::~TaskQueue() {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+    // Without threads the tasks were never run
+    for (auto &task : tasks_) {
+        task();
+    }
+}
+
+void TaskQueue::Push(std::function<void()> &&task) {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        tasks_.emplace_back(std::move(task));
+    }
+    work_cv_.notify_one();
+}
+
+void TaskQueue::Wait() {
+    std::unique_lock<std::mutex> lock(lock_);
+    if (threads_.empty()) {
+        // Nothing else would ever run them
+        while (!tasks_.empty()) {
+            std::function<void()> task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+        return;
+    }
+    idle_cv_.wait(lock, [&]() { return tasks_.empty() && running_ == 0; });
+}
+
+void TaskQueue::ThreadLoop() {
+    std::unique_lock<std::mutex> lock(lock_);
+    while (true) {
+        work_cv_.wait(lock, [&]() { return stop_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+            return;  // stopping, and everything queued is done
+        }
+        std::function<void()> task = std::move(tasks_.front());
+        tasks_.pop_front();
+        running_++;
+        lock.unlock();
+        task();
+        lock.lock();
+        running_--;
+        if (tasks_.empty() && running_ == 0) {
+            idle_cv_.notify_all();
+        }
+    }
+}
+
+}  // namespace vvl
@@ -0,0 +1,99 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+// Fixed set of threads splitting the iterations of a loop with the calling thread.
+//
+// Only one ParallelFor runs on the workers at a time. A call made while the workers are busy (for instance from another
+// queue submitting at the same time) runs its loop on the calling thread instead of waiting, so callers never block on
+// each other and nested use cannot deadlock.
+class WorkerPool {
+  public:
+    // Number of worker threads to create for a requested thread count, 0 scales with the hardware thread count.
+    // The calling thread takes part in every loop, so this is one less than the parallelism.
+    static uint32_t WorkerCount(uint32_t requested_threads);
+
+    explicit WorkerPool(uint32_t worker_count);
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+    ~WorkerPool();
+
+    // Calls task(index) for each index in [0, count), returns once all calls are done. Indices are handed out in
+    // increasing order, but may complete in any order.
+    void ParallelFor(size_t count, const std::function<void(size_t)> &task);
+
+    uint32_t Parallelism() const { return static_cast<uint32_t>(workers_.size()) + 1; }
+
+  private:
+    struct Job {
+        const std::function<void(size_t)> *task;
+        size_t count;
+        std::atomic<size_t> next{0};
+    };
+
+    static void Run(Job &job);
+    void WorkerLoop();
+
+    std::atomic<bool> running_{false};  // set for the whole of a parallel loop
+    std::mutex lock_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    Job *job_ = nullptr;
+    uint64_t generation_ = 0;
+    uint32_t busy_ = 0;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
+
+// Fixed set of threads running independent tasks in the order they were pushed, for work whose result is only needed later.
+// The destructor runs the tasks still queued before joining the threads, so nothing pushed is ever dropped.
+class TaskQueue {
+  public:
+    explicit TaskQueue(uint32_t thread_count);
+    TaskQueue(const TaskQueue &) = delete;
+    TaskQueue &operator=(const TaskQueue &) = delete;
+    ~TaskQueue();
+
+    void Push(std::function<void()> &&task);
+    // Returns once no task is queued or running, including the ones pushed by other threads while waiting
+    void Wait();
+
+  private:
+    void ThreadLoop();
+
+    std::mutex lock_;
+    std::condition_variable work_cv_;
+    std::condition_variable idle_cv_;
+    std::deque<std::function<void()>> tasks_;
+    uint32_t running_ = 0;
+    bool stop_ = false;
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace vvl
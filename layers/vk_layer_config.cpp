@@ -185,6 +185,9 @@ ConfigFile::ConfigFile() : file_is_parsed_(false) {
     value_map_["khronos_validation.debug_action"] = "VK_DBG_LAYER_ACTION_DEFAULT,VK_DBG_LAYER_ACTION_LOG_MSG";
 #endif  // WIN32
     value_map_["khronos_validation.log_filename"] = "stdout";
+    value_map_["khronos_validation.binary_log_filename"] = "vvl_messages.bin";
+    value_map_["khronos_validation.message_ring_filename"] = "vvl_messages.ring";
+    value_map_["khronos_validation.message_ring_size"] = "1024";
     value_map_["khronos_validation.fine_grained_locking"] = "true";
 }
 
@@ -60,6 +60,8 @@ enum VkLayerDbgActionBits {
     VK_DBG_LAYER_ACTION_LOG_MSG = 0x00000002,
     VK_DBG_LAYER_ACTION_BREAK = 0x00000004,
     VK_DBG_LAYER_ACTION_DEBUG_OUTPUT = 0x00000008,
+    VK_DBG_LAYER_ACTION_LOG_BINARY = 0x00000010,
+    VK_DBG_LAYER_ACTION_LOG_RING = 0x00000020,
     VK_DBG_LAYER_ACTION_DEFAULT = 0x40000000,
 };
 using VkLayerDbgActionFlags = VkFlags;
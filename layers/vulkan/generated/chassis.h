@@ -43,19 +43,29 @@
 #include "utils/cast_utils.h"
 #include "vk_layer_config.h"
 #include "containers/custom_containers.h"
+#include "containers/handle_translation_map.h"
+#include "containers/layer_data_map.h"
 #include "error_message/logging.h"
 #include "error_message/error_location.h"
 #include "error_message/record_object.h"
 #include "vk_object_types.h"
 #include "utils/vk_layer_extension_utils.h"
 #include "utils/vk_layer_utils.h"
+#include "utils/layer_profiler.h"
+#include "utils/memory_footprint.h"
 #include "vk_dispatch_table_helper.h"
 #include "vk_extension_helper.h"
 #include "vk_safe_struct.h"
 #include "gpu_validation/gpu_settings.h"
+#include "sync/sync_settings.h"
 
 extern std::atomic<uint64_t> global_unique_id;
 
+// Shard count (log2) of the unique id -> driver handle table. Each shard has its own writer lock; lookups are lock-free.
+#ifndef VVL_UNIQUE_ID_MAPPING_SHARDS_LOG2
+#define VVL_UNIQUE_ID_MAPPING_SHARDS_LOG2 4
+#endif
+
 // To avoid re-hashing unique ids on each use, we precompute the hash and store the
 // hash's LSBs in the high 24 bits.
 struct HashedUint64 {
@@ -69,7 +79,7 @@ struct HashedUint64 {
     }
 };
 
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern vvl::HandleTranslationMap<VVL_UNIQUE_ID_MAPPING_SHARDS_LOG2> unique_id_mapping;
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char* funcName);
 
@@ -2217,6 +2227,18 @@ typedef enum EnableFlags {
     vendor_specific_nvidia,
     debug_printf_validation,
     sync_validation,
+    batch_draw_validation,
+    async_submit_validation,
+    layer_profiling,
+    memory_report,
+    async_shader_validation,
+    shared_queue_retirement,
+    create_info_cache,
+    async_message_delivery,
+    async_error_messages,
+    best_practices_frame_summary,
+    check_profiling,
+    deferred_state_destruction,
     // Insert new enables above this line
     kMaxEnableFlags,
 } EnableFlags;
@@ -2252,6 +2274,11 @@ class ValidationObject {
     CHECK_ENABLED enabled = {};
     bool fine_grained_locking{true};
     GpuAVSettings gpuav_settings = {};
+    SyncValSettings syncval_settings = {};
+    // Thread safety only tracks 1 in thread_safety_sample_rate objects
+    uint32_t thread_safety_sample_rate{1};
+    // Submit time validation is only done on the queues of these families, on every queue when empty
+    std::vector<uint32_t> validated_queue_families;
 
     VkInstance instance = VK_NULL_HANDLE;
     VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -2279,6 +2306,56 @@ class ValidationObject {
     virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
     virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
 
+    // Set when ReadLock()/WriteLock() never acquire validation_object_mutex (the object synchronizes its own state).
+    // The chassis then skips the virtual lock call and the guard entirely on every intercepted entry point.
+    bool internally_synchronized{false};
+    void CacheLockingMode() { internally_synchronized = !ReadLock().owns_lock(); }
+    ReadLockGuard DispatchReadLock() const { return internally_synchronized ? ReadLockGuard() : ReadLock(); }
+    WriteLockGuard DispatchWriteLock() { return internally_synchronized ? WriteLockGuard() : WriteLock(); }
+
+    // Only created on the instance and device interceptors when khronos_validation.profile_layer is enabled
+    std::unique_ptr<vvl::LayerProfiler> profiler;
+    // The reports of the profiler are also appended there as CSV, see khronos_validation.profile_layer_file
+    std::string profile_layer_file;
+    // Times one phase of an intercepted call, intercept is null for the Dispatch phase. The validation of an object with a
+    // budget_family is also timed against it.
+    vvl::ProfileScope Profile(vvl::ProfilePhase phase, vvl::Func func, const ValidationObject* intercept = nullptr) const {
+        const uint32_t object_slot = intercept ? static_cast<uint32_t>(intercept->container_type) : 0u;
+        if (intercept && phase == vvl::ProfilePhase::Validate) {
+            return vvl::ProfileScope(profiler.get(), func, object_slot, phase, intercept->validation_budget.get(),
+                                     intercept->budget_family);
+        }
+        return vvl::ProfileScope(profiler.get(), func, object_slot, phase);
+    }
+
+    // Only created when khronos_validation.profile_validation_checks is enabled, shared by the objects of a device
+    std::shared_ptr<vvl::CheckProfiler> check_profiler;
+    vvl::CheckScope ProfileCheck(vvl::ValidationCheck check) const {
+        return vvl::CheckScope(check_profiler.get(), check, validation_budget.get());
+    }
+
+    // Set on the instance interceptor from khronos_validation.validation_budget
+    vvl::ValidationBudgetSettings validation_budget_settings;
+    // Only created when khronos_validation.validation_budget is set, shared by the objects of a device
+    std::shared_ptr<vvl::ValidationBudget> validation_budget;
+    // The family all of the validation of this object is shed as, for the objects whose validation never prepares state for
+    // their record phase. The chassis then skips the object while its family is shed.
+    vvl::CheckFamily budget_family{vvl::CheckFamily::Count};
+    bool IsCheckShed(vvl::CheckFamily family) const { return validation_budget && validation_budget->IsShed(family); }
+
+    bool IsQueueFamilyValidated(uint32_t queue_family_index) const {
+        if (validated_queue_families.empty()) return true;
+        return std::find(validated_queue_families.begin(), validated_queue_families.end(), queue_family_index) !=
+               validated_queue_families.end();
+    }
+
+    // Only created on the device interceptor when khronos_validation.memory_report is enabled
+    std::unique_ptr<vvl::MemoryReportTrigger> memory_report_trigger;
+    // Queue submissions between periodic memory reports, set on the instance interceptor
+    uint32_t memory_report_interval{0};
+    // Adds the host memory held by this validation object, called with its read lock held
+    virtual void CollectMemoryFootprint(vvl::MemoryFootprint& footprint) const {}
+
     // If the Record phase calls a function that blocks, we might need to release
     // the lock that protects Record itself in order to avoid mutual waiting.
     static thread_local WriteLockGuard* record_guard;
@@ -4601,15 +4678,36 @@ class ValidationObject {
             PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj);
         };
 
+        // Allow modification of the down-chain submits and fence for QueueSubmit/QueueSubmit2
+        virtual void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PostCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+        };
+
         // Modify a parameter to CreateDevice
         virtual void PreCallRecordCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, const RecordObject& record_obj, void *modified_create_info) {
             PreCallRecordCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice, record_obj);
         };
 
+        // Whether the value is a core token of the enum or one added by an extension enabled on the device
         template <typename T>
-        std::vector<T> ValidParamValues() const;
+        bool IsValidEnumValue(T value) const;
 };
 // clang-format on
-extern small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
+extern vvl::LayerDataMap<ValidationObject> layer_data_map;
 #include "valid_enum_values.h"
 // NOLINTEND
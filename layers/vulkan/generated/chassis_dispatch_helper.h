@@ -36,9 +36,6 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateGetDeviceQueue,
     InterceptIdPreCallRecordGetDeviceQueue,
     InterceptIdPostCallRecordGetDeviceQueue,
-    InterceptIdPreCallValidateQueueSubmit,
-    InterceptIdPreCallRecordQueueSubmit,
-    InterceptIdPostCallRecordQueueSubmit,
     InterceptIdPreCallValidateQueueWaitIdle,
     InterceptIdPreCallRecordQueueWaitIdle,
     InterceptIdPostCallRecordQueueWaitIdle,
@@ -486,9 +483,6 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateCmdWriteTimestamp2,
     InterceptIdPreCallRecordCmdWriteTimestamp2,
     InterceptIdPostCallRecordCmdWriteTimestamp2,
-    InterceptIdPreCallValidateQueueSubmit2,
-    InterceptIdPreCallRecordQueueSubmit2,
-    InterceptIdPostCallRecordQueueSubmit2,
     InterceptIdPreCallValidateCmdCopyBuffer2,
     InterceptIdPreCallRecordCmdCopyBuffer2,
     InterceptIdPostCallRecordCmdCopyBuffer2,
@@ -822,9 +816,6 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateCmdWriteTimestamp2KHR,
     InterceptIdPreCallRecordCmdWriteTimestamp2KHR,
     InterceptIdPostCallRecordCmdWriteTimestamp2KHR,
-    InterceptIdPreCallValidateQueueSubmit2KHR,
-    InterceptIdPreCallRecordQueueSubmit2KHR,
-    InterceptIdPostCallRecordQueueSubmit2KHR,
     InterceptIdPreCallValidateCmdWriteBufferMarker2AMD,
     InterceptIdPreCallRecordCmdWriteBufferMarker2AMD,
     InterceptIdPostCallRecordCmdWriteBufferMarker2AMD,
@@ -1762,9 +1753,6 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSubmit);
-    BUILD_DISPATCH_VECTOR(PreCallRecordQueueSubmit);
-    BUILD_DISPATCH_VECTOR(PostCallRecordQueueSubmit);
     BUILD_DISPATCH_VECTOR(PreCallValidateQueueWaitIdle);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueWaitIdle);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueWaitIdle);
@@ -2212,9 +2200,6 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteTimestamp2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteTimestamp2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteTimestamp2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSubmit2);
-    BUILD_DISPATCH_VECTOR(PreCallRecordQueueSubmit2);
-    BUILD_DISPATCH_VECTOR(PostCallRecordQueueSubmit2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBuffer2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBuffer2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBuffer2);
@@ -2554,9 +2539,6 @@ void ValidationObject::InitObjectDispatchVectors() {
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteTimestamp2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteTimestamp2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteTimestamp2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSubmit2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallRecordQueueSubmit2KHR);
-    BUILD_DISPATCH_VECTOR(PostCallRecordQueueSubmit2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteBufferMarker2AMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteBufferMarker2AMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteBufferMarker2AMD);
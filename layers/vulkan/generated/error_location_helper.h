@@ -707,6 +707,9 @@ enum class Func {
     vkWriteMicromapsPropertiesEXT = 677,
 };
 
+// Number of Func values, including Empty
+static constexpr uint32_t kFuncCount = 678;
+
 enum class Struct {
     Empty = 0,
     VkAabbPositionsKHR,
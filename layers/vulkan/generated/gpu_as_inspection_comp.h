@@ -25,82 +25,85 @@
 ****************************************************************************/
 
 // To view SPIR-V, copy contents of array and paste in https://www.khronos.org/spir/visualizer/
-static const uint32_t gpu_as_inspection_comp[769] = {
-    0x07230203, 0x00010000, 0x0008000b, 0x0000006d, 0x00000000, 0x00020011, 0x00000001, 0x0006000b, 0x00000001, 0x4c534c47,
-    0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001, 0x0005000f, 0x00000005, 0x00000004, 0x6e69616d,
-    0x00000000, 0x00060010, 0x00000004, 0x00000011, 0x00000001, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2,
-    0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365, 0x00006576,
-    0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000004,
-    0x6e69616d, 0x00000000, 0x00060005, 0x00000008, 0x74736e69, 0x65636e61, 0x646e695f, 0x00007865, 0x00070005, 0x00000011,
-    0x696c6156, 0x69746164, 0x75426e6f, 0x72656666, 0x00000000, 0x00090006, 0x00000011, 0x00000000, 0x74736e69, 0x65636e61,
-    0x6f745f73, 0x6c61765f, 0x74616469, 0x00000065, 0x000a0006, 0x00000011, 0x00000001, 0x6c706572, 0x6d656361, 0x5f746e65,
-    0x646e6168, 0x625f656c, 0x5f737469, 0x00000030, 0x000a0006, 0x00000011, 0x00000002, 0x6c706572, 0x6d656361, 0x5f746e65,
-    0x646e6168, 0x625f656c, 0x5f737469, 0x00000031, 0x00090006, 0x00000011, 0x00000003, 0x61766e69, 0x5f64696c, 0x646e6168,
-    0x665f656c, 0x646e756f, 0x00000000, 0x00090006, 0x00000011, 0x00000004, 0x61766e69, 0x5f64696c, 0x646e6168, 0x625f656c,
-    0x5f737469, 0x00000030, 0x00090006, 0x00000011, 0x00000005, 0x61766e69, 0x5f64696c, 0x646e6168, 0x625f656c, 0x5f737469,
-    0x00000031, 0x00080006, 0x00000011, 0x00000006, 0x696c6176, 0x61685f64, 0x656c646e, 0x6f635f73, 0x00746e75, 0x00070006,
-    0x00000011, 0x00000007, 0x696c6176, 0x61685f64, 0x656c646e, 0x00000073, 0x00030005, 0x00000013, 0x00000000, 0x00080005,
-    0x0000001e, 0x65476b56, 0x74656d6f, 0x6e497972, 0x6e617473, 0x564e6563, 0x00000000, 0x00050006, 0x0000001e, 0x00000000,
-    0x73756e75, 0x00006465, 0x00070006, 0x0000001e, 0x00000001, 0x646e6168, 0x625f656c, 0x5f737469, 0x00000030, 0x00070006,
-    0x0000001e, 0x00000002, 0x646e6168, 0x625f656c, 0x5f737469, 0x00000031, 0x00060005, 0x00000020, 0x74736e49, 0x65636e61,
-    0x66667542, 0x00007265, 0x00060006, 0x00000020, 0x00000000, 0x74736e69, 0x65636e61, 0x00000073, 0x00030005, 0x00000022,
-    0x00000000, 0x00040005, 0x0000002d, 0x696c6176, 0x00000064, 0x00070005, 0x0000002f, 0x696c6176, 0x61685f64, 0x656c646e,
-    0x646e695f, 0x00007865, 0x00040047, 0x00000010, 0x00000006, 0x00000004, 0x00050048, 0x00000011, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x00000011, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000011, 0x00000002, 0x00000023,
-    0x00000008, 0x00050048, 0x00000011, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000011, 0x00000004, 0x00000023,
-    0x00000010, 0x00050048, 0x00000011, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000011, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000011, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000011, 0x00000003, 0x00040047,
-    0x00000013, 0x00000022, 0x00000000, 0x00040047, 0x00000013, 0x00000021, 0x00000001, 0x00040047, 0x0000001d, 0x00000006,
-    0x00000004, 0x00050048, 0x0000001e, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000001e, 0x00000001, 0x00000023,
-    0x00000038, 0x00050048, 0x0000001e, 0x00000002, 0x00000023, 0x0000003c, 0x00040047, 0x0000001f, 0x00000006, 0x00000040,
-    0x00050048, 0x00000020, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000020, 0x00000003, 0x00040047, 0x00000022,
-    0x00000022, 0x00000000, 0x00040047, 0x00000022, 0x00000021, 0x00000000, 0x00020013, 0x00000002, 0x00030021, 0x00000003,
-    0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x0004002b,
-    0x00000006, 0x00000009, 0x00000000, 0x0003001d, 0x00000010, 0x00000006, 0x000a001e, 0x00000011, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000010, 0x00040020, 0x00000012, 0x00000002, 0x00000011,
-    0x0004003b, 0x00000012, 0x00000013, 0x00000002, 0x00040015, 0x00000014, 0x00000020, 0x00000001, 0x0004002b, 0x00000014,
-    0x00000015, 0x00000000, 0x00040020, 0x00000016, 0x00000002, 0x00000006, 0x00020014, 0x00000019, 0x0004002b, 0x00000006,
-    0x0000001c, 0x0000000e, 0x0004001c, 0x0000001d, 0x00000006, 0x0000001c, 0x0005001e, 0x0000001e, 0x0000001d, 0x00000006,
-    0x00000006, 0x0003001d, 0x0000001f, 0x0000001e, 0x0003001e, 0x00000020, 0x0000001f, 0x00040020, 0x00000021, 0x00000002,
-    0x00000020, 0x0004003b, 0x00000021, 0x00000022, 0x00000002, 0x0004002b, 0x00000014, 0x00000024, 0x00000001, 0x0004002b,
-    0x00000014, 0x00000029, 0x00000002, 0x00040020, 0x0000002c, 0x00000007, 0x00000019, 0x0003002a, 0x00000019, 0x0000002e,
-    0x0004002b, 0x00000014, 0x00000036, 0x00000006, 0x0004002b, 0x00000014, 0x0000003b, 0x00000007, 0x0004002b, 0x00000006,
-    0x0000003c, 0x00000002, 0x0004002b, 0x00000006, 0x00000048, 0x00000001, 0x00030029, 0x00000019, 0x00000050, 0x0004002b,
-    0x00000014, 0x00000058, 0x00000003, 0x0004002b, 0x00000014, 0x0000005d, 0x00000004, 0x0004002b, 0x00000014, 0x00000060,
-    0x00000005, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x00000007,
-    0x00000008, 0x00000007, 0x0004003b, 0x0000002c, 0x0000002d, 0x00000007, 0x0004003b, 0x00000007, 0x0000002f, 0x00000007,
-    0x0003003e, 0x00000008, 0x00000009, 0x000200f9, 0x0000000a, 0x000200f8, 0x0000000a, 0x000400f6, 0x0000000c, 0x0000000d,
-    0x00000000, 0x000200f9, 0x0000000e, 0x000200f8, 0x0000000e, 0x0004003d, 0x00000006, 0x0000000f, 0x00000008, 0x00050041,
-    0x00000016, 0x00000017, 0x00000013, 0x00000015, 0x0004003d, 0x00000006, 0x00000018, 0x00000017, 0x000500b0, 0x00000019,
-    0x0000001a, 0x0000000f, 0x00000018, 0x000400fa, 0x0000001a, 0x0000000b, 0x0000000c, 0x000200f8, 0x0000000b, 0x0004003d,
-    0x00000006, 0x00000023, 0x00000008, 0x00070041, 0x00000016, 0x00000025, 0x00000022, 0x00000015, 0x00000023, 0x00000024,
-    0x0004003d, 0x00000006, 0x00000026, 0x00000025, 0x00070041, 0x00000016, 0x0000002a, 0x00000022, 0x00000015, 0x00000023,
-    0x00000029, 0x0004003d, 0x00000006, 0x0000002b, 0x0000002a, 0x0003003e, 0x0000002d, 0x0000002e, 0x0003003e, 0x0000002f,
-    0x00000009, 0x000200f9, 0x00000030, 0x000200f8, 0x00000030, 0x000400f6, 0x00000032, 0x00000033, 0x00000000, 0x000200f9,
-    0x00000034, 0x000200f8, 0x00000034, 0x0004003d, 0x00000006, 0x00000035, 0x0000002f, 0x00050041, 0x00000016, 0x00000037,
-    0x00000013, 0x00000036, 0x0004003d, 0x00000006, 0x00000038, 0x00000037, 0x000500b0, 0x00000019, 0x00000039, 0x00000035,
-    0x00000038, 0x000400fa, 0x00000039, 0x00000031, 0x00000032, 0x000200f8, 0x00000031, 0x0004003d, 0x00000006, 0x0000003d,
-    0x0000002f, 0x00050084, 0x00000006, 0x0000003e, 0x0000003c, 0x0000003d, 0x00060041, 0x00000016, 0x00000040, 0x00000013,
-    0x0000003b, 0x0000003e, 0x0004003d, 0x00000006, 0x00000041, 0x00000040, 0x000500aa, 0x00000019, 0x00000042, 0x00000026,
-    0x00000041, 0x000300f7, 0x00000044, 0x00000000, 0x000400fa, 0x00000042, 0x00000043, 0x00000044, 0x000200f8, 0x00000043,
-    0x0004003d, 0x00000006, 0x00000046, 0x0000002f, 0x00050084, 0x00000006, 0x00000047, 0x0000003c, 0x00000046, 0x00050080,
-    0x00000006, 0x00000049, 0x00000047, 0x00000048, 0x00060041, 0x00000016, 0x0000004a, 0x00000013, 0x0000003b, 0x00000049,
-    0x0004003d, 0x00000006, 0x0000004b, 0x0000004a, 0x000500aa, 0x00000019, 0x0000004c, 0x0000002b, 0x0000004b, 0x000200f9,
-    0x00000044, 0x000200f8, 0x00000044, 0x000700f5, 0x00000019, 0x0000004d, 0x00000042, 0x00000031, 0x0000004c, 0x00000043,
-    0x000300f7, 0x0000004f, 0x00000000, 0x000400fa, 0x0000004d, 0x0000004e, 0x0000004f, 0x000200f8, 0x0000004e, 0x0003003e,
-    0x0000002d, 0x00000050, 0x000200f9, 0x00000032, 0x000200f8, 0x0000004f, 0x000200f9, 0x00000033, 0x000200f8, 0x00000033,
-    0x0004003d, 0x00000006, 0x00000052, 0x0000002f, 0x00050080, 0x00000006, 0x00000053, 0x00000052, 0x00000024, 0x0003003e,
-    0x0000002f, 0x00000053, 0x000200f9, 0x00000030, 0x000200f8, 0x00000032, 0x0004003d, 0x00000019, 0x00000054, 0x0000002d,
-    0x000400a8, 0x00000019, 0x00000055, 0x00000054, 0x000300f7, 0x00000057, 0x00000000, 0x000400fa, 0x00000055, 0x00000056,
-    0x00000057, 0x000200f8, 0x00000056, 0x00050041, 0x00000016, 0x00000059, 0x00000013, 0x00000058, 0x0004003d, 0x00000006,
-    0x0000005a, 0x00000059, 0x00050080, 0x00000006, 0x0000005b, 0x0000005a, 0x00000048, 0x00050041, 0x00000016, 0x0000005c,
-    0x00000013, 0x00000058, 0x0003003e, 0x0000005c, 0x0000005b, 0x00050041, 0x00000016, 0x0000005f, 0x00000013, 0x0000005d,
-    0x0003003e, 0x0000005f, 0x00000026, 0x00050041, 0x00000016, 0x00000062, 0x00000013, 0x00000060, 0x0003003e, 0x00000062,
-    0x0000002b, 0x0004003d, 0x00000006, 0x00000063, 0x00000008, 0x00050041, 0x00000016, 0x00000064, 0x00000013, 0x00000024,
-    0x0004003d, 0x00000006, 0x00000065, 0x00000064, 0x00070041, 0x00000016, 0x00000066, 0x00000022, 0x00000015, 0x00000063,
-    0x00000024, 0x0003003e, 0x00000066, 0x00000065, 0x00050041, 0x00000016, 0x00000068, 0x00000013, 0x00000029, 0x0004003d,
-    0x00000006, 0x00000069, 0x00000068, 0x00070041, 0x00000016, 0x0000006a, 0x00000022, 0x00000015, 0x00000063, 0x00000029,
-    0x0003003e, 0x0000006a, 0x00000069, 0x000200f9, 0x00000057, 0x000200f8, 0x00000057, 0x000200f9, 0x0000000d, 0x000200f8,
-    0x0000000d, 0x0004003d, 0x00000006, 0x0000006b, 0x00000008, 0x00050080, 0x00000006, 0x0000006c, 0x0000006b, 0x00000024,
-    0x0003003e, 0x00000008, 0x0000006c, 0x000200f9, 0x0000000a, 0x000200f8, 0x0000000c, 0x000100fd, 0x00010038,
+static const uint32_t gpu_as_inspection_comp[796] = {
+    0x07230203, 0x00010000, 0x0008000b, 0x0000006a, 0x00000000, 0x00020011, 0x00000001, 0x0006000b, 0x00000001, 0x4c534c47,
+    0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f, 0x00000005, 0x00000002, 0x6e69616d,
+    0x00000000, 0x00000003, 0x00060010, 0x00000002, 0x00000011, 0x00000040, 0x00000001, 0x00000001, 0x00030003, 0x00000002,
+    0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
+    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572, 0x00657669, 0x00040005,
+    0x00000002, 0x6e69616d, 0x00000000, 0x00080005, 0x00000003, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69,
+    0x00000044, 0x00070005, 0x00000004, 0x696c6156, 0x69746164, 0x75426e6f, 0x72656666, 0x00000000, 0x00090006, 0x00000004,
+    0x00000000, 0x74736e69, 0x65636e61, 0x6f745f73, 0x6c61765f, 0x74616469, 0x00000065, 0x000a0006, 0x00000004, 0x00000001,
+    0x6c706572, 0x6d656361, 0x5f746e65, 0x646e6168, 0x625f656c, 0x5f737469, 0x00000030, 0x000a0006, 0x00000004, 0x00000002,
+    0x6c706572, 0x6d656361, 0x5f746e65, 0x646e6168, 0x625f656c, 0x5f737469, 0x00000031, 0x00090006, 0x00000004, 0x00000003,
+    0x61766e69, 0x5f64696c, 0x646e6168, 0x665f656c, 0x646e756f, 0x00000000, 0x00090006, 0x00000004, 0x00000004, 0x61766e69,
+    0x5f64696c, 0x646e6168, 0x625f656c, 0x5f737469, 0x00000030, 0x00090006, 0x00000004, 0x00000005, 0x61766e69, 0x5f64696c,
+    0x646e6168, 0x625f656c, 0x5f737469, 0x00000031, 0x00080006, 0x00000004, 0x00000006, 0x696c6176, 0x61685f64, 0x656c646e,
+    0x6f635f73, 0x00746e75, 0x00070006, 0x00000004, 0x00000007, 0x696c6176, 0x61685f64, 0x656c646e, 0x00000073, 0x00030005,
+    0x00000005, 0x00000000, 0x00080005, 0x00000006, 0x65476b56, 0x74656d6f, 0x6e497972, 0x6e617473, 0x564e6563, 0x00000000,
+    0x00050006, 0x00000006, 0x00000000, 0x73756e75, 0x00006465, 0x00070006, 0x00000006, 0x00000001, 0x646e6168, 0x625f656c,
+    0x5f737469, 0x00000030, 0x00070006, 0x00000006, 0x00000002, 0x646e6168, 0x625f656c, 0x5f737469, 0x00000031, 0x00060005,
+    0x00000007, 0x74736e49, 0x65636e61, 0x66667542, 0x00007265, 0x00060006, 0x00000007, 0x00000000, 0x74736e69, 0x65636e61,
+    0x00000073, 0x00030005, 0x00000008, 0x00000000, 0x00040047, 0x00000003, 0x0000000b, 0x0000001c, 0x00050048, 0x00000004,
+    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000004, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000004,
+    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000004, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000004,
+    0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000004, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000004,
+    0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000004, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000004,
+    0x00000003, 0x00040047, 0x00000005, 0x00000022, 0x00000000, 0x00040047, 0x00000005, 0x00000021, 0x00000001, 0x00040047,
+    0x00000009, 0x00000006, 0x00000004, 0x00050048, 0x00000006, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000006,
+    0x00000001, 0x00000023, 0x00000038, 0x00050048, 0x00000006, 0x00000002, 0x00000023, 0x0000003c, 0x00040047, 0x0000000a,
+    0x00000006, 0x00000040, 0x00050048, 0x00000007, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000007, 0x00000003,
+    0x00040047, 0x00000008, 0x00000022, 0x00000000, 0x00040047, 0x00000008, 0x00000021, 0x00000000, 0x00040047, 0x0000000b,
+    0x00000006, 0x00000004, 0x00020013, 0x0000000c, 0x00030021, 0x0000000d, 0x0000000c, 0x00040015, 0x0000000e, 0x00000020,
+    0x00000000, 0x00040015, 0x0000000f, 0x00000020, 0x00000001, 0x00020014, 0x00000010, 0x00040017, 0x00000011, 0x0000000e,
+    0x00000003, 0x00040020, 0x00000012, 0x00000001, 0x00000011, 0x0004003b, 0x00000012, 0x00000003, 0x00000001, 0x00040020,
+    0x00000013, 0x00000001, 0x0000000e, 0x0003001d, 0x0000000b, 0x0000000e, 0x000a001e, 0x00000004, 0x0000000e, 0x0000000e,
+    0x0000000e, 0x0000000e, 0x0000000e, 0x0000000e, 0x0000000e, 0x0000000b, 0x00040020, 0x00000014, 0x00000002, 0x00000004,
+    0x0004003b, 0x00000014, 0x00000005, 0x00000002, 0x00040020, 0x00000015, 0x00000002, 0x0000000e, 0x0004002b, 0x0000000e,
+    0x00000016, 0x00000000, 0x0004002b, 0x0000000e, 0x00000017, 0x00000001, 0x0004002b, 0x0000000e, 0x00000018, 0x00000002,
+    0x0004002b, 0x0000000e, 0x00000019, 0x0000000e, 0x0004002b, 0x0000000e, 0x0000001a, 0x003fffc0, 0x0004002b, 0x0000000f,
+    0x0000001b, 0x00000000, 0x0004002b, 0x0000000f, 0x0000001c, 0x00000001, 0x0004002b, 0x0000000f, 0x0000001d, 0x00000002,
+    0x0004002b, 0x0000000f, 0x0000001e, 0x00000003, 0x0004002b, 0x0000000f, 0x0000001f, 0x00000004, 0x0004002b, 0x0000000f,
+    0x00000020, 0x00000005, 0x0004002b, 0x0000000f, 0x00000021, 0x00000006, 0x0004002b, 0x0000000f, 0x00000022, 0x00000007,
+    0x0004001c, 0x00000009, 0x0000000e, 0x00000019, 0x0005001e, 0x00000006, 0x00000009, 0x0000000e, 0x0000000e, 0x0003001d,
+    0x0000000a, 0x00000006, 0x0003001e, 0x00000007, 0x0000000a, 0x00040020, 0x00000023, 0x00000002, 0x00000007, 0x0004003b,
+    0x00000023, 0x00000008, 0x00000002, 0x0003002a, 0x00000010, 0x00000024, 0x00050036, 0x0000000c, 0x00000002, 0x00000000,
+    0x0000000d, 0x000200f8, 0x00000025, 0x00050041, 0x00000013, 0x00000026, 0x00000003, 0x00000016, 0x0004003d, 0x0000000e,
+    0x00000027, 0x00000026, 0x00050041, 0x00000013, 0x00000028, 0x00000003, 0x00000017, 0x0004003d, 0x0000000e, 0x00000029,
+    0x00000028, 0x00050084, 0x0000000e, 0x0000002a, 0x00000029, 0x0000001a, 0x00050080, 0x0000000e, 0x0000002b, 0x00000027,
+    0x0000002a, 0x00050041, 0x00000015, 0x0000002c, 0x00000005, 0x0000001b, 0x0004003d, 0x0000000e, 0x0000002d, 0x0000002c,
+    0x000500b0, 0x00000010, 0x0000002e, 0x0000002b, 0x0000002d, 0x000300f7, 0x0000002f, 0x00000000, 0x000400fa, 0x0000002e,
+    0x00000030, 0x0000002f, 0x000200f8, 0x00000030, 0x00070041, 0x00000015, 0x00000031, 0x00000008, 0x0000001b, 0x0000002b,
+    0x0000001c, 0x0004003d, 0x0000000e, 0x00000032, 0x00000031, 0x00070041, 0x00000015, 0x00000033, 0x00000008, 0x0000001b,
+    0x0000002b, 0x0000001d, 0x0004003d, 0x0000000e, 0x00000034, 0x00000033, 0x00050041, 0x00000015, 0x00000035, 0x00000005,
+    0x00000021, 0x0004003d, 0x0000000e, 0x00000036, 0x00000035, 0x000200f9, 0x00000037, 0x000200f8, 0x00000037, 0x000700f5,
+    0x0000000e, 0x00000038, 0x00000016, 0x00000030, 0x00000039, 0x0000003a, 0x000700f5, 0x0000000e, 0x0000003b, 0x00000036,
+    0x00000030, 0x0000003c, 0x0000003a, 0x000400f6, 0x0000003d, 0x0000003a, 0x00000000, 0x000200f9, 0x0000003e, 0x000200f8,
+    0x0000003e, 0x000500b0, 0x00000010, 0x0000003f, 0x00000038, 0x0000003b, 0x000400fa, 0x0000003f, 0x00000040, 0x0000003d,
+    0x000200f8, 0x00000040, 0x00050082, 0x0000000e, 0x00000041, 0x0000003b, 0x00000038, 0x000500c2, 0x0000000e, 0x00000042,
+    0x00000041, 0x00000017, 0x00050080, 0x0000000e, 0x00000043, 0x00000038, 0x00000042, 0x00050084, 0x0000000e, 0x00000044,
+    0x00000043, 0x00000018, 0x00050080, 0x0000000e, 0x00000045, 0x00000044, 0x00000017, 0x00060041, 0x00000015, 0x00000046,
+    0x00000005, 0x00000022, 0x00000044, 0x0004003d, 0x0000000e, 0x00000047, 0x00000046, 0x00060041, 0x00000015, 0x00000048,
+    0x00000005, 0x00000022, 0x00000045, 0x0004003d, 0x0000000e, 0x00000049, 0x00000048, 0x000500b0, 0x00000010, 0x0000004a,
+    0x00000049, 0x00000034, 0x000500aa, 0x00000010, 0x0000004b, 0x00000049, 0x00000034, 0x000500b0, 0x00000010, 0x0000004c,
+    0x00000047, 0x00000032, 0x000500a7, 0x00000010, 0x0000004d, 0x0000004b, 0x0000004c, 0x000500a6, 0x00000010, 0x0000004e,
+    0x0000004a, 0x0000004d, 0x00050080, 0x0000000e, 0x0000004f, 0x00000043, 0x00000017, 0x000600a9, 0x0000000e, 0x00000039,
+    0x0000004e, 0x0000004f, 0x00000038, 0x000600a9, 0x0000000e, 0x0000003c, 0x0000004e, 0x0000003b, 0x00000043, 0x000200f9,
+    0x0000003a, 0x000200f8, 0x0000003a, 0x000200f9, 0x00000037, 0x000200f8, 0x0000003d, 0x000500b0, 0x00000010, 0x00000050,
+    0x00000038, 0x00000036, 0x000300f7, 0x00000051, 0x00000000, 0x000400fa, 0x00000050, 0x00000052, 0x00000051, 0x000200f8,
+    0x00000052, 0x00050084, 0x0000000e, 0x00000053, 0x00000038, 0x00000018, 0x00050080, 0x0000000e, 0x00000054, 0x00000053,
+    0x00000017, 0x00060041, 0x00000015, 0x00000055, 0x00000005, 0x00000022, 0x00000053, 0x0004003d, 0x0000000e, 0x00000056,
+    0x00000055, 0x00060041, 0x00000015, 0x00000057, 0x00000005, 0x00000022, 0x00000054, 0x0004003d, 0x0000000e, 0x00000058,
+    0x00000057, 0x000500aa, 0x00000010, 0x00000059, 0x00000056, 0x00000032, 0x000500aa, 0x00000010, 0x0000005a, 0x00000058,
+    0x00000034, 0x000500a7, 0x00000010, 0x0000005b, 0x00000059, 0x0000005a, 0x000200f9, 0x00000051, 0x000200f8, 0x00000051,
+    0x000700f5, 0x00000010, 0x0000005c, 0x00000024, 0x0000003d, 0x0000005b, 0x00000052, 0x000300f7, 0x0000005d, 0x00000000,
+    0x000400fa, 0x0000005c, 0x0000005d, 0x0000005e, 0x000200f8, 0x0000005e, 0x00050041, 0x00000015, 0x0000005f, 0x00000005,
+    0x0000001e, 0x000700ea, 0x0000000e, 0x00000060, 0x0000005f, 0x00000017, 0x00000016, 0x00000017, 0x000500aa, 0x00000010,
+    0x00000061, 0x00000060, 0x00000016, 0x000300f7, 0x00000062, 0x00000000, 0x000400fa, 0x00000061, 0x00000063, 0x00000062,
+    0x000200f8, 0x00000063, 0x00050041, 0x00000015, 0x00000064, 0x00000005, 0x0000001f, 0x0003003e, 0x00000064, 0x00000032,
+    0x00050041, 0x00000015, 0x00000065, 0x00000005, 0x00000020, 0x0003003e, 0x00000065, 0x00000034, 0x000200f9, 0x00000062,
+    0x000200f8, 0x00000062, 0x00050041, 0x00000015, 0x00000066, 0x00000005, 0x0000001c, 0x0004003d, 0x0000000e, 0x00000067,
+    0x00000066, 0x0003003e, 0x00000031, 0x00000067, 0x00050041, 0x00000015, 0x00000068, 0x00000005, 0x0000001d, 0x0004003d,
+    0x0000000e, 0x00000069, 0x00000068, 0x0003003e, 0x00000033, 0x00000069, 0x000200f9, 0x0000005d, 0x000200f8, 0x0000005d,
+    0x000200f9, 0x0000002f, 0x000200f8, 0x0000002f, 0x000100fd, 0x00010038,
 };
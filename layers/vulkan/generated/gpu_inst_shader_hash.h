@@ -24,4 +24,4 @@
 
 #pragma once
 
-#define INST_SHADER_GIT_HASH "852961e040752174ee3f6858f2ce10219cb71399"
+#define INST_SHADER_GIT_HASH "17e5283a84b5095d9f8201f00ea4d0e7aebd092f"
@@ -25,191 +25,135 @@
 ****************************************************************************/
 
 // To view SPIR-V, copy contents of array and paste in https://www.khronos.org/spir/visualizer/
-static const uint32_t gpu_pre_draw_vert[1855] = {
-    0x07230203, 0x00010000, 0x0008000b, 0x0000012b, 0x00000000, 0x00020011, 0x00000001, 0x0006000b, 0x00000001, 0x4c534c47,
-    0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f, 0x00000000, 0x00000004, 0x6e69616d,
-    0x00000000, 0x00000040, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70,
+static const uint32_t gpu_pre_draw_vert[1291] = {
+    0x07230203, 0x00010000, 0x0008000b, 0x000000b5, 0x00000000, 0x00020011, 0x00000001, 0x0006000b, 0x00000001, 0x4c534c47,
+    0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f, 0x00000000, 0x00000002, 0x6e69616d,
+    0x00000000, 0x00000003, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70,
     0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63,
-    0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00090005, 0x0000000d, 0x61757067,
-    0x676f4c76, 0x6f727245, 0x31752872, 0x3b31753b, 0x753b3175, 0x00003b31, 0x00050005, 0x00000009, 0x69746361, 0x635f6e6f,
-    0x0065646f, 0x00040005, 0x0000000a, 0x6f727265, 0x00000072, 0x00040005, 0x0000000b, 0x6e756f63, 0x00000074, 0x00050005,
-    0x0000000c, 0x77617264, 0x6d756e5f, 0x00726562, 0x00060005, 0x00000011, 0x7074754f, 0x75427475, 0x72656666, 0x00000000,
-    0x00050006, 0x00000011, 0x00000000, 0x67616c66, 0x00000073, 0x00080006, 0x00000011, 0x00000001, 0x7074756f, 0x625f7475,
-    0x65666675, 0x6f635f72, 0x00746e75, 0x00070006, 0x00000011, 0x00000002, 0x7074756f, 0x625f7475, 0x65666675, 0x00000072,
-    0x00030005, 0x00000013, 0x00000000, 0x00060005, 0x00000040, 0x565f6c67, 0x65747265, 0x646e4978, 0x00007865, 0x00050005,
-    0x00000046, 0x66696e55, 0x496d726f, 0x006f666e, 0x00090006, 0x00000046, 0x00000000, 0x68737570, 0x6e6f635f, 0x6e617473,
-    0x6f775f74, 0x305f6472, 0x00000000, 0x00090006, 0x00000046, 0x00000001, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74,
-    0x315f6472, 0x00000000, 0x00090006, 0x00000046, 0x00000002, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x325f6472,
-    0x00000000, 0x00090006, 0x00000046, 0x00000003, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x335f6472, 0x00000000,
-    0x00090006, 0x00000046, 0x00000004, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x345f6472, 0x00000000, 0x00090006,
-    0x00000046, 0x00000005, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x355f6472, 0x00000000, 0x00090006, 0x00000046,
-    0x00000006, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x365f6472, 0x00000000, 0x00090006, 0x00000046, 0x00000007,
-    0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x375f6472, 0x00000000, 0x00090006, 0x00000046, 0x00000008, 0x68737570,
-    0x6e6f635f, 0x6e617473, 0x6f775f74, 0x385f6472, 0x00000000, 0x00090006, 0x00000046, 0x00000009, 0x68737570, 0x6e6f635f,
-    0x6e617473, 0x6f775f74, 0x395f6472, 0x00000000, 0x00090006, 0x00000046, 0x0000000a, 0x68737570, 0x6e6f635f, 0x6e617473,
-    0x6f775f74, 0x315f6472, 0x00000030, 0x00040005, 0x00000048, 0x6e695f75, 0x00006f66, 0x00050005, 0x00000058, 0x6e756f43,
-    0x66754274, 0x00726566, 0x00070006, 0x00000058, 0x00000000, 0x6e756f63, 0x75625f74, 0x72656666, 0x00000000, 0x00030005,
-    0x0000005a, 0x00000000, 0x00040005, 0x00000067, 0x61726170, 0x0000006d, 0x00040005, 0x00000068, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000069, 0x61726170, 0x0000006d, 0x00040005, 0x0000006b, 0x61726170, 0x0000006d, 0x00040005, 0x00000074,
-    0x61726170, 0x0000006d, 0x00040005, 0x00000075, 0x61726170, 0x0000006d, 0x00040005, 0x00000076, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000078, 0x61726170, 0x0000006d, 0x00050005, 0x00000080, 0x695f6966, 0x7865646e, 0x00000000, 0x00030005,
-    0x00000083, 0x00000069, 0x00050005, 0x0000008e, 0x77617244, 0x66667542, 0x00007265, 0x00070006, 0x0000008e, 0x00000000,
-    0x77617264, 0x75625f73, 0x72656666, 0x00000000, 0x00030005, 0x00000090, 0x00000000, 0x00040005, 0x00000097, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000098, 0x61726170, 0x0000006d, 0x00040005, 0x00000099, 0x61726170, 0x0000006d, 0x00040005,
-    0x0000009b, 0x61726170, 0x0000006d, 0x00070005, 0x000000b1, 0x77617264, 0x6675625f, 0x5f726566, 0x65646e69, 0x00000078,
-    0x00080005, 0x000000be, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x315f6472, 0x00000000, 0x00030005, 0x000000c7,
-    0x00000069, 0x00040005, 0x000000e5, 0x61726170, 0x0000006d, 0x00040005, 0x000000e6, 0x61726170, 0x0000006d, 0x00040005,
-    0x000000e7, 0x61726170, 0x0000006d, 0x00040005, 0x000000e9, 0x61726170, 0x0000006d, 0x00040005, 0x000000f3, 0x61726170,
-    0x0000006d, 0x00040005, 0x000000f4, 0x61726170, 0x0000006d, 0x00040005, 0x000000f5, 0x61726170, 0x0000006d, 0x00040005,
-    0x000000f7, 0x61726170, 0x0000006d, 0x00040005, 0x00000102, 0x61726170, 0x0000006d, 0x00040005, 0x00000103, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000104, 0x61726170, 0x0000006d, 0x00040005, 0x00000106, 0x61726170, 0x0000006d, 0x00040005,
-    0x00000116, 0x61726170, 0x0000006d, 0x00040005, 0x00000117, 0x61726170, 0x0000006d, 0x00040005, 0x00000118, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000011a, 0x61726170, 0x0000006d, 0x00040047, 0x00000010, 0x00000006, 0x00000004, 0x00050048,
-    0x00000011, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000011, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x00000011, 0x00000002, 0x00000023, 0x00000008, 0x00030047, 0x00000011, 0x00000003, 0x00040047, 0x00000013, 0x00000022,
-    0x00000000, 0x00040047, 0x00000013, 0x00000021, 0x00000000, 0x00040047, 0x00000040, 0x0000000b, 0x0000002a, 0x00050048,
-    0x00000046, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000046, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x00000046, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000046, 0x00000003, 0x00000023, 0x0000000c, 0x00050048,
-    0x00000046, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000046, 0x00000005, 0x00000023, 0x00000014, 0x00050048,
-    0x00000046, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000046, 0x00000007, 0x00000023, 0x0000001c, 0x00050048,
-    0x00000046, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x00000046, 0x00000009, 0x00000023, 0x00000024, 0x00050048,
-    0x00000046, 0x0000000a, 0x00000023, 0x00000028, 0x00030047, 0x00000046, 0x00000002, 0x00040047, 0x00000057, 0x00000006,
-    0x00000004, 0x00050048, 0x00000058, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000058, 0x00000003, 0x00040047,
-    0x0000005a, 0x00000022, 0x00000000, 0x00040047, 0x0000005a, 0x00000021, 0x00000001, 0x00040047, 0x0000008d, 0x00000006,
-    0x00000004, 0x00050048, 0x0000008e, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000008e, 0x00000003, 0x00040047,
-    0x00000090, 0x00000022, 0x00000000, 0x00040047, 0x00000090, 0x00000021, 0x00000002, 0x00020013, 0x00000002, 0x00030021,
-    0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040020, 0x00000007, 0x00000007, 0x00000006,
-    0x00070021, 0x00000008, 0x00000002, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x0003001d, 0x00000010, 0x00000006,
-    0x0005001e, 0x00000011, 0x00000006, 0x00000006, 0x00000010, 0x00040020, 0x00000012, 0x00000002, 0x00000011, 0x0004003b,
-    0x00000012, 0x00000013, 0x00000002, 0x00040015, 0x00000014, 0x00000020, 0x00000001, 0x0004002b, 0x00000014, 0x00000015,
-    0x00000001, 0x00040020, 0x00000016, 0x00000002, 0x00000006, 0x0004002b, 0x00000006, 0x00000018, 0x0000000b, 0x0004002b,
-    0x00000006, 0x00000019, 0x00000001, 0x0004002b, 0x00000006, 0x0000001a, 0x00000000, 0x0004002b, 0x00000006, 0x0000001d,
-    0x00000007, 0x0004002b, 0x00000006, 0x0000001f, 0x00000004, 0x00020014, 0x00000024, 0x0004002b, 0x00000014, 0x00000029,
-    0x00000002, 0x0004002b, 0x00000006, 0x00000035, 0x00000002, 0x0004002b, 0x00000006, 0x0000003b, 0x00000003, 0x00040020,
-    0x0000003f, 0x00000001, 0x00000014, 0x0004003b, 0x0000003f, 0x00000040, 0x00000001, 0x0004002b, 0x00000014, 0x00000042,
-    0x00000000, 0x000d001e, 0x00000046, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00040020, 0x00000047, 0x00000009, 0x00000046, 0x0004003b, 0x00000047,
-    0x00000048, 0x00000009, 0x00040020, 0x00000049, 0x00000009, 0x00000006, 0x0003001d, 0x00000057, 0x00000006, 0x0003001e,
-    0x00000058, 0x00000057, 0x00040020, 0x00000059, 0x00000002, 0x00000058, 0x0004003b, 0x00000059, 0x0000005a, 0x00000002,
-    0x0004002b, 0x00000014, 0x0000005b, 0x00000003, 0x0004002b, 0x00000006, 0x00000066, 0x00000005, 0x0003001d, 0x0000008d,
-    0x00000006, 0x0003001e, 0x0000008e, 0x0000008d, 0x00040020, 0x0000008f, 0x00000002, 0x0000008e, 0x0004003b, 0x0000008f,
-    0x00000090, 0x00000002, 0x0004002b, 0x00000014, 0x000000b2, 0x00000004, 0x0004002b, 0x00000014, 0x000000b6, 0x00000006,
-    0x0004002b, 0x00000014, 0x000000c4, 0x00000005, 0x0004002b, 0x00000014, 0x000000df, 0x00000007, 0x0004002b, 0x00000014,
-    0x000000ed, 0x00000008, 0x0004002b, 0x00000014, 0x000000fb, 0x00000009, 0x0004002b, 0x00000006, 0x00000101, 0x00000006,
-    0x0004002b, 0x00000014, 0x00000110, 0x0000000a, 0x0004002b, 0x00000006, 0x00000128, 0x00000008, 0x0004002b, 0x00000006,
-    0x00000129, 0x00000009, 0x0004002b, 0x00000006, 0x0000012a, 0x0000000a, 0x00050036, 0x00000002, 0x00000004, 0x00000000,
-    0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x00000007, 0x00000067, 0x00000007, 0x0004003b, 0x00000007, 0x00000068,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000069, 0x00000007, 0x0004003b, 0x00000007, 0x0000006b, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000074, 0x00000007, 0x0004003b, 0x00000007, 0x00000075, 0x00000007, 0x0004003b, 0x00000007, 0x00000076,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000078, 0x00000007, 0x0004003b, 0x00000007, 0x00000080, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000083, 0x00000007, 0x0004003b, 0x00000007, 0x00000097, 0x00000007, 0x0004003b, 0x00000007, 0x00000098,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000099, 0x00000007, 0x0004003b, 0x00000007, 0x0000009b, 0x00000007, 0x0004003b,
-    0x00000007, 0x000000b1, 0x00000007, 0x0004003b, 0x00000007, 0x000000be, 0x00000007, 0x0004003b, 0x00000007, 0x000000c7,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000e5, 0x00000007, 0x0004003b, 0x00000007, 0x000000e6, 0x00000007, 0x0004003b,
-    0x00000007, 0x000000e7, 0x00000007, 0x0004003b, 0x00000007, 0x000000e9, 0x00000007, 0x0004003b, 0x00000007, 0x000000f3,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000f4, 0x00000007, 0x0004003b, 0x00000007, 0x000000f5, 0x00000007, 0x0004003b,
-    0x00000007, 0x000000f7, 0x00000007, 0x0004003b, 0x00000007, 0x00000102, 0x00000007, 0x0004003b, 0x00000007, 0x00000103,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000104, 0x00000007, 0x0004003b, 0x00000007, 0x00000106, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000116, 0x00000007, 0x0004003b, 0x00000007, 0x00000117, 0x00000007, 0x0004003b, 0x00000007, 0x00000118,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000011a, 0x00000007, 0x0004003d, 0x00000014, 0x00000041, 0x00000040, 0x000500aa,
-    0x00000024, 0x00000043, 0x00000041, 0x00000042, 0x000300f7, 0x00000045, 0x00000000, 0x000400fa, 0x00000043, 0x00000044,
-    0x00000045, 0x000200f8, 0x00000044, 0x00050041, 0x00000049, 0x0000004a, 0x00000048, 0x00000042, 0x0004003d, 0x00000006,
-    0x0000004b, 0x0000004a, 0x000500aa, 0x00000024, 0x0000004c, 0x0000004b, 0x00000019, 0x000400a8, 0x00000024, 0x0000004d,
-    0x0000004c, 0x000300f7, 0x0000004f, 0x00000000, 0x000400fa, 0x0000004d, 0x0000004e, 0x0000004f, 0x000200f8, 0x0000004e,
-    0x00050041, 0x00000049, 0x00000050, 0x00000048, 0x00000042, 0x0004003d, 0x00000006, 0x00000051, 0x00000050, 0x000500aa,
-    0x00000024, 0x00000052, 0x00000051, 0x0000003b, 0x000200f9, 0x0000004f, 0x000200f8, 0x0000004f, 0x000700f5, 0x00000024,
-    0x00000053, 0x0000004c, 0x00000044, 0x00000052, 0x0000004e, 0x000300f7, 0x00000055, 0x00000000, 0x000400fa, 0x00000053,
-    0x00000054, 0x0000007a, 0x000200f8, 0x00000054, 0x00050041, 0x00000049, 0x0000005c, 0x00000048, 0x0000005b, 0x0004003d,
-    0x00000006, 0x0000005d, 0x0000005c, 0x00060041, 0x00000016, 0x0000005e, 0x0000005a, 0x00000042, 0x0000005d, 0x0004003d,
-    0x00000006, 0x0000005f, 0x0000005e, 0x00050041, 0x00000049, 0x00000061, 0x00000048, 0x00000029, 0x0004003d, 0x00000006,
-    0x00000062, 0x00000061, 0x000500ac, 0x00000024, 0x00000063, 0x0000005f, 0x00000062, 0x000300f7, 0x00000065, 0x00000000,
-    0x000400fa, 0x00000063, 0x00000064, 0x0000006d, 0x000200f8, 0x00000064, 0x0003003e, 0x00000067, 0x00000066, 0x0003003e,
-    0x00000068, 0x00000019, 0x0003003e, 0x00000069, 0x0000005f, 0x0003003e, 0x0000006b, 0x0000001a, 0x00080039, 0x00000002,
-    0x0000006c, 0x0000000d, 0x00000067, 0x00000068, 0x00000069, 0x0000006b, 0x000200f9, 0x00000065, 0x000200f8, 0x0000006d,
-    0x00050041, 0x00000049, 0x0000006f, 0x00000048, 0x00000015, 0x0004003d, 0x00000006, 0x00000070, 0x0000006f, 0x000500ac,
-    0x00000024, 0x00000071, 0x0000005f, 0x00000070, 0x000300f7, 0x00000073, 0x00000000, 0x000400fa, 0x00000071, 0x00000072,
-    0x00000073, 0x000200f8, 0x00000072, 0x0003003e, 0x00000074, 0x00000066, 0x0003003e, 0x00000075, 0x00000035, 0x0003003e,
-    0x00000076, 0x0000005f, 0x0003003e, 0x00000078, 0x0000001a, 0x00080039, 0x00000002, 0x00000079, 0x0000000d, 0x00000074,
-    0x00000075, 0x00000076, 0x00000078, 0x000200f9, 0x00000073, 0x000200f8, 0x00000073, 0x000200f9, 0x00000065, 0x000200f8,
-    0x00000065, 0x000200f9, 0x00000055, 0x000200f8, 0x0000007a, 0x00050041, 0x00000049, 0x0000007b, 0x00000048, 0x00000042,
-    0x0004003d, 0x00000006, 0x0000007c, 0x0000007b, 0x000500aa, 0x00000024, 0x0000007d, 0x0000007c, 0x00000035, 0x000300f7,
-    0x0000007f, 0x00000000, 0x000400fa, 0x0000007d, 0x0000007e, 0x0000007f, 0x000200f8, 0x0000007e, 0x00050041, 0x00000049,
-    0x00000081, 0x00000048, 0x00000029, 0x0004003d, 0x00000006, 0x00000082, 0x00000081, 0x0003003e, 0x00000080, 0x00000082,
-    0x0003003e, 0x00000083, 0x0000001a, 0x000200f9, 0x00000084, 0x000200f8, 0x00000084, 0x000400f6, 0x00000086, 0x00000087,
-    0x00000000, 0x000200f9, 0x00000088, 0x000200f8, 0x00000088, 0x0004003d, 0x00000006, 0x00000089, 0x00000083, 0x00050041,
-    0x00000049, 0x0000008a, 0x00000048, 0x00000015, 0x0004003d, 0x00000006, 0x0000008b, 0x0000008a, 0x000500b0, 0x00000024,
-    0x0000008c, 0x00000089, 0x0000008b, 0x000400fa, 0x0000008c, 0x00000085, 0x00000086, 0x000200f8, 0x00000085, 0x0004003d,
-    0x00000006, 0x00000091, 0x00000080, 0x00060041, 0x00000016, 0x00000092, 0x00000090, 0x00000042, 0x00000091, 0x0004003d,
-    0x00000006, 0x00000093, 0x00000092, 0x000500ab, 0x00000024, 0x00000094, 0x00000093, 0x0000001a, 0x000300f7, 0x00000096,
-    0x00000000, 0x000400fa, 0x00000094, 0x00000095, 0x00000096, 0x000200f8, 0x00000095, 0x0003003e, 0x00000097, 0x00000066,
-    0x0003003e, 0x00000098, 0x0000003b, 0x0004003d, 0x00000006, 0x0000009a, 0x00000083, 0x0003003e, 0x00000099, 0x0000009a,
-    0x0003003e, 0x0000009b, 0x0000009a, 0x00080039, 0x00000002, 0x0000009d, 0x0000000d, 0x00000097, 0x00000098, 0x00000099,
-    0x0000009b, 0x000200f9, 0x00000086, 0x000200f8, 0x00000096, 0x00050041, 0x00000049, 0x0000009f, 0x00000048, 0x0000005b,
-    0x0004003d, 0x00000006, 0x000000a0, 0x0000009f, 0x0004003d, 0x00000006, 0x000000a1, 0x00000080, 0x00050080, 0x00000006,
-    0x000000a2, 0x000000a1, 0x000000a0, 0x0003003e, 0x00000080, 0x000000a2, 0x000200f9, 0x00000087, 0x000200f8, 0x00000087,
-    0x0004003d, 0x00000006, 0x000000a3, 0x00000083, 0x00050080, 0x00000006, 0x000000a4, 0x000000a3, 0x00000015, 0x0003003e,
-    0x00000083, 0x000000a4, 0x000200f9, 0x00000084, 0x000200f8, 0x00000086, 0x000200f9, 0x0000007f, 0x000200f8, 0x0000007f,
-    0x000200f9, 0x00000055, 0x000200f8, 0x00000055, 0x00050041, 0x00000049, 0x000000a5, 0x00000048, 0x00000042, 0x0004003d,
-    0x00000006, 0x000000a6, 0x000000a5, 0x000500aa, 0x00000024, 0x000000a7, 0x000000a6, 0x0000003b, 0x000400a8, 0x00000024,
-    0x000000a8, 0x000000a7, 0x000300f7, 0x000000aa, 0x00000000, 0x000400fa, 0x000000a8, 0x000000a9, 0x000000aa, 0x000200f8,
-    0x000000a9, 0x00050041, 0x00000049, 0x000000ab, 0x00000048, 0x00000042, 0x0004003d, 0x00000006, 0x000000ac, 0x000000ab,
-    0x000500aa, 0x00000024, 0x000000ad, 0x000000ac, 0x0000001f, 0x000200f9, 0x000000aa, 0x000200f8, 0x000000aa, 0x000700f5,
-    0x00000024, 0x000000ae, 0x000000a7, 0x00000055, 0x000000ad, 0x000000a9, 0x000300f7, 0x000000b0, 0x00000000, 0x000400fa,
-    0x000000ae, 0x000000af, 0x000000b0, 0x000200f8, 0x000000af, 0x00050041, 0x00000049, 0x000000b3, 0x00000048, 0x000000b2,
-    0x0004003d, 0x00000006, 0x000000b4, 0x000000b3, 0x0003003e, 0x000000b1, 0x000000b4, 0x00050041, 0x00000049, 0x000000b7,
-    0x00000048, 0x000000b6, 0x0004003d, 0x00000006, 0x000000b8, 0x000000b7, 0x00050041, 0x00000049, 0x000000b9, 0x00000048,
-    0x00000042, 0x0004003d, 0x00000006, 0x000000ba, 0x000000b9, 0x000500aa, 0x00000024, 0x000000bb, 0x000000ba, 0x0000003b,
-    0x000300f7, 0x000000bd, 0x00000000, 0x000400fa, 0x000000bb, 0x000000bc, 0x000000c3, 0x000200f8, 0x000000bc, 0x00050041,
-    0x00000049, 0x000000bf, 0x00000048, 0x0000005b, 0x0004003d, 0x00000006, 0x000000c0, 0x000000bf, 0x00060041, 0x00000016,
-    0x000000c1, 0x0000005a, 0x00000042, 0x000000c0, 0x0004003d, 0x00000006, 0x000000c2, 0x000000c1, 0x0003003e, 0x000000be,
-    0x000000c2, 0x000200f9, 0x000000bd, 0x000200f8, 0x000000c3, 0x00050041, 0x00000049, 0x000000c5, 0x00000048, 0x000000c4,
-    0x0004003d, 0x00000006, 0x000000c6, 0x000000c5, 0x0003003e, 0x000000be, 0x000000c6, 0x000200f9, 0x000000bd, 0x000200f8,
-    0x000000bd, 0x0003003e, 0x000000c7, 0x0000001a, 0x000200f9, 0x000000c8, 0x000200f8, 0x000000c8, 0x000400f6, 0x000000ca,
-    0x000000cb, 0x00000000, 0x000200f9, 0x000000cc, 0x000200f8, 0x000000cc, 0x0004003d, 0x00000006, 0x000000cd, 0x000000c7,
-    0x0004003d, 0x00000006, 0x000000ce, 0x000000be, 0x000500b0, 0x00000024, 0x000000cf, 0x000000cd, 0x000000ce, 0x000400fa,
-    0x000000cf, 0x000000c9, 0x000000ca, 0x000200f8, 0x000000c9, 0x0004003d, 0x00000006, 0x000000d1, 0x000000b1, 0x00060041,
-    0x00000016, 0x000000d2, 0x00000090, 0x00000042, 0x000000d1, 0x0004003d, 0x00000006, 0x000000d3, 0x000000d2, 0x00050080,
-    0x00000006, 0x000000d6, 0x000000d1, 0x00000019, 0x00060041, 0x00000016, 0x000000d7, 0x00000090, 0x00000042, 0x000000d6,
-    0x0004003d, 0x00000006, 0x000000d8, 0x000000d7, 0x00050080, 0x00000006, 0x000000db, 0x000000d1, 0x00000035, 0x00060041,
-    0x00000016, 0x000000dc, 0x00000090, 0x00000042, 0x000000db, 0x0004003d, 0x00000006, 0x000000dd, 0x000000dc, 0x00050041,
-    0x00000049, 0x000000e0, 0x00000048, 0x000000df, 0x0004003d, 0x00000006, 0x000000e1, 0x000000e0, 0x000500ac, 0x00000024,
-    0x000000e2, 0x000000d3, 0x000000e1, 0x000300f7, 0x000000e4, 0x00000000, 0x000400fa, 0x000000e2, 0x000000e3, 0x000000e4,
-    0x000200f8, 0x000000e3, 0x0003003e, 0x000000e5, 0x00000066, 0x0003003e, 0x000000e6, 0x0000001f, 0x0003003e, 0x000000e7,
-    0x000000d3, 0x0004003d, 0x00000006, 0x000000ea, 0x000000c7, 0x0003003e, 0x000000e9, 0x000000ea, 0x00080039, 0x00000002,
-    0x000000eb, 0x0000000d, 0x000000e5, 0x000000e6, 0x000000e7, 0x000000e9, 0x000200f9, 0x000000e4, 0x000200f8, 0x000000e4,
-    0x00050041, 0x00000049, 0x000000ee, 0x00000048, 0x000000ed, 0x0004003d, 0x00000006, 0x000000ef, 0x000000ee, 0x000500ac,
-    0x00000024, 0x000000f0, 0x000000d8, 0x000000ef, 0x000300f7, 0x000000f2, 0x00000000, 0x000400fa, 0x000000f0, 0x000000f1,
-    0x000000f2, 0x000200f8, 0x000000f1, 0x0003003e, 0x000000f3, 0x00000066, 0x0003003e, 0x000000f4, 0x00000066, 0x0003003e,
-    0x000000f5, 0x000000d8, 0x0004003d, 0x00000006, 0x000000f8, 0x000000c7, 0x0003003e, 0x000000f7, 0x000000f8, 0x00080039,
-    0x00000002, 0x000000f9, 0x0000000d, 0x000000f3, 0x000000f4, 0x000000f5, 0x000000f7, 0x000200f9, 0x000000f2, 0x000200f8,
-    0x000000f2, 0x00050041, 0x00000049, 0x000000fc, 0x00000048, 0x000000fb, 0x0004003d, 0x00000006, 0x000000fd, 0x000000fc,
-    0x000500ac, 0x00000024, 0x000000fe, 0x000000dd, 0x000000fd, 0x000300f7, 0x00000100, 0x00000000, 0x000400fa, 0x000000fe,
-    0x000000ff, 0x00000100, 0x000200f8, 0x000000ff, 0x0003003e, 0x00000102, 0x00000066, 0x0003003e, 0x00000103, 0x00000101,
-    0x0003003e, 0x00000104, 0x000000dd, 0x0004003d, 0x00000006, 0x00000107, 0x000000c7, 0x0003003e, 0x00000106, 0x00000107,
-    0x00080039, 0x00000002, 0x00000108, 0x0000000d, 0x00000102, 0x00000103, 0x00000104, 0x00000106, 0x000200f9, 0x00000100,
-    0x000200f8, 0x00000100, 0x00050084, 0x00000006, 0x0000010c, 0x000000d3, 0x000000d8, 0x00050084, 0x00000006, 0x0000010e,
-    0x0000010c, 0x000000dd, 0x00050041, 0x00000049, 0x00000111, 0x00000048, 0x00000110, 0x0004003d, 0x00000006, 0x00000112,
-    0x00000111, 0x000500ac, 0x00000024, 0x00000113, 0x0000010e, 0x00000112, 0x000300f7, 0x00000115, 0x00000000, 0x000400fa,
-    0x00000113, 0x00000114, 0x00000115, 0x000200f8, 0x00000114, 0x0003003e, 0x00000116, 0x00000066, 0x0003003e, 0x00000117,
-    0x0000001d, 0x0003003e, 0x00000118, 0x0000010e, 0x0004003d, 0x00000006, 0x0000011b, 0x000000c7, 0x0003003e, 0x0000011a,
-    0x0000011b, 0x00080039, 0x00000002, 0x0000011c, 0x0000000d, 0x00000116, 0x00000117, 0x00000118, 0x0000011a, 0x000200f9,
-    0x00000115, 0x000200f8, 0x00000115, 0x0004003d, 0x00000006, 0x0000011e, 0x000000b1, 0x00050080, 0x00000006, 0x0000011f,
-    0x0000011e, 0x000000b8, 0x0003003e, 0x000000b1, 0x0000011f, 0x000200f9, 0x000000cb, 0x000200f8, 0x000000cb, 0x0004003d,
-    0x00000006, 0x00000120, 0x000000c7, 0x00050080, 0x00000006, 0x00000121, 0x00000120, 0x00000015, 0x0003003e, 0x000000c7,
-    0x00000121, 0x000200f9, 0x000000c8, 0x000200f8, 0x000000ca, 0x000200f9, 0x000000b0, 0x000200f8, 0x000000b0, 0x000200f9,
-    0x00000045, 0x000200f8, 0x00000045, 0x000100fd, 0x00010038, 0x00050036, 0x00000002, 0x0000000d, 0x00000000, 0x00000008,
-    0x00030037, 0x00000007, 0x00000009, 0x00030037, 0x00000007, 0x0000000a, 0x00030037, 0x00000007, 0x0000000b, 0x00030037,
-    0x00000007, 0x0000000c, 0x000200f8, 0x0000000e, 0x00050041, 0x00000016, 0x00000017, 0x00000013, 0x00000015, 0x000700ea,
-    0x00000006, 0x0000001b, 0x00000017, 0x00000019, 0x0000001a, 0x00000018, 0x00050080, 0x00000006, 0x00000020, 0x0000001b,
-    0x00000018, 0x00050044, 0x00000006, 0x00000021, 0x00000013, 0x00000002, 0x0004007c, 0x00000014, 0x00000022, 0x00000021,
-    0x0004007c, 0x00000006, 0x00000023, 0x00000022, 0x000500ac, 0x00000024, 0x00000025, 0x00000020, 0x00000023, 0x000300f7,
-    0x00000027, 0x00000000, 0x000400fa, 0x00000025, 0x00000026, 0x00000027, 0x000200f8, 0x00000026, 0x000100fd, 0x000200f8,
-    0x00000027, 0x00050080, 0x00000006, 0x0000002b, 0x0000001b, 0x0000001d, 0x0004003d, 0x00000006, 0x0000002c, 0x00000009,
-    0x00060041, 0x00000016, 0x0000002d, 0x00000013, 0x00000029, 0x0000002b, 0x0003003e, 0x0000002d, 0x0000002c, 0x00050080,
-    0x00000006, 0x00000030, 0x0000001b, 0x00000128, 0x0004003d, 0x00000006, 0x00000031, 0x0000000a, 0x00060041, 0x00000016,
-    0x00000032, 0x00000013, 0x00000029, 0x00000030, 0x0003003e, 0x00000032, 0x00000031, 0x00050080, 0x00000006, 0x00000036,
-    0x0000001b, 0x00000129, 0x0004003d, 0x00000006, 0x00000037, 0x0000000b, 0x00060041, 0x00000016, 0x00000038, 0x00000013,
-    0x00000029, 0x00000036, 0x0003003e, 0x00000038, 0x00000037, 0x00050080, 0x00000006, 0x0000003c, 0x0000001b, 0x0000012a,
-    0x0004003d, 0x00000006, 0x0000003d, 0x0000000c, 0x00060041, 0x00000016, 0x0000003e, 0x00000013, 0x00000029, 0x0000003c,
-    0x0003003e, 0x0000003e, 0x0000003d, 0x000100fd, 0x00010038,
+    0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000002, 0x6e69616d, 0x00000000, 0x00090005, 0x00000004, 0x61757067,
+    0x676f4c76, 0x6f727245, 0x31752872, 0x3b31753b, 0x753b3175, 0x00003b31, 0x00050005, 0x00000005, 0x69746361, 0x635f6e6f,
+    0x0065646f, 0x00040005, 0x00000006, 0x6f727265, 0x00000072, 0x00040005, 0x00000007, 0x6e756f63, 0x00000074, 0x00050005,
+    0x00000008, 0x77617264, 0x6d756e5f, 0x00726562, 0x00060005, 0x00000009, 0x7074754f, 0x75427475, 0x72656666, 0x00000000,
+    0x00050006, 0x00000009, 0x00000000, 0x67616c66, 0x00000073, 0x00080006, 0x00000009, 0x00000001, 0x7074756f, 0x625f7475,
+    0x65666675, 0x6f635f72, 0x00746e75, 0x00070006, 0x00000009, 0x00000002, 0x7074756f, 0x625f7475, 0x65666675, 0x00000072,
+    0x00030005, 0x0000000a, 0x00000000, 0x00060005, 0x00000003, 0x565f6c67, 0x65747265, 0x646e4978, 0x00007865, 0x00050005,
+    0x0000000b, 0x66696e55, 0x496d726f, 0x006f666e, 0x00090006, 0x0000000b, 0x00000000, 0x68737570, 0x6e6f635f, 0x6e617473,
+    0x6f775f74, 0x305f6472, 0x00000000, 0x00090006, 0x0000000b, 0x00000001, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74,
+    0x315f6472, 0x00000000, 0x00090006, 0x0000000b, 0x00000002, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x325f6472,
+    0x00000000, 0x00090006, 0x0000000b, 0x00000003, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x335f6472, 0x00000000,
+    0x00090006, 0x0000000b, 0x00000004, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x345f6472, 0x00000000, 0x00090006,
+    0x0000000b, 0x00000005, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x355f6472, 0x00000000, 0x00090006, 0x0000000b,
+    0x00000006, 0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x365f6472, 0x00000000, 0x00090006, 0x0000000b, 0x00000007,
+    0x68737570, 0x6e6f635f, 0x6e617473, 0x6f775f74, 0x375f6472, 0x00000000, 0x00090006, 0x0000000b, 0x00000008, 0x68737570,
+    0x6e6f635f, 0x6e617473, 0x6f775f74, 0x385f6472, 0x00000000, 0x00090006, 0x0000000b, 0x00000009, 0x68737570, 0x6e6f635f,
+    0x6e617473, 0x6f775f74, 0x395f6472, 0x00000000, 0x00090006, 0x0000000b, 0x0000000a, 0x68737570, 0x6e6f635f, 0x6e617473,
+    0x6f775f74, 0x315f6472, 0x00000030, 0x00040005, 0x0000000c, 0x6e695f75, 0x00006f66, 0x00050005, 0x0000000d, 0x6e756f43,
+    0x66754274, 0x00726566, 0x00070006, 0x0000000d, 0x00000000, 0x6e756f63, 0x75625f74, 0x72656666, 0x00000000, 0x00030005,
+    0x0000000e, 0x00000000, 0x00050005, 0x0000000f, 0x77617244, 0x66667542, 0x00007265, 0x00070006, 0x0000000f, 0x00000000,
+    0x77617264, 0x75625f73, 0x72656666, 0x00000000, 0x00030005, 0x00000010, 0x00000000, 0x00050005, 0x00000011, 0x77617264,
+    0x646e695f, 0x00007865, 0x00040047, 0x00000012, 0x00000006, 0x00000004, 0x00050048, 0x00000009, 0x00000000, 0x00000023,
+    0x00000000, 0x00050048, 0x00000009, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000009, 0x00000002, 0x00000023,
+    0x00000008, 0x00030047, 0x00000009, 0x00000003, 0x00040047, 0x0000000a, 0x00000022, 0x00000000, 0x00040047, 0x0000000a,
+    0x00000021, 0x00000000, 0x00040047, 0x00000003, 0x0000000b, 0x0000002a, 0x00050048, 0x0000000b, 0x00000000, 0x00000023,
+    0x00000000, 0x00050048, 0x0000000b, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000000b, 0x00000002, 0x00000023,
+    0x00000008, 0x00050048, 0x0000000b, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000000b, 0x00000004, 0x00000023,
+    0x00000010, 0x00050048, 0x0000000b, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x0000000b, 0x00000006, 0x00000023,
+    0x00000018, 0x00050048, 0x0000000b, 0x00000007, 0x00000023, 0x0000001c, 0x00050048, 0x0000000b, 0x00000008, 0x00000023,
+    0x00000020, 0x00050048, 0x0000000b, 0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x0000000b, 0x0000000a, 0x00000023,
+    0x00000028, 0x00030047, 0x0000000b, 0x00000002, 0x00040047, 0x00000013, 0x00000006, 0x00000004, 0x00050048, 0x0000000d,
+    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000000d, 0x00000003, 0x00040047, 0x0000000e, 0x00000022, 0x00000000,
+    0x00040047, 0x0000000e, 0x00000021, 0x00000001, 0x00040047, 0x00000014, 0x00000006, 0x00000004, 0x00050048, 0x0000000f,
+    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000000f, 0x00000003, 0x00040047, 0x00000010, 0x00000022, 0x00000000,
+    0x00040047, 0x00000010, 0x00000021, 0x00000002, 0x00020013, 0x00000015, 0x00030021, 0x00000016, 0x00000015, 0x00040015,
+    0x00000017, 0x00000020, 0x00000000, 0x00040015, 0x00000018, 0x00000020, 0x00000001, 0x00020014, 0x00000019, 0x00070021,
+    0x0000001a, 0x00000015, 0x00000017, 0x00000017, 0x00000017, 0x00000017, 0x0003001d, 0x00000012, 0x00000017, 0x0005001e,
+    0x00000009, 0x00000017, 0x00000017, 0x00000012, 0x00040020, 0x0000001b, 0x00000002, 0x00000009, 0x0004003b, 0x0000001b,
+    0x0000000a, 0x00000002, 0x00040020, 0x0000001c, 0x00000002, 0x00000017, 0x00040020, 0x0000001d, 0x00000001, 0x00000018,
+    0x0004003b, 0x0000001d, 0x00000003, 0x00000001, 0x000d001e, 0x0000000b, 0x00000017, 0x00000017, 0x00000017, 0x00000017,
+    0x00000017, 0x00000017, 0x00000017, 0x00000017, 0x00000017, 0x00000017, 0x00000017, 0x00040020, 0x0000001e, 0x00000009,
+    0x0000000b, 0x0004003b, 0x0000001e, 0x0000000c, 0x00000009, 0x00040020, 0x0000001f, 0x00000009, 0x00000017, 0x0003001d,
+    0x00000013, 0x00000017, 0x0003001e, 0x0000000d, 0x00000013, 0x00040020, 0x00000020, 0x00000002, 0x0000000d, 0x0004003b,
+    0x00000020, 0x0000000e, 0x00000002, 0x0003001d, 0x00000014, 0x00000017, 0x0003001e, 0x0000000f, 0x00000014, 0x00040020,
+    0x00000021, 0x00000002, 0x0000000f, 0x0004003b, 0x00000021, 0x00000010, 0x00000002, 0x0004002b, 0x00000017, 0x00000022,
+    0x00000000, 0x0004002b, 0x00000017, 0x00000023, 0x00000001, 0x0004002b, 0x00000017, 0x00000024, 0x00000002, 0x0004002b,
+    0x00000017, 0x00000025, 0x00000003, 0x0004002b, 0x00000017, 0x00000026, 0x00000004, 0x0004002b, 0x00000017, 0x00000027,
+    0x00000005, 0x0004002b, 0x00000017, 0x00000028, 0x00000006, 0x0004002b, 0x00000017, 0x00000029, 0x00000007, 0x0004002b,
+    0x00000017, 0x0000002a, 0x00000008, 0x0004002b, 0x00000017, 0x0000002b, 0x00000009, 0x0004002b, 0x00000017, 0x0000002c,
+    0x0000000a, 0x0004002b, 0x00000017, 0x0000002d, 0x0000000b, 0x0004002b, 0x00000018, 0x0000002e, 0x00000000, 0x0004002b,
+    0x00000018, 0x0000002f, 0x00000001, 0x0004002b, 0x00000018, 0x00000030, 0x00000002, 0x0004002b, 0x00000018, 0x00000031,
+    0x00000003, 0x0004002b, 0x00000018, 0x00000032, 0x00000004, 0x0004002b, 0x00000018, 0x00000033, 0x00000005, 0x0004002b,
+    0x00000018, 0x00000034, 0x00000006, 0x0004002b, 0x00000018, 0x00000035, 0x00000007, 0x0004002b, 0x00000018, 0x00000036,
+    0x00000008, 0x0004002b, 0x00000018, 0x00000037, 0x00000009, 0x0004002b, 0x00000018, 0x00000038, 0x0000000a, 0x00050036,
+    0x00000015, 0x00000002, 0x00000000, 0x00000016, 0x000200f8, 0x00000039, 0x0004003d, 0x00000018, 0x0000003a, 0x00000003,
+    0x0004007c, 0x00000017, 0x00000011, 0x0000003a, 0x00050041, 0x0000001f, 0x0000003b, 0x0000000c, 0x0000002e, 0x0004003d,
+    0x00000017, 0x0000003c, 0x0000003b, 0x000500aa, 0x00000019, 0x0000003d, 0x0000003c, 0x00000023, 0x000500aa, 0x00000019,
+    0x0000003e, 0x0000003c, 0x00000025, 0x000500a6, 0x00000019, 0x0000003f, 0x0000003d, 0x0000003e, 0x000300f7, 0x00000040,
+    0x00000000, 0x000400fa, 0x0000003f, 0x00000041, 0x00000042, 0x000200f8, 0x00000041, 0x000500aa, 0x00000019, 0x00000043,
+    0x00000011, 0x00000022, 0x000300f7, 0x00000044, 0x00000000, 0x000400fa, 0x00000043, 0x00000045, 0x00000044, 0x000200f8,
+    0x00000045, 0x00050041, 0x0000001f, 0x00000046, 0x0000000c, 0x00000031, 0x0004003d, 0x00000017, 0x00000047, 0x00000046,
+    0x00060041, 0x0000001c, 0x00000048, 0x0000000e, 0x0000002e, 0x00000047, 0x0004003d, 0x00000017, 0x00000049, 0x00000048,
+    0x00050041, 0x0000001f, 0x0000004a, 0x0000000c, 0x00000030, 0x0004003d, 0x00000017, 0x0000004b, 0x0000004a, 0x000500ac,
+    0x00000019, 0x0000004c, 0x00000049, 0x0000004b, 0x000300f7, 0x0000004d, 0x00000000, 0x000400fa, 0x0000004c, 0x0000004e,
+    0x0000004f, 0x000200f8, 0x0000004e, 0x00080039, 0x00000015, 0x00000050, 0x00000004, 0x00000027, 0x00000023, 0x00000049,
+    0x00000022, 0x000200f9, 0x0000004d, 0x000200f8, 0x0000004f, 0x00050041, 0x0000001f, 0x00000051, 0x0000000c, 0x0000002f,
+    0x0004003d, 0x00000017, 0x00000052, 0x00000051, 0x000500ac, 0x00000019, 0x00000053, 0x00000049, 0x00000052, 0x000300f7,
+    0x00000054, 0x00000000, 0x000400fa, 0x00000053, 0x00000055, 0x00000054, 0x000200f8, 0x00000055, 0x00080039, 0x00000015,
+    0x00000056, 0x00000004, 0x00000027, 0x00000024, 0x00000049, 0x00000022, 0x000200f9, 0x00000054, 0x000200f8, 0x00000054,
+    0x000200f9, 0x0000004d, 0x000200f8, 0x0000004d, 0x000200f9, 0x00000044, 0x000200f8, 0x00000044, 0x000200f9, 0x00000040,
+    0x000200f8, 0x00000042, 0x000500aa, 0x00000019, 0x00000057, 0x0000003c, 0x00000024, 0x000300f7, 0x00000058, 0x00000000,
+    0x000400fa, 0x00000057, 0x00000059, 0x00000058, 0x000200f8, 0x00000059, 0x00050041, 0x0000001f, 0x0000005a, 0x0000000c,
+    0x0000002f, 0x0004003d, 0x00000017, 0x0000005b, 0x0000005a, 0x000500b0, 0x00000019, 0x0000005c, 0x00000011, 0x0000005b,
+    0x000300f7, 0x0000005d, 0x00000000, 0x000400fa, 0x0000005c, 0x0000005e, 0x0000005d, 0x000200f8, 0x0000005e, 0x00050041,
+    0x0000001f, 0x0000005f, 0x0000000c, 0x00000030, 0x0004003d, 0x00000017, 0x00000060, 0x0000005f, 0x00050041, 0x0000001f,
+    0x00000061, 0x0000000c, 0x00000031, 0x0004003d, 0x00000017, 0x00000062, 0x00000061, 0x00050084, 0x00000017, 0x00000063,
+    0x00000011, 0x00000062, 0x00050080, 0x00000017, 0x00000064, 0x00000060, 0x00000063, 0x00060041, 0x0000001c, 0x00000065,
+    0x00000010, 0x0000002e, 0x00000064, 0x0004003d, 0x00000017, 0x00000066, 0x00000065, 0x000500ab, 0x00000019, 0x00000067,
+    0x00000066, 0x00000022, 0x000300f7, 0x00000068, 0x00000000, 0x000400fa, 0x00000067, 0x00000069, 0x00000068, 0x000200f8,
+    0x00000069, 0x00080039, 0x00000015, 0x0000006a, 0x00000004, 0x00000027, 0x00000025, 0x00000011, 0x00000011, 0x000200f9,
+    0x00000068, 0x000200f8, 0x00000068, 0x000200f9, 0x0000005d, 0x000200f8, 0x0000005d, 0x000200f9, 0x00000058, 0x000200f8,
+    0x00000058, 0x000200f9, 0x00000040, 0x000200f8, 0x00000040, 0x000500aa, 0x00000019, 0x0000006b, 0x0000003c, 0x00000026,
+    0x000500a6, 0x00000019, 0x0000006c, 0x0000003e, 0x0000006b, 0x000300f7, 0x0000006d, 0x00000000, 0x000400fa, 0x0000006c,
+    0x0000006e, 0x0000006d, 0x000200f8, 0x0000006e, 0x00050041, 0x0000001f, 0x0000006f, 0x0000000c, 0x00000033, 0x0004003d,
+    0x00000017, 0x00000070, 0x0000006f, 0x000300f7, 0x00000071, 0x00000000, 0x000400fa, 0x0000003e, 0x00000072, 0x00000071,
+    0x000200f8, 0x00000072, 0x00050041, 0x0000001f, 0x00000073, 0x0000000c, 0x00000031, 0x0004003d, 0x00000017, 0x00000074,
+    0x00000073, 0x00060041, 0x0000001c, 0x00000075, 0x0000000e, 0x0000002e, 0x00000074, 0x0004003d, 0x00000017, 0x00000076,
+    0x00000075, 0x000500b0, 0x00000019, 0x00000077, 0x00000076, 0x00000070, 0x000600a9, 0x00000017, 0x00000078, 0x00000077,
+    0x00000076, 0x00000070, 0x000200f9, 0x00000071, 0x000200f8, 0x00000071, 0x000700f5, 0x00000017, 0x00000079, 0x00000070,
+    0x0000006e, 0x00000078, 0x00000072, 0x000500b0, 0x00000019, 0x0000007a, 0x00000011, 0x00000079, 0x000300f7, 0x0000007b,
+    0x00000000, 0x000400fa, 0x0000007a, 0x0000007c, 0x0000007b, 0x000200f8, 0x0000007c, 0x00050041, 0x0000001f, 0x0000007d,
+    0x0000000c, 0x00000032, 0x0004003d, 0x00000017, 0x0000007e, 0x0000007d, 0x00050041, 0x0000001f, 0x0000007f, 0x0000000c,
+    0x00000034, 0x0004003d, 0x00000017, 0x00000080, 0x0000007f, 0x00050084, 0x00000017, 0x00000081, 0x00000011, 0x00000080,
+    0x00050080, 0x00000017, 0x00000082, 0x0000007e, 0x00000081, 0x00050080, 0x00000017, 0x00000083, 0x00000082, 0x00000023,
+    0x00050080, 0x00000017, 0x00000084, 0x00000082, 0x00000024, 0x00060041, 0x0000001c, 0x00000085, 0x00000010, 0x0000002e,
+    0x00000082, 0x0004003d, 0x00000017, 0x00000086, 0x00000085, 0x00060041, 0x0000001c, 0x00000087, 0x00000010, 0x0000002e,
+    0x00000083, 0x0004003d, 0x00000017, 0x00000088, 0x00000087, 0x00060041, 0x0000001c, 0x00000089, 0x00000010, 0x0000002e,
+    0x00000084, 0x0004003d, 0x00000017, 0x0000008a, 0x00000089, 0x00050041, 0x0000001f, 0x0000008b, 0x0000000c, 0x00000035,
+    0x0004003d, 0x00000017, 0x0000008c, 0x0000008b, 0x000500ac, 0x00000019, 0x0000008d, 0x00000086, 0x0000008c, 0x000300f7,
+    0x0000008e, 0x00000000, 0x000400fa, 0x0000008d, 0x0000008f, 0x0000008e, 0x000200f8, 0x0000008f, 0x00080039, 0x00000015,
+    0x00000090, 0x00000004, 0x00000027, 0x00000026, 0x00000086, 0x00000011, 0x000200f9, 0x0000008e, 0x000200f8, 0x0000008e,
+    0x00050041, 0x0000001f, 0x00000091, 0x0000000c, 0x00000036, 0x0004003d, 0x00000017, 0x00000092, 0x00000091, 0x000500ac,
+    0x00000019, 0x00000093, 0x00000088, 0x00000092, 0x000300f7, 0x00000094, 0x00000000, 0x000400fa, 0x00000093, 0x00000095,
+    0x00000094, 0x000200f8, 0x00000095, 0x00080039, 0x00000015, 0x00000096, 0x00000004, 0x00000027, 0x00000027, 0x00000088,
+    0x00000011, 0x000200f9, 0x00000094, 0x000200f8, 0x00000094, 0x00050041, 0x0000001f, 0x00000097, 0x0000000c, 0x00000037,
+    0x0004003d, 0x00000017, 0x00000098, 0x00000097, 0x000500ac, 0x00000019, 0x00000099, 0x0000008a, 0x00000098, 0x000300f7,
+    0x0000009a, 0x00000000, 0x000400fa, 0x00000099, 0x0000009b, 0x0000009a, 0x000200f8, 0x0000009b, 0x00080039, 0x00000015,
+    0x0000009c, 0x00000004, 0x00000027, 0x00000028, 0x0000008a, 0x00000011, 0x000200f9, 0x0000009a, 0x000200f8, 0x0000009a,
+    0x00050084, 0x00000017, 0x0000009d, 0x00000086, 0x00000088, 0x00050084, 0x00000017, 0x0000009e, 0x0000009d, 0x0000008a,
+    0x00050041, 0x0000001f, 0x0000009f, 0x0000000c, 0x00000038, 0x0004003d, 0x00000017, 0x000000a0, 0x0000009f, 0x000500ac,
+    0x00000019, 0x000000a1, 0x0000009e, 0x000000a0, 0x000300f7, 0x000000a2, 0x00000000, 0x000400fa, 0x000000a1, 0x000000a3,
+    0x000000a2, 0x000200f8, 0x000000a3, 0x00080039, 0x00000015, 0x000000a4, 0x00000004, 0x00000027, 0x00000029, 0x0000009e,
+    0x00000011, 0x000200f9, 0x000000a2, 0x000200f8, 0x000000a2, 0x000200f9, 0x0000007b, 0x000200f8, 0x0000007b, 0x000200f9,
+    0x0000006d, 0x000200f8, 0x0000006d, 0x000100fd, 0x00010038, 0x00050036, 0x00000015, 0x00000004, 0x00000000, 0x0000001a,
+    0x00030037, 0x00000017, 0x00000005, 0x00030037, 0x00000017, 0x00000006, 0x00030037, 0x00000017, 0x00000007, 0x00030037,
+    0x00000017, 0x00000008, 0x000200f8, 0x000000a5, 0x00050041, 0x0000001c, 0x000000a6, 0x0000000a, 0x0000002f, 0x000700ea,
+    0x00000017, 0x000000a7, 0x000000a6, 0x00000023, 0x00000022, 0x0000002d, 0x00050080, 0x00000017, 0x000000a8, 0x000000a7,
+    0x0000002d, 0x00050044, 0x00000017, 0x000000a9, 0x0000000a, 0x00000002, 0x000500ac, 0x00000019, 0x000000aa, 0x000000a8,
+    0x000000a9, 0x000300f7, 0x000000ab, 0x00000000, 0x000400fa, 0x000000aa, 0x000000ac, 0x000000ab, 0x000200f8, 0x000000ac,
+    0x000100fd, 0x000200f8, 0x000000ab, 0x00050080, 0x00000017, 0x000000ad, 0x000000a7, 0x00000029, 0x00060041, 0x0000001c,
+    0x000000ae, 0x0000000a, 0x00000030, 0x000000ad, 0x0003003e, 0x000000ae, 0x00000005, 0x00050080, 0x00000017, 0x000000af,
+    0x000000a7, 0x0000002a, 0x00060041, 0x0000001c, 0x000000b0, 0x0000000a, 0x00000030, 0x000000af, 0x0003003e, 0x000000b0,
+    0x00000006, 0x00050080, 0x00000017, 0x000000b1, 0x000000a7, 0x0000002b, 0x00060041, 0x0000001c, 0x000000b2, 0x0000000a,
+    0x00000030, 0x000000b1, 0x0003003e, 0x000000b2, 0x00000007, 0x00050080, 0x00000017, 0x000000b3, 0x000000a7, 0x0000002c,
+    0x00060041, 0x0000001c, 0x000000b4, 0x0000000a, 0x00000030, 0x000000b3, 0x0003003e, 0x000000b4, 0x00000008, 0x000100fd,
+    0x00010038,
 };
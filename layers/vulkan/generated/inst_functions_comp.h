@@ -25,8 +25,8 @@
 ****************************************************************************/
 
 // To view SPIR-V, copy contents of array and paste in https://www.khronos.org/spir/visualizer/
-static const uint32_t inst_functions_comp[3042] = {
-    0x07230203, 0x00010000, 0x0008000b, 0x000001c8, 0x00000000, 0x00020011, 0x00000001, 0x00020011, 0x00000005, 0x00020011,
+static const uint32_t inst_functions_comp[3673] = {
+    0x07230203, 0x00010000, 0x0008000b, 0x0000022b, 0x00000000, 0x00020011, 0x00000001, 0x00020011, 0x00000005, 0x00020011,
     0x0000000b, 0x00020011, 0x000014e3, 0x0009000a, 0x5f565053, 0x5f52484b, 0x73796870, 0x6c616369, 0x6f74735f, 0x65676172,
     0x6675625f, 0x00726566, 0x000b000a, 0x5f565053, 0x5f52484b, 0x726f7473, 0x5f656761, 0x66667562, 0x735f7265, 0x61726f74,
     0x635f6567, 0x7373616c, 0x00000000, 0x0006000b, 0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e,
@@ -34,7 +34,13 @@ static const uint32_t inst_functions_comp[3042] = {
     0x6e695f72, 0x00343674, 0x00070004, 0x455f4c47, 0x625f5458, 0x65666675, 0x65725f72, 0x65726566, 0x0065636e, 0x00090004,
     0x455f4c47, 0x625f5458, 0x65666675, 0x65725f72, 0x65726566, 0x5f65636e, 0x63657675, 0x00000032, 0x000a0004, 0x475f4c47,
     0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365, 0x00006576, 0x00080004, 0x475f4c47,
-    0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572, 0x00657669, 0x000c0005, 0x0000000c, 0x74736e69, 0x7274735f,
+    0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572, 0x00657669, 0x000a0005, 0x000001a6, 0x74736e69, 0x616c635f,
+    0x725f6d69, 0x726f7065, 0x31752874, 0x3b31753b, 0x753b3175, 0x00003b31, 0x00050005, 0x000001a7, 0x64616873, 0x695f7265,
+    0x00000064, 0x00050005, 0x000001a8, 0x74736e69, 0x6d756e5f, 0x00000000, 0x00040005, 0x000001a9, 0x6f727265, 0x00000072,
+    0x00040005, 0x000001aa, 0x746f6c73, 0x00000000, 0x00080005, 0x000001ab, 0x74736e69, 0x6c65725f, 0x65736165, 0x7065725f,
+    0x2874726f, 0x003b3175, 0x00040005, 0x000001ac, 0x746f6c73, 0x00000000, 0x00030005, 0x000001ad, 0x0079656b, 0x00040005,
+    0x000001ae, 0x626f7270, 0x00000065, 0x00050005, 0x000001af, 0x76657270, 0x73756f69, 0x00000000, 0x00040005, 0x000001b0,
+    0x746f6c73, 0x00000000, 0x00040005, 0x000001b1, 0x746f6c73, 0x00000000, 0x000c0005, 0x0000000c, 0x74736e69, 0x7274735f,
     0x5f6d6165, 0x74697277, 0x28335f65, 0x753b3175, 0x75763b31, 0x31753b34, 0x3b31753b, 0x003b3175, 0x00050005, 0x00000006,
     0x64616873, 0x695f7265, 0x00000064, 0x00050005, 0x00000007, 0x74736e69, 0x6d756e5f, 0x00000000, 0x00050005, 0x00000008,
     0x67617473, 0x6e695f65, 0x00006f66, 0x00040005, 0x00000009, 0x6f727265, 0x00000072, 0x00040005, 0x0000000a, 0x72646461,
@@ -53,96 +59,144 @@ static const uint32_t inst_functions_comp[3042] = {
     0x00000030, 0x74736e69, 0x6675625f, 0x64615f66, 0x735f7264, 0x63726165, 0x6e615f68, 0x65745f64, 0x75287473, 0x31753b31,
     0x3475763b, 0x3436753b, 0x31753b31, 0x0000003b, 0x00050005, 0x0000002b, 0x64616873, 0x695f7265, 0x00000064, 0x00050005,
     0x0000002c, 0x74736e69, 0x6d756e5f, 0x00000000, 0x00050005, 0x0000002d, 0x67617473, 0x6e695f65, 0x00006f66, 0x00040005,
-    0x0000002e, 0x72646461, 0x00000000, 0x00030005, 0x0000002f, 0x006e656c, 0x00040005, 0x00000033, 0x5f636572, 0x006e656c,
-    0x00050005, 0x00000035, 0x74697277, 0x6f705f65, 0x00000073, 0x00070005, 0x00000037, 0x74736e69, 0x74754f5f, 0x42747570,
-    0x65666675, 0x00000072, 0x00050006, 0x00000037, 0x00000000, 0x67616c66, 0x00000073, 0x00070006, 0x00000037, 0x00000001,
-    0x74697277, 0x5f6e6574, 0x6e756f63, 0x00000074, 0x00050006, 0x00000037, 0x00000002, 0x61746164, 0x00000000, 0x00070005,
-    0x00000039, 0x74736e69, 0x74756f5f, 0x5f747570, 0x66667562, 0x00007265, 0x00040005, 0x00000077, 0x5f636572, 0x006e656c,
-    0x00050005, 0x00000079, 0x74697277, 0x6f705f65, 0x00000073, 0x00040005, 0x000000b3, 0x65646e69, 0x00000078, 0x00030005,
-    0x000000b6, 0x00746962, 0x00070005, 0x000000bf, 0x63736544, 0x74706972, 0x6553726f, 0x63655274, 0x0064726f, 0x00060006,
-    0x000000bf, 0x00000000, 0x6f79616c, 0x645f7475, 0x00617461, 0x00050006, 0x000000bf, 0x00000001, 0x645f6e69, 0x00617461,
-    0x00060006, 0x000000bf, 0x00000002, 0x5f74756f, 0x61746164, 0x00000000, 0x00080005, 0x000000c2, 0x63736544, 0x74706972,
-    0x614c726f, 0x74756f79, 0x61746144, 0x00000000, 0x00070006, 0x000000c2, 0x00000000, 0x5f6d756e, 0x646e6962, 0x73676e69,
-    0x00000000, 0x00040006, 0x000000c2, 0x00000001, 0x00646170, 0x00050006, 0x000000c2, 0x00000002, 0x61746164, 0x00000000,
-    0x00070005, 0x000000c4, 0x63736544, 0x74706972, 0x6553726f, 0x446e4974, 0x00617461, 0x00050006, 0x000000c4, 0x00000000,
-    0x61746164, 0x00000000, 0x00080005, 0x000000c6, 0x63736544, 0x74706972, 0x6553726f, 0x74754f74, 0x61746144, 0x00000000,
-    0x00050006, 0x000000c6, 0x00000000, 0x61746164, 0x00000000, 0x00090005, 0x000000c8, 0x74736e69, 0x6e69625f, 0x73656c64,
-    0x74535f73, 0x42657461, 0x65666675, 0x00000072, 0x00070006, 0x000000c8, 0x00000000, 0x626f6c67, 0x735f6c61, 0x65746174,
-    0x00000000, 0x00060006, 0x000000c8, 0x00000001, 0x63736564, 0x7465735f, 0x00000073, 0x00050005, 0x000000ca, 0x626f6c47,
-    0x74536c61, 0x00657461, 0x00050006, 0x000000ca, 0x00000000, 0x61746164, 0x00000000, 0x00090005, 0x000000cc, 0x74736e69,
-    0x6e69625f, 0x73656c64, 0x74735f73, 0x5f657461, 0x66667562, 0x00007265, 0x00040005, 0x000000da, 0x6f727265, 0x00000072,
-    0x00040005, 0x000000db, 0x61726170, 0x0000356d, 0x00040005, 0x000000dc, 0x61726170, 0x0000366d, 0x00040005, 0x000000dd,
-    0x63736564, 0x0064695f, 0x00050005, 0x000000e7, 0x6f79616c, 0x645f7475, 0x00617461, 0x00050005, 0x000000ec, 0x6f79616c,
-    0x765f7475, 0x00006365, 0x00060005, 0x00000102, 0x646e6962, 0x5f676e69, 0x74617473, 0x00000065, 0x00040005, 0x00000110,
-    0x645f6e69, 0x00617461, 0x00040005, 0x00000114, 0x765f6e69, 0x00006365, 0x00050005, 0x00000123, 0x74617473, 0x6e695f65,
-    0x00786564, 0x00050005, 0x0000012d, 0x63736564, 0x7079745f, 0x00000065, 0x00060005, 0x00000169, 0x6f736572, 0x65637275,
-    0x7a69735f, 0x00000065, 0x00050005, 0x00000175, 0x5f74756f, 0x61746164, 0x00000000, 0x00040005, 0x00000179, 0x5f74756f,
-    0x00636576, 0x00050005, 0x00000198, 0x72617473, 0x64695f74, 0x00000078, 0x00040005, 0x0000019d, 0x5f646e65, 0x00786469,
-    0x00090005, 0x000001a1, 0x74736e69, 0x6675625f, 0x64615f66, 0x495f7264, 0x7475706e, 0x66667542, 0x00007265, 0x00050006,
-    0x000001a1, 0x00000000, 0x61746164, 0x00000000, 0x00090005, 0x000001a3, 0x74736e69, 0x6675625f, 0x64615f66, 0x695f7264,
-    0x7475706e, 0x6675625f, 0x00726566, 0x00040005, 0x000001af, 0x65646e69, 0x00000078, 0x00090047, 0x0000000c, 0x00000029,
-    0x74736e69, 0x7274735f, 0x5f6d6165, 0x74697277, 0x00335f65, 0x00000000, 0x00040047, 0x00000036, 0x00000006, 0x00000004,
-    0x00050048, 0x00000037, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000037, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000037, 0x00000002, 0x00000023, 0x00000008, 0x00030047, 0x00000037, 0x00000002, 0x00040047, 0x00000039,
-    0x00000022, 0x00000007, 0x00040047, 0x00000039, 0x00000021, 0x00000000, 0x00090047, 0x00000018, 0x00000029, 0x74736e69,
-    0x7274735f, 0x5f6d6165, 0x74697277, 0x00365f65, 0x00000000, 0x000a0047, 0x0000001d, 0x00000029, 0x74736e69, 0x6e69625f,
-    0x73656c64, 0x73695f73, 0x696e695f, 0x00000074, 0x00000000, 0x00050048, 0x000000bf, 0x00000000, 0x00000023, 0x00000000,
-    0x00050048, 0x000000bf, 0x00000001, 0x00000023, 0x00000008, 0x00050048, 0x000000bf, 0x00000002, 0x00000023, 0x00000010,
-    0x00040047, 0x000000c1, 0x00000006, 0x00000008, 0x00050048, 0x000000c2, 0x00000000, 0x00000023, 0x00000000, 0x00050048,
-    0x000000c2, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x000000c2, 0x00000002, 0x00000023, 0x00000008, 0x00030047,
-    0x000000c2, 0x00000002, 0x00040047, 0x000000c3, 0x00000006, 0x00000008, 0x00050048, 0x000000c4, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000000c4, 0x00000002, 0x00040047, 0x000000c5, 0x00000006, 0x00000004, 0x00050048, 0x000000c6,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000c6, 0x00000002, 0x00040047, 0x000000c7, 0x00000006, 0x00000018,
-    0x00050048, 0x000000c8, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000000c8, 0x00000001, 0x00000023, 0x00000008,
-    0x00030047, 0x000000c8, 0x00000002, 0x00040047, 0x000000c9, 0x00000006, 0x00000004, 0x00050048, 0x000000ca, 0x00000000,
-    0x00000023, 0x00000000, 0x00030047, 0x000000ca, 0x00000002, 0x00040047, 0x000000cc, 0x00000022, 0x00000007, 0x00040047,
-    0x000000cc, 0x00000021, 0x00000001, 0x000b0047, 0x00000027, 0x00000029, 0x74736e69, 0x6e69625f, 0x73656c64, 0x68635f73,
-    0x5f6b6365, 0x63736564, 0x00000000, 0x00000000, 0x00030047, 0x000000e7, 0x000014ec, 0x00030047, 0x00000110, 0x000014ec,
-    0x00030047, 0x00000175, 0x000014ec, 0x000c0047, 0x00000030, 0x00000029, 0x74736e69, 0x6675625f, 0x64615f66, 0x735f7264,
-    0x63726165, 0x6e615f68, 0x65745f64, 0x00007473, 0x00000000, 0x00040047, 0x000001a0, 0x00000006, 0x00000008, 0x00050048,
-    0x000001a1, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000001a1, 0x00000002, 0x00040047, 0x000001a3, 0x00000022,
-    0x00000007, 0x00040047, 0x000001a3, 0x00000021, 0x00000002, 0x00040015, 0x00000002, 0x00000020, 0x00000000, 0x00040017,
-    0x00000003, 0x00000002, 0x00000004, 0x00020013, 0x00000004, 0x00090021, 0x00000005, 0x00000004, 0x00000002, 0x00000002,
-    0x00000003, 0x00000002, 0x00000002, 0x00000002, 0x000c0021, 0x0000000e, 0x00000004, 0x00000002, 0x00000002, 0x00000003,
-    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00020014, 0x0000001a, 0x00040021, 0x0000001b,
-    0x0000001a, 0x00000002, 0x000a0021, 0x0000001f, 0x0000001a, 0x00000002, 0x00000002, 0x00000003, 0x00000002, 0x00000002,
-    0x00000002, 0x00000002, 0x00040015, 0x00000029, 0x00000040, 0x00000000, 0x00080021, 0x0000002a, 0x0000001a, 0x00000002,
-    0x00000002, 0x00000003, 0x00000029, 0x00000002, 0x00040020, 0x00000032, 0x00000007, 0x00000002, 0x0004002b, 0x00000002,
-    0x00000034, 0x0000000a, 0x0003001d, 0x00000036, 0x00000002, 0x0005001e, 0x00000037, 0x00000002, 0x00000002, 0x00000036,
-    0x00040020, 0x00000038, 0x0000000c, 0x00000037, 0x0004003b, 0x00000038, 0x00000039, 0x0000000c, 0x00040015, 0x0000003a,
-    0x00000020, 0x00000001, 0x0004002b, 0x0000003a, 0x0000003b, 0x00000001, 0x00040020, 0x0000003c, 0x0000000c, 0x00000002,
-    0x0004002b, 0x00000002, 0x0000003f, 0x00000001, 0x0004002b, 0x00000002, 0x00000040, 0x00000000, 0x0004002b, 0x0000003a,
-    0x0000004b, 0x00000002, 0x0004002b, 0x00000002, 0x00000054, 0x00000002, 0x0004002b, 0x00000002, 0x00000058, 0x00000003,
-    0x0004002b, 0x00000002, 0x0000005d, 0x00000004, 0x0004002b, 0x00000002, 0x00000062, 0x00000005, 0x0004002b, 0x00000002,
-    0x00000067, 0x00000006, 0x0004002b, 0x00000002, 0x0000006c, 0x00000007, 0x0004002b, 0x00000002, 0x00000070, 0x00000008,
-    0x0004002b, 0x00000002, 0x00000074, 0x00000009, 0x0004002b, 0x00000002, 0x00000078, 0x0000000d, 0x0004002b, 0x00000002,
-    0x000000ac, 0x0000000b, 0x0004002b, 0x00000002, 0x000000b0, 0x0000000c, 0x0004002b, 0x00000002, 0x000000b4, 0x00000020,
-    0x0004002b, 0x00000002, 0x000000b7, 0x0000001f, 0x00030027, 0x000000bb, 0x000014e5, 0x00030027, 0x000000bc, 0x000014e5,
-    0x00030027, 0x000000bd, 0x000014e5, 0x00030027, 0x000000be, 0x000014e5, 0x0005001e, 0x000000bf, 0x000000bc, 0x000000bd,
-    0x000000be, 0x00040017, 0x000000c0, 0x00000002, 0x00000002, 0x0003001d, 0x000000c1, 0x000000c0, 0x0005001e, 0x000000c2,
-    0x00000002, 0x00000002, 0x000000c1, 0x00040020, 0x000000bc, 0x000014e5, 0x000000c2, 0x0003001d, 0x000000c3, 0x000000c0,
-    0x0003001e, 0x000000c4, 0x000000c3, 0x00040020, 0x000000bd, 0x000014e5, 0x000000c4, 0x0003001d, 0x000000c5, 0x00000002,
-    0x0003001e, 0x000000c6, 0x000000c5, 0x00040020, 0x000000be, 0x000014e5, 0x000000c6, 0x0004001c, 0x000000c7, 0x000000bf,
-    0x000000b4, 0x0004001e, 0x000000c8, 0x000000bb, 0x000000c7, 0x0003001d, 0x000000c9, 0x00000002, 0x0003001e, 0x000000ca,
-    0x000000c9, 0x00040020, 0x000000bb, 0x000014e5, 0x000000ca, 0x00040020, 0x000000cb, 0x0000000c, 0x000000c8, 0x0004003b,
-    0x000000cb, 0x000000cc, 0x0000000c, 0x0004002b, 0x0000003a, 0x000000cd, 0x00000000, 0x00040020, 0x000000ce, 0x0000000c,
-    0x000000bb, 0x00040020, 0x000000d2, 0x000014e5, 0x00000002, 0x00040020, 0x000000e6, 0x00000007, 0x000000bc, 0x00040020,
-    0x000000e8, 0x0000000c, 0x000000bc, 0x00040020, 0x000000eb, 0x00000007, 0x000000c0, 0x00040020, 0x00000104, 0x000014e5,
-    0x000000c0, 0x00040020, 0x0000010f, 0x00000007, 0x000000bd, 0x00040020, 0x00000111, 0x0000000c, 0x000000bd, 0x0004002b,
-    0x00000002, 0x0000012b, 0x00ffffff, 0x0004002b, 0x00000002, 0x00000132, 0xff000000, 0x0004002b, 0x00000002, 0x00000134,
-    0x00000018, 0x00040020, 0x00000174, 0x00000007, 0x000000be, 0x00040020, 0x00000176, 0x0000000c, 0x000000be, 0x0003002a,
-    0x0000001a, 0x0000018b, 0x00030029, 0x0000001a, 0x00000195, 0x0003001d, 0x000001a0, 0x00000029, 0x0003001e, 0x000001a1,
-    0x000001a0, 0x00040020, 0x000001a2, 0x0000000c, 0x000001a1, 0x0004003b, 0x000001a2, 0x000001a3, 0x0000000c, 0x00040020,
-    0x000001a5, 0x0000000c, 0x00000029, 0x00050036, 0x00000004, 0x0000000c, 0x00000000, 0x00000005, 0x00030037, 0x00000002,
-    0x00000006, 0x00030037, 0x00000002, 0x00000007, 0x00030037, 0x00000003, 0x00000008, 0x00030037, 0x00000002, 0x00000009,
-    0x00030037, 0x00000002, 0x0000000a, 0x00030037, 0x00000002, 0x0000000b, 0x000200f8, 0x0000000d, 0x0004003b, 0x00000032,
-    0x00000033, 0x00000007, 0x0004003b, 0x00000032, 0x00000035, 0x00000007, 0x0003003e, 0x00000033, 0x00000034, 0x00050041,
-    0x0000003c, 0x0000003d, 0x00000039, 0x0000003b, 0x0004003d, 0x00000002, 0x0000003e, 0x00000033, 0x000700ea, 0x00000002,
-    0x00000041, 0x0000003d, 0x0000003f, 0x00000040, 0x0000003e, 0x0003003e, 0x00000035, 0x00000041, 0x0004003d, 0x00000002,
-    0x00000042, 0x00000035, 0x0004003d, 0x00000002, 0x00000043, 0x00000033, 0x00050080, 0x00000002, 0x00000044, 0x00000042,
-    0x00000043, 0x00050044, 0x00000002, 0x00000045, 0x00000039, 0x00000002, 0x0004007c, 0x0000003a, 0x00000046, 0x00000045,
-    0x0004007c, 0x00000002, 0x00000047, 0x00000046, 0x000500b2, 0x0000001a, 0x00000048, 0x00000044, 0x00000047, 0x000300f7,
-    0x0000004a, 0x00000000, 0x000400fa, 0x00000048, 0x00000049, 0x0000004a, 0x000200f8, 0x00000049, 0x0004003d, 0x00000002,
+    0x0000002e, 0x72646461, 0x00000000, 0x00030005, 0x0000002f, 0x006e656c, 0x00060005, 0x000001b2, 0x676e656c, 0x6f5f6874,
+    0x65736666, 0x00000074, 0x00060005, 0x000001b3, 0x5f6d756e, 0x72646461, 0x65737365, 0x00000073, 0x00030005, 0x000001b4,
+    0x00776f6c, 0x00040005, 0x000001b5, 0x68676968, 0x00000000, 0x00030005, 0x000001b6, 0x0064696d, 0x00040005, 0x000001b7,
+    0x65646e69, 0x00000078, 0x00040005, 0x00000033, 0x5f636572, 0x006e656c, 0x00050005, 0x00000035, 0x74697277, 0x6f705f65,
+    0x00000073, 0x00070005, 0x00000037, 0x74736e69, 0x74754f5f, 0x42747570, 0x65666675, 0x00000072, 0x00050006, 0x00000037,
+    0x00000000, 0x67616c66, 0x00000073, 0x00070006, 0x00000037, 0x00000001, 0x74697277, 0x5f6e6574, 0x6e756f63, 0x00000074,
+    0x00050006, 0x00000037, 0x00000002, 0x61746164, 0x00000000, 0x00070005, 0x00000039, 0x74736e69, 0x74756f5f, 0x5f747570,
+    0x66667562, 0x00007265, 0x00070005, 0x000001b8, 0x74736e69, 0x7272455f, 0x4c73726f, 0x6567676f, 0x00000064, 0x00050006,
+    0x000001b8, 0x00000000, 0x67676f6c, 0x00006465, 0x00060006, 0x000001b8, 0x00000001, 0x6f706572, 0x64657472, 0x00000000,
+    0x00070005, 0x000001b9, 0x74736e69, 0x7272655f, 0x5f73726f, 0x67676f6c, 0x00006465, 0x00040005, 0x00000077, 0x5f636572,
+    0x006e656c, 0x00050005, 0x00000079, 0x74697277, 0x6f705f65, 0x00000073, 0x00040005, 0x000000b3, 0x65646e69, 0x00000078,
+    0x00030005, 0x000000b6, 0x00746962, 0x00070005, 0x000000bf, 0x63736544, 0x74706972, 0x6553726f, 0x63655274, 0x0064726f,
+    0x00060006, 0x000000bf, 0x00000000, 0x6f79616c, 0x645f7475, 0x00617461, 0x00050006, 0x000000bf, 0x00000001, 0x645f6e69,
+    0x00617461, 0x00060006, 0x000000bf, 0x00000002, 0x5f74756f, 0x61746164, 0x00000000, 0x00080005, 0x000000c2, 0x63736544,
+    0x74706972, 0x614c726f, 0x74756f79, 0x61746144, 0x00000000, 0x00070006, 0x000000c2, 0x00000000, 0x5f6d756e, 0x646e6962,
+    0x73676e69, 0x00000000, 0x00040006, 0x000000c2, 0x00000001, 0x00646170, 0x00050006, 0x000000c2, 0x00000002, 0x61746164,
+    0x00000000, 0x00070005, 0x000000c4, 0x63736544, 0x74706972, 0x6553726f, 0x446e4974, 0x00617461, 0x00050006, 0x000000c4,
+    0x00000000, 0x61746164, 0x00000000, 0x00080005, 0x000000c6, 0x63736544, 0x74706972, 0x6553726f, 0x74754f74, 0x61746144,
+    0x00000000, 0x00050006, 0x000000c6, 0x00000000, 0x61746164, 0x00000000, 0x00090005, 0x000000c8, 0x74736e69, 0x6e69625f,
+    0x73656c64, 0x74535f73, 0x42657461, 0x65666675, 0x00000072, 0x00070006, 0x000000c8, 0x00000000, 0x626f6c67, 0x735f6c61,
+    0x65746174, 0x00000000, 0x00060006, 0x000000c8, 0x00000001, 0x63736564, 0x7465735f, 0x00000073, 0x00050005, 0x000000ca,
+    0x626f6c47, 0x74536c61, 0x00657461, 0x00050006, 0x000000ca, 0x00000000, 0x61746164, 0x00000000, 0x00090005, 0x000000cc,
+    0x74736e69, 0x6e69625f, 0x73656c64, 0x74735f73, 0x5f657461, 0x66667562, 0x00007265, 0x00040005, 0x000000da, 0x6f727265,
+    0x00000072, 0x00040005, 0x000000db, 0x61726170, 0x0000356d, 0x00040005, 0x000000dc, 0x61726170, 0x0000366d, 0x00040005,
+    0x000000dd, 0x63736564, 0x0064695f, 0x00050005, 0x000000e7, 0x6f79616c, 0x645f7475, 0x00617461, 0x00050005, 0x000000ec,
+    0x6f79616c, 0x765f7475, 0x00006365, 0x00060005, 0x00000102, 0x646e6962, 0x5f676e69, 0x74617473, 0x00000065, 0x00040005,
+    0x00000110, 0x645f6e69, 0x00617461, 0x00040005, 0x00000114, 0x765f6e69, 0x00006365, 0x00050005, 0x00000123, 0x74617473,
+    0x6e695f65, 0x00786564, 0x00050005, 0x0000012d, 0x63736564, 0x7079745f, 0x00000065, 0x00060005, 0x00000169, 0x6f736572,
+    0x65637275, 0x7a69735f, 0x00000065, 0x00050005, 0x00000175, 0x5f74756f, 0x61746164, 0x00000000, 0x00040005, 0x00000179,
+    0x5f74756f, 0x00636576, 0x00090005, 0x000001a1, 0x74736e69, 0x6675625f, 0x64615f66, 0x495f7264, 0x7475706e, 0x66667542,
+    0x00007265, 0x00050006, 0x000001a1, 0x00000000, 0x61746164, 0x00000000, 0x00090005, 0x000001a3, 0x74736e69, 0x6675625f,
+    0x64615f66, 0x695f7264, 0x7475706e, 0x6675625f, 0x00726566, 0x00090047, 0x0000000c, 0x00000029, 0x74736e69, 0x7274735f,
+    0x5f6d6165, 0x74697277, 0x00335f65, 0x00000000, 0x00090047, 0x000001a6, 0x00000029, 0x74736e69, 0x616c635f, 0x725f6d69,
+    0x726f7065, 0x00000074, 0x00000000, 0x00090047, 0x000001ab, 0x00000029, 0x74736e69, 0x6c65725f, 0x65736165, 0x7065725f,
+    0x0074726f, 0x00000000, 0x00040047, 0x00000036, 0x00000006, 0x00000004, 0x00050048, 0x00000037, 0x00000000, 0x00000023,
+    0x00000000, 0x00050048, 0x00000037, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000037, 0x00000002, 0x00000023,
+    0x00000008, 0x00030047, 0x00000037, 0x00000002, 0x00040047, 0x00000039, 0x00000022, 0x00000007, 0x00040047, 0x00000039,
+    0x00000021, 0x00000000, 0x00090047, 0x00000018, 0x00000029, 0x74736e69, 0x7274735f, 0x5f6d6165, 0x74697277, 0x00365f65,
+    0x00000000, 0x000a0047, 0x0000001d, 0x00000029, 0x74736e69, 0x6e69625f, 0x73656c64, 0x73695f73, 0x696e695f, 0x00000074,
+    0x00000000, 0x00050048, 0x000000bf, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000000bf, 0x00000001, 0x00000023,
+    0x00000008, 0x00050048, 0x000000bf, 0x00000002, 0x00000023, 0x00000010, 0x00040047, 0x000000c1, 0x00000006, 0x00000008,
+    0x00050048, 0x000000c2, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000000c2, 0x00000001, 0x00000023, 0x00000004,
+    0x00050048, 0x000000c2, 0x00000002, 0x00000023, 0x00000008, 0x00030047, 0x000000c2, 0x00000002, 0x00040047, 0x000000c3,
+    0x00000006, 0x00000008, 0x00050048, 0x000000c4, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000c4, 0x00000002,
+    0x00040047, 0x000000c5, 0x00000006, 0x00000004, 0x00050048, 0x000000c6, 0x00000000, 0x00000023, 0x00000000, 0x00030047,
+    0x000000c6, 0x00000002, 0x00040047, 0x000000c7, 0x00000006, 0x00000018, 0x00050048, 0x000000c8, 0x00000000, 0x00000023,
+    0x00000000, 0x00050048, 0x000000c8, 0x00000001, 0x00000023, 0x00000008, 0x00030047, 0x000000c8, 0x00000002, 0x00040047,
+    0x000000c9, 0x00000006, 0x00000004, 0x00050048, 0x000000ca, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000ca,
+    0x00000002, 0x00040047, 0x000000cc, 0x00000022, 0x00000007, 0x00040047, 0x000000cc, 0x00000021, 0x00000001, 0x000b0047,
+    0x00000027, 0x00000029, 0x74736e69, 0x6e69625f, 0x73656c64, 0x68635f73, 0x5f6b6365, 0x63736564, 0x00000000, 0x00000000,
+    0x00030047, 0x000000e7, 0x000014ec, 0x00030047, 0x00000110, 0x000014ec, 0x00030047, 0x00000175, 0x000014ec, 0x000c0047,
+    0x00000030, 0x00000029, 0x74736e69, 0x6675625f, 0x64615f66, 0x735f7264, 0x63726165, 0x6e615f68, 0x65745f64, 0x00007473,
+    0x00000000, 0x00040047, 0x000001a0, 0x00000006, 0x00000008, 0x00050048, 0x000001a1, 0x00000000, 0x00000023, 0x00000000,
+    0x00030047, 0x000001a1, 0x00000002, 0x00040047, 0x000001a3, 0x00000022, 0x00000007, 0x00040047, 0x000001a3, 0x00000021,
+    0x00000002, 0x00040047, 0x000001ba, 0x00000006, 0x00000004, 0x00050048, 0x000001b8, 0x00000000, 0x00000023, 0x00000000,
+    0x00050048, 0x000001b8, 0x00000001, 0x00000023, 0x00000004, 0x00030047, 0x000001b8, 0x00000002, 0x00040047, 0x000001b9,
+    0x00000022, 0x00000007, 0x00040047, 0x000001b9, 0x00000021, 0x00000003, 0x00040015, 0x00000002, 0x00000020, 0x00000000,
+    0x00040017, 0x00000003, 0x00000002, 0x00000004, 0x00020013, 0x00000004, 0x00090021, 0x00000005, 0x00000004, 0x00000002,
+    0x00000002, 0x00000003, 0x00000002, 0x00000002, 0x00000002, 0x000c0021, 0x0000000e, 0x00000004, 0x00000002, 0x00000002,
+    0x00000003, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00020014, 0x0000001a, 0x00040021,
+    0x0000001b, 0x0000001a, 0x00000002, 0x000a0021, 0x0000001f, 0x0000001a, 0x00000002, 0x00000002, 0x00000003, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00040015, 0x00000029, 0x00000040, 0x00000000, 0x00080021, 0x0000002a, 0x0000001a,
+    0x00000002, 0x00000002, 0x00000003, 0x00000029, 0x00000002, 0x00040020, 0x00000032, 0x00000007, 0x00000002, 0x0004002b,
+    0x00000002, 0x00000034, 0x0000000a, 0x0003001d, 0x00000036, 0x00000002, 0x0005001e, 0x00000037, 0x00000002, 0x00000002,
+    0x00000036, 0x00040020, 0x00000038, 0x0000000c, 0x00000037, 0x0004003b, 0x00000038, 0x00000039, 0x0000000c, 0x00040015,
+    0x0000003a, 0x00000020, 0x00000001, 0x0004002b, 0x0000003a, 0x0000003b, 0x00000001, 0x00040020, 0x0000003c, 0x0000000c,
+    0x00000002, 0x0004002b, 0x00000002, 0x0000003f, 0x00000001, 0x0004002b, 0x00000002, 0x00000040, 0x00000000, 0x0004002b,
+    0x0000003a, 0x0000004b, 0x00000002, 0x0004002b, 0x00000002, 0x00000054, 0x00000002, 0x0004002b, 0x00000002, 0x00000058,
+    0x00000003, 0x0004002b, 0x00000002, 0x0000005d, 0x00000004, 0x0004002b, 0x00000002, 0x00000062, 0x00000005, 0x0004002b,
+    0x00000002, 0x00000067, 0x00000006, 0x0004002b, 0x00000002, 0x0000006c, 0x00000007, 0x0004002b, 0x00000002, 0x00000070,
+    0x00000008, 0x0004002b, 0x00000002, 0x00000074, 0x00000009, 0x0004002b, 0x00000002, 0x00000078, 0x0000000d, 0x0004002b,
+    0x00000002, 0x000000ac, 0x0000000b, 0x0004002b, 0x00000002, 0x000000b0, 0x0000000c, 0x0004002b, 0x00000002, 0x000000b4,
+    0x00000020, 0x0004002b, 0x00000002, 0x000000b7, 0x0000001f, 0x00030027, 0x000000bb, 0x000014e5, 0x00030027, 0x000000bc,
+    0x000014e5, 0x00030027, 0x000000bd, 0x000014e5, 0x00030027, 0x000000be, 0x000014e5, 0x0005001e, 0x000000bf, 0x000000bc,
+    0x000000bd, 0x000000be, 0x00040017, 0x000000c0, 0x00000002, 0x00000002, 0x0003001d, 0x000000c1, 0x000000c0, 0x0005001e,
+    0x000000c2, 0x00000002, 0x00000002, 0x000000c1, 0x00040020, 0x000000bc, 0x000014e5, 0x000000c2, 0x0003001d, 0x000000c3,
+    0x000000c0, 0x0003001e, 0x000000c4, 0x000000c3, 0x00040020, 0x000000bd, 0x000014e5, 0x000000c4, 0x0003001d, 0x000000c5,
+    0x00000002, 0x0003001e, 0x000000c6, 0x000000c5, 0x00040020, 0x000000be, 0x000014e5, 0x000000c6, 0x0004001c, 0x000000c7,
+    0x000000bf, 0x000000b4, 0x0004001e, 0x000000c8, 0x000000bb, 0x000000c7, 0x0003001d, 0x000000c9, 0x00000002, 0x0003001e,
+    0x000000ca, 0x000000c9, 0x00040020, 0x000000bb, 0x000014e5, 0x000000ca, 0x00040020, 0x000000cb, 0x0000000c, 0x000000c8,
+    0x0004003b, 0x000000cb, 0x000000cc, 0x0000000c, 0x0004002b, 0x0000003a, 0x000000cd, 0x00000000, 0x00040020, 0x000000ce,
+    0x0000000c, 0x000000bb, 0x00040020, 0x000000d2, 0x000014e5, 0x00000002, 0x00040020, 0x000000e6, 0x00000007, 0x000000bc,
+    0x00040020, 0x000000e8, 0x0000000c, 0x000000bc, 0x00040020, 0x000000eb, 0x00000007, 0x000000c0, 0x00040020, 0x00000104,
+    0x000014e5, 0x000000c0, 0x00040020, 0x0000010f, 0x00000007, 0x000000bd, 0x00040020, 0x00000111, 0x0000000c, 0x000000bd,
+    0x0004002b, 0x00000002, 0x0000012b, 0x00ffffff, 0x0004002b, 0x00000002, 0x00000132, 0xff000000, 0x0004002b, 0x00000002,
+    0x00000134, 0x00000018, 0x00040020, 0x00000174, 0x00000007, 0x000000be, 0x00040020, 0x00000176, 0x0000000c, 0x000000be,
+    0x0003002a, 0x0000001a, 0x0000018b, 0x00030029, 0x0000001a, 0x00000195, 0x0003001d, 0x000001a0, 0x00000029, 0x0003001e,
+    0x000001a1, 0x000001a0, 0x00040020, 0x000001a2, 0x0000000c, 0x000001a1, 0x0004003b, 0x000001a2, 0x000001a3, 0x0000000c,
+    0x00040020, 0x000001a5, 0x0000000c, 0x00000029, 0x0004002b, 0x00000002, 0x000001bb, 0x00000040, 0x0004001c, 0x000001ba,
+    0x00000002, 0x000001bb, 0x0004001e, 0x000001b8, 0x00000002, 0x000001ba, 0x00040020, 0x000001bc, 0x0000000c, 0x000001b8,
+    0x0004003b, 0x000001bc, 0x000001b9, 0x0000000c, 0x0004002b, 0x00000002, 0x000001bd, 0x0000003f, 0x0004002b, 0x00000002,
+    0x000001be, 0x9e3779b1, 0x0004002b, 0x00000002, 0x000001bf, 0x85ebca77, 0x0004002b, 0x00000002, 0x000001c0, 0xc2b2ae3d,
+    0x00070021, 0x000001c1, 0x0000001a, 0x00000002, 0x00000002, 0x00000002, 0x00000032, 0x00040021, 0x000001c2, 0x00000004,
+    0x00000002, 0x00050036, 0x0000001a, 0x000001a6, 0x00000000, 0x000001c1, 0x00030037, 0x00000002, 0x000001a7, 0x00030037,
+    0x00000002, 0x000001a8, 0x00030037, 0x00000002, 0x000001a9, 0x00030037, 0x00000032, 0x000001aa, 0x000200f8, 0x000001c3,
+    0x0004003b, 0x00000032, 0x000001ad, 0x00000007, 0x0004003b, 0x00000032, 0x000001ae, 0x00000007, 0x00050084, 0x00000002,
+    0x000001c4, 0x000001a7, 0x000001be, 0x00050084, 0x00000002, 0x000001c5, 0x000001a8, 0x000001bf, 0x000500c6, 0x00000002,
+    0x000001c6, 0x000001c4, 0x000001c5, 0x00050084, 0x00000002, 0x000001c7, 0x000001a9, 0x000001c0, 0x000500c6, 0x00000002,
+    0x000001c8, 0x000001c6, 0x000001c7, 0x0003003e, 0x000001ad, 0x000001c8, 0x000500aa, 0x0000001a, 0x000001c9, 0x000001c8,
+    0x00000040, 0x000300f7, 0x000001ca, 0x00000000, 0x000400fa, 0x000001c9, 0x000001cb, 0x000001ca, 0x000200f8, 0x000001cb,
+    0x0003003e, 0x000001ad, 0x0000003f, 0x000200f9, 0x000001ca, 0x000200f8, 0x000001ca, 0x0004003d, 0x00000002, 0x000001cc,
+    0x000001ad, 0x000500c7, 0x00000002, 0x000001cd, 0x000001cc, 0x000001bd, 0x0003003e, 0x000001aa, 0x000001cd, 0x0003003e,
+    0x000001ae, 0x00000040, 0x000200f9, 0x000001ce, 0x000200f8, 0x000001ce, 0x000400f6, 0x000001cf, 0x000001d0, 0x00000000,
+    0x000200f9, 0x000001d1, 0x000200f8, 0x000001d1, 0x0004003d, 0x00000002, 0x000001d2, 0x000001ae, 0x000500b0, 0x0000001a,
+    0x000001d3, 0x000001d2, 0x0000005d, 0x000400fa, 0x000001d3, 0x000001d4, 0x000001cf, 0x000200f8, 0x000001d4, 0x0004003d,
+    0x00000002, 0x000001d5, 0x000001aa, 0x00060041, 0x0000003c, 0x000001d6, 0x000001b9, 0x0000003b, 0x000001d5, 0x0004003d,
+    0x00000002, 0x000001d7, 0x000001d6, 0x0004003d, 0x00000002, 0x000001d8, 0x000001ad, 0x000500aa, 0x0000001a, 0x000001d9,
+    0x000001d7, 0x000001d8, 0x000300f7, 0x000001da, 0x00000000, 0x000400fa, 0x000001d9, 0x000001db, 0x000001da, 0x000200f8,
+    0x000001db, 0x000200fe, 0x0000018b, 0x000200f8, 0x000001da, 0x0004003d, 0x00000002, 0x000001dc, 0x000001aa, 0x00060041,
+    0x0000003c, 0x000001dd, 0x000001b9, 0x0000003b, 0x000001dc, 0x0004003d, 0x00000002, 0x000001de, 0x000001ad, 0x000900e6,
+    0x00000002, 0x000001af, 0x000001dd, 0x0000003f, 0x00000040, 0x00000040, 0x000001de, 0x00000040, 0x000500aa, 0x0000001a,
+    0x000001df, 0x000001af, 0x00000040, 0x000300f7, 0x000001e0, 0x00000000, 0x000400fa, 0x000001df, 0x000001e1, 0x000001e0,
+    0x000200f8, 0x000001e1, 0x000200fe, 0x00000195, 0x000200f8, 0x000001e0, 0x0004003d, 0x00000002, 0x000001e2, 0x000001ad,
+    0x000500aa, 0x0000001a, 0x000001e3, 0x000001af, 0x000001e2, 0x000300f7, 0x000001e4, 0x00000000, 0x000400fa, 0x000001e3,
+    0x000001e5, 0x000001e4, 0x000200f8, 0x000001e5, 0x000200fe, 0x0000018b, 0x000200f8, 0x000001e4, 0x0004003d, 0x00000002,
+    0x000001e6, 0x000001aa, 0x00050080, 0x00000002, 0x000001e7, 0x000001e6, 0x0000003f, 0x000500c7, 0x00000002, 0x000001e8,
+    0x000001e7, 0x000001bd, 0x0003003e, 0x000001aa, 0x000001e8, 0x000200f9, 0x000001d0, 0x000200f8, 0x000001d0, 0x0004003d,
+    0x00000002, 0x000001e9, 0x000001ae, 0x00050080, 0x00000002, 0x000001ea, 0x000001e9, 0x0000003f, 0x0003003e, 0x000001ae,
+    0x000001ea, 0x000200f9, 0x000001ce, 0x000200f8, 0x000001cf, 0x0003003e, 0x000001aa, 0x000001bb, 0x000200fe, 0x00000195,
+    0x00010038, 0x00050036, 0x00000004, 0x000001ab, 0x00000000, 0x000001c2, 0x00030037, 0x00000002, 0x000001ac, 0x000200f8,
+    0x000001eb, 0x000500b0, 0x0000001a, 0x000001ec, 0x000001ac, 0x000001bb, 0x000300f7, 0x000001ed, 0x00000000, 0x000400fa,
+    0x000001ec, 0x000001ee, 0x000001ed, 0x000200f8, 0x000001ee, 0x00060041, 0x0000003c, 0x000001ef, 0x000001b9, 0x0000003b,
+    0x000001ac, 0x000700e5, 0x00000002, 0x000001f0, 0x000001ef, 0x0000003f, 0x00000040, 0x00000040, 0x000200f9, 0x000001ed,
+    0x000200f8, 0x000001ed, 0x000100fd, 0x00010038, 0x00050036, 0x00000004, 0x0000000c, 0x00000000, 0x00000005, 0x00030037,
+    0x00000002, 0x00000006, 0x00030037, 0x00000002, 0x00000007, 0x00030037, 0x00000003, 0x00000008, 0x00030037, 0x00000002,
+    0x00000009, 0x00030037, 0x00000002, 0x0000000a, 0x00030037, 0x00000002, 0x0000000b, 0x000200f8, 0x0000000d, 0x0004003b,
+    0x00000032, 0x00000033, 0x00000007, 0x0004003b, 0x00000032, 0x00000035, 0x00000007, 0x0004003b, 0x00000032, 0x000001b0,
+    0x00000007, 0x00080039, 0x0000001a, 0x000001f1, 0x000001a6, 0x00000006, 0x00000007, 0x00000009, 0x000001b0, 0x000400a8,
+    0x0000001a, 0x000001f2, 0x000001f1, 0x000300f7, 0x000001f3, 0x00000000, 0x000400fa, 0x000001f2, 0x000001f4, 0x000001f3,
+    0x000200f8, 0x000001f4, 0x000100fd, 0x000200f8, 0x000001f3, 0x0003003e, 0x00000033, 0x00000034, 0x00050041, 0x0000003c,
+    0x000001f5, 0x000001b9, 0x000000cd, 0x0003003e, 0x000001f5, 0x0000003f, 0x00050041, 0x0000003c, 0x0000003d, 0x00000039,
+    0x0000003b, 0x0004003d, 0x00000002, 0x0000003e, 0x00000033, 0x000700ea, 0x00000002, 0x00000041, 0x0000003d, 0x0000003f,
+    0x00000040, 0x0000003e, 0x0003003e, 0x00000035, 0x00000041, 0x0004003d, 0x00000002, 0x00000042, 0x00000035, 0x0004003d,
+    0x00000002, 0x00000043, 0x00000033, 0x00050080, 0x00000002, 0x00000044, 0x00000042, 0x00000043, 0x00050044, 0x00000002,
+    0x00000045, 0x00000039, 0x00000002, 0x0004007c, 0x0000003a, 0x00000046, 0x00000045, 0x0004007c, 0x00000002, 0x00000047,
+    0x00000046, 0x000500b2, 0x0000001a, 0x00000048, 0x00000044, 0x00000047, 0x000300f7, 0x0000004a, 0x00000000, 0x000400fa,
+    0x00000048, 0x00000049, 0x000001f6, 0x000200f8, 0x000001f6, 0x0004003d, 0x00000002, 0x000001f7, 0x000001b0, 0x00050039,
+    0x00000004, 0x000001f8, 0x000001ab, 0x000001f7, 0x000200f9, 0x0000004a, 0x000200f8, 0x00000049, 0x0004003d, 0x00000002,
     0x0000004c, 0x00000035, 0x0004003d, 0x00000002, 0x0000004e, 0x00000033, 0x00060041, 0x0000003c, 0x0000004f, 0x00000039,
     0x0000004b, 0x0000004c, 0x0003003e, 0x0000004f, 0x0000004e, 0x0004003d, 0x00000002, 0x00000050, 0x00000035, 0x00050080,
     0x00000002, 0x00000051, 0x00000050, 0x0000003f, 0x00060041, 0x0000003c, 0x00000052, 0x00000039, 0x0000004b, 0x00000051,
@@ -167,168 +221,177 @@ static const uint32_t inst_functions_comp[3042] = {
     0x0000000f, 0x00030037, 0x00000002, 0x00000010, 0x00030037, 0x00000003, 0x00000011, 0x00030037, 0x00000002, 0x00000012,
     0x00030037, 0x00000002, 0x00000013, 0x00030037, 0x00000002, 0x00000014, 0x00030037, 0x00000002, 0x00000015, 0x00030037,
     0x00000002, 0x00000016, 0x00030037, 0x00000002, 0x00000017, 0x000200f8, 0x00000019, 0x0004003b, 0x00000032, 0x00000077,
-    0x00000007, 0x0004003b, 0x00000032, 0x00000079, 0x00000007, 0x0003003e, 0x00000077, 0x00000078, 0x00050041, 0x0000003c,
-    0x0000007a, 0x00000039, 0x0000003b, 0x0004003d, 0x00000002, 0x0000007b, 0x00000077, 0x000700ea, 0x00000002, 0x0000007c,
-    0x0000007a, 0x0000003f, 0x00000040, 0x0000007b, 0x0003003e, 0x00000079, 0x0000007c, 0x0004003d, 0x00000002, 0x0000007d,
-    0x00000079, 0x0004003d, 0x00000002, 0x0000007e, 0x00000077, 0x00050080, 0x00000002, 0x0000007f, 0x0000007d, 0x0000007e,
-    0x00050044, 0x00000002, 0x00000080, 0x00000039, 0x00000002, 0x0004007c, 0x0000003a, 0x00000081, 0x00000080, 0x0004007c,
-    0x00000002, 0x00000082, 0x00000081, 0x000500b2, 0x0000001a, 0x00000083, 0x0000007f, 0x00000082, 0x000300f7, 0x00000085,
-    0x00000000, 0x000400fa, 0x00000083, 0x00000084, 0x00000085, 0x000200f8, 0x00000084, 0x0004003d, 0x00000002, 0x00000086,
-    0x00000079, 0x0004003d, 0x00000002, 0x00000087, 0x00000077, 0x00060041, 0x0000003c, 0x00000088, 0x00000039, 0x0000004b,
-    0x00000086, 0x0003003e, 0x00000088, 0x00000087, 0x0004003d, 0x00000002, 0x00000089, 0x00000079, 0x00050080, 0x00000002,
-    0x0000008a, 0x00000089, 0x0000003f, 0x00060041, 0x0000003c, 0x0000008b, 0x00000039, 0x0000004b, 0x0000008a, 0x0003003e,
-    0x0000008b, 0x0000000f, 0x0004003d, 0x00000002, 0x0000008c, 0x00000079, 0x00050080, 0x00000002, 0x0000008d, 0x0000008c,
-    0x00000054, 0x00060041, 0x0000003c, 0x0000008e, 0x00000039, 0x0000004b, 0x0000008d, 0x0003003e, 0x0000008e, 0x00000010,
-    0x0004003d, 0x00000002, 0x0000008f, 0x00000079, 0x00050080, 0x00000002, 0x00000090, 0x0000008f, 0x00000058, 0x00050051,
-    0x00000002, 0x00000091, 0x00000011, 0x00000000, 0x00060041, 0x0000003c, 0x00000092, 0x00000039, 0x0000004b, 0x00000090,
-    0x0003003e, 0x00000092, 0x00000091, 0x0004003d, 0x00000002, 0x00000093, 0x00000079, 0x00050080, 0x00000002, 0x00000094,
-    0x00000093, 0x0000005d, 0x00050051, 0x00000002, 0x00000095, 0x00000011, 0x00000001, 0x00060041, 0x0000003c, 0x00000096,
-    0x00000039, 0x0000004b, 0x00000094, 0x0003003e, 0x00000096, 0x00000095, 0x0004003d, 0x00000002, 0x00000097, 0x00000079,
-    0x00050080, 0x00000002, 0x00000098, 0x00000097, 0x00000062, 0x00050051, 0x00000002, 0x00000099, 0x00000011, 0x00000002,
-    0x00060041, 0x0000003c, 0x0000009a, 0x00000039, 0x0000004b, 0x00000098, 0x0003003e, 0x0000009a, 0x00000099, 0x0004003d,
-    0x00000002, 0x0000009b, 0x00000079, 0x00050080, 0x00000002, 0x0000009c, 0x0000009b, 0x00000067, 0x00050051, 0x00000002,
-    0x0000009d, 0x00000011, 0x00000003, 0x00060041, 0x0000003c, 0x0000009e, 0x00000039, 0x0000004b, 0x0000009c, 0x0003003e,
-    0x0000009e, 0x0000009d, 0x0004003d, 0x00000002, 0x0000009f, 0x00000079, 0x00050080, 0x00000002, 0x000000a0, 0x0000009f,
-    0x0000006c, 0x00060041, 0x0000003c, 0x000000a1, 0x00000039, 0x0000004b, 0x000000a0, 0x0003003e, 0x000000a1, 0x00000012,
-    0x0004003d, 0x00000002, 0x000000a2, 0x00000079, 0x00050080, 0x00000002, 0x000000a3, 0x000000a2, 0x00000070, 0x00060041,
-    0x0000003c, 0x000000a4, 0x00000039, 0x0000004b, 0x000000a3, 0x0003003e, 0x000000a4, 0x00000013, 0x0004003d, 0x00000002,
-    0x000000a5, 0x00000079, 0x00050080, 0x00000002, 0x000000a6, 0x000000a5, 0x00000074, 0x00060041, 0x0000003c, 0x000000a7,
-    0x00000039, 0x0000004b, 0x000000a6, 0x0003003e, 0x000000a7, 0x00000014, 0x0004003d, 0x00000002, 0x000000a8, 0x00000079,
-    0x00050080, 0x00000002, 0x000000a9, 0x000000a8, 0x00000034, 0x00060041, 0x0000003c, 0x000000aa, 0x00000039, 0x0000004b,
-    0x000000a9, 0x0003003e, 0x000000aa, 0x00000015, 0x0004003d, 0x00000002, 0x000000ab, 0x00000079, 0x00050080, 0x00000002,
-    0x000000ad, 0x000000ab, 0x000000ac, 0x00060041, 0x0000003c, 0x000000ae, 0x00000039, 0x0000004b, 0x000000ad, 0x0003003e,
-    0x000000ae, 0x00000016, 0x0004003d, 0x00000002, 0x000000af, 0x00000079, 0x00050080, 0x00000002, 0x000000b1, 0x000000af,
-    0x000000b0, 0x00060041, 0x0000003c, 0x000000b2, 0x00000039, 0x0000004b, 0x000000b1, 0x0003003e, 0x000000b2, 0x00000017,
-    0x000200f9, 0x00000085, 0x000200f8, 0x00000085, 0x000100fd, 0x00010038, 0x00050036, 0x0000001a, 0x0000001d, 0x00000000,
-    0x0000001b, 0x00030037, 0x00000002, 0x0000001c, 0x000200f8, 0x0000001e, 0x0004003b, 0x00000032, 0x000000b3, 0x00000007,
-    0x0004003b, 0x00000032, 0x000000b6, 0x00000007, 0x00050086, 0x00000002, 0x000000b5, 0x0000001c, 0x000000b4, 0x0003003e,
-    0x000000b3, 0x000000b5, 0x000500c7, 0x00000002, 0x000000b8, 0x0000001c, 0x000000b7, 0x000500c4, 0x0000003a, 0x000000b9,
-    0x0000003b, 0x000000b8, 0x0004007c, 0x00000002, 0x000000ba, 0x000000b9, 0x0003003e, 0x000000b6, 0x000000ba, 0x00050041,
-    0x000000ce, 0x000000cf, 0x000000cc, 0x000000cd, 0x0004003d, 0x000000bb, 0x000000d0, 0x000000cf, 0x0004003d, 0x00000002,
-    0x000000d1, 0x000000b3, 0x00060041, 0x000000d2, 0x000000d3, 0x000000d0, 0x000000cd, 0x000000d1, 0x0006003d, 0x00000002,
-    0x000000d4, 0x000000d3, 0x00000002, 0x00000004, 0x0004003d, 0x00000002, 0x000000d5, 0x000000b6, 0x000500c7, 0x00000002,
-    0x000000d6, 0x000000d4, 0x000000d5, 0x000500ab, 0x0000001a, 0x000000d7, 0x000000d6, 0x00000040, 0x000200fe, 0x000000d7,
-    0x00010038, 0x00050036, 0x0000001a, 0x00000027, 0x00000000, 0x0000001f, 0x00030037, 0x00000002, 0x00000020, 0x00030037,
-    0x00000002, 0x00000021, 0x00030037, 0x00000003, 0x00000022, 0x00030037, 0x00000002, 0x00000023, 0x00030037, 0x00000002,
-    0x00000024, 0x00030037, 0x00000002, 0x00000025, 0x00030037, 0x00000002, 0x00000026, 0x000200f8, 0x00000028, 0x0004003b,
-    0x00000032, 0x000000da, 0x00000007, 0x0004003b, 0x00000032, 0x000000db, 0x00000007, 0x0004003b, 0x00000032, 0x000000dc,
-    0x00000007, 0x0004003b, 0x00000032, 0x000000dd, 0x00000007, 0x0004003b, 0x000000e6, 0x000000e7, 0x00000007, 0x0004003b,
-    0x000000eb, 0x000000ec, 0x00000007, 0x0004003b, 0x000000eb, 0x00000102, 0x00000007, 0x0004003b, 0x0000010f, 0x00000110,
-    0x00000007, 0x0004003b, 0x000000eb, 0x00000114, 0x00000007, 0x0004003b, 0x00000032, 0x00000123, 0x00000007, 0x0004003b,
-    0x00000032, 0x0000012d, 0x00000007, 0x0004003b, 0x00000032, 0x00000169, 0x00000007, 0x0004003b, 0x00000174, 0x00000175,
-    0x00000007, 0x0004003b, 0x000000eb, 0x00000179, 0x00000007, 0x0003003e, 0x000000da, 0x00000040, 0x0003003e, 0x000000db,
-    0x00000040, 0x0003003e, 0x000000dc, 0x00000040, 0x0003003e, 0x000000dd, 0x00000040, 0x000200f9, 0x000000de, 0x000200f8,
-    0x000000de, 0x000400f6, 0x000000e0, 0x000000e1, 0x00000000, 0x000200f9, 0x000000df, 0x000200f8, 0x000000df, 0x000500ae,
-    0x0000001a, 0x000000e2, 0x00000023, 0x000000b4, 0x000300f7, 0x000000e4, 0x00000000, 0x000400fa, 0x000000e2, 0x000000e3,
-    0x000000e4, 0x000200f8, 0x000000e3, 0x0003003e, 0x000000da, 0x0000003f, 0x0003003e, 0x000000db, 0x00000023, 0x000200f9,
-    0x000000e0, 0x000200f8, 0x000000e4, 0x00070041, 0x000000e8, 0x000000e9, 0x000000cc, 0x0000003b, 0x00000023, 0x000000cd,
-    0x0004003d, 0x000000bc, 0x000000ea, 0x000000e9, 0x0003003e, 0x000000e7, 0x000000ea, 0x0004003d, 0x000000bc, 0x000000ed,
-    0x000000e7, 0x0004007c, 0x000000c0, 0x000000ee, 0x000000ed, 0x0003003e, 0x000000ec, 0x000000ee, 0x00050041, 0x00000032,
-    0x000000ef, 0x000000ec, 0x00000040, 0x0004003d, 0x00000002, 0x000000f0, 0x000000ef, 0x000500aa, 0x0000001a, 0x000000f1,
-    0x000000f0, 0x00000040, 0x000300f7, 0x000000f3, 0x00000000, 0x000400fa, 0x000000f1, 0x000000f2, 0x000000f3, 0x000200f8,
-    0x000000f2, 0x00050041, 0x00000032, 0x000000f4, 0x000000ec, 0x0000003f, 0x0004003d, 0x00000002, 0x000000f5, 0x000000f4,
-    0x000500aa, 0x0000001a, 0x000000f6, 0x000000f5, 0x00000040, 0x000200f9, 0x000000f3, 0x000200f8, 0x000000f3, 0x000700f5,
-    0x0000001a, 0x000000f7, 0x000000f1, 0x000000e4, 0x000000f6, 0x000000f2, 0x000300f7, 0x000000f9, 0x00000000, 0x000400fa,
-    0x000000f7, 0x000000f8, 0x000000f9, 0x000200f8, 0x000000f8, 0x0003003e, 0x000000da, 0x0000003f, 0x000200f9, 0x000000e0,
-    0x000200f8, 0x000000f9, 0x0004003d, 0x000000bc, 0x000000fb, 0x000000e7, 0x00050041, 0x000000d2, 0x000000fc, 0x000000fb,
-    0x000000cd, 0x0006003d, 0x00000002, 0x000000fd, 0x000000fc, 0x00000002, 0x00000008, 0x000500ae, 0x0000001a, 0x000000fe,
-    0x00000024, 0x000000fd, 0x000300f7, 0x00000100, 0x00000000, 0x000400fa, 0x000000fe, 0x000000ff, 0x00000100, 0x000200f8,
-    0x000000ff, 0x0003003e, 0x000000da, 0x0000003f, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000100, 0x0004003d, 0x000000bc,
-    0x00000103, 0x000000e7, 0x00060041, 0x00000104, 0x00000105, 0x00000103, 0x0000004b, 0x00000024, 0x0006003d, 0x000000c0,
-    0x00000106, 0x00000105, 0x00000002, 0x00000008, 0x0003003e, 0x00000102, 0x00000106, 0x00050041, 0x00000032, 0x00000107,
-    0x00000102, 0x00000040, 0x0004003d, 0x00000002, 0x00000108, 0x00000107, 0x000500ae, 0x0000001a, 0x00000109, 0x00000025,
-    0x00000108, 0x000300f7, 0x0000010b, 0x00000000, 0x000400fa, 0x00000109, 0x0000010a, 0x0000010b, 0x000200f8, 0x0000010a,
-    0x0003003e, 0x000000da, 0x0000003f, 0x00050041, 0x00000032, 0x0000010c, 0x00000102, 0x00000040, 0x0004003d, 0x00000002,
-    0x0000010d, 0x0000010c, 0x0003003e, 0x000000db, 0x0000010d, 0x000200f9, 0x000000e0, 0x000200f8, 0x0000010b, 0x00070041,
-    0x00000111, 0x00000112, 0x000000cc, 0x0000003b, 0x00000023, 0x0000003b, 0x0004003d, 0x000000bd, 0x00000113, 0x00000112,
-    0x0003003e, 0x00000110, 0x00000113, 0x0004003d, 0x000000bd, 0x00000115, 0x00000110, 0x0004007c, 0x000000c0, 0x00000116,
-    0x00000115, 0x0003003e, 0x00000114, 0x00000116, 0x00050041, 0x00000032, 0x00000117, 0x00000114, 0x00000040, 0x0004003d,
-    0x00000002, 0x00000118, 0x00000117, 0x000500aa, 0x0000001a, 0x00000119, 0x00000118, 0x00000040, 0x000300f7, 0x0000011b,
-    0x00000000, 0x000400fa, 0x00000119, 0x0000011a, 0x0000011b, 0x000200f8, 0x0000011a, 0x00050041, 0x00000032, 0x0000011c,
-    0x00000114, 0x0000003f, 0x0004003d, 0x00000002, 0x0000011d, 0x0000011c, 0x000500aa, 0x0000001a, 0x0000011e, 0x0000011d,
-    0x00000040, 0x000200f9, 0x0000011b, 0x000200f8, 0x0000011b, 0x000700f5, 0x0000001a, 0x0000011f, 0x00000119, 0x0000010b,
-    0x0000011e, 0x0000011a, 0x000300f7, 0x00000121, 0x00000000, 0x000400fa, 0x0000011f, 0x00000120, 0x00000121, 0x000200f8,
-    0x00000120, 0x0003003e, 0x000000da, 0x0000003f, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000121, 0x00050041, 0x00000032,
-    0x00000124, 0x00000102, 0x0000003f, 0x0004003d, 0x00000002, 0x00000125, 0x00000124, 0x00050080, 0x00000002, 0x00000126,
-    0x00000125, 0x00000025, 0x0003003e, 0x00000123, 0x00000126, 0x0004003d, 0x000000bd, 0x00000127, 0x00000110, 0x0004003d,
-    0x00000002, 0x00000128, 0x00000123, 0x00070041, 0x000000d2, 0x00000129, 0x00000127, 0x000000cd, 0x00000128, 0x00000040,
-    0x0006003d, 0x00000002, 0x0000012a, 0x00000129, 0x00000002, 0x00000004, 0x000500c7, 0x00000002, 0x0000012c, 0x0000012a,
-    0x0000012b, 0x0003003e, 0x000000dd, 0x0000012c, 0x0004003d, 0x000000bd, 0x0000012e, 0x00000110, 0x0004003d, 0x00000002,
-    0x0000012f, 0x00000123, 0x00070041, 0x000000d2, 0x00000130, 0x0000012e, 0x000000cd, 0x0000012f, 0x00000040, 0x0006003d,
-    0x00000002, 0x00000131, 0x00000130, 0x00000002, 0x00000004, 0x000500c7, 0x00000002, 0x00000133, 0x00000131, 0x00000132,
-    0x000500c2, 0x00000002, 0x00000135, 0x00000133, 0x00000134, 0x0003003e, 0x0000012d, 0x00000135, 0x0004003d, 0x00000002,
-    0x00000136, 0x000000dd, 0x000500aa, 0x0000001a, 0x00000137, 0x00000136, 0x00000040, 0x000300f7, 0x00000139, 0x00000000,
-    0x000400fa, 0x00000137, 0x00000138, 0x00000139, 0x000200f8, 0x00000138, 0x0003003e, 0x000000da, 0x00000054, 0x00050041,
-    0x00000032, 0x0000013a, 0x00000102, 0x0000003f, 0x0004003d, 0x00000002, 0x0000013b, 0x0000013a, 0x0003003e, 0x000000db,
-    0x0000013b, 0x0003003e, 0x000000dc, 0x00000025, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000139, 0x0004003d, 0x00000002,
-    0x0000013d, 0x000000dd, 0x000500aa, 0x0000001a, 0x0000013e, 0x0000013d, 0x0000012b, 0x000300f7, 0x00000140, 0x00000000,
-    0x000400fa, 0x0000013e, 0x0000013f, 0x00000140, 0x000200f8, 0x0000013f, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000140,
-    0x0004003d, 0x00000002, 0x00000142, 0x000000dd, 0x00050039, 0x0000001a, 0x00000143, 0x0000001d, 0x00000142, 0x000400a8,
-    0x0000001a, 0x00000144, 0x00000143, 0x000300f7, 0x00000146, 0x00000000, 0x000400fa, 0x00000144, 0x00000145, 0x00000146,
-    0x000200f8, 0x00000145, 0x0003003e, 0x000000da, 0x0000006c, 0x00050041, 0x00000032, 0x00000147, 0x00000102, 0x0000003f,
-    0x0004003d, 0x00000002, 0x00000148, 0x00000147, 0x0003003e, 0x000000db, 0x00000148, 0x0003003e, 0x000000dc, 0x00000025,
-    0x000200f9, 0x000000e0, 0x000200f8, 0x00000146, 0x0004003d, 0x00000002, 0x0000014a, 0x0000012d, 0x000500aa, 0x0000001a,
-    0x0000014b, 0x0000014a, 0x00000054, 0x000300f7, 0x0000014d, 0x00000000, 0x000400fa, 0x0000014b, 0x0000014c, 0x00000161,
-    0x000200f8, 0x0000014c, 0x0004003d, 0x000000bd, 0x0000014e, 0x00000110, 0x0004003d, 0x00000002, 0x0000014f, 0x00000123,
-    0x00070041, 0x000000d2, 0x00000150, 0x0000014e, 0x000000cd, 0x0000014f, 0x0000003f, 0x0006003d, 0x00000002, 0x00000151,
-    0x00000150, 0x00000002, 0x00000004, 0x0003003e, 0x000000dd, 0x00000151, 0x0004003d, 0x00000002, 0x00000152, 0x000000dd,
-    0x000500aa, 0x0000001a, 0x00000153, 0x00000152, 0x00000040, 0x000300f7, 0x00000155, 0x00000000, 0x000400fa, 0x00000153,
-    0x00000154, 0x00000155, 0x000200f8, 0x00000154, 0x0003003e, 0x000000da, 0x00000054, 0x00050041, 0x00000032, 0x00000156,
-    0x00000102, 0x0000003f, 0x0004003d, 0x00000002, 0x00000157, 0x00000156, 0x0003003e, 0x000000db, 0x00000157, 0x0003003e,
-    0x000000dc, 0x00000025, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000155, 0x0004003d, 0x00000002, 0x00000159, 0x000000dd,
-    0x00050039, 0x0000001a, 0x0000015a, 0x0000001d, 0x00000159, 0x000400a8, 0x0000001a, 0x0000015b, 0x0000015a, 0x000300f7,
-    0x0000015d, 0x00000000, 0x000400fa, 0x0000015b, 0x0000015c, 0x0000015d, 0x000200f8, 0x0000015c, 0x0003003e, 0x000000da,
-    0x0000006c, 0x00050041, 0x00000032, 0x0000015e, 0x00000102, 0x0000003f, 0x0004003d, 0x00000002, 0x0000015f, 0x0000015e,
-    0x0003003e, 0x000000db, 0x0000015f, 0x0003003e, 0x000000dc, 0x00000025, 0x000200f9, 0x000000e0, 0x000200f8, 0x0000015d,
-    0x000200f9, 0x0000014d, 0x000200f8, 0x00000161, 0x0004003d, 0x00000002, 0x00000162, 0x0000012d, 0x000500aa, 0x0000001a,
-    0x00000163, 0x00000162, 0x0000005d, 0x0004003d, 0x00000002, 0x00000164, 0x0000012d, 0x000500aa, 0x0000001a, 0x00000165,
-    0x00000164, 0x00000062, 0x000500a6, 0x0000001a, 0x00000166, 0x00000163, 0x00000165, 0x000300f7, 0x00000168, 0x00000000,
-    0x000400fa, 0x00000166, 0x00000167, 0x00000168, 0x000200f8, 0x00000167, 0x0004003d, 0x000000bd, 0x0000016a, 0x00000110,
-    0x0004003d, 0x00000002, 0x0000016b, 0x00000123, 0x00070041, 0x000000d2, 0x0000016c, 0x0000016a, 0x000000cd, 0x0000016b,
-    0x0000003f, 0x0006003d, 0x00000002, 0x0000016d, 0x0000016c, 0x00000002, 0x00000004, 0x0003003e, 0x00000169, 0x0000016d,
-    0x0004003d, 0x00000002, 0x0000016e, 0x00000169, 0x000500ae, 0x0000001a, 0x0000016f, 0x00000026, 0x0000016e, 0x000300f7,
-    0x00000171, 0x00000000, 0x000400fa, 0x0000016f, 0x00000170, 0x00000171, 0x000200f8, 0x00000170, 0x0003003e, 0x000000da,
-    0x0000005d, 0x0003003e, 0x000000db, 0x00000026, 0x0004003d, 0x00000002, 0x00000172, 0x00000169, 0x0003003e, 0x000000dc,
-    0x00000172, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000171, 0x000200f9, 0x00000168, 0x000200f8, 0x00000168, 0x000200f9,
-    0x0000014d, 0x000200f8, 0x0000014d, 0x00070041, 0x00000176, 0x00000177, 0x000000cc, 0x0000003b, 0x00000023, 0x0000004b,
-    0x0004003d, 0x000000be, 0x00000178, 0x00000177, 0x0003003e, 0x00000175, 0x00000178, 0x0004003d, 0x000000be, 0x0000017a,
-    0x00000175, 0x0004007c, 0x000000c0, 0x0000017b, 0x0000017a, 0x0003003e, 0x00000179, 0x0000017b, 0x00050041, 0x00000032,
-    0x0000017c, 0x00000179, 0x00000040, 0x0004003d, 0x00000002, 0x0000017d, 0x0000017c, 0x000500aa, 0x0000001a, 0x0000017e,
-    0x0000017d, 0x00000040, 0x000300f7, 0x00000180, 0x00000000, 0x000400fa, 0x0000017e, 0x0000017f, 0x00000180, 0x000200f8,
-    0x0000017f, 0x00050041, 0x00000032, 0x00000181, 0x00000179, 0x0000003f, 0x0004003d, 0x00000002, 0x00000182, 0x00000181,
-    0x000500aa, 0x0000001a, 0x00000183, 0x00000182, 0x00000040, 0x000200f9, 0x00000180, 0x000200f8, 0x00000180, 0x000700f5,
-    0x0000001a, 0x00000184, 0x0000017e, 0x0000014d, 0x00000183, 0x0000017f, 0x000300f7, 0x00000186, 0x00000000, 0x000400fa,
-    0x00000184, 0x00000185, 0x00000186, 0x000200f8, 0x00000185, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000186, 0x0004003d,
-    0x000000be, 0x00000188, 0x00000175, 0x0004003d, 0x00000002, 0x00000189, 0x00000123, 0x00060041, 0x000000d2, 0x0000018a,
-    0x00000188, 0x000000cd, 0x00000189, 0x0005003e, 0x0000018a, 0x0000003f, 0x00000002, 0x00000004, 0x000200f9, 0x000000e1,
-    0x000200f8, 0x000000e1, 0x000400fa, 0x0000018b, 0x000000de, 0x000000e0, 0x000200f8, 0x000000e0, 0x0004003d, 0x00000002,
-    0x0000018c, 0x000000da, 0x000500ab, 0x0000001a, 0x0000018d, 0x00000040, 0x0000018c, 0x000300f7, 0x0000018f, 0x00000000,
-    0x000400fa, 0x0000018d, 0x0000018e, 0x0000018f, 0x000200f8, 0x0000018e, 0x0004003d, 0x00000002, 0x00000190, 0x000000da,
-    0x0004003d, 0x00000002, 0x00000191, 0x000000db, 0x0004003d, 0x00000002, 0x00000192, 0x000000dc, 0x000d0039, 0x00000004,
-    0x00000193, 0x00000018, 0x00000020, 0x00000021, 0x00000022, 0x00000190, 0x00000023, 0x00000024, 0x00000025, 0x00000191,
-    0x00000192, 0x000200fe, 0x0000018b, 0x000200f8, 0x0000018f, 0x000200fe, 0x00000195, 0x00010038, 0x00050036, 0x0000001a,
-    0x00000030, 0x00000000, 0x0000002a, 0x00030037, 0x00000002, 0x0000002b, 0x00030037, 0x00000002, 0x0000002c, 0x00030037,
-    0x00000003, 0x0000002d, 0x00030037, 0x00000029, 0x0000002e, 0x00030037, 0x00000002, 0x0000002f, 0x000200f8, 0x00000031,
-    0x0004003b, 0x00000032, 0x00000198, 0x00000007, 0x0004003b, 0x00000032, 0x0000019d, 0x00000007, 0x0004003b, 0x00000032,
-    0x000001af, 0x00000007, 0x0003003e, 0x00000198, 0x0000003f, 0x000200f9, 0x00000199, 0x000200f8, 0x00000199, 0x000400f6,
-    0x0000019b, 0x0000019c, 0x00000000, 0x000200f9, 0x0000019a, 0x000200f8, 0x0000019a, 0x0004003d, 0x00000002, 0x0000019e,
-    0x00000198, 0x00050080, 0x00000002, 0x0000019f, 0x0000019e, 0x0000003f, 0x0003003e, 0x0000019d, 0x0000019f, 0x0004003d,
-    0x00000002, 0x000001a4, 0x0000019d, 0x00060041, 0x000001a5, 0x000001a6, 0x000001a3, 0x000000cd, 0x000001a4, 0x0004003d,
-    0x00000029, 0x000001a7, 0x000001a6, 0x000500ac, 0x0000001a, 0x000001a8, 0x000001a7, 0x0000002e, 0x000300f7, 0x000001aa,
-    0x00000000, 0x000400fa, 0x000001a8, 0x000001a9, 0x000001ac, 0x000200f8, 0x000001a9, 0x000200f9, 0x0000019b, 0x000200f8,
-    0x000001ac, 0x0004003d, 0x00000002, 0x000001ad, 0x0000019d, 0x0003003e, 0x00000198, 0x000001ad, 0x000200f9, 0x0000019c,
-    0x000200f8, 0x000001aa, 0x000200f9, 0x0000019c, 0x000200f8, 0x0000019c, 0x000200f9, 0x00000199, 0x000200f8, 0x0000019b,
-    0x0004003d, 0x00000002, 0x000001b0, 0x0000019d, 0x00050082, 0x00000002, 0x000001b1, 0x000001b0, 0x0000003f, 0x0003003e,
-    0x000001af, 0x000001b1, 0x0004003d, 0x00000002, 0x000001b2, 0x000001af, 0x00060041, 0x000001a5, 0x000001b3, 0x000001a3,
-    0x000000cd, 0x000001b2, 0x0004003d, 0x00000029, 0x000001b4, 0x000001b3, 0x00050082, 0x00000029, 0x000001b5, 0x0000002e,
-    0x000001b4, 0x00040071, 0x00000029, 0x000001b6, 0x0000002f, 0x00050080, 0x00000029, 0x000001b7, 0x000001b5, 0x000001b6,
-    0x0004003d, 0x00000002, 0x000001b8, 0x000001af, 0x00050082, 0x00000002, 0x000001b9, 0x000001b8, 0x0000003f, 0x00060041,
-    0x000001a5, 0x000001ba, 0x000001a3, 0x000000cd, 0x000000cd, 0x0004003d, 0x00000029, 0x000001bb, 0x000001ba, 0x00040071,
-    0x00000002, 0x000001bc, 0x000001bb, 0x00050080, 0x00000002, 0x000001bd, 0x000001b9, 0x000001bc, 0x00060041, 0x000001a5,
-    0x000001be, 0x000001a3, 0x000000cd, 0x000001bd, 0x0004003d, 0x00000029, 0x000001bf, 0x000001be, 0x000500b2, 0x0000001a,
-    0x000001c0, 0x000001b7, 0x000001bf, 0x000300f7, 0x000001c2, 0x00000000, 0x000400fa, 0x000001c0, 0x000001c1, 0x000001c2,
-    0x000200f8, 0x000001c1, 0x000200fe, 0x00000195, 0x000200f8, 0x000001c2, 0x00040071, 0x00000002, 0x000001c4, 0x0000002e,
-    0x000500c2, 0x00000029, 0x000001c5, 0x0000002e, 0x000000b4, 0x00040071, 0x00000002, 0x000001c6, 0x000001c5, 0x000a0039,
-    0x00000004, 0x000001c7, 0x0000000c, 0x0000002b, 0x0000002c, 0x0000002d, 0x00000058, 0x000001c4, 0x000001c6, 0x000200fe,
-    0x0000018b, 0x00010038,
+    0x00000007, 0x0004003b, 0x00000032, 0x00000079, 0x00000007, 0x0004003b, 0x00000032, 0x000001b1, 0x00000007, 0x00080039,
+    0x0000001a, 0x000001f9, 0x000001a6, 0x0000000f, 0x00000010, 0x00000012, 0x000001b1, 0x000400a8, 0x0000001a, 0x000001fa,
+    0x000001f9, 0x000300f7, 0x000001fb, 0x00000000, 0x000400fa, 0x000001fa, 0x000001fc, 0x000001fb, 0x000200f8, 0x000001fc,
+    0x000100fd, 0x000200f8, 0x000001fb, 0x0003003e, 0x00000077, 0x00000078, 0x00050041, 0x0000003c, 0x000001fd, 0x000001b9,
+    0x000000cd, 0x0003003e, 0x000001fd, 0x0000003f, 0x00050041, 0x0000003c, 0x0000007a, 0x00000039, 0x0000003b, 0x0004003d,
+    0x00000002, 0x0000007b, 0x00000077, 0x000700ea, 0x00000002, 0x0000007c, 0x0000007a, 0x0000003f, 0x00000040, 0x0000007b,
+    0x0003003e, 0x00000079, 0x0000007c, 0x0004003d, 0x00000002, 0x0000007d, 0x00000079, 0x0004003d, 0x00000002, 0x0000007e,
+    0x00000077, 0x00050080, 0x00000002, 0x0000007f, 0x0000007d, 0x0000007e, 0x00050044, 0x00000002, 0x00000080, 0x00000039,
+    0x00000002, 0x0004007c, 0x0000003a, 0x00000081, 0x00000080, 0x0004007c, 0x00000002, 0x00000082, 0x00000081, 0x000500b2,
+    0x0000001a, 0x00000083, 0x0000007f, 0x00000082, 0x000300f7, 0x00000085, 0x00000000, 0x000400fa, 0x00000083, 0x00000084,
+    0x000001fe, 0x000200f8, 0x000001fe, 0x0004003d, 0x00000002, 0x000001ff, 0x000001b1, 0x00050039, 0x00000004, 0x00000200,
+    0x000001ab, 0x000001ff, 0x000200f9, 0x00000085, 0x000200f8, 0x00000084, 0x0004003d, 0x00000002, 0x00000086, 0x00000079,
+    0x0004003d, 0x00000002, 0x00000087, 0x00000077, 0x00060041, 0x0000003c, 0x00000088, 0x00000039, 0x0000004b, 0x00000086,
+    0x0003003e, 0x00000088, 0x00000087, 0x0004003d, 0x00000002, 0x00000089, 0x00000079, 0x00050080, 0x00000002, 0x0000008a,
+    0x00000089, 0x0000003f, 0x00060041, 0x0000003c, 0x0000008b, 0x00000039, 0x0000004b, 0x0000008a, 0x0003003e, 0x0000008b,
+    0x0000000f, 0x0004003d, 0x00000002, 0x0000008c, 0x00000079, 0x00050080, 0x00000002, 0x0000008d, 0x0000008c, 0x00000054,
+    0x00060041, 0x0000003c, 0x0000008e, 0x00000039, 0x0000004b, 0x0000008d, 0x0003003e, 0x0000008e, 0x00000010, 0x0004003d,
+    0x00000002, 0x0000008f, 0x00000079, 0x00050080, 0x00000002, 0x00000090, 0x0000008f, 0x00000058, 0x00050051, 0x00000002,
+    0x00000091, 0x00000011, 0x00000000, 0x00060041, 0x0000003c, 0x00000092, 0x00000039, 0x0000004b, 0x00000090, 0x0003003e,
+    0x00000092, 0x00000091, 0x0004003d, 0x00000002, 0x00000093, 0x00000079, 0x00050080, 0x00000002, 0x00000094, 0x00000093,
+    0x0000005d, 0x00050051, 0x00000002, 0x00000095, 0x00000011, 0x00000001, 0x00060041, 0x0000003c, 0x00000096, 0x00000039,
+    0x0000004b, 0x00000094, 0x0003003e, 0x00000096, 0x00000095, 0x0004003d, 0x00000002, 0x00000097, 0x00000079, 0x00050080,
+    0x00000002, 0x00000098, 0x00000097, 0x00000062, 0x00050051, 0x00000002, 0x00000099, 0x00000011, 0x00000002, 0x00060041,
+    0x0000003c, 0x0000009a, 0x00000039, 0x0000004b, 0x00000098, 0x0003003e, 0x0000009a, 0x00000099, 0x0004003d, 0x00000002,
+    0x0000009b, 0x00000079, 0x00050080, 0x00000002, 0x0000009c, 0x0000009b, 0x00000067, 0x00050051, 0x00000002, 0x0000009d,
+    0x00000011, 0x00000003, 0x00060041, 0x0000003c, 0x0000009e, 0x00000039, 0x0000004b, 0x0000009c, 0x0003003e, 0x0000009e,
+    0x0000009d, 0x0004003d, 0x00000002, 0x0000009f, 0x00000079, 0x00050080, 0x00000002, 0x000000a0, 0x0000009f, 0x0000006c,
+    0x00060041, 0x0000003c, 0x000000a1, 0x00000039, 0x0000004b, 0x000000a0, 0x0003003e, 0x000000a1, 0x00000012, 0x0004003d,
+    0x00000002, 0x000000a2, 0x00000079, 0x00050080, 0x00000002, 0x000000a3, 0x000000a2, 0x00000070, 0x00060041, 0x0000003c,
+    0x000000a4, 0x00000039, 0x0000004b, 0x000000a3, 0x0003003e, 0x000000a4, 0x00000013, 0x0004003d, 0x00000002, 0x000000a5,
+    0x00000079, 0x00050080, 0x00000002, 0x000000a6, 0x000000a5, 0x00000074, 0x00060041, 0x0000003c, 0x000000a7, 0x00000039,
+    0x0000004b, 0x000000a6, 0x0003003e, 0x000000a7, 0x00000014, 0x0004003d, 0x00000002, 0x000000a8, 0x00000079, 0x00050080,
+    0x00000002, 0x000000a9, 0x000000a8, 0x00000034, 0x00060041, 0x0000003c, 0x000000aa, 0x00000039, 0x0000004b, 0x000000a9,
+    0x0003003e, 0x000000aa, 0x00000015, 0x0004003d, 0x00000002, 0x000000ab, 0x00000079, 0x00050080, 0x00000002, 0x000000ad,
+    0x000000ab, 0x000000ac, 0x00060041, 0x0000003c, 0x000000ae, 0x00000039, 0x0000004b, 0x000000ad, 0x0003003e, 0x000000ae,
+    0x00000016, 0x0004003d, 0x00000002, 0x000000af, 0x00000079, 0x00050080, 0x00000002, 0x000000b1, 0x000000af, 0x000000b0,
+    0x00060041, 0x0000003c, 0x000000b2, 0x00000039, 0x0000004b, 0x000000b1, 0x0003003e, 0x000000b2, 0x00000017, 0x000200f9,
+    0x00000085, 0x000200f8, 0x00000085, 0x000100fd, 0x00010038, 0x00050036, 0x0000001a, 0x0000001d, 0x00000000, 0x0000001b,
+    0x00030037, 0x00000002, 0x0000001c, 0x000200f8, 0x0000001e, 0x0004003b, 0x00000032, 0x000000b3, 0x00000007, 0x0004003b,
+    0x00000032, 0x000000b6, 0x00000007, 0x00050086, 0x00000002, 0x000000b5, 0x0000001c, 0x000000b4, 0x0003003e, 0x000000b3,
+    0x000000b5, 0x000500c7, 0x00000002, 0x000000b8, 0x0000001c, 0x000000b7, 0x000500c4, 0x0000003a, 0x000000b9, 0x0000003b,
+    0x000000b8, 0x0004007c, 0x00000002, 0x000000ba, 0x000000b9, 0x0003003e, 0x000000b6, 0x000000ba, 0x00050041, 0x000000ce,
+    0x000000cf, 0x000000cc, 0x000000cd, 0x0004003d, 0x000000bb, 0x000000d0, 0x000000cf, 0x0004003d, 0x00000002, 0x000000d1,
+    0x000000b3, 0x00060041, 0x000000d2, 0x000000d3, 0x000000d0, 0x000000cd, 0x000000d1, 0x0006003d, 0x00000002, 0x000000d4,
+    0x000000d3, 0x00000002, 0x00000004, 0x0004003d, 0x00000002, 0x000000d5, 0x000000b6, 0x000500c7, 0x00000002, 0x000000d6,
+    0x000000d4, 0x000000d5, 0x000500ab, 0x0000001a, 0x000000d7, 0x000000d6, 0x00000040, 0x000200fe, 0x000000d7, 0x00010038,
+    0x00050036, 0x0000001a, 0x00000027, 0x00000000, 0x0000001f, 0x00030037, 0x00000002, 0x00000020, 0x00030037, 0x00000002,
+    0x00000021, 0x00030037, 0x00000003, 0x00000022, 0x00030037, 0x00000002, 0x00000023, 0x00030037, 0x00000002, 0x00000024,
+    0x00030037, 0x00000002, 0x00000025, 0x00030037, 0x00000002, 0x00000026, 0x000200f8, 0x00000028, 0x0004003b, 0x00000032,
+    0x000000da, 0x00000007, 0x0004003b, 0x00000032, 0x000000db, 0x00000007, 0x0004003b, 0x00000032, 0x000000dc, 0x00000007,
+    0x0004003b, 0x00000032, 0x000000dd, 0x00000007, 0x0004003b, 0x000000e6, 0x000000e7, 0x00000007, 0x0004003b, 0x000000eb,
+    0x000000ec, 0x00000007, 0x0004003b, 0x000000eb, 0x00000102, 0x00000007, 0x0004003b, 0x0000010f, 0x00000110, 0x00000007,
+    0x0004003b, 0x000000eb, 0x00000114, 0x00000007, 0x0004003b, 0x00000032, 0x00000123, 0x00000007, 0x0004003b, 0x00000032,
+    0x0000012d, 0x00000007, 0x0004003b, 0x00000032, 0x00000169, 0x00000007, 0x0004003b, 0x00000174, 0x00000175, 0x00000007,
+    0x0004003b, 0x000000eb, 0x00000179, 0x00000007, 0x0003003e, 0x000000da, 0x00000040, 0x0003003e, 0x000000db, 0x00000040,
+    0x0003003e, 0x000000dc, 0x00000040, 0x0003003e, 0x000000dd, 0x00000040, 0x000200f9, 0x000000de, 0x000200f8, 0x000000de,
+    0x000400f6, 0x000000e0, 0x000000e1, 0x00000000, 0x000200f9, 0x000000df, 0x000200f8, 0x000000df, 0x000500ae, 0x0000001a,
+    0x000000e2, 0x00000023, 0x000000b4, 0x000300f7, 0x000000e4, 0x00000000, 0x000400fa, 0x000000e2, 0x000000e3, 0x000000e4,
+    0x000200f8, 0x000000e3, 0x0003003e, 0x000000da, 0x0000003f, 0x0003003e, 0x000000db, 0x00000023, 0x000200f9, 0x000000e0,
+    0x000200f8, 0x000000e4, 0x00070041, 0x000000e8, 0x000000e9, 0x000000cc, 0x0000003b, 0x00000023, 0x000000cd, 0x0004003d,
+    0x000000bc, 0x000000ea, 0x000000e9, 0x0003003e, 0x000000e7, 0x000000ea, 0x0004003d, 0x000000bc, 0x000000ed, 0x000000e7,
+    0x0004007c, 0x000000c0, 0x000000ee, 0x000000ed, 0x0003003e, 0x000000ec, 0x000000ee, 0x00050041, 0x00000032, 0x000000ef,
+    0x000000ec, 0x00000040, 0x0004003d, 0x00000002, 0x000000f0, 0x000000ef, 0x000500aa, 0x0000001a, 0x000000f1, 0x000000f0,
+    0x00000040, 0x000300f7, 0x000000f3, 0x00000000, 0x000400fa, 0x000000f1, 0x000000f2, 0x000000f3, 0x000200f8, 0x000000f2,
+    0x00050041, 0x00000032, 0x000000f4, 0x000000ec, 0x0000003f, 0x0004003d, 0x00000002, 0x000000f5, 0x000000f4, 0x000500aa,
+    0x0000001a, 0x000000f6, 0x000000f5, 0x00000040, 0x000200f9, 0x000000f3, 0x000200f8, 0x000000f3, 0x000700f5, 0x0000001a,
+    0x000000f7, 0x000000f1, 0x000000e4, 0x000000f6, 0x000000f2, 0x000300f7, 0x000000f9, 0x00000000, 0x000400fa, 0x000000f7,
+    0x000000f8, 0x000000f9, 0x000200f8, 0x000000f8, 0x0003003e, 0x000000da, 0x0000003f, 0x000200f9, 0x000000e0, 0x000200f8,
+    0x000000f9, 0x0004003d, 0x000000bc, 0x000000fb, 0x000000e7, 0x00050041, 0x000000d2, 0x000000fc, 0x000000fb, 0x000000cd,
+    0x0006003d, 0x00000002, 0x000000fd, 0x000000fc, 0x00000002, 0x00000008, 0x000500ae, 0x0000001a, 0x000000fe, 0x00000024,
+    0x000000fd, 0x000300f7, 0x00000100, 0x00000000, 0x000400fa, 0x000000fe, 0x000000ff, 0x00000100, 0x000200f8, 0x000000ff,
+    0x0003003e, 0x000000da, 0x0000003f, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000100, 0x0004003d, 0x000000bc, 0x00000103,
+    0x000000e7, 0x00060041, 0x00000104, 0x00000105, 0x00000103, 0x0000004b, 0x00000024, 0x0006003d, 0x000000c0, 0x00000106,
+    0x00000105, 0x00000002, 0x00000008, 0x0003003e, 0x00000102, 0x00000106, 0x00050041, 0x00000032, 0x00000107, 0x00000102,
+    0x00000040, 0x0004003d, 0x00000002, 0x00000108, 0x00000107, 0x000500ae, 0x0000001a, 0x00000109, 0x00000025, 0x00000108,
+    0x000300f7, 0x0000010b, 0x00000000, 0x000400fa, 0x00000109, 0x0000010a, 0x0000010b, 0x000200f8, 0x0000010a, 0x0003003e,
+    0x000000da, 0x0000003f, 0x00050041, 0x00000032, 0x0000010c, 0x00000102, 0x00000040, 0x0004003d, 0x00000002, 0x0000010d,
+    0x0000010c, 0x0003003e, 0x000000db, 0x0000010d, 0x000200f9, 0x000000e0, 0x000200f8, 0x0000010b, 0x00070041, 0x00000111,
+    0x00000112, 0x000000cc, 0x0000003b, 0x00000023, 0x0000003b, 0x0004003d, 0x000000bd, 0x00000113, 0x00000112, 0x0003003e,
+    0x00000110, 0x00000113, 0x0004003d, 0x000000bd, 0x00000115, 0x00000110, 0x0004007c, 0x000000c0, 0x00000116, 0x00000115,
+    0x0003003e, 0x00000114, 0x00000116, 0x00050041, 0x00000032, 0x00000117, 0x00000114, 0x00000040, 0x0004003d, 0x00000002,
+    0x00000118, 0x00000117, 0x000500aa, 0x0000001a, 0x00000119, 0x00000118, 0x00000040, 0x000300f7, 0x0000011b, 0x00000000,
+    0x000400fa, 0x00000119, 0x0000011a, 0x0000011b, 0x000200f8, 0x0000011a, 0x00050041, 0x00000032, 0x0000011c, 0x00000114,
+    0x0000003f, 0x0004003d, 0x00000002, 0x0000011d, 0x0000011c, 0x000500aa, 0x0000001a, 0x0000011e, 0x0000011d, 0x00000040,
+    0x000200f9, 0x0000011b, 0x000200f8, 0x0000011b, 0x000700f5, 0x0000001a, 0x0000011f, 0x00000119, 0x0000010b, 0x0000011e,
+    0x0000011a, 0x000300f7, 0x00000121, 0x00000000, 0x000400fa, 0x0000011f, 0x00000120, 0x00000121, 0x000200f8, 0x00000120,
+    0x0003003e, 0x000000da, 0x0000003f, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000121, 0x00050041, 0x00000032, 0x00000124,
+    0x00000102, 0x0000003f, 0x0004003d, 0x00000002, 0x00000125, 0x00000124, 0x00050080, 0x00000002, 0x00000126, 0x00000125,
+    0x00000025, 0x0003003e, 0x00000123, 0x00000126, 0x0004003d, 0x000000bd, 0x00000127, 0x00000110, 0x0004003d, 0x00000002,
+    0x00000128, 0x00000123, 0x00070041, 0x000000d2, 0x00000129, 0x00000127, 0x000000cd, 0x00000128, 0x00000040, 0x0006003d,
+    0x00000002, 0x0000012a, 0x00000129, 0x00000002, 0x00000004, 0x000500c7, 0x00000002, 0x0000012c, 0x0000012a, 0x0000012b,
+    0x0003003e, 0x000000dd, 0x0000012c, 0x0004003d, 0x000000bd, 0x0000012e, 0x00000110, 0x0004003d, 0x00000002, 0x0000012f,
+    0x00000123, 0x00070041, 0x000000d2, 0x00000130, 0x0000012e, 0x000000cd, 0x0000012f, 0x00000040, 0x0006003d, 0x00000002,
+    0x00000131, 0x00000130, 0x00000002, 0x00000004, 0x000500c7, 0x00000002, 0x00000133, 0x00000131, 0x00000132, 0x000500c2,
+    0x00000002, 0x00000135, 0x00000133, 0x00000134, 0x0003003e, 0x0000012d, 0x00000135, 0x0004003d, 0x00000002, 0x00000136,
+    0x000000dd, 0x000500aa, 0x0000001a, 0x00000137, 0x00000136, 0x00000040, 0x000300f7, 0x00000139, 0x00000000, 0x000400fa,
+    0x00000137, 0x00000138, 0x00000139, 0x000200f8, 0x00000138, 0x0003003e, 0x000000da, 0x00000054, 0x00050041, 0x00000032,
+    0x0000013a, 0x00000102, 0x0000003f, 0x0004003d, 0x00000002, 0x0000013b, 0x0000013a, 0x0003003e, 0x000000db, 0x0000013b,
+    0x0003003e, 0x000000dc, 0x00000025, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000139, 0x0004003d, 0x00000002, 0x0000013d,
+    0x000000dd, 0x000500aa, 0x0000001a, 0x0000013e, 0x0000013d, 0x0000012b, 0x000300f7, 0x00000140, 0x00000000, 0x000400fa,
+    0x0000013e, 0x0000013f, 0x00000140, 0x000200f8, 0x0000013f, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000140, 0x0004003d,
+    0x00000002, 0x00000142, 0x000000dd, 0x00050039, 0x0000001a, 0x00000143, 0x0000001d, 0x00000142, 0x000400a8, 0x0000001a,
+    0x00000144, 0x00000143, 0x000300f7, 0x00000146, 0x00000000, 0x000400fa, 0x00000144, 0x00000145, 0x00000146, 0x000200f8,
+    0x00000145, 0x0003003e, 0x000000da, 0x0000006c, 0x00050041, 0x00000032, 0x00000147, 0x00000102, 0x0000003f, 0x0004003d,
+    0x00000002, 0x00000148, 0x00000147, 0x0003003e, 0x000000db, 0x00000148, 0x0003003e, 0x000000dc, 0x00000025, 0x000200f9,
+    0x000000e0, 0x000200f8, 0x00000146, 0x0004003d, 0x00000002, 0x0000014a, 0x0000012d, 0x000500aa, 0x0000001a, 0x0000014b,
+    0x0000014a, 0x00000054, 0x000300f7, 0x0000014d, 0x00000000, 0x000400fa, 0x0000014b, 0x0000014c, 0x00000161, 0x000200f8,
+    0x0000014c, 0x0004003d, 0x000000bd, 0x0000014e, 0x00000110, 0x0004003d, 0x00000002, 0x0000014f, 0x00000123, 0x00070041,
+    0x000000d2, 0x00000150, 0x0000014e, 0x000000cd, 0x0000014f, 0x0000003f, 0x0006003d, 0x00000002, 0x00000151, 0x00000150,
+    0x00000002, 0x00000004, 0x0003003e, 0x000000dd, 0x00000151, 0x0004003d, 0x00000002, 0x00000152, 0x000000dd, 0x000500aa,
+    0x0000001a, 0x00000153, 0x00000152, 0x00000040, 0x000300f7, 0x00000155, 0x00000000, 0x000400fa, 0x00000153, 0x00000154,
+    0x00000155, 0x000200f8, 0x00000154, 0x0003003e, 0x000000da, 0x00000054, 0x00050041, 0x00000032, 0x00000156, 0x00000102,
+    0x0000003f, 0x0004003d, 0x00000002, 0x00000157, 0x00000156, 0x0003003e, 0x000000db, 0x00000157, 0x0003003e, 0x000000dc,
+    0x00000025, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000155, 0x0004003d, 0x00000002, 0x00000159, 0x000000dd, 0x00050039,
+    0x0000001a, 0x0000015a, 0x0000001d, 0x00000159, 0x000400a8, 0x0000001a, 0x0000015b, 0x0000015a, 0x000300f7, 0x0000015d,
+    0x00000000, 0x000400fa, 0x0000015b, 0x0000015c, 0x0000015d, 0x000200f8, 0x0000015c, 0x0003003e, 0x000000da, 0x0000006c,
+    0x00050041, 0x00000032, 0x0000015e, 0x00000102, 0x0000003f, 0x0004003d, 0x00000002, 0x0000015f, 0x0000015e, 0x0003003e,
+    0x000000db, 0x0000015f, 0x0003003e, 0x000000dc, 0x00000025, 0x000200f9, 0x000000e0, 0x000200f8, 0x0000015d, 0x000200f9,
+    0x0000014d, 0x000200f8, 0x00000161, 0x0004003d, 0x00000002, 0x00000162, 0x0000012d, 0x000500aa, 0x0000001a, 0x00000163,
+    0x00000162, 0x0000005d, 0x0004003d, 0x00000002, 0x00000164, 0x0000012d, 0x000500aa, 0x0000001a, 0x00000165, 0x00000164,
+    0x00000062, 0x000500a6, 0x0000001a, 0x00000166, 0x00000163, 0x00000165, 0x000300f7, 0x00000168, 0x00000000, 0x000400fa,
+    0x00000166, 0x00000167, 0x00000168, 0x000200f8, 0x00000167, 0x0004003d, 0x000000bd, 0x0000016a, 0x00000110, 0x0004003d,
+    0x00000002, 0x0000016b, 0x00000123, 0x00070041, 0x000000d2, 0x0000016c, 0x0000016a, 0x000000cd, 0x0000016b, 0x0000003f,
+    0x0006003d, 0x00000002, 0x0000016d, 0x0000016c, 0x00000002, 0x00000004, 0x0003003e, 0x00000169, 0x0000016d, 0x0004003d,
+    0x00000002, 0x0000016e, 0x00000169, 0x000500ae, 0x0000001a, 0x0000016f, 0x00000026, 0x0000016e, 0x000300f7, 0x00000171,
+    0x00000000, 0x000400fa, 0x0000016f, 0x00000170, 0x00000171, 0x000200f8, 0x00000170, 0x0003003e, 0x000000da, 0x0000005d,
+    0x0003003e, 0x000000db, 0x00000026, 0x0004003d, 0x00000002, 0x00000172, 0x00000169, 0x0003003e, 0x000000dc, 0x00000172,
+    0x000200f9, 0x000000e0, 0x000200f8, 0x00000171, 0x000200f9, 0x00000168, 0x000200f8, 0x00000168, 0x000200f9, 0x0000014d,
+    0x000200f8, 0x0000014d, 0x00070041, 0x00000176, 0x00000177, 0x000000cc, 0x0000003b, 0x00000023, 0x0000004b, 0x0004003d,
+    0x000000be, 0x00000178, 0x00000177, 0x0003003e, 0x00000175, 0x00000178, 0x0004003d, 0x000000be, 0x0000017a, 0x00000175,
+    0x0004007c, 0x000000c0, 0x0000017b, 0x0000017a, 0x0003003e, 0x00000179, 0x0000017b, 0x00050041, 0x00000032, 0x0000017c,
+    0x00000179, 0x00000040, 0x0004003d, 0x00000002, 0x0000017d, 0x0000017c, 0x000500aa, 0x0000001a, 0x0000017e, 0x0000017d,
+    0x00000040, 0x000300f7, 0x00000180, 0x00000000, 0x000400fa, 0x0000017e, 0x0000017f, 0x00000180, 0x000200f8, 0x0000017f,
+    0x00050041, 0x00000032, 0x00000181, 0x00000179, 0x0000003f, 0x0004003d, 0x00000002, 0x00000182, 0x00000181, 0x000500aa,
+    0x0000001a, 0x00000183, 0x00000182, 0x00000040, 0x000200f9, 0x00000180, 0x000200f8, 0x00000180, 0x000700f5, 0x0000001a,
+    0x00000184, 0x0000017e, 0x0000014d, 0x00000183, 0x0000017f, 0x000300f7, 0x00000186, 0x00000000, 0x000400fa, 0x00000184,
+    0x00000185, 0x00000186, 0x000200f8, 0x00000185, 0x000200f9, 0x000000e0, 0x000200f8, 0x00000186, 0x0004003d, 0x000000be,
+    0x00000188, 0x00000175, 0x0004003d, 0x00000002, 0x00000189, 0x00000123, 0x00060041, 0x000000d2, 0x0000018a, 0x00000188,
+    0x000000cd, 0x00000189, 0x0005003e, 0x0000018a, 0x0000003f, 0x00000002, 0x00000004, 0x000200f9, 0x000000e1, 0x000200f8,
+    0x000000e1, 0x000400fa, 0x0000018b, 0x000000de, 0x000000e0, 0x000200f8, 0x000000e0, 0x0004003d, 0x00000002, 0x0000018c,
+    0x000000da, 0x000500ab, 0x0000001a, 0x0000018d, 0x00000040, 0x0000018c, 0x000300f7, 0x0000018f, 0x00000000, 0x000400fa,
+    0x0000018d, 0x0000018e, 0x0000018f, 0x000200f8, 0x0000018e, 0x0004003d, 0x00000002, 0x00000190, 0x000000da, 0x0004003d,
+    0x00000002, 0x00000191, 0x000000db, 0x0004003d, 0x00000002, 0x00000192, 0x000000dc, 0x000d0039, 0x00000004, 0x00000193,
+    0x00000018, 0x00000020, 0x00000021, 0x00000022, 0x00000190, 0x00000023, 0x00000024, 0x00000025, 0x00000191, 0x00000192,
+    0x000200fe, 0x0000018b, 0x000200f8, 0x0000018f, 0x000200fe, 0x00000195, 0x00010038, 0x00050036, 0x0000001a, 0x00000030,
+    0x00000000, 0x0000002a, 0x00030037, 0x00000002, 0x0000002b, 0x00030037, 0x00000002, 0x0000002c, 0x00030037, 0x00000003,
+    0x0000002d, 0x00030037, 0x00000029, 0x0000002e, 0x00030037, 0x00000002, 0x0000002f, 0x000200f8, 0x00000031, 0x0004003b,
+    0x00000032, 0x000001b4, 0x00000007, 0x0004003b, 0x00000032, 0x000001b5, 0x00000007, 0x00060041, 0x000001a5, 0x00000201,
+    0x000001a3, 0x000000cd, 0x000000cd, 0x0004003d, 0x00000029, 0x00000202, 0x00000201, 0x00040071, 0x00000002, 0x000001b2,
+    0x00000202, 0x00050084, 0x00000002, 0x00000203, 0x00000054, 0x000001b2, 0x00050082, 0x00000002, 0x00000204, 0x00000203,
+    0x0000003f, 0x00060041, 0x000001a5, 0x00000205, 0x000001a3, 0x000000cd, 0x00000204, 0x0004003d, 0x00000029, 0x00000206,
+    0x00000205, 0x00040071, 0x00000002, 0x000001b3, 0x00000206, 0x0003003e, 0x000001b4, 0x0000003f, 0x00050080, 0x00000002,
+    0x00000207, 0x0000003f, 0x000001b3, 0x00050082, 0x00000002, 0x00000208, 0x00000207, 0x0000003f, 0x0003003e, 0x000001b5,
+    0x00000208, 0x000200f9, 0x00000209, 0x000200f8, 0x00000209, 0x000400f6, 0x0000020a, 0x0000020b, 0x00000000, 0x000200f9,
+    0x0000020c, 0x000200f8, 0x0000020c, 0x0004003d, 0x00000002, 0x0000020d, 0x000001b5, 0x0004003d, 0x00000002, 0x0000020e,
+    0x000001b4, 0x00050082, 0x00000002, 0x0000020f, 0x0000020d, 0x0000020e, 0x000500ac, 0x0000001a, 0x00000210, 0x0000020f,
+    0x0000003f, 0x000400fa, 0x00000210, 0x00000211, 0x0000020a, 0x000200f8, 0x00000211, 0x0004003d, 0x00000002, 0x00000212,
+    0x000001b4, 0x0004003d, 0x00000002, 0x00000213, 0x000001b5, 0x00050080, 0x00000002, 0x00000214, 0x00000212, 0x00000213,
+    0x00050086, 0x00000002, 0x000001b6, 0x00000214, 0x00000054, 0x00060041, 0x000001a5, 0x00000215, 0x000001a3, 0x000000cd,
+    0x000001b6, 0x0004003d, 0x00000029, 0x00000216, 0x00000215, 0x000500ac, 0x0000001a, 0x00000217, 0x00000216, 0x0000002e,
+    0x000300f7, 0x00000218, 0x00000000, 0x000400fa, 0x00000217, 0x00000219, 0x0000021a, 0x000200f8, 0x00000219, 0x0003003e,
+    0x000001b5, 0x000001b6, 0x000200f9, 0x00000218, 0x000200f8, 0x0000021a, 0x0003003e, 0x000001b4, 0x000001b6, 0x000200f9,
+    0x00000218, 0x000200f8, 0x00000218, 0x000200f9, 0x0000020b, 0x000200f8, 0x0000020b, 0x000200f9, 0x00000209, 0x000200f8,
+    0x0000020a, 0x0004003d, 0x00000002, 0x000001b7, 0x000001b4, 0x00060041, 0x000001a5, 0x0000021b, 0x000001a3, 0x000000cd,
+    0x000001b7, 0x0004003d, 0x00000029, 0x0000021c, 0x0000021b, 0x00050082, 0x00000029, 0x0000021d, 0x0000002e, 0x0000021c,
+    0x00040071, 0x00000029, 0x0000021e, 0x0000002f, 0x00050080, 0x00000029, 0x0000021f, 0x0000021d, 0x0000021e, 0x00050082,
+    0x00000002, 0x00000220, 0x000001b7, 0x0000003f, 0x00050080, 0x00000002, 0x00000221, 0x00000220, 0x000001b2, 0x00060041,
+    0x000001a5, 0x00000222, 0x000001a3, 0x000000cd, 0x00000221, 0x0004003d, 0x00000029, 0x00000223, 0x00000222, 0x000500b2,
+    0x0000001a, 0x00000224, 0x0000021f, 0x00000223, 0x000300f7, 0x00000225, 0x00000000, 0x000400fa, 0x00000224, 0x00000226,
+    0x00000225, 0x000200f8, 0x00000226, 0x000200fe, 0x00000195, 0x000200f8, 0x00000225, 0x00040071, 0x00000002, 0x00000227,
+    0x0000002e, 0x000500c2, 0x00000029, 0x00000228, 0x0000002e, 0x000000b4, 0x00040071, 0x00000002, 0x00000229, 0x00000228,
+    0x000a0039, 0x00000004, 0x0000022a, 0x0000000c, 0x0000002b, 0x0000002c, 0x0000002d, 0x00000058, 0x00000227, 0x00000229,
+    0x000200fe, 0x0000018b, 0x00010038,
 };
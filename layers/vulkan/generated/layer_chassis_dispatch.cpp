@@ -27,6 +27,7 @@
 #include "layer_chassis_dispatch.h"
 #include "vk_safe_struct.h"
 #include "state_tracker/pipeline_state.h"
+#include "containers/scratch_arena.h"
 
 #define DISPATCH_MAX_STACK_ALLOCATIONS 32
 
@@ -354,6 +355,58 @@ void WrapPnextChainHandles(ValidationObject* layer_data, const void* pNext) {
     }
 }
 
+bool PnextChainContainsHandles(const void* pNext) {
+    for (auto header = reinterpret_cast<const VkBaseInStructure*>(pNext); header != nullptr; header = header->pNext) {
+        switch (header->sType) {
+            case VK_STRUCTURE_TYPE_FRAME_BOUNDARY_EXT:
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+            case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR:
+            case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV:
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+            case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV:
+#ifdef VK_USE_PLATFORM_FUCHSIA
+            case VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA:
+#endif  // VK_USE_PLATFORM_FUCHSIA
+            case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
+#ifdef VK_USE_PLATFORM_FUCHSIA
+            case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA:
+            case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA:
+#endif  // VK_USE_PLATFORM_FUCHSIA
+            case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
+            case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+            case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI:
+            case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV:
+            case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR:
+            case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR:
+            case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV:
+            case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO:
+            case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR:
+            case VK_STRUCTURE_TYPE_RENDER_PASS_STRIPE_SUBMIT_INFO_ARM:
+            case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT:
+            case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR:
+            case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_FENCE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_VIDEO_INLINE_QUERY_INFO_KHR:
+            case VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO:
+#ifdef VK_USE_PLATFORM_METAL_EXT
+            case VK_STRUCTURE_TYPE_EXPORT_METAL_BUFFER_INFO_EXT:
+            case VK_STRUCTURE_TYPE_EXPORT_METAL_IO_SURFACE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_EXPORT_METAL_SHARED_EVENT_INFO_EXT:
+            case VK_STRUCTURE_TYPE_EXPORT_METAL_TEXTURE_INFO_EXT:
+#endif  // VK_USE_PLATFORM_METAL_EXT
+            case VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_PUSH_DESCRIPTOR_BUFFER_HANDLE_EXT:
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+            case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_DISPLACEMENT_MICROMAP_NV:
+#endif  // VK_ENABLE_BETA_EXTENSIONS
+            case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_OPACITY_MICROMAP_EXT:
+                return true;
+            default:
+                break;
+        }
+    }
+    return false;
+}
+
 VkResult DispatchEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
 
@@ -433,10 +486,11 @@ void DispatchGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t
 VkResult DispatchQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkSubmitInfo* local_pSubmits = nullptr;
     {
         if (pSubmits) {
-            local_pSubmits = new safe_VkSubmitInfo[submitCount];
+            local_pSubmits = dispatch_scratch.NewArray<safe_VkSubmitInfo>(submitCount);
             for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
                 local_pSubmits[index0].initialize(&pSubmits[index0]);
                 WrapPnextChainHandles(layer_data, local_pSubmits[index0].pNext);
@@ -458,7 +512,7 @@ VkResult DispatchQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmit
     }
     VkResult result = layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, (const VkSubmitInfo*)local_pSubmits, fence);
     if (local_pSubmits) {
-        delete[] local_pSubmits;
+        dispatch_scratch.DeleteArray(local_pSubmits, submitCount);
     }
     return result;
 }
@@ -486,14 +540,14 @@ VkResult DispatchAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAl
     safe_VkMemoryAllocateInfo var_local_pAllocateInfo;
     safe_VkMemoryAllocateInfo* local_pAllocateInfo = nullptr;
     {
-        if (pAllocateInfo) {
+        if (pAllocateInfo && PnextChainContainsHandles(pAllocateInfo->pNext)) {
             local_pAllocateInfo = &var_local_pAllocateInfo;
             local_pAllocateInfo->initialize(pAllocateInfo);
             WrapPnextChainHandles(layer_data, local_pAllocateInfo->pNext);
         }
     }
-    VkResult result = layer_data->device_dispatch_table.AllocateMemory(device, (const VkMemoryAllocateInfo*)local_pAllocateInfo,
-                                                                       pAllocator, pMemory);
+    VkResult result = layer_data->device_dispatch_table.AllocateMemory(
+        device, local_pAllocateInfo ? (const VkMemoryAllocateInfo*)local_pAllocateInfo : pAllocateInfo, pAllocator, pMemory);
     if (VK_SUCCESS == result) {
         *pMemory = layer_data->WrapNew(*pMemory);
     }
@@ -534,10 +588,11 @@ void DispatchUnmapMemory(VkDevice device, VkDeviceMemory memory) {
 VkResult DispatchFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.FlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkMappedMemoryRange* local_pMemoryRanges = nullptr;
     {
         if (pMemoryRanges) {
-            local_pMemoryRanges = new safe_VkMappedMemoryRange[memoryRangeCount];
+            local_pMemoryRanges = dispatch_scratch.NewArray<safe_VkMappedMemoryRange>(memoryRangeCount);
             for (uint32_t index0 = 0; index0 < memoryRangeCount; ++index0) {
                 local_pMemoryRanges[index0].initialize(&pMemoryRanges[index0]);
 
@@ -550,7 +605,7 @@ VkResult DispatchFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCo
     VkResult result = layer_data->device_dispatch_table.FlushMappedMemoryRanges(device, memoryRangeCount,
                                                                                 (const VkMappedMemoryRange*)local_pMemoryRanges);
     if (local_pMemoryRanges) {
-        delete[] local_pMemoryRanges;
+        dispatch_scratch.DeleteArray(local_pMemoryRanges, memoryRangeCount);
     }
     return result;
 }
@@ -560,10 +615,11 @@ VkResult DispatchInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRa
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles)
         return layer_data->device_dispatch_table.InvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkMappedMemoryRange* local_pMemoryRanges = nullptr;
     {
         if (pMemoryRanges) {
-            local_pMemoryRanges = new safe_VkMappedMemoryRange[memoryRangeCount];
+            local_pMemoryRanges = dispatch_scratch.NewArray<safe_VkMappedMemoryRange>(memoryRangeCount);
             for (uint32_t index0 = 0; index0 < memoryRangeCount; ++index0) {
                 local_pMemoryRanges[index0].initialize(&pMemoryRanges[index0]);
 
@@ -576,7 +632,7 @@ VkResult DispatchInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRa
     VkResult result = layer_data->device_dispatch_table.InvalidateMappedMemoryRanges(
         device, memoryRangeCount, (const VkMappedMemoryRange*)local_pMemoryRanges);
     if (local_pMemoryRanges) {
-        delete[] local_pMemoryRanges;
+        dispatch_scratch.DeleteArray(local_pMemoryRanges, memoryRangeCount);
     }
     return result;
 }
@@ -650,10 +706,11 @@ void DispatchGetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physi
 VkResult DispatchQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkBindSparseInfo* local_pBindInfo = nullptr;
     {
         if (pBindInfo) {
-            local_pBindInfo = new safe_VkBindSparseInfo[bindInfoCount];
+            local_pBindInfo = dispatch_scratch.NewArray<safe_VkBindSparseInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfo[index0].initialize(&pBindInfo[index0]);
                 WrapPnextChainHandles(layer_data, local_pBindInfo[index0].pNext);
@@ -725,7 +782,7 @@ VkResult DispatchQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const Vk
     VkResult result =
         layer_data->device_dispatch_table.QueueBindSparse(queue, bindInfoCount, (const VkBindSparseInfo*)local_pBindInfo, fence);
     if (local_pBindInfo) {
-        delete[] local_pBindInfo;
+        dispatch_scratch.DeleteArray(local_pBindInfo, bindInfoCount);
     }
     return result;
 }
@@ -927,14 +984,14 @@ VkResult DispatchCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreate
     safe_VkBufferCreateInfo var_local_pCreateInfo;
     safe_VkBufferCreateInfo* local_pCreateInfo = nullptr;
     {
-        if (pCreateInfo) {
+        if (pCreateInfo && PnextChainContainsHandles(pCreateInfo->pNext)) {
             local_pCreateInfo = &var_local_pCreateInfo;
             local_pCreateInfo->initialize(pCreateInfo);
             WrapPnextChainHandles(layer_data, local_pCreateInfo->pNext);
         }
     }
-    VkResult result =
-        layer_data->device_dispatch_table.CreateBuffer(device, (const VkBufferCreateInfo*)local_pCreateInfo, pAllocator, pBuffer);
+    VkResult result = layer_data->device_dispatch_table.CreateBuffer(
+        device, local_pCreateInfo ? (const VkBufferCreateInfo*)local_pCreateInfo : pCreateInfo, pAllocator, pBuffer);
     if (VK_SUCCESS == result) {
         *pBuffer = layer_data->WrapNew(*pBuffer);
     }
@@ -1000,14 +1057,14 @@ VkResult DispatchCreateImage(VkDevice device, const VkImageCreateInfo* pCreateIn
     safe_VkImageCreateInfo var_local_pCreateInfo;
     safe_VkImageCreateInfo* local_pCreateInfo = nullptr;
     {
-        if (pCreateInfo) {
+        if (pCreateInfo && PnextChainContainsHandles(pCreateInfo->pNext)) {
             local_pCreateInfo = &var_local_pCreateInfo;
             local_pCreateInfo->initialize(pCreateInfo);
             WrapPnextChainHandles(layer_data, local_pCreateInfo->pNext);
         }
     }
-    VkResult result =
-        layer_data->device_dispatch_table.CreateImage(device, (const VkImageCreateInfo*)local_pCreateInfo, pAllocator, pImage);
+    VkResult result = layer_data->device_dispatch_table.CreateImage(
+        device, local_pCreateInfo ? (const VkImageCreateInfo*)local_pCreateInfo : pCreateInfo, pAllocator, pImage);
     if (VK_SUCCESS == result) {
         *pImage = layer_data->WrapNew(*pImage);
     }
@@ -1082,14 +1139,14 @@ VkResult DispatchCreateShaderModule(VkDevice device, const VkShaderModuleCreateI
     safe_VkShaderModuleCreateInfo var_local_pCreateInfo;
     safe_VkShaderModuleCreateInfo* local_pCreateInfo = nullptr;
     {
-        if (pCreateInfo) {
+        if (pCreateInfo && PnextChainContainsHandles(pCreateInfo->pNext)) {
             local_pCreateInfo = &var_local_pCreateInfo;
             local_pCreateInfo->initialize(pCreateInfo);
             WrapPnextChainHandles(layer_data, local_pCreateInfo->pNext);
         }
     }
     VkResult result = layer_data->device_dispatch_table.CreateShaderModule(
-        device, (const VkShaderModuleCreateInfo*)local_pCreateInfo, pAllocator, pShaderModule);
+        device, local_pCreateInfo ? (const VkShaderModuleCreateInfo*)local_pCreateInfo : pCreateInfo, pAllocator, pShaderModule);
     if (VK_SUCCESS == result) {
         *pShaderModule = layer_data->WrapNew(*pShaderModule);
     }
@@ -1229,14 +1286,14 @@ VkResult DispatchCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCrea
     safe_VkSamplerCreateInfo var_local_pCreateInfo;
     safe_VkSamplerCreateInfo* local_pCreateInfo = nullptr;
     {
-        if (pCreateInfo) {
+        if (pCreateInfo && PnextChainContainsHandles(pCreateInfo->pNext)) {
             local_pCreateInfo = &var_local_pCreateInfo;
             local_pCreateInfo->initialize(pCreateInfo);
             WrapPnextChainHandles(layer_data, local_pCreateInfo->pNext);
         }
     }
-    VkResult result = layer_data->device_dispatch_table.CreateSampler(device, (const VkSamplerCreateInfo*)local_pCreateInfo,
-                                                                      pAllocator, pSampler);
+    VkResult result = layer_data->device_dispatch_table.CreateSampler(
+        device, local_pCreateInfo ? (const VkSamplerCreateInfo*)local_pCreateInfo : pCreateInfo, pAllocator, pSampler);
     if (VK_SUCCESS == result) {
         *pSampler = layer_data->WrapNew(*pSampler);
     }
@@ -1322,11 +1379,12 @@ void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount
     if (!wrap_handles)
         return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites,
                                                                       descriptorCopyCount, pDescriptorCopies);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkWriteDescriptorSet* local_pDescriptorWrites = nullptr;
     safe_VkCopyDescriptorSet* local_pDescriptorCopies = nullptr;
     {
         if (pDescriptorWrites) {
-            local_pDescriptorWrites = new safe_VkWriteDescriptorSet[descriptorWriteCount];
+            local_pDescriptorWrites = dispatch_scratch.NewArray<safe_VkWriteDescriptorSet>(descriptorWriteCount);
             for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
                 local_pDescriptorWrites[index0].initialize(&pDescriptorWrites[index0]);
                 WrapPnextChainHandles(layer_data, local_pDescriptorWrites[index0].pNext);
@@ -1363,7 +1421,7 @@ void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount
             }
         }
         if (pDescriptorCopies) {
-            local_pDescriptorCopies = new safe_VkCopyDescriptorSet[descriptorCopyCount];
+            local_pDescriptorCopies = dispatch_scratch.NewArray<safe_VkCopyDescriptorSet>(descriptorCopyCount);
             for (uint32_t index0 = 0; index0 < descriptorCopyCount; ++index0) {
                 local_pDescriptorCopies[index0].initialize(&pDescriptorCopies[index0]);
 
@@ -1380,10 +1438,10 @@ void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount
         device, descriptorWriteCount, (const VkWriteDescriptorSet*)local_pDescriptorWrites, descriptorCopyCount,
         (const VkCopyDescriptorSet*)local_pDescriptorCopies);
     if (local_pDescriptorWrites) {
-        delete[] local_pDescriptorWrites;
+        dispatch_scratch.DeleteArray(local_pDescriptorWrites, descriptorWriteCount);
     }
     if (local_pDescriptorCopies) {
-        delete[] local_pDescriptorCopies;
+        dispatch_scratch.DeleteArray(local_pDescriptorCopies, descriptorCopyCount);
     }
 }
 
@@ -1787,6 +1845,7 @@ void DispatchCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, c
         return layer_data->device_dispatch_table.CmdWaitEvents(
             commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers,
             bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    vvl::ScratchArena::Scope dispatch_scratch;
     VkEvent var_local_pEvents[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkEvent* local_pEvents = nullptr;
     safe_VkBufferMemoryBarrier* local_pBufferMemoryBarriers = nullptr;
@@ -1799,7 +1858,7 @@ void DispatchCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, c
             }
         }
         if (pBufferMemoryBarriers) {
-            local_pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier[bufferMemoryBarrierCount];
+            local_pBufferMemoryBarriers = dispatch_scratch.NewArray<safe_VkBufferMemoryBarrier>(bufferMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < bufferMemoryBarrierCount; ++index0) {
                 local_pBufferMemoryBarriers[index0].initialize(&pBufferMemoryBarriers[index0]);
 
@@ -1809,7 +1868,7 @@ void DispatchCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, c
             }
         }
         if (pImageMemoryBarriers) {
-            local_pImageMemoryBarriers = new safe_VkImageMemoryBarrier[imageMemoryBarrierCount];
+            local_pImageMemoryBarriers = dispatch_scratch.NewArray<safe_VkImageMemoryBarrier>(imageMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < imageMemoryBarrierCount; ++index0) {
                 local_pImageMemoryBarriers[index0].initialize(&pImageMemoryBarriers[index0]);
 
@@ -1825,10 +1884,10 @@ void DispatchCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, c
         (const VkImageMemoryBarrier*)local_pImageMemoryBarriers);
     if (local_pEvents != var_local_pEvents) delete[] local_pEvents;
     if (local_pBufferMemoryBarriers) {
-        delete[] local_pBufferMemoryBarriers;
+        dispatch_scratch.DeleteArray(local_pBufferMemoryBarriers, bufferMemoryBarrierCount);
     }
     if (local_pImageMemoryBarriers) {
-        delete[] local_pImageMemoryBarriers;
+        dispatch_scratch.DeleteArray(local_pImageMemoryBarriers, imageMemoryBarrierCount);
     }
 }
 
@@ -1842,11 +1901,12 @@ void DispatchCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFl
         return layer_data->device_dispatch_table.CmdPipelineBarrier(
             commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers,
             bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkBufferMemoryBarrier* local_pBufferMemoryBarriers = nullptr;
     safe_VkImageMemoryBarrier* local_pImageMemoryBarriers = nullptr;
     {
         if (pBufferMemoryBarriers) {
-            local_pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier[bufferMemoryBarrierCount];
+            local_pBufferMemoryBarriers = dispatch_scratch.NewArray<safe_VkBufferMemoryBarrier>(bufferMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < bufferMemoryBarrierCount; ++index0) {
                 local_pBufferMemoryBarriers[index0].initialize(&pBufferMemoryBarriers[index0]);
 
@@ -1856,7 +1916,7 @@ void DispatchCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFl
             }
         }
         if (pImageMemoryBarriers) {
-            local_pImageMemoryBarriers = new safe_VkImageMemoryBarrier[imageMemoryBarrierCount];
+            local_pImageMemoryBarriers = dispatch_scratch.NewArray<safe_VkImageMemoryBarrier>(imageMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < imageMemoryBarrierCount; ++index0) {
                 local_pImageMemoryBarriers[index0].initialize(&pImageMemoryBarriers[index0]);
 
@@ -1871,10 +1931,10 @@ void DispatchCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFl
         (const VkBufferMemoryBarrier*)local_pBufferMemoryBarriers, imageMemoryBarrierCount,
         (const VkImageMemoryBarrier*)local_pImageMemoryBarriers);
     if (local_pBufferMemoryBarriers) {
-        delete[] local_pBufferMemoryBarriers;
+        dispatch_scratch.DeleteArray(local_pBufferMemoryBarriers, bufferMemoryBarrierCount);
     }
     if (local_pImageMemoryBarriers) {
-        delete[] local_pImageMemoryBarriers;
+        dispatch_scratch.DeleteArray(local_pImageMemoryBarriers, imageMemoryBarrierCount);
     }
 }
 
@@ -1976,10 +2036,11 @@ void DispatchCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandB
 VkResult DispatchBindBufferMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindBufferMemory2(device, bindInfoCount, pBindInfos);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkBindBufferMemoryInfo* local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindBufferMemoryInfo[bindInfoCount];
+            local_pBindInfos = dispatch_scratch.NewArray<safe_VkBindBufferMemoryInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
 
@@ -1995,7 +2056,7 @@ VkResult DispatchBindBufferMemory2(VkDevice device, uint32_t bindInfoCount, cons
     VkResult result =
         layer_data->device_dispatch_table.BindBufferMemory2(device, bindInfoCount, (const VkBindBufferMemoryInfo*)local_pBindInfos);
     if (local_pBindInfos) {
-        delete[] local_pBindInfos;
+        dispatch_scratch.DeleteArray(local_pBindInfos, bindInfoCount);
     }
     return result;
 }
@@ -2003,10 +2064,11 @@ VkResult DispatchBindBufferMemory2(VkDevice device, uint32_t bindInfoCount, cons
 VkResult DispatchBindImageMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindImageMemory2(device, bindInfoCount, pBindInfos);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkBindImageMemoryInfo* local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindImageMemoryInfo[bindInfoCount];
+            local_pBindInfos = dispatch_scratch.NewArray<safe_VkBindImageMemoryInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 WrapPnextChainHandles(layer_data, local_pBindInfos[index0].pNext);
@@ -2023,7 +2085,7 @@ VkResult DispatchBindImageMemory2(VkDevice device, uint32_t bindInfoCount, const
     VkResult result =
         layer_data->device_dispatch_table.BindImageMemory2(device, bindInfoCount, (const VkBindImageMemoryInfo*)local_pBindInfos);
     if (local_pBindInfos) {
-        delete[] local_pBindInfos;
+        dispatch_scratch.DeleteArray(local_pBindInfos, bindInfoCount);
     }
     return result;
 }
@@ -2529,6 +2591,7 @@ void DispatchCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount,
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles)
         return layer_data->device_dispatch_table.CmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
+    vvl::ScratchArena::Scope dispatch_scratch;
     VkEvent var_local_pEvents[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkEvent* local_pEvents = nullptr;
     safe_VkDependencyInfo* local_pDependencyInfos = nullptr;
@@ -2540,7 +2603,7 @@ void DispatchCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount,
             }
         }
         if (pDependencyInfos) {
-            local_pDependencyInfos = new safe_VkDependencyInfo[eventCount];
+            local_pDependencyInfos = dispatch_scratch.NewArray<safe_VkDependencyInfo>(eventCount);
             for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
                 local_pDependencyInfos[index0].initialize(&pDependencyInfos[index0]);
                 if (local_pDependencyInfos[index0].pBufferMemoryBarriers) {
@@ -2566,7 +2629,7 @@ void DispatchCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount,
                                                      (const VkDependencyInfo*)local_pDependencyInfos);
     if (local_pEvents != var_local_pEvents) delete[] local_pEvents;
     if (local_pDependencyInfos) {
-        delete[] local_pDependencyInfos;
+        dispatch_scratch.DeleteArray(local_pDependencyInfos, eventCount);
     }
 }
 
@@ -2610,10 +2673,11 @@ void DispatchCmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFl
 VkResult DispatchQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit2(queue, submitCount, pSubmits, fence);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkSubmitInfo2* local_pSubmits = nullptr;
     {
         if (pSubmits) {
-            local_pSubmits = new safe_VkSubmitInfo2[submitCount];
+            local_pSubmits = dispatch_scratch.NewArray<safe_VkSubmitInfo2>(submitCount);
             for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
                 local_pSubmits[index0].initialize(&pSubmits[index0]);
                 WrapPnextChainHandles(layer_data, local_pSubmits[index0].pNext);
@@ -2644,7 +2708,7 @@ VkResult DispatchQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmi
     VkResult result =
         layer_data->device_dispatch_table.QueueSubmit2(queue, submitCount, (const VkSubmitInfo2*)local_pSubmits, fence);
     if (local_pSubmits) {
-        delete[] local_pSubmits;
+        dispatch_scratch.DeleteArray(local_pSubmits, submitCount);
     }
     return result;
 }
@@ -3335,11 +3399,12 @@ VkResult DispatchBindVideoSessionMemoryKHR(VkDevice device, VkVideoSessionKHR vi
     if (!wrap_handles)
         return layer_data->device_dispatch_table.BindVideoSessionMemoryKHR(device, videoSession, bindSessionMemoryInfoCount,
                                                                            pBindSessionMemoryInfos);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkBindVideoSessionMemoryInfoKHR* local_pBindSessionMemoryInfos = nullptr;
     {
         videoSession = layer_data->Unwrap(videoSession);
         if (pBindSessionMemoryInfos) {
-            local_pBindSessionMemoryInfos = new safe_VkBindVideoSessionMemoryInfoKHR[bindSessionMemoryInfoCount];
+            local_pBindSessionMemoryInfos = dispatch_scratch.NewArray<safe_VkBindVideoSessionMemoryInfoKHR>(bindSessionMemoryInfoCount);
             for (uint32_t index0 = 0; index0 < bindSessionMemoryInfoCount; ++index0) {
                 local_pBindSessionMemoryInfos[index0].initialize(&pBindSessionMemoryInfos[index0]);
 
@@ -3352,7 +3417,7 @@ VkResult DispatchBindVideoSessionMemoryKHR(VkDevice device, VkVideoSessionKHR vi
     VkResult result = layer_data->device_dispatch_table.BindVideoSessionMemoryKHR(
         device, videoSession, bindSessionMemoryInfoCount, (const VkBindVideoSessionMemoryInfoKHR*)local_pBindSessionMemoryInfos);
     if (local_pBindSessionMemoryInfos) {
-        delete[] local_pBindSessionMemoryInfos;
+        dispatch_scratch.DeleteArray(local_pBindSessionMemoryInfos, bindSessionMemoryInfoCount);
     }
     return result;
 }
@@ -3822,11 +3887,12 @@ void DispatchCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBi
     if (!wrap_handles)
         return layer_data->device_dispatch_table.CmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set,
                                                                          descriptorWriteCount, pDescriptorWrites);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkWriteDescriptorSet* local_pDescriptorWrites = nullptr;
     {
         layout = layer_data->Unwrap(layout);
         if (pDescriptorWrites) {
-            local_pDescriptorWrites = new safe_VkWriteDescriptorSet[descriptorWriteCount];
+            local_pDescriptorWrites = dispatch_scratch.NewArray<safe_VkWriteDescriptorSet>(descriptorWriteCount);
             for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
                 local_pDescriptorWrites[index0].initialize(&pDescriptorWrites[index0]);
                 WrapPnextChainHandles(layer_data, local_pDescriptorWrites[index0].pNext);
@@ -3866,7 +3932,7 @@ void DispatchCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBi
     layer_data->device_dispatch_table.CmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
                                                               (const VkWriteDescriptorSet*)local_pDescriptorWrites);
     if (local_pDescriptorWrites) {
-        delete[] local_pDescriptorWrites;
+        dispatch_scratch.DeleteArray(local_pDescriptorWrites, descriptorWriteCount);
     }
 }
 
@@ -4215,10 +4281,11 @@ void DispatchDestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrCon
 VkResult DispatchBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkBindBufferMemoryInfo* local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindBufferMemoryInfo[bindInfoCount];
+            local_pBindInfos = dispatch_scratch.NewArray<safe_VkBindBufferMemoryInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
 
@@ -4234,7 +4301,7 @@ VkResult DispatchBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, c
     VkResult result = layer_data->device_dispatch_table.BindBufferMemory2KHR(device, bindInfoCount,
                                                                              (const VkBindBufferMemoryInfo*)local_pBindInfos);
     if (local_pBindInfos) {
-        delete[] local_pBindInfos;
+        dispatch_scratch.DeleteArray(local_pBindInfos, bindInfoCount);
     }
     return result;
 }
@@ -4242,10 +4309,11 @@ VkResult DispatchBindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, c
 VkResult DispatchBindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindImageMemory2KHR(device, bindInfoCount, pBindInfos);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkBindImageMemoryInfo* local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindImageMemoryInfo[bindInfoCount];
+            local_pBindInfos = dispatch_scratch.NewArray<safe_VkBindImageMemoryInfo>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 WrapPnextChainHandles(layer_data, local_pBindInfos[index0].pNext);
@@ -4262,7 +4330,7 @@ VkResult DispatchBindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount, co
     VkResult result = layer_data->device_dispatch_table.BindImageMemory2KHR(device, bindInfoCount,
                                                                             (const VkBindImageMemoryInfo*)local_pBindInfos);
     if (local_pBindInfos) {
-        delete[] local_pBindInfos;
+        dispatch_scratch.DeleteArray(local_pBindInfos, bindInfoCount);
     }
     return result;
 }
@@ -4736,6 +4804,7 @@ void DispatchCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCoun
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles)
         return layer_data->device_dispatch_table.CmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
+    vvl::ScratchArena::Scope dispatch_scratch;
     VkEvent var_local_pEvents[DISPATCH_MAX_STACK_ALLOCATIONS];
     VkEvent* local_pEvents = nullptr;
     safe_VkDependencyInfo* local_pDependencyInfos = nullptr;
@@ -4747,7 +4816,7 @@ void DispatchCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCoun
             }
         }
         if (pDependencyInfos) {
-            local_pDependencyInfos = new safe_VkDependencyInfo[eventCount];
+            local_pDependencyInfos = dispatch_scratch.NewArray<safe_VkDependencyInfo>(eventCount);
             for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
                 local_pDependencyInfos[index0].initialize(&pDependencyInfos[index0]);
                 if (local_pDependencyInfos[index0].pBufferMemoryBarriers) {
@@ -4773,7 +4842,7 @@ void DispatchCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCoun
                                                         (const VkDependencyInfo*)local_pDependencyInfos);
     if (local_pEvents != var_local_pEvents) delete[] local_pEvents;
     if (local_pDependencyInfos) {
-        delete[] local_pDependencyInfos;
+        dispatch_scratch.DeleteArray(local_pDependencyInfos, eventCount);
     }
 }
 
@@ -4818,10 +4887,11 @@ void DispatchCmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStag
 VkResult DispatchQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkSubmitInfo2* local_pSubmits = nullptr;
     {
         if (pSubmits) {
-            local_pSubmits = new safe_VkSubmitInfo2[submitCount];
+            local_pSubmits = dispatch_scratch.NewArray<safe_VkSubmitInfo2>(submitCount);
             for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
                 local_pSubmits[index0].initialize(&pSubmits[index0]);
                 WrapPnextChainHandles(layer_data, local_pSubmits[index0].pNext);
@@ -4852,7 +4922,7 @@ VkResult DispatchQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSu
     VkResult result =
         layer_data->device_dispatch_table.QueueSubmit2KHR(queue, submitCount, (const VkSubmitInfo2*)local_pSubmits, fence);
     if (local_pSubmits) {
-        delete[] local_pSubmits;
+        dispatch_scratch.DeleteArray(local_pSubmits, submitCount);
     }
     return result;
 }
@@ -5920,11 +5990,12 @@ VkResult DispatchCreateExecutionGraphPipelinesAMDX(VkDevice device, VkPipelineCa
     if (!wrap_handles)
         return layer_data->device_dispatch_table.CreateExecutionGraphPipelinesAMDX(device, pipelineCache, createInfoCount,
                                                                                    pCreateInfos, pAllocator, pPipelines);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkExecutionGraphPipelineCreateInfoAMDX* local_pCreateInfos = nullptr;
     {
         pipelineCache = layer_data->Unwrap(pipelineCache);
         if (pCreateInfos) {
-            local_pCreateInfos = new safe_VkExecutionGraphPipelineCreateInfoAMDX[createInfoCount];
+            local_pCreateInfos = dispatch_scratch.NewArray<safe_VkExecutionGraphPipelineCreateInfoAMDX>(createInfoCount);
             for (uint32_t index0 = 0; index0 < createInfoCount; ++index0) {
                 local_pCreateInfos[index0].initialize(&pCreateInfos[index0]);
                 if (local_pCreateInfos[index0].pStages) {
@@ -5957,7 +6028,7 @@ VkResult DispatchCreateExecutionGraphPipelinesAMDX(VkDevice device, VkPipelineCa
         device, pipelineCache, createInfoCount, (const VkExecutionGraphPipelineCreateInfoAMDX*)local_pCreateInfos, pAllocator,
         pPipelines);
     if (local_pCreateInfos) {
-        delete[] local_pCreateInfos;
+        dispatch_scratch.DeleteArray(local_pCreateInfos, createInfoCount);
     }
     if (VK_SUCCESS == result) {
         for (uint32_t index0 = 0; index0 < createInfoCount; index0++) {
@@ -6212,10 +6283,11 @@ VkResult DispatchBindAccelerationStructureMemoryNV(VkDevice device, uint32_t bin
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles)
         return layer_data->device_dispatch_table.BindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkBindAccelerationStructureMemoryInfoNV* local_pBindInfos = nullptr;
     {
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindAccelerationStructureMemoryInfoNV[bindInfoCount];
+            local_pBindInfos = dispatch_scratch.NewArray<safe_VkBindAccelerationStructureMemoryInfoNV>(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
 
@@ -6231,7 +6303,7 @@ VkResult DispatchBindAccelerationStructureMemoryNV(VkDevice device, uint32_t bin
     VkResult result = layer_data->device_dispatch_table.BindAccelerationStructureMemoryNV(
         device, bindInfoCount, (const VkBindAccelerationStructureMemoryInfoNV*)local_pBindInfos);
     if (local_pBindInfos) {
-        delete[] local_pBindInfos;
+        dispatch_scratch.DeleteArray(local_pBindInfos, bindInfoCount);
     }
     return result;
 }
@@ -6895,10 +6967,11 @@ VkResult DispatchTransitionImageLayoutEXT(VkDevice device, uint32_t transitionCo
                                           const VkHostImageLayoutTransitionInfoEXT* pTransitions) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.TransitionImageLayoutEXT(device, transitionCount, pTransitions);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkHostImageLayoutTransitionInfoEXT* local_pTransitions = nullptr;
     {
         if (pTransitions) {
-            local_pTransitions = new safe_VkHostImageLayoutTransitionInfoEXT[transitionCount];
+            local_pTransitions = dispatch_scratch.NewArray<safe_VkHostImageLayoutTransitionInfoEXT>(transitionCount);
             for (uint32_t index0 = 0; index0 < transitionCount; ++index0) {
                 local_pTransitions[index0].initialize(&pTransitions[index0]);
 
@@ -6911,7 +6984,7 @@ VkResult DispatchTransitionImageLayoutEXT(VkDevice device, uint32_t transitionCo
     VkResult result = layer_data->device_dispatch_table.TransitionImageLayoutEXT(
         device, transitionCount, (const VkHostImageLayoutTransitionInfoEXT*)local_pTransitions);
     if (local_pTransitions) {
-        delete[] local_pTransitions;
+        dispatch_scratch.DeleteArray(local_pTransitions, transitionCount);
     }
     return result;
 }
@@ -7272,20 +7345,22 @@ void DispatchCmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles)
         return layer_data->device_dispatch_table.CmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkDescriptorBufferBindingInfoEXT* local_pBindingInfos = nullptr;
     {
-        if (pBindingInfos) {
-            local_pBindingInfos = new safe_VkDescriptorBufferBindingInfoEXT[bufferCount];
+        if (pBindingInfos && PnextChainContainsHandles(pBindingInfos, bufferCount)) {
+            local_pBindingInfos = dispatch_scratch.NewArray<safe_VkDescriptorBufferBindingInfoEXT>(bufferCount);
             for (uint32_t index0 = 0; index0 < bufferCount; ++index0) {
                 local_pBindingInfos[index0].initialize(&pBindingInfos[index0]);
                 WrapPnextChainHandles(layer_data, local_pBindingInfos[index0].pNext);
             }
         }
     }
-    layer_data->device_dispatch_table.CmdBindDescriptorBuffersEXT(commandBuffer, bufferCount,
-                                                                  (const VkDescriptorBufferBindingInfoEXT*)local_pBindingInfos);
+    layer_data->device_dispatch_table.CmdBindDescriptorBuffersEXT(
+        commandBuffer, bufferCount,
+        local_pBindingInfos ? (const VkDescriptorBufferBindingInfoEXT*)local_pBindingInfos : pBindingInfos);
     if (local_pBindingInfos) {
-        delete[] local_pBindingInfos;
+        dispatch_scratch.DeleteArray(local_pBindingInfos, bufferCount);
     }
 }
 
@@ -7809,10 +7884,11 @@ void DispatchDestroyMicromapEXT(VkDevice device, VkMicromapEXT micromap, const V
 void DispatchCmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkMicromapBuildInfoEXT* pInfos) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkMicromapBuildInfoEXT* local_pInfos = nullptr;
     {
         if (pInfos) {
-            local_pInfos = new safe_VkMicromapBuildInfoEXT[infoCount];
+            local_pInfos = dispatch_scratch.NewArray<safe_VkMicromapBuildInfoEXT>(infoCount);
             for (uint32_t index0 = 0; index0 < infoCount; ++index0) {
                 local_pInfos[index0].initialize(&pInfos[index0]);
 
@@ -7824,7 +7900,7 @@ void DispatchCmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoCo
     }
     layer_data->device_dispatch_table.CmdBuildMicromapsEXT(commandBuffer, infoCount, (const VkMicromapBuildInfoEXT*)local_pInfos);
     if (local_pInfos) {
-        delete[] local_pInfos;
+        dispatch_scratch.DeleteArray(local_pInfos, infoCount);
     }
 }
 
@@ -8446,14 +8522,14 @@ void DispatchGetShaderModuleCreateInfoIdentifierEXT(VkDevice device, const VkSha
     safe_VkShaderModuleCreateInfo var_local_pCreateInfo;
     safe_VkShaderModuleCreateInfo* local_pCreateInfo = nullptr;
     {
-        if (pCreateInfo) {
+        if (pCreateInfo && PnextChainContainsHandles(pCreateInfo->pNext)) {
             local_pCreateInfo = &var_local_pCreateInfo;
             local_pCreateInfo->initialize(pCreateInfo);
             WrapPnextChainHandles(layer_data, local_pCreateInfo->pNext);
         }
     }
     layer_data->device_dispatch_table.GetShaderModuleCreateInfoIdentifierEXT(
-        device, (const VkShaderModuleCreateInfo*)local_pCreateInfo, pIdentifier);
+        device, local_pCreateInfo ? (const VkShaderModuleCreateInfo*)local_pCreateInfo : pCreateInfo, pIdentifier);
 }
 
 VkResult DispatchGetPhysicalDeviceOpticalFlowImageFormatsNV(VkPhysicalDevice physicalDevice,
@@ -8523,10 +8599,11 @@ VkResult DispatchCreateShadersEXT(VkDevice device, uint32_t createInfoCount, con
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles)
         return layer_data->device_dispatch_table.CreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkShaderCreateInfoEXT* local_pCreateInfos = nullptr;
     {
         if (pCreateInfos) {
-            local_pCreateInfos = new safe_VkShaderCreateInfoEXT[createInfoCount];
+            local_pCreateInfos = dispatch_scratch.NewArray<safe_VkShaderCreateInfoEXT>(createInfoCount);
             for (uint32_t index0 = 0; index0 < createInfoCount; ++index0) {
                 local_pCreateInfos[index0].initialize(&pCreateInfos[index0]);
                 if (local_pCreateInfos[index0].pSetLayouts) {
@@ -8541,7 +8618,7 @@ VkResult DispatchCreateShadersEXT(VkDevice device, uint32_t createInfoCount, con
     VkResult result = layer_data->device_dispatch_table.CreateShadersEXT(
         device, createInfoCount, (const VkShaderCreateInfoEXT*)local_pCreateInfos, pAllocator, pShaders);
     if (local_pCreateInfos) {
-        delete[] local_pCreateInfos;
+        dispatch_scratch.DeleteArray(local_pCreateInfos, createInfoCount);
     }
     if (VK_SUCCESS == result) {
         for (uint32_t index0 = 0; index0 < createInfoCount; index0++) {
@@ -8775,10 +8852,11 @@ void DispatchCmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, ui
     if (!wrap_handles)
         return layer_data->device_dispatch_table.CmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos,
                                                                                    ppBuildRangeInfos);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkAccelerationStructureBuildGeometryInfoKHR* local_pInfos = nullptr;
     {
         if (pInfos) {
-            local_pInfos = new safe_VkAccelerationStructureBuildGeometryInfoKHR[infoCount];
+            local_pInfos = dispatch_scratch.NewArray<safe_VkAccelerationStructureBuildGeometryInfoKHR>(infoCount);
             for (uint32_t index0 = 0; index0 < infoCount; ++index0) {
                 local_pInfos[index0].initialize(&pInfos[index0], false, nullptr);
 
@@ -8794,7 +8872,7 @@ void DispatchCmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, ui
     layer_data->device_dispatch_table.CmdBuildAccelerationStructuresKHR(
         commandBuffer, infoCount, (const VkAccelerationStructureBuildGeometryInfoKHR*)local_pInfos, ppBuildRangeInfos);
     if (local_pInfos) {
-        delete[] local_pInfos;
+        dispatch_scratch.DeleteArray(local_pInfos, infoCount);
     }
 }
 
@@ -8807,10 +8885,11 @@ void DispatchCmdBuildAccelerationStructuresIndirectKHR(VkCommandBuffer commandBu
     if (!wrap_handles)
         return layer_data->device_dispatch_table.CmdBuildAccelerationStructuresIndirectKHR(
             commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
+    vvl::ScratchArena::Scope dispatch_scratch;
     safe_VkAccelerationStructureBuildGeometryInfoKHR* local_pInfos = nullptr;
     {
         if (pInfos) {
-            local_pInfos = new safe_VkAccelerationStructureBuildGeometryInfoKHR[infoCount];
+            local_pInfos = dispatch_scratch.NewArray<safe_VkAccelerationStructureBuildGeometryInfoKHR>(infoCount);
             for (uint32_t index0 = 0; index0 < infoCount; ++index0) {
                 local_pInfos[index0].initialize(&pInfos[index0], false, nullptr);
 
@@ -8827,7 +8906,7 @@ void DispatchCmdBuildAccelerationStructuresIndirectKHR(VkCommandBuffer commandBu
         commandBuffer, infoCount, (const VkAccelerationStructureBuildGeometryInfoKHR*)local_pInfos, pIndirectDeviceAddresses,
         pIndirectStrides, ppMaxPrimitiveCounts);
     if (local_pInfos) {
-        delete[] local_pInfos;
+        dispatch_scratch.DeleteArray(local_pInfos, infoCount);
     }
 }
 
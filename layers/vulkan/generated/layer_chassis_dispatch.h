@@ -29,6 +29,19 @@ extern bool wrap_handles;
 class ValidationObject;
 void WrapPnextChainHandles(ValidationObject* layer_data, const void* pNext);
 
+// Returns true if any struct in the pNext chain contains handles that need unwrapping
+bool PnextChainContainsHandles(const void* pNext);
+
+template <typename T>
+bool PnextChainContainsHandles(const T* structs, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        if (PnextChainContainsHandles(structs[i].pNext)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 VkResult DispatchCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator,
                                 VkInstance* pInstance);
 void DispatchDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator);
@@ -25,6 +25,7 @@
 // NOLINTBEGIN
 
 #pragma once
+#include <array>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -39,915 +40,1113 @@ const char* string_SpvBuiltIn(uint32_t built_in);
 const char* string_SpvDim(uint32_t dim);
 std::string string_SpvCooperativeMatrixOperands(uint32_t mask);
 
-static constexpr bool OpcodeHasType(uint32_t opcode) {
-    switch (opcode) {
-        case spv::OpUndef:
-        case spv::OpExtInst:
-        case spv::OpConstantTrue:
-        case spv::OpConstantFalse:
-        case spv::OpConstant:
-        case spv::OpConstantComposite:
-        case spv::OpConstantNull:
-        case spv::OpSpecConstantTrue:
-        case spv::OpSpecConstantFalse:
-        case spv::OpSpecConstant:
-        case spv::OpSpecConstantComposite:
-        case spv::OpSpecConstantOp:
-        case spv::OpFunction:
-        case spv::OpFunctionParameter:
-        case spv::OpFunctionCall:
-        case spv::OpVariable:
-        case spv::OpImageTexelPointer:
-        case spv::OpLoad:
-        case spv::OpAccessChain:
-        case spv::OpInBoundsAccessChain:
-        case spv::OpPtrAccessChain:
-        case spv::OpArrayLength:
-        case spv::OpInBoundsPtrAccessChain:
-        case spv::OpVectorExtractDynamic:
-        case spv::OpVectorInsertDynamic:
-        case spv::OpVectorShuffle:
-        case spv::OpCompositeConstruct:
-        case spv::OpCompositeExtract:
-        case spv::OpCompositeInsert:
-        case spv::OpCopyObject:
-        case spv::OpTranspose:
-        case spv::OpSampledImage:
-        case spv::OpImageSampleImplicitLod:
-        case spv::OpImageSampleExplicitLod:
-        case spv::OpImageSampleDrefImplicitLod:
-        case spv::OpImageSampleDrefExplicitLod:
-        case spv::OpImageSampleProjImplicitLod:
-        case spv::OpImageSampleProjExplicitLod:
-        case spv::OpImageSampleProjDrefImplicitLod:
-        case spv::OpImageSampleProjDrefExplicitLod:
-        case spv::OpImageFetch:
-        case spv::OpImageGather:
-        case spv::OpImageDrefGather:
-        case spv::OpImageRead:
-        case spv::OpImage:
-        case spv::OpImageQuerySizeLod:
-        case spv::OpImageQuerySize:
-        case spv::OpImageQueryLod:
-        case spv::OpImageQueryLevels:
-        case spv::OpImageQuerySamples:
-        case spv::OpConvertFToU:
-        case spv::OpConvertFToS:
-        case spv::OpConvertSToF:
-        case spv::OpConvertUToF:
-        case spv::OpUConvert:
-        case spv::OpSConvert:
-        case spv::OpFConvert:
-        case spv::OpQuantizeToF16:
-        case spv::OpConvertPtrToU:
-        case spv::OpConvertUToPtr:
-        case spv::OpBitcast:
-        case spv::OpSNegate:
-        case spv::OpFNegate:
-        case spv::OpIAdd:
-        case spv::OpFAdd:
-        case spv::OpISub:
-        case spv::OpFSub:
-        case spv::OpIMul:
-        case spv::OpFMul:
-        case spv::OpUDiv:
-        case spv::OpSDiv:
-        case spv::OpFDiv:
-        case spv::OpUMod:
-        case spv::OpSRem:
-        case spv::OpSMod:
-        case spv::OpFRem:
-        case spv::OpFMod:
-        case spv::OpVectorTimesScalar:
-        case spv::OpMatrixTimesScalar:
-        case spv::OpVectorTimesMatrix:
-        case spv::OpMatrixTimesVector:
-        case spv::OpMatrixTimesMatrix:
-        case spv::OpOuterProduct:
-        case spv::OpDot:
-        case spv::OpIAddCarry:
-        case spv::OpISubBorrow:
-        case spv::OpUMulExtended:
-        case spv::OpSMulExtended:
-        case spv::OpAny:
-        case spv::OpAll:
-        case spv::OpIsNan:
-        case spv::OpIsInf:
-        case spv::OpLogicalEqual:
-        case spv::OpLogicalNotEqual:
-        case spv::OpLogicalOr:
-        case spv::OpLogicalAnd:
-        case spv::OpLogicalNot:
-        case spv::OpSelect:
-        case spv::OpIEqual:
-        case spv::OpINotEqual:
-        case spv::OpUGreaterThan:
-        case spv::OpSGreaterThan:
-        case spv::OpUGreaterThanEqual:
-        case spv::OpSGreaterThanEqual:
-        case spv::OpULessThan:
-        case spv::OpSLessThan:
-        case spv::OpULessThanEqual:
-        case spv::OpSLessThanEqual:
-        case spv::OpFOrdEqual:
-        case spv::OpFUnordEqual:
-        case spv::OpFOrdNotEqual:
-        case spv::OpFUnordNotEqual:
-        case spv::OpFOrdLessThan:
-        case spv::OpFUnordLessThan:
-        case spv::OpFOrdGreaterThan:
-        case spv::OpFUnordGreaterThan:
-        case spv::OpFOrdLessThanEqual:
-        case spv::OpFUnordLessThanEqual:
-        case spv::OpFOrdGreaterThanEqual:
-        case spv::OpFUnordGreaterThanEqual:
-        case spv::OpShiftRightLogical:
-        case spv::OpShiftRightArithmetic:
-        case spv::OpShiftLeftLogical:
-        case spv::OpBitwiseOr:
-        case spv::OpBitwiseXor:
-        case spv::OpBitwiseAnd:
-        case spv::OpNot:
-        case spv::OpBitFieldInsert:
-        case spv::OpBitFieldSExtract:
-        case spv::OpBitFieldUExtract:
-        case spv::OpBitReverse:
-        case spv::OpBitCount:
-        case spv::OpDPdx:
-        case spv::OpDPdy:
-        case spv::OpFwidth:
-        case spv::OpDPdxFine:
-        case spv::OpDPdyFine:
-        case spv::OpFwidthFine:
-        case spv::OpDPdxCoarse:
-        case spv::OpDPdyCoarse:
-        case spv::OpFwidthCoarse:
-        case spv::OpAtomicLoad:
-        case spv::OpAtomicExchange:
-        case spv::OpAtomicCompareExchange:
-        case spv::OpAtomicIIncrement:
-        case spv::OpAtomicIDecrement:
-        case spv::OpAtomicIAdd:
-        case spv::OpAtomicISub:
-        case spv::OpAtomicSMin:
-        case spv::OpAtomicUMin:
-        case spv::OpAtomicSMax:
-        case spv::OpAtomicUMax:
-        case spv::OpAtomicAnd:
-        case spv::OpAtomicOr:
-        case spv::OpAtomicXor:
-        case spv::OpPhi:
-        case spv::OpGroupAll:
-        case spv::OpGroupAny:
-        case spv::OpGroupBroadcast:
-        case spv::OpGroupIAdd:
-        case spv::OpGroupFAdd:
-        case spv::OpGroupFMin:
-        case spv::OpGroupUMin:
-        case spv::OpGroupSMin:
-        case spv::OpGroupFMax:
-        case spv::OpGroupUMax:
-        case spv::OpGroupSMax:
-        case spv::OpImageSparseSampleImplicitLod:
-        case spv::OpImageSparseSampleExplicitLod:
-        case spv::OpImageSparseSampleDrefImplicitLod:
-        case spv::OpImageSparseSampleDrefExplicitLod:
-        case spv::OpImageSparseSampleProjImplicitLod:
-        case spv::OpImageSparseSampleProjExplicitLod:
-        case spv::OpImageSparseSampleProjDrefImplicitLod:
-        case spv::OpImageSparseSampleProjDrefExplicitLod:
-        case spv::OpImageSparseFetch:
-        case spv::OpImageSparseGather:
-        case spv::OpImageSparseDrefGather:
-        case spv::OpImageSparseTexelsResident:
-        case spv::OpImageSparseRead:
-        case spv::OpSizeOf:
-        case spv::OpConstantPipeStorage:
-        case spv::OpCreatePipeFromPipeStorage:
-        case spv::OpGetKernelLocalSizeForSubgroupCount:
-        case spv::OpGetKernelMaxNumSubgroups:
-        case spv::OpGroupNonUniformElect:
-        case spv::OpGroupNonUniformAll:
-        case spv::OpGroupNonUniformAny:
-        case spv::OpGroupNonUniformAllEqual:
-        case spv::OpGroupNonUniformBroadcast:
-        case spv::OpGroupNonUniformBroadcastFirst:
-        case spv::OpGroupNonUniformBallot:
-        case spv::OpGroupNonUniformInverseBallot:
-        case spv::OpGroupNonUniformBallotBitExtract:
-        case spv::OpGroupNonUniformBallotBitCount:
-        case spv::OpGroupNonUniformBallotFindLSB:
-        case spv::OpGroupNonUniformBallotFindMSB:
-        case spv::OpGroupNonUniformShuffle:
-        case spv::OpGroupNonUniformShuffleXor:
-        case spv::OpGroupNonUniformShuffleUp:
-        case spv::OpGroupNonUniformShuffleDown:
-        case spv::OpGroupNonUniformIAdd:
-        case spv::OpGroupNonUniformFAdd:
-        case spv::OpGroupNonUniformIMul:
-        case spv::OpGroupNonUniformFMul:
-        case spv::OpGroupNonUniformSMin:
-        case spv::OpGroupNonUniformUMin:
-        case spv::OpGroupNonUniformFMin:
-        case spv::OpGroupNonUniformSMax:
-        case spv::OpGroupNonUniformUMax:
-        case spv::OpGroupNonUniformFMax:
-        case spv::OpGroupNonUniformBitwiseAnd:
-        case spv::OpGroupNonUniformBitwiseOr:
-        case spv::OpGroupNonUniformBitwiseXor:
-        case spv::OpGroupNonUniformLogicalAnd:
-        case spv::OpGroupNonUniformLogicalOr:
-        case spv::OpGroupNonUniformLogicalXor:
-        case spv::OpGroupNonUniformQuadBroadcast:
-        case spv::OpGroupNonUniformQuadSwap:
-        case spv::OpCopyLogical:
-        case spv::OpPtrEqual:
-        case spv::OpPtrNotEqual:
-        case spv::OpPtrDiff:
-        case spv::OpColorAttachmentReadEXT:
-        case spv::OpDepthAttachmentReadEXT:
-        case spv::OpStencilAttachmentReadEXT:
-        case spv::OpSubgroupBallotKHR:
-        case spv::OpSubgroupFirstInvocationKHR:
-        case spv::OpSubgroupAllKHR:
-        case spv::OpSubgroupAnyKHR:
-        case spv::OpSubgroupAllEqualKHR:
-        case spv::OpGroupNonUniformRotateKHR:
-        case spv::OpSubgroupReadInvocationKHR:
-        case spv::OpConvertUToAccelerationStructureKHR:
-        case spv::OpSDot:
-        case spv::OpUDot:
-        case spv::OpSUDot:
-        case spv::OpSDotAccSat:
-        case spv::OpUDotAccSat:
-        case spv::OpSUDotAccSat:
-        case spv::OpCooperativeMatrixLoadKHR:
-        case spv::OpCooperativeMatrixMulAddKHR:
-        case spv::OpCooperativeMatrixLengthKHR:
-        case spv::OpRayQueryProceedKHR:
-        case spv::OpRayQueryGetIntersectionTypeKHR:
-        case spv::OpImageSampleWeightedQCOM:
-        case spv::OpImageBoxFilterQCOM:
-        case spv::OpImageBlockMatchSSDQCOM:
-        case spv::OpImageBlockMatchSADQCOM:
-        case spv::OpGroupIAddNonUniformAMD:
-        case spv::OpGroupFAddNonUniformAMD:
-        case spv::OpGroupFMinNonUniformAMD:
-        case spv::OpGroupUMinNonUniformAMD:
-        case spv::OpGroupSMinNonUniformAMD:
-        case spv::OpGroupFMaxNonUniformAMD:
-        case spv::OpGroupUMaxNonUniformAMD:
-        case spv::OpGroupSMaxNonUniformAMD:
-        case spv::OpFragmentMaskFetchAMD:
-        case spv::OpFragmentFetchAMD:
-        case spv::OpReadClockKHR:
-        case spv::OpFinishWritingNodePayloadAMDX:
-        case spv::OpHitObjectGetWorldToObjectNV:
-        case spv::OpHitObjectGetObjectToWorldNV:
-        case spv::OpHitObjectGetObjectRayDirectionNV:
-        case spv::OpHitObjectGetObjectRayOriginNV:
-        case spv::OpHitObjectGetShaderRecordBufferHandleNV:
-        case spv::OpHitObjectGetShaderBindingTableRecordIndexNV:
-        case spv::OpHitObjectGetCurrentTimeNV:
-        case spv::OpHitObjectGetHitKindNV:
-        case spv::OpHitObjectGetPrimitiveIndexNV:
-        case spv::OpHitObjectGetGeometryIndexNV:
-        case spv::OpHitObjectGetInstanceIdNV:
-        case spv::OpHitObjectGetInstanceCustomIndexNV:
-        case spv::OpHitObjectGetWorldRayDirectionNV:
-        case spv::OpHitObjectGetWorldRayOriginNV:
-        case spv::OpHitObjectGetRayTMaxNV:
-        case spv::OpHitObjectGetRayTMinNV:
-        case spv::OpHitObjectIsEmptyNV:
-        case spv::OpHitObjectIsHitNV:
-        case spv::OpHitObjectIsMissNV:
-        case spv::OpImageSampleFootprintNV:
-        case spv::OpGroupNonUniformPartitionNV:
-        case spv::OpFetchMicroTriangleVertexPositionNV:
-        case spv::OpFetchMicroTriangleVertexBarycentricNV:
-        case spv::OpReportIntersectionNV:
-        case spv::OpRayQueryGetIntersectionTriangleVertexPositionsKHR:
-        case spv::OpCooperativeMatrixLoadNV:
-        case spv::OpCooperativeMatrixMulAddNV:
-        case spv::OpCooperativeMatrixLengthNV:
-        case spv::OpIsHelperInvocationEXT:
-        case spv::OpConvertUToImageNV:
-        case spv::OpConvertUToSamplerNV:
-        case spv::OpConvertImageToUNV:
-        case spv::OpConvertSamplerToUNV:
-        case spv::OpConvertUToSampledImageNV:
-        case spv::OpConvertSampledImageToUNV:
-        case spv::OpSubgroupShuffleINTEL:
-        case spv::OpSubgroupShuffleDownINTEL:
-        case spv::OpSubgroupShuffleUpINTEL:
-        case spv::OpSubgroupShuffleXorINTEL:
-        case spv::OpSubgroupBlockReadINTEL:
-        case spv::OpSubgroupImageBlockReadINTEL:
-        case spv::OpSubgroupImageMediaBlockReadINTEL:
-        case spv::OpUCountLeadingZerosINTEL:
-        case spv::OpUCountTrailingZerosINTEL:
-        case spv::OpAbsISubINTEL:
-        case spv::OpAbsUSubINTEL:
-        case spv::OpIAddSatINTEL:
-        case spv::OpUAddSatINTEL:
-        case spv::OpIAverageINTEL:
-        case spv::OpUAverageINTEL:
-        case spv::OpIAverageRoundedINTEL:
-        case spv::OpUAverageRoundedINTEL:
-        case spv::OpISubSatINTEL:
-        case spv::OpUSubSatINTEL:
-        case spv::OpIMul32x16INTEL:
-        case spv::OpUMul32x16INTEL:
-        case spv::OpConstantFunctionPointerINTEL:
-        case spv::OpFunctionPointerCallINTEL:
-        case spv::OpAsmTargetINTEL:
-        case spv::OpAsmINTEL:
-        case spv::OpAsmCallINTEL:
-        case spv::OpAtomicFMinEXT:
-        case spv::OpAtomicFMaxEXT:
-        case spv::OpExpectKHR:
-        case spv::OpVariableLengthArrayINTEL:
-        case spv::OpSaveMemoryINTEL:
-        case spv::OpPtrCastToCrossWorkgroupINTEL:
-        case spv::OpCrossWorkgroupCastToPtrINTEL:
-        case spv::OpReadPipeBlockingINTEL:
-        case spv::OpWritePipeBlockingINTEL:
-        case spv::OpFPGARegINTEL:
-        case spv::OpRayQueryGetRayTMinKHR:
-        case spv::OpRayQueryGetRayFlagsKHR:
-        case spv::OpRayQueryGetIntersectionTKHR:
-        case spv::OpRayQueryGetIntersectionInstanceCustomIndexKHR:
-        case spv::OpRayQueryGetIntersectionInstanceIdKHR:
-        case spv::OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR:
-        case spv::OpRayQueryGetIntersectionGeometryIndexKHR:
-        case spv::OpRayQueryGetIntersectionPrimitiveIndexKHR:
-        case spv::OpRayQueryGetIntersectionBarycentricsKHR:
-        case spv::OpRayQueryGetIntersectionFrontFaceKHR:
-        case spv::OpRayQueryGetIntersectionCandidateAABBOpaqueKHR:
-        case spv::OpRayQueryGetIntersectionObjectRayDirectionKHR:
-        case spv::OpRayQueryGetIntersectionObjectRayOriginKHR:
-        case spv::OpRayQueryGetWorldRayDirectionKHR:
-        case spv::OpRayQueryGetWorldRayOriginKHR:
-        case spv::OpRayQueryGetIntersectionObjectToWorldKHR:
-        case spv::OpRayQueryGetIntersectionWorldToObjectKHR:
-        case spv::OpAtomicFAddEXT:
-        case spv::OpCompositeConstructContinuedINTEL:
-        case spv::OpConvertFToBF16INTEL:
-        case spv::OpConvertBF16ToFINTEL:
-        case spv::OpGroupIMulKHR:
-        case spv::OpGroupFMulKHR:
-        case spv::OpGroupBitwiseAndKHR:
-        case spv::OpGroupBitwiseOrKHR:
-        case spv::OpGroupBitwiseXorKHR:
-        case spv::OpGroupLogicalAndKHR:
-        case spv::OpGroupLogicalOrKHR:
-        case spv::OpGroupLogicalXorKHR:
-            return true;
-        default:
-            return false;
-    }
-}
+// All valid OpType*
+enum class SpvType {
+    Empty = 0,
+    kVoid,
+    kBool,
+    kInt,
+    kFloat,
+    kVector,
+    kMatrix,
+    kImage,
+    kSampler,
+    kSampledImage,
+    kArray,
+    kRuntimeArray,
+    kStruct,
+    kPointer,
+    kFunction,
+    kForwardPointer,
+    kPipeStorage,
+    kCooperativeMatrixKHR,
+    kRayQueryKHR,
+    kHitObjectNV,
+    kAccelerationStructureKHR,
+    kCooperativeMatrixNV,
+    kBufferSurfaceINTEL,
+    kStructContinuedINTEL,
+};
 
-static constexpr bool OpcodeHasResult(uint32_t opcode) {
-    switch (opcode) {
-        case spv::OpUndef:
-        case spv::OpString:
-        case spv::OpExtInstImport:
-        case spv::OpExtInst:
-        case spv::OpTypeVoid:
-        case spv::OpTypeBool:
-        case spv::OpTypeInt:
-        case spv::OpTypeFloat:
-        case spv::OpTypeVector:
-        case spv::OpTypeMatrix:
-        case spv::OpTypeImage:
-        case spv::OpTypeSampler:
-        case spv::OpTypeSampledImage:
-        case spv::OpTypeArray:
-        case spv::OpTypeRuntimeArray:
-        case spv::OpTypeStruct:
-        case spv::OpTypePointer:
-        case spv::OpTypeFunction:
-        case spv::OpConstantTrue:
-        case spv::OpConstantFalse:
-        case spv::OpConstant:
-        case spv::OpConstantComposite:
-        case spv::OpConstantNull:
-        case spv::OpSpecConstantTrue:
-        case spv::OpSpecConstantFalse:
-        case spv::OpSpecConstant:
-        case spv::OpSpecConstantComposite:
-        case spv::OpSpecConstantOp:
-        case spv::OpFunction:
-        case spv::OpFunctionParameter:
-        case spv::OpFunctionCall:
-        case spv::OpVariable:
-        case spv::OpImageTexelPointer:
-        case spv::OpLoad:
-        case spv::OpAccessChain:
-        case spv::OpInBoundsAccessChain:
-        case spv::OpPtrAccessChain:
-        case spv::OpArrayLength:
-        case spv::OpInBoundsPtrAccessChain:
-        case spv::OpDecorationGroup:
-        case spv::OpVectorExtractDynamic:
-        case spv::OpVectorInsertDynamic:
-        case spv::OpVectorShuffle:
-        case spv::OpCompositeConstruct:
-        case spv::OpCompositeExtract:
-        case spv::OpCompositeInsert:
-        case spv::OpCopyObject:
-        case spv::OpTranspose:
-        case spv::OpSampledImage:
-        case spv::OpImageSampleImplicitLod:
-        case spv::OpImageSampleExplicitLod:
-        case spv::OpImageSampleDrefImplicitLod:
-        case spv::OpImageSampleDrefExplicitLod:
-        case spv::OpImageSampleProjImplicitLod:
-        case spv::OpImageSampleProjExplicitLod:
-        case spv::OpImageSampleProjDrefImplicitLod:
-        case spv::OpImageSampleProjDrefExplicitLod:
-        case spv::OpImageFetch:
-        case spv::OpImageGather:
-        case spv::OpImageDrefGather:
-        case spv::OpImageRead:
-        case spv::OpImage:
-        case spv::OpImageQuerySizeLod:
-        case spv::OpImageQuerySize:
-        case spv::OpImageQueryLod:
-        case spv::OpImageQueryLevels:
-        case spv::OpImageQuerySamples:
-        case spv::OpConvertFToU:
-        case spv::OpConvertFToS:
-        case spv::OpConvertSToF:
-        case spv::OpConvertUToF:
-        case spv::OpUConvert:
-        case spv::OpSConvert:
-        case spv::OpFConvert:
-        case spv::OpQuantizeToF16:
-        case spv::OpConvertPtrToU:
-        case spv::OpConvertUToPtr:
-        case spv::OpBitcast:
-        case spv::OpSNegate:
-        case spv::OpFNegate:
-        case spv::OpIAdd:
-        case spv::OpFAdd:
-        case spv::OpISub:
-        case spv::OpFSub:
-        case spv::OpIMul:
-        case spv::OpFMul:
-        case spv::OpUDiv:
-        case spv::OpSDiv:
-        case spv::OpFDiv:
-        case spv::OpUMod:
-        case spv::OpSRem:
-        case spv::OpSMod:
-        case spv::OpFRem:
-        case spv::OpFMod:
-        case spv::OpVectorTimesScalar:
-        case spv::OpMatrixTimesScalar:
-        case spv::OpVectorTimesMatrix:
-        case spv::OpMatrixTimesVector:
-        case spv::OpMatrixTimesMatrix:
-        case spv::OpOuterProduct:
-        case spv::OpDot:
-        case spv::OpIAddCarry:
-        case spv::OpISubBorrow:
-        case spv::OpUMulExtended:
-        case spv::OpSMulExtended:
-        case spv::OpAny:
-        case spv::OpAll:
-        case spv::OpIsNan:
-        case spv::OpIsInf:
-        case spv::OpLogicalEqual:
-        case spv::OpLogicalNotEqual:
-        case spv::OpLogicalOr:
-        case spv::OpLogicalAnd:
-        case spv::OpLogicalNot:
-        case spv::OpSelect:
-        case spv::OpIEqual:
-        case spv::OpINotEqual:
-        case spv::OpUGreaterThan:
-        case spv::OpSGreaterThan:
-        case spv::OpUGreaterThanEqual:
-        case spv::OpSGreaterThanEqual:
-        case spv::OpULessThan:
-        case spv::OpSLessThan:
-        case spv::OpULessThanEqual:
-        case spv::OpSLessThanEqual:
-        case spv::OpFOrdEqual:
-        case spv::OpFUnordEqual:
-        case spv::OpFOrdNotEqual:
-        case spv::OpFUnordNotEqual:
-        case spv::OpFOrdLessThan:
-        case spv::OpFUnordLessThan:
-        case spv::OpFOrdGreaterThan:
-        case spv::OpFUnordGreaterThan:
-        case spv::OpFOrdLessThanEqual:
-        case spv::OpFUnordLessThanEqual:
-        case spv::OpFOrdGreaterThanEqual:
-        case spv::OpFUnordGreaterThanEqual:
-        case spv::OpShiftRightLogical:
-        case spv::OpShiftRightArithmetic:
-        case spv::OpShiftLeftLogical:
-        case spv::OpBitwiseOr:
-        case spv::OpBitwiseXor:
-        case spv::OpBitwiseAnd:
-        case spv::OpNot:
-        case spv::OpBitFieldInsert:
-        case spv::OpBitFieldSExtract:
-        case spv::OpBitFieldUExtract:
-        case spv::OpBitReverse:
-        case spv::OpBitCount:
-        case spv::OpDPdx:
-        case spv::OpDPdy:
-        case spv::OpFwidth:
-        case spv::OpDPdxFine:
-        case spv::OpDPdyFine:
-        case spv::OpFwidthFine:
-        case spv::OpDPdxCoarse:
-        case spv::OpDPdyCoarse:
-        case spv::OpFwidthCoarse:
-        case spv::OpAtomicLoad:
-        case spv::OpAtomicExchange:
-        case spv::OpAtomicCompareExchange:
-        case spv::OpAtomicIIncrement:
-        case spv::OpAtomicIDecrement:
-        case spv::OpAtomicIAdd:
-        case spv::OpAtomicISub:
-        case spv::OpAtomicSMin:
-        case spv::OpAtomicUMin:
-        case spv::OpAtomicSMax:
-        case spv::OpAtomicUMax:
-        case spv::OpAtomicAnd:
-        case spv::OpAtomicOr:
-        case spv::OpAtomicXor:
-        case spv::OpPhi:
-        case spv::OpLabel:
-        case spv::OpGroupAll:
-        case spv::OpGroupAny:
-        case spv::OpGroupBroadcast:
-        case spv::OpGroupIAdd:
-        case spv::OpGroupFAdd:
-        case spv::OpGroupFMin:
-        case spv::OpGroupUMin:
-        case spv::OpGroupSMin:
-        case spv::OpGroupFMax:
-        case spv::OpGroupUMax:
-        case spv::OpGroupSMax:
-        case spv::OpImageSparseSampleImplicitLod:
-        case spv::OpImageSparseSampleExplicitLod:
-        case spv::OpImageSparseSampleDrefImplicitLod:
-        case spv::OpImageSparseSampleDrefExplicitLod:
-        case spv::OpImageSparseSampleProjImplicitLod:
-        case spv::OpImageSparseSampleProjExplicitLod:
-        case spv::OpImageSparseSampleProjDrefImplicitLod:
-        case spv::OpImageSparseSampleProjDrefExplicitLod:
-        case spv::OpImageSparseFetch:
-        case spv::OpImageSparseGather:
-        case spv::OpImageSparseDrefGather:
-        case spv::OpImageSparseTexelsResident:
-        case spv::OpImageSparseRead:
-        case spv::OpSizeOf:
-        case spv::OpTypePipeStorage:
-        case spv::OpConstantPipeStorage:
-        case spv::OpCreatePipeFromPipeStorage:
-        case spv::OpGetKernelLocalSizeForSubgroupCount:
-        case spv::OpGetKernelMaxNumSubgroups:
-        case spv::OpGroupNonUniformElect:
-        case spv::OpGroupNonUniformAll:
-        case spv::OpGroupNonUniformAny:
-        case spv::OpGroupNonUniformAllEqual:
-        case spv::OpGroupNonUniformBroadcast:
-        case spv::OpGroupNonUniformBroadcastFirst:
-        case spv::OpGroupNonUniformBallot:
-        case spv::OpGroupNonUniformInverseBallot:
-        case spv::OpGroupNonUniformBallotBitExtract:
-        case spv::OpGroupNonUniformBallotBitCount:
-        case spv::OpGroupNonUniformBallotFindLSB:
-        case spv::OpGroupNonUniformBallotFindMSB:
-        case spv::OpGroupNonUniformShuffle:
-        case spv::OpGroupNonUniformShuffleXor:
-        case spv::OpGroupNonUniformShuffleUp:
-        case spv::OpGroupNonUniformShuffleDown:
-        case spv::OpGroupNonUniformIAdd:
-        case spv::OpGroupNonUniformFAdd:
-        case spv::OpGroupNonUniformIMul:
-        case spv::OpGroupNonUniformFMul:
-        case spv::OpGroupNonUniformSMin:
-        case spv::OpGroupNonUniformUMin:
-        case spv::OpGroupNonUniformFMin:
-        case spv::OpGroupNonUniformSMax:
-        case spv::OpGroupNonUniformUMax:
-        case spv::OpGroupNonUniformFMax:
-        case spv::OpGroupNonUniformBitwiseAnd:
-        case spv::OpGroupNonUniformBitwiseOr:
-        case spv::OpGroupNonUniformBitwiseXor:
-        case spv::OpGroupNonUniformLogicalAnd:
-        case spv::OpGroupNonUniformLogicalOr:
-        case spv::OpGroupNonUniformLogicalXor:
-        case spv::OpGroupNonUniformQuadBroadcast:
-        case spv::OpGroupNonUniformQuadSwap:
-        case spv::OpCopyLogical:
-        case spv::OpPtrEqual:
-        case spv::OpPtrNotEqual:
-        case spv::OpPtrDiff:
-        case spv::OpColorAttachmentReadEXT:
-        case spv::OpDepthAttachmentReadEXT:
-        case spv::OpStencilAttachmentReadEXT:
-        case spv::OpSubgroupBallotKHR:
-        case spv::OpSubgroupFirstInvocationKHR:
-        case spv::OpSubgroupAllKHR:
-        case spv::OpSubgroupAnyKHR:
-        case spv::OpSubgroupAllEqualKHR:
-        case spv::OpGroupNonUniformRotateKHR:
-        case spv::OpSubgroupReadInvocationKHR:
-        case spv::OpConvertUToAccelerationStructureKHR:
-        case spv::OpSDot:
-        case spv::OpUDot:
-        case spv::OpSUDot:
-        case spv::OpSDotAccSat:
-        case spv::OpUDotAccSat:
-        case spv::OpSUDotAccSat:
-        case spv::OpTypeCooperativeMatrixKHR:
-        case spv::OpCooperativeMatrixLoadKHR:
-        case spv::OpCooperativeMatrixMulAddKHR:
-        case spv::OpCooperativeMatrixLengthKHR:
-        case spv::OpTypeRayQueryKHR:
-        case spv::OpRayQueryProceedKHR:
-        case spv::OpRayQueryGetIntersectionTypeKHR:
-        case spv::OpImageSampleWeightedQCOM:
-        case spv::OpImageBoxFilterQCOM:
-        case spv::OpImageBlockMatchSSDQCOM:
-        case spv::OpImageBlockMatchSADQCOM:
-        case spv::OpGroupIAddNonUniformAMD:
-        case spv::OpGroupFAddNonUniformAMD:
-        case spv::OpGroupFMinNonUniformAMD:
-        case spv::OpGroupUMinNonUniformAMD:
-        case spv::OpGroupSMinNonUniformAMD:
-        case spv::OpGroupFMaxNonUniformAMD:
-        case spv::OpGroupUMaxNonUniformAMD:
-        case spv::OpGroupSMaxNonUniformAMD:
-        case spv::OpFragmentMaskFetchAMD:
-        case spv::OpFragmentFetchAMD:
-        case spv::OpReadClockKHR:
-        case spv::OpFinishWritingNodePayloadAMDX:
-        case spv::OpHitObjectGetWorldToObjectNV:
-        case spv::OpHitObjectGetObjectToWorldNV:
-        case spv::OpHitObjectGetObjectRayDirectionNV:
-        case spv::OpHitObjectGetObjectRayOriginNV:
-        case spv::OpHitObjectGetShaderRecordBufferHandleNV:
-        case spv::OpHitObjectGetShaderBindingTableRecordIndexNV:
-        case spv::OpHitObjectGetCurrentTimeNV:
-        case spv::OpHitObjectGetHitKindNV:
-        case spv::OpHitObjectGetPrimitiveIndexNV:
-        case spv::OpHitObjectGetGeometryIndexNV:
-        case spv::OpHitObjectGetInstanceIdNV:
-        case spv::OpHitObjectGetInstanceCustomIndexNV:
-        case spv::OpHitObjectGetWorldRayDirectionNV:
-        case spv::OpHitObjectGetWorldRayOriginNV:
-        case spv::OpHitObjectGetRayTMaxNV:
-        case spv::OpHitObjectGetRayTMinNV:
-        case spv::OpHitObjectIsEmptyNV:
-        case spv::OpHitObjectIsHitNV:
-        case spv::OpHitObjectIsMissNV:
-        case spv::OpTypeHitObjectNV:
-        case spv::OpImageSampleFootprintNV:
-        case spv::OpGroupNonUniformPartitionNV:
-        case spv::OpFetchMicroTriangleVertexPositionNV:
-        case spv::OpFetchMicroTriangleVertexBarycentricNV:
-        case spv::OpReportIntersectionNV:
-        case spv::OpRayQueryGetIntersectionTriangleVertexPositionsKHR:
-        case spv::OpTypeAccelerationStructureKHR:
-        case spv::OpTypeCooperativeMatrixNV:
-        case spv::OpCooperativeMatrixLoadNV:
-        case spv::OpCooperativeMatrixMulAddNV:
-        case spv::OpCooperativeMatrixLengthNV:
-        case spv::OpIsHelperInvocationEXT:
-        case spv::OpConvertUToImageNV:
-        case spv::OpConvertUToSamplerNV:
-        case spv::OpConvertImageToUNV:
-        case spv::OpConvertSamplerToUNV:
-        case spv::OpConvertUToSampledImageNV:
-        case spv::OpConvertSampledImageToUNV:
-        case spv::OpSubgroupShuffleINTEL:
-        case spv::OpSubgroupShuffleDownINTEL:
-        case spv::OpSubgroupShuffleUpINTEL:
-        case spv::OpSubgroupShuffleXorINTEL:
-        case spv::OpSubgroupBlockReadINTEL:
-        case spv::OpSubgroupImageBlockReadINTEL:
-        case spv::OpSubgroupImageMediaBlockReadINTEL:
-        case spv::OpUCountLeadingZerosINTEL:
-        case spv::OpUCountTrailingZerosINTEL:
-        case spv::OpAbsISubINTEL:
-        case spv::OpAbsUSubINTEL:
-        case spv::OpIAddSatINTEL:
-        case spv::OpUAddSatINTEL:
-        case spv::OpIAverageINTEL:
-        case spv::OpUAverageINTEL:
-        case spv::OpIAverageRoundedINTEL:
-        case spv::OpUAverageRoundedINTEL:
-        case spv::OpISubSatINTEL:
-        case spv::OpUSubSatINTEL:
-        case spv::OpIMul32x16INTEL:
-        case spv::OpUMul32x16INTEL:
-        case spv::OpConstantFunctionPointerINTEL:
-        case spv::OpFunctionPointerCallINTEL:
-        case spv::OpAsmTargetINTEL:
-        case spv::OpAsmINTEL:
-        case spv::OpAsmCallINTEL:
-        case spv::OpAtomicFMinEXT:
-        case spv::OpAtomicFMaxEXT:
-        case spv::OpExpectKHR:
-        case spv::OpVariableLengthArrayINTEL:
-        case spv::OpSaveMemoryINTEL:
-        case spv::OpAliasDomainDeclINTEL:
-        case spv::OpAliasScopeDeclINTEL:
-        case spv::OpAliasScopeListDeclINTEL:
-        case spv::OpPtrCastToCrossWorkgroupINTEL:
-        case spv::OpCrossWorkgroupCastToPtrINTEL:
-        case spv::OpReadPipeBlockingINTEL:
-        case spv::OpWritePipeBlockingINTEL:
-        case spv::OpFPGARegINTEL:
-        case spv::OpRayQueryGetRayTMinKHR:
-        case spv::OpRayQueryGetRayFlagsKHR:
-        case spv::OpRayQueryGetIntersectionTKHR:
-        case spv::OpRayQueryGetIntersectionInstanceCustomIndexKHR:
-        case spv::OpRayQueryGetIntersectionInstanceIdKHR:
-        case spv::OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR:
-        case spv::OpRayQueryGetIntersectionGeometryIndexKHR:
-        case spv::OpRayQueryGetIntersectionPrimitiveIndexKHR:
-        case spv::OpRayQueryGetIntersectionBarycentricsKHR:
-        case spv::OpRayQueryGetIntersectionFrontFaceKHR:
-        case spv::OpRayQueryGetIntersectionCandidateAABBOpaqueKHR:
-        case spv::OpRayQueryGetIntersectionObjectRayDirectionKHR:
-        case spv::OpRayQueryGetIntersectionObjectRayOriginKHR:
-        case spv::OpRayQueryGetWorldRayDirectionKHR:
-        case spv::OpRayQueryGetWorldRayOriginKHR:
-        case spv::OpRayQueryGetIntersectionObjectToWorldKHR:
-        case spv::OpRayQueryGetIntersectionWorldToObjectKHR:
-        case spv::OpAtomicFAddEXT:
-        case spv::OpTypeBufferSurfaceINTEL:
-        case spv::OpCompositeConstructContinuedINTEL:
-        case spv::OpConvertFToBF16INTEL:
-        case spv::OpConvertBF16ToFINTEL:
-        case spv::OpGroupIMulKHR:
-        case spv::OpGroupFMulKHR:
-        case spv::OpGroupBitwiseAndKHR:
-        case spv::OpGroupBitwiseOrKHR:
-        case spv::OpGroupBitwiseXorKHR:
-        case spv::OpGroupLogicalAndKHR:
-        case spv::OpGroupLogicalOrKHR:
-        case spv::OpGroupLogicalXorKHR:
-            return true;
-        default:
-            return false;
-    }
-}
+// Properties of an opcode packed in 32 bits, so every query below is a single indexed load instead of a switch
+struct OpcodeInfo {
+    uint32_t has_type : 1;
+    uint32_t has_result : 1;
+    uint32_t atomic : 1;
+    uint32_t group : 1;
+    uint32_t debug : 1;
+    uint32_t annotation : 1;
+    uint32_t image_gather : 1;
+    uint32_t image_fetch : 1;
+    uint32_t image_sample : 1;
+    uint32_t spv_type : 5;  // SpvType
+    // Operand positions, zero if there is none
+    uint32_t memory_scope_position : 3;
+    uint32_t execution_scope_position : 3;
+    uint32_t image_operands_position : 3;
+    uint32_t image_access_position : 3;
+};
+static_assert(sizeof(OpcodeInfo) == sizeof(uint32_t));
 
-// Any non supported operation will be covered with other VUs
-static constexpr bool AtomicOperation(uint32_t opcode) {
-    switch (opcode) {
-        case spv::OpAtomicLoad:
-        case spv::OpAtomicStore:
-        case spv::OpAtomicExchange:
-        case spv::OpAtomicCompareExchange:
-        case spv::OpAtomicIIncrement:
-        case spv::OpAtomicIDecrement:
-        case spv::OpAtomicIAdd:
-        case spv::OpAtomicISub:
-        case spv::OpAtomicSMin:
-        case spv::OpAtomicUMin:
-        case spv::OpAtomicSMax:
-        case spv::OpAtomicUMax:
-        case spv::OpAtomicAnd:
-        case spv::OpAtomicOr:
-        case spv::OpAtomicXor:
-        case spv::OpAtomicFMinEXT:
-        case spv::OpAtomicFMaxEXT:
-        case spv::OpAtomicFAddEXT:
-            return true;
-        default:
-            return false;
-    }
-}
+// All opcodes in the grammar are below this
+static constexpr uint32_t kOpcodeInfoTableSize = 8192;
 
-// Any non supported operation will be covered with other VUs
-static constexpr bool GroupOperation(uint32_t opcode) {
-    switch (opcode) {
-        case spv::OpGroupNonUniformElect:
-        case spv::OpGroupNonUniformAll:
-        case spv::OpGroupNonUniformAny:
-        case spv::OpGroupNonUniformAllEqual:
-        case spv::OpGroupNonUniformBroadcast:
-        case spv::OpGroupNonUniformBroadcastFirst:
-        case spv::OpGroupNonUniformBallot:
-        case spv::OpGroupNonUniformInverseBallot:
-        case spv::OpGroupNonUniformBallotBitExtract:
-        case spv::OpGroupNonUniformBallotBitCount:
-        case spv::OpGroupNonUniformBallotFindLSB:
-        case spv::OpGroupNonUniformBallotFindMSB:
-        case spv::OpGroupNonUniformShuffle:
-        case spv::OpGroupNonUniformShuffleXor:
-        case spv::OpGroupNonUniformShuffleUp:
-        case spv::OpGroupNonUniformShuffleDown:
-        case spv::OpGroupNonUniformIAdd:
-        case spv::OpGroupNonUniformFAdd:
-        case spv::OpGroupNonUniformIMul:
-        case spv::OpGroupNonUniformFMul:
-        case spv::OpGroupNonUniformSMin:
-        case spv::OpGroupNonUniformUMin:
-        case spv::OpGroupNonUniformFMin:
-        case spv::OpGroupNonUniformSMax:
-        case spv::OpGroupNonUniformUMax:
-        case spv::OpGroupNonUniformFMax:
-        case spv::OpGroupNonUniformBitwiseAnd:
-        case spv::OpGroupNonUniformBitwiseOr:
-        case spv::OpGroupNonUniformBitwiseXor:
-        case spv::OpGroupNonUniformLogicalAnd:
-        case spv::OpGroupNonUniformLogicalOr:
-        case spv::OpGroupNonUniformLogicalXor:
-        case spv::OpGroupNonUniformQuadBroadcast:
-        case spv::OpGroupNonUniformQuadSwap:
-        case spv::OpGroupNonUniformPartitionNV:
-            return true;
-        default:
-            return false;
-    }
-}
+inline constexpr std::array<OpcodeInfo, kOpcodeInfoTableSize> kOpcodeInfoTable = [] {
+    std::array<OpcodeInfo, kOpcodeInfoTableSize> table{};
 
-static constexpr bool DebugOperation(uint32_t opcode) {
-    switch (opcode) {
-        case spv::OpSourceContinued:
-        case spv::OpSource:
-        case spv::OpSourceExtension:
-        case spv::OpName:
-        case spv::OpMemberName:
-        case spv::OpString:
-        case spv::OpLine:
-        case spv::OpNoLine:
-        case spv::OpModuleProcessed:
-            return true;
-        default:
-            return false;
-    }
-}
+    table[spv::OpUndef].has_type = 1;
+    table[spv::OpExtInst].has_type = 1;
+    table[spv::OpConstantTrue].has_type = 1;
+    table[spv::OpConstantFalse].has_type = 1;
+    table[spv::OpConstant].has_type = 1;
+    table[spv::OpConstantComposite].has_type = 1;
+    table[spv::OpConstantNull].has_type = 1;
+    table[spv::OpSpecConstantTrue].has_type = 1;
+    table[spv::OpSpecConstantFalse].has_type = 1;
+    table[spv::OpSpecConstant].has_type = 1;
+    table[spv::OpSpecConstantComposite].has_type = 1;
+    table[spv::OpSpecConstantOp].has_type = 1;
+    table[spv::OpFunction].has_type = 1;
+    table[spv::OpFunctionParameter].has_type = 1;
+    table[spv::OpFunctionCall].has_type = 1;
+    table[spv::OpVariable].has_type = 1;
+    table[spv::OpImageTexelPointer].has_type = 1;
+    table[spv::OpLoad].has_type = 1;
+    table[spv::OpAccessChain].has_type = 1;
+    table[spv::OpInBoundsAccessChain].has_type = 1;
+    table[spv::OpPtrAccessChain].has_type = 1;
+    table[spv::OpArrayLength].has_type = 1;
+    table[spv::OpInBoundsPtrAccessChain].has_type = 1;
+    table[spv::OpVectorExtractDynamic].has_type = 1;
+    table[spv::OpVectorInsertDynamic].has_type = 1;
+    table[spv::OpVectorShuffle].has_type = 1;
+    table[spv::OpCompositeConstruct].has_type = 1;
+    table[spv::OpCompositeExtract].has_type = 1;
+    table[spv::OpCompositeInsert].has_type = 1;
+    table[spv::OpCopyObject].has_type = 1;
+    table[spv::OpTranspose].has_type = 1;
+    table[spv::OpSampledImage].has_type = 1;
+    table[spv::OpImageSampleImplicitLod].has_type = 1;
+    table[spv::OpImageSampleExplicitLod].has_type = 1;
+    table[spv::OpImageSampleDrefImplicitLod].has_type = 1;
+    table[spv::OpImageSampleDrefExplicitLod].has_type = 1;
+    table[spv::OpImageSampleProjImplicitLod].has_type = 1;
+    table[spv::OpImageSampleProjExplicitLod].has_type = 1;
+    table[spv::OpImageSampleProjDrefImplicitLod].has_type = 1;
+    table[spv::OpImageSampleProjDrefExplicitLod].has_type = 1;
+    table[spv::OpImageFetch].has_type = 1;
+    table[spv::OpImageGather].has_type = 1;
+    table[spv::OpImageDrefGather].has_type = 1;
+    table[spv::OpImageRead].has_type = 1;
+    table[spv::OpImage].has_type = 1;
+    table[spv::OpImageQuerySizeLod].has_type = 1;
+    table[spv::OpImageQuerySize].has_type = 1;
+    table[spv::OpImageQueryLod].has_type = 1;
+    table[spv::OpImageQueryLevels].has_type = 1;
+    table[spv::OpImageQuerySamples].has_type = 1;
+    table[spv::OpConvertFToU].has_type = 1;
+    table[spv::OpConvertFToS].has_type = 1;
+    table[spv::OpConvertSToF].has_type = 1;
+    table[spv::OpConvertUToF].has_type = 1;
+    table[spv::OpUConvert].has_type = 1;
+    table[spv::OpSConvert].has_type = 1;
+    table[spv::OpFConvert].has_type = 1;
+    table[spv::OpQuantizeToF16].has_type = 1;
+    table[spv::OpConvertPtrToU].has_type = 1;
+    table[spv::OpConvertUToPtr].has_type = 1;
+    table[spv::OpBitcast].has_type = 1;
+    table[spv::OpSNegate].has_type = 1;
+    table[spv::OpFNegate].has_type = 1;
+    table[spv::OpIAdd].has_type = 1;
+    table[spv::OpFAdd].has_type = 1;
+    table[spv::OpISub].has_type = 1;
+    table[spv::OpFSub].has_type = 1;
+    table[spv::OpIMul].has_type = 1;
+    table[spv::OpFMul].has_type = 1;
+    table[spv::OpUDiv].has_type = 1;
+    table[spv::OpSDiv].has_type = 1;
+    table[spv::OpFDiv].has_type = 1;
+    table[spv::OpUMod].has_type = 1;
+    table[spv::OpSRem].has_type = 1;
+    table[spv::OpSMod].has_type = 1;
+    table[spv::OpFRem].has_type = 1;
+    table[spv::OpFMod].has_type = 1;
+    table[spv::OpVectorTimesScalar].has_type = 1;
+    table[spv::OpMatrixTimesScalar].has_type = 1;
+    table[spv::OpVectorTimesMatrix].has_type = 1;
+    table[spv::OpMatrixTimesVector].has_type = 1;
+    table[spv::OpMatrixTimesMatrix].has_type = 1;
+    table[spv::OpOuterProduct].has_type = 1;
+    table[spv::OpDot].has_type = 1;
+    table[spv::OpIAddCarry].has_type = 1;
+    table[spv::OpISubBorrow].has_type = 1;
+    table[spv::OpUMulExtended].has_type = 1;
+    table[spv::OpSMulExtended].has_type = 1;
+    table[spv::OpAny].has_type = 1;
+    table[spv::OpAll].has_type = 1;
+    table[spv::OpIsNan].has_type = 1;
+    table[spv::OpIsInf].has_type = 1;
+    table[spv::OpLogicalEqual].has_type = 1;
+    table[spv::OpLogicalNotEqual].has_type = 1;
+    table[spv::OpLogicalOr].has_type = 1;
+    table[spv::OpLogicalAnd].has_type = 1;
+    table[spv::OpLogicalNot].has_type = 1;
+    table[spv::OpSelect].has_type = 1;
+    table[spv::OpIEqual].has_type = 1;
+    table[spv::OpINotEqual].has_type = 1;
+    table[spv::OpUGreaterThan].has_type = 1;
+    table[spv::OpSGreaterThan].has_type = 1;
+    table[spv::OpUGreaterThanEqual].has_type = 1;
+    table[spv::OpSGreaterThanEqual].has_type = 1;
+    table[spv::OpULessThan].has_type = 1;
+    table[spv::OpSLessThan].has_type = 1;
+    table[spv::OpULessThanEqual].has_type = 1;
+    table[spv::OpSLessThanEqual].has_type = 1;
+    table[spv::OpFOrdEqual].has_type = 1;
+    table[spv::OpFUnordEqual].has_type = 1;
+    table[spv::OpFOrdNotEqual].has_type = 1;
+    table[spv::OpFUnordNotEqual].has_type = 1;
+    table[spv::OpFOrdLessThan].has_type = 1;
+    table[spv::OpFUnordLessThan].has_type = 1;
+    table[spv::OpFOrdGreaterThan].has_type = 1;
+    table[spv::OpFUnordGreaterThan].has_type = 1;
+    table[spv::OpFOrdLessThanEqual].has_type = 1;
+    table[spv::OpFUnordLessThanEqual].has_type = 1;
+    table[spv::OpFOrdGreaterThanEqual].has_type = 1;
+    table[spv::OpFUnordGreaterThanEqual].has_type = 1;
+    table[spv::OpShiftRightLogical].has_type = 1;
+    table[spv::OpShiftRightArithmetic].has_type = 1;
+    table[spv::OpShiftLeftLogical].has_type = 1;
+    table[spv::OpBitwiseOr].has_type = 1;
+    table[spv::OpBitwiseXor].has_type = 1;
+    table[spv::OpBitwiseAnd].has_type = 1;
+    table[spv::OpNot].has_type = 1;
+    table[spv::OpBitFieldInsert].has_type = 1;
+    table[spv::OpBitFieldSExtract].has_type = 1;
+    table[spv::OpBitFieldUExtract].has_type = 1;
+    table[spv::OpBitReverse].has_type = 1;
+    table[spv::OpBitCount].has_type = 1;
+    table[spv::OpDPdx].has_type = 1;
+    table[spv::OpDPdy].has_type = 1;
+    table[spv::OpFwidth].has_type = 1;
+    table[spv::OpDPdxFine].has_type = 1;
+    table[spv::OpDPdyFine].has_type = 1;
+    table[spv::OpFwidthFine].has_type = 1;
+    table[spv::OpDPdxCoarse].has_type = 1;
+    table[spv::OpDPdyCoarse].has_type = 1;
+    table[spv::OpFwidthCoarse].has_type = 1;
+    table[spv::OpAtomicLoad].has_type = 1;
+    table[spv::OpAtomicExchange].has_type = 1;
+    table[spv::OpAtomicCompareExchange].has_type = 1;
+    table[spv::OpAtomicIIncrement].has_type = 1;
+    table[spv::OpAtomicIDecrement].has_type = 1;
+    table[spv::OpAtomicIAdd].has_type = 1;
+    table[spv::OpAtomicISub].has_type = 1;
+    table[spv::OpAtomicSMin].has_type = 1;
+    table[spv::OpAtomicUMin].has_type = 1;
+    table[spv::OpAtomicSMax].has_type = 1;
+    table[spv::OpAtomicUMax].has_type = 1;
+    table[spv::OpAtomicAnd].has_type = 1;
+    table[spv::OpAtomicOr].has_type = 1;
+    table[spv::OpAtomicXor].has_type = 1;
+    table[spv::OpPhi].has_type = 1;
+    table[spv::OpGroupAll].has_type = 1;
+    table[spv::OpGroupAny].has_type = 1;
+    table[spv::OpGroupBroadcast].has_type = 1;
+    table[spv::OpGroupIAdd].has_type = 1;
+    table[spv::OpGroupFAdd].has_type = 1;
+    table[spv::OpGroupFMin].has_type = 1;
+    table[spv::OpGroupUMin].has_type = 1;
+    table[spv::OpGroupSMin].has_type = 1;
+    table[spv::OpGroupFMax].has_type = 1;
+    table[spv::OpGroupUMax].has_type = 1;
+    table[spv::OpGroupSMax].has_type = 1;
+    table[spv::OpImageSparseSampleImplicitLod].has_type = 1;
+    table[spv::OpImageSparseSampleExplicitLod].has_type = 1;
+    table[spv::OpImageSparseSampleDrefImplicitLod].has_type = 1;
+    table[spv::OpImageSparseSampleDrefExplicitLod].has_type = 1;
+    table[spv::OpImageSparseSampleProjImplicitLod].has_type = 1;
+    table[spv::OpImageSparseSampleProjExplicitLod].has_type = 1;
+    table[spv::OpImageSparseSampleProjDrefImplicitLod].has_type = 1;
+    table[spv::OpImageSparseSampleProjDrefExplicitLod].has_type = 1;
+    table[spv::OpImageSparseFetch].has_type = 1;
+    table[spv::OpImageSparseGather].has_type = 1;
+    table[spv::OpImageSparseDrefGather].has_type = 1;
+    table[spv::OpImageSparseTexelsResident].has_type = 1;
+    table[spv::OpImageSparseRead].has_type = 1;
+    table[spv::OpSizeOf].has_type = 1;
+    table[spv::OpConstantPipeStorage].has_type = 1;
+    table[spv::OpCreatePipeFromPipeStorage].has_type = 1;
+    table[spv::OpGetKernelLocalSizeForSubgroupCount].has_type = 1;
+    table[spv::OpGetKernelMaxNumSubgroups].has_type = 1;
+    table[spv::OpGroupNonUniformElect].has_type = 1;
+    table[spv::OpGroupNonUniformAll].has_type = 1;
+    table[spv::OpGroupNonUniformAny].has_type = 1;
+    table[spv::OpGroupNonUniformAllEqual].has_type = 1;
+    table[spv::OpGroupNonUniformBroadcast].has_type = 1;
+    table[spv::OpGroupNonUniformBroadcastFirst].has_type = 1;
+    table[spv::OpGroupNonUniformBallot].has_type = 1;
+    table[spv::OpGroupNonUniformInverseBallot].has_type = 1;
+    table[spv::OpGroupNonUniformBallotBitExtract].has_type = 1;
+    table[spv::OpGroupNonUniformBallotBitCount].has_type = 1;
+    table[spv::OpGroupNonUniformBallotFindLSB].has_type = 1;
+    table[spv::OpGroupNonUniformBallotFindMSB].has_type = 1;
+    table[spv::OpGroupNonUniformShuffle].has_type = 1;
+    table[spv::OpGroupNonUniformShuffleXor].has_type = 1;
+    table[spv::OpGroupNonUniformShuffleUp].has_type = 1;
+    table[spv::OpGroupNonUniformShuffleDown].has_type = 1;
+    table[spv::OpGroupNonUniformIAdd].has_type = 1;
+    table[spv::OpGroupNonUniformFAdd].has_type = 1;
+    table[spv::OpGroupNonUniformIMul].has_type = 1;
+    table[spv::OpGroupNonUniformFMul].has_type = 1;
+    table[spv::OpGroupNonUniformSMin].has_type = 1;
+    table[spv::OpGroupNonUniformUMin].has_type = 1;
+    table[spv::OpGroupNonUniformFMin].has_type = 1;
+    table[spv::OpGroupNonUniformSMax].has_type = 1;
+    table[spv::OpGroupNonUniformUMax].has_type = 1;
+    table[spv::OpGroupNonUniformFMax].has_type = 1;
+    table[spv::OpGroupNonUniformBitwiseAnd].has_type = 1;
+    table[spv::OpGroupNonUniformBitwiseOr].has_type = 1;
+    table[spv::OpGroupNonUniformBitwiseXor].has_type = 1;
+    table[spv::OpGroupNonUniformLogicalAnd].has_type = 1;
+    table[spv::OpGroupNonUniformLogicalOr].has_type = 1;
+    table[spv::OpGroupNonUniformLogicalXor].has_type = 1;
+    table[spv::OpGroupNonUniformQuadBroadcast].has_type = 1;
+    table[spv::OpGroupNonUniformQuadSwap].has_type = 1;
+    table[spv::OpCopyLogical].has_type = 1;
+    table[spv::OpPtrEqual].has_type = 1;
+    table[spv::OpPtrNotEqual].has_type = 1;
+    table[spv::OpPtrDiff].has_type = 1;
+    table[spv::OpColorAttachmentReadEXT].has_type = 1;
+    table[spv::OpDepthAttachmentReadEXT].has_type = 1;
+    table[spv::OpStencilAttachmentReadEXT].has_type = 1;
+    table[spv::OpSubgroupBallotKHR].has_type = 1;
+    table[spv::OpSubgroupFirstInvocationKHR].has_type = 1;
+    table[spv::OpSubgroupAllKHR].has_type = 1;
+    table[spv::OpSubgroupAnyKHR].has_type = 1;
+    table[spv::OpSubgroupAllEqualKHR].has_type = 1;
+    table[spv::OpGroupNonUniformRotateKHR].has_type = 1;
+    table[spv::OpSubgroupReadInvocationKHR].has_type = 1;
+    table[spv::OpConvertUToAccelerationStructureKHR].has_type = 1;
+    table[spv::OpSDot].has_type = 1;
+    table[spv::OpUDot].has_type = 1;
+    table[spv::OpSUDot].has_type = 1;
+    table[spv::OpSDotAccSat].has_type = 1;
+    table[spv::OpUDotAccSat].has_type = 1;
+    table[spv::OpSUDotAccSat].has_type = 1;
+    table[spv::OpCooperativeMatrixLoadKHR].has_type = 1;
+    table[spv::OpCooperativeMatrixMulAddKHR].has_type = 1;
+    table[spv::OpCooperativeMatrixLengthKHR].has_type = 1;
+    table[spv::OpRayQueryProceedKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionTypeKHR].has_type = 1;
+    table[spv::OpImageSampleWeightedQCOM].has_type = 1;
+    table[spv::OpImageBoxFilterQCOM].has_type = 1;
+    table[spv::OpImageBlockMatchSSDQCOM].has_type = 1;
+    table[spv::OpImageBlockMatchSADQCOM].has_type = 1;
+    table[spv::OpGroupIAddNonUniformAMD].has_type = 1;
+    table[spv::OpGroupFAddNonUniformAMD].has_type = 1;
+    table[spv::OpGroupFMinNonUniformAMD].has_type = 1;
+    table[spv::OpGroupUMinNonUniformAMD].has_type = 1;
+    table[spv::OpGroupSMinNonUniformAMD].has_type = 1;
+    table[spv::OpGroupFMaxNonUniformAMD].has_type = 1;
+    table[spv::OpGroupUMaxNonUniformAMD].has_type = 1;
+    table[spv::OpGroupSMaxNonUniformAMD].has_type = 1;
+    table[spv::OpFragmentMaskFetchAMD].has_type = 1;
+    table[spv::OpFragmentFetchAMD].has_type = 1;
+    table[spv::OpReadClockKHR].has_type = 1;
+    table[spv::OpFinishWritingNodePayloadAMDX].has_type = 1;
+    table[spv::OpHitObjectGetWorldToObjectNV].has_type = 1;
+    table[spv::OpHitObjectGetObjectToWorldNV].has_type = 1;
+    table[spv::OpHitObjectGetObjectRayDirectionNV].has_type = 1;
+    table[spv::OpHitObjectGetObjectRayOriginNV].has_type = 1;
+    table[spv::OpHitObjectGetShaderRecordBufferHandleNV].has_type = 1;
+    table[spv::OpHitObjectGetShaderBindingTableRecordIndexNV].has_type = 1;
+    table[spv::OpHitObjectGetCurrentTimeNV].has_type = 1;
+    table[spv::OpHitObjectGetHitKindNV].has_type = 1;
+    table[spv::OpHitObjectGetPrimitiveIndexNV].has_type = 1;
+    table[spv::OpHitObjectGetGeometryIndexNV].has_type = 1;
+    table[spv::OpHitObjectGetInstanceIdNV].has_type = 1;
+    table[spv::OpHitObjectGetInstanceCustomIndexNV].has_type = 1;
+    table[spv::OpHitObjectGetWorldRayDirectionNV].has_type = 1;
+    table[spv::OpHitObjectGetWorldRayOriginNV].has_type = 1;
+    table[spv::OpHitObjectGetRayTMaxNV].has_type = 1;
+    table[spv::OpHitObjectGetRayTMinNV].has_type = 1;
+    table[spv::OpHitObjectIsEmptyNV].has_type = 1;
+    table[spv::OpHitObjectIsHitNV].has_type = 1;
+    table[spv::OpHitObjectIsMissNV].has_type = 1;
+    table[spv::OpImageSampleFootprintNV].has_type = 1;
+    table[spv::OpGroupNonUniformPartitionNV].has_type = 1;
+    table[spv::OpFetchMicroTriangleVertexPositionNV].has_type = 1;
+    table[spv::OpFetchMicroTriangleVertexBarycentricNV].has_type = 1;
+    table[spv::OpReportIntersectionNV].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionTriangleVertexPositionsKHR].has_type = 1;
+    table[spv::OpCooperativeMatrixLoadNV].has_type = 1;
+    table[spv::OpCooperativeMatrixMulAddNV].has_type = 1;
+    table[spv::OpCooperativeMatrixLengthNV].has_type = 1;
+    table[spv::OpIsHelperInvocationEXT].has_type = 1;
+    table[spv::OpConvertUToImageNV].has_type = 1;
+    table[spv::OpConvertUToSamplerNV].has_type = 1;
+    table[spv::OpConvertImageToUNV].has_type = 1;
+    table[spv::OpConvertSamplerToUNV].has_type = 1;
+    table[spv::OpConvertUToSampledImageNV].has_type = 1;
+    table[spv::OpConvertSampledImageToUNV].has_type = 1;
+    table[spv::OpSubgroupShuffleINTEL].has_type = 1;
+    table[spv::OpSubgroupShuffleDownINTEL].has_type = 1;
+    table[spv::OpSubgroupShuffleUpINTEL].has_type = 1;
+    table[spv::OpSubgroupShuffleXorINTEL].has_type = 1;
+    table[spv::OpSubgroupBlockReadINTEL].has_type = 1;
+    table[spv::OpSubgroupImageBlockReadINTEL].has_type = 1;
+    table[spv::OpSubgroupImageMediaBlockReadINTEL].has_type = 1;
+    table[spv::OpUCountLeadingZerosINTEL].has_type = 1;
+    table[spv::OpUCountTrailingZerosINTEL].has_type = 1;
+    table[spv::OpAbsISubINTEL].has_type = 1;
+    table[spv::OpAbsUSubINTEL].has_type = 1;
+    table[spv::OpIAddSatINTEL].has_type = 1;
+    table[spv::OpUAddSatINTEL].has_type = 1;
+    table[spv::OpIAverageINTEL].has_type = 1;
+    table[spv::OpUAverageINTEL].has_type = 1;
+    table[spv::OpIAverageRoundedINTEL].has_type = 1;
+    table[spv::OpUAverageRoundedINTEL].has_type = 1;
+    table[spv::OpISubSatINTEL].has_type = 1;
+    table[spv::OpUSubSatINTEL].has_type = 1;
+    table[spv::OpIMul32x16INTEL].has_type = 1;
+    table[spv::OpUMul32x16INTEL].has_type = 1;
+    table[spv::OpConstantFunctionPointerINTEL].has_type = 1;
+    table[spv::OpFunctionPointerCallINTEL].has_type = 1;
+    table[spv::OpAsmTargetINTEL].has_type = 1;
+    table[spv::OpAsmINTEL].has_type = 1;
+    table[spv::OpAsmCallINTEL].has_type = 1;
+    table[spv::OpAtomicFMinEXT].has_type = 1;
+    table[spv::OpAtomicFMaxEXT].has_type = 1;
+    table[spv::OpExpectKHR].has_type = 1;
+    table[spv::OpVariableLengthArrayINTEL].has_type = 1;
+    table[spv::OpSaveMemoryINTEL].has_type = 1;
+    table[spv::OpPtrCastToCrossWorkgroupINTEL].has_type = 1;
+    table[spv::OpCrossWorkgroupCastToPtrINTEL].has_type = 1;
+    table[spv::OpReadPipeBlockingINTEL].has_type = 1;
+    table[spv::OpWritePipeBlockingINTEL].has_type = 1;
+    table[spv::OpFPGARegINTEL].has_type = 1;
+    table[spv::OpRayQueryGetRayTMinKHR].has_type = 1;
+    table[spv::OpRayQueryGetRayFlagsKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionTKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionInstanceCustomIndexKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionInstanceIdKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionGeometryIndexKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionPrimitiveIndexKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionBarycentricsKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionFrontFaceKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionCandidateAABBOpaqueKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionObjectRayDirectionKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionObjectRayOriginKHR].has_type = 1;
+    table[spv::OpRayQueryGetWorldRayDirectionKHR].has_type = 1;
+    table[spv::OpRayQueryGetWorldRayOriginKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionObjectToWorldKHR].has_type = 1;
+    table[spv::OpRayQueryGetIntersectionWorldToObjectKHR].has_type = 1;
+    table[spv::OpAtomicFAddEXT].has_type = 1;
+    table[spv::OpCompositeConstructContinuedINTEL].has_type = 1;
+    table[spv::OpConvertFToBF16INTEL].has_type = 1;
+    table[spv::OpConvertBF16ToFINTEL].has_type = 1;
+    table[spv::OpGroupIMulKHR].has_type = 1;
+    table[spv::OpGroupFMulKHR].has_type = 1;
+    table[spv::OpGroupBitwiseAndKHR].has_type = 1;
+    table[spv::OpGroupBitwiseOrKHR].has_type = 1;
+    table[spv::OpGroupBitwiseXorKHR].has_type = 1;
+    table[spv::OpGroupLogicalAndKHR].has_type = 1;
+    table[spv::OpGroupLogicalOrKHR].has_type = 1;
+    table[spv::OpGroupLogicalXorKHR].has_type = 1;
 
-static constexpr bool AnnotationOperation(uint32_t opcode) {
-    switch (opcode) {
-        case spv::OpDecorate:
-        case spv::OpMemberDecorate:
-        case spv::OpDecorationGroup:
-        case spv::OpGroupDecorate:
-        case spv::OpGroupMemberDecorate:
-        case spv::OpDecorateId:
-        case spv::OpDecorateString:
-        case spv::OpMemberDecorateString:
-            return true;
-        default:
-            return false;
-    }
-}
+    table[spv::OpUndef].has_result = 1;
+    table[spv::OpString].has_result = 1;
+    table[spv::OpExtInstImport].has_result = 1;
+    table[spv::OpExtInst].has_result = 1;
+    table[spv::OpTypeVoid].has_result = 1;
+    table[spv::OpTypeBool].has_result = 1;
+    table[spv::OpTypeInt].has_result = 1;
+    table[spv::OpTypeFloat].has_result = 1;
+    table[spv::OpTypeVector].has_result = 1;
+    table[spv::OpTypeMatrix].has_result = 1;
+    table[spv::OpTypeImage].has_result = 1;
+    table[spv::OpTypeSampler].has_result = 1;
+    table[spv::OpTypeSampledImage].has_result = 1;
+    table[spv::OpTypeArray].has_result = 1;
+    table[spv::OpTypeRuntimeArray].has_result = 1;
+    table[spv::OpTypeStruct].has_result = 1;
+    table[spv::OpTypePointer].has_result = 1;
+    table[spv::OpTypeFunction].has_result = 1;
+    table[spv::OpConstantTrue].has_result = 1;
+    table[spv::OpConstantFalse].has_result = 1;
+    table[spv::OpConstant].has_result = 1;
+    table[spv::OpConstantComposite].has_result = 1;
+    table[spv::OpConstantNull].has_result = 1;
+    table[spv::OpSpecConstantTrue].has_result = 1;
+    table[spv::OpSpecConstantFalse].has_result = 1;
+    table[spv::OpSpecConstant].has_result = 1;
+    table[spv::OpSpecConstantComposite].has_result = 1;
+    table[spv::OpSpecConstantOp].has_result = 1;
+    table[spv::OpFunction].has_result = 1;
+    table[spv::OpFunctionParameter].has_result = 1;
+    table[spv::OpFunctionCall].has_result = 1;
+    table[spv::OpVariable].has_result = 1;
+    table[spv::OpImageTexelPointer].has_result = 1;
+    table[spv::OpLoad].has_result = 1;
+    table[spv::OpAccessChain].has_result = 1;
+    table[spv::OpInBoundsAccessChain].has_result = 1;
+    table[spv::OpPtrAccessChain].has_result = 1;
+    table[spv::OpArrayLength].has_result = 1;
+    table[spv::OpInBoundsPtrAccessChain].has_result = 1;
+    table[spv::OpDecorationGroup].has_result = 1;
+    table[spv::OpVectorExtractDynamic].has_result = 1;
+    table[spv::OpVectorInsertDynamic].has_result = 1;
+    table[spv::OpVectorShuffle].has_result = 1;
+    table[spv::OpCompositeConstruct].has_result = 1;
+    table[spv::OpCompositeExtract].has_result = 1;
+    table[spv::OpCompositeInsert].has_result = 1;
+    table[spv::OpCopyObject].has_result = 1;
+    table[spv::OpTranspose].has_result = 1;
+    table[spv::OpSampledImage].has_result = 1;
+    table[spv::OpImageSampleImplicitLod].has_result = 1;
+    table[spv::OpImageSampleExplicitLod].has_result = 1;
+    table[spv::OpImageSampleDrefImplicitLod].has_result = 1;
+    table[spv::OpImageSampleDrefExplicitLod].has_result = 1;
+    table[spv::OpImageSampleProjImplicitLod].has_result = 1;
+    table[spv::OpImageSampleProjExplicitLod].has_result = 1;
+    table[spv::OpImageSampleProjDrefImplicitLod].has_result = 1;
+    table[spv::OpImageSampleProjDrefExplicitLod].has_result = 1;
+    table[spv::OpImageFetch].has_result = 1;
+    table[spv::OpImageGather].has_result = 1;
+    table[spv::OpImageDrefGather].has_result = 1;
+    table[spv::OpImageRead].has_result = 1;
+    table[spv::OpImage].has_result = 1;
+    table[spv::OpImageQuerySizeLod].has_result = 1;
+    table[spv::OpImageQuerySize].has_result = 1;
+    table[spv::OpImageQueryLod].has_result = 1;
+    table[spv::OpImageQueryLevels].has_result = 1;
+    table[spv::OpImageQuerySamples].has_result = 1;
+    table[spv::OpConvertFToU].has_result = 1;
+    table[spv::OpConvertFToS].has_result = 1;
+    table[spv::OpConvertSToF].has_result = 1;
+    table[spv::OpConvertUToF].has_result = 1;
+    table[spv::OpUConvert].has_result = 1;
+    table[spv::OpSConvert].has_result = 1;
+    table[spv::OpFConvert].has_result = 1;
+    table[spv::OpQuantizeToF16].has_result = 1;
+    table[spv::OpConvertPtrToU].has_result = 1;
+    table[spv::OpConvertUToPtr].has_result = 1;
+    table[spv::OpBitcast].has_result = 1;
+    table[spv::OpSNegate].has_result = 1;
+    table[spv::OpFNegate].has_result = 1;
+    table[spv::OpIAdd].has_result = 1;
+    table[spv::OpFAdd].has_result = 1;
+    table[spv::OpISub].has_result = 1;
+    table[spv::OpFSub].has_result = 1;
+    table[spv::OpIMul].has_result = 1;
+    table[spv::OpFMul].has_result = 1;
+    table[spv::OpUDiv].has_result = 1;
+    table[spv::OpSDiv].has_result = 1;
+    table[spv::OpFDiv].has_result = 1;
+    table[spv::OpUMod].has_result = 1;
+    table[spv::OpSRem].has_result = 1;
+    table[spv::OpSMod].has_result = 1;
+    table[spv::OpFRem].has_result = 1;
+    table[spv::OpFMod].has_result = 1;
+    table[spv::OpVectorTimesScalar].has_result = 1;
+    table[spv::OpMatrixTimesScalar].has_result = 1;
+    table[spv::OpVectorTimesMatrix].has_result = 1;
+    table[spv::OpMatrixTimesVector].has_result = 1;
+    table[spv::OpMatrixTimesMatrix].has_result = 1;
+    table[spv::OpOuterProduct].has_result = 1;
+    table[spv::OpDot].has_result = 1;
+    table[spv::OpIAddCarry].has_result = 1;
+    table[spv::OpISubBorrow].has_result = 1;
+    table[spv::OpUMulExtended].has_result = 1;
+    table[spv::OpSMulExtended].has_result = 1;
+    table[spv::OpAny].has_result = 1;
+    table[spv::OpAll].has_result = 1;
+    table[spv::OpIsNan].has_result = 1;
+    table[spv::OpIsInf].has_result = 1;
+    table[spv::OpLogicalEqual].has_result = 1;
+    table[spv::OpLogicalNotEqual].has_result = 1;
+    table[spv::OpLogicalOr].has_result = 1;
+    table[spv::OpLogicalAnd].has_result = 1;
+    table[spv::OpLogicalNot].has_result = 1;
+    table[spv::OpSelect].has_result = 1;
+    table[spv::OpIEqual].has_result = 1;
+    table[spv::OpINotEqual].has_result = 1;
+    table[spv::OpUGreaterThan].has_result = 1;
+    table[spv::OpSGreaterThan].has_result = 1;
+    table[spv::OpUGreaterThanEqual].has_result = 1;
+    table[spv::OpSGreaterThanEqual].has_result = 1;
+    table[spv::OpULessThan].has_result = 1;
+    table[spv::OpSLessThan].has_result = 1;
+    table[spv::OpULessThanEqual].has_result = 1;
+    table[spv::OpSLessThanEqual].has_result = 1;
+    table[spv::OpFOrdEqual].has_result = 1;
+    table[spv::OpFUnordEqual].has_result = 1;
+    table[spv::OpFOrdNotEqual].has_result = 1;
+    table[spv::OpFUnordNotEqual].has_result = 1;
+    table[spv::OpFOrdLessThan].has_result = 1;
+    table[spv::OpFUnordLessThan].has_result = 1;
+    table[spv::OpFOrdGreaterThan].has_result = 1;
+    table[spv::OpFUnordGreaterThan].has_result = 1;
+    table[spv::OpFOrdLessThanEqual].has_result = 1;
+    table[spv::OpFUnordLessThanEqual].has_result = 1;
+    table[spv::OpFOrdGreaterThanEqual].has_result = 1;
+    table[spv::OpFUnordGreaterThanEqual].has_result = 1;
+    table[spv::OpShiftRightLogical].has_result = 1;
+    table[spv::OpShiftRightArithmetic].has_result = 1;
+    table[spv::OpShiftLeftLogical].has_result = 1;
+    table[spv::OpBitwiseOr].has_result = 1;
+    table[spv::OpBitwiseXor].has_result = 1;
+    table[spv::OpBitwiseAnd].has_result = 1;
+    table[spv::OpNot].has_result = 1;
+    table[spv::OpBitFieldInsert].has_result = 1;
+    table[spv::OpBitFieldSExtract].has_result = 1;
+    table[spv::OpBitFieldUExtract].has_result = 1;
+    table[spv::OpBitReverse].has_result = 1;
+    table[spv::OpBitCount].has_result = 1;
+    table[spv::OpDPdx].has_result = 1;
+    table[spv::OpDPdy].has_result = 1;
+    table[spv::OpFwidth].has_result = 1;
+    table[spv::OpDPdxFine].has_result = 1;
+    table[spv::OpDPdyFine].has_result = 1;
+    table[spv::OpFwidthFine].has_result = 1;
+    table[spv::OpDPdxCoarse].has_result = 1;
+    table[spv::OpDPdyCoarse].has_result = 1;
+    table[spv::OpFwidthCoarse].has_result = 1;
+    table[spv::OpAtomicLoad].has_result = 1;
+    table[spv::OpAtomicExchange].has_result = 1;
+    table[spv::OpAtomicCompareExchange].has_result = 1;
+    table[spv::OpAtomicIIncrement].has_result = 1;
+    table[spv::OpAtomicIDecrement].has_result = 1;
+    table[spv::OpAtomicIAdd].has_result = 1;
+    table[spv::OpAtomicISub].has_result = 1;
+    table[spv::OpAtomicSMin].has_result = 1;
+    table[spv::OpAtomicUMin].has_result = 1;
+    table[spv::OpAtomicSMax].has_result = 1;
+    table[spv::OpAtomicUMax].has_result = 1;
+    table[spv::OpAtomicAnd].has_result = 1;
+    table[spv::OpAtomicOr].has_result = 1;
+    table[spv::OpAtomicXor].has_result = 1;
+    table[spv::OpPhi].has_result = 1;
+    table[spv::OpLabel].has_result = 1;
+    table[spv::OpGroupAll].has_result = 1;
+    table[spv::OpGroupAny].has_result = 1;
+    table[spv::OpGroupBroadcast].has_result = 1;
+    table[spv::OpGroupIAdd].has_result = 1;
+    table[spv::OpGroupFAdd].has_result = 1;
+    table[spv::OpGroupFMin].has_result = 1;
+    table[spv::OpGroupUMin].has_result = 1;
+    table[spv::OpGroupSMin].has_result = 1;
+    table[spv::OpGroupFMax].has_result = 1;
+    table[spv::OpGroupUMax].has_result = 1;
+    table[spv::OpGroupSMax].has_result = 1;
+    table[spv::OpImageSparseSampleImplicitLod].has_result = 1;
+    table[spv::OpImageSparseSampleExplicitLod].has_result = 1;
+    table[spv::OpImageSparseSampleDrefImplicitLod].has_result = 1;
+    table[spv::OpImageSparseSampleDrefExplicitLod].has_result = 1;
+    table[spv::OpImageSparseSampleProjImplicitLod].has_result = 1;
+    table[spv::OpImageSparseSampleProjExplicitLod].has_result = 1;
+    table[spv::OpImageSparseSampleProjDrefImplicitLod].has_result = 1;
+    table[spv::OpImageSparseSampleProjDrefExplicitLod].has_result = 1;
+    table[spv::OpImageSparseFetch].has_result = 1;
+    table[spv::OpImageSparseGather].has_result = 1;
+    table[spv::OpImageSparseDrefGather].has_result = 1;
+    table[spv::OpImageSparseTexelsResident].has_result = 1;
+    table[spv::OpImageSparseRead].has_result = 1;
+    table[spv::OpSizeOf].has_result = 1;
+    table[spv::OpTypePipeStorage].has_result = 1;
+    table[spv::OpConstantPipeStorage].has_result = 1;
+    table[spv::OpCreatePipeFromPipeStorage].has_result = 1;
+    table[spv::OpGetKernelLocalSizeForSubgroupCount].has_result = 1;
+    table[spv::OpGetKernelMaxNumSubgroups].has_result = 1;
+    table[spv::OpGroupNonUniformElect].has_result = 1;
+    table[spv::OpGroupNonUniformAll].has_result = 1;
+    table[spv::OpGroupNonUniformAny].has_result = 1;
+    table[spv::OpGroupNonUniformAllEqual].has_result = 1;
+    table[spv::OpGroupNonUniformBroadcast].has_result = 1;
+    table[spv::OpGroupNonUniformBroadcastFirst].has_result = 1;
+    table[spv::OpGroupNonUniformBallot].has_result = 1;
+    table[spv::OpGroupNonUniformInverseBallot].has_result = 1;
+    table[spv::OpGroupNonUniformBallotBitExtract].has_result = 1;
+    table[spv::OpGroupNonUniformBallotBitCount].has_result = 1;
+    table[spv::OpGroupNonUniformBallotFindLSB].has_result = 1;
+    table[spv::OpGroupNonUniformBallotFindMSB].has_result = 1;
+    table[spv::OpGroupNonUniformShuffle].has_result = 1;
+    table[spv::OpGroupNonUniformShuffleXor].has_result = 1;
+    table[spv::OpGroupNonUniformShuffleUp].has_result = 1;
+    table[spv::OpGroupNonUniformShuffleDown].has_result = 1;
+    table[spv::OpGroupNonUniformIAdd].has_result = 1;
+    table[spv::OpGroupNonUniformFAdd].has_result = 1;
+    table[spv::OpGroupNonUniformIMul].has_result = 1;
+    table[spv::OpGroupNonUniformFMul].has_result = 1;
+    table[spv::OpGroupNonUniformSMin].has_result = 1;
+    table[spv::OpGroupNonUniformUMin].has_result = 1;
+    table[spv::OpGroupNonUniformFMin].has_result = 1;
+    table[spv::OpGroupNonUniformSMax].has_result = 1;
+    table[spv::OpGroupNonUniformUMax].has_result = 1;
+    table[spv::OpGroupNonUniformFMax].has_result = 1;
+    table[spv::OpGroupNonUniformBitwiseAnd].has_result = 1;
+    table[spv::OpGroupNonUniformBitwiseOr].has_result = 1;
+    table[spv::OpGroupNonUniformBitwiseXor].has_result = 1;
+    table[spv::OpGroupNonUniformLogicalAnd].has_result = 1;
+    table[spv::OpGroupNonUniformLogicalOr].has_result = 1;
+    table[spv::OpGroupNonUniformLogicalXor].has_result = 1;
+    table[spv::OpGroupNonUniformQuadBroadcast].has_result = 1;
+    table[spv::OpGroupNonUniformQuadSwap].has_result = 1;
+    table[spv::OpCopyLogical].has_result = 1;
+    table[spv::OpPtrEqual].has_result = 1;
+    table[spv::OpPtrNotEqual].has_result = 1;
+    table[spv::OpPtrDiff].has_result = 1;
+    table[spv::OpColorAttachmentReadEXT].has_result = 1;
+    table[spv::OpDepthAttachmentReadEXT].has_result = 1;
+    table[spv::OpStencilAttachmentReadEXT].has_result = 1;
+    table[spv::OpSubgroupBallotKHR].has_result = 1;
+    table[spv::OpSubgroupFirstInvocationKHR].has_result = 1;
+    table[spv::OpSubgroupAllKHR].has_result = 1;
+    table[spv::OpSubgroupAnyKHR].has_result = 1;
+    table[spv::OpSubgroupAllEqualKHR].has_result = 1;
+    table[spv::OpGroupNonUniformRotateKHR].has_result = 1;
+    table[spv::OpSubgroupReadInvocationKHR].has_result = 1;
+    table[spv::OpConvertUToAccelerationStructureKHR].has_result = 1;
+    table[spv::OpSDot].has_result = 1;
+    table[spv::OpUDot].has_result = 1;
+    table[spv::OpSUDot].has_result = 1;
+    table[spv::OpSDotAccSat].has_result = 1;
+    table[spv::OpUDotAccSat].has_result = 1;
+    table[spv::OpSUDotAccSat].has_result = 1;
+    table[spv::OpTypeCooperativeMatrixKHR].has_result = 1;
+    table[spv::OpCooperativeMatrixLoadKHR].has_result = 1;
+    table[spv::OpCooperativeMatrixMulAddKHR].has_result = 1;
+    table[spv::OpCooperativeMatrixLengthKHR].has_result = 1;
+    table[spv::OpTypeRayQueryKHR].has_result = 1;
+    table[spv::OpRayQueryProceedKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionTypeKHR].has_result = 1;
+    table[spv::OpImageSampleWeightedQCOM].has_result = 1;
+    table[spv::OpImageBoxFilterQCOM].has_result = 1;
+    table[spv::OpImageBlockMatchSSDQCOM].has_result = 1;
+    table[spv::OpImageBlockMatchSADQCOM].has_result = 1;
+    table[spv::OpGroupIAddNonUniformAMD].has_result = 1;
+    table[spv::OpGroupFAddNonUniformAMD].has_result = 1;
+    table[spv::OpGroupFMinNonUniformAMD].has_result = 1;
+    table[spv::OpGroupUMinNonUniformAMD].has_result = 1;
+    table[spv::OpGroupSMinNonUniformAMD].has_result = 1;
+    table[spv::OpGroupFMaxNonUniformAMD].has_result = 1;
+    table[spv::OpGroupUMaxNonUniformAMD].has_result = 1;
+    table[spv::OpGroupSMaxNonUniformAMD].has_result = 1;
+    table[spv::OpFragmentMaskFetchAMD].has_result = 1;
+    table[spv::OpFragmentFetchAMD].has_result = 1;
+    table[spv::OpReadClockKHR].has_result = 1;
+    table[spv::OpFinishWritingNodePayloadAMDX].has_result = 1;
+    table[spv::OpHitObjectGetWorldToObjectNV].has_result = 1;
+    table[spv::OpHitObjectGetObjectToWorldNV].has_result = 1;
+    table[spv::OpHitObjectGetObjectRayDirectionNV].has_result = 1;
+    table[spv::OpHitObjectGetObjectRayOriginNV].has_result = 1;
+    table[spv::OpHitObjectGetShaderRecordBufferHandleNV].has_result = 1;
+    table[spv::OpHitObjectGetShaderBindingTableRecordIndexNV].has_result = 1;
+    table[spv::OpHitObjectGetCurrentTimeNV].has_result = 1;
+    table[spv::OpHitObjectGetHitKindNV].has_result = 1;
+    table[spv::OpHitObjectGetPrimitiveIndexNV].has_result = 1;
+    table[spv::OpHitObjectGetGeometryIndexNV].has_result = 1;
+    table[spv::OpHitObjectGetInstanceIdNV].has_result = 1;
+    table[spv::OpHitObjectGetInstanceCustomIndexNV].has_result = 1;
+    table[spv::OpHitObjectGetWorldRayDirectionNV].has_result = 1;
+    table[spv::OpHitObjectGetWorldRayOriginNV].has_result = 1;
+    table[spv::OpHitObjectGetRayTMaxNV].has_result = 1;
+    table[spv::OpHitObjectGetRayTMinNV].has_result = 1;
+    table[spv::OpHitObjectIsEmptyNV].has_result = 1;
+    table[spv::OpHitObjectIsHitNV].has_result = 1;
+    table[spv::OpHitObjectIsMissNV].has_result = 1;
+    table[spv::OpTypeHitObjectNV].has_result = 1;
+    table[spv::OpImageSampleFootprintNV].has_result = 1;
+    table[spv::OpGroupNonUniformPartitionNV].has_result = 1;
+    table[spv::OpFetchMicroTriangleVertexPositionNV].has_result = 1;
+    table[spv::OpFetchMicroTriangleVertexBarycentricNV].has_result = 1;
+    table[spv::OpReportIntersectionNV].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionTriangleVertexPositionsKHR].has_result = 1;
+    table[spv::OpTypeAccelerationStructureKHR].has_result = 1;
+    table[spv::OpTypeCooperativeMatrixNV].has_result = 1;
+    table[spv::OpCooperativeMatrixLoadNV].has_result = 1;
+    table[spv::OpCooperativeMatrixMulAddNV].has_result = 1;
+    table[spv::OpCooperativeMatrixLengthNV].has_result = 1;
+    table[spv::OpIsHelperInvocationEXT].has_result = 1;
+    table[spv::OpConvertUToImageNV].has_result = 1;
+    table[spv::OpConvertUToSamplerNV].has_result = 1;
+    table[spv::OpConvertImageToUNV].has_result = 1;
+    table[spv::OpConvertSamplerToUNV].has_result = 1;
+    table[spv::OpConvertUToSampledImageNV].has_result = 1;
+    table[spv::OpConvertSampledImageToUNV].has_result = 1;
+    table[spv::OpSubgroupShuffleINTEL].has_result = 1;
+    table[spv::OpSubgroupShuffleDownINTEL].has_result = 1;
+    table[spv::OpSubgroupShuffleUpINTEL].has_result = 1;
+    table[spv::OpSubgroupShuffleXorINTEL].has_result = 1;
+    table[spv::OpSubgroupBlockReadINTEL].has_result = 1;
+    table[spv::OpSubgroupImageBlockReadINTEL].has_result = 1;
+    table[spv::OpSubgroupImageMediaBlockReadINTEL].has_result = 1;
+    table[spv::OpUCountLeadingZerosINTEL].has_result = 1;
+    table[spv::OpUCountTrailingZerosINTEL].has_result = 1;
+    table[spv::OpAbsISubINTEL].has_result = 1;
+    table[spv::OpAbsUSubINTEL].has_result = 1;
+    table[spv::OpIAddSatINTEL].has_result = 1;
+    table[spv::OpUAddSatINTEL].has_result = 1;
+    table[spv::OpIAverageINTEL].has_result = 1;
+    table[spv::OpUAverageINTEL].has_result = 1;
+    table[spv::OpIAverageRoundedINTEL].has_result = 1;
+    table[spv::OpUAverageRoundedINTEL].has_result = 1;
+    table[spv::OpISubSatINTEL].has_result = 1;
+    table[spv::OpUSubSatINTEL].has_result = 1;
+    table[spv::OpIMul32x16INTEL].has_result = 1;
+    table[spv::OpUMul32x16INTEL].has_result = 1;
+    table[spv::OpConstantFunctionPointerINTEL].has_result = 1;
+    table[spv::OpFunctionPointerCallINTEL].has_result = 1;
+    table[spv::OpAsmTargetINTEL].has_result = 1;
+    table[spv::OpAsmINTEL].has_result = 1;
+    table[spv::OpAsmCallINTEL].has_result = 1;
+    table[spv::OpAtomicFMinEXT].has_result = 1;
+    table[spv::OpAtomicFMaxEXT].has_result = 1;
+    table[spv::OpExpectKHR].has_result = 1;
+    table[spv::OpVariableLengthArrayINTEL].has_result = 1;
+    table[spv::OpSaveMemoryINTEL].has_result = 1;
+    table[spv::OpAliasDomainDeclINTEL].has_result = 1;
+    table[spv::OpAliasScopeDeclINTEL].has_result = 1;
+    table[spv::OpAliasScopeListDeclINTEL].has_result = 1;
+    table[spv::OpPtrCastToCrossWorkgroupINTEL].has_result = 1;
+    table[spv::OpCrossWorkgroupCastToPtrINTEL].has_result = 1;
+    table[spv::OpReadPipeBlockingINTEL].has_result = 1;
+    table[spv::OpWritePipeBlockingINTEL].has_result = 1;
+    table[spv::OpFPGARegINTEL].has_result = 1;
+    table[spv::OpRayQueryGetRayTMinKHR].has_result = 1;
+    table[spv::OpRayQueryGetRayFlagsKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionTKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionInstanceCustomIndexKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionInstanceIdKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionInstanceShaderBindingTableRecordOffsetKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionGeometryIndexKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionPrimitiveIndexKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionBarycentricsKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionFrontFaceKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionCandidateAABBOpaqueKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionObjectRayDirectionKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionObjectRayOriginKHR].has_result = 1;
+    table[spv::OpRayQueryGetWorldRayDirectionKHR].has_result = 1;
+    table[spv::OpRayQueryGetWorldRayOriginKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionObjectToWorldKHR].has_result = 1;
+    table[spv::OpRayQueryGetIntersectionWorldToObjectKHR].has_result = 1;
+    table[spv::OpAtomicFAddEXT].has_result = 1;
+    table[spv::OpTypeBufferSurfaceINTEL].has_result = 1;
+    table[spv::OpCompositeConstructContinuedINTEL].has_result = 1;
+    table[spv::OpConvertFToBF16INTEL].has_result = 1;
+    table[spv::OpConvertBF16ToFINTEL].has_result = 1;
+    table[spv::OpGroupIMulKHR].has_result = 1;
+    table[spv::OpGroupFMulKHR].has_result = 1;
+    table[spv::OpGroupBitwiseAndKHR].has_result = 1;
+    table[spv::OpGroupBitwiseOrKHR].has_result = 1;
+    table[spv::OpGroupBitwiseXorKHR].has_result = 1;
+    table[spv::OpGroupLogicalAndKHR].has_result = 1;
+    table[spv::OpGroupLogicalOrKHR].has_result = 1;
+    table[spv::OpGroupLogicalXorKHR].has_result = 1;
 
-static constexpr bool ImageGatherOperation(uint32_t opcode) {
-    switch (opcode) {
-        case spv::OpImageGather:
-        case spv::OpImageDrefGather:
-        case spv::OpImageSparseGather:
-        case spv::OpImageSparseDrefGather:
-            return true;
-        default:
-            return false;
-    }
-}
+    table[spv::OpAtomicLoad].atomic = 1;
+    table[spv::OpAtomicStore].atomic = 1;
+    table[spv::OpAtomicExchange].atomic = 1;
+    table[spv::OpAtomicCompareExchange].atomic = 1;
+    table[spv::OpAtomicIIncrement].atomic = 1;
+    table[spv::OpAtomicIDecrement].atomic = 1;
+    table[spv::OpAtomicIAdd].atomic = 1;
+    table[spv::OpAtomicISub].atomic = 1;
+    table[spv::OpAtomicSMin].atomic = 1;
+    table[spv::OpAtomicUMin].atomic = 1;
+    table[spv::OpAtomicSMax].atomic = 1;
+    table[spv::OpAtomicUMax].atomic = 1;
+    table[spv::OpAtomicAnd].atomic = 1;
+    table[spv::OpAtomicOr].atomic = 1;
+    table[spv::OpAtomicXor].atomic = 1;
+    table[spv::OpAtomicFMinEXT].atomic = 1;
+    table[spv::OpAtomicFMaxEXT].atomic = 1;
+    table[spv::OpAtomicFAddEXT].atomic = 1;
 
-static constexpr bool ImageFetchOperation(uint32_t opcode) {
-    switch (opcode) {
-        case spv::OpImageFetch:
-            return true;
-        default:
-            return false;
-    }
-}
+    table[spv::OpGroupNonUniformElect].group = 1;
+    table[spv::OpGroupNonUniformAll].group = 1;
+    table[spv::OpGroupNonUniformAny].group = 1;
+    table[spv::OpGroupNonUniformAllEqual].group = 1;
+    table[spv::OpGroupNonUniformBroadcast].group = 1;
+    table[spv::OpGroupNonUniformBroadcastFirst].group = 1;
+    table[spv::OpGroupNonUniformBallot].group = 1;
+    table[spv::OpGroupNonUniformInverseBallot].group = 1;
+    table[spv::OpGroupNonUniformBallotBitExtract].group = 1;
+    table[spv::OpGroupNonUniformBallotBitCount].group = 1;
+    table[spv::OpGroupNonUniformBallotFindLSB].group = 1;
+    table[spv::OpGroupNonUniformBallotFindMSB].group = 1;
+    table[spv::OpGroupNonUniformShuffle].group = 1;
+    table[spv::OpGroupNonUniformShuffleXor].group = 1;
+    table[spv::OpGroupNonUniformShuffleUp].group = 1;
+    table[spv::OpGroupNonUniformShuffleDown].group = 1;
+    table[spv::OpGroupNonUniformIAdd].group = 1;
+    table[spv::OpGroupNonUniformFAdd].group = 1;
+    table[spv::OpGroupNonUniformIMul].group = 1;
+    table[spv::OpGroupNonUniformFMul].group = 1;
+    table[spv::OpGroupNonUniformSMin].group = 1;
+    table[spv::OpGroupNonUniformUMin].group = 1;
+    table[spv::OpGroupNonUniformFMin].group = 1;
+    table[spv::OpGroupNonUniformSMax].group = 1;
+    table[spv::OpGroupNonUniformUMax].group = 1;
+    table[spv::OpGroupNonUniformFMax].group = 1;
+    table[spv::OpGroupNonUniformBitwiseAnd].group = 1;
+    table[spv::OpGroupNonUniformBitwiseOr].group = 1;
+    table[spv::OpGroupNonUniformBitwiseXor].group = 1;
+    table[spv::OpGroupNonUniformLogicalAnd].group = 1;
+    table[spv::OpGroupNonUniformLogicalOr].group = 1;
+    table[spv::OpGroupNonUniformLogicalXor].group = 1;
+    table[spv::OpGroupNonUniformQuadBroadcast].group = 1;
+    table[spv::OpGroupNonUniformQuadSwap].group = 1;
+    table[spv::OpGroupNonUniformPartitionNV].group = 1;
 
-static constexpr bool ImageSampleOperation(uint32_t opcode) {
-    switch (opcode) {
-        case spv::OpImageSampleImplicitLod:
-        case spv::OpImageSampleExplicitLod:
-        case spv::OpImageSampleDrefImplicitLod:
-        case spv::OpImageSampleDrefExplicitLod:
-        case spv::OpImageSampleProjImplicitLod:
-        case spv::OpImageSampleProjExplicitLod:
-        case spv::OpImageSampleProjDrefImplicitLod:
-        case spv::OpImageSampleProjDrefExplicitLod:
-        case spv::OpImageSampleWeightedQCOM:
-        case spv::OpImageSampleFootprintNV:
-            return true;
-        default:
-            return false;
-    }
+    table[spv::OpSourceContinued].debug = 1;
+    table[spv::OpSource].debug = 1;
+    table[spv::OpSourceExtension].debug = 1;
+    table[spv::OpName].debug = 1;
+    table[spv::OpMemberName].debug = 1;
+    table[spv::OpString].debug = 1;
+    table[spv::OpLine].debug = 1;
+    table[spv::OpNoLine].debug = 1;
+    table[spv::OpModuleProcessed].debug = 1;
+
+    table[spv::OpDecorate].annotation = 1;
+    table[spv::OpMemberDecorate].annotation = 1;
+    table[spv::OpDecorationGroup].annotation = 1;
+    table[spv::OpGroupDecorate].annotation = 1;
+    table[spv::OpGroupMemberDecorate].annotation = 1;
+    table[spv::OpDecorateId].annotation = 1;
+    table[spv::OpDecorateString].annotation = 1;
+    table[spv::OpMemberDecorateString].annotation = 1;
+
+    table[spv::OpImageGather].image_gather = 1;
+    table[spv::OpImageDrefGather].image_gather = 1;
+    table[spv::OpImageSparseGather].image_gather = 1;
+    table[spv::OpImageSparseDrefGather].image_gather = 1;
+
+    table[spv::OpImageFetch].image_fetch = 1;
+
+    table[spv::OpImageSampleImplicitLod].image_sample = 1;
+    table[spv::OpImageSampleExplicitLod].image_sample = 1;
+    table[spv::OpImageSampleDrefImplicitLod].image_sample = 1;
+    table[spv::OpImageSampleDrefExplicitLod].image_sample = 1;
+    table[spv::OpImageSampleProjImplicitLod].image_sample = 1;
+    table[spv::OpImageSampleProjExplicitLod].image_sample = 1;
+    table[spv::OpImageSampleProjDrefImplicitLod].image_sample = 1;
+    table[spv::OpImageSampleProjDrefExplicitLod].image_sample = 1;
+    table[spv::OpImageSampleWeightedQCOM].image_sample = 1;
+    table[spv::OpImageSampleFootprintNV].image_sample = 1;
+
+    table[spv::OpTypeVoid].spv_type = static_cast<uint32_t>(SpvType::kVoid);
+    table[spv::OpTypeBool].spv_type = static_cast<uint32_t>(SpvType::kBool);
+    table[spv::OpTypeInt].spv_type = static_cast<uint32_t>(SpvType::kInt);
+    table[spv::OpTypeFloat].spv_type = static_cast<uint32_t>(SpvType::kFloat);
+    table[spv::OpTypeVector].spv_type = static_cast<uint32_t>(SpvType::kVector);
+    table[spv::OpTypeMatrix].spv_type = static_cast<uint32_t>(SpvType::kMatrix);
+    table[spv::OpTypeImage].spv_type = static_cast<uint32_t>(SpvType::kImage);
+    table[spv::OpTypeSampler].spv_type = static_cast<uint32_t>(SpvType::kSampler);
+    table[spv::OpTypeSampledImage].spv_type = static_cast<uint32_t>(SpvType::kSampledImage);
+    table[spv::OpTypeArray].spv_type = static_cast<uint32_t>(SpvType::kArray);
+    table[spv::OpTypeRuntimeArray].spv_type = static_cast<uint32_t>(SpvType::kRuntimeArray);
+    table[spv::OpTypeStruct].spv_type = static_cast<uint32_t>(SpvType::kStruct);
+    table[spv::OpTypePointer].spv_type = static_cast<uint32_t>(SpvType::kPointer);
+    table[spv::OpTypeFunction].spv_type = static_cast<uint32_t>(SpvType::kFunction);
+    table[spv::OpTypeForwardPointer].spv_type = static_cast<uint32_t>(SpvType::kForwardPointer);
+    table[spv::OpTypePipeStorage].spv_type = static_cast<uint32_t>(SpvType::kPipeStorage);
+    table[spv::OpTypeCooperativeMatrixKHR].spv_type = static_cast<uint32_t>(SpvType::kCooperativeMatrixKHR);
+    table[spv::OpTypeRayQueryKHR].spv_type = static_cast<uint32_t>(SpvType::kRayQueryKHR);
+    table[spv::OpTypeHitObjectNV].spv_type = static_cast<uint32_t>(SpvType::kHitObjectNV);
+    table[spv::OpTypeAccelerationStructureKHR].spv_type = static_cast<uint32_t>(SpvType::kAccelerationStructureKHR);
+    table[spv::OpTypeCooperativeMatrixNV].spv_type = static_cast<uint32_t>(SpvType::kCooperativeMatrixNV);
+    table[spv::OpTypeBufferSurfaceINTEL].spv_type = static_cast<uint32_t>(SpvType::kBufferSurfaceINTEL);
+    table[spv::OpTypeStructContinuedINTEL].spv_type = static_cast<uint32_t>(SpvType::kStructContinuedINTEL);
+
+    table[spv::OpMemoryBarrier].memory_scope_position = 1;
+    table[spv::OpControlBarrier].memory_scope_position = 2;
+    table[spv::OpAtomicStore].memory_scope_position = 2;
+    table[spv::OpControlBarrierArriveINTEL].memory_scope_position = 2;
+    table[spv::OpControlBarrierWaitINTEL].memory_scope_position = 2;
+    table[spv::OpAtomicLoad].memory_scope_position = 4;
+    table[spv::OpAtomicExchange].memory_scope_position = 4;
+    table[spv::OpAtomicCompareExchange].memory_scope_position = 4;
+    table[spv::OpAtomicIIncrement].memory_scope_position = 4;
+    table[spv::OpAtomicIDecrement].memory_scope_position = 4;
+    table[spv::OpAtomicIAdd].memory_scope_position = 4;
+    table[spv::OpAtomicISub].memory_scope_position = 4;
+    table[spv::OpAtomicSMin].memory_scope_position = 4;
+    table[spv::OpAtomicUMin].memory_scope_position = 4;
+    table[spv::OpAtomicSMax].memory_scope_position = 4;
+    table[spv::OpAtomicUMax].memory_scope_position = 4;
+    table[spv::OpAtomicAnd].memory_scope_position = 4;
+    table[spv::OpAtomicOr].memory_scope_position = 4;
+    table[spv::OpAtomicXor].memory_scope_position = 4;
+    table[spv::OpAtomicFMinEXT].memory_scope_position = 4;
+    table[spv::OpAtomicFMaxEXT].memory_scope_position = 4;
+    table[spv::OpAtomicFAddEXT].memory_scope_position = 4;
+
+    table[spv::OpControlBarrier].execution_scope_position = 1;
+    table[spv::OpControlBarrierArriveINTEL].execution_scope_position = 1;
+    table[spv::OpControlBarrierWaitINTEL].execution_scope_position = 1;
+    table[spv::OpGroupAll].execution_scope_position = 3;
+    table[spv::OpGroupAny].execution_scope_position = 3;
+    table[spv::OpGroupBroadcast].execution_scope_position = 3;
+    table[spv::OpGroupIAdd].execution_scope_position = 3;
+    table[spv::OpGroupFAdd].execution_scope_position = 3;
+    table[spv::OpGroupFMin].execution_scope_position = 3;
+    table[spv::OpGroupUMin].execution_scope_position = 3;
+    table[spv::OpGroupSMin].execution_scope_position = 3;
+    table[spv::OpGroupFMax].execution_scope_position = 3;
+    table[spv::OpGroupUMax].execution_scope_position = 3;
+    table[spv::OpGroupSMax].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformElect].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformAll].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformAny].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformAllEqual].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformBroadcast].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformBroadcastFirst].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformBallot].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformInverseBallot].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformBallotBitExtract].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformBallotBitCount].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformBallotFindLSB].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformBallotFindMSB].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformShuffle].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformShuffleXor].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformShuffleUp].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformShuffleDown].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformIAdd].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformFAdd].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformIMul].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformFMul].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformSMin].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformUMin].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformFMin].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformSMax].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformUMax].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformFMax].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformBitwiseAnd].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformBitwiseOr].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformBitwiseXor].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformLogicalAnd].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformLogicalOr].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformLogicalXor].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformQuadBroadcast].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformQuadSwap].execution_scope_position = 3;
+    table[spv::OpGroupNonUniformRotateKHR].execution_scope_position = 3;
+    table[spv::OpTypeCooperativeMatrixKHR].execution_scope_position = 3;
+    table[spv::OpGroupIAddNonUniformAMD].execution_scope_position = 3;
+    table[spv::OpGroupFAddNonUniformAMD].execution_scope_position = 3;
+    table[spv::OpGroupFMinNonUniformAMD].execution_scope_position = 3;
+    table[spv::OpGroupUMinNonUniformAMD].execution_scope_position = 3;
+    table[spv::OpGroupSMinNonUniformAMD].execution_scope_position = 3;
+    table[spv::OpGroupFMaxNonUniformAMD].execution_scope_position = 3;
+    table[spv::OpGroupUMaxNonUniformAMD].execution_scope_position = 3;
+    table[spv::OpGroupSMaxNonUniformAMD].execution_scope_position = 3;
+    table[spv::OpReadClockKHR].execution_scope_position = 3;
+    table[spv::OpTypeCooperativeMatrixNV].execution_scope_position = 3;
+    table[spv::OpGroupIMulKHR].execution_scope_position = 3;
+    table[spv::OpGroupFMulKHR].execution_scope_position = 3;
+    table[spv::OpGroupBitwiseAndKHR].execution_scope_position = 3;
+    table[spv::OpGroupBitwiseOrKHR].execution_scope_position = 3;
+    table[spv::OpGroupBitwiseXorKHR].execution_scope_position = 3;
+    table[spv::OpGroupLogicalAndKHR].execution_scope_position = 3;
+    table[spv::OpGroupLogicalOrKHR].execution_scope_position = 3;
+    table[spv::OpGroupLogicalXorKHR].execution_scope_position = 3;
+
+    table[spv::OpImageWrite].image_operands_position = 4;
+    table[spv::OpImageSampleImplicitLod].image_operands_position = 5;
+    table[spv::OpImageSampleExplicitLod].image_operands_position = 5;
+    table[spv::OpImageSampleProjImplicitLod].image_operands_position = 5;
+    table[spv::OpImageSampleProjExplicitLod].image_operands_position = 5;
+    table[spv::OpImageFetch].image_operands_position = 5;
+    table[spv::OpImageRead].image_operands_position = 5;
+    table[spv::OpImageSparseSampleImplicitLod].image_operands_position = 5;
+    table[spv::OpImageSparseSampleExplicitLod].image_operands_position = 5;
+    table[spv::OpImageSparseSampleProjImplicitLod].image_operands_position = 5;
+    table[spv::OpImageSparseSampleProjExplicitLod].image_operands_position = 5;
+    table[spv::OpImageSparseFetch].image_operands_position = 5;
+    table[spv::OpImageSparseRead].image_operands_position = 5;
+    table[spv::OpImageSampleDrefImplicitLod].image_operands_position = 6;
+    table[spv::OpImageSampleDrefExplicitLod].image_operands_position = 6;
+    table[spv::OpImageSampleProjDrefImplicitLod].image_operands_position = 6;
+    table[spv::OpImageSampleProjDrefExplicitLod].image_operands_position = 6;
+    table[spv::OpImageGather].image_operands_position = 6;
+    table[spv::OpImageDrefGather].image_operands_position = 6;
+    table[spv::OpImageSparseSampleDrefImplicitLod].image_operands_position = 6;
+    table[spv::OpImageSparseSampleDrefExplicitLod].image_operands_position = 6;
+    table[spv::OpImageSparseSampleProjDrefImplicitLod].image_operands_position = 6;
+    table[spv::OpImageSparseSampleProjDrefExplicitLod].image_operands_position = 6;
+    table[spv::OpImageSparseGather].image_operands_position = 6;
+    table[spv::OpImageSparseDrefGather].image_operands_position = 6;
+    table[spv::OpImageSampleFootprintNV].image_operands_position = 7;
+
+    table[spv::OpImageWrite].image_access_position = 1;
+    table[spv::OpImageTexelPointer].image_access_position = 3;
+    table[spv::OpImageSampleImplicitLod].image_access_position = 3;
+    table[spv::OpImageSampleExplicitLod].image_access_position = 3;
+    table[spv::OpImageSampleDrefImplicitLod].image_access_position = 3;
+    table[spv::OpImageSampleDrefExplicitLod].image_access_position = 3;
+    table[spv::OpImageSampleProjImplicitLod].image_access_position = 3;
+    table[spv::OpImageSampleProjExplicitLod].image_access_position = 3;
+    table[spv::OpImageSampleProjDrefImplicitLod].image_access_position = 3;
+    table[spv::OpImageSampleProjDrefExplicitLod].image_access_position = 3;
+    table[spv::OpImageFetch].image_access_position = 3;
+    table[spv::OpImageGather].image_access_position = 3;
+    table[spv::OpImageDrefGather].image_access_position = 3;
+    table[spv::OpImageRead].image_access_position = 3;
+    table[spv::OpImage].image_access_position = 3;
+    table[spv::OpImageQuerySizeLod].image_access_position = 3;
+    table[spv::OpImageQuerySize].image_access_position = 3;
+    table[spv::OpImageQueryLod].image_access_position = 3;
+    table[spv::OpImageQueryLevels].image_access_position = 3;
+    table[spv::OpImageQuerySamples].image_access_position = 3;
+    table[spv::OpImageSparseSampleImplicitLod].image_access_position = 3;
+    table[spv::OpImageSparseSampleExplicitLod].image_access_position = 3;
+    table[spv::OpImageSparseSampleDrefImplicitLod].image_access_position = 3;
+    table[spv::OpImageSparseSampleDrefExplicitLod].image_access_position = 3;
+    table[spv::OpImageSparseSampleProjImplicitLod].image_access_position = 3;
+    table[spv::OpImageSparseSampleProjExplicitLod].image_access_position = 3;
+    table[spv::OpImageSparseSampleProjDrefImplicitLod].image_access_position = 3;
+    table[spv::OpImageSparseSampleProjDrefExplicitLod].image_access_position = 3;
+    table[spv::OpImageSparseFetch].image_access_position = 3;
+    table[spv::OpImageSparseGather].image_access_position = 3;
+    table[spv::OpImageSparseDrefGather].image_access_position = 3;
+    table[spv::OpImageSparseRead].image_access_position = 3;
+    table[spv::OpImageSampleFootprintNV].image_access_position = 3;
+
+    return table;
+}();
+
+static constexpr OpcodeInfo GetOpcodeInfo(uint32_t opcode) {
+    return opcode < kOpcodeInfoTableSize ? kOpcodeInfoTable[opcode] : OpcodeInfo{};
 }
 
+static constexpr bool OpcodeHasType(uint32_t opcode) { return GetOpcodeInfo(opcode).has_type; }
+static constexpr bool OpcodeHasResult(uint32_t opcode) { return GetOpcodeInfo(opcode).has_result; }
+
+// Any non supported operation will be covered with other VUs
+static constexpr bool AtomicOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).atomic; }
+// Any non supported operation will be covered with other VUs
+static constexpr bool GroupOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).group; }
+static constexpr bool DebugOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).debug; }
+static constexpr bool AnnotationOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).annotation; }
+
+static constexpr bool ImageGatherOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).image_gather; }
+static constexpr bool ImageFetchOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).image_fetch; }
+static constexpr bool ImageSampleOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).image_sample; }
+
+// Return operand position of Memory Scope <ID> or zero if there is none
+static constexpr uint32_t OpcodeMemoryScopePosition(uint32_t opcode) { return GetOpcodeInfo(opcode).memory_scope_position; }
+// Return operand position of Execution Scope <ID> or zero if there is none
+static constexpr uint32_t OpcodeExecutionScopePosition(uint32_t opcode) { return GetOpcodeInfo(opcode).execution_scope_position; }
+// Return operand position of Image Operands <ID> or zero if there is none
+static constexpr uint32_t OpcodeImageOperandsPosition(uint32_t opcode) { return GetOpcodeInfo(opcode).image_operands_position; }
+// Return operand position of 'Image' or 'Sampled Image' IdRef or zero if there is none.
+static constexpr uint32_t OpcodeImageAccessPosition(uint32_t opcode) { return GetOpcodeInfo(opcode).image_access_position; }
+
+static constexpr SpvType GetSpvType(uint32_t opcode) { return static_cast<SpvType>(GetOpcodeInfo(opcode).spv_type); }
+
 // Return number of optional parameter from ImageOperands
 static constexpr uint32_t ImageOperandsParamCount(uint32_t image_operand) {
     uint32_t count = 0;
@@ -979,291 +1178,6 @@ static constexpr uint32_t ImageOperandsParamCount(uint32_t image_operand) {
     return count;
 }
 
-// Return operand position of Memory Scope <ID> or zero if there is none
-static constexpr uint32_t OpcodeMemoryScopePosition(uint32_t opcode) {
-    uint32_t position = 0;
-    switch (opcode) {
-        case spv::OpMemoryBarrier:
-            return 1;
-        case spv::OpControlBarrier:
-        case spv::OpAtomicStore:
-        case spv::OpControlBarrierArriveINTEL:
-        case spv::OpControlBarrierWaitINTEL:
-            return 2;
-        case spv::OpAtomicLoad:
-        case spv::OpAtomicExchange:
-        case spv::OpAtomicCompareExchange:
-        case spv::OpAtomicIIncrement:
-        case spv::OpAtomicIDecrement:
-        case spv::OpAtomicIAdd:
-        case spv::OpAtomicISub:
-        case spv::OpAtomicSMin:
-        case spv::OpAtomicUMin:
-        case spv::OpAtomicSMax:
-        case spv::OpAtomicUMax:
-        case spv::OpAtomicAnd:
-        case spv::OpAtomicOr:
-        case spv::OpAtomicXor:
-        case spv::OpAtomicFMinEXT:
-        case spv::OpAtomicFMaxEXT:
-        case spv::OpAtomicFAddEXT:
-            return 4;
-
-        default:
-            break;
-    }
-    return position;
-}
-
-// Return operand position of Execution Scope <ID> or zero if there is none
-static constexpr uint32_t OpcodeExecutionScopePosition(uint32_t opcode) {
-    uint32_t position = 0;
-    switch (opcode) {
-        case spv::OpControlBarrier:
-        case spv::OpControlBarrierArriveINTEL:
-        case spv::OpControlBarrierWaitINTEL:
-            return 1;
-        case spv::OpGroupAll:
-        case spv::OpGroupAny:
-        case spv::OpGroupBroadcast:
-        case spv::OpGroupIAdd:
-        case spv::OpGroupFAdd:
-        case spv::OpGroupFMin:
-        case spv::OpGroupUMin:
-        case spv::OpGroupSMin:
-        case spv::OpGroupFMax:
-        case spv::OpGroupUMax:
-        case spv::OpGroupSMax:
-        case spv::OpGroupNonUniformElect:
-        case spv::OpGroupNonUniformAll:
-        case spv::OpGroupNonUniformAny:
-        case spv::OpGroupNonUniformAllEqual:
-        case spv::OpGroupNonUniformBroadcast:
-        case spv::OpGroupNonUniformBroadcastFirst:
-        case spv::OpGroupNonUniformBallot:
-        case spv::OpGroupNonUniformInverseBallot:
-        case spv::OpGroupNonUniformBallotBitExtract:
-        case spv::OpGroupNonUniformBallotBitCount:
-        case spv::OpGroupNonUniformBallotFindLSB:
-        case spv::OpGroupNonUniformBallotFindMSB:
-        case spv::OpGroupNonUniformShuffle:
-        case spv::OpGroupNonUniformShuffleXor:
-        case spv::OpGroupNonUniformShuffleUp:
-        case spv::OpGroupNonUniformShuffleDown:
-        case spv::OpGroupNonUniformIAdd:
-        case spv::OpGroupNonUniformFAdd:
-        case spv::OpGroupNonUniformIMul:
-        case spv::OpGroupNonUniformFMul:
-        case spv::OpGroupNonUniformSMin:
-        case spv::OpGroupNonUniformUMin:
-        case spv::OpGroupNonUniformFMin:
-        case spv::OpGroupNonUniformSMax:
-        case spv::OpGroupNonUniformUMax:
-        case spv::OpGroupNonUniformFMax:
-        case spv::OpGroupNonUniformBitwiseAnd:
-        case spv::OpGroupNonUniformBitwiseOr:
-        case spv::OpGroupNonUniformBitwiseXor:
-        case spv::OpGroupNonUniformLogicalAnd:
-        case spv::OpGroupNonUniformLogicalOr:
-        case spv::OpGroupNonUniformLogicalXor:
-        case spv::OpGroupNonUniformQuadBroadcast:
-        case spv::OpGroupNonUniformQuadSwap:
-        case spv::OpGroupNonUniformRotateKHR:
-        case spv::OpTypeCooperativeMatrixKHR:
-        case spv::OpGroupIAddNonUniformAMD:
-        case spv::OpGroupFAddNonUniformAMD:
-        case spv::OpGroupFMinNonUniformAMD:
-        case spv::OpGroupUMinNonUniformAMD:
-        case spv::OpGroupSMinNonUniformAMD:
-        case spv::OpGroupFMaxNonUniformAMD:
-        case spv::OpGroupUMaxNonUniformAMD:
-        case spv::OpGroupSMaxNonUniformAMD:
-        case spv::OpReadClockKHR:
-        case spv::OpTypeCooperativeMatrixNV:
-        case spv::OpGroupIMulKHR:
-        case spv::OpGroupFMulKHR:
-        case spv::OpGroupBitwiseAndKHR:
-        case spv::OpGroupBitwiseOrKHR:
-        case spv::OpGroupBitwiseXorKHR:
-        case spv::OpGroupLogicalAndKHR:
-        case spv::OpGroupLogicalOrKHR:
-        case spv::OpGroupLogicalXorKHR:
-            return 3;
-
-        default:
-            break;
-    }
-    return position;
-}
-
-// Return operand position of Image Operands <ID> or zero if there is none
-static constexpr uint32_t OpcodeImageOperandsPosition(uint32_t opcode) {
-    uint32_t position = 0;
-    switch (opcode) {
-        case spv::OpImageWrite:
-            return 4;
-        case spv::OpImageSampleImplicitLod:
-        case spv::OpImageSampleExplicitLod:
-        case spv::OpImageSampleProjImplicitLod:
-        case spv::OpImageSampleProjExplicitLod:
-        case spv::OpImageFetch:
-        case spv::OpImageRead:
-        case spv::OpImageSparseSampleImplicitLod:
-        case spv::OpImageSparseSampleExplicitLod:
-        case spv::OpImageSparseSampleProjImplicitLod:
-        case spv::OpImageSparseSampleProjExplicitLod:
-        case spv::OpImageSparseFetch:
-        case spv::OpImageSparseRead:
-            return 5;
-        case spv::OpImageSampleDrefImplicitLod:
-        case spv::OpImageSampleDrefExplicitLod:
-        case spv::OpImageSampleProjDrefImplicitLod:
-        case spv::OpImageSampleProjDrefExplicitLod:
-        case spv::OpImageGather:
-        case spv::OpImageDrefGather:
-        case spv::OpImageSparseSampleDrefImplicitLod:
-        case spv::OpImageSparseSampleDrefExplicitLod:
-        case spv::OpImageSparseSampleProjDrefImplicitLod:
-        case spv::OpImageSparseSampleProjDrefExplicitLod:
-        case spv::OpImageSparseGather:
-        case spv::OpImageSparseDrefGather:
-            return 6;
-        case spv::OpImageSampleFootprintNV:
-            return 7;
-
-        default:
-            break;
-    }
-    return position;
-}
-
-// Return operand position of 'Image' or 'Sampled Image' IdRef or zero if there is none.
-static constexpr uint32_t OpcodeImageAccessPosition(uint32_t opcode) {
-    uint32_t position = 0;
-    switch (opcode) {
-        case spv::OpImageWrite:
-            return 1;
-        case spv::OpImageTexelPointer:
-        case spv::OpImageSampleImplicitLod:
-        case spv::OpImageSampleExplicitLod:
-        case spv::OpImageSampleDrefImplicitLod:
-        case spv::OpImageSampleDrefExplicitLod:
-        case spv::OpImageSampleProjImplicitLod:
-        case spv::OpImageSampleProjExplicitLod:
-        case spv::OpImageSampleProjDrefImplicitLod:
-        case spv::OpImageSampleProjDrefExplicitLod:
-        case spv::OpImageFetch:
-        case spv::OpImageGather:
-        case spv::OpImageDrefGather:
-        case spv::OpImageRead:
-        case spv::OpImage:
-        case spv::OpImageQuerySizeLod:
-        case spv::OpImageQuerySize:
-        case spv::OpImageQueryLod:
-        case spv::OpImageQueryLevels:
-        case spv::OpImageQuerySamples:
-        case spv::OpImageSparseSampleImplicitLod:
-        case spv::OpImageSparseSampleExplicitLod:
-        case spv::OpImageSparseSampleDrefImplicitLod:
-        case spv::OpImageSparseSampleDrefExplicitLod:
-        case spv::OpImageSparseSampleProjImplicitLod:
-        case spv::OpImageSparseSampleProjExplicitLod:
-        case spv::OpImageSparseSampleProjDrefImplicitLod:
-        case spv::OpImageSparseSampleProjDrefExplicitLod:
-        case spv::OpImageSparseFetch:
-        case spv::OpImageSparseGather:
-        case spv::OpImageSparseDrefGather:
-        case spv::OpImageSparseRead:
-        case spv::OpImageSampleFootprintNV:
-            return 3;
-
-        default:
-            break;
-    }
-    return position;
-}
-
-// All valid OpType*
-enum class SpvType {
-    Empty = 0,
-    kVoid,
-    kBool,
-    kInt,
-    kFloat,
-    kVector,
-    kMatrix,
-    kImage,
-    kSampler,
-    kSampledImage,
-    kArray,
-    kRuntimeArray,
-    kStruct,
-    kPointer,
-    kFunction,
-    kForwardPointer,
-    kPipeStorage,
-    kCooperativeMatrixKHR,
-    kRayQueryKHR,
-    kHitObjectNV,
-    kAccelerationStructureKHR,
-    kCooperativeMatrixNV,
-    kBufferSurfaceINTEL,
-    kStructContinuedINTEL,
-};
-
-static constexpr SpvType GetSpvType(uint32_t opcode) {
-    switch (opcode) {
-        case spv::OpTypeVoid:
-            return SpvType::kVoid;
-        case spv::OpTypeBool:
-            return SpvType::kBool;
-        case spv::OpTypeInt:
-            return SpvType::kInt;
-        case spv::OpTypeFloat:
-            return SpvType::kFloat;
-        case spv::OpTypeVector:
-            return SpvType::kVector;
-        case spv::OpTypeMatrix:
-            return SpvType::kMatrix;
-        case spv::OpTypeImage:
-            return SpvType::kImage;
-        case spv::OpTypeSampler:
-            return SpvType::kSampler;
-        case spv::OpTypeSampledImage:
-            return SpvType::kSampledImage;
-        case spv::OpTypeArray:
-            return SpvType::kArray;
-        case spv::OpTypeRuntimeArray:
-            return SpvType::kRuntimeArray;
-        case spv::OpTypeStruct:
-            return SpvType::kStruct;
-        case spv::OpTypePointer:
-            return SpvType::kPointer;
-        case spv::OpTypeFunction:
-            return SpvType::kFunction;
-        case spv::OpTypeForwardPointer:
-            return SpvType::kForwardPointer;
-        case spv::OpTypePipeStorage:
-            return SpvType::kPipeStorage;
-        case spv::OpTypeCooperativeMatrixKHR:
-            return SpvType::kCooperativeMatrixKHR;
-        case spv::OpTypeRayQueryKHR:
-            return SpvType::kRayQueryKHR;
-        case spv::OpTypeHitObjectNV:
-            return SpvType::kHitObjectNV;
-        case spv::OpTypeAccelerationStructureKHR:
-            return SpvType::kAccelerationStructureKHR;
-        case spv::OpTypeCooperativeMatrixNV:
-            return SpvType::kCooperativeMatrixNV;
-        case spv::OpTypeBufferSurfaceINTEL:
-            return SpvType::kBufferSurfaceINTEL;
-        case spv::OpTypeStructContinuedINTEL:
-            return SpvType::kStructContinuedINTEL;
-        default:
-            return SpvType::Empty;
-    }
-}
-
 enum class OperandKind {
     Id,
     Label,  // Id but for Control Flow
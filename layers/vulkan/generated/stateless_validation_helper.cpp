@@ -9050,20 +9050,6 @@ bool StatelessValidation::PreCallValidateQueueSubmit(VkQueue queue, uint32_t sub
     return skip;
 }
 
-bool StatelessValidation::PreCallValidateQueueWaitIdle(VkQueue queue, const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
-bool StatelessValidation::PreCallValidateDeviceWaitIdle(VkDevice device, const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
 bool StatelessValidation::PreCallValidateAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory,
                                                         const ErrorObject& error_obj) const {
@@ -10199,81 +10185,91 @@ bool StatelessValidation::PreCallValidateCreateImageView(VkDevice device, const
                                                          const ErrorObject& error_obj) const {
     bool skip = false;
     [[maybe_unused]] const Location loc = error_obj.location;
-    skip |= ValidateStructType(loc.dot(Field::pCreateInfo), "VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO", pCreateInfo,
-                               VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO, true, "VUID-vkCreateImageView-pCreateInfo-parameter",
-                               "VUID-VkImageViewCreateInfo-sType-sType");
-    if (pCreateInfo != nullptr) {
-        [[maybe_unused]] const Location pCreateInfo_loc = loc.dot(Field::pCreateInfo);
-        constexpr std::array allowed_structs_VkImageViewCreateInfo = {
-            VK_STRUCTURE_TYPE_EXPORT_METAL_OBJECT_CREATE_INFO_EXT,
-            VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT,
-            VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT,
-            VK_STRUCTURE_TYPE_IMAGE_VIEW_SAMPLE_WEIGHT_CREATE_INFO_QCOM,
-            VK_STRUCTURE_TYPE_IMAGE_VIEW_SLICED_CREATE_INFO_EXT,
-            VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO,
-            VK_STRUCTURE_TYPE_OPAQUE_CAPTURE_DESCRIPTOR_DATA_CREATE_INFO_EXT,
-            VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO};
+    const uint64_t create_info_key =
+        enabled[create_info_cache] ? stateless::CreateInfoCache::Key(pCreateInfo, pAllocator, pView) : 0;
+    if (create_info_key && validated_create_infos.Contains(create_info_key)) return skip;
+    DeferredMessages create_info_messages;
+    {
+        DeferMessagesScope defer(create_info_messages);
+        skip |= ValidateStructType(loc.dot(Field::pCreateInfo), "VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO", pCreateInfo,
+                                   VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO, true, "VUID-vkCreateImageView-pCreateInfo-parameter",
+                                   "VUID-VkImageViewCreateInfo-sType-sType");
+        if (pCreateInfo != nullptr) {
+            [[maybe_unused]] const Location pCreateInfo_loc = loc.dot(Field::pCreateInfo);
+            constexpr std::array allowed_structs_VkImageViewCreateInfo = {
+                VK_STRUCTURE_TYPE_EXPORT_METAL_OBJECT_CREATE_INFO_EXT,
+                VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT,
+                VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT,
+                VK_STRUCTURE_TYPE_IMAGE_VIEW_SAMPLE_WEIGHT_CREATE_INFO_QCOM,
+                VK_STRUCTURE_TYPE_IMAGE_VIEW_SLICED_CREATE_INFO_EXT,
+                VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO,
+                VK_STRUCTURE_TYPE_OPAQUE_CAPTURE_DESCRIPTOR_DATA_CREATE_INFO_EXT,
+                VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO};
 
-        skip |=
-            ValidateStructPnext(pCreateInfo_loc, pCreateInfo->pNext, allowed_structs_VkImageViewCreateInfo.size(),
-                                allowed_structs_VkImageViewCreateInfo.data(), GeneratedVulkanHeaderVersion,
-                                "VUID-VkImageViewCreateInfo-pNext-pNext", "VUID-VkImageViewCreateInfo-sType-unique", false, true);
+            skip |= ValidateStructPnext(pCreateInfo_loc, pCreateInfo->pNext, allowed_structs_VkImageViewCreateInfo.size(),
+                                        allowed_structs_VkImageViewCreateInfo.data(), GeneratedVulkanHeaderVersion,
+                                        "VUID-VkImageViewCreateInfo-pNext-pNext", "VUID-VkImageViewCreateInfo-sType-unique",
+                                        false, true);
 
-        skip |= ValidateFlags(pCreateInfo_loc.dot(Field::flags), "VkImageViewCreateFlagBits", AllVkImageViewCreateFlagBits,
-                              pCreateInfo->flags, kOptionalFlags, "VUID-VkImageViewCreateInfo-flags-parameter");
+            skip |= ValidateFlags(pCreateInfo_loc.dot(Field::flags), "VkImageViewCreateFlagBits", AllVkImageViewCreateFlagBits,
+                                  pCreateInfo->flags, kOptionalFlags, "VUID-VkImageViewCreateInfo-flags-parameter");
 
-        skip |= ValidateRequiredHandle(pCreateInfo_loc.dot(Field::image), pCreateInfo->image);
+            skip |= ValidateRequiredHandle(pCreateInfo_loc.dot(Field::image), pCreateInfo->image);
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::viewType), "VkImageViewType", pCreateInfo->viewType,
-                                   "VUID-VkImageViewCreateInfo-viewType-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::viewType), "VkImageViewType", pCreateInfo->viewType,
+                                       "VUID-VkImageViewCreateInfo-viewType-parameter");
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::format), "VkFormat", pCreateInfo->format,
-                                   "VUID-VkImageViewCreateInfo-format-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::format), "VkFormat", pCreateInfo->format,
+                                       "VUID-VkImageViewCreateInfo-format-parameter");
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::r), "VkComponentSwizzle", pCreateInfo->components.r,
-                                   "VUID-VkComponentMapping-r-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::r), "VkComponentSwizzle", pCreateInfo->components.r,
+                                       "VUID-VkComponentMapping-r-parameter");
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::g), "VkComponentSwizzle", pCreateInfo->components.g,
-                                   "VUID-VkComponentMapping-g-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::g), "VkComponentSwizzle", pCreateInfo->components.g,
+                                       "VUID-VkComponentMapping-g-parameter");
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::b), "VkComponentSwizzle", pCreateInfo->components.b,
-                                   "VUID-VkComponentMapping-b-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::b), "VkComponentSwizzle", pCreateInfo->components.b,
+                                       "VUID-VkComponentMapping-b-parameter");
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::a), "VkComponentSwizzle", pCreateInfo->components.a,
-                                   "VUID-VkComponentMapping-a-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::a), "VkComponentSwizzle", pCreateInfo->components.a,
+                                       "VUID-VkComponentMapping-a-parameter");
 
-        skip |= ValidateFlags(pCreateInfo_loc.dot(Field::aspectMask), "VkImageAspectFlagBits", AllVkImageAspectFlagBits,
-                              pCreateInfo->subresourceRange.aspectMask, kRequiredFlags,
-                              "VUID-VkImageSubresourceRange-aspectMask-parameter",
-                              "VUID-VkImageSubresourceRange-aspectMask-requiredbitmask");
-    }
-    if (pAllocator != nullptr) {
-        [[maybe_unused]] const Location pAllocator_loc = loc.dot(Field::pAllocator);
-        skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnAllocation),
-                                        reinterpret_cast<const void*>(pAllocator->pfnAllocation),
-                                        "VUID-VkAllocationCallbacks-pfnAllocation-00632");
+            skip |= ValidateFlags(pCreateInfo_loc.dot(Field::aspectMask), "VkImageAspectFlagBits", AllVkImageAspectFlagBits,
+                                  pCreateInfo->subresourceRange.aspectMask, kRequiredFlags,
+                                  "VUID-VkImageSubresourceRange-aspectMask-parameter",
+                                  "VUID-VkImageSubresourceRange-aspectMask-requiredbitmask");
+        }
+        if (pAllocator != nullptr) {
+            [[maybe_unused]] const Location pAllocator_loc = loc.dot(Field::pAllocator);
+            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnAllocation),
+                                            reinterpret_cast<const void*>(pAllocator->pfnAllocation),
+                                            "VUID-VkAllocationCallbacks-pfnAllocation-00632");
 
-        skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnReallocation),
-                                        reinterpret_cast<const void*>(pAllocator->pfnReallocation),
-                                        "VUID-VkAllocationCallbacks-pfnReallocation-00633");
+            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnReallocation),
+                                            reinterpret_cast<const void*>(pAllocator->pfnReallocation),
+                                            "VUID-VkAllocationCallbacks-pfnReallocation-00633");
 
-        skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnFree), reinterpret_cast<const void*>(pAllocator->pfnFree),
-                                        "VUID-VkAllocationCallbacks-pfnFree-00634");
+            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnFree), reinterpret_cast<const void*>(pAllocator->pfnFree),
+                                            "VUID-VkAllocationCallbacks-pfnFree-00634");
 
-        if (pAllocator->pfnInternalAllocation != nullptr) {
-            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalAllocation),
-                                            reinterpret_cast<const void*>(pAllocator->pfnInternalFree),
-                                            "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
-        }
+            if (pAllocator->pfnInternalAllocation != nullptr) {
+                skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalAllocation),
+                                                reinterpret_cast<const void*>(pAllocator->pfnInternalFree),
+                                                "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
+            }
 
-        if (pAllocator->pfnInternalFree != nullptr) {
-            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalFree),
-                                            reinterpret_cast<const void*>(pAllocator->pfnInternalAllocation),
-                                            "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
+            if (pAllocator->pfnInternalFree != nullptr) {
+                skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalFree),
+                                                reinterpret_cast<const void*>(pAllocator->pfnInternalAllocation),
+                                                "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
+            }
         }
+        skip |= ValidateRequiredPointer(loc.dot(Field::pView), pView, "VUID-vkCreateImageView-pView-parameter");
+        if (!skip) skip |= manual_PreCallValidateCreateImageView(device, pCreateInfo, pAllocator, pView, error_obj);
     }
-    skip |= ValidateRequiredPointer(loc.dot(Field::pView), pView, "VUID-vkCreateImageView-pView-parameter");
-    if (!skip) skip |= manual_PreCallValidateCreateImageView(device, pCreateInfo, pAllocator, pView, error_obj);
+    // Only a create info that logged nothing is cached, an error doesn't set skip if the callback returns VK_FALSE
+    if (create_info_key && !create_info_messages.AnyLogged()) validated_create_infos.Add(create_info_key);
+    skip |= create_info_messages.Forward();
     return skip;
 }
 
@@ -10843,78 +10839,89 @@ bool StatelessValidation::PreCallValidateCreateSampler(VkDevice device, const Vk
                                                        const ErrorObject& error_obj) const {
     bool skip = false;
     [[maybe_unused]] const Location loc = error_obj.location;
-    skip |= ValidateStructType(loc.dot(Field::pCreateInfo), "VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO", pCreateInfo,
-                               VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO, true, "VUID-vkCreateSampler-pCreateInfo-parameter",
-                               "VUID-VkSamplerCreateInfo-sType-sType");
-    if (pCreateInfo != nullptr) {
-        [[maybe_unused]] const Location pCreateInfo_loc = loc.dot(Field::pCreateInfo);
-        constexpr std::array allowed_structs_VkSamplerCreateInfo = {
-            VK_STRUCTURE_TYPE_OPAQUE_CAPTURE_DESCRIPTOR_DATA_CREATE_INFO_EXT,
-            VK_STRUCTURE_TYPE_SAMPLER_BLOCK_MATCH_WINDOW_CREATE_INFO_QCOM,
-            VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT,
-            VK_STRUCTURE_TYPE_SAMPLER_CUBIC_WEIGHTS_CREATE_INFO_QCOM,
-            VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT,
-            VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO,
-            VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO};
-
-        skip |= ValidateStructPnext(pCreateInfo_loc, pCreateInfo->pNext, allowed_structs_VkSamplerCreateInfo.size(),
-                                    allowed_structs_VkSamplerCreateInfo.data(), GeneratedVulkanHeaderVersion,
-                                    "VUID-VkSamplerCreateInfo-pNext-pNext", "VUID-VkSamplerCreateInfo-sType-unique", false, true);
+    const uint64_t create_info_key =
+        enabled[create_info_cache] ? stateless::CreateInfoCache::Key(pCreateInfo, pAllocator, pSampler) : 0;
+    if (create_info_key && validated_create_infos.Contains(create_info_key)) return skip;
+    DeferredMessages create_info_messages;
+    {
+        DeferMessagesScope defer(create_info_messages);
+        skip |= ValidateStructType(loc.dot(Field::pCreateInfo), "VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO", pCreateInfo,
+                                   VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO, true, "VUID-vkCreateSampler-pCreateInfo-parameter",
+                                   "VUID-VkSamplerCreateInfo-sType-sType");
+        if (pCreateInfo != nullptr) {
+            [[maybe_unused]] const Location pCreateInfo_loc = loc.dot(Field::pCreateInfo);
+            constexpr std::array allowed_structs_VkSamplerCreateInfo = {
+                VK_STRUCTURE_TYPE_OPAQUE_CAPTURE_DESCRIPTOR_DATA_CREATE_INFO_EXT,
+                VK_STRUCTURE_TYPE_SAMPLER_BLOCK_MATCH_WINDOW_CREATE_INFO_QCOM,
+                VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT,
+                VK_STRUCTURE_TYPE_SAMPLER_CUBIC_WEIGHTS_CREATE_INFO_QCOM,
+                VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT,
+                VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO,
+                VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO};
+
+            skip |= ValidateStructPnext(pCreateInfo_loc, pCreateInfo->pNext, allowed_structs_VkSamplerCreateInfo.size(),
+                                        allowed_structs_VkSamplerCreateInfo.data(), GeneratedVulkanHeaderVersion,
+                                        "VUID-VkSamplerCreateInfo-pNext-pNext", "VUID-VkSamplerCreateInfo-sType-unique",
+                                        false, true);
 
-        skip |= ValidateFlags(pCreateInfo_loc.dot(Field::flags), "VkSamplerCreateFlagBits", AllVkSamplerCreateFlagBits,
-                              pCreateInfo->flags, kOptionalFlags, "VUID-VkSamplerCreateInfo-flags-parameter");
+            skip |= ValidateFlags(pCreateInfo_loc.dot(Field::flags), "VkSamplerCreateFlagBits", AllVkSamplerCreateFlagBits,
+                                  pCreateInfo->flags, kOptionalFlags, "VUID-VkSamplerCreateInfo-flags-parameter");
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::magFilter), "VkFilter", pCreateInfo->magFilter,
-                                   "VUID-VkSamplerCreateInfo-magFilter-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::magFilter), "VkFilter", pCreateInfo->magFilter,
+                                       "VUID-VkSamplerCreateInfo-magFilter-parameter");
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::minFilter), "VkFilter", pCreateInfo->minFilter,
-                                   "VUID-VkSamplerCreateInfo-minFilter-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::minFilter), "VkFilter", pCreateInfo->minFilter,
+                                       "VUID-VkSamplerCreateInfo-minFilter-parameter");
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::mipmapMode), "VkSamplerMipmapMode", pCreateInfo->mipmapMode,
-                                   "VUID-VkSamplerCreateInfo-mipmapMode-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::mipmapMode), "VkSamplerMipmapMode", pCreateInfo->mipmapMode,
+                                       "VUID-VkSamplerCreateInfo-mipmapMode-parameter");
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::addressModeU), "VkSamplerAddressMode", pCreateInfo->addressModeU,
-                                   "VUID-VkSamplerCreateInfo-addressModeU-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::addressModeU), "VkSamplerAddressMode", pCreateInfo->addressModeU,
+                                       "VUID-VkSamplerCreateInfo-addressModeU-parameter");
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::addressModeV), "VkSamplerAddressMode", pCreateInfo->addressModeV,
-                                   "VUID-VkSamplerCreateInfo-addressModeV-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::addressModeV), "VkSamplerAddressMode", pCreateInfo->addressModeV,
+                                       "VUID-VkSamplerCreateInfo-addressModeV-parameter");
 
-        skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::addressModeW), "VkSamplerAddressMode", pCreateInfo->addressModeW,
-                                   "VUID-VkSamplerCreateInfo-addressModeW-parameter");
+            skip |= ValidateRangedEnum(pCreateInfo_loc.dot(Field::addressModeW), "VkSamplerAddressMode", pCreateInfo->addressModeW,
+                                       "VUID-VkSamplerCreateInfo-addressModeW-parameter");
 
-        skip |= ValidateBool32(pCreateInfo_loc.dot(Field::anisotropyEnable), pCreateInfo->anisotropyEnable);
+            skip |= ValidateBool32(pCreateInfo_loc.dot(Field::anisotropyEnable), pCreateInfo->anisotropyEnable);
 
-        skip |= ValidateBool32(pCreateInfo_loc.dot(Field::compareEnable), pCreateInfo->compareEnable);
+            skip |= ValidateBool32(pCreateInfo_loc.dot(Field::compareEnable), pCreateInfo->compareEnable);
 
-        skip |= ValidateBool32(pCreateInfo_loc.dot(Field::unnormalizedCoordinates), pCreateInfo->unnormalizedCoordinates);
-    }
-    if (pAllocator != nullptr) {
-        [[maybe_unused]] const Location pAllocator_loc = loc.dot(Field::pAllocator);
-        skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnAllocation),
-                                        reinterpret_cast<const void*>(pAllocator->pfnAllocation),
-                                        "VUID-VkAllocationCallbacks-pfnAllocation-00632");
+            skip |= ValidateBool32(pCreateInfo_loc.dot(Field::unnormalizedCoordinates), pCreateInfo->unnormalizedCoordinates);
+        }
+        if (pAllocator != nullptr) {
+            [[maybe_unused]] const Location pAllocator_loc = loc.dot(Field::pAllocator);
+            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnAllocation),
+                                            reinterpret_cast<const void*>(pAllocator->pfnAllocation),
+                                            "VUID-VkAllocationCallbacks-pfnAllocation-00632");
 
-        skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnReallocation),
-                                        reinterpret_cast<const void*>(pAllocator->pfnReallocation),
-                                        "VUID-VkAllocationCallbacks-pfnReallocation-00633");
+            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnReallocation),
+                                            reinterpret_cast<const void*>(pAllocator->pfnReallocation),
+                                            "VUID-VkAllocationCallbacks-pfnReallocation-00633");
 
-        skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnFree), reinterpret_cast<const void*>(pAllocator->pfnFree),
-                                        "VUID-VkAllocationCallbacks-pfnFree-00634");
+            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnFree), reinterpret_cast<const void*>(pAllocator->pfnFree),
+                                            "VUID-VkAllocationCallbacks-pfnFree-00634");
 
-        if (pAllocator->pfnInternalAllocation != nullptr) {
-            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalAllocation),
-                                            reinterpret_cast<const void*>(pAllocator->pfnInternalFree),
-                                            "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
-        }
+            if (pAllocator->pfnInternalAllocation != nullptr) {
+                skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalAllocation),
+                                                reinterpret_cast<const void*>(pAllocator->pfnInternalFree),
+                                                "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
+            }
 
-        if (pAllocator->pfnInternalFree != nullptr) {
-            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalFree),
-                                            reinterpret_cast<const void*>(pAllocator->pfnInternalAllocation),
-                                            "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
+            if (pAllocator->pfnInternalFree != nullptr) {
+                skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalFree),
+                                                reinterpret_cast<const void*>(pAllocator->pfnInternalAllocation),
+                                                "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
+            }
         }
+        skip |= ValidateRequiredPointer(loc.dot(Field::pSampler), pSampler, "VUID-vkCreateSampler-pSampler-parameter");
+        if (!skip) skip |= manual_PreCallValidateCreateSampler(device, pCreateInfo, pAllocator, pSampler, error_obj);
     }
-    skip |= ValidateRequiredPointer(loc.dot(Field::pSampler), pSampler, "VUID-vkCreateSampler-pSampler-parameter");
-    if (!skip) skip |= manual_PreCallValidateCreateSampler(device, pCreateInfo, pAllocator, pSampler, error_obj);
+    // Only a create info that logged nothing is cached, an error doesn't set skip if the callback returns VK_FALSE
+    if (create_info_key && !create_info_messages.AnyLogged()) validated_create_infos.Add(create_info_key);
+    skip |= create_info_messages.Forward();
     return skip;
 }
 
@@ -10957,66 +10964,76 @@ bool StatelessValidation::PreCallValidateCreateDescriptorSetLayout(VkDevice devi
                                                                    const ErrorObject& error_obj) const {
     bool skip = false;
     [[maybe_unused]] const Location loc = error_obj.location;
-    skip |= ValidateStructType(loc.dot(Field::pCreateInfo), "VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO", pCreateInfo,
-                               VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, true,
-                               "VUID-vkCreateDescriptorSetLayout-pCreateInfo-parameter",
-                               "VUID-VkDescriptorSetLayoutCreateInfo-sType-sType");
-    if (pCreateInfo != nullptr) {
-        [[maybe_unused]] const Location pCreateInfo_loc = loc.dot(Field::pCreateInfo);
-        constexpr std::array allowed_structs_VkDescriptorSetLayoutCreateInfo = {
-            VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO,
-            VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_EXT};
-
-        skip |= ValidateStructPnext(pCreateInfo_loc, pCreateInfo->pNext, allowed_structs_VkDescriptorSetLayoutCreateInfo.size(),
-                                    allowed_structs_VkDescriptorSetLayoutCreateInfo.data(), GeneratedVulkanHeaderVersion,
-                                    "VUID-VkDescriptorSetLayoutCreateInfo-pNext-pNext",
-                                    "VUID-VkDescriptorSetLayoutCreateInfo-sType-unique", false, true);
-
-        skip |= ValidateFlags(pCreateInfo_loc.dot(Field::flags), "VkDescriptorSetLayoutCreateFlagBits",
-                              AllVkDescriptorSetLayoutCreateFlagBits, pCreateInfo->flags, kOptionalFlags,
-                              "VUID-VkDescriptorSetLayoutCreateInfo-flags-parameter");
-
-        skip |= ValidateArray(pCreateInfo_loc.dot(Field::bindingCount), pCreateInfo_loc.dot(Field::pBindings),
-                              pCreateInfo->bindingCount, &pCreateInfo->pBindings, false, true, kVUIDUndefined,
-                              "VUID-VkDescriptorSetLayoutCreateInfo-pBindings-parameter");
-
-        if (pCreateInfo->pBindings != nullptr) {
-            for (uint32_t bindingIndex = 0; bindingIndex < pCreateInfo->bindingCount; ++bindingIndex) {
-                [[maybe_unused]] const Location pBindings_loc = pCreateInfo_loc.dot(Field::pBindings, bindingIndex);
-                skip |= ValidateRangedEnum(pBindings_loc.dot(Field::descriptorType), "VkDescriptorType",
-                                           pCreateInfo->pBindings[bindingIndex].descriptorType,
-                                           "VUID-VkDescriptorSetLayoutBinding-descriptorType-parameter");
+    const uint64_t create_info_key =
+        enabled[create_info_cache] ? stateless::CreateInfoCache::Key(pCreateInfo, pAllocator, pSetLayout) : 0;
+    if (create_info_key && validated_create_infos.Contains(create_info_key)) return skip;
+    DeferredMessages create_info_messages;
+    {
+        DeferMessagesScope defer(create_info_messages);
+        skip |= ValidateStructType(loc.dot(Field::pCreateInfo), "VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO", pCreateInfo,
+                                   VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, true,
+                                   "VUID-vkCreateDescriptorSetLayout-pCreateInfo-parameter",
+                                   "VUID-VkDescriptorSetLayoutCreateInfo-sType-sType");
+        if (pCreateInfo != nullptr) {
+            [[maybe_unused]] const Location pCreateInfo_loc = loc.dot(Field::pCreateInfo);
+            constexpr std::array allowed_structs_VkDescriptorSetLayoutCreateInfo = {
+                VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO,
+                VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_EXT};
+
+            skip |= ValidateStructPnext(pCreateInfo_loc, pCreateInfo->pNext, allowed_structs_VkDescriptorSetLayoutCreateInfo.size(),
+                                        allowed_structs_VkDescriptorSetLayoutCreateInfo.data(), GeneratedVulkanHeaderVersion,
+                                        "VUID-VkDescriptorSetLayoutCreateInfo-pNext-pNext",
+                                        "VUID-VkDescriptorSetLayoutCreateInfo-sType-unique", false, true);
+
+            skip |= ValidateFlags(pCreateInfo_loc.dot(Field::flags), "VkDescriptorSetLayoutCreateFlagBits",
+                                  AllVkDescriptorSetLayoutCreateFlagBits, pCreateInfo->flags, kOptionalFlags,
+                                  "VUID-VkDescriptorSetLayoutCreateInfo-flags-parameter");
+
+            skip |= ValidateArray(pCreateInfo_loc.dot(Field::bindingCount), pCreateInfo_loc.dot(Field::pBindings),
+                                  pCreateInfo->bindingCount, &pCreateInfo->pBindings, false, true, kVUIDUndefined,
+                                  "VUID-VkDescriptorSetLayoutCreateInfo-pBindings-parameter");
+
+            if (pCreateInfo->pBindings != nullptr) {
+                for (uint32_t bindingIndex = 0; bindingIndex < pCreateInfo->bindingCount; ++bindingIndex) {
+                    [[maybe_unused]] const Location pBindings_loc = pCreateInfo_loc.dot(Field::pBindings, bindingIndex);
+                    skip |= ValidateRangedEnum(pBindings_loc.dot(Field::descriptorType), "VkDescriptorType",
+                                               pCreateInfo->pBindings[bindingIndex].descriptorType,
+                                               "VUID-VkDescriptorSetLayoutBinding-descriptorType-parameter");
+                }
             }
         }
-    }
-    if (pAllocator != nullptr) {
-        [[maybe_unused]] const Location pAllocator_loc = loc.dot(Field::pAllocator);
-        skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnAllocation),
-                                        reinterpret_cast<const void*>(pAllocator->pfnAllocation),
-                                        "VUID-VkAllocationCallbacks-pfnAllocation-00632");
+        if (pAllocator != nullptr) {
+            [[maybe_unused]] const Location pAllocator_loc = loc.dot(Field::pAllocator);
+            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnAllocation),
+                                            reinterpret_cast<const void*>(pAllocator->pfnAllocation),
+                                            "VUID-VkAllocationCallbacks-pfnAllocation-00632");
 
-        skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnReallocation),
-                                        reinterpret_cast<const void*>(pAllocator->pfnReallocation),
-                                        "VUID-VkAllocationCallbacks-pfnReallocation-00633");
+            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnReallocation),
+                                            reinterpret_cast<const void*>(pAllocator->pfnReallocation),
+                                            "VUID-VkAllocationCallbacks-pfnReallocation-00633");
 
-        skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnFree), reinterpret_cast<const void*>(pAllocator->pfnFree),
-                                        "VUID-VkAllocationCallbacks-pfnFree-00634");
+            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnFree), reinterpret_cast<const void*>(pAllocator->pfnFree),
+                                            "VUID-VkAllocationCallbacks-pfnFree-00634");
 
-        if (pAllocator->pfnInternalAllocation != nullptr) {
-            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalAllocation),
-                                            reinterpret_cast<const void*>(pAllocator->pfnInternalFree),
-                                            "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
-        }
+            if (pAllocator->pfnInternalAllocation != nullptr) {
+                skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalAllocation),
+                                                reinterpret_cast<const void*>(pAllocator->pfnInternalFree),
+                                                "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
+            }
 
-        if (pAllocator->pfnInternalFree != nullptr) {
-            skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalFree),
-                                            reinterpret_cast<const void*>(pAllocator->pfnInternalAllocation),
-                                            "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
+            if (pAllocator->pfnInternalFree != nullptr) {
+                skip |= ValidateRequiredPointer(pAllocator_loc.dot(Field::pfnInternalFree),
+                                                reinterpret_cast<const void*>(pAllocator->pfnInternalAllocation),
+                                                "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
+            }
         }
+        skip |= ValidateRequiredPointer(loc.dot(Field::pSetLayout), pSetLayout,
+                                        "VUID-vkCreateDescriptorSetLayout-pSetLayout-parameter");
+        if (!skip) skip |= manual_PreCallValidateCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout, error_obj);
     }
-    skip |=
-        ValidateRequiredPointer(loc.dot(Field::pSetLayout), pSetLayout, "VUID-vkCreateDescriptorSetLayout-pSetLayout-parameter");
-    if (!skip) skip |= manual_PreCallValidateCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout, error_obj);
+    // Only a create info that logged nothing is cached, an error doesn't set skip if the callback returns VK_FALSE
+    if (create_info_key && !create_info_messages.AnyLogged()) validated_create_infos.Add(create_info_key);
+    skip |= create_info_messages.Forward();
     return skip;
 }
 
@@ -11754,13 +11771,6 @@ bool StatelessValidation::PreCallValidateBeginCommandBuffer(VkCommandBuffer comm
     return skip;
 }
 
-bool StatelessValidation::PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer, const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
 bool StatelessValidation::PreCallValidateResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags,
                                                             const ErrorObject& error_obj) const {
     bool skip = false;
@@ -11824,31 +11834,6 @@ bool StatelessValidation::PreCallValidateCmdSetLineWidth(VkCommandBuffer command
     return skip;
 }
 
-bool StatelessValidation::PreCallValidateCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor,
-                                                         float depthBiasClamp, float depthBiasSlopeFactor,
-                                                         const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
-bool StatelessValidation::PreCallValidateCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4],
-                                                              const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
-bool StatelessValidation::PreCallValidateCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds,
-                                                           float maxDepthBounds, const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
 bool StatelessValidation::PreCallValidateCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
                                                                   uint32_t compareMask, const ErrorObject& error_obj) const {
     bool skip = false;
@@ -11922,23 +11907,6 @@ bool StatelessValidation::PreCallValidateCmdBindVertexBuffers(VkCommandBuffer co
     return skip;
 }
 
-bool StatelessValidation::PreCallValidateCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
-                                                 uint32_t firstVertex, uint32_t firstInstance, const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
-bool StatelessValidation::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
-                                                        uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance,
-                                                        const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
 bool StatelessValidation::PreCallValidateCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                          uint32_t drawCount, uint32_t stride, const ErrorObject& error_obj) const {
     bool skip = false;
@@ -11956,14 +11924,6 @@ bool StatelessValidation::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer
     return skip;
 }
 
-bool StatelessValidation::PreCallValidateCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
-                                                     uint32_t groupCountZ, const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
 bool StatelessValidation::PreCallValidateCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                              const ErrorObject& error_obj) const {
     bool skip = false;
@@ -12571,13 +12531,6 @@ bool StatelessValidation::PreCallValidateCmdNextSubpass(VkCommandBuffer commandB
     return skip;
 }
 
-bool StatelessValidation::PreCallValidateCmdEndRenderPass(VkCommandBuffer commandBuffer, const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
 bool StatelessValidation::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                                             const VkCommandBuffer* pCommandBuffers,
                                                             const ErrorObject& error_obj) const {
@@ -12654,23 +12607,6 @@ bool StatelessValidation::PreCallValidateGetDeviceGroupPeerMemoryFeatures(VkDevi
     return skip;
 }
 
-bool StatelessValidation::PreCallValidateCmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask,
-                                                          const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
-bool StatelessValidation::PreCallValidateCmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY,
-                                                         uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY,
-                                                         uint32_t groupCountZ, const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
 bool StatelessValidation::PreCallValidateEnumeratePhysicalDeviceGroups(
     VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties,
     const ErrorObject& error_obj) const {
@@ -15297,13 +15233,6 @@ bool StatelessValidation::PreCallValidateCmdBeginRendering(VkCommandBuffer comma
     return skip;
 }
 
-bool StatelessValidation::PreCallValidateCmdEndRendering(VkCommandBuffer commandBuffer, const ErrorObject& error_obj) const {
-    bool skip = false;
-    [[maybe_unused]] const Location loc = error_obj.location;
-    // No xml-driven validation
-    return skip;
-}
-
 bool StatelessValidation::PreCallValidateCmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode,
                                                         const ErrorObject& error_obj) const {
     bool skip = false;
@@ -28,6 +28,7 @@
 #include <cstdlib>
 #include <algorithm>
 #include <functional>
+#include <utility>
 
 // State that elements in a pNext chain may need to be aware of
 struct PNextCopyState {
@@ -53,6 +54,8 @@ struct safe_VkBufferMemoryBarrier {
     safe_VkBufferMemoryBarrier(const VkBufferMemoryBarrier* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBufferMemoryBarrier(const safe_VkBufferMemoryBarrier& copy_src);
     safe_VkBufferMemoryBarrier& operator=(const safe_VkBufferMemoryBarrier& copy_src);
+    safe_VkBufferMemoryBarrier(safe_VkBufferMemoryBarrier&& move_src) noexcept;
+    safe_VkBufferMemoryBarrier& operator=(safe_VkBufferMemoryBarrier&& move_src) noexcept;
     safe_VkBufferMemoryBarrier();
     ~safe_VkBufferMemoryBarrier();
     void initialize(const VkBufferMemoryBarrier* in_struct, PNextCopyState* copy_state = {});
@@ -75,6 +78,8 @@ struct safe_VkImageMemoryBarrier {
     safe_VkImageMemoryBarrier(const VkImageMemoryBarrier* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageMemoryBarrier(const safe_VkImageMemoryBarrier& copy_src);
     safe_VkImageMemoryBarrier& operator=(const safe_VkImageMemoryBarrier& copy_src);
+    safe_VkImageMemoryBarrier(safe_VkImageMemoryBarrier&& move_src) noexcept;
+    safe_VkImageMemoryBarrier& operator=(safe_VkImageMemoryBarrier&& move_src) noexcept;
     safe_VkImageMemoryBarrier();
     ~safe_VkImageMemoryBarrier();
     void initialize(const VkImageMemoryBarrier* in_struct, PNextCopyState* copy_state = {});
@@ -91,6 +96,8 @@ struct safe_VkMemoryBarrier {
     safe_VkMemoryBarrier(const VkMemoryBarrier* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryBarrier(const safe_VkMemoryBarrier& copy_src);
     safe_VkMemoryBarrier& operator=(const safe_VkMemoryBarrier& copy_src);
+    safe_VkMemoryBarrier(safe_VkMemoryBarrier&& move_src) noexcept;
+    safe_VkMemoryBarrier& operator=(safe_VkMemoryBarrier&& move_src) noexcept;
     safe_VkMemoryBarrier();
     ~safe_VkMemoryBarrier();
     void initialize(const VkMemoryBarrier* in_struct, PNextCopyState* copy_state = {});
@@ -109,6 +116,8 @@ struct safe_VkAllocationCallbacks {
     safe_VkAllocationCallbacks(const VkAllocationCallbacks* in_struct, PNextCopyState* copy_state = {});
     safe_VkAllocationCallbacks(const safe_VkAllocationCallbacks& copy_src);
     safe_VkAllocationCallbacks& operator=(const safe_VkAllocationCallbacks& copy_src);
+    safe_VkAllocationCallbacks(safe_VkAllocationCallbacks&& move_src) noexcept;
+    safe_VkAllocationCallbacks& operator=(safe_VkAllocationCallbacks&& move_src) noexcept;
     safe_VkAllocationCallbacks();
     ~safe_VkAllocationCallbacks();
     void initialize(const VkAllocationCallbacks* in_struct, PNextCopyState* copy_state = {});
@@ -128,6 +137,8 @@ struct safe_VkApplicationInfo {
     safe_VkApplicationInfo(const VkApplicationInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkApplicationInfo(const safe_VkApplicationInfo& copy_src);
     safe_VkApplicationInfo& operator=(const safe_VkApplicationInfo& copy_src);
+    safe_VkApplicationInfo(safe_VkApplicationInfo&& move_src) noexcept;
+    safe_VkApplicationInfo& operator=(safe_VkApplicationInfo&& move_src) noexcept;
     safe_VkApplicationInfo();
     ~safe_VkApplicationInfo();
     void initialize(const VkApplicationInfo* in_struct, PNextCopyState* copy_state = {});
@@ -148,6 +159,8 @@ struct safe_VkInstanceCreateInfo {
     safe_VkInstanceCreateInfo(const VkInstanceCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkInstanceCreateInfo(const safe_VkInstanceCreateInfo& copy_src);
     safe_VkInstanceCreateInfo& operator=(const safe_VkInstanceCreateInfo& copy_src);
+    safe_VkInstanceCreateInfo(safe_VkInstanceCreateInfo&& move_src) noexcept;
+    safe_VkInstanceCreateInfo& operator=(safe_VkInstanceCreateInfo&& move_src) noexcept;
     safe_VkInstanceCreateInfo();
     ~safe_VkInstanceCreateInfo();
     void initialize(const VkInstanceCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -166,6 +179,8 @@ struct safe_VkDeviceQueueCreateInfo {
     safe_VkDeviceQueueCreateInfo(const VkDeviceQueueCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceQueueCreateInfo(const safe_VkDeviceQueueCreateInfo& copy_src);
     safe_VkDeviceQueueCreateInfo& operator=(const safe_VkDeviceQueueCreateInfo& copy_src);
+    safe_VkDeviceQueueCreateInfo(safe_VkDeviceQueueCreateInfo&& move_src) noexcept;
+    safe_VkDeviceQueueCreateInfo& operator=(safe_VkDeviceQueueCreateInfo&& move_src) noexcept;
     safe_VkDeviceQueueCreateInfo();
     ~safe_VkDeviceQueueCreateInfo();
     void initialize(const VkDeviceQueueCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -188,6 +203,8 @@ struct safe_VkDeviceCreateInfo {
     safe_VkDeviceCreateInfo(const VkDeviceCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceCreateInfo(const safe_VkDeviceCreateInfo& copy_src);
     safe_VkDeviceCreateInfo& operator=(const safe_VkDeviceCreateInfo& copy_src);
+    safe_VkDeviceCreateInfo(safe_VkDeviceCreateInfo&& move_src) noexcept;
+    safe_VkDeviceCreateInfo& operator=(safe_VkDeviceCreateInfo&& move_src) noexcept;
     safe_VkDeviceCreateInfo();
     ~safe_VkDeviceCreateInfo();
     void initialize(const VkDeviceCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -209,6 +226,8 @@ struct safe_VkSubmitInfo {
     safe_VkSubmitInfo(const VkSubmitInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSubmitInfo(const safe_VkSubmitInfo& copy_src);
     safe_VkSubmitInfo& operator=(const safe_VkSubmitInfo& copy_src);
+    safe_VkSubmitInfo(safe_VkSubmitInfo&& move_src) noexcept;
+    safe_VkSubmitInfo& operator=(safe_VkSubmitInfo&& move_src) noexcept;
     safe_VkSubmitInfo();
     ~safe_VkSubmitInfo();
     void initialize(const VkSubmitInfo* in_struct, PNextCopyState* copy_state = {});
@@ -226,6 +245,8 @@ struct safe_VkMappedMemoryRange {
     safe_VkMappedMemoryRange(const VkMappedMemoryRange* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMappedMemoryRange(const safe_VkMappedMemoryRange& copy_src);
     safe_VkMappedMemoryRange& operator=(const safe_VkMappedMemoryRange& copy_src);
+    safe_VkMappedMemoryRange(safe_VkMappedMemoryRange&& move_src) noexcept;
+    safe_VkMappedMemoryRange& operator=(safe_VkMappedMemoryRange&& move_src) noexcept;
     safe_VkMappedMemoryRange();
     ~safe_VkMappedMemoryRange();
     void initialize(const VkMappedMemoryRange* in_struct, PNextCopyState* copy_state = {});
@@ -242,6 +263,8 @@ struct safe_VkMemoryAllocateInfo {
     safe_VkMemoryAllocateInfo(const VkMemoryAllocateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryAllocateInfo(const safe_VkMemoryAllocateInfo& copy_src);
     safe_VkMemoryAllocateInfo& operator=(const safe_VkMemoryAllocateInfo& copy_src);
+    safe_VkMemoryAllocateInfo(safe_VkMemoryAllocateInfo&& move_src) noexcept;
+    safe_VkMemoryAllocateInfo& operator=(safe_VkMemoryAllocateInfo&& move_src) noexcept;
     safe_VkMemoryAllocateInfo();
     ~safe_VkMemoryAllocateInfo();
     void initialize(const VkMemoryAllocateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -257,6 +280,8 @@ struct safe_VkSparseBufferMemoryBindInfo {
     safe_VkSparseBufferMemoryBindInfo(const VkSparseBufferMemoryBindInfo* in_struct, PNextCopyState* copy_state = {});
     safe_VkSparseBufferMemoryBindInfo(const safe_VkSparseBufferMemoryBindInfo& copy_src);
     safe_VkSparseBufferMemoryBindInfo& operator=(const safe_VkSparseBufferMemoryBindInfo& copy_src);
+    safe_VkSparseBufferMemoryBindInfo(safe_VkSparseBufferMemoryBindInfo&& move_src) noexcept;
+    safe_VkSparseBufferMemoryBindInfo& operator=(safe_VkSparseBufferMemoryBindInfo&& move_src) noexcept;
     safe_VkSparseBufferMemoryBindInfo();
     ~safe_VkSparseBufferMemoryBindInfo();
     void initialize(const VkSparseBufferMemoryBindInfo* in_struct, PNextCopyState* copy_state = {});
@@ -272,6 +297,8 @@ struct safe_VkSparseImageOpaqueMemoryBindInfo {
     safe_VkSparseImageOpaqueMemoryBindInfo(const VkSparseImageOpaqueMemoryBindInfo* in_struct, PNextCopyState* copy_state = {});
     safe_VkSparseImageOpaqueMemoryBindInfo(const safe_VkSparseImageOpaqueMemoryBindInfo& copy_src);
     safe_VkSparseImageOpaqueMemoryBindInfo& operator=(const safe_VkSparseImageOpaqueMemoryBindInfo& copy_src);
+    safe_VkSparseImageOpaqueMemoryBindInfo(safe_VkSparseImageOpaqueMemoryBindInfo&& move_src) noexcept;
+    safe_VkSparseImageOpaqueMemoryBindInfo& operator=(safe_VkSparseImageOpaqueMemoryBindInfo&& move_src) noexcept;
     safe_VkSparseImageOpaqueMemoryBindInfo();
     ~safe_VkSparseImageOpaqueMemoryBindInfo();
     void initialize(const VkSparseImageOpaqueMemoryBindInfo* in_struct, PNextCopyState* copy_state = {});
@@ -289,6 +316,8 @@ struct safe_VkSparseImageMemoryBindInfo {
     safe_VkSparseImageMemoryBindInfo(const VkSparseImageMemoryBindInfo* in_struct, PNextCopyState* copy_state = {});
     safe_VkSparseImageMemoryBindInfo(const safe_VkSparseImageMemoryBindInfo& copy_src);
     safe_VkSparseImageMemoryBindInfo& operator=(const safe_VkSparseImageMemoryBindInfo& copy_src);
+    safe_VkSparseImageMemoryBindInfo(safe_VkSparseImageMemoryBindInfo&& move_src) noexcept;
+    safe_VkSparseImageMemoryBindInfo& operator=(safe_VkSparseImageMemoryBindInfo&& move_src) noexcept;
     safe_VkSparseImageMemoryBindInfo();
     ~safe_VkSparseImageMemoryBindInfo();
     void initialize(const VkSparseImageMemoryBindInfo* in_struct, PNextCopyState* copy_state = {});
@@ -313,6 +342,8 @@ struct safe_VkBindSparseInfo {
     safe_VkBindSparseInfo(const VkBindSparseInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBindSparseInfo(const safe_VkBindSparseInfo& copy_src);
     safe_VkBindSparseInfo& operator=(const safe_VkBindSparseInfo& copy_src);
+    safe_VkBindSparseInfo(safe_VkBindSparseInfo&& move_src) noexcept;
+    safe_VkBindSparseInfo& operator=(safe_VkBindSparseInfo&& move_src) noexcept;
     safe_VkBindSparseInfo();
     ~safe_VkBindSparseInfo();
     void initialize(const VkBindSparseInfo* in_struct, PNextCopyState* copy_state = {});
@@ -328,6 +359,8 @@ struct safe_VkFenceCreateInfo {
     safe_VkFenceCreateInfo(const VkFenceCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkFenceCreateInfo(const safe_VkFenceCreateInfo& copy_src);
     safe_VkFenceCreateInfo& operator=(const safe_VkFenceCreateInfo& copy_src);
+    safe_VkFenceCreateInfo(safe_VkFenceCreateInfo&& move_src) noexcept;
+    safe_VkFenceCreateInfo& operator=(safe_VkFenceCreateInfo&& move_src) noexcept;
     safe_VkFenceCreateInfo();
     ~safe_VkFenceCreateInfo();
     void initialize(const VkFenceCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -343,6 +376,8 @@ struct safe_VkSemaphoreCreateInfo {
     safe_VkSemaphoreCreateInfo(const VkSemaphoreCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSemaphoreCreateInfo(const safe_VkSemaphoreCreateInfo& copy_src);
     safe_VkSemaphoreCreateInfo& operator=(const safe_VkSemaphoreCreateInfo& copy_src);
+    safe_VkSemaphoreCreateInfo(safe_VkSemaphoreCreateInfo&& move_src) noexcept;
+    safe_VkSemaphoreCreateInfo& operator=(safe_VkSemaphoreCreateInfo&& move_src) noexcept;
     safe_VkSemaphoreCreateInfo();
     ~safe_VkSemaphoreCreateInfo();
     void initialize(const VkSemaphoreCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -358,6 +393,8 @@ struct safe_VkEventCreateInfo {
     safe_VkEventCreateInfo(const VkEventCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkEventCreateInfo(const safe_VkEventCreateInfo& copy_src);
     safe_VkEventCreateInfo& operator=(const safe_VkEventCreateInfo& copy_src);
+    safe_VkEventCreateInfo(safe_VkEventCreateInfo&& move_src) noexcept;
+    safe_VkEventCreateInfo& operator=(safe_VkEventCreateInfo&& move_src) noexcept;
     safe_VkEventCreateInfo();
     ~safe_VkEventCreateInfo();
     void initialize(const VkEventCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -376,6 +413,8 @@ struct safe_VkQueryPoolCreateInfo {
     safe_VkQueryPoolCreateInfo(const VkQueryPoolCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkQueryPoolCreateInfo(const safe_VkQueryPoolCreateInfo& copy_src);
     safe_VkQueryPoolCreateInfo& operator=(const safe_VkQueryPoolCreateInfo& copy_src);
+    safe_VkQueryPoolCreateInfo(safe_VkQueryPoolCreateInfo&& move_src) noexcept;
+    safe_VkQueryPoolCreateInfo& operator=(safe_VkQueryPoolCreateInfo&& move_src) noexcept;
     safe_VkQueryPoolCreateInfo();
     ~safe_VkQueryPoolCreateInfo();
     void initialize(const VkQueryPoolCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -396,6 +435,8 @@ struct safe_VkBufferCreateInfo {
     safe_VkBufferCreateInfo(const VkBufferCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBufferCreateInfo(const safe_VkBufferCreateInfo& copy_src);
     safe_VkBufferCreateInfo& operator=(const safe_VkBufferCreateInfo& copy_src);
+    safe_VkBufferCreateInfo(safe_VkBufferCreateInfo&& move_src) noexcept;
+    safe_VkBufferCreateInfo& operator=(safe_VkBufferCreateInfo&& move_src) noexcept;
     safe_VkBufferCreateInfo();
     ~safe_VkBufferCreateInfo();
     void initialize(const VkBufferCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -415,6 +456,8 @@ struct safe_VkBufferViewCreateInfo {
     safe_VkBufferViewCreateInfo(const VkBufferViewCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBufferViewCreateInfo(const safe_VkBufferViewCreateInfo& copy_src);
     safe_VkBufferViewCreateInfo& operator=(const safe_VkBufferViewCreateInfo& copy_src);
+    safe_VkBufferViewCreateInfo(safe_VkBufferViewCreateInfo&& move_src) noexcept;
+    safe_VkBufferViewCreateInfo& operator=(safe_VkBufferViewCreateInfo&& move_src) noexcept;
     safe_VkBufferViewCreateInfo();
     ~safe_VkBufferViewCreateInfo();
     void initialize(const VkBufferViewCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -442,6 +485,8 @@ struct safe_VkImageCreateInfo {
     safe_VkImageCreateInfo(const VkImageCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageCreateInfo(const safe_VkImageCreateInfo& copy_src);
     safe_VkImageCreateInfo& operator=(const safe_VkImageCreateInfo& copy_src);
+    safe_VkImageCreateInfo(safe_VkImageCreateInfo&& move_src) noexcept;
+    safe_VkImageCreateInfo& operator=(safe_VkImageCreateInfo&& move_src) noexcept;
     safe_VkImageCreateInfo();
     ~safe_VkImageCreateInfo();
     void initialize(const VkImageCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -462,6 +507,8 @@ struct safe_VkImageViewCreateInfo {
     safe_VkImageViewCreateInfo(const VkImageViewCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageViewCreateInfo(const safe_VkImageViewCreateInfo& copy_src);
     safe_VkImageViewCreateInfo& operator=(const safe_VkImageViewCreateInfo& copy_src);
+    safe_VkImageViewCreateInfo(safe_VkImageViewCreateInfo&& move_src) noexcept;
+    safe_VkImageViewCreateInfo& operator=(safe_VkImageViewCreateInfo&& move_src) noexcept;
     safe_VkImageViewCreateInfo();
     ~safe_VkImageViewCreateInfo();
     void initialize(const VkImageViewCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -480,6 +527,8 @@ struct safe_VkShaderModuleCreateInfo {
                                   bool copy_pnext = true);
     safe_VkShaderModuleCreateInfo(const safe_VkShaderModuleCreateInfo& copy_src);
     safe_VkShaderModuleCreateInfo& operator=(const safe_VkShaderModuleCreateInfo& copy_src);
+    safe_VkShaderModuleCreateInfo(safe_VkShaderModuleCreateInfo&& move_src) noexcept;
+    safe_VkShaderModuleCreateInfo& operator=(safe_VkShaderModuleCreateInfo&& move_src) noexcept;
     safe_VkShaderModuleCreateInfo();
     ~safe_VkShaderModuleCreateInfo();
     void initialize(const VkShaderModuleCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -507,6 +556,8 @@ struct safe_VkPipelineCacheCreateInfo {
                                    bool copy_pnext = true);
     safe_VkPipelineCacheCreateInfo(const safe_VkPipelineCacheCreateInfo& copy_src);
     safe_VkPipelineCacheCreateInfo& operator=(const safe_VkPipelineCacheCreateInfo& copy_src);
+    safe_VkPipelineCacheCreateInfo(safe_VkPipelineCacheCreateInfo&& move_src) noexcept;
+    safe_VkPipelineCacheCreateInfo& operator=(safe_VkPipelineCacheCreateInfo&& move_src) noexcept;
     safe_VkPipelineCacheCreateInfo();
     ~safe_VkPipelineCacheCreateInfo();
     void initialize(const VkPipelineCacheCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -523,6 +574,8 @@ struct safe_VkSpecializationInfo {
     safe_VkSpecializationInfo(const VkSpecializationInfo* in_struct, PNextCopyState* copy_state = {});
     safe_VkSpecializationInfo(const safe_VkSpecializationInfo& copy_src);
     safe_VkSpecializationInfo& operator=(const safe_VkSpecializationInfo& copy_src);
+    safe_VkSpecializationInfo(safe_VkSpecializationInfo&& move_src) noexcept;
+    safe_VkSpecializationInfo& operator=(safe_VkSpecializationInfo&& move_src) noexcept;
     safe_VkSpecializationInfo();
     ~safe_VkSpecializationInfo();
     void initialize(const VkSpecializationInfo* in_struct, PNextCopyState* copy_state = {});
@@ -543,6 +596,8 @@ struct safe_VkPipelineShaderStageCreateInfo {
                                          bool copy_pnext = true);
     safe_VkPipelineShaderStageCreateInfo(const safe_VkPipelineShaderStageCreateInfo& copy_src);
     safe_VkPipelineShaderStageCreateInfo& operator=(const safe_VkPipelineShaderStageCreateInfo& copy_src);
+    safe_VkPipelineShaderStageCreateInfo(safe_VkPipelineShaderStageCreateInfo&& move_src) noexcept;
+    safe_VkPipelineShaderStageCreateInfo& operator=(safe_VkPipelineShaderStageCreateInfo&& move_src) noexcept;
     safe_VkPipelineShaderStageCreateInfo();
     ~safe_VkPipelineShaderStageCreateInfo();
     void initialize(const VkPipelineShaderStageCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -563,6 +618,8 @@ struct safe_VkComputePipelineCreateInfo {
                                      bool copy_pnext = true);
     safe_VkComputePipelineCreateInfo(const safe_VkComputePipelineCreateInfo& copy_src);
     safe_VkComputePipelineCreateInfo& operator=(const safe_VkComputePipelineCreateInfo& copy_src);
+    safe_VkComputePipelineCreateInfo(safe_VkComputePipelineCreateInfo&& move_src) noexcept;
+    safe_VkComputePipelineCreateInfo& operator=(safe_VkComputePipelineCreateInfo&& move_src) noexcept;
     safe_VkComputePipelineCreateInfo();
     ~safe_VkComputePipelineCreateInfo();
     void initialize(const VkComputePipelineCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -583,6 +640,8 @@ struct safe_VkPipelineVertexInputStateCreateInfo {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineVertexInputStateCreateInfo(const safe_VkPipelineVertexInputStateCreateInfo& copy_src);
     safe_VkPipelineVertexInputStateCreateInfo& operator=(const safe_VkPipelineVertexInputStateCreateInfo& copy_src);
+    safe_VkPipelineVertexInputStateCreateInfo(safe_VkPipelineVertexInputStateCreateInfo&& move_src) noexcept;
+    safe_VkPipelineVertexInputStateCreateInfo& operator=(safe_VkPipelineVertexInputStateCreateInfo&& move_src) noexcept;
     safe_VkPipelineVertexInputStateCreateInfo();
     ~safe_VkPipelineVertexInputStateCreateInfo();
     void initialize(const VkPipelineVertexInputStateCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -603,6 +662,8 @@ struct safe_VkPipelineInputAssemblyStateCreateInfo {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineInputAssemblyStateCreateInfo(const safe_VkPipelineInputAssemblyStateCreateInfo& copy_src);
     safe_VkPipelineInputAssemblyStateCreateInfo& operator=(const safe_VkPipelineInputAssemblyStateCreateInfo& copy_src);
+    safe_VkPipelineInputAssemblyStateCreateInfo(safe_VkPipelineInputAssemblyStateCreateInfo&& move_src) noexcept;
+    safe_VkPipelineInputAssemblyStateCreateInfo& operator=(safe_VkPipelineInputAssemblyStateCreateInfo&& move_src) noexcept;
     safe_VkPipelineInputAssemblyStateCreateInfo();
     ~safe_VkPipelineInputAssemblyStateCreateInfo();
     void initialize(const VkPipelineInputAssemblyStateCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -622,6 +683,8 @@ struct safe_VkPipelineTessellationStateCreateInfo {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineTessellationStateCreateInfo(const safe_VkPipelineTessellationStateCreateInfo& copy_src);
     safe_VkPipelineTessellationStateCreateInfo& operator=(const safe_VkPipelineTessellationStateCreateInfo& copy_src);
+    safe_VkPipelineTessellationStateCreateInfo(safe_VkPipelineTessellationStateCreateInfo&& move_src) noexcept;
+    safe_VkPipelineTessellationStateCreateInfo& operator=(safe_VkPipelineTessellationStateCreateInfo&& move_src) noexcept;
     safe_VkPipelineTessellationStateCreateInfo();
     ~safe_VkPipelineTessellationStateCreateInfo();
     void initialize(const VkPipelineTessellationStateCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -644,6 +707,8 @@ struct safe_VkPipelineViewportStateCreateInfo {
                                            const bool is_dynamic_scissors, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineViewportStateCreateInfo(const safe_VkPipelineViewportStateCreateInfo& copy_src);
     safe_VkPipelineViewportStateCreateInfo& operator=(const safe_VkPipelineViewportStateCreateInfo& copy_src);
+    safe_VkPipelineViewportStateCreateInfo(safe_VkPipelineViewportStateCreateInfo&& move_src) noexcept;
+    safe_VkPipelineViewportStateCreateInfo& operator=(safe_VkPipelineViewportStateCreateInfo&& move_src) noexcept;
     safe_VkPipelineViewportStateCreateInfo();
     ~safe_VkPipelineViewportStateCreateInfo();
     void initialize(const VkPipelineViewportStateCreateInfo* in_struct, const bool is_dynamic_viewports,
@@ -673,6 +738,8 @@ struct safe_VkPipelineRasterizationStateCreateInfo {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineRasterizationStateCreateInfo(const safe_VkPipelineRasterizationStateCreateInfo& copy_src);
     safe_VkPipelineRasterizationStateCreateInfo& operator=(const safe_VkPipelineRasterizationStateCreateInfo& copy_src);
+    safe_VkPipelineRasterizationStateCreateInfo(safe_VkPipelineRasterizationStateCreateInfo&& move_src) noexcept;
+    safe_VkPipelineRasterizationStateCreateInfo& operator=(safe_VkPipelineRasterizationStateCreateInfo&& move_src) noexcept;
     safe_VkPipelineRasterizationStateCreateInfo();
     ~safe_VkPipelineRasterizationStateCreateInfo();
     void initialize(const VkPipelineRasterizationStateCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -697,6 +764,8 @@ struct safe_VkPipelineMultisampleStateCreateInfo {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineMultisampleStateCreateInfo(const safe_VkPipelineMultisampleStateCreateInfo& copy_src);
     safe_VkPipelineMultisampleStateCreateInfo& operator=(const safe_VkPipelineMultisampleStateCreateInfo& copy_src);
+    safe_VkPipelineMultisampleStateCreateInfo(safe_VkPipelineMultisampleStateCreateInfo&& move_src) noexcept;
+    safe_VkPipelineMultisampleStateCreateInfo& operator=(safe_VkPipelineMultisampleStateCreateInfo&& move_src) noexcept;
     safe_VkPipelineMultisampleStateCreateInfo();
     ~safe_VkPipelineMultisampleStateCreateInfo();
     void initialize(const VkPipelineMultisampleStateCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -724,6 +793,8 @@ struct safe_VkPipelineDepthStencilStateCreateInfo {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineDepthStencilStateCreateInfo(const safe_VkPipelineDepthStencilStateCreateInfo& copy_src);
     safe_VkPipelineDepthStencilStateCreateInfo& operator=(const safe_VkPipelineDepthStencilStateCreateInfo& copy_src);
+    safe_VkPipelineDepthStencilStateCreateInfo(safe_VkPipelineDepthStencilStateCreateInfo&& move_src) noexcept;
+    safe_VkPipelineDepthStencilStateCreateInfo& operator=(safe_VkPipelineDepthStencilStateCreateInfo&& move_src) noexcept;
     safe_VkPipelineDepthStencilStateCreateInfo();
     ~safe_VkPipelineDepthStencilStateCreateInfo();
     void initialize(const VkPipelineDepthStencilStateCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -747,6 +818,8 @@ struct safe_VkPipelineColorBlendStateCreateInfo {
                                              bool copy_pnext = true);
     safe_VkPipelineColorBlendStateCreateInfo(const safe_VkPipelineColorBlendStateCreateInfo& copy_src);
     safe_VkPipelineColorBlendStateCreateInfo& operator=(const safe_VkPipelineColorBlendStateCreateInfo& copy_src);
+    safe_VkPipelineColorBlendStateCreateInfo(safe_VkPipelineColorBlendStateCreateInfo&& move_src) noexcept;
+    safe_VkPipelineColorBlendStateCreateInfo& operator=(safe_VkPipelineColorBlendStateCreateInfo&& move_src) noexcept;
     safe_VkPipelineColorBlendStateCreateInfo();
     ~safe_VkPipelineColorBlendStateCreateInfo();
     void initialize(const VkPipelineColorBlendStateCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -767,6 +840,8 @@ struct safe_VkPipelineDynamicStateCreateInfo {
                                           bool copy_pnext = true);
     safe_VkPipelineDynamicStateCreateInfo(const safe_VkPipelineDynamicStateCreateInfo& copy_src);
     safe_VkPipelineDynamicStateCreateInfo& operator=(const safe_VkPipelineDynamicStateCreateInfo& copy_src);
+    safe_VkPipelineDynamicStateCreateInfo(safe_VkPipelineDynamicStateCreateInfo&& move_src) noexcept;
+    safe_VkPipelineDynamicStateCreateInfo& operator=(safe_VkPipelineDynamicStateCreateInfo&& move_src) noexcept;
     safe_VkPipelineDynamicStateCreateInfo();
     ~safe_VkPipelineDynamicStateCreateInfo();
     void initialize(const VkPipelineDynamicStateCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -800,6 +875,8 @@ struct safe_VkGraphicsPipelineCreateInfo {
                                       bool copy_pnext = true);
     safe_VkGraphicsPipelineCreateInfo(const safe_VkGraphicsPipelineCreateInfo& copy_src);
     safe_VkGraphicsPipelineCreateInfo& operator=(const safe_VkGraphicsPipelineCreateInfo& copy_src);
+    safe_VkGraphicsPipelineCreateInfo(safe_VkGraphicsPipelineCreateInfo&& move_src) noexcept;
+    safe_VkGraphicsPipelineCreateInfo& operator=(safe_VkGraphicsPipelineCreateInfo&& move_src) noexcept;
     safe_VkGraphicsPipelineCreateInfo();
     ~safe_VkGraphicsPipelineCreateInfo();
     void initialize(const VkGraphicsPipelineCreateInfo* in_struct, const bool uses_color_attachment,
@@ -821,6 +898,8 @@ struct safe_VkPipelineLayoutCreateInfo {
                                     bool copy_pnext = true);
     safe_VkPipelineLayoutCreateInfo(const safe_VkPipelineLayoutCreateInfo& copy_src);
     safe_VkPipelineLayoutCreateInfo& operator=(const safe_VkPipelineLayoutCreateInfo& copy_src);
+    safe_VkPipelineLayoutCreateInfo(safe_VkPipelineLayoutCreateInfo&& move_src) noexcept;
+    safe_VkPipelineLayoutCreateInfo& operator=(safe_VkPipelineLayoutCreateInfo&& move_src) noexcept;
     safe_VkPipelineLayoutCreateInfo();
     ~safe_VkPipelineLayoutCreateInfo();
     void initialize(const VkPipelineLayoutCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -851,6 +930,8 @@ struct safe_VkSamplerCreateInfo {
     safe_VkSamplerCreateInfo(const VkSamplerCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSamplerCreateInfo(const safe_VkSamplerCreateInfo& copy_src);
     safe_VkSamplerCreateInfo& operator=(const safe_VkSamplerCreateInfo& copy_src);
+    safe_VkSamplerCreateInfo(safe_VkSamplerCreateInfo&& move_src) noexcept;
+    safe_VkSamplerCreateInfo& operator=(safe_VkSamplerCreateInfo&& move_src) noexcept;
     safe_VkSamplerCreateInfo();
     ~safe_VkSamplerCreateInfo();
     void initialize(const VkSamplerCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -872,6 +953,8 @@ struct safe_VkCopyDescriptorSet {
     safe_VkCopyDescriptorSet(const VkCopyDescriptorSet* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCopyDescriptorSet(const safe_VkCopyDescriptorSet& copy_src);
     safe_VkCopyDescriptorSet& operator=(const safe_VkCopyDescriptorSet& copy_src);
+    safe_VkCopyDescriptorSet(safe_VkCopyDescriptorSet&& move_src) noexcept;
+    safe_VkCopyDescriptorSet& operator=(safe_VkCopyDescriptorSet&& move_src) noexcept;
     safe_VkCopyDescriptorSet();
     ~safe_VkCopyDescriptorSet();
     void initialize(const VkCopyDescriptorSet* in_struct, PNextCopyState* copy_state = {});
@@ -891,6 +974,8 @@ struct safe_VkDescriptorPoolCreateInfo {
                                     bool copy_pnext = true);
     safe_VkDescriptorPoolCreateInfo(const safe_VkDescriptorPoolCreateInfo& copy_src);
     safe_VkDescriptorPoolCreateInfo& operator=(const safe_VkDescriptorPoolCreateInfo& copy_src);
+    safe_VkDescriptorPoolCreateInfo(safe_VkDescriptorPoolCreateInfo&& move_src) noexcept;
+    safe_VkDescriptorPoolCreateInfo& operator=(safe_VkDescriptorPoolCreateInfo&& move_src) noexcept;
     safe_VkDescriptorPoolCreateInfo();
     ~safe_VkDescriptorPoolCreateInfo();
     void initialize(const VkDescriptorPoolCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -909,6 +994,8 @@ struct safe_VkDescriptorSetAllocateInfo {
                                      bool copy_pnext = true);
     safe_VkDescriptorSetAllocateInfo(const safe_VkDescriptorSetAllocateInfo& copy_src);
     safe_VkDescriptorSetAllocateInfo& operator=(const safe_VkDescriptorSetAllocateInfo& copy_src);
+    safe_VkDescriptorSetAllocateInfo(safe_VkDescriptorSetAllocateInfo&& move_src) noexcept;
+    safe_VkDescriptorSetAllocateInfo& operator=(safe_VkDescriptorSetAllocateInfo&& move_src) noexcept;
     safe_VkDescriptorSetAllocateInfo();
     ~safe_VkDescriptorSetAllocateInfo();
     void initialize(const VkDescriptorSetAllocateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -926,6 +1013,8 @@ struct safe_VkDescriptorSetLayoutBinding {
     safe_VkDescriptorSetLayoutBinding(const VkDescriptorSetLayoutBinding* in_struct, PNextCopyState* copy_state = {});
     safe_VkDescriptorSetLayoutBinding(const safe_VkDescriptorSetLayoutBinding& copy_src);
     safe_VkDescriptorSetLayoutBinding& operator=(const safe_VkDescriptorSetLayoutBinding& copy_src);
+    safe_VkDescriptorSetLayoutBinding(safe_VkDescriptorSetLayoutBinding&& move_src) noexcept;
+    safe_VkDescriptorSetLayoutBinding& operator=(safe_VkDescriptorSetLayoutBinding&& move_src) noexcept;
     safe_VkDescriptorSetLayoutBinding();
     ~safe_VkDescriptorSetLayoutBinding();
     void initialize(const VkDescriptorSetLayoutBinding* in_struct, PNextCopyState* copy_state = {});
@@ -944,6 +1033,8 @@ struct safe_VkDescriptorSetLayoutCreateInfo {
                                          bool copy_pnext = true);
     safe_VkDescriptorSetLayoutCreateInfo(const safe_VkDescriptorSetLayoutCreateInfo& copy_src);
     safe_VkDescriptorSetLayoutCreateInfo& operator=(const safe_VkDescriptorSetLayoutCreateInfo& copy_src);
+    safe_VkDescriptorSetLayoutCreateInfo(safe_VkDescriptorSetLayoutCreateInfo&& move_src) noexcept;
+    safe_VkDescriptorSetLayoutCreateInfo& operator=(safe_VkDescriptorSetLayoutCreateInfo&& move_src) noexcept;
     safe_VkDescriptorSetLayoutCreateInfo();
     ~safe_VkDescriptorSetLayoutCreateInfo();
     void initialize(const VkDescriptorSetLayoutCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -966,6 +1057,8 @@ struct safe_VkWriteDescriptorSet {
     safe_VkWriteDescriptorSet(const VkWriteDescriptorSet* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkWriteDescriptorSet(const safe_VkWriteDescriptorSet& copy_src);
     safe_VkWriteDescriptorSet& operator=(const safe_VkWriteDescriptorSet& copy_src);
+    safe_VkWriteDescriptorSet(safe_VkWriteDescriptorSet&& move_src) noexcept;
+    safe_VkWriteDescriptorSet& operator=(safe_VkWriteDescriptorSet&& move_src) noexcept;
     safe_VkWriteDescriptorSet();
     ~safe_VkWriteDescriptorSet();
     void initialize(const VkWriteDescriptorSet* in_struct, PNextCopyState* copy_state = {});
@@ -987,6 +1080,8 @@ struct safe_VkFramebufferCreateInfo {
     safe_VkFramebufferCreateInfo(const VkFramebufferCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkFramebufferCreateInfo(const safe_VkFramebufferCreateInfo& copy_src);
     safe_VkFramebufferCreateInfo& operator=(const safe_VkFramebufferCreateInfo& copy_src);
+    safe_VkFramebufferCreateInfo(safe_VkFramebufferCreateInfo&& move_src) noexcept;
+    safe_VkFramebufferCreateInfo& operator=(safe_VkFramebufferCreateInfo&& move_src) noexcept;
     safe_VkFramebufferCreateInfo();
     ~safe_VkFramebufferCreateInfo();
     void initialize(const VkFramebufferCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1009,6 +1104,8 @@ struct safe_VkSubpassDescription {
     safe_VkSubpassDescription(const VkSubpassDescription* in_struct, PNextCopyState* copy_state = {});
     safe_VkSubpassDescription(const safe_VkSubpassDescription& copy_src);
     safe_VkSubpassDescription& operator=(const safe_VkSubpassDescription& copy_src);
+    safe_VkSubpassDescription(safe_VkSubpassDescription&& move_src) noexcept;
+    safe_VkSubpassDescription& operator=(safe_VkSubpassDescription&& move_src) noexcept;
     safe_VkSubpassDescription();
     ~safe_VkSubpassDescription();
     void initialize(const VkSubpassDescription* in_struct, PNextCopyState* copy_state = {});
@@ -1030,6 +1127,8 @@ struct safe_VkRenderPassCreateInfo {
     safe_VkRenderPassCreateInfo(const VkRenderPassCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRenderPassCreateInfo(const safe_VkRenderPassCreateInfo& copy_src);
     safe_VkRenderPassCreateInfo& operator=(const safe_VkRenderPassCreateInfo& copy_src);
+    safe_VkRenderPassCreateInfo(safe_VkRenderPassCreateInfo&& move_src) noexcept;
+    safe_VkRenderPassCreateInfo& operator=(safe_VkRenderPassCreateInfo&& move_src) noexcept;
     safe_VkRenderPassCreateInfo();
     ~safe_VkRenderPassCreateInfo();
     void initialize(const VkRenderPassCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1046,6 +1145,8 @@ struct safe_VkCommandPoolCreateInfo {
     safe_VkCommandPoolCreateInfo(const VkCommandPoolCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCommandPoolCreateInfo(const safe_VkCommandPoolCreateInfo& copy_src);
     safe_VkCommandPoolCreateInfo& operator=(const safe_VkCommandPoolCreateInfo& copy_src);
+    safe_VkCommandPoolCreateInfo(safe_VkCommandPoolCreateInfo&& move_src) noexcept;
+    safe_VkCommandPoolCreateInfo& operator=(safe_VkCommandPoolCreateInfo&& move_src) noexcept;
     safe_VkCommandPoolCreateInfo();
     ~safe_VkCommandPoolCreateInfo();
     void initialize(const VkCommandPoolCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1064,6 +1165,8 @@ struct safe_VkCommandBufferAllocateInfo {
                                      bool copy_pnext = true);
     safe_VkCommandBufferAllocateInfo(const safe_VkCommandBufferAllocateInfo& copy_src);
     safe_VkCommandBufferAllocateInfo& operator=(const safe_VkCommandBufferAllocateInfo& copy_src);
+    safe_VkCommandBufferAllocateInfo(safe_VkCommandBufferAllocateInfo&& move_src) noexcept;
+    safe_VkCommandBufferAllocateInfo& operator=(safe_VkCommandBufferAllocateInfo&& move_src) noexcept;
     safe_VkCommandBufferAllocateInfo();
     ~safe_VkCommandBufferAllocateInfo();
     void initialize(const VkCommandBufferAllocateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1085,6 +1188,8 @@ struct safe_VkCommandBufferInheritanceInfo {
                                         bool copy_pnext = true);
     safe_VkCommandBufferInheritanceInfo(const safe_VkCommandBufferInheritanceInfo& copy_src);
     safe_VkCommandBufferInheritanceInfo& operator=(const safe_VkCommandBufferInheritanceInfo& copy_src);
+    safe_VkCommandBufferInheritanceInfo(safe_VkCommandBufferInheritanceInfo&& move_src) noexcept;
+    safe_VkCommandBufferInheritanceInfo& operator=(safe_VkCommandBufferInheritanceInfo&& move_src) noexcept;
     safe_VkCommandBufferInheritanceInfo();
     ~safe_VkCommandBufferInheritanceInfo();
     void initialize(const VkCommandBufferInheritanceInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1102,6 +1207,8 @@ struct safe_VkCommandBufferBeginInfo {
                                   bool copy_pnext = true);
     safe_VkCommandBufferBeginInfo(const safe_VkCommandBufferBeginInfo& copy_src);
     safe_VkCommandBufferBeginInfo& operator=(const safe_VkCommandBufferBeginInfo& copy_src);
+    safe_VkCommandBufferBeginInfo(safe_VkCommandBufferBeginInfo&& move_src) noexcept;
+    safe_VkCommandBufferBeginInfo& operator=(safe_VkCommandBufferBeginInfo&& move_src) noexcept;
     safe_VkCommandBufferBeginInfo();
     ~safe_VkCommandBufferBeginInfo();
     void initialize(const VkCommandBufferBeginInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1121,6 +1228,8 @@ struct safe_VkRenderPassBeginInfo {
     safe_VkRenderPassBeginInfo(const VkRenderPassBeginInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRenderPassBeginInfo(const safe_VkRenderPassBeginInfo& copy_src);
     safe_VkRenderPassBeginInfo& operator=(const safe_VkRenderPassBeginInfo& copy_src);
+    safe_VkRenderPassBeginInfo(safe_VkRenderPassBeginInfo&& move_src) noexcept;
+    safe_VkRenderPassBeginInfo& operator=(safe_VkRenderPassBeginInfo&& move_src) noexcept;
     safe_VkRenderPassBeginInfo();
     ~safe_VkRenderPassBeginInfo();
     void initialize(const VkRenderPassBeginInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1140,6 +1249,8 @@ struct safe_VkPhysicalDeviceSubgroupProperties {
                                             bool copy_pnext = true);
     safe_VkPhysicalDeviceSubgroupProperties(const safe_VkPhysicalDeviceSubgroupProperties& copy_src);
     safe_VkPhysicalDeviceSubgroupProperties& operator=(const safe_VkPhysicalDeviceSubgroupProperties& copy_src);
+    safe_VkPhysicalDeviceSubgroupProperties(safe_VkPhysicalDeviceSubgroupProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceSubgroupProperties& operator=(safe_VkPhysicalDeviceSubgroupProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceSubgroupProperties();
     ~safe_VkPhysicalDeviceSubgroupProperties();
     void initialize(const VkPhysicalDeviceSubgroupProperties* in_struct, PNextCopyState* copy_state = {});
@@ -1159,6 +1270,8 @@ struct safe_VkBindBufferMemoryInfo {
     safe_VkBindBufferMemoryInfo(const VkBindBufferMemoryInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBindBufferMemoryInfo(const safe_VkBindBufferMemoryInfo& copy_src);
     safe_VkBindBufferMemoryInfo& operator=(const safe_VkBindBufferMemoryInfo& copy_src);
+    safe_VkBindBufferMemoryInfo(safe_VkBindBufferMemoryInfo&& move_src) noexcept;
+    safe_VkBindBufferMemoryInfo& operator=(safe_VkBindBufferMemoryInfo&& move_src) noexcept;
     safe_VkBindBufferMemoryInfo();
     ~safe_VkBindBufferMemoryInfo();
     void initialize(const VkBindBufferMemoryInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1176,6 +1289,8 @@ struct safe_VkBindImageMemoryInfo {
     safe_VkBindImageMemoryInfo(const VkBindImageMemoryInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBindImageMemoryInfo(const safe_VkBindImageMemoryInfo& copy_src);
     safe_VkBindImageMemoryInfo& operator=(const safe_VkBindImageMemoryInfo& copy_src);
+    safe_VkBindImageMemoryInfo(safe_VkBindImageMemoryInfo&& move_src) noexcept;
+    safe_VkBindImageMemoryInfo& operator=(safe_VkBindImageMemoryInfo&& move_src) noexcept;
     safe_VkBindImageMemoryInfo();
     ~safe_VkBindImageMemoryInfo();
     void initialize(const VkBindImageMemoryInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1195,6 +1310,8 @@ struct safe_VkPhysicalDevice16BitStorageFeatures {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDevice16BitStorageFeatures(const safe_VkPhysicalDevice16BitStorageFeatures& copy_src);
     safe_VkPhysicalDevice16BitStorageFeatures& operator=(const safe_VkPhysicalDevice16BitStorageFeatures& copy_src);
+    safe_VkPhysicalDevice16BitStorageFeatures(safe_VkPhysicalDevice16BitStorageFeatures&& move_src) noexcept;
+    safe_VkPhysicalDevice16BitStorageFeatures& operator=(safe_VkPhysicalDevice16BitStorageFeatures&& move_src) noexcept;
     safe_VkPhysicalDevice16BitStorageFeatures();
     ~safe_VkPhysicalDevice16BitStorageFeatures();
     void initialize(const VkPhysicalDevice16BitStorageFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -1214,6 +1331,8 @@ struct safe_VkMemoryDedicatedRequirements {
                                        bool copy_pnext = true);
     safe_VkMemoryDedicatedRequirements(const safe_VkMemoryDedicatedRequirements& copy_src);
     safe_VkMemoryDedicatedRequirements& operator=(const safe_VkMemoryDedicatedRequirements& copy_src);
+    safe_VkMemoryDedicatedRequirements(safe_VkMemoryDedicatedRequirements&& move_src) noexcept;
+    safe_VkMemoryDedicatedRequirements& operator=(safe_VkMemoryDedicatedRequirements&& move_src) noexcept;
     safe_VkMemoryDedicatedRequirements();
     ~safe_VkMemoryDedicatedRequirements();
     void initialize(const VkMemoryDedicatedRequirements* in_struct, PNextCopyState* copy_state = {});
@@ -1231,6 +1350,8 @@ struct safe_VkMemoryDedicatedAllocateInfo {
                                        bool copy_pnext = true);
     safe_VkMemoryDedicatedAllocateInfo(const safe_VkMemoryDedicatedAllocateInfo& copy_src);
     safe_VkMemoryDedicatedAllocateInfo& operator=(const safe_VkMemoryDedicatedAllocateInfo& copy_src);
+    safe_VkMemoryDedicatedAllocateInfo(safe_VkMemoryDedicatedAllocateInfo&& move_src) noexcept;
+    safe_VkMemoryDedicatedAllocateInfo& operator=(safe_VkMemoryDedicatedAllocateInfo&& move_src) noexcept;
     safe_VkMemoryDedicatedAllocateInfo();
     ~safe_VkMemoryDedicatedAllocateInfo();
     void initialize(const VkMemoryDedicatedAllocateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1248,6 +1369,8 @@ struct safe_VkMemoryAllocateFlagsInfo {
                                    bool copy_pnext = true);
     safe_VkMemoryAllocateFlagsInfo(const safe_VkMemoryAllocateFlagsInfo& copy_src);
     safe_VkMemoryAllocateFlagsInfo& operator=(const safe_VkMemoryAllocateFlagsInfo& copy_src);
+    safe_VkMemoryAllocateFlagsInfo(safe_VkMemoryAllocateFlagsInfo&& move_src) noexcept;
+    safe_VkMemoryAllocateFlagsInfo& operator=(safe_VkMemoryAllocateFlagsInfo&& move_src) noexcept;
     safe_VkMemoryAllocateFlagsInfo();
     ~safe_VkMemoryAllocateFlagsInfo();
     void initialize(const VkMemoryAllocateFlagsInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1266,6 +1389,8 @@ struct safe_VkDeviceGroupRenderPassBeginInfo {
                                           bool copy_pnext = true);
     safe_VkDeviceGroupRenderPassBeginInfo(const safe_VkDeviceGroupRenderPassBeginInfo& copy_src);
     safe_VkDeviceGroupRenderPassBeginInfo& operator=(const safe_VkDeviceGroupRenderPassBeginInfo& copy_src);
+    safe_VkDeviceGroupRenderPassBeginInfo(safe_VkDeviceGroupRenderPassBeginInfo&& move_src) noexcept;
+    safe_VkDeviceGroupRenderPassBeginInfo& operator=(safe_VkDeviceGroupRenderPassBeginInfo&& move_src) noexcept;
     safe_VkDeviceGroupRenderPassBeginInfo();
     ~safe_VkDeviceGroupRenderPassBeginInfo();
     void initialize(const VkDeviceGroupRenderPassBeginInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1282,6 +1407,8 @@ struct safe_VkDeviceGroupCommandBufferBeginInfo {
                                              bool copy_pnext = true);
     safe_VkDeviceGroupCommandBufferBeginInfo(const safe_VkDeviceGroupCommandBufferBeginInfo& copy_src);
     safe_VkDeviceGroupCommandBufferBeginInfo& operator=(const safe_VkDeviceGroupCommandBufferBeginInfo& copy_src);
+    safe_VkDeviceGroupCommandBufferBeginInfo(safe_VkDeviceGroupCommandBufferBeginInfo&& move_src) noexcept;
+    safe_VkDeviceGroupCommandBufferBeginInfo& operator=(safe_VkDeviceGroupCommandBufferBeginInfo&& move_src) noexcept;
     safe_VkDeviceGroupCommandBufferBeginInfo();
     ~safe_VkDeviceGroupCommandBufferBeginInfo();
     void initialize(const VkDeviceGroupCommandBufferBeginInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1304,6 +1431,8 @@ struct safe_VkDeviceGroupSubmitInfo {
     safe_VkDeviceGroupSubmitInfo(const VkDeviceGroupSubmitInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceGroupSubmitInfo(const safe_VkDeviceGroupSubmitInfo& copy_src);
     safe_VkDeviceGroupSubmitInfo& operator=(const safe_VkDeviceGroupSubmitInfo& copy_src);
+    safe_VkDeviceGroupSubmitInfo(safe_VkDeviceGroupSubmitInfo&& move_src) noexcept;
+    safe_VkDeviceGroupSubmitInfo& operator=(safe_VkDeviceGroupSubmitInfo&& move_src) noexcept;
     safe_VkDeviceGroupSubmitInfo();
     ~safe_VkDeviceGroupSubmitInfo();
     void initialize(const VkDeviceGroupSubmitInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1321,6 +1450,8 @@ struct safe_VkDeviceGroupBindSparseInfo {
                                      bool copy_pnext = true);
     safe_VkDeviceGroupBindSparseInfo(const safe_VkDeviceGroupBindSparseInfo& copy_src);
     safe_VkDeviceGroupBindSparseInfo& operator=(const safe_VkDeviceGroupBindSparseInfo& copy_src);
+    safe_VkDeviceGroupBindSparseInfo(safe_VkDeviceGroupBindSparseInfo&& move_src) noexcept;
+    safe_VkDeviceGroupBindSparseInfo& operator=(safe_VkDeviceGroupBindSparseInfo&& move_src) noexcept;
     safe_VkDeviceGroupBindSparseInfo();
     ~safe_VkDeviceGroupBindSparseInfo();
     void initialize(const VkDeviceGroupBindSparseInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1338,6 +1469,8 @@ struct safe_VkBindBufferMemoryDeviceGroupInfo {
                                            bool copy_pnext = true);
     safe_VkBindBufferMemoryDeviceGroupInfo(const safe_VkBindBufferMemoryDeviceGroupInfo& copy_src);
     safe_VkBindBufferMemoryDeviceGroupInfo& operator=(const safe_VkBindBufferMemoryDeviceGroupInfo& copy_src);
+    safe_VkBindBufferMemoryDeviceGroupInfo(safe_VkBindBufferMemoryDeviceGroupInfo&& move_src) noexcept;
+    safe_VkBindBufferMemoryDeviceGroupInfo& operator=(safe_VkBindBufferMemoryDeviceGroupInfo&& move_src) noexcept;
     safe_VkBindBufferMemoryDeviceGroupInfo();
     ~safe_VkBindBufferMemoryDeviceGroupInfo();
     void initialize(const VkBindBufferMemoryDeviceGroupInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1359,6 +1492,8 @@ struct safe_VkBindImageMemoryDeviceGroupInfo {
                                           bool copy_pnext = true);
     safe_VkBindImageMemoryDeviceGroupInfo(const safe_VkBindImageMemoryDeviceGroupInfo& copy_src);
     safe_VkBindImageMemoryDeviceGroupInfo& operator=(const safe_VkBindImageMemoryDeviceGroupInfo& copy_src);
+    safe_VkBindImageMemoryDeviceGroupInfo(safe_VkBindImageMemoryDeviceGroupInfo&& move_src) noexcept;
+    safe_VkBindImageMemoryDeviceGroupInfo& operator=(safe_VkBindImageMemoryDeviceGroupInfo&& move_src) noexcept;
     safe_VkBindImageMemoryDeviceGroupInfo();
     ~safe_VkBindImageMemoryDeviceGroupInfo();
     void initialize(const VkBindImageMemoryDeviceGroupInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1377,6 +1512,8 @@ struct safe_VkPhysicalDeviceGroupProperties {
                                          bool copy_pnext = true);
     safe_VkPhysicalDeviceGroupProperties(const safe_VkPhysicalDeviceGroupProperties& copy_src);
     safe_VkPhysicalDeviceGroupProperties& operator=(const safe_VkPhysicalDeviceGroupProperties& copy_src);
+    safe_VkPhysicalDeviceGroupProperties(safe_VkPhysicalDeviceGroupProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceGroupProperties& operator=(safe_VkPhysicalDeviceGroupProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceGroupProperties();
     ~safe_VkPhysicalDeviceGroupProperties();
     void initialize(const VkPhysicalDeviceGroupProperties* in_struct, PNextCopyState* copy_state = {});
@@ -1394,6 +1531,8 @@ struct safe_VkDeviceGroupDeviceCreateInfo {
                                        bool copy_pnext = true);
     safe_VkDeviceGroupDeviceCreateInfo(const safe_VkDeviceGroupDeviceCreateInfo& copy_src);
     safe_VkDeviceGroupDeviceCreateInfo& operator=(const safe_VkDeviceGroupDeviceCreateInfo& copy_src);
+    safe_VkDeviceGroupDeviceCreateInfo(safe_VkDeviceGroupDeviceCreateInfo&& move_src) noexcept;
+    safe_VkDeviceGroupDeviceCreateInfo& operator=(safe_VkDeviceGroupDeviceCreateInfo&& move_src) noexcept;
     safe_VkDeviceGroupDeviceCreateInfo();
     ~safe_VkDeviceGroupDeviceCreateInfo();
     void initialize(const VkDeviceGroupDeviceCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1410,6 +1549,8 @@ struct safe_VkBufferMemoryRequirementsInfo2 {
                                          bool copy_pnext = true);
     safe_VkBufferMemoryRequirementsInfo2(const safe_VkBufferMemoryRequirementsInfo2& copy_src);
     safe_VkBufferMemoryRequirementsInfo2& operator=(const safe_VkBufferMemoryRequirementsInfo2& copy_src);
+    safe_VkBufferMemoryRequirementsInfo2(safe_VkBufferMemoryRequirementsInfo2&& move_src) noexcept;
+    safe_VkBufferMemoryRequirementsInfo2& operator=(safe_VkBufferMemoryRequirementsInfo2&& move_src) noexcept;
     safe_VkBufferMemoryRequirementsInfo2();
     ~safe_VkBufferMemoryRequirementsInfo2();
     void initialize(const VkBufferMemoryRequirementsInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -1426,6 +1567,8 @@ struct safe_VkImageMemoryRequirementsInfo2 {
                                         bool copy_pnext = true);
     safe_VkImageMemoryRequirementsInfo2(const safe_VkImageMemoryRequirementsInfo2& copy_src);
     safe_VkImageMemoryRequirementsInfo2& operator=(const safe_VkImageMemoryRequirementsInfo2& copy_src);
+    safe_VkImageMemoryRequirementsInfo2(safe_VkImageMemoryRequirementsInfo2&& move_src) noexcept;
+    safe_VkImageMemoryRequirementsInfo2& operator=(safe_VkImageMemoryRequirementsInfo2&& move_src) noexcept;
     safe_VkImageMemoryRequirementsInfo2();
     ~safe_VkImageMemoryRequirementsInfo2();
     void initialize(const VkImageMemoryRequirementsInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -1442,6 +1585,8 @@ struct safe_VkImageSparseMemoryRequirementsInfo2 {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageSparseMemoryRequirementsInfo2(const safe_VkImageSparseMemoryRequirementsInfo2& copy_src);
     safe_VkImageSparseMemoryRequirementsInfo2& operator=(const safe_VkImageSparseMemoryRequirementsInfo2& copy_src);
+    safe_VkImageSparseMemoryRequirementsInfo2(safe_VkImageSparseMemoryRequirementsInfo2&& move_src) noexcept;
+    safe_VkImageSparseMemoryRequirementsInfo2& operator=(safe_VkImageSparseMemoryRequirementsInfo2&& move_src) noexcept;
     safe_VkImageSparseMemoryRequirementsInfo2();
     ~safe_VkImageSparseMemoryRequirementsInfo2();
     void initialize(const VkImageSparseMemoryRequirementsInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -1459,6 +1604,8 @@ struct safe_VkMemoryRequirements2 {
     safe_VkMemoryRequirements2(const VkMemoryRequirements2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryRequirements2(const safe_VkMemoryRequirements2& copy_src);
     safe_VkMemoryRequirements2& operator=(const safe_VkMemoryRequirements2& copy_src);
+    safe_VkMemoryRequirements2(safe_VkMemoryRequirements2&& move_src) noexcept;
+    safe_VkMemoryRequirements2& operator=(safe_VkMemoryRequirements2&& move_src) noexcept;
     safe_VkMemoryRequirements2();
     ~safe_VkMemoryRequirements2();
     void initialize(const VkMemoryRequirements2* in_struct, PNextCopyState* copy_state = {});
@@ -1475,6 +1622,8 @@ struct safe_VkSparseImageMemoryRequirements2 {
                                           bool copy_pnext = true);
     safe_VkSparseImageMemoryRequirements2(const safe_VkSparseImageMemoryRequirements2& copy_src);
     safe_VkSparseImageMemoryRequirements2& operator=(const safe_VkSparseImageMemoryRequirements2& copy_src);
+    safe_VkSparseImageMemoryRequirements2(safe_VkSparseImageMemoryRequirements2&& move_src) noexcept;
+    safe_VkSparseImageMemoryRequirements2& operator=(safe_VkSparseImageMemoryRequirements2&& move_src) noexcept;
     safe_VkSparseImageMemoryRequirements2();
     ~safe_VkSparseImageMemoryRequirements2();
     void initialize(const VkSparseImageMemoryRequirements2* in_struct, PNextCopyState* copy_state = {});
@@ -1491,6 +1640,8 @@ struct safe_VkPhysicalDeviceFeatures2 {
                                    bool copy_pnext = true);
     safe_VkPhysicalDeviceFeatures2(const safe_VkPhysicalDeviceFeatures2& copy_src);
     safe_VkPhysicalDeviceFeatures2& operator=(const safe_VkPhysicalDeviceFeatures2& copy_src);
+    safe_VkPhysicalDeviceFeatures2(safe_VkPhysicalDeviceFeatures2&& move_src) noexcept;
+    safe_VkPhysicalDeviceFeatures2& operator=(safe_VkPhysicalDeviceFeatures2&& move_src) noexcept;
     safe_VkPhysicalDeviceFeatures2();
     ~safe_VkPhysicalDeviceFeatures2();
     void initialize(const VkPhysicalDeviceFeatures2* in_struct, PNextCopyState* copy_state = {});
@@ -1507,6 +1658,8 @@ struct safe_VkPhysicalDeviceProperties2 {
                                      bool copy_pnext = true);
     safe_VkPhysicalDeviceProperties2(const safe_VkPhysicalDeviceProperties2& copy_src);
     safe_VkPhysicalDeviceProperties2& operator=(const safe_VkPhysicalDeviceProperties2& copy_src);
+    safe_VkPhysicalDeviceProperties2(safe_VkPhysicalDeviceProperties2&& move_src) noexcept;
+    safe_VkPhysicalDeviceProperties2& operator=(safe_VkPhysicalDeviceProperties2&& move_src) noexcept;
     safe_VkPhysicalDeviceProperties2();
     ~safe_VkPhysicalDeviceProperties2();
     void initialize(const VkPhysicalDeviceProperties2* in_struct, PNextCopyState* copy_state = {});
@@ -1522,6 +1675,8 @@ struct safe_VkFormatProperties2 {
     safe_VkFormatProperties2(const VkFormatProperties2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkFormatProperties2(const safe_VkFormatProperties2& copy_src);
     safe_VkFormatProperties2& operator=(const safe_VkFormatProperties2& copy_src);
+    safe_VkFormatProperties2(safe_VkFormatProperties2&& move_src) noexcept;
+    safe_VkFormatProperties2& operator=(safe_VkFormatProperties2&& move_src) noexcept;
     safe_VkFormatProperties2();
     ~safe_VkFormatProperties2();
     void initialize(const VkFormatProperties2* in_struct, PNextCopyState* copy_state = {});
@@ -1538,6 +1693,8 @@ struct safe_VkImageFormatProperties2 {
                                   bool copy_pnext = true);
     safe_VkImageFormatProperties2(const safe_VkImageFormatProperties2& copy_src);
     safe_VkImageFormatProperties2& operator=(const safe_VkImageFormatProperties2& copy_src);
+    safe_VkImageFormatProperties2(safe_VkImageFormatProperties2&& move_src) noexcept;
+    safe_VkImageFormatProperties2& operator=(safe_VkImageFormatProperties2&& move_src) noexcept;
     safe_VkImageFormatProperties2();
     ~safe_VkImageFormatProperties2();
     void initialize(const VkImageFormatProperties2* in_struct, PNextCopyState* copy_state = {});
@@ -1558,6 +1715,8 @@ struct safe_VkPhysicalDeviceImageFormatInfo2 {
                                           bool copy_pnext = true);
     safe_VkPhysicalDeviceImageFormatInfo2(const safe_VkPhysicalDeviceImageFormatInfo2& copy_src);
     safe_VkPhysicalDeviceImageFormatInfo2& operator=(const safe_VkPhysicalDeviceImageFormatInfo2& copy_src);
+    safe_VkPhysicalDeviceImageFormatInfo2(safe_VkPhysicalDeviceImageFormatInfo2&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageFormatInfo2& operator=(safe_VkPhysicalDeviceImageFormatInfo2&& move_src) noexcept;
     safe_VkPhysicalDeviceImageFormatInfo2();
     ~safe_VkPhysicalDeviceImageFormatInfo2();
     void initialize(const VkPhysicalDeviceImageFormatInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -1574,6 +1733,8 @@ struct safe_VkQueueFamilyProperties2 {
                                   bool copy_pnext = true);
     safe_VkQueueFamilyProperties2(const safe_VkQueueFamilyProperties2& copy_src);
     safe_VkQueueFamilyProperties2& operator=(const safe_VkQueueFamilyProperties2& copy_src);
+    safe_VkQueueFamilyProperties2(safe_VkQueueFamilyProperties2&& move_src) noexcept;
+    safe_VkQueueFamilyProperties2& operator=(safe_VkQueueFamilyProperties2&& move_src) noexcept;
     safe_VkQueueFamilyProperties2();
     ~safe_VkQueueFamilyProperties2();
     void initialize(const VkQueueFamilyProperties2* in_struct, PNextCopyState* copy_state = {});
@@ -1590,6 +1751,8 @@ struct safe_VkPhysicalDeviceMemoryProperties2 {
                                            bool copy_pnext = true);
     safe_VkPhysicalDeviceMemoryProperties2(const safe_VkPhysicalDeviceMemoryProperties2& copy_src);
     safe_VkPhysicalDeviceMemoryProperties2& operator=(const safe_VkPhysicalDeviceMemoryProperties2& copy_src);
+    safe_VkPhysicalDeviceMemoryProperties2(safe_VkPhysicalDeviceMemoryProperties2&& move_src) noexcept;
+    safe_VkPhysicalDeviceMemoryProperties2& operator=(safe_VkPhysicalDeviceMemoryProperties2&& move_src) noexcept;
     safe_VkPhysicalDeviceMemoryProperties2();
     ~safe_VkPhysicalDeviceMemoryProperties2();
     void initialize(const VkPhysicalDeviceMemoryProperties2* in_struct, PNextCopyState* copy_state = {});
@@ -1608,6 +1771,8 @@ struct safe_VkSparseImageFormatProperties2 {
                                         bool copy_pnext = true);
     safe_VkSparseImageFormatProperties2(const safe_VkSparseImageFormatProperties2& copy_src);
     safe_VkSparseImageFormatProperties2& operator=(const safe_VkSparseImageFormatProperties2& copy_src);
+    safe_VkSparseImageFormatProperties2(safe_VkSparseImageFormatProperties2&& move_src) noexcept;
+    safe_VkSparseImageFormatProperties2& operator=(safe_VkSparseImageFormatProperties2&& move_src) noexcept;
     safe_VkSparseImageFormatProperties2();
     ~safe_VkSparseImageFormatProperties2();
     void initialize(const VkSparseImageFormatProperties2* in_struct, PNextCopyState* copy_state = {});
@@ -1628,6 +1793,8 @@ struct safe_VkPhysicalDeviceSparseImageFormatInfo2 {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceSparseImageFormatInfo2(const safe_VkPhysicalDeviceSparseImageFormatInfo2& copy_src);
     safe_VkPhysicalDeviceSparseImageFormatInfo2& operator=(const safe_VkPhysicalDeviceSparseImageFormatInfo2& copy_src);
+    safe_VkPhysicalDeviceSparseImageFormatInfo2(safe_VkPhysicalDeviceSparseImageFormatInfo2&& move_src) noexcept;
+    safe_VkPhysicalDeviceSparseImageFormatInfo2& operator=(safe_VkPhysicalDeviceSparseImageFormatInfo2&& move_src) noexcept;
     safe_VkPhysicalDeviceSparseImageFormatInfo2();
     ~safe_VkPhysicalDeviceSparseImageFormatInfo2();
     void initialize(const VkPhysicalDeviceSparseImageFormatInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -1646,6 +1813,8 @@ struct safe_VkPhysicalDevicePointClippingProperties {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDevicePointClippingProperties(const safe_VkPhysicalDevicePointClippingProperties& copy_src);
     safe_VkPhysicalDevicePointClippingProperties& operator=(const safe_VkPhysicalDevicePointClippingProperties& copy_src);
+    safe_VkPhysicalDevicePointClippingProperties(safe_VkPhysicalDevicePointClippingProperties&& move_src) noexcept;
+    safe_VkPhysicalDevicePointClippingProperties& operator=(safe_VkPhysicalDevicePointClippingProperties&& move_src) noexcept;
     safe_VkPhysicalDevicePointClippingProperties();
     ~safe_VkPhysicalDevicePointClippingProperties();
     void initialize(const VkPhysicalDevicePointClippingProperties* in_struct, PNextCopyState* copy_state = {});
@@ -1665,6 +1834,9 @@ struct safe_VkRenderPassInputAttachmentAspectCreateInfo {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRenderPassInputAttachmentAspectCreateInfo(const safe_VkRenderPassInputAttachmentAspectCreateInfo& copy_src);
     safe_VkRenderPassInputAttachmentAspectCreateInfo& operator=(const safe_VkRenderPassInputAttachmentAspectCreateInfo& copy_src);
+    safe_VkRenderPassInputAttachmentAspectCreateInfo(safe_VkRenderPassInputAttachmentAspectCreateInfo&& move_src) noexcept;
+    safe_VkRenderPassInputAttachmentAspectCreateInfo& operator=(
+        safe_VkRenderPassInputAttachmentAspectCreateInfo&& move_src) noexcept;
     safe_VkRenderPassInputAttachmentAspectCreateInfo();
     ~safe_VkRenderPassInputAttachmentAspectCreateInfo();
     void initialize(const VkRenderPassInputAttachmentAspectCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1685,6 +1857,8 @@ struct safe_VkImageViewUsageCreateInfo {
                                     bool copy_pnext = true);
     safe_VkImageViewUsageCreateInfo(const safe_VkImageViewUsageCreateInfo& copy_src);
     safe_VkImageViewUsageCreateInfo& operator=(const safe_VkImageViewUsageCreateInfo& copy_src);
+    safe_VkImageViewUsageCreateInfo(safe_VkImageViewUsageCreateInfo&& move_src) noexcept;
+    safe_VkImageViewUsageCreateInfo& operator=(safe_VkImageViewUsageCreateInfo&& move_src) noexcept;
     safe_VkImageViewUsageCreateInfo();
     ~safe_VkImageViewUsageCreateInfo();
     void initialize(const VkImageViewUsageCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1702,6 +1876,10 @@ struct safe_VkPipelineTessellationDomainOriginStateCreateInfo {
     safe_VkPipelineTessellationDomainOriginStateCreateInfo(const safe_VkPipelineTessellationDomainOriginStateCreateInfo& copy_src);
     safe_VkPipelineTessellationDomainOriginStateCreateInfo& operator=(
         const safe_VkPipelineTessellationDomainOriginStateCreateInfo& copy_src);
+    safe_VkPipelineTessellationDomainOriginStateCreateInfo(
+        safe_VkPipelineTessellationDomainOriginStateCreateInfo&& move_src) noexcept;
+    safe_VkPipelineTessellationDomainOriginStateCreateInfo& operator=(
+        safe_VkPipelineTessellationDomainOriginStateCreateInfo&& move_src) noexcept;
     safe_VkPipelineTessellationDomainOriginStateCreateInfo();
     ~safe_VkPipelineTessellationDomainOriginStateCreateInfo();
     void initialize(const VkPipelineTessellationDomainOriginStateCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1727,6 +1905,8 @@ struct safe_VkRenderPassMultiviewCreateInfo {
                                          bool copy_pnext = true);
     safe_VkRenderPassMultiviewCreateInfo(const safe_VkRenderPassMultiviewCreateInfo& copy_src);
     safe_VkRenderPassMultiviewCreateInfo& operator=(const safe_VkRenderPassMultiviewCreateInfo& copy_src);
+    safe_VkRenderPassMultiviewCreateInfo(safe_VkRenderPassMultiviewCreateInfo&& move_src) noexcept;
+    safe_VkRenderPassMultiviewCreateInfo& operator=(safe_VkRenderPassMultiviewCreateInfo&& move_src) noexcept;
     safe_VkRenderPassMultiviewCreateInfo();
     ~safe_VkRenderPassMultiviewCreateInfo();
     void initialize(const VkRenderPassMultiviewCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1745,6 +1925,8 @@ struct safe_VkPhysicalDeviceMultiviewFeatures {
                                            bool copy_pnext = true);
     safe_VkPhysicalDeviceMultiviewFeatures(const safe_VkPhysicalDeviceMultiviewFeatures& copy_src);
     safe_VkPhysicalDeviceMultiviewFeatures& operator=(const safe_VkPhysicalDeviceMultiviewFeatures& copy_src);
+    safe_VkPhysicalDeviceMultiviewFeatures(safe_VkPhysicalDeviceMultiviewFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceMultiviewFeatures& operator=(safe_VkPhysicalDeviceMultiviewFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceMultiviewFeatures();
     ~safe_VkPhysicalDeviceMultiviewFeatures();
     void initialize(const VkPhysicalDeviceMultiviewFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -1764,6 +1946,8 @@ struct safe_VkPhysicalDeviceMultiviewProperties {
                                              bool copy_pnext = true);
     safe_VkPhysicalDeviceMultiviewProperties(const safe_VkPhysicalDeviceMultiviewProperties& copy_src);
     safe_VkPhysicalDeviceMultiviewProperties& operator=(const safe_VkPhysicalDeviceMultiviewProperties& copy_src);
+    safe_VkPhysicalDeviceMultiviewProperties(safe_VkPhysicalDeviceMultiviewProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceMultiviewProperties& operator=(safe_VkPhysicalDeviceMultiviewProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceMultiviewProperties();
     ~safe_VkPhysicalDeviceMultiviewProperties();
     void initialize(const VkPhysicalDeviceMultiviewProperties* in_struct, PNextCopyState* copy_state = {});
@@ -1783,6 +1967,8 @@ struct safe_VkPhysicalDeviceVariablePointersFeatures {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceVariablePointersFeatures(const safe_VkPhysicalDeviceVariablePointersFeatures& copy_src);
     safe_VkPhysicalDeviceVariablePointersFeatures& operator=(const safe_VkPhysicalDeviceVariablePointersFeatures& copy_src);
+    safe_VkPhysicalDeviceVariablePointersFeatures(safe_VkPhysicalDeviceVariablePointersFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceVariablePointersFeatures& operator=(safe_VkPhysicalDeviceVariablePointersFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceVariablePointersFeatures();
     ~safe_VkPhysicalDeviceVariablePointersFeatures();
     void initialize(const VkPhysicalDeviceVariablePointersFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -1801,6 +1987,8 @@ struct safe_VkPhysicalDeviceProtectedMemoryFeatures {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceProtectedMemoryFeatures(const safe_VkPhysicalDeviceProtectedMemoryFeatures& copy_src);
     safe_VkPhysicalDeviceProtectedMemoryFeatures& operator=(const safe_VkPhysicalDeviceProtectedMemoryFeatures& copy_src);
+    safe_VkPhysicalDeviceProtectedMemoryFeatures(safe_VkPhysicalDeviceProtectedMemoryFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceProtectedMemoryFeatures& operator=(safe_VkPhysicalDeviceProtectedMemoryFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceProtectedMemoryFeatures();
     ~safe_VkPhysicalDeviceProtectedMemoryFeatures();
     void initialize(const VkPhysicalDeviceProtectedMemoryFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -1819,6 +2007,8 @@ struct safe_VkPhysicalDeviceProtectedMemoryProperties {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceProtectedMemoryProperties(const safe_VkPhysicalDeviceProtectedMemoryProperties& copy_src);
     safe_VkPhysicalDeviceProtectedMemoryProperties& operator=(const safe_VkPhysicalDeviceProtectedMemoryProperties& copy_src);
+    safe_VkPhysicalDeviceProtectedMemoryProperties(safe_VkPhysicalDeviceProtectedMemoryProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceProtectedMemoryProperties& operator=(safe_VkPhysicalDeviceProtectedMemoryProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceProtectedMemoryProperties();
     ~safe_VkPhysicalDeviceProtectedMemoryProperties();
     void initialize(const VkPhysicalDeviceProtectedMemoryProperties* in_struct, PNextCopyState* copy_state = {});
@@ -1838,6 +2028,8 @@ struct safe_VkDeviceQueueInfo2 {
     safe_VkDeviceQueueInfo2(const VkDeviceQueueInfo2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceQueueInfo2(const safe_VkDeviceQueueInfo2& copy_src);
     safe_VkDeviceQueueInfo2& operator=(const safe_VkDeviceQueueInfo2& copy_src);
+    safe_VkDeviceQueueInfo2(safe_VkDeviceQueueInfo2&& move_src) noexcept;
+    safe_VkDeviceQueueInfo2& operator=(safe_VkDeviceQueueInfo2&& move_src) noexcept;
     safe_VkDeviceQueueInfo2();
     ~safe_VkDeviceQueueInfo2();
     void initialize(const VkDeviceQueueInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -1853,6 +2045,8 @@ struct safe_VkProtectedSubmitInfo {
     safe_VkProtectedSubmitInfo(const VkProtectedSubmitInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkProtectedSubmitInfo(const safe_VkProtectedSubmitInfo& copy_src);
     safe_VkProtectedSubmitInfo& operator=(const safe_VkProtectedSubmitInfo& copy_src);
+    safe_VkProtectedSubmitInfo(safe_VkProtectedSubmitInfo&& move_src) noexcept;
+    safe_VkProtectedSubmitInfo& operator=(safe_VkProtectedSubmitInfo&& move_src) noexcept;
     safe_VkProtectedSubmitInfo();
     ~safe_VkProtectedSubmitInfo();
     void initialize(const VkProtectedSubmitInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1876,6 +2070,8 @@ struct safe_VkSamplerYcbcrConversionCreateInfo {
                                             bool copy_pnext = true);
     safe_VkSamplerYcbcrConversionCreateInfo(const safe_VkSamplerYcbcrConversionCreateInfo& copy_src);
     safe_VkSamplerYcbcrConversionCreateInfo& operator=(const safe_VkSamplerYcbcrConversionCreateInfo& copy_src);
+    safe_VkSamplerYcbcrConversionCreateInfo(safe_VkSamplerYcbcrConversionCreateInfo&& move_src) noexcept;
+    safe_VkSamplerYcbcrConversionCreateInfo& operator=(safe_VkSamplerYcbcrConversionCreateInfo&& move_src) noexcept;
     safe_VkSamplerYcbcrConversionCreateInfo();
     ~safe_VkSamplerYcbcrConversionCreateInfo();
     void initialize(const VkSamplerYcbcrConversionCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1894,6 +2090,8 @@ struct safe_VkSamplerYcbcrConversionInfo {
                                       bool copy_pnext = true);
     safe_VkSamplerYcbcrConversionInfo(const safe_VkSamplerYcbcrConversionInfo& copy_src);
     safe_VkSamplerYcbcrConversionInfo& operator=(const safe_VkSamplerYcbcrConversionInfo& copy_src);
+    safe_VkSamplerYcbcrConversionInfo(safe_VkSamplerYcbcrConversionInfo&& move_src) noexcept;
+    safe_VkSamplerYcbcrConversionInfo& operator=(safe_VkSamplerYcbcrConversionInfo&& move_src) noexcept;
     safe_VkSamplerYcbcrConversionInfo();
     ~safe_VkSamplerYcbcrConversionInfo();
     void initialize(const VkSamplerYcbcrConversionInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1910,6 +2108,8 @@ struct safe_VkBindImagePlaneMemoryInfo {
                                     bool copy_pnext = true);
     safe_VkBindImagePlaneMemoryInfo(const safe_VkBindImagePlaneMemoryInfo& copy_src);
     safe_VkBindImagePlaneMemoryInfo& operator=(const safe_VkBindImagePlaneMemoryInfo& copy_src);
+    safe_VkBindImagePlaneMemoryInfo(safe_VkBindImagePlaneMemoryInfo&& move_src) noexcept;
+    safe_VkBindImagePlaneMemoryInfo& operator=(safe_VkBindImagePlaneMemoryInfo&& move_src) noexcept;
     safe_VkBindImagePlaneMemoryInfo();
     ~safe_VkBindImagePlaneMemoryInfo();
     void initialize(const VkBindImagePlaneMemoryInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1926,6 +2126,8 @@ struct safe_VkImagePlaneMemoryRequirementsInfo {
                                             bool copy_pnext = true);
     safe_VkImagePlaneMemoryRequirementsInfo(const safe_VkImagePlaneMemoryRequirementsInfo& copy_src);
     safe_VkImagePlaneMemoryRequirementsInfo& operator=(const safe_VkImagePlaneMemoryRequirementsInfo& copy_src);
+    safe_VkImagePlaneMemoryRequirementsInfo(safe_VkImagePlaneMemoryRequirementsInfo&& move_src) noexcept;
+    safe_VkImagePlaneMemoryRequirementsInfo& operator=(safe_VkImagePlaneMemoryRequirementsInfo&& move_src) noexcept;
     safe_VkImagePlaneMemoryRequirementsInfo();
     ~safe_VkImagePlaneMemoryRequirementsInfo();
     void initialize(const VkImagePlaneMemoryRequirementsInfo* in_struct, PNextCopyState* copy_state = {});
@@ -1945,6 +2147,9 @@ struct safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures {
     safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures(const safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& copy_src);
     safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& operator=(
         const safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& copy_src);
+    safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures(safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& operator=(
+        safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures();
     ~safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures();
     void initialize(const VkPhysicalDeviceSamplerYcbcrConversionFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -1966,6 +2171,9 @@ struct safe_VkSamplerYcbcrConversionImageFormatProperties {
     safe_VkSamplerYcbcrConversionImageFormatProperties(const safe_VkSamplerYcbcrConversionImageFormatProperties& copy_src);
     safe_VkSamplerYcbcrConversionImageFormatProperties& operator=(
         const safe_VkSamplerYcbcrConversionImageFormatProperties& copy_src);
+    safe_VkSamplerYcbcrConversionImageFormatProperties(safe_VkSamplerYcbcrConversionImageFormatProperties&& move_src) noexcept;
+    safe_VkSamplerYcbcrConversionImageFormatProperties& operator=(
+        safe_VkSamplerYcbcrConversionImageFormatProperties&& move_src) noexcept;
     safe_VkSamplerYcbcrConversionImageFormatProperties();
     ~safe_VkSamplerYcbcrConversionImageFormatProperties();
     void initialize(const VkSamplerYcbcrConversionImageFormatProperties* in_struct, PNextCopyState* copy_state = {});
@@ -1993,6 +2201,8 @@ struct safe_VkDescriptorUpdateTemplateCreateInfo {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDescriptorUpdateTemplateCreateInfo(const safe_VkDescriptorUpdateTemplateCreateInfo& copy_src);
     safe_VkDescriptorUpdateTemplateCreateInfo& operator=(const safe_VkDescriptorUpdateTemplateCreateInfo& copy_src);
+    safe_VkDescriptorUpdateTemplateCreateInfo(safe_VkDescriptorUpdateTemplateCreateInfo&& move_src) noexcept;
+    safe_VkDescriptorUpdateTemplateCreateInfo& operator=(safe_VkDescriptorUpdateTemplateCreateInfo&& move_src) noexcept;
     safe_VkDescriptorUpdateTemplateCreateInfo();
     ~safe_VkDescriptorUpdateTemplateCreateInfo();
     void initialize(const VkDescriptorUpdateTemplateCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2011,6 +2221,8 @@ struct safe_VkPhysicalDeviceExternalImageFormatInfo {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceExternalImageFormatInfo(const safe_VkPhysicalDeviceExternalImageFormatInfo& copy_src);
     safe_VkPhysicalDeviceExternalImageFormatInfo& operator=(const safe_VkPhysicalDeviceExternalImageFormatInfo& copy_src);
+    safe_VkPhysicalDeviceExternalImageFormatInfo(safe_VkPhysicalDeviceExternalImageFormatInfo&& move_src) noexcept;
+    safe_VkPhysicalDeviceExternalImageFormatInfo& operator=(safe_VkPhysicalDeviceExternalImageFormatInfo&& move_src) noexcept;
     safe_VkPhysicalDeviceExternalImageFormatInfo();
     ~safe_VkPhysicalDeviceExternalImageFormatInfo();
     void initialize(const VkPhysicalDeviceExternalImageFormatInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2029,6 +2241,8 @@ struct safe_VkExternalImageFormatProperties {
                                          bool copy_pnext = true);
     safe_VkExternalImageFormatProperties(const safe_VkExternalImageFormatProperties& copy_src);
     safe_VkExternalImageFormatProperties& operator=(const safe_VkExternalImageFormatProperties& copy_src);
+    safe_VkExternalImageFormatProperties(safe_VkExternalImageFormatProperties&& move_src) noexcept;
+    safe_VkExternalImageFormatProperties& operator=(safe_VkExternalImageFormatProperties&& move_src) noexcept;
     safe_VkExternalImageFormatProperties();
     ~safe_VkExternalImageFormatProperties();
     void initialize(const VkExternalImageFormatProperties* in_struct, PNextCopyState* copy_state = {});
@@ -2047,6 +2261,8 @@ struct safe_VkPhysicalDeviceExternalBufferInfo {
                                             bool copy_pnext = true);
     safe_VkPhysicalDeviceExternalBufferInfo(const safe_VkPhysicalDeviceExternalBufferInfo& copy_src);
     safe_VkPhysicalDeviceExternalBufferInfo& operator=(const safe_VkPhysicalDeviceExternalBufferInfo& copy_src);
+    safe_VkPhysicalDeviceExternalBufferInfo(safe_VkPhysicalDeviceExternalBufferInfo&& move_src) noexcept;
+    safe_VkPhysicalDeviceExternalBufferInfo& operator=(safe_VkPhysicalDeviceExternalBufferInfo&& move_src) noexcept;
     safe_VkPhysicalDeviceExternalBufferInfo();
     ~safe_VkPhysicalDeviceExternalBufferInfo();
     void initialize(const VkPhysicalDeviceExternalBufferInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2065,6 +2281,8 @@ struct safe_VkExternalBufferProperties {
                                     bool copy_pnext = true);
     safe_VkExternalBufferProperties(const safe_VkExternalBufferProperties& copy_src);
     safe_VkExternalBufferProperties& operator=(const safe_VkExternalBufferProperties& copy_src);
+    safe_VkExternalBufferProperties(safe_VkExternalBufferProperties&& move_src) noexcept;
+    safe_VkExternalBufferProperties& operator=(safe_VkExternalBufferProperties&& move_src) noexcept;
     safe_VkExternalBufferProperties();
     ~safe_VkExternalBufferProperties();
     void initialize(const VkExternalBufferProperties* in_struct, PNextCopyState* copy_state = {});
@@ -2085,6 +2303,8 @@ struct safe_VkPhysicalDeviceIDProperties {
                                       bool copy_pnext = true);
     safe_VkPhysicalDeviceIDProperties(const safe_VkPhysicalDeviceIDProperties& copy_src);
     safe_VkPhysicalDeviceIDProperties& operator=(const safe_VkPhysicalDeviceIDProperties& copy_src);
+    safe_VkPhysicalDeviceIDProperties(safe_VkPhysicalDeviceIDProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceIDProperties& operator=(safe_VkPhysicalDeviceIDProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceIDProperties();
     ~safe_VkPhysicalDeviceIDProperties();
     void initialize(const VkPhysicalDeviceIDProperties* in_struct, PNextCopyState* copy_state = {});
@@ -2101,6 +2321,8 @@ struct safe_VkExternalMemoryImageCreateInfo {
                                          bool copy_pnext = true);
     safe_VkExternalMemoryImageCreateInfo(const safe_VkExternalMemoryImageCreateInfo& copy_src);
     safe_VkExternalMemoryImageCreateInfo& operator=(const safe_VkExternalMemoryImageCreateInfo& copy_src);
+    safe_VkExternalMemoryImageCreateInfo(safe_VkExternalMemoryImageCreateInfo&& move_src) noexcept;
+    safe_VkExternalMemoryImageCreateInfo& operator=(safe_VkExternalMemoryImageCreateInfo&& move_src) noexcept;
     safe_VkExternalMemoryImageCreateInfo();
     ~safe_VkExternalMemoryImageCreateInfo();
     void initialize(const VkExternalMemoryImageCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2117,6 +2339,8 @@ struct safe_VkExternalMemoryBufferCreateInfo {
                                           bool copy_pnext = true);
     safe_VkExternalMemoryBufferCreateInfo(const safe_VkExternalMemoryBufferCreateInfo& copy_src);
     safe_VkExternalMemoryBufferCreateInfo& operator=(const safe_VkExternalMemoryBufferCreateInfo& copy_src);
+    safe_VkExternalMemoryBufferCreateInfo(safe_VkExternalMemoryBufferCreateInfo&& move_src) noexcept;
+    safe_VkExternalMemoryBufferCreateInfo& operator=(safe_VkExternalMemoryBufferCreateInfo&& move_src) noexcept;
     safe_VkExternalMemoryBufferCreateInfo();
     ~safe_VkExternalMemoryBufferCreateInfo();
     void initialize(const VkExternalMemoryBufferCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2133,6 +2357,8 @@ struct safe_VkExportMemoryAllocateInfo {
                                     bool copy_pnext = true);
     safe_VkExportMemoryAllocateInfo(const safe_VkExportMemoryAllocateInfo& copy_src);
     safe_VkExportMemoryAllocateInfo& operator=(const safe_VkExportMemoryAllocateInfo& copy_src);
+    safe_VkExportMemoryAllocateInfo(safe_VkExportMemoryAllocateInfo&& move_src) noexcept;
+    safe_VkExportMemoryAllocateInfo& operator=(safe_VkExportMemoryAllocateInfo&& move_src) noexcept;
     safe_VkExportMemoryAllocateInfo();
     ~safe_VkExportMemoryAllocateInfo();
     void initialize(const VkExportMemoryAllocateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2149,6 +2375,8 @@ struct safe_VkPhysicalDeviceExternalFenceInfo {
                                            bool copy_pnext = true);
     safe_VkPhysicalDeviceExternalFenceInfo(const safe_VkPhysicalDeviceExternalFenceInfo& copy_src);
     safe_VkPhysicalDeviceExternalFenceInfo& operator=(const safe_VkPhysicalDeviceExternalFenceInfo& copy_src);
+    safe_VkPhysicalDeviceExternalFenceInfo(safe_VkPhysicalDeviceExternalFenceInfo&& move_src) noexcept;
+    safe_VkPhysicalDeviceExternalFenceInfo& operator=(safe_VkPhysicalDeviceExternalFenceInfo&& move_src) noexcept;
     safe_VkPhysicalDeviceExternalFenceInfo();
     ~safe_VkPhysicalDeviceExternalFenceInfo();
     void initialize(const VkPhysicalDeviceExternalFenceInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2169,6 +2397,8 @@ struct safe_VkExternalFenceProperties {
                                    bool copy_pnext = true);
     safe_VkExternalFenceProperties(const safe_VkExternalFenceProperties& copy_src);
     safe_VkExternalFenceProperties& operator=(const safe_VkExternalFenceProperties& copy_src);
+    safe_VkExternalFenceProperties(safe_VkExternalFenceProperties&& move_src) noexcept;
+    safe_VkExternalFenceProperties& operator=(safe_VkExternalFenceProperties&& move_src) noexcept;
     safe_VkExternalFenceProperties();
     ~safe_VkExternalFenceProperties();
     void initialize(const VkExternalFenceProperties* in_struct, PNextCopyState* copy_state = {});
@@ -2184,6 +2414,8 @@ struct safe_VkExportFenceCreateInfo {
     safe_VkExportFenceCreateInfo(const VkExportFenceCreateInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkExportFenceCreateInfo(const safe_VkExportFenceCreateInfo& copy_src);
     safe_VkExportFenceCreateInfo& operator=(const safe_VkExportFenceCreateInfo& copy_src);
+    safe_VkExportFenceCreateInfo(safe_VkExportFenceCreateInfo&& move_src) noexcept;
+    safe_VkExportFenceCreateInfo& operator=(safe_VkExportFenceCreateInfo&& move_src) noexcept;
     safe_VkExportFenceCreateInfo();
     ~safe_VkExportFenceCreateInfo();
     void initialize(const VkExportFenceCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2200,6 +2432,8 @@ struct safe_VkExportSemaphoreCreateInfo {
                                      bool copy_pnext = true);
     safe_VkExportSemaphoreCreateInfo(const safe_VkExportSemaphoreCreateInfo& copy_src);
     safe_VkExportSemaphoreCreateInfo& operator=(const safe_VkExportSemaphoreCreateInfo& copy_src);
+    safe_VkExportSemaphoreCreateInfo(safe_VkExportSemaphoreCreateInfo&& move_src) noexcept;
+    safe_VkExportSemaphoreCreateInfo& operator=(safe_VkExportSemaphoreCreateInfo&& move_src) noexcept;
     safe_VkExportSemaphoreCreateInfo();
     ~safe_VkExportSemaphoreCreateInfo();
     void initialize(const VkExportSemaphoreCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2216,6 +2450,8 @@ struct safe_VkPhysicalDeviceExternalSemaphoreInfo {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceExternalSemaphoreInfo(const safe_VkPhysicalDeviceExternalSemaphoreInfo& copy_src);
     safe_VkPhysicalDeviceExternalSemaphoreInfo& operator=(const safe_VkPhysicalDeviceExternalSemaphoreInfo& copy_src);
+    safe_VkPhysicalDeviceExternalSemaphoreInfo(safe_VkPhysicalDeviceExternalSemaphoreInfo&& move_src) noexcept;
+    safe_VkPhysicalDeviceExternalSemaphoreInfo& operator=(safe_VkPhysicalDeviceExternalSemaphoreInfo&& move_src) noexcept;
     safe_VkPhysicalDeviceExternalSemaphoreInfo();
     ~safe_VkPhysicalDeviceExternalSemaphoreInfo();
     void initialize(const VkPhysicalDeviceExternalSemaphoreInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2236,6 +2472,8 @@ struct safe_VkExternalSemaphoreProperties {
                                        bool copy_pnext = true);
     safe_VkExternalSemaphoreProperties(const safe_VkExternalSemaphoreProperties& copy_src);
     safe_VkExternalSemaphoreProperties& operator=(const safe_VkExternalSemaphoreProperties& copy_src);
+    safe_VkExternalSemaphoreProperties(safe_VkExternalSemaphoreProperties&& move_src) noexcept;
+    safe_VkExternalSemaphoreProperties& operator=(safe_VkExternalSemaphoreProperties&& move_src) noexcept;
     safe_VkExternalSemaphoreProperties();
     ~safe_VkExternalSemaphoreProperties();
     void initialize(const VkExternalSemaphoreProperties* in_struct, PNextCopyState* copy_state = {});
@@ -2253,6 +2491,8 @@ struct safe_VkPhysicalDeviceMaintenance3Properties {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMaintenance3Properties(const safe_VkPhysicalDeviceMaintenance3Properties& copy_src);
     safe_VkPhysicalDeviceMaintenance3Properties& operator=(const safe_VkPhysicalDeviceMaintenance3Properties& copy_src);
+    safe_VkPhysicalDeviceMaintenance3Properties(safe_VkPhysicalDeviceMaintenance3Properties&& move_src) noexcept;
+    safe_VkPhysicalDeviceMaintenance3Properties& operator=(safe_VkPhysicalDeviceMaintenance3Properties&& move_src) noexcept;
     safe_VkPhysicalDeviceMaintenance3Properties();
     ~safe_VkPhysicalDeviceMaintenance3Properties();
     void initialize(const VkPhysicalDeviceMaintenance3Properties* in_struct, PNextCopyState* copy_state = {});
@@ -2271,6 +2511,8 @@ struct safe_VkDescriptorSetLayoutSupport {
                                       bool copy_pnext = true);
     safe_VkDescriptorSetLayoutSupport(const safe_VkDescriptorSetLayoutSupport& copy_src);
     safe_VkDescriptorSetLayoutSupport& operator=(const safe_VkDescriptorSetLayoutSupport& copy_src);
+    safe_VkDescriptorSetLayoutSupport(safe_VkDescriptorSetLayoutSupport&& move_src) noexcept;
+    safe_VkDescriptorSetLayoutSupport& operator=(safe_VkDescriptorSetLayoutSupport&& move_src) noexcept;
     safe_VkDescriptorSetLayoutSupport();
     ~safe_VkDescriptorSetLayoutSupport();
     void initialize(const VkDescriptorSetLayoutSupport* in_struct, PNextCopyState* copy_state = {});
@@ -2287,6 +2529,9 @@ struct safe_VkPhysicalDeviceShaderDrawParametersFeatures {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderDrawParametersFeatures(const safe_VkPhysicalDeviceShaderDrawParametersFeatures& copy_src);
     safe_VkPhysicalDeviceShaderDrawParametersFeatures& operator=(const safe_VkPhysicalDeviceShaderDrawParametersFeatures& copy_src);
+    safe_VkPhysicalDeviceShaderDrawParametersFeatures(safe_VkPhysicalDeviceShaderDrawParametersFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderDrawParametersFeatures& operator=(
+        safe_VkPhysicalDeviceShaderDrawParametersFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderDrawParametersFeatures();
     ~safe_VkPhysicalDeviceShaderDrawParametersFeatures();
     void initialize(const VkPhysicalDeviceShaderDrawParametersFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -2318,6 +2563,8 @@ struct safe_VkPhysicalDeviceVulkan11Features {
                                           bool copy_pnext = true);
     safe_VkPhysicalDeviceVulkan11Features(const safe_VkPhysicalDeviceVulkan11Features& copy_src);
     safe_VkPhysicalDeviceVulkan11Features& operator=(const safe_VkPhysicalDeviceVulkan11Features& copy_src);
+    safe_VkPhysicalDeviceVulkan11Features(safe_VkPhysicalDeviceVulkan11Features&& move_src) noexcept;
+    safe_VkPhysicalDeviceVulkan11Features& operator=(safe_VkPhysicalDeviceVulkan11Features&& move_src) noexcept;
     safe_VkPhysicalDeviceVulkan11Features();
     ~safe_VkPhysicalDeviceVulkan11Features();
     void initialize(const VkPhysicalDeviceVulkan11Features* in_struct, PNextCopyState* copy_state = {});
@@ -2348,6 +2595,8 @@ struct safe_VkPhysicalDeviceVulkan11Properties {
                                             bool copy_pnext = true);
     safe_VkPhysicalDeviceVulkan11Properties(const safe_VkPhysicalDeviceVulkan11Properties& copy_src);
     safe_VkPhysicalDeviceVulkan11Properties& operator=(const safe_VkPhysicalDeviceVulkan11Properties& copy_src);
+    safe_VkPhysicalDeviceVulkan11Properties(safe_VkPhysicalDeviceVulkan11Properties&& move_src) noexcept;
+    safe_VkPhysicalDeviceVulkan11Properties& operator=(safe_VkPhysicalDeviceVulkan11Properties&& move_src) noexcept;
     safe_VkPhysicalDeviceVulkan11Properties();
     ~safe_VkPhysicalDeviceVulkan11Properties();
     void initialize(const VkPhysicalDeviceVulkan11Properties* in_struct, PNextCopyState* copy_state = {});
@@ -2412,6 +2661,8 @@ struct safe_VkPhysicalDeviceVulkan12Features {
                                           bool copy_pnext = true);
     safe_VkPhysicalDeviceVulkan12Features(const safe_VkPhysicalDeviceVulkan12Features& copy_src);
     safe_VkPhysicalDeviceVulkan12Features& operator=(const safe_VkPhysicalDeviceVulkan12Features& copy_src);
+    safe_VkPhysicalDeviceVulkan12Features(safe_VkPhysicalDeviceVulkan12Features&& move_src) noexcept;
+    safe_VkPhysicalDeviceVulkan12Features& operator=(safe_VkPhysicalDeviceVulkan12Features&& move_src) noexcept;
     safe_VkPhysicalDeviceVulkan12Features();
     ~safe_VkPhysicalDeviceVulkan12Features();
     void initialize(const VkPhysicalDeviceVulkan12Features* in_struct, PNextCopyState* copy_state = {});
@@ -2479,6 +2730,8 @@ struct safe_VkPhysicalDeviceVulkan12Properties {
                                             bool copy_pnext = true);
     safe_VkPhysicalDeviceVulkan12Properties(const safe_VkPhysicalDeviceVulkan12Properties& copy_src);
     safe_VkPhysicalDeviceVulkan12Properties& operator=(const safe_VkPhysicalDeviceVulkan12Properties& copy_src);
+    safe_VkPhysicalDeviceVulkan12Properties(safe_VkPhysicalDeviceVulkan12Properties&& move_src) noexcept;
+    safe_VkPhysicalDeviceVulkan12Properties& operator=(safe_VkPhysicalDeviceVulkan12Properties&& move_src) noexcept;
     safe_VkPhysicalDeviceVulkan12Properties();
     ~safe_VkPhysicalDeviceVulkan12Properties();
     void initialize(const VkPhysicalDeviceVulkan12Properties* in_struct, PNextCopyState* copy_state = {});
@@ -2498,6 +2751,8 @@ struct safe_VkImageFormatListCreateInfo {
                                      bool copy_pnext = true);
     safe_VkImageFormatListCreateInfo(const safe_VkImageFormatListCreateInfo& copy_src);
     safe_VkImageFormatListCreateInfo& operator=(const safe_VkImageFormatListCreateInfo& copy_src);
+    safe_VkImageFormatListCreateInfo(safe_VkImageFormatListCreateInfo&& move_src) noexcept;
+    safe_VkImageFormatListCreateInfo& operator=(safe_VkImageFormatListCreateInfo&& move_src) noexcept;
     safe_VkImageFormatListCreateInfo();
     ~safe_VkImageFormatListCreateInfo();
     void initialize(const VkImageFormatListCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2522,6 +2777,8 @@ struct safe_VkAttachmentDescription2 {
                                   bool copy_pnext = true);
     safe_VkAttachmentDescription2(const safe_VkAttachmentDescription2& copy_src);
     safe_VkAttachmentDescription2& operator=(const safe_VkAttachmentDescription2& copy_src);
+    safe_VkAttachmentDescription2(safe_VkAttachmentDescription2&& move_src) noexcept;
+    safe_VkAttachmentDescription2& operator=(safe_VkAttachmentDescription2&& move_src) noexcept;
     safe_VkAttachmentDescription2();
     ~safe_VkAttachmentDescription2();
     void initialize(const VkAttachmentDescription2* in_struct, PNextCopyState* copy_state = {});
@@ -2539,6 +2796,8 @@ struct safe_VkAttachmentReference2 {
     safe_VkAttachmentReference2(const VkAttachmentReference2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkAttachmentReference2(const safe_VkAttachmentReference2& copy_src);
     safe_VkAttachmentReference2& operator=(const safe_VkAttachmentReference2& copy_src);
+    safe_VkAttachmentReference2(safe_VkAttachmentReference2&& move_src) noexcept;
+    safe_VkAttachmentReference2& operator=(safe_VkAttachmentReference2&& move_src) noexcept;
     safe_VkAttachmentReference2();
     ~safe_VkAttachmentReference2();
     void initialize(const VkAttachmentReference2* in_struct, PNextCopyState* copy_state = {});
@@ -2564,6 +2823,8 @@ struct safe_VkSubpassDescription2 {
     safe_VkSubpassDescription2(const VkSubpassDescription2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSubpassDescription2(const safe_VkSubpassDescription2& copy_src);
     safe_VkSubpassDescription2& operator=(const safe_VkSubpassDescription2& copy_src);
+    safe_VkSubpassDescription2(safe_VkSubpassDescription2&& move_src) noexcept;
+    safe_VkSubpassDescription2& operator=(safe_VkSubpassDescription2&& move_src) noexcept;
     safe_VkSubpassDescription2();
     ~safe_VkSubpassDescription2();
     void initialize(const VkSubpassDescription2* in_struct, PNextCopyState* copy_state = {});
@@ -2586,6 +2847,8 @@ struct safe_VkSubpassDependency2 {
     safe_VkSubpassDependency2(const VkSubpassDependency2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSubpassDependency2(const safe_VkSubpassDependency2& copy_src);
     safe_VkSubpassDependency2& operator=(const safe_VkSubpassDependency2& copy_src);
+    safe_VkSubpassDependency2(safe_VkSubpassDependency2&& move_src) noexcept;
+    safe_VkSubpassDependency2& operator=(safe_VkSubpassDependency2&& move_src) noexcept;
     safe_VkSubpassDependency2();
     ~safe_VkSubpassDependency2();
     void initialize(const VkSubpassDependency2* in_struct, PNextCopyState* copy_state = {});
@@ -2609,6 +2872,8 @@ struct safe_VkRenderPassCreateInfo2 {
     safe_VkRenderPassCreateInfo2(const VkRenderPassCreateInfo2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRenderPassCreateInfo2(const safe_VkRenderPassCreateInfo2& copy_src);
     safe_VkRenderPassCreateInfo2& operator=(const safe_VkRenderPassCreateInfo2& copy_src);
+    safe_VkRenderPassCreateInfo2(safe_VkRenderPassCreateInfo2&& move_src) noexcept;
+    safe_VkRenderPassCreateInfo2& operator=(safe_VkRenderPassCreateInfo2&& move_src) noexcept;
     safe_VkRenderPassCreateInfo2();
     ~safe_VkRenderPassCreateInfo2();
     void initialize(const VkRenderPassCreateInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -2624,6 +2889,8 @@ struct safe_VkSubpassBeginInfo {
     safe_VkSubpassBeginInfo(const VkSubpassBeginInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSubpassBeginInfo(const safe_VkSubpassBeginInfo& copy_src);
     safe_VkSubpassBeginInfo& operator=(const safe_VkSubpassBeginInfo& copy_src);
+    safe_VkSubpassBeginInfo(safe_VkSubpassBeginInfo&& move_src) noexcept;
+    safe_VkSubpassBeginInfo& operator=(safe_VkSubpassBeginInfo&& move_src) noexcept;
     safe_VkSubpassBeginInfo();
     ~safe_VkSubpassBeginInfo();
     void initialize(const VkSubpassBeginInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2638,6 +2905,8 @@ struct safe_VkSubpassEndInfo {
     safe_VkSubpassEndInfo(const VkSubpassEndInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSubpassEndInfo(const safe_VkSubpassEndInfo& copy_src);
     safe_VkSubpassEndInfo& operator=(const safe_VkSubpassEndInfo& copy_src);
+    safe_VkSubpassEndInfo(safe_VkSubpassEndInfo&& move_src) noexcept;
+    safe_VkSubpassEndInfo& operator=(safe_VkSubpassEndInfo&& move_src) noexcept;
     safe_VkSubpassEndInfo();
     ~safe_VkSubpassEndInfo();
     void initialize(const VkSubpassEndInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2656,6 +2925,8 @@ struct safe_VkPhysicalDevice8BitStorageFeatures {
                                              bool copy_pnext = true);
     safe_VkPhysicalDevice8BitStorageFeatures(const safe_VkPhysicalDevice8BitStorageFeatures& copy_src);
     safe_VkPhysicalDevice8BitStorageFeatures& operator=(const safe_VkPhysicalDevice8BitStorageFeatures& copy_src);
+    safe_VkPhysicalDevice8BitStorageFeatures(safe_VkPhysicalDevice8BitStorageFeatures&& move_src) noexcept;
+    safe_VkPhysicalDevice8BitStorageFeatures& operator=(safe_VkPhysicalDevice8BitStorageFeatures&& move_src) noexcept;
     safe_VkPhysicalDevice8BitStorageFeatures();
     ~safe_VkPhysicalDevice8BitStorageFeatures();
     void initialize(const VkPhysicalDevice8BitStorageFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -2677,6 +2948,8 @@ struct safe_VkPhysicalDeviceDriverProperties {
                                           bool copy_pnext = true);
     safe_VkPhysicalDeviceDriverProperties(const safe_VkPhysicalDeviceDriverProperties& copy_src);
     safe_VkPhysicalDeviceDriverProperties& operator=(const safe_VkPhysicalDeviceDriverProperties& copy_src);
+    safe_VkPhysicalDeviceDriverProperties(safe_VkPhysicalDeviceDriverProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceDriverProperties& operator=(safe_VkPhysicalDeviceDriverProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceDriverProperties();
     ~safe_VkPhysicalDeviceDriverProperties();
     void initialize(const VkPhysicalDeviceDriverProperties* in_struct, PNextCopyState* copy_state = {});
@@ -2694,6 +2967,8 @@ struct safe_VkPhysicalDeviceShaderAtomicInt64Features {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderAtomicInt64Features(const safe_VkPhysicalDeviceShaderAtomicInt64Features& copy_src);
     safe_VkPhysicalDeviceShaderAtomicInt64Features& operator=(const safe_VkPhysicalDeviceShaderAtomicInt64Features& copy_src);
+    safe_VkPhysicalDeviceShaderAtomicInt64Features(safe_VkPhysicalDeviceShaderAtomicInt64Features&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderAtomicInt64Features& operator=(safe_VkPhysicalDeviceShaderAtomicInt64Features&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderAtomicInt64Features();
     ~safe_VkPhysicalDeviceShaderAtomicInt64Features();
     void initialize(const VkPhysicalDeviceShaderAtomicInt64Features* in_struct, PNextCopyState* copy_state = {});
@@ -2713,6 +2988,8 @@ struct safe_VkPhysicalDeviceShaderFloat16Int8Features {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderFloat16Int8Features(const safe_VkPhysicalDeviceShaderFloat16Int8Features& copy_src);
     safe_VkPhysicalDeviceShaderFloat16Int8Features& operator=(const safe_VkPhysicalDeviceShaderFloat16Int8Features& copy_src);
+    safe_VkPhysicalDeviceShaderFloat16Int8Features(safe_VkPhysicalDeviceShaderFloat16Int8Features&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderFloat16Int8Features& operator=(safe_VkPhysicalDeviceShaderFloat16Int8Features&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderFloat16Int8Features();
     ~safe_VkPhysicalDeviceShaderFloat16Int8Features();
     void initialize(const VkPhysicalDeviceShaderFloat16Int8Features* in_struct, PNextCopyState* copy_state = {});
@@ -2747,6 +3024,8 @@ struct safe_VkPhysicalDeviceFloatControlsProperties {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceFloatControlsProperties(const safe_VkPhysicalDeviceFloatControlsProperties& copy_src);
     safe_VkPhysicalDeviceFloatControlsProperties& operator=(const safe_VkPhysicalDeviceFloatControlsProperties& copy_src);
+    safe_VkPhysicalDeviceFloatControlsProperties(safe_VkPhysicalDeviceFloatControlsProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceFloatControlsProperties& operator=(safe_VkPhysicalDeviceFloatControlsProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceFloatControlsProperties();
     ~safe_VkPhysicalDeviceFloatControlsProperties();
     void initialize(const VkPhysicalDeviceFloatControlsProperties* in_struct, PNextCopyState* copy_state = {});
@@ -2766,6 +3045,9 @@ struct safe_VkDescriptorSetLayoutBindingFlagsCreateInfo {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDescriptorSetLayoutBindingFlagsCreateInfo(const safe_VkDescriptorSetLayoutBindingFlagsCreateInfo& copy_src);
     safe_VkDescriptorSetLayoutBindingFlagsCreateInfo& operator=(const safe_VkDescriptorSetLayoutBindingFlagsCreateInfo& copy_src);
+    safe_VkDescriptorSetLayoutBindingFlagsCreateInfo(safe_VkDescriptorSetLayoutBindingFlagsCreateInfo&& move_src) noexcept;
+    safe_VkDescriptorSetLayoutBindingFlagsCreateInfo& operator=(
+        safe_VkDescriptorSetLayoutBindingFlagsCreateInfo&& move_src) noexcept;
     safe_VkDescriptorSetLayoutBindingFlagsCreateInfo();
     ~safe_VkDescriptorSetLayoutBindingFlagsCreateInfo();
     void initialize(const VkDescriptorSetLayoutBindingFlagsCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2805,6 +3087,8 @@ struct safe_VkPhysicalDeviceDescriptorIndexingFeatures {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceDescriptorIndexingFeatures(const safe_VkPhysicalDeviceDescriptorIndexingFeatures& copy_src);
     safe_VkPhysicalDeviceDescriptorIndexingFeatures& operator=(const safe_VkPhysicalDeviceDescriptorIndexingFeatures& copy_src);
+    safe_VkPhysicalDeviceDescriptorIndexingFeatures(safe_VkPhysicalDeviceDescriptorIndexingFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceDescriptorIndexingFeatures& operator=(safe_VkPhysicalDeviceDescriptorIndexingFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceDescriptorIndexingFeatures();
     ~safe_VkPhysicalDeviceDescriptorIndexingFeatures();
     void initialize(const VkPhysicalDeviceDescriptorIndexingFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -2847,6 +3131,9 @@ struct safe_VkPhysicalDeviceDescriptorIndexingProperties {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceDescriptorIndexingProperties(const safe_VkPhysicalDeviceDescriptorIndexingProperties& copy_src);
     safe_VkPhysicalDeviceDescriptorIndexingProperties& operator=(const safe_VkPhysicalDeviceDescriptorIndexingProperties& copy_src);
+    safe_VkPhysicalDeviceDescriptorIndexingProperties(safe_VkPhysicalDeviceDescriptorIndexingProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceDescriptorIndexingProperties& operator=(
+        safe_VkPhysicalDeviceDescriptorIndexingProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceDescriptorIndexingProperties();
     ~safe_VkPhysicalDeviceDescriptorIndexingProperties();
     void initialize(const VkPhysicalDeviceDescriptorIndexingProperties* in_struct, PNextCopyState* copy_state = {});
@@ -2870,6 +3157,10 @@ struct safe_VkDescriptorSetVariableDescriptorCountAllocateInfo {
         const safe_VkDescriptorSetVariableDescriptorCountAllocateInfo& copy_src);
     safe_VkDescriptorSetVariableDescriptorCountAllocateInfo& operator=(
         const safe_VkDescriptorSetVariableDescriptorCountAllocateInfo& copy_src);
+    safe_VkDescriptorSetVariableDescriptorCountAllocateInfo(
+        safe_VkDescriptorSetVariableDescriptorCountAllocateInfo&& move_src) noexcept;
+    safe_VkDescriptorSetVariableDescriptorCountAllocateInfo& operator=(
+        safe_VkDescriptorSetVariableDescriptorCountAllocateInfo&& move_src) noexcept;
     safe_VkDescriptorSetVariableDescriptorCountAllocateInfo();
     ~safe_VkDescriptorSetVariableDescriptorCountAllocateInfo();
     void initialize(const VkDescriptorSetVariableDescriptorCountAllocateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2892,6 +3183,10 @@ struct safe_VkDescriptorSetVariableDescriptorCountLayoutSupport {
         const safe_VkDescriptorSetVariableDescriptorCountLayoutSupport& copy_src);
     safe_VkDescriptorSetVariableDescriptorCountLayoutSupport& operator=(
         const safe_VkDescriptorSetVariableDescriptorCountLayoutSupport& copy_src);
+    safe_VkDescriptorSetVariableDescriptorCountLayoutSupport(
+        safe_VkDescriptorSetVariableDescriptorCountLayoutSupport&& move_src) noexcept;
+    safe_VkDescriptorSetVariableDescriptorCountLayoutSupport& operator=(
+        safe_VkDescriptorSetVariableDescriptorCountLayoutSupport&& move_src) noexcept;
     safe_VkDescriptorSetVariableDescriptorCountLayoutSupport();
     ~safe_VkDescriptorSetVariableDescriptorCountLayoutSupport();
     void initialize(const VkDescriptorSetVariableDescriptorCountLayoutSupport* in_struct, PNextCopyState* copy_state = {});
@@ -2914,6 +3209,8 @@ struct safe_VkSubpassDescriptionDepthStencilResolve {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSubpassDescriptionDepthStencilResolve(const safe_VkSubpassDescriptionDepthStencilResolve& copy_src);
     safe_VkSubpassDescriptionDepthStencilResolve& operator=(const safe_VkSubpassDescriptionDepthStencilResolve& copy_src);
+    safe_VkSubpassDescriptionDepthStencilResolve(safe_VkSubpassDescriptionDepthStencilResolve&& move_src) noexcept;
+    safe_VkSubpassDescriptionDepthStencilResolve& operator=(safe_VkSubpassDescriptionDepthStencilResolve&& move_src) noexcept;
     safe_VkSubpassDescriptionDepthStencilResolve();
     ~safe_VkSubpassDescriptionDepthStencilResolve();
     void initialize(const VkSubpassDescriptionDepthStencilResolve* in_struct, PNextCopyState* copy_state = {});
@@ -2936,6 +3233,9 @@ struct safe_VkPhysicalDeviceDepthStencilResolveProperties {
     safe_VkPhysicalDeviceDepthStencilResolveProperties(const safe_VkPhysicalDeviceDepthStencilResolveProperties& copy_src);
     safe_VkPhysicalDeviceDepthStencilResolveProperties& operator=(
         const safe_VkPhysicalDeviceDepthStencilResolveProperties& copy_src);
+    safe_VkPhysicalDeviceDepthStencilResolveProperties(safe_VkPhysicalDeviceDepthStencilResolveProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceDepthStencilResolveProperties& operator=(
+        safe_VkPhysicalDeviceDepthStencilResolveProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceDepthStencilResolveProperties();
     ~safe_VkPhysicalDeviceDepthStencilResolveProperties();
     void initialize(const VkPhysicalDeviceDepthStencilResolveProperties* in_struct, PNextCopyState* copy_state = {});
@@ -2956,6 +3256,8 @@ struct safe_VkPhysicalDeviceScalarBlockLayoutFeatures {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceScalarBlockLayoutFeatures(const safe_VkPhysicalDeviceScalarBlockLayoutFeatures& copy_src);
     safe_VkPhysicalDeviceScalarBlockLayoutFeatures& operator=(const safe_VkPhysicalDeviceScalarBlockLayoutFeatures& copy_src);
+    safe_VkPhysicalDeviceScalarBlockLayoutFeatures(safe_VkPhysicalDeviceScalarBlockLayoutFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceScalarBlockLayoutFeatures& operator=(safe_VkPhysicalDeviceScalarBlockLayoutFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceScalarBlockLayoutFeatures();
     ~safe_VkPhysicalDeviceScalarBlockLayoutFeatures();
     void initialize(const VkPhysicalDeviceScalarBlockLayoutFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -2974,6 +3276,8 @@ struct safe_VkImageStencilUsageCreateInfo {
                                        bool copy_pnext = true);
     safe_VkImageStencilUsageCreateInfo(const safe_VkImageStencilUsageCreateInfo& copy_src);
     safe_VkImageStencilUsageCreateInfo& operator=(const safe_VkImageStencilUsageCreateInfo& copy_src);
+    safe_VkImageStencilUsageCreateInfo(safe_VkImageStencilUsageCreateInfo&& move_src) noexcept;
+    safe_VkImageStencilUsageCreateInfo& operator=(safe_VkImageStencilUsageCreateInfo&& move_src) noexcept;
     safe_VkImageStencilUsageCreateInfo();
     ~safe_VkImageStencilUsageCreateInfo();
     void initialize(const VkImageStencilUsageCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -2990,6 +3294,8 @@ struct safe_VkSamplerReductionModeCreateInfo {
                                           bool copy_pnext = true);
     safe_VkSamplerReductionModeCreateInfo(const safe_VkSamplerReductionModeCreateInfo& copy_src);
     safe_VkSamplerReductionModeCreateInfo& operator=(const safe_VkSamplerReductionModeCreateInfo& copy_src);
+    safe_VkSamplerReductionModeCreateInfo(safe_VkSamplerReductionModeCreateInfo&& move_src) noexcept;
+    safe_VkSamplerReductionModeCreateInfo& operator=(safe_VkSamplerReductionModeCreateInfo&& move_src) noexcept;
     safe_VkSamplerReductionModeCreateInfo();
     ~safe_VkSamplerReductionModeCreateInfo();
     void initialize(const VkSamplerReductionModeCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3008,6 +3314,9 @@ struct safe_VkPhysicalDeviceSamplerFilterMinmaxProperties {
     safe_VkPhysicalDeviceSamplerFilterMinmaxProperties(const safe_VkPhysicalDeviceSamplerFilterMinmaxProperties& copy_src);
     safe_VkPhysicalDeviceSamplerFilterMinmaxProperties& operator=(
         const safe_VkPhysicalDeviceSamplerFilterMinmaxProperties& copy_src);
+    safe_VkPhysicalDeviceSamplerFilterMinmaxProperties(safe_VkPhysicalDeviceSamplerFilterMinmaxProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceSamplerFilterMinmaxProperties& operator=(
+        safe_VkPhysicalDeviceSamplerFilterMinmaxProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceSamplerFilterMinmaxProperties();
     ~safe_VkPhysicalDeviceSamplerFilterMinmaxProperties();
     void initialize(const VkPhysicalDeviceSamplerFilterMinmaxProperties* in_struct, PNextCopyState* copy_state = {});
@@ -3030,6 +3339,8 @@ struct safe_VkPhysicalDeviceVulkanMemoryModelFeatures {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceVulkanMemoryModelFeatures(const safe_VkPhysicalDeviceVulkanMemoryModelFeatures& copy_src);
     safe_VkPhysicalDeviceVulkanMemoryModelFeatures& operator=(const safe_VkPhysicalDeviceVulkanMemoryModelFeatures& copy_src);
+    safe_VkPhysicalDeviceVulkanMemoryModelFeatures(safe_VkPhysicalDeviceVulkanMemoryModelFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceVulkanMemoryModelFeatures& operator=(safe_VkPhysicalDeviceVulkanMemoryModelFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceVulkanMemoryModelFeatures();
     ~safe_VkPhysicalDeviceVulkanMemoryModelFeatures();
     void initialize(const VkPhysicalDeviceVulkanMemoryModelFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3048,6 +3359,9 @@ struct safe_VkPhysicalDeviceImagelessFramebufferFeatures {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceImagelessFramebufferFeatures(const safe_VkPhysicalDeviceImagelessFramebufferFeatures& copy_src);
     safe_VkPhysicalDeviceImagelessFramebufferFeatures& operator=(const safe_VkPhysicalDeviceImagelessFramebufferFeatures& copy_src);
+    safe_VkPhysicalDeviceImagelessFramebufferFeatures(safe_VkPhysicalDeviceImagelessFramebufferFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceImagelessFramebufferFeatures& operator=(
+        safe_VkPhysicalDeviceImagelessFramebufferFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceImagelessFramebufferFeatures();
     ~safe_VkPhysicalDeviceImagelessFramebufferFeatures();
     void initialize(const VkPhysicalDeviceImagelessFramebufferFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3074,6 +3388,8 @@ struct safe_VkFramebufferAttachmentImageInfo {
                                           bool copy_pnext = true);
     safe_VkFramebufferAttachmentImageInfo(const safe_VkFramebufferAttachmentImageInfo& copy_src);
     safe_VkFramebufferAttachmentImageInfo& operator=(const safe_VkFramebufferAttachmentImageInfo& copy_src);
+    safe_VkFramebufferAttachmentImageInfo(safe_VkFramebufferAttachmentImageInfo&& move_src) noexcept;
+    safe_VkFramebufferAttachmentImageInfo& operator=(safe_VkFramebufferAttachmentImageInfo&& move_src) noexcept;
     safe_VkFramebufferAttachmentImageInfo();
     ~safe_VkFramebufferAttachmentImageInfo();
     void initialize(const VkFramebufferAttachmentImageInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3091,6 +3407,8 @@ struct safe_VkFramebufferAttachmentsCreateInfo {
                                             bool copy_pnext = true);
     safe_VkFramebufferAttachmentsCreateInfo(const safe_VkFramebufferAttachmentsCreateInfo& copy_src);
     safe_VkFramebufferAttachmentsCreateInfo& operator=(const safe_VkFramebufferAttachmentsCreateInfo& copy_src);
+    safe_VkFramebufferAttachmentsCreateInfo(safe_VkFramebufferAttachmentsCreateInfo&& move_src) noexcept;
+    safe_VkFramebufferAttachmentsCreateInfo& operator=(safe_VkFramebufferAttachmentsCreateInfo&& move_src) noexcept;
     safe_VkFramebufferAttachmentsCreateInfo();
     ~safe_VkFramebufferAttachmentsCreateInfo();
     void initialize(const VkFramebufferAttachmentsCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3110,6 +3428,8 @@ struct safe_VkRenderPassAttachmentBeginInfo {
                                          bool copy_pnext = true);
     safe_VkRenderPassAttachmentBeginInfo(const safe_VkRenderPassAttachmentBeginInfo& copy_src);
     safe_VkRenderPassAttachmentBeginInfo& operator=(const safe_VkRenderPassAttachmentBeginInfo& copy_src);
+    safe_VkRenderPassAttachmentBeginInfo(safe_VkRenderPassAttachmentBeginInfo&& move_src) noexcept;
+    safe_VkRenderPassAttachmentBeginInfo& operator=(safe_VkRenderPassAttachmentBeginInfo&& move_src) noexcept;
     safe_VkRenderPassAttachmentBeginInfo();
     ~safe_VkRenderPassAttachmentBeginInfo();
     void initialize(const VkRenderPassAttachmentBeginInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3128,6 +3448,10 @@ struct safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures {
         const safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures& copy_src);
     safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures& operator=(
         const safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures& copy_src);
+    safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures(
+        safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures& operator=(
+        safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures();
     ~safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures();
     void initialize(const VkPhysicalDeviceUniformBufferStandardLayoutFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3150,6 +3474,10 @@ struct safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures {
         const safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& copy_src);
     safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& operator=(
         const safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& copy_src);
+    safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures(
+        safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& operator=(
+        safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures();
     ~safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures();
     void initialize(const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3172,6 +3500,10 @@ struct safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures {
         const safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& copy_src);
     safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& operator=(
         const safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& copy_src);
+    safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures(
+        safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& operator=(
+        safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures();
     ~safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures();
     void initialize(const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3192,6 +3524,8 @@ struct safe_VkAttachmentReferenceStencilLayout {
                                             bool copy_pnext = true);
     safe_VkAttachmentReferenceStencilLayout(const safe_VkAttachmentReferenceStencilLayout& copy_src);
     safe_VkAttachmentReferenceStencilLayout& operator=(const safe_VkAttachmentReferenceStencilLayout& copy_src);
+    safe_VkAttachmentReferenceStencilLayout(safe_VkAttachmentReferenceStencilLayout&& move_src) noexcept;
+    safe_VkAttachmentReferenceStencilLayout& operator=(safe_VkAttachmentReferenceStencilLayout&& move_src) noexcept;
     safe_VkAttachmentReferenceStencilLayout();
     ~safe_VkAttachmentReferenceStencilLayout();
     void initialize(const VkAttachmentReferenceStencilLayout* in_struct, PNextCopyState* copy_state = {});
@@ -3211,6 +3545,8 @@ struct safe_VkAttachmentDescriptionStencilLayout {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkAttachmentDescriptionStencilLayout(const safe_VkAttachmentDescriptionStencilLayout& copy_src);
     safe_VkAttachmentDescriptionStencilLayout& operator=(const safe_VkAttachmentDescriptionStencilLayout& copy_src);
+    safe_VkAttachmentDescriptionStencilLayout(safe_VkAttachmentDescriptionStencilLayout&& move_src) noexcept;
+    safe_VkAttachmentDescriptionStencilLayout& operator=(safe_VkAttachmentDescriptionStencilLayout&& move_src) noexcept;
     safe_VkAttachmentDescriptionStencilLayout();
     ~safe_VkAttachmentDescriptionStencilLayout();
     void initialize(const VkAttachmentDescriptionStencilLayout* in_struct, PNextCopyState* copy_state = {});
@@ -3229,6 +3565,8 @@ struct safe_VkPhysicalDeviceHostQueryResetFeatures {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceHostQueryResetFeatures(const safe_VkPhysicalDeviceHostQueryResetFeatures& copy_src);
     safe_VkPhysicalDeviceHostQueryResetFeatures& operator=(const safe_VkPhysicalDeviceHostQueryResetFeatures& copy_src);
+    safe_VkPhysicalDeviceHostQueryResetFeatures(safe_VkPhysicalDeviceHostQueryResetFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceHostQueryResetFeatures& operator=(safe_VkPhysicalDeviceHostQueryResetFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceHostQueryResetFeatures();
     ~safe_VkPhysicalDeviceHostQueryResetFeatures();
     void initialize(const VkPhysicalDeviceHostQueryResetFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3247,6 +3585,8 @@ struct safe_VkPhysicalDeviceTimelineSemaphoreFeatures {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceTimelineSemaphoreFeatures(const safe_VkPhysicalDeviceTimelineSemaphoreFeatures& copy_src);
     safe_VkPhysicalDeviceTimelineSemaphoreFeatures& operator=(const safe_VkPhysicalDeviceTimelineSemaphoreFeatures& copy_src);
+    safe_VkPhysicalDeviceTimelineSemaphoreFeatures(safe_VkPhysicalDeviceTimelineSemaphoreFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceTimelineSemaphoreFeatures& operator=(safe_VkPhysicalDeviceTimelineSemaphoreFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceTimelineSemaphoreFeatures();
     ~safe_VkPhysicalDeviceTimelineSemaphoreFeatures();
     void initialize(const VkPhysicalDeviceTimelineSemaphoreFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3265,6 +3605,9 @@ struct safe_VkPhysicalDeviceTimelineSemaphoreProperties {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceTimelineSemaphoreProperties(const safe_VkPhysicalDeviceTimelineSemaphoreProperties& copy_src);
     safe_VkPhysicalDeviceTimelineSemaphoreProperties& operator=(const safe_VkPhysicalDeviceTimelineSemaphoreProperties& copy_src);
+    safe_VkPhysicalDeviceTimelineSemaphoreProperties(safe_VkPhysicalDeviceTimelineSemaphoreProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceTimelineSemaphoreProperties& operator=(
+        safe_VkPhysicalDeviceTimelineSemaphoreProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceTimelineSemaphoreProperties();
     ~safe_VkPhysicalDeviceTimelineSemaphoreProperties();
     void initialize(const VkPhysicalDeviceTimelineSemaphoreProperties* in_struct, PNextCopyState* copy_state = {});
@@ -3286,6 +3629,8 @@ struct safe_VkSemaphoreTypeCreateInfo {
                                    bool copy_pnext = true);
     safe_VkSemaphoreTypeCreateInfo(const safe_VkSemaphoreTypeCreateInfo& copy_src);
     safe_VkSemaphoreTypeCreateInfo& operator=(const safe_VkSemaphoreTypeCreateInfo& copy_src);
+    safe_VkSemaphoreTypeCreateInfo(safe_VkSemaphoreTypeCreateInfo&& move_src) noexcept;
+    safe_VkSemaphoreTypeCreateInfo& operator=(safe_VkSemaphoreTypeCreateInfo&& move_src) noexcept;
     safe_VkSemaphoreTypeCreateInfo();
     ~safe_VkSemaphoreTypeCreateInfo();
     void initialize(const VkSemaphoreTypeCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3305,6 +3650,8 @@ struct safe_VkTimelineSemaphoreSubmitInfo {
                                        bool copy_pnext = true);
     safe_VkTimelineSemaphoreSubmitInfo(const safe_VkTimelineSemaphoreSubmitInfo& copy_src);
     safe_VkTimelineSemaphoreSubmitInfo& operator=(const safe_VkTimelineSemaphoreSubmitInfo& copy_src);
+    safe_VkTimelineSemaphoreSubmitInfo(safe_VkTimelineSemaphoreSubmitInfo&& move_src) noexcept;
+    safe_VkTimelineSemaphoreSubmitInfo& operator=(safe_VkTimelineSemaphoreSubmitInfo&& move_src) noexcept;
     safe_VkTimelineSemaphoreSubmitInfo();
     ~safe_VkTimelineSemaphoreSubmitInfo();
     void initialize(const VkTimelineSemaphoreSubmitInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3323,6 +3670,8 @@ struct safe_VkSemaphoreWaitInfo {
     safe_VkSemaphoreWaitInfo(const VkSemaphoreWaitInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSemaphoreWaitInfo(const safe_VkSemaphoreWaitInfo& copy_src);
     safe_VkSemaphoreWaitInfo& operator=(const safe_VkSemaphoreWaitInfo& copy_src);
+    safe_VkSemaphoreWaitInfo(safe_VkSemaphoreWaitInfo&& move_src) noexcept;
+    safe_VkSemaphoreWaitInfo& operator=(safe_VkSemaphoreWaitInfo&& move_src) noexcept;
     safe_VkSemaphoreWaitInfo();
     ~safe_VkSemaphoreWaitInfo();
     void initialize(const VkSemaphoreWaitInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3339,6 +3688,8 @@ struct safe_VkSemaphoreSignalInfo {
     safe_VkSemaphoreSignalInfo(const VkSemaphoreSignalInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSemaphoreSignalInfo(const safe_VkSemaphoreSignalInfo& copy_src);
     safe_VkSemaphoreSignalInfo& operator=(const safe_VkSemaphoreSignalInfo& copy_src);
+    safe_VkSemaphoreSignalInfo(safe_VkSemaphoreSignalInfo&& move_src) noexcept;
+    safe_VkSemaphoreSignalInfo& operator=(safe_VkSemaphoreSignalInfo&& move_src) noexcept;
     safe_VkSemaphoreSignalInfo();
     ~safe_VkSemaphoreSignalInfo();
     void initialize(const VkSemaphoreSignalInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3357,6 +3708,9 @@ struct safe_VkPhysicalDeviceBufferDeviceAddressFeatures {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceBufferDeviceAddressFeatures(const safe_VkPhysicalDeviceBufferDeviceAddressFeatures& copy_src);
     safe_VkPhysicalDeviceBufferDeviceAddressFeatures& operator=(const safe_VkPhysicalDeviceBufferDeviceAddressFeatures& copy_src);
+    safe_VkPhysicalDeviceBufferDeviceAddressFeatures(safe_VkPhysicalDeviceBufferDeviceAddressFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceBufferDeviceAddressFeatures& operator=(
+        safe_VkPhysicalDeviceBufferDeviceAddressFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceBufferDeviceAddressFeatures();
     ~safe_VkPhysicalDeviceBufferDeviceAddressFeatures();
     void initialize(const VkPhysicalDeviceBufferDeviceAddressFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3377,6 +3731,8 @@ struct safe_VkBufferDeviceAddressInfo {
                                    bool copy_pnext = true);
     safe_VkBufferDeviceAddressInfo(const safe_VkBufferDeviceAddressInfo& copy_src);
     safe_VkBufferDeviceAddressInfo& operator=(const safe_VkBufferDeviceAddressInfo& copy_src);
+    safe_VkBufferDeviceAddressInfo(safe_VkBufferDeviceAddressInfo&& move_src) noexcept;
+    safe_VkBufferDeviceAddressInfo& operator=(safe_VkBufferDeviceAddressInfo&& move_src) noexcept;
     safe_VkBufferDeviceAddressInfo();
     ~safe_VkBufferDeviceAddressInfo();
     void initialize(const VkBufferDeviceAddressInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3393,6 +3749,8 @@ struct safe_VkBufferOpaqueCaptureAddressCreateInfo {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBufferOpaqueCaptureAddressCreateInfo(const safe_VkBufferOpaqueCaptureAddressCreateInfo& copy_src);
     safe_VkBufferOpaqueCaptureAddressCreateInfo& operator=(const safe_VkBufferOpaqueCaptureAddressCreateInfo& copy_src);
+    safe_VkBufferOpaqueCaptureAddressCreateInfo(safe_VkBufferOpaqueCaptureAddressCreateInfo&& move_src) noexcept;
+    safe_VkBufferOpaqueCaptureAddressCreateInfo& operator=(safe_VkBufferOpaqueCaptureAddressCreateInfo&& move_src) noexcept;
     safe_VkBufferOpaqueCaptureAddressCreateInfo();
     ~safe_VkBufferOpaqueCaptureAddressCreateInfo();
     void initialize(const VkBufferOpaqueCaptureAddressCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3411,6 +3769,8 @@ struct safe_VkMemoryOpaqueCaptureAddressAllocateInfo {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryOpaqueCaptureAddressAllocateInfo(const safe_VkMemoryOpaqueCaptureAddressAllocateInfo& copy_src);
     safe_VkMemoryOpaqueCaptureAddressAllocateInfo& operator=(const safe_VkMemoryOpaqueCaptureAddressAllocateInfo& copy_src);
+    safe_VkMemoryOpaqueCaptureAddressAllocateInfo(safe_VkMemoryOpaqueCaptureAddressAllocateInfo&& move_src) noexcept;
+    safe_VkMemoryOpaqueCaptureAddressAllocateInfo& operator=(safe_VkMemoryOpaqueCaptureAddressAllocateInfo&& move_src) noexcept;
     safe_VkMemoryOpaqueCaptureAddressAllocateInfo();
     ~safe_VkMemoryOpaqueCaptureAddressAllocateInfo();
     void initialize(const VkMemoryOpaqueCaptureAddressAllocateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3429,6 +3789,8 @@ struct safe_VkDeviceMemoryOpaqueCaptureAddressInfo {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceMemoryOpaqueCaptureAddressInfo(const safe_VkDeviceMemoryOpaqueCaptureAddressInfo& copy_src);
     safe_VkDeviceMemoryOpaqueCaptureAddressInfo& operator=(const safe_VkDeviceMemoryOpaqueCaptureAddressInfo& copy_src);
+    safe_VkDeviceMemoryOpaqueCaptureAddressInfo(safe_VkDeviceMemoryOpaqueCaptureAddressInfo&& move_src) noexcept;
+    safe_VkDeviceMemoryOpaqueCaptureAddressInfo& operator=(safe_VkDeviceMemoryOpaqueCaptureAddressInfo&& move_src) noexcept;
     safe_VkDeviceMemoryOpaqueCaptureAddressInfo();
     ~safe_VkDeviceMemoryOpaqueCaptureAddressInfo();
     void initialize(const VkDeviceMemoryOpaqueCaptureAddressInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3461,6 +3823,8 @@ struct safe_VkPhysicalDeviceVulkan13Features {
                                           bool copy_pnext = true);
     safe_VkPhysicalDeviceVulkan13Features(const safe_VkPhysicalDeviceVulkan13Features& copy_src);
     safe_VkPhysicalDeviceVulkan13Features& operator=(const safe_VkPhysicalDeviceVulkan13Features& copy_src);
+    safe_VkPhysicalDeviceVulkan13Features(safe_VkPhysicalDeviceVulkan13Features&& move_src) noexcept;
+    safe_VkPhysicalDeviceVulkan13Features& operator=(safe_VkPhysicalDeviceVulkan13Features&& move_src) noexcept;
     safe_VkPhysicalDeviceVulkan13Features();
     ~safe_VkPhysicalDeviceVulkan13Features();
     void initialize(const VkPhysicalDeviceVulkan13Features* in_struct, PNextCopyState* copy_state = {});
@@ -3521,6 +3885,8 @@ struct safe_VkPhysicalDeviceVulkan13Properties {
                                             bool copy_pnext = true);
     safe_VkPhysicalDeviceVulkan13Properties(const safe_VkPhysicalDeviceVulkan13Properties& copy_src);
     safe_VkPhysicalDeviceVulkan13Properties& operator=(const safe_VkPhysicalDeviceVulkan13Properties& copy_src);
+    safe_VkPhysicalDeviceVulkan13Properties(safe_VkPhysicalDeviceVulkan13Properties&& move_src) noexcept;
+    safe_VkPhysicalDeviceVulkan13Properties& operator=(safe_VkPhysicalDeviceVulkan13Properties&& move_src) noexcept;
     safe_VkPhysicalDeviceVulkan13Properties();
     ~safe_VkPhysicalDeviceVulkan13Properties();
     void initialize(const VkPhysicalDeviceVulkan13Properties* in_struct, PNextCopyState* copy_state = {});
@@ -3541,6 +3907,8 @@ struct safe_VkPipelineCreationFeedbackCreateInfo {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineCreationFeedbackCreateInfo(const safe_VkPipelineCreationFeedbackCreateInfo& copy_src);
     safe_VkPipelineCreationFeedbackCreateInfo& operator=(const safe_VkPipelineCreationFeedbackCreateInfo& copy_src);
+    safe_VkPipelineCreationFeedbackCreateInfo(safe_VkPipelineCreationFeedbackCreateInfo&& move_src) noexcept;
+    safe_VkPipelineCreationFeedbackCreateInfo& operator=(safe_VkPipelineCreationFeedbackCreateInfo&& move_src) noexcept;
     safe_VkPipelineCreationFeedbackCreateInfo();
     ~safe_VkPipelineCreationFeedbackCreateInfo();
     void initialize(const VkPipelineCreationFeedbackCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3560,6 +3928,10 @@ struct safe_VkPhysicalDeviceShaderTerminateInvocationFeatures {
     safe_VkPhysicalDeviceShaderTerminateInvocationFeatures(const safe_VkPhysicalDeviceShaderTerminateInvocationFeatures& copy_src);
     safe_VkPhysicalDeviceShaderTerminateInvocationFeatures& operator=(
         const safe_VkPhysicalDeviceShaderTerminateInvocationFeatures& copy_src);
+    safe_VkPhysicalDeviceShaderTerminateInvocationFeatures(
+        safe_VkPhysicalDeviceShaderTerminateInvocationFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderTerminateInvocationFeatures& operator=(
+        safe_VkPhysicalDeviceShaderTerminateInvocationFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderTerminateInvocationFeatures();
     ~safe_VkPhysicalDeviceShaderTerminateInvocationFeatures();
     void initialize(const VkPhysicalDeviceShaderTerminateInvocationFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3584,6 +3956,8 @@ struct safe_VkPhysicalDeviceToolProperties {
                                         bool copy_pnext = true);
     safe_VkPhysicalDeviceToolProperties(const safe_VkPhysicalDeviceToolProperties& copy_src);
     safe_VkPhysicalDeviceToolProperties& operator=(const safe_VkPhysicalDeviceToolProperties& copy_src);
+    safe_VkPhysicalDeviceToolProperties(safe_VkPhysicalDeviceToolProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceToolProperties& operator=(safe_VkPhysicalDeviceToolProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceToolProperties();
     ~safe_VkPhysicalDeviceToolProperties();
     void initialize(const VkPhysicalDeviceToolProperties* in_struct, PNextCopyState* copy_state = {});
@@ -3603,6 +3977,10 @@ struct safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures {
         const safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& copy_src);
     safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& operator=(
         const safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& copy_src);
+    safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures(
+        safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& operator=(
+        safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures();
     ~safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures();
     void initialize(const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3623,6 +4001,8 @@ struct safe_VkPhysicalDevicePrivateDataFeatures {
                                              bool copy_pnext = true);
     safe_VkPhysicalDevicePrivateDataFeatures(const safe_VkPhysicalDevicePrivateDataFeatures& copy_src);
     safe_VkPhysicalDevicePrivateDataFeatures& operator=(const safe_VkPhysicalDevicePrivateDataFeatures& copy_src);
+    safe_VkPhysicalDevicePrivateDataFeatures(safe_VkPhysicalDevicePrivateDataFeatures&& move_src) noexcept;
+    safe_VkPhysicalDevicePrivateDataFeatures& operator=(safe_VkPhysicalDevicePrivateDataFeatures&& move_src) noexcept;
     safe_VkPhysicalDevicePrivateDataFeatures();
     ~safe_VkPhysicalDevicePrivateDataFeatures();
     void initialize(const VkPhysicalDevicePrivateDataFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3641,6 +4021,8 @@ struct safe_VkDevicePrivateDataCreateInfo {
                                        bool copy_pnext = true);
     safe_VkDevicePrivateDataCreateInfo(const safe_VkDevicePrivateDataCreateInfo& copy_src);
     safe_VkDevicePrivateDataCreateInfo& operator=(const safe_VkDevicePrivateDataCreateInfo& copy_src);
+    safe_VkDevicePrivateDataCreateInfo(safe_VkDevicePrivateDataCreateInfo&& move_src) noexcept;
+    safe_VkDevicePrivateDataCreateInfo& operator=(safe_VkDevicePrivateDataCreateInfo&& move_src) noexcept;
     safe_VkDevicePrivateDataCreateInfo();
     ~safe_VkDevicePrivateDataCreateInfo();
     void initialize(const VkDevicePrivateDataCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3657,6 +4039,8 @@ struct safe_VkPrivateDataSlotCreateInfo {
                                      bool copy_pnext = true);
     safe_VkPrivateDataSlotCreateInfo(const safe_VkPrivateDataSlotCreateInfo& copy_src);
     safe_VkPrivateDataSlotCreateInfo& operator=(const safe_VkPrivateDataSlotCreateInfo& copy_src);
+    safe_VkPrivateDataSlotCreateInfo(safe_VkPrivateDataSlotCreateInfo&& move_src) noexcept;
+    safe_VkPrivateDataSlotCreateInfo& operator=(safe_VkPrivateDataSlotCreateInfo&& move_src) noexcept;
     safe_VkPrivateDataSlotCreateInfo();
     ~safe_VkPrivateDataSlotCreateInfo();
     void initialize(const VkPrivateDataSlotCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3675,6 +4059,10 @@ struct safe_VkPhysicalDevicePipelineCreationCacheControlFeatures {
         const safe_VkPhysicalDevicePipelineCreationCacheControlFeatures& copy_src);
     safe_VkPhysicalDevicePipelineCreationCacheControlFeatures& operator=(
         const safe_VkPhysicalDevicePipelineCreationCacheControlFeatures& copy_src);
+    safe_VkPhysicalDevicePipelineCreationCacheControlFeatures(
+        safe_VkPhysicalDevicePipelineCreationCacheControlFeatures&& move_src) noexcept;
+    safe_VkPhysicalDevicePipelineCreationCacheControlFeatures& operator=(
+        safe_VkPhysicalDevicePipelineCreationCacheControlFeatures&& move_src) noexcept;
     safe_VkPhysicalDevicePipelineCreationCacheControlFeatures();
     ~safe_VkPhysicalDevicePipelineCreationCacheControlFeatures();
     void initialize(const VkPhysicalDevicePipelineCreationCacheControlFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3697,6 +4085,8 @@ struct safe_VkMemoryBarrier2 {
     safe_VkMemoryBarrier2(const VkMemoryBarrier2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryBarrier2(const safe_VkMemoryBarrier2& copy_src);
     safe_VkMemoryBarrier2& operator=(const safe_VkMemoryBarrier2& copy_src);
+    safe_VkMemoryBarrier2(safe_VkMemoryBarrier2&& move_src) noexcept;
+    safe_VkMemoryBarrier2& operator=(safe_VkMemoryBarrier2&& move_src) noexcept;
     safe_VkMemoryBarrier2();
     ~safe_VkMemoryBarrier2();
     void initialize(const VkMemoryBarrier2* in_struct, PNextCopyState* copy_state = {});
@@ -3720,6 +4110,8 @@ struct safe_VkBufferMemoryBarrier2 {
     safe_VkBufferMemoryBarrier2(const VkBufferMemoryBarrier2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBufferMemoryBarrier2(const safe_VkBufferMemoryBarrier2& copy_src);
     safe_VkBufferMemoryBarrier2& operator=(const safe_VkBufferMemoryBarrier2& copy_src);
+    safe_VkBufferMemoryBarrier2(safe_VkBufferMemoryBarrier2&& move_src) noexcept;
+    safe_VkBufferMemoryBarrier2& operator=(safe_VkBufferMemoryBarrier2&& move_src) noexcept;
     safe_VkBufferMemoryBarrier2();
     ~safe_VkBufferMemoryBarrier2();
     void initialize(const VkBufferMemoryBarrier2* in_struct, PNextCopyState* copy_state = {});
@@ -3744,6 +4136,8 @@ struct safe_VkImageMemoryBarrier2 {
     safe_VkImageMemoryBarrier2(const VkImageMemoryBarrier2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageMemoryBarrier2(const safe_VkImageMemoryBarrier2& copy_src);
     safe_VkImageMemoryBarrier2& operator=(const safe_VkImageMemoryBarrier2& copy_src);
+    safe_VkImageMemoryBarrier2(safe_VkImageMemoryBarrier2&& move_src) noexcept;
+    safe_VkImageMemoryBarrier2& operator=(safe_VkImageMemoryBarrier2&& move_src) noexcept;
     safe_VkImageMemoryBarrier2();
     ~safe_VkImageMemoryBarrier2();
     void initialize(const VkImageMemoryBarrier2* in_struct, PNextCopyState* copy_state = {});
@@ -3765,6 +4159,8 @@ struct safe_VkDependencyInfo {
     safe_VkDependencyInfo(const VkDependencyInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDependencyInfo(const safe_VkDependencyInfo& copy_src);
     safe_VkDependencyInfo& operator=(const safe_VkDependencyInfo& copy_src);
+    safe_VkDependencyInfo(safe_VkDependencyInfo&& move_src) noexcept;
+    safe_VkDependencyInfo& operator=(safe_VkDependencyInfo&& move_src) noexcept;
     safe_VkDependencyInfo();
     ~safe_VkDependencyInfo();
     void initialize(const VkDependencyInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3783,6 +4179,8 @@ struct safe_VkSemaphoreSubmitInfo {
     safe_VkSemaphoreSubmitInfo(const VkSemaphoreSubmitInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSemaphoreSubmitInfo(const safe_VkSemaphoreSubmitInfo& copy_src);
     safe_VkSemaphoreSubmitInfo& operator=(const safe_VkSemaphoreSubmitInfo& copy_src);
+    safe_VkSemaphoreSubmitInfo(safe_VkSemaphoreSubmitInfo&& move_src) noexcept;
+    safe_VkSemaphoreSubmitInfo& operator=(safe_VkSemaphoreSubmitInfo&& move_src) noexcept;
     safe_VkSemaphoreSubmitInfo();
     ~safe_VkSemaphoreSubmitInfo();
     void initialize(const VkSemaphoreSubmitInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3800,6 +4198,8 @@ struct safe_VkCommandBufferSubmitInfo {
                                    bool copy_pnext = true);
     safe_VkCommandBufferSubmitInfo(const safe_VkCommandBufferSubmitInfo& copy_src);
     safe_VkCommandBufferSubmitInfo& operator=(const safe_VkCommandBufferSubmitInfo& copy_src);
+    safe_VkCommandBufferSubmitInfo(safe_VkCommandBufferSubmitInfo&& move_src) noexcept;
+    safe_VkCommandBufferSubmitInfo& operator=(safe_VkCommandBufferSubmitInfo&& move_src) noexcept;
     safe_VkCommandBufferSubmitInfo();
     ~safe_VkCommandBufferSubmitInfo();
     void initialize(const VkCommandBufferSubmitInfo* in_struct, PNextCopyState* copy_state = {});
@@ -3821,6 +4221,8 @@ struct safe_VkSubmitInfo2 {
     safe_VkSubmitInfo2(const VkSubmitInfo2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSubmitInfo2(const safe_VkSubmitInfo2& copy_src);
     safe_VkSubmitInfo2& operator=(const safe_VkSubmitInfo2& copy_src);
+    safe_VkSubmitInfo2(safe_VkSubmitInfo2&& move_src) noexcept;
+    safe_VkSubmitInfo2& operator=(safe_VkSubmitInfo2&& move_src) noexcept;
     safe_VkSubmitInfo2();
     ~safe_VkSubmitInfo2();
     void initialize(const VkSubmitInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -3837,6 +4239,8 @@ struct safe_VkPhysicalDeviceSynchronization2Features {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceSynchronization2Features(const safe_VkPhysicalDeviceSynchronization2Features& copy_src);
     safe_VkPhysicalDeviceSynchronization2Features& operator=(const safe_VkPhysicalDeviceSynchronization2Features& copy_src);
+    safe_VkPhysicalDeviceSynchronization2Features(safe_VkPhysicalDeviceSynchronization2Features&& move_src) noexcept;
+    safe_VkPhysicalDeviceSynchronization2Features& operator=(safe_VkPhysicalDeviceSynchronization2Features&& move_src) noexcept;
     safe_VkPhysicalDeviceSynchronization2Features();
     ~safe_VkPhysicalDeviceSynchronization2Features();
     void initialize(const VkPhysicalDeviceSynchronization2Features* in_struct, PNextCopyState* copy_state = {});
@@ -3858,6 +4262,10 @@ struct safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures {
         const safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& copy_src);
     safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& operator=(
         const safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& copy_src);
+    safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures(
+        safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& operator=(
+        safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures();
     ~safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures();
     void initialize(const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3878,6 +4286,8 @@ struct safe_VkPhysicalDeviceImageRobustnessFeatures {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceImageRobustnessFeatures(const safe_VkPhysicalDeviceImageRobustnessFeatures& copy_src);
     safe_VkPhysicalDeviceImageRobustnessFeatures& operator=(const safe_VkPhysicalDeviceImageRobustnessFeatures& copy_src);
+    safe_VkPhysicalDeviceImageRobustnessFeatures(safe_VkPhysicalDeviceImageRobustnessFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageRobustnessFeatures& operator=(safe_VkPhysicalDeviceImageRobustnessFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceImageRobustnessFeatures();
     ~safe_VkPhysicalDeviceImageRobustnessFeatures();
     void initialize(const VkPhysicalDeviceImageRobustnessFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -3897,6 +4307,8 @@ struct safe_VkBufferCopy2 {
     safe_VkBufferCopy2(const VkBufferCopy2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBufferCopy2(const safe_VkBufferCopy2& copy_src);
     safe_VkBufferCopy2& operator=(const safe_VkBufferCopy2& copy_src);
+    safe_VkBufferCopy2(safe_VkBufferCopy2&& move_src) noexcept;
+    safe_VkBufferCopy2& operator=(safe_VkBufferCopy2&& move_src) noexcept;
     safe_VkBufferCopy2();
     ~safe_VkBufferCopy2();
     void initialize(const VkBufferCopy2* in_struct, PNextCopyState* copy_state = {});
@@ -3915,6 +4327,8 @@ struct safe_VkCopyBufferInfo2 {
     safe_VkCopyBufferInfo2(const VkCopyBufferInfo2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCopyBufferInfo2(const safe_VkCopyBufferInfo2& copy_src);
     safe_VkCopyBufferInfo2& operator=(const safe_VkCopyBufferInfo2& copy_src);
+    safe_VkCopyBufferInfo2(safe_VkCopyBufferInfo2&& move_src) noexcept;
+    safe_VkCopyBufferInfo2& operator=(safe_VkCopyBufferInfo2&& move_src) noexcept;
     safe_VkCopyBufferInfo2();
     ~safe_VkCopyBufferInfo2();
     void initialize(const VkCopyBufferInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -3934,6 +4348,8 @@ struct safe_VkImageCopy2 {
     safe_VkImageCopy2(const VkImageCopy2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageCopy2(const safe_VkImageCopy2& copy_src);
     safe_VkImageCopy2& operator=(const safe_VkImageCopy2& copy_src);
+    safe_VkImageCopy2(safe_VkImageCopy2&& move_src) noexcept;
+    safe_VkImageCopy2& operator=(safe_VkImageCopy2&& move_src) noexcept;
     safe_VkImageCopy2();
     ~safe_VkImageCopy2();
     void initialize(const VkImageCopy2* in_struct, PNextCopyState* copy_state = {});
@@ -3954,6 +4370,8 @@ struct safe_VkCopyImageInfo2 {
     safe_VkCopyImageInfo2(const VkCopyImageInfo2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCopyImageInfo2(const safe_VkCopyImageInfo2& copy_src);
     safe_VkCopyImageInfo2& operator=(const safe_VkCopyImageInfo2& copy_src);
+    safe_VkCopyImageInfo2(safe_VkCopyImageInfo2&& move_src) noexcept;
+    safe_VkCopyImageInfo2& operator=(safe_VkCopyImageInfo2&& move_src) noexcept;
     safe_VkCopyImageInfo2();
     ~safe_VkCopyImageInfo2();
     void initialize(const VkCopyImageInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -3974,6 +4392,8 @@ struct safe_VkBufferImageCopy2 {
     safe_VkBufferImageCopy2(const VkBufferImageCopy2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBufferImageCopy2(const safe_VkBufferImageCopy2& copy_src);
     safe_VkBufferImageCopy2& operator=(const safe_VkBufferImageCopy2& copy_src);
+    safe_VkBufferImageCopy2(safe_VkBufferImageCopy2&& move_src) noexcept;
+    safe_VkBufferImageCopy2& operator=(safe_VkBufferImageCopy2&& move_src) noexcept;
     safe_VkBufferImageCopy2();
     ~safe_VkBufferImageCopy2();
     void initialize(const VkBufferImageCopy2* in_struct, PNextCopyState* copy_state = {});
@@ -3994,6 +4414,8 @@ struct safe_VkCopyBufferToImageInfo2 {
                                   bool copy_pnext = true);
     safe_VkCopyBufferToImageInfo2(const safe_VkCopyBufferToImageInfo2& copy_src);
     safe_VkCopyBufferToImageInfo2& operator=(const safe_VkCopyBufferToImageInfo2& copy_src);
+    safe_VkCopyBufferToImageInfo2(safe_VkCopyBufferToImageInfo2&& move_src) noexcept;
+    safe_VkCopyBufferToImageInfo2& operator=(safe_VkCopyBufferToImageInfo2&& move_src) noexcept;
     safe_VkCopyBufferToImageInfo2();
     ~safe_VkCopyBufferToImageInfo2();
     void initialize(const VkCopyBufferToImageInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -4014,6 +4436,8 @@ struct safe_VkCopyImageToBufferInfo2 {
                                   bool copy_pnext = true);
     safe_VkCopyImageToBufferInfo2(const safe_VkCopyImageToBufferInfo2& copy_src);
     safe_VkCopyImageToBufferInfo2& operator=(const safe_VkCopyImageToBufferInfo2& copy_src);
+    safe_VkCopyImageToBufferInfo2(safe_VkCopyImageToBufferInfo2&& move_src) noexcept;
+    safe_VkCopyImageToBufferInfo2& operator=(safe_VkCopyImageToBufferInfo2&& move_src) noexcept;
     safe_VkCopyImageToBufferInfo2();
     ~safe_VkCopyImageToBufferInfo2();
     void initialize(const VkCopyImageToBufferInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -4032,6 +4456,8 @@ struct safe_VkImageBlit2 {
     safe_VkImageBlit2(const VkImageBlit2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageBlit2(const safe_VkImageBlit2& copy_src);
     safe_VkImageBlit2& operator=(const safe_VkImageBlit2& copy_src);
+    safe_VkImageBlit2(safe_VkImageBlit2&& move_src) noexcept;
+    safe_VkImageBlit2& operator=(safe_VkImageBlit2&& move_src) noexcept;
     safe_VkImageBlit2();
     ~safe_VkImageBlit2();
     void initialize(const VkImageBlit2* in_struct, PNextCopyState* copy_state = {});
@@ -4053,6 +4479,8 @@ struct safe_VkBlitImageInfo2 {
     safe_VkBlitImageInfo2(const VkBlitImageInfo2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBlitImageInfo2(const safe_VkBlitImageInfo2& copy_src);
     safe_VkBlitImageInfo2& operator=(const safe_VkBlitImageInfo2& copy_src);
+    safe_VkBlitImageInfo2(safe_VkBlitImageInfo2&& move_src) noexcept;
+    safe_VkBlitImageInfo2& operator=(safe_VkBlitImageInfo2&& move_src) noexcept;
     safe_VkBlitImageInfo2();
     ~safe_VkBlitImageInfo2();
     void initialize(const VkBlitImageInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -4072,6 +4500,8 @@ struct safe_VkImageResolve2 {
     safe_VkImageResolve2(const VkImageResolve2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageResolve2(const safe_VkImageResolve2& copy_src);
     safe_VkImageResolve2& operator=(const safe_VkImageResolve2& copy_src);
+    safe_VkImageResolve2(safe_VkImageResolve2&& move_src) noexcept;
+    safe_VkImageResolve2& operator=(safe_VkImageResolve2&& move_src) noexcept;
     safe_VkImageResolve2();
     ~safe_VkImageResolve2();
     void initialize(const VkImageResolve2* in_struct, PNextCopyState* copy_state = {});
@@ -4092,6 +4522,8 @@ struct safe_VkResolveImageInfo2 {
     safe_VkResolveImageInfo2(const VkResolveImageInfo2* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkResolveImageInfo2(const safe_VkResolveImageInfo2& copy_src);
     safe_VkResolveImageInfo2& operator=(const safe_VkResolveImageInfo2& copy_src);
+    safe_VkResolveImageInfo2(safe_VkResolveImageInfo2&& move_src) noexcept;
+    safe_VkResolveImageInfo2& operator=(safe_VkResolveImageInfo2&& move_src) noexcept;
     safe_VkResolveImageInfo2();
     ~safe_VkResolveImageInfo2();
     void initialize(const VkResolveImageInfo2* in_struct, PNextCopyState* copy_state = {});
@@ -4109,6 +4541,9 @@ struct safe_VkPhysicalDeviceSubgroupSizeControlFeatures {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceSubgroupSizeControlFeatures(const safe_VkPhysicalDeviceSubgroupSizeControlFeatures& copy_src);
     safe_VkPhysicalDeviceSubgroupSizeControlFeatures& operator=(const safe_VkPhysicalDeviceSubgroupSizeControlFeatures& copy_src);
+    safe_VkPhysicalDeviceSubgroupSizeControlFeatures(safe_VkPhysicalDeviceSubgroupSizeControlFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceSubgroupSizeControlFeatures& operator=(
+        safe_VkPhysicalDeviceSubgroupSizeControlFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceSubgroupSizeControlFeatures();
     ~safe_VkPhysicalDeviceSubgroupSizeControlFeatures();
     void initialize(const VkPhysicalDeviceSubgroupSizeControlFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -4133,6 +4568,9 @@ struct safe_VkPhysicalDeviceSubgroupSizeControlProperties {
     safe_VkPhysicalDeviceSubgroupSizeControlProperties(const safe_VkPhysicalDeviceSubgroupSizeControlProperties& copy_src);
     safe_VkPhysicalDeviceSubgroupSizeControlProperties& operator=(
         const safe_VkPhysicalDeviceSubgroupSizeControlProperties& copy_src);
+    safe_VkPhysicalDeviceSubgroupSizeControlProperties(safe_VkPhysicalDeviceSubgroupSizeControlProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceSubgroupSizeControlProperties& operator=(
+        safe_VkPhysicalDeviceSubgroupSizeControlProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceSubgroupSizeControlProperties();
     ~safe_VkPhysicalDeviceSubgroupSizeControlProperties();
     void initialize(const VkPhysicalDeviceSubgroupSizeControlProperties* in_struct, PNextCopyState* copy_state = {});
@@ -4155,6 +4593,10 @@ struct safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo {
         const safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& copy_src);
     safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& operator=(
         const safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& copy_src);
+    safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo(
+        safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo&& move_src) noexcept;
+    safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& operator=(
+        safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo&& move_src) noexcept;
     safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo();
     ~safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo();
     void initialize(const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -4176,6 +4618,8 @@ struct safe_VkPhysicalDeviceInlineUniformBlockFeatures {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceInlineUniformBlockFeatures(const safe_VkPhysicalDeviceInlineUniformBlockFeatures& copy_src);
     safe_VkPhysicalDeviceInlineUniformBlockFeatures& operator=(const safe_VkPhysicalDeviceInlineUniformBlockFeatures& copy_src);
+    safe_VkPhysicalDeviceInlineUniformBlockFeatures(safe_VkPhysicalDeviceInlineUniformBlockFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceInlineUniformBlockFeatures& operator=(safe_VkPhysicalDeviceInlineUniformBlockFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceInlineUniformBlockFeatures();
     ~safe_VkPhysicalDeviceInlineUniformBlockFeatures();
     void initialize(const VkPhysicalDeviceInlineUniformBlockFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -4200,6 +4644,9 @@ struct safe_VkPhysicalDeviceInlineUniformBlockProperties {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceInlineUniformBlockProperties(const safe_VkPhysicalDeviceInlineUniformBlockProperties& copy_src);
     safe_VkPhysicalDeviceInlineUniformBlockProperties& operator=(const safe_VkPhysicalDeviceInlineUniformBlockProperties& copy_src);
+    safe_VkPhysicalDeviceInlineUniformBlockProperties(safe_VkPhysicalDeviceInlineUniformBlockProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceInlineUniformBlockProperties& operator=(
+        safe_VkPhysicalDeviceInlineUniformBlockProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceInlineUniformBlockProperties();
     ~safe_VkPhysicalDeviceInlineUniformBlockProperties();
     void initialize(const VkPhysicalDeviceInlineUniformBlockProperties* in_struct, PNextCopyState* copy_state = {});
@@ -4221,6 +4668,8 @@ struct safe_VkWriteDescriptorSetInlineUniformBlock {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkWriteDescriptorSetInlineUniformBlock(const safe_VkWriteDescriptorSetInlineUniformBlock& copy_src);
     safe_VkWriteDescriptorSetInlineUniformBlock& operator=(const safe_VkWriteDescriptorSetInlineUniformBlock& copy_src);
+    safe_VkWriteDescriptorSetInlineUniformBlock(safe_VkWriteDescriptorSetInlineUniformBlock&& move_src) noexcept;
+    safe_VkWriteDescriptorSetInlineUniformBlock& operator=(safe_VkWriteDescriptorSetInlineUniformBlock&& move_src) noexcept;
     safe_VkWriteDescriptorSetInlineUniformBlock();
     ~safe_VkWriteDescriptorSetInlineUniformBlock();
     void initialize(const VkWriteDescriptorSetInlineUniformBlock* in_struct, PNextCopyState* copy_state = {});
@@ -4239,6 +4688,9 @@ struct safe_VkDescriptorPoolInlineUniformBlockCreateInfo {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDescriptorPoolInlineUniformBlockCreateInfo(const safe_VkDescriptorPoolInlineUniformBlockCreateInfo& copy_src);
     safe_VkDescriptorPoolInlineUniformBlockCreateInfo& operator=(const safe_VkDescriptorPoolInlineUniformBlockCreateInfo& copy_src);
+    safe_VkDescriptorPoolInlineUniformBlockCreateInfo(safe_VkDescriptorPoolInlineUniformBlockCreateInfo&& move_src) noexcept;
+    safe_VkDescriptorPoolInlineUniformBlockCreateInfo& operator=(
+        safe_VkDescriptorPoolInlineUniformBlockCreateInfo&& move_src) noexcept;
     safe_VkDescriptorPoolInlineUniformBlockCreateInfo();
     ~safe_VkDescriptorPoolInlineUniformBlockCreateInfo();
     void initialize(const VkDescriptorPoolInlineUniformBlockCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -4260,6 +4712,10 @@ struct safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures {
     safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures(const safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures& copy_src);
     safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures& operator=(
         const safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures& copy_src);
+    safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures(
+        safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures& operator=(
+        safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures();
     ~safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures();
     void initialize(const VkPhysicalDeviceTextureCompressionASTCHDRFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -4287,6 +4743,8 @@ struct safe_VkRenderingAttachmentInfo {
                                    bool copy_pnext = true);
     safe_VkRenderingAttachmentInfo(const safe_VkRenderingAttachmentInfo& copy_src);
     safe_VkRenderingAttachmentInfo& operator=(const safe_VkRenderingAttachmentInfo& copy_src);
+    safe_VkRenderingAttachmentInfo(safe_VkRenderingAttachmentInfo&& move_src) noexcept;
+    safe_VkRenderingAttachmentInfo& operator=(safe_VkRenderingAttachmentInfo&& move_src) noexcept;
     safe_VkRenderingAttachmentInfo();
     ~safe_VkRenderingAttachmentInfo();
     void initialize(const VkRenderingAttachmentInfo* in_struct, PNextCopyState* copy_state = {});
@@ -4309,6 +4767,8 @@ struct safe_VkRenderingInfo {
     safe_VkRenderingInfo(const VkRenderingInfo* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRenderingInfo(const safe_VkRenderingInfo& copy_src);
     safe_VkRenderingInfo& operator=(const safe_VkRenderingInfo& copy_src);
+    safe_VkRenderingInfo(safe_VkRenderingInfo&& move_src) noexcept;
+    safe_VkRenderingInfo& operator=(safe_VkRenderingInfo&& move_src) noexcept;
     safe_VkRenderingInfo();
     ~safe_VkRenderingInfo();
     void initialize(const VkRenderingInfo* in_struct, PNextCopyState* copy_state = {});
@@ -4329,6 +4789,8 @@ struct safe_VkPipelineRenderingCreateInfo {
                                        bool copy_pnext = true);
     safe_VkPipelineRenderingCreateInfo(const safe_VkPipelineRenderingCreateInfo& copy_src);
     safe_VkPipelineRenderingCreateInfo& operator=(const safe_VkPipelineRenderingCreateInfo& copy_src);
+    safe_VkPipelineRenderingCreateInfo(safe_VkPipelineRenderingCreateInfo&& move_src) noexcept;
+    safe_VkPipelineRenderingCreateInfo& operator=(safe_VkPipelineRenderingCreateInfo&& move_src) noexcept;
     safe_VkPipelineRenderingCreateInfo();
     ~safe_VkPipelineRenderingCreateInfo();
     void initialize(const VkPipelineRenderingCreateInfo* in_struct, PNextCopyState* copy_state = {});
@@ -4345,6 +4807,8 @@ struct safe_VkPhysicalDeviceDynamicRenderingFeatures {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceDynamicRenderingFeatures(const safe_VkPhysicalDeviceDynamicRenderingFeatures& copy_src);
     safe_VkPhysicalDeviceDynamicRenderingFeatures& operator=(const safe_VkPhysicalDeviceDynamicRenderingFeatures& copy_src);
+    safe_VkPhysicalDeviceDynamicRenderingFeatures(safe_VkPhysicalDeviceDynamicRenderingFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceDynamicRenderingFeatures& operator=(safe_VkPhysicalDeviceDynamicRenderingFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceDynamicRenderingFeatures();
     ~safe_VkPhysicalDeviceDynamicRenderingFeatures();
     void initialize(const VkPhysicalDeviceDynamicRenderingFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -4369,6 +4833,8 @@ struct safe_VkCommandBufferInheritanceRenderingInfo {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCommandBufferInheritanceRenderingInfo(const safe_VkCommandBufferInheritanceRenderingInfo& copy_src);
     safe_VkCommandBufferInheritanceRenderingInfo& operator=(const safe_VkCommandBufferInheritanceRenderingInfo& copy_src);
+    safe_VkCommandBufferInheritanceRenderingInfo(safe_VkCommandBufferInheritanceRenderingInfo&& move_src) noexcept;
+    safe_VkCommandBufferInheritanceRenderingInfo& operator=(safe_VkCommandBufferInheritanceRenderingInfo&& move_src) noexcept;
     safe_VkCommandBufferInheritanceRenderingInfo();
     ~safe_VkCommandBufferInheritanceRenderingInfo();
     void initialize(const VkCommandBufferInheritanceRenderingInfo* in_struct, PNextCopyState* copy_state = {});
@@ -4388,6 +4854,9 @@ struct safe_VkPhysicalDeviceShaderIntegerDotProductFeatures {
     safe_VkPhysicalDeviceShaderIntegerDotProductFeatures(const safe_VkPhysicalDeviceShaderIntegerDotProductFeatures& copy_src);
     safe_VkPhysicalDeviceShaderIntegerDotProductFeatures& operator=(
         const safe_VkPhysicalDeviceShaderIntegerDotProductFeatures& copy_src);
+    safe_VkPhysicalDeviceShaderIntegerDotProductFeatures(safe_VkPhysicalDeviceShaderIntegerDotProductFeatures&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderIntegerDotProductFeatures& operator=(
+        safe_VkPhysicalDeviceShaderIntegerDotProductFeatures&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderIntegerDotProductFeatures();
     ~safe_VkPhysicalDeviceShaderIntegerDotProductFeatures();
     void initialize(const VkPhysicalDeviceShaderIntegerDotProductFeatures* in_struct, PNextCopyState* copy_state = {});
@@ -4438,6 +4907,10 @@ struct safe_VkPhysicalDeviceShaderIntegerDotProductProperties {
     safe_VkPhysicalDeviceShaderIntegerDotProductProperties(const safe_VkPhysicalDeviceShaderIntegerDotProductProperties& copy_src);
     safe_VkPhysicalDeviceShaderIntegerDotProductProperties& operator=(
         const safe_VkPhysicalDeviceShaderIntegerDotProductProperties& copy_src);
+    safe_VkPhysicalDeviceShaderIntegerDotProductProperties(
+        safe_VkPhysicalDeviceShaderIntegerDotProductProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderIntegerDotProductProperties& operator=(
+        safe_VkPhysicalDeviceShaderIntegerDotProductProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderIntegerDotProductProperties();
     ~safe_VkPhysicalDeviceShaderIntegerDotProductProperties();
     void initialize(const VkPhysicalDeviceShaderIntegerDotProductProperties* in_struct, PNextCopyState* copy_state = {});
@@ -4462,6 +4935,9 @@ struct safe_VkPhysicalDeviceTexelBufferAlignmentProperties {
     safe_VkPhysicalDeviceTexelBufferAlignmentProperties(const safe_VkPhysicalDeviceTexelBufferAlignmentProperties& copy_src);
     safe_VkPhysicalDeviceTexelBufferAlignmentProperties& operator=(
         const safe_VkPhysicalDeviceTexelBufferAlignmentProperties& copy_src);
+    safe_VkPhysicalDeviceTexelBufferAlignmentProperties(safe_VkPhysicalDeviceTexelBufferAlignmentProperties&& move_src) noexcept;
+    safe_VkPhysicalDeviceTexelBufferAlignmentProperties& operator=(
+        safe_VkPhysicalDeviceTexelBufferAlignmentProperties&& move_src) noexcept;
     safe_VkPhysicalDeviceTexelBufferAlignmentProperties();
     ~safe_VkPhysicalDeviceTexelBufferAlignmentProperties();
     void initialize(const VkPhysicalDeviceTexelBufferAlignmentProperties* in_struct, PNextCopyState* copy_state = {});
@@ -4483,6 +4959,8 @@ struct safe_VkFormatProperties3 {
     safe_VkFormatProperties3(const VkFormatProperties3* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkFormatProperties3(const safe_VkFormatProperties3& copy_src);
     safe_VkFormatProperties3& operator=(const safe_VkFormatProperties3& copy_src);
+    safe_VkFormatProperties3(safe_VkFormatProperties3&& move_src) noexcept;
+    safe_VkFormatProperties3& operator=(safe_VkFormatProperties3&& move_src) noexcept;
     safe_VkFormatProperties3();
     ~safe_VkFormatProperties3();
     void initialize(const VkFormatProperties3* in_struct, PNextCopyState* copy_state = {});
@@ -4499,6 +4977,8 @@ struct safe_VkPhysicalDeviceMaintenance4Features {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMaintenance4Features(const safe_VkPhysicalDeviceMaintenance4Features& copy_src);
     safe_VkPhysicalDeviceMaintenance4Features& operator=(const safe_VkPhysicalDeviceMaintenance4Features& copy_src);
+    safe_VkPhysicalDeviceMaintenance4Features(safe_VkPhysicalDeviceMaintenance4Features&& move_src) noexcept;
+    safe_VkPhysicalDeviceMaintenance4Features& operator=(safe_VkPhysicalDeviceMaintenance4Features&& move_src) noexcept;
     safe_VkPhysicalDeviceMaintenance4Features();
     ~safe_VkPhysicalDeviceMaintenance4Features();
     void initialize(const VkPhysicalDeviceMaintenance4Features* in_struct, PNextCopyState* copy_state = {});
@@ -4517,6 +4997,8 @@ struct safe_VkPhysicalDeviceMaintenance4Properties {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMaintenance4Properties(const safe_VkPhysicalDeviceMaintenance4Properties& copy_src);
     safe_VkPhysicalDeviceMaintenance4Properties& operator=(const safe_VkPhysicalDeviceMaintenance4Properties& copy_src);
+    safe_VkPhysicalDeviceMaintenance4Properties(safe_VkPhysicalDeviceMaintenance4Properties&& move_src) noexcept;
+    safe_VkPhysicalDeviceMaintenance4Properties& operator=(safe_VkPhysicalDeviceMaintenance4Properties&& move_src) noexcept;
     safe_VkPhysicalDeviceMaintenance4Properties();
     ~safe_VkPhysicalDeviceMaintenance4Properties();
     void initialize(const VkPhysicalDeviceMaintenance4Properties* in_struct, PNextCopyState* copy_state = {});
@@ -4535,6 +5017,8 @@ struct safe_VkDeviceBufferMemoryRequirements {
                                           bool copy_pnext = true);
     safe_VkDeviceBufferMemoryRequirements(const safe_VkDeviceBufferMemoryRequirements& copy_src);
     safe_VkDeviceBufferMemoryRequirements& operator=(const safe_VkDeviceBufferMemoryRequirements& copy_src);
+    safe_VkDeviceBufferMemoryRequirements(safe_VkDeviceBufferMemoryRequirements&& move_src) noexcept;
+    safe_VkDeviceBufferMemoryRequirements& operator=(safe_VkDeviceBufferMemoryRequirements&& move_src) noexcept;
     safe_VkDeviceBufferMemoryRequirements();
     ~safe_VkDeviceBufferMemoryRequirements();
     void initialize(const VkDeviceBufferMemoryRequirements* in_struct, PNextCopyState* copy_state = {});
@@ -4552,6 +5036,8 @@ struct safe_VkDeviceImageMemoryRequirements {
                                          bool copy_pnext = true);
     safe_VkDeviceImageMemoryRequirements(const safe_VkDeviceImageMemoryRequirements& copy_src);
     safe_VkDeviceImageMemoryRequirements& operator=(const safe_VkDeviceImageMemoryRequirements& copy_src);
+    safe_VkDeviceImageMemoryRequirements(safe_VkDeviceImageMemoryRequirements&& move_src) noexcept;
+    safe_VkDeviceImageMemoryRequirements& operator=(safe_VkDeviceImageMemoryRequirements&& move_src) noexcept;
     safe_VkDeviceImageMemoryRequirements();
     ~safe_VkDeviceImageMemoryRequirements();
     void initialize(const VkDeviceImageMemoryRequirements* in_struct, PNextCopyState* copy_state = {});
@@ -4583,6 +5069,8 @@ struct safe_VkSwapchainCreateInfoKHR {
                                   bool copy_pnext = true);
     safe_VkSwapchainCreateInfoKHR(const safe_VkSwapchainCreateInfoKHR& copy_src);
     safe_VkSwapchainCreateInfoKHR& operator=(const safe_VkSwapchainCreateInfoKHR& copy_src);
+    safe_VkSwapchainCreateInfoKHR(safe_VkSwapchainCreateInfoKHR&& move_src) noexcept;
+    safe_VkSwapchainCreateInfoKHR& operator=(safe_VkSwapchainCreateInfoKHR&& move_src) noexcept;
     safe_VkSwapchainCreateInfoKHR();
     ~safe_VkSwapchainCreateInfoKHR();
     void initialize(const VkSwapchainCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4603,6 +5091,8 @@ struct safe_VkPresentInfoKHR {
     safe_VkPresentInfoKHR(const VkPresentInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPresentInfoKHR(const safe_VkPresentInfoKHR& copy_src);
     safe_VkPresentInfoKHR& operator=(const safe_VkPresentInfoKHR& copy_src);
+    safe_VkPresentInfoKHR(safe_VkPresentInfoKHR&& move_src) noexcept;
+    safe_VkPresentInfoKHR& operator=(safe_VkPresentInfoKHR&& move_src) noexcept;
     safe_VkPresentInfoKHR();
     ~safe_VkPresentInfoKHR();
     void initialize(const VkPresentInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4619,6 +5109,8 @@ struct safe_VkImageSwapchainCreateInfoKHR {
                                        bool copy_pnext = true);
     safe_VkImageSwapchainCreateInfoKHR(const safe_VkImageSwapchainCreateInfoKHR& copy_src);
     safe_VkImageSwapchainCreateInfoKHR& operator=(const safe_VkImageSwapchainCreateInfoKHR& copy_src);
+    safe_VkImageSwapchainCreateInfoKHR(safe_VkImageSwapchainCreateInfoKHR&& move_src) noexcept;
+    safe_VkImageSwapchainCreateInfoKHR& operator=(safe_VkImageSwapchainCreateInfoKHR&& move_src) noexcept;
     safe_VkImageSwapchainCreateInfoKHR();
     ~safe_VkImageSwapchainCreateInfoKHR();
     void initialize(const VkImageSwapchainCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4636,6 +5128,8 @@ struct safe_VkBindImageMemorySwapchainInfoKHR {
                                            bool copy_pnext = true);
     safe_VkBindImageMemorySwapchainInfoKHR(const safe_VkBindImageMemorySwapchainInfoKHR& copy_src);
     safe_VkBindImageMemorySwapchainInfoKHR& operator=(const safe_VkBindImageMemorySwapchainInfoKHR& copy_src);
+    safe_VkBindImageMemorySwapchainInfoKHR(safe_VkBindImageMemorySwapchainInfoKHR&& move_src) noexcept;
+    safe_VkBindImageMemorySwapchainInfoKHR& operator=(safe_VkBindImageMemorySwapchainInfoKHR&& move_src) noexcept;
     safe_VkBindImageMemorySwapchainInfoKHR();
     ~safe_VkBindImageMemorySwapchainInfoKHR();
     void initialize(const VkBindImageMemorySwapchainInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4658,6 +5152,8 @@ struct safe_VkAcquireNextImageInfoKHR {
                                    bool copy_pnext = true);
     safe_VkAcquireNextImageInfoKHR(const safe_VkAcquireNextImageInfoKHR& copy_src);
     safe_VkAcquireNextImageInfoKHR& operator=(const safe_VkAcquireNextImageInfoKHR& copy_src);
+    safe_VkAcquireNextImageInfoKHR(safe_VkAcquireNextImageInfoKHR&& move_src) noexcept;
+    safe_VkAcquireNextImageInfoKHR& operator=(safe_VkAcquireNextImageInfoKHR&& move_src) noexcept;
     safe_VkAcquireNextImageInfoKHR();
     ~safe_VkAcquireNextImageInfoKHR();
     void initialize(const VkAcquireNextImageInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4675,6 +5171,8 @@ struct safe_VkDeviceGroupPresentCapabilitiesKHR {
                                              bool copy_pnext = true);
     safe_VkDeviceGroupPresentCapabilitiesKHR(const safe_VkDeviceGroupPresentCapabilitiesKHR& copy_src);
     safe_VkDeviceGroupPresentCapabilitiesKHR& operator=(const safe_VkDeviceGroupPresentCapabilitiesKHR& copy_src);
+    safe_VkDeviceGroupPresentCapabilitiesKHR(safe_VkDeviceGroupPresentCapabilitiesKHR&& move_src) noexcept;
+    safe_VkDeviceGroupPresentCapabilitiesKHR& operator=(safe_VkDeviceGroupPresentCapabilitiesKHR&& move_src) noexcept;
     safe_VkDeviceGroupPresentCapabilitiesKHR();
     ~safe_VkDeviceGroupPresentCapabilitiesKHR();
     void initialize(const VkDeviceGroupPresentCapabilitiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4695,6 +5193,8 @@ struct safe_VkDeviceGroupPresentInfoKHR {
                                      bool copy_pnext = true);
     safe_VkDeviceGroupPresentInfoKHR(const safe_VkDeviceGroupPresentInfoKHR& copy_src);
     safe_VkDeviceGroupPresentInfoKHR& operator=(const safe_VkDeviceGroupPresentInfoKHR& copy_src);
+    safe_VkDeviceGroupPresentInfoKHR(safe_VkDeviceGroupPresentInfoKHR&& move_src) noexcept;
+    safe_VkDeviceGroupPresentInfoKHR& operator=(safe_VkDeviceGroupPresentInfoKHR&& move_src) noexcept;
     safe_VkDeviceGroupPresentInfoKHR();
     ~safe_VkDeviceGroupPresentInfoKHR();
     void initialize(const VkDeviceGroupPresentInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4711,6 +5211,8 @@ struct safe_VkDeviceGroupSwapchainCreateInfoKHR {
                                              bool copy_pnext = true);
     safe_VkDeviceGroupSwapchainCreateInfoKHR(const safe_VkDeviceGroupSwapchainCreateInfoKHR& copy_src);
     safe_VkDeviceGroupSwapchainCreateInfoKHR& operator=(const safe_VkDeviceGroupSwapchainCreateInfoKHR& copy_src);
+    safe_VkDeviceGroupSwapchainCreateInfoKHR(safe_VkDeviceGroupSwapchainCreateInfoKHR&& move_src) noexcept;
+    safe_VkDeviceGroupSwapchainCreateInfoKHR& operator=(safe_VkDeviceGroupSwapchainCreateInfoKHR&& move_src) noexcept;
     safe_VkDeviceGroupSwapchainCreateInfoKHR();
     ~safe_VkDeviceGroupSwapchainCreateInfoKHR();
     void initialize(const VkDeviceGroupSwapchainCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4730,6 +5232,8 @@ struct safe_VkDisplayModeCreateInfoKHR {
                                     bool copy_pnext = true);
     safe_VkDisplayModeCreateInfoKHR(const safe_VkDisplayModeCreateInfoKHR& copy_src);
     safe_VkDisplayModeCreateInfoKHR& operator=(const safe_VkDisplayModeCreateInfoKHR& copy_src);
+    safe_VkDisplayModeCreateInfoKHR(safe_VkDisplayModeCreateInfoKHR&& move_src) noexcept;
+    safe_VkDisplayModeCreateInfoKHR& operator=(safe_VkDisplayModeCreateInfoKHR&& move_src) noexcept;
     safe_VkDisplayModeCreateInfoKHR();
     ~safe_VkDisplayModeCreateInfoKHR();
     void initialize(const VkDisplayModeCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4749,6 +5253,8 @@ struct safe_VkDisplayPropertiesKHR {
     safe_VkDisplayPropertiesKHR(const VkDisplayPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
     safe_VkDisplayPropertiesKHR(const safe_VkDisplayPropertiesKHR& copy_src);
     safe_VkDisplayPropertiesKHR& operator=(const safe_VkDisplayPropertiesKHR& copy_src);
+    safe_VkDisplayPropertiesKHR(safe_VkDisplayPropertiesKHR&& move_src) noexcept;
+    safe_VkDisplayPropertiesKHR& operator=(safe_VkDisplayPropertiesKHR&& move_src) noexcept;
     safe_VkDisplayPropertiesKHR();
     ~safe_VkDisplayPropertiesKHR();
     void initialize(const VkDisplayPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4772,6 +5278,8 @@ struct safe_VkDisplaySurfaceCreateInfoKHR {
                                        bool copy_pnext = true);
     safe_VkDisplaySurfaceCreateInfoKHR(const safe_VkDisplaySurfaceCreateInfoKHR& copy_src);
     safe_VkDisplaySurfaceCreateInfoKHR& operator=(const safe_VkDisplaySurfaceCreateInfoKHR& copy_src);
+    safe_VkDisplaySurfaceCreateInfoKHR(safe_VkDisplaySurfaceCreateInfoKHR&& move_src) noexcept;
+    safe_VkDisplaySurfaceCreateInfoKHR& operator=(safe_VkDisplaySurfaceCreateInfoKHR&& move_src) noexcept;
     safe_VkDisplaySurfaceCreateInfoKHR();
     ~safe_VkDisplaySurfaceCreateInfoKHR();
     void initialize(const VkDisplaySurfaceCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4789,6 +5297,8 @@ struct safe_VkDisplayPresentInfoKHR {
     safe_VkDisplayPresentInfoKHR(const VkDisplayPresentInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDisplayPresentInfoKHR(const safe_VkDisplayPresentInfoKHR& copy_src);
     safe_VkDisplayPresentInfoKHR& operator=(const safe_VkDisplayPresentInfoKHR& copy_src);
+    safe_VkDisplayPresentInfoKHR(safe_VkDisplayPresentInfoKHR&& move_src) noexcept;
+    safe_VkDisplayPresentInfoKHR& operator=(safe_VkDisplayPresentInfoKHR&& move_src) noexcept;
     safe_VkDisplayPresentInfoKHR();
     ~safe_VkDisplayPresentInfoKHR();
     void initialize(const VkDisplayPresentInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4808,6 +5318,8 @@ struct safe_VkXlibSurfaceCreateInfoKHR {
                                     bool copy_pnext = true);
     safe_VkXlibSurfaceCreateInfoKHR(const safe_VkXlibSurfaceCreateInfoKHR& copy_src);
     safe_VkXlibSurfaceCreateInfoKHR& operator=(const safe_VkXlibSurfaceCreateInfoKHR& copy_src);
+    safe_VkXlibSurfaceCreateInfoKHR(safe_VkXlibSurfaceCreateInfoKHR&& move_src) noexcept;
+    safe_VkXlibSurfaceCreateInfoKHR& operator=(safe_VkXlibSurfaceCreateInfoKHR&& move_src) noexcept;
     safe_VkXlibSurfaceCreateInfoKHR();
     ~safe_VkXlibSurfaceCreateInfoKHR();
     void initialize(const VkXlibSurfaceCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4828,6 +5340,8 @@ struct safe_VkXcbSurfaceCreateInfoKHR {
                                    bool copy_pnext = true);
     safe_VkXcbSurfaceCreateInfoKHR(const safe_VkXcbSurfaceCreateInfoKHR& copy_src);
     safe_VkXcbSurfaceCreateInfoKHR& operator=(const safe_VkXcbSurfaceCreateInfoKHR& copy_src);
+    safe_VkXcbSurfaceCreateInfoKHR(safe_VkXcbSurfaceCreateInfoKHR&& move_src) noexcept;
+    safe_VkXcbSurfaceCreateInfoKHR& operator=(safe_VkXcbSurfaceCreateInfoKHR&& move_src) noexcept;
     safe_VkXcbSurfaceCreateInfoKHR();
     ~safe_VkXcbSurfaceCreateInfoKHR();
     void initialize(const VkXcbSurfaceCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4848,6 +5362,8 @@ struct safe_VkWaylandSurfaceCreateInfoKHR {
                                        bool copy_pnext = true);
     safe_VkWaylandSurfaceCreateInfoKHR(const safe_VkWaylandSurfaceCreateInfoKHR& copy_src);
     safe_VkWaylandSurfaceCreateInfoKHR& operator=(const safe_VkWaylandSurfaceCreateInfoKHR& copy_src);
+    safe_VkWaylandSurfaceCreateInfoKHR(safe_VkWaylandSurfaceCreateInfoKHR&& move_src) noexcept;
+    safe_VkWaylandSurfaceCreateInfoKHR& operator=(safe_VkWaylandSurfaceCreateInfoKHR&& move_src) noexcept;
     safe_VkWaylandSurfaceCreateInfoKHR();
     ~safe_VkWaylandSurfaceCreateInfoKHR();
     void initialize(const VkWaylandSurfaceCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4867,6 +5383,8 @@ struct safe_VkAndroidSurfaceCreateInfoKHR {
                                        bool copy_pnext = true);
     safe_VkAndroidSurfaceCreateInfoKHR(const safe_VkAndroidSurfaceCreateInfoKHR& copy_src);
     safe_VkAndroidSurfaceCreateInfoKHR& operator=(const safe_VkAndroidSurfaceCreateInfoKHR& copy_src);
+    safe_VkAndroidSurfaceCreateInfoKHR(safe_VkAndroidSurfaceCreateInfoKHR&& move_src) noexcept;
+    safe_VkAndroidSurfaceCreateInfoKHR& operator=(safe_VkAndroidSurfaceCreateInfoKHR&& move_src) noexcept;
     safe_VkAndroidSurfaceCreateInfoKHR();
     ~safe_VkAndroidSurfaceCreateInfoKHR();
     void initialize(const VkAndroidSurfaceCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4887,6 +5405,8 @@ struct safe_VkWin32SurfaceCreateInfoKHR {
                                      bool copy_pnext = true);
     safe_VkWin32SurfaceCreateInfoKHR(const safe_VkWin32SurfaceCreateInfoKHR& copy_src);
     safe_VkWin32SurfaceCreateInfoKHR& operator=(const safe_VkWin32SurfaceCreateInfoKHR& copy_src);
+    safe_VkWin32SurfaceCreateInfoKHR(safe_VkWin32SurfaceCreateInfoKHR&& move_src) noexcept;
+    safe_VkWin32SurfaceCreateInfoKHR& operator=(safe_VkWin32SurfaceCreateInfoKHR&& move_src) noexcept;
     safe_VkWin32SurfaceCreateInfoKHR();
     ~safe_VkWin32SurfaceCreateInfoKHR();
     void initialize(const VkWin32SurfaceCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4904,6 +5424,9 @@ struct safe_VkQueueFamilyQueryResultStatusPropertiesKHR {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkQueueFamilyQueryResultStatusPropertiesKHR(const safe_VkQueueFamilyQueryResultStatusPropertiesKHR& copy_src);
     safe_VkQueueFamilyQueryResultStatusPropertiesKHR& operator=(const safe_VkQueueFamilyQueryResultStatusPropertiesKHR& copy_src);
+    safe_VkQueueFamilyQueryResultStatusPropertiesKHR(safe_VkQueueFamilyQueryResultStatusPropertiesKHR&& move_src) noexcept;
+    safe_VkQueueFamilyQueryResultStatusPropertiesKHR& operator=(
+        safe_VkQueueFamilyQueryResultStatusPropertiesKHR&& move_src) noexcept;
     safe_VkQueueFamilyQueryResultStatusPropertiesKHR();
     ~safe_VkQueueFamilyQueryResultStatusPropertiesKHR();
     void initialize(const VkQueueFamilyQueryResultStatusPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4924,6 +5447,8 @@ struct safe_VkQueueFamilyVideoPropertiesKHR {
                                          bool copy_pnext = true);
     safe_VkQueueFamilyVideoPropertiesKHR(const safe_VkQueueFamilyVideoPropertiesKHR& copy_src);
     safe_VkQueueFamilyVideoPropertiesKHR& operator=(const safe_VkQueueFamilyVideoPropertiesKHR& copy_src);
+    safe_VkQueueFamilyVideoPropertiesKHR(safe_VkQueueFamilyVideoPropertiesKHR&& move_src) noexcept;
+    safe_VkQueueFamilyVideoPropertiesKHR& operator=(safe_VkQueueFamilyVideoPropertiesKHR&& move_src) noexcept;
     safe_VkQueueFamilyVideoPropertiesKHR();
     ~safe_VkQueueFamilyVideoPropertiesKHR();
     void initialize(const VkQueueFamilyVideoPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4942,6 +5467,8 @@ struct safe_VkVideoProfileInfoKHR {
     safe_VkVideoProfileInfoKHR(const VkVideoProfileInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoProfileInfoKHR(const safe_VkVideoProfileInfoKHR& copy_src);
     safe_VkVideoProfileInfoKHR& operator=(const safe_VkVideoProfileInfoKHR& copy_src);
+    safe_VkVideoProfileInfoKHR(safe_VkVideoProfileInfoKHR&& move_src) noexcept;
+    safe_VkVideoProfileInfoKHR& operator=(safe_VkVideoProfileInfoKHR&& move_src) noexcept;
     safe_VkVideoProfileInfoKHR();
     ~safe_VkVideoProfileInfoKHR();
     void initialize(const VkVideoProfileInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4959,6 +5486,8 @@ struct safe_VkVideoProfileListInfoKHR {
                                    bool copy_pnext = true);
     safe_VkVideoProfileListInfoKHR(const safe_VkVideoProfileListInfoKHR& copy_src);
     safe_VkVideoProfileListInfoKHR& operator=(const safe_VkVideoProfileListInfoKHR& copy_src);
+    safe_VkVideoProfileListInfoKHR(safe_VkVideoProfileListInfoKHR&& move_src) noexcept;
+    safe_VkVideoProfileListInfoKHR& operator=(safe_VkVideoProfileListInfoKHR&& move_src) noexcept;
     safe_VkVideoProfileListInfoKHR();
     ~safe_VkVideoProfileListInfoKHR();
     void initialize(const VkVideoProfileListInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4982,6 +5511,8 @@ struct safe_VkVideoCapabilitiesKHR {
     safe_VkVideoCapabilitiesKHR(const VkVideoCapabilitiesKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoCapabilitiesKHR(const safe_VkVideoCapabilitiesKHR& copy_src);
     safe_VkVideoCapabilitiesKHR& operator=(const safe_VkVideoCapabilitiesKHR& copy_src);
+    safe_VkVideoCapabilitiesKHR(safe_VkVideoCapabilitiesKHR&& move_src) noexcept;
+    safe_VkVideoCapabilitiesKHR& operator=(safe_VkVideoCapabilitiesKHR&& move_src) noexcept;
     safe_VkVideoCapabilitiesKHR();
     ~safe_VkVideoCapabilitiesKHR();
     void initialize(const VkVideoCapabilitiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -4998,6 +5529,8 @@ struct safe_VkPhysicalDeviceVideoFormatInfoKHR {
                                             bool copy_pnext = true);
     safe_VkPhysicalDeviceVideoFormatInfoKHR(const safe_VkPhysicalDeviceVideoFormatInfoKHR& copy_src);
     safe_VkPhysicalDeviceVideoFormatInfoKHR& operator=(const safe_VkPhysicalDeviceVideoFormatInfoKHR& copy_src);
+    safe_VkPhysicalDeviceVideoFormatInfoKHR(safe_VkPhysicalDeviceVideoFormatInfoKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceVideoFormatInfoKHR& operator=(safe_VkPhysicalDeviceVideoFormatInfoKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceVideoFormatInfoKHR();
     ~safe_VkPhysicalDeviceVideoFormatInfoKHR();
     void initialize(const VkPhysicalDeviceVideoFormatInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5021,6 +5554,8 @@ struct safe_VkVideoFormatPropertiesKHR {
                                     bool copy_pnext = true);
     safe_VkVideoFormatPropertiesKHR(const safe_VkVideoFormatPropertiesKHR& copy_src);
     safe_VkVideoFormatPropertiesKHR& operator=(const safe_VkVideoFormatPropertiesKHR& copy_src);
+    safe_VkVideoFormatPropertiesKHR(safe_VkVideoFormatPropertiesKHR&& move_src) noexcept;
+    safe_VkVideoFormatPropertiesKHR& operator=(safe_VkVideoFormatPropertiesKHR&& move_src) noexcept;
     safe_VkVideoFormatPropertiesKHR();
     ~safe_VkVideoFormatPropertiesKHR();
     void initialize(const VkVideoFormatPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5040,6 +5575,8 @@ struct safe_VkVideoPictureResourceInfoKHR {
                                        bool copy_pnext = true);
     safe_VkVideoPictureResourceInfoKHR(const safe_VkVideoPictureResourceInfoKHR& copy_src);
     safe_VkVideoPictureResourceInfoKHR& operator=(const safe_VkVideoPictureResourceInfoKHR& copy_src);
+    safe_VkVideoPictureResourceInfoKHR(safe_VkVideoPictureResourceInfoKHR&& move_src) noexcept;
+    safe_VkVideoPictureResourceInfoKHR& operator=(safe_VkVideoPictureResourceInfoKHR&& move_src) noexcept;
     safe_VkVideoPictureResourceInfoKHR();
     ~safe_VkVideoPictureResourceInfoKHR();
     void initialize(const VkVideoPictureResourceInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5057,6 +5594,8 @@ struct safe_VkVideoReferenceSlotInfoKHR {
                                      bool copy_pnext = true);
     safe_VkVideoReferenceSlotInfoKHR(const safe_VkVideoReferenceSlotInfoKHR& copy_src);
     safe_VkVideoReferenceSlotInfoKHR& operator=(const safe_VkVideoReferenceSlotInfoKHR& copy_src);
+    safe_VkVideoReferenceSlotInfoKHR(safe_VkVideoReferenceSlotInfoKHR&& move_src) noexcept;
+    safe_VkVideoReferenceSlotInfoKHR& operator=(safe_VkVideoReferenceSlotInfoKHR&& move_src) noexcept;
     safe_VkVideoReferenceSlotInfoKHR();
     ~safe_VkVideoReferenceSlotInfoKHR();
     void initialize(const VkVideoReferenceSlotInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5074,6 +5613,8 @@ struct safe_VkVideoSessionMemoryRequirementsKHR {
                                              bool copy_pnext = true);
     safe_VkVideoSessionMemoryRequirementsKHR(const safe_VkVideoSessionMemoryRequirementsKHR& copy_src);
     safe_VkVideoSessionMemoryRequirementsKHR& operator=(const safe_VkVideoSessionMemoryRequirementsKHR& copy_src);
+    safe_VkVideoSessionMemoryRequirementsKHR(safe_VkVideoSessionMemoryRequirementsKHR&& move_src) noexcept;
+    safe_VkVideoSessionMemoryRequirementsKHR& operator=(safe_VkVideoSessionMemoryRequirementsKHR&& move_src) noexcept;
     safe_VkVideoSessionMemoryRequirementsKHR();
     ~safe_VkVideoSessionMemoryRequirementsKHR();
     void initialize(const VkVideoSessionMemoryRequirementsKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5095,6 +5636,8 @@ struct safe_VkBindVideoSessionMemoryInfoKHR {
                                          bool copy_pnext = true);
     safe_VkBindVideoSessionMemoryInfoKHR(const safe_VkBindVideoSessionMemoryInfoKHR& copy_src);
     safe_VkBindVideoSessionMemoryInfoKHR& operator=(const safe_VkBindVideoSessionMemoryInfoKHR& copy_src);
+    safe_VkBindVideoSessionMemoryInfoKHR(safe_VkBindVideoSessionMemoryInfoKHR&& move_src) noexcept;
+    safe_VkBindVideoSessionMemoryInfoKHR& operator=(safe_VkBindVideoSessionMemoryInfoKHR&& move_src) noexcept;
     safe_VkBindVideoSessionMemoryInfoKHR();
     ~safe_VkBindVideoSessionMemoryInfoKHR();
     void initialize(const VkBindVideoSessionMemoryInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5119,6 +5662,8 @@ struct safe_VkVideoSessionCreateInfoKHR {
                                      bool copy_pnext = true);
     safe_VkVideoSessionCreateInfoKHR(const safe_VkVideoSessionCreateInfoKHR& copy_src);
     safe_VkVideoSessionCreateInfoKHR& operator=(const safe_VkVideoSessionCreateInfoKHR& copy_src);
+    safe_VkVideoSessionCreateInfoKHR(safe_VkVideoSessionCreateInfoKHR&& move_src) noexcept;
+    safe_VkVideoSessionCreateInfoKHR& operator=(safe_VkVideoSessionCreateInfoKHR&& move_src) noexcept;
     safe_VkVideoSessionCreateInfoKHR();
     ~safe_VkVideoSessionCreateInfoKHR();
     void initialize(const VkVideoSessionCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5137,6 +5682,8 @@ struct safe_VkVideoSessionParametersCreateInfoKHR {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoSessionParametersCreateInfoKHR(const safe_VkVideoSessionParametersCreateInfoKHR& copy_src);
     safe_VkVideoSessionParametersCreateInfoKHR& operator=(const safe_VkVideoSessionParametersCreateInfoKHR& copy_src);
+    safe_VkVideoSessionParametersCreateInfoKHR(safe_VkVideoSessionParametersCreateInfoKHR&& move_src) noexcept;
+    safe_VkVideoSessionParametersCreateInfoKHR& operator=(safe_VkVideoSessionParametersCreateInfoKHR&& move_src) noexcept;
     safe_VkVideoSessionParametersCreateInfoKHR();
     ~safe_VkVideoSessionParametersCreateInfoKHR();
     void initialize(const VkVideoSessionParametersCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5155,6 +5702,8 @@ struct safe_VkVideoSessionParametersUpdateInfoKHR {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoSessionParametersUpdateInfoKHR(const safe_VkVideoSessionParametersUpdateInfoKHR& copy_src);
     safe_VkVideoSessionParametersUpdateInfoKHR& operator=(const safe_VkVideoSessionParametersUpdateInfoKHR& copy_src);
+    safe_VkVideoSessionParametersUpdateInfoKHR(safe_VkVideoSessionParametersUpdateInfoKHR&& move_src) noexcept;
+    safe_VkVideoSessionParametersUpdateInfoKHR& operator=(safe_VkVideoSessionParametersUpdateInfoKHR&& move_src) noexcept;
     safe_VkVideoSessionParametersUpdateInfoKHR();
     ~safe_VkVideoSessionParametersUpdateInfoKHR();
     void initialize(const VkVideoSessionParametersUpdateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5177,6 +5726,8 @@ struct safe_VkVideoBeginCodingInfoKHR {
                                    bool copy_pnext = true);
     safe_VkVideoBeginCodingInfoKHR(const safe_VkVideoBeginCodingInfoKHR& copy_src);
     safe_VkVideoBeginCodingInfoKHR& operator=(const safe_VkVideoBeginCodingInfoKHR& copy_src);
+    safe_VkVideoBeginCodingInfoKHR(safe_VkVideoBeginCodingInfoKHR&& move_src) noexcept;
+    safe_VkVideoBeginCodingInfoKHR& operator=(safe_VkVideoBeginCodingInfoKHR&& move_src) noexcept;
     safe_VkVideoBeginCodingInfoKHR();
     ~safe_VkVideoBeginCodingInfoKHR();
     void initialize(const VkVideoBeginCodingInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5192,6 +5743,8 @@ struct safe_VkVideoEndCodingInfoKHR {
     safe_VkVideoEndCodingInfoKHR(const VkVideoEndCodingInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEndCodingInfoKHR(const safe_VkVideoEndCodingInfoKHR& copy_src);
     safe_VkVideoEndCodingInfoKHR& operator=(const safe_VkVideoEndCodingInfoKHR& copy_src);
+    safe_VkVideoEndCodingInfoKHR(safe_VkVideoEndCodingInfoKHR&& move_src) noexcept;
+    safe_VkVideoEndCodingInfoKHR& operator=(safe_VkVideoEndCodingInfoKHR&& move_src) noexcept;
     safe_VkVideoEndCodingInfoKHR();
     ~safe_VkVideoEndCodingInfoKHR();
     void initialize(const VkVideoEndCodingInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5208,6 +5761,8 @@ struct safe_VkVideoCodingControlInfoKHR {
                                      bool copy_pnext = true);
     safe_VkVideoCodingControlInfoKHR(const safe_VkVideoCodingControlInfoKHR& copy_src);
     safe_VkVideoCodingControlInfoKHR& operator=(const safe_VkVideoCodingControlInfoKHR& copy_src);
+    safe_VkVideoCodingControlInfoKHR(safe_VkVideoCodingControlInfoKHR&& move_src) noexcept;
+    safe_VkVideoCodingControlInfoKHR& operator=(safe_VkVideoCodingControlInfoKHR&& move_src) noexcept;
     safe_VkVideoCodingControlInfoKHR();
     ~safe_VkVideoCodingControlInfoKHR();
     void initialize(const VkVideoCodingControlInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5224,6 +5779,8 @@ struct safe_VkVideoDecodeCapabilitiesKHR {
                                       bool copy_pnext = true);
     safe_VkVideoDecodeCapabilitiesKHR(const safe_VkVideoDecodeCapabilitiesKHR& copy_src);
     safe_VkVideoDecodeCapabilitiesKHR& operator=(const safe_VkVideoDecodeCapabilitiesKHR& copy_src);
+    safe_VkVideoDecodeCapabilitiesKHR(safe_VkVideoDecodeCapabilitiesKHR&& move_src) noexcept;
+    safe_VkVideoDecodeCapabilitiesKHR& operator=(safe_VkVideoDecodeCapabilitiesKHR&& move_src) noexcept;
     safe_VkVideoDecodeCapabilitiesKHR();
     ~safe_VkVideoDecodeCapabilitiesKHR();
     void initialize(const VkVideoDecodeCapabilitiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5240,6 +5797,8 @@ struct safe_VkVideoDecodeUsageInfoKHR {
                                    bool copy_pnext = true);
     safe_VkVideoDecodeUsageInfoKHR(const safe_VkVideoDecodeUsageInfoKHR& copy_src);
     safe_VkVideoDecodeUsageInfoKHR& operator=(const safe_VkVideoDecodeUsageInfoKHR& copy_src);
+    safe_VkVideoDecodeUsageInfoKHR(safe_VkVideoDecodeUsageInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeUsageInfoKHR& operator=(safe_VkVideoDecodeUsageInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeUsageInfoKHR();
     ~safe_VkVideoDecodeUsageInfoKHR();
     void initialize(const VkVideoDecodeUsageInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5262,6 +5821,8 @@ struct safe_VkVideoDecodeInfoKHR {
     safe_VkVideoDecodeInfoKHR(const VkVideoDecodeInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoDecodeInfoKHR(const safe_VkVideoDecodeInfoKHR& copy_src);
     safe_VkVideoDecodeInfoKHR& operator=(const safe_VkVideoDecodeInfoKHR& copy_src);
+    safe_VkVideoDecodeInfoKHR(safe_VkVideoDecodeInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeInfoKHR& operator=(safe_VkVideoDecodeInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeInfoKHR();
     ~safe_VkVideoDecodeInfoKHR();
     void initialize(const VkVideoDecodeInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5290,6 +5851,8 @@ struct safe_VkVideoEncodeH264CapabilitiesKHR {
                                           bool copy_pnext = true);
     safe_VkVideoEncodeH264CapabilitiesKHR(const safe_VkVideoEncodeH264CapabilitiesKHR& copy_src);
     safe_VkVideoEncodeH264CapabilitiesKHR& operator=(const safe_VkVideoEncodeH264CapabilitiesKHR& copy_src);
+    safe_VkVideoEncodeH264CapabilitiesKHR(safe_VkVideoEncodeH264CapabilitiesKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264CapabilitiesKHR& operator=(safe_VkVideoEncodeH264CapabilitiesKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264CapabilitiesKHR();
     ~safe_VkVideoEncodeH264CapabilitiesKHR();
     void initialize(const VkVideoEncodeH264CapabilitiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5314,6 +5877,8 @@ struct safe_VkVideoEncodeH264QualityLevelPropertiesKHR {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH264QualityLevelPropertiesKHR(const safe_VkVideoEncodeH264QualityLevelPropertiesKHR& copy_src);
     safe_VkVideoEncodeH264QualityLevelPropertiesKHR& operator=(const safe_VkVideoEncodeH264QualityLevelPropertiesKHR& copy_src);
+    safe_VkVideoEncodeH264QualityLevelPropertiesKHR(safe_VkVideoEncodeH264QualityLevelPropertiesKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264QualityLevelPropertiesKHR& operator=(safe_VkVideoEncodeH264QualityLevelPropertiesKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264QualityLevelPropertiesKHR();
     ~safe_VkVideoEncodeH264QualityLevelPropertiesKHR();
     void initialize(const VkVideoEncodeH264QualityLevelPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5335,6 +5900,8 @@ struct safe_VkVideoEncodeH264SessionCreateInfoKHR {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH264SessionCreateInfoKHR(const safe_VkVideoEncodeH264SessionCreateInfoKHR& copy_src);
     safe_VkVideoEncodeH264SessionCreateInfoKHR& operator=(const safe_VkVideoEncodeH264SessionCreateInfoKHR& copy_src);
+    safe_VkVideoEncodeH264SessionCreateInfoKHR(safe_VkVideoEncodeH264SessionCreateInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264SessionCreateInfoKHR& operator=(safe_VkVideoEncodeH264SessionCreateInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264SessionCreateInfoKHR();
     ~safe_VkVideoEncodeH264SessionCreateInfoKHR();
     void initialize(const VkVideoEncodeH264SessionCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5356,6 +5923,9 @@ struct safe_VkVideoEncodeH264SessionParametersAddInfoKHR {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH264SessionParametersAddInfoKHR(const safe_VkVideoEncodeH264SessionParametersAddInfoKHR& copy_src);
     safe_VkVideoEncodeH264SessionParametersAddInfoKHR& operator=(const safe_VkVideoEncodeH264SessionParametersAddInfoKHR& copy_src);
+    safe_VkVideoEncodeH264SessionParametersAddInfoKHR(safe_VkVideoEncodeH264SessionParametersAddInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264SessionParametersAddInfoKHR& operator=(
+        safe_VkVideoEncodeH264SessionParametersAddInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264SessionParametersAddInfoKHR();
     ~safe_VkVideoEncodeH264SessionParametersAddInfoKHR();
     void initialize(const VkVideoEncodeH264SessionParametersAddInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5379,6 +5949,9 @@ struct safe_VkVideoEncodeH264SessionParametersCreateInfoKHR {
     safe_VkVideoEncodeH264SessionParametersCreateInfoKHR(const safe_VkVideoEncodeH264SessionParametersCreateInfoKHR& copy_src);
     safe_VkVideoEncodeH264SessionParametersCreateInfoKHR& operator=(
         const safe_VkVideoEncodeH264SessionParametersCreateInfoKHR& copy_src);
+    safe_VkVideoEncodeH264SessionParametersCreateInfoKHR(safe_VkVideoEncodeH264SessionParametersCreateInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264SessionParametersCreateInfoKHR& operator=(
+        safe_VkVideoEncodeH264SessionParametersCreateInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264SessionParametersCreateInfoKHR();
     ~safe_VkVideoEncodeH264SessionParametersCreateInfoKHR();
     void initialize(const VkVideoEncodeH264SessionParametersCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5402,6 +5975,9 @@ struct safe_VkVideoEncodeH264SessionParametersGetInfoKHR {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH264SessionParametersGetInfoKHR(const safe_VkVideoEncodeH264SessionParametersGetInfoKHR& copy_src);
     safe_VkVideoEncodeH264SessionParametersGetInfoKHR& operator=(const safe_VkVideoEncodeH264SessionParametersGetInfoKHR& copy_src);
+    safe_VkVideoEncodeH264SessionParametersGetInfoKHR(safe_VkVideoEncodeH264SessionParametersGetInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264SessionParametersGetInfoKHR& operator=(
+        safe_VkVideoEncodeH264SessionParametersGetInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264SessionParametersGetInfoKHR();
     ~safe_VkVideoEncodeH264SessionParametersGetInfoKHR();
     void initialize(const VkVideoEncodeH264SessionParametersGetInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5424,6 +6000,10 @@ struct safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR {
     safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR(const safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR& copy_src);
     safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR& operator=(
         const safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR& copy_src);
+    safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR(
+        safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR& operator=(
+        safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR();
     ~safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR();
     void initialize(const VkVideoEncodeH264SessionParametersFeedbackInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5445,6 +6025,8 @@ struct safe_VkVideoEncodeH264NaluSliceInfoKHR {
                                            bool copy_pnext = true);
     safe_VkVideoEncodeH264NaluSliceInfoKHR(const safe_VkVideoEncodeH264NaluSliceInfoKHR& copy_src);
     safe_VkVideoEncodeH264NaluSliceInfoKHR& operator=(const safe_VkVideoEncodeH264NaluSliceInfoKHR& copy_src);
+    safe_VkVideoEncodeH264NaluSliceInfoKHR(safe_VkVideoEncodeH264NaluSliceInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264NaluSliceInfoKHR& operator=(safe_VkVideoEncodeH264NaluSliceInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264NaluSliceInfoKHR();
     ~safe_VkVideoEncodeH264NaluSliceInfoKHR();
     void initialize(const VkVideoEncodeH264NaluSliceInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5466,6 +6048,8 @@ struct safe_VkVideoEncodeH264PictureInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoEncodeH264PictureInfoKHR(const safe_VkVideoEncodeH264PictureInfoKHR& copy_src);
     safe_VkVideoEncodeH264PictureInfoKHR& operator=(const safe_VkVideoEncodeH264PictureInfoKHR& copy_src);
+    safe_VkVideoEncodeH264PictureInfoKHR(safe_VkVideoEncodeH264PictureInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264PictureInfoKHR& operator=(safe_VkVideoEncodeH264PictureInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264PictureInfoKHR();
     ~safe_VkVideoEncodeH264PictureInfoKHR();
     void initialize(const VkVideoEncodeH264PictureInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5482,6 +6066,8 @@ struct safe_VkVideoEncodeH264DpbSlotInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoEncodeH264DpbSlotInfoKHR(const safe_VkVideoEncodeH264DpbSlotInfoKHR& copy_src);
     safe_VkVideoEncodeH264DpbSlotInfoKHR& operator=(const safe_VkVideoEncodeH264DpbSlotInfoKHR& copy_src);
+    safe_VkVideoEncodeH264DpbSlotInfoKHR(safe_VkVideoEncodeH264DpbSlotInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264DpbSlotInfoKHR& operator=(safe_VkVideoEncodeH264DpbSlotInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264DpbSlotInfoKHR();
     ~safe_VkVideoEncodeH264DpbSlotInfoKHR();
     void initialize(const VkVideoEncodeH264DpbSlotInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5498,6 +6084,8 @@ struct safe_VkVideoEncodeH264ProfileInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoEncodeH264ProfileInfoKHR(const safe_VkVideoEncodeH264ProfileInfoKHR& copy_src);
     safe_VkVideoEncodeH264ProfileInfoKHR& operator=(const safe_VkVideoEncodeH264ProfileInfoKHR& copy_src);
+    safe_VkVideoEncodeH264ProfileInfoKHR(safe_VkVideoEncodeH264ProfileInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264ProfileInfoKHR& operator=(safe_VkVideoEncodeH264ProfileInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264ProfileInfoKHR();
     ~safe_VkVideoEncodeH264ProfileInfoKHR();
     void initialize(const VkVideoEncodeH264ProfileInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5518,6 +6106,8 @@ struct safe_VkVideoEncodeH264RateControlInfoKHR {
                                              bool copy_pnext = true);
     safe_VkVideoEncodeH264RateControlInfoKHR(const safe_VkVideoEncodeH264RateControlInfoKHR& copy_src);
     safe_VkVideoEncodeH264RateControlInfoKHR& operator=(const safe_VkVideoEncodeH264RateControlInfoKHR& copy_src);
+    safe_VkVideoEncodeH264RateControlInfoKHR(safe_VkVideoEncodeH264RateControlInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264RateControlInfoKHR& operator=(safe_VkVideoEncodeH264RateControlInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264RateControlInfoKHR();
     ~safe_VkVideoEncodeH264RateControlInfoKHR();
     void initialize(const VkVideoEncodeH264RateControlInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5541,6 +6131,8 @@ struct safe_VkVideoEncodeH264RateControlLayerInfoKHR {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH264RateControlLayerInfoKHR(const safe_VkVideoEncodeH264RateControlLayerInfoKHR& copy_src);
     safe_VkVideoEncodeH264RateControlLayerInfoKHR& operator=(const safe_VkVideoEncodeH264RateControlLayerInfoKHR& copy_src);
+    safe_VkVideoEncodeH264RateControlLayerInfoKHR(safe_VkVideoEncodeH264RateControlLayerInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264RateControlLayerInfoKHR& operator=(safe_VkVideoEncodeH264RateControlLayerInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264RateControlLayerInfoKHR();
     ~safe_VkVideoEncodeH264RateControlLayerInfoKHR();
     void initialize(const VkVideoEncodeH264RateControlLayerInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5562,6 +6154,8 @@ struct safe_VkVideoEncodeH264GopRemainingFrameInfoKHR {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH264GopRemainingFrameInfoKHR(const safe_VkVideoEncodeH264GopRemainingFrameInfoKHR& copy_src);
     safe_VkVideoEncodeH264GopRemainingFrameInfoKHR& operator=(const safe_VkVideoEncodeH264GopRemainingFrameInfoKHR& copy_src);
+    safe_VkVideoEncodeH264GopRemainingFrameInfoKHR(safe_VkVideoEncodeH264GopRemainingFrameInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH264GopRemainingFrameInfoKHR& operator=(safe_VkVideoEncodeH264GopRemainingFrameInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH264GopRemainingFrameInfoKHR();
     ~safe_VkVideoEncodeH264GopRemainingFrameInfoKHR();
     void initialize(const VkVideoEncodeH264GopRemainingFrameInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5595,6 +6189,8 @@ struct safe_VkVideoEncodeH265CapabilitiesKHR {
                                           bool copy_pnext = true);
     safe_VkVideoEncodeH265CapabilitiesKHR(const safe_VkVideoEncodeH265CapabilitiesKHR& copy_src);
     safe_VkVideoEncodeH265CapabilitiesKHR& operator=(const safe_VkVideoEncodeH265CapabilitiesKHR& copy_src);
+    safe_VkVideoEncodeH265CapabilitiesKHR(safe_VkVideoEncodeH265CapabilitiesKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265CapabilitiesKHR& operator=(safe_VkVideoEncodeH265CapabilitiesKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265CapabilitiesKHR();
     ~safe_VkVideoEncodeH265CapabilitiesKHR();
     void initialize(const VkVideoEncodeH265CapabilitiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5612,6 +6208,8 @@ struct safe_VkVideoEncodeH265SessionCreateInfoKHR {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH265SessionCreateInfoKHR(const safe_VkVideoEncodeH265SessionCreateInfoKHR& copy_src);
     safe_VkVideoEncodeH265SessionCreateInfoKHR& operator=(const safe_VkVideoEncodeH265SessionCreateInfoKHR& copy_src);
+    safe_VkVideoEncodeH265SessionCreateInfoKHR(safe_VkVideoEncodeH265SessionCreateInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265SessionCreateInfoKHR& operator=(safe_VkVideoEncodeH265SessionCreateInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265SessionCreateInfoKHR();
     ~safe_VkVideoEncodeH265SessionCreateInfoKHR();
     void initialize(const VkVideoEncodeH265SessionCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5637,6 +6235,8 @@ struct safe_VkVideoEncodeH265QualityLevelPropertiesKHR {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH265QualityLevelPropertiesKHR(const safe_VkVideoEncodeH265QualityLevelPropertiesKHR& copy_src);
     safe_VkVideoEncodeH265QualityLevelPropertiesKHR& operator=(const safe_VkVideoEncodeH265QualityLevelPropertiesKHR& copy_src);
+    safe_VkVideoEncodeH265QualityLevelPropertiesKHR(safe_VkVideoEncodeH265QualityLevelPropertiesKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265QualityLevelPropertiesKHR& operator=(safe_VkVideoEncodeH265QualityLevelPropertiesKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265QualityLevelPropertiesKHR();
     ~safe_VkVideoEncodeH265QualityLevelPropertiesKHR();
     void initialize(const VkVideoEncodeH265QualityLevelPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5662,6 +6262,9 @@ struct safe_VkVideoEncodeH265SessionParametersAddInfoKHR {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH265SessionParametersAddInfoKHR(const safe_VkVideoEncodeH265SessionParametersAddInfoKHR& copy_src);
     safe_VkVideoEncodeH265SessionParametersAddInfoKHR& operator=(const safe_VkVideoEncodeH265SessionParametersAddInfoKHR& copy_src);
+    safe_VkVideoEncodeH265SessionParametersAddInfoKHR(safe_VkVideoEncodeH265SessionParametersAddInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265SessionParametersAddInfoKHR& operator=(
+        safe_VkVideoEncodeH265SessionParametersAddInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265SessionParametersAddInfoKHR();
     ~safe_VkVideoEncodeH265SessionParametersAddInfoKHR();
     void initialize(const VkVideoEncodeH265SessionParametersAddInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5686,6 +6289,9 @@ struct safe_VkVideoEncodeH265SessionParametersCreateInfoKHR {
     safe_VkVideoEncodeH265SessionParametersCreateInfoKHR(const safe_VkVideoEncodeH265SessionParametersCreateInfoKHR& copy_src);
     safe_VkVideoEncodeH265SessionParametersCreateInfoKHR& operator=(
         const safe_VkVideoEncodeH265SessionParametersCreateInfoKHR& copy_src);
+    safe_VkVideoEncodeH265SessionParametersCreateInfoKHR(safe_VkVideoEncodeH265SessionParametersCreateInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265SessionParametersCreateInfoKHR& operator=(
+        safe_VkVideoEncodeH265SessionParametersCreateInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265SessionParametersCreateInfoKHR();
     ~safe_VkVideoEncodeH265SessionParametersCreateInfoKHR();
     void initialize(const VkVideoEncodeH265SessionParametersCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5711,6 +6317,9 @@ struct safe_VkVideoEncodeH265SessionParametersGetInfoKHR {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH265SessionParametersGetInfoKHR(const safe_VkVideoEncodeH265SessionParametersGetInfoKHR& copy_src);
     safe_VkVideoEncodeH265SessionParametersGetInfoKHR& operator=(const safe_VkVideoEncodeH265SessionParametersGetInfoKHR& copy_src);
+    safe_VkVideoEncodeH265SessionParametersGetInfoKHR(safe_VkVideoEncodeH265SessionParametersGetInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265SessionParametersGetInfoKHR& operator=(
+        safe_VkVideoEncodeH265SessionParametersGetInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265SessionParametersGetInfoKHR();
     ~safe_VkVideoEncodeH265SessionParametersGetInfoKHR();
     void initialize(const VkVideoEncodeH265SessionParametersGetInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5734,6 +6343,10 @@ struct safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR {
     safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR(const safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR& copy_src);
     safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR& operator=(
         const safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR& copy_src);
+    safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR(
+        safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR& operator=(
+        safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR();
     ~safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR();
     void initialize(const VkVideoEncodeH265SessionParametersFeedbackInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5755,6 +6368,8 @@ struct safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR(const safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR& copy_src);
     safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR& operator=(const safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR& copy_src);
+    safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR(safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR& operator=(safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR();
     ~safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR();
     void initialize(const VkVideoEncodeH265NaluSliceSegmentInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5775,6 +6390,8 @@ struct safe_VkVideoEncodeH265PictureInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoEncodeH265PictureInfoKHR(const safe_VkVideoEncodeH265PictureInfoKHR& copy_src);
     safe_VkVideoEncodeH265PictureInfoKHR& operator=(const safe_VkVideoEncodeH265PictureInfoKHR& copy_src);
+    safe_VkVideoEncodeH265PictureInfoKHR(safe_VkVideoEncodeH265PictureInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265PictureInfoKHR& operator=(safe_VkVideoEncodeH265PictureInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265PictureInfoKHR();
     ~safe_VkVideoEncodeH265PictureInfoKHR();
     void initialize(const VkVideoEncodeH265PictureInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5791,6 +6408,8 @@ struct safe_VkVideoEncodeH265DpbSlotInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoEncodeH265DpbSlotInfoKHR(const safe_VkVideoEncodeH265DpbSlotInfoKHR& copy_src);
     safe_VkVideoEncodeH265DpbSlotInfoKHR& operator=(const safe_VkVideoEncodeH265DpbSlotInfoKHR& copy_src);
+    safe_VkVideoEncodeH265DpbSlotInfoKHR(safe_VkVideoEncodeH265DpbSlotInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265DpbSlotInfoKHR& operator=(safe_VkVideoEncodeH265DpbSlotInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265DpbSlotInfoKHR();
     ~safe_VkVideoEncodeH265DpbSlotInfoKHR();
     void initialize(const VkVideoEncodeH265DpbSlotInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5807,6 +6426,8 @@ struct safe_VkVideoEncodeH265ProfileInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoEncodeH265ProfileInfoKHR(const safe_VkVideoEncodeH265ProfileInfoKHR& copy_src);
     safe_VkVideoEncodeH265ProfileInfoKHR& operator=(const safe_VkVideoEncodeH265ProfileInfoKHR& copy_src);
+    safe_VkVideoEncodeH265ProfileInfoKHR(safe_VkVideoEncodeH265ProfileInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265ProfileInfoKHR& operator=(safe_VkVideoEncodeH265ProfileInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265ProfileInfoKHR();
     ~safe_VkVideoEncodeH265ProfileInfoKHR();
     void initialize(const VkVideoEncodeH265ProfileInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5827,6 +6448,8 @@ struct safe_VkVideoEncodeH265RateControlInfoKHR {
                                              bool copy_pnext = true);
     safe_VkVideoEncodeH265RateControlInfoKHR(const safe_VkVideoEncodeH265RateControlInfoKHR& copy_src);
     safe_VkVideoEncodeH265RateControlInfoKHR& operator=(const safe_VkVideoEncodeH265RateControlInfoKHR& copy_src);
+    safe_VkVideoEncodeH265RateControlInfoKHR(safe_VkVideoEncodeH265RateControlInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265RateControlInfoKHR& operator=(safe_VkVideoEncodeH265RateControlInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265RateControlInfoKHR();
     ~safe_VkVideoEncodeH265RateControlInfoKHR();
     void initialize(const VkVideoEncodeH265RateControlInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5850,6 +6473,8 @@ struct safe_VkVideoEncodeH265RateControlLayerInfoKHR {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH265RateControlLayerInfoKHR(const safe_VkVideoEncodeH265RateControlLayerInfoKHR& copy_src);
     safe_VkVideoEncodeH265RateControlLayerInfoKHR& operator=(const safe_VkVideoEncodeH265RateControlLayerInfoKHR& copy_src);
+    safe_VkVideoEncodeH265RateControlLayerInfoKHR(safe_VkVideoEncodeH265RateControlLayerInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265RateControlLayerInfoKHR& operator=(safe_VkVideoEncodeH265RateControlLayerInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265RateControlLayerInfoKHR();
     ~safe_VkVideoEncodeH265RateControlLayerInfoKHR();
     void initialize(const VkVideoEncodeH265RateControlLayerInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5871,6 +6496,8 @@ struct safe_VkVideoEncodeH265GopRemainingFrameInfoKHR {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeH265GopRemainingFrameInfoKHR(const safe_VkVideoEncodeH265GopRemainingFrameInfoKHR& copy_src);
     safe_VkVideoEncodeH265GopRemainingFrameInfoKHR& operator=(const safe_VkVideoEncodeH265GopRemainingFrameInfoKHR& copy_src);
+    safe_VkVideoEncodeH265GopRemainingFrameInfoKHR(safe_VkVideoEncodeH265GopRemainingFrameInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeH265GopRemainingFrameInfoKHR& operator=(safe_VkVideoEncodeH265GopRemainingFrameInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeH265GopRemainingFrameInfoKHR();
     ~safe_VkVideoEncodeH265GopRemainingFrameInfoKHR();
     void initialize(const VkVideoEncodeH265GopRemainingFrameInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5890,6 +6517,8 @@ struct safe_VkVideoDecodeH264ProfileInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoDecodeH264ProfileInfoKHR(const safe_VkVideoDecodeH264ProfileInfoKHR& copy_src);
     safe_VkVideoDecodeH264ProfileInfoKHR& operator=(const safe_VkVideoDecodeH264ProfileInfoKHR& copy_src);
+    safe_VkVideoDecodeH264ProfileInfoKHR(safe_VkVideoDecodeH264ProfileInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH264ProfileInfoKHR& operator=(safe_VkVideoDecodeH264ProfileInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeH264ProfileInfoKHR();
     ~safe_VkVideoDecodeH264ProfileInfoKHR();
     void initialize(const VkVideoDecodeH264ProfileInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5907,6 +6536,8 @@ struct safe_VkVideoDecodeH264CapabilitiesKHR {
                                           bool copy_pnext = true);
     safe_VkVideoDecodeH264CapabilitiesKHR(const safe_VkVideoDecodeH264CapabilitiesKHR& copy_src);
     safe_VkVideoDecodeH264CapabilitiesKHR& operator=(const safe_VkVideoDecodeH264CapabilitiesKHR& copy_src);
+    safe_VkVideoDecodeH264CapabilitiesKHR(safe_VkVideoDecodeH264CapabilitiesKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH264CapabilitiesKHR& operator=(safe_VkVideoDecodeH264CapabilitiesKHR&& move_src) noexcept;
     safe_VkVideoDecodeH264CapabilitiesKHR();
     ~safe_VkVideoDecodeH264CapabilitiesKHR();
     void initialize(const VkVideoDecodeH264CapabilitiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5926,6 +6557,9 @@ struct safe_VkVideoDecodeH264SessionParametersAddInfoKHR {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoDecodeH264SessionParametersAddInfoKHR(const safe_VkVideoDecodeH264SessionParametersAddInfoKHR& copy_src);
     safe_VkVideoDecodeH264SessionParametersAddInfoKHR& operator=(const safe_VkVideoDecodeH264SessionParametersAddInfoKHR& copy_src);
+    safe_VkVideoDecodeH264SessionParametersAddInfoKHR(safe_VkVideoDecodeH264SessionParametersAddInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH264SessionParametersAddInfoKHR& operator=(
+        safe_VkVideoDecodeH264SessionParametersAddInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeH264SessionParametersAddInfoKHR();
     ~safe_VkVideoDecodeH264SessionParametersAddInfoKHR();
     void initialize(const VkVideoDecodeH264SessionParametersAddInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5949,6 +6583,9 @@ struct safe_VkVideoDecodeH264SessionParametersCreateInfoKHR {
     safe_VkVideoDecodeH264SessionParametersCreateInfoKHR(const safe_VkVideoDecodeH264SessionParametersCreateInfoKHR& copy_src);
     safe_VkVideoDecodeH264SessionParametersCreateInfoKHR& operator=(
         const safe_VkVideoDecodeH264SessionParametersCreateInfoKHR& copy_src);
+    safe_VkVideoDecodeH264SessionParametersCreateInfoKHR(safe_VkVideoDecodeH264SessionParametersCreateInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH264SessionParametersCreateInfoKHR& operator=(
+        safe_VkVideoDecodeH264SessionParametersCreateInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeH264SessionParametersCreateInfoKHR();
     ~safe_VkVideoDecodeH264SessionParametersCreateInfoKHR();
     void initialize(const VkVideoDecodeH264SessionParametersCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5971,6 +6608,8 @@ struct safe_VkVideoDecodeH264PictureInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoDecodeH264PictureInfoKHR(const safe_VkVideoDecodeH264PictureInfoKHR& copy_src);
     safe_VkVideoDecodeH264PictureInfoKHR& operator=(const safe_VkVideoDecodeH264PictureInfoKHR& copy_src);
+    safe_VkVideoDecodeH264PictureInfoKHR(safe_VkVideoDecodeH264PictureInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH264PictureInfoKHR& operator=(safe_VkVideoDecodeH264PictureInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeH264PictureInfoKHR();
     ~safe_VkVideoDecodeH264PictureInfoKHR();
     void initialize(const VkVideoDecodeH264PictureInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -5987,6 +6626,8 @@ struct safe_VkVideoDecodeH264DpbSlotInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoDecodeH264DpbSlotInfoKHR(const safe_VkVideoDecodeH264DpbSlotInfoKHR& copy_src);
     safe_VkVideoDecodeH264DpbSlotInfoKHR& operator=(const safe_VkVideoDecodeH264DpbSlotInfoKHR& copy_src);
+    safe_VkVideoDecodeH264DpbSlotInfoKHR(safe_VkVideoDecodeH264DpbSlotInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH264DpbSlotInfoKHR& operator=(safe_VkVideoDecodeH264DpbSlotInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeH264DpbSlotInfoKHR();
     ~safe_VkVideoDecodeH264DpbSlotInfoKHR();
     void initialize(const VkVideoDecodeH264DpbSlotInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6006,6 +6647,9 @@ struct safe_VkRenderingFragmentShadingRateAttachmentInfoKHR {
     safe_VkRenderingFragmentShadingRateAttachmentInfoKHR(const safe_VkRenderingFragmentShadingRateAttachmentInfoKHR& copy_src);
     safe_VkRenderingFragmentShadingRateAttachmentInfoKHR& operator=(
         const safe_VkRenderingFragmentShadingRateAttachmentInfoKHR& copy_src);
+    safe_VkRenderingFragmentShadingRateAttachmentInfoKHR(safe_VkRenderingFragmentShadingRateAttachmentInfoKHR&& move_src) noexcept;
+    safe_VkRenderingFragmentShadingRateAttachmentInfoKHR& operator=(
+        safe_VkRenderingFragmentShadingRateAttachmentInfoKHR&& move_src) noexcept;
     safe_VkRenderingFragmentShadingRateAttachmentInfoKHR();
     ~safe_VkRenderingFragmentShadingRateAttachmentInfoKHR();
     void initialize(const VkRenderingFragmentShadingRateAttachmentInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6028,6 +6672,9 @@ struct safe_VkRenderingFragmentDensityMapAttachmentInfoEXT {
     safe_VkRenderingFragmentDensityMapAttachmentInfoEXT(const safe_VkRenderingFragmentDensityMapAttachmentInfoEXT& copy_src);
     safe_VkRenderingFragmentDensityMapAttachmentInfoEXT& operator=(
         const safe_VkRenderingFragmentDensityMapAttachmentInfoEXT& copy_src);
+    safe_VkRenderingFragmentDensityMapAttachmentInfoEXT(safe_VkRenderingFragmentDensityMapAttachmentInfoEXT&& move_src) noexcept;
+    safe_VkRenderingFragmentDensityMapAttachmentInfoEXT& operator=(
+        safe_VkRenderingFragmentDensityMapAttachmentInfoEXT&& move_src) noexcept;
     safe_VkRenderingFragmentDensityMapAttachmentInfoEXT();
     ~safe_VkRenderingFragmentDensityMapAttachmentInfoEXT();
     void initialize(const VkRenderingFragmentDensityMapAttachmentInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -6050,6 +6697,8 @@ struct safe_VkAttachmentSampleCountInfoAMD {
                                         bool copy_pnext = true);
     safe_VkAttachmentSampleCountInfoAMD(const safe_VkAttachmentSampleCountInfoAMD& copy_src);
     safe_VkAttachmentSampleCountInfoAMD& operator=(const safe_VkAttachmentSampleCountInfoAMD& copy_src);
+    safe_VkAttachmentSampleCountInfoAMD(safe_VkAttachmentSampleCountInfoAMD&& move_src) noexcept;
+    safe_VkAttachmentSampleCountInfoAMD& operator=(safe_VkAttachmentSampleCountInfoAMD&& move_src) noexcept;
     safe_VkAttachmentSampleCountInfoAMD();
     ~safe_VkAttachmentSampleCountInfoAMD();
     void initialize(const VkAttachmentSampleCountInfoAMD* in_struct, PNextCopyState* copy_state = {});
@@ -6067,6 +6716,8 @@ struct safe_VkMultiviewPerViewAttributesInfoNVX {
                                              bool copy_pnext = true);
     safe_VkMultiviewPerViewAttributesInfoNVX(const safe_VkMultiviewPerViewAttributesInfoNVX& copy_src);
     safe_VkMultiviewPerViewAttributesInfoNVX& operator=(const safe_VkMultiviewPerViewAttributesInfoNVX& copy_src);
+    safe_VkMultiviewPerViewAttributesInfoNVX(safe_VkMultiviewPerViewAttributesInfoNVX&& move_src) noexcept;
+    safe_VkMultiviewPerViewAttributesInfoNVX& operator=(safe_VkMultiviewPerViewAttributesInfoNVX&& move_src) noexcept;
     safe_VkMultiviewPerViewAttributesInfoNVX();
     ~safe_VkMultiviewPerViewAttributesInfoNVX();
     void initialize(const VkMultiviewPerViewAttributesInfoNVX* in_struct, PNextCopyState* copy_state = {});
@@ -6088,6 +6739,8 @@ struct safe_VkImportMemoryWin32HandleInfoKHR {
                                           bool copy_pnext = true);
     safe_VkImportMemoryWin32HandleInfoKHR(const safe_VkImportMemoryWin32HandleInfoKHR& copy_src);
     safe_VkImportMemoryWin32HandleInfoKHR& operator=(const safe_VkImportMemoryWin32HandleInfoKHR& copy_src);
+    safe_VkImportMemoryWin32HandleInfoKHR(safe_VkImportMemoryWin32HandleInfoKHR&& move_src) noexcept;
+    safe_VkImportMemoryWin32HandleInfoKHR& operator=(safe_VkImportMemoryWin32HandleInfoKHR&& move_src) noexcept;
     safe_VkImportMemoryWin32HandleInfoKHR();
     ~safe_VkImportMemoryWin32HandleInfoKHR();
     void initialize(const VkImportMemoryWin32HandleInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6106,6 +6759,8 @@ struct safe_VkExportMemoryWin32HandleInfoKHR {
                                           bool copy_pnext = true);
     safe_VkExportMemoryWin32HandleInfoKHR(const safe_VkExportMemoryWin32HandleInfoKHR& copy_src);
     safe_VkExportMemoryWin32HandleInfoKHR& operator=(const safe_VkExportMemoryWin32HandleInfoKHR& copy_src);
+    safe_VkExportMemoryWin32HandleInfoKHR(safe_VkExportMemoryWin32HandleInfoKHR&& move_src) noexcept;
+    safe_VkExportMemoryWin32HandleInfoKHR& operator=(safe_VkExportMemoryWin32HandleInfoKHR&& move_src) noexcept;
     safe_VkExportMemoryWin32HandleInfoKHR();
     ~safe_VkExportMemoryWin32HandleInfoKHR();
     void initialize(const VkExportMemoryWin32HandleInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6122,6 +6777,8 @@ struct safe_VkMemoryWin32HandlePropertiesKHR {
                                           bool copy_pnext = true);
     safe_VkMemoryWin32HandlePropertiesKHR(const safe_VkMemoryWin32HandlePropertiesKHR& copy_src);
     safe_VkMemoryWin32HandlePropertiesKHR& operator=(const safe_VkMemoryWin32HandlePropertiesKHR& copy_src);
+    safe_VkMemoryWin32HandlePropertiesKHR(safe_VkMemoryWin32HandlePropertiesKHR&& move_src) noexcept;
+    safe_VkMemoryWin32HandlePropertiesKHR& operator=(safe_VkMemoryWin32HandlePropertiesKHR&& move_src) noexcept;
     safe_VkMemoryWin32HandlePropertiesKHR();
     ~safe_VkMemoryWin32HandlePropertiesKHR();
     void initialize(const VkMemoryWin32HandlePropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6139,6 +6796,8 @@ struct safe_VkMemoryGetWin32HandleInfoKHR {
                                        bool copy_pnext = true);
     safe_VkMemoryGetWin32HandleInfoKHR(const safe_VkMemoryGetWin32HandleInfoKHR& copy_src);
     safe_VkMemoryGetWin32HandleInfoKHR& operator=(const safe_VkMemoryGetWin32HandleInfoKHR& copy_src);
+    safe_VkMemoryGetWin32HandleInfoKHR(safe_VkMemoryGetWin32HandleInfoKHR&& move_src) noexcept;
+    safe_VkMemoryGetWin32HandleInfoKHR& operator=(safe_VkMemoryGetWin32HandleInfoKHR&& move_src) noexcept;
     safe_VkMemoryGetWin32HandleInfoKHR();
     ~safe_VkMemoryGetWin32HandleInfoKHR();
     void initialize(const VkMemoryGetWin32HandleInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6156,6 +6815,8 @@ struct safe_VkImportMemoryFdInfoKHR {
     safe_VkImportMemoryFdInfoKHR(const VkImportMemoryFdInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImportMemoryFdInfoKHR(const safe_VkImportMemoryFdInfoKHR& copy_src);
     safe_VkImportMemoryFdInfoKHR& operator=(const safe_VkImportMemoryFdInfoKHR& copy_src);
+    safe_VkImportMemoryFdInfoKHR(safe_VkImportMemoryFdInfoKHR&& move_src) noexcept;
+    safe_VkImportMemoryFdInfoKHR& operator=(safe_VkImportMemoryFdInfoKHR&& move_src) noexcept;
     safe_VkImportMemoryFdInfoKHR();
     ~safe_VkImportMemoryFdInfoKHR();
     void initialize(const VkImportMemoryFdInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6171,6 +6832,8 @@ struct safe_VkMemoryFdPropertiesKHR {
     safe_VkMemoryFdPropertiesKHR(const VkMemoryFdPropertiesKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryFdPropertiesKHR(const safe_VkMemoryFdPropertiesKHR& copy_src);
     safe_VkMemoryFdPropertiesKHR& operator=(const safe_VkMemoryFdPropertiesKHR& copy_src);
+    safe_VkMemoryFdPropertiesKHR(safe_VkMemoryFdPropertiesKHR&& move_src) noexcept;
+    safe_VkMemoryFdPropertiesKHR& operator=(safe_VkMemoryFdPropertiesKHR&& move_src) noexcept;
     safe_VkMemoryFdPropertiesKHR();
     ~safe_VkMemoryFdPropertiesKHR();
     void initialize(const VkMemoryFdPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6187,6 +6850,8 @@ struct safe_VkMemoryGetFdInfoKHR {
     safe_VkMemoryGetFdInfoKHR(const VkMemoryGetFdInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryGetFdInfoKHR(const safe_VkMemoryGetFdInfoKHR& copy_src);
     safe_VkMemoryGetFdInfoKHR& operator=(const safe_VkMemoryGetFdInfoKHR& copy_src);
+    safe_VkMemoryGetFdInfoKHR(safe_VkMemoryGetFdInfoKHR&& move_src) noexcept;
+    safe_VkMemoryGetFdInfoKHR& operator=(safe_VkMemoryGetFdInfoKHR&& move_src) noexcept;
     safe_VkMemoryGetFdInfoKHR();
     ~safe_VkMemoryGetFdInfoKHR();
     void initialize(const VkMemoryGetFdInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6210,6 +6875,8 @@ struct safe_VkWin32KeyedMutexAcquireReleaseInfoKHR {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkWin32KeyedMutexAcquireReleaseInfoKHR(const safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& copy_src);
     safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& operator=(const safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& copy_src);
+    safe_VkWin32KeyedMutexAcquireReleaseInfoKHR(safe_VkWin32KeyedMutexAcquireReleaseInfoKHR&& move_src) noexcept;
+    safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& operator=(safe_VkWin32KeyedMutexAcquireReleaseInfoKHR&& move_src) noexcept;
     safe_VkWin32KeyedMutexAcquireReleaseInfoKHR();
     ~safe_VkWin32KeyedMutexAcquireReleaseInfoKHR();
     void initialize(const VkWin32KeyedMutexAcquireReleaseInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6232,6 +6899,8 @@ struct safe_VkImportSemaphoreWin32HandleInfoKHR {
                                              bool copy_pnext = true);
     safe_VkImportSemaphoreWin32HandleInfoKHR(const safe_VkImportSemaphoreWin32HandleInfoKHR& copy_src);
     safe_VkImportSemaphoreWin32HandleInfoKHR& operator=(const safe_VkImportSemaphoreWin32HandleInfoKHR& copy_src);
+    safe_VkImportSemaphoreWin32HandleInfoKHR(safe_VkImportSemaphoreWin32HandleInfoKHR&& move_src) noexcept;
+    safe_VkImportSemaphoreWin32HandleInfoKHR& operator=(safe_VkImportSemaphoreWin32HandleInfoKHR&& move_src) noexcept;
     safe_VkImportSemaphoreWin32HandleInfoKHR();
     ~safe_VkImportSemaphoreWin32HandleInfoKHR();
     void initialize(const VkImportSemaphoreWin32HandleInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6252,6 +6921,8 @@ struct safe_VkExportSemaphoreWin32HandleInfoKHR {
                                              bool copy_pnext = true);
     safe_VkExportSemaphoreWin32HandleInfoKHR(const safe_VkExportSemaphoreWin32HandleInfoKHR& copy_src);
     safe_VkExportSemaphoreWin32HandleInfoKHR& operator=(const safe_VkExportSemaphoreWin32HandleInfoKHR& copy_src);
+    safe_VkExportSemaphoreWin32HandleInfoKHR(safe_VkExportSemaphoreWin32HandleInfoKHR&& move_src) noexcept;
+    safe_VkExportSemaphoreWin32HandleInfoKHR& operator=(safe_VkExportSemaphoreWin32HandleInfoKHR&& move_src) noexcept;
     safe_VkExportSemaphoreWin32HandleInfoKHR();
     ~safe_VkExportSemaphoreWin32HandleInfoKHR();
     void initialize(const VkExportSemaphoreWin32HandleInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6273,6 +6944,8 @@ struct safe_VkD3D12FenceSubmitInfoKHR {
                                    bool copy_pnext = true);
     safe_VkD3D12FenceSubmitInfoKHR(const safe_VkD3D12FenceSubmitInfoKHR& copy_src);
     safe_VkD3D12FenceSubmitInfoKHR& operator=(const safe_VkD3D12FenceSubmitInfoKHR& copy_src);
+    safe_VkD3D12FenceSubmitInfoKHR(safe_VkD3D12FenceSubmitInfoKHR&& move_src) noexcept;
+    safe_VkD3D12FenceSubmitInfoKHR& operator=(safe_VkD3D12FenceSubmitInfoKHR&& move_src) noexcept;
     safe_VkD3D12FenceSubmitInfoKHR();
     ~safe_VkD3D12FenceSubmitInfoKHR();
     void initialize(const VkD3D12FenceSubmitInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6290,6 +6963,8 @@ struct safe_VkSemaphoreGetWin32HandleInfoKHR {
                                           bool copy_pnext = true);
     safe_VkSemaphoreGetWin32HandleInfoKHR(const safe_VkSemaphoreGetWin32HandleInfoKHR& copy_src);
     safe_VkSemaphoreGetWin32HandleInfoKHR& operator=(const safe_VkSemaphoreGetWin32HandleInfoKHR& copy_src);
+    safe_VkSemaphoreGetWin32HandleInfoKHR(safe_VkSemaphoreGetWin32HandleInfoKHR&& move_src) noexcept;
+    safe_VkSemaphoreGetWin32HandleInfoKHR& operator=(safe_VkSemaphoreGetWin32HandleInfoKHR&& move_src) noexcept;
     safe_VkSemaphoreGetWin32HandleInfoKHR();
     ~safe_VkSemaphoreGetWin32HandleInfoKHR();
     void initialize(const VkSemaphoreGetWin32HandleInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6310,6 +6985,8 @@ struct safe_VkImportSemaphoreFdInfoKHR {
                                     bool copy_pnext = true);
     safe_VkImportSemaphoreFdInfoKHR(const safe_VkImportSemaphoreFdInfoKHR& copy_src);
     safe_VkImportSemaphoreFdInfoKHR& operator=(const safe_VkImportSemaphoreFdInfoKHR& copy_src);
+    safe_VkImportSemaphoreFdInfoKHR(safe_VkImportSemaphoreFdInfoKHR&& move_src) noexcept;
+    safe_VkImportSemaphoreFdInfoKHR& operator=(safe_VkImportSemaphoreFdInfoKHR&& move_src) noexcept;
     safe_VkImportSemaphoreFdInfoKHR();
     ~safe_VkImportSemaphoreFdInfoKHR();
     void initialize(const VkImportSemaphoreFdInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6326,6 +7003,8 @@ struct safe_VkSemaphoreGetFdInfoKHR {
     safe_VkSemaphoreGetFdInfoKHR(const VkSemaphoreGetFdInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSemaphoreGetFdInfoKHR(const safe_VkSemaphoreGetFdInfoKHR& copy_src);
     safe_VkSemaphoreGetFdInfoKHR& operator=(const safe_VkSemaphoreGetFdInfoKHR& copy_src);
+    safe_VkSemaphoreGetFdInfoKHR(safe_VkSemaphoreGetFdInfoKHR&& move_src) noexcept;
+    safe_VkSemaphoreGetFdInfoKHR& operator=(safe_VkSemaphoreGetFdInfoKHR&& move_src) noexcept;
     safe_VkSemaphoreGetFdInfoKHR();
     ~safe_VkSemaphoreGetFdInfoKHR();
     void initialize(const VkSemaphoreGetFdInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6342,6 +7021,9 @@ struct safe_VkPhysicalDevicePushDescriptorPropertiesKHR {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDevicePushDescriptorPropertiesKHR(const safe_VkPhysicalDevicePushDescriptorPropertiesKHR& copy_src);
     safe_VkPhysicalDevicePushDescriptorPropertiesKHR& operator=(const safe_VkPhysicalDevicePushDescriptorPropertiesKHR& copy_src);
+    safe_VkPhysicalDevicePushDescriptorPropertiesKHR(safe_VkPhysicalDevicePushDescriptorPropertiesKHR&& move_src) noexcept;
+    safe_VkPhysicalDevicePushDescriptorPropertiesKHR& operator=(
+        safe_VkPhysicalDevicePushDescriptorPropertiesKHR&& move_src) noexcept;
     safe_VkPhysicalDevicePushDescriptorPropertiesKHR();
     ~safe_VkPhysicalDevicePushDescriptorPropertiesKHR();
     void initialize(const VkPhysicalDevicePushDescriptorPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6360,6 +7042,8 @@ struct safe_VkPresentRegionKHR {
     safe_VkPresentRegionKHR(const VkPresentRegionKHR* in_struct, PNextCopyState* copy_state = {});
     safe_VkPresentRegionKHR(const safe_VkPresentRegionKHR& copy_src);
     safe_VkPresentRegionKHR& operator=(const safe_VkPresentRegionKHR& copy_src);
+    safe_VkPresentRegionKHR(safe_VkPresentRegionKHR&& move_src) noexcept;
+    safe_VkPresentRegionKHR& operator=(safe_VkPresentRegionKHR&& move_src) noexcept;
     safe_VkPresentRegionKHR();
     ~safe_VkPresentRegionKHR();
     void initialize(const VkPresentRegionKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6376,6 +7060,8 @@ struct safe_VkPresentRegionsKHR {
     safe_VkPresentRegionsKHR(const VkPresentRegionsKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPresentRegionsKHR(const safe_VkPresentRegionsKHR& copy_src);
     safe_VkPresentRegionsKHR& operator=(const safe_VkPresentRegionsKHR& copy_src);
+    safe_VkPresentRegionsKHR(safe_VkPresentRegionsKHR&& move_src) noexcept;
+    safe_VkPresentRegionsKHR& operator=(safe_VkPresentRegionsKHR&& move_src) noexcept;
     safe_VkPresentRegionsKHR();
     ~safe_VkPresentRegionsKHR();
     void initialize(const VkPresentRegionsKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6392,6 +7078,8 @@ struct safe_VkSharedPresentSurfaceCapabilitiesKHR {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSharedPresentSurfaceCapabilitiesKHR(const safe_VkSharedPresentSurfaceCapabilitiesKHR& copy_src);
     safe_VkSharedPresentSurfaceCapabilitiesKHR& operator=(const safe_VkSharedPresentSurfaceCapabilitiesKHR& copy_src);
+    safe_VkSharedPresentSurfaceCapabilitiesKHR(safe_VkSharedPresentSurfaceCapabilitiesKHR&& move_src) noexcept;
+    safe_VkSharedPresentSurfaceCapabilitiesKHR& operator=(safe_VkSharedPresentSurfaceCapabilitiesKHR&& move_src) noexcept;
     safe_VkSharedPresentSurfaceCapabilitiesKHR();
     ~safe_VkSharedPresentSurfaceCapabilitiesKHR();
     void initialize(const VkSharedPresentSurfaceCapabilitiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6415,6 +7103,8 @@ struct safe_VkImportFenceWin32HandleInfoKHR {
                                          bool copy_pnext = true);
     safe_VkImportFenceWin32HandleInfoKHR(const safe_VkImportFenceWin32HandleInfoKHR& copy_src);
     safe_VkImportFenceWin32HandleInfoKHR& operator=(const safe_VkImportFenceWin32HandleInfoKHR& copy_src);
+    safe_VkImportFenceWin32HandleInfoKHR(safe_VkImportFenceWin32HandleInfoKHR&& move_src) noexcept;
+    safe_VkImportFenceWin32HandleInfoKHR& operator=(safe_VkImportFenceWin32HandleInfoKHR&& move_src) noexcept;
     safe_VkImportFenceWin32HandleInfoKHR();
     ~safe_VkImportFenceWin32HandleInfoKHR();
     void initialize(const VkImportFenceWin32HandleInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6433,6 +7123,8 @@ struct safe_VkExportFenceWin32HandleInfoKHR {
                                          bool copy_pnext = true);
     safe_VkExportFenceWin32HandleInfoKHR(const safe_VkExportFenceWin32HandleInfoKHR& copy_src);
     safe_VkExportFenceWin32HandleInfoKHR& operator=(const safe_VkExportFenceWin32HandleInfoKHR& copy_src);
+    safe_VkExportFenceWin32HandleInfoKHR(safe_VkExportFenceWin32HandleInfoKHR&& move_src) noexcept;
+    safe_VkExportFenceWin32HandleInfoKHR& operator=(safe_VkExportFenceWin32HandleInfoKHR&& move_src) noexcept;
     safe_VkExportFenceWin32HandleInfoKHR();
     ~safe_VkExportFenceWin32HandleInfoKHR();
     void initialize(const VkExportFenceWin32HandleInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6450,6 +7142,8 @@ struct safe_VkFenceGetWin32HandleInfoKHR {
                                       bool copy_pnext = true);
     safe_VkFenceGetWin32HandleInfoKHR(const safe_VkFenceGetWin32HandleInfoKHR& copy_src);
     safe_VkFenceGetWin32HandleInfoKHR& operator=(const safe_VkFenceGetWin32HandleInfoKHR& copy_src);
+    safe_VkFenceGetWin32HandleInfoKHR(safe_VkFenceGetWin32HandleInfoKHR&& move_src) noexcept;
+    safe_VkFenceGetWin32HandleInfoKHR& operator=(safe_VkFenceGetWin32HandleInfoKHR&& move_src) noexcept;
     safe_VkFenceGetWin32HandleInfoKHR();
     ~safe_VkFenceGetWin32HandleInfoKHR();
     void initialize(const VkFenceGetWin32HandleInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6469,6 +7163,8 @@ struct safe_VkImportFenceFdInfoKHR {
     safe_VkImportFenceFdInfoKHR(const VkImportFenceFdInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImportFenceFdInfoKHR(const safe_VkImportFenceFdInfoKHR& copy_src);
     safe_VkImportFenceFdInfoKHR& operator=(const safe_VkImportFenceFdInfoKHR& copy_src);
+    safe_VkImportFenceFdInfoKHR(safe_VkImportFenceFdInfoKHR&& move_src) noexcept;
+    safe_VkImportFenceFdInfoKHR& operator=(safe_VkImportFenceFdInfoKHR&& move_src) noexcept;
     safe_VkImportFenceFdInfoKHR();
     ~safe_VkImportFenceFdInfoKHR();
     void initialize(const VkImportFenceFdInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6485,6 +7181,8 @@ struct safe_VkFenceGetFdInfoKHR {
     safe_VkFenceGetFdInfoKHR(const VkFenceGetFdInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkFenceGetFdInfoKHR(const safe_VkFenceGetFdInfoKHR& copy_src);
     safe_VkFenceGetFdInfoKHR& operator=(const safe_VkFenceGetFdInfoKHR& copy_src);
+    safe_VkFenceGetFdInfoKHR(safe_VkFenceGetFdInfoKHR&& move_src) noexcept;
+    safe_VkFenceGetFdInfoKHR& operator=(safe_VkFenceGetFdInfoKHR&& move_src) noexcept;
     safe_VkFenceGetFdInfoKHR();
     ~safe_VkFenceGetFdInfoKHR();
     void initialize(const VkFenceGetFdInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6502,6 +7200,9 @@ struct safe_VkPhysicalDevicePerformanceQueryFeaturesKHR {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDevicePerformanceQueryFeaturesKHR(const safe_VkPhysicalDevicePerformanceQueryFeaturesKHR& copy_src);
     safe_VkPhysicalDevicePerformanceQueryFeaturesKHR& operator=(const safe_VkPhysicalDevicePerformanceQueryFeaturesKHR& copy_src);
+    safe_VkPhysicalDevicePerformanceQueryFeaturesKHR(safe_VkPhysicalDevicePerformanceQueryFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDevicePerformanceQueryFeaturesKHR& operator=(
+        safe_VkPhysicalDevicePerformanceQueryFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDevicePerformanceQueryFeaturesKHR();
     ~safe_VkPhysicalDevicePerformanceQueryFeaturesKHR();
     void initialize(const VkPhysicalDevicePerformanceQueryFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6523,6 +7224,9 @@ struct safe_VkPhysicalDevicePerformanceQueryPropertiesKHR {
     safe_VkPhysicalDevicePerformanceQueryPropertiesKHR(const safe_VkPhysicalDevicePerformanceQueryPropertiesKHR& copy_src);
     safe_VkPhysicalDevicePerformanceQueryPropertiesKHR& operator=(
         const safe_VkPhysicalDevicePerformanceQueryPropertiesKHR& copy_src);
+    safe_VkPhysicalDevicePerformanceQueryPropertiesKHR(safe_VkPhysicalDevicePerformanceQueryPropertiesKHR&& move_src) noexcept;
+    safe_VkPhysicalDevicePerformanceQueryPropertiesKHR& operator=(
+        safe_VkPhysicalDevicePerformanceQueryPropertiesKHR&& move_src) noexcept;
     safe_VkPhysicalDevicePerformanceQueryPropertiesKHR();
     ~safe_VkPhysicalDevicePerformanceQueryPropertiesKHR();
     void initialize(const VkPhysicalDevicePerformanceQueryPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6545,6 +7249,8 @@ struct safe_VkPerformanceCounterKHR {
     safe_VkPerformanceCounterKHR(const VkPerformanceCounterKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPerformanceCounterKHR(const safe_VkPerformanceCounterKHR& copy_src);
     safe_VkPerformanceCounterKHR& operator=(const safe_VkPerformanceCounterKHR& copy_src);
+    safe_VkPerformanceCounterKHR(safe_VkPerformanceCounterKHR&& move_src) noexcept;
+    safe_VkPerformanceCounterKHR& operator=(safe_VkPerformanceCounterKHR&& move_src) noexcept;
     safe_VkPerformanceCounterKHR();
     ~safe_VkPerformanceCounterKHR();
     void initialize(const VkPerformanceCounterKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6564,6 +7270,8 @@ struct safe_VkPerformanceCounterDescriptionKHR {
                                             bool copy_pnext = true);
     safe_VkPerformanceCounterDescriptionKHR(const safe_VkPerformanceCounterDescriptionKHR& copy_src);
     safe_VkPerformanceCounterDescriptionKHR& operator=(const safe_VkPerformanceCounterDescriptionKHR& copy_src);
+    safe_VkPerformanceCounterDescriptionKHR(safe_VkPerformanceCounterDescriptionKHR&& move_src) noexcept;
+    safe_VkPerformanceCounterDescriptionKHR& operator=(safe_VkPerformanceCounterDescriptionKHR&& move_src) noexcept;
     safe_VkPerformanceCounterDescriptionKHR();
     ~safe_VkPerformanceCounterDescriptionKHR();
     void initialize(const VkPerformanceCounterDescriptionKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6584,6 +7292,8 @@ struct safe_VkQueryPoolPerformanceCreateInfoKHR {
                                              bool copy_pnext = true);
     safe_VkQueryPoolPerformanceCreateInfoKHR(const safe_VkQueryPoolPerformanceCreateInfoKHR& copy_src);
     safe_VkQueryPoolPerformanceCreateInfoKHR& operator=(const safe_VkQueryPoolPerformanceCreateInfoKHR& copy_src);
+    safe_VkQueryPoolPerformanceCreateInfoKHR(safe_VkQueryPoolPerformanceCreateInfoKHR&& move_src) noexcept;
+    safe_VkQueryPoolPerformanceCreateInfoKHR& operator=(safe_VkQueryPoolPerformanceCreateInfoKHR&& move_src) noexcept;
     safe_VkQueryPoolPerformanceCreateInfoKHR();
     ~safe_VkQueryPoolPerformanceCreateInfoKHR();
     void initialize(const VkQueryPoolPerformanceCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6603,6 +7313,8 @@ struct safe_VkAcquireProfilingLockInfoKHR {
                                        bool copy_pnext = true);
     safe_VkAcquireProfilingLockInfoKHR(const safe_VkAcquireProfilingLockInfoKHR& copy_src);
     safe_VkAcquireProfilingLockInfoKHR& operator=(const safe_VkAcquireProfilingLockInfoKHR& copy_src);
+    safe_VkAcquireProfilingLockInfoKHR(safe_VkAcquireProfilingLockInfoKHR&& move_src) noexcept;
+    safe_VkAcquireProfilingLockInfoKHR& operator=(safe_VkAcquireProfilingLockInfoKHR&& move_src) noexcept;
     safe_VkAcquireProfilingLockInfoKHR();
     ~safe_VkAcquireProfilingLockInfoKHR();
     void initialize(const VkAcquireProfilingLockInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6619,6 +7331,8 @@ struct safe_VkPerformanceQuerySubmitInfoKHR {
                                          bool copy_pnext = true);
     safe_VkPerformanceQuerySubmitInfoKHR(const safe_VkPerformanceQuerySubmitInfoKHR& copy_src);
     safe_VkPerformanceQuerySubmitInfoKHR& operator=(const safe_VkPerformanceQuerySubmitInfoKHR& copy_src);
+    safe_VkPerformanceQuerySubmitInfoKHR(safe_VkPerformanceQuerySubmitInfoKHR&& move_src) noexcept;
+    safe_VkPerformanceQuerySubmitInfoKHR& operator=(safe_VkPerformanceQuerySubmitInfoKHR&& move_src) noexcept;
     safe_VkPerformanceQuerySubmitInfoKHR();
     ~safe_VkPerformanceQuerySubmitInfoKHR();
     void initialize(const VkPerformanceQuerySubmitInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6635,6 +7349,8 @@ struct safe_VkPhysicalDeviceSurfaceInfo2KHR {
                                          bool copy_pnext = true);
     safe_VkPhysicalDeviceSurfaceInfo2KHR(const safe_VkPhysicalDeviceSurfaceInfo2KHR& copy_src);
     safe_VkPhysicalDeviceSurfaceInfo2KHR& operator=(const safe_VkPhysicalDeviceSurfaceInfo2KHR& copy_src);
+    safe_VkPhysicalDeviceSurfaceInfo2KHR(safe_VkPhysicalDeviceSurfaceInfo2KHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceSurfaceInfo2KHR& operator=(safe_VkPhysicalDeviceSurfaceInfo2KHR&& move_src) noexcept;
     safe_VkPhysicalDeviceSurfaceInfo2KHR();
     ~safe_VkPhysicalDeviceSurfaceInfo2KHR();
     void initialize(const VkPhysicalDeviceSurfaceInfo2KHR* in_struct, PNextCopyState* copy_state = {});
@@ -6651,6 +7367,8 @@ struct safe_VkSurfaceCapabilities2KHR {
                                    bool copy_pnext = true);
     safe_VkSurfaceCapabilities2KHR(const safe_VkSurfaceCapabilities2KHR& copy_src);
     safe_VkSurfaceCapabilities2KHR& operator=(const safe_VkSurfaceCapabilities2KHR& copy_src);
+    safe_VkSurfaceCapabilities2KHR(safe_VkSurfaceCapabilities2KHR&& move_src) noexcept;
+    safe_VkSurfaceCapabilities2KHR& operator=(safe_VkSurfaceCapabilities2KHR&& move_src) noexcept;
     safe_VkSurfaceCapabilities2KHR();
     ~safe_VkSurfaceCapabilities2KHR();
     void initialize(const VkSurfaceCapabilities2KHR* in_struct, PNextCopyState* copy_state = {});
@@ -6666,6 +7384,8 @@ struct safe_VkSurfaceFormat2KHR {
     safe_VkSurfaceFormat2KHR(const VkSurfaceFormat2KHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSurfaceFormat2KHR(const safe_VkSurfaceFormat2KHR& copy_src);
     safe_VkSurfaceFormat2KHR& operator=(const safe_VkSurfaceFormat2KHR& copy_src);
+    safe_VkSurfaceFormat2KHR(safe_VkSurfaceFormat2KHR&& move_src) noexcept;
+    safe_VkSurfaceFormat2KHR& operator=(safe_VkSurfaceFormat2KHR&& move_src) noexcept;
     safe_VkSurfaceFormat2KHR();
     ~safe_VkSurfaceFormat2KHR();
     void initialize(const VkSurfaceFormat2KHR* in_struct, PNextCopyState* copy_state = {});
@@ -6681,6 +7401,8 @@ struct safe_VkDisplayProperties2KHR {
     safe_VkDisplayProperties2KHR(const VkDisplayProperties2KHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDisplayProperties2KHR(const safe_VkDisplayProperties2KHR& copy_src);
     safe_VkDisplayProperties2KHR& operator=(const safe_VkDisplayProperties2KHR& copy_src);
+    safe_VkDisplayProperties2KHR(safe_VkDisplayProperties2KHR&& move_src) noexcept;
+    safe_VkDisplayProperties2KHR& operator=(safe_VkDisplayProperties2KHR&& move_src) noexcept;
     safe_VkDisplayProperties2KHR();
     ~safe_VkDisplayProperties2KHR();
     void initialize(const VkDisplayProperties2KHR* in_struct, PNextCopyState* copy_state = {});
@@ -6697,6 +7419,8 @@ struct safe_VkDisplayPlaneProperties2KHR {
                                       bool copy_pnext = true);
     safe_VkDisplayPlaneProperties2KHR(const safe_VkDisplayPlaneProperties2KHR& copy_src);
     safe_VkDisplayPlaneProperties2KHR& operator=(const safe_VkDisplayPlaneProperties2KHR& copy_src);
+    safe_VkDisplayPlaneProperties2KHR(safe_VkDisplayPlaneProperties2KHR&& move_src) noexcept;
+    safe_VkDisplayPlaneProperties2KHR& operator=(safe_VkDisplayPlaneProperties2KHR&& move_src) noexcept;
     safe_VkDisplayPlaneProperties2KHR();
     ~safe_VkDisplayPlaneProperties2KHR();
     void initialize(const VkDisplayPlaneProperties2KHR* in_struct, PNextCopyState* copy_state = {});
@@ -6713,6 +7437,8 @@ struct safe_VkDisplayModeProperties2KHR {
                                      bool copy_pnext = true);
     safe_VkDisplayModeProperties2KHR(const safe_VkDisplayModeProperties2KHR& copy_src);
     safe_VkDisplayModeProperties2KHR& operator=(const safe_VkDisplayModeProperties2KHR& copy_src);
+    safe_VkDisplayModeProperties2KHR(safe_VkDisplayModeProperties2KHR&& move_src) noexcept;
+    safe_VkDisplayModeProperties2KHR& operator=(safe_VkDisplayModeProperties2KHR&& move_src) noexcept;
     safe_VkDisplayModeProperties2KHR();
     ~safe_VkDisplayModeProperties2KHR();
     void initialize(const VkDisplayModeProperties2KHR* in_struct, PNextCopyState* copy_state = {});
@@ -6729,6 +7455,8 @@ struct safe_VkDisplayPlaneInfo2KHR {
     safe_VkDisplayPlaneInfo2KHR(const VkDisplayPlaneInfo2KHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDisplayPlaneInfo2KHR(const safe_VkDisplayPlaneInfo2KHR& copy_src);
     safe_VkDisplayPlaneInfo2KHR& operator=(const safe_VkDisplayPlaneInfo2KHR& copy_src);
+    safe_VkDisplayPlaneInfo2KHR(safe_VkDisplayPlaneInfo2KHR&& move_src) noexcept;
+    safe_VkDisplayPlaneInfo2KHR& operator=(safe_VkDisplayPlaneInfo2KHR&& move_src) noexcept;
     safe_VkDisplayPlaneInfo2KHR();
     ~safe_VkDisplayPlaneInfo2KHR();
     void initialize(const VkDisplayPlaneInfo2KHR* in_struct, PNextCopyState* copy_state = {});
@@ -6745,6 +7473,8 @@ struct safe_VkDisplayPlaneCapabilities2KHR {
                                         bool copy_pnext = true);
     safe_VkDisplayPlaneCapabilities2KHR(const safe_VkDisplayPlaneCapabilities2KHR& copy_src);
     safe_VkDisplayPlaneCapabilities2KHR& operator=(const safe_VkDisplayPlaneCapabilities2KHR& copy_src);
+    safe_VkDisplayPlaneCapabilities2KHR(safe_VkDisplayPlaneCapabilities2KHR&& move_src) noexcept;
+    safe_VkDisplayPlaneCapabilities2KHR& operator=(safe_VkDisplayPlaneCapabilities2KHR&& move_src) noexcept;
     safe_VkDisplayPlaneCapabilities2KHR();
     ~safe_VkDisplayPlaneCapabilities2KHR();
     void initialize(const VkDisplayPlaneCapabilities2KHR* in_struct, PNextCopyState* copy_state = {});
@@ -6776,6 +7506,9 @@ struct safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR(const safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR& copy_src);
     safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR& operator=(const safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR& copy_src);
+    safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR(safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR& operator=(
+        safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR();
     ~safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR();
     void initialize(const VkPhysicalDevicePortabilitySubsetFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6797,6 +7530,9 @@ struct safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR {
     safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR(const safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR& copy_src);
     safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR& operator=(
         const safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR& copy_src);
+    safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR(safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR&& move_src) noexcept;
+    safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR& operator=(
+        safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR&& move_src) noexcept;
     safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR();
     ~safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR();
     void initialize(const VkPhysicalDevicePortabilitySubsetPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6819,6 +7555,8 @@ struct safe_VkPhysicalDeviceShaderClockFeaturesKHR {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderClockFeaturesKHR(const safe_VkPhysicalDeviceShaderClockFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceShaderClockFeaturesKHR& operator=(const safe_VkPhysicalDeviceShaderClockFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceShaderClockFeaturesKHR(safe_VkPhysicalDeviceShaderClockFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderClockFeaturesKHR& operator=(safe_VkPhysicalDeviceShaderClockFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderClockFeaturesKHR();
     ~safe_VkPhysicalDeviceShaderClockFeaturesKHR();
     void initialize(const VkPhysicalDeviceShaderClockFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6837,6 +7575,8 @@ struct safe_VkVideoDecodeH265ProfileInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoDecodeH265ProfileInfoKHR(const safe_VkVideoDecodeH265ProfileInfoKHR& copy_src);
     safe_VkVideoDecodeH265ProfileInfoKHR& operator=(const safe_VkVideoDecodeH265ProfileInfoKHR& copy_src);
+    safe_VkVideoDecodeH265ProfileInfoKHR(safe_VkVideoDecodeH265ProfileInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH265ProfileInfoKHR& operator=(safe_VkVideoDecodeH265ProfileInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeH265ProfileInfoKHR();
     ~safe_VkVideoDecodeH265ProfileInfoKHR();
     void initialize(const VkVideoDecodeH265ProfileInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6853,6 +7593,8 @@ struct safe_VkVideoDecodeH265CapabilitiesKHR {
                                           bool copy_pnext = true);
     safe_VkVideoDecodeH265CapabilitiesKHR(const safe_VkVideoDecodeH265CapabilitiesKHR& copy_src);
     safe_VkVideoDecodeH265CapabilitiesKHR& operator=(const safe_VkVideoDecodeH265CapabilitiesKHR& copy_src);
+    safe_VkVideoDecodeH265CapabilitiesKHR(safe_VkVideoDecodeH265CapabilitiesKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH265CapabilitiesKHR& operator=(safe_VkVideoDecodeH265CapabilitiesKHR&& move_src) noexcept;
     safe_VkVideoDecodeH265CapabilitiesKHR();
     ~safe_VkVideoDecodeH265CapabilitiesKHR();
     void initialize(const VkVideoDecodeH265CapabilitiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6874,6 +7616,9 @@ struct safe_VkVideoDecodeH265SessionParametersAddInfoKHR {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoDecodeH265SessionParametersAddInfoKHR(const safe_VkVideoDecodeH265SessionParametersAddInfoKHR& copy_src);
     safe_VkVideoDecodeH265SessionParametersAddInfoKHR& operator=(const safe_VkVideoDecodeH265SessionParametersAddInfoKHR& copy_src);
+    safe_VkVideoDecodeH265SessionParametersAddInfoKHR(safe_VkVideoDecodeH265SessionParametersAddInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH265SessionParametersAddInfoKHR& operator=(
+        safe_VkVideoDecodeH265SessionParametersAddInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeH265SessionParametersAddInfoKHR();
     ~safe_VkVideoDecodeH265SessionParametersAddInfoKHR();
     void initialize(const VkVideoDecodeH265SessionParametersAddInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6898,6 +7643,9 @@ struct safe_VkVideoDecodeH265SessionParametersCreateInfoKHR {
     safe_VkVideoDecodeH265SessionParametersCreateInfoKHR(const safe_VkVideoDecodeH265SessionParametersCreateInfoKHR& copy_src);
     safe_VkVideoDecodeH265SessionParametersCreateInfoKHR& operator=(
         const safe_VkVideoDecodeH265SessionParametersCreateInfoKHR& copy_src);
+    safe_VkVideoDecodeH265SessionParametersCreateInfoKHR(safe_VkVideoDecodeH265SessionParametersCreateInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH265SessionParametersCreateInfoKHR& operator=(
+        safe_VkVideoDecodeH265SessionParametersCreateInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeH265SessionParametersCreateInfoKHR();
     ~safe_VkVideoDecodeH265SessionParametersCreateInfoKHR();
     void initialize(const VkVideoDecodeH265SessionParametersCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6920,6 +7668,8 @@ struct safe_VkVideoDecodeH265PictureInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoDecodeH265PictureInfoKHR(const safe_VkVideoDecodeH265PictureInfoKHR& copy_src);
     safe_VkVideoDecodeH265PictureInfoKHR& operator=(const safe_VkVideoDecodeH265PictureInfoKHR& copy_src);
+    safe_VkVideoDecodeH265PictureInfoKHR(safe_VkVideoDecodeH265PictureInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH265PictureInfoKHR& operator=(safe_VkVideoDecodeH265PictureInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeH265PictureInfoKHR();
     ~safe_VkVideoDecodeH265PictureInfoKHR();
     void initialize(const VkVideoDecodeH265PictureInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6936,6 +7686,8 @@ struct safe_VkVideoDecodeH265DpbSlotInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoDecodeH265DpbSlotInfoKHR(const safe_VkVideoDecodeH265DpbSlotInfoKHR& copy_src);
     safe_VkVideoDecodeH265DpbSlotInfoKHR& operator=(const safe_VkVideoDecodeH265DpbSlotInfoKHR& copy_src);
+    safe_VkVideoDecodeH265DpbSlotInfoKHR(safe_VkVideoDecodeH265DpbSlotInfoKHR&& move_src) noexcept;
+    safe_VkVideoDecodeH265DpbSlotInfoKHR& operator=(safe_VkVideoDecodeH265DpbSlotInfoKHR&& move_src) noexcept;
     safe_VkVideoDecodeH265DpbSlotInfoKHR();
     ~safe_VkVideoDecodeH265DpbSlotInfoKHR();
     void initialize(const VkVideoDecodeH265DpbSlotInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6952,6 +7704,8 @@ struct safe_VkDeviceQueueGlobalPriorityCreateInfoKHR {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceQueueGlobalPriorityCreateInfoKHR(const safe_VkDeviceQueueGlobalPriorityCreateInfoKHR& copy_src);
     safe_VkDeviceQueueGlobalPriorityCreateInfoKHR& operator=(const safe_VkDeviceQueueGlobalPriorityCreateInfoKHR& copy_src);
+    safe_VkDeviceQueueGlobalPriorityCreateInfoKHR(safe_VkDeviceQueueGlobalPriorityCreateInfoKHR&& move_src) noexcept;
+    safe_VkDeviceQueueGlobalPriorityCreateInfoKHR& operator=(safe_VkDeviceQueueGlobalPriorityCreateInfoKHR&& move_src) noexcept;
     safe_VkDeviceQueueGlobalPriorityCreateInfoKHR();
     ~safe_VkDeviceQueueGlobalPriorityCreateInfoKHR();
     void initialize(const VkDeviceQueueGlobalPriorityCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6971,6 +7725,9 @@ struct safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR {
     safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR(const safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& operator=(
         const safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR(safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& operator=(
+        safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR();
     ~safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR();
     void initialize(const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -6992,6 +7749,8 @@ struct safe_VkQueueFamilyGlobalPriorityPropertiesKHR {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkQueueFamilyGlobalPriorityPropertiesKHR(const safe_VkQueueFamilyGlobalPriorityPropertiesKHR& copy_src);
     safe_VkQueueFamilyGlobalPriorityPropertiesKHR& operator=(const safe_VkQueueFamilyGlobalPriorityPropertiesKHR& copy_src);
+    safe_VkQueueFamilyGlobalPriorityPropertiesKHR(safe_VkQueueFamilyGlobalPriorityPropertiesKHR&& move_src) noexcept;
+    safe_VkQueueFamilyGlobalPriorityPropertiesKHR& operator=(safe_VkQueueFamilyGlobalPriorityPropertiesKHR&& move_src) noexcept;
     safe_VkQueueFamilyGlobalPriorityPropertiesKHR();
     ~safe_VkQueueFamilyGlobalPriorityPropertiesKHR();
     void initialize(const VkQueueFamilyGlobalPriorityPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7011,6 +7770,8 @@ struct safe_VkFragmentShadingRateAttachmentInfoKHR {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkFragmentShadingRateAttachmentInfoKHR(const safe_VkFragmentShadingRateAttachmentInfoKHR& copy_src);
     safe_VkFragmentShadingRateAttachmentInfoKHR& operator=(const safe_VkFragmentShadingRateAttachmentInfoKHR& copy_src);
+    safe_VkFragmentShadingRateAttachmentInfoKHR(safe_VkFragmentShadingRateAttachmentInfoKHR&& move_src) noexcept;
+    safe_VkFragmentShadingRateAttachmentInfoKHR& operator=(safe_VkFragmentShadingRateAttachmentInfoKHR&& move_src) noexcept;
     safe_VkFragmentShadingRateAttachmentInfoKHR();
     ~safe_VkFragmentShadingRateAttachmentInfoKHR();
     void initialize(const VkFragmentShadingRateAttachmentInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7031,6 +7792,9 @@ struct safe_VkPipelineFragmentShadingRateStateCreateInfoKHR {
     safe_VkPipelineFragmentShadingRateStateCreateInfoKHR(const safe_VkPipelineFragmentShadingRateStateCreateInfoKHR& copy_src);
     safe_VkPipelineFragmentShadingRateStateCreateInfoKHR& operator=(
         const safe_VkPipelineFragmentShadingRateStateCreateInfoKHR& copy_src);
+    safe_VkPipelineFragmentShadingRateStateCreateInfoKHR(safe_VkPipelineFragmentShadingRateStateCreateInfoKHR&& move_src) noexcept;
+    safe_VkPipelineFragmentShadingRateStateCreateInfoKHR& operator=(
+        safe_VkPipelineFragmentShadingRateStateCreateInfoKHR&& move_src) noexcept;
     safe_VkPipelineFragmentShadingRateStateCreateInfoKHR();
     ~safe_VkPipelineFragmentShadingRateStateCreateInfoKHR();
     void initialize(const VkPipelineFragmentShadingRateStateCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7054,6 +7818,9 @@ struct safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR {
     safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR(const safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR& operator=(
         const safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR(safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR& operator=(
+        safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR();
     ~safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR();
     void initialize(const VkPhysicalDeviceFragmentShadingRateFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7091,6 +7858,10 @@ struct safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR {
     safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR(const safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR& copy_src);
     safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR& operator=(
         const safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR& copy_src);
+    safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR(
+        safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR& operator=(
+        safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR();
     ~safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR();
     void initialize(const VkPhysicalDeviceFragmentShadingRatePropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7112,6 +7883,8 @@ struct safe_VkPhysicalDeviceFragmentShadingRateKHR {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceFragmentShadingRateKHR(const safe_VkPhysicalDeviceFragmentShadingRateKHR& copy_src);
     safe_VkPhysicalDeviceFragmentShadingRateKHR& operator=(const safe_VkPhysicalDeviceFragmentShadingRateKHR& copy_src);
+    safe_VkPhysicalDeviceFragmentShadingRateKHR(safe_VkPhysicalDeviceFragmentShadingRateKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentShadingRateKHR& operator=(safe_VkPhysicalDeviceFragmentShadingRateKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentShadingRateKHR();
     ~safe_VkPhysicalDeviceFragmentShadingRateKHR();
     void initialize(const VkPhysicalDeviceFragmentShadingRateKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7130,6 +7903,8 @@ struct safe_VkSurfaceProtectedCapabilitiesKHR {
                                            bool copy_pnext = true);
     safe_VkSurfaceProtectedCapabilitiesKHR(const safe_VkSurfaceProtectedCapabilitiesKHR& copy_src);
     safe_VkSurfaceProtectedCapabilitiesKHR& operator=(const safe_VkSurfaceProtectedCapabilitiesKHR& copy_src);
+    safe_VkSurfaceProtectedCapabilitiesKHR(safe_VkSurfaceProtectedCapabilitiesKHR&& move_src) noexcept;
+    safe_VkSurfaceProtectedCapabilitiesKHR& operator=(safe_VkSurfaceProtectedCapabilitiesKHR&& move_src) noexcept;
     safe_VkSurfaceProtectedCapabilitiesKHR();
     ~safe_VkSurfaceProtectedCapabilitiesKHR();
     void initialize(const VkSurfaceProtectedCapabilitiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7148,6 +7923,8 @@ struct safe_VkPhysicalDevicePresentWaitFeaturesKHR {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDevicePresentWaitFeaturesKHR(const safe_VkPhysicalDevicePresentWaitFeaturesKHR& copy_src);
     safe_VkPhysicalDevicePresentWaitFeaturesKHR& operator=(const safe_VkPhysicalDevicePresentWaitFeaturesKHR& copy_src);
+    safe_VkPhysicalDevicePresentWaitFeaturesKHR(safe_VkPhysicalDevicePresentWaitFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDevicePresentWaitFeaturesKHR& operator=(safe_VkPhysicalDevicePresentWaitFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDevicePresentWaitFeaturesKHR();
     ~safe_VkPhysicalDevicePresentWaitFeaturesKHR();
     void initialize(const VkPhysicalDevicePresentWaitFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7169,6 +7946,10 @@ struct safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR {
         const safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& copy_src);
     safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& operator=(
         const safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& copy_src);
+    safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR(
+        safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& operator=(
+        safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR();
     ~safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR();
     void initialize(const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7188,6 +7969,8 @@ struct safe_VkPipelineInfoKHR {
     safe_VkPipelineInfoKHR(const VkPipelineInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineInfoKHR(const safe_VkPipelineInfoKHR& copy_src);
     safe_VkPipelineInfoKHR& operator=(const safe_VkPipelineInfoKHR& copy_src);
+    safe_VkPipelineInfoKHR(safe_VkPipelineInfoKHR&& move_src) noexcept;
+    safe_VkPipelineInfoKHR& operator=(safe_VkPipelineInfoKHR&& move_src) noexcept;
     safe_VkPipelineInfoKHR();
     ~safe_VkPipelineInfoKHR();
     void initialize(const VkPipelineInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7207,6 +7990,8 @@ struct safe_VkPipelineExecutablePropertiesKHR {
                                            bool copy_pnext = true);
     safe_VkPipelineExecutablePropertiesKHR(const safe_VkPipelineExecutablePropertiesKHR& copy_src);
     safe_VkPipelineExecutablePropertiesKHR& operator=(const safe_VkPipelineExecutablePropertiesKHR& copy_src);
+    safe_VkPipelineExecutablePropertiesKHR(safe_VkPipelineExecutablePropertiesKHR&& move_src) noexcept;
+    safe_VkPipelineExecutablePropertiesKHR& operator=(safe_VkPipelineExecutablePropertiesKHR&& move_src) noexcept;
     safe_VkPipelineExecutablePropertiesKHR();
     ~safe_VkPipelineExecutablePropertiesKHR();
     void initialize(const VkPipelineExecutablePropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7226,6 +8011,8 @@ struct safe_VkPipelineExecutableInfoKHR {
                                      bool copy_pnext = true);
     safe_VkPipelineExecutableInfoKHR(const safe_VkPipelineExecutableInfoKHR& copy_src);
     safe_VkPipelineExecutableInfoKHR& operator=(const safe_VkPipelineExecutableInfoKHR& copy_src);
+    safe_VkPipelineExecutableInfoKHR(safe_VkPipelineExecutableInfoKHR&& move_src) noexcept;
+    safe_VkPipelineExecutableInfoKHR& operator=(safe_VkPipelineExecutableInfoKHR&& move_src) noexcept;
     safe_VkPipelineExecutableInfoKHR();
     ~safe_VkPipelineExecutableInfoKHR();
     void initialize(const VkPipelineExecutableInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7245,6 +8032,8 @@ struct safe_VkPipelineExecutableStatisticKHR {
                                           bool copy_pnext = true);
     safe_VkPipelineExecutableStatisticKHR(const safe_VkPipelineExecutableStatisticKHR& copy_src);
     safe_VkPipelineExecutableStatisticKHR& operator=(const safe_VkPipelineExecutableStatisticKHR& copy_src);
+    safe_VkPipelineExecutableStatisticKHR(safe_VkPipelineExecutableStatisticKHR&& move_src) noexcept;
+    safe_VkPipelineExecutableStatisticKHR& operator=(safe_VkPipelineExecutableStatisticKHR&& move_src) noexcept;
     safe_VkPipelineExecutableStatisticKHR();
     ~safe_VkPipelineExecutableStatisticKHR();
     void initialize(const VkPipelineExecutableStatisticKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7266,6 +8055,9 @@ struct safe_VkPipelineExecutableInternalRepresentationKHR {
     safe_VkPipelineExecutableInternalRepresentationKHR(const safe_VkPipelineExecutableInternalRepresentationKHR& copy_src);
     safe_VkPipelineExecutableInternalRepresentationKHR& operator=(
         const safe_VkPipelineExecutableInternalRepresentationKHR& copy_src);
+    safe_VkPipelineExecutableInternalRepresentationKHR(safe_VkPipelineExecutableInternalRepresentationKHR&& move_src) noexcept;
+    safe_VkPipelineExecutableInternalRepresentationKHR& operator=(
+        safe_VkPipelineExecutableInternalRepresentationKHR&& move_src) noexcept;
     safe_VkPipelineExecutableInternalRepresentationKHR();
     ~safe_VkPipelineExecutableInternalRepresentationKHR();
     void initialize(const VkPipelineExecutableInternalRepresentationKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7288,6 +8080,8 @@ struct safe_VkMemoryMapInfoKHR {
     safe_VkMemoryMapInfoKHR(const VkMemoryMapInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryMapInfoKHR(const safe_VkMemoryMapInfoKHR& copy_src);
     safe_VkMemoryMapInfoKHR& operator=(const safe_VkMemoryMapInfoKHR& copy_src);
+    safe_VkMemoryMapInfoKHR(safe_VkMemoryMapInfoKHR&& move_src) noexcept;
+    safe_VkMemoryMapInfoKHR& operator=(safe_VkMemoryMapInfoKHR&& move_src) noexcept;
     safe_VkMemoryMapInfoKHR();
     ~safe_VkMemoryMapInfoKHR();
     void initialize(const VkMemoryMapInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7304,6 +8098,8 @@ struct safe_VkMemoryUnmapInfoKHR {
     safe_VkMemoryUnmapInfoKHR(const VkMemoryUnmapInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryUnmapInfoKHR(const safe_VkMemoryUnmapInfoKHR& copy_src);
     safe_VkMemoryUnmapInfoKHR& operator=(const safe_VkMemoryUnmapInfoKHR& copy_src);
+    safe_VkMemoryUnmapInfoKHR(safe_VkMemoryUnmapInfoKHR&& move_src) noexcept;
+    safe_VkMemoryUnmapInfoKHR& operator=(safe_VkMemoryUnmapInfoKHR&& move_src) noexcept;
     safe_VkMemoryUnmapInfoKHR();
     ~safe_VkMemoryUnmapInfoKHR();
     void initialize(const VkMemoryUnmapInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7321,6 +8117,8 @@ struct safe_VkPipelineLibraryCreateInfoKHR {
                                         bool copy_pnext = true);
     safe_VkPipelineLibraryCreateInfoKHR(const safe_VkPipelineLibraryCreateInfoKHR& copy_src);
     safe_VkPipelineLibraryCreateInfoKHR& operator=(const safe_VkPipelineLibraryCreateInfoKHR& copy_src);
+    safe_VkPipelineLibraryCreateInfoKHR(safe_VkPipelineLibraryCreateInfoKHR&& move_src) noexcept;
+    safe_VkPipelineLibraryCreateInfoKHR& operator=(safe_VkPipelineLibraryCreateInfoKHR&& move_src) noexcept;
     safe_VkPipelineLibraryCreateInfoKHR();
     ~safe_VkPipelineLibraryCreateInfoKHR();
     void initialize(const VkPipelineLibraryCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7337,6 +8135,8 @@ struct safe_VkPresentIdKHR {
     safe_VkPresentIdKHR(const VkPresentIdKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPresentIdKHR(const safe_VkPresentIdKHR& copy_src);
     safe_VkPresentIdKHR& operator=(const safe_VkPresentIdKHR& copy_src);
+    safe_VkPresentIdKHR(safe_VkPresentIdKHR&& move_src) noexcept;
+    safe_VkPresentIdKHR& operator=(safe_VkPresentIdKHR&& move_src) noexcept;
     safe_VkPresentIdKHR();
     ~safe_VkPresentIdKHR();
     void initialize(const VkPresentIdKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7353,6 +8153,8 @@ struct safe_VkPhysicalDevicePresentIdFeaturesKHR {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDevicePresentIdFeaturesKHR(const safe_VkPhysicalDevicePresentIdFeaturesKHR& copy_src);
     safe_VkPhysicalDevicePresentIdFeaturesKHR& operator=(const safe_VkPhysicalDevicePresentIdFeaturesKHR& copy_src);
+    safe_VkPhysicalDevicePresentIdFeaturesKHR(safe_VkPhysicalDevicePresentIdFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDevicePresentIdFeaturesKHR& operator=(safe_VkPhysicalDevicePresentIdFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDevicePresentIdFeaturesKHR();
     ~safe_VkPhysicalDevicePresentIdFeaturesKHR();
     void initialize(const VkPhysicalDevicePresentIdFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7378,6 +8180,8 @@ struct safe_VkVideoEncodeInfoKHR {
     safe_VkVideoEncodeInfoKHR(const VkVideoEncodeInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeInfoKHR(const safe_VkVideoEncodeInfoKHR& copy_src);
     safe_VkVideoEncodeInfoKHR& operator=(const safe_VkVideoEncodeInfoKHR& copy_src);
+    safe_VkVideoEncodeInfoKHR(safe_VkVideoEncodeInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeInfoKHR& operator=(safe_VkVideoEncodeInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeInfoKHR();
     ~safe_VkVideoEncodeInfoKHR();
     void initialize(const VkVideoEncodeInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7400,6 +8204,8 @@ struct safe_VkVideoEncodeCapabilitiesKHR {
                                       bool copy_pnext = true);
     safe_VkVideoEncodeCapabilitiesKHR(const safe_VkVideoEncodeCapabilitiesKHR& copy_src);
     safe_VkVideoEncodeCapabilitiesKHR& operator=(const safe_VkVideoEncodeCapabilitiesKHR& copy_src);
+    safe_VkVideoEncodeCapabilitiesKHR(safe_VkVideoEncodeCapabilitiesKHR&& move_src) noexcept;
+    safe_VkVideoEncodeCapabilitiesKHR& operator=(safe_VkVideoEncodeCapabilitiesKHR&& move_src) noexcept;
     safe_VkVideoEncodeCapabilitiesKHR();
     ~safe_VkVideoEncodeCapabilitiesKHR();
     void initialize(const VkVideoEncodeCapabilitiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7416,6 +8222,9 @@ struct safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR(const safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& copy_src);
     safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& operator=(const safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& copy_src);
+    safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR(safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR&& move_src) noexcept;
+    safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& operator=(
+        safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR&& move_src) noexcept;
     safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR();
     ~safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR();
     void initialize(const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7438,6 +8247,8 @@ struct safe_VkVideoEncodeUsageInfoKHR {
                                    bool copy_pnext = true);
     safe_VkVideoEncodeUsageInfoKHR(const safe_VkVideoEncodeUsageInfoKHR& copy_src);
     safe_VkVideoEncodeUsageInfoKHR& operator=(const safe_VkVideoEncodeUsageInfoKHR& copy_src);
+    safe_VkVideoEncodeUsageInfoKHR(safe_VkVideoEncodeUsageInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeUsageInfoKHR& operator=(safe_VkVideoEncodeUsageInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeUsageInfoKHR();
     ~safe_VkVideoEncodeUsageInfoKHR();
     void initialize(const VkVideoEncodeUsageInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7457,6 +8268,8 @@ struct safe_VkVideoEncodeRateControlLayerInfoKHR {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeRateControlLayerInfoKHR(const safe_VkVideoEncodeRateControlLayerInfoKHR& copy_src);
     safe_VkVideoEncodeRateControlLayerInfoKHR& operator=(const safe_VkVideoEncodeRateControlLayerInfoKHR& copy_src);
+    safe_VkVideoEncodeRateControlLayerInfoKHR(safe_VkVideoEncodeRateControlLayerInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeRateControlLayerInfoKHR& operator=(safe_VkVideoEncodeRateControlLayerInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeRateControlLayerInfoKHR();
     ~safe_VkVideoEncodeRateControlLayerInfoKHR();
     void initialize(const VkVideoEncodeRateControlLayerInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7480,6 +8293,8 @@ struct safe_VkVideoEncodeRateControlInfoKHR {
                                          bool copy_pnext = true);
     safe_VkVideoEncodeRateControlInfoKHR(const safe_VkVideoEncodeRateControlInfoKHR& copy_src);
     safe_VkVideoEncodeRateControlInfoKHR& operator=(const safe_VkVideoEncodeRateControlInfoKHR& copy_src);
+    safe_VkVideoEncodeRateControlInfoKHR(safe_VkVideoEncodeRateControlInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeRateControlInfoKHR& operator=(safe_VkVideoEncodeRateControlInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeRateControlInfoKHR();
     ~safe_VkVideoEncodeRateControlInfoKHR();
     void initialize(const VkVideoEncodeRateControlInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7498,6 +8313,9 @@ struct safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR {
     safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR(const safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& copy_src);
     safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& operator=(
         const safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& copy_src);
+    safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR(safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& operator=(
+        safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR();
     ~safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR();
     void initialize(const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7519,6 +8337,8 @@ struct safe_VkVideoEncodeQualityLevelPropertiesKHR {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeQualityLevelPropertiesKHR(const safe_VkVideoEncodeQualityLevelPropertiesKHR& copy_src);
     safe_VkVideoEncodeQualityLevelPropertiesKHR& operator=(const safe_VkVideoEncodeQualityLevelPropertiesKHR& copy_src);
+    safe_VkVideoEncodeQualityLevelPropertiesKHR(safe_VkVideoEncodeQualityLevelPropertiesKHR&& move_src) noexcept;
+    safe_VkVideoEncodeQualityLevelPropertiesKHR& operator=(safe_VkVideoEncodeQualityLevelPropertiesKHR&& move_src) noexcept;
     safe_VkVideoEncodeQualityLevelPropertiesKHR();
     ~safe_VkVideoEncodeQualityLevelPropertiesKHR();
     void initialize(const VkVideoEncodeQualityLevelPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7537,6 +8357,8 @@ struct safe_VkVideoEncodeQualityLevelInfoKHR {
                                           bool copy_pnext = true);
     safe_VkVideoEncodeQualityLevelInfoKHR(const safe_VkVideoEncodeQualityLevelInfoKHR& copy_src);
     safe_VkVideoEncodeQualityLevelInfoKHR& operator=(const safe_VkVideoEncodeQualityLevelInfoKHR& copy_src);
+    safe_VkVideoEncodeQualityLevelInfoKHR(safe_VkVideoEncodeQualityLevelInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeQualityLevelInfoKHR& operator=(safe_VkVideoEncodeQualityLevelInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeQualityLevelInfoKHR();
     ~safe_VkVideoEncodeQualityLevelInfoKHR();
     void initialize(const VkVideoEncodeQualityLevelInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7553,6 +8375,8 @@ struct safe_VkVideoEncodeSessionParametersGetInfoKHR {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVideoEncodeSessionParametersGetInfoKHR(const safe_VkVideoEncodeSessionParametersGetInfoKHR& copy_src);
     safe_VkVideoEncodeSessionParametersGetInfoKHR& operator=(const safe_VkVideoEncodeSessionParametersGetInfoKHR& copy_src);
+    safe_VkVideoEncodeSessionParametersGetInfoKHR(safe_VkVideoEncodeSessionParametersGetInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeSessionParametersGetInfoKHR& operator=(safe_VkVideoEncodeSessionParametersGetInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeSessionParametersGetInfoKHR();
     ~safe_VkVideoEncodeSessionParametersGetInfoKHR();
     void initialize(const VkVideoEncodeSessionParametersGetInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7572,6 +8396,9 @@ struct safe_VkVideoEncodeSessionParametersFeedbackInfoKHR {
     safe_VkVideoEncodeSessionParametersFeedbackInfoKHR(const safe_VkVideoEncodeSessionParametersFeedbackInfoKHR& copy_src);
     safe_VkVideoEncodeSessionParametersFeedbackInfoKHR& operator=(
         const safe_VkVideoEncodeSessionParametersFeedbackInfoKHR& copy_src);
+    safe_VkVideoEncodeSessionParametersFeedbackInfoKHR(safe_VkVideoEncodeSessionParametersFeedbackInfoKHR&& move_src) noexcept;
+    safe_VkVideoEncodeSessionParametersFeedbackInfoKHR& operator=(
+        safe_VkVideoEncodeSessionParametersFeedbackInfoKHR&& move_src) noexcept;
     safe_VkVideoEncodeSessionParametersFeedbackInfoKHR();
     ~safe_VkVideoEncodeSessionParametersFeedbackInfoKHR();
     void initialize(const VkVideoEncodeSessionParametersFeedbackInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7592,6 +8419,8 @@ struct safe_VkQueueFamilyCheckpointProperties2NV {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkQueueFamilyCheckpointProperties2NV(const safe_VkQueueFamilyCheckpointProperties2NV& copy_src);
     safe_VkQueueFamilyCheckpointProperties2NV& operator=(const safe_VkQueueFamilyCheckpointProperties2NV& copy_src);
+    safe_VkQueueFamilyCheckpointProperties2NV(safe_VkQueueFamilyCheckpointProperties2NV&& move_src) noexcept;
+    safe_VkQueueFamilyCheckpointProperties2NV& operator=(safe_VkQueueFamilyCheckpointProperties2NV&& move_src) noexcept;
     safe_VkQueueFamilyCheckpointProperties2NV();
     ~safe_VkQueueFamilyCheckpointProperties2NV();
     void initialize(const VkQueueFamilyCheckpointProperties2NV* in_struct, PNextCopyState* copy_state = {});
@@ -7610,6 +8439,8 @@ struct safe_VkCheckpointData2NV {
     safe_VkCheckpointData2NV(const VkCheckpointData2NV* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCheckpointData2NV(const safe_VkCheckpointData2NV& copy_src);
     safe_VkCheckpointData2NV& operator=(const safe_VkCheckpointData2NV& copy_src);
+    safe_VkCheckpointData2NV(safe_VkCheckpointData2NV&& move_src) noexcept;
+    safe_VkCheckpointData2NV& operator=(safe_VkCheckpointData2NV&& move_src) noexcept;
     safe_VkCheckpointData2NV();
     ~safe_VkCheckpointData2NV();
     void initialize(const VkCheckpointData2NV* in_struct, PNextCopyState* copy_state = {});
@@ -7628,6 +8459,10 @@ struct safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR {
         const safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& operator=(
         const safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR(
+        safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& operator=(
+        safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR();
     ~safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR();
     void initialize(const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7651,6 +8486,10 @@ struct safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR {
         const safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& copy_src);
     safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& operator=(
         const safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& copy_src);
+    safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR(
+        safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& operator=(
+        safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR();
     ~safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR();
     void initialize(const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7674,6 +8513,10 @@ struct safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR {
         const safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& operator=(
         const safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR(
+        safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& operator=(
+        safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR();
     ~safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR();
     void initialize(const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7701,6 +8544,10 @@ struct safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR {
         const safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& operator=(
         const safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR(
+        safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& operator=(
+        safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR();
     ~safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR();
     void initialize(const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7723,6 +8570,10 @@ struct safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR {
     safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR(const safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& copy_src);
     safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& operator=(
         const safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR(
+        safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& operator=(
+        safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR();
     ~safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR();
     void initialize(const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7743,6 +8594,8 @@ struct safe_VkPhysicalDeviceMaintenance5FeaturesKHR {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMaintenance5FeaturesKHR(const safe_VkPhysicalDeviceMaintenance5FeaturesKHR& copy_src);
     safe_VkPhysicalDeviceMaintenance5FeaturesKHR& operator=(const safe_VkPhysicalDeviceMaintenance5FeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceMaintenance5FeaturesKHR(safe_VkPhysicalDeviceMaintenance5FeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceMaintenance5FeaturesKHR& operator=(safe_VkPhysicalDeviceMaintenance5FeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceMaintenance5FeaturesKHR();
     ~safe_VkPhysicalDeviceMaintenance5FeaturesKHR();
     void initialize(const VkPhysicalDeviceMaintenance5FeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7766,6 +8619,8 @@ struct safe_VkPhysicalDeviceMaintenance5PropertiesKHR {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMaintenance5PropertiesKHR(const safe_VkPhysicalDeviceMaintenance5PropertiesKHR& copy_src);
     safe_VkPhysicalDeviceMaintenance5PropertiesKHR& operator=(const safe_VkPhysicalDeviceMaintenance5PropertiesKHR& copy_src);
+    safe_VkPhysicalDeviceMaintenance5PropertiesKHR(safe_VkPhysicalDeviceMaintenance5PropertiesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceMaintenance5PropertiesKHR& operator=(safe_VkPhysicalDeviceMaintenance5PropertiesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceMaintenance5PropertiesKHR();
     ~safe_VkPhysicalDeviceMaintenance5PropertiesKHR();
     void initialize(const VkPhysicalDeviceMaintenance5PropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7787,6 +8642,8 @@ struct safe_VkRenderingAreaInfoKHR {
     safe_VkRenderingAreaInfoKHR(const VkRenderingAreaInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRenderingAreaInfoKHR(const safe_VkRenderingAreaInfoKHR& copy_src);
     safe_VkRenderingAreaInfoKHR& operator=(const safe_VkRenderingAreaInfoKHR& copy_src);
+    safe_VkRenderingAreaInfoKHR(safe_VkRenderingAreaInfoKHR&& move_src) noexcept;
+    safe_VkRenderingAreaInfoKHR& operator=(safe_VkRenderingAreaInfoKHR&& move_src) noexcept;
     safe_VkRenderingAreaInfoKHR();
     ~safe_VkRenderingAreaInfoKHR();
     void initialize(const VkRenderingAreaInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7802,6 +8659,8 @@ struct safe_VkImageSubresource2KHR {
     safe_VkImageSubresource2KHR(const VkImageSubresource2KHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageSubresource2KHR(const safe_VkImageSubresource2KHR& copy_src);
     safe_VkImageSubresource2KHR& operator=(const safe_VkImageSubresource2KHR& copy_src);
+    safe_VkImageSubresource2KHR(safe_VkImageSubresource2KHR&& move_src) noexcept;
+    safe_VkImageSubresource2KHR& operator=(safe_VkImageSubresource2KHR&& move_src) noexcept;
     safe_VkImageSubresource2KHR();
     ~safe_VkImageSubresource2KHR();
     void initialize(const VkImageSubresource2KHR* in_struct, PNextCopyState* copy_state = {});
@@ -7819,6 +8678,8 @@ struct safe_VkDeviceImageSubresourceInfoKHR {
                                          bool copy_pnext = true);
     safe_VkDeviceImageSubresourceInfoKHR(const safe_VkDeviceImageSubresourceInfoKHR& copy_src);
     safe_VkDeviceImageSubresourceInfoKHR& operator=(const safe_VkDeviceImageSubresourceInfoKHR& copy_src);
+    safe_VkDeviceImageSubresourceInfoKHR(safe_VkDeviceImageSubresourceInfoKHR&& move_src) noexcept;
+    safe_VkDeviceImageSubresourceInfoKHR& operator=(safe_VkDeviceImageSubresourceInfoKHR&& move_src) noexcept;
     safe_VkDeviceImageSubresourceInfoKHR();
     ~safe_VkDeviceImageSubresourceInfoKHR();
     void initialize(const VkDeviceImageSubresourceInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7834,6 +8695,8 @@ struct safe_VkSubresourceLayout2KHR {
     safe_VkSubresourceLayout2KHR(const VkSubresourceLayout2KHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSubresourceLayout2KHR(const safe_VkSubresourceLayout2KHR& copy_src);
     safe_VkSubresourceLayout2KHR& operator=(const safe_VkSubresourceLayout2KHR& copy_src);
+    safe_VkSubresourceLayout2KHR(safe_VkSubresourceLayout2KHR&& move_src) noexcept;
+    safe_VkSubresourceLayout2KHR& operator=(safe_VkSubresourceLayout2KHR&& move_src) noexcept;
     safe_VkSubresourceLayout2KHR();
     ~safe_VkSubresourceLayout2KHR();
     void initialize(const VkSubresourceLayout2KHR* in_struct, PNextCopyState* copy_state = {});
@@ -7850,6 +8713,8 @@ struct safe_VkPipelineCreateFlags2CreateInfoKHR {
                                              bool copy_pnext = true);
     safe_VkPipelineCreateFlags2CreateInfoKHR(const safe_VkPipelineCreateFlags2CreateInfoKHR& copy_src);
     safe_VkPipelineCreateFlags2CreateInfoKHR& operator=(const safe_VkPipelineCreateFlags2CreateInfoKHR& copy_src);
+    safe_VkPipelineCreateFlags2CreateInfoKHR(safe_VkPipelineCreateFlags2CreateInfoKHR&& move_src) noexcept;
+    safe_VkPipelineCreateFlags2CreateInfoKHR& operator=(safe_VkPipelineCreateFlags2CreateInfoKHR&& move_src) noexcept;
     safe_VkPipelineCreateFlags2CreateInfoKHR();
     ~safe_VkPipelineCreateFlags2CreateInfoKHR();
     void initialize(const VkPipelineCreateFlags2CreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7868,6 +8733,8 @@ struct safe_VkBufferUsageFlags2CreateInfoKHR {
                                           bool copy_pnext = true);
     safe_VkBufferUsageFlags2CreateInfoKHR(const safe_VkBufferUsageFlags2CreateInfoKHR& copy_src);
     safe_VkBufferUsageFlags2CreateInfoKHR& operator=(const safe_VkBufferUsageFlags2CreateInfoKHR& copy_src);
+    safe_VkBufferUsageFlags2CreateInfoKHR(safe_VkBufferUsageFlags2CreateInfoKHR&& move_src) noexcept;
+    safe_VkBufferUsageFlags2CreateInfoKHR& operator=(safe_VkBufferUsageFlags2CreateInfoKHR&& move_src) noexcept;
     safe_VkBufferUsageFlags2CreateInfoKHR();
     ~safe_VkBufferUsageFlags2CreateInfoKHR();
     void initialize(const VkBufferUsageFlags2CreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7886,6 +8753,10 @@ struct safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR {
         const safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& operator=(
         const safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR(
+        safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& operator=(
+        safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR();
     ~safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR();
     void initialize(const VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7914,6 +8785,8 @@ struct safe_VkCooperativeMatrixPropertiesKHR {
                                           bool copy_pnext = true);
     safe_VkCooperativeMatrixPropertiesKHR(const safe_VkCooperativeMatrixPropertiesKHR& copy_src);
     safe_VkCooperativeMatrixPropertiesKHR& operator=(const safe_VkCooperativeMatrixPropertiesKHR& copy_src);
+    safe_VkCooperativeMatrixPropertiesKHR(safe_VkCooperativeMatrixPropertiesKHR&& move_src) noexcept;
+    safe_VkCooperativeMatrixPropertiesKHR& operator=(safe_VkCooperativeMatrixPropertiesKHR&& move_src) noexcept;
     safe_VkCooperativeMatrixPropertiesKHR();
     ~safe_VkCooperativeMatrixPropertiesKHR();
     void initialize(const VkCooperativeMatrixPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7931,6 +8804,9 @@ struct safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR(const safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR& operator=(const safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR(safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR& operator=(
+        safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR();
     ~safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR();
     void initialize(const VkPhysicalDeviceCooperativeMatrixFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7952,6 +8828,9 @@ struct safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR {
     safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR(const safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR& copy_src);
     safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR& operator=(
         const safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR& copy_src);
+    safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR(safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR& operator=(
+        safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR();
     ~safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR();
     void initialize(const VkPhysicalDeviceCooperativeMatrixPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7972,6 +8851,9 @@ struct safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR(const safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR& copy_src);
     safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR& operator=(const safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR(safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR& operator=(
+        safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR();
     ~safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR();
     void initialize(const VkPhysicalDeviceVideoMaintenance1FeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -7994,6 +8876,8 @@ struct safe_VkVideoInlineQueryInfoKHR {
                                    bool copy_pnext = true);
     safe_VkVideoInlineQueryInfoKHR(const safe_VkVideoInlineQueryInfoKHR& copy_src);
     safe_VkVideoInlineQueryInfoKHR& operator=(const safe_VkVideoInlineQueryInfoKHR& copy_src);
+    safe_VkVideoInlineQueryInfoKHR(safe_VkVideoInlineQueryInfoKHR&& move_src) noexcept;
+    safe_VkVideoInlineQueryInfoKHR& operator=(safe_VkVideoInlineQueryInfoKHR&& move_src) noexcept;
     safe_VkVideoInlineQueryInfoKHR();
     ~safe_VkVideoInlineQueryInfoKHR();
     void initialize(const VkVideoInlineQueryInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8013,6 +8897,10 @@ struct safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR {
         const safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR& copy_src);
     safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR& operator=(
         const safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR& copy_src);
+    safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR(
+        safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR& operator=(
+        safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR();
     ~safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR();
     void initialize(const VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8035,6 +8923,9 @@ struct safe_VkPipelineVertexInputDivisorStateCreateInfoKHR {
     safe_VkPipelineVertexInputDivisorStateCreateInfoKHR(const safe_VkPipelineVertexInputDivisorStateCreateInfoKHR& copy_src);
     safe_VkPipelineVertexInputDivisorStateCreateInfoKHR& operator=(
         const safe_VkPipelineVertexInputDivisorStateCreateInfoKHR& copy_src);
+    safe_VkPipelineVertexInputDivisorStateCreateInfoKHR(safe_VkPipelineVertexInputDivisorStateCreateInfoKHR&& move_src) noexcept;
+    safe_VkPipelineVertexInputDivisorStateCreateInfoKHR& operator=(
+        safe_VkPipelineVertexInputDivisorStateCreateInfoKHR&& move_src) noexcept;
     safe_VkPipelineVertexInputDivisorStateCreateInfoKHR();
     ~safe_VkPipelineVertexInputDivisorStateCreateInfoKHR();
     void initialize(const VkPipelineVertexInputDivisorStateCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8057,6 +8948,10 @@ struct safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR {
     safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR(const safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR& operator=(
         const safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR(
+        safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR& operator=(
+        safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR();
     ~safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR();
     void initialize(const VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8077,6 +8972,8 @@ struct safe_VkCalibratedTimestampInfoKHR {
                                       bool copy_pnext = true);
     safe_VkCalibratedTimestampInfoKHR(const safe_VkCalibratedTimestampInfoKHR& copy_src);
     safe_VkCalibratedTimestampInfoKHR& operator=(const safe_VkCalibratedTimestampInfoKHR& copy_src);
+    safe_VkCalibratedTimestampInfoKHR(safe_VkCalibratedTimestampInfoKHR&& move_src) noexcept;
+    safe_VkCalibratedTimestampInfoKHR& operator=(safe_VkCalibratedTimestampInfoKHR&& move_src) noexcept;
     safe_VkCalibratedTimestampInfoKHR();
     ~safe_VkCalibratedTimestampInfoKHR();
     void initialize(const VkCalibratedTimestampInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8093,6 +8990,8 @@ struct safe_VkPhysicalDeviceMaintenance6FeaturesKHR {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMaintenance6FeaturesKHR(const safe_VkPhysicalDeviceMaintenance6FeaturesKHR& copy_src);
     safe_VkPhysicalDeviceMaintenance6FeaturesKHR& operator=(const safe_VkPhysicalDeviceMaintenance6FeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceMaintenance6FeaturesKHR(safe_VkPhysicalDeviceMaintenance6FeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceMaintenance6FeaturesKHR& operator=(safe_VkPhysicalDeviceMaintenance6FeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceMaintenance6FeaturesKHR();
     ~safe_VkPhysicalDeviceMaintenance6FeaturesKHR();
     void initialize(const VkPhysicalDeviceMaintenance6FeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8113,6 +9012,8 @@ struct safe_VkPhysicalDeviceMaintenance6PropertiesKHR {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMaintenance6PropertiesKHR(const safe_VkPhysicalDeviceMaintenance6PropertiesKHR& copy_src);
     safe_VkPhysicalDeviceMaintenance6PropertiesKHR& operator=(const safe_VkPhysicalDeviceMaintenance6PropertiesKHR& copy_src);
+    safe_VkPhysicalDeviceMaintenance6PropertiesKHR(safe_VkPhysicalDeviceMaintenance6PropertiesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceMaintenance6PropertiesKHR& operator=(safe_VkPhysicalDeviceMaintenance6PropertiesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceMaintenance6PropertiesKHR();
     ~safe_VkPhysicalDeviceMaintenance6PropertiesKHR();
     void initialize(const VkPhysicalDeviceMaintenance6PropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8130,6 +9031,8 @@ struct safe_VkBindMemoryStatusKHR {
     safe_VkBindMemoryStatusKHR(const VkBindMemoryStatusKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBindMemoryStatusKHR(const safe_VkBindMemoryStatusKHR& copy_src);
     safe_VkBindMemoryStatusKHR& operator=(const safe_VkBindMemoryStatusKHR& copy_src);
+    safe_VkBindMemoryStatusKHR(safe_VkBindMemoryStatusKHR&& move_src) noexcept;
+    safe_VkBindMemoryStatusKHR& operator=(safe_VkBindMemoryStatusKHR&& move_src) noexcept;
     safe_VkBindMemoryStatusKHR();
     ~safe_VkBindMemoryStatusKHR();
     void initialize(const VkBindMemoryStatusKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8152,6 +9055,8 @@ struct safe_VkBindDescriptorSetsInfoKHR {
                                      bool copy_pnext = true);
     safe_VkBindDescriptorSetsInfoKHR(const safe_VkBindDescriptorSetsInfoKHR& copy_src);
     safe_VkBindDescriptorSetsInfoKHR& operator=(const safe_VkBindDescriptorSetsInfoKHR& copy_src);
+    safe_VkBindDescriptorSetsInfoKHR(safe_VkBindDescriptorSetsInfoKHR&& move_src) noexcept;
+    safe_VkBindDescriptorSetsInfoKHR& operator=(safe_VkBindDescriptorSetsInfoKHR&& move_src) noexcept;
     safe_VkBindDescriptorSetsInfoKHR();
     ~safe_VkBindDescriptorSetsInfoKHR();
     void initialize(const VkBindDescriptorSetsInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8171,6 +9076,8 @@ struct safe_VkPushConstantsInfoKHR {
     safe_VkPushConstantsInfoKHR(const VkPushConstantsInfoKHR* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPushConstantsInfoKHR(const safe_VkPushConstantsInfoKHR& copy_src);
     safe_VkPushConstantsInfoKHR& operator=(const safe_VkPushConstantsInfoKHR& copy_src);
+    safe_VkPushConstantsInfoKHR(safe_VkPushConstantsInfoKHR&& move_src) noexcept;
+    safe_VkPushConstantsInfoKHR& operator=(safe_VkPushConstantsInfoKHR&& move_src) noexcept;
     safe_VkPushConstantsInfoKHR();
     ~safe_VkPushConstantsInfoKHR();
     void initialize(const VkPushConstantsInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8191,6 +9098,8 @@ struct safe_VkPushDescriptorSetInfoKHR {
                                     bool copy_pnext = true);
     safe_VkPushDescriptorSetInfoKHR(const safe_VkPushDescriptorSetInfoKHR& copy_src);
     safe_VkPushDescriptorSetInfoKHR& operator=(const safe_VkPushDescriptorSetInfoKHR& copy_src);
+    safe_VkPushDescriptorSetInfoKHR(safe_VkPushDescriptorSetInfoKHR&& move_src) noexcept;
+    safe_VkPushDescriptorSetInfoKHR& operator=(safe_VkPushDescriptorSetInfoKHR&& move_src) noexcept;
     safe_VkPushDescriptorSetInfoKHR();
     ~safe_VkPushDescriptorSetInfoKHR();
     void initialize(const VkPushDescriptorSetInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8210,6 +9119,8 @@ struct safe_VkPushDescriptorSetWithTemplateInfoKHR {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPushDescriptorSetWithTemplateInfoKHR(const safe_VkPushDescriptorSetWithTemplateInfoKHR& copy_src);
     safe_VkPushDescriptorSetWithTemplateInfoKHR& operator=(const safe_VkPushDescriptorSetWithTemplateInfoKHR& copy_src);
+    safe_VkPushDescriptorSetWithTemplateInfoKHR(safe_VkPushDescriptorSetWithTemplateInfoKHR&& move_src) noexcept;
+    safe_VkPushDescriptorSetWithTemplateInfoKHR& operator=(safe_VkPushDescriptorSetWithTemplateInfoKHR&& move_src) noexcept;
     safe_VkPushDescriptorSetWithTemplateInfoKHR();
     ~safe_VkPushDescriptorSetWithTemplateInfoKHR();
     void initialize(const VkPushDescriptorSetWithTemplateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -8233,6 +9144,8 @@ struct safe_VkSetDescriptorBufferOffsetsInfoEXT {
                                              bool copy_pnext = true);
     safe_VkSetDescriptorBufferOffsetsInfoEXT(const safe_VkSetDescriptorBufferOffsetsInfoEXT& copy_src);
     safe_VkSetDescriptorBufferOffsetsInfoEXT& operator=(const safe_VkSetDescriptorBufferOffsetsInfoEXT& copy_src);
+    safe_VkSetDescriptorBufferOffsetsInfoEXT(safe_VkSetDescriptorBufferOffsetsInfoEXT&& move_src) noexcept;
+    safe_VkSetDescriptorBufferOffsetsInfoEXT& operator=(safe_VkSetDescriptorBufferOffsetsInfoEXT&& move_src) noexcept;
     safe_VkSetDescriptorBufferOffsetsInfoEXT();
     ~safe_VkSetDescriptorBufferOffsetsInfoEXT();
     void initialize(const VkSetDescriptorBufferOffsetsInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8254,6 +9167,9 @@ struct safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT {
     safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT(const safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT& copy_src);
     safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT& operator=(
         const safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT& copy_src);
+    safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT(safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT&& move_src) noexcept;
+    safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT& operator=(
+        safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT&& move_src) noexcept;
     safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT();
     ~safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT();
     void initialize(const VkBindDescriptorBufferEmbeddedSamplersInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8276,6 +9192,8 @@ struct safe_VkDebugReportCallbackCreateInfoEXT {
                                             bool copy_pnext = true);
     safe_VkDebugReportCallbackCreateInfoEXT(const safe_VkDebugReportCallbackCreateInfoEXT& copy_src);
     safe_VkDebugReportCallbackCreateInfoEXT& operator=(const safe_VkDebugReportCallbackCreateInfoEXT& copy_src);
+    safe_VkDebugReportCallbackCreateInfoEXT(safe_VkDebugReportCallbackCreateInfoEXT&& move_src) noexcept;
+    safe_VkDebugReportCallbackCreateInfoEXT& operator=(safe_VkDebugReportCallbackCreateInfoEXT&& move_src) noexcept;
     safe_VkDebugReportCallbackCreateInfoEXT();
     ~safe_VkDebugReportCallbackCreateInfoEXT();
     void initialize(const VkDebugReportCallbackCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8295,6 +9213,10 @@ struct safe_VkPipelineRasterizationStateRasterizationOrderAMD {
     safe_VkPipelineRasterizationStateRasterizationOrderAMD(const safe_VkPipelineRasterizationStateRasterizationOrderAMD& copy_src);
     safe_VkPipelineRasterizationStateRasterizationOrderAMD& operator=(
         const safe_VkPipelineRasterizationStateRasterizationOrderAMD& copy_src);
+    safe_VkPipelineRasterizationStateRasterizationOrderAMD(
+        safe_VkPipelineRasterizationStateRasterizationOrderAMD&& move_src) noexcept;
+    safe_VkPipelineRasterizationStateRasterizationOrderAMD& operator=(
+        safe_VkPipelineRasterizationStateRasterizationOrderAMD&& move_src) noexcept;
     safe_VkPipelineRasterizationStateRasterizationOrderAMD();
     ~safe_VkPipelineRasterizationStateRasterizationOrderAMD();
     void initialize(const VkPipelineRasterizationStateRasterizationOrderAMD* in_struct, PNextCopyState* copy_state = {});
@@ -8317,6 +9239,8 @@ struct safe_VkDebugMarkerObjectNameInfoEXT {
                                         bool copy_pnext = true);
     safe_VkDebugMarkerObjectNameInfoEXT(const safe_VkDebugMarkerObjectNameInfoEXT& copy_src);
     safe_VkDebugMarkerObjectNameInfoEXT& operator=(const safe_VkDebugMarkerObjectNameInfoEXT& copy_src);
+    safe_VkDebugMarkerObjectNameInfoEXT(safe_VkDebugMarkerObjectNameInfoEXT&& move_src) noexcept;
+    safe_VkDebugMarkerObjectNameInfoEXT& operator=(safe_VkDebugMarkerObjectNameInfoEXT&& move_src) noexcept;
     safe_VkDebugMarkerObjectNameInfoEXT();
     ~safe_VkDebugMarkerObjectNameInfoEXT();
     void initialize(const VkDebugMarkerObjectNameInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8337,6 +9261,8 @@ struct safe_VkDebugMarkerObjectTagInfoEXT {
                                        bool copy_pnext = true);
     safe_VkDebugMarkerObjectTagInfoEXT(const safe_VkDebugMarkerObjectTagInfoEXT& copy_src);
     safe_VkDebugMarkerObjectTagInfoEXT& operator=(const safe_VkDebugMarkerObjectTagInfoEXT& copy_src);
+    safe_VkDebugMarkerObjectTagInfoEXT(safe_VkDebugMarkerObjectTagInfoEXT&& move_src) noexcept;
+    safe_VkDebugMarkerObjectTagInfoEXT& operator=(safe_VkDebugMarkerObjectTagInfoEXT&& move_src) noexcept;
     safe_VkDebugMarkerObjectTagInfoEXT();
     ~safe_VkDebugMarkerObjectTagInfoEXT();
     void initialize(const VkDebugMarkerObjectTagInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8354,6 +9280,8 @@ struct safe_VkDebugMarkerMarkerInfoEXT {
                                     bool copy_pnext = true);
     safe_VkDebugMarkerMarkerInfoEXT(const safe_VkDebugMarkerMarkerInfoEXT& copy_src);
     safe_VkDebugMarkerMarkerInfoEXT& operator=(const safe_VkDebugMarkerMarkerInfoEXT& copy_src);
+    safe_VkDebugMarkerMarkerInfoEXT(safe_VkDebugMarkerMarkerInfoEXT&& move_src) noexcept;
+    safe_VkDebugMarkerMarkerInfoEXT& operator=(safe_VkDebugMarkerMarkerInfoEXT&& move_src) noexcept;
     safe_VkDebugMarkerMarkerInfoEXT();
     ~safe_VkDebugMarkerMarkerInfoEXT();
     void initialize(const VkDebugMarkerMarkerInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8370,6 +9298,8 @@ struct safe_VkDedicatedAllocationImageCreateInfoNV {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDedicatedAllocationImageCreateInfoNV(const safe_VkDedicatedAllocationImageCreateInfoNV& copy_src);
     safe_VkDedicatedAllocationImageCreateInfoNV& operator=(const safe_VkDedicatedAllocationImageCreateInfoNV& copy_src);
+    safe_VkDedicatedAllocationImageCreateInfoNV(safe_VkDedicatedAllocationImageCreateInfoNV&& move_src) noexcept;
+    safe_VkDedicatedAllocationImageCreateInfoNV& operator=(safe_VkDedicatedAllocationImageCreateInfoNV&& move_src) noexcept;
     safe_VkDedicatedAllocationImageCreateInfoNV();
     ~safe_VkDedicatedAllocationImageCreateInfoNV();
     void initialize(const VkDedicatedAllocationImageCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -8388,6 +9318,8 @@ struct safe_VkDedicatedAllocationBufferCreateInfoNV {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDedicatedAllocationBufferCreateInfoNV(const safe_VkDedicatedAllocationBufferCreateInfoNV& copy_src);
     safe_VkDedicatedAllocationBufferCreateInfoNV& operator=(const safe_VkDedicatedAllocationBufferCreateInfoNV& copy_src);
+    safe_VkDedicatedAllocationBufferCreateInfoNV(safe_VkDedicatedAllocationBufferCreateInfoNV&& move_src) noexcept;
+    safe_VkDedicatedAllocationBufferCreateInfoNV& operator=(safe_VkDedicatedAllocationBufferCreateInfoNV&& move_src) noexcept;
     safe_VkDedicatedAllocationBufferCreateInfoNV();
     ~safe_VkDedicatedAllocationBufferCreateInfoNV();
     void initialize(const VkDedicatedAllocationBufferCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -8407,6 +9339,8 @@ struct safe_VkDedicatedAllocationMemoryAllocateInfoNV {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDedicatedAllocationMemoryAllocateInfoNV(const safe_VkDedicatedAllocationMemoryAllocateInfoNV& copy_src);
     safe_VkDedicatedAllocationMemoryAllocateInfoNV& operator=(const safe_VkDedicatedAllocationMemoryAllocateInfoNV& copy_src);
+    safe_VkDedicatedAllocationMemoryAllocateInfoNV(safe_VkDedicatedAllocationMemoryAllocateInfoNV&& move_src) noexcept;
+    safe_VkDedicatedAllocationMemoryAllocateInfoNV& operator=(safe_VkDedicatedAllocationMemoryAllocateInfoNV&& move_src) noexcept;
     safe_VkDedicatedAllocationMemoryAllocateInfoNV();
     ~safe_VkDedicatedAllocationMemoryAllocateInfoNV();
     void initialize(const VkDedicatedAllocationMemoryAllocateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -8426,6 +9360,9 @@ struct safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT(const safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& operator=(const safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT(safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT();
     ~safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT();
     void initialize(const VkPhysicalDeviceTransformFeedbackFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8456,6 +9393,9 @@ struct safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT {
     safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT(const safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT(safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT();
     ~safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT();
     void initialize(const VkPhysicalDeviceTransformFeedbackPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8478,6 +9418,9 @@ struct safe_VkPipelineRasterizationStateStreamCreateInfoEXT {
     safe_VkPipelineRasterizationStateStreamCreateInfoEXT(const safe_VkPipelineRasterizationStateStreamCreateInfoEXT& copy_src);
     safe_VkPipelineRasterizationStateStreamCreateInfoEXT& operator=(
         const safe_VkPipelineRasterizationStateStreamCreateInfoEXT& copy_src);
+    safe_VkPipelineRasterizationStateStreamCreateInfoEXT(safe_VkPipelineRasterizationStateStreamCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineRasterizationStateStreamCreateInfoEXT& operator=(
+        safe_VkPipelineRasterizationStateStreamCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineRasterizationStateStreamCreateInfoEXT();
     ~safe_VkPipelineRasterizationStateStreamCreateInfoEXT();
     void initialize(const VkPipelineRasterizationStateStreamCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8498,6 +9441,8 @@ struct safe_VkCuModuleCreateInfoNVX {
     safe_VkCuModuleCreateInfoNVX(const VkCuModuleCreateInfoNVX* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCuModuleCreateInfoNVX(const safe_VkCuModuleCreateInfoNVX& copy_src);
     safe_VkCuModuleCreateInfoNVX& operator=(const safe_VkCuModuleCreateInfoNVX& copy_src);
+    safe_VkCuModuleCreateInfoNVX(safe_VkCuModuleCreateInfoNVX&& move_src) noexcept;
+    safe_VkCuModuleCreateInfoNVX& operator=(safe_VkCuModuleCreateInfoNVX&& move_src) noexcept;
     safe_VkCuModuleCreateInfoNVX();
     ~safe_VkCuModuleCreateInfoNVX();
     void initialize(const VkCuModuleCreateInfoNVX* in_struct, PNextCopyState* copy_state = {});
@@ -8515,6 +9460,8 @@ struct safe_VkCuFunctionCreateInfoNVX {
                                    bool copy_pnext = true);
     safe_VkCuFunctionCreateInfoNVX(const safe_VkCuFunctionCreateInfoNVX& copy_src);
     safe_VkCuFunctionCreateInfoNVX& operator=(const safe_VkCuFunctionCreateInfoNVX& copy_src);
+    safe_VkCuFunctionCreateInfoNVX(safe_VkCuFunctionCreateInfoNVX&& move_src) noexcept;
+    safe_VkCuFunctionCreateInfoNVX& operator=(safe_VkCuFunctionCreateInfoNVX&& move_src) noexcept;
     safe_VkCuFunctionCreateInfoNVX();
     ~safe_VkCuFunctionCreateInfoNVX();
     void initialize(const VkCuFunctionCreateInfoNVX* in_struct, PNextCopyState* copy_state = {});
@@ -8541,6 +9488,8 @@ struct safe_VkCuLaunchInfoNVX {
     safe_VkCuLaunchInfoNVX(const VkCuLaunchInfoNVX* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCuLaunchInfoNVX(const safe_VkCuLaunchInfoNVX& copy_src);
     safe_VkCuLaunchInfoNVX& operator=(const safe_VkCuLaunchInfoNVX& copy_src);
+    safe_VkCuLaunchInfoNVX(safe_VkCuLaunchInfoNVX&& move_src) noexcept;
+    safe_VkCuLaunchInfoNVX& operator=(safe_VkCuLaunchInfoNVX&& move_src) noexcept;
     safe_VkCuLaunchInfoNVX();
     ~safe_VkCuLaunchInfoNVX();
     void initialize(const VkCuLaunchInfoNVX* in_struct, PNextCopyState* copy_state = {});
@@ -8559,6 +9508,8 @@ struct safe_VkImageViewHandleInfoNVX {
                                   bool copy_pnext = true);
     safe_VkImageViewHandleInfoNVX(const safe_VkImageViewHandleInfoNVX& copy_src);
     safe_VkImageViewHandleInfoNVX& operator=(const safe_VkImageViewHandleInfoNVX& copy_src);
+    safe_VkImageViewHandleInfoNVX(safe_VkImageViewHandleInfoNVX&& move_src) noexcept;
+    safe_VkImageViewHandleInfoNVX& operator=(safe_VkImageViewHandleInfoNVX&& move_src) noexcept;
     safe_VkImageViewHandleInfoNVX();
     ~safe_VkImageViewHandleInfoNVX();
     void initialize(const VkImageViewHandleInfoNVX* in_struct, PNextCopyState* copy_state = {});
@@ -8576,6 +9527,8 @@ struct safe_VkImageViewAddressPropertiesNVX {
                                          bool copy_pnext = true);
     safe_VkImageViewAddressPropertiesNVX(const safe_VkImageViewAddressPropertiesNVX& copy_src);
     safe_VkImageViewAddressPropertiesNVX& operator=(const safe_VkImageViewAddressPropertiesNVX& copy_src);
+    safe_VkImageViewAddressPropertiesNVX(safe_VkImageViewAddressPropertiesNVX&& move_src) noexcept;
+    safe_VkImageViewAddressPropertiesNVX& operator=(safe_VkImageViewAddressPropertiesNVX&& move_src) noexcept;
     safe_VkImageViewAddressPropertiesNVX();
     ~safe_VkImageViewAddressPropertiesNVX();
     void initialize(const VkImageViewAddressPropertiesNVX* in_struct, PNextCopyState* copy_state = {});
@@ -8592,6 +9545,8 @@ struct safe_VkTextureLODGatherFormatPropertiesAMD {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkTextureLODGatherFormatPropertiesAMD(const safe_VkTextureLODGatherFormatPropertiesAMD& copy_src);
     safe_VkTextureLODGatherFormatPropertiesAMD& operator=(const safe_VkTextureLODGatherFormatPropertiesAMD& copy_src);
+    safe_VkTextureLODGatherFormatPropertiesAMD(safe_VkTextureLODGatherFormatPropertiesAMD&& move_src) noexcept;
+    safe_VkTextureLODGatherFormatPropertiesAMD& operator=(safe_VkTextureLODGatherFormatPropertiesAMD&& move_src) noexcept;
     safe_VkTextureLODGatherFormatPropertiesAMD();
     ~safe_VkTextureLODGatherFormatPropertiesAMD();
     void initialize(const VkTextureLODGatherFormatPropertiesAMD* in_struct, PNextCopyState* copy_state = {});
@@ -8612,6 +9567,8 @@ struct safe_VkStreamDescriptorSurfaceCreateInfoGGP {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkStreamDescriptorSurfaceCreateInfoGGP(const safe_VkStreamDescriptorSurfaceCreateInfoGGP& copy_src);
     safe_VkStreamDescriptorSurfaceCreateInfoGGP& operator=(const safe_VkStreamDescriptorSurfaceCreateInfoGGP& copy_src);
+    safe_VkStreamDescriptorSurfaceCreateInfoGGP(safe_VkStreamDescriptorSurfaceCreateInfoGGP&& move_src) noexcept;
+    safe_VkStreamDescriptorSurfaceCreateInfoGGP& operator=(safe_VkStreamDescriptorSurfaceCreateInfoGGP&& move_src) noexcept;
     safe_VkStreamDescriptorSurfaceCreateInfoGGP();
     ~safe_VkStreamDescriptorSurfaceCreateInfoGGP();
     void initialize(const VkStreamDescriptorSurfaceCreateInfoGGP* in_struct, PNextCopyState* copy_state = {});
@@ -8631,6 +9588,9 @@ struct safe_VkPhysicalDeviceCornerSampledImageFeaturesNV {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceCornerSampledImageFeaturesNV(const safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& copy_src);
     safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& operator=(const safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceCornerSampledImageFeaturesNV(safe_VkPhysicalDeviceCornerSampledImageFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& operator=(
+        safe_VkPhysicalDeviceCornerSampledImageFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceCornerSampledImageFeaturesNV();
     ~safe_VkPhysicalDeviceCornerSampledImageFeaturesNV();
     void initialize(const VkPhysicalDeviceCornerSampledImageFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -8651,6 +9611,8 @@ struct safe_VkExternalMemoryImageCreateInfoNV {
                                            bool copy_pnext = true);
     safe_VkExternalMemoryImageCreateInfoNV(const safe_VkExternalMemoryImageCreateInfoNV& copy_src);
     safe_VkExternalMemoryImageCreateInfoNV& operator=(const safe_VkExternalMemoryImageCreateInfoNV& copy_src);
+    safe_VkExternalMemoryImageCreateInfoNV(safe_VkExternalMemoryImageCreateInfoNV&& move_src) noexcept;
+    safe_VkExternalMemoryImageCreateInfoNV& operator=(safe_VkExternalMemoryImageCreateInfoNV&& move_src) noexcept;
     safe_VkExternalMemoryImageCreateInfoNV();
     ~safe_VkExternalMemoryImageCreateInfoNV();
     void initialize(const VkExternalMemoryImageCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -8669,6 +9631,8 @@ struct safe_VkExportMemoryAllocateInfoNV {
                                       bool copy_pnext = true);
     safe_VkExportMemoryAllocateInfoNV(const safe_VkExportMemoryAllocateInfoNV& copy_src);
     safe_VkExportMemoryAllocateInfoNV& operator=(const safe_VkExportMemoryAllocateInfoNV& copy_src);
+    safe_VkExportMemoryAllocateInfoNV(safe_VkExportMemoryAllocateInfoNV&& move_src) noexcept;
+    safe_VkExportMemoryAllocateInfoNV& operator=(safe_VkExportMemoryAllocateInfoNV&& move_src) noexcept;
     safe_VkExportMemoryAllocateInfoNV();
     ~safe_VkExportMemoryAllocateInfoNV();
     void initialize(const VkExportMemoryAllocateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -8687,6 +9651,8 @@ struct safe_VkImportMemoryWin32HandleInfoNV {
                                          bool copy_pnext = true);
     safe_VkImportMemoryWin32HandleInfoNV(const safe_VkImportMemoryWin32HandleInfoNV& copy_src);
     safe_VkImportMemoryWin32HandleInfoNV& operator=(const safe_VkImportMemoryWin32HandleInfoNV& copy_src);
+    safe_VkImportMemoryWin32HandleInfoNV(safe_VkImportMemoryWin32HandleInfoNV&& move_src) noexcept;
+    safe_VkImportMemoryWin32HandleInfoNV& operator=(safe_VkImportMemoryWin32HandleInfoNV&& move_src) noexcept;
     safe_VkImportMemoryWin32HandleInfoNV();
     ~safe_VkImportMemoryWin32HandleInfoNV();
     void initialize(const VkImportMemoryWin32HandleInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -8704,6 +9670,8 @@ struct safe_VkExportMemoryWin32HandleInfoNV {
                                          bool copy_pnext = true);
     safe_VkExportMemoryWin32HandleInfoNV(const safe_VkExportMemoryWin32HandleInfoNV& copy_src);
     safe_VkExportMemoryWin32HandleInfoNV& operator=(const safe_VkExportMemoryWin32HandleInfoNV& copy_src);
+    safe_VkExportMemoryWin32HandleInfoNV(safe_VkExportMemoryWin32HandleInfoNV&& move_src) noexcept;
+    safe_VkExportMemoryWin32HandleInfoNV& operator=(safe_VkExportMemoryWin32HandleInfoNV&& move_src) noexcept;
     safe_VkExportMemoryWin32HandleInfoNV();
     ~safe_VkExportMemoryWin32HandleInfoNV();
     void initialize(const VkExportMemoryWin32HandleInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -8726,6 +9694,8 @@ struct safe_VkWin32KeyedMutexAcquireReleaseInfoNV {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkWin32KeyedMutexAcquireReleaseInfoNV(const safe_VkWin32KeyedMutexAcquireReleaseInfoNV& copy_src);
     safe_VkWin32KeyedMutexAcquireReleaseInfoNV& operator=(const safe_VkWin32KeyedMutexAcquireReleaseInfoNV& copy_src);
+    safe_VkWin32KeyedMutexAcquireReleaseInfoNV(safe_VkWin32KeyedMutexAcquireReleaseInfoNV&& move_src) noexcept;
+    safe_VkWin32KeyedMutexAcquireReleaseInfoNV& operator=(safe_VkWin32KeyedMutexAcquireReleaseInfoNV&& move_src) noexcept;
     safe_VkWin32KeyedMutexAcquireReleaseInfoNV();
     ~safe_VkWin32KeyedMutexAcquireReleaseInfoNV();
     void initialize(const VkWin32KeyedMutexAcquireReleaseInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -8745,6 +9715,8 @@ struct safe_VkValidationFlagsEXT {
     safe_VkValidationFlagsEXT(const VkValidationFlagsEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkValidationFlagsEXT(const safe_VkValidationFlagsEXT& copy_src);
     safe_VkValidationFlagsEXT& operator=(const safe_VkValidationFlagsEXT& copy_src);
+    safe_VkValidationFlagsEXT(safe_VkValidationFlagsEXT&& move_src) noexcept;
+    safe_VkValidationFlagsEXT& operator=(safe_VkValidationFlagsEXT&& move_src) noexcept;
     safe_VkValidationFlagsEXT();
     ~safe_VkValidationFlagsEXT();
     void initialize(const VkValidationFlagsEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8762,6 +9734,8 @@ struct safe_VkViSurfaceCreateInfoNN {
     safe_VkViSurfaceCreateInfoNN(const VkViSurfaceCreateInfoNN* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkViSurfaceCreateInfoNN(const safe_VkViSurfaceCreateInfoNN& copy_src);
     safe_VkViSurfaceCreateInfoNN& operator=(const safe_VkViSurfaceCreateInfoNN& copy_src);
+    safe_VkViSurfaceCreateInfoNN(safe_VkViSurfaceCreateInfoNN&& move_src) noexcept;
+    safe_VkViSurfaceCreateInfoNN& operator=(safe_VkViSurfaceCreateInfoNN&& move_src) noexcept;
     safe_VkViSurfaceCreateInfoNN();
     ~safe_VkViSurfaceCreateInfoNN();
     void initialize(const VkViSurfaceCreateInfoNN* in_struct, PNextCopyState* copy_state = {});
@@ -8779,6 +9753,8 @@ struct safe_VkImageViewASTCDecodeModeEXT {
                                       bool copy_pnext = true);
     safe_VkImageViewASTCDecodeModeEXT(const safe_VkImageViewASTCDecodeModeEXT& copy_src);
     safe_VkImageViewASTCDecodeModeEXT& operator=(const safe_VkImageViewASTCDecodeModeEXT& copy_src);
+    safe_VkImageViewASTCDecodeModeEXT(safe_VkImageViewASTCDecodeModeEXT&& move_src) noexcept;
+    safe_VkImageViewASTCDecodeModeEXT& operator=(safe_VkImageViewASTCDecodeModeEXT&& move_src) noexcept;
     safe_VkImageViewASTCDecodeModeEXT();
     ~safe_VkImageViewASTCDecodeModeEXT();
     void initialize(const VkImageViewASTCDecodeModeEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8795,6 +9771,8 @@ struct safe_VkPhysicalDeviceASTCDecodeFeaturesEXT {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceASTCDecodeFeaturesEXT(const safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& operator=(const safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceASTCDecodeFeaturesEXT(safe_VkPhysicalDeviceASTCDecodeFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& operator=(safe_VkPhysicalDeviceASTCDecodeFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceASTCDecodeFeaturesEXT();
     ~safe_VkPhysicalDeviceASTCDecodeFeaturesEXT();
     void initialize(const VkPhysicalDeviceASTCDecodeFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8814,6 +9792,9 @@ struct safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT {
     safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT(const safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT& copy_src);
     safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT& operator=(
         const safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT& copy_src);
+    safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT(safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT& operator=(
+        safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT();
     ~safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT();
     void initialize(const VkPhysicalDevicePipelineRobustnessFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8838,6 +9819,9 @@ struct safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT {
     safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT(const safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT& copy_src);
     safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT& operator=(
         const safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT& copy_src);
+    safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT(safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT& operator=(
+        safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT();
     ~safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT();
     void initialize(const VkPhysicalDevicePipelineRobustnessPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8861,6 +9845,8 @@ struct safe_VkPipelineRobustnessCreateInfoEXT {
                                            bool copy_pnext = true);
     safe_VkPipelineRobustnessCreateInfoEXT(const safe_VkPipelineRobustnessCreateInfoEXT& copy_src);
     safe_VkPipelineRobustnessCreateInfoEXT& operator=(const safe_VkPipelineRobustnessCreateInfoEXT& copy_src);
+    safe_VkPipelineRobustnessCreateInfoEXT(safe_VkPipelineRobustnessCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineRobustnessCreateInfoEXT& operator=(safe_VkPipelineRobustnessCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineRobustnessCreateInfoEXT();
     ~safe_VkPipelineRobustnessCreateInfoEXT();
     void initialize(const VkPipelineRobustnessCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8881,6 +9867,8 @@ struct safe_VkConditionalRenderingBeginInfoEXT {
                                             bool copy_pnext = true);
     safe_VkConditionalRenderingBeginInfoEXT(const safe_VkConditionalRenderingBeginInfoEXT& copy_src);
     safe_VkConditionalRenderingBeginInfoEXT& operator=(const safe_VkConditionalRenderingBeginInfoEXT& copy_src);
+    safe_VkConditionalRenderingBeginInfoEXT(safe_VkConditionalRenderingBeginInfoEXT&& move_src) noexcept;
+    safe_VkConditionalRenderingBeginInfoEXT& operator=(safe_VkConditionalRenderingBeginInfoEXT&& move_src) noexcept;
     safe_VkConditionalRenderingBeginInfoEXT();
     ~safe_VkConditionalRenderingBeginInfoEXT();
     void initialize(const VkConditionalRenderingBeginInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8901,6 +9889,9 @@ struct safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT {
     safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT(const safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT(safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT();
     ~safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT();
     void initialize(const VkPhysicalDeviceConditionalRenderingFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8924,6 +9915,10 @@ struct safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT {
         const safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& copy_src);
     safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& operator=(
         const safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& copy_src);
+    safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT(
+        safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT&& move_src) noexcept;
+    safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& operator=(
+        safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT&& move_src) noexcept;
     safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT();
     ~safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT();
     void initialize(const VkCommandBufferInheritanceConditionalRenderingInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -8946,6 +9941,9 @@ struct safe_VkPipelineViewportWScalingStateCreateInfoNV {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineViewportWScalingStateCreateInfoNV(const safe_VkPipelineViewportWScalingStateCreateInfoNV& copy_src);
     safe_VkPipelineViewportWScalingStateCreateInfoNV& operator=(const safe_VkPipelineViewportWScalingStateCreateInfoNV& copy_src);
+    safe_VkPipelineViewportWScalingStateCreateInfoNV(safe_VkPipelineViewportWScalingStateCreateInfoNV&& move_src) noexcept;
+    safe_VkPipelineViewportWScalingStateCreateInfoNV& operator=(
+        safe_VkPipelineViewportWScalingStateCreateInfoNV&& move_src) noexcept;
     safe_VkPipelineViewportWScalingStateCreateInfoNV();
     ~safe_VkPipelineViewportWScalingStateCreateInfoNV();
     void initialize(const VkPipelineViewportWScalingStateCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -8976,6 +9974,8 @@ struct safe_VkSurfaceCapabilities2EXT {
                                    bool copy_pnext = true);
     safe_VkSurfaceCapabilities2EXT(const safe_VkSurfaceCapabilities2EXT& copy_src);
     safe_VkSurfaceCapabilities2EXT& operator=(const safe_VkSurfaceCapabilities2EXT& copy_src);
+    safe_VkSurfaceCapabilities2EXT(safe_VkSurfaceCapabilities2EXT&& move_src) noexcept;
+    safe_VkSurfaceCapabilities2EXT& operator=(safe_VkSurfaceCapabilities2EXT&& move_src) noexcept;
     safe_VkSurfaceCapabilities2EXT();
     ~safe_VkSurfaceCapabilities2EXT();
     void initialize(const VkSurfaceCapabilities2EXT* in_struct, PNextCopyState* copy_state = {});
@@ -8991,6 +9991,8 @@ struct safe_VkDisplayPowerInfoEXT {
     safe_VkDisplayPowerInfoEXT(const VkDisplayPowerInfoEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDisplayPowerInfoEXT(const safe_VkDisplayPowerInfoEXT& copy_src);
     safe_VkDisplayPowerInfoEXT& operator=(const safe_VkDisplayPowerInfoEXT& copy_src);
+    safe_VkDisplayPowerInfoEXT(safe_VkDisplayPowerInfoEXT&& move_src) noexcept;
+    safe_VkDisplayPowerInfoEXT& operator=(safe_VkDisplayPowerInfoEXT&& move_src) noexcept;
     safe_VkDisplayPowerInfoEXT();
     ~safe_VkDisplayPowerInfoEXT();
     void initialize(const VkDisplayPowerInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9006,6 +10008,8 @@ struct safe_VkDeviceEventInfoEXT {
     safe_VkDeviceEventInfoEXT(const VkDeviceEventInfoEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceEventInfoEXT(const safe_VkDeviceEventInfoEXT& copy_src);
     safe_VkDeviceEventInfoEXT& operator=(const safe_VkDeviceEventInfoEXT& copy_src);
+    safe_VkDeviceEventInfoEXT(safe_VkDeviceEventInfoEXT&& move_src) noexcept;
+    safe_VkDeviceEventInfoEXT& operator=(safe_VkDeviceEventInfoEXT&& move_src) noexcept;
     safe_VkDeviceEventInfoEXT();
     ~safe_VkDeviceEventInfoEXT();
     void initialize(const VkDeviceEventInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9021,6 +10025,8 @@ struct safe_VkDisplayEventInfoEXT {
     safe_VkDisplayEventInfoEXT(const VkDisplayEventInfoEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDisplayEventInfoEXT(const safe_VkDisplayEventInfoEXT& copy_src);
     safe_VkDisplayEventInfoEXT& operator=(const safe_VkDisplayEventInfoEXT& copy_src);
+    safe_VkDisplayEventInfoEXT(safe_VkDisplayEventInfoEXT&& move_src) noexcept;
+    safe_VkDisplayEventInfoEXT& operator=(safe_VkDisplayEventInfoEXT&& move_src) noexcept;
     safe_VkDisplayEventInfoEXT();
     ~safe_VkDisplayEventInfoEXT();
     void initialize(const VkDisplayEventInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9037,6 +10043,8 @@ struct safe_VkSwapchainCounterCreateInfoEXT {
                                          bool copy_pnext = true);
     safe_VkSwapchainCounterCreateInfoEXT(const safe_VkSwapchainCounterCreateInfoEXT& copy_src);
     safe_VkSwapchainCounterCreateInfoEXT& operator=(const safe_VkSwapchainCounterCreateInfoEXT& copy_src);
+    safe_VkSwapchainCounterCreateInfoEXT(safe_VkSwapchainCounterCreateInfoEXT&& move_src) noexcept;
+    safe_VkSwapchainCounterCreateInfoEXT& operator=(safe_VkSwapchainCounterCreateInfoEXT&& move_src) noexcept;
     safe_VkSwapchainCounterCreateInfoEXT();
     ~safe_VkSwapchainCounterCreateInfoEXT();
     void initialize(const VkSwapchainCounterCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9054,6 +10062,8 @@ struct safe_VkPresentTimesInfoGOOGLE {
                                   bool copy_pnext = true);
     safe_VkPresentTimesInfoGOOGLE(const safe_VkPresentTimesInfoGOOGLE& copy_src);
     safe_VkPresentTimesInfoGOOGLE& operator=(const safe_VkPresentTimesInfoGOOGLE& copy_src);
+    safe_VkPresentTimesInfoGOOGLE(safe_VkPresentTimesInfoGOOGLE&& move_src) noexcept;
+    safe_VkPresentTimesInfoGOOGLE& operator=(safe_VkPresentTimesInfoGOOGLE&& move_src) noexcept;
     safe_VkPresentTimesInfoGOOGLE();
     ~safe_VkPresentTimesInfoGOOGLE();
     void initialize(const VkPresentTimesInfoGOOGLE* in_struct, PNextCopyState* copy_state = {});
@@ -9073,6 +10083,10 @@ struct safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX {
         const safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& copy_src);
     safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& operator=(
         const safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& copy_src);
+    safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(
+        safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX&& move_src) noexcept;
+    safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& operator=(
+        safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX&& move_src) noexcept;
     safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX();
     ~safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX();
     void initialize(const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX* in_struct, PNextCopyState* copy_state = {});
@@ -9095,6 +10109,8 @@ struct safe_VkPipelineViewportSwizzleStateCreateInfoNV {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineViewportSwizzleStateCreateInfoNV(const safe_VkPipelineViewportSwizzleStateCreateInfoNV& copy_src);
     safe_VkPipelineViewportSwizzleStateCreateInfoNV& operator=(const safe_VkPipelineViewportSwizzleStateCreateInfoNV& copy_src);
+    safe_VkPipelineViewportSwizzleStateCreateInfoNV(safe_VkPipelineViewportSwizzleStateCreateInfoNV&& move_src) noexcept;
+    safe_VkPipelineViewportSwizzleStateCreateInfoNV& operator=(safe_VkPipelineViewportSwizzleStateCreateInfoNV&& move_src) noexcept;
     safe_VkPipelineViewportSwizzleStateCreateInfoNV();
     ~safe_VkPipelineViewportSwizzleStateCreateInfoNV();
     void initialize(const VkPipelineViewportSwizzleStateCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -9116,6 +10132,9 @@ struct safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT {
     safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT(const safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& copy_src);
     safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& operator=(
         const safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT(safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& operator=(
+        safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT();
     ~safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT();
     void initialize(const VkPhysicalDeviceDiscardRectanglePropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9139,6 +10158,9 @@ struct safe_VkPipelineDiscardRectangleStateCreateInfoEXT {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineDiscardRectangleStateCreateInfoEXT(const safe_VkPipelineDiscardRectangleStateCreateInfoEXT& copy_src);
     safe_VkPipelineDiscardRectangleStateCreateInfoEXT& operator=(const safe_VkPipelineDiscardRectangleStateCreateInfoEXT& copy_src);
+    safe_VkPipelineDiscardRectangleStateCreateInfoEXT(safe_VkPipelineDiscardRectangleStateCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineDiscardRectangleStateCreateInfoEXT& operator=(
+        safe_VkPipelineDiscardRectangleStateCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineDiscardRectangleStateCreateInfoEXT();
     ~safe_VkPipelineDiscardRectangleStateCreateInfoEXT();
     void initialize(const VkPipelineDiscardRectangleStateCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9170,6 +10192,10 @@ struct safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT {
         const safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(
+        safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT();
     ~safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT();
     void initialize(const VkPhysicalDeviceConservativeRasterizationPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9195,6 +10221,10 @@ struct safe_VkPipelineRasterizationConservativeStateCreateInfoEXT {
         const safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& copy_src);
     safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& operator=(
         const safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& copy_src);
+    safe_VkPipelineRasterizationConservativeStateCreateInfoEXT(
+        safe_VkPipelineRasterizationConservativeStateCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& operator=(
+        safe_VkPipelineRasterizationConservativeStateCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineRasterizationConservativeStateCreateInfoEXT();
     ~safe_VkPipelineRasterizationConservativeStateCreateInfoEXT();
     void initialize(const VkPipelineRasterizationConservativeStateCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9215,6 +10245,8 @@ struct safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT(const safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& operator=(const safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT(safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& operator=(safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT();
     ~safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT();
     void initialize(const VkPhysicalDeviceDepthClipEnableFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9238,6 +10270,10 @@ struct safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT {
         const safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& copy_src);
     safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& operator=(
         const safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& copy_src);
+    safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT(
+        safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& operator=(
+        safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT();
     ~safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT();
     void initialize(const VkPipelineRasterizationDepthClipStateCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9264,6 +10300,8 @@ struct safe_VkHdrMetadataEXT {
     safe_VkHdrMetadataEXT(const VkHdrMetadataEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkHdrMetadataEXT(const safe_VkHdrMetadataEXT& copy_src);
     safe_VkHdrMetadataEXT& operator=(const safe_VkHdrMetadataEXT& copy_src);
+    safe_VkHdrMetadataEXT(safe_VkHdrMetadataEXT&& move_src) noexcept;
+    safe_VkHdrMetadataEXT& operator=(safe_VkHdrMetadataEXT&& move_src) noexcept;
     safe_VkHdrMetadataEXT();
     ~safe_VkHdrMetadataEXT();
     void initialize(const VkHdrMetadataEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9282,6 +10320,10 @@ struct safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG {
         const safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG& copy_src);
     safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG& operator=(
         const safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG& copy_src);
+    safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG(
+        safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG&& move_src) noexcept;
+    safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG& operator=(
+        safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG&& move_src) noexcept;
     safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG();
     ~safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG();
     void initialize(const VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG* in_struct, PNextCopyState* copy_state = {});
@@ -9304,6 +10346,8 @@ struct safe_VkIOSSurfaceCreateInfoMVK {
                                    bool copy_pnext = true);
     safe_VkIOSSurfaceCreateInfoMVK(const safe_VkIOSSurfaceCreateInfoMVK& copy_src);
     safe_VkIOSSurfaceCreateInfoMVK& operator=(const safe_VkIOSSurfaceCreateInfoMVK& copy_src);
+    safe_VkIOSSurfaceCreateInfoMVK(safe_VkIOSSurfaceCreateInfoMVK&& move_src) noexcept;
+    safe_VkIOSSurfaceCreateInfoMVK& operator=(safe_VkIOSSurfaceCreateInfoMVK&& move_src) noexcept;
     safe_VkIOSSurfaceCreateInfoMVK();
     ~safe_VkIOSSurfaceCreateInfoMVK();
     void initialize(const VkIOSSurfaceCreateInfoMVK* in_struct, PNextCopyState* copy_state = {});
@@ -9323,6 +10367,8 @@ struct safe_VkMacOSSurfaceCreateInfoMVK {
                                      bool copy_pnext = true);
     safe_VkMacOSSurfaceCreateInfoMVK(const safe_VkMacOSSurfaceCreateInfoMVK& copy_src);
     safe_VkMacOSSurfaceCreateInfoMVK& operator=(const safe_VkMacOSSurfaceCreateInfoMVK& copy_src);
+    safe_VkMacOSSurfaceCreateInfoMVK(safe_VkMacOSSurfaceCreateInfoMVK&& move_src) noexcept;
+    safe_VkMacOSSurfaceCreateInfoMVK& operator=(safe_VkMacOSSurfaceCreateInfoMVK&& move_src) noexcept;
     safe_VkMacOSSurfaceCreateInfoMVK();
     ~safe_VkMacOSSurfaceCreateInfoMVK();
     void initialize(const VkMacOSSurfaceCreateInfoMVK* in_struct, PNextCopyState* copy_state = {});
@@ -9340,6 +10386,8 @@ struct safe_VkDebugUtilsLabelEXT {
     safe_VkDebugUtilsLabelEXT(const VkDebugUtilsLabelEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDebugUtilsLabelEXT(const safe_VkDebugUtilsLabelEXT& copy_src);
     safe_VkDebugUtilsLabelEXT& operator=(const safe_VkDebugUtilsLabelEXT& copy_src);
+    safe_VkDebugUtilsLabelEXT(safe_VkDebugUtilsLabelEXT&& move_src) noexcept;
+    safe_VkDebugUtilsLabelEXT& operator=(safe_VkDebugUtilsLabelEXT&& move_src) noexcept;
     safe_VkDebugUtilsLabelEXT();
     ~safe_VkDebugUtilsLabelEXT();
     void initialize(const VkDebugUtilsLabelEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9358,6 +10406,8 @@ struct safe_VkDebugUtilsObjectNameInfoEXT {
                                        bool copy_pnext = true);
     safe_VkDebugUtilsObjectNameInfoEXT(const safe_VkDebugUtilsObjectNameInfoEXT& copy_src);
     safe_VkDebugUtilsObjectNameInfoEXT& operator=(const safe_VkDebugUtilsObjectNameInfoEXT& copy_src);
+    safe_VkDebugUtilsObjectNameInfoEXT(safe_VkDebugUtilsObjectNameInfoEXT&& move_src) noexcept;
+    safe_VkDebugUtilsObjectNameInfoEXT& operator=(safe_VkDebugUtilsObjectNameInfoEXT&& move_src) noexcept;
     safe_VkDebugUtilsObjectNameInfoEXT();
     ~safe_VkDebugUtilsObjectNameInfoEXT();
     void initialize(const VkDebugUtilsObjectNameInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9383,6 +10433,8 @@ struct safe_VkDebugUtilsMessengerCallbackDataEXT {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDebugUtilsMessengerCallbackDataEXT(const safe_VkDebugUtilsMessengerCallbackDataEXT& copy_src);
     safe_VkDebugUtilsMessengerCallbackDataEXT& operator=(const safe_VkDebugUtilsMessengerCallbackDataEXT& copy_src);
+    safe_VkDebugUtilsMessengerCallbackDataEXT(safe_VkDebugUtilsMessengerCallbackDataEXT&& move_src) noexcept;
+    safe_VkDebugUtilsMessengerCallbackDataEXT& operator=(safe_VkDebugUtilsMessengerCallbackDataEXT&& move_src) noexcept;
     safe_VkDebugUtilsMessengerCallbackDataEXT();
     ~safe_VkDebugUtilsMessengerCallbackDataEXT();
     void initialize(const VkDebugUtilsMessengerCallbackDataEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9405,6 +10457,8 @@ struct safe_VkDebugUtilsMessengerCreateInfoEXT {
                                             bool copy_pnext = true);
     safe_VkDebugUtilsMessengerCreateInfoEXT(const safe_VkDebugUtilsMessengerCreateInfoEXT& copy_src);
     safe_VkDebugUtilsMessengerCreateInfoEXT& operator=(const safe_VkDebugUtilsMessengerCreateInfoEXT& copy_src);
+    safe_VkDebugUtilsMessengerCreateInfoEXT(safe_VkDebugUtilsMessengerCreateInfoEXT&& move_src) noexcept;
+    safe_VkDebugUtilsMessengerCreateInfoEXT& operator=(safe_VkDebugUtilsMessengerCreateInfoEXT&& move_src) noexcept;
     safe_VkDebugUtilsMessengerCreateInfoEXT();
     ~safe_VkDebugUtilsMessengerCreateInfoEXT();
     void initialize(const VkDebugUtilsMessengerCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9427,6 +10481,8 @@ struct safe_VkDebugUtilsObjectTagInfoEXT {
                                       bool copy_pnext = true);
     safe_VkDebugUtilsObjectTagInfoEXT(const safe_VkDebugUtilsObjectTagInfoEXT& copy_src);
     safe_VkDebugUtilsObjectTagInfoEXT& operator=(const safe_VkDebugUtilsObjectTagInfoEXT& copy_src);
+    safe_VkDebugUtilsObjectTagInfoEXT(safe_VkDebugUtilsObjectTagInfoEXT&& move_src) noexcept;
+    safe_VkDebugUtilsObjectTagInfoEXT& operator=(safe_VkDebugUtilsObjectTagInfoEXT&& move_src) noexcept;
     safe_VkDebugUtilsObjectTagInfoEXT();
     ~safe_VkDebugUtilsObjectTagInfoEXT();
     void initialize(const VkDebugUtilsObjectTagInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9444,6 +10500,8 @@ struct safe_VkAndroidHardwareBufferUsageANDROID {
                                              bool copy_pnext = true);
     safe_VkAndroidHardwareBufferUsageANDROID(const safe_VkAndroidHardwareBufferUsageANDROID& copy_src);
     safe_VkAndroidHardwareBufferUsageANDROID& operator=(const safe_VkAndroidHardwareBufferUsageANDROID& copy_src);
+    safe_VkAndroidHardwareBufferUsageANDROID(safe_VkAndroidHardwareBufferUsageANDROID&& move_src) noexcept;
+    safe_VkAndroidHardwareBufferUsageANDROID& operator=(safe_VkAndroidHardwareBufferUsageANDROID&& move_src) noexcept;
     safe_VkAndroidHardwareBufferUsageANDROID();
     ~safe_VkAndroidHardwareBufferUsageANDROID();
     void initialize(const VkAndroidHardwareBufferUsageANDROID* in_struct, PNextCopyState* copy_state = {});
@@ -9463,6 +10521,8 @@ struct safe_VkAndroidHardwareBufferPropertiesANDROID {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkAndroidHardwareBufferPropertiesANDROID(const safe_VkAndroidHardwareBufferPropertiesANDROID& copy_src);
     safe_VkAndroidHardwareBufferPropertiesANDROID& operator=(const safe_VkAndroidHardwareBufferPropertiesANDROID& copy_src);
+    safe_VkAndroidHardwareBufferPropertiesANDROID(safe_VkAndroidHardwareBufferPropertiesANDROID&& move_src) noexcept;
+    safe_VkAndroidHardwareBufferPropertiesANDROID& operator=(safe_VkAndroidHardwareBufferPropertiesANDROID&& move_src) noexcept;
     safe_VkAndroidHardwareBufferPropertiesANDROID();
     ~safe_VkAndroidHardwareBufferPropertiesANDROID();
     void initialize(const VkAndroidHardwareBufferPropertiesANDROID* in_struct, PNextCopyState* copy_state = {});
@@ -9489,6 +10549,9 @@ struct safe_VkAndroidHardwareBufferFormatPropertiesANDROID {
     safe_VkAndroidHardwareBufferFormatPropertiesANDROID(const safe_VkAndroidHardwareBufferFormatPropertiesANDROID& copy_src);
     safe_VkAndroidHardwareBufferFormatPropertiesANDROID& operator=(
         const safe_VkAndroidHardwareBufferFormatPropertiesANDROID& copy_src);
+    safe_VkAndroidHardwareBufferFormatPropertiesANDROID(safe_VkAndroidHardwareBufferFormatPropertiesANDROID&& move_src) noexcept;
+    safe_VkAndroidHardwareBufferFormatPropertiesANDROID& operator=(
+        safe_VkAndroidHardwareBufferFormatPropertiesANDROID&& move_src) noexcept;
     safe_VkAndroidHardwareBufferFormatPropertiesANDROID();
     ~safe_VkAndroidHardwareBufferFormatPropertiesANDROID();
     void initialize(const VkAndroidHardwareBufferFormatPropertiesANDROID* in_struct, PNextCopyState* copy_state = {});
@@ -9509,6 +10572,8 @@ struct safe_VkImportAndroidHardwareBufferInfoANDROID {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImportAndroidHardwareBufferInfoANDROID(const safe_VkImportAndroidHardwareBufferInfoANDROID& copy_src);
     safe_VkImportAndroidHardwareBufferInfoANDROID& operator=(const safe_VkImportAndroidHardwareBufferInfoANDROID& copy_src);
+    safe_VkImportAndroidHardwareBufferInfoANDROID(safe_VkImportAndroidHardwareBufferInfoANDROID&& move_src) noexcept;
+    safe_VkImportAndroidHardwareBufferInfoANDROID& operator=(safe_VkImportAndroidHardwareBufferInfoANDROID&& move_src) noexcept;
     safe_VkImportAndroidHardwareBufferInfoANDROID();
     ~safe_VkImportAndroidHardwareBufferInfoANDROID();
     void initialize(const VkImportAndroidHardwareBufferInfoANDROID* in_struct, PNextCopyState* copy_state = {});
@@ -9527,6 +10592,9 @@ struct safe_VkMemoryGetAndroidHardwareBufferInfoANDROID {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryGetAndroidHardwareBufferInfoANDROID(const safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& copy_src);
     safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& operator=(const safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& copy_src);
+    safe_VkMemoryGetAndroidHardwareBufferInfoANDROID(safe_VkMemoryGetAndroidHardwareBufferInfoANDROID&& move_src) noexcept;
+    safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& operator=(
+        safe_VkMemoryGetAndroidHardwareBufferInfoANDROID&& move_src) noexcept;
     safe_VkMemoryGetAndroidHardwareBufferInfoANDROID();
     ~safe_VkMemoryGetAndroidHardwareBufferInfoANDROID();
     void initialize(const VkMemoryGetAndroidHardwareBufferInfoANDROID* in_struct, PNextCopyState* copy_state = {});
@@ -9546,6 +10614,8 @@ struct safe_VkExternalFormatANDROID {
     safe_VkExternalFormatANDROID(const VkExternalFormatANDROID* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkExternalFormatANDROID(const safe_VkExternalFormatANDROID& copy_src);
     safe_VkExternalFormatANDROID& operator=(const safe_VkExternalFormatANDROID& copy_src);
+    safe_VkExternalFormatANDROID(safe_VkExternalFormatANDROID&& move_src) noexcept;
+    safe_VkExternalFormatANDROID& operator=(safe_VkExternalFormatANDROID&& move_src) noexcept;
     safe_VkExternalFormatANDROID();
     ~safe_VkExternalFormatANDROID();
     void initialize(const VkExternalFormatANDROID* in_struct, PNextCopyState* copy_state = {});
@@ -9570,6 +10640,9 @@ struct safe_VkAndroidHardwareBufferFormatProperties2ANDROID {
     safe_VkAndroidHardwareBufferFormatProperties2ANDROID(const safe_VkAndroidHardwareBufferFormatProperties2ANDROID& copy_src);
     safe_VkAndroidHardwareBufferFormatProperties2ANDROID& operator=(
         const safe_VkAndroidHardwareBufferFormatProperties2ANDROID& copy_src);
+    safe_VkAndroidHardwareBufferFormatProperties2ANDROID(safe_VkAndroidHardwareBufferFormatProperties2ANDROID&& move_src) noexcept;
+    safe_VkAndroidHardwareBufferFormatProperties2ANDROID& operator=(
+        safe_VkAndroidHardwareBufferFormatProperties2ANDROID&& move_src) noexcept;
     safe_VkAndroidHardwareBufferFormatProperties2ANDROID();
     ~safe_VkAndroidHardwareBufferFormatProperties2ANDROID();
     void initialize(const VkAndroidHardwareBufferFormatProperties2ANDROID* in_struct, PNextCopyState* copy_state = {});
@@ -9592,6 +10665,8 @@ struct safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX(const safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX& copy_src);
     safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX& operator=(const safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX& copy_src);
+    safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX(safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX& operator=(safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX();
     ~safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX();
     void initialize(const VkPhysicalDeviceShaderEnqueueFeaturesAMDX* in_struct, PNextCopyState* copy_state = {});
@@ -9614,6 +10689,9 @@ struct safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX(const safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX& copy_src);
     safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX& operator=(const safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX& copy_src);
+    safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX(safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX& operator=(
+        safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX();
     ~safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX();
     void initialize(const VkPhysicalDeviceShaderEnqueuePropertiesAMDX* in_struct, PNextCopyState* copy_state = {});
@@ -9634,6 +10712,8 @@ struct safe_VkExecutionGraphPipelineScratchSizeAMDX {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkExecutionGraphPipelineScratchSizeAMDX(const safe_VkExecutionGraphPipelineScratchSizeAMDX& copy_src);
     safe_VkExecutionGraphPipelineScratchSizeAMDX& operator=(const safe_VkExecutionGraphPipelineScratchSizeAMDX& copy_src);
+    safe_VkExecutionGraphPipelineScratchSizeAMDX(safe_VkExecutionGraphPipelineScratchSizeAMDX&& move_src) noexcept;
+    safe_VkExecutionGraphPipelineScratchSizeAMDX& operator=(safe_VkExecutionGraphPipelineScratchSizeAMDX&& move_src) noexcept;
     safe_VkExecutionGraphPipelineScratchSizeAMDX();
     ~safe_VkExecutionGraphPipelineScratchSizeAMDX();
     void initialize(const VkExecutionGraphPipelineScratchSizeAMDX* in_struct, PNextCopyState* copy_state = {});
@@ -9658,6 +10738,8 @@ struct safe_VkExecutionGraphPipelineCreateInfoAMDX {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkExecutionGraphPipelineCreateInfoAMDX(const safe_VkExecutionGraphPipelineCreateInfoAMDX& copy_src);
     safe_VkExecutionGraphPipelineCreateInfoAMDX& operator=(const safe_VkExecutionGraphPipelineCreateInfoAMDX& copy_src);
+    safe_VkExecutionGraphPipelineCreateInfoAMDX(safe_VkExecutionGraphPipelineCreateInfoAMDX&& move_src) noexcept;
+    safe_VkExecutionGraphPipelineCreateInfoAMDX& operator=(safe_VkExecutionGraphPipelineCreateInfoAMDX&& move_src) noexcept;
     safe_VkExecutionGraphPipelineCreateInfoAMDX();
     ~safe_VkExecutionGraphPipelineCreateInfoAMDX();
     void initialize(const VkExecutionGraphPipelineCreateInfoAMDX* in_struct, PNextCopyState* copy_state = {});
@@ -9691,6 +10773,8 @@ struct safe_VkPipelineShaderStageNodeCreateInfoAMDX {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineShaderStageNodeCreateInfoAMDX(const safe_VkPipelineShaderStageNodeCreateInfoAMDX& copy_src);
     safe_VkPipelineShaderStageNodeCreateInfoAMDX& operator=(const safe_VkPipelineShaderStageNodeCreateInfoAMDX& copy_src);
+    safe_VkPipelineShaderStageNodeCreateInfoAMDX(safe_VkPipelineShaderStageNodeCreateInfoAMDX&& move_src) noexcept;
+    safe_VkPipelineShaderStageNodeCreateInfoAMDX& operator=(safe_VkPipelineShaderStageNodeCreateInfoAMDX&& move_src) noexcept;
     safe_VkPipelineShaderStageNodeCreateInfoAMDX();
     ~safe_VkPipelineShaderStageNodeCreateInfoAMDX();
     void initialize(const VkPipelineShaderStageNodeCreateInfoAMDX* in_struct, PNextCopyState* copy_state = {});
@@ -9713,6 +10797,8 @@ struct safe_VkSampleLocationsInfoEXT {
                                   bool copy_pnext = true);
     safe_VkSampleLocationsInfoEXT(const safe_VkSampleLocationsInfoEXT& copy_src);
     safe_VkSampleLocationsInfoEXT& operator=(const safe_VkSampleLocationsInfoEXT& copy_src);
+    safe_VkSampleLocationsInfoEXT(safe_VkSampleLocationsInfoEXT&& move_src) noexcept;
+    safe_VkSampleLocationsInfoEXT& operator=(safe_VkSampleLocationsInfoEXT&& move_src) noexcept;
     safe_VkSampleLocationsInfoEXT();
     ~safe_VkSampleLocationsInfoEXT();
     void initialize(const VkSampleLocationsInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9732,6 +10818,8 @@ struct safe_VkRenderPassSampleLocationsBeginInfoEXT {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRenderPassSampleLocationsBeginInfoEXT(const safe_VkRenderPassSampleLocationsBeginInfoEXT& copy_src);
     safe_VkRenderPassSampleLocationsBeginInfoEXT& operator=(const safe_VkRenderPassSampleLocationsBeginInfoEXT& copy_src);
+    safe_VkRenderPassSampleLocationsBeginInfoEXT(safe_VkRenderPassSampleLocationsBeginInfoEXT&& move_src) noexcept;
+    safe_VkRenderPassSampleLocationsBeginInfoEXT& operator=(safe_VkRenderPassSampleLocationsBeginInfoEXT&& move_src) noexcept;
     safe_VkRenderPassSampleLocationsBeginInfoEXT();
     ~safe_VkRenderPassSampleLocationsBeginInfoEXT();
     void initialize(const VkRenderPassSampleLocationsBeginInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9751,6 +10839,9 @@ struct safe_VkPipelineSampleLocationsStateCreateInfoEXT {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineSampleLocationsStateCreateInfoEXT(const safe_VkPipelineSampleLocationsStateCreateInfoEXT& copy_src);
     safe_VkPipelineSampleLocationsStateCreateInfoEXT& operator=(const safe_VkPipelineSampleLocationsStateCreateInfoEXT& copy_src);
+    safe_VkPipelineSampleLocationsStateCreateInfoEXT(safe_VkPipelineSampleLocationsStateCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineSampleLocationsStateCreateInfoEXT& operator=(
+        safe_VkPipelineSampleLocationsStateCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineSampleLocationsStateCreateInfoEXT();
     ~safe_VkPipelineSampleLocationsStateCreateInfoEXT();
     void initialize(const VkPipelineSampleLocationsStateCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9775,6 +10866,9 @@ struct safe_VkPhysicalDeviceSampleLocationsPropertiesEXT {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceSampleLocationsPropertiesEXT(const safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& operator=(const safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceSampleLocationsPropertiesEXT(safe_VkPhysicalDeviceSampleLocationsPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceSampleLocationsPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceSampleLocationsPropertiesEXT();
     ~safe_VkPhysicalDeviceSampleLocationsPropertiesEXT();
     void initialize(const VkPhysicalDeviceSampleLocationsPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9795,6 +10889,8 @@ struct safe_VkMultisamplePropertiesEXT {
                                     bool copy_pnext = true);
     safe_VkMultisamplePropertiesEXT(const safe_VkMultisamplePropertiesEXT& copy_src);
     safe_VkMultisamplePropertiesEXT& operator=(const safe_VkMultisamplePropertiesEXT& copy_src);
+    safe_VkMultisamplePropertiesEXT(safe_VkMultisamplePropertiesEXT&& move_src) noexcept;
+    safe_VkMultisamplePropertiesEXT& operator=(safe_VkMultisamplePropertiesEXT&& move_src) noexcept;
     safe_VkMultisamplePropertiesEXT();
     ~safe_VkMultisamplePropertiesEXT();
     void initialize(const VkMultisamplePropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9812,6 +10908,10 @@ struct safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT {
     safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(const safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(
+        safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT();
     ~safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT();
     void initialize(const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9839,6 +10939,10 @@ struct safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT {
         const safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(
+        safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT();
     ~safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT();
     void initialize(const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9862,6 +10966,9 @@ struct safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT {
     safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT(const safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& copy_src);
     safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& operator=(
         const safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& copy_src);
+    safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT(safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& operator=(
+        safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT();
     ~safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT();
     void initialize(const VkPipelineColorBlendAdvancedStateCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9884,6 +10991,8 @@ struct safe_VkPipelineCoverageToColorStateCreateInfoNV {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineCoverageToColorStateCreateInfoNV(const safe_VkPipelineCoverageToColorStateCreateInfoNV& copy_src);
     safe_VkPipelineCoverageToColorStateCreateInfoNV& operator=(const safe_VkPipelineCoverageToColorStateCreateInfoNV& copy_src);
+    safe_VkPipelineCoverageToColorStateCreateInfoNV(safe_VkPipelineCoverageToColorStateCreateInfoNV&& move_src) noexcept;
+    safe_VkPipelineCoverageToColorStateCreateInfoNV& operator=(safe_VkPipelineCoverageToColorStateCreateInfoNV&& move_src) noexcept;
     safe_VkPipelineCoverageToColorStateCreateInfoNV();
     ~safe_VkPipelineCoverageToColorStateCreateInfoNV();
     void initialize(const VkPipelineCoverageToColorStateCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -9909,6 +11018,9 @@ struct safe_VkPipelineCoverageModulationStateCreateInfoNV {
     safe_VkPipelineCoverageModulationStateCreateInfoNV(const safe_VkPipelineCoverageModulationStateCreateInfoNV& copy_src);
     safe_VkPipelineCoverageModulationStateCreateInfoNV& operator=(
         const safe_VkPipelineCoverageModulationStateCreateInfoNV& copy_src);
+    safe_VkPipelineCoverageModulationStateCreateInfoNV(safe_VkPipelineCoverageModulationStateCreateInfoNV&& move_src) noexcept;
+    safe_VkPipelineCoverageModulationStateCreateInfoNV& operator=(
+        safe_VkPipelineCoverageModulationStateCreateInfoNV&& move_src) noexcept;
     safe_VkPipelineCoverageModulationStateCreateInfoNV();
     ~safe_VkPipelineCoverageModulationStateCreateInfoNV();
     void initialize(const VkPipelineCoverageModulationStateCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -9930,6 +11042,9 @@ struct safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV(const safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& copy_src);
     safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& operator=(const safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV(safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& operator=(
+        safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV();
     ~safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV();
     void initialize(const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -9950,6 +11065,8 @@ struct safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV(const safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& copy_src);
     safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& operator=(const safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV(safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& operator=(safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV();
     ~safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV();
     void initialize(const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -9971,6 +11088,8 @@ struct safe_VkDrmFormatModifierPropertiesListEXT {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDrmFormatModifierPropertiesListEXT(const safe_VkDrmFormatModifierPropertiesListEXT& copy_src);
     safe_VkDrmFormatModifierPropertiesListEXT& operator=(const safe_VkDrmFormatModifierPropertiesListEXT& copy_src);
+    safe_VkDrmFormatModifierPropertiesListEXT(safe_VkDrmFormatModifierPropertiesListEXT&& move_src) noexcept;
+    safe_VkDrmFormatModifierPropertiesListEXT& operator=(safe_VkDrmFormatModifierPropertiesListEXT&& move_src) noexcept;
     safe_VkDrmFormatModifierPropertiesListEXT();
     ~safe_VkDrmFormatModifierPropertiesListEXT();
     void initialize(const VkDrmFormatModifierPropertiesListEXT* in_struct, PNextCopyState* copy_state = {});
@@ -9993,6 +11112,9 @@ struct safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT {
     safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT(const safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& copy_src);
     safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& operator=(
         const safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& copy_src);
+    safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT(safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& operator=(
+        safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT();
     ~safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT();
     void initialize(const VkPhysicalDeviceImageDrmFormatModifierInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10014,6 +11136,8 @@ struct safe_VkImageDrmFormatModifierListCreateInfoEXT {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageDrmFormatModifierListCreateInfoEXT(const safe_VkImageDrmFormatModifierListCreateInfoEXT& copy_src);
     safe_VkImageDrmFormatModifierListCreateInfoEXT& operator=(const safe_VkImageDrmFormatModifierListCreateInfoEXT& copy_src);
+    safe_VkImageDrmFormatModifierListCreateInfoEXT(safe_VkImageDrmFormatModifierListCreateInfoEXT&& move_src) noexcept;
+    safe_VkImageDrmFormatModifierListCreateInfoEXT& operator=(safe_VkImageDrmFormatModifierListCreateInfoEXT&& move_src) noexcept;
     safe_VkImageDrmFormatModifierListCreateInfoEXT();
     ~safe_VkImageDrmFormatModifierListCreateInfoEXT();
     void initialize(const VkImageDrmFormatModifierListCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10035,6 +11159,9 @@ struct safe_VkImageDrmFormatModifierExplicitCreateInfoEXT {
     safe_VkImageDrmFormatModifierExplicitCreateInfoEXT(const safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& copy_src);
     safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& operator=(
         const safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& copy_src);
+    safe_VkImageDrmFormatModifierExplicitCreateInfoEXT(safe_VkImageDrmFormatModifierExplicitCreateInfoEXT&& move_src) noexcept;
+    safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& operator=(
+        safe_VkImageDrmFormatModifierExplicitCreateInfoEXT&& move_src) noexcept;
     safe_VkImageDrmFormatModifierExplicitCreateInfoEXT();
     ~safe_VkImageDrmFormatModifierExplicitCreateInfoEXT();
     void initialize(const VkImageDrmFormatModifierExplicitCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10055,6 +11182,8 @@ struct safe_VkImageDrmFormatModifierPropertiesEXT {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageDrmFormatModifierPropertiesEXT(const safe_VkImageDrmFormatModifierPropertiesEXT& copy_src);
     safe_VkImageDrmFormatModifierPropertiesEXT& operator=(const safe_VkImageDrmFormatModifierPropertiesEXT& copy_src);
+    safe_VkImageDrmFormatModifierPropertiesEXT(safe_VkImageDrmFormatModifierPropertiesEXT&& move_src) noexcept;
+    safe_VkImageDrmFormatModifierPropertiesEXT& operator=(safe_VkImageDrmFormatModifierPropertiesEXT&& move_src) noexcept;
     safe_VkImageDrmFormatModifierPropertiesEXT();
     ~safe_VkImageDrmFormatModifierPropertiesEXT();
     void initialize(const VkImageDrmFormatModifierPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10074,6 +11203,8 @@ struct safe_VkDrmFormatModifierPropertiesList2EXT {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDrmFormatModifierPropertiesList2EXT(const safe_VkDrmFormatModifierPropertiesList2EXT& copy_src);
     safe_VkDrmFormatModifierPropertiesList2EXT& operator=(const safe_VkDrmFormatModifierPropertiesList2EXT& copy_src);
+    safe_VkDrmFormatModifierPropertiesList2EXT(safe_VkDrmFormatModifierPropertiesList2EXT&& move_src) noexcept;
+    safe_VkDrmFormatModifierPropertiesList2EXT& operator=(safe_VkDrmFormatModifierPropertiesList2EXT&& move_src) noexcept;
     safe_VkDrmFormatModifierPropertiesList2EXT();
     ~safe_VkDrmFormatModifierPropertiesList2EXT();
     void initialize(const VkDrmFormatModifierPropertiesList2EXT* in_struct, PNextCopyState* copy_state = {});
@@ -10094,6 +11225,8 @@ struct safe_VkValidationCacheCreateInfoEXT {
                                         bool copy_pnext = true);
     safe_VkValidationCacheCreateInfoEXT(const safe_VkValidationCacheCreateInfoEXT& copy_src);
     safe_VkValidationCacheCreateInfoEXT& operator=(const safe_VkValidationCacheCreateInfoEXT& copy_src);
+    safe_VkValidationCacheCreateInfoEXT(safe_VkValidationCacheCreateInfoEXT&& move_src) noexcept;
+    safe_VkValidationCacheCreateInfoEXT& operator=(safe_VkValidationCacheCreateInfoEXT&& move_src) noexcept;
     safe_VkValidationCacheCreateInfoEXT();
     ~safe_VkValidationCacheCreateInfoEXT();
     void initialize(const VkValidationCacheCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10110,6 +11243,8 @@ struct safe_VkShaderModuleValidationCacheCreateInfoEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkShaderModuleValidationCacheCreateInfoEXT(const safe_VkShaderModuleValidationCacheCreateInfoEXT& copy_src);
     safe_VkShaderModuleValidationCacheCreateInfoEXT& operator=(const safe_VkShaderModuleValidationCacheCreateInfoEXT& copy_src);
+    safe_VkShaderModuleValidationCacheCreateInfoEXT(safe_VkShaderModuleValidationCacheCreateInfoEXT&& move_src) noexcept;
+    safe_VkShaderModuleValidationCacheCreateInfoEXT& operator=(safe_VkShaderModuleValidationCacheCreateInfoEXT&& move_src) noexcept;
     safe_VkShaderModuleValidationCacheCreateInfoEXT();
     ~safe_VkShaderModuleValidationCacheCreateInfoEXT();
     void initialize(const VkShaderModuleValidationCacheCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10128,6 +11263,8 @@ struct safe_VkShadingRatePaletteNV {
     safe_VkShadingRatePaletteNV(const VkShadingRatePaletteNV* in_struct, PNextCopyState* copy_state = {});
     safe_VkShadingRatePaletteNV(const safe_VkShadingRatePaletteNV& copy_src);
     safe_VkShadingRatePaletteNV& operator=(const safe_VkShadingRatePaletteNV& copy_src);
+    safe_VkShadingRatePaletteNV(safe_VkShadingRatePaletteNV&& move_src) noexcept;
+    safe_VkShadingRatePaletteNV& operator=(safe_VkShadingRatePaletteNV&& move_src) noexcept;
     safe_VkShadingRatePaletteNV();
     ~safe_VkShadingRatePaletteNV();
     void initialize(const VkShadingRatePaletteNV* in_struct, PNextCopyState* copy_state = {});
@@ -10148,6 +11285,10 @@ struct safe_VkPipelineViewportShadingRateImageStateCreateInfoNV {
         const safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& copy_src);
     safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& operator=(
         const safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& copy_src);
+    safe_VkPipelineViewportShadingRateImageStateCreateInfoNV(
+        safe_VkPipelineViewportShadingRateImageStateCreateInfoNV&& move_src) noexcept;
+    safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& operator=(
+        safe_VkPipelineViewportShadingRateImageStateCreateInfoNV&& move_src) noexcept;
     safe_VkPipelineViewportShadingRateImageStateCreateInfoNV();
     ~safe_VkPipelineViewportShadingRateImageStateCreateInfoNV();
     void initialize(const VkPipelineViewportShadingRateImageStateCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -10169,6 +11310,8 @@ struct safe_VkPhysicalDeviceShadingRateImageFeaturesNV {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShadingRateImageFeaturesNV(const safe_VkPhysicalDeviceShadingRateImageFeaturesNV& copy_src);
     safe_VkPhysicalDeviceShadingRateImageFeaturesNV& operator=(const safe_VkPhysicalDeviceShadingRateImageFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceShadingRateImageFeaturesNV(safe_VkPhysicalDeviceShadingRateImageFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceShadingRateImageFeaturesNV& operator=(safe_VkPhysicalDeviceShadingRateImageFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceShadingRateImageFeaturesNV();
     ~safe_VkPhysicalDeviceShadingRateImageFeaturesNV();
     void initialize(const VkPhysicalDeviceShadingRateImageFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -10191,6 +11334,9 @@ struct safe_VkPhysicalDeviceShadingRateImagePropertiesNV {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShadingRateImagePropertiesNV(const safe_VkPhysicalDeviceShadingRateImagePropertiesNV& copy_src);
     safe_VkPhysicalDeviceShadingRateImagePropertiesNV& operator=(const safe_VkPhysicalDeviceShadingRateImagePropertiesNV& copy_src);
+    safe_VkPhysicalDeviceShadingRateImagePropertiesNV(safe_VkPhysicalDeviceShadingRateImagePropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceShadingRateImagePropertiesNV& operator=(
+        safe_VkPhysicalDeviceShadingRateImagePropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceShadingRateImagePropertiesNV();
     ~safe_VkPhysicalDeviceShadingRateImagePropertiesNV();
     void initialize(const VkPhysicalDeviceShadingRateImagePropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -10211,6 +11357,8 @@ struct safe_VkCoarseSampleOrderCustomNV {
     safe_VkCoarseSampleOrderCustomNV(const VkCoarseSampleOrderCustomNV* in_struct, PNextCopyState* copy_state = {});
     safe_VkCoarseSampleOrderCustomNV(const safe_VkCoarseSampleOrderCustomNV& copy_src);
     safe_VkCoarseSampleOrderCustomNV& operator=(const safe_VkCoarseSampleOrderCustomNV& copy_src);
+    safe_VkCoarseSampleOrderCustomNV(safe_VkCoarseSampleOrderCustomNV&& move_src) noexcept;
+    safe_VkCoarseSampleOrderCustomNV& operator=(safe_VkCoarseSampleOrderCustomNV&& move_src) noexcept;
     safe_VkCoarseSampleOrderCustomNV();
     ~safe_VkCoarseSampleOrderCustomNV();
     void initialize(const VkCoarseSampleOrderCustomNV* in_struct, PNextCopyState* copy_state = {});
@@ -10231,6 +11379,10 @@ struct safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV {
         const safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& copy_src);
     safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& operator=(
         const safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& copy_src);
+    safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV(
+        safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV&& move_src) noexcept;
+    safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& operator=(
+        safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV&& move_src) noexcept;
     safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV();
     ~safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV();
     void initialize(const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -10255,6 +11407,8 @@ struct safe_VkRayTracingShaderGroupCreateInfoNV {
                                              bool copy_pnext = true);
     safe_VkRayTracingShaderGroupCreateInfoNV(const safe_VkRayTracingShaderGroupCreateInfoNV& copy_src);
     safe_VkRayTracingShaderGroupCreateInfoNV& operator=(const safe_VkRayTracingShaderGroupCreateInfoNV& copy_src);
+    safe_VkRayTracingShaderGroupCreateInfoNV(safe_VkRayTracingShaderGroupCreateInfoNV&& move_src) noexcept;
+    safe_VkRayTracingShaderGroupCreateInfoNV& operator=(safe_VkRayTracingShaderGroupCreateInfoNV&& move_src) noexcept;
     safe_VkRayTracingShaderGroupCreateInfoNV();
     ~safe_VkRayTracingShaderGroupCreateInfoNV();
     void initialize(const VkRayTracingShaderGroupCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -10281,6 +11435,8 @@ struct safe_VkRayTracingPipelineCreateInfoNV {
                                           bool copy_pnext = true);
     safe_VkRayTracingPipelineCreateInfoNV(const safe_VkRayTracingPipelineCreateInfoNV& copy_src);
     safe_VkRayTracingPipelineCreateInfoNV& operator=(const safe_VkRayTracingPipelineCreateInfoNV& copy_src);
+    safe_VkRayTracingPipelineCreateInfoNV(safe_VkRayTracingPipelineCreateInfoNV&& move_src) noexcept;
+    safe_VkRayTracingPipelineCreateInfoNV& operator=(safe_VkRayTracingPipelineCreateInfoNV&& move_src) noexcept;
     safe_VkRayTracingPipelineCreateInfoNV();
     ~safe_VkRayTracingPipelineCreateInfoNV();
     void initialize(const VkRayTracingPipelineCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -10306,6 +11462,8 @@ struct safe_VkGeometryTrianglesNV {
     safe_VkGeometryTrianglesNV(const VkGeometryTrianglesNV* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkGeometryTrianglesNV(const safe_VkGeometryTrianglesNV& copy_src);
     safe_VkGeometryTrianglesNV& operator=(const safe_VkGeometryTrianglesNV& copy_src);
+    safe_VkGeometryTrianglesNV(safe_VkGeometryTrianglesNV&& move_src) noexcept;
+    safe_VkGeometryTrianglesNV& operator=(safe_VkGeometryTrianglesNV&& move_src) noexcept;
     safe_VkGeometryTrianglesNV();
     ~safe_VkGeometryTrianglesNV();
     void initialize(const VkGeometryTrianglesNV* in_struct, PNextCopyState* copy_state = {});
@@ -10324,6 +11482,8 @@ struct safe_VkGeometryAABBNV {
     safe_VkGeometryAABBNV(const VkGeometryAABBNV* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkGeometryAABBNV(const safe_VkGeometryAABBNV& copy_src);
     safe_VkGeometryAABBNV& operator=(const safe_VkGeometryAABBNV& copy_src);
+    safe_VkGeometryAABBNV(safe_VkGeometryAABBNV&& move_src) noexcept;
+    safe_VkGeometryAABBNV& operator=(safe_VkGeometryAABBNV&& move_src) noexcept;
     safe_VkGeometryAABBNV();
     ~safe_VkGeometryAABBNV();
     void initialize(const VkGeometryAABBNV* in_struct, PNextCopyState* copy_state = {});
@@ -10341,6 +11501,8 @@ struct safe_VkGeometryNV {
     safe_VkGeometryNV(const VkGeometryNV* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkGeometryNV(const safe_VkGeometryNV& copy_src);
     safe_VkGeometryNV& operator=(const safe_VkGeometryNV& copy_src);
+    safe_VkGeometryNV(safe_VkGeometryNV&& move_src) noexcept;
+    safe_VkGeometryNV& operator=(safe_VkGeometryNV&& move_src) noexcept;
     safe_VkGeometryNV();
     ~safe_VkGeometryNV();
     void initialize(const VkGeometryNV* in_struct, PNextCopyState* copy_state = {});
@@ -10361,6 +11523,8 @@ struct safe_VkAccelerationStructureInfoNV {
                                        bool copy_pnext = true);
     safe_VkAccelerationStructureInfoNV(const safe_VkAccelerationStructureInfoNV& copy_src);
     safe_VkAccelerationStructureInfoNV& operator=(const safe_VkAccelerationStructureInfoNV& copy_src);
+    safe_VkAccelerationStructureInfoNV(safe_VkAccelerationStructureInfoNV&& move_src) noexcept;
+    safe_VkAccelerationStructureInfoNV& operator=(safe_VkAccelerationStructureInfoNV&& move_src) noexcept;
     safe_VkAccelerationStructureInfoNV();
     ~safe_VkAccelerationStructureInfoNV();
     void initialize(const VkAccelerationStructureInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -10378,6 +11542,8 @@ struct safe_VkAccelerationStructureCreateInfoNV {
                                              bool copy_pnext = true);
     safe_VkAccelerationStructureCreateInfoNV(const safe_VkAccelerationStructureCreateInfoNV& copy_src);
     safe_VkAccelerationStructureCreateInfoNV& operator=(const safe_VkAccelerationStructureCreateInfoNV& copy_src);
+    safe_VkAccelerationStructureCreateInfoNV(safe_VkAccelerationStructureCreateInfoNV&& move_src) noexcept;
+    safe_VkAccelerationStructureCreateInfoNV& operator=(safe_VkAccelerationStructureCreateInfoNV&& move_src) noexcept;
     safe_VkAccelerationStructureCreateInfoNV();
     ~safe_VkAccelerationStructureCreateInfoNV();
     void initialize(const VkAccelerationStructureCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -10400,6 +11566,8 @@ struct safe_VkBindAccelerationStructureMemoryInfoNV {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBindAccelerationStructureMemoryInfoNV(const safe_VkBindAccelerationStructureMemoryInfoNV& copy_src);
     safe_VkBindAccelerationStructureMemoryInfoNV& operator=(const safe_VkBindAccelerationStructureMemoryInfoNV& copy_src);
+    safe_VkBindAccelerationStructureMemoryInfoNV(safe_VkBindAccelerationStructureMemoryInfoNV&& move_src) noexcept;
+    safe_VkBindAccelerationStructureMemoryInfoNV& operator=(safe_VkBindAccelerationStructureMemoryInfoNV&& move_src) noexcept;
     safe_VkBindAccelerationStructureMemoryInfoNV();
     ~safe_VkBindAccelerationStructureMemoryInfoNV();
     void initialize(const VkBindAccelerationStructureMemoryInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -10419,6 +11587,9 @@ struct safe_VkWriteDescriptorSetAccelerationStructureNV {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkWriteDescriptorSetAccelerationStructureNV(const safe_VkWriteDescriptorSetAccelerationStructureNV& copy_src);
     safe_VkWriteDescriptorSetAccelerationStructureNV& operator=(const safe_VkWriteDescriptorSetAccelerationStructureNV& copy_src);
+    safe_VkWriteDescriptorSetAccelerationStructureNV(safe_VkWriteDescriptorSetAccelerationStructureNV&& move_src) noexcept;
+    safe_VkWriteDescriptorSetAccelerationStructureNV& operator=(
+        safe_VkWriteDescriptorSetAccelerationStructureNV&& move_src) noexcept;
     safe_VkWriteDescriptorSetAccelerationStructureNV();
     ~safe_VkWriteDescriptorSetAccelerationStructureNV();
     void initialize(const VkWriteDescriptorSetAccelerationStructureNV* in_struct, PNextCopyState* copy_state = {});
@@ -10441,6 +11612,9 @@ struct safe_VkAccelerationStructureMemoryRequirementsInfoNV {
     safe_VkAccelerationStructureMemoryRequirementsInfoNV(const safe_VkAccelerationStructureMemoryRequirementsInfoNV& copy_src);
     safe_VkAccelerationStructureMemoryRequirementsInfoNV& operator=(
         const safe_VkAccelerationStructureMemoryRequirementsInfoNV& copy_src);
+    safe_VkAccelerationStructureMemoryRequirementsInfoNV(safe_VkAccelerationStructureMemoryRequirementsInfoNV&& move_src) noexcept;
+    safe_VkAccelerationStructureMemoryRequirementsInfoNV& operator=(
+        safe_VkAccelerationStructureMemoryRequirementsInfoNV&& move_src) noexcept;
     safe_VkAccelerationStructureMemoryRequirementsInfoNV();
     ~safe_VkAccelerationStructureMemoryRequirementsInfoNV();
     void initialize(const VkAccelerationStructureMemoryRequirementsInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -10468,6 +11642,8 @@ struct safe_VkPhysicalDeviceRayTracingPropertiesNV {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceRayTracingPropertiesNV(const safe_VkPhysicalDeviceRayTracingPropertiesNV& copy_src);
     safe_VkPhysicalDeviceRayTracingPropertiesNV& operator=(const safe_VkPhysicalDeviceRayTracingPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceRayTracingPropertiesNV(safe_VkPhysicalDeviceRayTracingPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceRayTracingPropertiesNV& operator=(safe_VkPhysicalDeviceRayTracingPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceRayTracingPropertiesNV();
     ~safe_VkPhysicalDeviceRayTracingPropertiesNV();
     void initialize(const VkPhysicalDeviceRayTracingPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -10488,6 +11664,10 @@ struct safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV {
         const safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& copy_src);
     safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& operator=(
         const safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV(
+        safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& operator=(
+        safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV();
     ~safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV();
     void initialize(const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -10511,6 +11691,10 @@ struct safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV {
         const safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& copy_src);
     safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& operator=(
         const safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& copy_src);
+    safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV(
+        safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV&& move_src) noexcept;
+    safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& operator=(
+        safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV&& move_src) noexcept;
     safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV();
     ~safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV();
     void initialize(const VkPipelineRepresentativeFragmentTestStateCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -10531,6 +11715,9 @@ struct safe_VkPhysicalDeviceImageViewImageFormatInfoEXT {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceImageViewImageFormatInfoEXT(const safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& copy_src);
     safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& operator=(const safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& copy_src);
+    safe_VkPhysicalDeviceImageViewImageFormatInfoEXT(safe_VkPhysicalDeviceImageViewImageFormatInfoEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& operator=(
+        safe_VkPhysicalDeviceImageViewImageFormatInfoEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceImageViewImageFormatInfoEXT();
     ~safe_VkPhysicalDeviceImageViewImageFormatInfoEXT();
     void initialize(const VkPhysicalDeviceImageViewImageFormatInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10553,6 +11740,9 @@ struct safe_VkFilterCubicImageViewImageFormatPropertiesEXT {
     safe_VkFilterCubicImageViewImageFormatPropertiesEXT(const safe_VkFilterCubicImageViewImageFormatPropertiesEXT& copy_src);
     safe_VkFilterCubicImageViewImageFormatPropertiesEXT& operator=(
         const safe_VkFilterCubicImageViewImageFormatPropertiesEXT& copy_src);
+    safe_VkFilterCubicImageViewImageFormatPropertiesEXT(safe_VkFilterCubicImageViewImageFormatPropertiesEXT&& move_src) noexcept;
+    safe_VkFilterCubicImageViewImageFormatPropertiesEXT& operator=(
+        safe_VkFilterCubicImageViewImageFormatPropertiesEXT&& move_src) noexcept;
     safe_VkFilterCubicImageViewImageFormatPropertiesEXT();
     ~safe_VkFilterCubicImageViewImageFormatPropertiesEXT();
     void initialize(const VkFilterCubicImageViewImageFormatPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10574,6 +11764,8 @@ struct safe_VkImportMemoryHostPointerInfoEXT {
                                           bool copy_pnext = true);
     safe_VkImportMemoryHostPointerInfoEXT(const safe_VkImportMemoryHostPointerInfoEXT& copy_src);
     safe_VkImportMemoryHostPointerInfoEXT& operator=(const safe_VkImportMemoryHostPointerInfoEXT& copy_src);
+    safe_VkImportMemoryHostPointerInfoEXT(safe_VkImportMemoryHostPointerInfoEXT&& move_src) noexcept;
+    safe_VkImportMemoryHostPointerInfoEXT& operator=(safe_VkImportMemoryHostPointerInfoEXT&& move_src) noexcept;
     safe_VkImportMemoryHostPointerInfoEXT();
     ~safe_VkImportMemoryHostPointerInfoEXT();
     void initialize(const VkImportMemoryHostPointerInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10590,6 +11782,8 @@ struct safe_VkMemoryHostPointerPropertiesEXT {
                                           bool copy_pnext = true);
     safe_VkMemoryHostPointerPropertiesEXT(const safe_VkMemoryHostPointerPropertiesEXT& copy_src);
     safe_VkMemoryHostPointerPropertiesEXT& operator=(const safe_VkMemoryHostPointerPropertiesEXT& copy_src);
+    safe_VkMemoryHostPointerPropertiesEXT(safe_VkMemoryHostPointerPropertiesEXT&& move_src) noexcept;
+    safe_VkMemoryHostPointerPropertiesEXT& operator=(safe_VkMemoryHostPointerPropertiesEXT&& move_src) noexcept;
     safe_VkMemoryHostPointerPropertiesEXT();
     ~safe_VkMemoryHostPointerPropertiesEXT();
     void initialize(const VkMemoryHostPointerPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10607,6 +11801,9 @@ struct safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT {
     safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(const safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT();
     ~safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT();
     void initialize(const VkPhysicalDeviceExternalMemoryHostPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10627,6 +11824,8 @@ struct safe_VkPipelineCompilerControlCreateInfoAMD {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineCompilerControlCreateInfoAMD(const safe_VkPipelineCompilerControlCreateInfoAMD& copy_src);
     safe_VkPipelineCompilerControlCreateInfoAMD& operator=(const safe_VkPipelineCompilerControlCreateInfoAMD& copy_src);
+    safe_VkPipelineCompilerControlCreateInfoAMD(safe_VkPipelineCompilerControlCreateInfoAMD&& move_src) noexcept;
+    safe_VkPipelineCompilerControlCreateInfoAMD& operator=(safe_VkPipelineCompilerControlCreateInfoAMD&& move_src) noexcept;
     safe_VkPipelineCompilerControlCreateInfoAMD();
     ~safe_VkPipelineCompilerControlCreateInfoAMD();
     void initialize(const VkPipelineCompilerControlCreateInfoAMD* in_struct, PNextCopyState* copy_state = {});
@@ -10658,6 +11857,8 @@ struct safe_VkPhysicalDeviceShaderCorePropertiesAMD {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderCorePropertiesAMD(const safe_VkPhysicalDeviceShaderCorePropertiesAMD& copy_src);
     safe_VkPhysicalDeviceShaderCorePropertiesAMD& operator=(const safe_VkPhysicalDeviceShaderCorePropertiesAMD& copy_src);
+    safe_VkPhysicalDeviceShaderCorePropertiesAMD(safe_VkPhysicalDeviceShaderCorePropertiesAMD&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderCorePropertiesAMD& operator=(safe_VkPhysicalDeviceShaderCorePropertiesAMD&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderCorePropertiesAMD();
     ~safe_VkPhysicalDeviceShaderCorePropertiesAMD();
     void initialize(const VkPhysicalDeviceShaderCorePropertiesAMD* in_struct, PNextCopyState* copy_state = {});
@@ -10676,6 +11877,8 @@ struct safe_VkDeviceMemoryOverallocationCreateInfoAMD {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceMemoryOverallocationCreateInfoAMD(const safe_VkDeviceMemoryOverallocationCreateInfoAMD& copy_src);
     safe_VkDeviceMemoryOverallocationCreateInfoAMD& operator=(const safe_VkDeviceMemoryOverallocationCreateInfoAMD& copy_src);
+    safe_VkDeviceMemoryOverallocationCreateInfoAMD(safe_VkDeviceMemoryOverallocationCreateInfoAMD&& move_src) noexcept;
+    safe_VkDeviceMemoryOverallocationCreateInfoAMD& operator=(safe_VkDeviceMemoryOverallocationCreateInfoAMD&& move_src) noexcept;
     safe_VkDeviceMemoryOverallocationCreateInfoAMD();
     ~safe_VkDeviceMemoryOverallocationCreateInfoAMD();
     void initialize(const VkDeviceMemoryOverallocationCreateInfoAMD* in_struct, PNextCopyState* copy_state = {});
@@ -10696,6 +11899,10 @@ struct safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT {
         const safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(
+        safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT();
     ~safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT();
     void initialize(const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -10716,6 +11923,8 @@ struct safe_VkPresentFrameTokenGGP {
     safe_VkPresentFrameTokenGGP(const VkPresentFrameTokenGGP* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPresentFrameTokenGGP(const safe_VkPresentFrameTokenGGP& copy_src);
     safe_VkPresentFrameTokenGGP& operator=(const safe_VkPresentFrameTokenGGP& copy_src);
+    safe_VkPresentFrameTokenGGP(safe_VkPresentFrameTokenGGP&& move_src) noexcept;
+    safe_VkPresentFrameTokenGGP& operator=(safe_VkPresentFrameTokenGGP&& move_src) noexcept;
     safe_VkPresentFrameTokenGGP();
     ~safe_VkPresentFrameTokenGGP();
     void initialize(const VkPresentFrameTokenGGP* in_struct, PNextCopyState* copy_state = {});
@@ -10736,6 +11945,10 @@ struct safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV {
         const safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& copy_src);
     safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& operator=(
         const safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV(
+        safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& operator=(
+        safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV();
     ~safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV();
     void initialize(const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -10757,6 +11970,8 @@ struct safe_VkPhysicalDeviceMeshShaderFeaturesNV {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMeshShaderFeaturesNV(const safe_VkPhysicalDeviceMeshShaderFeaturesNV& copy_src);
     safe_VkPhysicalDeviceMeshShaderFeaturesNV& operator=(const safe_VkPhysicalDeviceMeshShaderFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceMeshShaderFeaturesNV(safe_VkPhysicalDeviceMeshShaderFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceMeshShaderFeaturesNV& operator=(safe_VkPhysicalDeviceMeshShaderFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceMeshShaderFeaturesNV();
     ~safe_VkPhysicalDeviceMeshShaderFeaturesNV();
     void initialize(const VkPhysicalDeviceMeshShaderFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -10787,6 +12002,8 @@ struct safe_VkPhysicalDeviceMeshShaderPropertiesNV {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMeshShaderPropertiesNV(const safe_VkPhysicalDeviceMeshShaderPropertiesNV& copy_src);
     safe_VkPhysicalDeviceMeshShaderPropertiesNV& operator=(const safe_VkPhysicalDeviceMeshShaderPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceMeshShaderPropertiesNV(safe_VkPhysicalDeviceMeshShaderPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceMeshShaderPropertiesNV& operator=(safe_VkPhysicalDeviceMeshShaderPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceMeshShaderPropertiesNV();
     ~safe_VkPhysicalDeviceMeshShaderPropertiesNV();
     void initialize(const VkPhysicalDeviceMeshShaderPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -10806,6 +12023,9 @@ struct safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV {
     safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV(const safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& copy_src);
     safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& operator=(
         const safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV(safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& operator=(
+        safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV();
     ~safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV();
     void initialize(const VkPhysicalDeviceShaderImageFootprintFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -10829,6 +12049,10 @@ struct safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV {
         const safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& copy_src);
     safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& operator=(
         const safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& copy_src);
+    safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV(
+        safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV&& move_src) noexcept;
+    safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& operator=(
+        safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV&& move_src) noexcept;
     safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV();
     ~safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV();
     void initialize(const VkPipelineViewportExclusiveScissorStateCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -10849,6 +12073,8 @@ struct safe_VkPhysicalDeviceExclusiveScissorFeaturesNV {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceExclusiveScissorFeaturesNV(const safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& copy_src);
     safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& operator=(const safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceExclusiveScissorFeaturesNV(safe_VkPhysicalDeviceExclusiveScissorFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& operator=(safe_VkPhysicalDeviceExclusiveScissorFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceExclusiveScissorFeaturesNV();
     ~safe_VkPhysicalDeviceExclusiveScissorFeaturesNV();
     void initialize(const VkPhysicalDeviceExclusiveScissorFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -10869,6 +12095,8 @@ struct safe_VkQueueFamilyCheckpointPropertiesNV {
                                              bool copy_pnext = true);
     safe_VkQueueFamilyCheckpointPropertiesNV(const safe_VkQueueFamilyCheckpointPropertiesNV& copy_src);
     safe_VkQueueFamilyCheckpointPropertiesNV& operator=(const safe_VkQueueFamilyCheckpointPropertiesNV& copy_src);
+    safe_VkQueueFamilyCheckpointPropertiesNV(safe_VkQueueFamilyCheckpointPropertiesNV&& move_src) noexcept;
+    safe_VkQueueFamilyCheckpointPropertiesNV& operator=(safe_VkQueueFamilyCheckpointPropertiesNV&& move_src) noexcept;
     safe_VkQueueFamilyCheckpointPropertiesNV();
     ~safe_VkQueueFamilyCheckpointPropertiesNV();
     void initialize(const VkQueueFamilyCheckpointPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -10887,6 +12115,8 @@ struct safe_VkCheckpointDataNV {
     safe_VkCheckpointDataNV(const VkCheckpointDataNV* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCheckpointDataNV(const safe_VkCheckpointDataNV& copy_src);
     safe_VkCheckpointDataNV& operator=(const safe_VkCheckpointDataNV& copy_src);
+    safe_VkCheckpointDataNV(safe_VkCheckpointDataNV&& move_src) noexcept;
+    safe_VkCheckpointDataNV& operator=(safe_VkCheckpointDataNV&& move_src) noexcept;
     safe_VkCheckpointDataNV();
     ~safe_VkCheckpointDataNV();
     void initialize(const VkCheckpointDataNV* in_struct, PNextCopyState* copy_state = {});
@@ -10905,6 +12135,10 @@ struct safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL {
         const safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& copy_src);
     safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& operator=(
         const safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& copy_src);
+    safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL(
+        safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& operator=(
+        safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL();
     ~safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL();
     void initialize(const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL* in_struct, PNextCopyState* copy_state = {});
@@ -10942,6 +12176,8 @@ struct safe_VkInitializePerformanceApiInfoINTEL {
                                              bool copy_pnext = true);
     safe_VkInitializePerformanceApiInfoINTEL(const safe_VkInitializePerformanceApiInfoINTEL& copy_src);
     safe_VkInitializePerformanceApiInfoINTEL& operator=(const safe_VkInitializePerformanceApiInfoINTEL& copy_src);
+    safe_VkInitializePerformanceApiInfoINTEL(safe_VkInitializePerformanceApiInfoINTEL&& move_src) noexcept;
+    safe_VkInitializePerformanceApiInfoINTEL& operator=(safe_VkInitializePerformanceApiInfoINTEL&& move_src) noexcept;
     safe_VkInitializePerformanceApiInfoINTEL();
     ~safe_VkInitializePerformanceApiInfoINTEL();
     void initialize(const VkInitializePerformanceApiInfoINTEL* in_struct, PNextCopyState* copy_state = {});
@@ -10960,6 +12196,8 @@ struct safe_VkQueryPoolPerformanceQueryCreateInfoINTEL {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkQueryPoolPerformanceQueryCreateInfoINTEL(const safe_VkQueryPoolPerformanceQueryCreateInfoINTEL& copy_src);
     safe_VkQueryPoolPerformanceQueryCreateInfoINTEL& operator=(const safe_VkQueryPoolPerformanceQueryCreateInfoINTEL& copy_src);
+    safe_VkQueryPoolPerformanceQueryCreateInfoINTEL(safe_VkQueryPoolPerformanceQueryCreateInfoINTEL&& move_src) noexcept;
+    safe_VkQueryPoolPerformanceQueryCreateInfoINTEL& operator=(safe_VkQueryPoolPerformanceQueryCreateInfoINTEL&& move_src) noexcept;
     safe_VkQueryPoolPerformanceQueryCreateInfoINTEL();
     ~safe_VkQueryPoolPerformanceQueryCreateInfoINTEL();
     void initialize(const VkQueryPoolPerformanceQueryCreateInfoINTEL* in_struct, PNextCopyState* copy_state = {});
@@ -10980,6 +12218,8 @@ struct safe_VkPerformanceMarkerInfoINTEL {
                                       bool copy_pnext = true);
     safe_VkPerformanceMarkerInfoINTEL(const safe_VkPerformanceMarkerInfoINTEL& copy_src);
     safe_VkPerformanceMarkerInfoINTEL& operator=(const safe_VkPerformanceMarkerInfoINTEL& copy_src);
+    safe_VkPerformanceMarkerInfoINTEL(safe_VkPerformanceMarkerInfoINTEL&& move_src) noexcept;
+    safe_VkPerformanceMarkerInfoINTEL& operator=(safe_VkPerformanceMarkerInfoINTEL&& move_src) noexcept;
     safe_VkPerformanceMarkerInfoINTEL();
     ~safe_VkPerformanceMarkerInfoINTEL();
     void initialize(const VkPerformanceMarkerInfoINTEL* in_struct, PNextCopyState* copy_state = {});
@@ -10996,6 +12236,8 @@ struct safe_VkPerformanceStreamMarkerInfoINTEL {
                                             bool copy_pnext = true);
     safe_VkPerformanceStreamMarkerInfoINTEL(const safe_VkPerformanceStreamMarkerInfoINTEL& copy_src);
     safe_VkPerformanceStreamMarkerInfoINTEL& operator=(const safe_VkPerformanceStreamMarkerInfoINTEL& copy_src);
+    safe_VkPerformanceStreamMarkerInfoINTEL(safe_VkPerformanceStreamMarkerInfoINTEL&& move_src) noexcept;
+    safe_VkPerformanceStreamMarkerInfoINTEL& operator=(safe_VkPerformanceStreamMarkerInfoINTEL&& move_src) noexcept;
     safe_VkPerformanceStreamMarkerInfoINTEL();
     ~safe_VkPerformanceStreamMarkerInfoINTEL();
     void initialize(const VkPerformanceStreamMarkerInfoINTEL* in_struct, PNextCopyState* copy_state = {});
@@ -11016,6 +12258,8 @@ struct safe_VkPerformanceOverrideInfoINTEL {
                                         bool copy_pnext = true);
     safe_VkPerformanceOverrideInfoINTEL(const safe_VkPerformanceOverrideInfoINTEL& copy_src);
     safe_VkPerformanceOverrideInfoINTEL& operator=(const safe_VkPerformanceOverrideInfoINTEL& copy_src);
+    safe_VkPerformanceOverrideInfoINTEL(safe_VkPerformanceOverrideInfoINTEL&& move_src) noexcept;
+    safe_VkPerformanceOverrideInfoINTEL& operator=(safe_VkPerformanceOverrideInfoINTEL&& move_src) noexcept;
     safe_VkPerformanceOverrideInfoINTEL();
     ~safe_VkPerformanceOverrideInfoINTEL();
     void initialize(const VkPerformanceOverrideInfoINTEL* in_struct, PNextCopyState* copy_state = {});
@@ -11032,6 +12276,8 @@ struct safe_VkPerformanceConfigurationAcquireInfoINTEL {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPerformanceConfigurationAcquireInfoINTEL(const safe_VkPerformanceConfigurationAcquireInfoINTEL& copy_src);
     safe_VkPerformanceConfigurationAcquireInfoINTEL& operator=(const safe_VkPerformanceConfigurationAcquireInfoINTEL& copy_src);
+    safe_VkPerformanceConfigurationAcquireInfoINTEL(safe_VkPerformanceConfigurationAcquireInfoINTEL&& move_src) noexcept;
+    safe_VkPerformanceConfigurationAcquireInfoINTEL& operator=(safe_VkPerformanceConfigurationAcquireInfoINTEL&& move_src) noexcept;
     safe_VkPerformanceConfigurationAcquireInfoINTEL();
     ~safe_VkPerformanceConfigurationAcquireInfoINTEL();
     void initialize(const VkPerformanceConfigurationAcquireInfoINTEL* in_struct, PNextCopyState* copy_state = {});
@@ -11055,6 +12301,8 @@ struct safe_VkPhysicalDevicePCIBusInfoPropertiesEXT {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDevicePCIBusInfoPropertiesEXT(const safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& copy_src);
     safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& operator=(const safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& copy_src);
+    safe_VkPhysicalDevicePCIBusInfoPropertiesEXT(safe_VkPhysicalDevicePCIBusInfoPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& operator=(safe_VkPhysicalDevicePCIBusInfoPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDevicePCIBusInfoPropertiesEXT();
     ~safe_VkPhysicalDevicePCIBusInfoPropertiesEXT();
     void initialize(const VkPhysicalDevicePCIBusInfoPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11073,6 +12321,8 @@ struct safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD(const safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& copy_src);
     safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& operator=(const safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& copy_src);
+    safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD(safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD&& move_src) noexcept;
+    safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& operator=(safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD&& move_src) noexcept;
     safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD();
     ~safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD();
     void initialize(const VkDisplayNativeHdrSurfaceCapabilitiesAMD* in_struct, PNextCopyState* copy_state = {});
@@ -11091,6 +12341,8 @@ struct safe_VkSwapchainDisplayNativeHdrCreateInfoAMD {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSwapchainDisplayNativeHdrCreateInfoAMD(const safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& copy_src);
     safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& operator=(const safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& copy_src);
+    safe_VkSwapchainDisplayNativeHdrCreateInfoAMD(safe_VkSwapchainDisplayNativeHdrCreateInfoAMD&& move_src) noexcept;
+    safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& operator=(safe_VkSwapchainDisplayNativeHdrCreateInfoAMD&& move_src) noexcept;
     safe_VkSwapchainDisplayNativeHdrCreateInfoAMD();
     ~safe_VkSwapchainDisplayNativeHdrCreateInfoAMD();
     void initialize(const VkSwapchainDisplayNativeHdrCreateInfoAMD* in_struct, PNextCopyState* copy_state = {});
@@ -11111,6 +12363,8 @@ struct safe_VkImagePipeSurfaceCreateInfoFUCHSIA {
                                              bool copy_pnext = true);
     safe_VkImagePipeSurfaceCreateInfoFUCHSIA(const safe_VkImagePipeSurfaceCreateInfoFUCHSIA& copy_src);
     safe_VkImagePipeSurfaceCreateInfoFUCHSIA& operator=(const safe_VkImagePipeSurfaceCreateInfoFUCHSIA& copy_src);
+    safe_VkImagePipeSurfaceCreateInfoFUCHSIA(safe_VkImagePipeSurfaceCreateInfoFUCHSIA&& move_src) noexcept;
+    safe_VkImagePipeSurfaceCreateInfoFUCHSIA& operator=(safe_VkImagePipeSurfaceCreateInfoFUCHSIA&& move_src) noexcept;
     safe_VkImagePipeSurfaceCreateInfoFUCHSIA();
     ~safe_VkImagePipeSurfaceCreateInfoFUCHSIA();
     void initialize(const VkImagePipeSurfaceCreateInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -11132,6 +12386,8 @@ struct safe_VkMetalSurfaceCreateInfoEXT {
                                      bool copy_pnext = true);
     safe_VkMetalSurfaceCreateInfoEXT(const safe_VkMetalSurfaceCreateInfoEXT& copy_src);
     safe_VkMetalSurfaceCreateInfoEXT& operator=(const safe_VkMetalSurfaceCreateInfoEXT& copy_src);
+    safe_VkMetalSurfaceCreateInfoEXT(safe_VkMetalSurfaceCreateInfoEXT&& move_src) noexcept;
+    safe_VkMetalSurfaceCreateInfoEXT& operator=(safe_VkMetalSurfaceCreateInfoEXT&& move_src) noexcept;
     safe_VkMetalSurfaceCreateInfoEXT();
     ~safe_VkMetalSurfaceCreateInfoEXT();
     void initialize(const VkMetalSurfaceCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11152,6 +12408,9 @@ struct safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT {
     safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT(const safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT(safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT();
     ~safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT();
     void initialize(const VkPhysicalDeviceFragmentDensityMapFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11175,6 +12434,9 @@ struct safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT {
     safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT(const safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT(safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT();
     ~safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT();
     void initialize(const VkPhysicalDeviceFragmentDensityMapPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11195,6 +12457,9 @@ struct safe_VkRenderPassFragmentDensityMapCreateInfoEXT {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRenderPassFragmentDensityMapCreateInfoEXT(const safe_VkRenderPassFragmentDensityMapCreateInfoEXT& copy_src);
     safe_VkRenderPassFragmentDensityMapCreateInfoEXT& operator=(const safe_VkRenderPassFragmentDensityMapCreateInfoEXT& copy_src);
+    safe_VkRenderPassFragmentDensityMapCreateInfoEXT(safe_VkRenderPassFragmentDensityMapCreateInfoEXT&& move_src) noexcept;
+    safe_VkRenderPassFragmentDensityMapCreateInfoEXT& operator=(
+        safe_VkRenderPassFragmentDensityMapCreateInfoEXT&& move_src) noexcept;
     safe_VkRenderPassFragmentDensityMapCreateInfoEXT();
     ~safe_VkRenderPassFragmentDensityMapCreateInfoEXT();
     void initialize(const VkRenderPassFragmentDensityMapCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11216,6 +12481,8 @@ struct safe_VkPhysicalDeviceShaderCoreProperties2AMD {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderCoreProperties2AMD(const safe_VkPhysicalDeviceShaderCoreProperties2AMD& copy_src);
     safe_VkPhysicalDeviceShaderCoreProperties2AMD& operator=(const safe_VkPhysicalDeviceShaderCoreProperties2AMD& copy_src);
+    safe_VkPhysicalDeviceShaderCoreProperties2AMD(safe_VkPhysicalDeviceShaderCoreProperties2AMD&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderCoreProperties2AMD& operator=(safe_VkPhysicalDeviceShaderCoreProperties2AMD&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderCoreProperties2AMD();
     ~safe_VkPhysicalDeviceShaderCoreProperties2AMD();
     void initialize(const VkPhysicalDeviceShaderCoreProperties2AMD* in_struct, PNextCopyState* copy_state = {});
@@ -11234,6 +12501,8 @@ struct safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD(const safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD& copy_src);
     safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD& operator=(const safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD& copy_src);
+    safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD(safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD&& move_src) noexcept;
+    safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD& operator=(safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD&& move_src) noexcept;
     safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD();
     ~safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD();
     void initialize(const VkPhysicalDeviceCoherentMemoryFeaturesAMD* in_struct, PNextCopyState* copy_state = {});
@@ -11254,6 +12523,10 @@ struct safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT {
     safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT(const safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& copy_src);
     safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& operator=(
         const safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT(
+        safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& operator=(
+        safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT();
     ~safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT();
     void initialize(const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11275,6 +12548,8 @@ struct safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT(const safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& operator=(const safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT(safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& operator=(safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT();
     ~safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT();
     void initialize(const VkPhysicalDeviceMemoryBudgetPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11293,6 +12568,8 @@ struct safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT(const safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& operator=(const safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT(safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& operator=(safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT();
     ~safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT();
     void initialize(const VkPhysicalDeviceMemoryPriorityFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11311,6 +12588,8 @@ struct safe_VkMemoryPriorityAllocateInfoEXT {
                                          bool copy_pnext = true);
     safe_VkMemoryPriorityAllocateInfoEXT(const safe_VkMemoryPriorityAllocateInfoEXT& copy_src);
     safe_VkMemoryPriorityAllocateInfoEXT& operator=(const safe_VkMemoryPriorityAllocateInfoEXT& copy_src);
+    safe_VkMemoryPriorityAllocateInfoEXT(safe_VkMemoryPriorityAllocateInfoEXT&& move_src) noexcept;
+    safe_VkMemoryPriorityAllocateInfoEXT& operator=(safe_VkMemoryPriorityAllocateInfoEXT&& move_src) noexcept;
     safe_VkMemoryPriorityAllocateInfoEXT();
     ~safe_VkMemoryPriorityAllocateInfoEXT();
     void initialize(const VkMemoryPriorityAllocateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11330,6 +12609,10 @@ struct safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV {
         const safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& copy_src);
     safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& operator=(
         const safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV(
+        safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& operator=(
+        safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV();
     ~safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV();
     void initialize(const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -11354,6 +12637,9 @@ struct safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT {
     safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT(const safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT(safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT();
     ~safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT();
     void initialize(const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11374,6 +12660,8 @@ struct safe_VkBufferDeviceAddressCreateInfoEXT {
                                             bool copy_pnext = true);
     safe_VkBufferDeviceAddressCreateInfoEXT(const safe_VkBufferDeviceAddressCreateInfoEXT& copy_src);
     safe_VkBufferDeviceAddressCreateInfoEXT& operator=(const safe_VkBufferDeviceAddressCreateInfoEXT& copy_src);
+    safe_VkBufferDeviceAddressCreateInfoEXT(safe_VkBufferDeviceAddressCreateInfoEXT&& move_src) noexcept;
+    safe_VkBufferDeviceAddressCreateInfoEXT& operator=(safe_VkBufferDeviceAddressCreateInfoEXT&& move_src) noexcept;
     safe_VkBufferDeviceAddressCreateInfoEXT();
     ~safe_VkBufferDeviceAddressCreateInfoEXT();
     void initialize(const VkBufferDeviceAddressCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11394,6 +12682,8 @@ struct safe_VkValidationFeaturesEXT {
     safe_VkValidationFeaturesEXT(const VkValidationFeaturesEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkValidationFeaturesEXT(const safe_VkValidationFeaturesEXT& copy_src);
     safe_VkValidationFeaturesEXT& operator=(const safe_VkValidationFeaturesEXT& copy_src);
+    safe_VkValidationFeaturesEXT(safe_VkValidationFeaturesEXT&& move_src) noexcept;
+    safe_VkValidationFeaturesEXT& operator=(safe_VkValidationFeaturesEXT&& move_src) noexcept;
     safe_VkValidationFeaturesEXT();
     ~safe_VkValidationFeaturesEXT();
     void initialize(const VkValidationFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11417,6 +12707,8 @@ struct safe_VkCooperativeMatrixPropertiesNV {
                                          bool copy_pnext = true);
     safe_VkCooperativeMatrixPropertiesNV(const safe_VkCooperativeMatrixPropertiesNV& copy_src);
     safe_VkCooperativeMatrixPropertiesNV& operator=(const safe_VkCooperativeMatrixPropertiesNV& copy_src);
+    safe_VkCooperativeMatrixPropertiesNV(safe_VkCooperativeMatrixPropertiesNV&& move_src) noexcept;
+    safe_VkCooperativeMatrixPropertiesNV& operator=(safe_VkCooperativeMatrixPropertiesNV&& move_src) noexcept;
     safe_VkCooperativeMatrixPropertiesNV();
     ~safe_VkCooperativeMatrixPropertiesNV();
     void initialize(const VkCooperativeMatrixPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -11434,6 +12726,9 @@ struct safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV(const safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& copy_src);
     safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& operator=(const safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV(safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& operator=(
+        safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV();
     ~safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV();
     void initialize(const VkPhysicalDeviceCooperativeMatrixFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -11455,6 +12750,9 @@ struct safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV {
     safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV(const safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& copy_src);
     safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& operator=(
         const safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV(safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& operator=(
+        safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV();
     ~safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV();
     void initialize(const VkPhysicalDeviceCooperativeMatrixPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -11476,6 +12774,9 @@ struct safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV {
     safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV(const safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& copy_src);
     safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& operator=(
         const safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV(safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& operator=(
+        safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV();
     ~safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV();
     void initialize(const VkPhysicalDeviceCoverageReductionModeFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -11497,6 +12798,9 @@ struct safe_VkPipelineCoverageReductionStateCreateInfoNV {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineCoverageReductionStateCreateInfoNV(const safe_VkPipelineCoverageReductionStateCreateInfoNV& copy_src);
     safe_VkPipelineCoverageReductionStateCreateInfoNV& operator=(const safe_VkPipelineCoverageReductionStateCreateInfoNV& copy_src);
+    safe_VkPipelineCoverageReductionStateCreateInfoNV(safe_VkPipelineCoverageReductionStateCreateInfoNV&& move_src) noexcept;
+    safe_VkPipelineCoverageReductionStateCreateInfoNV& operator=(
+        safe_VkPipelineCoverageReductionStateCreateInfoNV&& move_src) noexcept;
     safe_VkPipelineCoverageReductionStateCreateInfoNV();
     ~safe_VkPipelineCoverageReductionStateCreateInfoNV();
     void initialize(const VkPipelineCoverageReductionStateCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -11520,6 +12824,8 @@ struct safe_VkFramebufferMixedSamplesCombinationNV {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkFramebufferMixedSamplesCombinationNV(const safe_VkFramebufferMixedSamplesCombinationNV& copy_src);
     safe_VkFramebufferMixedSamplesCombinationNV& operator=(const safe_VkFramebufferMixedSamplesCombinationNV& copy_src);
+    safe_VkFramebufferMixedSamplesCombinationNV(safe_VkFramebufferMixedSamplesCombinationNV&& move_src) noexcept;
+    safe_VkFramebufferMixedSamplesCombinationNV& operator=(safe_VkFramebufferMixedSamplesCombinationNV&& move_src) noexcept;
     safe_VkFramebufferMixedSamplesCombinationNV();
     ~safe_VkFramebufferMixedSamplesCombinationNV();
     void initialize(const VkFramebufferMixedSamplesCombinationNV* in_struct, PNextCopyState* copy_state = {});
@@ -11542,6 +12848,10 @@ struct safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT {
         const safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT(
+        safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT();
     ~safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT();
     void initialize(const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11562,6 +12872,9 @@ struct safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT(const safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& operator=(const safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT(safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT();
     ~safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT();
     void initialize(const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11583,6 +12896,8 @@ struct safe_VkPhysicalDeviceProvokingVertexFeaturesEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceProvokingVertexFeaturesEXT(const safe_VkPhysicalDeviceProvokingVertexFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceProvokingVertexFeaturesEXT& operator=(const safe_VkPhysicalDeviceProvokingVertexFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceProvokingVertexFeaturesEXT(safe_VkPhysicalDeviceProvokingVertexFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceProvokingVertexFeaturesEXT& operator=(safe_VkPhysicalDeviceProvokingVertexFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceProvokingVertexFeaturesEXT();
     ~safe_VkPhysicalDeviceProvokingVertexFeaturesEXT();
     void initialize(const VkPhysicalDeviceProvokingVertexFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11604,6 +12919,9 @@ struct safe_VkPhysicalDeviceProvokingVertexPropertiesEXT {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceProvokingVertexPropertiesEXT(const safe_VkPhysicalDeviceProvokingVertexPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceProvokingVertexPropertiesEXT& operator=(const safe_VkPhysicalDeviceProvokingVertexPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceProvokingVertexPropertiesEXT(safe_VkPhysicalDeviceProvokingVertexPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceProvokingVertexPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceProvokingVertexPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceProvokingVertexPropertiesEXT();
     ~safe_VkPhysicalDeviceProvokingVertexPropertiesEXT();
     void initialize(const VkPhysicalDeviceProvokingVertexPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11627,6 +12945,10 @@ struct safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT {
         const safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& copy_src);
     safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& operator=(
         const safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& copy_src);
+    safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT(
+        safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& operator=(
+        safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT();
     ~safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT();
     void initialize(const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11648,6 +12970,8 @@ struct safe_VkSurfaceFullScreenExclusiveInfoEXT {
                                              bool copy_pnext = true);
     safe_VkSurfaceFullScreenExclusiveInfoEXT(const safe_VkSurfaceFullScreenExclusiveInfoEXT& copy_src);
     safe_VkSurfaceFullScreenExclusiveInfoEXT& operator=(const safe_VkSurfaceFullScreenExclusiveInfoEXT& copy_src);
+    safe_VkSurfaceFullScreenExclusiveInfoEXT(safe_VkSurfaceFullScreenExclusiveInfoEXT&& move_src) noexcept;
+    safe_VkSurfaceFullScreenExclusiveInfoEXT& operator=(safe_VkSurfaceFullScreenExclusiveInfoEXT&& move_src) noexcept;
     safe_VkSurfaceFullScreenExclusiveInfoEXT();
     ~safe_VkSurfaceFullScreenExclusiveInfoEXT();
     void initialize(const VkSurfaceFullScreenExclusiveInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11666,6 +12990,9 @@ struct safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT(const safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& copy_src);
     safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& operator=(const safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& copy_src);
+    safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT(safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT&& move_src) noexcept;
+    safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& operator=(
+        safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT&& move_src) noexcept;
     safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT();
     ~safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT();
     void initialize(const VkSurfaceCapabilitiesFullScreenExclusiveEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11686,6 +13013,8 @@ struct safe_VkSurfaceFullScreenExclusiveWin32InfoEXT {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSurfaceFullScreenExclusiveWin32InfoEXT(const safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& copy_src);
     safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& operator=(const safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& copy_src);
+    safe_VkSurfaceFullScreenExclusiveWin32InfoEXT(safe_VkSurfaceFullScreenExclusiveWin32InfoEXT&& move_src) noexcept;
+    safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& operator=(safe_VkSurfaceFullScreenExclusiveWin32InfoEXT&& move_src) noexcept;
     safe_VkSurfaceFullScreenExclusiveWin32InfoEXT();
     ~safe_VkSurfaceFullScreenExclusiveWin32InfoEXT();
     void initialize(const VkSurfaceFullScreenExclusiveWin32InfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11705,6 +13034,8 @@ struct safe_VkHeadlessSurfaceCreateInfoEXT {
                                         bool copy_pnext = true);
     safe_VkHeadlessSurfaceCreateInfoEXT(const safe_VkHeadlessSurfaceCreateInfoEXT& copy_src);
     safe_VkHeadlessSurfaceCreateInfoEXT& operator=(const safe_VkHeadlessSurfaceCreateInfoEXT& copy_src);
+    safe_VkHeadlessSurfaceCreateInfoEXT(safe_VkHeadlessSurfaceCreateInfoEXT&& move_src) noexcept;
+    safe_VkHeadlessSurfaceCreateInfoEXT& operator=(safe_VkHeadlessSurfaceCreateInfoEXT&& move_src) noexcept;
     safe_VkHeadlessSurfaceCreateInfoEXT();
     ~safe_VkHeadlessSurfaceCreateInfoEXT();
     void initialize(const VkHeadlessSurfaceCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11726,6 +13057,9 @@ struct safe_VkPhysicalDeviceLineRasterizationFeaturesEXT {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceLineRasterizationFeaturesEXT(const safe_VkPhysicalDeviceLineRasterizationFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceLineRasterizationFeaturesEXT& operator=(const safe_VkPhysicalDeviceLineRasterizationFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceLineRasterizationFeaturesEXT(safe_VkPhysicalDeviceLineRasterizationFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceLineRasterizationFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceLineRasterizationFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceLineRasterizationFeaturesEXT();
     ~safe_VkPhysicalDeviceLineRasterizationFeaturesEXT();
     void initialize(const VkPhysicalDeviceLineRasterizationFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11747,6 +13081,9 @@ struct safe_VkPhysicalDeviceLineRasterizationPropertiesEXT {
     safe_VkPhysicalDeviceLineRasterizationPropertiesEXT(const safe_VkPhysicalDeviceLineRasterizationPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceLineRasterizationPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceLineRasterizationPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceLineRasterizationPropertiesEXT(safe_VkPhysicalDeviceLineRasterizationPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceLineRasterizationPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceLineRasterizationPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceLineRasterizationPropertiesEXT();
     ~safe_VkPhysicalDeviceLineRasterizationPropertiesEXT();
     void initialize(const VkPhysicalDeviceLineRasterizationPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11771,6 +13108,9 @@ struct safe_VkPipelineRasterizationLineStateCreateInfoEXT {
     safe_VkPipelineRasterizationLineStateCreateInfoEXT(const safe_VkPipelineRasterizationLineStateCreateInfoEXT& copy_src);
     safe_VkPipelineRasterizationLineStateCreateInfoEXT& operator=(
         const safe_VkPipelineRasterizationLineStateCreateInfoEXT& copy_src);
+    safe_VkPipelineRasterizationLineStateCreateInfoEXT(safe_VkPipelineRasterizationLineStateCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineRasterizationLineStateCreateInfoEXT& operator=(
+        safe_VkPipelineRasterizationLineStateCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineRasterizationLineStateCreateInfoEXT();
     ~safe_VkPipelineRasterizationLineStateCreateInfoEXT();
     void initialize(const VkPipelineRasterizationLineStateCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11802,6 +13142,9 @@ struct safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT(const safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& operator=(const safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT(safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT();
     ~safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT();
     void initialize(const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11822,6 +13165,8 @@ struct safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT(const safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT& copy_src);
     safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT& operator=(const safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT(safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT& operator=(safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT();
     ~safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT();
     void initialize(const VkPhysicalDeviceIndexTypeUint8FeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11841,6 +13186,9 @@ struct safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT {
     safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT(const safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT(safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT();
     ~safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT();
     void initialize(const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11861,6 +13209,8 @@ struct safe_VkPhysicalDeviceHostImageCopyFeaturesEXT {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceHostImageCopyFeaturesEXT(const safe_VkPhysicalDeviceHostImageCopyFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceHostImageCopyFeaturesEXT& operator=(const safe_VkPhysicalDeviceHostImageCopyFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceHostImageCopyFeaturesEXT(safe_VkPhysicalDeviceHostImageCopyFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceHostImageCopyFeaturesEXT& operator=(safe_VkPhysicalDeviceHostImageCopyFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceHostImageCopyFeaturesEXT();
     ~safe_VkPhysicalDeviceHostImageCopyFeaturesEXT();
     void initialize(const VkPhysicalDeviceHostImageCopyFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11884,6 +13234,8 @@ struct safe_VkPhysicalDeviceHostImageCopyPropertiesEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceHostImageCopyPropertiesEXT(const safe_VkPhysicalDeviceHostImageCopyPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceHostImageCopyPropertiesEXT& operator=(const safe_VkPhysicalDeviceHostImageCopyPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceHostImageCopyPropertiesEXT(safe_VkPhysicalDeviceHostImageCopyPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceHostImageCopyPropertiesEXT& operator=(safe_VkPhysicalDeviceHostImageCopyPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceHostImageCopyPropertiesEXT();
     ~safe_VkPhysicalDeviceHostImageCopyPropertiesEXT();
     void initialize(const VkPhysicalDeviceHostImageCopyPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11908,6 +13260,8 @@ struct safe_VkMemoryToImageCopyEXT {
     safe_VkMemoryToImageCopyEXT(const VkMemoryToImageCopyEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryToImageCopyEXT(const safe_VkMemoryToImageCopyEXT& copy_src);
     safe_VkMemoryToImageCopyEXT& operator=(const safe_VkMemoryToImageCopyEXT& copy_src);
+    safe_VkMemoryToImageCopyEXT(safe_VkMemoryToImageCopyEXT&& move_src) noexcept;
+    safe_VkMemoryToImageCopyEXT& operator=(safe_VkMemoryToImageCopyEXT&& move_src) noexcept;
     safe_VkMemoryToImageCopyEXT();
     ~safe_VkMemoryToImageCopyEXT();
     void initialize(const VkMemoryToImageCopyEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11928,6 +13282,8 @@ struct safe_VkImageToMemoryCopyEXT {
     safe_VkImageToMemoryCopyEXT(const VkImageToMemoryCopyEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageToMemoryCopyEXT(const safe_VkImageToMemoryCopyEXT& copy_src);
     safe_VkImageToMemoryCopyEXT& operator=(const safe_VkImageToMemoryCopyEXT& copy_src);
+    safe_VkImageToMemoryCopyEXT(safe_VkImageToMemoryCopyEXT&& move_src) noexcept;
+    safe_VkImageToMemoryCopyEXT& operator=(safe_VkImageToMemoryCopyEXT&& move_src) noexcept;
     safe_VkImageToMemoryCopyEXT();
     ~safe_VkImageToMemoryCopyEXT();
     void initialize(const VkImageToMemoryCopyEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11948,6 +13304,8 @@ struct safe_VkCopyMemoryToImageInfoEXT {
                                     bool copy_pnext = true);
     safe_VkCopyMemoryToImageInfoEXT(const safe_VkCopyMemoryToImageInfoEXT& copy_src);
     safe_VkCopyMemoryToImageInfoEXT& operator=(const safe_VkCopyMemoryToImageInfoEXT& copy_src);
+    safe_VkCopyMemoryToImageInfoEXT(safe_VkCopyMemoryToImageInfoEXT&& move_src) noexcept;
+    safe_VkCopyMemoryToImageInfoEXT& operator=(safe_VkCopyMemoryToImageInfoEXT&& move_src) noexcept;
     safe_VkCopyMemoryToImageInfoEXT();
     ~safe_VkCopyMemoryToImageInfoEXT();
     void initialize(const VkCopyMemoryToImageInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11968,6 +13326,8 @@ struct safe_VkCopyImageToMemoryInfoEXT {
                                     bool copy_pnext = true);
     safe_VkCopyImageToMemoryInfoEXT(const safe_VkCopyImageToMemoryInfoEXT& copy_src);
     safe_VkCopyImageToMemoryInfoEXT& operator=(const safe_VkCopyImageToMemoryInfoEXT& copy_src);
+    safe_VkCopyImageToMemoryInfoEXT(safe_VkCopyImageToMemoryInfoEXT&& move_src) noexcept;
+    safe_VkCopyImageToMemoryInfoEXT& operator=(safe_VkCopyImageToMemoryInfoEXT&& move_src) noexcept;
     safe_VkCopyImageToMemoryInfoEXT();
     ~safe_VkCopyImageToMemoryInfoEXT();
     void initialize(const VkCopyImageToMemoryInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -11990,6 +13350,8 @@ struct safe_VkCopyImageToImageInfoEXT {
                                    bool copy_pnext = true);
     safe_VkCopyImageToImageInfoEXT(const safe_VkCopyImageToImageInfoEXT& copy_src);
     safe_VkCopyImageToImageInfoEXT& operator=(const safe_VkCopyImageToImageInfoEXT& copy_src);
+    safe_VkCopyImageToImageInfoEXT(safe_VkCopyImageToImageInfoEXT&& move_src) noexcept;
+    safe_VkCopyImageToImageInfoEXT& operator=(safe_VkCopyImageToImageInfoEXT&& move_src) noexcept;
     safe_VkCopyImageToImageInfoEXT();
     ~safe_VkCopyImageToImageInfoEXT();
     void initialize(const VkCopyImageToImageInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12009,6 +13371,8 @@ struct safe_VkHostImageLayoutTransitionInfoEXT {
                                             bool copy_pnext = true);
     safe_VkHostImageLayoutTransitionInfoEXT(const safe_VkHostImageLayoutTransitionInfoEXT& copy_src);
     safe_VkHostImageLayoutTransitionInfoEXT& operator=(const safe_VkHostImageLayoutTransitionInfoEXT& copy_src);
+    safe_VkHostImageLayoutTransitionInfoEXT(safe_VkHostImageLayoutTransitionInfoEXT&& move_src) noexcept;
+    safe_VkHostImageLayoutTransitionInfoEXT& operator=(safe_VkHostImageLayoutTransitionInfoEXT&& move_src) noexcept;
     safe_VkHostImageLayoutTransitionInfoEXT();
     ~safe_VkHostImageLayoutTransitionInfoEXT();
     void initialize(const VkHostImageLayoutTransitionInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12027,6 +13391,8 @@ struct safe_VkSubresourceHostMemcpySizeEXT {
                                         bool copy_pnext = true);
     safe_VkSubresourceHostMemcpySizeEXT(const safe_VkSubresourceHostMemcpySizeEXT& copy_src);
     safe_VkSubresourceHostMemcpySizeEXT& operator=(const safe_VkSubresourceHostMemcpySizeEXT& copy_src);
+    safe_VkSubresourceHostMemcpySizeEXT(safe_VkSubresourceHostMemcpySizeEXT&& move_src) noexcept;
+    safe_VkSubresourceHostMemcpySizeEXT& operator=(safe_VkSubresourceHostMemcpySizeEXT&& move_src) noexcept;
     safe_VkSubresourceHostMemcpySizeEXT();
     ~safe_VkSubresourceHostMemcpySizeEXT();
     void initialize(const VkSubresourceHostMemcpySizeEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12044,6 +13410,8 @@ struct safe_VkHostImageCopyDevicePerformanceQueryEXT {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkHostImageCopyDevicePerformanceQueryEXT(const safe_VkHostImageCopyDevicePerformanceQueryEXT& copy_src);
     safe_VkHostImageCopyDevicePerformanceQueryEXT& operator=(const safe_VkHostImageCopyDevicePerformanceQueryEXT& copy_src);
+    safe_VkHostImageCopyDevicePerformanceQueryEXT(safe_VkHostImageCopyDevicePerformanceQueryEXT&& move_src) noexcept;
+    safe_VkHostImageCopyDevicePerformanceQueryEXT& operator=(safe_VkHostImageCopyDevicePerformanceQueryEXT&& move_src) noexcept;
     safe_VkHostImageCopyDevicePerformanceQueryEXT();
     ~safe_VkHostImageCopyDevicePerformanceQueryEXT();
     void initialize(const VkHostImageCopyDevicePerformanceQueryEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12074,6 +13442,9 @@ struct safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT {
     safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT(const safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& copy_src);
     safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& operator=(
         const safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT(safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& operator=(
+        safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT();
     ~safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT();
     void initialize(const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12093,6 +13464,8 @@ struct safe_VkSurfacePresentModeEXT {
     safe_VkSurfacePresentModeEXT(const VkSurfacePresentModeEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSurfacePresentModeEXT(const safe_VkSurfacePresentModeEXT& copy_src);
     safe_VkSurfacePresentModeEXT& operator=(const safe_VkSurfacePresentModeEXT& copy_src);
+    safe_VkSurfacePresentModeEXT(safe_VkSurfacePresentModeEXT&& move_src) noexcept;
+    safe_VkSurfacePresentModeEXT& operator=(safe_VkSurfacePresentModeEXT&& move_src) noexcept;
     safe_VkSurfacePresentModeEXT();
     ~safe_VkSurfacePresentModeEXT();
     void initialize(const VkSurfacePresentModeEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12113,6 +13486,8 @@ struct safe_VkSurfacePresentScalingCapabilitiesEXT {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSurfacePresentScalingCapabilitiesEXT(const safe_VkSurfacePresentScalingCapabilitiesEXT& copy_src);
     safe_VkSurfacePresentScalingCapabilitiesEXT& operator=(const safe_VkSurfacePresentScalingCapabilitiesEXT& copy_src);
+    safe_VkSurfacePresentScalingCapabilitiesEXT(safe_VkSurfacePresentScalingCapabilitiesEXT&& move_src) noexcept;
+    safe_VkSurfacePresentScalingCapabilitiesEXT& operator=(safe_VkSurfacePresentScalingCapabilitiesEXT&& move_src) noexcept;
     safe_VkSurfacePresentScalingCapabilitiesEXT();
     ~safe_VkSurfacePresentScalingCapabilitiesEXT();
     void initialize(const VkSurfacePresentScalingCapabilitiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12132,6 +13507,8 @@ struct safe_VkSurfacePresentModeCompatibilityEXT {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSurfacePresentModeCompatibilityEXT(const safe_VkSurfacePresentModeCompatibilityEXT& copy_src);
     safe_VkSurfacePresentModeCompatibilityEXT& operator=(const safe_VkSurfacePresentModeCompatibilityEXT& copy_src);
+    safe_VkSurfacePresentModeCompatibilityEXT(safe_VkSurfacePresentModeCompatibilityEXT&& move_src) noexcept;
+    safe_VkSurfacePresentModeCompatibilityEXT& operator=(safe_VkSurfacePresentModeCompatibilityEXT&& move_src) noexcept;
     safe_VkSurfacePresentModeCompatibilityEXT();
     ~safe_VkSurfacePresentModeCompatibilityEXT();
     void initialize(const VkSurfacePresentModeCompatibilityEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12151,6 +13528,10 @@ struct safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT {
     safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT(const safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& copy_src);
     safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& operator=(
         const safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT(
+        safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& operator=(
+        safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT();
     ~safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT();
     void initialize(const VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12172,6 +13553,8 @@ struct safe_VkSwapchainPresentFenceInfoEXT {
                                         bool copy_pnext = true);
     safe_VkSwapchainPresentFenceInfoEXT(const safe_VkSwapchainPresentFenceInfoEXT& copy_src);
     safe_VkSwapchainPresentFenceInfoEXT& operator=(const safe_VkSwapchainPresentFenceInfoEXT& copy_src);
+    safe_VkSwapchainPresentFenceInfoEXT(safe_VkSwapchainPresentFenceInfoEXT&& move_src) noexcept;
+    safe_VkSwapchainPresentFenceInfoEXT& operator=(safe_VkSwapchainPresentFenceInfoEXT&& move_src) noexcept;
     safe_VkSwapchainPresentFenceInfoEXT();
     ~safe_VkSwapchainPresentFenceInfoEXT();
     void initialize(const VkSwapchainPresentFenceInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12189,6 +13572,8 @@ struct safe_VkSwapchainPresentModesCreateInfoEXT {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSwapchainPresentModesCreateInfoEXT(const safe_VkSwapchainPresentModesCreateInfoEXT& copy_src);
     safe_VkSwapchainPresentModesCreateInfoEXT& operator=(const safe_VkSwapchainPresentModesCreateInfoEXT& copy_src);
+    safe_VkSwapchainPresentModesCreateInfoEXT(safe_VkSwapchainPresentModesCreateInfoEXT&& move_src) noexcept;
+    safe_VkSwapchainPresentModesCreateInfoEXT& operator=(safe_VkSwapchainPresentModesCreateInfoEXT&& move_src) noexcept;
     safe_VkSwapchainPresentModesCreateInfoEXT();
     ~safe_VkSwapchainPresentModesCreateInfoEXT();
     void initialize(const VkSwapchainPresentModesCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12208,6 +13593,8 @@ struct safe_VkSwapchainPresentModeInfoEXT {
                                        bool copy_pnext = true);
     safe_VkSwapchainPresentModeInfoEXT(const safe_VkSwapchainPresentModeInfoEXT& copy_src);
     safe_VkSwapchainPresentModeInfoEXT& operator=(const safe_VkSwapchainPresentModeInfoEXT& copy_src);
+    safe_VkSwapchainPresentModeInfoEXT(safe_VkSwapchainPresentModeInfoEXT&& move_src) noexcept;
+    safe_VkSwapchainPresentModeInfoEXT& operator=(safe_VkSwapchainPresentModeInfoEXT&& move_src) noexcept;
     safe_VkSwapchainPresentModeInfoEXT();
     ~safe_VkSwapchainPresentModeInfoEXT();
     void initialize(const VkSwapchainPresentModeInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12226,6 +13613,8 @@ struct safe_VkSwapchainPresentScalingCreateInfoEXT {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSwapchainPresentScalingCreateInfoEXT(const safe_VkSwapchainPresentScalingCreateInfoEXT& copy_src);
     safe_VkSwapchainPresentScalingCreateInfoEXT& operator=(const safe_VkSwapchainPresentScalingCreateInfoEXT& copy_src);
+    safe_VkSwapchainPresentScalingCreateInfoEXT(safe_VkSwapchainPresentScalingCreateInfoEXT&& move_src) noexcept;
+    safe_VkSwapchainPresentScalingCreateInfoEXT& operator=(safe_VkSwapchainPresentScalingCreateInfoEXT&& move_src) noexcept;
     safe_VkSwapchainPresentScalingCreateInfoEXT();
     ~safe_VkSwapchainPresentScalingCreateInfoEXT();
     void initialize(const VkSwapchainPresentScalingCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12246,6 +13635,8 @@ struct safe_VkReleaseSwapchainImagesInfoEXT {
                                          bool copy_pnext = true);
     safe_VkReleaseSwapchainImagesInfoEXT(const safe_VkReleaseSwapchainImagesInfoEXT& copy_src);
     safe_VkReleaseSwapchainImagesInfoEXT& operator=(const safe_VkReleaseSwapchainImagesInfoEXT& copy_src);
+    safe_VkReleaseSwapchainImagesInfoEXT(safe_VkReleaseSwapchainImagesInfoEXT&& move_src) noexcept;
+    safe_VkReleaseSwapchainImagesInfoEXT& operator=(safe_VkReleaseSwapchainImagesInfoEXT&& move_src) noexcept;
     safe_VkReleaseSwapchainImagesInfoEXT();
     ~safe_VkReleaseSwapchainImagesInfoEXT();
     void initialize(const VkReleaseSwapchainImagesInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12272,6 +13663,10 @@ struct safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV {
         const safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& copy_src);
     safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& operator=(
         const safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV(
+        safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& operator=(
+        safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV();
     ~safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV();
     void initialize(const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -12293,6 +13688,10 @@ struct safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV {
     safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV(const safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& copy_src);
     safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& operator=(
         const safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV(
+        safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& operator=(
+        safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV();
     ~safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV();
     void initialize(const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -12316,6 +13715,8 @@ struct safe_VkGraphicsShaderGroupCreateInfoNV {
                                            bool copy_pnext = true);
     safe_VkGraphicsShaderGroupCreateInfoNV(const safe_VkGraphicsShaderGroupCreateInfoNV& copy_src);
     safe_VkGraphicsShaderGroupCreateInfoNV& operator=(const safe_VkGraphicsShaderGroupCreateInfoNV& copy_src);
+    safe_VkGraphicsShaderGroupCreateInfoNV(safe_VkGraphicsShaderGroupCreateInfoNV&& move_src) noexcept;
+    safe_VkGraphicsShaderGroupCreateInfoNV& operator=(safe_VkGraphicsShaderGroupCreateInfoNV&& move_src) noexcept;
     safe_VkGraphicsShaderGroupCreateInfoNV();
     ~safe_VkGraphicsShaderGroupCreateInfoNV();
     void initialize(const VkGraphicsShaderGroupCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -12337,6 +13738,8 @@ struct safe_VkGraphicsPipelineShaderGroupsCreateInfoNV {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkGraphicsPipelineShaderGroupsCreateInfoNV(const safe_VkGraphicsPipelineShaderGroupsCreateInfoNV& copy_src);
     safe_VkGraphicsPipelineShaderGroupsCreateInfoNV& operator=(const safe_VkGraphicsPipelineShaderGroupsCreateInfoNV& copy_src);
+    safe_VkGraphicsPipelineShaderGroupsCreateInfoNV(safe_VkGraphicsPipelineShaderGroupsCreateInfoNV&& move_src) noexcept;
+    safe_VkGraphicsPipelineShaderGroupsCreateInfoNV& operator=(safe_VkGraphicsPipelineShaderGroupsCreateInfoNV&& move_src) noexcept;
     safe_VkGraphicsPipelineShaderGroupsCreateInfoNV();
     ~safe_VkGraphicsPipelineShaderGroupsCreateInfoNV();
     void initialize(const VkGraphicsPipelineShaderGroupsCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -12369,6 +13772,8 @@ struct safe_VkIndirectCommandsLayoutTokenNV {
                                          bool copy_pnext = true);
     safe_VkIndirectCommandsLayoutTokenNV(const safe_VkIndirectCommandsLayoutTokenNV& copy_src);
     safe_VkIndirectCommandsLayoutTokenNV& operator=(const safe_VkIndirectCommandsLayoutTokenNV& copy_src);
+    safe_VkIndirectCommandsLayoutTokenNV(safe_VkIndirectCommandsLayoutTokenNV&& move_src) noexcept;
+    safe_VkIndirectCommandsLayoutTokenNV& operator=(safe_VkIndirectCommandsLayoutTokenNV&& move_src) noexcept;
     safe_VkIndirectCommandsLayoutTokenNV();
     ~safe_VkIndirectCommandsLayoutTokenNV();
     void initialize(const VkIndirectCommandsLayoutTokenNV* in_struct, PNextCopyState* copy_state = {});
@@ -12390,6 +13795,8 @@ struct safe_VkIndirectCommandsLayoutCreateInfoNV {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkIndirectCommandsLayoutCreateInfoNV(const safe_VkIndirectCommandsLayoutCreateInfoNV& copy_src);
     safe_VkIndirectCommandsLayoutCreateInfoNV& operator=(const safe_VkIndirectCommandsLayoutCreateInfoNV& copy_src);
+    safe_VkIndirectCommandsLayoutCreateInfoNV(safe_VkIndirectCommandsLayoutCreateInfoNV&& move_src) noexcept;
+    safe_VkIndirectCommandsLayoutCreateInfoNV& operator=(safe_VkIndirectCommandsLayoutCreateInfoNV&& move_src) noexcept;
     safe_VkIndirectCommandsLayoutCreateInfoNV();
     ~safe_VkIndirectCommandsLayoutCreateInfoNV();
     void initialize(const VkIndirectCommandsLayoutCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -12420,6 +13827,8 @@ struct safe_VkGeneratedCommandsInfoNV {
                                    bool copy_pnext = true);
     safe_VkGeneratedCommandsInfoNV(const safe_VkGeneratedCommandsInfoNV& copy_src);
     safe_VkGeneratedCommandsInfoNV& operator=(const safe_VkGeneratedCommandsInfoNV& copy_src);
+    safe_VkGeneratedCommandsInfoNV(safe_VkGeneratedCommandsInfoNV&& move_src) noexcept;
+    safe_VkGeneratedCommandsInfoNV& operator=(safe_VkGeneratedCommandsInfoNV&& move_src) noexcept;
     safe_VkGeneratedCommandsInfoNV();
     ~safe_VkGeneratedCommandsInfoNV();
     void initialize(const VkGeneratedCommandsInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -12439,6 +13848,9 @@ struct safe_VkGeneratedCommandsMemoryRequirementsInfoNV {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkGeneratedCommandsMemoryRequirementsInfoNV(const safe_VkGeneratedCommandsMemoryRequirementsInfoNV& copy_src);
     safe_VkGeneratedCommandsMemoryRequirementsInfoNV& operator=(const safe_VkGeneratedCommandsMemoryRequirementsInfoNV& copy_src);
+    safe_VkGeneratedCommandsMemoryRequirementsInfoNV(safe_VkGeneratedCommandsMemoryRequirementsInfoNV&& move_src) noexcept;
+    safe_VkGeneratedCommandsMemoryRequirementsInfoNV& operator=(
+        safe_VkGeneratedCommandsMemoryRequirementsInfoNV&& move_src) noexcept;
     safe_VkGeneratedCommandsMemoryRequirementsInfoNV();
     ~safe_VkGeneratedCommandsMemoryRequirementsInfoNV();
     void initialize(const VkGeneratedCommandsMemoryRequirementsInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -12461,6 +13873,10 @@ struct safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV {
         const safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV& copy_src);
     safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV& operator=(
         const safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV(
+        safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV& operator=(
+        safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV();
     ~safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV();
     void initialize(const VkPhysicalDeviceInheritedViewportScissorFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -12484,6 +13900,9 @@ struct safe_VkCommandBufferInheritanceViewportScissorInfoNV {
     safe_VkCommandBufferInheritanceViewportScissorInfoNV(const safe_VkCommandBufferInheritanceViewportScissorInfoNV& copy_src);
     safe_VkCommandBufferInheritanceViewportScissorInfoNV& operator=(
         const safe_VkCommandBufferInheritanceViewportScissorInfoNV& copy_src);
+    safe_VkCommandBufferInheritanceViewportScissorInfoNV(safe_VkCommandBufferInheritanceViewportScissorInfoNV&& move_src) noexcept;
+    safe_VkCommandBufferInheritanceViewportScissorInfoNV& operator=(
+        safe_VkCommandBufferInheritanceViewportScissorInfoNV&& move_src) noexcept;
     safe_VkCommandBufferInheritanceViewportScissorInfoNV();
     ~safe_VkCommandBufferInheritanceViewportScissorInfoNV();
     void initialize(const VkCommandBufferInheritanceViewportScissorInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -12505,6 +13924,9 @@ struct safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT {
     safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT(const safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT(safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT();
     ~safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT();
     void initialize(const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12525,6 +13947,8 @@ struct safe_VkRenderPassTransformBeginInfoQCOM {
                                             bool copy_pnext = true);
     safe_VkRenderPassTransformBeginInfoQCOM(const safe_VkRenderPassTransformBeginInfoQCOM& copy_src);
     safe_VkRenderPassTransformBeginInfoQCOM& operator=(const safe_VkRenderPassTransformBeginInfoQCOM& copy_src);
+    safe_VkRenderPassTransformBeginInfoQCOM(safe_VkRenderPassTransformBeginInfoQCOM&& move_src) noexcept;
+    safe_VkRenderPassTransformBeginInfoQCOM& operator=(safe_VkRenderPassTransformBeginInfoQCOM&& move_src) noexcept;
     safe_VkRenderPassTransformBeginInfoQCOM();
     ~safe_VkRenderPassTransformBeginInfoQCOM();
     void initialize(const VkRenderPassTransformBeginInfoQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -12547,6 +13971,10 @@ struct safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM {
         const safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM& copy_src);
     safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM& operator=(
         const safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM& copy_src);
+    safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM(
+        safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM&& move_src) noexcept;
+    safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM& operator=(
+        safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM&& move_src) noexcept;
     safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM();
     ~safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM();
     void initialize(const VkCommandBufferInheritanceRenderPassTransformInfoQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -12570,6 +13998,9 @@ struct safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT(const safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT& operator=(const safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT(safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT();
     ~safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT();
     void initialize(const VkPhysicalDeviceDepthBiasControlFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12591,6 +14022,8 @@ struct safe_VkDepthBiasInfoEXT {
     safe_VkDepthBiasInfoEXT(const VkDepthBiasInfoEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDepthBiasInfoEXT(const safe_VkDepthBiasInfoEXT& copy_src);
     safe_VkDepthBiasInfoEXT& operator=(const safe_VkDepthBiasInfoEXT& copy_src);
+    safe_VkDepthBiasInfoEXT(safe_VkDepthBiasInfoEXT&& move_src) noexcept;
+    safe_VkDepthBiasInfoEXT& operator=(safe_VkDepthBiasInfoEXT&& move_src) noexcept;
     safe_VkDepthBiasInfoEXT();
     ~safe_VkDepthBiasInfoEXT();
     void initialize(const VkDepthBiasInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12608,6 +14041,8 @@ struct safe_VkDepthBiasRepresentationInfoEXT {
                                           bool copy_pnext = true);
     safe_VkDepthBiasRepresentationInfoEXT(const safe_VkDepthBiasRepresentationInfoEXT& copy_src);
     safe_VkDepthBiasRepresentationInfoEXT& operator=(const safe_VkDepthBiasRepresentationInfoEXT& copy_src);
+    safe_VkDepthBiasRepresentationInfoEXT(safe_VkDepthBiasRepresentationInfoEXT&& move_src) noexcept;
+    safe_VkDepthBiasRepresentationInfoEXT& operator=(safe_VkDepthBiasRepresentationInfoEXT&& move_src) noexcept;
     safe_VkDepthBiasRepresentationInfoEXT();
     ~safe_VkDepthBiasRepresentationInfoEXT();
     void initialize(const VkDepthBiasRepresentationInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12625,6 +14060,9 @@ struct safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT {
     safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT(const safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT(safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT();
     ~safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT();
     void initialize(const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12651,6 +14089,8 @@ struct safe_VkDeviceMemoryReportCallbackDataEXT {
                                              bool copy_pnext = true);
     safe_VkDeviceMemoryReportCallbackDataEXT(const safe_VkDeviceMemoryReportCallbackDataEXT& copy_src);
     safe_VkDeviceMemoryReportCallbackDataEXT& operator=(const safe_VkDeviceMemoryReportCallbackDataEXT& copy_src);
+    safe_VkDeviceMemoryReportCallbackDataEXT(safe_VkDeviceMemoryReportCallbackDataEXT&& move_src) noexcept;
+    safe_VkDeviceMemoryReportCallbackDataEXT& operator=(safe_VkDeviceMemoryReportCallbackDataEXT&& move_src) noexcept;
     safe_VkDeviceMemoryReportCallbackDataEXT();
     ~safe_VkDeviceMemoryReportCallbackDataEXT();
     void initialize(const VkDeviceMemoryReportCallbackDataEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12671,6 +14111,8 @@ struct safe_VkDeviceDeviceMemoryReportCreateInfoEXT {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceDeviceMemoryReportCreateInfoEXT(const safe_VkDeviceDeviceMemoryReportCreateInfoEXT& copy_src);
     safe_VkDeviceDeviceMemoryReportCreateInfoEXT& operator=(const safe_VkDeviceDeviceMemoryReportCreateInfoEXT& copy_src);
+    safe_VkDeviceDeviceMemoryReportCreateInfoEXT(safe_VkDeviceDeviceMemoryReportCreateInfoEXT&& move_src) noexcept;
+    safe_VkDeviceDeviceMemoryReportCreateInfoEXT& operator=(safe_VkDeviceDeviceMemoryReportCreateInfoEXT&& move_src) noexcept;
     safe_VkDeviceDeviceMemoryReportCreateInfoEXT();
     ~safe_VkDeviceDeviceMemoryReportCreateInfoEXT();
     void initialize(const VkDeviceDeviceMemoryReportCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12691,6 +14133,8 @@ struct safe_VkPhysicalDeviceRobustness2FeaturesEXT {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceRobustness2FeaturesEXT(const safe_VkPhysicalDeviceRobustness2FeaturesEXT& copy_src);
     safe_VkPhysicalDeviceRobustness2FeaturesEXT& operator=(const safe_VkPhysicalDeviceRobustness2FeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceRobustness2FeaturesEXT(safe_VkPhysicalDeviceRobustness2FeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceRobustness2FeaturesEXT& operator=(safe_VkPhysicalDeviceRobustness2FeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceRobustness2FeaturesEXT();
     ~safe_VkPhysicalDeviceRobustness2FeaturesEXT();
     void initialize(const VkPhysicalDeviceRobustness2FeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12710,6 +14154,8 @@ struct safe_VkPhysicalDeviceRobustness2PropertiesEXT {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceRobustness2PropertiesEXT(const safe_VkPhysicalDeviceRobustness2PropertiesEXT& copy_src);
     safe_VkPhysicalDeviceRobustness2PropertiesEXT& operator=(const safe_VkPhysicalDeviceRobustness2PropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceRobustness2PropertiesEXT(safe_VkPhysicalDeviceRobustness2PropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceRobustness2PropertiesEXT& operator=(safe_VkPhysicalDeviceRobustness2PropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceRobustness2PropertiesEXT();
     ~safe_VkPhysicalDeviceRobustness2PropertiesEXT();
     void initialize(const VkPhysicalDeviceRobustness2PropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12729,6 +14175,8 @@ struct safe_VkSamplerCustomBorderColorCreateInfoEXT {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSamplerCustomBorderColorCreateInfoEXT(const safe_VkSamplerCustomBorderColorCreateInfoEXT& copy_src);
     safe_VkSamplerCustomBorderColorCreateInfoEXT& operator=(const safe_VkSamplerCustomBorderColorCreateInfoEXT& copy_src);
+    safe_VkSamplerCustomBorderColorCreateInfoEXT(safe_VkSamplerCustomBorderColorCreateInfoEXT&& move_src) noexcept;
+    safe_VkSamplerCustomBorderColorCreateInfoEXT& operator=(safe_VkSamplerCustomBorderColorCreateInfoEXT&& move_src) noexcept;
     safe_VkSamplerCustomBorderColorCreateInfoEXT();
     ~safe_VkSamplerCustomBorderColorCreateInfoEXT();
     void initialize(const VkSamplerCustomBorderColorCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12748,6 +14196,9 @@ struct safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT {
     safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT(const safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT(safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT();
     ~safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT();
     void initialize(const VkPhysicalDeviceCustomBorderColorPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12769,6 +14220,9 @@ struct safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT(const safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT& operator=(const safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT(safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT();
     ~safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT();
     void initialize(const VkPhysicalDeviceCustomBorderColorFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -12789,6 +14243,8 @@ struct safe_VkPhysicalDevicePresentBarrierFeaturesNV {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDevicePresentBarrierFeaturesNV(const safe_VkPhysicalDevicePresentBarrierFeaturesNV& copy_src);
     safe_VkPhysicalDevicePresentBarrierFeaturesNV& operator=(const safe_VkPhysicalDevicePresentBarrierFeaturesNV& copy_src);
+    safe_VkPhysicalDevicePresentBarrierFeaturesNV(safe_VkPhysicalDevicePresentBarrierFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDevicePresentBarrierFeaturesNV& operator=(safe_VkPhysicalDevicePresentBarrierFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDevicePresentBarrierFeaturesNV();
     ~safe_VkPhysicalDevicePresentBarrierFeaturesNV();
     void initialize(const VkPhysicalDevicePresentBarrierFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -12807,6 +14263,8 @@ struct safe_VkSurfaceCapabilitiesPresentBarrierNV {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSurfaceCapabilitiesPresentBarrierNV(const safe_VkSurfaceCapabilitiesPresentBarrierNV& copy_src);
     safe_VkSurfaceCapabilitiesPresentBarrierNV& operator=(const safe_VkSurfaceCapabilitiesPresentBarrierNV& copy_src);
+    safe_VkSurfaceCapabilitiesPresentBarrierNV(safe_VkSurfaceCapabilitiesPresentBarrierNV&& move_src) noexcept;
+    safe_VkSurfaceCapabilitiesPresentBarrierNV& operator=(safe_VkSurfaceCapabilitiesPresentBarrierNV&& move_src) noexcept;
     safe_VkSurfaceCapabilitiesPresentBarrierNV();
     ~safe_VkSurfaceCapabilitiesPresentBarrierNV();
     void initialize(const VkSurfaceCapabilitiesPresentBarrierNV* in_struct, PNextCopyState* copy_state = {});
@@ -12825,6 +14283,8 @@ struct safe_VkSwapchainPresentBarrierCreateInfoNV {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSwapchainPresentBarrierCreateInfoNV(const safe_VkSwapchainPresentBarrierCreateInfoNV& copy_src);
     safe_VkSwapchainPresentBarrierCreateInfoNV& operator=(const safe_VkSwapchainPresentBarrierCreateInfoNV& copy_src);
+    safe_VkSwapchainPresentBarrierCreateInfoNV(safe_VkSwapchainPresentBarrierCreateInfoNV&& move_src) noexcept;
+    safe_VkSwapchainPresentBarrierCreateInfoNV& operator=(safe_VkSwapchainPresentBarrierCreateInfoNV&& move_src) noexcept;
     safe_VkSwapchainPresentBarrierCreateInfoNV();
     ~safe_VkSwapchainPresentBarrierCreateInfoNV();
     void initialize(const VkSwapchainPresentBarrierCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -12843,6 +14303,9 @@ struct safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV(const safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV& copy_src);
     safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV& operator=(const safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV(safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV& operator=(
+        safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV();
     ~safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV();
     void initialize(const VkPhysicalDeviceDiagnosticsConfigFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -12863,6 +14326,8 @@ struct safe_VkDeviceDiagnosticsConfigCreateInfoNV {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceDiagnosticsConfigCreateInfoNV(const safe_VkDeviceDiagnosticsConfigCreateInfoNV& copy_src);
     safe_VkDeviceDiagnosticsConfigCreateInfoNV& operator=(const safe_VkDeviceDiagnosticsConfigCreateInfoNV& copy_src);
+    safe_VkDeviceDiagnosticsConfigCreateInfoNV(safe_VkDeviceDiagnosticsConfigCreateInfoNV&& move_src) noexcept;
+    safe_VkDeviceDiagnosticsConfigCreateInfoNV& operator=(safe_VkDeviceDiagnosticsConfigCreateInfoNV&& move_src) noexcept;
     safe_VkDeviceDiagnosticsConfigCreateInfoNV();
     ~safe_VkDeviceDiagnosticsConfigCreateInfoNV();
     void initialize(const VkDeviceDiagnosticsConfigCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -12882,6 +14347,8 @@ struct safe_VkCudaModuleCreateInfoNV {
                                   bool copy_pnext = true);
     safe_VkCudaModuleCreateInfoNV(const safe_VkCudaModuleCreateInfoNV& copy_src);
     safe_VkCudaModuleCreateInfoNV& operator=(const safe_VkCudaModuleCreateInfoNV& copy_src);
+    safe_VkCudaModuleCreateInfoNV(safe_VkCudaModuleCreateInfoNV&& move_src) noexcept;
+    safe_VkCudaModuleCreateInfoNV& operator=(safe_VkCudaModuleCreateInfoNV&& move_src) noexcept;
     safe_VkCudaModuleCreateInfoNV();
     ~safe_VkCudaModuleCreateInfoNV();
     void initialize(const VkCudaModuleCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -12899,6 +14366,8 @@ struct safe_VkCudaFunctionCreateInfoNV {
                                     bool copy_pnext = true);
     safe_VkCudaFunctionCreateInfoNV(const safe_VkCudaFunctionCreateInfoNV& copy_src);
     safe_VkCudaFunctionCreateInfoNV& operator=(const safe_VkCudaFunctionCreateInfoNV& copy_src);
+    safe_VkCudaFunctionCreateInfoNV(safe_VkCudaFunctionCreateInfoNV&& move_src) noexcept;
+    safe_VkCudaFunctionCreateInfoNV& operator=(safe_VkCudaFunctionCreateInfoNV&& move_src) noexcept;
     safe_VkCudaFunctionCreateInfoNV();
     ~safe_VkCudaFunctionCreateInfoNV();
     void initialize(const VkCudaFunctionCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -12925,6 +14394,8 @@ struct safe_VkCudaLaunchInfoNV {
     safe_VkCudaLaunchInfoNV(const VkCudaLaunchInfoNV* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCudaLaunchInfoNV(const safe_VkCudaLaunchInfoNV& copy_src);
     safe_VkCudaLaunchInfoNV& operator=(const safe_VkCudaLaunchInfoNV& copy_src);
+    safe_VkCudaLaunchInfoNV(safe_VkCudaLaunchInfoNV&& move_src) noexcept;
+    safe_VkCudaLaunchInfoNV& operator=(safe_VkCudaLaunchInfoNV&& move_src) noexcept;
     safe_VkCudaLaunchInfoNV();
     ~safe_VkCudaLaunchInfoNV();
     void initialize(const VkCudaLaunchInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -12941,6 +14412,8 @@ struct safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV(const safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV& copy_src);
     safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV& operator=(const safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV(safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV& operator=(safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV();
     ~safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV();
     void initialize(const VkPhysicalDeviceCudaKernelLaunchFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -12962,6 +14435,9 @@ struct safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV(const safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV& copy_src);
     safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV& operator=(const safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV(safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV& operator=(
+        safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV();
     ~safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV();
     void initialize(const VkPhysicalDeviceCudaKernelLaunchPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -12982,6 +14458,8 @@ struct safe_VkQueryLowLatencySupportNV {
                                     bool copy_pnext = true);
     safe_VkQueryLowLatencySupportNV(const safe_VkQueryLowLatencySupportNV& copy_src);
     safe_VkQueryLowLatencySupportNV& operator=(const safe_VkQueryLowLatencySupportNV& copy_src);
+    safe_VkQueryLowLatencySupportNV(safe_VkQueryLowLatencySupportNV&& move_src) noexcept;
+    safe_VkQueryLowLatencySupportNV& operator=(safe_VkQueryLowLatencySupportNV&& move_src) noexcept;
     safe_VkQueryLowLatencySupportNV();
     ~safe_VkQueryLowLatencySupportNV();
     void initialize(const VkQueryLowLatencySupportNV* in_struct, PNextCopyState* copy_state = {});
@@ -12999,6 +14477,8 @@ struct safe_VkExportMetalObjectCreateInfoEXT {
                                           bool copy_pnext = true);
     safe_VkExportMetalObjectCreateInfoEXT(const safe_VkExportMetalObjectCreateInfoEXT& copy_src);
     safe_VkExportMetalObjectCreateInfoEXT& operator=(const safe_VkExportMetalObjectCreateInfoEXT& copy_src);
+    safe_VkExportMetalObjectCreateInfoEXT(safe_VkExportMetalObjectCreateInfoEXT&& move_src) noexcept;
+    safe_VkExportMetalObjectCreateInfoEXT& operator=(safe_VkExportMetalObjectCreateInfoEXT&& move_src) noexcept;
     safe_VkExportMetalObjectCreateInfoEXT();
     ~safe_VkExportMetalObjectCreateInfoEXT();
     void initialize(const VkExportMetalObjectCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13014,6 +14494,8 @@ struct safe_VkExportMetalObjectsInfoEXT {
                                      bool copy_pnext = true);
     safe_VkExportMetalObjectsInfoEXT(const safe_VkExportMetalObjectsInfoEXT& copy_src);
     safe_VkExportMetalObjectsInfoEXT& operator=(const safe_VkExportMetalObjectsInfoEXT& copy_src);
+    safe_VkExportMetalObjectsInfoEXT(safe_VkExportMetalObjectsInfoEXT&& move_src) noexcept;
+    safe_VkExportMetalObjectsInfoEXT& operator=(safe_VkExportMetalObjectsInfoEXT&& move_src) noexcept;
     safe_VkExportMetalObjectsInfoEXT();
     ~safe_VkExportMetalObjectsInfoEXT();
     void initialize(const VkExportMetalObjectsInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13030,6 +14512,8 @@ struct safe_VkExportMetalDeviceInfoEXT {
                                     bool copy_pnext = true);
     safe_VkExportMetalDeviceInfoEXT(const safe_VkExportMetalDeviceInfoEXT& copy_src);
     safe_VkExportMetalDeviceInfoEXT& operator=(const safe_VkExportMetalDeviceInfoEXT& copy_src);
+    safe_VkExportMetalDeviceInfoEXT(safe_VkExportMetalDeviceInfoEXT&& move_src) noexcept;
+    safe_VkExportMetalDeviceInfoEXT& operator=(safe_VkExportMetalDeviceInfoEXT&& move_src) noexcept;
     safe_VkExportMetalDeviceInfoEXT();
     ~safe_VkExportMetalDeviceInfoEXT();
     void initialize(const VkExportMetalDeviceInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13047,6 +14531,8 @@ struct safe_VkExportMetalCommandQueueInfoEXT {
                                           bool copy_pnext = true);
     safe_VkExportMetalCommandQueueInfoEXT(const safe_VkExportMetalCommandQueueInfoEXT& copy_src);
     safe_VkExportMetalCommandQueueInfoEXT& operator=(const safe_VkExportMetalCommandQueueInfoEXT& copy_src);
+    safe_VkExportMetalCommandQueueInfoEXT(safe_VkExportMetalCommandQueueInfoEXT&& move_src) noexcept;
+    safe_VkExportMetalCommandQueueInfoEXT& operator=(safe_VkExportMetalCommandQueueInfoEXT&& move_src) noexcept;
     safe_VkExportMetalCommandQueueInfoEXT();
     ~safe_VkExportMetalCommandQueueInfoEXT();
     void initialize(const VkExportMetalCommandQueueInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13064,6 +14550,8 @@ struct safe_VkExportMetalBufferInfoEXT {
                                     bool copy_pnext = true);
     safe_VkExportMetalBufferInfoEXT(const safe_VkExportMetalBufferInfoEXT& copy_src);
     safe_VkExportMetalBufferInfoEXT& operator=(const safe_VkExportMetalBufferInfoEXT& copy_src);
+    safe_VkExportMetalBufferInfoEXT(safe_VkExportMetalBufferInfoEXT&& move_src) noexcept;
+    safe_VkExportMetalBufferInfoEXT& operator=(safe_VkExportMetalBufferInfoEXT&& move_src) noexcept;
     safe_VkExportMetalBufferInfoEXT();
     ~safe_VkExportMetalBufferInfoEXT();
     void initialize(const VkExportMetalBufferInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13080,6 +14568,8 @@ struct safe_VkImportMetalBufferInfoEXT {
                                     bool copy_pnext = true);
     safe_VkImportMetalBufferInfoEXT(const safe_VkImportMetalBufferInfoEXT& copy_src);
     safe_VkImportMetalBufferInfoEXT& operator=(const safe_VkImportMetalBufferInfoEXT& copy_src);
+    safe_VkImportMetalBufferInfoEXT(safe_VkImportMetalBufferInfoEXT&& move_src) noexcept;
+    safe_VkImportMetalBufferInfoEXT& operator=(safe_VkImportMetalBufferInfoEXT&& move_src) noexcept;
     safe_VkImportMetalBufferInfoEXT();
     ~safe_VkImportMetalBufferInfoEXT();
     void initialize(const VkImportMetalBufferInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13100,6 +14590,8 @@ struct safe_VkExportMetalTextureInfoEXT {
                                      bool copy_pnext = true);
     safe_VkExportMetalTextureInfoEXT(const safe_VkExportMetalTextureInfoEXT& copy_src);
     safe_VkExportMetalTextureInfoEXT& operator=(const safe_VkExportMetalTextureInfoEXT& copy_src);
+    safe_VkExportMetalTextureInfoEXT(safe_VkExportMetalTextureInfoEXT&& move_src) noexcept;
+    safe_VkExportMetalTextureInfoEXT& operator=(safe_VkExportMetalTextureInfoEXT&& move_src) noexcept;
     safe_VkExportMetalTextureInfoEXT();
     ~safe_VkExportMetalTextureInfoEXT();
     void initialize(const VkExportMetalTextureInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13117,6 +14609,8 @@ struct safe_VkImportMetalTextureInfoEXT {
                                      bool copy_pnext = true);
     safe_VkImportMetalTextureInfoEXT(const safe_VkImportMetalTextureInfoEXT& copy_src);
     safe_VkImportMetalTextureInfoEXT& operator=(const safe_VkImportMetalTextureInfoEXT& copy_src);
+    safe_VkImportMetalTextureInfoEXT(safe_VkImportMetalTextureInfoEXT&& move_src) noexcept;
+    safe_VkImportMetalTextureInfoEXT& operator=(safe_VkImportMetalTextureInfoEXT&& move_src) noexcept;
     safe_VkImportMetalTextureInfoEXT();
     ~safe_VkImportMetalTextureInfoEXT();
     void initialize(const VkImportMetalTextureInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13134,6 +14628,8 @@ struct safe_VkExportMetalIOSurfaceInfoEXT {
                                        bool copy_pnext = true);
     safe_VkExportMetalIOSurfaceInfoEXT(const safe_VkExportMetalIOSurfaceInfoEXT& copy_src);
     safe_VkExportMetalIOSurfaceInfoEXT& operator=(const safe_VkExportMetalIOSurfaceInfoEXT& copy_src);
+    safe_VkExportMetalIOSurfaceInfoEXT(safe_VkExportMetalIOSurfaceInfoEXT&& move_src) noexcept;
+    safe_VkExportMetalIOSurfaceInfoEXT& operator=(safe_VkExportMetalIOSurfaceInfoEXT&& move_src) noexcept;
     safe_VkExportMetalIOSurfaceInfoEXT();
     ~safe_VkExportMetalIOSurfaceInfoEXT();
     void initialize(const VkExportMetalIOSurfaceInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13150,6 +14646,8 @@ struct safe_VkImportMetalIOSurfaceInfoEXT {
                                        bool copy_pnext = true);
     safe_VkImportMetalIOSurfaceInfoEXT(const safe_VkImportMetalIOSurfaceInfoEXT& copy_src);
     safe_VkImportMetalIOSurfaceInfoEXT& operator=(const safe_VkImportMetalIOSurfaceInfoEXT& copy_src);
+    safe_VkImportMetalIOSurfaceInfoEXT(safe_VkImportMetalIOSurfaceInfoEXT&& move_src) noexcept;
+    safe_VkImportMetalIOSurfaceInfoEXT& operator=(safe_VkImportMetalIOSurfaceInfoEXT&& move_src) noexcept;
     safe_VkImportMetalIOSurfaceInfoEXT();
     ~safe_VkImportMetalIOSurfaceInfoEXT();
     void initialize(const VkImportMetalIOSurfaceInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13168,6 +14666,8 @@ struct safe_VkExportMetalSharedEventInfoEXT {
                                          bool copy_pnext = true);
     safe_VkExportMetalSharedEventInfoEXT(const safe_VkExportMetalSharedEventInfoEXT& copy_src);
     safe_VkExportMetalSharedEventInfoEXT& operator=(const safe_VkExportMetalSharedEventInfoEXT& copy_src);
+    safe_VkExportMetalSharedEventInfoEXT(safe_VkExportMetalSharedEventInfoEXT&& move_src) noexcept;
+    safe_VkExportMetalSharedEventInfoEXT& operator=(safe_VkExportMetalSharedEventInfoEXT&& move_src) noexcept;
     safe_VkExportMetalSharedEventInfoEXT();
     ~safe_VkExportMetalSharedEventInfoEXT();
     void initialize(const VkExportMetalSharedEventInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13184,6 +14684,8 @@ struct safe_VkImportMetalSharedEventInfoEXT {
                                          bool copy_pnext = true);
     safe_VkImportMetalSharedEventInfoEXT(const safe_VkImportMetalSharedEventInfoEXT& copy_src);
     safe_VkImportMetalSharedEventInfoEXT& operator=(const safe_VkImportMetalSharedEventInfoEXT& copy_src);
+    safe_VkImportMetalSharedEventInfoEXT(safe_VkImportMetalSharedEventInfoEXT&& move_src) noexcept;
+    safe_VkImportMetalSharedEventInfoEXT& operator=(safe_VkImportMetalSharedEventInfoEXT&& move_src) noexcept;
     safe_VkImportMetalSharedEventInfoEXT();
     ~safe_VkImportMetalSharedEventInfoEXT();
     void initialize(const VkImportMetalSharedEventInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13234,6 +14736,9 @@ struct safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT {
     safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT(const safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT(safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT();
     ~safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT();
     void initialize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13257,6 +14762,10 @@ struct safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT {
         const safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT(
+        safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT();
     ~safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT();
     void initialize(const VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13280,6 +14789,9 @@ struct safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT(const safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT& operator=(const safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT(safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT();
     ~safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT();
     void initialize(const VkPhysicalDeviceDescriptorBufferFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13302,6 +14814,8 @@ struct safe_VkDescriptorAddressInfoEXT {
                                     bool copy_pnext = true);
     safe_VkDescriptorAddressInfoEXT(const safe_VkDescriptorAddressInfoEXT& copy_src);
     safe_VkDescriptorAddressInfoEXT& operator=(const safe_VkDescriptorAddressInfoEXT& copy_src);
+    safe_VkDescriptorAddressInfoEXT(safe_VkDescriptorAddressInfoEXT&& move_src) noexcept;
+    safe_VkDescriptorAddressInfoEXT& operator=(safe_VkDescriptorAddressInfoEXT&& move_src) noexcept;
     safe_VkDescriptorAddressInfoEXT();
     ~safe_VkDescriptorAddressInfoEXT();
     void initialize(const VkDescriptorAddressInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13319,6 +14833,8 @@ struct safe_VkDescriptorBufferBindingInfoEXT {
                                           bool copy_pnext = true);
     safe_VkDescriptorBufferBindingInfoEXT(const safe_VkDescriptorBufferBindingInfoEXT& copy_src);
     safe_VkDescriptorBufferBindingInfoEXT& operator=(const safe_VkDescriptorBufferBindingInfoEXT& copy_src);
+    safe_VkDescriptorBufferBindingInfoEXT(safe_VkDescriptorBufferBindingInfoEXT&& move_src) noexcept;
+    safe_VkDescriptorBufferBindingInfoEXT& operator=(safe_VkDescriptorBufferBindingInfoEXT&& move_src) noexcept;
     safe_VkDescriptorBufferBindingInfoEXT();
     ~safe_VkDescriptorBufferBindingInfoEXT();
     void initialize(const VkDescriptorBufferBindingInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13338,6 +14854,10 @@ struct safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT {
         const safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& copy_src);
     safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& operator=(
         const safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& copy_src);
+    safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT(
+        safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT&& move_src) noexcept;
+    safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& operator=(
+        safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT&& move_src) noexcept;
     safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT();
     ~safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT();
     void initialize(const VkDescriptorBufferBindingPushDescriptorBufferHandleEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13380,6 +14900,8 @@ struct safe_VkDescriptorGetInfoEXT {
     safe_VkDescriptorGetInfoEXT(const VkDescriptorGetInfoEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDescriptorGetInfoEXT(const safe_VkDescriptorGetInfoEXT& copy_src);
     safe_VkDescriptorGetInfoEXT& operator=(const safe_VkDescriptorGetInfoEXT& copy_src);
+    safe_VkDescriptorGetInfoEXT(safe_VkDescriptorGetInfoEXT&& move_src) noexcept;
+    safe_VkDescriptorGetInfoEXT& operator=(safe_VkDescriptorGetInfoEXT&& move_src) noexcept;
     safe_VkDescriptorGetInfoEXT();
     ~safe_VkDescriptorGetInfoEXT();
     void initialize(const VkDescriptorGetInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13396,6 +14918,8 @@ struct safe_VkBufferCaptureDescriptorDataInfoEXT {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBufferCaptureDescriptorDataInfoEXT(const safe_VkBufferCaptureDescriptorDataInfoEXT& copy_src);
     safe_VkBufferCaptureDescriptorDataInfoEXT& operator=(const safe_VkBufferCaptureDescriptorDataInfoEXT& copy_src);
+    safe_VkBufferCaptureDescriptorDataInfoEXT(safe_VkBufferCaptureDescriptorDataInfoEXT&& move_src) noexcept;
+    safe_VkBufferCaptureDescriptorDataInfoEXT& operator=(safe_VkBufferCaptureDescriptorDataInfoEXT&& move_src) noexcept;
     safe_VkBufferCaptureDescriptorDataInfoEXT();
     ~safe_VkBufferCaptureDescriptorDataInfoEXT();
     void initialize(const VkBufferCaptureDescriptorDataInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13414,6 +14938,8 @@ struct safe_VkImageCaptureDescriptorDataInfoEXT {
                                              bool copy_pnext = true);
     safe_VkImageCaptureDescriptorDataInfoEXT(const safe_VkImageCaptureDescriptorDataInfoEXT& copy_src);
     safe_VkImageCaptureDescriptorDataInfoEXT& operator=(const safe_VkImageCaptureDescriptorDataInfoEXT& copy_src);
+    safe_VkImageCaptureDescriptorDataInfoEXT(safe_VkImageCaptureDescriptorDataInfoEXT&& move_src) noexcept;
+    safe_VkImageCaptureDescriptorDataInfoEXT& operator=(safe_VkImageCaptureDescriptorDataInfoEXT&& move_src) noexcept;
     safe_VkImageCaptureDescriptorDataInfoEXT();
     ~safe_VkImageCaptureDescriptorDataInfoEXT();
     void initialize(const VkImageCaptureDescriptorDataInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13432,6 +14958,8 @@ struct safe_VkImageViewCaptureDescriptorDataInfoEXT {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageViewCaptureDescriptorDataInfoEXT(const safe_VkImageViewCaptureDescriptorDataInfoEXT& copy_src);
     safe_VkImageViewCaptureDescriptorDataInfoEXT& operator=(const safe_VkImageViewCaptureDescriptorDataInfoEXT& copy_src);
+    safe_VkImageViewCaptureDescriptorDataInfoEXT(safe_VkImageViewCaptureDescriptorDataInfoEXT&& move_src) noexcept;
+    safe_VkImageViewCaptureDescriptorDataInfoEXT& operator=(safe_VkImageViewCaptureDescriptorDataInfoEXT&& move_src) noexcept;
     safe_VkImageViewCaptureDescriptorDataInfoEXT();
     ~safe_VkImageViewCaptureDescriptorDataInfoEXT();
     void initialize(const VkImageViewCaptureDescriptorDataInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13450,6 +14978,8 @@ struct safe_VkSamplerCaptureDescriptorDataInfoEXT {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSamplerCaptureDescriptorDataInfoEXT(const safe_VkSamplerCaptureDescriptorDataInfoEXT& copy_src);
     safe_VkSamplerCaptureDescriptorDataInfoEXT& operator=(const safe_VkSamplerCaptureDescriptorDataInfoEXT& copy_src);
+    safe_VkSamplerCaptureDescriptorDataInfoEXT(safe_VkSamplerCaptureDescriptorDataInfoEXT&& move_src) noexcept;
+    safe_VkSamplerCaptureDescriptorDataInfoEXT& operator=(safe_VkSamplerCaptureDescriptorDataInfoEXT&& move_src) noexcept;
     safe_VkSamplerCaptureDescriptorDataInfoEXT();
     ~safe_VkSamplerCaptureDescriptorDataInfoEXT();
     void initialize(const VkSamplerCaptureDescriptorDataInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13468,6 +14998,8 @@ struct safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT(const safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT& copy_src);
     safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT& operator=(const safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT& copy_src);
+    safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT(safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT&& move_src) noexcept;
+    safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT& operator=(safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT&& move_src) noexcept;
     safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT();
     ~safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT();
     void initialize(const VkOpaqueCaptureDescriptorDataCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13491,6 +15023,10 @@ struct safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT {
         const safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT& copy_src);
     safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT& operator=(
         const safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT& copy_src);
+    safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT(
+        safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT&& move_src) noexcept;
+    safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT& operator=(
+        safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT&& move_src) noexcept;
     safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT();
     ~safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT();
     void initialize(const VkAccelerationStructureCaptureDescriptorDataInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13513,6 +15049,10 @@ struct safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT {
         const safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT(
+        safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT();
     ~safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT();
     void initialize(const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13536,6 +15076,10 @@ struct safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT {
         const safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT(
+        safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT();
     ~safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT();
     void initialize(const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13556,6 +15100,8 @@ struct safe_VkGraphicsPipelineLibraryCreateInfoEXT {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkGraphicsPipelineLibraryCreateInfoEXT(const safe_VkGraphicsPipelineLibraryCreateInfoEXT& copy_src);
     safe_VkGraphicsPipelineLibraryCreateInfoEXT& operator=(const safe_VkGraphicsPipelineLibraryCreateInfoEXT& copy_src);
+    safe_VkGraphicsPipelineLibraryCreateInfoEXT(safe_VkGraphicsPipelineLibraryCreateInfoEXT&& move_src) noexcept;
+    safe_VkGraphicsPipelineLibraryCreateInfoEXT& operator=(safe_VkGraphicsPipelineLibraryCreateInfoEXT&& move_src) noexcept;
     safe_VkGraphicsPipelineLibraryCreateInfoEXT();
     ~safe_VkGraphicsPipelineLibraryCreateInfoEXT();
     void initialize(const VkGraphicsPipelineLibraryCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13577,6 +15123,10 @@ struct safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD {
         const safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& copy_src);
     safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& operator=(
         const safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& copy_src);
+    safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD(
+        safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& operator=(
+        safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD();
     ~safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD();
     void initialize(const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD* in_struct, PNextCopyState* copy_state = {});
@@ -13602,6 +15152,10 @@ struct safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV {
         const safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& copy_src);
     safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& operator=(
         const safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV(
+        safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& operator=(
+        safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV();
     ~safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV();
     void initialize(const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -13624,6 +15178,10 @@ struct safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV {
         const safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& copy_src);
     safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& operator=(
         const safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV(
+        safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& operator=(
+        safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV();
     ~safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV();
     void initialize(const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -13648,6 +15206,10 @@ struct safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV {
         const safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV& copy_src);
     safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV& operator=(
         const safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV& copy_src);
+    safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV(
+        safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV&& move_src) noexcept;
+    safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV& operator=(
+        safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV&& move_src) noexcept;
     safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV();
     ~safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV();
     void initialize(const VkPipelineFragmentShadingRateEnumStateCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -13684,6 +15246,10 @@ struct safe_VkAccelerationStructureGeometryMotionTrianglesDataNV {
         const safe_VkAccelerationStructureGeometryMotionTrianglesDataNV& copy_src);
     safe_VkAccelerationStructureGeometryMotionTrianglesDataNV& operator=(
         const safe_VkAccelerationStructureGeometryMotionTrianglesDataNV& copy_src);
+    safe_VkAccelerationStructureGeometryMotionTrianglesDataNV(
+        safe_VkAccelerationStructureGeometryMotionTrianglesDataNV&& move_src) noexcept;
+    safe_VkAccelerationStructureGeometryMotionTrianglesDataNV& operator=(
+        safe_VkAccelerationStructureGeometryMotionTrianglesDataNV&& move_src) noexcept;
     safe_VkAccelerationStructureGeometryMotionTrianglesDataNV();
     ~safe_VkAccelerationStructureGeometryMotionTrianglesDataNV();
     void initialize(const VkAccelerationStructureGeometryMotionTrianglesDataNV* in_struct, PNextCopyState* copy_state = {});
@@ -13705,6 +15271,8 @@ struct safe_VkAccelerationStructureMotionInfoNV {
                                              bool copy_pnext = true);
     safe_VkAccelerationStructureMotionInfoNV(const safe_VkAccelerationStructureMotionInfoNV& copy_src);
     safe_VkAccelerationStructureMotionInfoNV& operator=(const safe_VkAccelerationStructureMotionInfoNV& copy_src);
+    safe_VkAccelerationStructureMotionInfoNV(safe_VkAccelerationStructureMotionInfoNV&& move_src) noexcept;
+    safe_VkAccelerationStructureMotionInfoNV& operator=(safe_VkAccelerationStructureMotionInfoNV&& move_src) noexcept;
     safe_VkAccelerationStructureMotionInfoNV();
     ~safe_VkAccelerationStructureMotionInfoNV();
     void initialize(const VkAccelerationStructureMotionInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -13725,6 +15293,9 @@ struct safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV {
     safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV(const safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& copy_src);
     safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& operator=(
         const safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV(safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& operator=(
+        safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV();
     ~safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV();
     void initialize(const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -13746,6 +15317,10 @@ struct safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT {
     safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT(const safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT(
+        safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT();
     ~safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT();
     void initialize(const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13767,6 +15342,9 @@ struct safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT {
     safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT(const safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& copy_src);
     safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& operator=(
         const safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT(safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& operator=(
+        safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT();
     ~safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT();
     void initialize(const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13791,6 +15369,10 @@ struct safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT {
     safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT(const safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& copy_src);
     safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& operator=(
         const safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT(
+        safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& operator=(
+        safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT();
     ~safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT();
     void initialize(const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13811,6 +15393,8 @@ struct safe_VkCopyCommandTransformInfoQCOM {
                                         bool copy_pnext = true);
     safe_VkCopyCommandTransformInfoQCOM(const safe_VkCopyCommandTransformInfoQCOM& copy_src);
     safe_VkCopyCommandTransformInfoQCOM& operator=(const safe_VkCopyCommandTransformInfoQCOM& copy_src);
+    safe_VkCopyCommandTransformInfoQCOM(safe_VkCopyCommandTransformInfoQCOM&& move_src) noexcept;
+    safe_VkCopyCommandTransformInfoQCOM& operator=(safe_VkCopyCommandTransformInfoQCOM&& move_src) noexcept;
     safe_VkCopyCommandTransformInfoQCOM();
     ~safe_VkCopyCommandTransformInfoQCOM();
     void initialize(const VkCopyCommandTransformInfoQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -13829,6 +15413,10 @@ struct safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT {
         const safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT(
+        safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT();
     ~safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT();
     void initialize(const VkPhysicalDeviceImageCompressionControlFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13851,6 +15439,8 @@ struct safe_VkImageCompressionControlEXT {
                                       bool copy_pnext = true);
     safe_VkImageCompressionControlEXT(const safe_VkImageCompressionControlEXT& copy_src);
     safe_VkImageCompressionControlEXT& operator=(const safe_VkImageCompressionControlEXT& copy_src);
+    safe_VkImageCompressionControlEXT(safe_VkImageCompressionControlEXT&& move_src) noexcept;
+    safe_VkImageCompressionControlEXT& operator=(safe_VkImageCompressionControlEXT&& move_src) noexcept;
     safe_VkImageCompressionControlEXT();
     ~safe_VkImageCompressionControlEXT();
     void initialize(const VkImageCompressionControlEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13868,6 +15458,8 @@ struct safe_VkImageCompressionPropertiesEXT {
                                          bool copy_pnext = true);
     safe_VkImageCompressionPropertiesEXT(const safe_VkImageCompressionPropertiesEXT& copy_src);
     safe_VkImageCompressionPropertiesEXT& operator=(const safe_VkImageCompressionPropertiesEXT& copy_src);
+    safe_VkImageCompressionPropertiesEXT(safe_VkImageCompressionPropertiesEXT&& move_src) noexcept;
+    safe_VkImageCompressionPropertiesEXT& operator=(safe_VkImageCompressionPropertiesEXT&& move_src) noexcept;
     safe_VkImageCompressionPropertiesEXT();
     ~safe_VkImageCompressionPropertiesEXT();
     void initialize(const VkImageCompressionPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13887,6 +15479,10 @@ struct safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT {
         const safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT(
+        safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT();
     ~safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT();
     void initialize(const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13908,6 +15504,8 @@ struct safe_VkPhysicalDevice4444FormatsFeaturesEXT {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDevice4444FormatsFeaturesEXT(const safe_VkPhysicalDevice4444FormatsFeaturesEXT& copy_src);
     safe_VkPhysicalDevice4444FormatsFeaturesEXT& operator=(const safe_VkPhysicalDevice4444FormatsFeaturesEXT& copy_src);
+    safe_VkPhysicalDevice4444FormatsFeaturesEXT(safe_VkPhysicalDevice4444FormatsFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDevice4444FormatsFeaturesEXT& operator=(safe_VkPhysicalDevice4444FormatsFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDevice4444FormatsFeaturesEXT();
     ~safe_VkPhysicalDevice4444FormatsFeaturesEXT();
     void initialize(const VkPhysicalDevice4444FormatsFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13927,6 +15525,8 @@ struct safe_VkPhysicalDeviceFaultFeaturesEXT {
                                           bool copy_pnext = true);
     safe_VkPhysicalDeviceFaultFeaturesEXT(const safe_VkPhysicalDeviceFaultFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceFaultFeaturesEXT& operator=(const safe_VkPhysicalDeviceFaultFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceFaultFeaturesEXT(safe_VkPhysicalDeviceFaultFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceFaultFeaturesEXT& operator=(safe_VkPhysicalDeviceFaultFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceFaultFeaturesEXT();
     ~safe_VkPhysicalDeviceFaultFeaturesEXT();
     void initialize(const VkPhysicalDeviceFaultFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13944,6 +15544,8 @@ struct safe_VkDeviceFaultCountsEXT {
     safe_VkDeviceFaultCountsEXT(const VkDeviceFaultCountsEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceFaultCountsEXT(const safe_VkDeviceFaultCountsEXT& copy_src);
     safe_VkDeviceFaultCountsEXT& operator=(const safe_VkDeviceFaultCountsEXT& copy_src);
+    safe_VkDeviceFaultCountsEXT(safe_VkDeviceFaultCountsEXT&& move_src) noexcept;
+    safe_VkDeviceFaultCountsEXT& operator=(safe_VkDeviceFaultCountsEXT&& move_src) noexcept;
     safe_VkDeviceFaultCountsEXT();
     ~safe_VkDeviceFaultCountsEXT();
     void initialize(const VkDeviceFaultCountsEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13962,6 +15564,8 @@ struct safe_VkDeviceFaultInfoEXT {
     safe_VkDeviceFaultInfoEXT(const VkDeviceFaultInfoEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceFaultInfoEXT(const safe_VkDeviceFaultInfoEXT& copy_src);
     safe_VkDeviceFaultInfoEXT& operator=(const safe_VkDeviceFaultInfoEXT& copy_src);
+    safe_VkDeviceFaultInfoEXT(safe_VkDeviceFaultInfoEXT&& move_src) noexcept;
+    safe_VkDeviceFaultInfoEXT& operator=(safe_VkDeviceFaultInfoEXT&& move_src) noexcept;
     safe_VkDeviceFaultInfoEXT();
     ~safe_VkDeviceFaultInfoEXT();
     void initialize(const VkDeviceFaultInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -13983,6 +15587,10 @@ struct safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT {
         const safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT(
+        safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT();
     ~safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT();
     void initialize(const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT* in_struct,
@@ -14005,6 +15613,8 @@ struct safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT(const safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& operator=(const safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT(safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& operator=(safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT();
     ~safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT();
     void initialize(const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14028,6 +15638,8 @@ struct safe_VkDirectFBSurfaceCreateInfoEXT {
                                         bool copy_pnext = true);
     safe_VkDirectFBSurfaceCreateInfoEXT(const safe_VkDirectFBSurfaceCreateInfoEXT& copy_src);
     safe_VkDirectFBSurfaceCreateInfoEXT& operator=(const safe_VkDirectFBSurfaceCreateInfoEXT& copy_src);
+    safe_VkDirectFBSurfaceCreateInfoEXT(safe_VkDirectFBSurfaceCreateInfoEXT&& move_src) noexcept;
+    safe_VkDirectFBSurfaceCreateInfoEXT& operator=(safe_VkDirectFBSurfaceCreateInfoEXT&& move_src) noexcept;
     safe_VkDirectFBSurfaceCreateInfoEXT();
     ~safe_VkDirectFBSurfaceCreateInfoEXT();
     void initialize(const VkDirectFBSurfaceCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14046,6 +15658,10 @@ struct safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT {
     safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT(const safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT(
+        safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT();
     ~safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT();
     void initialize(const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14064,6 +15680,8 @@ struct safe_VkMutableDescriptorTypeListEXT {
     safe_VkMutableDescriptorTypeListEXT(const VkMutableDescriptorTypeListEXT* in_struct, PNextCopyState* copy_state = {});
     safe_VkMutableDescriptorTypeListEXT(const safe_VkMutableDescriptorTypeListEXT& copy_src);
     safe_VkMutableDescriptorTypeListEXT& operator=(const safe_VkMutableDescriptorTypeListEXT& copy_src);
+    safe_VkMutableDescriptorTypeListEXT(safe_VkMutableDescriptorTypeListEXT&& move_src) noexcept;
+    safe_VkMutableDescriptorTypeListEXT& operator=(safe_VkMutableDescriptorTypeListEXT&& move_src) noexcept;
     safe_VkMutableDescriptorTypeListEXT();
     ~safe_VkMutableDescriptorTypeListEXT();
     void initialize(const VkMutableDescriptorTypeListEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14081,6 +15699,8 @@ struct safe_VkMutableDescriptorTypeCreateInfoEXT {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMutableDescriptorTypeCreateInfoEXT(const safe_VkMutableDescriptorTypeCreateInfoEXT& copy_src);
     safe_VkMutableDescriptorTypeCreateInfoEXT& operator=(const safe_VkMutableDescriptorTypeCreateInfoEXT& copy_src);
+    safe_VkMutableDescriptorTypeCreateInfoEXT(safe_VkMutableDescriptorTypeCreateInfoEXT&& move_src) noexcept;
+    safe_VkMutableDescriptorTypeCreateInfoEXT& operator=(safe_VkMutableDescriptorTypeCreateInfoEXT&& move_src) noexcept;
     safe_VkMutableDescriptorTypeCreateInfoEXT();
     ~safe_VkMutableDescriptorTypeCreateInfoEXT();
     void initialize(const VkMutableDescriptorTypeCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14101,6 +15721,10 @@ struct safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT {
         const safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT(
+        safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT();
     ~safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT();
     void initialize(const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14124,6 +15748,8 @@ struct safe_VkVertexInputBindingDescription2EXT {
                                              bool copy_pnext = true);
     safe_VkVertexInputBindingDescription2EXT(const safe_VkVertexInputBindingDescription2EXT& copy_src);
     safe_VkVertexInputBindingDescription2EXT& operator=(const safe_VkVertexInputBindingDescription2EXT& copy_src);
+    safe_VkVertexInputBindingDescription2EXT(safe_VkVertexInputBindingDescription2EXT&& move_src) noexcept;
+    safe_VkVertexInputBindingDescription2EXT& operator=(safe_VkVertexInputBindingDescription2EXT&& move_src) noexcept;
     safe_VkVertexInputBindingDescription2EXT();
     ~safe_VkVertexInputBindingDescription2EXT();
     void initialize(const VkVertexInputBindingDescription2EXT* in_struct, PNextCopyState* copy_state = {});
@@ -14145,6 +15771,8 @@ struct safe_VkVertexInputAttributeDescription2EXT {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkVertexInputAttributeDescription2EXT(const safe_VkVertexInputAttributeDescription2EXT& copy_src);
     safe_VkVertexInputAttributeDescription2EXT& operator=(const safe_VkVertexInputAttributeDescription2EXT& copy_src);
+    safe_VkVertexInputAttributeDescription2EXT(safe_VkVertexInputAttributeDescription2EXT&& move_src) noexcept;
+    safe_VkVertexInputAttributeDescription2EXT& operator=(safe_VkVertexInputAttributeDescription2EXT&& move_src) noexcept;
     safe_VkVertexInputAttributeDescription2EXT();
     ~safe_VkVertexInputAttributeDescription2EXT();
     void initialize(const VkVertexInputAttributeDescription2EXT* in_struct, PNextCopyState* copy_state = {});
@@ -14168,6 +15796,8 @@ struct safe_VkPhysicalDeviceDrmPropertiesEXT {
                                           bool copy_pnext = true);
     safe_VkPhysicalDeviceDrmPropertiesEXT(const safe_VkPhysicalDeviceDrmPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceDrmPropertiesEXT& operator=(const safe_VkPhysicalDeviceDrmPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceDrmPropertiesEXT(safe_VkPhysicalDeviceDrmPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceDrmPropertiesEXT& operator=(safe_VkPhysicalDeviceDrmPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceDrmPropertiesEXT();
     ~safe_VkPhysicalDeviceDrmPropertiesEXT();
     void initialize(const VkPhysicalDeviceDrmPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14185,6 +15815,9 @@ struct safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT {
     safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT(const safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT(safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT();
     ~safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT();
     void initialize(const VkPhysicalDeviceAddressBindingReportFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14208,6 +15841,8 @@ struct safe_VkDeviceAddressBindingCallbackDataEXT {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceAddressBindingCallbackDataEXT(const safe_VkDeviceAddressBindingCallbackDataEXT& copy_src);
     safe_VkDeviceAddressBindingCallbackDataEXT& operator=(const safe_VkDeviceAddressBindingCallbackDataEXT& copy_src);
+    safe_VkDeviceAddressBindingCallbackDataEXT(safe_VkDeviceAddressBindingCallbackDataEXT&& move_src) noexcept;
+    safe_VkDeviceAddressBindingCallbackDataEXT& operator=(safe_VkDeviceAddressBindingCallbackDataEXT&& move_src) noexcept;
     safe_VkDeviceAddressBindingCallbackDataEXT();
     ~safe_VkDeviceAddressBindingCallbackDataEXT();
     void initialize(const VkDeviceAddressBindingCallbackDataEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14226,6 +15861,9 @@ struct safe_VkPhysicalDeviceDepthClipControlFeaturesEXT {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceDepthClipControlFeaturesEXT(const safe_VkPhysicalDeviceDepthClipControlFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceDepthClipControlFeaturesEXT& operator=(const safe_VkPhysicalDeviceDepthClipControlFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceDepthClipControlFeaturesEXT(safe_VkPhysicalDeviceDepthClipControlFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceDepthClipControlFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceDepthClipControlFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceDepthClipControlFeaturesEXT();
     ~safe_VkPhysicalDeviceDepthClipControlFeaturesEXT();
     void initialize(const VkPhysicalDeviceDepthClipControlFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14247,6 +15885,9 @@ struct safe_VkPipelineViewportDepthClipControlCreateInfoEXT {
     safe_VkPipelineViewportDepthClipControlCreateInfoEXT(const safe_VkPipelineViewportDepthClipControlCreateInfoEXT& copy_src);
     safe_VkPipelineViewportDepthClipControlCreateInfoEXT& operator=(
         const safe_VkPipelineViewportDepthClipControlCreateInfoEXT& copy_src);
+    safe_VkPipelineViewportDepthClipControlCreateInfoEXT(safe_VkPipelineViewportDepthClipControlCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineViewportDepthClipControlCreateInfoEXT& operator=(
+        safe_VkPipelineViewportDepthClipControlCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineViewportDepthClipControlCreateInfoEXT();
     ~safe_VkPipelineViewportDepthClipControlCreateInfoEXT();
     void initialize(const VkPipelineViewportDepthClipControlCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14271,6 +15912,10 @@ struct safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT {
         const safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& copy_src);
     safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& operator=(
         const safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& copy_src);
+    safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT(
+        safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& operator=(
+        safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT();
     ~safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT();
     void initialize(const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14293,6 +15938,8 @@ struct safe_VkImportMemoryZirconHandleInfoFUCHSIA {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImportMemoryZirconHandleInfoFUCHSIA(const safe_VkImportMemoryZirconHandleInfoFUCHSIA& copy_src);
     safe_VkImportMemoryZirconHandleInfoFUCHSIA& operator=(const safe_VkImportMemoryZirconHandleInfoFUCHSIA& copy_src);
+    safe_VkImportMemoryZirconHandleInfoFUCHSIA(safe_VkImportMemoryZirconHandleInfoFUCHSIA&& move_src) noexcept;
+    safe_VkImportMemoryZirconHandleInfoFUCHSIA& operator=(safe_VkImportMemoryZirconHandleInfoFUCHSIA&& move_src) noexcept;
     safe_VkImportMemoryZirconHandleInfoFUCHSIA();
     ~safe_VkImportMemoryZirconHandleInfoFUCHSIA();
     void initialize(const VkImportMemoryZirconHandleInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14311,6 +15958,8 @@ struct safe_VkMemoryZirconHandlePropertiesFUCHSIA {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMemoryZirconHandlePropertiesFUCHSIA(const safe_VkMemoryZirconHandlePropertiesFUCHSIA& copy_src);
     safe_VkMemoryZirconHandlePropertiesFUCHSIA& operator=(const safe_VkMemoryZirconHandlePropertiesFUCHSIA& copy_src);
+    safe_VkMemoryZirconHandlePropertiesFUCHSIA(safe_VkMemoryZirconHandlePropertiesFUCHSIA&& move_src) noexcept;
+    safe_VkMemoryZirconHandlePropertiesFUCHSIA& operator=(safe_VkMemoryZirconHandlePropertiesFUCHSIA&& move_src) noexcept;
     safe_VkMemoryZirconHandlePropertiesFUCHSIA();
     ~safe_VkMemoryZirconHandlePropertiesFUCHSIA();
     void initialize(const VkMemoryZirconHandlePropertiesFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14330,6 +15979,8 @@ struct safe_VkMemoryGetZirconHandleInfoFUCHSIA {
                                             bool copy_pnext = true);
     safe_VkMemoryGetZirconHandleInfoFUCHSIA(const safe_VkMemoryGetZirconHandleInfoFUCHSIA& copy_src);
     safe_VkMemoryGetZirconHandleInfoFUCHSIA& operator=(const safe_VkMemoryGetZirconHandleInfoFUCHSIA& copy_src);
+    safe_VkMemoryGetZirconHandleInfoFUCHSIA(safe_VkMemoryGetZirconHandleInfoFUCHSIA&& move_src) noexcept;
+    safe_VkMemoryGetZirconHandleInfoFUCHSIA& operator=(safe_VkMemoryGetZirconHandleInfoFUCHSIA&& move_src) noexcept;
     safe_VkMemoryGetZirconHandleInfoFUCHSIA();
     ~safe_VkMemoryGetZirconHandleInfoFUCHSIA();
     void initialize(const VkMemoryGetZirconHandleInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14351,6 +16002,8 @@ struct safe_VkImportSemaphoreZirconHandleInfoFUCHSIA {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImportSemaphoreZirconHandleInfoFUCHSIA(const safe_VkImportSemaphoreZirconHandleInfoFUCHSIA& copy_src);
     safe_VkImportSemaphoreZirconHandleInfoFUCHSIA& operator=(const safe_VkImportSemaphoreZirconHandleInfoFUCHSIA& copy_src);
+    safe_VkImportSemaphoreZirconHandleInfoFUCHSIA(safe_VkImportSemaphoreZirconHandleInfoFUCHSIA&& move_src) noexcept;
+    safe_VkImportSemaphoreZirconHandleInfoFUCHSIA& operator=(safe_VkImportSemaphoreZirconHandleInfoFUCHSIA&& move_src) noexcept;
     safe_VkImportSemaphoreZirconHandleInfoFUCHSIA();
     ~safe_VkImportSemaphoreZirconHandleInfoFUCHSIA();
     void initialize(const VkImportSemaphoreZirconHandleInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14370,6 +16023,8 @@ struct safe_VkSemaphoreGetZirconHandleInfoFUCHSIA {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSemaphoreGetZirconHandleInfoFUCHSIA(const safe_VkSemaphoreGetZirconHandleInfoFUCHSIA& copy_src);
     safe_VkSemaphoreGetZirconHandleInfoFUCHSIA& operator=(const safe_VkSemaphoreGetZirconHandleInfoFUCHSIA& copy_src);
+    safe_VkSemaphoreGetZirconHandleInfoFUCHSIA(safe_VkSemaphoreGetZirconHandleInfoFUCHSIA&& move_src) noexcept;
+    safe_VkSemaphoreGetZirconHandleInfoFUCHSIA& operator=(safe_VkSemaphoreGetZirconHandleInfoFUCHSIA&& move_src) noexcept;
     safe_VkSemaphoreGetZirconHandleInfoFUCHSIA();
     ~safe_VkSemaphoreGetZirconHandleInfoFUCHSIA();
     void initialize(const VkSemaphoreGetZirconHandleInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14388,6 +16043,8 @@ struct safe_VkBufferCollectionCreateInfoFUCHSIA {
                                              bool copy_pnext = true);
     safe_VkBufferCollectionCreateInfoFUCHSIA(const safe_VkBufferCollectionCreateInfoFUCHSIA& copy_src);
     safe_VkBufferCollectionCreateInfoFUCHSIA& operator=(const safe_VkBufferCollectionCreateInfoFUCHSIA& copy_src);
+    safe_VkBufferCollectionCreateInfoFUCHSIA(safe_VkBufferCollectionCreateInfoFUCHSIA&& move_src) noexcept;
+    safe_VkBufferCollectionCreateInfoFUCHSIA& operator=(safe_VkBufferCollectionCreateInfoFUCHSIA&& move_src) noexcept;
     safe_VkBufferCollectionCreateInfoFUCHSIA();
     ~safe_VkBufferCollectionCreateInfoFUCHSIA();
     void initialize(const VkBufferCollectionCreateInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14407,6 +16064,8 @@ struct safe_VkImportMemoryBufferCollectionFUCHSIA {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImportMemoryBufferCollectionFUCHSIA(const safe_VkImportMemoryBufferCollectionFUCHSIA& copy_src);
     safe_VkImportMemoryBufferCollectionFUCHSIA& operator=(const safe_VkImportMemoryBufferCollectionFUCHSIA& copy_src);
+    safe_VkImportMemoryBufferCollectionFUCHSIA(safe_VkImportMemoryBufferCollectionFUCHSIA&& move_src) noexcept;
+    safe_VkImportMemoryBufferCollectionFUCHSIA& operator=(safe_VkImportMemoryBufferCollectionFUCHSIA&& move_src) noexcept;
     safe_VkImportMemoryBufferCollectionFUCHSIA();
     ~safe_VkImportMemoryBufferCollectionFUCHSIA();
     void initialize(const VkImportMemoryBufferCollectionFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14426,6 +16085,8 @@ struct safe_VkBufferCollectionImageCreateInfoFUCHSIA {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBufferCollectionImageCreateInfoFUCHSIA(const safe_VkBufferCollectionImageCreateInfoFUCHSIA& copy_src);
     safe_VkBufferCollectionImageCreateInfoFUCHSIA& operator=(const safe_VkBufferCollectionImageCreateInfoFUCHSIA& copy_src);
+    safe_VkBufferCollectionImageCreateInfoFUCHSIA(safe_VkBufferCollectionImageCreateInfoFUCHSIA&& move_src) noexcept;
+    safe_VkBufferCollectionImageCreateInfoFUCHSIA& operator=(safe_VkBufferCollectionImageCreateInfoFUCHSIA&& move_src) noexcept;
     safe_VkBufferCollectionImageCreateInfoFUCHSIA();
     ~safe_VkBufferCollectionImageCreateInfoFUCHSIA();
     void initialize(const VkBufferCollectionImageCreateInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14448,6 +16109,8 @@ struct safe_VkBufferCollectionConstraintsInfoFUCHSIA {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBufferCollectionConstraintsInfoFUCHSIA(const safe_VkBufferCollectionConstraintsInfoFUCHSIA& copy_src);
     safe_VkBufferCollectionConstraintsInfoFUCHSIA& operator=(const safe_VkBufferCollectionConstraintsInfoFUCHSIA& copy_src);
+    safe_VkBufferCollectionConstraintsInfoFUCHSIA(safe_VkBufferCollectionConstraintsInfoFUCHSIA&& move_src) noexcept;
+    safe_VkBufferCollectionConstraintsInfoFUCHSIA& operator=(safe_VkBufferCollectionConstraintsInfoFUCHSIA&& move_src) noexcept;
     safe_VkBufferCollectionConstraintsInfoFUCHSIA();
     ~safe_VkBufferCollectionConstraintsInfoFUCHSIA();
     void initialize(const VkBufferCollectionConstraintsInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14468,6 +16131,8 @@ struct safe_VkBufferConstraintsInfoFUCHSIA {
                                         bool copy_pnext = true);
     safe_VkBufferConstraintsInfoFUCHSIA(const safe_VkBufferConstraintsInfoFUCHSIA& copy_src);
     safe_VkBufferConstraintsInfoFUCHSIA& operator=(const safe_VkBufferConstraintsInfoFUCHSIA& copy_src);
+    safe_VkBufferConstraintsInfoFUCHSIA(safe_VkBufferConstraintsInfoFUCHSIA&& move_src) noexcept;
+    safe_VkBufferConstraintsInfoFUCHSIA& operator=(safe_VkBufferConstraintsInfoFUCHSIA&& move_src) noexcept;
     safe_VkBufferConstraintsInfoFUCHSIA();
     ~safe_VkBufferConstraintsInfoFUCHSIA();
     void initialize(const VkBufferConstraintsInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14485,6 +16150,8 @@ struct safe_VkBufferCollectionBufferCreateInfoFUCHSIA {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkBufferCollectionBufferCreateInfoFUCHSIA(const safe_VkBufferCollectionBufferCreateInfoFUCHSIA& copy_src);
     safe_VkBufferCollectionBufferCreateInfoFUCHSIA& operator=(const safe_VkBufferCollectionBufferCreateInfoFUCHSIA& copy_src);
+    safe_VkBufferCollectionBufferCreateInfoFUCHSIA(safe_VkBufferCollectionBufferCreateInfoFUCHSIA&& move_src) noexcept;
+    safe_VkBufferCollectionBufferCreateInfoFUCHSIA& operator=(safe_VkBufferCollectionBufferCreateInfoFUCHSIA&& move_src) noexcept;
     safe_VkBufferCollectionBufferCreateInfoFUCHSIA();
     ~safe_VkBufferCollectionBufferCreateInfoFUCHSIA();
     void initialize(const VkBufferCollectionBufferCreateInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14503,6 +16170,8 @@ struct safe_VkSysmemColorSpaceFUCHSIA {
                                    bool copy_pnext = true);
     safe_VkSysmemColorSpaceFUCHSIA(const safe_VkSysmemColorSpaceFUCHSIA& copy_src);
     safe_VkSysmemColorSpaceFUCHSIA& operator=(const safe_VkSysmemColorSpaceFUCHSIA& copy_src);
+    safe_VkSysmemColorSpaceFUCHSIA(safe_VkSysmemColorSpaceFUCHSIA&& move_src) noexcept;
+    safe_VkSysmemColorSpaceFUCHSIA& operator=(safe_VkSysmemColorSpaceFUCHSIA&& move_src) noexcept;
     safe_VkSysmemColorSpaceFUCHSIA();
     ~safe_VkSysmemColorSpaceFUCHSIA();
     void initialize(const VkSysmemColorSpaceFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14529,6 +16198,8 @@ struct safe_VkBufferCollectionPropertiesFUCHSIA {
                                              bool copy_pnext = true);
     safe_VkBufferCollectionPropertiesFUCHSIA(const safe_VkBufferCollectionPropertiesFUCHSIA& copy_src);
     safe_VkBufferCollectionPropertiesFUCHSIA& operator=(const safe_VkBufferCollectionPropertiesFUCHSIA& copy_src);
+    safe_VkBufferCollectionPropertiesFUCHSIA(safe_VkBufferCollectionPropertiesFUCHSIA&& move_src) noexcept;
+    safe_VkBufferCollectionPropertiesFUCHSIA& operator=(safe_VkBufferCollectionPropertiesFUCHSIA&& move_src) noexcept;
     safe_VkBufferCollectionPropertiesFUCHSIA();
     ~safe_VkBufferCollectionPropertiesFUCHSIA();
     void initialize(const VkBufferCollectionPropertiesFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14552,6 +16223,8 @@ struct safe_VkImageFormatConstraintsInfoFUCHSIA {
                                              bool copy_pnext = true);
     safe_VkImageFormatConstraintsInfoFUCHSIA(const safe_VkImageFormatConstraintsInfoFUCHSIA& copy_src);
     safe_VkImageFormatConstraintsInfoFUCHSIA& operator=(const safe_VkImageFormatConstraintsInfoFUCHSIA& copy_src);
+    safe_VkImageFormatConstraintsInfoFUCHSIA(safe_VkImageFormatConstraintsInfoFUCHSIA&& move_src) noexcept;
+    safe_VkImageFormatConstraintsInfoFUCHSIA& operator=(safe_VkImageFormatConstraintsInfoFUCHSIA&& move_src) noexcept;
     safe_VkImageFormatConstraintsInfoFUCHSIA();
     ~safe_VkImageFormatConstraintsInfoFUCHSIA();
     void initialize(const VkImageFormatConstraintsInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14573,6 +16246,8 @@ struct safe_VkImageConstraintsInfoFUCHSIA {
                                        bool copy_pnext = true);
     safe_VkImageConstraintsInfoFUCHSIA(const safe_VkImageConstraintsInfoFUCHSIA& copy_src);
     safe_VkImageConstraintsInfoFUCHSIA& operator=(const safe_VkImageConstraintsInfoFUCHSIA& copy_src);
+    safe_VkImageConstraintsInfoFUCHSIA(safe_VkImageConstraintsInfoFUCHSIA&& move_src) noexcept;
+    safe_VkImageConstraintsInfoFUCHSIA& operator=(safe_VkImageConstraintsInfoFUCHSIA&& move_src) noexcept;
     safe_VkImageConstraintsInfoFUCHSIA();
     ~safe_VkImageConstraintsInfoFUCHSIA();
     void initialize(const VkImageConstraintsInfoFUCHSIA* in_struct, PNextCopyState* copy_state = {});
@@ -14591,6 +16266,8 @@ struct safe_VkSubpassShadingPipelineCreateInfoHUAWEI {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSubpassShadingPipelineCreateInfoHUAWEI(const safe_VkSubpassShadingPipelineCreateInfoHUAWEI& copy_src);
     safe_VkSubpassShadingPipelineCreateInfoHUAWEI& operator=(const safe_VkSubpassShadingPipelineCreateInfoHUAWEI& copy_src);
+    safe_VkSubpassShadingPipelineCreateInfoHUAWEI(safe_VkSubpassShadingPipelineCreateInfoHUAWEI&& move_src) noexcept;
+    safe_VkSubpassShadingPipelineCreateInfoHUAWEI& operator=(safe_VkSubpassShadingPipelineCreateInfoHUAWEI&& move_src) noexcept;
     safe_VkSubpassShadingPipelineCreateInfoHUAWEI();
     ~safe_VkSubpassShadingPipelineCreateInfoHUAWEI();
     void initialize(const VkSubpassShadingPipelineCreateInfoHUAWEI* in_struct, PNextCopyState* copy_state = {});
@@ -14609,6 +16286,9 @@ struct safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI(const safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& copy_src);
     safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& operator=(const safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& copy_src);
+    safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI(safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI&& move_src) noexcept;
+    safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& operator=(
+        safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI&& move_src) noexcept;
     safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI();
     ~safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI();
     void initialize(const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI* in_struct, PNextCopyState* copy_state = {});
@@ -14630,6 +16310,9 @@ struct safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI {
     safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI(const safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& copy_src);
     safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& operator=(
         const safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& copy_src);
+    safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI(safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI&& move_src) noexcept;
+    safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& operator=(
+        safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI&& move_src) noexcept;
     safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI();
     ~safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI();
     void initialize(const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI* in_struct, PNextCopyState* copy_state = {});
@@ -14650,6 +16333,9 @@ struct safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI(const safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& copy_src);
     safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& operator=(const safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& copy_src);
+    safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI(safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI&& move_src) noexcept;
+    safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& operator=(
+        safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI&& move_src) noexcept;
     safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI();
     ~safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI();
     void initialize(const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI* in_struct, PNextCopyState* copy_state = {});
@@ -14671,6 +16357,8 @@ struct safe_VkMemoryGetRemoteAddressInfoNV {
                                         bool copy_pnext = true);
     safe_VkMemoryGetRemoteAddressInfoNV(const safe_VkMemoryGetRemoteAddressInfoNV& copy_src);
     safe_VkMemoryGetRemoteAddressInfoNV& operator=(const safe_VkMemoryGetRemoteAddressInfoNV& copy_src);
+    safe_VkMemoryGetRemoteAddressInfoNV(safe_VkMemoryGetRemoteAddressInfoNV&& move_src) noexcept;
+    safe_VkMemoryGetRemoteAddressInfoNV& operator=(safe_VkMemoryGetRemoteAddressInfoNV&& move_src) noexcept;
     safe_VkMemoryGetRemoteAddressInfoNV();
     ~safe_VkMemoryGetRemoteAddressInfoNV();
     void initialize(const VkMemoryGetRemoteAddressInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -14687,6 +16375,9 @@ struct safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV(const safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& copy_src);
     safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& operator=(const safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV(safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& operator=(
+        safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV();
     ~safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV();
     void initialize(const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -14707,6 +16398,8 @@ struct safe_VkPipelinePropertiesIdentifierEXT {
                                            bool copy_pnext = true);
     safe_VkPipelinePropertiesIdentifierEXT(const safe_VkPipelinePropertiesIdentifierEXT& copy_src);
     safe_VkPipelinePropertiesIdentifierEXT& operator=(const safe_VkPipelinePropertiesIdentifierEXT& copy_src);
+    safe_VkPipelinePropertiesIdentifierEXT(safe_VkPipelinePropertiesIdentifierEXT&& move_src) noexcept;
+    safe_VkPipelinePropertiesIdentifierEXT& operator=(safe_VkPipelinePropertiesIdentifierEXT&& move_src) noexcept;
     safe_VkPipelinePropertiesIdentifierEXT();
     ~safe_VkPipelinePropertiesIdentifierEXT();
     void initialize(const VkPipelinePropertiesIdentifierEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14726,6 +16419,9 @@ struct safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT {
     safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT(const safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT& copy_src);
     safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT& operator=(
         const safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT& copy_src);
+    safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT(safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT& operator=(
+        safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT();
     ~safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT();
     void initialize(const VkPhysicalDevicePipelinePropertiesFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14746,6 +16442,8 @@ struct safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT(const safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT& operator=(const safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT(safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT& operator=(safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT();
     ~safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT();
     void initialize(const VkPhysicalDeviceFrameBoundaryFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14771,6 +16469,8 @@ struct safe_VkFrameBoundaryEXT {
     safe_VkFrameBoundaryEXT(const VkFrameBoundaryEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkFrameBoundaryEXT(const safe_VkFrameBoundaryEXT& copy_src);
     safe_VkFrameBoundaryEXT& operator=(const safe_VkFrameBoundaryEXT& copy_src);
+    safe_VkFrameBoundaryEXT(safe_VkFrameBoundaryEXT&& move_src) noexcept;
+    safe_VkFrameBoundaryEXT& operator=(safe_VkFrameBoundaryEXT&& move_src) noexcept;
     safe_VkFrameBoundaryEXT();
     ~safe_VkFrameBoundaryEXT();
     void initialize(const VkFrameBoundaryEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14790,6 +16490,10 @@ struct safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT {
         const safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT(
+        safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT();
     ~safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT();
     void initialize(const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14811,6 +16515,8 @@ struct safe_VkSubpassResolvePerformanceQueryEXT {
                                              bool copy_pnext = true);
     safe_VkSubpassResolvePerformanceQueryEXT(const safe_VkSubpassResolvePerformanceQueryEXT& copy_src);
     safe_VkSubpassResolvePerformanceQueryEXT& operator=(const safe_VkSubpassResolvePerformanceQueryEXT& copy_src);
+    safe_VkSubpassResolvePerformanceQueryEXT(safe_VkSubpassResolvePerformanceQueryEXT&& move_src) noexcept;
+    safe_VkSubpassResolvePerformanceQueryEXT& operator=(safe_VkSubpassResolvePerformanceQueryEXT&& move_src) noexcept;
     safe_VkSubpassResolvePerformanceQueryEXT();
     ~safe_VkSubpassResolvePerformanceQueryEXT();
     void initialize(const VkSubpassResolvePerformanceQueryEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14830,6 +16536,8 @@ struct safe_VkMultisampledRenderToSingleSampledInfoEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMultisampledRenderToSingleSampledInfoEXT(const safe_VkMultisampledRenderToSingleSampledInfoEXT& copy_src);
     safe_VkMultisampledRenderToSingleSampledInfoEXT& operator=(const safe_VkMultisampledRenderToSingleSampledInfoEXT& copy_src);
+    safe_VkMultisampledRenderToSingleSampledInfoEXT(safe_VkMultisampledRenderToSingleSampledInfoEXT&& move_src) noexcept;
+    safe_VkMultisampledRenderToSingleSampledInfoEXT& operator=(safe_VkMultisampledRenderToSingleSampledInfoEXT&& move_src) noexcept;
     safe_VkMultisampledRenderToSingleSampledInfoEXT();
     ~safe_VkMultisampledRenderToSingleSampledInfoEXT();
     void initialize(const VkMultisampledRenderToSingleSampledInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14853,6 +16561,10 @@ struct safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT {
     safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT(const safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& copy_src);
     safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& operator=(
         const safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT(
+        safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& operator=(
+        safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT();
     ~safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT();
     void initialize(const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14876,6 +16588,8 @@ struct safe_VkScreenSurfaceCreateInfoQNX {
                                       bool copy_pnext = true);
     safe_VkScreenSurfaceCreateInfoQNX(const safe_VkScreenSurfaceCreateInfoQNX& copy_src);
     safe_VkScreenSurfaceCreateInfoQNX& operator=(const safe_VkScreenSurfaceCreateInfoQNX& copy_src);
+    safe_VkScreenSurfaceCreateInfoQNX(safe_VkScreenSurfaceCreateInfoQNX&& move_src) noexcept;
+    safe_VkScreenSurfaceCreateInfoQNX& operator=(safe_VkScreenSurfaceCreateInfoQNX&& move_src) noexcept;
     safe_VkScreenSurfaceCreateInfoQNX();
     ~safe_VkScreenSurfaceCreateInfoQNX();
     void initialize(const VkScreenSurfaceCreateInfoQNX* in_struct, PNextCopyState* copy_state = {});
@@ -14893,6 +16607,9 @@ struct safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT(const safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT& operator=(const safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT(safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT();
     ~safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT();
     void initialize(const VkPhysicalDeviceColorWriteEnableFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14914,6 +16631,8 @@ struct safe_VkPipelineColorWriteCreateInfoEXT {
                                            bool copy_pnext = true);
     safe_VkPipelineColorWriteCreateInfoEXT(const safe_VkPipelineColorWriteCreateInfoEXT& copy_src);
     safe_VkPipelineColorWriteCreateInfoEXT& operator=(const safe_VkPipelineColorWriteCreateInfoEXT& copy_src);
+    safe_VkPipelineColorWriteCreateInfoEXT(safe_VkPipelineColorWriteCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineColorWriteCreateInfoEXT& operator=(safe_VkPipelineColorWriteCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineColorWriteCreateInfoEXT();
     ~safe_VkPipelineColorWriteCreateInfoEXT();
     void initialize(const VkPipelineColorWriteCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14936,6 +16655,10 @@ struct safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT {
         const safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& copy_src);
     safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& operator=(
         const safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& copy_src);
+    safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT(
+        safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& operator=(
+        safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT();
     ~safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT();
     void initialize(const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14956,6 +16679,8 @@ struct safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT(const safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT& operator=(const safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT(safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT& operator=(safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT();
     ~safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT();
     void initialize(const VkPhysicalDeviceImageViewMinLodFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14976,6 +16701,8 @@ struct safe_VkImageViewMinLodCreateInfoEXT {
                                         bool copy_pnext = true);
     safe_VkImageViewMinLodCreateInfoEXT(const safe_VkImageViewMinLodCreateInfoEXT& copy_src);
     safe_VkImageViewMinLodCreateInfoEXT& operator=(const safe_VkImageViewMinLodCreateInfoEXT& copy_src);
+    safe_VkImageViewMinLodCreateInfoEXT(safe_VkImageViewMinLodCreateInfoEXT&& move_src) noexcept;
+    safe_VkImageViewMinLodCreateInfoEXT& operator=(safe_VkImageViewMinLodCreateInfoEXT&& move_src) noexcept;
     safe_VkImageViewMinLodCreateInfoEXT();
     ~safe_VkImageViewMinLodCreateInfoEXT();
     void initialize(const VkImageViewMinLodCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -14992,6 +16719,8 @@ struct safe_VkPhysicalDeviceMultiDrawFeaturesEXT {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMultiDrawFeaturesEXT(const safe_VkPhysicalDeviceMultiDrawFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceMultiDrawFeaturesEXT& operator=(const safe_VkPhysicalDeviceMultiDrawFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceMultiDrawFeaturesEXT(safe_VkPhysicalDeviceMultiDrawFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceMultiDrawFeaturesEXT& operator=(safe_VkPhysicalDeviceMultiDrawFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceMultiDrawFeaturesEXT();
     ~safe_VkPhysicalDeviceMultiDrawFeaturesEXT();
     void initialize(const VkPhysicalDeviceMultiDrawFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15010,6 +16739,8 @@ struct safe_VkPhysicalDeviceMultiDrawPropertiesEXT {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMultiDrawPropertiesEXT(const safe_VkPhysicalDeviceMultiDrawPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceMultiDrawPropertiesEXT& operator=(const safe_VkPhysicalDeviceMultiDrawPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceMultiDrawPropertiesEXT(safe_VkPhysicalDeviceMultiDrawPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceMultiDrawPropertiesEXT& operator=(safe_VkPhysicalDeviceMultiDrawPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceMultiDrawPropertiesEXT();
     ~safe_VkPhysicalDeviceMultiDrawPropertiesEXT();
     void initialize(const VkPhysicalDeviceMultiDrawPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15029,6 +16760,8 @@ struct safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT(const safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& operator=(const safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT(safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& operator=(safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT();
     ~safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT();
     void initialize(const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15051,6 +16784,8 @@ struct safe_VkPhysicalDeviceShaderTileImageFeaturesEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderTileImageFeaturesEXT(const safe_VkPhysicalDeviceShaderTileImageFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceShaderTileImageFeaturesEXT& operator=(const safe_VkPhysicalDeviceShaderTileImageFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceShaderTileImageFeaturesEXT(safe_VkPhysicalDeviceShaderTileImageFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderTileImageFeaturesEXT& operator=(safe_VkPhysicalDeviceShaderTileImageFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderTileImageFeaturesEXT();
     ~safe_VkPhysicalDeviceShaderTileImageFeaturesEXT();
     void initialize(const VkPhysicalDeviceShaderTileImageFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15073,6 +16808,9 @@ struct safe_VkPhysicalDeviceShaderTileImagePropertiesEXT {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderTileImagePropertiesEXT(const safe_VkPhysicalDeviceShaderTileImagePropertiesEXT& copy_src);
     safe_VkPhysicalDeviceShaderTileImagePropertiesEXT& operator=(const safe_VkPhysicalDeviceShaderTileImagePropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceShaderTileImagePropertiesEXT(safe_VkPhysicalDeviceShaderTileImagePropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderTileImagePropertiesEXT& operator=(
+        safe_VkPhysicalDeviceShaderTileImagePropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderTileImagePropertiesEXT();
     ~safe_VkPhysicalDeviceShaderTileImagePropertiesEXT();
     void initialize(const VkPhysicalDeviceShaderTileImagePropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15116,6 +16854,8 @@ struct safe_VkMicromapBuildInfoEXT {
     safe_VkMicromapBuildInfoEXT(const VkMicromapBuildInfoEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMicromapBuildInfoEXT(const safe_VkMicromapBuildInfoEXT& copy_src);
     safe_VkMicromapBuildInfoEXT& operator=(const safe_VkMicromapBuildInfoEXT& copy_src);
+    safe_VkMicromapBuildInfoEXT(safe_VkMicromapBuildInfoEXT&& move_src) noexcept;
+    safe_VkMicromapBuildInfoEXT& operator=(safe_VkMicromapBuildInfoEXT&& move_src) noexcept;
     safe_VkMicromapBuildInfoEXT();
     ~safe_VkMicromapBuildInfoEXT();
     void initialize(const VkMicromapBuildInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15136,6 +16876,8 @@ struct safe_VkMicromapCreateInfoEXT {
     safe_VkMicromapCreateInfoEXT(const VkMicromapCreateInfoEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkMicromapCreateInfoEXT(const safe_VkMicromapCreateInfoEXT& copy_src);
     safe_VkMicromapCreateInfoEXT& operator=(const safe_VkMicromapCreateInfoEXT& copy_src);
+    safe_VkMicromapCreateInfoEXT(safe_VkMicromapCreateInfoEXT&& move_src) noexcept;
+    safe_VkMicromapCreateInfoEXT& operator=(safe_VkMicromapCreateInfoEXT&& move_src) noexcept;
     safe_VkMicromapCreateInfoEXT();
     ~safe_VkMicromapCreateInfoEXT();
     void initialize(const VkMicromapCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15154,6 +16896,8 @@ struct safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT(const safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT& operator=(const safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT(safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT& operator=(safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT();
     ~safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT();
     void initialize(const VkPhysicalDeviceOpacityMicromapFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15175,6 +16919,9 @@ struct safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT(const safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT& operator=(const safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT(safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT();
     ~safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT();
     void initialize(const VkPhysicalDeviceOpacityMicromapPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15195,6 +16942,8 @@ struct safe_VkMicromapVersionInfoEXT {
                                   bool copy_pnext = true);
     safe_VkMicromapVersionInfoEXT(const safe_VkMicromapVersionInfoEXT& copy_src);
     safe_VkMicromapVersionInfoEXT& operator=(const safe_VkMicromapVersionInfoEXT& copy_src);
+    safe_VkMicromapVersionInfoEXT(safe_VkMicromapVersionInfoEXT&& move_src) noexcept;
+    safe_VkMicromapVersionInfoEXT& operator=(safe_VkMicromapVersionInfoEXT&& move_src) noexcept;
     safe_VkMicromapVersionInfoEXT();
     ~safe_VkMicromapVersionInfoEXT();
     void initialize(const VkMicromapVersionInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15213,6 +16962,8 @@ struct safe_VkCopyMicromapToMemoryInfoEXT {
                                        bool copy_pnext = true);
     safe_VkCopyMicromapToMemoryInfoEXT(const safe_VkCopyMicromapToMemoryInfoEXT& copy_src);
     safe_VkCopyMicromapToMemoryInfoEXT& operator=(const safe_VkCopyMicromapToMemoryInfoEXT& copy_src);
+    safe_VkCopyMicromapToMemoryInfoEXT(safe_VkCopyMicromapToMemoryInfoEXT&& move_src) noexcept;
+    safe_VkCopyMicromapToMemoryInfoEXT& operator=(safe_VkCopyMicromapToMemoryInfoEXT&& move_src) noexcept;
     safe_VkCopyMicromapToMemoryInfoEXT();
     ~safe_VkCopyMicromapToMemoryInfoEXT();
     void initialize(const VkCopyMicromapToMemoryInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15231,6 +16982,8 @@ struct safe_VkCopyMemoryToMicromapInfoEXT {
                                        bool copy_pnext = true);
     safe_VkCopyMemoryToMicromapInfoEXT(const safe_VkCopyMemoryToMicromapInfoEXT& copy_src);
     safe_VkCopyMemoryToMicromapInfoEXT& operator=(const safe_VkCopyMemoryToMicromapInfoEXT& copy_src);
+    safe_VkCopyMemoryToMicromapInfoEXT(safe_VkCopyMemoryToMicromapInfoEXT&& move_src) noexcept;
+    safe_VkCopyMemoryToMicromapInfoEXT& operator=(safe_VkCopyMemoryToMicromapInfoEXT&& move_src) noexcept;
     safe_VkCopyMemoryToMicromapInfoEXT();
     ~safe_VkCopyMemoryToMicromapInfoEXT();
     void initialize(const VkCopyMemoryToMicromapInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15248,6 +17001,8 @@ struct safe_VkCopyMicromapInfoEXT {
     safe_VkCopyMicromapInfoEXT(const VkCopyMicromapInfoEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCopyMicromapInfoEXT(const safe_VkCopyMicromapInfoEXT& copy_src);
     safe_VkCopyMicromapInfoEXT& operator=(const safe_VkCopyMicromapInfoEXT& copy_src);
+    safe_VkCopyMicromapInfoEXT(safe_VkCopyMicromapInfoEXT&& move_src) noexcept;
+    safe_VkCopyMicromapInfoEXT& operator=(safe_VkCopyMicromapInfoEXT&& move_src) noexcept;
     safe_VkCopyMicromapInfoEXT();
     ~safe_VkCopyMicromapInfoEXT();
     void initialize(const VkCopyMicromapInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15266,6 +17021,8 @@ struct safe_VkMicromapBuildSizesInfoEXT {
                                      bool copy_pnext = true);
     safe_VkMicromapBuildSizesInfoEXT(const safe_VkMicromapBuildSizesInfoEXT& copy_src);
     safe_VkMicromapBuildSizesInfoEXT& operator=(const safe_VkMicromapBuildSizesInfoEXT& copy_src);
+    safe_VkMicromapBuildSizesInfoEXT(safe_VkMicromapBuildSizesInfoEXT&& move_src) noexcept;
+    safe_VkMicromapBuildSizesInfoEXT& operator=(safe_VkMicromapBuildSizesInfoEXT&& move_src) noexcept;
     safe_VkMicromapBuildSizesInfoEXT();
     ~safe_VkMicromapBuildSizesInfoEXT();
     void initialize(const VkMicromapBuildSizesInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15291,6 +17048,10 @@ struct safe_VkAccelerationStructureTrianglesOpacityMicromapEXT {
         const safe_VkAccelerationStructureTrianglesOpacityMicromapEXT& copy_src);
     safe_VkAccelerationStructureTrianglesOpacityMicromapEXT& operator=(
         const safe_VkAccelerationStructureTrianglesOpacityMicromapEXT& copy_src);
+    safe_VkAccelerationStructureTrianglesOpacityMicromapEXT(
+        safe_VkAccelerationStructureTrianglesOpacityMicromapEXT&& move_src) noexcept;
+    safe_VkAccelerationStructureTrianglesOpacityMicromapEXT& operator=(
+        safe_VkAccelerationStructureTrianglesOpacityMicromapEXT&& move_src) noexcept;
     safe_VkAccelerationStructureTrianglesOpacityMicromapEXT();
     ~safe_VkAccelerationStructureTrianglesOpacityMicromapEXT();
     void initialize(const VkAccelerationStructureTrianglesOpacityMicromapEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15313,6 +17074,9 @@ struct safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV {
     safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV(const safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV& copy_src);
     safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV& operator=(
         const safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV(safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV& operator=(
+        safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV();
     ~safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV();
     void initialize(const VkPhysicalDeviceDisplacementMicromapFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -15334,6 +17098,10 @@ struct safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV {
     safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV(const safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV& copy_src);
     safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV& operator=(
         const safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV(
+        safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV& operator=(
+        safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV();
     ~safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV();
     void initialize(const VkPhysicalDeviceDisplacementMicromapPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -15372,6 +17140,10 @@ struct safe_VkAccelerationStructureTrianglesDisplacementMicromapNV {
         const safe_VkAccelerationStructureTrianglesDisplacementMicromapNV& copy_src);
     safe_VkAccelerationStructureTrianglesDisplacementMicromapNV& operator=(
         const safe_VkAccelerationStructureTrianglesDisplacementMicromapNV& copy_src);
+    safe_VkAccelerationStructureTrianglesDisplacementMicromapNV(
+        safe_VkAccelerationStructureTrianglesDisplacementMicromapNV&& move_src) noexcept;
+    safe_VkAccelerationStructureTrianglesDisplacementMicromapNV& operator=(
+        safe_VkAccelerationStructureTrianglesDisplacementMicromapNV&& move_src) noexcept;
     safe_VkAccelerationStructureTrianglesDisplacementMicromapNV();
     ~safe_VkAccelerationStructureTrianglesDisplacementMicromapNV();
     void initialize(const VkAccelerationStructureTrianglesDisplacementMicromapNV* in_struct, PNextCopyState* copy_state = {});
@@ -15396,6 +17168,10 @@ struct safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI {
         const safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& copy_src);
     safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& operator=(
         const safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& copy_src);
+    safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI(
+        safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI&& move_src) noexcept;
+    safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& operator=(
+        safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI&& move_src) noexcept;
     safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI();
     ~safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI();
     void initialize(const VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI* in_struct, PNextCopyState* copy_state = {});
@@ -15421,6 +17197,10 @@ struct safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI {
         const safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& copy_src);
     safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& operator=(
         const safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& copy_src);
+    safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI(
+        safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI&& move_src) noexcept;
+    safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& operator=(
+        safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI&& move_src) noexcept;
     safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI();
     ~safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI();
     void initialize(const VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI* in_struct, PNextCopyState* copy_state = {});
@@ -15444,6 +17224,10 @@ struct safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI {
         const safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI& copy_src);
     safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI& operator=(
         const safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI& copy_src);
+    safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI(
+        safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI&& move_src) noexcept;
+    safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI& operator=(
+        safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI&& move_src) noexcept;
     safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI();
     ~safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI();
     void initialize(const VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI* in_struct, PNextCopyState* copy_state = {});
@@ -15466,6 +17250,9 @@ struct safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT {
     safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT(const safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT(safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT();
     ~safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT();
     void initialize(const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15488,6 +17275,10 @@ struct safe_VkSamplerBorderColorComponentMappingCreateInfoEXT {
     safe_VkSamplerBorderColorComponentMappingCreateInfoEXT(const safe_VkSamplerBorderColorComponentMappingCreateInfoEXT& copy_src);
     safe_VkSamplerBorderColorComponentMappingCreateInfoEXT& operator=(
         const safe_VkSamplerBorderColorComponentMappingCreateInfoEXT& copy_src);
+    safe_VkSamplerBorderColorComponentMappingCreateInfoEXT(
+        safe_VkSamplerBorderColorComponentMappingCreateInfoEXT&& move_src) noexcept;
+    safe_VkSamplerBorderColorComponentMappingCreateInfoEXT& operator=(
+        safe_VkSamplerBorderColorComponentMappingCreateInfoEXT&& move_src) noexcept;
     safe_VkSamplerBorderColorComponentMappingCreateInfoEXT();
     ~safe_VkSamplerBorderColorComponentMappingCreateInfoEXT();
     void initialize(const VkSamplerBorderColorComponentMappingCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15510,6 +17301,10 @@ struct safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT {
         const safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& copy_src);
     safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& operator=(
         const safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& copy_src);
+    safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT(
+        safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& operator=(
+        safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT();
     ~safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT();
     void initialize(const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15532,6 +17327,8 @@ struct safe_VkPhysicalDeviceShaderCorePropertiesARM {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderCorePropertiesARM(const safe_VkPhysicalDeviceShaderCorePropertiesARM& copy_src);
     safe_VkPhysicalDeviceShaderCorePropertiesARM& operator=(const safe_VkPhysicalDeviceShaderCorePropertiesARM& copy_src);
+    safe_VkPhysicalDeviceShaderCorePropertiesARM(safe_VkPhysicalDeviceShaderCorePropertiesARM&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderCorePropertiesARM& operator=(safe_VkPhysicalDeviceShaderCorePropertiesARM&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderCorePropertiesARM();
     ~safe_VkPhysicalDeviceShaderCorePropertiesARM();
     void initialize(const VkPhysicalDeviceShaderCorePropertiesARM* in_struct, PNextCopyState* copy_state = {});
@@ -15550,6 +17347,9 @@ struct safe_VkDeviceQueueShaderCoreControlCreateInfoARM {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDeviceQueueShaderCoreControlCreateInfoARM(const safe_VkDeviceQueueShaderCoreControlCreateInfoARM& copy_src);
     safe_VkDeviceQueueShaderCoreControlCreateInfoARM& operator=(const safe_VkDeviceQueueShaderCoreControlCreateInfoARM& copy_src);
+    safe_VkDeviceQueueShaderCoreControlCreateInfoARM(safe_VkDeviceQueueShaderCoreControlCreateInfoARM&& move_src) noexcept;
+    safe_VkDeviceQueueShaderCoreControlCreateInfoARM& operator=(
+        safe_VkDeviceQueueShaderCoreControlCreateInfoARM&& move_src) noexcept;
     safe_VkDeviceQueueShaderCoreControlCreateInfoARM();
     ~safe_VkDeviceQueueShaderCoreControlCreateInfoARM();
     void initialize(const VkDeviceQueueShaderCoreControlCreateInfoARM* in_struct, PNextCopyState* copy_state = {});
@@ -15571,6 +17371,9 @@ struct safe_VkPhysicalDeviceSchedulingControlsFeaturesARM {
     safe_VkPhysicalDeviceSchedulingControlsFeaturesARM(const safe_VkPhysicalDeviceSchedulingControlsFeaturesARM& copy_src);
     safe_VkPhysicalDeviceSchedulingControlsFeaturesARM& operator=(
         const safe_VkPhysicalDeviceSchedulingControlsFeaturesARM& copy_src);
+    safe_VkPhysicalDeviceSchedulingControlsFeaturesARM(safe_VkPhysicalDeviceSchedulingControlsFeaturesARM&& move_src) noexcept;
+    safe_VkPhysicalDeviceSchedulingControlsFeaturesARM& operator=(
+        safe_VkPhysicalDeviceSchedulingControlsFeaturesARM&& move_src) noexcept;
     safe_VkPhysicalDeviceSchedulingControlsFeaturesARM();
     ~safe_VkPhysicalDeviceSchedulingControlsFeaturesARM();
     void initialize(const VkPhysicalDeviceSchedulingControlsFeaturesARM* in_struct, PNextCopyState* copy_state = {});
@@ -15592,6 +17395,9 @@ struct safe_VkPhysicalDeviceSchedulingControlsPropertiesARM {
     safe_VkPhysicalDeviceSchedulingControlsPropertiesARM(const safe_VkPhysicalDeviceSchedulingControlsPropertiesARM& copy_src);
     safe_VkPhysicalDeviceSchedulingControlsPropertiesARM& operator=(
         const safe_VkPhysicalDeviceSchedulingControlsPropertiesARM& copy_src);
+    safe_VkPhysicalDeviceSchedulingControlsPropertiesARM(safe_VkPhysicalDeviceSchedulingControlsPropertiesARM&& move_src) noexcept;
+    safe_VkPhysicalDeviceSchedulingControlsPropertiesARM& operator=(
+        safe_VkPhysicalDeviceSchedulingControlsPropertiesARM&& move_src) noexcept;
     safe_VkPhysicalDeviceSchedulingControlsPropertiesARM();
     ~safe_VkPhysicalDeviceSchedulingControlsPropertiesARM();
     void initialize(const VkPhysicalDeviceSchedulingControlsPropertiesARM* in_struct, PNextCopyState* copy_state = {});
@@ -15613,6 +17419,9 @@ struct safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT {
     safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT(const safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT(safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT();
     ~safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT();
     void initialize(const VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15634,6 +17443,8 @@ struct safe_VkImageViewSlicedCreateInfoEXT {
                                         bool copy_pnext = true);
     safe_VkImageViewSlicedCreateInfoEXT(const safe_VkImageViewSlicedCreateInfoEXT& copy_src);
     safe_VkImageViewSlicedCreateInfoEXT& operator=(const safe_VkImageViewSlicedCreateInfoEXT& copy_src);
+    safe_VkImageViewSlicedCreateInfoEXT(safe_VkImageViewSlicedCreateInfoEXT&& move_src) noexcept;
+    safe_VkImageViewSlicedCreateInfoEXT& operator=(safe_VkImageViewSlicedCreateInfoEXT&& move_src) noexcept;
     safe_VkImageViewSlicedCreateInfoEXT();
     ~safe_VkImageViewSlicedCreateInfoEXT();
     void initialize(const VkImageViewSlicedCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15653,6 +17464,10 @@ struct safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE {
         const safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& copy_src);
     safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& operator=(
         const safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& copy_src);
+    safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE(
+        safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE&& move_src) noexcept;
+    safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& operator=(
+        safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE&& move_src) noexcept;
     safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE();
     ~safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE();
     void initialize(const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE* in_struct, PNextCopyState* copy_state = {});
@@ -15674,6 +17489,8 @@ struct safe_VkDescriptorSetBindingReferenceVALVE {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDescriptorSetBindingReferenceVALVE(const safe_VkDescriptorSetBindingReferenceVALVE& copy_src);
     safe_VkDescriptorSetBindingReferenceVALVE& operator=(const safe_VkDescriptorSetBindingReferenceVALVE& copy_src);
+    safe_VkDescriptorSetBindingReferenceVALVE(safe_VkDescriptorSetBindingReferenceVALVE&& move_src) noexcept;
+    safe_VkDescriptorSetBindingReferenceVALVE& operator=(safe_VkDescriptorSetBindingReferenceVALVE&& move_src) noexcept;
     safe_VkDescriptorSetBindingReferenceVALVE();
     ~safe_VkDescriptorSetBindingReferenceVALVE();
     void initialize(const VkDescriptorSetBindingReferenceVALVE* in_struct, PNextCopyState* copy_state = {});
@@ -15693,6 +17510,8 @@ struct safe_VkDescriptorSetLayoutHostMappingInfoVALVE {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkDescriptorSetLayoutHostMappingInfoVALVE(const safe_VkDescriptorSetLayoutHostMappingInfoVALVE& copy_src);
     safe_VkDescriptorSetLayoutHostMappingInfoVALVE& operator=(const safe_VkDescriptorSetLayoutHostMappingInfoVALVE& copy_src);
+    safe_VkDescriptorSetLayoutHostMappingInfoVALVE(safe_VkDescriptorSetLayoutHostMappingInfoVALVE&& move_src) noexcept;
+    safe_VkDescriptorSetLayoutHostMappingInfoVALVE& operator=(safe_VkDescriptorSetLayoutHostMappingInfoVALVE&& move_src) noexcept;
     safe_VkDescriptorSetLayoutHostMappingInfoVALVE();
     ~safe_VkDescriptorSetLayoutHostMappingInfoVALVE();
     void initialize(const VkDescriptorSetLayoutHostMappingInfoVALVE* in_struct, PNextCopyState* copy_state = {});
@@ -15711,6 +17530,9 @@ struct safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT(const safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& operator=(const safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT(safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT();
     ~safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT();
     void initialize(const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15732,6 +17554,9 @@ struct safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT {
     safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT(const safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT(safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT();
     ~safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT();
     void initialize(const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -15752,6 +17577,9 @@ struct safe_VkPhysicalDeviceRenderPassStripedFeaturesARM {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceRenderPassStripedFeaturesARM(const safe_VkPhysicalDeviceRenderPassStripedFeaturesARM& copy_src);
     safe_VkPhysicalDeviceRenderPassStripedFeaturesARM& operator=(const safe_VkPhysicalDeviceRenderPassStripedFeaturesARM& copy_src);
+    safe_VkPhysicalDeviceRenderPassStripedFeaturesARM(safe_VkPhysicalDeviceRenderPassStripedFeaturesARM&& move_src) noexcept;
+    safe_VkPhysicalDeviceRenderPassStripedFeaturesARM& operator=(
+        safe_VkPhysicalDeviceRenderPassStripedFeaturesARM&& move_src) noexcept;
     safe_VkPhysicalDeviceRenderPassStripedFeaturesARM();
     ~safe_VkPhysicalDeviceRenderPassStripedFeaturesARM();
     void initialize(const VkPhysicalDeviceRenderPassStripedFeaturesARM* in_struct, PNextCopyState* copy_state = {});
@@ -15774,6 +17602,9 @@ struct safe_VkPhysicalDeviceRenderPassStripedPropertiesARM {
     safe_VkPhysicalDeviceRenderPassStripedPropertiesARM(const safe_VkPhysicalDeviceRenderPassStripedPropertiesARM& copy_src);
     safe_VkPhysicalDeviceRenderPassStripedPropertiesARM& operator=(
         const safe_VkPhysicalDeviceRenderPassStripedPropertiesARM& copy_src);
+    safe_VkPhysicalDeviceRenderPassStripedPropertiesARM(safe_VkPhysicalDeviceRenderPassStripedPropertiesARM&& move_src) noexcept;
+    safe_VkPhysicalDeviceRenderPassStripedPropertiesARM& operator=(
+        safe_VkPhysicalDeviceRenderPassStripedPropertiesARM&& move_src) noexcept;
     safe_VkPhysicalDeviceRenderPassStripedPropertiesARM();
     ~safe_VkPhysicalDeviceRenderPassStripedPropertiesARM();
     void initialize(const VkPhysicalDeviceRenderPassStripedPropertiesARM* in_struct, PNextCopyState* copy_state = {});
@@ -15794,6 +17625,8 @@ struct safe_VkRenderPassStripeInfoARM {
                                    bool copy_pnext = true);
     safe_VkRenderPassStripeInfoARM(const safe_VkRenderPassStripeInfoARM& copy_src);
     safe_VkRenderPassStripeInfoARM& operator=(const safe_VkRenderPassStripeInfoARM& copy_src);
+    safe_VkRenderPassStripeInfoARM(safe_VkRenderPassStripeInfoARM&& move_src) noexcept;
+    safe_VkRenderPassStripeInfoARM& operator=(safe_VkRenderPassStripeInfoARM&& move_src) noexcept;
     safe_VkRenderPassStripeInfoARM();
     ~safe_VkRenderPassStripeInfoARM();
     void initialize(const VkRenderPassStripeInfoARM* in_struct, PNextCopyState* copy_state = {});
@@ -15811,6 +17644,8 @@ struct safe_VkRenderPassStripeBeginInfoARM {
                                         bool copy_pnext = true);
     safe_VkRenderPassStripeBeginInfoARM(const safe_VkRenderPassStripeBeginInfoARM& copy_src);
     safe_VkRenderPassStripeBeginInfoARM& operator=(const safe_VkRenderPassStripeBeginInfoARM& copy_src);
+    safe_VkRenderPassStripeBeginInfoARM(safe_VkRenderPassStripeBeginInfoARM&& move_src) noexcept;
+    safe_VkRenderPassStripeBeginInfoARM& operator=(safe_VkRenderPassStripeBeginInfoARM&& move_src) noexcept;
     safe_VkRenderPassStripeBeginInfoARM();
     ~safe_VkRenderPassStripeBeginInfoARM();
     void initialize(const VkRenderPassStripeBeginInfoARM* in_struct, PNextCopyState* copy_state = {});
@@ -15828,6 +17663,8 @@ struct safe_VkRenderPassStripeSubmitInfoARM {
                                          bool copy_pnext = true);
     safe_VkRenderPassStripeSubmitInfoARM(const safe_VkRenderPassStripeSubmitInfoARM& copy_src);
     safe_VkRenderPassStripeSubmitInfoARM& operator=(const safe_VkRenderPassStripeSubmitInfoARM& copy_src);
+    safe_VkRenderPassStripeSubmitInfoARM(safe_VkRenderPassStripeSubmitInfoARM&& move_src) noexcept;
+    safe_VkRenderPassStripeSubmitInfoARM& operator=(safe_VkRenderPassStripeSubmitInfoARM&& move_src) noexcept;
     safe_VkRenderPassStripeSubmitInfoARM();
     ~safe_VkRenderPassStripeSubmitInfoARM();
     void initialize(const VkRenderPassStripeSubmitInfoARM* in_struct, PNextCopyState* copy_state = {});
@@ -15846,6 +17683,10 @@ struct safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM {
         const safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& copy_src);
     safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& operator=(
         const safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& copy_src);
+    safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM(
+        safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& operator=(
+        safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM();
     ~safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM();
     void initialize(const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -15869,6 +17710,10 @@ struct safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM {
         const safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& copy_src);
     safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& operator=(
         const safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& copy_src);
+    safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM(
+        safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& operator=(
+        safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM();
     ~safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM();
     void initialize(const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -15890,6 +17735,9 @@ struct safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM(const safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM& copy_src);
     safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM& operator=(const safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM& copy_src);
+    safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM(safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM&& move_src) noexcept;
+    safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM& operator=(
+        safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM&& move_src) noexcept;
     safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM();
     ~safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM();
     void initialize(const VkSubpassFragmentDensityMapOffsetEndInfoQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -15910,6 +17758,9 @@ struct safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV(const safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& copy_src);
     safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& operator=(const safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV(safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& operator=(
+        safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV();
     ~safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV();
     void initialize(const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -15931,6 +17782,9 @@ struct safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV {
     safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV(const safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& copy_src);
     safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& operator=(
         const safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV(safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& operator=(
+        safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV();
     ~safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV();
     void initialize(const VkPhysicalDeviceCopyMemoryIndirectPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -15952,6 +17806,9 @@ struct safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV {
     safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV(const safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV& copy_src);
     safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV& operator=(
         const safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV(safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV& operator=(
+        safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV();
     ~safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV();
     void initialize(const VkPhysicalDeviceMemoryDecompressionFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -15974,6 +17831,9 @@ struct safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV {
     safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV(const safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV& copy_src);
     safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV& operator=(
         const safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV(safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV& operator=(
+        safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV();
     ~safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV();
     void initialize(const VkPhysicalDeviceMemoryDecompressionPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -15999,6 +17859,10 @@ struct safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV {
         const safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV& copy_src);
     safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV& operator=(
         const safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV(
+        safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV& operator=(
+        safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV();
     ~safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV();
     void initialize(const VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -16021,6 +17885,8 @@ struct safe_VkComputePipelineIndirectBufferInfoNV {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkComputePipelineIndirectBufferInfoNV(const safe_VkComputePipelineIndirectBufferInfoNV& copy_src);
     safe_VkComputePipelineIndirectBufferInfoNV& operator=(const safe_VkComputePipelineIndirectBufferInfoNV& copy_src);
+    safe_VkComputePipelineIndirectBufferInfoNV(safe_VkComputePipelineIndirectBufferInfoNV&& move_src) noexcept;
+    safe_VkComputePipelineIndirectBufferInfoNV& operator=(safe_VkComputePipelineIndirectBufferInfoNV&& move_src) noexcept;
     safe_VkComputePipelineIndirectBufferInfoNV();
     ~safe_VkComputePipelineIndirectBufferInfoNV();
     void initialize(const VkComputePipelineIndirectBufferInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -16040,6 +17906,8 @@ struct safe_VkPipelineIndirectDeviceAddressInfoNV {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPipelineIndirectDeviceAddressInfoNV(const safe_VkPipelineIndirectDeviceAddressInfoNV& copy_src);
     safe_VkPipelineIndirectDeviceAddressInfoNV& operator=(const safe_VkPipelineIndirectDeviceAddressInfoNV& copy_src);
+    safe_VkPipelineIndirectDeviceAddressInfoNV(safe_VkPipelineIndirectDeviceAddressInfoNV&& move_src) noexcept;
+    safe_VkPipelineIndirectDeviceAddressInfoNV& operator=(safe_VkPipelineIndirectDeviceAddressInfoNV&& move_src) noexcept;
     safe_VkPipelineIndirectDeviceAddressInfoNV();
     ~safe_VkPipelineIndirectDeviceAddressInfoNV();
     void initialize(const VkPipelineIndirectDeviceAddressInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -16059,6 +17927,9 @@ struct safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV {
     safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV(const safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV& copy_src);
     safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV& operator=(
         const safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV(safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV& operator=(
+        safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV();
     ~safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV();
     void initialize(const VkPhysicalDeviceLinearColorAttachmentFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -16082,6 +17953,10 @@ struct safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT {
         const safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT(
+        safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT();
     ~safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT();
     void initialize(const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16105,6 +17980,8 @@ struct safe_VkImageViewSampleWeightCreateInfoQCOM {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkImageViewSampleWeightCreateInfoQCOM(const safe_VkImageViewSampleWeightCreateInfoQCOM& copy_src);
     safe_VkImageViewSampleWeightCreateInfoQCOM& operator=(const safe_VkImageViewSampleWeightCreateInfoQCOM& copy_src);
+    safe_VkImageViewSampleWeightCreateInfoQCOM(safe_VkImageViewSampleWeightCreateInfoQCOM&& move_src) noexcept;
+    safe_VkImageViewSampleWeightCreateInfoQCOM& operator=(safe_VkImageViewSampleWeightCreateInfoQCOM&& move_src) noexcept;
     safe_VkImageViewSampleWeightCreateInfoQCOM();
     ~safe_VkImageViewSampleWeightCreateInfoQCOM();
     void initialize(const VkImageViewSampleWeightCreateInfoQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -16125,6 +18002,9 @@ struct safe_VkPhysicalDeviceImageProcessingFeaturesQCOM {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceImageProcessingFeaturesQCOM(const safe_VkPhysicalDeviceImageProcessingFeaturesQCOM& copy_src);
     safe_VkPhysicalDeviceImageProcessingFeaturesQCOM& operator=(const safe_VkPhysicalDeviceImageProcessingFeaturesQCOM& copy_src);
+    safe_VkPhysicalDeviceImageProcessingFeaturesQCOM(safe_VkPhysicalDeviceImageProcessingFeaturesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageProcessingFeaturesQCOM& operator=(
+        safe_VkPhysicalDeviceImageProcessingFeaturesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceImageProcessingFeaturesQCOM();
     ~safe_VkPhysicalDeviceImageProcessingFeaturesQCOM();
     void initialize(const VkPhysicalDeviceImageProcessingFeaturesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -16149,6 +18029,9 @@ struct safe_VkPhysicalDeviceImageProcessingPropertiesQCOM {
     safe_VkPhysicalDeviceImageProcessingPropertiesQCOM(const safe_VkPhysicalDeviceImageProcessingPropertiesQCOM& copy_src);
     safe_VkPhysicalDeviceImageProcessingPropertiesQCOM& operator=(
         const safe_VkPhysicalDeviceImageProcessingPropertiesQCOM& copy_src);
+    safe_VkPhysicalDeviceImageProcessingPropertiesQCOM(safe_VkPhysicalDeviceImageProcessingPropertiesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageProcessingPropertiesQCOM& operator=(
+        safe_VkPhysicalDeviceImageProcessingPropertiesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceImageProcessingPropertiesQCOM();
     ~safe_VkPhysicalDeviceImageProcessingPropertiesQCOM();
     void initialize(const VkPhysicalDeviceImageProcessingPropertiesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -16172,6 +18055,9 @@ struct safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT {
     safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT(const safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT(safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT();
     ~safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT();
     void initialize(const VkPhysicalDeviceNestedCommandBufferFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16193,6 +18079,10 @@ struct safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT {
     safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT(const safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT(
+        safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT();
     ~safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT();
     void initialize(const VkPhysicalDeviceNestedCommandBufferPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16213,6 +18103,8 @@ struct safe_VkExternalMemoryAcquireUnmodifiedEXT {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkExternalMemoryAcquireUnmodifiedEXT(const safe_VkExternalMemoryAcquireUnmodifiedEXT& copy_src);
     safe_VkExternalMemoryAcquireUnmodifiedEXT& operator=(const safe_VkExternalMemoryAcquireUnmodifiedEXT& copy_src);
+    safe_VkExternalMemoryAcquireUnmodifiedEXT(safe_VkExternalMemoryAcquireUnmodifiedEXT&& move_src) noexcept;
+    safe_VkExternalMemoryAcquireUnmodifiedEXT& operator=(safe_VkExternalMemoryAcquireUnmodifiedEXT&& move_src) noexcept;
     safe_VkExternalMemoryAcquireUnmodifiedEXT();
     ~safe_VkExternalMemoryAcquireUnmodifiedEXT();
     void initialize(const VkExternalMemoryAcquireUnmodifiedEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16262,6 +18154,10 @@ struct safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT {
     safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT(const safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& copy_src);
     safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& operator=(
         const safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT(
+        safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& operator=(
+        safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT();
     ~safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT();
     void initialize(const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16284,6 +18180,10 @@ struct safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT {
         const safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& copy_src);
     safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& operator=(
         const safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT(
+        safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& operator=(
+        safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT();
     ~safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT();
     void initialize(const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16305,6 +18205,9 @@ struct safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT {
     safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT(const safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT(safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT();
     ~safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT();
     void initialize(const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16325,6 +18228,8 @@ struct safe_VkRenderPassCreationControlEXT {
                                         bool copy_pnext = true);
     safe_VkRenderPassCreationControlEXT(const safe_VkRenderPassCreationControlEXT& copy_src);
     safe_VkRenderPassCreationControlEXT& operator=(const safe_VkRenderPassCreationControlEXT& copy_src);
+    safe_VkRenderPassCreationControlEXT(safe_VkRenderPassCreationControlEXT&& move_src) noexcept;
+    safe_VkRenderPassCreationControlEXT& operator=(safe_VkRenderPassCreationControlEXT&& move_src) noexcept;
     safe_VkRenderPassCreationControlEXT();
     ~safe_VkRenderPassCreationControlEXT();
     void initialize(const VkRenderPassCreationControlEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16341,6 +18246,8 @@ struct safe_VkRenderPassCreationFeedbackCreateInfoEXT {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRenderPassCreationFeedbackCreateInfoEXT(const safe_VkRenderPassCreationFeedbackCreateInfoEXT& copy_src);
     safe_VkRenderPassCreationFeedbackCreateInfoEXT& operator=(const safe_VkRenderPassCreationFeedbackCreateInfoEXT& copy_src);
+    safe_VkRenderPassCreationFeedbackCreateInfoEXT(safe_VkRenderPassCreationFeedbackCreateInfoEXT&& move_src) noexcept;
+    safe_VkRenderPassCreationFeedbackCreateInfoEXT& operator=(safe_VkRenderPassCreationFeedbackCreateInfoEXT&& move_src) noexcept;
     safe_VkRenderPassCreationFeedbackCreateInfoEXT();
     ~safe_VkRenderPassCreationFeedbackCreateInfoEXT();
     void initialize(const VkRenderPassCreationFeedbackCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16359,6 +18266,8 @@ struct safe_VkRenderPassSubpassFeedbackCreateInfoEXT {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRenderPassSubpassFeedbackCreateInfoEXT(const safe_VkRenderPassSubpassFeedbackCreateInfoEXT& copy_src);
     safe_VkRenderPassSubpassFeedbackCreateInfoEXT& operator=(const safe_VkRenderPassSubpassFeedbackCreateInfoEXT& copy_src);
+    safe_VkRenderPassSubpassFeedbackCreateInfoEXT(safe_VkRenderPassSubpassFeedbackCreateInfoEXT&& move_src) noexcept;
+    safe_VkRenderPassSubpassFeedbackCreateInfoEXT& operator=(safe_VkRenderPassSubpassFeedbackCreateInfoEXT&& move_src) noexcept;
     safe_VkRenderPassSubpassFeedbackCreateInfoEXT();
     ~safe_VkRenderPassSubpassFeedbackCreateInfoEXT();
     void initialize(const VkRenderPassSubpassFeedbackCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16378,6 +18287,8 @@ struct safe_VkDirectDriverLoadingInfoLUNARG {
                                          bool copy_pnext = true);
     safe_VkDirectDriverLoadingInfoLUNARG(const safe_VkDirectDriverLoadingInfoLUNARG& copy_src);
     safe_VkDirectDriverLoadingInfoLUNARG& operator=(const safe_VkDirectDriverLoadingInfoLUNARG& copy_src);
+    safe_VkDirectDriverLoadingInfoLUNARG(safe_VkDirectDriverLoadingInfoLUNARG&& move_src) noexcept;
+    safe_VkDirectDriverLoadingInfoLUNARG& operator=(safe_VkDirectDriverLoadingInfoLUNARG&& move_src) noexcept;
     safe_VkDirectDriverLoadingInfoLUNARG();
     ~safe_VkDirectDriverLoadingInfoLUNARG();
     void initialize(const VkDirectDriverLoadingInfoLUNARG* in_struct, PNextCopyState* copy_state = {});
@@ -16396,6 +18307,8 @@ struct safe_VkDirectDriverLoadingListLUNARG {
                                          bool copy_pnext = true);
     safe_VkDirectDriverLoadingListLUNARG(const safe_VkDirectDriverLoadingListLUNARG& copy_src);
     safe_VkDirectDriverLoadingListLUNARG& operator=(const safe_VkDirectDriverLoadingListLUNARG& copy_src);
+    safe_VkDirectDriverLoadingListLUNARG(safe_VkDirectDriverLoadingListLUNARG&& move_src) noexcept;
+    safe_VkDirectDriverLoadingListLUNARG& operator=(safe_VkDirectDriverLoadingListLUNARG&& move_src) noexcept;
     safe_VkDirectDriverLoadingListLUNARG();
     ~safe_VkDirectDriverLoadingListLUNARG();
     void initialize(const VkDirectDriverLoadingListLUNARG* in_struct, PNextCopyState* copy_state = {});
@@ -16413,6 +18326,10 @@ struct safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT {
     safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT(const safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT(
+        safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT();
     ~safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT();
     void initialize(const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16435,6 +18352,10 @@ struct safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT {
         const safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& operator=(
         const safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT(
+        safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& operator=(
+        safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT();
     ~safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT();
     void initialize(const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16458,6 +18379,10 @@ struct safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT {
         const safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT& copy_src);
     safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT& operator=(
         const safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT& copy_src);
+    safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT(
+        safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT&& move_src) noexcept;
+    safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT& operator=(
+        safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT&& move_src) noexcept;
     safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT();
     ~safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT();
     void initialize(const VkPipelineShaderStageModuleIdentifierCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16479,6 +18404,8 @@ struct safe_VkShaderModuleIdentifierEXT {
                                      bool copy_pnext = true);
     safe_VkShaderModuleIdentifierEXT(const safe_VkShaderModuleIdentifierEXT& copy_src);
     safe_VkShaderModuleIdentifierEXT& operator=(const safe_VkShaderModuleIdentifierEXT& copy_src);
+    safe_VkShaderModuleIdentifierEXT(safe_VkShaderModuleIdentifierEXT&& move_src) noexcept;
+    safe_VkShaderModuleIdentifierEXT& operator=(safe_VkShaderModuleIdentifierEXT&& move_src) noexcept;
     safe_VkShaderModuleIdentifierEXT();
     ~safe_VkShaderModuleIdentifierEXT();
     void initialize(const VkShaderModuleIdentifierEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16495,6 +18422,8 @@ struct safe_VkPhysicalDeviceOpticalFlowFeaturesNV {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceOpticalFlowFeaturesNV(const safe_VkPhysicalDeviceOpticalFlowFeaturesNV& copy_src);
     safe_VkPhysicalDeviceOpticalFlowFeaturesNV& operator=(const safe_VkPhysicalDeviceOpticalFlowFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceOpticalFlowFeaturesNV(safe_VkPhysicalDeviceOpticalFlowFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceOpticalFlowFeaturesNV& operator=(safe_VkPhysicalDeviceOpticalFlowFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceOpticalFlowFeaturesNV();
     ~safe_VkPhysicalDeviceOpticalFlowFeaturesNV();
     void initialize(const VkPhysicalDeviceOpticalFlowFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -16523,6 +18452,8 @@ struct safe_VkPhysicalDeviceOpticalFlowPropertiesNV {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceOpticalFlowPropertiesNV(const safe_VkPhysicalDeviceOpticalFlowPropertiesNV& copy_src);
     safe_VkPhysicalDeviceOpticalFlowPropertiesNV& operator=(const safe_VkPhysicalDeviceOpticalFlowPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceOpticalFlowPropertiesNV(safe_VkPhysicalDeviceOpticalFlowPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceOpticalFlowPropertiesNV& operator=(safe_VkPhysicalDeviceOpticalFlowPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceOpticalFlowPropertiesNV();
     ~safe_VkPhysicalDeviceOpticalFlowPropertiesNV();
     void initialize(const VkPhysicalDeviceOpticalFlowPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -16541,6 +18472,8 @@ struct safe_VkOpticalFlowImageFormatInfoNV {
                                         bool copy_pnext = true);
     safe_VkOpticalFlowImageFormatInfoNV(const safe_VkOpticalFlowImageFormatInfoNV& copy_src);
     safe_VkOpticalFlowImageFormatInfoNV& operator=(const safe_VkOpticalFlowImageFormatInfoNV& copy_src);
+    safe_VkOpticalFlowImageFormatInfoNV(safe_VkOpticalFlowImageFormatInfoNV&& move_src) noexcept;
+    safe_VkOpticalFlowImageFormatInfoNV& operator=(safe_VkOpticalFlowImageFormatInfoNV&& move_src) noexcept;
     safe_VkOpticalFlowImageFormatInfoNV();
     ~safe_VkOpticalFlowImageFormatInfoNV();
     void initialize(const VkOpticalFlowImageFormatInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -16557,6 +18490,8 @@ struct safe_VkOpticalFlowImageFormatPropertiesNV {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkOpticalFlowImageFormatPropertiesNV(const safe_VkOpticalFlowImageFormatPropertiesNV& copy_src);
     safe_VkOpticalFlowImageFormatPropertiesNV& operator=(const safe_VkOpticalFlowImageFormatPropertiesNV& copy_src);
+    safe_VkOpticalFlowImageFormatPropertiesNV(safe_VkOpticalFlowImageFormatPropertiesNV&& move_src) noexcept;
+    safe_VkOpticalFlowImageFormatPropertiesNV& operator=(safe_VkOpticalFlowImageFormatPropertiesNV&& move_src) noexcept;
     safe_VkOpticalFlowImageFormatPropertiesNV();
     ~safe_VkOpticalFlowImageFormatPropertiesNV();
     void initialize(const VkOpticalFlowImageFormatPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -16583,6 +18518,8 @@ struct safe_VkOpticalFlowSessionCreateInfoNV {
                                           bool copy_pnext = true);
     safe_VkOpticalFlowSessionCreateInfoNV(const safe_VkOpticalFlowSessionCreateInfoNV& copy_src);
     safe_VkOpticalFlowSessionCreateInfoNV& operator=(const safe_VkOpticalFlowSessionCreateInfoNV& copy_src);
+    safe_VkOpticalFlowSessionCreateInfoNV(safe_VkOpticalFlowSessionCreateInfoNV&& move_src) noexcept;
+    safe_VkOpticalFlowSessionCreateInfoNV& operator=(safe_VkOpticalFlowSessionCreateInfoNV&& move_src) noexcept;
     safe_VkOpticalFlowSessionCreateInfoNV();
     ~safe_VkOpticalFlowSessionCreateInfoNV();
     void initialize(const VkOpticalFlowSessionCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -16601,6 +18538,9 @@ struct safe_VkOpticalFlowSessionCreatePrivateDataInfoNV {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkOpticalFlowSessionCreatePrivateDataInfoNV(const safe_VkOpticalFlowSessionCreatePrivateDataInfoNV& copy_src);
     safe_VkOpticalFlowSessionCreatePrivateDataInfoNV& operator=(const safe_VkOpticalFlowSessionCreatePrivateDataInfoNV& copy_src);
+    safe_VkOpticalFlowSessionCreatePrivateDataInfoNV(safe_VkOpticalFlowSessionCreatePrivateDataInfoNV&& move_src) noexcept;
+    safe_VkOpticalFlowSessionCreatePrivateDataInfoNV& operator=(
+        safe_VkOpticalFlowSessionCreatePrivateDataInfoNV&& move_src) noexcept;
     safe_VkOpticalFlowSessionCreatePrivateDataInfoNV();
     ~safe_VkOpticalFlowSessionCreatePrivateDataInfoNV();
     void initialize(const VkOpticalFlowSessionCreatePrivateDataInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -16623,6 +18563,8 @@ struct safe_VkOpticalFlowExecuteInfoNV {
                                     bool copy_pnext = true);
     safe_VkOpticalFlowExecuteInfoNV(const safe_VkOpticalFlowExecuteInfoNV& copy_src);
     safe_VkOpticalFlowExecuteInfoNV& operator=(const safe_VkOpticalFlowExecuteInfoNV& copy_src);
+    safe_VkOpticalFlowExecuteInfoNV(safe_VkOpticalFlowExecuteInfoNV&& move_src) noexcept;
+    safe_VkOpticalFlowExecuteInfoNV& operator=(safe_VkOpticalFlowExecuteInfoNV&& move_src) noexcept;
     safe_VkOpticalFlowExecuteInfoNV();
     ~safe_VkOpticalFlowExecuteInfoNV();
     void initialize(const VkOpticalFlowExecuteInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -16639,6 +18581,8 @@ struct safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT(const safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT& operator=(const safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT(safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT& operator=(safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT();
     ~safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT();
     void initialize(const VkPhysicalDeviceLegacyDitheringFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16661,6 +18605,10 @@ struct safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT {
         const safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& copy_src);
     safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& operator=(
         const safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& copy_src);
+    safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT(
+        safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& operator=(
+        safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT();
     ~safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT();
     void initialize(const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16684,6 +18632,10 @@ struct safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID {
         const safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID& copy_src);
     safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID& operator=(
         const safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID& copy_src);
+    safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID(
+        safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID&& move_src) noexcept;
+    safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID& operator=(
+        safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID&& move_src) noexcept;
     safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID();
     ~safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID();
     void initialize(const VkPhysicalDeviceExternalFormatResolveFeaturesANDROID* in_struct, PNextCopyState* copy_state = {});
@@ -16709,6 +18661,10 @@ struct safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID {
         const safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID& copy_src);
     safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID& operator=(
         const safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID& copy_src);
+    safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID(
+        safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID&& move_src) noexcept;
+    safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID& operator=(
+        safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID&& move_src) noexcept;
     safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID();
     ~safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID();
     void initialize(const VkPhysicalDeviceExternalFormatResolvePropertiesANDROID* in_struct, PNextCopyState* copy_state = {});
@@ -16732,6 +18688,10 @@ struct safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID {
         const safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID& copy_src);
     safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID& operator=(
         const safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID& copy_src);
+    safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID(
+        safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID&& move_src) noexcept;
+    safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID& operator=(
+        safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID&& move_src) noexcept;
     safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID();
     ~safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID();
     void initialize(const VkAndroidHardwareBufferFormatResolvePropertiesANDROID* in_struct, PNextCopyState* copy_state = {});
@@ -16753,6 +18713,8 @@ struct safe_VkPhysicalDeviceShaderObjectFeaturesEXT {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderObjectFeaturesEXT(const safe_VkPhysicalDeviceShaderObjectFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceShaderObjectFeaturesEXT& operator=(const safe_VkPhysicalDeviceShaderObjectFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceShaderObjectFeaturesEXT(safe_VkPhysicalDeviceShaderObjectFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderObjectFeaturesEXT& operator=(safe_VkPhysicalDeviceShaderObjectFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderObjectFeaturesEXT();
     ~safe_VkPhysicalDeviceShaderObjectFeaturesEXT();
     void initialize(const VkPhysicalDeviceShaderObjectFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16772,6 +18734,8 @@ struct safe_VkPhysicalDeviceShaderObjectPropertiesEXT {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceShaderObjectPropertiesEXT(const safe_VkPhysicalDeviceShaderObjectPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceShaderObjectPropertiesEXT& operator=(const safe_VkPhysicalDeviceShaderObjectPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceShaderObjectPropertiesEXT(safe_VkPhysicalDeviceShaderObjectPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderObjectPropertiesEXT& operator=(safe_VkPhysicalDeviceShaderObjectPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderObjectPropertiesEXT();
     ~safe_VkPhysicalDeviceShaderObjectPropertiesEXT();
     void initialize(const VkPhysicalDeviceShaderObjectPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16800,6 +18764,8 @@ struct safe_VkShaderCreateInfoEXT {
     safe_VkShaderCreateInfoEXT(const VkShaderCreateInfoEXT* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkShaderCreateInfoEXT(const safe_VkShaderCreateInfoEXT& copy_src);
     safe_VkShaderCreateInfoEXT& operator=(const safe_VkShaderCreateInfoEXT& copy_src);
+    safe_VkShaderCreateInfoEXT(safe_VkShaderCreateInfoEXT&& move_src) noexcept;
+    safe_VkShaderCreateInfoEXT& operator=(safe_VkShaderCreateInfoEXT&& move_src) noexcept;
     safe_VkShaderCreateInfoEXT();
     ~safe_VkShaderCreateInfoEXT();
     void initialize(const VkShaderCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -16816,6 +18782,8 @@ struct safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM(const safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM& copy_src);
     safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM& operator=(const safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM& copy_src);
+    safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM(safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM& operator=(safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM();
     ~safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM();
     void initialize(const VkPhysicalDeviceTilePropertiesFeaturesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -16837,6 +18805,8 @@ struct safe_VkTilePropertiesQCOM {
     safe_VkTilePropertiesQCOM(const VkTilePropertiesQCOM* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkTilePropertiesQCOM(const safe_VkTilePropertiesQCOM& copy_src);
     safe_VkTilePropertiesQCOM& operator=(const safe_VkTilePropertiesQCOM& copy_src);
+    safe_VkTilePropertiesQCOM(safe_VkTilePropertiesQCOM&& move_src) noexcept;
+    safe_VkTilePropertiesQCOM& operator=(safe_VkTilePropertiesQCOM&& move_src) noexcept;
     safe_VkTilePropertiesQCOM();
     ~safe_VkTilePropertiesQCOM();
     void initialize(const VkTilePropertiesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -16853,6 +18823,8 @@ struct safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC {
                                                    PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC(const safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC& copy_src);
     safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC& operator=(const safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC& copy_src);
+    safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC(safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC&& move_src) noexcept;
+    safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC& operator=(safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC&& move_src) noexcept;
     safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC();
     ~safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC();
     void initialize(const VkPhysicalDeviceAmigoProfilingFeaturesSEC* in_struct, PNextCopyState* copy_state = {});
@@ -16872,6 +18844,8 @@ struct safe_VkAmigoProfilingSubmitInfoSEC {
                                        bool copy_pnext = true);
     safe_VkAmigoProfilingSubmitInfoSEC(const safe_VkAmigoProfilingSubmitInfoSEC& copy_src);
     safe_VkAmigoProfilingSubmitInfoSEC& operator=(const safe_VkAmigoProfilingSubmitInfoSEC& copy_src);
+    safe_VkAmigoProfilingSubmitInfoSEC(safe_VkAmigoProfilingSubmitInfoSEC&& move_src) noexcept;
+    safe_VkAmigoProfilingSubmitInfoSEC& operator=(safe_VkAmigoProfilingSubmitInfoSEC&& move_src) noexcept;
     safe_VkAmigoProfilingSubmitInfoSEC();
     ~safe_VkAmigoProfilingSubmitInfoSEC();
     void initialize(const VkAmigoProfilingSubmitInfoSEC* in_struct, PNextCopyState* copy_state = {});
@@ -16891,6 +18865,10 @@ struct safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM {
         const safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& copy_src);
     safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& operator=(
         const safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& copy_src);
+    safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM(
+        safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& operator=(
+        safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM();
     ~safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM();
     void initialize(const VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -16914,6 +18892,10 @@ struct safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV {
         const safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& copy_src);
     safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& operator=(
         const safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& copy_src);
+    safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV(
+        safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& operator=(
+        safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV();
     ~safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV();
     void initialize(const VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -16937,6 +18919,10 @@ struct safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV {
         const safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& copy_src);
     safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& operator=(
         const safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV(
+        safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& operator=(
+        safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV();
     ~safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV();
     void initialize(const VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -16959,6 +18945,10 @@ struct safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV {
         const safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV& copy_src);
     safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV& operator=(
         const safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV(
+        safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV& operator=(
+        safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV();
     ~safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV();
     void initialize(const VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -16984,6 +18974,10 @@ struct safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV {
         const safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV& copy_src);
     safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV& operator=(
         const safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV& copy_src);
+    safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV(
+        safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV& operator=(
+        safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV();
     ~safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV();
     void initialize(const VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -17005,6 +18999,8 @@ struct safe_VkLayerSettingEXT {
     safe_VkLayerSettingEXT(const VkLayerSettingEXT* in_struct, PNextCopyState* copy_state = {});
     safe_VkLayerSettingEXT(const safe_VkLayerSettingEXT& copy_src);
     safe_VkLayerSettingEXT& operator=(const safe_VkLayerSettingEXT& copy_src);
+    safe_VkLayerSettingEXT(safe_VkLayerSettingEXT&& move_src) noexcept;
+    safe_VkLayerSettingEXT& operator=(safe_VkLayerSettingEXT&& move_src) noexcept;
     safe_VkLayerSettingEXT();
     ~safe_VkLayerSettingEXT();
     void initialize(const VkLayerSettingEXT* in_struct, PNextCopyState* copy_state = {});
@@ -17022,6 +19018,8 @@ struct safe_VkLayerSettingsCreateInfoEXT {
                                       bool copy_pnext = true);
     safe_VkLayerSettingsCreateInfoEXT(const safe_VkLayerSettingsCreateInfoEXT& copy_src);
     safe_VkLayerSettingsCreateInfoEXT& operator=(const safe_VkLayerSettingsCreateInfoEXT& copy_src);
+    safe_VkLayerSettingsCreateInfoEXT(safe_VkLayerSettingsCreateInfoEXT&& move_src) noexcept;
+    safe_VkLayerSettingsCreateInfoEXT& operator=(safe_VkLayerSettingsCreateInfoEXT&& move_src) noexcept;
     safe_VkLayerSettingsCreateInfoEXT();
     ~safe_VkLayerSettingsCreateInfoEXT();
     void initialize(const VkLayerSettingsCreateInfoEXT* in_struct, PNextCopyState* copy_state = {});
@@ -17039,6 +19037,9 @@ struct safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM {
     safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM(const safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& copy_src);
     safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& operator=(
         const safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& copy_src);
+    safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM(safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& operator=(
+        safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM();
     ~safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM();
     void initialize(const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM* in_struct, PNextCopyState* copy_state = {});
@@ -17062,6 +19063,9 @@ struct safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM {
     safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM(const safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& copy_src);
     safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& operator=(
         const safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& copy_src);
+    safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM(safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM&& move_src) noexcept;
+    safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& operator=(
+        safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM&& move_src) noexcept;
     safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM();
     ~safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM();
     void initialize(const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM* in_struct, PNextCopyState* copy_state = {});
@@ -17085,6 +19089,10 @@ struct safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT {
         const safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& copy_src);
     safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& operator=(
         const safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& copy_src);
+    safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT(
+        safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& operator=(
+        safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT();
     ~safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT();
     void initialize(const VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -17108,6 +19116,10 @@ struct safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT {
         const safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT(
+        safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT();
     ~safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT();
     void initialize(const VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -17131,6 +19143,8 @@ struct safe_VkLatencySleepModeInfoNV {
                                   bool copy_pnext = true);
     safe_VkLatencySleepModeInfoNV(const safe_VkLatencySleepModeInfoNV& copy_src);
     safe_VkLatencySleepModeInfoNV& operator=(const safe_VkLatencySleepModeInfoNV& copy_src);
+    safe_VkLatencySleepModeInfoNV(safe_VkLatencySleepModeInfoNV&& move_src) noexcept;
+    safe_VkLatencySleepModeInfoNV& operator=(safe_VkLatencySleepModeInfoNV&& move_src) noexcept;
     safe_VkLatencySleepModeInfoNV();
     ~safe_VkLatencySleepModeInfoNV();
     void initialize(const VkLatencySleepModeInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -17147,6 +19161,8 @@ struct safe_VkLatencySleepInfoNV {
     safe_VkLatencySleepInfoNV(const VkLatencySleepInfoNV* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkLatencySleepInfoNV(const safe_VkLatencySleepInfoNV& copy_src);
     safe_VkLatencySleepInfoNV& operator=(const safe_VkLatencySleepInfoNV& copy_src);
+    safe_VkLatencySleepInfoNV(safe_VkLatencySleepInfoNV&& move_src) noexcept;
+    safe_VkLatencySleepInfoNV& operator=(safe_VkLatencySleepInfoNV&& move_src) noexcept;
     safe_VkLatencySleepInfoNV();
     ~safe_VkLatencySleepInfoNV();
     void initialize(const VkLatencySleepInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -17164,6 +19180,8 @@ struct safe_VkSetLatencyMarkerInfoNV {
                                   bool copy_pnext = true);
     safe_VkSetLatencyMarkerInfoNV(const safe_VkSetLatencyMarkerInfoNV& copy_src);
     safe_VkSetLatencyMarkerInfoNV& operator=(const safe_VkSetLatencyMarkerInfoNV& copy_src);
+    safe_VkSetLatencyMarkerInfoNV(safe_VkSetLatencyMarkerInfoNV&& move_src) noexcept;
+    safe_VkSetLatencyMarkerInfoNV& operator=(safe_VkSetLatencyMarkerInfoNV&& move_src) noexcept;
     safe_VkSetLatencyMarkerInfoNV();
     ~safe_VkSetLatencyMarkerInfoNV();
     void initialize(const VkSetLatencyMarkerInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -17193,6 +19211,8 @@ struct safe_VkLatencyTimingsFrameReportNV {
                                        bool copy_pnext = true);
     safe_VkLatencyTimingsFrameReportNV(const safe_VkLatencyTimingsFrameReportNV& copy_src);
     safe_VkLatencyTimingsFrameReportNV& operator=(const safe_VkLatencyTimingsFrameReportNV& copy_src);
+    safe_VkLatencyTimingsFrameReportNV(safe_VkLatencyTimingsFrameReportNV&& move_src) noexcept;
+    safe_VkLatencyTimingsFrameReportNV& operator=(safe_VkLatencyTimingsFrameReportNV&& move_src) noexcept;
     safe_VkLatencyTimingsFrameReportNV();
     ~safe_VkLatencyTimingsFrameReportNV();
     void initialize(const VkLatencyTimingsFrameReportNV* in_struct, PNextCopyState* copy_state = {});
@@ -17210,6 +19230,8 @@ struct safe_VkGetLatencyMarkerInfoNV {
                                   bool copy_pnext = true);
     safe_VkGetLatencyMarkerInfoNV(const safe_VkGetLatencyMarkerInfoNV& copy_src);
     safe_VkGetLatencyMarkerInfoNV& operator=(const safe_VkGetLatencyMarkerInfoNV& copy_src);
+    safe_VkGetLatencyMarkerInfoNV(safe_VkGetLatencyMarkerInfoNV&& move_src) noexcept;
+    safe_VkGetLatencyMarkerInfoNV& operator=(safe_VkGetLatencyMarkerInfoNV&& move_src) noexcept;
     safe_VkGetLatencyMarkerInfoNV();
     ~safe_VkGetLatencyMarkerInfoNV();
     void initialize(const VkGetLatencyMarkerInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -17226,6 +19248,8 @@ struct safe_VkLatencySubmissionPresentIdNV {
                                         bool copy_pnext = true);
     safe_VkLatencySubmissionPresentIdNV(const safe_VkLatencySubmissionPresentIdNV& copy_src);
     safe_VkLatencySubmissionPresentIdNV& operator=(const safe_VkLatencySubmissionPresentIdNV& copy_src);
+    safe_VkLatencySubmissionPresentIdNV(safe_VkLatencySubmissionPresentIdNV&& move_src) noexcept;
+    safe_VkLatencySubmissionPresentIdNV& operator=(safe_VkLatencySubmissionPresentIdNV&& move_src) noexcept;
     safe_VkLatencySubmissionPresentIdNV();
     ~safe_VkLatencySubmissionPresentIdNV();
     void initialize(const VkLatencySubmissionPresentIdNV* in_struct, PNextCopyState* copy_state = {});
@@ -17242,6 +19266,8 @@ struct safe_VkSwapchainLatencyCreateInfoNV {
                                         bool copy_pnext = true);
     safe_VkSwapchainLatencyCreateInfoNV(const safe_VkSwapchainLatencyCreateInfoNV& copy_src);
     safe_VkSwapchainLatencyCreateInfoNV& operator=(const safe_VkSwapchainLatencyCreateInfoNV& copy_src);
+    safe_VkSwapchainLatencyCreateInfoNV(safe_VkSwapchainLatencyCreateInfoNV&& move_src) noexcept;
+    safe_VkSwapchainLatencyCreateInfoNV& operator=(safe_VkSwapchainLatencyCreateInfoNV&& move_src) noexcept;
     safe_VkSwapchainLatencyCreateInfoNV();
     ~safe_VkSwapchainLatencyCreateInfoNV();
     void initialize(const VkSwapchainLatencyCreateInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -17258,6 +19284,8 @@ struct safe_VkOutOfBandQueueTypeInfoNV {
                                     bool copy_pnext = true);
     safe_VkOutOfBandQueueTypeInfoNV(const safe_VkOutOfBandQueueTypeInfoNV& copy_src);
     safe_VkOutOfBandQueueTypeInfoNV& operator=(const safe_VkOutOfBandQueueTypeInfoNV& copy_src);
+    safe_VkOutOfBandQueueTypeInfoNV(safe_VkOutOfBandQueueTypeInfoNV&& move_src) noexcept;
+    safe_VkOutOfBandQueueTypeInfoNV& operator=(safe_VkOutOfBandQueueTypeInfoNV&& move_src) noexcept;
     safe_VkOutOfBandQueueTypeInfoNV();
     ~safe_VkOutOfBandQueueTypeInfoNV();
     void initialize(const VkOutOfBandQueueTypeInfoNV* in_struct, PNextCopyState* copy_state = {});
@@ -17275,6 +19303,8 @@ struct safe_VkLatencySurfaceCapabilitiesNV {
                                         bool copy_pnext = true);
     safe_VkLatencySurfaceCapabilitiesNV(const safe_VkLatencySurfaceCapabilitiesNV& copy_src);
     safe_VkLatencySurfaceCapabilitiesNV& operator=(const safe_VkLatencySurfaceCapabilitiesNV& copy_src);
+    safe_VkLatencySurfaceCapabilitiesNV(safe_VkLatencySurfaceCapabilitiesNV&& move_src) noexcept;
+    safe_VkLatencySurfaceCapabilitiesNV& operator=(safe_VkLatencySurfaceCapabilitiesNV&& move_src) noexcept;
     safe_VkLatencySurfaceCapabilitiesNV();
     ~safe_VkLatencySurfaceCapabilitiesNV();
     void initialize(const VkLatencySurfaceCapabilitiesNV* in_struct, PNextCopyState* copy_state = {});
@@ -17294,6 +19324,10 @@ struct safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM {
         const safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& copy_src);
     safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& operator=(
         const safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& copy_src);
+    safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM(
+        safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& operator=(
+        safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM();
     ~safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM();
     void initialize(const VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -17317,6 +19351,10 @@ struct safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM {
         const safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& copy_src);
     safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& operator=(
         const safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& copy_src);
+    safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM(
+        safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM&& move_src) noexcept;
+    safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& operator=(
+        safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM&& move_src) noexcept;
     safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM();
     ~safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM();
     void initialize(const VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -17339,6 +19377,9 @@ struct safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV {
     safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV(const safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV& copy_src);
     safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV& operator=(
         const safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV& copy_src);
+    safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV(safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV& operator=(
+        safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV();
     ~safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV();
     void initialize(const VkPhysicalDevicePerStageDescriptorSetFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -17359,6 +19400,9 @@ struct safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM(const safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM& copy_src);
     safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM& operator=(const safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM& copy_src);
+    safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM(safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM& operator=(
+        safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM();
     ~safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM();
     void initialize(const VkPhysicalDeviceImageProcessing2FeaturesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -17380,6 +19424,9 @@ struct safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM {
     safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM(const safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM& copy_src);
     safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM& operator=(
         const safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM& copy_src);
+    safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM(safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM& operator=(
+        safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM();
     ~safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM();
     void initialize(const VkPhysicalDeviceImageProcessing2PropertiesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -17401,6 +19448,8 @@ struct safe_VkSamplerBlockMatchWindowCreateInfoQCOM {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkSamplerBlockMatchWindowCreateInfoQCOM(const safe_VkSamplerBlockMatchWindowCreateInfoQCOM& copy_src);
     safe_VkSamplerBlockMatchWindowCreateInfoQCOM& operator=(const safe_VkSamplerBlockMatchWindowCreateInfoQCOM& copy_src);
+    safe_VkSamplerBlockMatchWindowCreateInfoQCOM(safe_VkSamplerBlockMatchWindowCreateInfoQCOM&& move_src) noexcept;
+    safe_VkSamplerBlockMatchWindowCreateInfoQCOM& operator=(safe_VkSamplerBlockMatchWindowCreateInfoQCOM&& move_src) noexcept;
     safe_VkSamplerBlockMatchWindowCreateInfoQCOM();
     ~safe_VkSamplerBlockMatchWindowCreateInfoQCOM();
     void initialize(const VkSamplerBlockMatchWindowCreateInfoQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -17419,6 +19468,8 @@ struct safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM(const safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM& copy_src);
     safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM& operator=(const safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM& copy_src);
+    safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM(safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM& operator=(safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM();
     ~safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM();
     void initialize(const VkPhysicalDeviceCubicWeightsFeaturesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -17437,6 +19488,8 @@ struct safe_VkSamplerCubicWeightsCreateInfoQCOM {
                                              bool copy_pnext = true);
     safe_VkSamplerCubicWeightsCreateInfoQCOM(const safe_VkSamplerCubicWeightsCreateInfoQCOM& copy_src);
     safe_VkSamplerCubicWeightsCreateInfoQCOM& operator=(const safe_VkSamplerCubicWeightsCreateInfoQCOM& copy_src);
+    safe_VkSamplerCubicWeightsCreateInfoQCOM(safe_VkSamplerCubicWeightsCreateInfoQCOM&& move_src) noexcept;
+    safe_VkSamplerCubicWeightsCreateInfoQCOM& operator=(safe_VkSamplerCubicWeightsCreateInfoQCOM&& move_src) noexcept;
     safe_VkSamplerCubicWeightsCreateInfoQCOM();
     ~safe_VkSamplerCubicWeightsCreateInfoQCOM();
     void initialize(const VkSamplerCubicWeightsCreateInfoQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -17455,6 +19508,8 @@ struct safe_VkBlitImageCubicWeightsInfoQCOM {
                                          bool copy_pnext = true);
     safe_VkBlitImageCubicWeightsInfoQCOM(const safe_VkBlitImageCubicWeightsInfoQCOM& copy_src);
     safe_VkBlitImageCubicWeightsInfoQCOM& operator=(const safe_VkBlitImageCubicWeightsInfoQCOM& copy_src);
+    safe_VkBlitImageCubicWeightsInfoQCOM(safe_VkBlitImageCubicWeightsInfoQCOM&& move_src) noexcept;
+    safe_VkBlitImageCubicWeightsInfoQCOM& operator=(safe_VkBlitImageCubicWeightsInfoQCOM&& move_src) noexcept;
     safe_VkBlitImageCubicWeightsInfoQCOM();
     ~safe_VkBlitImageCubicWeightsInfoQCOM();
     void initialize(const VkBlitImageCubicWeightsInfoQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -17471,6 +19526,8 @@ struct safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM(const safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM& copy_src);
     safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM& operator=(const safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM& copy_src);
+    safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM(safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM& operator=(safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM();
     ~safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM();
     void initialize(const VkPhysicalDeviceYcbcrDegammaFeaturesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -17492,6 +19549,10 @@ struct safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM {
         const safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM& copy_src);
     safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM& operator=(
         const safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM& copy_src);
+    safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM(
+        safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM&& move_src) noexcept;
+    safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM& operator=(
+        safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM&& move_src) noexcept;
     safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM();
     ~safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM();
     void initialize(const VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -17512,6 +19573,8 @@ struct safe_VkPhysicalDeviceCubicClampFeaturesQCOM {
                                                 PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceCubicClampFeaturesQCOM(const safe_VkPhysicalDeviceCubicClampFeaturesQCOM& copy_src);
     safe_VkPhysicalDeviceCubicClampFeaturesQCOM& operator=(const safe_VkPhysicalDeviceCubicClampFeaturesQCOM& copy_src);
+    safe_VkPhysicalDeviceCubicClampFeaturesQCOM(safe_VkPhysicalDeviceCubicClampFeaturesQCOM&& move_src) noexcept;
+    safe_VkPhysicalDeviceCubicClampFeaturesQCOM& operator=(safe_VkPhysicalDeviceCubicClampFeaturesQCOM&& move_src) noexcept;
     safe_VkPhysicalDeviceCubicClampFeaturesQCOM();
     ~safe_VkPhysicalDeviceCubicClampFeaturesQCOM();
     void initialize(const VkPhysicalDeviceCubicClampFeaturesQCOM* in_struct, PNextCopyState* copy_state = {});
@@ -17533,6 +19596,10 @@ struct safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT {
         const safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& operator=(
         const safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT(
+        safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& operator=(
+        safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT();
     ~safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT();
     void initialize(const VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT* in_struct,
@@ -17557,6 +19624,8 @@ struct safe_VkScreenBufferPropertiesQNX {
                                      bool copy_pnext = true);
     safe_VkScreenBufferPropertiesQNX(const safe_VkScreenBufferPropertiesQNX& copy_src);
     safe_VkScreenBufferPropertiesQNX& operator=(const safe_VkScreenBufferPropertiesQNX& copy_src);
+    safe_VkScreenBufferPropertiesQNX(safe_VkScreenBufferPropertiesQNX&& move_src) noexcept;
+    safe_VkScreenBufferPropertiesQNX& operator=(safe_VkScreenBufferPropertiesQNX&& move_src) noexcept;
     safe_VkScreenBufferPropertiesQNX();
     ~safe_VkScreenBufferPropertiesQNX();
     void initialize(const VkScreenBufferPropertiesQNX* in_struct, PNextCopyState* copy_state = {});
@@ -17581,6 +19650,8 @@ struct safe_VkScreenBufferFormatPropertiesQNX {
                                            bool copy_pnext = true);
     safe_VkScreenBufferFormatPropertiesQNX(const safe_VkScreenBufferFormatPropertiesQNX& copy_src);
     safe_VkScreenBufferFormatPropertiesQNX& operator=(const safe_VkScreenBufferFormatPropertiesQNX& copy_src);
+    safe_VkScreenBufferFormatPropertiesQNX(safe_VkScreenBufferFormatPropertiesQNX&& move_src) noexcept;
+    safe_VkScreenBufferFormatPropertiesQNX& operator=(safe_VkScreenBufferFormatPropertiesQNX&& move_src) noexcept;
     safe_VkScreenBufferFormatPropertiesQNX();
     ~safe_VkScreenBufferFormatPropertiesQNX();
     void initialize(const VkScreenBufferFormatPropertiesQNX* in_struct, PNextCopyState* copy_state = {});
@@ -17599,6 +19670,8 @@ struct safe_VkImportScreenBufferInfoQNX {
                                      bool copy_pnext = true);
     safe_VkImportScreenBufferInfoQNX(const safe_VkImportScreenBufferInfoQNX& copy_src);
     safe_VkImportScreenBufferInfoQNX& operator=(const safe_VkImportScreenBufferInfoQNX& copy_src);
+    safe_VkImportScreenBufferInfoQNX(safe_VkImportScreenBufferInfoQNX&& move_src) noexcept;
+    safe_VkImportScreenBufferInfoQNX& operator=(safe_VkImportScreenBufferInfoQNX&& move_src) noexcept;
     safe_VkImportScreenBufferInfoQNX();
     ~safe_VkImportScreenBufferInfoQNX();
     void initialize(const VkImportScreenBufferInfoQNX* in_struct, PNextCopyState* copy_state = {});
@@ -17614,6 +19687,8 @@ struct safe_VkExternalFormatQNX {
     safe_VkExternalFormatQNX(const VkExternalFormatQNX* in_struct, PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkExternalFormatQNX(const safe_VkExternalFormatQNX& copy_src);
     safe_VkExternalFormatQNX& operator=(const safe_VkExternalFormatQNX& copy_src);
+    safe_VkExternalFormatQNX(safe_VkExternalFormatQNX&& move_src) noexcept;
+    safe_VkExternalFormatQNX& operator=(safe_VkExternalFormatQNX&& move_src) noexcept;
     safe_VkExternalFormatQNX();
     ~safe_VkExternalFormatQNX();
     void initialize(const VkExternalFormatQNX* in_struct, PNextCopyState* copy_state = {});
@@ -17633,6 +19708,10 @@ struct safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX {
         const safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX& copy_src);
     safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX& operator=(
         const safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX& copy_src);
+    safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX(
+        safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX&& move_src) noexcept;
+    safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX& operator=(
+        safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX&& move_src) noexcept;
     safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX();
     ~safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX();
     void initialize(const VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX* in_struct, PNextCopyState* copy_state = {});
@@ -17654,6 +19733,9 @@ struct safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT(const safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT& copy_src);
     safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT& operator=(const safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT& copy_src);
+    safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT(safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT&& move_src) noexcept;
+    safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT& operator=(
+        safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT&& move_src) noexcept;
     safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT();
     ~safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT();
     void initialize(const VkPhysicalDeviceLayeredDriverPropertiesMSFT* in_struct, PNextCopyState* copy_state = {});
@@ -17677,6 +19759,10 @@ struct safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV {
         const safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV& copy_src);
     safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV& operator=(
         const safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV& copy_src);
+    safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV(
+        safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV&& move_src) noexcept;
+    safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV& operator=(
+        safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV&& move_src) noexcept;
     safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV();
     ~safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV();
     void initialize(const VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV* in_struct, PNextCopyState* copy_state = {});
@@ -17704,6 +19790,9 @@ struct safe_VkAccelerationStructureGeometryTrianglesDataKHR {
     safe_VkAccelerationStructureGeometryTrianglesDataKHR(const safe_VkAccelerationStructureGeometryTrianglesDataKHR& copy_src);
     safe_VkAccelerationStructureGeometryTrianglesDataKHR& operator=(
         const safe_VkAccelerationStructureGeometryTrianglesDataKHR& copy_src);
+    safe_VkAccelerationStructureGeometryTrianglesDataKHR(safe_VkAccelerationStructureGeometryTrianglesDataKHR&& move_src) noexcept;
+    safe_VkAccelerationStructureGeometryTrianglesDataKHR& operator=(
+        safe_VkAccelerationStructureGeometryTrianglesDataKHR&& move_src) noexcept;
     safe_VkAccelerationStructureGeometryTrianglesDataKHR();
     ~safe_VkAccelerationStructureGeometryTrianglesDataKHR();
     void initialize(const VkAccelerationStructureGeometryTrianglesDataKHR* in_struct, PNextCopyState* copy_state = {});
@@ -17725,6 +19814,9 @@ struct safe_VkAccelerationStructureGeometryAabbsDataKHR {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkAccelerationStructureGeometryAabbsDataKHR(const safe_VkAccelerationStructureGeometryAabbsDataKHR& copy_src);
     safe_VkAccelerationStructureGeometryAabbsDataKHR& operator=(const safe_VkAccelerationStructureGeometryAabbsDataKHR& copy_src);
+    safe_VkAccelerationStructureGeometryAabbsDataKHR(safe_VkAccelerationStructureGeometryAabbsDataKHR&& move_src) noexcept;
+    safe_VkAccelerationStructureGeometryAabbsDataKHR& operator=(
+        safe_VkAccelerationStructureGeometryAabbsDataKHR&& move_src) noexcept;
     safe_VkAccelerationStructureGeometryAabbsDataKHR();
     ~safe_VkAccelerationStructureGeometryAabbsDataKHR();
     void initialize(const VkAccelerationStructureGeometryAabbsDataKHR* in_struct, PNextCopyState* copy_state = {});
@@ -17747,6 +19839,9 @@ struct safe_VkAccelerationStructureGeometryInstancesDataKHR {
     safe_VkAccelerationStructureGeometryInstancesDataKHR(const safe_VkAccelerationStructureGeometryInstancesDataKHR& copy_src);
     safe_VkAccelerationStructureGeometryInstancesDataKHR& operator=(
         const safe_VkAccelerationStructureGeometryInstancesDataKHR& copy_src);
+    safe_VkAccelerationStructureGeometryInstancesDataKHR(safe_VkAccelerationStructureGeometryInstancesDataKHR&& move_src) noexcept;
+    safe_VkAccelerationStructureGeometryInstancesDataKHR& operator=(
+        safe_VkAccelerationStructureGeometryInstancesDataKHR&& move_src) noexcept;
     safe_VkAccelerationStructureGeometryInstancesDataKHR();
     ~safe_VkAccelerationStructureGeometryInstancesDataKHR();
     void initialize(const VkAccelerationStructureGeometryInstancesDataKHR* in_struct, PNextCopyState* copy_state = {});
@@ -17799,6 +19894,9 @@ struct safe_VkAccelerationStructureBuildGeometryInfoKHR {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkAccelerationStructureBuildGeometryInfoKHR(const safe_VkAccelerationStructureBuildGeometryInfoKHR& copy_src);
     safe_VkAccelerationStructureBuildGeometryInfoKHR& operator=(const safe_VkAccelerationStructureBuildGeometryInfoKHR& copy_src);
+    safe_VkAccelerationStructureBuildGeometryInfoKHR(safe_VkAccelerationStructureBuildGeometryInfoKHR&& move_src) noexcept;
+    safe_VkAccelerationStructureBuildGeometryInfoKHR& operator=(
+        safe_VkAccelerationStructureBuildGeometryInfoKHR&& move_src) noexcept;
     safe_VkAccelerationStructureBuildGeometryInfoKHR();
     ~safe_VkAccelerationStructureBuildGeometryInfoKHR();
     void initialize(const VkAccelerationStructureBuildGeometryInfoKHR* in_struct, const bool is_host,
@@ -17825,6 +19923,8 @@ struct safe_VkAccelerationStructureCreateInfoKHR {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkAccelerationStructureCreateInfoKHR(const safe_VkAccelerationStructureCreateInfoKHR& copy_src);
     safe_VkAccelerationStructureCreateInfoKHR& operator=(const safe_VkAccelerationStructureCreateInfoKHR& copy_src);
+    safe_VkAccelerationStructureCreateInfoKHR(safe_VkAccelerationStructureCreateInfoKHR&& move_src) noexcept;
+    safe_VkAccelerationStructureCreateInfoKHR& operator=(safe_VkAccelerationStructureCreateInfoKHR&& move_src) noexcept;
     safe_VkAccelerationStructureCreateInfoKHR();
     ~safe_VkAccelerationStructureCreateInfoKHR();
     void initialize(const VkAccelerationStructureCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -17844,6 +19944,9 @@ struct safe_VkWriteDescriptorSetAccelerationStructureKHR {
                                                       PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkWriteDescriptorSetAccelerationStructureKHR(const safe_VkWriteDescriptorSetAccelerationStructureKHR& copy_src);
     safe_VkWriteDescriptorSetAccelerationStructureKHR& operator=(const safe_VkWriteDescriptorSetAccelerationStructureKHR& copy_src);
+    safe_VkWriteDescriptorSetAccelerationStructureKHR(safe_VkWriteDescriptorSetAccelerationStructureKHR&& move_src) noexcept;
+    safe_VkWriteDescriptorSetAccelerationStructureKHR& operator=(
+        safe_VkWriteDescriptorSetAccelerationStructureKHR&& move_src) noexcept;
     safe_VkWriteDescriptorSetAccelerationStructureKHR();
     ~safe_VkWriteDescriptorSetAccelerationStructureKHR();
     void initialize(const VkWriteDescriptorSetAccelerationStructureKHR* in_struct, PNextCopyState* copy_state = {});
@@ -17869,6 +19972,10 @@ struct safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR {
     safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR(const safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR& operator=(
         const safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR(
+        safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR& operator=(
+        safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR();
     ~safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR();
     void initialize(const VkPhysicalDeviceAccelerationStructureFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -17898,6 +20005,10 @@ struct safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR {
         const safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR& copy_src);
     safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR& operator=(
         const safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR& copy_src);
+    safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR(
+        safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR& operator=(
+        safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR();
     ~safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR();
     void initialize(const VkPhysicalDeviceAccelerationStructurePropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -17918,6 +20029,9 @@ struct safe_VkAccelerationStructureDeviceAddressInfoKHR {
                                                      PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkAccelerationStructureDeviceAddressInfoKHR(const safe_VkAccelerationStructureDeviceAddressInfoKHR& copy_src);
     safe_VkAccelerationStructureDeviceAddressInfoKHR& operator=(const safe_VkAccelerationStructureDeviceAddressInfoKHR& copy_src);
+    safe_VkAccelerationStructureDeviceAddressInfoKHR(safe_VkAccelerationStructureDeviceAddressInfoKHR&& move_src) noexcept;
+    safe_VkAccelerationStructureDeviceAddressInfoKHR& operator=(
+        safe_VkAccelerationStructureDeviceAddressInfoKHR&& move_src) noexcept;
     safe_VkAccelerationStructureDeviceAddressInfoKHR();
     ~safe_VkAccelerationStructureDeviceAddressInfoKHR();
     void initialize(const VkAccelerationStructureDeviceAddressInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -17938,6 +20052,8 @@ struct safe_VkAccelerationStructureVersionInfoKHR {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkAccelerationStructureVersionInfoKHR(const safe_VkAccelerationStructureVersionInfoKHR& copy_src);
     safe_VkAccelerationStructureVersionInfoKHR& operator=(const safe_VkAccelerationStructureVersionInfoKHR& copy_src);
+    safe_VkAccelerationStructureVersionInfoKHR(safe_VkAccelerationStructureVersionInfoKHR&& move_src) noexcept;
+    safe_VkAccelerationStructureVersionInfoKHR& operator=(safe_VkAccelerationStructureVersionInfoKHR&& move_src) noexcept;
     safe_VkAccelerationStructureVersionInfoKHR();
     ~safe_VkAccelerationStructureVersionInfoKHR();
     void initialize(const VkAccelerationStructureVersionInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -17958,6 +20074,8 @@ struct safe_VkCopyAccelerationStructureToMemoryInfoKHR {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCopyAccelerationStructureToMemoryInfoKHR(const safe_VkCopyAccelerationStructureToMemoryInfoKHR& copy_src);
     safe_VkCopyAccelerationStructureToMemoryInfoKHR& operator=(const safe_VkCopyAccelerationStructureToMemoryInfoKHR& copy_src);
+    safe_VkCopyAccelerationStructureToMemoryInfoKHR(safe_VkCopyAccelerationStructureToMemoryInfoKHR&& move_src) noexcept;
+    safe_VkCopyAccelerationStructureToMemoryInfoKHR& operator=(safe_VkCopyAccelerationStructureToMemoryInfoKHR&& move_src) noexcept;
     safe_VkCopyAccelerationStructureToMemoryInfoKHR();
     ~safe_VkCopyAccelerationStructureToMemoryInfoKHR();
     void initialize(const VkCopyAccelerationStructureToMemoryInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -17980,6 +20098,8 @@ struct safe_VkCopyMemoryToAccelerationStructureInfoKHR {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkCopyMemoryToAccelerationStructureInfoKHR(const safe_VkCopyMemoryToAccelerationStructureInfoKHR& copy_src);
     safe_VkCopyMemoryToAccelerationStructureInfoKHR& operator=(const safe_VkCopyMemoryToAccelerationStructureInfoKHR& copy_src);
+    safe_VkCopyMemoryToAccelerationStructureInfoKHR(safe_VkCopyMemoryToAccelerationStructureInfoKHR&& move_src) noexcept;
+    safe_VkCopyMemoryToAccelerationStructureInfoKHR& operator=(safe_VkCopyMemoryToAccelerationStructureInfoKHR&& move_src) noexcept;
     safe_VkCopyMemoryToAccelerationStructureInfoKHR();
     ~safe_VkCopyMemoryToAccelerationStructureInfoKHR();
     void initialize(const VkCopyMemoryToAccelerationStructureInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -18002,6 +20122,8 @@ struct safe_VkCopyAccelerationStructureInfoKHR {
                                             bool copy_pnext = true);
     safe_VkCopyAccelerationStructureInfoKHR(const safe_VkCopyAccelerationStructureInfoKHR& copy_src);
     safe_VkCopyAccelerationStructureInfoKHR& operator=(const safe_VkCopyAccelerationStructureInfoKHR& copy_src);
+    safe_VkCopyAccelerationStructureInfoKHR(safe_VkCopyAccelerationStructureInfoKHR&& move_src) noexcept;
+    safe_VkCopyAccelerationStructureInfoKHR& operator=(safe_VkCopyAccelerationStructureInfoKHR&& move_src) noexcept;
     safe_VkCopyAccelerationStructureInfoKHR();
     ~safe_VkCopyAccelerationStructureInfoKHR();
     void initialize(const VkCopyAccelerationStructureInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -18022,6 +20144,8 @@ struct safe_VkAccelerationStructureBuildSizesInfoKHR {
                                                   PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkAccelerationStructureBuildSizesInfoKHR(const safe_VkAccelerationStructureBuildSizesInfoKHR& copy_src);
     safe_VkAccelerationStructureBuildSizesInfoKHR& operator=(const safe_VkAccelerationStructureBuildSizesInfoKHR& copy_src);
+    safe_VkAccelerationStructureBuildSizesInfoKHR(safe_VkAccelerationStructureBuildSizesInfoKHR&& move_src) noexcept;
+    safe_VkAccelerationStructureBuildSizesInfoKHR& operator=(safe_VkAccelerationStructureBuildSizesInfoKHR&& move_src) noexcept;
     safe_VkAccelerationStructureBuildSizesInfoKHR();
     ~safe_VkAccelerationStructureBuildSizesInfoKHR();
     void initialize(const VkAccelerationStructureBuildSizesInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -18045,6 +20169,8 @@ struct safe_VkRayTracingShaderGroupCreateInfoKHR {
                                               PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRayTracingShaderGroupCreateInfoKHR(const safe_VkRayTracingShaderGroupCreateInfoKHR& copy_src);
     safe_VkRayTracingShaderGroupCreateInfoKHR& operator=(const safe_VkRayTracingShaderGroupCreateInfoKHR& copy_src);
+    safe_VkRayTracingShaderGroupCreateInfoKHR(safe_VkRayTracingShaderGroupCreateInfoKHR&& move_src) noexcept;
+    safe_VkRayTracingShaderGroupCreateInfoKHR& operator=(safe_VkRayTracingShaderGroupCreateInfoKHR&& move_src) noexcept;
     safe_VkRayTracingShaderGroupCreateInfoKHR();
     ~safe_VkRayTracingShaderGroupCreateInfoKHR();
     void initialize(const VkRayTracingShaderGroupCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -18064,6 +20190,8 @@ struct safe_VkRayTracingPipelineInterfaceCreateInfoKHR {
                                                     PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkRayTracingPipelineInterfaceCreateInfoKHR(const safe_VkRayTracingPipelineInterfaceCreateInfoKHR& copy_src);
     safe_VkRayTracingPipelineInterfaceCreateInfoKHR& operator=(const safe_VkRayTracingPipelineInterfaceCreateInfoKHR& copy_src);
+    safe_VkRayTracingPipelineInterfaceCreateInfoKHR(safe_VkRayTracingPipelineInterfaceCreateInfoKHR&& move_src) noexcept;
+    safe_VkRayTracingPipelineInterfaceCreateInfoKHR& operator=(safe_VkRayTracingPipelineInterfaceCreateInfoKHR&& move_src) noexcept;
     safe_VkRayTracingPipelineInterfaceCreateInfoKHR();
     ~safe_VkRayTracingPipelineInterfaceCreateInfoKHR();
     void initialize(const VkRayTracingPipelineInterfaceCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -18095,6 +20223,8 @@ struct safe_VkRayTracingPipelineCreateInfoKHR {
                                            bool copy_pnext = true);
     safe_VkRayTracingPipelineCreateInfoKHR(const safe_VkRayTracingPipelineCreateInfoKHR& copy_src);
     safe_VkRayTracingPipelineCreateInfoKHR& operator=(const safe_VkRayTracingPipelineCreateInfoKHR& copy_src);
+    safe_VkRayTracingPipelineCreateInfoKHR(safe_VkRayTracingPipelineCreateInfoKHR&& move_src) noexcept;
+    safe_VkRayTracingPipelineCreateInfoKHR& operator=(safe_VkRayTracingPipelineCreateInfoKHR&& move_src) noexcept;
     safe_VkRayTracingPipelineCreateInfoKHR();
     ~safe_VkRayTracingPipelineCreateInfoKHR();
     void initialize(const VkRayTracingPipelineCreateInfoKHR* in_struct, PNextCopyState* copy_state = {});
@@ -18118,6 +20248,9 @@ struct safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR {
     safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR(const safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR& operator=(
         const safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR(safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR& operator=(
+        safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR();
     ~safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR();
     void initialize(const VkPhysicalDeviceRayTracingPipelineFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -18146,6 +20279,9 @@ struct safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR {
     safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR(const safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR& copy_src);
     safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR& operator=(
         const safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR& copy_src);
+    safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR(safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR& operator=(
+        safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR();
     ~safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR();
     void initialize(const VkPhysicalDeviceRayTracingPipelinePropertiesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -18166,6 +20302,8 @@ struct safe_VkPhysicalDeviceRayQueryFeaturesKHR {
                                              bool copy_pnext = true);
     safe_VkPhysicalDeviceRayQueryFeaturesKHR(const safe_VkPhysicalDeviceRayQueryFeaturesKHR& copy_src);
     safe_VkPhysicalDeviceRayQueryFeaturesKHR& operator=(const safe_VkPhysicalDeviceRayQueryFeaturesKHR& copy_src);
+    safe_VkPhysicalDeviceRayQueryFeaturesKHR(safe_VkPhysicalDeviceRayQueryFeaturesKHR&& move_src) noexcept;
+    safe_VkPhysicalDeviceRayQueryFeaturesKHR& operator=(safe_VkPhysicalDeviceRayQueryFeaturesKHR&& move_src) noexcept;
     safe_VkPhysicalDeviceRayQueryFeaturesKHR();
     ~safe_VkPhysicalDeviceRayQueryFeaturesKHR();
     void initialize(const VkPhysicalDeviceRayQueryFeaturesKHR* in_struct, PNextCopyState* copy_state = {});
@@ -18188,6 +20326,8 @@ struct safe_VkPhysicalDeviceMeshShaderFeaturesEXT {
                                                PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMeshShaderFeaturesEXT(const safe_VkPhysicalDeviceMeshShaderFeaturesEXT& copy_src);
     safe_VkPhysicalDeviceMeshShaderFeaturesEXT& operator=(const safe_VkPhysicalDeviceMeshShaderFeaturesEXT& copy_src);
+    safe_VkPhysicalDeviceMeshShaderFeaturesEXT(safe_VkPhysicalDeviceMeshShaderFeaturesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceMeshShaderFeaturesEXT& operator=(safe_VkPhysicalDeviceMeshShaderFeaturesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceMeshShaderFeaturesEXT();
     ~safe_VkPhysicalDeviceMeshShaderFeaturesEXT();
     void initialize(const VkPhysicalDeviceMeshShaderFeaturesEXT* in_struct, PNextCopyState* copy_state = {});
@@ -18233,6 +20373,8 @@ struct safe_VkPhysicalDeviceMeshShaderPropertiesEXT {
                                                  PNextCopyState* copy_state = {}, bool copy_pnext = true);
     safe_VkPhysicalDeviceMeshShaderPropertiesEXT(const safe_VkPhysicalDeviceMeshShaderPropertiesEXT& copy_src);
     safe_VkPhysicalDeviceMeshShaderPropertiesEXT& operator=(const safe_VkPhysicalDeviceMeshShaderPropertiesEXT& copy_src);
+    safe_VkPhysicalDeviceMeshShaderPropertiesEXT(safe_VkPhysicalDeviceMeshShaderPropertiesEXT&& move_src) noexcept;
+    safe_VkPhysicalDeviceMeshShaderPropertiesEXT& operator=(safe_VkPhysicalDeviceMeshShaderPropertiesEXT&& move_src) noexcept;
     safe_VkPhysicalDeviceMeshShaderPropertiesEXT();
     ~safe_VkPhysicalDeviceMeshShaderPropertiesEXT();
     void initialize(const VkPhysicalDeviceMeshShaderPropertiesEXT* in_struct, PNextCopyState* copy_state = {});
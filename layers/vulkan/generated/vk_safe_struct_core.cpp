@@ -90,6 +90,27 @@ safe_VkBufferMemoryBarrier& safe_VkBufferMemoryBarrier::operator=(const safe_VkB
     return *this;
 }
 
+safe_VkBufferMemoryBarrier::safe_VkBufferMemoryBarrier(safe_VkBufferMemoryBarrier&& move_src) noexcept
+    : safe_VkBufferMemoryBarrier() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferMemoryBarrier& safe_VkBufferMemoryBarrier::operator=(safe_VkBufferMemoryBarrier&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcAccessMask, move_src.srcAccessMask);
+    std::swap(dstAccessMask, move_src.dstAccessMask);
+    std::swap(srcQueueFamilyIndex, move_src.srcQueueFamilyIndex);
+    std::swap(dstQueueFamilyIndex, move_src.dstQueueFamilyIndex);
+    std::swap(buffer, move_src.buffer);
+    std::swap(offset, move_src.offset);
+    std::swap(size, move_src.size);
+
+    return *this;
+}
+
 safe_VkBufferMemoryBarrier::~safe_VkBufferMemoryBarrier() { FreePnextChain(pNext); }
 
 void safe_VkBufferMemoryBarrier::initialize(const VkBufferMemoryBarrier* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -178,6 +199,27 @@ safe_VkImageMemoryBarrier& safe_VkImageMemoryBarrier::operator=(const safe_VkIma
     return *this;
 }
 
+safe_VkImageMemoryBarrier::safe_VkImageMemoryBarrier(safe_VkImageMemoryBarrier&& move_src) noexcept : safe_VkImageMemoryBarrier() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageMemoryBarrier& safe_VkImageMemoryBarrier::operator=(safe_VkImageMemoryBarrier&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcAccessMask, move_src.srcAccessMask);
+    std::swap(dstAccessMask, move_src.dstAccessMask);
+    std::swap(oldLayout, move_src.oldLayout);
+    std::swap(newLayout, move_src.newLayout);
+    std::swap(srcQueueFamilyIndex, move_src.srcQueueFamilyIndex);
+    std::swap(dstQueueFamilyIndex, move_src.dstQueueFamilyIndex);
+    std::swap(image, move_src.image);
+    std::swap(subresourceRange, move_src.subresourceRange);
+
+    return *this;
+}
+
 safe_VkImageMemoryBarrier::~safe_VkImageMemoryBarrier() { FreePnextChain(pNext); }
 
 void safe_VkImageMemoryBarrier::initialize(const VkImageMemoryBarrier* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -238,6 +280,21 @@ safe_VkMemoryBarrier& safe_VkMemoryBarrier::operator=(const safe_VkMemoryBarrier
     return *this;
 }
 
+safe_VkMemoryBarrier::safe_VkMemoryBarrier(safe_VkMemoryBarrier&& move_src) noexcept : safe_VkMemoryBarrier() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryBarrier& safe_VkMemoryBarrier::operator=(safe_VkMemoryBarrier&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcAccessMask, move_src.srcAccessMask);
+    std::swap(dstAccessMask, move_src.dstAccessMask);
+
+    return *this;
+}
+
 safe_VkMemoryBarrier::~safe_VkMemoryBarrier() { FreePnextChain(pNext); }
 
 void safe_VkMemoryBarrier::initialize(const VkMemoryBarrier* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -289,6 +346,24 @@ safe_VkAllocationCallbacks& safe_VkAllocationCallbacks::operator=(const safe_VkA
     return *this;
 }
 
+safe_VkAllocationCallbacks::safe_VkAllocationCallbacks(safe_VkAllocationCallbacks&& move_src) noexcept
+    : safe_VkAllocationCallbacks() {
+    *this = std::move(move_src);
+}
+
+safe_VkAllocationCallbacks& safe_VkAllocationCallbacks::operator=(safe_VkAllocationCallbacks&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(pUserData, move_src.pUserData);
+    std::swap(pfnAllocation, move_src.pfnAllocation);
+    std::swap(pfnReallocation, move_src.pfnReallocation);
+    std::swap(pfnFree, move_src.pfnFree);
+    std::swap(pfnInternalAllocation, move_src.pfnInternalAllocation);
+    std::swap(pfnInternalFree, move_src.pfnInternalFree);
+
+    return *this;
+}
+
 safe_VkAllocationCallbacks::~safe_VkAllocationCallbacks() {}
 
 void safe_VkAllocationCallbacks::initialize(const VkAllocationCallbacks* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -360,6 +435,24 @@ safe_VkApplicationInfo& safe_VkApplicationInfo::operator=(const safe_VkApplicati
     return *this;
 }
 
+safe_VkApplicationInfo::safe_VkApplicationInfo(safe_VkApplicationInfo&& move_src) noexcept : safe_VkApplicationInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkApplicationInfo& safe_VkApplicationInfo::operator=(safe_VkApplicationInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pApplicationName, move_src.pApplicationName);
+    std::swap(applicationVersion, move_src.applicationVersion);
+    std::swap(pEngineName, move_src.pEngineName);
+    std::swap(engineVersion, move_src.engineVersion);
+    std::swap(apiVersion, move_src.apiVersion);
+
+    return *this;
+}
+
 safe_VkApplicationInfo::~safe_VkApplicationInfo() {
     if (pApplicationName) delete[] pApplicationName;
     if (pEngineName) delete[] pEngineName;
@@ -484,6 +577,25 @@ safe_VkInstanceCreateInfo& safe_VkInstanceCreateInfo::operator=(const safe_VkIns
     return *this;
 }
 
+safe_VkInstanceCreateInfo::safe_VkInstanceCreateInfo(safe_VkInstanceCreateInfo&& move_src) noexcept : safe_VkInstanceCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkInstanceCreateInfo& safe_VkInstanceCreateInfo::operator=(safe_VkInstanceCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(pApplicationInfo, move_src.pApplicationInfo);
+    std::swap(enabledLayerCount, move_src.enabledLayerCount);
+    std::swap(ppEnabledLayerNames, move_src.ppEnabledLayerNames);
+    std::swap(enabledExtensionCount, move_src.enabledExtensionCount);
+    std::swap(ppEnabledExtensionNames, move_src.ppEnabledExtensionNames);
+
+    return *this;
+}
+
 safe_VkInstanceCreateInfo::~safe_VkInstanceCreateInfo() {
     if (pApplicationInfo) delete pApplicationInfo;
 
@@ -618,6 +730,24 @@ safe_VkDeviceQueueCreateInfo& safe_VkDeviceQueueCreateInfo::operator=(const safe
     return *this;
 }
 
+safe_VkDeviceQueueCreateInfo::safe_VkDeviceQueueCreateInfo(safe_VkDeviceQueueCreateInfo&& move_src) noexcept
+    : safe_VkDeviceQueueCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceQueueCreateInfo& safe_VkDeviceQueueCreateInfo::operator=(safe_VkDeviceQueueCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(queueFamilyIndex, move_src.queueFamilyIndex);
+    std::swap(queueCount, move_src.queueCount);
+    std::swap(pQueuePriorities, move_src.pQueuePriorities);
+
+    return *this;
+}
+
 safe_VkDeviceQueueCreateInfo::~safe_VkDeviceQueueCreateInfo() {
     if (pQueuePriorities) delete[] pQueuePriorities;
     FreePnextChain(pNext);
@@ -786,6 +916,27 @@ safe_VkDeviceCreateInfo& safe_VkDeviceCreateInfo::operator=(const safe_VkDeviceC
     return *this;
 }
 
+safe_VkDeviceCreateInfo::safe_VkDeviceCreateInfo(safe_VkDeviceCreateInfo&& move_src) noexcept : safe_VkDeviceCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceCreateInfo& safe_VkDeviceCreateInfo::operator=(safe_VkDeviceCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(queueCreateInfoCount, move_src.queueCreateInfoCount);
+    std::swap(pQueueCreateInfos, move_src.pQueueCreateInfos);
+    std::swap(enabledLayerCount, move_src.enabledLayerCount);
+    std::swap(ppEnabledLayerNames, move_src.ppEnabledLayerNames);
+    std::swap(enabledExtensionCount, move_src.enabledExtensionCount);
+    std::swap(ppEnabledExtensionNames, move_src.ppEnabledExtensionNames);
+    std::swap(pEnabledFeatures, move_src.pEnabledFeatures);
+
+    return *this;
+}
+
 safe_VkDeviceCreateInfo::~safe_VkDeviceCreateInfo() {
     if (pQueueCreateInfos) delete[] pQueueCreateInfos;
 
@@ -1013,6 +1164,26 @@ safe_VkSubmitInfo& safe_VkSubmitInfo::operator=(const safe_VkSubmitInfo& copy_sr
     return *this;
 }
 
+safe_VkSubmitInfo::safe_VkSubmitInfo(safe_VkSubmitInfo&& move_src) noexcept : safe_VkSubmitInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubmitInfo& safe_VkSubmitInfo::operator=(safe_VkSubmitInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(waitSemaphoreCount, move_src.waitSemaphoreCount);
+    std::swap(pWaitSemaphores, move_src.pWaitSemaphores);
+    std::swap(pWaitDstStageMask, move_src.pWaitDstStageMask);
+    std::swap(commandBufferCount, move_src.commandBufferCount);
+    std::swap(pCommandBuffers, move_src.pCommandBuffers);
+    std::swap(signalSemaphoreCount, move_src.signalSemaphoreCount);
+    std::swap(pSignalSemaphores, move_src.pSignalSemaphores);
+
+    return *this;
+}
+
 safe_VkSubmitInfo::~safe_VkSubmitInfo() {
     if (pWaitSemaphores) delete[] pWaitSemaphores;
     if (pWaitDstStageMask) delete[] pWaitDstStageMask;
@@ -1129,6 +1300,22 @@ safe_VkMappedMemoryRange& safe_VkMappedMemoryRange::operator=(const safe_VkMappe
     return *this;
 }
 
+safe_VkMappedMemoryRange::safe_VkMappedMemoryRange(safe_VkMappedMemoryRange&& move_src) noexcept : safe_VkMappedMemoryRange() {
+    *this = std::move(move_src);
+}
+
+safe_VkMappedMemoryRange& safe_VkMappedMemoryRange::operator=(safe_VkMappedMemoryRange&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memory, move_src.memory);
+    std::swap(offset, move_src.offset);
+    std::swap(size, move_src.size);
+
+    return *this;
+}
+
 safe_VkMappedMemoryRange::~safe_VkMappedMemoryRange() { FreePnextChain(pNext); }
 
 void safe_VkMappedMemoryRange::initialize(const VkMappedMemoryRange* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -1179,6 +1366,21 @@ safe_VkMemoryAllocateInfo& safe_VkMemoryAllocateInfo::operator=(const safe_VkMem
     return *this;
 }
 
+safe_VkMemoryAllocateInfo::safe_VkMemoryAllocateInfo(safe_VkMemoryAllocateInfo&& move_src) noexcept : safe_VkMemoryAllocateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryAllocateInfo& safe_VkMemoryAllocateInfo::operator=(safe_VkMemoryAllocateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(allocationSize, move_src.allocationSize);
+    std::swap(memoryTypeIndex, move_src.memoryTypeIndex);
+
+    return *this;
+}
+
 safe_VkMemoryAllocateInfo::~safe_VkMemoryAllocateInfo() { FreePnextChain(pNext); }
 
 void safe_VkMemoryAllocateInfo::initialize(const VkMemoryAllocateInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -1239,6 +1441,22 @@ safe_VkSparseBufferMemoryBindInfo& safe_VkSparseBufferMemoryBindInfo::operator=(
     return *this;
 }
 
+safe_VkSparseBufferMemoryBindInfo::safe_VkSparseBufferMemoryBindInfo(safe_VkSparseBufferMemoryBindInfo&& move_src) noexcept
+    : safe_VkSparseBufferMemoryBindInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSparseBufferMemoryBindInfo& safe_VkSparseBufferMemoryBindInfo::operator=(
+    safe_VkSparseBufferMemoryBindInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(buffer, move_src.buffer);
+    std::swap(bindCount, move_src.bindCount);
+    std::swap(pBinds, move_src.pBinds);
+
+    return *this;
+}
+
 safe_VkSparseBufferMemoryBindInfo::~safe_VkSparseBufferMemoryBindInfo() {
     if (pBinds) delete[] pBinds;
 }
@@ -1315,6 +1533,23 @@ safe_VkSparseImageOpaqueMemoryBindInfo& safe_VkSparseImageOpaqueMemoryBindInfo::
     return *this;
 }
 
+safe_VkSparseImageOpaqueMemoryBindInfo::safe_VkSparseImageOpaqueMemoryBindInfo(
+    safe_VkSparseImageOpaqueMemoryBindInfo&& move_src) noexcept
+    : safe_VkSparseImageOpaqueMemoryBindInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSparseImageOpaqueMemoryBindInfo& safe_VkSparseImageOpaqueMemoryBindInfo::operator=(
+    safe_VkSparseImageOpaqueMemoryBindInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(image, move_src.image);
+    std::swap(bindCount, move_src.bindCount);
+    std::swap(pBinds, move_src.pBinds);
+
+    return *this;
+}
+
 safe_VkSparseImageOpaqueMemoryBindInfo::~safe_VkSparseImageOpaqueMemoryBindInfo() {
     if (pBinds) delete[] pBinds;
 }
@@ -1389,6 +1624,22 @@ safe_VkSparseImageMemoryBindInfo& safe_VkSparseImageMemoryBindInfo::operator=(co
     return *this;
 }
 
+safe_VkSparseImageMemoryBindInfo::safe_VkSparseImageMemoryBindInfo(safe_VkSparseImageMemoryBindInfo&& move_src) noexcept
+    : safe_VkSparseImageMemoryBindInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSparseImageMemoryBindInfo& safe_VkSparseImageMemoryBindInfo::operator=(
+    safe_VkSparseImageMemoryBindInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(image, move_src.image);
+    std::swap(bindCount, move_src.bindCount);
+    std::swap(pBinds, move_src.pBinds);
+
+    return *this;
+}
+
 safe_VkSparseImageMemoryBindInfo::~safe_VkSparseImageMemoryBindInfo() {
     if (pBinds) delete[] pBinds;
 }
@@ -1583,6 +1834,29 @@ safe_VkBindSparseInfo& safe_VkBindSparseInfo::operator=(const safe_VkBindSparseI
     return *this;
 }
 
+safe_VkBindSparseInfo::safe_VkBindSparseInfo(safe_VkBindSparseInfo&& move_src) noexcept : safe_VkBindSparseInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindSparseInfo& safe_VkBindSparseInfo::operator=(safe_VkBindSparseInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(waitSemaphoreCount, move_src.waitSemaphoreCount);
+    std::swap(pWaitSemaphores, move_src.pWaitSemaphores);
+    std::swap(bufferBindCount, move_src.bufferBindCount);
+    std::swap(pBufferBinds, move_src.pBufferBinds);
+    std::swap(imageOpaqueBindCount, move_src.imageOpaqueBindCount);
+    std::swap(pImageOpaqueBinds, move_src.pImageOpaqueBinds);
+    std::swap(imageBindCount, move_src.imageBindCount);
+    std::swap(pImageBinds, move_src.pImageBinds);
+    std::swap(signalSemaphoreCount, move_src.signalSemaphoreCount);
+    std::swap(pSignalSemaphores, move_src.pSignalSemaphores);
+
+    return *this;
+}
+
 safe_VkBindSparseInfo::~safe_VkBindSparseInfo() {
     if (pWaitSemaphores) delete[] pWaitSemaphores;
     if (pBufferBinds) delete[] pBufferBinds;
@@ -1716,6 +1990,20 @@ safe_VkFenceCreateInfo& safe_VkFenceCreateInfo::operator=(const safe_VkFenceCrea
     return *this;
 }
 
+safe_VkFenceCreateInfo::safe_VkFenceCreateInfo(safe_VkFenceCreateInfo&& move_src) noexcept : safe_VkFenceCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkFenceCreateInfo& safe_VkFenceCreateInfo::operator=(safe_VkFenceCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkFenceCreateInfo::~safe_VkFenceCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkFenceCreateInfo::initialize(const VkFenceCreateInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -1760,6 +2048,21 @@ safe_VkSemaphoreCreateInfo& safe_VkSemaphoreCreateInfo::operator=(const safe_VkS
     return *this;
 }
 
+safe_VkSemaphoreCreateInfo::safe_VkSemaphoreCreateInfo(safe_VkSemaphoreCreateInfo&& move_src) noexcept
+    : safe_VkSemaphoreCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSemaphoreCreateInfo& safe_VkSemaphoreCreateInfo::operator=(safe_VkSemaphoreCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkSemaphoreCreateInfo::~safe_VkSemaphoreCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkSemaphoreCreateInfo::initialize(const VkSemaphoreCreateInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -1804,6 +2107,20 @@ safe_VkEventCreateInfo& safe_VkEventCreateInfo::operator=(const safe_VkEventCrea
     return *this;
 }
 
+safe_VkEventCreateInfo::safe_VkEventCreateInfo(safe_VkEventCreateInfo&& move_src) noexcept : safe_VkEventCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkEventCreateInfo& safe_VkEventCreateInfo::operator=(safe_VkEventCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkEventCreateInfo::~safe_VkEventCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkEventCreateInfo::initialize(const VkEventCreateInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -1858,6 +2175,24 @@ safe_VkQueryPoolCreateInfo& safe_VkQueryPoolCreateInfo::operator=(const safe_VkQ
     return *this;
 }
 
+safe_VkQueryPoolCreateInfo::safe_VkQueryPoolCreateInfo(safe_VkQueryPoolCreateInfo&& move_src) noexcept
+    : safe_VkQueryPoolCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkQueryPoolCreateInfo& safe_VkQueryPoolCreateInfo::operator=(safe_VkQueryPoolCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(queryType, move_src.queryType);
+    std::swap(queryCount, move_src.queryCount);
+    std::swap(pipelineStatistics, move_src.pipelineStatistics);
+
+    return *this;
+}
+
 safe_VkQueryPoolCreateInfo::~safe_VkQueryPoolCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkQueryPoolCreateInfo::initialize(const VkQueryPoolCreateInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -1955,6 +2290,25 @@ safe_VkBufferCreateInfo& safe_VkBufferCreateInfo::operator=(const safe_VkBufferC
     return *this;
 }
 
+safe_VkBufferCreateInfo::safe_VkBufferCreateInfo(safe_VkBufferCreateInfo&& move_src) noexcept : safe_VkBufferCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferCreateInfo& safe_VkBufferCreateInfo::operator=(safe_VkBufferCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(size, move_src.size);
+    std::swap(usage, move_src.usage);
+    std::swap(sharingMode, move_src.sharingMode);
+    std::swap(queueFamilyIndexCount, move_src.queueFamilyIndexCount);
+    std::swap(pQueueFamilyIndices, move_src.pQueueFamilyIndices);
+
+    return *this;
+}
+
 safe_VkBufferCreateInfo::~safe_VkBufferCreateInfo() {
     if (pQueueFamilyIndices) delete[] pQueueFamilyIndices;
     FreePnextChain(pNext);
@@ -2042,6 +2396,25 @@ safe_VkBufferViewCreateInfo& safe_VkBufferViewCreateInfo::operator=(const safe_V
     return *this;
 }
 
+safe_VkBufferViewCreateInfo::safe_VkBufferViewCreateInfo(safe_VkBufferViewCreateInfo&& move_src) noexcept
+    : safe_VkBufferViewCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferViewCreateInfo& safe_VkBufferViewCreateInfo::operator=(safe_VkBufferViewCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(buffer, move_src.buffer);
+    std::swap(format, move_src.format);
+    std::swap(offset, move_src.offset);
+    std::swap(range, move_src.range);
+
+    return *this;
+}
+
 safe_VkBufferViewCreateInfo::~safe_VkBufferViewCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkBufferViewCreateInfo::initialize(const VkBufferViewCreateInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -2169,6 +2542,32 @@ safe_VkImageCreateInfo& safe_VkImageCreateInfo::operator=(const safe_VkImageCrea
     return *this;
 }
 
+safe_VkImageCreateInfo::safe_VkImageCreateInfo(safe_VkImageCreateInfo&& move_src) noexcept : safe_VkImageCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageCreateInfo& safe_VkImageCreateInfo::operator=(safe_VkImageCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(imageType, move_src.imageType);
+    std::swap(format, move_src.format);
+    std::swap(extent, move_src.extent);
+    std::swap(mipLevels, move_src.mipLevels);
+    std::swap(arrayLayers, move_src.arrayLayers);
+    std::swap(samples, move_src.samples);
+    std::swap(tiling, move_src.tiling);
+    std::swap(usage, move_src.usage);
+    std::swap(sharingMode, move_src.sharingMode);
+    std::swap(queueFamilyIndexCount, move_src.queueFamilyIndexCount);
+    std::swap(pQueueFamilyIndices, move_src.pQueueFamilyIndices);
+    std::swap(initialLayout, move_src.initialLayout);
+
+    return *this;
+}
+
 safe_VkImageCreateInfo::~safe_VkImageCreateInfo() {
     if (pQueueFamilyIndices) delete[] pQueueFamilyIndices;
     FreePnextChain(pNext);
@@ -2280,6 +2679,26 @@ safe_VkImageViewCreateInfo& safe_VkImageViewCreateInfo::operator=(const safe_VkI
     return *this;
 }
 
+safe_VkImageViewCreateInfo::safe_VkImageViewCreateInfo(safe_VkImageViewCreateInfo&& move_src) noexcept
+    : safe_VkImageViewCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageViewCreateInfo& safe_VkImageViewCreateInfo::operator=(safe_VkImageViewCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(image, move_src.image);
+    std::swap(viewType, move_src.viewType);
+    std::swap(format, move_src.format);
+    std::swap(components, move_src.components);
+    std::swap(subresourceRange, move_src.subresourceRange);
+
+    return *this;
+}
+
 safe_VkImageViewCreateInfo::~safe_VkImageViewCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkImageViewCreateInfo::initialize(const VkImageViewCreateInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -2352,6 +2771,23 @@ safe_VkShaderModuleCreateInfo& safe_VkShaderModuleCreateInfo::operator=(const sa
     return *this;
 }
 
+safe_VkShaderModuleCreateInfo::safe_VkShaderModuleCreateInfo(safe_VkShaderModuleCreateInfo&& move_src) noexcept
+    : safe_VkShaderModuleCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkShaderModuleCreateInfo& safe_VkShaderModuleCreateInfo::operator=(safe_VkShaderModuleCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(codeSize, move_src.codeSize);
+    std::swap(pCode, move_src.pCode);
+
+    return *this;
+}
+
 safe_VkShaderModuleCreateInfo::~safe_VkShaderModuleCreateInfo() {
     if (pCode) delete[] reinterpret_cast<const uint8_t*>(pCode);
     FreePnextChain(pNext);
@@ -2421,6 +2857,23 @@ safe_VkPipelineCacheCreateInfo& safe_VkPipelineCacheCreateInfo::operator=(const
     return *this;
 }
 
+safe_VkPipelineCacheCreateInfo::safe_VkPipelineCacheCreateInfo(safe_VkPipelineCacheCreateInfo&& move_src) noexcept
+    : safe_VkPipelineCacheCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineCacheCreateInfo& safe_VkPipelineCacheCreateInfo::operator=(safe_VkPipelineCacheCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(initialDataSize, move_src.initialDataSize);
+    std::swap(pInitialData, move_src.pInitialData);
+
+    return *this;
+}
+
 safe_VkPipelineCacheCreateInfo::~safe_VkPipelineCacheCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkPipelineCacheCreateInfo::initialize(const VkPipelineCacheCreateInfo* in_struct,
@@ -2504,6 +2957,21 @@ safe_VkSpecializationInfo& safe_VkSpecializationInfo::operator=(const safe_VkSpe
     return *this;
 }
 
+safe_VkSpecializationInfo::safe_VkSpecializationInfo(safe_VkSpecializationInfo&& move_src) noexcept : safe_VkSpecializationInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSpecializationInfo& safe_VkSpecializationInfo::operator=(safe_VkSpecializationInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(mapEntryCount, move_src.mapEntryCount);
+    std::swap(pMapEntries, move_src.pMapEntries);
+    std::swap(dataSize, move_src.dataSize);
+    std::swap(pData, move_src.pData);
+
+    return *this;
+}
+
 safe_VkSpecializationInfo::~safe_VkSpecializationInfo() {
     if (pMapEntries) delete[] pMapEntries;
 
@@ -2608,6 +3076,26 @@ safe_VkPipelineShaderStageCreateInfo& safe_VkPipelineShaderStageCreateInfo::oper
     return *this;
 }
 
+safe_VkPipelineShaderStageCreateInfo::safe_VkPipelineShaderStageCreateInfo(safe_VkPipelineShaderStageCreateInfo&& move_src) noexcept
+    : safe_VkPipelineShaderStageCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineShaderStageCreateInfo& safe_VkPipelineShaderStageCreateInfo::operator=(
+    safe_VkPipelineShaderStageCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(stage, move_src.stage);
+    std::swap(module, move_src.module);
+    std::swap(pName, move_src.pName);
+    std::swap(pSpecializationInfo, move_src.pSpecializationInfo);
+
+    return *this;
+}
+
 safe_VkPipelineShaderStageCreateInfo::~safe_VkPipelineShaderStageCreateInfo() {
     if (pName) delete[] pName;
     if (pSpecializationInfo) delete pSpecializationInfo;
@@ -2688,6 +3176,26 @@ safe_VkComputePipelineCreateInfo& safe_VkComputePipelineCreateInfo::operator=(co
     return *this;
 }
 
+safe_VkComputePipelineCreateInfo::safe_VkComputePipelineCreateInfo(safe_VkComputePipelineCreateInfo&& move_src) noexcept
+    : safe_VkComputePipelineCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkComputePipelineCreateInfo& safe_VkComputePipelineCreateInfo::operator=(
+    safe_VkComputePipelineCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(stage, move_src.stage);
+    std::swap(layout, move_src.layout);
+    std::swap(basePipelineHandle, move_src.basePipelineHandle);
+    std::swap(basePipelineIndex, move_src.basePipelineIndex);
+
+    return *this;
+}
+
 safe_VkComputePipelineCreateInfo::~safe_VkComputePipelineCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkComputePipelineCreateInfo::initialize(const VkComputePipelineCreateInfo* in_struct,
@@ -2800,6 +3308,27 @@ safe_VkPipelineVertexInputStateCreateInfo& safe_VkPipelineVertexInputStateCreate
     return *this;
 }
 
+safe_VkPipelineVertexInputStateCreateInfo::safe_VkPipelineVertexInputStateCreateInfo(
+    safe_VkPipelineVertexInputStateCreateInfo&& move_src) noexcept
+    : safe_VkPipelineVertexInputStateCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineVertexInputStateCreateInfo& safe_VkPipelineVertexInputStateCreateInfo::operator=(
+    safe_VkPipelineVertexInputStateCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(vertexBindingDescriptionCount, move_src.vertexBindingDescriptionCount);
+    std::swap(pVertexBindingDescriptions, move_src.pVertexBindingDescriptions);
+    std::swap(vertexAttributeDescriptionCount, move_src.vertexAttributeDescriptionCount);
+    std::swap(pVertexAttributeDescriptions, move_src.pVertexAttributeDescriptions);
+
+    return *this;
+}
+
 safe_VkPipelineVertexInputStateCreateInfo::~safe_VkPipelineVertexInputStateCreateInfo() {
     if (pVertexBindingDescriptions) delete[] pVertexBindingDescriptions;
     if (pVertexAttributeDescriptions) delete[] pVertexAttributeDescriptions;
@@ -2897,6 +3426,25 @@ safe_VkPipelineInputAssemblyStateCreateInfo& safe_VkPipelineInputAssemblyStateCr
     return *this;
 }
 
+safe_VkPipelineInputAssemblyStateCreateInfo::safe_VkPipelineInputAssemblyStateCreateInfo(
+    safe_VkPipelineInputAssemblyStateCreateInfo&& move_src) noexcept
+    : safe_VkPipelineInputAssemblyStateCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineInputAssemblyStateCreateInfo& safe_VkPipelineInputAssemblyStateCreateInfo::operator=(
+    safe_VkPipelineInputAssemblyStateCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(topology, move_src.topology);
+    std::swap(primitiveRestartEnable, move_src.primitiveRestartEnable);
+
+    return *this;
+}
+
 safe_VkPipelineInputAssemblyStateCreateInfo::~safe_VkPipelineInputAssemblyStateCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkPipelineInputAssemblyStateCreateInfo::initialize(const VkPipelineInputAssemblyStateCreateInfo* in_struct,
@@ -2951,6 +3499,24 @@ safe_VkPipelineTessellationStateCreateInfo& safe_VkPipelineTessellationStateCrea
     return *this;
 }
 
+safe_VkPipelineTessellationStateCreateInfo::safe_VkPipelineTessellationStateCreateInfo(
+    safe_VkPipelineTessellationStateCreateInfo&& move_src) noexcept
+    : safe_VkPipelineTessellationStateCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineTessellationStateCreateInfo& safe_VkPipelineTessellationStateCreateInfo::operator=(
+    safe_VkPipelineTessellationStateCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(patchControlPoints, move_src.patchControlPoints);
+
+    return *this;
+}
+
 safe_VkPipelineTessellationStateCreateInfo::~safe_VkPipelineTessellationStateCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkPipelineTessellationStateCreateInfo::initialize(const VkPipelineTessellationStateCreateInfo* in_struct,
@@ -3055,6 +3621,27 @@ safe_VkPipelineViewportStateCreateInfo& safe_VkPipelineViewportStateCreateInfo::
     return *this;
 }
 
+safe_VkPipelineViewportStateCreateInfo::safe_VkPipelineViewportStateCreateInfo(
+    safe_VkPipelineViewportStateCreateInfo&& move_src) noexcept
+    : safe_VkPipelineViewportStateCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineViewportStateCreateInfo& safe_VkPipelineViewportStateCreateInfo::operator=(
+    safe_VkPipelineViewportStateCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(viewportCount, move_src.viewportCount);
+    std::swap(pViewports, move_src.pViewports);
+    std::swap(scissorCount, move_src.scissorCount);
+    std::swap(pScissors, move_src.pScissors);
+
+    return *this;
+}
+
 safe_VkPipelineViewportStateCreateInfo::~safe_VkPipelineViewportStateCreateInfo() {
     if (pViewports) delete[] pViewports;
     if (pScissors) delete[] pScissors;
@@ -3181,6 +3768,33 @@ safe_VkPipelineRasterizationStateCreateInfo& safe_VkPipelineRasterizationStateCr
     return *this;
 }
 
+safe_VkPipelineRasterizationStateCreateInfo::safe_VkPipelineRasterizationStateCreateInfo(
+    safe_VkPipelineRasterizationStateCreateInfo&& move_src) noexcept
+    : safe_VkPipelineRasterizationStateCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineRasterizationStateCreateInfo& safe_VkPipelineRasterizationStateCreateInfo::operator=(
+    safe_VkPipelineRasterizationStateCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(depthClampEnable, move_src.depthClampEnable);
+    std::swap(rasterizerDiscardEnable, move_src.rasterizerDiscardEnable);
+    std::swap(polygonMode, move_src.polygonMode);
+    std::swap(cullMode, move_src.cullMode);
+    std::swap(frontFace, move_src.frontFace);
+    std::swap(depthBiasEnable, move_src.depthBiasEnable);
+    std::swap(depthBiasConstantFactor, move_src.depthBiasConstantFactor);
+    std::swap(depthBiasClamp, move_src.depthBiasClamp);
+    std::swap(depthBiasSlopeFactor, move_src.depthBiasSlopeFactor);
+    std::swap(lineWidth, move_src.lineWidth);
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationStateCreateInfo::~safe_VkPipelineRasterizationStateCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkPipelineRasterizationStateCreateInfo::initialize(const VkPipelineRasterizationStateCreateInfo* in_struct,
@@ -3288,6 +3902,29 @@ safe_VkPipelineMultisampleStateCreateInfo& safe_VkPipelineMultisampleStateCreate
     return *this;
 }
 
+safe_VkPipelineMultisampleStateCreateInfo::safe_VkPipelineMultisampleStateCreateInfo(
+    safe_VkPipelineMultisampleStateCreateInfo&& move_src) noexcept
+    : safe_VkPipelineMultisampleStateCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineMultisampleStateCreateInfo& safe_VkPipelineMultisampleStateCreateInfo::operator=(
+    safe_VkPipelineMultisampleStateCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(rasterizationSamples, move_src.rasterizationSamples);
+    std::swap(sampleShadingEnable, move_src.sampleShadingEnable);
+    std::swap(minSampleShading, move_src.minSampleShading);
+    std::swap(pSampleMask, move_src.pSampleMask);
+    std::swap(alphaToCoverageEnable, move_src.alphaToCoverageEnable);
+    std::swap(alphaToOneEnable, move_src.alphaToOneEnable);
+
+    return *this;
+}
+
 safe_VkPipelineMultisampleStateCreateInfo::~safe_VkPipelineMultisampleStateCreateInfo() {
     if (pSampleMask) delete pSampleMask;
     FreePnextChain(pNext);
@@ -3399,10 +4036,36 @@ safe_VkPipelineDepthStencilStateCreateInfo& safe_VkPipelineDepthStencilStateCrea
     return *this;
 }
 
-safe_VkPipelineDepthStencilStateCreateInfo::~safe_VkPipelineDepthStencilStateCreateInfo() { FreePnextChain(pNext); }
+safe_VkPipelineDepthStencilStateCreateInfo::safe_VkPipelineDepthStencilStateCreateInfo(
+    safe_VkPipelineDepthStencilStateCreateInfo&& move_src) noexcept
+    : safe_VkPipelineDepthStencilStateCreateInfo() {
+    *this = std::move(move_src);
+}
 
-void safe_VkPipelineDepthStencilStateCreateInfo::initialize(const VkPipelineDepthStencilStateCreateInfo* in_struct,
-                                                            [[maybe_unused]] PNextCopyState* copy_state) {
+safe_VkPipelineDepthStencilStateCreateInfo& safe_VkPipelineDepthStencilStateCreateInfo::operator=(
+    safe_VkPipelineDepthStencilStateCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(depthTestEnable, move_src.depthTestEnable);
+    std::swap(depthWriteEnable, move_src.depthWriteEnable);
+    std::swap(depthCompareOp, move_src.depthCompareOp);
+    std::swap(depthBoundsTestEnable, move_src.depthBoundsTestEnable);
+    std::swap(stencilTestEnable, move_src.stencilTestEnable);
+    std::swap(front, move_src.front);
+    std::swap(back, move_src.back);
+    std::swap(minDepthBounds, move_src.minDepthBounds);
+    std::swap(maxDepthBounds, move_src.maxDepthBounds);
+
+    return *this;
+}
+
+safe_VkPipelineDepthStencilStateCreateInfo::~safe_VkPipelineDepthStencilStateCreateInfo() { FreePnextChain(pNext); }
+
+void safe_VkPipelineDepthStencilStateCreateInfo::initialize(const VkPipelineDepthStencilStateCreateInfo* in_struct,
+                                                            [[maybe_unused]] PNextCopyState* copy_state) {
     FreePnextChain(pNext);
     sType = in_struct->sType;
     flags = in_struct->flags;
@@ -3514,6 +4177,28 @@ safe_VkPipelineColorBlendStateCreateInfo& safe_VkPipelineColorBlendStateCreateIn
     return *this;
 }
 
+safe_VkPipelineColorBlendStateCreateInfo::safe_VkPipelineColorBlendStateCreateInfo(
+    safe_VkPipelineColorBlendStateCreateInfo&& move_src) noexcept
+    : safe_VkPipelineColorBlendStateCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineColorBlendStateCreateInfo& safe_VkPipelineColorBlendStateCreateInfo::operator=(
+    safe_VkPipelineColorBlendStateCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(logicOpEnable, move_src.logicOpEnable);
+    std::swap(logicOp, move_src.logicOp);
+    std::swap(attachmentCount, move_src.attachmentCount);
+    std::swap(pAttachments, move_src.pAttachments);
+    std::swap(blendConstants, move_src.blendConstants);
+
+    return *this;
+}
+
 safe_VkPipelineColorBlendStateCreateInfo::~safe_VkPipelineColorBlendStateCreateInfo() {
     if (pAttachments) delete[] pAttachments;
     FreePnextChain(pNext);
@@ -3618,6 +4303,25 @@ safe_VkPipelineDynamicStateCreateInfo& safe_VkPipelineDynamicStateCreateInfo::op
     return *this;
 }
 
+safe_VkPipelineDynamicStateCreateInfo::safe_VkPipelineDynamicStateCreateInfo(
+    safe_VkPipelineDynamicStateCreateInfo&& move_src) noexcept
+    : safe_VkPipelineDynamicStateCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineDynamicStateCreateInfo& safe_VkPipelineDynamicStateCreateInfo::operator=(
+    safe_VkPipelineDynamicStateCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(dynamicStateCount, move_src.dynamicStateCount);
+    std::swap(pDynamicStates, move_src.pDynamicStates);
+
+    return *this;
+}
+
 safe_VkPipelineDynamicStateCreateInfo::~safe_VkPipelineDynamicStateCreateInfo() {
     if (pDynamicStates) delete[] pDynamicStates;
     FreePnextChain(pNext);
@@ -3947,6 +4651,38 @@ safe_VkGraphicsPipelineCreateInfo& safe_VkGraphicsPipelineCreateInfo::operator=(
     return *this;
 }
 
+safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(safe_VkGraphicsPipelineCreateInfo&& move_src) noexcept
+    : safe_VkGraphicsPipelineCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkGraphicsPipelineCreateInfo& safe_VkGraphicsPipelineCreateInfo::operator=(
+    safe_VkGraphicsPipelineCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(stageCount, move_src.stageCount);
+    std::swap(pStages, move_src.pStages);
+    std::swap(pVertexInputState, move_src.pVertexInputState);
+    std::swap(pInputAssemblyState, move_src.pInputAssemblyState);
+    std::swap(pTessellationState, move_src.pTessellationState);
+    std::swap(pViewportState, move_src.pViewportState);
+    std::swap(pRasterizationState, move_src.pRasterizationState);
+    std::swap(pMultisampleState, move_src.pMultisampleState);
+    std::swap(pDepthStencilState, move_src.pDepthStencilState);
+    std::swap(pColorBlendState, move_src.pColorBlendState);
+    std::swap(pDynamicState, move_src.pDynamicState);
+    std::swap(layout, move_src.layout);
+    std::swap(renderPass, move_src.renderPass);
+    std::swap(subpass, move_src.subpass);
+    std::swap(basePipelineHandle, move_src.basePipelineHandle);
+    std::swap(basePipelineIndex, move_src.basePipelineIndex);
+
+    return *this;
+}
+
 safe_VkGraphicsPipelineCreateInfo::~safe_VkGraphicsPipelineCreateInfo() {
     if (pStages) delete[] pStages;
     if (pVertexInputState) delete pVertexInputState;
@@ -4233,6 +4969,25 @@ safe_VkPipelineLayoutCreateInfo& safe_VkPipelineLayoutCreateInfo::operator=(cons
     return *this;
 }
 
+safe_VkPipelineLayoutCreateInfo::safe_VkPipelineLayoutCreateInfo(safe_VkPipelineLayoutCreateInfo&& move_src) noexcept
+    : safe_VkPipelineLayoutCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineLayoutCreateInfo& safe_VkPipelineLayoutCreateInfo::operator=(safe_VkPipelineLayoutCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(setLayoutCount, move_src.setLayoutCount);
+    std::swap(pSetLayouts, move_src.pSetLayouts);
+    std::swap(pushConstantRangeCount, move_src.pushConstantRangeCount);
+    std::swap(pPushConstantRanges, move_src.pPushConstantRanges);
+
+    return *this;
+}
+
 safe_VkPipelineLayoutCreateInfo::~safe_VkPipelineLayoutCreateInfo() {
     if (pSetLayouts) delete[] pSetLayouts;
     if (pPushConstantRanges) delete[] pPushConstantRanges;
@@ -4380,6 +5135,35 @@ safe_VkSamplerCreateInfo& safe_VkSamplerCreateInfo::operator=(const safe_VkSampl
     return *this;
 }
 
+safe_VkSamplerCreateInfo::safe_VkSamplerCreateInfo(safe_VkSamplerCreateInfo&& move_src) noexcept : safe_VkSamplerCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSamplerCreateInfo& safe_VkSamplerCreateInfo::operator=(safe_VkSamplerCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(magFilter, move_src.magFilter);
+    std::swap(minFilter, move_src.minFilter);
+    std::swap(mipmapMode, move_src.mipmapMode);
+    std::swap(addressModeU, move_src.addressModeU);
+    std::swap(addressModeV, move_src.addressModeV);
+    std::swap(addressModeW, move_src.addressModeW);
+    std::swap(mipLodBias, move_src.mipLodBias);
+    std::swap(anisotropyEnable, move_src.anisotropyEnable);
+    std::swap(maxAnisotropy, move_src.maxAnisotropy);
+    std::swap(compareEnable, move_src.compareEnable);
+    std::swap(compareOp, move_src.compareOp);
+    std::swap(minLod, move_src.minLod);
+    std::swap(maxLod, move_src.maxLod);
+    std::swap(borderColor, move_src.borderColor);
+    std::swap(unnormalizedCoordinates, move_src.unnormalizedCoordinates);
+
+    return *this;
+}
+
 safe_VkSamplerCreateInfo::~safe_VkSamplerCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkSamplerCreateInfo::initialize(const VkSamplerCreateInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -4481,6 +5265,26 @@ safe_VkCopyDescriptorSet& safe_VkCopyDescriptorSet::operator=(const safe_VkCopyD
     return *this;
 }
 
+safe_VkCopyDescriptorSet::safe_VkCopyDescriptorSet(safe_VkCopyDescriptorSet&& move_src) noexcept : safe_VkCopyDescriptorSet() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyDescriptorSet& safe_VkCopyDescriptorSet::operator=(safe_VkCopyDescriptorSet&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcSet, move_src.srcSet);
+    std::swap(srcBinding, move_src.srcBinding);
+    std::swap(srcArrayElement, move_src.srcArrayElement);
+    std::swap(dstSet, move_src.dstSet);
+    std::swap(dstBinding, move_src.dstBinding);
+    std::swap(dstArrayElement, move_src.dstArrayElement);
+    std::swap(descriptorCount, move_src.descriptorCount);
+
+    return *this;
+}
+
 safe_VkCopyDescriptorSet::~safe_VkCopyDescriptorSet() { FreePnextChain(pNext); }
 
 void safe_VkCopyDescriptorSet::initialize(const VkCopyDescriptorSet* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -4567,6 +5371,24 @@ safe_VkDescriptorPoolCreateInfo& safe_VkDescriptorPoolCreateInfo::operator=(cons
     return *this;
 }
 
+safe_VkDescriptorPoolCreateInfo::safe_VkDescriptorPoolCreateInfo(safe_VkDescriptorPoolCreateInfo&& move_src) noexcept
+    : safe_VkDescriptorPoolCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorPoolCreateInfo& safe_VkDescriptorPoolCreateInfo::operator=(safe_VkDescriptorPoolCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(maxSets, move_src.maxSets);
+    std::swap(poolSizeCount, move_src.poolSizeCount);
+    std::swap(pPoolSizes, move_src.pPoolSizes);
+
+    return *this;
+}
+
 safe_VkDescriptorPoolCreateInfo::~safe_VkDescriptorPoolCreateInfo() {
     if (pPoolSizes) delete[] pPoolSizes;
     FreePnextChain(pNext);
@@ -4663,6 +5485,24 @@ safe_VkDescriptorSetAllocateInfo& safe_VkDescriptorSetAllocateInfo::operator=(co
     return *this;
 }
 
+safe_VkDescriptorSetAllocateInfo::safe_VkDescriptorSetAllocateInfo(safe_VkDescriptorSetAllocateInfo&& move_src) noexcept
+    : safe_VkDescriptorSetAllocateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorSetAllocateInfo& safe_VkDescriptorSetAllocateInfo::operator=(
+    safe_VkDescriptorSetAllocateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(descriptorPool, move_src.descriptorPool);
+    std::swap(descriptorSetCount, move_src.descriptorSetCount);
+    std::swap(pSetLayouts, move_src.pSetLayouts);
+
+    return *this;
+}
+
 safe_VkDescriptorSetAllocateInfo::~safe_VkDescriptorSetAllocateInfo() {
     if (pSetLayouts) delete[] pSetLayouts;
     FreePnextChain(pNext);
@@ -4758,6 +5598,24 @@ safe_VkDescriptorSetLayoutBinding& safe_VkDescriptorSetLayoutBinding::operator=(
     return *this;
 }
 
+safe_VkDescriptorSetLayoutBinding::safe_VkDescriptorSetLayoutBinding(safe_VkDescriptorSetLayoutBinding&& move_src) noexcept
+    : safe_VkDescriptorSetLayoutBinding() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorSetLayoutBinding& safe_VkDescriptorSetLayoutBinding::operator=(
+    safe_VkDescriptorSetLayoutBinding&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(binding, move_src.binding);
+    std::swap(descriptorType, move_src.descriptorType);
+    std::swap(descriptorCount, move_src.descriptorCount);
+    std::swap(stageFlags, move_src.stageFlags);
+    std::swap(pImmutableSamplers, move_src.pImmutableSamplers);
+
+    return *this;
+}
+
 safe_VkDescriptorSetLayoutBinding::~safe_VkDescriptorSetLayoutBinding() {
     if (pImmutableSamplers) delete[] pImmutableSamplers;
 }
@@ -4851,6 +5709,24 @@ safe_VkDescriptorSetLayoutCreateInfo& safe_VkDescriptorSetLayoutCreateInfo::oper
     return *this;
 }
 
+safe_VkDescriptorSetLayoutCreateInfo::safe_VkDescriptorSetLayoutCreateInfo(safe_VkDescriptorSetLayoutCreateInfo&& move_src) noexcept
+    : safe_VkDescriptorSetLayoutCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorSetLayoutCreateInfo& safe_VkDescriptorSetLayoutCreateInfo::operator=(
+    safe_VkDescriptorSetLayoutCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(bindingCount, move_src.bindingCount);
+    std::swap(pBindings, move_src.pBindings);
+
+    return *this;
+}
+
 safe_VkDescriptorSetLayoutCreateInfo::~safe_VkDescriptorSetLayoutCreateInfo() {
     if (pBindings) delete[] pBindings;
     FreePnextChain(pNext);
@@ -5065,6 +5941,27 @@ safe_VkWriteDescriptorSet& safe_VkWriteDescriptorSet::operator=(const safe_VkWri
     return *this;
 }
 
+safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(safe_VkWriteDescriptorSet&& move_src) noexcept : safe_VkWriteDescriptorSet() {
+    *this = std::move(move_src);
+}
+
+safe_VkWriteDescriptorSet& safe_VkWriteDescriptorSet::operator=(safe_VkWriteDescriptorSet&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(dstSet, move_src.dstSet);
+    std::swap(dstBinding, move_src.dstBinding);
+    std::swap(dstArrayElement, move_src.dstArrayElement);
+    std::swap(descriptorCount, move_src.descriptorCount);
+    std::swap(descriptorType, move_src.descriptorType);
+    std::swap(pImageInfo, move_src.pImageInfo);
+    std::swap(pBufferInfo, move_src.pBufferInfo);
+    std::swap(pTexelBufferView, move_src.pTexelBufferView);
+
+    return *this;
+}
+
 safe_VkWriteDescriptorSet::~safe_VkWriteDescriptorSet() {
     if (pImageInfo) delete[] pImageInfo;
     if (pBufferInfo) delete[] pBufferInfo;
@@ -5253,6 +6150,27 @@ safe_VkFramebufferCreateInfo& safe_VkFramebufferCreateInfo::operator=(const safe
     return *this;
 }
 
+safe_VkFramebufferCreateInfo::safe_VkFramebufferCreateInfo(safe_VkFramebufferCreateInfo&& move_src) noexcept
+    : safe_VkFramebufferCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkFramebufferCreateInfo& safe_VkFramebufferCreateInfo::operator=(safe_VkFramebufferCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(renderPass, move_src.renderPass);
+    std::swap(attachmentCount, move_src.attachmentCount);
+    std::swap(pAttachments, move_src.pAttachments);
+    std::swap(width, move_src.width);
+    std::swap(height, move_src.height);
+    std::swap(layers, move_src.layers);
+
+    return *this;
+}
+
 safe_VkFramebufferCreateInfo::~safe_VkFramebufferCreateInfo() {
     if (pAttachments) delete[] pAttachments;
     FreePnextChain(pNext);
@@ -5443,6 +6361,27 @@ safe_VkSubpassDescription& safe_VkSubpassDescription::operator=(const safe_VkSub
     return *this;
 }
 
+safe_VkSubpassDescription::safe_VkSubpassDescription(safe_VkSubpassDescription&& move_src) noexcept : safe_VkSubpassDescription() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubpassDescription& safe_VkSubpassDescription::operator=(safe_VkSubpassDescription&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(flags, move_src.flags);
+    std::swap(pipelineBindPoint, move_src.pipelineBindPoint);
+    std::swap(inputAttachmentCount, move_src.inputAttachmentCount);
+    std::swap(pInputAttachments, move_src.pInputAttachments);
+    std::swap(colorAttachmentCount, move_src.colorAttachmentCount);
+    std::swap(pColorAttachments, move_src.pColorAttachments);
+    std::swap(pResolveAttachments, move_src.pResolveAttachments);
+    std::swap(pDepthStencilAttachment, move_src.pDepthStencilAttachment);
+    std::swap(preserveAttachmentCount, move_src.preserveAttachmentCount);
+    std::swap(pPreserveAttachments, move_src.pPreserveAttachments);
+
+    return *this;
+}
+
 safe_VkSubpassDescription::~safe_VkSubpassDescription() {
     if (pInputAttachments) delete[] pInputAttachments;
     if (pColorAttachments) delete[] pColorAttachments;
@@ -5644,6 +6583,27 @@ safe_VkRenderPassCreateInfo& safe_VkRenderPassCreateInfo::operator=(const safe_V
     return *this;
 }
 
+safe_VkRenderPassCreateInfo::safe_VkRenderPassCreateInfo(safe_VkRenderPassCreateInfo&& move_src) noexcept
+    : safe_VkRenderPassCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassCreateInfo& safe_VkRenderPassCreateInfo::operator=(safe_VkRenderPassCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(attachmentCount, move_src.attachmentCount);
+    std::swap(pAttachments, move_src.pAttachments);
+    std::swap(subpassCount, move_src.subpassCount);
+    std::swap(pSubpasses, move_src.pSubpasses);
+    std::swap(dependencyCount, move_src.dependencyCount);
+    std::swap(pDependencies, move_src.pDependencies);
+
+    return *this;
+}
+
 safe_VkRenderPassCreateInfo::~safe_VkRenderPassCreateInfo() {
     if (pAttachments) delete[] pAttachments;
     if (pSubpasses) delete[] pSubpasses;
@@ -5743,6 +6703,22 @@ safe_VkCommandPoolCreateInfo& safe_VkCommandPoolCreateInfo::operator=(const safe
     return *this;
 }
 
+safe_VkCommandPoolCreateInfo::safe_VkCommandPoolCreateInfo(safe_VkCommandPoolCreateInfo&& move_src) noexcept
+    : safe_VkCommandPoolCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkCommandPoolCreateInfo& safe_VkCommandPoolCreateInfo::operator=(safe_VkCommandPoolCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(queueFamilyIndex, move_src.queueFamilyIndex);
+
+    return *this;
+}
+
 safe_VkCommandPoolCreateInfo::~safe_VkCommandPoolCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkCommandPoolCreateInfo::initialize(const VkCommandPoolCreateInfo* in_struct,
@@ -5798,6 +6774,24 @@ safe_VkCommandBufferAllocateInfo& safe_VkCommandBufferAllocateInfo::operator=(co
     return *this;
 }
 
+safe_VkCommandBufferAllocateInfo::safe_VkCommandBufferAllocateInfo(safe_VkCommandBufferAllocateInfo&& move_src) noexcept
+    : safe_VkCommandBufferAllocateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkCommandBufferAllocateInfo& safe_VkCommandBufferAllocateInfo::operator=(
+    safe_VkCommandBufferAllocateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(commandPool, move_src.commandPool);
+    std::swap(level, move_src.level);
+    std::swap(commandBufferCount, move_src.commandBufferCount);
+
+    return *this;
+}
+
 safe_VkCommandBufferAllocateInfo::~safe_VkCommandBufferAllocateInfo() { FreePnextChain(pNext); }
 
 void safe_VkCommandBufferAllocateInfo::initialize(const VkCommandBufferAllocateInfo* in_struct,
@@ -5873,6 +6867,27 @@ safe_VkCommandBufferInheritanceInfo& safe_VkCommandBufferInheritanceInfo::operat
     return *this;
 }
 
+safe_VkCommandBufferInheritanceInfo::safe_VkCommandBufferInheritanceInfo(safe_VkCommandBufferInheritanceInfo&& move_src) noexcept
+    : safe_VkCommandBufferInheritanceInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkCommandBufferInheritanceInfo& safe_VkCommandBufferInheritanceInfo::operator=(
+    safe_VkCommandBufferInheritanceInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(renderPass, move_src.renderPass);
+    std::swap(subpass, move_src.subpass);
+    std::swap(framebuffer, move_src.framebuffer);
+    std::swap(occlusionQueryEnable, move_src.occlusionQueryEnable);
+    std::swap(queryFlags, move_src.queryFlags);
+    std::swap(pipelineStatistics, move_src.pipelineStatistics);
+
+    return *this;
+}
+
 safe_VkCommandBufferInheritanceInfo::~safe_VkCommandBufferInheritanceInfo() { FreePnextChain(pNext); }
 
 void safe_VkCommandBufferInheritanceInfo::initialize(const VkCommandBufferInheritanceInfo* in_struct,
@@ -5935,6 +6950,22 @@ safe_VkCommandBufferBeginInfo& safe_VkCommandBufferBeginInfo::operator=(const sa
     return *this;
 }
 
+safe_VkCommandBufferBeginInfo::safe_VkCommandBufferBeginInfo(safe_VkCommandBufferBeginInfo&& move_src) noexcept
+    : safe_VkCommandBufferBeginInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkCommandBufferBeginInfo& safe_VkCommandBufferBeginInfo::operator=(safe_VkCommandBufferBeginInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(pInheritanceInfo, move_src.pInheritanceInfo);
+
+    return *this;
+}
+
 safe_VkCommandBufferBeginInfo::~safe_VkCommandBufferBeginInfo() {
     if (pInheritanceInfo) delete pInheritanceInfo;
     FreePnextChain(pNext);
@@ -6023,6 +7054,25 @@ safe_VkRenderPassBeginInfo& safe_VkRenderPassBeginInfo::operator=(const safe_VkR
     return *this;
 }
 
+safe_VkRenderPassBeginInfo::safe_VkRenderPassBeginInfo(safe_VkRenderPassBeginInfo&& move_src) noexcept
+    : safe_VkRenderPassBeginInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassBeginInfo& safe_VkRenderPassBeginInfo::operator=(safe_VkRenderPassBeginInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(renderPass, move_src.renderPass);
+    std::swap(framebuffer, move_src.framebuffer);
+    std::swap(renderArea, move_src.renderArea);
+    std::swap(clearValueCount, move_src.clearValueCount);
+    std::swap(pClearValues, move_src.pClearValues);
+
+    return *this;
+}
+
 safe_VkRenderPassBeginInfo::~safe_VkRenderPassBeginInfo() {
     if (pClearValues) delete[] pClearValues;
     FreePnextChain(pNext);
@@ -6107,6 +7157,26 @@ safe_VkPhysicalDeviceSubgroupProperties& safe_VkPhysicalDeviceSubgroupProperties
     return *this;
 }
 
+safe_VkPhysicalDeviceSubgroupProperties::safe_VkPhysicalDeviceSubgroupProperties(
+    safe_VkPhysicalDeviceSubgroupProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceSubgroupProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSubgroupProperties& safe_VkPhysicalDeviceSubgroupProperties::operator=(
+    safe_VkPhysicalDeviceSubgroupProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(subgroupSize, move_src.subgroupSize);
+    std::swap(supportedStages, move_src.supportedStages);
+    std::swap(supportedOperations, move_src.supportedOperations);
+    std::swap(quadOperationsInAllStages, move_src.quadOperationsInAllStages);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSubgroupProperties::~safe_VkPhysicalDeviceSubgroupProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceSubgroupProperties::initialize(const VkPhysicalDeviceSubgroupProperties* in_struct,
@@ -6163,6 +7233,23 @@ safe_VkBindBufferMemoryInfo& safe_VkBindBufferMemoryInfo::operator=(const safe_V
     return *this;
 }
 
+safe_VkBindBufferMemoryInfo::safe_VkBindBufferMemoryInfo(safe_VkBindBufferMemoryInfo&& move_src) noexcept
+    : safe_VkBindBufferMemoryInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindBufferMemoryInfo& safe_VkBindBufferMemoryInfo::operator=(safe_VkBindBufferMemoryInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(buffer, move_src.buffer);
+    std::swap(memory, move_src.memory);
+    std::swap(memoryOffset, move_src.memoryOffset);
+
+    return *this;
+}
+
 safe_VkBindBufferMemoryInfo::~safe_VkBindBufferMemoryInfo() { FreePnextChain(pNext); }
 
 void safe_VkBindBufferMemoryInfo::initialize(const VkBindBufferMemoryInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -6216,6 +7303,23 @@ safe_VkBindImageMemoryInfo& safe_VkBindImageMemoryInfo::operator=(const safe_VkB
     return *this;
 }
 
+safe_VkBindImageMemoryInfo::safe_VkBindImageMemoryInfo(safe_VkBindImageMemoryInfo&& move_src) noexcept
+    : safe_VkBindImageMemoryInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindImageMemoryInfo& safe_VkBindImageMemoryInfo::operator=(safe_VkBindImageMemoryInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(image, move_src.image);
+    std::swap(memory, move_src.memory);
+    std::swap(memoryOffset, move_src.memoryOffset);
+
+    return *this;
+}
+
 safe_VkBindImageMemoryInfo::~safe_VkBindImageMemoryInfo() { FreePnextChain(pNext); }
 
 void safe_VkBindImageMemoryInfo::initialize(const VkBindImageMemoryInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -6282,6 +7386,26 @@ safe_VkPhysicalDevice16BitStorageFeatures& safe_VkPhysicalDevice16BitStorageFeat
     return *this;
 }
 
+safe_VkPhysicalDevice16BitStorageFeatures::safe_VkPhysicalDevice16BitStorageFeatures(
+    safe_VkPhysicalDevice16BitStorageFeatures&& move_src) noexcept
+    : safe_VkPhysicalDevice16BitStorageFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevice16BitStorageFeatures& safe_VkPhysicalDevice16BitStorageFeatures::operator=(
+    safe_VkPhysicalDevice16BitStorageFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(storageBuffer16BitAccess, move_src.storageBuffer16BitAccess);
+    std::swap(uniformAndStorageBuffer16BitAccess, move_src.uniformAndStorageBuffer16BitAccess);
+    std::swap(storagePushConstant16, move_src.storagePushConstant16);
+    std::swap(storageInputOutput16, move_src.storageInputOutput16);
+
+    return *this;
+}
+
 safe_VkPhysicalDevice16BitStorageFeatures::~safe_VkPhysicalDevice16BitStorageFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevice16BitStorageFeatures::initialize(const VkPhysicalDevice16BitStorageFeatures* in_struct,
@@ -6342,6 +7466,23 @@ safe_VkMemoryDedicatedRequirements& safe_VkMemoryDedicatedRequirements::operator
     return *this;
 }
 
+safe_VkMemoryDedicatedRequirements::safe_VkMemoryDedicatedRequirements(safe_VkMemoryDedicatedRequirements&& move_src) noexcept
+    : safe_VkMemoryDedicatedRequirements() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryDedicatedRequirements& safe_VkMemoryDedicatedRequirements::operator=(
+    safe_VkMemoryDedicatedRequirements&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(prefersDedicatedAllocation, move_src.prefersDedicatedAllocation);
+    std::swap(requiresDedicatedAllocation, move_src.requiresDedicatedAllocation);
+
+    return *this;
+}
+
 safe_VkMemoryDedicatedRequirements::~safe_VkMemoryDedicatedRequirements() { FreePnextChain(pNext); }
 
 void safe_VkMemoryDedicatedRequirements::initialize(const VkMemoryDedicatedRequirements* in_struct,
@@ -6393,6 +7534,23 @@ safe_VkMemoryDedicatedAllocateInfo& safe_VkMemoryDedicatedAllocateInfo::operator
     return *this;
 }
 
+safe_VkMemoryDedicatedAllocateInfo::safe_VkMemoryDedicatedAllocateInfo(safe_VkMemoryDedicatedAllocateInfo&& move_src) noexcept
+    : safe_VkMemoryDedicatedAllocateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryDedicatedAllocateInfo& safe_VkMemoryDedicatedAllocateInfo::operator=(
+    safe_VkMemoryDedicatedAllocateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(image, move_src.image);
+    std::swap(buffer, move_src.buffer);
+
+    return *this;
+}
+
 safe_VkMemoryDedicatedAllocateInfo::~safe_VkMemoryDedicatedAllocateInfo() { FreePnextChain(pNext); }
 
 void safe_VkMemoryDedicatedAllocateInfo::initialize(const VkMemoryDedicatedAllocateInfo* in_struct,
@@ -6443,6 +7601,22 @@ safe_VkMemoryAllocateFlagsInfo& safe_VkMemoryAllocateFlagsInfo::operator=(const
     return *this;
 }
 
+safe_VkMemoryAllocateFlagsInfo::safe_VkMemoryAllocateFlagsInfo(safe_VkMemoryAllocateFlagsInfo&& move_src) noexcept
+    : safe_VkMemoryAllocateFlagsInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryAllocateFlagsInfo& safe_VkMemoryAllocateFlagsInfo::operator=(safe_VkMemoryAllocateFlagsInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(deviceMask, move_src.deviceMask);
+
+    return *this;
+}
+
 safe_VkMemoryAllocateFlagsInfo::~safe_VkMemoryAllocateFlagsInfo() { FreePnextChain(pNext); }
 
 void safe_VkMemoryAllocateFlagsInfo::initialize(const VkMemoryAllocateFlagsInfo* in_struct,
@@ -6521,6 +7695,25 @@ safe_VkDeviceGroupRenderPassBeginInfo& safe_VkDeviceGroupRenderPassBeginInfo::op
     return *this;
 }
 
+safe_VkDeviceGroupRenderPassBeginInfo::safe_VkDeviceGroupRenderPassBeginInfo(
+    safe_VkDeviceGroupRenderPassBeginInfo&& move_src) noexcept
+    : safe_VkDeviceGroupRenderPassBeginInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceGroupRenderPassBeginInfo& safe_VkDeviceGroupRenderPassBeginInfo::operator=(
+    safe_VkDeviceGroupRenderPassBeginInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceMask, move_src.deviceMask);
+    std::swap(deviceRenderAreaCount, move_src.deviceRenderAreaCount);
+    std::swap(pDeviceRenderAreas, move_src.pDeviceRenderAreas);
+
+    return *this;
+}
+
 safe_VkDeviceGroupRenderPassBeginInfo::~safe_VkDeviceGroupRenderPassBeginInfo() {
     if (pDeviceRenderAreas) delete[] pDeviceRenderAreas;
     FreePnextChain(pNext);
@@ -6588,6 +7781,23 @@ safe_VkDeviceGroupCommandBufferBeginInfo& safe_VkDeviceGroupCommandBufferBeginIn
     return *this;
 }
 
+safe_VkDeviceGroupCommandBufferBeginInfo::safe_VkDeviceGroupCommandBufferBeginInfo(
+    safe_VkDeviceGroupCommandBufferBeginInfo&& move_src) noexcept
+    : safe_VkDeviceGroupCommandBufferBeginInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceGroupCommandBufferBeginInfo& safe_VkDeviceGroupCommandBufferBeginInfo::operator=(
+    safe_VkDeviceGroupCommandBufferBeginInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceMask, move_src.deviceMask);
+
+    return *this;
+}
+
 safe_VkDeviceGroupCommandBufferBeginInfo::~safe_VkDeviceGroupCommandBufferBeginInfo() { FreePnextChain(pNext); }
 
 void safe_VkDeviceGroupCommandBufferBeginInfo::initialize(const VkDeviceGroupCommandBufferBeginInfo* in_struct,
@@ -6713,6 +7923,26 @@ safe_VkDeviceGroupSubmitInfo& safe_VkDeviceGroupSubmitInfo::operator=(const safe
     return *this;
 }
 
+safe_VkDeviceGroupSubmitInfo::safe_VkDeviceGroupSubmitInfo(safe_VkDeviceGroupSubmitInfo&& move_src) noexcept
+    : safe_VkDeviceGroupSubmitInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceGroupSubmitInfo& safe_VkDeviceGroupSubmitInfo::operator=(safe_VkDeviceGroupSubmitInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(waitSemaphoreCount, move_src.waitSemaphoreCount);
+    std::swap(pWaitSemaphoreDeviceIndices, move_src.pWaitSemaphoreDeviceIndices);
+    std::swap(commandBufferCount, move_src.commandBufferCount);
+    std::swap(pCommandBufferDeviceMasks, move_src.pCommandBufferDeviceMasks);
+    std::swap(signalSemaphoreCount, move_src.signalSemaphoreCount);
+    std::swap(pSignalSemaphoreDeviceIndices, move_src.pSignalSemaphoreDeviceIndices);
+
+    return *this;
+}
+
 safe_VkDeviceGroupSubmitInfo::~safe_VkDeviceGroupSubmitInfo() {
     if (pWaitSemaphoreDeviceIndices) delete[] pWaitSemaphoreDeviceIndices;
     if (pCommandBufferDeviceMasks) delete[] pCommandBufferDeviceMasks;
@@ -6817,6 +8047,23 @@ safe_VkDeviceGroupBindSparseInfo& safe_VkDeviceGroupBindSparseInfo::operator=(co
     return *this;
 }
 
+safe_VkDeviceGroupBindSparseInfo::safe_VkDeviceGroupBindSparseInfo(safe_VkDeviceGroupBindSparseInfo&& move_src) noexcept
+    : safe_VkDeviceGroupBindSparseInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceGroupBindSparseInfo& safe_VkDeviceGroupBindSparseInfo::operator=(
+    safe_VkDeviceGroupBindSparseInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(resourceDeviceIndex, move_src.resourceDeviceIndex);
+    std::swap(memoryDeviceIndex, move_src.memoryDeviceIndex);
+
+    return *this;
+}
+
 safe_VkDeviceGroupBindSparseInfo::~safe_VkDeviceGroupBindSparseInfo() { FreePnextChain(pNext); }
 
 void safe_VkDeviceGroupBindSparseInfo::initialize(const VkDeviceGroupBindSparseInfo* in_struct,
@@ -6885,6 +8132,24 @@ safe_VkBindBufferMemoryDeviceGroupInfo& safe_VkBindBufferMemoryDeviceGroupInfo::
     return *this;
 }
 
+safe_VkBindBufferMemoryDeviceGroupInfo::safe_VkBindBufferMemoryDeviceGroupInfo(
+    safe_VkBindBufferMemoryDeviceGroupInfo&& move_src) noexcept
+    : safe_VkBindBufferMemoryDeviceGroupInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindBufferMemoryDeviceGroupInfo& safe_VkBindBufferMemoryDeviceGroupInfo::operator=(
+    safe_VkBindBufferMemoryDeviceGroupInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceIndexCount, move_src.deviceIndexCount);
+    std::swap(pDeviceIndices, move_src.pDeviceIndices);
+
+    return *this;
+}
+
 safe_VkBindBufferMemoryDeviceGroupInfo::~safe_VkBindBufferMemoryDeviceGroupInfo() {
     if (pDeviceIndices) delete[] pDeviceIndices;
     FreePnextChain(pNext);
@@ -6999,6 +8264,26 @@ safe_VkBindImageMemoryDeviceGroupInfo& safe_VkBindImageMemoryDeviceGroupInfo::op
     return *this;
 }
 
+safe_VkBindImageMemoryDeviceGroupInfo::safe_VkBindImageMemoryDeviceGroupInfo(
+    safe_VkBindImageMemoryDeviceGroupInfo&& move_src) noexcept
+    : safe_VkBindImageMemoryDeviceGroupInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindImageMemoryDeviceGroupInfo& safe_VkBindImageMemoryDeviceGroupInfo::operator=(
+    safe_VkBindImageMemoryDeviceGroupInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceIndexCount, move_src.deviceIndexCount);
+    std::swap(pDeviceIndices, move_src.pDeviceIndices);
+    std::swap(splitInstanceBindRegionCount, move_src.splitInstanceBindRegionCount);
+    std::swap(pSplitInstanceBindRegions, move_src.pSplitInstanceBindRegions);
+
+    return *this;
+}
+
 safe_VkBindImageMemoryDeviceGroupInfo::~safe_VkBindImageMemoryDeviceGroupInfo() {
     if (pDeviceIndices) delete[] pDeviceIndices;
     if (pSplitInstanceBindRegions) delete[] pSplitInstanceBindRegions;
@@ -7094,6 +8379,24 @@ safe_VkPhysicalDeviceGroupProperties& safe_VkPhysicalDeviceGroupProperties::oper
     return *this;
 }
 
+safe_VkPhysicalDeviceGroupProperties::safe_VkPhysicalDeviceGroupProperties(safe_VkPhysicalDeviceGroupProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceGroupProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceGroupProperties& safe_VkPhysicalDeviceGroupProperties::operator=(
+    safe_VkPhysicalDeviceGroupProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(physicalDeviceCount, move_src.physicalDeviceCount);
+    std::swap(physicalDevices, move_src.physicalDevices);
+    std::swap(subsetAllocation, move_src.subsetAllocation);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceGroupProperties::~safe_VkPhysicalDeviceGroupProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceGroupProperties::initialize(const VkPhysicalDeviceGroupProperties* in_struct,
@@ -7169,9 +8472,26 @@ safe_VkDeviceGroupDeviceCreateInfo& safe_VkDeviceGroupDeviceCreateInfo::operator
     return *this;
 }
 
-safe_VkDeviceGroupDeviceCreateInfo::~safe_VkDeviceGroupDeviceCreateInfo() {
-    if (pPhysicalDevices) delete[] pPhysicalDevices;
-    FreePnextChain(pNext);
+safe_VkDeviceGroupDeviceCreateInfo::safe_VkDeviceGroupDeviceCreateInfo(safe_VkDeviceGroupDeviceCreateInfo&& move_src) noexcept
+    : safe_VkDeviceGroupDeviceCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceGroupDeviceCreateInfo& safe_VkDeviceGroupDeviceCreateInfo::operator=(
+    safe_VkDeviceGroupDeviceCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(physicalDeviceCount, move_src.physicalDeviceCount);
+    std::swap(pPhysicalDevices, move_src.pPhysicalDevices);
+
+    return *this;
+}
+
+safe_VkDeviceGroupDeviceCreateInfo::~safe_VkDeviceGroupDeviceCreateInfo() {
+    if (pPhysicalDevices) delete[] pPhysicalDevices;
+    FreePnextChain(pNext);
 }
 
 void safe_VkDeviceGroupDeviceCreateInfo::initialize(const VkDeviceGroupDeviceCreateInfo* in_struct,
@@ -7235,6 +8555,22 @@ safe_VkBufferMemoryRequirementsInfo2& safe_VkBufferMemoryRequirementsInfo2::oper
     return *this;
 }
 
+safe_VkBufferMemoryRequirementsInfo2::safe_VkBufferMemoryRequirementsInfo2(safe_VkBufferMemoryRequirementsInfo2&& move_src) noexcept
+    : safe_VkBufferMemoryRequirementsInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferMemoryRequirementsInfo2& safe_VkBufferMemoryRequirementsInfo2::operator=(
+    safe_VkBufferMemoryRequirementsInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(buffer, move_src.buffer);
+
+    return *this;
+}
+
 safe_VkBufferMemoryRequirementsInfo2::~safe_VkBufferMemoryRequirementsInfo2() { FreePnextChain(pNext); }
 
 void safe_VkBufferMemoryRequirementsInfo2::initialize(const VkBufferMemoryRequirementsInfo2* in_struct,
@@ -7283,6 +8619,22 @@ safe_VkImageMemoryRequirementsInfo2& safe_VkImageMemoryRequirementsInfo2::operat
     return *this;
 }
 
+safe_VkImageMemoryRequirementsInfo2::safe_VkImageMemoryRequirementsInfo2(safe_VkImageMemoryRequirementsInfo2&& move_src) noexcept
+    : safe_VkImageMemoryRequirementsInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageMemoryRequirementsInfo2& safe_VkImageMemoryRequirementsInfo2::operator=(
+    safe_VkImageMemoryRequirementsInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(image, move_src.image);
+
+    return *this;
+}
+
 safe_VkImageMemoryRequirementsInfo2::~safe_VkImageMemoryRequirementsInfo2() { FreePnextChain(pNext); }
 
 void safe_VkImageMemoryRequirementsInfo2::initialize(const VkImageMemoryRequirementsInfo2* in_struct,
@@ -7331,6 +8683,23 @@ safe_VkImageSparseMemoryRequirementsInfo2& safe_VkImageSparseMemoryRequirementsI
     return *this;
 }
 
+safe_VkImageSparseMemoryRequirementsInfo2::safe_VkImageSparseMemoryRequirementsInfo2(
+    safe_VkImageSparseMemoryRequirementsInfo2&& move_src) noexcept
+    : safe_VkImageSparseMemoryRequirementsInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageSparseMemoryRequirementsInfo2& safe_VkImageSparseMemoryRequirementsInfo2::operator=(
+    safe_VkImageSparseMemoryRequirementsInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(image, move_src.image);
+
+    return *this;
+}
+
 safe_VkImageSparseMemoryRequirementsInfo2::~safe_VkImageSparseMemoryRequirementsInfo2() { FreePnextChain(pNext); }
 
 void safe_VkImageSparseMemoryRequirementsInfo2::initialize(const VkImageSparseMemoryRequirementsInfo2* in_struct,
@@ -7377,6 +8746,21 @@ safe_VkMemoryRequirements2& safe_VkMemoryRequirements2::operator=(const safe_VkM
     return *this;
 }
 
+safe_VkMemoryRequirements2::safe_VkMemoryRequirements2(safe_VkMemoryRequirements2&& move_src) noexcept
+    : safe_VkMemoryRequirements2() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryRequirements2& safe_VkMemoryRequirements2::operator=(safe_VkMemoryRequirements2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryRequirements, move_src.memoryRequirements);
+
+    return *this;
+}
+
 safe_VkMemoryRequirements2::~safe_VkMemoryRequirements2() { FreePnextChain(pNext); }
 
 void safe_VkMemoryRequirements2::initialize(const VkMemoryRequirements2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -7425,6 +8809,23 @@ safe_VkSparseImageMemoryRequirements2& safe_VkSparseImageMemoryRequirements2::op
     return *this;
 }
 
+safe_VkSparseImageMemoryRequirements2::safe_VkSparseImageMemoryRequirements2(
+    safe_VkSparseImageMemoryRequirements2&& move_src) noexcept
+    : safe_VkSparseImageMemoryRequirements2() {
+    *this = std::move(move_src);
+}
+
+safe_VkSparseImageMemoryRequirements2& safe_VkSparseImageMemoryRequirements2::operator=(
+    safe_VkSparseImageMemoryRequirements2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryRequirements, move_src.memoryRequirements);
+
+    return *this;
+}
+
 safe_VkSparseImageMemoryRequirements2::~safe_VkSparseImageMemoryRequirements2() { FreePnextChain(pNext); }
 
 void safe_VkSparseImageMemoryRequirements2::initialize(const VkSparseImageMemoryRequirements2* in_struct,
@@ -7471,6 +8872,21 @@ safe_VkPhysicalDeviceFeatures2& safe_VkPhysicalDeviceFeatures2::operator=(const
     return *this;
 }
 
+safe_VkPhysicalDeviceFeatures2::safe_VkPhysicalDeviceFeatures2(safe_VkPhysicalDeviceFeatures2&& move_src) noexcept
+    : safe_VkPhysicalDeviceFeatures2() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFeatures2& safe_VkPhysicalDeviceFeatures2::operator=(safe_VkPhysicalDeviceFeatures2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(features, move_src.features);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFeatures2::~safe_VkPhysicalDeviceFeatures2() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceFeatures2::initialize(const VkPhysicalDeviceFeatures2* in_struct,
@@ -7517,6 +8933,22 @@ safe_VkPhysicalDeviceProperties2& safe_VkPhysicalDeviceProperties2::operator=(co
     return *this;
 }
 
+safe_VkPhysicalDeviceProperties2::safe_VkPhysicalDeviceProperties2(safe_VkPhysicalDeviceProperties2&& move_src) noexcept
+    : safe_VkPhysicalDeviceProperties2() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceProperties2& safe_VkPhysicalDeviceProperties2::operator=(
+    safe_VkPhysicalDeviceProperties2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(properties, move_src.properties);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceProperties2::~safe_VkPhysicalDeviceProperties2() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceProperties2::initialize(const VkPhysicalDeviceProperties2* in_struct,
@@ -7563,6 +8995,20 @@ safe_VkFormatProperties2& safe_VkFormatProperties2::operator=(const safe_VkForma
     return *this;
 }
 
+safe_VkFormatProperties2::safe_VkFormatProperties2(safe_VkFormatProperties2&& move_src) noexcept : safe_VkFormatProperties2() {
+    *this = std::move(move_src);
+}
+
+safe_VkFormatProperties2& safe_VkFormatProperties2::operator=(safe_VkFormatProperties2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(formatProperties, move_src.formatProperties);
+
+    return *this;
+}
+
 safe_VkFormatProperties2::~safe_VkFormatProperties2() { FreePnextChain(pNext); }
 
 void safe_VkFormatProperties2::initialize(const VkFormatProperties2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -7607,6 +9053,21 @@ safe_VkImageFormatProperties2& safe_VkImageFormatProperties2::operator=(const sa
     return *this;
 }
 
+safe_VkImageFormatProperties2::safe_VkImageFormatProperties2(safe_VkImageFormatProperties2&& move_src) noexcept
+    : safe_VkImageFormatProperties2() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageFormatProperties2& safe_VkImageFormatProperties2::operator=(safe_VkImageFormatProperties2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageFormatProperties, move_src.imageFormatProperties);
+
+    return *this;
+}
+
 safe_VkImageFormatProperties2::~safe_VkImageFormatProperties2() { FreePnextChain(pNext); }
 
 void safe_VkImageFormatProperties2::initialize(const VkImageFormatProperties2* in_struct,
@@ -7669,6 +9130,27 @@ safe_VkPhysicalDeviceImageFormatInfo2& safe_VkPhysicalDeviceImageFormatInfo2::op
     return *this;
 }
 
+safe_VkPhysicalDeviceImageFormatInfo2::safe_VkPhysicalDeviceImageFormatInfo2(
+    safe_VkPhysicalDeviceImageFormatInfo2&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageFormatInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageFormatInfo2& safe_VkPhysicalDeviceImageFormatInfo2::operator=(
+    safe_VkPhysicalDeviceImageFormatInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(format, move_src.format);
+    std::swap(type, move_src.type);
+    std::swap(tiling, move_src.tiling);
+    std::swap(usage, move_src.usage);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageFormatInfo2::~safe_VkPhysicalDeviceImageFormatInfo2() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceImageFormatInfo2::initialize(const VkPhysicalDeviceImageFormatInfo2* in_struct,
@@ -7723,6 +9205,21 @@ safe_VkQueueFamilyProperties2& safe_VkQueueFamilyProperties2::operator=(const sa
     return *this;
 }
 
+safe_VkQueueFamilyProperties2::safe_VkQueueFamilyProperties2(safe_VkQueueFamilyProperties2&& move_src) noexcept
+    : safe_VkQueueFamilyProperties2() {
+    *this = std::move(move_src);
+}
+
+safe_VkQueueFamilyProperties2& safe_VkQueueFamilyProperties2::operator=(safe_VkQueueFamilyProperties2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(queueFamilyProperties, move_src.queueFamilyProperties);
+
+    return *this;
+}
+
 safe_VkQueueFamilyProperties2::~safe_VkQueueFamilyProperties2() { FreePnextChain(pNext); }
 
 void safe_VkQueueFamilyProperties2::initialize(const VkQueueFamilyProperties2* in_struct,
@@ -7772,6 +9269,23 @@ safe_VkPhysicalDeviceMemoryProperties2& safe_VkPhysicalDeviceMemoryProperties2::
     return *this;
 }
 
+safe_VkPhysicalDeviceMemoryProperties2::safe_VkPhysicalDeviceMemoryProperties2(
+    safe_VkPhysicalDeviceMemoryProperties2&& move_src) noexcept
+    : safe_VkPhysicalDeviceMemoryProperties2() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMemoryProperties2& safe_VkPhysicalDeviceMemoryProperties2::operator=(
+    safe_VkPhysicalDeviceMemoryProperties2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryProperties, move_src.memoryProperties);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMemoryProperties2::~safe_VkPhysicalDeviceMemoryProperties2() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMemoryProperties2::initialize(const VkPhysicalDeviceMemoryProperties2* in_struct,
@@ -7820,6 +9334,22 @@ safe_VkSparseImageFormatProperties2& safe_VkSparseImageFormatProperties2::operat
     return *this;
 }
 
+safe_VkSparseImageFormatProperties2::safe_VkSparseImageFormatProperties2(safe_VkSparseImageFormatProperties2&& move_src) noexcept
+    : safe_VkSparseImageFormatProperties2() {
+    *this = std::move(move_src);
+}
+
+safe_VkSparseImageFormatProperties2& safe_VkSparseImageFormatProperties2::operator=(
+    safe_VkSparseImageFormatProperties2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(properties, move_src.properties);
+
+    return *this;
+}
+
 safe_VkSparseImageFormatProperties2::~safe_VkSparseImageFormatProperties2() { FreePnextChain(pNext); }
 
 void safe_VkSparseImageFormatProperties2::initialize(const VkSparseImageFormatProperties2* in_struct,
@@ -7887,6 +9417,27 @@ safe_VkPhysicalDeviceSparseImageFormatInfo2& safe_VkPhysicalDeviceSparseImageFor
     return *this;
 }
 
+safe_VkPhysicalDeviceSparseImageFormatInfo2::safe_VkPhysicalDeviceSparseImageFormatInfo2(
+    safe_VkPhysicalDeviceSparseImageFormatInfo2&& move_src) noexcept
+    : safe_VkPhysicalDeviceSparseImageFormatInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSparseImageFormatInfo2& safe_VkPhysicalDeviceSparseImageFormatInfo2::operator=(
+    safe_VkPhysicalDeviceSparseImageFormatInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(format, move_src.format);
+    std::swap(type, move_src.type);
+    std::swap(samples, move_src.samples);
+    std::swap(usage, move_src.usage);
+    std::swap(tiling, move_src.tiling);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSparseImageFormatInfo2::~safe_VkPhysicalDeviceSparseImageFormatInfo2() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceSparseImageFormatInfo2::initialize(const VkPhysicalDeviceSparseImageFormatInfo2* in_struct,
@@ -7943,6 +9494,23 @@ safe_VkPhysicalDevicePointClippingProperties& safe_VkPhysicalDevicePointClipping
     return *this;
 }
 
+safe_VkPhysicalDevicePointClippingProperties::safe_VkPhysicalDevicePointClippingProperties(
+    safe_VkPhysicalDevicePointClippingProperties&& move_src) noexcept
+    : safe_VkPhysicalDevicePointClippingProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePointClippingProperties& safe_VkPhysicalDevicePointClippingProperties::operator=(
+    safe_VkPhysicalDevicePointClippingProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pointClippingBehavior, move_src.pointClippingBehavior);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePointClippingProperties::~safe_VkPhysicalDevicePointClippingProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePointClippingProperties::initialize(const VkPhysicalDevicePointClippingProperties* in_struct,
@@ -8014,6 +9582,24 @@ safe_VkRenderPassInputAttachmentAspectCreateInfo& safe_VkRenderPassInputAttachme
     return *this;
 }
 
+safe_VkRenderPassInputAttachmentAspectCreateInfo::safe_VkRenderPassInputAttachmentAspectCreateInfo(
+    safe_VkRenderPassInputAttachmentAspectCreateInfo&& move_src) noexcept
+    : safe_VkRenderPassInputAttachmentAspectCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassInputAttachmentAspectCreateInfo& safe_VkRenderPassInputAttachmentAspectCreateInfo::operator=(
+    safe_VkRenderPassInputAttachmentAspectCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(aspectReferenceCount, move_src.aspectReferenceCount);
+    std::swap(pAspectReferences, move_src.pAspectReferences);
+
+    return *this;
+}
+
 safe_VkRenderPassInputAttachmentAspectCreateInfo::~safe_VkRenderPassInputAttachmentAspectCreateInfo() {
     if (pAspectReferences) delete[] pAspectReferences;
     FreePnextChain(pNext);
@@ -8078,6 +9664,21 @@ safe_VkImageViewUsageCreateInfo& safe_VkImageViewUsageCreateInfo::operator=(cons
     return *this;
 }
 
+safe_VkImageViewUsageCreateInfo::safe_VkImageViewUsageCreateInfo(safe_VkImageViewUsageCreateInfo&& move_src) noexcept
+    : safe_VkImageViewUsageCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageViewUsageCreateInfo& safe_VkImageViewUsageCreateInfo::operator=(safe_VkImageViewUsageCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(usage, move_src.usage);
+
+    return *this;
+}
+
 safe_VkImageViewUsageCreateInfo::~safe_VkImageViewUsageCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkImageViewUsageCreateInfo::initialize(const VkImageViewUsageCreateInfo* in_struct,
@@ -8127,6 +9728,23 @@ safe_VkPipelineTessellationDomainOriginStateCreateInfo& safe_VkPipelineTessellat
     return *this;
 }
 
+safe_VkPipelineTessellationDomainOriginStateCreateInfo::safe_VkPipelineTessellationDomainOriginStateCreateInfo(
+    safe_VkPipelineTessellationDomainOriginStateCreateInfo&& move_src) noexcept
+    : safe_VkPipelineTessellationDomainOriginStateCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineTessellationDomainOriginStateCreateInfo& safe_VkPipelineTessellationDomainOriginStateCreateInfo::operator=(
+    safe_VkPipelineTessellationDomainOriginStateCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(domainOrigin, move_src.domainOrigin);
+
+    return *this;
+}
+
 safe_VkPipelineTessellationDomainOriginStateCreateInfo::~safe_VkPipelineTessellationDomainOriginStateCreateInfo() {
     FreePnextChain(pNext);
 }
@@ -8247,6 +9865,27 @@ safe_VkRenderPassMultiviewCreateInfo& safe_VkRenderPassMultiviewCreateInfo::oper
     return *this;
 }
 
+safe_VkRenderPassMultiviewCreateInfo::safe_VkRenderPassMultiviewCreateInfo(safe_VkRenderPassMultiviewCreateInfo&& move_src) noexcept
+    : safe_VkRenderPassMultiviewCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassMultiviewCreateInfo& safe_VkRenderPassMultiviewCreateInfo::operator=(
+    safe_VkRenderPassMultiviewCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(subpassCount, move_src.subpassCount);
+    std::swap(pViewMasks, move_src.pViewMasks);
+    std::swap(dependencyCount, move_src.dependencyCount);
+    std::swap(pViewOffsets, move_src.pViewOffsets);
+    std::swap(correlationMaskCount, move_src.correlationMaskCount);
+    std::swap(pCorrelationMasks, move_src.pCorrelationMasks);
+
+    return *this;
+}
+
 safe_VkRenderPassMultiviewCreateInfo::~safe_VkRenderPassMultiviewCreateInfo() {
     if (pViewMasks) delete[] pViewMasks;
     if (pViewOffsets) delete[] pViewOffsets;
@@ -8355,6 +9994,25 @@ safe_VkPhysicalDeviceMultiviewFeatures& safe_VkPhysicalDeviceMultiviewFeatures::
     return *this;
 }
 
+safe_VkPhysicalDeviceMultiviewFeatures::safe_VkPhysicalDeviceMultiviewFeatures(
+    safe_VkPhysicalDeviceMultiviewFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceMultiviewFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMultiviewFeatures& safe_VkPhysicalDeviceMultiviewFeatures::operator=(
+    safe_VkPhysicalDeviceMultiviewFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(multiview, move_src.multiview);
+    std::swap(multiviewGeometryShader, move_src.multiviewGeometryShader);
+    std::swap(multiviewTessellationShader, move_src.multiviewTessellationShader);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMultiviewFeatures::~safe_VkPhysicalDeviceMultiviewFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMultiviewFeatures::initialize(const VkPhysicalDeviceMultiviewFeatures* in_struct,
@@ -8414,6 +10072,24 @@ safe_VkPhysicalDeviceMultiviewProperties& safe_VkPhysicalDeviceMultiviewProperti
     return *this;
 }
 
+safe_VkPhysicalDeviceMultiviewProperties::safe_VkPhysicalDeviceMultiviewProperties(
+    safe_VkPhysicalDeviceMultiviewProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceMultiviewProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMultiviewProperties& safe_VkPhysicalDeviceMultiviewProperties::operator=(
+    safe_VkPhysicalDeviceMultiviewProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxMultiviewViewCount, move_src.maxMultiviewViewCount);
+    std::swap(maxMultiviewInstanceIndex, move_src.maxMultiviewInstanceIndex);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMultiviewProperties::~safe_VkPhysicalDeviceMultiviewProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMultiviewProperties::initialize(const VkPhysicalDeviceMultiviewProperties* in_struct,
@@ -8471,6 +10147,24 @@ safe_VkPhysicalDeviceVariablePointersFeatures& safe_VkPhysicalDeviceVariablePoin
     return *this;
 }
 
+safe_VkPhysicalDeviceVariablePointersFeatures::safe_VkPhysicalDeviceVariablePointersFeatures(
+    safe_VkPhysicalDeviceVariablePointersFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceVariablePointersFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVariablePointersFeatures& safe_VkPhysicalDeviceVariablePointersFeatures::operator=(
+    safe_VkPhysicalDeviceVariablePointersFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(variablePointersStorageBuffer, move_src.variablePointersStorageBuffer);
+    std::swap(variablePointers, move_src.variablePointers);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVariablePointersFeatures::~safe_VkPhysicalDeviceVariablePointersFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceVariablePointersFeatures::initialize(const VkPhysicalDeviceVariablePointersFeatures* in_struct,
@@ -8521,6 +10215,23 @@ safe_VkPhysicalDeviceProtectedMemoryFeatures& safe_VkPhysicalDeviceProtectedMemo
     return *this;
 }
 
+safe_VkPhysicalDeviceProtectedMemoryFeatures::safe_VkPhysicalDeviceProtectedMemoryFeatures(
+    safe_VkPhysicalDeviceProtectedMemoryFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceProtectedMemoryFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceProtectedMemoryFeatures& safe_VkPhysicalDeviceProtectedMemoryFeatures::operator=(
+    safe_VkPhysicalDeviceProtectedMemoryFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(protectedMemory, move_src.protectedMemory);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceProtectedMemoryFeatures::~safe_VkPhysicalDeviceProtectedMemoryFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceProtectedMemoryFeatures::initialize(const VkPhysicalDeviceProtectedMemoryFeatures* in_struct,
@@ -8569,6 +10280,23 @@ safe_VkPhysicalDeviceProtectedMemoryProperties& safe_VkPhysicalDeviceProtectedMe
     return *this;
 }
 
+safe_VkPhysicalDeviceProtectedMemoryProperties::safe_VkPhysicalDeviceProtectedMemoryProperties(
+    safe_VkPhysicalDeviceProtectedMemoryProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceProtectedMemoryProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceProtectedMemoryProperties& safe_VkPhysicalDeviceProtectedMemoryProperties::operator=(
+    safe_VkPhysicalDeviceProtectedMemoryProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(protectedNoFault, move_src.protectedNoFault);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceProtectedMemoryProperties::~safe_VkPhysicalDeviceProtectedMemoryProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceProtectedMemoryProperties::initialize(const VkPhysicalDeviceProtectedMemoryProperties* in_struct,
@@ -8622,6 +10350,22 @@ safe_VkDeviceQueueInfo2& safe_VkDeviceQueueInfo2::operator=(const safe_VkDeviceQ
     return *this;
 }
 
+safe_VkDeviceQueueInfo2::safe_VkDeviceQueueInfo2(safe_VkDeviceQueueInfo2&& move_src) noexcept : safe_VkDeviceQueueInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceQueueInfo2& safe_VkDeviceQueueInfo2::operator=(safe_VkDeviceQueueInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(queueFamilyIndex, move_src.queueFamilyIndex);
+    std::swap(queueIndex, move_src.queueIndex);
+
+    return *this;
+}
+
 safe_VkDeviceQueueInfo2::~safe_VkDeviceQueueInfo2() { FreePnextChain(pNext); }
 
 void safe_VkDeviceQueueInfo2::initialize(const VkDeviceQueueInfo2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -8670,6 +10414,21 @@ safe_VkProtectedSubmitInfo& safe_VkProtectedSubmitInfo::operator=(const safe_VkP
     return *this;
 }
 
+safe_VkProtectedSubmitInfo::safe_VkProtectedSubmitInfo(safe_VkProtectedSubmitInfo&& move_src) noexcept
+    : safe_VkProtectedSubmitInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkProtectedSubmitInfo& safe_VkProtectedSubmitInfo::operator=(safe_VkProtectedSubmitInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(protectedSubmit, move_src.protectedSubmit);
+
+    return *this;
+}
+
 safe_VkProtectedSubmitInfo::~safe_VkProtectedSubmitInfo() { FreePnextChain(pNext); }
 
 void safe_VkProtectedSubmitInfo::initialize(const VkProtectedSubmitInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -8748,6 +10507,30 @@ safe_VkSamplerYcbcrConversionCreateInfo& safe_VkSamplerYcbcrConversionCreateInfo
     return *this;
 }
 
+safe_VkSamplerYcbcrConversionCreateInfo::safe_VkSamplerYcbcrConversionCreateInfo(
+    safe_VkSamplerYcbcrConversionCreateInfo&& move_src) noexcept
+    : safe_VkSamplerYcbcrConversionCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSamplerYcbcrConversionCreateInfo& safe_VkSamplerYcbcrConversionCreateInfo::operator=(
+    safe_VkSamplerYcbcrConversionCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(format, move_src.format);
+    std::swap(ycbcrModel, move_src.ycbcrModel);
+    std::swap(ycbcrRange, move_src.ycbcrRange);
+    std::swap(components, move_src.components);
+    std::swap(xChromaOffset, move_src.xChromaOffset);
+    std::swap(yChromaOffset, move_src.yChromaOffset);
+    std::swap(chromaFilter, move_src.chromaFilter);
+    std::swap(forceExplicitReconstruction, move_src.forceExplicitReconstruction);
+
+    return *this;
+}
+
 safe_VkSamplerYcbcrConversionCreateInfo::~safe_VkSamplerYcbcrConversionCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkSamplerYcbcrConversionCreateInfo::initialize(const VkSamplerYcbcrConversionCreateInfo* in_struct,
@@ -8808,6 +10591,22 @@ safe_VkSamplerYcbcrConversionInfo& safe_VkSamplerYcbcrConversionInfo::operator=(
     return *this;
 }
 
+safe_VkSamplerYcbcrConversionInfo::safe_VkSamplerYcbcrConversionInfo(safe_VkSamplerYcbcrConversionInfo&& move_src) noexcept
+    : safe_VkSamplerYcbcrConversionInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSamplerYcbcrConversionInfo& safe_VkSamplerYcbcrConversionInfo::operator=(
+    safe_VkSamplerYcbcrConversionInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(conversion, move_src.conversion);
+
+    return *this;
+}
+
 safe_VkSamplerYcbcrConversionInfo::~safe_VkSamplerYcbcrConversionInfo() { FreePnextChain(pNext); }
 
 void safe_VkSamplerYcbcrConversionInfo::initialize(const VkSamplerYcbcrConversionInfo* in_struct,
@@ -8854,6 +10653,21 @@ safe_VkBindImagePlaneMemoryInfo& safe_VkBindImagePlaneMemoryInfo::operator=(cons
     return *this;
 }
 
+safe_VkBindImagePlaneMemoryInfo::safe_VkBindImagePlaneMemoryInfo(safe_VkBindImagePlaneMemoryInfo&& move_src) noexcept
+    : safe_VkBindImagePlaneMemoryInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindImagePlaneMemoryInfo& safe_VkBindImagePlaneMemoryInfo::operator=(safe_VkBindImagePlaneMemoryInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(planeAspect, move_src.planeAspect);
+
+    return *this;
+}
+
 safe_VkBindImagePlaneMemoryInfo::~safe_VkBindImagePlaneMemoryInfo() { FreePnextChain(pNext); }
 
 void safe_VkBindImagePlaneMemoryInfo::initialize(const VkBindImagePlaneMemoryInfo* in_struct,
@@ -8902,6 +10716,23 @@ safe_VkImagePlaneMemoryRequirementsInfo& safe_VkImagePlaneMemoryRequirementsInfo
     return *this;
 }
 
+safe_VkImagePlaneMemoryRequirementsInfo::safe_VkImagePlaneMemoryRequirementsInfo(
+    safe_VkImagePlaneMemoryRequirementsInfo&& move_src) noexcept
+    : safe_VkImagePlaneMemoryRequirementsInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkImagePlaneMemoryRequirementsInfo& safe_VkImagePlaneMemoryRequirementsInfo::operator=(
+    safe_VkImagePlaneMemoryRequirementsInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(planeAspect, move_src.planeAspect);
+
+    return *this;
+}
+
 safe_VkImagePlaneMemoryRequirementsInfo::~safe_VkImagePlaneMemoryRequirementsInfo() { FreePnextChain(pNext); }
 
 void safe_VkImagePlaneMemoryRequirementsInfo::initialize(const VkImagePlaneMemoryRequirementsInfo* in_struct,
@@ -8950,6 +10781,23 @@ safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& safe_VkPhysicalDeviceSample
     return *this;
 }
 
+safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures::safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures(
+    safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures::operator=(
+    safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(samplerYcbcrConversion, move_src.samplerYcbcrConversion);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures::~safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures() {
     FreePnextChain(pNext);
 }
@@ -9002,6 +10850,23 @@ safe_VkSamplerYcbcrConversionImageFormatProperties& safe_VkSamplerYcbcrConversio
     return *this;
 }
 
+safe_VkSamplerYcbcrConversionImageFormatProperties::safe_VkSamplerYcbcrConversionImageFormatProperties(
+    safe_VkSamplerYcbcrConversionImageFormatProperties&& move_src) noexcept
+    : safe_VkSamplerYcbcrConversionImageFormatProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkSamplerYcbcrConversionImageFormatProperties& safe_VkSamplerYcbcrConversionImageFormatProperties::operator=(
+    safe_VkSamplerYcbcrConversionImageFormatProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(combinedImageSamplerDescriptorCount, move_src.combinedImageSamplerDescriptorCount);
+
+    return *this;
+}
+
 safe_VkSamplerYcbcrConversionImageFormatProperties::~safe_VkSamplerYcbcrConversionImageFormatProperties() { FreePnextChain(pNext); }
 
 void safe_VkSamplerYcbcrConversionImageFormatProperties::initialize(const VkSamplerYcbcrConversionImageFormatProperties* in_struct,
@@ -9099,6 +10964,30 @@ safe_VkDescriptorUpdateTemplateCreateInfo& safe_VkDescriptorUpdateTemplateCreate
     return *this;
 }
 
+safe_VkDescriptorUpdateTemplateCreateInfo::safe_VkDescriptorUpdateTemplateCreateInfo(
+    safe_VkDescriptorUpdateTemplateCreateInfo&& move_src) noexcept
+    : safe_VkDescriptorUpdateTemplateCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorUpdateTemplateCreateInfo& safe_VkDescriptorUpdateTemplateCreateInfo::operator=(
+    safe_VkDescriptorUpdateTemplateCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(descriptorUpdateEntryCount, move_src.descriptorUpdateEntryCount);
+    std::swap(pDescriptorUpdateEntries, move_src.pDescriptorUpdateEntries);
+    std::swap(templateType, move_src.templateType);
+    std::swap(descriptorSetLayout, move_src.descriptorSetLayout);
+    std::swap(pipelineBindPoint, move_src.pipelineBindPoint);
+    std::swap(pipelineLayout, move_src.pipelineLayout);
+    std::swap(set, move_src.set);
+
+    return *this;
+}
+
 safe_VkDescriptorUpdateTemplateCreateInfo::~safe_VkDescriptorUpdateTemplateCreateInfo() {
     if (pDescriptorUpdateEntries) delete[] pDescriptorUpdateEntries;
     FreePnextChain(pNext);
@@ -9177,6 +11066,23 @@ safe_VkPhysicalDeviceExternalImageFormatInfo& safe_VkPhysicalDeviceExternalImage
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalImageFormatInfo::safe_VkPhysicalDeviceExternalImageFormatInfo(
+    safe_VkPhysicalDeviceExternalImageFormatInfo&& move_src) noexcept
+    : safe_VkPhysicalDeviceExternalImageFormatInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExternalImageFormatInfo& safe_VkPhysicalDeviceExternalImageFormatInfo::operator=(
+    safe_VkPhysicalDeviceExternalImageFormatInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalImageFormatInfo::~safe_VkPhysicalDeviceExternalImageFormatInfo() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceExternalImageFormatInfo::initialize(const VkPhysicalDeviceExternalImageFormatInfo* in_struct,
@@ -9225,6 +11131,22 @@ safe_VkExternalImageFormatProperties& safe_VkExternalImageFormatProperties::oper
     return *this;
 }
 
+safe_VkExternalImageFormatProperties::safe_VkExternalImageFormatProperties(safe_VkExternalImageFormatProperties&& move_src) noexcept
+    : safe_VkExternalImageFormatProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkExternalImageFormatProperties& safe_VkExternalImageFormatProperties::operator=(
+    safe_VkExternalImageFormatProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(externalMemoryProperties, move_src.externalMemoryProperties);
+
+    return *this;
+}
+
 safe_VkExternalImageFormatProperties::~safe_VkExternalImageFormatProperties() { FreePnextChain(pNext); }
 
 void safe_VkExternalImageFormatProperties::initialize(const VkExternalImageFormatProperties* in_struct,
@@ -9277,6 +11199,25 @@ safe_VkPhysicalDeviceExternalBufferInfo& safe_VkPhysicalDeviceExternalBufferInfo
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalBufferInfo::safe_VkPhysicalDeviceExternalBufferInfo(
+    safe_VkPhysicalDeviceExternalBufferInfo&& move_src) noexcept
+    : safe_VkPhysicalDeviceExternalBufferInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExternalBufferInfo& safe_VkPhysicalDeviceExternalBufferInfo::operator=(
+    safe_VkPhysicalDeviceExternalBufferInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(usage, move_src.usage);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalBufferInfo::~safe_VkPhysicalDeviceExternalBufferInfo() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceExternalBufferInfo::initialize(const VkPhysicalDeviceExternalBufferInfo* in_struct,
@@ -9327,6 +11268,21 @@ safe_VkExternalBufferProperties& safe_VkExternalBufferProperties::operator=(cons
     return *this;
 }
 
+safe_VkExternalBufferProperties::safe_VkExternalBufferProperties(safe_VkExternalBufferProperties&& move_src) noexcept
+    : safe_VkExternalBufferProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkExternalBufferProperties& safe_VkExternalBufferProperties::operator=(safe_VkExternalBufferProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(externalMemoryProperties, move_src.externalMemoryProperties);
+
+    return *this;
+}
+
 safe_VkExternalBufferProperties::~safe_VkExternalBufferProperties() { FreePnextChain(pNext); }
 
 void safe_VkExternalBufferProperties::initialize(const VkExternalBufferProperties* in_struct,
@@ -9410,6 +11366,26 @@ safe_VkPhysicalDeviceIDProperties& safe_VkPhysicalDeviceIDProperties::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceIDProperties::safe_VkPhysicalDeviceIDProperties(safe_VkPhysicalDeviceIDProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceIDProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceIDProperties& safe_VkPhysicalDeviceIDProperties::operator=(
+    safe_VkPhysicalDeviceIDProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceUUID, move_src.deviceUUID);
+    std::swap(driverUUID, move_src.driverUUID);
+    std::swap(deviceLUID, move_src.deviceLUID);
+    std::swap(deviceNodeMask, move_src.deviceNodeMask);
+    std::swap(deviceLUIDValid, move_src.deviceLUIDValid);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceIDProperties::~safe_VkPhysicalDeviceIDProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceIDProperties::initialize(const VkPhysicalDeviceIDProperties* in_struct,
@@ -9484,6 +11460,22 @@ safe_VkExternalMemoryImageCreateInfo& safe_VkExternalMemoryImageCreateInfo::oper
     return *this;
 }
 
+safe_VkExternalMemoryImageCreateInfo::safe_VkExternalMemoryImageCreateInfo(safe_VkExternalMemoryImageCreateInfo&& move_src) noexcept
+    : safe_VkExternalMemoryImageCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkExternalMemoryImageCreateInfo& safe_VkExternalMemoryImageCreateInfo::operator=(
+    safe_VkExternalMemoryImageCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleTypes, move_src.handleTypes);
+
+    return *this;
+}
+
 safe_VkExternalMemoryImageCreateInfo::~safe_VkExternalMemoryImageCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkExternalMemoryImageCreateInfo::initialize(const VkExternalMemoryImageCreateInfo* in_struct,
@@ -9533,6 +11525,23 @@ safe_VkExternalMemoryBufferCreateInfo& safe_VkExternalMemoryBufferCreateInfo::op
     return *this;
 }
 
+safe_VkExternalMemoryBufferCreateInfo::safe_VkExternalMemoryBufferCreateInfo(
+    safe_VkExternalMemoryBufferCreateInfo&& move_src) noexcept
+    : safe_VkExternalMemoryBufferCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkExternalMemoryBufferCreateInfo& safe_VkExternalMemoryBufferCreateInfo::operator=(
+    safe_VkExternalMemoryBufferCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleTypes, move_src.handleTypes);
+
+    return *this;
+}
+
 safe_VkExternalMemoryBufferCreateInfo::~safe_VkExternalMemoryBufferCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkExternalMemoryBufferCreateInfo::initialize(const VkExternalMemoryBufferCreateInfo* in_struct,
@@ -9579,6 +11588,21 @@ safe_VkExportMemoryAllocateInfo& safe_VkExportMemoryAllocateInfo::operator=(cons
     return *this;
 }
 
+safe_VkExportMemoryAllocateInfo::safe_VkExportMemoryAllocateInfo(safe_VkExportMemoryAllocateInfo&& move_src) noexcept
+    : safe_VkExportMemoryAllocateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMemoryAllocateInfo& safe_VkExportMemoryAllocateInfo::operator=(safe_VkExportMemoryAllocateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleTypes, move_src.handleTypes);
+
+    return *this;
+}
+
 safe_VkExportMemoryAllocateInfo::~safe_VkExportMemoryAllocateInfo() { FreePnextChain(pNext); }
 
 void safe_VkExportMemoryAllocateInfo::initialize(const VkExportMemoryAllocateInfo* in_struct,
@@ -9628,6 +11652,23 @@ safe_VkPhysicalDeviceExternalFenceInfo& safe_VkPhysicalDeviceExternalFenceInfo::
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalFenceInfo::safe_VkPhysicalDeviceExternalFenceInfo(
+    safe_VkPhysicalDeviceExternalFenceInfo&& move_src) noexcept
+    : safe_VkPhysicalDeviceExternalFenceInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExternalFenceInfo& safe_VkPhysicalDeviceExternalFenceInfo::operator=(
+    safe_VkPhysicalDeviceExternalFenceInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalFenceInfo::~safe_VkPhysicalDeviceExternalFenceInfo() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceExternalFenceInfo::initialize(const VkPhysicalDeviceExternalFenceInfo* in_struct,
@@ -9685,6 +11726,23 @@ safe_VkExternalFenceProperties& safe_VkExternalFenceProperties::operator=(const
     return *this;
 }
 
+safe_VkExternalFenceProperties::safe_VkExternalFenceProperties(safe_VkExternalFenceProperties&& move_src) noexcept
+    : safe_VkExternalFenceProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkExternalFenceProperties& safe_VkExternalFenceProperties::operator=(safe_VkExternalFenceProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(exportFromImportedHandleTypes, move_src.exportFromImportedHandleTypes);
+    std::swap(compatibleHandleTypes, move_src.compatibleHandleTypes);
+    std::swap(externalFenceFeatures, move_src.externalFenceFeatures);
+
+    return *this;
+}
+
 safe_VkExternalFenceProperties::~safe_VkExternalFenceProperties() { FreePnextChain(pNext); }
 
 void safe_VkExternalFenceProperties::initialize(const VkExternalFenceProperties* in_struct,
@@ -9735,6 +11793,21 @@ safe_VkExportFenceCreateInfo& safe_VkExportFenceCreateInfo::operator=(const safe
     return *this;
 }
 
+safe_VkExportFenceCreateInfo::safe_VkExportFenceCreateInfo(safe_VkExportFenceCreateInfo&& move_src) noexcept
+    : safe_VkExportFenceCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportFenceCreateInfo& safe_VkExportFenceCreateInfo::operator=(safe_VkExportFenceCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleTypes, move_src.handleTypes);
+
+    return *this;
+}
+
 safe_VkExportFenceCreateInfo::~safe_VkExportFenceCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkExportFenceCreateInfo::initialize(const VkExportFenceCreateInfo* in_struct,
@@ -9781,6 +11854,22 @@ safe_VkExportSemaphoreCreateInfo& safe_VkExportSemaphoreCreateInfo::operator=(co
     return *this;
 }
 
+safe_VkExportSemaphoreCreateInfo::safe_VkExportSemaphoreCreateInfo(safe_VkExportSemaphoreCreateInfo&& move_src) noexcept
+    : safe_VkExportSemaphoreCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportSemaphoreCreateInfo& safe_VkExportSemaphoreCreateInfo::operator=(
+    safe_VkExportSemaphoreCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleTypes, move_src.handleTypes);
+
+    return *this;
+}
+
 safe_VkExportSemaphoreCreateInfo::~safe_VkExportSemaphoreCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkExportSemaphoreCreateInfo::initialize(const VkExportSemaphoreCreateInfo* in_struct,
@@ -9829,6 +11918,23 @@ safe_VkPhysicalDeviceExternalSemaphoreInfo& safe_VkPhysicalDeviceExternalSemapho
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalSemaphoreInfo::safe_VkPhysicalDeviceExternalSemaphoreInfo(
+    safe_VkPhysicalDeviceExternalSemaphoreInfo&& move_src) noexcept
+    : safe_VkPhysicalDeviceExternalSemaphoreInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExternalSemaphoreInfo& safe_VkPhysicalDeviceExternalSemaphoreInfo::operator=(
+    safe_VkPhysicalDeviceExternalSemaphoreInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalSemaphoreInfo::~safe_VkPhysicalDeviceExternalSemaphoreInfo() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceExternalSemaphoreInfo::initialize(const VkPhysicalDeviceExternalSemaphoreInfo* in_struct,
@@ -9887,6 +11993,24 @@ safe_VkExternalSemaphoreProperties& safe_VkExternalSemaphoreProperties::operator
     return *this;
 }
 
+safe_VkExternalSemaphoreProperties::safe_VkExternalSemaphoreProperties(safe_VkExternalSemaphoreProperties&& move_src) noexcept
+    : safe_VkExternalSemaphoreProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkExternalSemaphoreProperties& safe_VkExternalSemaphoreProperties::operator=(
+    safe_VkExternalSemaphoreProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(exportFromImportedHandleTypes, move_src.exportFromImportedHandleTypes);
+    std::swap(compatibleHandleTypes, move_src.compatibleHandleTypes);
+    std::swap(externalSemaphoreFeatures, move_src.externalSemaphoreFeatures);
+
+    return *this;
+}
+
 safe_VkExternalSemaphoreProperties::~safe_VkExternalSemaphoreProperties() { FreePnextChain(pNext); }
 
 void safe_VkExternalSemaphoreProperties::initialize(const VkExternalSemaphoreProperties* in_struct,
@@ -9946,6 +12070,24 @@ safe_VkPhysicalDeviceMaintenance3Properties& safe_VkPhysicalDeviceMaintenance3Pr
     return *this;
 }
 
+safe_VkPhysicalDeviceMaintenance3Properties::safe_VkPhysicalDeviceMaintenance3Properties(
+    safe_VkPhysicalDeviceMaintenance3Properties&& move_src) noexcept
+    : safe_VkPhysicalDeviceMaintenance3Properties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMaintenance3Properties& safe_VkPhysicalDeviceMaintenance3Properties::operator=(
+    safe_VkPhysicalDeviceMaintenance3Properties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxPerSetDescriptors, move_src.maxPerSetDescriptors);
+    std::swap(maxMemoryAllocationSize, move_src.maxMemoryAllocationSize);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMaintenance3Properties::~safe_VkPhysicalDeviceMaintenance3Properties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMaintenance3Properties::initialize(const VkPhysicalDeviceMaintenance3Properties* in_struct,
@@ -9994,6 +12136,22 @@ safe_VkDescriptorSetLayoutSupport& safe_VkDescriptorSetLayoutSupport::operator=(
     return *this;
 }
 
+safe_VkDescriptorSetLayoutSupport::safe_VkDescriptorSetLayoutSupport(safe_VkDescriptorSetLayoutSupport&& move_src) noexcept
+    : safe_VkDescriptorSetLayoutSupport() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorSetLayoutSupport& safe_VkDescriptorSetLayoutSupport::operator=(
+    safe_VkDescriptorSetLayoutSupport&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(supported, move_src.supported);
+
+    return *this;
+}
+
 safe_VkDescriptorSetLayoutSupport::~safe_VkDescriptorSetLayoutSupport() { FreePnextChain(pNext); }
 
 void safe_VkDescriptorSetLayoutSupport::initialize(const VkDescriptorSetLayoutSupport* in_struct,
@@ -10042,6 +12200,23 @@ safe_VkPhysicalDeviceShaderDrawParametersFeatures& safe_VkPhysicalDeviceShaderDr
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderDrawParametersFeatures::safe_VkPhysicalDeviceShaderDrawParametersFeatures(
+    safe_VkPhysicalDeviceShaderDrawParametersFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderDrawParametersFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderDrawParametersFeatures& safe_VkPhysicalDeviceShaderDrawParametersFeatures::operator=(
+    safe_VkPhysicalDeviceShaderDrawParametersFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderDrawParameters, move_src.shaderDrawParameters);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderDrawParametersFeatures::~safe_VkPhysicalDeviceShaderDrawParametersFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderDrawParametersFeatures::initialize(const VkPhysicalDeviceShaderDrawParametersFeatures* in_struct,
@@ -10138,6 +12313,34 @@ safe_VkPhysicalDeviceVulkan11Features& safe_VkPhysicalDeviceVulkan11Features::op
     return *this;
 }
 
+safe_VkPhysicalDeviceVulkan11Features::safe_VkPhysicalDeviceVulkan11Features(
+    safe_VkPhysicalDeviceVulkan11Features&& move_src) noexcept
+    : safe_VkPhysicalDeviceVulkan11Features() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVulkan11Features& safe_VkPhysicalDeviceVulkan11Features::operator=(
+    safe_VkPhysicalDeviceVulkan11Features&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(storageBuffer16BitAccess, move_src.storageBuffer16BitAccess);
+    std::swap(uniformAndStorageBuffer16BitAccess, move_src.uniformAndStorageBuffer16BitAccess);
+    std::swap(storagePushConstant16, move_src.storagePushConstant16);
+    std::swap(storageInputOutput16, move_src.storageInputOutput16);
+    std::swap(multiview, move_src.multiview);
+    std::swap(multiviewGeometryShader, move_src.multiviewGeometryShader);
+    std::swap(multiviewTessellationShader, move_src.multiviewTessellationShader);
+    std::swap(variablePointersStorageBuffer, move_src.variablePointersStorageBuffer);
+    std::swap(variablePointers, move_src.variablePointers);
+    std::swap(protectedMemory, move_src.protectedMemory);
+    std::swap(samplerYcbcrConversion, move_src.samplerYcbcrConversion);
+    std::swap(shaderDrawParameters, move_src.shaderDrawParameters);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVulkan11Features::~safe_VkPhysicalDeviceVulkan11Features() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceVulkan11Features::initialize(const VkPhysicalDeviceVulkan11Features* in_struct,
@@ -10290,6 +12493,37 @@ safe_VkPhysicalDeviceVulkan11Properties& safe_VkPhysicalDeviceVulkan11Properties
     return *this;
 }
 
+safe_VkPhysicalDeviceVulkan11Properties::safe_VkPhysicalDeviceVulkan11Properties(
+    safe_VkPhysicalDeviceVulkan11Properties&& move_src) noexcept
+    : safe_VkPhysicalDeviceVulkan11Properties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVulkan11Properties& safe_VkPhysicalDeviceVulkan11Properties::operator=(
+    safe_VkPhysicalDeviceVulkan11Properties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceUUID, move_src.deviceUUID);
+    std::swap(driverUUID, move_src.driverUUID);
+    std::swap(deviceLUID, move_src.deviceLUID);
+    std::swap(deviceNodeMask, move_src.deviceNodeMask);
+    std::swap(deviceLUIDValid, move_src.deviceLUIDValid);
+    std::swap(subgroupSize, move_src.subgroupSize);
+    std::swap(subgroupSupportedStages, move_src.subgroupSupportedStages);
+    std::swap(subgroupSupportedOperations, move_src.subgroupSupportedOperations);
+    std::swap(subgroupQuadOperationsInAllStages, move_src.subgroupQuadOperationsInAllStages);
+    std::swap(pointClippingBehavior, move_src.pointClippingBehavior);
+    std::swap(maxMultiviewViewCount, move_src.maxMultiviewViewCount);
+    std::swap(maxMultiviewInstanceIndex, move_src.maxMultiviewInstanceIndex);
+    std::swap(protectedNoFault, move_src.protectedNoFault);
+    std::swap(maxPerSetDescriptors, move_src.maxPerSetDescriptors);
+    std::swap(maxMemoryAllocationSize, move_src.maxMemoryAllocationSize);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVulkan11Properties::~safe_VkPhysicalDeviceVulkan11Properties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceVulkan11Properties::initialize(const VkPhysicalDeviceVulkan11Properties* in_struct,
@@ -10572,6 +12806,69 @@ safe_VkPhysicalDeviceVulkan12Features& safe_VkPhysicalDeviceVulkan12Features::op
     return *this;
 }
 
+safe_VkPhysicalDeviceVulkan12Features::safe_VkPhysicalDeviceVulkan12Features(
+    safe_VkPhysicalDeviceVulkan12Features&& move_src) noexcept
+    : safe_VkPhysicalDeviceVulkan12Features() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVulkan12Features& safe_VkPhysicalDeviceVulkan12Features::operator=(
+    safe_VkPhysicalDeviceVulkan12Features&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(samplerMirrorClampToEdge, move_src.samplerMirrorClampToEdge);
+    std::swap(drawIndirectCount, move_src.drawIndirectCount);
+    std::swap(storageBuffer8BitAccess, move_src.storageBuffer8BitAccess);
+    std::swap(uniformAndStorageBuffer8BitAccess, move_src.uniformAndStorageBuffer8BitAccess);
+    std::swap(storagePushConstant8, move_src.storagePushConstant8);
+    std::swap(shaderBufferInt64Atomics, move_src.shaderBufferInt64Atomics);
+    std::swap(shaderSharedInt64Atomics, move_src.shaderSharedInt64Atomics);
+    std::swap(shaderFloat16, move_src.shaderFloat16);
+    std::swap(shaderInt8, move_src.shaderInt8);
+    std::swap(descriptorIndexing, move_src.descriptorIndexing);
+    std::swap(shaderInputAttachmentArrayDynamicIndexing, move_src.shaderInputAttachmentArrayDynamicIndexing);
+    std::swap(shaderUniformTexelBufferArrayDynamicIndexing, move_src.shaderUniformTexelBufferArrayDynamicIndexing);
+    std::swap(shaderStorageTexelBufferArrayDynamicIndexing, move_src.shaderStorageTexelBufferArrayDynamicIndexing);
+    std::swap(shaderUniformBufferArrayNonUniformIndexing, move_src.shaderUniformBufferArrayNonUniformIndexing);
+    std::swap(shaderSampledImageArrayNonUniformIndexing, move_src.shaderSampledImageArrayNonUniformIndexing);
+    std::swap(shaderStorageBufferArrayNonUniformIndexing, move_src.shaderStorageBufferArrayNonUniformIndexing);
+    std::swap(shaderStorageImageArrayNonUniformIndexing, move_src.shaderStorageImageArrayNonUniformIndexing);
+    std::swap(shaderInputAttachmentArrayNonUniformIndexing, move_src.shaderInputAttachmentArrayNonUniformIndexing);
+    std::swap(shaderUniformTexelBufferArrayNonUniformIndexing, move_src.shaderUniformTexelBufferArrayNonUniformIndexing);
+    std::swap(shaderStorageTexelBufferArrayNonUniformIndexing, move_src.shaderStorageTexelBufferArrayNonUniformIndexing);
+    std::swap(descriptorBindingUniformBufferUpdateAfterBind, move_src.descriptorBindingUniformBufferUpdateAfterBind);
+    std::swap(descriptorBindingSampledImageUpdateAfterBind, move_src.descriptorBindingSampledImageUpdateAfterBind);
+    std::swap(descriptorBindingStorageImageUpdateAfterBind, move_src.descriptorBindingStorageImageUpdateAfterBind);
+    std::swap(descriptorBindingStorageBufferUpdateAfterBind, move_src.descriptorBindingStorageBufferUpdateAfterBind);
+    std::swap(descriptorBindingUniformTexelBufferUpdateAfterBind, move_src.descriptorBindingUniformTexelBufferUpdateAfterBind);
+    std::swap(descriptorBindingStorageTexelBufferUpdateAfterBind, move_src.descriptorBindingStorageTexelBufferUpdateAfterBind);
+    std::swap(descriptorBindingUpdateUnusedWhilePending, move_src.descriptorBindingUpdateUnusedWhilePending);
+    std::swap(descriptorBindingPartiallyBound, move_src.descriptorBindingPartiallyBound);
+    std::swap(descriptorBindingVariableDescriptorCount, move_src.descriptorBindingVariableDescriptorCount);
+    std::swap(runtimeDescriptorArray, move_src.runtimeDescriptorArray);
+    std::swap(samplerFilterMinmax, move_src.samplerFilterMinmax);
+    std::swap(scalarBlockLayout, move_src.scalarBlockLayout);
+    std::swap(imagelessFramebuffer, move_src.imagelessFramebuffer);
+    std::swap(uniformBufferStandardLayout, move_src.uniformBufferStandardLayout);
+    std::swap(shaderSubgroupExtendedTypes, move_src.shaderSubgroupExtendedTypes);
+    std::swap(separateDepthStencilLayouts, move_src.separateDepthStencilLayouts);
+    std::swap(hostQueryReset, move_src.hostQueryReset);
+    std::swap(timelineSemaphore, move_src.timelineSemaphore);
+    std::swap(bufferDeviceAddress, move_src.bufferDeviceAddress);
+    std::swap(bufferDeviceAddressCaptureReplay, move_src.bufferDeviceAddressCaptureReplay);
+    std::swap(bufferDeviceAddressMultiDevice, move_src.bufferDeviceAddressMultiDevice);
+    std::swap(vulkanMemoryModel, move_src.vulkanMemoryModel);
+    std::swap(vulkanMemoryModelDeviceScope, move_src.vulkanMemoryModelDeviceScope);
+    std::swap(vulkanMemoryModelAvailabilityVisibilityChains, move_src.vulkanMemoryModelAvailabilityVisibilityChains);
+    std::swap(shaderOutputViewportIndex, move_src.shaderOutputViewportIndex);
+    std::swap(shaderOutputLayer, move_src.shaderOutputLayer);
+    std::swap(subgroupBroadcastDynamicId, move_src.subgroupBroadcastDynamicId);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVulkan12Features::~safe_VkPhysicalDeviceVulkan12Features() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceVulkan12Features::initialize(const VkPhysicalDeviceVulkan12Features* in_struct,
@@ -10934,6 +13231,74 @@ safe_VkPhysicalDeviceVulkan12Properties& safe_VkPhysicalDeviceVulkan12Properties
     return *this;
 }
 
+safe_VkPhysicalDeviceVulkan12Properties::safe_VkPhysicalDeviceVulkan12Properties(
+    safe_VkPhysicalDeviceVulkan12Properties&& move_src) noexcept
+    : safe_VkPhysicalDeviceVulkan12Properties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVulkan12Properties& safe_VkPhysicalDeviceVulkan12Properties::operator=(
+    safe_VkPhysicalDeviceVulkan12Properties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(driverID, move_src.driverID);
+    std::swap(driverName, move_src.driverName);
+    std::swap(driverInfo, move_src.driverInfo);
+    std::swap(conformanceVersion, move_src.conformanceVersion);
+    std::swap(denormBehaviorIndependence, move_src.denormBehaviorIndependence);
+    std::swap(roundingModeIndependence, move_src.roundingModeIndependence);
+    std::swap(shaderSignedZeroInfNanPreserveFloat16, move_src.shaderSignedZeroInfNanPreserveFloat16);
+    std::swap(shaderSignedZeroInfNanPreserveFloat32, move_src.shaderSignedZeroInfNanPreserveFloat32);
+    std::swap(shaderSignedZeroInfNanPreserveFloat64, move_src.shaderSignedZeroInfNanPreserveFloat64);
+    std::swap(shaderDenormPreserveFloat16, move_src.shaderDenormPreserveFloat16);
+    std::swap(shaderDenormPreserveFloat32, move_src.shaderDenormPreserveFloat32);
+    std::swap(shaderDenormPreserveFloat64, move_src.shaderDenormPreserveFloat64);
+    std::swap(shaderDenormFlushToZeroFloat16, move_src.shaderDenormFlushToZeroFloat16);
+    std::swap(shaderDenormFlushToZeroFloat32, move_src.shaderDenormFlushToZeroFloat32);
+    std::swap(shaderDenormFlushToZeroFloat64, move_src.shaderDenormFlushToZeroFloat64);
+    std::swap(shaderRoundingModeRTEFloat16, move_src.shaderRoundingModeRTEFloat16);
+    std::swap(shaderRoundingModeRTEFloat32, move_src.shaderRoundingModeRTEFloat32);
+    std::swap(shaderRoundingModeRTEFloat64, move_src.shaderRoundingModeRTEFloat64);
+    std::swap(shaderRoundingModeRTZFloat16, move_src.shaderRoundingModeRTZFloat16);
+    std::swap(shaderRoundingModeRTZFloat32, move_src.shaderRoundingModeRTZFloat32);
+    std::swap(shaderRoundingModeRTZFloat64, move_src.shaderRoundingModeRTZFloat64);
+    std::swap(maxUpdateAfterBindDescriptorsInAllPools, move_src.maxUpdateAfterBindDescriptorsInAllPools);
+    std::swap(shaderUniformBufferArrayNonUniformIndexingNative, move_src.shaderUniformBufferArrayNonUniformIndexingNative);
+    std::swap(shaderSampledImageArrayNonUniformIndexingNative, move_src.shaderSampledImageArrayNonUniformIndexingNative);
+    std::swap(shaderStorageBufferArrayNonUniformIndexingNative, move_src.shaderStorageBufferArrayNonUniformIndexingNative);
+    std::swap(shaderStorageImageArrayNonUniformIndexingNative, move_src.shaderStorageImageArrayNonUniformIndexingNative);
+    std::swap(shaderInputAttachmentArrayNonUniformIndexingNative, move_src.shaderInputAttachmentArrayNonUniformIndexingNative);
+    std::swap(robustBufferAccessUpdateAfterBind, move_src.robustBufferAccessUpdateAfterBind);
+    std::swap(quadDivergentImplicitLod, move_src.quadDivergentImplicitLod);
+    std::swap(maxPerStageDescriptorUpdateAfterBindSamplers, move_src.maxPerStageDescriptorUpdateAfterBindSamplers);
+    std::swap(maxPerStageDescriptorUpdateAfterBindUniformBuffers, move_src.maxPerStageDescriptorUpdateAfterBindUniformBuffers);
+    std::swap(maxPerStageDescriptorUpdateAfterBindStorageBuffers, move_src.maxPerStageDescriptorUpdateAfterBindStorageBuffers);
+    std::swap(maxPerStageDescriptorUpdateAfterBindSampledImages, move_src.maxPerStageDescriptorUpdateAfterBindSampledImages);
+    std::swap(maxPerStageDescriptorUpdateAfterBindStorageImages, move_src.maxPerStageDescriptorUpdateAfterBindStorageImages);
+    std::swap(maxPerStageDescriptorUpdateAfterBindInputAttachments, move_src.maxPerStageDescriptorUpdateAfterBindInputAttachments);
+    std::swap(maxPerStageUpdateAfterBindResources, move_src.maxPerStageUpdateAfterBindResources);
+    std::swap(maxDescriptorSetUpdateAfterBindSamplers, move_src.maxDescriptorSetUpdateAfterBindSamplers);
+    std::swap(maxDescriptorSetUpdateAfterBindUniformBuffers, move_src.maxDescriptorSetUpdateAfterBindUniformBuffers);
+    std::swap(maxDescriptorSetUpdateAfterBindUniformBuffersDynamic, move_src.maxDescriptorSetUpdateAfterBindUniformBuffersDynamic);
+    std::swap(maxDescriptorSetUpdateAfterBindStorageBuffers, move_src.maxDescriptorSetUpdateAfterBindStorageBuffers);
+    std::swap(maxDescriptorSetUpdateAfterBindStorageBuffersDynamic, move_src.maxDescriptorSetUpdateAfterBindStorageBuffersDynamic);
+    std::swap(maxDescriptorSetUpdateAfterBindSampledImages, move_src.maxDescriptorSetUpdateAfterBindSampledImages);
+    std::swap(maxDescriptorSetUpdateAfterBindStorageImages, move_src.maxDescriptorSetUpdateAfterBindStorageImages);
+    std::swap(maxDescriptorSetUpdateAfterBindInputAttachments, move_src.maxDescriptorSetUpdateAfterBindInputAttachments);
+    std::swap(supportedDepthResolveModes, move_src.supportedDepthResolveModes);
+    std::swap(supportedStencilResolveModes, move_src.supportedStencilResolveModes);
+    std::swap(independentResolveNone, move_src.independentResolveNone);
+    std::swap(independentResolve, move_src.independentResolve);
+    std::swap(filterMinmaxSingleComponentFormats, move_src.filterMinmaxSingleComponentFormats);
+    std::swap(filterMinmaxImageComponentMapping, move_src.filterMinmaxImageComponentMapping);
+    std::swap(maxTimelineSemaphoreValueDifference, move_src.maxTimelineSemaphoreValueDifference);
+    std::swap(framebufferIntegerColorSampleCounts, move_src.framebufferIntegerColorSampleCounts);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVulkan12Properties::~safe_VkPhysicalDeviceVulkan12Properties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceVulkan12Properties::initialize(const VkPhysicalDeviceVulkan12Properties* in_struct,
@@ -11111,6 +13476,23 @@ safe_VkImageFormatListCreateInfo& safe_VkImageFormatListCreateInfo::operator=(co
     return *this;
 }
 
+safe_VkImageFormatListCreateInfo::safe_VkImageFormatListCreateInfo(safe_VkImageFormatListCreateInfo&& move_src) noexcept
+    : safe_VkImageFormatListCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageFormatListCreateInfo& safe_VkImageFormatListCreateInfo::operator=(
+    safe_VkImageFormatListCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(viewFormatCount, move_src.viewFormatCount);
+    std::swap(pViewFormats, move_src.pViewFormats);
+
+    return *this;
+}
+
 safe_VkImageFormatListCreateInfo::~safe_VkImageFormatListCreateInfo() {
     if (pViewFormats) delete[] pViewFormats;
     FreePnextChain(pNext);
@@ -11208,6 +13590,29 @@ safe_VkAttachmentDescription2& safe_VkAttachmentDescription2::operator=(const sa
     return *this;
 }
 
+safe_VkAttachmentDescription2::safe_VkAttachmentDescription2(safe_VkAttachmentDescription2&& move_src) noexcept
+    : safe_VkAttachmentDescription2() {
+    *this = std::move(move_src);
+}
+
+safe_VkAttachmentDescription2& safe_VkAttachmentDescription2::operator=(safe_VkAttachmentDescription2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(format, move_src.format);
+    std::swap(samples, move_src.samples);
+    std::swap(loadOp, move_src.loadOp);
+    std::swap(storeOp, move_src.storeOp);
+    std::swap(stencilLoadOp, move_src.stencilLoadOp);
+    std::swap(stencilStoreOp, move_src.stencilStoreOp);
+    std::swap(initialLayout, move_src.initialLayout);
+    std::swap(finalLayout, move_src.finalLayout);
+
+    return *this;
+}
+
 safe_VkAttachmentDescription2::~safe_VkAttachmentDescription2() { FreePnextChain(pNext); }
 
 void safe_VkAttachmentDescription2::initialize(const VkAttachmentDescription2* in_struct,
@@ -11274,6 +13679,23 @@ safe_VkAttachmentReference2& safe_VkAttachmentReference2::operator=(const safe_V
     return *this;
 }
 
+safe_VkAttachmentReference2::safe_VkAttachmentReference2(safe_VkAttachmentReference2&& move_src) noexcept
+    : safe_VkAttachmentReference2() {
+    *this = std::move(move_src);
+}
+
+safe_VkAttachmentReference2& safe_VkAttachmentReference2::operator=(safe_VkAttachmentReference2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(attachment, move_src.attachment);
+    std::swap(layout, move_src.layout);
+    std::swap(aspectMask, move_src.aspectMask);
+
+    return *this;
+}
+
 safe_VkAttachmentReference2::~safe_VkAttachmentReference2() { FreePnextChain(pNext); }
 
 void safe_VkAttachmentReference2::initialize(const VkAttachmentReference2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -11449,6 +13871,31 @@ safe_VkSubpassDescription2& safe_VkSubpassDescription2::operator=(const safe_VkS
     return *this;
 }
 
+safe_VkSubpassDescription2::safe_VkSubpassDescription2(safe_VkSubpassDescription2&& move_src) noexcept
+    : safe_VkSubpassDescription2() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubpassDescription2& safe_VkSubpassDescription2::operator=(safe_VkSubpassDescription2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(pipelineBindPoint, move_src.pipelineBindPoint);
+    std::swap(viewMask, move_src.viewMask);
+    std::swap(inputAttachmentCount, move_src.inputAttachmentCount);
+    std::swap(pInputAttachments, move_src.pInputAttachments);
+    std::swap(colorAttachmentCount, move_src.colorAttachmentCount);
+    std::swap(pColorAttachments, move_src.pColorAttachments);
+    std::swap(pResolveAttachments, move_src.pResolveAttachments);
+    std::swap(pDepthStencilAttachment, move_src.pDepthStencilAttachment);
+    std::swap(preserveAttachmentCount, move_src.preserveAttachmentCount);
+    std::swap(pPreserveAttachments, move_src.pPreserveAttachments);
+
+    return *this;
+}
+
 safe_VkSubpassDescription2::~safe_VkSubpassDescription2() {
     if (pInputAttachments) delete[] pInputAttachments;
     if (pColorAttachments) delete[] pColorAttachments;
@@ -11609,6 +14056,27 @@ safe_VkSubpassDependency2& safe_VkSubpassDependency2::operator=(const safe_VkSub
     return *this;
 }
 
+safe_VkSubpassDependency2::safe_VkSubpassDependency2(safe_VkSubpassDependency2&& move_src) noexcept : safe_VkSubpassDependency2() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubpassDependency2& safe_VkSubpassDependency2::operator=(safe_VkSubpassDependency2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcSubpass, move_src.srcSubpass);
+    std::swap(dstSubpass, move_src.dstSubpass);
+    std::swap(srcStageMask, move_src.srcStageMask);
+    std::swap(dstStageMask, move_src.dstStageMask);
+    std::swap(srcAccessMask, move_src.srcAccessMask);
+    std::swap(dstAccessMask, move_src.dstAccessMask);
+    std::swap(dependencyFlags, move_src.dependencyFlags);
+    std::swap(viewOffset, move_src.viewOffset);
+
+    return *this;
+}
+
 safe_VkSubpassDependency2::~safe_VkSubpassDependency2() { FreePnextChain(pNext); }
 
 void safe_VkSubpassDependency2::initialize(const VkSubpassDependency2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -11778,6 +14246,29 @@ safe_VkRenderPassCreateInfo2& safe_VkRenderPassCreateInfo2::operator=(const safe
     return *this;
 }
 
+safe_VkRenderPassCreateInfo2::safe_VkRenderPassCreateInfo2(safe_VkRenderPassCreateInfo2&& move_src) noexcept
+    : safe_VkRenderPassCreateInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassCreateInfo2& safe_VkRenderPassCreateInfo2::operator=(safe_VkRenderPassCreateInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(attachmentCount, move_src.attachmentCount);
+    std::swap(pAttachments, move_src.pAttachments);
+    std::swap(subpassCount, move_src.subpassCount);
+    std::swap(pSubpasses, move_src.pSubpasses);
+    std::swap(dependencyCount, move_src.dependencyCount);
+    std::swap(pDependencies, move_src.pDependencies);
+    std::swap(correlatedViewMaskCount, move_src.correlatedViewMaskCount);
+    std::swap(pCorrelatedViewMasks, move_src.pCorrelatedViewMasks);
+
+    return *this;
+}
+
 safe_VkRenderPassCreateInfo2::~safe_VkRenderPassCreateInfo2() {
     if (pAttachments) delete[] pAttachments;
     if (pSubpasses) delete[] pSubpasses;
@@ -11888,11 +14379,25 @@ safe_VkSubpassBeginInfo::safe_VkSubpassBeginInfo(const safe_VkSubpassBeginInfo&
 safe_VkSubpassBeginInfo& safe_VkSubpassBeginInfo::operator=(const safe_VkSubpassBeginInfo& copy_src) {
     if (&copy_src == this) return *this;
 
-    FreePnextChain(pNext);
+    FreePnextChain(pNext);
+
+    sType = copy_src.sType;
+    contents = copy_src.contents;
+    pNext = SafePnextCopy(copy_src.pNext);
+
+    return *this;
+}
+
+safe_VkSubpassBeginInfo::safe_VkSubpassBeginInfo(safe_VkSubpassBeginInfo&& move_src) noexcept : safe_VkSubpassBeginInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubpassBeginInfo& safe_VkSubpassBeginInfo::operator=(safe_VkSubpassBeginInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
 
-    sType = copy_src.sType;
-    contents = copy_src.contents;
-    pNext = SafePnextCopy(copy_src.pNext);
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(contents, move_src.contents);
 
     return *this;
 }
@@ -11938,6 +14443,19 @@ safe_VkSubpassEndInfo& safe_VkSubpassEndInfo::operator=(const safe_VkSubpassEndI
     return *this;
 }
 
+safe_VkSubpassEndInfo::safe_VkSubpassEndInfo(safe_VkSubpassEndInfo&& move_src) noexcept : safe_VkSubpassEndInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubpassEndInfo& safe_VkSubpassEndInfo::operator=(safe_VkSubpassEndInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+
+    return *this;
+}
+
 safe_VkSubpassEndInfo::~safe_VkSubpassEndInfo() { FreePnextChain(pNext); }
 
 void safe_VkSubpassEndInfo::initialize(const VkSubpassEndInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -11993,6 +14511,25 @@ safe_VkPhysicalDevice8BitStorageFeatures& safe_VkPhysicalDevice8BitStorageFeatur
     return *this;
 }
 
+safe_VkPhysicalDevice8BitStorageFeatures::safe_VkPhysicalDevice8BitStorageFeatures(
+    safe_VkPhysicalDevice8BitStorageFeatures&& move_src) noexcept
+    : safe_VkPhysicalDevice8BitStorageFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevice8BitStorageFeatures& safe_VkPhysicalDevice8BitStorageFeatures::operator=(
+    safe_VkPhysicalDevice8BitStorageFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(storageBuffer8BitAccess, move_src.storageBuffer8BitAccess);
+    std::swap(uniformAndStorageBuffer8BitAccess, move_src.uniformAndStorageBuffer8BitAccess);
+    std::swap(storagePushConstant8, move_src.storagePushConstant8);
+
+    return *this;
+}
+
 safe_VkPhysicalDevice8BitStorageFeatures::~safe_VkPhysicalDevice8BitStorageFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevice8BitStorageFeatures::initialize(const VkPhysicalDevice8BitStorageFeatures* in_struct,
@@ -12071,6 +14608,26 @@ safe_VkPhysicalDeviceDriverProperties& safe_VkPhysicalDeviceDriverProperties::op
     return *this;
 }
 
+safe_VkPhysicalDeviceDriverProperties::safe_VkPhysicalDeviceDriverProperties(
+    safe_VkPhysicalDeviceDriverProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceDriverProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDriverProperties& safe_VkPhysicalDeviceDriverProperties::operator=(
+    safe_VkPhysicalDeviceDriverProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(driverID, move_src.driverID);
+    std::swap(driverName, move_src.driverName);
+    std::swap(driverInfo, move_src.driverInfo);
+    std::swap(conformanceVersion, move_src.conformanceVersion);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDriverProperties::~safe_VkPhysicalDeviceDriverProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDriverProperties::initialize(const VkPhysicalDeviceDriverProperties* in_struct,
@@ -12144,6 +14701,24 @@ safe_VkPhysicalDeviceShaderAtomicInt64Features& safe_VkPhysicalDeviceShaderAtomi
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderAtomicInt64Features::safe_VkPhysicalDeviceShaderAtomicInt64Features(
+    safe_VkPhysicalDeviceShaderAtomicInt64Features&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderAtomicInt64Features() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderAtomicInt64Features& safe_VkPhysicalDeviceShaderAtomicInt64Features::operator=(
+    safe_VkPhysicalDeviceShaderAtomicInt64Features&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderBufferInt64Atomics, move_src.shaderBufferInt64Atomics);
+    std::swap(shaderSharedInt64Atomics, move_src.shaderSharedInt64Atomics);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderAtomicInt64Features::~safe_VkPhysicalDeviceShaderAtomicInt64Features() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderAtomicInt64Features::initialize(const VkPhysicalDeviceShaderAtomicInt64Features* in_struct,
@@ -12196,6 +14771,24 @@ safe_VkPhysicalDeviceShaderFloat16Int8Features& safe_VkPhysicalDeviceShaderFloat
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderFloat16Int8Features::safe_VkPhysicalDeviceShaderFloat16Int8Features(
+    safe_VkPhysicalDeviceShaderFloat16Int8Features&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderFloat16Int8Features() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderFloat16Int8Features& safe_VkPhysicalDeviceShaderFloat16Int8Features::operator=(
+    safe_VkPhysicalDeviceShaderFloat16Int8Features&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderFloat16, move_src.shaderFloat16);
+    std::swap(shaderInt8, move_src.shaderInt8);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderFloat16Int8Features::~safe_VkPhysicalDeviceShaderFloat16Int8Features() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderFloat16Int8Features::initialize(const VkPhysicalDeviceShaderFloat16Int8Features* in_struct,
@@ -12313,6 +14906,39 @@ safe_VkPhysicalDeviceFloatControlsProperties& safe_VkPhysicalDeviceFloatControls
     return *this;
 }
 
+safe_VkPhysicalDeviceFloatControlsProperties::safe_VkPhysicalDeviceFloatControlsProperties(
+    safe_VkPhysicalDeviceFloatControlsProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceFloatControlsProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFloatControlsProperties& safe_VkPhysicalDeviceFloatControlsProperties::operator=(
+    safe_VkPhysicalDeviceFloatControlsProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(denormBehaviorIndependence, move_src.denormBehaviorIndependence);
+    std::swap(roundingModeIndependence, move_src.roundingModeIndependence);
+    std::swap(shaderSignedZeroInfNanPreserveFloat16, move_src.shaderSignedZeroInfNanPreserveFloat16);
+    std::swap(shaderSignedZeroInfNanPreserveFloat32, move_src.shaderSignedZeroInfNanPreserveFloat32);
+    std::swap(shaderSignedZeroInfNanPreserveFloat64, move_src.shaderSignedZeroInfNanPreserveFloat64);
+    std::swap(shaderDenormPreserveFloat16, move_src.shaderDenormPreserveFloat16);
+    std::swap(shaderDenormPreserveFloat32, move_src.shaderDenormPreserveFloat32);
+    std::swap(shaderDenormPreserveFloat64, move_src.shaderDenormPreserveFloat64);
+    std::swap(shaderDenormFlushToZeroFloat16, move_src.shaderDenormFlushToZeroFloat16);
+    std::swap(shaderDenormFlushToZeroFloat32, move_src.shaderDenormFlushToZeroFloat32);
+    std::swap(shaderDenormFlushToZeroFloat64, move_src.shaderDenormFlushToZeroFloat64);
+    std::swap(shaderRoundingModeRTEFloat16, move_src.shaderRoundingModeRTEFloat16);
+    std::swap(shaderRoundingModeRTEFloat32, move_src.shaderRoundingModeRTEFloat32);
+    std::swap(shaderRoundingModeRTEFloat64, move_src.shaderRoundingModeRTEFloat64);
+    std::swap(shaderRoundingModeRTZFloat16, move_src.shaderRoundingModeRTZFloat16);
+    std::swap(shaderRoundingModeRTZFloat32, move_src.shaderRoundingModeRTZFloat32);
+    std::swap(shaderRoundingModeRTZFloat64, move_src.shaderRoundingModeRTZFloat64);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFloatControlsProperties::~safe_VkPhysicalDeviceFloatControlsProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceFloatControlsProperties::initialize(const VkPhysicalDeviceFloatControlsProperties* in_struct,
@@ -12413,6 +15039,24 @@ safe_VkDescriptorSetLayoutBindingFlagsCreateInfo& safe_VkDescriptorSetLayoutBind
     return *this;
 }
 
+safe_VkDescriptorSetLayoutBindingFlagsCreateInfo::safe_VkDescriptorSetLayoutBindingFlagsCreateInfo(
+    safe_VkDescriptorSetLayoutBindingFlagsCreateInfo&& move_src) noexcept
+    : safe_VkDescriptorSetLayoutBindingFlagsCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorSetLayoutBindingFlagsCreateInfo& safe_VkDescriptorSetLayoutBindingFlagsCreateInfo::operator=(
+    safe_VkDescriptorSetLayoutBindingFlagsCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(bindingCount, move_src.bindingCount);
+    std::swap(pBindingFlags, move_src.pBindingFlags);
+
+    return *this;
+}
+
 safe_VkDescriptorSetLayoutBindingFlagsCreateInfo::~safe_VkDescriptorSetLayoutBindingFlagsCreateInfo() {
     if (pBindingFlags) delete[] pBindingFlags;
     FreePnextChain(pNext);
@@ -12556,6 +15200,42 @@ safe_VkPhysicalDeviceDescriptorIndexingFeatures& safe_VkPhysicalDeviceDescriptor
     return *this;
 }
 
+safe_VkPhysicalDeviceDescriptorIndexingFeatures::safe_VkPhysicalDeviceDescriptorIndexingFeatures(
+    safe_VkPhysicalDeviceDescriptorIndexingFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceDescriptorIndexingFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDescriptorIndexingFeatures& safe_VkPhysicalDeviceDescriptorIndexingFeatures::operator=(
+    safe_VkPhysicalDeviceDescriptorIndexingFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderInputAttachmentArrayDynamicIndexing, move_src.shaderInputAttachmentArrayDynamicIndexing);
+    std::swap(shaderUniformTexelBufferArrayDynamicIndexing, move_src.shaderUniformTexelBufferArrayDynamicIndexing);
+    std::swap(shaderStorageTexelBufferArrayDynamicIndexing, move_src.shaderStorageTexelBufferArrayDynamicIndexing);
+    std::swap(shaderUniformBufferArrayNonUniformIndexing, move_src.shaderUniformBufferArrayNonUniformIndexing);
+    std::swap(shaderSampledImageArrayNonUniformIndexing, move_src.shaderSampledImageArrayNonUniformIndexing);
+    std::swap(shaderStorageBufferArrayNonUniformIndexing, move_src.shaderStorageBufferArrayNonUniformIndexing);
+    std::swap(shaderStorageImageArrayNonUniformIndexing, move_src.shaderStorageImageArrayNonUniformIndexing);
+    std::swap(shaderInputAttachmentArrayNonUniformIndexing, move_src.shaderInputAttachmentArrayNonUniformIndexing);
+    std::swap(shaderUniformTexelBufferArrayNonUniformIndexing, move_src.shaderUniformTexelBufferArrayNonUniformIndexing);
+    std::swap(shaderStorageTexelBufferArrayNonUniformIndexing, move_src.shaderStorageTexelBufferArrayNonUniformIndexing);
+    std::swap(descriptorBindingUniformBufferUpdateAfterBind, move_src.descriptorBindingUniformBufferUpdateAfterBind);
+    std::swap(descriptorBindingSampledImageUpdateAfterBind, move_src.descriptorBindingSampledImageUpdateAfterBind);
+    std::swap(descriptorBindingStorageImageUpdateAfterBind, move_src.descriptorBindingStorageImageUpdateAfterBind);
+    std::swap(descriptorBindingStorageBufferUpdateAfterBind, move_src.descriptorBindingStorageBufferUpdateAfterBind);
+    std::swap(descriptorBindingUniformTexelBufferUpdateAfterBind, move_src.descriptorBindingUniformTexelBufferUpdateAfterBind);
+    std::swap(descriptorBindingStorageTexelBufferUpdateAfterBind, move_src.descriptorBindingStorageTexelBufferUpdateAfterBind);
+    std::swap(descriptorBindingUpdateUnusedWhilePending, move_src.descriptorBindingUpdateUnusedWhilePending);
+    std::swap(descriptorBindingPartiallyBound, move_src.descriptorBindingPartiallyBound);
+    std::swap(descriptorBindingVariableDescriptorCount, move_src.descriptorBindingVariableDescriptorCount);
+    std::swap(runtimeDescriptorArray, move_src.runtimeDescriptorArray);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDescriptorIndexingFeatures::~safe_VkPhysicalDeviceDescriptorIndexingFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDescriptorIndexingFeatures::initialize(const VkPhysicalDeviceDescriptorIndexingFeatures* in_struct,
@@ -12733,6 +15413,45 @@ safe_VkPhysicalDeviceDescriptorIndexingProperties& safe_VkPhysicalDeviceDescript
     return *this;
 }
 
+safe_VkPhysicalDeviceDescriptorIndexingProperties::safe_VkPhysicalDeviceDescriptorIndexingProperties(
+    safe_VkPhysicalDeviceDescriptorIndexingProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceDescriptorIndexingProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDescriptorIndexingProperties& safe_VkPhysicalDeviceDescriptorIndexingProperties::operator=(
+    safe_VkPhysicalDeviceDescriptorIndexingProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxUpdateAfterBindDescriptorsInAllPools, move_src.maxUpdateAfterBindDescriptorsInAllPools);
+    std::swap(shaderUniformBufferArrayNonUniformIndexingNative, move_src.shaderUniformBufferArrayNonUniformIndexingNative);
+    std::swap(shaderSampledImageArrayNonUniformIndexingNative, move_src.shaderSampledImageArrayNonUniformIndexingNative);
+    std::swap(shaderStorageBufferArrayNonUniformIndexingNative, move_src.shaderStorageBufferArrayNonUniformIndexingNative);
+    std::swap(shaderStorageImageArrayNonUniformIndexingNative, move_src.shaderStorageImageArrayNonUniformIndexingNative);
+    std::swap(shaderInputAttachmentArrayNonUniformIndexingNative, move_src.shaderInputAttachmentArrayNonUniformIndexingNative);
+    std::swap(robustBufferAccessUpdateAfterBind, move_src.robustBufferAccessUpdateAfterBind);
+    std::swap(quadDivergentImplicitLod, move_src.quadDivergentImplicitLod);
+    std::swap(maxPerStageDescriptorUpdateAfterBindSamplers, move_src.maxPerStageDescriptorUpdateAfterBindSamplers);
+    std::swap(maxPerStageDescriptorUpdateAfterBindUniformBuffers, move_src.maxPerStageDescriptorUpdateAfterBindUniformBuffers);
+    std::swap(maxPerStageDescriptorUpdateAfterBindStorageBuffers, move_src.maxPerStageDescriptorUpdateAfterBindStorageBuffers);
+    std::swap(maxPerStageDescriptorUpdateAfterBindSampledImages, move_src.maxPerStageDescriptorUpdateAfterBindSampledImages);
+    std::swap(maxPerStageDescriptorUpdateAfterBindStorageImages, move_src.maxPerStageDescriptorUpdateAfterBindStorageImages);
+    std::swap(maxPerStageDescriptorUpdateAfterBindInputAttachments, move_src.maxPerStageDescriptorUpdateAfterBindInputAttachments);
+    std::swap(maxPerStageUpdateAfterBindResources, move_src.maxPerStageUpdateAfterBindResources);
+    std::swap(maxDescriptorSetUpdateAfterBindSamplers, move_src.maxDescriptorSetUpdateAfterBindSamplers);
+    std::swap(maxDescriptorSetUpdateAfterBindUniformBuffers, move_src.maxDescriptorSetUpdateAfterBindUniformBuffers);
+    std::swap(maxDescriptorSetUpdateAfterBindUniformBuffersDynamic, move_src.maxDescriptorSetUpdateAfterBindUniformBuffersDynamic);
+    std::swap(maxDescriptorSetUpdateAfterBindStorageBuffers, move_src.maxDescriptorSetUpdateAfterBindStorageBuffers);
+    std::swap(maxDescriptorSetUpdateAfterBindStorageBuffersDynamic, move_src.maxDescriptorSetUpdateAfterBindStorageBuffersDynamic);
+    std::swap(maxDescriptorSetUpdateAfterBindSampledImages, move_src.maxDescriptorSetUpdateAfterBindSampledImages);
+    std::swap(maxDescriptorSetUpdateAfterBindStorageImages, move_src.maxDescriptorSetUpdateAfterBindStorageImages);
+    std::swap(maxDescriptorSetUpdateAfterBindInputAttachments, move_src.maxDescriptorSetUpdateAfterBindInputAttachments);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDescriptorIndexingProperties::~safe_VkPhysicalDeviceDescriptorIndexingProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDescriptorIndexingProperties::initialize(const VkPhysicalDeviceDescriptorIndexingProperties* in_struct,
@@ -12846,6 +15565,24 @@ safe_VkDescriptorSetVariableDescriptorCountAllocateInfo& safe_VkDescriptorSetVar
     return *this;
 }
 
+safe_VkDescriptorSetVariableDescriptorCountAllocateInfo::safe_VkDescriptorSetVariableDescriptorCountAllocateInfo(
+    safe_VkDescriptorSetVariableDescriptorCountAllocateInfo&& move_src) noexcept
+    : safe_VkDescriptorSetVariableDescriptorCountAllocateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorSetVariableDescriptorCountAllocateInfo& safe_VkDescriptorSetVariableDescriptorCountAllocateInfo::operator=(
+    safe_VkDescriptorSetVariableDescriptorCountAllocateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(descriptorSetCount, move_src.descriptorSetCount);
+    std::swap(pDescriptorCounts, move_src.pDescriptorCounts);
+
+    return *this;
+}
+
 safe_VkDescriptorSetVariableDescriptorCountAllocateInfo::~safe_VkDescriptorSetVariableDescriptorCountAllocateInfo() {
     if (pDescriptorCounts) delete[] pDescriptorCounts;
     FreePnextChain(pNext);
@@ -12913,6 +15650,23 @@ safe_VkDescriptorSetVariableDescriptorCountLayoutSupport& safe_VkDescriptorSetVa
     return *this;
 }
 
+safe_VkDescriptorSetVariableDescriptorCountLayoutSupport::safe_VkDescriptorSetVariableDescriptorCountLayoutSupport(
+    safe_VkDescriptorSetVariableDescriptorCountLayoutSupport&& move_src) noexcept
+    : safe_VkDescriptorSetVariableDescriptorCountLayoutSupport() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorSetVariableDescriptorCountLayoutSupport& safe_VkDescriptorSetVariableDescriptorCountLayoutSupport::operator=(
+    safe_VkDescriptorSetVariableDescriptorCountLayoutSupport&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxVariableDescriptorCount, move_src.maxVariableDescriptorCount);
+
+    return *this;
+}
+
 safe_VkDescriptorSetVariableDescriptorCountLayoutSupport::~safe_VkDescriptorSetVariableDescriptorCountLayoutSupport() {
     FreePnextChain(pNext);
 }
@@ -12981,6 +15735,25 @@ safe_VkSubpassDescriptionDepthStencilResolve& safe_VkSubpassDescriptionDepthSten
     return *this;
 }
 
+safe_VkSubpassDescriptionDepthStencilResolve::safe_VkSubpassDescriptionDepthStencilResolve(
+    safe_VkSubpassDescriptionDepthStencilResolve&& move_src) noexcept
+    : safe_VkSubpassDescriptionDepthStencilResolve() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubpassDescriptionDepthStencilResolve& safe_VkSubpassDescriptionDepthStencilResolve::operator=(
+    safe_VkSubpassDescriptionDepthStencilResolve&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(depthResolveMode, move_src.depthResolveMode);
+    std::swap(stencilResolveMode, move_src.stencilResolveMode);
+    std::swap(pDepthStencilResolveAttachment, move_src.pDepthStencilResolveAttachment);
+
+    return *this;
+}
+
 safe_VkSubpassDescriptionDepthStencilResolve::~safe_VkSubpassDescriptionDepthStencilResolve() {
     if (pDepthStencilResolveAttachment) delete pDepthStencilResolveAttachment;
     FreePnextChain(pNext);
@@ -13056,6 +15829,26 @@ safe_VkPhysicalDeviceDepthStencilResolveProperties& safe_VkPhysicalDeviceDepthSt
     return *this;
 }
 
+safe_VkPhysicalDeviceDepthStencilResolveProperties::safe_VkPhysicalDeviceDepthStencilResolveProperties(
+    safe_VkPhysicalDeviceDepthStencilResolveProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceDepthStencilResolveProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDepthStencilResolveProperties& safe_VkPhysicalDeviceDepthStencilResolveProperties::operator=(
+    safe_VkPhysicalDeviceDepthStencilResolveProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(supportedDepthResolveModes, move_src.supportedDepthResolveModes);
+    std::swap(supportedStencilResolveModes, move_src.supportedStencilResolveModes);
+    std::swap(independentResolveNone, move_src.independentResolveNone);
+    std::swap(independentResolve, move_src.independentResolve);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDepthStencilResolveProperties::~safe_VkPhysicalDeviceDepthStencilResolveProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDepthStencilResolveProperties::initialize(const VkPhysicalDeviceDepthStencilResolveProperties* in_struct,
@@ -13110,6 +15903,23 @@ safe_VkPhysicalDeviceScalarBlockLayoutFeatures& safe_VkPhysicalDeviceScalarBlock
     return *this;
 }
 
+safe_VkPhysicalDeviceScalarBlockLayoutFeatures::safe_VkPhysicalDeviceScalarBlockLayoutFeatures(
+    safe_VkPhysicalDeviceScalarBlockLayoutFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceScalarBlockLayoutFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceScalarBlockLayoutFeatures& safe_VkPhysicalDeviceScalarBlockLayoutFeatures::operator=(
+    safe_VkPhysicalDeviceScalarBlockLayoutFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(scalarBlockLayout, move_src.scalarBlockLayout);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceScalarBlockLayoutFeatures::~safe_VkPhysicalDeviceScalarBlockLayoutFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceScalarBlockLayoutFeatures::initialize(const VkPhysicalDeviceScalarBlockLayoutFeatures* in_struct,
@@ -13157,6 +15967,22 @@ safe_VkImageStencilUsageCreateInfo& safe_VkImageStencilUsageCreateInfo::operator
     return *this;
 }
 
+safe_VkImageStencilUsageCreateInfo::safe_VkImageStencilUsageCreateInfo(safe_VkImageStencilUsageCreateInfo&& move_src) noexcept
+    : safe_VkImageStencilUsageCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageStencilUsageCreateInfo& safe_VkImageStencilUsageCreateInfo::operator=(
+    safe_VkImageStencilUsageCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stencilUsage, move_src.stencilUsage);
+
+    return *this;
+}
+
 safe_VkImageStencilUsageCreateInfo::~safe_VkImageStencilUsageCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkImageStencilUsageCreateInfo::initialize(const VkImageStencilUsageCreateInfo* in_struct,
@@ -13206,6 +16032,23 @@ safe_VkSamplerReductionModeCreateInfo& safe_VkSamplerReductionModeCreateInfo::op
     return *this;
 }
 
+safe_VkSamplerReductionModeCreateInfo::safe_VkSamplerReductionModeCreateInfo(
+    safe_VkSamplerReductionModeCreateInfo&& move_src) noexcept
+    : safe_VkSamplerReductionModeCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSamplerReductionModeCreateInfo& safe_VkSamplerReductionModeCreateInfo::operator=(
+    safe_VkSamplerReductionModeCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(reductionMode, move_src.reductionMode);
+
+    return *this;
+}
+
 safe_VkSamplerReductionModeCreateInfo::~safe_VkSamplerReductionModeCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkSamplerReductionModeCreateInfo::initialize(const VkSamplerReductionModeCreateInfo* in_struct,
@@ -13261,6 +16104,24 @@ safe_VkPhysicalDeviceSamplerFilterMinmaxProperties& safe_VkPhysicalDeviceSampler
     return *this;
 }
 
+safe_VkPhysicalDeviceSamplerFilterMinmaxProperties::safe_VkPhysicalDeviceSamplerFilterMinmaxProperties(
+    safe_VkPhysicalDeviceSamplerFilterMinmaxProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceSamplerFilterMinmaxProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSamplerFilterMinmaxProperties& safe_VkPhysicalDeviceSamplerFilterMinmaxProperties::operator=(
+    safe_VkPhysicalDeviceSamplerFilterMinmaxProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(filterMinmaxSingleComponentFormats, move_src.filterMinmaxSingleComponentFormats);
+    std::swap(filterMinmaxImageComponentMapping, move_src.filterMinmaxImageComponentMapping);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSamplerFilterMinmaxProperties::~safe_VkPhysicalDeviceSamplerFilterMinmaxProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceSamplerFilterMinmaxProperties::initialize(const VkPhysicalDeviceSamplerFilterMinmaxProperties* in_struct,
@@ -13322,6 +16183,25 @@ safe_VkPhysicalDeviceVulkanMemoryModelFeatures& safe_VkPhysicalDeviceVulkanMemor
     return *this;
 }
 
+safe_VkPhysicalDeviceVulkanMemoryModelFeatures::safe_VkPhysicalDeviceVulkanMemoryModelFeatures(
+    safe_VkPhysicalDeviceVulkanMemoryModelFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceVulkanMemoryModelFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVulkanMemoryModelFeatures& safe_VkPhysicalDeviceVulkanMemoryModelFeatures::operator=(
+    safe_VkPhysicalDeviceVulkanMemoryModelFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(vulkanMemoryModel, move_src.vulkanMemoryModel);
+    std::swap(vulkanMemoryModelDeviceScope, move_src.vulkanMemoryModelDeviceScope);
+    std::swap(vulkanMemoryModelAvailabilityVisibilityChains, move_src.vulkanMemoryModelAvailabilityVisibilityChains);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVulkanMemoryModelFeatures::~safe_VkPhysicalDeviceVulkanMemoryModelFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceVulkanMemoryModelFeatures::initialize(const VkPhysicalDeviceVulkanMemoryModelFeatures* in_struct,
@@ -13374,6 +16254,23 @@ safe_VkPhysicalDeviceImagelessFramebufferFeatures& safe_VkPhysicalDeviceImageles
     return *this;
 }
 
+safe_VkPhysicalDeviceImagelessFramebufferFeatures::safe_VkPhysicalDeviceImagelessFramebufferFeatures(
+    safe_VkPhysicalDeviceImagelessFramebufferFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceImagelessFramebufferFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImagelessFramebufferFeatures& safe_VkPhysicalDeviceImagelessFramebufferFeatures::operator=(
+    safe_VkPhysicalDeviceImagelessFramebufferFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imagelessFramebuffer, move_src.imagelessFramebuffer);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImagelessFramebufferFeatures::~safe_VkPhysicalDeviceImagelessFramebufferFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceImagelessFramebufferFeatures::initialize(const VkPhysicalDeviceImagelessFramebufferFeatures* in_struct,
@@ -13465,6 +16362,29 @@ safe_VkFramebufferAttachmentImageInfo& safe_VkFramebufferAttachmentImageInfo::op
     return *this;
 }
 
+safe_VkFramebufferAttachmentImageInfo::safe_VkFramebufferAttachmentImageInfo(
+    safe_VkFramebufferAttachmentImageInfo&& move_src) noexcept
+    : safe_VkFramebufferAttachmentImageInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkFramebufferAttachmentImageInfo& safe_VkFramebufferAttachmentImageInfo::operator=(
+    safe_VkFramebufferAttachmentImageInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(usage, move_src.usage);
+    std::swap(width, move_src.width);
+    std::swap(height, move_src.height);
+    std::swap(layerCount, move_src.layerCount);
+    std::swap(viewFormatCount, move_src.viewFormatCount);
+    std::swap(pViewFormats, move_src.pViewFormats);
+
+    return *this;
+}
+
 safe_VkFramebufferAttachmentImageInfo::~safe_VkFramebufferAttachmentImageInfo() {
     if (pViewFormats) delete[] pViewFormats;
     FreePnextChain(pNext);
@@ -13563,6 +16483,24 @@ safe_VkFramebufferAttachmentsCreateInfo& safe_VkFramebufferAttachmentsCreateInfo
     return *this;
 }
 
+safe_VkFramebufferAttachmentsCreateInfo::safe_VkFramebufferAttachmentsCreateInfo(
+    safe_VkFramebufferAttachmentsCreateInfo&& move_src) noexcept
+    : safe_VkFramebufferAttachmentsCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkFramebufferAttachmentsCreateInfo& safe_VkFramebufferAttachmentsCreateInfo::operator=(
+    safe_VkFramebufferAttachmentsCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(attachmentImageInfoCount, move_src.attachmentImageInfoCount);
+    std::swap(pAttachmentImageInfos, move_src.pAttachmentImageInfos);
+
+    return *this;
+}
+
 safe_VkFramebufferAttachmentsCreateInfo::~safe_VkFramebufferAttachmentsCreateInfo() {
     if (pAttachmentImageInfos) delete[] pAttachmentImageInfos;
     FreePnextChain(pNext);
@@ -13650,6 +16588,23 @@ safe_VkRenderPassAttachmentBeginInfo& safe_VkRenderPassAttachmentBeginInfo::oper
     return *this;
 }
 
+safe_VkRenderPassAttachmentBeginInfo::safe_VkRenderPassAttachmentBeginInfo(safe_VkRenderPassAttachmentBeginInfo&& move_src) noexcept
+    : safe_VkRenderPassAttachmentBeginInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassAttachmentBeginInfo& safe_VkRenderPassAttachmentBeginInfo::operator=(
+    safe_VkRenderPassAttachmentBeginInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(attachmentCount, move_src.attachmentCount);
+    std::swap(pAttachments, move_src.pAttachments);
+
+    return *this;
+}
+
 safe_VkRenderPassAttachmentBeginInfo::~safe_VkRenderPassAttachmentBeginInfo() {
     if (pAttachments) delete[] pAttachments;
     FreePnextChain(pNext);
@@ -13719,6 +16674,23 @@ safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures& safe_VkPhysicalDeviceU
     return *this;
 }
 
+safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures::safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures(
+    safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures& safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures::operator=(
+    safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(uniformBufferStandardLayout, move_src.uniformBufferStandardLayout);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures::~safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures() {
     FreePnextChain(pNext);
 }
@@ -13772,6 +16744,23 @@ safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& safe_VkPhysicalDeviceS
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures::safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures(
+    safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures::operator=(
+    safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderSubgroupExtendedTypes, move_src.shaderSubgroupExtendedTypes);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures::~safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures() {
     FreePnextChain(pNext);
 }
@@ -13825,6 +16814,23 @@ safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& safe_VkPhysicalDeviceS
     return *this;
 }
 
+safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures::safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures(
+    safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures::operator=(
+    safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(separateDepthStencilLayouts, move_src.separateDepthStencilLayouts);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures::~safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures() {
     FreePnextChain(pNext);
 }
@@ -13875,6 +16881,23 @@ safe_VkAttachmentReferenceStencilLayout& safe_VkAttachmentReferenceStencilLayout
     return *this;
 }
 
+safe_VkAttachmentReferenceStencilLayout::safe_VkAttachmentReferenceStencilLayout(
+    safe_VkAttachmentReferenceStencilLayout&& move_src) noexcept
+    : safe_VkAttachmentReferenceStencilLayout() {
+    *this = std::move(move_src);
+}
+
+safe_VkAttachmentReferenceStencilLayout& safe_VkAttachmentReferenceStencilLayout::operator=(
+    safe_VkAttachmentReferenceStencilLayout&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stencilLayout, move_src.stencilLayout);
+
+    return *this;
+}
+
 safe_VkAttachmentReferenceStencilLayout::~safe_VkAttachmentReferenceStencilLayout() { FreePnextChain(pNext); }
 
 void safe_VkAttachmentReferenceStencilLayout::initialize(const VkAttachmentReferenceStencilLayout* in_struct,
@@ -13930,6 +16953,24 @@ safe_VkAttachmentDescriptionStencilLayout& safe_VkAttachmentDescriptionStencilLa
     return *this;
 }
 
+safe_VkAttachmentDescriptionStencilLayout::safe_VkAttachmentDescriptionStencilLayout(
+    safe_VkAttachmentDescriptionStencilLayout&& move_src) noexcept
+    : safe_VkAttachmentDescriptionStencilLayout() {
+    *this = std::move(move_src);
+}
+
+safe_VkAttachmentDescriptionStencilLayout& safe_VkAttachmentDescriptionStencilLayout::operator=(
+    safe_VkAttachmentDescriptionStencilLayout&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stencilInitialLayout, move_src.stencilInitialLayout);
+    std::swap(stencilFinalLayout, move_src.stencilFinalLayout);
+
+    return *this;
+}
+
 safe_VkAttachmentDescriptionStencilLayout::~safe_VkAttachmentDescriptionStencilLayout() { FreePnextChain(pNext); }
 
 void safe_VkAttachmentDescriptionStencilLayout::initialize(const VkAttachmentDescriptionStencilLayout* in_struct,
@@ -13968,14 +17009,31 @@ safe_VkPhysicalDeviceHostQueryResetFeatures::safe_VkPhysicalDeviceHostQueryReset
 }
 
 safe_VkPhysicalDeviceHostQueryResetFeatures& safe_VkPhysicalDeviceHostQueryResetFeatures::operator=(
-    const safe_VkPhysicalDeviceHostQueryResetFeatures& copy_src) {
-    if (&copy_src == this) return *this;
-
-    FreePnextChain(pNext);
+    const safe_VkPhysicalDeviceHostQueryResetFeatures& copy_src) {
+    if (&copy_src == this) return *this;
+
+    FreePnextChain(pNext);
+
+    sType = copy_src.sType;
+    hostQueryReset = copy_src.hostQueryReset;
+    pNext = SafePnextCopy(copy_src.pNext);
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceHostQueryResetFeatures::safe_VkPhysicalDeviceHostQueryResetFeatures(
+    safe_VkPhysicalDeviceHostQueryResetFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceHostQueryResetFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceHostQueryResetFeatures& safe_VkPhysicalDeviceHostQueryResetFeatures::operator=(
+    safe_VkPhysicalDeviceHostQueryResetFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
 
-    sType = copy_src.sType;
-    hostQueryReset = copy_src.hostQueryReset;
-    pNext = SafePnextCopy(copy_src.pNext);
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(hostQueryReset, move_src.hostQueryReset);
 
     return *this;
 }
@@ -14028,6 +17086,23 @@ safe_VkPhysicalDeviceTimelineSemaphoreFeatures& safe_VkPhysicalDeviceTimelineSem
     return *this;
 }
 
+safe_VkPhysicalDeviceTimelineSemaphoreFeatures::safe_VkPhysicalDeviceTimelineSemaphoreFeatures(
+    safe_VkPhysicalDeviceTimelineSemaphoreFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceTimelineSemaphoreFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceTimelineSemaphoreFeatures& safe_VkPhysicalDeviceTimelineSemaphoreFeatures::operator=(
+    safe_VkPhysicalDeviceTimelineSemaphoreFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(timelineSemaphore, move_src.timelineSemaphore);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTimelineSemaphoreFeatures::~safe_VkPhysicalDeviceTimelineSemaphoreFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceTimelineSemaphoreFeatures::initialize(const VkPhysicalDeviceTimelineSemaphoreFeatures* in_struct,
@@ -14078,6 +17153,23 @@ safe_VkPhysicalDeviceTimelineSemaphoreProperties& safe_VkPhysicalDeviceTimelineS
     return *this;
 }
 
+safe_VkPhysicalDeviceTimelineSemaphoreProperties::safe_VkPhysicalDeviceTimelineSemaphoreProperties(
+    safe_VkPhysicalDeviceTimelineSemaphoreProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceTimelineSemaphoreProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceTimelineSemaphoreProperties& safe_VkPhysicalDeviceTimelineSemaphoreProperties::operator=(
+    safe_VkPhysicalDeviceTimelineSemaphoreProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxTimelineSemaphoreValueDifference, move_src.maxTimelineSemaphoreValueDifference);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTimelineSemaphoreProperties::~safe_VkPhysicalDeviceTimelineSemaphoreProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceTimelineSemaphoreProperties::initialize(const VkPhysicalDeviceTimelineSemaphoreProperties* in_struct,
@@ -14126,6 +17218,22 @@ safe_VkSemaphoreTypeCreateInfo& safe_VkSemaphoreTypeCreateInfo::operator=(const
     return *this;
 }
 
+safe_VkSemaphoreTypeCreateInfo::safe_VkSemaphoreTypeCreateInfo(safe_VkSemaphoreTypeCreateInfo&& move_src) noexcept
+    : safe_VkSemaphoreTypeCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSemaphoreTypeCreateInfo& safe_VkSemaphoreTypeCreateInfo::operator=(safe_VkSemaphoreTypeCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(semaphoreType, move_src.semaphoreType);
+    std::swap(initialValue, move_src.initialValue);
+
+    return *this;
+}
+
 safe_VkSemaphoreTypeCreateInfo::~safe_VkSemaphoreTypeCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkSemaphoreTypeCreateInfo::initialize(const VkSemaphoreTypeCreateInfo* in_struct,
@@ -14227,6 +17335,25 @@ safe_VkTimelineSemaphoreSubmitInfo& safe_VkTimelineSemaphoreSubmitInfo::operator
     return *this;
 }
 
+safe_VkTimelineSemaphoreSubmitInfo::safe_VkTimelineSemaphoreSubmitInfo(safe_VkTimelineSemaphoreSubmitInfo&& move_src) noexcept
+    : safe_VkTimelineSemaphoreSubmitInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkTimelineSemaphoreSubmitInfo& safe_VkTimelineSemaphoreSubmitInfo::operator=(
+    safe_VkTimelineSemaphoreSubmitInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(waitSemaphoreValueCount, move_src.waitSemaphoreValueCount);
+    std::swap(pWaitSemaphoreValues, move_src.pWaitSemaphoreValues);
+    std::swap(signalSemaphoreValueCount, move_src.signalSemaphoreValueCount);
+    std::swap(pSignalSemaphoreValues, move_src.pSignalSemaphoreValues);
+
+    return *this;
+}
+
 safe_VkTimelineSemaphoreSubmitInfo::~safe_VkTimelineSemaphoreSubmitInfo() {
     if (pWaitSemaphoreValues) delete[] pWaitSemaphoreValues;
     if (pSignalSemaphoreValues) delete[] pSignalSemaphoreValues;
@@ -14359,6 +17486,23 @@ safe_VkSemaphoreWaitInfo& safe_VkSemaphoreWaitInfo::operator=(const safe_VkSemap
     return *this;
 }
 
+safe_VkSemaphoreWaitInfo::safe_VkSemaphoreWaitInfo(safe_VkSemaphoreWaitInfo&& move_src) noexcept : safe_VkSemaphoreWaitInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSemaphoreWaitInfo& safe_VkSemaphoreWaitInfo::operator=(safe_VkSemaphoreWaitInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(semaphoreCount, move_src.semaphoreCount);
+    std::swap(pSemaphores, move_src.pSemaphores);
+    std::swap(pValues, move_src.pValues);
+
+    return *this;
+}
+
 safe_VkSemaphoreWaitInfo::~safe_VkSemaphoreWaitInfo() {
     if (pSemaphores) delete[] pSemaphores;
     if (pValues) delete[] pValues;
@@ -14439,6 +17583,22 @@ safe_VkSemaphoreSignalInfo& safe_VkSemaphoreSignalInfo::operator=(const safe_VkS
     return *this;
 }
 
+safe_VkSemaphoreSignalInfo::safe_VkSemaphoreSignalInfo(safe_VkSemaphoreSignalInfo&& move_src) noexcept
+    : safe_VkSemaphoreSignalInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSemaphoreSignalInfo& safe_VkSemaphoreSignalInfo::operator=(safe_VkSemaphoreSignalInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(semaphore, move_src.semaphore);
+    std::swap(value, move_src.value);
+
+    return *this;
+}
+
 safe_VkSemaphoreSignalInfo::~safe_VkSemaphoreSignalInfo() { FreePnextChain(pNext); }
 
 void safe_VkSemaphoreSignalInfo::initialize(const VkSemaphoreSignalInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -14499,6 +17659,25 @@ safe_VkPhysicalDeviceBufferDeviceAddressFeatures& safe_VkPhysicalDeviceBufferDev
     return *this;
 }
 
+safe_VkPhysicalDeviceBufferDeviceAddressFeatures::safe_VkPhysicalDeviceBufferDeviceAddressFeatures(
+    safe_VkPhysicalDeviceBufferDeviceAddressFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceBufferDeviceAddressFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceBufferDeviceAddressFeatures& safe_VkPhysicalDeviceBufferDeviceAddressFeatures::operator=(
+    safe_VkPhysicalDeviceBufferDeviceAddressFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(bufferDeviceAddress, move_src.bufferDeviceAddress);
+    std::swap(bufferDeviceAddressCaptureReplay, move_src.bufferDeviceAddressCaptureReplay);
+    std::swap(bufferDeviceAddressMultiDevice, move_src.bufferDeviceAddressMultiDevice);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceBufferDeviceAddressFeatures::~safe_VkPhysicalDeviceBufferDeviceAddressFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceBufferDeviceAddressFeatures::initialize(const VkPhysicalDeviceBufferDeviceAddressFeatures* in_struct,
@@ -14549,6 +17728,21 @@ safe_VkBufferDeviceAddressInfo& safe_VkBufferDeviceAddressInfo::operator=(const
     return *this;
 }
 
+safe_VkBufferDeviceAddressInfo::safe_VkBufferDeviceAddressInfo(safe_VkBufferDeviceAddressInfo&& move_src) noexcept
+    : safe_VkBufferDeviceAddressInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferDeviceAddressInfo& safe_VkBufferDeviceAddressInfo::operator=(safe_VkBufferDeviceAddressInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(buffer, move_src.buffer);
+
+    return *this;
+}
+
 safe_VkBufferDeviceAddressInfo::~safe_VkBufferDeviceAddressInfo() { FreePnextChain(pNext); }
 
 void safe_VkBufferDeviceAddressInfo::initialize(const VkBufferDeviceAddressInfo* in_struct,
@@ -14597,6 +17791,23 @@ safe_VkBufferOpaqueCaptureAddressCreateInfo& safe_VkBufferOpaqueCaptureAddressCr
     return *this;
 }
 
+safe_VkBufferOpaqueCaptureAddressCreateInfo::safe_VkBufferOpaqueCaptureAddressCreateInfo(
+    safe_VkBufferOpaqueCaptureAddressCreateInfo&& move_src) noexcept
+    : safe_VkBufferOpaqueCaptureAddressCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferOpaqueCaptureAddressCreateInfo& safe_VkBufferOpaqueCaptureAddressCreateInfo::operator=(
+    safe_VkBufferOpaqueCaptureAddressCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(opaqueCaptureAddress, move_src.opaqueCaptureAddress);
+
+    return *this;
+}
+
 safe_VkBufferOpaqueCaptureAddressCreateInfo::~safe_VkBufferOpaqueCaptureAddressCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkBufferOpaqueCaptureAddressCreateInfo::initialize(const VkBufferOpaqueCaptureAddressCreateInfo* in_struct,
@@ -14645,6 +17856,23 @@ safe_VkMemoryOpaqueCaptureAddressAllocateInfo& safe_VkMemoryOpaqueCaptureAddress
     return *this;
 }
 
+safe_VkMemoryOpaqueCaptureAddressAllocateInfo::safe_VkMemoryOpaqueCaptureAddressAllocateInfo(
+    safe_VkMemoryOpaqueCaptureAddressAllocateInfo&& move_src) noexcept
+    : safe_VkMemoryOpaqueCaptureAddressAllocateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryOpaqueCaptureAddressAllocateInfo& safe_VkMemoryOpaqueCaptureAddressAllocateInfo::operator=(
+    safe_VkMemoryOpaqueCaptureAddressAllocateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(opaqueCaptureAddress, move_src.opaqueCaptureAddress);
+
+    return *this;
+}
+
 safe_VkMemoryOpaqueCaptureAddressAllocateInfo::~safe_VkMemoryOpaqueCaptureAddressAllocateInfo() { FreePnextChain(pNext); }
 
 void safe_VkMemoryOpaqueCaptureAddressAllocateInfo::initialize(const VkMemoryOpaqueCaptureAddressAllocateInfo* in_struct,
@@ -14693,6 +17921,23 @@ safe_VkDeviceMemoryOpaqueCaptureAddressInfo& safe_VkDeviceMemoryOpaqueCaptureAdd
     return *this;
 }
 
+safe_VkDeviceMemoryOpaqueCaptureAddressInfo::safe_VkDeviceMemoryOpaqueCaptureAddressInfo(
+    safe_VkDeviceMemoryOpaqueCaptureAddressInfo&& move_src) noexcept
+    : safe_VkDeviceMemoryOpaqueCaptureAddressInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceMemoryOpaqueCaptureAddressInfo& safe_VkDeviceMemoryOpaqueCaptureAddressInfo::operator=(
+    safe_VkDeviceMemoryOpaqueCaptureAddressInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memory, move_src.memory);
+
+    return *this;
+}
+
 safe_VkDeviceMemoryOpaqueCaptureAddressInfo::~safe_VkDeviceMemoryOpaqueCaptureAddressInfo() { FreePnextChain(pNext); }
 
 void safe_VkDeviceMemoryOpaqueCaptureAddressInfo::initialize(const VkDeviceMemoryOpaqueCaptureAddressInfo* in_struct,
@@ -14801,6 +18046,37 @@ safe_VkPhysicalDeviceVulkan13Features& safe_VkPhysicalDeviceVulkan13Features::op
     return *this;
 }
 
+safe_VkPhysicalDeviceVulkan13Features::safe_VkPhysicalDeviceVulkan13Features(
+    safe_VkPhysicalDeviceVulkan13Features&& move_src) noexcept
+    : safe_VkPhysicalDeviceVulkan13Features() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVulkan13Features& safe_VkPhysicalDeviceVulkan13Features::operator=(
+    safe_VkPhysicalDeviceVulkan13Features&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(robustImageAccess, move_src.robustImageAccess);
+    std::swap(inlineUniformBlock, move_src.inlineUniformBlock);
+    std::swap(descriptorBindingInlineUniformBlockUpdateAfterBind, move_src.descriptorBindingInlineUniformBlockUpdateAfterBind);
+    std::swap(pipelineCreationCacheControl, move_src.pipelineCreationCacheControl);
+    std::swap(privateData, move_src.privateData);
+    std::swap(shaderDemoteToHelperInvocation, move_src.shaderDemoteToHelperInvocation);
+    std::swap(shaderTerminateInvocation, move_src.shaderTerminateInvocation);
+    std::swap(subgroupSizeControl, move_src.subgroupSizeControl);
+    std::swap(computeFullSubgroups, move_src.computeFullSubgroups);
+    std::swap(synchronization2, move_src.synchronization2);
+    std::swap(textureCompressionASTC_HDR, move_src.textureCompressionASTC_HDR);
+    std::swap(shaderZeroInitializeWorkgroupMemory, move_src.shaderZeroInitializeWorkgroupMemory);
+    std::swap(dynamicRendering, move_src.dynamicRendering);
+    std::swap(shaderIntegerDotProduct, move_src.shaderIntegerDotProduct);
+    std::swap(maintenance4, move_src.maintenance4);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVulkan13Features::~safe_VkPhysicalDeviceVulkan13Features() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceVulkan13Features::initialize(const VkPhysicalDeviceVulkan13Features* in_struct,
@@ -15101,6 +18377,84 @@ safe_VkPhysicalDeviceVulkan13Properties& safe_VkPhysicalDeviceVulkan13Properties
     return *this;
 }
 
+safe_VkPhysicalDeviceVulkan13Properties::safe_VkPhysicalDeviceVulkan13Properties(
+    safe_VkPhysicalDeviceVulkan13Properties&& move_src) noexcept
+    : safe_VkPhysicalDeviceVulkan13Properties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVulkan13Properties& safe_VkPhysicalDeviceVulkan13Properties::operator=(
+    safe_VkPhysicalDeviceVulkan13Properties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(minSubgroupSize, move_src.minSubgroupSize);
+    std::swap(maxSubgroupSize, move_src.maxSubgroupSize);
+    std::swap(maxComputeWorkgroupSubgroups, move_src.maxComputeWorkgroupSubgroups);
+    std::swap(requiredSubgroupSizeStages, move_src.requiredSubgroupSizeStages);
+    std::swap(maxInlineUniformBlockSize, move_src.maxInlineUniformBlockSize);
+    std::swap(maxPerStageDescriptorInlineUniformBlocks, move_src.maxPerStageDescriptorInlineUniformBlocks);
+    std::swap(maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks,
+              move_src.maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks);
+    std::swap(maxDescriptorSetInlineUniformBlocks, move_src.maxDescriptorSetInlineUniformBlocks);
+    std::swap(maxDescriptorSetUpdateAfterBindInlineUniformBlocks, move_src.maxDescriptorSetUpdateAfterBindInlineUniformBlocks);
+    std::swap(maxInlineUniformTotalSize, move_src.maxInlineUniformTotalSize);
+    std::swap(integerDotProduct8BitUnsignedAccelerated, move_src.integerDotProduct8BitUnsignedAccelerated);
+    std::swap(integerDotProduct8BitSignedAccelerated, move_src.integerDotProduct8BitSignedAccelerated);
+    std::swap(integerDotProduct8BitMixedSignednessAccelerated, move_src.integerDotProduct8BitMixedSignednessAccelerated);
+    std::swap(integerDotProduct4x8BitPackedUnsignedAccelerated, move_src.integerDotProduct4x8BitPackedUnsignedAccelerated);
+    std::swap(integerDotProduct4x8BitPackedSignedAccelerated, move_src.integerDotProduct4x8BitPackedSignedAccelerated);
+    std::swap(integerDotProduct4x8BitPackedMixedSignednessAccelerated,
+              move_src.integerDotProduct4x8BitPackedMixedSignednessAccelerated);
+    std::swap(integerDotProduct16BitUnsignedAccelerated, move_src.integerDotProduct16BitUnsignedAccelerated);
+    std::swap(integerDotProduct16BitSignedAccelerated, move_src.integerDotProduct16BitSignedAccelerated);
+    std::swap(integerDotProduct16BitMixedSignednessAccelerated, move_src.integerDotProduct16BitMixedSignednessAccelerated);
+    std::swap(integerDotProduct32BitUnsignedAccelerated, move_src.integerDotProduct32BitUnsignedAccelerated);
+    std::swap(integerDotProduct32BitSignedAccelerated, move_src.integerDotProduct32BitSignedAccelerated);
+    std::swap(integerDotProduct32BitMixedSignednessAccelerated, move_src.integerDotProduct32BitMixedSignednessAccelerated);
+    std::swap(integerDotProduct64BitUnsignedAccelerated, move_src.integerDotProduct64BitUnsignedAccelerated);
+    std::swap(integerDotProduct64BitSignedAccelerated, move_src.integerDotProduct64BitSignedAccelerated);
+    std::swap(integerDotProduct64BitMixedSignednessAccelerated, move_src.integerDotProduct64BitMixedSignednessAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating8BitUnsignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating8BitUnsignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating8BitSignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating8BitSignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated,
+              move_src.integerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated,
+              move_src.integerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating16BitUnsignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating16BitUnsignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating16BitSignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating16BitSignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated,
+              move_src.integerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating32BitUnsignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating32BitUnsignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating32BitSignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating32BitSignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated,
+              move_src.integerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating64BitUnsignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating64BitUnsignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating64BitSignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating64BitSignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated,
+              move_src.integerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated);
+    std::swap(storageTexelBufferOffsetAlignmentBytes, move_src.storageTexelBufferOffsetAlignmentBytes);
+    std::swap(storageTexelBufferOffsetSingleTexelAlignment, move_src.storageTexelBufferOffsetSingleTexelAlignment);
+    std::swap(uniformTexelBufferOffsetAlignmentBytes, move_src.uniformTexelBufferOffsetAlignmentBytes);
+    std::swap(uniformTexelBufferOffsetSingleTexelAlignment, move_src.uniformTexelBufferOffsetSingleTexelAlignment);
+    std::swap(maxBufferSize, move_src.maxBufferSize);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVulkan13Properties::~safe_VkPhysicalDeviceVulkan13Properties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceVulkan13Properties::initialize(const VkPhysicalDeviceVulkan13Properties* in_struct,
@@ -15309,6 +18663,25 @@ safe_VkPipelineCreationFeedbackCreateInfo& safe_VkPipelineCreationFeedbackCreate
     return *this;
 }
 
+safe_VkPipelineCreationFeedbackCreateInfo::safe_VkPipelineCreationFeedbackCreateInfo(
+    safe_VkPipelineCreationFeedbackCreateInfo&& move_src) noexcept
+    : safe_VkPipelineCreationFeedbackCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineCreationFeedbackCreateInfo& safe_VkPipelineCreationFeedbackCreateInfo::operator=(
+    safe_VkPipelineCreationFeedbackCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pPipelineCreationFeedback, move_src.pPipelineCreationFeedback);
+    std::swap(pipelineStageCreationFeedbackCount, move_src.pipelineStageCreationFeedbackCount);
+    std::swap(pPipelineStageCreationFeedbacks, move_src.pPipelineStageCreationFeedbacks);
+
+    return *this;
+}
+
 safe_VkPipelineCreationFeedbackCreateInfo::~safe_VkPipelineCreationFeedbackCreateInfo() {
     if (pPipelineCreationFeedback) delete pPipelineCreationFeedback;
     if (pPipelineStageCreationFeedbacks) delete[] pPipelineStageCreationFeedbacks;
@@ -15388,6 +18761,23 @@ safe_VkPhysicalDeviceShaderTerminateInvocationFeatures& safe_VkPhysicalDeviceSha
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderTerminateInvocationFeatures::safe_VkPhysicalDeviceShaderTerminateInvocationFeatures(
+    safe_VkPhysicalDeviceShaderTerminateInvocationFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderTerminateInvocationFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderTerminateInvocationFeatures& safe_VkPhysicalDeviceShaderTerminateInvocationFeatures::operator=(
+    safe_VkPhysicalDeviceShaderTerminateInvocationFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderTerminateInvocation, move_src.shaderTerminateInvocation);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderTerminateInvocationFeatures::~safe_VkPhysicalDeviceShaderTerminateInvocationFeatures() {
     FreePnextChain(pNext);
 }
@@ -15485,6 +18875,26 @@ safe_VkPhysicalDeviceToolProperties& safe_VkPhysicalDeviceToolProperties::operat
     return *this;
 }
 
+safe_VkPhysicalDeviceToolProperties::safe_VkPhysicalDeviceToolProperties(safe_VkPhysicalDeviceToolProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceToolProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceToolProperties& safe_VkPhysicalDeviceToolProperties::operator=(
+    safe_VkPhysicalDeviceToolProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(name, move_src.name);
+    std::swap(version, move_src.version);
+    std::swap(purposes, move_src.purposes);
+    std::swap(description, move_src.description);
+    std::swap(layer, move_src.layer);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceToolProperties::~safe_VkPhysicalDeviceToolProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceToolProperties::initialize(const VkPhysicalDeviceToolProperties* in_struct,
@@ -15568,6 +18978,23 @@ safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& safe_VkPhysicalDevi
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures::safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures(
+    safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures::operator=(
+    safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderDemoteToHelperInvocation, move_src.shaderDemoteToHelperInvocation);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures::~safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures() {
     FreePnextChain(pNext);
 }
@@ -15618,6 +19045,23 @@ safe_VkPhysicalDevicePrivateDataFeatures& safe_VkPhysicalDevicePrivateDataFeatur
     return *this;
 }
 
+safe_VkPhysicalDevicePrivateDataFeatures::safe_VkPhysicalDevicePrivateDataFeatures(
+    safe_VkPhysicalDevicePrivateDataFeatures&& move_src) noexcept
+    : safe_VkPhysicalDevicePrivateDataFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePrivateDataFeatures& safe_VkPhysicalDevicePrivateDataFeatures::operator=(
+    safe_VkPhysicalDevicePrivateDataFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(privateData, move_src.privateData);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePrivateDataFeatures::~safe_VkPhysicalDevicePrivateDataFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePrivateDataFeatures::initialize(const VkPhysicalDevicePrivateDataFeatures* in_struct,
@@ -15665,6 +19109,22 @@ safe_VkDevicePrivateDataCreateInfo& safe_VkDevicePrivateDataCreateInfo::operator
     return *this;
 }
 
+safe_VkDevicePrivateDataCreateInfo::safe_VkDevicePrivateDataCreateInfo(safe_VkDevicePrivateDataCreateInfo&& move_src) noexcept
+    : safe_VkDevicePrivateDataCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDevicePrivateDataCreateInfo& safe_VkDevicePrivateDataCreateInfo::operator=(
+    safe_VkDevicePrivateDataCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(privateDataSlotRequestCount, move_src.privateDataSlotRequestCount);
+
+    return *this;
+}
+
 safe_VkDevicePrivateDataCreateInfo::~safe_VkDevicePrivateDataCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkDevicePrivateDataCreateInfo::initialize(const VkDevicePrivateDataCreateInfo* in_struct,
@@ -15711,6 +19171,22 @@ safe_VkPrivateDataSlotCreateInfo& safe_VkPrivateDataSlotCreateInfo::operator=(co
     return *this;
 }
 
+safe_VkPrivateDataSlotCreateInfo::safe_VkPrivateDataSlotCreateInfo(safe_VkPrivateDataSlotCreateInfo&& move_src) noexcept
+    : safe_VkPrivateDataSlotCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPrivateDataSlotCreateInfo& safe_VkPrivateDataSlotCreateInfo::operator=(
+    safe_VkPrivateDataSlotCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkPrivateDataSlotCreateInfo::~safe_VkPrivateDataSlotCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkPrivateDataSlotCreateInfo::initialize(const VkPrivateDataSlotCreateInfo* in_struct,
@@ -15762,6 +19238,23 @@ safe_VkPhysicalDevicePipelineCreationCacheControlFeatures& safe_VkPhysicalDevice
     return *this;
 }
 
+safe_VkPhysicalDevicePipelineCreationCacheControlFeatures::safe_VkPhysicalDevicePipelineCreationCacheControlFeatures(
+    safe_VkPhysicalDevicePipelineCreationCacheControlFeatures&& move_src) noexcept
+    : safe_VkPhysicalDevicePipelineCreationCacheControlFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePipelineCreationCacheControlFeatures& safe_VkPhysicalDevicePipelineCreationCacheControlFeatures::operator=(
+    safe_VkPhysicalDevicePipelineCreationCacheControlFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipelineCreationCacheControl, move_src.pipelineCreationCacheControl);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePipelineCreationCacheControlFeatures::~safe_VkPhysicalDevicePipelineCreationCacheControlFeatures() {
     FreePnextChain(pNext);
 }
@@ -15820,6 +19313,23 @@ safe_VkMemoryBarrier2& safe_VkMemoryBarrier2::operator=(const safe_VkMemoryBarri
     return *this;
 }
 
+safe_VkMemoryBarrier2::safe_VkMemoryBarrier2(safe_VkMemoryBarrier2&& move_src) noexcept : safe_VkMemoryBarrier2() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryBarrier2& safe_VkMemoryBarrier2::operator=(safe_VkMemoryBarrier2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcStageMask, move_src.srcStageMask);
+    std::swap(srcAccessMask, move_src.srcAccessMask);
+    std::swap(dstStageMask, move_src.dstStageMask);
+    std::swap(dstAccessMask, move_src.dstAccessMask);
+
+    return *this;
+}
+
 safe_VkMemoryBarrier2::~safe_VkMemoryBarrier2() { FreePnextChain(pNext); }
 
 void safe_VkMemoryBarrier2::initialize(const VkMemoryBarrier2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -15905,6 +19415,29 @@ safe_VkBufferMemoryBarrier2& safe_VkBufferMemoryBarrier2::operator=(const safe_V
     return *this;
 }
 
+safe_VkBufferMemoryBarrier2::safe_VkBufferMemoryBarrier2(safe_VkBufferMemoryBarrier2&& move_src) noexcept
+    : safe_VkBufferMemoryBarrier2() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferMemoryBarrier2& safe_VkBufferMemoryBarrier2::operator=(safe_VkBufferMemoryBarrier2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcStageMask, move_src.srcStageMask);
+    std::swap(srcAccessMask, move_src.srcAccessMask);
+    std::swap(dstStageMask, move_src.dstStageMask);
+    std::swap(dstAccessMask, move_src.dstAccessMask);
+    std::swap(srcQueueFamilyIndex, move_src.srcQueueFamilyIndex);
+    std::swap(dstQueueFamilyIndex, move_src.dstQueueFamilyIndex);
+    std::swap(buffer, move_src.buffer);
+    std::swap(offset, move_src.offset);
+    std::swap(size, move_src.size);
+
+    return *this;
+}
+
 safe_VkBufferMemoryBarrier2::~safe_VkBufferMemoryBarrier2() { FreePnextChain(pNext); }
 
 void safe_VkBufferMemoryBarrier2::initialize(const VkBufferMemoryBarrier2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -16005,6 +19538,30 @@ safe_VkImageMemoryBarrier2& safe_VkImageMemoryBarrier2::operator=(const safe_VkI
     return *this;
 }
 
+safe_VkImageMemoryBarrier2::safe_VkImageMemoryBarrier2(safe_VkImageMemoryBarrier2&& move_src) noexcept
+    : safe_VkImageMemoryBarrier2() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageMemoryBarrier2& safe_VkImageMemoryBarrier2::operator=(safe_VkImageMemoryBarrier2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcStageMask, move_src.srcStageMask);
+    std::swap(srcAccessMask, move_src.srcAccessMask);
+    std::swap(dstStageMask, move_src.dstStageMask);
+    std::swap(dstAccessMask, move_src.dstAccessMask);
+    std::swap(oldLayout, move_src.oldLayout);
+    std::swap(newLayout, move_src.newLayout);
+    std::swap(srcQueueFamilyIndex, move_src.srcQueueFamilyIndex);
+    std::swap(dstQueueFamilyIndex, move_src.dstQueueFamilyIndex);
+    std::swap(image, move_src.image);
+    std::swap(subresourceRange, move_src.subresourceRange);
+
+    return *this;
+}
+
 safe_VkImageMemoryBarrier2::~safe_VkImageMemoryBarrier2() { FreePnextChain(pNext); }
 
 void safe_VkImageMemoryBarrier2::initialize(const VkImageMemoryBarrier2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -16152,6 +19709,26 @@ safe_VkDependencyInfo& safe_VkDependencyInfo::operator=(const safe_VkDependencyI
     return *this;
 }
 
+safe_VkDependencyInfo::safe_VkDependencyInfo(safe_VkDependencyInfo&& move_src) noexcept : safe_VkDependencyInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDependencyInfo& safe_VkDependencyInfo::operator=(safe_VkDependencyInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(dependencyFlags, move_src.dependencyFlags);
+    std::swap(memoryBarrierCount, move_src.memoryBarrierCount);
+    std::swap(pMemoryBarriers, move_src.pMemoryBarriers);
+    std::swap(bufferMemoryBarrierCount, move_src.bufferMemoryBarrierCount);
+    std::swap(pBufferMemoryBarriers, move_src.pBufferMemoryBarriers);
+    std::swap(imageMemoryBarrierCount, move_src.imageMemoryBarrierCount);
+    std::swap(pImageMemoryBarriers, move_src.pImageMemoryBarriers);
+
+    return *this;
+}
+
 safe_VkDependencyInfo::~safe_VkDependencyInfo() {
     if (pMemoryBarriers) delete[] pMemoryBarriers;
     if (pBufferMemoryBarriers) delete[] pBufferMemoryBarriers;
@@ -16262,6 +19839,24 @@ safe_VkSemaphoreSubmitInfo& safe_VkSemaphoreSubmitInfo::operator=(const safe_VkS
     return *this;
 }
 
+safe_VkSemaphoreSubmitInfo::safe_VkSemaphoreSubmitInfo(safe_VkSemaphoreSubmitInfo&& move_src) noexcept
+    : safe_VkSemaphoreSubmitInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkSemaphoreSubmitInfo& safe_VkSemaphoreSubmitInfo::operator=(safe_VkSemaphoreSubmitInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(semaphore, move_src.semaphore);
+    std::swap(value, move_src.value);
+    std::swap(stageMask, move_src.stageMask);
+    std::swap(deviceIndex, move_src.deviceIndex);
+
+    return *this;
+}
+
 safe_VkSemaphoreSubmitInfo::~safe_VkSemaphoreSubmitInfo() { FreePnextChain(pNext); }
 
 void safe_VkSemaphoreSubmitInfo::initialize(const VkSemaphoreSubmitInfo* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -16315,6 +19910,22 @@ safe_VkCommandBufferSubmitInfo& safe_VkCommandBufferSubmitInfo::operator=(const
     return *this;
 }
 
+safe_VkCommandBufferSubmitInfo::safe_VkCommandBufferSubmitInfo(safe_VkCommandBufferSubmitInfo&& move_src) noexcept
+    : safe_VkCommandBufferSubmitInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkCommandBufferSubmitInfo& safe_VkCommandBufferSubmitInfo::operator=(safe_VkCommandBufferSubmitInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(commandBuffer, move_src.commandBuffer);
+    std::swap(deviceMask, move_src.deviceMask);
+
+    return *this;
+}
+
 safe_VkCommandBufferSubmitInfo::~safe_VkCommandBufferSubmitInfo() { FreePnextChain(pNext); }
 
 void safe_VkCommandBufferSubmitInfo::initialize(const VkCommandBufferSubmitInfo* in_struct,
@@ -16446,6 +20057,26 @@ safe_VkSubmitInfo2& safe_VkSubmitInfo2::operator=(const safe_VkSubmitInfo2& copy
     return *this;
 }
 
+safe_VkSubmitInfo2::safe_VkSubmitInfo2(safe_VkSubmitInfo2&& move_src) noexcept : safe_VkSubmitInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubmitInfo2& safe_VkSubmitInfo2::operator=(safe_VkSubmitInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(waitSemaphoreInfoCount, move_src.waitSemaphoreInfoCount);
+    std::swap(pWaitSemaphoreInfos, move_src.pWaitSemaphoreInfos);
+    std::swap(commandBufferInfoCount, move_src.commandBufferInfoCount);
+    std::swap(pCommandBufferInfos, move_src.pCommandBufferInfos);
+    std::swap(signalSemaphoreInfoCount, move_src.signalSemaphoreInfoCount);
+    std::swap(pSignalSemaphoreInfos, move_src.pSignalSemaphoreInfos);
+
+    return *this;
+}
+
 safe_VkSubmitInfo2::~safe_VkSubmitInfo2() {
     if (pWaitSemaphoreInfos) delete[] pWaitSemaphoreInfos;
     if (pCommandBufferInfos) delete[] pCommandBufferInfos;
@@ -16548,6 +20179,23 @@ safe_VkPhysicalDeviceSynchronization2Features& safe_VkPhysicalDeviceSynchronizat
     return *this;
 }
 
+safe_VkPhysicalDeviceSynchronization2Features::safe_VkPhysicalDeviceSynchronization2Features(
+    safe_VkPhysicalDeviceSynchronization2Features&& move_src) noexcept
+    : safe_VkPhysicalDeviceSynchronization2Features() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSynchronization2Features& safe_VkPhysicalDeviceSynchronization2Features::operator=(
+    safe_VkPhysicalDeviceSynchronization2Features&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(synchronization2, move_src.synchronization2);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSynchronization2Features::~safe_VkPhysicalDeviceSynchronization2Features() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceSynchronization2Features::initialize(const VkPhysicalDeviceSynchronization2Features* in_struct,
@@ -16599,6 +20247,23 @@ safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& safe_VkPhysicalDevic
     return *this;
 }
 
+safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures::safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures(
+    safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures::operator=(
+    safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderZeroInitializeWorkgroupMemory, move_src.shaderZeroInitializeWorkgroupMemory);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures::~safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures() {
     FreePnextChain(pNext);
 }
@@ -16649,6 +20314,23 @@ safe_VkPhysicalDeviceImageRobustnessFeatures& safe_VkPhysicalDeviceImageRobustne
     return *this;
 }
 
+safe_VkPhysicalDeviceImageRobustnessFeatures::safe_VkPhysicalDeviceImageRobustnessFeatures(
+    safe_VkPhysicalDeviceImageRobustnessFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageRobustnessFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageRobustnessFeatures& safe_VkPhysicalDeviceImageRobustnessFeatures::operator=(
+    safe_VkPhysicalDeviceImageRobustnessFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(robustImageAccess, move_src.robustImageAccess);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageRobustnessFeatures::~safe_VkPhysicalDeviceImageRobustnessFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceImageRobustnessFeatures::initialize(const VkPhysicalDeviceImageRobustnessFeatures* in_struct,
@@ -16698,6 +20380,22 @@ safe_VkBufferCopy2& safe_VkBufferCopy2::operator=(const safe_VkBufferCopy2& copy
     return *this;
 }
 
+safe_VkBufferCopy2::safe_VkBufferCopy2(safe_VkBufferCopy2&& move_src) noexcept : safe_VkBufferCopy2() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferCopy2& safe_VkBufferCopy2::operator=(safe_VkBufferCopy2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcOffset, move_src.srcOffset);
+    std::swap(dstOffset, move_src.dstOffset);
+    std::swap(size, move_src.size);
+
+    return *this;
+}
+
 safe_VkBufferCopy2::~safe_VkBufferCopy2() { FreePnextChain(pNext); }
 
 void safe_VkBufferCopy2::initialize(const VkBufferCopy2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -16775,6 +20473,23 @@ safe_VkCopyBufferInfo2& safe_VkCopyBufferInfo2::operator=(const safe_VkCopyBuffe
     return *this;
 }
 
+safe_VkCopyBufferInfo2::safe_VkCopyBufferInfo2(safe_VkCopyBufferInfo2&& move_src) noexcept : safe_VkCopyBufferInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyBufferInfo2& safe_VkCopyBufferInfo2::operator=(safe_VkCopyBufferInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcBuffer, move_src.srcBuffer);
+    std::swap(dstBuffer, move_src.dstBuffer);
+    std::swap(regionCount, move_src.regionCount);
+    std::swap(pRegions, move_src.pRegions);
+
+    return *this;
+}
+
 safe_VkCopyBufferInfo2::~safe_VkCopyBufferInfo2() {
     if (pRegions) delete[] pRegions;
     FreePnextChain(pNext);
@@ -16859,6 +20574,24 @@ safe_VkImageCopy2& safe_VkImageCopy2::operator=(const safe_VkImageCopy2& copy_sr
     return *this;
 }
 
+safe_VkImageCopy2::safe_VkImageCopy2(safe_VkImageCopy2&& move_src) noexcept : safe_VkImageCopy2() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageCopy2& safe_VkImageCopy2::operator=(safe_VkImageCopy2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcSubresource, move_src.srcSubresource);
+    std::swap(srcOffset, move_src.srcOffset);
+    std::swap(dstSubresource, move_src.dstSubresource);
+    std::swap(dstOffset, move_src.dstOffset);
+    std::swap(extent, move_src.extent);
+
+    return *this;
+}
+
 safe_VkImageCopy2::~safe_VkImageCopy2() { FreePnextChain(pNext); }
 
 void safe_VkImageCopy2::initialize(const VkImageCopy2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -16953,6 +20686,25 @@ safe_VkCopyImageInfo2& safe_VkCopyImageInfo2::operator=(const safe_VkCopyImageIn
     return *this;
 }
 
+safe_VkCopyImageInfo2::safe_VkCopyImageInfo2(safe_VkCopyImageInfo2&& move_src) noexcept : safe_VkCopyImageInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyImageInfo2& safe_VkCopyImageInfo2::operator=(safe_VkCopyImageInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcImage, move_src.srcImage);
+    std::swap(srcImageLayout, move_src.srcImageLayout);
+    std::swap(dstImage, move_src.dstImage);
+    std::swap(dstImageLayout, move_src.dstImageLayout);
+    std::swap(regionCount, move_src.regionCount);
+    std::swap(pRegions, move_src.pRegions);
+
+    return *this;
+}
+
 safe_VkCopyImageInfo2::~safe_VkCopyImageInfo2() {
     if (pRegions) delete[] pRegions;
     FreePnextChain(pNext);
@@ -17046,6 +20798,25 @@ safe_VkBufferImageCopy2& safe_VkBufferImageCopy2::operator=(const safe_VkBufferI
     return *this;
 }
 
+safe_VkBufferImageCopy2::safe_VkBufferImageCopy2(safe_VkBufferImageCopy2&& move_src) noexcept : safe_VkBufferImageCopy2() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferImageCopy2& safe_VkBufferImageCopy2::operator=(safe_VkBufferImageCopy2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(bufferOffset, move_src.bufferOffset);
+    std::swap(bufferRowLength, move_src.bufferRowLength);
+    std::swap(bufferImageHeight, move_src.bufferImageHeight);
+    std::swap(imageSubresource, move_src.imageSubresource);
+    std::swap(imageOffset, move_src.imageOffset);
+    std::swap(imageExtent, move_src.imageExtent);
+
+    return *this;
+}
+
 safe_VkBufferImageCopy2::~safe_VkBufferImageCopy2() { FreePnextChain(pNext); }
 
 void safe_VkBufferImageCopy2::initialize(const VkBufferImageCopy2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -17138,6 +20909,25 @@ safe_VkCopyBufferToImageInfo2& safe_VkCopyBufferToImageInfo2::operator=(const sa
     return *this;
 }
 
+safe_VkCopyBufferToImageInfo2::safe_VkCopyBufferToImageInfo2(safe_VkCopyBufferToImageInfo2&& move_src) noexcept
+    : safe_VkCopyBufferToImageInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyBufferToImageInfo2& safe_VkCopyBufferToImageInfo2::operator=(safe_VkCopyBufferToImageInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcBuffer, move_src.srcBuffer);
+    std::swap(dstImage, move_src.dstImage);
+    std::swap(dstImageLayout, move_src.dstImageLayout);
+    std::swap(regionCount, move_src.regionCount);
+    std::swap(pRegions, move_src.pRegions);
+
+    return *this;
+}
+
 safe_VkCopyBufferToImageInfo2::~safe_VkCopyBufferToImageInfo2() {
     if (pRegions) delete[] pRegions;
     FreePnextChain(pNext);
@@ -17246,6 +21036,25 @@ safe_VkCopyImageToBufferInfo2& safe_VkCopyImageToBufferInfo2::operator=(const sa
     return *this;
 }
 
+safe_VkCopyImageToBufferInfo2::safe_VkCopyImageToBufferInfo2(safe_VkCopyImageToBufferInfo2&& move_src) noexcept
+    : safe_VkCopyImageToBufferInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyImageToBufferInfo2& safe_VkCopyImageToBufferInfo2::operator=(safe_VkCopyImageToBufferInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcImage, move_src.srcImage);
+    std::swap(srcImageLayout, move_src.srcImageLayout);
+    std::swap(dstBuffer, move_src.dstBuffer);
+    std::swap(regionCount, move_src.regionCount);
+    std::swap(pRegions, move_src.pRegions);
+
+    return *this;
+}
+
 safe_VkCopyImageToBufferInfo2::~safe_VkCopyImageToBufferInfo2() {
     if (pRegions) delete[] pRegions;
     FreePnextChain(pNext);
@@ -17340,6 +21149,23 @@ safe_VkImageBlit2& safe_VkImageBlit2::operator=(const safe_VkImageBlit2& copy_sr
     return *this;
 }
 
+safe_VkImageBlit2::safe_VkImageBlit2(safe_VkImageBlit2&& move_src) noexcept : safe_VkImageBlit2() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageBlit2& safe_VkImageBlit2::operator=(safe_VkImageBlit2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcSubresource, move_src.srcSubresource);
+    std::swap(srcOffsets, move_src.srcOffsets);
+    std::swap(dstSubresource, move_src.dstSubresource);
+    std::swap(dstOffsets, move_src.dstOffsets);
+
+    return *this;
+}
+
 safe_VkImageBlit2::~safe_VkImageBlit2() { FreePnextChain(pNext); }
 
 void safe_VkImageBlit2::initialize(const VkImageBlit2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -17448,6 +21274,26 @@ safe_VkBlitImageInfo2& safe_VkBlitImageInfo2::operator=(const safe_VkBlitImageIn
     return *this;
 }
 
+safe_VkBlitImageInfo2::safe_VkBlitImageInfo2(safe_VkBlitImageInfo2&& move_src) noexcept : safe_VkBlitImageInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkBlitImageInfo2& safe_VkBlitImageInfo2::operator=(safe_VkBlitImageInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcImage, move_src.srcImage);
+    std::swap(srcImageLayout, move_src.srcImageLayout);
+    std::swap(dstImage, move_src.dstImage);
+    std::swap(dstImageLayout, move_src.dstImageLayout);
+    std::swap(regionCount, move_src.regionCount);
+    std::swap(pRegions, move_src.pRegions);
+    std::swap(filter, move_src.filter);
+
+    return *this;
+}
+
 safe_VkBlitImageInfo2::~safe_VkBlitImageInfo2() {
     if (pRegions) delete[] pRegions;
     FreePnextChain(pNext);
@@ -17539,6 +21385,24 @@ safe_VkImageResolve2& safe_VkImageResolve2::operator=(const safe_VkImageResolve2
     return *this;
 }
 
+safe_VkImageResolve2::safe_VkImageResolve2(safe_VkImageResolve2&& move_src) noexcept : safe_VkImageResolve2() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageResolve2& safe_VkImageResolve2::operator=(safe_VkImageResolve2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcSubresource, move_src.srcSubresource);
+    std::swap(srcOffset, move_src.srcOffset);
+    std::swap(dstSubresource, move_src.dstSubresource);
+    std::swap(dstOffset, move_src.dstOffset);
+    std::swap(extent, move_src.extent);
+
+    return *this;
+}
+
 safe_VkImageResolve2::~safe_VkImageResolve2() { FreePnextChain(pNext); }
 
 void safe_VkImageResolve2::initialize(const VkImageResolve2* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -17633,6 +21497,25 @@ safe_VkResolveImageInfo2& safe_VkResolveImageInfo2::operator=(const safe_VkResol
     return *this;
 }
 
+safe_VkResolveImageInfo2::safe_VkResolveImageInfo2(safe_VkResolveImageInfo2&& move_src) noexcept : safe_VkResolveImageInfo2() {
+    *this = std::move(move_src);
+}
+
+safe_VkResolveImageInfo2& safe_VkResolveImageInfo2::operator=(safe_VkResolveImageInfo2&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcImage, move_src.srcImage);
+    std::swap(srcImageLayout, move_src.srcImageLayout);
+    std::swap(dstImage, move_src.dstImage);
+    std::swap(dstImageLayout, move_src.dstImageLayout);
+    std::swap(regionCount, move_src.regionCount);
+    std::swap(pRegions, move_src.pRegions);
+
+    return *this;
+}
+
 safe_VkResolveImageInfo2::~safe_VkResolveImageInfo2() {
     if (pRegions) delete[] pRegions;
     FreePnextChain(pNext);
@@ -17712,6 +21595,24 @@ safe_VkPhysicalDeviceSubgroupSizeControlFeatures& safe_VkPhysicalDeviceSubgroupS
     return *this;
 }
 
+safe_VkPhysicalDeviceSubgroupSizeControlFeatures::safe_VkPhysicalDeviceSubgroupSizeControlFeatures(
+    safe_VkPhysicalDeviceSubgroupSizeControlFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceSubgroupSizeControlFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSubgroupSizeControlFeatures& safe_VkPhysicalDeviceSubgroupSizeControlFeatures::operator=(
+    safe_VkPhysicalDeviceSubgroupSizeControlFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(subgroupSizeControl, move_src.subgroupSizeControl);
+    std::swap(computeFullSubgroups, move_src.computeFullSubgroups);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSubgroupSizeControlFeatures::~safe_VkPhysicalDeviceSubgroupSizeControlFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceSubgroupSizeControlFeatures::initialize(const VkPhysicalDeviceSubgroupSizeControlFeatures* in_struct,
@@ -17777,6 +21678,26 @@ safe_VkPhysicalDeviceSubgroupSizeControlProperties& safe_VkPhysicalDeviceSubgrou
     return *this;
 }
 
+safe_VkPhysicalDeviceSubgroupSizeControlProperties::safe_VkPhysicalDeviceSubgroupSizeControlProperties(
+    safe_VkPhysicalDeviceSubgroupSizeControlProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceSubgroupSizeControlProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSubgroupSizeControlProperties& safe_VkPhysicalDeviceSubgroupSizeControlProperties::operator=(
+    safe_VkPhysicalDeviceSubgroupSizeControlProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(minSubgroupSize, move_src.minSubgroupSize);
+    std::swap(maxSubgroupSize, move_src.maxSubgroupSize);
+    std::swap(maxComputeWorkgroupSubgroups, move_src.maxComputeWorkgroupSubgroups);
+    std::swap(requiredSubgroupSizeStages, move_src.requiredSubgroupSizeStages);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSubgroupSizeControlProperties::~safe_VkPhysicalDeviceSubgroupSizeControlProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceSubgroupSizeControlProperties::initialize(const VkPhysicalDeviceSubgroupSizeControlProperties* in_struct,
@@ -17832,6 +21753,23 @@ safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& safe_VkPipelineShaderS
     return *this;
 }
 
+safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo::safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo(
+    safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo&& move_src) noexcept
+    : safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo::operator=(
+    safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(requiredSubgroupSize, move_src.requiredSubgroupSize);
+
+    return *this;
+}
+
 safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo::~safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo() {
     FreePnextChain(pNext);
 }
@@ -17889,6 +21827,24 @@ safe_VkPhysicalDeviceInlineUniformBlockFeatures& safe_VkPhysicalDeviceInlineUnif
     return *this;
 }
 
+safe_VkPhysicalDeviceInlineUniformBlockFeatures::safe_VkPhysicalDeviceInlineUniformBlockFeatures(
+    safe_VkPhysicalDeviceInlineUniformBlockFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceInlineUniformBlockFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceInlineUniformBlockFeatures& safe_VkPhysicalDeviceInlineUniformBlockFeatures::operator=(
+    safe_VkPhysicalDeviceInlineUniformBlockFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(inlineUniformBlock, move_src.inlineUniformBlock);
+    std::swap(descriptorBindingInlineUniformBlockUpdateAfterBind, move_src.descriptorBindingInlineUniformBlockUpdateAfterBind);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceInlineUniformBlockFeatures::~safe_VkPhysicalDeviceInlineUniformBlockFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceInlineUniformBlockFeatures::initialize(const VkPhysicalDeviceInlineUniformBlockFeatures* in_struct,
@@ -17958,6 +21914,28 @@ safe_VkPhysicalDeviceInlineUniformBlockProperties& safe_VkPhysicalDeviceInlineUn
     return *this;
 }
 
+safe_VkPhysicalDeviceInlineUniformBlockProperties::safe_VkPhysicalDeviceInlineUniformBlockProperties(
+    safe_VkPhysicalDeviceInlineUniformBlockProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceInlineUniformBlockProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceInlineUniformBlockProperties& safe_VkPhysicalDeviceInlineUniformBlockProperties::operator=(
+    safe_VkPhysicalDeviceInlineUniformBlockProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxInlineUniformBlockSize, move_src.maxInlineUniformBlockSize);
+    std::swap(maxPerStageDescriptorInlineUniformBlocks, move_src.maxPerStageDescriptorInlineUniformBlocks);
+    std::swap(maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks,
+              move_src.maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks);
+    std::swap(maxDescriptorSetInlineUniformBlocks, move_src.maxDescriptorSetInlineUniformBlocks);
+    std::swap(maxDescriptorSetUpdateAfterBindInlineUniformBlocks, move_src.maxDescriptorSetUpdateAfterBindInlineUniformBlocks);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceInlineUniformBlockProperties::~safe_VkPhysicalDeviceInlineUniformBlockProperties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceInlineUniformBlockProperties::initialize(const VkPhysicalDeviceInlineUniformBlockProperties* in_struct,
@@ -18035,6 +22013,24 @@ safe_VkWriteDescriptorSetInlineUniformBlock& safe_VkWriteDescriptorSetInlineUnif
     return *this;
 }
 
+safe_VkWriteDescriptorSetInlineUniformBlock::safe_VkWriteDescriptorSetInlineUniformBlock(
+    safe_VkWriteDescriptorSetInlineUniformBlock&& move_src) noexcept
+    : safe_VkWriteDescriptorSetInlineUniformBlock() {
+    *this = std::move(move_src);
+}
+
+safe_VkWriteDescriptorSetInlineUniformBlock& safe_VkWriteDescriptorSetInlineUniformBlock::operator=(
+    safe_VkWriteDescriptorSetInlineUniformBlock&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(dataSize, move_src.dataSize);
+    std::swap(pData, move_src.pData);
+
+    return *this;
+}
+
 safe_VkWriteDescriptorSetInlineUniformBlock::~safe_VkWriteDescriptorSetInlineUniformBlock() {
     if (pData != nullptr) {
         auto temp = reinterpret_cast<const std::byte*>(pData);
@@ -18105,6 +22101,23 @@ safe_VkDescriptorPoolInlineUniformBlockCreateInfo& safe_VkDescriptorPoolInlineUn
     return *this;
 }
 
+safe_VkDescriptorPoolInlineUniformBlockCreateInfo::safe_VkDescriptorPoolInlineUniformBlockCreateInfo(
+    safe_VkDescriptorPoolInlineUniformBlockCreateInfo&& move_src) noexcept
+    : safe_VkDescriptorPoolInlineUniformBlockCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorPoolInlineUniformBlockCreateInfo& safe_VkDescriptorPoolInlineUniformBlockCreateInfo::operator=(
+    safe_VkDescriptorPoolInlineUniformBlockCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxInlineUniformBlockBindings, move_src.maxInlineUniformBlockBindings);
+
+    return *this;
+}
+
 safe_VkDescriptorPoolInlineUniformBlockCreateInfo::~safe_VkDescriptorPoolInlineUniformBlockCreateInfo() { FreePnextChain(pNext); }
 
 void safe_VkDescriptorPoolInlineUniformBlockCreateInfo::initialize(const VkDescriptorPoolInlineUniformBlockCreateInfo* in_struct,
@@ -18156,6 +22169,23 @@ safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures& safe_VkPhysicalDeviceTex
     return *this;
 }
 
+safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures::safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures(
+    safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures& safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures::operator=(
+    safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(textureCompressionASTC_HDR, move_src.textureCompressionASTC_HDR);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures::~safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures() {
     FreePnextChain(pNext);
 }
@@ -18235,6 +22265,28 @@ safe_VkRenderingAttachmentInfo& safe_VkRenderingAttachmentInfo::operator=(const
     return *this;
 }
 
+safe_VkRenderingAttachmentInfo::safe_VkRenderingAttachmentInfo(safe_VkRenderingAttachmentInfo&& move_src) noexcept
+    : safe_VkRenderingAttachmentInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderingAttachmentInfo& safe_VkRenderingAttachmentInfo::operator=(safe_VkRenderingAttachmentInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageView, move_src.imageView);
+    std::swap(imageLayout, move_src.imageLayout);
+    std::swap(resolveMode, move_src.resolveMode);
+    std::swap(resolveImageView, move_src.resolveImageView);
+    std::swap(resolveImageLayout, move_src.resolveImageLayout);
+    std::swap(loadOp, move_src.loadOp);
+    std::swap(storeOp, move_src.storeOp);
+    std::swap(clearValue, move_src.clearValue);
+
+    return *this;
+}
+
 safe_VkRenderingAttachmentInfo::~safe_VkRenderingAttachmentInfo() { FreePnextChain(pNext); }
 
 void safe_VkRenderingAttachmentInfo::initialize(const VkRenderingAttachmentInfo* in_struct,
@@ -18353,6 +22405,27 @@ safe_VkRenderingInfo& safe_VkRenderingInfo::operator=(const safe_VkRenderingInfo
     return *this;
 }
 
+safe_VkRenderingInfo::safe_VkRenderingInfo(safe_VkRenderingInfo&& move_src) noexcept : safe_VkRenderingInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderingInfo& safe_VkRenderingInfo::operator=(safe_VkRenderingInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(renderArea, move_src.renderArea);
+    std::swap(layerCount, move_src.layerCount);
+    std::swap(viewMask, move_src.viewMask);
+    std::swap(colorAttachmentCount, move_src.colorAttachmentCount);
+    std::swap(pColorAttachments, move_src.pColorAttachments);
+    std::swap(pDepthAttachment, move_src.pDepthAttachment);
+    std::swap(pStencilAttachment, move_src.pStencilAttachment);
+
+    return *this;
+}
+
 safe_VkRenderingInfo::~safe_VkRenderingInfo() {
     if (pColorAttachments) delete[] pColorAttachments;
     if (pDepthAttachment) delete pDepthAttachment;
@@ -18479,6 +22552,26 @@ safe_VkPipelineRenderingCreateInfo& safe_VkPipelineRenderingCreateInfo::operator
     return *this;
 }
 
+safe_VkPipelineRenderingCreateInfo::safe_VkPipelineRenderingCreateInfo(safe_VkPipelineRenderingCreateInfo&& move_src) noexcept
+    : safe_VkPipelineRenderingCreateInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineRenderingCreateInfo& safe_VkPipelineRenderingCreateInfo::operator=(
+    safe_VkPipelineRenderingCreateInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(viewMask, move_src.viewMask);
+    std::swap(colorAttachmentCount, move_src.colorAttachmentCount);
+    std::swap(pColorAttachmentFormats, move_src.pColorAttachmentFormats);
+    std::swap(depthAttachmentFormat, move_src.depthAttachmentFormat);
+    std::swap(stencilAttachmentFormat, move_src.stencilAttachmentFormat);
+
+    return *this;
+}
+
 safe_VkPipelineRenderingCreateInfo::~safe_VkPipelineRenderingCreateInfo() {
     if (pColorAttachmentFormats) delete[] pColorAttachmentFormats;
     FreePnextChain(pNext);
@@ -18558,6 +22651,23 @@ safe_VkPhysicalDeviceDynamicRenderingFeatures& safe_VkPhysicalDeviceDynamicRende
     return *this;
 }
 
+safe_VkPhysicalDeviceDynamicRenderingFeatures::safe_VkPhysicalDeviceDynamicRenderingFeatures(
+    safe_VkPhysicalDeviceDynamicRenderingFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceDynamicRenderingFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDynamicRenderingFeatures& safe_VkPhysicalDeviceDynamicRenderingFeatures::operator=(
+    safe_VkPhysicalDeviceDynamicRenderingFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(dynamicRendering, move_src.dynamicRendering);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDynamicRenderingFeatures::~safe_VkPhysicalDeviceDynamicRenderingFeatures() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDynamicRenderingFeatures::initialize(const VkPhysicalDeviceDynamicRenderingFeatures* in_struct,
@@ -18651,6 +22761,29 @@ safe_VkCommandBufferInheritanceRenderingInfo& safe_VkCommandBufferInheritanceRen
     return *this;
 }
 
+safe_VkCommandBufferInheritanceRenderingInfo::safe_VkCommandBufferInheritanceRenderingInfo(
+    safe_VkCommandBufferInheritanceRenderingInfo&& move_src) noexcept
+    : safe_VkCommandBufferInheritanceRenderingInfo() {
+    *this = std::move(move_src);
+}
+
+safe_VkCommandBufferInheritanceRenderingInfo& safe_VkCommandBufferInheritanceRenderingInfo::operator=(
+    safe_VkCommandBufferInheritanceRenderingInfo&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(viewMask, move_src.viewMask);
+    std::swap(colorAttachmentCount, move_src.colorAttachmentCount);
+    std::swap(pColorAttachmentFormats, move_src.pColorAttachmentFormats);
+    std::swap(depthAttachmentFormat, move_src.depthAttachmentFormat);
+    std::swap(stencilAttachmentFormat, move_src.stencilAttachmentFormat);
+    std::swap(rasterizationSamples, move_src.rasterizationSamples);
+
+    return *this;
+}
+
 safe_VkCommandBufferInheritanceRenderingInfo::~safe_VkCommandBufferInheritanceRenderingInfo() {
     if (pColorAttachmentFormats) delete[] pColorAttachmentFormats;
     FreePnextChain(pNext);
@@ -18727,6 +22860,23 @@ safe_VkPhysicalDeviceShaderIntegerDotProductFeatures& safe_VkPhysicalDeviceShade
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderIntegerDotProductFeatures::safe_VkPhysicalDeviceShaderIntegerDotProductFeatures(
+    safe_VkPhysicalDeviceShaderIntegerDotProductFeatures&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderIntegerDotProductFeatures() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderIntegerDotProductFeatures& safe_VkPhysicalDeviceShaderIntegerDotProductFeatures::operator=(
+    safe_VkPhysicalDeviceShaderIntegerDotProductFeatures&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderIntegerDotProduct, move_src.shaderIntegerDotProduct);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderIntegerDotProductFeatures::~safe_VkPhysicalDeviceShaderIntegerDotProductFeatures() {
     FreePnextChain(pNext);
 }
@@ -18942,6 +23092,68 @@ safe_VkPhysicalDeviceShaderIntegerDotProductProperties& safe_VkPhysicalDeviceSha
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderIntegerDotProductProperties::safe_VkPhysicalDeviceShaderIntegerDotProductProperties(
+    safe_VkPhysicalDeviceShaderIntegerDotProductProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderIntegerDotProductProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderIntegerDotProductProperties& safe_VkPhysicalDeviceShaderIntegerDotProductProperties::operator=(
+    safe_VkPhysicalDeviceShaderIntegerDotProductProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(integerDotProduct8BitUnsignedAccelerated, move_src.integerDotProduct8BitUnsignedAccelerated);
+    std::swap(integerDotProduct8BitSignedAccelerated, move_src.integerDotProduct8BitSignedAccelerated);
+    std::swap(integerDotProduct8BitMixedSignednessAccelerated, move_src.integerDotProduct8BitMixedSignednessAccelerated);
+    std::swap(integerDotProduct4x8BitPackedUnsignedAccelerated, move_src.integerDotProduct4x8BitPackedUnsignedAccelerated);
+    std::swap(integerDotProduct4x8BitPackedSignedAccelerated, move_src.integerDotProduct4x8BitPackedSignedAccelerated);
+    std::swap(integerDotProduct4x8BitPackedMixedSignednessAccelerated,
+              move_src.integerDotProduct4x8BitPackedMixedSignednessAccelerated);
+    std::swap(integerDotProduct16BitUnsignedAccelerated, move_src.integerDotProduct16BitUnsignedAccelerated);
+    std::swap(integerDotProduct16BitSignedAccelerated, move_src.integerDotProduct16BitSignedAccelerated);
+    std::swap(integerDotProduct16BitMixedSignednessAccelerated, move_src.integerDotProduct16BitMixedSignednessAccelerated);
+    std::swap(integerDotProduct32BitUnsignedAccelerated, move_src.integerDotProduct32BitUnsignedAccelerated);
+    std::swap(integerDotProduct32BitSignedAccelerated, move_src.integerDotProduct32BitSignedAccelerated);
+    std::swap(integerDotProduct32BitMixedSignednessAccelerated, move_src.integerDotProduct32BitMixedSignednessAccelerated);
+    std::swap(integerDotProduct64BitUnsignedAccelerated, move_src.integerDotProduct64BitUnsignedAccelerated);
+    std::swap(integerDotProduct64BitSignedAccelerated, move_src.integerDotProduct64BitSignedAccelerated);
+    std::swap(integerDotProduct64BitMixedSignednessAccelerated, move_src.integerDotProduct64BitMixedSignednessAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating8BitUnsignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating8BitUnsignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating8BitSignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating8BitSignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated,
+              move_src.integerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated,
+              move_src.integerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating16BitUnsignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating16BitUnsignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating16BitSignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating16BitSignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated,
+              move_src.integerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating32BitUnsignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating32BitUnsignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating32BitSignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating32BitSignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated,
+              move_src.integerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating64BitUnsignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating64BitUnsignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating64BitSignedAccelerated,
+              move_src.integerDotProductAccumulatingSaturating64BitSignedAccelerated);
+    std::swap(integerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated,
+              move_src.integerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderIntegerDotProductProperties::~safe_VkPhysicalDeviceShaderIntegerDotProductProperties() {
     FreePnextChain(pNext);
 }
@@ -19095,6 +23307,26 @@ safe_VkPhysicalDeviceTexelBufferAlignmentProperties& safe_VkPhysicalDeviceTexelB
     return *this;
 }
 
+safe_VkPhysicalDeviceTexelBufferAlignmentProperties::safe_VkPhysicalDeviceTexelBufferAlignmentProperties(
+    safe_VkPhysicalDeviceTexelBufferAlignmentProperties&& move_src) noexcept
+    : safe_VkPhysicalDeviceTexelBufferAlignmentProperties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceTexelBufferAlignmentProperties& safe_VkPhysicalDeviceTexelBufferAlignmentProperties::operator=(
+    safe_VkPhysicalDeviceTexelBufferAlignmentProperties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(storageTexelBufferOffsetAlignmentBytes, move_src.storageTexelBufferOffsetAlignmentBytes);
+    std::swap(storageTexelBufferOffsetSingleTexelAlignment, move_src.storageTexelBufferOffsetSingleTexelAlignment);
+    std::swap(uniformTexelBufferOffsetAlignmentBytes, move_src.uniformTexelBufferOffsetAlignmentBytes);
+    std::swap(uniformTexelBufferOffsetSingleTexelAlignment, move_src.uniformTexelBufferOffsetSingleTexelAlignment);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTexelBufferAlignmentProperties::~safe_VkPhysicalDeviceTexelBufferAlignmentProperties() {
     FreePnextChain(pNext);
 }
@@ -19160,6 +23392,22 @@ safe_VkFormatProperties3& safe_VkFormatProperties3::operator=(const safe_VkForma
     return *this;
 }
 
+safe_VkFormatProperties3::safe_VkFormatProperties3(safe_VkFormatProperties3&& move_src) noexcept : safe_VkFormatProperties3() {
+    *this = std::move(move_src);
+}
+
+safe_VkFormatProperties3& safe_VkFormatProperties3::operator=(safe_VkFormatProperties3&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(linearTilingFeatures, move_src.linearTilingFeatures);
+    std::swap(optimalTilingFeatures, move_src.optimalTilingFeatures);
+    std::swap(bufferFeatures, move_src.bufferFeatures);
+
+    return *this;
+}
+
 safe_VkFormatProperties3::~safe_VkFormatProperties3() { FreePnextChain(pNext); }
 
 void safe_VkFormatProperties3::initialize(const VkFormatProperties3* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -19210,6 +23458,23 @@ safe_VkPhysicalDeviceMaintenance4Features& safe_VkPhysicalDeviceMaintenance4Feat
     return *this;
 }
 
+safe_VkPhysicalDeviceMaintenance4Features::safe_VkPhysicalDeviceMaintenance4Features(
+    safe_VkPhysicalDeviceMaintenance4Features&& move_src) noexcept
+    : safe_VkPhysicalDeviceMaintenance4Features() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMaintenance4Features& safe_VkPhysicalDeviceMaintenance4Features::operator=(
+    safe_VkPhysicalDeviceMaintenance4Features&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maintenance4, move_src.maintenance4);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMaintenance4Features::~safe_VkPhysicalDeviceMaintenance4Features() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMaintenance4Features::initialize(const VkPhysicalDeviceMaintenance4Features* in_struct,
@@ -19258,6 +23523,23 @@ safe_VkPhysicalDeviceMaintenance4Properties& safe_VkPhysicalDeviceMaintenance4Pr
     return *this;
 }
 
+safe_VkPhysicalDeviceMaintenance4Properties::safe_VkPhysicalDeviceMaintenance4Properties(
+    safe_VkPhysicalDeviceMaintenance4Properties&& move_src) noexcept
+    : safe_VkPhysicalDeviceMaintenance4Properties() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMaintenance4Properties& safe_VkPhysicalDeviceMaintenance4Properties::operator=(
+    safe_VkPhysicalDeviceMaintenance4Properties&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxBufferSize, move_src.maxBufferSize);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMaintenance4Properties::~safe_VkPhysicalDeviceMaintenance4Properties() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMaintenance4Properties::initialize(const VkPhysicalDeviceMaintenance4Properties* in_struct,
@@ -19311,6 +23593,23 @@ safe_VkDeviceBufferMemoryRequirements& safe_VkDeviceBufferMemoryRequirements::op
     return *this;
 }
 
+safe_VkDeviceBufferMemoryRequirements::safe_VkDeviceBufferMemoryRequirements(
+    safe_VkDeviceBufferMemoryRequirements&& move_src) noexcept
+    : safe_VkDeviceBufferMemoryRequirements() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceBufferMemoryRequirements& safe_VkDeviceBufferMemoryRequirements::operator=(
+    safe_VkDeviceBufferMemoryRequirements&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pCreateInfo, move_src.pCreateInfo);
+
+    return *this;
+}
+
 safe_VkDeviceBufferMemoryRequirements::~safe_VkDeviceBufferMemoryRequirements() {
     if (pCreateInfo) delete pCreateInfo;
     FreePnextChain(pNext);
@@ -19371,6 +23670,23 @@ safe_VkDeviceImageMemoryRequirements& safe_VkDeviceImageMemoryRequirements::oper
     return *this;
 }
 
+safe_VkDeviceImageMemoryRequirements::safe_VkDeviceImageMemoryRequirements(safe_VkDeviceImageMemoryRequirements&& move_src) noexcept
+    : safe_VkDeviceImageMemoryRequirements() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceImageMemoryRequirements& safe_VkDeviceImageMemoryRequirements::operator=(
+    safe_VkDeviceImageMemoryRequirements&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pCreateInfo, move_src.pCreateInfo);
+    std::swap(planeAspect, move_src.planeAspect);
+
+    return *this;
+}
+
 safe_VkDeviceImageMemoryRequirements::~safe_VkDeviceImageMemoryRequirements() {
     if (pCreateInfo) delete pCreateInfo;
     FreePnextChain(pNext);
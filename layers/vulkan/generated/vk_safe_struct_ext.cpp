@@ -67,6 +67,24 @@ safe_VkRenderingFragmentDensityMapAttachmentInfoEXT& safe_VkRenderingFragmentDen
     return *this;
 }
 
+safe_VkRenderingFragmentDensityMapAttachmentInfoEXT::safe_VkRenderingFragmentDensityMapAttachmentInfoEXT(
+    safe_VkRenderingFragmentDensityMapAttachmentInfoEXT&& move_src) noexcept
+    : safe_VkRenderingFragmentDensityMapAttachmentInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderingFragmentDensityMapAttachmentInfoEXT& safe_VkRenderingFragmentDensityMapAttachmentInfoEXT::operator=(
+    safe_VkRenderingFragmentDensityMapAttachmentInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageView, move_src.imageView);
+    std::swap(imageLayout, move_src.imageLayout);
+
+    return *this;
+}
+
 safe_VkRenderingFragmentDensityMapAttachmentInfoEXT::~safe_VkRenderingFragmentDensityMapAttachmentInfoEXT() {
     FreePnextChain(pNext);
 }
@@ -173,6 +191,28 @@ safe_VkSetDescriptorBufferOffsetsInfoEXT& safe_VkSetDescriptorBufferOffsetsInfoE
     return *this;
 }
 
+safe_VkSetDescriptorBufferOffsetsInfoEXT::safe_VkSetDescriptorBufferOffsetsInfoEXT(
+    safe_VkSetDescriptorBufferOffsetsInfoEXT&& move_src) noexcept
+    : safe_VkSetDescriptorBufferOffsetsInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSetDescriptorBufferOffsetsInfoEXT& safe_VkSetDescriptorBufferOffsetsInfoEXT::operator=(
+    safe_VkSetDescriptorBufferOffsetsInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stageFlags, move_src.stageFlags);
+    std::swap(layout, move_src.layout);
+    std::swap(firstSet, move_src.firstSet);
+    std::swap(setCount, move_src.setCount);
+    std::swap(pBufferIndices, move_src.pBufferIndices);
+    std::swap(pOffsets, move_src.pOffsets);
+
+    return *this;
+}
+
 safe_VkSetDescriptorBufferOffsetsInfoEXT::~safe_VkSetDescriptorBufferOffsetsInfoEXT() {
     if (pBufferIndices) delete[] pBufferIndices;
     if (pOffsets) delete[] pOffsets;
@@ -261,6 +301,25 @@ safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT& safe_VkBindDescriptorBufferE
     return *this;
 }
 
+safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT::safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT(
+    safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT&& move_src) noexcept
+    : safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT& safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT::operator=(
+    safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stageFlags, move_src.stageFlags);
+    std::swap(layout, move_src.layout);
+    std::swap(set, move_src.set);
+
+    return *this;
+}
+
 safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT::~safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkBindDescriptorBufferEmbeddedSamplersInfoEXT::initialize(const VkBindDescriptorBufferEmbeddedSamplersInfoEXT* in_struct,
@@ -317,6 +376,25 @@ safe_VkDebugReportCallbackCreateInfoEXT& safe_VkDebugReportCallbackCreateInfoEXT
     return *this;
 }
 
+safe_VkDebugReportCallbackCreateInfoEXT::safe_VkDebugReportCallbackCreateInfoEXT(
+    safe_VkDebugReportCallbackCreateInfoEXT&& move_src) noexcept
+    : safe_VkDebugReportCallbackCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDebugReportCallbackCreateInfoEXT& safe_VkDebugReportCallbackCreateInfoEXT::operator=(
+    safe_VkDebugReportCallbackCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(pfnCallback, move_src.pfnCallback);
+    std::swap(pUserData, move_src.pUserData);
+
+    return *this;
+}
+
 safe_VkDebugReportCallbackCreateInfoEXT::~safe_VkDebugReportCallbackCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDebugReportCallbackCreateInfoEXT::initialize(const VkDebugReportCallbackCreateInfoEXT* in_struct,
@@ -375,6 +453,24 @@ safe_VkDebugMarkerObjectNameInfoEXT& safe_VkDebugMarkerObjectNameInfoEXT::operat
     return *this;
 }
 
+safe_VkDebugMarkerObjectNameInfoEXT::safe_VkDebugMarkerObjectNameInfoEXT(safe_VkDebugMarkerObjectNameInfoEXT&& move_src) noexcept
+    : safe_VkDebugMarkerObjectNameInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDebugMarkerObjectNameInfoEXT& safe_VkDebugMarkerObjectNameInfoEXT::operator=(
+    safe_VkDebugMarkerObjectNameInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(objectType, move_src.objectType);
+    std::swap(object, move_src.object);
+    std::swap(pObjectName, move_src.pObjectName);
+
+    return *this;
+}
+
 safe_VkDebugMarkerObjectNameInfoEXT::~safe_VkDebugMarkerObjectNameInfoEXT() {
     if (pObjectName) delete[] pObjectName;
     FreePnextChain(pNext);
@@ -449,6 +545,26 @@ safe_VkDebugMarkerObjectTagInfoEXT& safe_VkDebugMarkerObjectTagInfoEXT::operator
     return *this;
 }
 
+safe_VkDebugMarkerObjectTagInfoEXT::safe_VkDebugMarkerObjectTagInfoEXT(safe_VkDebugMarkerObjectTagInfoEXT&& move_src) noexcept
+    : safe_VkDebugMarkerObjectTagInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDebugMarkerObjectTagInfoEXT& safe_VkDebugMarkerObjectTagInfoEXT::operator=(
+    safe_VkDebugMarkerObjectTagInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(objectType, move_src.objectType);
+    std::swap(object, move_src.object);
+    std::swap(tagName, move_src.tagName);
+    std::swap(tagSize, move_src.tagSize);
+    std::swap(pTag, move_src.pTag);
+
+    return *this;
+}
+
 safe_VkDebugMarkerObjectTagInfoEXT::~safe_VkDebugMarkerObjectTagInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDebugMarkerObjectTagInfoEXT::initialize(const VkDebugMarkerObjectTagInfoEXT* in_struct,
@@ -517,6 +633,22 @@ safe_VkDebugMarkerMarkerInfoEXT& safe_VkDebugMarkerMarkerInfoEXT::operator=(cons
     return *this;
 }
 
+safe_VkDebugMarkerMarkerInfoEXT::safe_VkDebugMarkerMarkerInfoEXT(safe_VkDebugMarkerMarkerInfoEXT&& move_src) noexcept
+    : safe_VkDebugMarkerMarkerInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDebugMarkerMarkerInfoEXT& safe_VkDebugMarkerMarkerInfoEXT::operator=(safe_VkDebugMarkerMarkerInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pMarkerName, move_src.pMarkerName);
+    std::swap(color, move_src.color);
+
+    return *this;
+}
+
 safe_VkDebugMarkerMarkerInfoEXT::~safe_VkDebugMarkerMarkerInfoEXT() {
     if (pMarkerName) delete[] pMarkerName;
     FreePnextChain(pNext);
@@ -582,6 +714,24 @@ safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& safe_VkPhysicalDeviceTransfor
     return *this;
 }
 
+safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT::safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT(
+    safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(transformFeedback, move_src.transformFeedback);
+    std::swap(geometryStreams, move_src.geometryStreams);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT::~safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT::initialize(const VkPhysicalDeviceTransformFeedbackFeaturesEXT* in_struct,
@@ -671,6 +821,32 @@ safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& safe_VkPhysicalDeviceTransf
     return *this;
 }
 
+safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT::safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT(
+    safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxTransformFeedbackStreams, move_src.maxTransformFeedbackStreams);
+    std::swap(maxTransformFeedbackBuffers, move_src.maxTransformFeedbackBuffers);
+    std::swap(maxTransformFeedbackBufferSize, move_src.maxTransformFeedbackBufferSize);
+    std::swap(maxTransformFeedbackStreamDataSize, move_src.maxTransformFeedbackStreamDataSize);
+    std::swap(maxTransformFeedbackBufferDataSize, move_src.maxTransformFeedbackBufferDataSize);
+    std::swap(maxTransformFeedbackBufferDataStride, move_src.maxTransformFeedbackBufferDataStride);
+    std::swap(transformFeedbackQueries, move_src.transformFeedbackQueries);
+    std::swap(transformFeedbackStreamsLinesTriangles, move_src.transformFeedbackStreamsLinesTriangles);
+    std::swap(transformFeedbackRasterizationStreamSelect, move_src.transformFeedbackRasterizationStreamSelect);
+    std::swap(transformFeedbackDraw, move_src.transformFeedbackDraw);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT::~safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -744,6 +920,24 @@ safe_VkPipelineRasterizationStateStreamCreateInfoEXT& safe_VkPipelineRasterizati
     return *this;
 }
 
+safe_VkPipelineRasterizationStateStreamCreateInfoEXT::safe_VkPipelineRasterizationStateStreamCreateInfoEXT(
+    safe_VkPipelineRasterizationStateStreamCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineRasterizationStateStreamCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineRasterizationStateStreamCreateInfoEXT& safe_VkPipelineRasterizationStateStreamCreateInfoEXT::operator=(
+    safe_VkPipelineRasterizationStateStreamCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(rasterizationStream, move_src.rasterizationStream);
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationStateStreamCreateInfoEXT::~safe_VkPipelineRasterizationStateStreamCreateInfoEXT() {
     FreePnextChain(pNext);
 }
@@ -819,6 +1013,21 @@ safe_VkValidationFlagsEXT& safe_VkValidationFlagsEXT::operator=(const safe_VkVal
     return *this;
 }
 
+safe_VkValidationFlagsEXT::safe_VkValidationFlagsEXT(safe_VkValidationFlagsEXT&& move_src) noexcept : safe_VkValidationFlagsEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkValidationFlagsEXT& safe_VkValidationFlagsEXT::operator=(safe_VkValidationFlagsEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(disabledValidationCheckCount, move_src.disabledValidationCheckCount);
+    std::swap(pDisabledValidationChecks, move_src.pDisabledValidationChecks);
+
+    return *this;
+}
+
 safe_VkValidationFlagsEXT::~safe_VkValidationFlagsEXT() {
     if (pDisabledValidationChecks) delete[] pDisabledValidationChecks;
     FreePnextChain(pNext);
@@ -881,6 +1090,22 @@ safe_VkImageViewASTCDecodeModeEXT& safe_VkImageViewASTCDecodeModeEXT::operator=(
     return *this;
 }
 
+safe_VkImageViewASTCDecodeModeEXT::safe_VkImageViewASTCDecodeModeEXT(safe_VkImageViewASTCDecodeModeEXT&& move_src) noexcept
+    : safe_VkImageViewASTCDecodeModeEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageViewASTCDecodeModeEXT& safe_VkImageViewASTCDecodeModeEXT::operator=(
+    safe_VkImageViewASTCDecodeModeEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(decodeMode, move_src.decodeMode);
+
+    return *this;
+}
+
 safe_VkImageViewASTCDecodeModeEXT::~safe_VkImageViewASTCDecodeModeEXT() { FreePnextChain(pNext); }
 
 void safe_VkImageViewASTCDecodeModeEXT::initialize(const VkImageViewASTCDecodeModeEXT* in_struct,
@@ -929,6 +1154,23 @@ safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& safe_VkPhysicalDeviceASTCDecodeFeatu
     return *this;
 }
 
+safe_VkPhysicalDeviceASTCDecodeFeaturesEXT::safe_VkPhysicalDeviceASTCDecodeFeaturesEXT(
+    safe_VkPhysicalDeviceASTCDecodeFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceASTCDecodeFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& safe_VkPhysicalDeviceASTCDecodeFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceASTCDecodeFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(decodeModeSharedExponent, move_src.decodeModeSharedExponent);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceASTCDecodeFeaturesEXT::~safe_VkPhysicalDeviceASTCDecodeFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceASTCDecodeFeaturesEXT::initialize(const VkPhysicalDeviceASTCDecodeFeaturesEXT* in_struct,
@@ -977,6 +1219,23 @@ safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT& safe_VkPhysicalDevicePipelin
     return *this;
 }
 
+safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT::safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT(
+    safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT& safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT::operator=(
+    safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipelineRobustness, move_src.pipelineRobustness);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT::~safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT::initialize(const VkPhysicalDevicePipelineRobustnessFeaturesEXT* in_struct,
@@ -1040,6 +1299,26 @@ safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT& safe_VkPhysicalDevicePipel
     return *this;
 }
 
+safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT::safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT(
+    safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT& safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT::operator=(
+    safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(defaultRobustnessStorageBuffers, move_src.defaultRobustnessStorageBuffers);
+    std::swap(defaultRobustnessUniformBuffers, move_src.defaultRobustnessUniformBuffers);
+    std::swap(defaultRobustnessVertexInputs, move_src.defaultRobustnessVertexInputs);
+    std::swap(defaultRobustnessImages, move_src.defaultRobustnessImages);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT::~safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -1112,6 +1391,26 @@ safe_VkPipelineRobustnessCreateInfoEXT& safe_VkPipelineRobustnessCreateInfoEXT::
     return *this;
 }
 
+safe_VkPipelineRobustnessCreateInfoEXT::safe_VkPipelineRobustnessCreateInfoEXT(
+    safe_VkPipelineRobustnessCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineRobustnessCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineRobustnessCreateInfoEXT& safe_VkPipelineRobustnessCreateInfoEXT::operator=(
+    safe_VkPipelineRobustnessCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(storageBuffers, move_src.storageBuffers);
+    std::swap(uniformBuffers, move_src.uniformBuffers);
+    std::swap(vertexInputs, move_src.vertexInputs);
+    std::swap(images, move_src.images);
+
+    return *this;
+}
+
 safe_VkPipelineRobustnessCreateInfoEXT::~safe_VkPipelineRobustnessCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkPipelineRobustnessCreateInfoEXT::initialize(const VkPipelineRobustnessCreateInfoEXT* in_struct,
@@ -1170,6 +1469,25 @@ safe_VkConditionalRenderingBeginInfoEXT& safe_VkConditionalRenderingBeginInfoEXT
     return *this;
 }
 
+safe_VkConditionalRenderingBeginInfoEXT::safe_VkConditionalRenderingBeginInfoEXT(
+    safe_VkConditionalRenderingBeginInfoEXT&& move_src) noexcept
+    : safe_VkConditionalRenderingBeginInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkConditionalRenderingBeginInfoEXT& safe_VkConditionalRenderingBeginInfoEXT::operator=(
+    safe_VkConditionalRenderingBeginInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(buffer, move_src.buffer);
+    std::swap(offset, move_src.offset);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkConditionalRenderingBeginInfoEXT::~safe_VkConditionalRenderingBeginInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkConditionalRenderingBeginInfoEXT::initialize(const VkConditionalRenderingBeginInfoEXT* in_struct,
@@ -1229,6 +1547,24 @@ safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& safe_VkPhysicalDeviceCondi
     return *this;
 }
 
+safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT::safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT(
+    safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(conditionalRendering, move_src.conditionalRendering);
+    std::swap(inheritedConditionalRendering, move_src.inheritedConditionalRendering);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT::~safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -1284,6 +1620,23 @@ safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& safe_VkCommandBuffer
     return *this;
 }
 
+safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT::safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT(
+    safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT&& move_src) noexcept
+    : safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT::operator=(
+    safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(conditionalRenderingEnable, move_src.conditionalRenderingEnable);
+
+    return *this;
+}
+
 safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT::~safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT() {
     FreePnextChain(pNext);
 }
@@ -1375,6 +1728,31 @@ safe_VkSurfaceCapabilities2EXT& safe_VkSurfaceCapabilities2EXT::operator=(const
     return *this;
 }
 
+safe_VkSurfaceCapabilities2EXT::safe_VkSurfaceCapabilities2EXT(safe_VkSurfaceCapabilities2EXT&& move_src) noexcept
+    : safe_VkSurfaceCapabilities2EXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSurfaceCapabilities2EXT& safe_VkSurfaceCapabilities2EXT::operator=(safe_VkSurfaceCapabilities2EXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(minImageCount, move_src.minImageCount);
+    std::swap(maxImageCount, move_src.maxImageCount);
+    std::swap(currentExtent, move_src.currentExtent);
+    std::swap(minImageExtent, move_src.minImageExtent);
+    std::swap(maxImageExtent, move_src.maxImageExtent);
+    std::swap(maxImageArrayLayers, move_src.maxImageArrayLayers);
+    std::swap(supportedTransforms, move_src.supportedTransforms);
+    std::swap(currentTransform, move_src.currentTransform);
+    std::swap(supportedCompositeAlpha, move_src.supportedCompositeAlpha);
+    std::swap(supportedUsageFlags, move_src.supportedUsageFlags);
+    std::swap(supportedSurfaceCounters, move_src.supportedSurfaceCounters);
+
+    return *this;
+}
+
 safe_VkSurfaceCapabilities2EXT::~safe_VkSurfaceCapabilities2EXT() { FreePnextChain(pNext); }
 
 void safe_VkSurfaceCapabilities2EXT::initialize(const VkSurfaceCapabilities2EXT* in_struct,
@@ -1441,6 +1819,21 @@ safe_VkDisplayPowerInfoEXT& safe_VkDisplayPowerInfoEXT::operator=(const safe_VkD
     return *this;
 }
 
+safe_VkDisplayPowerInfoEXT::safe_VkDisplayPowerInfoEXT(safe_VkDisplayPowerInfoEXT&& move_src) noexcept
+    : safe_VkDisplayPowerInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplayPowerInfoEXT& safe_VkDisplayPowerInfoEXT::operator=(safe_VkDisplayPowerInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(powerState, move_src.powerState);
+
+    return *this;
+}
+
 safe_VkDisplayPowerInfoEXT::~safe_VkDisplayPowerInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDisplayPowerInfoEXT::initialize(const VkDisplayPowerInfoEXT* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -1486,6 +1879,20 @@ safe_VkDeviceEventInfoEXT& safe_VkDeviceEventInfoEXT::operator=(const safe_VkDev
     return *this;
 }
 
+safe_VkDeviceEventInfoEXT::safe_VkDeviceEventInfoEXT(safe_VkDeviceEventInfoEXT&& move_src) noexcept : safe_VkDeviceEventInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceEventInfoEXT& safe_VkDeviceEventInfoEXT::operator=(safe_VkDeviceEventInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceEvent, move_src.deviceEvent);
+
+    return *this;
+}
+
 safe_VkDeviceEventInfoEXT::~safe_VkDeviceEventInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDeviceEventInfoEXT::initialize(const VkDeviceEventInfoEXT* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -1530,6 +1937,21 @@ safe_VkDisplayEventInfoEXT& safe_VkDisplayEventInfoEXT::operator=(const safe_VkD
     return *this;
 }
 
+safe_VkDisplayEventInfoEXT::safe_VkDisplayEventInfoEXT(safe_VkDisplayEventInfoEXT&& move_src) noexcept
+    : safe_VkDisplayEventInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplayEventInfoEXT& safe_VkDisplayEventInfoEXT::operator=(safe_VkDisplayEventInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(displayEvent, move_src.displayEvent);
+
+    return *this;
+}
+
 safe_VkDisplayEventInfoEXT::~safe_VkDisplayEventInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDisplayEventInfoEXT::initialize(const VkDisplayEventInfoEXT* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -1577,6 +1999,22 @@ safe_VkSwapchainCounterCreateInfoEXT& safe_VkSwapchainCounterCreateInfoEXT::oper
     return *this;
 }
 
+safe_VkSwapchainCounterCreateInfoEXT::safe_VkSwapchainCounterCreateInfoEXT(safe_VkSwapchainCounterCreateInfoEXT&& move_src) noexcept
+    : safe_VkSwapchainCounterCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSwapchainCounterCreateInfoEXT& safe_VkSwapchainCounterCreateInfoEXT::operator=(
+    safe_VkSwapchainCounterCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(surfaceCounters, move_src.surfaceCounters);
+
+    return *this;
+}
+
 safe_VkSwapchainCounterCreateInfoEXT::~safe_VkSwapchainCounterCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkSwapchainCounterCreateInfoEXT::initialize(const VkSwapchainCounterCreateInfoEXT* in_struct,
@@ -1625,6 +2063,23 @@ safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& safe_VkPhysicalDeviceDiscard
     return *this;
 }
 
+safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT::safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT(
+    safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT::operator=(
+    safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxDiscardRectangles, move_src.maxDiscardRectangles);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT::~safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT::initialize(const VkPhysicalDeviceDiscardRectanglePropertiesEXT* in_struct,
@@ -1704,6 +2159,26 @@ safe_VkPipelineDiscardRectangleStateCreateInfoEXT& safe_VkPipelineDiscardRectang
     return *this;
 }
 
+safe_VkPipelineDiscardRectangleStateCreateInfoEXT::safe_VkPipelineDiscardRectangleStateCreateInfoEXT(
+    safe_VkPipelineDiscardRectangleStateCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineDiscardRectangleStateCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineDiscardRectangleStateCreateInfoEXT& safe_VkPipelineDiscardRectangleStateCreateInfoEXT::operator=(
+    safe_VkPipelineDiscardRectangleStateCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(discardRectangleMode, move_src.discardRectangleMode);
+    std::swap(discardRectangleCount, move_src.discardRectangleCount);
+    std::swap(pDiscardRectangles, move_src.pDiscardRectangles);
+
+    return *this;
+}
+
 safe_VkPipelineDiscardRectangleStateCreateInfoEXT::~safe_VkPipelineDiscardRectangleStateCreateInfoEXT() {
     if (pDiscardRectangles) delete[] pDiscardRectangles;
     FreePnextChain(pNext);
@@ -1809,6 +2284,31 @@ safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& safe_VkPhysicalDevi
     return *this;
 }
 
+safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT::safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(
+    safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(primitiveOverestimationSize, move_src.primitiveOverestimationSize);
+    std::swap(maxExtraPrimitiveOverestimationSize, move_src.maxExtraPrimitiveOverestimationSize);
+    std::swap(extraPrimitiveOverestimationSizeGranularity, move_src.extraPrimitiveOverestimationSizeGranularity);
+    std::swap(primitiveUnderestimation, move_src.primitiveUnderestimation);
+    std::swap(conservativePointAndLineRasterization, move_src.conservativePointAndLineRasterization);
+    std::swap(degenerateTrianglesRasterized, move_src.degenerateTrianglesRasterized);
+    std::swap(degenerateLinesRasterized, move_src.degenerateLinesRasterized);
+    std::swap(fullyCoveredFragmentShaderInputVariable, move_src.fullyCoveredFragmentShaderInputVariable);
+    std::swap(conservativeRasterizationPostDepthCoverage, move_src.conservativeRasterizationPostDepthCoverage);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT::~safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -1887,6 +2387,25 @@ safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& safe_VkPipelineRaste
     return *this;
 }
 
+safe_VkPipelineRasterizationConservativeStateCreateInfoEXT::safe_VkPipelineRasterizationConservativeStateCreateInfoEXT(
+    safe_VkPipelineRasterizationConservativeStateCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineRasterizationConservativeStateCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& safe_VkPipelineRasterizationConservativeStateCreateInfoEXT::operator=(
+    safe_VkPipelineRasterizationConservativeStateCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(conservativeRasterizationMode, move_src.conservativeRasterizationMode);
+    std::swap(extraPrimitiveOverestimationSize, move_src.extraPrimitiveOverestimationSize);
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationConservativeStateCreateInfoEXT::~safe_VkPipelineRasterizationConservativeStateCreateInfoEXT() {
     FreePnextChain(pNext);
 }
@@ -1941,6 +2460,23 @@ safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& safe_VkPhysicalDeviceDepthClipE
     return *this;
 }
 
+safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT::safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT(
+    safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(depthClipEnable, move_src.depthClipEnable);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT::~safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT::initialize(const VkPhysicalDeviceDepthClipEnableFeaturesEXT* in_struct,
@@ -1995,6 +2531,24 @@ safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& safe_VkPipelineRasteriz
     return *this;
 }
 
+safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT::safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT(
+    safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT::operator=(
+    safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(depthClipEnable, move_src.depthClipEnable);
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT::~safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT() {
     FreePnextChain(pNext);
 }
@@ -2076,12 +2630,33 @@ safe_VkHdrMetadataEXT& safe_VkHdrMetadataEXT::operator=(const safe_VkHdrMetadata
     return *this;
 }
 
-safe_VkHdrMetadataEXT::~safe_VkHdrMetadataEXT() { FreePnextChain(pNext); }
+safe_VkHdrMetadataEXT::safe_VkHdrMetadataEXT(safe_VkHdrMetadataEXT&& move_src) noexcept : safe_VkHdrMetadataEXT() {
+    *this = std::move(move_src);
+}
 
-void safe_VkHdrMetadataEXT::initialize(const VkHdrMetadataEXT* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
-    FreePnextChain(pNext);
-    sType = in_struct->sType;
-    displayPrimaryRed = in_struct->displayPrimaryRed;
+safe_VkHdrMetadataEXT& safe_VkHdrMetadataEXT::operator=(safe_VkHdrMetadataEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(displayPrimaryRed, move_src.displayPrimaryRed);
+    std::swap(displayPrimaryGreen, move_src.displayPrimaryGreen);
+    std::swap(displayPrimaryBlue, move_src.displayPrimaryBlue);
+    std::swap(whitePoint, move_src.whitePoint);
+    std::swap(maxLuminance, move_src.maxLuminance);
+    std::swap(minLuminance, move_src.minLuminance);
+    std::swap(maxContentLightLevel, move_src.maxContentLightLevel);
+    std::swap(maxFrameAverageLightLevel, move_src.maxFrameAverageLightLevel);
+
+    return *this;
+}
+
+safe_VkHdrMetadataEXT::~safe_VkHdrMetadataEXT() { FreePnextChain(pNext); }
+
+void safe_VkHdrMetadataEXT::initialize(const VkHdrMetadataEXT* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
+    FreePnextChain(pNext);
+    sType = in_struct->sType;
+    displayPrimaryRed = in_struct->displayPrimaryRed;
     displayPrimaryGreen = in_struct->displayPrimaryGreen;
     displayPrimaryBlue = in_struct->displayPrimaryBlue;
     whitePoint = in_struct->whitePoint;
@@ -2148,6 +2723,21 @@ safe_VkDebugUtilsLabelEXT& safe_VkDebugUtilsLabelEXT::operator=(const safe_VkDeb
     return *this;
 }
 
+safe_VkDebugUtilsLabelEXT::safe_VkDebugUtilsLabelEXT(safe_VkDebugUtilsLabelEXT&& move_src) noexcept : safe_VkDebugUtilsLabelEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDebugUtilsLabelEXT& safe_VkDebugUtilsLabelEXT::operator=(safe_VkDebugUtilsLabelEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pLabelName, move_src.pLabelName);
+    std::swap(color, move_src.color);
+
+    return *this;
+}
+
 safe_VkDebugUtilsLabelEXT::~safe_VkDebugUtilsLabelEXT() {
     if (pLabelName) delete[] pLabelName;
     FreePnextChain(pNext);
@@ -2215,6 +2805,24 @@ safe_VkDebugUtilsObjectNameInfoEXT& safe_VkDebugUtilsObjectNameInfoEXT::operator
     return *this;
 }
 
+safe_VkDebugUtilsObjectNameInfoEXT::safe_VkDebugUtilsObjectNameInfoEXT(safe_VkDebugUtilsObjectNameInfoEXT&& move_src) noexcept
+    : safe_VkDebugUtilsObjectNameInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDebugUtilsObjectNameInfoEXT& safe_VkDebugUtilsObjectNameInfoEXT::operator=(
+    safe_VkDebugUtilsObjectNameInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(objectType, move_src.objectType);
+    std::swap(objectHandle, move_src.objectHandle);
+    std::swap(pObjectName, move_src.pObjectName);
+
+    return *this;
+}
+
 safe_VkDebugUtilsObjectNameInfoEXT::~safe_VkDebugUtilsObjectNameInfoEXT() {
     if (pObjectName) delete[] pObjectName;
     FreePnextChain(pNext);
@@ -2369,6 +2977,32 @@ safe_VkDebugUtilsMessengerCallbackDataEXT& safe_VkDebugUtilsMessengerCallbackDat
     return *this;
 }
 
+safe_VkDebugUtilsMessengerCallbackDataEXT::safe_VkDebugUtilsMessengerCallbackDataEXT(
+    safe_VkDebugUtilsMessengerCallbackDataEXT&& move_src) noexcept
+    : safe_VkDebugUtilsMessengerCallbackDataEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDebugUtilsMessengerCallbackDataEXT& safe_VkDebugUtilsMessengerCallbackDataEXT::operator=(
+    safe_VkDebugUtilsMessengerCallbackDataEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(pMessageIdName, move_src.pMessageIdName);
+    std::swap(messageIdNumber, move_src.messageIdNumber);
+    std::swap(pMessage, move_src.pMessage);
+    std::swap(queueLabelCount, move_src.queueLabelCount);
+    std::swap(pQueueLabels, move_src.pQueueLabels);
+    std::swap(cmdBufLabelCount, move_src.cmdBufLabelCount);
+    std::swap(pCmdBufLabels, move_src.pCmdBufLabels);
+    std::swap(objectCount, move_src.objectCount);
+    std::swap(pObjects, move_src.pObjects);
+
+    return *this;
+}
+
 safe_VkDebugUtilsMessengerCallbackDataEXT::~safe_VkDebugUtilsMessengerCallbackDataEXT() {
     if (pMessageIdName) delete[] pMessageIdName;
     if (pMessage) delete[] pMessage;
@@ -2502,6 +3136,27 @@ safe_VkDebugUtilsMessengerCreateInfoEXT& safe_VkDebugUtilsMessengerCreateInfoEXT
     return *this;
 }
 
+safe_VkDebugUtilsMessengerCreateInfoEXT::safe_VkDebugUtilsMessengerCreateInfoEXT(
+    safe_VkDebugUtilsMessengerCreateInfoEXT&& move_src) noexcept
+    : safe_VkDebugUtilsMessengerCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDebugUtilsMessengerCreateInfoEXT& safe_VkDebugUtilsMessengerCreateInfoEXT::operator=(
+    safe_VkDebugUtilsMessengerCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(messageSeverity, move_src.messageSeverity);
+    std::swap(messageType, move_src.messageType);
+    std::swap(pfnUserCallback, move_src.pfnUserCallback);
+    std::swap(pUserData, move_src.pUserData);
+
+    return *this;
+}
+
 safe_VkDebugUtilsMessengerCreateInfoEXT::~safe_VkDebugUtilsMessengerCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDebugUtilsMessengerCreateInfoEXT::initialize(const VkDebugUtilsMessengerCreateInfoEXT* in_struct,
@@ -2575,6 +3230,26 @@ safe_VkDebugUtilsObjectTagInfoEXT& safe_VkDebugUtilsObjectTagInfoEXT::operator=(
     return *this;
 }
 
+safe_VkDebugUtilsObjectTagInfoEXT::safe_VkDebugUtilsObjectTagInfoEXT(safe_VkDebugUtilsObjectTagInfoEXT&& move_src) noexcept
+    : safe_VkDebugUtilsObjectTagInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDebugUtilsObjectTagInfoEXT& safe_VkDebugUtilsObjectTagInfoEXT::operator=(
+    safe_VkDebugUtilsObjectTagInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(objectType, move_src.objectType);
+    std::swap(objectHandle, move_src.objectHandle);
+    std::swap(tagName, move_src.tagName);
+    std::swap(tagSize, move_src.tagSize);
+    std::swap(pTag, move_src.pTag);
+
+    return *this;
+}
+
 safe_VkDebugUtilsObjectTagInfoEXT::~safe_VkDebugUtilsObjectTagInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDebugUtilsObjectTagInfoEXT::initialize(const VkDebugUtilsObjectTagInfoEXT* in_struct,
@@ -2662,6 +3337,24 @@ safe_VkSampleLocationsInfoEXT& safe_VkSampleLocationsInfoEXT::operator=(const sa
     return *this;
 }
 
+safe_VkSampleLocationsInfoEXT::safe_VkSampleLocationsInfoEXT(safe_VkSampleLocationsInfoEXT&& move_src) noexcept
+    : safe_VkSampleLocationsInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSampleLocationsInfoEXT& safe_VkSampleLocationsInfoEXT::operator=(safe_VkSampleLocationsInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(sampleLocationsPerPixel, move_src.sampleLocationsPerPixel);
+    std::swap(sampleLocationGridSize, move_src.sampleLocationGridSize);
+    std::swap(sampleLocationsCount, move_src.sampleLocationsCount);
+    std::swap(pSampleLocations, move_src.pSampleLocations);
+
+    return *this;
+}
+
 safe_VkSampleLocationsInfoEXT::~safe_VkSampleLocationsInfoEXT() {
     if (pSampleLocations) delete[] pSampleLocations;
     FreePnextChain(pNext);
@@ -2784,6 +3477,26 @@ safe_VkRenderPassSampleLocationsBeginInfoEXT& safe_VkRenderPassSampleLocationsBe
     return *this;
 }
 
+safe_VkRenderPassSampleLocationsBeginInfoEXT::safe_VkRenderPassSampleLocationsBeginInfoEXT(
+    safe_VkRenderPassSampleLocationsBeginInfoEXT&& move_src) noexcept
+    : safe_VkRenderPassSampleLocationsBeginInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassSampleLocationsBeginInfoEXT& safe_VkRenderPassSampleLocationsBeginInfoEXT::operator=(
+    safe_VkRenderPassSampleLocationsBeginInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(attachmentInitialSampleLocationsCount, move_src.attachmentInitialSampleLocationsCount);
+    std::swap(pAttachmentInitialSampleLocations, move_src.pAttachmentInitialSampleLocations);
+    std::swap(postSubpassSampleLocationsCount, move_src.postSubpassSampleLocationsCount);
+    std::swap(pPostSubpassSampleLocations, move_src.pPostSubpassSampleLocations);
+
+    return *this;
+}
+
 safe_VkRenderPassSampleLocationsBeginInfoEXT::~safe_VkRenderPassSampleLocationsBeginInfoEXT() {
     if (pAttachmentInitialSampleLocations) delete[] pAttachmentInitialSampleLocations;
     if (pPostSubpassSampleLocations) delete[] pPostSubpassSampleLocations;
@@ -2872,6 +3585,24 @@ safe_VkPipelineSampleLocationsStateCreateInfoEXT& safe_VkPipelineSampleLocations
     return *this;
 }
 
+safe_VkPipelineSampleLocationsStateCreateInfoEXT::safe_VkPipelineSampleLocationsStateCreateInfoEXT(
+    safe_VkPipelineSampleLocationsStateCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineSampleLocationsStateCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineSampleLocationsStateCreateInfoEXT& safe_VkPipelineSampleLocationsStateCreateInfoEXT::operator=(
+    safe_VkPipelineSampleLocationsStateCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(sampleLocationsEnable, move_src.sampleLocationsEnable);
+    std::swap(sampleLocationsInfo, move_src.sampleLocationsInfo);
+
+    return *this;
+}
+
 safe_VkPipelineSampleLocationsStateCreateInfoEXT::~safe_VkPipelineSampleLocationsStateCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkPipelineSampleLocationsStateCreateInfoEXT::initialize(const VkPipelineSampleLocationsStateCreateInfoEXT* in_struct,
@@ -2948,6 +3679,27 @@ safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& safe_VkPhysicalDeviceSampleLo
     return *this;
 }
 
+safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::safe_VkPhysicalDeviceSampleLocationsPropertiesEXT(
+    safe_VkPhysicalDeviceSampleLocationsPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceSampleLocationsPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceSampleLocationsPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(sampleLocationSampleCounts, move_src.sampleLocationSampleCounts);
+    std::swap(maxSampleLocationGridSize, move_src.maxSampleLocationGridSize);
+    std::swap(sampleLocationCoordinateRange, move_src.sampleLocationCoordinateRange);
+    std::swap(sampleLocationSubPixelBits, move_src.sampleLocationSubPixelBits);
+    std::swap(variableSampleLocations, move_src.variableSampleLocations);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::~safe_VkPhysicalDeviceSampleLocationsPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::initialize(const VkPhysicalDeviceSampleLocationsPropertiesEXT* in_struct,
@@ -3008,6 +3760,21 @@ safe_VkMultisamplePropertiesEXT& safe_VkMultisamplePropertiesEXT::operator=(cons
     return *this;
 }
 
+safe_VkMultisamplePropertiesEXT::safe_VkMultisamplePropertiesEXT(safe_VkMultisamplePropertiesEXT&& move_src) noexcept
+    : safe_VkMultisamplePropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkMultisamplePropertiesEXT& safe_VkMultisamplePropertiesEXT::operator=(safe_VkMultisamplePropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxSampleLocationGridSize, move_src.maxSampleLocationGridSize);
+
+    return *this;
+}
+
 safe_VkMultisamplePropertiesEXT::~safe_VkMultisamplePropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkMultisamplePropertiesEXT::initialize(const VkMultisamplePropertiesEXT* in_struct,
@@ -3059,6 +3826,23 @@ safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& safe_VkPhysicalDeviceBle
     return *this;
 }
 
+safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT::safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(
+    safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(advancedBlendCoherentOperations, move_src.advancedBlendCoherentOperations);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT::~safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -3133,6 +3917,28 @@ safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& safe_VkPhysicalDeviceB
     return *this;
 }
 
+safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT::safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(
+    safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(advancedBlendMaxColorAttachments, move_src.advancedBlendMaxColorAttachments);
+    std::swap(advancedBlendIndependentBlend, move_src.advancedBlendIndependentBlend);
+    std::swap(advancedBlendNonPremultipliedSrcColor, move_src.advancedBlendNonPremultipliedSrcColor);
+    std::swap(advancedBlendNonPremultipliedDstColor, move_src.advancedBlendNonPremultipliedDstColor);
+    std::swap(advancedBlendCorrelatedOverlap, move_src.advancedBlendCorrelatedOverlap);
+    std::swap(advancedBlendAllOperations, move_src.advancedBlendAllOperations);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT::~safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -3204,6 +4010,25 @@ safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& safe_VkPipelineColorBlendAd
     return *this;
 }
 
+safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT::safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT(
+    safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT::operator=(
+    safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcPremultiplied, move_src.srcPremultiplied);
+    std::swap(dstPremultiplied, move_src.dstPremultiplied);
+    std::swap(blendOverlap, move_src.blendOverlap);
+
+    return *this;
+}
+
 safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT::~safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT() {
     FreePnextChain(pNext);
 }
@@ -3281,6 +4106,24 @@ safe_VkDrmFormatModifierPropertiesListEXT& safe_VkDrmFormatModifierPropertiesLis
     return *this;
 }
 
+safe_VkDrmFormatModifierPropertiesListEXT::safe_VkDrmFormatModifierPropertiesListEXT(
+    safe_VkDrmFormatModifierPropertiesListEXT&& move_src) noexcept
+    : safe_VkDrmFormatModifierPropertiesListEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDrmFormatModifierPropertiesListEXT& safe_VkDrmFormatModifierPropertiesListEXT::operator=(
+    safe_VkDrmFormatModifierPropertiesListEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(drmFormatModifierCount, move_src.drmFormatModifierCount);
+    std::swap(pDrmFormatModifierProperties, move_src.pDrmFormatModifierProperties);
+
+    return *this;
+}
+
 safe_VkDrmFormatModifierPropertiesListEXT::~safe_VkDrmFormatModifierPropertiesListEXT() {
     if (pDrmFormatModifierProperties) delete[] pDrmFormatModifierProperties;
     FreePnextChain(pNext);
@@ -3385,6 +4228,26 @@ safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& safe_VkPhysicalDeviceImageDr
     return *this;
 }
 
+safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT(
+    safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::operator=(
+    safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(drmFormatModifier, move_src.drmFormatModifier);
+    std::swap(sharingMode, move_src.sharingMode);
+    std::swap(queueFamilyIndexCount, move_src.queueFamilyIndexCount);
+    std::swap(pQueueFamilyIndices, move_src.pQueueFamilyIndices);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::~safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT() {
     if (pQueueFamilyIndices) delete[] pQueueFamilyIndices;
     FreePnextChain(pNext);
@@ -3480,6 +4343,24 @@ safe_VkImageDrmFormatModifierListCreateInfoEXT& safe_VkImageDrmFormatModifierLis
     return *this;
 }
 
+safe_VkImageDrmFormatModifierListCreateInfoEXT::safe_VkImageDrmFormatModifierListCreateInfoEXT(
+    safe_VkImageDrmFormatModifierListCreateInfoEXT&& move_src) noexcept
+    : safe_VkImageDrmFormatModifierListCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageDrmFormatModifierListCreateInfoEXT& safe_VkImageDrmFormatModifierListCreateInfoEXT::operator=(
+    safe_VkImageDrmFormatModifierListCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(drmFormatModifierCount, move_src.drmFormatModifierCount);
+    std::swap(pDrmFormatModifiers, move_src.pDrmFormatModifiers);
+
+    return *this;
+}
+
 safe_VkImageDrmFormatModifierListCreateInfoEXT::~safe_VkImageDrmFormatModifierListCreateInfoEXT() {
     if (pDrmFormatModifiers) delete[] pDrmFormatModifiers;
     FreePnextChain(pNext);
@@ -3575,6 +4456,25 @@ safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& safe_VkImageDrmFormatModifie
     return *this;
 }
 
+safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::safe_VkImageDrmFormatModifierExplicitCreateInfoEXT(
+    safe_VkImageDrmFormatModifierExplicitCreateInfoEXT&& move_src) noexcept
+    : safe_VkImageDrmFormatModifierExplicitCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::operator=(
+    safe_VkImageDrmFormatModifierExplicitCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(drmFormatModifier, move_src.drmFormatModifier);
+    std::swap(drmFormatModifierPlaneCount, move_src.drmFormatModifierPlaneCount);
+    std::swap(pPlaneLayouts, move_src.pPlaneLayouts);
+
+    return *this;
+}
+
 safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::~safe_VkImageDrmFormatModifierExplicitCreateInfoEXT() {
     if (pPlaneLayouts) delete[] pPlaneLayouts;
     FreePnextChain(pNext);
@@ -3643,6 +4543,23 @@ safe_VkImageDrmFormatModifierPropertiesEXT& safe_VkImageDrmFormatModifierPropert
     return *this;
 }
 
+safe_VkImageDrmFormatModifierPropertiesEXT::safe_VkImageDrmFormatModifierPropertiesEXT(
+    safe_VkImageDrmFormatModifierPropertiesEXT&& move_src) noexcept
+    : safe_VkImageDrmFormatModifierPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageDrmFormatModifierPropertiesEXT& safe_VkImageDrmFormatModifierPropertiesEXT::operator=(
+    safe_VkImageDrmFormatModifierPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(drmFormatModifier, move_src.drmFormatModifier);
+
+    return *this;
+}
+
 safe_VkImageDrmFormatModifierPropertiesEXT::~safe_VkImageDrmFormatModifierPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkImageDrmFormatModifierPropertiesEXT::initialize(const VkImageDrmFormatModifierPropertiesEXT* in_struct,
@@ -3714,6 +4631,24 @@ safe_VkDrmFormatModifierPropertiesList2EXT& safe_VkDrmFormatModifierPropertiesLi
     return *this;
 }
 
+safe_VkDrmFormatModifierPropertiesList2EXT::safe_VkDrmFormatModifierPropertiesList2EXT(
+    safe_VkDrmFormatModifierPropertiesList2EXT&& move_src) noexcept
+    : safe_VkDrmFormatModifierPropertiesList2EXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDrmFormatModifierPropertiesList2EXT& safe_VkDrmFormatModifierPropertiesList2EXT::operator=(
+    safe_VkDrmFormatModifierPropertiesList2EXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(drmFormatModifierCount, move_src.drmFormatModifierCount);
+    std::swap(pDrmFormatModifierProperties, move_src.pDrmFormatModifierProperties);
+
+    return *this;
+}
+
 safe_VkDrmFormatModifierPropertiesList2EXT::~safe_VkDrmFormatModifierPropertiesList2EXT() {
     if (pDrmFormatModifierProperties) delete[] pDrmFormatModifierProperties;
     FreePnextChain(pNext);
@@ -3791,6 +4726,24 @@ safe_VkValidationCacheCreateInfoEXT& safe_VkValidationCacheCreateInfoEXT::operat
     return *this;
 }
 
+safe_VkValidationCacheCreateInfoEXT::safe_VkValidationCacheCreateInfoEXT(safe_VkValidationCacheCreateInfoEXT&& move_src) noexcept
+    : safe_VkValidationCacheCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkValidationCacheCreateInfoEXT& safe_VkValidationCacheCreateInfoEXT::operator=(
+    safe_VkValidationCacheCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(initialDataSize, move_src.initialDataSize);
+    std::swap(pInitialData, move_src.pInitialData);
+
+    return *this;
+}
+
 safe_VkValidationCacheCreateInfoEXT::~safe_VkValidationCacheCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkValidationCacheCreateInfoEXT::initialize(const VkValidationCacheCreateInfoEXT* in_struct,
@@ -3843,6 +4796,23 @@ safe_VkShaderModuleValidationCacheCreateInfoEXT& safe_VkShaderModuleValidationCa
     return *this;
 }
 
+safe_VkShaderModuleValidationCacheCreateInfoEXT::safe_VkShaderModuleValidationCacheCreateInfoEXT(
+    safe_VkShaderModuleValidationCacheCreateInfoEXT&& move_src) noexcept
+    : safe_VkShaderModuleValidationCacheCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkShaderModuleValidationCacheCreateInfoEXT& safe_VkShaderModuleValidationCacheCreateInfoEXT::operator=(
+    safe_VkShaderModuleValidationCacheCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(validationCache, move_src.validationCache);
+
+    return *this;
+}
+
 safe_VkShaderModuleValidationCacheCreateInfoEXT::~safe_VkShaderModuleValidationCacheCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkShaderModuleValidationCacheCreateInfoEXT::initialize(const VkShaderModuleValidationCacheCreateInfoEXT* in_struct,
@@ -3891,6 +4861,23 @@ safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& safe_VkPhysicalDeviceImageView
     return *this;
 }
 
+safe_VkPhysicalDeviceImageViewImageFormatInfoEXT::safe_VkPhysicalDeviceImageViewImageFormatInfoEXT(
+    safe_VkPhysicalDeviceImageViewImageFormatInfoEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageViewImageFormatInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& safe_VkPhysicalDeviceImageViewImageFormatInfoEXT::operator=(
+    safe_VkPhysicalDeviceImageViewImageFormatInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageViewType, move_src.imageViewType);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageViewImageFormatInfoEXT::~safe_VkPhysicalDeviceImageViewImageFormatInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceImageViewImageFormatInfoEXT::initialize(const VkPhysicalDeviceImageViewImageFormatInfoEXT* in_struct,
@@ -3944,6 +4931,24 @@ safe_VkFilterCubicImageViewImageFormatPropertiesEXT& safe_VkFilterCubicImageView
     return *this;
 }
 
+safe_VkFilterCubicImageViewImageFormatPropertiesEXT::safe_VkFilterCubicImageViewImageFormatPropertiesEXT(
+    safe_VkFilterCubicImageViewImageFormatPropertiesEXT&& move_src) noexcept
+    : safe_VkFilterCubicImageViewImageFormatPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkFilterCubicImageViewImageFormatPropertiesEXT& safe_VkFilterCubicImageViewImageFormatPropertiesEXT::operator=(
+    safe_VkFilterCubicImageViewImageFormatPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(filterCubic, move_src.filterCubic);
+    std::swap(filterCubicMinmax, move_src.filterCubicMinmax);
+
+    return *this;
+}
+
 safe_VkFilterCubicImageViewImageFormatPropertiesEXT::~safe_VkFilterCubicImageViewImageFormatPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -3999,6 +5004,24 @@ safe_VkImportMemoryHostPointerInfoEXT& safe_VkImportMemoryHostPointerInfoEXT::op
     return *this;
 }
 
+safe_VkImportMemoryHostPointerInfoEXT::safe_VkImportMemoryHostPointerInfoEXT(
+    safe_VkImportMemoryHostPointerInfoEXT&& move_src) noexcept
+    : safe_VkImportMemoryHostPointerInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportMemoryHostPointerInfoEXT& safe_VkImportMemoryHostPointerInfoEXT::operator=(
+    safe_VkImportMemoryHostPointerInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleType, move_src.handleType);
+    std::swap(pHostPointer, move_src.pHostPointer);
+
+    return *this;
+}
+
 safe_VkImportMemoryHostPointerInfoEXT::~safe_VkImportMemoryHostPointerInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkImportMemoryHostPointerInfoEXT::initialize(const VkImportMemoryHostPointerInfoEXT* in_struct,
@@ -4050,6 +5073,23 @@ safe_VkMemoryHostPointerPropertiesEXT& safe_VkMemoryHostPointerPropertiesEXT::op
     return *this;
 }
 
+safe_VkMemoryHostPointerPropertiesEXT::safe_VkMemoryHostPointerPropertiesEXT(
+    safe_VkMemoryHostPointerPropertiesEXT&& move_src) noexcept
+    : safe_VkMemoryHostPointerPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryHostPointerPropertiesEXT& safe_VkMemoryHostPointerPropertiesEXT::operator=(
+    safe_VkMemoryHostPointerPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryTypeBits, move_src.memoryTypeBits);
+
+    return *this;
+}
+
 safe_VkMemoryHostPointerPropertiesEXT::~safe_VkMemoryHostPointerPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkMemoryHostPointerPropertiesEXT::initialize(const VkMemoryHostPointerPropertiesEXT* in_struct,
@@ -4100,6 +5140,23 @@ safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& safe_VkPhysicalDeviceExter
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT::safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(
+    safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(minImportedHostPointerAlignment, move_src.minImportedHostPointerAlignment);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT::~safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -4151,6 +5208,23 @@ safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& safe_VkPhysicalDeviceV
     return *this;
 }
 
+safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT::safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(
+    safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxVertexAttribDivisor, move_src.maxVertexAttribDivisor);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT::~safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -4216,6 +5290,26 @@ safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& safe_VkPhysicalDevicePCIBusInfoPro
     return *this;
 }
 
+safe_VkPhysicalDevicePCIBusInfoPropertiesEXT::safe_VkPhysicalDevicePCIBusInfoPropertiesEXT(
+    safe_VkPhysicalDevicePCIBusInfoPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDevicePCIBusInfoPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& safe_VkPhysicalDevicePCIBusInfoPropertiesEXT::operator=(
+    safe_VkPhysicalDevicePCIBusInfoPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pciDomain, move_src.pciDomain);
+    std::swap(pciBus, move_src.pciBus);
+    std::swap(pciDevice, move_src.pciDevice);
+    std::swap(pciFunction, move_src.pciFunction);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePCIBusInfoPropertiesEXT::~safe_VkPhysicalDevicePCIBusInfoPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePCIBusInfoPropertiesEXT::initialize(const VkPhysicalDevicePCIBusInfoPropertiesEXT* in_struct,
@@ -4281,10 +5375,29 @@ safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& safe_VkPhysicalDeviceFragmen
     return *this;
 }
 
-safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT::~safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT() { FreePnextChain(pNext); }
+safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT::safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT(
+    safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT() {
+    *this = std::move(move_src);
+}
 
-void safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT::initialize(const VkPhysicalDeviceFragmentDensityMapFeaturesEXT* in_struct,
-                                                                    [[maybe_unused]] PNextCopyState* copy_state) {
+safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fragmentDensityMap, move_src.fragmentDensityMap);
+    std::swap(fragmentDensityMapDynamic, move_src.fragmentDensityMapDynamic);
+    std::swap(fragmentDensityMapNonSubsampledImages, move_src.fragmentDensityMapNonSubsampledImages);
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT::~safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT() { FreePnextChain(pNext); }
+
+void safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT::initialize(const VkPhysicalDeviceFragmentDensityMapFeaturesEXT* in_struct,
+                                                                    [[maybe_unused]] PNextCopyState* copy_state) {
     FreePnextChain(pNext);
     sType = in_struct->sType;
     fragmentDensityMap = in_struct->fragmentDensityMap;
@@ -4344,6 +5457,25 @@ safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& safe_VkPhysicalDeviceFragm
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT::safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT(
+    safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(minFragmentDensityTexelSize, move_src.minFragmentDensityTexelSize);
+    std::swap(maxFragmentDensityTexelSize, move_src.maxFragmentDensityTexelSize);
+    std::swap(fragmentDensityInvocations, move_src.fragmentDensityInvocations);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT::~safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -4398,6 +5530,23 @@ safe_VkRenderPassFragmentDensityMapCreateInfoEXT& safe_VkRenderPassFragmentDensi
     return *this;
 }
 
+safe_VkRenderPassFragmentDensityMapCreateInfoEXT::safe_VkRenderPassFragmentDensityMapCreateInfoEXT(
+    safe_VkRenderPassFragmentDensityMapCreateInfoEXT&& move_src) noexcept
+    : safe_VkRenderPassFragmentDensityMapCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassFragmentDensityMapCreateInfoEXT& safe_VkRenderPassFragmentDensityMapCreateInfoEXT::operator=(
+    safe_VkRenderPassFragmentDensityMapCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fragmentDensityMapAttachment, move_src.fragmentDensityMapAttachment);
+
+    return *this;
+}
+
 safe_VkRenderPassFragmentDensityMapCreateInfoEXT::~safe_VkRenderPassFragmentDensityMapCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkRenderPassFragmentDensityMapCreateInfoEXT::initialize(const VkRenderPassFragmentDensityMapCreateInfoEXT* in_struct,
@@ -4454,6 +5603,24 @@ safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& safe_VkPhysicalDeviceSha
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT::safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT(
+    safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT::operator=(
+    safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderImageInt64Atomics, move_src.shaderImageInt64Atomics);
+    std::swap(sparseImageInt64Atomics, move_src.sparseImageInt64Atomics);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT::~safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -4527,6 +5694,24 @@ safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& safe_VkPhysicalDeviceMemoryBudge
     return *this;
 }
 
+safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT(
+    safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(heapBudget, move_src.heapBudget);
+    std::swap(heapUsage, move_src.heapUsage);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::~safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::initialize(const VkPhysicalDeviceMemoryBudgetPropertiesEXT* in_struct,
@@ -4589,6 +5774,23 @@ safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& safe_VkPhysicalDeviceMemoryPrior
     return *this;
 }
 
+safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT::safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT(
+    safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryPriority, move_src.memoryPriority);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT::~safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT::initialize(const VkPhysicalDeviceMemoryPriorityFeaturesEXT* in_struct,
@@ -4637,6 +5839,22 @@ safe_VkMemoryPriorityAllocateInfoEXT& safe_VkMemoryPriorityAllocateInfoEXT::oper
     return *this;
 }
 
+safe_VkMemoryPriorityAllocateInfoEXT::safe_VkMemoryPriorityAllocateInfoEXT(safe_VkMemoryPriorityAllocateInfoEXT&& move_src) noexcept
+    : safe_VkMemoryPriorityAllocateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryPriorityAllocateInfoEXT& safe_VkMemoryPriorityAllocateInfoEXT::operator=(
+    safe_VkMemoryPriorityAllocateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(priority, move_src.priority);
+
+    return *this;
+}
+
 safe_VkMemoryPriorityAllocateInfoEXT::~safe_VkMemoryPriorityAllocateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkMemoryPriorityAllocateInfoEXT::initialize(const VkMemoryPriorityAllocateInfoEXT* in_struct,
@@ -4696,6 +5914,25 @@ safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& safe_VkPhysicalDeviceBuffer
     return *this;
 }
 
+safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT::safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT(
+    safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(bufferDeviceAddress, move_src.bufferDeviceAddress);
+    std::swap(bufferDeviceAddressCaptureReplay, move_src.bufferDeviceAddressCaptureReplay);
+    std::swap(bufferDeviceAddressMultiDevice, move_src.bufferDeviceAddressMultiDevice);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT::~safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -4750,6 +5987,23 @@ safe_VkBufferDeviceAddressCreateInfoEXT& safe_VkBufferDeviceAddressCreateInfoEXT
     return *this;
 }
 
+safe_VkBufferDeviceAddressCreateInfoEXT::safe_VkBufferDeviceAddressCreateInfoEXT(
+    safe_VkBufferDeviceAddressCreateInfoEXT&& move_src) noexcept
+    : safe_VkBufferDeviceAddressCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferDeviceAddressCreateInfoEXT& safe_VkBufferDeviceAddressCreateInfoEXT::operator=(
+    safe_VkBufferDeviceAddressCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceAddress, move_src.deviceAddress);
+
+    return *this;
+}
+
 safe_VkBufferDeviceAddressCreateInfoEXT::~safe_VkBufferDeviceAddressCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkBufferDeviceAddressCreateInfoEXT::initialize(const VkBufferDeviceAddressCreateInfoEXT* in_struct,
@@ -4848,6 +6102,24 @@ safe_VkValidationFeaturesEXT& safe_VkValidationFeaturesEXT::operator=(const safe
     return *this;
 }
 
+safe_VkValidationFeaturesEXT::safe_VkValidationFeaturesEXT(safe_VkValidationFeaturesEXT&& move_src) noexcept
+    : safe_VkValidationFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkValidationFeaturesEXT& safe_VkValidationFeaturesEXT::operator=(safe_VkValidationFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(enabledValidationFeatureCount, move_src.enabledValidationFeatureCount);
+    std::swap(pEnabledValidationFeatures, move_src.pEnabledValidationFeatures);
+    std::swap(disabledValidationFeatureCount, move_src.disabledValidationFeatureCount);
+    std::swap(pDisabledValidationFeatures, move_src.pDisabledValidationFeatures);
+
+    return *this;
+}
+
 safe_VkValidationFeaturesEXT::~safe_VkValidationFeaturesEXT() {
     if (pEnabledValidationFeatures) delete[] pEnabledValidationFeatures;
     if (pDisabledValidationFeatures) delete[] pDisabledValidationFeatures;
@@ -4944,6 +6216,25 @@ safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& safe_VkPhysicalDeviceFr
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT(
+    safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fragmentShaderSampleInterlock, move_src.fragmentShaderSampleInterlock);
+    std::swap(fragmentShaderPixelInterlock, move_src.fragmentShaderPixelInterlock);
+    std::swap(fragmentShaderShadingRateInterlock, move_src.fragmentShaderShadingRateInterlock);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::~safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -4998,6 +6289,23 @@ safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& safe_VkPhysicalDeviceYcbcrImag
     return *this;
 }
 
+safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT::safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT(
+    safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(ycbcrImageArrays, move_src.ycbcrImageArrays);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT::~safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT::initialize(const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT* in_struct,
@@ -5053,6 +6361,24 @@ safe_VkPhysicalDeviceProvokingVertexFeaturesEXT& safe_VkPhysicalDeviceProvokingV
     return *this;
 }
 
+safe_VkPhysicalDeviceProvokingVertexFeaturesEXT::safe_VkPhysicalDeviceProvokingVertexFeaturesEXT(
+    safe_VkPhysicalDeviceProvokingVertexFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceProvokingVertexFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceProvokingVertexFeaturesEXT& safe_VkPhysicalDeviceProvokingVertexFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceProvokingVertexFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(provokingVertexLast, move_src.provokingVertexLast);
+    std::swap(transformFeedbackPreservesProvokingVertex, move_src.transformFeedbackPreservesProvokingVertex);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceProvokingVertexFeaturesEXT::~safe_VkPhysicalDeviceProvokingVertexFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceProvokingVertexFeaturesEXT::initialize(const VkPhysicalDeviceProvokingVertexFeaturesEXT* in_struct,
@@ -5110,6 +6436,24 @@ safe_VkPhysicalDeviceProvokingVertexPropertiesEXT& safe_VkPhysicalDeviceProvokin
     return *this;
 }
 
+safe_VkPhysicalDeviceProvokingVertexPropertiesEXT::safe_VkPhysicalDeviceProvokingVertexPropertiesEXT(
+    safe_VkPhysicalDeviceProvokingVertexPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceProvokingVertexPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceProvokingVertexPropertiesEXT& safe_VkPhysicalDeviceProvokingVertexPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceProvokingVertexPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(provokingVertexModePerPipeline, move_src.provokingVertexModePerPipeline);
+    std::swap(transformFeedbackPreservesTriangleFanProvokingVertex, move_src.transformFeedbackPreservesTriangleFanProvokingVertex);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceProvokingVertexPropertiesEXT::~safe_VkPhysicalDeviceProvokingVertexPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceProvokingVertexPropertiesEXT::initialize(const VkPhysicalDeviceProvokingVertexPropertiesEXT* in_struct,
@@ -5164,6 +6508,24 @@ safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT::operator=(
     return *this;
 }
 
+safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT::safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT(
+    safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT&
+safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT::operator=(
+    safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(provokingVertexMode, move_src.provokingVertexMode);
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT::~safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT() {
     FreePnextChain(pNext);
 }
@@ -5215,6 +6577,23 @@ safe_VkSurfaceFullScreenExclusiveInfoEXT& safe_VkSurfaceFullScreenExclusiveInfoE
     return *this;
 }
 
+safe_VkSurfaceFullScreenExclusiveInfoEXT::safe_VkSurfaceFullScreenExclusiveInfoEXT(
+    safe_VkSurfaceFullScreenExclusiveInfoEXT&& move_src) noexcept
+    : safe_VkSurfaceFullScreenExclusiveInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSurfaceFullScreenExclusiveInfoEXT& safe_VkSurfaceFullScreenExclusiveInfoEXT::operator=(
+    safe_VkSurfaceFullScreenExclusiveInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fullScreenExclusive, move_src.fullScreenExclusive);
+
+    return *this;
+}
+
 safe_VkSurfaceFullScreenExclusiveInfoEXT::~safe_VkSurfaceFullScreenExclusiveInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkSurfaceFullScreenExclusiveInfoEXT::initialize(const VkSurfaceFullScreenExclusiveInfoEXT* in_struct,
@@ -5263,6 +6642,23 @@ safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& safe_VkSurfaceCapabilitiesFull
     return *this;
 }
 
+safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT::safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT(
+    safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT&& move_src) noexcept
+    : safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT::operator=(
+    safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fullScreenExclusiveSupported, move_src.fullScreenExclusiveSupported);
+
+    return *this;
+}
+
 safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT::~safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT() { FreePnextChain(pNext); }
 
 void safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT::initialize(const VkSurfaceCapabilitiesFullScreenExclusiveEXT* in_struct,
@@ -5311,6 +6707,23 @@ safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& safe_VkSurfaceFullScreenExclusive
     return *this;
 }
 
+safe_VkSurfaceFullScreenExclusiveWin32InfoEXT::safe_VkSurfaceFullScreenExclusiveWin32InfoEXT(
+    safe_VkSurfaceFullScreenExclusiveWin32InfoEXT&& move_src) noexcept
+    : safe_VkSurfaceFullScreenExclusiveWin32InfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& safe_VkSurfaceFullScreenExclusiveWin32InfoEXT::operator=(
+    safe_VkSurfaceFullScreenExclusiveWin32InfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(hmonitor, move_src.hmonitor);
+
+    return *this;
+}
+
 safe_VkSurfaceFullScreenExclusiveWin32InfoEXT::~safe_VkSurfaceFullScreenExclusiveWin32InfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkSurfaceFullScreenExclusiveWin32InfoEXT::initialize(const VkSurfaceFullScreenExclusiveWin32InfoEXT* in_struct,
@@ -5360,6 +6773,22 @@ safe_VkHeadlessSurfaceCreateInfoEXT& safe_VkHeadlessSurfaceCreateInfoEXT::operat
     return *this;
 }
 
+safe_VkHeadlessSurfaceCreateInfoEXT::safe_VkHeadlessSurfaceCreateInfoEXT(safe_VkHeadlessSurfaceCreateInfoEXT&& move_src) noexcept
+    : safe_VkHeadlessSurfaceCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkHeadlessSurfaceCreateInfoEXT& safe_VkHeadlessSurfaceCreateInfoEXT::operator=(
+    safe_VkHeadlessSurfaceCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkHeadlessSurfaceCreateInfoEXT::~safe_VkHeadlessSurfaceCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkHeadlessSurfaceCreateInfoEXT::initialize(const VkHeadlessSurfaceCreateInfoEXT* in_struct,
@@ -5431,6 +6860,28 @@ safe_VkPhysicalDeviceLineRasterizationFeaturesEXT& safe_VkPhysicalDeviceLineRast
     return *this;
 }
 
+safe_VkPhysicalDeviceLineRasterizationFeaturesEXT::safe_VkPhysicalDeviceLineRasterizationFeaturesEXT(
+    safe_VkPhysicalDeviceLineRasterizationFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceLineRasterizationFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceLineRasterizationFeaturesEXT& safe_VkPhysicalDeviceLineRasterizationFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceLineRasterizationFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(rectangularLines, move_src.rectangularLines);
+    std::swap(bresenhamLines, move_src.bresenhamLines);
+    std::swap(smoothLines, move_src.smoothLines);
+    std::swap(stippledRectangularLines, move_src.stippledRectangularLines);
+    std::swap(stippledBresenhamLines, move_src.stippledBresenhamLines);
+    std::swap(stippledSmoothLines, move_src.stippledSmoothLines);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceLineRasterizationFeaturesEXT::~safe_VkPhysicalDeviceLineRasterizationFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceLineRasterizationFeaturesEXT::initialize(const VkPhysicalDeviceLineRasterizationFeaturesEXT* in_struct,
@@ -5489,6 +6940,23 @@ safe_VkPhysicalDeviceLineRasterizationPropertiesEXT& safe_VkPhysicalDeviceLineRa
     return *this;
 }
 
+safe_VkPhysicalDeviceLineRasterizationPropertiesEXT::safe_VkPhysicalDeviceLineRasterizationPropertiesEXT(
+    safe_VkPhysicalDeviceLineRasterizationPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceLineRasterizationPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceLineRasterizationPropertiesEXT& safe_VkPhysicalDeviceLineRasterizationPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceLineRasterizationPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(lineSubPixelPrecisionBits, move_src.lineSubPixelPrecisionBits);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceLineRasterizationPropertiesEXT::~safe_VkPhysicalDeviceLineRasterizationPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -5554,6 +7022,26 @@ safe_VkPipelineRasterizationLineStateCreateInfoEXT& safe_VkPipelineRasterization
     return *this;
 }
 
+safe_VkPipelineRasterizationLineStateCreateInfoEXT::safe_VkPipelineRasterizationLineStateCreateInfoEXT(
+    safe_VkPipelineRasterizationLineStateCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineRasterizationLineStateCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineRasterizationLineStateCreateInfoEXT& safe_VkPipelineRasterizationLineStateCreateInfoEXT::operator=(
+    safe_VkPipelineRasterizationLineStateCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(lineRasterizationMode, move_src.lineRasterizationMode);
+    std::swap(stippledLineEnable, move_src.stippledLineEnable);
+    std::swap(lineStippleFactor, move_src.lineStippleFactor);
+    std::swap(lineStipplePattern, move_src.lineStipplePattern);
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationLineStateCreateInfoEXT::~safe_VkPipelineRasterizationLineStateCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkPipelineRasterizationLineStateCreateInfoEXT::initialize(const VkPipelineRasterizationLineStateCreateInfoEXT* in_struct,
@@ -5655,6 +7143,34 @@ safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& safe_VkPhysicalDeviceShaderAt
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT(
+    safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderBufferFloat32Atomics, move_src.shaderBufferFloat32Atomics);
+    std::swap(shaderBufferFloat32AtomicAdd, move_src.shaderBufferFloat32AtomicAdd);
+    std::swap(shaderBufferFloat64Atomics, move_src.shaderBufferFloat64Atomics);
+    std::swap(shaderBufferFloat64AtomicAdd, move_src.shaderBufferFloat64AtomicAdd);
+    std::swap(shaderSharedFloat32Atomics, move_src.shaderSharedFloat32Atomics);
+    std::swap(shaderSharedFloat32AtomicAdd, move_src.shaderSharedFloat32AtomicAdd);
+    std::swap(shaderSharedFloat64Atomics, move_src.shaderSharedFloat64Atomics);
+    std::swap(shaderSharedFloat64AtomicAdd, move_src.shaderSharedFloat64AtomicAdd);
+    std::swap(shaderImageFloat32Atomics, move_src.shaderImageFloat32Atomics);
+    std::swap(shaderImageFloat32AtomicAdd, move_src.shaderImageFloat32AtomicAdd);
+    std::swap(sparseImageFloat32Atomics, move_src.sparseImageFloat32Atomics);
+    std::swap(sparseImageFloat32AtomicAdd, move_src.sparseImageFloat32AtomicAdd);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::~safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT::initialize(const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT* in_struct,
@@ -5725,6 +7241,23 @@ safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT& safe_VkPhysicalDeviceIndexTypeUi
     return *this;
 }
 
+safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT::safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT(
+    safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT& safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT::operator=(
+    safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(indexTypeUint8, move_src.indexTypeUint8);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT::~safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT::initialize(const VkPhysicalDeviceIndexTypeUint8FeaturesEXT* in_struct,
@@ -5773,6 +7306,23 @@ safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& safe_VkPhysicalDeviceExten
     return *this;
 }
 
+safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT::safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT(
+    safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(extendedDynamicState, move_src.extendedDynamicState);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT::~safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -5823,6 +7373,23 @@ safe_VkPhysicalDeviceHostImageCopyFeaturesEXT& safe_VkPhysicalDeviceHostImageCop
     return *this;
 }
 
+safe_VkPhysicalDeviceHostImageCopyFeaturesEXT::safe_VkPhysicalDeviceHostImageCopyFeaturesEXT(
+    safe_VkPhysicalDeviceHostImageCopyFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceHostImageCopyFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceHostImageCopyFeaturesEXT& safe_VkPhysicalDeviceHostImageCopyFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceHostImageCopyFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(hostImageCopy, move_src.hostImageCopy);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceHostImageCopyFeaturesEXT::~safe_VkPhysicalDeviceHostImageCopyFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceHostImageCopyFeaturesEXT::initialize(const VkPhysicalDeviceHostImageCopyFeaturesEXT* in_struct,
@@ -5933,6 +7500,28 @@ safe_VkPhysicalDeviceHostImageCopyPropertiesEXT& safe_VkPhysicalDeviceHostImageC
     return *this;
 }
 
+safe_VkPhysicalDeviceHostImageCopyPropertiesEXT::safe_VkPhysicalDeviceHostImageCopyPropertiesEXT(
+    safe_VkPhysicalDeviceHostImageCopyPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceHostImageCopyPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceHostImageCopyPropertiesEXT& safe_VkPhysicalDeviceHostImageCopyPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceHostImageCopyPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(copySrcLayoutCount, move_src.copySrcLayoutCount);
+    std::swap(pCopySrcLayouts, move_src.pCopySrcLayouts);
+    std::swap(copyDstLayoutCount, move_src.copyDstLayoutCount);
+    std::swap(pCopyDstLayouts, move_src.pCopyDstLayouts);
+    std::swap(optimalTilingLayoutUUID, move_src.optimalTilingLayoutUUID);
+    std::swap(identicalMemoryTypeRequirements, move_src.identicalMemoryTypeRequirements);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceHostImageCopyPropertiesEXT::~safe_VkPhysicalDeviceHostImageCopyPropertiesEXT() {
     if (pCopySrcLayouts) delete[] pCopySrcLayouts;
     if (pCopyDstLayouts) delete[] pCopyDstLayouts;
@@ -6044,6 +7633,26 @@ safe_VkMemoryToImageCopyEXT& safe_VkMemoryToImageCopyEXT::operator=(const safe_V
     return *this;
 }
 
+safe_VkMemoryToImageCopyEXT::safe_VkMemoryToImageCopyEXT(safe_VkMemoryToImageCopyEXT&& move_src) noexcept
+    : safe_VkMemoryToImageCopyEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryToImageCopyEXT& safe_VkMemoryToImageCopyEXT::operator=(safe_VkMemoryToImageCopyEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pHostPointer, move_src.pHostPointer);
+    std::swap(memoryRowLength, move_src.memoryRowLength);
+    std::swap(memoryImageHeight, move_src.memoryImageHeight);
+    std::swap(imageSubresource, move_src.imageSubresource);
+    std::swap(imageOffset, move_src.imageOffset);
+    std::swap(imageExtent, move_src.imageExtent);
+
+    return *this;
+}
+
 safe_VkMemoryToImageCopyEXT::~safe_VkMemoryToImageCopyEXT() { FreePnextChain(pNext); }
 
 void safe_VkMemoryToImageCopyEXT::initialize(const VkMemoryToImageCopyEXT* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -6122,6 +7731,26 @@ safe_VkImageToMemoryCopyEXT& safe_VkImageToMemoryCopyEXT::operator=(const safe_V
     return *this;
 }
 
+safe_VkImageToMemoryCopyEXT::safe_VkImageToMemoryCopyEXT(safe_VkImageToMemoryCopyEXT&& move_src) noexcept
+    : safe_VkImageToMemoryCopyEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageToMemoryCopyEXT& safe_VkImageToMemoryCopyEXT::operator=(safe_VkImageToMemoryCopyEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pHostPointer, move_src.pHostPointer);
+    std::swap(memoryRowLength, move_src.memoryRowLength);
+    std::swap(memoryImageHeight, move_src.memoryImageHeight);
+    std::swap(imageSubresource, move_src.imageSubresource);
+    std::swap(imageOffset, move_src.imageOffset);
+    std::swap(imageExtent, move_src.imageExtent);
+
+    return *this;
+}
+
 safe_VkImageToMemoryCopyEXT::~safe_VkImageToMemoryCopyEXT() { FreePnextChain(pNext); }
 
 void safe_VkImageToMemoryCopyEXT::initialize(const VkImageToMemoryCopyEXT* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -6215,12 +7844,31 @@ safe_VkCopyMemoryToImageInfoEXT& safe_VkCopyMemoryToImageInfoEXT::operator=(cons
     return *this;
 }
 
-safe_VkCopyMemoryToImageInfoEXT::~safe_VkCopyMemoryToImageInfoEXT() {
-    if (pRegions) delete[] pRegions;
-    FreePnextChain(pNext);
+safe_VkCopyMemoryToImageInfoEXT::safe_VkCopyMemoryToImageInfoEXT(safe_VkCopyMemoryToImageInfoEXT&& move_src) noexcept
+    : safe_VkCopyMemoryToImageInfoEXT() {
+    *this = std::move(move_src);
 }
 
-void safe_VkCopyMemoryToImageInfoEXT::initialize(const VkCopyMemoryToImageInfoEXT* in_struct,
+safe_VkCopyMemoryToImageInfoEXT& safe_VkCopyMemoryToImageInfoEXT::operator=(safe_VkCopyMemoryToImageInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(dstImage, move_src.dstImage);
+    std::swap(dstImageLayout, move_src.dstImageLayout);
+    std::swap(regionCount, move_src.regionCount);
+    std::swap(pRegions, move_src.pRegions);
+
+    return *this;
+}
+
+safe_VkCopyMemoryToImageInfoEXT::~safe_VkCopyMemoryToImageInfoEXT() {
+    if (pRegions) delete[] pRegions;
+    FreePnextChain(pNext);
+}
+
+void safe_VkCopyMemoryToImageInfoEXT::initialize(const VkCopyMemoryToImageInfoEXT* in_struct,
                                                  [[maybe_unused]] PNextCopyState* copy_state) {
     if (pRegions) delete[] pRegions;
     FreePnextChain(pNext);
@@ -6323,6 +7971,25 @@ safe_VkCopyImageToMemoryInfoEXT& safe_VkCopyImageToMemoryInfoEXT::operator=(cons
     return *this;
 }
 
+safe_VkCopyImageToMemoryInfoEXT::safe_VkCopyImageToMemoryInfoEXT(safe_VkCopyImageToMemoryInfoEXT&& move_src) noexcept
+    : safe_VkCopyImageToMemoryInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyImageToMemoryInfoEXT& safe_VkCopyImageToMemoryInfoEXT::operator=(safe_VkCopyImageToMemoryInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(srcImage, move_src.srcImage);
+    std::swap(srcImageLayout, move_src.srcImageLayout);
+    std::swap(regionCount, move_src.regionCount);
+    std::swap(pRegions, move_src.pRegions);
+
+    return *this;
+}
+
 safe_VkCopyImageToMemoryInfoEXT::~safe_VkCopyImageToMemoryInfoEXT() {
     if (pRegions) delete[] pRegions;
     FreePnextChain(pNext);
@@ -6439,6 +8106,27 @@ safe_VkCopyImageToImageInfoEXT& safe_VkCopyImageToImageInfoEXT::operator=(const
     return *this;
 }
 
+safe_VkCopyImageToImageInfoEXT::safe_VkCopyImageToImageInfoEXT(safe_VkCopyImageToImageInfoEXT&& move_src) noexcept
+    : safe_VkCopyImageToImageInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyImageToImageInfoEXT& safe_VkCopyImageToImageInfoEXT::operator=(safe_VkCopyImageToImageInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(srcImage, move_src.srcImage);
+    std::swap(srcImageLayout, move_src.srcImageLayout);
+    std::swap(dstImage, move_src.dstImage);
+    std::swap(dstImageLayout, move_src.dstImageLayout);
+    std::swap(regionCount, move_src.regionCount);
+    std::swap(pRegions, move_src.pRegions);
+
+    return *this;
+}
+
 safe_VkCopyImageToImageInfoEXT::~safe_VkCopyImageToImageInfoEXT() {
     if (pRegions) delete[] pRegions;
     FreePnextChain(pNext);
@@ -6530,6 +8218,26 @@ safe_VkHostImageLayoutTransitionInfoEXT& safe_VkHostImageLayoutTransitionInfoEXT
     return *this;
 }
 
+safe_VkHostImageLayoutTransitionInfoEXT::safe_VkHostImageLayoutTransitionInfoEXT(
+    safe_VkHostImageLayoutTransitionInfoEXT&& move_src) noexcept
+    : safe_VkHostImageLayoutTransitionInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkHostImageLayoutTransitionInfoEXT& safe_VkHostImageLayoutTransitionInfoEXT::operator=(
+    safe_VkHostImageLayoutTransitionInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(image, move_src.image);
+    std::swap(oldLayout, move_src.oldLayout);
+    std::swap(newLayout, move_src.newLayout);
+    std::swap(subresourceRange, move_src.subresourceRange);
+
+    return *this;
+}
+
 safe_VkHostImageLayoutTransitionInfoEXT::~safe_VkHostImageLayoutTransitionInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkHostImageLayoutTransitionInfoEXT::initialize(const VkHostImageLayoutTransitionInfoEXT* in_struct,
@@ -6584,6 +8292,22 @@ safe_VkSubresourceHostMemcpySizeEXT& safe_VkSubresourceHostMemcpySizeEXT::operat
     return *this;
 }
 
+safe_VkSubresourceHostMemcpySizeEXT::safe_VkSubresourceHostMemcpySizeEXT(safe_VkSubresourceHostMemcpySizeEXT&& move_src) noexcept
+    : safe_VkSubresourceHostMemcpySizeEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubresourceHostMemcpySizeEXT& safe_VkSubresourceHostMemcpySizeEXT::operator=(
+    safe_VkSubresourceHostMemcpySizeEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(size, move_src.size);
+
+    return *this;
+}
+
 safe_VkSubresourceHostMemcpySizeEXT::~safe_VkSubresourceHostMemcpySizeEXT() { FreePnextChain(pNext); }
 
 void safe_VkSubresourceHostMemcpySizeEXT::initialize(const VkSubresourceHostMemcpySizeEXT* in_struct,
@@ -6639,6 +8363,24 @@ safe_VkHostImageCopyDevicePerformanceQueryEXT& safe_VkHostImageCopyDevicePerform
     return *this;
 }
 
+safe_VkHostImageCopyDevicePerformanceQueryEXT::safe_VkHostImageCopyDevicePerformanceQueryEXT(
+    safe_VkHostImageCopyDevicePerformanceQueryEXT&& move_src) noexcept
+    : safe_VkHostImageCopyDevicePerformanceQueryEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkHostImageCopyDevicePerformanceQueryEXT& safe_VkHostImageCopyDevicePerformanceQueryEXT::operator=(
+    safe_VkHostImageCopyDevicePerformanceQueryEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(optimalDeviceAccess, move_src.optimalDeviceAccess);
+    std::swap(identicalMemoryLayout, move_src.identicalMemoryLayout);
+
+    return *this;
+}
+
 safe_VkHostImageCopyDevicePerformanceQueryEXT::~safe_VkHostImageCopyDevicePerformanceQueryEXT() { FreePnextChain(pNext); }
 
 void safe_VkHostImageCopyDevicePerformanceQueryEXT::initialize(const VkHostImageCopyDevicePerformanceQueryEXT* in_struct,
@@ -6736,6 +8478,34 @@ safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& safe_VkPhysicalDeviceShaderA
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT(
+    safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::operator=(
+    safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderBufferFloat16Atomics, move_src.shaderBufferFloat16Atomics);
+    std::swap(shaderBufferFloat16AtomicAdd, move_src.shaderBufferFloat16AtomicAdd);
+    std::swap(shaderBufferFloat16AtomicMinMax, move_src.shaderBufferFloat16AtomicMinMax);
+    std::swap(shaderBufferFloat32AtomicMinMax, move_src.shaderBufferFloat32AtomicMinMax);
+    std::swap(shaderBufferFloat64AtomicMinMax, move_src.shaderBufferFloat64AtomicMinMax);
+    std::swap(shaderSharedFloat16Atomics, move_src.shaderSharedFloat16Atomics);
+    std::swap(shaderSharedFloat16AtomicAdd, move_src.shaderSharedFloat16AtomicAdd);
+    std::swap(shaderSharedFloat16AtomicMinMax, move_src.shaderSharedFloat16AtomicMinMax);
+    std::swap(shaderSharedFloat32AtomicMinMax, move_src.shaderSharedFloat32AtomicMinMax);
+    std::swap(shaderSharedFloat64AtomicMinMax, move_src.shaderSharedFloat64AtomicMinMax);
+    std::swap(shaderImageFloat32AtomicMinMax, move_src.shaderImageFloat32AtomicMinMax);
+    std::swap(sparseImageFloat32AtomicMinMax, move_src.sparseImageFloat32AtomicMinMax);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::~safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT::initialize(const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT* in_struct,
@@ -6804,6 +8574,21 @@ safe_VkSurfacePresentModeEXT& safe_VkSurfacePresentModeEXT::operator=(const safe
     return *this;
 }
 
+safe_VkSurfacePresentModeEXT::safe_VkSurfacePresentModeEXT(safe_VkSurfacePresentModeEXT&& move_src) noexcept
+    : safe_VkSurfacePresentModeEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSurfacePresentModeEXT& safe_VkSurfacePresentModeEXT::operator=(safe_VkSurfacePresentModeEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentMode, move_src.presentMode);
+
+    return *this;
+}
+
 safe_VkSurfacePresentModeEXT::~safe_VkSurfacePresentModeEXT() { FreePnextChain(pNext); }
 
 void safe_VkSurfacePresentModeEXT::initialize(const VkSurfacePresentModeEXT* in_struct,
@@ -6871,6 +8656,27 @@ safe_VkSurfacePresentScalingCapabilitiesEXT& safe_VkSurfacePresentScalingCapabil
     return *this;
 }
 
+safe_VkSurfacePresentScalingCapabilitiesEXT::safe_VkSurfacePresentScalingCapabilitiesEXT(
+    safe_VkSurfacePresentScalingCapabilitiesEXT&& move_src) noexcept
+    : safe_VkSurfacePresentScalingCapabilitiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSurfacePresentScalingCapabilitiesEXT& safe_VkSurfacePresentScalingCapabilitiesEXT::operator=(
+    safe_VkSurfacePresentScalingCapabilitiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(supportedPresentScaling, move_src.supportedPresentScaling);
+    std::swap(supportedPresentGravityX, move_src.supportedPresentGravityX);
+    std::swap(supportedPresentGravityY, move_src.supportedPresentGravityY);
+    std::swap(minScaledImageExtent, move_src.minScaledImageExtent);
+    std::swap(maxScaledImageExtent, move_src.maxScaledImageExtent);
+
+    return *this;
+}
+
 safe_VkSurfacePresentScalingCapabilitiesEXT::~safe_VkSurfacePresentScalingCapabilitiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkSurfacePresentScalingCapabilitiesEXT::initialize(const VkSurfacePresentScalingCapabilitiesEXT* in_struct,
@@ -6944,6 +8750,24 @@ safe_VkSurfacePresentModeCompatibilityEXT& safe_VkSurfacePresentModeCompatibilit
     return *this;
 }
 
+safe_VkSurfacePresentModeCompatibilityEXT::safe_VkSurfacePresentModeCompatibilityEXT(
+    safe_VkSurfacePresentModeCompatibilityEXT&& move_src) noexcept
+    : safe_VkSurfacePresentModeCompatibilityEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSurfacePresentModeCompatibilityEXT& safe_VkSurfacePresentModeCompatibilityEXT::operator=(
+    safe_VkSurfacePresentModeCompatibilityEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentModeCount, move_src.presentModeCount);
+    std::swap(pPresentModes, move_src.pPresentModes);
+
+    return *this;
+}
+
 safe_VkSurfacePresentModeCompatibilityEXT::~safe_VkSurfacePresentModeCompatibilityEXT() {
     if (pPresentModes) delete[] pPresentModes;
     FreePnextChain(pNext);
@@ -7008,6 +8832,23 @@ safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& safe_VkPhysicalDeviceSwap
     return *this;
 }
 
+safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT::safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT(
+    safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT::operator=(
+    safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(swapchainMaintenance1, move_src.swapchainMaintenance1);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT::~safe_VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -7079,6 +8920,23 @@ safe_VkSwapchainPresentFenceInfoEXT& safe_VkSwapchainPresentFenceInfoEXT::operat
     return *this;
 }
 
+safe_VkSwapchainPresentFenceInfoEXT::safe_VkSwapchainPresentFenceInfoEXT(safe_VkSwapchainPresentFenceInfoEXT&& move_src) noexcept
+    : safe_VkSwapchainPresentFenceInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSwapchainPresentFenceInfoEXT& safe_VkSwapchainPresentFenceInfoEXT::operator=(
+    safe_VkSwapchainPresentFenceInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(swapchainCount, move_src.swapchainCount);
+    std::swap(pFences, move_src.pFences);
+
+    return *this;
+}
+
 safe_VkSwapchainPresentFenceInfoEXT::~safe_VkSwapchainPresentFenceInfoEXT() {
     if (pFences) delete[] pFences;
     FreePnextChain(pNext);
@@ -7165,6 +9023,24 @@ safe_VkSwapchainPresentModesCreateInfoEXT& safe_VkSwapchainPresentModesCreateInf
     return *this;
 }
 
+safe_VkSwapchainPresentModesCreateInfoEXT::safe_VkSwapchainPresentModesCreateInfoEXT(
+    safe_VkSwapchainPresentModesCreateInfoEXT&& move_src) noexcept
+    : safe_VkSwapchainPresentModesCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSwapchainPresentModesCreateInfoEXT& safe_VkSwapchainPresentModesCreateInfoEXT::operator=(
+    safe_VkSwapchainPresentModesCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentModeCount, move_src.presentModeCount);
+    std::swap(pPresentModes, move_src.pPresentModes);
+
+    return *this;
+}
+
 safe_VkSwapchainPresentModesCreateInfoEXT::~safe_VkSwapchainPresentModesCreateInfoEXT() {
     if (pPresentModes) delete[] pPresentModes;
     FreePnextChain(pNext);
@@ -7245,6 +9121,23 @@ safe_VkSwapchainPresentModeInfoEXT& safe_VkSwapchainPresentModeInfoEXT::operator
     return *this;
 }
 
+safe_VkSwapchainPresentModeInfoEXT::safe_VkSwapchainPresentModeInfoEXT(safe_VkSwapchainPresentModeInfoEXT&& move_src) noexcept
+    : safe_VkSwapchainPresentModeInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSwapchainPresentModeInfoEXT& safe_VkSwapchainPresentModeInfoEXT::operator=(
+    safe_VkSwapchainPresentModeInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(swapchainCount, move_src.swapchainCount);
+    std::swap(pPresentModes, move_src.pPresentModes);
+
+    return *this;
+}
+
 safe_VkSwapchainPresentModeInfoEXT::~safe_VkSwapchainPresentModeInfoEXT() {
     if (pPresentModes) delete[] pPresentModes;
     FreePnextChain(pNext);
@@ -7320,6 +9213,25 @@ safe_VkSwapchainPresentScalingCreateInfoEXT& safe_VkSwapchainPresentScalingCreat
     return *this;
 }
 
+safe_VkSwapchainPresentScalingCreateInfoEXT::safe_VkSwapchainPresentScalingCreateInfoEXT(
+    safe_VkSwapchainPresentScalingCreateInfoEXT&& move_src) noexcept
+    : safe_VkSwapchainPresentScalingCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSwapchainPresentScalingCreateInfoEXT& safe_VkSwapchainPresentScalingCreateInfoEXT::operator=(
+    safe_VkSwapchainPresentScalingCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(scalingBehavior, move_src.scalingBehavior);
+    std::swap(presentGravityX, move_src.presentGravityX);
+    std::swap(presentGravityY, move_src.presentGravityY);
+
+    return *this;
+}
+
 safe_VkSwapchainPresentScalingCreateInfoEXT::~safe_VkSwapchainPresentScalingCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkSwapchainPresentScalingCreateInfoEXT::initialize(const VkSwapchainPresentScalingCreateInfoEXT* in_struct,
@@ -7398,6 +9310,24 @@ safe_VkReleaseSwapchainImagesInfoEXT& safe_VkReleaseSwapchainImagesInfoEXT::oper
     return *this;
 }
 
+safe_VkReleaseSwapchainImagesInfoEXT::safe_VkReleaseSwapchainImagesInfoEXT(safe_VkReleaseSwapchainImagesInfoEXT&& move_src) noexcept
+    : safe_VkReleaseSwapchainImagesInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkReleaseSwapchainImagesInfoEXT& safe_VkReleaseSwapchainImagesInfoEXT::operator=(
+    safe_VkReleaseSwapchainImagesInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(swapchain, move_src.swapchain);
+    std::swap(imageIndexCount, move_src.imageIndexCount);
+    std::swap(pImageIndices, move_src.pImageIndices);
+
+    return *this;
+}
+
 safe_VkReleaseSwapchainImagesInfoEXT::~safe_VkReleaseSwapchainImagesInfoEXT() {
     if (pImageIndices) delete[] pImageIndices;
     FreePnextChain(pNext);
@@ -7464,6 +9394,23 @@ safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& safe_VkPhysicalDeviceTexel
     return *this;
 }
 
+safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT::safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT(
+    safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(texelBufferAlignment, move_src.texelBufferAlignment);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT::~safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -7529,6 +9476,26 @@ safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT& safe_VkPhysicalDeviceDepthBias
     return *this;
 }
 
+safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT::safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT(
+    safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT& safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(depthBiasControl, move_src.depthBiasControl);
+    std::swap(leastRepresentableValueForceUnormRepresentation, move_src.leastRepresentableValueForceUnormRepresentation);
+    std::swap(floatRepresentation, move_src.floatRepresentation);
+    std::swap(depthBiasExact, move_src.depthBiasExact);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT::~safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDepthBiasControlFeaturesEXT::initialize(const VkPhysicalDeviceDepthBiasControlFeaturesEXT* in_struct,
@@ -7592,6 +9559,22 @@ safe_VkDepthBiasInfoEXT& safe_VkDepthBiasInfoEXT::operator=(const safe_VkDepthBi
     return *this;
 }
 
+safe_VkDepthBiasInfoEXT::safe_VkDepthBiasInfoEXT(safe_VkDepthBiasInfoEXT&& move_src) noexcept : safe_VkDepthBiasInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDepthBiasInfoEXT& safe_VkDepthBiasInfoEXT::operator=(safe_VkDepthBiasInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(depthBiasConstantFactor, move_src.depthBiasConstantFactor);
+    std::swap(depthBiasClamp, move_src.depthBiasClamp);
+    std::swap(depthBiasSlopeFactor, move_src.depthBiasSlopeFactor);
+
+    return *this;
+}
+
 safe_VkDepthBiasInfoEXT::~safe_VkDepthBiasInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDepthBiasInfoEXT::initialize(const VkDepthBiasInfoEXT* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -7647,6 +9630,24 @@ safe_VkDepthBiasRepresentationInfoEXT& safe_VkDepthBiasRepresentationInfoEXT::op
     return *this;
 }
 
+safe_VkDepthBiasRepresentationInfoEXT::safe_VkDepthBiasRepresentationInfoEXT(
+    safe_VkDepthBiasRepresentationInfoEXT&& move_src) noexcept
+    : safe_VkDepthBiasRepresentationInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDepthBiasRepresentationInfoEXT& safe_VkDepthBiasRepresentationInfoEXT::operator=(
+    safe_VkDepthBiasRepresentationInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(depthBiasRepresentation, move_src.depthBiasRepresentation);
+    std::swap(depthBiasExact, move_src.depthBiasExact);
+
+    return *this;
+}
+
 safe_VkDepthBiasRepresentationInfoEXT::~safe_VkDepthBiasRepresentationInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDepthBiasRepresentationInfoEXT::initialize(const VkDepthBiasRepresentationInfoEXT* in_struct,
@@ -7697,6 +9698,23 @@ safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& safe_VkPhysicalDeviceDeviceM
     return *this;
 }
 
+safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT::safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT(
+    safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceMemoryReport, move_src.deviceMemoryReport);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT::~safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT::initialize(const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT* in_struct,
@@ -7772,6 +9790,29 @@ safe_VkDeviceMemoryReportCallbackDataEXT& safe_VkDeviceMemoryReportCallbackDataE
     return *this;
 }
 
+safe_VkDeviceMemoryReportCallbackDataEXT::safe_VkDeviceMemoryReportCallbackDataEXT(
+    safe_VkDeviceMemoryReportCallbackDataEXT&& move_src) noexcept
+    : safe_VkDeviceMemoryReportCallbackDataEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceMemoryReportCallbackDataEXT& safe_VkDeviceMemoryReportCallbackDataEXT::operator=(
+    safe_VkDeviceMemoryReportCallbackDataEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(type, move_src.type);
+    std::swap(memoryObjectId, move_src.memoryObjectId);
+    std::swap(size, move_src.size);
+    std::swap(objectType, move_src.objectType);
+    std::swap(objectHandle, move_src.objectHandle);
+    std::swap(heapIndex, move_src.heapIndex);
+
+    return *this;
+}
+
 safe_VkDeviceMemoryReportCallbackDataEXT::~safe_VkDeviceMemoryReportCallbackDataEXT() { FreePnextChain(pNext); }
 
 void safe_VkDeviceMemoryReportCallbackDataEXT::initialize(const VkDeviceMemoryReportCallbackDataEXT* in_struct,
@@ -7843,6 +9884,25 @@ safe_VkDeviceDeviceMemoryReportCreateInfoEXT& safe_VkDeviceDeviceMemoryReportCre
     return *this;
 }
 
+safe_VkDeviceDeviceMemoryReportCreateInfoEXT::safe_VkDeviceDeviceMemoryReportCreateInfoEXT(
+    safe_VkDeviceDeviceMemoryReportCreateInfoEXT&& move_src) noexcept
+    : safe_VkDeviceDeviceMemoryReportCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceDeviceMemoryReportCreateInfoEXT& safe_VkDeviceDeviceMemoryReportCreateInfoEXT::operator=(
+    safe_VkDeviceDeviceMemoryReportCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(pfnUserCallback, move_src.pfnUserCallback);
+    std::swap(pUserData, move_src.pUserData);
+
+    return *this;
+}
+
 safe_VkDeviceDeviceMemoryReportCreateInfoEXT::~safe_VkDeviceDeviceMemoryReportCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDeviceDeviceMemoryReportCreateInfoEXT::initialize(const VkDeviceDeviceMemoryReportCreateInfoEXT* in_struct,
@@ -7906,6 +9966,25 @@ safe_VkPhysicalDeviceRobustness2FeaturesEXT& safe_VkPhysicalDeviceRobustness2Fea
     return *this;
 }
 
+safe_VkPhysicalDeviceRobustness2FeaturesEXT::safe_VkPhysicalDeviceRobustness2FeaturesEXT(
+    safe_VkPhysicalDeviceRobustness2FeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceRobustness2FeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRobustness2FeaturesEXT& safe_VkPhysicalDeviceRobustness2FeaturesEXT::operator=(
+    safe_VkPhysicalDeviceRobustness2FeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(robustBufferAccess2, move_src.robustBufferAccess2);
+    std::swap(robustImageAccess2, move_src.robustImageAccess2);
+    std::swap(nullDescriptor, move_src.nullDescriptor);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRobustness2FeaturesEXT::~safe_VkPhysicalDeviceRobustness2FeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceRobustness2FeaturesEXT::initialize(const VkPhysicalDeviceRobustness2FeaturesEXT* in_struct,
@@ -7965,6 +10044,24 @@ safe_VkPhysicalDeviceRobustness2PropertiesEXT& safe_VkPhysicalDeviceRobustness2P
     return *this;
 }
 
+safe_VkPhysicalDeviceRobustness2PropertiesEXT::safe_VkPhysicalDeviceRobustness2PropertiesEXT(
+    safe_VkPhysicalDeviceRobustness2PropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceRobustness2PropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRobustness2PropertiesEXT& safe_VkPhysicalDeviceRobustness2PropertiesEXT::operator=(
+    safe_VkPhysicalDeviceRobustness2PropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(robustStorageBufferAccessSizeAlignment, move_src.robustStorageBufferAccessSizeAlignment);
+    std::swap(robustUniformBufferAccessSizeAlignment, move_src.robustUniformBufferAccessSizeAlignment);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRobustness2PropertiesEXT::~safe_VkPhysicalDeviceRobustness2PropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceRobustness2PropertiesEXT::initialize(const VkPhysicalDeviceRobustness2PropertiesEXT* in_struct,
@@ -8017,6 +10114,24 @@ safe_VkSamplerCustomBorderColorCreateInfoEXT& safe_VkSamplerCustomBorderColorCre
     return *this;
 }
 
+safe_VkSamplerCustomBorderColorCreateInfoEXT::safe_VkSamplerCustomBorderColorCreateInfoEXT(
+    safe_VkSamplerCustomBorderColorCreateInfoEXT&& move_src) noexcept
+    : safe_VkSamplerCustomBorderColorCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSamplerCustomBorderColorCreateInfoEXT& safe_VkSamplerCustomBorderColorCreateInfoEXT::operator=(
+    safe_VkSamplerCustomBorderColorCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(customBorderColor, move_src.customBorderColor);
+    std::swap(format, move_src.format);
+
+    return *this;
+}
+
 safe_VkSamplerCustomBorderColorCreateInfoEXT::~safe_VkSamplerCustomBorderColorCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkSamplerCustomBorderColorCreateInfoEXT::initialize(const VkSamplerCustomBorderColorCreateInfoEXT* in_struct,
@@ -8067,6 +10182,23 @@ safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT& safe_VkPhysicalDeviceCustom
     return *this;
 }
 
+safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT::safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT(
+    safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT& safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxCustomBorderColorSamplers, move_src.maxCustomBorderColorSamplers);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT::~safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -8124,6 +10256,24 @@ safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT& safe_VkPhysicalDeviceCustomBo
     return *this;
 }
 
+safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT::safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT(
+    safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT& safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(customBorderColors, move_src.customBorderColors);
+    std::swap(customBorderColorWithoutFormat, move_src.customBorderColorWithoutFormat);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT::~safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT::initialize(const VkPhysicalDeviceCustomBorderColorFeaturesEXT* in_struct,
@@ -8176,6 +10326,23 @@ safe_VkExportMetalObjectCreateInfoEXT& safe_VkExportMetalObjectCreateInfoEXT::op
     return *this;
 }
 
+safe_VkExportMetalObjectCreateInfoEXT::safe_VkExportMetalObjectCreateInfoEXT(
+    safe_VkExportMetalObjectCreateInfoEXT&& move_src) noexcept
+    : safe_VkExportMetalObjectCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMetalObjectCreateInfoEXT& safe_VkExportMetalObjectCreateInfoEXT::operator=(
+    safe_VkExportMetalObjectCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(exportObjectType, move_src.exportObjectType);
+
+    return *this;
+}
+
 safe_VkExportMetalObjectCreateInfoEXT::~safe_VkExportMetalObjectCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkExportMetalObjectCreateInfoEXT::initialize(const VkExportMetalObjectCreateInfoEXT* in_struct,
@@ -8220,6 +10387,21 @@ safe_VkExportMetalObjectsInfoEXT& safe_VkExportMetalObjectsInfoEXT::operator=(co
     return *this;
 }
 
+safe_VkExportMetalObjectsInfoEXT::safe_VkExportMetalObjectsInfoEXT(safe_VkExportMetalObjectsInfoEXT&& move_src) noexcept
+    : safe_VkExportMetalObjectsInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMetalObjectsInfoEXT& safe_VkExportMetalObjectsInfoEXT::operator=(
+    safe_VkExportMetalObjectsInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+
+    return *this;
+}
+
 safe_VkExportMetalObjectsInfoEXT::~safe_VkExportMetalObjectsInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkExportMetalObjectsInfoEXT::initialize(const VkExportMetalObjectsInfoEXT* in_struct,
@@ -8264,6 +10446,21 @@ safe_VkExportMetalDeviceInfoEXT& safe_VkExportMetalDeviceInfoEXT::operator=(cons
     return *this;
 }
 
+safe_VkExportMetalDeviceInfoEXT::safe_VkExportMetalDeviceInfoEXT(safe_VkExportMetalDeviceInfoEXT&& move_src) noexcept
+    : safe_VkExportMetalDeviceInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMetalDeviceInfoEXT& safe_VkExportMetalDeviceInfoEXT::operator=(safe_VkExportMetalDeviceInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(mtlDevice, move_src.mtlDevice);
+
+    return *this;
+}
+
 safe_VkExportMetalDeviceInfoEXT::~safe_VkExportMetalDeviceInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkExportMetalDeviceInfoEXT::initialize(const VkExportMetalDeviceInfoEXT* in_struct,
@@ -8315,6 +10512,24 @@ safe_VkExportMetalCommandQueueInfoEXT& safe_VkExportMetalCommandQueueInfoEXT::op
     return *this;
 }
 
+safe_VkExportMetalCommandQueueInfoEXT::safe_VkExportMetalCommandQueueInfoEXT(
+    safe_VkExportMetalCommandQueueInfoEXT&& move_src) noexcept
+    : safe_VkExportMetalCommandQueueInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMetalCommandQueueInfoEXT& safe_VkExportMetalCommandQueueInfoEXT::operator=(
+    safe_VkExportMetalCommandQueueInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(queue, move_src.queue);
+    std::swap(mtlCommandQueue, move_src.mtlCommandQueue);
+
+    return *this;
+}
+
 safe_VkExportMetalCommandQueueInfoEXT::~safe_VkExportMetalCommandQueueInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkExportMetalCommandQueueInfoEXT::initialize(const VkExportMetalCommandQueueInfoEXT* in_struct,
@@ -8365,6 +10580,22 @@ safe_VkExportMetalBufferInfoEXT& safe_VkExportMetalBufferInfoEXT::operator=(cons
     return *this;
 }
 
+safe_VkExportMetalBufferInfoEXT::safe_VkExportMetalBufferInfoEXT(safe_VkExportMetalBufferInfoEXT&& move_src) noexcept
+    : safe_VkExportMetalBufferInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMetalBufferInfoEXT& safe_VkExportMetalBufferInfoEXT::operator=(safe_VkExportMetalBufferInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memory, move_src.memory);
+    std::swap(mtlBuffer, move_src.mtlBuffer);
+
+    return *this;
+}
+
 safe_VkExportMetalBufferInfoEXT::~safe_VkExportMetalBufferInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkExportMetalBufferInfoEXT::initialize(const VkExportMetalBufferInfoEXT* in_struct,
@@ -8413,6 +10644,21 @@ safe_VkImportMetalBufferInfoEXT& safe_VkImportMetalBufferInfoEXT::operator=(cons
     return *this;
 }
 
+safe_VkImportMetalBufferInfoEXT::safe_VkImportMetalBufferInfoEXT(safe_VkImportMetalBufferInfoEXT&& move_src) noexcept
+    : safe_VkImportMetalBufferInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportMetalBufferInfoEXT& safe_VkImportMetalBufferInfoEXT::operator=(safe_VkImportMetalBufferInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(mtlBuffer, move_src.mtlBuffer);
+
+    return *this;
+}
+
 safe_VkImportMetalBufferInfoEXT::~safe_VkImportMetalBufferInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkImportMetalBufferInfoEXT::initialize(const VkImportMetalBufferInfoEXT* in_struct,
@@ -8478,6 +10724,26 @@ safe_VkExportMetalTextureInfoEXT& safe_VkExportMetalTextureInfoEXT::operator=(co
     return *this;
 }
 
+safe_VkExportMetalTextureInfoEXT::safe_VkExportMetalTextureInfoEXT(safe_VkExportMetalTextureInfoEXT&& move_src) noexcept
+    : safe_VkExportMetalTextureInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMetalTextureInfoEXT& safe_VkExportMetalTextureInfoEXT::operator=(
+    safe_VkExportMetalTextureInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(image, move_src.image);
+    std::swap(imageView, move_src.imageView);
+    std::swap(bufferView, move_src.bufferView);
+    std::swap(plane, move_src.plane);
+    std::swap(mtlTexture, move_src.mtlTexture);
+
+    return *this;
+}
+
 safe_VkExportMetalTextureInfoEXT::~safe_VkExportMetalTextureInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkExportMetalTextureInfoEXT::initialize(const VkExportMetalTextureInfoEXT* in_struct,
@@ -8534,6 +10800,23 @@ safe_VkImportMetalTextureInfoEXT& safe_VkImportMetalTextureInfoEXT::operator=(co
     return *this;
 }
 
+safe_VkImportMetalTextureInfoEXT::safe_VkImportMetalTextureInfoEXT(safe_VkImportMetalTextureInfoEXT&& move_src) noexcept
+    : safe_VkImportMetalTextureInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportMetalTextureInfoEXT& safe_VkImportMetalTextureInfoEXT::operator=(
+    safe_VkImportMetalTextureInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(plane, move_src.plane);
+    std::swap(mtlTexture, move_src.mtlTexture);
+
+    return *this;
+}
+
 safe_VkImportMetalTextureInfoEXT::~safe_VkImportMetalTextureInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkImportMetalTextureInfoEXT::initialize(const VkImportMetalTextureInfoEXT* in_struct,
@@ -8585,6 +10868,23 @@ safe_VkExportMetalIOSurfaceInfoEXT& safe_VkExportMetalIOSurfaceInfoEXT::operator
     return *this;
 }
 
+safe_VkExportMetalIOSurfaceInfoEXT::safe_VkExportMetalIOSurfaceInfoEXT(safe_VkExportMetalIOSurfaceInfoEXT&& move_src) noexcept
+    : safe_VkExportMetalIOSurfaceInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMetalIOSurfaceInfoEXT& safe_VkExportMetalIOSurfaceInfoEXT::operator=(
+    safe_VkExportMetalIOSurfaceInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(image, move_src.image);
+    std::swap(ioSurface, move_src.ioSurface);
+
+    return *this;
+}
+
 safe_VkExportMetalIOSurfaceInfoEXT::~safe_VkExportMetalIOSurfaceInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkExportMetalIOSurfaceInfoEXT::initialize(const VkExportMetalIOSurfaceInfoEXT* in_struct,
@@ -8634,6 +10934,22 @@ safe_VkImportMetalIOSurfaceInfoEXT& safe_VkImportMetalIOSurfaceInfoEXT::operator
     return *this;
 }
 
+safe_VkImportMetalIOSurfaceInfoEXT::safe_VkImportMetalIOSurfaceInfoEXT(safe_VkImportMetalIOSurfaceInfoEXT&& move_src) noexcept
+    : safe_VkImportMetalIOSurfaceInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportMetalIOSurfaceInfoEXT& safe_VkImportMetalIOSurfaceInfoEXT::operator=(
+    safe_VkImportMetalIOSurfaceInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(ioSurface, move_src.ioSurface);
+
+    return *this;
+}
+
 safe_VkImportMetalIOSurfaceInfoEXT::~safe_VkImportMetalIOSurfaceInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkImportMetalIOSurfaceInfoEXT::initialize(const VkImportMetalIOSurfaceInfoEXT* in_struct,
@@ -8686,6 +11002,24 @@ safe_VkExportMetalSharedEventInfoEXT& safe_VkExportMetalSharedEventInfoEXT::oper
     return *this;
 }
 
+safe_VkExportMetalSharedEventInfoEXT::safe_VkExportMetalSharedEventInfoEXT(safe_VkExportMetalSharedEventInfoEXT&& move_src) noexcept
+    : safe_VkExportMetalSharedEventInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMetalSharedEventInfoEXT& safe_VkExportMetalSharedEventInfoEXT::operator=(
+    safe_VkExportMetalSharedEventInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(semaphore, move_src.semaphore);
+    std::swap(event, move_src.event);
+    std::swap(mtlSharedEvent, move_src.mtlSharedEvent);
+
+    return *this;
+}
+
 safe_VkExportMetalSharedEventInfoEXT::~safe_VkExportMetalSharedEventInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkExportMetalSharedEventInfoEXT::initialize(const VkExportMetalSharedEventInfoEXT* in_struct,
@@ -8738,6 +11072,22 @@ safe_VkImportMetalSharedEventInfoEXT& safe_VkImportMetalSharedEventInfoEXT::oper
     return *this;
 }
 
+safe_VkImportMetalSharedEventInfoEXT::safe_VkImportMetalSharedEventInfoEXT(safe_VkImportMetalSharedEventInfoEXT&& move_src) noexcept
+    : safe_VkImportMetalSharedEventInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportMetalSharedEventInfoEXT& safe_VkImportMetalSharedEventInfoEXT::operator=(
+    safe_VkImportMetalSharedEventInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(mtlSharedEvent, move_src.mtlSharedEvent);
+
+    return *this;
+}
+
 safe_VkImportMetalSharedEventInfoEXT::~safe_VkImportMetalSharedEventInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkImportMetalSharedEventInfoEXT::initialize(const VkImportMetalSharedEventInfoEXT* in_struct,
@@ -8918,6 +11268,55 @@ safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT& safe_VkPhysicalDeviceDescrip
     return *this;
 }
 
+safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT::safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT(
+    safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT& safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(combinedImageSamplerDescriptorSingleArray, move_src.combinedImageSamplerDescriptorSingleArray);
+    std::swap(bufferlessPushDescriptors, move_src.bufferlessPushDescriptors);
+    std::swap(allowSamplerImageViewPostSubmitCreation, move_src.allowSamplerImageViewPostSubmitCreation);
+    std::swap(descriptorBufferOffsetAlignment, move_src.descriptorBufferOffsetAlignment);
+    std::swap(maxDescriptorBufferBindings, move_src.maxDescriptorBufferBindings);
+    std::swap(maxResourceDescriptorBufferBindings, move_src.maxResourceDescriptorBufferBindings);
+    std::swap(maxSamplerDescriptorBufferBindings, move_src.maxSamplerDescriptorBufferBindings);
+    std::swap(maxEmbeddedImmutableSamplerBindings, move_src.maxEmbeddedImmutableSamplerBindings);
+    std::swap(maxEmbeddedImmutableSamplers, move_src.maxEmbeddedImmutableSamplers);
+    std::swap(bufferCaptureReplayDescriptorDataSize, move_src.bufferCaptureReplayDescriptorDataSize);
+    std::swap(imageCaptureReplayDescriptorDataSize, move_src.imageCaptureReplayDescriptorDataSize);
+    std::swap(imageViewCaptureReplayDescriptorDataSize, move_src.imageViewCaptureReplayDescriptorDataSize);
+    std::swap(samplerCaptureReplayDescriptorDataSize, move_src.samplerCaptureReplayDescriptorDataSize);
+    std::swap(accelerationStructureCaptureReplayDescriptorDataSize, move_src.accelerationStructureCaptureReplayDescriptorDataSize);
+    std::swap(samplerDescriptorSize, move_src.samplerDescriptorSize);
+    std::swap(combinedImageSamplerDescriptorSize, move_src.combinedImageSamplerDescriptorSize);
+    std::swap(sampledImageDescriptorSize, move_src.sampledImageDescriptorSize);
+    std::swap(storageImageDescriptorSize, move_src.storageImageDescriptorSize);
+    std::swap(uniformTexelBufferDescriptorSize, move_src.uniformTexelBufferDescriptorSize);
+    std::swap(robustUniformTexelBufferDescriptorSize, move_src.robustUniformTexelBufferDescriptorSize);
+    std::swap(storageTexelBufferDescriptorSize, move_src.storageTexelBufferDescriptorSize);
+    std::swap(robustStorageTexelBufferDescriptorSize, move_src.robustStorageTexelBufferDescriptorSize);
+    std::swap(uniformBufferDescriptorSize, move_src.uniformBufferDescriptorSize);
+    std::swap(robustUniformBufferDescriptorSize, move_src.robustUniformBufferDescriptorSize);
+    std::swap(storageBufferDescriptorSize, move_src.storageBufferDescriptorSize);
+    std::swap(robustStorageBufferDescriptorSize, move_src.robustStorageBufferDescriptorSize);
+    std::swap(inputAttachmentDescriptorSize, move_src.inputAttachmentDescriptorSize);
+    std::swap(accelerationStructureDescriptorSize, move_src.accelerationStructureDescriptorSize);
+    std::swap(maxSamplerDescriptorBufferRange, move_src.maxSamplerDescriptorBufferRange);
+    std::swap(maxResourceDescriptorBufferRange, move_src.maxResourceDescriptorBufferRange);
+    std::swap(samplerDescriptorBufferAddressSpaceSize, move_src.samplerDescriptorBufferAddressSpaceSize);
+    std::swap(resourceDescriptorBufferAddressSpaceSize, move_src.resourceDescriptorBufferAddressSpaceSize);
+    std::swap(descriptorBufferAddressSpaceSize, move_src.descriptorBufferAddressSpaceSize);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT::~safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDescriptorBufferPropertiesEXT::initialize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT* in_struct,
@@ -9035,6 +11434,24 @@ safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT::safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT(
+    safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT&
+safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(combinedImageSamplerDensityMapDescriptorSize, move_src.combinedImageSamplerDensityMapDescriptorSize);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT::~safe_VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -9100,6 +11517,26 @@ safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT& safe_VkPhysicalDeviceDescripto
     return *this;
 }
 
+safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT::safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT(
+    safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT& safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(descriptorBuffer, move_src.descriptorBuffer);
+    std::swap(descriptorBufferCaptureReplay, move_src.descriptorBufferCaptureReplay);
+    std::swap(descriptorBufferImageLayoutIgnored, move_src.descriptorBufferImageLayoutIgnored);
+    std::swap(descriptorBufferPushDescriptors, move_src.descriptorBufferPushDescriptors);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT::~safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDescriptorBufferFeaturesEXT::initialize(const VkPhysicalDeviceDescriptorBufferFeaturesEXT* in_struct,
@@ -9156,6 +11593,23 @@ safe_VkDescriptorAddressInfoEXT& safe_VkDescriptorAddressInfoEXT::operator=(cons
     return *this;
 }
 
+safe_VkDescriptorAddressInfoEXT::safe_VkDescriptorAddressInfoEXT(safe_VkDescriptorAddressInfoEXT&& move_src) noexcept
+    : safe_VkDescriptorAddressInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorAddressInfoEXT& safe_VkDescriptorAddressInfoEXT::operator=(safe_VkDescriptorAddressInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(address, move_src.address);
+    std::swap(range, move_src.range);
+    std::swap(format, move_src.format);
+
+    return *this;
+}
+
 safe_VkDescriptorAddressInfoEXT::~safe_VkDescriptorAddressInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDescriptorAddressInfoEXT::initialize(const VkDescriptorAddressInfoEXT* in_struct,
@@ -9211,6 +11665,24 @@ safe_VkDescriptorBufferBindingInfoEXT& safe_VkDescriptorBufferBindingInfoEXT::op
     return *this;
 }
 
+safe_VkDescriptorBufferBindingInfoEXT::safe_VkDescriptorBufferBindingInfoEXT(
+    safe_VkDescriptorBufferBindingInfoEXT&& move_src) noexcept
+    : safe_VkDescriptorBufferBindingInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorBufferBindingInfoEXT& safe_VkDescriptorBufferBindingInfoEXT::operator=(
+    safe_VkDescriptorBufferBindingInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(address, move_src.address);
+    std::swap(usage, move_src.usage);
+
+    return *this;
+}
+
 safe_VkDescriptorBufferBindingInfoEXT::~safe_VkDescriptorBufferBindingInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDescriptorBufferBindingInfoEXT::initialize(const VkDescriptorBufferBindingInfoEXT* in_struct,
@@ -9262,6 +11734,23 @@ safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& safe_VkDescriptorBu
     return *this;
 }
 
+safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT::safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT(
+    safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT&& move_src) noexcept
+    : safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT::operator=(
+    safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(buffer, move_src.buffer);
+
+    return *this;
+}
+
 safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT::~safe_VkDescriptorBufferBindingPushDescriptorBufferHandleEXT() {
     FreePnextChain(pNext);
 }
@@ -9792,6 +12281,22 @@ safe_VkDescriptorGetInfoEXT& safe_VkDescriptorGetInfoEXT::operator=(const safe_V
     return *this;
 }
 
+safe_VkDescriptorGetInfoEXT::safe_VkDescriptorGetInfoEXT(safe_VkDescriptorGetInfoEXT&& move_src) noexcept
+    : safe_VkDescriptorGetInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorGetInfoEXT& safe_VkDescriptorGetInfoEXT::operator=(safe_VkDescriptorGetInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(type, move_src.type);
+    std::swap(data, move_src.data);
+
+    return *this;
+}
+
 safe_VkDescriptorGetInfoEXT::~safe_VkDescriptorGetInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkDescriptorGetInfoEXT::initialize(const VkDescriptorGetInfoEXT* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -9841,6 +12346,23 @@ safe_VkBufferCaptureDescriptorDataInfoEXT& safe_VkBufferCaptureDescriptorDataInf
     return *this;
 }
 
+safe_VkBufferCaptureDescriptorDataInfoEXT::safe_VkBufferCaptureDescriptorDataInfoEXT(
+    safe_VkBufferCaptureDescriptorDataInfoEXT&& move_src) noexcept
+    : safe_VkBufferCaptureDescriptorDataInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferCaptureDescriptorDataInfoEXT& safe_VkBufferCaptureDescriptorDataInfoEXT::operator=(
+    safe_VkBufferCaptureDescriptorDataInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(buffer, move_src.buffer);
+
+    return *this;
+}
+
 safe_VkBufferCaptureDescriptorDataInfoEXT::~safe_VkBufferCaptureDescriptorDataInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkBufferCaptureDescriptorDataInfoEXT::initialize(const VkBufferCaptureDescriptorDataInfoEXT* in_struct,
@@ -9889,6 +12411,23 @@ safe_VkImageCaptureDescriptorDataInfoEXT& safe_VkImageCaptureDescriptorDataInfoE
     return *this;
 }
 
+safe_VkImageCaptureDescriptorDataInfoEXT::safe_VkImageCaptureDescriptorDataInfoEXT(
+    safe_VkImageCaptureDescriptorDataInfoEXT&& move_src) noexcept
+    : safe_VkImageCaptureDescriptorDataInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageCaptureDescriptorDataInfoEXT& safe_VkImageCaptureDescriptorDataInfoEXT::operator=(
+    safe_VkImageCaptureDescriptorDataInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(image, move_src.image);
+
+    return *this;
+}
+
 safe_VkImageCaptureDescriptorDataInfoEXT::~safe_VkImageCaptureDescriptorDataInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkImageCaptureDescriptorDataInfoEXT::initialize(const VkImageCaptureDescriptorDataInfoEXT* in_struct,
@@ -9937,6 +12476,23 @@ safe_VkImageViewCaptureDescriptorDataInfoEXT& safe_VkImageViewCaptureDescriptorD
     return *this;
 }
 
+safe_VkImageViewCaptureDescriptorDataInfoEXT::safe_VkImageViewCaptureDescriptorDataInfoEXT(
+    safe_VkImageViewCaptureDescriptorDataInfoEXT&& move_src) noexcept
+    : safe_VkImageViewCaptureDescriptorDataInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageViewCaptureDescriptorDataInfoEXT& safe_VkImageViewCaptureDescriptorDataInfoEXT::operator=(
+    safe_VkImageViewCaptureDescriptorDataInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageView, move_src.imageView);
+
+    return *this;
+}
+
 safe_VkImageViewCaptureDescriptorDataInfoEXT::~safe_VkImageViewCaptureDescriptorDataInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkImageViewCaptureDescriptorDataInfoEXT::initialize(const VkImageViewCaptureDescriptorDataInfoEXT* in_struct,
@@ -9985,6 +12541,23 @@ safe_VkSamplerCaptureDescriptorDataInfoEXT& safe_VkSamplerCaptureDescriptorDataI
     return *this;
 }
 
+safe_VkSamplerCaptureDescriptorDataInfoEXT::safe_VkSamplerCaptureDescriptorDataInfoEXT(
+    safe_VkSamplerCaptureDescriptorDataInfoEXT&& move_src) noexcept
+    : safe_VkSamplerCaptureDescriptorDataInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSamplerCaptureDescriptorDataInfoEXT& safe_VkSamplerCaptureDescriptorDataInfoEXT::operator=(
+    safe_VkSamplerCaptureDescriptorDataInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(sampler, move_src.sampler);
+
+    return *this;
+}
+
 safe_VkSamplerCaptureDescriptorDataInfoEXT::~safe_VkSamplerCaptureDescriptorDataInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkSamplerCaptureDescriptorDataInfoEXT::initialize(const VkSamplerCaptureDescriptorDataInfoEXT* in_struct,
@@ -10035,6 +12608,23 @@ safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT& safe_VkOpaqueCaptureDescriptorD
     return *this;
 }
 
+safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT::safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT(
+    safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT&& move_src) noexcept
+    : safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT& safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT::operator=(
+    safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(opaqueCaptureDescriptorData, move_src.opaqueCaptureDescriptorData);
+
+    return *this;
+}
+
 safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT::~safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkOpaqueCaptureDescriptorDataCreateInfoEXT::initialize(const VkOpaqueCaptureDescriptorDataCreateInfoEXT* in_struct,
@@ -10091,6 +12681,24 @@ safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT& safe_VkAccelerationStr
     return *this;
 }
 
+safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT::safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT(
+    safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT&& move_src) noexcept
+    : safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT& safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT::operator=(
+    safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(accelerationStructure, move_src.accelerationStructure);
+    std::swap(accelerationStructureNV, move_src.accelerationStructureNV);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT::~safe_VkAccelerationStructureCaptureDescriptorDataInfoEXT() {
     FreePnextChain(pNext);
 }
@@ -10144,6 +12752,23 @@ safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& safe_VkPhysicalDeviceGr
     return *this;
 }
 
+safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT::safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT(
+    safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(graphicsPipelineLibrary, move_src.graphicsPipelineLibrary);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT::~safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -10203,6 +12828,25 @@ safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& safe_VkPhysicalDevice
     return *this;
 }
 
+safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT::safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT(
+    safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(graphicsPipelineLibraryFastLinking, move_src.graphicsPipelineLibraryFastLinking);
+    std::swap(graphicsPipelineLibraryIndependentInterpolationDecoration,
+              move_src.graphicsPipelineLibraryIndependentInterpolationDecoration);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT::~safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -10256,6 +12900,23 @@ safe_VkGraphicsPipelineLibraryCreateInfoEXT& safe_VkGraphicsPipelineLibraryCreat
     return *this;
 }
 
+safe_VkGraphicsPipelineLibraryCreateInfoEXT::safe_VkGraphicsPipelineLibraryCreateInfoEXT(
+    safe_VkGraphicsPipelineLibraryCreateInfoEXT&& move_src) noexcept
+    : safe_VkGraphicsPipelineLibraryCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkGraphicsPipelineLibraryCreateInfoEXT& safe_VkGraphicsPipelineLibraryCreateInfoEXT::operator=(
+    safe_VkGraphicsPipelineLibraryCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkGraphicsPipelineLibraryCreateInfoEXT::~safe_VkGraphicsPipelineLibraryCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkGraphicsPipelineLibraryCreateInfoEXT::initialize(const VkGraphicsPipelineLibraryCreateInfoEXT* in_struct,
@@ -10304,6 +12965,23 @@ safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& safe_VkPhysicalDeviceYcbc
     return *this;
 }
 
+safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT::safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT(
+    safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(ycbcr2plane444Formats, move_src.ycbcr2plane444Formats);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT::~safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -10354,6 +13032,23 @@ safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& safe_VkPhysicalDeviceFragme
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT::safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT(
+    safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT::operator=(
+    safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fragmentDensityMapDeferred, move_src.fragmentDensityMapDeferred);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT::~safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -10419,6 +13114,26 @@ safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& safe_VkPhysicalDeviceFrag
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT::safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT(
+    safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT::operator=(
+    safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(subsampledLoads, move_src.subsampledLoads);
+    std::swap(subsampledCoarseReconstructionEarlyAccess, move_src.subsampledCoarseReconstructionEarlyAccess);
+    std::swap(maxSubsampledArrayLayers, move_src.maxSubsampledArrayLayers);
+    std::swap(maxDescriptorSetSubsampledSamplers, move_src.maxDescriptorSetSubsampledSamplers);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT::~safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -10476,6 +13191,23 @@ safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT& safe_VkPhysicalDeviceIm
     return *this;
 }
 
+safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT::safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT(
+    safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT& safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageCompressionControl, move_src.imageCompressionControl);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT::~safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -10553,6 +13285,24 @@ safe_VkImageCompressionControlEXT& safe_VkImageCompressionControlEXT::operator=(
     return *this;
 }
 
+safe_VkImageCompressionControlEXT::safe_VkImageCompressionControlEXT(safe_VkImageCompressionControlEXT&& move_src) noexcept
+    : safe_VkImageCompressionControlEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageCompressionControlEXT& safe_VkImageCompressionControlEXT::operator=(
+    safe_VkImageCompressionControlEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(compressionControlPlaneCount, move_src.compressionControlPlaneCount);
+    std::swap(pFixedRateFlags, move_src.pFixedRateFlags);
+
+    return *this;
+}
+
 safe_VkImageCompressionControlEXT::~safe_VkImageCompressionControlEXT() {
     if (pFixedRateFlags) delete[] pFixedRateFlags;
     FreePnextChain(pNext);
@@ -10628,6 +13378,23 @@ safe_VkImageCompressionPropertiesEXT& safe_VkImageCompressionPropertiesEXT::oper
     return *this;
 }
 
+safe_VkImageCompressionPropertiesEXT::safe_VkImageCompressionPropertiesEXT(safe_VkImageCompressionPropertiesEXT&& move_src) noexcept
+    : safe_VkImageCompressionPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageCompressionPropertiesEXT& safe_VkImageCompressionPropertiesEXT::operator=(
+    safe_VkImageCompressionPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageCompressionFlags, move_src.imageCompressionFlags);
+    std::swap(imageCompressionFixedRateFlags, move_src.imageCompressionFixedRateFlags);
+
+    return *this;
+}
+
 safe_VkImageCompressionPropertiesEXT::~safe_VkImageCompressionPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkImageCompressionPropertiesEXT::initialize(const VkImageCompressionPropertiesEXT* in_struct,
@@ -10682,6 +13449,24 @@ safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT::safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT(
+    safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT&
+safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(attachmentFeedbackLoopLayout, move_src.attachmentFeedbackLoopLayout);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT::~safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -10734,6 +13519,24 @@ safe_VkPhysicalDevice4444FormatsFeaturesEXT& safe_VkPhysicalDevice4444FormatsFea
     return *this;
 }
 
+safe_VkPhysicalDevice4444FormatsFeaturesEXT::safe_VkPhysicalDevice4444FormatsFeaturesEXT(
+    safe_VkPhysicalDevice4444FormatsFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDevice4444FormatsFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevice4444FormatsFeaturesEXT& safe_VkPhysicalDevice4444FormatsFeaturesEXT::operator=(
+    safe_VkPhysicalDevice4444FormatsFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(formatA4R4G4B4, move_src.formatA4R4G4B4);
+    std::swap(formatA4B4G4R4, move_src.formatA4B4G4R4);
+
+    return *this;
+}
+
 safe_VkPhysicalDevice4444FormatsFeaturesEXT::~safe_VkPhysicalDevice4444FormatsFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevice4444FormatsFeaturesEXT::initialize(const VkPhysicalDevice4444FormatsFeaturesEXT* in_struct,
@@ -10787,6 +13590,24 @@ safe_VkPhysicalDeviceFaultFeaturesEXT& safe_VkPhysicalDeviceFaultFeaturesEXT::op
     return *this;
 }
 
+safe_VkPhysicalDeviceFaultFeaturesEXT::safe_VkPhysicalDeviceFaultFeaturesEXT(
+    safe_VkPhysicalDeviceFaultFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceFaultFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFaultFeaturesEXT& safe_VkPhysicalDeviceFaultFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceFaultFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceFault, move_src.deviceFault);
+    std::swap(deviceFaultVendorBinary, move_src.deviceFaultVendorBinary);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFaultFeaturesEXT::~safe_VkPhysicalDeviceFaultFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceFaultFeaturesEXT::initialize(const VkPhysicalDeviceFaultFeaturesEXT* in_struct,
@@ -10842,6 +13663,23 @@ safe_VkDeviceFaultCountsEXT& safe_VkDeviceFaultCountsEXT::operator=(const safe_V
     return *this;
 }
 
+safe_VkDeviceFaultCountsEXT::safe_VkDeviceFaultCountsEXT(safe_VkDeviceFaultCountsEXT&& move_src) noexcept
+    : safe_VkDeviceFaultCountsEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceFaultCountsEXT& safe_VkDeviceFaultCountsEXT::operator=(safe_VkDeviceFaultCountsEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(addressInfoCount, move_src.addressInfoCount);
+    std::swap(vendorInfoCount, move_src.vendorInfoCount);
+    std::swap(vendorBinarySize, move_src.vendorBinarySize);
+
+    return *this;
+}
+
 safe_VkDeviceFaultCountsEXT::~safe_VkDeviceFaultCountsEXT() { FreePnextChain(pNext); }
 
 void safe_VkDeviceFaultCountsEXT::initialize(const VkDeviceFaultCountsEXT* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -10936,6 +13774,23 @@ safe_VkDeviceFaultInfoEXT& safe_VkDeviceFaultInfoEXT::operator=(const safe_VkDev
     return *this;
 }
 
+safe_VkDeviceFaultInfoEXT::safe_VkDeviceFaultInfoEXT(safe_VkDeviceFaultInfoEXT&& move_src) noexcept : safe_VkDeviceFaultInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceFaultInfoEXT& safe_VkDeviceFaultInfoEXT::operator=(safe_VkDeviceFaultInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(description, move_src.description);
+    std::swap(pAddressInfos, move_src.pAddressInfos);
+    std::swap(pVendorInfos, move_src.pVendorInfos);
+    std::swap(pVendorBinaryData, move_src.pVendorBinaryData);
+
+    return *this;
+}
+
 safe_VkDeviceFaultInfoEXT::~safe_VkDeviceFaultInfoEXT() {
     if (pAddressInfos) delete pAddressInfos;
     if (pVendorInfos) delete pVendorInfos;
@@ -11032,6 +13887,26 @@ safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT::safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT(
+    safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT&
+safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(rasterizationOrderColorAttachmentAccess, move_src.rasterizationOrderColorAttachmentAccess);
+    std::swap(rasterizationOrderDepthAttachmentAccess, move_src.rasterizationOrderDepthAttachmentAccess);
+    std::swap(rasterizationOrderStencilAttachmentAccess, move_src.rasterizationOrderStencilAttachmentAccess);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT::
     ~safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT() {
     FreePnextChain(pNext);
@@ -11088,6 +13963,23 @@ safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& safe_VkPhysicalDeviceRGBA10X6Fo
     return *this;
 }
 
+safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT::safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT(
+    safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(formatRgba10x6WithoutYCbCrSampler, move_src.formatRgba10x6WithoutYCbCrSampler);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT::~safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT::initialize(const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT* in_struct,
@@ -11166,6 +14058,24 @@ safe_VkDirectFBSurfaceCreateInfoEXT& safe_VkDirectFBSurfaceCreateInfoEXT::operat
     return *this;
 }
 
+safe_VkDirectFBSurfaceCreateInfoEXT::safe_VkDirectFBSurfaceCreateInfoEXT(safe_VkDirectFBSurfaceCreateInfoEXT&& move_src) noexcept
+    : safe_VkDirectFBSurfaceCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDirectFBSurfaceCreateInfoEXT& safe_VkDirectFBSurfaceCreateInfoEXT::operator=(
+    safe_VkDirectFBSurfaceCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(dfb, move_src.dfb);
+    std::swap(surface, move_src.surface);
+
+    return *this;
+}
+
 safe_VkDirectFBSurfaceCreateInfoEXT::~safe_VkDirectFBSurfaceCreateInfoEXT() {
     if (dfb) delete dfb;
     if (surface) delete surface;
@@ -11241,6 +14151,23 @@ safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& safe_VkPhysicalDeviceMuta
     return *this;
 }
 
+safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT::safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT(
+    safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(mutableDescriptorType, move_src.mutableDescriptorType);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT::~safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -11299,6 +14226,21 @@ safe_VkMutableDescriptorTypeListEXT& safe_VkMutableDescriptorTypeListEXT::operat
     return *this;
 }
 
+safe_VkMutableDescriptorTypeListEXT::safe_VkMutableDescriptorTypeListEXT(safe_VkMutableDescriptorTypeListEXT&& move_src) noexcept
+    : safe_VkMutableDescriptorTypeListEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkMutableDescriptorTypeListEXT& safe_VkMutableDescriptorTypeListEXT::operator=(
+    safe_VkMutableDescriptorTypeListEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(descriptorTypeCount, move_src.descriptorTypeCount);
+    std::swap(pDescriptorTypes, move_src.pDescriptorTypes);
+
+    return *this;
+}
+
 safe_VkMutableDescriptorTypeListEXT::~safe_VkMutableDescriptorTypeListEXT() {
     if (pDescriptorTypes) delete[] pDescriptorTypes;
 }
@@ -11385,6 +14327,24 @@ safe_VkMutableDescriptorTypeCreateInfoEXT& safe_VkMutableDescriptorTypeCreateInf
     return *this;
 }
 
+safe_VkMutableDescriptorTypeCreateInfoEXT::safe_VkMutableDescriptorTypeCreateInfoEXT(
+    safe_VkMutableDescriptorTypeCreateInfoEXT&& move_src) noexcept
+    : safe_VkMutableDescriptorTypeCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkMutableDescriptorTypeCreateInfoEXT& safe_VkMutableDescriptorTypeCreateInfoEXT::operator=(
+    safe_VkMutableDescriptorTypeCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(mutableDescriptorTypeListCount, move_src.mutableDescriptorTypeListCount);
+    std::swap(pMutableDescriptorTypeLists, move_src.pMutableDescriptorTypeLists);
+
+    return *this;
+}
+
 safe_VkMutableDescriptorTypeCreateInfoEXT::~safe_VkMutableDescriptorTypeCreateInfoEXT() {
     if (pMutableDescriptorTypeLists) delete[] pMutableDescriptorTypeLists;
     FreePnextChain(pNext);
@@ -11452,6 +14412,23 @@ safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& safe_VkPhysicalDeviceVe
     return *this;
 }
 
+safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT::safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT(
+    safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(vertexInputDynamicState, move_src.vertexInputDynamicState);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT::~safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -11517,6 +14494,26 @@ safe_VkVertexInputBindingDescription2EXT& safe_VkVertexInputBindingDescription2E
     return *this;
 }
 
+safe_VkVertexInputBindingDescription2EXT::safe_VkVertexInputBindingDescription2EXT(
+    safe_VkVertexInputBindingDescription2EXT&& move_src) noexcept
+    : safe_VkVertexInputBindingDescription2EXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkVertexInputBindingDescription2EXT& safe_VkVertexInputBindingDescription2EXT::operator=(
+    safe_VkVertexInputBindingDescription2EXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(binding, move_src.binding);
+    std::swap(stride, move_src.stride);
+    std::swap(inputRate, move_src.inputRate);
+    std::swap(divisor, move_src.divisor);
+
+    return *this;
+}
+
 safe_VkVertexInputBindingDescription2EXT::~safe_VkVertexInputBindingDescription2EXT() { FreePnextChain(pNext); }
 
 void safe_VkVertexInputBindingDescription2EXT::initialize(const VkVertexInputBindingDescription2EXT* in_struct,
@@ -11586,6 +14583,26 @@ safe_VkVertexInputAttributeDescription2EXT& safe_VkVertexInputAttributeDescripti
     return *this;
 }
 
+safe_VkVertexInputAttributeDescription2EXT::safe_VkVertexInputAttributeDescription2EXT(
+    safe_VkVertexInputAttributeDescription2EXT&& move_src) noexcept
+    : safe_VkVertexInputAttributeDescription2EXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkVertexInputAttributeDescription2EXT& safe_VkVertexInputAttributeDescription2EXT::operator=(
+    safe_VkVertexInputAttributeDescription2EXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(location, move_src.location);
+    std::swap(binding, move_src.binding);
+    std::swap(format, move_src.format);
+    std::swap(offset, move_src.offset);
+
+    return *this;
+}
+
 safe_VkVertexInputAttributeDescription2EXT::~safe_VkVertexInputAttributeDescription2EXT() { FreePnextChain(pNext); }
 
 void safe_VkVertexInputAttributeDescription2EXT::initialize(const VkVertexInputAttributeDescription2EXT* in_struct,
@@ -11664,6 +14681,28 @@ safe_VkPhysicalDeviceDrmPropertiesEXT& safe_VkPhysicalDeviceDrmPropertiesEXT::op
     return *this;
 }
 
+safe_VkPhysicalDeviceDrmPropertiesEXT::safe_VkPhysicalDeviceDrmPropertiesEXT(
+    safe_VkPhysicalDeviceDrmPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceDrmPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDrmPropertiesEXT& safe_VkPhysicalDeviceDrmPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceDrmPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(hasPrimary, move_src.hasPrimary);
+    std::swap(hasRender, move_src.hasRender);
+    std::swap(primaryMajor, move_src.primaryMajor);
+    std::swap(primaryMinor, move_src.primaryMinor);
+    std::swap(renderMajor, move_src.renderMajor);
+    std::swap(renderMinor, move_src.renderMinor);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDrmPropertiesEXT::~safe_VkPhysicalDeviceDrmPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDrmPropertiesEXT::initialize(const VkPhysicalDeviceDrmPropertiesEXT* in_struct,
@@ -11722,6 +14761,23 @@ safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT& safe_VkPhysicalDeviceAddre
     return *this;
 }
 
+safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT::safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT(
+    safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT& safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(reportAddressBinding, move_src.reportAddressBinding);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT::~safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -11787,6 +14843,26 @@ safe_VkDeviceAddressBindingCallbackDataEXT& safe_VkDeviceAddressBindingCallbackD
     return *this;
 }
 
+safe_VkDeviceAddressBindingCallbackDataEXT::safe_VkDeviceAddressBindingCallbackDataEXT(
+    safe_VkDeviceAddressBindingCallbackDataEXT&& move_src) noexcept
+    : safe_VkDeviceAddressBindingCallbackDataEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceAddressBindingCallbackDataEXT& safe_VkDeviceAddressBindingCallbackDataEXT::operator=(
+    safe_VkDeviceAddressBindingCallbackDataEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(baseAddress, move_src.baseAddress);
+    std::swap(size, move_src.size);
+    std::swap(bindingType, move_src.bindingType);
+
+    return *this;
+}
+
 safe_VkDeviceAddressBindingCallbackDataEXT::~safe_VkDeviceAddressBindingCallbackDataEXT() { FreePnextChain(pNext); }
 
 void safe_VkDeviceAddressBindingCallbackDataEXT::initialize(const VkDeviceAddressBindingCallbackDataEXT* in_struct,
@@ -11841,6 +14917,23 @@ safe_VkPhysicalDeviceDepthClipControlFeaturesEXT& safe_VkPhysicalDeviceDepthClip
     return *this;
 }
 
+safe_VkPhysicalDeviceDepthClipControlFeaturesEXT::safe_VkPhysicalDeviceDepthClipControlFeaturesEXT(
+    safe_VkPhysicalDeviceDepthClipControlFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceDepthClipControlFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDepthClipControlFeaturesEXT& safe_VkPhysicalDeviceDepthClipControlFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceDepthClipControlFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(depthClipControl, move_src.depthClipControl);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDepthClipControlFeaturesEXT::~safe_VkPhysicalDeviceDepthClipControlFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDepthClipControlFeaturesEXT::initialize(const VkPhysicalDeviceDepthClipControlFeaturesEXT* in_struct,
@@ -11889,6 +14982,23 @@ safe_VkPipelineViewportDepthClipControlCreateInfoEXT& safe_VkPipelineViewportDep
     return *this;
 }
 
+safe_VkPipelineViewportDepthClipControlCreateInfoEXT::safe_VkPipelineViewportDepthClipControlCreateInfoEXT(
+    safe_VkPipelineViewportDepthClipControlCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineViewportDepthClipControlCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineViewportDepthClipControlCreateInfoEXT& safe_VkPipelineViewportDepthClipControlCreateInfoEXT::operator=(
+    safe_VkPipelineViewportDepthClipControlCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(negativeOneToOne, move_src.negativeOneToOne);
+
+    return *this;
+}
+
 safe_VkPipelineViewportDepthClipControlCreateInfoEXT::~safe_VkPipelineViewportDepthClipControlCreateInfoEXT() {
     FreePnextChain(pNext);
 }
@@ -11948,6 +15058,25 @@ safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT::operator=(
     return *this;
 }
 
+safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT::safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT(
+    safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT&
+safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT::operator=(
+    safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(primitiveTopologyListRestart, move_src.primitiveTopologyListRestart);
+    std::swap(primitiveTopologyPatchListRestart, move_src.primitiveTopologyPatchListRestart);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT::~safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -12010,6 +15139,23 @@ safe_VkPipelinePropertiesIdentifierEXT& safe_VkPipelinePropertiesIdentifierEXT::
     return *this;
 }
 
+safe_VkPipelinePropertiesIdentifierEXT::safe_VkPipelinePropertiesIdentifierEXT(
+    safe_VkPipelinePropertiesIdentifierEXT&& move_src) noexcept
+    : safe_VkPipelinePropertiesIdentifierEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelinePropertiesIdentifierEXT& safe_VkPipelinePropertiesIdentifierEXT::operator=(
+    safe_VkPipelinePropertiesIdentifierEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipelineIdentifier, move_src.pipelineIdentifier);
+
+    return *this;
+}
+
 safe_VkPipelinePropertiesIdentifierEXT::~safe_VkPipelinePropertiesIdentifierEXT() { FreePnextChain(pNext); }
 
 void safe_VkPipelinePropertiesIdentifierEXT::initialize(const VkPipelinePropertiesIdentifierEXT* in_struct,
@@ -12064,6 +15210,23 @@ safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT& safe_VkPhysicalDevicePipelin
     return *this;
 }
 
+safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT::safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT(
+    safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT& safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT::operator=(
+    safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipelinePropertiesIdentifier, move_src.pipelinePropertiesIdentifier);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT::~safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT::initialize(const VkPhysicalDevicePipelinePropertiesFeaturesEXT* in_struct,
@@ -12112,6 +15275,23 @@ safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT& safe_VkPhysicalDeviceFrameBoundar
     return *this;
 }
 
+safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT::safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT(
+    safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT& safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(frameBoundary, move_src.frameBoundary);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT::~safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceFrameBoundaryFeaturesEXT::initialize(const VkPhysicalDeviceFrameBoundaryFeaturesEXT* in_struct,
@@ -12231,6 +15411,28 @@ safe_VkFrameBoundaryEXT& safe_VkFrameBoundaryEXT::operator=(const safe_VkFrameBo
     return *this;
 }
 
+safe_VkFrameBoundaryEXT::safe_VkFrameBoundaryEXT(safe_VkFrameBoundaryEXT&& move_src) noexcept : safe_VkFrameBoundaryEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkFrameBoundaryEXT& safe_VkFrameBoundaryEXT::operator=(safe_VkFrameBoundaryEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(frameID, move_src.frameID);
+    std::swap(imageCount, move_src.imageCount);
+    std::swap(pImages, move_src.pImages);
+    std::swap(bufferCount, move_src.bufferCount);
+    std::swap(pBuffers, move_src.pBuffers);
+    std::swap(tagName, move_src.tagName);
+    std::swap(tagSize, move_src.tagSize);
+    std::swap(pTag, move_src.pTag);
+
+    return *this;
+}
+
 safe_VkFrameBoundaryEXT::~safe_VkFrameBoundaryEXT() {
     if (pImages) delete[] pImages;
     if (pBuffers) delete[] pBuffers;
@@ -12330,6 +15532,24 @@ safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT::safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT(
+    safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT&
+safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(multisampledRenderToSingleSampled, move_src.multisampledRenderToSingleSampled);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT::
     ~safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT() {
     FreePnextChain(pNext);
@@ -12382,6 +15602,23 @@ safe_VkSubpassResolvePerformanceQueryEXT& safe_VkSubpassResolvePerformanceQueryE
     return *this;
 }
 
+safe_VkSubpassResolvePerformanceQueryEXT::safe_VkSubpassResolvePerformanceQueryEXT(
+    safe_VkSubpassResolvePerformanceQueryEXT&& move_src) noexcept
+    : safe_VkSubpassResolvePerformanceQueryEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubpassResolvePerformanceQueryEXT& safe_VkSubpassResolvePerformanceQueryEXT::operator=(
+    safe_VkSubpassResolvePerformanceQueryEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(optimal, move_src.optimal);
+
+    return *this;
+}
+
 safe_VkSubpassResolvePerformanceQueryEXT::~safe_VkSubpassResolvePerformanceQueryEXT() { FreePnextChain(pNext); }
 
 void safe_VkSubpassResolvePerformanceQueryEXT::initialize(const VkSubpassResolvePerformanceQueryEXT* in_struct,
@@ -12437,6 +15674,24 @@ safe_VkMultisampledRenderToSingleSampledInfoEXT& safe_VkMultisampledRenderToSing
     return *this;
 }
 
+safe_VkMultisampledRenderToSingleSampledInfoEXT::safe_VkMultisampledRenderToSingleSampledInfoEXT(
+    safe_VkMultisampledRenderToSingleSampledInfoEXT&& move_src) noexcept
+    : safe_VkMultisampledRenderToSingleSampledInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkMultisampledRenderToSingleSampledInfoEXT& safe_VkMultisampledRenderToSingleSampledInfoEXT::operator=(
+    safe_VkMultisampledRenderToSingleSampledInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(multisampledRenderToSingleSampledEnable, move_src.multisampledRenderToSingleSampledEnable);
+    std::swap(rasterizationSamples, move_src.rasterizationSamples);
+
+    return *this;
+}
+
 safe_VkMultisampledRenderToSingleSampledInfoEXT::~safe_VkMultisampledRenderToSingleSampledInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkMultisampledRenderToSingleSampledInfoEXT::initialize(const VkMultisampledRenderToSingleSampledInfoEXT* in_struct,
@@ -12498,6 +15753,25 @@ safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& safe_VkPhysicalDeviceExte
     return *this;
 }
 
+safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT::safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT(
+    safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT::operator=(
+    safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(extendedDynamicState2, move_src.extendedDynamicState2);
+    std::swap(extendedDynamicState2LogicOp, move_src.extendedDynamicState2LogicOp);
+    std::swap(extendedDynamicState2PatchControlPoints, move_src.extendedDynamicState2PatchControlPoints);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT::~safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -12552,6 +15826,23 @@ safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT& safe_VkPhysicalDeviceColorWrit
     return *this;
 }
 
+safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT::safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT(
+    safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT& safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(colorWriteEnable, move_src.colorWriteEnable);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT::~safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT::initialize(const VkPhysicalDeviceColorWriteEnableFeaturesEXT* in_struct,
@@ -12621,6 +15912,24 @@ safe_VkPipelineColorWriteCreateInfoEXT& safe_VkPipelineColorWriteCreateInfoEXT::
     return *this;
 }
 
+safe_VkPipelineColorWriteCreateInfoEXT::safe_VkPipelineColorWriteCreateInfoEXT(
+    safe_VkPipelineColorWriteCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineColorWriteCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineColorWriteCreateInfoEXT& safe_VkPipelineColorWriteCreateInfoEXT::operator=(
+    safe_VkPipelineColorWriteCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(attachmentCount, move_src.attachmentCount);
+    std::swap(pColorWriteEnables, move_src.pColorWriteEnables);
+
+    return *this;
+}
+
 safe_VkPipelineColorWriteCreateInfoEXT::~safe_VkPipelineColorWriteCreateInfoEXT() {
     if (pColorWriteEnables) delete[] pColorWriteEnables;
     FreePnextChain(pNext);
@@ -12697,6 +16006,25 @@ safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& safe_VkPhysicalDeviceP
     return *this;
 }
 
+safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT::safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT(
+    safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT::operator=(
+    safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(primitivesGeneratedQuery, move_src.primitivesGeneratedQuery);
+    std::swap(primitivesGeneratedQueryWithRasterizerDiscard, move_src.primitivesGeneratedQueryWithRasterizerDiscard);
+    std::swap(primitivesGeneratedQueryWithNonZeroStreams, move_src.primitivesGeneratedQueryWithNonZeroStreams);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT::~safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -12751,6 +16079,23 @@ safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT& safe_VkPhysicalDeviceImageViewM
     return *this;
 }
 
+safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT::safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT(
+    safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT& safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(minLod, move_src.minLod);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT::~safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT::initialize(const VkPhysicalDeviceImageViewMinLodFeaturesEXT* in_struct,
@@ -12799,6 +16144,22 @@ safe_VkImageViewMinLodCreateInfoEXT& safe_VkImageViewMinLodCreateInfoEXT::operat
     return *this;
 }
 
+safe_VkImageViewMinLodCreateInfoEXT::safe_VkImageViewMinLodCreateInfoEXT(safe_VkImageViewMinLodCreateInfoEXT&& move_src) noexcept
+    : safe_VkImageViewMinLodCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageViewMinLodCreateInfoEXT& safe_VkImageViewMinLodCreateInfoEXT::operator=(
+    safe_VkImageViewMinLodCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(minLod, move_src.minLod);
+
+    return *this;
+}
+
 safe_VkImageViewMinLodCreateInfoEXT::~safe_VkImageViewMinLodCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkImageViewMinLodCreateInfoEXT::initialize(const VkImageViewMinLodCreateInfoEXT* in_struct,
@@ -12847,6 +16208,23 @@ safe_VkPhysicalDeviceMultiDrawFeaturesEXT& safe_VkPhysicalDeviceMultiDrawFeature
     return *this;
 }
 
+safe_VkPhysicalDeviceMultiDrawFeaturesEXT::safe_VkPhysicalDeviceMultiDrawFeaturesEXT(
+    safe_VkPhysicalDeviceMultiDrawFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceMultiDrawFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMultiDrawFeaturesEXT& safe_VkPhysicalDeviceMultiDrawFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceMultiDrawFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(multiDraw, move_src.multiDraw);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMultiDrawFeaturesEXT::~safe_VkPhysicalDeviceMultiDrawFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMultiDrawFeaturesEXT::initialize(const VkPhysicalDeviceMultiDrawFeaturesEXT* in_struct,
@@ -12895,6 +16273,23 @@ safe_VkPhysicalDeviceMultiDrawPropertiesEXT& safe_VkPhysicalDeviceMultiDrawPrope
     return *this;
 }
 
+safe_VkPhysicalDeviceMultiDrawPropertiesEXT::safe_VkPhysicalDeviceMultiDrawPropertiesEXT(
+    safe_VkPhysicalDeviceMultiDrawPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceMultiDrawPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMultiDrawPropertiesEXT& safe_VkPhysicalDeviceMultiDrawPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceMultiDrawPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxMultiDrawCount, move_src.maxMultiDrawCount);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMultiDrawPropertiesEXT::~safe_VkPhysicalDeviceMultiDrawPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMultiDrawPropertiesEXT::initialize(const VkPhysicalDeviceMultiDrawPropertiesEXT* in_struct,
@@ -12948,6 +16343,24 @@ safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& safe_VkPhysicalDeviceImage2DVie
     return *this;
 }
 
+safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT::safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT(
+    safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(image2DViewOf3D, move_src.image2DViewOf3D);
+    std::swap(sampler2DViewOf3D, move_src.sampler2DViewOf3D);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT::~safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT::initialize(const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT* in_struct,
@@ -13009,6 +16422,25 @@ safe_VkPhysicalDeviceShaderTileImageFeaturesEXT& safe_VkPhysicalDeviceShaderTile
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderTileImageFeaturesEXT::safe_VkPhysicalDeviceShaderTileImageFeaturesEXT(
+    safe_VkPhysicalDeviceShaderTileImageFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderTileImageFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderTileImageFeaturesEXT& safe_VkPhysicalDeviceShaderTileImageFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceShaderTileImageFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderTileImageColorReadAccess, move_src.shaderTileImageColorReadAccess);
+    std::swap(shaderTileImageDepthReadAccess, move_src.shaderTileImageDepthReadAccess);
+    std::swap(shaderTileImageStencilReadAccess, move_src.shaderTileImageStencilReadAccess);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderTileImageFeaturesEXT::~safe_VkPhysicalDeviceShaderTileImageFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderTileImageFeaturesEXT::initialize(const VkPhysicalDeviceShaderTileImageFeaturesEXT* in_struct,
@@ -13072,6 +16504,25 @@ safe_VkPhysicalDeviceShaderTileImagePropertiesEXT& safe_VkPhysicalDeviceShaderTi
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderTileImagePropertiesEXT::safe_VkPhysicalDeviceShaderTileImagePropertiesEXT(
+    safe_VkPhysicalDeviceShaderTileImagePropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderTileImagePropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderTileImagePropertiesEXT& safe_VkPhysicalDeviceShaderTileImagePropertiesEXT::operator=(
+    safe_VkPhysicalDeviceShaderTileImagePropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderTileImageCoherentReadAccelerated, move_src.shaderTileImageCoherentReadAccelerated);
+    std::swap(shaderTileImageReadSampleFromPixelRateInvocation, move_src.shaderTileImageReadSampleFromPixelRateInvocation);
+    std::swap(shaderTileImageReadFromHelperInvocation, move_src.shaderTileImageReadFromHelperInvocation);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderTileImagePropertiesEXT::~safe_VkPhysicalDeviceShaderTileImagePropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderTileImagePropertiesEXT::initialize(const VkPhysicalDeviceShaderTileImagePropertiesEXT* in_struct,
@@ -13202,6 +16653,31 @@ safe_VkMicromapBuildInfoEXT& safe_VkMicromapBuildInfoEXT::operator=(const safe_V
     return *this;
 }
 
+safe_VkMicromapBuildInfoEXT::safe_VkMicromapBuildInfoEXT(safe_VkMicromapBuildInfoEXT&& move_src) noexcept
+    : safe_VkMicromapBuildInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkMicromapBuildInfoEXT& safe_VkMicromapBuildInfoEXT::operator=(safe_VkMicromapBuildInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(type, move_src.type);
+    std::swap(flags, move_src.flags);
+    std::swap(mode, move_src.mode);
+    std::swap(dstMicromap, move_src.dstMicromap);
+    std::swap(usageCountsCount, move_src.usageCountsCount);
+    std::swap(pUsageCounts, move_src.pUsageCounts);
+    std::swap(ppUsageCounts, move_src.ppUsageCounts);
+    std::swap(data, move_src.data);
+    std::swap(scratchData, move_src.scratchData);
+    std::swap(triangleArray, move_src.triangleArray);
+    std::swap(triangleArrayStride, move_src.triangleArrayStride);
+
+    return *this;
+}
+
 safe_VkMicromapBuildInfoEXT::~safe_VkMicromapBuildInfoEXT() {
     if (pUsageCounts) delete[] pUsageCounts;
     if (ppUsageCounts) {
@@ -13328,6 +16804,26 @@ safe_VkMicromapCreateInfoEXT& safe_VkMicromapCreateInfoEXT::operator=(const safe
     return *this;
 }
 
+safe_VkMicromapCreateInfoEXT::safe_VkMicromapCreateInfoEXT(safe_VkMicromapCreateInfoEXT&& move_src) noexcept
+    : safe_VkMicromapCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkMicromapCreateInfoEXT& safe_VkMicromapCreateInfoEXT::operator=(safe_VkMicromapCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(createFlags, move_src.createFlags);
+    std::swap(buffer, move_src.buffer);
+    std::swap(offset, move_src.offset);
+    std::swap(size, move_src.size);
+    std::swap(type, move_src.type);
+    std::swap(deviceAddress, move_src.deviceAddress);
+
+    return *this;
+}
+
 safe_VkMicromapCreateInfoEXT::~safe_VkMicromapCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkMicromapCreateInfoEXT::initialize(const VkMicromapCreateInfoEXT* in_struct,
@@ -13397,6 +16893,25 @@ safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT& safe_VkPhysicalDeviceOpacityMic
     return *this;
 }
 
+safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT::safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT(
+    safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT& safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(micromap, move_src.micromap);
+    std::swap(micromapCaptureReplay, move_src.micromapCaptureReplay);
+    std::swap(micromapHostCommands, move_src.micromapHostCommands);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT::~safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT::initialize(const VkPhysicalDeviceOpacityMicromapFeaturesEXT* in_struct,
@@ -13456,6 +16971,24 @@ safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT& safe_VkPhysicalDeviceOpacityM
     return *this;
 }
 
+safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT::safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT(
+    safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT& safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxOpacity2StateSubdivisionLevel, move_src.maxOpacity2StateSubdivisionLevel);
+    std::swap(maxOpacity4StateSubdivisionLevel, move_src.maxOpacity4StateSubdivisionLevel);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT::~safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT::initialize(const VkPhysicalDeviceOpacityMicromapPropertiesEXT* in_struct,
@@ -13519,6 +17052,21 @@ safe_VkMicromapVersionInfoEXT& safe_VkMicromapVersionInfoEXT::operator=(const sa
     return *this;
 }
 
+safe_VkMicromapVersionInfoEXT::safe_VkMicromapVersionInfoEXT(safe_VkMicromapVersionInfoEXT&& move_src) noexcept
+    : safe_VkMicromapVersionInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkMicromapVersionInfoEXT& safe_VkMicromapVersionInfoEXT::operator=(safe_VkMicromapVersionInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pVersionData, move_src.pVersionData);
+
+    return *this;
+}
+
 safe_VkMicromapVersionInfoEXT::~safe_VkMicromapVersionInfoEXT() {
     if (pVersionData) delete[] pVersionData;
     FreePnextChain(pNext);
@@ -13584,6 +17132,24 @@ safe_VkCopyMicromapToMemoryInfoEXT& safe_VkCopyMicromapToMemoryInfoEXT::operator
     return *this;
 }
 
+safe_VkCopyMicromapToMemoryInfoEXT::safe_VkCopyMicromapToMemoryInfoEXT(safe_VkCopyMicromapToMemoryInfoEXT&& move_src) noexcept
+    : safe_VkCopyMicromapToMemoryInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyMicromapToMemoryInfoEXT& safe_VkCopyMicromapToMemoryInfoEXT::operator=(
+    safe_VkCopyMicromapToMemoryInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(src, move_src.src);
+    std::swap(dst, move_src.dst);
+    std::swap(mode, move_src.mode);
+
+    return *this;
+}
+
 safe_VkCopyMicromapToMemoryInfoEXT::~safe_VkCopyMicromapToMemoryInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkCopyMicromapToMemoryInfoEXT::initialize(const VkCopyMicromapToMemoryInfoEXT* in_struct,
@@ -13639,6 +17205,24 @@ safe_VkCopyMemoryToMicromapInfoEXT& safe_VkCopyMemoryToMicromapInfoEXT::operator
     return *this;
 }
 
+safe_VkCopyMemoryToMicromapInfoEXT::safe_VkCopyMemoryToMicromapInfoEXT(safe_VkCopyMemoryToMicromapInfoEXT&& move_src) noexcept
+    : safe_VkCopyMemoryToMicromapInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyMemoryToMicromapInfoEXT& safe_VkCopyMemoryToMicromapInfoEXT::operator=(
+    safe_VkCopyMemoryToMicromapInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(src, move_src.src);
+    std::swap(dst, move_src.dst);
+    std::swap(mode, move_src.mode);
+
+    return *this;
+}
+
 safe_VkCopyMemoryToMicromapInfoEXT::~safe_VkCopyMemoryToMicromapInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkCopyMemoryToMicromapInfoEXT::initialize(const VkCopyMemoryToMicromapInfoEXT* in_struct,
@@ -13693,6 +17277,23 @@ safe_VkCopyMicromapInfoEXT& safe_VkCopyMicromapInfoEXT::operator=(const safe_VkC
     return *this;
 }
 
+safe_VkCopyMicromapInfoEXT::safe_VkCopyMicromapInfoEXT(safe_VkCopyMicromapInfoEXT&& move_src) noexcept
+    : safe_VkCopyMicromapInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyMicromapInfoEXT& safe_VkCopyMicromapInfoEXT::operator=(safe_VkCopyMicromapInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(src, move_src.src);
+    std::swap(dst, move_src.dst);
+    std::swap(mode, move_src.mode);
+
+    return *this;
+}
+
 safe_VkCopyMicromapInfoEXT::~safe_VkCopyMicromapInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkCopyMicromapInfoEXT::initialize(const VkCopyMicromapInfoEXT* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -13749,6 +17350,24 @@ safe_VkMicromapBuildSizesInfoEXT& safe_VkMicromapBuildSizesInfoEXT::operator=(co
     return *this;
 }
 
+safe_VkMicromapBuildSizesInfoEXT::safe_VkMicromapBuildSizesInfoEXT(safe_VkMicromapBuildSizesInfoEXT&& move_src) noexcept
+    : safe_VkMicromapBuildSizesInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkMicromapBuildSizesInfoEXT& safe_VkMicromapBuildSizesInfoEXT::operator=(
+    safe_VkMicromapBuildSizesInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(micromapSize, move_src.micromapSize);
+    std::swap(buildScratchSize, move_src.buildScratchSize);
+    std::swap(discardable, move_src.discardable);
+
+    return *this;
+}
+
 safe_VkMicromapBuildSizesInfoEXT::~safe_VkMicromapBuildSizesInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkMicromapBuildSizesInfoEXT::initialize(const VkMicromapBuildSizesInfoEXT* in_struct,
@@ -13872,6 +17491,30 @@ safe_VkAccelerationStructureTrianglesOpacityMicromapEXT& safe_VkAccelerationStru
     return *this;
 }
 
+safe_VkAccelerationStructureTrianglesOpacityMicromapEXT::safe_VkAccelerationStructureTrianglesOpacityMicromapEXT(
+    safe_VkAccelerationStructureTrianglesOpacityMicromapEXT&& move_src) noexcept
+    : safe_VkAccelerationStructureTrianglesOpacityMicromapEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureTrianglesOpacityMicromapEXT& safe_VkAccelerationStructureTrianglesOpacityMicromapEXT::operator=(
+    safe_VkAccelerationStructureTrianglesOpacityMicromapEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(indexType, move_src.indexType);
+    std::swap(indexBuffer, move_src.indexBuffer);
+    std::swap(indexStride, move_src.indexStride);
+    std::swap(baseTriangle, move_src.baseTriangle);
+    std::swap(usageCountsCount, move_src.usageCountsCount);
+    std::swap(pUsageCounts, move_src.pUsageCounts);
+    std::swap(ppUsageCounts, move_src.ppUsageCounts);
+    std::swap(micromap, move_src.micromap);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureTrianglesOpacityMicromapEXT::~safe_VkAccelerationStructureTrianglesOpacityMicromapEXT() {
     if (pUsageCounts) delete[] pUsageCounts;
     if (ppUsageCounts) {
@@ -13979,6 +17622,24 @@ safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& safe_VkPhysicalDeviceBorderC
     return *this;
 }
 
+safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT::safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT(
+    safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(borderColorSwizzle, move_src.borderColorSwizzle);
+    std::swap(borderColorSwizzleFromImage, move_src.borderColorSwizzleFromImage);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT::~safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT::initialize(const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT* in_struct,
@@ -14032,6 +17693,24 @@ safe_VkSamplerBorderColorComponentMappingCreateInfoEXT& safe_VkSamplerBorderColo
     return *this;
 }
 
+safe_VkSamplerBorderColorComponentMappingCreateInfoEXT::safe_VkSamplerBorderColorComponentMappingCreateInfoEXT(
+    safe_VkSamplerBorderColorComponentMappingCreateInfoEXT&& move_src) noexcept
+    : safe_VkSamplerBorderColorComponentMappingCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkSamplerBorderColorComponentMappingCreateInfoEXT& safe_VkSamplerBorderColorComponentMappingCreateInfoEXT::operator=(
+    safe_VkSamplerBorderColorComponentMappingCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(components, move_src.components);
+    std::swap(srgb, move_src.srgb);
+
+    return *this;
+}
+
 safe_VkSamplerBorderColorComponentMappingCreateInfoEXT::~safe_VkSamplerBorderColorComponentMappingCreateInfoEXT() {
     FreePnextChain(pNext);
 }
@@ -14087,6 +17766,23 @@ safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& safe_VkPhysicalDevice
     return *this;
 }
 
+safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT::safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT(
+    safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT::operator=(
+    safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pageableDeviceLocalMemory, move_src.pageableDeviceLocalMemory);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT::~safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -14128,11 +17824,28 @@ safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& safe_VkPhysicalDeviceImageS
     const safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& copy_src) {
     if (&copy_src == this) return *this;
 
-    FreePnextChain(pNext);
+    FreePnextChain(pNext);
+
+    sType = copy_src.sType;
+    imageSlicedViewOf3D = copy_src.imageSlicedViewOf3D;
+    pNext = SafePnextCopy(copy_src.pNext);
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT::safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT(
+    safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
 
-    sType = copy_src.sType;
-    imageSlicedViewOf3D = copy_src.imageSlicedViewOf3D;
-    pNext = SafePnextCopy(copy_src.pNext);
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageSlicedViewOf3D, move_src.imageSlicedViewOf3D);
 
     return *this;
 }
@@ -14189,6 +17902,23 @@ safe_VkImageViewSlicedCreateInfoEXT& safe_VkImageViewSlicedCreateInfoEXT::operat
     return *this;
 }
 
+safe_VkImageViewSlicedCreateInfoEXT::safe_VkImageViewSlicedCreateInfoEXT(safe_VkImageViewSlicedCreateInfoEXT&& move_src) noexcept
+    : safe_VkImageViewSlicedCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageViewSlicedCreateInfoEXT& safe_VkImageViewSlicedCreateInfoEXT::operator=(
+    safe_VkImageViewSlicedCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(sliceOffset, move_src.sliceOffset);
+    std::swap(sliceCount, move_src.sliceCount);
+
+    return *this;
+}
+
 safe_VkImageViewSlicedCreateInfoEXT::~safe_VkImageViewSlicedCreateInfoEXT() { FreePnextChain(pNext); }
 
 void safe_VkImageViewSlicedCreateInfoEXT::initialize(const VkImageViewSlicedCreateInfoEXT* in_struct,
@@ -14239,6 +17969,23 @@ safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& safe_VkPhysicalDeviceDepthCla
     return *this;
 }
 
+safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT::safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT(
+    safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(depthClampZeroOne, move_src.depthClampZeroOne);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT::~safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT::initialize(const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT* in_struct,
@@ -14287,6 +18034,23 @@ safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& safe_VkPhysicalDeviceNonSeam
     return *this;
 }
 
+safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT::safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT(
+    safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(nonSeamlessCubeMap, move_src.nonSeamlessCubeMap);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT::~safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT::initialize(const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT* in_struct,
@@ -14339,6 +18103,24 @@ safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT::safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT(
+    safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT&
+safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageCompressionControlSwapchain, move_src.imageCompressionControlSwapchain);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT::
     ~safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT() {
     FreePnextChain(pNext);
@@ -14401,6 +18183,25 @@ safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT& safe_VkPhysicalDeviceNested
     return *this;
 }
 
+safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT::safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT(
+    safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT& safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(nestedCommandBuffer, move_src.nestedCommandBuffer);
+    std::swap(nestedCommandBufferRendering, move_src.nestedCommandBufferRendering);
+    std::swap(nestedCommandBufferSimultaneousUse, move_src.nestedCommandBufferSimultaneousUse);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT::~safe_VkPhysicalDeviceNestedCommandBufferFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -14457,6 +18258,23 @@ safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT& safe_VkPhysicalDeviceNest
     return *this;
 }
 
+safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT::safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT(
+    safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT& safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxCommandBufferNestingLevel, move_src.maxCommandBufferNestingLevel);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT::~safe_VkPhysicalDeviceNestedCommandBufferPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -14507,6 +18325,23 @@ safe_VkExternalMemoryAcquireUnmodifiedEXT& safe_VkExternalMemoryAcquireUnmodifie
     return *this;
 }
 
+safe_VkExternalMemoryAcquireUnmodifiedEXT::safe_VkExternalMemoryAcquireUnmodifiedEXT(
+    safe_VkExternalMemoryAcquireUnmodifiedEXT&& move_src) noexcept
+    : safe_VkExternalMemoryAcquireUnmodifiedEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkExternalMemoryAcquireUnmodifiedEXT& safe_VkExternalMemoryAcquireUnmodifiedEXT::operator=(
+    safe_VkExternalMemoryAcquireUnmodifiedEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(acquireUnmodifiedMemory, move_src.acquireUnmodifiedMemory);
+
+    return *this;
+}
+
 safe_VkExternalMemoryAcquireUnmodifiedEXT::~safe_VkExternalMemoryAcquireUnmodifiedEXT() { FreePnextChain(pNext); }
 
 void safe_VkExternalMemoryAcquireUnmodifiedEXT::initialize(const VkExternalMemoryAcquireUnmodifiedEXT* in_struct,
@@ -14678,6 +18513,55 @@ safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& safe_VkPhysicalDeviceExte
     return *this;
 }
 
+safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT::safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT(
+    safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT::operator=(
+    safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(extendedDynamicState3TessellationDomainOrigin, move_src.extendedDynamicState3TessellationDomainOrigin);
+    std::swap(extendedDynamicState3DepthClampEnable, move_src.extendedDynamicState3DepthClampEnable);
+    std::swap(extendedDynamicState3PolygonMode, move_src.extendedDynamicState3PolygonMode);
+    std::swap(extendedDynamicState3RasterizationSamples, move_src.extendedDynamicState3RasterizationSamples);
+    std::swap(extendedDynamicState3SampleMask, move_src.extendedDynamicState3SampleMask);
+    std::swap(extendedDynamicState3AlphaToCoverageEnable, move_src.extendedDynamicState3AlphaToCoverageEnable);
+    std::swap(extendedDynamicState3AlphaToOneEnable, move_src.extendedDynamicState3AlphaToOneEnable);
+    std::swap(extendedDynamicState3LogicOpEnable, move_src.extendedDynamicState3LogicOpEnable);
+    std::swap(extendedDynamicState3ColorBlendEnable, move_src.extendedDynamicState3ColorBlendEnable);
+    std::swap(extendedDynamicState3ColorBlendEquation, move_src.extendedDynamicState3ColorBlendEquation);
+    std::swap(extendedDynamicState3ColorWriteMask, move_src.extendedDynamicState3ColorWriteMask);
+    std::swap(extendedDynamicState3RasterizationStream, move_src.extendedDynamicState3RasterizationStream);
+    std::swap(extendedDynamicState3ConservativeRasterizationMode, move_src.extendedDynamicState3ConservativeRasterizationMode);
+    std::swap(extendedDynamicState3ExtraPrimitiveOverestimationSize,
+              move_src.extendedDynamicState3ExtraPrimitiveOverestimationSize);
+    std::swap(extendedDynamicState3DepthClipEnable, move_src.extendedDynamicState3DepthClipEnable);
+    std::swap(extendedDynamicState3SampleLocationsEnable, move_src.extendedDynamicState3SampleLocationsEnable);
+    std::swap(extendedDynamicState3ColorBlendAdvanced, move_src.extendedDynamicState3ColorBlendAdvanced);
+    std::swap(extendedDynamicState3ProvokingVertexMode, move_src.extendedDynamicState3ProvokingVertexMode);
+    std::swap(extendedDynamicState3LineRasterizationMode, move_src.extendedDynamicState3LineRasterizationMode);
+    std::swap(extendedDynamicState3LineStippleEnable, move_src.extendedDynamicState3LineStippleEnable);
+    std::swap(extendedDynamicState3DepthClipNegativeOneToOne, move_src.extendedDynamicState3DepthClipNegativeOneToOne);
+    std::swap(extendedDynamicState3ViewportWScalingEnable, move_src.extendedDynamicState3ViewportWScalingEnable);
+    std::swap(extendedDynamicState3ViewportSwizzle, move_src.extendedDynamicState3ViewportSwizzle);
+    std::swap(extendedDynamicState3CoverageToColorEnable, move_src.extendedDynamicState3CoverageToColorEnable);
+    std::swap(extendedDynamicState3CoverageToColorLocation, move_src.extendedDynamicState3CoverageToColorLocation);
+    std::swap(extendedDynamicState3CoverageModulationMode, move_src.extendedDynamicState3CoverageModulationMode);
+    std::swap(extendedDynamicState3CoverageModulationTableEnable, move_src.extendedDynamicState3CoverageModulationTableEnable);
+    std::swap(extendedDynamicState3CoverageModulationTable, move_src.extendedDynamicState3CoverageModulationTable);
+    std::swap(extendedDynamicState3CoverageReductionMode, move_src.extendedDynamicState3CoverageReductionMode);
+    std::swap(extendedDynamicState3RepresentativeFragmentTestEnable,
+              move_src.extendedDynamicState3RepresentativeFragmentTestEnable);
+    std::swap(extendedDynamicState3ShadingRateImageEnable, move_src.extendedDynamicState3ShadingRateImageEnable);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT::~safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -14791,6 +18675,23 @@ safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& safe_VkPhysicalDeviceEx
     return *this;
 }
 
+safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT::safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT(
+    safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT::operator=(
+    safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(dynamicPrimitiveTopologyUnrestricted, move_src.dynamicPrimitiveTopologyUnrestricted);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT::~safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -14841,6 +18742,23 @@ safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& safe_VkPhysicalDeviceSubpa
     return *this;
 }
 
+safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT::safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT(
+    safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(subpassMergeFeedback, move_src.subpassMergeFeedback);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT::~safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -14891,6 +18809,22 @@ safe_VkRenderPassCreationControlEXT& safe_VkRenderPassCreationControlEXT::operat
     return *this;
 }
 
+safe_VkRenderPassCreationControlEXT::safe_VkRenderPassCreationControlEXT(safe_VkRenderPassCreationControlEXT&& move_src) noexcept
+    : safe_VkRenderPassCreationControlEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassCreationControlEXT& safe_VkRenderPassCreationControlEXT::operator=(
+    safe_VkRenderPassCreationControlEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(disallowMerging, move_src.disallowMerging);
+
+    return *this;
+}
+
 safe_VkRenderPassCreationControlEXT::~safe_VkRenderPassCreationControlEXT() { FreePnextChain(pNext); }
 
 void safe_VkRenderPassCreationControlEXT::initialize(const VkRenderPassCreationControlEXT* in_struct,
@@ -14951,6 +18885,23 @@ safe_VkRenderPassCreationFeedbackCreateInfoEXT& safe_VkRenderPassCreationFeedbac
     return *this;
 }
 
+safe_VkRenderPassCreationFeedbackCreateInfoEXT::safe_VkRenderPassCreationFeedbackCreateInfoEXT(
+    safe_VkRenderPassCreationFeedbackCreateInfoEXT&& move_src) noexcept
+    : safe_VkRenderPassCreationFeedbackCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassCreationFeedbackCreateInfoEXT& safe_VkRenderPassCreationFeedbackCreateInfoEXT::operator=(
+    safe_VkRenderPassCreationFeedbackCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pRenderPassFeedback, move_src.pRenderPassFeedback);
+
+    return *this;
+}
+
 safe_VkRenderPassCreationFeedbackCreateInfoEXT::~safe_VkRenderPassCreationFeedbackCreateInfoEXT() {
     if (pRenderPassFeedback) delete pRenderPassFeedback;
     FreePnextChain(pNext);
@@ -15023,6 +18974,23 @@ safe_VkRenderPassSubpassFeedbackCreateInfoEXT& safe_VkRenderPassSubpassFeedbackC
     return *this;
 }
 
+safe_VkRenderPassSubpassFeedbackCreateInfoEXT::safe_VkRenderPassSubpassFeedbackCreateInfoEXT(
+    safe_VkRenderPassSubpassFeedbackCreateInfoEXT&& move_src) noexcept
+    : safe_VkRenderPassSubpassFeedbackCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassSubpassFeedbackCreateInfoEXT& safe_VkRenderPassSubpassFeedbackCreateInfoEXT::operator=(
+    safe_VkRenderPassSubpassFeedbackCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pSubpassFeedback, move_src.pSubpassFeedback);
+
+    return *this;
+}
+
 safe_VkRenderPassSubpassFeedbackCreateInfoEXT::~safe_VkRenderPassSubpassFeedbackCreateInfoEXT() {
     if (pSubpassFeedback) delete pSubpassFeedback;
     FreePnextChain(pNext);
@@ -15084,6 +19052,23 @@ safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& safe_VkPhysicalDeviceSha
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT::safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT(
+    safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderModuleIdentifier, move_src.shaderModuleIdentifier);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT::~safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -15144,6 +19129,23 @@ safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& safe_VkPhysicalDeviceS
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT::safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT(
+    safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderModuleIdentifierAlgorithmUUID, move_src.shaderModuleIdentifierAlgorithmUUID);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT::~safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT() {
     FreePnextChain(pNext);
 }
@@ -15221,6 +19223,24 @@ safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT& safe_VkPipelineShaderSt
     return *this;
 }
 
+safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT::safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT(
+    safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT&& move_src) noexcept
+    : safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT& safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT::operator=(
+    safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(identifierSize, move_src.identifierSize);
+    std::swap(pIdentifier, move_src.pIdentifier);
+
+    return *this;
+}
+
 safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT::~safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT() {
     if (pIdentifier) delete[] pIdentifier;
     FreePnextChain(pNext);
@@ -15294,6 +19314,23 @@ safe_VkShaderModuleIdentifierEXT& safe_VkShaderModuleIdentifierEXT::operator=(co
     return *this;
 }
 
+safe_VkShaderModuleIdentifierEXT::safe_VkShaderModuleIdentifierEXT(safe_VkShaderModuleIdentifierEXT&& move_src) noexcept
+    : safe_VkShaderModuleIdentifierEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkShaderModuleIdentifierEXT& safe_VkShaderModuleIdentifierEXT::operator=(
+    safe_VkShaderModuleIdentifierEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(identifierSize, move_src.identifierSize);
+    std::swap(identifier, move_src.identifier);
+
+    return *this;
+}
+
 safe_VkShaderModuleIdentifierEXT::~safe_VkShaderModuleIdentifierEXT() { FreePnextChain(pNext); }
 
 void safe_VkShaderModuleIdentifierEXT::initialize(const VkShaderModuleIdentifierEXT* in_struct,
@@ -15350,6 +19387,23 @@ safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT& safe_VkPhysicalDeviceLegacyDith
     return *this;
 }
 
+safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT::safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT(
+    safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT& safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(legacyDithering, move_src.legacyDithering);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT::~safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT::initialize(const VkPhysicalDeviceLegacyDitheringFeaturesEXT* in_struct,
@@ -15399,6 +19453,23 @@ safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& safe_VkPhysicalDevicePi
     return *this;
 }
 
+safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT::safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT(
+    safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT::operator=(
+    safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipelineProtectedAccess, move_src.pipelineProtectedAccess);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT::~safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -15449,6 +19520,23 @@ safe_VkPhysicalDeviceShaderObjectFeaturesEXT& safe_VkPhysicalDeviceShaderObjectF
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderObjectFeaturesEXT::safe_VkPhysicalDeviceShaderObjectFeaturesEXT(
+    safe_VkPhysicalDeviceShaderObjectFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderObjectFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderObjectFeaturesEXT& safe_VkPhysicalDeviceShaderObjectFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceShaderObjectFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderObject, move_src.shaderObject);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderObjectFeaturesEXT::~safe_VkPhysicalDeviceShaderObjectFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderObjectFeaturesEXT::initialize(const VkPhysicalDeviceShaderObjectFeaturesEXT* in_struct,
@@ -15508,6 +19596,24 @@ safe_VkPhysicalDeviceShaderObjectPropertiesEXT& safe_VkPhysicalDeviceShaderObjec
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderObjectPropertiesEXT::safe_VkPhysicalDeviceShaderObjectPropertiesEXT(
+    safe_VkPhysicalDeviceShaderObjectPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderObjectPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderObjectPropertiesEXT& safe_VkPhysicalDeviceShaderObjectPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceShaderObjectPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderBinaryUUID, move_src.shaderBinaryUUID);
+    std::swap(shaderBinaryVersion, move_src.shaderBinaryVersion);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderObjectPropertiesEXT::~safe_VkPhysicalDeviceShaderObjectPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderObjectPropertiesEXT::initialize(const VkPhysicalDeviceShaderObjectPropertiesEXT* in_struct,
@@ -15652,6 +19758,32 @@ safe_VkShaderCreateInfoEXT& safe_VkShaderCreateInfoEXT::operator=(const safe_VkS
     return *this;
 }
 
+safe_VkShaderCreateInfoEXT::safe_VkShaderCreateInfoEXT(safe_VkShaderCreateInfoEXT&& move_src) noexcept
+    : safe_VkShaderCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkShaderCreateInfoEXT& safe_VkShaderCreateInfoEXT::operator=(safe_VkShaderCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(stage, move_src.stage);
+    std::swap(nextStage, move_src.nextStage);
+    std::swap(codeType, move_src.codeType);
+    std::swap(codeSize, move_src.codeSize);
+    std::swap(pCode, move_src.pCode);
+    std::swap(pName, move_src.pName);
+    std::swap(setLayoutCount, move_src.setLayoutCount);
+    std::swap(pSetLayouts, move_src.pSetLayouts);
+    std::swap(pushConstantRangeCount, move_src.pushConstantRangeCount);
+    std::swap(pPushConstantRanges, move_src.pPushConstantRanges);
+    std::swap(pSpecializationInfo, move_src.pSpecializationInfo);
+
+    return *this;
+}
+
 safe_VkShaderCreateInfoEXT::~safe_VkShaderCreateInfoEXT() {
     if (pName) delete[] pName;
     if (pSetLayouts) delete[] pSetLayouts;
@@ -15758,6 +19890,22 @@ safe_VkLayerSettingEXT& safe_VkLayerSettingEXT::operator=(const safe_VkLayerSett
     return *this;
 }
 
+safe_VkLayerSettingEXT::safe_VkLayerSettingEXT(safe_VkLayerSettingEXT&& move_src) noexcept : safe_VkLayerSettingEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkLayerSettingEXT& safe_VkLayerSettingEXT::operator=(safe_VkLayerSettingEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(pLayerName, move_src.pLayerName);
+    std::swap(pSettingName, move_src.pSettingName);
+    std::swap(type, move_src.type);
+    std::swap(valueCount, move_src.valueCount);
+    std::swap(pValues, move_src.pValues);
+
+    return *this;
+}
+
 safe_VkLayerSettingEXT::~safe_VkLayerSettingEXT() {
     if (pLayerName) delete[] pLayerName;
     if (pSettingName) delete[] pSettingName;
@@ -15831,6 +19979,23 @@ safe_VkLayerSettingsCreateInfoEXT& safe_VkLayerSettingsCreateInfoEXT::operator=(
     return *this;
 }
 
+safe_VkLayerSettingsCreateInfoEXT::safe_VkLayerSettingsCreateInfoEXT(safe_VkLayerSettingsCreateInfoEXT&& move_src) noexcept
+    : safe_VkLayerSettingsCreateInfoEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkLayerSettingsCreateInfoEXT& safe_VkLayerSettingsCreateInfoEXT::operator=(
+    safe_VkLayerSettingsCreateInfoEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(settingCount, move_src.settingCount);
+    std::swap(pSettings, move_src.pSettings);
+
+    return *this;
+}
+
 safe_VkLayerSettingsCreateInfoEXT::~safe_VkLayerSettingsCreateInfoEXT() {
     if (pSettings) delete[] pSettings;
     FreePnextChain(pNext);
@@ -15900,6 +20065,23 @@ safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& safe_VkPhysicalDevi
     return *this;
 }
 
+safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT::safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT(
+    safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT::operator=(
+    safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipelineLibraryGroupHandles, move_src.pipelineLibraryGroupHandles);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT::~safe_VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT() {
     FreePnextChain(pNext);
 }
@@ -15957,6 +20139,24 @@ safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT::safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT(
+    safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT&
+safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(dynamicRenderingUnusedAttachments, move_src.dynamicRenderingUnusedAttachments);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT::
     ~safe_VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT() {
     FreePnextChain(pNext);
@@ -16016,6 +20216,24 @@ safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT::safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT(
+    safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT&
+safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(attachmentFeedbackLoopDynamicState, move_src.attachmentFeedbackLoopDynamicState);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT::
     ~safe_VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT() {
     FreePnextChain(pNext);
@@ -16087,6 +20305,27 @@ safe_VkPhysicalDeviceMeshShaderFeaturesEXT& safe_VkPhysicalDeviceMeshShaderFeatu
     return *this;
 }
 
+safe_VkPhysicalDeviceMeshShaderFeaturesEXT::safe_VkPhysicalDeviceMeshShaderFeaturesEXT(
+    safe_VkPhysicalDeviceMeshShaderFeaturesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceMeshShaderFeaturesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMeshShaderFeaturesEXT& safe_VkPhysicalDeviceMeshShaderFeaturesEXT::operator=(
+    safe_VkPhysicalDeviceMeshShaderFeaturesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(taskShader, move_src.taskShader);
+    std::swap(meshShader, move_src.meshShader);
+    std::swap(multiviewMeshShader, move_src.multiviewMeshShader);
+    std::swap(primitiveFragmentShadingRateMeshShader, move_src.primitiveFragmentShadingRateMeshShader);
+    std::swap(meshShaderQueries, move_src.meshShaderQueries);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMeshShaderFeaturesEXT::~safe_VkPhysicalDeviceMeshShaderFeaturesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMeshShaderFeaturesEXT::initialize(const VkPhysicalDeviceMeshShaderFeaturesEXT* in_struct,
@@ -16285,6 +20524,50 @@ safe_VkPhysicalDeviceMeshShaderPropertiesEXT& safe_VkPhysicalDeviceMeshShaderPro
     return *this;
 }
 
+safe_VkPhysicalDeviceMeshShaderPropertiesEXT::safe_VkPhysicalDeviceMeshShaderPropertiesEXT(
+    safe_VkPhysicalDeviceMeshShaderPropertiesEXT&& move_src) noexcept
+    : safe_VkPhysicalDeviceMeshShaderPropertiesEXT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMeshShaderPropertiesEXT& safe_VkPhysicalDeviceMeshShaderPropertiesEXT::operator=(
+    safe_VkPhysicalDeviceMeshShaderPropertiesEXT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxTaskWorkGroupTotalCount, move_src.maxTaskWorkGroupTotalCount);
+    std::swap(maxTaskWorkGroupCount, move_src.maxTaskWorkGroupCount);
+    std::swap(maxTaskWorkGroupInvocations, move_src.maxTaskWorkGroupInvocations);
+    std::swap(maxTaskWorkGroupSize, move_src.maxTaskWorkGroupSize);
+    std::swap(maxTaskPayloadSize, move_src.maxTaskPayloadSize);
+    std::swap(maxTaskSharedMemorySize, move_src.maxTaskSharedMemorySize);
+    std::swap(maxTaskPayloadAndSharedMemorySize, move_src.maxTaskPayloadAndSharedMemorySize);
+    std::swap(maxMeshWorkGroupTotalCount, move_src.maxMeshWorkGroupTotalCount);
+    std::swap(maxMeshWorkGroupCount, move_src.maxMeshWorkGroupCount);
+    std::swap(maxMeshWorkGroupInvocations, move_src.maxMeshWorkGroupInvocations);
+    std::swap(maxMeshWorkGroupSize, move_src.maxMeshWorkGroupSize);
+    std::swap(maxMeshSharedMemorySize, move_src.maxMeshSharedMemorySize);
+    std::swap(maxMeshPayloadAndSharedMemorySize, move_src.maxMeshPayloadAndSharedMemorySize);
+    std::swap(maxMeshOutputMemorySize, move_src.maxMeshOutputMemorySize);
+    std::swap(maxMeshPayloadAndOutputMemorySize, move_src.maxMeshPayloadAndOutputMemorySize);
+    std::swap(maxMeshOutputComponents, move_src.maxMeshOutputComponents);
+    std::swap(maxMeshOutputVertices, move_src.maxMeshOutputVertices);
+    std::swap(maxMeshOutputPrimitives, move_src.maxMeshOutputPrimitives);
+    std::swap(maxMeshOutputLayers, move_src.maxMeshOutputLayers);
+    std::swap(maxMeshMultiviewViewCount, move_src.maxMeshMultiviewViewCount);
+    std::swap(meshOutputPerVertexGranularity, move_src.meshOutputPerVertexGranularity);
+    std::swap(meshOutputPerPrimitiveGranularity, move_src.meshOutputPerPrimitiveGranularity);
+    std::swap(maxPreferredTaskWorkGroupInvocations, move_src.maxPreferredTaskWorkGroupInvocations);
+    std::swap(maxPreferredMeshWorkGroupInvocations, move_src.maxPreferredMeshWorkGroupInvocations);
+    std::swap(prefersLocalInvocationVertexOutput, move_src.prefersLocalInvocationVertexOutput);
+    std::swap(prefersLocalInvocationPrimitiveOutput, move_src.prefersLocalInvocationPrimitiveOutput);
+    std::swap(prefersCompactVertexOutput, move_src.prefersCompactVertexOutput);
+    std::swap(prefersCompactPrimitiveOutput, move_src.prefersCompactPrimitiveOutput);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMeshShaderPropertiesEXT::~safe_VkPhysicalDeviceMeshShaderPropertiesEXT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMeshShaderPropertiesEXT::initialize(const VkPhysicalDeviceMeshShaderPropertiesEXT* in_struct,
@@ -149,6 +149,36 @@ safe_VkSwapchainCreateInfoKHR& safe_VkSwapchainCreateInfoKHR::operator=(const sa
     return *this;
 }
 
+safe_VkSwapchainCreateInfoKHR::safe_VkSwapchainCreateInfoKHR(safe_VkSwapchainCreateInfoKHR&& move_src) noexcept
+    : safe_VkSwapchainCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkSwapchainCreateInfoKHR& safe_VkSwapchainCreateInfoKHR::operator=(safe_VkSwapchainCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(surface, move_src.surface);
+    std::swap(minImageCount, move_src.minImageCount);
+    std::swap(imageFormat, move_src.imageFormat);
+    std::swap(imageColorSpace, move_src.imageColorSpace);
+    std::swap(imageExtent, move_src.imageExtent);
+    std::swap(imageArrayLayers, move_src.imageArrayLayers);
+    std::swap(imageUsage, move_src.imageUsage);
+    std::swap(imageSharingMode, move_src.imageSharingMode);
+    std::swap(queueFamilyIndexCount, move_src.queueFamilyIndexCount);
+    std::swap(pQueueFamilyIndices, move_src.pQueueFamilyIndices);
+    std::swap(preTransform, move_src.preTransform);
+    std::swap(compositeAlpha, move_src.compositeAlpha);
+    std::swap(presentMode, move_src.presentMode);
+    std::swap(clipped, move_src.clipped);
+    std::swap(oldSwapchain, move_src.oldSwapchain);
+
+    return *this;
+}
+
 safe_VkSwapchainCreateInfoKHR::~safe_VkSwapchainCreateInfoKHR() {
     if (pQueueFamilyIndices) delete[] pQueueFamilyIndices;
     FreePnextChain(pNext);
@@ -338,6 +368,25 @@ safe_VkPresentInfoKHR& safe_VkPresentInfoKHR::operator=(const safe_VkPresentInfo
     return *this;
 }
 
+safe_VkPresentInfoKHR::safe_VkPresentInfoKHR(safe_VkPresentInfoKHR&& move_src) noexcept : safe_VkPresentInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPresentInfoKHR& safe_VkPresentInfoKHR::operator=(safe_VkPresentInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(waitSemaphoreCount, move_src.waitSemaphoreCount);
+    std::swap(pWaitSemaphores, move_src.pWaitSemaphores);
+    std::swap(swapchainCount, move_src.swapchainCount);
+    std::swap(pSwapchains, move_src.pSwapchains);
+    std::swap(pImageIndices, move_src.pImageIndices);
+    std::swap(pResults, move_src.pResults);
+
+    return *this;
+}
+
 safe_VkPresentInfoKHR::~safe_VkPresentInfoKHR() {
     if (pWaitSemaphores) delete[] pWaitSemaphores;
     if (pSwapchains) delete[] pSwapchains;
@@ -447,6 +496,22 @@ safe_VkImageSwapchainCreateInfoKHR& safe_VkImageSwapchainCreateInfoKHR::operator
     return *this;
 }
 
+safe_VkImageSwapchainCreateInfoKHR::safe_VkImageSwapchainCreateInfoKHR(safe_VkImageSwapchainCreateInfoKHR&& move_src) noexcept
+    : safe_VkImageSwapchainCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageSwapchainCreateInfoKHR& safe_VkImageSwapchainCreateInfoKHR::operator=(
+    safe_VkImageSwapchainCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(swapchain, move_src.swapchain);
+
+    return *this;
+}
+
 safe_VkImageSwapchainCreateInfoKHR::~safe_VkImageSwapchainCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkImageSwapchainCreateInfoKHR::initialize(const VkImageSwapchainCreateInfoKHR* in_struct,
@@ -498,6 +563,24 @@ safe_VkBindImageMemorySwapchainInfoKHR& safe_VkBindImageMemorySwapchainInfoKHR::
     return *this;
 }
 
+safe_VkBindImageMemorySwapchainInfoKHR::safe_VkBindImageMemorySwapchainInfoKHR(
+    safe_VkBindImageMemorySwapchainInfoKHR&& move_src) noexcept
+    : safe_VkBindImageMemorySwapchainInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindImageMemorySwapchainInfoKHR& safe_VkBindImageMemorySwapchainInfoKHR::operator=(
+    safe_VkBindImageMemorySwapchainInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(swapchain, move_src.swapchain);
+    std::swap(imageIndex, move_src.imageIndex);
+
+    return *this;
+}
+
 safe_VkBindImageMemorySwapchainInfoKHR::~safe_VkBindImageMemorySwapchainInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkBindImageMemorySwapchainInfoKHR::initialize(const VkBindImageMemorySwapchainInfoKHR* in_struct,
@@ -565,6 +648,25 @@ safe_VkAcquireNextImageInfoKHR& safe_VkAcquireNextImageInfoKHR::operator=(const
     return *this;
 }
 
+safe_VkAcquireNextImageInfoKHR::safe_VkAcquireNextImageInfoKHR(safe_VkAcquireNextImageInfoKHR&& move_src) noexcept
+    : safe_VkAcquireNextImageInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkAcquireNextImageInfoKHR& safe_VkAcquireNextImageInfoKHR::operator=(safe_VkAcquireNextImageInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(swapchain, move_src.swapchain);
+    std::swap(timeout, move_src.timeout);
+    std::swap(semaphore, move_src.semaphore);
+    std::swap(fence, move_src.fence);
+    std::swap(deviceMask, move_src.deviceMask);
+
+    return *this;
+}
+
 safe_VkAcquireNextImageInfoKHR::~safe_VkAcquireNextImageInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkAcquireNextImageInfoKHR::initialize(const VkAcquireNextImageInfoKHR* in_struct,
@@ -632,6 +734,24 @@ safe_VkDeviceGroupPresentCapabilitiesKHR& safe_VkDeviceGroupPresentCapabilitiesK
     return *this;
 }
 
+safe_VkDeviceGroupPresentCapabilitiesKHR::safe_VkDeviceGroupPresentCapabilitiesKHR(
+    safe_VkDeviceGroupPresentCapabilitiesKHR&& move_src) noexcept
+    : safe_VkDeviceGroupPresentCapabilitiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceGroupPresentCapabilitiesKHR& safe_VkDeviceGroupPresentCapabilitiesKHR::operator=(
+    safe_VkDeviceGroupPresentCapabilitiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentMask, move_src.presentMask);
+    std::swap(modes, move_src.modes);
+
+    return *this;
+}
+
 safe_VkDeviceGroupPresentCapabilitiesKHR::~safe_VkDeviceGroupPresentCapabilitiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkDeviceGroupPresentCapabilitiesKHR::initialize(const VkDeviceGroupPresentCapabilitiesKHR* in_struct,
@@ -705,6 +825,24 @@ safe_VkDeviceGroupPresentInfoKHR& safe_VkDeviceGroupPresentInfoKHR::operator=(co
     return *this;
 }
 
+safe_VkDeviceGroupPresentInfoKHR::safe_VkDeviceGroupPresentInfoKHR(safe_VkDeviceGroupPresentInfoKHR&& move_src) noexcept
+    : safe_VkDeviceGroupPresentInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceGroupPresentInfoKHR& safe_VkDeviceGroupPresentInfoKHR::operator=(
+    safe_VkDeviceGroupPresentInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(swapchainCount, move_src.swapchainCount);
+    std::swap(pDeviceMasks, move_src.pDeviceMasks);
+    std::swap(mode, move_src.mode);
+
+    return *this;
+}
+
 safe_VkDeviceGroupPresentInfoKHR::~safe_VkDeviceGroupPresentInfoKHR() {
     if (pDeviceMasks) delete[] pDeviceMasks;
     FreePnextChain(pNext);
@@ -771,6 +909,23 @@ safe_VkDeviceGroupSwapchainCreateInfoKHR& safe_VkDeviceGroupSwapchainCreateInfoK
     return *this;
 }
 
+safe_VkDeviceGroupSwapchainCreateInfoKHR::safe_VkDeviceGroupSwapchainCreateInfoKHR(
+    safe_VkDeviceGroupSwapchainCreateInfoKHR&& move_src) noexcept
+    : safe_VkDeviceGroupSwapchainCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceGroupSwapchainCreateInfoKHR& safe_VkDeviceGroupSwapchainCreateInfoKHR::operator=(
+    safe_VkDeviceGroupSwapchainCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(modes, move_src.modes);
+
+    return *this;
+}
+
 safe_VkDeviceGroupSwapchainCreateInfoKHR::~safe_VkDeviceGroupSwapchainCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkDeviceGroupSwapchainCreateInfoKHR::initialize(const VkDeviceGroupSwapchainCreateInfoKHR* in_struct,
@@ -819,6 +974,22 @@ safe_VkDisplayModeCreateInfoKHR& safe_VkDisplayModeCreateInfoKHR::operator=(cons
     return *this;
 }
 
+safe_VkDisplayModeCreateInfoKHR::safe_VkDisplayModeCreateInfoKHR(safe_VkDisplayModeCreateInfoKHR&& move_src) noexcept
+    : safe_VkDisplayModeCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplayModeCreateInfoKHR& safe_VkDisplayModeCreateInfoKHR::operator=(safe_VkDisplayModeCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(parameters, move_src.parameters);
+
+    return *this;
+}
+
 safe_VkDisplayModeCreateInfoKHR::~safe_VkDisplayModeCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkDisplayModeCreateInfoKHR::initialize(const VkDisplayModeCreateInfoKHR* in_struct,
@@ -884,6 +1055,25 @@ safe_VkDisplayPropertiesKHR& safe_VkDisplayPropertiesKHR::operator=(const safe_V
     return *this;
 }
 
+safe_VkDisplayPropertiesKHR::safe_VkDisplayPropertiesKHR(safe_VkDisplayPropertiesKHR&& move_src) noexcept
+    : safe_VkDisplayPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplayPropertiesKHR& safe_VkDisplayPropertiesKHR::operator=(safe_VkDisplayPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(display, move_src.display);
+    std::swap(displayName, move_src.displayName);
+    std::swap(physicalDimensions, move_src.physicalDimensions);
+    std::swap(physicalResolution, move_src.physicalResolution);
+    std::swap(supportedTransforms, move_src.supportedTransforms);
+    std::swap(planeReorderPossible, move_src.planeReorderPossible);
+    std::swap(persistentContent, move_src.persistentContent);
+
+    return *this;
+}
+
 safe_VkDisplayPropertiesKHR::~safe_VkDisplayPropertiesKHR() {
     if (displayName) delete[] displayName;
 }
@@ -971,6 +1161,29 @@ safe_VkDisplaySurfaceCreateInfoKHR& safe_VkDisplaySurfaceCreateInfoKHR::operator
     return *this;
 }
 
+safe_VkDisplaySurfaceCreateInfoKHR::safe_VkDisplaySurfaceCreateInfoKHR(safe_VkDisplaySurfaceCreateInfoKHR&& move_src) noexcept
+    : safe_VkDisplaySurfaceCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplaySurfaceCreateInfoKHR& safe_VkDisplaySurfaceCreateInfoKHR::operator=(
+    safe_VkDisplaySurfaceCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(displayMode, move_src.displayMode);
+    std::swap(planeIndex, move_src.planeIndex);
+    std::swap(planeStackIndex, move_src.planeStackIndex);
+    std::swap(transform, move_src.transform);
+    std::swap(globalAlpha, move_src.globalAlpha);
+    std::swap(alphaMode, move_src.alphaMode);
+    std::swap(imageExtent, move_src.imageExtent);
+
+    return *this;
+}
+
 safe_VkDisplaySurfaceCreateInfoKHR::~safe_VkDisplaySurfaceCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkDisplaySurfaceCreateInfoKHR::initialize(const VkDisplaySurfaceCreateInfoKHR* in_struct,
@@ -1035,6 +1248,23 @@ safe_VkDisplayPresentInfoKHR& safe_VkDisplayPresentInfoKHR::operator=(const safe
     return *this;
 }
 
+safe_VkDisplayPresentInfoKHR::safe_VkDisplayPresentInfoKHR(safe_VkDisplayPresentInfoKHR&& move_src) noexcept
+    : safe_VkDisplayPresentInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplayPresentInfoKHR& safe_VkDisplayPresentInfoKHR::operator=(safe_VkDisplayPresentInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(srcRect, move_src.srcRect);
+    std::swap(dstRect, move_src.dstRect);
+    std::swap(persistent, move_src.persistent);
+
+    return *this;
+}
+
 safe_VkDisplayPresentInfoKHR::~safe_VkDisplayPresentInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkDisplayPresentInfoKHR::initialize(const VkDisplayPresentInfoKHR* in_struct,
@@ -1087,6 +1317,23 @@ safe_VkQueueFamilyQueryResultStatusPropertiesKHR& safe_VkQueueFamilyQueryResultS
     return *this;
 }
 
+safe_VkQueueFamilyQueryResultStatusPropertiesKHR::safe_VkQueueFamilyQueryResultStatusPropertiesKHR(
+    safe_VkQueueFamilyQueryResultStatusPropertiesKHR&& move_src) noexcept
+    : safe_VkQueueFamilyQueryResultStatusPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkQueueFamilyQueryResultStatusPropertiesKHR& safe_VkQueueFamilyQueryResultStatusPropertiesKHR::operator=(
+    safe_VkQueueFamilyQueryResultStatusPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(queryResultStatusSupport, move_src.queryResultStatusSupport);
+
+    return *this;
+}
+
 safe_VkQueueFamilyQueryResultStatusPropertiesKHR::~safe_VkQueueFamilyQueryResultStatusPropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkQueueFamilyQueryResultStatusPropertiesKHR::initialize(const VkQueueFamilyQueryResultStatusPropertiesKHR* in_struct,
@@ -1135,6 +1382,22 @@ safe_VkQueueFamilyVideoPropertiesKHR& safe_VkQueueFamilyVideoPropertiesKHR::oper
     return *this;
 }
 
+safe_VkQueueFamilyVideoPropertiesKHR::safe_VkQueueFamilyVideoPropertiesKHR(safe_VkQueueFamilyVideoPropertiesKHR&& move_src) noexcept
+    : safe_VkQueueFamilyVideoPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkQueueFamilyVideoPropertiesKHR& safe_VkQueueFamilyVideoPropertiesKHR::operator=(
+    safe_VkQueueFamilyVideoPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(videoCodecOperations, move_src.videoCodecOperations);
+
+    return *this;
+}
+
 safe_VkQueueFamilyVideoPropertiesKHR::~safe_VkQueueFamilyVideoPropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkQueueFamilyVideoPropertiesKHR::initialize(const VkQueueFamilyVideoPropertiesKHR* in_struct,
@@ -1196,6 +1459,24 @@ safe_VkVideoProfileInfoKHR& safe_VkVideoProfileInfoKHR::operator=(const safe_VkV
     return *this;
 }
 
+safe_VkVideoProfileInfoKHR::safe_VkVideoProfileInfoKHR(safe_VkVideoProfileInfoKHR&& move_src) noexcept
+    : safe_VkVideoProfileInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoProfileInfoKHR& safe_VkVideoProfileInfoKHR::operator=(safe_VkVideoProfileInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(videoCodecOperation, move_src.videoCodecOperation);
+    std::swap(chromaSubsampling, move_src.chromaSubsampling);
+    std::swap(lumaBitDepth, move_src.lumaBitDepth);
+    std::swap(chromaBitDepth, move_src.chromaBitDepth);
+
+    return *this;
+}
+
 safe_VkVideoProfileInfoKHR::~safe_VkVideoProfileInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoProfileInfoKHR::initialize(const VkVideoProfileInfoKHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -1268,6 +1549,22 @@ safe_VkVideoProfileListInfoKHR& safe_VkVideoProfileListInfoKHR::operator=(const
     return *this;
 }
 
+safe_VkVideoProfileListInfoKHR::safe_VkVideoProfileListInfoKHR(safe_VkVideoProfileListInfoKHR&& move_src) noexcept
+    : safe_VkVideoProfileListInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoProfileListInfoKHR& safe_VkVideoProfileListInfoKHR::operator=(safe_VkVideoProfileListInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(profileCount, move_src.profileCount);
+    std::swap(pProfiles, move_src.pProfiles);
+
+    return *this;
+}
+
 safe_VkVideoProfileListInfoKHR::~safe_VkVideoProfileListInfoKHR() {
     if (pProfiles) delete[] pProfiles;
     FreePnextChain(pNext);
@@ -1367,6 +1664,29 @@ safe_VkVideoCapabilitiesKHR& safe_VkVideoCapabilitiesKHR::operator=(const safe_V
     return *this;
 }
 
+safe_VkVideoCapabilitiesKHR::safe_VkVideoCapabilitiesKHR(safe_VkVideoCapabilitiesKHR&& move_src) noexcept
+    : safe_VkVideoCapabilitiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoCapabilitiesKHR& safe_VkVideoCapabilitiesKHR::operator=(safe_VkVideoCapabilitiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(minBitstreamBufferOffsetAlignment, move_src.minBitstreamBufferOffsetAlignment);
+    std::swap(minBitstreamBufferSizeAlignment, move_src.minBitstreamBufferSizeAlignment);
+    std::swap(pictureAccessGranularity, move_src.pictureAccessGranularity);
+    std::swap(minCodedExtent, move_src.minCodedExtent);
+    std::swap(maxCodedExtent, move_src.maxCodedExtent);
+    std::swap(maxDpbSlots, move_src.maxDpbSlots);
+    std::swap(maxActiveReferencePictures, move_src.maxActiveReferencePictures);
+    std::swap(stdHeaderVersion, move_src.stdHeaderVersion);
+
+    return *this;
+}
+
 safe_VkVideoCapabilitiesKHR::~safe_VkVideoCapabilitiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoCapabilitiesKHR::initialize(const VkVideoCapabilitiesKHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -1430,6 +1750,23 @@ safe_VkPhysicalDeviceVideoFormatInfoKHR& safe_VkPhysicalDeviceVideoFormatInfoKHR
     return *this;
 }
 
+safe_VkPhysicalDeviceVideoFormatInfoKHR::safe_VkPhysicalDeviceVideoFormatInfoKHR(
+    safe_VkPhysicalDeviceVideoFormatInfoKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceVideoFormatInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVideoFormatInfoKHR& safe_VkPhysicalDeviceVideoFormatInfoKHR::operator=(
+    safe_VkPhysicalDeviceVideoFormatInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageUsage, move_src.imageUsage);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVideoFormatInfoKHR::~safe_VkPhysicalDeviceVideoFormatInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceVideoFormatInfoKHR::initialize(const VkPhysicalDeviceVideoFormatInfoKHR* in_struct,
@@ -1499,6 +1836,26 @@ safe_VkVideoFormatPropertiesKHR& safe_VkVideoFormatPropertiesKHR::operator=(cons
     return *this;
 }
 
+safe_VkVideoFormatPropertiesKHR::safe_VkVideoFormatPropertiesKHR(safe_VkVideoFormatPropertiesKHR&& move_src) noexcept
+    : safe_VkVideoFormatPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoFormatPropertiesKHR& safe_VkVideoFormatPropertiesKHR::operator=(safe_VkVideoFormatPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(format, move_src.format);
+    std::swap(componentMapping, move_src.componentMapping);
+    std::swap(imageCreateFlags, move_src.imageCreateFlags);
+    std::swap(imageType, move_src.imageType);
+    std::swap(imageTiling, move_src.imageTiling);
+    std::swap(imageUsageFlags, move_src.imageUsageFlags);
+
+    return *this;
+}
+
 safe_VkVideoFormatPropertiesKHR::~safe_VkVideoFormatPropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoFormatPropertiesKHR::initialize(const VkVideoFormatPropertiesKHR* in_struct,
@@ -1571,6 +1928,25 @@ safe_VkVideoPictureResourceInfoKHR& safe_VkVideoPictureResourceInfoKHR::operator
     return *this;
 }
 
+safe_VkVideoPictureResourceInfoKHR::safe_VkVideoPictureResourceInfoKHR(safe_VkVideoPictureResourceInfoKHR&& move_src) noexcept
+    : safe_VkVideoPictureResourceInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoPictureResourceInfoKHR& safe_VkVideoPictureResourceInfoKHR::operator=(
+    safe_VkVideoPictureResourceInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(codedOffset, move_src.codedOffset);
+    std::swap(codedExtent, move_src.codedExtent);
+    std::swap(baseArrayLayer, move_src.baseArrayLayer);
+    std::swap(imageViewBinding, move_src.imageViewBinding);
+
+    return *this;
+}
+
 safe_VkVideoPictureResourceInfoKHR::~safe_VkVideoPictureResourceInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoPictureResourceInfoKHR::initialize(const VkVideoPictureResourceInfoKHR* in_struct,
@@ -1629,6 +2005,23 @@ safe_VkVideoReferenceSlotInfoKHR& safe_VkVideoReferenceSlotInfoKHR::operator=(co
     return *this;
 }
 
+safe_VkVideoReferenceSlotInfoKHR::safe_VkVideoReferenceSlotInfoKHR(safe_VkVideoReferenceSlotInfoKHR&& move_src) noexcept
+    : safe_VkVideoReferenceSlotInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoReferenceSlotInfoKHR& safe_VkVideoReferenceSlotInfoKHR::operator=(
+    safe_VkVideoReferenceSlotInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(slotIndex, move_src.slotIndex);
+    std::swap(pPictureResource, move_src.pPictureResource);
+
+    return *this;
+}
+
 safe_VkVideoReferenceSlotInfoKHR::~safe_VkVideoReferenceSlotInfoKHR() {
     if (pPictureResource) delete pPictureResource;
     FreePnextChain(pNext);
@@ -1687,6 +2080,24 @@ safe_VkVideoSessionMemoryRequirementsKHR& safe_VkVideoSessionMemoryRequirementsK
     return *this;
 }
 
+safe_VkVideoSessionMemoryRequirementsKHR::safe_VkVideoSessionMemoryRequirementsKHR(
+    safe_VkVideoSessionMemoryRequirementsKHR&& move_src) noexcept
+    : safe_VkVideoSessionMemoryRequirementsKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoSessionMemoryRequirementsKHR& safe_VkVideoSessionMemoryRequirementsKHR::operator=(
+    safe_VkVideoSessionMemoryRequirementsKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryBindIndex, move_src.memoryBindIndex);
+    std::swap(memoryRequirements, move_src.memoryRequirements);
+
+    return *this;
+}
+
 safe_VkVideoSessionMemoryRequirementsKHR::~safe_VkVideoSessionMemoryRequirementsKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoSessionMemoryRequirementsKHR::initialize(const VkVideoSessionMemoryRequirementsKHR* in_struct,
@@ -1752,6 +2163,25 @@ safe_VkBindVideoSessionMemoryInfoKHR& safe_VkBindVideoSessionMemoryInfoKHR::oper
     return *this;
 }
 
+safe_VkBindVideoSessionMemoryInfoKHR::safe_VkBindVideoSessionMemoryInfoKHR(safe_VkBindVideoSessionMemoryInfoKHR&& move_src) noexcept
+    : safe_VkBindVideoSessionMemoryInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindVideoSessionMemoryInfoKHR& safe_VkBindVideoSessionMemoryInfoKHR::operator=(
+    safe_VkBindVideoSessionMemoryInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryBindIndex, move_src.memoryBindIndex);
+    std::swap(memory, move_src.memory);
+    std::swap(memoryOffset, move_src.memoryOffset);
+    std::swap(memorySize, move_src.memorySize);
+
+    return *this;
+}
+
 safe_VkBindVideoSessionMemoryInfoKHR::~safe_VkBindVideoSessionMemoryInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkBindVideoSessionMemoryInfoKHR::initialize(const VkBindVideoSessionMemoryInfoKHR* in_struct,
@@ -1856,6 +2286,30 @@ safe_VkVideoSessionCreateInfoKHR& safe_VkVideoSessionCreateInfoKHR::operator=(co
     return *this;
 }
 
+safe_VkVideoSessionCreateInfoKHR::safe_VkVideoSessionCreateInfoKHR(safe_VkVideoSessionCreateInfoKHR&& move_src) noexcept
+    : safe_VkVideoSessionCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoSessionCreateInfoKHR& safe_VkVideoSessionCreateInfoKHR::operator=(
+    safe_VkVideoSessionCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(queueFamilyIndex, move_src.queueFamilyIndex);
+    std::swap(flags, move_src.flags);
+    std::swap(pVideoProfile, move_src.pVideoProfile);
+    std::swap(pictureFormat, move_src.pictureFormat);
+    std::swap(maxCodedExtent, move_src.maxCodedExtent);
+    std::swap(referencePictureFormat, move_src.referencePictureFormat);
+    std::swap(maxDpbSlots, move_src.maxDpbSlots);
+    std::swap(maxActiveReferencePictures, move_src.maxActiveReferencePictures);
+    std::swap(pStdHeaderVersion, move_src.pStdHeaderVersion);
+
+    return *this;
+}
+
 safe_VkVideoSessionCreateInfoKHR::~safe_VkVideoSessionCreateInfoKHR() {
     if (pVideoProfile) delete pVideoProfile;
     if (pStdHeaderVersion) delete pStdHeaderVersion;
@@ -1947,6 +2401,25 @@ safe_VkVideoSessionParametersCreateInfoKHR& safe_VkVideoSessionParametersCreateI
     return *this;
 }
 
+safe_VkVideoSessionParametersCreateInfoKHR::safe_VkVideoSessionParametersCreateInfoKHR(
+    safe_VkVideoSessionParametersCreateInfoKHR&& move_src) noexcept
+    : safe_VkVideoSessionParametersCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoSessionParametersCreateInfoKHR& safe_VkVideoSessionParametersCreateInfoKHR::operator=(
+    safe_VkVideoSessionParametersCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(videoSessionParametersTemplate, move_src.videoSessionParametersTemplate);
+    std::swap(videoSession, move_src.videoSession);
+
+    return *this;
+}
+
 safe_VkVideoSessionParametersCreateInfoKHR::~safe_VkVideoSessionParametersCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoSessionParametersCreateInfoKHR::initialize(const VkVideoSessionParametersCreateInfoKHR* in_struct,
@@ -1999,6 +2472,23 @@ safe_VkVideoSessionParametersUpdateInfoKHR& safe_VkVideoSessionParametersUpdateI
     return *this;
 }
 
+safe_VkVideoSessionParametersUpdateInfoKHR::safe_VkVideoSessionParametersUpdateInfoKHR(
+    safe_VkVideoSessionParametersUpdateInfoKHR&& move_src) noexcept
+    : safe_VkVideoSessionParametersUpdateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoSessionParametersUpdateInfoKHR& safe_VkVideoSessionParametersUpdateInfoKHR::operator=(
+    safe_VkVideoSessionParametersUpdateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(updateSequenceCount, move_src.updateSequenceCount);
+
+    return *this;
+}
+
 safe_VkVideoSessionParametersUpdateInfoKHR::~safe_VkVideoSessionParametersUpdateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoSessionParametersUpdateInfoKHR::initialize(const VkVideoSessionParametersUpdateInfoKHR* in_struct,
@@ -2083,6 +2573,25 @@ safe_VkVideoBeginCodingInfoKHR& safe_VkVideoBeginCodingInfoKHR::operator=(const
     return *this;
 }
 
+safe_VkVideoBeginCodingInfoKHR::safe_VkVideoBeginCodingInfoKHR(safe_VkVideoBeginCodingInfoKHR&& move_src) noexcept
+    : safe_VkVideoBeginCodingInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoBeginCodingInfoKHR& safe_VkVideoBeginCodingInfoKHR::operator=(safe_VkVideoBeginCodingInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(videoSession, move_src.videoSession);
+    std::swap(videoSessionParameters, move_src.videoSessionParameters);
+    std::swap(referenceSlotCount, move_src.referenceSlotCount);
+    std::swap(pReferenceSlots, move_src.pReferenceSlots);
+
+    return *this;
+}
+
 safe_VkVideoBeginCodingInfoKHR::~safe_VkVideoBeginCodingInfoKHR() {
     if (pReferenceSlots) delete[] pReferenceSlots;
     FreePnextChain(pNext);
@@ -2153,6 +2662,21 @@ safe_VkVideoEndCodingInfoKHR& safe_VkVideoEndCodingInfoKHR::operator=(const safe
     return *this;
 }
 
+safe_VkVideoEndCodingInfoKHR::safe_VkVideoEndCodingInfoKHR(safe_VkVideoEndCodingInfoKHR&& move_src) noexcept
+    : safe_VkVideoEndCodingInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEndCodingInfoKHR& safe_VkVideoEndCodingInfoKHR::operator=(safe_VkVideoEndCodingInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkVideoEndCodingInfoKHR::~safe_VkVideoEndCodingInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEndCodingInfoKHR::initialize(const VkVideoEndCodingInfoKHR* in_struct,
@@ -2199,6 +2723,22 @@ safe_VkVideoCodingControlInfoKHR& safe_VkVideoCodingControlInfoKHR::operator=(co
     return *this;
 }
 
+safe_VkVideoCodingControlInfoKHR::safe_VkVideoCodingControlInfoKHR(safe_VkVideoCodingControlInfoKHR&& move_src) noexcept
+    : safe_VkVideoCodingControlInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoCodingControlInfoKHR& safe_VkVideoCodingControlInfoKHR::operator=(
+    safe_VkVideoCodingControlInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkVideoCodingControlInfoKHR::~safe_VkVideoCodingControlInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoCodingControlInfoKHR::initialize(const VkVideoCodingControlInfoKHR* in_struct,
@@ -2245,6 +2785,22 @@ safe_VkVideoDecodeCapabilitiesKHR& safe_VkVideoDecodeCapabilitiesKHR::operator=(
     return *this;
 }
 
+safe_VkVideoDecodeCapabilitiesKHR::safe_VkVideoDecodeCapabilitiesKHR(safe_VkVideoDecodeCapabilitiesKHR&& move_src) noexcept
+    : safe_VkVideoDecodeCapabilitiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeCapabilitiesKHR& safe_VkVideoDecodeCapabilitiesKHR::operator=(
+    safe_VkVideoDecodeCapabilitiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkVideoDecodeCapabilitiesKHR::~safe_VkVideoDecodeCapabilitiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoDecodeCapabilitiesKHR::initialize(const VkVideoDecodeCapabilitiesKHR* in_struct,
@@ -2291,6 +2847,21 @@ safe_VkVideoDecodeUsageInfoKHR& safe_VkVideoDecodeUsageInfoKHR::operator=(const
     return *this;
 }
 
+safe_VkVideoDecodeUsageInfoKHR::safe_VkVideoDecodeUsageInfoKHR(safe_VkVideoDecodeUsageInfoKHR&& move_src) noexcept
+    : safe_VkVideoDecodeUsageInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeUsageInfoKHR& safe_VkVideoDecodeUsageInfoKHR::operator=(safe_VkVideoDecodeUsageInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(videoUsageHints, move_src.videoUsageHints);
+
+    return *this;
+}
+
 safe_VkVideoDecodeUsageInfoKHR::~safe_VkVideoDecodeUsageInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoDecodeUsageInfoKHR::initialize(const VkVideoDecodeUsageInfoKHR* in_struct,
@@ -2390,6 +2961,27 @@ safe_VkVideoDecodeInfoKHR& safe_VkVideoDecodeInfoKHR::operator=(const safe_VkVid
     return *this;
 }
 
+safe_VkVideoDecodeInfoKHR::safe_VkVideoDecodeInfoKHR(safe_VkVideoDecodeInfoKHR&& move_src) noexcept : safe_VkVideoDecodeInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeInfoKHR& safe_VkVideoDecodeInfoKHR::operator=(safe_VkVideoDecodeInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(srcBuffer, move_src.srcBuffer);
+    std::swap(srcBufferOffset, move_src.srcBufferOffset);
+    std::swap(srcBufferRange, move_src.srcBufferRange);
+    std::swap(dstPictureResource, move_src.dstPictureResource);
+    std::swap(pSetupReferenceSlot, move_src.pSetupReferenceSlot);
+    std::swap(referenceSlotCount, move_src.referenceSlotCount);
+    std::swap(pReferenceSlots, move_src.pReferenceSlots);
+
+    return *this;
+}
+
 safe_VkVideoDecodeInfoKHR::~safe_VkVideoDecodeInfoKHR() {
     if (pSetupReferenceSlot) delete pSetupReferenceSlot;
     if (pReferenceSlots) delete[] pReferenceSlots;
@@ -2522,6 +3114,35 @@ safe_VkVideoEncodeH264CapabilitiesKHR& safe_VkVideoEncodeH264CapabilitiesKHR::op
     return *this;
 }
 
+safe_VkVideoEncodeH264CapabilitiesKHR::safe_VkVideoEncodeH264CapabilitiesKHR(
+    safe_VkVideoEncodeH264CapabilitiesKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264CapabilitiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264CapabilitiesKHR& safe_VkVideoEncodeH264CapabilitiesKHR::operator=(
+    safe_VkVideoEncodeH264CapabilitiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(maxLevelIdc, move_src.maxLevelIdc);
+    std::swap(maxSliceCount, move_src.maxSliceCount);
+    std::swap(maxPPictureL0ReferenceCount, move_src.maxPPictureL0ReferenceCount);
+    std::swap(maxBPictureL0ReferenceCount, move_src.maxBPictureL0ReferenceCount);
+    std::swap(maxL1ReferenceCount, move_src.maxL1ReferenceCount);
+    std::swap(maxTemporalLayerCount, move_src.maxTemporalLayerCount);
+    std::swap(expectDyadicTemporalLayerPattern, move_src.expectDyadicTemporalLayerPattern);
+    std::swap(minQp, move_src.minQp);
+    std::swap(maxQp, move_src.maxQp);
+    std::swap(prefersGopRemainingFrames, move_src.prefersGopRemainingFrames);
+    std::swap(requiresGopRemainingFrames, move_src.requiresGopRemainingFrames);
+    std::swap(stdSyntaxFlags, move_src.stdSyntaxFlags);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264CapabilitiesKHR::~safe_VkVideoEncodeH264CapabilitiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH264CapabilitiesKHR::initialize(const VkVideoEncodeH264CapabilitiesKHR* in_struct,
@@ -2629,12 +3250,37 @@ safe_VkVideoEncodeH264QualityLevelPropertiesKHR& safe_VkVideoEncodeH264QualityLe
     return *this;
 }
 
-safe_VkVideoEncodeH264QualityLevelPropertiesKHR::~safe_VkVideoEncodeH264QualityLevelPropertiesKHR() { FreePnextChain(pNext); }
+safe_VkVideoEncodeH264QualityLevelPropertiesKHR::safe_VkVideoEncodeH264QualityLevelPropertiesKHR(
+    safe_VkVideoEncodeH264QualityLevelPropertiesKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264QualityLevelPropertiesKHR() {
+    *this = std::move(move_src);
+}
 
-void safe_VkVideoEncodeH264QualityLevelPropertiesKHR::initialize(const VkVideoEncodeH264QualityLevelPropertiesKHR* in_struct,
-                                                                 [[maybe_unused]] PNextCopyState* copy_state) {
-    FreePnextChain(pNext);
-    sType = in_struct->sType;
+safe_VkVideoEncodeH264QualityLevelPropertiesKHR& safe_VkVideoEncodeH264QualityLevelPropertiesKHR::operator=(
+    safe_VkVideoEncodeH264QualityLevelPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(preferredRateControlFlags, move_src.preferredRateControlFlags);
+    std::swap(preferredGopFrameCount, move_src.preferredGopFrameCount);
+    std::swap(preferredIdrPeriod, move_src.preferredIdrPeriod);
+    std::swap(preferredConsecutiveBFrameCount, move_src.preferredConsecutiveBFrameCount);
+    std::swap(preferredTemporalLayerCount, move_src.preferredTemporalLayerCount);
+    std::swap(preferredConstantQp, move_src.preferredConstantQp);
+    std::swap(preferredMaxL0ReferenceCount, move_src.preferredMaxL0ReferenceCount);
+    std::swap(preferredMaxL1ReferenceCount, move_src.preferredMaxL1ReferenceCount);
+    std::swap(preferredStdEntropyCodingModeFlag, move_src.preferredStdEntropyCodingModeFlag);
+
+    return *this;
+}
+
+safe_VkVideoEncodeH264QualityLevelPropertiesKHR::~safe_VkVideoEncodeH264QualityLevelPropertiesKHR() { FreePnextChain(pNext); }
+
+void safe_VkVideoEncodeH264QualityLevelPropertiesKHR::initialize(const VkVideoEncodeH264QualityLevelPropertiesKHR* in_struct,
+                                                                 [[maybe_unused]] PNextCopyState* copy_state) {
+    FreePnextChain(pNext);
+    sType = in_struct->sType;
     preferredRateControlFlags = in_struct->preferredRateControlFlags;
     preferredGopFrameCount = in_struct->preferredGopFrameCount;
     preferredIdrPeriod = in_struct->preferredIdrPeriod;
@@ -2695,6 +3341,24 @@ safe_VkVideoEncodeH264SessionCreateInfoKHR& safe_VkVideoEncodeH264SessionCreateI
     return *this;
 }
 
+safe_VkVideoEncodeH264SessionCreateInfoKHR::safe_VkVideoEncodeH264SessionCreateInfoKHR(
+    safe_VkVideoEncodeH264SessionCreateInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264SessionCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264SessionCreateInfoKHR& safe_VkVideoEncodeH264SessionCreateInfoKHR::operator=(
+    safe_VkVideoEncodeH264SessionCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(useMaxLevelIdc, move_src.useMaxLevelIdc);
+    std::swap(maxLevelIdc, move_src.maxLevelIdc);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264SessionCreateInfoKHR::~safe_VkVideoEncodeH264SessionCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH264SessionCreateInfoKHR::initialize(const VkVideoEncodeH264SessionCreateInfoKHR* in_struct,
@@ -2791,6 +3455,26 @@ safe_VkVideoEncodeH264SessionParametersAddInfoKHR& safe_VkVideoEncodeH264Session
     return *this;
 }
 
+safe_VkVideoEncodeH264SessionParametersAddInfoKHR::safe_VkVideoEncodeH264SessionParametersAddInfoKHR(
+    safe_VkVideoEncodeH264SessionParametersAddInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264SessionParametersAddInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264SessionParametersAddInfoKHR& safe_VkVideoEncodeH264SessionParametersAddInfoKHR::operator=(
+    safe_VkVideoEncodeH264SessionParametersAddInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stdSPSCount, move_src.stdSPSCount);
+    std::swap(pStdSPSs, move_src.pStdSPSs);
+    std::swap(stdPPSCount, move_src.stdPPSCount);
+    std::swap(pStdPPSs, move_src.pStdPPSs);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264SessionParametersAddInfoKHR::~safe_VkVideoEncodeH264SessionParametersAddInfoKHR() {
     if (pStdSPSs) delete[] pStdSPSs;
     if (pStdPPSs) delete[] pStdPPSs;
@@ -2889,6 +3573,25 @@ safe_VkVideoEncodeH264SessionParametersCreateInfoKHR& safe_VkVideoEncodeH264Sess
     return *this;
 }
 
+safe_VkVideoEncodeH264SessionParametersCreateInfoKHR::safe_VkVideoEncodeH264SessionParametersCreateInfoKHR(
+    safe_VkVideoEncodeH264SessionParametersCreateInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264SessionParametersCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264SessionParametersCreateInfoKHR& safe_VkVideoEncodeH264SessionParametersCreateInfoKHR::operator=(
+    safe_VkVideoEncodeH264SessionParametersCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxStdSPSCount, move_src.maxStdSPSCount);
+    std::swap(maxStdPPSCount, move_src.maxStdPPSCount);
+    std::swap(pParametersAddInfo, move_src.pParametersAddInfo);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264SessionParametersCreateInfoKHR::~safe_VkVideoEncodeH264SessionParametersCreateInfoKHR() {
     if (pParametersAddInfo) delete pParametersAddInfo;
     FreePnextChain(pNext);
@@ -2964,6 +3667,26 @@ safe_VkVideoEncodeH264SessionParametersGetInfoKHR& safe_VkVideoEncodeH264Session
     return *this;
 }
 
+safe_VkVideoEncodeH264SessionParametersGetInfoKHR::safe_VkVideoEncodeH264SessionParametersGetInfoKHR(
+    safe_VkVideoEncodeH264SessionParametersGetInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264SessionParametersGetInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264SessionParametersGetInfoKHR& safe_VkVideoEncodeH264SessionParametersGetInfoKHR::operator=(
+    safe_VkVideoEncodeH264SessionParametersGetInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(writeStdSPS, move_src.writeStdSPS);
+    std::swap(writeStdPPS, move_src.writeStdPPS);
+    std::swap(stdSPSId, move_src.stdSPSId);
+    std::swap(stdPPSId, move_src.stdPPSId);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264SessionParametersGetInfoKHR::~safe_VkVideoEncodeH264SessionParametersGetInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH264SessionParametersGetInfoKHR::initialize(const VkVideoEncodeH264SessionParametersGetInfoKHR* in_struct,
@@ -3026,6 +3749,24 @@ safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR& safe_VkVideoEncodeH264Se
     return *this;
 }
 
+safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR::safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR(
+    safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR& safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR::operator=(
+    safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(hasStdSPSOverrides, move_src.hasStdSPSOverrides);
+    std::swap(hasStdPPSOverrides, move_src.hasStdPPSOverrides);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR::~safe_VkVideoEncodeH264SessionParametersFeedbackInfoKHR() {
     FreePnextChain(pNext);
 }
@@ -3093,6 +3834,24 @@ safe_VkVideoEncodeH264NaluSliceInfoKHR& safe_VkVideoEncodeH264NaluSliceInfoKHR::
     return *this;
 }
 
+safe_VkVideoEncodeH264NaluSliceInfoKHR::safe_VkVideoEncodeH264NaluSliceInfoKHR(
+    safe_VkVideoEncodeH264NaluSliceInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264NaluSliceInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264NaluSliceInfoKHR& safe_VkVideoEncodeH264NaluSliceInfoKHR::operator=(
+    safe_VkVideoEncodeH264NaluSliceInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(constantQp, move_src.constantQp);
+    std::swap(pStdSliceHeader, move_src.pStdSliceHeader);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264NaluSliceInfoKHR::~safe_VkVideoEncodeH264NaluSliceInfoKHR() {
     if (pStdSliceHeader) delete pStdSliceHeader;
     FreePnextChain(pNext);
@@ -3202,6 +3961,25 @@ safe_VkVideoEncodeH264PictureInfoKHR& safe_VkVideoEncodeH264PictureInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoEncodeH264PictureInfoKHR::safe_VkVideoEncodeH264PictureInfoKHR(safe_VkVideoEncodeH264PictureInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264PictureInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264PictureInfoKHR& safe_VkVideoEncodeH264PictureInfoKHR::operator=(
+    safe_VkVideoEncodeH264PictureInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(naluSliceEntryCount, move_src.naluSliceEntryCount);
+    std::swap(pNaluSliceEntries, move_src.pNaluSliceEntries);
+    std::swap(pStdPictureInfo, move_src.pStdPictureInfo);
+    std::swap(generatePrefixNalu, move_src.generatePrefixNalu);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264PictureInfoKHR::~safe_VkVideoEncodeH264PictureInfoKHR() {
     if (pNaluSliceEntries) delete[] pNaluSliceEntries;
     if (pStdPictureInfo) delete pStdPictureInfo;
@@ -3294,6 +4072,22 @@ safe_VkVideoEncodeH264DpbSlotInfoKHR& safe_VkVideoEncodeH264DpbSlotInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoEncodeH264DpbSlotInfoKHR::safe_VkVideoEncodeH264DpbSlotInfoKHR(safe_VkVideoEncodeH264DpbSlotInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264DpbSlotInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264DpbSlotInfoKHR& safe_VkVideoEncodeH264DpbSlotInfoKHR::operator=(
+    safe_VkVideoEncodeH264DpbSlotInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pStdReferenceInfo, move_src.pStdReferenceInfo);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264DpbSlotInfoKHR::~safe_VkVideoEncodeH264DpbSlotInfoKHR() {
     if (pStdReferenceInfo) delete pStdReferenceInfo;
     FreePnextChain(pNext);
@@ -3354,6 +4148,22 @@ safe_VkVideoEncodeH264ProfileInfoKHR& safe_VkVideoEncodeH264ProfileInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoEncodeH264ProfileInfoKHR::safe_VkVideoEncodeH264ProfileInfoKHR(safe_VkVideoEncodeH264ProfileInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264ProfileInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264ProfileInfoKHR& safe_VkVideoEncodeH264ProfileInfoKHR::operator=(
+    safe_VkVideoEncodeH264ProfileInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stdProfileIdc, move_src.stdProfileIdc);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264ProfileInfoKHR::~safe_VkVideoEncodeH264ProfileInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH264ProfileInfoKHR::initialize(const VkVideoEncodeH264ProfileInfoKHR* in_struct,
@@ -3421,6 +4231,27 @@ safe_VkVideoEncodeH264RateControlInfoKHR& safe_VkVideoEncodeH264RateControlInfoK
     return *this;
 }
 
+safe_VkVideoEncodeH264RateControlInfoKHR::safe_VkVideoEncodeH264RateControlInfoKHR(
+    safe_VkVideoEncodeH264RateControlInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264RateControlInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264RateControlInfoKHR& safe_VkVideoEncodeH264RateControlInfoKHR::operator=(
+    safe_VkVideoEncodeH264RateControlInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(gopFrameCount, move_src.gopFrameCount);
+    std::swap(idrPeriod, move_src.idrPeriod);
+    std::swap(consecutiveBFrameCount, move_src.consecutiveBFrameCount);
+    std::swap(temporalLayerCount, move_src.temporalLayerCount);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264RateControlInfoKHR::~safe_VkVideoEncodeH264RateControlInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH264RateControlInfoKHR::initialize(const VkVideoEncodeH264RateControlInfoKHR* in_struct,
@@ -3500,6 +4331,28 @@ safe_VkVideoEncodeH264RateControlLayerInfoKHR& safe_VkVideoEncodeH264RateControl
     return *this;
 }
 
+safe_VkVideoEncodeH264RateControlLayerInfoKHR::safe_VkVideoEncodeH264RateControlLayerInfoKHR(
+    safe_VkVideoEncodeH264RateControlLayerInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264RateControlLayerInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264RateControlLayerInfoKHR& safe_VkVideoEncodeH264RateControlLayerInfoKHR::operator=(
+    safe_VkVideoEncodeH264RateControlLayerInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(useMinQp, move_src.useMinQp);
+    std::swap(minQp, move_src.minQp);
+    std::swap(useMaxQp, move_src.useMaxQp);
+    std::swap(maxQp, move_src.maxQp);
+    std::swap(useMaxFrameSize, move_src.useMaxFrameSize);
+    std::swap(maxFrameSize, move_src.maxFrameSize);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264RateControlLayerInfoKHR::~safe_VkVideoEncodeH264RateControlLayerInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH264RateControlLayerInfoKHR::initialize(const VkVideoEncodeH264RateControlLayerInfoKHR* in_struct,
@@ -3573,6 +4426,26 @@ safe_VkVideoEncodeH264GopRemainingFrameInfoKHR& safe_VkVideoEncodeH264GopRemaini
     return *this;
 }
 
+safe_VkVideoEncodeH264GopRemainingFrameInfoKHR::safe_VkVideoEncodeH264GopRemainingFrameInfoKHR(
+    safe_VkVideoEncodeH264GopRemainingFrameInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH264GopRemainingFrameInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH264GopRemainingFrameInfoKHR& safe_VkVideoEncodeH264GopRemainingFrameInfoKHR::operator=(
+    safe_VkVideoEncodeH264GopRemainingFrameInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(useGopRemainingFrames, move_src.useGopRemainingFrames);
+    std::swap(gopRemainingI, move_src.gopRemainingI);
+    std::swap(gopRemainingP, move_src.gopRemainingP);
+    std::swap(gopRemainingB, move_src.gopRemainingB);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH264GopRemainingFrameInfoKHR::~safe_VkVideoEncodeH264GopRemainingFrameInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH264GopRemainingFrameInfoKHR::initialize(const VkVideoEncodeH264GopRemainingFrameInfoKHR* in_struct,
@@ -3691,6 +4564,38 @@ safe_VkVideoEncodeH265CapabilitiesKHR& safe_VkVideoEncodeH265CapabilitiesKHR::op
     return *this;
 }
 
+safe_VkVideoEncodeH265CapabilitiesKHR::safe_VkVideoEncodeH265CapabilitiesKHR(
+    safe_VkVideoEncodeH265CapabilitiesKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265CapabilitiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265CapabilitiesKHR& safe_VkVideoEncodeH265CapabilitiesKHR::operator=(
+    safe_VkVideoEncodeH265CapabilitiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(maxLevelIdc, move_src.maxLevelIdc);
+    std::swap(maxSliceSegmentCount, move_src.maxSliceSegmentCount);
+    std::swap(maxTiles, move_src.maxTiles);
+    std::swap(ctbSizes, move_src.ctbSizes);
+    std::swap(transformBlockSizes, move_src.transformBlockSizes);
+    std::swap(maxPPictureL0ReferenceCount, move_src.maxPPictureL0ReferenceCount);
+    std::swap(maxBPictureL0ReferenceCount, move_src.maxBPictureL0ReferenceCount);
+    std::swap(maxL1ReferenceCount, move_src.maxL1ReferenceCount);
+    std::swap(maxSubLayerCount, move_src.maxSubLayerCount);
+    std::swap(expectDyadicTemporalSubLayerPattern, move_src.expectDyadicTemporalSubLayerPattern);
+    std::swap(minQp, move_src.minQp);
+    std::swap(maxQp, move_src.maxQp);
+    std::swap(prefersGopRemainingFrames, move_src.prefersGopRemainingFrames);
+    std::swap(requiresGopRemainingFrames, move_src.requiresGopRemainingFrames);
+    std::swap(stdSyntaxFlags, move_src.stdSyntaxFlags);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265CapabilitiesKHR::~safe_VkVideoEncodeH265CapabilitiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH265CapabilitiesKHR::initialize(const VkVideoEncodeH265CapabilitiesKHR* in_struct,
@@ -3771,6 +4676,24 @@ safe_VkVideoEncodeH265SessionCreateInfoKHR& safe_VkVideoEncodeH265SessionCreateI
     return *this;
 }
 
+safe_VkVideoEncodeH265SessionCreateInfoKHR::safe_VkVideoEncodeH265SessionCreateInfoKHR(
+    safe_VkVideoEncodeH265SessionCreateInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265SessionCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265SessionCreateInfoKHR& safe_VkVideoEncodeH265SessionCreateInfoKHR::operator=(
+    safe_VkVideoEncodeH265SessionCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(useMaxLevelIdc, move_src.useMaxLevelIdc);
+    std::swap(maxLevelIdc, move_src.maxLevelIdc);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265SessionCreateInfoKHR::~safe_VkVideoEncodeH265SessionCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH265SessionCreateInfoKHR::initialize(const VkVideoEncodeH265SessionCreateInfoKHR* in_struct,
@@ -3852,6 +4775,30 @@ safe_VkVideoEncodeH265QualityLevelPropertiesKHR& safe_VkVideoEncodeH265QualityLe
     return *this;
 }
 
+safe_VkVideoEncodeH265QualityLevelPropertiesKHR::safe_VkVideoEncodeH265QualityLevelPropertiesKHR(
+    safe_VkVideoEncodeH265QualityLevelPropertiesKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265QualityLevelPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265QualityLevelPropertiesKHR& safe_VkVideoEncodeH265QualityLevelPropertiesKHR::operator=(
+    safe_VkVideoEncodeH265QualityLevelPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(preferredRateControlFlags, move_src.preferredRateControlFlags);
+    std::swap(preferredGopFrameCount, move_src.preferredGopFrameCount);
+    std::swap(preferredIdrPeriod, move_src.preferredIdrPeriod);
+    std::swap(preferredConsecutiveBFrameCount, move_src.preferredConsecutiveBFrameCount);
+    std::swap(preferredSubLayerCount, move_src.preferredSubLayerCount);
+    std::swap(preferredConstantQp, move_src.preferredConstantQp);
+    std::swap(preferredMaxL0ReferenceCount, move_src.preferredMaxL0ReferenceCount);
+    std::swap(preferredMaxL1ReferenceCount, move_src.preferredMaxL1ReferenceCount);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265QualityLevelPropertiesKHR::~safe_VkVideoEncodeH265QualityLevelPropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH265QualityLevelPropertiesKHR::initialize(const VkVideoEncodeH265QualityLevelPropertiesKHR* in_struct,
@@ -3984,6 +4931,28 @@ safe_VkVideoEncodeH265SessionParametersAddInfoKHR& safe_VkVideoEncodeH265Session
     return *this;
 }
 
+safe_VkVideoEncodeH265SessionParametersAddInfoKHR::safe_VkVideoEncodeH265SessionParametersAddInfoKHR(
+    safe_VkVideoEncodeH265SessionParametersAddInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265SessionParametersAddInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265SessionParametersAddInfoKHR& safe_VkVideoEncodeH265SessionParametersAddInfoKHR::operator=(
+    safe_VkVideoEncodeH265SessionParametersAddInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stdVPSCount, move_src.stdVPSCount);
+    std::swap(pStdVPSs, move_src.pStdVPSs);
+    std::swap(stdSPSCount, move_src.stdSPSCount);
+    std::swap(pStdSPSs, move_src.pStdSPSs);
+    std::swap(stdPPSCount, move_src.stdPPSCount);
+    std::swap(pStdPPSs, move_src.pStdPPSs);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265SessionParametersAddInfoKHR::~safe_VkVideoEncodeH265SessionParametersAddInfoKHR() {
     if (pStdVPSs) delete[] pStdVPSs;
     if (pStdSPSs) delete[] pStdSPSs;
@@ -4102,6 +5071,26 @@ safe_VkVideoEncodeH265SessionParametersCreateInfoKHR& safe_VkVideoEncodeH265Sess
     return *this;
 }
 
+safe_VkVideoEncodeH265SessionParametersCreateInfoKHR::safe_VkVideoEncodeH265SessionParametersCreateInfoKHR(
+    safe_VkVideoEncodeH265SessionParametersCreateInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265SessionParametersCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265SessionParametersCreateInfoKHR& safe_VkVideoEncodeH265SessionParametersCreateInfoKHR::operator=(
+    safe_VkVideoEncodeH265SessionParametersCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxStdVPSCount, move_src.maxStdVPSCount);
+    std::swap(maxStdSPSCount, move_src.maxStdSPSCount);
+    std::swap(maxStdPPSCount, move_src.maxStdPPSCount);
+    std::swap(pParametersAddInfo, move_src.pParametersAddInfo);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265SessionParametersCreateInfoKHR::~safe_VkVideoEncodeH265SessionParametersCreateInfoKHR() {
     if (pParametersAddInfo) delete pParametersAddInfo;
     FreePnextChain(pNext);
@@ -4187,6 +5176,28 @@ safe_VkVideoEncodeH265SessionParametersGetInfoKHR& safe_VkVideoEncodeH265Session
     return *this;
 }
 
+safe_VkVideoEncodeH265SessionParametersGetInfoKHR::safe_VkVideoEncodeH265SessionParametersGetInfoKHR(
+    safe_VkVideoEncodeH265SessionParametersGetInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265SessionParametersGetInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265SessionParametersGetInfoKHR& safe_VkVideoEncodeH265SessionParametersGetInfoKHR::operator=(
+    safe_VkVideoEncodeH265SessionParametersGetInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(writeStdVPS, move_src.writeStdVPS);
+    std::swap(writeStdSPS, move_src.writeStdSPS);
+    std::swap(writeStdPPS, move_src.writeStdPPS);
+    std::swap(stdVPSId, move_src.stdVPSId);
+    std::swap(stdSPSId, move_src.stdSPSId);
+    std::swap(stdPPSId, move_src.stdPPSId);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265SessionParametersGetInfoKHR::~safe_VkVideoEncodeH265SessionParametersGetInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH265SessionParametersGetInfoKHR::initialize(const VkVideoEncodeH265SessionParametersGetInfoKHR* in_struct,
@@ -4257,6 +5268,25 @@ safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR& safe_VkVideoEncodeH265Se
     return *this;
 }
 
+safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR::safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR(
+    safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR& safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR::operator=(
+    safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(hasStdVPSOverrides, move_src.hasStdVPSOverrides);
+    std::swap(hasStdSPSOverrides, move_src.hasStdSPSOverrides);
+    std::swap(hasStdPPSOverrides, move_src.hasStdPPSOverrides);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR::~safe_VkVideoEncodeH265SessionParametersFeedbackInfoKHR() {
     FreePnextChain(pNext);
 }
@@ -4328,6 +5358,24 @@ safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR& safe_VkVideoEncodeH265NaluSliceSe
     return *this;
 }
 
+safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR::safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR(
+    safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR& safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR::operator=(
+    safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(constantQp, move_src.constantQp);
+    std::swap(pStdSliceSegmentHeader, move_src.pStdSliceSegmentHeader);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR::~safe_VkVideoEncodeH265NaluSliceSegmentInfoKHR() {
     if (pStdSliceSegmentHeader) delete pStdSliceSegmentHeader;
     FreePnextChain(pNext);
@@ -4433,6 +5481,24 @@ safe_VkVideoEncodeH265PictureInfoKHR& safe_VkVideoEncodeH265PictureInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoEncodeH265PictureInfoKHR::safe_VkVideoEncodeH265PictureInfoKHR(safe_VkVideoEncodeH265PictureInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265PictureInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265PictureInfoKHR& safe_VkVideoEncodeH265PictureInfoKHR::operator=(
+    safe_VkVideoEncodeH265PictureInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(naluSliceSegmentEntryCount, move_src.naluSliceSegmentEntryCount);
+    std::swap(pNaluSliceSegmentEntries, move_src.pNaluSliceSegmentEntries);
+    std::swap(pStdPictureInfo, move_src.pStdPictureInfo);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265PictureInfoKHR::~safe_VkVideoEncodeH265PictureInfoKHR() {
     if (pNaluSliceSegmentEntries) delete[] pNaluSliceSegmentEntries;
     if (pStdPictureInfo) delete pStdPictureInfo;
@@ -4523,6 +5589,22 @@ safe_VkVideoEncodeH265DpbSlotInfoKHR& safe_VkVideoEncodeH265DpbSlotInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoEncodeH265DpbSlotInfoKHR::safe_VkVideoEncodeH265DpbSlotInfoKHR(safe_VkVideoEncodeH265DpbSlotInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265DpbSlotInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265DpbSlotInfoKHR& safe_VkVideoEncodeH265DpbSlotInfoKHR::operator=(
+    safe_VkVideoEncodeH265DpbSlotInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pStdReferenceInfo, move_src.pStdReferenceInfo);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265DpbSlotInfoKHR::~safe_VkVideoEncodeH265DpbSlotInfoKHR() {
     if (pStdReferenceInfo) delete pStdReferenceInfo;
     FreePnextChain(pNext);
@@ -4583,6 +5665,22 @@ safe_VkVideoEncodeH265ProfileInfoKHR& safe_VkVideoEncodeH265ProfileInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoEncodeH265ProfileInfoKHR::safe_VkVideoEncodeH265ProfileInfoKHR(safe_VkVideoEncodeH265ProfileInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265ProfileInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265ProfileInfoKHR& safe_VkVideoEncodeH265ProfileInfoKHR::operator=(
+    safe_VkVideoEncodeH265ProfileInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stdProfileIdc, move_src.stdProfileIdc);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265ProfileInfoKHR::~safe_VkVideoEncodeH265ProfileInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH265ProfileInfoKHR::initialize(const VkVideoEncodeH265ProfileInfoKHR* in_struct,
@@ -4650,6 +5748,27 @@ safe_VkVideoEncodeH265RateControlInfoKHR& safe_VkVideoEncodeH265RateControlInfoK
     return *this;
 }
 
+safe_VkVideoEncodeH265RateControlInfoKHR::safe_VkVideoEncodeH265RateControlInfoKHR(
+    safe_VkVideoEncodeH265RateControlInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265RateControlInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265RateControlInfoKHR& safe_VkVideoEncodeH265RateControlInfoKHR::operator=(
+    safe_VkVideoEncodeH265RateControlInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(gopFrameCount, move_src.gopFrameCount);
+    std::swap(idrPeriod, move_src.idrPeriod);
+    std::swap(consecutiveBFrameCount, move_src.consecutiveBFrameCount);
+    std::swap(subLayerCount, move_src.subLayerCount);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265RateControlInfoKHR::~safe_VkVideoEncodeH265RateControlInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH265RateControlInfoKHR::initialize(const VkVideoEncodeH265RateControlInfoKHR* in_struct,
@@ -4729,6 +5848,28 @@ safe_VkVideoEncodeH265RateControlLayerInfoKHR& safe_VkVideoEncodeH265RateControl
     return *this;
 }
 
+safe_VkVideoEncodeH265RateControlLayerInfoKHR::safe_VkVideoEncodeH265RateControlLayerInfoKHR(
+    safe_VkVideoEncodeH265RateControlLayerInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265RateControlLayerInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265RateControlLayerInfoKHR& safe_VkVideoEncodeH265RateControlLayerInfoKHR::operator=(
+    safe_VkVideoEncodeH265RateControlLayerInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(useMinQp, move_src.useMinQp);
+    std::swap(minQp, move_src.minQp);
+    std::swap(useMaxQp, move_src.useMaxQp);
+    std::swap(maxQp, move_src.maxQp);
+    std::swap(useMaxFrameSize, move_src.useMaxFrameSize);
+    std::swap(maxFrameSize, move_src.maxFrameSize);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265RateControlLayerInfoKHR::~safe_VkVideoEncodeH265RateControlLayerInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH265RateControlLayerInfoKHR::initialize(const VkVideoEncodeH265RateControlLayerInfoKHR* in_struct,
@@ -4802,6 +5943,26 @@ safe_VkVideoEncodeH265GopRemainingFrameInfoKHR& safe_VkVideoEncodeH265GopRemaini
     return *this;
 }
 
+safe_VkVideoEncodeH265GopRemainingFrameInfoKHR::safe_VkVideoEncodeH265GopRemainingFrameInfoKHR(
+    safe_VkVideoEncodeH265GopRemainingFrameInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeH265GopRemainingFrameInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeH265GopRemainingFrameInfoKHR& safe_VkVideoEncodeH265GopRemainingFrameInfoKHR::operator=(
+    safe_VkVideoEncodeH265GopRemainingFrameInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(useGopRemainingFrames, move_src.useGopRemainingFrames);
+    std::swap(gopRemainingI, move_src.gopRemainingI);
+    std::swap(gopRemainingP, move_src.gopRemainingP);
+    std::swap(gopRemainingB, move_src.gopRemainingB);
+
+    return *this;
+}
+
 safe_VkVideoEncodeH265GopRemainingFrameInfoKHR::~safe_VkVideoEncodeH265GopRemainingFrameInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeH265GopRemainingFrameInfoKHR::initialize(const VkVideoEncodeH265GopRemainingFrameInfoKHR* in_struct,
@@ -4858,6 +6019,23 @@ safe_VkVideoDecodeH264ProfileInfoKHR& safe_VkVideoDecodeH264ProfileInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoDecodeH264ProfileInfoKHR::safe_VkVideoDecodeH264ProfileInfoKHR(safe_VkVideoDecodeH264ProfileInfoKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH264ProfileInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeH264ProfileInfoKHR& safe_VkVideoDecodeH264ProfileInfoKHR::operator=(
+    safe_VkVideoDecodeH264ProfileInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stdProfileIdc, move_src.stdProfileIdc);
+    std::swap(pictureLayout, move_src.pictureLayout);
+
+    return *this;
+}
+
 safe_VkVideoDecodeH264ProfileInfoKHR::~safe_VkVideoDecodeH264ProfileInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoDecodeH264ProfileInfoKHR::initialize(const VkVideoDecodeH264ProfileInfoKHR* in_struct,
@@ -4911,6 +6089,24 @@ safe_VkVideoDecodeH264CapabilitiesKHR& safe_VkVideoDecodeH264CapabilitiesKHR::op
     return *this;
 }
 
+safe_VkVideoDecodeH264CapabilitiesKHR::safe_VkVideoDecodeH264CapabilitiesKHR(
+    safe_VkVideoDecodeH264CapabilitiesKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH264CapabilitiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeH264CapabilitiesKHR& safe_VkVideoDecodeH264CapabilitiesKHR::operator=(
+    safe_VkVideoDecodeH264CapabilitiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxLevelIdc, move_src.maxLevelIdc);
+    std::swap(fieldOffsetGranularity, move_src.fieldOffsetGranularity);
+
+    return *this;
+}
+
 safe_VkVideoDecodeH264CapabilitiesKHR::~safe_VkVideoDecodeH264CapabilitiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoDecodeH264CapabilitiesKHR::initialize(const VkVideoDecodeH264CapabilitiesKHR* in_struct,
@@ -5007,13 +6203,33 @@ safe_VkVideoDecodeH264SessionParametersAddInfoKHR& safe_VkVideoDecodeH264Session
     return *this;
 }
 
-safe_VkVideoDecodeH264SessionParametersAddInfoKHR::~safe_VkVideoDecodeH264SessionParametersAddInfoKHR() {
-    if (pStdSPSs) delete[] pStdSPSs;
-    if (pStdPPSs) delete[] pStdPPSs;
-    FreePnextChain(pNext);
+safe_VkVideoDecodeH264SessionParametersAddInfoKHR::safe_VkVideoDecodeH264SessionParametersAddInfoKHR(
+    safe_VkVideoDecodeH264SessionParametersAddInfoKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH264SessionParametersAddInfoKHR() {
+    *this = std::move(move_src);
 }
 
-void safe_VkVideoDecodeH264SessionParametersAddInfoKHR::initialize(const VkVideoDecodeH264SessionParametersAddInfoKHR* in_struct,
+safe_VkVideoDecodeH264SessionParametersAddInfoKHR& safe_VkVideoDecodeH264SessionParametersAddInfoKHR::operator=(
+    safe_VkVideoDecodeH264SessionParametersAddInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stdSPSCount, move_src.stdSPSCount);
+    std::swap(pStdSPSs, move_src.pStdSPSs);
+    std::swap(stdPPSCount, move_src.stdPPSCount);
+    std::swap(pStdPPSs, move_src.pStdPPSs);
+
+    return *this;
+}
+
+safe_VkVideoDecodeH264SessionParametersAddInfoKHR::~safe_VkVideoDecodeH264SessionParametersAddInfoKHR() {
+    if (pStdSPSs) delete[] pStdSPSs;
+    if (pStdPPSs) delete[] pStdPPSs;
+    FreePnextChain(pNext);
+}
+
+void safe_VkVideoDecodeH264SessionParametersAddInfoKHR::initialize(const VkVideoDecodeH264SessionParametersAddInfoKHR* in_struct,
                                                                    [[maybe_unused]] PNextCopyState* copy_state) {
     if (pStdSPSs) delete[] pStdSPSs;
     if (pStdPPSs) delete[] pStdPPSs;
@@ -5105,6 +6321,25 @@ safe_VkVideoDecodeH264SessionParametersCreateInfoKHR& safe_VkVideoDecodeH264Sess
     return *this;
 }
 
+safe_VkVideoDecodeH264SessionParametersCreateInfoKHR::safe_VkVideoDecodeH264SessionParametersCreateInfoKHR(
+    safe_VkVideoDecodeH264SessionParametersCreateInfoKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH264SessionParametersCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeH264SessionParametersCreateInfoKHR& safe_VkVideoDecodeH264SessionParametersCreateInfoKHR::operator=(
+    safe_VkVideoDecodeH264SessionParametersCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxStdSPSCount, move_src.maxStdSPSCount);
+    std::swap(maxStdPPSCount, move_src.maxStdPPSCount);
+    std::swap(pParametersAddInfo, move_src.pParametersAddInfo);
+
+    return *this;
+}
+
 safe_VkVideoDecodeH264SessionParametersCreateInfoKHR::~safe_VkVideoDecodeH264SessionParametersCreateInfoKHR() {
     if (pParametersAddInfo) delete pParametersAddInfo;
     FreePnextChain(pNext);
@@ -5201,6 +6436,24 @@ safe_VkVideoDecodeH264PictureInfoKHR& safe_VkVideoDecodeH264PictureInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoDecodeH264PictureInfoKHR::safe_VkVideoDecodeH264PictureInfoKHR(safe_VkVideoDecodeH264PictureInfoKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH264PictureInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeH264PictureInfoKHR& safe_VkVideoDecodeH264PictureInfoKHR::operator=(
+    safe_VkVideoDecodeH264PictureInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pStdPictureInfo, move_src.pStdPictureInfo);
+    std::swap(sliceCount, move_src.sliceCount);
+    std::swap(pSliceOffsets, move_src.pSliceOffsets);
+
+    return *this;
+}
+
 safe_VkVideoDecodeH264PictureInfoKHR::~safe_VkVideoDecodeH264PictureInfoKHR() {
     if (pStdPictureInfo) delete pStdPictureInfo;
     if (pSliceOffsets) delete[] pSliceOffsets;
@@ -5289,6 +6542,22 @@ safe_VkVideoDecodeH264DpbSlotInfoKHR& safe_VkVideoDecodeH264DpbSlotInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoDecodeH264DpbSlotInfoKHR::safe_VkVideoDecodeH264DpbSlotInfoKHR(safe_VkVideoDecodeH264DpbSlotInfoKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH264DpbSlotInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeH264DpbSlotInfoKHR& safe_VkVideoDecodeH264DpbSlotInfoKHR::operator=(
+    safe_VkVideoDecodeH264DpbSlotInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pStdReferenceInfo, move_src.pStdReferenceInfo);
+
+    return *this;
+}
+
 safe_VkVideoDecodeH264DpbSlotInfoKHR::~safe_VkVideoDecodeH264DpbSlotInfoKHR() {
     if (pStdReferenceInfo) delete pStdReferenceInfo;
     FreePnextChain(pNext);
@@ -5360,6 +6629,25 @@ safe_VkRenderingFragmentShadingRateAttachmentInfoKHR& safe_VkRenderingFragmentSh
     return *this;
 }
 
+safe_VkRenderingFragmentShadingRateAttachmentInfoKHR::safe_VkRenderingFragmentShadingRateAttachmentInfoKHR(
+    safe_VkRenderingFragmentShadingRateAttachmentInfoKHR&& move_src) noexcept
+    : safe_VkRenderingFragmentShadingRateAttachmentInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderingFragmentShadingRateAttachmentInfoKHR& safe_VkRenderingFragmentShadingRateAttachmentInfoKHR::operator=(
+    safe_VkRenderingFragmentShadingRateAttachmentInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageView, move_src.imageView);
+    std::swap(imageLayout, move_src.imageLayout);
+    std::swap(shadingRateAttachmentTexelSize, move_src.shadingRateAttachmentTexelSize);
+
+    return *this;
+}
+
 safe_VkRenderingFragmentShadingRateAttachmentInfoKHR::~safe_VkRenderingFragmentShadingRateAttachmentInfoKHR() {
     FreePnextChain(pNext);
 }
@@ -5420,6 +6708,25 @@ safe_VkImportMemoryWin32HandleInfoKHR& safe_VkImportMemoryWin32HandleInfoKHR::op
     return *this;
 }
 
+safe_VkImportMemoryWin32HandleInfoKHR::safe_VkImportMemoryWin32HandleInfoKHR(
+    safe_VkImportMemoryWin32HandleInfoKHR&& move_src) noexcept
+    : safe_VkImportMemoryWin32HandleInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportMemoryWin32HandleInfoKHR& safe_VkImportMemoryWin32HandleInfoKHR::operator=(
+    safe_VkImportMemoryWin32HandleInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleType, move_src.handleType);
+    std::swap(handle, move_src.handle);
+    std::swap(name, move_src.name);
+
+    return *this;
+}
+
 safe_VkImportMemoryWin32HandleInfoKHR::~safe_VkImportMemoryWin32HandleInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkImportMemoryWin32HandleInfoKHR::initialize(const VkImportMemoryWin32HandleInfoKHR* in_struct,
@@ -5489,6 +6796,25 @@ safe_VkExportMemoryWin32HandleInfoKHR& safe_VkExportMemoryWin32HandleInfoKHR::op
     return *this;
 }
 
+safe_VkExportMemoryWin32HandleInfoKHR::safe_VkExportMemoryWin32HandleInfoKHR(
+    safe_VkExportMemoryWin32HandleInfoKHR&& move_src) noexcept
+    : safe_VkExportMemoryWin32HandleInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMemoryWin32HandleInfoKHR& safe_VkExportMemoryWin32HandleInfoKHR::operator=(
+    safe_VkExportMemoryWin32HandleInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pAttributes, move_src.pAttributes);
+    std::swap(dwAccess, move_src.dwAccess);
+    std::swap(name, move_src.name);
+
+    return *this;
+}
+
 safe_VkExportMemoryWin32HandleInfoKHR::~safe_VkExportMemoryWin32HandleInfoKHR() {
     if (pAttributes) delete pAttributes;
     FreePnextChain(pNext);
@@ -5554,6 +6880,23 @@ safe_VkMemoryWin32HandlePropertiesKHR& safe_VkMemoryWin32HandlePropertiesKHR::op
     return *this;
 }
 
+safe_VkMemoryWin32HandlePropertiesKHR::safe_VkMemoryWin32HandlePropertiesKHR(
+    safe_VkMemoryWin32HandlePropertiesKHR&& move_src) noexcept
+    : safe_VkMemoryWin32HandlePropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryWin32HandlePropertiesKHR& safe_VkMemoryWin32HandlePropertiesKHR::operator=(
+    safe_VkMemoryWin32HandlePropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryTypeBits, move_src.memoryTypeBits);
+
+    return *this;
+}
+
 safe_VkMemoryWin32HandlePropertiesKHR::~safe_VkMemoryWin32HandlePropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkMemoryWin32HandlePropertiesKHR::initialize(const VkMemoryWin32HandlePropertiesKHR* in_struct,
@@ -5603,6 +6946,23 @@ safe_VkMemoryGetWin32HandleInfoKHR& safe_VkMemoryGetWin32HandleInfoKHR::operator
     return *this;
 }
 
+safe_VkMemoryGetWin32HandleInfoKHR::safe_VkMemoryGetWin32HandleInfoKHR(safe_VkMemoryGetWin32HandleInfoKHR&& move_src) noexcept
+    : safe_VkMemoryGetWin32HandleInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryGetWin32HandleInfoKHR& safe_VkMemoryGetWin32HandleInfoKHR::operator=(
+    safe_VkMemoryGetWin32HandleInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memory, move_src.memory);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkMemoryGetWin32HandleInfoKHR::~safe_VkMemoryGetWin32HandleInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkMemoryGetWin32HandleInfoKHR::initialize(const VkMemoryGetWin32HandleInfoKHR* in_struct,
@@ -5654,6 +7014,22 @@ safe_VkImportMemoryFdInfoKHR& safe_VkImportMemoryFdInfoKHR::operator=(const safe
     return *this;
 }
 
+safe_VkImportMemoryFdInfoKHR::safe_VkImportMemoryFdInfoKHR(safe_VkImportMemoryFdInfoKHR&& move_src) noexcept
+    : safe_VkImportMemoryFdInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportMemoryFdInfoKHR& safe_VkImportMemoryFdInfoKHR::operator=(safe_VkImportMemoryFdInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleType, move_src.handleType);
+    std::swap(fd, move_src.fd);
+
+    return *this;
+}
+
 safe_VkImportMemoryFdInfoKHR::~safe_VkImportMemoryFdInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkImportMemoryFdInfoKHR::initialize(const VkImportMemoryFdInfoKHR* in_struct,
@@ -5702,6 +7078,21 @@ safe_VkMemoryFdPropertiesKHR& safe_VkMemoryFdPropertiesKHR::operator=(const safe
     return *this;
 }
 
+safe_VkMemoryFdPropertiesKHR::safe_VkMemoryFdPropertiesKHR(safe_VkMemoryFdPropertiesKHR&& move_src) noexcept
+    : safe_VkMemoryFdPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryFdPropertiesKHR& safe_VkMemoryFdPropertiesKHR::operator=(safe_VkMemoryFdPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryTypeBits, move_src.memoryTypeBits);
+
+    return *this;
+}
+
 safe_VkMemoryFdPropertiesKHR::~safe_VkMemoryFdPropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkMemoryFdPropertiesKHR::initialize(const VkMemoryFdPropertiesKHR* in_struct,
@@ -5750,6 +7141,21 @@ safe_VkMemoryGetFdInfoKHR& safe_VkMemoryGetFdInfoKHR::operator=(const safe_VkMem
     return *this;
 }
 
+safe_VkMemoryGetFdInfoKHR::safe_VkMemoryGetFdInfoKHR(safe_VkMemoryGetFdInfoKHR&& move_src) noexcept : safe_VkMemoryGetFdInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryGetFdInfoKHR& safe_VkMemoryGetFdInfoKHR::operator=(safe_VkMemoryGetFdInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memory, move_src.memory);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkMemoryGetFdInfoKHR::~safe_VkMemoryGetFdInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkMemoryGetFdInfoKHR::initialize(const VkMemoryGetFdInfoKHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -5912,6 +7318,29 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& safe_VkWin32KeyedMutexAcquireReleas
     return *this;
 }
 
+safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::safe_VkWin32KeyedMutexAcquireReleaseInfoKHR(
+    safe_VkWin32KeyedMutexAcquireReleaseInfoKHR&& move_src) noexcept
+    : safe_VkWin32KeyedMutexAcquireReleaseInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::operator=(
+    safe_VkWin32KeyedMutexAcquireReleaseInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(acquireCount, move_src.acquireCount);
+    std::swap(pAcquireSyncs, move_src.pAcquireSyncs);
+    std::swap(pAcquireKeys, move_src.pAcquireKeys);
+    std::swap(pAcquireTimeouts, move_src.pAcquireTimeouts);
+    std::swap(releaseCount, move_src.releaseCount);
+    std::swap(pReleaseSyncs, move_src.pReleaseSyncs);
+    std::swap(pReleaseKeys, move_src.pReleaseKeys);
+
+    return *this;
+}
+
 safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::~safe_VkWin32KeyedMutexAcquireReleaseInfoKHR() {
     if (pAcquireSyncs) delete[] pAcquireSyncs;
     if (pAcquireKeys) delete[] pAcquireKeys;
@@ -6057,6 +7486,27 @@ safe_VkImportSemaphoreWin32HandleInfoKHR& safe_VkImportSemaphoreWin32HandleInfoK
     return *this;
 }
 
+safe_VkImportSemaphoreWin32HandleInfoKHR::safe_VkImportSemaphoreWin32HandleInfoKHR(
+    safe_VkImportSemaphoreWin32HandleInfoKHR&& move_src) noexcept
+    : safe_VkImportSemaphoreWin32HandleInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportSemaphoreWin32HandleInfoKHR& safe_VkImportSemaphoreWin32HandleInfoKHR::operator=(
+    safe_VkImportSemaphoreWin32HandleInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(semaphore, move_src.semaphore);
+    std::swap(flags, move_src.flags);
+    std::swap(handleType, move_src.handleType);
+    std::swap(handle, move_src.handle);
+    std::swap(name, move_src.name);
+
+    return *this;
+}
+
 safe_VkImportSemaphoreWin32HandleInfoKHR::~safe_VkImportSemaphoreWin32HandleInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkImportSemaphoreWin32HandleInfoKHR::initialize(const VkImportSemaphoreWin32HandleInfoKHR* in_struct,
@@ -6129,6 +7579,25 @@ safe_VkExportSemaphoreWin32HandleInfoKHR& safe_VkExportSemaphoreWin32HandleInfoK
     return *this;
 }
 
+safe_VkExportSemaphoreWin32HandleInfoKHR::safe_VkExportSemaphoreWin32HandleInfoKHR(
+    safe_VkExportSemaphoreWin32HandleInfoKHR&& move_src) noexcept
+    : safe_VkExportSemaphoreWin32HandleInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportSemaphoreWin32HandleInfoKHR& safe_VkExportSemaphoreWin32HandleInfoKHR::operator=(
+    safe_VkExportSemaphoreWin32HandleInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pAttributes, move_src.pAttributes);
+    std::swap(dwAccess, move_src.dwAccess);
+    std::swap(name, move_src.name);
+
+    return *this;
+}
+
 safe_VkExportSemaphoreWin32HandleInfoKHR::~safe_VkExportSemaphoreWin32HandleInfoKHR() {
     if (pAttributes) delete pAttributes;
     FreePnextChain(pNext);
@@ -6243,6 +7712,24 @@ safe_VkD3D12FenceSubmitInfoKHR& safe_VkD3D12FenceSubmitInfoKHR::operator=(const
     return *this;
 }
 
+safe_VkD3D12FenceSubmitInfoKHR::safe_VkD3D12FenceSubmitInfoKHR(safe_VkD3D12FenceSubmitInfoKHR&& move_src) noexcept
+    : safe_VkD3D12FenceSubmitInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkD3D12FenceSubmitInfoKHR& safe_VkD3D12FenceSubmitInfoKHR::operator=(safe_VkD3D12FenceSubmitInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(waitSemaphoreValuesCount, move_src.waitSemaphoreValuesCount);
+    std::swap(pWaitSemaphoreValues, move_src.pWaitSemaphoreValues);
+    std::swap(signalSemaphoreValuesCount, move_src.signalSemaphoreValuesCount);
+    std::swap(pSignalSemaphoreValues, move_src.pSignalSemaphoreValues);
+
+    return *this;
+}
+
 safe_VkD3D12FenceSubmitInfoKHR::~safe_VkD3D12FenceSubmitInfoKHR() {
     if (pWaitSemaphoreValues) delete[] pWaitSemaphoreValues;
     if (pSignalSemaphoreValues) delete[] pSignalSemaphoreValues;
@@ -6330,6 +7817,24 @@ safe_VkSemaphoreGetWin32HandleInfoKHR& safe_VkSemaphoreGetWin32HandleInfoKHR::op
     return *this;
 }
 
+safe_VkSemaphoreGetWin32HandleInfoKHR::safe_VkSemaphoreGetWin32HandleInfoKHR(
+    safe_VkSemaphoreGetWin32HandleInfoKHR&& move_src) noexcept
+    : safe_VkSemaphoreGetWin32HandleInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkSemaphoreGetWin32HandleInfoKHR& safe_VkSemaphoreGetWin32HandleInfoKHR::operator=(
+    safe_VkSemaphoreGetWin32HandleInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(semaphore, move_src.semaphore);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkSemaphoreGetWin32HandleInfoKHR::~safe_VkSemaphoreGetWin32HandleInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkSemaphoreGetWin32HandleInfoKHR::initialize(const VkSemaphoreGetWin32HandleInfoKHR* in_struct,
@@ -6389,6 +7894,24 @@ safe_VkImportSemaphoreFdInfoKHR& safe_VkImportSemaphoreFdInfoKHR::operator=(cons
     return *this;
 }
 
+safe_VkImportSemaphoreFdInfoKHR::safe_VkImportSemaphoreFdInfoKHR(safe_VkImportSemaphoreFdInfoKHR&& move_src) noexcept
+    : safe_VkImportSemaphoreFdInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportSemaphoreFdInfoKHR& safe_VkImportSemaphoreFdInfoKHR::operator=(safe_VkImportSemaphoreFdInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(semaphore, move_src.semaphore);
+    std::swap(flags, move_src.flags);
+    std::swap(handleType, move_src.handleType);
+    std::swap(fd, move_src.fd);
+
+    return *this;
+}
+
 safe_VkImportSemaphoreFdInfoKHR::~safe_VkImportSemaphoreFdInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkImportSemaphoreFdInfoKHR::initialize(const VkImportSemaphoreFdInfoKHR* in_struct,
@@ -6443,6 +7966,22 @@ safe_VkSemaphoreGetFdInfoKHR& safe_VkSemaphoreGetFdInfoKHR::operator=(const safe
     return *this;
 }
 
+safe_VkSemaphoreGetFdInfoKHR::safe_VkSemaphoreGetFdInfoKHR(safe_VkSemaphoreGetFdInfoKHR&& move_src) noexcept
+    : safe_VkSemaphoreGetFdInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkSemaphoreGetFdInfoKHR& safe_VkSemaphoreGetFdInfoKHR::operator=(safe_VkSemaphoreGetFdInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(semaphore, move_src.semaphore);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkSemaphoreGetFdInfoKHR::~safe_VkSemaphoreGetFdInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkSemaphoreGetFdInfoKHR::initialize(const VkSemaphoreGetFdInfoKHR* in_struct,
@@ -6493,6 +8032,23 @@ safe_VkPhysicalDevicePushDescriptorPropertiesKHR& safe_VkPhysicalDevicePushDescr
     return *this;
 }
 
+safe_VkPhysicalDevicePushDescriptorPropertiesKHR::safe_VkPhysicalDevicePushDescriptorPropertiesKHR(
+    safe_VkPhysicalDevicePushDescriptorPropertiesKHR&& move_src) noexcept
+    : safe_VkPhysicalDevicePushDescriptorPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePushDescriptorPropertiesKHR& safe_VkPhysicalDevicePushDescriptorPropertiesKHR::operator=(
+    safe_VkPhysicalDevicePushDescriptorPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxPushDescriptors, move_src.maxPushDescriptors);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePushDescriptorPropertiesKHR::~safe_VkPhysicalDevicePushDescriptorPropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePushDescriptorPropertiesKHR::initialize(const VkPhysicalDevicePushDescriptorPropertiesKHR* in_struct,
@@ -6546,6 +8102,19 @@ safe_VkPresentRegionKHR& safe_VkPresentRegionKHR::operator=(const safe_VkPresent
     return *this;
 }
 
+safe_VkPresentRegionKHR::safe_VkPresentRegionKHR(safe_VkPresentRegionKHR&& move_src) noexcept : safe_VkPresentRegionKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPresentRegionKHR& safe_VkPresentRegionKHR::operator=(safe_VkPresentRegionKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(rectangleCount, move_src.rectangleCount);
+    std::swap(pRectangles, move_src.pRectangles);
+
+    return *this;
+}
+
 safe_VkPresentRegionKHR::~safe_VkPresentRegionKHR() {
     if (pRectangles) delete[] pRectangles;
 }
@@ -6621,6 +8190,21 @@ safe_VkPresentRegionsKHR& safe_VkPresentRegionsKHR::operator=(const safe_VkPrese
     return *this;
 }
 
+safe_VkPresentRegionsKHR::safe_VkPresentRegionsKHR(safe_VkPresentRegionsKHR&& move_src) noexcept : safe_VkPresentRegionsKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPresentRegionsKHR& safe_VkPresentRegionsKHR::operator=(safe_VkPresentRegionsKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(swapchainCount, move_src.swapchainCount);
+    std::swap(pRegions, move_src.pRegions);
+
+    return *this;
+}
+
 safe_VkPresentRegionsKHR::~safe_VkPresentRegionsKHR() {
     if (pRegions) delete[] pRegions;
     FreePnextChain(pNext);
@@ -6685,6 +8269,23 @@ safe_VkSharedPresentSurfaceCapabilitiesKHR& safe_VkSharedPresentSurfaceCapabilit
     return *this;
 }
 
+safe_VkSharedPresentSurfaceCapabilitiesKHR::safe_VkSharedPresentSurfaceCapabilitiesKHR(
+    safe_VkSharedPresentSurfaceCapabilitiesKHR&& move_src) noexcept
+    : safe_VkSharedPresentSurfaceCapabilitiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkSharedPresentSurfaceCapabilitiesKHR& safe_VkSharedPresentSurfaceCapabilitiesKHR::operator=(
+    safe_VkSharedPresentSurfaceCapabilitiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(sharedPresentSupportedUsageFlags, move_src.sharedPresentSupportedUsageFlags);
+
+    return *this;
+}
+
 safe_VkSharedPresentSurfaceCapabilitiesKHR::~safe_VkSharedPresentSurfaceCapabilitiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkSharedPresentSurfaceCapabilitiesKHR::initialize(const VkSharedPresentSurfaceCapabilitiesKHR* in_struct,
@@ -6753,6 +8354,26 @@ safe_VkImportFenceWin32HandleInfoKHR& safe_VkImportFenceWin32HandleInfoKHR::oper
     return *this;
 }
 
+safe_VkImportFenceWin32HandleInfoKHR::safe_VkImportFenceWin32HandleInfoKHR(safe_VkImportFenceWin32HandleInfoKHR&& move_src) noexcept
+    : safe_VkImportFenceWin32HandleInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportFenceWin32HandleInfoKHR& safe_VkImportFenceWin32HandleInfoKHR::operator=(
+    safe_VkImportFenceWin32HandleInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fence, move_src.fence);
+    std::swap(flags, move_src.flags);
+    std::swap(handleType, move_src.handleType);
+    std::swap(handle, move_src.handle);
+    std::swap(name, move_src.name);
+
+    return *this;
+}
+
 safe_VkImportFenceWin32HandleInfoKHR::~safe_VkImportFenceWin32HandleInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkImportFenceWin32HandleInfoKHR::initialize(const VkImportFenceWin32HandleInfoKHR* in_struct,
@@ -6825,6 +8446,24 @@ safe_VkExportFenceWin32HandleInfoKHR& safe_VkExportFenceWin32HandleInfoKHR::oper
     return *this;
 }
 
+safe_VkExportFenceWin32HandleInfoKHR::safe_VkExportFenceWin32HandleInfoKHR(safe_VkExportFenceWin32HandleInfoKHR&& move_src) noexcept
+    : safe_VkExportFenceWin32HandleInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportFenceWin32HandleInfoKHR& safe_VkExportFenceWin32HandleInfoKHR::operator=(
+    safe_VkExportFenceWin32HandleInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pAttributes, move_src.pAttributes);
+    std::swap(dwAccess, move_src.dwAccess);
+    std::swap(name, move_src.name);
+
+    return *this;
+}
+
 safe_VkExportFenceWin32HandleInfoKHR::~safe_VkExportFenceWin32HandleInfoKHR() {
     if (pAttributes) delete pAttributes;
     FreePnextChain(pNext);
@@ -6889,6 +8528,23 @@ safe_VkFenceGetWin32HandleInfoKHR& safe_VkFenceGetWin32HandleInfoKHR::operator=(
     return *this;
 }
 
+safe_VkFenceGetWin32HandleInfoKHR::safe_VkFenceGetWin32HandleInfoKHR(safe_VkFenceGetWin32HandleInfoKHR&& move_src) noexcept
+    : safe_VkFenceGetWin32HandleInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkFenceGetWin32HandleInfoKHR& safe_VkFenceGetWin32HandleInfoKHR::operator=(
+    safe_VkFenceGetWin32HandleInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fence, move_src.fence);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkFenceGetWin32HandleInfoKHR::~safe_VkFenceGetWin32HandleInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkFenceGetWin32HandleInfoKHR::initialize(const VkFenceGetWin32HandleInfoKHR* in_struct,
@@ -6948,6 +8604,24 @@ safe_VkImportFenceFdInfoKHR& safe_VkImportFenceFdInfoKHR::operator=(const safe_V
     return *this;
 }
 
+safe_VkImportFenceFdInfoKHR::safe_VkImportFenceFdInfoKHR(safe_VkImportFenceFdInfoKHR&& move_src) noexcept
+    : safe_VkImportFenceFdInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportFenceFdInfoKHR& safe_VkImportFenceFdInfoKHR::operator=(safe_VkImportFenceFdInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fence, move_src.fence);
+    std::swap(flags, move_src.flags);
+    std::swap(handleType, move_src.handleType);
+    std::swap(fd, move_src.fd);
+
+    return *this;
+}
+
 safe_VkImportFenceFdInfoKHR::~safe_VkImportFenceFdInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkImportFenceFdInfoKHR::initialize(const VkImportFenceFdInfoKHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -7001,6 +8675,21 @@ safe_VkFenceGetFdInfoKHR& safe_VkFenceGetFdInfoKHR::operator=(const safe_VkFence
     return *this;
 }
 
+safe_VkFenceGetFdInfoKHR::safe_VkFenceGetFdInfoKHR(safe_VkFenceGetFdInfoKHR&& move_src) noexcept : safe_VkFenceGetFdInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkFenceGetFdInfoKHR& safe_VkFenceGetFdInfoKHR::operator=(safe_VkFenceGetFdInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fence, move_src.fence);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkFenceGetFdInfoKHR::~safe_VkFenceGetFdInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkFenceGetFdInfoKHR::initialize(const VkFenceGetFdInfoKHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -7056,6 +8745,24 @@ safe_VkPhysicalDevicePerformanceQueryFeaturesKHR& safe_VkPhysicalDevicePerforman
     return *this;
 }
 
+safe_VkPhysicalDevicePerformanceQueryFeaturesKHR::safe_VkPhysicalDevicePerformanceQueryFeaturesKHR(
+    safe_VkPhysicalDevicePerformanceQueryFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDevicePerformanceQueryFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePerformanceQueryFeaturesKHR& safe_VkPhysicalDevicePerformanceQueryFeaturesKHR::operator=(
+    safe_VkPhysicalDevicePerformanceQueryFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(performanceCounterQueryPools, move_src.performanceCounterQueryPools);
+    std::swap(performanceCounterMultipleQueryPools, move_src.performanceCounterMultipleQueryPools);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePerformanceQueryFeaturesKHR::~safe_VkPhysicalDevicePerformanceQueryFeaturesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePerformanceQueryFeaturesKHR::initialize(const VkPhysicalDevicePerformanceQueryFeaturesKHR* in_struct,
@@ -7106,6 +8813,23 @@ safe_VkPhysicalDevicePerformanceQueryPropertiesKHR& safe_VkPhysicalDevicePerform
     return *this;
 }
 
+safe_VkPhysicalDevicePerformanceQueryPropertiesKHR::safe_VkPhysicalDevicePerformanceQueryPropertiesKHR(
+    safe_VkPhysicalDevicePerformanceQueryPropertiesKHR&& move_src) noexcept
+    : safe_VkPhysicalDevicePerformanceQueryPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePerformanceQueryPropertiesKHR& safe_VkPhysicalDevicePerformanceQueryPropertiesKHR::operator=(
+    safe_VkPhysicalDevicePerformanceQueryPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(allowCommandBufferQueryCopies, move_src.allowCommandBufferQueryCopies);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePerformanceQueryPropertiesKHR::~safe_VkPhysicalDevicePerformanceQueryPropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePerformanceQueryPropertiesKHR::initialize(const VkPhysicalDevicePerformanceQueryPropertiesKHR* in_struct,
@@ -7167,6 +8891,24 @@ safe_VkPerformanceCounterKHR& safe_VkPerformanceCounterKHR::operator=(const safe
     return *this;
 }
 
+safe_VkPerformanceCounterKHR::safe_VkPerformanceCounterKHR(safe_VkPerformanceCounterKHR&& move_src) noexcept
+    : safe_VkPerformanceCounterKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPerformanceCounterKHR& safe_VkPerformanceCounterKHR::operator=(safe_VkPerformanceCounterKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(unit, move_src.unit);
+    std::swap(scope, move_src.scope);
+    std::swap(storage, move_src.storage);
+    std::swap(uuid, move_src.uuid);
+
+    return *this;
+}
+
 safe_VkPerformanceCounterKHR::~safe_VkPerformanceCounterKHR() { FreePnextChain(pNext); }
 
 void safe_VkPerformanceCounterKHR::initialize(const VkPerformanceCounterKHR* in_struct,
@@ -7262,7 +9004,27 @@ safe_VkPerformanceCounterDescriptionKHR& safe_VkPerformanceCounterDescriptionKHR
     return *this;
 }
 
-safe_VkPerformanceCounterDescriptionKHR::~safe_VkPerformanceCounterDescriptionKHR() { FreePnextChain(pNext); }
+safe_VkPerformanceCounterDescriptionKHR::safe_VkPerformanceCounterDescriptionKHR(
+    safe_VkPerformanceCounterDescriptionKHR&& move_src) noexcept
+    : safe_VkPerformanceCounterDescriptionKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPerformanceCounterDescriptionKHR& safe_VkPerformanceCounterDescriptionKHR::operator=(
+    safe_VkPerformanceCounterDescriptionKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(name, move_src.name);
+    std::swap(category, move_src.category);
+    std::swap(description, move_src.description);
+
+    return *this;
+}
+
+safe_VkPerformanceCounterDescriptionKHR::~safe_VkPerformanceCounterDescriptionKHR() { FreePnextChain(pNext); }
 
 void safe_VkPerformanceCounterDescriptionKHR::initialize(const VkPerformanceCounterDescriptionKHR* in_struct,
                                                          [[maybe_unused]] PNextCopyState* copy_state) {
@@ -7360,6 +9122,25 @@ safe_VkQueryPoolPerformanceCreateInfoKHR& safe_VkQueryPoolPerformanceCreateInfoK
     return *this;
 }
 
+safe_VkQueryPoolPerformanceCreateInfoKHR::safe_VkQueryPoolPerformanceCreateInfoKHR(
+    safe_VkQueryPoolPerformanceCreateInfoKHR&& move_src) noexcept
+    : safe_VkQueryPoolPerformanceCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkQueryPoolPerformanceCreateInfoKHR& safe_VkQueryPoolPerformanceCreateInfoKHR::operator=(
+    safe_VkQueryPoolPerformanceCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(queueFamilyIndex, move_src.queueFamilyIndex);
+    std::swap(counterIndexCount, move_src.counterIndexCount);
+    std::swap(pCounterIndices, move_src.pCounterIndices);
+
+    return *this;
+}
+
 safe_VkQueryPoolPerformanceCreateInfoKHR::~safe_VkQueryPoolPerformanceCreateInfoKHR() {
     if (pCounterIndices) delete[] pCounterIndices;
     FreePnextChain(pNext);
@@ -7427,6 +9208,23 @@ safe_VkAcquireProfilingLockInfoKHR& safe_VkAcquireProfilingLockInfoKHR::operator
     return *this;
 }
 
+safe_VkAcquireProfilingLockInfoKHR::safe_VkAcquireProfilingLockInfoKHR(safe_VkAcquireProfilingLockInfoKHR&& move_src) noexcept
+    : safe_VkAcquireProfilingLockInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkAcquireProfilingLockInfoKHR& safe_VkAcquireProfilingLockInfoKHR::operator=(
+    safe_VkAcquireProfilingLockInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(timeout, move_src.timeout);
+
+    return *this;
+}
+
 safe_VkAcquireProfilingLockInfoKHR::~safe_VkAcquireProfilingLockInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkAcquireProfilingLockInfoKHR::initialize(const VkAcquireProfilingLockInfoKHR* in_struct,
@@ -7477,6 +9275,22 @@ safe_VkPerformanceQuerySubmitInfoKHR& safe_VkPerformanceQuerySubmitInfoKHR::oper
     return *this;
 }
 
+safe_VkPerformanceQuerySubmitInfoKHR::safe_VkPerformanceQuerySubmitInfoKHR(safe_VkPerformanceQuerySubmitInfoKHR&& move_src) noexcept
+    : safe_VkPerformanceQuerySubmitInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPerformanceQuerySubmitInfoKHR& safe_VkPerformanceQuerySubmitInfoKHR::operator=(
+    safe_VkPerformanceQuerySubmitInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(counterPassIndex, move_src.counterPassIndex);
+
+    return *this;
+}
+
 safe_VkPerformanceQuerySubmitInfoKHR::~safe_VkPerformanceQuerySubmitInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkPerformanceQuerySubmitInfoKHR::initialize(const VkPerformanceQuerySubmitInfoKHR* in_struct,
@@ -7525,6 +9339,22 @@ safe_VkPhysicalDeviceSurfaceInfo2KHR& safe_VkPhysicalDeviceSurfaceInfo2KHR::oper
     return *this;
 }
 
+safe_VkPhysicalDeviceSurfaceInfo2KHR::safe_VkPhysicalDeviceSurfaceInfo2KHR(safe_VkPhysicalDeviceSurfaceInfo2KHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceSurfaceInfo2KHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSurfaceInfo2KHR& safe_VkPhysicalDeviceSurfaceInfo2KHR::operator=(
+    safe_VkPhysicalDeviceSurfaceInfo2KHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(surface, move_src.surface);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSurfaceInfo2KHR::~safe_VkPhysicalDeviceSurfaceInfo2KHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceSurfaceInfo2KHR::initialize(const VkPhysicalDeviceSurfaceInfo2KHR* in_struct,
@@ -7571,6 +9401,21 @@ safe_VkSurfaceCapabilities2KHR& safe_VkSurfaceCapabilities2KHR::operator=(const
     return *this;
 }
 
+safe_VkSurfaceCapabilities2KHR::safe_VkSurfaceCapabilities2KHR(safe_VkSurfaceCapabilities2KHR&& move_src) noexcept
+    : safe_VkSurfaceCapabilities2KHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkSurfaceCapabilities2KHR& safe_VkSurfaceCapabilities2KHR::operator=(safe_VkSurfaceCapabilities2KHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(surfaceCapabilities, move_src.surfaceCapabilities);
+
+    return *this;
+}
+
 safe_VkSurfaceCapabilities2KHR::~safe_VkSurfaceCapabilities2KHR() { FreePnextChain(pNext); }
 
 void safe_VkSurfaceCapabilities2KHR::initialize(const VkSurfaceCapabilities2KHR* in_struct,
@@ -7617,6 +9462,20 @@ safe_VkSurfaceFormat2KHR& safe_VkSurfaceFormat2KHR::operator=(const safe_VkSurfa
     return *this;
 }
 
+safe_VkSurfaceFormat2KHR::safe_VkSurfaceFormat2KHR(safe_VkSurfaceFormat2KHR&& move_src) noexcept : safe_VkSurfaceFormat2KHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkSurfaceFormat2KHR& safe_VkSurfaceFormat2KHR::operator=(safe_VkSurfaceFormat2KHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(surfaceFormat, move_src.surfaceFormat);
+
+    return *this;
+}
+
 safe_VkSurfaceFormat2KHR::~safe_VkSurfaceFormat2KHR() { FreePnextChain(pNext); }
 
 void safe_VkSurfaceFormat2KHR::initialize(const VkSurfaceFormat2KHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -7660,6 +9519,21 @@ safe_VkDisplayProperties2KHR& safe_VkDisplayProperties2KHR::operator=(const safe
     return *this;
 }
 
+safe_VkDisplayProperties2KHR::safe_VkDisplayProperties2KHR(safe_VkDisplayProperties2KHR&& move_src) noexcept
+    : safe_VkDisplayProperties2KHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplayProperties2KHR& safe_VkDisplayProperties2KHR::operator=(safe_VkDisplayProperties2KHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(displayProperties, move_src.displayProperties);
+
+    return *this;
+}
+
 safe_VkDisplayProperties2KHR::~safe_VkDisplayProperties2KHR() { FreePnextChain(pNext); }
 
 void safe_VkDisplayProperties2KHR::initialize(const VkDisplayProperties2KHR* in_struct,
@@ -7706,6 +9580,22 @@ safe_VkDisplayPlaneProperties2KHR& safe_VkDisplayPlaneProperties2KHR::operator=(
     return *this;
 }
 
+safe_VkDisplayPlaneProperties2KHR::safe_VkDisplayPlaneProperties2KHR(safe_VkDisplayPlaneProperties2KHR&& move_src) noexcept
+    : safe_VkDisplayPlaneProperties2KHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplayPlaneProperties2KHR& safe_VkDisplayPlaneProperties2KHR::operator=(
+    safe_VkDisplayPlaneProperties2KHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(displayPlaneProperties, move_src.displayPlaneProperties);
+
+    return *this;
+}
+
 safe_VkDisplayPlaneProperties2KHR::~safe_VkDisplayPlaneProperties2KHR() { FreePnextChain(pNext); }
 
 void safe_VkDisplayPlaneProperties2KHR::initialize(const VkDisplayPlaneProperties2KHR* in_struct,
@@ -7752,6 +9642,22 @@ safe_VkDisplayModeProperties2KHR& safe_VkDisplayModeProperties2KHR::operator=(co
     return *this;
 }
 
+safe_VkDisplayModeProperties2KHR::safe_VkDisplayModeProperties2KHR(safe_VkDisplayModeProperties2KHR&& move_src) noexcept
+    : safe_VkDisplayModeProperties2KHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplayModeProperties2KHR& safe_VkDisplayModeProperties2KHR::operator=(
+    safe_VkDisplayModeProperties2KHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(displayModeProperties, move_src.displayModeProperties);
+
+    return *this;
+}
+
 safe_VkDisplayModeProperties2KHR::~safe_VkDisplayModeProperties2KHR() { FreePnextChain(pNext); }
 
 void safe_VkDisplayModeProperties2KHR::initialize(const VkDisplayModeProperties2KHR* in_struct,
@@ -7800,6 +9706,22 @@ safe_VkDisplayPlaneInfo2KHR& safe_VkDisplayPlaneInfo2KHR::operator=(const safe_V
     return *this;
 }
 
+safe_VkDisplayPlaneInfo2KHR::safe_VkDisplayPlaneInfo2KHR(safe_VkDisplayPlaneInfo2KHR&& move_src) noexcept
+    : safe_VkDisplayPlaneInfo2KHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplayPlaneInfo2KHR& safe_VkDisplayPlaneInfo2KHR::operator=(safe_VkDisplayPlaneInfo2KHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(mode, move_src.mode);
+    std::swap(planeIndex, move_src.planeIndex);
+
+    return *this;
+}
+
 safe_VkDisplayPlaneInfo2KHR::~safe_VkDisplayPlaneInfo2KHR() { FreePnextChain(pNext); }
 
 void safe_VkDisplayPlaneInfo2KHR::initialize(const VkDisplayPlaneInfo2KHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -7849,6 +9771,22 @@ safe_VkDisplayPlaneCapabilities2KHR& safe_VkDisplayPlaneCapabilities2KHR::operat
     return *this;
 }
 
+safe_VkDisplayPlaneCapabilities2KHR::safe_VkDisplayPlaneCapabilities2KHR(safe_VkDisplayPlaneCapabilities2KHR&& move_src) noexcept
+    : safe_VkDisplayPlaneCapabilities2KHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplayPlaneCapabilities2KHR& safe_VkDisplayPlaneCapabilities2KHR::operator=(
+    safe_VkDisplayPlaneCapabilities2KHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(capabilities, move_src.capabilities);
+
+    return *this;
+}
+
 safe_VkDisplayPlaneCapabilities2KHR::~safe_VkDisplayPlaneCapabilities2KHR() { FreePnextChain(pNext); }
 
 void safe_VkDisplayPlaneCapabilities2KHR::initialize(const VkDisplayPlaneCapabilities2KHR* in_struct,
@@ -7957,6 +9895,37 @@ safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR& safe_VkPhysicalDevicePortabil
     return *this;
 }
 
+safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR::safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR(
+    safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR& safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR::operator=(
+    safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(constantAlphaColorBlendFactors, move_src.constantAlphaColorBlendFactors);
+    std::swap(events, move_src.events);
+    std::swap(imageViewFormatReinterpretation, move_src.imageViewFormatReinterpretation);
+    std::swap(imageViewFormatSwizzle, move_src.imageViewFormatSwizzle);
+    std::swap(imageView2DOn3DImage, move_src.imageView2DOn3DImage);
+    std::swap(multisampleArrayImage, move_src.multisampleArrayImage);
+    std::swap(mutableComparisonSamplers, move_src.mutableComparisonSamplers);
+    std::swap(pointPolygons, move_src.pointPolygons);
+    std::swap(samplerMipLodBias, move_src.samplerMipLodBias);
+    std::swap(separateStencilMaskRef, move_src.separateStencilMaskRef);
+    std::swap(shaderSampleRateInterpolationFunctions, move_src.shaderSampleRateInterpolationFunctions);
+    std::swap(tessellationIsolines, move_src.tessellationIsolines);
+    std::swap(tessellationPointMode, move_src.tessellationPointMode);
+    std::swap(triangleFans, move_src.triangleFans);
+    std::swap(vertexAttributeAccessBeyondStride, move_src.vertexAttributeAccessBeyondStride);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR::~safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR::initialize(const VkPhysicalDevicePortabilitySubsetFeaturesKHR* in_struct,
@@ -8035,6 +10004,23 @@ safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR& safe_VkPhysicalDevicePortab
     return *this;
 }
 
+safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR::safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR(
+    safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR&& move_src) noexcept
+    : safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR& safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR::operator=(
+    safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(minVertexInputBindingStrideAlignment, move_src.minVertexInputBindingStrideAlignment);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR::~safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR() {
     FreePnextChain(pNext);
 }
@@ -8093,6 +10079,24 @@ safe_VkPhysicalDeviceShaderClockFeaturesKHR& safe_VkPhysicalDeviceShaderClockFea
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderClockFeaturesKHR::safe_VkPhysicalDeviceShaderClockFeaturesKHR(
+    safe_VkPhysicalDeviceShaderClockFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderClockFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderClockFeaturesKHR& safe_VkPhysicalDeviceShaderClockFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceShaderClockFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderSubgroupClock, move_src.shaderSubgroupClock);
+    std::swap(shaderDeviceClock, move_src.shaderDeviceClock);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderClockFeaturesKHR::~safe_VkPhysicalDeviceShaderClockFeaturesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderClockFeaturesKHR::initialize(const VkPhysicalDeviceShaderClockFeaturesKHR* in_struct,
@@ -8143,6 +10147,22 @@ safe_VkVideoDecodeH265ProfileInfoKHR& safe_VkVideoDecodeH265ProfileInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoDecodeH265ProfileInfoKHR::safe_VkVideoDecodeH265ProfileInfoKHR(safe_VkVideoDecodeH265ProfileInfoKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH265ProfileInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeH265ProfileInfoKHR& safe_VkVideoDecodeH265ProfileInfoKHR::operator=(
+    safe_VkVideoDecodeH265ProfileInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stdProfileIdc, move_src.stdProfileIdc);
+
+    return *this;
+}
+
 safe_VkVideoDecodeH265ProfileInfoKHR::~safe_VkVideoDecodeH265ProfileInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoDecodeH265ProfileInfoKHR::initialize(const VkVideoDecodeH265ProfileInfoKHR* in_struct,
@@ -8192,6 +10212,23 @@ safe_VkVideoDecodeH265CapabilitiesKHR& safe_VkVideoDecodeH265CapabilitiesKHR::op
     return *this;
 }
 
+safe_VkVideoDecodeH265CapabilitiesKHR::safe_VkVideoDecodeH265CapabilitiesKHR(
+    safe_VkVideoDecodeH265CapabilitiesKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH265CapabilitiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeH265CapabilitiesKHR& safe_VkVideoDecodeH265CapabilitiesKHR::operator=(
+    safe_VkVideoDecodeH265CapabilitiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxLevelIdc, move_src.maxLevelIdc);
+
+    return *this;
+}
+
 safe_VkVideoDecodeH265CapabilitiesKHR::~safe_VkVideoDecodeH265CapabilitiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoDecodeH265CapabilitiesKHR::initialize(const VkVideoDecodeH265CapabilitiesKHR* in_struct,
@@ -8310,6 +10347,28 @@ safe_VkVideoDecodeH265SessionParametersAddInfoKHR& safe_VkVideoDecodeH265Session
     return *this;
 }
 
+safe_VkVideoDecodeH265SessionParametersAddInfoKHR::safe_VkVideoDecodeH265SessionParametersAddInfoKHR(
+    safe_VkVideoDecodeH265SessionParametersAddInfoKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH265SessionParametersAddInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeH265SessionParametersAddInfoKHR& safe_VkVideoDecodeH265SessionParametersAddInfoKHR::operator=(
+    safe_VkVideoDecodeH265SessionParametersAddInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stdVPSCount, move_src.stdVPSCount);
+    std::swap(pStdVPSs, move_src.pStdVPSs);
+    std::swap(stdSPSCount, move_src.stdSPSCount);
+    std::swap(pStdSPSs, move_src.pStdSPSs);
+    std::swap(stdPPSCount, move_src.stdPPSCount);
+    std::swap(pStdPPSs, move_src.pStdPPSs);
+
+    return *this;
+}
+
 safe_VkVideoDecodeH265SessionParametersAddInfoKHR::~safe_VkVideoDecodeH265SessionParametersAddInfoKHR() {
     if (pStdVPSs) delete[] pStdVPSs;
     if (pStdSPSs) delete[] pStdSPSs;
@@ -8428,6 +10487,26 @@ safe_VkVideoDecodeH265SessionParametersCreateInfoKHR& safe_VkVideoDecodeH265Sess
     return *this;
 }
 
+safe_VkVideoDecodeH265SessionParametersCreateInfoKHR::safe_VkVideoDecodeH265SessionParametersCreateInfoKHR(
+    safe_VkVideoDecodeH265SessionParametersCreateInfoKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH265SessionParametersCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeH265SessionParametersCreateInfoKHR& safe_VkVideoDecodeH265SessionParametersCreateInfoKHR::operator=(
+    safe_VkVideoDecodeH265SessionParametersCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxStdVPSCount, move_src.maxStdVPSCount);
+    std::swap(maxStdSPSCount, move_src.maxStdSPSCount);
+    std::swap(maxStdPPSCount, move_src.maxStdPPSCount);
+    std::swap(pParametersAddInfo, move_src.pParametersAddInfo);
+
+    return *this;
+}
+
 safe_VkVideoDecodeH265SessionParametersCreateInfoKHR::~safe_VkVideoDecodeH265SessionParametersCreateInfoKHR() {
     if (pParametersAddInfo) delete pParametersAddInfo;
     FreePnextChain(pNext);
@@ -8530,6 +10609,24 @@ safe_VkVideoDecodeH265PictureInfoKHR& safe_VkVideoDecodeH265PictureInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoDecodeH265PictureInfoKHR::safe_VkVideoDecodeH265PictureInfoKHR(safe_VkVideoDecodeH265PictureInfoKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH265PictureInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeH265PictureInfoKHR& safe_VkVideoDecodeH265PictureInfoKHR::operator=(
+    safe_VkVideoDecodeH265PictureInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pStdPictureInfo, move_src.pStdPictureInfo);
+    std::swap(sliceSegmentCount, move_src.sliceSegmentCount);
+    std::swap(pSliceSegmentOffsets, move_src.pSliceSegmentOffsets);
+
+    return *this;
+}
+
 safe_VkVideoDecodeH265PictureInfoKHR::~safe_VkVideoDecodeH265PictureInfoKHR() {
     if (pStdPictureInfo) delete pStdPictureInfo;
     if (pSliceSegmentOffsets) delete[] pSliceSegmentOffsets;
@@ -8619,6 +10716,22 @@ safe_VkVideoDecodeH265DpbSlotInfoKHR& safe_VkVideoDecodeH265DpbSlotInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoDecodeH265DpbSlotInfoKHR::safe_VkVideoDecodeH265DpbSlotInfoKHR(safe_VkVideoDecodeH265DpbSlotInfoKHR&& move_src) noexcept
+    : safe_VkVideoDecodeH265DpbSlotInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoDecodeH265DpbSlotInfoKHR& safe_VkVideoDecodeH265DpbSlotInfoKHR::operator=(
+    safe_VkVideoDecodeH265DpbSlotInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pStdReferenceInfo, move_src.pStdReferenceInfo);
+
+    return *this;
+}
+
 safe_VkVideoDecodeH265DpbSlotInfoKHR::~safe_VkVideoDecodeH265DpbSlotInfoKHR() {
     if (pStdReferenceInfo) delete pStdReferenceInfo;
     FreePnextChain(pNext);
@@ -8679,6 +10792,23 @@ safe_VkDeviceQueueGlobalPriorityCreateInfoKHR& safe_VkDeviceQueueGlobalPriorityC
     return *this;
 }
 
+safe_VkDeviceQueueGlobalPriorityCreateInfoKHR::safe_VkDeviceQueueGlobalPriorityCreateInfoKHR(
+    safe_VkDeviceQueueGlobalPriorityCreateInfoKHR&& move_src) noexcept
+    : safe_VkDeviceQueueGlobalPriorityCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceQueueGlobalPriorityCreateInfoKHR& safe_VkDeviceQueueGlobalPriorityCreateInfoKHR::operator=(
+    safe_VkDeviceQueueGlobalPriorityCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(globalPriority, move_src.globalPriority);
+
+    return *this;
+}
+
 safe_VkDeviceQueueGlobalPriorityCreateInfoKHR::~safe_VkDeviceQueueGlobalPriorityCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkDeviceQueueGlobalPriorityCreateInfoKHR::initialize(const VkDeviceQueueGlobalPriorityCreateInfoKHR* in_struct,
@@ -8727,6 +10857,23 @@ safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& safe_VkPhysicalDeviceGlobal
     return *this;
 }
 
+safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR::safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR(
+    safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(globalPriorityQuery, move_src.globalPriorityQuery);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR::~safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR() {
     FreePnextChain(pNext);
 }
@@ -8788,6 +10935,24 @@ safe_VkQueueFamilyGlobalPriorityPropertiesKHR& safe_VkQueueFamilyGlobalPriorityP
     return *this;
 }
 
+safe_VkQueueFamilyGlobalPriorityPropertiesKHR::safe_VkQueueFamilyGlobalPriorityPropertiesKHR(
+    safe_VkQueueFamilyGlobalPriorityPropertiesKHR&& move_src) noexcept
+    : safe_VkQueueFamilyGlobalPriorityPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkQueueFamilyGlobalPriorityPropertiesKHR& safe_VkQueueFamilyGlobalPriorityPropertiesKHR::operator=(
+    safe_VkQueueFamilyGlobalPriorityPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(priorityCount, move_src.priorityCount);
+    std::swap(priorities, move_src.priorities);
+
+    return *this;
+}
+
 safe_VkQueueFamilyGlobalPriorityPropertiesKHR::~safe_VkQueueFamilyGlobalPriorityPropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkQueueFamilyGlobalPriorityPropertiesKHR::initialize(const VkQueueFamilyGlobalPriorityPropertiesKHR* in_struct,
@@ -8858,6 +11023,24 @@ safe_VkFragmentShadingRateAttachmentInfoKHR& safe_VkFragmentShadingRateAttachmen
     return *this;
 }
 
+safe_VkFragmentShadingRateAttachmentInfoKHR::safe_VkFragmentShadingRateAttachmentInfoKHR(
+    safe_VkFragmentShadingRateAttachmentInfoKHR&& move_src) noexcept
+    : safe_VkFragmentShadingRateAttachmentInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkFragmentShadingRateAttachmentInfoKHR& safe_VkFragmentShadingRateAttachmentInfoKHR::operator=(
+    safe_VkFragmentShadingRateAttachmentInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pFragmentShadingRateAttachment, move_src.pFragmentShadingRateAttachment);
+    std::swap(shadingRateAttachmentTexelSize, move_src.shadingRateAttachmentTexelSize);
+
+    return *this;
+}
+
 safe_VkFragmentShadingRateAttachmentInfoKHR::~safe_VkFragmentShadingRateAttachmentInfoKHR() {
     if (pFragmentShadingRateAttachment) delete pFragmentShadingRateAttachment;
     FreePnextChain(pNext);
@@ -8927,6 +11110,24 @@ safe_VkPipelineFragmentShadingRateStateCreateInfoKHR& safe_VkPipelineFragmentSha
     return *this;
 }
 
+safe_VkPipelineFragmentShadingRateStateCreateInfoKHR::safe_VkPipelineFragmentShadingRateStateCreateInfoKHR(
+    safe_VkPipelineFragmentShadingRateStateCreateInfoKHR&& move_src) noexcept
+    : safe_VkPipelineFragmentShadingRateStateCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineFragmentShadingRateStateCreateInfoKHR& safe_VkPipelineFragmentShadingRateStateCreateInfoKHR::operator=(
+    safe_VkPipelineFragmentShadingRateStateCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fragmentSize, move_src.fragmentSize);
+    std::swap(combinerOps, move_src.combinerOps);
+
+    return *this;
+}
+
 safe_VkPipelineFragmentShadingRateStateCreateInfoKHR::~safe_VkPipelineFragmentShadingRateStateCreateInfoKHR() {
     FreePnextChain(pNext);
 }
@@ -8996,6 +11197,25 @@ safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR& safe_VkPhysicalDeviceFragme
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR::safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR(
+    safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR& safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipelineFragmentShadingRate, move_src.pipelineFragmentShadingRate);
+    std::swap(primitiveFragmentShadingRate, move_src.primitiveFragmentShadingRate);
+    std::swap(attachmentFragmentShadingRate, move_src.attachmentFragmentShadingRate);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR::~safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR() {
     FreePnextChain(pNext);
 }
@@ -9117,6 +11337,39 @@ safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR& safe_VkPhysicalDeviceFrag
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR::safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR(
+    safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR& safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR::operator=(
+    safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(minFragmentShadingRateAttachmentTexelSize, move_src.minFragmentShadingRateAttachmentTexelSize);
+    std::swap(maxFragmentShadingRateAttachmentTexelSize, move_src.maxFragmentShadingRateAttachmentTexelSize);
+    std::swap(maxFragmentShadingRateAttachmentTexelSizeAspectRatio, move_src.maxFragmentShadingRateAttachmentTexelSizeAspectRatio);
+    std::swap(primitiveFragmentShadingRateWithMultipleViewports, move_src.primitiveFragmentShadingRateWithMultipleViewports);
+    std::swap(layeredShadingRateAttachments, move_src.layeredShadingRateAttachments);
+    std::swap(fragmentShadingRateNonTrivialCombinerOps, move_src.fragmentShadingRateNonTrivialCombinerOps);
+    std::swap(maxFragmentSize, move_src.maxFragmentSize);
+    std::swap(maxFragmentSizeAspectRatio, move_src.maxFragmentSizeAspectRatio);
+    std::swap(maxFragmentShadingRateCoverageSamples, move_src.maxFragmentShadingRateCoverageSamples);
+    std::swap(maxFragmentShadingRateRasterizationSamples, move_src.maxFragmentShadingRateRasterizationSamples);
+    std::swap(fragmentShadingRateWithShaderDepthStencilWrites, move_src.fragmentShadingRateWithShaderDepthStencilWrites);
+    std::swap(fragmentShadingRateWithSampleMask, move_src.fragmentShadingRateWithSampleMask);
+    std::swap(fragmentShadingRateWithShaderSampleMask, move_src.fragmentShadingRateWithShaderSampleMask);
+    std::swap(fragmentShadingRateWithConservativeRasterization, move_src.fragmentShadingRateWithConservativeRasterization);
+    std::swap(fragmentShadingRateWithFragmentShaderInterlock, move_src.fragmentShadingRateWithFragmentShaderInterlock);
+    std::swap(fragmentShadingRateWithCustomSampleLocations, move_src.fragmentShadingRateWithCustomSampleLocations);
+    std::swap(fragmentShadingRateStrictMultiplyCombiner, move_src.fragmentShadingRateStrictMultiplyCombiner);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR::~safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR() {
     FreePnextChain(pNext);
 }
@@ -9201,6 +11454,24 @@ safe_VkPhysicalDeviceFragmentShadingRateKHR& safe_VkPhysicalDeviceFragmentShadin
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentShadingRateKHR::safe_VkPhysicalDeviceFragmentShadingRateKHR(
+    safe_VkPhysicalDeviceFragmentShadingRateKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentShadingRateKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentShadingRateKHR& safe_VkPhysicalDeviceFragmentShadingRateKHR::operator=(
+    safe_VkPhysicalDeviceFragmentShadingRateKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(sampleCounts, move_src.sampleCounts);
+    std::swap(fragmentSize, move_src.fragmentSize);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentShadingRateKHR::~safe_VkPhysicalDeviceFragmentShadingRateKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceFragmentShadingRateKHR::initialize(const VkPhysicalDeviceFragmentShadingRateKHR* in_struct,
@@ -9252,6 +11523,23 @@ safe_VkSurfaceProtectedCapabilitiesKHR& safe_VkSurfaceProtectedCapabilitiesKHR::
     return *this;
 }
 
+safe_VkSurfaceProtectedCapabilitiesKHR::safe_VkSurfaceProtectedCapabilitiesKHR(
+    safe_VkSurfaceProtectedCapabilitiesKHR&& move_src) noexcept
+    : safe_VkSurfaceProtectedCapabilitiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkSurfaceProtectedCapabilitiesKHR& safe_VkSurfaceProtectedCapabilitiesKHR::operator=(
+    safe_VkSurfaceProtectedCapabilitiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(supportsProtected, move_src.supportsProtected);
+
+    return *this;
+}
+
 safe_VkSurfaceProtectedCapabilitiesKHR::~safe_VkSurfaceProtectedCapabilitiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkSurfaceProtectedCapabilitiesKHR::initialize(const VkSurfaceProtectedCapabilitiesKHR* in_struct,
@@ -9300,6 +11588,23 @@ safe_VkPhysicalDevicePresentWaitFeaturesKHR& safe_VkPhysicalDevicePresentWaitFea
     return *this;
 }
 
+safe_VkPhysicalDevicePresentWaitFeaturesKHR::safe_VkPhysicalDevicePresentWaitFeaturesKHR(
+    safe_VkPhysicalDevicePresentWaitFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDevicePresentWaitFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePresentWaitFeaturesKHR& safe_VkPhysicalDevicePresentWaitFeaturesKHR::operator=(
+    safe_VkPhysicalDevicePresentWaitFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentWait, move_src.presentWait);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePresentWaitFeaturesKHR::~safe_VkPhysicalDevicePresentWaitFeaturesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePresentWaitFeaturesKHR::initialize(const VkPhysicalDevicePresentWaitFeaturesKHR* in_struct,
@@ -9352,6 +11657,24 @@ safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR::operator=(
     return *this;
 }
 
+safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR::safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR(
+    safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR&
+safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR::operator=(
+    safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipelineExecutableInfo, move_src.pipelineExecutableInfo);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR::~safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR() {
     FreePnextChain(pNext);
 }
@@ -9399,6 +11722,20 @@ safe_VkPipelineInfoKHR& safe_VkPipelineInfoKHR::operator=(const safe_VkPipelineI
     return *this;
 }
 
+safe_VkPipelineInfoKHR::safe_VkPipelineInfoKHR(safe_VkPipelineInfoKHR&& move_src) noexcept : safe_VkPipelineInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineInfoKHR& safe_VkPipelineInfoKHR::operator=(safe_VkPipelineInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipeline, move_src.pipeline);
+
+    return *this;
+}
+
 safe_VkPipelineInfoKHR::~safe_VkPipelineInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkPipelineInfoKHR::initialize(const VkPipelineInfoKHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -9471,6 +11808,26 @@ safe_VkPipelineExecutablePropertiesKHR& safe_VkPipelineExecutablePropertiesKHR::
     return *this;
 }
 
+safe_VkPipelineExecutablePropertiesKHR::safe_VkPipelineExecutablePropertiesKHR(
+    safe_VkPipelineExecutablePropertiesKHR&& move_src) noexcept
+    : safe_VkPipelineExecutablePropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineExecutablePropertiesKHR& safe_VkPipelineExecutablePropertiesKHR::operator=(
+    safe_VkPipelineExecutablePropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stages, move_src.stages);
+    std::swap(name, move_src.name);
+    std::swap(description, move_src.description);
+    std::swap(subgroupSize, move_src.subgroupSize);
+
+    return *this;
+}
+
 safe_VkPipelineExecutablePropertiesKHR::~safe_VkPipelineExecutablePropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPipelineExecutablePropertiesKHR::initialize(const VkPipelineExecutablePropertiesKHR* in_struct,
@@ -9537,6 +11894,23 @@ safe_VkPipelineExecutableInfoKHR& safe_VkPipelineExecutableInfoKHR::operator=(co
     return *this;
 }
 
+safe_VkPipelineExecutableInfoKHR::safe_VkPipelineExecutableInfoKHR(safe_VkPipelineExecutableInfoKHR&& move_src) noexcept
+    : safe_VkPipelineExecutableInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineExecutableInfoKHR& safe_VkPipelineExecutableInfoKHR::operator=(
+    safe_VkPipelineExecutableInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipeline, move_src.pipeline);
+    std::swap(executableIndex, move_src.executableIndex);
+
+    return *this;
+}
+
 safe_VkPipelineExecutableInfoKHR::~safe_VkPipelineExecutableInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkPipelineExecutableInfoKHR::initialize(const VkPipelineExecutableInfoKHR* in_struct,
@@ -9613,6 +11987,26 @@ safe_VkPipelineExecutableStatisticKHR& safe_VkPipelineExecutableStatisticKHR::op
     return *this;
 }
 
+safe_VkPipelineExecutableStatisticKHR::safe_VkPipelineExecutableStatisticKHR(
+    safe_VkPipelineExecutableStatisticKHR&& move_src) noexcept
+    : safe_VkPipelineExecutableStatisticKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineExecutableStatisticKHR& safe_VkPipelineExecutableStatisticKHR::operator=(
+    safe_VkPipelineExecutableStatisticKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(name, move_src.name);
+    std::swap(description, move_src.description);
+    std::swap(format, move_src.format);
+    std::swap(value, move_src.value);
+
+    return *this;
+}
+
 safe_VkPipelineExecutableStatisticKHR::~safe_VkPipelineExecutableStatisticKHR() { FreePnextChain(pNext); }
 
 void safe_VkPipelineExecutableStatisticKHR::initialize(const VkPipelineExecutableStatisticKHR* in_struct,
@@ -9730,6 +12124,27 @@ safe_VkPipelineExecutableInternalRepresentationKHR& safe_VkPipelineExecutableInt
     return *this;
 }
 
+safe_VkPipelineExecutableInternalRepresentationKHR::safe_VkPipelineExecutableInternalRepresentationKHR(
+    safe_VkPipelineExecutableInternalRepresentationKHR&& move_src) noexcept
+    : safe_VkPipelineExecutableInternalRepresentationKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineExecutableInternalRepresentationKHR& safe_VkPipelineExecutableInternalRepresentationKHR::operator=(
+    safe_VkPipelineExecutableInternalRepresentationKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(name, move_src.name);
+    std::swap(description, move_src.description);
+    std::swap(isText, move_src.isText);
+    std::swap(dataSize, move_src.dataSize);
+    std::swap(pData, move_src.pData);
+
+    return *this;
+}
+
 safe_VkPipelineExecutableInternalRepresentationKHR::~safe_VkPipelineExecutableInternalRepresentationKHR() {
     if (pData != nullptr) {
         auto temp = reinterpret_cast<const std::byte*>(pData);
@@ -9826,6 +12241,23 @@ safe_VkMemoryMapInfoKHR& safe_VkMemoryMapInfoKHR::operator=(const safe_VkMemoryM
     return *this;
 }
 
+safe_VkMemoryMapInfoKHR::safe_VkMemoryMapInfoKHR(safe_VkMemoryMapInfoKHR&& move_src) noexcept : safe_VkMemoryMapInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryMapInfoKHR& safe_VkMemoryMapInfoKHR::operator=(safe_VkMemoryMapInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(memory, move_src.memory);
+    std::swap(offset, move_src.offset);
+    std::swap(size, move_src.size);
+
+    return *this;
+}
+
 safe_VkMemoryMapInfoKHR::~safe_VkMemoryMapInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkMemoryMapInfoKHR::initialize(const VkMemoryMapInfoKHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -9878,6 +12310,21 @@ safe_VkMemoryUnmapInfoKHR& safe_VkMemoryUnmapInfoKHR::operator=(const safe_VkMem
     return *this;
 }
 
+safe_VkMemoryUnmapInfoKHR::safe_VkMemoryUnmapInfoKHR(safe_VkMemoryUnmapInfoKHR&& move_src) noexcept : safe_VkMemoryUnmapInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryUnmapInfoKHR& safe_VkMemoryUnmapInfoKHR::operator=(safe_VkMemoryUnmapInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(memory, move_src.memory);
+
+    return *this;
+}
+
 safe_VkMemoryUnmapInfoKHR::~safe_VkMemoryUnmapInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkMemoryUnmapInfoKHR::initialize(const VkMemoryUnmapInfoKHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -9947,6 +12394,23 @@ safe_VkPipelineLibraryCreateInfoKHR& safe_VkPipelineLibraryCreateInfoKHR::operat
     return *this;
 }
 
+safe_VkPipelineLibraryCreateInfoKHR::safe_VkPipelineLibraryCreateInfoKHR(safe_VkPipelineLibraryCreateInfoKHR&& move_src) noexcept
+    : safe_VkPipelineLibraryCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineLibraryCreateInfoKHR& safe_VkPipelineLibraryCreateInfoKHR::operator=(
+    safe_VkPipelineLibraryCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(libraryCount, move_src.libraryCount);
+    std::swap(pLibraries, move_src.pLibraries);
+
+    return *this;
+}
+
 safe_VkPipelineLibraryCreateInfoKHR::~safe_VkPipelineLibraryCreateInfoKHR() {
     if (pLibraries) delete[] pLibraries;
     FreePnextChain(pNext);
@@ -10028,6 +12492,21 @@ safe_VkPresentIdKHR& safe_VkPresentIdKHR::operator=(const safe_VkPresentIdKHR& c
     return *this;
 }
 
+safe_VkPresentIdKHR::safe_VkPresentIdKHR(safe_VkPresentIdKHR&& move_src) noexcept : safe_VkPresentIdKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPresentIdKHR& safe_VkPresentIdKHR::operator=(safe_VkPresentIdKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(swapchainCount, move_src.swapchainCount);
+    std::swap(pPresentIds, move_src.pPresentIds);
+
+    return *this;
+}
+
 safe_VkPresentIdKHR::~safe_VkPresentIdKHR() {
     if (pPresentIds) delete[] pPresentIds;
     FreePnextChain(pNext);
@@ -10090,6 +12569,23 @@ safe_VkPhysicalDevicePresentIdFeaturesKHR& safe_VkPhysicalDevicePresentIdFeature
     return *this;
 }
 
+safe_VkPhysicalDevicePresentIdFeaturesKHR::safe_VkPhysicalDevicePresentIdFeaturesKHR(
+    safe_VkPhysicalDevicePresentIdFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDevicePresentIdFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePresentIdFeaturesKHR& safe_VkPhysicalDevicePresentIdFeaturesKHR::operator=(
+    safe_VkPhysicalDevicePresentIdFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentId, move_src.presentId);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePresentIdFeaturesKHR::~safe_VkPhysicalDevicePresentIdFeaturesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePresentIdFeaturesKHR::initialize(const VkPhysicalDevicePresentIdFeaturesKHR* in_struct,
@@ -10193,6 +12689,28 @@ safe_VkVideoEncodeInfoKHR& safe_VkVideoEncodeInfoKHR::operator=(const safe_VkVid
     return *this;
 }
 
+safe_VkVideoEncodeInfoKHR::safe_VkVideoEncodeInfoKHR(safe_VkVideoEncodeInfoKHR&& move_src) noexcept : safe_VkVideoEncodeInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeInfoKHR& safe_VkVideoEncodeInfoKHR::operator=(safe_VkVideoEncodeInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(dstBuffer, move_src.dstBuffer);
+    std::swap(dstBufferOffset, move_src.dstBufferOffset);
+    std::swap(dstBufferRange, move_src.dstBufferRange);
+    std::swap(srcPictureResource, move_src.srcPictureResource);
+    std::swap(pSetupReferenceSlot, move_src.pSetupReferenceSlot);
+    std::swap(referenceSlotCount, move_src.referenceSlotCount);
+    std::swap(pReferenceSlots, move_src.pReferenceSlots);
+    std::swap(precedingExternallyEncodedBytes, move_src.precedingExternallyEncodedBytes);
+
+    return *this;
+}
+
 safe_VkVideoEncodeInfoKHR::~safe_VkVideoEncodeInfoKHR() {
     if (pSetupReferenceSlot) delete pSetupReferenceSlot;
     if (pReferenceSlots) delete[] pReferenceSlots;
@@ -10300,6 +12818,28 @@ safe_VkVideoEncodeCapabilitiesKHR& safe_VkVideoEncodeCapabilitiesKHR::operator=(
     return *this;
 }
 
+safe_VkVideoEncodeCapabilitiesKHR::safe_VkVideoEncodeCapabilitiesKHR(safe_VkVideoEncodeCapabilitiesKHR&& move_src) noexcept
+    : safe_VkVideoEncodeCapabilitiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeCapabilitiesKHR& safe_VkVideoEncodeCapabilitiesKHR::operator=(
+    safe_VkVideoEncodeCapabilitiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(rateControlModes, move_src.rateControlModes);
+    std::swap(maxRateControlLayers, move_src.maxRateControlLayers);
+    std::swap(maxBitrate, move_src.maxBitrate);
+    std::swap(maxQualityLevels, move_src.maxQualityLevels);
+    std::swap(encodeInputPictureGranularity, move_src.encodeInputPictureGranularity);
+    std::swap(supportedEncodeFeedbackFlags, move_src.supportedEncodeFeedbackFlags);
+
+    return *this;
+}
+
 safe_VkVideoEncodeCapabilitiesKHR::~safe_VkVideoEncodeCapabilitiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeCapabilitiesKHR::initialize(const VkVideoEncodeCapabilitiesKHR* in_struct,
@@ -10360,6 +12900,23 @@ safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& safe_VkQueryPoolVideoEncodeFee
     return *this;
 }
 
+safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR::safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR(
+    safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR&& move_src) noexcept
+    : safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR::operator=(
+    safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(encodeFeedbackFlags, move_src.encodeFeedbackFlags);
+
+    return *this;
+}
+
 safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR::~safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkQueryPoolVideoEncodeFeedbackCreateInfoKHR::initialize(const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR* in_struct,
@@ -10413,6 +12970,23 @@ safe_VkVideoEncodeUsageInfoKHR& safe_VkVideoEncodeUsageInfoKHR::operator=(const
     return *this;
 }
 
+safe_VkVideoEncodeUsageInfoKHR::safe_VkVideoEncodeUsageInfoKHR(safe_VkVideoEncodeUsageInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeUsageInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeUsageInfoKHR& safe_VkVideoEncodeUsageInfoKHR::operator=(safe_VkVideoEncodeUsageInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(videoUsageHints, move_src.videoUsageHints);
+    std::swap(videoContentHints, move_src.videoContentHints);
+    std::swap(tuningMode, move_src.tuningMode);
+
+    return *this;
+}
+
 safe_VkVideoEncodeUsageInfoKHR::~safe_VkVideoEncodeUsageInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeUsageInfoKHR::initialize(const VkVideoEncodeUsageInfoKHR* in_struct,
@@ -10480,6 +13054,26 @@ safe_VkVideoEncodeRateControlLayerInfoKHR& safe_VkVideoEncodeRateControlLayerInf
     return *this;
 }
 
+safe_VkVideoEncodeRateControlLayerInfoKHR::safe_VkVideoEncodeRateControlLayerInfoKHR(
+    safe_VkVideoEncodeRateControlLayerInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeRateControlLayerInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeRateControlLayerInfoKHR& safe_VkVideoEncodeRateControlLayerInfoKHR::operator=(
+    safe_VkVideoEncodeRateControlLayerInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(averageBitrate, move_src.averageBitrate);
+    std::swap(maxBitrate, move_src.maxBitrate);
+    std::swap(frameRateNumerator, move_src.frameRateNumerator);
+    std::swap(frameRateDenominator, move_src.frameRateDenominator);
+
+    return *this;
+}
+
 safe_VkVideoEncodeRateControlLayerInfoKHR::~safe_VkVideoEncodeRateControlLayerInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeRateControlLayerInfoKHR::initialize(const VkVideoEncodeRateControlLayerInfoKHR* in_struct,
@@ -10576,6 +13170,27 @@ safe_VkVideoEncodeRateControlInfoKHR& safe_VkVideoEncodeRateControlInfoKHR::oper
     return *this;
 }
 
+safe_VkVideoEncodeRateControlInfoKHR::safe_VkVideoEncodeRateControlInfoKHR(safe_VkVideoEncodeRateControlInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeRateControlInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeRateControlInfoKHR& safe_VkVideoEncodeRateControlInfoKHR::operator=(
+    safe_VkVideoEncodeRateControlInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(rateControlMode, move_src.rateControlMode);
+    std::swap(layerCount, move_src.layerCount);
+    std::swap(pLayers, move_src.pLayers);
+    std::swap(virtualBufferSizeInMs, move_src.virtualBufferSizeInMs);
+    std::swap(initialVirtualBufferSizeInMs, move_src.initialVirtualBufferSizeInMs);
+
+    return *this;
+}
+
 safe_VkVideoEncodeRateControlInfoKHR::~safe_VkVideoEncodeRateControlInfoKHR() {
     if (pLayers) delete[] pLayers;
     FreePnextChain(pNext);
@@ -10659,6 +13274,24 @@ safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& safe_VkPhysicalDeviceVideoE
     return *this;
 }
 
+safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR::safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR(
+    safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR::operator=(
+    safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pVideoProfile, move_src.pVideoProfile);
+    std::swap(qualityLevel, move_src.qualityLevel);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR::~safe_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR() {
     if (pVideoProfile) delete pVideoProfile;
     FreePnextChain(pNext);
@@ -10722,6 +13355,24 @@ safe_VkVideoEncodeQualityLevelPropertiesKHR& safe_VkVideoEncodeQualityLevelPrope
     return *this;
 }
 
+safe_VkVideoEncodeQualityLevelPropertiesKHR::safe_VkVideoEncodeQualityLevelPropertiesKHR(
+    safe_VkVideoEncodeQualityLevelPropertiesKHR&& move_src) noexcept
+    : safe_VkVideoEncodeQualityLevelPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeQualityLevelPropertiesKHR& safe_VkVideoEncodeQualityLevelPropertiesKHR::operator=(
+    safe_VkVideoEncodeQualityLevelPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(preferredRateControlMode, move_src.preferredRateControlMode);
+    std::swap(preferredRateControlLayerCount, move_src.preferredRateControlLayerCount);
+
+    return *this;
+}
+
 safe_VkVideoEncodeQualityLevelPropertiesKHR::~safe_VkVideoEncodeQualityLevelPropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeQualityLevelPropertiesKHR::initialize(const VkVideoEncodeQualityLevelPropertiesKHR* in_struct,
@@ -10773,6 +13424,23 @@ safe_VkVideoEncodeQualityLevelInfoKHR& safe_VkVideoEncodeQualityLevelInfoKHR::op
     return *this;
 }
 
+safe_VkVideoEncodeQualityLevelInfoKHR::safe_VkVideoEncodeQualityLevelInfoKHR(
+    safe_VkVideoEncodeQualityLevelInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeQualityLevelInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeQualityLevelInfoKHR& safe_VkVideoEncodeQualityLevelInfoKHR::operator=(
+    safe_VkVideoEncodeQualityLevelInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(qualityLevel, move_src.qualityLevel);
+
+    return *this;
+}
+
 safe_VkVideoEncodeQualityLevelInfoKHR::~safe_VkVideoEncodeQualityLevelInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeQualityLevelInfoKHR::initialize(const VkVideoEncodeQualityLevelInfoKHR* in_struct,
@@ -10821,6 +13489,23 @@ safe_VkVideoEncodeSessionParametersGetInfoKHR& safe_VkVideoEncodeSessionParamete
     return *this;
 }
 
+safe_VkVideoEncodeSessionParametersGetInfoKHR::safe_VkVideoEncodeSessionParametersGetInfoKHR(
+    safe_VkVideoEncodeSessionParametersGetInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeSessionParametersGetInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeSessionParametersGetInfoKHR& safe_VkVideoEncodeSessionParametersGetInfoKHR::operator=(
+    safe_VkVideoEncodeSessionParametersGetInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(videoSessionParameters, move_src.videoSessionParameters);
+
+    return *this;
+}
+
 safe_VkVideoEncodeSessionParametersGetInfoKHR::~safe_VkVideoEncodeSessionParametersGetInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeSessionParametersGetInfoKHR::initialize(const VkVideoEncodeSessionParametersGetInfoKHR* in_struct,
@@ -10869,6 +13554,23 @@ safe_VkVideoEncodeSessionParametersFeedbackInfoKHR& safe_VkVideoEncodeSessionPar
     return *this;
 }
 
+safe_VkVideoEncodeSessionParametersFeedbackInfoKHR::safe_VkVideoEncodeSessionParametersFeedbackInfoKHR(
+    safe_VkVideoEncodeSessionParametersFeedbackInfoKHR&& move_src) noexcept
+    : safe_VkVideoEncodeSessionParametersFeedbackInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoEncodeSessionParametersFeedbackInfoKHR& safe_VkVideoEncodeSessionParametersFeedbackInfoKHR::operator=(
+    safe_VkVideoEncodeSessionParametersFeedbackInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(hasOverrides, move_src.hasOverrides);
+
+    return *this;
+}
+
 safe_VkVideoEncodeSessionParametersFeedbackInfoKHR::~safe_VkVideoEncodeSessionParametersFeedbackInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoEncodeSessionParametersFeedbackInfoKHR::initialize(const VkVideoEncodeSessionParametersFeedbackInfoKHR* in_struct,
@@ -10920,6 +13622,23 @@ safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& safe_VkPhysicalDevice
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR::safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR(
+    safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fragmentShaderBarycentric, move_src.fragmentShaderBarycentric);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR::~safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR() {
     FreePnextChain(pNext);
 }
@@ -10974,6 +13693,23 @@ safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& safe_VkPhysicalDevi
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR::safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR(
+    safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR::operator=(
+    safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(triStripVertexOrderIndependentOfProvokingVertex, move_src.triStripVertexOrderIndependentOfProvokingVertex);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR::~safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR() {
     FreePnextChain(pNext);
 }
@@ -11028,6 +13764,24 @@ safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR::safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR(
+    safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR&
+safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderSubgroupUniformControlFlow, move_src.shaderSubgroupUniformControlFlow);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR::
     ~safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR() {
     FreePnextChain(pNext);
@@ -11096,6 +13850,27 @@ safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR::safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR(
+    safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR&
+safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(workgroupMemoryExplicitLayout, move_src.workgroupMemoryExplicitLayout);
+    std::swap(workgroupMemoryExplicitLayoutScalarBlockLayout, move_src.workgroupMemoryExplicitLayoutScalarBlockLayout);
+    std::swap(workgroupMemoryExplicitLayout8BitAccess, move_src.workgroupMemoryExplicitLayout8BitAccess);
+    std::swap(workgroupMemoryExplicitLayout16BitAccess, move_src.workgroupMemoryExplicitLayout16BitAccess);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR::~safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR() {
     FreePnextChain(pNext);
 }
@@ -11160,6 +13935,24 @@ safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& safe_VkPhysicalDeviceRay
     return *this;
 }
 
+safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR::safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR(
+    safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR::operator=(
+    safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(rayTracingMaintenance1, move_src.rayTracingMaintenance1);
+    std::swap(rayTracingPipelineTraceRaysIndirect2, move_src.rayTracingPipelineTraceRaysIndirect2);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR::~safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR() {
     FreePnextChain(pNext);
 }
@@ -11212,6 +14005,23 @@ safe_VkPhysicalDeviceMaintenance5FeaturesKHR& safe_VkPhysicalDeviceMaintenance5F
     return *this;
 }
 
+safe_VkPhysicalDeviceMaintenance5FeaturesKHR::safe_VkPhysicalDeviceMaintenance5FeaturesKHR(
+    safe_VkPhysicalDeviceMaintenance5FeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceMaintenance5FeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMaintenance5FeaturesKHR& safe_VkPhysicalDeviceMaintenance5FeaturesKHR::operator=(
+    safe_VkPhysicalDeviceMaintenance5FeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maintenance5, move_src.maintenance5);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMaintenance5FeaturesKHR::~safe_VkPhysicalDeviceMaintenance5FeaturesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMaintenance5FeaturesKHR::initialize(const VkPhysicalDeviceMaintenance5FeaturesKHR* in_struct,
@@ -11283,6 +14093,28 @@ safe_VkPhysicalDeviceMaintenance5PropertiesKHR& safe_VkPhysicalDeviceMaintenance
     return *this;
 }
 
+safe_VkPhysicalDeviceMaintenance5PropertiesKHR::safe_VkPhysicalDeviceMaintenance5PropertiesKHR(
+    safe_VkPhysicalDeviceMaintenance5PropertiesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceMaintenance5PropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMaintenance5PropertiesKHR& safe_VkPhysicalDeviceMaintenance5PropertiesKHR::operator=(
+    safe_VkPhysicalDeviceMaintenance5PropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(earlyFragmentMultisampleCoverageAfterSampleCounting, move_src.earlyFragmentMultisampleCoverageAfterSampleCounting);
+    std::swap(earlyFragmentSampleMaskTestBeforeSampleCounting, move_src.earlyFragmentSampleMaskTestBeforeSampleCounting);
+    std::swap(depthStencilSwizzleOneSupport, move_src.depthStencilSwizzleOneSupport);
+    std::swap(polygonModePointSize, move_src.polygonModePointSize);
+    std::swap(nonStrictSinglePixelWideLinesUseParallelogram, move_src.nonStrictSinglePixelWideLinesUseParallelogram);
+    std::swap(nonStrictWideLinesUseParallelogram, move_src.nonStrictWideLinesUseParallelogram);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMaintenance5PropertiesKHR::~safe_VkPhysicalDeviceMaintenance5PropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMaintenance5PropertiesKHR::initialize(const VkPhysicalDeviceMaintenance5PropertiesKHR* in_struct,
@@ -11376,6 +14208,25 @@ safe_VkRenderingAreaInfoKHR& safe_VkRenderingAreaInfoKHR::operator=(const safe_V
     return *this;
 }
 
+safe_VkRenderingAreaInfoKHR::safe_VkRenderingAreaInfoKHR(safe_VkRenderingAreaInfoKHR&& move_src) noexcept
+    : safe_VkRenderingAreaInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderingAreaInfoKHR& safe_VkRenderingAreaInfoKHR::operator=(safe_VkRenderingAreaInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(viewMask, move_src.viewMask);
+    std::swap(colorAttachmentCount, move_src.colorAttachmentCount);
+    std::swap(pColorAttachmentFormats, move_src.pColorAttachmentFormats);
+    std::swap(depthAttachmentFormat, move_src.depthAttachmentFormat);
+    std::swap(stencilAttachmentFormat, move_src.stencilAttachmentFormat);
+
+    return *this;
+}
+
 safe_VkRenderingAreaInfoKHR::~safe_VkRenderingAreaInfoKHR() {
     if (pColorAttachmentFormats) delete[] pColorAttachmentFormats;
     FreePnextChain(pNext);
@@ -11445,6 +14296,21 @@ safe_VkImageSubresource2KHR& safe_VkImageSubresource2KHR::operator=(const safe_V
     return *this;
 }
 
+safe_VkImageSubresource2KHR::safe_VkImageSubresource2KHR(safe_VkImageSubresource2KHR&& move_src) noexcept
+    : safe_VkImageSubresource2KHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageSubresource2KHR& safe_VkImageSubresource2KHR::operator=(safe_VkImageSubresource2KHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageSubresource, move_src.imageSubresource);
+
+    return *this;
+}
+
 safe_VkImageSubresource2KHR::~safe_VkImageSubresource2KHR() { FreePnextChain(pNext); }
 
 void safe_VkImageSubresource2KHR::initialize(const VkImageSubresource2KHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -11502,6 +14368,23 @@ safe_VkDeviceImageSubresourceInfoKHR& safe_VkDeviceImageSubresourceInfoKHR::oper
     return *this;
 }
 
+safe_VkDeviceImageSubresourceInfoKHR::safe_VkDeviceImageSubresourceInfoKHR(safe_VkDeviceImageSubresourceInfoKHR&& move_src) noexcept
+    : safe_VkDeviceImageSubresourceInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceImageSubresourceInfoKHR& safe_VkDeviceImageSubresourceInfoKHR::operator=(
+    safe_VkDeviceImageSubresourceInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pCreateInfo, move_src.pCreateInfo);
+    std::swap(pSubresource, move_src.pSubresource);
+
+    return *this;
+}
+
 safe_VkDeviceImageSubresourceInfoKHR::~safe_VkDeviceImageSubresourceInfoKHR() {
     if (pCreateInfo) delete pCreateInfo;
     if (pSubresource) delete pSubresource;
@@ -11560,6 +14443,21 @@ safe_VkSubresourceLayout2KHR& safe_VkSubresourceLayout2KHR::operator=(const safe
     return *this;
 }
 
+safe_VkSubresourceLayout2KHR::safe_VkSubresourceLayout2KHR(safe_VkSubresourceLayout2KHR&& move_src) noexcept
+    : safe_VkSubresourceLayout2KHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubresourceLayout2KHR& safe_VkSubresourceLayout2KHR::operator=(safe_VkSubresourceLayout2KHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(subresourceLayout, move_src.subresourceLayout);
+
+    return *this;
+}
+
 safe_VkSubresourceLayout2KHR::~safe_VkSubresourceLayout2KHR() { FreePnextChain(pNext); }
 
 void safe_VkSubresourceLayout2KHR::initialize(const VkSubresourceLayout2KHR* in_struct,
@@ -11608,6 +14506,23 @@ safe_VkPipelineCreateFlags2CreateInfoKHR& safe_VkPipelineCreateFlags2CreateInfoK
     return *this;
 }
 
+safe_VkPipelineCreateFlags2CreateInfoKHR::safe_VkPipelineCreateFlags2CreateInfoKHR(
+    safe_VkPipelineCreateFlags2CreateInfoKHR&& move_src) noexcept
+    : safe_VkPipelineCreateFlags2CreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineCreateFlags2CreateInfoKHR& safe_VkPipelineCreateFlags2CreateInfoKHR::operator=(
+    safe_VkPipelineCreateFlags2CreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkPipelineCreateFlags2CreateInfoKHR::~safe_VkPipelineCreateFlags2CreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkPipelineCreateFlags2CreateInfoKHR::initialize(const VkPipelineCreateFlags2CreateInfoKHR* in_struct,
@@ -11657,6 +14572,23 @@ safe_VkBufferUsageFlags2CreateInfoKHR& safe_VkBufferUsageFlags2CreateInfoKHR::op
     return *this;
 }
 
+safe_VkBufferUsageFlags2CreateInfoKHR::safe_VkBufferUsageFlags2CreateInfoKHR(
+    safe_VkBufferUsageFlags2CreateInfoKHR&& move_src) noexcept
+    : safe_VkBufferUsageFlags2CreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferUsageFlags2CreateInfoKHR& safe_VkBufferUsageFlags2CreateInfoKHR::operator=(
+    safe_VkBufferUsageFlags2CreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(usage, move_src.usage);
+
+    return *this;
+}
+
 safe_VkBufferUsageFlags2CreateInfoKHR::~safe_VkBufferUsageFlags2CreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkBufferUsageFlags2CreateInfoKHR::initialize(const VkBufferUsageFlags2CreateInfoKHR* in_struct,
@@ -11706,6 +14638,23 @@ safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& safe_VkPhysicalDeviceRa
     return *this;
 }
 
+safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR::safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR(
+    safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(rayTracingPositionFetch, move_src.rayTracingPositionFetch);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR::~safe_VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR() {
     FreePnextChain(pNext);
 }
@@ -11792,6 +14741,31 @@ safe_VkCooperativeMatrixPropertiesKHR& safe_VkCooperativeMatrixPropertiesKHR::op
     return *this;
 }
 
+safe_VkCooperativeMatrixPropertiesKHR::safe_VkCooperativeMatrixPropertiesKHR(
+    safe_VkCooperativeMatrixPropertiesKHR&& move_src) noexcept
+    : safe_VkCooperativeMatrixPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkCooperativeMatrixPropertiesKHR& safe_VkCooperativeMatrixPropertiesKHR::operator=(
+    safe_VkCooperativeMatrixPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(MSize, move_src.MSize);
+    std::swap(NSize, move_src.NSize);
+    std::swap(KSize, move_src.KSize);
+    std::swap(AType, move_src.AType);
+    std::swap(BType, move_src.BType);
+    std::swap(CType, move_src.CType);
+    std::swap(ResultType, move_src.ResultType);
+    std::swap(saturatingAccumulation, move_src.saturatingAccumulation);
+    std::swap(scope, move_src.scope);
+
+    return *this;
+}
+
 safe_VkCooperativeMatrixPropertiesKHR::~safe_VkCooperativeMatrixPropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkCooperativeMatrixPropertiesKHR::initialize(const VkCooperativeMatrixPropertiesKHR* in_struct,
@@ -11863,6 +14837,24 @@ safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR& safe_VkPhysicalDeviceCooperat
     return *this;
 }
 
+safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR::safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR(
+    safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR& safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(cooperativeMatrix, move_src.cooperativeMatrix);
+    std::swap(cooperativeMatrixRobustBufferAccess, move_src.cooperativeMatrixRobustBufferAccess);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR::~safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceCooperativeMatrixFeaturesKHR::initialize(const VkPhysicalDeviceCooperativeMatrixFeaturesKHR* in_struct,
@@ -11915,6 +14907,23 @@ safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR& safe_VkPhysicalDeviceCooper
     return *this;
 }
 
+safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR::safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR(
+    safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR& safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR::operator=(
+    safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(cooperativeMatrixSupportedStages, move_src.cooperativeMatrixSupportedStages);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR::~safe_VkPhysicalDeviceCooperativeMatrixPropertiesKHR() {
     FreePnextChain(pNext);
 }
@@ -11965,6 +14974,23 @@ safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR& safe_VkPhysicalDeviceVideoMai
     return *this;
 }
 
+safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR::safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR(
+    safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR& safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR::operator=(
+    safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(videoMaintenance1, move_src.videoMaintenance1);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR::~safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceVideoMaintenance1FeaturesKHR::initialize(const VkPhysicalDeviceVideoMaintenance1FeaturesKHR* in_struct,
@@ -12018,6 +15044,23 @@ safe_VkVideoInlineQueryInfoKHR& safe_VkVideoInlineQueryInfoKHR::operator=(const
     return *this;
 }
 
+safe_VkVideoInlineQueryInfoKHR::safe_VkVideoInlineQueryInfoKHR(safe_VkVideoInlineQueryInfoKHR&& move_src) noexcept
+    : safe_VkVideoInlineQueryInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkVideoInlineQueryInfoKHR& safe_VkVideoInlineQueryInfoKHR::operator=(safe_VkVideoInlineQueryInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(queryPool, move_src.queryPool);
+    std::swap(firstQuery, move_src.firstQuery);
+    std::swap(queryCount, move_src.queryCount);
+
+    return *this;
+}
+
 safe_VkVideoInlineQueryInfoKHR::~safe_VkVideoInlineQueryInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkVideoInlineQueryInfoKHR::initialize(const VkVideoInlineQueryInfoKHR* in_struct,
@@ -12070,10 +15113,28 @@ safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR& safe_VkPhysicalDeviceV
 
     FreePnextChain(pNext);
 
-    sType = copy_src.sType;
-    maxVertexAttribDivisor = copy_src.maxVertexAttribDivisor;
-    supportsNonZeroFirstInstance = copy_src.supportsNonZeroFirstInstance;
-    pNext = SafePnextCopy(copy_src.pNext);
+    sType = copy_src.sType;
+    maxVertexAttribDivisor = copy_src.maxVertexAttribDivisor;
+    supportsNonZeroFirstInstance = copy_src.supportsNonZeroFirstInstance;
+    pNext = SafePnextCopy(copy_src.pNext);
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR::safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR(
+    safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR& safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR::operator=(
+    safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxVertexAttribDivisor, move_src.maxVertexAttribDivisor);
+    std::swap(supportsNonZeroFirstInstance, move_src.supportsNonZeroFirstInstance);
 
     return *this;
 }
@@ -12153,6 +15214,24 @@ safe_VkPipelineVertexInputDivisorStateCreateInfoKHR& safe_VkPipelineVertexInputD
     return *this;
 }
 
+safe_VkPipelineVertexInputDivisorStateCreateInfoKHR::safe_VkPipelineVertexInputDivisorStateCreateInfoKHR(
+    safe_VkPipelineVertexInputDivisorStateCreateInfoKHR&& move_src) noexcept
+    : safe_VkPipelineVertexInputDivisorStateCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineVertexInputDivisorStateCreateInfoKHR& safe_VkPipelineVertexInputDivisorStateCreateInfoKHR::operator=(
+    safe_VkPipelineVertexInputDivisorStateCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(vertexBindingDivisorCount, move_src.vertexBindingDivisorCount);
+    std::swap(pVertexBindingDivisors, move_src.pVertexBindingDivisors);
+
+    return *this;
+}
+
 safe_VkPipelineVertexInputDivisorStateCreateInfoKHR::~safe_VkPipelineVertexInputDivisorStateCreateInfoKHR() {
     if (pVertexBindingDivisors) delete[] pVertexBindingDivisors;
     FreePnextChain(pNext);
@@ -12227,6 +15306,24 @@ safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR& safe_VkPhysicalDeviceVer
     return *this;
 }
 
+safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR::safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR(
+    safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR& safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(vertexAttributeInstanceRateDivisor, move_src.vertexAttributeInstanceRateDivisor);
+    std::swap(vertexAttributeInstanceRateZeroDivisor, move_src.vertexAttributeInstanceRateZeroDivisor);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR::~safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR() {
     FreePnextChain(pNext);
 }
@@ -12277,6 +15374,22 @@ safe_VkCalibratedTimestampInfoKHR& safe_VkCalibratedTimestampInfoKHR::operator=(
     return *this;
 }
 
+safe_VkCalibratedTimestampInfoKHR::safe_VkCalibratedTimestampInfoKHR(safe_VkCalibratedTimestampInfoKHR&& move_src) noexcept
+    : safe_VkCalibratedTimestampInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkCalibratedTimestampInfoKHR& safe_VkCalibratedTimestampInfoKHR::operator=(
+    safe_VkCalibratedTimestampInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(timeDomain, move_src.timeDomain);
+
+    return *this;
+}
+
 safe_VkCalibratedTimestampInfoKHR::~safe_VkCalibratedTimestampInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkCalibratedTimestampInfoKHR::initialize(const VkCalibratedTimestampInfoKHR* in_struct,
@@ -12325,6 +15438,23 @@ safe_VkPhysicalDeviceMaintenance6FeaturesKHR& safe_VkPhysicalDeviceMaintenance6F
     return *this;
 }
 
+safe_VkPhysicalDeviceMaintenance6FeaturesKHR::safe_VkPhysicalDeviceMaintenance6FeaturesKHR(
+    safe_VkPhysicalDeviceMaintenance6FeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceMaintenance6FeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMaintenance6FeaturesKHR& safe_VkPhysicalDeviceMaintenance6FeaturesKHR::operator=(
+    safe_VkPhysicalDeviceMaintenance6FeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maintenance6, move_src.maintenance6);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMaintenance6FeaturesKHR::~safe_VkPhysicalDeviceMaintenance6FeaturesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMaintenance6FeaturesKHR::initialize(const VkPhysicalDeviceMaintenance6FeaturesKHR* in_struct,
@@ -12384,6 +15514,25 @@ safe_VkPhysicalDeviceMaintenance6PropertiesKHR& safe_VkPhysicalDeviceMaintenance
     return *this;
 }
 
+safe_VkPhysicalDeviceMaintenance6PropertiesKHR::safe_VkPhysicalDeviceMaintenance6PropertiesKHR(
+    safe_VkPhysicalDeviceMaintenance6PropertiesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceMaintenance6PropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMaintenance6PropertiesKHR& safe_VkPhysicalDeviceMaintenance6PropertiesKHR::operator=(
+    safe_VkPhysicalDeviceMaintenance6PropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(blockTexelViewCompatibleMultipleLayers, move_src.blockTexelViewCompatibleMultipleLayers);
+    std::swap(maxCombinedImageSamplerDescriptorCount, move_src.maxCombinedImageSamplerDescriptorCount);
+    std::swap(fragmentShadingRateClampCombinerInputs, move_src.fragmentShadingRateClampCombinerInputs);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMaintenance6PropertiesKHR::~safe_VkPhysicalDeviceMaintenance6PropertiesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMaintenance6PropertiesKHR::initialize(const VkPhysicalDeviceMaintenance6PropertiesKHR* in_struct,
@@ -12446,6 +15595,21 @@ safe_VkBindMemoryStatusKHR& safe_VkBindMemoryStatusKHR::operator=(const safe_VkB
     return *this;
 }
 
+safe_VkBindMemoryStatusKHR::safe_VkBindMemoryStatusKHR(safe_VkBindMemoryStatusKHR&& move_src) noexcept
+    : safe_VkBindMemoryStatusKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindMemoryStatusKHR& safe_VkBindMemoryStatusKHR::operator=(safe_VkBindMemoryStatusKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pResult, move_src.pResult);
+
+    return *this;
+}
+
 safe_VkBindMemoryStatusKHR::~safe_VkBindMemoryStatusKHR() {
     if (pResult) delete pResult;
     FreePnextChain(pNext);
@@ -12565,6 +15729,28 @@ safe_VkBindDescriptorSetsInfoKHR& safe_VkBindDescriptorSetsInfoKHR::operator=(co
     return *this;
 }
 
+safe_VkBindDescriptorSetsInfoKHR::safe_VkBindDescriptorSetsInfoKHR(safe_VkBindDescriptorSetsInfoKHR&& move_src) noexcept
+    : safe_VkBindDescriptorSetsInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindDescriptorSetsInfoKHR& safe_VkBindDescriptorSetsInfoKHR::operator=(
+    safe_VkBindDescriptorSetsInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stageFlags, move_src.stageFlags);
+    std::swap(layout, move_src.layout);
+    std::swap(firstSet, move_src.firstSet);
+    std::swap(descriptorSetCount, move_src.descriptorSetCount);
+    std::swap(pDescriptorSets, move_src.pDescriptorSets);
+    std::swap(dynamicOffsetCount, move_src.dynamicOffsetCount);
+    std::swap(pDynamicOffsets, move_src.pDynamicOffsets);
+
+    return *this;
+}
+
 safe_VkBindDescriptorSetsInfoKHR::~safe_VkBindDescriptorSetsInfoKHR() {
     if (pDescriptorSets) delete[] pDescriptorSets;
     if (pDynamicOffsets) delete[] pDynamicOffsets;
@@ -12670,6 +15856,25 @@ safe_VkPushConstantsInfoKHR& safe_VkPushConstantsInfoKHR::operator=(const safe_V
     return *this;
 }
 
+safe_VkPushConstantsInfoKHR::safe_VkPushConstantsInfoKHR(safe_VkPushConstantsInfoKHR&& move_src) noexcept
+    : safe_VkPushConstantsInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPushConstantsInfoKHR& safe_VkPushConstantsInfoKHR::operator=(safe_VkPushConstantsInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(layout, move_src.layout);
+    std::swap(stageFlags, move_src.stageFlags);
+    std::swap(offset, move_src.offset);
+    std::swap(size, move_src.size);
+    std::swap(pValues, move_src.pValues);
+
+    return *this;
+}
+
 safe_VkPushConstantsInfoKHR::~safe_VkPushConstantsInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkPushConstantsInfoKHR::initialize(const VkPushConstantsInfoKHR* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -12761,6 +15966,25 @@ safe_VkPushDescriptorSetInfoKHR& safe_VkPushDescriptorSetInfoKHR::operator=(cons
     return *this;
 }
 
+safe_VkPushDescriptorSetInfoKHR::safe_VkPushDescriptorSetInfoKHR(safe_VkPushDescriptorSetInfoKHR&& move_src) noexcept
+    : safe_VkPushDescriptorSetInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPushDescriptorSetInfoKHR& safe_VkPushDescriptorSetInfoKHR::operator=(safe_VkPushDescriptorSetInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stageFlags, move_src.stageFlags);
+    std::swap(layout, move_src.layout);
+    std::swap(set, move_src.set);
+    std::swap(descriptorWriteCount, move_src.descriptorWriteCount);
+    std::swap(pDescriptorWrites, move_src.pDescriptorWrites);
+
+    return *this;
+}
+
 safe_VkPushDescriptorSetInfoKHR::~safe_VkPushDescriptorSetInfoKHR() {
     if (pDescriptorWrites) delete[] pDescriptorWrites;
     FreePnextChain(pNext);
@@ -12850,6 +16074,26 @@ safe_VkPushDescriptorSetWithTemplateInfoKHR& safe_VkPushDescriptorSetWithTemplat
     return *this;
 }
 
+safe_VkPushDescriptorSetWithTemplateInfoKHR::safe_VkPushDescriptorSetWithTemplateInfoKHR(
+    safe_VkPushDescriptorSetWithTemplateInfoKHR&& move_src) noexcept
+    : safe_VkPushDescriptorSetWithTemplateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPushDescriptorSetWithTemplateInfoKHR& safe_VkPushDescriptorSetWithTemplateInfoKHR::operator=(
+    safe_VkPushDescriptorSetWithTemplateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(descriptorUpdateTemplate, move_src.descriptorUpdateTemplate);
+    std::swap(layout, move_src.layout);
+    std::swap(set, move_src.set);
+    std::swap(pData, move_src.pData);
+
+    return *this;
+}
+
 safe_VkPushDescriptorSetWithTemplateInfoKHR::~safe_VkPushDescriptorSetWithTemplateInfoKHR() {
     if (pData != nullptr) {
         auto temp = reinterpret_cast<const std::byte*>(pData);
@@ -13006,6 +16250,29 @@ safe_VkAccelerationStructureGeometryTrianglesDataKHR& safe_VkAccelerationStructu
     return *this;
 }
 
+safe_VkAccelerationStructureGeometryTrianglesDataKHR::safe_VkAccelerationStructureGeometryTrianglesDataKHR(
+    safe_VkAccelerationStructureGeometryTrianglesDataKHR&& move_src) noexcept
+    : safe_VkAccelerationStructureGeometryTrianglesDataKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureGeometryTrianglesDataKHR& safe_VkAccelerationStructureGeometryTrianglesDataKHR::operator=(
+    safe_VkAccelerationStructureGeometryTrianglesDataKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(vertexFormat, move_src.vertexFormat);
+    std::swap(vertexData, move_src.vertexData);
+    std::swap(vertexStride, move_src.vertexStride);
+    std::swap(maxVertex, move_src.maxVertex);
+    std::swap(indexType, move_src.indexType);
+    std::swap(indexData, move_src.indexData);
+    std::swap(transformData, move_src.transformData);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureGeometryTrianglesDataKHR::~safe_VkAccelerationStructureGeometryTrianglesDataKHR() {
     FreePnextChain(pNext);
 }
@@ -13070,6 +16337,24 @@ safe_VkAccelerationStructureGeometryAabbsDataKHR& safe_VkAccelerationStructureGe
     return *this;
 }
 
+safe_VkAccelerationStructureGeometryAabbsDataKHR::safe_VkAccelerationStructureGeometryAabbsDataKHR(
+    safe_VkAccelerationStructureGeometryAabbsDataKHR&& move_src) noexcept
+    : safe_VkAccelerationStructureGeometryAabbsDataKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureGeometryAabbsDataKHR& safe_VkAccelerationStructureGeometryAabbsDataKHR::operator=(
+    safe_VkAccelerationStructureGeometryAabbsDataKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(data, move_src.data);
+    std::swap(stride, move_src.stride);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureGeometryAabbsDataKHR::~safe_VkAccelerationStructureGeometryAabbsDataKHR() { FreePnextChain(pNext); }
 
 void safe_VkAccelerationStructureGeometryAabbsDataKHR::initialize(const VkAccelerationStructureGeometryAabbsDataKHR* in_struct,
@@ -13122,6 +16407,24 @@ safe_VkAccelerationStructureGeometryInstancesDataKHR& safe_VkAccelerationStructu
     return *this;
 }
 
+safe_VkAccelerationStructureGeometryInstancesDataKHR::safe_VkAccelerationStructureGeometryInstancesDataKHR(
+    safe_VkAccelerationStructureGeometryInstancesDataKHR&& move_src) noexcept
+    : safe_VkAccelerationStructureGeometryInstancesDataKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureGeometryInstancesDataKHR& safe_VkAccelerationStructureGeometryInstancesDataKHR::operator=(
+    safe_VkAccelerationStructureGeometryInstancesDataKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(arrayOfPointers, move_src.arrayOfPointers);
+    std::swap(data, move_src.data);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureGeometryInstancesDataKHR::~safe_VkAccelerationStructureGeometryInstancesDataKHR() {
     FreePnextChain(pNext);
 }
@@ -13491,6 +16794,31 @@ safe_VkAccelerationStructureBuildGeometryInfoKHR& safe_VkAccelerationStructureBu
     return *this;
 }
 
+safe_VkAccelerationStructureBuildGeometryInfoKHR::safe_VkAccelerationStructureBuildGeometryInfoKHR(
+    safe_VkAccelerationStructureBuildGeometryInfoKHR&& move_src) noexcept
+    : safe_VkAccelerationStructureBuildGeometryInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureBuildGeometryInfoKHR& safe_VkAccelerationStructureBuildGeometryInfoKHR::operator=(
+    safe_VkAccelerationStructureBuildGeometryInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(type, move_src.type);
+    std::swap(flags, move_src.flags);
+    std::swap(mode, move_src.mode);
+    std::swap(srcAccelerationStructure, move_src.srcAccelerationStructure);
+    std::swap(dstAccelerationStructure, move_src.dstAccelerationStructure);
+    std::swap(geometryCount, move_src.geometryCount);
+    std::swap(pGeometries, move_src.pGeometries);
+    std::swap(ppGeometries, move_src.ppGeometries);
+    std::swap(scratchData, move_src.scratchData);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureBuildGeometryInfoKHR::~safe_VkAccelerationStructureBuildGeometryInfoKHR() {
     if (ppGeometries) {
         for (uint32_t i = 0; i < geometryCount; ++i) {
@@ -13625,6 +16953,28 @@ safe_VkAccelerationStructureCreateInfoKHR& safe_VkAccelerationStructureCreateInf
     return *this;
 }
 
+safe_VkAccelerationStructureCreateInfoKHR::safe_VkAccelerationStructureCreateInfoKHR(
+    safe_VkAccelerationStructureCreateInfoKHR&& move_src) noexcept
+    : safe_VkAccelerationStructureCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureCreateInfoKHR& safe_VkAccelerationStructureCreateInfoKHR::operator=(
+    safe_VkAccelerationStructureCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(createFlags, move_src.createFlags);
+    std::swap(buffer, move_src.buffer);
+    std::swap(offset, move_src.offset);
+    std::swap(size, move_src.size);
+    std::swap(type, move_src.type);
+    std::swap(deviceAddress, move_src.deviceAddress);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureCreateInfoKHR::~safe_VkAccelerationStructureCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkAccelerationStructureCreateInfoKHR::initialize(const VkAccelerationStructureCreateInfoKHR* in_struct,
@@ -13707,6 +17057,24 @@ safe_VkWriteDescriptorSetAccelerationStructureKHR& safe_VkWriteDescriptorSetAcce
     return *this;
 }
 
+safe_VkWriteDescriptorSetAccelerationStructureKHR::safe_VkWriteDescriptorSetAccelerationStructureKHR(
+    safe_VkWriteDescriptorSetAccelerationStructureKHR&& move_src) noexcept
+    : safe_VkWriteDescriptorSetAccelerationStructureKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkWriteDescriptorSetAccelerationStructureKHR& safe_VkWriteDescriptorSetAccelerationStructureKHR::operator=(
+    safe_VkWriteDescriptorSetAccelerationStructureKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(accelerationStructureCount, move_src.accelerationStructureCount);
+    std::swap(pAccelerationStructures, move_src.pAccelerationStructures);
+
+    return *this;
+}
+
 safe_VkWriteDescriptorSetAccelerationStructureKHR::~safe_VkWriteDescriptorSetAccelerationStructureKHR() {
     if (pAccelerationStructures) delete[] pAccelerationStructures;
     FreePnextChain(pNext);
@@ -13792,6 +17160,28 @@ safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR& safe_VkPhysicalDeviceAcce
     return *this;
 }
 
+safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR::safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR(
+    safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR& safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(accelerationStructure, move_src.accelerationStructure);
+    std::swap(accelerationStructureCaptureReplay, move_src.accelerationStructureCaptureReplay);
+    std::swap(accelerationStructureIndirectBuild, move_src.accelerationStructureIndirectBuild);
+    std::swap(accelerationStructureHostCommands, move_src.accelerationStructureHostCommands);
+    std::swap(descriptorBindingAccelerationStructureUpdateAfterBind,
+              move_src.descriptorBindingAccelerationStructureUpdateAfterBind);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR::~safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR() {
     FreePnextChain(pNext);
 }
@@ -13885,6 +17275,32 @@ safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR& safe_VkPhysicalDeviceAc
     return *this;
 }
 
+safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR::safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR(
+    safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR& safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR::operator=(
+    safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxGeometryCount, move_src.maxGeometryCount);
+    std::swap(maxInstanceCount, move_src.maxInstanceCount);
+    std::swap(maxPrimitiveCount, move_src.maxPrimitiveCount);
+    std::swap(maxPerStageDescriptorAccelerationStructures, move_src.maxPerStageDescriptorAccelerationStructures);
+    std::swap(maxPerStageDescriptorUpdateAfterBindAccelerationStructures,
+              move_src.maxPerStageDescriptorUpdateAfterBindAccelerationStructures);
+    std::swap(maxDescriptorSetAccelerationStructures, move_src.maxDescriptorSetAccelerationStructures);
+    std::swap(maxDescriptorSetUpdateAfterBindAccelerationStructures,
+              move_src.maxDescriptorSetUpdateAfterBindAccelerationStructures);
+    std::swap(minAccelerationStructureScratchOffsetAlignment, move_src.minAccelerationStructureScratchOffsetAlignment);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR::~safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR() {
     FreePnextChain(pNext);
 }
@@ -13951,6 +17367,23 @@ safe_VkAccelerationStructureDeviceAddressInfoKHR& safe_VkAccelerationStructureDe
     return *this;
 }
 
+safe_VkAccelerationStructureDeviceAddressInfoKHR::safe_VkAccelerationStructureDeviceAddressInfoKHR(
+    safe_VkAccelerationStructureDeviceAddressInfoKHR&& move_src) noexcept
+    : safe_VkAccelerationStructureDeviceAddressInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureDeviceAddressInfoKHR& safe_VkAccelerationStructureDeviceAddressInfoKHR::operator=(
+    safe_VkAccelerationStructureDeviceAddressInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(accelerationStructure, move_src.accelerationStructure);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureDeviceAddressInfoKHR::~safe_VkAccelerationStructureDeviceAddressInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkAccelerationStructureDeviceAddressInfoKHR::initialize(const VkAccelerationStructureDeviceAddressInfoKHR* in_struct,
@@ -14014,6 +17447,23 @@ safe_VkAccelerationStructureVersionInfoKHR& safe_VkAccelerationStructureVersionI
     return *this;
 }
 
+safe_VkAccelerationStructureVersionInfoKHR::safe_VkAccelerationStructureVersionInfoKHR(
+    safe_VkAccelerationStructureVersionInfoKHR&& move_src) noexcept
+    : safe_VkAccelerationStructureVersionInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureVersionInfoKHR& safe_VkAccelerationStructureVersionInfoKHR::operator=(
+    safe_VkAccelerationStructureVersionInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pVersionData, move_src.pVersionData);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureVersionInfoKHR::~safe_VkAccelerationStructureVersionInfoKHR() {
     if (pVersionData) delete[] pVersionData;
     FreePnextChain(pNext);
@@ -14080,6 +17530,25 @@ safe_VkCopyAccelerationStructureToMemoryInfoKHR& safe_VkCopyAccelerationStructur
     return *this;
 }
 
+safe_VkCopyAccelerationStructureToMemoryInfoKHR::safe_VkCopyAccelerationStructureToMemoryInfoKHR(
+    safe_VkCopyAccelerationStructureToMemoryInfoKHR&& move_src) noexcept
+    : safe_VkCopyAccelerationStructureToMemoryInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyAccelerationStructureToMemoryInfoKHR& safe_VkCopyAccelerationStructureToMemoryInfoKHR::operator=(
+    safe_VkCopyAccelerationStructureToMemoryInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(src, move_src.src);
+    std::swap(dst, move_src.dst);
+    std::swap(mode, move_src.mode);
+
+    return *this;
+}
+
 safe_VkCopyAccelerationStructureToMemoryInfoKHR::~safe_VkCopyAccelerationStructureToMemoryInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkCopyAccelerationStructureToMemoryInfoKHR::initialize(const VkCopyAccelerationStructureToMemoryInfoKHR* in_struct,
@@ -14136,6 +17605,25 @@ safe_VkCopyMemoryToAccelerationStructureInfoKHR& safe_VkCopyMemoryToAcceleration
     return *this;
 }
 
+safe_VkCopyMemoryToAccelerationStructureInfoKHR::safe_VkCopyMemoryToAccelerationStructureInfoKHR(
+    safe_VkCopyMemoryToAccelerationStructureInfoKHR&& move_src) noexcept
+    : safe_VkCopyMemoryToAccelerationStructureInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyMemoryToAccelerationStructureInfoKHR& safe_VkCopyMemoryToAccelerationStructureInfoKHR::operator=(
+    safe_VkCopyMemoryToAccelerationStructureInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(src, move_src.src);
+    std::swap(dst, move_src.dst);
+    std::swap(mode, move_src.mode);
+
+    return *this;
+}
+
 safe_VkCopyMemoryToAccelerationStructureInfoKHR::~safe_VkCopyMemoryToAccelerationStructureInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkCopyMemoryToAccelerationStructureInfoKHR::initialize(const VkCopyMemoryToAccelerationStructureInfoKHR* in_struct,
@@ -14192,6 +17680,25 @@ safe_VkCopyAccelerationStructureInfoKHR& safe_VkCopyAccelerationStructureInfoKHR
     return *this;
 }
 
+safe_VkCopyAccelerationStructureInfoKHR::safe_VkCopyAccelerationStructureInfoKHR(
+    safe_VkCopyAccelerationStructureInfoKHR&& move_src) noexcept
+    : safe_VkCopyAccelerationStructureInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyAccelerationStructureInfoKHR& safe_VkCopyAccelerationStructureInfoKHR::operator=(
+    safe_VkCopyAccelerationStructureInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(src, move_src.src);
+    std::swap(dst, move_src.dst);
+    std::swap(mode, move_src.mode);
+
+    return *this;
+}
+
 safe_VkCopyAccelerationStructureInfoKHR::~safe_VkCopyAccelerationStructureInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkCopyAccelerationStructureInfoKHR::initialize(const VkCopyAccelerationStructureInfoKHR* in_struct,
@@ -14255,6 +17762,25 @@ safe_VkAccelerationStructureBuildSizesInfoKHR& safe_VkAccelerationStructureBuild
     return *this;
 }
 
+safe_VkAccelerationStructureBuildSizesInfoKHR::safe_VkAccelerationStructureBuildSizesInfoKHR(
+    safe_VkAccelerationStructureBuildSizesInfoKHR&& move_src) noexcept
+    : safe_VkAccelerationStructureBuildSizesInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureBuildSizesInfoKHR& safe_VkAccelerationStructureBuildSizesInfoKHR::operator=(
+    safe_VkAccelerationStructureBuildSizesInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(accelerationStructureSize, move_src.accelerationStructureSize);
+    std::swap(updateScratchSize, move_src.updateScratchSize);
+    std::swap(buildScratchSize, move_src.buildScratchSize);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureBuildSizesInfoKHR::~safe_VkAccelerationStructureBuildSizesInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkAccelerationStructureBuildSizesInfoKHR::initialize(const VkAccelerationStructureBuildSizesInfoKHR* in_struct,
@@ -14330,6 +17856,28 @@ safe_VkRayTracingShaderGroupCreateInfoKHR& safe_VkRayTracingShaderGroupCreateInf
     return *this;
 }
 
+safe_VkRayTracingShaderGroupCreateInfoKHR::safe_VkRayTracingShaderGroupCreateInfoKHR(
+    safe_VkRayTracingShaderGroupCreateInfoKHR&& move_src) noexcept
+    : safe_VkRayTracingShaderGroupCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkRayTracingShaderGroupCreateInfoKHR& safe_VkRayTracingShaderGroupCreateInfoKHR::operator=(
+    safe_VkRayTracingShaderGroupCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(type, move_src.type);
+    std::swap(generalShader, move_src.generalShader);
+    std::swap(closestHitShader, move_src.closestHitShader);
+    std::swap(anyHitShader, move_src.anyHitShader);
+    std::swap(intersectionShader, move_src.intersectionShader);
+    std::swap(pShaderGroupCaptureReplayHandle, move_src.pShaderGroupCaptureReplayHandle);
+
+    return *this;
+}
+
 safe_VkRayTracingShaderGroupCreateInfoKHR::~safe_VkRayTracingShaderGroupCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkRayTracingShaderGroupCreateInfoKHR::initialize(const VkRayTracingShaderGroupCreateInfoKHR* in_struct,
@@ -14395,6 +17943,24 @@ safe_VkRayTracingPipelineInterfaceCreateInfoKHR& safe_VkRayTracingPipelineInterf
     return *this;
 }
 
+safe_VkRayTracingPipelineInterfaceCreateInfoKHR::safe_VkRayTracingPipelineInterfaceCreateInfoKHR(
+    safe_VkRayTracingPipelineInterfaceCreateInfoKHR&& move_src) noexcept
+    : safe_VkRayTracingPipelineInterfaceCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkRayTracingPipelineInterfaceCreateInfoKHR& safe_VkRayTracingPipelineInterfaceCreateInfoKHR::operator=(
+    safe_VkRayTracingPipelineInterfaceCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxPipelineRayPayloadSize, move_src.maxPipelineRayPayloadSize);
+    std::swap(maxPipelineRayHitAttributeSize, move_src.maxPipelineRayHitAttributeSize);
+
+    return *this;
+}
+
 safe_VkRayTracingPipelineInterfaceCreateInfoKHR::~safe_VkRayTracingPipelineInterfaceCreateInfoKHR() { FreePnextChain(pNext); }
 
 void safe_VkRayTracingPipelineInterfaceCreateInfoKHR::initialize(const VkRayTracingPipelineInterfaceCreateInfoKHR* in_struct,
@@ -14546,6 +18112,34 @@ safe_VkRayTracingPipelineCreateInfoKHR& safe_VkRayTracingPipelineCreateInfoKHR::
     return *this;
 }
 
+safe_VkRayTracingPipelineCreateInfoKHR::safe_VkRayTracingPipelineCreateInfoKHR(
+    safe_VkRayTracingPipelineCreateInfoKHR&& move_src) noexcept
+    : safe_VkRayTracingPipelineCreateInfoKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkRayTracingPipelineCreateInfoKHR& safe_VkRayTracingPipelineCreateInfoKHR::operator=(
+    safe_VkRayTracingPipelineCreateInfoKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(stageCount, move_src.stageCount);
+    std::swap(pStages, move_src.pStages);
+    std::swap(groupCount, move_src.groupCount);
+    std::swap(pGroups, move_src.pGroups);
+    std::swap(maxPipelineRayRecursionDepth, move_src.maxPipelineRayRecursionDepth);
+    std::swap(pLibraryInfo, move_src.pLibraryInfo);
+    std::swap(pLibraryInterface, move_src.pLibraryInterface);
+    std::swap(pDynamicState, move_src.pDynamicState);
+    std::swap(layout, move_src.layout);
+    std::swap(basePipelineHandle, move_src.basePipelineHandle);
+    std::swap(basePipelineIndex, move_src.basePipelineIndex);
+
+    return *this;
+}
+
 safe_VkRayTracingPipelineCreateInfoKHR::~safe_VkRayTracingPipelineCreateInfoKHR() {
     if (pStages) delete[] pStages;
     if (pGroups) delete[] pGroups;
@@ -14679,6 +18273,28 @@ safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR& safe_VkPhysicalDeviceRayTrac
     return *this;
 }
 
+safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR::safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR(
+    safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR& safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(rayTracingPipeline, move_src.rayTracingPipeline);
+    std::swap(rayTracingPipelineShaderGroupHandleCaptureReplay, move_src.rayTracingPipelineShaderGroupHandleCaptureReplay);
+    std::swap(rayTracingPipelineShaderGroupHandleCaptureReplayMixed,
+              move_src.rayTracingPipelineShaderGroupHandleCaptureReplayMixed);
+    std::swap(rayTracingPipelineTraceRaysIndirect, move_src.rayTracingPipelineTraceRaysIndirect);
+    std::swap(rayTraversalPrimitiveCulling, move_src.rayTraversalPrimitiveCulling);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR::~safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR::initialize(const VkPhysicalDeviceRayTracingPipelineFeaturesKHR* in_struct,
@@ -14766,6 +18382,30 @@ safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR& safe_VkPhysicalDeviceRayTr
     return *this;
 }
 
+safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR::safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR(
+    safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR& safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR::operator=(
+    safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderGroupHandleSize, move_src.shaderGroupHandleSize);
+    std::swap(maxRayRecursionDepth, move_src.maxRayRecursionDepth);
+    std::swap(maxShaderGroupStride, move_src.maxShaderGroupStride);
+    std::swap(shaderGroupBaseAlignment, move_src.shaderGroupBaseAlignment);
+    std::swap(shaderGroupHandleCaptureReplaySize, move_src.shaderGroupHandleCaptureReplaySize);
+    std::swap(maxRayDispatchInvocationCount, move_src.maxRayDispatchInvocationCount);
+    std::swap(shaderGroupHandleAlignment, move_src.shaderGroupHandleAlignment);
+    std::swap(maxRayHitAttributeSize, move_src.maxRayHitAttributeSize);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR::~safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR() {
     FreePnextChain(pNext);
 }
@@ -14830,6 +18470,23 @@ safe_VkPhysicalDeviceRayQueryFeaturesKHR& safe_VkPhysicalDeviceRayQueryFeaturesK
     return *this;
 }
 
+safe_VkPhysicalDeviceRayQueryFeaturesKHR::safe_VkPhysicalDeviceRayQueryFeaturesKHR(
+    safe_VkPhysicalDeviceRayQueryFeaturesKHR&& move_src) noexcept
+    : safe_VkPhysicalDeviceRayQueryFeaturesKHR() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRayQueryFeaturesKHR& safe_VkPhysicalDeviceRayQueryFeaturesKHR::operator=(
+    safe_VkPhysicalDeviceRayQueryFeaturesKHR&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(rayQuery, move_src.rayQuery);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRayQueryFeaturesKHR::~safe_VkPhysicalDeviceRayQueryFeaturesKHR() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceRayQueryFeaturesKHR::initialize(const VkPhysicalDeviceRayQueryFeaturesKHR* in_struct,
@@ -94,6 +94,24 @@ safe_VkAttachmentSampleCountInfoAMD& safe_VkAttachmentSampleCountInfoAMD::operat
     return *this;
 }
 
+safe_VkAttachmentSampleCountInfoAMD::safe_VkAttachmentSampleCountInfoAMD(safe_VkAttachmentSampleCountInfoAMD&& move_src) noexcept
+    : safe_VkAttachmentSampleCountInfoAMD() {
+    *this = std::move(move_src);
+}
+
+safe_VkAttachmentSampleCountInfoAMD& safe_VkAttachmentSampleCountInfoAMD::operator=(
+    safe_VkAttachmentSampleCountInfoAMD&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(colorAttachmentCount, move_src.colorAttachmentCount);
+    std::swap(pColorAttachmentSamples, move_src.pColorAttachmentSamples);
+    std::swap(depthStencilAttachmentSamples, move_src.depthStencilAttachmentSamples);
+
+    return *this;
+}
+
 safe_VkAttachmentSampleCountInfoAMD::~safe_VkAttachmentSampleCountInfoAMD() {
     if (pColorAttachmentSamples) delete[] pColorAttachmentSamples;
     FreePnextChain(pNext);
@@ -169,6 +187,24 @@ safe_VkMultiviewPerViewAttributesInfoNVX& safe_VkMultiviewPerViewAttributesInfoN
     return *this;
 }
 
+safe_VkMultiviewPerViewAttributesInfoNVX::safe_VkMultiviewPerViewAttributesInfoNVX(
+    safe_VkMultiviewPerViewAttributesInfoNVX&& move_src) noexcept
+    : safe_VkMultiviewPerViewAttributesInfoNVX() {
+    *this = std::move(move_src);
+}
+
+safe_VkMultiviewPerViewAttributesInfoNVX& safe_VkMultiviewPerViewAttributesInfoNVX::operator=(
+    safe_VkMultiviewPerViewAttributesInfoNVX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(perViewAttributes, move_src.perViewAttributes);
+    std::swap(perViewAttributesPositionXOnly, move_src.perViewAttributesPositionXOnly);
+
+    return *this;
+}
+
 safe_VkMultiviewPerViewAttributesInfoNVX::~safe_VkMultiviewPerViewAttributesInfoNVX() { FreePnextChain(pNext); }
 
 void safe_VkMultiviewPerViewAttributesInfoNVX::initialize(const VkMultiviewPerViewAttributesInfoNVX* in_struct,
@@ -219,6 +255,23 @@ safe_VkQueueFamilyCheckpointProperties2NV& safe_VkQueueFamilyCheckpointPropertie
     return *this;
 }
 
+safe_VkQueueFamilyCheckpointProperties2NV::safe_VkQueueFamilyCheckpointProperties2NV(
+    safe_VkQueueFamilyCheckpointProperties2NV&& move_src) noexcept
+    : safe_VkQueueFamilyCheckpointProperties2NV() {
+    *this = std::move(move_src);
+}
+
+safe_VkQueueFamilyCheckpointProperties2NV& safe_VkQueueFamilyCheckpointProperties2NV::operator=(
+    safe_VkQueueFamilyCheckpointProperties2NV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(checkpointExecutionStageMask, move_src.checkpointExecutionStageMask);
+
+    return *this;
+}
+
 safe_VkQueueFamilyCheckpointProperties2NV::~safe_VkQueueFamilyCheckpointProperties2NV() { FreePnextChain(pNext); }
 
 void safe_VkQueueFamilyCheckpointProperties2NV::initialize(const VkQueueFamilyCheckpointProperties2NV* in_struct,
@@ -267,6 +320,21 @@ safe_VkCheckpointData2NV& safe_VkCheckpointData2NV::operator=(const safe_VkCheck
     return *this;
 }
 
+safe_VkCheckpointData2NV::safe_VkCheckpointData2NV(safe_VkCheckpointData2NV&& move_src) noexcept : safe_VkCheckpointData2NV() {
+    *this = std::move(move_src);
+}
+
+safe_VkCheckpointData2NV& safe_VkCheckpointData2NV::operator=(safe_VkCheckpointData2NV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stage, move_src.stage);
+    std::swap(pCheckpointMarker, move_src.pCheckpointMarker);
+
+    return *this;
+}
+
 safe_VkCheckpointData2NV::~safe_VkCheckpointData2NV() { FreePnextChain(pNext); }
 
 void safe_VkCheckpointData2NV::initialize(const VkCheckpointData2NV* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -316,6 +384,23 @@ safe_VkPipelineRasterizationStateRasterizationOrderAMD& safe_VkPipelineRasteriza
     return *this;
 }
 
+safe_VkPipelineRasterizationStateRasterizationOrderAMD::safe_VkPipelineRasterizationStateRasterizationOrderAMD(
+    safe_VkPipelineRasterizationStateRasterizationOrderAMD&& move_src) noexcept
+    : safe_VkPipelineRasterizationStateRasterizationOrderAMD() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineRasterizationStateRasterizationOrderAMD& safe_VkPipelineRasterizationStateRasterizationOrderAMD::operator=(
+    safe_VkPipelineRasterizationStateRasterizationOrderAMD&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(rasterizationOrder, move_src.rasterizationOrder);
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationStateRasterizationOrderAMD::~safe_VkPipelineRasterizationStateRasterizationOrderAMD() {
     FreePnextChain(pNext);
 }
@@ -366,6 +451,23 @@ safe_VkDedicatedAllocationImageCreateInfoNV& safe_VkDedicatedAllocationImageCrea
     return *this;
 }
 
+safe_VkDedicatedAllocationImageCreateInfoNV::safe_VkDedicatedAllocationImageCreateInfoNV(
+    safe_VkDedicatedAllocationImageCreateInfoNV&& move_src) noexcept
+    : safe_VkDedicatedAllocationImageCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkDedicatedAllocationImageCreateInfoNV& safe_VkDedicatedAllocationImageCreateInfoNV::operator=(
+    safe_VkDedicatedAllocationImageCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(dedicatedAllocation, move_src.dedicatedAllocation);
+
+    return *this;
+}
+
 safe_VkDedicatedAllocationImageCreateInfoNV::~safe_VkDedicatedAllocationImageCreateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkDedicatedAllocationImageCreateInfoNV::initialize(const VkDedicatedAllocationImageCreateInfoNV* in_struct,
@@ -414,6 +516,23 @@ safe_VkDedicatedAllocationBufferCreateInfoNV& safe_VkDedicatedAllocationBufferCr
     return *this;
 }
 
+safe_VkDedicatedAllocationBufferCreateInfoNV::safe_VkDedicatedAllocationBufferCreateInfoNV(
+    safe_VkDedicatedAllocationBufferCreateInfoNV&& move_src) noexcept
+    : safe_VkDedicatedAllocationBufferCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkDedicatedAllocationBufferCreateInfoNV& safe_VkDedicatedAllocationBufferCreateInfoNV::operator=(
+    safe_VkDedicatedAllocationBufferCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(dedicatedAllocation, move_src.dedicatedAllocation);
+
+    return *this;
+}
+
 safe_VkDedicatedAllocationBufferCreateInfoNV::~safe_VkDedicatedAllocationBufferCreateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkDedicatedAllocationBufferCreateInfoNV::initialize(const VkDedicatedAllocationBufferCreateInfoNV* in_struct,
@@ -464,6 +583,24 @@ safe_VkDedicatedAllocationMemoryAllocateInfoNV& safe_VkDedicatedAllocationMemory
     return *this;
 }
 
+safe_VkDedicatedAllocationMemoryAllocateInfoNV::safe_VkDedicatedAllocationMemoryAllocateInfoNV(
+    safe_VkDedicatedAllocationMemoryAllocateInfoNV&& move_src) noexcept
+    : safe_VkDedicatedAllocationMemoryAllocateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkDedicatedAllocationMemoryAllocateInfoNV& safe_VkDedicatedAllocationMemoryAllocateInfoNV::operator=(
+    safe_VkDedicatedAllocationMemoryAllocateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(image, move_src.image);
+    std::swap(buffer, move_src.buffer);
+
+    return *this;
+}
+
 safe_VkDedicatedAllocationMemoryAllocateInfoNV::~safe_VkDedicatedAllocationMemoryAllocateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkDedicatedAllocationMemoryAllocateInfoNV::initialize(const VkDedicatedAllocationMemoryAllocateInfoNV* in_struct,
@@ -533,6 +670,22 @@ safe_VkCuModuleCreateInfoNVX& safe_VkCuModuleCreateInfoNVX::operator=(const safe
     return *this;
 }
 
+safe_VkCuModuleCreateInfoNVX::safe_VkCuModuleCreateInfoNVX(safe_VkCuModuleCreateInfoNVX&& move_src) noexcept
+    : safe_VkCuModuleCreateInfoNVX() {
+    *this = std::move(move_src);
+}
+
+safe_VkCuModuleCreateInfoNVX& safe_VkCuModuleCreateInfoNVX::operator=(safe_VkCuModuleCreateInfoNVX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(dataSize, move_src.dataSize);
+    std::swap(pData, move_src.pData);
+
+    return *this;
+}
+
 safe_VkCuModuleCreateInfoNVX::~safe_VkCuModuleCreateInfoNVX() {
     if (pData != nullptr) {
         auto temp = reinterpret_cast<const std::byte*>(pData);
@@ -605,6 +758,22 @@ safe_VkCuFunctionCreateInfoNVX& safe_VkCuFunctionCreateInfoNVX::operator=(const
     return *this;
 }
 
+safe_VkCuFunctionCreateInfoNVX::safe_VkCuFunctionCreateInfoNVX(safe_VkCuFunctionCreateInfoNVX&& move_src) noexcept
+    : safe_VkCuFunctionCreateInfoNVX() {
+    *this = std::move(move_src);
+}
+
+safe_VkCuFunctionCreateInfoNVX& safe_VkCuFunctionCreateInfoNVX::operator=(safe_VkCuFunctionCreateInfoNVX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(module, move_src.module);
+    std::swap(pName, move_src.pName);
+
+    return *this;
+}
+
 safe_VkCuFunctionCreateInfoNVX::~safe_VkCuFunctionCreateInfoNVX() {
     if (pName) delete[] pName;
     FreePnextChain(pNext);
@@ -704,6 +873,31 @@ safe_VkCuLaunchInfoNVX& safe_VkCuLaunchInfoNVX::operator=(const safe_VkCuLaunchI
     return *this;
 }
 
+safe_VkCuLaunchInfoNVX::safe_VkCuLaunchInfoNVX(safe_VkCuLaunchInfoNVX&& move_src) noexcept : safe_VkCuLaunchInfoNVX() {
+    *this = std::move(move_src);
+}
+
+safe_VkCuLaunchInfoNVX& safe_VkCuLaunchInfoNVX::operator=(safe_VkCuLaunchInfoNVX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(function, move_src.function);
+    std::swap(gridDimX, move_src.gridDimX);
+    std::swap(gridDimY, move_src.gridDimY);
+    std::swap(gridDimZ, move_src.gridDimZ);
+    std::swap(blockDimX, move_src.blockDimX);
+    std::swap(blockDimY, move_src.blockDimY);
+    std::swap(blockDimZ, move_src.blockDimZ);
+    std::swap(sharedMemBytes, move_src.sharedMemBytes);
+    std::swap(paramCount, move_src.paramCount);
+    std::swap(pParams, move_src.pParams);
+    std::swap(extraCount, move_src.extraCount);
+    std::swap(pExtras, move_src.pExtras);
+
+    return *this;
+}
+
 safe_VkCuLaunchInfoNVX::~safe_VkCuLaunchInfoNVX() { FreePnextChain(pNext); }
 
 void safe_VkCuLaunchInfoNVX::initialize(const VkCuLaunchInfoNVX* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -777,6 +971,23 @@ safe_VkImageViewHandleInfoNVX& safe_VkImageViewHandleInfoNVX::operator=(const sa
     return *this;
 }
 
+safe_VkImageViewHandleInfoNVX::safe_VkImageViewHandleInfoNVX(safe_VkImageViewHandleInfoNVX&& move_src) noexcept
+    : safe_VkImageViewHandleInfoNVX() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageViewHandleInfoNVX& safe_VkImageViewHandleInfoNVX::operator=(safe_VkImageViewHandleInfoNVX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageView, move_src.imageView);
+    std::swap(descriptorType, move_src.descriptorType);
+    std::swap(sampler, move_src.sampler);
+
+    return *this;
+}
+
 safe_VkImageViewHandleInfoNVX::~safe_VkImageViewHandleInfoNVX() { FreePnextChain(pNext); }
 
 void safe_VkImageViewHandleInfoNVX::initialize(const VkImageViewHandleInfoNVX* in_struct,
@@ -831,6 +1042,23 @@ safe_VkImageViewAddressPropertiesNVX& safe_VkImageViewAddressPropertiesNVX::oper
     return *this;
 }
 
+safe_VkImageViewAddressPropertiesNVX::safe_VkImageViewAddressPropertiesNVX(safe_VkImageViewAddressPropertiesNVX&& move_src) noexcept
+    : safe_VkImageViewAddressPropertiesNVX() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageViewAddressPropertiesNVX& safe_VkImageViewAddressPropertiesNVX::operator=(
+    safe_VkImageViewAddressPropertiesNVX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceAddress, move_src.deviceAddress);
+    std::swap(size, move_src.size);
+
+    return *this;
+}
+
 safe_VkImageViewAddressPropertiesNVX::~safe_VkImageViewAddressPropertiesNVX() { FreePnextChain(pNext); }
 
 void safe_VkImageViewAddressPropertiesNVX::initialize(const VkImageViewAddressPropertiesNVX* in_struct,
@@ -881,6 +1109,23 @@ safe_VkTextureLODGatherFormatPropertiesAMD& safe_VkTextureLODGatherFormatPropert
     return *this;
 }
 
+safe_VkTextureLODGatherFormatPropertiesAMD::safe_VkTextureLODGatherFormatPropertiesAMD(
+    safe_VkTextureLODGatherFormatPropertiesAMD&& move_src) noexcept
+    : safe_VkTextureLODGatherFormatPropertiesAMD() {
+    *this = std::move(move_src);
+}
+
+safe_VkTextureLODGatherFormatPropertiesAMD& safe_VkTextureLODGatherFormatPropertiesAMD::operator=(
+    safe_VkTextureLODGatherFormatPropertiesAMD&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(supportsTextureGatherLODBiasAMD, move_src.supportsTextureGatherLODBiasAMD);
+
+    return *this;
+}
+
 safe_VkTextureLODGatherFormatPropertiesAMD::~safe_VkTextureLODGatherFormatPropertiesAMD() { FreePnextChain(pNext); }
 
 void safe_VkTextureLODGatherFormatPropertiesAMD::initialize(const VkTextureLODGatherFormatPropertiesAMD* in_struct,
@@ -932,6 +1177,24 @@ safe_VkStreamDescriptorSurfaceCreateInfoGGP& safe_VkStreamDescriptorSurfaceCreat
     return *this;
 }
 
+safe_VkStreamDescriptorSurfaceCreateInfoGGP::safe_VkStreamDescriptorSurfaceCreateInfoGGP(
+    safe_VkStreamDescriptorSurfaceCreateInfoGGP&& move_src) noexcept
+    : safe_VkStreamDescriptorSurfaceCreateInfoGGP() {
+    *this = std::move(move_src);
+}
+
+safe_VkStreamDescriptorSurfaceCreateInfoGGP& safe_VkStreamDescriptorSurfaceCreateInfoGGP::operator=(
+    safe_VkStreamDescriptorSurfaceCreateInfoGGP&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(streamDescriptor, move_src.streamDescriptor);
+
+    return *this;
+}
+
 safe_VkStreamDescriptorSurfaceCreateInfoGGP::~safe_VkStreamDescriptorSurfaceCreateInfoGGP() { FreePnextChain(pNext); }
 
 void safe_VkStreamDescriptorSurfaceCreateInfoGGP::initialize(const VkStreamDescriptorSurfaceCreateInfoGGP* in_struct,
@@ -983,6 +1246,23 @@ safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& safe_VkPhysicalDeviceCornerSa
     return *this;
 }
 
+safe_VkPhysicalDeviceCornerSampledImageFeaturesNV::safe_VkPhysicalDeviceCornerSampledImageFeaturesNV(
+    safe_VkPhysicalDeviceCornerSampledImageFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceCornerSampledImageFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& safe_VkPhysicalDeviceCornerSampledImageFeaturesNV::operator=(
+    safe_VkPhysicalDeviceCornerSampledImageFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(cornerSampledImage, move_src.cornerSampledImage);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCornerSampledImageFeaturesNV::~safe_VkPhysicalDeviceCornerSampledImageFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceCornerSampledImageFeaturesNV::initialize(const VkPhysicalDeviceCornerSampledImageFeaturesNV* in_struct,
@@ -1032,6 +1312,23 @@ safe_VkExternalMemoryImageCreateInfoNV& safe_VkExternalMemoryImageCreateInfoNV::
     return *this;
 }
 
+safe_VkExternalMemoryImageCreateInfoNV::safe_VkExternalMemoryImageCreateInfoNV(
+    safe_VkExternalMemoryImageCreateInfoNV&& move_src) noexcept
+    : safe_VkExternalMemoryImageCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkExternalMemoryImageCreateInfoNV& safe_VkExternalMemoryImageCreateInfoNV::operator=(
+    safe_VkExternalMemoryImageCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleTypes, move_src.handleTypes);
+
+    return *this;
+}
+
 safe_VkExternalMemoryImageCreateInfoNV::~safe_VkExternalMemoryImageCreateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkExternalMemoryImageCreateInfoNV::initialize(const VkExternalMemoryImageCreateInfoNV* in_struct,
@@ -1078,6 +1375,22 @@ safe_VkExportMemoryAllocateInfoNV& safe_VkExportMemoryAllocateInfoNV::operator=(
     return *this;
 }
 
+safe_VkExportMemoryAllocateInfoNV::safe_VkExportMemoryAllocateInfoNV(safe_VkExportMemoryAllocateInfoNV&& move_src) noexcept
+    : safe_VkExportMemoryAllocateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMemoryAllocateInfoNV& safe_VkExportMemoryAllocateInfoNV::operator=(
+    safe_VkExportMemoryAllocateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleTypes, move_src.handleTypes);
+
+    return *this;
+}
+
 safe_VkExportMemoryAllocateInfoNV::~safe_VkExportMemoryAllocateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkExportMemoryAllocateInfoNV::initialize(const VkExportMemoryAllocateInfoNV* in_struct,
@@ -1129,6 +1442,23 @@ safe_VkImportMemoryWin32HandleInfoNV& safe_VkImportMemoryWin32HandleInfoNV::oper
     return *this;
 }
 
+safe_VkImportMemoryWin32HandleInfoNV::safe_VkImportMemoryWin32HandleInfoNV(safe_VkImportMemoryWin32HandleInfoNV&& move_src) noexcept
+    : safe_VkImportMemoryWin32HandleInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportMemoryWin32HandleInfoNV& safe_VkImportMemoryWin32HandleInfoNV::operator=(
+    safe_VkImportMemoryWin32HandleInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleType, move_src.handleType);
+    std::swap(handle, move_src.handle);
+
+    return *this;
+}
+
 safe_VkImportMemoryWin32HandleInfoNV::~safe_VkImportMemoryWin32HandleInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkImportMemoryWin32HandleInfoNV::initialize(const VkImportMemoryWin32HandleInfoNV* in_struct,
@@ -1193,6 +1523,23 @@ safe_VkExportMemoryWin32HandleInfoNV& safe_VkExportMemoryWin32HandleInfoNV::oper
     return *this;
 }
 
+safe_VkExportMemoryWin32HandleInfoNV::safe_VkExportMemoryWin32HandleInfoNV(safe_VkExportMemoryWin32HandleInfoNV&& move_src) noexcept
+    : safe_VkExportMemoryWin32HandleInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkExportMemoryWin32HandleInfoNV& safe_VkExportMemoryWin32HandleInfoNV::operator=(
+    safe_VkExportMemoryWin32HandleInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pAttributes, move_src.pAttributes);
+    std::swap(dwAccess, move_src.dwAccess);
+
+    return *this;
+}
+
 safe_VkExportMemoryWin32HandleInfoNV::~safe_VkExportMemoryWin32HandleInfoNV() {
     if (pAttributes) delete pAttributes;
     FreePnextChain(pNext);
@@ -1371,6 +1718,29 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoNV& safe_VkWin32KeyedMutexAcquireRelease
     return *this;
 }
 
+safe_VkWin32KeyedMutexAcquireReleaseInfoNV::safe_VkWin32KeyedMutexAcquireReleaseInfoNV(
+    safe_VkWin32KeyedMutexAcquireReleaseInfoNV&& move_src) noexcept
+    : safe_VkWin32KeyedMutexAcquireReleaseInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkWin32KeyedMutexAcquireReleaseInfoNV& safe_VkWin32KeyedMutexAcquireReleaseInfoNV::operator=(
+    safe_VkWin32KeyedMutexAcquireReleaseInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(acquireCount, move_src.acquireCount);
+    std::swap(pAcquireSyncs, move_src.pAcquireSyncs);
+    std::swap(pAcquireKeys, move_src.pAcquireKeys);
+    std::swap(pAcquireTimeoutMilliseconds, move_src.pAcquireTimeoutMilliseconds);
+    std::swap(releaseCount, move_src.releaseCount);
+    std::swap(pReleaseSyncs, move_src.pReleaseSyncs);
+    std::swap(pReleaseKeys, move_src.pReleaseKeys);
+
+    return *this;
+}
+
 safe_VkWin32KeyedMutexAcquireReleaseInfoNV::~safe_VkWin32KeyedMutexAcquireReleaseInfoNV() {
     if (pAcquireSyncs) delete[] pAcquireSyncs;
     if (pAcquireKeys) delete[] pAcquireKeys;
@@ -1501,6 +1871,22 @@ safe_VkViSurfaceCreateInfoNN& safe_VkViSurfaceCreateInfoNN::operator=(const safe
     return *this;
 }
 
+safe_VkViSurfaceCreateInfoNN::safe_VkViSurfaceCreateInfoNN(safe_VkViSurfaceCreateInfoNN&& move_src) noexcept
+    : safe_VkViSurfaceCreateInfoNN() {
+    *this = std::move(move_src);
+}
+
+safe_VkViSurfaceCreateInfoNN& safe_VkViSurfaceCreateInfoNN::operator=(safe_VkViSurfaceCreateInfoNN&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(window, move_src.window);
+
+    return *this;
+}
+
 safe_VkViSurfaceCreateInfoNN::~safe_VkViSurfaceCreateInfoNN() { FreePnextChain(pNext); }
 
 void safe_VkViSurfaceCreateInfoNN::initialize(const VkViSurfaceCreateInfoNN* in_struct,
@@ -1581,6 +1967,25 @@ safe_VkPipelineViewportWScalingStateCreateInfoNV& safe_VkPipelineViewportWScalin
     return *this;
 }
 
+safe_VkPipelineViewportWScalingStateCreateInfoNV::safe_VkPipelineViewportWScalingStateCreateInfoNV(
+    safe_VkPipelineViewportWScalingStateCreateInfoNV&& move_src) noexcept
+    : safe_VkPipelineViewportWScalingStateCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineViewportWScalingStateCreateInfoNV& safe_VkPipelineViewportWScalingStateCreateInfoNV::operator=(
+    safe_VkPipelineViewportWScalingStateCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(viewportWScalingEnable, move_src.viewportWScalingEnable);
+    std::swap(viewportCount, move_src.viewportCount);
+    std::swap(pViewportWScalings, move_src.pViewportWScalings);
+
+    return *this;
+}
+
 safe_VkPipelineViewportWScalingStateCreateInfoNV::~safe_VkPipelineViewportWScalingStateCreateInfoNV() {
     if (pViewportWScalings) delete[] pViewportWScalings;
     FreePnextChain(pNext);
@@ -1664,6 +2069,22 @@ safe_VkPresentTimesInfoGOOGLE& safe_VkPresentTimesInfoGOOGLE::operator=(const sa
     return *this;
 }
 
+safe_VkPresentTimesInfoGOOGLE::safe_VkPresentTimesInfoGOOGLE(safe_VkPresentTimesInfoGOOGLE&& move_src) noexcept
+    : safe_VkPresentTimesInfoGOOGLE() {
+    *this = std::move(move_src);
+}
+
+safe_VkPresentTimesInfoGOOGLE& safe_VkPresentTimesInfoGOOGLE::operator=(safe_VkPresentTimesInfoGOOGLE&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(swapchainCount, move_src.swapchainCount);
+    std::swap(pTimes, move_src.pTimes);
+
+    return *this;
+}
+
 safe_VkPresentTimesInfoGOOGLE::~safe_VkPresentTimesInfoGOOGLE() {
     if (pTimes) delete[] pTimes;
     FreePnextChain(pNext);
@@ -1732,6 +2153,24 @@ safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX::safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(
+    safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX&& move_src) noexcept
+    : safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX&
+safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX::operator=(
+    safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(perViewPositionAllComponents, move_src.perViewPositionAllComponents);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX::~safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX() {
     FreePnextChain(pNext);
 }
@@ -1806,6 +2245,25 @@ safe_VkPipelineViewportSwizzleStateCreateInfoNV& safe_VkPipelineViewportSwizzleS
     return *this;
 }
 
+safe_VkPipelineViewportSwizzleStateCreateInfoNV::safe_VkPipelineViewportSwizzleStateCreateInfoNV(
+    safe_VkPipelineViewportSwizzleStateCreateInfoNV&& move_src) noexcept
+    : safe_VkPipelineViewportSwizzleStateCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineViewportSwizzleStateCreateInfoNV& safe_VkPipelineViewportSwizzleStateCreateInfoNV::operator=(
+    safe_VkPipelineViewportSwizzleStateCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(viewportCount, move_src.viewportCount);
+    std::swap(pViewportSwizzles, move_src.pViewportSwizzles);
+
+    return *this;
+}
+
 safe_VkPipelineViewportSwizzleStateCreateInfoNV::~safe_VkPipelineViewportSwizzleStateCreateInfoNV() {
     if (pViewportSwizzles) delete[] pViewportSwizzles;
     FreePnextChain(pNext);
@@ -1876,6 +2334,23 @@ safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG& safe_VkPhysicalDeviceR
     return *this;
 }
 
+safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG::safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG(
+    safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG&& move_src) noexcept
+    : safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG& safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG::operator=(
+    safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(relaxedLineRasterization, move_src.relaxedLineRasterization);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG::~safe_VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG() {
     FreePnextChain(pNext);
 }
@@ -1927,6 +2402,23 @@ safe_VkAndroidHardwareBufferUsageANDROID& safe_VkAndroidHardwareBufferUsageANDRO
     return *this;
 }
 
+safe_VkAndroidHardwareBufferUsageANDROID::safe_VkAndroidHardwareBufferUsageANDROID(
+    safe_VkAndroidHardwareBufferUsageANDROID&& move_src) noexcept
+    : safe_VkAndroidHardwareBufferUsageANDROID() {
+    *this = std::move(move_src);
+}
+
+safe_VkAndroidHardwareBufferUsageANDROID& safe_VkAndroidHardwareBufferUsageANDROID::operator=(
+    safe_VkAndroidHardwareBufferUsageANDROID&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(androidHardwareBufferUsage, move_src.androidHardwareBufferUsage);
+
+    return *this;
+}
+
 safe_VkAndroidHardwareBufferUsageANDROID::~safe_VkAndroidHardwareBufferUsageANDROID() { FreePnextChain(pNext); }
 
 void safe_VkAndroidHardwareBufferUsageANDROID::initialize(const VkAndroidHardwareBufferUsageANDROID* in_struct,
@@ -1977,6 +2469,24 @@ safe_VkAndroidHardwareBufferPropertiesANDROID& safe_VkAndroidHardwareBufferPrope
     return *this;
 }
 
+safe_VkAndroidHardwareBufferPropertiesANDROID::safe_VkAndroidHardwareBufferPropertiesANDROID(
+    safe_VkAndroidHardwareBufferPropertiesANDROID&& move_src) noexcept
+    : safe_VkAndroidHardwareBufferPropertiesANDROID() {
+    *this = std::move(move_src);
+}
+
+safe_VkAndroidHardwareBufferPropertiesANDROID& safe_VkAndroidHardwareBufferPropertiesANDROID::operator=(
+    safe_VkAndroidHardwareBufferPropertiesANDROID&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(allocationSize, move_src.allocationSize);
+    std::swap(memoryTypeBits, move_src.memoryTypeBits);
+
+    return *this;
+}
+
 safe_VkAndroidHardwareBufferPropertiesANDROID::~safe_VkAndroidHardwareBufferPropertiesANDROID() { FreePnextChain(pNext); }
 
 void safe_VkAndroidHardwareBufferPropertiesANDROID::initialize(const VkAndroidHardwareBufferPropertiesANDROID* in_struct,
@@ -2058,6 +2568,30 @@ safe_VkAndroidHardwareBufferFormatPropertiesANDROID& safe_VkAndroidHardwareBuffe
     return *this;
 }
 
+safe_VkAndroidHardwareBufferFormatPropertiesANDROID::safe_VkAndroidHardwareBufferFormatPropertiesANDROID(
+    safe_VkAndroidHardwareBufferFormatPropertiesANDROID&& move_src) noexcept
+    : safe_VkAndroidHardwareBufferFormatPropertiesANDROID() {
+    *this = std::move(move_src);
+}
+
+safe_VkAndroidHardwareBufferFormatPropertiesANDROID& safe_VkAndroidHardwareBufferFormatPropertiesANDROID::operator=(
+    safe_VkAndroidHardwareBufferFormatPropertiesANDROID&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(format, move_src.format);
+    std::swap(externalFormat, move_src.externalFormat);
+    std::swap(formatFeatures, move_src.formatFeatures);
+    std::swap(samplerYcbcrConversionComponents, move_src.samplerYcbcrConversionComponents);
+    std::swap(suggestedYcbcrModel, move_src.suggestedYcbcrModel);
+    std::swap(suggestedYcbcrRange, move_src.suggestedYcbcrRange);
+    std::swap(suggestedXChromaOffset, move_src.suggestedXChromaOffset);
+    std::swap(suggestedYChromaOffset, move_src.suggestedYChromaOffset);
+
+    return *this;
+}
+
 safe_VkAndroidHardwareBufferFormatPropertiesANDROID::~safe_VkAndroidHardwareBufferFormatPropertiesANDROID() {
     FreePnextChain(pNext);
 }
@@ -2123,12 +2657,29 @@ safe_VkImportAndroidHardwareBufferInfoANDROID& safe_VkImportAndroidHardwareBuffe
     return *this;
 }
 
-safe_VkImportAndroidHardwareBufferInfoANDROID::~safe_VkImportAndroidHardwareBufferInfoANDROID() { FreePnextChain(pNext); }
+safe_VkImportAndroidHardwareBufferInfoANDROID::safe_VkImportAndroidHardwareBufferInfoANDROID(
+    safe_VkImportAndroidHardwareBufferInfoANDROID&& move_src) noexcept
+    : safe_VkImportAndroidHardwareBufferInfoANDROID() {
+    *this = std::move(move_src);
+}
 
-void safe_VkImportAndroidHardwareBufferInfoANDROID::initialize(const VkImportAndroidHardwareBufferInfoANDROID* in_struct,
-                                                               [[maybe_unused]] PNextCopyState* copy_state) {
-    FreePnextChain(pNext);
-    sType = in_struct->sType;
+safe_VkImportAndroidHardwareBufferInfoANDROID& safe_VkImportAndroidHardwareBufferInfoANDROID::operator=(
+    safe_VkImportAndroidHardwareBufferInfoANDROID&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(buffer, move_src.buffer);
+
+    return *this;
+}
+
+safe_VkImportAndroidHardwareBufferInfoANDROID::~safe_VkImportAndroidHardwareBufferInfoANDROID() { FreePnextChain(pNext); }
+
+void safe_VkImportAndroidHardwareBufferInfoANDROID::initialize(const VkImportAndroidHardwareBufferInfoANDROID* in_struct,
+                                                               [[maybe_unused]] PNextCopyState* copy_state) {
+    FreePnextChain(pNext);
+    sType = in_struct->sType;
     pNext = SafePnextCopy(in_struct->pNext, copy_state);
     buffer = in_struct->buffer;
 }
@@ -2171,6 +2722,23 @@ safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& safe_VkMemoryGetAndroidHardwar
     return *this;
 }
 
+safe_VkMemoryGetAndroidHardwareBufferInfoANDROID::safe_VkMemoryGetAndroidHardwareBufferInfoANDROID(
+    safe_VkMemoryGetAndroidHardwareBufferInfoANDROID&& move_src) noexcept
+    : safe_VkMemoryGetAndroidHardwareBufferInfoANDROID() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& safe_VkMemoryGetAndroidHardwareBufferInfoANDROID::operator=(
+    safe_VkMemoryGetAndroidHardwareBufferInfoANDROID&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memory, move_src.memory);
+
+    return *this;
+}
+
 safe_VkMemoryGetAndroidHardwareBufferInfoANDROID::~safe_VkMemoryGetAndroidHardwareBufferInfoANDROID() { FreePnextChain(pNext); }
 
 void safe_VkMemoryGetAndroidHardwareBufferInfoANDROID::initialize(const VkMemoryGetAndroidHardwareBufferInfoANDROID* in_struct,
@@ -2217,6 +2785,21 @@ safe_VkExternalFormatANDROID& safe_VkExternalFormatANDROID::operator=(const safe
     return *this;
 }
 
+safe_VkExternalFormatANDROID::safe_VkExternalFormatANDROID(safe_VkExternalFormatANDROID&& move_src) noexcept
+    : safe_VkExternalFormatANDROID() {
+    *this = std::move(move_src);
+}
+
+safe_VkExternalFormatANDROID& safe_VkExternalFormatANDROID::operator=(safe_VkExternalFormatANDROID&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(externalFormat, move_src.externalFormat);
+
+    return *this;
+}
+
 safe_VkExternalFormatANDROID::~safe_VkExternalFormatANDROID() { FreePnextChain(pNext); }
 
 void safe_VkExternalFormatANDROID::initialize(const VkExternalFormatANDROID* in_struct,
@@ -2296,6 +2879,30 @@ safe_VkAndroidHardwareBufferFormatProperties2ANDROID& safe_VkAndroidHardwareBuff
     return *this;
 }
 
+safe_VkAndroidHardwareBufferFormatProperties2ANDROID::safe_VkAndroidHardwareBufferFormatProperties2ANDROID(
+    safe_VkAndroidHardwareBufferFormatProperties2ANDROID&& move_src) noexcept
+    : safe_VkAndroidHardwareBufferFormatProperties2ANDROID() {
+    *this = std::move(move_src);
+}
+
+safe_VkAndroidHardwareBufferFormatProperties2ANDROID& safe_VkAndroidHardwareBufferFormatProperties2ANDROID::operator=(
+    safe_VkAndroidHardwareBufferFormatProperties2ANDROID&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(format, move_src.format);
+    std::swap(externalFormat, move_src.externalFormat);
+    std::swap(formatFeatures, move_src.formatFeatures);
+    std::swap(samplerYcbcrConversionComponents, move_src.samplerYcbcrConversionComponents);
+    std::swap(suggestedYcbcrModel, move_src.suggestedYcbcrModel);
+    std::swap(suggestedYcbcrRange, move_src.suggestedYcbcrRange);
+    std::swap(suggestedXChromaOffset, move_src.suggestedXChromaOffset);
+    std::swap(suggestedYChromaOffset, move_src.suggestedYChromaOffset);
+
+    return *this;
+}
+
 safe_VkAndroidHardwareBufferFormatProperties2ANDROID::~safe_VkAndroidHardwareBufferFormatProperties2ANDROID() {
     FreePnextChain(pNext);
 }
@@ -2362,6 +2969,23 @@ safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX& safe_VkPhysicalDeviceShaderEnque
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX::safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX(
+    safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX& safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX::operator=(
+    safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderEnqueue, move_src.shaderEnqueue);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX::~safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderEnqueueFeaturesAMDX::initialize(const VkPhysicalDeviceShaderEnqueueFeaturesAMDX* in_struct,
@@ -2429,6 +3053,27 @@ safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX& safe_VkPhysicalDeviceShaderEnq
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX::safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX(
+    safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX& safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX::operator=(
+    safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxExecutionGraphDepth, move_src.maxExecutionGraphDepth);
+    std::swap(maxExecutionGraphShaderOutputNodes, move_src.maxExecutionGraphShaderOutputNodes);
+    std::swap(maxExecutionGraphShaderPayloadSize, move_src.maxExecutionGraphShaderPayloadSize);
+    std::swap(maxExecutionGraphShaderPayloadCount, move_src.maxExecutionGraphShaderPayloadCount);
+    std::swap(executionGraphDispatchAddressAlignment, move_src.executionGraphDispatchAddressAlignment);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX::~safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderEnqueuePropertiesAMDX::initialize(const VkPhysicalDeviceShaderEnqueuePropertiesAMDX* in_struct,
@@ -2485,6 +3130,23 @@ safe_VkExecutionGraphPipelineScratchSizeAMDX& safe_VkExecutionGraphPipelineScrat
     return *this;
 }
 
+safe_VkExecutionGraphPipelineScratchSizeAMDX::safe_VkExecutionGraphPipelineScratchSizeAMDX(
+    safe_VkExecutionGraphPipelineScratchSizeAMDX&& move_src) noexcept
+    : safe_VkExecutionGraphPipelineScratchSizeAMDX() {
+    *this = std::move(move_src);
+}
+
+safe_VkExecutionGraphPipelineScratchSizeAMDX& safe_VkExecutionGraphPipelineScratchSizeAMDX::operator=(
+    safe_VkExecutionGraphPipelineScratchSizeAMDX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(size, move_src.size);
+
+    return *this;
+}
+
 safe_VkExecutionGraphPipelineScratchSizeAMDX::~safe_VkExecutionGraphPipelineScratchSizeAMDX() { FreePnextChain(pNext); }
 
 void safe_VkExecutionGraphPipelineScratchSizeAMDX::initialize(const VkExecutionGraphPipelineScratchSizeAMDX* in_struct,
@@ -2583,6 +3245,29 @@ safe_VkExecutionGraphPipelineCreateInfoAMDX& safe_VkExecutionGraphPipelineCreate
     return *this;
 }
 
+safe_VkExecutionGraphPipelineCreateInfoAMDX::safe_VkExecutionGraphPipelineCreateInfoAMDX(
+    safe_VkExecutionGraphPipelineCreateInfoAMDX&& move_src) noexcept
+    : safe_VkExecutionGraphPipelineCreateInfoAMDX() {
+    *this = std::move(move_src);
+}
+
+safe_VkExecutionGraphPipelineCreateInfoAMDX& safe_VkExecutionGraphPipelineCreateInfoAMDX::operator=(
+    safe_VkExecutionGraphPipelineCreateInfoAMDX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(stageCount, move_src.stageCount);
+    std::swap(pStages, move_src.pStages);
+    std::swap(pLibraryInfo, move_src.pLibraryInfo);
+    std::swap(layout, move_src.layout);
+    std::swap(basePipelineHandle, move_src.basePipelineHandle);
+    std::swap(basePipelineIndex, move_src.basePipelineIndex);
+
+    return *this;
+}
+
 safe_VkExecutionGraphPipelineCreateInfoAMDX::~safe_VkExecutionGraphPipelineCreateInfoAMDX() {
     if (pStages) delete[] pStages;
     if (pLibraryInfo) delete pLibraryInfo;
@@ -2703,6 +3388,24 @@ safe_VkPipelineShaderStageNodeCreateInfoAMDX& safe_VkPipelineShaderStageNodeCrea
     return *this;
 }
 
+safe_VkPipelineShaderStageNodeCreateInfoAMDX::safe_VkPipelineShaderStageNodeCreateInfoAMDX(
+    safe_VkPipelineShaderStageNodeCreateInfoAMDX&& move_src) noexcept
+    : safe_VkPipelineShaderStageNodeCreateInfoAMDX() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineShaderStageNodeCreateInfoAMDX& safe_VkPipelineShaderStageNodeCreateInfoAMDX::operator=(
+    safe_VkPipelineShaderStageNodeCreateInfoAMDX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pName, move_src.pName);
+    std::swap(index, move_src.index);
+
+    return *this;
+}
+
 safe_VkPipelineShaderStageNodeCreateInfoAMDX::~safe_VkPipelineShaderStageNodeCreateInfoAMDX() {
     if (pName) delete[] pName;
     FreePnextChain(pNext);
@@ -2769,6 +3472,25 @@ safe_VkPipelineCoverageToColorStateCreateInfoNV& safe_VkPipelineCoverageToColorS
     return *this;
 }
 
+safe_VkPipelineCoverageToColorStateCreateInfoNV::safe_VkPipelineCoverageToColorStateCreateInfoNV(
+    safe_VkPipelineCoverageToColorStateCreateInfoNV&& move_src) noexcept
+    : safe_VkPipelineCoverageToColorStateCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineCoverageToColorStateCreateInfoNV& safe_VkPipelineCoverageToColorStateCreateInfoNV::operator=(
+    safe_VkPipelineCoverageToColorStateCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(coverageToColorEnable, move_src.coverageToColorEnable);
+    std::swap(coverageToColorLocation, move_src.coverageToColorLocation);
+
+    return *this;
+}
+
 safe_VkPipelineCoverageToColorStateCreateInfoNV::~safe_VkPipelineCoverageToColorStateCreateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkPipelineCoverageToColorStateCreateInfoNV::initialize(const VkPipelineCoverageToColorStateCreateInfoNV* in_struct,
@@ -2858,6 +3580,27 @@ safe_VkPipelineCoverageModulationStateCreateInfoNV& safe_VkPipelineCoverageModul
     return *this;
 }
 
+safe_VkPipelineCoverageModulationStateCreateInfoNV::safe_VkPipelineCoverageModulationStateCreateInfoNV(
+    safe_VkPipelineCoverageModulationStateCreateInfoNV&& move_src) noexcept
+    : safe_VkPipelineCoverageModulationStateCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineCoverageModulationStateCreateInfoNV& safe_VkPipelineCoverageModulationStateCreateInfoNV::operator=(
+    safe_VkPipelineCoverageModulationStateCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(coverageModulationMode, move_src.coverageModulationMode);
+    std::swap(coverageModulationTableEnable, move_src.coverageModulationTableEnable);
+    std::swap(coverageModulationTableCount, move_src.coverageModulationTableCount);
+    std::swap(pCoverageModulationTable, move_src.pCoverageModulationTable);
+
+    return *this;
+}
+
 safe_VkPipelineCoverageModulationStateCreateInfoNV::~safe_VkPipelineCoverageModulationStateCreateInfoNV() {
     if (pCoverageModulationTable) delete[] pCoverageModulationTable;
     FreePnextChain(pNext);
@@ -2935,6 +3678,24 @@ safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& safe_VkPhysicalDeviceShaderSM
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV::safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV(
+    safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV::operator=(
+    safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderSMCount, move_src.shaderSMCount);
+    std::swap(shaderWarpsPerSM, move_src.shaderWarpsPerSM);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV::~safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV::initialize(const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV* in_struct,
@@ -2985,6 +3746,23 @@ safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& safe_VkPhysicalDeviceShaderSMBu
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV::safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV(
+    safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV::operator=(
+    safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderSMBuiltins, move_src.shaderSMBuiltins);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV::~safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV::initialize(const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV* in_struct,
@@ -3042,6 +3820,20 @@ safe_VkShadingRatePaletteNV& safe_VkShadingRatePaletteNV::operator=(const safe_V
     return *this;
 }
 
+safe_VkShadingRatePaletteNV::safe_VkShadingRatePaletteNV(safe_VkShadingRatePaletteNV&& move_src) noexcept
+    : safe_VkShadingRatePaletteNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkShadingRatePaletteNV& safe_VkShadingRatePaletteNV::operator=(safe_VkShadingRatePaletteNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(shadingRatePaletteEntryCount, move_src.shadingRatePaletteEntryCount);
+    std::swap(pShadingRatePaletteEntries, move_src.pShadingRatePaletteEntries);
+
+    return *this;
+}
+
 safe_VkShadingRatePaletteNV::~safe_VkShadingRatePaletteNV() {
     if (pShadingRatePaletteEntries) delete[] pShadingRatePaletteEntries;
 }
@@ -3132,6 +3924,25 @@ safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& safe_VkPipelineViewpor
     return *this;
 }
 
+safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::safe_VkPipelineViewportShadingRateImageStateCreateInfoNV(
+    safe_VkPipelineViewportShadingRateImageStateCreateInfoNV&& move_src) noexcept
+    : safe_VkPipelineViewportShadingRateImageStateCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::operator=(
+    safe_VkPipelineViewportShadingRateImageStateCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shadingRateImageEnable, move_src.shadingRateImageEnable);
+    std::swap(viewportCount, move_src.viewportCount);
+    std::swap(pShadingRatePalettes, move_src.pShadingRatePalettes);
+
+    return *this;
+}
+
 safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::~safe_VkPipelineViewportShadingRateImageStateCreateInfoNV() {
     if (pShadingRatePalettes) delete[] pShadingRatePalettes;
     FreePnextChain(pNext);
@@ -3207,6 +4018,24 @@ safe_VkPhysicalDeviceShadingRateImageFeaturesNV& safe_VkPhysicalDeviceShadingRat
     return *this;
 }
 
+safe_VkPhysicalDeviceShadingRateImageFeaturesNV::safe_VkPhysicalDeviceShadingRateImageFeaturesNV(
+    safe_VkPhysicalDeviceShadingRateImageFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceShadingRateImageFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShadingRateImageFeaturesNV& safe_VkPhysicalDeviceShadingRateImageFeaturesNV::operator=(
+    safe_VkPhysicalDeviceShadingRateImageFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shadingRateImage, move_src.shadingRateImage);
+    std::swap(shadingRateCoarseSampleOrder, move_src.shadingRateCoarseSampleOrder);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShadingRateImageFeaturesNV::~safe_VkPhysicalDeviceShadingRateImageFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShadingRateImageFeaturesNV::initialize(const VkPhysicalDeviceShadingRateImageFeaturesNV* in_struct,
@@ -3268,6 +4097,25 @@ safe_VkPhysicalDeviceShadingRateImagePropertiesNV& safe_VkPhysicalDeviceShadingR
     return *this;
 }
 
+safe_VkPhysicalDeviceShadingRateImagePropertiesNV::safe_VkPhysicalDeviceShadingRateImagePropertiesNV(
+    safe_VkPhysicalDeviceShadingRateImagePropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceShadingRateImagePropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShadingRateImagePropertiesNV& safe_VkPhysicalDeviceShadingRateImagePropertiesNV::operator=(
+    safe_VkPhysicalDeviceShadingRateImagePropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shadingRateTexelSize, move_src.shadingRateTexelSize);
+    std::swap(shadingRatePaletteSize, move_src.shadingRatePaletteSize);
+    std::swap(shadingRateMaxCoarseSamples, move_src.shadingRateMaxCoarseSamples);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShadingRateImagePropertiesNV::~safe_VkPhysicalDeviceShadingRateImagePropertiesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShadingRateImagePropertiesNV::initialize(const VkPhysicalDeviceShadingRateImagePropertiesNV* in_struct,
@@ -3337,6 +4185,23 @@ safe_VkCoarseSampleOrderCustomNV& safe_VkCoarseSampleOrderCustomNV::operator=(co
     return *this;
 }
 
+safe_VkCoarseSampleOrderCustomNV::safe_VkCoarseSampleOrderCustomNV(safe_VkCoarseSampleOrderCustomNV&& move_src) noexcept
+    : safe_VkCoarseSampleOrderCustomNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkCoarseSampleOrderCustomNV& safe_VkCoarseSampleOrderCustomNV::operator=(
+    safe_VkCoarseSampleOrderCustomNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(shadingRate, move_src.shadingRate);
+    std::swap(sampleCount, move_src.sampleCount);
+    std::swap(sampleLocationCount, move_src.sampleLocationCount);
+    std::swap(pSampleLocations, move_src.pSampleLocations);
+
+    return *this;
+}
+
 safe_VkCoarseSampleOrderCustomNV::~safe_VkCoarseSampleOrderCustomNV() {
     if (pSampleLocations) delete[] pSampleLocations;
 }
@@ -3432,6 +4297,25 @@ safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& safe_VkPipelineViewpo
     return *this;
 }
 
+safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV(
+    safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV&& move_src) noexcept
+    : safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::operator=(
+    safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(sampleOrderType, move_src.sampleOrderType);
+    std::swap(customSampleOrderCount, move_src.customSampleOrderCount);
+    std::swap(pCustomSampleOrders, move_src.pCustomSampleOrders);
+
+    return *this;
+}
+
 safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::~safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV() {
     if (pCustomSampleOrders) delete[] pCustomSampleOrders;
     FreePnextChain(pNext);
@@ -3519,6 +4403,27 @@ safe_VkRayTracingShaderGroupCreateInfoNV& safe_VkRayTracingShaderGroupCreateInfo
     return *this;
 }
 
+safe_VkRayTracingShaderGroupCreateInfoNV::safe_VkRayTracingShaderGroupCreateInfoNV(
+    safe_VkRayTracingShaderGroupCreateInfoNV&& move_src) noexcept
+    : safe_VkRayTracingShaderGroupCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkRayTracingShaderGroupCreateInfoNV& safe_VkRayTracingShaderGroupCreateInfoNV::operator=(
+    safe_VkRayTracingShaderGroupCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(type, move_src.type);
+    std::swap(generalShader, move_src.generalShader);
+    std::swap(closestHitShader, move_src.closestHitShader);
+    std::swap(anyHitShader, move_src.anyHitShader);
+    std::swap(intersectionShader, move_src.intersectionShader);
+
+    return *this;
+}
+
 safe_VkRayTracingShaderGroupCreateInfoNV::~safe_VkRayTracingShaderGroupCreateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkRayTracingShaderGroupCreateInfoNV::initialize(const VkRayTracingShaderGroupCreateInfoNV* in_struct,
@@ -3649,6 +4554,31 @@ safe_VkRayTracingPipelineCreateInfoNV& safe_VkRayTracingPipelineCreateInfoNV::op
     return *this;
 }
 
+safe_VkRayTracingPipelineCreateInfoNV::safe_VkRayTracingPipelineCreateInfoNV(
+    safe_VkRayTracingPipelineCreateInfoNV&& move_src) noexcept
+    : safe_VkRayTracingPipelineCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkRayTracingPipelineCreateInfoNV& safe_VkRayTracingPipelineCreateInfoNV::operator=(
+    safe_VkRayTracingPipelineCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(stageCount, move_src.stageCount);
+    std::swap(pStages, move_src.pStages);
+    std::swap(groupCount, move_src.groupCount);
+    std::swap(pGroups, move_src.pGroups);
+    std::swap(maxRecursionDepth, move_src.maxRecursionDepth);
+    std::swap(layout, move_src.layout);
+    std::swap(basePipelineHandle, move_src.basePipelineHandle);
+    std::swap(basePipelineIndex, move_src.basePipelineIndex);
+
+    return *this;
+}
+
 safe_VkRayTracingPipelineCreateInfoNV::~safe_VkRayTracingPipelineCreateInfoNV() {
     if (pStages) delete[] pStages;
     if (pGroups) delete[] pGroups;
@@ -3784,6 +4714,31 @@ safe_VkGeometryTrianglesNV& safe_VkGeometryTrianglesNV::operator=(const safe_VkG
     return *this;
 }
 
+safe_VkGeometryTrianglesNV::safe_VkGeometryTrianglesNV(safe_VkGeometryTrianglesNV&& move_src) noexcept
+    : safe_VkGeometryTrianglesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkGeometryTrianglesNV& safe_VkGeometryTrianglesNV::operator=(safe_VkGeometryTrianglesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(vertexData, move_src.vertexData);
+    std::swap(vertexOffset, move_src.vertexOffset);
+    std::swap(vertexCount, move_src.vertexCount);
+    std::swap(vertexStride, move_src.vertexStride);
+    std::swap(vertexFormat, move_src.vertexFormat);
+    std::swap(indexData, move_src.indexData);
+    std::swap(indexOffset, move_src.indexOffset);
+    std::swap(indexCount, move_src.indexCount);
+    std::swap(indexType, move_src.indexType);
+    std::swap(transformData, move_src.transformData);
+    std::swap(transformOffset, move_src.transformOffset);
+
+    return *this;
+}
+
 safe_VkGeometryTrianglesNV::~safe_VkGeometryTrianglesNV() { FreePnextChain(pNext); }
 
 void safe_VkGeometryTrianglesNV::initialize(const VkGeometryTrianglesNV* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -3859,6 +4814,23 @@ safe_VkGeometryAABBNV& safe_VkGeometryAABBNV::operator=(const safe_VkGeometryAAB
     return *this;
 }
 
+safe_VkGeometryAABBNV::safe_VkGeometryAABBNV(safe_VkGeometryAABBNV&& move_src) noexcept : safe_VkGeometryAABBNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkGeometryAABBNV& safe_VkGeometryAABBNV::operator=(safe_VkGeometryAABBNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(aabbData, move_src.aabbData);
+    std::swap(numAABBs, move_src.numAABBs);
+    std::swap(stride, move_src.stride);
+    std::swap(offset, move_src.offset);
+
+    return *this;
+}
+
 safe_VkGeometryAABBNV::~safe_VkGeometryAABBNV() { FreePnextChain(pNext); }
 
 void safe_VkGeometryAABBNV::initialize(const VkGeometryAABBNV* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -3912,6 +4884,22 @@ safe_VkGeometryNV& safe_VkGeometryNV::operator=(const safe_VkGeometryNV& copy_sr
     return *this;
 }
 
+safe_VkGeometryNV::safe_VkGeometryNV(safe_VkGeometryNV&& move_src) noexcept : safe_VkGeometryNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkGeometryNV& safe_VkGeometryNV::operator=(safe_VkGeometryNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(geometryType, move_src.geometryType);
+    std::swap(geometry, move_src.geometry);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkGeometryNV::~safe_VkGeometryNV() { FreePnextChain(pNext); }
 
 void safe_VkGeometryNV::initialize(const VkGeometryNV* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -3999,6 +4987,26 @@ safe_VkAccelerationStructureInfoNV& safe_VkAccelerationStructureInfoNV::operator
     return *this;
 }
 
+safe_VkAccelerationStructureInfoNV::safe_VkAccelerationStructureInfoNV(safe_VkAccelerationStructureInfoNV&& move_src) noexcept
+    : safe_VkAccelerationStructureInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureInfoNV& safe_VkAccelerationStructureInfoNV::operator=(
+    safe_VkAccelerationStructureInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(type, move_src.type);
+    std::swap(flags, move_src.flags);
+    std::swap(instanceCount, move_src.instanceCount);
+    std::swap(geometryCount, move_src.geometryCount);
+    std::swap(pGeometries, move_src.pGeometries);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureInfoNV::~safe_VkAccelerationStructureInfoNV() {
     if (pGeometries) delete[] pGeometries;
     FreePnextChain(pNext);
@@ -4073,6 +5081,24 @@ safe_VkAccelerationStructureCreateInfoNV& safe_VkAccelerationStructureCreateInfo
     return *this;
 }
 
+safe_VkAccelerationStructureCreateInfoNV::safe_VkAccelerationStructureCreateInfoNV(
+    safe_VkAccelerationStructureCreateInfoNV&& move_src) noexcept
+    : safe_VkAccelerationStructureCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureCreateInfoNV& safe_VkAccelerationStructureCreateInfoNV::operator=(
+    safe_VkAccelerationStructureCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(compactedSize, move_src.compactedSize);
+    std::swap(info, move_src.info);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureCreateInfoNV::~safe_VkAccelerationStructureCreateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkAccelerationStructureCreateInfoNV::initialize(const VkAccelerationStructureCreateInfoNV* in_struct,
@@ -4157,6 +5183,27 @@ safe_VkBindAccelerationStructureMemoryInfoNV& safe_VkBindAccelerationStructureMe
     return *this;
 }
 
+safe_VkBindAccelerationStructureMemoryInfoNV::safe_VkBindAccelerationStructureMemoryInfoNV(
+    safe_VkBindAccelerationStructureMemoryInfoNV&& move_src) noexcept
+    : safe_VkBindAccelerationStructureMemoryInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkBindAccelerationStructureMemoryInfoNV& safe_VkBindAccelerationStructureMemoryInfoNV::operator=(
+    safe_VkBindAccelerationStructureMemoryInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(accelerationStructure, move_src.accelerationStructure);
+    std::swap(memory, move_src.memory);
+    std::swap(memoryOffset, move_src.memoryOffset);
+    std::swap(deviceIndexCount, move_src.deviceIndexCount);
+    std::swap(pDeviceIndices, move_src.pDeviceIndices);
+
+    return *this;
+}
+
 safe_VkBindAccelerationStructureMemoryInfoNV::~safe_VkBindAccelerationStructureMemoryInfoNV() {
     if (pDeviceIndices) delete[] pDeviceIndices;
     FreePnextChain(pNext);
@@ -4251,6 +5298,24 @@ safe_VkWriteDescriptorSetAccelerationStructureNV& safe_VkWriteDescriptorSetAccel
     return *this;
 }
 
+safe_VkWriteDescriptorSetAccelerationStructureNV::safe_VkWriteDescriptorSetAccelerationStructureNV(
+    safe_VkWriteDescriptorSetAccelerationStructureNV&& move_src) noexcept
+    : safe_VkWriteDescriptorSetAccelerationStructureNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkWriteDescriptorSetAccelerationStructureNV& safe_VkWriteDescriptorSetAccelerationStructureNV::operator=(
+    safe_VkWriteDescriptorSetAccelerationStructureNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(accelerationStructureCount, move_src.accelerationStructureCount);
+    std::swap(pAccelerationStructures, move_src.pAccelerationStructures);
+
+    return *this;
+}
+
 safe_VkWriteDescriptorSetAccelerationStructureNV::~safe_VkWriteDescriptorSetAccelerationStructureNV() {
     if (pAccelerationStructures) delete[] pAccelerationStructures;
     FreePnextChain(pNext);
@@ -4322,6 +5387,24 @@ safe_VkAccelerationStructureMemoryRequirementsInfoNV& safe_VkAccelerationStructu
     return *this;
 }
 
+safe_VkAccelerationStructureMemoryRequirementsInfoNV::safe_VkAccelerationStructureMemoryRequirementsInfoNV(
+    safe_VkAccelerationStructureMemoryRequirementsInfoNV&& move_src) noexcept
+    : safe_VkAccelerationStructureMemoryRequirementsInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureMemoryRequirementsInfoNV& safe_VkAccelerationStructureMemoryRequirementsInfoNV::operator=(
+    safe_VkAccelerationStructureMemoryRequirementsInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(type, move_src.type);
+    std::swap(accelerationStructure, move_src.accelerationStructure);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureMemoryRequirementsInfoNV::~safe_VkAccelerationStructureMemoryRequirementsInfoNV() {
     FreePnextChain(pNext);
 }
@@ -4405,6 +5488,30 @@ safe_VkPhysicalDeviceRayTracingPropertiesNV& safe_VkPhysicalDeviceRayTracingProp
     return *this;
 }
 
+safe_VkPhysicalDeviceRayTracingPropertiesNV::safe_VkPhysicalDeviceRayTracingPropertiesNV(
+    safe_VkPhysicalDeviceRayTracingPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceRayTracingPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRayTracingPropertiesNV& safe_VkPhysicalDeviceRayTracingPropertiesNV::operator=(
+    safe_VkPhysicalDeviceRayTracingPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderGroupHandleSize, move_src.shaderGroupHandleSize);
+    std::swap(maxRecursionDepth, move_src.maxRecursionDepth);
+    std::swap(maxShaderGroupStride, move_src.maxShaderGroupStride);
+    std::swap(shaderGroupBaseAlignment, move_src.shaderGroupBaseAlignment);
+    std::swap(maxGeometryCount, move_src.maxGeometryCount);
+    std::swap(maxInstanceCount, move_src.maxInstanceCount);
+    std::swap(maxTriangleCount, move_src.maxTriangleCount);
+    std::swap(maxDescriptorSetAccelerationStructures, move_src.maxDescriptorSetAccelerationStructures);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRayTracingPropertiesNV::~safe_VkPhysicalDeviceRayTracingPropertiesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceRayTracingPropertiesNV::initialize(const VkPhysicalDeviceRayTracingPropertiesNV* in_struct,
@@ -4470,6 +5577,23 @@ safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& safe_VkPhysicalDevice
     return *this;
 }
 
+safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV::safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV(
+    safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV::operator=(
+    safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(representativeFragmentTest, move_src.representativeFragmentTest);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV::~safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -4523,6 +5647,23 @@ safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& safe_VkPipelineRepre
     return *this;
 }
 
+safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV::safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV(
+    safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV&& move_src) noexcept
+    : safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV::operator=(
+    safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(representativeFragmentTestEnable, move_src.representativeFragmentTestEnable);
+
+    return *this;
+}
+
 safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV::~safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV() {
     FreePnextChain(pNext);
 }
@@ -4573,6 +5714,23 @@ safe_VkPipelineCompilerControlCreateInfoAMD& safe_VkPipelineCompilerControlCreat
     return *this;
 }
 
+safe_VkPipelineCompilerControlCreateInfoAMD::safe_VkPipelineCompilerControlCreateInfoAMD(
+    safe_VkPipelineCompilerControlCreateInfoAMD&& move_src) noexcept
+    : safe_VkPipelineCompilerControlCreateInfoAMD() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineCompilerControlCreateInfoAMD& safe_VkPipelineCompilerControlCreateInfoAMD::operator=(
+    safe_VkPipelineCompilerControlCreateInfoAMD&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(compilerControlFlags, move_src.compilerControlFlags);
+
+    return *this;
+}
+
 safe_VkPipelineCompilerControlCreateInfoAMD::~safe_VkPipelineCompilerControlCreateInfoAMD() { FreePnextChain(pNext); }
 
 void safe_VkPipelineCompilerControlCreateInfoAMD::initialize(const VkPipelineCompilerControlCreateInfoAMD* in_struct,
@@ -4676,6 +5834,36 @@ safe_VkPhysicalDeviceShaderCorePropertiesAMD& safe_VkPhysicalDeviceShaderCorePro
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderCorePropertiesAMD::safe_VkPhysicalDeviceShaderCorePropertiesAMD(
+    safe_VkPhysicalDeviceShaderCorePropertiesAMD&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderCorePropertiesAMD() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderCorePropertiesAMD& safe_VkPhysicalDeviceShaderCorePropertiesAMD::operator=(
+    safe_VkPhysicalDeviceShaderCorePropertiesAMD&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderEngineCount, move_src.shaderEngineCount);
+    std::swap(shaderArraysPerEngineCount, move_src.shaderArraysPerEngineCount);
+    std::swap(computeUnitsPerShaderArray, move_src.computeUnitsPerShaderArray);
+    std::swap(simdPerComputeUnit, move_src.simdPerComputeUnit);
+    std::swap(wavefrontsPerSimd, move_src.wavefrontsPerSimd);
+    std::swap(wavefrontSize, move_src.wavefrontSize);
+    std::swap(sgprsPerSimd, move_src.sgprsPerSimd);
+    std::swap(minSgprAllocation, move_src.minSgprAllocation);
+    std::swap(maxSgprAllocation, move_src.maxSgprAllocation);
+    std::swap(sgprAllocationGranularity, move_src.sgprAllocationGranularity);
+    std::swap(vgprsPerSimd, move_src.vgprsPerSimd);
+    std::swap(minVgprAllocation, move_src.minVgprAllocation);
+    std::swap(maxVgprAllocation, move_src.maxVgprAllocation);
+    std::swap(vgprAllocationGranularity, move_src.vgprAllocationGranularity);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderCorePropertiesAMD::~safe_VkPhysicalDeviceShaderCorePropertiesAMD() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderCorePropertiesAMD::initialize(const VkPhysicalDeviceShaderCorePropertiesAMD* in_struct,
@@ -4750,6 +5938,23 @@ safe_VkDeviceMemoryOverallocationCreateInfoAMD& safe_VkDeviceMemoryOverallocatio
     return *this;
 }
 
+safe_VkDeviceMemoryOverallocationCreateInfoAMD::safe_VkDeviceMemoryOverallocationCreateInfoAMD(
+    safe_VkDeviceMemoryOverallocationCreateInfoAMD&& move_src) noexcept
+    : safe_VkDeviceMemoryOverallocationCreateInfoAMD() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceMemoryOverallocationCreateInfoAMD& safe_VkDeviceMemoryOverallocationCreateInfoAMD::operator=(
+    safe_VkDeviceMemoryOverallocationCreateInfoAMD&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(overallocationBehavior, move_src.overallocationBehavior);
+
+    return *this;
+}
+
 safe_VkDeviceMemoryOverallocationCreateInfoAMD::~safe_VkDeviceMemoryOverallocationCreateInfoAMD() { FreePnextChain(pNext); }
 
 void safe_VkDeviceMemoryOverallocationCreateInfoAMD::initialize(const VkDeviceMemoryOverallocationCreateInfoAMD* in_struct,
@@ -4797,6 +6002,21 @@ safe_VkPresentFrameTokenGGP& safe_VkPresentFrameTokenGGP::operator=(const safe_V
     return *this;
 }
 
+safe_VkPresentFrameTokenGGP::safe_VkPresentFrameTokenGGP(safe_VkPresentFrameTokenGGP&& move_src) noexcept
+    : safe_VkPresentFrameTokenGGP() {
+    *this = std::move(move_src);
+}
+
+safe_VkPresentFrameTokenGGP& safe_VkPresentFrameTokenGGP::operator=(safe_VkPresentFrameTokenGGP&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(frameToken, move_src.frameToken);
+
+    return *this;
+}
+
 safe_VkPresentFrameTokenGGP::~safe_VkPresentFrameTokenGGP() { FreePnextChain(pNext); }
 
 void safe_VkPresentFrameTokenGGP::initialize(const VkPresentFrameTokenGGP* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -4853,6 +6073,24 @@ safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& safe_VkPhysicalDeviceCo
     return *this;
 }
 
+safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV::safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV(
+    safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV::operator=(
+    safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(computeDerivativeGroupQuads, move_src.computeDerivativeGroupQuads);
+    std::swap(computeDerivativeGroupLinear, move_src.computeDerivativeGroupLinear);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV::~safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -4907,6 +6145,24 @@ safe_VkPhysicalDeviceMeshShaderFeaturesNV& safe_VkPhysicalDeviceMeshShaderFeatur
     return *this;
 }
 
+safe_VkPhysicalDeviceMeshShaderFeaturesNV::safe_VkPhysicalDeviceMeshShaderFeaturesNV(
+    safe_VkPhysicalDeviceMeshShaderFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceMeshShaderFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMeshShaderFeaturesNV& safe_VkPhysicalDeviceMeshShaderFeaturesNV::operator=(
+    safe_VkPhysicalDeviceMeshShaderFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(taskShader, move_src.taskShader);
+    std::swap(meshShader, move_src.meshShader);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMeshShaderFeaturesNV::~safe_VkPhysicalDeviceMeshShaderFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMeshShaderFeaturesNV::initialize(const VkPhysicalDeviceMeshShaderFeaturesNV* in_struct,
@@ -5023,6 +6279,35 @@ safe_VkPhysicalDeviceMeshShaderPropertiesNV& safe_VkPhysicalDeviceMeshShaderProp
     return *this;
 }
 
+safe_VkPhysicalDeviceMeshShaderPropertiesNV::safe_VkPhysicalDeviceMeshShaderPropertiesNV(
+    safe_VkPhysicalDeviceMeshShaderPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceMeshShaderPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMeshShaderPropertiesNV& safe_VkPhysicalDeviceMeshShaderPropertiesNV::operator=(
+    safe_VkPhysicalDeviceMeshShaderPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxDrawMeshTasksCount, move_src.maxDrawMeshTasksCount);
+    std::swap(maxTaskWorkGroupInvocations, move_src.maxTaskWorkGroupInvocations);
+    std::swap(maxTaskWorkGroupSize, move_src.maxTaskWorkGroupSize);
+    std::swap(maxTaskTotalMemorySize, move_src.maxTaskTotalMemorySize);
+    std::swap(maxTaskOutputCount, move_src.maxTaskOutputCount);
+    std::swap(maxMeshWorkGroupInvocations, move_src.maxMeshWorkGroupInvocations);
+    std::swap(maxMeshWorkGroupSize, move_src.maxMeshWorkGroupSize);
+    std::swap(maxMeshTotalMemorySize, move_src.maxMeshTotalMemorySize);
+    std::swap(maxMeshOutputVertices, move_src.maxMeshOutputVertices);
+    std::swap(maxMeshOutputPrimitives, move_src.maxMeshOutputPrimitives);
+    std::swap(maxMeshMultiviewViewCount, move_src.maxMeshMultiviewViewCount);
+    std::swap(meshOutputPerVertexGranularity, move_src.meshOutputPerVertexGranularity);
+    std::swap(meshOutputPerPrimitiveGranularity, move_src.meshOutputPerPrimitiveGranularity);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMeshShaderPropertiesNV::~safe_VkPhysicalDeviceMeshShaderPropertiesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMeshShaderPropertiesNV::initialize(const VkPhysicalDeviceMeshShaderPropertiesNV* in_struct,
@@ -5107,6 +6392,23 @@ safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& safe_VkPhysicalDeviceShader
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV::safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV(
+    safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV::operator=(
+    safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageFootprint, move_src.imageFootprint);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV::~safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -5179,6 +6481,24 @@ safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& safe_VkPipelineViewpor
     return *this;
 }
 
+safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV(
+    safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV&& move_src) noexcept
+    : safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::operator=(
+    safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(exclusiveScissorCount, move_src.exclusiveScissorCount);
+    std::swap(pExclusiveScissors, move_src.pExclusiveScissors);
+
+    return *this;
+}
+
 safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::~safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV() {
     if (pExclusiveScissors) delete[] pExclusiveScissors;
     FreePnextChain(pNext);
@@ -5244,6 +6564,23 @@ safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& safe_VkPhysicalDeviceExclusiveS
     return *this;
 }
 
+safe_VkPhysicalDeviceExclusiveScissorFeaturesNV::safe_VkPhysicalDeviceExclusiveScissorFeaturesNV(
+    safe_VkPhysicalDeviceExclusiveScissorFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceExclusiveScissorFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& safe_VkPhysicalDeviceExclusiveScissorFeaturesNV::operator=(
+    safe_VkPhysicalDeviceExclusiveScissorFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(exclusiveScissor, move_src.exclusiveScissor);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExclusiveScissorFeaturesNV::~safe_VkPhysicalDeviceExclusiveScissorFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceExclusiveScissorFeaturesNV::initialize(const VkPhysicalDeviceExclusiveScissorFeaturesNV* in_struct,
@@ -5292,6 +6629,23 @@ safe_VkQueueFamilyCheckpointPropertiesNV& safe_VkQueueFamilyCheckpointProperties
     return *this;
 }
 
+safe_VkQueueFamilyCheckpointPropertiesNV::safe_VkQueueFamilyCheckpointPropertiesNV(
+    safe_VkQueueFamilyCheckpointPropertiesNV&& move_src) noexcept
+    : safe_VkQueueFamilyCheckpointPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkQueueFamilyCheckpointPropertiesNV& safe_VkQueueFamilyCheckpointPropertiesNV::operator=(
+    safe_VkQueueFamilyCheckpointPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(checkpointExecutionStageMask, move_src.checkpointExecutionStageMask);
+
+    return *this;
+}
+
 safe_VkQueueFamilyCheckpointPropertiesNV::~safe_VkQueueFamilyCheckpointPropertiesNV() { FreePnextChain(pNext); }
 
 void safe_VkQueueFamilyCheckpointPropertiesNV::initialize(const VkQueueFamilyCheckpointPropertiesNV* in_struct,
@@ -5340,6 +6694,21 @@ safe_VkCheckpointDataNV& safe_VkCheckpointDataNV::operator=(const safe_VkCheckpo
     return *this;
 }
 
+safe_VkCheckpointDataNV::safe_VkCheckpointDataNV(safe_VkCheckpointDataNV&& move_src) noexcept : safe_VkCheckpointDataNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkCheckpointDataNV& safe_VkCheckpointDataNV::operator=(safe_VkCheckpointDataNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stage, move_src.stage);
+    std::swap(pCheckpointMarker, move_src.pCheckpointMarker);
+
+    return *this;
+}
+
 safe_VkCheckpointDataNV::~safe_VkCheckpointDataNV() { FreePnextChain(pNext); }
 
 void safe_VkCheckpointDataNV::initialize(const VkCheckpointDataNV* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -5391,6 +6760,23 @@ safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& safe_VkPhysicalDevice
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL::safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL(
+    safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL::operator=(
+    safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderIntegerFunctions2, move_src.shaderIntegerFunctions2);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL::~safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL() {
     FreePnextChain(pNext);
 }
@@ -5492,6 +6878,23 @@ safe_VkInitializePerformanceApiInfoINTEL& safe_VkInitializePerformanceApiInfoINT
     return *this;
 }
 
+safe_VkInitializePerformanceApiInfoINTEL::safe_VkInitializePerformanceApiInfoINTEL(
+    safe_VkInitializePerformanceApiInfoINTEL&& move_src) noexcept
+    : safe_VkInitializePerformanceApiInfoINTEL() {
+    *this = std::move(move_src);
+}
+
+safe_VkInitializePerformanceApiInfoINTEL& safe_VkInitializePerformanceApiInfoINTEL::operator=(
+    safe_VkInitializePerformanceApiInfoINTEL&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pUserData, move_src.pUserData);
+
+    return *this;
+}
+
 safe_VkInitializePerformanceApiInfoINTEL::~safe_VkInitializePerformanceApiInfoINTEL() { FreePnextChain(pNext); }
 
 void safe_VkInitializePerformanceApiInfoINTEL::initialize(const VkInitializePerformanceApiInfoINTEL* in_struct,
@@ -5540,6 +6943,23 @@ safe_VkQueryPoolPerformanceQueryCreateInfoINTEL& safe_VkQueryPoolPerformanceQuer
     return *this;
 }
 
+safe_VkQueryPoolPerformanceQueryCreateInfoINTEL::safe_VkQueryPoolPerformanceQueryCreateInfoINTEL(
+    safe_VkQueryPoolPerformanceQueryCreateInfoINTEL&& move_src) noexcept
+    : safe_VkQueryPoolPerformanceQueryCreateInfoINTEL() {
+    *this = std::move(move_src);
+}
+
+safe_VkQueryPoolPerformanceQueryCreateInfoINTEL& safe_VkQueryPoolPerformanceQueryCreateInfoINTEL::operator=(
+    safe_VkQueryPoolPerformanceQueryCreateInfoINTEL&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(performanceCountersSampling, move_src.performanceCountersSampling);
+
+    return *this;
+}
+
 safe_VkQueryPoolPerformanceQueryCreateInfoINTEL::~safe_VkQueryPoolPerformanceQueryCreateInfoINTEL() { FreePnextChain(pNext); }
 
 void safe_VkQueryPoolPerformanceQueryCreateInfoINTEL::initialize(const VkQueryPoolPerformanceQueryCreateInfoINTEL* in_struct,
@@ -5586,6 +7006,22 @@ safe_VkPerformanceMarkerInfoINTEL& safe_VkPerformanceMarkerInfoINTEL::operator=(
     return *this;
 }
 
+safe_VkPerformanceMarkerInfoINTEL::safe_VkPerformanceMarkerInfoINTEL(safe_VkPerformanceMarkerInfoINTEL&& move_src) noexcept
+    : safe_VkPerformanceMarkerInfoINTEL() {
+    *this = std::move(move_src);
+}
+
+safe_VkPerformanceMarkerInfoINTEL& safe_VkPerformanceMarkerInfoINTEL::operator=(
+    safe_VkPerformanceMarkerInfoINTEL&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(marker, move_src.marker);
+
+    return *this;
+}
+
 safe_VkPerformanceMarkerInfoINTEL::~safe_VkPerformanceMarkerInfoINTEL() { FreePnextChain(pNext); }
 
 void safe_VkPerformanceMarkerInfoINTEL::initialize(const VkPerformanceMarkerInfoINTEL* in_struct,
@@ -5634,6 +7070,23 @@ safe_VkPerformanceStreamMarkerInfoINTEL& safe_VkPerformanceStreamMarkerInfoINTEL
     return *this;
 }
 
+safe_VkPerformanceStreamMarkerInfoINTEL::safe_VkPerformanceStreamMarkerInfoINTEL(
+    safe_VkPerformanceStreamMarkerInfoINTEL&& move_src) noexcept
+    : safe_VkPerformanceStreamMarkerInfoINTEL() {
+    *this = std::move(move_src);
+}
+
+safe_VkPerformanceStreamMarkerInfoINTEL& safe_VkPerformanceStreamMarkerInfoINTEL::operator=(
+    safe_VkPerformanceStreamMarkerInfoINTEL&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(marker, move_src.marker);
+
+    return *this;
+}
+
 safe_VkPerformanceStreamMarkerInfoINTEL::~safe_VkPerformanceStreamMarkerInfoINTEL() { FreePnextChain(pNext); }
 
 void safe_VkPerformanceStreamMarkerInfoINTEL::initialize(const VkPerformanceStreamMarkerInfoINTEL* in_struct,
@@ -5686,6 +7139,24 @@ safe_VkPerformanceOverrideInfoINTEL& safe_VkPerformanceOverrideInfoINTEL::operat
     return *this;
 }
 
+safe_VkPerformanceOverrideInfoINTEL::safe_VkPerformanceOverrideInfoINTEL(safe_VkPerformanceOverrideInfoINTEL&& move_src) noexcept
+    : safe_VkPerformanceOverrideInfoINTEL() {
+    *this = std::move(move_src);
+}
+
+safe_VkPerformanceOverrideInfoINTEL& safe_VkPerformanceOverrideInfoINTEL::operator=(
+    safe_VkPerformanceOverrideInfoINTEL&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(type, move_src.type);
+    std::swap(enable, move_src.enable);
+    std::swap(parameter, move_src.parameter);
+
+    return *this;
+}
+
 safe_VkPerformanceOverrideInfoINTEL::~safe_VkPerformanceOverrideInfoINTEL() { FreePnextChain(pNext); }
 
 void safe_VkPerformanceOverrideInfoINTEL::initialize(const VkPerformanceOverrideInfoINTEL* in_struct,
@@ -5738,6 +7209,23 @@ safe_VkPerformanceConfigurationAcquireInfoINTEL& safe_VkPerformanceConfiguration
     return *this;
 }
 
+safe_VkPerformanceConfigurationAcquireInfoINTEL::safe_VkPerformanceConfigurationAcquireInfoINTEL(
+    safe_VkPerformanceConfigurationAcquireInfoINTEL&& move_src) noexcept
+    : safe_VkPerformanceConfigurationAcquireInfoINTEL() {
+    *this = std::move(move_src);
+}
+
+safe_VkPerformanceConfigurationAcquireInfoINTEL& safe_VkPerformanceConfigurationAcquireInfoINTEL::operator=(
+    safe_VkPerformanceConfigurationAcquireInfoINTEL&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(type, move_src.type);
+
+    return *this;
+}
+
 safe_VkPerformanceConfigurationAcquireInfoINTEL::~safe_VkPerformanceConfigurationAcquireInfoINTEL() { FreePnextChain(pNext); }
 
 void safe_VkPerformanceConfigurationAcquireInfoINTEL::initialize(const VkPerformanceConfigurationAcquireInfoINTEL* in_struct,
@@ -5786,6 +7274,23 @@ safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& safe_VkDisplayNativeHdrSurfaceCap
     return *this;
 }
 
+safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD::safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD(
+    safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD&& move_src) noexcept
+    : safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD() {
+    *this = std::move(move_src);
+}
+
+safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD::operator=(
+    safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(localDimmingSupport, move_src.localDimmingSupport);
+
+    return *this;
+}
+
 safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD::~safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD() { FreePnextChain(pNext); }
 
 void safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD::initialize(const VkDisplayNativeHdrSurfaceCapabilitiesAMD* in_struct,
@@ -5834,6 +7339,23 @@ safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& safe_VkSwapchainDisplayNativeHdrC
     return *this;
 }
 
+safe_VkSwapchainDisplayNativeHdrCreateInfoAMD::safe_VkSwapchainDisplayNativeHdrCreateInfoAMD(
+    safe_VkSwapchainDisplayNativeHdrCreateInfoAMD&& move_src) noexcept
+    : safe_VkSwapchainDisplayNativeHdrCreateInfoAMD() {
+    *this = std::move(move_src);
+}
+
+safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& safe_VkSwapchainDisplayNativeHdrCreateInfoAMD::operator=(
+    safe_VkSwapchainDisplayNativeHdrCreateInfoAMD&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(localDimmingEnable, move_src.localDimmingEnable);
+
+    return *this;
+}
+
 safe_VkSwapchainDisplayNativeHdrCreateInfoAMD::~safe_VkSwapchainDisplayNativeHdrCreateInfoAMD() { FreePnextChain(pNext); }
 
 void safe_VkSwapchainDisplayNativeHdrCreateInfoAMD::initialize(const VkSwapchainDisplayNativeHdrCreateInfoAMD* in_struct,
@@ -5885,6 +7407,24 @@ safe_VkImagePipeSurfaceCreateInfoFUCHSIA& safe_VkImagePipeSurfaceCreateInfoFUCHS
     return *this;
 }
 
+safe_VkImagePipeSurfaceCreateInfoFUCHSIA::safe_VkImagePipeSurfaceCreateInfoFUCHSIA(
+    safe_VkImagePipeSurfaceCreateInfoFUCHSIA&& move_src) noexcept
+    : safe_VkImagePipeSurfaceCreateInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkImagePipeSurfaceCreateInfoFUCHSIA& safe_VkImagePipeSurfaceCreateInfoFUCHSIA::operator=(
+    safe_VkImagePipeSurfaceCreateInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(imagePipeHandle, move_src.imagePipeHandle);
+
+    return *this;
+}
+
 safe_VkImagePipeSurfaceCreateInfoFUCHSIA::~safe_VkImagePipeSurfaceCreateInfoFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkImagePipeSurfaceCreateInfoFUCHSIA::initialize(const VkImagePipeSurfaceCreateInfoFUCHSIA* in_struct,
@@ -5943,6 +7483,24 @@ safe_VkPhysicalDeviceShaderCoreProperties2AMD& safe_VkPhysicalDeviceShaderCorePr
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderCoreProperties2AMD::safe_VkPhysicalDeviceShaderCoreProperties2AMD(
+    safe_VkPhysicalDeviceShaderCoreProperties2AMD&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderCoreProperties2AMD() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderCoreProperties2AMD& safe_VkPhysicalDeviceShaderCoreProperties2AMD::operator=(
+    safe_VkPhysicalDeviceShaderCoreProperties2AMD&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderCoreFeatures, move_src.shaderCoreFeatures);
+    std::swap(activeComputeUnitCount, move_src.activeComputeUnitCount);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderCoreProperties2AMD::~safe_VkPhysicalDeviceShaderCoreProperties2AMD() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderCoreProperties2AMD::initialize(const VkPhysicalDeviceShaderCoreProperties2AMD* in_struct,
@@ -5993,6 +7551,23 @@ safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD& safe_VkPhysicalDeviceCoherentMem
     return *this;
 }
 
+safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD::safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD(
+    safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD&& move_src) noexcept
+    : safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD& safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD::operator=(
+    safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceCoherentMemory, move_src.deviceCoherentMemory);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD::~safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD::initialize(const VkPhysicalDeviceCoherentMemoryFeaturesAMD* in_struct,
@@ -6045,6 +7620,24 @@ safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV::safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV(
+    safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV&
+safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV::operator=(
+    safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(dedicatedAllocationImageAliasing, move_src.dedicatedAllocationImageAliasing);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV::
     ~safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV() {
     FreePnextChain(pNext);
@@ -6127,6 +7720,29 @@ safe_VkCooperativeMatrixPropertiesNV& safe_VkCooperativeMatrixPropertiesNV::oper
     return *this;
 }
 
+safe_VkCooperativeMatrixPropertiesNV::safe_VkCooperativeMatrixPropertiesNV(safe_VkCooperativeMatrixPropertiesNV&& move_src) noexcept
+    : safe_VkCooperativeMatrixPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkCooperativeMatrixPropertiesNV& safe_VkCooperativeMatrixPropertiesNV::operator=(
+    safe_VkCooperativeMatrixPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(MSize, move_src.MSize);
+    std::swap(NSize, move_src.NSize);
+    std::swap(KSize, move_src.KSize);
+    std::swap(AType, move_src.AType);
+    std::swap(BType, move_src.BType);
+    std::swap(CType, move_src.CType);
+    std::swap(DType, move_src.DType);
+    std::swap(scope, move_src.scope);
+
+    return *this;
+}
+
 safe_VkCooperativeMatrixPropertiesNV::~safe_VkCooperativeMatrixPropertiesNV() { FreePnextChain(pNext); }
 
 void safe_VkCooperativeMatrixPropertiesNV::initialize(const VkCooperativeMatrixPropertiesNV* in_struct,
@@ -6196,6 +7812,24 @@ safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& safe_VkPhysicalDeviceCooperati
     return *this;
 }
 
+safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV::safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV(
+    safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV::operator=(
+    safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(cooperativeMatrix, move_src.cooperativeMatrix);
+    std::swap(cooperativeMatrixRobustBufferAccess, move_src.cooperativeMatrixRobustBufferAccess);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV::~safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV::initialize(const VkPhysicalDeviceCooperativeMatrixFeaturesNV* in_struct,
@@ -6248,10 +7882,27 @@ safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& safe_VkPhysicalDeviceCoopera
     return *this;
 }
 
-safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV::~safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV() { FreePnextChain(pNext); }
+safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV::safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV(
+    safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV() {
+    *this = std::move(move_src);
+}
 
-void safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV::initialize(const VkPhysicalDeviceCooperativeMatrixPropertiesNV* in_struct,
-                                                                    [[maybe_unused]] PNextCopyState* copy_state) {
+safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV::operator=(
+    safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(cooperativeMatrixSupportedStages, move_src.cooperativeMatrixSupportedStages);
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV::~safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV() { FreePnextChain(pNext); }
+
+void safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV::initialize(const VkPhysicalDeviceCooperativeMatrixPropertiesNV* in_struct,
+                                                                    [[maybe_unused]] PNextCopyState* copy_state) {
     FreePnextChain(pNext);
     sType = in_struct->sType;
     cooperativeMatrixSupportedStages = in_struct->cooperativeMatrixSupportedStages;
@@ -6296,6 +7947,23 @@ safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& safe_VkPhysicalDeviceCover
     return *this;
 }
 
+safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV::safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV(
+    safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV::operator=(
+    safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(coverageReductionMode, move_src.coverageReductionMode);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV::~safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -6348,6 +8016,24 @@ safe_VkPipelineCoverageReductionStateCreateInfoNV& safe_VkPipelineCoverageReduct
     return *this;
 }
 
+safe_VkPipelineCoverageReductionStateCreateInfoNV::safe_VkPipelineCoverageReductionStateCreateInfoNV(
+    safe_VkPipelineCoverageReductionStateCreateInfoNV&& move_src) noexcept
+    : safe_VkPipelineCoverageReductionStateCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineCoverageReductionStateCreateInfoNV& safe_VkPipelineCoverageReductionStateCreateInfoNV::operator=(
+    safe_VkPipelineCoverageReductionStateCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(coverageReductionMode, move_src.coverageReductionMode);
+
+    return *this;
+}
+
 safe_VkPipelineCoverageReductionStateCreateInfoNV::~safe_VkPipelineCoverageReductionStateCreateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkPipelineCoverageReductionStateCreateInfoNV::initialize(const VkPipelineCoverageReductionStateCreateInfoNV* in_struct,
@@ -6413,6 +8099,26 @@ safe_VkFramebufferMixedSamplesCombinationNV& safe_VkFramebufferMixedSamplesCombi
     return *this;
 }
 
+safe_VkFramebufferMixedSamplesCombinationNV::safe_VkFramebufferMixedSamplesCombinationNV(
+    safe_VkFramebufferMixedSamplesCombinationNV&& move_src) noexcept
+    : safe_VkFramebufferMixedSamplesCombinationNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkFramebufferMixedSamplesCombinationNV& safe_VkFramebufferMixedSamplesCombinationNV::operator=(
+    safe_VkFramebufferMixedSamplesCombinationNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(coverageReductionMode, move_src.coverageReductionMode);
+    std::swap(rasterizationSamples, move_src.rasterizationSamples);
+    std::swap(depthStencilSamples, move_src.depthStencilSamples);
+    std::swap(colorSamples, move_src.colorSamples);
+
+    return *this;
+}
+
 safe_VkFramebufferMixedSamplesCombinationNV::~safe_VkFramebufferMixedSamplesCombinationNV() { FreePnextChain(pNext); }
 
 void safe_VkFramebufferMixedSamplesCombinationNV::initialize(const VkFramebufferMixedSamplesCombinationNV* in_struct,
@@ -6503,6 +8209,31 @@ safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& safe_VkPhysicalDeviceD
     return *this;
 }
 
+safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV::safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV(
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV::operator=(
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxGraphicsShaderGroupCount, move_src.maxGraphicsShaderGroupCount);
+    std::swap(maxIndirectSequenceCount, move_src.maxIndirectSequenceCount);
+    std::swap(maxIndirectCommandsTokenCount, move_src.maxIndirectCommandsTokenCount);
+    std::swap(maxIndirectCommandsStreamCount, move_src.maxIndirectCommandsStreamCount);
+    std::swap(maxIndirectCommandsTokenOffset, move_src.maxIndirectCommandsTokenOffset);
+    std::swap(maxIndirectCommandsStreamStride, move_src.maxIndirectCommandsStreamStride);
+    std::swap(minSequencesCountBufferOffsetAlignment, move_src.minSequencesCountBufferOffsetAlignment);
+    std::swap(minSequencesIndexBufferOffsetAlignment, move_src.minSequencesIndexBufferOffsetAlignment);
+    std::swap(minIndirectCommandsBufferOffsetAlignment, move_src.minIndirectCommandsBufferOffsetAlignment);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV::~safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV() {
     FreePnextChain(pNext);
 }
@@ -6570,6 +8301,23 @@ safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& safe_VkPhysicalDeviceDev
     return *this;
 }
 
+safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV::safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV(
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV::operator=(
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceGeneratedCommands, move_src.deviceGeneratedCommands);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV::~safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -6667,6 +8415,26 @@ safe_VkGraphicsShaderGroupCreateInfoNV& safe_VkGraphicsShaderGroupCreateInfoNV::
     return *this;
 }
 
+safe_VkGraphicsShaderGroupCreateInfoNV::safe_VkGraphicsShaderGroupCreateInfoNV(
+    safe_VkGraphicsShaderGroupCreateInfoNV&& move_src) noexcept
+    : safe_VkGraphicsShaderGroupCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkGraphicsShaderGroupCreateInfoNV& safe_VkGraphicsShaderGroupCreateInfoNV::operator=(
+    safe_VkGraphicsShaderGroupCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stageCount, move_src.stageCount);
+    std::swap(pStages, move_src.pStages);
+    std::swap(pVertexInputState, move_src.pVertexInputState);
+    std::swap(pTessellationState, move_src.pTessellationState);
+
+    return *this;
+}
+
 safe_VkGraphicsShaderGroupCreateInfoNV::~safe_VkGraphicsShaderGroupCreateInfoNV() {
     if (pStages) delete[] pStages;
     if (pVertexInputState) delete pVertexInputState;
@@ -6802,6 +8570,26 @@ safe_VkGraphicsPipelineShaderGroupsCreateInfoNV& safe_VkGraphicsPipelineShaderGr
     return *this;
 }
 
+safe_VkGraphicsPipelineShaderGroupsCreateInfoNV::safe_VkGraphicsPipelineShaderGroupsCreateInfoNV(
+    safe_VkGraphicsPipelineShaderGroupsCreateInfoNV&& move_src) noexcept
+    : safe_VkGraphicsPipelineShaderGroupsCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkGraphicsPipelineShaderGroupsCreateInfoNV& safe_VkGraphicsPipelineShaderGroupsCreateInfoNV::operator=(
+    safe_VkGraphicsPipelineShaderGroupsCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(groupCount, move_src.groupCount);
+    std::swap(pGroups, move_src.pGroups);
+    std::swap(pipelineCount, move_src.pipelineCount);
+    std::swap(pPipelines, move_src.pPipelines);
+
+    return *this;
+}
+
 safe_VkGraphicsPipelineShaderGroupsCreateInfoNV::~safe_VkGraphicsPipelineShaderGroupsCreateInfoNV() {
     if (pGroups) delete[] pGroups;
     if (pPipelines) delete[] pPipelines;
@@ -6968,6 +8756,34 @@ safe_VkIndirectCommandsLayoutTokenNV& safe_VkIndirectCommandsLayoutTokenNV::oper
     return *this;
 }
 
+safe_VkIndirectCommandsLayoutTokenNV::safe_VkIndirectCommandsLayoutTokenNV(safe_VkIndirectCommandsLayoutTokenNV&& move_src) noexcept
+    : safe_VkIndirectCommandsLayoutTokenNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkIndirectCommandsLayoutTokenNV& safe_VkIndirectCommandsLayoutTokenNV::operator=(
+    safe_VkIndirectCommandsLayoutTokenNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(tokenType, move_src.tokenType);
+    std::swap(stream, move_src.stream);
+    std::swap(offset, move_src.offset);
+    std::swap(vertexBindingUnit, move_src.vertexBindingUnit);
+    std::swap(vertexDynamicStride, move_src.vertexDynamicStride);
+    std::swap(pushconstantPipelineLayout, move_src.pushconstantPipelineLayout);
+    std::swap(pushconstantShaderStageFlags, move_src.pushconstantShaderStageFlags);
+    std::swap(pushconstantOffset, move_src.pushconstantOffset);
+    std::swap(pushconstantSize, move_src.pushconstantSize);
+    std::swap(indirectStateFlags, move_src.indirectStateFlags);
+    std::swap(indexTypeCount, move_src.indexTypeCount);
+    std::swap(pIndexTypes, move_src.pIndexTypes);
+    std::swap(pIndexTypeValues, move_src.pIndexTypeValues);
+
+    return *this;
+}
+
 safe_VkIndirectCommandsLayoutTokenNV::~safe_VkIndirectCommandsLayoutTokenNV() {
     if (pIndexTypes) delete[] pIndexTypes;
     if (pIndexTypeValues) delete[] pIndexTypeValues;
@@ -7124,6 +8940,28 @@ safe_VkIndirectCommandsLayoutCreateInfoNV& safe_VkIndirectCommandsLayoutCreateIn
     return *this;
 }
 
+safe_VkIndirectCommandsLayoutCreateInfoNV::safe_VkIndirectCommandsLayoutCreateInfoNV(
+    safe_VkIndirectCommandsLayoutCreateInfoNV&& move_src) noexcept
+    : safe_VkIndirectCommandsLayoutCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkIndirectCommandsLayoutCreateInfoNV& safe_VkIndirectCommandsLayoutCreateInfoNV::operator=(
+    safe_VkIndirectCommandsLayoutCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(pipelineBindPoint, move_src.pipelineBindPoint);
+    std::swap(tokenCount, move_src.tokenCount);
+    std::swap(pTokens, move_src.pTokens);
+    std::swap(streamCount, move_src.streamCount);
+    std::swap(pStreamStrides, move_src.pStreamStrides);
+
+    return *this;
+}
+
 safe_VkIndirectCommandsLayoutCreateInfoNV::~safe_VkIndirectCommandsLayoutCreateInfoNV() {
     if (pTokens) delete[] pTokens;
     if (pStreamStrides) delete[] pStreamStrides;
@@ -7278,6 +9116,33 @@ safe_VkGeneratedCommandsInfoNV& safe_VkGeneratedCommandsInfoNV::operator=(const
     return *this;
 }
 
+safe_VkGeneratedCommandsInfoNV::safe_VkGeneratedCommandsInfoNV(safe_VkGeneratedCommandsInfoNV&& move_src) noexcept
+    : safe_VkGeneratedCommandsInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkGeneratedCommandsInfoNV& safe_VkGeneratedCommandsInfoNV::operator=(safe_VkGeneratedCommandsInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipelineBindPoint, move_src.pipelineBindPoint);
+    std::swap(pipeline, move_src.pipeline);
+    std::swap(indirectCommandsLayout, move_src.indirectCommandsLayout);
+    std::swap(streamCount, move_src.streamCount);
+    std::swap(pStreams, move_src.pStreams);
+    std::swap(sequencesCount, move_src.sequencesCount);
+    std::swap(preprocessBuffer, move_src.preprocessBuffer);
+    std::swap(preprocessOffset, move_src.preprocessOffset);
+    std::swap(preprocessSize, move_src.preprocessSize);
+    std::swap(sequencesCountBuffer, move_src.sequencesCountBuffer);
+    std::swap(sequencesCountOffset, move_src.sequencesCountOffset);
+    std::swap(sequencesIndexBuffer, move_src.sequencesIndexBuffer);
+    std::swap(sequencesIndexOffset, move_src.sequencesIndexOffset);
+
+    return *this;
+}
+
 safe_VkGeneratedCommandsInfoNV::~safe_VkGeneratedCommandsInfoNV() {
     if (pStreams) delete[] pStreams;
     FreePnextChain(pNext);
@@ -7381,6 +9246,26 @@ safe_VkGeneratedCommandsMemoryRequirementsInfoNV& safe_VkGeneratedCommandsMemory
     return *this;
 }
 
+safe_VkGeneratedCommandsMemoryRequirementsInfoNV::safe_VkGeneratedCommandsMemoryRequirementsInfoNV(
+    safe_VkGeneratedCommandsMemoryRequirementsInfoNV&& move_src) noexcept
+    : safe_VkGeneratedCommandsMemoryRequirementsInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkGeneratedCommandsMemoryRequirementsInfoNV& safe_VkGeneratedCommandsMemoryRequirementsInfoNV::operator=(
+    safe_VkGeneratedCommandsMemoryRequirementsInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipelineBindPoint, move_src.pipelineBindPoint);
+    std::swap(pipeline, move_src.pipeline);
+    std::swap(indirectCommandsLayout, move_src.indirectCommandsLayout);
+    std::swap(maxSequencesCount, move_src.maxSequencesCount);
+
+    return *this;
+}
+
 safe_VkGeneratedCommandsMemoryRequirementsInfoNV::~safe_VkGeneratedCommandsMemoryRequirementsInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkGeneratedCommandsMemoryRequirementsInfoNV::initialize(const VkGeneratedCommandsMemoryRequirementsInfoNV* in_struct,
@@ -7438,6 +9323,23 @@ safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV& safe_VkPhysicalDeviceIn
     return *this;
 }
 
+safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV::safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV(
+    safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV& safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV::operator=(
+    safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(inheritedViewportScissor2D, move_src.inheritedViewportScissor2D);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV::~safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -7511,6 +9413,25 @@ safe_VkCommandBufferInheritanceViewportScissorInfoNV& safe_VkCommandBufferInheri
     return *this;
 }
 
+safe_VkCommandBufferInheritanceViewportScissorInfoNV::safe_VkCommandBufferInheritanceViewportScissorInfoNV(
+    safe_VkCommandBufferInheritanceViewportScissorInfoNV&& move_src) noexcept
+    : safe_VkCommandBufferInheritanceViewportScissorInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkCommandBufferInheritanceViewportScissorInfoNV& safe_VkCommandBufferInheritanceViewportScissorInfoNV::operator=(
+    safe_VkCommandBufferInheritanceViewportScissorInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(viewportScissor2D, move_src.viewportScissor2D);
+    std::swap(viewportDepthCount, move_src.viewportDepthCount);
+    std::swap(pViewportDepths, move_src.pViewportDepths);
+
+    return *this;
+}
+
 safe_VkCommandBufferInheritanceViewportScissorInfoNV::~safe_VkCommandBufferInheritanceViewportScissorInfoNV() {
     if (pViewportDepths) delete pViewportDepths;
     FreePnextChain(pNext);
@@ -7575,6 +9496,23 @@ safe_VkRenderPassTransformBeginInfoQCOM& safe_VkRenderPassTransformBeginInfoQCOM
     return *this;
 }
 
+safe_VkRenderPassTransformBeginInfoQCOM::safe_VkRenderPassTransformBeginInfoQCOM(
+    safe_VkRenderPassTransformBeginInfoQCOM&& move_src) noexcept
+    : safe_VkRenderPassTransformBeginInfoQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassTransformBeginInfoQCOM& safe_VkRenderPassTransformBeginInfoQCOM::operator=(
+    safe_VkRenderPassTransformBeginInfoQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(transform, move_src.transform);
+
+    return *this;
+}
+
 safe_VkRenderPassTransformBeginInfoQCOM::~safe_VkRenderPassTransformBeginInfoQCOM() { FreePnextChain(pNext); }
 
 void safe_VkRenderPassTransformBeginInfoQCOM::initialize(const VkRenderPassTransformBeginInfoQCOM* in_struct,
@@ -7629,6 +9567,24 @@ safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM& safe_VkCommandBuffer
     return *this;
 }
 
+safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM::safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM(
+    safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM&& move_src) noexcept
+    : safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM& safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM::operator=(
+    safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(transform, move_src.transform);
+    std::swap(renderArea, move_src.renderArea);
+
+    return *this;
+}
+
 safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM::~safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM() {
     FreePnextChain(pNext);
 }
@@ -7681,6 +9637,23 @@ safe_VkPhysicalDevicePresentBarrierFeaturesNV& safe_VkPhysicalDevicePresentBarri
     return *this;
 }
 
+safe_VkPhysicalDevicePresentBarrierFeaturesNV::safe_VkPhysicalDevicePresentBarrierFeaturesNV(
+    safe_VkPhysicalDevicePresentBarrierFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDevicePresentBarrierFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePresentBarrierFeaturesNV& safe_VkPhysicalDevicePresentBarrierFeaturesNV::operator=(
+    safe_VkPhysicalDevicePresentBarrierFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentBarrier, move_src.presentBarrier);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePresentBarrierFeaturesNV::~safe_VkPhysicalDevicePresentBarrierFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDevicePresentBarrierFeaturesNV::initialize(const VkPhysicalDevicePresentBarrierFeaturesNV* in_struct,
@@ -7729,6 +9702,23 @@ safe_VkSurfaceCapabilitiesPresentBarrierNV& safe_VkSurfaceCapabilitiesPresentBar
     return *this;
 }
 
+safe_VkSurfaceCapabilitiesPresentBarrierNV::safe_VkSurfaceCapabilitiesPresentBarrierNV(
+    safe_VkSurfaceCapabilitiesPresentBarrierNV&& move_src) noexcept
+    : safe_VkSurfaceCapabilitiesPresentBarrierNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkSurfaceCapabilitiesPresentBarrierNV& safe_VkSurfaceCapabilitiesPresentBarrierNV::operator=(
+    safe_VkSurfaceCapabilitiesPresentBarrierNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentBarrierSupported, move_src.presentBarrierSupported);
+
+    return *this;
+}
+
 safe_VkSurfaceCapabilitiesPresentBarrierNV::~safe_VkSurfaceCapabilitiesPresentBarrierNV() { FreePnextChain(pNext); }
 
 void safe_VkSurfaceCapabilitiesPresentBarrierNV::initialize(const VkSurfaceCapabilitiesPresentBarrierNV* in_struct,
@@ -7777,6 +9767,23 @@ safe_VkSwapchainPresentBarrierCreateInfoNV& safe_VkSwapchainPresentBarrierCreate
     return *this;
 }
 
+safe_VkSwapchainPresentBarrierCreateInfoNV::safe_VkSwapchainPresentBarrierCreateInfoNV(
+    safe_VkSwapchainPresentBarrierCreateInfoNV&& move_src) noexcept
+    : safe_VkSwapchainPresentBarrierCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkSwapchainPresentBarrierCreateInfoNV& safe_VkSwapchainPresentBarrierCreateInfoNV::operator=(
+    safe_VkSwapchainPresentBarrierCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentBarrierEnable, move_src.presentBarrierEnable);
+
+    return *this;
+}
+
 safe_VkSwapchainPresentBarrierCreateInfoNV::~safe_VkSwapchainPresentBarrierCreateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkSwapchainPresentBarrierCreateInfoNV::initialize(const VkSwapchainPresentBarrierCreateInfoNV* in_struct,
@@ -7825,6 +9832,23 @@ safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV& safe_VkPhysicalDeviceDiagnosti
     return *this;
 }
 
+safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV::safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV(
+    safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV& safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV::operator=(
+    safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(diagnosticsConfig, move_src.diagnosticsConfig);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV::~safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV::initialize(const VkPhysicalDeviceDiagnosticsConfigFeaturesNV* in_struct,
@@ -7873,6 +9897,23 @@ safe_VkDeviceDiagnosticsConfigCreateInfoNV& safe_VkDeviceDiagnosticsConfigCreate
     return *this;
 }
 
+safe_VkDeviceDiagnosticsConfigCreateInfoNV::safe_VkDeviceDiagnosticsConfigCreateInfoNV(
+    safe_VkDeviceDiagnosticsConfigCreateInfoNV&& move_src) noexcept
+    : safe_VkDeviceDiagnosticsConfigCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceDiagnosticsConfigCreateInfoNV& safe_VkDeviceDiagnosticsConfigCreateInfoNV::operator=(
+    safe_VkDeviceDiagnosticsConfigCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkDeviceDiagnosticsConfigCreateInfoNV::~safe_VkDeviceDiagnosticsConfigCreateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkDeviceDiagnosticsConfigCreateInfoNV::initialize(const VkDeviceDiagnosticsConfigCreateInfoNV* in_struct,
@@ -7940,6 +9981,22 @@ safe_VkCudaModuleCreateInfoNV& safe_VkCudaModuleCreateInfoNV::operator=(const sa
     return *this;
 }
 
+safe_VkCudaModuleCreateInfoNV::safe_VkCudaModuleCreateInfoNV(safe_VkCudaModuleCreateInfoNV&& move_src) noexcept
+    : safe_VkCudaModuleCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkCudaModuleCreateInfoNV& safe_VkCudaModuleCreateInfoNV::operator=(safe_VkCudaModuleCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(dataSize, move_src.dataSize);
+    std::swap(pData, move_src.pData);
+
+    return *this;
+}
+
 safe_VkCudaModuleCreateInfoNV::~safe_VkCudaModuleCreateInfoNV() {
     if (pData != nullptr) {
         auto temp = reinterpret_cast<const std::byte*>(pData);
@@ -8012,6 +10069,22 @@ safe_VkCudaFunctionCreateInfoNV& safe_VkCudaFunctionCreateInfoNV::operator=(cons
     return *this;
 }
 
+safe_VkCudaFunctionCreateInfoNV::safe_VkCudaFunctionCreateInfoNV(safe_VkCudaFunctionCreateInfoNV&& move_src) noexcept
+    : safe_VkCudaFunctionCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkCudaFunctionCreateInfoNV& safe_VkCudaFunctionCreateInfoNV::operator=(safe_VkCudaFunctionCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(module, move_src.module);
+    std::swap(pName, move_src.pName);
+
+    return *this;
+}
+
 safe_VkCudaFunctionCreateInfoNV::~safe_VkCudaFunctionCreateInfoNV() {
     if (pName) delete[] pName;
     FreePnextChain(pNext);
@@ -8111,6 +10184,31 @@ safe_VkCudaLaunchInfoNV& safe_VkCudaLaunchInfoNV::operator=(const safe_VkCudaLau
     return *this;
 }
 
+safe_VkCudaLaunchInfoNV::safe_VkCudaLaunchInfoNV(safe_VkCudaLaunchInfoNV&& move_src) noexcept : safe_VkCudaLaunchInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkCudaLaunchInfoNV& safe_VkCudaLaunchInfoNV::operator=(safe_VkCudaLaunchInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(function, move_src.function);
+    std::swap(gridDimX, move_src.gridDimX);
+    std::swap(gridDimY, move_src.gridDimY);
+    std::swap(gridDimZ, move_src.gridDimZ);
+    std::swap(blockDimX, move_src.blockDimX);
+    std::swap(blockDimY, move_src.blockDimY);
+    std::swap(blockDimZ, move_src.blockDimZ);
+    std::swap(sharedMemBytes, move_src.sharedMemBytes);
+    std::swap(paramCount, move_src.paramCount);
+    std::swap(pParams, move_src.pParams);
+    std::swap(extraCount, move_src.extraCount);
+    std::swap(pExtras, move_src.pExtras);
+
+    return *this;
+}
+
 safe_VkCudaLaunchInfoNV::~safe_VkCudaLaunchInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkCudaLaunchInfoNV::initialize(const VkCudaLaunchInfoNV* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -8179,6 +10277,23 @@ safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV& safe_VkPhysicalDeviceCudaKernel
     return *this;
 }
 
+safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV::safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV(
+    safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV& safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV::operator=(
+    safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(cudaKernelLaunchFeatures, move_src.cudaKernelLaunchFeatures);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV::~safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceCudaKernelLaunchFeaturesNV::initialize(const VkPhysicalDeviceCudaKernelLaunchFeaturesNV* in_struct,
@@ -8234,6 +10349,24 @@ safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV& safe_VkPhysicalDeviceCudaKern
     return *this;
 }
 
+safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV::safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV(
+    safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV& safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV::operator=(
+    safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(computeCapabilityMinor, move_src.computeCapabilityMinor);
+    std::swap(computeCapabilityMajor, move_src.computeCapabilityMajor);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV::~safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceCudaKernelLaunchPropertiesNV::initialize(const VkPhysicalDeviceCudaKernelLaunchPropertiesNV* in_struct,
@@ -8282,6 +10415,21 @@ safe_VkQueryLowLatencySupportNV& safe_VkQueryLowLatencySupportNV::operator=(cons
     return *this;
 }
 
+safe_VkQueryLowLatencySupportNV::safe_VkQueryLowLatencySupportNV(safe_VkQueryLowLatencySupportNV&& move_src) noexcept
+    : safe_VkQueryLowLatencySupportNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkQueryLowLatencySupportNV& safe_VkQueryLowLatencySupportNV::operator=(safe_VkQueryLowLatencySupportNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pQueriedLowLatencyData, move_src.pQueriedLowLatencyData);
+
+    return *this;
+}
+
 safe_VkQueryLowLatencySupportNV::~safe_VkQueryLowLatencySupportNV() { FreePnextChain(pNext); }
 
 void safe_VkQueryLowLatencySupportNV::initialize(const VkQueryLowLatencySupportNV* in_struct,
@@ -8334,6 +10482,24 @@ safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD::safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD(
+    safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD&
+safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD::operator=(
+    safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderEarlyAndLateFragmentTests, move_src.shaderEarlyAndLateFragmentTests);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD::
     ~safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD() {
     FreePnextChain(pNext);
@@ -8397,6 +10563,25 @@ safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& safe_VkPhysicalDeviceFr
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV::safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV(
+    safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV::operator=(
+    safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fragmentShadingRateEnums, move_src.fragmentShadingRateEnums);
+    std::swap(supersampleFragmentShadingRates, move_src.supersampleFragmentShadingRates);
+    std::swap(noInvocationFragmentShadingRates, move_src.noInvocationFragmentShadingRates);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV::~safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -8454,14 +10639,31 @@ safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& safe_VkPhysicalDevice
     return *this;
 }
 
-safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV::~safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV() {
-    FreePnextChain(pNext);
+safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV::safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV(
+    safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV() {
+    *this = std::move(move_src);
 }
 
-void safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV::initialize(
-    const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
-    FreePnextChain(pNext);
-    sType = in_struct->sType;
+safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV::operator=(
+    safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxFragmentShadingRateInvocationCount, move_src.maxFragmentShadingRateInvocationCount);
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV::~safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV() {
+    FreePnextChain(pNext);
+}
+
+void safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV::initialize(
+    const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
+    FreePnextChain(pNext);
+    sType = in_struct->sType;
     maxFragmentShadingRateInvocationCount = in_struct->maxFragmentShadingRateInvocationCount;
     pNext = SafePnextCopy(in_struct->pNext, copy_state);
 }
@@ -8521,6 +10723,25 @@ safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV& safe_VkPipelineFragment
     return *this;
 }
 
+safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV::safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV(
+    safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV&& move_src) noexcept
+    : safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV& safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV::operator=(
+    safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shadingRateType, move_src.shadingRateType);
+    std::swap(shadingRate, move_src.shadingRate);
+    std::swap(combinerOps, move_src.combinerOps);
+
+    return *this;
+}
+
 safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV::~safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV() {
     FreePnextChain(pNext);
 }
@@ -8582,6 +10803,23 @@ safe_VkAccelerationStructureGeometryMotionTrianglesDataNV& safe_VkAccelerationSt
     return *this;
 }
 
+safe_VkAccelerationStructureGeometryMotionTrianglesDataNV::safe_VkAccelerationStructureGeometryMotionTrianglesDataNV(
+    safe_VkAccelerationStructureGeometryMotionTrianglesDataNV&& move_src) noexcept
+    : safe_VkAccelerationStructureGeometryMotionTrianglesDataNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureGeometryMotionTrianglesDataNV& safe_VkAccelerationStructureGeometryMotionTrianglesDataNV::operator=(
+    safe_VkAccelerationStructureGeometryMotionTrianglesDataNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(vertexData, move_src.vertexData);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureGeometryMotionTrianglesDataNV::~safe_VkAccelerationStructureGeometryMotionTrianglesDataNV() {
     FreePnextChain(pNext);
 }
@@ -8634,6 +10872,24 @@ safe_VkAccelerationStructureMotionInfoNV& safe_VkAccelerationStructureMotionInfo
     return *this;
 }
 
+safe_VkAccelerationStructureMotionInfoNV::safe_VkAccelerationStructureMotionInfoNV(
+    safe_VkAccelerationStructureMotionInfoNV&& move_src) noexcept
+    : safe_VkAccelerationStructureMotionInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureMotionInfoNV& safe_VkAccelerationStructureMotionInfoNV::operator=(
+    safe_VkAccelerationStructureMotionInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxInstances, move_src.maxInstances);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureMotionInfoNV::~safe_VkAccelerationStructureMotionInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkAccelerationStructureMotionInfoNV::initialize(const VkAccelerationStructureMotionInfoNV* in_struct,
@@ -8691,6 +10947,24 @@ safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& safe_VkPhysicalDeviceRayTra
     return *this;
 }
 
+safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV::safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV(
+    safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV::operator=(
+    safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(rayTracingMotionBlur, move_src.rayTracingMotionBlur);
+    std::swap(rayTracingMotionBlurPipelineTraceRaysIndirect, move_src.rayTracingMotionBlurPipelineTraceRaysIndirect);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV::~safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -8743,6 +11017,22 @@ safe_VkCopyCommandTransformInfoQCOM& safe_VkCopyCommandTransformInfoQCOM::operat
     return *this;
 }
 
+safe_VkCopyCommandTransformInfoQCOM::safe_VkCopyCommandTransformInfoQCOM(safe_VkCopyCommandTransformInfoQCOM&& move_src) noexcept
+    : safe_VkCopyCommandTransformInfoQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkCopyCommandTransformInfoQCOM& safe_VkCopyCommandTransformInfoQCOM::operator=(
+    safe_VkCopyCommandTransformInfoQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(transform, move_src.transform);
+
+    return *this;
+}
+
 safe_VkCopyCommandTransformInfoQCOM::~safe_VkCopyCommandTransformInfoQCOM() { FreePnextChain(pNext); }
 
 void safe_VkCopyCommandTransformInfoQCOM::initialize(const VkCopyCommandTransformInfoQCOM* in_struct,
@@ -8794,6 +11084,24 @@ safe_VkImportMemoryZirconHandleInfoFUCHSIA& safe_VkImportMemoryZirconHandleInfoF
     return *this;
 }
 
+safe_VkImportMemoryZirconHandleInfoFUCHSIA::safe_VkImportMemoryZirconHandleInfoFUCHSIA(
+    safe_VkImportMemoryZirconHandleInfoFUCHSIA&& move_src) noexcept
+    : safe_VkImportMemoryZirconHandleInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportMemoryZirconHandleInfoFUCHSIA& safe_VkImportMemoryZirconHandleInfoFUCHSIA::operator=(
+    safe_VkImportMemoryZirconHandleInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(handleType, move_src.handleType);
+    std::swap(handle, move_src.handle);
+
+    return *this;
+}
+
 safe_VkImportMemoryZirconHandleInfoFUCHSIA::~safe_VkImportMemoryZirconHandleInfoFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkImportMemoryZirconHandleInfoFUCHSIA::initialize(const VkImportMemoryZirconHandleInfoFUCHSIA* in_struct,
@@ -8844,6 +11152,23 @@ safe_VkMemoryZirconHandlePropertiesFUCHSIA& safe_VkMemoryZirconHandlePropertiesF
     return *this;
 }
 
+safe_VkMemoryZirconHandlePropertiesFUCHSIA::safe_VkMemoryZirconHandlePropertiesFUCHSIA(
+    safe_VkMemoryZirconHandlePropertiesFUCHSIA&& move_src) noexcept
+    : safe_VkMemoryZirconHandlePropertiesFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryZirconHandlePropertiesFUCHSIA& safe_VkMemoryZirconHandlePropertiesFUCHSIA::operator=(
+    safe_VkMemoryZirconHandlePropertiesFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryTypeBits, move_src.memoryTypeBits);
+
+    return *this;
+}
+
 safe_VkMemoryZirconHandlePropertiesFUCHSIA::~safe_VkMemoryZirconHandlePropertiesFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkMemoryZirconHandlePropertiesFUCHSIA::initialize(const VkMemoryZirconHandlePropertiesFUCHSIA* in_struct,
@@ -8894,6 +11219,24 @@ safe_VkMemoryGetZirconHandleInfoFUCHSIA& safe_VkMemoryGetZirconHandleInfoFUCHSIA
     return *this;
 }
 
+safe_VkMemoryGetZirconHandleInfoFUCHSIA::safe_VkMemoryGetZirconHandleInfoFUCHSIA(
+    safe_VkMemoryGetZirconHandleInfoFUCHSIA&& move_src) noexcept
+    : safe_VkMemoryGetZirconHandleInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryGetZirconHandleInfoFUCHSIA& safe_VkMemoryGetZirconHandleInfoFUCHSIA::operator=(
+    safe_VkMemoryGetZirconHandleInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memory, move_src.memory);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkMemoryGetZirconHandleInfoFUCHSIA::~safe_VkMemoryGetZirconHandleInfoFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkMemoryGetZirconHandleInfoFUCHSIA::initialize(const VkMemoryGetZirconHandleInfoFUCHSIA* in_struct,
@@ -8959,6 +11302,26 @@ safe_VkImportSemaphoreZirconHandleInfoFUCHSIA& safe_VkImportSemaphoreZirconHandl
     return *this;
 }
 
+safe_VkImportSemaphoreZirconHandleInfoFUCHSIA::safe_VkImportSemaphoreZirconHandleInfoFUCHSIA(
+    safe_VkImportSemaphoreZirconHandleInfoFUCHSIA&& move_src) noexcept
+    : safe_VkImportSemaphoreZirconHandleInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportSemaphoreZirconHandleInfoFUCHSIA& safe_VkImportSemaphoreZirconHandleInfoFUCHSIA::operator=(
+    safe_VkImportSemaphoreZirconHandleInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(semaphore, move_src.semaphore);
+    std::swap(flags, move_src.flags);
+    std::swap(handleType, move_src.handleType);
+    std::swap(zirconHandle, move_src.zirconHandle);
+
+    return *this;
+}
+
 safe_VkImportSemaphoreZirconHandleInfoFUCHSIA::~safe_VkImportSemaphoreZirconHandleInfoFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkImportSemaphoreZirconHandleInfoFUCHSIA::initialize(const VkImportSemaphoreZirconHandleInfoFUCHSIA* in_struct,
@@ -9015,6 +11378,24 @@ safe_VkSemaphoreGetZirconHandleInfoFUCHSIA& safe_VkSemaphoreGetZirconHandleInfoF
     return *this;
 }
 
+safe_VkSemaphoreGetZirconHandleInfoFUCHSIA::safe_VkSemaphoreGetZirconHandleInfoFUCHSIA(
+    safe_VkSemaphoreGetZirconHandleInfoFUCHSIA&& move_src) noexcept
+    : safe_VkSemaphoreGetZirconHandleInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkSemaphoreGetZirconHandleInfoFUCHSIA& safe_VkSemaphoreGetZirconHandleInfoFUCHSIA::operator=(
+    safe_VkSemaphoreGetZirconHandleInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(semaphore, move_src.semaphore);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkSemaphoreGetZirconHandleInfoFUCHSIA::~safe_VkSemaphoreGetZirconHandleInfoFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkSemaphoreGetZirconHandleInfoFUCHSIA::initialize(const VkSemaphoreGetZirconHandleInfoFUCHSIA* in_struct,
@@ -9065,6 +11446,23 @@ safe_VkBufferCollectionCreateInfoFUCHSIA& safe_VkBufferCollectionCreateInfoFUCHS
     return *this;
 }
 
+safe_VkBufferCollectionCreateInfoFUCHSIA::safe_VkBufferCollectionCreateInfoFUCHSIA(
+    safe_VkBufferCollectionCreateInfoFUCHSIA&& move_src) noexcept
+    : safe_VkBufferCollectionCreateInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferCollectionCreateInfoFUCHSIA& safe_VkBufferCollectionCreateInfoFUCHSIA::operator=(
+    safe_VkBufferCollectionCreateInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(collectionToken, move_src.collectionToken);
+
+    return *this;
+}
+
 safe_VkBufferCollectionCreateInfoFUCHSIA::~safe_VkBufferCollectionCreateInfoFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkBufferCollectionCreateInfoFUCHSIA::initialize(const VkBufferCollectionCreateInfoFUCHSIA* in_struct,
@@ -9115,6 +11513,24 @@ safe_VkImportMemoryBufferCollectionFUCHSIA& safe_VkImportMemoryBufferCollectionF
     return *this;
 }
 
+safe_VkImportMemoryBufferCollectionFUCHSIA::safe_VkImportMemoryBufferCollectionFUCHSIA(
+    safe_VkImportMemoryBufferCollectionFUCHSIA&& move_src) noexcept
+    : safe_VkImportMemoryBufferCollectionFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportMemoryBufferCollectionFUCHSIA& safe_VkImportMemoryBufferCollectionFUCHSIA::operator=(
+    safe_VkImportMemoryBufferCollectionFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(collection, move_src.collection);
+    std::swap(index, move_src.index);
+
+    return *this;
+}
+
 safe_VkImportMemoryBufferCollectionFUCHSIA::~safe_VkImportMemoryBufferCollectionFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkImportMemoryBufferCollectionFUCHSIA::initialize(const VkImportMemoryBufferCollectionFUCHSIA* in_struct,
@@ -9167,6 +11583,24 @@ safe_VkBufferCollectionImageCreateInfoFUCHSIA& safe_VkBufferCollectionImageCreat
     return *this;
 }
 
+safe_VkBufferCollectionImageCreateInfoFUCHSIA::safe_VkBufferCollectionImageCreateInfoFUCHSIA(
+    safe_VkBufferCollectionImageCreateInfoFUCHSIA&& move_src) noexcept
+    : safe_VkBufferCollectionImageCreateInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferCollectionImageCreateInfoFUCHSIA& safe_VkBufferCollectionImageCreateInfoFUCHSIA::operator=(
+    safe_VkBufferCollectionImageCreateInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(collection, move_src.collection);
+    std::swap(index, move_src.index);
+
+    return *this;
+}
+
 safe_VkBufferCollectionImageCreateInfoFUCHSIA::~safe_VkBufferCollectionImageCreateInfoFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkBufferCollectionImageCreateInfoFUCHSIA::initialize(const VkBufferCollectionImageCreateInfoFUCHSIA* in_struct,
@@ -9236,6 +11670,27 @@ safe_VkBufferCollectionConstraintsInfoFUCHSIA& safe_VkBufferCollectionConstraint
     return *this;
 }
 
+safe_VkBufferCollectionConstraintsInfoFUCHSIA::safe_VkBufferCollectionConstraintsInfoFUCHSIA(
+    safe_VkBufferCollectionConstraintsInfoFUCHSIA&& move_src) noexcept
+    : safe_VkBufferCollectionConstraintsInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferCollectionConstraintsInfoFUCHSIA& safe_VkBufferCollectionConstraintsInfoFUCHSIA::operator=(
+    safe_VkBufferCollectionConstraintsInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(minBufferCount, move_src.minBufferCount);
+    std::swap(maxBufferCount, move_src.maxBufferCount);
+    std::swap(minBufferCountForCamping, move_src.minBufferCountForCamping);
+    std::swap(minBufferCountForDedicatedSlack, move_src.minBufferCountForDedicatedSlack);
+    std::swap(minBufferCountForSharedSlack, move_src.minBufferCountForSharedSlack);
+
+    return *this;
+}
+
 safe_VkBufferCollectionConstraintsInfoFUCHSIA::~safe_VkBufferCollectionConstraintsInfoFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkBufferCollectionConstraintsInfoFUCHSIA::initialize(const VkBufferCollectionConstraintsInfoFUCHSIA* in_struct,
@@ -9299,6 +11754,24 @@ safe_VkBufferConstraintsInfoFUCHSIA& safe_VkBufferConstraintsInfoFUCHSIA::operat
     return *this;
 }
 
+safe_VkBufferConstraintsInfoFUCHSIA::safe_VkBufferConstraintsInfoFUCHSIA(safe_VkBufferConstraintsInfoFUCHSIA&& move_src) noexcept
+    : safe_VkBufferConstraintsInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferConstraintsInfoFUCHSIA& safe_VkBufferConstraintsInfoFUCHSIA::operator=(
+    safe_VkBufferConstraintsInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(createInfo, move_src.createInfo);
+    std::swap(requiredFormatFeatures, move_src.requiredFormatFeatures);
+    std::swap(bufferCollectionConstraints, move_src.bufferCollectionConstraints);
+
+    return *this;
+}
+
 safe_VkBufferConstraintsInfoFUCHSIA::~safe_VkBufferConstraintsInfoFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkBufferConstraintsInfoFUCHSIA::initialize(const VkBufferConstraintsInfoFUCHSIA* in_struct,
@@ -9353,6 +11826,24 @@ safe_VkBufferCollectionBufferCreateInfoFUCHSIA& safe_VkBufferCollectionBufferCre
     return *this;
 }
 
+safe_VkBufferCollectionBufferCreateInfoFUCHSIA::safe_VkBufferCollectionBufferCreateInfoFUCHSIA(
+    safe_VkBufferCollectionBufferCreateInfoFUCHSIA&& move_src) noexcept
+    : safe_VkBufferCollectionBufferCreateInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferCollectionBufferCreateInfoFUCHSIA& safe_VkBufferCollectionBufferCreateInfoFUCHSIA::operator=(
+    safe_VkBufferCollectionBufferCreateInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(collection, move_src.collection);
+    std::swap(index, move_src.index);
+
+    return *this;
+}
+
 safe_VkBufferCollectionBufferCreateInfoFUCHSIA::~safe_VkBufferCollectionBufferCreateInfoFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkBufferCollectionBufferCreateInfoFUCHSIA::initialize(const VkBufferCollectionBufferCreateInfoFUCHSIA* in_struct,
@@ -9401,6 +11892,21 @@ safe_VkSysmemColorSpaceFUCHSIA& safe_VkSysmemColorSpaceFUCHSIA::operator=(const
     return *this;
 }
 
+safe_VkSysmemColorSpaceFUCHSIA::safe_VkSysmemColorSpaceFUCHSIA(safe_VkSysmemColorSpaceFUCHSIA&& move_src) noexcept
+    : safe_VkSysmemColorSpaceFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkSysmemColorSpaceFUCHSIA& safe_VkSysmemColorSpaceFUCHSIA::operator=(safe_VkSysmemColorSpaceFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(colorSpace, move_src.colorSpace);
+
+    return *this;
+}
+
 safe_VkSysmemColorSpaceFUCHSIA::~safe_VkSysmemColorSpaceFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkSysmemColorSpaceFUCHSIA::initialize(const VkSysmemColorSpaceFUCHSIA* in_struct,
@@ -9491,6 +11997,33 @@ safe_VkBufferCollectionPropertiesFUCHSIA& safe_VkBufferCollectionPropertiesFUCHS
     return *this;
 }
 
+safe_VkBufferCollectionPropertiesFUCHSIA::safe_VkBufferCollectionPropertiesFUCHSIA(
+    safe_VkBufferCollectionPropertiesFUCHSIA&& move_src) noexcept
+    : safe_VkBufferCollectionPropertiesFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkBufferCollectionPropertiesFUCHSIA& safe_VkBufferCollectionPropertiesFUCHSIA::operator=(
+    safe_VkBufferCollectionPropertiesFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryTypeBits, move_src.memoryTypeBits);
+    std::swap(bufferCount, move_src.bufferCount);
+    std::swap(createInfoIndex, move_src.createInfoIndex);
+    std::swap(sysmemPixelFormat, move_src.sysmemPixelFormat);
+    std::swap(formatFeatures, move_src.formatFeatures);
+    std::swap(sysmemColorSpaceIndex, move_src.sysmemColorSpaceIndex);
+    std::swap(samplerYcbcrConversionComponents, move_src.samplerYcbcrConversionComponents);
+    std::swap(suggestedYcbcrModel, move_src.suggestedYcbcrModel);
+    std::swap(suggestedYcbcrRange, move_src.suggestedYcbcrRange);
+    std::swap(suggestedXChromaOffset, move_src.suggestedXChromaOffset);
+    std::swap(suggestedYChromaOffset, move_src.suggestedYChromaOffset);
+
+    return *this;
+}
+
 safe_VkBufferCollectionPropertiesFUCHSIA::~safe_VkBufferCollectionPropertiesFUCHSIA() { FreePnextChain(pNext); }
 
 void safe_VkBufferCollectionPropertiesFUCHSIA::initialize(const VkBufferCollectionPropertiesFUCHSIA* in_struct,
@@ -9600,6 +12133,28 @@ safe_VkImageFormatConstraintsInfoFUCHSIA& safe_VkImageFormatConstraintsInfoFUCHS
     return *this;
 }
 
+safe_VkImageFormatConstraintsInfoFUCHSIA::safe_VkImageFormatConstraintsInfoFUCHSIA(
+    safe_VkImageFormatConstraintsInfoFUCHSIA&& move_src) noexcept
+    : safe_VkImageFormatConstraintsInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageFormatConstraintsInfoFUCHSIA& safe_VkImageFormatConstraintsInfoFUCHSIA::operator=(
+    safe_VkImageFormatConstraintsInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(imageCreateInfo, move_src.imageCreateInfo);
+    std::swap(requiredFormatFeatures, move_src.requiredFormatFeatures);
+    std::swap(flags, move_src.flags);
+    std::swap(sysmemPixelFormat, move_src.sysmemPixelFormat);
+    std::swap(colorSpaceCount, move_src.colorSpaceCount);
+    std::swap(pColorSpaces, move_src.pColorSpaces);
+
+    return *this;
+}
+
 safe_VkImageFormatConstraintsInfoFUCHSIA::~safe_VkImageFormatConstraintsInfoFUCHSIA() {
     if (pColorSpaces) delete[] pColorSpaces;
     FreePnextChain(pNext);
@@ -9706,6 +12261,25 @@ safe_VkImageConstraintsInfoFUCHSIA& safe_VkImageConstraintsInfoFUCHSIA::operator
     return *this;
 }
 
+safe_VkImageConstraintsInfoFUCHSIA::safe_VkImageConstraintsInfoFUCHSIA(safe_VkImageConstraintsInfoFUCHSIA&& move_src) noexcept
+    : safe_VkImageConstraintsInfoFUCHSIA() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageConstraintsInfoFUCHSIA& safe_VkImageConstraintsInfoFUCHSIA::operator=(
+    safe_VkImageConstraintsInfoFUCHSIA&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(formatConstraintsCount, move_src.formatConstraintsCount);
+    std::swap(pFormatConstraints, move_src.pFormatConstraints);
+    std::swap(bufferCollectionConstraints, move_src.bufferCollectionConstraints);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkImageConstraintsInfoFUCHSIA::~safe_VkImageConstraintsInfoFUCHSIA() {
     if (pFormatConstraints) delete[] pFormatConstraints;
     FreePnextChain(pNext);
@@ -9779,6 +12353,24 @@ safe_VkSubpassShadingPipelineCreateInfoHUAWEI& safe_VkSubpassShadingPipelineCrea
     return *this;
 }
 
+safe_VkSubpassShadingPipelineCreateInfoHUAWEI::safe_VkSubpassShadingPipelineCreateInfoHUAWEI(
+    safe_VkSubpassShadingPipelineCreateInfoHUAWEI&& move_src) noexcept
+    : safe_VkSubpassShadingPipelineCreateInfoHUAWEI() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubpassShadingPipelineCreateInfoHUAWEI& safe_VkSubpassShadingPipelineCreateInfoHUAWEI::operator=(
+    safe_VkSubpassShadingPipelineCreateInfoHUAWEI&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(renderPass, move_src.renderPass);
+    std::swap(subpass, move_src.subpass);
+
+    return *this;
+}
+
 safe_VkSubpassShadingPipelineCreateInfoHUAWEI::~safe_VkSubpassShadingPipelineCreateInfoHUAWEI() { FreePnextChain(pNext); }
 
 void safe_VkSubpassShadingPipelineCreateInfoHUAWEI::initialize(const VkSubpassShadingPipelineCreateInfoHUAWEI* in_struct,
@@ -9829,6 +12421,23 @@ safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& safe_VkPhysicalDeviceSubpassS
     return *this;
 }
 
+safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI::safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI(
+    safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI&& move_src) noexcept
+    : safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI::operator=(
+    safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(subpassShading, move_src.subpassShading);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI::~safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI::initialize(const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI* in_struct,
@@ -9879,6 +12488,23 @@ safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& safe_VkPhysicalDeviceSubpas
     return *this;
 }
 
+safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI::safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI(
+    safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI&& move_src) noexcept
+    : safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI::operator=(
+    safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxSubpassShadingWorkgroupSizeAspectRatio, move_src.maxSubpassShadingWorkgroupSizeAspectRatio);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI::~safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI() {
     FreePnextChain(pNext);
 }
@@ -9929,6 +12555,23 @@ safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& safe_VkPhysicalDeviceInvocati
     return *this;
 }
 
+safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI::safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI(
+    safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI&& move_src) noexcept
+    : safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI::operator=(
+    safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(invocationMask, move_src.invocationMask);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI::~safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI::initialize(const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI* in_struct,
@@ -9979,6 +12622,23 @@ safe_VkMemoryGetRemoteAddressInfoNV& safe_VkMemoryGetRemoteAddressInfoNV::operat
     return *this;
 }
 
+safe_VkMemoryGetRemoteAddressInfoNV::safe_VkMemoryGetRemoteAddressInfoNV(safe_VkMemoryGetRemoteAddressInfoNV&& move_src) noexcept
+    : safe_VkMemoryGetRemoteAddressInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkMemoryGetRemoteAddressInfoNV& safe_VkMemoryGetRemoteAddressInfoNV::operator=(
+    safe_VkMemoryGetRemoteAddressInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memory, move_src.memory);
+    std::swap(handleType, move_src.handleType);
+
+    return *this;
+}
+
 safe_VkMemoryGetRemoteAddressInfoNV::~safe_VkMemoryGetRemoteAddressInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkMemoryGetRemoteAddressInfoNV::initialize(const VkMemoryGetRemoteAddressInfoNV* in_struct,
@@ -10029,6 +12689,23 @@ safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& safe_VkPhysicalDeviceExternal
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV::safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV(
+    safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV::operator=(
+    safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(externalMemoryRDMA, move_src.externalMemoryRDMA);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV::~safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV::initialize(const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV* in_struct,
@@ -10105,6 +12782,24 @@ safe_VkScreenSurfaceCreateInfoQNX& safe_VkScreenSurfaceCreateInfoQNX::operator=(
     return *this;
 }
 
+safe_VkScreenSurfaceCreateInfoQNX::safe_VkScreenSurfaceCreateInfoQNX(safe_VkScreenSurfaceCreateInfoQNX&& move_src) noexcept
+    : safe_VkScreenSurfaceCreateInfoQNX() {
+    *this = std::move(move_src);
+}
+
+safe_VkScreenSurfaceCreateInfoQNX& safe_VkScreenSurfaceCreateInfoQNX::operator=(
+    safe_VkScreenSurfaceCreateInfoQNX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(context, move_src.context);
+    std::swap(window, move_src.window);
+
+    return *this;
+}
+
 safe_VkScreenSurfaceCreateInfoQNX::~safe_VkScreenSurfaceCreateInfoQNX() {
     if (context) delete context;
     if (window) delete window;
@@ -10181,6 +12876,23 @@ safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV& safe_VkPhysicalDeviceDispla
     return *this;
 }
 
+safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV::safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV(
+    safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV& safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV::operator=(
+    safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(displacementMicromap, move_src.displacementMicromap);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV::~safe_VkPhysicalDeviceDisplacementMicromapFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -10233,6 +12945,23 @@ safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV& safe_VkPhysicalDeviceDisp
     return *this;
 }
 
+safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV::safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV(
+    safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV& safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV::operator=(
+    safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxDisplacementMicromapSubdivisionLevel, move_src.maxDisplacementMicromapSubdivisionLevel);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV::~safe_VkPhysicalDeviceDisplacementMicromapPropertiesNV() {
     FreePnextChain(pNext);
 }
@@ -10383,6 +13112,38 @@ safe_VkAccelerationStructureTrianglesDisplacementMicromapNV& safe_VkAcceleration
     return *this;
 }
 
+safe_VkAccelerationStructureTrianglesDisplacementMicromapNV::safe_VkAccelerationStructureTrianglesDisplacementMicromapNV(
+    safe_VkAccelerationStructureTrianglesDisplacementMicromapNV&& move_src) noexcept
+    : safe_VkAccelerationStructureTrianglesDisplacementMicromapNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkAccelerationStructureTrianglesDisplacementMicromapNV& safe_VkAccelerationStructureTrianglesDisplacementMicromapNV::operator=(
+    safe_VkAccelerationStructureTrianglesDisplacementMicromapNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(displacementBiasAndScaleFormat, move_src.displacementBiasAndScaleFormat);
+    std::swap(displacementVectorFormat, move_src.displacementVectorFormat);
+    std::swap(displacementBiasAndScaleBuffer, move_src.displacementBiasAndScaleBuffer);
+    std::swap(displacementBiasAndScaleStride, move_src.displacementBiasAndScaleStride);
+    std::swap(displacementVectorBuffer, move_src.displacementVectorBuffer);
+    std::swap(displacementVectorStride, move_src.displacementVectorStride);
+    std::swap(displacedMicromapPrimitiveFlags, move_src.displacedMicromapPrimitiveFlags);
+    std::swap(displacedMicromapPrimitiveFlagsStride, move_src.displacedMicromapPrimitiveFlagsStride);
+    std::swap(indexType, move_src.indexType);
+    std::swap(indexBuffer, move_src.indexBuffer);
+    std::swap(indexStride, move_src.indexStride);
+    std::swap(baseTriangle, move_src.baseTriangle);
+    std::swap(usageCountsCount, move_src.usageCountsCount);
+    std::swap(pUsageCounts, move_src.pUsageCounts);
+    std::swap(ppUsageCounts, move_src.ppUsageCounts);
+    std::swap(micromap, move_src.micromap);
+
+    return *this;
+}
+
 safe_VkAccelerationStructureTrianglesDisplacementMicromapNV::~safe_VkAccelerationStructureTrianglesDisplacementMicromapNV() {
     if (pUsageCounts) delete[] pUsageCounts;
     if (ppUsageCounts) {
@@ -10508,6 +13269,24 @@ safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& safe_VkPhysicalDeviceCl
     return *this;
 }
 
+safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI::safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI(
+    safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI&& move_src) noexcept
+    : safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI::operator=(
+    safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(clustercullingShader, move_src.clustercullingShader);
+    std::swap(multiviewClusterCullingShader, move_src.multiviewClusterCullingShader);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI::~safe_VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI() {
     FreePnextChain(pNext);
 }
@@ -10591,6 +13370,26 @@ safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& safe_VkPhysicalDevice
     return *this;
 }
 
+safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI::safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI(
+    safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI&& move_src) noexcept
+    : safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI::operator=(
+    safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxWorkGroupCount, move_src.maxWorkGroupCount);
+    std::swap(maxWorkGroupSize, move_src.maxWorkGroupSize);
+    std::swap(maxOutputClusterCount, move_src.maxOutputClusterCount);
+    std::swap(indirectBufferOffsetAlignment, move_src.indirectBufferOffsetAlignment);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI::~safe_VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI() {
     FreePnextChain(pNext);
 }
@@ -10660,6 +13459,23 @@ safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI& safe_VkPhysicalDevic
     return *this;
 }
 
+safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI::safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI(
+    safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI&& move_src) noexcept
+    : safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI& safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI::operator=(
+    safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(clusterShadingRate, move_src.clusterShadingRate);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI::~safe_VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI() {
     FreePnextChain(pNext);
 }
@@ -10714,6 +13530,25 @@ safe_VkPhysicalDeviceShaderCorePropertiesARM& safe_VkPhysicalDeviceShaderCorePro
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderCorePropertiesARM::safe_VkPhysicalDeviceShaderCorePropertiesARM(
+    safe_VkPhysicalDeviceShaderCorePropertiesARM&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderCorePropertiesARM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderCorePropertiesARM& safe_VkPhysicalDeviceShaderCorePropertiesARM::operator=(
+    safe_VkPhysicalDeviceShaderCorePropertiesARM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pixelRate, move_src.pixelRate);
+    std::swap(texelRate, move_src.texelRate);
+    std::swap(fmaRate, move_src.fmaRate);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderCorePropertiesARM::~safe_VkPhysicalDeviceShaderCorePropertiesARM() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderCorePropertiesARM::initialize(const VkPhysicalDeviceShaderCorePropertiesARM* in_struct,
@@ -10766,6 +13601,23 @@ safe_VkDeviceQueueShaderCoreControlCreateInfoARM& safe_VkDeviceQueueShaderCoreCo
     return *this;
 }
 
+safe_VkDeviceQueueShaderCoreControlCreateInfoARM::safe_VkDeviceQueueShaderCoreControlCreateInfoARM(
+    safe_VkDeviceQueueShaderCoreControlCreateInfoARM&& move_src) noexcept
+    : safe_VkDeviceQueueShaderCoreControlCreateInfoARM() {
+    *this = std::move(move_src);
+}
+
+safe_VkDeviceQueueShaderCoreControlCreateInfoARM& safe_VkDeviceQueueShaderCoreControlCreateInfoARM::operator=(
+    safe_VkDeviceQueueShaderCoreControlCreateInfoARM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderCoreCount, move_src.shaderCoreCount);
+
+    return *this;
+}
+
 safe_VkDeviceQueueShaderCoreControlCreateInfoARM::~safe_VkDeviceQueueShaderCoreControlCreateInfoARM() { FreePnextChain(pNext); }
 
 void safe_VkDeviceQueueShaderCoreControlCreateInfoARM::initialize(const VkDeviceQueueShaderCoreControlCreateInfoARM* in_struct,
@@ -10814,6 +13666,23 @@ safe_VkPhysicalDeviceSchedulingControlsFeaturesARM& safe_VkPhysicalDeviceSchedul
     return *this;
 }
 
+safe_VkPhysicalDeviceSchedulingControlsFeaturesARM::safe_VkPhysicalDeviceSchedulingControlsFeaturesARM(
+    safe_VkPhysicalDeviceSchedulingControlsFeaturesARM&& move_src) noexcept
+    : safe_VkPhysicalDeviceSchedulingControlsFeaturesARM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSchedulingControlsFeaturesARM& safe_VkPhysicalDeviceSchedulingControlsFeaturesARM::operator=(
+    safe_VkPhysicalDeviceSchedulingControlsFeaturesARM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(schedulingControls, move_src.schedulingControls);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSchedulingControlsFeaturesARM::~safe_VkPhysicalDeviceSchedulingControlsFeaturesARM() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceSchedulingControlsFeaturesARM::initialize(const VkPhysicalDeviceSchedulingControlsFeaturesARM* in_struct,
@@ -10862,6 +13731,23 @@ safe_VkPhysicalDeviceSchedulingControlsPropertiesARM& safe_VkPhysicalDeviceSched
     return *this;
 }
 
+safe_VkPhysicalDeviceSchedulingControlsPropertiesARM::safe_VkPhysicalDeviceSchedulingControlsPropertiesARM(
+    safe_VkPhysicalDeviceSchedulingControlsPropertiesARM&& move_src) noexcept
+    : safe_VkPhysicalDeviceSchedulingControlsPropertiesARM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceSchedulingControlsPropertiesARM& safe_VkPhysicalDeviceSchedulingControlsPropertiesARM::operator=(
+    safe_VkPhysicalDeviceSchedulingControlsPropertiesARM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(schedulingControlsFlags, move_src.schedulingControlsFlags);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSchedulingControlsPropertiesARM::~safe_VkPhysicalDeviceSchedulingControlsPropertiesARM() {
     FreePnextChain(pNext);
 }
@@ -10915,6 +13801,23 @@ safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& safe_VkPhysicalDevic
     return *this;
 }
 
+safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE::safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE(
+    safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE&& move_src) noexcept
+    : safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE::operator=(
+    safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(descriptorSetHostMapping, move_src.descriptorSetHostMapping);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE::~safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE() {
     FreePnextChain(pNext);
 }
@@ -10967,6 +13870,24 @@ safe_VkDescriptorSetBindingReferenceVALVE& safe_VkDescriptorSetBindingReferenceV
     return *this;
 }
 
+safe_VkDescriptorSetBindingReferenceVALVE::safe_VkDescriptorSetBindingReferenceVALVE(
+    safe_VkDescriptorSetBindingReferenceVALVE&& move_src) noexcept
+    : safe_VkDescriptorSetBindingReferenceVALVE() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorSetBindingReferenceVALVE& safe_VkDescriptorSetBindingReferenceVALVE::operator=(
+    safe_VkDescriptorSetBindingReferenceVALVE&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(descriptorSetLayout, move_src.descriptorSetLayout);
+    std::swap(binding, move_src.binding);
+
+    return *this;
+}
+
 safe_VkDescriptorSetBindingReferenceVALVE::~safe_VkDescriptorSetBindingReferenceVALVE() { FreePnextChain(pNext); }
 
 void safe_VkDescriptorSetBindingReferenceVALVE::initialize(const VkDescriptorSetBindingReferenceVALVE* in_struct,
@@ -11022,6 +13943,24 @@ safe_VkDescriptorSetLayoutHostMappingInfoVALVE& safe_VkDescriptorSetLayoutHostMa
     return *this;
 }
 
+safe_VkDescriptorSetLayoutHostMappingInfoVALVE::safe_VkDescriptorSetLayoutHostMappingInfoVALVE(
+    safe_VkDescriptorSetLayoutHostMappingInfoVALVE&& move_src) noexcept
+    : safe_VkDescriptorSetLayoutHostMappingInfoVALVE() {
+    *this = std::move(move_src);
+}
+
+safe_VkDescriptorSetLayoutHostMappingInfoVALVE& safe_VkDescriptorSetLayoutHostMappingInfoVALVE::operator=(
+    safe_VkDescriptorSetLayoutHostMappingInfoVALVE&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(descriptorOffset, move_src.descriptorOffset);
+    std::swap(descriptorSize, move_src.descriptorSize);
+
+    return *this;
+}
+
 safe_VkDescriptorSetLayoutHostMappingInfoVALVE::~safe_VkDescriptorSetLayoutHostMappingInfoVALVE() { FreePnextChain(pNext); }
 
 void safe_VkDescriptorSetLayoutHostMappingInfoVALVE::initialize(const VkDescriptorSetLayoutHostMappingInfoVALVE* in_struct,
@@ -11072,6 +14011,23 @@ safe_VkPhysicalDeviceRenderPassStripedFeaturesARM& safe_VkPhysicalDeviceRenderPa
     return *this;
 }
 
+safe_VkPhysicalDeviceRenderPassStripedFeaturesARM::safe_VkPhysicalDeviceRenderPassStripedFeaturesARM(
+    safe_VkPhysicalDeviceRenderPassStripedFeaturesARM&& move_src) noexcept
+    : safe_VkPhysicalDeviceRenderPassStripedFeaturesARM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRenderPassStripedFeaturesARM& safe_VkPhysicalDeviceRenderPassStripedFeaturesARM::operator=(
+    safe_VkPhysicalDeviceRenderPassStripedFeaturesARM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(renderPassStriped, move_src.renderPassStriped);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRenderPassStripedFeaturesARM::~safe_VkPhysicalDeviceRenderPassStripedFeaturesARM() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceRenderPassStripedFeaturesARM::initialize(const VkPhysicalDeviceRenderPassStripedFeaturesARM* in_struct,
@@ -11127,6 +14083,24 @@ safe_VkPhysicalDeviceRenderPassStripedPropertiesARM& safe_VkPhysicalDeviceRender
     return *this;
 }
 
+safe_VkPhysicalDeviceRenderPassStripedPropertiesARM::safe_VkPhysicalDeviceRenderPassStripedPropertiesARM(
+    safe_VkPhysicalDeviceRenderPassStripedPropertiesARM&& move_src) noexcept
+    : safe_VkPhysicalDeviceRenderPassStripedPropertiesARM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRenderPassStripedPropertiesARM& safe_VkPhysicalDeviceRenderPassStripedPropertiesARM::operator=(
+    safe_VkPhysicalDeviceRenderPassStripedPropertiesARM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(renderPassStripeGranularity, move_src.renderPassStripeGranularity);
+    std::swap(maxRenderPassStripes, move_src.maxRenderPassStripes);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRenderPassStripedPropertiesARM::~safe_VkPhysicalDeviceRenderPassStripedPropertiesARM() {
     FreePnextChain(pNext);
 }
@@ -11177,6 +14151,21 @@ safe_VkRenderPassStripeInfoARM& safe_VkRenderPassStripeInfoARM::operator=(const
     return *this;
 }
 
+safe_VkRenderPassStripeInfoARM::safe_VkRenderPassStripeInfoARM(safe_VkRenderPassStripeInfoARM&& move_src) noexcept
+    : safe_VkRenderPassStripeInfoARM() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassStripeInfoARM& safe_VkRenderPassStripeInfoARM::operator=(safe_VkRenderPassStripeInfoARM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stripeArea, move_src.stripeArea);
+
+    return *this;
+}
+
 safe_VkRenderPassStripeInfoARM::~safe_VkRenderPassStripeInfoARM() { FreePnextChain(pNext); }
 
 void safe_VkRenderPassStripeInfoARM::initialize(const VkRenderPassStripeInfoARM* in_struct,
@@ -11246,6 +14235,23 @@ safe_VkRenderPassStripeBeginInfoARM& safe_VkRenderPassStripeBeginInfoARM::operat
     return *this;
 }
 
+safe_VkRenderPassStripeBeginInfoARM::safe_VkRenderPassStripeBeginInfoARM(safe_VkRenderPassStripeBeginInfoARM&& move_src) noexcept
+    : safe_VkRenderPassStripeBeginInfoARM() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassStripeBeginInfoARM& safe_VkRenderPassStripeBeginInfoARM::operator=(
+    safe_VkRenderPassStripeBeginInfoARM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stripeInfoCount, move_src.stripeInfoCount);
+    std::swap(pStripeInfos, move_src.pStripeInfos);
+
+    return *this;
+}
+
 safe_VkRenderPassStripeBeginInfoARM::~safe_VkRenderPassStripeBeginInfoARM() {
     if (pStripeInfos) delete[] pStripeInfos;
     FreePnextChain(pNext);
@@ -11336,6 +14342,23 @@ safe_VkRenderPassStripeSubmitInfoARM& safe_VkRenderPassStripeSubmitInfoARM::oper
     return *this;
 }
 
+safe_VkRenderPassStripeSubmitInfoARM::safe_VkRenderPassStripeSubmitInfoARM(safe_VkRenderPassStripeSubmitInfoARM&& move_src) noexcept
+    : safe_VkRenderPassStripeSubmitInfoARM() {
+    *this = std::move(move_src);
+}
+
+safe_VkRenderPassStripeSubmitInfoARM& safe_VkRenderPassStripeSubmitInfoARM::operator=(
+    safe_VkRenderPassStripeSubmitInfoARM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(stripeSemaphoreInfoCount, move_src.stripeSemaphoreInfoCount);
+    std::swap(pStripeSemaphoreInfos, move_src.pStripeSemaphoreInfos);
+
+    return *this;
+}
+
 safe_VkRenderPassStripeSubmitInfoARM::~safe_VkRenderPassStripeSubmitInfoARM() {
     if (pStripeSemaphoreInfos) delete[] pStripeSemaphoreInfos;
     FreePnextChain(pNext);
@@ -11405,6 +14428,23 @@ safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& safe_VkPhysicalDevice
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM::safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM(
+    safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM::operator=(
+    safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fragmentDensityMapOffset, move_src.fragmentDensityMapOffset);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM::~safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM() {
     FreePnextChain(pNext);
 }
@@ -11458,6 +14498,23 @@ safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& safe_VkPhysicalDevi
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM::safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM(
+    safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM::operator=(
+    safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fragmentDensityOffsetGranularity, move_src.fragmentDensityOffsetGranularity);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM::~safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM() {
     FreePnextChain(pNext);
 }
@@ -11531,6 +14588,24 @@ safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM& safe_VkSubpassFragmentDensity
     return *this;
 }
 
+safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM::safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM(
+    safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM&& move_src) noexcept
+    : safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM& safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM::operator=(
+    safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(fragmentDensityOffsetCount, move_src.fragmentDensityOffsetCount);
+    std::swap(pFragmentDensityOffsets, move_src.pFragmentDensityOffsets);
+
+    return *this;
+}
+
 safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM::~safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM() {
     if (pFragmentDensityOffsets) delete[] pFragmentDensityOffsets;
     FreePnextChain(pNext);
@@ -11597,6 +14672,23 @@ safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& safe_VkPhysicalDeviceCopyMemo
     return *this;
 }
 
+safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV::safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV(
+    safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV::operator=(
+    safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(indirectCopy, move_src.indirectCopy);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV::~safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceCopyMemoryIndirectFeaturesNV::initialize(const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV* in_struct,
@@ -11645,6 +14737,23 @@ safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& safe_VkPhysicalDeviceCopyMe
     return *this;
 }
 
+safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV::safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV(
+    safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV::operator=(
+    safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(supportedQueues, move_src.supportedQueues);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV::~safe_VkPhysicalDeviceCopyMemoryIndirectPropertiesNV() {
     FreePnextChain(pNext);
 }
@@ -11695,6 +14804,23 @@ safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV& safe_VkPhysicalDeviceMemoryD
     return *this;
 }
 
+safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV::safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV(
+    safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV& safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV::operator=(
+    safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(memoryDecompression, move_src.memoryDecompression);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV::~safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceMemoryDecompressionFeaturesNV::initialize(const VkPhysicalDeviceMemoryDecompressionFeaturesNV* in_struct,
@@ -11750,6 +14876,24 @@ safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV& safe_VkPhysicalDeviceMemor
     return *this;
 }
 
+safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV::safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV(
+    safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV& safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV::operator=(
+    safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(decompressionMethods, move_src.decompressionMethods);
+    std::swap(maxDecompressionIndirectCount, move_src.maxDecompressionIndirectCount);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV::~safe_VkPhysicalDeviceMemoryDecompressionPropertiesNV() {
     FreePnextChain(pNext);
 }
@@ -11815,6 +14959,26 @@ safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV::safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV(
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV&
+safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV::operator=(
+    safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceGeneratedCompute, move_src.deviceGeneratedCompute);
+    std::swap(deviceGeneratedComputePipelines, move_src.deviceGeneratedComputePipelines);
+    std::swap(deviceGeneratedComputeCaptureReplay, move_src.deviceGeneratedComputeCaptureReplay);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV::~safe_VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -11880,6 +15044,25 @@ safe_VkComputePipelineIndirectBufferInfoNV& safe_VkComputePipelineIndirectBuffer
     return *this;
 }
 
+safe_VkComputePipelineIndirectBufferInfoNV::safe_VkComputePipelineIndirectBufferInfoNV(
+    safe_VkComputePipelineIndirectBufferInfoNV&& move_src) noexcept
+    : safe_VkComputePipelineIndirectBufferInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkComputePipelineIndirectBufferInfoNV& safe_VkComputePipelineIndirectBufferInfoNV::operator=(
+    safe_VkComputePipelineIndirectBufferInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(deviceAddress, move_src.deviceAddress);
+    std::swap(size, move_src.size);
+    std::swap(pipelineDeviceAddressCaptureReplay, move_src.pipelineDeviceAddressCaptureReplay);
+
+    return *this;
+}
+
 safe_VkComputePipelineIndirectBufferInfoNV::~safe_VkComputePipelineIndirectBufferInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkComputePipelineIndirectBufferInfoNV::initialize(const VkComputePipelineIndirectBufferInfoNV* in_struct,
@@ -11934,6 +15117,24 @@ safe_VkPipelineIndirectDeviceAddressInfoNV& safe_VkPipelineIndirectDeviceAddress
     return *this;
 }
 
+safe_VkPipelineIndirectDeviceAddressInfoNV::safe_VkPipelineIndirectDeviceAddressInfoNV(
+    safe_VkPipelineIndirectDeviceAddressInfoNV&& move_src) noexcept
+    : safe_VkPipelineIndirectDeviceAddressInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPipelineIndirectDeviceAddressInfoNV& safe_VkPipelineIndirectDeviceAddressInfoNV::operator=(
+    safe_VkPipelineIndirectDeviceAddressInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(pipelineBindPoint, move_src.pipelineBindPoint);
+    std::swap(pipeline, move_src.pipeline);
+
+    return *this;
+}
+
 safe_VkPipelineIndirectDeviceAddressInfoNV::~safe_VkPipelineIndirectDeviceAddressInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkPipelineIndirectDeviceAddressInfoNV::initialize(const VkPipelineIndirectDeviceAddressInfoNV* in_struct,
@@ -11984,6 +15185,23 @@ safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV& safe_VkPhysicalDeviceLinea
     return *this;
 }
 
+safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV::safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV(
+    safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV& safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV::operator=(
+    safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(linearColorAttachment, move_src.linearColorAttachment);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV::~safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -12045,6 +15263,25 @@ safe_VkImageViewSampleWeightCreateInfoQCOM& safe_VkImageViewSampleWeightCreateIn
     return *this;
 }
 
+safe_VkImageViewSampleWeightCreateInfoQCOM::safe_VkImageViewSampleWeightCreateInfoQCOM(
+    safe_VkImageViewSampleWeightCreateInfoQCOM&& move_src) noexcept
+    : safe_VkImageViewSampleWeightCreateInfoQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkImageViewSampleWeightCreateInfoQCOM& safe_VkImageViewSampleWeightCreateInfoQCOM::operator=(
+    safe_VkImageViewSampleWeightCreateInfoQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(filterCenter, move_src.filterCenter);
+    std::swap(filterSize, move_src.filterSize);
+    std::swap(numPhases, move_src.numPhases);
+
+    return *this;
+}
+
 safe_VkImageViewSampleWeightCreateInfoQCOM::~safe_VkImageViewSampleWeightCreateInfoQCOM() { FreePnextChain(pNext); }
 
 void safe_VkImageViewSampleWeightCreateInfoQCOM::initialize(const VkImageViewSampleWeightCreateInfoQCOM* in_struct,
@@ -12108,6 +15345,25 @@ safe_VkPhysicalDeviceImageProcessingFeaturesQCOM& safe_VkPhysicalDeviceImageProc
     return *this;
 }
 
+safe_VkPhysicalDeviceImageProcessingFeaturesQCOM::safe_VkPhysicalDeviceImageProcessingFeaturesQCOM(
+    safe_VkPhysicalDeviceImageProcessingFeaturesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageProcessingFeaturesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageProcessingFeaturesQCOM& safe_VkPhysicalDeviceImageProcessingFeaturesQCOM::operator=(
+    safe_VkPhysicalDeviceImageProcessingFeaturesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(textureSampleWeighted, move_src.textureSampleWeighted);
+    std::swap(textureBoxFilter, move_src.textureBoxFilter);
+    std::swap(textureBlockMatch, move_src.textureBlockMatch);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageProcessingFeaturesQCOM::~safe_VkPhysicalDeviceImageProcessingFeaturesQCOM() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceImageProcessingFeaturesQCOM::initialize(const VkPhysicalDeviceImageProcessingFeaturesQCOM* in_struct,
@@ -12175,6 +15431,26 @@ safe_VkPhysicalDeviceImageProcessingPropertiesQCOM& safe_VkPhysicalDeviceImagePr
     return *this;
 }
 
+safe_VkPhysicalDeviceImageProcessingPropertiesQCOM::safe_VkPhysicalDeviceImageProcessingPropertiesQCOM(
+    safe_VkPhysicalDeviceImageProcessingPropertiesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageProcessingPropertiesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageProcessingPropertiesQCOM& safe_VkPhysicalDeviceImageProcessingPropertiesQCOM::operator=(
+    safe_VkPhysicalDeviceImageProcessingPropertiesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxWeightFilterPhases, move_src.maxWeightFilterPhases);
+    std::swap(maxWeightFilterDimension, move_src.maxWeightFilterDimension);
+    std::swap(maxBlockMatchRegion, move_src.maxBlockMatchRegion);
+    std::swap(maxBoxFilterBlockSize, move_src.maxBoxFilterBlockSize);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageProcessingPropertiesQCOM::~safe_VkPhysicalDeviceImageProcessingPropertiesQCOM() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceImageProcessingPropertiesQCOM::initialize(const VkPhysicalDeviceImageProcessingPropertiesQCOM* in_struct,
@@ -12231,6 +15507,23 @@ safe_VkDirectDriverLoadingInfoLUNARG& safe_VkDirectDriverLoadingInfoLUNARG::oper
     return *this;
 }
 
+safe_VkDirectDriverLoadingInfoLUNARG::safe_VkDirectDriverLoadingInfoLUNARG(safe_VkDirectDriverLoadingInfoLUNARG&& move_src) noexcept
+    : safe_VkDirectDriverLoadingInfoLUNARG() {
+    *this = std::move(move_src);
+}
+
+safe_VkDirectDriverLoadingInfoLUNARG& safe_VkDirectDriverLoadingInfoLUNARG::operator=(
+    safe_VkDirectDriverLoadingInfoLUNARG&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(pfnGetInstanceProcAddr, move_src.pfnGetInstanceProcAddr);
+
+    return *this;
+}
+
 safe_VkDirectDriverLoadingInfoLUNARG::~safe_VkDirectDriverLoadingInfoLUNARG() { FreePnextChain(pNext); }
 
 void safe_VkDirectDriverLoadingInfoLUNARG::initialize(const VkDirectDriverLoadingInfoLUNARG* in_struct,
@@ -12304,6 +15597,24 @@ safe_VkDirectDriverLoadingListLUNARG& safe_VkDirectDriverLoadingListLUNARG::oper
     return *this;
 }
 
+safe_VkDirectDriverLoadingListLUNARG::safe_VkDirectDriverLoadingListLUNARG(safe_VkDirectDriverLoadingListLUNARG&& move_src) noexcept
+    : safe_VkDirectDriverLoadingListLUNARG() {
+    *this = std::move(move_src);
+}
+
+safe_VkDirectDriverLoadingListLUNARG& safe_VkDirectDriverLoadingListLUNARG::operator=(
+    safe_VkDirectDriverLoadingListLUNARG&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(mode, move_src.mode);
+    std::swap(driverCount, move_src.driverCount);
+    std::swap(pDrivers, move_src.pDrivers);
+
+    return *this;
+}
+
 safe_VkDirectDriverLoadingListLUNARG::~safe_VkDirectDriverLoadingListLUNARG() {
     if (pDrivers) delete[] pDrivers;
     FreePnextChain(pNext);
@@ -12372,6 +15683,23 @@ safe_VkPhysicalDeviceOpticalFlowFeaturesNV& safe_VkPhysicalDeviceOpticalFlowFeat
     return *this;
 }
 
+safe_VkPhysicalDeviceOpticalFlowFeaturesNV::safe_VkPhysicalDeviceOpticalFlowFeaturesNV(
+    safe_VkPhysicalDeviceOpticalFlowFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceOpticalFlowFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceOpticalFlowFeaturesNV& safe_VkPhysicalDeviceOpticalFlowFeaturesNV::operator=(
+    safe_VkPhysicalDeviceOpticalFlowFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(opticalFlow, move_src.opticalFlow);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceOpticalFlowFeaturesNV::~safe_VkPhysicalDeviceOpticalFlowFeaturesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceOpticalFlowFeaturesNV::initialize(const VkPhysicalDeviceOpticalFlowFeaturesNV* in_struct,
@@ -12463,6 +15791,33 @@ safe_VkPhysicalDeviceOpticalFlowPropertiesNV& safe_VkPhysicalDeviceOpticalFlowPr
     return *this;
 }
 
+safe_VkPhysicalDeviceOpticalFlowPropertiesNV::safe_VkPhysicalDeviceOpticalFlowPropertiesNV(
+    safe_VkPhysicalDeviceOpticalFlowPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceOpticalFlowPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceOpticalFlowPropertiesNV& safe_VkPhysicalDeviceOpticalFlowPropertiesNV::operator=(
+    safe_VkPhysicalDeviceOpticalFlowPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(supportedOutputGridSizes, move_src.supportedOutputGridSizes);
+    std::swap(supportedHintGridSizes, move_src.supportedHintGridSizes);
+    std::swap(hintSupported, move_src.hintSupported);
+    std::swap(costSupported, move_src.costSupported);
+    std::swap(bidirectionalFlowSupported, move_src.bidirectionalFlowSupported);
+    std::swap(globalFlowSupported, move_src.globalFlowSupported);
+    std::swap(minWidth, move_src.minWidth);
+    std::swap(minHeight, move_src.minHeight);
+    std::swap(maxWidth, move_src.maxWidth);
+    std::swap(maxHeight, move_src.maxHeight);
+    std::swap(maxNumRegionsOfInterest, move_src.maxNumRegionsOfInterest);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceOpticalFlowPropertiesNV::~safe_VkPhysicalDeviceOpticalFlowPropertiesNV() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceOpticalFlowPropertiesNV::initialize(const VkPhysicalDeviceOpticalFlowPropertiesNV* in_struct,
@@ -12531,6 +15886,22 @@ safe_VkOpticalFlowImageFormatInfoNV& safe_VkOpticalFlowImageFormatInfoNV::operat
     return *this;
 }
 
+safe_VkOpticalFlowImageFormatInfoNV::safe_VkOpticalFlowImageFormatInfoNV(safe_VkOpticalFlowImageFormatInfoNV&& move_src) noexcept
+    : safe_VkOpticalFlowImageFormatInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkOpticalFlowImageFormatInfoNV& safe_VkOpticalFlowImageFormatInfoNV::operator=(
+    safe_VkOpticalFlowImageFormatInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(usage, move_src.usage);
+
+    return *this;
+}
+
 safe_VkOpticalFlowImageFormatInfoNV::~safe_VkOpticalFlowImageFormatInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkOpticalFlowImageFormatInfoNV::initialize(const VkOpticalFlowImageFormatInfoNV* in_struct,
@@ -12579,6 +15950,23 @@ safe_VkOpticalFlowImageFormatPropertiesNV& safe_VkOpticalFlowImageFormatProperti
     return *this;
 }
 
+safe_VkOpticalFlowImageFormatPropertiesNV::safe_VkOpticalFlowImageFormatPropertiesNV(
+    safe_VkOpticalFlowImageFormatPropertiesNV&& move_src) noexcept
+    : safe_VkOpticalFlowImageFormatPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkOpticalFlowImageFormatPropertiesNV& safe_VkOpticalFlowImageFormatPropertiesNV::operator=(
+    safe_VkOpticalFlowImageFormatPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(format, move_src.format);
+
+    return *this;
+}
+
 safe_VkOpticalFlowImageFormatPropertiesNV::~safe_VkOpticalFlowImageFormatPropertiesNV() { FreePnextChain(pNext); }
 
 void safe_VkOpticalFlowImageFormatPropertiesNV::initialize(const VkOpticalFlowImageFormatPropertiesNV* in_struct,
@@ -12663,6 +16051,31 @@ safe_VkOpticalFlowSessionCreateInfoNV& safe_VkOpticalFlowSessionCreateInfoNV::op
     return *this;
 }
 
+safe_VkOpticalFlowSessionCreateInfoNV::safe_VkOpticalFlowSessionCreateInfoNV(
+    safe_VkOpticalFlowSessionCreateInfoNV&& move_src) noexcept
+    : safe_VkOpticalFlowSessionCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkOpticalFlowSessionCreateInfoNV& safe_VkOpticalFlowSessionCreateInfoNV::operator=(
+    safe_VkOpticalFlowSessionCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(width, move_src.width);
+    std::swap(height, move_src.height);
+    std::swap(imageFormat, move_src.imageFormat);
+    std::swap(flowVectorFormat, move_src.flowVectorFormat);
+    std::swap(costFormat, move_src.costFormat);
+    std::swap(outputGridSize, move_src.outputGridSize);
+    std::swap(hintGridSize, move_src.hintGridSize);
+    std::swap(performanceLevel, move_src.performanceLevel);
+    std::swap(flags, move_src.flags);
+
+    return *this;
+}
+
 safe_VkOpticalFlowSessionCreateInfoNV::~safe_VkOpticalFlowSessionCreateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkOpticalFlowSessionCreateInfoNV::initialize(const VkOpticalFlowSessionCreateInfoNV* in_struct,
@@ -12735,6 +16148,25 @@ safe_VkOpticalFlowSessionCreatePrivateDataInfoNV& safe_VkOpticalFlowSessionCreat
     return *this;
 }
 
+safe_VkOpticalFlowSessionCreatePrivateDataInfoNV::safe_VkOpticalFlowSessionCreatePrivateDataInfoNV(
+    safe_VkOpticalFlowSessionCreatePrivateDataInfoNV&& move_src) noexcept
+    : safe_VkOpticalFlowSessionCreatePrivateDataInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkOpticalFlowSessionCreatePrivateDataInfoNV& safe_VkOpticalFlowSessionCreatePrivateDataInfoNV::operator=(
+    safe_VkOpticalFlowSessionCreatePrivateDataInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(id, move_src.id);
+    std::swap(size, move_src.size);
+    std::swap(pPrivateData, move_src.pPrivateData);
+
+    return *this;
+}
+
 safe_VkOpticalFlowSessionCreatePrivateDataInfoNV::~safe_VkOpticalFlowSessionCreatePrivateDataInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkOpticalFlowSessionCreatePrivateDataInfoNV::initialize(const VkOpticalFlowSessionCreatePrivateDataInfoNV* in_struct,
@@ -12804,6 +16236,23 @@ safe_VkOpticalFlowExecuteInfoNV& safe_VkOpticalFlowExecuteInfoNV::operator=(cons
     return *this;
 }
 
+safe_VkOpticalFlowExecuteInfoNV::safe_VkOpticalFlowExecuteInfoNV(safe_VkOpticalFlowExecuteInfoNV&& move_src) noexcept
+    : safe_VkOpticalFlowExecuteInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkOpticalFlowExecuteInfoNV& safe_VkOpticalFlowExecuteInfoNV::operator=(safe_VkOpticalFlowExecuteInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(flags, move_src.flags);
+    std::swap(regionCount, move_src.regionCount);
+    std::swap(pRegions, move_src.pRegions);
+
+    return *this;
+}
+
 safe_VkOpticalFlowExecuteInfoNV::~safe_VkOpticalFlowExecuteInfoNV() {
     if (pRegions) delete[] pRegions;
     FreePnextChain(pNext);
@@ -12872,6 +16321,23 @@ safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID& safe_VkPhysicalDevice
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID::safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID(
+    safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID&& move_src) noexcept
+    : safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID& safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID::operator=(
+    safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(externalFormatResolve, move_src.externalFormatResolve);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID::~safe_VkPhysicalDeviceExternalFormatResolveFeaturesANDROID() {
     FreePnextChain(pNext);
 }
@@ -12934,6 +16400,25 @@ safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID& safe_VkPhysicalDevi
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID::safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID(
+    safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID&& move_src) noexcept
+    : safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID& safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID::operator=(
+    safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(nullColorAttachmentWithExternalFormatResolve, move_src.nullColorAttachmentWithExternalFormatResolve);
+    std::swap(externalFormatResolveChromaOffsetX, move_src.externalFormatResolveChromaOffsetX);
+    std::swap(externalFormatResolveChromaOffsetY, move_src.externalFormatResolveChromaOffsetY);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID::~safe_VkPhysicalDeviceExternalFormatResolvePropertiesANDROID() {
     FreePnextChain(pNext);
 }
@@ -12989,6 +16474,23 @@ safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID& safe_VkAndroidHardwa
     return *this;
 }
 
+safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID::safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID(
+    safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID&& move_src) noexcept
+    : safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID() {
+    *this = std::move(move_src);
+}
+
+safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID& safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID::operator=(
+    safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(colorAttachmentFormat, move_src.colorAttachmentFormat);
+
+    return *this;
+}
+
 safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID::~safe_VkAndroidHardwareBufferFormatResolvePropertiesANDROID() {
     FreePnextChain(pNext);
 }
@@ -13040,6 +16542,23 @@ safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM& safe_VkPhysicalDeviceTileProper
     return *this;
 }
 
+safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM::safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM(
+    safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM& safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM::operator=(
+    safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(tileProperties, move_src.tileProperties);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM::~safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM::initialize(const VkPhysicalDeviceTilePropertiesFeaturesQCOM* in_struct,
@@ -13090,6 +16609,22 @@ safe_VkTilePropertiesQCOM& safe_VkTilePropertiesQCOM::operator=(const safe_VkTil
     return *this;
 }
 
+safe_VkTilePropertiesQCOM::safe_VkTilePropertiesQCOM(safe_VkTilePropertiesQCOM&& move_src) noexcept : safe_VkTilePropertiesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkTilePropertiesQCOM& safe_VkTilePropertiesQCOM::operator=(safe_VkTilePropertiesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(tileSize, move_src.tileSize);
+    std::swap(apronSize, move_src.apronSize);
+    std::swap(origin, move_src.origin);
+
+    return *this;
+}
+
 safe_VkTilePropertiesQCOM::~safe_VkTilePropertiesQCOM() { FreePnextChain(pNext); }
 
 void safe_VkTilePropertiesQCOM::initialize(const VkTilePropertiesQCOM* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -13140,6 +16675,23 @@ safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC& safe_VkPhysicalDeviceAmigoProfil
     return *this;
 }
 
+safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC::safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC(
+    safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC&& move_src) noexcept
+    : safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC& safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC::operator=(
+    safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(amigoProfiling, move_src.amigoProfiling);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC::~safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC::initialize(const VkPhysicalDeviceAmigoProfilingFeaturesSEC* in_struct,
@@ -13191,6 +16743,23 @@ safe_VkAmigoProfilingSubmitInfoSEC& safe_VkAmigoProfilingSubmitInfoSEC::operator
     return *this;
 }
 
+safe_VkAmigoProfilingSubmitInfoSEC::safe_VkAmigoProfilingSubmitInfoSEC(safe_VkAmigoProfilingSubmitInfoSEC&& move_src) noexcept
+    : safe_VkAmigoProfilingSubmitInfoSEC() {
+    *this = std::move(move_src);
+}
+
+safe_VkAmigoProfilingSubmitInfoSEC& safe_VkAmigoProfilingSubmitInfoSEC::operator=(
+    safe_VkAmigoProfilingSubmitInfoSEC&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(firstDrawTimestamp, move_src.firstDrawTimestamp);
+    std::swap(swapBufferTimestamp, move_src.swapBufferTimestamp);
+
+    return *this;
+}
+
 safe_VkAmigoProfilingSubmitInfoSEC::~safe_VkAmigoProfilingSubmitInfoSEC() { FreePnextChain(pNext); }
 
 void safe_VkAmigoProfilingSubmitInfoSEC::initialize(const VkAmigoProfilingSubmitInfoSEC* in_struct,
@@ -13244,6 +16813,23 @@ safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& safe_VkPhysicalDevic
     return *this;
 }
 
+safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM::safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM(
+    safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM::operator=(
+    safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(multiviewPerViewViewports, move_src.multiviewPerViewViewports);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM::~safe_VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM() {
     FreePnextChain(pNext);
 }
@@ -13298,6 +16884,24 @@ safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV::safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV(
+    safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV&
+safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV::operator=(
+    safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(rayTracingInvocationReorderReorderingHint, move_src.rayTracingInvocationReorderReorderingHint);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV::~safe_VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV() {
     FreePnextChain(pNext);
 }
@@ -13351,6 +16955,23 @@ safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& safe_VkPhysicalDevic
     return *this;
 }
 
+safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV::safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV(
+    safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV::operator=(
+    safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(rayTracingInvocationReorder, move_src.rayTracingInvocationReorder);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV::~safe_VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -13404,6 +17025,23 @@ safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV& safe_VkPhysicalDevice
     return *this;
 }
 
+safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV::safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV(
+    safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV& safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV::operator=(
+    safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(extendedSparseAddressSpace, move_src.extendedSparseAddressSpace);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV::~safe_VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -13455,13 +17093,32 @@ safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV& safe_VkPhysicalDevi
     const safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV& copy_src) {
     if (&copy_src == this) return *this;
 
-    FreePnextChain(pNext);
+    FreePnextChain(pNext);
+
+    sType = copy_src.sType;
+    extendedSparseAddressSpaceSize = copy_src.extendedSparseAddressSpaceSize;
+    extendedSparseImageUsageFlags = copy_src.extendedSparseImageUsageFlags;
+    extendedSparseBufferUsageFlags = copy_src.extendedSparseBufferUsageFlags;
+    pNext = SafePnextCopy(copy_src.pNext);
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV::safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV(
+    safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV& safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV::operator=(
+    safe_VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
 
-    sType = copy_src.sType;
-    extendedSparseAddressSpaceSize = copy_src.extendedSparseAddressSpaceSize;
-    extendedSparseImageUsageFlags = copy_src.extendedSparseImageUsageFlags;
-    extendedSparseBufferUsageFlags = copy_src.extendedSparseBufferUsageFlags;
-    pNext = SafePnextCopy(copy_src.pNext);
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(extendedSparseAddressSpaceSize, move_src.extendedSparseAddressSpaceSize);
+    std::swap(extendedSparseImageUsageFlags, move_src.extendedSparseImageUsageFlags);
+    std::swap(extendedSparseBufferUsageFlags, move_src.extendedSparseBufferUsageFlags);
 
     return *this;
 }
@@ -13520,6 +17177,23 @@ safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& safe_VkPhysicalDeviceShaderC
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM::safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM(
+    safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM::operator=(
+    safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderCoreBuiltins, move_src.shaderCoreBuiltins);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM::~safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM::initialize(const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM* in_struct,
@@ -13579,6 +17253,25 @@ safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& safe_VkPhysicalDeviceShade
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM::safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM(
+    safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM&& move_src) noexcept
+    : safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM::operator=(
+    safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(shaderCoreMask, move_src.shaderCoreMask);
+    std::swap(shaderCoreCount, move_src.shaderCoreCount);
+    std::swap(shaderWarpsPerCore, move_src.shaderWarpsPerCore);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM::~safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM() {
     FreePnextChain(pNext);
 }
@@ -13642,6 +17335,23 @@ safe_VkLatencySleepModeInfoNV& safe_VkLatencySleepModeInfoNV::operator=(const sa
     return *this;
 }
 
+safe_VkLatencySleepModeInfoNV::safe_VkLatencySleepModeInfoNV(safe_VkLatencySleepModeInfoNV&& move_src) noexcept
+    : safe_VkLatencySleepModeInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkLatencySleepModeInfoNV& safe_VkLatencySleepModeInfoNV::operator=(safe_VkLatencySleepModeInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(lowLatencyMode, move_src.lowLatencyMode);
+    std::swap(lowLatencyBoost, move_src.lowLatencyBoost);
+    std::swap(minimumIntervalUs, move_src.minimumIntervalUs);
+
+    return *this;
+}
+
 safe_VkLatencySleepModeInfoNV::~safe_VkLatencySleepModeInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkLatencySleepModeInfoNV::initialize(const VkLatencySleepModeInfoNV* in_struct,
@@ -13694,6 +17404,21 @@ safe_VkLatencySleepInfoNV& safe_VkLatencySleepInfoNV::operator=(const safe_VkLat
     return *this;
 }
 
+safe_VkLatencySleepInfoNV::safe_VkLatencySleepInfoNV(safe_VkLatencySleepInfoNV&& move_src) noexcept : safe_VkLatencySleepInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkLatencySleepInfoNV& safe_VkLatencySleepInfoNV::operator=(safe_VkLatencySleepInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(signalSemaphore, move_src.signalSemaphore);
+    std::swap(value, move_src.value);
+
+    return *this;
+}
+
 safe_VkLatencySleepInfoNV::~safe_VkLatencySleepInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkLatencySleepInfoNV::initialize(const VkLatencySleepInfoNV* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -13742,6 +17467,22 @@ safe_VkSetLatencyMarkerInfoNV& safe_VkSetLatencyMarkerInfoNV::operator=(const sa
     return *this;
 }
 
+safe_VkSetLatencyMarkerInfoNV::safe_VkSetLatencyMarkerInfoNV(safe_VkSetLatencyMarkerInfoNV&& move_src) noexcept
+    : safe_VkSetLatencyMarkerInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkSetLatencyMarkerInfoNV& safe_VkSetLatencyMarkerInfoNV::operator=(safe_VkSetLatencyMarkerInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentID, move_src.presentID);
+    std::swap(marker, move_src.marker);
+
+    return *this;
+}
+
 safe_VkSetLatencyMarkerInfoNV::~safe_VkSetLatencyMarkerInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkSetLatencyMarkerInfoNV::initialize(const VkSetLatencyMarkerInfoNV* in_struct,
@@ -13846,6 +17587,35 @@ safe_VkLatencyTimingsFrameReportNV& safe_VkLatencyTimingsFrameReportNV::operator
     return *this;
 }
 
+safe_VkLatencyTimingsFrameReportNV::safe_VkLatencyTimingsFrameReportNV(safe_VkLatencyTimingsFrameReportNV&& move_src) noexcept
+    : safe_VkLatencyTimingsFrameReportNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkLatencyTimingsFrameReportNV& safe_VkLatencyTimingsFrameReportNV::operator=(
+    safe_VkLatencyTimingsFrameReportNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentID, move_src.presentID);
+    std::swap(inputSampleTimeUs, move_src.inputSampleTimeUs);
+    std::swap(simStartTimeUs, move_src.simStartTimeUs);
+    std::swap(simEndTimeUs, move_src.simEndTimeUs);
+    std::swap(renderSubmitStartTimeUs, move_src.renderSubmitStartTimeUs);
+    std::swap(renderSubmitEndTimeUs, move_src.renderSubmitEndTimeUs);
+    std::swap(presentStartTimeUs, move_src.presentStartTimeUs);
+    std::swap(presentEndTimeUs, move_src.presentEndTimeUs);
+    std::swap(driverStartTimeUs, move_src.driverStartTimeUs);
+    std::swap(driverEndTimeUs, move_src.driverEndTimeUs);
+    std::swap(osRenderQueueStartTimeUs, move_src.osRenderQueueStartTimeUs);
+    std::swap(osRenderQueueEndTimeUs, move_src.osRenderQueueEndTimeUs);
+    std::swap(gpuRenderStartTimeUs, move_src.gpuRenderStartTimeUs);
+    std::swap(gpuRenderEndTimeUs, move_src.gpuRenderEndTimeUs);
+
+    return *this;
+}
+
 safe_VkLatencyTimingsFrameReportNV::~safe_VkLatencyTimingsFrameReportNV() { FreePnextChain(pNext); }
 
 void safe_VkLatencyTimingsFrameReportNV::initialize(const VkLatencyTimingsFrameReportNV* in_struct,
@@ -13939,6 +17709,22 @@ safe_VkGetLatencyMarkerInfoNV& safe_VkGetLatencyMarkerInfoNV::operator=(const sa
     return *this;
 }
 
+safe_VkGetLatencyMarkerInfoNV::safe_VkGetLatencyMarkerInfoNV(safe_VkGetLatencyMarkerInfoNV&& move_src) noexcept
+    : safe_VkGetLatencyMarkerInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkGetLatencyMarkerInfoNV& safe_VkGetLatencyMarkerInfoNV::operator=(safe_VkGetLatencyMarkerInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(timingCount, move_src.timingCount);
+    std::swap(pTimings, move_src.pTimings);
+
+    return *this;
+}
+
 safe_VkGetLatencyMarkerInfoNV::~safe_VkGetLatencyMarkerInfoNV() {
     if (pTimings) delete[] pTimings;
     FreePnextChain(pNext);
@@ -14005,6 +17791,22 @@ safe_VkLatencySubmissionPresentIdNV& safe_VkLatencySubmissionPresentIdNV::operat
     return *this;
 }
 
+safe_VkLatencySubmissionPresentIdNV::safe_VkLatencySubmissionPresentIdNV(safe_VkLatencySubmissionPresentIdNV&& move_src) noexcept
+    : safe_VkLatencySubmissionPresentIdNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkLatencySubmissionPresentIdNV& safe_VkLatencySubmissionPresentIdNV::operator=(
+    safe_VkLatencySubmissionPresentIdNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentID, move_src.presentID);
+
+    return *this;
+}
+
 safe_VkLatencySubmissionPresentIdNV::~safe_VkLatencySubmissionPresentIdNV() { FreePnextChain(pNext); }
 
 void safe_VkLatencySubmissionPresentIdNV::initialize(const VkLatencySubmissionPresentIdNV* in_struct,
@@ -14053,6 +17855,22 @@ safe_VkSwapchainLatencyCreateInfoNV& safe_VkSwapchainLatencyCreateInfoNV::operat
     return *this;
 }
 
+safe_VkSwapchainLatencyCreateInfoNV::safe_VkSwapchainLatencyCreateInfoNV(safe_VkSwapchainLatencyCreateInfoNV&& move_src) noexcept
+    : safe_VkSwapchainLatencyCreateInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkSwapchainLatencyCreateInfoNV& safe_VkSwapchainLatencyCreateInfoNV::operator=(
+    safe_VkSwapchainLatencyCreateInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(latencyModeEnable, move_src.latencyModeEnable);
+
+    return *this;
+}
+
 safe_VkSwapchainLatencyCreateInfoNV::~safe_VkSwapchainLatencyCreateInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkSwapchainLatencyCreateInfoNV::initialize(const VkSwapchainLatencyCreateInfoNV* in_struct,
@@ -14099,6 +17917,21 @@ safe_VkOutOfBandQueueTypeInfoNV& safe_VkOutOfBandQueueTypeInfoNV::operator=(cons
     return *this;
 }
 
+safe_VkOutOfBandQueueTypeInfoNV::safe_VkOutOfBandQueueTypeInfoNV(safe_VkOutOfBandQueueTypeInfoNV&& move_src) noexcept
+    : safe_VkOutOfBandQueueTypeInfoNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkOutOfBandQueueTypeInfoNV& safe_VkOutOfBandQueueTypeInfoNV::operator=(safe_VkOutOfBandQueueTypeInfoNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(queueType, move_src.queueType);
+
+    return *this;
+}
+
 safe_VkOutOfBandQueueTypeInfoNV::~safe_VkOutOfBandQueueTypeInfoNV() { FreePnextChain(pNext); }
 
 void safe_VkOutOfBandQueueTypeInfoNV::initialize(const VkOutOfBandQueueTypeInfoNV* in_struct,
@@ -14164,6 +17997,23 @@ safe_VkLatencySurfaceCapabilitiesNV& safe_VkLatencySurfaceCapabilitiesNV::operat
     return *this;
 }
 
+safe_VkLatencySurfaceCapabilitiesNV::safe_VkLatencySurfaceCapabilitiesNV(safe_VkLatencySurfaceCapabilitiesNV&& move_src) noexcept
+    : safe_VkLatencySurfaceCapabilitiesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkLatencySurfaceCapabilitiesNV& safe_VkLatencySurfaceCapabilitiesNV::operator=(
+    safe_VkLatencySurfaceCapabilitiesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(presentModeCount, move_src.presentModeCount);
+    std::swap(pPresentModes, move_src.pPresentModes);
+
+    return *this;
+}
+
 safe_VkLatencySurfaceCapabilitiesNV::~safe_VkLatencySurfaceCapabilitiesNV() {
     if (pPresentModes) delete[] pPresentModes;
     FreePnextChain(pNext);
@@ -14232,6 +18082,24 @@ safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM::operator=(
     return *this;
 }
 
+safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM::safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM(
+    safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM&
+safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM::operator=(
+    safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(multiviewPerViewRenderAreas, move_src.multiviewPerViewRenderAreas);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM::~safe_VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM() {
     FreePnextChain(pNext);
 }
@@ -14304,6 +18172,24 @@ safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& safe_VkMultiviewPerVi
     return *this;
 }
 
+safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM::safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM(
+    safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM&& move_src) noexcept
+    : safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM::operator=(
+    safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(perViewRenderAreaCount, move_src.perViewRenderAreaCount);
+    std::swap(pPerViewRenderAreas, move_src.pPerViewRenderAreas);
+
+    return *this;
+}
+
 safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM::~safe_VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM() {
     if (pPerViewRenderAreas) delete[] pPerViewRenderAreas;
     FreePnextChain(pNext);
@@ -14377,6 +18263,24 @@ safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV& safe_VkPhysicalDevicePerSt
     return *this;
 }
 
+safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV::safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV(
+    safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV& safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV::operator=(
+    safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(perStageDescriptorSet, move_src.perStageDescriptorSet);
+    std::swap(dynamicPipelineLayout, move_src.dynamicPipelineLayout);
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV::~safe_VkPhysicalDevicePerStageDescriptorSetFeaturesNV() {
     FreePnextChain(pNext);
 }
@@ -14429,6 +18333,23 @@ safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM& safe_VkPhysicalDeviceImagePro
     return *this;
 }
 
+safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM::safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM(
+    safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM& safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM::operator=(
+    safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(textureBlockMatch2, move_src.textureBlockMatch2);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM::~safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceImageProcessing2FeaturesQCOM::initialize(const VkPhysicalDeviceImageProcessing2FeaturesQCOM* in_struct,
@@ -14477,6 +18398,23 @@ safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM& safe_VkPhysicalDeviceImageP
     return *this;
 }
 
+safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM::safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM(
+    safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM& safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM::operator=(
+    safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(maxBlockMatchWindow, move_src.maxBlockMatchWindow);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM::~safe_VkPhysicalDeviceImageProcessing2PropertiesQCOM() {
     FreePnextChain(pNext);
 }
@@ -14529,6 +18467,24 @@ safe_VkSamplerBlockMatchWindowCreateInfoQCOM& safe_VkSamplerBlockMatchWindowCrea
     return *this;
 }
 
+safe_VkSamplerBlockMatchWindowCreateInfoQCOM::safe_VkSamplerBlockMatchWindowCreateInfoQCOM(
+    safe_VkSamplerBlockMatchWindowCreateInfoQCOM&& move_src) noexcept
+    : safe_VkSamplerBlockMatchWindowCreateInfoQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkSamplerBlockMatchWindowCreateInfoQCOM& safe_VkSamplerBlockMatchWindowCreateInfoQCOM::operator=(
+    safe_VkSamplerBlockMatchWindowCreateInfoQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(windowExtent, move_src.windowExtent);
+    std::swap(windowCompareMode, move_src.windowCompareMode);
+
+    return *this;
+}
+
 safe_VkSamplerBlockMatchWindowCreateInfoQCOM::~safe_VkSamplerBlockMatchWindowCreateInfoQCOM() { FreePnextChain(pNext); }
 
 void safe_VkSamplerBlockMatchWindowCreateInfoQCOM::initialize(const VkSamplerBlockMatchWindowCreateInfoQCOM* in_struct,
@@ -14579,6 +18535,23 @@ safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM& safe_VkPhysicalDeviceCubicWeights
     return *this;
 }
 
+safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM::safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM(
+    safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM& safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM::operator=(
+    safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(selectableCubicWeights, move_src.selectableCubicWeights);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM::~safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceCubicWeightsFeaturesQCOM::initialize(const VkPhysicalDeviceCubicWeightsFeaturesQCOM* in_struct,
@@ -14627,6 +18600,23 @@ safe_VkSamplerCubicWeightsCreateInfoQCOM& safe_VkSamplerCubicWeightsCreateInfoQC
     return *this;
 }
 
+safe_VkSamplerCubicWeightsCreateInfoQCOM::safe_VkSamplerCubicWeightsCreateInfoQCOM(
+    safe_VkSamplerCubicWeightsCreateInfoQCOM&& move_src) noexcept
+    : safe_VkSamplerCubicWeightsCreateInfoQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkSamplerCubicWeightsCreateInfoQCOM& safe_VkSamplerCubicWeightsCreateInfoQCOM::operator=(
+    safe_VkSamplerCubicWeightsCreateInfoQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(cubicWeights, move_src.cubicWeights);
+
+    return *this;
+}
+
 safe_VkSamplerCubicWeightsCreateInfoQCOM::~safe_VkSamplerCubicWeightsCreateInfoQCOM() { FreePnextChain(pNext); }
 
 void safe_VkSamplerCubicWeightsCreateInfoQCOM::initialize(const VkSamplerCubicWeightsCreateInfoQCOM* in_struct,
@@ -14675,6 +18665,22 @@ safe_VkBlitImageCubicWeightsInfoQCOM& safe_VkBlitImageCubicWeightsInfoQCOM::oper
     return *this;
 }
 
+safe_VkBlitImageCubicWeightsInfoQCOM::safe_VkBlitImageCubicWeightsInfoQCOM(safe_VkBlitImageCubicWeightsInfoQCOM&& move_src) noexcept
+    : safe_VkBlitImageCubicWeightsInfoQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkBlitImageCubicWeightsInfoQCOM& safe_VkBlitImageCubicWeightsInfoQCOM::operator=(
+    safe_VkBlitImageCubicWeightsInfoQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(cubicWeights, move_src.cubicWeights);
+
+    return *this;
+}
+
 safe_VkBlitImageCubicWeightsInfoQCOM::~safe_VkBlitImageCubicWeightsInfoQCOM() { FreePnextChain(pNext); }
 
 void safe_VkBlitImageCubicWeightsInfoQCOM::initialize(const VkBlitImageCubicWeightsInfoQCOM* in_struct,
@@ -14723,6 +18729,23 @@ safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM& safe_VkPhysicalDeviceYcbcrDegamma
     return *this;
 }
 
+safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM::safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM(
+    safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM& safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM::operator=(
+    safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(ycbcrDegamma, move_src.ycbcrDegamma);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM::~safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceYcbcrDegammaFeaturesQCOM::initialize(const VkPhysicalDeviceYcbcrDegammaFeaturesQCOM* in_struct,
@@ -14777,6 +18800,24 @@ safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM& safe_VkSamplerYcbcrConv
     return *this;
 }
 
+safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM::safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM(
+    safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM&& move_src) noexcept
+    : safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM& safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM::operator=(
+    safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(enableYDegamma, move_src.enableYDegamma);
+    std::swap(enableCbCrDegamma, move_src.enableCbCrDegamma);
+
+    return *this;
+}
+
 safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM::~safe_VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM() {
     FreePnextChain(pNext);
 }
@@ -14829,6 +18870,23 @@ safe_VkPhysicalDeviceCubicClampFeaturesQCOM& safe_VkPhysicalDeviceCubicClampFeat
     return *this;
 }
 
+safe_VkPhysicalDeviceCubicClampFeaturesQCOM::safe_VkPhysicalDeviceCubicClampFeaturesQCOM(
+    safe_VkPhysicalDeviceCubicClampFeaturesQCOM&& move_src) noexcept
+    : safe_VkPhysicalDeviceCubicClampFeaturesQCOM() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceCubicClampFeaturesQCOM& safe_VkPhysicalDeviceCubicClampFeaturesQCOM::operator=(
+    safe_VkPhysicalDeviceCubicClampFeaturesQCOM&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(cubicRangeClamp, move_src.cubicRangeClamp);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCubicClampFeaturesQCOM::~safe_VkPhysicalDeviceCubicClampFeaturesQCOM() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceCubicClampFeaturesQCOM::initialize(const VkPhysicalDeviceCubicClampFeaturesQCOM* in_struct,
@@ -14878,6 +18936,23 @@ safe_VkScreenBufferPropertiesQNX& safe_VkScreenBufferPropertiesQNX::operator=(co
     return *this;
 }
 
+safe_VkScreenBufferPropertiesQNX::safe_VkScreenBufferPropertiesQNX(safe_VkScreenBufferPropertiesQNX&& move_src) noexcept
+    : safe_VkScreenBufferPropertiesQNX() {
+    *this = std::move(move_src);
+}
+
+safe_VkScreenBufferPropertiesQNX& safe_VkScreenBufferPropertiesQNX::operator=(
+    safe_VkScreenBufferPropertiesQNX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(allocationSize, move_src.allocationSize);
+    std::swap(memoryTypeBits, move_src.memoryTypeBits);
+
+    return *this;
+}
+
 safe_VkScreenBufferPropertiesQNX::~safe_VkScreenBufferPropertiesQNX() { FreePnextChain(pNext); }
 
 void safe_VkScreenBufferPropertiesQNX::initialize(const VkScreenBufferPropertiesQNX* in_struct,
@@ -14964,6 +19039,31 @@ safe_VkScreenBufferFormatPropertiesQNX& safe_VkScreenBufferFormatPropertiesQNX::
     return *this;
 }
 
+safe_VkScreenBufferFormatPropertiesQNX::safe_VkScreenBufferFormatPropertiesQNX(
+    safe_VkScreenBufferFormatPropertiesQNX&& move_src) noexcept
+    : safe_VkScreenBufferFormatPropertiesQNX() {
+    *this = std::move(move_src);
+}
+
+safe_VkScreenBufferFormatPropertiesQNX& safe_VkScreenBufferFormatPropertiesQNX::operator=(
+    safe_VkScreenBufferFormatPropertiesQNX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(format, move_src.format);
+    std::swap(externalFormat, move_src.externalFormat);
+    std::swap(screenUsage, move_src.screenUsage);
+    std::swap(formatFeatures, move_src.formatFeatures);
+    std::swap(samplerYcbcrConversionComponents, move_src.samplerYcbcrConversionComponents);
+    std::swap(suggestedYcbcrModel, move_src.suggestedYcbcrModel);
+    std::swap(suggestedYcbcrRange, move_src.suggestedYcbcrRange);
+    std::swap(suggestedXChromaOffset, move_src.suggestedXChromaOffset);
+    std::swap(suggestedYChromaOffset, move_src.suggestedYChromaOffset);
+
+    return *this;
+}
+
 safe_VkScreenBufferFormatPropertiesQNX::~safe_VkScreenBufferFormatPropertiesQNX() { FreePnextChain(pNext); }
 
 void safe_VkScreenBufferFormatPropertiesQNX::initialize(const VkScreenBufferFormatPropertiesQNX* in_struct,
@@ -15038,6 +19138,22 @@ safe_VkImportScreenBufferInfoQNX& safe_VkImportScreenBufferInfoQNX::operator=(co
     return *this;
 }
 
+safe_VkImportScreenBufferInfoQNX::safe_VkImportScreenBufferInfoQNX(safe_VkImportScreenBufferInfoQNX&& move_src) noexcept
+    : safe_VkImportScreenBufferInfoQNX() {
+    *this = std::move(move_src);
+}
+
+safe_VkImportScreenBufferInfoQNX& safe_VkImportScreenBufferInfoQNX::operator=(
+    safe_VkImportScreenBufferInfoQNX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(buffer, move_src.buffer);
+
+    return *this;
+}
+
 safe_VkImportScreenBufferInfoQNX::~safe_VkImportScreenBufferInfoQNX() {
     if (buffer) delete buffer;
     FreePnextChain(pNext);
@@ -15096,6 +19212,20 @@ safe_VkExternalFormatQNX& safe_VkExternalFormatQNX::operator=(const safe_VkExter
     return *this;
 }
 
+safe_VkExternalFormatQNX::safe_VkExternalFormatQNX(safe_VkExternalFormatQNX&& move_src) noexcept : safe_VkExternalFormatQNX() {
+    *this = std::move(move_src);
+}
+
+safe_VkExternalFormatQNX& safe_VkExternalFormatQNX::operator=(safe_VkExternalFormatQNX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(externalFormat, move_src.externalFormat);
+
+    return *this;
+}
+
 safe_VkExternalFormatQNX::~safe_VkExternalFormatQNX() { FreePnextChain(pNext); }
 
 void safe_VkExternalFormatQNX::initialize(const VkExternalFormatQNX* in_struct, [[maybe_unused]] PNextCopyState* copy_state) {
@@ -15143,6 +19273,23 @@ safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX& safe_VkPhysicalDevic
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX::safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX(
+    safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX&& move_src) noexcept
+    : safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX& safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX::operator=(
+    safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(screenBufferImport, move_src.screenBufferImport);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX::~safe_VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX() {
     FreePnextChain(pNext);
 }
@@ -15194,6 +19341,23 @@ safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT& safe_VkPhysicalDeviceLayeredDr
     return *this;
 }
 
+safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT::safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT(
+    safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT&& move_src) noexcept
+    : safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT& safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT::operator=(
+    safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(underlyingAPI, move_src.underlyingAPI);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT::~safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT() { FreePnextChain(pNext); }
 
 void safe_VkPhysicalDeviceLayeredDriverPropertiesMSFT::initialize(const VkPhysicalDeviceLayeredDriverPropertiesMSFT* in_struct,
@@ -15245,6 +19409,23 @@ safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV& safe_VkPhysicalDevi
     return *this;
 }
 
+safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV::safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV(
+    safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV&& move_src) noexcept
+    : safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV() {
+    *this = std::move(move_src);
+}
+
+safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV& safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV::operator=(
+    safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV&& move_src) noexcept {
+    if (&move_src == this) return *this;
+
+    std::swap(sType, move_src.sType);
+    std::swap(pNext, move_src.pNext);
+    std::swap(descriptorPoolOverallocation, move_src.descriptorPoolOverallocation);
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV::~safe_VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV() {
     FreePnextChain(pNext);
 }
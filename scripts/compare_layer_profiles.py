@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 The Khronos Group Inc.
+# Copyright (c) 2024 Valve Corporation
+# Copyright (c) 2024 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Compares the layer overhead of two or more layer builds on the same workload, from the CSV written with the
+# khronos_validation.profile_layer_file setting (see layers/utils/layer_profiler.h).
+#
+# Either compare files that already exist:
+#
+#   python3 scripts/compare_layer_profiles.py baseline.csv patched.csv
+#
+# or replay a capture under each build, with the layer enabled and profiling on, and compare the runs. The replay is
+# typically gfxrecon-replay on a GFXReconstruct capture, run against the mock ICD to leave the driver out of the numbers:
+#
+#   python3 scripts/compare_layer_profiles.py --layer-path build-main/layers --layer-path build-patch/layers \
+#       --runs 3 -- gfxrecon-replay capture.gfxr
+import argparse
+import collections
+import csv
+import os
+import subprocess
+import sys
+import tempfile
+
+# (function, object, phase) -> [calls, nanoseconds]
+def read_profile(path):
+    entries = collections.defaultdict(lambda: [0, 0.0])
+    with open(path, newline='') as file:
+        for row in csv.DictReader(file):
+            key = (row['function'], row['object'], row['phase'])
+            entries[key][0] += int(row['calls'])
+            entries[key][1] += float(row['nanoseconds'])
+    return entries
+
+def run_profile(layer_path, command, runs, output_dir, index):
+    path = os.path.join(output_dir, f'profile_{index}.csv')
+    if os.path.exists(path):
+        os.remove(path)
+    env = dict(os.environ)
+    env['VK_LAYER_PATH'] = layer_path
+    env['VK_INSTANCE_LAYERS'] = 'VK_LAYER_KHRONOS_validation'
+    env['VK_KHRONOS_VALIDATION_PROFILE_LAYER'] = 'true'
+    env['VK_KHRONOS_VALIDATION_PROFILE_LAYER_FILE'] = path
+    for _ in range(runs):
+        subprocess.run(command, env=env, check=True)
+    if not os.path.exists(path):
+        sys.exit(f'{layer_path}: no profile was written to {path}, is the layer built with profiling support?')
+    profile = read_profile(path)
+    # Average over the runs, calls included so mismatched call counts still show up
+    for entry in profile.values():
+        entry[0] //= runs
+        entry[1] /= runs
+    return profile
+
+def ms(nanoseconds):
+    return nanoseconds / 1e6
+
+def compare(names, profiles, top):
+    baseline = profiles[0]
+    keys = set()
+    for profile in profiles:
+        keys.update(profile.keys())
+
+    print('Total layer time (ms):')
+    base_total = sum(entry[1] for entry in baseline.values())
+    for name, profile in zip(names, profiles):
+        total = sum(entry[1] for entry in profile.values())
+        change = f'{(total - base_total) / base_total * 100.0:+.1f}%' if base_total else '-'
+        print(f'  {ms(total):12.3f}  {change:>8}  {name}')
+
+    for name, profile in zip(names[1:], profiles[1:]):
+        print(f'\nLargest changes of {name} against {names[0]} (ms, calls):')
+        delta = []
+        for key in keys:
+            before = baseline.get(key, [0, 0.0])
+            after = profile.get(key, [0, 0.0])
+            delta.append((after[1] - before[1], key, before, after))
+        delta.sort(key=lambda item: abs(item[0]), reverse=True)
+        print(f'  {"delta":>10} {"before":>10} {"after":>10} {"calls":>16}  function / object / phase')
+        for difference, key, before, after in delta[:top]:
+            calls = f'{before[0]}' if before[0] == after[0] else f'{before[0]}->{after[0]}'
+            print(f'  {ms(difference):+10.3f} {ms(before[1]):10.3f} {ms(after[1]):10.3f} {calls:>16}  {" / ".join(key)}')
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Compare layer overhead profiles of different layer builds')
+    parser.add_argument('profiles', nargs='*', help='CSV files written with khronos_validation.profile_layer_file')
+    parser.add_argument('--layer-path', action='append', default=[],
+                        help='Directory holding a layer build and its manifest, may be repeated')
+    parser.add_argument('--runs', type=int, default=1, help='Runs of the command per layer build, averaged')
+    parser.add_argument('--top', type=int, default=30, help='Number of entries listed per comparison')
+    command = []
+    if '--' in argv:
+        split = argv.index('--')
+        argv, command = argv[:split], argv[split + 1:]
+    args = parser.parse_args(argv)
+
+    if args.layer_path:
+        if not command:
+            parser.error('--layer-path needs a command to run after --')
+        if args.profiles:
+            parser.error('either compare CSV files or run a command, not both')
+        with tempfile.TemporaryDirectory() as output_dir:
+            profiles = [run_profile(os.path.abspath(path), command, args.runs, output_dir, index)
+                        for index, path in enumerate(args.layer_path)]
+        names = args.layer_path
+    else:
+        if len(args.profiles) < 2:
+            parser.error('at least two profiles are needed')
+        profiles = [read_profile(path) for path in args.profiles]
+        names = args.profiles
+
+    compare(names, profiles, args.top)
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
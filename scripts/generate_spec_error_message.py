@@ -247,7 +247,7 @@ def GenerateSpecErrorMessage(api : str, valid_usage_json : str, out_file : str):
 
 // clang-format off
 
-// Mapping from VUID string to the corresponding spec text
+// Mapping from VUID string to the corresponding spec text, sorted by VUID (in strcmp order) for binary search
 typedef struct _vuid_spec_text_pair {{
     const char * vuid;
     const char * spec_text;
@@ -255,6 +255,7 @@ typedef struct _vuid_spec_text_pair {{
 }} vuid_spec_text_pair;
 \n''')
 
+    # VUIDs are ASCII, so this is also the std::string_view order the layer binary searches with
     vuid_list = list(val_json.all_vuids)
     vuid_list.sort()
     minor_version = int(val_json.api_version.split('.')[1])
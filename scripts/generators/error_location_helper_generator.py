@@ -97,6 +97,9 @@ class ErrorLocationHelperOutputGenerator(BaseGenerator):
         for index, command in enumerate(sorted(self.vk.commands.values()), start=1):
             out.append(f'    {command.name} = {index},\n')
         out.append('};\n')
+        out.append('\n')
+        out.append('// Number of Func values, including Empty\n')
+        out.append(f'static constexpr uint32_t kFuncCount = {len(self.vk.commands) + 1};\n')
 
         out.append('\n')
         out.append('enum class Struct {\n')
@@ -114,6 +114,19 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
                     return True
         return False
 
+    def isExtendedByNonDispatchableObject(self, structName: str) -> bool:
+        struct = self.vk.structs[structName]
+        return struct.extendedBy and any(x in self.ndo_extension_structs for x in struct.extendedBy)
+
+    # Struct whose only handles can come from its own pNext chain. These only need a local copy if the chain actually
+    # has a handle-bearing struct in it, which is checked at runtime with PnextChainContainsHandles()
+    def isPnextOnlyHandleStruct(self, structName: str) -> bool:
+        if self.containsNonDispatchableObject(structName) or not self.isExtendedByNonDispatchableObject(structName):
+            return False
+        struct = self.vk.structs[structName]
+        return not any(self.isExtendedByNonDispatchableObject(x.type) for x in struct.members
+                       if x.type in self.vk.structs and x.type != structName)
+
     # Now that the data is all collected and complete, generate and output the wrapping/unwrapping routines
     def generate(self):
         self.write(f'''// *** THIS FILE IS GENERATED - DO NOT EDIT ***
@@ -158,6 +171,19 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             class ValidationObject;
             void WrapPnextChainHandles(ValidationObject *layer_data, const void *pNext);
 
+            // Returns true if any struct in the pNext chain contains handles that need unwrapping
+            bool PnextChainContainsHandles(const void *pNext);
+
+            template <typename T>
+            bool PnextChainContainsHandles(const T *structs, uint32_t count) {
+                for (uint32_t i = 0; i < count; ++i) {
+                    if (PnextChainContainsHandles(structs[i].pNext)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
             ''')
         guard_helper = PlatformGuardHelper()
         for command in self.vk.commands.values():
@@ -185,6 +211,7 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             #include "layer_chassis_dispatch.h"
             #include "vk_safe_struct.h"
             #include "state_tracker/pipeline_state.h"
+            #include "containers/scratch_arena.h"
 
             #define DISPATCH_MAX_STACK_ALLOCATIONS 32
 
@@ -197,11 +224,13 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
                     switch (header->sType) {
             ''')
         guard_helper = PlatformGuardHelper()
+        handle_struct_types = []
         for struct in [self.vk.structs[x] for x in self.ndo_extension_structs]:
             (api_decls, api_pre, api_post) = self.uniquifyMembers(struct.members, 'safe_struct->', 0, False, False, False)
             # Only process extension structs containing handles
             if not api_pre:
                 continue
+            handle_struct_types.append(struct)
             out.extend(guard_helper.add_guard(struct.protect))
             out.append(f'case {struct.sType}: {{\n')
             out.append(f'    safe_{struct.name} *safe_struct = reinterpret_cast<safe_{struct.name} *>(cur_pnext);\n')
@@ -217,6 +246,23 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
                 cur_pnext = header->pNext;
             }
             }
+
+            bool PnextChainContainsHandles(const void *pNext) {
+                for (auto header = reinterpret_cast<const VkBaseInStructure *>(pNext); header != nullptr; header = header->pNext) {
+                    switch (header->sType) {
+            ''')
+        for struct in handle_struct_types:
+            out.extend(guard_helper.add_guard(struct.protect))
+            out.append(f'case {struct.sType}:\n')
+        out.extend(guard_helper.add_guard(None))
+        out.append('''
+                            return true;
+                        default:
+                            break;
+                    }
+                }
+                return false;
+            }
             ''')
         for command in [x for x in self.vk.commands.values() if x.name not in self.no_autogen_list]:
             out.extend(guard_helper.add_guard(command.protect))
@@ -258,6 +304,8 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
                             {param.name} = ({param.type})0;
                         }}'''
             (api_decls, api_pre, api_post) = self.uniquifyMembers(command.params, '', 0, isCreate, isDestroy, True)
+            if 'dispatch_scratch.' in api_pre:
+                api_decls = f'vvl::ScratchArena::Scope dispatch_scratch;\n{api_decls}'
             api_post += create_ndo_code
             if isDestroy:
                 api_pre += destroy_ndo_code
@@ -284,7 +332,10 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
                 isExtended = struct and struct.extendedBy and any(x in self.ndo_extension_structs for x in struct.extendedBy)
                 if isLocal or isExtended:
                     if param.pointer:
-                        if param.const:
+                        if param.const and not isLocal and self.isPnextOnlyHandleStruct(struct.name):
+                          # No local copy is made if the pNext chain has nothing to unwrap
+                          wrapped_paramstext = wrapped_paramstext.replace(param.name, f'local_{param.name} ? (const {param.type}*)local_{param.name} : {param.name}')
+                        elif param.const:
                           wrapped_paramstext = wrapped_paramstext.replace(param.name, f'(const {param.type}*)local_{param.name}')
                         else:
                           wrapped_paramstext = wrapped_paramstext.replace(param.name, f'({param.type}*)local_{param.name}')
@@ -330,6 +381,9 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
             delete_var = f'local_{prefix}{name}'
             if len is None:
                 delete_code = f'delete {delete_var}'
+            elif deferred_name is None:
+                # Non-deferred arrays live in the per-call scratch arena
+                delete_code = f'dispatch_scratch.DeleteArray({delete_var}, {prefix}{len})'
             else:
                 delete_code = f'delete[] {delete_var}'
             cleanup = f'if ({delete_var}) {{\n'
@@ -416,9 +470,15 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
                             decls += f'{safe_type} *{new_prefix} = nullptr;\n'
                         else:
                             new_prefix = f'{prefix}{member.name}'
-                        pre_code += f'if ({prefix}{member.name}) {{\n'
+                        if topLevel and member.const and self.isPnextOnlyHandleStruct(member.type):
+                            pre_code += f'if ({member.name} && PnextChainContainsHandles({member.name}, {member.length})) {{\n'
+                        else:
+                            pre_code += f'if ({prefix}{member.name}) {{\n'
                         if topLevel:
-                            pre_code += f'{new_prefix} = new {safe_type}[{member.length}];\n'
+                            if deferred_name is None:
+                                pre_code += f'{new_prefix} = dispatch_scratch.NewArray<{safe_type}>({member.length});\n'
+                            else:
+                                pre_code += f'{new_prefix} = new {safe_type}[{member.length}];\n'
                         pre_code += f'for (uint32_t {index} = 0; {index} < {prefix}{member.length}; ++{index}) {{\n'
                         if topLevel:
                             if 'safe_' in safe_type:
@@ -454,7 +514,10 @@ class LayerChassisDispatchOutputGenerator(BaseGenerator):
                         else:
                             new_prefix = f'{prefix}{member.name}->'
                         # Declare safe_VarType for struct
-                        pre_code += f'if ({prefix}{member.name}) {{\n'
+                        if topLevel and member.const and self.isPnextOnlyHandleStruct(member.type):
+                            pre_code += f'if ({member.name} && PnextChainContainsHandles({member.name}->pNext)) {{\n'
+                        else:
+                            pre_code += f'if ({prefix}{member.name}) {{\n'
                         if topLevel:
                             if deferred_name is None:
                                 pre_code += f'local_{prefix}{member.name} = &var_local_{prefix}{member.name};\n'
@@ -44,41 +44,49 @@ class APISpecific:
                     {
                         'include': 'thread_tracker/thread_safety_validation.h',
                         'class': 'ThreadSafety',
+                        'build_macro': 'VVL_BUILD_THREAD_SAFETY',
                         'enabled': '!disables[thread_safety]'
                     },
                     {
                         'include': 'stateless/stateless_validation.h',
                         'class': 'StatelessValidation',
+                        'build_macro': 'VVL_BUILD_STATELESS',
                         'enabled': '!disables[stateless_checks]'
                     },
                     {
                         'include': 'object_tracker/object_lifetime_validation.h',
                         'class': 'ObjectLifetimes',
+                        'build_macro': 'VVL_BUILD_OBJECT_LIFETIMES',
                         'enabled': '!disables[object_tracking]'
                     },
                     {
                         'include': 'core_checks/core_validation.h',
                         'class': 'CoreChecks',
+                        'build_macro': 'VVL_BUILD_CORE_CHECKS',
                         'enabled': '!disables[core_checks]'
                     },
                     {
                         'include': 'best_practices/best_practices_validation.h',
                         'class': 'BestPractices',
+                        'build_macro': 'VVL_BUILD_BEST_PRACTICES',
                         'enabled': 'enables[best_practices]'
                     },
                     {
                         'include': 'gpu_validation/gpu_validation.h',
                         'class': 'gpuav::Validator',
+                        'build_macro': 'VVL_BUILD_GPU_VALIDATION',
                         'enabled': 'enables[gpu_validation]'
                     },
                     {
                         'include': 'gpu_validation/debug_printf.h',
                         'class': 'debug_printf::Validator',
+                        'build_macro': 'VVL_BUILD_DEBUG_PRINTF',
                         'enabled': 'enables[debug_printf_validation]'
                     },
                     {
                         'include': 'sync/sync_validation.h',
                         'class': 'SyncValidator',
+                        'build_macro': 'VVL_BUILD_SYNC_VALIDATION',
                         'enabled': 'enables[sync_validation]'
                     }
                 ]
@@ -217,6 +225,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
         'vkCreateShadersEXT',
         'vkAllocateDescriptorSets',
         'vkCreateBuffer',
+        'vkQueueSubmit',
+        'vkQueueSubmit2',
+        'vkQueueSubmit2KHR',
         # ValidationCache functions do not get dispatched
         'vkCreateValidationCacheEXT',
         'vkDestroyValidationCacheEXT',
@@ -226,6 +237,25 @@ class LayerChassisOutputGenerator(BaseGenerator):
         'vkGetPhysicalDeviceToolPropertiesEXT',
     ]
 
+    # With async_message_delivery, these flush the queued messages when they return VK_ERROR_DEVICE_LOST
+    # (vkQueueSubmit* are manual functions and do it in their own body)
+    commands_flushing_on_device_loss = [
+        'vkQueueWaitIdle',
+        'vkDeviceWaitIdle',
+        'vkWaitForFences',
+        'vkGetFenceStatus',
+        'vkGetEventStatus',
+        'vkGetQueryPoolResults',
+        'vkQueueBindSparse',
+        'vkWaitSemaphores',
+        'vkWaitSemaphoresKHR',
+        'vkGetSemaphoreCounterValue',
+        'vkGetSemaphoreCounterValueKHR',
+        'vkQueuePresentKHR',
+        'vkAcquireNextImageKHR',
+        'vkAcquireNextImage2KHR',
+    ]
+
     def __init__(self):
         BaseGenerator.__init__(self)
 
@@ -303,19 +333,29 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "utils/cast_utils.h"
             #include "vk_layer_config.h"
             #include "containers/custom_containers.h"
+            #include "containers/handle_translation_map.h"
+            #include "containers/layer_data_map.h"
             #include "error_message/logging.h"
             #include "error_message/error_location.h"
             #include "error_message/record_object.h"
             #include "vk_object_types.h"
             #include "utils/vk_layer_extension_utils.h"
             #include "utils/vk_layer_utils.h"
+            #include "utils/layer_profiler.h"
+            #include "utils/memory_footprint.h"
             #include "vk_dispatch_table_helper.h"
             #include "vk_extension_helper.h"
             #include "vk_safe_struct.h"
             #include "gpu_validation/gpu_settings.h"
+            #include "sync/sync_settings.h"
 
             extern std::atomic<uint64_t> global_unique_id;
 
+            // Shard count (log2) of the unique id -> driver handle table. Each shard has its own writer lock; lookups are lock-free.
+            #ifndef VVL_UNIQUE_ID_MAPPING_SHARDS_LOG2
+            #define VVL_UNIQUE_ID_MAPPING_SHARDS_LOG2 4
+            #endif
+
             // To avoid re-hashing unique ids on each use, we precompute the hash and store the
             // hash's LSBs in the high 24 bits.
             struct HashedUint64 {
@@ -329,7 +369,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
             };
 
-            extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            extern vvl::HandleTranslationMap<VVL_UNIQUE_ID_MAPPING_SHARDS_LOG2> unique_id_mapping;
 
             VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char* funcName);\n
             ''')
@@ -421,6 +461,18 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 vendor_specific_nvidia,
                 debug_printf_validation,
                 sync_validation,
+                batch_draw_validation,
+                async_submit_validation,
+                layer_profiling,
+                memory_report,
+                async_shader_validation,
+                shared_queue_retirement,
+                create_info_cache,
+                async_message_delivery,
+                async_error_messages,
+                best_practices_frame_summary,
+                check_profiling,
+                deferred_state_destruction,
                 // Insert new enables above this line
                 kMaxEnableFlags,
             } EnableFlags;
@@ -456,6 +508,11 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 CHECK_ENABLED enabled = {};
                 bool fine_grained_locking{true};
                 GpuAVSettings gpuav_settings = {};
+                SyncValSettings syncval_settings = {};
+                // Thread safety only tracks 1 in thread_safety_sample_rate objects
+                uint32_t thread_safety_sample_rate{1};
+                // Submit time validation is only done on the queues of these families, on every queue when empty
+                std::vector<uint32_t> validated_queue_families;
 
                 VkInstance instance = VK_NULL_HANDLE;
                 VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -483,6 +540,56 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
                 virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
 
+                // Set when ReadLock()/WriteLock() never acquire validation_object_mutex (the object synchronizes its own state).
+                // The chassis then skips the virtual lock call and the guard entirely on every intercepted entry point.
+                bool internally_synchronized{false};
+                void CacheLockingMode() { internally_synchronized = !ReadLock().owns_lock(); }
+                ReadLockGuard DispatchReadLock() const { return internally_synchronized ? ReadLockGuard() : ReadLock(); }
+                WriteLockGuard DispatchWriteLock() { return internally_synchronized ? WriteLockGuard() : WriteLock(); }
+
+                // Only created on the instance and device interceptors when khronos_validation.profile_layer is enabled
+                std::unique_ptr<vvl::LayerProfiler> profiler;
+                // The reports of the profiler are also appended there as CSV, see khronos_validation.profile_layer_file
+                std::string profile_layer_file;
+                // Times one phase of an intercepted call, intercept is null for the Dispatch phase. The validation of an object with a
+                // budget_family is also timed against it.
+                vvl::ProfileScope Profile(vvl::ProfilePhase phase, vvl::Func func, const ValidationObject* intercept = nullptr) const {
+                    const uint32_t object_slot = intercept ? static_cast<uint32_t>(intercept->container_type) : 0u;
+                    if (intercept && phase == vvl::ProfilePhase::Validate) {
+                        return vvl::ProfileScope(profiler.get(), func, object_slot, phase, intercept->validation_budget.get(),
+                                                 intercept->budget_family);
+                    }
+                    return vvl::ProfileScope(profiler.get(), func, object_slot, phase);
+                }
+
+                // Only created when khronos_validation.profile_validation_checks is enabled, shared by the objects of a device
+                std::shared_ptr<vvl::CheckProfiler> check_profiler;
+                vvl::CheckScope ProfileCheck(vvl::ValidationCheck check) const {
+                    return vvl::CheckScope(check_profiler.get(), check, validation_budget.get());
+                }
+
+                // Set on the instance interceptor from khronos_validation.validation_budget
+                vvl::ValidationBudgetSettings validation_budget_settings;
+                // Only created when khronos_validation.validation_budget is set, shared by the objects of a device
+                std::shared_ptr<vvl::ValidationBudget> validation_budget;
+                // The family all of the validation of this object is shed as, for the objects whose validation never prepares state for
+                // their record phase. The chassis then skips the object while its family is shed.
+                vvl::CheckFamily budget_family{vvl::CheckFamily::Count};
+                bool IsCheckShed(vvl::CheckFamily family) const { return validation_budget && validation_budget->IsShed(family); }
+
+                bool IsQueueFamilyValidated(uint32_t queue_family_index) const {
+                    if (validated_queue_families.empty()) return true;
+                    return std::find(validated_queue_families.begin(), validated_queue_families.end(), queue_family_index) !=
+                           validated_queue_families.end();
+                }
+
+                // Only created on the device interceptor when khronos_validation.memory_report is enabled
+                std::unique_ptr<vvl::MemoryReportTrigger> memory_report_trigger;
+                // Queue submissions between periodic memory reports, set on the instance interceptor
+                uint32_t memory_report_interval{0};
+                // Adds the host memory held by this validation object, called with its read lock held
+                virtual void CollectMemoryFootprint(vvl::MemoryFootprint& footprint) const {}
+
                 // If the Record phase calls a function that blocks, we might need to release
                 // the lock that protects Record itself in order to avoid mutual waiting.
                 static thread_local WriteLockGuard* record_guard;
@@ -749,18 +856,39 @@ class LayerChassisOutputGenerator(BaseGenerator):
             PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj);
         };
 
+        // Allow modification of the down-chain submits and fence for QueueSubmit/QueueSubmit2
+        virtual void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PostCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, void* qs_state) {
+            PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+        };
+
         // Modify a parameter to CreateDevice
         virtual void PreCallRecordCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, const RecordObject& record_obj, void *modified_create_info) {
             PreCallRecordCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice, record_obj);
         };
 
+        // Whether the value is a core token of the enum or one added by an extension enabled on the device
         template <typename T>
-        std::vector<T> ValidParamValues() const;
+        bool IsValidEnumValue(T value) const;
 };
 // clang-format on
 ''')
 
-        out.append('extern small_unordered_map<void*, ValidationObject*, 2> layer_data_map;')
+        out.append('extern vvl::LayerDataMap<ValidationObject> layer_data_map;')
         out.append('\n#include "valid_enum_values.h"')
         self.write("".join(out))
 
@@ -777,13 +905,13 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             thread_local WriteLockGuard* ValidationObject::record_guard{};
 
-            small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
+            vvl::LayerDataMap<ValidationObject> layer_data_map;
 
             // Global unique object identifier.
             std::atomic<uint64_t> global_unique_id(1ULL);
             // Map uniqueID to actual object handle. Accesses to the map itself are
             // internally synchronized.
-            vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            vvl::HandleTranslationMap<VVL_UNIQUE_ID_MAPPING_SHARDS_LOG2> unique_id_mapping;
 
             bool wrap_handles = true;
 
@@ -796,6 +924,13 @@ class LayerChassisOutputGenerator(BaseGenerator):
             out.append(f'#include "{layer["include"]}"\n')
         out.append('\n')
 
+        out.append('// Validation objects left out of VVL_VALIDATION_OBJECTS (see layers/CMakeLists.txt) are never instantiated\n')
+        for layer in APISpecific.getValidationLayerList(self.targetApiName):
+            out.append(f'#ifndef {layer["build_macro"]}\n')
+            out.append(f'#define {layer["build_macro"]} 1\n')
+            out.append('#endif\n')
+        out.append('\n')
+
         out.append('// This header file must be included after the above validation object class definitions\n')
         out.append('#include "chassis_dispatch_helper.h"\n')
         out.append('\n')
@@ -826,9 +961,11 @@ class LayerChassisOutputGenerator(BaseGenerator):
             constructor = layer['class']
             constructor += '(nullptr)' if layer['class'] == 'ThreadSafety' else ''
             out.append(f'''
+                #if {layer["build_macro"]}
                 if ({layer["enabled"]}) {{
                     object_dispatch.emplace_back(new {constructor});
-                }}''')
+                }}
+                #endif''')
         out.append('\n')
         out.append('    return object_dispatch;\n')
         out.append('}\n')
@@ -845,9 +982,11 @@ class LayerChassisOutputGenerator(BaseGenerator):
             if layer['class'] == 'ThreadSafety':
                 constructor += '(instance_interceptor->GetValidationObject<ThreadSafety>())'
             out.append(f'''
+                #if {layer["build_macro"]}
                 if ({layer["enabled"]}) {{
                     device_interceptor->object_dispatch.emplace_back(new {constructor});
-                }}''')
+                }}
+                #endif''')
         out.append('\n')
         out.append('}\n')
 
@@ -877,6 +1016,99 @@ class LayerChassisOutputGenerator(BaseGenerator):
             template ObjectLifetimes* ValidationObject::GetValidationObject<ObjectLifetimes>() const;
             template CoreChecks* ValidationObject::GetValidationObject<CoreChecks>() const;
 
+            // Names used by the profile_layer and memory_report reports, indexed by LayerObjectTypeId
+            static const std::array<const char*, LayerObjectTypeMaxEnum> kLayerObjectNames = {
+                "Instance",
+                "Device",
+                "Threading",
+                "ParameterValidation",
+                "ObjectTracker",
+                "CoreValidation",
+                "BestPractices",
+                "GpuAssisted",
+                "DebugPrintf",
+                "SyncValidation",
+            };
+
+            static std::unique_ptr<vvl::LayerProfiler> CreateLayerProfiler() {
+                return std::make_unique<vvl::LayerProfiler>(std::vector<std::string>(kLayerObjectNames.begin(), kLayerObjectNames.end()));
+            }
+
+            static void ReportLayerProfile(const ValidationObject* layer_data, const LogObjectList& objlist, const Location& loc) {
+                if (layer_data->profiler) {
+                    layer_data->LogInfo("UNASSIGNED-LayerProfiler-Report", objlist, loc, "%s", layer_data->profiler->Report().c_str());
+                    if (!layer_data->profile_layer_file.empty()) {
+                        const char* scope = layer_data->container_type == LayerObjectTypeInstance ? "instance" : "device";
+                        layer_data->profiler->AppendCsv(layer_data->profile_layer_file, scope);
+                    }
+                }
+            }
+
+            // The top offenders among the timed validation checks, once the device has been destroyed
+            static void ReportCheckProfile(const ValidationObject* layer_data, const LogObjectList& objlist, const Location& loc) {
+                if (layer_data->check_profiler) {
+                    layer_data->LogInfo("UNASSIGNED-CheckProfiler-Report", objlist, loc, "%s", layer_data->check_profiler->Report().c_str());
+                }
+            }
+
+            // Every present ends a frame of the validation budget, what it sheds or restores is logged when it changes
+            static void ProcessValidationBudgetFrame(const ValidationObject* layer_data, const LogObjectList& objlist, const Location& loc) {
+                if (layer_data->validation_budget) {
+                    const auto frame = layer_data->validation_budget->EndFrame();
+                    if (frame.Changed()) {
+                        layer_data->LogInfo("UNASSIGNED-ValidationBudget-Shed", objlist, loc, "%s", frame.Describe().c_str());
+                    }
+                }
+            }
+
+            static void ReportValidationBudget(const ValidationObject* layer_data, const LogObjectList& objlist, const Location& loc) {
+                if (layer_data->validation_budget) {
+                    layer_data->LogInfo("UNASSIGNED-ValidationBudget-Report", objlist, loc, "%s",
+                                        layer_data->validation_budget->Report().c_str());
+                }
+            }
+
+            // Logs one message per validation object that holds state, before the device is destroyed or on demand
+            static void ReportMemoryFootprint(const ValidationObject* layer_data, const LogObjectList& objlist, const Location& loc) {
+                if (!layer_data->memory_report_trigger) {
+                    return;
+                }
+                for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    vvl::MemoryFootprint footprint;
+                    {
+                        auto lock = intercept->DispatchReadLock();
+                        intercept->CollectMemoryFootprint(footprint);
+                    }
+                    if (!footprint.Empty()) {
+                        layer_data->LogInfo("UNASSIGNED-MemoryFootprint-Report", objlist, loc, "%s",
+                                            footprint.Report(kLayerObjectNames[intercept->container_type]).c_str());
+                    }
+                }
+            }
+
+            static void ProcessMemoryReportSubmit(const ValidationObject* layer_data, const LogObjectList& objlist, const Location& loc) {
+                if (layer_data->memory_report_trigger && layer_data->memory_report_trigger->CountSubmit()) {
+                    ReportMemoryFootprint(layer_data, objlist, loc);
+                }
+            }
+
+            // Inserting a debug utils label with one of these names logs the matching report. The profiler also starts a new profile.
+            static constexpr const char* kLayerProfilerReportLabel = "VVL-LayerProfilerReport";
+            static constexpr const char* kMemoryFootprintReportLabel = "VVL-MemoryFootprintReport";
+
+            static void ProcessLayerReportLabel(const ValidationObject* layer_data, const LogObjectList& objlist, const Location& loc,
+                                                const VkDebugUtilsLabelEXT* pLabelInfo) {
+                if (!pLabelInfo || !pLabelInfo->pLabelName) {
+                    return;
+                }
+                if (layer_data->profiler && strcmp(pLabelInfo->pLabelName, kLayerProfilerReportLabel) == 0) {
+                    ReportLayerProfile(layer_data, objlist, loc);
+                    layer_data->profiler->Reset();
+                } else if (strcmp(pLabelInfo->pLabelName, kMemoryFootprintReportLabel) == 0) {
+                    ReportMemoryFootprint(layer_data, objlist, loc);
+                }
+            }
+
             namespace vulkan_layer_chassis {
 
             static const VkLayerProperties global_layer = {
@@ -1093,17 +1325,33 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 CHECK_DISABLED local_disables{};
                 bool lock_setting;
                 // select_instrumented_shaders is the only gpu-av setting that is off by default
-                GpuAVSettings local_gpuav_settings = {true, true, true, true, true, false, 10000};
+                GpuAVSettings local_gpuav_settings = {true, true, true, true, true, true, true, false, 10000, 0};
+                SyncValSettings local_syncval_settings = {256, 0, 0, false};
+                uint32_t memory_report_interval = 0;
+                uint32_t thread_safety_sample_rate = 1;
+                std::vector<uint32_t> validated_queue_families;
+                std::string profile_layer_file;
+                vvl::ValidationBudgetSettings validation_budget_settings;
                 ConfigAndEnvSettings config_and_env_settings_data{OBJECT_LAYER_DESCRIPTION,
                                                                 pCreateInfo,
                                                                 local_enables,
                                                                 local_disables,
                                                                 report_data->filter_message_ids,
                                                                 &report_data->duplicate_message_limit,
+                                                                &report_data->message_aggregation_window,
                                                                 &lock_setting,
-                                                                &local_gpuav_settings};
+                                                                &local_gpuav_settings,
+                                                                &local_syncval_settings,
+                                                                &memory_report_interval,
+                                                                &thread_safety_sample_rate,
+                                                                &validated_queue_families,
+                                                                &profile_layer_file,
+                                                                &validation_budget_settings};
                 ProcessConfigAndEnvSettings(&config_and_env_settings_data);
                 layer_debug_messenger_actions(report_data, OBJECT_LAYER_DESCRIPTION);
+                if (local_enables[async_message_delivery]) {
+                    StartAsyncMessageDelivery(report_data, local_enables[async_error_messages]);
+                }
 
                 // Create temporary dispatch vector for pre-calls until instance is created
                 std::vector<ValidationObject*> local_object_dispatch = CreateObjectDispatch(local_enables, local_disables);
@@ -1133,7 +1381,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool skip = false;
                 ErrorObject error_obj(vvl::Func::vkCreateInstance, VulkanTypedHandle());
                 for (const ValidationObject* intercept : local_object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |= intercept->PreCallValidateCreateInstance(pCreateInfo, pAllocator, pInstance, error_obj);
                     if (skip) {
                         cleanup_allocations();
@@ -1143,7 +1391,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateInstance);
                 for (ValidationObject* intercept : local_object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, record_obj);
                 }
 
@@ -1161,6 +1409,15 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 framework->enabled = local_enables;
                 framework->fine_grained_locking = lock_setting;
                 framework->gpuav_settings = local_gpuav_settings;
+                framework->syncval_settings = local_syncval_settings;
+                framework->memory_report_interval = memory_report_interval;
+                framework->thread_safety_sample_rate = thread_safety_sample_rate;
+                framework->validated_queue_families = validated_queue_families;
+                framework->validation_budget_settings = validation_budget_settings;
+                if (local_enables[layer_profiling]) {
+                    framework->profiler = CreateLayerProfiler();
+                    framework->profile_layer_file = profile_layer_file;
+                }
 
                 framework->instance = *pInstance;
                 layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -1180,11 +1437,15 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     intercept->disabled = framework->disabled;
                     intercept->fine_grained_locking = framework->fine_grained_locking;
                     intercept->gpuav_settings = framework->gpuav_settings;
+                    intercept->syncval_settings = framework->syncval_settings;
+                    intercept->thread_safety_sample_rate = framework->thread_safety_sample_rate;
+                    intercept->validated_queue_families = framework->validated_queue_families;
                     intercept->instance = *pInstance;
+                    intercept->CacheLockingMode();
                 }
 
                 for (ValidationObject* intercept : framework->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, record_obj);
                 }
 
@@ -1200,23 +1461,25 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 ErrorObject error_obj(vvl::Func::vkDestroyInstance, VulkanTypedHandle(instance, kVulkanObjectTypeInstance));
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     intercept->PreCallValidateDestroyInstance(instance, pAllocator, error_obj);
                 }
 
                 RecordObject record_obj(vvl::Func::vkDestroyInstance);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
                 layer_data->instance_dispatch_table.DestroyInstance(instance, pAllocator);
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordDestroyInstance(instance, pAllocator, record_obj);
                 }
 
+                ReportLayerProfile(layer_data, instance, record_obj.location);
+
                 DeactivateInstanceDebugCallbacks(layer_data->report_data);
                 FreePnextChain(layer_data->report_data->instance_pnext_chain);
 
@@ -1260,18 +1523,22 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool skip = false;
                 ErrorObject error_obj(vvl::Func::vkCreateDevice, VulkanTypedHandle(gpu, kVulkanObjectTypePhysicalDevice));
                 for (const ValidationObject* intercept : instance_interceptor->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
+                    auto profile = instance_interceptor->Profile(vvl::ProfilePhase::Validate, vvl::Func::vkCreateDevice, intercept);
                     skip |= intercept->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
 
                 RecordObject record_obj(vvl::Func::vkCreateDevice);
                 for (ValidationObject* intercept : instance_interceptor->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
+                    auto profile = instance_interceptor->Profile(vvl::ProfilePhase::PreRecord, vvl::Func::vkCreateDevice, intercept);
                     intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, record_obj, &modified_create_info);
                 }
 
+                auto dispatch_profile = instance_interceptor->Profile(vvl::ProfilePhase::Dispatch, vvl::Func::vkCreateDevice);
                 VkResult result = fpCreateDevice(gpu, reinterpret_cast<VkDeviceCreateInfo*>(&modified_create_info), pAllocator, pDevice);
+                dispatch_profile.Stop();
                 if (result != VK_SUCCESS) {
                     return result;
                 }
@@ -1296,6 +1563,13 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 instance_interceptor->report_data->device_created++;
 
                 InitDeviceObjectDispatch(instance_interceptor, device_interceptor);
+                if (instance_interceptor->enabled[check_profiling]) {
+                    device_interceptor->check_profiler = std::make_shared<vvl::CheckProfiler>();
+                }
+                if (instance_interceptor->validation_budget_settings.frame_budget_us != 0) {
+                    device_interceptor->validation_budget =
+                        std::make_shared<vvl::ValidationBudget>(instance_interceptor->validation_budget_settings);
+                }
 
                 // Initialize all of the objects with the appropriate data
                 for (auto* object : device_interceptor->object_dispatch) {
@@ -1309,17 +1583,33 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     object->enabled = instance_interceptor->enabled;
                     object->fine_grained_locking = instance_interceptor->fine_grained_locking;
                     object->gpuav_settings = instance_interceptor->gpuav_settings;
+                    object->syncval_settings = instance_interceptor->syncval_settings;
+                    object->thread_safety_sample_rate = instance_interceptor->thread_safety_sample_rate;
+                    object->validated_queue_families = instance_interceptor->validated_queue_families;
+                    object->check_profiler = device_interceptor->check_profiler;
+                    object->validation_budget = device_interceptor->validation_budget;
                     object->instance_dispatch_table = instance_interceptor->instance_dispatch_table;
                     object->instance_extensions = instance_interceptor->instance_extensions;
                     object->device_extensions = device_interceptor->device_extensions;
+                    object->CacheLockingMode();
                 }
 
                 for (ValidationObject* intercept : instance_interceptor->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
+                    // Most of the setup of the device happens here, in the CreateDevice() of the validation objects
+                    auto profile = instance_interceptor->Profile(vvl::ProfilePhase::PostRecord, vvl::Func::vkCreateDevice, intercept);
                     intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, record_obj);
                 }
 
                 device_interceptor->InitObjectDispatchVectors();
+                if (instance_interceptor->enabled[layer_profiling]) {
+                    device_interceptor->profiler = CreateLayerProfiler();
+                    device_interceptor->profile_layer_file = instance_interceptor->profile_layer_file;
+                }
+                if (instance_interceptor->enabled[memory_report]) {
+                    device_interceptor->memory_report_trigger =
+                        std::make_unique<vvl::MemoryReportTrigger>(instance_interceptor->memory_report_interval);
+                }
 
                 DeviceExtensionWhitelist(device_interceptor, pCreateInfo, *pDevice);
 
@@ -1335,23 +1625,31 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 auto layer_data = GetLayerDataPtr(key, layer_data_map);
                 ErrorObject error_obj(vvl::Func::vkCreateDevice, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     intercept->PreCallValidateDestroyDevice(device, pAllocator, error_obj);
                 }
 
                 RecordObject record_obj(vvl::Func::vkDestroyDevice);
+                // Before the validation objects release their state
+                ReportMemoryFootprint(layer_data, device, record_obj.location);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
                 layer_data->device_dispatch_table.DestroyDevice(device, pAllocator);
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordDestroyDevice(device, pAllocator, record_obj);
                 }
 
+                ReportLayerProfile(layer_data, device, record_obj.location);
+                ReportCheckProfile(layer_data, device, record_obj.location);
+                ReportValidationBudget(layer_data, device, record_obj.location);
+                ReportAggregatedMessages(layer_data->report_data);
+                FlushLogMessages(layer_data->report_data);
+
                 auto instance_interceptor = GetLayerDataPtr(get_dispatch_key(layer_data->physical_device), layer_data_map);
                 instance_interceptor->report_data->device_created--;
 
@@ -1374,7 +1672,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     cgpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |= intercept->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, &(cgpl_state[intercept->container_type]));
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1382,7 +1680,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateGraphicsPipelines);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, &(cgpl_state[intercept->container_type]));
                 }
@@ -1396,7 +1694,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, &(cgpl_state[intercept->container_type]));
                 }
@@ -1415,7 +1713,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     ccpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |= intercept->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, &(ccpl_state[intercept->container_type]));
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1423,7 +1721,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateComputePipelines);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                 &(ccpl_state[intercept->container_type]));
                 }
@@ -1437,7 +1735,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                     pPipelines, record_obj, &(ccpl_state[intercept->container_type]));
                 }
@@ -1455,7 +1753,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |=
                         intercept->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                             pPipelines, error_obj, &(crtpl_state[intercept->container_type]));
@@ -1464,7 +1762,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateRayTracingPipelinesNV);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, &(crtpl_state[intercept->container_type]));
                 }
@@ -1474,7 +1772,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                         pPipelines, record_obj, &(crtpl_state[intercept->container_type]));
                 }
@@ -1493,7 +1791,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     crtpl_state[intercept->container_type].pCreateInfos = pCreateInfos;
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |= intercept->PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                                 pCreateInfos, pAllocator, pPipelines, error_obj,
                                                                                 &(crtpl_state[intercept->container_type]));
@@ -1502,7 +1800,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkCreateRayTracingPipelinesKHR);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                         pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                         &(crtpl_state[intercept->container_type]));
@@ -1519,7 +1817,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                         pCreateInfos, pAllocator, pPipelines, record_obj,
                                                                         &(crtpl_state[intercept->container_type]));
@@ -1538,14 +1836,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 cpl_state.modified_create_info = *pCreateInfo;
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |= intercept->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
 
                 RecordObject record_obj(vvl::Func::vkCreatePipelineLayout);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj, &cpl_state);
                 }
 
@@ -1553,7 +1851,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj);
                 }
                 return result;
@@ -1570,14 +1868,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 csm_state.instrumented_create_info = *pCreateInfo;
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |= intercept->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
 
                 RecordObject record_obj(vvl::Func::vkCreateShaderModule);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, &csm_state);
                 }
 
@@ -1588,7 +1886,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, &csm_state);
                 }
                 return result;
@@ -1608,14 +1906,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 create_shader_object_api_state csm_state(createInfoCount, new_shader_create_infos.data());
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |= intercept->PreCallValidateCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
 
                 RecordObject record_obj(vvl::Func::vkCreateShadersEXT);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj, &csm_state);
                 }
 
@@ -1626,7 +1924,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                                             &csm_state);
                 }
@@ -1643,7 +1941,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
                     ads_state[intercept->container_type].Init(pAllocateInfo->descriptorSetCount);
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |= intercept->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, error_obj,
                                                                             &(ads_state[intercept->container_type]));
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1651,7 +1949,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkAllocateDescriptorSets);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj);
                 }
 
@@ -1659,7 +1957,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj,
                                                                     &(ads_state[intercept->container_type]));
                 }
@@ -1677,14 +1975,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 cb_state.modified_create_info = *pCreateInfo;
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |= intercept->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
                 }
 
                 RecordObject record_obj(vvl::Func::vkCreateBuffer);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj, &cb_state);
                 }
 
@@ -1692,12 +1990,132 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 record_obj.result = result;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj);
                 }
                 return result;
             }
 
+            // This API needs the ability to modify down-chain parameters
+            VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
+                auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+                bool skip = false;
+                ErrorObject error_obj(vvl::Func::vkQueueSubmit, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
+
+                queue_submit_api_state qs_state{};
+                qs_state.modified_fence = fence;
+
+                for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    if (intercept->IsCheckShed(intercept->budget_family)) continue;
+                    auto lock = intercept->DispatchReadLock();
+                    auto profile = layer_data->Profile(vvl::ProfilePhase::Validate, vvl::Func::vkQueueSubmit, intercept);
+                    skip |= intercept->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence, error_obj);
+                    if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+                }
+
+                RecordObject record_obj(vvl::Func::vkQueueSubmit);
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->DispatchWriteLock();
+                    auto profile = layer_data->Profile(vvl::ProfilePhase::PreRecord, vvl::Func::vkQueueSubmit, intercept);
+                    intercept->PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj, &qs_state);
+                }
+
+                const VkSubmitInfo* submits = qs_state.modified_submits.empty() ? pSubmits : qs_state.modified_submits.data();
+                auto dispatch_profile = layer_data->Profile(vvl::ProfilePhase::Dispatch, vvl::Func::vkQueueSubmit);
+                VkResult result = DispatchQueueSubmit(queue, submitCount, submits, qs_state.modified_fence);
+                dispatch_profile.Stop();
+                ProcessMemoryReportSubmit(layer_data, queue, error_obj.location);
+                record_obj.result = result;
+
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->DispatchWriteLock();
+                    auto profile = layer_data->Profile(vvl::ProfilePhase::PostRecord, vvl::Func::vkQueueSubmit, intercept);
+                    intercept->PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj, &qs_state);
+                }
+                if (result == VK_ERROR_DEVICE_LOST) FlushLogMessages(layer_data->report_data);
+                return result;
+            }
+
+            // This API needs the ability to modify down-chain parameters
+            VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+                auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+                bool skip = false;
+                ErrorObject error_obj(vvl::Func::vkQueueSubmit2, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
+
+                queue_submit2_api_state qs_state{};
+                qs_state.modified_fence = fence;
+
+                for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    if (intercept->IsCheckShed(intercept->budget_family)) continue;
+                    auto lock = intercept->DispatchReadLock();
+                    auto profile = layer_data->Profile(vvl::ProfilePhase::Validate, vvl::Func::vkQueueSubmit2, intercept);
+                    skip |= intercept->PreCallValidateQueueSubmit2(queue, submitCount, pSubmits, fence, error_obj);
+                    if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+                }
+
+                RecordObject record_obj(vvl::Func::vkQueueSubmit2);
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->DispatchWriteLock();
+                    auto profile = layer_data->Profile(vvl::ProfilePhase::PreRecord, vvl::Func::vkQueueSubmit2, intercept);
+                    intercept->PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj, &qs_state);
+                }
+
+                const VkSubmitInfo2* submits = qs_state.modified_submits.empty() ? pSubmits : qs_state.modified_submits.data();
+                auto dispatch_profile = layer_data->Profile(vvl::ProfilePhase::Dispatch, vvl::Func::vkQueueSubmit2);
+                VkResult result = DispatchQueueSubmit2(queue, submitCount, submits, qs_state.modified_fence);
+                dispatch_profile.Stop();
+                ProcessMemoryReportSubmit(layer_data, queue, error_obj.location);
+                record_obj.result = result;
+
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->DispatchWriteLock();
+                    auto profile = layer_data->Profile(vvl::ProfilePhase::PostRecord, vvl::Func::vkQueueSubmit2, intercept);
+                    intercept->PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj, &qs_state);
+                }
+                if (result == VK_ERROR_DEVICE_LOST) FlushLogMessages(layer_data->report_data);
+                return result;
+            }
+
+            // This API needs the ability to modify down-chain parameters
+            VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+                auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
+                bool skip = false;
+                ErrorObject error_obj(vvl::Func::vkQueueSubmit2KHR, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
+
+                queue_submit2_api_state qs_state{};
+                qs_state.modified_fence = fence;
+
+                for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    if (intercept->IsCheckShed(intercept->budget_family)) continue;
+                    auto lock = intercept->DispatchReadLock();
+                    auto profile = layer_data->Profile(vvl::ProfilePhase::Validate, vvl::Func::vkQueueSubmit2KHR, intercept);
+                    skip |= intercept->PreCallValidateQueueSubmit2KHR(queue, submitCount, pSubmits, fence, error_obj);
+                    if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+                }
+
+                RecordObject record_obj(vvl::Func::vkQueueSubmit2KHR);
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->DispatchWriteLock();
+                    auto profile = layer_data->Profile(vvl::ProfilePhase::PreRecord, vvl::Func::vkQueueSubmit2KHR, intercept);
+                    intercept->PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj, &qs_state);
+                }
+
+                const VkSubmitInfo2* submits = qs_state.modified_submits.empty() ? pSubmits : qs_state.modified_submits.data();
+                auto dispatch_profile = layer_data->Profile(vvl::ProfilePhase::Dispatch, vvl::Func::vkQueueSubmit2KHR);
+                VkResult result = DispatchQueueSubmit2KHR(queue, submitCount, submits, qs_state.modified_fence);
+                dispatch_profile.Stop();
+                ProcessMemoryReportSubmit(layer_data, queue, error_obj.location);
+                record_obj.result = result;
+
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->DispatchWriteLock();
+                    auto profile = layer_data->Profile(vvl::ProfilePhase::PostRecord, vvl::Func::vkQueueSubmit2KHR, intercept);
+                    intercept->PostCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj, &qs_state);
+                }
+                if (result == VK_ERROR_DEVICE_LOST) FlushLogMessages(layer_data->report_data);
+                return result;
+            }
+
             // Handle tooling queries manually as this is a request for layer information
             static const VkPhysicalDeviceToolPropertiesEXT khronos_layer_tool_props = {
                 VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES_EXT,
@@ -1725,7 +2143,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |=
                         intercept->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1733,7 +2151,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkGetPhysicalDeviceToolPropertiesEXT);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
 
@@ -1747,7 +2165,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 (*pToolCount)++;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
                 return result;
@@ -1769,7 +2187,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 for (const ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->ReadLock();
+                    auto lock = intercept->DispatchReadLock();
                     skip |=
                         intercept->PreCallValidateGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, error_obj);
                     if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1777,7 +2195,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
                 RecordObject record_obj(vvl::Func::vkGetPhysicalDeviceToolProperties);
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PreCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
 
@@ -1791,7 +2209,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 (*pToolCount)++;
 
                 for (ValidationObject* intercept : layer_data->object_dispatch) {
-                    auto lock = intercept->WriteLock();
+                    auto lock = intercept->DispatchWriteLock();
                     intercept->PostCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
                 }
                 return result;
@@ -1874,7 +2292,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
             else:
                 out.append('for (const ValidationObject* intercept : layer_data->object_dispatch) {\n')
             out.append(f'''
-                auto lock = intercept->ReadLock();
+                if (intercept->IsCheckShed(intercept->budget_family)) continue;
+                auto lock = intercept->DispatchReadLock();
+                    auto profile = layer_data->Profile(vvl::ProfilePhase::Validate, vvl::Func::{command.name}, intercept);
                     skip |= intercept->PreCallValidate{command.name[2:]}({paramsList}, error_obj);
                     if (skip) {return_map[command.returnType]}
                 }}\n''')
@@ -1886,7 +2306,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
             else:
                 out.append('for (ValidationObject* intercept : layer_data->object_dispatch) {\n')
             out.append(f'''
-                auto lock = intercept->WriteLock();
+                auto lock = intercept->DispatchWriteLock();
+                auto profile = layer_data->Profile(vvl::ProfilePhase::PreRecord, vvl::Func::{command.name}, intercept);
                 intercept->PreCallRecord{command.name[2:]}({paramsList}, record_obj);
             }}\n''')
 
@@ -1902,7 +2323,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             # Output dispatch (down-chain) function call
             assignResult = f'{command.returnType} result = ' if (command.returnType != 'void') else ''
+            out.append(f'auto dispatch_profile = layer_data->Profile(vvl::ProfilePhase::Dispatch, vvl::Func::{command.name});\n')
             out.append(f'    {assignResult}{command.name.replace("vk", "Dispatch")}({paramsList});\n')
+            out.append('dispatch_profile.Stop();\n')
 
 
             # Insert post-dispatch debug utils function call
@@ -1912,6 +2335,12 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 'vkDestroyDebugReportCallbackEXT' : 'LayerDestroyCallback(layer_data->report_data, callback);',
                 'vkCreateDebugUtilsMessengerEXT' : 'LayerCreateMessengerCallback(layer_data->report_data, false, pCreateInfo, pMessenger);',
                 'vkDestroyDebugUtilsMessengerEXT' : 'LayerDestroyCallback(layer_data->report_data, messenger);',
+                'vkQueueInsertDebugUtilsLabelEXT' : 'ProcessLayerReportLabel(layer_data, queue, error_obj.location, pLabelInfo);',
+                'vkCmdInsertDebugUtilsLabelEXT' : 'ProcessLayerReportLabel(layer_data, commandBuffer, error_obj.location, pLabelInfo);',
+                'vkQueueSubmit' : 'ProcessMemoryReportSubmit(layer_data, queue, error_obj.location);',
+                'vkQueueSubmit2' : 'ProcessMemoryReportSubmit(layer_data, queue, error_obj.location);',
+                'vkQueueSubmit2KHR' : 'ProcessMemoryReportSubmit(layer_data, queue, error_obj.location);',
+                'vkQueuePresentKHR' : 'ProcessValidationBudgetFrame(layer_data, queue, error_obj.location);',
             }
             if command.name in post_dispatch_debug_utils_functions:
                 out.append(f'    {post_dispatch_debug_utils_functions[command.name]}\n')
@@ -1942,13 +2371,17 @@ class LayerChassisOutputGenerator(BaseGenerator):
             ]
 
             if command.name not in commands_with_blocking_operations:
-                out.append('auto lock = intercept->WriteLock();\n')
+                out.append('auto lock = intercept->DispatchWriteLock();\n')
             else:
                 out.append('ValidationObject::BlockingOperationGuard lock(intercept);\n')
+            out.append(f'auto profile = layer_data->Profile(vvl::ProfilePhase::PostRecord, vvl::Func::{command.name}, intercept);\n')
             out.append(f'intercept->PostCallRecord{command.name[2:]}({paramsList}, record_obj);\n')
             out.append('}\n')
             # Return result variable, if any.
             if command.returnType != 'void':
+                if command.name in self.commands_flushing_on_device_loss:
+                    # Messages explaining the loss must reach the application before it gives up on the device
+                    out.append('if (result == VK_ERROR_DEVICE_LOST) FlushLogMessages(layer_data->report_data);\n')
                 out.append('    return result;\n')
             out.append('}\n')
             out.append('\n')
@@ -36,6 +36,12 @@ def needSafeStruct(struct: Struct) -> bool:
             return True
     return False
 
+# Determine if a structure gets move operations, which swap every member with the moved from object.
+# Unions only have one active member, and the host memory of safe_VkAccelerationStructureGeometryKHR is looked up by its
+# address, so those are only copied.
+def canMoveSafeStruct(struct: Struct) -> bool:
+    return not struct.union and struct.name != 'VkAccelerationStructureGeometryKHR'
+
 class SafeStructOutputGenerator(BaseGenerator):
     def __init__(self):
         BaseGenerator.__init__(self)
@@ -124,6 +130,7 @@ class SafeStructOutputGenerator(BaseGenerator):
             #include <cstdlib>
             #include <algorithm>
             #include <functional>
+            #include <utility>
 
             // State that elements in a pNext chain may need to be aware of
             struct PNextCopyState {
@@ -168,10 +175,13 @@ class SafeStructOutputGenerator(BaseGenerator):
                 out.append('char type_at_end[sizeof(VkDescriptorDataEXT)+sizeof(VkDescriptorGetInfoEXT::type)];')
 
             constructParam = self.custom_construct_params.get(struct.name, '')
+            move_operations = f'''
+                safe_{struct.name}(safe_{struct.name}&& move_src) noexcept;
+                safe_{struct.name}& operator=(safe_{struct.name}&& move_src) noexcept;''' if canMoveSafeStruct(struct) else ''
             out.append(f'''
                 safe_{struct.name}(const {struct.name}* in_struct{constructParam}, PNextCopyState* copy_state = {{}}{copy_pnext});
                 safe_{struct.name}(const safe_{struct.name}& copy_src);
-                safe_{struct.name}& operator=(const safe_{struct.name}& copy_src);
+                safe_{struct.name}& operator=(const safe_{struct.name}& copy_src);{move_operations}
                 safe_{struct.name}();
                 ~safe_{struct.name}();
                 void initialize(const {struct.name}* in_struct{constructParam}, PNextCopyState* copy_state = {{}});
@@ -1135,6 +1145,21 @@ void FreePnextChain(const void *pNext) {
                 {copy_assign_txt}
                 }}
                 ''')
+            # Move operations, the moved from object is left with the previous members of this one and frees them
+            if canMoveSafeStruct(struct):
+                swap_txt = ''.join(f'    std::swap({member.name}, move_src.{member.name});\n' for member in struct.members)
+                out.append(f'''
+                    safe_{struct.name}::safe_{struct.name}(safe_{struct.name}&& move_src) noexcept : safe_{struct.name}() {{
+                        *this = std::move(move_src);
+                    }}
+
+                    safe_{struct.name}& safe_{struct.name}::operator=(safe_{struct.name}&& move_src) noexcept {{
+                        if (&move_src == this) return *this;
+
+                    {swap_txt}
+                        return *this;
+                    }}
+                    ''')
             out.append(f'''
                 safe_{struct.name}::~safe_{struct.name}()
                 {{
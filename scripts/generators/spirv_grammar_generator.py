@@ -301,6 +301,7 @@ class SpirvGrammarHelperOutputGenerator(BaseGenerator):
         out = []
         out.append('''
             #pragma once
+            #include <array>
             #include <cstdint>
             #include <string>
             #include <vector>
@@ -316,105 +317,128 @@ class SpirvGrammarHelperOutputGenerator(BaseGenerator):
             std::string string_SpvCooperativeMatrixOperands(uint32_t mask);
             ''')
 
-        hasTypeCase = "\n".join([f"        case spv::{f}:" for f in self.hasType])
-        hasResultCase = "\n".join([f"        case spv::{f}:" for f in self.hasResult])
-        out.append(f'''
-            static constexpr bool OpcodeHasType(uint32_t opcode) {{
-                switch (opcode) {{
-            {hasTypeCase}
-                        return true;
-                    default:
-                        return false;
-                }}
-            }}
-
-            static constexpr bool OpcodeHasResult(uint32_t opcode) {{
-                switch (opcode) {{
-            {hasResultCase}
-                        return true;
-                    default:
-                        return false;
-                }}
-            }}
+        out.append('''
+            // All valid OpType*
+            enum class SpvType {
+                Empty = 0,
             ''')
+        for type in self.typeOps:
+            out.append(f'k{type[6:]},\n')
+        out.append("};\n")
+
+        # Every opcode of the grammar indexes the table directly, extension opcodes are all allocated below 8192
+        tableSize = 1 << max(self.opcodes.keys()).bit_length()
+        if tableSize > 8192:
+            print(f'Error: opcode table of {tableSize} entries is too large, opcodes need to be mapped\n')
+            sys.exit(1)
+        # Positions are packed in 3 bits and SpvType in 5 bits
+        positionLists = [
+            ('memory_scope_position', self.memoryScopePosition),
+            ('execution_scope_position', self.executionScopePosition),
+            ('image_operands_position', self.imageOperandsPosition),
+            ('image_access_position', self.imageAccessOperand),
+        ]
+        for _, positions in positionLists:
+            if len(positions) > 8:
+                print('Error: operand position does not fit in OpcodeInfo\n')
+                sys.exit(1)
+        if len(self.typeOps) >= 32:
+            print('Error: SpvType does not fit in OpcodeInfo\n')
+            sys.exit(1)
 
-        # \n is not allowed in f-string until 3.12
-        atomicCase = "\n".join([f"        case spv::{f}:" for f in self.atomicsOps])
-        groupCase = "\n".join([f"        case spv::{f}:" for f in self.groupOps])
-        debugCase = "\n".join([f"        case spv::{f}:" for f in self.debugOps])
-        annotationCase = "\n".join([f"        case spv::{f}:" for f in self.annotationOps])
         out.append(f'''
-            // Any non supported operation will be covered with other VUs
-            static constexpr bool AtomicOperation(uint32_t opcode) {{
-                switch (opcode) {{
-            {atomicCase}
-                        return true;
-                    default:
-                        return false;
-                }}
-            }}
+            // Properties of an opcode packed in 32 bits, so every query below is a single indexed load instead of a switch
+            struct OpcodeInfo {{
+                uint32_t has_type : 1;
+                uint32_t has_result : 1;
+                uint32_t atomic : 1;
+                uint32_t group : 1;
+                uint32_t debug : 1;
+                uint32_t annotation : 1;
+                uint32_t image_gather : 1;
+                uint32_t image_fetch : 1;
+                uint32_t image_sample : 1;
+                uint32_t spv_type : 5;  // SpvType
+                // Operand positions, zero if there is none
+                uint32_t memory_scope_position : 3;
+                uint32_t execution_scope_position : 3;
+                uint32_t image_operands_position : 3;
+                uint32_t image_access_position : 3;
+            }};
+            static_assert(sizeof(OpcodeInfo) == sizeof(uint32_t));
+
+            // All opcodes in the grammar are below this
+            static constexpr uint32_t kOpcodeInfoTableSize = {tableSize};
+
+            inline constexpr std::array<OpcodeInfo, kOpcodeInfoTableSize> kOpcodeInfoTable = [] {{
+                std::array<OpcodeInfo, kOpcodeInfoTableSize> table{{}};
+            ''')
+        flagLists = [
+            ('has_type', self.hasType),
+            ('has_result', self.hasResult),
+            ('atomic', self.atomicsOps),
+            ('group', self.groupOps),
+            ('debug', self.debugOps),
+            ('annotation', self.annotationOps),
+            ('image_gather', self.imageGatherOps),
+            ('image_fetch', self.imageFetchOps),
+            ('image_sample', self.imageSampleOps),
+        ]
+        for field, opnames in flagLists:
+            out.append('\n')
+            for opname in opnames:
+                out.append(f'    table[spv::{opname}].{field} = 1;\n')
+        out.append('\n')
+        for opname in self.typeOps:
+            out.append(f'    table[spv::{opname}].spv_type = static_cast<uint32_t>(SpvType::k{opname[6:]});\n')
+        for field, positions in positionLists:
+            out.append('\n')
+            for index, opnames in enumerate(positions):
+                for opname in opnames:
+                    out.append(f'    table[spv::{opname}].{field} = {index};\n')
+        out.append('''
+                return table;
+            }();
 
-            // Any non supported operation will be covered with other VUs
-            static constexpr bool GroupOperation(uint32_t opcode) {{
-                switch (opcode) {{
-            {groupCase}
-                        return true;
-                    default:
-                        return false;
-                }}
-            }}
+            static constexpr OpcodeInfo GetOpcodeInfo(uint32_t opcode) {
+                return opcode < kOpcodeInfoTableSize ? kOpcodeInfoTable[opcode] : OpcodeInfo{};
+            }
 
-           static constexpr  bool DebugOperation(uint32_t opcode) {{
-                switch (opcode) {{
-            {debugCase}
-                        return true;
-                    default:
-                        return false;
-                }}
-            }}
+            static constexpr bool OpcodeHasType(uint32_t opcode) { return GetOpcodeInfo(opcode).has_type; }
+            static constexpr bool OpcodeHasResult(uint32_t opcode) { return GetOpcodeInfo(opcode).has_result; }
 
-            static constexpr bool AnnotationOperation(uint32_t opcode) {{
-                switch (opcode) {{
-            {annotationCase}
-                        return true;
-                    default:
-                        return false;
-                }}
-            }}
-            ''')
+            // Any non supported operation will be covered with other VUs
+            static constexpr bool AtomicOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).atomic; }
+            // Any non supported operation will be covered with other VUs
+            static constexpr bool GroupOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).group; }
+            static constexpr bool DebugOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).debug; }
+            static constexpr bool AnnotationOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).annotation; }
 
-        imageGatherOpsCase = "\n".join([f"        case spv::{f}:" for f in self.imageGatherOps])
-        imageFetchOpsCase = "\n".join([f"        case spv::{f}:" for f in self.imageFetchOps])
-        imageSampleOpsCase = "\n".join([f"        case spv::{f}:" for f in self.imageSampleOps])
-        out.append(f'''
-            static constexpr bool ImageGatherOperation(uint32_t opcode) {{
-                switch (opcode) {{
-            {imageGatherOpsCase}
-                        return true;
-                    default:
-                        return false;
-                }}
-            }}
+            static constexpr bool ImageGatherOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).image_gather; }
+            static constexpr bool ImageFetchOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).image_fetch; }
+            static constexpr bool ImageSampleOperation(uint32_t opcode) { return GetOpcodeInfo(opcode).image_sample; }
 
-            static constexpr bool ImageFetchOperation(uint32_t opcode) {{
-                switch (opcode) {{
-            {imageFetchOpsCase}
-                        return true;
-                    default:
-                        return false;
-                }}
-            }}
+            // Return operand position of Memory Scope <ID> or zero if there is none
+            static constexpr uint32_t OpcodeMemoryScopePosition(uint32_t opcode) {
+                return GetOpcodeInfo(opcode).memory_scope_position;
+            }
+            // Return operand position of Execution Scope <ID> or zero if there is none
+            static constexpr uint32_t OpcodeExecutionScopePosition(uint32_t opcode) {
+                return GetOpcodeInfo(opcode).execution_scope_position;
+            }
+            // Return operand position of Image Operands <ID> or zero if there is none
+            static constexpr uint32_t OpcodeImageOperandsPosition(uint32_t opcode) {
+                return GetOpcodeInfo(opcode).image_operands_position;
+            }
+            // Return operand position of 'Image' or 'Sampled Image' IdRef or zero if there is none.
+            static constexpr uint32_t OpcodeImageAccessPosition(uint32_t opcode) {
+                return GetOpcodeInfo(opcode).image_access_position;
+            }
 
-            static constexpr bool ImageSampleOperation(uint32_t opcode) {{
-                switch (opcode) {{
-            {imageSampleOpsCase}
-                        return true;
-                    default:
-                        return false;
-                }}
-            }}
+            static constexpr SpvType GetSpvType(uint32_t opcode) {
+                return static_cast<SpvType>(GetOpcodeInfo(opcode).spv_type);
+            }
             ''')
-
         out.append('''
             // Return number of optional parameter from ImageOperands
             static constexpr uint32_t ImageOperandsParamCount(uint32_t image_operand) {
@@ -438,102 +462,6 @@ class SpirvGrammarHelperOutputGenerator(BaseGenerator):
             }
             ''')
 
-        out.append('''
-            // Return operand position of Memory Scope <ID> or zero if there is none
-            static constexpr uint32_t OpcodeMemoryScopePosition(uint32_t opcode) {
-                uint32_t position = 0;
-                switch (opcode) {
-            ''')
-        for index, opcodes in enumerate(self.memoryScopePosition):
-            for opcode in opcodes:
-                out.append(f'        case spv::{opcode}:\n')
-            if len(opcodes) != 0:
-                out.append(f'            return {index};\n')
-        out.append('''
-                    default:
-                        break;
-                }
-                return position;
-            }
-            ''')
-
-        out.append('''
-            // Return operand position of Execution Scope <ID> or zero if there is none
-            static constexpr uint32_t OpcodeExecutionScopePosition(uint32_t opcode) {
-                uint32_t position = 0;
-                switch (opcode) {
-            ''')
-        for index, opcodes in enumerate(self.executionScopePosition):
-            for opcode in opcodes:
-                out.append(f'        case spv::{opcode}:\n')
-            if len(opcodes) != 0:
-                out.append(f'            return {index};\n')
-        out.append('''
-                    default:
-                        break;
-                }
-                return position;
-            }
-            ''')
-
-        out.append('''
-            // Return operand position of Image Operands <ID> or zero if there is none
-            static constexpr uint32_t OpcodeImageOperandsPosition(uint32_t opcode) {
-                uint32_t position = 0;
-                switch (opcode) {
-            ''')
-        for index, opcodes in enumerate(self.imageOperandsPosition):
-            for opcode in opcodes:
-                out.append(f'        case spv::{opcode}:\n')
-            if len(opcodes) != 0:
-                out.append(f'            return {index};\n')
-        out.append('''
-                    default:
-                        break;
-                }
-                return position;
-            }
-            ''')
-
-        out.append('''
-            // Return operand position of 'Image' or 'Sampled Image' IdRef or zero if there is none.
-            static constexpr uint32_t OpcodeImageAccessPosition(uint32_t opcode) {
-                uint32_t position = 0;
-                switch (opcode) {
-            ''')
-        for index, opcodes in enumerate(self.imageAccessOperand):
-            for opcode in opcodes:
-                out.append(f'        case spv::{opcode}:\n')
-            if len(opcodes) != 0:
-                out.append(f'            return {index};\n')
-        out.append('''
-                    default:
-                        break;
-                }
-                return position;
-            }
-            ''')
-
-        out.append('''
-            // All valid OpType*
-            enum class SpvType {
-                Empty = 0,
-            ''')
-        for type in self.typeOps:
-            out.append(f'k{type[6:]},\n')
-        out.append("};\n")
-
-        typeCase = "\n".join([f"case spv::{f}: return SpvType::k{f[6:]};" for f in self.typeOps])
-        out.append(f'''
-            static constexpr SpvType GetSpvType(uint32_t opcode) {{
-                switch (opcode) {{
-                    {typeCase}
-                    default:
-                        return SpvType::Empty;
-                }}
-            }}
-            ''')
-
         out.append('''
             enum class OperandKind {
                 Id,
@@ -22,7 +22,7 @@ import sys
 import os
 import re
 from generators.generator_utils import buildListVUID, PlatformGuardHelper
-from generators.vulkan_object import Member
+from generators.vulkan_object import Command, Member
 from generators.base_generator import BaseGenerator
 
 # This class is a container for any source code, data, or other behavior that is necessary to
@@ -48,6 +48,13 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
         BaseGenerator.__init__(self)
         self.valid_vuids = buildListVUID(valid_usage_file)
 
+        # With create_info_cache, these skip their checks when the same create info already passed them (see CreateInfoCache)
+        self.functions_with_create_info_cache = [
+            'vkCreateSampler',
+            'vkCreateImageView',
+            'vkCreateDescriptorSetLayout',
+        ]
+
         # These functions have additional, custom-written checks in the utils cpp file. CodeGen will automatically add a call
         # to those functions of the form 'bool manual_PreCallValidateAPIName', where the 'vk' is dropped.
         # see 'manual_PreCallValidateCreateGraphicsPipelines' as an example.
@@ -258,6 +265,8 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
             ****************************************************************************/\n''')
         self.write('// NOLINTBEGIN') # Wrap for clang-tidy to ignore
 
+        self.collectValidatedStructs()
+
         if self.filename == 'stateless_validation_helper.h':
             self.generateHeader()
         elif self.filename == 'stateless_validation_helper.cpp':
@@ -267,6 +276,42 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
 
         self.write('// NOLINTEND') # Wrap for clang-tidy to ignore
 
+    def collectValidatedStructs(self):
+        # Structure fields to ignore
+        structMemberBlacklist = {
+            'VkWriteDescriptorSet' : ['dstSet'],
+            'VkAccelerationStructureGeometryKHR' :['geometry'],
+            'VkDescriptorDataEXT' :['pSampler']
+        }
+        for struct in [x for x in self.vk.structs.values() if x.name in structMemberBlacklist]:
+            for member in [x for x in struct.members if x.name in structMemberBlacklist[struct.name]]:
+                member.noAutoValidity = True
+
+        # Generate the struct member checking code from the captured data
+        for struct in self.vk.structs.values():
+            # The string returned will be nested in an if check for a NULL pointer, so needs its indent incremented
+            lines = self.genFuncBody(self.vk.structs[struct.name].members, '{funcName}', '{errorLoc}', '{valuePrefix}', '{displayNamePrefix}', struct.name, False)
+            if lines:
+                self.validatedStructs[struct.name] = lines
+
+    # Cannot validate extension dependencies for device extension APIs having a physical device as their dispatchable object
+    def hasExtensionCheck(self, command: Command) -> bool:
+        return command.extensions and (not any(x.device for x in command.extensions) or command.params[0].type != 'VkPhysicalDevice')
+
+    def genCommandBody(self, command: Command) -> list:
+        # Skip first parameter if it is a dispatch handle (everything except vkCreateInstance)
+        startIndex = 0 if command.name == 'vkCreateInstance' else 1
+        return self.genFuncBody(command.params[startIndex:], command.name, 'loc', '', '', None, isPhysDevice = command.params[0].type == 'VkPhysicalDevice')
+
+    # Commands with nothing to check, such as vkCmdDraw, get no PreCallValidate override at all so that the chassis doesn't
+    # call into stateless validation for them (InitObjectDispatchVectors only adds the objects overriding a function)
+    def hasValidation(self, command: Command) -> bool:
+        if command.alias or self.hasExtensionCheck(command) or (command.instance and command.version):
+            return True
+        if command.name in self.functions_with_manual_checks or command.name in self.functions_with_create_info_cache:
+            return True
+        return self.genCommandBody(command) != ['// No xml-driven validation\n']
+
     def generateHeader(self):
         out = []
         out.append('#pragma once\n')
@@ -284,7 +329,7 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
         out.append('\n')
 
         guard_helper = PlatformGuardHelper()
-        for command in [x for x in self.vk.commands.values() if x.name not in self.blacklist]:
+        for command in [x for x in self.vk.commands.values() if x.name not in self.blacklist and self.hasValidation(x)]:
             out.extend(guard_helper.add_guard(command.protect))
             prototype = command.cPrototype.split('VKAPI_CALL ')[1]
             prototype = f'bool PreCallValidate{prototype[2:]}'
@@ -301,16 +346,6 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
         self.write("".join(out))
 
     def generateSource(self):
-        # Structure fields to ignore
-        structMemberBlacklist = {
-            'VkWriteDescriptorSet' : ['dstSet'],
-            'VkAccelerationStructureGeometryKHR' :['geometry'],
-            'VkDescriptorDataEXT' :['pSampler']
-        }
-        for struct in [x for x in self.vk.structs.values() if x.name in structMemberBlacklist]:
-            for member in [x for x in struct.members if x.name in structMemberBlacklist[struct.name]]:
-                member.noAutoValidity = True
-
         # TODO - We should not need this with VulkanObject, but the following are casuing issues
         # being "promoted"
         #  VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT
@@ -352,13 +387,6 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                 switch(header->sType) {
             ''')
 
-        # Generate the struct member checking code from the captured data
-        for struct in self.vk.structs.values():
-            # The string returned will be nested in an if check for a NULL pointer, so needs its indent incremented
-            lines = self.genFuncBody(self.vk.structs[struct.name].members, '{funcName}', '{errorLoc}', '{valuePrefix}', '{displayNamePrefix}', struct.name, False)
-            if lines:
-                self.validatedStructs[struct.name] = lines
-
         guard_helper = PlatformGuardHelper()
         # Do some processing here to extract data from validatedstructs...
         for struct in [x for x in self.vk.structs.values() if x.extends]:
@@ -468,7 +496,7 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                 alias_but_not_core.append(aliasCommand.name)
 
         # Generate the command parameter checking code from the captured data
-        for command in [x for x in self.vk.commands.values() if x.name not in self.blacklist]:
+        for command in [x for x in self.vk.commands.values() if x.name not in self.blacklist and self.hasValidation(x)]:
             out.extend(guard_helper.add_guard(command.protect, extra_newline=True))
 
             prototype = (command.cPrototype.split('VKAPI_CALL ')[1])[2:-1]
@@ -479,8 +507,16 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
             # Create a copy here to make the logic simpler passing into ValidatePnextStructContents
             out.append('    [[maybe_unused]] const Location loc = error_obj.location;\n')
 
-            # Cannot validate extension dependencies for device extension APIs having a physical device as their dispatchable object
-            if command.extensions and (not any(x.device for x in command.extensions) or command.params[0].type != 'VkPhysicalDevice'):
+            use_create_info_cache = command.name in self.functions_with_create_info_cache
+            if use_create_info_cache:
+                keyParams = ', '.join([x.name for x in command.params[1:]])
+                out.append(f'const uint64_t create_info_key = enabled[create_info_cache] ? stateless::CreateInfoCache::Key({keyParams}) : 0;\n')
+                out.append('if (create_info_key && validated_create_infos.Contains(create_info_key)) return skip;\n')
+                out.append('DeferredMessages create_info_messages;\n')
+                out.append('{\n')
+                out.append('DeferMessagesScope defer(create_info_messages);\n')
+
+            if self.hasExtensionCheck(command):
                 cExpression =  []
                 outExpression =  []
                 for extension in command.extensions:
@@ -505,9 +541,7 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                 params = ', '.join(paramList)
                 out.append(f'skip |= PreCallValidate{command.alias[2:]}({params});')
             else:
-                # Skip first parameter if it is a dispatch handle (everything except vkCreateInstance)
-                startIndex = 0 if command.name == 'vkCreateInstance' else 1
-                lines = self.genFuncBody(command.params[startIndex:], command.name, 'loc', '', '', None, isPhysDevice = command.params[0].type == 'VkPhysicalDevice')
+                lines = self.genCommandBody(command)
 
                 if command.instance and command.version:
                     # check function name so KHR version doesn't trigger flase positive
@@ -524,6 +558,11 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                     # Generate parameter list for manual fcn and down-chain calls
                     params_text = ', '.join([x.name for x in command.params]) + ', error_obj'
                     out.append(f'    if (!skip) skip |= manual_PreCallValidate{command.name[2:]}({params_text});\n')
+            if use_create_info_cache:
+                out.append('}\n')
+                out.append('// Only a create info that logged nothing is cached, an error doesn\'t set skip if the callback returns VK_FALSE\n')
+                out.append('if (create_info_key && !create_info_messages.AnyLogged()) validated_create_infos.Add(create_info_key);\n')
+                out.append('skip |= create_info_messages.Forward();\n')
             out.append('return skip;\n')
             out.append('}\n')
         out.extend(guard_helper.add_guard(None, extra_newline=True))
@@ -63,7 +63,7 @@ class ValidEnumValuesOutputGenerator(BaseGenerator):
         guard_helper = PlatformGuardHelper()
         for enum in [x for x in self.vk.enums.values() if x.name != 'VkStructureType' and not x.returnedOnly]:
             out.extend(guard_helper.add_guard(enum.protect))
-            out.append(f'template<> std::vector<{enum.name}> ValidationObject::ValidParamValues() const;\n')
+            out.append(f'template<> bool ValidationObject::IsValidEnumValue({enum.name} value) const;\n')
         out.extend(guard_helper.add_guard(None))
         out.append("// clang-format on\n")
 
@@ -73,42 +73,41 @@ class ValidEnumValuesOutputGenerator(BaseGenerator):
         out = []
         out.append('''
             #include "chassis.h"
-            #include "utils/hash_vk_types.h"
-
-            // TODO (ncesario) This is not ideal as we compute the enabled extensions every time this function is called.
-            //      Ideally "values" would be something like a static variable that is built once and this function returns
-            //      a span of the container. This does not work for applications which create and destroy many instances and
-            //      devices over the lifespan of the project (e.g., VLT).
 
             ''')
         guard_helper = PlatformGuardHelper()
         out.append("// clang-format off\n")
         for enum in [x for x in self.vk.enums.values() if x.name != 'VkStructureType' and not x.returnedOnly]:
             out.extend(guard_helper.add_guard(enum.protect, extra_newline=True))
-            out.append(f'template<>\nstd::vector<{enum.name}> ValidationObject::ValidParamValues() const {{\n')
+            out.append(f'template<>\nbool ValidationObject::IsValidEnumValue({enum.name} value) const {{\n')
+            out.append('    switch (value) {\n')
 
             # If the field has same/subset extensions as enum, we count it as "core" for the struct
             coreEnums = [x.name for x in enum.fields if not x.extensions or (x.extensions and all(e in enum.extensions for e in x.extensions))]
-            out.extend([f'    constexpr std::array Core{enum.name}Enums = {{{", ".join(coreEnums)}}};\n'] if coreEnums else [])
-
-            out.append(f'    static const vvl::unordered_map<const ExtEnabled DeviceExtensions::*, std::vector<{enum.name}>> Extended{enum.name}Enums = {{\n')
+            if coreEnums:
+                out.extend([f'        case {x}:\n' for x in coreEnums])
+                out.append('            return true;\n')
 
+            # A value added by several extensions is valid if any of them is enabled.
+            # The values are grouped by the extensions adding them, so each group is a single case.
+            valueExtensions = dict()
             for extension in [x for x in enum.fieldExtensions if x not in enum.extensions]:
-                out.append(f'        {{ &DeviceExtensions::{extension.name.lower()}, {{ {", ".join([x.name for x in extension.enumFields[enum.name]])} }} }},\n')
-            out.append('    };')
-
-            startValue = f'values(Core{enum.name}Enums.cbegin(), Core{enum.name}Enums.cend())' if coreEnums else 'values'
-            out.append(f'''
-    std::vector<{enum.name}> {startValue};
-    std::set<{enum.name}> unique_exts;
-    for (const auto& [extension, enums]: Extended{enum.name}Enums) {{
-        if (IsExtEnabled(device_extensions.*extension)) {{
-            unique_exts.insert(enums.cbegin(), enums.cend());
-        }}
-    }}
-    std::copy(unique_exts.cbegin(), unique_exts.cend(), std::back_inserter(values));
-    return values;
-}}\n''')
+                for field in [x.name for x in extension.enumFields[enum.name] if x.name not in coreEnums]:
+                    extensions = valueExtensions.setdefault(field, [])
+                    if extension.name.lower() not in extensions:
+                        extensions.append(extension.name.lower())
+            extensionValues = dict()
+            for field, extensions in valueExtensions.items():
+                extensionValues.setdefault(tuple(extensions), []).append(field)
+            for extensions, fields in extensionValues.items():
+                out.extend([f'        case {x}:\n' for x in fields])
+                out.append(f'            return {" || ".join([f"IsExtEnabled(device_extensions.{x})" for x in extensions])};\n')
+
+            out.append('''        default:
+            return false;
+    }
+}
+''')
         out.extend(guard_helper.add_guard(None, extra_newline=True))
 
         out.append("// clang-format on\n")
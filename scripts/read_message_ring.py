@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 The Khronos Group Inc.
+# Copyright (c) 2024 Valve Corporation
+# Copyright (c) 2024 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Prints the messages kept by VK_DBG_LAYER_ACTION_LOG_RING (see layers/error_message/message_ring.h), oldest first:
+#
+#   python3 scripts/read_message_ring.py vvl_messages.ring
+import argparse
+import struct
+import sys
+
+MAGIC = b'VVLRING\0'
+FORMAT_VERSION = 1
+HEADER = struct.Struct('=8sIIQQ')
+
+def ReadMessages(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        sys.exit(f'{path} is too small to be a message ring')
+    magic, version, _, capacity, written = HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != FORMAT_VERSION or len(data) < HEADER.size + capacity:
+        sys.exit(f'{path} is not a version {FORMAT_VERSION} message ring')
+    ring = data[HEADER.size:HEADER.size + capacity]
+    if written <= capacity:
+        kept = ring[:written]
+    else:
+        position = written % capacity
+        kept = ring[position:] + ring[:position]
+    # Each message is preceded by a null byte, what comes before the first one was partly overwritten
+    return [message.decode('utf-8', 'replace') for message in kept.split(b'\0')[1:]]
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Print the messages of a message ring of the validation layers')
+    parser.add_argument('ring', help='file written with VK_DBG_LAYER_ACTION_LOG_RING')
+    parser.add_argument('-n', dest='count', type=int, default=0, help='only print the last COUNT messages')
+    args = parser.parse_args(argv)
+
+    messages = ReadMessages(args.ring)
+    if args.count > 0:
+        messages = messages[-args.count:]
+    for message in messages:
+        print(message)
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
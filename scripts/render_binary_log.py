@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 The Khronos Group Inc.
+# Copyright (c) 2024 Valve Corporation
+# Copyright (c) 2024 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Renders the records written with VK_DBG_LAYER_ACTION_LOG_BINARY (see layers/error_message/binary_log.h) as text.
+#
+# The enums of the records are named from the generated headers of this checkout, which must be the one the layer
+# was built from:
+#
+#   python3 scripts/render_binary_log.py vvl_messages.bin
+import argparse
+import os
+import re
+import struct
+import sys
+
+# helper to define paths relative to the repo root
+def repo_relative(path):
+    return os.path.abspath(os.path.join(os.path.dirname(__file__), '..', path))
+
+MAGIC = b'VVLBLOG\0'
+FORMAT_VERSION = 1
+FILE_HEADER = struct.Struct('=8sIIQ')
+RECORD_HEADER = struct.Struct('=IIIIQHHHH')
+OBJECT_ENTRY = struct.Struct('=QII')
+LOCATION_ENTRY = struct.Struct('=HHI')
+PNEXT_BIT = 0x8000
+NO_INDEX = 0xFFFFFFFF
+
+# LogMessageTypeBits of vk_layer_config.h
+SEVERITIES = [
+    (0x08, 'Validation Error'),
+    (0x02, 'Validation Warning'),
+    (0x04, 'Validation Performance Warning'),
+    (0x01, 'Validation Information'),
+    (0x10, 'Verbose Information'),
+]
+
+def ParseEnum(text, name):
+    body = re.search(r'enum class ' + name + r' \{(.*?)\};', text, re.S)
+    if not body:
+        sys.exit(f'enum {name} not found')
+    return [entry.strip().split(' ')[0] for entry in body.group(1).split(',') if entry.strip()]
+
+def LoadNames(api):
+    generated = repo_relative(f'layers/{api}/generated')
+    with open(os.path.join(generated, 'error_location_helper.h'), encoding='utf-8') as f:
+        text = f.read()
+    funcs = ParseEnum(text, 'Func')
+    structs = ParseEnum(text, 'Struct')
+    fields = ParseEnum(text, 'Field')
+
+    with open(os.path.join(generated, 'error_location_helper.cpp'), encoding='utf-8') as f:
+        text = f.read()
+    pointer_body = re.search(r'bool IsFieldPointer\(Field field\) \{(.*?)\n\}', text, re.S)
+    pointer_fields = set(re.findall(r'case Field::(\w+):', pointer_body.group(1))) if pointer_body else set()
+
+    with open(os.path.join(generated, 'vk_object_types.h'), encoding='utf-8') as f:
+        text = f.read()
+    object_types = {}
+    for name, value in re.findall(r'kVulkanObjectType(\w+) = (\d+),', text):
+        object_types[int(value)] = 'Vk' + name if name != 'Unknown' else 'Unknown'
+    return funcs, structs, fields, pointer_fields, object_types
+
+def Name(names, value):
+    return names[value] if value < len(names) else f'<{value}>'
+
+# Same joining rules as Location::AppendFields, entries go from the outermost to the innermost
+def RenderFields(entries, last, structs, fields, pointer_fields):
+    structure, field, index = entries[last]
+    out = ''
+    if last > 0:
+        prev = last - 1
+        # A .dot(sub_index) duplicates the field of its parent, which is then skipped
+        if entries[prev][1] == field and entries[prev][2] == NO_INDEX and prev > 0:
+            prev -= 1
+        out += RenderFields(entries, prev, structs, fields, pointer_fields)
+        prev_structure, prev_field, prev_index = entries[prev]
+        if (prev_structure & ~PNEXT_BIT) != 0 or prev_field != 0:
+            out += '->' if (prev_index == NO_INDEX and Name(fields, prev_field) in pointer_fields) else '.'
+    if (structure & PNEXT_BIT) and (structure & ~PNEXT_BIT) != 0:
+        out += f'pNext<{Name(structs, structure & ~PNEXT_BIT)}{">." if field != 0 else ">"}'
+    if field != 0:
+        out += Name(fields, field)
+        if index != NO_INDEX:
+            out += f'[{index}]'
+    return out
+
+def Render(path, names, out):
+    funcs, structs, fields, pointer_fields, object_types = names
+    with open(path, 'rb') as f:
+        data = f.read()
+    if len(data) < FILE_HEADER.size:
+        sys.exit(f'{path} is too small to be a binary log')
+    magic, version, header_version, start_time = FILE_HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != FORMAT_VERSION:
+        sys.exit(f'{path} is not a version {FORMAT_VERSION} binary log')
+    out.write(f'# Vulkan header {header_version >> 22 & 0x7F}.{header_version >> 12 & 0x3FF}.{header_version & 0xFFF}, '
+              f'started at {start_time / 1e9:.3f}s after the epoch\n')
+
+    offset = FILE_HEADER.size
+    while offset + RECORD_HEADER.size <= len(data):
+        (size, msg_flags, vuid_hash, thread_id, timestamp, function, vuid_length, object_count,
+         location_count) = RECORD_HEADER.unpack_from(data, offset)
+        # The end of a log that was not closed is zeroed
+        if size == 0 or offset + size > len(data):
+            break
+        cursor = offset + RECORD_HEADER.size
+        objects = []
+        for _ in range(object_count):
+            objects.append(OBJECT_ENTRY.unpack_from(data, cursor))
+            cursor += OBJECT_ENTRY.size
+        entries = []
+        for _ in range(location_count):
+            entries.append(LOCATION_ENTRY.unpack_from(data, cursor))
+            cursor += LOCATION_ENTRY.size
+        vuid = data[cursor:cursor + vuid_length].decode('utf-8', 'replace')
+        offset += size
+
+        severity = next((label for bit, label in SEVERITIES if msg_flags & bit), 'Message')
+        line = f'[{timestamp / 1e9:.6f}s thread {thread_id}] {severity}: [ {vuid} ] '
+        for i, (handle, object_type, _) in enumerate(objects):
+            line += f'Object {i}: handle = {handle:#x}, type = {object_types.get(object_type, object_type)}; '
+        line += f'| MessageID = {vuid_hash:#x}'
+        if location_count:
+            line += f' | {Name(funcs, function)}(): {RenderFields(entries, location_count - 1, structs, fields, pointer_fields)}'
+        out.write(line + '\n')
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Render a binary message log of the validation layers as text')
+    parser.add_argument('log', help='file written with VK_DBG_LAYER_ACTION_LOG_BINARY')
+    parser.add_argument('-api', default='vulkan', choices=['vulkan'], help='Specify API name to use')
+    parser.add_argument('-o', dest='output', help='write to this file instead of stdout')
+    args = parser.parse_args(argv)
+
+    names = LoadNames(args.api)
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as out:
+            Render(args.log, names, out)
+    else:
+        Render(args.log, names, sys.stdout)
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -18,6 +18,9 @@ import subprocess
 import sys
 import os
 import argparse
+import datetime
+import json
+import tempfile
 import common_ci
 
 # Where all artifacts will ultimately be placed under
@@ -152,7 +155,10 @@ def Build(args):
             sys.exit(1)
 
     try:
-        BuildVVL(config = config, cmake_args = args.cmake, build_tests = "ON", mock_android = args.mockAndroid)
+        cmake_args = args.cmake
+        if args.bench:
+            cmake_args += ' -D BUILD_BENCHMARKS=ON'
+        BuildVVL(config = config, cmake_args = cmake_args, build_tests = "ON", mock_android = args.mockAndroid)
         BuildLoader()
         BuildProfileLayer(args.mockAndroid)
         BuildMockICD(args.mockAndroid)
@@ -234,6 +240,139 @@ def Test(args):
 
     sys.exit(0)
 
+#
+# Benchmark results, one entry per benchmark and configuration, in a format kept stable for performance dashboards:
+#   {"schema_version": 1, "git_hash": ..., "build_config": ..., "timestamp": ..., "driver": ...,
+#    "results": [{"benchmark": ..., "config": ..., "ns_per_op": ..., "allocs_per_op": ..., "peak_memory_bytes": ...}]}
+# Values a benchmark doesn't measure are null. Repeated runs of the same benchmark are averaged.
+BENCH_SCHEMA_VERSION = 1
+
+# Suffix of the gtest properties recorded by tests/bench/layer_*.cpp -> (result field, scale)
+LAYER_BENCH_PROPERTIES = [
+    ('_ns_per_call', 'ns_per_op', lambda value: value),
+    ('_ms_per_call', 'ns_per_op', lambda value: value * 1e6),
+    ('_ops_per_s', 'ns_per_op', lambda value: 1e9 / value if value else None),
+    ('_high_water_bytes', 'peak_memory_bytes', lambda value: value),
+]
+
+TIME_UNIT_NS = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+
+def AddBenchResult(results, benchmark, config, field, value):
+    if value is None:
+        return
+    entry = results.setdefault((benchmark, config), {})
+    entry.setdefault(field, []).append(value)
+
+# Google Benchmark JSON of vvl_container_bench
+def ReadContainerBench(path, results):
+    with open(path) as file:
+        data = json.load(file)
+    for run in data.get('benchmarks', []):
+        if run.get('run_type', 'iteration') != 'iteration':
+            continue
+        name = run.get('run_name', run['name'])
+        AddBenchResult(results, name, 'containers', 'ns_per_op', run['real_time'] * TIME_UNIT_NS[run.get('time_unit', 'ns')])
+        AddBenchResult(results, name, 'containers', 'allocs_per_op', run.get('allocs_per_iter'))
+        AddBenchResult(results, name, 'containers', 'peak_memory_bytes', run.get('max_bytes_used'))
+
+# gtest JSON of vk_layer_validation_benchmarks, the recorded properties end up as members of each test
+def ReadLayerBench(path, results):
+    with open(path) as file:
+        data = json.load(file)
+    for suite in data.get('testsuites', []):
+        fixture = suite['name'].split('/')[-1]
+        for test in suite.get('testsuite', []):
+            name = test['name']
+            config = 'default'
+            if 'value_param' in test:
+                name, _, config = name.rpartition('/')
+            for key, value in test.items():
+                for suffix, field, scale in LAYER_BENCH_PROPERTIES:
+                    if isinstance(value, str) and key.endswith(suffix):
+                        AddBenchResult(results, f'{fixture}.{name}.{key[:-len(suffix)]}', config, field, scale(float(value)))
+
+def GitHash():
+    try:
+        return subprocess.check_output(['git', 'rev-parse', 'HEAD'], cwd=common_ci.PROJECT_SRC_DIR, text=True).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return 'unknown'
+
+#
+# Run the benchmarks on the null driver (or the Mock ICD when it wasn't built) and write their results as JSON
+def RunBenchmarks(args):
+    BUILD_DIR = f'{CI_BUILD_DIR}/vvl'
+    exe = '.exe' if common_ci.IsWindows() else ''
+
+    bench_env = dict(os.environ)
+    driver = os.path.join(BUILD_DIR, 'tests', 'icd', 'VkICD_null.json')
+    if common_ci.IsWindows():
+        bench_env['VK_LAYER_PATH'] = os.path.join(CI_INSTALL_DIR, 'bin')
+        if not os.path.exists(driver):
+            driver = os.path.join(CI_INSTALL_DIR, 'bin\\VkICD_mock_icd.json')
+    else:
+        bench_env['LD_LIBRARY_PATH'] = os.path.join(CI_INSTALL_DIR, 'lib')
+        bench_env['DYLD_LIBRARY_PATH'] = os.path.join(CI_INSTALL_DIR, 'lib')
+        bench_env['VK_LAYER_PATH'] = os.path.join(CI_INSTALL_DIR, 'share/vulkan/explicit_layer.d')
+        if not os.path.exists(driver):
+            driver = os.path.join(CI_INSTALL_DIR, 'share/vulkan/icd.d/VkICD_mock_icd.json')
+    bench_env['VK_DRIVER_FILES'] = driver
+
+    results = {}
+    failed = False
+    with tempfile.TemporaryDirectory() as output_dir:
+        print("Run container microbenchmarks")
+        container_json = os.path.join(output_dir, 'containers.json')
+        container_cmd = [os.path.join(BUILD_DIR, 'tests', 'bench', f'vvl_container_bench{exe}'),
+                         f'--benchmark_out={container_json}', '--benchmark_out_format=json']
+        failed |= subprocess.run(container_cmd, env=bench_env).returncode != 0
+        if os.path.exists(container_json):
+            ReadContainerBench(container_json, results)
+
+        # Over budget memory benchmarks fail, their results are still written
+        print("Run layer benchmarks")
+        layer_json = os.path.join(output_dir, 'layer.json')
+        layer_cmd = [os.path.join(BUILD_DIR, 'tests', f'vk_layer_validation_benchmarks{exe}'), f'--gtest_output=json:{layer_json}']
+        failed |= subprocess.run(layer_cmd, env=bench_env).returncode != 0
+        if os.path.exists(layer_json):
+            ReadLayerBench(layer_json, results)
+
+    output = {
+        'schema_version': BENCH_SCHEMA_VERSION,
+        'git_hash': GitHash(),
+        'build_config': args.configuration,
+        'timestamp': datetime.datetime.now(datetime.timezone.utc).isoformat(timespec='seconds'),
+        'driver': os.path.basename(driver),
+        'results': [],
+    }
+    for (benchmark, config), fields in sorted(results.items()):
+        entry = {'benchmark': benchmark, 'config': config}
+        for field in ['ns_per_op', 'allocs_per_op', 'peak_memory_bytes']:
+            values = fields.get(field)
+            entry[field] = sum(values) / len(values) if values else None
+            if field == 'peak_memory_bytes' and entry[field] is not None:
+                entry[field] = int(entry[field])
+        output['results'].append(entry)
+
+    with open(args.benchOutput, 'w') as file:
+        json.dump(output, file, indent=2)
+    print(f"Wrote {len(output['results'])} benchmark results to {args.benchOutput}")
+    if failed:
+        print("Some benchmarks failed")
+        sys.exit(1)
+
+def Bench(args):
+    try:
+        RunBenchmarks(args)
+
+    except subprocess.CalledProcessError as proc_error:
+        print('Command "%s" failed with return code %s' % (' '.join(proc_error.cmd), proc_error.returncode))
+        sys.exit(proc_error.returncode)
+    except Exception as unknown_error:
+        print('An unknown error occured: %s', unknown_error)
+        sys.exit(1)
+
+    sys.exit(0)
+
 if __name__ == '__main__':
     configs = ['release', 'debug']
     default_config = configs[0]
@@ -258,6 +397,13 @@ if __name__ == '__main__':
     parser.add_argument(
         '--mockAndroid', dest='mockAndroid',
         action='store_true', help='Use Mock Android')
+    parser.add_argument(
+        '--bench', dest='bench',
+        action='store_true', help='Build (with --build) and run the benchmarks, writing their results as JSON')
+    parser.add_argument(
+        '--bench-output', dest='benchOutput',
+        metavar='FILE', type=str,
+        default=f'{CI_BUILD_DIR}/benchmarks.json', help='Where --bench writes its results')
 
     args = parser.parse_args()
 
@@ -265,3 +411,5 @@ if __name__ == '__main__':
         Build(args)
     if (args.test):
         Test(args)
+    if (args.bench):
+        Bench(args)
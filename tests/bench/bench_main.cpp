@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+// Replaces benchmark_main to register a memory manager, so every benchmark also reports its heap allocations per iteration
+// and its peak heap usage ("allocs_per_iter" and "max_bytes_used" in the JSON output). The global operator new and delete
+// are replaced to count them, only while Google Benchmark has the manager started.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Each allocation is prefixed with its size, so the bytes in use can be tracked without relying on sized deallocation
+constexpr size_t kHeaderSize = alignof(std::max_align_t) > sizeof(size_t) ? alignof(std::max_align_t) : sizeof(size_t);
+
+std::atomic<bool> counting{false};
+std::atomic<int64_t> allocation_count{0};
+std::atomic<int64_t> bytes_in_use{0};
+std::atomic<int64_t> max_bytes_in_use{0};
+
+void *CountedAlloc(size_t size) noexcept {
+    void *block = std::malloc(size + kHeaderSize);
+    if (!block) {
+        return nullptr;
+    }
+    *static_cast<size_t *>(block) = size;
+    if (counting.load(std::memory_order_relaxed)) {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        const int64_t in_use = bytes_in_use.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) +
+                               static_cast<int64_t>(size);
+        int64_t max = max_bytes_in_use.load(std::memory_order_relaxed);
+        while (in_use > max && !max_bytes_in_use.compare_exchange_weak(max, in_use, std::memory_order_relaxed)) {
+        }
+    }
+    return static_cast<char *>(block) + kHeaderSize;
+}
+
+void CountedFree(void *ptr) noexcept {
+    if (!ptr) {
+        return;
+    }
+    void *block = static_cast<char *>(ptr) - kHeaderSize;
+    if (counting.load(std::memory_order_relaxed)) {
+        bytes_in_use.fetch_sub(static_cast<int64_t>(*static_cast<size_t *>(block)), std::memory_order_relaxed);
+    }
+    std::free(block);
+}
+
+void *CountedNew(size_t size) {
+    void *ptr = CountedAlloc(size);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+class AllocationCounter : public benchmark::MemoryManager {
+  public:
+    void Start() override {
+        allocation_count.store(0, std::memory_order_relaxed);
+        bytes_in_use.store(0, std::memory_order_relaxed);
+        max_bytes_in_use.store(0, std::memory_order_relaxed);
+        counting.store(true, std::memory_order_relaxed);
+    }
+
+    // Google Benchmark 1.8 moved from Stop(Result *) to Stop(Result &), this overrides whichever the installed one has
+    void Stop(Result &result) {
+        counting.store(false, std::memory_order_relaxed);
+        result.num_allocs = allocation_count.load(std::memory_order_relaxed);
+        result.max_bytes_used = max_bytes_in_use.load(std::memory_order_relaxed);
+    }
+    void Stop(Result *result) { Stop(*result); }
+};
+
+}  // namespace
+
+// The aligned overloads are left to the standard library, they have their own matching operator delete
+void *operator new(size_t size) { return CountedNew(size); }
+void *operator new[](size_t size) { return CountedNew(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept { return CountedAlloc(size); }
+void *operator new[](size_t size, const std::nothrow_t &) noexcept { return CountedAlloc(size); }
+void operator delete(void *ptr) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr) noexcept { CountedFree(ptr); }
+void operator delete(void *ptr, size_t) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { CountedFree(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept { CountedFree(ptr); }
+
+int main(int argc, char **argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    AllocationCounter allocation_counter;
+    benchmark::RegisterMemoryManager(&allocation_counter);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::RegisterMemoryManager(nullptr);
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+
+#include "utils/vk_layer_utils.h"
+
+namespace {
+struct Object {
+    uint64_t handle;
+    uint64_t payload[7];
+};
+// Same shape as the state tracker object maps
+using ObjectMap = vl_concurrent_unordered_map<uint64_t, std::shared_ptr<Object>, 4>;
+using BorrowableObjectMap = vl_borrowable_concurrent_unordered_map<uint64_t, std::shared_ptr<Object>, 4>;
+
+constexpr uint64_t kObjectCount = 4096;
+
+template <typename Map>
+void Populate(Map &map) {
+    for (uint64_t handle = 1; handle <= kObjectCount; ++handle) {
+        map.insert_or_assign(handle, std::make_shared<Object>(Object{handle, {}}));
+    }
+}
+}  // namespace
+
+// Many threads recording command buffers that look up the same few objects (one pipeline, one vertex buffer, ...)
+static void BM_ConcurrentMapFindHot(benchmark::State &state) {
+    static ObjectMap map;
+    if (state.thread_index() == 0 && map.empty()) {
+        Populate(map);
+    }
+    uint64_t sum = 0;
+    for (auto _ : state) {
+        auto result = map.find(1 + (sum & 3));
+        sum += result->second->handle;
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentMapFindHot)->ThreadRange(1, 16)->UseRealTime();
+
+static void BM_ConcurrentMapFindBorrowedHot(benchmark::State &state) {
+    static BorrowableObjectMap map;
+    if (state.thread_index() == 0 && map.empty()) {
+        Populate(map);
+    }
+    uint64_t sum = 0;
+    for (auto _ : state) {
+        vvl::EpochGuard guard;
+        const Object *object = map.find_borrowed(1 + (sum & 3));
+        sum += object->handle;
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentMapFindBorrowedHot)->ThreadRange(1, 16)->UseRealTime();
+
+// Lookups spread over the whole map, with a trickle of writers creating and destroying objects
+static void BM_ConcurrentMapMixed(benchmark::State &state) {
+    static ObjectMap map;
+    if (state.thread_index() == 0 && map.empty()) {
+        Populate(map);
+    }
+    std::mt19937_64 rng(state.thread_index());
+    uint64_t sum = 0;
+    for (auto _ : state) {
+        const uint64_t handle = 1 + rng() % kObjectCount;
+        if ((handle & 63) == 0) {
+            map.insert_or_assign(handle, std::make_shared<Object>(Object{handle, {}}));
+        } else {
+            auto result = map.find(handle);
+            if (result != map.end()) {
+                sum += result->second->handle;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentMapMixed)->ThreadRange(1, 16)->UseRealTime();
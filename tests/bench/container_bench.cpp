@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "containers/sparse_containers.h"
+
+// Per command small vectors (e.g. bound descriptor sets, barriers) mostly stay within their inline storage
+static void BM_SmallVectorPushBack(benchmark::State &state) {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    for (auto _ : state) {
+        small_vector<uint64_t, 8, uint32_t> vec;
+        for (uint32_t i = 0; i < count; ++i) {
+            vec.emplace_back(i);
+        }
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_SmallVectorPushBack)->Arg(4)->Arg(8)->Arg(32);
+
+static void BM_SmallVectorCopy(benchmark::State &state) {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    small_vector<uint64_t, 8, uint32_t> source;
+    for (uint32_t i = 0; i < count; ++i) {
+        source.emplace_back(i);
+    }
+    for (auto _ : state) {
+        small_vector<uint64_t, 8, uint32_t> copy(source);
+        benchmark::DoNotOptimize(copy.data());
+    }
+}
+BENCHMARK(BM_SmallVectorCopy)->Arg(4)->Arg(32);
+
+// SparseVector as used for per-binding descriptor or per-query state, switching between sparse and dense storage
+using BenchSparseVector = sparse_container::SparseVector<uint32_t, uint32_t, true, 0u, 16>;
+
+static void BM_SparseVectorSetGet(benchmark::State &state) {
+    const auto size = static_cast<uint32_t>(state.range(0));
+    const auto touched = static_cast<uint32_t>(state.range(1));
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<uint32_t> index_dist(0, size - 1);
+    std::vector<uint32_t> indices(touched);
+    for (auto &index : indices) {
+        index = index_dist(rng);
+    }
+    for (auto _ : state) {
+        BenchSparseVector vec(0, size);
+        for (uint32_t i = 0; i < touched; ++i) {
+            vec.Set(indices[i], i + 1);
+        }
+        uint32_t sum = 0;
+        for (const uint32_t index : indices) {
+            sum += vec.Get(index);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * touched * 2);
+}
+BENCHMARK(BM_SparseVectorSetGet)->Args({1024, 8})->Args({1024, 512})->Args({65536, 64});
+
+static void BM_SparseVectorSetRange(benchmark::State &state) {
+    const auto size = static_cast<uint32_t>(state.range(0));
+    const uint32_t span = size / 16;
+    for (auto _ : state) {
+        BenchSparseVector vec(0, size);
+        for (uint32_t start = 0; start + span <= size; start += span) {
+            vec.SetRange(start, start + span, start + 1);
+        }
+        benchmark::DoNotOptimize(vec.Get(size - 1));
+    }
+}
+BENCHMARK(BM_SparseVectorSetRange)->Arg(256)->Arg(4096);
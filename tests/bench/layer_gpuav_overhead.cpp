@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+// Where the time goes with GPU-AV on representative workloads, each submitted over and over:
+//  - GPU time, from timestamps written at the start and end of the command buffer. It includes the instrumented shaders
+//    and the validation passes GPU-AV injects within the command buffer (such as the indirect buffer checks).
+//  - CPU time in vkQueueSubmit, where the command buffers get their validation resources.
+//  - CPU time in vkQueueWaitIdle, and the stall: what the wait takes beyond the GPU time, spent reading back and
+//    processing the GPU-AV output.
+// Running the configs that only enable part of the instrumentation splits the GPU time between the components.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../framework/layer_validation_tests.h"
+#include "../framework/pipeline_helper.h"
+#include "../framework/descriptor_helper.h"
+#include "../framework/ray_tracing_objects.h"
+
+struct GpuAvConfig {
+    const char *name;
+    const char *gpu_based;
+    const char *preset;  // gpuav_instrumentation_preset, nullptr leaves every check on
+};
+
+static const GpuAvConfig kGpuAvConfigs[] = {
+    {"none", "GPU_BASED_NONE", nullptr},
+    {"gpu_av", "GPU_BASED_GPU_ASSISTED", nullptr},
+    {"indirect_only", "GPU_BASED_GPU_ASSISTED", "indirect-only"},
+    {"descriptors_only", "GPU_BASED_GPU_ASSISTED", "descriptors-only"},
+    {"bda_only", "GPU_BASED_GPU_ASSISTED", "bda-only"},
+};
+
+static const char kFullscreenVertexGlsl[] = R"glsl(
+    #version 450
+    void main() {
+        vec2 uv = vec2((gl_VertexIndex << 1) & 2, gl_VertexIndex & 2);
+        gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+    }
+)glsl";
+
+class GpuAvOverhead : public VkLayerTest, public ::testing::WithParamInterface<GpuAvConfig> {
+  public:
+    // Features and extensions of the workload are added before
+    void InitWithConfig();
+
+    // Records the timestamps around what record adds to the command buffer
+    template <typename Fn>
+    void RecordTimed(Fn &&record);
+
+    // Submits the command buffer recorded by RecordTimed() and waits for it, kSubmits times
+    void MeasureSubmits(const char *workload);
+
+  protected:
+    static constexpr uint32_t kSubmits = 50;
+    std::unique_ptr<vkt::QueryPool> timestamps_;
+};
+
+void GpuAvOverhead::InitWithConfig() {
+    const GpuAvConfig &config = GetParam();
+    std::vector<VkLayerSettingEXT> settings = {
+        {OBJECT_LAYER_NAME, "validate_gpu_based", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, &config.gpu_based},
+    };
+    if (config.preset) {
+        settings.push_back({OBJECT_LAYER_NAME, "gpuav_instrumentation_preset", VK_LAYER_SETTING_TYPE_STRING_EXT, 1,
+                            &config.preset});
+    }
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+                                                               static_cast<uint32_t>(settings.size()), settings.data()};
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    if (m_device->phy().queue_properties_[m_device->graphics_queue_node_index_].timestampValidBits == 0) {
+        GTEST_SKIP() << "The graphics queue has no timestamps";
+    }
+    timestamps_ = std::make_unique<vkt::QueryPool>(*m_device, VK_QUERY_TYPE_TIMESTAMP, 2);
+}
+
+template <typename Fn>
+void GpuAvOverhead::RecordTimed(Fn &&record) {
+    m_commandBuffer->begin();
+    vk::CmdResetQueryPool(m_commandBuffer->handle(), timestamps_->handle(), 0, 2);
+    vk::CmdWriteTimestamp(m_commandBuffer->handle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestamps_->handle(), 0);
+    record();
+    vk::CmdWriteTimestamp(m_commandBuffer->handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestamps_->handle(), 1);
+    m_commandBuffer->end();
+}
+
+void GpuAvOverhead::MeasureSubmits(const char *workload) {
+    const uint32_t valid_bits = m_device->phy().queue_properties_[m_device->graphics_queue_node_index_].timestampValidBits;
+    const uint64_t timestamp_mask = valid_bits >= 64 ? ~0ull : (1ull << valid_bits) - 1;
+    const double timestamp_period = m_device->phy().limits_.timestampPeriod;
+
+    double gpu_ns = 0.0;
+    double submit_ns = 0.0;
+    double wait_ns = 0.0;
+    double stall_ns = 0.0;
+    for (uint32_t i = 0; i < kSubmits; ++i) {
+        VkSubmitInfo submit_info = vku::InitStructHelper();
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &m_commandBuffer->handle();
+        const auto start = std::chrono::steady_clock::now();
+        vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+        const auto submitted = std::chrono::steady_clock::now();
+        vk::QueueWaitIdle(m_default_queue->handle());
+        const auto end = std::chrono::steady_clock::now();
+
+        uint64_t ticks[2] = {};
+        vk::GetQueryPoolResults(device(), timestamps_->handle(), 0, 2, sizeof(ticks), ticks, sizeof(uint64_t),
+                                VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+        const double gpu = double((ticks[1] - ticks[0]) & timestamp_mask) * timestamp_period;
+        const double wait = std::chrono::duration<double, std::nano>(end - submitted).count();
+        gpu_ns += gpu;
+        submit_ns += std::chrono::duration<double, std::nano>(submitted - start).count();
+        wait_ns += wait;
+        stall_ns += wait > gpu ? wait - gpu : 0.0;
+    }
+
+    const char *config = GetParam().name;
+    printf("%-16s %-28s gpu %10.1f us  submit %10.1f us  wait %10.1f us  stall %10.1f us (per submit, %u submits)\n", config,
+           workload, gpu_ns / kSubmits / 1000.0, submit_ns / kSubmits / 1000.0, wait_ns / kSubmits / 1000.0,
+           stall_ns / kSubmits / 1000.0, kSubmits);
+    RecordProperty(std::string(workload) + "_gpu_ns_per_call", std::to_string(gpu_ns / kSubmits));
+    RecordProperty(std::string(workload) + "_submit_ns_per_call", std::to_string(submit_ns / kSubmits));
+    RecordProperty(std::string(workload) + "_wait_ns_per_call", std::to_string(wait_ns / kSubmits));
+    RecordProperty(std::string(workload) + "_stall_ns_per_call", std::to_string(stall_ns / kSubmits));
+}
+
+TEST_P(GpuAvOverhead, BindlessFragmentShading) {
+    TEST_DESCRIPTION("16 fullscreen draws, each fragment reading a storage buffer picked from a large array by its position");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::runtimeDescriptorArray);
+    AddRequiredFeature(vkt::Feature::shaderStorageBufferArrayNonUniformIndexing);
+    RETURN_IF_SKIP(InitWithConfig());
+    InitRenderTarget();
+
+    const VkPhysicalDeviceLimits &limits = m_device->phy().limits_;
+    const uint32_t count = std::min({1024u, limits.maxPerStageDescriptorStorageBuffers, limits.maxDescriptorSetStorageBuffers});
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    OneOffDescriptorSet descriptor_set(m_device,
+                                       {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    for (uint32_t i = 0; i < count; ++i) {
+        descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, i);
+    }
+    descriptor_set.UpdateDescriptorSets();
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+
+    const std::string fs_source = R"glsl(
+        #version 450
+        #extension GL_EXT_nonuniform_qualifier : enable
+        layout(set = 0, binding = 0) readonly buffer SSBO { vec4 color; } buffers[];
+        layout(location = 0) out vec4 out_color;
+        void main() {
+            uint index = (uint(gl_FragCoord.x) + uint(gl_FragCoord.y)) % )glsl" +
+                                  std::to_string(count) + R"glsl(u;
+            out_color = buffers[nonuniformEXT(index)].color;
+        }
+    )glsl";
+    VkShaderObj vs(this, kFullscreenVertexGlsl, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, fs_source.c_str(), VK_SHADER_STAGE_FRAGMENT_BIT, SPV_ENV_VULKAN_1_2);
+    CreatePipelineHelper pipe(*this);
+    pipe.InitState();
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.gp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateGraphicsPipeline();
+
+    RecordTimed([&]() {
+        m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        for (uint32_t i = 0; i < 16; ++i) {
+            vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+        }
+        m_commandBuffer->EndRenderPass();
+    });
+    MeasureSubmits("bindless_fragment_shading");
+}
+
+TEST_P(GpuAvOverhead, IndirectDraws) {
+    TEST_DESCRIPTION("1024 vkCmdDrawIndirect calls, each followed by GPU-AV checks of the indirect buffer");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    RETURN_IF_SKIP(InitWithConfig());
+    InitRenderTarget();
+
+    constexpr uint32_t kDraws = 1024;
+    vkt::Buffer indirect_buffer(*m_device, kDraws * sizeof(VkDrawIndirectCommand), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+                                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    auto *draws = static_cast<VkDrawIndirectCommand *>(indirect_buffer.memory().map());
+    for (uint32_t i = 0; i < kDraws; ++i) {
+        draws[i] = {3, 1, 0, 0};
+    }
+    indirect_buffer.memory().unmap();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitState();
+    pipe.CreateGraphicsPipeline();
+
+    RecordTimed([&]() {
+        m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+        for (uint32_t i = 0; i < kDraws; ++i) {
+            vk::CmdDrawIndirect(m_commandBuffer->handle(), indirect_buffer.handle(), i * sizeof(VkDrawIndirectCommand), 1,
+                                sizeof(VkDrawIndirectCommand));
+        }
+        m_commandBuffer->EndRenderPass();
+    });
+    MeasureSubmits("indirect_draws");
+}
+
+TEST_P(GpuAvOverhead, BufferDeviceAddressCompute) {
+    TEST_DESCRIPTION("A compute dispatch of 64k invocations, each making 64 loads through a buffer device address");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    RETURN_IF_SKIP(InitWithConfig());
+
+    constexpr uint32_t kValues = 1 << 20;
+    VkMemoryAllocateFlagsInfo allocate_flag_info = vku::InitStructHelper();
+    allocate_flag_info.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+    vkt::Buffer buffer(*m_device, kValues * sizeof(uint32_t),
+                       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+                       VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &allocate_flag_info);
+
+    static const char cs_source[] = R"glsl(
+        #version 450
+        #extension GL_EXT_buffer_reference : require
+        layout(buffer_reference, std430) buffer Values { uint values[]; };
+        layout(push_constant) uniform PushConstants {
+            Values data;
+            uint count;
+        };
+        layout(local_size_x = 64) in;
+        void main() {
+            uint sum = 0;
+            for (uint i = 0; i < 64; ++i) {
+                sum += data.values[(gl_GlobalInvocationID.x + i * 4099) % count];
+            }
+            data.values[gl_GlobalInvocationID.x % count] = sum;
+        }
+    )glsl";
+    struct PushConstants {
+        VkDeviceAddress data;
+        uint32_t count;
+    };
+    const PushConstants push_constants = {buffer.address(), kValues};
+    const VkPushConstantRange push_constant_range = {VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(PushConstants)};
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
+    pipe.pipeline_layout_ci_.pushConstantRangeCount = 1;
+    pipe.pipeline_layout_ci_.pPushConstantRanges = &push_constant_range;
+    pipe.InitState();
+    pipe.CreateComputePipeline();
+
+    RecordTimed([&]() {
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+        vk::CmdPushConstants(m_commandBuffer->handle(), pipe.pipeline_layout_.handle(), VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                             sizeof(push_constants), &push_constants);
+        vk::CmdDispatch(m_commandBuffer->handle(), 1024, 1, 1);
+    });
+    MeasureSubmits("buffer_device_address_compute");
+}
+
+TEST_P(GpuAvOverhead, RayTracing) {
+    TEST_DESCRIPTION("Tracing 256x256 rays against a single triangle acceleration structure");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME);
+    AddRequiredExtensions(VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME);
+    AddRequiredExtensions(VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::rayTracingPipeline);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    RETURN_IF_SKIP(InitWithConfig());
+
+    static const char ray_gen_source[] = R"glsl(
+        #version 460
+        #extension GL_EXT_ray_tracing : require
+        layout(set = 0, binding = 0) uniform accelerationStructureEXT tlas;
+        layout(location = 0) rayPayloadEXT float hit_value;
+        void main() {
+            vec2 uv = (vec2(gl_LaunchIDEXT.xy) + 0.5) / vec2(gl_LaunchSizeEXT.xy);
+            traceRayEXT(tlas, gl_RayFlagsOpaqueEXT | gl_RayFlagsSkipClosestHitShaderEXT, 0xff, 0, 0, 0,
+                        vec3(uv * 2.0 - 1.0, -1.0), 0.0, vec3(0.0, 0.0, 1.0), 100.0, 0);
+        }
+    )glsl";
+    vkt::rt::Pipeline pipeline(*this, m_device);
+    auto top_level_accel_struct =
+        std::make_shared<vkt::as::BuildGeometryInfoKHR>(vkt::as::blueprint::BuildOnDeviceTopLevel(*m_device, *m_commandBuffer));
+    pipeline.AddTopLevelAccelStructBinding(std::move(top_level_accel_struct), 0);
+    pipeline.SetRayGenShader(ray_gen_source);
+    pipeline.AddMissShader(kRayTracingPayloadMinimalGlsl);
+    pipeline.Build();
+
+    RecordTimed([&]() {
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR,
+                                  pipeline.GetPipelineLayout(), 0, 1, &pipeline.GetDescriptorSet()->set_, 0, nullptr);
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR, pipeline.Handle());
+        vkt::rt::TraceRaysSbt trace_rays_sbt = pipeline.GetTraceRaysSbt();
+        vk::CmdTraceRaysKHR(m_commandBuffer->handle(), &trace_rays_sbt.ray_gen_sbt, &trace_rays_sbt.miss_sbt,
+                            &trace_rays_sbt.hit_sbt, &trace_rays_sbt.callable_sbt, 256, 256, 1);
+    });
+    MeasureSubmits("ray_tracing");
+}
+
+INSTANTIATE_TEST_SUITE_P(Configs, GpuAvOverhead, ::testing::ValuesIn(kGpuAvConfigs),
+                         [](const ::testing::TestParamInfo<GpuAvConfig> &info) { return std::string(info.param.name); });
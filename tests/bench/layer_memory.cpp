@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+// Host memory held by the layer in the scenarios that grow it the most, checked against a budget per scenario. The budgets
+// are the current high-water marks with headroom: lower them when the footprint goes down, and treat a failure as a
+// footprint regression rather than raising them.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../framework/layer_validation_tests.h"
+#include "../framework/layer_memory_monitor.h"
+#include "../framework/pipeline_helper.h"
+#include "../framework/descriptor_helper.h"
+
+static constexpr uint64_t kMiB = 1024 * 1024;
+
+class LayerMemoryBudget : public VkLayerTest {
+  public:
+    // The memory report is turned on in addition to the given settings
+    void InitWithSettings(std::vector<VkLayerSettingEXT> settings, uint32_t api_version = VK_API_VERSION_1_1);
+
+    // Fails when the layer grew by more than budget bytes since before, at any sample
+    void CheckBudget(const char *scenario, const LayerMemoryMonitor &monitor, uint64_t before, uint64_t after, uint64_t budget);
+};
+
+void LayerMemoryBudget::InitWithSettings(std::vector<VkLayerSettingEXT> settings, uint32_t api_version) {
+    settings.push_back(LayerMemoryMonitor::MemoryReportSetting());
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+                                                               static_cast<uint32_t>(settings.size()), settings.data()};
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    SetTargetApiVersion(api_version);
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+}
+
+void LayerMemoryBudget::CheckBudget(const char *scenario, const LayerMemoryMonitor &monitor, uint64_t before, uint64_t after,
+                                    uint64_t budget) {
+    const uint64_t growth = monitor.HighWaterMark() > before ? monitor.HighWaterMark() - before : 0;
+    printf("%-28s before %8.1f MiB  after %8.1f MiB  high-water %8.1f MiB  growth %8.1f / %.0f MiB  process peak %8.1f MiB\n",
+           scenario, double(before) / kMiB, double(after) / kMiB, double(monitor.HighWaterMark()) / kMiB, double(growth) / kMiB,
+           double(budget) / kMiB, double(LayerMemoryMonitor::ProcessPeakResidentBytes()) / kMiB);
+    RecordProperty(std::string(scenario) + "_high_water_bytes", std::to_string(monitor.HighWaterMark()));
+    RecordProperty(std::string(scenario) + "_growth_bytes", std::to_string(growth));
+    EXPECT_LE(growth, budget) << scenario << " grew the layer footprint past its budget";
+}
+
+TEST_F(LayerMemoryBudget, SyncValLargeFrame) {
+    TEST_DESCRIPTION("A frame of many small copies between 64 buffers and into 8 images, with synchronization validation");
+    const VkBool32 enabled = VK_TRUE;
+    RETURN_IF_SKIP(InitWithSettings({{OBJECT_LAYER_NAME, "validate_sync", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &enabled}}));
+    RETURN_IF_SKIP(InitState());
+    LayerMemoryMonitor monitor(instance());
+    const uint64_t before = monitor.Sample(m_default_queue->handle());
+
+    constexpr uint32_t kBuffers = 64;
+    constexpr VkDeviceSize kBufferSize = 1024 * 1024;
+    constexpr VkDeviceSize kCopySize = 4096;
+    constexpr uint32_t kPasses = 64;
+    constexpr uint32_t kImages = 8;
+    constexpr uint32_t kImageSize = 512;
+    constexpr uint32_t kTile = 64;
+
+    std::vector<std::unique_ptr<vkt::Buffer>> buffers;
+    for (uint32_t i = 0; i < kBuffers; ++i) {
+        buffers.emplace_back(std::make_unique<vkt::Buffer>(*m_device, kBufferSize,
+                                                           VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT));
+    }
+    std::vector<std::unique_ptr<VkImageObj>> images;
+    for (uint32_t i = 0; i < kImages; ++i) {
+        images.emplace_back(std::make_unique<VkImageObj>(m_device));
+        images.back()->Init(kImageSize, kImageSize, 1, VK_FORMAT_R8G8B8A8_UNORM,
+                            VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_IMAGE_TILING_OPTIMAL);
+        images.back()->SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    }
+
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    m_commandBuffer->begin();
+    for (uint32_t pass = 0; pass < kPasses; ++pass) {
+        // Each pass touches a new range of every buffer and a new tile of every image, so the access maps keep growing
+        for (uint32_t i = 0; i < kBuffers; ++i) {
+            const VkBufferCopy region = {pass * kCopySize, (pass * kCopySize + kBufferSize / 2) % kBufferSize, kCopySize};
+            vk::CmdCopyBuffer(m_commandBuffer->handle(), buffers[i]->handle(), buffers[(i + 1) % kBuffers]->handle(), 1, &region);
+        }
+        for (uint32_t i = 0; i < kImages; ++i) {
+            VkBufferImageCopy region = {};
+            region.bufferOffset = pass * kCopySize;
+            region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+            region.imageOffset = {static_cast<int32_t>((pass * kTile) % kImageSize),
+                                  static_cast<int32_t>((pass * kTile / kImageSize) * kTile % kImageSize), 0};
+            region.imageExtent = {kTile, kTile, 1};
+            vk::CmdCopyBufferToImage(m_commandBuffer->handle(), buffers[i]->handle(), images[i]->handle(),
+                                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+        }
+        vk::CmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1,
+                               &barrier, 0, nullptr, 0, nullptr);
+    }
+    m_commandBuffer->end();
+    monitor.Sample(m_default_queue->handle());
+
+    m_commandBuffer->QueueCommandBuffer();
+    m_default_queue->wait();
+    const uint64_t after = monitor.Sample(m_default_queue->handle());
+    CheckBudget("sync_val_large_frame", monitor, before, after, 256 * kMiB);
+}
+
+TEST_F(LayerMemoryBudget, GpuAvManyPipelines) {
+    TEST_DESCRIPTION("128 instrumented compute pipelines, each dispatched once, with GPU-AV");
+    const char *gpu_based = "GPU_BASED_GPU_ASSISTED";
+    RETURN_IF_SKIP(
+        InitWithSettings({{OBJECT_LAYER_NAME, "validate_gpu_based", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, &gpu_based}}));
+    RETURN_IF_SKIP(InitState());
+    LayerMemoryMonitor monitor(instance());
+    const uint64_t before = monitor.Sample(m_default_queue->handle());
+
+    constexpr uint32_t kPipelines = 128;
+    vkt::Buffer buffer(*m_device, 4096, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    std::vector<std::unique_ptr<CreateComputePipelineHelper>> pipes;
+    for (uint32_t i = 0; i < kPipelines; ++i) {
+        // A different shader each time, the instrumentation of identical shaders could be shared
+        const std::string cs_source = R"glsl(
+            #version 450
+            layout(set = 0, binding = 0) buffer SSBO { uint data[]; };
+            void main() {
+                data[gl_GlobalInvocationID.x + )glsl" + std::to_string(i % 64) + R"glsl(] = )glsl" +
+                                      std::to_string(i) + R"glsl(;
+            }
+        )glsl";
+        auto pipe = std::make_unique<CreateComputePipelineHelper>(*this);
+        pipe->dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+        pipe->InitState();
+        pipe->cs_ = std::make_unique<VkShaderObj>(this, cs_source.c_str(), VK_SHADER_STAGE_COMPUTE_BIT);
+        pipe->CreateComputePipeline();
+        pipe->descriptor_set_->WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        pipe->descriptor_set_->UpdateDescriptorSets();
+        pipes.emplace_back(std::move(pipe));
+    }
+    monitor.Sample(m_default_queue->handle());
+
+    m_commandBuffer->begin();
+    for (const auto &pipe : pipes) {
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe->pipeline_);
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe->pipeline_layout_.handle(), 0,
+                                  1, &pipe->descriptor_set_->set_, 0, nullptr);
+        vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    }
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer();
+    m_default_queue->wait();
+    const uint64_t after = monitor.Sample(m_default_queue->handle());
+    CheckBudget("gpu_av_many_pipelines", monitor, before, after, 128 * kMiB);
+}
+
+TEST_F(LayerMemoryBudget, BindlessDescriptors) {
+    TEST_DESCRIPTION("A partially bound runtime array of up to 16k storage buffers, fully written and bound for 1000 dispatches");
+    RETURN_IF_SKIP(InitWithSettings({}, VK_API_VERSION_1_2));
+    AddRequiredFeature(vkt::Feature::runtimeDescriptorArray);
+    AddRequiredFeature(vkt::Feature::descriptorBindingPartiallyBound);
+    AddRequiredFeature(vkt::Feature::shaderStorageBufferArrayNonUniformIndexing);
+    RETURN_IF_SKIP(InitState());
+    LayerMemoryMonitor monitor(instance());
+    const uint64_t before = monitor.Sample(m_default_queue->handle());
+
+    const VkPhysicalDeviceLimits &limits = m_device->phy().limits_;
+    const uint32_t count = std::min({16384u, limits.maxPerStageDescriptorStorageBuffers, limits.maxDescriptorSetStorageBuffers,
+                                     limits.maxPerStageResources});
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    const VkDescriptorBindingFlags binding_flags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+    VkDescriptorSetLayoutBindingFlagsCreateInfo flags_create_info = vku::InitStructHelper();
+    flags_create_info.bindingCount = 1;
+    flags_create_info.pBindingFlags = &binding_flags;
+    OneOffDescriptorSet descriptor_set(
+        m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, count, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}}, 0, &flags_create_info);
+    for (uint32_t i = 0; i < count; ++i) {
+        descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, i);
+    }
+    descriptor_set.UpdateDescriptorSets();
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+
+    static const char cs_source[] = R"glsl(
+        #version 450
+        #extension GL_EXT_nonuniform_qualifier : enable
+        layout(set = 0, binding = 0) buffer SSBO { uint data; } buffers[];
+        void main() {
+            buffers[nonuniformEXT(gl_WorkGroupID.x)].data = 1;
+        }
+    )glsl";
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitState();
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
+    pipe.cp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateComputePipeline();
+    monitor.Sample(m_default_queue->handle());
+
+    constexpr uint32_t kDispatches = 1000;
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+    for (uint32_t i = 0; i < kDispatches; ++i) {
+        vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                                  &descriptor_set.set_, 0, nullptr);
+        vk::CmdDispatch(m_commandBuffer->handle(), std::min(count, 64u), 1, 1);
+    }
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer();
+    m_default_queue->wait();
+    const uint64_t after = monitor.Sample(m_default_queue->handle());
+    CheckBudget("bindless_descriptors", monitor, before, after, 64 * kMiB);
+}
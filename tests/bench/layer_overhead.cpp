@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+// Layer overhead of canonical workloads, run once with each validation object enabled on its own. The time per call is
+// printed and recorded as a gtest property, so it also ends up in the --gtest_output=xml report.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../framework/layer_validation_tests.h"
+#include "../framework/pipeline_helper.h"
+#include "../framework/descriptor_helper.h"
+
+struct LayerConfig {
+    const char *name;
+    VkBool32 core;
+    VkBool32 thread_safety;
+    VkBool32 object_lifetime;
+    VkBool32 stateless_param;
+    VkBool32 unique_handles;
+    VkBool32 sync;
+    VkBool32 best_practices;
+    const char *gpu_based;
+};
+
+// "none" still goes through the layer, with every validation object disabled
+static const LayerConfig kLayerConfigs[] = {
+    {"none", false, false, false, false, false, false, false, "GPU_BASED_NONE"},
+    {"core", true, false, false, false, false, false, false, "GPU_BASED_NONE"},
+    {"thread_safety", false, true, false, false, false, false, false, "GPU_BASED_NONE"},
+    {"object_lifetime", false, false, true, false, false, false, false, "GPU_BASED_NONE"},
+    {"stateless_param", false, false, false, true, false, false, false, "GPU_BASED_NONE"},
+    {"unique_handles", false, false, false, false, true, false, false, "GPU_BASED_NONE"},
+    {"sync", false, false, false, false, false, true, false, "GPU_BASED_NONE"},
+    {"best_practices", false, false, false, false, false, false, true, "GPU_BASED_NONE"},
+    {"gpu_av", false, false, false, false, false, false, false, "GPU_BASED_GPU_ASSISTED"},
+};
+
+class LayerOverhead : public VkLayerTest, public ::testing::WithParamInterface<LayerConfig> {
+  public:
+    void InitWithConfig(VkPhysicalDeviceFeatures *features = nullptr);
+
+    // Reports the time spent in fn divided by the number of calls it made
+    template <typename Fn>
+    void Measure(const char *what, uint32_t calls, Fn &&fn) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const auto end = std::chrono::steady_clock::now();
+        const double ns_per_call = std::chrono::duration<double, std::nano>(end - start).count() / calls;
+        printf("%-16s %-32s %12.1f ns/call (%u calls)\n", GetParam().name, what, ns_per_call, calls);
+        RecordProperty(std::string(what) + "_ns_per_call", std::to_string(ns_per_call));
+    }
+};
+
+void LayerOverhead::InitWithConfig(VkPhysicalDeviceFeatures *features) {
+    const LayerConfig &config = GetParam();
+    const VkLayerSettingEXT settings[] = {
+        {OBJECT_LAYER_NAME, "validate_core", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &config.core},
+        {OBJECT_LAYER_NAME, "thread_safety", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &config.thread_safety},
+        {OBJECT_LAYER_NAME, "object_lifetime", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &config.object_lifetime},
+        {OBJECT_LAYER_NAME, "stateless_param", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &config.stateless_param},
+        {OBJECT_LAYER_NAME, "unique_handles", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &config.unique_handles},
+        {OBJECT_LAYER_NAME, "validate_sync", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &config.sync},
+        {OBJECT_LAYER_NAME, "validate_best_practices", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &config.best_practices},
+        {OBJECT_LAYER_NAME, "validate_gpu_based", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, &config.gpu_based},
+    };
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+                                                               static_cast<uint32_t>(std::size(settings)), settings};
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState(features));
+    // Best practices warnings are part of the measured overhead, not failures
+    m_errorMonitor->ExpectSuccess(kErrorBit);
+}
+
+TEST_P(LayerOverhead, DrawsWithDescriptorRebinding) {
+    TEST_DESCRIPTION("100k draws, alternating between two descriptor sets before each one");
+    RETURN_IF_SKIP(InitWithConfig());
+    InitRenderTarget();
+
+    vkt::Buffer uniform_buffer(*m_device, 256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    OneOffDescriptorSet set_a(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    OneOffDescriptorSet set_b(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    for (OneOffDescriptorSet *set : {&set_a, &set_b}) {
+        set->WriteDescriptorBufferInfo(0, uniform_buffer.handle(), 0, VK_WHOLE_SIZE);
+        set->UpdateDescriptorSets();
+    }
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&set_a.layout_});
+
+    static const char fragment_shader[] = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) uniform UBO { vec4 color; };
+        layout(location = 0) out vec4 out_color;
+        void main() {
+            out_color = color;
+        }
+    )glsl";
+    VkShaderObj fs(this, fragment_shader, VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.InitState();
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.gp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateGraphicsPipeline();
+
+    constexpr uint32_t kDraws = 100000;
+    const VkDescriptorSet sets[2] = {set_a.set_, set_b.set_};
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    Measure("bind_and_draw", kDraws, [&]() {
+        for (uint32_t i = 0; i < kDraws; ++i) {
+            vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                                      &sets[i & 1], 0, nullptr);
+            vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+        }
+    });
+    m_commandBuffer->EndRenderPass();
+    Measure("end_command_buffer", 1, [&]() { m_commandBuffer->end(); });
+    Measure("submit_draws", 1, [&]() { m_commandBuffer->QueueCommandBuffer(); });
+    m_default_queue->wait();
+}
+
+TEST_P(LayerOverhead, LayeredImageBarriers) {
+    TEST_DESCRIPTION("10k layout transitions, each on a single layer of a 64 layer image");
+    RETURN_IF_SKIP(InitWithConfig());
+
+    constexpr uint32_t kLayers = 64;
+    VkImageObj image(m_device);
+    image.InitNoLayout(VkImageObj::ImageCreateInfo2D(64, 64, 1, kLayers, VK_FORMAT_R8G8B8A8_UNORM,
+                                                     VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT));
+    ASSERT_TRUE(image.initialized());
+
+    VkImageMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image.handle();
+    barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, kLayers};
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    constexpr uint32_t kBarriers = 10000;
+    m_commandBuffer->begin();
+    vk::CmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                           nullptr, 0, nullptr, 1, &barrier);
+    barrier.subresourceRange.layerCount = 1;
+    Measure("image_layer_barrier", kBarriers, [&]() {
+        for (uint32_t i = 0; i < kBarriers; ++i) {
+            // Each layer goes back and forth between the two layouts
+            const bool to_src = ((i / kLayers) & 1) == 0;
+            barrier.subresourceRange.baseArrayLayer = i % kLayers;
+            barrier.oldLayout = to_src ? VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.newLayout = to_src ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.srcAccessMask = to_src ? VK_ACCESS_TRANSFER_WRITE_BIT : VK_ACCESS_TRANSFER_READ_BIT;
+            barrier.dstAccessMask = to_src ? VK_ACCESS_TRANSFER_READ_BIT : VK_ACCESS_TRANSFER_WRITE_BIT;
+            vk::CmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                                   nullptr, 0, nullptr, 1, &barrier);
+        }
+    });
+    m_commandBuffer->end();
+    Measure("submit_barriers", 1, [&]() { m_commandBuffer->QueueCommandBuffer(); });
+    m_default_queue->wait();
+}
+
+TEST_P(LayerOverhead, PipelineCreation) {
+    TEST_DESCRIPTION("1k compute pipelines created from the same shader module");
+    RETURN_IF_SKIP(InitWithConfig());
+
+    OneOffDescriptorSet descriptor_set(m_device,
+                                       {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    static const char compute_shader[] = R"glsl(
+        #version 450
+        layout(local_size_x = 64) in;
+        layout(set = 0, binding = 0) buffer SSBO { uint data[]; };
+        void main() {
+            data[gl_GlobalInvocationID.x] += 1;
+        }
+    )glsl";
+    VkShaderObj cs(this, compute_shader, VK_SHADER_STAGE_COMPUTE_BIT);
+
+    VkComputePipelineCreateInfo pipeline_ci = vku::InitStructHelper();
+    pipeline_ci.stage = cs.GetStageCreateInfo();
+    pipeline_ci.layout = pipeline_layout.handle();
+
+    constexpr uint32_t kPipelines = 1000;
+    std::vector<VkPipeline> pipelines(kPipelines, VK_NULL_HANDLE);
+    Measure("create_compute_pipeline", kPipelines, [&]() {
+        for (uint32_t i = 0; i < kPipelines; ++i) {
+            vk::CreateComputePipelines(device(), VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &pipelines[i]);
+        }
+    });
+    Measure("destroy_pipeline", kPipelines, [&]() {
+        for (VkPipeline pipeline : pipelines) {
+            vk::DestroyPipeline(device(), pipeline, nullptr);
+        }
+    });
+}
+
+TEST_P(LayerOverhead, LargeDescriptorUpdates) {
+    TEST_DESCRIPTION("1k updates, each writing all 1024 descriptors of a binding");
+    RETURN_IF_SKIP(InitWithConfig());
+
+    constexpr uint32_t kDescriptors = 1024;
+    OneOffDescriptorSet descriptor_set(
+        m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, kDescriptors, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+    ASSERT_TRUE(descriptor_set.Initialized());
+    vkt::Buffer storage_buffer(*m_device, kDescriptors * 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    std::vector<VkDescriptorBufferInfo> buffer_infos(kDescriptors);
+    for (uint32_t i = 0; i < kDescriptors; ++i) {
+        buffer_infos[i] = {storage_buffer.handle(), i * 16, 16};
+    }
+    VkWriteDescriptorSet write = vku::InitStructHelper();
+    write.dstSet = descriptor_set.set_;
+    write.dstBinding = 0;
+    write.descriptorCount = kDescriptors;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    write.pBufferInfo = buffer_infos.data();
+
+    constexpr uint32_t kUpdates = 1000;
+    Measure("update_1024_descriptors", kUpdates, [&]() {
+        for (uint32_t i = 0; i < kUpdates; ++i) {
+            vk::UpdateDescriptorSets(device(), 1, &write, 0, nullptr);
+        }
+    });
+}
+
+TEST_P(LayerOverhead, BurstySmallSubmits) {
+    TEST_DESCRIPTION("1k submissions of a small command buffer, waiting for the queue after every burst of 16");
+    RETURN_IF_SKIP(InitWithConfig());
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    m_commandBuffer->begin(VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT);
+    vk::CmdFillBuffer(m_commandBuffer->handle(), buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    vk::CmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier,
+                           0, nullptr, 0, nullptr);
+    m_commandBuffer->end();
+
+    VkSubmitInfo submit_info = vku::InitStructHelper();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+
+    constexpr uint32_t kSubmits = 1000;
+    constexpr uint32_t kBurst = 16;
+    Measure("small_submit", kSubmits, [&]() {
+        for (uint32_t i = 0; i < kSubmits; ++i) {
+            vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+            if ((i % kBurst) == kBurst - 1) {
+                m_default_queue->wait();
+            }
+        }
+        m_default_queue->wait();
+    });
+}
+
+INSTANTIATE_TEST_SUITE_P(ValidationObjects, LayerOverhead, ::testing::ValuesIn(kLayerConfigs),
+                         [](const ::testing::TestParamInfo<LayerConfig> &info) { return std::string(info.param.name); });
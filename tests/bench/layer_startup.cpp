@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+// Time the layer adds before an application can start rendering: instance and device creation with the heavier validation
+// objects enabled, and creating a corpus of large shader modules with and without the shader validation cache on disk.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "utils/vk_layer_utils.h"
+#include "../framework/layer_validation_tests.h"
+
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#include <unistd.h>
+#endif
+
+struct StartupConfig {
+    const char *name;
+    VkBool32 sync;
+    VkBool32 best_practices;
+    const char *gpu_based;
+};
+
+static const StartupConfig kStartupConfigs[] = {
+    {"default", false, false, "GPU_BASED_NONE"},
+    {"gpu_av", false, false, "GPU_BASED_GPU_ASSISTED"},
+    {"sync", true, false, "GPU_BASED_NONE"},
+    {"best_practices", false, true, "GPU_BASED_NONE"},
+};
+
+class StartupBenchmark : public VkLayerTest {
+  public:
+    // The settings are kept alive for the instances created by the test itself
+    void InitWithSettings(const std::vector<VkLayerSettingEXT> &settings);
+
+    VkInstance CreateInstance();
+    VkDevice CreateDevice();
+
+    // Reports the average time of one of count operations that took ms in total
+    void Report(const char *config, const char *what, uint32_t count, double ms);
+
+  private:
+    std::vector<VkLayerSettingEXT> settings_;
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info_ = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT};
+};
+
+static double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void StartupBenchmark::InitWithSettings(const std::vector<VkLayerSettingEXT> &settings) {
+    settings_ = settings;
+    layer_settings_create_info_.settingCount = static_cast<uint32_t>(settings_.size());
+    layer_settings_create_info_.pSettings = settings_.data();
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info_));
+    // Best practices warnings don't fail a benchmark
+    m_errorMonitor->ExpectSuccess(kErrorBit);
+}
+
+VkInstance StartupBenchmark::CreateInstance() {
+    VkInstanceCreateInfo instance_ci = GetInstanceCreateInfo();
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = layer_settings_create_info_;
+    layer_settings_create_info.pNext = instance_ci.pNext;
+    instance_ci.pNext = &layer_settings_create_info;
+    VkInstance instance = VK_NULL_HANDLE;
+    EXPECT_EQ(VK_SUCCESS, vk::CreateInstance(&instance_ci, nullptr, &instance));
+    return instance;
+}
+
+VkDevice StartupBenchmark::CreateDevice() {
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_ci = vku::InitStructHelper();
+    queue_ci.queueFamilyIndex = 0;
+    queue_ci.queueCount = 1;
+    queue_ci.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_ci = vku::InitStructHelper();
+    device_ci.queueCreateInfoCount = 1;
+    device_ci.pQueueCreateInfos = &queue_ci;
+    VkDevice device = VK_NULL_HANDLE;
+    EXPECT_EQ(VK_SUCCESS, vk::CreateDevice(gpu(), &device_ci, nullptr, &device));
+    return device;
+}
+
+void StartupBenchmark::Report(const char *config, const char *what, uint32_t count, double ms) {
+    const double ms_per_call = ms / count;
+    printf("%-16s %-36s %10.3f ms/call (%u calls)\n", config, what, ms_per_call, count);
+    RecordProperty(std::string(what) + "_ms_per_call", std::to_string(ms_per_call));
+}
+
+class LayerStartup : public StartupBenchmark, public ::testing::WithParamInterface<StartupConfig> {
+  public:
+    void InitWithConfig() {
+        const StartupConfig &config = GetParam();
+        InitWithSettings({
+            {OBJECT_LAYER_NAME, "validate_sync", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &config.sync},
+            {OBJECT_LAYER_NAME, "validate_best_practices", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &config.best_practices},
+            {OBJECT_LAYER_NAME, "validate_gpu_based", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, &config.gpu_based},
+        });
+    }
+};
+
+TEST_P(LayerStartup, CreateInstance) {
+    TEST_DESCRIPTION("Creating and destroying an instance with the layer enabled, 20 times");
+    RETURN_IF_SKIP(InitWithConfig());
+
+    constexpr uint32_t kIterations = 20;
+    double create_ms = 0.0;
+    double destroy_ms = 0.0;
+    for (uint32_t i = 0; i < kIterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        VkInstance instance = CreateInstance();
+        create_ms += MillisecondsSince(start);
+        ASSERT_NE(VK_NULL_HANDLE, instance);
+
+        start = std::chrono::steady_clock::now();
+        vk::DestroyInstance(instance, nullptr);
+        destroy_ms += MillisecondsSince(start);
+    }
+    Report(GetParam().name, "create_instance", kIterations, create_ms);
+    Report(GetParam().name, "destroy_instance", kIterations, destroy_ms);
+}
+
+TEST_P(LayerStartup, CreateDevice) {
+    TEST_DESCRIPTION("Creating and destroying a device with a single queue, 20 times");
+    RETURN_IF_SKIP(InitWithConfig());
+
+    constexpr uint32_t kIterations = 20;
+    double create_ms = 0.0;
+    double destroy_ms = 0.0;
+    for (uint32_t i = 0; i < kIterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        VkDevice device = CreateDevice();
+        create_ms += MillisecondsSince(start);
+        ASSERT_NE(VK_NULL_HANDLE, device);
+
+        start = std::chrono::steady_clock::now();
+        vk::DestroyDevice(device, nullptr);
+        destroy_ms += MillisecondsSince(start);
+    }
+    Report(GetParam().name, "create_device", kIterations, create_ms);
+    Report(GetParam().name, "destroy_device", kIterations, destroy_ms);
+}
+
+INSTANTIATE_TEST_SUITE_P(ValidationObjects, LayerStartup, ::testing::ValuesIn(kStartupConfigs),
+                         [](const ::testing::TestParamInfo<StartupConfig> &info) { return std::string(info.param.name); });
+
+class LayerShaderStartup : public StartupBenchmark {
+  public:
+    // 32 compute shaders of about 2000 statements each, all different so none of them hits the cache of another
+    std::vector<std::vector<uint32_t>> CompileCorpus();
+
+    // Creates and destroys every module of the corpus on device
+    double CreateShaderModules(VkDevice device, const std::vector<std::vector<uint32_t>> &corpus);
+};
+
+std::vector<std::vector<uint32_t>> LayerShaderStartup::CompileCorpus() {
+    constexpr uint32_t kModules = 32;
+    constexpr uint32_t kStatements = 2000;
+    VkPhysicalDeviceProperties properties;
+    vk::GetPhysicalDeviceProperties(gpu(), &properties);
+
+    std::vector<std::vector<uint32_t>> corpus(kModules);
+    for (uint32_t module = 0; module < kModules; ++module) {
+        std::string source = R"glsl(
+            #version 450
+            layout(set = 0, binding = 0) buffer SSBO { vec4 data[]; };
+            void main() {
+                vec4 v = data[gl_GlobalInvocationID.x];
+        )glsl";
+        for (uint32_t statement = 0; statement < kStatements; ++statement) {
+            source += "v = fract(v * " + std::to_string(module + 1) + "." + std::to_string(statement) +
+                      " + data[gl_GlobalInvocationID.x + " + std::to_string(statement % 97) + "u]);\n";
+        }
+        source += "data[gl_GlobalInvocationID.x] = v;\n}\n";
+        EXPECT_TRUE(GLSLtoSPV(&properties.limits, VK_SHADER_STAGE_COMPUTE_BIT, source.c_str(), corpus[module]));
+    }
+    return corpus;
+}
+
+double LayerShaderStartup::CreateShaderModules(VkDevice device, const std::vector<std::vector<uint32_t>> &corpus) {
+    std::vector<VkShaderModule> modules(corpus.size(), VK_NULL_HANDLE);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < corpus.size(); ++i) {
+        VkShaderModuleCreateInfo module_ci = vku::InitStructHelper();
+        module_ci.codeSize = corpus[i].size() * sizeof(uint32_t);
+        module_ci.pCode = corpus[i].data();
+        EXPECT_EQ(VK_SUCCESS, vk::CreateShaderModule(device, &module_ci, nullptr, &modules[i]));
+    }
+    const double ms = MillisecondsSince(start);
+    for (VkShaderModule module : modules) {
+        vk::DestroyShaderModule(device, module, nullptr);
+    }
+    return ms;
+}
+
+// Where core validation keeps the shader validation cache, see CoreChecks::CreateDevice
+static std::string ShaderValidationCachePath() {
+    std::string path = GetTempFilePath() + "/shader_validation_cache";
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+    path += "-" + std::to_string(getuid());
+#endif
+    return path + ".bin";
+}
+
+TEST_F(LayerShaderStartup, CreateShaderModules) {
+    TEST_DESCRIPTION("Creating 32 large shader modules without a cache file, hitting the cache in memory, then from the file");
+    RETURN_IF_SKIP(InitWithSettings({}));
+    const std::vector<std::vector<uint32_t>> corpus = CompileCorpus();
+    const uint32_t count = static_cast<uint32_t>(corpus.size());
+
+    // Only the devices of this test have the file open, the framework device isn't created
+    std::remove(ShaderValidationCachePath().c_str());
+    auto start = std::chrono::steady_clock::now();
+    VkDevice device = CreateDevice();
+    Report("default", "create_device_without_cache_file", 1, MillisecondsSince(start));
+    ASSERT_NE(VK_NULL_HANDLE, device);
+    Report("default", "shader_module_without_cache_file", count, CreateShaderModules(device, corpus));
+    Report("default", "shader_module_cached_in_memory", count, CreateShaderModules(device, corpus));
+    vk::DestroyDevice(device, nullptr);
+
+    start = std::chrono::steady_clock::now();
+    device = CreateDevice();
+    Report("default", "create_device_with_cache_file", 1, MillisecondsSince(start));
+    ASSERT_NE(VK_NULL_HANDLE, device);
+    Report("default", "shader_module_with_cache_file", count, CreateShaderModules(device, corpus));
+    vk::DestroyDevice(device, nullptr);
+}
+
+TEST_F(LayerShaderStartup, CreateShaderModulesCachingDisabled) {
+    TEST_DESCRIPTION("Creating 32 large shader modules with check_shaders_caching off, every module is validated");
+    const VkBool32 disabled = VK_FALSE;
+    RETURN_IF_SKIP(
+        InitWithSettings({{OBJECT_LAYER_NAME, "check_shaders_caching", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &disabled}}));
+    const std::vector<std::vector<uint32_t>> corpus = CompileCorpus();
+    const uint32_t count = static_cast<uint32_t>(corpus.size());
+
+    VkDevice device = CreateDevice();
+    ASSERT_NE(VK_NULL_HANDLE, device);
+    Report("no_caching", "shader_module", count, CreateShaderModules(device, corpus));
+    Report("no_caching", "shader_module_again", count, CreateShaderModules(device, corpus));
+    vk::DestroyDevice(device, nullptr);
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+// Synchronization validation on synthetic frames. A seeded generator picks which image, mip levels and array layers every
+// command touches, so a frame shape always records the same commands and changes to the access maps (AccessContext,
+// ResourceAccessState) and to the submit time replay (QueueBatchContext) can be compared run to run.
+//
+// Every command is followed by a global barrier, so the frames are hazard free and nothing is spent on reporting errors.
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../framework/layer_validation_tests.h"
+#include "../framework/layer_memory_monitor.h"
+#include "../framework/render_pass_helper.h"
+
+struct FrameShape {
+    const char *name;
+    uint32_t images;  // at least 2, copies go between two different images
+    uint32_t mip_levels;
+    uint32_t array_layers;
+    uint32_t render_passes;
+    uint32_t barriers_per_pass;  // image barriers on random subresource ranges before each render pass
+    uint32_t submits;
+};
+
+static const FrameShape kFrameShapes[] = {
+    {"small", 8, 1, 1, 4, 4, 2},
+    {"mips_and_layers", 16, 8, 6, 8, 8, 4},
+    {"many_render_passes", 8, 1, 1, 64, 2, 8},
+    {"many_barriers", 8, 4, 4, 8, 64, 2},
+    {"many_submits", 8, 4, 1, 32, 4, 32},
+};
+
+class SyncValStress : public VkLayerTest, public ::testing::WithParamInterface<FrameShape> {
+  public:
+    void InitSyncVal();
+
+    // Records the render passes of one frame, split over the command buffers in submission order. Returns the number of
+    // commands recorded, each of which sync validation checks for hazards against the accesses before it.
+    uint32_t RecordFrame(std::mt19937 &rng, std::vector<std::unique_ptr<vkt::CommandBuffer>> &command_buffers);
+
+  protected:
+    static constexpr uint32_t kImageSize = 256;
+
+    std::vector<std::unique_ptr<VkImageObj>> images_;
+    std::vector<vkt::ImageView> views_;
+    std::unique_ptr<RenderPassSingleSubpass> render_pass_;
+    std::vector<vkt::Framebuffer> framebuffers_;
+};
+
+void SyncValStress::InitSyncVal() {
+    const VkBool32 enabled = VK_TRUE;
+    const VkLayerSettingEXT settings[] = {
+        {OBJECT_LAYER_NAME, "validate_sync", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &enabled},
+        LayerMemoryMonitor::MemoryReportSetting(),
+    };
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+                                                               static_cast<uint32_t>(std::size(settings)), settings};
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    const FrameShape &shape = GetParam();
+    render_pass_ = std::make_unique<RenderPassSingleSubpass>(*this);
+    render_pass_->AddAttachmentDescription(VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL,
+                                           VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE);
+    render_pass_->AddAttachmentReference({0, VK_IMAGE_LAYOUT_GENERAL});
+    render_pass_->AddColorAttachment(0);
+    render_pass_->CreateRenderPass();
+
+    for (uint32_t i = 0; i < shape.images; ++i) {
+        VkImageCreateInfo image_ci = VkImageObj::ImageCreateInfo2D(
+            kImageSize, kImageSize, shape.mip_levels, shape.array_layers, VK_FORMAT_R8G8B8A8_UNORM,
+            VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+            VK_IMAGE_TILING_OPTIMAL);
+        images_.emplace_back(std::make_unique<VkImageObj>(m_device));
+        images_.back()->Init(image_ci);
+        images_.back()->SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+        views_.emplace_back(images_.back()->CreateView(VK_IMAGE_VIEW_TYPE_2D, 0, 1, 0, 1));
+        framebuffers_.emplace_back(*m_device, render_pass_->Handle(), 1, &views_.back().handle(), kImageSize, kImageSize);
+    }
+}
+
+uint32_t SyncValStress::RecordFrame(std::mt19937 &rng, std::vector<std::unique_ptr<vkt::CommandBuffer>> &command_buffers) {
+    const FrameShape &shape = GetParam();
+    std::uniform_int_distribution<uint32_t> image_dist(0, shape.images - 1);
+    std::uniform_int_distribution<uint32_t> mip_dist(0, shape.mip_levels - 1);
+    std::uniform_int_distribution<uint32_t> layer_dist(0, shape.array_layers - 1);
+    // Base and count of a random subrange of [0, total)
+    const auto subrange = [&rng](std::uniform_int_distribution<uint32_t> &dist, uint32_t total) {
+        const uint32_t base = dist(rng);
+        return std::make_pair(base, std::uniform_int_distribution<uint32_t>(1, total - base)(rng));
+    };
+
+    VkMemoryBarrier global_barrier = vku::InitStructHelper();
+    global_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    global_barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    const auto global_dependency = [&global_barrier](VkCommandBuffer command_buffer) {
+        vk::CmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1,
+                               &global_barrier, 0, nullptr, 0, nullptr);
+    };
+    const VkClearColorValue clear_color = {{0.0f, 0.25f, 0.5f, 1.0f}};
+    const VkClearValue clear_value = {clear_color};
+
+    uint32_t commands = 0;
+    for (auto &command_buffer : command_buffers) {
+        command_buffer->begin();
+    }
+    for (uint32_t pass = 0; pass < shape.render_passes; ++pass) {
+        vkt::CommandBuffer &command_buffer = *command_buffers[pass * command_buffers.size() / shape.render_passes];
+
+        // Image barriers on random subresource ranges, splitting the ranges tracked for the image
+        std::vector<VkImageMemoryBarrier> image_barriers(shape.barriers_per_pass);
+        for (VkImageMemoryBarrier &barrier : image_barriers) {
+            const auto [base_mip, mip_count] = subrange(mip_dist, shape.mip_levels);
+            const auto [base_layer, layer_count] = subrange(layer_dist, shape.array_layers);
+            barrier = vku::InitStructHelper();
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = images_[image_dist(rng)]->handle();
+            barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, base_mip, mip_count, base_layer, layer_count};
+        }
+        if (!image_barriers.empty()) {
+            vk::CmdPipelineBarrier(command_buffer.handle(),
+                                   VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                   VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr,
+                                   static_cast<uint32_t>(image_barriers.size()), image_barriers.data());
+            ++commands;
+        }
+
+        // A transfer on a random subresource range: a clear, or a copy of one mip level between two images
+        if (rng() & 1) {
+            const auto [base_mip, mip_count] = subrange(mip_dist, shape.mip_levels);
+            const auto [base_layer, layer_count] = subrange(layer_dist, shape.array_layers);
+            const VkImageSubresourceRange range = {VK_IMAGE_ASPECT_COLOR_BIT, base_mip, mip_count, base_layer, layer_count};
+            vk::CmdClearColorImage(command_buffer.handle(), images_[image_dist(rng)]->handle(), VK_IMAGE_LAYOUT_GENERAL,
+                                   &clear_color, 1, &range);
+        } else {
+            const uint32_t src = image_dist(rng);
+            const uint32_t dst = (src + 1 + image_dist(rng) % (shape.images - 1)) % shape.images;
+            const uint32_t mip = mip_dist(rng);
+            const auto [base_layer, layer_count] = subrange(layer_dist, shape.array_layers);
+            const uint32_t extent = std::max(1u, kImageSize >> mip);
+            VkImageCopy region = {};
+            region.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, mip, base_layer, layer_count};
+            region.dstSubresource = region.srcSubresource;
+            region.extent = {extent, extent, 1};
+            vk::CmdCopyImage(command_buffer.handle(), images_[src]->handle(), VK_IMAGE_LAYOUT_GENERAL, images_[dst]->handle(),
+                             VK_IMAGE_LAYOUT_GENERAL, 1, &region);
+        }
+        global_dependency(command_buffer.handle());
+        commands += 2;
+
+        // The render pass clears and stores mip 0, layer 0 of a random image
+        VkRenderPassBeginInfo begin_info = vku::InitStructHelper();
+        begin_info.renderPass = render_pass_->Handle();
+        begin_info.framebuffer = framebuffers_[image_dist(rng)].handle();
+        begin_info.renderArea = {{0, 0}, {kImageSize, kImageSize}};
+        begin_info.clearValueCount = 1;
+        begin_info.pClearValues = &clear_value;
+        vk::CmdBeginRenderPass(command_buffer.handle(), &begin_info, VK_SUBPASS_CONTENTS_INLINE);
+        vk::CmdEndRenderPass(command_buffer.handle());
+        global_dependency(command_buffer.handle());
+        commands += 3;
+    }
+    for (auto &command_buffer : command_buffers) {
+        command_buffer->end();
+    }
+    return commands;
+}
+
+TEST_P(SyncValStress, SyntheticFrames) {
+    TEST_DESCRIPTION("Records and submits 8 seeded synthetic frames with synchronization validation");
+    RETURN_IF_SKIP(InitSyncVal());
+    const FrameShape &shape = GetParam();
+    LayerMemoryMonitor monitor(instance());
+
+    constexpr uint32_t kFrames = 8;
+    std::mt19937 rng(shape.render_passes * 131 + shape.images);
+    std::vector<std::unique_ptr<vkt::CommandBuffer>> command_buffers;
+    for (uint32_t i = 0; i < shape.submits; ++i) {
+        command_buffers.emplace_back(std::make_unique<vkt::CommandBuffer>(m_device, m_commandPool));
+    }
+
+    double record_s = 0.0;
+    double submit_s = 0.0;
+    uint32_t commands = 0;
+    LayerMemoryMonitor::Subsystem recorded;
+    LayerMemoryMonitor::Subsystem submitted;
+    for (uint32_t frame = 0; frame < kFrames; ++frame) {
+        auto start = std::chrono::steady_clock::now();
+        commands += RecordFrame(rng, command_buffers);
+        record_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        monitor.Sample(m_default_queue->handle());
+        recorded = monitor.LastSample("SyncVal command buffer access states");
+
+        // One batch per command buffer, each replayed against the accesses of the batches before it
+        start = std::chrono::steady_clock::now();
+        for (auto &command_buffer : command_buffers) {
+            VkSubmitInfo submit_info = vku::InitStructHelper();
+            submit_info.commandBufferCount = 1;
+            submit_info.pCommandBuffers = &command_buffer->handle();
+            vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+        }
+        submit_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        monitor.Sample(m_default_queue->handle());
+        submitted = monitor.LastSample("SyncVal queue batch access states");
+        m_default_queue->wait();
+    }
+
+    const uint32_t submits = kFrames * shape.submits;
+    const double record_rate = commands / record_s;
+    const double submit_rate = submits / submit_s;
+    const auto bytes_per_range = [](const LayerMemoryMonitor::Subsystem &subsystem) {
+        return subsystem.count ? double(subsystem.bytes) / subsystem.count : 0.0;
+    };
+    printf("%-20s %12.0f hazard checked commands/s %10.0f submits/s  %8" PRIu64 " ranges %6.1f B/range recorded  %8" PRIu64
+           " ranges %6.1f B/range submitted  %.1f MiB high-water\n",
+           shape.name, record_rate, submit_rate, recorded.count, bytes_per_range(recorded), submitted.count,
+           bytes_per_range(submitted), double(monitor.HighWaterMark()) / (1024.0 * 1024.0));
+    RecordProperty("record_ops_per_s", std::to_string(record_rate));
+    RecordProperty("submit_ops_per_s", std::to_string(submit_rate));
+    RecordProperty("recorded_ranges", std::to_string(recorded.count));
+    RecordProperty("recorded_bytes_per_range", std::to_string(bytes_per_range(recorded)));
+    RecordProperty("submitted_ranges", std::to_string(submitted.count));
+    RecordProperty("submitted_bytes_per_range", std::to_string(bytes_per_range(submitted)));
+    RecordProperty("sync_val_high_water_bytes", std::to_string(monitor.HighWaterMark()));
+}
+
+INSTANTIATE_TEST_SUITE_P(FrameShapes, SyncValStress, ::testing::ValuesIn(kFrameShapes),
+                         [](const ::testing::TestParamInfo<FrameShape> &info) { return std::string(info.param.name); });
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+// How the layer scales with the number of recording and submitting threads, with fine grained locking on and off. Each
+// workload runs on 1, 2, 4, ... threads (up to the hardware thread count) and reports the throughput and the speedup over
+// one thread, printed and recorded as gtest properties. Sharing the resources between threads shows the contention on the
+// object maps and in ThreadSafety, disjoint resources what is left of the ValidationObject locks.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../framework/layer_validation_tests.h"
+#include "../framework/pipeline_helper.h"
+#include "../framework/descriptor_helper.h"
+#include "../framework/thread_helper.h"
+
+#if GTEST_IS_THREADSAFE
+struct LockingConfig {
+    const char *name;
+    VkBool32 fine_grained_locking;
+};
+
+static const LockingConfig kLockingConfigs[] = {
+    {"fine_grained_locking", true},
+    {"coarse_locking", false},
+};
+
+class LayerThreadScaling : public VkLayerTest, public ::testing::WithParamInterface<LockingConfig> {
+  public:
+    void InitWithConfig();
+
+    // 1, 2, 4, ... up to max_threads and the hardware thread count
+    static std::vector<uint32_t> ThreadCounts(uint32_t max_threads);
+
+    // Runs work(thread_index) on thread_count threads released together, returns the seconds until the last one is done
+    template <typename Fn>
+    double RunOnThreads(uint32_t thread_count, Fn &&work);
+
+    // Prints operations per second for thread_count threads, and the speedup against single_thread_rate if it is set
+    double Report(const char *what, uint32_t thread_count, uint64_t operations, double seconds, double single_thread_rate);
+};
+
+void LayerThreadScaling::InitWithConfig() {
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "fine_grained_locking", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &GetParam().fine_grained_locking};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    m_errorMonitor->ExpectSuccess(kErrorBit);
+}
+
+std::vector<uint32_t> LayerThreadScaling::ThreadCounts(uint32_t max_threads) {
+    max_threads = std::min(max_threads, std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<uint32_t> counts;
+    for (uint32_t count = 1; count <= max_threads; count *= 2) {
+        counts.push_back(count);
+    }
+    if (counts.back() != max_threads) {
+        counts.push_back(max_threads);
+    }
+    return counts;
+}
+
+template <typename Fn>
+double LayerThreadScaling::RunOnThreads(uint32_t thread_count, Fn &&work) {
+    ThreadTimeoutHelper timeout_helper(static_cast<int>(thread_count));
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+    for (uint32_t thread_index = 0; thread_index < thread_count; ++thread_index) {
+        threads.emplace_back([&, thread_index]() {
+            auto timeout_guard = timeout_helper.ThreadGuard();
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            work(thread_index);
+        });
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    if (!timeout_helper.WaitForThreads(300)) {
+        ADD_FAILURE() << "The worker threads are stuck";
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+double LayerThreadScaling::Report(const char *what, uint32_t thread_count, uint64_t operations, double seconds,
+                                  double single_thread_rate) {
+    const double rate = static_cast<double>(operations) / seconds;
+    const double speedup = single_thread_rate > 0.0 ? rate / single_thread_rate : 1.0;
+    printf("%-20s %-28s %3u threads %14.0f ops/s %6.2fx\n", GetParam().name, what, thread_count, rate, speedup);
+    RecordProperty(std::string(what) + "_" + std::to_string(thread_count) + "_threads_ops_per_s", std::to_string(rate));
+    return rate;
+}
+
+// A compute pipeline with its own descriptor set and uniform buffer
+struct ThreadResources {
+    std::unique_ptr<CreateComputePipelineHelper> pipe;
+    std::unique_ptr<vkt::Buffer> buffer;
+};
+
+static ThreadResources CreateThreadResources(VkLayerTest &test, vkt::Device &device) {
+    ThreadResources resources;
+    resources.buffer = std::make_unique<vkt::Buffer>(device, 256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    resources.pipe = std::make_unique<CreateComputePipelineHelper>(test);
+    resources.pipe->InitState();
+    resources.pipe->CreateComputePipeline();
+    resources.pipe->descriptor_set_->WriteDescriptorBufferInfo(0, resources.buffer->handle(), 0, VK_WHOLE_SIZE);
+    resources.pipe->descriptor_set_->UpdateDescriptorSets();
+    return resources;
+}
+
+// Bind, dispatch and a barrier on the buffer of the set, kIterations times
+static constexpr uint32_t kIterations = 20000;
+static constexpr uint32_t kCommandsPerIteration = 4;
+
+static void RecordWork(VkCommandBuffer command_buffer, const ThreadResources &resources) {
+    const CreateComputePipelineHelper &pipe = *resources.pipe;
+    VkBufferMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.buffer = resources.buffer->handle();
+    barrier.offset = 0;
+    barrier.size = VK_WHOLE_SIZE;
+    for (uint32_t i = 0; i < kIterations; ++i) {
+        vk::CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_);
+        vk::CmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                                  &pipe.descriptor_set_->set_, 0, nullptr);
+        vk::CmdDispatch(command_buffer, 1, 1, 1);
+        vk::CmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr,
+                               1, &barrier, 0, nullptr);
+    }
+}
+
+static void MeasureRecording(LayerThreadScaling &test, vkt::Device &device, bool shared_resources, const char *what) {
+    const std::vector<uint32_t> thread_counts = LayerThreadScaling::ThreadCounts(64);
+    const uint32_t max_threads = thread_counts.back();
+
+    std::vector<ThreadResources> resources;
+    resources.reserve(shared_resources ? 1 : max_threads);
+    for (uint32_t i = 0; i < (shared_resources ? 1 : max_threads); ++i) {
+        resources.emplace_back(CreateThreadResources(test, device));
+    }
+    // Command pools are externally synchronized, every thread gets its own
+    std::vector<std::unique_ptr<vkt::CommandPool>> pools;
+    std::vector<std::unique_ptr<vkt::CommandBuffer>> command_buffers;
+    for (uint32_t i = 0; i < max_threads; ++i) {
+        pools.emplace_back(std::make_unique<vkt::CommandPool>(device, device.graphics_queue_node_index_,
+                                                              VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+        command_buffers.emplace_back(std::make_unique<vkt::CommandBuffer>(&device, pools.back().get()));
+    }
+
+    double single_thread_rate = 0.0;
+    for (const uint32_t thread_count : thread_counts) {
+        const double seconds = test.RunOnThreads(thread_count, [&](uint32_t thread_index) {
+            vkt::CommandBuffer &command_buffer = *command_buffers[thread_index];
+            command_buffer.begin();
+            RecordWork(command_buffer.handle(), resources[shared_resources ? 0 : thread_index]);
+            command_buffer.end();
+        });
+        const uint64_t commands = static_cast<uint64_t>(thread_count) * kIterations * kCommandsPerIteration;
+        const double rate = test.Report(what, thread_count, commands, seconds, single_thread_rate);
+        if (thread_count == 1) {
+            single_thread_rate = rate;
+        }
+        for (uint32_t i = 0; i < thread_count; ++i) {
+            vk::ResetCommandBuffer(command_buffers[i]->handle(), 0);
+        }
+    }
+}
+
+TEST_P(LayerThreadScaling, RecordSharedResources) {
+    TEST_DESCRIPTION("Every thread records a command buffer binding the same pipeline, descriptor set and buffer");
+    RETURN_IF_SKIP(InitWithConfig());
+    MeasureRecording(*this, *m_device, true, "record_shared_resources");
+}
+
+TEST_P(LayerThreadScaling, RecordDisjointResources) {
+    TEST_DESCRIPTION("Every thread records a command buffer binding its own pipeline, descriptor set and buffer");
+    RETURN_IF_SKIP(InitWithConfig());
+    MeasureRecording(*this, *m_device, false, "record_disjoint_resources");
+}
+
+TEST_P(LayerThreadScaling, SubmitOnQueuePerThread) {
+    TEST_DESCRIPTION("Every thread submits small command buffers to its own queue, as many threads as graphics queues");
+    RETURN_IF_SKIP(InitWithConfig());
+
+    // Queues are externally synchronized, the thread count is limited by the queue count instead of adding a lock
+    const auto &queues = m_device->graphics_queues();
+    const std::vector<uint32_t> thread_counts = ThreadCounts(static_cast<uint32_t>(queues.size()));
+    const uint32_t max_threads = thread_counts.back();
+    if (max_threads < 2) {
+        printf("%-20s submit_queue_per_thread: a single graphics queue, nothing to scale\n", GetParam().name);
+    }
+
+    ThreadResources resources = CreateThreadResources(*this, *m_device);
+    std::vector<std::unique_ptr<vkt::CommandPool>> pools;
+    std::vector<std::unique_ptr<vkt::CommandBuffer>> command_buffers;
+    for (uint32_t i = 0; i < max_threads; ++i) {
+        pools.emplace_back(std::make_unique<vkt::CommandPool>(*m_device, queues[i]->get_family_index()));
+        command_buffers.emplace_back(std::make_unique<vkt::CommandBuffer>(m_device, pools.back().get()));
+        // Submitted again while still pending
+        command_buffers.back()->begin(VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT);
+        vk::CmdBindPipeline(command_buffers.back()->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, resources.pipe->pipeline_);
+        vk::CmdDispatch(command_buffers.back()->handle(), 1, 1, 1);
+        command_buffers.back()->end();
+    }
+
+    constexpr uint32_t kSubmits = 5000;
+    // Bounds the work in flight, and its tracking in the layer
+    constexpr uint32_t kSubmitsBetweenWaits = 256;
+    double single_thread_rate = 0.0;
+    for (const uint32_t thread_count : thread_counts) {
+        const double seconds = RunOnThreads(thread_count, [&](uint32_t thread_index) {
+            const VkQueue queue = queues[thread_index]->handle();
+            VkSubmitInfo submit_info = vku::InitStructHelper();
+            submit_info.commandBufferCount = 1;
+            submit_info.pCommandBuffers = &command_buffers[thread_index]->handle();
+            for (uint32_t i = 0; i < kSubmits; ++i) {
+                vk::QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+                if ((i + 1) % kSubmitsBetweenWaits == 0) {
+                    vk::QueueWaitIdle(queue);
+                }
+            }
+            vk::QueueWaitIdle(queue);
+        });
+        const double rate =
+            Report("submit_queue_per_thread", thread_count, static_cast<uint64_t>(thread_count) * kSubmits, seconds,
+                   single_thread_rate);
+        if (thread_count == 1) {
+            single_thread_rate = rate;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Locking, LayerThreadScaling, ::testing::ValuesIn(kLockingConfigs),
+                         [](const ::testing::TestParamInfo<LockingConfig> &info) { return std::string(info.param.name); });
+#endif  // GTEST_IS_THREADSAFE
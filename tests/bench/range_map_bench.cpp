@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <type_traits>
+
+#include "containers/range_vector.h"
+
+namespace {
+using Range = sparse_container::range<uint64_t>;
+using TreeMap = sparse_container::range_map<uint64_t, uint32_t>;
+using FlatMap = sparse_container::flat_range_map<uint64_t, uint32_t>;
+using SmallMap = sparse_container::small_range_map<uint64_t, uint32_t, Range, 64>;
+constexpr auto kPreferSource = sparse_container::value_precedence::prefer_source;
+
+// small_range_map is sized at construction, the others are unbounded
+template <typename Map>
+std::unique_ptr<Map> MakeMap(uint64_t limit) {
+    if constexpr (std::is_constructible_v<Map, uint64_t>) {
+        return std::make_unique<Map>(limit);
+    } else {
+        return std::make_unique<Map>();
+    }
+}
+
+// One entry per subresource with alternating values, the worst case fragmentation of a layout map
+template <typename Map>
+std::unique_ptr<Map> MakeFragmentedMap(uint64_t limit) {
+    auto map = MakeMap<Map>(limit);
+    for (uint64_t index = 0; index < limit; ++index) {
+        map->insert(std::make_pair(Range(index, index + 1), static_cast<uint32_t>(index & 1)));
+    }
+    return map;
+}
+
+// Roughly the size and shape of a sync validation ResourceAccessState payload
+struct AccessPayload {
+    uint64_t tag = 0;
+    uint64_t stages = 0;
+    uint64_t accesses = 0;
+    uint64_t reads[5] = {};
+};
+template <typename Map>
+struct AccessInfillUpdateOps {
+    using Iterator = typename Map::iterator;
+    void infill(Map &map, const Iterator &pos, const Range &range) const {
+        AccessPayload payload;
+        payload.tag = tag;
+        map.insert(pos, std::make_pair(range, payload));
+    }
+    void update(const Iterator &pos) const {
+        pos->second.tag = tag;
+        pos->second.accesses |= 1;
+    }
+    uint64_t tag;
+};
+using TreeAccessMap = sparse_container::range_map<uint64_t, AccessPayload>;
+using FlatAccessMap = sparse_container::flat_range_map<uint64_t, AccessPayload>;
+}  // namespace
+
+// A barrier on a layer slice of every mip of an arrayed image, as image layout tracking records it. The mip major encoding
+// turns it into one range per mip.
+template <typename Map>
+static void BM_LayeredImageBarrier(benchmark::State &state) {
+    const auto mips = static_cast<uint64_t>(state.range(0));
+    const auto layers = static_cast<uint64_t>(state.range(1));
+    const uint64_t limit = mips * layers;
+    auto map = MakeMap<Map>(limit);
+    sparse_container::update_range_value(*map, Range(0, limit), 0u, kPreferSource);
+
+    std::mt19937 rng(2);
+    uint32_t layout = 1;
+    for (auto _ : state) {
+        const uint64_t base_layer = rng() % layers;
+        const uint64_t layer_count = 1 + rng() % (layers - base_layer);
+        for (uint64_t mip = 0; mip < mips; ++mip) {
+            const uint64_t begin = mip * layers + base_layer;
+            sparse_container::update_range_value(*map, Range(begin, begin + layer_count), layout, kPreferSource);
+        }
+        layout = (layout + 1) % 4;
+    }
+    state.SetItemsProcessed(state.iterations() * mips);
+    state.counters["entries"] = static_cast<double>(map->size());
+}
+BENCHMARK_TEMPLATE(BM_LayeredImageBarrier, TreeMap)->Args({1, 6})->Args({8, 8})->Args({12, 64});
+BENCHMARK_TEMPLATE(BM_LayeredImageBarrier, FlatMap)->Args({1, 6})->Args({8, 8})->Args({12, 64});
+BENCHMARK_TEMPLATE(BM_LayeredImageBarrier, SmallMap)->Args({1, 6})->Args({8, 8});
+
+// Point lookups, as every layout or binding check does
+template <typename Map>
+static void BM_RangeMapFind(benchmark::State &state) {
+    const auto limit = static_cast<uint64_t>(state.range(0));
+    const auto map = MakeFragmentedMap<Map>(limit);
+    std::mt19937 rng(3);
+    uint32_t sum = 0;
+    for (auto _ : state) {
+        const auto it = map->find(rng() % limit);
+        sum += it->second;
+    }
+    benchmark::DoNotOptimize(sum);
+}
+BENCHMARK_TEMPLATE(BM_RangeMapFind, TreeMap)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_RangeMapFind, FlatMap)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_RangeMapFind, SmallMap)->Arg(64);
+
+// Random overwrites over a large index space, as memory binding and buffer address maps see
+template <typename Map>
+static void BM_SparseRangeOverwrite(benchmark::State &state) {
+    const auto entries = static_cast<uint64_t>(state.range(0));
+    const uint64_t space = entries * 4096;
+    auto map = MakeMap<Map>(space);
+    std::mt19937_64 rng(4);
+    for (auto _ : state) {
+        const uint64_t begin = (rng() % entries) * 4096;
+        const uint64_t size = 256 * (1 + rng() % 32);
+        map->overwrite_range(std::make_pair(Range(begin, begin + size), static_cast<uint32_t>(begin)));
+    }
+    state.counters["entries"] = static_cast<double>(map->size());
+}
+BENCHMARK_TEMPLATE(BM_SparseRangeOverwrite, TreeMap)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_SparseRangeOverwrite, FlatMap)->Arg(64)->Arg(4096);
+
+// Sync validation style access recording: unaligned, overlapping buffer accesses infill gaps and split existing entries
+template <typename Map>
+static void BM_SyncInfillSplit(benchmark::State &state) {
+    const auto buffer_size = static_cast<uint64_t>(state.range(0));
+    std::mt19937_64 rng(5);
+    uint64_t tag = 0;
+    for (auto _ : state) {
+        Map map;
+        for (int access = 0; access < 64; ++access) {
+            const uint64_t begin = (rng() % buffer_size) & ~uint64_t(15);
+            const uint64_t size = 16 * (1 + rng() % 64);
+            const Range range(begin, std::min(begin + size, buffer_size));
+            sparse_container::infill_update_range(map, range, AccessInfillUpdateOps<Map>{++tag});
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK_TEMPLATE(BM_SyncInfillSplit, TreeAccessMap)->Arg(4096)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_SyncInfillSplit, FlatAccessMap)->Arg(4096)->Arg(1 << 20);
+
+// Index by index walk, as validation of a subresource range against the recorded layouts does
+template <typename Map>
+static void BM_CachedLowerBoundWalk(benchmark::State &state) {
+    const auto limit = static_cast<uint64_t>(state.range(0));
+    const auto map = MakeFragmentedMap<Map>(limit);
+    for (auto _ : state) {
+        sparse_container::cached_lower_bound_impl<const Map> pos(*map, 0);
+        uint32_t sum = 0;
+        for (uint64_t index = 0; index < limit; ++index, ++pos) {
+            if (pos->valid) {
+                sum += pos->lower_bound->second;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * limit);
+}
+BENCHMARK_TEMPLATE(BM_CachedLowerBoundWalk, TreeMap)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_CachedLowerBoundWalk, FlatMap)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_CachedLowerBoundWalk, SmallMap)->Arg(64);
+
+// Lockstep walk of two maps with unrelated boundaries, as checking recorded layouts against the global layouts does
+template <typename Map>
+static void BM_ParallelIterator(benchmark::State &state) {
+    const auto limit = static_cast<uint64_t>(state.range(0));
+    const auto map_a = MakeFragmentedMap<Map>(limit);
+    auto map_b = MakeMap<Map>(limit);
+    for (uint64_t index = 0; index < limit; index += 3) {
+        map_b->insert(std::make_pair(Range(index, std::min(index + 3, limit)), 1u));
+    }
+    for (auto _ : state) {
+        sparse_container::parallel_iterator<const Map> par_it(*map_a, *map_b, 0);
+        uint32_t steps = 0;
+        while (par_it->range.non_empty()) {
+            steps += par_it->pos_A->valid && par_it->pos_B->valid;
+            ++par_it;
+        }
+        benchmark::DoNotOptimize(steps);
+    }
+}
+BENCHMARK_TEMPLATE(BM_ParallelIterator, TreeMap)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_ParallelIterator, FlatMap)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_ParallelIterator, SmallMap)->Arg(64);
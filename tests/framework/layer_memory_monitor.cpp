@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "layer_memory_monitor.h"
+
+#include <cstdio>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// Names of the memory report message and of the label requesting it, see the chassis of the layer
+static const char *kMemoryFootprintReportId = "UNASSIGNED-MemoryFootprint-Report";
+static const char *kMemoryFootprintReportLabel = "VVL-MemoryFootprintReport";
+
+VkLayerSettingEXT LayerMemoryMonitor::MemoryReportSetting() {
+    static const VkBool32 enabled = VK_TRUE;
+    return {OBJECT_LAYER_NAME, "memory_report", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &enabled};
+}
+
+LayerMemoryMonitor::LayerMemoryMonitor(VkInstance instance) : instance_(instance) {
+    VkDebugUtilsMessengerCreateInfoEXT create_info = vku::InitStructHelper();
+    create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+    create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT;
+    create_info.pfnUserCallback = Callback;
+    create_info.pUserData = this;
+    if (vk::CreateDebugUtilsMessengerEXT(instance_, &create_info, nullptr, &messenger_) != VK_SUCCESS) {
+        ADD_FAILURE() << "vkCreateDebugUtilsMessengerEXT failed";
+    }
+}
+
+LayerMemoryMonitor::~LayerMemoryMonitor() {
+    if (messenger_ != VK_NULL_HANDLE) {
+        vk::DestroyDebugUtilsMessengerEXT(instance_, messenger_, nullptr);
+    }
+}
+
+// One message per validation object holding state, starting with "<object> memory footprint, <KiB> KiB total" and followed
+// by a header line and one "<KiB> <count>  <subsystem>" line per subsystem
+VKAPI_ATTR VkBool32 VKAPI_CALL LayerMemoryMonitor::Callback(VkDebugUtilsMessageSeverityFlagBitsEXT,
+                                                            VkDebugUtilsMessageTypeFlagsEXT,
+                                                            const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                            void *user_data) {
+    if (!callback_data->pMessageIdName || std::strcmp(callback_data->pMessageIdName, kMemoryFootprintReportId) != 0) {
+        return VK_FALSE;
+    }
+    const char *footprint = std::strstr(callback_data->pMessage, "memory footprint, ");
+    double kib = 0.0;
+    if (footprint && std::sscanf(footprint, "memory footprint, %lf KiB total", &kib) == 1) {
+        auto *monitor = reinterpret_cast<LayerMemoryMonitor *>(user_data);
+        monitor->sample_bytes_ += static_cast<uint64_t>(kib * 1024.0);
+        monitor->sample_reports_++;
+        for (const char *line = std::strchr(footprint, '\n'); line; line = std::strchr(line + 1, '\n')) {
+            unsigned long long count = 0;
+            int name_offset = 0;
+            if (std::sscanf(line + 1, " %lf %llu %n", &kib, &count, &name_offset) != 2 || name_offset == 0) {
+                continue;  // header
+            }
+            const char *name = line + 1 + name_offset;
+            const char *name_end = std::strchr(name, '\n');
+            Subsystem subsystem;
+            subsystem.count = count;
+            subsystem.bytes = static_cast<uint64_t>(kib * 1024.0);
+            monitor->sample_subsystems_.emplace_back(name_end ? std::string(name, name_end) : std::string(name), subsystem);
+        }
+    }
+    return VK_FALSE;
+}
+
+uint64_t LayerMemoryMonitor::Sample(VkQueue queue) {
+    sample_bytes_ = 0;
+    sample_reports_ = 0;
+    sample_subsystems_.clear();
+    VkDebugUtilsLabelEXT label = vku::InitStructHelper();
+    label.pLabelName = kMemoryFootprintReportLabel;
+    // The report is logged from within the call, unless async_message_delivery is on
+    vk::QueueInsertDebugUtilsLabelEXT(queue, &label);
+    if (sample_reports_ == 0) {
+        ADD_FAILURE() << "No memory report was logged, is the instance created with LayerMemoryMonitor::MemoryReportSetting()?";
+    }
+    if (sample_bytes_ > high_water_mark_) {
+        high_water_mark_ = sample_bytes_;
+    }
+    return sample_bytes_;
+}
+
+LayerMemoryMonitor::Subsystem LayerMemoryMonitor::LastSample(const char *prefix) const {
+    Subsystem total;
+    const size_t prefix_length = std::strlen(prefix);
+    for (const auto &[name, subsystem] : sample_subsystems_) {
+        if (name.compare(0, prefix_length, prefix) == 0) {
+            total.count += subsystem.count;
+            total.bytes += subsystem.bytes;
+        }
+    }
+    return total;
+}
+
+uint64_t LayerMemoryMonitor::ProcessPeakResidentBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters = {};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    struct rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss);  // bytes
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;  // KiB
+#endif
+#endif
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#pragma once
+
+#include "layer_validation_tests.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Samples the host memory held by the validation layer, from the khronos_validation.memory_report information messages.
+// The instance must be created with MemoryReportSetting() in its layer settings.
+//
+// The layer numbers are estimates built from its container sizes (see layers/utils/memory_footprint.h), which is what a
+// budget can be set against: they don't depend on the allocator or on what else the process allocates. The peak resident
+// size of the process is reported next to them for reference.
+// Usage Example:
+//  LayerMemoryMonitor memory_monitor(instance());
+//  const uint64_t before = memory_monitor.Sample(m_default_queue->handle());
+//  // The scenario
+//  const uint64_t after = memory_monitor.Sample(m_default_queue->handle());
+//  ASSERT_LE(memory_monitor.HighWaterMark() - before, budget);
+class LayerMemoryMonitor {
+  public:
+    // Turns the memory report on, to be added to the layer settings of the instance
+    static VkLayerSettingEXT MemoryReportSetting();
+
+    explicit LayerMemoryMonitor(VkInstance instance);
+    ~LayerMemoryMonitor();
+    LayerMemoryMonitor(const LayerMemoryMonitor &) = delete;
+    LayerMemoryMonitor &operator=(const LayerMemoryMonitor &) = delete;
+
+    // Bytes held by all the validation objects of the device the queue belongs to, 0 if the layer didn't report anything
+    uint64_t Sample(VkQueue queue);
+    struct Subsystem {
+        uint64_t count = 0;  // objects or container elements
+        uint64_t bytes = 0;
+    };
+    // Subsystems of the last Sample() whose name starts with prefix (e.g. "SyncVal queue batch"), summed together
+    Subsystem LastSample(const char *prefix) const;
+    // Largest Sample() so far
+    uint64_t HighWaterMark() const { return high_water_mark_; }
+    // Peak resident set of the whole process in bytes, 0 where it isn't available
+    static uint64_t ProcessPeakResidentBytes();
+
+  private:
+    static VKAPI_ATTR VkBool32 VKAPI_CALL Callback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                   VkDebugUtilsMessageTypeFlagsEXT message_types,
+                                                   const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data);
+
+    VkInstance instance_;
+    VkDebugUtilsMessengerEXT messenger_ = VK_NULL_HANDLE;
+    uint64_t sample_bytes_ = 0;
+    uint32_t sample_reports_ = 0;
+    std::vector<std::pair<std::string, Subsystem>> sample_subsystems_;
+    uint64_t high_water_mark_ = 0;
+};
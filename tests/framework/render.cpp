@@ -565,11 +565,14 @@ bool VkRenderFramework::IgnoreDisableChecks() {
 }
 
 static const std::string mock_icd_device_name = "Vulkan Mock Device";
+// tests/icd, which executes nothing either
+static const std::string null_icd_device_name = "Vulkan Null Device";
 bool VkRenderFramework::IsPlatformMockICD() {
     if (VkRenderFramework::IgnoreDisableChecks()) {
         return false;
     } else {
-        return 0 == mock_icd_device_name.compare(physDevProps().deviceName);
+        return 0 == mock_icd_device_name.compare(physDevProps().deviceName) ||
+               0 == null_icd_device_name.compare(physDevProps().deviceName);
     }
 }
 
@@ -0,0 +1,1202 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// A driver that does nothing, so the layer overhead benchmarks measure the layer alone.
+//
+// Unlike the MockICD of Vulkan-Tools, nothing is generated and nothing is tracked beyond what is needed to hand out valid
+// handles: dispatchable objects carry the loader magic, buffers, images, memory and command pools are small heap objects
+// so their sizes can be queried back, semaphores, query pools and private data slots keep what their queries return, and
+// every other object is a number from a counter. Any device command not listed in the tables below resolves to a function
+// returning VK_SUCCESS without reading its parameters, which is what makes recording cost nothing. That catch-all relies
+// on the caller cleaning up the stack, so this is only built for 64-bit targets (where non-dispatchable handles are also
+// pointers).
+
+#include <vulkan/vulkan.h>
+#include <vulkan/vk_icd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace null_icd {
+
+static_assert(sizeof(void *) == 8, "the null ICD needs non-dispatchable handles to be pointers");
+
+static constexpr uint32_t kApiVersion = VK_MAKE_API_VERSION(0, 1, 3, VK_HEADER_VERSION);
+static constexpr uint32_t kQueueFamilyCount = 1;
+static constexpr uint32_t kQueueCount = 4;
+static constexpr VkDeviceSize kHeapSize = 8ull << 30;
+static constexpr VkDeviceSize kAlignment = 256;
+
+// First member of every dispatchable object, the loader writes its dispatch table there
+struct DispatchableObject {
+    DispatchableObject() { set_loader_magic_value(this); }
+    VK_LOADER_DATA loader_data;
+};
+
+struct PhysicalDevice : DispatchableObject {};
+
+struct Instance : DispatchableObject {
+    PhysicalDevice physical_device;
+};
+
+struct Queue : DispatchableObject {
+    uint32_t family_index;
+    uint32_t queue_index;
+};
+
+struct Device : DispatchableObject {
+    std::vector<std::unique_ptr<Queue>> queues;
+};
+
+struct CommandBuffer : DispatchableObject {};
+
+struct CommandPool {
+    std::vector<CommandBuffer *> command_buffers;
+};
+
+struct Buffer {
+    VkDeviceSize size;
+    VkDeviceAddress address;
+};
+
+struct Image {
+    VkDeviceSize size;
+};
+
+struct Memory {
+    VkDeviceSize size;
+    void *data;
+};
+
+// The counter of timeline semaphores, the work signaling them is done as soon as it is submitted
+struct Semaphore {
+    std::atomic<uint64_t> value;
+};
+
+struct QueryPool {
+    // Number of values of each query, without the availability
+    uint32_t value_count;
+};
+
+struct PrivateDataSlot {
+    std::mutex lock;
+    std::unordered_map<uint64_t, uint64_t> data;
+};
+
+static std::atomic<uint64_t> next_handle{1};
+static std::atomic<VkDeviceAddress> next_address{1ull << 32};
+
+template <typename Handle>
+static Handle NewHandle() {
+    return reinterpret_cast<Handle>(next_handle.fetch_add(1, std::memory_order_relaxed));
+}
+
+template <typename Handle, typename Object>
+static Handle ToHandle(Object *object) {
+    return reinterpret_cast<Handle>(object);
+}
+
+template <typename Object, typename Handle>
+static Object *FromHandle(Handle handle) {
+    return reinterpret_cast<Object *>(handle);
+}
+
+static VkDeviceSize AlignUp(VkDeviceSize value) { return (value + kAlignment - 1) & ~(kAlignment - 1); }
+
+// Only a rough footprint, enough for the memory binding checks of the layer to see plausible sizes
+static VkDeviceSize ImageSize(const VkImageCreateInfo &create_info) {
+    const VkDeviceSize texels = static_cast<VkDeviceSize>(create_info.extent.width) * create_info.extent.height *
+                                create_info.extent.depth * create_info.arrayLayers * create_info.samples;
+    // 16 bytes per texel covers every format, and the full mip chain is below a third more
+    return AlignUp(std::max<VkDeviceSize>(texels * 16 * 4 / 3, kAlignment));
+}
+
+static void FillMemoryRequirements(VkDeviceSize size, VkMemoryRequirements &requirements) {
+    requirements.size = AlignUp(std::max<VkDeviceSize>(size, 1));
+    requirements.alignment = kAlignment;
+    requirements.memoryTypeBits = 0x3;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL NullCommand() { return VK_SUCCESS; }
+
+// Instance and physical device
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *, const VkAllocationCallbacks *,
+                                                     VkInstance *pInstance) {
+    *pInstance = reinterpret_cast<VkInstance>(new Instance());
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocationCallbacks *) {
+    delete reinterpret_cast<Instance *>(instance);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceVersion(uint32_t *pApiVersion) {
+    *pApiVersion = kApiVersion;
+    return VK_SUCCESS;
+}
+
+// No extensions and no layers
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceExtensionProperties(const char *, uint32_t *pPropertyCount,
+                                                                           VkExtensionProperties *) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(VkPhysicalDevice, const char *, uint32_t *pPropertyCount,
+                                                                         VkExtensionProperties *) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceLayerProperties(VkPhysicalDevice, uint32_t *pPropertyCount,
+                                                                     VkLayerProperties *) {
+    *pPropertyCount = 0;
+    return VK_SUCCESS;
+}
+
+// Every query returning a list the null device has nothing to put in
+static VKAPI_ATTR VkResult VKAPI_CALL EmptyPhysicalDeviceList(VkPhysicalDevice, uint32_t *pCount, void *) {
+    *pCount = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice, VkFormat, VkImageType,
+                                                                               VkSampleCountFlagBits, VkImageUsageFlags,
+                                                                               VkImageTiling, uint32_t *pPropertyCount,
+                                                                               VkSparseImageFormatProperties *) {
+    *pPropertyCount = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2(VkPhysicalDevice,
+                                                                                const VkPhysicalDeviceSparseImageFormatInfo2 *,
+                                                                                uint32_t *pPropertyCount,
+                                                                                VkSparseImageFormatProperties2 *) {
+    *pPropertyCount = 0;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(VkInstance instance, uint32_t *pPhysicalDeviceCount,
+                                                               VkPhysicalDevice *pPhysicalDevices) {
+    if (!pPhysicalDevices) {
+        *pPhysicalDeviceCount = 1;
+        return VK_SUCCESS;
+    }
+    if (*pPhysicalDeviceCount == 0) {
+        return VK_INCOMPLETE;
+    }
+    pPhysicalDevices[0] = reinterpret_cast<VkPhysicalDevice>(&reinterpret_cast<Instance *>(instance)->physical_device);
+    *pPhysicalDeviceCount = 1;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroups(
+    VkInstance instance, uint32_t *pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties *pPhysicalDeviceGroupProperties) {
+    if (!pPhysicalDeviceGroupProperties) {
+        *pPhysicalDeviceGroupCount = 1;
+        return VK_SUCCESS;
+    }
+    if (*pPhysicalDeviceGroupCount == 0) {
+        return VK_INCOMPLETE;
+    }
+    pPhysicalDeviceGroupProperties[0].physicalDeviceCount = 1;
+    pPhysicalDeviceGroupProperties[0].physicalDevices[0] =
+        reinterpret_cast<VkPhysicalDevice>(&reinterpret_cast<Instance *>(instance)->physical_device);
+    pPhysicalDeviceGroupProperties[0].subsetAllocation = VK_FALSE;
+    *pPhysicalDeviceGroupCount = 1;
+    return VK_SUCCESS;
+}
+
+static void SetAllBools(VkBool32 *first, VkBool32 *end) { std::fill(first, end, VK_TRUE); }
+
+// Every feature of Vulkan 1.3 except sparse resources, which would need a sparse binding queue
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures(VkPhysicalDevice, VkPhysicalDeviceFeatures *pFeatures) {
+    auto *bools = reinterpret_cast<VkBool32 *>(pFeatures);
+    SetAllBools(bools, bools + sizeof(VkPhysicalDeviceFeatures) / sizeof(VkBool32));
+    pFeatures->sparseBinding = VK_FALSE;
+    pFeatures->sparseResidencyBuffer = VK_FALSE;
+    pFeatures->sparseResidencyImage2D = VK_FALSE;
+    pFeatures->sparseResidencyImage3D = VK_FALSE;
+    pFeatures->sparseResidency2Samples = VK_FALSE;
+    pFeatures->sparseResidency4Samples = VK_FALSE;
+    pFeatures->sparseResidency8Samples = VK_FALSE;
+    pFeatures->sparseResidency16Samples = VK_FALSE;
+    pFeatures->sparseResidencyAliased = VK_FALSE;
+}
+
+template <typename Features>
+static void SetAllFeatures(Features *features) {
+    // Everything after sType and pNext is a VkBool32
+    auto *first = reinterpret_cast<VkBool32 *>(reinterpret_cast<char *>(features) + offsetof(Features, pNext) + sizeof(void *));
+    SetAllBools(first, reinterpret_cast<VkBool32 *>(features + 1));
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures2(VkPhysicalDevice physicalDevice,
+                                                             VkPhysicalDeviceFeatures2 *pFeatures) {
+    GetPhysicalDeviceFeatures(physicalDevice, &pFeatures->features);
+    for (auto *next = reinterpret_cast<VkBaseOutStructure *>(pFeatures->pNext); next; next = next->pNext) {
+        switch (next->sType) {
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES: {
+                auto *features = reinterpret_cast<VkPhysicalDeviceVulkan11Features *>(next);
+                SetAllFeatures(features);
+                features->protectedMemory = VK_FALSE;
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES:
+                SetAllFeatures(reinterpret_cast<VkPhysicalDeviceVulkan12Features *>(next));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES:
+                SetAllFeatures(reinterpret_cast<VkPhysicalDeviceVulkan13Features *>(next));
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static void FillLimits(VkPhysicalDeviceLimits &limits) {
+    limits = {};
+    limits.maxImageDimension1D = 16384;
+    limits.maxImageDimension2D = 16384;
+    limits.maxImageDimension3D = 2048;
+    limits.maxImageDimensionCube = 16384;
+    limits.maxImageArrayLayers = 2048;
+    limits.maxTexelBufferElements = 1u << 27;
+    limits.maxUniformBufferRange = 1u << 16;
+    limits.maxStorageBufferRange = 1u << 30;
+    limits.maxPushConstantsSize = 256;
+    limits.maxMemoryAllocationCount = 1u << 22;
+    limits.maxSamplerAllocationCount = 1u << 20;
+    limits.bufferImageGranularity = 1;
+    limits.sparseAddressSpaceSize = 0;
+    limits.maxBoundDescriptorSets = 32;
+    limits.maxPerStageDescriptorSamplers = 1u << 20;
+    limits.maxPerStageDescriptorUniformBuffers = 1u << 20;
+    limits.maxPerStageDescriptorStorageBuffers = 1u << 20;
+    limits.maxPerStageDescriptorSampledImages = 1u << 20;
+    limits.maxPerStageDescriptorStorageImages = 1u << 20;
+    limits.maxPerStageDescriptorInputAttachments = 1u << 20;
+    limits.maxPerStageResources = 1u << 20;
+    limits.maxDescriptorSetSamplers = 1u << 20;
+    limits.maxDescriptorSetUniformBuffers = 1u << 20;
+    limits.maxDescriptorSetUniformBuffersDynamic = 16;
+    limits.maxDescriptorSetStorageBuffers = 1u << 20;
+    limits.maxDescriptorSetStorageBuffersDynamic = 16;
+    limits.maxDescriptorSetSampledImages = 1u << 20;
+    limits.maxDescriptorSetStorageImages = 1u << 20;
+    limits.maxDescriptorSetInputAttachments = 1u << 20;
+    limits.maxVertexInputAttributes = 32;
+    limits.maxVertexInputBindings = 32;
+    limits.maxVertexInputAttributeOffset = 2047;
+    limits.maxVertexInputBindingStride = 2048;
+    limits.maxVertexOutputComponents = 128;
+    limits.maxTessellationGenerationLevel = 64;
+    limits.maxTessellationPatchSize = 32;
+    limits.maxTessellationControlPerVertexInputComponents = 128;
+    limits.maxTessellationControlPerVertexOutputComponents = 128;
+    limits.maxTessellationControlPerPatchOutputComponents = 120;
+    limits.maxTessellationControlTotalOutputComponents = 4096;
+    limits.maxTessellationEvaluationInputComponents = 128;
+    limits.maxTessellationEvaluationOutputComponents = 128;
+    limits.maxGeometryShaderInvocations = 32;
+    limits.maxGeometryInputComponents = 128;
+    limits.maxGeometryOutputComponents = 128;
+    limits.maxGeometryOutputVertices = 256;
+    limits.maxGeometryTotalOutputComponents = 1024;
+    limits.maxFragmentInputComponents = 128;
+    limits.maxFragmentOutputAttachments = 8;
+    limits.maxFragmentDualSrcAttachments = 1;
+    limits.maxFragmentCombinedOutputResources = 1u << 20;
+    limits.maxComputeSharedMemorySize = 49152;
+    limits.maxComputeWorkGroupCount[0] = 1u << 31;
+    limits.maxComputeWorkGroupCount[1] = 65535;
+    limits.maxComputeWorkGroupCount[2] = 65535;
+    limits.maxComputeWorkGroupInvocations = 1024;
+    limits.maxComputeWorkGroupSize[0] = 1024;
+    limits.maxComputeWorkGroupSize[1] = 1024;
+    limits.maxComputeWorkGroupSize[2] = 64;
+    limits.subPixelPrecisionBits = 8;
+    limits.subTexelPrecisionBits = 8;
+    limits.mipmapPrecisionBits = 8;
+    limits.maxDrawIndexedIndexValue = UINT32_MAX;
+    limits.maxDrawIndirectCount = UINT32_MAX;
+    limits.maxSamplerLodBias = 16.0f;
+    limits.maxSamplerAnisotropy = 16.0f;
+    limits.maxViewports = 16;
+    limits.maxViewportDimensions[0] = 16384;
+    limits.maxViewportDimensions[1] = 16384;
+    limits.viewportBoundsRange[0] = -32768.0f;
+    limits.viewportBoundsRange[1] = 32767.0f;
+    limits.viewportSubPixelBits = 8;
+    limits.minMemoryMapAlignment = 64;
+    limits.minTexelBufferOffsetAlignment = 16;
+    limits.minUniformBufferOffsetAlignment = 64;
+    limits.minStorageBufferOffsetAlignment = 16;
+    limits.minTexelOffset = -8;
+    limits.maxTexelOffset = 7;
+    limits.minTexelGatherOffset = -32;
+    limits.maxTexelGatherOffset = 31;
+    limits.minInterpolationOffset = -0.5f;
+    limits.maxInterpolationOffset = 0.4375f;
+    limits.subPixelInterpolationOffsetBits = 4;
+    limits.maxFramebufferWidth = 16384;
+    limits.maxFramebufferHeight = 16384;
+    limits.maxFramebufferLayers = 2048;
+    limits.framebufferColorSampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_4_BIT;
+    limits.framebufferDepthSampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_4_BIT;
+    limits.framebufferStencilSampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_4_BIT;
+    limits.framebufferNoAttachmentsSampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_4_BIT;
+    limits.maxColorAttachments = 8;
+    limits.sampledImageColorSampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_4_BIT;
+    limits.sampledImageIntegerSampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_4_BIT;
+    limits.sampledImageDepthSampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_4_BIT;
+    limits.sampledImageStencilSampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_4_BIT;
+    limits.storageImageSampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_4_BIT;
+    limits.maxSampleMaskWords = 1;
+    limits.timestampComputeAndGraphics = VK_TRUE;
+    limits.timestampPeriod = 1.0f;
+    limits.maxClipDistances = 8;
+    limits.maxCullDistances = 8;
+    limits.maxCombinedClipAndCullDistances = 8;
+    limits.discreteQueuePriorities = 2;
+    limits.pointSizeRange[0] = 1.0f;
+    limits.pointSizeRange[1] = 64.0f;
+    limits.lineWidthRange[0] = 1.0f;
+    limits.lineWidthRange[1] = 8.0f;
+    limits.pointSizeGranularity = 0.125f;
+    limits.lineWidthGranularity = 0.125f;
+    limits.strictLines = VK_TRUE;
+    limits.standardSampleLocations = VK_TRUE;
+    limits.optimalBufferCopyOffsetAlignment = 1;
+    limits.optimalBufferCopyRowPitchAlignment = 1;
+    limits.nonCoherentAtomSize = 64;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(VkPhysicalDevice, VkPhysicalDeviceProperties *pProperties) {
+    *pProperties = {};
+    pProperties->apiVersion = kApiVersion;
+    pProperties->driverVersion = 1;
+    pProperties->vendorID = VK_VENDOR_ID_KHRONOS;
+    pProperties->deviceID = 0;
+    pProperties->deviceType = VK_PHYSICAL_DEVICE_TYPE_CPU;
+    std::strncpy(pProperties->deviceName, "Vulkan Null Device", VK_MAX_PHYSICAL_DEVICE_NAME_SIZE - 1);
+    FillLimits(pProperties->limits);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties2(VkPhysicalDevice physicalDevice,
+                                                               VkPhysicalDeviceProperties2 *pProperties) {
+    GetPhysicalDeviceProperties(physicalDevice, &pProperties->properties);
+    for (auto *next = reinterpret_cast<VkBaseOutStructure *>(pProperties->pNext); next; next = next->pNext) {
+        switch (next->sType) {
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES: {
+                auto *props = reinterpret_cast<VkPhysicalDeviceVulkan11Properties *>(next);
+                props->deviceNodeMask = 1;
+                props->deviceLUIDValid = VK_FALSE;
+                props->subgroupSize = 32;
+                props->subgroupSupportedStages = VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_COMPUTE_BIT;
+                props->subgroupSupportedOperations = 0xFF;  // basic to quad
+                props->subgroupQuadOperationsInAllStages = VK_TRUE;
+                props->pointClippingBehavior = VK_POINT_CLIPPING_BEHAVIOR_ALL_CLIP_PLANES;
+                props->maxMultiviewViewCount = 6;
+                props->maxMultiviewInstanceIndex = (1u << 27) - 1;
+                props->protectedNoFault = VK_FALSE;
+                props->maxPerSetDescriptors = 1u << 20;
+                props->maxMemoryAllocationSize = kHeapSize;
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES: {
+                auto *props = reinterpret_cast<VkPhysicalDeviceVulkan12Properties *>(next);
+                props->driverID = VK_DRIVER_ID_MESA_LLVMPIPE;
+                std::strncpy(props->driverName, "null", VK_MAX_DRIVER_NAME_SIZE - 1);
+                std::strncpy(props->driverInfo, "Validation layer benchmarks", VK_MAX_DRIVER_INFO_SIZE - 1);
+                props->conformanceVersion = {1, 3, 0, 0};
+                props->denormBehaviorIndependence = VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL;
+                props->roundingModeIndependence = VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL;
+                props->maxUpdateAfterBindDescriptorsInAllPools = 1u << 20;
+                props->shaderUniformBufferArrayNonUniformIndexingNative = VK_TRUE;
+                props->shaderSampledImageArrayNonUniformIndexingNative = VK_TRUE;
+                props->shaderStorageBufferArrayNonUniformIndexingNative = VK_TRUE;
+                props->shaderStorageImageArrayNonUniformIndexingNative = VK_TRUE;
+                props->shaderInputAttachmentArrayNonUniformIndexingNative = VK_TRUE;
+                props->robustBufferAccessUpdateAfterBind = VK_TRUE;
+                props->quadDivergentImplicitLod = VK_TRUE;
+                props->maxPerStageDescriptorUpdateAfterBindSamplers = 1u << 20;
+                props->maxPerStageDescriptorUpdateAfterBindUniformBuffers = 1u << 20;
+                props->maxPerStageDescriptorUpdateAfterBindStorageBuffers = 1u << 20;
+                props->maxPerStageDescriptorUpdateAfterBindSampledImages = 1u << 20;
+                props->maxPerStageDescriptorUpdateAfterBindStorageImages = 1u << 20;
+                props->maxPerStageDescriptorUpdateAfterBindInputAttachments = 1u << 20;
+                props->maxPerStageUpdateAfterBindResources = 1u << 20;
+                props->maxDescriptorSetUpdateAfterBindSamplers = 1u << 20;
+                props->maxDescriptorSetUpdateAfterBindUniformBuffers = 1u << 20;
+                props->maxDescriptorSetUpdateAfterBindUniformBuffersDynamic = 16;
+                props->maxDescriptorSetUpdateAfterBindStorageBuffers = 1u << 20;
+                props->maxDescriptorSetUpdateAfterBindStorageBuffersDynamic = 16;
+                props->maxDescriptorSetUpdateAfterBindSampledImages = 1u << 20;
+                props->maxDescriptorSetUpdateAfterBindStorageImages = 1u << 20;
+                props->maxDescriptorSetUpdateAfterBindInputAttachments = 1u << 20;
+                props->supportedDepthResolveModes = VK_RESOLVE_MODE_SAMPLE_ZERO_BIT | VK_RESOLVE_MODE_MIN_BIT |
+                                                    VK_RESOLVE_MODE_MAX_BIT;
+                props->supportedStencilResolveModes = VK_RESOLVE_MODE_SAMPLE_ZERO_BIT | VK_RESOLVE_MODE_MIN_BIT |
+                                                      VK_RESOLVE_MODE_MAX_BIT;
+                props->independentResolveNone = VK_TRUE;
+                props->independentResolve = VK_TRUE;
+                props->filterMinmaxSingleComponentFormats = VK_TRUE;
+                props->filterMinmaxImageComponentMapping = VK_TRUE;
+                props->maxTimelineSemaphoreValueDifference = UINT64_MAX >> 1;
+                props->framebufferIntegerColorSampleCounts = VK_SAMPLE_COUNT_1_BIT;
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES: {
+                auto *props = reinterpret_cast<VkPhysicalDeviceVulkan13Properties *>(next);
+                props->minSubgroupSize = 32;
+                props->maxSubgroupSize = 32;
+                props->maxComputeWorkgroupSubgroups = 32;
+                props->requiredSubgroupSizeStages = VK_SHADER_STAGE_COMPUTE_BIT;
+                props->maxInlineUniformBlockSize = 256;
+                props->maxPerStageDescriptorInlineUniformBlocks = 4;
+                props->maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks = 4;
+                props->maxDescriptorSetInlineUniformBlocks = 4;
+                props->maxDescriptorSetUpdateAfterBindInlineUniformBlocks = 4;
+                props->maxInlineUniformTotalSize = 1024;
+                props->storageTexelBufferOffsetAlignmentBytes = 16;
+                props->uniformTexelBufferOffsetAlignmentBytes = 16;
+                props->maxBufferSize = kHeapSize;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice, uint32_t *pQueueFamilyPropertyCount,
+                                                                         VkQueueFamilyProperties *pQueueFamilyProperties) {
+    if (!pQueueFamilyProperties) {
+        *pQueueFamilyPropertyCount = kQueueFamilyCount;
+        return;
+    }
+    if (*pQueueFamilyPropertyCount == 0) {
+        return;
+    }
+    pQueueFamilyProperties[0].queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+    pQueueFamilyProperties[0].queueCount = kQueueCount;
+    pQueueFamilyProperties[0].timestampValidBits = 64;
+    pQueueFamilyProperties[0].minImageTransferGranularity = {1, 1, 1};
+    *pQueueFamilyPropertyCount = kQueueFamilyCount;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties2(VkPhysicalDevice physicalDevice,
+                                                                          uint32_t *pQueueFamilyPropertyCount,
+                                                                          VkQueueFamilyProperties2 *pQueueFamilyProperties) {
+    if (!pQueueFamilyProperties) {
+        *pQueueFamilyPropertyCount = kQueueFamilyCount;
+        return;
+    }
+    if (*pQueueFamilyPropertyCount == 0) {
+        return;
+    }
+    uint32_t count = kQueueFamilyCount;
+    GetPhysicalDeviceQueueFamilyProperties(physicalDevice, &count, &pQueueFamilyProperties[0].queueFamilyProperties);
+    *pQueueFamilyPropertyCount = kQueueFamilyCount;
+}
+
+// One heap, with a host visible and a device only type
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(VkPhysicalDevice,
+                                                                    VkPhysicalDeviceMemoryProperties *pMemoryProperties) {
+    *pMemoryProperties = {};
+    pMemoryProperties->memoryHeapCount = 1;
+    pMemoryProperties->memoryHeaps[0].size = kHeapSize;
+    pMemoryProperties->memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+    pMemoryProperties->memoryTypeCount = 2;
+    pMemoryProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    pMemoryProperties->memoryTypes[0].heapIndex = 0;
+    pMemoryProperties->memoryTypes[1].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    pMemoryProperties->memoryTypes[1].heapIndex = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties2(VkPhysicalDevice physicalDevice,
+                                                                     VkPhysicalDeviceMemoryProperties2 *pMemoryProperties) {
+    GetPhysicalDeviceMemoryProperties(physicalDevice, &pMemoryProperties->memoryProperties);
+}
+
+static constexpr VkFormatFeatureFlags kFormatFeatures =
+    VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT | VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT |
+    VK_FORMAT_FEATURE_UNIFORM_TEXEL_BUFFER_BIT | VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_BIT |
+    VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_ATOMIC_BIT | VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT |
+    VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT | VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT |
+    VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT |
+    VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT | VK_FORMAT_FEATURE_TRANSFER_SRC_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties(VkPhysicalDevice, VkFormat format,
+                                                                    VkFormatProperties *pFormatProperties) {
+    *pFormatProperties = {};
+    if (format != VK_FORMAT_UNDEFINED) {
+        pFormatProperties->linearTilingFeatures = kFormatFeatures;
+        pFormatProperties->optimalTilingFeatures = kFormatFeatures;
+        pFormatProperties->bufferFeatures = kFormatFeatures;
+    }
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties2(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                     VkFormatProperties2 *pFormatProperties) {
+    GetPhysicalDeviceFormatProperties(physicalDevice, format, &pFormatProperties->formatProperties);
+    for (auto *next = reinterpret_cast<VkBaseOutStructure *>(pFormatProperties->pNext); next; next = next->pNext) {
+        if (next->sType == VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3) {
+            auto *props = reinterpret_cast<VkFormatProperties3 *>(next);
+            props->linearTilingFeatures = pFormatProperties->formatProperties.linearTilingFeatures;
+            props->optimalTilingFeatures = pFormatProperties->formatProperties.optimalTilingFeatures;
+            props->bufferFeatures = pFormatProperties->formatProperties.bufferFeatures;
+        }
+    }
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties(VkPhysicalDevice, VkFormat format, VkImageType type,
+                                                                            VkImageTiling, VkImageUsageFlags, VkImageCreateFlags,
+                                                                            VkImageFormatProperties *pImageFormatProperties) {
+    if (format == VK_FORMAT_UNDEFINED) {
+        return VK_ERROR_FORMAT_NOT_SUPPORTED;
+    }
+    *pImageFormatProperties = {};
+    pImageFormatProperties->maxExtent = {16384, type == VK_IMAGE_TYPE_1D ? 1u : 16384u, type == VK_IMAGE_TYPE_3D ? 2048u : 1u};
+    pImageFormatProperties->maxMipLevels = 15;
+    pImageFormatProperties->maxArrayLayers = type == VK_IMAGE_TYPE_3D ? 1 : 2048;
+    pImageFormatProperties->sampleCounts = VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_4_BIT;
+    pImageFormatProperties->maxResourceSize = kHeapSize;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2(
+    VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2 *pImageFormatInfo,
+    VkImageFormatProperties2 *pImageFormatProperties) {
+    return GetPhysicalDeviceImageFormatProperties(physicalDevice, pImageFormatInfo->format, pImageFormatInfo->type,
+                                                  pImageFormatInfo->tiling, pImageFormatInfo->usage, pImageFormatInfo->flags,
+                                                  &pImageFormatProperties->imageFormatProperties);
+}
+
+// Nothing is exportable or importable
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferProperties(VkPhysicalDevice,
+                                                                           const VkPhysicalDeviceExternalBufferInfo *,
+                                                                           VkExternalBufferProperties *pExternalBufferProperties) {
+    pExternalBufferProperties->externalMemoryProperties = {};
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFenceProperties(VkPhysicalDevice,
+                                                                          const VkPhysicalDeviceExternalFenceInfo *,
+                                                                          VkExternalFenceProperties *pExternalFenceProperties) {
+    pExternalFenceProperties->exportFromImportedHandleTypes = 0;
+    pExternalFenceProperties->compatibleHandleTypes = 0;
+    pExternalFenceProperties->externalFenceFeatures = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphoreProperties(
+    VkPhysicalDevice, const VkPhysicalDeviceExternalSemaphoreInfo *, VkExternalSemaphoreProperties *pExternalSemaphoreProperties) {
+    pExternalSemaphoreProperties->exportFromImportedHandleTypes = 0;
+    pExternalSemaphoreProperties->compatibleHandleTypes = 0;
+    pExternalSemaphoreProperties->externalSemaphoreFeatures = 0;
+}
+
+// Device
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice, const VkDeviceCreateInfo *pCreateInfo,
+                                                   const VkAllocationCallbacks *, VkDevice *pDevice) {
+    auto *device = new Device();
+    for (uint32_t i = 0; i < pCreateInfo->queueCreateInfoCount; ++i) {
+        const VkDeviceQueueCreateInfo &queue_create_info = pCreateInfo->pQueueCreateInfos[i];
+        for (uint32_t queue_index = 0; queue_index < queue_create_info.queueCount; ++queue_index) {
+            auto queue = std::make_unique<Queue>();
+            queue->family_index = queue_create_info.queueFamilyIndex;
+            queue->queue_index = queue_index;
+            device->queues.emplace_back(std::move(queue));
+        }
+    }
+    *pDevice = reinterpret_cast<VkDevice>(device);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *) {
+    delete reinterpret_cast<Device *>(device);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue) {
+    *pQueue = VK_NULL_HANDLE;
+    for (const auto &queue : reinterpret_cast<Device *>(device)->queues) {
+        if (queue->family_index == queueFamilyIndex && queue->queue_index == queueIndex) {
+            *pQueue = reinterpret_cast<VkQueue>(queue.get());
+            return;
+        }
+    }
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2 *pQueueInfo, VkQueue *pQueue) {
+    GetDeviceQueue(device, pQueueInfo->queueFamilyIndex, pQueueInfo->queueIndex, pQueue);
+}
+
+// Every object without state: (device, create info, allocator, handle)
+template <typename Handle>
+static VKAPI_ATTR VkResult VKAPI_CALL CreateObject(VkDevice, const void *, const VkAllocationCallbacks *, Handle *pHandle) {
+    *pHandle = NewHandle<Handle>();
+    return VK_SUCCESS;
+}
+
+// vkCreateGraphicsPipelines, vkCreateComputePipelines and the like: (device, cache, count, create infos, allocator, pipelines)
+static VKAPI_ATTR VkResult VKAPI_CALL CreatePipelines(VkDevice, VkPipelineCache, uint32_t createInfoCount, const void *,
+                                                      const VkAllocationCallbacks *, VkPipeline *pPipelines) {
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        pPipelines[i] = NewHandle<VkPipeline>();
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice device, VkDeferredOperationKHR,
+                                                                   VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                                                   const VkRayTracingPipelineCreateInfoKHR *pCreateInfos,
+                                                                   const VkAllocationCallbacks *pAllocator,
+                                                                   VkPipeline *pPipelines) {
+    return CreatePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice, uint32_t createInfoCount, const VkShaderCreateInfoEXT *,
+                                                       const VkAllocationCallbacks *, VkShaderEXT *pShaders) {
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        pShaders[i] = NewHandle<VkShaderEXT>();
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice, VkPipelineCache, size_t *pDataSize, void *) {
+    *pDataSize = 0;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice, const VkMemoryAllocateInfo *pAllocateInfo,
+                                                     const VkAllocationCallbacks *, VkDeviceMemory *pMemory) {
+    *pMemory = ToHandle<VkDeviceMemory>(new Memory{pAllocateInfo->allocationSize, nullptr});
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice, VkDeviceMemory memory, const VkAllocationCallbacks *) {
+    if (memory != VK_NULL_HANDLE) {
+        Memory *object = FromHandle<Memory>(memory);
+        std::free(object->data);
+        delete object;
+    }
+}
+
+// Host memory is only allocated when the memory is first mapped, and kept until it is freed
+static VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize,
+                                                VkMemoryMapFlags, void **ppData) {
+    Memory *object = FromHandle<Memory>(memory);
+    if (!object->data) {
+        object->data = std::calloc(1, static_cast<size_t>(object->size));
+        if (!object->data) {
+            return VK_ERROR_MEMORY_MAP_FAILED;
+        }
+    }
+    *ppData = static_cast<char *>(object->data) + offset;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL MapMemory2KHR(VkDevice device, const VkMemoryMapInfoKHR *pMemoryMapInfo, void **ppData) {
+    return MapMemory(device, pMemoryMapInfo->memory, pMemoryMapInfo->offset, pMemoryMapInfo->size, pMemoryMapInfo->flags, ppData);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice, const VkBufferCreateInfo *pCreateInfo, const VkAllocationCallbacks *,
+                                                   VkBuffer *pBuffer) {
+    const VkDeviceSize size = AlignUp(pCreateInfo->size);
+    *pBuffer = ToHandle<VkBuffer>(new Buffer{pCreateInfo->size, next_address.fetch_add(size, std::memory_order_relaxed)});
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice, VkBuffer buffer, const VkAllocationCallbacks *) {
+    delete FromHandle<Buffer>(buffer);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice, const VkImageCreateInfo *pCreateInfo, const VkAllocationCallbacks *,
+                                                  VkImage *pImage) {
+    *pImage = ToHandle<VkImage>(new Image{ImageSize(*pCreateInfo)});
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice, VkImage image, const VkAllocationCallbacks *) {
+    delete FromHandle<Image>(image);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(VkDevice, VkBuffer buffer,
+                                                              VkMemoryRequirements *pMemoryRequirements) {
+    FillMemoryRequirements(FromHandle<Buffer>(buffer)->size, *pMemoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(VkDevice device, const VkBufferMemoryRequirementsInfo2 *pInfo,
+                                                               VkMemoryRequirements2 *pMemoryRequirements) {
+    GetBufferMemoryRequirements(device, pInfo->buffer, &pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirements(VkDevice, const VkDeviceBufferMemoryRequirements *pInfo,
+                                                                    VkMemoryRequirements2 *pMemoryRequirements) {
+    FillMemoryRequirements(pInfo->pCreateInfo->size, pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(VkDevice, VkImage image, VkMemoryRequirements *pMemoryRequirements) {
+    FillMemoryRequirements(FromHandle<Image>(image)->size, *pMemoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(VkDevice device, const VkImageMemoryRequirementsInfo2 *pInfo,
+                                                              VkMemoryRequirements2 *pMemoryRequirements) {
+    GetImageMemoryRequirements(device, pInfo->image, &pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceImageMemoryRequirements(VkDevice, const VkDeviceImageMemoryRequirements *pInfo,
+                                                                   VkMemoryRequirements2 *pMemoryRequirements) {
+    FillMemoryRequirements(ImageSize(*pInfo->pCreateInfo), pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(VkDevice, VkImage, uint32_t *pSparseMemoryRequirementCount,
+                                                                   VkSparseImageMemoryRequirements *) {
+    *pSparseMemoryRequirementCount = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(VkDevice, const VkImageSparseMemoryRequirementsInfo2 *,
+                                                                    uint32_t *pSparseMemoryRequirementCount,
+                                                                    VkSparseImageMemoryRequirements2 *) {
+    *pSparseMemoryRequirementCount = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirements(VkDevice, const VkDeviceImageMemoryRequirements *,
+                                                                         uint32_t *pSparseMemoryRequirementCount,
+                                                                         VkSparseImageMemoryRequirements2 *) {
+    *pSparseMemoryRequirementCount = 0;
+}
+
+// Linear images are laid out tightly with 16 bytes per texel
+static VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(VkDevice, VkImage image, const VkImageSubresource *,
+                                                            VkSubresourceLayout *pLayout) {
+    pLayout->offset = 0;
+    pLayout->size = FromHandle<Image>(image)->size;
+    pLayout->rowPitch = 16 * 16384;
+    pLayout->arrayPitch = pLayout->rowPitch * 16384;
+    pLayout->depthPitch = pLayout->arrayPitch;
+}
+
+static VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(VkDevice, const VkBufferDeviceAddressInfo *pInfo) {
+    return FromHandle<Buffer>(pInfo->buffer)->address;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(VkDevice, const VkDescriptorSetLayoutCreateInfo *,
+                                                               VkDescriptorSetLayoutSupport *pSupport) {
+    pSupport->supported = VK_TRUE;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(VkDevice, VkRenderPass, VkExtent2D *pGranularity) {
+    *pGranularity = {1, 1};
+}
+
+// The work is done as soon as it is submitted
+static VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(VkDevice, VkEvent) { return VK_EVENT_SET; }
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice, const VkSemaphoreCreateInfo *pCreateInfo,
+                                                      const VkAllocationCallbacks *, VkSemaphore *pSemaphore) {
+    const auto *type_create_info = static_cast<const VkSemaphoreTypeCreateInfo *>(pCreateInfo->pNext);
+    while (type_create_info && type_create_info->sType != VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO) {
+        type_create_info = static_cast<const VkSemaphoreTypeCreateInfo *>(type_create_info->pNext);
+    }
+    *pSemaphore = ToHandle<VkSemaphore>(new Semaphore{type_create_info ? type_create_info->initialValue : 0});
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice, VkSemaphore semaphore, const VkAllocationCallbacks *) {
+    delete FromHandle<Semaphore>(semaphore);
+}
+
+// Binary semaphores get a value too, nobody reads it
+static void SignalTimeline(VkSemaphore semaphore, uint64_t value) {
+    std::atomic<uint64_t> &counter = FromHandle<Semaphore>(semaphore)->value;
+    uint64_t current = counter.load(std::memory_order_relaxed);
+    while (current < value && !counter.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(VkDevice, const VkSemaphoreSignalInfo *pSignalInfo) {
+    SignalTimeline(pSignalInfo->semaphore, pSignalInfo->value);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(VkDevice, VkSemaphore semaphore, uint64_t *pValue) {
+    *pValue = FromHandle<Semaphore>(semaphore)->value.load(std::memory_order_relaxed);
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence) {
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        const auto *timeline_info = static_cast<const VkTimelineSemaphoreSubmitInfo *>(pSubmits[i].pNext);
+        while (timeline_info && timeline_info->sType != VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO) {
+            timeline_info = static_cast<const VkTimelineSemaphoreSubmitInfo *>(timeline_info->pNext);
+        }
+        if (!timeline_info || !timeline_info->pSignalSemaphoreValues) {
+            continue;
+        }
+        const uint32_t count = std::min(pSubmits[i].signalSemaphoreCount, timeline_info->signalSemaphoreValueCount);
+        for (uint32_t j = 0; j < count; ++j) {
+            SignalTimeline(pSubmits[i].pSignalSemaphores[j], timeline_info->pSignalSemaphoreValues[j]);
+        }
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(VkQueue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence) {
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        for (uint32_t j = 0; j < pSubmits[i].signalSemaphoreInfoCount; ++j) {
+            SignalTimeline(pSubmits[i].pSignalSemaphoreInfos[j].semaphore, pSubmits[i].pSignalSemaphoreInfos[j].value);
+        }
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice, const VkQueryPoolCreateInfo *pCreateInfo,
+                                                      const VkAllocationCallbacks *, VkQueryPool *pQueryPool) {
+    uint32_t value_count = 1;
+    if (pCreateInfo->queryType == VK_QUERY_TYPE_PIPELINE_STATISTICS) {
+        value_count = 0;
+        for (VkQueryPipelineStatisticFlags bits = pCreateInfo->pipelineStatistics; bits != 0; bits &= bits - 1) {
+            ++value_count;
+        }
+    }
+    *pQueryPool = ToHandle<VkQueryPool>(new QueryPool{value_count});
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(VkDevice, VkQueryPool queryPool, const VkAllocationCallbacks *) {
+    delete FromHandle<QueryPool>(queryPool);
+}
+
+// Every query is available with all of its values at zero
+static VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice, VkQueryPool queryPool, uint32_t, uint32_t queryCount,
+                                                          size_t dataSize, void *pData, VkDeviceSize stride,
+                                                          VkQueryResultFlags flags) {
+    std::memset(pData, 0, dataSize);
+    if (flags & VK_QUERY_RESULT_WITH_AVAILABILITY_BIT) {
+        const uint32_t value_count = FromHandle<QueryPool>(queryPool)->value_count;
+        for (uint32_t i = 0; i < queryCount; ++i) {
+            char *availability = static_cast<char *>(pData) + i * stride;
+            if (flags & VK_QUERY_RESULT_64_BIT) {
+                reinterpret_cast<uint64_t *>(availability)[value_count] = 1;
+            } else {
+                reinterpret_cast<uint32_t *>(availability)[value_count] = 1;
+            }
+        }
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlot(VkDevice, const VkPrivateDataSlotCreateInfo *,
+                                                            const VkAllocationCallbacks *, VkPrivateDataSlot *pPrivateDataSlot) {
+    *pPrivateDataSlot = ToHandle<VkPrivateDataSlot>(new PrivateDataSlot());
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlot(VkDevice, VkPrivateDataSlot privateDataSlot,
+                                                         const VkAllocationCallbacks *) {
+    delete FromHandle<PrivateDataSlot>(privateDataSlot);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL SetPrivateData(VkDevice, VkObjectType, uint64_t objectHandle,
+                                                     VkPrivateDataSlot privateDataSlot, uint64_t data) {
+    PrivateDataSlot *slot = FromHandle<PrivateDataSlot>(privateDataSlot);
+    std::lock_guard<std::mutex> lock(slot->lock);
+    slot->data[objectHandle] = data;
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetPrivateData(VkDevice, VkObjectType, uint64_t objectHandle,
+                                                 VkPrivateDataSlot privateDataSlot, uint64_t *pData) {
+    PrivateDataSlot *slot = FromHandle<PrivateDataSlot>(privateDataSlot);
+    std::lock_guard<std::mutex> lock(slot->lock);
+    auto it = slot->data.find(objectHandle);
+    *pData = it != slot->data.end() ? it->second : 0;
+}
+
+// There is a single physical device and all memory is resident
+static VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(VkDevice, uint32_t, uint32_t, uint32_t,
+                                                                   VkPeerMemoryFeatureFlags *pPeerMemoryFeatures) {
+    *pPeerMemoryFeatures = VK_PEER_MEMORY_FEATURE_COPY_SRC_BIT | VK_PEER_MEMORY_FEATURE_COPY_DST_BIT |
+                           VK_PEER_MEMORY_FEATURE_GENERIC_SRC_BIT | VK_PEER_MEMORY_FEATURE_GENERIC_DST_BIT;
+}
+
+static VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(VkDevice, VkDeviceMemory memory,
+                                                            VkDeviceSize *pCommittedMemoryInBytes) {
+    *pCommittedMemoryInBytes = FromHandle<Memory>(memory)->size;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice, const VkCommandPoolCreateInfo *, const VkAllocationCallbacks *,
+                                                        VkCommandPool *pCommandPool) {
+    *pCommandPool = ToHandle<VkCommandPool>(new CommandPool());
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice, VkCommandPool commandPool, const VkAllocationCallbacks *) {
+    if (commandPool != VK_NULL_HANDLE) {
+        CommandPool *pool = FromHandle<CommandPool>(commandPool);
+        for (CommandBuffer *command_buffer : pool->command_buffers) {
+            delete command_buffer;
+        }
+        delete pool;
+    }
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo *pAllocateInfo,
+                                                             VkCommandBuffer *pCommandBuffers) {
+    CommandPool *pool = FromHandle<CommandPool>(pAllocateInfo->commandPool);
+    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+        auto *command_buffer = new CommandBuffer();
+        pool->command_buffers.push_back(command_buffer);
+        pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>(command_buffer);
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice, VkCommandPool commandPool, uint32_t commandBufferCount,
+                                                     const VkCommandBuffer *pCommandBuffers) {
+    CommandPool *pool = FromHandle<CommandPool>(commandPool);
+    for (uint32_t i = 0; i < commandBufferCount; ++i) {
+        auto *command_buffer = reinterpret_cast<CommandBuffer *>(pCommandBuffers[i]);
+        auto it = std::find(pool->command_buffers.begin(), pool->command_buffers.end(), command_buffer);
+        if (it != pool->command_buffers.end()) {
+            pool->command_buffers.erase(it);
+            delete command_buffer;
+        }
+    }
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice, const VkDescriptorSetAllocateInfo *pAllocateInfo,
+                                                             VkDescriptorSet *pDescriptorSets) {
+    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i) {
+        pDescriptorSets[i] = NewHandle<VkDescriptorSet>();
+    }
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *pName);
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *pName);
+
+template <typename Function>
+static PFN_vkVoidFunction Proc(Function function) {
+    return reinterpret_cast<PFN_vkVoidFunction>(function);
+}
+
+// Global, instance and physical device commands, nothing else is exposed at that level
+static const std::unordered_map<std::string, PFN_vkVoidFunction> &InstanceFunctions() {
+    static const std::unordered_map<std::string, PFN_vkVoidFunction> functions = {
+        {"vkGetInstanceProcAddr", Proc(GetInstanceProcAddr)},
+        {"vkGetDeviceProcAddr", Proc(GetDeviceProcAddr)},
+        {"vkCreateInstance", Proc(CreateInstance)},
+        {"vkDestroyInstance", Proc(DestroyInstance)},
+        {"vkEnumerateInstanceVersion", Proc(EnumerateInstanceVersion)},
+        {"vkEnumerateInstanceExtensionProperties", Proc(EnumerateInstanceExtensionProperties)},
+        {"vkEnumerateDeviceExtensionProperties", Proc(EnumerateDeviceExtensionProperties)},
+        {"vkEnumerateDeviceLayerProperties", Proc(EnumerateDeviceLayerProperties)},
+        {"vkEnumeratePhysicalDevices", Proc(EnumeratePhysicalDevices)},
+        {"vkEnumeratePhysicalDeviceGroups", Proc(EnumeratePhysicalDeviceGroups)},
+        {"vkEnumeratePhysicalDeviceGroupsKHR", Proc(EnumeratePhysicalDeviceGroups)},
+        {"vkGetPhysicalDeviceFeatures", Proc(GetPhysicalDeviceFeatures)},
+        {"vkGetPhysicalDeviceFeatures2", Proc(GetPhysicalDeviceFeatures2)},
+        {"vkGetPhysicalDeviceFeatures2KHR", Proc(GetPhysicalDeviceFeatures2)},
+        {"vkGetPhysicalDeviceProperties", Proc(GetPhysicalDeviceProperties)},
+        {"vkGetPhysicalDeviceProperties2", Proc(GetPhysicalDeviceProperties2)},
+        {"vkGetPhysicalDeviceProperties2KHR", Proc(GetPhysicalDeviceProperties2)},
+        {"vkGetPhysicalDeviceQueueFamilyProperties", Proc(GetPhysicalDeviceQueueFamilyProperties)},
+        {"vkGetPhysicalDeviceQueueFamilyProperties2", Proc(GetPhysicalDeviceQueueFamilyProperties2)},
+        {"vkGetPhysicalDeviceQueueFamilyProperties2KHR", Proc(GetPhysicalDeviceQueueFamilyProperties2)},
+        {"vkGetPhysicalDeviceMemoryProperties", Proc(GetPhysicalDeviceMemoryProperties)},
+        {"vkGetPhysicalDeviceMemoryProperties2", Proc(GetPhysicalDeviceMemoryProperties2)},
+        {"vkGetPhysicalDeviceMemoryProperties2KHR", Proc(GetPhysicalDeviceMemoryProperties2)},
+        {"vkGetPhysicalDeviceFormatProperties", Proc(GetPhysicalDeviceFormatProperties)},
+        {"vkGetPhysicalDeviceFormatProperties2", Proc(GetPhysicalDeviceFormatProperties2)},
+        {"vkGetPhysicalDeviceFormatProperties2KHR", Proc(GetPhysicalDeviceFormatProperties2)},
+        {"vkGetPhysicalDeviceImageFormatProperties", Proc(GetPhysicalDeviceImageFormatProperties)},
+        {"vkGetPhysicalDeviceImageFormatProperties2", Proc(GetPhysicalDeviceImageFormatProperties2)},
+        {"vkGetPhysicalDeviceImageFormatProperties2KHR", Proc(GetPhysicalDeviceImageFormatProperties2)},
+        {"vkGetPhysicalDeviceSparseImageFormatProperties", Proc(GetPhysicalDeviceSparseImageFormatProperties)},
+        {"vkGetPhysicalDeviceSparseImageFormatProperties2", Proc(GetPhysicalDeviceSparseImageFormatProperties2)},
+        {"vkGetPhysicalDeviceSparseImageFormatProperties2KHR", Proc(GetPhysicalDeviceSparseImageFormatProperties2)},
+        {"vkGetPhysicalDeviceExternalBufferProperties", Proc(GetPhysicalDeviceExternalBufferProperties)},
+        {"vkGetPhysicalDeviceExternalBufferPropertiesKHR", Proc(GetPhysicalDeviceExternalBufferProperties)},
+        {"vkGetPhysicalDeviceExternalFenceProperties", Proc(GetPhysicalDeviceExternalFenceProperties)},
+        {"vkGetPhysicalDeviceExternalFencePropertiesKHR", Proc(GetPhysicalDeviceExternalFenceProperties)},
+        {"vkGetPhysicalDeviceExternalSemaphoreProperties", Proc(GetPhysicalDeviceExternalSemaphoreProperties)},
+        {"vkGetPhysicalDeviceExternalSemaphorePropertiesKHR", Proc(GetPhysicalDeviceExternalSemaphoreProperties)},
+        {"vkGetPhysicalDeviceToolProperties", Proc(EmptyPhysicalDeviceList)},
+        {"vkGetPhysicalDeviceToolPropertiesEXT", Proc(EmptyPhysicalDeviceList)},
+        {"vkCreateDevice", Proc(CreateDevice)},
+    };
+    return functions;
+}
+
+// Device commands with an output to fill or an object to track, everything else is NullCommand
+static const std::unordered_map<std::string, PFN_vkVoidFunction> &DeviceFunctions() {
+    static const std::unordered_map<std::string, PFN_vkVoidFunction> functions = {
+        {"vkGetDeviceProcAddr", Proc(GetDeviceProcAddr)},
+        {"vkDestroyDevice", Proc(DestroyDevice)},
+        {"vkGetDeviceQueue", Proc(GetDeviceQueue)},
+        {"vkGetDeviceQueue2", Proc(GetDeviceQueue2)},
+        {"vkAllocateMemory", Proc(AllocateMemory)},
+        {"vkFreeMemory", Proc(FreeMemory)},
+        {"vkMapMemory", Proc(MapMemory)},
+        {"vkMapMemory2KHR", Proc(MapMemory2KHR)},
+        {"vkCreateBuffer", Proc(CreateBuffer)},
+        {"vkDestroyBuffer", Proc(DestroyBuffer)},
+        {"vkCreateImage", Proc(CreateImage)},
+        {"vkDestroyImage", Proc(DestroyImage)},
+        {"vkGetBufferMemoryRequirements", Proc(GetBufferMemoryRequirements)},
+        {"vkGetBufferMemoryRequirements2", Proc(GetBufferMemoryRequirements2)},
+        {"vkGetBufferMemoryRequirements2KHR", Proc(GetBufferMemoryRequirements2)},
+        {"vkGetDeviceBufferMemoryRequirements", Proc(GetDeviceBufferMemoryRequirements)},
+        {"vkGetDeviceBufferMemoryRequirementsKHR", Proc(GetDeviceBufferMemoryRequirements)},
+        {"vkGetImageMemoryRequirements", Proc(GetImageMemoryRequirements)},
+        {"vkGetImageMemoryRequirements2", Proc(GetImageMemoryRequirements2)},
+        {"vkGetImageMemoryRequirements2KHR", Proc(GetImageMemoryRequirements2)},
+        {"vkGetDeviceImageMemoryRequirements", Proc(GetDeviceImageMemoryRequirements)},
+        {"vkGetDeviceImageMemoryRequirementsKHR", Proc(GetDeviceImageMemoryRequirements)},
+        {"vkGetImageSparseMemoryRequirements", Proc(GetImageSparseMemoryRequirements)},
+        {"vkGetImageSparseMemoryRequirements2", Proc(GetImageSparseMemoryRequirements2)},
+        {"vkGetImageSparseMemoryRequirements2KHR", Proc(GetImageSparseMemoryRequirements2)},
+        {"vkGetDeviceImageSparseMemoryRequirements", Proc(GetDeviceImageSparseMemoryRequirements)},
+        {"vkGetDeviceImageSparseMemoryRequirementsKHR", Proc(GetDeviceImageSparseMemoryRequirements)},
+        {"vkGetImageSubresourceLayout", Proc(GetImageSubresourceLayout)},
+        {"vkGetBufferDeviceAddress", Proc(GetBufferDeviceAddress)},
+        {"vkGetBufferDeviceAddressKHR", Proc(GetBufferDeviceAddress)},
+        {"vkGetBufferDeviceAddressEXT", Proc(GetBufferDeviceAddress)},
+        {"vkGetDescriptorSetLayoutSupport", Proc(GetDescriptorSetLayoutSupport)},
+        {"vkGetDescriptorSetLayoutSupportKHR", Proc(GetDescriptorSetLayoutSupport)},
+        {"vkGetRenderAreaGranularity", Proc(GetRenderAreaGranularity)},
+        {"vkGetEventStatus", Proc(GetEventStatus)},
+        {"vkCreateSemaphore", Proc(CreateSemaphore)},
+        {"vkDestroySemaphore", Proc(DestroySemaphore)},
+        {"vkSignalSemaphore", Proc(SignalSemaphore)},
+        {"vkSignalSemaphoreKHR", Proc(SignalSemaphore)},
+        {"vkGetSemaphoreCounterValue", Proc(GetSemaphoreCounterValue)},
+        {"vkGetSemaphoreCounterValueKHR", Proc(GetSemaphoreCounterValue)},
+        {"vkQueueSubmit", Proc(QueueSubmit)},
+        {"vkQueueSubmit2", Proc(QueueSubmit2)},
+        {"vkQueueSubmit2KHR", Proc(QueueSubmit2)},
+        {"vkCreateQueryPool", Proc(CreateQueryPool)},
+        {"vkDestroyQueryPool", Proc(DestroyQueryPool)},
+        {"vkGetQueryPoolResults", Proc(GetQueryPoolResults)},
+        {"vkCreatePrivateDataSlot", Proc(CreatePrivateDataSlot)},
+        {"vkCreatePrivateDataSlotEXT", Proc(CreatePrivateDataSlot)},
+        {"vkDestroyPrivateDataSlot", Proc(DestroyPrivateDataSlot)},
+        {"vkDestroyPrivateDataSlotEXT", Proc(DestroyPrivateDataSlot)},
+        {"vkSetPrivateData", Proc(SetPrivateData)},
+        {"vkSetPrivateDataEXT", Proc(SetPrivateData)},
+        {"vkGetPrivateData", Proc(GetPrivateData)},
+        {"vkGetPrivateDataEXT", Proc(GetPrivateData)},
+        {"vkGetDeviceGroupPeerMemoryFeatures", Proc(GetDeviceGroupPeerMemoryFeatures)},
+        {"vkGetDeviceGroupPeerMemoryFeaturesKHR", Proc(GetDeviceGroupPeerMemoryFeatures)},
+        {"vkGetDeviceMemoryCommitment", Proc(GetDeviceMemoryCommitment)},
+        {"vkGetPipelineCacheData", Proc(GetPipelineCacheData)},
+        {"vkCreateCommandPool", Proc(CreateCommandPool)},
+        {"vkDestroyCommandPool", Proc(DestroyCommandPool)},
+        {"vkAllocateCommandBuffers", Proc(AllocateCommandBuffers)},
+        {"vkFreeCommandBuffers", Proc(FreeCommandBuffers)},
+        {"vkAllocateDescriptorSets", Proc(AllocateDescriptorSets)},
+        {"vkCreateGraphicsPipelines", Proc(CreatePipelines)},
+        {"vkCreateComputePipelines", Proc(CreatePipelines)},
+        {"vkCreateRayTracingPipelinesNV", Proc(CreatePipelines)},
+        {"vkCreateRayTracingPipelinesKHR", Proc(CreateRayTracingPipelinesKHR)},
+        {"vkCreateShadersEXT", Proc(CreateShadersEXT)},
+        {"vkCreateBufferView", Proc(CreateObject<VkBufferView>)},
+        {"vkCreateImageView", Proc(CreateObject<VkImageView>)},
+        {"vkCreateShaderModule", Proc(CreateObject<VkShaderModule>)},
+        {"vkCreatePipelineCache", Proc(CreateObject<VkPipelineCache>)},
+        {"vkCreatePipelineLayout", Proc(CreateObject<VkPipelineLayout>)},
+        {"vkCreateSampler", Proc(CreateObject<VkSampler>)},
+        {"vkCreateSamplerYcbcrConversion", Proc(CreateObject<VkSamplerYcbcrConversion>)},
+        {"vkCreateSamplerYcbcrConversionKHR", Proc(CreateObject<VkSamplerYcbcrConversion>)},
+        {"vkCreateDescriptorSetLayout", Proc(CreateObject<VkDescriptorSetLayout>)},
+        {"vkCreateDescriptorPool", Proc(CreateObject<VkDescriptorPool>)},
+        {"vkCreateDescriptorUpdateTemplate", Proc(CreateObject<VkDescriptorUpdateTemplate>)},
+        {"vkCreateDescriptorUpdateTemplateKHR", Proc(CreateObject<VkDescriptorUpdateTemplate>)},
+        {"vkCreateFramebuffer", Proc(CreateObject<VkFramebuffer>)},
+        {"vkCreateRenderPass", Proc(CreateObject<VkRenderPass>)},
+        {"vkCreateRenderPass2", Proc(CreateObject<VkRenderPass>)},
+        {"vkCreateRenderPass2KHR", Proc(CreateObject<VkRenderPass>)},
+        {"vkCreateFence", Proc(CreateObject<VkFence>)},
+        {"vkCreateEvent", Proc(CreateObject<VkEvent>)},
+        {"vkCreateAccelerationStructureKHR", Proc(CreateObject<VkAccelerationStructureKHR>)},
+    };
+    return functions;
+}
+
+// Only the device commands of the tables are returned here, a catch-all would make the loader believe instance extensions
+// (debug utils, surfaces) are implemented by the driver
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance, const char *pName) {
+    for (const auto *functions : {&InstanceFunctions(), &DeviceFunctions()}) {
+        auto it = functions->find(pName);
+        if (it != functions->end()) {
+            return it->second;
+        }
+    }
+    return nullptr;
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice, const char *pName) {
+    const auto &functions = DeviceFunctions();
+    auto it = functions.find(pName);
+    if (it != functions.end()) {
+        return it->second;
+    }
+    // Surfaces and swapchains are left to the loader, the null device has nothing to present to
+    const std::string name(pName);
+    if (name.compare(0, 2, "vk") != 0 || name.find("Surface") != std::string::npos ||
+        name.find("Swapchain") != std::string::npos || name.find("Display") != std::string::npos) {
+        return nullptr;
+    }
+    return Proc(NullCommand);
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance, const char *pName) {
+    const auto &functions = InstanceFunctions();
+    auto it = functions.find(pName);
+    return it != functions.end() ? it->second : nullptr;
+}
+
+}  // namespace null_icd
+
+// Exported through VkICD_null.def and libVkICD_null.map
+extern "C" {
+
+VKAPI_ATTR VkResult VKAPI_CALL vk_icdNegotiateLoaderICDInterfaceVersion(uint32_t *pSupportedVersion) {
+    *pSupportedVersion = std::min<uint32_t>(*pSupportedVersion, 5);
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetInstanceProcAddr(VkInstance instance, const char *pName) {
+    return null_icd::GetInstanceProcAddr(instance, pName);
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetPhysicalDeviceProcAddr(VkInstance instance, const char *pName) {
+    return null_icd::GetPhysicalDeviceProcAddr(instance, pName);
+}
+
+}  // extern "C"
@@ -822,3 +822,41 @@ TEST_F(VkAmdBestPracticesLayerTest, ComputeWorkgroupSize) {
         make_pipeline_with_shader(pipe, compute_16_8_1.GetStageCreateInfo());
     }
 }
+
+TEST_F(VkAmdBestPracticesLayerTest, PipelineBoundFromTwoThreads) {
+    TEST_DESCRIPTION("Bind the same pipeline in the same frame from two threads, which is only compared at the frame boundary");
+
+    AddRequiredExtensions(VK_EXT_FRAME_BOUNDARY_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::frameBoundary);
+    RETURN_IF_SKIP(InitBestPracticesFramework(kEnableAMDValidation));
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitState();
+    pipe.CreateGraphicsPipeline();
+
+    vkt::CommandBuffer other_cb(m_device, m_commandPool);
+    std::thread thread([&]() {
+        other_cb.begin();
+        vk::CmdBindPipeline(other_cb.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+        other_cb.end();
+    });
+    thread.join();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    m_commandBuffer->end();
+
+    VkFrameBoundaryEXT frame_boundary = vku::InitStructHelper();
+    frame_boundary.flags = VK_FRAME_BOUNDARY_FRAME_END_BIT_EXT;
+    frame_boundary.frameID = 1;
+    const VkCommandBuffer command_buffers[] = {other_cb.handle(), m_commandBuffer->handle()};
+    VkSubmitInfo submit_info = vku::InitStructHelper(&frame_boundary);
+    submit_info.commandBufferCount = 2;
+    submit_info.pCommandBuffers = command_buffers;
+    m_errorMonitor->SetDesiredFailureMsg(kPerformanceWarningBit, "UNASSIGNED-BestPractices-Pipeline-SortAndBind");
+    vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->wait();
+}
@@ -501,6 +501,53 @@ TEST_F(VkArmBestPracticesLayerTest, SparseIndexBufferTest) {
     test_pipelines(sparse_ibo, sparse_indices.size(), true);
 }
 
+TEST_F(VkArmBestPracticesLayerTest, SparseIndexBufferRewrittenTest) {
+    TEST_DESCRIPTION("Test that the index buffer is checked again after the application rewrote its mapped memory.");
+
+    RETURN_IF_SKIP(InitBestPracticesFramework(kEnableArmValidation));
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    if (IsPlatformMockICD()) {
+        GTEST_SKIP() << "Test not supported by MockICD";
+    }
+
+    std::vector<uint16_t> sparse_indices(128);
+    std::generate(sparse_indices.begin(), sparse_indices.end(), [n = uint16_t(0)]() mutable { return ++n; });
+    sparse_indices[sparse_indices.size() - 1] = 0xFFFF;
+    std::vector<uint16_t> nonsparse_indices = sparse_indices;
+    nonsparse_indices[nonsparse_indices.size() - 1] = 0;
+
+    VkConstantBufferObj ibo(m_device, sparse_indices.size() * sizeof(uint16_t), sparse_indices.data(),
+                            VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitState();
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    vk::CmdBindIndexBuffer(m_commandBuffer->handle(), ibo.handle(), static_cast<VkDeviceSize>(0), VK_INDEX_TYPE_UINT16);
+
+    // the same indices drawn again are reported again
+    auto* mapped = static_cast<uint16_t*>(ibo.memory().map());
+    for (int i = 0; i < 2; i++) {
+        m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT,
+                                             "UNASSIGNED-BestPractices-vkCmdDrawIndexed-sparse-index-buffer");
+        vk::CmdDrawIndexed(m_commandBuffer->handle(), sparse_indices.size(), 0, 0, 0, 0);
+        m_errorMonitor->VerifyFound();
+    }
+
+    // writing the mapped memory is not seen by the layer, the new indices must not be reported
+    std::copy(nonsparse_indices.begin(), nonsparse_indices.end(), mapped);
+    vk::CmdDrawIndexed(m_commandBuffer->handle(), nonsparse_indices.size(), 0, 0, 0, 0);
+    ibo.memory().unmap();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
 TEST_F(VkArmBestPracticesLayerTest, PostTransformVertexCacheThrashingIndicesTest) {
     TEST_DESCRIPTION(
         "Test for appropriate warnings to be thrown when recording an indexed draw call where the indices thrash the "
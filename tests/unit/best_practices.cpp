@@ -524,6 +524,45 @@ TEST_F(VkBestPracticesLayerTest, SimultaneousUse) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkBestPracticesLayerTest, FrameSummary) {
+    TEST_DESCRIPTION("Test that validate_best_practices_frame_summary reports each message once per frame");
+
+    AddRequiredExtensions(VK_EXT_FRAME_BOUNDARY_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::frameBoundary);
+    const char *enables[] = {""};
+    const VkBool32 frame_summary = VK_TRUE;
+    const VkLayerSettingEXT settings[] = {
+        {OBJECT_LAYER_NAME, "enables", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, enables},
+        {OBJECT_LAYER_NAME, "validate_best_practices_frame_summary", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &frame_summary}};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+                                                               static_cast<uint32_t>(std::size(settings)), settings};
+    features_.pNext = &layer_settings_create_info;
+    RETURN_IF_SKIP(InitFramework(&features_));
+    RETURN_IF_SKIP(InitState());
+
+    // Two occurrences in the frame are only counted
+    VkCommandBufferBeginInfo cmd_begin_info = vku::InitStructHelper();
+    cmd_begin_info.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+    vkt::CommandBuffer other_cb(m_device, m_commandPool);
+    vk::BeginCommandBuffer(m_commandBuffer->handle(), &cmd_begin_info);
+    vk::BeginCommandBuffer(other_cb.handle(), &cmd_begin_info);
+    m_commandBuffer->end();
+    other_cb.end();
+
+    // And reported once at the end of the frame
+    m_errorMonitor->SetDesiredFailureMsg(kPerformanceWarningBit, "UNASSIGNED-BestPractices-vkBeginCommandBuffer-simultaneous-use");
+    m_errorMonitor->SetAllowedFailureMsg("UNASSIGNED-BestPractices-vkBeginCommandBuffer-one-time-submit");
+    VkFrameBoundaryEXT frame_boundary = vku::InitStructHelper();
+    frame_boundary.flags = VK_FRAME_BOUNDARY_FRAME_END_BIT_EXT;
+    frame_boundary.frameID = 1;
+    VkSubmitInfo submit_info = vku::InitStructHelper(&frame_boundary);
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->wait();
+}
+
 TEST_F(VkBestPracticesLayerTest, SmallAllocation) {
     TEST_DESCRIPTION("Test for small memory allocations");
 
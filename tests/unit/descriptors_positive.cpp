@@ -1164,4 +1164,92 @@ TEST_F(PositiveDescriptors, ShaderStageAll) {
     ds_layout_ci.bindingCount = 1;
     ds_layout_ci.pBindings = &dsl_binding;
     vkt::DescriptorSetLayout(*m_device, ds_layout_ci);
-}
\ No newline at end of file
+}
+TEST_F(PositiveDescriptors, CopyLargeArrayBinding) {
+    TEST_DESCRIPTION("Write and copy the last descriptors of arrays large enough to only allocate the pages that are written");
+
+    RETURN_IF_SKIP(Init());
+
+    constexpr uint32_t descriptor_count = 8192;
+    if (m_device->phy().limits_.maxPerStageDescriptorSampledImages < descriptor_count ||
+        m_device->phy().limits_.maxDescriptorSetSampledImages < descriptor_count) {
+        GTEST_SKIP() << "maxPerStageDescriptorSampledImages is too small";
+    }
+
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, VK_FORMAT_B8G8R8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT);
+    vkt::ImageView view = image.CreateView();
+
+    OneOffDescriptorSet src_set(m_device, {{0, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, descriptor_count, VK_SHADER_STAGE_ALL, nullptr}});
+    OneOffDescriptorSet dst_set(m_device, {{0, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, descriptor_count, VK_SHADER_STAGE_ALL, nullptr}});
+    src_set.WriteDescriptorImageInfo(0, view, VK_NULL_HANDLE, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+                                     VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, descriptor_count - 1);
+    src_set.UpdateDescriptorSets();
+
+    // Copies a written descriptor and an unwritten one, into a page of dst_set that was never written
+    VkCopyDescriptorSet copy_set = vku::InitStructHelper();
+    copy_set.srcSet = src_set.set_;
+    copy_set.srcBinding = 0;
+    copy_set.srcArrayElement = descriptor_count - 2;
+    copy_set.dstSet = dst_set.set_;
+    copy_set.dstBinding = 0;
+    copy_set.dstArrayElement = descriptor_count / 2;
+    copy_set.descriptorCount = 2;
+    vk::UpdateDescriptorSets(device(), 0, nullptr, 1, &copy_set);
+}
+
+TEST_F(PositiveDescriptors, UpdateTemplateRollOver) {
+    TEST_DESCRIPTION("Update template entries that roll over to the next binding, with packed and interleaved data");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    RETURN_IF_SKIP(Init());
+
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2, VK_SHADER_STAGE_ALL, nullptr},
+                                                     {1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 3, VK_SHADER_STAGE_ALL, nullptr},
+                                                     {2, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2, VK_SHADER_STAGE_ALL, nullptr},
+                                                 });
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+    struct Interleaved {
+        VkDescriptorBufferInfo info;
+        uint32_t padding;
+    };
+    struct Data {
+        VkDescriptorBufferInfo packed[4];
+        Interleaved interleaved[3];
+    } data;
+    for (auto &info : data.packed) {
+        info = {buffer.handle(), 0, VK_WHOLE_SIZE};
+    }
+    for (auto &element : data.interleaved) {
+        element.info = {buffer.handle(), 0, VK_WHOLE_SIZE};
+    }
+
+    VkDescriptorUpdateTemplateEntry entries[2] = {};
+    // binding 0 [0, 1] and binding 1 [0, 1]
+    entries[0].dstBinding = 0;
+    entries[0].dstArrayElement = 0;
+    entries[0].descriptorCount = 4;
+    entries[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    entries[0].offset = offsetof(Data, packed);
+    entries[0].stride = sizeof(VkDescriptorBufferInfo);
+    // binding 1 [2] and binding 2 [0, 1]
+    entries[1].dstBinding = 1;
+    entries[1].dstArrayElement = 2;
+    entries[1].descriptorCount = 3;
+    entries[1].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    entries[1].offset = offsetof(Data, interleaved);
+    entries[1].stride = sizeof(Interleaved);
+
+    VkDescriptorUpdateTemplateCreateInfo update_template_ci = vku::InitStructHelper();
+    update_template_ci.descriptorUpdateEntryCount = 2;
+    update_template_ci.pDescriptorUpdateEntries = entries;
+    update_template_ci.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    update_template_ci.descriptorSetLayout = descriptor_set.layout_.handle();
+    VkDescriptorUpdateTemplate update_template = VK_NULL_HANDLE;
+    vk::CreateDescriptorUpdateTemplate(device(), &update_template_ci, nullptr, &update_template);
+
+    vk::UpdateDescriptorSetWithTemplate(device(), descriptor_set.set_, update_template, &data);
+    vk::DestroyDescriptorUpdateTemplate(device(), update_template, nullptr);
+}
@@ -118,6 +118,54 @@ TEST_F(NegativeDynamicState, ViewportNotBound) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeDynamicState, ViewportNotBoundRepeatedDraw) {
+    TEST_DESCRIPTION("Draw twice with a required Viewport dynamic state not bound, the error is reported on both draws.");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitState();
+    pipe.AddDynamicState(VK_DYNAMIC_STATE_VIEWPORT);
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdDraw-None-07831");
+        vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+        m_errorMonitor->VerifyFound();
+    }
+}
+
+TEST_F(NegativeDynamicState, ViewportNotBoundBatchedDraw) {
+    TEST_DESCRIPTION("With batch_draw_validation, a batch that reported an error is validated again on the next draw.");
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "batch_draw_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitState();
+    pipe.AddDynamicState(VK_DYNAMIC_STATE_VIEWPORT);
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdDraw-None-07831");
+        vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+        m_errorMonitor->VerifyFound();
+    }
+}
+
 TEST_F(NegativeDynamicState, ScissorNotBound) {
     TEST_DESCRIPTION("Run a simple draw calls to validate failure when Scissor dynamic state is required but not correctly bound.");
     RETURN_IF_SKIP(Init());
@@ -1659,3 +1659,58 @@ TEST_F(NegativeHostImageCopy, ImageMemorySparseUnbound) {
     vk::CopyImageToImageEXT(*m_device, &copy_image_to_image);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(NegativeHostImageCopy, CopyManyRegionsBadLayout) {
+    TEST_DESCRIPTION("Copy tiles of one subresource in a single call, every region in the bad layout has to be reported");
+    constexpr uint32_t width = 32;
+    constexpr uint32_t height = 32;
+    constexpr uint32_t tile = 8;
+    VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    auto image_ci = VkImageObj::ImageCreateInfo2D(width, height, 2, 1, format,
+                                                  VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+    RETURN_IF_SKIP(InitHostImageCopyTest(image_ci));
+
+    VkImageLayout layout = VK_IMAGE_LAYOUT_GENERAL;
+    VkImageObj image(m_device);
+    image.Init(image_ci);
+    image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, layout);
+
+    std::vector<uint8_t> pixels(width * height * 4);
+    std::vector<VkMemoryToImageCopyEXT> regions;
+    for (uint32_t y = 0; y < height; y += tile) {
+        for (uint32_t x = 0; x < width; x += tile) {
+            VkMemoryToImageCopyEXT region = vku::InitStructHelper();
+            region.pHostPointer = pixels.data();
+            region.memoryRowLength = width;
+            region.memoryImageHeight = height;
+            region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+            region.imageOffset = {static_cast<int32_t>(x), static_cast<int32_t>(y), 0};
+            region.imageExtent = {tile, tile, 1};
+            regions.push_back(region);
+        }
+    }
+
+    VkCopyMemoryToImageInfoEXT copy_to_image = vku::InitStructHelper();
+    copy_to_image.dstImage = image;
+    copy_to_image.dstImageLayout = layout;
+    copy_to_image.regionCount = static_cast<uint32_t>(regions.size());
+    copy_to_image.pRegions = regions.data();
+    vk::CopyMemoryToImageEXT(*m_device, &copy_to_image);
+
+    // Same subresource in every region, a failing region must not let the following ones through
+    copy_to_image.dstImageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    for (size_t i = 0; i < regions.size(); ++i) {
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkCopyMemoryToImageInfoEXT-dstImageLayout-09059");
+    }
+    m_errorMonitor->SetUnexpectedError("VUID-VkCopyMemoryToImageInfoEXT-dstImageLayout-09060");
+    vk::CopyMemoryToImageEXT(*m_device, &copy_to_image);
+    m_errorMonitor->VerifyFound();
+
+    // A region of another mip level after clean ones is still checked
+    copy_to_image.dstImageLayout = layout;
+    regions.back().imageSubresource.mipLevel = 2;
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkCopyMemoryToImageInfoEXT-imageSubresource-07967");
+    m_errorMonitor->SetUnexpectedError("VUID-VkCopyMemoryToImageInfoEXT-imageSubresource-07970");
+    vk::CopyMemoryToImageEXT(*m_device, &copy_to_image);
+    m_errorMonitor->VerifyFound();
+}
@@ -248,6 +248,47 @@ TEST_F(NegativeMemory, MapMemory2) {
     vk::UnmapMemory2KHR(m_device->device(), &unmap_info);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(NegativeMemory, FlushManyMappedMemoryRanges) {
+    TEST_DESCRIPTION("Flush a batch of ranges where only some of them are invalid");
+    RETURN_IF_SKIP(Init());
+
+    const VkDeviceSize atom_size = m_device->phy().limits_.nonCoherentAtomSize;
+    if (atom_size < 4) {
+        GTEST_SKIP() << "nonCoherentAtomSize is too small to have an unaligned size";
+    }
+    constexpr uint32_t kRangeCount = 32;
+    VkMemoryAllocateInfo memory_info = vku::InitStructHelper();
+    memory_info.allocationSize = atom_size * kRangeCount * 2;
+    ASSERT_TRUE(m_device->phy().set_memory_type(vvl::kU32Max, &memory_info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
+    vkt::DeviceMemory mapped_memory(*m_device, memory_info);
+    vkt::DeviceMemory unmapped_memory(*m_device, memory_info);
+    void *data = nullptr;
+    ASSERT_EQ(VK_SUCCESS, vk::MapMemory(device(), mapped_memory.handle(), 0, VK_WHOLE_SIZE, 0, &data));
+
+    std::vector<VkMappedMemoryRange> ranges(kRangeCount + 1, vku::InitStruct<VkMappedMemoryRange>());
+    for (uint32_t i = 0; i < kRangeCount; ++i) {
+        ranges[i].memory = mapped_memory.handle();
+        ranges[i].offset = atom_size * 2 * i;
+        ranges[i].size = atom_size;
+    }
+    ranges[kRangeCount / 2].size = atom_size + 1;
+    ranges[kRangeCount].memory = unmapped_memory.handle();
+    ranges[kRangeCount].offset = 0;
+    ranges[kRangeCount].size = atom_size;
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkMappedMemoryRange-size-01390");
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkMappedMemoryRange-memory-00684");
+    vk::FlushMappedMemoryRanges(device(), static_cast<uint32_t>(ranges.size()), ranges.data());
+    m_errorMonitor->VerifyFound();
+
+    // Once they are all valid, the whole batch goes through the aligned path
+    ranges[kRangeCount / 2].size = atom_size;
+    ranges.pop_back();
+    vk::InvalidateMappedMemoryRanges(device(), static_cast<uint32_t>(ranges.size()), ranges.data());
+    vk::UnmapMemory(device(), mapped_memory.handle());
+}
+
 TEST_F(NegativeMemory, MapMemoryNullppData) {
     TEST_DESCRIPTION("vkMapMemory but ppData is null");
     RETURN_IF_SKIP(Init());
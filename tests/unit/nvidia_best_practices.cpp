@@ -970,6 +970,91 @@ TEST_F(VkNvidiaBestPracticesLayerTest, BindPipeline_ZcullDirection)
     m_commandBuffer->end();
 }
 
+TEST_F(VkNvidiaBestPracticesLayerTest, ZcullDirectionPartialLayerDiscard) {
+    TEST_DESCRIPTION("Discarding some layers of a layered depth attachment keeps the Z-cull history of the other layers");
+    SetTargetApiVersion(VK_API_VERSION_1_3);
+
+    RETURN_IF_SKIP(InitBestPracticesFramework(kEnableNVIDIAValidation));
+
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamic_rendering_features = vku::InitStructHelper();
+    VkPhysicalDeviceFeatures2 features2 = GetPhysicalDeviceFeatures2(dynamic_rendering_features);
+    if (!dynamic_rendering_features.dynamicRendering) {
+        GTEST_SKIP() << "This test requires dynamicRendering";
+    }
+    RETURN_IF_SKIP(InitState(nullptr, &features2));
+
+    VkFormat depth_format = VK_FORMAT_D32_SFLOAT;
+    VkPipelineRenderingCreateInfo pipeline_rendering_info = vku::InitStructHelper();
+    pipeline_rendering_info.depthAttachmentFormat = depth_format;
+
+    constexpr uint32_t kLayers = 8;
+    VkImageObj image(m_device);
+    image.Init(image.ImageCreateInfo2D(32, 32, 1, kLayers, depth_format, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT));
+    ASSERT_TRUE(image.initialized());
+
+    VkImageViewCreateInfo image_view_ci = vku::InitStructHelper();
+    image_view_ci.image = image.handle();
+    image_view_ci.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+    image_view_ci.format = depth_format;
+    image_view_ci.subresourceRange = {VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, 0, kLayers};
+    vkt::ImageView depth_image_view(*m_device, image_view_ci);
+
+    VkRenderingAttachmentInfo depth_attachment = vku::InitStructHelper();
+    depth_attachment.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+    depth_attachment.imageView = depth_image_view.handle();
+    depth_attachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+
+    VkRenderingInfo begin_rendering_info = vku::InitStructHelper();
+    begin_rendering_info.renderArea.extent = {32, 32};
+    begin_rendering_info.layerCount = kLayers;
+    begin_rendering_info.pDepthAttachment = &depth_attachment;
+
+    // Only the upper half of the layers is discarded
+    VkImageMemoryBarrier discard_barrier = vku::InitStructHelper();
+    discard_barrier.srcAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+    discard_barrier.dstAccessMask = VK_ACCESS_MEMORY_WRITE_BIT | VK_ACCESS_MEMORY_READ_BIT;
+    discard_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    discard_barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    discard_barrier.image = image.handle();
+    discard_barrier.subresourceRange = {VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, kLayers / 2, VK_REMAINING_ARRAY_LAYERS};
+
+    VkPipelineDepthStencilStateCreateInfo depth_stencil_state_ci = vku::InitStructHelper();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitState();
+    pipe.gp_ci_.pNext = &pipeline_rendering_info;
+    pipe.ds_ci_ = depth_stencil_state_ci;
+    pipe.AddDynamicState(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE);
+    pipe.AddDynamicState(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP);
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    auto cmd = m_commandBuffer->handle();
+
+    vk::CmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.Handle());
+    vk::CmdSetDepthTestEnable(cmd, VK_TRUE);
+
+    vk::CmdBeginRendering(cmd, &begin_rendering_info);
+    vk::CmdSetDepthCompareOp(cmd, VK_COMPARE_OP_LESS);
+    for (int i = 0; i < 60; ++i) vk::CmdDraw(cmd, 0, 0, 0, 0);
+    vk::CmdEndRendering(cmd);
+
+    vk::CmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr,
+                           1, &discard_barrier);
+
+    vk::CmdBeginRendering(cmd, &begin_rendering_info);
+    vk::CmdSetDepthCompareOp(cmd, VK_COMPARE_OP_GREATER);
+    for (int i = 0; i < 40; ++i) vk::CmdDraw(cmd, 0, 0, 0, 0);
+
+    // The lower half of the layers still has the LESS draws of the first scope
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT,
+                                         "UNASSIGNED-BestPractices-Zcull-LessGreaterRatio");
+    vk::CmdEndRendering(cmd);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
 TEST_F(VkNvidiaBestPracticesLayerTest, ClearColor_NotCompressed)
 {
     SetTargetApiVersion(VK_API_VERSION_1_3);
@@ -84,6 +84,28 @@ TEST_F(NegativeObjectLifetime, CmdBufferBufferDestroyed) {
     vk::FreeMemory(m_device->handle(), mem, NULL);
 }
 
+TEST_F(NegativeObjectLifetime, CmdBufferBufferDestroyedDeferredDestruction) {
+    TEST_DESCRIPTION("With deferred_state_destruction, destroying a buffer still invalidates the command buffers using it.");
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    const VkBool32 value = VK_TRUE;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "deferred_state_destruction", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    m_commandBuffer->begin();
+    vk::CmdFillBuffer(m_commandBuffer->handle(), buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+    m_commandBuffer->end();
+    buffer.destroy();
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkQueueSubmit-pCommandBuffers-00070");
+    m_default_queue->submit(*m_commandBuffer, false);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeObjectLifetime, CmdBarrierBufferDestroyed) {
     RETURN_IF_SKIP(Init());
 
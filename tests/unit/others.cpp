@@ -279,6 +279,16 @@ TEST_F(VkLayerTest, VuidCheckForHashCollisions) {
     ASSERT_TRUE(it == hashes.end());
 }
 
+TEST_F(VkLayerTest, VuidSpecTextSorted) {
+    TEST_DESCRIPTION("Ensure the VUID spec text table is sorted, the layer binary searches it");
+
+    const auto it = std::adjacent_find(std::begin(vuid_spec_text), std::end(vuid_spec_text),
+                                       [](const vuid_spec_text_pair &a, const vuid_spec_text_pair &b) {
+                                           return std::string_view(a.vuid) >= std::string_view(b.vuid);
+                                       });
+    ASSERT_TRUE(it == std::end(vuid_spec_text));
+}
+
 TEST_F(VkLayerTest, VuidHashStability) {
     TEST_DESCRIPTION("Ensure stability of VUID hashes clients rely on for filtering");
     ASSERT_TRUE(hash_util::VuidHash("VUID-VkRenderPassCreateInfo-pNext-01963") == 0xa19880e3);
@@ -1930,6 +1930,49 @@ TEST_F(NegativeRayTracing, AccelerationStructuresOverlappingMemory) {
 #endif
 }
 
+TEST_F(NegativeRayTracing, AccelerationStructuresOverlappingMemoryPartial) {
+    TEST_DESCRIPTION("Only the destination acceleration structures sharing memory are reported as overlapping.");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    AddRequiredFeature(vkt::Feature::rayQuery);
+    RETURN_IF_SKIP(InitFrameworkForRayTracingTest());
+    RETURN_IF_SKIP(InitState());
+
+    VkMemoryAllocateFlagsInfo alloc_flags = vku::InitStructHelper();
+    alloc_flags.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT_KHR;
+    VkMemoryAllocateInfo alloc_info = vku::InitStructHelper(&alloc_flags);
+    alloc_info.allocationSize = 8192;
+    vkt::DeviceMemory buffer_memory(*m_device, alloc_info);
+
+    VkBufferCreateInfo dst_blas_buffer_ci = vku::InitStructHelper();
+    dst_blas_buffer_ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    dst_blas_buffer_ci.size = 4096;
+    dst_blas_buffer_ci.usage = VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR |
+                               VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    // pInfos[0] and pInfos[2] share the first half of the memory, pInfos[1] uses the second half
+    const VkDeviceSize memory_offsets[] = {0, 4096, 0};
+    std::vector<vkt::as::BuildGeometryInfoKHR> build_infos;
+    for (VkDeviceSize memory_offset : memory_offsets) {
+        vkt::Buffer dst_blas_buffer;
+        dst_blas_buffer.init_no_mem(*m_device, dst_blas_buffer_ci);
+        vk::BindBufferMemory(m_device->device(), dst_blas_buffer.handle(), buffer_memory.handle(), memory_offset);
+
+        auto build_info = vkt::as::blueprint::BuildGeometryInfoSimpleOnDeviceBottomLevel(*m_device);
+        build_info.GetDstAS()->SetDeviceBuffer(std::move(dst_blas_buffer));
+        build_infos.emplace_back(std::move(build_info));
+    }
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702");
+    m_commandBuffer->begin();
+    vkt::as::BuildAccelerationStructuresKHR(m_commandBuffer->handle(), build_infos);
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeRayTracing, ObjInUseCmdBuildAccelerationStructureKHR) {
     TEST_DESCRIPTION("Validate acceleration structure building tracks the objects used.");
 
@@ -42,6 +42,24 @@ TEST_F(NegativeSampler, MirrorClampToEdgeNotEnabled12) {
     CreateSamplerTest(*this, &sampler_info, "VUID-VkSamplerCreateInfo-addressModeU-01079");
 }
 
+TEST_F(NegativeSampler, CreateInfoCacheRepeatedError) {
+    TEST_DESCRIPTION("With create_info_cache, a sampler create info that reported an error reports it again when reused.");
+
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "create_info_cache", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    VkSamplerCreateInfo sampler_info = SafeSaneSamplerCreateInfo();
+    sampler_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_MIRROR_CLAMP_TO_EDGE;
+    CreateSamplerTest(*this, &sampler_info, "VUID-VkSamplerCreateInfo-addressModeU-01079");
+    CreateSamplerTest(*this, &sampler_info, "VUID-VkSamplerCreateInfo-addressModeU-01079");
+}
+
 TEST_F(NegativeSampler, AnisotropyFeatureDisabled) {
     TEST_DESCRIPTION("Validation should check anisotropy parameters are correct with samplerAnisotropy disabled.");
 
@@ -737,6 +755,17 @@ TEST_F(NegativeSampler, CustomBorderColor) {
     vk::CreateDescriptorSetLayout(m_device->device(), &ds_layout_ci, NULL, &ds_layout);
     m_errorMonitor->VerifyFound();
 
+    // Repeated samplers are looked up once, but every element with a custom border color is still reported
+    vkt::Sampler default_sampler(*m_device, SafeSaneSamplerCreateInfo());
+    const VkSampler immutable_samplers[4] = {sampler.handle(), sampler.handle(), default_sampler.handle(), sampler.handle()};
+    dsl_binding.descriptorCount = 4;
+    dsl_binding.pImmutableSamplers = immutable_samplers;
+    for (uint32_t i = 0; i < 3; ++i) {
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkDescriptorSetLayoutBinding-pImmutableSamplers-04009");
+    }
+    vk::CreateDescriptorSetLayout(m_device->device(), &ds_layout_ci, NULL, &ds_layout);
+    m_errorMonitor->VerifyFound();
+
     VkPhysicalDeviceCustomBorderColorPropertiesEXT custom_properties = vku::InitStructHelper();
     auto prop2 = GetPhysicalDeviceProperties2(custom_properties);
 
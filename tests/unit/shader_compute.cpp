@@ -240,6 +240,47 @@ TEST_F(NegativeShaderCompute, WorkGroupSizeSpecConstant) {
     }
 }
 
+TEST_F(NegativeShaderCompute, WorkGroupSizeSpecConstantRepeated) {
+    TEST_DESCRIPTION("Specializations seen before are cached, make sure their workgroup size is still validated");
+
+    RETURN_IF_SKIP(Init());
+    const VkPhysicalDeviceLimits limits = m_device->phy().limits_;
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(local_size_x_id = 3) in;
+        void main(){}
+    )glsl";
+
+    VkSpecializationMapEntry entry;
+    entry.constantID = 3;
+    entry.offset = 0;
+    entry.size = sizeof(uint32_t);
+
+    uint32_t data = 1;
+
+    VkSpecializationInfo specialization_info = {};
+    specialization_info.mapEntryCount = 1;
+    specialization_info.pMapEntries = &entry;
+    specialization_info.dataSize = sizeof(uint32_t);
+    specialization_info.pData = &data;
+
+    const auto set_info = [&](CreateComputePipelineHelper &helper) {
+        helper.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0,
+                                                   SPV_SOURCE_GLSL, &specialization_info);
+    };
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit);
+
+    data = limits.maxComputeWorkGroupSize[0] + 1;  // Invalid
+    for (uint32_t i = 0; i < 2; ++i) {
+        m_errorMonitor->SetUnexpectedError("VUID-RuntimeSpirv-x-06432");
+        CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "VUID-RuntimeSpirv-x-06429");
+    }
+
+    data = 1;
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit);
+}
+
 TEST_F(NegativeShaderCompute, WorkGroupSizeConstantDefault) {
     TEST_DESCRIPTION("Make sure constant are applied for maxComputeWorkGroupSize using WorkgroupSize");
 
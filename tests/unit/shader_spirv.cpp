@@ -1607,6 +1607,36 @@ TEST_F(NegativeShaderSpirv, SpecializationSizeMismatch) {
     }
 }
 
+TEST_F(NegativeShaderSpirv, SpecializationSizeMismatchRepeated) {
+    TEST_DESCRIPTION("Specializations are cached, make sure one with a wrong map entry size is reported every time");
+
+    RETURN_IF_SKIP(Init());
+
+    const char *cs_src = R"glsl(
+        #version 450
+        layout (constant_id = 0) const int c = 3;
+        layout (local_size_x = 1) in;
+        void main() {
+            if (gl_GlobalInvocationID.x >= c) { return; }
+        }
+    )glsl";
+
+    VkSpecializationMapEntry entry = {0, 0, 2};  // int is 4 bytes
+    int32_t data = 0;
+    const VkSpecializationInfo specialization_info = {1, &entry, sizeof(data), &data};
+
+    const auto set_info = [&](CreateComputePipelineHelper &helper) {
+        helper.cs_ = std::make_unique<VkShaderObj>(this, cs_src, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_GLSL,
+                                                   &specialization_info);
+    };
+    for (uint32_t i = 0; i < 2; ++i) {
+        CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "VUID-VkSpecializationMapEntry-constantID-00776");
+    }
+
+    entry.size = sizeof(data);
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit);
+}
+
 TEST_F(NegativeShaderSpirv, DuplicatedSpecializationConstantID) {
     TEST_DESCRIPTION("Create a pipeline with non unique constantID in specialization pMapEntries.");
     RETURN_IF_SKIP(Init());
@@ -2019,6 +2049,58 @@ TEST_F(NegativeShaderSpirv, NoUniformBufferStandardLayout10) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeShaderSpirv, AsyncValidationReportedAtPipeline) {
+    TEST_DESCRIPTION("With async_shader_validation, the spirv-val error of a module is reported by the first pipeline using it");
+    SetTargetApiVersion(VK_API_VERSION_1_0);
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    const VkBool32 value = VK_TRUE;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "async_shader_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    if (DeviceValidationVersion() > VK_API_VERSION_1_0) {
+        GTEST_SKIP() << "Tests for 1.0 only";
+    }
+
+    // std430 uniform block without uniformBufferStandardLayout
+    const char *spv_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpDecorate %_arr_float_uint_8 ArrayStride 4
+               OpMemberDecorate %ubo430 0 Offset 0
+               OpDecorate %ubo430 Block
+               OpDecorate %_ DescriptorSet 0
+               OpDecorate %_ Binding 0
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+      %float = OpTypeFloat 32
+       %uint = OpTypeInt 32 0
+     %uint_8 = OpConstant %uint 8
+%_arr_float_uint_8 = OpTypeArray %float %uint_8
+     %ubo430 = OpTypeStruct %_arr_float_uint_8
+%_ptr_Uniform_ubo430 = OpTypePointer Uniform %ubo430
+          %_ = OpVariable %_ptr_Uniform_ubo430 Uniform
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturn
+               OpFunctionEnd
+        )";
+
+    // Nothing is reported when the module is created
+    VkShaderObj cs(this, spv_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_ASM);
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cp_ci_.stage = cs.GetStageCreateInfo();
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe.InitState();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkShaderModuleCreateInfo-pCode-08737");
+    pipe.CreateComputePipeline();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeShaderSpirv, NoUniformBufferStandardLayout12) {
     TEST_DESCRIPTION(
         "Don't enable uniformBufferStandardLayout in Vulkan1.2 when VK_KHR_uniform_buffer_standard_layout was promoted");
@@ -2379,3 +2379,49 @@ TEST_F(PositiveSyncObject, BarrierAccessSyncMicroMap) {
     vk::CmdPipelineBarrier2KHR(m_commandBuffer->handle(), &dependency_info);
     m_commandBuffer->end();
 }
+
+TEST_F(PositiveSyncObject, TimelineSemaphoreManyValues) {
+    TEST_DESCRIPTION("Wait on timeline values out of order, then chain many increasing signals and waits on one semaphore.");
+    AddRequiredExtensions(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::timelineSemaphore);
+    RETURN_IF_SKIP(Init());
+
+    VkSemaphoreTypeCreateInfo semaphore_type_create_info = vku::InitStructHelper();
+    semaphore_type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    VkSemaphoreCreateInfo semaphore_create_info = vku::InitStructHelper(&semaphore_type_create_info);
+    vkt::Semaphore semaphore(*m_device, semaphore_create_info);
+
+    uint64_t wait_value = 0;
+    uint64_t signal_value = 0;
+    VkTimelineSemaphoreSubmitInfo timeline_submit_info = vku::InitStructHelper();
+    timeline_submit_info.waitSemaphoreValueCount = 1;
+    timeline_submit_info.pWaitSemaphoreValues = &wait_value;
+    timeline_submit_info.pSignalSemaphoreValues = &signal_value;
+
+    const VkPipelineStageFlags stage_mask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    VkSubmitInfo submit_info = vku::InitStructHelper(&timeline_submit_info);
+    submit_info.waitSemaphoreCount = 1;
+    submit_info.pWaitSemaphores = &semaphore.handle();
+    submit_info.pWaitDstStageMask = &stage_mask;
+
+    // The waits are enqueued before the host signals their values, highest value first
+    for (wait_value = 3; wait_value > 0; --wait_value) {
+        vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+    }
+    VkSemaphoreSignalInfo signal_info = vku::InitStructHelper();
+    signal_info.semaphore = semaphore.handle();
+    for (signal_info.value = 1; signal_info.value <= 3; ++signal_info.value) {
+        vk::SignalSemaphoreKHR(m_device->device(), &signal_info);
+    }
+
+    // Each submission waits on the value signaled by the previous one
+    constexpr uint64_t kChainLength = 200;
+    timeline_submit_info.signalSemaphoreValueCount = 1;
+    submit_info.signalSemaphoreCount = 1;
+    submit_info.pSignalSemaphores = &semaphore.handle();
+    for (wait_value = 3; wait_value < 3 + kChainLength; ++wait_value) {
+        signal_value = wait_value + 1;
+        vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+    }
+    m_default_queue->wait();
+}
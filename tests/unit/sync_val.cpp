@@ -794,6 +794,45 @@ TEST_F(NegativeSyncVal, CopyOptimalImageHazards) {
     }
 }
 
+TEST_F(NegativeSyncVal, CopyOptimalImageAliasSubAllocated) {
+    TEST_DESCRIPTION("Aliasing images at the same offset of a memory also bound to other images share their accesses");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    auto image_ci = VkImageObj::ImageCreateInfo2D(128, 128, 1, 1, VK_FORMAT_R8G8B8A8_UNORM, usage);
+    image_ci.flags |= VK_IMAGE_CREATE_ALIAS_BIT;
+    VkImageObj image_src(m_device);
+    image_src.init_no_mem(*m_device, image_ci);
+    VkImageObj image_dst(m_device);
+    image_dst.init_no_mem(*m_device, image_ci);
+    VkImageObj image_dst_alias(m_device);
+    image_dst_alias.init_no_mem(*m_device, image_ci);
+
+    // image_src is bound first at the start of the memory, the aliasing pair after it
+    VkMemoryRequirements mem_reqs = image_src.memory_requirements();
+    const VkDeviceSize alias_offset = (mem_reqs.size + mem_reqs.alignment - 1) & ~(mem_reqs.alignment - 1);
+    mem_reqs.size = alias_offset * 2;
+    vkt::DeviceMemory memory(*m_device, vkt::DeviceMemory::get_resource_alloc_info(*m_device, mem_reqs, 0));
+    image_src.bind_memory(memory, 0);
+    image_dst.bind_memory(memory, alias_offset);
+    image_dst_alias.bind_memory(memory, alias_offset);
+
+    VkImageSubresourceLayers layers{VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    VkImageCopy region = {layers, {0, 0, 0}, layers, {0, 0, 0}, {128, 128, 1}};
+
+    m_commandBuffer->begin();
+    image_src.SetLayout(m_commandBuffer, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+    image_dst.SetLayout(m_commandBuffer, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+    vk::CmdCopyImage(*m_commandBuffer, image_src.handle(), VK_IMAGE_LAYOUT_GENERAL, image_dst.handle(), VK_IMAGE_LAYOUT_GENERAL, 1,
+                     &region);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-AFTER-WRITE");
+    vk::CmdCopyImage(*m_commandBuffer, image_src.handle(), VK_IMAGE_LAYOUT_GENERAL, image_dst_alias.handle(),
+                     VK_IMAGE_LAYOUT_GENERAL, 1, &region);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+}
+
 TEST_F(NegativeSyncVal, CopyOptimalImageHazardsSync2) {
     SetTargetApiVersion(VK_API_VERSION_1_2);
     AddRequiredExtensions(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
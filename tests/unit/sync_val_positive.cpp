@@ -873,3 +873,156 @@ TEST_F(PositiveSyncVal, QSBufferCopyHazardsDisabled) {
 
     test.DeviceWait();
 }
+
+TEST_F(PositiveSyncVal, ImageBarriersPerMipLevel) {
+    TEST_DESCRIPTION("Transition each mip level with its own barrier of a single pipeline barrier, given out of address order");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    constexpr uint32_t size = 64;
+    constexpr uint32_t mip_levels = 6;
+    constexpr uint32_t layers = 4;
+    constexpr VkDeviceSize level0_bytes = size * size * 4 * layers;
+    VkImageObj image(m_device);
+    image.InitNoLayout(VkImageObj::ImageCreateInfo2D(size, size, mip_levels, layers, VK_FORMAT_R8G8B8A8_UNORM,
+                                                     VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT));
+    vkt::Buffer buffer(*m_device, 2 * level0_bytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    std::vector<VkImageMemoryBarrier> to_dst(mip_levels, vku::InitStructHelper());
+    std::vector<VkImageMemoryBarrier> to_src(mip_levels, vku::InitStructHelper());
+    std::vector<VkBufferImageCopy> regions(mip_levels);
+    VkDeviceSize offset = 0;
+    for (uint32_t level = 0; level < mip_levels; ++level) {
+        VkImageMemoryBarrier &dst = to_dst[level];
+        dst.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        dst.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        dst.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        dst.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        dst.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        dst.image = image;
+        dst.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, level, 1, 0, layers};
+
+        // Highest level first, the barriers are not sorted by the application
+        VkImageMemoryBarrier &src = to_src[mip_levels - 1 - level];
+        src = dst;
+        src.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        src.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        src.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        src.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+        const uint32_t extent = size >> level;
+        regions[level].bufferOffset = offset;
+        regions[level].imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, level, 0, layers};
+        regions[level].imageExtent = {extent, extent, 1};
+        offset += extent * extent * 4 * layers;
+    }
+
+    // The copies to the image read the buffer, its later writes only need an execution dependency
+    VkBufferMemoryBarrier buffer_barrier = vku::InitStructHelper();
+    buffer_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buffer_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buffer_barrier.buffer = buffer;
+    buffer_barrier.size = VK_WHOLE_SIZE;
+    VkMemoryBarrier memory_barrier = vku::InitStructHelper();
+
+    m_commandBuffer->begin();
+    vk::CmdPipelineBarrier(*m_commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                           nullptr, mip_levels, to_dst.data());
+    for (uint32_t level = 0; level < mip_levels; ++level) {
+        VkBufferImageCopy region = regions[level];
+        region.bufferOffset = 0;
+        vk::CmdCopyBufferToImage(*m_commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    }
+    vk::CmdPipelineBarrier(*m_commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &memory_barrier,
+                           1, &buffer_barrier, mip_levels, to_src.data());
+    vk::CmdCopyImageToBuffer(*m_commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer, mip_levels, regions.data());
+    m_commandBuffer->end();
+}
+
+TEST_F(PositiveSyncVal, RenderPassSameAttachmentsInSeveralCommandBuffers) {
+    TEST_DESCRIPTION("Begin the same render pass and framebuffer in several command buffers, sharing their attachment ranges");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    vkt::CommandBuffer cb0(m_device, m_commandPool);
+    vkt::CommandBuffer cb1(m_device, m_commandPool);
+    for (vkt::CommandBuffer *cb : {m_commandBuffer, &cb0, &cb1}) {
+        cb->begin();
+        cb->BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdEndRenderPass(*cb);
+        cb->end();
+    }
+}
+
+TEST_F(PositiveSyncVal, EventSetWaitResetInOneCommandBuffer) {
+    TEST_DESCRIPTION("Set, wait and reset an event in one command buffer, its wait orders a write submitted before it");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    vkt::Buffer buffer_c(*m_device, 256, usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    vkt::Event event(*m_device);
+    const VkBufferCopy region = {0, 0, 256};
+
+    vkt::CommandBuffer cb_write(m_device, m_commandPool);
+    cb_write.begin();
+    vk::CmdCopyBuffer(cb_write, buffer_b, buffer_a, 1, &region);
+    cb_write.end();
+
+    VkBufferMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.buffer = buffer_a;
+    barrier.size = VK_WHOLE_SIZE;
+
+    m_commandBuffer->begin();
+    vk::CmdSetEvent(*m_commandBuffer, event, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    vk::CmdWaitEvents(*m_commandBuffer, 1, &event.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                      nullptr, 1, &barrier, 0, nullptr);
+    vk::CmdCopyBuffer(*m_commandBuffer, buffer_a, buffer_c, 1, &region);
+    vk::CmdResetEvent(*m_commandBuffer, event, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    m_commandBuffer->end();
+
+    // The write of buffer_a is only in the first scope of the event once both are submitted
+    const VkCommandBuffer command_buffers[2] = {cb_write, *m_commandBuffer};
+    VkSubmitInfo submit_info = vku::InitStructHelper();
+    submit_info.commandBufferCount = 2;
+    submit_info.pCommandBuffers = command_buffers;
+    vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+    m_default_queue->wait();
+}
+
+TEST_F(PositiveSyncVal, SubmitToQueueFamilyNotValidated) {
+    TEST_DESCRIPTION("Hazards between submissions to a queue family missing from validated_queue_families are not reported");
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    // No queue family has this index, so none of the queues is validated
+    const uint32_t validated_family = 1024;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "validated_queue_families", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1,
+                                       &validated_family};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    features_ = {VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT, &layer_settings_create_info, 1u, enables_, 4, disables_};
+    RETURN_IF_SKIP(InitFramework(&features_));
+    RETURN_IF_SKIP(InitState());
+
+    QSTestContext test(m_device, m_device->graphics_queues()[0]);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires a valid queue object.";
+    }
+
+    // The same write-after-read hazard as NegativeSyncVal.QSBufferCopyHazards
+    test.RecordCopy(test.cba, test.buffer_a, test.buffer_b);
+    test.RecordCopy(test.cbb, test.buffer_c, test.buffer_a);
+
+    VkSubmitInfo submit = vku::InitStructHelper();
+    submit.commandBufferCount = 2;
+    VkCommandBuffer two_cbs[2] = {test.h_cba, test.h_cbb};
+    submit.pCommandBuffers = two_cbs;
+    vk::QueueSubmit(test.q0, 1, &submit, VK_NULL_HANDLE);
+    test.DeviceWait();
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/vk_layer_utils.h"
+
+TEST(CustomContainer, ConcurrentMapShardCount) {
+    SetConcurrentMapShardCount(20);
+    vl_concurrent_unordered_map<uint64_t, uint32_t, kConcurrentMapSharded> map;
+    vl_concurrent_unordered_map<uint64_t, uint32_t> fixed_map;
+    vl_concurrent_unordered_map<uint64_t, uint32_t, 0> tiny_map;
+    SetConcurrentMapShardCount(0);
+
+    // Only the maps asking for it follow the setting
+    ASSERT_EQ(map.bucket_count(), 32u);
+    ASSERT_EQ(fixed_map.bucket_count(), 4u);
+    ASSERT_EQ(tiny_map.bucket_count(), 1u);
+    ASSERT_TRUE(map.empty());
+
+    // Sequential handles must not all pile up in a few buckets
+    for (uint64_t key = 1; key <= 32 * 64; ++key) {
+        map.insert(key, uint32_t(key));
+    }
+    ASSERT_FALSE(map.empty());
+    ASSERT_EQ(map.size(), 32u * 64u);
+    for (const auto &bucket : map.GetBucketStats()) {
+        ASSERT_GT(bucket.size, 32u);
+        ASSERT_LT(bucket.size, 128u);
+        ASSERT_EQ(bucket.contended_count, 0u);
+    }
+
+    ASSERT_EQ(map.find(7)->second, 7u);
+    ASSERT_EQ(map.pop(7)->second, 7u);
+    ASSERT_TRUE(map.find(7) == map.end());
+}
+
+TEST(CustomContainer, ConcurrentMapVisit) {
+    vl_concurrent_unordered_map<uint64_t, std::shared_ptr<uint64_t>> map;
+    for (uint64_t key = 1; key <= 100; ++key) {
+        map.insert(key, std::make_shared<uint64_t>(key));
+    }
+
+    uint64_t sum = 0;
+    map.for_each([&sum](const uint64_t &key, const std::shared_ptr<uint64_t> &value) {
+        ASSERT_EQ(key, *value);
+        // Visiting must not copy the shared_ptr
+        ASSERT_EQ(value.use_count(), 1);
+        sum += *value;
+    });
+    ASSERT_EQ(sum, 5050u);
+
+    uint32_t visited = 0;
+    ASSERT_TRUE(map.any_of([&visited](const uint64_t &, const std::shared_ptr<uint64_t> &) { return ++visited == 3; }));
+    ASSERT_EQ(visited, 3u);
+    ASSERT_FALSE(map.any_of([](const uint64_t &key, const std::shared_ptr<uint64_t> &) { return key > 100; }));
+}
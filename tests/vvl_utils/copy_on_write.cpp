@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/copy_on_write.h"
+
+#include <vector>
+
+TEST(CustomContainer, CopyOnWriteSharesUntilModified) {
+    vvl::CopyOnWrite<std::vector<int>> a;
+    ASSERT_TRUE(a->empty());
+
+    a.Mutable().push_back(1);
+    vvl::CopyOnWrite<std::vector<int>> b = a;
+    ASSERT_TRUE(a.SharesWith(b));
+    ASSERT_EQ(&*a, &*b);
+
+    // Writing through one copy detaches it and leaves the other untouched
+    b.Mutable().push_back(2);
+    ASSERT_FALSE(a.SharesWith(b));
+    ASSERT_EQ(a->size(), 1u);
+    ASSERT_EQ(b->size(), 2u);
+
+    // A unique holder is modified in place
+    const std::vector<int> *storage = &*b;
+    b.Mutable().push_back(3);
+    ASSERT_EQ(&*b, storage);
+}
+
+TEST(CustomContainer, CopyOnWriteCompareAndClear) {
+    vvl::CopyOnWrite<std::vector<int>> a;
+    vvl::CopyOnWrite<std::vector<int>> b;
+    ASSERT_TRUE(a == b);
+
+    a = std::vector<int>{1, 2};
+    b = std::vector<int>{1, 2};
+    ASSERT_FALSE(a.SharesWith(b));
+    ASSERT_TRUE(a == b);
+
+    vvl::CopyOnWrite<std::vector<int>> c = std::move(a);
+    ASSERT_TRUE(a->empty());
+    ASSERT_TRUE(c == b);
+
+    c.Clear();
+    ASSERT_TRUE(c->empty());
+    ASSERT_TRUE(c == a);
+    ASSERT_TRUE(b != c);
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/epoch_reclamation.h"
+
+#include <condition_variable>
+#include <thread>
+
+TEST(CustomContainer, EpochReclamationDefersWhileBorrowed) {
+    auto &domain = vvl::EpochDomain::Get();
+    auto object = std::make_shared<int>(42);
+    std::weak_ptr<int> observer = object;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool borrowed = false;
+    bool retired = false;
+
+    std::thread reader([&]() {
+        vvl::Borrowed<int> ptr(vvl::EpochGuard(), object.get());
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            borrowed = true;
+            cv.notify_all();
+            cv.wait(lock, [&]() { return retired; });
+        }
+        // Still safe to use, the reader entered before the object was retired
+        ASSERT_EQ(*ptr, 42);
+    });
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]() { return borrowed; });
+    }
+    domain.Retire(std::move(object));
+    domain.Reclaim();
+    ASSERT_FALSE(observer.expired());
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        retired = true;
+        cv.notify_all();
+    }
+    reader.join();
+
+    domain.Synchronize();
+    ASSERT_TRUE(observer.expired());
+}
+
+TEST(CustomContainer, EpochReclamationNestedGuard) {
+    auto &domain = vvl::EpochDomain::Get();
+    std::weak_ptr<int> observer;
+    {
+        vvl::EpochGuard outer;
+        vvl::EpochGuard inner;
+        auto object = std::make_shared<int>(7);
+        observer = object;
+        domain.Retire(std::move(object));
+        // Cannot wait for its own guard, so this must return with the object kept alive
+        domain.Synchronize();
+        ASSERT_FALSE(observer.expired());
+    }
+    domain.Synchronize();
+    ASSERT_TRUE(observer.expired());
+    ASSERT_EQ(domain.RetiredCount(), 0u);
+}
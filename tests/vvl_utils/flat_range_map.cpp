@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/range_vector.h"
+
+#include <random>
+
+namespace {
+using Range = sparse_container::range<uint64_t>;
+using TreeMap = sparse_container::range_map<uint64_t, uint32_t>;
+using FlatMap = sparse_container::flat_range_map<uint64_t, uint32_t>;
+
+template <typename Map>
+std::vector<std::pair<Range, uint32_t>> Contents(const Map &map) {
+    std::vector<std::pair<Range, uint32_t>> contents;
+    for (const auto &entry : map) {
+        contents.emplace_back(entry.first, entry.second);
+    }
+    return contents;
+}
+}  // namespace
+
+TEST(CustomContainer, FlatRangeMapIteratorsSurviveInsertion) {
+    FlatMap map;
+    map.insert(std::make_pair(Range(10, 20), 1u));
+    map.insert(std::make_pair(Range(30, 40), 2u));
+    auto it = map.find(35);
+    ASSERT_NE(it, map.end());
+
+    // Entries inserted in front shift the storage, the iterator must still refer to [30, 40)
+    map.insert(std::make_pair(Range(0, 5), 3u));
+    map.insert(std::make_pair(Range(20, 30), 4u));
+    ASSERT_EQ(it->first, Range(30, 40));
+    ASSERT_EQ(it->second, 2u);
+    ++it;
+    ASSERT_EQ(it, map.end());
+    --it;
+    ASSERT_EQ(it->first, Range(30, 40));
+}
+
+TEST(CustomContainer, FlatRangeMapMatchesTreeMap) {
+    TreeMap tree;
+    FlatMap flat;
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<uint64_t> index_dist(0, 256);
+    std::uniform_int_distribution<uint32_t> value_dist(0, 3);
+
+    for (int i = 0; i < 2000; ++i) {
+        uint64_t begin = index_dist(rng);
+        uint64_t end = index_dist(rng);
+        if (begin > end) std::swap(begin, end);
+        if (begin == end) continue;
+        const Range range(begin, end);
+        const uint32_t value = value_dist(rng);
+        switch (i % 4) {
+            case 0:
+                tree.overwrite_range(std::make_pair(range, value));
+                flat.overwrite_range(std::make_pair(range, value));
+                break;
+            case 1:
+                sparse_container::update_range_value(tree, range, value, sparse_container::value_precedence::prefer_dest);
+                sparse_container::update_range_value(flat, range, value, sparse_container::value_precedence::prefer_dest);
+                break;
+            case 2:
+                tree.erase_range(range);
+                flat.erase_range(range);
+                break;
+            default:
+                sparse_container::consolidate(tree);
+                sparse_container::consolidate(flat);
+                break;
+        }
+        ASSERT_EQ(Contents(tree), Contents(flat));
+    }
+
+    // splice walks both maps with cached lower bounds while inserting into the destination
+    FlatMap flat_to;
+    TreeMap tree_to;
+    flat_to.overwrite_range(std::make_pair(Range(64, 128), 7u));
+    tree_to.overwrite_range(std::make_pair(Range(64, 128), 7u));
+    sparse_container::splice(flat_to, flat, sparse_container::value_precedence::prefer_dest);
+    sparse_container::splice(tree_to, tree, sparse_container::value_precedence::prefer_dest);
+    ASSERT_EQ(Contents(tree_to), Contents(flat_to));
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/handle_translation_map.h"
+
+TEST(CustomContainer, HandleTranslationMapBasic) {
+    vvl::HandleTranslationMap<2> map;
+    ASSERT_TRUE(map.empty());
+    ASSERT_TRUE(map.find(1) == map.end());
+
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        map.insert_or_assign(i, i * 7);
+    }
+    ASSERT_EQ(map.size(), 1000u);
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        auto it = map.find(i);
+        ASSERT_TRUE(it != map.end());
+        ASSERT_EQ(it->second, i * 7);
+    }
+
+    map.insert_or_assign(5, 42);
+    ASSERT_EQ(map.find(5)->second, 42u);
+    ASSERT_EQ(map.size(), 1000u);
+
+    auto popped = map.pop(5);
+    ASSERT_TRUE(popped != map.end());
+    ASSERT_EQ(popped->second, 42u);
+    ASSERT_FALSE(map.contains(5));
+    ASSERT_TRUE(map.pop(5) == map.end());
+    ASSERT_EQ(map.erase(6), 1u);
+    ASSERT_EQ(map.erase(6), 0u);
+    ASSERT_EQ(map.size(), 998u);
+
+    const auto stats = map.GetStats();
+    ASSERT_EQ(stats.shard_count, 4u);
+    ASSERT_EQ(stats.size, 998u);
+    ASSERT_EQ(stats.tombstones, 2u);
+    ASSERT_GE(stats.capacity, stats.size);
+}
+
+TEST(CustomContainer, HandleTranslationMapInsert) {
+    vvl::HandleTranslationMap<0> map;
+    ASSERT_TRUE(map.insert(1, 10));
+    ASSERT_FALSE(map.insert(1, 20));
+    ASSERT_EQ(map.find(1)->second, 10u);
+    ASSERT_EQ(map.size(), 1u);
+
+    // A tombstone earlier in the probe sequence must not hide the existing key
+    for (uint64_t i = 2; i <= 40; ++i) {
+        ASSERT_TRUE(map.insert(i, i));
+    }
+    ASSERT_EQ(map.erase(2), 1u);
+    for (uint64_t i = 3; i <= 40; ++i) {
+        ASSERT_FALSE(map.insert(i, 0));
+        ASSERT_EQ(map.find(i)->second, i);
+    }
+    ASSERT_TRUE(map.insert(2, 2));
+    ASSERT_EQ(map.size(), 40u);
+}
+
+TEST(CustomContainer, HandleTranslationMapTag) {
+    vvl::HandleTranslationMap<0> map;
+    ASSERT_FALSE(map.set_tag(1, 5));
+    ASSERT_EQ(map.find_tag(1), 0u);
+
+    map.insert_or_assign(1, 10);
+    ASSERT_EQ(map.find_tag(1), 0u);
+    ASSERT_TRUE(map.set_tag(1, 5));
+    ASSERT_EQ(map.find_tag(1), 5u);
+    map.insert_or_assign(1, 11);
+    ASSERT_EQ(map.find_tag(1), 5u);
+
+    // Tags move with their key when the table grows, and don't carry over to a key that reuses a slot
+    for (uint64_t i = 2; i <= 1000; ++i) {
+        map.insert_or_assign(i, i);
+        ASSERT_TRUE(map.set_tag(i, i * 3));
+    }
+    ASSERT_GT(map.GetStats().rehashes, 1u);
+    ASSERT_EQ(map.find_tag(1), 5u);
+    for (uint64_t i = 2; i <= 1000; ++i) {
+        ASSERT_EQ(map.find_tag(i), i * 3);
+    }
+    ASSERT_EQ(map.erase(1), 1u);
+    ASSERT_EQ(map.find_tag(1), 0u);
+    map.insert_or_assign(1, 12);
+    ASSERT_EQ(map.find_tag(1), 0u);
+}
+
+TEST(CustomContainer, HandleTranslationMapEraseBatch) {
+    vvl::HandleTranslationMap<2> map;
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        map.insert_or_assign(i, i);
+    }
+    std::vector<uint64_t> keys;
+    for (uint64_t i = 1; i <= 1000; i += 2) {
+        keys.emplace_back(i);
+    }
+    keys.emplace_back(5000);  // not in the map
+    ASSERT_EQ(map.erase(keys), 500u);
+    ASSERT_EQ(map.size(), 500u);
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        ASSERT_EQ(map.contains(i), i % 2 == 0);
+    }
+}
+
+TEST(CustomContainer, HandleTranslationMapChurn) {
+    // Create/destroy churn must not grow the table, tombstones get reused or rehashed away
+    vvl::HandleTranslationMap<0> map;
+    for (uint64_t i = 1; i <= 100; ++i) {
+        map.insert_or_assign(i, i);
+    }
+    const size_t capacity = map.GetStats().capacity;
+    for (uint64_t round = 0; round < 100; ++round) {
+        for (uint64_t i = 0; i < 100; ++i) {
+            map.insert_or_assign(1000 + round * 100 + i, i);
+        }
+        for (uint64_t i = 0; i < 100; ++i) {
+            ASSERT_EQ(map.erase(1000 + round * 100 + i), 1u);
+        }
+    }
+    const auto stats = map.GetStats();
+    ASSERT_EQ(stats.size, 100u);
+    ASSERT_LE(stats.capacity, capacity * 2);
+    for (uint64_t i = 1; i <= 100; ++i) {
+        ASSERT_EQ(map.find(i)->second, i);
+    }
+}
+
+TEST(CustomContainer, HandleTranslationMapConcurrentReaders) {
+    vvl::HandleTranslationMap<2> map;
+    for (uint64_t i = 1; i <= 256; ++i) {
+        map.insert_or_assign(i, i + 1);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint32_t> failures{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&]() {
+            while (!stop.load()) {
+                for (uint64_t i = 1; i <= 256; ++i) {
+                    auto it = map.find(i);
+                    if (it == map.end() || it->second != i + 1) {
+                        failures++;
+                    }
+                }
+            }
+        });
+    }
+
+    // Force many rehashes while the stable keys are being read
+    for (uint64_t round = 0; round < 200; ++round) {
+        for (uint64_t i = 0; i < 512; ++i) {
+            map.insert_or_assign(100000 + round * 1000 + i, i);
+        }
+        for (uint64_t i = 0; i < 512; ++i) {
+            map.erase(100000 + round * 1000 + i);
+        }
+    }
+    stop = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    ASSERT_EQ(failures.load(), 0u);
+}
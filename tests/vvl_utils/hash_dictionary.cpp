@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/hash_util.h"
+
+#include <string>
+
+TEST(CustomContainer, DictionaryTrim) {
+    hash_util::Dictionary<std::string> dict;
+    auto first = dict.LookUp(std::string("first"));
+    auto second = dict.LookUp(std::string("second"));
+    ASSERT_EQ(dict.LookUp(std::string("first")), first);
+    ASSERT_EQ(dict.Trim(), 2u);
+
+    // Only the entries still referenced outside of the dictionary are kept
+    second.reset();
+    ASSERT_EQ(dict.Trim(), 1u);
+    ASSERT_EQ(dict.LookUp(std::string("first")), first);
+    first.reset();
+    ASSERT_EQ(dict.Trim(), 0u);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/layer_data_map.h"
+
+#include <thread>
+#include <vector>
+
+namespace {
+struct LayerData {
+    int value = 0;
+};
+
+void *Key(uintptr_t i) { return reinterpret_cast<void *>((i + 1) * 0x40); }
+}  // namespace
+
+TEST(CustomContainer, LayerDataMapReusesErasedSlots) {
+    vvl::LayerDataMap<LayerData, 8> map;
+    for (uintptr_t i = 0; i < 8; ++i) {
+        map.GetOrCreate(Key(i))->value = static_cast<int>(i);
+    }
+    // Past the table size, the rest goes to the overflow
+    map.GetOrCreate(Key(8))->value = 8;
+    for (uintptr_t i = 0; i < 9; ++i) {
+        ASSERT_NE(map.Find(Key(i)), nullptr);
+        ASSERT_EQ(map.Find(Key(i))->value, static_cast<int>(i));
+    }
+
+    map.Erase(Key(3));
+    map.Erase(Key(8));
+    ASSERT_EQ(map.Find(Key(3)), nullptr);
+    ASSERT_EQ(map.Find(Key(8)), nullptr);
+    map.GetOrCreate(Key(20))->value = 20;
+    ASSERT_EQ(map.Find(Key(20))->value, 20);
+    ASSERT_EQ(map.Find(Key(7))->value, 7);
+
+    LayerData *found = map.FindIf([](LayerData *data) { return data->value == 5; });
+    ASSERT_NE(found, nullptr);
+    ASSERT_EQ(found, map.Find(Key(5)));
+
+    for (uintptr_t i : {0, 1, 2, 4, 5, 6, 7, 20}) {
+        map.Erase(Key(i));
+    }
+    ASSERT_EQ(map.FindIf([](LayerData *) { return true; }), nullptr);
+}
+
+TEST(CustomContainer, LayerDataMapConcurrentDevices) {
+    vvl::LayerDataMap<LayerData> map;
+    constexpr uint32_t kThreads = 8;
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&map, t]() {
+            // Each thread creates, uses and destroys its own devices, as independent tenants of one process would
+            for (uint32_t round = 0; round < 100; ++round) {
+                void *key = Key(t * 1000 + round);
+                GetLayerDataPtr(key, map)->value = static_cast<int>(t);
+                for (uint32_t call = 0; call < 100; ++call) {
+                    ASSERT_EQ(GetLayerDataPtr(key, map)->value, static_cast<int>(t));
+                }
+                FreeLayerDataPtr(key, map);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(map.FindIf([](LayerData *) { return true; }), nullptr);
+}
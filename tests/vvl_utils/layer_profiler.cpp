@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/layer_profiler.h"
+
+#include <filesystem>
+#include <fstream>
+
+TEST(LayerProfiler, CollectSortsByTime) {
+    vvl::LayerProfiler profiler({"chassis", "core", "sync"});
+    profiler.Record(vvl::Func::vkCmdDraw, 1, vvl::ProfilePhase::Validate, 100);
+    profiler.Record(vvl::Func::vkCmdDraw, 1, vvl::ProfilePhase::Validate, 100);
+    profiler.Record(vvl::Func::vkCmdDraw, 2, vvl::ProfilePhase::PostRecord, 1000);
+    profiler.Record(vvl::Func::vkQueueSubmit, 0, vvl::ProfilePhase::Dispatch, 10);
+    // Out of range slots are dropped
+    profiler.Record(vvl::Func::vkQueueSubmit, 3, vvl::ProfilePhase::Validate, 10);
+
+    const auto lines = profiler.Collect();
+    ASSERT_EQ(lines.size(), 3u);
+    ASSERT_EQ(lines[0].func, vvl::Func::vkCmdDraw);
+    ASSERT_EQ(lines[0].object_slot, 2u);
+    ASSERT_EQ(lines[0].phase, vvl::ProfilePhase::PostRecord);
+    ASSERT_EQ(lines[1].calls, 2u);
+    ASSERT_EQ(lines[2].phase, vvl::ProfilePhase::Dispatch);
+    ASSERT_GE(lines[0].nanoseconds, lines[1].nanoseconds);
+    ASSERT_GE(lines[1].nanoseconds, lines[2].nanoseconds);
+
+    const std::string report = profiler.Report();
+    ASSERT_NE(report.find("vkCmdDraw"), std::string::npos);
+    ASSERT_NE(report.find("sync"), std::string::npos);
+
+    profiler.Reset();
+    ASSERT_TRUE(profiler.Collect().empty());
+}
+
+TEST(LayerProfiler, NullScopeIsNoop) {
+    vvl::LayerProfiler profiler({"chassis"});
+    {
+        vvl::ProfileScope scope(nullptr, vvl::Func::vkCmdDraw, 0, vvl::ProfilePhase::Validate);
+    }
+    {
+        vvl::ProfileScope scope(&profiler, vvl::Func::vkCmdDraw, 0, vvl::ProfilePhase::Dispatch);
+        scope.Stop();
+        scope.Stop();
+    }
+    const auto lines = profiler.Collect();
+    ASSERT_EQ(lines.size(), 1u);
+    ASSERT_EQ(lines[0].calls, 1u);
+}
+
+TEST(LayerProfiler, AppendCsv) {
+    const std::string path = (std::filesystem::temp_directory_path() / "vvl_layer_profiler_test.csv").string();
+    std::filesystem::remove(path);
+
+    vvl::LayerProfiler profiler({"chassis", "core"});
+    profiler.Record(vvl::Func::vkCmdDraw, 1, vvl::ProfilePhase::Validate, 100);
+    profiler.Record(vvl::Func::vkCmdDraw, 0, vvl::ProfilePhase::Dispatch, 10);
+    ASSERT_TRUE(profiler.AppendCsv(path, "device"));
+    ASSERT_TRUE(profiler.AppendCsv(path, "instance"));
+
+    std::ifstream file(path);
+    std::vector<std::string> rows;
+    for (std::string row; std::getline(file, row);) {
+        rows.push_back(row);
+    }
+    // A single header, then both appends
+    ASSERT_EQ(rows.size(), 5u);
+    ASSERT_EQ(rows[0], "scope,function,object,phase,calls,nanoseconds");
+    ASSERT_EQ(rows[1].rfind("device,vkCmdDraw,core,validate,1,", 0), 0u);
+    ASSERT_EQ(rows[2].rfind("device,vkCmdDraw,-,", 0), 0u);
+    ASSERT_EQ(rows[3].rfind("instance,", 0), 0u);
+    file.close();
+    std::filesystem::remove(path);
+}
+
+TEST(CheckProfiler, CollectSortsByTime) {
+    vvl::CheckProfiler profiler;
+    profiler.Record(vvl::ValidationCheck::RunSpirvValidation, 10);
+    profiler.Record(vvl::ValidationCheck::SyncDetectHazard, 1000);
+    profiler.Record(vvl::ValidationCheck::SyncDetectHazard, 1000);
+    {
+        vvl::CheckScope scope(nullptr, vvl::ValidationCheck::ValidateActionState);
+    }
+
+    const auto lines = profiler.Collect();
+    ASSERT_EQ(lines.size(), 2u);
+    ASSERT_EQ(lines[0].check, vvl::ValidationCheck::SyncDetectHazard);
+    ASSERT_EQ(lines[0].calls, 2u);
+    ASSERT_EQ(lines[1].check, vvl::ValidationCheck::RunSpirvValidation);
+    ASSERT_NE(profiler.Report().find("RunSpirvValidation"), std::string::npos);
+
+    profiler.Reset();
+    ASSERT_TRUE(profiler.Collect().empty());
+}
+
+TEST(CheckProfiler, ScopeRecordsIntoItsOwnProfiler) {
+    vvl::CheckProfiler first;
+    vvl::CheckProfiler second;
+    {
+        vvl::CheckScope scope(&first, vvl::ValidationCheck::SyncDetectHazard);
+    }
+    {
+        vvl::CheckScope scope(nullptr, vvl::ValidationCheck::SyncDetectHazard);
+    }
+    ASSERT_EQ(first.Collect().size(), 1u);
+    ASSERT_TRUE(second.Collect().empty());
+}
+
+static uint32_t FamilyBit(vvl::CheckFamily family) { return 1u << static_cast<uint32_t>(family); }
+
+TEST(ValidationBudget, ShedsAndSamplesTheMostExpensiveFamily) {
+    vvl::ValidationBudgetSettings settings;
+    settings.frame_budget_us = 1000;
+    settings.sample_period = 4;
+    vvl::ValidationBudget budget(settings);
+
+    // With 1 ns per tick, 1.25 ms of checks for a 1 ms budget
+    budget.Record(vvl::CheckFamily::SyncValidation, 900000);
+    budget.Record(vvl::CheckFamily::DescriptorValidation, 300000);
+    budget.Record(vvl::CheckFamily::ImageLayoutValidation, 50000);
+    auto frame = budget.EndFrame(1.0);
+    ASSERT_TRUE(frame.Changed());
+    ASSERT_EQ(frame.newly_shed_mask, FamilyBit(vvl::CheckFamily::SyncValidation));
+    ASSERT_NE(frame.Describe().find("Shedding sync validation"), std::string::npos);
+    ASSERT_TRUE(budget.IsShed(vvl::CheckFamily::SyncValidation));
+    ASSERT_FALSE(budget.IsShed(vvl::CheckFamily::DescriptorValidation));
+    ASSERT_FALSE(budget.IsShed(vvl::CheckFamily::Count));
+
+    // The shed family runs again on the 4th frame
+    for (uint32_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(budget.IsShed(vvl::CheckFamily::SyncValidation));
+        budget.Record(vvl::CheckFamily::DescriptorValidation, 300000);
+        ASSERT_FALSE(budget.EndFrame(1.0).Changed());
+    }
+    ASSERT_FALSE(budget.IsShed(vvl::CheckFamily::SyncValidation));
+
+    // Sampled but still too expensive, it stays shed
+    budget.Record(vvl::CheckFamily::SyncValidation, 900000);
+    budget.Record(vvl::CheckFamily::DescriptorValidation, 300000);
+    frame = budget.EndFrame(1.0);
+    ASSERT_FALSE(frame.Changed());
+    ASSERT_EQ(frame.shed_mask, FamilyBit(vvl::CheckFamily::SyncValidation));
+    ASSERT_TRUE(budget.IsShed(vvl::CheckFamily::SyncValidation));
+
+    // Sampled once it fits, it comes back
+    for (uint32_t i = 0; i < 3; ++i) {
+        ASSERT_FALSE(budget.EndFrame(1.0).Changed());
+    }
+    ASSERT_FALSE(budget.IsShed(vvl::CheckFamily::SyncValidation));
+    budget.Record(vvl::CheckFamily::SyncValidation, 100000);
+    budget.Record(vvl::CheckFamily::DescriptorValidation, 300000);
+    frame = budget.EndFrame(1.0);
+    ASSERT_EQ(frame.restored_mask, FamilyBit(vvl::CheckFamily::SyncValidation));
+    ASSERT_EQ(frame.shed_mask, 0u);
+    ASSERT_FALSE(budget.IsShed(vvl::CheckFamily::SyncValidation));
+
+    const std::string report = budget.Report();
+    ASSERT_NE(report.find("9 frames, 1 over budget"), std::string::npos);
+    ASSERT_EQ(report.find("Still shed"), std::string::npos);
+}
+
+TEST(ValidationBudget, ShedsUntilTheRestFits) {
+    vvl::ValidationBudgetSettings settings;
+    settings.frame_budget_us = 100;
+    vvl::ValidationBudget budget(settings);
+    budget.Record(vvl::CheckFamily::BestPractices, 80000);
+    budget.Record(vvl::CheckFamily::SyncValidation, 70000);
+    budget.Record(vvl::CheckFamily::DescriptorValidation, 40000);
+    const auto frame = budget.EndFrame(1.0);
+    ASSERT_EQ(frame.newly_shed_mask,
+              FamilyBit(vvl::CheckFamily::BestPractices) | FamilyBit(vvl::CheckFamily::SyncValidation));
+    ASSERT_FALSE(budget.IsShed(vvl::CheckFamily::DescriptorValidation));
+    ASSERT_NE(budget.Report().find("Still shed: sync validation, best practices"), std::string::npos);
+}
+
+TEST(ValidationBudget, CheckScopesCountTheirFamily) {
+    vvl::ValidationBudgetSettings settings;
+    settings.frame_budget_us = 1000000;
+    vvl::ValidationBudget budget(settings);
+    {
+        vvl::CheckScope outer(nullptr, vvl::ValidationCheck::SyncValidateQueueSubmit, &budget);
+        // Nested scopes of the family are part of the outer one
+        vvl::CheckScope inner(nullptr, vvl::ValidationCheck::SyncDetectHazard, &budget);
+        vvl::BudgetScope none(nullptr, vvl::CheckFamily::BestPractices);
+        vvl::CheckScope not_budgeted(nullptr, vvl::ValidationCheck::RunSpirvValidation, &budget);
+    }
+
+    const auto frame = budget.EndFrame(1.0);
+    ASSERT_EQ(frame.family_ns[static_cast<size_t>(vvl::CheckFamily::BestPractices)], 0.0);
+    ASSERT_EQ(frame.family_ns[static_cast<size_t>(vvl::CheckFamily::DescriptorValidation)], 0.0);
+    ASSERT_EQ(frame.family_ns[static_cast<size_t>(vvl::CheckFamily::ImageLayoutValidation)], 0.0);
+    ASSERT_FALSE(frame.Changed());
+    ASSERT_EQ(vvl::GetCheckFamily(vvl::ValidationCheck::DescriptorValidateBinding), vvl::CheckFamily::DescriptorValidation);
+    ASSERT_EQ(vvl::GetCheckFamily(vvl::ValidationCheck::ValidateActionState), vvl::CheckFamily::Count);
+}
@@ -0,0 +1,618 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "error_message/logging.h"
+#include "error_message/error_location.h"
+#include "utils/hash_util.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(Logging, LogMsgIsEnabled) {
+    debug_report_data debug_data;
+    debug_data.active_severities = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    debug_data.active_types = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    ASSERT_TRUE(LogMsgIsEnabled(&debug_data, kErrorBit, "VUID-Test-enabled"));
+    ASSERT_FALSE(LogMsgIsEnabled(&debug_data, kWarningBit, "VUID-Test-enabled"));
+
+    debug_data.filter_message_ids.insert(hash_util::VuidHash("VUID-Test-filtered"));
+    ASSERT_FALSE(LogMsgIsEnabled(&debug_data, kErrorBit, "VUID-Test-filtered"));
+
+    // Messages already reported duplicate_message_limit times are muted, and the check itself doesn't count
+    debug_data.duplicate_message_limit = 2;
+    const uint32_t message_id = hash_util::VuidHash("VUID-Test-enabled");
+    ASSERT_TRUE(debug_data.duplicate_message_counts.Increment(message_id, 2));
+    ASSERT_TRUE(LogMsgIsEnabled(&debug_data, kErrorBit, "VUID-Test-enabled"));
+    ASSERT_EQ(debug_data.duplicate_message_counts.Count(message_id), 1u);
+    ASSERT_TRUE(debug_data.duplicate_message_counts.Increment(message_id, 2));
+    ASSERT_FALSE(LogMsgIsEnabled(&debug_data, kErrorBit, "VUID-Test-enabled"));
+}
+
+TEST(Logging, MessageCounts) {
+    MessageCounts counts;
+    ASSERT_EQ(counts.Count(0), 0u);
+    ASSERT_TRUE(counts.Increment(0, 2));
+    ASSERT_TRUE(counts.Increment(0, 2));
+    ASSERT_FALSE(counts.Increment(0, 2));
+    ASSERT_EQ(counts.Count(0), 2u);
+
+    // More message ids than slots, all counted from many threads at once
+    constexpr uint32_t kMessageIds = 5000;
+    constexpr uint32_t kLimit = 3;
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < 4; t++) {
+        threads.emplace_back([&counts]() {
+            for (uint32_t i = 1; i <= kMessageIds; i++) {
+                for (uint32_t j = 0; j < kLimit; j++) {
+                    counts.Increment(i * 7919, kLimit);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (uint32_t i = 1; i <= kMessageIds; i++) {
+        ASSERT_EQ(counts.Count(i * 7919), kLimit);
+        ASSERT_FALSE(counts.Increment(i * 7919, kLimit));
+    }
+}
+
+static bool LogTestMessage(const debug_report_data &debug_data, VkFlags msg_flags, const char *vuid, const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    const bool result = LogMsg(&debug_data, msg_flags, LogObjectList(), nullptr, vuid, format, argptr);
+    va_end(argptr);
+    return result;
+}
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL CollectMessageIds(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                                        const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                        void *user_data) {
+    static_cast<std::vector<std::string> *>(user_data)->emplace_back(callback_data->pMessageIdName);
+    return VK_FALSE;
+}
+
+TEST(Logging, EnabledMessageFlags) {
+    debug_report_data debug_data;
+    ASSERT_FALSE(debug_data.IsMessageEnabled(kErrorBit));
+
+    std::vector<std::string> reported;
+    VkDebugUtilsMessengerCreateInfoEXT create_info = vku::InitStructHelper();
+    create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT;
+    create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    create_info.pfnUserCallback = CollectMessageIds;
+    create_info.pUserData = &reported;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    LayerCreateMessengerCallback(&debug_data, false, &create_info, &messenger);
+    ASSERT_TRUE(debug_data.IsMessageEnabled(kErrorBit));
+    ASSERT_TRUE(debug_data.IsMessageEnabled(kWarningBit));
+    // Performance warnings have the performance type, which no callback takes
+    ASSERT_FALSE(debug_data.IsMessageEnabled(kPerformanceWarningBit));
+    ASSERT_FALSE(debug_data.IsMessageEnabled(kInformationBit | kVerboseBit));
+    ASSERT_TRUE(debug_data.IsMessageEnabled(kInformationBit | kWarningBit));
+
+    const uint32_t muted = hash_util::VuidHash("VUID-Test-muted");
+    debug_data.filter_message_ids.insert(muted);
+    ASSERT_FALSE(debug_data.IsMessageEnabled(kErrorBit, muted));
+    ASSERT_TRUE(debug_data.IsMessageEnabled(kErrorBit, hash_util::VuidHash("VUID-Test-other")));
+}
+
+TEST(Logging, DeferredMessagesReportInOrder) {
+    std::vector<std::string> reported;
+    debug_report_data debug_data;
+    debug_data.duplicate_message_limit = 1;
+    VkDebugUtilsMessengerCreateInfoEXT create_info = vku::InitStructHelper();
+    create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    create_info.pfnUserCallback = CollectMessageIds;
+    create_info.pUserData = &reported;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    LayerCreateMessengerCallback(&debug_data, false, &create_info, &messenger);
+
+    // Logged from two threads, the second one first
+    DeferredMessages first;
+    DeferredMessages second;
+    std::thread thread([&]() {
+        DeferMessagesScope defer(second);
+        LogTestMessage(debug_data, kErrorBit, "VUID-Test-b", "%d", 1);
+        LogTestMessage(debug_data, kErrorBit, "VUID-Test-a", "%d", 2);
+    });
+    thread.join();
+    {
+        DeferMessagesScope defer(first);
+        ASSERT_FALSE(LogTestMessage(debug_data, kErrorBit, "VUID-Test-a", "%d", 3));
+    }
+    ASSERT_TRUE(reported.empty());
+    ASSERT_FALSE(second.empty());
+
+    // The duplicate limit applies in the order of Report(), so the second VUID-Test-a is the one muted
+    ASSERT_FALSE(first.Report());
+    ASSERT_FALSE(second.Report());
+    ASSERT_EQ(reported, (std::vector<std::string>{"VUID-Test-a", "VUID-Test-b"}));
+    ASSERT_TRUE(second.empty());
+
+    // Without a scope messages are reported right away
+    LogTestMessage(debug_data, kErrorBit, "VUID-Test-c", "%d", 4);
+    ASSERT_EQ(reported.size(), 3u);
+}
+
+TEST(Logging, DeferredMessagesForward) {
+    std::vector<std::string> reported;
+    debug_report_data debug_data;
+    VkDebugUtilsMessengerCreateInfoEXT create_info = vku::InitStructHelper();
+    create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    create_info.pfnUserCallback = CollectMessageIds;
+    create_info.pUserData = &reported;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    LayerCreateMessengerCallback(&debug_data, false, &create_info, &messenger);
+
+    // Nested in another scope, the messages join the outer ones
+    DeferredMessages outer;
+    {
+        DeferMessagesScope outer_defer(outer);
+        LogTestMessage(debug_data, kErrorBit, "VUID-Test-a", "%d", 1);
+        DeferredMessages inner;
+        {
+            DeferMessagesScope inner_defer(inner);
+            LogTestMessage(debug_data, kErrorBit, "VUID-Test-b", "%d", 2);
+        }
+        ASSERT_FALSE(inner.Forward());
+        ASSERT_TRUE(inner.empty());
+    }
+    ASSERT_TRUE(reported.empty());
+    outer.Report();
+    ASSERT_EQ(reported, (std::vector<std::string>{"VUID-Test-a", "VUID-Test-b"}));
+
+    // Without one, they are reported
+    DeferredMessages messages;
+    {
+        DeferMessagesScope defer(messages);
+        LogTestMessage(debug_data, kErrorBit, "VUID-Test-c", "%d", 3);
+    }
+    messages.Forward();
+    ASSERT_EQ(reported.size(), 3u);
+}
+
+TEST(Logging, ValidateAndCheckClean) {
+    std::vector<std::string> reported;
+    debug_report_data debug_data;
+    bool clean = false;
+
+    // No callback yet, nothing is reported but the checks aren't clean
+    ASSERT_FALSE(ValidateAndCheckClean(clean, [&]() { return LogTestMessage(debug_data, kErrorBit, "VUID-Test-a", "%d", 1); }));
+    ASSERT_FALSE(clean);
+    ASSERT_FALSE(ValidateAndCheckClean(clean, []() { return false; }));
+    ASSERT_TRUE(clean);
+
+    VkDebugUtilsMessengerCreateInfoEXT create_info = vku::InitStructHelper();
+    create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    create_info.pfnUserCallback = CollectMessageIds;
+    create_info.pUserData = &reported;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    LayerCreateMessengerCallback(&debug_data, false, &create_info, &messenger);
+
+    // The callback returns VK_FALSE, the check returning false doesn't mean it was clean
+    ASSERT_FALSE(ValidateAndCheckClean(clean, [&]() { return LogTestMessage(debug_data, kErrorBit, "VUID-Test-b", "%d", 2); }));
+    ASSERT_FALSE(clean);
+    ASSERT_EQ(reported, (std::vector<std::string>{"VUID-Test-b"}));
+
+    // A muted message in a nested scope still makes the outer one unclean
+    debug_data.filter_message_ids.insert(hash_util::VuidHash("VUID-Test-muted"));
+    ValidateAndCheckClean(clean, [&]() {
+        bool inner_clean = true;
+        ValidateAndCheckClean(inner_clean,
+                              [&]() { return LogTestMessage(debug_data, kErrorBit, "VUID-Test-muted", "%d", 3); });
+        return !inner_clean;
+    });
+    ASSERT_FALSE(clean);
+    ASSERT_EQ(reported.size(), 1u);
+}
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL BailOnMessages(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                                     const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data) {
+    static_cast<std::vector<std::string> *>(user_data)->emplace_back(callback_data->pMessageIdName);
+    return VK_TRUE;
+}
+
+TEST(Logging, DeferredMessagesSkip) {
+    std::vector<std::string> reported;
+    debug_report_data debug_data;
+    VkDebugUtilsMessengerCreateInfoEXT create_info = vku::InitStructHelper();
+    create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    create_info.pfnUserCallback = BailOnMessages;
+    create_info.pUserData = &reported;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    LayerCreateMessengerCallback(&debug_data, false, &create_info, &messenger);
+
+    ASSERT_TRUE(LogTestMessage(debug_data, kErrorBit, "VUID-Test-a", "%d", 1));
+
+    // Deferred, the callback hasn't run yet: the skip comes from reporting the messages
+    DeferredMessages messages;
+    {
+        DeferMessagesScope defer(messages);
+        ASSERT_FALSE(LogTestMessage(debug_data, kErrorBit, "VUID-Test-b", "%d", 2));
+    }
+    ASSERT_EQ(reported.size(), 1u);
+    ASSERT_TRUE(messages.Report());
+    ASSERT_EQ(reported, (std::vector<std::string>{"VUID-Test-a", "VUID-Test-b"}));
+
+    // Forwarded to an outer scope, it is the outer one reporting them that skips
+    DeferredMessages outer;
+    {
+        DeferMessagesScope outer_defer(outer);
+        DeferredMessages inner;
+        {
+            DeferMessagesScope inner_defer(inner);
+            LogTestMessage(debug_data, kErrorBit, "VUID-Test-c", "%d", 3);
+        }
+        ASSERT_FALSE(inner.Forward());
+    }
+    ASSERT_TRUE(outer.Report());
+
+    // Same as logging directly for ValidateAndCheckClean, even though the check saw false
+    bool clean = true;
+    bool check_skip = true;
+    ASSERT_TRUE(ValidateAndCheckClean(clean, [&]() {
+        check_skip = LogTestMessage(debug_data, kErrorBit, "VUID-Test-d", "%d", 4);
+        return check_skip;
+    }));
+    ASSERT_FALSE(check_skip);
+    ASSERT_FALSE(clean);
+    ASSERT_EQ(reported.size(), 4u);
+}
+
+struct DeliveredMessages {
+    std::vector<std::string> vuids;
+    std::vector<std::thread::id> threads;
+};
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL CollectDeliveries(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                                        const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                        void *user_data) {
+    auto *delivered = static_cast<DeliveredMessages *>(user_data);
+    delivered->vuids.emplace_back(callback_data->pMessageIdName);
+    delivered->threads.emplace_back(std::this_thread::get_id());
+    return VK_TRUE;
+}
+
+TEST(Logging, AsyncMessageDelivery) {
+    DeliveredMessages delivered;
+    debug_report_data debug_data;
+    StartAsyncMessageDelivery(&debug_data, false);
+    VkDebugUtilsMessengerCreateInfoEXT create_info = vku::InitStructHelper();
+    create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT;
+    create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    create_info.pfnUserCallback = CollectDeliveries;
+    create_info.pUserData = &delivered;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    LayerCreateMessengerCallback(&debug_data, false, &create_info, &messenger);
+
+    // Warnings are delivered by the layer thread, so the callback can't fail the call
+    ASSERT_FALSE(LogTestMessage(debug_data, kWarningBit, "VUID-Test-warning", "%d", 1));
+    FlushLogMessages(&debug_data);
+    ASSERT_EQ(delivered.vuids, (std::vector<std::string>{"VUID-Test-warning"}));
+    ASSERT_NE(delivered.threads[0], std::this_thread::get_id());
+
+    // Errors are still delivered right away
+    ASSERT_TRUE(LogTestMessage(debug_data, kErrorBit, "VUID-Test-error", "%d", 2));
+    ASSERT_EQ(delivered.vuids.size(), 2u);
+    ASSERT_EQ(delivered.threads[1], std::this_thread::get_id());
+
+    // Destroying the messenger delivers what is still queued for it
+    ASSERT_FALSE(LogTestMessage(debug_data, kWarningBit, "VUID-Test-last", "%d", 3));
+    LayerDestroyCallback(&debug_data, messenger);
+    ASSERT_EQ(delivered.vuids.size(), 3u);
+    ASSERT_EQ(delivered.vuids[2], "VUID-Test-last");
+}
+
+TEST(Logging, ObjectNameMap) {
+    ObjectNameMap names;
+    ASSERT_EQ(names.Get(0x1000), "");
+    names.Set(0x1000, "first");
+    names.Set(0x2000, "second");
+    ASSERT_EQ(names.Get(0x1000), "first");
+    names.Set(0x1000, "renamed");
+    ASSERT_EQ(names.Get(0x1000), "renamed");
+    names.Set(0x1000, nullptr);
+    ASSERT_EQ(names.Get(0x1000), "");
+
+    std::string out = "[";
+    ASSERT_TRUE(names.Append(0x2000, out));
+    ASSERT_FALSE(names.Append(0x1000, out));
+    ASSERT_EQ(out, "[second");
+}
+
+TEST(Logging, FormatHandle) {
+    debug_report_data debug_data;
+    ASSERT_EQ(debug_data.FormatHandle("VkBuffer", 0xabc0), "VkBuffer 0xabc0[]");
+
+    VkDebugMarkerObjectNameInfoEXT marker_name = vku::InitStructHelper();
+    marker_name.object = 0xabc0;
+    marker_name.pObjectName = "marker";
+    debug_data.DebugReportSetMarkerObjectName(&marker_name);
+    ASSERT_EQ(debug_data.FormatHandle("VkBuffer", 0xabc0), "VkBuffer 0xabc0[marker]");
+
+    // The debug utils name is preferred
+    VkDebugUtilsObjectNameInfoEXT utils_name = vku::InitStructHelper();
+    utils_name.objectType = VK_OBJECT_TYPE_BUFFER;
+    utils_name.objectHandle = 0xabc0;
+    utils_name.pObjectName = "utils";
+    debug_data.DebugReportSetUtilsObjectName(&utils_name);
+    ASSERT_EQ(debug_data.FormatHandle("VkBuffer", 0xabc0), "VkBuffer 0xabc0[utils]");
+    ASSERT_EQ(debug_data.FormatHandle("VkImage", UINT64_MAX), "VkImage 0xffffffffffffffff[]");
+}
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL CollectMessages(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                                     const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data) {
+    static_cast<std::vector<std::string> *>(user_data)->emplace_back(callback_data->pMessage);
+    return VK_FALSE;
+}
+
+static bool LogTestMessageAt(const debug_report_data &debug_data, const Location &loc, const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    const bool result = LogMsg(&debug_data, kErrorBit, LogObjectList(), &loc, "VUID-Test-location", format, argptr);
+    va_end(argptr);
+    return result;
+}
+
+TEST(Logging, MessageBuffer) {
+    std::vector<std::string> reported;
+    debug_report_data debug_data;
+    VkDebugUtilsMessengerCreateInfoEXT create_info = vku::InitStructHelper();
+    create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    create_info.pfnUserCallback = CollectMessages;
+    create_info.pUserData = &reported;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    LayerCreateMessengerCallback(&debug_data, false, &create_info, &messenger);
+
+    const Location loc(vvl::Func::vkCmdPipelineBarrier, vvl::Field::pImageMemoryBarriers, 2);
+    LogTestMessageAt(debug_data, loc.dot(vvl::Field::oldLayout), "is %d.", 7);
+    ASSERT_EQ(reported.size(), 1u);
+    const std::string expected = "vkCmdPipelineBarrier(): pImageMemoryBarriers[2].oldLayout is 7.";
+    ASSERT_EQ(reported[0].substr(reported[0].size() - expected.size()), expected);
+
+    // The reused buffer grows for messages longer than the first guess, and is cleared between messages
+    const std::string long_text(5000, 'x');
+    LogTestMessageAt(debug_data, loc, "%s", long_text.c_str());
+    LogTestMessageAt(debug_data, loc, "short");
+    ASSERT_EQ(reported.size(), 3u);
+    ASSERT_NE(reported[1].find("vkCmdPipelineBarrier(): pImageMemoryBarriers[2] " + long_text), std::string::npos);
+    ASSERT_EQ(reported[2].substr(reported[2].size() - 7), "] short");
+}
+
+TEST(Logging, BinaryMessageLog) {
+    const char *filename = "vvl_test_binary_log.bin";
+    debug_report_data debug_data;
+    debug_data.binary_log = BinaryMessageLog::Open(filename);
+    ASSERT_NE(debug_data.binary_log, nullptr);
+    debug_data.binary_log_severities = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    debug_data.binary_log_types = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+
+    const Location loc(vvl::Func::vkCmdPipelineBarrier, vvl::Field::pImageMemoryBarriers, 2);
+    LogTestMessageAt(debug_data, loc.dot(vvl::Field::oldLayout), "is %d.", 7);
+    // Not a severity of the binary log
+    LogTestMessage(debug_data, kWarningBit, "VUID-Test-warning", "%d", 1);
+    debug_data.binary_log.reset();
+
+    std::ifstream file(filename, std::ios::binary);
+    const std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(filename);
+
+    const std::string vuid = "VUID-Test-location";
+    const size_t record_size = sizeof(BinaryMessageLog::RecordHeader) + 3 * sizeof(BinaryMessageLog::LocationEntry) + 24;
+    ASSERT_EQ(data.size(), sizeof(BinaryMessageLog::FileHeader) + record_size);
+    BinaryMessageLog::FileHeader file_header;
+    std::memcpy(&file_header, data.data(), sizeof(file_header));
+    ASSERT_EQ(std::memcmp(file_header.magic, BinaryMessageLog::kMagic, sizeof(file_header.magic)), 0);
+    ASSERT_EQ(file_header.format_version, BinaryMessageLog::kFormatVersion);
+
+    BinaryMessageLog::RecordHeader header;
+    const char *record = data.data() + sizeof(file_header);
+    std::memcpy(&header, record, sizeof(header));
+    ASSERT_EQ(header.size, record_size);
+    ASSERT_EQ(header.msg_flags, kErrorBit);
+    ASSERT_EQ(header.vuid_hash, hash_util::VuidHash(vuid));
+    ASSERT_EQ(header.function, static_cast<uint16_t>(vvl::Func::vkCmdPipelineBarrier));
+    ASSERT_EQ(header.object_count, 0u);
+    ASSERT_EQ(header.location_count, 3u);
+    ASSERT_EQ(header.vuid_length, vuid.size());
+
+    // From the function down to the member
+    BinaryMessageLog::LocationEntry entries[3];
+    std::memcpy(entries, record + sizeof(header), sizeof(entries));
+    ASSERT_EQ(entries[0].field, static_cast<uint16_t>(vvl::Field::Empty));
+    ASSERT_EQ(entries[1].field, static_cast<uint16_t>(vvl::Field::pImageMemoryBarriers));
+    ASSERT_EQ(entries[1].index, 2u);
+    ASSERT_EQ(entries[2].field, static_cast<uint16_t>(vvl::Field::oldLayout));
+    ASSERT_EQ(std::string(record + sizeof(header) + sizeof(entries), vuid.size()), vuid);
+}
+
+struct ReportedLabels {
+    std::vector<std::string> queue_labels;
+    std::vector<std::string> cmd_buf_labels;
+};
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL CollectLabels(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                                    const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data) {
+    auto *reported = static_cast<ReportedLabels *>(user_data);
+    reported->queue_labels.clear();
+    reported->cmd_buf_labels.clear();
+    for (uint32_t i = 0; i < callback_data->queueLabelCount; i++) {
+        reported->queue_labels.emplace_back(callback_data->pQueueLabels[i].pLabelName);
+    }
+    for (uint32_t i = 0; i < callback_data->cmdBufLabelCount; i++) {
+        reported->cmd_buf_labels.emplace_back(callback_data->pCmdBufLabels[i].pLabelName);
+    }
+    return VK_FALSE;
+}
+
+static bool LogTestMessageAbout(const debug_report_data &debug_data, const LogObjectList &objects, const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    const bool result = LogMsg(&debug_data, kErrorBit, objects, nullptr, "VUID-Test-labels", format, argptr);
+    va_end(argptr);
+    return result;
+}
+
+TEST(Logging, DebugUtilsLabels) {
+    ReportedLabels reported;
+    debug_report_data debug_data;
+    VkDebugUtilsMessengerCreateInfoEXT create_info = vku::InitStructHelper();
+    create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    create_info.pfnUserCallback = CollectLabels;
+    create_info.pUserData = &reported;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    LayerCreateMessengerCallback(&debug_data, false, &create_info, &messenger);
+
+    VkDebugUtilsLabelEXT label = vku::InitStructHelper();
+    auto *queue = reinterpret_cast<VkQueue>(uintptr_t(0x1000));
+    auto *command_buffer = reinterpret_cast<VkCommandBuffer>(uintptr_t(0x2000));
+    LogObjectList objects(queue, command_buffer);
+
+    label.pLabelName = "frame";
+    BeginQueueDebugUtilsLabel(&debug_data, queue, &label);
+    auto label_state = std::make_shared<LoggingLabelState>();
+    RegisterCmdDebugUtilsLabel(&debug_data, command_buffer, label_state);
+    label.pLabelName = "pass";
+    label_state->Begin(&label);
+    label.pLabelName = "draw";
+    label_state->Insert(&label);
+
+    LogTestMessageAbout(debug_data, objects, "%s", "labels");
+    ASSERT_EQ(reported.queue_labels, (std::vector<std::string>{"frame"}));
+    // The most recent label comes first
+    ASSERT_EQ(reported.cmd_buf_labels, (std::vector<std::string>{"draw", "pass"}));
+
+    EndQueueDebugUtilsLabel(&debug_data, queue);
+    label_state->End();
+    LogTestMessageAbout(debug_data, objects, "%s", "labels");
+    ASSERT_TRUE(reported.queue_labels.empty());
+    ASSERT_TRUE(reported.cmd_buf_labels.empty());
+
+    // A stack that is not the registered one anymore is not erased
+    label_state->Begin(&label);
+    EraseCmdDebugUtilsLabel(&debug_data, command_buffer, nullptr);
+    LogTestMessageAbout(debug_data, objects, "%s", "labels");
+    ASSERT_EQ(reported.cmd_buf_labels.size(), 1u);
+    EraseCmdDebugUtilsLabel(&debug_data, command_buffer, label_state.get());
+    LogTestMessageAbout(debug_data, objects, "%s", "labels");
+    ASSERT_TRUE(reported.cmd_buf_labels.empty());
+}
+
+TEST(Logging, MessageAggregation) {
+    std::vector<std::string> reported;
+    debug_report_data debug_data;
+    debug_data.message_aggregation_window = 60 * 1000;
+    VkDebugUtilsMessengerCreateInfoEXT create_info = vku::InitStructHelper();
+    create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    create_info.pfnUserCallback = CollectMessages;
+    create_info.pUserData = &reported;
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    LayerCreateMessengerCallback(&debug_data, false, &create_info, &messenger);
+
+    const LogObjectList first(reinterpret_cast<VkQueue>(uintptr_t(0x1000)));
+    const LogObjectList second(reinterpret_cast<VkQueue>(uintptr_t(0x2000)));
+    for (int i = 0; i < 5; i++) {
+        LogTestMessageAbout(debug_data, first, "draw %d", i);
+    }
+    // The same VUID about other objects is another message
+    LogTestMessageAbout(debug_data, second, "draw %d", 0);
+    ASSERT_EQ(reported.size(), 2u);
+    ASSERT_NE(reported[0].find("draw 0"), std::string::npos);
+
+    ReportAggregatedMessages(&debug_data);
+    ASSERT_EQ(reported.size(), 3u);
+    ASSERT_NE(reported[2].find("4 identical messages were aggregated since the last report"), std::string::npos);
+    // Reporting the counts starts new windows
+    LogTestMessageAbout(debug_data, first, "draw %d", 5);
+    ASSERT_EQ(reported.size(), 4u);
+
+    // Once the window is over, the count comes with the next report of the message
+    debug_data.message_aggregation_window = 20;
+    LogTestMessageAbout(debug_data, second, "draw %d", 1);
+    LogTestMessageAbout(debug_data, second, "draw %d", 2);
+    ASSERT_EQ(reported.size(), 5u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    LogTestMessageAbout(debug_data, second, "draw %d", 3);
+    ASSERT_EQ(reported.size(), 6u);
+    ASSERT_NE(reported[5].find("draw 3 [1 identical message was aggregated since the last report]"), std::string::npos);
+}
+
+// The messages kept in a ring written by MessageRing, oldest first
+static std::vector<std::string> ReadMessageRing(const char *filename) {
+    std::ifstream file(filename, std::ios::binary);
+    const std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    MessageRing::Header header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    const char *ring = data.data() + sizeof(header);
+    std::string kept;
+    if (header.written <= header.capacity) {
+        kept.assign(ring, header.written);
+    } else {
+        const size_t position = header.written % header.capacity;
+        kept.assign(ring + position, header.capacity - position);
+        kept.append(ring, position);
+    }
+    // Each message is preceded by a null byte, what comes before the first one was partly overwritten
+    std::vector<std::string> messages;
+    for (size_t start = kept.find('\0'); start != std::string::npos;) {
+        const size_t end = kept.find('\0', start + 1);
+        messages.emplace_back(kept.substr(start + 1, end == std::string::npos ? std::string::npos : end - start - 1));
+        start = end;
+    }
+    return messages;
+}
+
+TEST(Logging, MessageRing) {
+    const char *filename = "vvl_test_message_ring.ring";
+    auto ring = MessageRing::Open(filename, 64);
+    ASSERT_NE(ring, nullptr);
+
+    ring->Write("first");
+    ring->Write("second");
+    ASSERT_EQ(ReadMessageRing(filename), (std::vector<std::string>{"first", "second"}));
+
+    // The file holds the last messages while it is still open, the oldest are overwritten
+    for (int i = 0; i < 20; i++) {
+        ring->Write("message " + std::to_string(i));
+    }
+    auto messages = ReadMessageRing(filename);
+    ASSERT_FALSE(messages.empty());
+    ASSERT_LT(messages.size(), 20u);
+    ASSERT_EQ(messages.back(), "message 19");
+    ASSERT_EQ(messages[messages.size() - 2], "message 18");
+
+    // Only the end of a message longer than the ring is kept
+    ring->Write(std::string(100, 'x') + "end");
+    messages = ReadMessageRing(filename);
+    ASSERT_EQ(messages.size(), 1u);
+    ASSERT_EQ(messages[0], std::string(60, 'x') + "end");
+
+    ring.reset();
+    std::remove(filename);
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/memory_footprint.h"
+
+#include <map>
+
+TEST(MemoryFootprint, MergesAndSortsEntries) {
+    vvl::MemoryFootprint footprint;
+    ASSERT_TRUE(footprint.Empty());
+
+    std::vector<uint64_t> small(4);
+    small.reserve(16);
+    std::map<int, int> nodes{{1, 1}, {2, 2}, {3, 3}};
+    footprint.AddVector("vector", small);
+    footprint.AddNodes("map", nodes);
+    // Same name is accumulated into the existing entry
+    footprint.AddVector("vector", small);
+    footprint.Add("big", 1, 1 << 20);
+
+    const auto &entries = footprint.Entries();
+    ASSERT_EQ(entries.size(), 3u);
+    ASSERT_EQ(entries[0].name, "vector");
+    ASSERT_EQ(entries[0].count, 8u);
+    ASSERT_EQ(entries[0].bytes, 2 * small.capacity() * sizeof(uint64_t));
+    ASSERT_EQ(entries[1].bytes, vvl::MemoryFootprint::NodeBytes<decltype(nodes)::value_type>(3));
+    ASSERT_EQ(footprint.TotalBytes(), entries[0].bytes + entries[1].bytes + entries[2].bytes);
+
+    const std::string report = footprint.Report("Test");
+    ASSERT_NE(report.find("Test memory footprint"), std::string::npos);
+    // Largest first
+    ASSERT_LT(report.find("big"), report.find("vector"));
+}
+
+TEST(MemoryFootprint, TriggerInterval) {
+    vvl::MemoryReportTrigger on_demand(0);
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_FALSE(on_demand.CountSubmit());
+    }
+
+    vvl::MemoryReportTrigger every_third(3);
+    uint32_t reports = 0;
+    for (int i = 0; i < 9; ++i) {
+        reports += every_third.CountSubmit() ? 1 : 0;
+    }
+    ASSERT_EQ(reports, 3u);
+}
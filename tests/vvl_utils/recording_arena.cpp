@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/recording_arena.h"
+
+#include <memory>
+
+TEST(CustomContainer, RecordedFunctionsReset) {
+    vvl::RecordingArena arena;
+    vvl::RecordingArena other_arena;
+    auto shared = std::make_shared<int>(5);
+    {
+        vvl::RecordedFunctions<bool(int &)> functions(arena);
+        vvl::RecordedFunctions<bool(int &)> other(other_arena);
+        const int increment = 3;
+        functions.emplace_back([increment](int &value) {
+            value += increment;
+            return false;
+        });
+        functions.emplace_back([shared](int &value) {
+            value *= *shared;
+            return true;
+        });
+        ASSERT_EQ(functions.size(), 2u);
+        ASSERT_EQ(shared.use_count(), 2);
+
+        int value = 1;
+        bool result = false;
+        for (const auto &function : functions) {
+            result |= function(value);
+        }
+        ASSERT_TRUE(result);
+        ASSERT_EQ(value, 20);
+
+        // Copies into another arena outlive the originals
+        for (const auto &function : functions) {
+            other.push_back(function);
+        }
+        ASSERT_EQ(shared.use_count(), 3);
+        functions.clear();
+        arena.Reset();
+        ASSERT_EQ(shared.use_count(), 2);
+        value = 0;
+        for (const auto &function : other) {
+            function(value);
+        }
+        ASSERT_EQ(value, 15);
+    }
+    ASSERT_EQ(shared.use_count(), 1);
+
+    // Blocks are kept over a reset, except past the retained limit
+    const size_t reserved = arena.ReservedBytes();
+    ASSERT_EQ(reserved, vvl::RecordingArena::kDefaultBlockSize);
+    arena.Allocate(vvl::RecordingArena::kMaxRetainedBytes, 8);
+    arena.Reset();
+    ASSERT_EQ(arena.ReservedBytes(), reserved);
+}
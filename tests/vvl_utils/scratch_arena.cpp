@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/scratch_arena.h"
+
+namespace {
+struct Counted {
+    Counted() { alive++; }
+    ~Counted() { alive--; }
+    static inline int alive = 0;
+    uint64_t payload[4];
+};
+}  // namespace
+
+TEST(CustomContainer, ScratchArenaRewind) {
+    void *first = nullptr;
+    {
+        vvl::ScratchArena::Scope scratch;
+        Counted *array = scratch.NewArray<Counted>(16);
+        ASSERT_EQ(Counted::alive, 16);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(array) % alignof(Counted), 0u);
+        first = array;
+        {
+            vvl::ScratchArena::Scope nested;
+            ASSERT_NE(static_cast<void *>(nested.NewArray<uint32_t>(8)), first);
+        }
+        scratch.DeleteArray(array, 16);
+        ASSERT_EQ(Counted::alive, 0);
+    }
+
+    // Memory is reused once the scope is gone, and large requests get their own retained block
+    const size_t reserved = vvl::ScratchArena::Get().ReservedBytes();
+    {
+        vvl::ScratchArena::Scope scratch;
+        ASSERT_EQ(static_cast<void *>(scratch.NewArray<Counted>(16)), first);
+        scratch.NewArray<uint8_t>(vvl::ScratchArena::kDefaultBlockSize * 2);
+    }
+    ASSERT_GT(vvl::ScratchArena::Get().ReservedBytes(), reserved);
+    const size_t warm = vvl::ScratchArena::Get().ReservedBytes();
+    {
+        vvl::ScratchArena::Scope scratch;
+        scratch.NewArray<uint8_t>(vvl::ScratchArena::kDefaultBlockSize * 2);
+    }
+    ASSERT_EQ(vvl::ScratchArena::Get().ReservedBytes(), warm);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/shader_cache.h"
+
+#include <filesystem>
+
+static std::string CachePath(const char *name) {
+    return (std::filesystem::temp_directory_path() / (std::string("vvl_shader_cache_test_") + name + ".bin")).string();
+}
+
+TEST(ShaderCache, PersistsAcrossOpens) {
+    const std::string path = CachePath("persist");
+    std::filesystem::remove(path);
+    const std::vector<uint32_t> code_a{1, 2, 3};
+    const std::vector<uint32_t> code_b{4, 5};
+    {
+        vvl::ShaderCache cache;
+        ASSERT_TRUE(cache.Open(path, "v1"));
+        ASSERT_EQ(cache.Find(1), nullptr);
+        cache.Add(1, 10, code_a);
+        cache.Add(2, 20, code_b);
+        // The first code added for a key is kept
+        cache.Add(1, 30, code_b);
+        ASSERT_EQ(cache.Find(1)->code, code_a);
+    }
+    {
+        vvl::ShaderCache cache;
+        ASSERT_TRUE(cache.Open(path, "v1"));
+        ASSERT_EQ(cache.IndexedCount(), 2u);
+        auto shader = cache.Find(2);
+        ASSERT_NE(shader, nullptr);
+        ASSERT_EQ(shader->shader_id, 20u);
+        ASSERT_EQ(shader->code, code_b);
+        ASSERT_EQ(cache.Find(1)->code, code_a);
+    }
+    {
+        // Another version starts over
+        vvl::ShaderCache cache;
+        ASSERT_TRUE(cache.Open(path, "v2"));
+        ASSERT_EQ(cache.IndexedCount(), 0u);
+        ASSERT_EQ(cache.Find(1), nullptr);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(ShaderCache, DropsTornRecord) {
+    const std::string path = CachePath("torn");
+    std::filesystem::remove(path);
+    {
+        vvl::ShaderCache cache;
+        ASSERT_TRUE(cache.Open(path, "v1"));
+        cache.Add(1, 10, {1, 2, 3});
+        cache.Add(2, 20, {4, 5, 6});
+    }
+    // Cut the last record in half, as a crash during the write would
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 2 * sizeof(uint32_t));
+    {
+        vvl::ShaderCache cache;
+        ASSERT_TRUE(cache.Open(path, "v1"));
+        ASSERT_EQ(cache.IndexedCount(), 1u);
+        ASSERT_NE(cache.Find(1), nullptr);
+        ASSERT_EQ(cache.Find(2), nullptr);
+        cache.Add(3, 30, {7});
+    }
+    {
+        vvl::ShaderCache cache;
+        ASSERT_TRUE(cache.Open(path, "v1"));
+        ASSERT_EQ(cache.IndexedCount(), 2u);
+        ASSERT_EQ(cache.Find(3)->code, std::vector<uint32_t>{7});
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(ShaderCache, InMemoryWithoutFile) {
+    vvl::ShaderCache cache;
+    cache.Add(5, 50, {9, 9});
+    auto shader = cache.Find(5);
+    ASSERT_NE(shader, nullptr);
+    ASSERT_EQ(shader->shader_id, 50u);
+    size_t resident = 0;
+    cache.ForEachResident([&](uint64_t, const vvl::ShaderCache::Shader &) { resident++; });
+    ASSERT_EQ(resident, 1u);
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "containers/slab_pool.h"
+
+TEST(CustomContainer, SlabPoolReuse) {
+    struct Payload {
+        explicit Payload(uint64_t v) : value(v) {}
+        uint64_t value;
+        uint64_t padding[7];
+    };
+    auto pool = std::make_shared<vvl::SlabPool>("Payload");
+
+    std::vector<std::shared_ptr<Payload>> objects;
+    for (uint64_t i = 0; i < vvl::SlabPool::kBlocksPerSlab + 1; ++i) {
+        objects.emplace_back(std::allocate_shared<Payload>(vvl::SlabAllocator<Payload>(pool), i));
+    }
+    auto stats = pool->GetStats();
+    ASSERT_EQ(stats.live, vvl::SlabPool::kBlocksPerSlab + 1);
+    ASSERT_EQ(stats.slabs, 2u);
+    ASSERT_EQ(stats.fallbacks, 0u);
+
+    Payload *freed = objects[3].get();
+    objects[3].reset();
+    ASSERT_EQ(pool->GetStats().live, vvl::SlabPool::kBlocksPerSlab);
+    // The freed block is handed out again before the slab grows
+    auto reused = std::allocate_shared<Payload>(vvl::SlabAllocator<Payload>(pool), 42);
+    ASSERT_EQ(reused.get(), freed);
+    ASSERT_EQ(reused->value, 42u);
+
+    // Objects keep the pool alive
+    std::weak_ptr<vvl::SlabPool> pool_observer = pool;
+    pool.reset();
+    ASSERT_FALSE(pool_observer.expired());
+    objects.clear();
+    ASSERT_EQ(pool_observer.lock()->GetStats().peak, vvl::SlabPool::kBlocksPerSlab + 1);
+    reused.reset();
+    ASSERT_TRUE(pool_observer.expired());
+}
@@ -425,3 +425,30 @@ TEST(CustomContainer, Enumerate) {
         ++indices_i;
     }
 }
+
+TEST(CustomContainer, SmallUnorderedMapFind) {
+    small_unordered_map<uint32_t, uint32_t, 2> map;
+    const auto &const_map = map;
+    ASSERT_TRUE(map.find(1) == map.end());
+
+    // The first two entries are inline, the third one goes to the inner map
+    map[1] = 10;
+    map[2] = 20;
+    map[3] = 30;
+    ASSERT_EQ(map.find(1)->second, 10u);
+    ASSERT_EQ(map.find(3)->second, 30u);
+    ASSERT_EQ(const_map.find(2)->second, 20u);
+    ASSERT_TRUE(const_map.find(4) == const_map.end());
+
+    map.find(3)->second = 31;
+    ASSERT_EQ(map[3], 31u);
+    map.erase(1);
+    ASSERT_TRUE(map.find(1) == map.end());
+
+    small_unordered_set<uint32_t, 1> set;
+    set.insert(5);
+    set.insert(6);
+    ASSERT_TRUE(set.find(5) != set.end());
+    ASSERT_TRUE(set.find(6) != set.end());
+    ASSERT_TRUE(set.find(7) == set.end());
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "state_tracker/state_object.h"
+#include "utils/cast_utils.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::shared_ptr<vvl::StateObject> MakeNode(uint64_t id) {
+    return std::make_shared<vvl::StateObject>(CastFromUint64<VkBuffer>(id), kVulkanObjectTypeBuffer);
+}
+
+// A parent that unlinks itself from its child when the last reference goes away, like a descriptor set
+// being freed. The last reference may be dropped by a thread that is walking the child's parents.
+class UnlinkingParent : public vvl::StateObject {
+  public:
+    UnlinkingParent(uint64_t id, vvl::StateObject& child)
+        : StateObject(CastFromUint64<VkDescriptorSet>(id), kVulkanObjectTypeDescriptorSet), child_(child) {}
+    ~UnlinkingParent() { child_.RemoveParent(this); }
+
+  private:
+    vvl::StateObject& child_;
+};
+
+}  // namespace
+
+TEST(StateObject, InUseWalksParents) {
+    auto child = MakeNode(1);
+    auto middle = MakeNode(2);
+    auto cb = std::make_shared<vvl::RefcountedStateObject>(CastFromUint64<VkCommandBuffer>(3), kVulkanObjectTypeCommandBuffer);
+    ASSERT_TRUE(child->AddParent(middle.get()));
+    ASSERT_FALSE(child->AddParent(middle.get()));
+    ASSERT_TRUE(middle->AddParent(cb.get()));
+    ASSERT_EQ(child->InUse(), nullptr);
+
+    cb->BeginUse();
+    ASSERT_NE(child->InUse(), nullptr);
+    ASSERT_EQ(*child->InUse(), middle->Handle());
+
+    // Links made before the parent unlinks its children are dropped
+    cb->UnlinkChildren();
+    ASSERT_EQ(child->InUse(), nullptr);
+    cb->EndUse();
+
+    ASSERT_TRUE(middle->AddParent(cb.get()));
+    child->RemoveParent(middle.get());
+    cb->BeginUse();
+    ASSERT_EQ(child->InUse(), nullptr);
+    ASSERT_TRUE(child->ObjectBindings().empty());
+    cb->EndUse();
+}
+
+TEST(StateObject, ConcurrentParentUpdates) {
+    auto child = MakeNode(1);
+    auto cb = std::make_shared<vvl::RefcountedStateObject>(CastFromUint64<VkCommandBuffer>(2), kVulkanObjectTypeCommandBuffer);
+    cb->BeginUse();
+    ASSERT_TRUE(child->AddParent(cb.get()));
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint32_t> failures{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&]() {
+            while (!stop.load()) {
+                // The in-use command buffer stays linked the whole time
+                if (!child->InUse()) {
+                    failures++;
+                }
+                if (child->ObjectBindings().count(cb->Handle()) == 0) {
+                    failures++;
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (uint64_t t = 0; t < 2; ++t) {
+        writers.emplace_back([&, t]() {
+            const uint64_t base = 1000 + t * 100000;
+            for (uint64_t i = 0; i < 2000; ++i) {
+                auto parent = MakeNode(base + i);
+                child->AddParent(parent.get());
+                if (i % 2) {
+                    child->RemoveParent(parent.get());
+                }
+                // Dropping a parent that unlinks itself must not wait on a reader walking the parents
+                auto unlinking = std::make_shared<UnlinkingParent>(base + 50000 + i, *child);
+                child->AddParent(unlinking.get());
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    ASSERT_EQ(failures.load(), 0u);
+
+    cb->EndUse();
+    ASSERT_EQ(child->InUse(), nullptr);
+}
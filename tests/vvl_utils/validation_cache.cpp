@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/shader_utils.h"
+
+#include <filesystem>
+
+static std::string CachePath(const char *name) {
+    return (std::filesystem::temp_directory_path() / (std::string("vvl_validation_cache_test_") + name + ".bin")).string();
+}
+
+static ValidationCache *CreateCache(const void *data = nullptr, size_t size = 0) {
+    VkValidationCacheCreateInfoEXT create_info = vku::InitStructHelper();
+    create_info.pInitialData = data;
+    create_info.initialDataSize = size;
+    return CastFromHandle<ValidationCache *>(ValidationCache::Create(&create_info));
+}
+
+TEST(ValidationCache, FileKeepsInsertions) {
+    const std::string path = CachePath("persist");
+    std::filesystem::remove(path);
+    const uint64_t hash = 0x123456789abcdef0ull;
+    {
+        // Nothing written at destruction, each insertion is already in the file
+        ValidationCache *cache = CreateCache();
+        ASSERT_TRUE(cache->OpenFile(path));
+        cache->Insert(hash);
+        cache->InsertSpecialization(7, {1, 2, 3, 64});
+        delete cache;
+    }
+    {
+        ValidationCache *cache = CreateCache();
+        ASSERT_TRUE(cache->OpenFile(path));
+        ASSERT_TRUE(cache->Contains(hash));
+        // Only the upper bits differ, which a 32 bit hash would have dropped
+        ASSERT_FALSE(cache->Contains(hash & 0xffffffffull));
+        ValidationCache::SpecializationResult result{};
+        ASSERT_TRUE(cache->FindSpecialization(7, result));
+        ASSERT_EQ(result.workgroup_shared_memory, 64u);
+        delete cache;
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(ValidationCache, FileDropsTornRecord) {
+    const std::string path = CachePath("torn");
+    std::filesystem::remove(path);
+    {
+        ValidationCache *cache = CreateCache();
+        ASSERT_TRUE(cache->OpenFile(path));
+        cache->Insert(1);
+        cache->Insert(2);
+        delete cache;
+    }
+    // Cut the last record short, as a crash during the write would
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+    {
+        ValidationCache *cache = CreateCache();
+        ASSERT_TRUE(cache->OpenFile(path));
+        ASSERT_TRUE(cache->Contains(1));
+        ASSERT_FALSE(cache->Contains(2));
+        cache->Insert(3);
+        delete cache;
+    }
+    {
+        ValidationCache *cache = CreateCache();
+        ASSERT_TRUE(cache->OpenFile(path));
+        ASSERT_TRUE(cache->Contains(1));
+        ASSERT_TRUE(cache->Contains(3));
+        delete cache;
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(ValidationCache, DataRejectsCorruption) {
+    ValidationCache *cache = CreateCache();
+    cache->Insert(10);
+    cache->Insert(20);
+    size_t size = 0;
+    cache->Write(&size, nullptr);
+    std::vector<uint8_t> data(size);
+    cache->Write(&size, data.data());
+    delete cache;
+
+    cache = CreateCache(data.data(), data.size());
+    ASSERT_TRUE(cache->Contains(10));
+    ASSERT_TRUE(cache->Contains(20));
+    delete cache;
+
+    data.back() ^= 1;
+    cache = CreateCache(data.data(), data.size());
+    ASSERT_FALSE(cache->Contains(10));
+    ASSERT_FALSE(cache->Contains(20));
+    delete cache;
+}
+
+TEST(ValidationCache, MergeIsSortedAndUnique) {
+    ValidationCache *dst = CreateCache();
+    dst->Insert(5);
+    dst->InsertSpecialization(40, {1, 1, 1, 0});
+
+    // One source loaded from data, so its entries are in the sorted arrays, the other only has recent insertions
+    ValidationCache *loaded_src = CreateCache();
+    for (uint64_t hash : {9ull, 1ull, 5ull}) {
+        loaded_src->Insert(hash);
+    }
+    loaded_src->InsertSpecialization(30, {2, 2, 2, 16});
+    size_t size = 0;
+    loaded_src->Write(&size, nullptr);
+    std::vector<uint8_t> data(size);
+    loaded_src->Write(&size, data.data());
+    delete loaded_src;
+    loaded_src = CreateCache(data.data(), data.size());
+
+    ValidationCache *recent_src = CreateCache();
+    for (uint64_t hash : {7ull, 1ull, 3ull}) {
+        recent_src->Insert(hash);
+    }
+    recent_src->InsertSpecialization(40, {1, 1, 1, 0});
+    recent_src->InsertSpecialization(20, {4, 4, 4, 32});
+
+    const ValidationCache *srcs[] = {loaded_src, recent_src, loaded_src};
+    dst->Merge(srcs, 3);
+    for (uint64_t hash : {1ull, 3ull, 5ull, 7ull, 9ull}) {
+        ASSERT_TRUE(dst->Contains(hash));
+    }
+    ASSERT_FALSE(dst->Contains(2));
+    ValidationCache::SpecializationResult result{};
+    ASSERT_TRUE(dst->FindSpecialization(20, result));
+    ASSERT_EQ(result.workgroup_shared_memory, 32u);
+    ASSERT_TRUE(dst->FindSpecialization(30, result));
+    ASSERT_EQ(result.workgroup_shared_memory, 16u);
+
+    // The hashes are written sorted, right after the header
+    size = 0;
+    dst->Write(&size, nullptr);
+    const size_t header_size = 4 * sizeof(uint32_t) + VK_UUID_SIZE + sizeof(uint64_t);
+    const size_t record_size = sizeof(uint64_t) + sizeof(ValidationCache::SpecializationResult);
+    ASSERT_EQ(size, header_size + 5 * sizeof(uint64_t) + 3 * record_size);
+    data.resize(size);
+    dst->Write(&size, data.data());
+    uint64_t hashes[5];
+    memcpy(hashes, data.data() + header_size, sizeof(hashes));
+    ASSERT_TRUE(std::is_sorted(std::begin(hashes), std::end(hashes)));
+
+    delete dst;
+    delete loaded_src;
+    delete recent_src;
+}
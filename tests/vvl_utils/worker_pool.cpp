@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "utils/worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(WorkerPool, ParallelForVisitsEachIndexOnce) {
+    vvl::WorkerPool pool(3);
+    ASSERT_EQ(pool.Parallelism(), 4u);
+
+    for (size_t count : {0u, 1u, 7u, 1000u}) {
+        std::vector<std::atomic<uint32_t>> visits(count);
+        pool.ParallelFor(count, [&](size_t index) { visits[index]++; });
+        for (const auto &visit : visits) {
+            ASSERT_EQ(visit.load(), 1u);
+        }
+    }
+}
+
+TEST(WorkerPool, NestedCallRunsInline) {
+    vvl::WorkerPool pool(2);
+    std::atomic<uint32_t> total{0};
+    pool.ParallelFor(4, [&](size_t) { pool.ParallelFor(10, [&](size_t) { total++; }); });
+    ASSERT_EQ(total.load(), 40u);
+}
+
+TEST(WorkerPool, WorkerCount) {
+    ASSERT_EQ(vvl::WorkerPool::WorkerCount(1), 0u);
+    ASSERT_EQ(vvl::WorkerPool::WorkerCount(4), 3u);
+    // 0 uses one thread per core, up to 8, and the calling thread is one of them
+    const uint32_t default_threads = std::clamp(std::thread::hardware_concurrency(), 1u, 8u);
+    ASSERT_EQ(vvl::WorkerPool::WorkerCount(0), default_threads - 1);
+}
+
+TEST(TaskQueue, RunsEveryTaskBeforeDestruction) {
+    std::atomic<uint32_t> total{0};
+    {
+        vvl::TaskQueue queue(2);
+        for (uint32_t i = 0; i < 100; ++i) {
+            queue.Push([&total]() { total++; });
+        }
+    }
+    ASSERT_EQ(total.load(), 100u);
+    {
+        vvl::TaskQueue queue(0);
+        queue.Push([&total]() { total++; });
+    }
+    ASSERT_EQ(total.load(), 101u);
+}
+
+TEST(TaskQueue, Wait) {
+    std::atomic<uint32_t> total{0};
+    vvl::TaskQueue queue(1);
+    for (uint32_t i = 0; i < 100; ++i) {
+        queue.Push([&total]() {
+            std::this_thread::yield();
+            total++;
+        });
+    }
+    queue.Wait();
+    ASSERT_EQ(total.load(), 100u);
+    // Nothing queued
+    queue.Wait();
+
+    vvl::TaskQueue inline_queue(0);
+    inline_queue.Push([&total]() { total++; });
+    inline_queue.Wait();
+    ASSERT_EQ(total.load(), 101u);
+}